@@ -74,6 +74,7 @@ int          CNSReact::allow_untagging = 0;
 int          CNSReact::normalize_species = 0;
 int          CNSReact::do_special_tagging = 0;
 int          CNSReact::ppm_type = 1;
+int          CNSReact::do_react = 1;
 
 
 Real CNSReact::gravx = 0.0;
@@ -222,6 +223,13 @@ CNSReact::read_params ()
     pp.query("normalize_species",normalize_species);
     pp.query("do_special_tagging",do_special_tagging);
     pp.query("ppm_type", ppm_type);
+
+    pp.query("do_react", do_react);
+    if (ChemDriver::isNull()) do_react = 0;
+#if (BL_SPACEDIM < 3)
+    if (do_react)
+        BoxLib::Abort("CNSReact::read_params: do_react is only supported in 3D");
+#endif
 }
 
 CNSReact::CNSReact ()
@@ -678,6 +686,8 @@ CNSReact::initData ()
 
     enforce_consistent_e(S_new);
 
+    get_new_data(Cost_Type).setVal(0.0);
+
     set_special_tagging_flag(cur_time);
 
     if (verbose && ParallelDescriptor::IOProcessor())
@@ -706,6 +716,15 @@ CNSReact::init (AmrLevel &old)
         S_new[fpi].copy(fpi());
     }
 
+    MultiFab& C_new = get_new_data(Cost_Type);
+
+    for (FillPatchIterator fpi(old,C_new,0,cur_time,Cost_Type,0,1);
+          fpi.isValid();
+          ++fpi)
+    {
+        C_new[fpi].copy(fpi());
+    }
+
     // Set E in terms of e + kinetic energy
     // enforce_consistent_e(S_new);
 }
@@ -726,6 +745,7 @@ CNSReact::init ()
     setTimeLevel(cur_time,dt_old,dt);
     MultiFab& S_new = get_new_data(State_Type);
     FillCoarsePatch(S_new, 0, cur_time, State_Type, 0, NUM_STATE);
+    FillCoarsePatch(get_new_data(Cost_Type), 0, cur_time, Cost_Type, 0, 1);
 
     // Set E in terms of e + kinetic energy
     // enforce_consistent_e(S_new);
@@ -1023,9 +1043,12 @@ CNSReact::avgDown ()
 void
 CNSReact::enforce_nonnegative_species (MultiFab& S_new)
 {
-    for (MFIter mfi(S_new); mfi.isValid(); ++mfi)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(S_new,true); mfi.isValid(); ++mfi)
     {
-       const Box& bx = mfi.validbox();
+       const Box& bx = mfi.tilebox();
        BL_FORT_PROC_CALL(CNS_ENFORCE_NONNEGATIVE_SPECIES,cns_enforce_nonnegative_species)
 	 (BL_TO_FORTRAN(S_new[mfi]),bx.loVect(),bx.hiVect());
     }
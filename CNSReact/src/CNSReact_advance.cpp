@@ -13,7 +13,41 @@ CNSReact::advance (Real time,
 {
     Real dt_new = dt;
 
+    //
+    // Strang splitting: react for dt/2, advance the hydro, react for dt/2.
+    // The first half step acts on the data that advance_hydro swaps into
+    // the old time level, so each level (subcycled or not) reacts over its
+    // own dt.
+    //
+    if (do_react)
+    {
+        MultiFab& C_new = get_new_data(Cost_Type);
+        C_new.setVal(0.0);
+        react_state(get_new_data(State_Type), C_new, 0.5*dt);
+    }
+
     dt_new = advance_hydro(time,dt,iteration,ncycle);
+
+    if (do_react)
+    {
+        MultiFab& C_new = get_new_data(Cost_Type);
+        MultiFab::Copy(C_new, get_old_data(Cost_Type), 0, 0, 1, 0);
+        react_state(get_new_data(State_Type), C_new, 0.5*dt);
+
+        if (verbose)
+        {
+            Real cost_sum = C_new.sum(0);
+            Real cost_max = 0.0;
+            for (MFIter mfi(C_new); mfi.isValid(); ++mfi)
+                cost_max = std::max(cost_max, C_new[mfi].sum(mfi.validbox(),0));
+            ParallelDescriptor::ReduceRealMax(cost_max);
+
+            if (ParallelDescriptor::IOProcessor())
+                std::cout << "[Level " << level << "] react_cost: total = " << cost_sum
+                          << ", max/mean per grid = "
+                          << cost_max*grids.size()/std::max(cost_sum,1.0) << std::endl;
+        }
+    }
  
     Real cur_time = state[State_Type].curTime();
     set_special_tagging_flag(cur_time);
@@ -21,6 +55,32 @@ CNSReact::advance (Real time,
     return dt_new;
 }
 
+void
+CNSReact::react_state (MultiFab& S,
+                       MultiFab& cost,
+                       Real      dt)
+{
+#if (BL_SPACEDIM == 3)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(S,true); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+
+        BL_FORT_PROC_CALL(CNS_REACT_STATE,cns_react_state)
+            (bx.loVect(), bx.hiVect(),
+             BL_TO_FORTRAN(S[mfi]),
+             BL_TO_FORTRAN(cost[mfi]),
+             &dt);
+    }
+
+    enforce_nonnegative_species(S);
+#else
+    BoxLib::Abort("CNSReact::react_state: only supported in 3D");
+#endif
+}
+
 Real
 CNSReact::advance_hydro (Real time,
 			 Real dt,
@@ -89,17 +149,15 @@ CNSReact::advance_hydro (Real time,
       g.GetFaceArea(levelArea[i],grids,i,NUM_GROW);
     }
 
-    // Integrate, looping through the grids.
-    FArrayBox divu, grid_volume;
-    FArrayBox dloga, area[BL_SPACEDIM];
-    FArrayBox flux[BL_SPACEDIM];
-        
     const Real *dx = geom.CellSize();
     Real courno    = -1.0e+20;
 
+    //
+    // Fluxes of whole grids, assembled from the tiles for the flux registers.
+    //
     MultiFab fluxes[BL_SPACEDIM];
 
-    if (do_reflux && fine) {
+    if (do_reflux && (fine || current)) {
       for (int j = 0; j < BL_SPACEDIM; j++) {
 	BoxArray ba = S_new.boxArray();
 	ba.surroundingNodes(j);
@@ -107,77 +165,64 @@ CNSReact::advance_hydro (Real time,
       }
     }
 
-    for (FillPatchIterator fpi(*this, S_new, NUM_GROW,
-			       time, State_Type, 0, NUM_STATE);
-	 fpi.isValid(); ++fpi) {
+    FillPatchIterator fpi(*this, S_new, NUM_GROW, time, State_Type, 0, NUM_STATE);
+    MultiFab& Sborder = fpi.get_mf();
 
-      int mfiindex = fpi.index();
+    //
+    // Integrate tile by tile.  The Fortran scratch space is sized by the
+    // tile, not the grid, and is reused by each thread across tiles.
+    //
+#if (BL_SPACEDIM == 3)
+    const bool tiling = true;
+#else
+    const bool tiling = false;  // the 1D and 2D drivers work on whole grids
+#endif
 
-      Box bx(fpi.UngrownBox());
+#ifdef _OPENMP
+#pragma omp parallel reduction(max:courno)
+#endif
+    {
+      FArrayBox flux[BL_SPACEDIM];
 
-      Box bx_g(BoxLib::grow(bx,NUM_GROW));
-      // Create FAB for extended grid values (including boundaries) and fill.
-      FArrayBox &state = fpi();
-      FArrayBox &stateout = S_new[fpi];
-            
-      grid_volume.resize(bx_g,1);
-      grid_volume.copy(levelVolume[fpi]);
+      for (MFIter mfi(S_new,tiling); mfi.isValid(); ++mfi) {
 
-      for (int i = 0; i < BL_SPACEDIM ; i++) {
-	area[i].resize(BoxLib::surroundingNodes(bx_g,i));
-	area[i].copy(levelArea[i][fpi]);
-      }
-            
-#if (BL_SPACEDIM <=2)
-      dloga.resize(bx_g);
-      dloga.copy(dLogArea[0][fpi]);
-#endif
+	const Box& bx = mfi.tilebox();
 
-      // Allocate fabs for fluxes.
-      Box bx_g1(BoxLib::grow(bx,1));
-      for (int i = 0; i < BL_SPACEDIM ; i++) {
-	flux[i].resize(BoxLib::surroundingNodes(bx_g1,i),NUM_STATE);
-      }
+	// Allocate fabs for fluxes.
+	Box bx_g1(BoxLib::grow(bx,1));
+	for (int i = 0; i < BL_SPACEDIM ; i++) {
+	  flux[i].resize(BoxLib::surroundingNodes(bx_g1,i),NUM_STATE);
+	}
 
-      const int*  domain_lo = geom.Domain().loVect();
-      const int*  domain_hi = geom.Domain().hiVect();
-
-      Real cflLoc = -1.0e+20;
-      int is_finest_level = 0;
-      if (level == finest_level) is_finest_level = 1;
-
-      BL_FORT_PROC_CALL(CNS_UMDRV,cns_umdrv)
-	(bx.loVect(), bx.hiVect(),
-	 BL_TO_FORTRAN(state), BL_TO_FORTRAN(stateout),
-	 dx, &dt,
-	 D_DECL(BL_TO_FORTRAN(flux[0]), 
-		BL_TO_FORTRAN(flux[1]), 
-		BL_TO_FORTRAN(flux[2])), 
-	 D_DECL(BL_TO_FORTRAN(area[0]), 
-		BL_TO_FORTRAN(area[1]), 
-		BL_TO_FORTRAN(area[2])), 
+	Real cflLoc = -1.0e+20;
+
+	BL_FORT_PROC_CALL(CNS_UMDRV,cns_umdrv)
+	  (bx.loVect(), bx.hiVect(),
+	   BL_TO_FORTRAN(Sborder[mfi]), BL_TO_FORTRAN(S_new[mfi]),
+	   dx, &dt,
+	   D_DECL(BL_TO_FORTRAN(flux[0]), 
+		  BL_TO_FORTRAN(flux[1]), 
+		  BL_TO_FORTRAN(flux[2])), 
+	   D_DECL(BL_TO_FORTRAN(levelArea[0][mfi]), 
+		  BL_TO_FORTRAN(levelArea[1][mfi]), 
+		  BL_TO_FORTRAN(levelArea[2][mfi])), 
 #if (BL_SPACEDIM < 3) 
-	 BL_TO_FORTRAN(dloga), 
+	   BL_TO_FORTRAN(dLogArea[0][mfi]), 
 #endif
-	 BL_TO_FORTRAN(grid_volume), 
-	 &cflLoc,verbose);
+	   BL_TO_FORTRAN(levelVolume[mfi]), 
+	   &cflLoc,verbose);
 
-      if (do_reflux) {
-	if (fine) {
-	  for (int i = 0; i < BL_SPACEDIM ; i++) {
-                        fluxes[i][fpi].copy(flux[i]);
-	  }
-	}
-	if (current) {
+	// Each face belongs to exactly one tile's nodal tile box.
+	if (do_reflux && (fine || current)) {
 	  for (int i = 0; i < BL_SPACEDIM ; i++) {
-	    current->FineAdd(flux[i],i,mfiindex,0,0,NUM_STATE,1);
+	    fluxes[i][mfi].copy(flux[i],mfi.nodaltilebox(i));
 	  }
 	}
-      }
 
-      courno = std::max(courno,cflLoc);
+	courno = std::max(courno,cflLoc);
 
-    } // end for(fpi...)
+      } // end for(mfi...)
+    }
 
     if (do_reflux && fine) {
       for (int i = 0; i < BL_SPACEDIM ; i++) {
@@ -185,6 +230,14 @@ CNSReact::advance_hydro (Real time,
       }
     }
 
+    if (do_reflux && current) {
+      for (MFIter mfi(fluxes[0]); mfi.isValid(); ++mfi) {
+	for (int i = 0; i < BL_SPACEDIM ; i++) {
+	  current->FineAdd(fluxes[i][mfi],i,mfi.index(),0,0,NUM_STATE,1);
+	}
+      }
+    }
+
     ParallelDescriptor::ReduceRealMax(courno);
 
     if (courno > 1.0) {
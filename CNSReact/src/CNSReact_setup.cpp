@@ -155,6 +155,10 @@ CNSReact::variableSetUp ()
          NumAdv, small_dens, small_temp, small_pres, 
          ppm_type, normalize_species);
 
+#if (BL_SPACEDIM == 3)
+    BL_FORT_PROC_CALL(CNS_INIT_UMDRV, cns_init_umdrv)();
+#endif
+
     Real run_stop = ParallelDescriptor::second() - run_strt;
  
     ParallelDescriptor::ReduceRealMax(run_stop,ParallelDescriptor::IOProcessorNumber());
@@ -234,6 +238,16 @@ CNSReact::variableSetUp ()
                           BndryFunc(BL_FORT_PROC_CALL(CNS_DENFILL,cns_denfill),
                                     BL_FORT_PROC_CALL(CNS_HYPFILL,cns_hypfill)));
 
+    // Integrator work per cell in the last reaction step (VODE RHS
+    // evaluations over both half steps); a map of the chemistry cost.
+    desc_lst.addDescriptor(Cost_Type,IndexType::TheCellType(),
+                           StateDescriptor::Point,0,1,
+                           &pc_interp,state_data_extrap,store_in_checkpoint);
+
+    set_scalar_bc(bc,phys_bc);
+    desc_lst.setComponent(Cost_Type,0,"react_cost",bc,
+                          BndryFunc(BL_FORT_PROC_CALL(CNS_DENFILL,cns_denfill)));
+
     //
     // DEFINE DERIVED QUANTITIES
     //
@@ -137,6 +137,36 @@ contains
   end subroutine eos_get_TP
 
 
+  ! Batched eos_get_TP on np points with Y(np,nspecies).  T is used as
+  ! the initial guess for the Newton iteration, so it must be set.
+  subroutine eos_get_TP_vec(np, T, P, rho, e, Y)
+
+    use eos_vec_module, only : eos_vec_get_T, eos_vec_get_p
+
+    implicit none
+
+    integer, intent(in) :: np
+    double precision, intent(inout) :: T(np)
+    double precision, intent(out) :: P(np)
+    double precision, intent(in ) :: rho(np), e(np), Y(np,nspecies)
+
+    integer :: i, ierr(np)
+    double precision :: cv(np)
+
+    ! like feeytt, out-of-range energies are extrapolated without error
+    call eos_vec_get_T(np, e, Y, T, cv, ierr)
+    do i = 1, np
+       T(i) = max(T(i), smallt)
+    end do
+
+    call eos_vec_get_p(np, rho, T, Y, P)
+    do i = 1, np
+       P(i) = max(P(i), smallp)
+    end do
+
+  end subroutine eos_get_TP_vec
+
+
   subroutine eos_get_eP(e, P, rho, T, Y, pt_index)
     
     implicit none
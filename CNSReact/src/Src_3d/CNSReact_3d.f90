@@ -20,7 +20,7 @@ subroutine cns_umdrv(lo,hi,&
   use advection_module, only : umeth3d, ctoprim, ptoderiv, srctosrcQ, uflaten, divu, consup, &
        enforce_minimum_density, normalize_new_species
   use diff_flux_module, only : diffFlux, fluxtosrc, diffup
-  use chemsolv_module, only : chemsolv
+  use scratch_module, only : SCRATCH_UMDRV, scratch_begin, scratch_3d, scratch_4d
 
   implicit none
 
@@ -52,67 +52,77 @@ subroutine cns_umdrv(lo,hi,&
   integer :: lo_diff(3),hi_diff(3)
   integer :: lo_hyp(3), hi_hyp(3)
 
-  double precision, allocatable:: q(:,:,:,:)
-  double precision, allocatable:: dpdr(:,:,:)
-  double precision, allocatable:: dpde(:,:,:)
-  double precision, allocatable:: gamc(:,:,:)
-  double precision, allocatable:: flatn(:,:,:)
-  double precision, allocatable:: c(:,:,:)
-  double precision, allocatable:: csml(:,:,:)
-  double precision, allocatable:: div(:,:,:)
-  double precision, allocatable:: pdivu(:,:,:)
-  double precision, allocatable:: src (:,:,:,:)
-  double precision, allocatable:: srcQ(:,:,:,:)
-
-  double precision, allocatable:: dfluxx(:,:,:,:)
-  double precision, allocatable:: dfluxy(:,:,:,:)
-  double precision, allocatable:: dfluxz(:,:,:,:)
+  double precision, pointer, contiguous :: q(:,:,:,:)
+  double precision, pointer, contiguous :: dpdr(:,:,:)
+  double precision, pointer, contiguous :: dpde(:,:,:)
+  double precision, pointer, contiguous :: gamc(:,:,:)
+  double precision, pointer, contiguous :: flatn(:,:,:)
+  double precision, pointer, contiguous :: c(:,:,:)
+  double precision, pointer, contiguous :: csml(:,:,:)
+  double precision, pointer, contiguous :: div(:,:,:)
+  double precision, pointer, contiguous :: pdivu(:,:,:)
+  double precision, pointer, contiguous :: src (:,:,:,:)
+  double precision, pointer, contiguous :: srcQ(:,:,:,:)
+
+  double precision, pointer, contiguous :: dfluxx(:,:,:,:)
+  double precision, pointer, contiguous :: dfluxy(:,:,:,:)
+  double precision, pointer, contiguous :: dfluxz(:,:,:,:)
 
   double precision :: dx,dy,dz, dt_flux, dt_src
   integer :: iflaten, dflux_timer
+  integer :: q_l1,q_l2,q_l3,q_h1,q_h2,q_h3, nq, nhyp1, ndiff
 
-  allocate(    q(uin_l1:uin_h1,uin_l2:uin_h2,uin_l3:uin_h3,QVAR))
-  allocate( dpdr(uin_l1:uin_h1,uin_l2:uin_h2,uin_l3:uin_h3))
-  allocate( dpde(uin_l1:uin_h1,uin_l2:uin_h2,uin_l3:uin_h3))
-  allocate( gamc(uin_l1:uin_h1,uin_l2:uin_h2,uin_l3:uin_h3))
-  allocate(flatn(uin_l1:uin_h1,uin_l2:uin_h2,uin_l3:uin_h3))
-  allocate(    c(uin_l1:uin_h1,uin_l2:uin_h2,uin_l3:uin_h3))
-  allocate( csml(uin_l1:uin_h1,uin_l2:uin_h2,uin_l3:uin_h3))
+  ! lo:hi may be a tile of the grid; primitive variables are only needed
+  ! on the tile grown by NHYP+NDIF, not on all of uin.
+  q_l1 = lo(1)-NHYP-NDIF
+  q_l2 = lo(2)-NHYP-NDIF
+  q_l3 = lo(3)-NHYP-NDIF
+  q_h1 = hi(1)+NHYP+NDIF
+  q_h2 = hi(2)+NHYP+NDIF
+  q_h3 = hi(3)+NHYP+NDIF
 
   lo_hyp(1:3)= lo(1:3)-NDIF   ! hyperbolic solve on this domain
   hi_hyp(1:3)= hi(1:3)+NDIF  
 
-  allocate(  div(lo_hyp(1):hi_hyp(1)+1,lo_hyp(2):hi_hyp(2)+1,lo_hyp(3):hi_hyp(3)+1))
-  allocate(pdivu(lo_hyp(1):hi_hyp(1)  ,lo_hyp(2):hi_hyp(2)  ,lo_hyp(3):hi_hyp(3)  ))
-
   lo_diff(1:3)= lo(1:3)-NDIF-1 ! domain for the first diffusion solve
   hi_diff(1:3)= hi(1:3)+NDIF+1 
 
-  allocate(dfluxx(lo_diff(1):hi_diff(1)+1,lo_diff(2):hi_diff(2)  ,lo_diff(3):hi_diff(3)  ,NVAR))
-  allocate(dfluxy(lo_diff(1):hi_diff(1)  ,lo_diff(2):hi_diff(2)+1,lo_diff(3):hi_diff(3)  ,NVAR))
-  allocate(dfluxz(lo_diff(1):hi_diff(1)  ,lo_diff(2):hi_diff(2)  ,lo_diff(3):hi_diff(3)+1,NVAR))
+  ! All scratch comes from a per-thread arena that is reused across tiles
+  nq    = (q_h1-q_l1+1)*(q_h2-q_l2+1)*(q_h3-q_l3+1)
+  nhyp1 = product(hi_hyp-lo_hyp+2)
+  ndiff = product(hi_diff-lo_diff+2)
+  call scratch_begin(SCRATCH_UMDRV, nq*(QVAR+6) + 2*nhyp1 + ndiff*(4*NVAR+QVAR))
+
+  q     => scratch_4d(SCRATCH_UMDRV, (/q_l1,q_l2,q_l3/), (/q_h1,q_h2,q_h3/), QVAR)
+  dpdr  => scratch_3d(SCRATCH_UMDRV, (/q_l1,q_l2,q_l3/), (/q_h1,q_h2,q_h3/))
+  dpde  => scratch_3d(SCRATCH_UMDRV, (/q_l1,q_l2,q_l3/), (/q_h1,q_h2,q_h3/))
+  gamc  => scratch_3d(SCRATCH_UMDRV, (/q_l1,q_l2,q_l3/), (/q_h1,q_h2,q_h3/))
+  flatn => scratch_3d(SCRATCH_UMDRV, (/q_l1,q_l2,q_l3/), (/q_h1,q_h2,q_h3/))
+  c     => scratch_3d(SCRATCH_UMDRV, (/q_l1,q_l2,q_l3/), (/q_h1,q_h2,q_h3/))
+  csml  => scratch_3d(SCRATCH_UMDRV, (/q_l1,q_l2,q_l3/), (/q_h1,q_h2,q_h3/))
+
+  div   => scratch_3d(SCRATCH_UMDRV, lo_hyp, hi_hyp+1)
+  pdivu => scratch_3d(SCRATCH_UMDRV, lo_hyp, hi_hyp)
 
-  allocate(src (lo_diff(1):hi_diff(1),lo_diff(2):hi_diff(2),lo_diff(3):hi_diff(3),NVAR))
-  allocate(srcQ(lo_diff(1):hi_diff(1),lo_diff(2):hi_diff(2),lo_diff(3):hi_diff(3),QVAR))
+  dfluxx => scratch_4d(SCRATCH_UMDRV, lo_diff, hi_diff+(/1,0,0/), NVAR)
+  dfluxy => scratch_4d(SCRATCH_UMDRV, lo_diff, hi_diff+(/0,1,0/), NVAR)
+  dfluxz => scratch_4d(SCRATCH_UMDRV, lo_diff, hi_diff+(/0,0,1/), NVAR)
+
+  src  => scratch_4d(SCRATCH_UMDRV, lo_diff, hi_diff, NVAR)
+  srcQ => scratch_4d(SCRATCH_UMDRV, lo_diff, hi_diff, QVAR)
 
   dx = delta(1)
   dy = delta(2)
   dz = delta(3)
 
-  ! Chemically react input state for half time step
-  lo_work = lo-NHYP-NDIF
-  hi_work = hi+NHYP+NDIF
-  call chemsolv(lo_work, hi_work, &
-       uin,uin_l1,uin_l2,uin_l3,uin_h1,uin_h2,uin_h3, 0.5d0*dt)
-
   lo_work = lo_hyp - NHYP
   hi_work = hi_hyp + NHYP
   call ctoprim(lo_work, hi_work, &
        uin,uin_l1,uin_l2,uin_l3,uin_h1,uin_h2,uin_h3, &
-       q  ,uin_l1,uin_l2,uin_l3,uin_h1,uin_h2,uin_h3)
+       q  ,q_l1,q_l2,q_l3,q_h1,q_h2,q_h3)
 
   call ptoderiv(lo_work, hi_work, q, c, gamc, csml, dpdr, dpde, &
-       uin_l1,uin_l2,uin_l3,uin_h1,uin_h2,uin_h3, &
+       q_l1,q_l2,q_l3,q_h1,q_h2,q_h3, &
        courno,dx,dy,dz,dt,lo,hi)
 
   iflaten = 1
@@ -124,14 +134,14 @@ subroutine cns_umdrv(lo,hi,&
           q(:,:,:,QU), &
           q(:,:,:,QV), &
           q(:,:,:,QW), &
-          flatn,uin_l1,uin_l2,uin_l3,uin_h1,uin_h2,uin_h3)
+          flatn,q_l1,q_l2,q_l3,q_h1,q_h2,q_h3)
   else
      flatn = 1.d0
   end if
 
   dflux_timer = 1
   call diffFlux(lo_diff,hi_diff, &
-       q,uin_l1,uin_l2,uin_l3,uin_h1,uin_h2,uin_h3, &
+       q,q_l1,q_l2,q_l3,q_h1,q_h2,q_h3, &
        dfluxx,lo_diff(1),lo_diff(2),lo_diff(3),hi_diff(1)+1,hi_diff(2),hi_diff(3),&
        dfluxy,lo_diff(1),lo_diff(2),lo_diff(3),hi_diff(1),hi_diff(2)+1,hi_diff(3),&
        dfluxz,lo_diff(1),lo_diff(2),lo_diff(3),hi_diff(1),hi_diff(2),hi_diff(3)+1,&
@@ -149,11 +159,11 @@ subroutine cns_umdrv(lo,hi,&
        vol  ,  vol_l1,  vol_l2,  vol_l3,  vol_h1,  vol_h2,  vol_h3)
 
   call srctosrcQ(src,srcQ,lo_diff(1),lo_diff(2),lo_diff(3),hi_diff(1),hi_diff(2),hi_diff(3),&
-       q,uin_l1,uin_l2,uin_l3,uin_h1,uin_h2,uin_h3, &
-       dpdr,dpde,uin_l1,uin_l2,uin_l3,uin_h1,uin_h2,uin_h3)
+       q,q_l1,q_l2,q_l3,q_h1,q_h2,q_h3, &
+       dpdr,dpde,q_l1,q_l2,q_l3,q_h1,q_h2,q_h3)
   
   ! Compute hyperbolic fluxes using unsplit Godunov
-  call umeth3d(q,c,gamc,csml,flatn,uin_l1,uin_l2,uin_l3,uin_h1,uin_h2,uin_h3, &
+  call umeth3d(q,c,gamc,csml,flatn,q_l1,q_l2,q_l3,q_h1,q_h2,q_h3, &
        srcQ,lo_diff(1),lo_diff(2),lo_diff(3),hi_diff(1),hi_diff(2),hi_diff(3),&
        lo_hyp(1),lo_hyp(2),lo_hyp(3),hi_hyp(1),hi_hyp(2),hi_hyp(3),dx,dy,dz,dt, &
        flux1,flux1_l1,flux1_l2,flux1_l3,flux1_h1,flux1_h2,flux1_h3, &
@@ -162,7 +172,7 @@ subroutine cns_umdrv(lo,hi,&
        pdivu)
   
   ! Compute divergence of velocity field (on surroundingNodes(lo,hi))
-  call divu(lo_hyp,hi_hyp,q,uin_l1,uin_l2,uin_l3,uin_h1,uin_h2,uin_h3, &
+  call divu(lo_hyp,hi_hyp,q,q_l1,q_l2,q_l3,q_h1,q_h2,q_h3, &
        dx,dy,dz,div,lo_hyp(1),lo_hyp(2),lo_hyp(3),hi_hyp(1)+1,hi_hyp(2)+1,hi_hyp(3)+1)
   
   ! Conservative update using hyperbolic flux (w diffusion source terms)
@@ -176,16 +186,16 @@ subroutine cns_umdrv(lo,hi,&
        area2,area2_l1,area2_l2,area2_l3,area2_h1,area2_h2,area2_h3, &
        area3,area3_l1,area3_l2,area3_l3,area3_h1,area3_h2,area3_h3, &
        vol,vol_l1,vol_l2,vol_l3,vol_h1,vol_h2,vol_h3, &
-       div,pdivu,lo_hyp,hi_hyp,dx,dy,dz,dt)
+       div,pdivu,lo_hyp,hi_hyp,lo,hi,dx,dy,dz,dt)
 
   ! Get primitives of the "guess" state
   call ctoprim(lo_hyp, hi_hyp, &
        uin,uin_l1,uin_l2,uin_l3,uin_h1,uin_h2,uin_h3, &
-       q  ,uin_l1,uin_l2,uin_l3,uin_h1,uin_h2,uin_h3)
+       q  ,q_l1,q_l2,q_l3,q_h1,q_h2,q_h3)
 
   dflux_timer = 2
   call diffFlux(lo, hi, &
-       q,uin_l1,uin_l2,uin_l3,uin_h1,uin_h2,uin_h3, &
+       q,q_l1,q_l2,q_l3,q_h1,q_h2,q_h3, &
        dfluxx,lo_diff(1),lo_diff(2),lo_diff(3),hi_diff(1)+1,hi_diff(2),hi_diff(3),&
        dfluxy,lo_diff(1),lo_diff(2),lo_diff(3),hi_diff(1),hi_diff(2)+1,hi_diff(3),&
        dfluxz,lo_diff(1),lo_diff(2),lo_diff(3),hi_diff(1),hi_diff(2),hi_diff(3)+1,&
@@ -207,10 +217,6 @@ subroutine cns_umdrv(lo,hi,&
        vol  ,  vol_l1,  vol_l2,  vol_l3,  vol_h1,  vol_h2,  vol_h3, &
        dx,dy,dz,dt_flux, dt_src)
 
-  ! Chemically react input state for half time step
-  call chemsolv(lo, hi, &
-       uout,uout_l1,uout_l2,uout_l3,uout_h1,uout_h2,uout_h3, 0.5d0*dt)
-
   ! Add diffusion fluxes to hyperbolic fluxes to pass back to AMR
   flux1 = flux1 + dfluxx(flux1_l1:flux1_h1,flux1_l2:flux1_h2,flux1_l3:flux1_h3,:)
   flux2 = flux2 + dfluxy(flux2_l1:flux2_h1,flux2_l2:flux2_h2,flux2_l3:flux2_h3,:)
@@ -231,11 +237,53 @@ subroutine cns_umdrv(lo,hi,&
           lo,hi)
   end if
   
-  deallocate(q,dpdr,dpde,gamc,flatn,c,csml,div,src,srcQ,pdivu)
-  deallocate(dfluxx,dfluxy,dfluxz)
-  
 end subroutine cns_umdrv
 
+! :::
+! ::: ----------------------------------------------------------------
+! ::: One-time setup for cns_umdrv that must not happen inside OpenMP
+! ::: parallel regions.
+! :::
+
+subroutine cns_init_umdrv()
+
+  use diff_flux_module, only : diff_flux_init
+
+  implicit none
+
+  call diff_flux_init()
+
+end subroutine cns_init_umdrv
+
+! :::
+! ::: ----------------------------------------------------------------
+! ::: React the state on lo:hi (a tile of the valid region) for dt at
+! ::: constant volume, adding the per-cell integrator work to cost.
+! :::
+
+subroutine cns_react_state(lo,hi,&
+     u   ,   u_l1,   u_l2,   u_l3,   u_h1,   u_h2,   u_h3, &
+     cost,cost_l1,cost_l2,cost_l3,cost_h1,cost_h2,cost_h3, &
+     dt)
+
+  use meth_params_module, only : NVAR
+  use chemsolv_module, only : chemsolv
+
+  implicit none
+
+  integer,intent(in):: lo(3),hi(3)
+  integer,intent(in)::    u_l1,    u_l2,    u_l3,    u_h1,    u_h2,    u_h3
+  integer,intent(in):: cost_l1, cost_l2, cost_l3, cost_h1, cost_h2, cost_h3
+  double precision,intent(inout)::    u(   u_l1:   u_h1,   u_l2:   u_h2,   u_l3:   u_h3,NVAR)
+  double precision,intent(inout):: cost(cost_l1:cost_h1,cost_l2:cost_h2,cost_l3:cost_h3)
+  double precision,intent(in) :: dt
+
+  call chemsolv(lo, hi, &
+       u   ,   u_l1,   u_l2,   u_l3,   u_h1,   u_h2,   u_h3, &
+       cost,cost_l1,cost_l2,cost_l3,cost_h1,cost_h2,cost_h3, dt)
+
+end subroutine cns_react_state
+
 ! :: ----------------------------------------------------------
 ! :: Volume-weight average the fine grid data onto the coarse
 ! :: grid.  Overlap is given in coarse grid coordinates.
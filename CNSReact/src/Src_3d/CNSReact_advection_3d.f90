@@ -45,6 +45,7 @@ contains
       use trace_module, only : tracexy, tracez
       use ppm_module, only : ppm
       use slope_module, only : uslope, pslope
+      use scratch_module, only : SCRATCH_UMETH, scratch_begin, scratch_3d, scratch_4d, scratch_6d
 
       implicit none
 
@@ -72,126 +73,132 @@ contains
       double precision hdtdx, hdtdy, hdtdz
 
       integer km,kc,kt,k3d,n
+      integer nslab
       integer i,j
 
       ! Left and right state arrays (edge centered, cell centered)
-      double precision, allocatable:: dqx(:,:,:,:), dqy(:,:,:,:), dqz(:,:,:,:)
-      double precision, allocatable::qxm(:,:,:,:),qym(:,:,:,:), qzm(:,:,:,:)
-      double precision, allocatable::qxp(:,:,:,:),qyp(:,:,:,:), qzp(:,:,:,:)
+      double precision, pointer, contiguous:: dqx(:,:,:,:), dqy(:,:,:,:), dqz(:,:,:,:)
+      double precision, pointer, contiguous::qxm(:,:,:,:),qym(:,:,:,:), qzm(:,:,:,:)
+      double precision, pointer, contiguous::qxp(:,:,:,:),qyp(:,:,:,:), qzp(:,:,:,:)
 
-      double precision, allocatable::qmxy(:,:,:,:),qpxy(:,:,:,:)
-      double precision, allocatable::qmxz(:,:,:,:),qpxz(:,:,:,:)
+      double precision, pointer, contiguous::qmxy(:,:,:,:),qpxy(:,:,:,:)
+      double precision, pointer, contiguous::qmxz(:,:,:,:),qpxz(:,:,:,:)
 
-      double precision, allocatable::qmyx(:,:,:,:),qpyx(:,:,:,:)
-      double precision, allocatable::qmyz(:,:,:,:),qpyz(:,:,:,:)
+      double precision, pointer, contiguous::qmyx(:,:,:,:),qpyx(:,:,:,:)
+      double precision, pointer, contiguous::qmyz(:,:,:,:),qpyz(:,:,:,:)
 
-      double precision, allocatable::qmzx(:,:,:,:),qpzx(:,:,:,:)
-      double precision, allocatable::qmzy(:,:,:,:),qpzy(:,:,:,:)
+      double precision, pointer, contiguous::qmzx(:,:,:,:),qpzx(:,:,:,:)
+      double precision, pointer, contiguous::qmzy(:,:,:,:),qpzy(:,:,:,:)
 
-      double precision, allocatable::qxl(:,:,:,:),qxr(:,:,:,:)
-      double precision, allocatable::qyl(:,:,:,:),qyr(:,:,:,:)
-      double precision, allocatable::qzl(:,:,:,:),qzr(:,:,:,:)
+      double precision, pointer, contiguous::qxl(:,:,:,:),qxr(:,:,:,:)
+      double precision, pointer, contiguous::qyl(:,:,:,:),qyr(:,:,:,:)
+      double precision, pointer, contiguous::qzl(:,:,:,:),qzr(:,:,:,:)
 
       ! Work arrays to hold 3 planes of riemann state and conservative fluxes
-      double precision, allocatable::   fx(:,:,:,:),  fy(:,:,:,:), fz(:,:,:,:)
+      double precision, pointer, contiguous::   fx(:,:,:,:),  fy(:,:,:,:), fz(:,:,:,:)
 
-      double precision, allocatable::fxy(:,:,:,:),fxz(:,:,:,:)
-      double precision, allocatable::fyx(:,:,:,:),fyz(:,:,:,:)
-      double precision, allocatable::fzx(:,:,:,:),fzy(:,:,:,:)
+      double precision, pointer, contiguous::fxy(:,:,:,:),fxz(:,:,:,:)
+      double precision, pointer, contiguous::fyx(:,:,:,:),fyz(:,:,:,:)
+      double precision, pointer, contiguous::fzx(:,:,:,:),fzy(:,:,:,:)
 
-      double precision, allocatable:: pgdnvx(:,:,:), ugdnvx(:,:,:)
-      double precision, allocatable:: pgdnvxf(:,:,:), ugdnvxf(:,:,:)
-      double precision, allocatable:: pgdnvtmpx(:,:,:), ugdnvtmpx(:,:,:)
+      double precision, pointer, contiguous:: pgdnvx(:,:,:), ugdnvx(:,:,:)
+      double precision, pointer, contiguous:: pgdnvxf(:,:,:), ugdnvxf(:,:,:)
+      double precision, pointer, contiguous:: pgdnvtmpx(:,:,:), ugdnvtmpx(:,:,:)
 
-      double precision, allocatable:: pgdnvy(:,:,:), ugdnvy(:,:,:)
-      double precision, allocatable:: pgdnvyf(:,:,:), ugdnvyf(:,:,:)
-      double precision, allocatable:: pgdnvtmpy(:,:,:), ugdnvtmpy(:,:,:)
+      double precision, pointer, contiguous:: pgdnvy(:,:,:), ugdnvy(:,:,:)
+      double precision, pointer, contiguous:: pgdnvyf(:,:,:), ugdnvyf(:,:,:)
+      double precision, pointer, contiguous:: pgdnvtmpy(:,:,:), ugdnvtmpy(:,:,:)
 
-      double precision, allocatable:: pgdnvz(:,:,:), ugdnvz(:,:,:)
-      double precision, allocatable:: pgdnvtmpz1(:,:,:), ugdnvtmpz1(:,:,:)
-      double precision, allocatable:: pgdnvtmpz2(:,:,:), ugdnvtmpz2(:,:,:)
+      double precision, pointer, contiguous:: pgdnvz(:,:,:), ugdnvz(:,:,:)
+      double precision, pointer, contiguous:: pgdnvtmpz1(:,:,:), ugdnvtmpz1(:,:,:)
+      double precision, pointer, contiguous:: pgdnvtmpz2(:,:,:), ugdnvtmpz2(:,:,:)
 
-      double precision, allocatable:: pgdnvzf(:,:,:), ugdnvzf(:,:,:)
+      double precision, pointer, contiguous:: pgdnvzf(:,:,:), ugdnvzf(:,:,:)
 
-      double precision, allocatable:: Ip(:,:,:,:,:,:), Im(:,:,:,:,:,:)
+      double precision, pointer, contiguous:: Ip(:,:,:,:,:,:), Im(:,:,:,:,:,:)
 
-      allocate ( pgdnvx(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2))
-      allocate ( ugdnvx(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2))
-      allocate ( pgdnvxf(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2))
-      allocate ( ugdnvxf(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2))
-      allocate ( pgdnvtmpx(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2))
-      allocate ( ugdnvtmpx(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2))
+      ! Scratch for the slab arrays comes from a per-thread arena; nslab
+      ! bounds the size of one (x,y,2) slab of any of them.
+      nslab = (ihi1-ilo1+4)*(ihi2-ilo2+4)*2
+      call scratch_begin(SCRATCH_UMETH, nslab*(20 + 45*QVAR + 9*NVAR))
 
-      allocate ( pgdnvy(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2))
-      allocate ( ugdnvy(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2))
-      allocate ( pgdnvyf(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2))
-      allocate ( ugdnvyf(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2))
-      allocate ( pgdnvtmpy(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2))
-      allocate ( ugdnvtmpy(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2))
+      pgdnvx => scratch_3d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/))
+      ugdnvx => scratch_3d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/))
+      pgdnvxf => scratch_3d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/))
+      ugdnvxf => scratch_3d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/))
+      pgdnvtmpx => scratch_3d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/))
+      ugdnvtmpx => scratch_3d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/))
 
-      allocate ( pgdnvz(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2))
-      allocate ( ugdnvz(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2))
-      allocate ( pgdnvtmpz1(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2))
-      allocate ( ugdnvtmpz1(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2))
-      allocate ( pgdnvtmpz2(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2))
-      allocate ( ugdnvtmpz2(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2))
-      allocate ( pgdnvzf(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2))
-      allocate ( ugdnvzf(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2))
+      pgdnvy => scratch_3d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/))
+      ugdnvy => scratch_3d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/))
+      pgdnvyf => scratch_3d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/))
+      ugdnvyf => scratch_3d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/))
+      pgdnvtmpy => scratch_3d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/))
+      ugdnvtmpy => scratch_3d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/))
 
-      allocate ( dqx(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
-      allocate ( dqy(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
-      allocate ( dqz(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
+      pgdnvz => scratch_3d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/))
+      ugdnvz => scratch_3d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/))
+      pgdnvtmpz1 => scratch_3d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/))
+      ugdnvtmpz1 => scratch_3d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/))
+      pgdnvtmpz2 => scratch_3d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/))
+      ugdnvtmpz2 => scratch_3d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/))
+      pgdnvzf => scratch_3d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/))
+      ugdnvzf => scratch_3d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/))
 
-      allocate ( qxm(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
-      allocate ( qxp(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
+      dqx => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
+      dqy => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
+      dqz => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
 
-      allocate ( qmxy(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
-      allocate ( qpxy(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
+      qxm => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
+      qxp => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
 
-      allocate ( qmxz(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
-      allocate ( qpxz(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
+      qmxy => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
+      qpxy => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
 
-      allocate ( qym(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
-      allocate ( qyp(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
+      qmxz => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
+      qpxz => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
 
-      allocate ( qmyx(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
-      allocate ( qpyx(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
+      qym => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
+      qyp => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
 
-      allocate ( qmyz(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
-      allocate ( qpyz(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
+      qmyx => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
+      qpyx => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
 
-      allocate ( qzm(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
-      allocate ( qzp(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
+      qmyz => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
+      qpyz => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
 
-      allocate ( qxl(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
-      allocate ( qxr(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
-      allocate ( qyl(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
-      allocate ( qyr(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
-      allocate ( qzl(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
-      allocate ( qzr(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
+      qzm => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
+      qzp => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
 
-      allocate ( qmzx(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
-      allocate ( qpzx(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
+      qxl => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
+      qxr => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
+      qyl => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
+      qyr => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
+      qzl => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
+      qzr => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
 
-      allocate ( qmzy(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
-      allocate ( qpzy(ilo1-1:ihi1+2,ilo2-1:ihi2+2,2,QVAR))
+      qmzx => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
+      qpzx => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
 
-      allocate ( fx(ilo1:ihi1+1,ilo2-1:ihi2+1,2,NVAR))
-      allocate ( fy(ilo1-1:ihi1+1,ilo2:ihi2+1,2,NVAR))
-      allocate ( fz(ilo1-1:ihi1+1,ilo2-1:ihi2+1,2,NVAR))
+      qmzy => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
+      qpzy => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+2,ihi2+2,2/),QVAR)
 
-      allocate ( fxy(ilo1:ihi1+1,ilo2-1:ihi2+1,2,NVAR))
-      allocate ( fxz(ilo1:ihi1+1,ilo2-1:ihi2+1,2,NVAR))
+      fx => scratch_4d(SCRATCH_UMETH,(/ilo1,ilo2-1,1/),(/ihi1+1,ihi2+1,2/),NVAR)
+      fy => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2,1/),(/ihi1+1,ihi2+1,2/),NVAR)
+      fz => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+1,ihi2+1,2/),NVAR)
 
-      allocate ( fyx(ilo1-1:ihi1+1,ilo2:ihi2+1,2,NVAR))
-      allocate ( fyz(ilo1-1:ihi1+1,ilo2:ihi2+1,2,NVAR))
+      fxy => scratch_4d(SCRATCH_UMETH,(/ilo1,ilo2-1,1/),(/ihi1+1,ihi2+1,2/),NVAR)
+      fxz => scratch_4d(SCRATCH_UMETH,(/ilo1,ilo2-1,1/),(/ihi1+1,ihi2+1,2/),NVAR)
 
-      allocate ( fzx(ilo1:ihi1,ilo2-1:ihi2+1,2,NVAR))
-      allocate ( fzy(ilo1-1:ihi1+1,ilo2:ihi2,2,NVAR))
+      fyx => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2,1/),(/ihi1+1,ihi2+1,2/),NVAR)
+      fyz => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2,1/),(/ihi1+1,ihi2+1,2/),NVAR)
+
+      fzx => scratch_4d(SCRATCH_UMETH,(/ilo1,ilo2-1,1/),(/ihi1,ihi2+1,2/),NVAR)
+      fzy => scratch_4d(SCRATCH_UMETH,(/ilo1-1,ilo2,1/),(/ihi1+1,ihi2,2/),NVAR)
 
       ! x-index, y-index, z-index, dim, characteristics, variables
-      allocate ( Ip(ilo1-1:ihi1+1,ilo2-1:ihi2+1,2,3,3,QVAR))
-      allocate ( Im(ilo1-1:ihi1+1,ilo2-1:ihi2+1,2,3,3,QVAR))
+      Ip => scratch_6d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+1,ihi2+1,2/),QVAR)
+      Im => scratch_6d(SCRATCH_UMETH,(/ilo1-1,ilo2-1,1/),(/ihi1+1,ihi2+1,2/),QVAR)
 
       ! Local constants
       dtdx = dt/dx
@@ -445,34 +452,6 @@ contains
          end if
       enddo
 
-      ! Deallocate arrays
-      deallocate(pgdnvx,ugdnvx)
-      deallocate(pgdnvxf,ugdnvxf)
-      deallocate(pgdnvtmpx,ugdnvtmpx)
-      deallocate(pgdnvy,ugdnvy)
-      deallocate(pgdnvyf,ugdnvyf)
-      deallocate(pgdnvtmpy,ugdnvtmpy)
-      deallocate(pgdnvz,ugdnvz)
-      deallocate(pgdnvtmpz1,ugdnvtmpz1)
-      deallocate(pgdnvtmpz2,ugdnvtmpz2)
-      deallocate(pgdnvzf,ugdnvzf)
-      deallocate(dqx,dqy,dqz)
-      deallocate(qxm,qxp)
-      deallocate(qmxy,qpxy)
-      deallocate(qmxz,qpxz)
-      deallocate(qym,qyp)
-      deallocate(qmyx,qpyx)
-      deallocate(qmyz,qpyz)
-      deallocate(qzm,qzp)
-      deallocate(qxl,qxr,qyl,qyr,qzl,qzr)
-      deallocate(qmzx,qpzx)
-      deallocate(qmzy,qpzy)
-      deallocate(fx,fy,fz)
-      deallocate(fxy,fxz)
-      deallocate(fyx,fyz)
-      deallocate(fzx,fzy)
-      deallocate(Ip,Im)
-
       end subroutine umeth3d
 
 ! ::: 
@@ -499,9 +478,12 @@ contains
         integer          :: i, j, k
         integer          :: n, nq
         integer          :: iadv, ispec
+        integer          :: np
+        double precision :: rowrho(loq(1):hiq(1)), rowe(loq(1):hiq(1))
+        double precision :: rowT(loq(1):hiq(1)), rowp(loq(1):hiq(1))
+        double precision :: rowY(loq(1):hiq(1),nspec)
 
         ! Load advected quatities, c, into q, assuming they arrived in uin as rho.c
-        !$OMP PARALLEL DO PRIVATE(iadv,n,nq,i,j,k) IF(nadv.gt.1)
         do iadv = 1, nadv
            n = UFA + iadv - 1
            nq = QFA + iadv - 1
@@ -513,10 +495,8 @@ contains
               enddo
            enddo
         enddo
-        !$OMP END PARALLEL DO
       
         ! Load chemical species, c, into q, assuming they arrived in uin as rho.c
-        !$OMP PARALLEL DO PRIVATE(ispec,n,nq,i,j,k) IF(nspec.gt.1)
         do ispec = 1, nspec
            n  = UFS + ispec - 1
            nq = QFS + ispec - 1
@@ -528,9 +508,11 @@ contains
               enddo
            enddo
         enddo
-        !$OMP END PARALLEL DO
 
-        !$OMP PARALLEL DO PRIVATE(i,j,k)
+        ! The EOS is evaluated a row of cells at a time; T from the
+        ! conserved state is the initial guess for the Newton iteration.
+        np = hiq(1)-loq(1)+1
+
         do k       = loq(3),hiq(3)
            do j    = loq(2),hiq(2)
               do i = loq(1),hiq(1)
@@ -548,13 +530,25 @@ contains
                  q(i,j,k,QW) = uin(i,j,k,UMZ)/uin(i,j,k,URHO)
                  q(i,j,k,QREINT ) = uin(i,j,k,UEINT)
 
-                 call eos_get_TP(q(i,j,k,QTEMP), q(i,j,k,QPRES), &
-                      q(i,j,k,QRHO), q(i,j,k,QREINT)/q(i,j,k,QRHO), q(i,j,k,QFS:))
+                 rowrho(i) = q(i,j,k,QRHO)
+                 rowe(i) = q(i,j,k,QREINT)/q(i,j,k,QRHO)
+                 rowT(i) = uin(i,j,k,UTEMP)
+              enddo
+
+              do n = 1, nspec
+                 do i = loq(1),hiq(1)
+                    rowY(i,n) = q(i,j,k,QFS+n-1)
+                 enddo
+              enddo
 
+              call eos_get_TP_vec(np, rowT, rowp, rowrho, rowe, rowY)
+
+              do i = loq(1),hiq(1)
+                 q(i,j,k,QTEMP) = rowT(i)
+                 q(i,j,k,QPRES) = rowp(i)
               enddo
            enddo
         enddo
-        !$OMP END PARALLEL DO
       
       end subroutine ctoprim
 
@@ -588,7 +582,6 @@ contains
       double precision :: e, p
       double precision :: courx, coury, courz, courmx, courmy, courmz, dtdx, dtdy, dtdz
 
-      !$OMP PARALLEL DO PRIVATE(i,j,k,e,p)
       do k       = lo_work(3), hi_work(3)
          do j    = lo_work(2), hi_work(2)
             do i = lo_work(1), hi_work(1)
@@ -601,7 +594,6 @@ contains
             end do
          end do
       end do
-      !$OMP END PARALLEL DO
 
       ! Compute running max of Courant number over grids
       courmx = courno
@@ -610,7 +602,6 @@ contains
       dtdx = dt/dx
       dtdy = dt/dy
       dtdz = dt/dz
-      !$OMP PARALLEL DO PRIVATE(i,j,k,courx,coury,courz) REDUCTION(max:courmx,courmy,courmz)
       do k       = lo(3),hi(3)
          do j    = lo(2),hi(2)
             do i = lo(1),hi(1)
@@ -653,7 +644,6 @@ contains
             enddo
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
       courno = max( courmx, courmy, courmz )
 
@@ -686,7 +676,6 @@ contains
       integer          :: iadv, ispec
       double precision :: rhoinV
 
-      !$OMP PARALLEL DO PRIVATE(i,j,k,ispec,iadv, rhoInv)
       do k       = src_l3, src_h3
          do j    = src_l2, src_h2
             do i = src_l1, src_h1
@@ -719,7 +708,6 @@ contains
             enddo
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
     end subroutine srctosrcQ
 
@@ -737,7 +725,7 @@ contains
                       area2,area2_l1,area2_l2,area2_l3,area2_h1,area2_h2,area2_h3, &
                       area3,area3_l1,area3_l2,area3_l3,area3_h1,area3_h2,area3_h3, &
                       vol,vol_l1,vol_l2,vol_l3,vol_h1,vol_h2,vol_h3, &
-                      div,pdivu,lo,hi,dx,dy,dz,dt)
+                      div,pdivu,lo,hi,ulo,uhi,dx,dy,dz,dt)
 
       use meth_params_module, only : difmag, NVAR, URHO, UMX, UMY, UMZ, &
            UEDEN, UEINT, UTEMP, normalize_species
@@ -745,7 +733,7 @@ contains
 
       implicit none
 
-      integer,intent(in):: lo(3), hi(3)
+      integer,intent(in):: lo(3), hi(3), ulo(3), uhi(3)
       integer,intent(in):: uin_l1,uin_l2,uin_l3,uin_h1,uin_h2,uin_h3
       integer,intent(in)::  uout_l1, uout_l2, uout_l3, uout_h1, uout_h2, uout_h3
       integer,intent(in)::   src_l1,  src_l2,  src_l3,  src_h1,  src_h2,  src_h3 
@@ -786,8 +774,6 @@ contains
 
          else
 
-            !$OMP PARALLEL PRIVATE(i,j,k,div1)
-            !$OMP DO
             do k       = lo(3),hi(3)
                do j    = lo(2),hi(2)
                   do i = lo(1),hi(1)+1
@@ -798,8 +784,6 @@ contains
                   enddo
                enddo
             enddo
-            !$OMP END DO NOWAIT
-            !$OMP DO
             do k       = lo(3),hi(3)
                do j    = lo(2),hi(2)+1
                   do i = lo(1),hi(1)
@@ -810,8 +794,6 @@ contains
                   enddo
                enddo
             enddo
-            !$OMP END DO NOWAIT
-            !$OMP DO
             do k       = lo(3),hi(3)+1
                do j    = lo(2),hi(2)
                   do i = lo(1),hi(1)
@@ -822,8 +804,6 @@ contains
                   enddo
                enddo
             enddo
-            !$OMP END DO
-            !$OMP END PARALLEL
 
          endif
 
@@ -840,19 +820,18 @@ contains
 
          ! pass temperature through
          if (n .eq. UTEMP) then
-            do k       = lo(3),hi(3)
-               do j    = lo(2),hi(2)
-                  do i = lo(1),hi(1)
+            do k       = ulo(3),uhi(3)
+               do j    = ulo(2),uhi(2)
+                  do i = ulo(1),uhi(1)
                      uout(i,j,k,n) = uin(i,j,k,n)
                   enddo
                enddo
             enddo
          else 
             ! update everything else with fluxes and source terms
-            !$OMP PARALLEL DO PRIVATE(i,j,k)
-            do k       = lo(3),hi(3)
-               do j    = lo(2),hi(2)
-                  do i = lo(1),hi(1)
+            do k       = ulo(3),uhi(3)
+               do j    = ulo(2),uhi(2)
+                  do i = ulo(1),uhi(1)
                      uout(i,j,k,n) = uin(i,j,k,n) &
                           + ( flux1(i,j,k,n) - flux1(i+1,j,k,n) &
                           +   flux2(i,j,k,n) - flux2(i,j+1,k,n) &
@@ -867,16 +846,14 @@ contains
                   enddo
                enddo
             enddo
-            !$OMP END PARALLEL DO
          endif
 
       enddo
 
       ! Add gravitational source terms
-      !$OMP PARALLEL DO PRIVATE(i,j,k,rho,Up,Vp,Wp,SrU,SrV,SrW,SrE)
-      do k       = lo(3),hi(3)
-         do j    = lo(2),hi(2)
-            do i = lo(1),hi(1)
+      do k       = ulo(3),uhi(3)
+         do j    = ulo(2),uhi(2)
+            do i = ulo(1),uhi(1)
 
                rho = uin(i,j,k,URHO)
                Up  = uin(i,j,k,UMX) / rho
@@ -905,7 +882,6 @@ contains
             enddo
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
       end subroutine consup
 
@@ -1047,7 +1023,6 @@ contains
 
       ! NOTE: it is better *not* to protect against small density in this routine
 
-      !$OMP PARALLEL DO PRIVATE(iadv,n,nq,i,j,compn,rr,rrnew,compu) IF(nadv.gt.1)
       do iadv = 1, nadv
          n = UFA + iadv - 1
          nq = QFA + iadv - 1
@@ -1069,9 +1044,7 @@ contains
             enddo
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
-      !$OMP PARALLEL DO PRIVATE(ispec,n,nq,i,j,compsn,rr,rrnew,comps) IF(nspec.gt.1)
       do ispec = 1, nspec
          n  = UFS + ispec - 1
          nq = QFS + ispec - 1
@@ -1093,11 +1066,7 @@ contains
             enddo
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
-      !$OMP PARALLEL DO PRIVATE(i,j,pgp,pgm,ugp,ugm,rrry,rury,rvry,rwry,ekenry,rery,rrly,ruly,rvly,rwly,ekenly,rely) &
-      !$OMP PRIVATE(rrnewry,runewry,rvnewry,rwnewry,renewry,rrnewly,runewly,rvnewly,rwnewly,renewly,dup,pav,du,pnewry) &
-      !$OMP PRIVATE(pnewly,rhoekenry,rhoekenly)
       do j = jlo, jhi 
          do i = ilo, ihi 
 
@@ -1165,7 +1134,6 @@ contains
 
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
       end subroutine transx1
 
@@ -1224,7 +1192,6 @@ contains
       double precision compn, compu, compsn, comps
       double precision pgp, pgm, ugp, ugm, dup, pav, du
 
-      !$OMP PARALLEL DO PRIVATE(iadv,n,nq,i,j,compn,rr,rrnew,compu) IF(nadv.gt.1)
       do iadv = 1, nadv
          n = UFA + iadv - 1
          nq = QFA + iadv - 1
@@ -1248,9 +1215,7 @@ contains
              enddo
           enddo
        enddo
-       !$OMP END PARALLEL DO
 
-       !$OMP PARALLEL DO PRIVATE(ispec,n,nq,i,j,compsn,rr,rrnew,comps) IF(nspec.gt.1)
        do ispec = 1, nspec
           n  = UFS + ispec - 1
           nq = QFS + ispec - 1
@@ -1274,11 +1239,7 @@ contains
              enddo
           enddo
        enddo
-       !$OMP END PARALLEL DO
 
-       !$OMP PARALLEL DO PRIVATE(i,j,pgp,pgm,ugp,ugm,rrrz,rurz,rvrz,rwrz,ekenrz,rerz,rrlz,rulz,rvlz,rwlz,ekenlz) &
-       !$OMP PRIVATE(relz,rrnewrz,runewrz,rvnewrz,rwnewrz,renewrz,rrnewlz,runewlz,rvnewlz,rwnewlz,renewlz,dup,pav) &
-       !$OMP PRIVATE(du,pnewrz,pnewlz,rhoekenrz,rhoekenlz)
        do j = jlo, jhi 
           do i = ilo, ihi 
 
@@ -1352,7 +1313,6 @@ contains
 
           enddo
        enddo
-       !$OMP END PARALLEL DO
 
       end subroutine transx2
 
@@ -1410,7 +1370,6 @@ contains
       double precision rhoekenrx, rhoekenlx
       double precision pgp, pgm, ugp, ugm, dup, pav, du
 
-      !$OMP PARALLEL DO PRIVATE(iadv,n,nq,i,j,compn,rr,rrnew,compu) IF(nadv.gt.1)
       do iadv = 1, nadv
          n = UFA + iadv - 1
          nq = QFA + iadv - 1
@@ -1433,9 +1392,7 @@ contains
             enddo
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
-      !$OMP PARALLEL DO PRIVATE(ispec,n,nq,i,j,compsn,rr,rrnew,comps) IF(nspec.gt.1)
       do ispec = 1, nspec 
          n  = UFS + ispec - 1
          nq = QFS + ispec - 1
@@ -1458,11 +1415,7 @@ contains
             enddo
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
-      !$OMP PARALLEL DO PRIVATE(i,j,pgp,pgm,ugp,ugm,rrrx,rurx,rvrx,rwrx,ekenrx,rerx,rrlx,rulx,rvlx,rwlx,ekenlx,relx) &
-      !$OMP PRIVATE(rrnewrx,runewrx,rvnewrx,rwnewrx,renewrx,rrnewlx,runewlx,rvnewlx,rwnewlx,renewlx,dup,pav,du,pnewrx) &
-      !$OMP PRIVATE(pnewlx,rhoekenrx,rhoekenlx)
       do j = jlo, jhi
          do i = ilo, ihi
 
@@ -1532,7 +1485,6 @@ contains
 
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
       end subroutine transy1
 
@@ -1590,7 +1542,6 @@ contains
       double precision rhoekenrz, rhoekenlz
       double precision pgp, pgm, ugp, ugm, dup, pav, du
 
-      !$OMP PARALLEL DO PRIVATE(iadv,n,nq,i,j,compn,rr,rrnew,compu) IF(nadv.gt.1)
       do iadv = 1, nadv
          n  = UFA + iadv - 1
          nq = QFA + iadv - 1
@@ -1615,9 +1566,7 @@ contains
             enddo
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
-      !$OMP PARALLEL DO PRIVATE(ispec,n,nq,i,j,compsn,rr,rrnew,comps) IF(nspec.gt.1)
       do ispec = 1, nspec 
          n  = UFS + ispec - 1
          nq = QFS + ispec - 1
@@ -1642,11 +1591,7 @@ contains
             enddo
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
-      !$OMP PARALLEL DO PRIVATE(i,j,pgp,pgm,ugp,ugm,rrrz,rurz,rvrz,rwrz,ekenrz,rerz,rrlz,rulz,rvlz,rwlz,ekenlz,relz) &
-      !$OMP PRIVATE(rrnewrz,runewrz,rvnewrz,rwnewrz,renewrz,rrnewlz,runewlz,rvnewlz,rwnewlz,renewlz,dup,pav,du,pnewrz) &
-      !$OMP PRIVATE(pnewlz,rhoekenrz,rhoekenlz)
       do j = jlo, jhi
          do i = ilo, ihi
 
@@ -1722,7 +1667,6 @@ contains
 
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
       end subroutine transy2
 
@@ -1785,7 +1729,6 @@ contains
       double precision rhoekenrx, rhoekenry, rhoekenlx, rhoekenly
       double precision pgp, pgm, ugp, ugm, dup, pav, du
 
-      !$OMP PARALLEL DO PRIVATE(iadv,n,nq,i,j,compn,rr,rrnew,compu) IF(nadv.gt.1)
       do iadv = 1, nadv
           n = UFA + iadv - 1
           nq = QFA + iadv - 1
@@ -1818,9 +1761,7 @@ contains
               enddo
           enddo
       enddo
-      !$OMP END PARALLEL DO
 
-      !$OMP PARALLEL DO PRIVATE(ispec,n,nq,i,j,compsn,rr,rrnew,comps) IF(nspec.gt.1)
       do ispec = 1, nspec 
           n = UFS + ispec - 1
           nq = QFS + ispec  - 1
@@ -1853,13 +1794,7 @@ contains
               enddo
           enddo
       enddo
-      !$OMP END PARALLEL DO
 
-      !$OMP PARALLEL DO PRIVATE(i,j,pgp,pgm,ugp,ugm,rrrx,rurx,rvrx,rwrx,ekenrx,rerx,rrry,rury) &
-      !$OMP PRIVATE(rvry,rwry,ekenry,rery,rrlx,rulx,rvlx,rwlx,ekenlx,relx,rrly,ruly,rvly,rwly,ekenly)&
-      !$OMP PRIVATE(rely,rrnewrx,runewrx,rvnewrx,rwnewrx,renewrx,rrnewry,runewry,rvnewry,rwnewry)&
-      !$OMP PRIVATE(renewry,rrnewlx,runewlx,rvnewlx,rwnewlx,renewlx,rrnewly,runewly,rvnewly,rwnewly)&
-      !$OMP PRIVATE(renewly,dup,pav,du,pnewrx,pnewlx,pnewry,pnewly,rhoekenrx,rhoekenry,rhoekenlx,rhoekenly)
       do j = jlo, jhi 
           do i = ilo, ihi 
 
@@ -1981,7 +1916,6 @@ contains
 
           enddo
       enddo
-      !$OMP END PARALLEL DO
 
       end subroutine transz
 
@@ -2044,7 +1978,6 @@ contains
       double precision pgypm, pgymm, ugypm, ugymm, duypm, pyavm, duym, pynewm
       double precision compr, compl, compnr, compnl
 
-      !$OMP PARALLEL DO PRIVATE(iadv,n,nq,i,j,rrr,rrl,compr,compl,rrnewr,rrnewl,compnr,compnl) IF(nadv.gt.1)
       do iadv = 1, nadv
          n = UFA + iadv - 1
          nq = QFA + iadv - 1
@@ -2074,9 +2007,7 @@ contains
             enddo
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
-      !$OMP PARALLEL DO PRIVATE(ispec,n,nq,i,j,rrr,rrl,compr,compl,rrnewr,rrnewl,compnr,compnl) IF(nspec.gt.1)
       do ispec = 1, nspec
          n = UFS + ispec - 1
          nq = QFS + ispec - 1
@@ -2106,13 +2037,7 @@ contains
             enddo
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
-      !$OMP PARALLEL DO PRIVATE(i,j,pgxp,pgxm,ugxp,ugxm,pgyp,pgym,ugyp,ugym,pgxpm,pgxmm,ugxpm)&
-      !$OMP PRIVATE(ugxmm,pgypm,pgymm,ugypm,ugymm,rrr,rur,rvr,rwr,ekenr,rer,rrl,rul,rvl,rwl,ekenl,rel)&
-      !$OMP PRIVATE(rrnewr,runewr,rvnewr,rwnewr,renewr,rrnewl,runewl,rvnewl,rwnewl,renewl,duxp,pxav)&
-      !$OMP PRIVATE(dux,pxnew,duxpm,pxavm,duxm,pxnewm,duyp,pyav,duy,pynew,duypm,pyavm,duym,pynewm)&
-      !$OMP PRIVATE(pnewr,pnewl,rhoekenr,rhoekenl)
       do j = jlo, jhi 
          do i = ilo, ihi 
 
@@ -2222,7 +2147,6 @@ contains
 
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
       end subroutine transxy
 
@@ -2283,7 +2207,6 @@ contains
       double precision pgzp, pgzm, ugzp, ugzm, duzp, pzav, duz, pznew
       double precision compr, compl, compnr, compnl
 
-      !$OMP PARALLEL DO PRIVATE(iadv,n,nq,i,j,rrr,rrl,compr,compl,rrnewr,rrnewl,compnr,compnl) IF(nadv.gt.1)
       do iadv = 1, nadv
          n = UFA + iadv - 1
          nq = QFA + iadv -1 
@@ -2313,9 +2236,7 @@ contains
               enddo
           enddo
       enddo
-      !$OMP END PARALLEL DO
 
-      !$OMP PARALLEL DO PRIVATE(ispec,n,nq,i,j,rrr,rrl,compr,compl,rrnewr,rrnewl,compnr,compnl) IF(nspec.gt.1)
       do ispec = 1, nspec
          n = UFS + ispec - 1
          nq = QFS + ispec - 1
@@ -2345,12 +2266,7 @@ contains
             enddo
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
-      !$OMP PARALLEL DO PRIVATE(i,j,pgxp,pgxm,ugxp,ugxm,pgzp,pgzm,ugzp,ugzm,rrr,rur,rvr,rwr)&
-      !$OMP PRIVATE(ekenr,rer,rrl,rul,rvl,rwl,ekenl,rel,rrnewr,runewr,rvnewr,rwnewr,renewr,rrnewl)&
-      !$OMP PRIVATE(runewl,rvnewl,rwnewl,renewl,duxp,pxav,dux,pxnew,duzp,pzav,duz,pznew,pnewr,pnewl)&
-      !$OMP PRIVATE(rhoekenr,rhoekenl)
       do j = jlo, jhi 
          do i = ilo, ihi 
 
@@ -2441,7 +2357,6 @@ contains
 
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
       end subroutine transxz
 
@@ -2502,7 +2417,6 @@ contains
       double precision pgzp, pgzm, ugzp, ugzm, duzp, pzav, duz, pznew
       double precision compr, compl, compnr, compnl
 
-      !$OMP PARALLEL DO PRIVATE(iadv,n,nq,i,j,rrr,rrl,compr,compl,rrnewr,rrnewl,compnr,compnl) IF(nadv.gt.1)
       do iadv = 1, nadv
          n = UFA + iadv - 1
          nq = QFA + iadv - 1
@@ -2532,9 +2446,7 @@ contains
             enddo
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
-      !$OMP PARALLEL DO PRIVATE(ispec,n,nq,i,j,rrr,rrl,compr,compl,rrnewr,rrnewl,compnr,compnl) IF(nspec.gt.1)
       do ispec = 1, nspec
          n = UFS + ispec - 1
          nq = QFS + ispec - 1
@@ -2564,12 +2476,7 @@ contains
             enddo
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
-      !$OMP PARALLEL DO PRIVATE(i,j,pgyp,pgym,ugyp,ugym,pgzp,pgzm,ugzp,ugzm,rrr,rur,rvr,rwr)&
-      !$OMP PRIVATE(ekenr,rer,rrl,rul,rvl,rwl,ekenl,rel,rrnewr,runewr,rvnewr,rwnewr,renewr,rrnewl)&
-      !$OMP PRIVATE(runewl,rvnewl,rwnewl,renewl,duyp,pyav,duy,pynew,duzp,pzav,duz,pznew,pnewr,pnewl)&
-      !$OMP PRIVATE(rhoekenr,rhoekenl)
       do j = jlo, jhi 
          do i = ilo, ihi 
 
@@ -2663,7 +2570,6 @@ contains
 
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
       end subroutine transyz
 
@@ -2720,7 +2626,6 @@ contains
       allocate(dp (0:nmax-1,lo(2):hi(2),lo(3):hi(3)))
       allocate(z  (0:nmax-1,lo(2):hi(2),lo(3):hi(3)))
       allocate(chi(0:nmax-1,lo(2):hi(2),lo(3):hi(3)))
-      !$OMP PARALLEL DO PRIVATE(i,j,k,idx,denom,zeta,tst,tmp,ishft)
       do k       = lo(3),hi(3)
          do j    = lo(2),hi(2) 
             do i = lo(1)-1,hi(1)+1
@@ -2753,7 +2658,6 @@ contains
             enddo
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
       deallocate(dp,z,chi)
 
@@ -2761,7 +2665,6 @@ contains
       allocate(dp (lo(1):hi(1),0:nmax-1,lo(3):hi(3)))
       allocate(z  (lo(1):hi(1),0:nmax-1,lo(3):hi(3)))
       allocate(chi(lo(1):hi(1),0:nmax-1,lo(3):hi(3)))
-      !$OMP PARALLEL DO PRIVATE(i,j,k,idx,denom,zeta,tst,tmp,ishft,ftmp)
       do k =    lo(3),hi(3)
          do i = lo(1),hi(1)
             do j = lo(2)-1,hi(2)+1
@@ -2795,7 +2698,6 @@ contains
             enddo
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
       deallocate(dp,z,chi)
 
@@ -2803,7 +2705,6 @@ contains
       allocate(dp (lo(1):hi(1),lo(2):hi(2),0:nmax-1))
       allocate(z  (lo(1):hi(1),lo(2):hi(2),0:nmax-1))
       allocate(chi(lo(1):hi(1),lo(2):hi(2),0:nmax-1))
-      !$OMP PARALLEL DO PRIVATE(i,j,k,idx,denom,zeta,tst,tmp,ishft,ftmp)
       do j =    lo(2),hi(2) 
          do i = lo(1),hi(1)
             do k = lo(3)-1,hi(3)+1
@@ -2837,7 +2738,6 @@ contains
             enddo
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
       deallocate(dp,z,chi)
 
@@ -2864,7 +2764,6 @@ contains
       integer          :: i, j, k
       double precision :: ux, vy, wz
 
-      !$OMP PARALLEL DO PRIVATE(i,j,k,ux,vy,wz)
       do k       = lo(3),hi(3)+1
          do j    = lo(2),hi(2)+1
             do i = lo(1),hi(1)+1
@@ -2892,7 +2791,6 @@ contains
             enddo
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
       end subroutine divu
 
@@ -2925,9 +2823,7 @@ contains
       integer          :: i,j,k,n
       double precision :: sum,fac
 
-      !$OMP PARALLEL PRIVATE(i,j,k,sum,n,fac)
 
-      !$OMP DO
       do k       = lo(3),hi(3)
          do j    = lo(2),hi(2)
             do i = lo(1),hi(1)+1
@@ -2946,9 +2842,7 @@ contains
             end do
          end do
       end do
-      !$OMP END DO NOWAIT
 
-      !$OMP DO
       do k       = lo(3),hi(3)
          do j    = lo(2),hi(2)+1
             do i = lo(1),hi(1)
@@ -2967,9 +2861,7 @@ contains
             end do
          end do
       end do
-      !$OMP END DO NOWAIT
 
-      !$OMP DO
       do k       = lo(3),hi(3)+1
          do j    = lo(2),hi(2)
             do i = lo(1),hi(1)
@@ -2988,9 +2880,7 @@ contains
             end do
          end do
       end do
-      !$OMP END DO
 
-      !$OMP END PARALLEL
 
       end subroutine normalize_species_fluxes
 
@@ -3022,7 +2912,6 @@ contains
 
       allocate(fac(lo(1):hi(1),lo(2):hi(2),lo(3):hi(3)))
 
-      !$OMP PARALLEL DO PRIVATE(i,j,k,ii,jj,kk,min_dens)
       do k       = lo(3),hi(3)
          do j    = lo(2),hi(2)
             do i = lo(1),hi(1)
@@ -3067,9 +2956,7 @@ contains
             enddo
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
-      !$OMP PARALLEL DO PRIVATE(i,j,k,n)
       do k       = lo(3),hi(3)
          do j    = lo(2),hi(2)
             do i = lo(1),hi(1)
@@ -3095,7 +2982,6 @@ contains
             enddo
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
       deallocate(fac)
 
@@ -3120,7 +3006,6 @@ contains
       integer          :: i,j,k,n
       double precision :: fac,sum
 
-      !$OMP PARALLEL DO PRIVATE(i,j,k,sum,n,fac)
       do k = lo(3),hi(3)
       do j = lo(2),hi(2)
          do i = lo(1),hi(1)
@@ -3139,7 +3024,6 @@ contains
          end do
       end do
       end do
-      !$OMP END PARALLEL DO
 
       end subroutine normalize_new_species
 
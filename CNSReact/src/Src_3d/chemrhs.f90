@@ -1,5 +1,6 @@
 subroutine f_rhs(n, t, y, ydot, rpar, ipar)
   use chemistry_module, only : molecular_weight
+  use chemsolv_module, only : Tguess
   implicit none
 
   integer, intent(in) :: n, ipar
@@ -12,7 +13,9 @@ subroutine f_rhs(n, t, y, ydot, rpar, ipar)
   rho = rpar(1)
   ei  = rpar(2)
 
+  Temp = Tguess
   call feeytt(ei, Y, iwrk, rwrk, Temp)
+  Tguess = Temp
 
   call ckwyr(rho, Temp, y, iwrk, rwrk, ydot)
 
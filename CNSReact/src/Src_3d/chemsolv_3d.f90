@@ -2,32 +2,40 @@ module chemsolv_module
 
   implicit none
 
-  logical, save :: stiff = .true.
+  ! temperature guess for feeytt in f_rhs; updated at every RHS evaluation
+  double precision, save :: Tguess
+  !$omp threadprivate(Tguess)
 
   private
 
-  public :: chemsolv
+  public :: chemsolv, Tguess
 
 contains
 
-  subroutine chemsolv(loc, hic, u, u_l1, u_l2, u_l3, u_h1, u_h2, u_h3, dt)
-    
+  ! Constant-volume reaction of the conserved state over dt on loc:hic.
+  ! The number of RHS evaluations VODE needed in each cell is added to cost.
+  subroutine chemsolv(loc, hic, u, u_l1, u_l2, u_l3, u_h1, u_h2, u_h3, &
+       cost, c_l1, c_l2, c_l3, c_h1, c_h2, c_h3, dt)
+
     use meth_params_module, only : NVAR, URHO, UEDEN, UMX, UMY, UMZ, UTEMP, UFS
     use chemistry_module, only : nspec=>nspecies
-    use vode_module, only : itol, rtol, atol, MF_NOSTIFF, MF_NUMERICAL_JAC, &
+    use vode_module, only : itol, rtol, atol, stiff, &
          voderwork, vodeiwork, lvoderwork, lvodeiwork, voderpar, vodeipar
 
     implicit none
 
     integer, intent(in) :: loc(3), hic(3)
     integer, intent(in) :: u_l1, u_l2, u_l3, u_h1, u_h2, u_h3
+    integer, intent(in) :: c_l1, c_l2, c_l3, c_h1, c_h2, c_h3
     double precision, intent(in) :: dt
     double precision, intent(inout) :: u(u_l1:u_h1,u_l2:u_h2,u_l3:u_h3,NVAR)
+    double precision, intent(inout) :: cost(c_l1:c_h1,c_l2:c_h2,c_l3:c_h3)
 
     external jac, f_rhs, dvode
 
-    ! vode stuff
+    ! vode stuff; jac is a stub, so the stiff solver uses a numerical Jacobian
     integer, parameter :: itask=1, iopt=1
+    integer, parameter :: MF_NOSTIFF=10, MF_NUMERICAL_JAC=22
     integer :: MF, istate
 
     integer :: i, j, k, ckiwork
@@ -51,7 +59,8 @@ contains
 
        voderpar(1) = rho
        voderpar(2) = ei
-       
+       Tguess = u(i,j,k,UTEMP)
+
        Y = u(i,j,k,UFS:UFS+nspec-1) * rhoinv
 
        istate = 1
@@ -67,8 +76,11 @@ contains
           call bl_error("ERROR in chemsolv: VODE failed")
        end if
 
-       call feeytt(ei, Y, ckiwork, ckrwork, u(i,j,k,UTEMP))
+       cost(i,j,k) = cost(i,j,k) + dble(vodeiwork(12))
+
+       call feeytt(ei, Y, ckiwork, ckrwork, Tguess)
 
+       u(i,j,k,UTEMP) = Tguess
        u(i,j,k,UFS:UFS+nspec-1) = rho * Y
     end do
     end do
@@ -77,5 +89,3 @@ contains
   end subroutine chemsolv
 
 end module chemsolv_module
-
-
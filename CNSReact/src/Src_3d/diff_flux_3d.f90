@@ -2,12 +2,25 @@ module diff_flux_module
 
   implicit none
 
+  ! number of cells per EGZ call in get_transCoef
+  integer, parameter :: NP=8
+
   private
 
-  public :: diffFlux, fluxtosrc, diffup
+  public :: diffFlux, fluxtosrc, diffup, diff_flux_init
  
 contains
 
+  ! Allocate the threadprivate EGZ work space of every thread.  This has
+  ! to happen outside of any parallel region, before diffFlux runs on
+  ! tiles, and after ChemDriver has called egz_init.
+  subroutine diff_flux_init()
+    use egz_module, only : egzini
+    !$omp parallel
+    call egzini(NP)
+    !$omp end parallel
+  end subroutine diff_flux_init
+
   subroutine diffFlux(lof,hif, &
        q,q_l1,q_l2,q_l3,q_h1,q_h2,q_h3, &
        flux1,flux1_l1,flux1_l2,flux1_l3,flux1_h1,flux1_h2,flux1_h3, &
@@ -67,7 +80,7 @@ contains
 
     use meth_params_module, only : QVAR, QRHO, QU, QV, QW, QREINT, QPRES, QTEMP, QFS
     use chemistry_module, only : nspec=>nspecies, inv_mwt
-    use eglib_module
+    use egz_module, only : egzpar, egze3, egzl1, egzvr1
 
     implicit none
 
@@ -78,35 +91,50 @@ contains
     double precision,intent(out)::lam (loD(1):hiD(1),loD(2):hiD(2),loD(3):hiD(3))
     double precision,intent(out)::  mu(loD(1):hiD(1),loD(2):hiD(2),loD(3):hiD(3))
 
-    integer :: i, j, k, iwrk
-    double precision :: rwrk, rhoDt(nspec), Cpt(nspec), Xt(nspec), Yt(nspec), Tt, Wtm, &
-         lam1, lam2
+    integer :: i, j, k, i0, m, iwrk
+    double precision :: rwrk, Cpt(nspec), Xt(nspec), Yt(nspec)
+    double precision :: TZ(NP), WZ(NP), EZ(NP), L1Z(NP), L2Z(NP), &
+         XZ(NP,nspec), CPZ(NP,nspec), DZ(NP,nspec)
 
-    integer, parameter :: NP=1, ITLS=1, IFLAG=3
     double precision, parameter :: TMIN_TRANS=250.d0
 
-    call eglib_init(nspec, NP, ITLS, IFLAG)
-
     do       k = loD(3), hiD(3)
        do    j = loD(2), hiD(2)
-          do i = loD(1), hiD(1)
+          do i0 = loD(1), hiD(1), NP
+
+             m = min(NP, hiD(1)-i0+1)
+
+             do i = 1, m
+                TZ(i) = max(TMIN_TRANS, q(i0+i-1,j,k,QTEMP))
+                Yt = q(i0+i-1,j,k,QFS:QFS+nspec-1)
+                call ckytx(Yt,iwrk,rwrk,Xt)
+                call ckcpms(TZ(i), iwrk, rwrk, Cpt)
+                call ckmmwy(Yt, iwrk, rwrk, WZ(i))
+                XZ(i,:) = Xt
+                CPZ(i,:) = Cpt
+             end do
 
-             Tt = max(TMIN_TRANS, q(i,j,k,QTEMP))
-             Yt = q(i,j,k,QFS:QFS+nspec-1)
-             call ckytx(Yt,iwrk,rwrk,Xt)
-             call ckcpms(Tt, iwrk, rwrk, Cpt)
-             call ckmmwy(Yt, iwrk, rwrk, Wtm)
+             ! pad a short chunk with copies of its last cell
+             do i = m+1, NP
+                TZ(i) = TZ(m)
+                XZ(i,:) = XZ(m,:)
+                CPZ(i,:) = CPZ(m,:)
+             end do
+
+             call egzpar(TZ, XZ, CPZ)
 
-             call EGSPAR(Tt, Xt, Yt, Cpt, egwork, egiwork)
+             call egze3(TZ, EZ)
 
-             call EGSE3(Tt, Yt, egwork, mu(i,j,k))
+             call egzl1( 1.d0, XZ, L1Z)
+             call egzl1(-1.d0, XZ, L2Z)
 
-             call EGSVR1(Tt, Yt, egwork, rhoDt)
-             rhoD(i,j,k,:) = rhoDt * Wtm * inv_mwt
+             call egzvr1(TZ, DZ)
 
-             call EGSL1( 1.d0, Tt, Xt, egwork, lam1) 
-             call EGSL1(-1.d0, Tt, Xt, egwork, lam2) 
-             lam(i,j,k) = 0.5d0*(lam1+lam2)
+             do i = 1, m
+                mu(i0+i-1,j,k) = EZ(i)
+                lam(i0+i-1,j,k) = 0.5d0*(L1Z(i)+L2Z(i))
+                rhoD(i0+i-1,j,k,:) = DZ(i,:) * WZ(i) * inv_mwt
+             end do
           end do
        end do
     end do
@@ -790,7 +818,6 @@ contains
        if (n .eq. UTEMP) then
           src(:,:,:,n) = 0.d0
        else
-          !$omp parallel do private(i,j,k)
           do k       = lo_work(3), hi_work(3)
              do j    = lo_work(2), hi_work(2)
                 do i = lo_work(1), hi_work(1)
@@ -803,7 +830,6 @@ contains
                 end do
              end do
           end do
-          !$omp end parallel do
        end if
     end do
 
@@ -862,8 +888,6 @@ contains
           
        else
           
-          !$OMP PARALLEL PRIVATE(i,j,k,div1)
-          !$OMP DO
           do k       = lo(3),hi(3)
              do j    = lo(2),hi(2)
                 do i = lo(1),hi(1)+1
@@ -871,8 +895,6 @@ contains
                 enddo
              enddo
           enddo
-          !$OMP END DO NOWAIT
-          !$OMP DO
           do k       = lo(3),hi(3)
              do j    = lo(2),hi(2)+1
                 do i = lo(1),hi(1)
@@ -880,8 +902,6 @@ contains
                 enddo
              enddo
           enddo
-          !$OMP END DO NOWAIT
-          !$OMP DO
           do k       = lo(3),hi(3)+1
              do j    = lo(2),hi(2)
                 do i = lo(1),hi(1)
@@ -889,8 +909,6 @@ contains
                 enddo
              enddo
           enddo
-          !$OMP END DO
-          !$OMP END PARALLEL
           
        endif
        
@@ -908,7 +926,6 @@ contains
        ! pass temperature through
        if (n .ne. UTEMP) then
           ! update everything else with fluxes and source terms
-          !$OMP PARALLEL DO PRIVATE(i,j,k)
           do k       = lo(3),hi(3)
              do j    = lo(2),hi(2)
                 do i = lo(1),hi(1)
@@ -920,7 +937,6 @@ contains
                   enddo
                enddo
             enddo
-            !$OMP END PARALLEL DO
          endif
          
       enddo
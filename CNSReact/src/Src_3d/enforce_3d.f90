@@ -23,7 +23,6 @@ subroutine cns_enforce_nonnegative_species( u, &
 
   double precision, parameter :: eps = -1.0d-16
 
-  !$OMP PARALLEL DO PRIVATE(i,j,k,n,dom_spec,int_dom_spec,any_negative,x)
   do k = lo(3),hi(3)
   do j = lo(2),hi(2)
   do i = lo(1),hi(1)
@@ -103,7 +102,6 @@ subroutine cns_enforce_nonnegative_species( u, &
   enddo
   enddo
   enddo
-  !$OMP END PARALLEL DO
 
 end subroutine cns_enforce_nonnegative_species
 
@@ -129,7 +129,6 @@ contains
        end do
     end do
 
-    !$OMP PARALLEL DO PRIVATE(i,j,s6,sigma)
     do j=ilo2-1,ihi2+1
        do i=ilo1-1,ihi1+1
 
@@ -166,7 +165,6 @@ contains
                (sigma/2.0d0)*(sp(i,j)-sm(i,j)+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
        end do
     end do
-    !$OMP END PARALLEL DO
 
     deallocate(sedge,dsvl)
 
@@ -205,7 +203,6 @@ contains
        end do
     end do
 
-    !$OMP PARALLEL DO PRIVATE(i,j,s6,sigma)
     do j=ilo2-1,ihi2+1
        do i=ilo1-1,ihi1+1
 
@@ -242,7 +239,6 @@ contains
                (sigma/2.0d0)*(sp(i,j)-sm(i,j)+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
        end do
     end do
-    !$OMP END PARALLEL DO
 
     deallocate(dsvl,sedge)
 
@@ -264,7 +260,6 @@ contains
     dsvlm = 0.d0
     dsvlp = 0.d0
 
-    !$OMP PARALLEL DO PRIVATE(i,j,k,dsc,dsl,dsr,s6,sigma)
     do j=ilo2-1,ihi2+1
        do i=ilo1-1,ihi1+1
 
@@ -335,7 +330,6 @@ contains
                (sigma/2.0d0)*(sp(i,j)-sm(i,j)+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
        end do
     end do
-    !$OMP END PARALLEL DO
 
     deallocate(dsvl,dsvlm,dsvlp,sp,sm,sedgez)
 
@@ -433,9 +427,6 @@ contains
     !
     ! This is a new version of the algorithm to eliminate sensitivity to roundoff.
     !
-    !$OMP PARALLEL DO PRIVATE(i,j,alphap,alpham,bigp,bigm,extremum,dafacem) &
-    !$OMP PRIVATE(dafacep,dabarm,dabarp,dafacemin,dabarmin,dachkm,dachkp,D2,D2L) &
-    !$OMP PRIVATE(D2R,D2C,sgn,D2LIM,amax,delam,delap,s6,sigma)
     do j=ilo2-1,ihi2+1
        do i=ilo1-1,ihi1+1
 
@@ -533,7 +524,6 @@ contains
 
        end do
     end do
-    !$OMP END PARALLEL DO
 
     deallocate(sedge,dsvl)
 
@@ -572,8 +562,6 @@ contains
     !
     ! This is a new version of the algorithm to eliminate sensitivity to roundoff.
     !
-    !$OMP PARALLEL DO PRIVATE(i,j,alphap,alpham,bigp,bigm,extremum,dafacem,dafacep,dabarm,dabarp,dafacemin) &
-    !$OMP PRIVATE(dabarmin,dachkm,dachkp,D2,D2L,D2R,D2C,sgn,D2LIM,amax,delam,delap,s6,sigma)
     do j=ilo2-1,ihi2+1
        do i=ilo1-1,ihi1+1
 
@@ -670,7 +658,6 @@ contains
                (sigma/2.0d0)*(sp(i,j)-sm(i,j)+(1.0d0-(2.0d0/3.0d0)*sigma)*s6)
        end do
     end do
-    !$OMP END PARALLEL DO
 
     deallocate(dsvl,sedge)
 
@@ -688,7 +675,6 @@ contains
     ! compute s at z-edges
 
     ! interpolate s to z-edges
-    !$OMP PARALLEL DO PRIVATE(i,j,k,D2,D2L,D2R,sgn,D2LIM)
     do k=k3d-1,k3d+2
        do j=ilo2-1,ihi2+1
           do i=ilo1-1,ihi1+1
@@ -708,15 +694,12 @@ contains
           end do
        end do
     end do
-    !$OMP END PARALLEL DO
     !
     ! Use Colella 2008 limiters.
     !
     ! This is a new version of the algorithm to eliminate sensitivity to roundoff.
     !
     k = k3d
-    !$OMP PARALLEL DO PRIVATE(i,j,alphap,alpham,bigp,bigm,extremum,dafacem,dafacep,dabarm,dabarp,dafacemin) &
-    !$OMP PRIVATE(dabarmin,dachkm,dachkp,D2,D2L,D2R,D2C,sgn,D2LIM,amax,delam,delap,s6,sigma)
     do j=ilo2-1,ihi2+1
        do i=ilo1-1,ihi1+1
 
@@ -814,7 +797,6 @@ contains
 
        end do
     end do
-    !$OMP END PARALLEL DO
 
     deallocate(dsvl,dsvlm,dsvlp,sp,sm,sedgez)
 
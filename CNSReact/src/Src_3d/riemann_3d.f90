@@ -53,9 +53,6 @@ contains
       double precision sgnm, spin, spout, ushock, frac
       double precision wsmall, csmall,qavg
 
-      !$OMP PARALLEL DO PRIVATE(i,j,rl,ul,v1l,v2l,pl,rel,rr,ur,v1r,v2r,pr,rer,csmall,wsmall,wl,wr,pstar,ustar,ro,uo) &
-      !$OMP PRIVATE(po,reo,gamco,co,entho,rstar,estar,cstar,sgnm,spout,spin,ushock,scr,frac,v1gdnv,v2gdnv,rgdnv,regdnv) &
-      !$OMP PRIVATE(rhoetot,iadv,n,nq,qavg,ispec)
       do j = jlo, jhi
          do i = ilo, ihi
 
@@ -242,7 +239,6 @@ contains
 
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
       end subroutine riemannus
 
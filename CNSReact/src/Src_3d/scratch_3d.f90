@@ -0,0 +1,76 @@
+module scratch_module
+
+  ! Per-thread scratch space for the tiled hydro kernels.  Each arena is a
+  ! flat buffer that only grows, so after the first few tiles no memory is
+  ! allocated.  A kernel reserves the total it needs with scratch_begin
+  ! and then carves arrays with the bounds it wants out of it.  Arrays
+  ! carved from an arena stay valid until the next scratch_begin on it.
+
+  implicit none
+
+  integer, parameter :: SCRATCH_UMDRV = 1, SCRATCH_UMETH = 2
+  integer, parameter :: NARENA = 2
+
+  type arena_t
+     double precision, pointer, contiguous :: buf(:) => null()
+     integer :: top = 0
+  end type arena_t
+
+  type(arena_t), target, save :: arenas(NARENA)
+  !$omp threadprivate(arenas)
+
+  private
+
+  public :: SCRATCH_UMDRV, SCRATCH_UMETH, scratch_begin, scratch_3d, scratch_4d, &
+       scratch_6d
+
+contains
+
+  subroutine scratch_begin(ia, n)
+    integer, intent(in) :: ia, n
+    if (associated(arenas(ia)%buf)) then
+       if (size(arenas(ia)%buf) < n) then
+          deallocate(arenas(ia)%buf)
+          allocate(arenas(ia)%buf(n))
+       end if
+    else
+       allocate(arenas(ia)%buf(n))
+    end if
+    arenas(ia)%top = 0
+  end subroutine scratch_begin
+
+  function scratch_3d(ia, lo, hi) result(p)
+    integer, intent(in) :: ia, lo(3), hi(3)
+    double precision, pointer, contiguous :: p(:,:,:)
+    integer :: n, t
+    n = product(hi-lo+1)
+    t = arenas(ia)%top
+    if (t+n > size(arenas(ia)%buf)) call bl_error("scratch_3d: arena too small")
+    p(lo(1):hi(1),lo(2):hi(2),lo(3):hi(3)) => arenas(ia)%buf(t+1:t+n)
+    arenas(ia)%top = t+n
+  end function scratch_3d
+
+  function scratch_4d(ia, lo, hi, nc) result(p)
+    integer, intent(in) :: ia, lo(3), hi(3), nc
+    double precision, pointer, contiguous :: p(:,:,:,:)
+    integer :: n, t
+    n = product(hi-lo+1)*nc
+    t = arenas(ia)%top
+    if (t+n > size(arenas(ia)%buf)) call bl_error("scratch_4d: arena too small")
+    p(lo(1):hi(1),lo(2):hi(2),lo(3):hi(3),1:nc) => arenas(ia)%buf(t+1:t+n)
+    arenas(ia)%top = t+n
+  end function scratch_4d
+
+  ! (x, y, slab, dim, characteristic, variable) layout of the PPM Ip/Im
+  function scratch_6d(ia, lo, hi, nc) result(p)
+    integer, intent(in) :: ia, lo(3), hi(3), nc
+    double precision, pointer, contiguous :: p(:,:,:,:,:,:)
+    integer :: n, t
+    n = product(hi-lo+1)*9*nc
+    t = arenas(ia)%top
+    if (t+n > size(arenas(ia)%buf)) call bl_error("scratch_6d: arena too small")
+    p(lo(1):hi(1),lo(2):hi(2),lo(3):hi(3),1:3,1:3,1:nc) => arenas(ia)%buf(t+1:t+n)
+    arenas(ia)%top = t+n
+  end function scratch_6d
+
+end module scratch_module
@@ -68,9 +68,6 @@ contains
       !!!!!!!!!!!!!!!
       
       ! Compute left and right traced states
-      !$OMP PARALLEL DO PRIVATE(i,j,cc,csq,rho,u,v,w,p,rhoe,enth,drho,du,dv,dw,dp,drhoe,alpham,alphap,alpha0r,alpha0e) &
-      !$OMP PRIVATE(alpha0v,alpha0w,spminus,spplus,spzero,apright,amright,azrright,azeright,azv1rght,azw1rght,apleft) &
-      !$OMP PRIVATE(amleft,azrleft,azeleft,azv1left,azw1left)
       do j = ilo2-1, ihi2+1
          do i = ilo1-1, ihi1+1
 
@@ -166,9 +163,7 @@ contains
 
          enddo
       enddo
-      !$OMP END PARALLEL do
 
-      !$OMP PARALLEL DO PRIVATE(iadv,n,i,j,u,spzero,acmprght,acmpleft) IF(nadv.gt.1)
       do iadv = 1, nadv
          n = QFA + iadv - 1
 
@@ -200,9 +195,7 @@ contains
 
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
-      !$OMP PARALLEL DO PRIVATE(ispec,n,i,j,u,spzero,ascmprght,ascmpleft) IF(nspec.gt.1)
       do ispec = 1, nspec
          n = QFS + ispec - 1
 
@@ -234,12 +227,7 @@ contains
 
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
-      !$OMP PARALLEL DO PRIVATE(i,j,cc,csq,rho,u,v,w,p,rhoe,enth,drho,du,dv,dw,dp,drhoe,alpham,alphap,alpha0r) &
-      !$OMP PRIVATE(alpha0e,alpha0v,alpha0w,spminus,spplus,spzero,apright,amright,azrright,azeright,azv1rght) &
-      !$OMP PRIVATE(azw1rght,apleft,amleft,azrleft,azeleft,azv1left,azw1left) &
-      !$OMP PRIVATE(alpha0u,azu1rght,azu1left)
       do j = ilo2-1, ihi2+1
          do i = ilo1-1, ihi1+1
 
@@ -335,9 +323,7 @@ contains
 
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
-      !$OMP PARALLEL DO PRIVATE(iadv,n,i,j,v,spzero,acmptop,acmpbot) IF(nadv.gt.1)
       do iadv = 1, nadv
          n = QFA + iadv - 1
 
@@ -369,9 +355,7 @@ contains
 
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
-      !$OMP PARALLEL DO PRIVATE(ispec,n,i,j,v,spzero,ascmptop,ascmpbot) IF(nspec.gt.1)
       do ispec = 1, nspec
          n = QFS + ispec - 1
 
@@ -402,7 +386,6 @@ contains
             enddo
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
     end subroutine tracexy
 
@@ -465,9 +448,6 @@ contains
       ! NON-PPM CODE
       !!!!!!!!!!!!!!!
       
-      !$OMP PARALLEL DO PRIVATE(i,j,cc,csq,rho,u,v,w,p,rhoe,enth,drho,du,dv,dw,dp,drhoe,alpham,alphap,alpha0r,alpha0e) &
-      !$OMP PRIVATE(alpha0u,alpha0v,spminus,spplus,spzero,apright,amright,azrright,azeright,azu1rght,azv1rght,apleft) &
-      !$OMP PRIVATE(amleft,azrleft,azeleft,azu1left,azv1left)
       do j = ilo2-1, ihi2+1
          do i = ilo1-1, ihi1+1
 
@@ -584,9 +564,7 @@ contains
 
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
-      !$OMP PARALLEL DO PRIVATE(iadv,n,i,j,w,acmptop,acmpbot,spzero) IF(nadv.gt.1)
       do iadv = 1, nadv
          n = QFA + iadv - 1
 
@@ -615,9 +593,7 @@ contains
             enddo
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
-      !$OMP PARALLEL DO PRIVATE(ispec,n,i,j,w,ascmptop,ascmpbot,spzero) IF(nspec.gt.1)
       do ispec = 1, nspec
          n = QFS + ispec - 1
 
@@ -646,7 +622,6 @@ contains
             enddo
          enddo
       enddo
-      !$OMP END PARALLEL DO
 
     end subroutine tracez
 
@@ -69,10 +69,6 @@ contains
     !!!!!!!!!!!!!!!
 
     ! Trace to left and right edges using upwind PPM
-    !$OMP PARALLEL DO PRIVATE(i,j,cc,csq,rho,u,v,w,p,rhoe,enth,dum,dvm,dwm,dpm) &
-    !$OMP PRIVATE(drho,du,dv,dw,dp,drhoe,dup,dvp,dwp,dpp,alpham,alphap,alpha0r) &
-    !$OMP PRIVATE(alpha0e,alpha0v,alpha0w,amright,apright,azrright,azeright,azv1rght,azw1rght) &
-    !$OMP PRIVATE(amleft,apleft,azrleft,azeleft,azv1left,azw1left)
     do j = ilo2-1, ihi2+1
        do i = ilo1-1, ihi1+1
 
@@ -220,10 +216,8 @@ contains
 
        end do
     end do
-    !$OMP END PARALLEL DO
 
     ! Now do the passively advected quantities
-    !$OMP PARALLEL DO PRIVATE(iadv,n,i,j,u) IF(nadv.gt.1)
     do iadv = 1, nadv
        n = QFA + iadv - 1
        do j = ilo2-1, ihi2+1
@@ -258,9 +252,7 @@ contains
 
        enddo
     enddo
-    !$OMP END PARALLEL DO
 
-    !$OMP PARALLEL DO PRIVATE(ispec,ns,i,j,u) IF(Nspec.gt.1)
     do ispec = 1, Nspec
        ns = QFS + ispec - 1
 
@@ -296,13 +288,8 @@ contains
 
        enddo
     enddo
-    !$OMP END PARALLEL DO
 
     ! Trace to bottom and top edges using upwind PPM
-    !$OMP PARALLEL DO PRIVATE(i,j,cc,csq,rho,u,v,w,p,rhoe,enth,dum,dvm,dwm,dpm) &
-    !$OMP PRIVATE(drho,du,dv,dw,dp,drhoe,dup,dvp,dwp,dpp,alpham,alphap,alpha0r) &
-    !$OMP PRIVATE(alpha0e,alpha0u,alpha0w,amright,apright,azrright,azeright,azu1rght,azw1rght,amleft) &
-    !$OMP PRIVATE(apleft,azrleft,azeleft,azu1left,azw1left)
     do j = ilo2-1, ihi2+1
        do i = ilo1-1, ihi1+1
 
@@ -450,10 +437,8 @@ contains
 
        end do
     end do
-    !$OMP END PARALLEL DO
 
     ! Now do the passively advected quantities
-    !$OMP PARALLEL DO PRIVATE(iadv,n,i,j,v) IF(nadv.gt.1)
     do iadv = 1, nadv
        n = QFA + iadv - 1
        do i = ilo1-1, ihi1+1
@@ -488,9 +473,7 @@ contains
 
        enddo
     enddo
-    !$OMP END PARALLEL DO
 
-    !$OMP PARALLEL DO PRIVATE(ispec,ns,i,j,v) IF(Nspec.gt.1)
     do ispec = 1, Nspec
        ns = QFS + ispec - 1
        do i = ilo1-1, ihi1+1
@@ -525,7 +508,6 @@ contains
 
        enddo
     enddo
-    !$OMP END PARALLEL DO
 
   end subroutine tracexy_ppm
 
@@ -591,10 +573,6 @@ contains
     !!!!!!!!!!!!!!!
 
     ! Trace to left and right edges using upwind PPM
-    !$OMP PARALLEL DO PRIVATE(i,j,cc,csq,rho,u,v,w,p,rhoe,enth,dum,dvm,dwm,dpm) &
-    !$OMP PRIVATE(drho,du,dv,dw,dp,drhoe,dup,dvp,dwp,dpp,alpham,alphap,alpha0r,alpha0e) &
-    !$OMP PRIVATE(alpha0u,alpha0v,amright,apright,azrright,azeright,azu1rght,azv1rght,amleft,apleft)&
-    !$OMP PRIVATE(azrleft,azeleft,azu1left,azv1left)
     do j = ilo2-1, ihi2+1
        do i = ilo1-1, ihi1+1
 
@@ -751,10 +729,8 @@ contains
 
        end do
     end do
-    !$OMP END PARALLEL DO
 
     ! Now do the passively advected quantities
-    !$OMP PARALLEL DO PRIVATE(iadv,n,i,j,w) IF(nadv.gt.1)
     do iadv = 1, nadv
        n = QFA + iadv - 1
        do j = ilo2-1, ihi2+1
@@ -787,9 +763,7 @@ contains
           enddo
        enddo
     enddo
-    !$OMP END PARALLEL DO
 
-    !$OMP PARALLEL DO PRIVATE(ispec,ns,i,j,w) IF(Nspec.gt.1)
     do ispec = 1, Nspec
        ns = QFS + ispec - 1
        do j = ilo2-1, ihi2+1
@@ -822,7 +796,6 @@ contains
           enddo
        enddo
     enddo
-    !$OMP END PARALLEL DO
 
   end subroutine tracez_ppm
 
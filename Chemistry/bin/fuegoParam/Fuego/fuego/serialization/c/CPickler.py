@@ -99,7 +99,21 @@ class CPickler(CMill):
         self._write('};')
         self._write()
         nReactions = len(mechanism.reaction())
-        self._write('static struct ReactionData R[%d], R_DEF[%d];' % (nReactions, nReactions))
+        self._write(self.line(' R points at the shared parameter set unless the calling thread'))
+        self._write(self.line(' has switched to its own copy with UseThreadReactionData'))
+        self._write('static struct ReactionData R_shared[%d], R_DEF[%d];' % (nReactions, nReactions))
+        self._write('static struct ReactionData R_thread[%d];' % (nReactions))
+        self._write('static struct ReactionData *R = R_shared;')
+        self._write('#ifdef _OPENMP')
+        self._write('#pragma omp threadprivate(R_thread, R)')
+        self._write('#endif')
+        self._write()
+        self._write(self.line(' rate constants cached in productionRate are valid for T_save'))
+        self._write(self.line(' and the current R; changing R resets T_save'))
+        self._write('static double T_save = -1;')
+        self._write('#ifdef _OPENMP')
+        self._write('#pragma omp threadprivate(T_save)')
+        self._write('#endif')
         self._write()
         self._write('struct ReactionData* GetReactionData(int id)')
         self._write('{')
@@ -110,6 +124,7 @@ class CPickler(CMill):
         self._write('abort();')
         self._outdent()
         self._write('};')
+        self._write('T_save = -1; ' + self.line(' the caller may write through the pointer'))
         self._write('return &(R[id]);')
         self._outdent()
         self._write('}')
@@ -128,19 +143,42 @@ class CPickler(CMill):
         self._write('}')
         self._write()
 
+        self._write('void UseThreadReactionData(int own)')
+        self._write('{')
+        self._indent()
+        self._write('if (own) {')
+        self._indent()
+        self._write('if (R != R_thread) {')
+        self._indent()
+        self._write('memcpy(R_thread, R, sizeof(R_thread));')
+        self._write('R = R_thread;')
+        self._outdent()
+        self._write('}')
+        self._outdent()
+        self._write('} else {')
+        self._indent()
+        self._write('R = R_shared;')
+        self._outdent()
+        self._write('}')
+        self._write('T_save = -1;')
+        self._outdent()
+        self._write('}')
+        self._write()
+
         self._write()
 
 
         self._write('void SetReactionData(int id, const struct ReactionData * rhs)')
         self._write('{')
         self._indent()
-        self._write('if (id<0 || id>=175) {')
+        self._write('if (id<0 || id>=%d) {' % (nReactions) )
         self._indent()
         self._write('printf("SetReactionData: Bad reaction id = %d",id);')
         self._write('abort();')
         self._outdent()
         self._write('}')
         self._write('struct ReactionData* r = &(R[id]);')
+        self._write('T_save = -1;')
         self._write()
         self._write('r->fwd_A = rhs->fwd_A;')
         self._write('r->fwd_beta = rhs->fwd_beta;')
@@ -197,9 +235,11 @@ class CPickler(CMill):
         self._ckpc(mechanism)
         self._ckrhox(mechanism)
         self._ckrhoy(mechanism)
+        self._vckrhoy(mechanism)
         self._ckrhoc(mechanism)
         self._ckwt(mechanism)
         self._ckmmwy(mechanism)
+        self._vckmmwy(mechanism)
         self._ckmmwx(mechanism)
         self._ckmmwc(mechanism)
         self._ckytx(mechanism)
@@ -235,13 +275,17 @@ class CPickler(CMill):
 
         self._ckcpbl(mechanism)
         self._ckcpbs(mechanism)
+        self._vckcpbs(mechanism)
         self._ckcvbl(mechanism)
         self._ckcvbs(mechanism)
+        self._vckcvbs(mechanism)
         
         self._ckhbml(mechanism)
         self._ckhbms(mechanism)
+        self._vckhbms(mechanism)
         self._ckubml(mechanism)
         self._ckubms(mechanism)
+        self._vckubms(mechanism)
         self._cksbml(mechanism)
         self._cksbms(mechanism)
         self._ckgbml(mechanism)
@@ -389,6 +433,12 @@ class CPickler(CMill):
             '#define VCKPY VCKPY',
             '#define VCKWYR VCKWYR',
             '#define VCKYTX VCKYTX',
+            '#define VCKCPBS VCKCPBS',
+            '#define VCKCVBS VCKCVBS',
+            '#define VCKHBMS VCKHBMS',
+            '#define VCKUBMS VCKUBMS',
+            '#define VCKRHOY VCKRHOY',
+            '#define VCKMMWY VCKMMWY',
             '#define GET_T_GIVEN_EY GET_T_GIVEN_EY',
             '#elif defined(BL_FORT_USE_LOWERCASE)',
             '#define CKINDX ckindx',
@@ -470,6 +520,12 @@ class CPickler(CMill):
             '#define VCKPY vckpy',
             '#define VCKWYR vckwyr',
             '#define VCKYTX vckytx',
+            '#define VCKCPBS vckcpbs',
+            '#define VCKCVBS vckcvbs',
+            '#define VCKHBMS vckhbms',
+            '#define VCKUBMS vckubms',
+            '#define VCKRHOY vckrhoy',
+            '#define VCKMMWY vckmmwy',
             '#define GET_T_GIVEN_EY get_t_given_ey',
             '#elif defined(BL_FORT_USE_UNDERSCORE)',
             '#define CKINDX ckindx_',
@@ -551,6 +607,12 @@ class CPickler(CMill):
             '#define VCKPY vckpy_',
             '#define VCKWYR vckwyr_',
             '#define VCKYTX vckytx_',
+            '#define VCKCPBS vckcpbs_',
+            '#define VCKCVBS vckcvbs_',
+            '#define VCKHBMS vckhbms_',
+            '#define VCKUBMS vckubms_',
+            '#define VCKRHOY vckrhoy_',
+            '#define VCKMMWY vckmmwy_',
             '#define GET_T_GIVEN_EY get_t_given_ey_',
             '#endif','',
             self.line('function declarations'),
@@ -664,6 +726,12 @@ class CPickler(CMill):
             '            double * restrict y, int * restrict iwrk, double * restrict rwrk,',
             '            double * restrict wdot);',
             'void VCKYTX'+sym+'(int * restrict np, double * restrict  y, int * iwrk, double * restrict  rwrk, double * restrict  x);',
+            'void VCKCPBS'+sym+'(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs);',
+            'void VCKCVBS'+sym+'(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs);',
+            'void VCKHBMS'+sym+'(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms);',
+            'void VCKUBMS'+sym+'(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms);',
+            'void VCKRHOY'+sym+'(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho);',
+            'void VCKMMWY'+sym+'(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm);',
             ]
         return
 
@@ -1862,6 +1930,157 @@ class CPickler(CMill):
 
         return
     
+    def _vckmixthermo(self, name, comment, thermoFunc, outName, scaleRT):
+        species = self.species
+        nSpec = len(species)
+
+        self._write()
+        self._write()
+        self._write(self.line(comment))
+        self._write(self.line('y[n*(*ldy)+i]: species n of point i'))
+        self._write('void %s' % name +sym+'(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict %s)' % outName)
+        self._write('{')
+        self._indent()
+
+        self._write('double tc[5], tmp[%d], result;' % nSpec)
+
+        self._write()
+
+        self._write('for (int i=0; i<(*np); i++) {')
+        self._indent()
+        self._write('tc[0] = 0.0;')
+        self._write('tc[1] = T[i];')
+        self._write('tc[2] = T[i]*T[i];')
+        self._write('tc[3] = T[i]*T[i]*T[i];')
+        self._write('tc[4] = T[i]*T[i]*T[i]*T[i];')
+
+        self._write()
+
+        self._write('%s(tmp, tc);' % thermoFunc)
+
+        self._write()
+
+        self._write('result = 0.0;')
+        self._write('for (int n=0; n<%d; n++) {' % (nSpec))
+        self._indent()
+        self._write('result += tmp[n]*y[n*(*ldy)+i]*imw[n];')
+        self._outdent()
+        self._write('}')
+        if scaleRT:
+            self._write('%s[i] = result * %g * T[i];' % (outName, R*kelvin*mole/erg))
+        else:
+            self._write('%s[i] = result * %g;' % (outName, R*kelvin*mole/erg))
+        self._outdent()
+        self._write('}')
+
+        self._outdent()
+        self._write('}')
+
+        return
+
+    def _vckcpbs(self, mechanism):
+        self._vckmixthermo('VCKCPBS', 'Returns the mean specific heat at CP (Eq. 34)',
+                           'cp_R', 'cpbs', 0)
+        return
+
+    def _vckcvbs(self, mechanism):
+        self._vckmixthermo('VCKCVBS', 'Returns the mean specific heat at CV (Eq. 36)',
+                           'cv_R', 'cvbs', 0)
+        return
+
+    def _vckhbms(self, mechanism):
+        self._vckmixthermo('VCKHBMS', 'Returns mean enthalpy of mixture in mass units',
+                           'speciesEnthalpy', 'hbms', 1)
+        return
+
+    def _vckubms(self, mechanism):
+        self._vckmixthermo('VCKUBMS', 'get mean internal energy in mass units',
+                           'speciesInternalEnergy', 'ubms', 1)
+        return
+
+    def _vckmmwy(self, mechanism):
+        species = self.species
+        nSpec = len(species)
+
+        self._write()
+        self._write()
+        self._write(self.line('given y[species]: mass fractions'))
+        self._write(self.line('returns mean molecular weight (gm/mole)'))
+        self._write(self.line('y[n*(*ldy)+i]: species n of point i'))
+        self._write('void VCKMMWY'+sym+'(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm)')
+        self._write('{')
+        self._indent()
+
+        self._write('for (int i=0; i<(*np); i++) {')
+        self._indent()
+        self._write('wtm[i] = 0.0;')
+        self._outdent()
+        self._write('}')
+        self._write('')
+        self._write('for (int n=0; n<%d; n++) {' % (nSpec))
+        self._indent()
+        self._write('for (int i=0; i<(*np); i++) {')
+        self._indent()
+        self._write('wtm[i] += y[n*(*ldy)+i] * imw[n];')
+        self._outdent()
+        self._write('}')
+        self._outdent()
+        self._write('}')
+        self._write('')
+        self._write('for (int i=0; i<(*np); i++) {')
+        self._indent()
+        self._write('wtm[i] = 1.0 / wtm[i];')
+        self._outdent()
+        self._write('}')
+
+        self._write()
+        self._write('return;')
+        self._outdent()
+        self._write('}')
+
+        return
+
+    def _vckrhoy(self, mechanism):
+        species = self.species
+        nSpec = len(species)
+
+        self._write()
+        self._write()
+        self._write(self.line('Compute rho = P*W(y)/RT'))
+        self._write(self.line('y[n*(*ldy)+i]: species n of point i'))
+        self._write('void VCKRHOY'+sym+'(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho)')
+        self._write('{')
+        self._indent()
+
+        self._write('for (int i=0; i<(*np); i++) {')
+        self._indent()
+        self._write('rho[i] = 0.0;')
+        self._outdent()
+        self._write('}')
+        self._write('')
+        self._write('for (int n=0; n<%d; n++) {' % (nSpec))
+        self._indent()
+        self._write('for (int i=0; i<(*np); i++) {')
+        self._indent()
+        self._write('rho[i] += y[n*(*ldy)+i] * imw[n];')
+        self._outdent()
+        self._write('}')
+        self._outdent()
+        self._write('}')
+        self._write('')
+        self._write('for (int i=0; i<(*np); i++) {')
+        self._indent()
+        self._write('rho[i] = P[i] / (%g * T[i] * rho[i]);' % (R * mole * kelvin / erg) + self.line('rho = P*W/(R*T)'))
+        self._outdent()
+        self._write('}')
+
+        self._write()
+        self._write('return;')
+        self._outdent()
+        self._write('}')
+
+        return
+
     def _ckcpbl(self, mechanism):
         self._write()
         self._write()
@@ -4301,11 +4520,6 @@ class CPickler(CMill):
 
         # OMP stuff
         self._write()
-        self._write('static double T_save = -1;')
-        self._write('#ifdef _OPENMP')
-        self._write('#pragma omp threadprivate(T_save)')
-        self._write('#endif')
-        self._write()
         self._write('static double k_f_save[%d];' % nReactions)
         self._write('#ifdef _OPENMP')
         self._write('#pragma omp threadprivate(k_f_save)')
@@ -4797,12 +5011,12 @@ class CPickler(CMill):
 
             if low:
                 self._write('dlnCorrdT = ln10*(dlogfPrdT + dlogFdT);')
-                self._write('dqdT = Corr * dlnkfdT[%d] * k_f[%d] * phi_f[%d] + dlnCorrdT * q;' % i, i, i)
+                self._write('dqdT = Corr * dlnkfdT[%d] * k_f[%d] * phi_f[%d] + dlnCorrdT * q;' % (i, i, i))
             else:
                 if thirdBody:
-                    self._write('dqdT = alpha * (dlnkfdT[%d] * k_f[%d] * phi_f[%d]);' % i, i)
+                    self._write('dqdT = alpha * (dlnkfdT[%d] * k_f[%d] * phi_f[%d]);' % (i, i, i))
                 else:
-                    self._write('dqdT = (dlnkfdT[%d] * k_f[%d] * phi_f[%d]);' % i, i)
+                    self._write('dqdT = (dlnkfdT[%d] * k_f[%d] * phi_f[%d]);' % (i, i, i))
 
         else:
             self._write('/* rate of progress */')
@@ -4821,7 +5035,7 @@ class CPickler(CMill):
                 self._write('dqdT = Corr * (dlnkfdT[%d]*k_f[%d]*phi_f[%d] - dkrdT[%d]*phi_r[%d]) + dlnCorrdT*q;' % (i, i, i, i, i))
             else:
                 if thirdBody:
-                    self._write('dqdT *= alpha * (dlnkfdT[%d]*k_f[%d]*phi_f[%d] - dkrdT[%d]*phi_r[%d]);' % (i, i, i, i, i))
+                    self._write('dqdT = alpha * (dlnkfdT[%d]*k_f[%d]*phi_f[%d] - dkrdT[%d]*phi_r[%d]);' % (i, i, i, i, i))
                 else:
                     self._write('dqdT = dlnkfdT[%d]*k_f[%d]*phi_f[%d] - dkrdT[%d]*phi_r[%d];' % (i, i, i, i, i))
 
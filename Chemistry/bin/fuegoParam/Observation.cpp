@@ -1,4 +1,6 @@
 #include <fstream>
+#include <cmath>
+#include <limits>
 
 #include <Utility.H>
 #include <ParallelDescriptor.H>
@@ -25,6 +27,54 @@ extern "C" {
 
     *y = ctx.Evolve();
   }
+
+  void observation_function_batch(int num_vals, int num_sets, const Real* pvals, Real* y)
+  {
+    BL_ASSERT(the_obs_ptr);
+    BL_ASSERT(num_vals == the_obs_ptr->NumParameters());
+    the_obs_ptr->EvolveBatch(num_sets,pvals,y);
+  }
+
+  void observation_gradient(int num_vals, const Real* pvals, Real* y, Real* dydp)
+  {
+    // Step as in minpack's fdjac2 with the default epsfcn
+    const Real eps = std::sqrt(std::numeric_limits<Real>::epsilon());
+
+    ObservationQueue queue(num_vals);
+    queue.Push(pvals);
+
+    Array<Real> p(num_vals), h(num_vals);
+    for (int i=0; i<num_vals; ++i) {
+      p[i] = pvals[i];
+    }
+    for (int i=0; i<num_vals; ++i) {
+      h[i] = eps * std::abs(pvals[i]);
+      if (h[i] == 0) h[i] = eps;
+      p[i] = pvals[i] + h[i];
+      queue.Push(p.dataPtr());
+      p[i] = pvals[i];
+    }
+
+    queue.Evaluate();
+
+    *y = queue.Result(0);
+    for (int i=0; i<num_vals; ++i) {
+      dydp[i] = (queue.Result(i+1) - *y) / h[i];
+    }
+  }
+
+  void observation_sensitivity(int num_vals, const Real* pvals, Real* y, Real* dydp)
+  {
+    BL_ASSERT(the_obs_ptr);
+    Observation& ctx = *the_obs_ptr;
+    BL_ASSERT(num_vals == ctx.NumParameters());
+
+    for (int i=0; i<num_vals; ++i) {
+      ctx.Parameter(i) = pvals[i];
+    }
+
+    *y = ctx.EvolveSensitivity(dydp);
+  }
 }
 
 Real
@@ -33,36 +83,104 @@ Observation::Evolve()
   // Evolve the initial state for time interval = dt(s), at pressure Patm (atm)
   // Return final value of evolved state
   Reset();
-  const Box& box = funcCnt.box();
+  Evolve(s_final,funcCnt,I_R);
+  return FinalValue(s_final);
+}
+
+void
+Observation::Evolve(FArrayBox& s_out, FArrayBox& cnt, FArrayBox& ir) const
+{
+  const Box& box = cnt.box();
 
 #ifdef LMC_SDC
-  FArrayBox& rYold = s_init;
-  FArrayBox& rYnew = s_final;
-  FArrayBox& rHold = s_init;
-  FArrayBox& rHnew = s_final;
-  FArrayBox& Told  = s_init;
-  FArrayBox& Tnew  = s_final;
+  const FArrayBox& rYold = s_init;
+  FArrayBox& rYnew = s_out;
+  const FArrayBox& rHold = s_init;
+  FArrayBox& rHnew = s_out;
+  const FArrayBox& Told  = s_init;
+  FArrayBox& Tnew  = s_out;
   FArrayBox* diag = 0;
-  cd->solveTransient_sdc(rYnew,rHnew,Tnew,rYold,rHold,Told,C_0,I_R,
-                         funcCnt,box,sCompY,sCompRH,sCompT,
+  cd->solveTransient_sdc(rYnew,rHnew,Tnew,rYold,rHold,Told,C_0,ir,
+                         cnt,box,sCompY,sCompRH,sCompT,
                          dt,Patm,diag,true);
 #else
-  FArrayBox& Yold = s_init;
-  FArrayBox& Ynew = s_final;
-  FArrayBox& Told = s_init;
-  FArrayBox& Tnew = s_final;
-  cd->solveTransient(Ynew,Tnew,Yold,Told,funcCnt,box,
+  const FArrayBox& Yold = s_init;
+  FArrayBox& Ynew = s_out;
+  const FArrayBox& Told = s_init;
+  FArrayBox& Tnew = s_out;
+  cd->solveTransient(Ynew,Tnew,Yold,Told,cnt,box,
                           sCompY,sCompT,dt,Patm);
 #endif
+}
+
+void
+Observation::EvolveBatch(int num_sets, const Real* pvals, Real* y)
+{
+  // Each thread evolves its sets with a private copy of the mechanism
+  // parameters (ChemDriver::UseThreadParameters) and its own output FABs.
+  // The rest of the integrator's state is already per thread: the VODE and
+  // ChemDriver work commons are threadprivate, and the conp.H commons are
+  // only written when the ChemDriver is built.  The shared parameters are
+  // not touched, so the active parameters need no restoring.
+  const int num_vals = NumParameters();
+  const int nProcs = ParallelDescriptor::NProcs();
+  const int myProc = ParallelDescriptor::MyProc();
+  for (int k=0; k<num_sets; ++k) {
+    y[k] = 0;
+  }
+
+#pragma omp parallel
+  {
+    ChemDriver::UseThreadParameters(true);
+    FArrayBox s_out(s_init.box(),s_init.nComp());
+    FArrayBox cnt(funcCnt.box(),1);
+    FArrayBox ir;
+    s_out.copy(s_init);
+#ifdef LMC_SDC
+    ir.resize(I_R.box(),I_R.nComp());
+    ir.copy(I_R);
+#endif
+
+#pragma omp for schedule(dynamic,1)
+    for (int k=myProc; k<num_sets; k+=nProcs) {
+      for (int i=0; i<num_vals; ++i) {
+        active_params[i] = pvals[k*num_vals + i];
+      }
+      cnt.setVal(0);
+      Evolve(s_out,cnt,ir);
+      y[k] = FinalValue(s_out);
+    }
+
+    ChemDriver::UseThreadParameters(false);
+  }
+
+  // Each y[k] is nonzero on one rank only
+  ParallelDescriptor::ReduceRealSum(y,num_sets);
+}
+
+Real
+Observation::EvolveSensitivity(Real* dydp)
+{
+  const int nSpec = cd->numSpecies();
+  const int nParm = NumParameters();
+
+  Array<Real> Y(Y_init);
+  Real T = T_init;
+  Array<Real> dZdp(nParm*(nSpec+1),0);
+  cd->solveTransientSens(Y.dataPtr(),T,dZdp.dataPtr(),active_params,dt,Patm);
 
-  return FinalValue();
+  // The observation is the final temperature, as in FinalValue
+  for (int i=0; i<nParm; ++i) {
+    dydp[i] = dZdp[i*(nSpec+1) + nSpec];
+  }
+  return T;
 }
 
 Real
-Observation::FinalValue() const
+Observation::FinalValue(const FArrayBox& s) const
 {
   // Return the final temperature of the cell that was evolved
-  return s_final(s_final.box().smallEnd(),sCompT);
+  return s(s.box().smallEnd(),sCompT);
 }
 
 Observation::Observation()
@@ -108,6 +226,12 @@ Observation::Observation()
   dt = dt_DEF; pp.query("dt",dt);
   s_init.resize(bx,fileFAB.nComp()); s_init.copy(fileFAB);
   funcCnt.resize(bx,1);
+
+  Y_init.resize(nSpec);
+  for (int i=0; i<nSpec; ++i) {
+    Y_init[i] = s_init(iv,sCompY+i);
+  }
+  T_init = s_init(iv,sCompT);
   
 #ifdef LMC_SDC
   s_init.mult(1.e3,sCompR,1);
@@ -164,3 +288,46 @@ Observation::Reset()
 {
   funcCnt.setVal(0);
 }
+
+ObservationQueue::ObservationQueue(int _num_vals)
+  : num_vals(_num_vals)
+{}
+
+int
+ObservationQueue::Push(const Real* pvals)
+{
+  const int slot = Size();
+  for (int i=0; i<num_vals; ++i) {
+    pdata.push_back(pvals[i]);
+  }
+  return slot;
+}
+
+void
+ObservationQueue::Evaluate()
+{
+  results.resize(Size());
+  if (Size() > 0) {
+    observation_function_batch(num_vals,Size(),pdata.dataPtr(),results.dataPtr());
+  }
+}
+
+Real
+ObservationQueue::Result(int slot) const
+{
+  BL_ASSERT(slot < results.size());
+  return results[slot];
+}
+
+int
+ObservationQueue::Size() const
+{
+  return (num_vals > 0 ? pdata.size() / num_vals : 0);
+}
+
+void
+ObservationQueue::Clear()
+{
+  pdata.clear();
+  results.clear();
+}
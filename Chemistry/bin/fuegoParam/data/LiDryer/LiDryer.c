@@ -84,6 +84,12 @@
 #define VCKPY VCKPY
 #define VCKWYR VCKWYR
 #define VCKYTX VCKYTX
+#define VCKCPBS VCKCPBS
+#define VCKCVBS VCKCVBS
+#define VCKHBMS VCKHBMS
+#define VCKUBMS VCKUBMS
+#define VCKRHOY VCKRHOY
+#define VCKMMWY VCKMMWY
 #define GET_T_GIVEN_EY GET_T_GIVEN_EY
 #elif defined(BL_FORT_USE_LOWERCASE)
 #define CKINDX ckindx
@@ -165,6 +171,12 @@
 #define VCKPY vckpy
 #define VCKWYR vckwyr
 #define VCKYTX vckytx
+#define VCKCPBS vckcpbs
+#define VCKCVBS vckcvbs
+#define VCKHBMS vckhbms
+#define VCKUBMS vckubms
+#define VCKRHOY vckrhoy
+#define VCKMMWY vckmmwy
 #define GET_T_GIVEN_EY get_t_given_ey
 #elif defined(BL_FORT_USE_UNDERSCORE)
 #define CKINDX ckindx_
@@ -246,6 +258,12 @@
 #define VCKPY vckpy_
 #define VCKWYR vckwyr_
 #define VCKYTX vckytx_
+#define VCKCPBS vckcpbs_
+#define VCKCVBS vckcvbs_
+#define VCKHBMS vckhbms_
+#define VCKUBMS vckubms_
+#define VCKRHOY vckrhoy_
+#define VCKMMWY vckmmwy_
 #define GET_T_GIVEN_EY get_t_given_ey_
 #endif
 
@@ -349,6 +367,12 @@ void VCKWYR(int * restrict np, double * restrict rho, double * restrict T,
             double * restrict y, int * restrict iwrk, double * restrict rwrk,
             double * restrict wdot);
 void VCKYTX(int * restrict np, double * restrict  y, int * iwrk, double * restrict  rwrk, double * restrict  x);
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs);
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs);
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms);
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms);
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho);
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm);
 
 /* Inverse molecular weights */
 static const double imw[9] = {
@@ -372,7 +396,21 @@ struct ReactionData {
     double sri_a, sri_b, sri_c, sri_d, sri_e;
 };
 
-static struct ReactionData R[21], R_DEF[21];
+/* R points at the shared parameter set unless the calling thread */
+/* has switched to its own copy with UseThreadReactionData */
+static struct ReactionData R_shared[21], R_DEF[21];
+static struct ReactionData R_thread[21];
+static struct ReactionData *R = R_shared;
+#ifdef _OPENMP
+#pragma omp threadprivate(R_thread, R)
+#endif
+
+/* rate constants cached in productionRate are valid for T_save */
+/* and the current R; changing R resets T_save */
+static double T_save = -1;
+#ifdef _OPENMP
+#pragma omp threadprivate(T_save)
+#endif
 
 struct ReactionData* GetReactionData(int id)
 {
@@ -380,6 +418,7 @@ struct ReactionData* GetReactionData(int id)
         printf("GetReactionData: Bad reaction id = \%d",id);
         abort();
     };
+    T_save = -1; /* the caller may write through the pointer */
     return &(R[id]);
 }
 
@@ -392,14 +431,28 @@ struct ReactionData* GetDefaultReactionData(int id)
     return &(R_DEF[id]);
 }
 
+void UseThreadReactionData(int own)
+{
+    if (own) {
+        if (R != R_thread) {
+            memcpy(R_thread, R, sizeof(R_thread));
+            R = R_thread;
+        }
+    } else {
+        R = R_shared;
+    }
+    T_save = -1;
+}
+
 
 void SetReactionData(int id, const struct ReactionData * rhs)
 {
-    if (id<0 || id>=175) {
+    if (id<0 || id>=21) {
         printf("SetReactionData: Bad reaction id = %d",id);
         abort();
     }
     struct ReactionData* r = &(R[id]);
+    T_save = -1;
 
     r->fwd_A = rhs->fwd_A;
     r->fwd_beta = rhs->fwd_beta;
@@ -908,6 +961,28 @@ void CKRHOY(double * restrict  P, double * restrict  T, double * restrict  y, in
 }
 
 
+/*Compute rho = P*W(y)/RT */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho)
+{
+    for (int i=0; i<(*np); i++) {
+        rho[i] = 0.0;
+    }
+
+    for (int n=0; n<9; n++) {
+        for (int i=0; i<(*np); i++) {
+            rho[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        rho[i] = P[i] / (8.31451e+07 * T[i] * rho[i]);/*rho = P*W/(R*T) */
+    }
+
+    return;
+}
+
+
 /*Compute rho = P*W(c)/(R*T) */
 void CKRHOC(double * restrict  P, double * restrict  T, double * restrict  c, int * iwrk, double * restrict  rwrk, double * restrict  rho)
 {
@@ -962,6 +1037,29 @@ void CKMMWY(double * restrict y, int * iwrk, double * restrict  rwrk, double * r
 }
 
 
+/*given y[species]: mass fractions */
+/*returns mean molecular weight (gm/mole) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm)
+{
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 0.0;
+    }
+
+    for (int n=0; n<9; n++) {
+        for (int i=0; i<(*np); i++) {
+            wtm[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 1.0 / wtm[i];
+    }
+
+    return;
+}
+
+
 /*given x[species]: mole fractions */
 /*returns mean molecular weight (gm/mole) */
 void CKMMWX(double * restrict x, int * iwrk, double * restrict  rwrk, double * restrict  wtm)
@@ -1554,6 +1652,30 @@ void CKCPBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CP (Eq. 34) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs)
+{
+    double tc[5], tmp[9], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cp_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<9; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cpbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean specific heat at CV (Eq. 35) */
 void CKCVBL(double * restrict T, double * restrict x, int * iwrk, double * restrict  rwrk, double * restrict  cvbl)
 {
@@ -1596,6 +1718,30 @@ void CKCVBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CV (Eq. 36) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs)
+{
+    double tc[5], tmp[9], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cv_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<9; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cvbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean enthalpy of the mixture in molar units */
 void CKHBML(double * restrict T, double * restrict x, int * iwrk, double * restrict  rwrk, double * restrict  hbml)
 {
@@ -1637,6 +1783,30 @@ void CKHBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns mean enthalpy of mixture in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms)
+{
+    double tc[5], tmp[9], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesEnthalpy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<9; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        hbms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mean internal energy in molar units */
 void CKUBML(double * restrict T, double * restrict x, int * iwrk, double * restrict  rwrk, double * restrict  ubml)
 {
@@ -1681,6 +1851,30 @@ void CKUBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*get mean internal energy in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms)
+{
+    double tc[5], tmp[9], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesInternalEnergy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<9; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        ubms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mixture entropy in molar units */
 void CKSBML(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict  rwrk, double * restrict  sbml)
 {
@@ -2927,11 +3121,6 @@ void CKEQXR(double * restrict  rho, double * restrict  T, double * restrict  x,
     /*eqcon[20] *= 1;  */
 }
 
-static double T_save = -1;
-#ifdef _OPENMP
-#pragma omp threadprivate(T_save)
-#endif
-
 static double k_f_save[21];
 #ifdef _OPENMP
 #pragma omp threadprivate(k_f_save)
@@ -4117,7 +4306,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* rate of progress */
     q_nocor = k_f[4]*phi_f[4] - k_r[4]*phi_r[4];
     q = alpha * q_nocor;
-    dqdT *= alpha * (dlnkfdT[4]*k_f[4]*phi_f[4] - dkrdT[4]*phi_r[4]);
+    dqdT = alpha * (dlnkfdT[4]*k_f[4]*phi_f[4] - dkrdT[4]*phi_r[4]);
     /* update wdot */
     wdot[0] -= q; /* H2 */
     wdot[3] += 2 * q; /* H */
@@ -4163,7 +4352,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* rate of progress */
     q_nocor = k_f[5]*phi_f[5] - k_r[5]*phi_r[5];
     q = alpha * q_nocor;
-    dqdT *= alpha * (dlnkfdT[5]*k_f[5]*phi_f[5] - dkrdT[5]*phi_r[5]);
+    dqdT = alpha * (dlnkfdT[5]*k_f[5]*phi_f[5] - dkrdT[5]*phi_r[5]);
     /* update wdot */
     wdot[1] += q; /* O2 */
     wdot[4] -= 2 * q; /* O */
@@ -4213,7 +4402,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* rate of progress */
     q_nocor = k_f[6]*phi_f[6] - k_r[6]*phi_r[6];
     q = alpha * q_nocor;
-    dqdT *= alpha * (dlnkfdT[6]*k_f[6]*phi_f[6] - dkrdT[6]*phi_r[6]);
+    dqdT = alpha * (dlnkfdT[6]*k_f[6]*phi_f[6] - dkrdT[6]*phi_r[6]);
     /* update wdot */
     wdot[3] -= q; /* H */
     wdot[4] -= q; /* O */
@@ -4275,7 +4464,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* rate of progress */
     q_nocor = k_f[7]*phi_f[7] - k_r[7]*phi_r[7];
     q = alpha * q_nocor;
-    dqdT *= alpha * (dlnkfdT[7]*k_f[7]*phi_f[7] - dkrdT[7]*phi_r[7]);
+    dqdT = alpha * (dlnkfdT[7]*k_f[7]*phi_f[7] - dkrdT[7]*phi_r[7]);
     /* update wdot */
     wdot[2] += q; /* H2O */
     wdot[3] -= q; /* H */
@@ -84,6 +84,12 @@
 #define VCKPY VCKPY
 #define VCKWYR VCKWYR
 #define VCKYTX VCKYTX
+#define VCKCPBS VCKCPBS
+#define VCKCVBS VCKCVBS
+#define VCKHBMS VCKHBMS
+#define VCKUBMS VCKUBMS
+#define VCKRHOY VCKRHOY
+#define VCKMMWY VCKMMWY
 #define GET_T_GIVEN_EY GET_T_GIVEN_EY
 #elif defined(BL_FORT_USE_LOWERCASE)
 #define CKINDX ckindx
@@ -165,6 +171,12 @@
 #define VCKPY vckpy
 #define VCKWYR vckwyr
 #define VCKYTX vckytx
+#define VCKCPBS vckcpbs
+#define VCKCVBS vckcvbs
+#define VCKHBMS vckhbms
+#define VCKUBMS vckubms
+#define VCKRHOY vckrhoy
+#define VCKMMWY vckmmwy
 #define GET_T_GIVEN_EY get_t_given_ey
 #elif defined(BL_FORT_USE_UNDERSCORE)
 #define CKINDX ckindx_
@@ -246,6 +258,12 @@
 #define VCKPY vckpy_
 #define VCKWYR vckwyr_
 #define VCKYTX vckytx_
+#define VCKCPBS vckcpbs_
+#define VCKCVBS vckcvbs_
+#define VCKHBMS vckhbms_
+#define VCKUBMS vckubms_
+#define VCKRHOY vckrhoy_
+#define VCKMMWY vckmmwy_
 #define GET_T_GIVEN_EY get_t_given_ey_
 #endif
 
@@ -349,6 +367,12 @@ void VCKWYR(int * restrict np, double * restrict rho, double * restrict T,
             double * restrict y, int * restrict iwrk, double * restrict rwrk,
             double * restrict wdot);
 void VCKYTX(int * restrict np, double * restrict  y, int * iwrk, double * restrict  rwrk, double * restrict  x);
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs);
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs);
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms);
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms);
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho);
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm);
 
 /* Inverse molecular weights */
 static const double imw[39] = {
@@ -402,7 +426,21 @@ struct ReactionData {
     double sri_a, sri_b, sri_c, sri_d, sri_e;
 };
 
-static struct ReactionData R[175], R_DEF[175];
+/* R points at the shared parameter set unless the calling thread */
+/* has switched to its own copy with UseThreadReactionData */
+static struct ReactionData R_shared[175], R_DEF[175];
+static struct ReactionData R_thread[175];
+static struct ReactionData *R = R_shared;
+#ifdef _OPENMP
+#pragma omp threadprivate(R_thread, R)
+#endif
+
+/* rate constants cached in productionRate are valid for T_save */
+/* and the current R; changing R resets T_save */
+static double T_save = -1;
+#ifdef _OPENMP
+#pragma omp threadprivate(T_save)
+#endif
 
 struct ReactionData* GetReactionData(int id)
 {
@@ -410,6 +448,7 @@ struct ReactionData* GetReactionData(int id)
         printf("GetReactionData: Bad reaction id = \%d",id);
         abort();
     };
+    T_save = -1; /* the caller may write through the pointer */
     return &(R[id]);
 }
 
@@ -422,6 +461,19 @@ struct ReactionData* GetDefaultReactionData(int id)
     return &(R_DEF[id]);
 }
 
+void UseThreadReactionData(int own)
+{
+    if (own) {
+        if (R != R_thread) {
+            memcpy(R_thread, R, sizeof(R_thread));
+            R = R_thread;
+        }
+    } else {
+        R = R_shared;
+    }
+    T_save = -1;
+}
+
 
 void SetReactionData(int id, const struct ReactionData * rhs)
 {
@@ -430,6 +482,7 @@ void SetReactionData(int id, const struct ReactionData * rhs)
         abort();
     }
     struct ReactionData* r = &(R[id]);
+    T_save = -1;
 
     r->fwd_A = rhs->fwd_A;
     r->fwd_beta = rhs->fwd_beta;
@@ -2788,6 +2841,28 @@ void CKRHOY(double * restrict  P, double * restrict  T, double * restrict  y, in
 }
 
 
+/*Compute rho = P*W(y)/RT */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho)
+{
+    for (int i=0; i<(*np); i++) {
+        rho[i] = 0.0;
+    }
+
+    for (int n=0; n<39; n++) {
+        for (int i=0; i<(*np); i++) {
+            rho[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        rho[i] = P[i] / (8.31451e+07 * T[i] * rho[i]);/*rho = P*W/(R*T) */
+    }
+
+    return;
+}
+
+
 /*Compute rho = P*W(c)/(R*T) */
 void CKRHOC(double * restrict  P, double * restrict  T, double * restrict  c, int * iwrk, double * restrict  rwrk, double * restrict  rho)
 {
@@ -2872,6 +2947,29 @@ void CKMMWY(double * restrict y, int * iwrk, double * restrict  rwrk, double * r
 }
 
 
+/*given y[species]: mass fractions */
+/*returns mean molecular weight (gm/mole) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm)
+{
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 0.0;
+    }
+
+    for (int n=0; n<39; n++) {
+        for (int i=0; i<(*np); i++) {
+            wtm[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 1.0 / wtm[i];
+    }
+
+    return;
+}
+
+
 /*given x[species]: mole fractions */
 /*returns mean molecular weight (gm/mole) */
 void CKMMWX(double * restrict x, int * iwrk, double * restrict  rwrk, double * restrict  wtm)
@@ -3794,6 +3892,30 @@ void CKCPBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CP (Eq. 34) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs)
+{
+    double tc[5], tmp[39], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cp_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<39; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cpbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean specific heat at CV (Eq. 35) */
 void CKCVBL(double * restrict T, double * restrict x, int * iwrk, double * restrict  rwrk, double * restrict  cvbl)
 {
@@ -3866,6 +3988,30 @@ void CKCVBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CV (Eq. 36) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs)
+{
+    double tc[5], tmp[39], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cv_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<39; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cvbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean enthalpy of the mixture in molar units */
 void CKHBML(double * restrict T, double * restrict x, int * iwrk, double * restrict  rwrk, double * restrict  hbml)
 {
@@ -3907,6 +4053,30 @@ void CKHBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns mean enthalpy of mixture in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms)
+{
+    double tc[5], tmp[39], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesEnthalpy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<39; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        hbms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mean internal energy in molar units */
 void CKUBML(double * restrict T, double * restrict x, int * iwrk, double * restrict  rwrk, double * restrict  ubml)
 {
@@ -3981,6 +4151,30 @@ void CKUBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*get mean internal energy in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms)
+{
+    double tc[5], tmp[39], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesInternalEnergy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<39; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        ubms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mixture entropy in molar units */
 void CKSBML(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict  rwrk, double * restrict  sbml)
 {
@@ -9854,11 +10048,6 @@ void CKEQXR(double * restrict  rho, double * restrict  T, double * restrict  x,
     eqcon[174] *= 1e-06; 
 }
 
-static double T_save = -1;
-#ifdef _OPENMP
-#pragma omp threadprivate(T_save)
-#endif
-
 static double k_f_save[175];
 #ifdef _OPENMP
 #pragma omp threadprivate(k_f_save)
@@ -16669,7 +16858,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* rate of progress */
     q_nocor = k_f[4]*phi_f[4] - k_r[4]*phi_r[4];
     q = alpha * q_nocor;
-    dqdT *= alpha * (dlnkfdT[4]*k_f[4]*phi_f[4] - dkrdT[4]*phi_r[4]);
+    dqdT = alpha * (dlnkfdT[4]*k_f[4]*phi_f[4] - dkrdT[4]*phi_r[4]);
     /* update wdot */
     wdot[0] += 2 * q; /* H */
     wdot[1] -= q; /* H2 */
@@ -16753,7 +16942,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* rate of progress */
     q_nocor = k_f[5]*phi_f[5] - k_r[5]*phi_r[5];
     q = alpha * q_nocor;
-    dqdT *= alpha * (dlnkfdT[5]*k_f[5]*phi_f[5] - dkrdT[5]*phi_r[5]);
+    dqdT = alpha * (dlnkfdT[5]*k_f[5]*phi_f[5] - dkrdT[5]*phi_r[5]);
     /* update wdot */
     wdot[5] -= 2 * q; /* O */
     wdot[19] += q; /* O2 */
@@ -16841,7 +17030,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* rate of progress */
     q_nocor = k_f[6]*phi_f[6] - k_r[6]*phi_r[6];
     q = alpha * q_nocor;
-    dqdT *= alpha * (dlnkfdT[6]*k_f[6]*phi_f[6] - dkrdT[6]*phi_r[6]);
+    dqdT = alpha * (dlnkfdT[6]*k_f[6]*phi_f[6] - dkrdT[6]*phi_r[6]);
     /* update wdot */
     wdot[0] -= q; /* H */
     wdot[5] -= q; /* O */
@@ -16943,7 +17132,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* rate of progress */
     q_nocor = k_f[7]*phi_f[7] - k_r[7]*phi_r[7];
     q = alpha * q_nocor;
-    dqdT *= alpha * (dlnkfdT[7]*k_f[7]*phi_f[7] - dkrdT[7]*phi_r[7]);
+    dqdT = alpha * (dlnkfdT[7]*k_f[7]*phi_f[7] - dkrdT[7]*phi_r[7]);
     /* update wdot */
     wdot[0] -= q; /* H */
     wdot[7] -= q; /* OH */
@@ -17932,7 +18121,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* rate of progress */
     q_nocor = k_f[25]*phi_f[25] - k_r[25]*phi_r[25];
     q = alpha * q_nocor;
-    dqdT *= alpha * (dlnkfdT[25]*k_f[25]*phi_f[25] - dkrdT[25]*phi_r[25]);
+    dqdT = alpha * (dlnkfdT[25]*k_f[25]*phi_f[25] - dkrdT[25]*phi_r[25]);
     /* update wdot */
     wdot[0] += q; /* H */
     wdot[11] += q; /* CO */
@@ -18389,7 +18578,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* rate of progress */
     q_nocor = k_f[35]*phi_f[35] - k_r[35]*phi_r[35];
     q = alpha * q_nocor;
-    dqdT *= alpha * (dlnkfdT[35]*k_f[35]*phi_f[35] - dkrdT[35]*phi_r[35]);
+    dqdT = alpha * (dlnkfdT[35]*k_f[35]*phi_f[35] - dkrdT[35]*phi_r[35]);
     /* update wdot */
     wdot[0] += q; /* H */
     wdot[13] += q; /* HCO */
@@ -18491,7 +18680,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* rate of progress */
     q_nocor = k_f[36]*phi_f[36] - k_r[36]*phi_r[36];
     q = alpha * q_nocor;
-    dqdT *= alpha * (dlnkfdT[36]*k_f[36]*phi_f[36] - dkrdT[36]*phi_r[36]);
+    dqdT = alpha * (dlnkfdT[36]*k_f[36]*phi_f[36] - dkrdT[36]*phi_r[36]);
     /* update wdot */
     wdot[1] += q; /* H2 */
     wdot[11] += q; /* CO */
@@ -19445,7 +19634,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* rate of progress */
     q_nocor = k_f[54]*phi_f[54] - k_r[54]*phi_r[54];
     q = alpha * q_nocor;
-    dqdT *= alpha * (dlnkfdT[54]*k_f[54]*phi_f[54] - dkrdT[54]*phi_r[54]);
+    dqdT = alpha * (dlnkfdT[54]*k_f[54]*phi_f[54] - dkrdT[54]*phi_r[54]);
     /* update wdot */
     wdot[0] += q; /* H */
     wdot[15] += q; /* CH2O */
@@ -19844,7 +20033,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* rate of progress */
     q_nocor = k_f[63]*phi_f[63] - k_r[63]*phi_r[63];
     q = alpha * q_nocor;
-    dqdT *= alpha * (dlnkfdT[63]*k_f[63]*phi_f[63] - dkrdT[63]*phi_r[63]);
+    dqdT = alpha * (dlnkfdT[63]*k_f[63]*phi_f[63] - dkrdT[63]*phi_r[63]);
     /* update wdot */
     wdot[0] += q; /* H */
     wdot[15] += q; /* CH2O */
@@ -22658,7 +22847,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* rate of progress */
     q_nocor = k_f[118]*phi_f[118] - k_r[118]*phi_r[118];
     q = alpha * q_nocor;
-    dqdT *= alpha * (dlnkfdT[118]*k_f[118]*phi_f[118] - dkrdT[118]*phi_r[118]);
+    dqdT = alpha * (dlnkfdT[118]*k_f[118]*phi_f[118] - dkrdT[118]*phi_r[118]);
     /* update wdot */
     wdot[2] += q; /* CH2 */
     wdot[3] -= q; /* CH2(S) */
@@ -24366,7 +24555,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* rate of progress */
     q_nocor = k_f[165]*phi_f[165] - k_r[165]*phi_r[165];
     q = alpha * q_nocor;
-    dqdT *= alpha * (dlnkfdT[165]*k_f[165]*phi_f[165] - dkrdT[165]*phi_r[165]);
+    dqdT = alpha * (dlnkfdT[165]*k_f[165]*phi_f[165] - dkrdT[165]*phi_r[165]);
     /* update wdot */
     wdot[8] += q; /* H2O */
     wdot[11] += q; /* CO */
@@ -24448,7 +24637,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* rate of progress */
     q_nocor = k_f[166]*phi_f[166] - k_r[166]*phi_r[166];
     q = alpha * q_nocor;
-    dqdT *= alpha * (dlnkfdT[166]*k_f[166]*phi_f[166] - dkrdT[166]*phi_r[166]);
+    dqdT = alpha * (dlnkfdT[166]*k_f[166]*phi_f[166] - dkrdT[166]*phi_r[166]);
     /* update wdot */
     wdot[1] += q; /* H2 */
     wdot[22] += q; /* CO2 */
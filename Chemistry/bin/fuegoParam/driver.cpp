@@ -1,5 +1,6 @@
 #include <iostream>
 
+#include <ParallelDescriptor.H>
 #include <Observation.H>
 
 static
@@ -52,6 +53,25 @@ main (int   argc,
   test_observation(&observation_function,cnt,pdata.dataPtr(),&ret);
   std::cout << "Observation (F90): " << ret << std::endl;
 
+  // Value and finite-difference gradient from one batch, spread over the ranks
+  Array<Real> dydp(cnt);
+  observation_gradient(cnt,pdata.dataPtr(),&ret,dydp.dataPtr());
+  if (ParallelDescriptor::IOProcessor()) {
+    std::cout << "Observation (batch): " << ret << '\n';
+    for (int i=0; i<cnt; ++i) {
+      std::cout << "  d/dp[" << i << "] " << ctx.Parameter(i) << ": " << dydp[i] << '\n';
+    }
+  }
+
+  // Value and gradient from one solve with forward sensitivities
+  observation_sensitivity(cnt,pdata.dataPtr(),&ret,dydp.dataPtr());
+  if (ParallelDescriptor::IOProcessor()) {
+    std::cout << "Observation (sensitivity): " << ret << '\n';
+    for (int i=0; i<cnt; ++i) {
+      std::cout << "  d/dp[" << i << "] " << ctx.Parameter(i) << ": " << dydp[i] << '\n';
+    }
+  }
+
   BoxLib::Finalize();
 }
 
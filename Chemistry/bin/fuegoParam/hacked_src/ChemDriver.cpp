@@ -1,5 +1,8 @@
 #include <winstd.H>
 #include <iostream>
+#include <cmath>
+#include <limits>
+#include <algorithm>
 
 #include "ChemDriver.H"
 #include "ChemDriver_F.H"
@@ -57,6 +60,15 @@ extern "C" {
   struct ReactionData* GetReactionData(int id);
   struct ReactionData* GetDefaultReactionData(int id);
   void SetReactionData(int id, const struct ReactionData * rhs);
+  void UseThreadReactionData(int own);
+
+  // Generated mechanism routines, in SI units
+  void productionRate(double* wdot, double* sc, double T);
+  void aJacobian(double* J, double* sc, double T, int consP);
+  void cp_R(double* species, double* tc);
+  void dcvpRdT(double* species, double* tc);
+  void speciesEnthalpy(double* species, double* tc);
+  void molecularWeight(double* wt);
 }
 
 ChemDriver::ChemDriver ()
@@ -204,6 +216,12 @@ ChemDriver::ResetAllParamsToDefault()
   }
 }
 
+void
+ChemDriver::UseThreadParameters(bool own)
+{
+  UseThreadReactionData(own ? 1 : 0);
+}
+
 
 void
 ChemDriver::SetTransport (const ChemDriver::TRANSPORT& tran_in)
@@ -842,6 +860,468 @@ ChemDriver::solveTransient_sdc(FArrayBox&        rhoYnew,
 }
 #endif
 
+namespace
+{
+    //
+    // Constant-pressure adiabatic reactor in SI units, z = (Y_0..Y_{N-1}, T):
+    //
+    //   dY_k/dt = W_k wdot_k / rho,  dT/dt = -sum_k h_k wdot_k / (rho cp),
+    //
+    // the system integrated by conpFY.  The Jacobian follows from the
+    // constant-volume species block of aJacobian by the chain rule through
+    // c_k = rho Y_k / W_k and rho = P / (R T sum_k Y_k/W_k).
+    //
+    class ConpSystem
+    {
+    public:
+        ConpSystem (int nspec, Real Ru, Real P);
+        //
+        // f = dz/dt.
+        //
+        void rhs (const Real* z, Real* f);
+        //
+        // J[j*(N+1)+i] = df_i/dz_j, the layout of aJacobian.
+        //
+        void jac (const Real* z, Real* J);
+
+    private:
+        void state (const Real* z);
+
+        int         N;
+        Real        Ru, P, T, sigma, rho;
+        Array<Real> W, c, wdot, tc, cpR, hRT, dcpR, Ac, Jc;
+    };
+
+    ConpSystem::ConpSystem (int  nspec,
+                            Real _Ru,
+                            Real _P)
+        :
+        N(nspec), Ru(_Ru), P(_P),
+        W(nspec), c(nspec), wdot(nspec), tc(5), cpR(nspec), hRT(nspec),
+        dcpR(nspec), Ac(nspec), Jc((nspec+1)*(nspec+1))
+    {
+        molecularWeight(W.dataPtr());
+        for (int k = 0; k < N; ++k)
+            W[k] *= 1.e-3;
+    }
+
+    void
+    ConpSystem::state (const Real* z)
+    {
+        T     = z[N];
+        sigma = 0;
+        for (int k = 0; k < N; ++k)
+            sigma += z[k] / W[k];
+        rho = P / (Ru * T * sigma);
+        for (int k = 0; k < N; ++k)
+            c[k] = rho * z[k] / W[k];
+
+        tc[0] = std::log(T); tc[1] = T; tc[2] = T*T; tc[3] = T*T*T; tc[4] = T*T*T*T;
+        cp_R(cpR.dataPtr(), tc.dataPtr());
+        speciesEnthalpy(hRT.dataPtr(), tc.dataPtr());
+        productionRate(wdot.dataPtr(), c.dataPtr(), T);
+    }
+
+    void
+    ConpSystem::rhs (const Real* z,
+                     Real*       f)
+    {
+        state(z);
+        Real H = 0, C = 0;
+        for (int k = 0; k < N; ++k)
+        {
+            f[k] = W[k] * wdot[k] / rho;
+            H   += hRT[k] * wdot[k];
+            C   += z[k] * cpR[k] / W[k];
+        }
+        f[N] = -T * H / (rho * C);
+    }
+
+    void
+    ConpSystem::jac (const Real* z,
+                     Real*       J)
+    {
+        state(z);
+        dcvpRdT(dcpR.dataPtr(), tc.dataPtr());
+        aJacobian(Jc.dataPtr(), c.dataPtr(), T, 0);
+
+        const int n = N+1;
+        Real H = 0, C = 0, CT = 0;
+        for (int k = 0; k < N; ++k)
+        {
+            H  += hRT[k] * wdot[k];
+            C  += z[k] * cpR[k] / W[k];
+            CT += z[k] * dcpR[k] / W[k];
+            Ac[k] = 0;
+        }
+        for (int j = 0; j < N; ++j)
+            for (int m = 0; m < N; ++m)
+                Ac[m] += Jc[j*n+m] * c[j];
+        //
+        // dT/dt = -(R T^2 sigma / P) H / C, with H = sum_k (h_k/RT) wdot_k
+        // and C = cp/R.  dwdot/dY_j and dwdot/dT below are at fixed Y.
+        //
+        const Real a = Ru * T * T / P;
+
+        for (int j = 0; j < N; ++j)
+        {
+            Real dH = 0;
+            for (int m = 0; m < N; ++m)
+            {
+                const Real dw = (rho * Jc[j*n+m] - Ac[m] / sigma) / W[j];
+                J[j*n+m] = W[m] / rho * (dw + wdot[m] / (sigma * W[j]));
+                dH += hRT[m] * dw;
+            }
+            J[j*n+N] = -a * (H / W[j] + sigma * dH - sigma * H * cpR[j] / (W[j] * C)) / C;
+        }
+
+        Real dH = 0;
+        for (int m = 0; m < N; ++m)
+        {
+            const Real dw = Jc[N*n+m] - Ac[m] / T;
+            J[N*n+m] = W[m] / rho * (dw + wdot[m] / T);
+            dH += (cpR[m] - hRT[m]) / T * wdot[m] + hRT[m] * dw;
+        }
+        J[N*n+N] = -a * sigma * (2 * H / T + dH - H * CT / C) / C;
+    }
+    //
+    // In-place LU with partial pivoting of the column-major n x n A.
+    //
+    bool
+    lu_factor (int   n,
+               Real* A,
+               int*  piv)
+    {
+        for (int k = 0; k < n; ++k)
+        {
+            int p = k;
+            for (int i = k+1; i < n; ++i)
+                if (std::abs(A[k*n+i]) > std::abs(A[k*n+p]))
+                    p = i;
+            piv[k] = p;
+            if (A[k*n+p] == 0)
+                return false;
+            if (p != k)
+                for (int j = 0; j < n; ++j)
+                    std::swap(A[j*n+k], A[j*n+p]);
+
+            const Real inv = 1 / A[k*n+k];
+            for (int i = k+1; i < n; ++i)
+                A[k*n+i] *= inv;
+            for (int j = k+1; j < n; ++j)
+            {
+                const Real ajk = A[j*n+k];
+                if (ajk != 0)
+                    for (int i = k+1; i < n; ++i)
+                        A[j*n+i] -= A[k*n+i] * ajk;
+            }
+        }
+        return true;
+    }
+
+    void
+    lu_solve (int         n,
+              const Real* A,
+              const int*  piv,
+              Real*       b)
+    {
+        for (int k = 0; k < n; ++k)
+            std::swap(b[k], b[piv[k]]);
+        for (int k = 0; k < n; ++k)
+            for (int i = k+1; i < n; ++i)
+                b[i] -= A[k*n+i] * b[k];
+        for (int k = n-1; k >= 0; --k)
+        {
+            b[k] /= A[k*n+k];
+            for (int i = 0; i < k; ++i)
+                b[i] -= A[k*n+i] * b[k];
+        }
+    }
+    //
+    // M = I - dh J, factored.
+    //
+    void
+    newton_matrix (int         n,
+                   Real        dh,
+                   const Real* J,
+                   Real*       M,
+                   int*        piv)
+    {
+        for (int i = 0; i < n*n; ++i)
+            M[i] = -dh * J[i];
+        for (int i = 0; i < n; ++i)
+            M[i*n+i] += 1;
+        if (!lu_factor(n,M,piv))
+            BoxLib::Abort("ChemDriver::solveTransientSens: singular Newton matrix");
+    }
+
+    Real
+    wrms (int         n,
+          const Real* v,
+          const Real* ewt)
+    {
+        Real sum = 0;
+        for (int i = 0; i < n; ++i)
+            sum += (v[i]/ewt[i]) * (v[i]/ewt[i]);
+        return std::sqrt(sum/n);
+    }
+    //
+    // Simplified Newton for Z = base + dh f(Z), with M = I - dh J factored.
+    //
+    bool
+    stage_solve (ConpSystem& sys,
+                 int         n,
+                 Real*       Z,
+                 const Real* base,
+                 Real        dh,
+                 const Real* M,
+                 const int*  piv,
+                 const Real* ewt,
+                 Real*       f,
+                 Real*       r)
+    {
+        const int  maxiter = 7;
+        const Real tol     = 0.03;
+
+        Real nrm_old = 0;
+        for (int iter = 0; iter < maxiter; ++iter)
+        {
+            sys.rhs(Z,f);
+            for (int i = 0; i < n; ++i)
+                r[i] = base[i] + dh * f[i] - Z[i];
+            lu_solve(n,M,piv,r);
+            for (int i = 0; i < n; ++i)
+                Z[i] += r[i];
+
+            const Real nrm = wrms(n,r,ewt);
+            if (!(nrm == nrm))
+                return false;
+            if (nrm <= tol)
+                return true;
+            if (iter > 0 && nrm > 0.9 * nrm_old)
+                return false;
+            nrm_old = nrm;
+        }
+        return false;
+    }
+    //
+    // FP[ip*n+i] = df_i/dp_ip at z, given K = f(z), by a one-sided difference.
+    //
+    void
+    dfdp (ConpSystem&                          sys,
+          const PArray<ChemDriver::Parameter>& params,
+          int                                  n,
+          const Real*                          z,
+          const Real*                          K,
+          Real*                                FP,
+          Real*                                f)
+    {
+        const Real eps = std::sqrt(std::numeric_limits<Real>::epsilon());
+
+        for (int ip = 0; ip < params.size(); ++ip)
+        {
+            ChemDriver::Parameter p = params[ip];
+            const Real v = p.Value();
+            p = v + (v == 0 ? eps : eps * std::abs(v));
+            const Real dp = p.Value() - v;
+            sys.rhs(z,f);
+            p = v;
+            for (int i = 0; i < n; ++i)
+                FP[ip*n+i] = (f[i] - K[i]) / dp;
+        }
+    }
+}
+
+int
+ChemDriver::solveTransientSens (Real*                    Y,
+                                Real&                    T,
+                                Real*                    dZdp,
+                                const PArray<Parameter>& params,
+                                Real                     dt,
+                                Real                     Patm,
+                                Real                     rtol,
+                                Real                     atol) const
+{
+    //
+    // TR-BDF2 as a three-stage ESDIRK: the trapezoidal rule to t+gamma*h,
+    // then BDF2 to t+h.  It is L-stable and second order, with an embedded
+    // third-order solution for the error estimate.  Both implicit stages
+    // have the Newton matrix M = I - d h J.  Once a stage has converged, J
+    // is evaluated at it; that factorization solves the (linear) stage of
+    // the sensitivities, S_i = S_n + h sum_j a_ij K_j + d h K_i with
+    // K_i = J(z_i) S_i + df/dp(z_i), and is the Newton matrix of the next
+    // stage.  The step size controls the error of the state only.
+    //
+    const int  N        = numSpecies();
+    const int  n        = N+1;
+    const int  nparm    = params.size();
+    const int  maxsteps = 100000;
+    const Real gamma    = 2 - std::sqrt(2.);
+    const Real d        = gamma/2;
+    const Real w        = std::sqrt(2.)/4;
+    const Real e[3]     = { w - (1-w)/3, w - (3*w+1)/3, d - d/3 };
+
+    ConpSystem sys(N, getRuniversal()*1.e-3, Patm*getP1atm_MKS());
+    //
+    // Stage i of a step: value Z[i], derivative K[i], Jacobian J[i] and its
+    // factored Newton matrix M[i], with sensitivity source FP[i] and
+    // derivative SK[i].  Stage 0 is the start of the step.
+    //
+    Array<Real> Z[3], K[3], J[3], M[3], FP[3], SK[3];
+    Array<int>  piv[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        Z[i].resize(n); K[i].resize(n); J[i].resize(n*n); M[i].resize(n*n);
+        FP[i].resize(n*nparm); SK[i].resize(n);
+        piv[i].resize(n);
+    }
+    Array<Real> base(n), guess(n), ewt(n), f(n), r(n), err(n), S(n);
+
+    for (int k = 0; k < N; ++k)
+        Z[0][k] = Y[k];
+    Z[0][N] = T;
+
+    Real h = 1.e-3*dt, hfac = h;
+    sys.rhs(Z[0].dataPtr(),K[0].dataPtr());
+    sys.jac(Z[0].dataPtr(),J[0].dataPtr());
+    newton_matrix(n,d*h,J[0].dataPtr(),M[0].dataPtr(),piv[0].dataPtr());
+    dfdp(sys,params,n,Z[0].dataPtr(),K[0].dataPtr(),FP[0].dataPtr(),f.dataPtr());
+
+    Real t      = 0;
+    int  nsteps = 0;
+    while (t < dt)
+    {
+        if (nsteps >= maxsteps)
+            BoxLib::Abort("ChemDriver::solveTransientSens: too many steps");
+
+        const bool last = (h >= dt - t);
+        if (last)
+            h = dt - t;
+        if (h != hfac)
+        {
+            newton_matrix(n,d*h,J[0].dataPtr(),M[0].dataPtr(),piv[0].dataPtr());
+            hfac = h;
+        }
+
+        for (int i = 0; i < n; ++i)
+            ewt[i] = rtol * std::abs(Z[0][i]) + atol;
+        //
+        // Stage 1 is the trapezoidal rule from an explicit Euler guess, stage
+        // 2 BDF2; each starts Newton with the matrix of the stage before.
+        // Should that fail, J is evaluated at the last iterate and Newton
+        // retried once before the step is cut.
+        //
+        bool ok = true;
+        for (int s = 1; s < 3 && ok; ++s)
+        {
+            for (int i = 0; i < n; ++i)
+            {
+                if (s == 1)
+                {
+                    base[i]  = Z[0][i] + d*h * K[0][i];
+                    guess[i] = Z[0][i] + gamma*h * K[0][i];
+                }
+                else
+                {
+                    base[i]  = Z[0][i] + w*h * (K[0][i] + K[1][i]);
+                    guess[i] = base[i] + d*h * K[1][i];
+                }
+                Z[s][i] = guess[i];
+            }
+            ok = stage_solve(sys,n,Z[s].dataPtr(),base.dataPtr(),d*h,
+                             M[s-1].dataPtr(),piv[s-1].dataPtr(),ewt.dataPtr(),
+                             f.dataPtr(),r.dataPtr());
+            if (!ok)
+            {
+                if (!(wrms(n,Z[s].dataPtr(),ewt.dataPtr()) < std::numeric_limits<Real>::max()))
+                    Z[s] = guess;
+                sys.jac(Z[s].dataPtr(),J[s].dataPtr());
+                newton_matrix(n,d*h,J[s].dataPtr(),M[s].dataPtr(),piv[s].dataPtr());
+                ok = stage_solve(sys,n,Z[s].dataPtr(),base.dataPtr(),d*h,
+                                 M[s].dataPtr(),piv[s].dataPtr(),ewt.dataPtr(),
+                                 f.dataPtr(),r.dataPtr());
+            }
+            if (ok)
+            {
+                sys.rhs(Z[s].dataPtr(),K[s].dataPtr());
+                if (s == 1)
+                {
+                    sys.jac(Z[1].dataPtr(),J[1].dataPtr());
+                    newton_matrix(n,d*h,J[1].dataPtr(),M[1].dataPtr(),piv[1].dataPtr());
+                }
+            }
+        }
+        if (!ok)
+        {
+            h *= 0.25;
+            continue;
+        }
+
+        for (int i = 0; i < n; ++i)
+            err[i] = h * (e[0]*K[0][i] + e[1]*K[1][i] + e[2]*K[2][i]);
+        const Real enorm = std::max(wrms(n,err.dataPtr(),ewt.dataPtr()), 1.e-10);
+        if (enorm > 1)
+        {
+            h *= std::max(0.2, 0.9*std::pow(enorm,-1./3));
+            continue;
+        }
+        //
+        // Accepted: the sensitivity stages.
+        //
+        sys.jac(Z[2].dataPtr(),J[2].dataPtr());
+        newton_matrix(n,d*h,J[2].dataPtr(),M[2].dataPtr(),piv[2].dataPtr());
+        dfdp(sys,params,n,Z[1].dataPtr(),K[1].dataPtr(),FP[1].dataPtr(),f.dataPtr());
+        dfdp(sys,params,n,Z[2].dataPtr(),K[2].dataPtr(),FP[2].dataPtr(),f.dataPtr());
+
+        for (int ip = 0; ip < nparm; ++ip)
+        {
+            Real* Sn = dZdp + ip*n;
+
+            for (int s = 0; s < 3; ++s)
+            {
+                const Real* fp = FP[s].dataPtr() + ip*n;
+                if (s == 0)
+                {
+                    for (int i = 0; i < n; ++i)
+                        S[i] = Sn[i];
+                }
+                else
+                {
+                    const Real a = (s == 1 ? d : w);
+                    for (int i = 0; i < n; ++i)
+                    {
+                        S[i] = Sn[i] + a*h * SK[0][i] + d*h * fp[i];
+                        if (s == 2)
+                            S[i] += w*h * SK[1][i];
+                    }
+                    lu_solve(n,M[s].dataPtr(),piv[s].dataPtr(),S.dataPtr());
+                }
+                for (int i = 0; i < n; ++i)
+                {
+                    SK[s][i] = fp[i];
+                    for (int j = 0; j < n; ++j)
+                        SK[s][i] += J[s][j*n+i] * S[j];
+                }
+            }
+            for (int i = 0; i < n; ++i)
+                Sn[i] = S[i];
+        }
+
+        Z[0].swap(Z[2]); K[0].swap(K[2]); J[0].swap(J[2]);
+        M[0].swap(M[2]); piv[0].swap(piv[2]); FP[0].swap(FP[2]);
+
+        t = (last ? dt : t + h);
+        ++nsteps;
+        h *= std::min(5., 0.9*std::pow(enorm,-1./3));
+    }
+
+    for (int k = 0; k < N; ++k)
+        Y[k] = Z[0][k];
+    T = Z[0][N];
+
+    return nsteps;
+}
+
 void
 ChemDriver::getMixAveragedRhoDiff(FArrayBox&       rhoD,
                                      const FArrayBox& Y,
@@ -0,0 +1,369 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Utility.H"
+#include "ParallelDescriptor.H"
+#include "ChemDriver.H"
+#include "ParmParse.H"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+//
+// Benchmark of ChemDriver::solveTransient over the cells of one pmf FAB.
+// Every combination of bench.dt, bench.Patm, bench.integrators,
+// bench.batch_sizes and bench.threads is timed, and its answer compared
+// with a tight-tolerance reference at the same dt and Patm.  Results are
+// written as JSON for run_bench.sh and bench_compare.py.
+//
+static Real rtol_DEF      = 1.e-10;
+static Real atol_DEF      = 1.e-10;
+static Real ref_rtol_DEF  = 1.e-13;
+static Real ref_atol_DEF  = 1.e-15;
+static int  repeat_DEF    = 3;
+static Real max_err_T_DEF = 1.e-3;
+static Real max_err_Y_DEF = 1.e-6;
+
+static
+void
+print_usage (int,
+             char* argv[])
+{
+   std::cerr << "usage:\n";
+   std::cerr << argv[0] << " pmf_file=<input fab file name> [options] \n";
+   std::cerr << "\tOptions:            bench.name = <label for the JSON output>              [DEFAULT = pmf_file]\n";
+   std::cerr << "\t                      bench.dt = <list of time intervals, in seconds>     [DEFAULT = 1e-5]\n";
+   std::cerr << "\t                    bench.Patm = <list of pressures, in atmospheres>      [DEFAULT = 1]\n";
+   std::cerr << "\t             bench.integrators = <list of bdf, adams>                     [DEFAULT = bdf]\n";
+   std::cerr << "\t             bench.batch_sizes = <list of cells per call, 0->all cells>   [DEFAULT = ncells/(4*max threads)]\n";
+   std::cerr << "\t                 bench.threads = <list of thread counts>                  [DEFAULT = 1 max]\n";
+   std::cerr << "\t                    bench.rtol = <VODE relative tolerance>                [DEFAULT = " << rtol_DEF << "]\n";
+   std::cerr << "\t                    bench.atol = <VODE absolute tolerance>                [DEFAULT = " << atol_DEF << "]\n";
+   std::cerr << "\t                bench.ref_rtol = <reference relative tolerance>           [DEFAULT = " << ref_rtol_DEF << "]\n";
+   std::cerr << "\t                bench.ref_atol = <reference absolute tolerance>           [DEFAULT = " << ref_atol_DEF << "]\n";
+   std::cerr << "\t                  bench.repeat = <timings per run, the fastest is kept>   [DEFAULT = " << repeat_DEF << "]\n";
+   std::cerr << "\t               bench.max_err_T = <threshold on max |T-Tref|, in K>        [DEFAULT = " << max_err_T_DEF << "]\n";
+   std::cerr << "\t               bench.max_err_Y = <threshold on max |Y-Yref|>              [DEFAULT = " << max_err_Y_DEF << "]\n";
+   std::cerr << "\t       bench.min_cells_per_sec = <threshold on throughput, 0->none>      [DEFAULT = 0]\n";
+   std::cerr << "\t                 bench.outfile = <JSON output file name>                  [DEFAULT = \"bench.json\"]\n";
+   exit(1);
+}
+
+struct BenchResult
+{
+    Real        dt, Patm;
+    std::string integrator;
+    int         batch_size, threads;
+    Real        seconds, rhs, max_rhs, jac, err_T, err_Y;
+    int         failed;
+    bool        pass;
+};
+
+//
+// Solves all cells of the packed state S (1D, cells along the first
+// direction) from t=0 to dt, batch_size cells per call to solveTransient.
+// Returns the number of calls that reported a failure.
+//
+static
+int
+solve_batches (const ChemDriver& cd,
+               FArrayBox&        S,
+               const FArrayBox&  S0,
+               FArrayBox&        funcCnt,
+               int               sCompY,
+               int               sCompT,
+               Real              dt,
+               Real              Patm,
+               bool              use_stiff_solver,
+               int               batch_size,
+               int               nthreads)
+{
+    const int ncells = S.box().numPts();
+    const int bsize  = (batch_size > 0) ? std::min(batch_size,ncells) : ncells;
+    const int nbatch = (ncells + bsize - 1) / bsize;
+
+    S.copy(S0);
+    funcCnt.setVal(0);
+
+    int nfailed = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic,1) num_threads(nthreads) reduction(+:nfailed)
+#endif
+    for (int b = 0; b < nbatch; ++b)
+    {
+        const int lo = b*bsize;
+        const int hi = std::min(ncells, lo+bsize) - 1;
+        const Box bx(IntVect(D_DECL(lo,0,0)), IntVect(D_DECL(hi,0,0)));
+
+        if (!cd.solveTransient(S,S,S0,S0,funcCnt,bx,sCompY,sCompT,dt,Patm,0,use_stiff_solver))
+            nfailed++;
+    }
+
+    return nfailed;
+}
+
+static
+void
+write_json (std::ostream&                   os,
+            const std::string&              name,
+            const std::string&              pmf_file,
+            const ChemDriver&               cd,
+            int                             ncells,
+            Real                            rtol,
+            Real                            atol,
+            Real                            ref_rtol,
+            Real                            ref_atol,
+            int                             repeat,
+            Real                            max_err_T,
+            Real                            max_err_Y,
+            Real                            min_cells_per_sec,
+            int                             nref_failed,
+            const std::vector<BenchResult>& runs,
+            bool                            pass)
+{
+    os << std::setprecision(8);
+    os << "{\n";
+    os << "  \"mechanism\": \"" << name << "\",\n";
+    os << "  \"pmf_file\": \"" << pmf_file << "\",\n";
+    os << "  \"nspecies\": " << cd.numSpecies() << ",\n";
+    os << "  \"nreactions\": " << cd.numReactions() << ",\n";
+    os << "  \"ncells\": " << ncells << ",\n";
+    os << "  \"rtol\": " << rtol << ",\n";
+    os << "  \"atol\": " << atol << ",\n";
+    os << "  \"ref_rtol\": " << ref_rtol << ",\n";
+    os << "  \"ref_atol\": " << ref_atol << ",\n";
+    os << "  \"repeat\": " << repeat << ",\n";
+    os << "  \"thresholds\": {\"max_err_T\": " << max_err_T
+       << ", \"max_err_Y\": " << max_err_Y
+       << ", \"min_cells_per_sec\": " << min_cells_per_sec << "},\n";
+    os << "  \"reference_failures\": " << nref_failed << ",\n";
+    os << "  \"runs\": [\n";
+    for (int i = 0; i < runs.size(); ++i)
+    {
+        const BenchResult& r = runs[i];
+        os << "    {\"dt\": " << r.dt
+           << ", \"Patm\": " << r.Patm
+           << ", \"integrator\": \"" << r.integrator << "\""
+           << ", \"batch_size\": " << r.batch_size
+           << ", \"threads\": " << r.threads
+           << ", \"seconds\": " << r.seconds
+           << ", \"cells_per_sec\": " << ncells/r.seconds
+           << ", \"rhs_per_cell\": " << r.rhs/ncells
+           << ", \"max_rhs_per_cell\": " << r.max_rhs
+           << ", \"jac_per_cell\": " << r.jac/ncells
+           << ", \"max_err_T\": " << r.err_T
+           << ", \"max_err_Y\": " << r.err_Y
+           << ", \"failed_batches\": " << r.failed
+           << ", \"pass\": " << (r.pass ? "true" : "false")
+           << "}" << (i+1 < runs.size() ? "," : "") << "\n";
+    }
+    os << "  ],\n";
+    os << "  \"pass\": " << (pass ? "true" : "false") << "\n";
+    os << "}\n";
+}
+
+int
+main (int   argc,
+      char* argv[])
+{
+    BoxLib::Initialize(argc,argv);
+
+    if (argc<2) print_usage(argc,argv);
+
+    ParmParse pp;
+    ParmParse ppb("bench");
+
+    ChemDriver cd;
+
+    // Read fab containing pmf solution
+    std::string pmf_file=""; pp.get("pmf_file",pmf_file);
+    std::ifstream is;
+    is.open(pmf_file.c_str());
+    FArrayBox ostate;
+    ostate.readFrom(is);
+    is.close();
+
+    // Simple check to see if number of species is same between compiled mech and fab file
+    const Box& box = ostate.box();
+    const int nSpec = cd.numSpecies();
+    const int nComp = nSpec + 4;
+    if (nComp != ostate.nComp()) {
+      std::cout << "pmf file is not compatible with the mechanism compiled into this code" << '\n';
+      BoxLib::Abort();
+    }
+
+    const int sCompY = 4; // An assumption...
+    const int sCompT = 1; // Another assumption...
+
+    std::string name = pmf_file; ppb.query("name",name);
+
+    Array<Real> dts(1,1.e-5);   ppb.queryarr("dt",dts);
+    Array<Real> Patms(1,1);     ppb.queryarr("Patm",Patms);
+
+    Array<std::string> integrators(1,"bdf"); ppb.queryarr("integrators",integrators);
+    for (int i = 0; i < integrators.size(); ++i)
+        if (integrators[i] != "bdf" && integrators[i] != "adams")
+            BoxLib::Abort("bench.integrators must be bdf or adams");
+
+    int max_threads = 1;
+#ifdef _OPENMP
+    max_threads = omp_get_max_threads();
+#endif
+    Array<int> threads(1,1);
+    if (max_threads > 1) threads.push_back(max_threads);
+    ppb.queryarr("threads",threads);
+    //
+    // By default every thread gets about four batches, so that the thread
+    // counts are timed on work that can actually be shared out.
+    //
+    const int ncells = box.numPts();
+    Array<int> batch_sizes(1,std::max(1,ncells/(4*max_threads)));
+    ppb.queryarr("batch_sizes",batch_sizes);
+
+    Real rtol = rtol_DEF;          ppb.query("rtol",rtol);
+    Real atol = atol_DEF;          ppb.query("atol",atol);
+    Real ref_rtol = ref_rtol_DEF;  ppb.query("ref_rtol",ref_rtol);
+    Real ref_atol = ref_atol_DEF;  ppb.query("ref_atol",ref_atol);
+    int  repeat = repeat_DEF;      ppb.query("repeat",repeat);
+    Real max_err_T = max_err_T_DEF; ppb.query("max_err_T",max_err_T);
+    Real max_err_Y = max_err_Y_DEF; ppb.query("max_err_Y",max_err_Y);
+    Real min_cells_per_sec = 0;    ppb.query("min_cells_per_sec",min_cells_per_sec);
+    std::string outfile = "bench.json"; ppb.query("outfile",outfile);
+
+    BL_ASSERT(repeat > 0);
+    //
+    // Pack the cells into one row so that batches are sub-boxes of it.
+    //
+    const Box pbox(IntVect::TheZeroVector(), IntVect(D_DECL(ncells-1,0,0)));
+    FArrayBox S0(pbox,nComp), S(pbox,nComp), Sref(pbox,nComp), funcCnt(pbox,1);
+    {
+        int n = 0;
+        for (IntVect iv = box.smallEnd(); iv <= box.bigEnd(); box.next(iv), ++n)
+        {
+            const IntVect pv(D_DECL(n,0,0));
+            for (int m = 0; m < nComp; ++m)
+                S0(pv,m) = ostate(iv,m);
+        }
+    }
+
+    std::cout << "Benchmark " << name << ": " << nSpec << " species, "
+              << cd.numReactions() << " reactions, " << ncells << " cells\n";
+    std::cout << std::setw(10) << "dt" << std::setw(8) << "Patm"
+              << std::setw(7) << "integ" << std::setw(7) << "batch" << std::setw(5) << "thr"
+              << std::setw(12) << "cells/s" << std::setw(10) << "RHS/cell"
+              << std::setw(10) << "Jac/cell" << std::setw(12) << "err T"
+              << std::setw(12) << "err Y" << "\n";
+
+    std::vector<BenchResult> runs;
+    bool all_pass = true;
+    int  nref_failed = 0;
+
+    for (int idt = 0; idt < dts.size(); ++idt)
+    {
+        const Real dt = dts[idt];
+
+        for (int ip = 0; ip < Patms.size(); ++ip)
+        {
+            const Real Patm = Patms[ip];
+            //
+            // The reference is BDF at tight tolerances, one cell per call.
+            // If it fails there is nothing to score against: the runs at
+            // this dt and Patm are skipped and the benchmark exits nonzero.
+            //
+            cd.set_vode_tols(ref_rtol,ref_atol);
+            if (solve_batches(cd,Sref,S0,funcCnt,sCompY,sCompT,dt,Patm,true,1,max_threads) > 0)
+            {
+                std::cout << "*** reference solve failed at dt = " << dt << ", Patm = " << Patm
+                          << ", runs skipped\n";
+                nref_failed++;
+                continue;
+            }
+
+            cd.set_vode_tols(rtol,atol);
+
+            for (int ii = 0; ii < integrators.size(); ++ii)
+            {
+                const bool use_stiff_solver = (integrators[ii] == "bdf");
+
+                for (int ib = 0; ib < batch_sizes.size(); ++ib)
+                {
+                    for (int it = 0; it < threads.size(); ++it)
+                    {
+                        BenchResult r;
+                        r.dt         = dt;
+                        r.Patm       = Patm;
+                        r.integrator = integrators[ii];
+                        r.batch_size = batch_sizes[ib];
+                        r.threads    = threads[it];
+                        r.seconds    = -1;
+
+                        for (int k = 0; k < repeat; ++k)
+                        {
+                            cd.resetVodeJacobianCount();
+
+                            const Real strt_time = ParallelDescriptor::second();
+                            r.failed = solve_batches(cd,S,S0,funcCnt,sCompY,sCompT,dt,Patm,
+                                                     use_stiff_solver,r.batch_size,r.threads);
+                            const Real run_time = ParallelDescriptor::second() - strt_time;
+
+                            if (r.seconds < 0 || run_time < r.seconds)
+                                r.seconds = run_time;
+                        }
+
+                        r.rhs     = funcCnt.norm(1);
+                        r.max_rhs = funcCnt.norm(0);
+                        r.jac     = cd.numVodeJacobians();
+
+                        r.err_T = r.err_Y = 0;
+                        for (IntVect pv = pbox.smallEnd(); pv <= pbox.bigEnd(); pbox.next(pv))
+                        {
+                            r.err_T = std::max(r.err_T, std::abs(S(pv,sCompT) - Sref(pv,sCompT)));
+                            for (int m = 0; m < nSpec; ++m)
+                                r.err_Y = std::max(r.err_Y, std::abs(S(pv,sCompY+m) - Sref(pv,sCompY+m)));
+                        }
+
+                        r.pass = (r.failed == 0 && r.err_T <= max_err_T && r.err_Y <= max_err_Y
+                                  && ncells/r.seconds >= min_cells_per_sec);
+                        all_pass = all_pass && r.pass;
+                        runs.push_back(r);
+
+                        std::cout << std::setw(10) << r.dt << std::setw(8) << r.Patm
+                                  << std::setw(7) << r.integrator << std::setw(7) << r.batch_size
+                                  << std::setw(5) << r.threads
+                                  << std::setw(12) << ncells/r.seconds
+                                  << std::setw(10) << r.rhs/ncells
+                                  << std::setw(10) << r.jac/ncells
+                                  << std::setw(12) << r.err_T
+                                  << std::setw(12) << r.err_Y
+                                  << (r.pass ? "" : "  FAIL") << '\n';
+                    }
+                }
+            }
+        }
+    }
+
+    all_pass = all_pass && nref_failed == 0;
+
+    std::ofstream os;
+    os.open(outfile.c_str());
+    write_json(os,name,pmf_file,cd,ncells,rtol,atol,ref_rtol,ref_atol,repeat,
+               max_err_T,max_err_Y,min_cells_per_sec,nref_failed,runs,all_pass);
+    os.close();
+
+    std::cout << " ... results written to " << outfile;
+    if (nref_failed > 0)
+        std::cout << " (" << nref_failed << " reference solves failed)";
+    else if (!all_pass)
+        std::cout << " (some runs outside thresholds)";
+    std::cout << '\n';
+
+    BoxLib::Finalize();
+
+    return all_pass ? 0 : 1;
+}
@@ -0,0 +1,115 @@
+#!/usr/bin/env python
+#
+# Compares two benchmark files written by run_bench.sh (or a single
+# benchDriver run) and reports regressions:
+#
+#   bench_compare.py [options] baseline.json new.json
+#
+# A run regresses if its throughput drops by more than --time_tol, if its
+# RHS or Jacobian evaluations per cell grow by more than --evals_tol, if its
+# error against the reference grows by more than a factor --err_factor, or
+# if it fails the thresholds recorded by benchDriver.  Runs are matched on
+# mechanism, dt, Patm, integrator, batch size and thread count.  A failed
+# reference solve in the new file also counts as a regression.  The exit
+# status is 1 if anything regressed.
+#
+from __future__ import print_function
+
+import json
+import sys
+from optparse import OptionParser
+
+
+def load(name):
+    data = json.load(open(name))
+    if isinstance(data, dict):
+        data = [data]
+    runs = {}
+    ref_failures = {}
+    for mech in data:
+        ref_failures[mech["mechanism"]] = mech.get("reference_failures", 0)
+        for r in mech["runs"]:
+            key = (mech["mechanism"], r["dt"], r["Patm"], r["integrator"],
+                   r["batch_size"], r["threads"])
+            runs[key] = r
+    return runs, ref_failures
+
+
+def main():
+    parser = OptionParser(usage="%prog [options] baseline.json new.json")
+    parser.add_option("-t", "--time_tol", type="float", default=0.10,
+                      help="allowed relative drop in cells/s [%default]")
+    parser.add_option("-e", "--evals_tol", type="float", default=0.05,
+                      help="allowed relative growth in RHS and Jacobian evaluations [%default]")
+    parser.add_option("-f", "--err_factor", type="float", default=10.0,
+                      help="allowed growth factor of the error against the reference [%default]")
+    parser.add_option("--err_T_floor", type="float", default=1.e-8,
+                      help="temperature errors below this are not compared [%default]")
+    parser.add_option("--err_Y_floor", type="float", default=1.e-12,
+                      help="mass fraction errors below this are not compared [%default]")
+    (opts, args) = parser.parse_args()
+    if len(args) != 2:
+        parser.error("need a baseline and a new benchmark file")
+
+    base, _ = load(args[0])
+    new, new_ref_failures = load(args[1])
+
+    nregress = 0
+    print("%-8s %9s %6s %6s %6s %4s %10s %10s %10s %10s  %s" %
+          ("mech", "dt", "Patm", "integ", "batch", "thr",
+           "cells/s", "RHS/cell", "Jac/cell", "err T", "status"))
+
+    for key in sorted(new.keys()):
+        n = new[key]
+        problems = []
+        if not n["pass"]:
+            problems.append("thresholds")
+
+        if key in base:
+            b = base[key]
+            speed = n["cells_per_sec"] / b["cells_per_sec"]
+            rhs = n["rhs_per_cell"] / max(b["rhs_per_cell"], 1.e-30)
+            jac = n["jac_per_cell"] / max(b["jac_per_cell"], 1.e-30)
+
+            if speed < 1.0 - opts.time_tol:
+                problems.append("speed")
+            if rhs > 1.0 + opts.evals_tol:
+                problems.append("RHS")
+            if b["jac_per_cell"] > 0 and jac > 1.0 + opts.evals_tol:
+                problems.append("Jac")
+            if n["max_err_T"] > max(opts.err_factor * b["max_err_T"], opts.err_T_floor):
+                problems.append("err T")
+            if n["max_err_Y"] > max(opts.err_factor * b["max_err_Y"], opts.err_Y_floor):
+                problems.append("err Y")
+
+            cols = ("%9.3fx" % speed, "%9.3fx" % rhs, "%9.3fx" % jac)
+        else:
+            cols = ("%10.4g" % n["cells_per_sec"], "%10.4g" % n["rhs_per_cell"],
+                    "%10.4g" % n["jac_per_cell"])
+
+        status = "REGRESSED (" + ", ".join(problems) + ")" if problems else \
+                 ("ok" if key in base else "no baseline")
+        if problems:
+            nregress += 1
+
+        print("%-8s %9.3g %6g %6s %6d %4d %10s %10s %10s %10.3g  %s" %
+              (key[0], key[1], key[2], key[3], key[4], key[5],
+               cols[0], cols[1], cols[2], n["max_err_T"], status))
+
+    for key in sorted(base.keys()):
+        if key not in new:
+            print("%-8s %9.3g %6g %6s %6d %4d  missing from %s" %
+                  (key[0], key[1], key[2], key[3], key[4], key[5], args[1]))
+
+    nref = 0
+    for mech in sorted(new_ref_failures.keys()):
+        if new_ref_failures[mech] > 0:
+            print("%-8s %d reference solves failed in %s" % (mech, new_ref_failures[mech], args[1]))
+            nref += 1
+
+    print("%d of %d runs regressed" % (nregress, len(new)))
+    return 1 if nregress or nref else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
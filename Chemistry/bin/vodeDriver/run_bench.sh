@@ -0,0 +1,67 @@
+#!/bin/sh
+#
+# Builds benchDriver.cpp once per mechanism that has an input FAB in this
+# directory, runs it and gathers the results in one JSON file:
+#
+#   ./run_bench.sh [output.json] [extra bench.* options]
+#
+# e.g. ./run_bench.sh new.json bench.dt="1e-6 1e-5 1e-4" bench.batch_sizes="1 16 64"
+#
+# Compare against a saved run with
+#
+#   ./bench_compare.py baseline.json new.json
+#
+# Build settings may be overridden from the environment (DIM, COMP, FCOMP,
+# USE_OMP, MAKE).  Dodecane (DODECANE_LU) has no input FAB yet and is not run.
+#
+OUT=${1:-bench.json}
+[ $# -gt 0 ] && shift
+
+MAKE=${MAKE:-make}
+DIM=${DIM:-2}
+USE_OMP=${USE_OMP:-TRUE}
+
+if [ "${DIM}" = "3" ]; then
+  CASES="CHEMH:chem-H_0370.3d.fab DRM19:drm19_0700.3d.fab"
+else
+  CASES="CHEMH:chem-H_0370.fab DRM19:drm19_0700.fab GRI30:gri30_0750.fab LUDME:dme_0700_1444pt.fab"
+fi
+
+BENCH_OPTS=${BENCH_OPTS:-'bench.dt="1e-6 1e-5 1e-4" bench.Patm="1 10" bench.integrators="bdf adams" bench.batch_sizes="1 16 64"'}
+
+status=0
+parts=""
+
+for c in ${CASES}; do
+  model=${c%%:*}
+  fab=${c#*:}
+  ebase=cdbench_${model}
+
+  echo "=== ${model} (${fab})"
+  ${MAKE} -j4 BENCH=TRUE USE_SDC=FALSE USE_OMP=${USE_OMP} DIM=${DIM} \
+          CHEMISTRY_MODEL=${model} EBASE=${ebase} > ${ebase}.make.log 2>&1
+  if [ $? -ne 0 ]; then
+    echo "*** build failed, see ${ebase}.make.log"
+    status=1
+    continue
+  fi
+
+  exe=`ls -t ${ebase}*.ex | head -1`
+  eval ./${exe} pmf_file=${fab} bench.name=${model} bench.outfile=${ebase}.json ${BENCH_OPTS} '"$@"'
+  [ $? -ne 0 ] && status=1
+  [ -f ${ebase}.json ] && parts="${parts} ${ebase}.json"
+done
+
+{
+  echo "["
+  sep=""
+  for p in ${parts}; do
+    printf "%s" "${sep}"
+    cat ${p}
+    sep=","
+  done
+  echo "]"
+} > ${OUT}
+
+echo "Results written to ${OUT}"
+exit ${status}
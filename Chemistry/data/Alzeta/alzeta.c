@@ -1,5 +1,6 @@
 
 #include <math.h>
+#include <float.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -86,6 +87,12 @@
 #define VCKPY VCKPY
 #define VCKWYR VCKWYR
 #define VCKYTX VCKYTX
+#define VCKCPBS VCKCPBS
+#define VCKCVBS VCKCVBS
+#define VCKHBMS VCKHBMS
+#define VCKUBMS VCKUBMS
+#define VCKRHOY VCKRHOY
+#define VCKMMWY VCKMMWY
 #define GET_T_GIVEN_EY GET_T_GIVEN_EY
 #define GET_T_GIVEN_HY GET_T_GIVEN_HY
 #define GET_REACTION_MAP GET_REACTION_MAP
@@ -171,6 +178,12 @@
 #define VCKPY vckpy
 #define VCKWYR vckwyr
 #define VCKYTX vckytx
+#define VCKCPBS vckcpbs
+#define VCKCVBS vckcvbs
+#define VCKHBMS vckhbms
+#define VCKUBMS vckubms
+#define VCKRHOY vckrhoy
+#define VCKMMWY vckmmwy
 #define GET_T_GIVEN_EY get_t_given_ey
 #define GET_T_GIVEN_HY get_t_given_hy
 #define GET_REACTION_MAP get_reaction_map
@@ -256,6 +269,12 @@
 #define VCKPY vckpy_
 #define VCKWYR vckwyr_
 #define VCKYTX vckytx_
+#define VCKCPBS vckcpbs_
+#define VCKCVBS vckcvbs_
+#define VCKHBMS vckhbms_
+#define VCKUBMS vckubms_
+#define VCKRHOY vckrhoy_
+#define VCKMMWY vckmmwy_
 #define GET_T_GIVEN_EY get_t_given_ey_
 #define GET_T_GIVEN_HY get_t_given_hy_
 #define GET_REACTION_MAP get_reaction_map_
@@ -369,6 +388,12 @@ void VCKWYR(int * restrict np, double * restrict rho, double * restrict T,
             double * restrict y, int * restrict iwrk, double * restrict rwrk,
             double * restrict wdot);
 void VCKYTX(int * restrict np, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict x);
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs);
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs);
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms);
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms);
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho);
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm);
 void vcomp_k_f(int npt, double * restrict k_f_s, double * restrict tc, double * restrict invT);
 void vcomp_gibbs(int npt, double * restrict g_RT, double * restrict tc);
 void vcomp_Kc(int npt, double * restrict Kc_s, double * restrict g_RT, double * restrict invT);
@@ -7500,6 +7525,28 @@ void CKRHOY(double * restrict P, double * restrict T, double * restrict y, int *
 }
 
 
+/*Compute rho = P*W(y)/RT */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho)
+{
+    for (int i=0; i<(*np); i++) {
+        rho[i] = 0.0;
+    }
+
+    for (int n=0; n<72; n++) {
+        for (int i=0; i<(*np); i++) {
+            rho[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        rho[i] = P[i] / (8.31451e+07 * T[i] * rho[i]);/*rho = P*W/(R*T) */
+    }
+
+    return;
+}
+
+
 /*Compute rho = P*W(c)/(R*T) */
 void CKRHOC(double * restrict P, double * restrict T, double * restrict c, int * iwrk, double * restrict rwrk, double * restrict rho)
 {
@@ -7624,6 +7671,29 @@ void CKMMWY(double * restrict y, int * iwrk, double * restrict rwrk, double * re
 }
 
 
+/*given y[species]: mass fractions */
+/*returns mean molecular weight (gm/mole) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm)
+{
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 0.0;
+    }
+
+    for (int n=0; n<72; n++) {
+        for (int i=0; i<(*np); i++) {
+            wtm[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 1.0 / wtm[i];
+    }
+
+    return;
+}
+
+
 /*given x[species]: mole fractions */
 /*returns mean molecular weight (gm/mole) */
 void CKMMWX(double * restrict x, int * iwrk, double * restrict rwrk, double * restrict wtm)
@@ -8912,6 +8982,30 @@ void CKCPBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CP (Eq. 34) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs)
+{
+    double tc[5], tmp[72], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cp_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<72; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cpbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean specific heat at CV (Eq. 35) */
 void CKCVBL(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict cvbl)
 {
@@ -9017,6 +9111,30 @@ void CKCVBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CV (Eq. 36) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs)
+{
+    double tc[5], tmp[72], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cv_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<72; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cvbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean enthalpy of the mixture in molar units */
 void CKHBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict hbml)
 {
@@ -9058,6 +9176,30 @@ void CKHBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns mean enthalpy of mixture in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms)
+{
+    double tc[5], tmp[72], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesEnthalpy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<72; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        hbms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mean internal energy in molar units */
 void CKUBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict ubml)
 {
@@ -9165,6 +9307,30 @@ void CKUBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*get mean internal energy in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms)
+{
+    double tc[5], tmp[72], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesInternalEnergy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<72; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        ubms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mixture entropy in molar units */
 void CKSBML(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict sbml)
 {
@@ -25179,12 +25345,540 @@ void productionRate(double * restrict wdot, double * restrict sc, double T)
 
 void comp_k_f(double * restrict tc, double invT, double * restrict k_f)
 {
+    double x[518];
 #ifdef __INTEL_COMPILER
     #pragma simd
 #endif
     for (int i=0; i<518; ++i) {
-        k_f[i] = prefactor_units[i] * fwd_A[i]
-                    * exp(fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT);
+        x[i] = fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT;
+    };
+
+    /*the exp is skipped when the exponent is zero or that of */
+    /*an earlier reaction with the same default beta and Ea */
+    k_f[0] = (x[0] == 0.0 ? 1.0 : exp(x[0]));
+    k_f[1] = exp(x[1]);
+    k_f[2] = exp(x[2]);
+    k_f[3] = exp(x[3]);
+    k_f[4] = exp(x[4]);
+    k_f[5] = exp(x[5]);
+    k_f[6] = exp(x[6]);
+    k_f[7] = exp(x[7]);
+    k_f[8] = exp(x[8]);
+    k_f[9] = exp(x[9]);
+    k_f[10] = exp(x[10]);
+    k_f[11] = exp(x[11]);
+    k_f[12] = exp(x[12]);
+    k_f[13] = exp(x[13]);
+    k_f[14] = exp(x[14]);
+    k_f[15] = (x[15] == 0.0 ? 1.0 : exp(x[15]));
+    k_f[16] = exp(x[16]);
+    k_f[17] = exp(x[17]);
+    k_f[18] = exp(x[18]);
+    k_f[19] = exp(x[19]);
+    k_f[20] = exp(x[20]);
+    k_f[21] = exp(x[21]);
+    k_f[22] = exp(x[22]);
+    k_f[23] = (x[23] == 0.0 ? 1.0 : exp(x[23]));
+    k_f[24] = exp(x[24]);
+    k_f[25] = (x[25] == 0.0 ? 1.0 : exp(x[25]));
+    k_f[26] = exp(x[26]);
+    k_f[27] = exp(x[27]);
+    k_f[28] = (x[28] == 0.0 ? 1.0 : exp(x[28]));
+    k_f[29] = exp(x[29]);
+    k_f[30] = exp(x[30]);
+    k_f[31] = exp(x[31]);
+    k_f[32] = (x[32] == x[7] ? k_f[7] : exp(x[32]));
+    k_f[33] = (x[33] == x[7] ? k_f[7] : exp(x[33]));
+    k_f[34] = exp(x[34]);
+    k_f[35] = (x[35] == x[7] ? k_f[7] : exp(x[35]));
+    k_f[36] = exp(x[36]);
+    k_f[37] = exp(x[37]);
+    k_f[38] = exp(x[38]);
+    k_f[39] = exp(x[39]);
+    k_f[40] = exp(x[40]);
+    k_f[41] = exp(x[41]);
+    k_f[42] = exp(x[42]);
+    k_f[43] = exp(x[43]);
+    k_f[44] = exp(x[44]);
+    k_f[45] = exp(x[45]);
+    k_f[46] = exp(x[46]);
+    k_f[47] = exp(x[47]);
+    k_f[48] = exp(x[48]);
+    k_f[49] = exp(x[49]);
+    k_f[50] = exp(x[50]);
+    k_f[51] = (x[51] == 0.0 ? 1.0 : exp(x[51]));
+    k_f[52] = exp(x[52]);
+    k_f[53] = (x[53] == 0.0 ? 1.0 : exp(x[53]));
+    k_f[54] = exp(x[54]);
+    k_f[55] = (x[55] == 0.0 ? 1.0 : exp(x[55]));
+    k_f[56] = (x[56] == 0.0 ? 1.0 : exp(x[56]));
+    k_f[57] = (x[57] == 0.0 ? 1.0 : exp(x[57]));
+    k_f[58] = (x[58] == 0.0 ? 1.0 : exp(x[58]));
+    k_f[59] = (x[59] == 0.0 ? 1.0 : exp(x[59]));
+    k_f[60] = exp(x[60]);
+    k_f[61] = (x[61] == 0.0 ? 1.0 : exp(x[61]));
+    k_f[62] = (x[62] == 0.0 ? 1.0 : exp(x[62]));
+    k_f[63] = exp(x[63]);
+    k_f[64] = (x[64] == 0.0 ? 1.0 : exp(x[64]));
+    k_f[65] = (x[65] == 0.0 ? 1.0 : exp(x[65]));
+    k_f[66] = exp(x[66]);
+    k_f[67] = exp(x[67]);
+    k_f[68] = (x[68] == 0.0 ? 1.0 : exp(x[68]));
+    k_f[69] = exp(x[69]);
+    k_f[70] = exp(x[70]);
+    k_f[71] = (x[71] == x[69] ? k_f[69] : exp(x[71]));
+    k_f[72] = (x[72] == 0.0 ? 1.0 : exp(x[72]));
+    k_f[73] = exp(x[73]);
+    k_f[74] = (x[74] == 0.0 ? 1.0 : exp(x[74]));
+    k_f[75] = exp(x[75]);
+    k_f[76] = (x[76] == 0.0 ? 1.0 : exp(x[76]));
+    k_f[77] = exp(x[77]);
+    k_f[78] = exp(x[78]);
+    k_f[79] = exp(x[79]);
+    k_f[80] = exp(x[80]);
+    k_f[81] = exp(x[81]);
+    k_f[82] = exp(x[82]);
+    k_f[83] = (x[83] == x[81] ? k_f[81] : exp(x[83]));
+    k_f[84] = exp(x[84]);
+    k_f[85] = exp(x[85]);
+    k_f[86] = exp(x[86]);
+    k_f[87] = exp(x[87]);
+    k_f[88] = (x[88] == x[36] ? k_f[36] : exp(x[88]));
+    k_f[89] = exp(x[89]);
+    k_f[90] = exp(x[90]);
+    k_f[91] = exp(x[91]);
+    k_f[92] = exp(x[92]);
+    k_f[93] = exp(x[93]);
+    k_f[94] = (x[94] == 0.0 ? 1.0 : exp(x[94]));
+    k_f[95] = (x[95] == 0.0 ? 1.0 : exp(x[95]));
+    k_f[96] = exp(x[96]);
+    k_f[97] = (x[97] == 0.0 ? 1.0 : exp(x[97]));
+    k_f[98] = exp(x[98]);
+    k_f[99] = (x[99] == 0.0 ? 1.0 : exp(x[99]));
+    k_f[100] = exp(x[100]);
+    k_f[101] = exp(x[101]);
+    k_f[102] = exp(x[102]);
+    k_f[103] = (x[103] == 0.0 ? 1.0 : exp(x[103]));
+    k_f[104] = exp(x[104]);
+    k_f[105] = exp(x[105]);
+    k_f[106] = exp(x[106]);
+    k_f[107] = (x[107] == x[106] ? k_f[106] : exp(x[107]));
+    k_f[108] = (x[108] == 0.0 ? 1.0 : exp(x[108]));
+    k_f[109] = exp(x[109]);
+    k_f[110] = (x[110] == 0.0 ? 1.0 : exp(x[110]));
+    k_f[111] = exp(x[111]);
+    k_f[112] = (x[112] == 0.0 ? 1.0 : exp(x[112]));
+    k_f[113] = (x[113] == x[77] ? k_f[77] : exp(x[113]));
+    k_f[114] = exp(x[114]);
+    k_f[115] = (x[115] == 0.0 ? 1.0 : exp(x[115]));
+    k_f[116] = exp(x[116]);
+    k_f[117] = exp(x[117]);
+    k_f[118] = exp(x[118]);
+    k_f[119] = exp(x[119]);
+    k_f[120] = exp(x[120]);
+    k_f[121] = (x[121] == 0.0 ? 1.0 : exp(x[121]));
+    k_f[122] = (x[122] == 0.0 ? 1.0 : exp(x[122]));
+    k_f[123] = (x[123] == 0.0 ? 1.0 : exp(x[123]));
+    k_f[124] = exp(x[124]);
+    k_f[125] = (x[125] == 0.0 ? 1.0 : exp(x[125]));
+    k_f[126] = exp(x[126]);
+    k_f[127] = exp(x[127]);
+    k_f[128] = exp(x[128]);
+    k_f[129] = exp(x[129]);
+    k_f[130] = (x[130] == 0.0 ? 1.0 : exp(x[130]));
+    k_f[131] = exp(x[131]);
+    k_f[132] = (x[132] == 0.0 ? 1.0 : exp(x[132]));
+    k_f[133] = (x[133] == 0.0 ? 1.0 : exp(x[133]));
+    k_f[134] = exp(x[134]);
+    k_f[135] = exp(x[135]);
+    k_f[136] = (x[136] == 0.0 ? 1.0 : exp(x[136]));
+    k_f[137] = exp(x[137]);
+    k_f[138] = exp(x[138]);
+    k_f[139] = exp(x[139]);
+    k_f[140] = exp(x[140]);
+    k_f[141] = (x[141] == 0.0 ? 1.0 : exp(x[141]));
+    k_f[142] = exp(x[142]);
+    k_f[143] = exp(x[143]);
+    k_f[144] = exp(x[144]);
+    k_f[145] = exp(x[145]);
+    k_f[146] = exp(x[146]);
+    k_f[147] = (x[147] == 0.0 ? 1.0 : exp(x[147]));
+    k_f[148] = (x[148] == 0.0 ? 1.0 : exp(x[148]));
+    k_f[149] = (x[149] == 0.0 ? 1.0 : exp(x[149]));
+    k_f[150] = exp(x[150]);
+    k_f[151] = exp(x[151]);
+    k_f[152] = exp(x[152]);
+    k_f[153] = (x[153] == 0.0 ? 1.0 : exp(x[153]));
+    k_f[154] = (x[154] == 0.0 ? 1.0 : exp(x[154]));
+    k_f[155] = (x[155] == 0.0 ? 1.0 : exp(x[155]));
+    k_f[156] = exp(x[156]);
+    k_f[157] = exp(x[157]);
+    k_f[158] = (x[158] == 0.0 ? 1.0 : exp(x[158]));
+    k_f[159] = (x[159] == 0.0 ? 1.0 : exp(x[159]));
+    k_f[160] = (x[160] == 0.0 ? 1.0 : exp(x[160]));
+    k_f[161] = exp(x[161]);
+    k_f[162] = exp(x[162]);
+    k_f[163] = (x[163] == 0.0 ? 1.0 : exp(x[163]));
+    k_f[164] = exp(x[164]);
+    k_f[165] = exp(x[165]);
+    k_f[166] = exp(x[166]);
+    k_f[167] = (x[167] == 0.0 ? 1.0 : exp(x[167]));
+    k_f[168] = exp(x[168]);
+    k_f[169] = (x[169] == 0.0 ? 1.0 : exp(x[169]));
+    k_f[170] = exp(x[170]);
+    k_f[171] = (x[171] == x[170] ? k_f[170] : exp(x[171]));
+    k_f[172] = (x[172] == 0.0 ? 1.0 : exp(x[172]));
+    k_f[173] = (x[173] == 0.0 ? 1.0 : exp(x[173]));
+    k_f[174] = (x[174] == 0.0 ? 1.0 : exp(x[174]));
+    k_f[175] = (x[175] == 0.0 ? 1.0 : exp(x[175]));
+    k_f[176] = exp(x[176]);
+    k_f[177] = (x[177] == x[176] ? k_f[176] : exp(x[177]));
+    k_f[178] = (x[178] == 0.0 ? 1.0 : exp(x[178]));
+    k_f[179] = (x[179] == 0.0 ? 1.0 : exp(x[179]));
+    k_f[180] = (x[180] == 0.0 ? 1.0 : exp(x[180]));
+    k_f[181] = exp(x[181]);
+    k_f[182] = exp(x[182]);
+    k_f[183] = exp(x[183]);
+    k_f[184] = exp(x[184]);
+    k_f[185] = exp(x[185]);
+    k_f[186] = (x[186] == 0.0 ? 1.0 : exp(x[186]));
+    k_f[187] = exp(x[187]);
+    k_f[188] = exp(x[188]);
+    k_f[189] = (x[189] == x[188] ? k_f[188] : exp(x[189]));
+    k_f[190] = exp(x[190]);
+    k_f[191] = exp(x[191]);
+    k_f[192] = (x[192] == x[37] ? k_f[37] : exp(x[192]));
+    k_f[193] = exp(x[193]);
+    k_f[194] = exp(x[194]);
+    k_f[195] = exp(x[195]);
+    k_f[196] = (x[196] == x[157] ? k_f[157] : exp(x[196]));
+    k_f[197] = exp(x[197]);
+    k_f[198] = exp(x[198]);
+    k_f[199] = exp(x[199]);
+    k_f[200] = exp(x[200]);
+    k_f[201] = (x[201] == 0.0 ? 1.0 : exp(x[201]));
+    k_f[202] = exp(x[202]);
+    k_f[203] = exp(x[203]);
+    k_f[204] = exp(x[204]);
+    k_f[205] = exp(x[205]);
+    k_f[206] = exp(x[206]);
+    k_f[207] = exp(x[207]);
+    k_f[208] = exp(x[208]);
+    k_f[209] = exp(x[209]);
+    k_f[210] = exp(x[210]);
+    k_f[211] = exp(x[211]);
+    k_f[212] = (x[212] == 0.0 ? 1.0 : exp(x[212]));
+    k_f[213] = exp(x[213]);
+    k_f[214] = (x[214] == 0.0 ? 1.0 : exp(x[214]));
+    k_f[215] = exp(x[215]);
+    k_f[216] = exp(x[216]);
+    k_f[217] = exp(x[217]);
+    k_f[218] = (x[218] == 0.0 ? 1.0 : exp(x[218]));
+    k_f[219] = exp(x[219]);
+    k_f[220] = exp(x[220]);
+    k_f[221] = exp(x[221]);
+    k_f[222] = (x[222] == 0.0 ? 1.0 : exp(x[222]));
+    k_f[223] = (x[223] == 0.0 ? 1.0 : exp(x[223]));
+    k_f[224] = exp(x[224]);
+    k_f[225] = exp(x[225]);
+    k_f[226] = (x[226] == 0.0 ? 1.0 : exp(x[226]));
+    k_f[227] = (x[227] == 0.0 ? 1.0 : exp(x[227]));
+    k_f[228] = (x[228] == 0.0 ? 1.0 : exp(x[228]));
+    k_f[229] = (x[229] == 0.0 ? 1.0 : exp(x[229]));
+    k_f[230] = (x[230] == 0.0 ? 1.0 : exp(x[230]));
+    k_f[231] = (x[231] == 0.0 ? 1.0 : exp(x[231]));
+    k_f[232] = (x[232] == 0.0 ? 1.0 : exp(x[232]));
+    k_f[233] = (x[233] == 0.0 ? 1.0 : exp(x[233]));
+    k_f[234] = exp(x[234]);
+    k_f[235] = exp(x[235]);
+    k_f[236] = exp(x[236]);
+    k_f[237] = (x[237] == 0.0 ? 1.0 : exp(x[237]));
+    k_f[238] = (x[238] == 0.0 ? 1.0 : exp(x[238]));
+    k_f[239] = exp(x[239]);
+    k_f[240] = exp(x[240]);
+    k_f[241] = exp(x[241]);
+    k_f[242] = (x[242] == 0.0 ? 1.0 : exp(x[242]));
+    k_f[243] = (x[243] == 0.0 ? 1.0 : exp(x[243]));
+    k_f[244] = (x[244] == 0.0 ? 1.0 : exp(x[244]));
+    k_f[245] = (x[245] == 0.0 ? 1.0 : exp(x[245]));
+    k_f[246] = exp(x[246]);
+    k_f[247] = exp(x[247]);
+    k_f[248] = exp(x[248]);
+    k_f[249] = exp(x[249]);
+    k_f[250] = (x[250] == x[249] ? k_f[249] : exp(x[250]));
+    k_f[251] = exp(x[251]);
+    k_f[252] = exp(x[252]);
+    k_f[253] = exp(x[253]);
+    k_f[254] = exp(x[254]);
+    k_f[255] = (x[255] == x[193] ? k_f[193] : exp(x[255]));
+    k_f[256] = exp(x[256]);
+    k_f[257] = exp(x[257]);
+    k_f[258] = exp(x[258]);
+    k_f[259] = exp(x[259]);
+    k_f[260] = (x[260] == 0.0 ? 1.0 : exp(x[260]));
+    k_f[261] = (x[261] == 0.0 ? 1.0 : exp(x[261]));
+    k_f[262] = (x[262] == 0.0 ? 1.0 : exp(x[262]));
+    k_f[263] = (x[263] == 0.0 ? 1.0 : exp(x[263]));
+    k_f[264] = (x[264] == 0.0 ? 1.0 : exp(x[264]));
+    k_f[265] = exp(x[265]);
+    k_f[266] = exp(x[266]);
+    k_f[267] = exp(x[267]);
+    k_f[268] = (x[268] == x[265] ? k_f[265] : exp(x[268]));
+    k_f[269] = (x[269] == x[266] ? k_f[266] : exp(x[269]));
+    k_f[270] = (x[270] == x[267] ? k_f[267] : exp(x[270]));
+    k_f[271] = exp(x[271]);
+    k_f[272] = exp(x[272]);
+    k_f[273] = (x[273] == 0.0 ? 1.0 : exp(x[273]));
+    k_f[274] = (x[274] == 0.0 ? 1.0 : exp(x[274]));
+    k_f[275] = (x[275] == 0.0 ? 1.0 : exp(x[275]));
+    k_f[276] = (x[276] == 0.0 ? 1.0 : exp(x[276]));
+    k_f[277] = (x[277] == 0.0 ? 1.0 : exp(x[277]));
+    k_f[278] = exp(x[278]);
+    k_f[279] = exp(x[279]);
+    k_f[280] = exp(x[280]);
+    k_f[281] = exp(x[281]);
+    k_f[282] = exp(x[282]);
+    k_f[283] = exp(x[283]);
+    k_f[284] = (x[284] == x[283] ? k_f[283] : exp(x[284]));
+    k_f[285] = exp(x[285]);
+    k_f[286] = exp(x[286]);
+    k_f[287] = exp(x[287]);
+    k_f[288] = exp(x[288]);
+    k_f[289] = (x[289] == 0.0 ? 1.0 : exp(x[289]));
+    k_f[290] = exp(x[290]);
+    k_f[291] = exp(x[291]);
+    k_f[292] = exp(x[292]);
+    k_f[293] = exp(x[293]);
+    k_f[294] = exp(x[294]);
+    k_f[295] = exp(x[295]);
+    k_f[296] = exp(x[296]);
+    k_f[297] = exp(x[297]);
+    k_f[298] = exp(x[298]);
+    k_f[299] = (x[299] == 0.0 ? 1.0 : exp(x[299]));
+    k_f[300] = (x[300] == x[73] ? k_f[73] : exp(x[300]));
+    k_f[301] = (x[301] == 0.0 ? 1.0 : exp(x[301]));
+    k_f[302] = exp(x[302]);
+    k_f[303] = exp(x[303]);
+    k_f[304] = (x[304] == x[164] ? k_f[164] : exp(x[304]));
+    k_f[305] = (x[305] == x[164] ? k_f[164] : exp(x[305]));
+    k_f[306] = exp(x[306]);
+    k_f[307] = exp(x[307]);
+    k_f[308] = exp(x[308]);
+    k_f[309] = exp(x[309]);
+    k_f[310] = exp(x[310]);
+    k_f[311] = (x[311] == x[310] ? k_f[310] : exp(x[311]));
+    k_f[312] = exp(x[312]);
+    k_f[313] = exp(x[313]);
+    k_f[314] = (x[314] == x[313] ? k_f[313] : exp(x[314]));
+    k_f[315] = exp(x[315]);
+    k_f[316] = exp(x[316]);
+    k_f[317] = exp(x[317]);
+    k_f[318] = (x[318] == 0.0 ? 1.0 : exp(x[318]));
+    k_f[319] = (x[319] == 0.0 ? 1.0 : exp(x[319]));
+    k_f[320] = (x[320] == 0.0 ? 1.0 : exp(x[320]));
+    k_f[321] = (x[321] == 0.0 ? 1.0 : exp(x[321]));
+    k_f[322] = (x[322] == 0.0 ? 1.0 : exp(x[322]));
+    k_f[323] = (x[323] == 0.0 ? 1.0 : exp(x[323]));
+    k_f[324] = (x[324] == 0.0 ? 1.0 : exp(x[324]));
+    k_f[325] = exp(x[325]);
+    k_f[326] = exp(x[326]);
+    k_f[327] = exp(x[327]);
+    k_f[328] = exp(x[328]);
+    k_f[329] = exp(x[329]);
+    k_f[330] = (x[330] == 0.0 ? 1.0 : exp(x[330]));
+    k_f[331] = exp(x[331]);
+    k_f[332] = (x[332] == 0.0 ? 1.0 : exp(x[332]));
+    k_f[333] = exp(x[333]);
+    k_f[334] = (x[334] == 0.0 ? 1.0 : exp(x[334]));
+    k_f[335] = exp(x[335]);
+    k_f[336] = (x[336] == 0.0 ? 1.0 : exp(x[336]));
+    k_f[337] = (x[337] == 0.0 ? 1.0 : exp(x[337]));
+    k_f[338] = exp(x[338]);
+    k_f[339] = exp(x[339]);
+    k_f[340] = (x[340] == 0.0 ? 1.0 : exp(x[340]));
+    k_f[341] = (x[341] == 0.0 ? 1.0 : exp(x[341]));
+    k_f[342] = (x[342] == 0.0 ? 1.0 : exp(x[342]));
+    k_f[343] = (x[343] == 0.0 ? 1.0 : exp(x[343]));
+    k_f[344] = (x[344] == 0.0 ? 1.0 : exp(x[344]));
+    k_f[345] = (x[345] == 0.0 ? 1.0 : exp(x[345]));
+    k_f[346] = (x[346] == 0.0 ? 1.0 : exp(x[346]));
+    k_f[347] = (x[347] == 0.0 ? 1.0 : exp(x[347]));
+    k_f[348] = (x[348] == 0.0 ? 1.0 : exp(x[348]));
+    k_f[349] = exp(x[349]);
+    k_f[350] = exp(x[350]);
+    k_f[351] = (x[351] == 0.0 ? 1.0 : exp(x[351]));
+    k_f[352] = exp(x[352]);
+    k_f[353] = exp(x[353]);
+    k_f[354] = (x[354] == x[352] ? k_f[352] : exp(x[354]));
+    k_f[355] = exp(x[355]);
+    k_f[356] = exp(x[356]);
+    k_f[357] = exp(x[357]);
+    k_f[358] = exp(x[358]);
+    k_f[359] = exp(x[359]);
+    k_f[360] = exp(x[360]);
+    k_f[361] = exp(x[361]);
+    k_f[362] = exp(x[362]);
+    k_f[363] = exp(x[363]);
+    k_f[364] = exp(x[364]);
+    k_f[365] = (x[365] == 0.0 ? 1.0 : exp(x[365]));
+    k_f[366] = (x[366] == 0.0 ? 1.0 : exp(x[366]));
+    k_f[367] = (x[367] == 0.0 ? 1.0 : exp(x[367]));
+    k_f[368] = exp(x[368]);
+    k_f[369] = exp(x[369]);
+    k_f[370] = exp(x[370]);
+    k_f[371] = exp(x[371]);
+    k_f[372] = exp(x[372]);
+    k_f[373] = exp(x[373]);
+    k_f[374] = exp(x[374]);
+    k_f[375] = exp(x[375]);
+    k_f[376] = exp(x[376]);
+    k_f[377] = exp(x[377]);
+    k_f[378] = exp(x[378]);
+    k_f[379] = exp(x[379]);
+    k_f[380] = exp(x[380]);
+    k_f[381] = exp(x[381]);
+    k_f[382] = (x[382] == x[381] ? k_f[381] : exp(x[382]));
+    k_f[383] = (x[383] == x[381] ? k_f[381] : exp(x[383]));
+    k_f[384] = exp(x[384]);
+    k_f[385] = exp(x[385]);
+    k_f[386] = exp(x[386]);
+    k_f[387] = exp(x[387]);
+    k_f[388] = exp(x[388]);
+    k_f[389] = (x[389] == x[146] ? k_f[146] : exp(x[389]));
+    k_f[390] = exp(x[390]);
+    k_f[391] = exp(x[391]);
+    k_f[392] = (x[392] == x[298] ? k_f[298] : exp(x[392]));
+    k_f[393] = exp(x[393]);
+    k_f[394] = exp(x[394]);
+    k_f[395] = exp(x[395]);
+    k_f[396] = exp(x[396]);
+    k_f[397] = exp(x[397]);
+    k_f[398] = exp(x[398]);
+    k_f[399] = exp(x[399]);
+    k_f[400] = exp(x[400]);
+    k_f[401] = exp(x[401]);
+    k_f[402] = (x[402] == 0.0 ? 1.0 : exp(x[402]));
+    k_f[403] = (x[403] == 0.0 ? 1.0 : exp(x[403]));
+    k_f[404] = (x[404] == 0.0 ? 1.0 : exp(x[404]));
+    k_f[405] = (x[405] == 0.0 ? 1.0 : exp(x[405]));
+    k_f[406] = exp(x[406]);
+    k_f[407] = exp(x[407]);
+    k_f[408] = exp(x[408]);
+    k_f[409] = (x[409] == 0.0 ? 1.0 : exp(x[409]));
+    k_f[410] = (x[410] == 0.0 ? 1.0 : exp(x[410]));
+    k_f[411] = (x[411] == 0.0 ? 1.0 : exp(x[411]));
+    k_f[412] = (x[412] == 0.0 ? 1.0 : exp(x[412]));
+    k_f[413] = (x[413] == 0.0 ? 1.0 : exp(x[413]));
+    k_f[414] = (x[414] == 0.0 ? 1.0 : exp(x[414]));
+    k_f[415] = (x[415] == 0.0 ? 1.0 : exp(x[415]));
+    k_f[416] = exp(x[416]);
+    k_f[417] = (x[417] == x[416] ? k_f[416] : exp(x[417]));
+    k_f[418] = exp(x[418]);
+    k_f[419] = (x[419] == x[418] ? k_f[418] : exp(x[419]));
+    k_f[420] = (x[420] == x[416] ? k_f[416] : exp(x[420]));
+    k_f[421] = (x[421] == x[416] ? k_f[416] : exp(x[421]));
+    k_f[422] = (x[422] == x[144] ? k_f[144] : exp(x[422]));
+    k_f[423] = exp(x[423]);
+    k_f[424] = exp(x[424]);
+    k_f[425] = (x[425] == 0.0 ? 1.0 : exp(x[425]));
+    k_f[426] = (x[426] == 0.0 ? 1.0 : exp(x[426]));
+    k_f[427] = (x[427] == 0.0 ? 1.0 : exp(x[427]));
+    k_f[428] = (x[428] == 0.0 ? 1.0 : exp(x[428]));
+    k_f[429] = (x[429] == 0.0 ? 1.0 : exp(x[429]));
+    k_f[430] = (x[430] == 0.0 ? 1.0 : exp(x[430]));
+    k_f[431] = (x[431] == 0.0 ? 1.0 : exp(x[431]));
+    k_f[432] = exp(x[432]);
+    k_f[433] = (x[433] == 0.0 ? 1.0 : exp(x[433]));
+    k_f[434] = (x[434] == x[432] ? k_f[432] : exp(x[434]));
+    k_f[435] = exp(x[435]);
+    k_f[436] = exp(x[436]);
+    k_f[437] = exp(x[437]);
+    k_f[438] = exp(x[438]);
+    k_f[439] = (x[439] == x[438] ? k_f[438] : exp(x[439]));
+    k_f[440] = exp(x[440]);
+    k_f[441] = (x[441] == x[438] ? k_f[438] : exp(x[441]));
+    k_f[442] = (x[442] == x[440] ? k_f[440] : exp(x[442]));
+    k_f[443] = exp(x[443]);
+    k_f[444] = exp(x[444]);
+    k_f[445] = exp(x[445]);
+    k_f[446] = exp(x[446]);
+    k_f[447] = (x[447] == x[446] ? k_f[446] : exp(x[447]));
+    k_f[448] = (x[448] == 0.0 ? 1.0 : exp(x[448]));
+    k_f[449] = (x[449] == 0.0 ? 1.0 : exp(x[449]));
+    k_f[450] = (x[450] == x[77] ? k_f[77] : exp(x[450]));
+    k_f[451] = (x[451] == 0.0 ? 1.0 : exp(x[451]));
+    k_f[452] = (x[452] == 0.0 ? 1.0 : exp(x[452]));
+    k_f[453] = exp(x[453]);
+    k_f[454] = exp(x[454]);
+    k_f[455] = exp(x[455]);
+    k_f[456] = exp(x[456]);
+    k_f[457] = exp(x[457]);
+    k_f[458] = exp(x[458]);
+    k_f[459] = (x[459] == x[131] ? k_f[131] : exp(x[459]));
+    k_f[460] = exp(x[460]);
+    k_f[461] = exp(x[461]);
+    k_f[462] = exp(x[462]);
+    k_f[463] = (x[463] == x[462] ? k_f[462] : exp(x[463]));
+    k_f[464] = (x[464] == x[462] ? k_f[462] : exp(x[464]));
+    k_f[465] = (x[465] == x[462] ? k_f[462] : exp(x[465]));
+    k_f[466] = (x[466] == x[416] ? k_f[416] : exp(x[466]));
+    k_f[467] = (x[467] == 0.0 ? 1.0 : exp(x[467]));
+    k_f[468] = (x[468] == 0.0 ? 1.0 : exp(x[468]));
+    k_f[469] = (x[469] == 0.0 ? 1.0 : exp(x[469]));
+    k_f[470] = (x[470] == 0.0 ? 1.0 : exp(x[470]));
+    k_f[471] = exp(x[471]);
+    k_f[472] = exp(x[472]);
+    k_f[473] = (x[473] == 0.0 ? 1.0 : exp(x[473]));
+    k_f[474] = (x[474] == x[438] ? k_f[438] : exp(x[474]));
+    k_f[475] = exp(x[475]);
+    k_f[476] = exp(x[476]);
+    k_f[477] = exp(x[477]);
+    k_f[478] = exp(x[478]);
+    k_f[479] = exp(x[479]);
+    k_f[480] = exp(x[480]);
+    k_f[481] = exp(x[481]);
+    k_f[482] = (x[482] == x[144] ? k_f[144] : exp(x[482]));
+    k_f[483] = exp(x[483]);
+    k_f[484] = (x[484] == 0.0 ? 1.0 : exp(x[484]));
+    k_f[485] = (x[485] == 0.0 ? 1.0 : exp(x[485]));
+    k_f[486] = (x[486] == 0.0 ? 1.0 : exp(x[486]));
+    k_f[487] = exp(x[487]);
+    k_f[488] = exp(x[488]);
+    k_f[489] = exp(x[489]);
+    k_f[490] = exp(x[490]);
+    k_f[491] = exp(x[491]);
+    k_f[492] = exp(x[492]);
+    k_f[493] = (x[493] == x[144] ? k_f[144] : exp(x[493]));
+    k_f[494] = exp(x[494]);
+    k_f[495] = (x[495] == 0.0 ? 1.0 : exp(x[495]));
+    k_f[496] = (x[496] == 0.0 ? 1.0 : exp(x[496]));
+    k_f[497] = exp(x[497]);
+    k_f[498] = (x[498] == x[144] ? k_f[144] : exp(x[498]));
+    k_f[499] = (x[499] == 0.0 ? 1.0 : exp(x[499]));
+    k_f[500] = exp(x[500]);
+    k_f[501] = (x[501] == 0.0 ? 1.0 : exp(x[501]));
+    k_f[502] = (x[502] == 0.0 ? 1.0 : exp(x[502]));
+    k_f[503] = exp(x[503]);
+    k_f[504] = exp(x[504]);
+    k_f[505] = exp(x[505]);
+    k_f[506] = exp(x[506]);
+    k_f[507] = (x[507] == 0.0 ? 1.0 : exp(x[507]));
+    k_f[508] = exp(x[508]);
+    k_f[509] = exp(x[509]);
+    k_f[510] = (x[510] == x[164] ? k_f[164] : exp(x[510]));
+    k_f[511] = (x[511] == 0.0 ? 1.0 : exp(x[511]));
+    k_f[512] = exp(x[512]);
+    k_f[513] = (x[513] == x[462] ? k_f[462] : exp(x[513]));
+    k_f[514] = (x[514] == 0.0 ? 1.0 : exp(x[514]));
+    k_f[515] = (x[515] == 0.0 ? 1.0 : exp(x[515]));
+    k_f[516] = exp(x[516]);
+    k_f[517] = exp(x[517]);
+
+#ifdef __INTEL_COMPILER
+    #pragma simd
+#endif
+    for (int i=0; i<518; ++i) {
+        k_f[i] *= prefactor_units[i] * fwd_A[i];
     };
     return;
 }
@@ -25195,641 +25889,1172 @@ void comp_Kc(double * restrict tc, double invT, double * restrict Kc)
     double g_RT[72];
     gibbs(g_RT, tc);
 
-    Kc[0] = g_RT[1] + g_RT[10] - g_RT[12];
-    Kc[1] = g_RT[1] + g_RT[12] - g_RT[13];
-    Kc[2] = g_RT[1] + g_RT[16] - g_RT[17];
-    Kc[3] = g_RT[1] + g_RT[17] - g_RT[18];
-    Kc[4] = g_RT[1] + g_RT[17] - g_RT[19];
-    Kc[5] = g_RT[1] + g_RT[18] - g_RT[20];
-    Kc[6] = g_RT[1] + g_RT[19] - g_RT[20];
-    Kc[7] = g_RT[1] + g_RT[21] - g_RT[22];
-    Kc[8] = g_RT[1] + g_RT[22] - g_RT[23];
-    Kc[9] = g_RT[1] + g_RT[23] - g_RT[24];
-    Kc[10] = g_RT[1] + g_RT[24] - g_RT[25];
-    Kc[11] = g_RT[1] + g_RT[25] - g_RT[26];
-    Kc[12] = g_RT[0] + g_RT[14] - g_RT[17];
-    Kc[13] = 2*g_RT[4] - g_RT[7];
-    Kc[14] = g_RT[4] + g_RT[12] - g_RT[20];
-    Kc[15] = g_RT[9] + g_RT[14] - g_RT[27];
-    Kc[16] = g_RT[10] + g_RT[14] - g_RT[28];
-    Kc[17] = g_RT[5] + g_RT[11] - g_RT[20];
-    Kc[18] = 2*g_RT[12] - g_RT[26];
-    Kc[19] = -g_RT[0] - g_RT[22] + g_RT[24];
-    Kc[20] = g_RT[9] - g_RT[42] + g_RT[47];
-    Kc[21] = g_RT[0] + g_RT[9] - g_RT[12];
-    Kc[22] = g_RT[1] + g_RT[28] - g_RT[51];
-    Kc[23] = g_RT[12] + g_RT[25] - g_RT[50];
-    Kc[24] = g_RT[12] + g_RT[24] - g_RT[49];
-    Kc[25] = g_RT[1] + g_RT[49] - g_RT[50];
-    Kc[26] = g_RT[2] + g_RT[14] - g_RT[15];
-    Kc[27] = -g_RT[2] + g_RT[37] - g_RT[47];
-    Kc[28] = g_RT[1] + g_RT[40] - g_RT[41];
-    Kc[29] = -g_RT[11] - g_RT[53] + g_RT[56];
-    Kc[30] = -g_RT[54] + g_RT[64] - g_RT[65];
-    Kc[31] = -g_RT[54] + g_RT[62] - g_RT[64];
-    Kc[32] = 2*g_RT[2] - g_RT[3];
-    Kc[33] = g_RT[1] + g_RT[2] - g_RT[4];
-    Kc[34] = g_RT[1] + g_RT[3] - g_RT[6];
-    Kc[35] = -g_RT[0] + 2*g_RT[1];
-    Kc[36] = g_RT[1] + g_RT[4] - g_RT[5];
-    Kc[37] = -g_RT[1] - g_RT[14] + g_RT[16];
-    Kc[38] = g_RT[2] + g_RT[35] - g_RT[36];
-    Kc[39] = -g_RT[1] + g_RT[34] - g_RT[47];
-    Kc[40] = g_RT[1] + g_RT[35] - g_RT[38];
-    Kc[41] = -g_RT[14] - g_RT[30] + g_RT[46];
-    Kc[42] = -g_RT[1] - g_RT[39] + g_RT[40];
-    Kc[43] = -g_RT[14] - g_RT[31] + g_RT[45];
-    Kc[44] = g_RT[14] + g_RT[54] - g_RT[69];
-    Kc[45] = -g_RT[1] + g_RT[53] - g_RT[54];
-    Kc[46] = g_RT[53] - g_RT[57] + g_RT[63];
-    Kc[47] = -g_RT[53] + g_RT[58] - g_RT[64];
-    Kc[48] = -g_RT[54] + g_RT[59] - g_RT[62];
-    Kc[49] = -g_RT[54] + g_RT[66] - g_RT[67];
-    Kc[50] = -g_RT[14] - g_RT[53] + g_RT[68];
-    Kc[51] = g_RT[54] + g_RT[54] - g_RT[55];
-    Kc[52] = g_RT[0] - g_RT[1] + g_RT[2] - g_RT[4];
-    Kc[53] = g_RT[2] - g_RT[3] - g_RT[4] + g_RT[6];
-    Kc[54] = g_RT[2] - g_RT[4] - g_RT[6] + g_RT[7];
-    Kc[55] = -g_RT[1] + g_RT[2] + g_RT[9] - g_RT[14];
-    Kc[56] = -g_RT[1] + g_RT[2] + g_RT[10] - g_RT[16];
-    Kc[57] = -g_RT[0] + g_RT[2] + g_RT[11] - g_RT[14];
-    Kc[58] = -g_RT[1] + g_RT[2] + g_RT[11] - g_RT[16];
-    Kc[59] = -g_RT[1] + g_RT[2] + g_RT[12] - g_RT[17];
-    Kc[60] = g_RT[2] - g_RT[4] - g_RT[12] + g_RT[13];
-    Kc[61] = g_RT[2] - g_RT[4] - g_RT[14] + g_RT[16];
-    Kc[62] = -g_RT[1] + g_RT[2] - g_RT[15] + g_RT[16];
-    Kc[63] = g_RT[2] - g_RT[4] - g_RT[16] + g_RT[17];
-    Kc[64] = g_RT[2] - g_RT[4] - g_RT[17] + g_RT[18];
-    Kc[65] = g_RT[2] - g_RT[4] - g_RT[17] + g_RT[19];
-    Kc[66] = g_RT[2] - g_RT[4] - g_RT[18] + g_RT[20];
-    Kc[67] = g_RT[2] - g_RT[4] - g_RT[19] + g_RT[20];
-    Kc[68] = g_RT[2] - g_RT[9] - g_RT[14] + g_RT[21];
-    Kc[69] = -g_RT[1] + g_RT[2] + g_RT[22] - g_RT[27];
-    Kc[70] = g_RT[2] - g_RT[4] - g_RT[21] + g_RT[22];
-    Kc[71] = g_RT[2] - g_RT[10] - g_RT[14] + g_RT[22];
-    Kc[72] = -g_RT[1] + g_RT[2] + g_RT[23] - g_RT[28];
-    Kc[73] = g_RT[2] - g_RT[12] - g_RT[16] + g_RT[24];
-    Kc[74] = g_RT[2] - g_RT[12] - g_RT[17] + g_RT[25];
-    Kc[75] = g_RT[2] - g_RT[4] - g_RT[25] + g_RT[26];
-    Kc[76] = -g_RT[1] + g_RT[2] - 2*g_RT[14] + g_RT[27];
-    Kc[77] = g_RT[2] - g_RT[4] - g_RT[27] + g_RT[28];
-    Kc[78] = g_RT[2] - g_RT[10] - g_RT[15] + g_RT[28];
-    Kc[79] = -g_RT[2] + g_RT[3] + g_RT[14] - g_RT[15];
-    Kc[80] = g_RT[3] - g_RT[6] - g_RT[16] + g_RT[17];
-    Kc[81] = g_RT[1] + 2*g_RT[3] - g_RT[3] - g_RT[6];
-    Kc[82] = g_RT[1] + g_RT[3] + g_RT[5] - g_RT[5] - g_RT[6];
-    Kc[83] = g_RT[1] + g_RT[3] - g_RT[6] + g_RT[47] - g_RT[47];
-    Kc[84] = g_RT[1] + g_RT[3] - g_RT[6] + g_RT[48] - g_RT[48];
-    Kc[85] = g_RT[1] - g_RT[2] + g_RT[3] - g_RT[4];
-    Kc[86] = g_RT[0] - 2*g_RT[0] + 2*g_RT[1];
-    Kc[87] = -g_RT[0] + 2*g_RT[1] + g_RT[5] - g_RT[5];
-    Kc[88] = -g_RT[0] + 2*g_RT[1] + g_RT[15] - g_RT[15];
-    Kc[89] = g_RT[1] - g_RT[2] - g_RT[5] + g_RT[6];
-    Kc[90] = -g_RT[0] + g_RT[1] - g_RT[3] + g_RT[6];
-    Kc[91] = g_RT[1] - 2*g_RT[4] + g_RT[6];
-    Kc[92] = -g_RT[0] + g_RT[1] - g_RT[6] + g_RT[7];
-    Kc[93] = g_RT[1] - g_RT[4] - g_RT[5] + g_RT[7];
-    Kc[94] = -g_RT[0] + g_RT[1] - g_RT[8] + g_RT[9];
-    Kc[95] = -g_RT[0] + g_RT[1] - g_RT[9] + g_RT[11];
-    Kc[96] = -g_RT[0] + g_RT[1] - g_RT[12] + g_RT[13];
-    Kc[97] = -g_RT[0] + g_RT[1] - g_RT[14] + g_RT[16];
-    Kc[98] = -g_RT[0] + g_RT[1] - g_RT[16] + g_RT[17];
-    Kc[99] = -g_RT[0] + g_RT[1] - g_RT[17] + g_RT[18];
-    Kc[100] = g_RT[1] - g_RT[4] - g_RT[12] + g_RT[18];
-    Kc[101] = g_RT[1] - g_RT[5] - g_RT[11] + g_RT[18];
-    Kc[102] = g_RT[1] - g_RT[1] - g_RT[18] + g_RT[19];
-    Kc[103] = -g_RT[0] + g_RT[1] - g_RT[17] + g_RT[19];
-    Kc[104] = g_RT[1] - g_RT[4] - g_RT[12] + g_RT[19];
-    Kc[105] = g_RT[1] - g_RT[5] - g_RT[11] + g_RT[19];
-    Kc[106] = -g_RT[0] + g_RT[1] - g_RT[18] + g_RT[20];
-    Kc[107] = -g_RT[0] + g_RT[1] - g_RT[19] + g_RT[20];
-    Kc[108] = -g_RT[0] + g_RT[1] - g_RT[22] + g_RT[23];
-    Kc[109] = -g_RT[0] + g_RT[1] - g_RT[23] + g_RT[24];
-    Kc[110] = -g_RT[0] + g_RT[1] - g_RT[24] + g_RT[25];
-    Kc[111] = -g_RT[0] + g_RT[1] - g_RT[25] + g_RT[26];
-    Kc[112] = g_RT[1] - g_RT[11] - g_RT[14] + g_RT[27];
-    Kc[113] = -g_RT[0] + g_RT[1] - g_RT[27] + g_RT[28];
-    Kc[114] = g_RT[1] - g_RT[12] - g_RT[14] + g_RT[28];
-    Kc[115] = g_RT[1] - g_RT[1] - g_RT[28] + g_RT[29];
-    Kc[116] = g_RT[0] - g_RT[1] + g_RT[4] - g_RT[5];
-    Kc[117] = -g_RT[2] + 2*g_RT[4] - g_RT[5];
-    Kc[118] = -g_RT[3] + g_RT[4] - g_RT[5] + g_RT[6];
-    Kc[119] = g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7];
-    Kc[120] = g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7];
-    Kc[121] = -g_RT[1] + g_RT[4] + g_RT[8] - g_RT[14];
-    Kc[122] = -g_RT[1] + g_RT[4] + g_RT[9] - g_RT[16];
-    Kc[123] = -g_RT[1] + g_RT[4] + g_RT[10] - g_RT[17];
-    Kc[124] = g_RT[4] - g_RT[5] - g_RT[9] + g_RT[10];
-    Kc[125] = -g_RT[1] + g_RT[4] + g_RT[11] - g_RT[17];
-    Kc[126] = g_RT[4] - g_RT[5] - g_RT[10] + g_RT[12];
-    Kc[127] = g_RT[4] - g_RT[5] - g_RT[11] + g_RT[12];
-    Kc[128] = g_RT[4] - g_RT[5] - g_RT[12] + g_RT[13];
-    Kc[129] = -g_RT[1] + g_RT[4] + g_RT[14] - g_RT[15];
-    Kc[130] = g_RT[4] - g_RT[5] - g_RT[14] + g_RT[16];
-    Kc[131] = g_RT[4] - g_RT[5] - g_RT[16] + g_RT[17];
-    Kc[132] = g_RT[4] - g_RT[5] - g_RT[17] + g_RT[18];
-    Kc[133] = g_RT[4] - g_RT[5] - g_RT[17] + g_RT[19];
-    Kc[134] = g_RT[4] - g_RT[5] - g_RT[18] + g_RT[20];
-    Kc[135] = g_RT[4] - g_RT[5] - g_RT[19] + g_RT[20];
-    Kc[136] = -g_RT[1] + g_RT[4] + g_RT[21] - g_RT[27];
-    Kc[137] = -g_RT[1] + g_RT[4] + g_RT[22] - g_RT[28];
-    Kc[138] = -g_RT[1] + g_RT[4] + g_RT[22] - g_RT[29];
-    Kc[139] = g_RT[4] - g_RT[5] - g_RT[21] + g_RT[22];
-    Kc[140] = g_RT[4] - g_RT[12] - g_RT[14] + g_RT[22];
-    Kc[141] = g_RT[4] - g_RT[5] - g_RT[22] + g_RT[23];
-    Kc[142] = g_RT[4] - g_RT[5] - g_RT[23] + g_RT[24];
-    Kc[143] = g_RT[4] - g_RT[5] - g_RT[25] + g_RT[26];
-    Kc[144] = g_RT[4] - g_RT[5] - g_RT[27] + g_RT[28];
-    Kc[145] = -g_RT[3] + 2*g_RT[6] - g_RT[7];
-    Kc[146] = -g_RT[3] + 2*g_RT[6] - g_RT[7];
-    Kc[147] = -g_RT[4] + g_RT[6] + g_RT[10] - g_RT[17];
-    Kc[148] = -g_RT[3] + g_RT[6] + g_RT[12] - g_RT[13];
-    Kc[149] = -g_RT[4] + g_RT[6] + g_RT[12] - g_RT[19];
-    Kc[150] = -g_RT[4] + g_RT[6] + g_RT[14] - g_RT[15];
-    Kc[151] = g_RT[6] - g_RT[7] - g_RT[16] + g_RT[17];
-    Kc[152] = -g_RT[2] + g_RT[3] + g_RT[8] - g_RT[14];
-    Kc[153] = -g_RT[1] + g_RT[8] + g_RT[10] - g_RT[21];
-    Kc[154] = -g_RT[1] + g_RT[8] + g_RT[12] - g_RT[22];
-    Kc[155] = -g_RT[2] + g_RT[3] + g_RT[9] - g_RT[16];
-    Kc[156] = g_RT[0] - g_RT[1] + g_RT[9] - g_RT[10];
-    Kc[157] = -g_RT[1] + g_RT[5] + g_RT[9] - g_RT[17];
-    Kc[158] = -g_RT[1] + g_RT[9] + g_RT[10] - g_RT[22];
-    Kc[159] = -g_RT[1] + g_RT[9] + g_RT[12] - g_RT[23];
-    Kc[160] = -g_RT[1] + g_RT[9] + g_RT[13] - g_RT[24];
-    Kc[161] = g_RT[9] - g_RT[14] + g_RT[15] - g_RT[16];
-    Kc[162] = -g_RT[1] + g_RT[9] + g_RT[17] - g_RT[28];
-    Kc[163] = g_RT[9] - g_RT[14] - g_RT[22] + g_RT[27];
-    Kc[164] = -g_RT[1] + g_RT[3] - g_RT[4] + g_RT[10] - g_RT[14];
-    Kc[165] = g_RT[0] - g_RT[1] + g_RT[10] - g_RT[12];
-    Kc[166] = -g_RT[0] + 2*g_RT[10] - g_RT[22];
-    Kc[167] = -g_RT[1] + g_RT[10] + g_RT[12] - g_RT[24];
-    Kc[168] = g_RT[10] - 2*g_RT[12] + g_RT[13];
-    Kc[169] = g_RT[10] - g_RT[14] - g_RT[23] + g_RT[27];
-    Kc[170] = -g_RT[10] + g_RT[11] + g_RT[47] - g_RT[47];
-    Kc[171] = -g_RT[10] + g_RT[11] + g_RT[48] - g_RT[48];
-    Kc[172] = -g_RT[1] + g_RT[3] - g_RT[4] + g_RT[11] - g_RT[14];
-    Kc[173] = g_RT[3] - g_RT[5] + g_RT[11] - g_RT[14];
-    Kc[174] = g_RT[0] - g_RT[1] + g_RT[11] - g_RT[12];
-    Kc[175] = g_RT[5] - g_RT[5] - g_RT[10] + g_RT[11];
-    Kc[176] = -g_RT[1] + g_RT[11] + g_RT[12] - g_RT[24];
-    Kc[177] = g_RT[11] - 2*g_RT[12] + g_RT[13];
-    Kc[178] = -g_RT[10] + g_RT[11] + g_RT[14] - g_RT[14];
-    Kc[179] = -g_RT[10] + g_RT[11] + g_RT[15] - g_RT[15];
-    Kc[180] = g_RT[11] - g_RT[14] + g_RT[15] - g_RT[17];
-    Kc[181] = g_RT[11] - g_RT[12] - g_RT[25] + g_RT[26];
-    Kc[182] = -g_RT[2] + g_RT[3] + g_RT[12] - g_RT[19];
-    Kc[183] = g_RT[3] - g_RT[4] + g_RT[12] - g_RT[17];
-    Kc[184] = -g_RT[6] + g_RT[7] + g_RT[12] - g_RT[13];
-    Kc[185] = -g_RT[1] + 2*g_RT[12] - g_RT[25];
-    Kc[186] = g_RT[12] - g_RT[13] - g_RT[14] + g_RT[16];
-    Kc[187] = g_RT[12] - g_RT[13] - g_RT[16] + g_RT[17];
-    Kc[188] = g_RT[12] - g_RT[13] - g_RT[18] + g_RT[20];
-    Kc[189] = g_RT[12] - g_RT[13] - g_RT[19] + g_RT[20];
-    Kc[190] = g_RT[12] - g_RT[13] - g_RT[23] + g_RT[24];
-    Kc[191] = g_RT[12] - g_RT[13] - g_RT[25] + g_RT[26];
-    Kc[192] = -g_RT[1] + g_RT[5] - g_RT[5] - g_RT[14] + g_RT[16];
-    Kc[193] = g_RT[3] - g_RT[6] - g_RT[14] + g_RT[16];
-    Kc[194] = g_RT[3] - g_RT[6] - g_RT[17] + g_RT[18];
-    Kc[195] = g_RT[3] - g_RT[6] - g_RT[17] + g_RT[19];
-    Kc[196] = g_RT[3] - g_RT[14] - g_RT[16] + g_RT[21];
-    Kc[197] = g_RT[0] - g_RT[1] + g_RT[21] - g_RT[22];
-    Kc[198] = g_RT[3] - g_RT[16] - g_RT[17] + g_RT[23];
-    Kc[199] = g_RT[3] - g_RT[6] - g_RT[24] + g_RT[25];
-    Kc[200] = g_RT[3] - g_RT[4] - 2*g_RT[14] + g_RT[27];
-    Kc[201] = -2*g_RT[14] - g_RT[22] + 2*g_RT[27];
-    Kc[202] = -g_RT[2] + g_RT[30] + g_RT[35] - g_RT[47];
-    Kc[203] = -g_RT[2] + g_RT[3] + g_RT[30] - g_RT[35];
-    Kc[204] = -g_RT[1] + g_RT[4] + g_RT[30] - g_RT[35];
-    Kc[205] = g_RT[2] - g_RT[3] + g_RT[37] - g_RT[47];
-    Kc[206] = g_RT[2] - 2*g_RT[35] + g_RT[37];
-    Kc[207] = g_RT[1] - g_RT[4] + g_RT[37] - g_RT[47];
-    Kc[208] = g_RT[4] - g_RT[6] + g_RT[37] - g_RT[47];
-    Kc[209] = -g_RT[4] + g_RT[6] + g_RT[35] - g_RT[36];
-    Kc[210] = g_RT[2] - g_RT[3] - g_RT[35] + g_RT[36];
-    Kc[211] = g_RT[1] - g_RT[4] - g_RT[35] + g_RT[36];
-    Kc[212] = -g_RT[1] + g_RT[2] + g_RT[31] - g_RT[35];
-    Kc[213] = -g_RT[0] + g_RT[1] - g_RT[30] + g_RT[31];
-    Kc[214] = -g_RT[1] + g_RT[4] + g_RT[31] - g_RT[38];
-    Kc[215] = g_RT[4] - g_RT[5] - g_RT[30] + g_RT[31];
-    Kc[216] = -g_RT[2] + g_RT[3] + g_RT[31] - g_RT[38];
-    Kc[217] = g_RT[3] - g_RT[4] + g_RT[31] - g_RT[35];
-    Kc[218] = -g_RT[1] + g_RT[30] + g_RT[31] - g_RT[47];
-    Kc[219] = -g_RT[0] + g_RT[5] + g_RT[31] - g_RT[38];
-    Kc[220] = -g_RT[4] + g_RT[31] + g_RT[35] - g_RT[47];
-    Kc[221] = -g_RT[1] + g_RT[31] + g_RT[35] - g_RT[37];
-    Kc[222] = g_RT[2] - g_RT[4] - g_RT[31] + g_RT[32];
-    Kc[223] = -g_RT[1] + g_RT[2] + g_RT[32] - g_RT[38];
-    Kc[224] = -g_RT[0] + g_RT[1] - g_RT[31] + g_RT[32];
-    Kc[225] = g_RT[4] - g_RT[5] - g_RT[31] + g_RT[32];
-    Kc[226] = -g_RT[1] + g_RT[34] - g_RT[47];
-    Kc[227] = g_RT[3] - g_RT[6] + g_RT[34] - g_RT[47];
-    Kc[228] = g_RT[2] - g_RT[4] + g_RT[34] - g_RT[47];
-    Kc[229] = g_RT[2] - g_RT[31] + g_RT[34] - g_RT[35];
-    Kc[230] = -g_RT[0] + g_RT[1] + g_RT[34] - g_RT[47];
-    Kc[231] = g_RT[4] - g_RT[5] + g_RT[34] - g_RT[47];
-    Kc[232] = g_RT[12] - g_RT[13] + g_RT[34] - g_RT[47];
-    Kc[233] = g_RT[2] - g_RT[4] - g_RT[35] + g_RT[38];
-    Kc[234] = -g_RT[0] + g_RT[1] - g_RT[35] + g_RT[38];
-    Kc[235] = g_RT[4] - g_RT[5] - g_RT[35] + g_RT[38];
-    Kc[236] = g_RT[3] - g_RT[6] - g_RT[35] + g_RT[38];
-    Kc[237] = g_RT[2] - g_RT[14] - g_RT[30] + g_RT[39];
-    Kc[238] = -g_RT[1] + g_RT[4] + g_RT[39] - g_RT[46];
-    Kc[239] = -g_RT[4] + g_RT[5] + g_RT[39] - g_RT[40];
-    Kc[240] = -g_RT[2] + g_RT[3] + g_RT[39] - g_RT[46];
-    Kc[241] = g_RT[0] - g_RT[1] + g_RT[39] - g_RT[40];
-    Kc[242] = g_RT[2] - g_RT[14] - g_RT[35] + g_RT[46];
-    Kc[243] = g_RT[1] - g_RT[14] - g_RT[31] + g_RT[46];
-    Kc[244] = -g_RT[1] + g_RT[4] - g_RT[14] - g_RT[35] + g_RT[46];
-    Kc[245] = -g_RT[14] + g_RT[30] + g_RT[46] - g_RT[47];
-    Kc[246] = g_RT[3] - g_RT[15] - g_RT[35] + g_RT[46];
-    Kc[247] = -g_RT[14] + g_RT[35] - g_RT[37] + g_RT[46];
-    Kc[248] = -g_RT[15] + g_RT[35] + g_RT[46] - g_RT[47];
-    Kc[249] = -g_RT[1] + g_RT[2] + g_RT[40] - g_RT[46];
-    Kc[250] = g_RT[2] - g_RT[14] - g_RT[31] + g_RT[40];
-    Kc[251] = g_RT[2] - g_RT[4] - g_RT[39] + g_RT[40];
-    Kc[252] = -g_RT[1] + g_RT[4] + g_RT[40] - g_RT[44];
-    Kc[253] = -g_RT[1] + g_RT[4] + g_RT[40] - g_RT[45];
-    Kc[254] = g_RT[4] - g_RT[14] - g_RT[32] + g_RT[40];
-    Kc[255] = -g_RT[10] + g_RT[30] + g_RT[41] - g_RT[47];
-    Kc[256] = g_RT[8] - g_RT[30] - g_RT[39] + g_RT[47];
-    Kc[257] = g_RT[9] - g_RT[30] - g_RT[40] + g_RT[47];
-    Kc[258] = g_RT[10] - g_RT[31] - g_RT[40] + g_RT[47];
-    Kc[259] = g_RT[11] - g_RT[31] - g_RT[40] + g_RT[47];
-    Kc[260] = -g_RT[2] + g_RT[8] + g_RT[35] - g_RT[39];
-    Kc[261] = g_RT[8] - g_RT[14] - g_RT[30] + g_RT[35];
-    Kc[262] = -g_RT[2] + g_RT[9] + g_RT[35] - g_RT[40];
-    Kc[263] = -g_RT[1] + g_RT[9] + g_RT[35] - g_RT[46];
-    Kc[264] = g_RT[9] - g_RT[16] - g_RT[30] + g_RT[35];
-    Kc[265] = -g_RT[1] + g_RT[10] + g_RT[35] - g_RT[45];
-    Kc[266] = -g_RT[4] + g_RT[10] + g_RT[35] - g_RT[40];
-    Kc[267] = -g_RT[1] + g_RT[10] + g_RT[35] - g_RT[43];
-    Kc[268] = -g_RT[1] + g_RT[11] + g_RT[35] - g_RT[45];
-    Kc[269] = -g_RT[4] + g_RT[11] + g_RT[35] - g_RT[40];
-    Kc[270] = -g_RT[1] + g_RT[11] + g_RT[35] - g_RT[43];
-    Kc[271] = -g_RT[5] + g_RT[12] + g_RT[35] - g_RT[40];
-    Kc[272] = -g_RT[4] + g_RT[12] + g_RT[35] - g_RT[41];
-    Kc[273] = -g_RT[1] + g_RT[2] - g_RT[14] + g_RT[42] - g_RT[47];
-    Kc[274] = g_RT[2] - g_RT[35] - g_RT[40] + g_RT[42];
-    Kc[275] = -g_RT[2] + g_RT[3] - g_RT[16] + g_RT[42] - g_RT[47];
-    Kc[276] = -g_RT[1] + g_RT[4] - g_RT[16] + g_RT[42] - g_RT[47];
-    Kc[277] = g_RT[1] - g_RT[10] + g_RT[42] - g_RT[47];
-    Kc[278] = g_RT[2] - g_RT[15] - g_RT[31] + g_RT[45];
-    Kc[279] = g_RT[2] - g_RT[14] - g_RT[38] + g_RT[45];
-    Kc[280] = g_RT[2] - g_RT[4] + g_RT[45] - g_RT[46];
-    Kc[281] = g_RT[1] - g_RT[14] - g_RT[32] + g_RT[45];
-    Kc[282] = -g_RT[0] + g_RT[1] + g_RT[45] - g_RT[46];
-    Kc[283] = g_RT[4] - g_RT[5] + g_RT[45] - g_RT[46];
-    Kc[284] = g_RT[4] - g_RT[15] - g_RT[32] + g_RT[45];
-    Kc[285] = g_RT[1] - g_RT[1] + g_RT[43] - g_RT[45];
-    Kc[286] = g_RT[1] - g_RT[4] - g_RT[40] + g_RT[43];
-    Kc[287] = g_RT[1] - g_RT[14] - g_RT[32] + g_RT[43];
-    Kc[288] = g_RT[1] - g_RT[1] + g_RT[44] - g_RT[45];
-    Kc[289] = -g_RT[14] + g_RT[27] + g_RT[35] - g_RT[43];
-    Kc[290] = -g_RT[1] + g_RT[12] + g_RT[30] - g_RT[41];
-    Kc[291] = -g_RT[0] + g_RT[12] + g_RT[30] - g_RT[40];
-    Kc[292] = -g_RT[0] + g_RT[1] - g_RT[32] + g_RT[33];
-    Kc[293] = g_RT[4] - g_RT[5] - g_RT[32] + g_RT[33];
-    Kc[294] = g_RT[2] - g_RT[4] - g_RT[32] + g_RT[33];
-    Kc[295] = -g_RT[14] + g_RT[15] + g_RT[31] - g_RT[38];
-    Kc[296] = -g_RT[35] + g_RT[36] + g_RT[39] - g_RT[46];
-    Kc[297] = -g_RT[15] + g_RT[36] - g_RT[37] + g_RT[46];
-    Kc[298] = -g_RT[14] + g_RT[15] + g_RT[30] - g_RT[35];
-    Kc[299] = -g_RT[0] - g_RT[1] + g_RT[2] + g_RT[12] - g_RT[14];
-    Kc[300] = -g_RT[1] + g_RT[2] + g_RT[24] - g_RT[51];
-    Kc[301] = -g_RT[1] + g_RT[2] + g_RT[25] - g_RT[52];
-    Kc[302] = -g_RT[3] + g_RT[4] - g_RT[5] + g_RT[6];
-    Kc[303] = -g_RT[0] + g_RT[4] + g_RT[12] - g_RT[17];
-    Kc[304] = -2*g_RT[1] + g_RT[3] + g_RT[10] - g_RT[15];
-    Kc[305] = -g_RT[2] + g_RT[3] + g_RT[10] - g_RT[17];
-    Kc[306] = -2*g_RT[1] + g_RT[10] + g_RT[10] - g_RT[22];
-    Kc[307] = -g_RT[0] + g_RT[5] + g_RT[11] - g_RT[17];
-    Kc[308] = -g_RT[2] + g_RT[3] + g_RT[23] - g_RT[51];
-    Kc[309] = g_RT[3] - g_RT[6] - g_RT[22] + g_RT[23];
-    Kc[310] = g_RT[2] - g_RT[4] - g_RT[51] + g_RT[52];
-    Kc[311] = g_RT[2] - g_RT[4] - g_RT[12] - g_RT[14] + g_RT[52];
-    Kc[312] = g_RT[3] - g_RT[6] - g_RT[12] - g_RT[14] + g_RT[52];
-    Kc[313] = -g_RT[0] + g_RT[1] - g_RT[51] + g_RT[52];
-    Kc[314] = -g_RT[0] + g_RT[1] - g_RT[12] - g_RT[14] + g_RT[52];
-    Kc[315] = g_RT[4] - g_RT[5] - g_RT[12] - g_RT[14] + g_RT[52];
-    Kc[316] = g_RT[6] - g_RT[7] - g_RT[12] - g_RT[14] + g_RT[52];
-    Kc[317] = g_RT[12] - g_RT[12] - g_RT[13] - g_RT[14] + g_RT[52];
-    Kc[318] = -g_RT[1] + g_RT[2] - g_RT[10] - g_RT[15] + g_RT[51];
-    Kc[319] = g_RT[3] - g_RT[4] - g_RT[14] - g_RT[17] + g_RT[51];
-    Kc[320] = g_RT[3] - g_RT[4] - 2*g_RT[16] + g_RT[51];
-    Kc[321] = g_RT[1] - g_RT[12] - g_RT[16] + g_RT[51];
-    Kc[322] = -g_RT[0] + g_RT[1] - g_RT[28] + g_RT[51];
-    Kc[323] = g_RT[4] - g_RT[5] - g_RT[28] + g_RT[51];
-    Kc[324] = g_RT[4] - g_RT[16] - g_RT[18] + g_RT[51];
-    Kc[325] = g_RT[2] - g_RT[4] - g_RT[49] + g_RT[50];
-    Kc[326] = -g_RT[0] + g_RT[1] - g_RT[49] + g_RT[50];
-    Kc[327] = g_RT[4] - g_RT[5] - g_RT[49] + g_RT[50];
-    Kc[328] = -g_RT[6] + g_RT[7] + g_RT[49] - g_RT[50];
-    Kc[329] = g_RT[12] - g_RT[13] - g_RT[49] + g_RT[50];
-    Kc[330] = g_RT[2] - g_RT[17] - g_RT[25] + g_RT[49];
-    Kc[331] = g_RT[1] - g_RT[12] - g_RT[25] + g_RT[49];
-    Kc[332] = g_RT[4] - g_RT[18] - g_RT[25] + g_RT[49];
-    Kc[333] = -g_RT[3] + g_RT[6] + g_RT[49] - g_RT[50];
-    Kc[334] = -g_RT[4] + g_RT[6] - g_RT[17] - g_RT[25] + g_RT[49];
-    Kc[335] = g_RT[12] - 2*g_RT[25] + g_RT[49];
-    Kc[336] = g_RT[1] - g_RT[11] - g_RT[53] + g_RT[60];
-    Kc[337] = -g_RT[0] + g_RT[1] + g_RT[60] - g_RT[63];
-    Kc[338] = -g_RT[0] + g_RT[1] + g_RT[58] - g_RT[62];
-    Kc[339] = g_RT[1] - g_RT[54] - g_RT[57] + g_RT[58];
-    Kc[340] = g_RT[1] - g_RT[9] - g_RT[53] + g_RT[63];
-    Kc[341] = -g_RT[0] + g_RT[1] + g_RT[63] - g_RT[65];
-    Kc[342] = -g_RT[0] + g_RT[9] + g_RT[53] - g_RT[65];
-    Kc[343] = g_RT[1] - g_RT[14] - g_RT[53] + g_RT[69];
-    Kc[344] = -g_RT[1] + g_RT[2] + g_RT[60] - g_RT[68];
-    Kc[345] = -g_RT[1] + g_RT[2] + g_RT[61] - g_RT[67];
-    Kc[346] = g_RT[2] - g_RT[54] + g_RT[62] - g_RT[67];
-    Kc[347] = g_RT[4] - g_RT[17] - g_RT[53] + g_RT[60];
-    Kc[348] = g_RT[4] - g_RT[53] + g_RT[61] - g_RT[68];
-    Kc[349] = g_RT[4] - g_RT[53] + g_RT[62] - g_RT[67];
-    Kc[350] = g_RT[0] - g_RT[1] - g_RT[53] + g_RT[54];
-    Kc[351] = -g_RT[2] + g_RT[4] - g_RT[53] + g_RT[54];
-    Kc[352] = -g_RT[3] + g_RT[6] - g_RT[53] + g_RT[54];
-    Kc[353] = -g_RT[4] + g_RT[5] - g_RT[53] + g_RT[54];
-    Kc[354] = -g_RT[6] + g_RT[7] - g_RT[53] + g_RT[54];
-    Kc[355] = g_RT[0] - g_RT[56] + g_RT[63];
-    Kc[356] = g_RT[1] - g_RT[56] + g_RT[60];
-    Kc[357] = g_RT[0] - g_RT[57] + g_RT[64];
-    Kc[358] = g_RT[1] - g_RT[57] + g_RT[61];
-    Kc[359] = -g_RT[0] + g_RT[11] + g_RT[53] - g_RT[63];
-    Kc[360] = -g_RT[11] + g_RT[12] - g_RT[53] + g_RT[54];
-    Kc[361] = -g_RT[1] + g_RT[12] + g_RT[54] - g_RT[60];
-    Kc[362] = -g_RT[0] + g_RT[53] + g_RT[63] - g_RT[64];
-    Kc[363] = g_RT[1] - g_RT[53] + g_RT[61] - g_RT[63];
-    Kc[364] = -g_RT[0] + g_RT[1] + g_RT[61] - g_RT[64];
-    Kc[365] = -g_RT[53] + g_RT[54] + g_RT[60] - g_RT[63];
-    Kc[366] = g_RT[1] - g_RT[53] + g_RT[62] - g_RT[64];
-    Kc[367] = -g_RT[53] + g_RT[54] + g_RT[61] - g_RT[64];
-    Kc[368] = -g_RT[0] + g_RT[1] + g_RT[56] - g_RT[60];
-    Kc[369] = -g_RT[0] + g_RT[1] + g_RT[57] - g_RT[61];
-    Kc[370] = g_RT[1] - g_RT[12] - g_RT[53] + g_RT[56];
-    Kc[371] = g_RT[1] - g_RT[53] + g_RT[57] - g_RT[60];
-    Kc[372] = g_RT[1] - g_RT[53] + g_RT[58] - g_RT[61];
-    Kc[373] = g_RT[1] - g_RT[53] + g_RT[59] - g_RT[62];
-    Kc[374] = g_RT[1] - g_RT[54] - g_RT[58] + g_RT[59];
-    Kc[375] = g_RT[2] - g_RT[4] + g_RT[56] - g_RT[60];
-    Kc[376] = g_RT[2] - g_RT[4] + g_RT[57] - g_RT[61];
-    Kc[377] = g_RT[2] - g_RT[4] + g_RT[58] - g_RT[62];
-    Kc[378] = g_RT[4] - g_RT[5] + g_RT[56] - g_RT[60];
-    Kc[379] = g_RT[4] - g_RT[5] + g_RT[57] - g_RT[61];
-    Kc[380] = g_RT[4] - g_RT[5] + g_RT[58] - g_RT[62];
-    Kc[381] = -g_RT[6] + g_RT[7] - g_RT[56] + g_RT[60];
-    Kc[382] = -g_RT[6] + g_RT[7] - g_RT[57] + g_RT[61];
-    Kc[383] = -g_RT[6] + g_RT[7] - g_RT[58] + g_RT[62];
-    Kc[384] = g_RT[12] - g_RT[13] + g_RT[56] - g_RT[60];
-    Kc[385] = g_RT[12] - g_RT[13] + g_RT[57] - g_RT[61];
-    Kc[386] = -g_RT[12] + g_RT[13] - g_RT[58] + g_RT[62];
-    Kc[387] = g_RT[23] - g_RT[24] + g_RT[56] - g_RT[60];
-    Kc[388] = g_RT[23] - g_RT[24] + g_RT[57] - g_RT[61];
-    Kc[389] = -g_RT[23] + g_RT[24] - g_RT[58] + g_RT[62];
-    Kc[390] = g_RT[56] - g_RT[58] - g_RT[60] + g_RT[62];
-    Kc[391] = -g_RT[56] + g_RT[57] + g_RT[60] - g_RT[61];
-    Kc[392] = g_RT[57] - g_RT[58] - g_RT[61] + g_RT[62];
-    Kc[393] = -g_RT[19] + g_RT[20] - g_RT[56] + g_RT[60];
-    Kc[394] = -g_RT[19] + g_RT[20] - g_RT[57] + g_RT[61];
-    Kc[395] = -g_RT[19] + g_RT[20] - g_RT[58] + g_RT[62];
-    Kc[396] = -g_RT[18] + g_RT[20] - g_RT[56] + g_RT[60];
-    Kc[397] = -g_RT[18] + g_RT[20] - g_RT[57] + g_RT[61];
-    Kc[398] = -g_RT[18] + g_RT[20] - g_RT[58] + g_RT[62];
-    Kc[399] = -g_RT[16] + g_RT[17] - g_RT[56] + g_RT[60];
-    Kc[400] = -g_RT[16] + g_RT[17] - g_RT[57] + g_RT[61];
-    Kc[401] = -g_RT[16] + g_RT[17] - g_RT[58] + g_RT[62];
-    Kc[402] = -g_RT[14] + g_RT[16] - g_RT[56] + g_RT[60];
-    Kc[403] = -g_RT[14] + g_RT[16] - g_RT[57] + g_RT[61];
-    Kc[404] = -g_RT[14] + g_RT[16] - g_RT[58] + g_RT[62];
-    Kc[405] = g_RT[16] - g_RT[28] - g_RT[53] + g_RT[60];
-    Kc[406] = -g_RT[1] - g_RT[2] + g_RT[3] + g_RT[60] - g_RT[68];
-    Kc[407] = -g_RT[1] - g_RT[2] + g_RT[3] + g_RT[61] - g_RT[67];
-    Kc[408] = -g_RT[2] + g_RT[3] + g_RT[62] - g_RT[66];
-    Kc[409] = -g_RT[1] - g_RT[4] + g_RT[6] + g_RT[60] - g_RT[68];
-    Kc[410] = -g_RT[1] - g_RT[4] + g_RT[6] + g_RT[61] - g_RT[67];
-    Kc[411] = -g_RT[4] + g_RT[6] + g_RT[62] - g_RT[66];
-    Kc[412] = -g_RT[3] + g_RT[6] - g_RT[56] + g_RT[60];
-    Kc[413] = -g_RT[3] + g_RT[6] - g_RT[57] + g_RT[61];
-    Kc[414] = -g_RT[3] + g_RT[6] - g_RT[58] + g_RT[62];
-    Kc[415] = g_RT[1] - g_RT[53] + g_RT[66] - g_RT[67];
-    Kc[416] = g_RT[0] - g_RT[1] - g_RT[53] + g_RT[66] - g_RT[67];
-    Kc[417] = -g_RT[4] + g_RT[5] - g_RT[53] + g_RT[66] - g_RT[67];
-    Kc[418] = -g_RT[12] + g_RT[13] - g_RT[53] + g_RT[66] - g_RT[67];
-    Kc[419] = -g_RT[25] + g_RT[26] - g_RT[53] + g_RT[66] - g_RT[67];
-    Kc[420] = -g_RT[23] + g_RT[24] - g_RT[53] + g_RT[66] - g_RT[67];
-    Kc[421] = -g_RT[16] + g_RT[17] - g_RT[53] + g_RT[66] - g_RT[67];
-    Kc[422] = -g_RT[14] + g_RT[16] - g_RT[53] + g_RT[66] - g_RT[67];
-    Kc[423] = -g_RT[2] + g_RT[3] + g_RT[63] - g_RT[68];
-    Kc[424] = -g_RT[2] + g_RT[3] + g_RT[64] - g_RT[67];
-    Kc[425] = g_RT[2] - g_RT[14] - g_RT[53] + g_RT[63];
-    Kc[426] = g_RT[2] - g_RT[54] + g_RT[64] - g_RT[69];
-    Kc[427] = -g_RT[1] + g_RT[4] + g_RT[63] - g_RT[68];
-    Kc[428] = -g_RT[1] + g_RT[4] + g_RT[64] - g_RT[67];
-    Kc[429] = g_RT[4] - g_RT[16] - g_RT[53] + g_RT[63];
-    Kc[430] = g_RT[4] - g_RT[53] + g_RT[64] - g_RT[69];
-    Kc[431] = -g_RT[4] + g_RT[6] + g_RT[63] - g_RT[68];
-    Kc[432] = -g_RT[4] + g_RT[6] + g_RT[64] - g_RT[67];
-    Kc[433] = -g_RT[3] + g_RT[6] - g_RT[60] + g_RT[63];
-    Kc[434] = -g_RT[3] + g_RT[6] - g_RT[61] + g_RT[64];
-    Kc[435] = g_RT[5] - g_RT[17] - g_RT[53] + g_RT[63];
-    Kc[436] = g_RT[5] - g_RT[53] + g_RT[64] - g_RT[68];
-    Kc[437] = g_RT[1] - g_RT[53] + g_RT[64] - g_RT[65];
-    Kc[438] = -g_RT[16] + g_RT[17] - g_RT[60] + g_RT[63];
-    Kc[439] = g_RT[17] - g_RT[28] - g_RT[53] + g_RT[63];
-    Kc[440] = -g_RT[16] + g_RT[17] - g_RT[61] + g_RT[64];
-    Kc[441] = -g_RT[14] + g_RT[16] - g_RT[60] + g_RT[63];
-    Kc[442] = -g_RT[14] + g_RT[16] - g_RT[61] + g_RT[64];
-    Kc[443] = -g_RT[2] + g_RT[3] + g_RT[65] - g_RT[69];
-    Kc[444] = -g_RT[1] + g_RT[5] + g_RT[65] - g_RT[68];
-    Kc[445] = g_RT[1] - g_RT[8] - g_RT[53] + g_RT[65];
-    Kc[446] = g_RT[2] - g_RT[14] - g_RT[54] + g_RT[65];
-    Kc[447] = g_RT[4] - g_RT[14] - g_RT[53] + g_RT[65];
-    Kc[448] = -g_RT[4] + g_RT[6] + g_RT[65] - g_RT[69];
-    Kc[449] = -g_RT[22] + g_RT[24] - g_RT[60] + g_RT[65];
-    Kc[450] = -g_RT[16] + g_RT[17] - g_RT[63] + g_RT[65];
-    Kc[451] = -g_RT[14] + g_RT[16] - g_RT[63] + g_RT[65];
-    Kc[452] = g_RT[54] - g_RT[67] + g_RT[69];
-    Kc[453] = -g_RT[0] + g_RT[1] + g_RT[68] - g_RT[69];
-    Kc[454] = g_RT[1] - g_RT[53] + g_RT[67] - g_RT[69];
-    Kc[455] = g_RT[1] - g_RT[53] + g_RT[67] - g_RT[69];
-    Kc[456] = g_RT[1] - g_RT[53] + g_RT[67] - g_RT[69];
-    Kc[457] = g_RT[5] - g_RT[15] - g_RT[53] - g_RT[53] + g_RT[67];
-    Kc[458] = g_RT[2] - g_RT[4] + g_RT[68] - g_RT[69];
-    Kc[459] = g_RT[4] - g_RT[5] + g_RT[68] - g_RT[69];
-    Kc[460] = g_RT[4] - g_RT[15] - g_RT[53] - g_RT[54] + g_RT[67];
-    Kc[461] = -g_RT[6] + g_RT[7] - g_RT[68] + g_RT[69];
-    Kc[462] = g_RT[12] - g_RT[13] + g_RT[68] - g_RT[69];
-    Kc[463] = -g_RT[56] + g_RT[60] + g_RT[68] - g_RT[69];
-    Kc[464] = -g_RT[57] + g_RT[61] + g_RT[68] - g_RT[69];
-    Kc[465] = -g_RT[58] + g_RT[62] + g_RT[68] - g_RT[69];
-    Kc[466] = g_RT[23] - g_RT[24] + g_RT[68] - g_RT[69];
-    Kc[467] = g_RT[2] - g_RT[15] - g_RT[54] + g_RT[69];
-    Kc[468] = g_RT[4] - g_RT[15] - g_RT[53] + g_RT[69];
-    Kc[469] = -g_RT[4] + g_RT[6] - g_RT[15] - g_RT[54] + g_RT[69];
-    Kc[470] = g_RT[12] - g_RT[28] - g_RT[53] + g_RT[69];
-    Kc[471] = -g_RT[14] - g_RT[67] + g_RT[69] + g_RT[69];
-    Kc[472] = g_RT[12] - g_RT[24] - g_RT[53] + g_RT[60];
-    Kc[473] = g_RT[11] - g_RT[24] - g_RT[53] + g_RT[56];
-    Kc[474] = g_RT[13] - g_RT[24] - g_RT[53] + g_RT[63];
-    Kc[475] = g_RT[12] - g_RT[13] + g_RT[60] - g_RT[63];
-    Kc[476] = -g_RT[56] + g_RT[60] + g_RT[60] - g_RT[63];
-    Kc[477] = -g_RT[57] + g_RT[60] + g_RT[61] - g_RT[63];
-    Kc[478] = -g_RT[58] + g_RT[60] + g_RT[62] - g_RT[63];
-    Kc[479] = g_RT[12] - g_RT[13] + g_RT[61] - g_RT[64];
-    Kc[480] = -g_RT[56] + g_RT[60] + g_RT[61] - g_RT[64];
-    Kc[481] = -g_RT[57] + g_RT[61] + g_RT[61] - g_RT[64];
-    Kc[482] = -g_RT[58] + g_RT[61] + g_RT[62] - g_RT[64];
-    Kc[483] = g_RT[11] - g_RT[22] - g_RT[53] + g_RT[63];
-    Kc[484] = g_RT[10] - g_RT[24] - g_RT[54] + g_RT[60];
-    Kc[485] = g_RT[11] - g_RT[24] - g_RT[54] + g_RT[60];
-    Kc[486] = -g_RT[14] + g_RT[27] + g_RT[54] - g_RT[63];
-    Kc[487] = -g_RT[12] + g_RT[13] - g_RT[53] + g_RT[54];
-    Kc[488] = -g_RT[53] + g_RT[54] + g_RT[56] - g_RT[60];
-    Kc[489] = -g_RT[53] + g_RT[54] + g_RT[57] - g_RT[61];
-    Kc[490] = -g_RT[53] + g_RT[54] + g_RT[58] - g_RT[62];
-    Kc[491] = -g_RT[19] + g_RT[20] - g_RT[53] + g_RT[54];
-    Kc[492] = -g_RT[18] + g_RT[20] - g_RT[53] + g_RT[54];
-    Kc[493] = -g_RT[16] + g_RT[17] - g_RT[53] + g_RT[54];
-    Kc[494] = -g_RT[53] + g_RT[54] + g_RT[68] - g_RT[69];
-    Kc[495] = -g_RT[17] + g_RT[19] - g_RT[53] + g_RT[54];
-    Kc[496] = -g_RT[14] + g_RT[16] - g_RT[53] + g_RT[54];
-    Kc[497] = -g_RT[25] + g_RT[26] - g_RT[53] + g_RT[54];
-    Kc[498] = -g_RT[23] + g_RT[24] - g_RT[53] + g_RT[54];
-    Kc[499] = -g_RT[22] + g_RT[23] - g_RT[53] + g_RT[54];
-    Kc[500] = g_RT[12] - g_RT[56] + g_RT[59] - g_RT[62];
-    Kc[501] = g_RT[14] - g_RT[15] - g_RT[62] + g_RT[66];
-    Kc[502] = -g_RT[14] - g_RT[62] + g_RT[64] + g_RT[69];
-    Kc[503] = g_RT[1] - g_RT[53] - g_RT[54] + g_RT[55];
-    Kc[504] = -g_RT[54] + g_RT[55] - g_RT[59] + g_RT[62];
-    Kc[505] = g_RT[12] - g_RT[54] + g_RT[55] - g_RT[56];
-    Kc[506] = -g_RT[54] + g_RT[55] - g_RT[62] + g_RT[64];
-    Kc[507] = -g_RT[54] + g_RT[55] - g_RT[67] + g_RT[69];
-    Kc[508] = g_RT[0] - g_RT[1] - g_RT[53] - g_RT[54] + g_RT[55];
-    Kc[509] = g_RT[14] - g_RT[54] + g_RT[55] - g_RT[69];
-    Kc[510] = g_RT[8] - g_RT[54] + g_RT[55] - g_RT[65];
-    Kc[511] = -g_RT[54] + g_RT[55] - g_RT[64] + g_RT[65];
-    Kc[512] = -g_RT[12] + g_RT[13] - g_RT[53] - g_RT[54] + g_RT[55];
-    Kc[513] = -g_RT[2] + g_RT[4] - g_RT[53] - g_RT[54] + g_RT[55];
-    Kc[514] = g_RT[50] - g_RT[53] + g_RT[54] - g_RT[71];
-    Kc[515] = g_RT[50] - g_RT[53] + g_RT[54] - g_RT[70];
-    Kc[516] = g_RT[50] - g_RT[58] + g_RT[62] - g_RT[71];
-    Kc[517] = g_RT[50] - g_RT[58] + g_RT[62] - g_RT[70];
-
-#ifdef __INTEL_COMPILER
-     #pragma simd
-#endif
-    for (int i=0; i<518; ++i) {
-        Kc[i] = exp(Kc[i]);
-    };
-
     /*reference concentration: P_atm / (RT) in inverse mol/m^3 */
     double refC = 101325 / 8.31451 * invT;
     double refCinv = 1 / refC;
 
-    Kc[0] *= refCinv;
-    Kc[1] *= refCinv;
-    Kc[2] *= refCinv;
-    Kc[3] *= refCinv;
-    Kc[4] *= refCinv;
-    Kc[5] *= refCinv;
-    Kc[6] *= refCinv;
-    Kc[7] *= refCinv;
-    Kc[8] *= refCinv;
-    Kc[9] *= refCinv;
-    Kc[10] *= refCinv;
-    Kc[11] *= refCinv;
-    Kc[12] *= refCinv;
-    Kc[13] *= refCinv;
-    Kc[14] *= refCinv;
-    Kc[15] *= refCinv;
-    Kc[16] *= refCinv;
-    Kc[17] *= refCinv;
-    Kc[18] *= refCinv;
-    Kc[19] *= refC;
-    Kc[20] *= refCinv;
-    Kc[21] *= refCinv;
-    Kc[22] *= refCinv;
-    Kc[23] *= refCinv;
-    Kc[24] *= refCinv;
-    Kc[25] *= refCinv;
-    Kc[26] *= refCinv;
-    Kc[27] *= refC;
-    Kc[28] *= refCinv;
-    Kc[29] *= refC;
-    Kc[30] *= refC;
-    Kc[31] *= refC;
-    Kc[32] *= refCinv;
-    Kc[33] *= refCinv;
-    Kc[34] *= refCinv;
-    Kc[35] *= refCinv;
-    Kc[36] *= refCinv;
-    Kc[37] *= refC;
-    Kc[38] *= refCinv;
-    Kc[39] *= refC;
-    Kc[40] *= refCinv;
-    Kc[41] *= refC;
-    Kc[42] *= refC;
-    Kc[43] *= refC;
-    Kc[44] *= refCinv;
-    Kc[45] *= refC;
-    Kc[46] *= refCinv;
-    Kc[47] *= refC;
-    Kc[48] *= refC;
-    Kc[49] *= refC;
-    Kc[50] *= refC;
-    Kc[51] *= refCinv;
-    Kc[76] *= refC;
-    Kc[81] *= refCinv;
-    Kc[82] *= refCinv;
-    Kc[83] *= refCinv;
-    Kc[84] *= refCinv;
-    Kc[86] *= refCinv;
-    Kc[87] *= refCinv;
-    Kc[88] *= refCinv;
-    Kc[164] *= refC;
-    Kc[172] *= refC;
-    Kc[192] *= refC;
-    Kc[200] *= refC;
-    Kc[201] *= refC;
-    Kc[226] *= refC;
-    Kc[244] *= refC;
-    Kc[273] *= refC;
-    Kc[275] *= refC;
-    Kc[276] *= refC;
-    Kc[299] *= refC;
-    Kc[304] *= refC;
-    Kc[306] *= refC;
-    Kc[311] *= refC;
-    Kc[312] *= refC;
-    Kc[314] *= refC;
-    Kc[315] *= refC;
-    Kc[316] *= refC;
-    Kc[317] *= refC;
-    Kc[318] *= refC;
-    Kc[319] *= refC;
-    Kc[320] *= refC;
-    Kc[334] *= refC;
-    Kc[355] *= refCinv;
-    Kc[356] *= refCinv;
-    Kc[357] *= refCinv;
-    Kc[358] *= refCinv;
-    Kc[406] *= refC;
-    Kc[407] *= refC;
-    Kc[409] *= refC;
-    Kc[410] *= refC;
-    Kc[416] *= refC;
-    Kc[417] *= refC;
-    Kc[418] *= refC;
-    Kc[419] *= refC;
-    Kc[420] *= refC;
-    Kc[421] *= refC;
-    Kc[422] *= refC;
-    Kc[452] *= refCinv;
-    Kc[457] *= refC;
-    Kc[460] *= refC;
-    Kc[469] *= refC;
-    Kc[508] *= refC;
-    Kc[512] *= refC;
-    Kc[513] *= refC;
+    /*Kc as the ratio of the products of the species exp(g_RT)/refC, unless */
+    /*the product over a side of a reaction leaves the normal range */
+    double e_g[72], den[518];
+    for (int k=0; k<72; ++k) {
+        e_g[k] = exp(g_RT[k]) * refCinv;
+    }
+    Kc[0] = e_g[1]*e_g[10]; den[0] = e_g[12];
+    Kc[1] = e_g[1]*e_g[12]; den[1] = e_g[13];
+    Kc[2] = e_g[1]*e_g[16]; den[2] = e_g[17];
+    Kc[3] = e_g[1]*e_g[17]; den[3] = e_g[18];
+    Kc[4] = e_g[1]*e_g[17]; den[4] = e_g[19];
+    Kc[5] = e_g[1]*e_g[18]; den[5] = e_g[20];
+    Kc[6] = e_g[1]*e_g[19]; den[6] = e_g[20];
+    Kc[7] = e_g[1]*e_g[21]; den[7] = e_g[22];
+    Kc[8] = e_g[1]*e_g[22]; den[8] = e_g[23];
+    Kc[9] = e_g[1]*e_g[23]; den[9] = e_g[24];
+    Kc[10] = e_g[1]*e_g[24]; den[10] = e_g[25];
+    Kc[11] = e_g[1]*e_g[25]; den[11] = e_g[26];
+    Kc[12] = e_g[0]*e_g[14]; den[12] = e_g[17];
+    Kc[13] = e_g[4]*e_g[4]; den[13] = e_g[7];
+    Kc[14] = e_g[4]*e_g[12]; den[14] = e_g[20];
+    Kc[15] = e_g[9]*e_g[14]; den[15] = e_g[27];
+    Kc[16] = e_g[10]*e_g[14]; den[16] = e_g[28];
+    Kc[17] = e_g[5]*e_g[11]; den[17] = e_g[20];
+    Kc[18] = e_g[12]*e_g[12]; den[18] = e_g[26];
+    Kc[19] = e_g[24]; den[19] = e_g[0]*e_g[22];
+    Kc[20] = e_g[9]*e_g[47]; den[20] = e_g[42];
+    Kc[21] = e_g[0]*e_g[9]; den[21] = e_g[12];
+    Kc[22] = e_g[1]*e_g[28]; den[22] = e_g[51];
+    Kc[23] = e_g[12]*e_g[25]; den[23] = e_g[50];
+    Kc[24] = e_g[12]*e_g[24]; den[24] = e_g[49];
+    Kc[25] = e_g[1]*e_g[49]; den[25] = e_g[50];
+    Kc[26] = e_g[2]*e_g[14]; den[26] = e_g[15];
+    Kc[27] = e_g[37]; den[27] = e_g[2]*e_g[47];
+    Kc[28] = e_g[1]*e_g[40]; den[28] = e_g[41];
+    Kc[29] = e_g[56]; den[29] = e_g[11]*e_g[53];
+    Kc[30] = e_g[64]; den[30] = e_g[54]*e_g[65];
+    Kc[31] = e_g[62]; den[31] = e_g[54]*e_g[64];
+    Kc[32] = e_g[2]*e_g[2]; den[32] = e_g[3];
+    Kc[33] = e_g[1]*e_g[2]; den[33] = e_g[4];
+    Kc[34] = e_g[1]*e_g[3]; den[34] = e_g[6];
+    Kc[35] = e_g[1]*e_g[1]; den[35] = e_g[0];
+    Kc[36] = e_g[1]*e_g[4]; den[36] = e_g[5];
+    Kc[37] = e_g[16]; den[37] = e_g[1]*e_g[14];
+    Kc[38] = e_g[2]*e_g[35]; den[38] = e_g[36];
+    Kc[39] = e_g[34]; den[39] = e_g[1]*e_g[47];
+    Kc[40] = e_g[1]*e_g[35]; den[40] = e_g[38];
+    Kc[41] = e_g[46]; den[41] = e_g[14]*e_g[30];
+    Kc[42] = e_g[40]; den[42] = e_g[1]*e_g[39];
+    Kc[43] = e_g[45]; den[43] = e_g[14]*e_g[31];
+    Kc[44] = e_g[14]*e_g[54]; den[44] = e_g[69];
+    Kc[45] = e_g[53]; den[45] = e_g[1]*e_g[54];
+    Kc[46] = e_g[53]*e_g[63]; den[46] = e_g[57];
+    Kc[47] = e_g[58]; den[47] = e_g[53]*e_g[64];
+    Kc[48] = e_g[59]; den[48] = e_g[54]*e_g[62];
+    Kc[49] = e_g[66]; den[49] = e_g[54]*e_g[67];
+    Kc[50] = e_g[68]; den[50] = e_g[14]*e_g[53];
+    Kc[51] = e_g[54]*e_g[54]; den[51] = e_g[55];
+    Kc[52] = e_g[0]*e_g[2]; den[52] = e_g[1]*e_g[4];
+    Kc[53] = e_g[2]*e_g[6]; den[53] = e_g[3]*e_g[4];
+    Kc[54] = e_g[2]*e_g[7]; den[54] = e_g[4]*e_g[6];
+    Kc[55] = e_g[2]*e_g[9]; den[55] = e_g[1]*e_g[14];
+    Kc[56] = e_g[2]*e_g[10]; den[56] = e_g[1]*e_g[16];
+    Kc[57] = e_g[2]*e_g[11]; den[57] = e_g[0]*e_g[14];
+    Kc[58] = e_g[2]*e_g[11]; den[58] = e_g[1]*e_g[16];
+    Kc[59] = e_g[2]*e_g[12]; den[59] = e_g[1]*e_g[17];
+    Kc[60] = e_g[2]*e_g[13]; den[60] = e_g[4]*e_g[12];
+    Kc[61] = e_g[2]*e_g[16]; den[61] = e_g[4]*e_g[14];
+    Kc[62] = e_g[2]*e_g[16]; den[62] = e_g[1]*e_g[15];
+    Kc[63] = e_g[2]*e_g[17]; den[63] = e_g[4]*e_g[16];
+    Kc[64] = e_g[2]*e_g[18]; den[64] = e_g[4]*e_g[17];
+    Kc[65] = e_g[2]*e_g[19]; den[65] = e_g[4]*e_g[17];
+    Kc[66] = e_g[2]*e_g[20]; den[66] = e_g[4]*e_g[18];
+    Kc[67] = e_g[2]*e_g[20]; den[67] = e_g[4]*e_g[19];
+    Kc[68] = e_g[2]*e_g[21]; den[68] = e_g[9]*e_g[14];
+    Kc[69] = e_g[2]*e_g[22]; den[69] = e_g[1]*e_g[27];
+    Kc[70] = e_g[2]*e_g[22]; den[70] = e_g[4]*e_g[21];
+    Kc[71] = e_g[2]*e_g[22]; den[71] = e_g[10]*e_g[14];
+    Kc[72] = e_g[2]*e_g[23]; den[72] = e_g[1]*e_g[28];
+    Kc[73] = e_g[2]*e_g[24]; den[73] = e_g[12]*e_g[16];
+    Kc[74] = e_g[2]*e_g[25]; den[74] = e_g[12]*e_g[17];
+    Kc[75] = e_g[2]*e_g[26]; den[75] = e_g[4]*e_g[25];
+    Kc[76] = e_g[2]*e_g[27]; den[76] = e_g[1]*e_g[14]*e_g[14];
+    Kc[77] = e_g[2]*e_g[28]; den[77] = e_g[4]*e_g[27];
+    Kc[78] = e_g[2]*e_g[28]; den[78] = e_g[10]*e_g[15];
+    Kc[79] = e_g[3]*e_g[14]; den[79] = e_g[2]*e_g[15];
+    Kc[80] = e_g[3]*e_g[17]; den[80] = e_g[6]*e_g[16];
+    Kc[81] = e_g[1]*e_g[3]*e_g[3]; den[81] = e_g[3]*e_g[6];
+    Kc[82] = e_g[1]*e_g[3]*e_g[5]; den[82] = e_g[5]*e_g[6];
+    Kc[83] = e_g[1]*e_g[3]*e_g[47]; den[83] = e_g[6]*e_g[47];
+    Kc[84] = e_g[1]*e_g[3]*e_g[48]; den[84] = e_g[6]*e_g[48];
+    Kc[85] = e_g[1]*e_g[3]; den[85] = e_g[2]*e_g[4];
+    Kc[86] = e_g[0]*e_g[1]*e_g[1]; den[86] = e_g[0]*e_g[0];
+    Kc[87] = e_g[1]*e_g[1]*e_g[5]; den[87] = e_g[0]*e_g[5];
+    Kc[88] = e_g[1]*e_g[1]*e_g[15]; den[88] = e_g[0]*e_g[15];
+    Kc[89] = e_g[1]*e_g[6]; den[89] = e_g[2]*e_g[5];
+    Kc[90] = e_g[1]*e_g[6]; den[90] = e_g[0]*e_g[3];
+    Kc[91] = e_g[1]*e_g[6]; den[91] = e_g[4]*e_g[4];
+    Kc[92] = e_g[1]*e_g[7]; den[92] = e_g[0]*e_g[6];
+    Kc[93] = e_g[1]*e_g[7]; den[93] = e_g[4]*e_g[5];
+    Kc[94] = e_g[1]*e_g[9]; den[94] = e_g[0]*e_g[8];
+    Kc[95] = e_g[1]*e_g[11]; den[95] = e_g[0]*e_g[9];
+    Kc[96] = e_g[1]*e_g[13]; den[96] = e_g[0]*e_g[12];
+    Kc[97] = e_g[1]*e_g[16]; den[97] = e_g[0]*e_g[14];
+    Kc[98] = e_g[1]*e_g[17]; den[98] = e_g[0]*e_g[16];
+    Kc[99] = e_g[1]*e_g[18]; den[99] = e_g[0]*e_g[17];
+    Kc[100] = e_g[1]*e_g[18]; den[100] = e_g[4]*e_g[12];
+    Kc[101] = e_g[1]*e_g[18]; den[101] = e_g[5]*e_g[11];
+    Kc[102] = e_g[1]*e_g[19]; den[102] = e_g[1]*e_g[18];
+    Kc[103] = e_g[1]*e_g[19]; den[103] = e_g[0]*e_g[17];
+    Kc[104] = e_g[1]*e_g[19]; den[104] = e_g[4]*e_g[12];
+    Kc[105] = e_g[1]*e_g[19]; den[105] = e_g[5]*e_g[11];
+    Kc[106] = e_g[1]*e_g[20]; den[106] = e_g[0]*e_g[18];
+    Kc[107] = e_g[1]*e_g[20]; den[107] = e_g[0]*e_g[19];
+    Kc[108] = e_g[1]*e_g[23]; den[108] = e_g[0]*e_g[22];
+    Kc[109] = e_g[1]*e_g[24]; den[109] = e_g[0]*e_g[23];
+    Kc[110] = e_g[1]*e_g[25]; den[110] = e_g[0]*e_g[24];
+    Kc[111] = e_g[1]*e_g[26]; den[111] = e_g[0]*e_g[25];
+    Kc[112] = e_g[1]*e_g[27]; den[112] = e_g[11]*e_g[14];
+    Kc[113] = e_g[1]*e_g[28]; den[113] = e_g[0]*e_g[27];
+    Kc[114] = e_g[1]*e_g[28]; den[114] = e_g[12]*e_g[14];
+    Kc[115] = e_g[1]*e_g[29]; den[115] = e_g[1]*e_g[28];
+    Kc[116] = e_g[0]*e_g[4]; den[116] = e_g[1]*e_g[5];
+    Kc[117] = e_g[4]*e_g[4]; den[117] = e_g[2]*e_g[5];
+    Kc[118] = e_g[4]*e_g[6]; den[118] = e_g[3]*e_g[5];
+    Kc[119] = e_g[4]*e_g[7]; den[119] = e_g[5]*e_g[6];
+    Kc[120] = e_g[4]*e_g[7]; den[120] = e_g[5]*e_g[6];
+    Kc[121] = e_g[4]*e_g[8]; den[121] = e_g[1]*e_g[14];
+    Kc[122] = e_g[4]*e_g[9]; den[122] = e_g[1]*e_g[16];
+    Kc[123] = e_g[4]*e_g[10]; den[123] = e_g[1]*e_g[17];
+    Kc[124] = e_g[4]*e_g[10]; den[124] = e_g[5]*e_g[9];
+    Kc[125] = e_g[4]*e_g[11]; den[125] = e_g[1]*e_g[17];
+    Kc[126] = e_g[4]*e_g[12]; den[126] = e_g[5]*e_g[10];
+    Kc[127] = e_g[4]*e_g[12]; den[127] = e_g[5]*e_g[11];
+    Kc[128] = e_g[4]*e_g[13]; den[128] = e_g[5]*e_g[12];
+    Kc[129] = e_g[4]*e_g[14]; den[129] = e_g[1]*e_g[15];
+    Kc[130] = e_g[4]*e_g[16]; den[130] = e_g[5]*e_g[14];
+    Kc[131] = e_g[4]*e_g[17]; den[131] = e_g[5]*e_g[16];
+    Kc[132] = e_g[4]*e_g[18]; den[132] = e_g[5]*e_g[17];
+    Kc[133] = e_g[4]*e_g[19]; den[133] = e_g[5]*e_g[17];
+    Kc[134] = e_g[4]*e_g[20]; den[134] = e_g[5]*e_g[18];
+    Kc[135] = e_g[4]*e_g[20]; den[135] = e_g[5]*e_g[19];
+    Kc[136] = e_g[4]*e_g[21]; den[136] = e_g[1]*e_g[27];
+    Kc[137] = e_g[4]*e_g[22]; den[137] = e_g[1]*e_g[28];
+    Kc[138] = e_g[4]*e_g[22]; den[138] = e_g[1]*e_g[29];
+    Kc[139] = e_g[4]*e_g[22]; den[139] = e_g[5]*e_g[21];
+    Kc[140] = e_g[4]*e_g[22]; den[140] = e_g[12]*e_g[14];
+    Kc[141] = e_g[4]*e_g[23]; den[141] = e_g[5]*e_g[22];
+    Kc[142] = e_g[4]*e_g[24]; den[142] = e_g[5]*e_g[23];
+    Kc[143] = e_g[4]*e_g[26]; den[143] = e_g[5]*e_g[25];
+    Kc[144] = e_g[4]*e_g[28]; den[144] = e_g[5]*e_g[27];
+    Kc[145] = e_g[6]*e_g[6]; den[145] = e_g[3]*e_g[7];
+    Kc[146] = e_g[6]*e_g[6]; den[146] = e_g[3]*e_g[7];
+    Kc[147] = e_g[6]*e_g[10]; den[147] = e_g[4]*e_g[17];
+    Kc[148] = e_g[6]*e_g[12]; den[148] = e_g[3]*e_g[13];
+    Kc[149] = e_g[6]*e_g[12]; den[149] = e_g[4]*e_g[19];
+    Kc[150] = e_g[6]*e_g[14]; den[150] = e_g[4]*e_g[15];
+    Kc[151] = e_g[6]*e_g[17]; den[151] = e_g[7]*e_g[16];
+    Kc[152] = e_g[3]*e_g[8]; den[152] = e_g[2]*e_g[14];
+    Kc[153] = e_g[8]*e_g[10]; den[153] = e_g[1]*e_g[21];
+    Kc[154] = e_g[8]*e_g[12]; den[154] = e_g[1]*e_g[22];
+    Kc[155] = e_g[3]*e_g[9]; den[155] = e_g[2]*e_g[16];
+    Kc[156] = e_g[0]*e_g[9]; den[156] = e_g[1]*e_g[10];
+    Kc[157] = e_g[5]*e_g[9]; den[157] = e_g[1]*e_g[17];
+    Kc[158] = e_g[9]*e_g[10]; den[158] = e_g[1]*e_g[22];
+    Kc[159] = e_g[9]*e_g[12]; den[159] = e_g[1]*e_g[23];
+    Kc[160] = e_g[9]*e_g[13]; den[160] = e_g[1]*e_g[24];
+    Kc[161] = e_g[9]*e_g[15]; den[161] = e_g[14]*e_g[16];
+    Kc[162] = e_g[9]*e_g[17]; den[162] = e_g[1]*e_g[28];
+    Kc[163] = e_g[9]*e_g[27]; den[163] = e_g[14]*e_g[22];
+    Kc[164] = e_g[3]*e_g[10]; den[164] = e_g[1]*e_g[4]*e_g[14];
+    Kc[165] = e_g[0]*e_g[10]; den[165] = e_g[1]*e_g[12];
+    Kc[166] = e_g[10]*e_g[10]; den[166] = e_g[0]*e_g[22];
+    Kc[167] = e_g[10]*e_g[12]; den[167] = e_g[1]*e_g[24];
+    Kc[168] = e_g[10]*e_g[13]; den[168] = e_g[12]*e_g[12];
+    Kc[169] = e_g[10]*e_g[27]; den[169] = e_g[14]*e_g[23];
+    Kc[170] = e_g[11]*e_g[47]; den[170] = e_g[10]*e_g[47];
+    Kc[171] = e_g[11]*e_g[48]; den[171] = e_g[10]*e_g[48];
+    Kc[172] = e_g[3]*e_g[11]; den[172] = e_g[1]*e_g[4]*e_g[14];
+    Kc[173] = e_g[3]*e_g[11]; den[173] = e_g[5]*e_g[14];
+    Kc[174] = e_g[0]*e_g[11]; den[174] = e_g[1]*e_g[12];
+    Kc[175] = e_g[5]*e_g[11]; den[175] = e_g[5]*e_g[10];
+    Kc[176] = e_g[11]*e_g[12]; den[176] = e_g[1]*e_g[24];
+    Kc[177] = e_g[11]*e_g[13]; den[177] = e_g[12]*e_g[12];
+    Kc[178] = e_g[11]*e_g[14]; den[178] = e_g[10]*e_g[14];
+    Kc[179] = e_g[11]*e_g[15]; den[179] = e_g[10]*e_g[15];
+    Kc[180] = e_g[11]*e_g[15]; den[180] = e_g[14]*e_g[17];
+    Kc[181] = e_g[11]*e_g[26]; den[181] = e_g[12]*e_g[25];
+    Kc[182] = e_g[3]*e_g[12]; den[182] = e_g[2]*e_g[19];
+    Kc[183] = e_g[3]*e_g[12]; den[183] = e_g[4]*e_g[17];
+    Kc[184] = e_g[7]*e_g[12]; den[184] = e_g[6]*e_g[13];
+    Kc[185] = e_g[12]*e_g[12]; den[185] = e_g[1]*e_g[25];
+    Kc[186] = e_g[12]*e_g[16]; den[186] = e_g[13]*e_g[14];
+    Kc[187] = e_g[12]*e_g[17]; den[187] = e_g[13]*e_g[16];
+    Kc[188] = e_g[12]*e_g[20]; den[188] = e_g[13]*e_g[18];
+    Kc[189] = e_g[12]*e_g[20]; den[189] = e_g[13]*e_g[19];
+    Kc[190] = e_g[12]*e_g[24]; den[190] = e_g[13]*e_g[23];
+    Kc[191] = e_g[12]*e_g[26]; den[191] = e_g[13]*e_g[25];
+    Kc[192] = e_g[5]*e_g[16]; den[192] = e_g[1]*e_g[5]*e_g[14];
+    Kc[193] = e_g[3]*e_g[16]; den[193] = e_g[6]*e_g[14];
+    Kc[194] = e_g[3]*e_g[18]; den[194] = e_g[6]*e_g[17];
+    Kc[195] = e_g[3]*e_g[19]; den[195] = e_g[6]*e_g[17];
+    Kc[196] = e_g[3]*e_g[21]; den[196] = e_g[14]*e_g[16];
+    Kc[197] = e_g[0]*e_g[21]; den[197] = e_g[1]*e_g[22];
+    Kc[198] = e_g[3]*e_g[23]; den[198] = e_g[16]*e_g[17];
+    Kc[199] = e_g[3]*e_g[25]; den[199] = e_g[6]*e_g[24];
+    Kc[200] = e_g[3]*e_g[27]; den[200] = e_g[4]*e_g[14]*e_g[14];
+    Kc[201] = e_g[27]*e_g[27]; den[201] = e_g[14]*e_g[14]*e_g[22];
+    Kc[202] = e_g[30]*e_g[35]; den[202] = e_g[2]*e_g[47];
+    Kc[203] = e_g[3]*e_g[30]; den[203] = e_g[2]*e_g[35];
+    Kc[204] = e_g[4]*e_g[30]; den[204] = e_g[1]*e_g[35];
+    Kc[205] = e_g[2]*e_g[37]; den[205] = e_g[3]*e_g[47];
+    Kc[206] = e_g[2]*e_g[37]; den[206] = e_g[35]*e_g[35];
+    Kc[207] = e_g[1]*e_g[37]; den[207] = e_g[4]*e_g[47];
+    Kc[208] = e_g[4]*e_g[37]; den[208] = e_g[6]*e_g[47];
+    Kc[209] = e_g[6]*e_g[35]; den[209] = e_g[4]*e_g[36];
+    Kc[210] = e_g[2]*e_g[36]; den[210] = e_g[3]*e_g[35];
+    Kc[211] = e_g[1]*e_g[36]; den[211] = e_g[4]*e_g[35];
+    Kc[212] = e_g[2]*e_g[31]; den[212] = e_g[1]*e_g[35];
+    Kc[213] = e_g[1]*e_g[31]; den[213] = e_g[0]*e_g[30];
+    Kc[214] = e_g[4]*e_g[31]; den[214] = e_g[1]*e_g[38];
+    Kc[215] = e_g[4]*e_g[31]; den[215] = e_g[5]*e_g[30];
+    Kc[216] = e_g[3]*e_g[31]; den[216] = e_g[2]*e_g[38];
+    Kc[217] = e_g[3]*e_g[31]; den[217] = e_g[4]*e_g[35];
+    Kc[218] = e_g[30]*e_g[31]; den[218] = e_g[1]*e_g[47];
+    Kc[219] = e_g[5]*e_g[31]; den[219] = e_g[0]*e_g[38];
+    Kc[220] = e_g[31]*e_g[35]; den[220] = e_g[4]*e_g[47];
+    Kc[221] = e_g[31]*e_g[35]; den[221] = e_g[1]*e_g[37];
+    Kc[222] = e_g[2]*e_g[32]; den[222] = e_g[4]*e_g[31];
+    Kc[223] = e_g[2]*e_g[32]; den[223] = e_g[1]*e_g[38];
+    Kc[224] = e_g[1]*e_g[32]; den[224] = e_g[0]*e_g[31];
+    Kc[225] = e_g[4]*e_g[32]; den[225] = e_g[5]*e_g[31];
+    Kc[226] = e_g[34]; den[226] = e_g[1]*e_g[47];
+    Kc[227] = e_g[3]*e_g[34]; den[227] = e_g[6]*e_g[47];
+    Kc[228] = e_g[2]*e_g[34]; den[228] = e_g[4]*e_g[47];
+    Kc[229] = e_g[2]*e_g[34]; den[229] = e_g[31]*e_g[35];
+    Kc[230] = e_g[1]*e_g[34]; den[230] = e_g[0]*e_g[47];
+    Kc[231] = e_g[4]*e_g[34]; den[231] = e_g[5]*e_g[47];
+    Kc[232] = e_g[12]*e_g[34]; den[232] = e_g[13]*e_g[47];
+    Kc[233] = e_g[2]*e_g[38]; den[233] = e_g[4]*e_g[35];
+    Kc[234] = e_g[1]*e_g[38]; den[234] = e_g[0]*e_g[35];
+    Kc[235] = e_g[4]*e_g[38]; den[235] = e_g[5]*e_g[35];
+    Kc[236] = e_g[3]*e_g[38]; den[236] = e_g[6]*e_g[35];
+    Kc[237] = e_g[2]*e_g[39]; den[237] = e_g[14]*e_g[30];
+    Kc[238] = e_g[4]*e_g[39]; den[238] = e_g[1]*e_g[46];
+    Kc[239] = e_g[5]*e_g[39]; den[239] = e_g[4]*e_g[40];
+    Kc[240] = e_g[3]*e_g[39]; den[240] = e_g[2]*e_g[46];
+    Kc[241] = e_g[0]*e_g[39]; den[241] = e_g[1]*e_g[40];
+    Kc[242] = e_g[2]*e_g[46]; den[242] = e_g[14]*e_g[35];
+    Kc[243] = e_g[1]*e_g[46]; den[243] = e_g[14]*e_g[31];
+    Kc[244] = e_g[4]*e_g[46]; den[244] = e_g[1]*e_g[14]*e_g[35];
+    Kc[245] = e_g[30]*e_g[46]; den[245] = e_g[14]*e_g[47];
+    Kc[246] = e_g[3]*e_g[46]; den[246] = e_g[15]*e_g[35];
+    Kc[247] = e_g[35]*e_g[46]; den[247] = e_g[14]*e_g[37];
+    Kc[248] = e_g[35]*e_g[46]; den[248] = e_g[15]*e_g[47];
+    Kc[249] = e_g[2]*e_g[40]; den[249] = e_g[1]*e_g[46];
+    Kc[250] = e_g[2]*e_g[40]; den[250] = e_g[14]*e_g[31];
+    Kc[251] = e_g[2]*e_g[40]; den[251] = e_g[4]*e_g[39];
+    Kc[252] = e_g[4]*e_g[40]; den[252] = e_g[1]*e_g[44];
+    Kc[253] = e_g[4]*e_g[40]; den[253] = e_g[1]*e_g[45];
+    Kc[254] = e_g[4]*e_g[40]; den[254] = e_g[14]*e_g[32];
+    Kc[255] = e_g[30]*e_g[41]; den[255] = e_g[10]*e_g[47];
+    Kc[256] = e_g[8]*e_g[47]; den[256] = e_g[30]*e_g[39];
+    Kc[257] = e_g[9]*e_g[47]; den[257] = e_g[30]*e_g[40];
+    Kc[258] = e_g[10]*e_g[47]; den[258] = e_g[31]*e_g[40];
+    Kc[259] = e_g[11]*e_g[47]; den[259] = e_g[31]*e_g[40];
+    Kc[260] = e_g[8]*e_g[35]; den[260] = e_g[2]*e_g[39];
+    Kc[261] = e_g[8]*e_g[35]; den[261] = e_g[14]*e_g[30];
+    Kc[262] = e_g[9]*e_g[35]; den[262] = e_g[2]*e_g[40];
+    Kc[263] = e_g[9]*e_g[35]; den[263] = e_g[1]*e_g[46];
+    Kc[264] = e_g[9]*e_g[35]; den[264] = e_g[16]*e_g[30];
+    Kc[265] = e_g[10]*e_g[35]; den[265] = e_g[1]*e_g[45];
+    Kc[266] = e_g[10]*e_g[35]; den[266] = e_g[4]*e_g[40];
+    Kc[267] = e_g[10]*e_g[35]; den[267] = e_g[1]*e_g[43];
+    Kc[268] = e_g[11]*e_g[35]; den[268] = e_g[1]*e_g[45];
+    Kc[269] = e_g[11]*e_g[35]; den[269] = e_g[4]*e_g[40];
+    Kc[270] = e_g[11]*e_g[35]; den[270] = e_g[1]*e_g[43];
+    Kc[271] = e_g[12]*e_g[35]; den[271] = e_g[5]*e_g[40];
+    Kc[272] = e_g[12]*e_g[35]; den[272] = e_g[4]*e_g[41];
+    Kc[273] = e_g[2]*e_g[42]; den[273] = e_g[1]*e_g[14]*e_g[47];
+    Kc[274] = e_g[2]*e_g[42]; den[274] = e_g[35]*e_g[40];
+    Kc[275] = e_g[3]*e_g[42]; den[275] = e_g[2]*e_g[16]*e_g[47];
+    Kc[276] = e_g[4]*e_g[42]; den[276] = e_g[1]*e_g[16]*e_g[47];
+    Kc[277] = e_g[1]*e_g[42]; den[277] = e_g[10]*e_g[47];
+    Kc[278] = e_g[2]*e_g[45]; den[278] = e_g[15]*e_g[31];
+    Kc[279] = e_g[2]*e_g[45]; den[279] = e_g[14]*e_g[38];
+    Kc[280] = e_g[2]*e_g[45]; den[280] = e_g[4]*e_g[46];
+    Kc[281] = e_g[1]*e_g[45]; den[281] = e_g[14]*e_g[32];
+    Kc[282] = e_g[1]*e_g[45]; den[282] = e_g[0]*e_g[46];
+    Kc[283] = e_g[4]*e_g[45]; den[283] = e_g[5]*e_g[46];
+    Kc[284] = e_g[4]*e_g[45]; den[284] = e_g[15]*e_g[32];
+    Kc[285] = e_g[1]*e_g[43]; den[285] = e_g[1]*e_g[45];
+    Kc[286] = e_g[1]*e_g[43]; den[286] = e_g[4]*e_g[40];
+    Kc[287] = e_g[1]*e_g[43]; den[287] = e_g[14]*e_g[32];
+    Kc[288] = e_g[1]*e_g[44]; den[288] = e_g[1]*e_g[45];
+    Kc[289] = e_g[27]*e_g[35]; den[289] = e_g[14]*e_g[43];
+    Kc[290] = e_g[12]*e_g[30]; den[290] = e_g[1]*e_g[41];
+    Kc[291] = e_g[12]*e_g[30]; den[291] = e_g[0]*e_g[40];
+    Kc[292] = e_g[1]*e_g[33]; den[292] = e_g[0]*e_g[32];
+    Kc[293] = e_g[4]*e_g[33]; den[293] = e_g[5]*e_g[32];
+    Kc[294] = e_g[2]*e_g[33]; den[294] = e_g[4]*e_g[32];
+    Kc[295] = e_g[15]*e_g[31]; den[295] = e_g[14]*e_g[38];
+    Kc[296] = e_g[36]*e_g[39]; den[296] = e_g[35]*e_g[46];
+    Kc[297] = e_g[36]*e_g[46]; den[297] = e_g[15]*e_g[37];
+    Kc[298] = e_g[15]*e_g[30]; den[298] = e_g[14]*e_g[35];
+    Kc[299] = e_g[2]*e_g[12]; den[299] = e_g[0]*e_g[1]*e_g[14];
+    Kc[300] = e_g[2]*e_g[24]; den[300] = e_g[1]*e_g[51];
+    Kc[301] = e_g[2]*e_g[25]; den[301] = e_g[1]*e_g[52];
+    Kc[302] = e_g[4]*e_g[6]; den[302] = e_g[3]*e_g[5];
+    Kc[303] = e_g[4]*e_g[12]; den[303] = e_g[0]*e_g[17];
+    Kc[304] = e_g[3]*e_g[10]; den[304] = e_g[1]*e_g[1]*e_g[15];
+    Kc[305] = e_g[3]*e_g[10]; den[305] = e_g[2]*e_g[17];
+    Kc[306] = e_g[10]*e_g[10]; den[306] = e_g[1]*e_g[1]*e_g[22];
+    Kc[307] = e_g[5]*e_g[11]; den[307] = e_g[0]*e_g[17];
+    Kc[308] = e_g[3]*e_g[23]; den[308] = e_g[2]*e_g[51];
+    Kc[309] = e_g[3]*e_g[23]; den[309] = e_g[6]*e_g[22];
+    Kc[310] = e_g[2]*e_g[52]; den[310] = e_g[4]*e_g[51];
+    Kc[311] = e_g[2]*e_g[52]; den[311] = e_g[4]*e_g[12]*e_g[14];
+    Kc[312] = e_g[3]*e_g[52]; den[312] = e_g[6]*e_g[12]*e_g[14];
+    Kc[313] = e_g[1]*e_g[52]; den[313] = e_g[0]*e_g[51];
+    Kc[314] = e_g[1]*e_g[52]; den[314] = e_g[0]*e_g[12]*e_g[14];
+    Kc[315] = e_g[4]*e_g[52]; den[315] = e_g[5]*e_g[12]*e_g[14];
+    Kc[316] = e_g[6]*e_g[52]; den[316] = e_g[7]*e_g[12]*e_g[14];
+    Kc[317] = e_g[12]*e_g[52]; den[317] = e_g[12]*e_g[13]*e_g[14];
+    Kc[318] = e_g[2]*e_g[51]; den[318] = e_g[1]*e_g[10]*e_g[15];
+    Kc[319] = e_g[3]*e_g[51]; den[319] = e_g[4]*e_g[14]*e_g[17];
+    Kc[320] = e_g[3]*e_g[51]; den[320] = e_g[4]*e_g[16]*e_g[16];
+    Kc[321] = e_g[1]*e_g[51]; den[321] = e_g[12]*e_g[16];
+    Kc[322] = e_g[1]*e_g[51]; den[322] = e_g[0]*e_g[28];
+    Kc[323] = e_g[4]*e_g[51]; den[323] = e_g[5]*e_g[28];
+    Kc[324] = e_g[4]*e_g[51]; den[324] = e_g[16]*e_g[18];
+    Kc[325] = e_g[2]*e_g[50]; den[325] = e_g[4]*e_g[49];
+    Kc[326] = e_g[1]*e_g[50]; den[326] = e_g[0]*e_g[49];
+    Kc[327] = e_g[4]*e_g[50]; den[327] = e_g[5]*e_g[49];
+    Kc[328] = e_g[7]*e_g[49]; den[328] = e_g[6]*e_g[50];
+    Kc[329] = e_g[12]*e_g[50]; den[329] = e_g[13]*e_g[49];
+    Kc[330] = e_g[2]*e_g[49]; den[330] = e_g[17]*e_g[25];
+    Kc[331] = e_g[1]*e_g[49]; den[331] = e_g[12]*e_g[25];
+    Kc[332] = e_g[4]*e_g[49]; den[332] = e_g[18]*e_g[25];
+    Kc[333] = e_g[6]*e_g[49]; den[333] = e_g[3]*e_g[50];
+    Kc[334] = e_g[6]*e_g[49]; den[334] = e_g[4]*e_g[17]*e_g[25];
+    Kc[335] = e_g[12]*e_g[49]; den[335] = e_g[25]*e_g[25];
+    Kc[336] = e_g[1]*e_g[60]; den[336] = e_g[11]*e_g[53];
+    Kc[337] = e_g[1]*e_g[60]; den[337] = e_g[0]*e_g[63];
+    Kc[338] = e_g[1]*e_g[58]; den[338] = e_g[0]*e_g[62];
+    Kc[339] = e_g[1]*e_g[58]; den[339] = e_g[54]*e_g[57];
+    Kc[340] = e_g[1]*e_g[63]; den[340] = e_g[9]*e_g[53];
+    Kc[341] = e_g[1]*e_g[63]; den[341] = e_g[0]*e_g[65];
+    Kc[342] = e_g[9]*e_g[53]; den[342] = e_g[0]*e_g[65];
+    Kc[343] = e_g[1]*e_g[69]; den[343] = e_g[14]*e_g[53];
+    Kc[344] = e_g[2]*e_g[60]; den[344] = e_g[1]*e_g[68];
+    Kc[345] = e_g[2]*e_g[61]; den[345] = e_g[1]*e_g[67];
+    Kc[346] = e_g[2]*e_g[62]; den[346] = e_g[54]*e_g[67];
+    Kc[347] = e_g[4]*e_g[60]; den[347] = e_g[17]*e_g[53];
+    Kc[348] = e_g[4]*e_g[61]; den[348] = e_g[53]*e_g[68];
+    Kc[349] = e_g[4]*e_g[62]; den[349] = e_g[53]*e_g[67];
+    Kc[350] = e_g[0]*e_g[54]; den[350] = e_g[1]*e_g[53];
+    Kc[351] = e_g[4]*e_g[54]; den[351] = e_g[2]*e_g[53];
+    Kc[352] = e_g[6]*e_g[54]; den[352] = e_g[3]*e_g[53];
+    Kc[353] = e_g[5]*e_g[54]; den[353] = e_g[4]*e_g[53];
+    Kc[354] = e_g[7]*e_g[54]; den[354] = e_g[6]*e_g[53];
+    Kc[355] = e_g[0]*e_g[63]; den[355] = e_g[56];
+    Kc[356] = e_g[1]*e_g[60]; den[356] = e_g[56];
+    Kc[357] = e_g[0]*e_g[64]; den[357] = e_g[57];
+    Kc[358] = e_g[1]*e_g[61]; den[358] = e_g[57];
+    Kc[359] = e_g[11]*e_g[53]; den[359] = e_g[0]*e_g[63];
+    Kc[360] = e_g[12]*e_g[54]; den[360] = e_g[11]*e_g[53];
+    Kc[361] = e_g[12]*e_g[54]; den[361] = e_g[1]*e_g[60];
+    Kc[362] = e_g[53]*e_g[63]; den[362] = e_g[0]*e_g[64];
+    Kc[363] = e_g[1]*e_g[61]; den[363] = e_g[53]*e_g[63];
+    Kc[364] = e_g[1]*e_g[61]; den[364] = e_g[0]*e_g[64];
+    Kc[365] = e_g[54]*e_g[60]; den[365] = e_g[53]*e_g[63];
+    Kc[366] = e_g[1]*e_g[62]; den[366] = e_g[53]*e_g[64];
+    Kc[367] = e_g[54]*e_g[61]; den[367] = e_g[53]*e_g[64];
+    Kc[368] = e_g[1]*e_g[56]; den[368] = e_g[0]*e_g[60];
+    Kc[369] = e_g[1]*e_g[57]; den[369] = e_g[0]*e_g[61];
+    Kc[370] = e_g[1]*e_g[56]; den[370] = e_g[12]*e_g[53];
+    Kc[371] = e_g[1]*e_g[57]; den[371] = e_g[53]*e_g[60];
+    Kc[372] = e_g[1]*e_g[58]; den[372] = e_g[53]*e_g[61];
+    Kc[373] = e_g[1]*e_g[59]; den[373] = e_g[53]*e_g[62];
+    Kc[374] = e_g[1]*e_g[59]; den[374] = e_g[54]*e_g[58];
+    Kc[375] = e_g[2]*e_g[56]; den[375] = e_g[4]*e_g[60];
+    Kc[376] = e_g[2]*e_g[57]; den[376] = e_g[4]*e_g[61];
+    Kc[377] = e_g[2]*e_g[58]; den[377] = e_g[4]*e_g[62];
+    Kc[378] = e_g[4]*e_g[56]; den[378] = e_g[5]*e_g[60];
+    Kc[379] = e_g[4]*e_g[57]; den[379] = e_g[5]*e_g[61];
+    Kc[380] = e_g[4]*e_g[58]; den[380] = e_g[5]*e_g[62];
+    Kc[381] = e_g[7]*e_g[60]; den[381] = e_g[6]*e_g[56];
+    Kc[382] = e_g[7]*e_g[61]; den[382] = e_g[6]*e_g[57];
+    Kc[383] = e_g[7]*e_g[62]; den[383] = e_g[6]*e_g[58];
+    Kc[384] = e_g[12]*e_g[56]; den[384] = e_g[13]*e_g[60];
+    Kc[385] = e_g[12]*e_g[57]; den[385] = e_g[13]*e_g[61];
+    Kc[386] = e_g[13]*e_g[62]; den[386] = e_g[12]*e_g[58];
+    Kc[387] = e_g[23]*e_g[56]; den[387] = e_g[24]*e_g[60];
+    Kc[388] = e_g[23]*e_g[57]; den[388] = e_g[24]*e_g[61];
+    Kc[389] = e_g[24]*e_g[62]; den[389] = e_g[23]*e_g[58];
+    Kc[390] = e_g[56]*e_g[62]; den[390] = e_g[58]*e_g[60];
+    Kc[391] = e_g[57]*e_g[60]; den[391] = e_g[56]*e_g[61];
+    Kc[392] = e_g[57]*e_g[62]; den[392] = e_g[58]*e_g[61];
+    Kc[393] = e_g[20]*e_g[60]; den[393] = e_g[19]*e_g[56];
+    Kc[394] = e_g[20]*e_g[61]; den[394] = e_g[19]*e_g[57];
+    Kc[395] = e_g[20]*e_g[62]; den[395] = e_g[19]*e_g[58];
+    Kc[396] = e_g[20]*e_g[60]; den[396] = e_g[18]*e_g[56];
+    Kc[397] = e_g[20]*e_g[61]; den[397] = e_g[18]*e_g[57];
+    Kc[398] = e_g[20]*e_g[62]; den[398] = e_g[18]*e_g[58];
+    Kc[399] = e_g[17]*e_g[60]; den[399] = e_g[16]*e_g[56];
+    Kc[400] = e_g[17]*e_g[61]; den[400] = e_g[16]*e_g[57];
+    Kc[401] = e_g[17]*e_g[62]; den[401] = e_g[16]*e_g[58];
+    Kc[402] = e_g[16]*e_g[60]; den[402] = e_g[14]*e_g[56];
+    Kc[403] = e_g[16]*e_g[61]; den[403] = e_g[14]*e_g[57];
+    Kc[404] = e_g[16]*e_g[62]; den[404] = e_g[14]*e_g[58];
+    Kc[405] = e_g[16]*e_g[60]; den[405] = e_g[28]*e_g[53];
+    Kc[406] = e_g[3]*e_g[60]; den[406] = e_g[1]*e_g[2]*e_g[68];
+    Kc[407] = e_g[3]*e_g[61]; den[407] = e_g[1]*e_g[2]*e_g[67];
+    Kc[408] = e_g[3]*e_g[62]; den[408] = e_g[2]*e_g[66];
+    Kc[409] = e_g[6]*e_g[60]; den[409] = e_g[1]*e_g[4]*e_g[68];
+    Kc[410] = e_g[6]*e_g[61]; den[410] = e_g[1]*e_g[4]*e_g[67];
+    Kc[411] = e_g[6]*e_g[62]; den[411] = e_g[4]*e_g[66];
+    Kc[412] = e_g[6]*e_g[60]; den[412] = e_g[3]*e_g[56];
+    Kc[413] = e_g[6]*e_g[61]; den[413] = e_g[3]*e_g[57];
+    Kc[414] = e_g[6]*e_g[62]; den[414] = e_g[3]*e_g[58];
+    Kc[415] = e_g[1]*e_g[66]; den[415] = e_g[53]*e_g[67];
+    Kc[416] = e_g[0]*e_g[66]; den[416] = e_g[1]*e_g[53]*e_g[67];
+    Kc[417] = e_g[5]*e_g[66]; den[417] = e_g[4]*e_g[53]*e_g[67];
+    Kc[418] = e_g[13]*e_g[66]; den[418] = e_g[12]*e_g[53]*e_g[67];
+    Kc[419] = e_g[26]*e_g[66]; den[419] = e_g[25]*e_g[53]*e_g[67];
+    Kc[420] = e_g[24]*e_g[66]; den[420] = e_g[23]*e_g[53]*e_g[67];
+    Kc[421] = e_g[17]*e_g[66]; den[421] = e_g[16]*e_g[53]*e_g[67];
+    Kc[422] = e_g[16]*e_g[66]; den[422] = e_g[14]*e_g[53]*e_g[67];
+    Kc[423] = e_g[3]*e_g[63]; den[423] = e_g[2]*e_g[68];
+    Kc[424] = e_g[3]*e_g[64]; den[424] = e_g[2]*e_g[67];
+    Kc[425] = e_g[2]*e_g[63]; den[425] = e_g[14]*e_g[53];
+    Kc[426] = e_g[2]*e_g[64]; den[426] = e_g[54]*e_g[69];
+    Kc[427] = e_g[4]*e_g[63]; den[427] = e_g[1]*e_g[68];
+    Kc[428] = e_g[4]*e_g[64]; den[428] = e_g[1]*e_g[67];
+    Kc[429] = e_g[4]*e_g[63]; den[429] = e_g[16]*e_g[53];
+    Kc[430] = e_g[4]*e_g[64]; den[430] = e_g[53]*e_g[69];
+    Kc[431] = e_g[6]*e_g[63]; den[431] = e_g[4]*e_g[68];
+    Kc[432] = e_g[6]*e_g[64]; den[432] = e_g[4]*e_g[67];
+    Kc[433] = e_g[6]*e_g[63]; den[433] = e_g[3]*e_g[60];
+    Kc[434] = e_g[6]*e_g[64]; den[434] = e_g[3]*e_g[61];
+    Kc[435] = e_g[5]*e_g[63]; den[435] = e_g[17]*e_g[53];
+    Kc[436] = e_g[5]*e_g[64]; den[436] = e_g[53]*e_g[68];
+    Kc[437] = e_g[1]*e_g[64]; den[437] = e_g[53]*e_g[65];
+    Kc[438] = e_g[17]*e_g[63]; den[438] = e_g[16]*e_g[60];
+    Kc[439] = e_g[17]*e_g[63]; den[439] = e_g[28]*e_g[53];
+    Kc[440] = e_g[17]*e_g[64]; den[440] = e_g[16]*e_g[61];
+    Kc[441] = e_g[16]*e_g[63]; den[441] = e_g[14]*e_g[60];
+    Kc[442] = e_g[16]*e_g[64]; den[442] = e_g[14]*e_g[61];
+    Kc[443] = e_g[3]*e_g[65]; den[443] = e_g[2]*e_g[69];
+    Kc[444] = e_g[5]*e_g[65]; den[444] = e_g[1]*e_g[68];
+    Kc[445] = e_g[1]*e_g[65]; den[445] = e_g[8]*e_g[53];
+    Kc[446] = e_g[2]*e_g[65]; den[446] = e_g[14]*e_g[54];
+    Kc[447] = e_g[4]*e_g[65]; den[447] = e_g[14]*e_g[53];
+    Kc[448] = e_g[6]*e_g[65]; den[448] = e_g[4]*e_g[69];
+    Kc[449] = e_g[24]*e_g[65]; den[449] = e_g[22]*e_g[60];
+    Kc[450] = e_g[17]*e_g[65]; den[450] = e_g[16]*e_g[63];
+    Kc[451] = e_g[16]*e_g[65]; den[451] = e_g[14]*e_g[63];
+    Kc[452] = e_g[54]*e_g[69]; den[452] = e_g[67];
+    Kc[453] = e_g[1]*e_g[68]; den[453] = e_g[0]*e_g[69];
+    Kc[454] = e_g[1]*e_g[67]; den[454] = e_g[53]*e_g[69];
+    Kc[455] = e_g[1]*e_g[67]; den[455] = e_g[53]*e_g[69];
+    Kc[456] = e_g[1]*e_g[67]; den[456] = e_g[53]*e_g[69];
+    Kc[457] = e_g[5]*e_g[67]; den[457] = e_g[15]*e_g[53]*e_g[53];
+    Kc[458] = e_g[2]*e_g[68]; den[458] = e_g[4]*e_g[69];
+    Kc[459] = e_g[4]*e_g[68]; den[459] = e_g[5]*e_g[69];
+    Kc[460] = e_g[4]*e_g[67]; den[460] = e_g[15]*e_g[53]*e_g[54];
+    Kc[461] = e_g[7]*e_g[69]; den[461] = e_g[6]*e_g[68];
+    Kc[462] = e_g[12]*e_g[68]; den[462] = e_g[13]*e_g[69];
+    Kc[463] = e_g[60]*e_g[68]; den[463] = e_g[56]*e_g[69];
+    Kc[464] = e_g[61]*e_g[68]; den[464] = e_g[57]*e_g[69];
+    Kc[465] = e_g[62]*e_g[68]; den[465] = e_g[58]*e_g[69];
+    Kc[466] = e_g[23]*e_g[68]; den[466] = e_g[24]*e_g[69];
+    Kc[467] = e_g[2]*e_g[69]; den[467] = e_g[15]*e_g[54];
+    Kc[468] = e_g[4]*e_g[69]; den[468] = e_g[15]*e_g[53];
+    Kc[469] = e_g[6]*e_g[69]; den[469] = e_g[4]*e_g[15]*e_g[54];
+    Kc[470] = e_g[12]*e_g[69]; den[470] = e_g[28]*e_g[53];
+    Kc[471] = e_g[69]*e_g[69]; den[471] = e_g[14]*e_g[67];
+    Kc[472] = e_g[12]*e_g[60]; den[472] = e_g[24]*e_g[53];
+    Kc[473] = e_g[11]*e_g[56]; den[473] = e_g[24]*e_g[53];
+    Kc[474] = e_g[13]*e_g[63]; den[474] = e_g[24]*e_g[53];
+    Kc[475] = e_g[12]*e_g[60]; den[475] = e_g[13]*e_g[63];
+    Kc[476] = e_g[60]*e_g[60]; den[476] = e_g[56]*e_g[63];
+    Kc[477] = e_g[60]*e_g[61]; den[477] = e_g[57]*e_g[63];
+    Kc[478] = e_g[60]*e_g[62]; den[478] = e_g[58]*e_g[63];
+    Kc[479] = e_g[12]*e_g[61]; den[479] = e_g[13]*e_g[64];
+    Kc[480] = e_g[60]*e_g[61]; den[480] = e_g[56]*e_g[64];
+    Kc[481] = e_g[61]*e_g[61]; den[481] = e_g[57]*e_g[64];
+    Kc[482] = e_g[61]*e_g[62]; den[482] = e_g[58]*e_g[64];
+    Kc[483] = e_g[11]*e_g[63]; den[483] = e_g[22]*e_g[53];
+    Kc[484] = e_g[10]*e_g[60]; den[484] = e_g[24]*e_g[54];
+    Kc[485] = e_g[11]*e_g[60]; den[485] = e_g[24]*e_g[54];
+    Kc[486] = e_g[27]*e_g[54]; den[486] = e_g[14]*e_g[63];
+    Kc[487] = e_g[13]*e_g[54]; den[487] = e_g[12]*e_g[53];
+    Kc[488] = e_g[54]*e_g[56]; den[488] = e_g[53]*e_g[60];
+    Kc[489] = e_g[54]*e_g[57]; den[489] = e_g[53]*e_g[61];
+    Kc[490] = e_g[54]*e_g[58]; den[490] = e_g[53]*e_g[62];
+    Kc[491] = e_g[20]*e_g[54]; den[491] = e_g[19]*e_g[53];
+    Kc[492] = e_g[20]*e_g[54]; den[492] = e_g[18]*e_g[53];
+    Kc[493] = e_g[17]*e_g[54]; den[493] = e_g[16]*e_g[53];
+    Kc[494] = e_g[54]*e_g[68]; den[494] = e_g[53]*e_g[69];
+    Kc[495] = e_g[19]*e_g[54]; den[495] = e_g[17]*e_g[53];
+    Kc[496] = e_g[16]*e_g[54]; den[496] = e_g[14]*e_g[53];
+    Kc[497] = e_g[26]*e_g[54]; den[497] = e_g[25]*e_g[53];
+    Kc[498] = e_g[24]*e_g[54]; den[498] = e_g[23]*e_g[53];
+    Kc[499] = e_g[23]*e_g[54]; den[499] = e_g[22]*e_g[53];
+    Kc[500] = e_g[12]*e_g[59]; den[500] = e_g[56]*e_g[62];
+    Kc[501] = e_g[14]*e_g[66]; den[501] = e_g[15]*e_g[62];
+    Kc[502] = e_g[64]*e_g[69]; den[502] = e_g[14]*e_g[62];
+    Kc[503] = e_g[1]*e_g[55]; den[503] = e_g[53]*e_g[54];
+    Kc[504] = e_g[55]*e_g[62]; den[504] = e_g[54]*e_g[59];
+    Kc[505] = e_g[12]*e_g[55]; den[505] = e_g[54]*e_g[56];
+    Kc[506] = e_g[55]*e_g[64]; den[506] = e_g[54]*e_g[62];
+    Kc[507] = e_g[55]*e_g[69]; den[507] = e_g[54]*e_g[67];
+    Kc[508] = e_g[0]*e_g[55]; den[508] = e_g[1]*e_g[53]*e_g[54];
+    Kc[509] = e_g[14]*e_g[55]; den[509] = e_g[54]*e_g[69];
+    Kc[510] = e_g[8]*e_g[55]; den[510] = e_g[54]*e_g[65];
+    Kc[511] = e_g[55]*e_g[65]; den[511] = e_g[54]*e_g[64];
+    Kc[512] = e_g[13]*e_g[55]; den[512] = e_g[12]*e_g[53]*e_g[54];
+    Kc[513] = e_g[4]*e_g[55]; den[513] = e_g[2]*e_g[53]*e_g[54];
+    Kc[514] = e_g[50]*e_g[54]; den[514] = e_g[53]*e_g[71];
+    Kc[515] = e_g[50]*e_g[54]; den[515] = e_g[53]*e_g[70];
+    Kc[516] = e_g[50]*e_g[62]; den[516] = e_g[58]*e_g[71];
+    Kc[517] = e_g[50]*e_g[62]; den[517] = e_g[58]*e_g[70];
+    int inrange = 1;
+    for (int i=0; i<518; ++i) {
+        inrange &= Kc[i] >= DBL_MIN && Kc[i] <= DBL_MAX && den[i] >= DBL_MIN && den[i] <= DBL_MAX;
+    }
+
+    if (inrange) {
+        for (int i=0; i<518; ++i) {
+            Kc[i] /= den[i];
+        }
+    }
+    else {
+        Kc[0] = exp(g_RT[1] + g_RT[10] - g_RT[12]);
+        Kc[1] = exp(g_RT[1] + g_RT[12] - g_RT[13]);
+        Kc[2] = exp(g_RT[1] + g_RT[16] - g_RT[17]);
+        Kc[3] = exp(g_RT[1] + g_RT[17] - g_RT[18]);
+        Kc[4] = exp(g_RT[1] + g_RT[17] - g_RT[19]);
+        Kc[5] = exp(g_RT[1] + g_RT[18] - g_RT[20]);
+        Kc[6] = exp(g_RT[1] + g_RT[19] - g_RT[20]);
+        Kc[7] = exp(g_RT[1] + g_RT[21] - g_RT[22]);
+        Kc[8] = exp(g_RT[1] + g_RT[22] - g_RT[23]);
+        Kc[9] = exp(g_RT[1] + g_RT[23] - g_RT[24]);
+        Kc[10] = exp(g_RT[1] + g_RT[24] - g_RT[25]);
+        Kc[11] = exp(g_RT[1] + g_RT[25] - g_RT[26]);
+        Kc[12] = exp(g_RT[0] + g_RT[14] - g_RT[17]);
+        Kc[13] = exp(2*g_RT[4] - g_RT[7]);
+        Kc[14] = exp(g_RT[4] + g_RT[12] - g_RT[20]);
+        Kc[15] = exp(g_RT[9] + g_RT[14] - g_RT[27]);
+        Kc[16] = exp(g_RT[10] + g_RT[14] - g_RT[28]);
+        Kc[17] = exp(g_RT[5] + g_RT[11] - g_RT[20]);
+        Kc[18] = exp(2*g_RT[12] - g_RT[26]);
+        Kc[19] = exp(-g_RT[0] - g_RT[22] + g_RT[24]);
+        Kc[20] = exp(g_RT[9] - g_RT[42] + g_RT[47]);
+        Kc[21] = exp(g_RT[0] + g_RT[9] - g_RT[12]);
+        Kc[22] = exp(g_RT[1] + g_RT[28] - g_RT[51]);
+        Kc[23] = exp(g_RT[12] + g_RT[25] - g_RT[50]);
+        Kc[24] = exp(g_RT[12] + g_RT[24] - g_RT[49]);
+        Kc[25] = exp(g_RT[1] + g_RT[49] - g_RT[50]);
+        Kc[26] = exp(g_RT[2] + g_RT[14] - g_RT[15]);
+        Kc[27] = exp(-g_RT[2] + g_RT[37] - g_RT[47]);
+        Kc[28] = exp(g_RT[1] + g_RT[40] - g_RT[41]);
+        Kc[29] = exp(-g_RT[11] - g_RT[53] + g_RT[56]);
+        Kc[30] = exp(-g_RT[54] + g_RT[64] - g_RT[65]);
+        Kc[31] = exp(-g_RT[54] + g_RT[62] - g_RT[64]);
+        Kc[32] = exp(2*g_RT[2] - g_RT[3]);
+        Kc[33] = exp(g_RT[1] + g_RT[2] - g_RT[4]);
+        Kc[34] = exp(g_RT[1] + g_RT[3] - g_RT[6]);
+        Kc[35] = exp(-g_RT[0] + 2*g_RT[1]);
+        Kc[36] = exp(g_RT[1] + g_RT[4] - g_RT[5]);
+        Kc[37] = exp(-g_RT[1] - g_RT[14] + g_RT[16]);
+        Kc[38] = exp(g_RT[2] + g_RT[35] - g_RT[36]);
+        Kc[39] = exp(-g_RT[1] + g_RT[34] - g_RT[47]);
+        Kc[40] = exp(g_RT[1] + g_RT[35] - g_RT[38]);
+        Kc[41] = exp(-g_RT[14] - g_RT[30] + g_RT[46]);
+        Kc[42] = exp(-g_RT[1] - g_RT[39] + g_RT[40]);
+        Kc[43] = exp(-g_RT[14] - g_RT[31] + g_RT[45]);
+        Kc[44] = exp(g_RT[14] + g_RT[54] - g_RT[69]);
+        Kc[45] = exp(-g_RT[1] + g_RT[53] - g_RT[54]);
+        Kc[46] = exp(g_RT[53] - g_RT[57] + g_RT[63]);
+        Kc[47] = exp(-g_RT[53] + g_RT[58] - g_RT[64]);
+        Kc[48] = exp(-g_RT[54] + g_RT[59] - g_RT[62]);
+        Kc[49] = exp(-g_RT[54] + g_RT[66] - g_RT[67]);
+        Kc[50] = exp(-g_RT[14] - g_RT[53] + g_RT[68]);
+        Kc[51] = exp(g_RT[54] + g_RT[54] - g_RT[55]);
+        Kc[52] = exp(g_RT[0] - g_RT[1] + g_RT[2] - g_RT[4]);
+        Kc[53] = exp(g_RT[2] - g_RT[3] - g_RT[4] + g_RT[6]);
+        Kc[54] = exp(g_RT[2] - g_RT[4] - g_RT[6] + g_RT[7]);
+        Kc[55] = exp(-g_RT[1] + g_RT[2] + g_RT[9] - g_RT[14]);
+        Kc[56] = exp(-g_RT[1] + g_RT[2] + g_RT[10] - g_RT[16]);
+        Kc[57] = exp(-g_RT[0] + g_RT[2] + g_RT[11] - g_RT[14]);
+        Kc[58] = exp(-g_RT[1] + g_RT[2] + g_RT[11] - g_RT[16]);
+        Kc[59] = exp(-g_RT[1] + g_RT[2] + g_RT[12] - g_RT[17]);
+        Kc[60] = exp(g_RT[2] - g_RT[4] - g_RT[12] + g_RT[13]);
+        Kc[61] = exp(g_RT[2] - g_RT[4] - g_RT[14] + g_RT[16]);
+        Kc[62] = exp(-g_RT[1] + g_RT[2] - g_RT[15] + g_RT[16]);
+        Kc[63] = exp(g_RT[2] - g_RT[4] - g_RT[16] + g_RT[17]);
+        Kc[64] = exp(g_RT[2] - g_RT[4] - g_RT[17] + g_RT[18]);
+        Kc[65] = exp(g_RT[2] - g_RT[4] - g_RT[17] + g_RT[19]);
+        Kc[66] = exp(g_RT[2] - g_RT[4] - g_RT[18] + g_RT[20]);
+        Kc[67] = exp(g_RT[2] - g_RT[4] - g_RT[19] + g_RT[20]);
+        Kc[68] = exp(g_RT[2] - g_RT[9] - g_RT[14] + g_RT[21]);
+        Kc[69] = exp(-g_RT[1] + g_RT[2] + g_RT[22] - g_RT[27]);
+        Kc[70] = exp(g_RT[2] - g_RT[4] - g_RT[21] + g_RT[22]);
+        Kc[71] = exp(g_RT[2] - g_RT[10] - g_RT[14] + g_RT[22]);
+        Kc[72] = exp(-g_RT[1] + g_RT[2] + g_RT[23] - g_RT[28]);
+        Kc[73] = exp(g_RT[2] - g_RT[12] - g_RT[16] + g_RT[24]);
+        Kc[74] = exp(g_RT[2] - g_RT[12] - g_RT[17] + g_RT[25]);
+        Kc[75] = exp(g_RT[2] - g_RT[4] - g_RT[25] + g_RT[26]);
+        Kc[76] = exp(-g_RT[1] + g_RT[2] - 2*g_RT[14] + g_RT[27]);
+        Kc[77] = exp(g_RT[2] - g_RT[4] - g_RT[27] + g_RT[28]);
+        Kc[78] = exp(g_RT[2] - g_RT[10] - g_RT[15] + g_RT[28]);
+        Kc[79] = exp(-g_RT[2] + g_RT[3] + g_RT[14] - g_RT[15]);
+        Kc[80] = exp(g_RT[3] - g_RT[6] - g_RT[16] + g_RT[17]);
+        Kc[81] = exp(g_RT[1] + 2*g_RT[3] - g_RT[3] - g_RT[6]);
+        Kc[82] = exp(g_RT[1] + g_RT[3] + g_RT[5] - g_RT[5] - g_RT[6]);
+        Kc[83] = exp(g_RT[1] + g_RT[3] - g_RT[6] + g_RT[47] - g_RT[47]);
+        Kc[84] = exp(g_RT[1] + g_RT[3] - g_RT[6] + g_RT[48] - g_RT[48]);
+        Kc[85] = exp(g_RT[1] - g_RT[2] + g_RT[3] - g_RT[4]);
+        Kc[86] = exp(g_RT[0] - 2*g_RT[0] + 2*g_RT[1]);
+        Kc[87] = exp(-g_RT[0] + 2*g_RT[1] + g_RT[5] - g_RT[5]);
+        Kc[88] = exp(-g_RT[0] + 2*g_RT[1] + g_RT[15] - g_RT[15]);
+        Kc[89] = exp(g_RT[1] - g_RT[2] - g_RT[5] + g_RT[6]);
+        Kc[90] = exp(-g_RT[0] + g_RT[1] - g_RT[3] + g_RT[6]);
+        Kc[91] = exp(g_RT[1] - 2*g_RT[4] + g_RT[6]);
+        Kc[92] = exp(-g_RT[0] + g_RT[1] - g_RT[6] + g_RT[7]);
+        Kc[93] = exp(g_RT[1] - g_RT[4] - g_RT[5] + g_RT[7]);
+        Kc[94] = exp(-g_RT[0] + g_RT[1] - g_RT[8] + g_RT[9]);
+        Kc[95] = exp(-g_RT[0] + g_RT[1] - g_RT[9] + g_RT[11]);
+        Kc[96] = exp(-g_RT[0] + g_RT[1] - g_RT[12] + g_RT[13]);
+        Kc[97] = exp(-g_RT[0] + g_RT[1] - g_RT[14] + g_RT[16]);
+        Kc[98] = exp(-g_RT[0] + g_RT[1] - g_RT[16] + g_RT[17]);
+        Kc[99] = exp(-g_RT[0] + g_RT[1] - g_RT[17] + g_RT[18]);
+        Kc[100] = exp(g_RT[1] - g_RT[4] - g_RT[12] + g_RT[18]);
+        Kc[101] = exp(g_RT[1] - g_RT[5] - g_RT[11] + g_RT[18]);
+        Kc[102] = exp(g_RT[1] - g_RT[1] - g_RT[18] + g_RT[19]);
+        Kc[103] = exp(-g_RT[0] + g_RT[1] - g_RT[17] + g_RT[19]);
+        Kc[104] = exp(g_RT[1] - g_RT[4] - g_RT[12] + g_RT[19]);
+        Kc[105] = exp(g_RT[1] - g_RT[5] - g_RT[11] + g_RT[19]);
+        Kc[106] = exp(-g_RT[0] + g_RT[1] - g_RT[18] + g_RT[20]);
+        Kc[107] = exp(-g_RT[0] + g_RT[1] - g_RT[19] + g_RT[20]);
+        Kc[108] = exp(-g_RT[0] + g_RT[1] - g_RT[22] + g_RT[23]);
+        Kc[109] = exp(-g_RT[0] + g_RT[1] - g_RT[23] + g_RT[24]);
+        Kc[110] = exp(-g_RT[0] + g_RT[1] - g_RT[24] + g_RT[25]);
+        Kc[111] = exp(-g_RT[0] + g_RT[1] - g_RT[25] + g_RT[26]);
+        Kc[112] = exp(g_RT[1] - g_RT[11] - g_RT[14] + g_RT[27]);
+        Kc[113] = exp(-g_RT[0] + g_RT[1] - g_RT[27] + g_RT[28]);
+        Kc[114] = exp(g_RT[1] - g_RT[12] - g_RT[14] + g_RT[28]);
+        Kc[115] = exp(g_RT[1] - g_RT[1] - g_RT[28] + g_RT[29]);
+        Kc[116] = exp(g_RT[0] - g_RT[1] + g_RT[4] - g_RT[5]);
+        Kc[117] = exp(-g_RT[2] + 2*g_RT[4] - g_RT[5]);
+        Kc[118] = exp(-g_RT[3] + g_RT[4] - g_RT[5] + g_RT[6]);
+        Kc[119] = exp(g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7]);
+        Kc[121] = exp(-g_RT[1] + g_RT[4] + g_RT[8] - g_RT[14]);
+        Kc[122] = exp(-g_RT[1] + g_RT[4] + g_RT[9] - g_RT[16]);
+        Kc[123] = exp(-g_RT[1] + g_RT[4] + g_RT[10] - g_RT[17]);
+        Kc[124] = exp(g_RT[4] - g_RT[5] - g_RT[9] + g_RT[10]);
+        Kc[125] = exp(-g_RT[1] + g_RT[4] + g_RT[11] - g_RT[17]);
+        Kc[126] = exp(g_RT[4] - g_RT[5] - g_RT[10] + g_RT[12]);
+        Kc[127] = exp(g_RT[4] - g_RT[5] - g_RT[11] + g_RT[12]);
+        Kc[128] = exp(g_RT[4] - g_RT[5] - g_RT[12] + g_RT[13]);
+        Kc[129] = exp(-g_RT[1] + g_RT[4] + g_RT[14] - g_RT[15]);
+        Kc[130] = exp(g_RT[4] - g_RT[5] - g_RT[14] + g_RT[16]);
+        Kc[131] = exp(g_RT[4] - g_RT[5] - g_RT[16] + g_RT[17]);
+        Kc[132] = exp(g_RT[4] - g_RT[5] - g_RT[17] + g_RT[18]);
+        Kc[133] = exp(g_RT[4] - g_RT[5] - g_RT[17] + g_RT[19]);
+        Kc[134] = exp(g_RT[4] - g_RT[5] - g_RT[18] + g_RT[20]);
+        Kc[135] = exp(g_RT[4] - g_RT[5] - g_RT[19] + g_RT[20]);
+        Kc[136] = exp(-g_RT[1] + g_RT[4] + g_RT[21] - g_RT[27]);
+        Kc[137] = exp(-g_RT[1] + g_RT[4] + g_RT[22] - g_RT[28]);
+        Kc[138] = exp(-g_RT[1] + g_RT[4] + g_RT[22] - g_RT[29]);
+        Kc[139] = exp(g_RT[4] - g_RT[5] - g_RT[21] + g_RT[22]);
+        Kc[140] = exp(g_RT[4] - g_RT[12] - g_RT[14] + g_RT[22]);
+        Kc[141] = exp(g_RT[4] - g_RT[5] - g_RT[22] + g_RT[23]);
+        Kc[142] = exp(g_RT[4] - g_RT[5] - g_RT[23] + g_RT[24]);
+        Kc[143] = exp(g_RT[4] - g_RT[5] - g_RT[25] + g_RT[26]);
+        Kc[144] = exp(g_RT[4] - g_RT[5] - g_RT[27] + g_RT[28]);
+        Kc[145] = exp(-g_RT[3] + 2*g_RT[6] - g_RT[7]);
+        Kc[147] = exp(-g_RT[4] + g_RT[6] + g_RT[10] - g_RT[17]);
+        Kc[148] = exp(-g_RT[3] + g_RT[6] + g_RT[12] - g_RT[13]);
+        Kc[149] = exp(-g_RT[4] + g_RT[6] + g_RT[12] - g_RT[19]);
+        Kc[150] = exp(-g_RT[4] + g_RT[6] + g_RT[14] - g_RT[15]);
+        Kc[151] = exp(g_RT[6] - g_RT[7] - g_RT[16] + g_RT[17]);
+        Kc[152] = exp(-g_RT[2] + g_RT[3] + g_RT[8] - g_RT[14]);
+        Kc[153] = exp(-g_RT[1] + g_RT[8] + g_RT[10] - g_RT[21]);
+        Kc[154] = exp(-g_RT[1] + g_RT[8] + g_RT[12] - g_RT[22]);
+        Kc[155] = exp(-g_RT[2] + g_RT[3] + g_RT[9] - g_RT[16]);
+        Kc[156] = exp(g_RT[0] - g_RT[1] + g_RT[9] - g_RT[10]);
+        Kc[157] = exp(-g_RT[1] + g_RT[5] + g_RT[9] - g_RT[17]);
+        Kc[158] = exp(-g_RT[1] + g_RT[9] + g_RT[10] - g_RT[22]);
+        Kc[159] = exp(-g_RT[1] + g_RT[9] + g_RT[12] - g_RT[23]);
+        Kc[160] = exp(-g_RT[1] + g_RT[9] + g_RT[13] - g_RT[24]);
+        Kc[161] = exp(g_RT[9] - g_RT[14] + g_RT[15] - g_RT[16]);
+        Kc[162] = exp(-g_RT[1] + g_RT[9] + g_RT[17] - g_RT[28]);
+        Kc[163] = exp(g_RT[9] - g_RT[14] - g_RT[22] + g_RT[27]);
+        Kc[164] = exp(-g_RT[1] + g_RT[3] - g_RT[4] + g_RT[10] - g_RT[14]);
+        Kc[165] = exp(g_RT[0] - g_RT[1] + g_RT[10] - g_RT[12]);
+        Kc[166] = exp(-g_RT[0] + 2*g_RT[10] - g_RT[22]);
+        Kc[167] = exp(-g_RT[1] + g_RT[10] + g_RT[12] - g_RT[24]);
+        Kc[168] = exp(g_RT[10] - 2*g_RT[12] + g_RT[13]);
+        Kc[169] = exp(g_RT[10] - g_RT[14] - g_RT[23] + g_RT[27]);
+        Kc[170] = exp(-g_RT[10] + g_RT[11] + g_RT[47] - g_RT[47]);
+        Kc[171] = exp(-g_RT[10] + g_RT[11] + g_RT[48] - g_RT[48]);
+        Kc[172] = exp(-g_RT[1] + g_RT[3] - g_RT[4] + g_RT[11] - g_RT[14]);
+        Kc[173] = exp(g_RT[3] - g_RT[5] + g_RT[11] - g_RT[14]);
+        Kc[174] = exp(g_RT[0] - g_RT[1] + g_RT[11] - g_RT[12]);
+        Kc[175] = exp(g_RT[5] - g_RT[5] - g_RT[10] + g_RT[11]);
+        Kc[176] = exp(-g_RT[1] + g_RT[11] + g_RT[12] - g_RT[24]);
+        Kc[177] = exp(g_RT[11] - 2*g_RT[12] + g_RT[13]);
+        Kc[178] = exp(-g_RT[10] + g_RT[11] + g_RT[14] - g_RT[14]);
+        Kc[179] = exp(-g_RT[10] + g_RT[11] + g_RT[15] - g_RT[15]);
+        Kc[180] = exp(g_RT[11] - g_RT[14] + g_RT[15] - g_RT[17]);
+        Kc[181] = exp(g_RT[11] - g_RT[12] - g_RT[25] + g_RT[26]);
+        Kc[182] = exp(-g_RT[2] + g_RT[3] + g_RT[12] - g_RT[19]);
+        Kc[183] = exp(g_RT[3] - g_RT[4] + g_RT[12] - g_RT[17]);
+        Kc[184] = exp(-g_RT[6] + g_RT[7] + g_RT[12] - g_RT[13]);
+        Kc[185] = exp(-g_RT[1] + 2*g_RT[12] - g_RT[25]);
+        Kc[186] = exp(g_RT[12] - g_RT[13] - g_RT[14] + g_RT[16]);
+        Kc[187] = exp(g_RT[12] - g_RT[13] - g_RT[16] + g_RT[17]);
+        Kc[188] = exp(g_RT[12] - g_RT[13] - g_RT[18] + g_RT[20]);
+        Kc[189] = exp(g_RT[12] - g_RT[13] - g_RT[19] + g_RT[20]);
+        Kc[190] = exp(g_RT[12] - g_RT[13] - g_RT[23] + g_RT[24]);
+        Kc[191] = exp(g_RT[12] - g_RT[13] - g_RT[25] + g_RT[26]);
+        Kc[192] = exp(-g_RT[1] + g_RT[5] - g_RT[5] - g_RT[14] + g_RT[16]);
+        Kc[193] = exp(g_RT[3] - g_RT[6] - g_RT[14] + g_RT[16]);
+        Kc[194] = exp(g_RT[3] - g_RT[6] - g_RT[17] + g_RT[18]);
+        Kc[195] = exp(g_RT[3] - g_RT[6] - g_RT[17] + g_RT[19]);
+        Kc[196] = exp(g_RT[3] - g_RT[14] - g_RT[16] + g_RT[21]);
+        Kc[197] = exp(g_RT[0] - g_RT[1] + g_RT[21] - g_RT[22]);
+        Kc[198] = exp(g_RT[3] - g_RT[16] - g_RT[17] + g_RT[23]);
+        Kc[199] = exp(g_RT[3] - g_RT[6] - g_RT[24] + g_RT[25]);
+        Kc[200] = exp(g_RT[3] - g_RT[4] - 2*g_RT[14] + g_RT[27]);
+        Kc[201] = exp(-2*g_RT[14] - g_RT[22] + 2*g_RT[27]);
+        Kc[202] = exp(-g_RT[2] + g_RT[30] + g_RT[35] - g_RT[47]);
+        Kc[203] = exp(-g_RT[2] + g_RT[3] + g_RT[30] - g_RT[35]);
+        Kc[204] = exp(-g_RT[1] + g_RT[4] + g_RT[30] - g_RT[35]);
+        Kc[205] = exp(g_RT[2] - g_RT[3] + g_RT[37] - g_RT[47]);
+        Kc[206] = exp(g_RT[2] - 2*g_RT[35] + g_RT[37]);
+        Kc[207] = exp(g_RT[1] - g_RT[4] + g_RT[37] - g_RT[47]);
+        Kc[208] = exp(g_RT[4] - g_RT[6] + g_RT[37] - g_RT[47]);
+        Kc[209] = exp(-g_RT[4] + g_RT[6] + g_RT[35] - g_RT[36]);
+        Kc[210] = exp(g_RT[2] - g_RT[3] - g_RT[35] + g_RT[36]);
+        Kc[211] = exp(g_RT[1] - g_RT[4] - g_RT[35] + g_RT[36]);
+        Kc[212] = exp(-g_RT[1] + g_RT[2] + g_RT[31] - g_RT[35]);
+        Kc[213] = exp(-g_RT[0] + g_RT[1] - g_RT[30] + g_RT[31]);
+        Kc[214] = exp(-g_RT[1] + g_RT[4] + g_RT[31] - g_RT[38]);
+        Kc[215] = exp(g_RT[4] - g_RT[5] - g_RT[30] + g_RT[31]);
+        Kc[216] = exp(-g_RT[2] + g_RT[3] + g_RT[31] - g_RT[38]);
+        Kc[217] = exp(g_RT[3] - g_RT[4] + g_RT[31] - g_RT[35]);
+        Kc[218] = exp(-g_RT[1] + g_RT[30] + g_RT[31] - g_RT[47]);
+        Kc[219] = exp(-g_RT[0] + g_RT[5] + g_RT[31] - g_RT[38]);
+        Kc[220] = exp(-g_RT[4] + g_RT[31] + g_RT[35] - g_RT[47]);
+        Kc[221] = exp(-g_RT[1] + g_RT[31] + g_RT[35] - g_RT[37]);
+        Kc[222] = exp(g_RT[2] - g_RT[4] - g_RT[31] + g_RT[32]);
+        Kc[223] = exp(-g_RT[1] + g_RT[2] + g_RT[32] - g_RT[38]);
+        Kc[224] = exp(-g_RT[0] + g_RT[1] - g_RT[31] + g_RT[32]);
+        Kc[225] = exp(g_RT[4] - g_RT[5] - g_RT[31] + g_RT[32]);
+        Kc[227] = exp(g_RT[3] - g_RT[6] + g_RT[34] - g_RT[47]);
+        Kc[228] = exp(g_RT[2] - g_RT[4] + g_RT[34] - g_RT[47]);
+        Kc[229] = exp(g_RT[2] - g_RT[31] + g_RT[34] - g_RT[35]);
+        Kc[230] = exp(-g_RT[0] + g_RT[1] + g_RT[34] - g_RT[47]);
+        Kc[231] = exp(g_RT[4] - g_RT[5] + g_RT[34] - g_RT[47]);
+        Kc[232] = exp(g_RT[12] - g_RT[13] + g_RT[34] - g_RT[47]);
+        Kc[233] = exp(g_RT[2] - g_RT[4] - g_RT[35] + g_RT[38]);
+        Kc[234] = exp(-g_RT[0] + g_RT[1] - g_RT[35] + g_RT[38]);
+        Kc[235] = exp(g_RT[4] - g_RT[5] - g_RT[35] + g_RT[38]);
+        Kc[236] = exp(g_RT[3] - g_RT[6] - g_RT[35] + g_RT[38]);
+        Kc[237] = exp(g_RT[2] - g_RT[14] - g_RT[30] + g_RT[39]);
+        Kc[238] = exp(-g_RT[1] + g_RT[4] + g_RT[39] - g_RT[46]);
+        Kc[239] = exp(-g_RT[4] + g_RT[5] + g_RT[39] - g_RT[40]);
+        Kc[240] = exp(-g_RT[2] + g_RT[3] + g_RT[39] - g_RT[46]);
+        Kc[241] = exp(g_RT[0] - g_RT[1] + g_RT[39] - g_RT[40]);
+        Kc[242] = exp(g_RT[2] - g_RT[14] - g_RT[35] + g_RT[46]);
+        Kc[243] = exp(g_RT[1] - g_RT[14] - g_RT[31] + g_RT[46]);
+        Kc[244] = exp(-g_RT[1] + g_RT[4] - g_RT[14] - g_RT[35] + g_RT[46]);
+        Kc[245] = exp(-g_RT[14] + g_RT[30] + g_RT[46] - g_RT[47]);
+        Kc[246] = exp(g_RT[3] - g_RT[15] - g_RT[35] + g_RT[46]);
+        Kc[247] = exp(-g_RT[14] + g_RT[35] - g_RT[37] + g_RT[46]);
+        Kc[248] = exp(-g_RT[15] + g_RT[35] + g_RT[46] - g_RT[47]);
+        Kc[249] = exp(-g_RT[1] + g_RT[2] + g_RT[40] - g_RT[46]);
+        Kc[250] = exp(g_RT[2] - g_RT[14] - g_RT[31] + g_RT[40]);
+        Kc[251] = exp(g_RT[2] - g_RT[4] - g_RT[39] + g_RT[40]);
+        Kc[252] = exp(-g_RT[1] + g_RT[4] + g_RT[40] - g_RT[44]);
+        Kc[253] = exp(-g_RT[1] + g_RT[4] + g_RT[40] - g_RT[45]);
+        Kc[254] = exp(g_RT[4] - g_RT[14] - g_RT[32] + g_RT[40]);
+        Kc[255] = exp(-g_RT[10] + g_RT[30] + g_RT[41] - g_RT[47]);
+        Kc[256] = exp(g_RT[8] - g_RT[30] - g_RT[39] + g_RT[47]);
+        Kc[257] = exp(g_RT[9] - g_RT[30] - g_RT[40] + g_RT[47]);
+        Kc[258] = exp(g_RT[10] - g_RT[31] - g_RT[40] + g_RT[47]);
+        Kc[259] = exp(g_RT[11] - g_RT[31] - g_RT[40] + g_RT[47]);
+        Kc[260] = exp(-g_RT[2] + g_RT[8] + g_RT[35] - g_RT[39]);
+        Kc[261] = exp(g_RT[8] - g_RT[14] - g_RT[30] + g_RT[35]);
+        Kc[262] = exp(-g_RT[2] + g_RT[9] + g_RT[35] - g_RT[40]);
+        Kc[263] = exp(-g_RT[1] + g_RT[9] + g_RT[35] - g_RT[46]);
+        Kc[264] = exp(g_RT[9] - g_RT[16] - g_RT[30] + g_RT[35]);
+        Kc[265] = exp(-g_RT[1] + g_RT[10] + g_RT[35] - g_RT[45]);
+        Kc[266] = exp(-g_RT[4] + g_RT[10] + g_RT[35] - g_RT[40]);
+        Kc[267] = exp(-g_RT[1] + g_RT[10] + g_RT[35] - g_RT[43]);
+        Kc[268] = exp(-g_RT[1] + g_RT[11] + g_RT[35] - g_RT[45]);
+        Kc[269] = exp(-g_RT[4] + g_RT[11] + g_RT[35] - g_RT[40]);
+        Kc[270] = exp(-g_RT[1] + g_RT[11] + g_RT[35] - g_RT[43]);
+        Kc[271] = exp(-g_RT[5] + g_RT[12] + g_RT[35] - g_RT[40]);
+        Kc[272] = exp(-g_RT[4] + g_RT[12] + g_RT[35] - g_RT[41]);
+        Kc[273] = exp(-g_RT[1] + g_RT[2] - g_RT[14] + g_RT[42] - g_RT[47]);
+        Kc[274] = exp(g_RT[2] - g_RT[35] - g_RT[40] + g_RT[42]);
+        Kc[275] = exp(-g_RT[2] + g_RT[3] - g_RT[16] + g_RT[42] - g_RT[47]);
+        Kc[276] = exp(-g_RT[1] + g_RT[4] - g_RT[16] + g_RT[42] - g_RT[47]);
+        Kc[277] = exp(g_RT[1] - g_RT[10] + g_RT[42] - g_RT[47]);
+        Kc[278] = exp(g_RT[2] - g_RT[15] - g_RT[31] + g_RT[45]);
+        Kc[279] = exp(g_RT[2] - g_RT[14] - g_RT[38] + g_RT[45]);
+        Kc[280] = exp(g_RT[2] - g_RT[4] + g_RT[45] - g_RT[46]);
+        Kc[281] = exp(g_RT[1] - g_RT[14] - g_RT[32] + g_RT[45]);
+        Kc[282] = exp(-g_RT[0] + g_RT[1] + g_RT[45] - g_RT[46]);
+        Kc[283] = exp(g_RT[4] - g_RT[5] + g_RT[45] - g_RT[46]);
+        Kc[284] = exp(g_RT[4] - g_RT[15] - g_RT[32] + g_RT[45]);
+        Kc[285] = exp(g_RT[1] - g_RT[1] + g_RT[43] - g_RT[45]);
+        Kc[286] = exp(g_RT[1] - g_RT[4] - g_RT[40] + g_RT[43]);
+        Kc[287] = exp(g_RT[1] - g_RT[14] - g_RT[32] + g_RT[43]);
+        Kc[288] = exp(g_RT[1] - g_RT[1] + g_RT[44] - g_RT[45]);
+        Kc[289] = exp(-g_RT[14] + g_RT[27] + g_RT[35] - g_RT[43]);
+        Kc[290] = exp(-g_RT[1] + g_RT[12] + g_RT[30] - g_RT[41]);
+        Kc[291] = exp(-g_RT[0] + g_RT[12] + g_RT[30] - g_RT[40]);
+        Kc[292] = exp(-g_RT[0] + g_RT[1] - g_RT[32] + g_RT[33]);
+        Kc[293] = exp(g_RT[4] - g_RT[5] - g_RT[32] + g_RT[33]);
+        Kc[294] = exp(g_RT[2] - g_RT[4] - g_RT[32] + g_RT[33]);
+        Kc[295] = exp(-g_RT[14] + g_RT[15] + g_RT[31] - g_RT[38]);
+        Kc[296] = exp(-g_RT[35] + g_RT[36] + g_RT[39] - g_RT[46]);
+        Kc[297] = exp(-g_RT[15] + g_RT[36] - g_RT[37] + g_RT[46]);
+        Kc[298] = exp(-g_RT[14] + g_RT[15] + g_RT[30] - g_RT[35]);
+        Kc[299] = exp(-g_RT[0] - g_RT[1] + g_RT[2] + g_RT[12] - g_RT[14]);
+        Kc[300] = exp(-g_RT[1] + g_RT[2] + g_RT[24] - g_RT[51]);
+        Kc[301] = exp(-g_RT[1] + g_RT[2] + g_RT[25] - g_RT[52]);
+        Kc[303] = exp(-g_RT[0] + g_RT[4] + g_RT[12] - g_RT[17]);
+        Kc[304] = exp(-2*g_RT[1] + g_RT[3] + g_RT[10] - g_RT[15]);
+        Kc[305] = exp(-g_RT[2] + g_RT[3] + g_RT[10] - g_RT[17]);
+        Kc[306] = exp(-2*g_RT[1] + g_RT[10] + g_RT[10] - g_RT[22]);
+        Kc[307] = exp(-g_RT[0] + g_RT[5] + g_RT[11] - g_RT[17]);
+        Kc[308] = exp(-g_RT[2] + g_RT[3] + g_RT[23] - g_RT[51]);
+        Kc[309] = exp(g_RT[3] - g_RT[6] - g_RT[22] + g_RT[23]);
+        Kc[310] = exp(g_RT[2] - g_RT[4] - g_RT[51] + g_RT[52]);
+        Kc[311] = exp(g_RT[2] - g_RT[4] - g_RT[12] - g_RT[14] + g_RT[52]);
+        Kc[312] = exp(g_RT[3] - g_RT[6] - g_RT[12] - g_RT[14] + g_RT[52]);
+        Kc[313] = exp(-g_RT[0] + g_RT[1] - g_RT[51] + g_RT[52]);
+        Kc[314] = exp(-g_RT[0] + g_RT[1] - g_RT[12] - g_RT[14] + g_RT[52]);
+        Kc[315] = exp(g_RT[4] - g_RT[5] - g_RT[12] - g_RT[14] + g_RT[52]);
+        Kc[316] = exp(g_RT[6] - g_RT[7] - g_RT[12] - g_RT[14] + g_RT[52]);
+        Kc[317] = exp(g_RT[12] - g_RT[12] - g_RT[13] - g_RT[14] + g_RT[52]);
+        Kc[318] = exp(-g_RT[1] + g_RT[2] - g_RT[10] - g_RT[15] + g_RT[51]);
+        Kc[319] = exp(g_RT[3] - g_RT[4] - g_RT[14] - g_RT[17] + g_RT[51]);
+        Kc[320] = exp(g_RT[3] - g_RT[4] - 2*g_RT[16] + g_RT[51]);
+        Kc[321] = exp(g_RT[1] - g_RT[12] - g_RT[16] + g_RT[51]);
+        Kc[322] = exp(-g_RT[0] + g_RT[1] - g_RT[28] + g_RT[51]);
+        Kc[323] = exp(g_RT[4] - g_RT[5] - g_RT[28] + g_RT[51]);
+        Kc[324] = exp(g_RT[4] - g_RT[16] - g_RT[18] + g_RT[51]);
+        Kc[325] = exp(g_RT[2] - g_RT[4] - g_RT[49] + g_RT[50]);
+        Kc[326] = exp(-g_RT[0] + g_RT[1] - g_RT[49] + g_RT[50]);
+        Kc[327] = exp(g_RT[4] - g_RT[5] - g_RT[49] + g_RT[50]);
+        Kc[328] = exp(-g_RT[6] + g_RT[7] + g_RT[49] - g_RT[50]);
+        Kc[329] = exp(g_RT[12] - g_RT[13] - g_RT[49] + g_RT[50]);
+        Kc[330] = exp(g_RT[2] - g_RT[17] - g_RT[25] + g_RT[49]);
+        Kc[331] = exp(g_RT[1] - g_RT[12] - g_RT[25] + g_RT[49]);
+        Kc[332] = exp(g_RT[4] - g_RT[18] - g_RT[25] + g_RT[49]);
+        Kc[333] = exp(-g_RT[3] + g_RT[6] + g_RT[49] - g_RT[50]);
+        Kc[334] = exp(-g_RT[4] + g_RT[6] - g_RT[17] - g_RT[25] + g_RT[49]);
+        Kc[335] = exp(g_RT[12] - 2*g_RT[25] + g_RT[49]);
+        Kc[336] = exp(g_RT[1] - g_RT[11] - g_RT[53] + g_RT[60]);
+        Kc[337] = exp(-g_RT[0] + g_RT[1] + g_RT[60] - g_RT[63]);
+        Kc[338] = exp(-g_RT[0] + g_RT[1] + g_RT[58] - g_RT[62]);
+        Kc[339] = exp(g_RT[1] - g_RT[54] - g_RT[57] + g_RT[58]);
+        Kc[340] = exp(g_RT[1] - g_RT[9] - g_RT[53] + g_RT[63]);
+        Kc[341] = exp(-g_RT[0] + g_RT[1] + g_RT[63] - g_RT[65]);
+        Kc[342] = exp(-g_RT[0] + g_RT[9] + g_RT[53] - g_RT[65]);
+        Kc[343] = exp(g_RT[1] - g_RT[14] - g_RT[53] + g_RT[69]);
+        Kc[344] = exp(-g_RT[1] + g_RT[2] + g_RT[60] - g_RT[68]);
+        Kc[345] = exp(-g_RT[1] + g_RT[2] + g_RT[61] - g_RT[67]);
+        Kc[346] = exp(g_RT[2] - g_RT[54] + g_RT[62] - g_RT[67]);
+        Kc[347] = exp(g_RT[4] - g_RT[17] - g_RT[53] + g_RT[60]);
+        Kc[348] = exp(g_RT[4] - g_RT[53] + g_RT[61] - g_RT[68]);
+        Kc[349] = exp(g_RT[4] - g_RT[53] + g_RT[62] - g_RT[67]);
+        Kc[350] = exp(g_RT[0] - g_RT[1] - g_RT[53] + g_RT[54]);
+        Kc[351] = exp(-g_RT[2] + g_RT[4] - g_RT[53] + g_RT[54]);
+        Kc[352] = exp(-g_RT[3] + g_RT[6] - g_RT[53] + g_RT[54]);
+        Kc[353] = exp(-g_RT[4] + g_RT[5] - g_RT[53] + g_RT[54]);
+        Kc[354] = exp(-g_RT[6] + g_RT[7] - g_RT[53] + g_RT[54]);
+        Kc[355] = exp(g_RT[0] - g_RT[56] + g_RT[63]);
+        Kc[356] = exp(g_RT[1] - g_RT[56] + g_RT[60]);
+        Kc[357] = exp(g_RT[0] - g_RT[57] + g_RT[64]);
+        Kc[358] = exp(g_RT[1] - g_RT[57] + g_RT[61]);
+        Kc[359] = exp(-g_RT[0] + g_RT[11] + g_RT[53] - g_RT[63]);
+        Kc[360] = exp(-g_RT[11] + g_RT[12] - g_RT[53] + g_RT[54]);
+        Kc[361] = exp(-g_RT[1] + g_RT[12] + g_RT[54] - g_RT[60]);
+        Kc[362] = exp(-g_RT[0] + g_RT[53] + g_RT[63] - g_RT[64]);
+        Kc[363] = exp(g_RT[1] - g_RT[53] + g_RT[61] - g_RT[63]);
+        Kc[364] = exp(-g_RT[0] + g_RT[1] + g_RT[61] - g_RT[64]);
+        Kc[365] = exp(-g_RT[53] + g_RT[54] + g_RT[60] - g_RT[63]);
+        Kc[366] = exp(g_RT[1] - g_RT[53] + g_RT[62] - g_RT[64]);
+        Kc[367] = exp(-g_RT[53] + g_RT[54] + g_RT[61] - g_RT[64]);
+        Kc[368] = exp(-g_RT[0] + g_RT[1] + g_RT[56] - g_RT[60]);
+        Kc[369] = exp(-g_RT[0] + g_RT[1] + g_RT[57] - g_RT[61]);
+        Kc[370] = exp(g_RT[1] - g_RT[12] - g_RT[53] + g_RT[56]);
+        Kc[371] = exp(g_RT[1] - g_RT[53] + g_RT[57] - g_RT[60]);
+        Kc[372] = exp(g_RT[1] - g_RT[53] + g_RT[58] - g_RT[61]);
+        Kc[373] = exp(g_RT[1] - g_RT[53] + g_RT[59] - g_RT[62]);
+        Kc[374] = exp(g_RT[1] - g_RT[54] - g_RT[58] + g_RT[59]);
+        Kc[375] = exp(g_RT[2] - g_RT[4] + g_RT[56] - g_RT[60]);
+        Kc[376] = exp(g_RT[2] - g_RT[4] + g_RT[57] - g_RT[61]);
+        Kc[377] = exp(g_RT[2] - g_RT[4] + g_RT[58] - g_RT[62]);
+        Kc[378] = exp(g_RT[4] - g_RT[5] + g_RT[56] - g_RT[60]);
+        Kc[379] = exp(g_RT[4] - g_RT[5] + g_RT[57] - g_RT[61]);
+        Kc[380] = exp(g_RT[4] - g_RT[5] + g_RT[58] - g_RT[62]);
+        Kc[381] = exp(-g_RT[6] + g_RT[7] - g_RT[56] + g_RT[60]);
+        Kc[382] = exp(-g_RT[6] + g_RT[7] - g_RT[57] + g_RT[61]);
+        Kc[383] = exp(-g_RT[6] + g_RT[7] - g_RT[58] + g_RT[62]);
+        Kc[384] = exp(g_RT[12] - g_RT[13] + g_RT[56] - g_RT[60]);
+        Kc[385] = exp(g_RT[12] - g_RT[13] + g_RT[57] - g_RT[61]);
+        Kc[386] = exp(-g_RT[12] + g_RT[13] - g_RT[58] + g_RT[62]);
+        Kc[387] = exp(g_RT[23] - g_RT[24] + g_RT[56] - g_RT[60]);
+        Kc[388] = exp(g_RT[23] - g_RT[24] + g_RT[57] - g_RT[61]);
+        Kc[389] = exp(-g_RT[23] + g_RT[24] - g_RT[58] + g_RT[62]);
+        Kc[390] = exp(g_RT[56] - g_RT[58] - g_RT[60] + g_RT[62]);
+        Kc[391] = exp(-g_RT[56] + g_RT[57] + g_RT[60] - g_RT[61]);
+        Kc[392] = exp(g_RT[57] - g_RT[58] - g_RT[61] + g_RT[62]);
+        Kc[393] = exp(-g_RT[19] + g_RT[20] - g_RT[56] + g_RT[60]);
+        Kc[394] = exp(-g_RT[19] + g_RT[20] - g_RT[57] + g_RT[61]);
+        Kc[395] = exp(-g_RT[19] + g_RT[20] - g_RT[58] + g_RT[62]);
+        Kc[396] = exp(-g_RT[18] + g_RT[20] - g_RT[56] + g_RT[60]);
+        Kc[397] = exp(-g_RT[18] + g_RT[20] - g_RT[57] + g_RT[61]);
+        Kc[398] = exp(-g_RT[18] + g_RT[20] - g_RT[58] + g_RT[62]);
+        Kc[399] = exp(-g_RT[16] + g_RT[17] - g_RT[56] + g_RT[60]);
+        Kc[400] = exp(-g_RT[16] + g_RT[17] - g_RT[57] + g_RT[61]);
+        Kc[401] = exp(-g_RT[16] + g_RT[17] - g_RT[58] + g_RT[62]);
+        Kc[402] = exp(-g_RT[14] + g_RT[16] - g_RT[56] + g_RT[60]);
+        Kc[403] = exp(-g_RT[14] + g_RT[16] - g_RT[57] + g_RT[61]);
+        Kc[404] = exp(-g_RT[14] + g_RT[16] - g_RT[58] + g_RT[62]);
+        Kc[405] = exp(g_RT[16] - g_RT[28] - g_RT[53] + g_RT[60]);
+        Kc[406] = exp(-g_RT[1] - g_RT[2] + g_RT[3] + g_RT[60] - g_RT[68]);
+        Kc[407] = exp(-g_RT[1] - g_RT[2] + g_RT[3] + g_RT[61] - g_RT[67]);
+        Kc[408] = exp(-g_RT[2] + g_RT[3] + g_RT[62] - g_RT[66]);
+        Kc[409] = exp(-g_RT[1] - g_RT[4] + g_RT[6] + g_RT[60] - g_RT[68]);
+        Kc[410] = exp(-g_RT[1] - g_RT[4] + g_RT[6] + g_RT[61] - g_RT[67]);
+        Kc[411] = exp(-g_RT[4] + g_RT[6] + g_RT[62] - g_RT[66]);
+        Kc[412] = exp(-g_RT[3] + g_RT[6] - g_RT[56] + g_RT[60]);
+        Kc[413] = exp(-g_RT[3] + g_RT[6] - g_RT[57] + g_RT[61]);
+        Kc[414] = exp(-g_RT[3] + g_RT[6] - g_RT[58] + g_RT[62]);
+        Kc[415] = exp(g_RT[1] - g_RT[53] + g_RT[66] - g_RT[67]);
+        Kc[416] = exp(g_RT[0] - g_RT[1] - g_RT[53] + g_RT[66] - g_RT[67]);
+        Kc[417] = exp(-g_RT[4] + g_RT[5] - g_RT[53] + g_RT[66] - g_RT[67]);
+        Kc[418] = exp(-g_RT[12] + g_RT[13] - g_RT[53] + g_RT[66] - g_RT[67]);
+        Kc[419] = exp(-g_RT[25] + g_RT[26] - g_RT[53] + g_RT[66] - g_RT[67]);
+        Kc[420] = exp(-g_RT[23] + g_RT[24] - g_RT[53] + g_RT[66] - g_RT[67]);
+        Kc[421] = exp(-g_RT[16] + g_RT[17] - g_RT[53] + g_RT[66] - g_RT[67]);
+        Kc[422] = exp(-g_RT[14] + g_RT[16] - g_RT[53] + g_RT[66] - g_RT[67]);
+        Kc[423] = exp(-g_RT[2] + g_RT[3] + g_RT[63] - g_RT[68]);
+        Kc[424] = exp(-g_RT[2] + g_RT[3] + g_RT[64] - g_RT[67]);
+        Kc[425] = exp(g_RT[2] - g_RT[14] - g_RT[53] + g_RT[63]);
+        Kc[426] = exp(g_RT[2] - g_RT[54] + g_RT[64] - g_RT[69]);
+        Kc[427] = exp(-g_RT[1] + g_RT[4] + g_RT[63] - g_RT[68]);
+        Kc[428] = exp(-g_RT[1] + g_RT[4] + g_RT[64] - g_RT[67]);
+        Kc[429] = exp(g_RT[4] - g_RT[16] - g_RT[53] + g_RT[63]);
+        Kc[430] = exp(g_RT[4] - g_RT[53] + g_RT[64] - g_RT[69]);
+        Kc[431] = exp(-g_RT[4] + g_RT[6] + g_RT[63] - g_RT[68]);
+        Kc[432] = exp(-g_RT[4] + g_RT[6] + g_RT[64] - g_RT[67]);
+        Kc[433] = exp(-g_RT[3] + g_RT[6] - g_RT[60] + g_RT[63]);
+        Kc[434] = exp(-g_RT[3] + g_RT[6] - g_RT[61] + g_RT[64]);
+        Kc[435] = exp(g_RT[5] - g_RT[17] - g_RT[53] + g_RT[63]);
+        Kc[436] = exp(g_RT[5] - g_RT[53] + g_RT[64] - g_RT[68]);
+        Kc[437] = exp(g_RT[1] - g_RT[53] + g_RT[64] - g_RT[65]);
+        Kc[438] = exp(-g_RT[16] + g_RT[17] - g_RT[60] + g_RT[63]);
+        Kc[439] = exp(g_RT[17] - g_RT[28] - g_RT[53] + g_RT[63]);
+        Kc[440] = exp(-g_RT[16] + g_RT[17] - g_RT[61] + g_RT[64]);
+        Kc[441] = exp(-g_RT[14] + g_RT[16] - g_RT[60] + g_RT[63]);
+        Kc[442] = exp(-g_RT[14] + g_RT[16] - g_RT[61] + g_RT[64]);
+        Kc[443] = exp(-g_RT[2] + g_RT[3] + g_RT[65] - g_RT[69]);
+        Kc[444] = exp(-g_RT[1] + g_RT[5] + g_RT[65] - g_RT[68]);
+        Kc[445] = exp(g_RT[1] - g_RT[8] - g_RT[53] + g_RT[65]);
+        Kc[446] = exp(g_RT[2] - g_RT[14] - g_RT[54] + g_RT[65]);
+        Kc[447] = exp(g_RT[4] - g_RT[14] - g_RT[53] + g_RT[65]);
+        Kc[448] = exp(-g_RT[4] + g_RT[6] + g_RT[65] - g_RT[69]);
+        Kc[449] = exp(-g_RT[22] + g_RT[24] - g_RT[60] + g_RT[65]);
+        Kc[450] = exp(-g_RT[16] + g_RT[17] - g_RT[63] + g_RT[65]);
+        Kc[451] = exp(-g_RT[14] + g_RT[16] - g_RT[63] + g_RT[65]);
+        Kc[452] = exp(g_RT[54] - g_RT[67] + g_RT[69]);
+        Kc[453] = exp(-g_RT[0] + g_RT[1] + g_RT[68] - g_RT[69]);
+        Kc[454] = exp(g_RT[1] - g_RT[53] + g_RT[67] - g_RT[69]);
+        Kc[457] = exp(g_RT[5] - g_RT[15] - g_RT[53] - g_RT[53] + g_RT[67]);
+        Kc[458] = exp(g_RT[2] - g_RT[4] + g_RT[68] - g_RT[69]);
+        Kc[459] = exp(g_RT[4] - g_RT[5] + g_RT[68] - g_RT[69]);
+        Kc[460] = exp(g_RT[4] - g_RT[15] - g_RT[53] - g_RT[54] + g_RT[67]);
+        Kc[461] = exp(-g_RT[6] + g_RT[7] - g_RT[68] + g_RT[69]);
+        Kc[462] = exp(g_RT[12] - g_RT[13] + g_RT[68] - g_RT[69]);
+        Kc[463] = exp(-g_RT[56] + g_RT[60] + g_RT[68] - g_RT[69]);
+        Kc[464] = exp(-g_RT[57] + g_RT[61] + g_RT[68] - g_RT[69]);
+        Kc[465] = exp(-g_RT[58] + g_RT[62] + g_RT[68] - g_RT[69]);
+        Kc[466] = exp(g_RT[23] - g_RT[24] + g_RT[68] - g_RT[69]);
+        Kc[467] = exp(g_RT[2] - g_RT[15] - g_RT[54] + g_RT[69]);
+        Kc[468] = exp(g_RT[4] - g_RT[15] - g_RT[53] + g_RT[69]);
+        Kc[469] = exp(-g_RT[4] + g_RT[6] - g_RT[15] - g_RT[54] + g_RT[69]);
+        Kc[470] = exp(g_RT[12] - g_RT[28] - g_RT[53] + g_RT[69]);
+        Kc[471] = exp(-g_RT[14] - g_RT[67] + g_RT[69] + g_RT[69]);
+        Kc[472] = exp(g_RT[12] - g_RT[24] - g_RT[53] + g_RT[60]);
+        Kc[473] = exp(g_RT[11] - g_RT[24] - g_RT[53] + g_RT[56]);
+        Kc[474] = exp(g_RT[13] - g_RT[24] - g_RT[53] + g_RT[63]);
+        Kc[475] = exp(g_RT[12] - g_RT[13] + g_RT[60] - g_RT[63]);
+        Kc[476] = exp(-g_RT[56] + g_RT[60] + g_RT[60] - g_RT[63]);
+        Kc[477] = exp(-g_RT[57] + g_RT[60] + g_RT[61] - g_RT[63]);
+        Kc[478] = exp(-g_RT[58] + g_RT[60] + g_RT[62] - g_RT[63]);
+        Kc[479] = exp(g_RT[12] - g_RT[13] + g_RT[61] - g_RT[64]);
+        Kc[480] = exp(-g_RT[56] + g_RT[60] + g_RT[61] - g_RT[64]);
+        Kc[481] = exp(-g_RT[57] + g_RT[61] + g_RT[61] - g_RT[64]);
+        Kc[482] = exp(-g_RT[58] + g_RT[61] + g_RT[62] - g_RT[64]);
+        Kc[483] = exp(g_RT[11] - g_RT[22] - g_RT[53] + g_RT[63]);
+        Kc[484] = exp(g_RT[10] - g_RT[24] - g_RT[54] + g_RT[60]);
+        Kc[485] = exp(g_RT[11] - g_RT[24] - g_RT[54] + g_RT[60]);
+        Kc[486] = exp(-g_RT[14] + g_RT[27] + g_RT[54] - g_RT[63]);
+        Kc[487] = exp(-g_RT[12] + g_RT[13] - g_RT[53] + g_RT[54]);
+        Kc[488] = exp(-g_RT[53] + g_RT[54] + g_RT[56] - g_RT[60]);
+        Kc[489] = exp(-g_RT[53] + g_RT[54] + g_RT[57] - g_RT[61]);
+        Kc[490] = exp(-g_RT[53] + g_RT[54] + g_RT[58] - g_RT[62]);
+        Kc[491] = exp(-g_RT[19] + g_RT[20] - g_RT[53] + g_RT[54]);
+        Kc[492] = exp(-g_RT[18] + g_RT[20] - g_RT[53] + g_RT[54]);
+        Kc[493] = exp(-g_RT[16] + g_RT[17] - g_RT[53] + g_RT[54]);
+        Kc[494] = exp(-g_RT[53] + g_RT[54] + g_RT[68] - g_RT[69]);
+        Kc[495] = exp(-g_RT[17] + g_RT[19] - g_RT[53] + g_RT[54]);
+        Kc[496] = exp(-g_RT[14] + g_RT[16] - g_RT[53] + g_RT[54]);
+        Kc[497] = exp(-g_RT[25] + g_RT[26] - g_RT[53] + g_RT[54]);
+        Kc[498] = exp(-g_RT[23] + g_RT[24] - g_RT[53] + g_RT[54]);
+        Kc[499] = exp(-g_RT[22] + g_RT[23] - g_RT[53] + g_RT[54]);
+        Kc[500] = exp(g_RT[12] - g_RT[56] + g_RT[59] - g_RT[62]);
+        Kc[501] = exp(g_RT[14] - g_RT[15] - g_RT[62] + g_RT[66]);
+        Kc[502] = exp(-g_RT[14] - g_RT[62] + g_RT[64] + g_RT[69]);
+        Kc[503] = exp(g_RT[1] - g_RT[53] - g_RT[54] + g_RT[55]);
+        Kc[504] = exp(-g_RT[54] + g_RT[55] - g_RT[59] + g_RT[62]);
+        Kc[505] = exp(g_RT[12] - g_RT[54] + g_RT[55] - g_RT[56]);
+        Kc[506] = exp(-g_RT[54] + g_RT[55] - g_RT[62] + g_RT[64]);
+        Kc[507] = exp(-g_RT[54] + g_RT[55] - g_RT[67] + g_RT[69]);
+        Kc[508] = exp(g_RT[0] - g_RT[1] - g_RT[53] - g_RT[54] + g_RT[55]);
+        Kc[509] = exp(g_RT[14] - g_RT[54] + g_RT[55] - g_RT[69]);
+        Kc[510] = exp(g_RT[8] - g_RT[54] + g_RT[55] - g_RT[65]);
+        Kc[511] = exp(-g_RT[54] + g_RT[55] - g_RT[64] + g_RT[65]);
+        Kc[512] = exp(-g_RT[12] + g_RT[13] - g_RT[53] - g_RT[54] + g_RT[55]);
+        Kc[513] = exp(-g_RT[2] + g_RT[4] - g_RT[53] - g_RT[54] + g_RT[55]);
+        Kc[514] = exp(g_RT[50] - g_RT[53] + g_RT[54] - g_RT[71]);
+        Kc[515] = exp(g_RT[50] - g_RT[53] + g_RT[54] - g_RT[70]);
+        Kc[516] = exp(g_RT[50] - g_RT[58] + g_RT[62] - g_RT[71]);
+        Kc[517] = exp(g_RT[50] - g_RT[58] + g_RT[62] - g_RT[70]);
+
+        /*reactions with the net stoichiometry of an earlier one */
+        Kc[120] = Kc[119];
+        Kc[146] = Kc[145];
+        Kc[226] = Kc[39];
+        Kc[302] = Kc[118];
+        Kc[455] = Kc[454];
+        Kc[456] = Kc[454];
+
+        Kc[0] *= refCinv;
+        Kc[1] *= refCinv;
+        Kc[2] *= refCinv;
+        Kc[3] *= refCinv;
+        Kc[4] *= refCinv;
+        Kc[5] *= refCinv;
+        Kc[6] *= refCinv;
+        Kc[7] *= refCinv;
+        Kc[8] *= refCinv;
+        Kc[9] *= refCinv;
+        Kc[10] *= refCinv;
+        Kc[11] *= refCinv;
+        Kc[12] *= refCinv;
+        Kc[13] *= refCinv;
+        Kc[14] *= refCinv;
+        Kc[15] *= refCinv;
+        Kc[16] *= refCinv;
+        Kc[17] *= refCinv;
+        Kc[18] *= refCinv;
+        Kc[19] *= refC;
+        Kc[20] *= refCinv;
+        Kc[21] *= refCinv;
+        Kc[22] *= refCinv;
+        Kc[23] *= refCinv;
+        Kc[24] *= refCinv;
+        Kc[25] *= refCinv;
+        Kc[26] *= refCinv;
+        Kc[27] *= refC;
+        Kc[28] *= refCinv;
+        Kc[29] *= refC;
+        Kc[30] *= refC;
+        Kc[31] *= refC;
+        Kc[32] *= refCinv;
+        Kc[33] *= refCinv;
+        Kc[34] *= refCinv;
+        Kc[35] *= refCinv;
+        Kc[36] *= refCinv;
+        Kc[37] *= refC;
+        Kc[38] *= refCinv;
+        Kc[39] *= refC;
+        Kc[40] *= refCinv;
+        Kc[41] *= refC;
+        Kc[42] *= refC;
+        Kc[43] *= refC;
+        Kc[44] *= refCinv;
+        Kc[45] *= refC;
+        Kc[46] *= refCinv;
+        Kc[47] *= refC;
+        Kc[48] *= refC;
+        Kc[49] *= refC;
+        Kc[50] *= refC;
+        Kc[51] *= refCinv;
+        Kc[76] *= refC;
+        Kc[81] *= refCinv;
+        Kc[82] *= refCinv;
+        Kc[83] *= refCinv;
+        Kc[84] *= refCinv;
+        Kc[86] *= refCinv;
+        Kc[87] *= refCinv;
+        Kc[88] *= refCinv;
+        Kc[164] *= refC;
+        Kc[172] *= refC;
+        Kc[192] *= refC;
+        Kc[200] *= refC;
+        Kc[201] *= refC;
+        Kc[226] *= refC;
+        Kc[244] *= refC;
+        Kc[273] *= refC;
+        Kc[275] *= refC;
+        Kc[276] *= refC;
+        Kc[299] *= refC;
+        Kc[304] *= refC;
+        Kc[306] *= refC;
+        Kc[311] *= refC;
+        Kc[312] *= refC;
+        Kc[314] *= refC;
+        Kc[315] *= refC;
+        Kc[316] *= refC;
+        Kc[317] *= refC;
+        Kc[318] *= refC;
+        Kc[319] *= refC;
+        Kc[320] *= refC;
+        Kc[334] *= refC;
+        Kc[355] *= refCinv;
+        Kc[356] *= refCinv;
+        Kc[357] *= refCinv;
+        Kc[358] *= refCinv;
+        Kc[406] *= refC;
+        Kc[407] *= refC;
+        Kc[409] *= refC;
+        Kc[410] *= refC;
+        Kc[416] *= refC;
+        Kc[417] *= refC;
+        Kc[418] *= refC;
+        Kc[419] *= refC;
+        Kc[420] *= refC;
+        Kc[421] *= refC;
+        Kc[422] *= refC;
+        Kc[452] *= refCinv;
+        Kc[457] *= refC;
+        Kc[460] *= refC;
+        Kc[469] *= refC;
+        Kc[508] *= refC;
+        Kc[512] *= refC;
+        Kc[513] *= refC;
+    }
 
     return;
 }
@@ -27917,6 +29142,11 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         mixture += sc[i];
     }
 
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[0][0] - 1)*sc[0] + (TB[0][1] - 1)*sc[5] + (TB[0][2] - 1)*sc[13] + (TB[0][3] - 1)*sc[14] + (TB[0][4] - 1)*sc[15] + (TB[0][5] - 1)*sc[26] + (TB[0][6] - 1)*sc[48];
+    double alpha_eff1 = mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[13] + (TB[3][3] - 1)*sc[14] + (TB[3][4] - 1)*sc[15] + (TB[3][5] - 1)*sc[26];
+    double alpha_eff2 = mixture + (TB[29][0] - 1)*sc[0] + (TB[29][1] - 1)*sc[5] + (TB[29][2] - 1)*sc[13] + (TB[29][3] - 1)*sc[14] + (TB[29][4] - 1)*sc[15] + (TB[29][5] - 1)*sc[26] + (TB[29][6] - 1)*sc[56] + (TB[29][7] - 1)*sc[57] + (TB[29][8] - 1)*sc[58] + (TB[29][9] - 1)*sc[53];
+
     double Corr[518];
     for (int i = 0; i < 518; ++i) {
         Corr[i] = 1.0;
@@ -27925,32 +29155,32 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
     /* troe */
     {
         double alpha[26];
-        alpha[0] = mixture + (TB[0][0] - 1)*sc[0] + (TB[0][1] - 1)*sc[5] + (TB[0][2] - 1)*sc[13] + (TB[0][3] - 1)*sc[14] + (TB[0][4] - 1)*sc[15] + (TB[0][5] - 1)*sc[26] + (TB[0][6] - 1)*sc[48];
+        alpha[0] = alpha_eff0;
         alpha[1] = mixture + (TB[1][0] - 1)*sc[0] + (TB[1][1] - 1)*sc[5] + (TB[1][2] - 1)*sc[13] + (TB[1][3] - 1)*sc[14] + (TB[1][4] - 1)*sc[15] + (TB[1][5] - 1)*sc[26] + (TB[1][6] - 1)*sc[48];
-        alpha[2] = mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[13] + (TB[2][3] - 1)*sc[14] + (TB[2][4] - 1)*sc[15] + (TB[2][5] - 1)*sc[26] + (TB[2][6] - 1)*sc[48];
-        alpha[3] = mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[13] + (TB[3][3] - 1)*sc[14] + (TB[3][4] - 1)*sc[15] + (TB[3][5] - 1)*sc[26];
-        alpha[4] = mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[13] + (TB[4][3] - 1)*sc[14] + (TB[4][4] - 1)*sc[15] + (TB[4][5] - 1)*sc[26];
-        alpha[5] = mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[13] + (TB[5][3] - 1)*sc[14] + (TB[5][4] - 1)*sc[15] + (TB[5][5] - 1)*sc[26];
-        alpha[6] = mixture + (TB[6][0] - 1)*sc[0] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[13] + (TB[6][3] - 1)*sc[14] + (TB[6][4] - 1)*sc[15] + (TB[6][5] - 1)*sc[26];
-        alpha[7] = mixture + (TB[7][0] - 1)*sc[0] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[13] + (TB[7][3] - 1)*sc[14] + (TB[7][4] - 1)*sc[15] + (TB[7][5] - 1)*sc[26] + (TB[7][6] - 1)*sc[48];
-        alpha[8] = mixture + (TB[8][0] - 1)*sc[0] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[13] + (TB[8][3] - 1)*sc[14] + (TB[8][4] - 1)*sc[15] + (TB[8][5] - 1)*sc[26] + (TB[8][6] - 1)*sc[48];
-        alpha[9] = mixture + (TB[9][0] - 1)*sc[0] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[13] + (TB[9][3] - 1)*sc[14] + (TB[9][4] - 1)*sc[15] + (TB[9][5] - 1)*sc[26] + (TB[9][6] - 1)*sc[48];
-        alpha[10] = mixture + (TB[10][0] - 1)*sc[0] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[13] + (TB[10][3] - 1)*sc[14] + (TB[10][4] - 1)*sc[15] + (TB[10][5] - 1)*sc[26] + (TB[10][6] - 1)*sc[48];
-        alpha[11] = mixture + (TB[11][0] - 1)*sc[0] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[13] + (TB[11][3] - 1)*sc[14] + (TB[11][4] - 1)*sc[15] + (TB[11][5] - 1)*sc[26] + (TB[11][6] - 1)*sc[48];
-        alpha[12] = mixture + (TB[12][0] - 1)*sc[0] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[13] + (TB[12][3] - 1)*sc[14] + (TB[12][4] - 1)*sc[15] + (TB[12][5] - 1)*sc[26] + (TB[12][6] - 1)*sc[48];
-        alpha[13] = mixture + (TB[13][0] - 1)*sc[0] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[13] + (TB[13][3] - 1)*sc[14] + (TB[13][4] - 1)*sc[15] + (TB[13][5] - 1)*sc[26] + (TB[13][6] - 1)*sc[48];
-        alpha[14] = mixture + (TB[14][0] - 1)*sc[0] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[13] + (TB[14][3] - 1)*sc[14] + (TB[14][4] - 1)*sc[15] + (TB[14][5] - 1)*sc[26];
-        alpha[15] = mixture + (TB[15][0] - 1)*sc[0] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[13] + (TB[15][3] - 1)*sc[14] + (TB[15][4] - 1)*sc[15] + (TB[15][5] - 1)*sc[26] + (TB[15][6] - 1)*sc[48];
-        alpha[16] = mixture + (TB[16][0] - 1)*sc[0] + (TB[16][1] - 1)*sc[5] + (TB[16][2] - 1)*sc[13] + (TB[16][3] - 1)*sc[14] + (TB[16][4] - 1)*sc[15] + (TB[16][5] - 1)*sc[26] + (TB[16][6] - 1)*sc[48];
-        alpha[17] = mixture + (TB[17][0] - 1)*sc[0] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[13] + (TB[17][3] - 1)*sc[14] + (TB[17][4] - 1)*sc[15] + (TB[17][5] - 1)*sc[26];
-        alpha[18] = mixture + (TB[18][0] - 1)*sc[0] + (TB[18][1] - 1)*sc[5] + (TB[18][2] - 1)*sc[13] + (TB[18][3] - 1)*sc[14] + (TB[18][4] - 1)*sc[15] + (TB[18][5] - 1)*sc[26] + (TB[18][6] - 1)*sc[48];
-        alpha[19] = mixture + (TB[19][0] - 1)*sc[0] + (TB[19][1] - 1)*sc[5] + (TB[19][2] - 1)*sc[13] + (TB[19][3] - 1)*sc[14] + (TB[19][4] - 1)*sc[15] + (TB[19][5] - 1)*sc[26] + (TB[19][6] - 1)*sc[48];
+        alpha[2] = (memcmp(TB[2], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[13] + (TB[2][3] - 1)*sc[14] + (TB[2][4] - 1)*sc[15] + (TB[2][5] - 1)*sc[26] + (TB[2][6] - 1)*sc[48]);
+        alpha[3] = alpha_eff1;
+        alpha[4] = (memcmp(TB[4], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[13] + (TB[4][3] - 1)*sc[14] + (TB[4][4] - 1)*sc[15] + (TB[4][5] - 1)*sc[26]);
+        alpha[5] = (memcmp(TB[5], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[13] + (TB[5][3] - 1)*sc[14] + (TB[5][4] - 1)*sc[15] + (TB[5][5] - 1)*sc[26]);
+        alpha[6] = (memcmp(TB[6], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[6][0] - 1)*sc[0] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[13] + (TB[6][3] - 1)*sc[14] + (TB[6][4] - 1)*sc[15] + (TB[6][5] - 1)*sc[26]);
+        alpha[7] = (memcmp(TB[7], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[7][0] - 1)*sc[0] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[13] + (TB[7][3] - 1)*sc[14] + (TB[7][4] - 1)*sc[15] + (TB[7][5] - 1)*sc[26] + (TB[7][6] - 1)*sc[48]);
+        alpha[8] = (memcmp(TB[8], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[8][0] - 1)*sc[0] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[13] + (TB[8][3] - 1)*sc[14] + (TB[8][4] - 1)*sc[15] + (TB[8][5] - 1)*sc[26] + (TB[8][6] - 1)*sc[48]);
+        alpha[9] = (memcmp(TB[9], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[9][0] - 1)*sc[0] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[13] + (TB[9][3] - 1)*sc[14] + (TB[9][4] - 1)*sc[15] + (TB[9][5] - 1)*sc[26] + (TB[9][6] - 1)*sc[48]);
+        alpha[10] = (memcmp(TB[10], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[10][0] - 1)*sc[0] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[13] + (TB[10][3] - 1)*sc[14] + (TB[10][4] - 1)*sc[15] + (TB[10][5] - 1)*sc[26] + (TB[10][6] - 1)*sc[48]);
+        alpha[11] = (memcmp(TB[11], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[11][0] - 1)*sc[0] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[13] + (TB[11][3] - 1)*sc[14] + (TB[11][4] - 1)*sc[15] + (TB[11][5] - 1)*sc[26] + (TB[11][6] - 1)*sc[48]);
+        alpha[12] = (memcmp(TB[12], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[12][0] - 1)*sc[0] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[13] + (TB[12][3] - 1)*sc[14] + (TB[12][4] - 1)*sc[15] + (TB[12][5] - 1)*sc[26] + (TB[12][6] - 1)*sc[48]);
+        alpha[13] = (memcmp(TB[13], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[13][0] - 1)*sc[0] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[13] + (TB[13][3] - 1)*sc[14] + (TB[13][4] - 1)*sc[15] + (TB[13][5] - 1)*sc[26] + (TB[13][6] - 1)*sc[48]);
+        alpha[14] = (memcmp(TB[14], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[14][0] - 1)*sc[0] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[13] + (TB[14][3] - 1)*sc[14] + (TB[14][4] - 1)*sc[15] + (TB[14][5] - 1)*sc[26]);
+        alpha[15] = (memcmp(TB[15], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[15][0] - 1)*sc[0] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[13] + (TB[15][3] - 1)*sc[14] + (TB[15][4] - 1)*sc[15] + (TB[15][5] - 1)*sc[26] + (TB[15][6] - 1)*sc[48]);
+        alpha[16] = (memcmp(TB[16], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[16][0] - 1)*sc[0] + (TB[16][1] - 1)*sc[5] + (TB[16][2] - 1)*sc[13] + (TB[16][3] - 1)*sc[14] + (TB[16][4] - 1)*sc[15] + (TB[16][5] - 1)*sc[26] + (TB[16][6] - 1)*sc[48]);
+        alpha[17] = (memcmp(TB[17], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[17][0] - 1)*sc[0] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[13] + (TB[17][3] - 1)*sc[14] + (TB[17][4] - 1)*sc[15] + (TB[17][5] - 1)*sc[26]);
+        alpha[18] = (memcmp(TB[18], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[18][0] - 1)*sc[0] + (TB[18][1] - 1)*sc[5] + (TB[18][2] - 1)*sc[13] + (TB[18][3] - 1)*sc[14] + (TB[18][4] - 1)*sc[15] + (TB[18][5] - 1)*sc[26] + (TB[18][6] - 1)*sc[48]);
+        alpha[19] = (memcmp(TB[19], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[19][0] - 1)*sc[0] + (TB[19][1] - 1)*sc[5] + (TB[19][2] - 1)*sc[13] + (TB[19][3] - 1)*sc[14] + (TB[19][4] - 1)*sc[15] + (TB[19][5] - 1)*sc[26] + (TB[19][6] - 1)*sc[48]);
         alpha[20] = mixture + (TB[20][0] - 1)*sc[0] + (TB[20][1] - 1)*sc[5] + (TB[20][2] - 1)*sc[13] + (TB[20][3] - 1)*sc[14] + (TB[20][4] - 1)*sc[15] + (TB[20][5] - 1)*sc[26] + (TB[20][6] - 1)*sc[48];
-        alpha[21] = mixture + (TB[21][0] - 1)*sc[0] + (TB[21][1] - 1)*sc[5] + (TB[21][2] - 1)*sc[13] + (TB[21][3] - 1)*sc[14] + (TB[21][4] - 1)*sc[15] + (TB[21][5] - 1)*sc[26] + (TB[21][6] - 1)*sc[48];
-        alpha[22] = mixture + (TB[22][0] - 1)*sc[0] + (TB[22][1] - 1)*sc[5] + (TB[22][2] - 1)*sc[13] + (TB[22][3] - 1)*sc[14] + (TB[22][4] - 1)*sc[15] + (TB[22][5] - 1)*sc[26] + (TB[22][6] - 1)*sc[48];
-        alpha[23] = mixture + (TB[23][0] - 1)*sc[0] + (TB[23][1] - 1)*sc[5] + (TB[23][2] - 1)*sc[13] + (TB[23][3] - 1)*sc[14] + (TB[23][4] - 1)*sc[15] + (TB[23][5] - 1)*sc[26] + (TB[23][6] - 1)*sc[48];
-        alpha[24] = mixture + (TB[24][0] - 1)*sc[0] + (TB[24][1] - 1)*sc[5] + (TB[24][2] - 1)*sc[13] + (TB[24][3] - 1)*sc[14] + (TB[24][4] - 1)*sc[15] + (TB[24][5] - 1)*sc[26] + (TB[24][6] - 1)*sc[48];
-        alpha[25] = mixture + (TB[25][0] - 1)*sc[0] + (TB[25][1] - 1)*sc[5] + (TB[25][2] - 1)*sc[13] + (TB[25][3] - 1)*sc[14] + (TB[25][4] - 1)*sc[15] + (TB[25][5] - 1)*sc[26] + (TB[25][6] - 1)*sc[48];
+        alpha[21] = (memcmp(TB[21], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[21][0] - 1)*sc[0] + (TB[21][1] - 1)*sc[5] + (TB[21][2] - 1)*sc[13] + (TB[21][3] - 1)*sc[14] + (TB[21][4] - 1)*sc[15] + (TB[21][5] - 1)*sc[26] + (TB[21][6] - 1)*sc[48]);
+        alpha[22] = (memcmp(TB[22], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[22][0] - 1)*sc[0] + (TB[22][1] - 1)*sc[5] + (TB[22][2] - 1)*sc[13] + (TB[22][3] - 1)*sc[14] + (TB[22][4] - 1)*sc[15] + (TB[22][5] - 1)*sc[26] + (TB[22][6] - 1)*sc[48]);
+        alpha[23] = (memcmp(TB[23], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[23][0] - 1)*sc[0] + (TB[23][1] - 1)*sc[5] + (TB[23][2] - 1)*sc[13] + (TB[23][3] - 1)*sc[14] + (TB[23][4] - 1)*sc[15] + (TB[23][5] - 1)*sc[26] + (TB[23][6] - 1)*sc[48]);
+        alpha[24] = (memcmp(TB[24], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[24][0] - 1)*sc[0] + (TB[24][1] - 1)*sc[5] + (TB[24][2] - 1)*sc[13] + (TB[24][3] - 1)*sc[14] + (TB[24][4] - 1)*sc[15] + (TB[24][5] - 1)*sc[26] + (TB[24][6] - 1)*sc[48]);
+        alpha[25] = (memcmp(TB[25], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[25][0] - 1)*sc[0] + (TB[25][1] - 1)*sc[5] + (TB[25][2] - 1)*sc[13] + (TB[25][3] - 1)*sc[14] + (TB[25][4] - 1)*sc[15] + (TB[25][5] - 1)*sc[26] + (TB[25][6] - 1)*sc[48]);
 #ifdef __INTEL_COMPILER
          #pragma simd
 #endif
@@ -27977,8 +29207,8 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         double alpha[6];
         alpha[0] = mixture + (TB[26][0] - 1)*sc[0] + (TB[26][1] - 1)*sc[3] + (TB[26][2] - 1)*sc[5] + (TB[26][3] - 1)*sc[13] + (TB[26][4] - 1)*sc[14] + (TB[26][5] - 1)*sc[15] + (TB[26][6] - 1)*sc[26] + (TB[26][7] - 1)*sc[48];
         alpha[1] = mixture + (TB[27][0] - 1)*sc[0] + (TB[27][1] - 1)*sc[5] + (TB[27][2] - 1)*sc[13] + (TB[27][3] - 1)*sc[14] + (TB[27][4] - 1)*sc[15] + (TB[27][5] - 1)*sc[26] + (TB[27][6] - 1)*sc[48];
-        alpha[2] = mixture + (TB[28][0] - 1)*sc[0] + (TB[28][1] - 1)*sc[5] + (TB[28][2] - 1)*sc[13] + (TB[28][3] - 1)*sc[14] + (TB[28][4] - 1)*sc[15] + (TB[28][5] - 1)*sc[26] + (TB[28][6] - 1)*sc[48];
-        alpha[3] = mixture + (TB[29][0] - 1)*sc[0] + (TB[29][1] - 1)*sc[5] + (TB[29][2] - 1)*sc[13] + (TB[29][3] - 1)*sc[14] + (TB[29][4] - 1)*sc[15] + (TB[29][5] - 1)*sc[26] + (TB[29][6] - 1)*sc[56] + (TB[29][7] - 1)*sc[57] + (TB[29][8] - 1)*sc[58] + (TB[29][9] - 1)*sc[53];
+        alpha[2] = (memcmp(TB[28], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[28][0] - 1)*sc[0] + (TB[28][1] - 1)*sc[5] + (TB[28][2] - 1)*sc[13] + (TB[28][3] - 1)*sc[14] + (TB[28][4] - 1)*sc[15] + (TB[28][5] - 1)*sc[26] + (TB[28][6] - 1)*sc[48]);
+        alpha[3] = alpha_eff2;
         alpha[4] = mixture + (TB[30][0] - 1)*sc[0] + (TB[30][1] - 1)*sc[5] + (TB[30][2] - 1)*sc[13] + (TB[30][3] - 1)*sc[14] + (TB[30][4] - 1)*sc[15] + (TB[30][5] - 1)*sc[26] + (TB[30][6] - 1)*sc[48] + (TB[30][7] - 1)*sc[56] + (TB[30][8] - 1)*sc[57] + (TB[30][9] - 1)*sc[58] + (TB[30][10] - 1)*sc[59] + (TB[30][11] - 1)*sc[53];
         alpha[5] = mixture + (TB[31][0] - 1)*sc[0] + (TB[31][1] - 1)*sc[5] + (TB[31][2] - 1)*sc[13] + (TB[31][3] - 1)*sc[14] + (TB[31][4] - 1)*sc[15] + (TB[31][5] - 1)*sc[26] + (TB[31][6] - 1)*sc[48] + (TB[31][7] - 1)*sc[56] + (TB[31][8] - 1)*sc[57] + (TB[31][9] - 1)*sc[58] + (TB[31][10] - 1)*sc[53];
     #ifdef __INTEL_COMPILER
@@ -27996,7 +29226,7 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         double alpha;
         alpha = mixture + (TB[32][0] - 1)*sc[0] + (TB[32][1] - 1)*sc[5] + (TB[32][2] - 1)*sc[13] + (TB[32][3] - 1)*sc[14] + (TB[32][4] - 1)*sc[15] + (TB[32][5] - 1)*sc[26] + (TB[32][6] - 1)*sc[48];
         Corr[32] = alpha;
-        alpha = mixture + (TB[33][0] - 1)*sc[0] + (TB[33][1] - 1)*sc[5] + (TB[33][2] - 1)*sc[13] + (TB[33][3] - 1)*sc[14] + (TB[33][4] - 1)*sc[15] + (TB[33][5] - 1)*sc[26] + (TB[33][6] - 1)*sc[48];
+        alpha = (memcmp(TB[33], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[33][0] - 1)*sc[0] + (TB[33][1] - 1)*sc[5] + (TB[33][2] - 1)*sc[13] + (TB[33][3] - 1)*sc[14] + (TB[33][4] - 1)*sc[15] + (TB[33][5] - 1)*sc[26] + (TB[33][6] - 1)*sc[48]);
         Corr[33] = alpha;
         alpha = mixture + (TB[34][0] - 1)*sc[3] + (TB[34][1] - 1)*sc[5] + (TB[34][2] - 1)*sc[14] + (TB[34][3] - 1)*sc[15] + (TB[34][4] - 1)*sc[26] + (TB[34][5] - 1)*sc[47] + (TB[34][6] - 1)*sc[48];
         Corr[34] = alpha;
@@ -28006,23 +29236,23 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         Corr[36] = alpha;
         alpha = mixture + (TB[37][0] - 1)*sc[0] + (TB[37][1] - 1)*sc[5] + (TB[37][2] - 1)*sc[13] + (TB[37][3] - 1)*sc[14] + (TB[37][4] - 1)*sc[15] + (TB[37][5] - 1)*sc[26];
         Corr[37] = alpha;
-        alpha = mixture + (TB[38][0] - 1)*sc[0] + (TB[38][1] - 1)*sc[5] + (TB[38][2] - 1)*sc[13] + (TB[38][3] - 1)*sc[14] + (TB[38][4] - 1)*sc[15] + (TB[38][5] - 1)*sc[26] + (TB[38][6] - 1)*sc[48];
+        alpha = (memcmp(TB[38], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[38][0] - 1)*sc[0] + (TB[38][1] - 1)*sc[5] + (TB[38][2] - 1)*sc[13] + (TB[38][3] - 1)*sc[14] + (TB[38][4] - 1)*sc[15] + (TB[38][5] - 1)*sc[26] + (TB[38][6] - 1)*sc[48]);
         Corr[38] = alpha;
-        alpha = mixture + (TB[39][0] - 1)*sc[0] + (TB[39][1] - 1)*sc[5] + (TB[39][2] - 1)*sc[13] + (TB[39][3] - 1)*sc[14] + (TB[39][4] - 1)*sc[15] + (TB[39][5] - 1)*sc[26] + (TB[39][6] - 1)*sc[48];
+        alpha = (memcmp(TB[39], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[39][0] - 1)*sc[0] + (TB[39][1] - 1)*sc[5] + (TB[39][2] - 1)*sc[13] + (TB[39][3] - 1)*sc[14] + (TB[39][4] - 1)*sc[15] + (TB[39][5] - 1)*sc[26] + (TB[39][6] - 1)*sc[48]);
         Corr[39] = alpha;
-        alpha = mixture + (TB[40][0] - 1)*sc[0] + (TB[40][1] - 1)*sc[5] + (TB[40][2] - 1)*sc[13] + (TB[40][3] - 1)*sc[14] + (TB[40][4] - 1)*sc[15] + (TB[40][5] - 1)*sc[26] + (TB[40][6] - 1)*sc[48];
+        alpha = (memcmp(TB[40], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[40][0] - 1)*sc[0] + (TB[40][1] - 1)*sc[5] + (TB[40][2] - 1)*sc[13] + (TB[40][3] - 1)*sc[14] + (TB[40][4] - 1)*sc[15] + (TB[40][5] - 1)*sc[26] + (TB[40][6] - 1)*sc[48]);
         Corr[40] = alpha;
-        alpha = mixture + (TB[41][0] - 1)*sc[0] + (TB[41][1] - 1)*sc[5] + (TB[41][2] - 1)*sc[13] + (TB[41][3] - 1)*sc[14] + (TB[41][4] - 1)*sc[15] + (TB[41][5] - 1)*sc[26] + (TB[41][6] - 1)*sc[48];
+        alpha = (memcmp(TB[41], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[41][0] - 1)*sc[0] + (TB[41][1] - 1)*sc[5] + (TB[41][2] - 1)*sc[13] + (TB[41][3] - 1)*sc[14] + (TB[41][4] - 1)*sc[15] + (TB[41][5] - 1)*sc[26] + (TB[41][6] - 1)*sc[48]);
         Corr[41] = alpha;
-        alpha = mixture + (TB[42][0] - 1)*sc[0] + (TB[42][1] - 1)*sc[5] + (TB[42][2] - 1)*sc[13] + (TB[42][3] - 1)*sc[14] + (TB[42][4] - 1)*sc[15] + (TB[42][5] - 1)*sc[26] + (TB[42][6] - 1)*sc[48];
+        alpha = (memcmp(TB[42], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[42][0] - 1)*sc[0] + (TB[42][1] - 1)*sc[5] + (TB[42][2] - 1)*sc[13] + (TB[42][3] - 1)*sc[14] + (TB[42][4] - 1)*sc[15] + (TB[42][5] - 1)*sc[26] + (TB[42][6] - 1)*sc[48]);
         Corr[42] = alpha;
-        alpha = mixture + (TB[43][0] - 1)*sc[0] + (TB[43][1] - 1)*sc[5] + (TB[43][2] - 1)*sc[13] + (TB[43][3] - 1)*sc[14] + (TB[43][4] - 1)*sc[15] + (TB[43][5] - 1)*sc[26] + (TB[43][6] - 1)*sc[48];
+        alpha = (memcmp(TB[43], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[43][0] - 1)*sc[0] + (TB[43][1] - 1)*sc[5] + (TB[43][2] - 1)*sc[13] + (TB[43][3] - 1)*sc[14] + (TB[43][4] - 1)*sc[15] + (TB[43][5] - 1)*sc[26] + (TB[43][6] - 1)*sc[48]);
         Corr[43] = alpha;
         alpha = mixture + (TB[44][0] - 1)*sc[0] + (TB[44][1] - 1)*sc[5] + (TB[44][2] - 1)*sc[13] + (TB[44][3] - 1)*sc[14] + (TB[44][4] - 1)*sc[15] + (TB[44][5] - 1)*sc[26];
         Corr[44] = alpha;
         alpha = mixture;
         Corr[45] = alpha;
-        alpha = mixture + (TB[46][0] - 1)*sc[0] + (TB[46][1] - 1)*sc[5] + (TB[46][2] - 1)*sc[13] + (TB[46][3] - 1)*sc[14] + (TB[46][4] - 1)*sc[15] + (TB[46][5] - 1)*sc[26] + (TB[46][6] - 1)*sc[56] + (TB[46][7] - 1)*sc[57] + (TB[46][8] - 1)*sc[58] + (TB[46][9] - 1)*sc[53];
+        alpha = (memcmp(TB[46], TB[29], 10*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[46][0] - 1)*sc[0] + (TB[46][1] - 1)*sc[5] + (TB[46][2] - 1)*sc[13] + (TB[46][3] - 1)*sc[14] + (TB[46][4] - 1)*sc[15] + (TB[46][5] - 1)*sc[26] + (TB[46][6] - 1)*sc[56] + (TB[46][7] - 1)*sc[57] + (TB[46][8] - 1)*sc[58] + (TB[46][9] - 1)*sc[53]);
         Corr[46] = alpha;
         alpha = mixture + (TB[47][0] - 1)*sc[0] + (TB[47][1] - 1)*sc[5] + (TB[47][2] - 1)*sc[13] + (TB[47][3] - 1)*sc[14] + (TB[47][4] - 1)*sc[15] + (TB[47][5] - 1)*sc[26] + (TB[47][6] - 1)*sc[58] + (TB[47][7] - 1)*sc[57] + (TB[47][8] - 1)*sc[56] + (TB[47][9] - 1)*sc[53];
         Corr[47] = alpha;
@@ -36947,17 +38177,24 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         mixture += sc[k];
     }
 
-    /*compute the Gibbs free energy */
-    double g_RT[72];
-    gibbs(g_RT, tc);
-
     /*compute the species enthalpy */
     double h_RT[72];
     speciesEnthalpy(h_RT, tc);
 
+    /*compute the rate and equilibrium constants */
+    double k_f_s[518], Kc_s[518];
+    comp_k_f(tc, invT, k_f_s);
+    comp_Kc(tc, invT, Kc_s);
+
+    /*at constant volume, the part of dwdot/d[X] common to all species */
+    double Jmix[72];
+    for (int k=0; k<72; k++) {
+        Jmix[k] = 0.0;
+    }
+
     double phi_f, k_f, k_r, phi_r, Kc, q, q_nocor, Corr, alpha;
     double dlnkfdT, dlnk0dT, dlnKcdT, dkrdT, dqdT;
-    double dqdci, dcdc_fac, dqdc[72];
+    double dqdci, dcdc_fac;
     double Pr, fPr, F, k_0, logPr;
     double logFcent, troe_c, troe_n, troePr_den, troePr, troe;
     double Fcent1, Fcent2, Fcent3, Fcent;
@@ -36965,15 +38202,20 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     double dlogPrdT, dlogfPrdT, dlogFdT, dlogFcentdT, dlogFdlogPr, dlnCorrdT;
     const double ln10 = log(10.0);
     const double log10e = 1.0/log(10.0);
+
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[0][0] - 1)*sc[0] + (TB[0][1] - 1)*sc[5] + (TB[0][2] - 1)*sc[13] + (TB[0][3] - 1)*sc[14] + (TB[0][4] - 1)*sc[15] + (TB[0][5] - 1)*sc[26] + (TB[0][6] - 1)*sc[48];
+    double alpha_eff1 = mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[13] + (TB[3][3] - 1)*sc[14] + (TB[3][4] - 1)*sc[15] + (TB[3][5] - 1)*sc[26];
+    double alpha_eff2 = mixture + (TB[29][0] - 1)*sc[0] + (TB[29][1] - 1)*sc[5] + (TB[29][2] - 1)*sc[13] + (TB[29][3] - 1)*sc[14] + (TB[29][4] - 1)*sc[15] + (TB[29][5] - 1)*sc[26] + (TB[29][6] - 1)*sc[56] + (TB[29][7] - 1)*sc[57] + (TB[29][8] - 1)*sc[58] + (TB[29][9] - 1)*sc[53];
+
     /*reaction 1: H + CH2 (+M) <=> CH3 (+M) */
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[0][0] - 1)*sc[0] + (TB[0][1] - 1)*sc[5] + (TB[0][2] - 1)*sc[13] + (TB[0][3] - 1)*sc[14] + (TB[0][4] - 1)*sc[15] + (TB[0][5] - 1)*sc[26] + (TB[0][6] - 1)*sc[48];
+    alpha = alpha_eff0;
     /* forward */
     phi_f = sc[1]*sc[10];
-    k_f = prefactor_units[0] * fwd_A[0]
-                * exp(fwd_beta[0] * tc[0] - activation_units[0] * fwd_Ea[0] * invT);
+    k_f = k_f_s[0];
     dlnkfdT = fwd_beta[0] * invT + activation_units[0] * fwd_Ea[0] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[0] * exp(low_beta[0] * tc[0] - activation_units[0] * low_Ea[0] * invT);
@@ -36989,16 +38231,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[0] == 4 ? exp(-troe_Tss[0] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
+      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
+      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
-      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
-      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -37006,7 +38248,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[12];
-    Kc = refCinv * exp(g_RT[1] + g_RT[10] - g_RT[12]);
+    Kc = Kc_s[0];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[10]) + (h_RT[12]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37024,137 +38266,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[0][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[10] -= dqdci;               /* dwdot[CH2]/d[H2] */
-        J[12] += dqdci;               /* dwdot[CH3]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[10];
-        J[74] -= dqdci;               /* dwdot[H]/d[H] */
-        J[83] -= dqdci;               /* dwdot[CH2]/d[H] */
-        J[85] += dqdci;               /* dwdot[CH3]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[0][1] - 1)*dcdc_fac;
-        J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[375] -= dqdci;              /* dwdot[CH2]/d[H2O] */
-        J[377] += dqdci;              /* dwdot[CH3]/d[H2O] */
-        /* d()/d[CH2] */
-        dqdci =  + k_f*sc[1];
-        J[731] -= dqdci;              /* dwdot[H]/d[CH2] */
-        J[740] -= dqdci;              /* dwdot[CH2]/d[CH2] */
-        J[742] += dqdci;              /* dwdot[CH3]/d[CH2] */
-        /* d()/d[CH3] */
-        dqdci =  - k_r;
-        J[877] -= dqdci;              /* dwdot[H]/d[CH3] */
-        J[886] -= dqdci;              /* dwdot[CH2]/d[CH3] */
-        J[888] += dqdci;              /* dwdot[CH3]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[0][2] - 1)*dcdc_fac;
-        J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[959] -= dqdci;              /* dwdot[CH2]/d[CH4] */
-        J[961] += dqdci;              /* dwdot[CH3]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[0][3] - 1)*dcdc_fac;
-        J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1032] -= dqdci;             /* dwdot[CH2]/d[CO] */
-        J[1034] += dqdci;             /* dwdot[CH3]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[0][4] - 1)*dcdc_fac;
-        J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1105] -= dqdci;             /* dwdot[CH2]/d[CO2] */
-        J[1107] += dqdci;             /* dwdot[CH3]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[0][5] - 1)*dcdc_fac;
-        J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1908] -= dqdci;             /* dwdot[CH2]/d[C2H6] */
-        J[1910] += dqdci;             /* dwdot[CH3]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[0][6] - 1)*dcdc_fac;
-        J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[3514] -= dqdci;             /* dwdot[CH2]/d[AR] */
-        J[3516] += dqdci;             /* dwdot[CH3]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[0][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[10];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[0][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac + k_f*sc[1];
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac - k_r;
-        dqdc[13] = TB[0][2]*dcdc_fac;
-        dqdc[14] = TB[0][3]*dcdc_fac;
-        dqdc[15] = TB[0][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[0][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[0][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+1] -= dqdc[k];
-            J[73*k+10] -= dqdc[k];
-            J[73*k+12] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[10] -= dcdc_fac;
+    Jmix[12] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[0][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[10] -= dqdci;               /* dwdot[CH2]/d[H2] */
+    J[12] += dqdci;               /* dwdot[CH3]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[10];
+    J[74] -= dqdci;               /* dwdot[H]/d[H] */
+    J[83] -= dqdci;               /* dwdot[CH2]/d[H] */
+    J[85] += dqdci;               /* dwdot[CH3]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[0][1] - 1)*dcdc_fac;
+    J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[375] -= dqdci;              /* dwdot[CH2]/d[H2O] */
+    J[377] += dqdci;              /* dwdot[CH3]/d[H2O] */
+    /* d()/d[CH2] */
+    dqdci =  + k_f*sc[1];
+    J[731] -= dqdci;              /* dwdot[H]/d[CH2] */
+    J[740] -= dqdci;              /* dwdot[CH2]/d[CH2] */
+    J[742] += dqdci;              /* dwdot[CH3]/d[CH2] */
+    /* d()/d[CH3] */
+    dqdci =  - k_r;
+    J[877] -= dqdci;              /* dwdot[H]/d[CH3] */
+    J[886] -= dqdci;              /* dwdot[CH2]/d[CH3] */
+    J[888] += dqdci;              /* dwdot[CH3]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[0][2] - 1)*dcdc_fac;
+    J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[959] -= dqdci;              /* dwdot[CH2]/d[CH4] */
+    J[961] += dqdci;              /* dwdot[CH3]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[0][3] - 1)*dcdc_fac;
+    J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1032] -= dqdci;             /* dwdot[CH2]/d[CO] */
+    J[1034] += dqdci;             /* dwdot[CH3]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[0][4] - 1)*dcdc_fac;
+    J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1105] -= dqdci;             /* dwdot[CH2]/d[CO2] */
+    J[1107] += dqdci;             /* dwdot[CH3]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[0][5] - 1)*dcdc_fac;
+    J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1908] -= dqdci;             /* dwdot[CH2]/d[C2H6] */
+    J[1910] += dqdci;             /* dwdot[CH3]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[0][6] - 1)*dcdc_fac;
+    J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[3514] -= dqdci;             /* dwdot[CH2]/d[AR] */
+    J[3516] += dqdci;             /* dwdot[CH3]/d[AR] */
     J[5257] -= dqdT; /* dwdot[H]/dT */
     J[5266] -= dqdT; /* dwdot[CH2]/dT */
     J[5268] += dqdT; /* dwdot[CH3]/dT */
@@ -37166,8 +38331,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[1][0] - 1)*sc[0] + (TB[1][1] - 1)*sc[5] + (TB[1][2] - 1)*sc[13] + (TB[1][3] - 1)*sc[14] + (TB[1][4] - 1)*sc[15] + (TB[1][5] - 1)*sc[26] + (TB[1][6] - 1)*sc[48];
     /* forward */
     phi_f = sc[1]*sc[12];
-    k_f = prefactor_units[1] * fwd_A[1]
-                * exp(fwd_beta[1] * tc[0] - activation_units[1] * fwd_Ea[1] * invT);
+    k_f = k_f_s[1];
     dlnkfdT = fwd_beta[1] * invT + activation_units[1] * fwd_Ea[1] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[1] * exp(low_beta[1] * tc[0] - activation_units[1] * low_Ea[1] * invT);
@@ -37183,16 +38347,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[1] == 4 ? exp(-troe_Tss[1] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
+      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
+      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
-      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
-      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -37200,7 +38364,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[13];
-    Kc = refCinv * exp(g_RT[1] + g_RT[12] - g_RT[13]);
+    Kc = Kc_s[1];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[12]) + (h_RT[13]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37218,132 +38382,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[1][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
-        J[13] += dqdci;               /* dwdot[CH4]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[12];
-        J[74] -= dqdci;               /* dwdot[H]/d[H] */
-        J[85] -= dqdci;               /* dwdot[CH3]/d[H] */
-        J[86] += dqdci;               /* dwdot[CH4]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[1][1] - 1)*dcdc_fac;
-        J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[377] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[378] += dqdci;              /* dwdot[CH4]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[1];
-        J[877] -= dqdci;              /* dwdot[H]/d[CH3] */
-        J[888] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[889] += dqdci;              /* dwdot[CH4]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[1][2] - 1)*dcdc_fac - k_r;
-        J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[961] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[962] += dqdci;              /* dwdot[CH4]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[1][3] - 1)*dcdc_fac;
-        J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1034] -= dqdci;             /* dwdot[CH3]/d[CO] */
-        J[1035] += dqdci;             /* dwdot[CH4]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[1][4] - 1)*dcdc_fac;
-        J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1107] -= dqdci;             /* dwdot[CH3]/d[CO2] */
-        J[1108] += dqdci;             /* dwdot[CH4]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[1][5] - 1)*dcdc_fac;
-        J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1910] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
-        J[1911] += dqdci;             /* dwdot[CH4]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[1][6] - 1)*dcdc_fac;
-        J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[3516] -= dqdci;             /* dwdot[CH3]/d[AR] */
-        J[3517] += dqdci;             /* dwdot[CH4]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[1][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[12];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[1][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*sc[1];
-        dqdc[13] = TB[1][2]*dcdc_fac - k_r;
-        dqdc[14] = TB[1][3]*dcdc_fac;
-        dqdc[15] = TB[1][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[1][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[1][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+1] -= dqdc[k];
-            J[73*k+12] -= dqdc[k];
-            J[73*k+13] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[12] -= dcdc_fac;
+    Jmix[13] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[1][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
+    J[13] += dqdci;               /* dwdot[CH4]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[12];
+    J[74] -= dqdci;               /* dwdot[H]/d[H] */
+    J[85] -= dqdci;               /* dwdot[CH3]/d[H] */
+    J[86] += dqdci;               /* dwdot[CH4]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[1][1] - 1)*dcdc_fac;
+    J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[377] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[378] += dqdci;              /* dwdot[CH4]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[1];
+    J[877] -= dqdci;              /* dwdot[H]/d[CH3] */
+    J[888] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[889] += dqdci;              /* dwdot[CH4]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[1][2] - 1)*dcdc_fac - k_r;
+    J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[961] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[962] += dqdci;              /* dwdot[CH4]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[1][3] - 1)*dcdc_fac;
+    J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1034] -= dqdci;             /* dwdot[CH3]/d[CO] */
+    J[1035] += dqdci;             /* dwdot[CH4]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[1][4] - 1)*dcdc_fac;
+    J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1107] -= dqdci;             /* dwdot[CH3]/d[CO2] */
+    J[1108] += dqdci;             /* dwdot[CH4]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[1][5] - 1)*dcdc_fac;
+    J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1910] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
+    J[1911] += dqdci;             /* dwdot[CH4]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[1][6] - 1)*dcdc_fac;
+    J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[3516] -= dqdci;             /* dwdot[CH3]/d[AR] */
+    J[3517] += dqdci;             /* dwdot[CH4]/d[AR] */
     J[5257] -= dqdT; /* dwdot[H]/dT */
     J[5268] -= dqdT; /* dwdot[CH3]/dT */
     J[5269] += dqdT; /* dwdot[CH4]/dT */
@@ -37352,11 +38439,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[13] + (TB[2][3] - 1)*sc[14] + (TB[2][4] - 1)*sc[15] + (TB[2][5] - 1)*sc[26] + (TB[2][6] - 1)*sc[48];
+    alpha = (memcmp(TB[2], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[13] + (TB[2][3] - 1)*sc[14] + (TB[2][4] - 1)*sc[15] + (TB[2][5] - 1)*sc[26] + (TB[2][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[1]*sc[16];
-    k_f = prefactor_units[2] * fwd_A[2]
-                * exp(fwd_beta[2] * tc[0] - activation_units[2] * fwd_Ea[2] * invT);
+    k_f = k_f_s[2];
     dlnkfdT = fwd_beta[2] * invT + activation_units[2] * fwd_Ea[2] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[2] * exp(low_beta[2] * tc[0] - activation_units[2] * low_Ea[2] * invT);
@@ -37372,16 +38458,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[2] == 4 ? exp(-troe_Tss[2] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[2]) > 1.e-100 ? -Fcent1/troe_Tsss[2] : 0.)
+      + (fabs(troe_Ts[2]) > 1.e-100 ? -Fcent2/troe_Ts[2] : 0.)
+      + (troe_len[2] == 4 ? Fcent3*troe_Tss[2]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[2]) > 1.e-100 ? -Fcent1/troe_Tsss[2] : 0.)
-      + (fabs(troe_Ts[2]) > 1.e-100 ? -Fcent2/troe_Ts[2] : 0.)
-      + (troe_len[2] == 4 ? Fcent3*troe_Tss[2]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -37389,7 +38475,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[17];
-    Kc = refCinv * exp(g_RT[1] + g_RT[16] - g_RT[17]);
+    Kc = Kc_s[2];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[16]) + (h_RT[17]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37407,137 +38493,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[2][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[16] -= dqdci;               /* dwdot[HCO]/d[H2] */
-        J[17] += dqdci;               /* dwdot[CH2O]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[16];
-        J[74] -= dqdci;               /* dwdot[H]/d[H] */
-        J[89] -= dqdci;               /* dwdot[HCO]/d[H] */
-        J[90] += dqdci;               /* dwdot[CH2O]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[2][1] - 1)*dcdc_fac;
-        J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[381] -= dqdci;              /* dwdot[HCO]/d[H2O] */
-        J[382] += dqdci;              /* dwdot[CH2O]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[2][2] - 1)*dcdc_fac;
-        J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[965] -= dqdci;              /* dwdot[HCO]/d[CH4] */
-        J[966] += dqdci;              /* dwdot[CH2O]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[2][3] - 1)*dcdc_fac;
-        J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1038] -= dqdci;             /* dwdot[HCO]/d[CO] */
-        J[1039] += dqdci;             /* dwdot[CH2O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[2][4] - 1)*dcdc_fac;
-        J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1111] -= dqdci;             /* dwdot[HCO]/d[CO2] */
-        J[1112] += dqdci;             /* dwdot[CH2O]/d[CO2] */
-        /* d()/d[HCO] */
-        dqdci =  + k_f*sc[1];
-        J[1169] -= dqdci;             /* dwdot[H]/d[HCO] */
-        J[1184] -= dqdci;             /* dwdot[HCO]/d[HCO] */
-        J[1185] += dqdci;             /* dwdot[CH2O]/d[HCO] */
-        /* d()/d[CH2O] */
-        dqdci =  - k_r;
-        J[1242] -= dqdci;             /* dwdot[H]/d[CH2O] */
-        J[1257] -= dqdci;             /* dwdot[HCO]/d[CH2O] */
-        J[1258] += dqdci;             /* dwdot[CH2O]/d[CH2O] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[2][5] - 1)*dcdc_fac;
-        J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1914] -= dqdci;             /* dwdot[HCO]/d[C2H6] */
-        J[1915] += dqdci;             /* dwdot[CH2O]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[2][6] - 1)*dcdc_fac;
-        J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[3520] -= dqdci;             /* dwdot[HCO]/d[AR] */
-        J[3521] += dqdci;             /* dwdot[CH2O]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[2][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[16];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[2][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[2][2]*dcdc_fac;
-        dqdc[14] = TB[2][3]*dcdc_fac;
-        dqdc[15] = TB[2][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac + k_f*sc[1];
-        dqdc[17] = dcdc_fac - k_r;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[2][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[2][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+1] -= dqdc[k];
-            J[73*k+16] -= dqdc[k];
-            J[73*k+17] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[16] -= dcdc_fac;
+    Jmix[17] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[2][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[16] -= dqdci;               /* dwdot[HCO]/d[H2] */
+    J[17] += dqdci;               /* dwdot[CH2O]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[16];
+    J[74] -= dqdci;               /* dwdot[H]/d[H] */
+    J[89] -= dqdci;               /* dwdot[HCO]/d[H] */
+    J[90] += dqdci;               /* dwdot[CH2O]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[2][1] - 1)*dcdc_fac;
+    J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[381] -= dqdci;              /* dwdot[HCO]/d[H2O] */
+    J[382] += dqdci;              /* dwdot[CH2O]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[2][2] - 1)*dcdc_fac;
+    J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[965] -= dqdci;              /* dwdot[HCO]/d[CH4] */
+    J[966] += dqdci;              /* dwdot[CH2O]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[2][3] - 1)*dcdc_fac;
+    J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1038] -= dqdci;             /* dwdot[HCO]/d[CO] */
+    J[1039] += dqdci;             /* dwdot[CH2O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[2][4] - 1)*dcdc_fac;
+    J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1111] -= dqdci;             /* dwdot[HCO]/d[CO2] */
+    J[1112] += dqdci;             /* dwdot[CH2O]/d[CO2] */
+    /* d()/d[HCO] */
+    dqdci =  + k_f*sc[1];
+    J[1169] -= dqdci;             /* dwdot[H]/d[HCO] */
+    J[1184] -= dqdci;             /* dwdot[HCO]/d[HCO] */
+    J[1185] += dqdci;             /* dwdot[CH2O]/d[HCO] */
+    /* d()/d[CH2O] */
+    dqdci =  - k_r;
+    J[1242] -= dqdci;             /* dwdot[H]/d[CH2O] */
+    J[1257] -= dqdci;             /* dwdot[HCO]/d[CH2O] */
+    J[1258] += dqdci;             /* dwdot[CH2O]/d[CH2O] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[2][5] - 1)*dcdc_fac;
+    J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1914] -= dqdci;             /* dwdot[HCO]/d[C2H6] */
+    J[1915] += dqdci;             /* dwdot[CH2O]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[2][6] - 1)*dcdc_fac;
+    J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[3520] -= dqdci;             /* dwdot[HCO]/d[AR] */
+    J[3521] += dqdci;             /* dwdot[CH2O]/d[AR] */
     J[5257] -= dqdT; /* dwdot[H]/dT */
     J[5272] -= dqdT; /* dwdot[HCO]/dT */
     J[5273] += dqdT; /* dwdot[CH2O]/dT */
@@ -37546,11 +38555,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[13] + (TB[3][3] - 1)*sc[14] + (TB[3][4] - 1)*sc[15] + (TB[3][5] - 1)*sc[26];
+    alpha = alpha_eff1;
     /* forward */
     phi_f = sc[1]*sc[17];
-    k_f = prefactor_units[3] * fwd_A[3]
-                * exp(fwd_beta[3] * tc[0] - activation_units[3] * fwd_Ea[3] * invT);
+    k_f = k_f_s[3];
     dlnkfdT = fwd_beta[3] * invT + activation_units[3] * fwd_Ea[3] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[3] * exp(low_beta[3] * tc[0] - activation_units[3] * low_Ea[3] * invT);
@@ -37566,16 +38574,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[3] == 4 ? exp(-troe_Tss[3] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[3]) > 1.e-100 ? -Fcent1/troe_Tsss[3] : 0.)
+      + (fabs(troe_Ts[3]) > 1.e-100 ? -Fcent2/troe_Ts[3] : 0.)
+      + (troe_len[3] == 4 ? Fcent3*troe_Tss[3]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[3]) > 1.e-100 ? -Fcent1/troe_Tsss[3] : 0.)
-      + (fabs(troe_Ts[3]) > 1.e-100 ? -Fcent2/troe_Ts[3] : 0.)
-      + (troe_len[3] == 4 ? Fcent3*troe_Tss[3]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -37583,7 +38591,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[18];
-    Kc = refCinv * exp(g_RT[1] + g_RT[17] - g_RT[18]);
+    Kc = Kc_s[3];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[17]) + (h_RT[18]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37601,132 +38609,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[3][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[17] -= dqdci;               /* dwdot[CH2O]/d[H2] */
-        J[18] += dqdci;               /* dwdot[CH2OH]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[17];
-        J[74] -= dqdci;               /* dwdot[H]/d[H] */
-        J[90] -= dqdci;               /* dwdot[CH2O]/d[H] */
-        J[91] += dqdci;               /* dwdot[CH2OH]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[3][1] - 1)*dcdc_fac;
-        J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[382] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
-        J[383] += dqdci;              /* dwdot[CH2OH]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[3][2] - 1)*dcdc_fac;
-        J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[966] -= dqdci;              /* dwdot[CH2O]/d[CH4] */
-        J[967] += dqdci;              /* dwdot[CH2OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[3][3] - 1)*dcdc_fac;
-        J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1039] -= dqdci;             /* dwdot[CH2O]/d[CO] */
-        J[1040] += dqdci;             /* dwdot[CH2OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[3][4] - 1)*dcdc_fac;
-        J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1112] -= dqdci;             /* dwdot[CH2O]/d[CO2] */
-        J[1113] += dqdci;             /* dwdot[CH2OH]/d[CO2] */
-        /* d()/d[CH2O] */
-        dqdci =  + k_f*sc[1];
-        J[1242] -= dqdci;             /* dwdot[H]/d[CH2O] */
-        J[1258] -= dqdci;             /* dwdot[CH2O]/d[CH2O] */
-        J[1259] += dqdci;             /* dwdot[CH2OH]/d[CH2O] */
-        /* d()/d[CH2OH] */
-        dqdci =  - k_r;
-        J[1315] -= dqdci;             /* dwdot[H]/d[CH2OH] */
-        J[1331] -= dqdci;             /* dwdot[CH2O]/d[CH2OH] */
-        J[1332] += dqdci;             /* dwdot[CH2OH]/d[CH2OH] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[3][5] - 1)*dcdc_fac;
-        J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1915] -= dqdci;             /* dwdot[CH2O]/d[C2H6] */
-        J[1916] += dqdci;             /* dwdot[CH2OH]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[3][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[17];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[3][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[3][2]*dcdc_fac;
-        dqdc[14] = TB[3][3]*dcdc_fac;
-        dqdc[15] = TB[3][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac + k_f*sc[1];
-        dqdc[18] = dcdc_fac - k_r;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[3][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+1] -= dqdc[k];
-            J[73*k+17] -= dqdc[k];
-            J[73*k+18] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[17] -= dcdc_fac;
+    Jmix[18] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[3][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[17] -= dqdci;               /* dwdot[CH2O]/d[H2] */
+    J[18] += dqdci;               /* dwdot[CH2OH]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[17];
+    J[74] -= dqdci;               /* dwdot[H]/d[H] */
+    J[90] -= dqdci;               /* dwdot[CH2O]/d[H] */
+    J[91] += dqdci;               /* dwdot[CH2OH]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[3][1] - 1)*dcdc_fac;
+    J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[382] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
+    J[383] += dqdci;              /* dwdot[CH2OH]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[3][2] - 1)*dcdc_fac;
+    J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[966] -= dqdci;              /* dwdot[CH2O]/d[CH4] */
+    J[967] += dqdci;              /* dwdot[CH2OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[3][3] - 1)*dcdc_fac;
+    J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1039] -= dqdci;             /* dwdot[CH2O]/d[CO] */
+    J[1040] += dqdci;             /* dwdot[CH2OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[3][4] - 1)*dcdc_fac;
+    J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1112] -= dqdci;             /* dwdot[CH2O]/d[CO2] */
+    J[1113] += dqdci;             /* dwdot[CH2OH]/d[CO2] */
+    /* d()/d[CH2O] */
+    dqdci =  + k_f*sc[1];
+    J[1242] -= dqdci;             /* dwdot[H]/d[CH2O] */
+    J[1258] -= dqdci;             /* dwdot[CH2O]/d[CH2O] */
+    J[1259] += dqdci;             /* dwdot[CH2OH]/d[CH2O] */
+    /* d()/d[CH2OH] */
+    dqdci =  - k_r;
+    J[1315] -= dqdci;             /* dwdot[H]/d[CH2OH] */
+    J[1331] -= dqdci;             /* dwdot[CH2O]/d[CH2OH] */
+    J[1332] += dqdci;             /* dwdot[CH2OH]/d[CH2OH] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[3][5] - 1)*dcdc_fac;
+    J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1915] -= dqdci;             /* dwdot[CH2O]/d[C2H6] */
+    J[1916] += dqdci;             /* dwdot[CH2OH]/d[C2H6] */
     J[5257] -= dqdT; /* dwdot[H]/dT */
     J[5273] -= dqdT; /* dwdot[CH2O]/dT */
     J[5274] += dqdT; /* dwdot[CH2OH]/dT */
@@ -37735,11 +38666,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[13] + (TB[4][3] - 1)*sc[14] + (TB[4][4] - 1)*sc[15] + (TB[4][5] - 1)*sc[26];
+    alpha = (memcmp(TB[4], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[13] + (TB[4][3] - 1)*sc[14] + (TB[4][4] - 1)*sc[15] + (TB[4][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[1]*sc[17];
-    k_f = prefactor_units[4] * fwd_A[4]
-                * exp(fwd_beta[4] * tc[0] - activation_units[4] * fwd_Ea[4] * invT);
+    k_f = k_f_s[4];
     dlnkfdT = fwd_beta[4] * invT + activation_units[4] * fwd_Ea[4] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[4] * exp(low_beta[4] * tc[0] - activation_units[4] * low_Ea[4] * invT);
@@ -37755,16 +38685,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[4] == 4 ? exp(-troe_Tss[4] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[4]) > 1.e-100 ? -Fcent1/troe_Tsss[4] : 0.)
+      + (fabs(troe_Ts[4]) > 1.e-100 ? -Fcent2/troe_Ts[4] : 0.)
+      + (troe_len[4] == 4 ? Fcent3*troe_Tss[4]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[4]) > 1.e-100 ? -Fcent1/troe_Tsss[4] : 0.)
-      + (fabs(troe_Ts[4]) > 1.e-100 ? -Fcent2/troe_Ts[4] : 0.)
-      + (troe_len[4] == 4 ? Fcent3*troe_Tss[4]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -37772,7 +38702,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[19];
-    Kc = refCinv * exp(g_RT[1] + g_RT[17] - g_RT[19]);
+    Kc = Kc_s[4];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[17]) + (h_RT[19]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37790,132 +38720,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[4][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[17] -= dqdci;               /* dwdot[CH2O]/d[H2] */
-        J[19] += dqdci;               /* dwdot[CH3O]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[17];
-        J[74] -= dqdci;               /* dwdot[H]/d[H] */
-        J[90] -= dqdci;               /* dwdot[CH2O]/d[H] */
-        J[92] += dqdci;               /* dwdot[CH3O]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[4][1] - 1)*dcdc_fac;
-        J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[382] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
-        J[384] += dqdci;              /* dwdot[CH3O]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[4][2] - 1)*dcdc_fac;
-        J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[966] -= dqdci;              /* dwdot[CH2O]/d[CH4] */
-        J[968] += dqdci;              /* dwdot[CH3O]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[4][3] - 1)*dcdc_fac;
-        J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1039] -= dqdci;             /* dwdot[CH2O]/d[CO] */
-        J[1041] += dqdci;             /* dwdot[CH3O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[4][4] - 1)*dcdc_fac;
-        J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1112] -= dqdci;             /* dwdot[CH2O]/d[CO2] */
-        J[1114] += dqdci;             /* dwdot[CH3O]/d[CO2] */
-        /* d()/d[CH2O] */
-        dqdci =  + k_f*sc[1];
-        J[1242] -= dqdci;             /* dwdot[H]/d[CH2O] */
-        J[1258] -= dqdci;             /* dwdot[CH2O]/d[CH2O] */
-        J[1260] += dqdci;             /* dwdot[CH3O]/d[CH2O] */
-        /* d()/d[CH3O] */
-        dqdci =  - k_r;
-        J[1388] -= dqdci;             /* dwdot[H]/d[CH3O] */
-        J[1404] -= dqdci;             /* dwdot[CH2O]/d[CH3O] */
-        J[1406] += dqdci;             /* dwdot[CH3O]/d[CH3O] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[4][5] - 1)*dcdc_fac;
-        J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1915] -= dqdci;             /* dwdot[CH2O]/d[C2H6] */
-        J[1917] += dqdci;             /* dwdot[CH3O]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[4][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[17];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[4][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[4][2]*dcdc_fac;
-        dqdc[14] = TB[4][3]*dcdc_fac;
-        dqdc[15] = TB[4][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac + k_f*sc[1];
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac - k_r;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[4][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+1] -= dqdc[k];
-            J[73*k+17] -= dqdc[k];
-            J[73*k+19] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[17] -= dcdc_fac;
+    Jmix[19] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[4][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[17] -= dqdci;               /* dwdot[CH2O]/d[H2] */
+    J[19] += dqdci;               /* dwdot[CH3O]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[17];
+    J[74] -= dqdci;               /* dwdot[H]/d[H] */
+    J[90] -= dqdci;               /* dwdot[CH2O]/d[H] */
+    J[92] += dqdci;               /* dwdot[CH3O]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[4][1] - 1)*dcdc_fac;
+    J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[382] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
+    J[384] += dqdci;              /* dwdot[CH3O]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[4][2] - 1)*dcdc_fac;
+    J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[966] -= dqdci;              /* dwdot[CH2O]/d[CH4] */
+    J[968] += dqdci;              /* dwdot[CH3O]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[4][3] - 1)*dcdc_fac;
+    J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1039] -= dqdci;             /* dwdot[CH2O]/d[CO] */
+    J[1041] += dqdci;             /* dwdot[CH3O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[4][4] - 1)*dcdc_fac;
+    J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1112] -= dqdci;             /* dwdot[CH2O]/d[CO2] */
+    J[1114] += dqdci;             /* dwdot[CH3O]/d[CO2] */
+    /* d()/d[CH2O] */
+    dqdci =  + k_f*sc[1];
+    J[1242] -= dqdci;             /* dwdot[H]/d[CH2O] */
+    J[1258] -= dqdci;             /* dwdot[CH2O]/d[CH2O] */
+    J[1260] += dqdci;             /* dwdot[CH3O]/d[CH2O] */
+    /* d()/d[CH3O] */
+    dqdci =  - k_r;
+    J[1388] -= dqdci;             /* dwdot[H]/d[CH3O] */
+    J[1404] -= dqdci;             /* dwdot[CH2O]/d[CH3O] */
+    J[1406] += dqdci;             /* dwdot[CH3O]/d[CH3O] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[4][5] - 1)*dcdc_fac;
+    J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1915] -= dqdci;             /* dwdot[CH2O]/d[C2H6] */
+    J[1917] += dqdci;             /* dwdot[CH3O]/d[C2H6] */
     J[5257] -= dqdT; /* dwdot[H]/dT */
     J[5273] -= dqdT; /* dwdot[CH2O]/dT */
     J[5275] += dqdT; /* dwdot[CH3O]/dT */
@@ -37924,11 +38777,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[13] + (TB[5][3] - 1)*sc[14] + (TB[5][4] - 1)*sc[15] + (TB[5][5] - 1)*sc[26];
+    alpha = (memcmp(TB[5], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[13] + (TB[5][3] - 1)*sc[14] + (TB[5][4] - 1)*sc[15] + (TB[5][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[1]*sc[18];
-    k_f = prefactor_units[5] * fwd_A[5]
-                * exp(fwd_beta[5] * tc[0] - activation_units[5] * fwd_Ea[5] * invT);
+    k_f = k_f_s[5];
     dlnkfdT = fwd_beta[5] * invT + activation_units[5] * fwd_Ea[5] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[5] * exp(low_beta[5] * tc[0] - activation_units[5] * low_Ea[5] * invT);
@@ -37944,16 +38796,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[5] == 4 ? exp(-troe_Tss[5] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[5]) > 1.e-100 ? -Fcent1/troe_Tsss[5] : 0.)
+      + (fabs(troe_Ts[5]) > 1.e-100 ? -Fcent2/troe_Ts[5] : 0.)
+      + (troe_len[5] == 4 ? Fcent3*troe_Tss[5]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[5]) > 1.e-100 ? -Fcent1/troe_Tsss[5] : 0.)
-      + (fabs(troe_Ts[5]) > 1.e-100 ? -Fcent2/troe_Ts[5] : 0.)
-      + (troe_len[5] == 4 ? Fcent3*troe_Tss[5]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -37961,7 +38813,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[20];
-    Kc = refCinv * exp(g_RT[1] + g_RT[18] - g_RT[20]);
+    Kc = Kc_s[5];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[18]) + (h_RT[20]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37979,132 +38831,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[5][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[18] -= dqdci;               /* dwdot[CH2OH]/d[H2] */
-        J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[18];
-        J[74] -= dqdci;               /* dwdot[H]/d[H] */
-        J[91] -= dqdci;               /* dwdot[CH2OH]/d[H] */
-        J[93] += dqdci;               /* dwdot[CH3OH]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[5][1] - 1)*dcdc_fac;
-        J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[383] -= dqdci;              /* dwdot[CH2OH]/d[H2O] */
-        J[385] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[5][2] - 1)*dcdc_fac;
-        J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[967] -= dqdci;              /* dwdot[CH2OH]/d[CH4] */
-        J[969] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[5][3] - 1)*dcdc_fac;
-        J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1040] -= dqdci;             /* dwdot[CH2OH]/d[CO] */
-        J[1042] += dqdci;             /* dwdot[CH3OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[5][4] - 1)*dcdc_fac;
-        J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1113] -= dqdci;             /* dwdot[CH2OH]/d[CO2] */
-        J[1115] += dqdci;             /* dwdot[CH3OH]/d[CO2] */
-        /* d()/d[CH2OH] */
-        dqdci =  + k_f*sc[1];
-        J[1315] -= dqdci;             /* dwdot[H]/d[CH2OH] */
-        J[1332] -= dqdci;             /* dwdot[CH2OH]/d[CH2OH] */
-        J[1334] += dqdci;             /* dwdot[CH3OH]/d[CH2OH] */
-        /* d()/d[CH3OH] */
-        dqdci =  - k_r;
-        J[1461] -= dqdci;             /* dwdot[H]/d[CH3OH] */
-        J[1478] -= dqdci;             /* dwdot[CH2OH]/d[CH3OH] */
-        J[1480] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[5][5] - 1)*dcdc_fac;
-        J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1916] -= dqdci;             /* dwdot[CH2OH]/d[C2H6] */
-        J[1918] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[5][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[18];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[5][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[5][2]*dcdc_fac;
-        dqdc[14] = TB[5][3]*dcdc_fac;
-        dqdc[15] = TB[5][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac + k_f*sc[1];
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac - k_r;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[5][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+1] -= dqdc[k];
-            J[73*k+18] -= dqdc[k];
-            J[73*k+20] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[18] -= dcdc_fac;
+    Jmix[20] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[5][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[18] -= dqdci;               /* dwdot[CH2OH]/d[H2] */
+    J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[18];
+    J[74] -= dqdci;               /* dwdot[H]/d[H] */
+    J[91] -= dqdci;               /* dwdot[CH2OH]/d[H] */
+    J[93] += dqdci;               /* dwdot[CH3OH]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[5][1] - 1)*dcdc_fac;
+    J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[383] -= dqdci;              /* dwdot[CH2OH]/d[H2O] */
+    J[385] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[5][2] - 1)*dcdc_fac;
+    J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[967] -= dqdci;              /* dwdot[CH2OH]/d[CH4] */
+    J[969] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[5][3] - 1)*dcdc_fac;
+    J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1040] -= dqdci;             /* dwdot[CH2OH]/d[CO] */
+    J[1042] += dqdci;             /* dwdot[CH3OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[5][4] - 1)*dcdc_fac;
+    J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1113] -= dqdci;             /* dwdot[CH2OH]/d[CO2] */
+    J[1115] += dqdci;             /* dwdot[CH3OH]/d[CO2] */
+    /* d()/d[CH2OH] */
+    dqdci =  + k_f*sc[1];
+    J[1315] -= dqdci;             /* dwdot[H]/d[CH2OH] */
+    J[1332] -= dqdci;             /* dwdot[CH2OH]/d[CH2OH] */
+    J[1334] += dqdci;             /* dwdot[CH3OH]/d[CH2OH] */
+    /* d()/d[CH3OH] */
+    dqdci =  - k_r;
+    J[1461] -= dqdci;             /* dwdot[H]/d[CH3OH] */
+    J[1478] -= dqdci;             /* dwdot[CH2OH]/d[CH3OH] */
+    J[1480] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[5][5] - 1)*dcdc_fac;
+    J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1916] -= dqdci;             /* dwdot[CH2OH]/d[C2H6] */
+    J[1918] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
     J[5257] -= dqdT; /* dwdot[H]/dT */
     J[5274] -= dqdT; /* dwdot[CH2OH]/dT */
     J[5276] += dqdT; /* dwdot[CH3OH]/dT */
@@ -38113,11 +38888,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[6][0] - 1)*sc[0] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[13] + (TB[6][3] - 1)*sc[14] + (TB[6][4] - 1)*sc[15] + (TB[6][5] - 1)*sc[26];
+    alpha = (memcmp(TB[6], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[6][0] - 1)*sc[0] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[13] + (TB[6][3] - 1)*sc[14] + (TB[6][4] - 1)*sc[15] + (TB[6][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[6] * fwd_A[6]
-                * exp(fwd_beta[6] * tc[0] - activation_units[6] * fwd_Ea[6] * invT);
+    k_f = k_f_s[6];
     dlnkfdT = fwd_beta[6] * invT + activation_units[6] * fwd_Ea[6] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[6] * exp(low_beta[6] * tc[0] - activation_units[6] * low_Ea[6] * invT);
@@ -38133,16 +38907,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[6] == 4 ? exp(-troe_Tss[6] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[6]) > 1.e-100 ? -Fcent1/troe_Tsss[6] : 0.)
+      + (fabs(troe_Ts[6]) > 1.e-100 ? -Fcent2/troe_Ts[6] : 0.)
+      + (troe_len[6] == 4 ? Fcent3*troe_Tss[6]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[6]) > 1.e-100 ? -Fcent1/troe_Tsss[6] : 0.)
-      + (fabs(troe_Ts[6]) > 1.e-100 ? -Fcent2/troe_Ts[6] : 0.)
-      + (troe_len[6] == 4 ? Fcent3*troe_Tss[6]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -38150,7 +38924,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[20];
-    Kc = refCinv * exp(g_RT[1] + g_RT[19] - g_RT[20]);
+    Kc = Kc_s[6];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[20]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38168,132 +38942,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[6][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[19] -= dqdci;               /* dwdot[CH3O]/d[H2] */
-        J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[19];
-        J[74] -= dqdci;               /* dwdot[H]/d[H] */
-        J[92] -= dqdci;               /* dwdot[CH3O]/d[H] */
-        J[93] += dqdci;               /* dwdot[CH3OH]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[6][1] - 1)*dcdc_fac;
-        J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[384] -= dqdci;              /* dwdot[CH3O]/d[H2O] */
-        J[385] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[6][2] - 1)*dcdc_fac;
-        J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[968] -= dqdci;              /* dwdot[CH3O]/d[CH4] */
-        J[969] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[6][3] - 1)*dcdc_fac;
-        J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1041] -= dqdci;             /* dwdot[CH3O]/d[CO] */
-        J[1042] += dqdci;             /* dwdot[CH3OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[6][4] - 1)*dcdc_fac;
-        J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1114] -= dqdci;             /* dwdot[CH3O]/d[CO2] */
-        J[1115] += dqdci;             /* dwdot[CH3OH]/d[CO2] */
-        /* d()/d[CH3O] */
-        dqdci =  + k_f*sc[1];
-        J[1388] -= dqdci;             /* dwdot[H]/d[CH3O] */
-        J[1406] -= dqdci;             /* dwdot[CH3O]/d[CH3O] */
-        J[1407] += dqdci;             /* dwdot[CH3OH]/d[CH3O] */
-        /* d()/d[CH3OH] */
-        dqdci =  - k_r;
-        J[1461] -= dqdci;             /* dwdot[H]/d[CH3OH] */
-        J[1479] -= dqdci;             /* dwdot[CH3O]/d[CH3OH] */
-        J[1480] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[6][5] - 1)*dcdc_fac;
-        J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1917] -= dqdci;             /* dwdot[CH3O]/d[C2H6] */
-        J[1918] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[6][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[19];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[6][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[6][2]*dcdc_fac;
-        dqdc[14] = TB[6][3]*dcdc_fac;
-        dqdc[15] = TB[6][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac + k_f*sc[1];
-        dqdc[20] = dcdc_fac - k_r;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[6][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+1] -= dqdc[k];
-            J[73*k+19] -= dqdc[k];
-            J[73*k+20] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[19] -= dcdc_fac;
+    Jmix[20] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[6][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[19] -= dqdci;               /* dwdot[CH3O]/d[H2] */
+    J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[19];
+    J[74] -= dqdci;               /* dwdot[H]/d[H] */
+    J[92] -= dqdci;               /* dwdot[CH3O]/d[H] */
+    J[93] += dqdci;               /* dwdot[CH3OH]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[6][1] - 1)*dcdc_fac;
+    J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[384] -= dqdci;              /* dwdot[CH3O]/d[H2O] */
+    J[385] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[6][2] - 1)*dcdc_fac;
+    J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[968] -= dqdci;              /* dwdot[CH3O]/d[CH4] */
+    J[969] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[6][3] - 1)*dcdc_fac;
+    J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1041] -= dqdci;             /* dwdot[CH3O]/d[CO] */
+    J[1042] += dqdci;             /* dwdot[CH3OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[6][4] - 1)*dcdc_fac;
+    J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1114] -= dqdci;             /* dwdot[CH3O]/d[CO2] */
+    J[1115] += dqdci;             /* dwdot[CH3OH]/d[CO2] */
+    /* d()/d[CH3O] */
+    dqdci =  + k_f*sc[1];
+    J[1388] -= dqdci;             /* dwdot[H]/d[CH3O] */
+    J[1406] -= dqdci;             /* dwdot[CH3O]/d[CH3O] */
+    J[1407] += dqdci;             /* dwdot[CH3OH]/d[CH3O] */
+    /* d()/d[CH3OH] */
+    dqdci =  - k_r;
+    J[1461] -= dqdci;             /* dwdot[H]/d[CH3OH] */
+    J[1479] -= dqdci;             /* dwdot[CH3O]/d[CH3OH] */
+    J[1480] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[6][5] - 1)*dcdc_fac;
+    J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1917] -= dqdci;             /* dwdot[CH3O]/d[C2H6] */
+    J[1918] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
     J[5257] -= dqdT; /* dwdot[H]/dT */
     J[5275] -= dqdT; /* dwdot[CH3O]/dT */
     J[5276] += dqdT; /* dwdot[CH3OH]/dT */
@@ -38302,11 +38999,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[7][0] - 1)*sc[0] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[13] + (TB[7][3] - 1)*sc[14] + (TB[7][4] - 1)*sc[15] + (TB[7][5] - 1)*sc[26] + (TB[7][6] - 1)*sc[48];
+    alpha = (memcmp(TB[7], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[7][0] - 1)*sc[0] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[13] + (TB[7][3] - 1)*sc[14] + (TB[7][4] - 1)*sc[15] + (TB[7][5] - 1)*sc[26] + (TB[7][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[1]*sc[21];
-    k_f = prefactor_units[7] * fwd_A[7]
-                * exp(fwd_beta[7] * tc[0] - activation_units[7] * fwd_Ea[7] * invT);
+    k_f = k_f_s[7];
     dlnkfdT = fwd_beta[7] * invT + activation_units[7] * fwd_Ea[7] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[7] * exp(low_beta[7] * tc[0] - activation_units[7] * low_Ea[7] * invT);
@@ -38322,16 +39018,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[7] == 4 ? exp(-troe_Tss[7] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[7]) > 1.e-100 ? -Fcent1/troe_Tsss[7] : 0.)
+      + (fabs(troe_Ts[7]) > 1.e-100 ? -Fcent2/troe_Ts[7] : 0.)
+      + (troe_len[7] == 4 ? Fcent3*troe_Tss[7]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[7]) > 1.e-100 ? -Fcent1/troe_Tsss[7] : 0.)
-      + (fabs(troe_Ts[7]) > 1.e-100 ? -Fcent2/troe_Ts[7] : 0.)
-      + (troe_len[7] == 4 ? Fcent3*troe_Tss[7]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -38339,7 +39035,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[22];
-    Kc = refCinv * exp(g_RT[1] + g_RT[21] - g_RT[22]);
+    Kc = Kc_s[7];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[21]) + (h_RT[22]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38357,137 +39053,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[7][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[21] -= dqdci;               /* dwdot[C2H]/d[H2] */
-        J[22] += dqdci;               /* dwdot[C2H2]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[21];
-        J[74] -= dqdci;               /* dwdot[H]/d[H] */
-        J[94] -= dqdci;               /* dwdot[C2H]/d[H] */
-        J[95] += dqdci;               /* dwdot[C2H2]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[7][1] - 1)*dcdc_fac;
-        J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[386] -= dqdci;              /* dwdot[C2H]/d[H2O] */
-        J[387] += dqdci;              /* dwdot[C2H2]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[7][2] - 1)*dcdc_fac;
-        J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[970] -= dqdci;              /* dwdot[C2H]/d[CH4] */
-        J[971] += dqdci;              /* dwdot[C2H2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[7][3] - 1)*dcdc_fac;
-        J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1043] -= dqdci;             /* dwdot[C2H]/d[CO] */
-        J[1044] += dqdci;             /* dwdot[C2H2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[7][4] - 1)*dcdc_fac;
-        J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1116] -= dqdci;             /* dwdot[C2H]/d[CO2] */
-        J[1117] += dqdci;             /* dwdot[C2H2]/d[CO2] */
-        /* d()/d[C2H] */
-        dqdci =  + k_f*sc[1];
-        J[1534] -= dqdci;             /* dwdot[H]/d[C2H] */
-        J[1554] -= dqdci;             /* dwdot[C2H]/d[C2H] */
-        J[1555] += dqdci;             /* dwdot[C2H2]/d[C2H] */
-        /* d()/d[C2H2] */
-        dqdci =  - k_r;
-        J[1607] -= dqdci;             /* dwdot[H]/d[C2H2] */
-        J[1627] -= dqdci;             /* dwdot[C2H]/d[C2H2] */
-        J[1628] += dqdci;             /* dwdot[C2H2]/d[C2H2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[7][5] - 1)*dcdc_fac;
-        J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1919] -= dqdci;             /* dwdot[C2H]/d[C2H6] */
-        J[1920] += dqdci;             /* dwdot[C2H2]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[7][6] - 1)*dcdc_fac;
-        J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[3525] -= dqdci;             /* dwdot[C2H]/d[AR] */
-        J[3526] += dqdci;             /* dwdot[C2H2]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[7][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[21];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[7][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[7][2]*dcdc_fac;
-        dqdc[14] = TB[7][3]*dcdc_fac;
-        dqdc[15] = TB[7][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac + k_f*sc[1];
-        dqdc[22] = dcdc_fac - k_r;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[7][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[7][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+1] -= dqdc[k];
-            J[73*k+21] -= dqdc[k];
-            J[73*k+22] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[21] -= dcdc_fac;
+    Jmix[22] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[7][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[21] -= dqdci;               /* dwdot[C2H]/d[H2] */
+    J[22] += dqdci;               /* dwdot[C2H2]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[21];
+    J[74] -= dqdci;               /* dwdot[H]/d[H] */
+    J[94] -= dqdci;               /* dwdot[C2H]/d[H] */
+    J[95] += dqdci;               /* dwdot[C2H2]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[7][1] - 1)*dcdc_fac;
+    J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[386] -= dqdci;              /* dwdot[C2H]/d[H2O] */
+    J[387] += dqdci;              /* dwdot[C2H2]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[7][2] - 1)*dcdc_fac;
+    J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[970] -= dqdci;              /* dwdot[C2H]/d[CH4] */
+    J[971] += dqdci;              /* dwdot[C2H2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[7][3] - 1)*dcdc_fac;
+    J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1043] -= dqdci;             /* dwdot[C2H]/d[CO] */
+    J[1044] += dqdci;             /* dwdot[C2H2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[7][4] - 1)*dcdc_fac;
+    J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1116] -= dqdci;             /* dwdot[C2H]/d[CO2] */
+    J[1117] += dqdci;             /* dwdot[C2H2]/d[CO2] */
+    /* d()/d[C2H] */
+    dqdci =  + k_f*sc[1];
+    J[1534] -= dqdci;             /* dwdot[H]/d[C2H] */
+    J[1554] -= dqdci;             /* dwdot[C2H]/d[C2H] */
+    J[1555] += dqdci;             /* dwdot[C2H2]/d[C2H] */
+    /* d()/d[C2H2] */
+    dqdci =  - k_r;
+    J[1607] -= dqdci;             /* dwdot[H]/d[C2H2] */
+    J[1627] -= dqdci;             /* dwdot[C2H]/d[C2H2] */
+    J[1628] += dqdci;             /* dwdot[C2H2]/d[C2H2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[7][5] - 1)*dcdc_fac;
+    J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1919] -= dqdci;             /* dwdot[C2H]/d[C2H6] */
+    J[1920] += dqdci;             /* dwdot[C2H2]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[7][6] - 1)*dcdc_fac;
+    J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[3525] -= dqdci;             /* dwdot[C2H]/d[AR] */
+    J[3526] += dqdci;             /* dwdot[C2H2]/d[AR] */
     J[5257] -= dqdT; /* dwdot[H]/dT */
     J[5277] -= dqdT; /* dwdot[C2H]/dT */
     J[5278] += dqdT; /* dwdot[C2H2]/dT */
@@ -38496,11 +39115,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[8][0] - 1)*sc[0] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[13] + (TB[8][3] - 1)*sc[14] + (TB[8][4] - 1)*sc[15] + (TB[8][5] - 1)*sc[26] + (TB[8][6] - 1)*sc[48];
+    alpha = (memcmp(TB[8], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[8][0] - 1)*sc[0] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[13] + (TB[8][3] - 1)*sc[14] + (TB[8][4] - 1)*sc[15] + (TB[8][5] - 1)*sc[26] + (TB[8][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[1]*sc[22];
-    k_f = prefactor_units[8] * fwd_A[8]
-                * exp(fwd_beta[8] * tc[0] - activation_units[8] * fwd_Ea[8] * invT);
+    k_f = k_f_s[8];
     dlnkfdT = fwd_beta[8] * invT + activation_units[8] * fwd_Ea[8] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[8] * exp(low_beta[8] * tc[0] - activation_units[8] * low_Ea[8] * invT);
@@ -38516,16 +39134,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[8] == 4 ? exp(-troe_Tss[8] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[8]) > 1.e-100 ? -Fcent1/troe_Tsss[8] : 0.)
+      + (fabs(troe_Ts[8]) > 1.e-100 ? -Fcent2/troe_Ts[8] : 0.)
+      + (troe_len[8] == 4 ? Fcent3*troe_Tss[8]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[8]) > 1.e-100 ? -Fcent1/troe_Tsss[8] : 0.)
-      + (fabs(troe_Ts[8]) > 1.e-100 ? -Fcent2/troe_Ts[8] : 0.)
-      + (troe_len[8] == 4 ? Fcent3*troe_Tss[8]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -38533,7 +39151,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[23];
-    Kc = refCinv * exp(g_RT[1] + g_RT[22] - g_RT[23]);
+    Kc = Kc_s[8];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[22]) + (h_RT[23]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38551,137 +39169,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[8][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[22] -= dqdci;               /* dwdot[C2H2]/d[H2] */
-        J[23] += dqdci;               /* dwdot[C2H3]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[22];
-        J[74] -= dqdci;               /* dwdot[H]/d[H] */
-        J[95] -= dqdci;               /* dwdot[C2H2]/d[H] */
-        J[96] += dqdci;               /* dwdot[C2H3]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[8][1] - 1)*dcdc_fac;
-        J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[387] -= dqdci;              /* dwdot[C2H2]/d[H2O] */
-        J[388] += dqdci;              /* dwdot[C2H3]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[8][2] - 1)*dcdc_fac;
-        J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[971] -= dqdci;              /* dwdot[C2H2]/d[CH4] */
-        J[972] += dqdci;              /* dwdot[C2H3]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[8][3] - 1)*dcdc_fac;
-        J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1044] -= dqdci;             /* dwdot[C2H2]/d[CO] */
-        J[1045] += dqdci;             /* dwdot[C2H3]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[8][4] - 1)*dcdc_fac;
-        J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1117] -= dqdci;             /* dwdot[C2H2]/d[CO2] */
-        J[1118] += dqdci;             /* dwdot[C2H3]/d[CO2] */
-        /* d()/d[C2H2] */
-        dqdci =  + k_f*sc[1];
-        J[1607] -= dqdci;             /* dwdot[H]/d[C2H2] */
-        J[1628] -= dqdci;             /* dwdot[C2H2]/d[C2H2] */
-        J[1629] += dqdci;             /* dwdot[C2H3]/d[C2H2] */
-        /* d()/d[C2H3] */
-        dqdci =  - k_r;
-        J[1680] -= dqdci;             /* dwdot[H]/d[C2H3] */
-        J[1701] -= dqdci;             /* dwdot[C2H2]/d[C2H3] */
-        J[1702] += dqdci;             /* dwdot[C2H3]/d[C2H3] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[8][5] - 1)*dcdc_fac;
-        J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1920] -= dqdci;             /* dwdot[C2H2]/d[C2H6] */
-        J[1921] += dqdci;             /* dwdot[C2H3]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[8][6] - 1)*dcdc_fac;
-        J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[3526] -= dqdci;             /* dwdot[C2H2]/d[AR] */
-        J[3527] += dqdci;             /* dwdot[C2H3]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[8][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[22];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[8][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[8][2]*dcdc_fac;
-        dqdc[14] = TB[8][3]*dcdc_fac;
-        dqdc[15] = TB[8][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac + k_f*sc[1];
-        dqdc[23] = dcdc_fac - k_r;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[8][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[8][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+1] -= dqdc[k];
-            J[73*k+22] -= dqdc[k];
-            J[73*k+23] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[22] -= dcdc_fac;
+    Jmix[23] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[8][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[22] -= dqdci;               /* dwdot[C2H2]/d[H2] */
+    J[23] += dqdci;               /* dwdot[C2H3]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[22];
+    J[74] -= dqdci;               /* dwdot[H]/d[H] */
+    J[95] -= dqdci;               /* dwdot[C2H2]/d[H] */
+    J[96] += dqdci;               /* dwdot[C2H3]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[8][1] - 1)*dcdc_fac;
+    J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[387] -= dqdci;              /* dwdot[C2H2]/d[H2O] */
+    J[388] += dqdci;              /* dwdot[C2H3]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[8][2] - 1)*dcdc_fac;
+    J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[971] -= dqdci;              /* dwdot[C2H2]/d[CH4] */
+    J[972] += dqdci;              /* dwdot[C2H3]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[8][3] - 1)*dcdc_fac;
+    J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1044] -= dqdci;             /* dwdot[C2H2]/d[CO] */
+    J[1045] += dqdci;             /* dwdot[C2H3]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[8][4] - 1)*dcdc_fac;
+    J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1117] -= dqdci;             /* dwdot[C2H2]/d[CO2] */
+    J[1118] += dqdci;             /* dwdot[C2H3]/d[CO2] */
+    /* d()/d[C2H2] */
+    dqdci =  + k_f*sc[1];
+    J[1607] -= dqdci;             /* dwdot[H]/d[C2H2] */
+    J[1628] -= dqdci;             /* dwdot[C2H2]/d[C2H2] */
+    J[1629] += dqdci;             /* dwdot[C2H3]/d[C2H2] */
+    /* d()/d[C2H3] */
+    dqdci =  - k_r;
+    J[1680] -= dqdci;             /* dwdot[H]/d[C2H3] */
+    J[1701] -= dqdci;             /* dwdot[C2H2]/d[C2H3] */
+    J[1702] += dqdci;             /* dwdot[C2H3]/d[C2H3] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[8][5] - 1)*dcdc_fac;
+    J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1920] -= dqdci;             /* dwdot[C2H2]/d[C2H6] */
+    J[1921] += dqdci;             /* dwdot[C2H3]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[8][6] - 1)*dcdc_fac;
+    J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[3526] -= dqdci;             /* dwdot[C2H2]/d[AR] */
+    J[3527] += dqdci;             /* dwdot[C2H3]/d[AR] */
     J[5257] -= dqdT; /* dwdot[H]/dT */
     J[5278] -= dqdT; /* dwdot[C2H2]/dT */
     J[5279] += dqdT; /* dwdot[C2H3]/dT */
@@ -38690,11 +39231,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[9][0] - 1)*sc[0] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[13] + (TB[9][3] - 1)*sc[14] + (TB[9][4] - 1)*sc[15] + (TB[9][5] - 1)*sc[26] + (TB[9][6] - 1)*sc[48];
+    alpha = (memcmp(TB[9], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[9][0] - 1)*sc[0] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[13] + (TB[9][3] - 1)*sc[14] + (TB[9][4] - 1)*sc[15] + (TB[9][5] - 1)*sc[26] + (TB[9][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[1]*sc[23];
-    k_f = prefactor_units[9] * fwd_A[9]
-                * exp(fwd_beta[9] * tc[0] - activation_units[9] * fwd_Ea[9] * invT);
+    k_f = k_f_s[9];
     dlnkfdT = fwd_beta[9] * invT + activation_units[9] * fwd_Ea[9] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[9] * exp(low_beta[9] * tc[0] - activation_units[9] * low_Ea[9] * invT);
@@ -38710,16 +39250,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[9] == 4 ? exp(-troe_Tss[9] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[9]) > 1.e-100 ? -Fcent1/troe_Tsss[9] : 0.)
+      + (fabs(troe_Ts[9]) > 1.e-100 ? -Fcent2/troe_Ts[9] : 0.)
+      + (troe_len[9] == 4 ? Fcent3*troe_Tss[9]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[9]) > 1.e-100 ? -Fcent1/troe_Tsss[9] : 0.)
-      + (fabs(troe_Ts[9]) > 1.e-100 ? -Fcent2/troe_Ts[9] : 0.)
-      + (troe_len[9] == 4 ? Fcent3*troe_Tss[9]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -38727,7 +39267,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[24];
-    Kc = refCinv * exp(g_RT[1] + g_RT[23] - g_RT[24]);
+    Kc = Kc_s[9];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[23]) + (h_RT[24]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38745,137 +39285,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[9][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[23] -= dqdci;               /* dwdot[C2H3]/d[H2] */
-        J[24] += dqdci;               /* dwdot[C2H4]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[23];
-        J[74] -= dqdci;               /* dwdot[H]/d[H] */
-        J[96] -= dqdci;               /* dwdot[C2H3]/d[H] */
-        J[97] += dqdci;               /* dwdot[C2H4]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[9][1] - 1)*dcdc_fac;
-        J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[388] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
-        J[389] += dqdci;              /* dwdot[C2H4]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[9][2] - 1)*dcdc_fac;
-        J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[972] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
-        J[973] += dqdci;              /* dwdot[C2H4]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[9][3] - 1)*dcdc_fac;
-        J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1045] -= dqdci;             /* dwdot[C2H3]/d[CO] */
-        J[1046] += dqdci;             /* dwdot[C2H4]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[9][4] - 1)*dcdc_fac;
-        J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1118] -= dqdci;             /* dwdot[C2H3]/d[CO2] */
-        J[1119] += dqdci;             /* dwdot[C2H4]/d[CO2] */
-        /* d()/d[C2H3] */
-        dqdci =  + k_f*sc[1];
-        J[1680] -= dqdci;             /* dwdot[H]/d[C2H3] */
-        J[1702] -= dqdci;             /* dwdot[C2H3]/d[C2H3] */
-        J[1703] += dqdci;             /* dwdot[C2H4]/d[C2H3] */
-        /* d()/d[C2H4] */
-        dqdci =  - k_r;
-        J[1753] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1775] -= dqdci;             /* dwdot[C2H3]/d[C2H4] */
-        J[1776] += dqdci;             /* dwdot[C2H4]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[9][5] - 1)*dcdc_fac;
-        J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1921] -= dqdci;             /* dwdot[C2H3]/d[C2H6] */
-        J[1922] += dqdci;             /* dwdot[C2H4]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[9][6] - 1)*dcdc_fac;
-        J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[3527] -= dqdci;             /* dwdot[C2H3]/d[AR] */
-        J[3528] += dqdci;             /* dwdot[C2H4]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[9][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[23];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[9][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[9][2]*dcdc_fac;
-        dqdc[14] = TB[9][3]*dcdc_fac;
-        dqdc[15] = TB[9][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac + k_f*sc[1];
-        dqdc[24] = dcdc_fac - k_r;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[9][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[9][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+1] -= dqdc[k];
-            J[73*k+23] -= dqdc[k];
-            J[73*k+24] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[23] -= dcdc_fac;
+    Jmix[24] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[9][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[23] -= dqdci;               /* dwdot[C2H3]/d[H2] */
+    J[24] += dqdci;               /* dwdot[C2H4]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[23];
+    J[74] -= dqdci;               /* dwdot[H]/d[H] */
+    J[96] -= dqdci;               /* dwdot[C2H3]/d[H] */
+    J[97] += dqdci;               /* dwdot[C2H4]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[9][1] - 1)*dcdc_fac;
+    J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[388] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
+    J[389] += dqdci;              /* dwdot[C2H4]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[9][2] - 1)*dcdc_fac;
+    J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[972] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
+    J[973] += dqdci;              /* dwdot[C2H4]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[9][3] - 1)*dcdc_fac;
+    J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1045] -= dqdci;             /* dwdot[C2H3]/d[CO] */
+    J[1046] += dqdci;             /* dwdot[C2H4]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[9][4] - 1)*dcdc_fac;
+    J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1118] -= dqdci;             /* dwdot[C2H3]/d[CO2] */
+    J[1119] += dqdci;             /* dwdot[C2H4]/d[CO2] */
+    /* d()/d[C2H3] */
+    dqdci =  + k_f*sc[1];
+    J[1680] -= dqdci;             /* dwdot[H]/d[C2H3] */
+    J[1702] -= dqdci;             /* dwdot[C2H3]/d[C2H3] */
+    J[1703] += dqdci;             /* dwdot[C2H4]/d[C2H3] */
+    /* d()/d[C2H4] */
+    dqdci =  - k_r;
+    J[1753] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1775] -= dqdci;             /* dwdot[C2H3]/d[C2H4] */
+    J[1776] += dqdci;             /* dwdot[C2H4]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[9][5] - 1)*dcdc_fac;
+    J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1921] -= dqdci;             /* dwdot[C2H3]/d[C2H6] */
+    J[1922] += dqdci;             /* dwdot[C2H4]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[9][6] - 1)*dcdc_fac;
+    J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[3527] -= dqdci;             /* dwdot[C2H3]/d[AR] */
+    J[3528] += dqdci;             /* dwdot[C2H4]/d[AR] */
     J[5257] -= dqdT; /* dwdot[H]/dT */
     J[5279] -= dqdT; /* dwdot[C2H3]/dT */
     J[5280] += dqdT; /* dwdot[C2H4]/dT */
@@ -38884,11 +39347,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[10][0] - 1)*sc[0] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[13] + (TB[10][3] - 1)*sc[14] + (TB[10][4] - 1)*sc[15] + (TB[10][5] - 1)*sc[26] + (TB[10][6] - 1)*sc[48];
+    alpha = (memcmp(TB[10], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[10][0] - 1)*sc[0] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[13] + (TB[10][3] - 1)*sc[14] + (TB[10][4] - 1)*sc[15] + (TB[10][5] - 1)*sc[26] + (TB[10][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[1]*sc[24];
-    k_f = prefactor_units[10] * fwd_A[10]
-                * exp(fwd_beta[10] * tc[0] - activation_units[10] * fwd_Ea[10] * invT);
+    k_f = k_f_s[10];
     dlnkfdT = fwd_beta[10] * invT + activation_units[10] * fwd_Ea[10] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[10] * exp(low_beta[10] * tc[0] - activation_units[10] * low_Ea[10] * invT);
@@ -38904,16 +39366,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[10] == 4 ? exp(-troe_Tss[10] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[10]) > 1.e-100 ? -Fcent1/troe_Tsss[10] : 0.)
+      + (fabs(troe_Ts[10]) > 1.e-100 ? -Fcent2/troe_Ts[10] : 0.)
+      + (troe_len[10] == 4 ? Fcent3*troe_Tss[10]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[10]) > 1.e-100 ? -Fcent1/troe_Tsss[10] : 0.)
-      + (fabs(troe_Ts[10]) > 1.e-100 ? -Fcent2/troe_Ts[10] : 0.)
-      + (troe_len[10] == 4 ? Fcent3*troe_Tss[10]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -38921,7 +39383,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[25];
-    Kc = refCinv * exp(g_RT[1] + g_RT[24] - g_RT[25]);
+    Kc = Kc_s[10];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[24]) + (h_RT[25]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38939,137 +39401,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[10][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[24] -= dqdci;               /* dwdot[C2H4]/d[H2] */
-        J[25] += dqdci;               /* dwdot[C2H5]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[24];
-        J[74] -= dqdci;               /* dwdot[H]/d[H] */
-        J[97] -= dqdci;               /* dwdot[C2H4]/d[H] */
-        J[98] += dqdci;               /* dwdot[C2H5]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[10][1] - 1)*dcdc_fac;
-        J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[389] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
-        J[390] += dqdci;              /* dwdot[C2H5]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[10][2] - 1)*dcdc_fac;
-        J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[973] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
-        J[974] += dqdci;              /* dwdot[C2H5]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[10][3] - 1)*dcdc_fac;
-        J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1046] -= dqdci;             /* dwdot[C2H4]/d[CO] */
-        J[1047] += dqdci;             /* dwdot[C2H5]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[10][4] - 1)*dcdc_fac;
-        J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1119] -= dqdci;             /* dwdot[C2H4]/d[CO2] */
-        J[1120] += dqdci;             /* dwdot[C2H5]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci =  + k_f*sc[1];
-        J[1753] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1776] -= dqdci;             /* dwdot[C2H4]/d[C2H4] */
-        J[1777] += dqdci;             /* dwdot[C2H5]/d[C2H4] */
-        /* d()/d[C2H5] */
-        dqdci =  - k_r;
-        J[1826] -= dqdci;             /* dwdot[H]/d[C2H5] */
-        J[1849] -= dqdci;             /* dwdot[C2H4]/d[C2H5] */
-        J[1850] += dqdci;             /* dwdot[C2H5]/d[C2H5] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[10][5] - 1)*dcdc_fac;
-        J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1922] -= dqdci;             /* dwdot[C2H4]/d[C2H6] */
-        J[1923] += dqdci;             /* dwdot[C2H5]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[10][6] - 1)*dcdc_fac;
-        J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[3528] -= dqdci;             /* dwdot[C2H4]/d[AR] */
-        J[3529] += dqdci;             /* dwdot[C2H5]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[10][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[24];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[10][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[10][2]*dcdc_fac;
-        dqdc[14] = TB[10][3]*dcdc_fac;
-        dqdc[15] = TB[10][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac + k_f*sc[1];
-        dqdc[25] = dcdc_fac - k_r;
-        dqdc[26] = TB[10][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[10][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+1] -= dqdc[k];
-            J[73*k+24] -= dqdc[k];
-            J[73*k+25] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[24] -= dcdc_fac;
+    Jmix[25] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[10][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[24] -= dqdci;               /* dwdot[C2H4]/d[H2] */
+    J[25] += dqdci;               /* dwdot[C2H5]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[24];
+    J[74] -= dqdci;               /* dwdot[H]/d[H] */
+    J[97] -= dqdci;               /* dwdot[C2H4]/d[H] */
+    J[98] += dqdci;               /* dwdot[C2H5]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[10][1] - 1)*dcdc_fac;
+    J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[389] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
+    J[390] += dqdci;              /* dwdot[C2H5]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[10][2] - 1)*dcdc_fac;
+    J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[973] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
+    J[974] += dqdci;              /* dwdot[C2H5]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[10][3] - 1)*dcdc_fac;
+    J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1046] -= dqdci;             /* dwdot[C2H4]/d[CO] */
+    J[1047] += dqdci;             /* dwdot[C2H5]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[10][4] - 1)*dcdc_fac;
+    J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1119] -= dqdci;             /* dwdot[C2H4]/d[CO2] */
+    J[1120] += dqdci;             /* dwdot[C2H5]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci =  + k_f*sc[1];
+    J[1753] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1776] -= dqdci;             /* dwdot[C2H4]/d[C2H4] */
+    J[1777] += dqdci;             /* dwdot[C2H5]/d[C2H4] */
+    /* d()/d[C2H5] */
+    dqdci =  - k_r;
+    J[1826] -= dqdci;             /* dwdot[H]/d[C2H5] */
+    J[1849] -= dqdci;             /* dwdot[C2H4]/d[C2H5] */
+    J[1850] += dqdci;             /* dwdot[C2H5]/d[C2H5] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[10][5] - 1)*dcdc_fac;
+    J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1922] -= dqdci;             /* dwdot[C2H4]/d[C2H6] */
+    J[1923] += dqdci;             /* dwdot[C2H5]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[10][6] - 1)*dcdc_fac;
+    J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[3528] -= dqdci;             /* dwdot[C2H4]/d[AR] */
+    J[3529] += dqdci;             /* dwdot[C2H5]/d[AR] */
     J[5257] -= dqdT; /* dwdot[H]/dT */
     J[5280] -= dqdT; /* dwdot[C2H4]/dT */
     J[5281] += dqdT; /* dwdot[C2H5]/dT */
@@ -39078,11 +39463,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[11][0] - 1)*sc[0] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[13] + (TB[11][3] - 1)*sc[14] + (TB[11][4] - 1)*sc[15] + (TB[11][5] - 1)*sc[26] + (TB[11][6] - 1)*sc[48];
+    alpha = (memcmp(TB[11], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[11][0] - 1)*sc[0] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[13] + (TB[11][3] - 1)*sc[14] + (TB[11][4] - 1)*sc[15] + (TB[11][5] - 1)*sc[26] + (TB[11][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[1]*sc[25];
-    k_f = prefactor_units[11] * fwd_A[11]
-                * exp(fwd_beta[11] * tc[0] - activation_units[11] * fwd_Ea[11] * invT);
+    k_f = k_f_s[11];
     dlnkfdT = fwd_beta[11] * invT + activation_units[11] * fwd_Ea[11] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[11] * exp(low_beta[11] * tc[0] - activation_units[11] * low_Ea[11] * invT);
@@ -39098,16 +39482,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[11] == 4 ? exp(-troe_Tss[11] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[11]) > 1.e-100 ? -Fcent1/troe_Tsss[11] : 0.)
+      + (fabs(troe_Ts[11]) > 1.e-100 ? -Fcent2/troe_Ts[11] : 0.)
+      + (troe_len[11] == 4 ? Fcent3*troe_Tss[11]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[11]) > 1.e-100 ? -Fcent1/troe_Tsss[11] : 0.)
-      + (fabs(troe_Ts[11]) > 1.e-100 ? -Fcent2/troe_Ts[11] : 0.)
-      + (troe_len[11] == 4 ? Fcent3*troe_Tss[11]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -39115,7 +39499,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[26];
-    Kc = refCinv * exp(g_RT[1] + g_RT[25] - g_RT[26]);
+    Kc = Kc_s[11];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[25]) + (h_RT[26]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39133,132 +39517,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[11][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[25] -= dqdci;               /* dwdot[C2H5]/d[H2] */
-        J[26] += dqdci;               /* dwdot[C2H6]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[25];
-        J[74] -= dqdci;               /* dwdot[H]/d[H] */
-        J[98] -= dqdci;               /* dwdot[C2H5]/d[H] */
-        J[99] += dqdci;               /* dwdot[C2H6]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[11][1] - 1)*dcdc_fac;
-        J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[390] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
-        J[391] += dqdci;              /* dwdot[C2H6]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[11][2] - 1)*dcdc_fac;
-        J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[974] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
-        J[975] += dqdci;              /* dwdot[C2H6]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[11][3] - 1)*dcdc_fac;
-        J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1047] -= dqdci;             /* dwdot[C2H5]/d[CO] */
-        J[1048] += dqdci;             /* dwdot[C2H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[11][4] - 1)*dcdc_fac;
-        J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1120] -= dqdci;             /* dwdot[C2H5]/d[CO2] */
-        J[1121] += dqdci;             /* dwdot[C2H6]/d[CO2] */
-        /* d()/d[C2H5] */
-        dqdci =  + k_f*sc[1];
-        J[1826] -= dqdci;             /* dwdot[H]/d[C2H5] */
-        J[1850] -= dqdci;             /* dwdot[C2H5]/d[C2H5] */
-        J[1851] += dqdci;             /* dwdot[C2H6]/d[C2H5] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[11][5] - 1)*dcdc_fac - k_r;
-        J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1923] -= dqdci;             /* dwdot[C2H5]/d[C2H6] */
-        J[1924] += dqdci;             /* dwdot[C2H6]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[11][6] - 1)*dcdc_fac;
-        J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[3529] -= dqdci;             /* dwdot[C2H5]/d[AR] */
-        J[3530] += dqdci;             /* dwdot[C2H6]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[11][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[25];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[11][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[11][2]*dcdc_fac;
-        dqdc[14] = TB[11][3]*dcdc_fac;
-        dqdc[15] = TB[11][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac + k_f*sc[1];
-        dqdc[26] = TB[11][5]*dcdc_fac - k_r;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[11][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+1] -= dqdc[k];
-            J[73*k+25] -= dqdc[k];
-            J[73*k+26] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[25] -= dcdc_fac;
+    Jmix[26] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[11][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[25] -= dqdci;               /* dwdot[C2H5]/d[H2] */
+    J[26] += dqdci;               /* dwdot[C2H6]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[25];
+    J[74] -= dqdci;               /* dwdot[H]/d[H] */
+    J[98] -= dqdci;               /* dwdot[C2H5]/d[H] */
+    J[99] += dqdci;               /* dwdot[C2H6]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[11][1] - 1)*dcdc_fac;
+    J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[390] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
+    J[391] += dqdci;              /* dwdot[C2H6]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[11][2] - 1)*dcdc_fac;
+    J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[974] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
+    J[975] += dqdci;              /* dwdot[C2H6]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[11][3] - 1)*dcdc_fac;
+    J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1047] -= dqdci;             /* dwdot[C2H5]/d[CO] */
+    J[1048] += dqdci;             /* dwdot[C2H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[11][4] - 1)*dcdc_fac;
+    J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1120] -= dqdci;             /* dwdot[C2H5]/d[CO2] */
+    J[1121] += dqdci;             /* dwdot[C2H6]/d[CO2] */
+    /* d()/d[C2H5] */
+    dqdci =  + k_f*sc[1];
+    J[1826] -= dqdci;             /* dwdot[H]/d[C2H5] */
+    J[1850] -= dqdci;             /* dwdot[C2H5]/d[C2H5] */
+    J[1851] += dqdci;             /* dwdot[C2H6]/d[C2H5] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[11][5] - 1)*dcdc_fac - k_r;
+    J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1923] -= dqdci;             /* dwdot[C2H5]/d[C2H6] */
+    J[1924] += dqdci;             /* dwdot[C2H6]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[11][6] - 1)*dcdc_fac;
+    J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[3529] -= dqdci;             /* dwdot[C2H5]/d[AR] */
+    J[3530] += dqdci;             /* dwdot[C2H6]/d[AR] */
     J[5257] -= dqdT; /* dwdot[H]/dT */
     J[5281] -= dqdT; /* dwdot[C2H5]/dT */
     J[5282] += dqdT; /* dwdot[C2H6]/dT */
@@ -39267,11 +39574,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[12][0] - 1)*sc[0] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[13] + (TB[12][3] - 1)*sc[14] + (TB[12][4] - 1)*sc[15] + (TB[12][5] - 1)*sc[26] + (TB[12][6] - 1)*sc[48];
+    alpha = (memcmp(TB[12], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[12][0] - 1)*sc[0] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[13] + (TB[12][3] - 1)*sc[14] + (TB[12][4] - 1)*sc[15] + (TB[12][5] - 1)*sc[26] + (TB[12][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[0]*sc[14];
-    k_f = prefactor_units[12] * fwd_A[12]
-                * exp(fwd_beta[12] * tc[0] - activation_units[12] * fwd_Ea[12] * invT);
+    k_f = k_f_s[12];
     dlnkfdT = fwd_beta[12] * invT + activation_units[12] * fwd_Ea[12] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[12] * exp(low_beta[12] * tc[0] - activation_units[12] * low_Ea[12] * invT);
@@ -39287,16 +39593,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[12] == 4 ? exp(-troe_Tss[12] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[12]) > 1.e-100 ? -Fcent1/troe_Tsss[12] : 0.)
+      + (fabs(troe_Ts[12]) > 1.e-100 ? -Fcent2/troe_Ts[12] : 0.)
+      + (troe_len[12] == 4 ? Fcent3*troe_Tss[12]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[12]) > 1.e-100 ? -Fcent1/troe_Tsss[12] : 0.)
-      + (fabs(troe_Ts[12]) > 1.e-100 ? -Fcent2/troe_Ts[12] : 0.)
-      + (troe_len[12] == 4 ? Fcent3*troe_Tss[12]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -39304,7 +39610,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[17];
-    Kc = refCinv * exp(g_RT[0] + g_RT[14] - g_RT[17]);
+    Kc = Kc_s[12];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[14]) + (h_RT[17]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39322,127 +39628,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[12][0] - 1)*dcdc_fac + k_f*sc[14];
-        J[0] -= dqdci;                /* dwdot[H2]/d[H2] */
-        J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
-        J[17] += dqdci;               /* dwdot[CH2O]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[12][1] - 1)*dcdc_fac;
-        J[365] -= dqdci;              /* dwdot[H2]/d[H2O] */
-        J[379] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[382] += dqdci;              /* dwdot[CH2O]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[12][2] - 1)*dcdc_fac;
-        J[949] -= dqdci;              /* dwdot[H2]/d[CH4] */
-        J[963] -= dqdci;              /* dwdot[CO]/d[CH4] */
-        J[966] += dqdci;              /* dwdot[CH2O]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[12][3] - 1)*dcdc_fac + k_f*sc[0];
-        J[1022] -= dqdci;             /* dwdot[H2]/d[CO] */
-        J[1036] -= dqdci;             /* dwdot[CO]/d[CO] */
-        J[1039] += dqdci;             /* dwdot[CH2O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[12][4] - 1)*dcdc_fac;
-        J[1095] -= dqdci;             /* dwdot[H2]/d[CO2] */
-        J[1109] -= dqdci;             /* dwdot[CO]/d[CO2] */
-        J[1112] += dqdci;             /* dwdot[CH2O]/d[CO2] */
-        /* d()/d[CH2O] */
-        dqdci =  - k_r;
-        J[1241] -= dqdci;             /* dwdot[H2]/d[CH2O] */
-        J[1255] -= dqdci;             /* dwdot[CO]/d[CH2O] */
-        J[1258] += dqdci;             /* dwdot[CH2O]/d[CH2O] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[12][5] - 1)*dcdc_fac;
-        J[1898] -= dqdci;             /* dwdot[H2]/d[C2H6] */
-        J[1912] -= dqdci;             /* dwdot[CO]/d[C2H6] */
-        J[1915] += dqdci;             /* dwdot[CH2O]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[12][6] - 1)*dcdc_fac;
-        J[3504] -= dqdci;             /* dwdot[H2]/d[AR] */
-        J[3518] -= dqdci;             /* dwdot[CO]/d[AR] */
-        J[3521] += dqdci;             /* dwdot[CH2O]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[12][0]*dcdc_fac + k_f*sc[14];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[12][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[12][2]*dcdc_fac;
-        dqdc[14] = TB[12][3]*dcdc_fac + k_f*sc[0];
-        dqdc[15] = TB[12][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac - k_r;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[12][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[12][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+0] -= dqdc[k];
-            J[73*k+14] -= dqdc[k];
-            J[73*k+17] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[14] -= dcdc_fac;
+    Jmix[17] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[12][0] - 1)*dcdc_fac + k_f*sc[14];
+    J[0] -= dqdci;                /* dwdot[H2]/d[H2] */
+    J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
+    J[17] += dqdci;               /* dwdot[CH2O]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[12][1] - 1)*dcdc_fac;
+    J[365] -= dqdci;              /* dwdot[H2]/d[H2O] */
+    J[379] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[382] += dqdci;              /* dwdot[CH2O]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[12][2] - 1)*dcdc_fac;
+    J[949] -= dqdci;              /* dwdot[H2]/d[CH4] */
+    J[963] -= dqdci;              /* dwdot[CO]/d[CH4] */
+    J[966] += dqdci;              /* dwdot[CH2O]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[12][3] - 1)*dcdc_fac + k_f*sc[0];
+    J[1022] -= dqdci;             /* dwdot[H2]/d[CO] */
+    J[1036] -= dqdci;             /* dwdot[CO]/d[CO] */
+    J[1039] += dqdci;             /* dwdot[CH2O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[12][4] - 1)*dcdc_fac;
+    J[1095] -= dqdci;             /* dwdot[H2]/d[CO2] */
+    J[1109] -= dqdci;             /* dwdot[CO]/d[CO2] */
+    J[1112] += dqdci;             /* dwdot[CH2O]/d[CO2] */
+    /* d()/d[CH2O] */
+    dqdci =  - k_r;
+    J[1241] -= dqdci;             /* dwdot[H2]/d[CH2O] */
+    J[1255] -= dqdci;             /* dwdot[CO]/d[CH2O] */
+    J[1258] += dqdci;             /* dwdot[CH2O]/d[CH2O] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[12][5] - 1)*dcdc_fac;
+    J[1898] -= dqdci;             /* dwdot[H2]/d[C2H6] */
+    J[1912] -= dqdci;             /* dwdot[CO]/d[C2H6] */
+    J[1915] += dqdci;             /* dwdot[CH2O]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[12][6] - 1)*dcdc_fac;
+    J[3504] -= dqdci;             /* dwdot[H2]/d[AR] */
+    J[3518] -= dqdci;             /* dwdot[CO]/d[AR] */
+    J[3521] += dqdci;             /* dwdot[CH2O]/d[AR] */
     J[5256] -= dqdT; /* dwdot[H2]/dT */
     J[5270] -= dqdT; /* dwdot[CO]/dT */
     J[5273] += dqdT; /* dwdot[CH2O]/dT */
@@ -39451,11 +39680,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[13][0] - 1)*sc[0] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[13] + (TB[13][3] - 1)*sc[14] + (TB[13][4] - 1)*sc[15] + (TB[13][5] - 1)*sc[26] + (TB[13][6] - 1)*sc[48];
+    alpha = (memcmp(TB[13], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[13][0] - 1)*sc[0] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[13] + (TB[13][3] - 1)*sc[14] + (TB[13][4] - 1)*sc[15] + (TB[13][5] - 1)*sc[26] + (TB[13][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[4]*sc[4];
-    k_f = prefactor_units[13] * fwd_A[13]
-                * exp(fwd_beta[13] * tc[0] - activation_units[13] * fwd_Ea[13] * invT);
+    k_f = k_f_s[13];
     dlnkfdT = fwd_beta[13] * invT + activation_units[13] * fwd_Ea[13] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[13] * exp(low_beta[13] * tc[0] - activation_units[13] * low_Ea[13] * invT);
@@ -39471,16 +39699,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[13] == 4 ? exp(-troe_Tss[13] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[13]) > 1.e-100 ? -Fcent1/troe_Tsss[13] : 0.)
+      + (fabs(troe_Ts[13]) > 1.e-100 ? -Fcent2/troe_Ts[13] : 0.)
+      + (troe_len[13] == 4 ? Fcent3*troe_Tss[13]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[13]) > 1.e-100 ? -Fcent1/troe_Tsss[13] : 0.)
-      + (fabs(troe_Ts[13]) > 1.e-100 ? -Fcent2/troe_Ts[13] : 0.)
-      + (troe_len[13] == 4 ? Fcent3*troe_Tss[13]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -39488,7 +39716,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[7];
-    Kc = refCinv * exp(2*g_RT[4] - g_RT[7]);
+    Kc = Kc_s[13];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[4]) + (h_RT[7]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39505,122 +39733,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[13][0] - 1)*dcdc_fac;
-        J[4] += -2 * dqdci;           /* dwdot[OH]/d[H2] */
-        J[7] += dqdci;                /* dwdot[H2O2]/d[H2] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*2*sc[4];
-        J[296] += -2 * dqdci;         /* dwdot[OH]/d[OH] */
-        J[299] += dqdci;              /* dwdot[H2O2]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[13][1] - 1)*dcdc_fac;
-        J[369] += -2 * dqdci;         /* dwdot[OH]/d[H2O] */
-        J[372] += dqdci;              /* dwdot[H2O2]/d[H2O] */
-        /* d()/d[H2O2] */
-        dqdci =  - k_r;
-        J[515] += -2 * dqdci;         /* dwdot[OH]/d[H2O2] */
-        J[518] += dqdci;              /* dwdot[H2O2]/d[H2O2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[13][2] - 1)*dcdc_fac;
-        J[953] += -2 * dqdci;         /* dwdot[OH]/d[CH4] */
-        J[956] += dqdci;              /* dwdot[H2O2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[13][3] - 1)*dcdc_fac;
-        J[1026] += -2 * dqdci;        /* dwdot[OH]/d[CO] */
-        J[1029] += dqdci;             /* dwdot[H2O2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[13][4] - 1)*dcdc_fac;
-        J[1099] += -2 * dqdci;        /* dwdot[OH]/d[CO2] */
-        J[1102] += dqdci;             /* dwdot[H2O2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[13][5] - 1)*dcdc_fac;
-        J[1902] += -2 * dqdci;        /* dwdot[OH]/d[C2H6] */
-        J[1905] += dqdci;             /* dwdot[H2O2]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[13][6] - 1)*dcdc_fac;
-        J[3508] += -2 * dqdci;        /* dwdot[OH]/d[AR] */
-        J[3511] += dqdci;             /* dwdot[H2O2]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[13][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac + k_f*2*sc[4];
-        dqdc[5] = TB[13][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac - k_r;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[13][2]*dcdc_fac;
-        dqdc[14] = TB[13][3]*dcdc_fac;
-        dqdc[15] = TB[13][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[13][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[13][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+4] += -2 * dqdc[k];
-            J[73*k+7] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[4] += -2 * dcdc_fac;
+    Jmix[7] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[13][0] - 1)*dcdc_fac;
+    J[4] += -2 * dqdci;           /* dwdot[OH]/d[H2] */
+    J[7] += dqdci;                /* dwdot[H2O2]/d[H2] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*2*sc[4];
+    J[296] += -2 * dqdci;         /* dwdot[OH]/d[OH] */
+    J[299] += dqdci;              /* dwdot[H2O2]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[13][1] - 1)*dcdc_fac;
+    J[369] += -2 * dqdci;         /* dwdot[OH]/d[H2O] */
+    J[372] += dqdci;              /* dwdot[H2O2]/d[H2O] */
+    /* d()/d[H2O2] */
+    dqdci =  - k_r;
+    J[515] += -2 * dqdci;         /* dwdot[OH]/d[H2O2] */
+    J[518] += dqdci;              /* dwdot[H2O2]/d[H2O2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[13][2] - 1)*dcdc_fac;
+    J[953] += -2 * dqdci;         /* dwdot[OH]/d[CH4] */
+    J[956] += dqdci;              /* dwdot[H2O2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[13][3] - 1)*dcdc_fac;
+    J[1026] += -2 * dqdci;        /* dwdot[OH]/d[CO] */
+    J[1029] += dqdci;             /* dwdot[H2O2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[13][4] - 1)*dcdc_fac;
+    J[1099] += -2 * dqdci;        /* dwdot[OH]/d[CO2] */
+    J[1102] += dqdci;             /* dwdot[H2O2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[13][5] - 1)*dcdc_fac;
+    J[1902] += -2 * dqdci;        /* dwdot[OH]/d[C2H6] */
+    J[1905] += dqdci;             /* dwdot[H2O2]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[13][6] - 1)*dcdc_fac;
+    J[3508] += -2 * dqdci;        /* dwdot[OH]/d[AR] */
+    J[3511] += dqdci;             /* dwdot[H2O2]/d[AR] */
     J[5260] += -2 * dqdT; /* dwdot[OH]/dT */
     J[5263] += dqdT; /* dwdot[H2O2]/dT */
 
@@ -39628,11 +39779,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[14][0] - 1)*sc[0] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[13] + (TB[14][3] - 1)*sc[14] + (TB[14][4] - 1)*sc[15] + (TB[14][5] - 1)*sc[26];
+    alpha = (memcmp(TB[14], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[14][0] - 1)*sc[0] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[13] + (TB[14][3] - 1)*sc[14] + (TB[14][4] - 1)*sc[15] + (TB[14][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[4]*sc[12];
-    k_f = prefactor_units[14] * fwd_A[14]
-                * exp(fwd_beta[14] * tc[0] - activation_units[14] * fwd_Ea[14] * invT);
+    k_f = k_f_s[14];
     dlnkfdT = fwd_beta[14] * invT + activation_units[14] * fwd_Ea[14] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[14] * exp(low_beta[14] * tc[0] - activation_units[14] * low_Ea[14] * invT);
@@ -39648,16 +39798,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[14] == 4 ? exp(-troe_Tss[14] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[14]) > 1.e-100 ? -Fcent1/troe_Tsss[14] : 0.)
+      + (fabs(troe_Ts[14]) > 1.e-100 ? -Fcent2/troe_Ts[14] : 0.)
+      + (troe_len[14] == 4 ? Fcent3*troe_Tss[14]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[14]) > 1.e-100 ? -Fcent1/troe_Tsss[14] : 0.)
-      + (fabs(troe_Ts[14]) > 1.e-100 ? -Fcent2/troe_Ts[14] : 0.)
-      + (troe_len[14] == 4 ? Fcent3*troe_Tss[14]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -39665,7 +39815,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[20];
-    Kc = refCinv * exp(g_RT[4] + g_RT[12] - g_RT[20]);
+    Kc = Kc_s[14];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[12]) + (h_RT[20]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39683,132 +39833,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[14][0] - 1)*dcdc_fac;
-        J[4] -= dqdci;                /* dwdot[OH]/d[H2] */
-        J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
-        J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*sc[12];
-        J[296] -= dqdci;              /* dwdot[OH]/d[OH] */
-        J[304] -= dqdci;              /* dwdot[CH3]/d[OH] */
-        J[312] += dqdci;              /* dwdot[CH3OH]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[14][1] - 1)*dcdc_fac;
-        J[369] -= dqdci;              /* dwdot[OH]/d[H2O] */
-        J[377] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[385] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[4];
-        J[880] -= dqdci;              /* dwdot[OH]/d[CH3] */
-        J[888] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[896] += dqdci;              /* dwdot[CH3OH]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[14][2] - 1)*dcdc_fac;
-        J[953] -= dqdci;              /* dwdot[OH]/d[CH4] */
-        J[961] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[969] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[14][3] - 1)*dcdc_fac;
-        J[1026] -= dqdci;             /* dwdot[OH]/d[CO] */
-        J[1034] -= dqdci;             /* dwdot[CH3]/d[CO] */
-        J[1042] += dqdci;             /* dwdot[CH3OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[14][4] - 1)*dcdc_fac;
-        J[1099] -= dqdci;             /* dwdot[OH]/d[CO2] */
-        J[1107] -= dqdci;             /* dwdot[CH3]/d[CO2] */
-        J[1115] += dqdci;             /* dwdot[CH3OH]/d[CO2] */
-        /* d()/d[CH3OH] */
-        dqdci =  - k_r;
-        J[1464] -= dqdci;             /* dwdot[OH]/d[CH3OH] */
-        J[1472] -= dqdci;             /* dwdot[CH3]/d[CH3OH] */
-        J[1480] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[14][5] - 1)*dcdc_fac;
-        J[1902] -= dqdci;             /* dwdot[OH]/d[C2H6] */
-        J[1910] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
-        J[1918] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[14][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac + k_f*sc[12];
-        dqdc[5] = TB[14][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*sc[4];
-        dqdc[13] = TB[14][2]*dcdc_fac;
-        dqdc[14] = TB[14][3]*dcdc_fac;
-        dqdc[15] = TB[14][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac - k_r;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[14][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+4] -= dqdc[k];
-            J[73*k+12] -= dqdc[k];
-            J[73*k+20] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[4] -= dcdc_fac;
+    Jmix[12] -= dcdc_fac;
+    Jmix[20] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[14][0] - 1)*dcdc_fac;
+    J[4] -= dqdci;                /* dwdot[OH]/d[H2] */
+    J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
+    J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*sc[12];
+    J[296] -= dqdci;              /* dwdot[OH]/d[OH] */
+    J[304] -= dqdci;              /* dwdot[CH3]/d[OH] */
+    J[312] += dqdci;              /* dwdot[CH3OH]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[14][1] - 1)*dcdc_fac;
+    J[369] -= dqdci;              /* dwdot[OH]/d[H2O] */
+    J[377] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[385] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[4];
+    J[880] -= dqdci;              /* dwdot[OH]/d[CH3] */
+    J[888] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[896] += dqdci;              /* dwdot[CH3OH]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[14][2] - 1)*dcdc_fac;
+    J[953] -= dqdci;              /* dwdot[OH]/d[CH4] */
+    J[961] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[969] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[14][3] - 1)*dcdc_fac;
+    J[1026] -= dqdci;             /* dwdot[OH]/d[CO] */
+    J[1034] -= dqdci;             /* dwdot[CH3]/d[CO] */
+    J[1042] += dqdci;             /* dwdot[CH3OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[14][4] - 1)*dcdc_fac;
+    J[1099] -= dqdci;             /* dwdot[OH]/d[CO2] */
+    J[1107] -= dqdci;             /* dwdot[CH3]/d[CO2] */
+    J[1115] += dqdci;             /* dwdot[CH3OH]/d[CO2] */
+    /* d()/d[CH3OH] */
+    dqdci =  - k_r;
+    J[1464] -= dqdci;             /* dwdot[OH]/d[CH3OH] */
+    J[1472] -= dqdci;             /* dwdot[CH3]/d[CH3OH] */
+    J[1480] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[14][5] - 1)*dcdc_fac;
+    J[1902] -= dqdci;             /* dwdot[OH]/d[C2H6] */
+    J[1910] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
+    J[1918] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
     J[5260] -= dqdT; /* dwdot[OH]/dT */
     J[5268] -= dqdT; /* dwdot[CH3]/dT */
     J[5276] += dqdT; /* dwdot[CH3OH]/dT */
@@ -39817,11 +39890,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[15][0] - 1)*sc[0] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[13] + (TB[15][3] - 1)*sc[14] + (TB[15][4] - 1)*sc[15] + (TB[15][5] - 1)*sc[26] + (TB[15][6] - 1)*sc[48];
+    alpha = (memcmp(TB[15], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[15][0] - 1)*sc[0] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[13] + (TB[15][3] - 1)*sc[14] + (TB[15][4] - 1)*sc[15] + (TB[15][5] - 1)*sc[26] + (TB[15][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[9]*sc[14];
-    k_f = prefactor_units[15] * fwd_A[15]
-                * exp(fwd_beta[15] * tc[0] - activation_units[15] * fwd_Ea[15] * invT);
+    k_f = k_f_s[15];
     dlnkfdT = fwd_beta[15] * invT + activation_units[15] * fwd_Ea[15] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[15] * exp(low_beta[15] * tc[0] - activation_units[15] * low_Ea[15] * invT);
@@ -39837,16 +39909,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[15] == 4 ? exp(-troe_Tss[15] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[15]) > 1.e-100 ? -Fcent1/troe_Tsss[15] : 0.)
+      + (fabs(troe_Ts[15]) > 1.e-100 ? -Fcent2/troe_Ts[15] : 0.)
+      + (troe_len[15] == 4 ? Fcent3*troe_Tss[15]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[15]) > 1.e-100 ? -Fcent1/troe_Tsss[15] : 0.)
-      + (fabs(troe_Ts[15]) > 1.e-100 ? -Fcent2/troe_Ts[15] : 0.)
-      + (troe_len[15] == 4 ? Fcent3*troe_Tss[15]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -39854,7 +39926,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[27];
-    Kc = refCinv * exp(g_RT[9] + g_RT[14] - g_RT[27]);
+    Kc = Kc_s[15];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[14]) + (h_RT[27]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39872,145 +39944,67 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[15][0] - 1)*dcdc_fac;
-        J[9] -= dqdci;                /* dwdot[CH]/d[H2] */
-        J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
-        J[27] += dqdci;               /* dwdot[HCCO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[15][1] - 1)*dcdc_fac;
-        J[374] -= dqdci;              /* dwdot[CH]/d[H2O] */
-        J[379] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[392] += dqdci;              /* dwdot[HCCO]/d[H2O] */
-        /* d()/d[CH] */
-        dqdci =  + k_f*sc[14];
-        J[666] -= dqdci;              /* dwdot[CH]/d[CH] */
-        J[671] -= dqdci;              /* dwdot[CO]/d[CH] */
-        J[684] += dqdci;              /* dwdot[HCCO]/d[CH] */
-        /* d()/d[CH4] */
-        dqdci = (TB[15][2] - 1)*dcdc_fac;
-        J[958] -= dqdci;              /* dwdot[CH]/d[CH4] */
-        J[963] -= dqdci;              /* dwdot[CO]/d[CH4] */
-        J[976] += dqdci;              /* dwdot[HCCO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[15][3] - 1)*dcdc_fac + k_f*sc[9];
-        J[1031] -= dqdci;             /* dwdot[CH]/d[CO] */
-        J[1036] -= dqdci;             /* dwdot[CO]/d[CO] */
-        J[1049] += dqdci;             /* dwdot[HCCO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[15][4] - 1)*dcdc_fac;
-        J[1104] -= dqdci;             /* dwdot[CH]/d[CO2] */
-        J[1109] -= dqdci;             /* dwdot[CO]/d[CO2] */
-        J[1122] += dqdci;             /* dwdot[HCCO]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[15][5] - 1)*dcdc_fac;
-        J[1907] -= dqdci;             /* dwdot[CH]/d[C2H6] */
-        J[1912] -= dqdci;             /* dwdot[CO]/d[C2H6] */
-        J[1925] += dqdci;             /* dwdot[HCCO]/d[C2H6] */
-        /* d()/d[HCCO] */
-        dqdci =  - k_r;
-        J[1980] -= dqdci;             /* dwdot[CH]/d[HCCO] */
-        J[1985] -= dqdci;             /* dwdot[CO]/d[HCCO] */
-        J[1998] += dqdci;             /* dwdot[HCCO]/d[HCCO] */
-        /* d()/d[AR] */
-        dqdci = (TB[15][6] - 1)*dcdc_fac;
-        J[3513] -= dqdci;             /* dwdot[CH]/d[AR] */
-        J[3518] -= dqdci;             /* dwdot[CO]/d[AR] */
-        J[3531] += dqdci;             /* dwdot[HCCO]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[15][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[15][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac + k_f*sc[14];
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[15][2]*dcdc_fac;
-        dqdc[14] = TB[15][3]*dcdc_fac + k_f*sc[9];
-        dqdc[15] = TB[15][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[15][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac - k_r;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[15][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+9] -= dqdc[k];
-            J[73*k+14] -= dqdc[k];
-            J[73*k+27] += dqdc[k];
-        }
-    }
-    J[5265] -= dqdT; /* dwdot[CH]/dT */
-    J[5270] -= dqdT; /* dwdot[CO]/dT */
-    J[5283] += dqdT; /* dwdot[HCCO]/dT */
-
-    /*reaction 17: CH2 + CO (+M) <=> CH2CO (+M) */
-    /*a pressure-fall-off reaction */
-    /* also 3-body */
-    /* 3-body correction factor */
-    alpha = mixture + (TB[16][0] - 1)*sc[0] + (TB[16][1] - 1)*sc[5] + (TB[16][2] - 1)*sc[13] + (TB[16][3] - 1)*sc[14] + (TB[16][4] - 1)*sc[15] + (TB[16][5] - 1)*sc[26] + (TB[16][6] - 1)*sc[48];
-    /* forward */
-    phi_f = sc[10]*sc[14];
-    k_f = prefactor_units[16] * fwd_A[16]
-                * exp(fwd_beta[16] * tc[0] - activation_units[16] * fwd_Ea[16] * invT);
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[9] -= dcdc_fac;
+    Jmix[14] -= dcdc_fac;
+    Jmix[27] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[15][0] - 1)*dcdc_fac;
+    J[9] -= dqdci;                /* dwdot[CH]/d[H2] */
+    J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
+    J[27] += dqdci;               /* dwdot[HCCO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[15][1] - 1)*dcdc_fac;
+    J[374] -= dqdci;              /* dwdot[CH]/d[H2O] */
+    J[379] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[392] += dqdci;              /* dwdot[HCCO]/d[H2O] */
+    /* d()/d[CH] */
+    dqdci =  + k_f*sc[14];
+    J[666] -= dqdci;              /* dwdot[CH]/d[CH] */
+    J[671] -= dqdci;              /* dwdot[CO]/d[CH] */
+    J[684] += dqdci;              /* dwdot[HCCO]/d[CH] */
+    /* d()/d[CH4] */
+    dqdci = (TB[15][2] - 1)*dcdc_fac;
+    J[958] -= dqdci;              /* dwdot[CH]/d[CH4] */
+    J[963] -= dqdci;              /* dwdot[CO]/d[CH4] */
+    J[976] += dqdci;              /* dwdot[HCCO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[15][3] - 1)*dcdc_fac + k_f*sc[9];
+    J[1031] -= dqdci;             /* dwdot[CH]/d[CO] */
+    J[1036] -= dqdci;             /* dwdot[CO]/d[CO] */
+    J[1049] += dqdci;             /* dwdot[HCCO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[15][4] - 1)*dcdc_fac;
+    J[1104] -= dqdci;             /* dwdot[CH]/d[CO2] */
+    J[1109] -= dqdci;             /* dwdot[CO]/d[CO2] */
+    J[1122] += dqdci;             /* dwdot[HCCO]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[15][5] - 1)*dcdc_fac;
+    J[1907] -= dqdci;             /* dwdot[CH]/d[C2H6] */
+    J[1912] -= dqdci;             /* dwdot[CO]/d[C2H6] */
+    J[1925] += dqdci;             /* dwdot[HCCO]/d[C2H6] */
+    /* d()/d[HCCO] */
+    dqdci =  - k_r;
+    J[1980] -= dqdci;             /* dwdot[CH]/d[HCCO] */
+    J[1985] -= dqdci;             /* dwdot[CO]/d[HCCO] */
+    J[1998] += dqdci;             /* dwdot[HCCO]/d[HCCO] */
+    /* d()/d[AR] */
+    dqdci = (TB[15][6] - 1)*dcdc_fac;
+    J[3513] -= dqdci;             /* dwdot[CH]/d[AR] */
+    J[3518] -= dqdci;             /* dwdot[CO]/d[AR] */
+    J[3531] += dqdci;             /* dwdot[HCCO]/d[AR] */
+    J[5265] -= dqdT; /* dwdot[CH]/dT */
+    J[5270] -= dqdT; /* dwdot[CO]/dT */
+    J[5283] += dqdT; /* dwdot[HCCO]/dT */
+
+    /*reaction 17: CH2 + CO (+M) <=> CH2CO (+M) */
+    /*a pressure-fall-off reaction */
+    /* also 3-body */
+    /* 3-body correction factor */
+    alpha = (memcmp(TB[16], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[16][0] - 1)*sc[0] + (TB[16][1] - 1)*sc[5] + (TB[16][2] - 1)*sc[13] + (TB[16][3] - 1)*sc[14] + (TB[16][4] - 1)*sc[15] + (TB[16][5] - 1)*sc[26] + (TB[16][6] - 1)*sc[48]);
+    /* forward */
+    phi_f = sc[10]*sc[14];
+    k_f = k_f_s[16];
     dlnkfdT = fwd_beta[16] * invT + activation_units[16] * fwd_Ea[16] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[16] * exp(low_beta[16] * tc[0] - activation_units[16] * low_Ea[16] * invT);
@@ -40026,16 +40020,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[16] == 4 ? exp(-troe_Tss[16] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[16]) > 1.e-100 ? -Fcent1/troe_Tsss[16] : 0.)
+      + (fabs(troe_Ts[16]) > 1.e-100 ? -Fcent2/troe_Ts[16] : 0.)
+      + (troe_len[16] == 4 ? Fcent3*troe_Tss[16]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[16]) > 1.e-100 ? -Fcent1/troe_Tsss[16] : 0.)
-      + (fabs(troe_Ts[16]) > 1.e-100 ? -Fcent2/troe_Ts[16] : 0.)
-      + (troe_len[16] == 4 ? Fcent3*troe_Tss[16]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -40043,7 +40037,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[28];
-    Kc = refCinv * exp(g_RT[10] + g_RT[14] - g_RT[28]);
+    Kc = Kc_s[16];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[14]) + (h_RT[28]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40061,132 +40055,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[16][0] - 1)*dcdc_fac;
-        J[10] -= dqdci;               /* dwdot[CH2]/d[H2] */
-        J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
-        J[28] += dqdci;               /* dwdot[CH2CO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[16][1] - 1)*dcdc_fac;
-        J[375] -= dqdci;              /* dwdot[CH2]/d[H2O] */
-        J[379] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[393] += dqdci;              /* dwdot[CH2CO]/d[H2O] */
-        /* d()/d[CH2] */
-        dqdci =  + k_f*sc[14];
-        J[740] -= dqdci;              /* dwdot[CH2]/d[CH2] */
-        J[744] -= dqdci;              /* dwdot[CO]/d[CH2] */
-        J[758] += dqdci;              /* dwdot[CH2CO]/d[CH2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[16][2] - 1)*dcdc_fac;
-        J[959] -= dqdci;              /* dwdot[CH2]/d[CH4] */
-        J[963] -= dqdci;              /* dwdot[CO]/d[CH4] */
-        J[977] += dqdci;              /* dwdot[CH2CO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[16][3] - 1)*dcdc_fac + k_f*sc[10];
-        J[1032] -= dqdci;             /* dwdot[CH2]/d[CO] */
-        J[1036] -= dqdci;             /* dwdot[CO]/d[CO] */
-        J[1050] += dqdci;             /* dwdot[CH2CO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[16][4] - 1)*dcdc_fac;
-        J[1105] -= dqdci;             /* dwdot[CH2]/d[CO2] */
-        J[1109] -= dqdci;             /* dwdot[CO]/d[CO2] */
-        J[1123] += dqdci;             /* dwdot[CH2CO]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[16][5] - 1)*dcdc_fac;
-        J[1908] -= dqdci;             /* dwdot[CH2]/d[C2H6] */
-        J[1912] -= dqdci;             /* dwdot[CO]/d[C2H6] */
-        J[1926] += dqdci;             /* dwdot[CH2CO]/d[C2H6] */
-        /* d()/d[CH2CO] */
-        dqdci =  - k_r;
-        J[2054] -= dqdci;             /* dwdot[CH2]/d[CH2CO] */
-        J[2058] -= dqdci;             /* dwdot[CO]/d[CH2CO] */
-        J[2072] += dqdci;             /* dwdot[CH2CO]/d[CH2CO] */
-        /* d()/d[AR] */
-        dqdci = (TB[16][6] - 1)*dcdc_fac;
-        J[3514] -= dqdci;             /* dwdot[CH2]/d[AR] */
-        J[3518] -= dqdci;             /* dwdot[CO]/d[AR] */
-        J[3532] += dqdci;             /* dwdot[CH2CO]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[16][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[16][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac + k_f*sc[14];
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[16][2]*dcdc_fac;
-        dqdc[14] = TB[16][3]*dcdc_fac + k_f*sc[10];
-        dqdc[15] = TB[16][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[16][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac - k_r;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[16][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+10] -= dqdc[k];
-            J[73*k+14] -= dqdc[k];
-            J[73*k+28] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[10] -= dcdc_fac;
+    Jmix[14] -= dcdc_fac;
+    Jmix[28] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[16][0] - 1)*dcdc_fac;
+    J[10] -= dqdci;               /* dwdot[CH2]/d[H2] */
+    J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
+    J[28] += dqdci;               /* dwdot[CH2CO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[16][1] - 1)*dcdc_fac;
+    J[375] -= dqdci;              /* dwdot[CH2]/d[H2O] */
+    J[379] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[393] += dqdci;              /* dwdot[CH2CO]/d[H2O] */
+    /* d()/d[CH2] */
+    dqdci =  + k_f*sc[14];
+    J[740] -= dqdci;              /* dwdot[CH2]/d[CH2] */
+    J[744] -= dqdci;              /* dwdot[CO]/d[CH2] */
+    J[758] += dqdci;              /* dwdot[CH2CO]/d[CH2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[16][2] - 1)*dcdc_fac;
+    J[959] -= dqdci;              /* dwdot[CH2]/d[CH4] */
+    J[963] -= dqdci;              /* dwdot[CO]/d[CH4] */
+    J[977] += dqdci;              /* dwdot[CH2CO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[16][3] - 1)*dcdc_fac + k_f*sc[10];
+    J[1032] -= dqdci;             /* dwdot[CH2]/d[CO] */
+    J[1036] -= dqdci;             /* dwdot[CO]/d[CO] */
+    J[1050] += dqdci;             /* dwdot[CH2CO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[16][4] - 1)*dcdc_fac;
+    J[1105] -= dqdci;             /* dwdot[CH2]/d[CO2] */
+    J[1109] -= dqdci;             /* dwdot[CO]/d[CO2] */
+    J[1123] += dqdci;             /* dwdot[CH2CO]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[16][5] - 1)*dcdc_fac;
+    J[1908] -= dqdci;             /* dwdot[CH2]/d[C2H6] */
+    J[1912] -= dqdci;             /* dwdot[CO]/d[C2H6] */
+    J[1926] += dqdci;             /* dwdot[CH2CO]/d[C2H6] */
+    /* d()/d[CH2CO] */
+    dqdci =  - k_r;
+    J[2054] -= dqdci;             /* dwdot[CH2]/d[CH2CO] */
+    J[2058] -= dqdci;             /* dwdot[CO]/d[CH2CO] */
+    J[2072] += dqdci;             /* dwdot[CH2CO]/d[CH2CO] */
+    /* d()/d[AR] */
+    dqdci = (TB[16][6] - 1)*dcdc_fac;
+    J[3514] -= dqdci;             /* dwdot[CH2]/d[AR] */
+    J[3518] -= dqdci;             /* dwdot[CO]/d[AR] */
+    J[3532] += dqdci;             /* dwdot[CH2CO]/d[AR] */
     J[5266] -= dqdT; /* dwdot[CH2]/dT */
     J[5270] -= dqdT; /* dwdot[CO]/dT */
     J[5284] += dqdT; /* dwdot[CH2CO]/dT */
@@ -40195,11 +40112,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[17][0] - 1)*sc[0] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[13] + (TB[17][3] - 1)*sc[14] + (TB[17][4] - 1)*sc[15] + (TB[17][5] - 1)*sc[26];
+    alpha = (memcmp(TB[17], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[17][0] - 1)*sc[0] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[13] + (TB[17][3] - 1)*sc[14] + (TB[17][4] - 1)*sc[15] + (TB[17][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[5]*sc[11];
-    k_f = prefactor_units[17] * fwd_A[17]
-                * exp(fwd_beta[17] * tc[0] - activation_units[17] * fwd_Ea[17] * invT);
+    k_f = k_f_s[17];
     dlnkfdT = fwd_beta[17] * invT + activation_units[17] * fwd_Ea[17] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[17] * exp(low_beta[17] * tc[0] - activation_units[17] * low_Ea[17] * invT);
@@ -40215,16 +40131,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[17] == 4 ? exp(-troe_Tss[17] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[17]) > 1.e-100 ? -Fcent1/troe_Tsss[17] : 0.)
+      + (fabs(troe_Ts[17]) > 1.e-100 ? -Fcent2/troe_Ts[17] : 0.)
+      + (troe_len[17] == 4 ? Fcent3*troe_Tss[17]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[17]) > 1.e-100 ? -Fcent1/troe_Tsss[17] : 0.)
-      + (fabs(troe_Ts[17]) > 1.e-100 ? -Fcent2/troe_Ts[17] : 0.)
-      + (troe_len[17] == 4 ? Fcent3*troe_Tss[17]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -40232,7 +40148,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[20];
-    Kc = refCinv * exp(g_RT[5] + g_RT[11] - g_RT[20]);
+    Kc = Kc_s[17];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[11]) + (h_RT[20]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40250,127 +40166,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[17][0] - 1)*dcdc_fac;
-        J[5] -= dqdci;                /* dwdot[H2O]/d[H2] */
-        J[11] -= dqdci;               /* dwdot[CH2(S)]/d[H2] */
-        J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[17][1] - 1)*dcdc_fac + k_f*sc[11];
-        J[370] -= dqdci;              /* dwdot[H2O]/d[H2O] */
-        J[376] -= dqdci;              /* dwdot[CH2(S)]/d[H2O] */
-        J[385] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
-        /* d()/d[CH2(S)] */
-        dqdci =  + k_f*sc[5];
-        J[808] -= dqdci;              /* dwdot[H2O]/d[CH2(S)] */
-        J[814] -= dqdci;              /* dwdot[CH2(S)]/d[CH2(S)] */
-        J[823] += dqdci;              /* dwdot[CH3OH]/d[CH2(S)] */
-        /* d()/d[CH4] */
-        dqdci = (TB[17][2] - 1)*dcdc_fac;
-        J[954] -= dqdci;              /* dwdot[H2O]/d[CH4] */
-        J[960] -= dqdci;              /* dwdot[CH2(S)]/d[CH4] */
-        J[969] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[17][3] - 1)*dcdc_fac;
-        J[1027] -= dqdci;             /* dwdot[H2O]/d[CO] */
-        J[1033] -= dqdci;             /* dwdot[CH2(S)]/d[CO] */
-        J[1042] += dqdci;             /* dwdot[CH3OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[17][4] - 1)*dcdc_fac;
-        J[1100] -= dqdci;             /* dwdot[H2O]/d[CO2] */
-        J[1106] -= dqdci;             /* dwdot[CH2(S)]/d[CO2] */
-        J[1115] += dqdci;             /* dwdot[CH3OH]/d[CO2] */
-        /* d()/d[CH3OH] */
-        dqdci =  - k_r;
-        J[1465] -= dqdci;             /* dwdot[H2O]/d[CH3OH] */
-        J[1471] -= dqdci;             /* dwdot[CH2(S)]/d[CH3OH] */
-        J[1480] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[17][5] - 1)*dcdc_fac;
-        J[1903] -= dqdci;             /* dwdot[H2O]/d[C2H6] */
-        J[1909] -= dqdci;             /* dwdot[CH2(S)]/d[C2H6] */
-        J[1918] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[17][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[17][1]*dcdc_fac + k_f*sc[11];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac + k_f*sc[5];
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[17][2]*dcdc_fac;
-        dqdc[14] = TB[17][3]*dcdc_fac;
-        dqdc[15] = TB[17][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac - k_r;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[17][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+5] -= dqdc[k];
-            J[73*k+11] -= dqdc[k];
-            J[73*k+20] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[5] -= dcdc_fac;
+    Jmix[11] -= dcdc_fac;
+    Jmix[20] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[17][0] - 1)*dcdc_fac;
+    J[5] -= dqdci;                /* dwdot[H2O]/d[H2] */
+    J[11] -= dqdci;               /* dwdot[CH2(S)]/d[H2] */
+    J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[17][1] - 1)*dcdc_fac + k_f*sc[11];
+    J[370] -= dqdci;              /* dwdot[H2O]/d[H2O] */
+    J[376] -= dqdci;              /* dwdot[CH2(S)]/d[H2O] */
+    J[385] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
+    /* d()/d[CH2(S)] */
+    dqdci =  + k_f*sc[5];
+    J[808] -= dqdci;              /* dwdot[H2O]/d[CH2(S)] */
+    J[814] -= dqdci;              /* dwdot[CH2(S)]/d[CH2(S)] */
+    J[823] += dqdci;              /* dwdot[CH3OH]/d[CH2(S)] */
+    /* d()/d[CH4] */
+    dqdci = (TB[17][2] - 1)*dcdc_fac;
+    J[954] -= dqdci;              /* dwdot[H2O]/d[CH4] */
+    J[960] -= dqdci;              /* dwdot[CH2(S)]/d[CH4] */
+    J[969] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[17][3] - 1)*dcdc_fac;
+    J[1027] -= dqdci;             /* dwdot[H2O]/d[CO] */
+    J[1033] -= dqdci;             /* dwdot[CH2(S)]/d[CO] */
+    J[1042] += dqdci;             /* dwdot[CH3OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[17][4] - 1)*dcdc_fac;
+    J[1100] -= dqdci;             /* dwdot[H2O]/d[CO2] */
+    J[1106] -= dqdci;             /* dwdot[CH2(S)]/d[CO2] */
+    J[1115] += dqdci;             /* dwdot[CH3OH]/d[CO2] */
+    /* d()/d[CH3OH] */
+    dqdci =  - k_r;
+    J[1465] -= dqdci;             /* dwdot[H2O]/d[CH3OH] */
+    J[1471] -= dqdci;             /* dwdot[CH2(S)]/d[CH3OH] */
+    J[1480] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[17][5] - 1)*dcdc_fac;
+    J[1903] -= dqdci;             /* dwdot[H2O]/d[C2H6] */
+    J[1909] -= dqdci;             /* dwdot[CH2(S)]/d[C2H6] */
+    J[1918] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
     J[5261] -= dqdT; /* dwdot[H2O]/dT */
     J[5267] -= dqdT; /* dwdot[CH2(S)]/dT */
     J[5276] += dqdT; /* dwdot[CH3OH]/dT */
@@ -40379,11 +40218,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[18][0] - 1)*sc[0] + (TB[18][1] - 1)*sc[5] + (TB[18][2] - 1)*sc[13] + (TB[18][3] - 1)*sc[14] + (TB[18][4] - 1)*sc[15] + (TB[18][5] - 1)*sc[26] + (TB[18][6] - 1)*sc[48];
+    alpha = (memcmp(TB[18], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[18][0] - 1)*sc[0] + (TB[18][1] - 1)*sc[5] + (TB[18][2] - 1)*sc[13] + (TB[18][3] - 1)*sc[14] + (TB[18][4] - 1)*sc[15] + (TB[18][5] - 1)*sc[26] + (TB[18][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[12]*sc[12];
-    k_f = prefactor_units[18] * fwd_A[18]
-                * exp(fwd_beta[18] * tc[0] - activation_units[18] * fwd_Ea[18] * invT);
+    k_f = k_f_s[18];
     dlnkfdT = fwd_beta[18] * invT + activation_units[18] * fwd_Ea[18] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[18] * exp(low_beta[18] * tc[0] - activation_units[18] * low_Ea[18] * invT);
@@ -40399,16 +40237,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[18] == 4 ? exp(-troe_Tss[18] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[18]) > 1.e-100 ? -Fcent1/troe_Tsss[18] : 0.)
+      + (fabs(troe_Ts[18]) > 1.e-100 ? -Fcent2/troe_Ts[18] : 0.)
+      + (troe_len[18] == 4 ? Fcent3*troe_Tss[18]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[18]) > 1.e-100 ? -Fcent1/troe_Tsss[18] : 0.)
-      + (fabs(troe_Ts[18]) > 1.e-100 ? -Fcent2/troe_Ts[18] : 0.)
-      + (troe_len[18] == 4 ? Fcent3*troe_Tss[18]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -40416,7 +40254,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[26];
-    Kc = refCinv * exp(2*g_RT[12] - g_RT[26]);
+    Kc = Kc_s[18];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[12]) + (h_RT[26]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40433,118 +40271,41 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[18][0] - 1)*dcdc_fac;
-        J[12] += -2 * dqdci;          /* dwdot[CH3]/d[H2] */
-        J[26] += dqdci;               /* dwdot[C2H6]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[18][1] - 1)*dcdc_fac;
-        J[377] += -2 * dqdci;         /* dwdot[CH3]/d[H2O] */
-        J[391] += dqdci;              /* dwdot[C2H6]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*2*sc[12];
-        J[888] += -2 * dqdci;         /* dwdot[CH3]/d[CH3] */
-        J[902] += dqdci;              /* dwdot[C2H6]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[18][2] - 1)*dcdc_fac;
-        J[961] += -2 * dqdci;         /* dwdot[CH3]/d[CH4] */
-        J[975] += dqdci;              /* dwdot[C2H6]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[18][3] - 1)*dcdc_fac;
-        J[1034] += -2 * dqdci;        /* dwdot[CH3]/d[CO] */
-        J[1048] += dqdci;             /* dwdot[C2H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[18][4] - 1)*dcdc_fac;
-        J[1107] += -2 * dqdci;        /* dwdot[CH3]/d[CO2] */
-        J[1121] += dqdci;             /* dwdot[C2H6]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[18][5] - 1)*dcdc_fac - k_r;
-        J[1910] += -2 * dqdci;        /* dwdot[CH3]/d[C2H6] */
-        J[1924] += dqdci;             /* dwdot[C2H6]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[18][6] - 1)*dcdc_fac;
-        J[3516] += -2 * dqdci;        /* dwdot[CH3]/d[AR] */
-        J[3530] += dqdci;             /* dwdot[C2H6]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[18][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[18][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*2*sc[12];
-        dqdc[13] = TB[18][2]*dcdc_fac;
-        dqdc[14] = TB[18][3]*dcdc_fac;
-        dqdc[15] = TB[18][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[18][5]*dcdc_fac - k_r;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[18][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+12] += -2 * dqdc[k];
-            J[73*k+26] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[12] += -2 * dcdc_fac;
+    Jmix[26] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[18][0] - 1)*dcdc_fac;
+    J[12] += -2 * dqdci;          /* dwdot[CH3]/d[H2] */
+    J[26] += dqdci;               /* dwdot[C2H6]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[18][1] - 1)*dcdc_fac;
+    J[377] += -2 * dqdci;         /* dwdot[CH3]/d[H2O] */
+    J[391] += dqdci;              /* dwdot[C2H6]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*2*sc[12];
+    J[888] += -2 * dqdci;         /* dwdot[CH3]/d[CH3] */
+    J[902] += dqdci;              /* dwdot[C2H6]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[18][2] - 1)*dcdc_fac;
+    J[961] += -2 * dqdci;         /* dwdot[CH3]/d[CH4] */
+    J[975] += dqdci;              /* dwdot[C2H6]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[18][3] - 1)*dcdc_fac;
+    J[1034] += -2 * dqdci;        /* dwdot[CH3]/d[CO] */
+    J[1048] += dqdci;             /* dwdot[C2H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[18][4] - 1)*dcdc_fac;
+    J[1107] += -2 * dqdci;        /* dwdot[CH3]/d[CO2] */
+    J[1121] += dqdci;             /* dwdot[C2H6]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[18][5] - 1)*dcdc_fac - k_r;
+    J[1910] += -2 * dqdci;        /* dwdot[CH3]/d[C2H6] */
+    J[1924] += dqdci;             /* dwdot[C2H6]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[18][6] - 1)*dcdc_fac;
+    J[3516] += -2 * dqdci;        /* dwdot[CH3]/d[AR] */
+    J[3530] += dqdci;             /* dwdot[C2H6]/d[AR] */
     J[5268] += -2 * dqdT; /* dwdot[CH3]/dT */
     J[5282] += dqdT; /* dwdot[C2H6]/dT */
 
@@ -40552,11 +40313,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[19][0] - 1)*sc[0] + (TB[19][1] - 1)*sc[5] + (TB[19][2] - 1)*sc[13] + (TB[19][3] - 1)*sc[14] + (TB[19][4] - 1)*sc[15] + (TB[19][5] - 1)*sc[26] + (TB[19][6] - 1)*sc[48];
+    alpha = (memcmp(TB[19], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[19][0] - 1)*sc[0] + (TB[19][1] - 1)*sc[5] + (TB[19][2] - 1)*sc[13] + (TB[19][3] - 1)*sc[14] + (TB[19][4] - 1)*sc[15] + (TB[19][5] - 1)*sc[26] + (TB[19][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[24];
-    k_f = prefactor_units[19] * fwd_A[19]
-                * exp(fwd_beta[19] * tc[0] - activation_units[19] * fwd_Ea[19] * invT);
+    k_f = k_f_s[19];
     dlnkfdT = fwd_beta[19] * invT + activation_units[19] * fwd_Ea[19] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[19] * exp(low_beta[19] * tc[0] - activation_units[19] * low_Ea[19] * invT);
@@ -40572,16 +40332,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[19] == 4 ? exp(-troe_Tss[19] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[19]) > 1.e-100 ? -Fcent1/troe_Tsss[19] : 0.)
+      + (fabs(troe_Ts[19]) > 1.e-100 ? -Fcent2/troe_Ts[19] : 0.)
+      + (troe_len[19] == 4 ? Fcent3*troe_Tss[19]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[19]) > 1.e-100 ? -Fcent1/troe_Tsss[19] : 0.)
-      + (fabs(troe_Ts[19]) > 1.e-100 ? -Fcent2/troe_Ts[19] : 0.)
-      + (troe_len[19] == 4 ? Fcent3*troe_Tss[19]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -40589,7 +40349,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[0]*sc[22];
-    Kc = refC * exp(-g_RT[0] - g_RT[22] + g_RT[24]);
+    Kc = Kc_s[19];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[24]) + (h_RT[0] + h_RT[22]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40607,132 +40367,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[19][0] - 1)*dcdc_fac - k_r*sc[22];
-        J[0] += dqdci;                /* dwdot[H2]/d[H2] */
-        J[22] += dqdci;               /* dwdot[C2H2]/d[H2] */
-        J[24] -= dqdci;               /* dwdot[C2H4]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[19][1] - 1)*dcdc_fac;
-        J[365] += dqdci;              /* dwdot[H2]/d[H2O] */
-        J[387] += dqdci;              /* dwdot[C2H2]/d[H2O] */
-        J[389] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[19][2] - 1)*dcdc_fac;
-        J[949] += dqdci;              /* dwdot[H2]/d[CH4] */
-        J[971] += dqdci;              /* dwdot[C2H2]/d[CH4] */
-        J[973] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[19][3] - 1)*dcdc_fac;
-        J[1022] += dqdci;             /* dwdot[H2]/d[CO] */
-        J[1044] += dqdci;             /* dwdot[C2H2]/d[CO] */
-        J[1046] -= dqdci;             /* dwdot[C2H4]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[19][4] - 1)*dcdc_fac;
-        J[1095] += dqdci;             /* dwdot[H2]/d[CO2] */
-        J[1117] += dqdci;             /* dwdot[C2H2]/d[CO2] */
-        J[1119] -= dqdci;             /* dwdot[C2H4]/d[CO2] */
-        /* d()/d[C2H2] */
-        dqdci =  - k_r*sc[0];
-        J[1606] += dqdci;             /* dwdot[H2]/d[C2H2] */
-        J[1628] += dqdci;             /* dwdot[C2H2]/d[C2H2] */
-        J[1630] -= dqdci;             /* dwdot[C2H4]/d[C2H2] */
-        /* d()/d[C2H4] */
-        dqdci =  + k_f;
-        J[1752] += dqdci;             /* dwdot[H2]/d[C2H4] */
-        J[1774] += dqdci;             /* dwdot[C2H2]/d[C2H4] */
-        J[1776] -= dqdci;             /* dwdot[C2H4]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[19][5] - 1)*dcdc_fac;
-        J[1898] += dqdci;             /* dwdot[H2]/d[C2H6] */
-        J[1920] += dqdci;             /* dwdot[C2H2]/d[C2H6] */
-        J[1922] -= dqdci;             /* dwdot[C2H4]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[19][6] - 1)*dcdc_fac;
-        J[3504] += dqdci;             /* dwdot[H2]/d[AR] */
-        J[3526] += dqdci;             /* dwdot[C2H2]/d[AR] */
-        J[3528] -= dqdci;             /* dwdot[C2H4]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[19][0]*dcdc_fac - k_r*sc[22];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[19][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[19][2]*dcdc_fac;
-        dqdc[14] = TB[19][3]*dcdc_fac;
-        dqdc[15] = TB[19][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac - k_r*sc[0];
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac + k_f;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[19][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[19][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+0] += dqdc[k];
-            J[73*k+22] += dqdc[k];
-            J[73*k+24] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += dcdc_fac;
+    Jmix[22] += dcdc_fac;
+    Jmix[24] -= dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[19][0] - 1)*dcdc_fac - k_r*sc[22];
+    J[0] += dqdci;                /* dwdot[H2]/d[H2] */
+    J[22] += dqdci;               /* dwdot[C2H2]/d[H2] */
+    J[24] -= dqdci;               /* dwdot[C2H4]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[19][1] - 1)*dcdc_fac;
+    J[365] += dqdci;              /* dwdot[H2]/d[H2O] */
+    J[387] += dqdci;              /* dwdot[C2H2]/d[H2O] */
+    J[389] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[19][2] - 1)*dcdc_fac;
+    J[949] += dqdci;              /* dwdot[H2]/d[CH4] */
+    J[971] += dqdci;              /* dwdot[C2H2]/d[CH4] */
+    J[973] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[19][3] - 1)*dcdc_fac;
+    J[1022] += dqdci;             /* dwdot[H2]/d[CO] */
+    J[1044] += dqdci;             /* dwdot[C2H2]/d[CO] */
+    J[1046] -= dqdci;             /* dwdot[C2H4]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[19][4] - 1)*dcdc_fac;
+    J[1095] += dqdci;             /* dwdot[H2]/d[CO2] */
+    J[1117] += dqdci;             /* dwdot[C2H2]/d[CO2] */
+    J[1119] -= dqdci;             /* dwdot[C2H4]/d[CO2] */
+    /* d()/d[C2H2] */
+    dqdci =  - k_r*sc[0];
+    J[1606] += dqdci;             /* dwdot[H2]/d[C2H2] */
+    J[1628] += dqdci;             /* dwdot[C2H2]/d[C2H2] */
+    J[1630] -= dqdci;             /* dwdot[C2H4]/d[C2H2] */
+    /* d()/d[C2H4] */
+    dqdci =  + k_f;
+    J[1752] += dqdci;             /* dwdot[H2]/d[C2H4] */
+    J[1774] += dqdci;             /* dwdot[C2H2]/d[C2H4] */
+    J[1776] -= dqdci;             /* dwdot[C2H4]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[19][5] - 1)*dcdc_fac;
+    J[1898] += dqdci;             /* dwdot[H2]/d[C2H6] */
+    J[1920] += dqdci;             /* dwdot[C2H2]/d[C2H6] */
+    J[1922] -= dqdci;             /* dwdot[C2H4]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[19][6] - 1)*dcdc_fac;
+    J[3504] += dqdci;             /* dwdot[H2]/d[AR] */
+    J[3526] += dqdci;             /* dwdot[C2H2]/d[AR] */
+    J[3528] -= dqdci;             /* dwdot[C2H4]/d[AR] */
     J[5256] += dqdT; /* dwdot[H2]/dT */
     J[5278] += dqdT; /* dwdot[C2H2]/dT */
     J[5280] -= dqdT; /* dwdot[C2H4]/dT */
@@ -40744,8 +40427,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[20][0] - 1)*sc[0] + (TB[20][1] - 1)*sc[5] + (TB[20][2] - 1)*sc[13] + (TB[20][3] - 1)*sc[14] + (TB[20][4] - 1)*sc[15] + (TB[20][5] - 1)*sc[26] + (TB[20][6] - 1)*sc[48];
     /* forward */
     phi_f = sc[9]*sc[47];
-    k_f = prefactor_units[20] * fwd_A[20]
-                * exp(fwd_beta[20] * tc[0] - activation_units[20] * fwd_Ea[20] * invT);
+    k_f = k_f_s[20];
     dlnkfdT = fwd_beta[20] * invT + activation_units[20] * fwd_Ea[20] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[20] * exp(low_beta[20] * tc[0] - activation_units[20] * low_Ea[20] * invT);
@@ -40761,16 +40443,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[20] == 4 ? exp(-troe_Tss[20] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[20]) > 1.e-100 ? -Fcent1/troe_Tsss[20] : 0.)
+      + (fabs(troe_Ts[20]) > 1.e-100 ? -Fcent2/troe_Ts[20] : 0.)
+      + (troe_len[20] == 4 ? Fcent3*troe_Tss[20]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[20]) > 1.e-100 ? -Fcent1/troe_Tsss[20] : 0.)
-      + (fabs(troe_Ts[20]) > 1.e-100 ? -Fcent2/troe_Ts[20] : 0.)
-      + (troe_len[20] == 4 ? Fcent3*troe_Tss[20]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -40778,7 +40460,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[42];
-    Kc = refCinv * exp(g_RT[9] - g_RT[42] + g_RT[47]);
+    Kc = Kc_s[20];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[47]) + (h_RT[42]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40796,137 +40478,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[20][0] - 1)*dcdc_fac;
-        J[9] -= dqdci;                /* dwdot[CH]/d[H2] */
-        J[42] += dqdci;               /* dwdot[HCNN]/d[H2] */
-        J[47] -= dqdci;               /* dwdot[N2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[20][1] - 1)*dcdc_fac;
-        J[374] -= dqdci;              /* dwdot[CH]/d[H2O] */
-        J[407] += dqdci;              /* dwdot[HCNN]/d[H2O] */
-        J[412] -= dqdci;              /* dwdot[N2]/d[H2O] */
-        /* d()/d[CH] */
-        dqdci =  + k_f*sc[47];
-        J[666] -= dqdci;              /* dwdot[CH]/d[CH] */
-        J[699] += dqdci;              /* dwdot[HCNN]/d[CH] */
-        J[704] -= dqdci;              /* dwdot[N2]/d[CH] */
-        /* d()/d[CH4] */
-        dqdci = (TB[20][2] - 1)*dcdc_fac;
-        J[958] -= dqdci;              /* dwdot[CH]/d[CH4] */
-        J[991] += dqdci;              /* dwdot[HCNN]/d[CH4] */
-        J[996] -= dqdci;              /* dwdot[N2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[20][3] - 1)*dcdc_fac;
-        J[1031] -= dqdci;             /* dwdot[CH]/d[CO] */
-        J[1064] += dqdci;             /* dwdot[HCNN]/d[CO] */
-        J[1069] -= dqdci;             /* dwdot[N2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[20][4] - 1)*dcdc_fac;
-        J[1104] -= dqdci;             /* dwdot[CH]/d[CO2] */
-        J[1137] += dqdci;             /* dwdot[HCNN]/d[CO2] */
-        J[1142] -= dqdci;             /* dwdot[N2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[20][5] - 1)*dcdc_fac;
-        J[1907] -= dqdci;             /* dwdot[CH]/d[C2H6] */
-        J[1940] += dqdci;             /* dwdot[HCNN]/d[C2H6] */
-        J[1945] -= dqdci;             /* dwdot[N2]/d[C2H6] */
-        /* d()/d[HCNN] */
-        dqdci =  - k_r;
-        J[3075] -= dqdci;             /* dwdot[CH]/d[HCNN] */
-        J[3108] += dqdci;             /* dwdot[HCNN]/d[HCNN] */
-        J[3113] -= dqdci;             /* dwdot[N2]/d[HCNN] */
-        /* d()/d[N2] */
-        dqdci =  + k_f*sc[9];
-        J[3440] -= dqdci;             /* dwdot[CH]/d[N2] */
-        J[3473] += dqdci;             /* dwdot[HCNN]/d[N2] */
-        J[3478] -= dqdci;             /* dwdot[N2]/d[N2] */
-        /* d()/d[AR] */
-        dqdci = (TB[20][6] - 1)*dcdc_fac;
-        J[3513] -= dqdci;             /* dwdot[CH]/d[AR] */
-        J[3546] += dqdci;             /* dwdot[HCNN]/d[AR] */
-        J[3551] -= dqdci;             /* dwdot[N2]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[20][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[20][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac + k_f*sc[47];
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[20][2]*dcdc_fac;
-        dqdc[14] = TB[20][3]*dcdc_fac;
-        dqdc[15] = TB[20][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[20][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac - k_r;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac + k_f*sc[9];
-        dqdc[48] = TB[20][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+9] -= dqdc[k];
-            J[73*k+42] += dqdc[k];
-            J[73*k+47] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[9] -= dcdc_fac;
+    Jmix[42] += dcdc_fac;
+    Jmix[47] -= dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[20][0] - 1)*dcdc_fac;
+    J[9] -= dqdci;                /* dwdot[CH]/d[H2] */
+    J[42] += dqdci;               /* dwdot[HCNN]/d[H2] */
+    J[47] -= dqdci;               /* dwdot[N2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[20][1] - 1)*dcdc_fac;
+    J[374] -= dqdci;              /* dwdot[CH]/d[H2O] */
+    J[407] += dqdci;              /* dwdot[HCNN]/d[H2O] */
+    J[412] -= dqdci;              /* dwdot[N2]/d[H2O] */
+    /* d()/d[CH] */
+    dqdci =  + k_f*sc[47];
+    J[666] -= dqdci;              /* dwdot[CH]/d[CH] */
+    J[699] += dqdci;              /* dwdot[HCNN]/d[CH] */
+    J[704] -= dqdci;              /* dwdot[N2]/d[CH] */
+    /* d()/d[CH4] */
+    dqdci = (TB[20][2] - 1)*dcdc_fac;
+    J[958] -= dqdci;              /* dwdot[CH]/d[CH4] */
+    J[991] += dqdci;              /* dwdot[HCNN]/d[CH4] */
+    J[996] -= dqdci;              /* dwdot[N2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[20][3] - 1)*dcdc_fac;
+    J[1031] -= dqdci;             /* dwdot[CH]/d[CO] */
+    J[1064] += dqdci;             /* dwdot[HCNN]/d[CO] */
+    J[1069] -= dqdci;             /* dwdot[N2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[20][4] - 1)*dcdc_fac;
+    J[1104] -= dqdci;             /* dwdot[CH]/d[CO2] */
+    J[1137] += dqdci;             /* dwdot[HCNN]/d[CO2] */
+    J[1142] -= dqdci;             /* dwdot[N2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[20][5] - 1)*dcdc_fac;
+    J[1907] -= dqdci;             /* dwdot[CH]/d[C2H6] */
+    J[1940] += dqdci;             /* dwdot[HCNN]/d[C2H6] */
+    J[1945] -= dqdci;             /* dwdot[N2]/d[C2H6] */
+    /* d()/d[HCNN] */
+    dqdci =  - k_r;
+    J[3075] -= dqdci;             /* dwdot[CH]/d[HCNN] */
+    J[3108] += dqdci;             /* dwdot[HCNN]/d[HCNN] */
+    J[3113] -= dqdci;             /* dwdot[N2]/d[HCNN] */
+    /* d()/d[N2] */
+    dqdci =  + k_f*sc[9];
+    J[3440] -= dqdci;             /* dwdot[CH]/d[N2] */
+    J[3473] += dqdci;             /* dwdot[HCNN]/d[N2] */
+    J[3478] -= dqdci;             /* dwdot[N2]/d[N2] */
+    /* d()/d[AR] */
+    dqdci = (TB[20][6] - 1)*dcdc_fac;
+    J[3513] -= dqdci;             /* dwdot[CH]/d[AR] */
+    J[3546] += dqdci;             /* dwdot[HCNN]/d[AR] */
+    J[3551] -= dqdci;             /* dwdot[N2]/d[AR] */
     J[5265] -= dqdT; /* dwdot[CH]/dT */
     J[5298] += dqdT; /* dwdot[HCNN]/dT */
     J[5303] -= dqdT; /* dwdot[N2]/dT */
@@ -40935,11 +40540,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[21][0] - 1)*sc[0] + (TB[21][1] - 1)*sc[5] + (TB[21][2] - 1)*sc[13] + (TB[21][3] - 1)*sc[14] + (TB[21][4] - 1)*sc[15] + (TB[21][5] - 1)*sc[26] + (TB[21][6] - 1)*sc[48];
+    alpha = (memcmp(TB[21], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[21][0] - 1)*sc[0] + (TB[21][1] - 1)*sc[5] + (TB[21][2] - 1)*sc[13] + (TB[21][3] - 1)*sc[14] + (TB[21][4] - 1)*sc[15] + (TB[21][5] - 1)*sc[26] + (TB[21][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[0]*sc[9];
-    k_f = prefactor_units[21] * fwd_A[21]
-                * exp(fwd_beta[21] * tc[0] - activation_units[21] * fwd_Ea[21] * invT);
+    k_f = k_f_s[21];
     dlnkfdT = fwd_beta[21] * invT + activation_units[21] * fwd_Ea[21] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[21] * exp(low_beta[21] * tc[0] - activation_units[21] * low_Ea[21] * invT);
@@ -40955,16 +40559,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[21] == 4 ? exp(-troe_Tss[21] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[21]) > 1.e-100 ? -Fcent1/troe_Tsss[21] : 0.)
+      + (fabs(troe_Ts[21]) > 1.e-100 ? -Fcent2/troe_Ts[21] : 0.)
+      + (troe_len[21] == 4 ? Fcent3*troe_Tss[21]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[21]) > 1.e-100 ? -Fcent1/troe_Tsss[21] : 0.)
-      + (fabs(troe_Ts[21]) > 1.e-100 ? -Fcent2/troe_Ts[21] : 0.)
-      + (troe_len[21] == 4 ? Fcent3*troe_Tss[21]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -40972,7 +40576,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[12];
-    Kc = refCinv * exp(g_RT[0] + g_RT[9] - g_RT[12]);
+    Kc = Kc_s[21];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[9]) + (h_RT[12]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40990,132 +40594,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[21][0] - 1)*dcdc_fac + k_f*sc[9];
-        J[0] -= dqdci;                /* dwdot[H2]/d[H2] */
-        J[9] -= dqdci;                /* dwdot[CH]/d[H2] */
-        J[12] += dqdci;               /* dwdot[CH3]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[21][1] - 1)*dcdc_fac;
-        J[365] -= dqdci;              /* dwdot[H2]/d[H2O] */
-        J[374] -= dqdci;              /* dwdot[CH]/d[H2O] */
-        J[377] += dqdci;              /* dwdot[CH3]/d[H2O] */
-        /* d()/d[CH] */
-        dqdci =  + k_f*sc[0];
-        J[657] -= dqdci;              /* dwdot[H2]/d[CH] */
-        J[666] -= dqdci;              /* dwdot[CH]/d[CH] */
-        J[669] += dqdci;              /* dwdot[CH3]/d[CH] */
-        /* d()/d[CH3] */
-        dqdci =  - k_r;
-        J[876] -= dqdci;              /* dwdot[H2]/d[CH3] */
-        J[885] -= dqdci;              /* dwdot[CH]/d[CH3] */
-        J[888] += dqdci;              /* dwdot[CH3]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[21][2] - 1)*dcdc_fac;
-        J[949] -= dqdci;              /* dwdot[H2]/d[CH4] */
-        J[958] -= dqdci;              /* dwdot[CH]/d[CH4] */
-        J[961] += dqdci;              /* dwdot[CH3]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[21][3] - 1)*dcdc_fac;
-        J[1022] -= dqdci;             /* dwdot[H2]/d[CO] */
-        J[1031] -= dqdci;             /* dwdot[CH]/d[CO] */
-        J[1034] += dqdci;             /* dwdot[CH3]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[21][4] - 1)*dcdc_fac;
-        J[1095] -= dqdci;             /* dwdot[H2]/d[CO2] */
-        J[1104] -= dqdci;             /* dwdot[CH]/d[CO2] */
-        J[1107] += dqdci;             /* dwdot[CH3]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[21][5] - 1)*dcdc_fac;
-        J[1898] -= dqdci;             /* dwdot[H2]/d[C2H6] */
-        J[1907] -= dqdci;             /* dwdot[CH]/d[C2H6] */
-        J[1910] += dqdci;             /* dwdot[CH3]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[21][6] - 1)*dcdc_fac;
-        J[3504] -= dqdci;             /* dwdot[H2]/d[AR] */
-        J[3513] -= dqdci;             /* dwdot[CH]/d[AR] */
-        J[3516] += dqdci;             /* dwdot[CH3]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[21][0]*dcdc_fac + k_f*sc[9];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[21][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac + k_f*sc[0];
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac - k_r;
-        dqdc[13] = TB[21][2]*dcdc_fac;
-        dqdc[14] = TB[21][3]*dcdc_fac;
-        dqdc[15] = TB[21][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[21][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[21][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+0] -= dqdc[k];
-            J[73*k+9] -= dqdc[k];
-            J[73*k+12] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[9] -= dcdc_fac;
+    Jmix[12] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[21][0] - 1)*dcdc_fac + k_f*sc[9];
+    J[0] -= dqdci;                /* dwdot[H2]/d[H2] */
+    J[9] -= dqdci;                /* dwdot[CH]/d[H2] */
+    J[12] += dqdci;               /* dwdot[CH3]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[21][1] - 1)*dcdc_fac;
+    J[365] -= dqdci;              /* dwdot[H2]/d[H2O] */
+    J[374] -= dqdci;              /* dwdot[CH]/d[H2O] */
+    J[377] += dqdci;              /* dwdot[CH3]/d[H2O] */
+    /* d()/d[CH] */
+    dqdci =  + k_f*sc[0];
+    J[657] -= dqdci;              /* dwdot[H2]/d[CH] */
+    J[666] -= dqdci;              /* dwdot[CH]/d[CH] */
+    J[669] += dqdci;              /* dwdot[CH3]/d[CH] */
+    /* d()/d[CH3] */
+    dqdci =  - k_r;
+    J[876] -= dqdci;              /* dwdot[H2]/d[CH3] */
+    J[885] -= dqdci;              /* dwdot[CH]/d[CH3] */
+    J[888] += dqdci;              /* dwdot[CH3]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[21][2] - 1)*dcdc_fac;
+    J[949] -= dqdci;              /* dwdot[H2]/d[CH4] */
+    J[958] -= dqdci;              /* dwdot[CH]/d[CH4] */
+    J[961] += dqdci;              /* dwdot[CH3]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[21][3] - 1)*dcdc_fac;
+    J[1022] -= dqdci;             /* dwdot[H2]/d[CO] */
+    J[1031] -= dqdci;             /* dwdot[CH]/d[CO] */
+    J[1034] += dqdci;             /* dwdot[CH3]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[21][4] - 1)*dcdc_fac;
+    J[1095] -= dqdci;             /* dwdot[H2]/d[CO2] */
+    J[1104] -= dqdci;             /* dwdot[CH]/d[CO2] */
+    J[1107] += dqdci;             /* dwdot[CH3]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[21][5] - 1)*dcdc_fac;
+    J[1898] -= dqdci;             /* dwdot[H2]/d[C2H6] */
+    J[1907] -= dqdci;             /* dwdot[CH]/d[C2H6] */
+    J[1910] += dqdci;             /* dwdot[CH3]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[21][6] - 1)*dcdc_fac;
+    J[3504] -= dqdci;             /* dwdot[H2]/d[AR] */
+    J[3513] -= dqdci;             /* dwdot[CH]/d[AR] */
+    J[3516] += dqdci;             /* dwdot[CH3]/d[AR] */
     J[5256] -= dqdT; /* dwdot[H2]/dT */
     J[5265] -= dqdT; /* dwdot[CH]/dT */
     J[5268] += dqdT; /* dwdot[CH3]/dT */
@@ -41124,11 +40651,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[22][0] - 1)*sc[0] + (TB[22][1] - 1)*sc[5] + (TB[22][2] - 1)*sc[13] + (TB[22][3] - 1)*sc[14] + (TB[22][4] - 1)*sc[15] + (TB[22][5] - 1)*sc[26] + (TB[22][6] - 1)*sc[48];
+    alpha = (memcmp(TB[22], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[22][0] - 1)*sc[0] + (TB[22][1] - 1)*sc[5] + (TB[22][2] - 1)*sc[13] + (TB[22][3] - 1)*sc[14] + (TB[22][4] - 1)*sc[15] + (TB[22][5] - 1)*sc[26] + (TB[22][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[1]*sc[28];
-    k_f = prefactor_units[22] * fwd_A[22]
-                * exp(fwd_beta[22] * tc[0] - activation_units[22] * fwd_Ea[22] * invT);
+    k_f = k_f_s[22];
     dlnkfdT = fwd_beta[22] * invT + activation_units[22] * fwd_Ea[22] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[22] * exp(low_beta[22] * tc[0] - activation_units[22] * low_Ea[22] * invT);
@@ -41144,16 +40670,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[22] == 4 ? exp(-troe_Tss[22] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[22]) > 1.e-100 ? -Fcent1/troe_Tsss[22] : 0.)
+      + (fabs(troe_Ts[22]) > 1.e-100 ? -Fcent2/troe_Ts[22] : 0.)
+      + (troe_len[22] == 4 ? Fcent3*troe_Tss[22]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[22]) > 1.e-100 ? -Fcent1/troe_Tsss[22] : 0.)
-      + (fabs(troe_Ts[22]) > 1.e-100 ? -Fcent2/troe_Ts[22] : 0.)
-      + (troe_len[22] == 4 ? Fcent3*troe_Tss[22]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -41161,7 +40687,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[51];
-    Kc = refCinv * exp(g_RT[1] + g_RT[28] - g_RT[51]);
+    Kc = Kc_s[22];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[28]) + (h_RT[51]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41179,137 +40705,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[22][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[28] -= dqdci;               /* dwdot[CH2CO]/d[H2] */
-        J[51] += dqdci;               /* dwdot[CH2CHO]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[28];
-        J[74] -= dqdci;               /* dwdot[H]/d[H] */
-        J[101] -= dqdci;              /* dwdot[CH2CO]/d[H] */
-        J[124] += dqdci;              /* dwdot[CH2CHO]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[22][1] - 1)*dcdc_fac;
-        J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[393] -= dqdci;              /* dwdot[CH2CO]/d[H2O] */
-        J[416] += dqdci;              /* dwdot[CH2CHO]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[22][2] - 1)*dcdc_fac;
-        J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[977] -= dqdci;              /* dwdot[CH2CO]/d[CH4] */
-        J[1000] += dqdci;             /* dwdot[CH2CHO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[22][3] - 1)*dcdc_fac;
-        J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1050] -= dqdci;             /* dwdot[CH2CO]/d[CO] */
-        J[1073] += dqdci;             /* dwdot[CH2CHO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[22][4] - 1)*dcdc_fac;
-        J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1123] -= dqdci;             /* dwdot[CH2CO]/d[CO2] */
-        J[1146] += dqdci;             /* dwdot[CH2CHO]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[22][5] - 1)*dcdc_fac;
-        J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1926] -= dqdci;             /* dwdot[CH2CO]/d[C2H6] */
-        J[1949] += dqdci;             /* dwdot[CH2CHO]/d[C2H6] */
-        /* d()/d[CH2CO] */
-        dqdci =  + k_f*sc[1];
-        J[2045] -= dqdci;             /* dwdot[H]/d[CH2CO] */
-        J[2072] -= dqdci;             /* dwdot[CH2CO]/d[CH2CO] */
-        J[2095] += dqdci;             /* dwdot[CH2CHO]/d[CH2CO] */
-        /* d()/d[AR] */
-        dqdci = (TB[22][6] - 1)*dcdc_fac;
-        J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[3532] -= dqdci;             /* dwdot[CH2CO]/d[AR] */
-        J[3555] += dqdci;             /* dwdot[CH2CHO]/d[AR] */
-        /* d()/d[CH2CHO] */
-        dqdci =  - k_r;
-        J[3724] -= dqdci;             /* dwdot[H]/d[CH2CHO] */
-        J[3751] -= dqdci;             /* dwdot[CH2CO]/d[CH2CHO] */
-        J[3774] += dqdci;             /* dwdot[CH2CHO]/d[CH2CHO] */
-    }
-    else {
-        dqdc[0] = TB[22][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[28];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[22][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[22][2]*dcdc_fac;
-        dqdc[14] = TB[22][3]*dcdc_fac;
-        dqdc[15] = TB[22][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[22][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac + k_f*sc[1];
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[22][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac - k_r;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+1] -= dqdc[k];
-            J[73*k+28] -= dqdc[k];
-            J[73*k+51] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[28] -= dcdc_fac;
+    Jmix[51] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[22][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[28] -= dqdci;               /* dwdot[CH2CO]/d[H2] */
+    J[51] += dqdci;               /* dwdot[CH2CHO]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[28];
+    J[74] -= dqdci;               /* dwdot[H]/d[H] */
+    J[101] -= dqdci;              /* dwdot[CH2CO]/d[H] */
+    J[124] += dqdci;              /* dwdot[CH2CHO]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[22][1] - 1)*dcdc_fac;
+    J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[393] -= dqdci;              /* dwdot[CH2CO]/d[H2O] */
+    J[416] += dqdci;              /* dwdot[CH2CHO]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[22][2] - 1)*dcdc_fac;
+    J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[977] -= dqdci;              /* dwdot[CH2CO]/d[CH4] */
+    J[1000] += dqdci;             /* dwdot[CH2CHO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[22][3] - 1)*dcdc_fac;
+    J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1050] -= dqdci;             /* dwdot[CH2CO]/d[CO] */
+    J[1073] += dqdci;             /* dwdot[CH2CHO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[22][4] - 1)*dcdc_fac;
+    J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1123] -= dqdci;             /* dwdot[CH2CO]/d[CO2] */
+    J[1146] += dqdci;             /* dwdot[CH2CHO]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[22][5] - 1)*dcdc_fac;
+    J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1926] -= dqdci;             /* dwdot[CH2CO]/d[C2H6] */
+    J[1949] += dqdci;             /* dwdot[CH2CHO]/d[C2H6] */
+    /* d()/d[CH2CO] */
+    dqdci =  + k_f*sc[1];
+    J[2045] -= dqdci;             /* dwdot[H]/d[CH2CO] */
+    J[2072] -= dqdci;             /* dwdot[CH2CO]/d[CH2CO] */
+    J[2095] += dqdci;             /* dwdot[CH2CHO]/d[CH2CO] */
+    /* d()/d[AR] */
+    dqdci = (TB[22][6] - 1)*dcdc_fac;
+    J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[3532] -= dqdci;             /* dwdot[CH2CO]/d[AR] */
+    J[3555] += dqdci;             /* dwdot[CH2CHO]/d[AR] */
+    /* d()/d[CH2CHO] */
+    dqdci =  - k_r;
+    J[3724] -= dqdci;             /* dwdot[H]/d[CH2CHO] */
+    J[3751] -= dqdci;             /* dwdot[CH2CO]/d[CH2CHO] */
+    J[3774] += dqdci;             /* dwdot[CH2CHO]/d[CH2CHO] */
     J[5257] -= dqdT; /* dwdot[H]/dT */
     J[5284] -= dqdT; /* dwdot[CH2CO]/dT */
     J[5307] += dqdT; /* dwdot[CH2CHO]/dT */
@@ -41318,11 +40767,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[23][0] - 1)*sc[0] + (TB[23][1] - 1)*sc[5] + (TB[23][2] - 1)*sc[13] + (TB[23][3] - 1)*sc[14] + (TB[23][4] - 1)*sc[15] + (TB[23][5] - 1)*sc[26] + (TB[23][6] - 1)*sc[48];
+    alpha = (memcmp(TB[23], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[23][0] - 1)*sc[0] + (TB[23][1] - 1)*sc[5] + (TB[23][2] - 1)*sc[13] + (TB[23][3] - 1)*sc[14] + (TB[23][4] - 1)*sc[15] + (TB[23][5] - 1)*sc[26] + (TB[23][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[12]*sc[25];
-    k_f = prefactor_units[23] * fwd_A[23]
-                * exp(fwd_beta[23] * tc[0] - activation_units[23] * fwd_Ea[23] * invT);
+    k_f = k_f_s[23];
     dlnkfdT = fwd_beta[23] * invT + activation_units[23] * fwd_Ea[23] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[23] * exp(low_beta[23] * tc[0] - activation_units[23] * low_Ea[23] * invT);
@@ -41338,16 +40786,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[23] == 4 ? exp(-troe_Tss[23] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[23]) > 1.e-100 ? -Fcent1/troe_Tsss[23] : 0.)
+      + (fabs(troe_Ts[23]) > 1.e-100 ? -Fcent2/troe_Ts[23] : 0.)
+      + (troe_len[23] == 4 ? Fcent3*troe_Tss[23]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[23]) > 1.e-100 ? -Fcent1/troe_Tsss[23] : 0.)
-      + (fabs(troe_Ts[23]) > 1.e-100 ? -Fcent2/troe_Ts[23] : 0.)
-      + (troe_len[23] == 4 ? Fcent3*troe_Tss[23]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -41355,7 +40803,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[50];
-    Kc = refCinv * exp(g_RT[12] + g_RT[25] - g_RT[50]);
+    Kc = Kc_s[23];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[25]) + (h_RT[50]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41373,137 +40821,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[23][0] - 1)*dcdc_fac;
-        J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
-        J[25] -= dqdci;               /* dwdot[C2H5]/d[H2] */
-        J[50] += dqdci;               /* dwdot[C3H8]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[23][1] - 1)*dcdc_fac;
-        J[377] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[390] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
-        J[415] += dqdci;              /* dwdot[C3H8]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[25];
-        J[888] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[901] -= dqdci;              /* dwdot[C2H5]/d[CH3] */
-        J[926] += dqdci;              /* dwdot[C3H8]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[23][2] - 1)*dcdc_fac;
-        J[961] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[974] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
-        J[999] += dqdci;              /* dwdot[C3H8]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[23][3] - 1)*dcdc_fac;
-        J[1034] -= dqdci;             /* dwdot[CH3]/d[CO] */
-        J[1047] -= dqdci;             /* dwdot[C2H5]/d[CO] */
-        J[1072] += dqdci;             /* dwdot[C3H8]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[23][4] - 1)*dcdc_fac;
-        J[1107] -= dqdci;             /* dwdot[CH3]/d[CO2] */
-        J[1120] -= dqdci;             /* dwdot[C2H5]/d[CO2] */
-        J[1145] += dqdci;             /* dwdot[C3H8]/d[CO2] */
-        /* d()/d[C2H5] */
-        dqdci =  + k_f*sc[12];
-        J[1837] -= dqdci;             /* dwdot[CH3]/d[C2H5] */
-        J[1850] -= dqdci;             /* dwdot[C2H5]/d[C2H5] */
-        J[1875] += dqdci;             /* dwdot[C3H8]/d[C2H5] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[23][5] - 1)*dcdc_fac;
-        J[1910] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
-        J[1923] -= dqdci;             /* dwdot[C2H5]/d[C2H6] */
-        J[1948] += dqdci;             /* dwdot[C3H8]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[23][6] - 1)*dcdc_fac;
-        J[3516] -= dqdci;             /* dwdot[CH3]/d[AR] */
-        J[3529] -= dqdci;             /* dwdot[C2H5]/d[AR] */
-        J[3554] += dqdci;             /* dwdot[C3H8]/d[AR] */
-        /* d()/d[C3H8] */
-        dqdci =  - k_r;
-        J[3662] -= dqdci;             /* dwdot[CH3]/d[C3H8] */
-        J[3675] -= dqdci;             /* dwdot[C2H5]/d[C3H8] */
-        J[3700] += dqdci;             /* dwdot[C3H8]/d[C3H8] */
-    }
-    else {
-        dqdc[0] = TB[23][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[23][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*sc[25];
-        dqdc[13] = TB[23][2]*dcdc_fac;
-        dqdc[14] = TB[23][3]*dcdc_fac;
-        dqdc[15] = TB[23][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac + k_f*sc[12];
-        dqdc[26] = TB[23][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[23][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac - k_r;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+12] -= dqdc[k];
-            J[73*k+25] -= dqdc[k];
-            J[73*k+50] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[12] -= dcdc_fac;
+    Jmix[25] -= dcdc_fac;
+    Jmix[50] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[23][0] - 1)*dcdc_fac;
+    J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
+    J[25] -= dqdci;               /* dwdot[C2H5]/d[H2] */
+    J[50] += dqdci;               /* dwdot[C3H8]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[23][1] - 1)*dcdc_fac;
+    J[377] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[390] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
+    J[415] += dqdci;              /* dwdot[C3H8]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[25];
+    J[888] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[901] -= dqdci;              /* dwdot[C2H5]/d[CH3] */
+    J[926] += dqdci;              /* dwdot[C3H8]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[23][2] - 1)*dcdc_fac;
+    J[961] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[974] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
+    J[999] += dqdci;              /* dwdot[C3H8]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[23][3] - 1)*dcdc_fac;
+    J[1034] -= dqdci;             /* dwdot[CH3]/d[CO] */
+    J[1047] -= dqdci;             /* dwdot[C2H5]/d[CO] */
+    J[1072] += dqdci;             /* dwdot[C3H8]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[23][4] - 1)*dcdc_fac;
+    J[1107] -= dqdci;             /* dwdot[CH3]/d[CO2] */
+    J[1120] -= dqdci;             /* dwdot[C2H5]/d[CO2] */
+    J[1145] += dqdci;             /* dwdot[C3H8]/d[CO2] */
+    /* d()/d[C2H5] */
+    dqdci =  + k_f*sc[12];
+    J[1837] -= dqdci;             /* dwdot[CH3]/d[C2H5] */
+    J[1850] -= dqdci;             /* dwdot[C2H5]/d[C2H5] */
+    J[1875] += dqdci;             /* dwdot[C3H8]/d[C2H5] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[23][5] - 1)*dcdc_fac;
+    J[1910] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
+    J[1923] -= dqdci;             /* dwdot[C2H5]/d[C2H6] */
+    J[1948] += dqdci;             /* dwdot[C3H8]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[23][6] - 1)*dcdc_fac;
+    J[3516] -= dqdci;             /* dwdot[CH3]/d[AR] */
+    J[3529] -= dqdci;             /* dwdot[C2H5]/d[AR] */
+    J[3554] += dqdci;             /* dwdot[C3H8]/d[AR] */
+    /* d()/d[C3H8] */
+    dqdci =  - k_r;
+    J[3662] -= dqdci;             /* dwdot[CH3]/d[C3H8] */
+    J[3675] -= dqdci;             /* dwdot[C2H5]/d[C3H8] */
+    J[3700] += dqdci;             /* dwdot[C3H8]/d[C3H8] */
     J[5268] -= dqdT; /* dwdot[CH3]/dT */
     J[5281] -= dqdT; /* dwdot[C2H5]/dT */
     J[5306] += dqdT; /* dwdot[C3H8]/dT */
@@ -41512,11 +40883,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[24][0] - 1)*sc[0] + (TB[24][1] - 1)*sc[5] + (TB[24][2] - 1)*sc[13] + (TB[24][3] - 1)*sc[14] + (TB[24][4] - 1)*sc[15] + (TB[24][5] - 1)*sc[26] + (TB[24][6] - 1)*sc[48];
+    alpha = (memcmp(TB[24], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[24][0] - 1)*sc[0] + (TB[24][1] - 1)*sc[5] + (TB[24][2] - 1)*sc[13] + (TB[24][3] - 1)*sc[14] + (TB[24][4] - 1)*sc[15] + (TB[24][5] - 1)*sc[26] + (TB[24][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[12]*sc[24];
-    k_f = prefactor_units[24] * fwd_A[24]
-                * exp(fwd_beta[24] * tc[0] - activation_units[24] * fwd_Ea[24] * invT);
+    k_f = k_f_s[24];
     dlnkfdT = fwd_beta[24] * invT + activation_units[24] * fwd_Ea[24] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[24] * exp(low_beta[24] * tc[0] - activation_units[24] * low_Ea[24] * invT);
@@ -41532,16 +40902,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[24] == 4 ? exp(-troe_Tss[24] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[24]) > 1.e-100 ? -Fcent1/troe_Tsss[24] : 0.)
+      + (fabs(troe_Ts[24]) > 1.e-100 ? -Fcent2/troe_Ts[24] : 0.)
+      + (troe_len[24] == 4 ? Fcent3*troe_Tss[24]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[24]) > 1.e-100 ? -Fcent1/troe_Tsss[24] : 0.)
-      + (fabs(troe_Ts[24]) > 1.e-100 ? -Fcent2/troe_Ts[24] : 0.)
-      + (troe_len[24] == 4 ? Fcent3*troe_Tss[24]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -41549,7 +40919,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[49];
-    Kc = refCinv * exp(g_RT[12] + g_RT[24] - g_RT[49]);
+    Kc = Kc_s[24];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[24]) + (h_RT[49]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41567,137 +40937,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[24][0] - 1)*dcdc_fac;
-        J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
-        J[24] -= dqdci;               /* dwdot[C2H4]/d[H2] */
-        J[49] += dqdci;               /* dwdot[C3H7]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[24][1] - 1)*dcdc_fac;
-        J[377] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[389] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
-        J[414] += dqdci;              /* dwdot[C3H7]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[24];
-        J[888] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[900] -= dqdci;              /* dwdot[C2H4]/d[CH3] */
-        J[925] += dqdci;              /* dwdot[C3H7]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[24][2] - 1)*dcdc_fac;
-        J[961] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[973] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
-        J[998] += dqdci;              /* dwdot[C3H7]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[24][3] - 1)*dcdc_fac;
-        J[1034] -= dqdci;             /* dwdot[CH3]/d[CO] */
-        J[1046] -= dqdci;             /* dwdot[C2H4]/d[CO] */
-        J[1071] += dqdci;             /* dwdot[C3H7]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[24][4] - 1)*dcdc_fac;
-        J[1107] -= dqdci;             /* dwdot[CH3]/d[CO2] */
-        J[1119] -= dqdci;             /* dwdot[C2H4]/d[CO2] */
-        J[1144] += dqdci;             /* dwdot[C3H7]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci =  + k_f*sc[12];
-        J[1764] -= dqdci;             /* dwdot[CH3]/d[C2H4] */
-        J[1776] -= dqdci;             /* dwdot[C2H4]/d[C2H4] */
-        J[1801] += dqdci;             /* dwdot[C3H7]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[24][5] - 1)*dcdc_fac;
-        J[1910] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
-        J[1922] -= dqdci;             /* dwdot[C2H4]/d[C2H6] */
-        J[1947] += dqdci;             /* dwdot[C3H7]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[24][6] - 1)*dcdc_fac;
-        J[3516] -= dqdci;             /* dwdot[CH3]/d[AR] */
-        J[3528] -= dqdci;             /* dwdot[C2H4]/d[AR] */
-        J[3553] += dqdci;             /* dwdot[C3H7]/d[AR] */
-        /* d()/d[C3H7] */
-        dqdci =  - k_r;
-        J[3589] -= dqdci;             /* dwdot[CH3]/d[C3H7] */
-        J[3601] -= dqdci;             /* dwdot[C2H4]/d[C3H7] */
-        J[3626] += dqdci;             /* dwdot[C3H7]/d[C3H7] */
-    }
-    else {
-        dqdc[0] = TB[24][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[24][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*sc[24];
-        dqdc[13] = TB[24][2]*dcdc_fac;
-        dqdc[14] = TB[24][3]*dcdc_fac;
-        dqdc[15] = TB[24][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac + k_f*sc[12];
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[24][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[24][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac - k_r;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+12] -= dqdc[k];
-            J[73*k+24] -= dqdc[k];
-            J[73*k+49] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[12] -= dcdc_fac;
+    Jmix[24] -= dcdc_fac;
+    Jmix[49] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[24][0] - 1)*dcdc_fac;
+    J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
+    J[24] -= dqdci;               /* dwdot[C2H4]/d[H2] */
+    J[49] += dqdci;               /* dwdot[C3H7]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[24][1] - 1)*dcdc_fac;
+    J[377] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[389] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
+    J[414] += dqdci;              /* dwdot[C3H7]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[24];
+    J[888] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[900] -= dqdci;              /* dwdot[C2H4]/d[CH3] */
+    J[925] += dqdci;              /* dwdot[C3H7]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[24][2] - 1)*dcdc_fac;
+    J[961] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[973] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
+    J[998] += dqdci;              /* dwdot[C3H7]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[24][3] - 1)*dcdc_fac;
+    J[1034] -= dqdci;             /* dwdot[CH3]/d[CO] */
+    J[1046] -= dqdci;             /* dwdot[C2H4]/d[CO] */
+    J[1071] += dqdci;             /* dwdot[C3H7]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[24][4] - 1)*dcdc_fac;
+    J[1107] -= dqdci;             /* dwdot[CH3]/d[CO2] */
+    J[1119] -= dqdci;             /* dwdot[C2H4]/d[CO2] */
+    J[1144] += dqdci;             /* dwdot[C3H7]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci =  + k_f*sc[12];
+    J[1764] -= dqdci;             /* dwdot[CH3]/d[C2H4] */
+    J[1776] -= dqdci;             /* dwdot[C2H4]/d[C2H4] */
+    J[1801] += dqdci;             /* dwdot[C3H7]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[24][5] - 1)*dcdc_fac;
+    J[1910] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
+    J[1922] -= dqdci;             /* dwdot[C2H4]/d[C2H6] */
+    J[1947] += dqdci;             /* dwdot[C3H7]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[24][6] - 1)*dcdc_fac;
+    J[3516] -= dqdci;             /* dwdot[CH3]/d[AR] */
+    J[3528] -= dqdci;             /* dwdot[C2H4]/d[AR] */
+    J[3553] += dqdci;             /* dwdot[C3H7]/d[AR] */
+    /* d()/d[C3H7] */
+    dqdci =  - k_r;
+    J[3589] -= dqdci;             /* dwdot[CH3]/d[C3H7] */
+    J[3601] -= dqdci;             /* dwdot[C2H4]/d[C3H7] */
+    J[3626] += dqdci;             /* dwdot[C3H7]/d[C3H7] */
     J[5268] -= dqdT; /* dwdot[CH3]/dT */
     J[5280] -= dqdT; /* dwdot[C2H4]/dT */
     J[5305] += dqdT; /* dwdot[C3H7]/dT */
@@ -41706,11 +40999,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[25][0] - 1)*sc[0] + (TB[25][1] - 1)*sc[5] + (TB[25][2] - 1)*sc[13] + (TB[25][3] - 1)*sc[14] + (TB[25][4] - 1)*sc[15] + (TB[25][5] - 1)*sc[26] + (TB[25][6] - 1)*sc[48];
+    alpha = (memcmp(TB[25], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[25][0] - 1)*sc[0] + (TB[25][1] - 1)*sc[5] + (TB[25][2] - 1)*sc[13] + (TB[25][3] - 1)*sc[14] + (TB[25][4] - 1)*sc[15] + (TB[25][5] - 1)*sc[26] + (TB[25][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[1]*sc[49];
-    k_f = prefactor_units[25] * fwd_A[25]
-                * exp(fwd_beta[25] * tc[0] - activation_units[25] * fwd_Ea[25] * invT);
+    k_f = k_f_s[25];
     dlnkfdT = fwd_beta[25] * invT + activation_units[25] * fwd_Ea[25] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[25] * exp(low_beta[25] * tc[0] - activation_units[25] * low_Ea[25] * invT);
@@ -41726,16 +41018,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[25] == 4 ? exp(-troe_Tss[25] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[25]) > 1.e-100 ? -Fcent1/troe_Tsss[25] : 0.)
+      + (fabs(troe_Ts[25]) > 1.e-100 ? -Fcent2/troe_Ts[25] : 0.)
+      + (troe_len[25] == 4 ? Fcent3*troe_Tss[25]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[25]) > 1.e-100 ? -Fcent1/troe_Tsss[25] : 0.)
-      + (fabs(troe_Ts[25]) > 1.e-100 ? -Fcent2/troe_Ts[25] : 0.)
-      + (troe_len[25] == 4 ? Fcent3*troe_Tss[25]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -41743,7 +41035,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[50];
-    Kc = refCinv * exp(g_RT[1] + g_RT[49] - g_RT[50]);
+    Kc = Kc_s[25];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[49]) + (h_RT[50]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41761,137 +41053,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[25][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[49] -= dqdci;               /* dwdot[C3H7]/d[H2] */
-        J[50] += dqdci;               /* dwdot[C3H8]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[49];
-        J[74] -= dqdci;               /* dwdot[H]/d[H] */
-        J[122] -= dqdci;              /* dwdot[C3H7]/d[H] */
-        J[123] += dqdci;              /* dwdot[C3H8]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[25][1] - 1)*dcdc_fac;
-        J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[414] -= dqdci;              /* dwdot[C3H7]/d[H2O] */
-        J[415] += dqdci;              /* dwdot[C3H8]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[25][2] - 1)*dcdc_fac;
-        J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[998] -= dqdci;              /* dwdot[C3H7]/d[CH4] */
-        J[999] += dqdci;              /* dwdot[C3H8]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[25][3] - 1)*dcdc_fac;
-        J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1071] -= dqdci;             /* dwdot[C3H7]/d[CO] */
-        J[1072] += dqdci;             /* dwdot[C3H8]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[25][4] - 1)*dcdc_fac;
-        J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1144] -= dqdci;             /* dwdot[C3H7]/d[CO2] */
-        J[1145] += dqdci;             /* dwdot[C3H8]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[25][5] - 1)*dcdc_fac;
-        J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1947] -= dqdci;             /* dwdot[C3H7]/d[C2H6] */
-        J[1948] += dqdci;             /* dwdot[C3H8]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[25][6] - 1)*dcdc_fac;
-        J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[3553] -= dqdci;             /* dwdot[C3H7]/d[AR] */
-        J[3554] += dqdci;             /* dwdot[C3H8]/d[AR] */
-        /* d()/d[C3H7] */
-        dqdci =  + k_f*sc[1];
-        J[3578] -= dqdci;             /* dwdot[H]/d[C3H7] */
-        J[3626] -= dqdci;             /* dwdot[C3H7]/d[C3H7] */
-        J[3627] += dqdci;             /* dwdot[C3H8]/d[C3H7] */
-        /* d()/d[C3H8] */
-        dqdci =  - k_r;
-        J[3651] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[3699] -= dqdci;             /* dwdot[C3H7]/d[C3H8] */
-        J[3700] += dqdci;             /* dwdot[C3H8]/d[C3H8] */
-    }
-    else {
-        dqdc[0] = TB[25][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[49];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[25][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[25][2]*dcdc_fac;
-        dqdc[14] = TB[25][3]*dcdc_fac;
-        dqdc[15] = TB[25][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[25][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[25][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac + k_f*sc[1];
-        dqdc[50] = dcdc_fac - k_r;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+1] -= dqdc[k];
-            J[73*k+49] -= dqdc[k];
-            J[73*k+50] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[49] -= dcdc_fac;
+    Jmix[50] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[25][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[49] -= dqdci;               /* dwdot[C3H7]/d[H2] */
+    J[50] += dqdci;               /* dwdot[C3H8]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[49];
+    J[74] -= dqdci;               /* dwdot[H]/d[H] */
+    J[122] -= dqdci;              /* dwdot[C3H7]/d[H] */
+    J[123] += dqdci;              /* dwdot[C3H8]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[25][1] - 1)*dcdc_fac;
+    J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[414] -= dqdci;              /* dwdot[C3H7]/d[H2O] */
+    J[415] += dqdci;              /* dwdot[C3H8]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[25][2] - 1)*dcdc_fac;
+    J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[998] -= dqdci;              /* dwdot[C3H7]/d[CH4] */
+    J[999] += dqdci;              /* dwdot[C3H8]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[25][3] - 1)*dcdc_fac;
+    J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1071] -= dqdci;             /* dwdot[C3H7]/d[CO] */
+    J[1072] += dqdci;             /* dwdot[C3H8]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[25][4] - 1)*dcdc_fac;
+    J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1144] -= dqdci;             /* dwdot[C3H7]/d[CO2] */
+    J[1145] += dqdci;             /* dwdot[C3H8]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[25][5] - 1)*dcdc_fac;
+    J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1947] -= dqdci;             /* dwdot[C3H7]/d[C2H6] */
+    J[1948] += dqdci;             /* dwdot[C3H8]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[25][6] - 1)*dcdc_fac;
+    J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[3553] -= dqdci;             /* dwdot[C3H7]/d[AR] */
+    J[3554] += dqdci;             /* dwdot[C3H8]/d[AR] */
+    /* d()/d[C3H7] */
+    dqdci =  + k_f*sc[1];
+    J[3578] -= dqdci;             /* dwdot[H]/d[C3H7] */
+    J[3626] -= dqdci;             /* dwdot[C3H7]/d[C3H7] */
+    J[3627] += dqdci;             /* dwdot[C3H8]/d[C3H7] */
+    /* d()/d[C3H8] */
+    dqdci =  - k_r;
+    J[3651] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[3699] -= dqdci;             /* dwdot[C3H7]/d[C3H8] */
+    J[3700] += dqdci;             /* dwdot[C3H8]/d[C3H8] */
     J[5257] -= dqdT; /* dwdot[H]/dT */
     J[5305] -= dqdT; /* dwdot[C3H7]/dT */
     J[5306] += dqdT; /* dwdot[C3H8]/dT */
@@ -41903,8 +41118,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[26][0] - 1)*sc[0] + (TB[26][1] - 1)*sc[3] + (TB[26][2] - 1)*sc[5] + (TB[26][3] - 1)*sc[13] + (TB[26][4] - 1)*sc[14] + (TB[26][5] - 1)*sc[15] + (TB[26][6] - 1)*sc[26] + (TB[26][7] - 1)*sc[48];
     /* forward */
     phi_f = sc[2]*sc[14];
-    k_f = prefactor_units[26] * fwd_A[26]
-                * exp(fwd_beta[26] * tc[0] - activation_units[26] * fwd_Ea[26] * invT);
+    k_f = k_f_s[26];
     dlnkfdT = fwd_beta[26] * invT + activation_units[26] * fwd_Ea[26] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[26] * exp(low_beta[26] * tc[0] - activation_units[26] * low_Ea[26] * invT);
@@ -41919,7 +41133,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = 0.0;
     /* reverse */
     phi_r = sc[15];
-    Kc = refCinv * exp(g_RT[2] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[26];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[14]) + (h_RT[15]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41937,132 +41151,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[26][0] - 1)*dcdc_fac;
-        J[2] -= dqdci;                /* dwdot[O]/d[H2] */
-        J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
-        J[15] += dqdci;               /* dwdot[CO2]/d[H2] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[14];
-        J[148] -= dqdci;              /* dwdot[O]/d[O] */
-        J[160] -= dqdci;              /* dwdot[CO]/d[O] */
-        J[161] += dqdci;              /* dwdot[CO2]/d[O] */
-        /* d()/d[O2] */
-        dqdci = (TB[26][1] - 1)*dcdc_fac;
-        J[221] -= dqdci;              /* dwdot[O]/d[O2] */
-        J[233] -= dqdci;              /* dwdot[CO]/d[O2] */
-        J[234] += dqdci;              /* dwdot[CO2]/d[O2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[26][2] - 1)*dcdc_fac;
-        J[367] -= dqdci;              /* dwdot[O]/d[H2O] */
-        J[379] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[380] += dqdci;              /* dwdot[CO2]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[26][3] - 1)*dcdc_fac;
-        J[951] -= dqdci;              /* dwdot[O]/d[CH4] */
-        J[963] -= dqdci;              /* dwdot[CO]/d[CH4] */
-        J[964] += dqdci;              /* dwdot[CO2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[26][4] - 1)*dcdc_fac + k_f*sc[2];
-        J[1024] -= dqdci;             /* dwdot[O]/d[CO] */
-        J[1036] -= dqdci;             /* dwdot[CO]/d[CO] */
-        J[1037] += dqdci;             /* dwdot[CO2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[26][5] - 1)*dcdc_fac - k_r;
-        J[1097] -= dqdci;             /* dwdot[O]/d[CO2] */
-        J[1109] -= dqdci;             /* dwdot[CO]/d[CO2] */
-        J[1110] += dqdci;             /* dwdot[CO2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[26][6] - 1)*dcdc_fac;
-        J[1900] -= dqdci;             /* dwdot[O]/d[C2H6] */
-        J[1912] -= dqdci;             /* dwdot[CO]/d[C2H6] */
-        J[1913] += dqdci;             /* dwdot[CO2]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[26][7] - 1)*dcdc_fac;
-        J[3506] -= dqdci;             /* dwdot[O]/d[AR] */
-        J[3518] -= dqdci;             /* dwdot[CO]/d[AR] */
-        J[3519] += dqdci;             /* dwdot[CO2]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[26][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*sc[14];
-        dqdc[3] = TB[26][1]*dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[26][2]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[26][3]*dcdc_fac;
-        dqdc[14] = TB[26][4]*dcdc_fac + k_f*sc[2];
-        dqdc[15] = TB[26][5]*dcdc_fac - k_r;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[26][6]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[26][7]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+2] -= dqdc[k];
-            J[73*k+14] -= dqdc[k];
-            J[73*k+15] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] -= dcdc_fac;
+    Jmix[14] -= dcdc_fac;
+    Jmix[15] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[26][0] - 1)*dcdc_fac;
+    J[2] -= dqdci;                /* dwdot[O]/d[H2] */
+    J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
+    J[15] += dqdci;               /* dwdot[CO2]/d[H2] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[14];
+    J[148] -= dqdci;              /* dwdot[O]/d[O] */
+    J[160] -= dqdci;              /* dwdot[CO]/d[O] */
+    J[161] += dqdci;              /* dwdot[CO2]/d[O] */
+    /* d()/d[O2] */
+    dqdci = (TB[26][1] - 1)*dcdc_fac;
+    J[221] -= dqdci;              /* dwdot[O]/d[O2] */
+    J[233] -= dqdci;              /* dwdot[CO]/d[O2] */
+    J[234] += dqdci;              /* dwdot[CO2]/d[O2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[26][2] - 1)*dcdc_fac;
+    J[367] -= dqdci;              /* dwdot[O]/d[H2O] */
+    J[379] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[380] += dqdci;              /* dwdot[CO2]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[26][3] - 1)*dcdc_fac;
+    J[951] -= dqdci;              /* dwdot[O]/d[CH4] */
+    J[963] -= dqdci;              /* dwdot[CO]/d[CH4] */
+    J[964] += dqdci;              /* dwdot[CO2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[26][4] - 1)*dcdc_fac + k_f*sc[2];
+    J[1024] -= dqdci;             /* dwdot[O]/d[CO] */
+    J[1036] -= dqdci;             /* dwdot[CO]/d[CO] */
+    J[1037] += dqdci;             /* dwdot[CO2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[26][5] - 1)*dcdc_fac - k_r;
+    J[1097] -= dqdci;             /* dwdot[O]/d[CO2] */
+    J[1109] -= dqdci;             /* dwdot[CO]/d[CO2] */
+    J[1110] += dqdci;             /* dwdot[CO2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[26][6] - 1)*dcdc_fac;
+    J[1900] -= dqdci;             /* dwdot[O]/d[C2H6] */
+    J[1912] -= dqdci;             /* dwdot[CO]/d[C2H6] */
+    J[1913] += dqdci;             /* dwdot[CO2]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[26][7] - 1)*dcdc_fac;
+    J[3506] -= dqdci;             /* dwdot[O]/d[AR] */
+    J[3518] -= dqdci;             /* dwdot[CO]/d[AR] */
+    J[3519] += dqdci;             /* dwdot[CO2]/d[AR] */
     J[5258] -= dqdT; /* dwdot[O]/dT */
     J[5270] -= dqdT; /* dwdot[CO]/dT */
     J[5271] += dqdT; /* dwdot[CO2]/dT */
@@ -42074,8 +41211,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[27][0] - 1)*sc[0] + (TB[27][1] - 1)*sc[5] + (TB[27][2] - 1)*sc[13] + (TB[27][3] - 1)*sc[14] + (TB[27][4] - 1)*sc[15] + (TB[27][5] - 1)*sc[26] + (TB[27][6] - 1)*sc[48];
     /* forward */
     phi_f = sc[37];
-    k_f = prefactor_units[27] * fwd_A[27]
-                * exp(fwd_beta[27] * tc[0] - activation_units[27] * fwd_Ea[27] * invT);
+    k_f = k_f_s[27];
     dlnkfdT = fwd_beta[27] * invT + activation_units[27] * fwd_Ea[27] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[27] * exp(low_beta[27] * tc[0] - activation_units[27] * low_Ea[27] * invT);
@@ -42090,7 +41226,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = 0.0;
     /* reverse */
     phi_r = sc[2]*sc[47];
-    Kc = refC * exp(-g_RT[2] + g_RT[37] - g_RT[47]);
+    Kc = Kc_s[27];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[37]) + (h_RT[2] + h_RT[47]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42108,137 +41244,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[27][0] - 1)*dcdc_fac;
-        J[2] += dqdci;                /* dwdot[O]/d[H2] */
-        J[37] -= dqdci;               /* dwdot[N2O]/d[H2] */
-        J[47] += dqdci;               /* dwdot[N2]/d[H2] */
-        /* d()/d[O] */
-        dqdci =  - k_r*sc[47];
-        J[148] += dqdci;              /* dwdot[O]/d[O] */
-        J[183] -= dqdci;              /* dwdot[N2O]/d[O] */
-        J[193] += dqdci;              /* dwdot[N2]/d[O] */
-        /* d()/d[H2O] */
-        dqdci = (TB[27][1] - 1)*dcdc_fac;
-        J[367] += dqdci;              /* dwdot[O]/d[H2O] */
-        J[402] -= dqdci;              /* dwdot[N2O]/d[H2O] */
-        J[412] += dqdci;              /* dwdot[N2]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[27][2] - 1)*dcdc_fac;
-        J[951] += dqdci;              /* dwdot[O]/d[CH4] */
-        J[986] -= dqdci;              /* dwdot[N2O]/d[CH4] */
-        J[996] += dqdci;              /* dwdot[N2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[27][3] - 1)*dcdc_fac;
-        J[1024] += dqdci;             /* dwdot[O]/d[CO] */
-        J[1059] -= dqdci;             /* dwdot[N2O]/d[CO] */
-        J[1069] += dqdci;             /* dwdot[N2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[27][4] - 1)*dcdc_fac;
-        J[1097] += dqdci;             /* dwdot[O]/d[CO2] */
-        J[1132] -= dqdci;             /* dwdot[N2O]/d[CO2] */
-        J[1142] += dqdci;             /* dwdot[N2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[27][5] - 1)*dcdc_fac;
-        J[1900] += dqdci;             /* dwdot[O]/d[C2H6] */
-        J[1935] -= dqdci;             /* dwdot[N2O]/d[C2H6] */
-        J[1945] += dqdci;             /* dwdot[N2]/d[C2H6] */
-        /* d()/d[N2O] */
-        dqdci =  + k_f;
-        J[2703] += dqdci;             /* dwdot[O]/d[N2O] */
-        J[2738] -= dqdci;             /* dwdot[N2O]/d[N2O] */
-        J[2748] += dqdci;             /* dwdot[N2]/d[N2O] */
-        /* d()/d[N2] */
-        dqdci =  - k_r*sc[2];
-        J[3433] += dqdci;             /* dwdot[O]/d[N2] */
-        J[3468] -= dqdci;             /* dwdot[N2O]/d[N2] */
-        J[3478] += dqdci;             /* dwdot[N2]/d[N2] */
-        /* d()/d[AR] */
-        dqdci = (TB[27][6] - 1)*dcdc_fac;
-        J[3506] += dqdci;             /* dwdot[O]/d[AR] */
-        J[3541] -= dqdci;             /* dwdot[N2O]/d[AR] */
-        J[3551] += dqdci;             /* dwdot[N2]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[27][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac - k_r*sc[47];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[27][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[27][2]*dcdc_fac;
-        dqdc[14] = TB[27][3]*dcdc_fac;
-        dqdc[15] = TB[27][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[27][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac + k_f;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac - k_r*sc[2];
-        dqdc[48] = TB[27][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+2] += dqdc[k];
-            J[73*k+37] -= dqdc[k];
-            J[73*k+47] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] += dcdc_fac;
+    Jmix[37] -= dcdc_fac;
+    Jmix[47] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[27][0] - 1)*dcdc_fac;
+    J[2] += dqdci;                /* dwdot[O]/d[H2] */
+    J[37] -= dqdci;               /* dwdot[N2O]/d[H2] */
+    J[47] += dqdci;               /* dwdot[N2]/d[H2] */
+    /* d()/d[O] */
+    dqdci =  - k_r*sc[47];
+    J[148] += dqdci;              /* dwdot[O]/d[O] */
+    J[183] -= dqdci;              /* dwdot[N2O]/d[O] */
+    J[193] += dqdci;              /* dwdot[N2]/d[O] */
+    /* d()/d[H2O] */
+    dqdci = (TB[27][1] - 1)*dcdc_fac;
+    J[367] += dqdci;              /* dwdot[O]/d[H2O] */
+    J[402] -= dqdci;              /* dwdot[N2O]/d[H2O] */
+    J[412] += dqdci;              /* dwdot[N2]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[27][2] - 1)*dcdc_fac;
+    J[951] += dqdci;              /* dwdot[O]/d[CH4] */
+    J[986] -= dqdci;              /* dwdot[N2O]/d[CH4] */
+    J[996] += dqdci;              /* dwdot[N2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[27][3] - 1)*dcdc_fac;
+    J[1024] += dqdci;             /* dwdot[O]/d[CO] */
+    J[1059] -= dqdci;             /* dwdot[N2O]/d[CO] */
+    J[1069] += dqdci;             /* dwdot[N2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[27][4] - 1)*dcdc_fac;
+    J[1097] += dqdci;             /* dwdot[O]/d[CO2] */
+    J[1132] -= dqdci;             /* dwdot[N2O]/d[CO2] */
+    J[1142] += dqdci;             /* dwdot[N2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[27][5] - 1)*dcdc_fac;
+    J[1900] += dqdci;             /* dwdot[O]/d[C2H6] */
+    J[1935] -= dqdci;             /* dwdot[N2O]/d[C2H6] */
+    J[1945] += dqdci;             /* dwdot[N2]/d[C2H6] */
+    /* d()/d[N2O] */
+    dqdci =  + k_f;
+    J[2703] += dqdci;             /* dwdot[O]/d[N2O] */
+    J[2738] -= dqdci;             /* dwdot[N2O]/d[N2O] */
+    J[2748] += dqdci;             /* dwdot[N2]/d[N2O] */
+    /* d()/d[N2] */
+    dqdci =  - k_r*sc[2];
+    J[3433] += dqdci;             /* dwdot[O]/d[N2] */
+    J[3468] -= dqdci;             /* dwdot[N2O]/d[N2] */
+    J[3478] += dqdci;             /* dwdot[N2]/d[N2] */
+    /* d()/d[AR] */
+    dqdci = (TB[27][6] - 1)*dcdc_fac;
+    J[3506] += dqdci;             /* dwdot[O]/d[AR] */
+    J[3541] -= dqdci;             /* dwdot[N2O]/d[AR] */
+    J[3551] += dqdci;             /* dwdot[N2]/d[AR] */
     J[5258] += dqdT; /* dwdot[O]/dT */
     J[5293] -= dqdT; /* dwdot[N2O]/dT */
     J[5303] += dqdT; /* dwdot[N2]/dT */
@@ -42247,11 +41306,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[28][0] - 1)*sc[0] + (TB[28][1] - 1)*sc[5] + (TB[28][2] - 1)*sc[13] + (TB[28][3] - 1)*sc[14] + (TB[28][4] - 1)*sc[15] + (TB[28][5] - 1)*sc[26] + (TB[28][6] - 1)*sc[48];
+    alpha = (memcmp(TB[28], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[28][0] - 1)*sc[0] + (TB[28][1] - 1)*sc[5] + (TB[28][2] - 1)*sc[13] + (TB[28][3] - 1)*sc[14] + (TB[28][4] - 1)*sc[15] + (TB[28][5] - 1)*sc[26] + (TB[28][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[1]*sc[40];
-    k_f = prefactor_units[28] * fwd_A[28]
-                * exp(fwd_beta[28] * tc[0] - activation_units[28] * fwd_Ea[28] * invT);
+    k_f = k_f_s[28];
     dlnkfdT = fwd_beta[28] * invT + activation_units[28] * fwd_Ea[28] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[28] * exp(low_beta[28] * tc[0] - activation_units[28] * low_Ea[28] * invT);
@@ -42266,7 +41324,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = 0.0;
     /* reverse */
     phi_r = sc[41];
-    Kc = refCinv * exp(g_RT[1] + g_RT[40] - g_RT[41]);
+    Kc = Kc_s[28];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[40]) + (h_RT[41]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42284,137 +41342,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[28][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[40] -= dqdci;               /* dwdot[HCN]/d[H2] */
-        J[41] += dqdci;               /* dwdot[H2CN]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[40];
-        J[74] -= dqdci;               /* dwdot[H]/d[H] */
-        J[113] -= dqdci;              /* dwdot[HCN]/d[H] */
-        J[114] += dqdci;              /* dwdot[H2CN]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[28][1] - 1)*dcdc_fac;
-        J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[405] -= dqdci;              /* dwdot[HCN]/d[H2O] */
-        J[406] += dqdci;              /* dwdot[H2CN]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[28][2] - 1)*dcdc_fac;
-        J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[989] -= dqdci;              /* dwdot[HCN]/d[CH4] */
-        J[990] += dqdci;              /* dwdot[H2CN]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[28][3] - 1)*dcdc_fac;
-        J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1062] -= dqdci;             /* dwdot[HCN]/d[CO] */
-        J[1063] += dqdci;             /* dwdot[H2CN]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[28][4] - 1)*dcdc_fac;
-        J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1135] -= dqdci;             /* dwdot[HCN]/d[CO2] */
-        J[1136] += dqdci;             /* dwdot[H2CN]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[28][5] - 1)*dcdc_fac;
-        J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1938] -= dqdci;             /* dwdot[HCN]/d[C2H6] */
-        J[1939] += dqdci;             /* dwdot[H2CN]/d[C2H6] */
-        /* d()/d[HCN] */
-        dqdci =  + k_f*sc[1];
-        J[2921] -= dqdci;             /* dwdot[H]/d[HCN] */
-        J[2960] -= dqdci;             /* dwdot[HCN]/d[HCN] */
-        J[2961] += dqdci;             /* dwdot[H2CN]/d[HCN] */
-        /* d()/d[H2CN] */
-        dqdci =  - k_r;
-        J[2994] -= dqdci;             /* dwdot[H]/d[H2CN] */
-        J[3033] -= dqdci;             /* dwdot[HCN]/d[H2CN] */
-        J[3034] += dqdci;             /* dwdot[H2CN]/d[H2CN] */
-        /* d()/d[AR] */
-        dqdci = (TB[28][6] - 1)*dcdc_fac;
-        J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[3544] -= dqdci;             /* dwdot[HCN]/d[AR] */
-        J[3545] += dqdci;             /* dwdot[H2CN]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[28][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[40];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[28][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[28][2]*dcdc_fac;
-        dqdc[14] = TB[28][3]*dcdc_fac;
-        dqdc[15] = TB[28][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[28][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac + k_f*sc[1];
-        dqdc[41] = dcdc_fac - k_r;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[28][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+1] -= dqdc[k];
-            J[73*k+40] -= dqdc[k];
-            J[73*k+41] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[40] -= dcdc_fac;
+    Jmix[41] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[28][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[40] -= dqdci;               /* dwdot[HCN]/d[H2] */
+    J[41] += dqdci;               /* dwdot[H2CN]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[40];
+    J[74] -= dqdci;               /* dwdot[H]/d[H] */
+    J[113] -= dqdci;              /* dwdot[HCN]/d[H] */
+    J[114] += dqdci;              /* dwdot[H2CN]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[28][1] - 1)*dcdc_fac;
+    J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[405] -= dqdci;              /* dwdot[HCN]/d[H2O] */
+    J[406] += dqdci;              /* dwdot[H2CN]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[28][2] - 1)*dcdc_fac;
+    J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[989] -= dqdci;              /* dwdot[HCN]/d[CH4] */
+    J[990] += dqdci;              /* dwdot[H2CN]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[28][3] - 1)*dcdc_fac;
+    J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1062] -= dqdci;             /* dwdot[HCN]/d[CO] */
+    J[1063] += dqdci;             /* dwdot[H2CN]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[28][4] - 1)*dcdc_fac;
+    J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1135] -= dqdci;             /* dwdot[HCN]/d[CO2] */
+    J[1136] += dqdci;             /* dwdot[H2CN]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[28][5] - 1)*dcdc_fac;
+    J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1938] -= dqdci;             /* dwdot[HCN]/d[C2H6] */
+    J[1939] += dqdci;             /* dwdot[H2CN]/d[C2H6] */
+    /* d()/d[HCN] */
+    dqdci =  + k_f*sc[1];
+    J[2921] -= dqdci;             /* dwdot[H]/d[HCN] */
+    J[2960] -= dqdci;             /* dwdot[HCN]/d[HCN] */
+    J[2961] += dqdci;             /* dwdot[H2CN]/d[HCN] */
+    /* d()/d[H2CN] */
+    dqdci =  - k_r;
+    J[2994] -= dqdci;             /* dwdot[H]/d[H2CN] */
+    J[3033] -= dqdci;             /* dwdot[HCN]/d[H2CN] */
+    J[3034] += dqdci;             /* dwdot[H2CN]/d[H2CN] */
+    /* d()/d[AR] */
+    dqdci = (TB[28][6] - 1)*dcdc_fac;
+    J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[3544] -= dqdci;             /* dwdot[HCN]/d[AR] */
+    J[3545] += dqdci;             /* dwdot[H2CN]/d[AR] */
     J[5257] -= dqdT; /* dwdot[H]/dT */
     J[5296] -= dqdT; /* dwdot[HCN]/dT */
     J[5297] += dqdT; /* dwdot[H2CN]/dT */
@@ -42423,11 +41404,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[29][0] - 1)*sc[0] + (TB[29][1] - 1)*sc[5] + (TB[29][2] - 1)*sc[13] + (TB[29][3] - 1)*sc[14] + (TB[29][4] - 1)*sc[15] + (TB[29][5] - 1)*sc[26] + (TB[29][6] - 1)*sc[56] + (TB[29][7] - 1)*sc[57] + (TB[29][8] - 1)*sc[58] + (TB[29][9] - 1)*sc[53];
+    alpha = alpha_eff2;
     /* forward */
     phi_f = sc[56];
-    k_f = prefactor_units[29] * fwd_A[29]
-                * exp(fwd_beta[29] * tc[0] - activation_units[29] * fwd_Ea[29] * invT);
+    k_f = k_f_s[29];
     dlnkfdT = fwd_beta[29] * invT + activation_units[29] * fwd_Ea[29] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[29] * exp(low_beta[29] * tc[0] - activation_units[29] * low_Ea[29] * invT);
@@ -42442,7 +41422,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = 0.0;
     /* reverse */
     phi_r = sc[11]*sc[53];
-    Kc = refC * exp(-g_RT[11] - g_RT[53] + g_RT[56]);
+    Kc = Kc_s[29];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[56]) + (h_RT[11] + h_RT[53]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42460,142 +41440,65 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[29][0] - 1)*dcdc_fac;
-        J[11] += dqdci;               /* dwdot[CH2(S)]/d[H2] */
-        J[53] += dqdci;               /* dwdot[HF]/d[H2] */
-        J[56] -= dqdci;               /* dwdot[CH3F]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[29][1] - 1)*dcdc_fac;
-        J[376] += dqdci;              /* dwdot[CH2(S)]/d[H2O] */
-        J[418] += dqdci;              /* dwdot[HF]/d[H2O] */
-        J[421] -= dqdci;              /* dwdot[CH3F]/d[H2O] */
-        /* d()/d[CH2(S)] */
-        dqdci =  - k_r*sc[53];
-        J[814] += dqdci;              /* dwdot[CH2(S)]/d[CH2(S)] */
-        J[856] += dqdci;              /* dwdot[HF]/d[CH2(S)] */
-        J[859] -= dqdci;              /* dwdot[CH3F]/d[CH2(S)] */
-        /* d()/d[CH4] */
-        dqdci = (TB[29][2] - 1)*dcdc_fac;
-        J[960] += dqdci;              /* dwdot[CH2(S)]/d[CH4] */
-        J[1002] += dqdci;             /* dwdot[HF]/d[CH4] */
-        J[1005] -= dqdci;             /* dwdot[CH3F]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[29][3] - 1)*dcdc_fac;
-        J[1033] += dqdci;             /* dwdot[CH2(S)]/d[CO] */
-        J[1075] += dqdci;             /* dwdot[HF]/d[CO] */
-        J[1078] -= dqdci;             /* dwdot[CH3F]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[29][4] - 1)*dcdc_fac;
-        J[1106] += dqdci;             /* dwdot[CH2(S)]/d[CO2] */
-        J[1148] += dqdci;             /* dwdot[HF]/d[CO2] */
-        J[1151] -= dqdci;             /* dwdot[CH3F]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[29][5] - 1)*dcdc_fac;
-        J[1909] += dqdci;             /* dwdot[CH2(S)]/d[C2H6] */
-        J[1951] += dqdci;             /* dwdot[HF]/d[C2H6] */
-        J[1954] -= dqdci;             /* dwdot[CH3F]/d[C2H6] */
-        /* d()/d[HF] */
-        dqdci = (TB[29][9] - 1)*dcdc_fac - k_r*sc[11];
-        J[3880] += dqdci;             /* dwdot[CH2(S)]/d[HF] */
-        J[3922] += dqdci;             /* dwdot[HF]/d[HF] */
-        J[3925] -= dqdci;             /* dwdot[CH3F]/d[HF] */
-        /* d()/d[CH3F] */
-        dqdci = (TB[29][6] - 1)*dcdc_fac + k_f;
-        J[4099] += dqdci;             /* dwdot[CH2(S)]/d[CH3F] */
-        J[4141] += dqdci;             /* dwdot[HF]/d[CH3F] */
-        J[4144] -= dqdci;             /* dwdot[CH3F]/d[CH3F] */
-        /* d()/d[CH2F2] */
-        dqdci = (TB[29][7] - 1)*dcdc_fac;
-        J[4172] += dqdci;             /* dwdot[CH2(S)]/d[CH2F2] */
-        J[4214] += dqdci;             /* dwdot[HF]/d[CH2F2] */
-        J[4217] -= dqdci;             /* dwdot[CH3F]/d[CH2F2] */
-        /* d()/d[CHF3] */
-        dqdci = (TB[29][8] - 1)*dcdc_fac;
-        J[4245] += dqdci;             /* dwdot[CH2(S)]/d[CHF3] */
-        J[4287] += dqdci;             /* dwdot[HF]/d[CHF3] */
-        J[4290] -= dqdci;             /* dwdot[CH3F]/d[CHF3] */
-    }
-    else {
-        dqdc[0] = TB[29][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[29][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac - k_r*sc[53];
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[29][2]*dcdc_fac;
-        dqdc[14] = TB[29][3]*dcdc_fac;
-        dqdc[15] = TB[29][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[29][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = TB[29][9]*dcdc_fac - k_r*sc[11];
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = TB[29][6]*dcdc_fac + k_f;
-        dqdc[57] = TB[29][7]*dcdc_fac;
-        dqdc[58] = TB[29][8]*dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+11] += dqdc[k];
-            J[73*k+53] += dqdc[k];
-            J[73*k+56] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[11] += dcdc_fac;
+    Jmix[53] += dcdc_fac;
+    Jmix[56] -= dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[29][0] - 1)*dcdc_fac;
+    J[11] += dqdci;               /* dwdot[CH2(S)]/d[H2] */
+    J[53] += dqdci;               /* dwdot[HF]/d[H2] */
+    J[56] -= dqdci;               /* dwdot[CH3F]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[29][1] - 1)*dcdc_fac;
+    J[376] += dqdci;              /* dwdot[CH2(S)]/d[H2O] */
+    J[418] += dqdci;              /* dwdot[HF]/d[H2O] */
+    J[421] -= dqdci;              /* dwdot[CH3F]/d[H2O] */
+    /* d()/d[CH2(S)] */
+    dqdci =  - k_r*sc[53];
+    J[814] += dqdci;              /* dwdot[CH2(S)]/d[CH2(S)] */
+    J[856] += dqdci;              /* dwdot[HF]/d[CH2(S)] */
+    J[859] -= dqdci;              /* dwdot[CH3F]/d[CH2(S)] */
+    /* d()/d[CH4] */
+    dqdci = (TB[29][2] - 1)*dcdc_fac;
+    J[960] += dqdci;              /* dwdot[CH2(S)]/d[CH4] */
+    J[1002] += dqdci;             /* dwdot[HF]/d[CH4] */
+    J[1005] -= dqdci;             /* dwdot[CH3F]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[29][3] - 1)*dcdc_fac;
+    J[1033] += dqdci;             /* dwdot[CH2(S)]/d[CO] */
+    J[1075] += dqdci;             /* dwdot[HF]/d[CO] */
+    J[1078] -= dqdci;             /* dwdot[CH3F]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[29][4] - 1)*dcdc_fac;
+    J[1106] += dqdci;             /* dwdot[CH2(S)]/d[CO2] */
+    J[1148] += dqdci;             /* dwdot[HF]/d[CO2] */
+    J[1151] -= dqdci;             /* dwdot[CH3F]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[29][5] - 1)*dcdc_fac;
+    J[1909] += dqdci;             /* dwdot[CH2(S)]/d[C2H6] */
+    J[1951] += dqdci;             /* dwdot[HF]/d[C2H6] */
+    J[1954] -= dqdci;             /* dwdot[CH3F]/d[C2H6] */
+    /* d()/d[HF] */
+    dqdci = (TB[29][9] - 1)*dcdc_fac - k_r*sc[11];
+    J[3880] += dqdci;             /* dwdot[CH2(S)]/d[HF] */
+    J[3922] += dqdci;             /* dwdot[HF]/d[HF] */
+    J[3925] -= dqdci;             /* dwdot[CH3F]/d[HF] */
+    /* d()/d[CH3F] */
+    dqdci = (TB[29][6] - 1)*dcdc_fac + k_f;
+    J[4099] += dqdci;             /* dwdot[CH2(S)]/d[CH3F] */
+    J[4141] += dqdci;             /* dwdot[HF]/d[CH3F] */
+    J[4144] -= dqdci;             /* dwdot[CH3F]/d[CH3F] */
+    /* d()/d[CH2F2] */
+    dqdci = (TB[29][7] - 1)*dcdc_fac;
+    J[4172] += dqdci;             /* dwdot[CH2(S)]/d[CH2F2] */
+    J[4214] += dqdci;             /* dwdot[HF]/d[CH2F2] */
+    J[4217] -= dqdci;             /* dwdot[CH3F]/d[CH2F2] */
+    /* d()/d[CHF3] */
+    dqdci = (TB[29][8] - 1)*dcdc_fac;
+    J[4245] += dqdci;             /* dwdot[CH2(S)]/d[CHF3] */
+    J[4287] += dqdci;             /* dwdot[HF]/d[CHF3] */
+    J[4290] -= dqdci;             /* dwdot[CH3F]/d[CHF3] */
     J[5267] += dqdT; /* dwdot[CH2(S)]/dT */
     J[5309] += dqdT; /* dwdot[HF]/dT */
     J[5312] -= dqdT; /* dwdot[CH3F]/dT */
@@ -42607,8 +41510,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[30][0] - 1)*sc[0] + (TB[30][1] - 1)*sc[5] + (TB[30][2] - 1)*sc[13] + (TB[30][3] - 1)*sc[14] + (TB[30][4] - 1)*sc[15] + (TB[30][5] - 1)*sc[26] + (TB[30][6] - 1)*sc[48] + (TB[30][7] - 1)*sc[56] + (TB[30][8] - 1)*sc[57] + (TB[30][9] - 1)*sc[58] + (TB[30][10] - 1)*sc[59] + (TB[30][11] - 1)*sc[53];
     /* forward */
     phi_f = sc[64];
-    k_f = prefactor_units[30] * fwd_A[30]
-                * exp(fwd_beta[30] * tc[0] - activation_units[30] * fwd_Ea[30] * invT);
+    k_f = k_f_s[30];
     dlnkfdT = fwd_beta[30] * invT + activation_units[30] * fwd_Ea[30] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[30] * exp(low_beta[30] * tc[0] - activation_units[30] * low_Ea[30] * invT);
@@ -42623,7 +41525,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = 0.0;
     /* reverse */
     phi_r = sc[54]*sc[65];
-    Kc = refC * exp(-g_RT[54] + g_RT[64] - g_RT[65]);
+    Kc = Kc_s[30];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[64]) + (h_RT[54] + h_RT[65]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42641,162 +41543,85 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[30][0] - 1)*dcdc_fac;
-        J[54] += dqdci;               /* dwdot[F]/d[H2] */
-        J[64] -= dqdci;               /* dwdot[CF2]/d[H2] */
-        J[65] += dqdci;               /* dwdot[CF]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[30][1] - 1)*dcdc_fac;
-        J[419] += dqdci;              /* dwdot[F]/d[H2O] */
-        J[429] -= dqdci;              /* dwdot[CF2]/d[H2O] */
-        J[430] += dqdci;              /* dwdot[CF]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[30][2] - 1)*dcdc_fac;
-        J[1003] += dqdci;             /* dwdot[F]/d[CH4] */
-        J[1013] -= dqdci;             /* dwdot[CF2]/d[CH4] */
-        J[1014] += dqdci;             /* dwdot[CF]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[30][3] - 1)*dcdc_fac;
-        J[1076] += dqdci;             /* dwdot[F]/d[CO] */
-        J[1086] -= dqdci;             /* dwdot[CF2]/d[CO] */
-        J[1087] += dqdci;             /* dwdot[CF]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[30][4] - 1)*dcdc_fac;
-        J[1149] += dqdci;             /* dwdot[F]/d[CO2] */
-        J[1159] -= dqdci;             /* dwdot[CF2]/d[CO2] */
-        J[1160] += dqdci;             /* dwdot[CF]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[30][5] - 1)*dcdc_fac;
-        J[1952] += dqdci;             /* dwdot[F]/d[C2H6] */
-        J[1962] -= dqdci;             /* dwdot[CF2]/d[C2H6] */
-        J[1963] += dqdci;             /* dwdot[CF]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[30][6] - 1)*dcdc_fac;
-        J[3558] += dqdci;             /* dwdot[F]/d[AR] */
-        J[3568] -= dqdci;             /* dwdot[CF2]/d[AR] */
-        J[3569] += dqdci;             /* dwdot[CF]/d[AR] */
-        /* d()/d[HF] */
-        dqdci = (TB[30][11] - 1)*dcdc_fac;
-        J[3923] += dqdci;             /* dwdot[F]/d[HF] */
-        J[3933] -= dqdci;             /* dwdot[CF2]/d[HF] */
-        J[3934] += dqdci;             /* dwdot[CF]/d[HF] */
-        /* d()/d[F] */
-        dqdci =  - k_r*sc[65];
-        J[3996] += dqdci;             /* dwdot[F]/d[F] */
-        J[4006] -= dqdci;             /* dwdot[CF2]/d[F] */
-        J[4007] += dqdci;             /* dwdot[CF]/d[F] */
-        /* d()/d[CH3F] */
-        dqdci = (TB[30][7] - 1)*dcdc_fac;
-        J[4142] += dqdci;             /* dwdot[F]/d[CH3F] */
-        J[4152] -= dqdci;             /* dwdot[CF2]/d[CH3F] */
-        J[4153] += dqdci;             /* dwdot[CF]/d[CH3F] */
-        /* d()/d[CH2F2] */
-        dqdci = (TB[30][8] - 1)*dcdc_fac;
-        J[4215] += dqdci;             /* dwdot[F]/d[CH2F2] */
-        J[4225] -= dqdci;             /* dwdot[CF2]/d[CH2F2] */
-        J[4226] += dqdci;             /* dwdot[CF]/d[CH2F2] */
-        /* d()/d[CHF3] */
-        dqdci = (TB[30][9] - 1)*dcdc_fac;
-        J[4288] += dqdci;             /* dwdot[F]/d[CHF3] */
-        J[4298] -= dqdci;             /* dwdot[CF2]/d[CHF3] */
-        J[4299] += dqdci;             /* dwdot[CF]/d[CHF3] */
-        /* d()/d[CF4] */
-        dqdci = (TB[30][10] - 1)*dcdc_fac;
-        J[4361] += dqdci;             /* dwdot[F]/d[CF4] */
-        J[4371] -= dqdci;             /* dwdot[CF2]/d[CF4] */
-        J[4372] += dqdci;             /* dwdot[CF]/d[CF4] */
-        /* d()/d[CF2] */
-        dqdci =  + k_f;
-        J[4726] += dqdci;             /* dwdot[F]/d[CF2] */
-        J[4736] -= dqdci;             /* dwdot[CF2]/d[CF2] */
-        J[4737] += dqdci;             /* dwdot[CF]/d[CF2] */
-        /* d()/d[CF] */
-        dqdci =  - k_r*sc[54];
-        J[4799] += dqdci;             /* dwdot[F]/d[CF] */
-        J[4809] -= dqdci;             /* dwdot[CF2]/d[CF] */
-        J[4810] += dqdci;             /* dwdot[CF]/d[CF] */
-    }
-    else {
-        dqdc[0] = TB[30][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[30][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[30][2]*dcdc_fac;
-        dqdc[14] = TB[30][3]*dcdc_fac;
-        dqdc[15] = TB[30][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[30][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[30][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = TB[30][11]*dcdc_fac;
-        dqdc[54] = dcdc_fac - k_r*sc[65];
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = TB[30][7]*dcdc_fac;
-        dqdc[57] = TB[30][8]*dcdc_fac;
-        dqdc[58] = TB[30][9]*dcdc_fac;
-        dqdc[59] = TB[30][10]*dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac + k_f;
-        dqdc[65] = dcdc_fac - k_r*sc[54];
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+54] += dqdc[k];
-            J[73*k+64] -= dqdc[k];
-            J[73*k+65] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[54] += dcdc_fac;
+    Jmix[64] -= dcdc_fac;
+    Jmix[65] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[30][0] - 1)*dcdc_fac;
+    J[54] += dqdci;               /* dwdot[F]/d[H2] */
+    J[64] -= dqdci;               /* dwdot[CF2]/d[H2] */
+    J[65] += dqdci;               /* dwdot[CF]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[30][1] - 1)*dcdc_fac;
+    J[419] += dqdci;              /* dwdot[F]/d[H2O] */
+    J[429] -= dqdci;              /* dwdot[CF2]/d[H2O] */
+    J[430] += dqdci;              /* dwdot[CF]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[30][2] - 1)*dcdc_fac;
+    J[1003] += dqdci;             /* dwdot[F]/d[CH4] */
+    J[1013] -= dqdci;             /* dwdot[CF2]/d[CH4] */
+    J[1014] += dqdci;             /* dwdot[CF]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[30][3] - 1)*dcdc_fac;
+    J[1076] += dqdci;             /* dwdot[F]/d[CO] */
+    J[1086] -= dqdci;             /* dwdot[CF2]/d[CO] */
+    J[1087] += dqdci;             /* dwdot[CF]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[30][4] - 1)*dcdc_fac;
+    J[1149] += dqdci;             /* dwdot[F]/d[CO2] */
+    J[1159] -= dqdci;             /* dwdot[CF2]/d[CO2] */
+    J[1160] += dqdci;             /* dwdot[CF]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[30][5] - 1)*dcdc_fac;
+    J[1952] += dqdci;             /* dwdot[F]/d[C2H6] */
+    J[1962] -= dqdci;             /* dwdot[CF2]/d[C2H6] */
+    J[1963] += dqdci;             /* dwdot[CF]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[30][6] - 1)*dcdc_fac;
+    J[3558] += dqdci;             /* dwdot[F]/d[AR] */
+    J[3568] -= dqdci;             /* dwdot[CF2]/d[AR] */
+    J[3569] += dqdci;             /* dwdot[CF]/d[AR] */
+    /* d()/d[HF] */
+    dqdci = (TB[30][11] - 1)*dcdc_fac;
+    J[3923] += dqdci;             /* dwdot[F]/d[HF] */
+    J[3933] -= dqdci;             /* dwdot[CF2]/d[HF] */
+    J[3934] += dqdci;             /* dwdot[CF]/d[HF] */
+    /* d()/d[F] */
+    dqdci =  - k_r*sc[65];
+    J[3996] += dqdci;             /* dwdot[F]/d[F] */
+    J[4006] -= dqdci;             /* dwdot[CF2]/d[F] */
+    J[4007] += dqdci;             /* dwdot[CF]/d[F] */
+    /* d()/d[CH3F] */
+    dqdci = (TB[30][7] - 1)*dcdc_fac;
+    J[4142] += dqdci;             /* dwdot[F]/d[CH3F] */
+    J[4152] -= dqdci;             /* dwdot[CF2]/d[CH3F] */
+    J[4153] += dqdci;             /* dwdot[CF]/d[CH3F] */
+    /* d()/d[CH2F2] */
+    dqdci = (TB[30][8] - 1)*dcdc_fac;
+    J[4215] += dqdci;             /* dwdot[F]/d[CH2F2] */
+    J[4225] -= dqdci;             /* dwdot[CF2]/d[CH2F2] */
+    J[4226] += dqdci;             /* dwdot[CF]/d[CH2F2] */
+    /* d()/d[CHF3] */
+    dqdci = (TB[30][9] - 1)*dcdc_fac;
+    J[4288] += dqdci;             /* dwdot[F]/d[CHF3] */
+    J[4298] -= dqdci;             /* dwdot[CF2]/d[CHF3] */
+    J[4299] += dqdci;             /* dwdot[CF]/d[CHF3] */
+    /* d()/d[CF4] */
+    dqdci = (TB[30][10] - 1)*dcdc_fac;
+    J[4361] += dqdci;             /* dwdot[F]/d[CF4] */
+    J[4371] -= dqdci;             /* dwdot[CF2]/d[CF4] */
+    J[4372] += dqdci;             /* dwdot[CF]/d[CF4] */
+    /* d()/d[CF2] */
+    dqdci =  + k_f;
+    J[4726] += dqdci;             /* dwdot[F]/d[CF2] */
+    J[4736] -= dqdci;             /* dwdot[CF2]/d[CF2] */
+    J[4737] += dqdci;             /* dwdot[CF]/d[CF2] */
+    /* d()/d[CF] */
+    dqdci =  - k_r*sc[54];
+    J[4799] += dqdci;             /* dwdot[F]/d[CF] */
+    J[4809] -= dqdci;             /* dwdot[CF2]/d[CF] */
+    J[4810] += dqdci;             /* dwdot[CF]/d[CF] */
     J[5310] += dqdT; /* dwdot[F]/dT */
     J[5320] -= dqdT; /* dwdot[CF2]/dT */
     J[5321] += dqdT; /* dwdot[CF]/dT */
@@ -42808,8 +41633,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[31][0] - 1)*sc[0] + (TB[31][1] - 1)*sc[5] + (TB[31][2] - 1)*sc[13] + (TB[31][3] - 1)*sc[14] + (TB[31][4] - 1)*sc[15] + (TB[31][5] - 1)*sc[26] + (TB[31][6] - 1)*sc[48] + (TB[31][7] - 1)*sc[56] + (TB[31][8] - 1)*sc[57] + (TB[31][9] - 1)*sc[58] + (TB[31][10] - 1)*sc[53];
     /* forward */
     phi_f = sc[62];
-    k_f = prefactor_units[31] * fwd_A[31]
-                * exp(fwd_beta[31] * tc[0] - activation_units[31] * fwd_Ea[31] * invT);
+    k_f = k_f_s[31];
     dlnkfdT = fwd_beta[31] * invT + activation_units[31] * fwd_Ea[31] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[31] * exp(low_beta[31] * tc[0] - activation_units[31] * low_Ea[31] * invT);
@@ -42824,7 +41648,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = 0.0;
     /* reverse */
     phi_r = sc[54]*sc[64];
-    Kc = refC * exp(-g_RT[54] + g_RT[62] - g_RT[64]);
+    Kc = Kc_s[31];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[62]) + (h_RT[54] + h_RT[64]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42842,157 +41666,80 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[31][0] - 1)*dcdc_fac;
-        J[54] += dqdci;               /* dwdot[F]/d[H2] */
-        J[62] -= dqdci;               /* dwdot[CF3]/d[H2] */
-        J[64] += dqdci;               /* dwdot[CF2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[31][1] - 1)*dcdc_fac;
-        J[419] += dqdci;              /* dwdot[F]/d[H2O] */
-        J[427] -= dqdci;              /* dwdot[CF3]/d[H2O] */
-        J[429] += dqdci;              /* dwdot[CF2]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[31][2] - 1)*dcdc_fac;
-        J[1003] += dqdci;             /* dwdot[F]/d[CH4] */
-        J[1011] -= dqdci;             /* dwdot[CF3]/d[CH4] */
-        J[1013] += dqdci;             /* dwdot[CF2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[31][3] - 1)*dcdc_fac;
-        J[1076] += dqdci;             /* dwdot[F]/d[CO] */
-        J[1084] -= dqdci;             /* dwdot[CF3]/d[CO] */
-        J[1086] += dqdci;             /* dwdot[CF2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[31][4] - 1)*dcdc_fac;
-        J[1149] += dqdci;             /* dwdot[F]/d[CO2] */
-        J[1157] -= dqdci;             /* dwdot[CF3]/d[CO2] */
-        J[1159] += dqdci;             /* dwdot[CF2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[31][5] - 1)*dcdc_fac;
-        J[1952] += dqdci;             /* dwdot[F]/d[C2H6] */
-        J[1960] -= dqdci;             /* dwdot[CF3]/d[C2H6] */
-        J[1962] += dqdci;             /* dwdot[CF2]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[31][6] - 1)*dcdc_fac;
-        J[3558] += dqdci;             /* dwdot[F]/d[AR] */
-        J[3566] -= dqdci;             /* dwdot[CF3]/d[AR] */
-        J[3568] += dqdci;             /* dwdot[CF2]/d[AR] */
-        /* d()/d[HF] */
-        dqdci = (TB[31][10] - 1)*dcdc_fac;
-        J[3923] += dqdci;             /* dwdot[F]/d[HF] */
-        J[3931] -= dqdci;             /* dwdot[CF3]/d[HF] */
-        J[3933] += dqdci;             /* dwdot[CF2]/d[HF] */
-        /* d()/d[F] */
-        dqdci =  - k_r*sc[64];
-        J[3996] += dqdci;             /* dwdot[F]/d[F] */
-        J[4004] -= dqdci;             /* dwdot[CF3]/d[F] */
-        J[4006] += dqdci;             /* dwdot[CF2]/d[F] */
-        /* d()/d[CH3F] */
-        dqdci = (TB[31][7] - 1)*dcdc_fac;
-        J[4142] += dqdci;             /* dwdot[F]/d[CH3F] */
-        J[4150] -= dqdci;             /* dwdot[CF3]/d[CH3F] */
-        J[4152] += dqdci;             /* dwdot[CF2]/d[CH3F] */
-        /* d()/d[CH2F2] */
-        dqdci = (TB[31][8] - 1)*dcdc_fac;
-        J[4215] += dqdci;             /* dwdot[F]/d[CH2F2] */
-        J[4223] -= dqdci;             /* dwdot[CF3]/d[CH2F2] */
-        J[4225] += dqdci;             /* dwdot[CF2]/d[CH2F2] */
-        /* d()/d[CHF3] */
-        dqdci = (TB[31][9] - 1)*dcdc_fac;
-        J[4288] += dqdci;             /* dwdot[F]/d[CHF3] */
-        J[4296] -= dqdci;             /* dwdot[CF3]/d[CHF3] */
-        J[4298] += dqdci;             /* dwdot[CF2]/d[CHF3] */
-        /* d()/d[CF3] */
-        dqdci =  + k_f;
-        J[4580] += dqdci;             /* dwdot[F]/d[CF3] */
-        J[4588] -= dqdci;             /* dwdot[CF3]/d[CF3] */
-        J[4590] += dqdci;             /* dwdot[CF2]/d[CF3] */
-        /* d()/d[CF2] */
-        dqdci =  - k_r*sc[54];
-        J[4726] += dqdci;             /* dwdot[F]/d[CF2] */
-        J[4734] -= dqdci;             /* dwdot[CF3]/d[CF2] */
-        J[4736] += dqdci;             /* dwdot[CF2]/d[CF2] */
-    }
-    else {
-        dqdc[0] = TB[31][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[31][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[31][2]*dcdc_fac;
-        dqdc[14] = TB[31][3]*dcdc_fac;
-        dqdc[15] = TB[31][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[31][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[31][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = TB[31][10]*dcdc_fac;
-        dqdc[54] = dcdc_fac - k_r*sc[64];
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = TB[31][7]*dcdc_fac;
-        dqdc[57] = TB[31][8]*dcdc_fac;
-        dqdc[58] = TB[31][9]*dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac + k_f;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac - k_r*sc[54];
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+54] += dqdc[k];
-            J[73*k+62] -= dqdc[k];
-            J[73*k+64] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[54] += dcdc_fac;
+    Jmix[62] -= dcdc_fac;
+    Jmix[64] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[31][0] - 1)*dcdc_fac;
+    J[54] += dqdci;               /* dwdot[F]/d[H2] */
+    J[62] -= dqdci;               /* dwdot[CF3]/d[H2] */
+    J[64] += dqdci;               /* dwdot[CF2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[31][1] - 1)*dcdc_fac;
+    J[419] += dqdci;              /* dwdot[F]/d[H2O] */
+    J[427] -= dqdci;              /* dwdot[CF3]/d[H2O] */
+    J[429] += dqdci;              /* dwdot[CF2]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[31][2] - 1)*dcdc_fac;
+    J[1003] += dqdci;             /* dwdot[F]/d[CH4] */
+    J[1011] -= dqdci;             /* dwdot[CF3]/d[CH4] */
+    J[1013] += dqdci;             /* dwdot[CF2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[31][3] - 1)*dcdc_fac;
+    J[1076] += dqdci;             /* dwdot[F]/d[CO] */
+    J[1084] -= dqdci;             /* dwdot[CF3]/d[CO] */
+    J[1086] += dqdci;             /* dwdot[CF2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[31][4] - 1)*dcdc_fac;
+    J[1149] += dqdci;             /* dwdot[F]/d[CO2] */
+    J[1157] -= dqdci;             /* dwdot[CF3]/d[CO2] */
+    J[1159] += dqdci;             /* dwdot[CF2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[31][5] - 1)*dcdc_fac;
+    J[1952] += dqdci;             /* dwdot[F]/d[C2H6] */
+    J[1960] -= dqdci;             /* dwdot[CF3]/d[C2H6] */
+    J[1962] += dqdci;             /* dwdot[CF2]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[31][6] - 1)*dcdc_fac;
+    J[3558] += dqdci;             /* dwdot[F]/d[AR] */
+    J[3566] -= dqdci;             /* dwdot[CF3]/d[AR] */
+    J[3568] += dqdci;             /* dwdot[CF2]/d[AR] */
+    /* d()/d[HF] */
+    dqdci = (TB[31][10] - 1)*dcdc_fac;
+    J[3923] += dqdci;             /* dwdot[F]/d[HF] */
+    J[3931] -= dqdci;             /* dwdot[CF3]/d[HF] */
+    J[3933] += dqdci;             /* dwdot[CF2]/d[HF] */
+    /* d()/d[F] */
+    dqdci =  - k_r*sc[64];
+    J[3996] += dqdci;             /* dwdot[F]/d[F] */
+    J[4004] -= dqdci;             /* dwdot[CF3]/d[F] */
+    J[4006] += dqdci;             /* dwdot[CF2]/d[F] */
+    /* d()/d[CH3F] */
+    dqdci = (TB[31][7] - 1)*dcdc_fac;
+    J[4142] += dqdci;             /* dwdot[F]/d[CH3F] */
+    J[4150] -= dqdci;             /* dwdot[CF3]/d[CH3F] */
+    J[4152] += dqdci;             /* dwdot[CF2]/d[CH3F] */
+    /* d()/d[CH2F2] */
+    dqdci = (TB[31][8] - 1)*dcdc_fac;
+    J[4215] += dqdci;             /* dwdot[F]/d[CH2F2] */
+    J[4223] -= dqdci;             /* dwdot[CF3]/d[CH2F2] */
+    J[4225] += dqdci;             /* dwdot[CF2]/d[CH2F2] */
+    /* d()/d[CHF3] */
+    dqdci = (TB[31][9] - 1)*dcdc_fac;
+    J[4288] += dqdci;             /* dwdot[F]/d[CHF3] */
+    J[4296] -= dqdci;             /* dwdot[CF3]/d[CHF3] */
+    J[4298] += dqdci;             /* dwdot[CF2]/d[CHF3] */
+    /* d()/d[CF3] */
+    dqdci =  + k_f;
+    J[4580] += dqdci;             /* dwdot[F]/d[CF3] */
+    J[4588] -= dqdci;             /* dwdot[CF3]/d[CF3] */
+    J[4590] += dqdci;             /* dwdot[CF2]/d[CF3] */
+    /* d()/d[CF2] */
+    dqdci =  - k_r*sc[54];
+    J[4726] += dqdci;             /* dwdot[F]/d[CF2] */
+    J[4734] -= dqdci;             /* dwdot[CF3]/d[CF2] */
+    J[4736] += dqdci;             /* dwdot[CF2]/d[CF2] */
     J[5310] += dqdT; /* dwdot[F]/dT */
     J[5318] -= dqdT; /* dwdot[CF3]/dT */
     J[5320] += dqdT; /* dwdot[CF2]/dT */
@@ -43003,12 +41750,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[32][0] - 1)*sc[0] + (TB[32][1] - 1)*sc[5] + (TB[32][2] - 1)*sc[13] + (TB[32][3] - 1)*sc[14] + (TB[32][4] - 1)*sc[15] + (TB[32][5] - 1)*sc[26] + (TB[32][6] - 1)*sc[48];
     /* forward */
     phi_f = sc[2]*sc[2];
-    k_f = prefactor_units[32] * fwd_A[32]
-                * exp(fwd_beta[32] * tc[0] - activation_units[32] * fwd_Ea[32] * invT);
+    k_f = k_f_s[32];
     dlnkfdT = fwd_beta[32] * invT + activation_units[32] * fwd_Ea[32] * invT2;
     /* reverse */
     phi_r = sc[3];
-    Kc = refCinv * exp(2*g_RT[2] - g_RT[3]);
+    Kc = Kc_s[32];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[2]) + (h_RT[3]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43022,137 +41768,59 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[32][0] - 1)*q_nocor;
-        J[2] += -2 * dqdci;           /* dwdot[O]/d[H2] */
-        J[3] += dqdci;                /* dwdot[O2]/d[H2] */
-        /* d()/d[O] */
-        dqdci =  + k_f*2*sc[2];
-        J[148] += -2 * dqdci;         /* dwdot[O]/d[O] */
-        J[149] += dqdci;              /* dwdot[O2]/d[O] */
-        /* d()/d[O2] */
-        dqdci =  - k_r;
-        J[221] += -2 * dqdci;         /* dwdot[O]/d[O2] */
-        J[222] += dqdci;              /* dwdot[O2]/d[O2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[32][1] - 1)*q_nocor;
-        J[367] += -2 * dqdci;         /* dwdot[O]/d[H2O] */
-        J[368] += dqdci;              /* dwdot[O2]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[32][2] - 1)*q_nocor;
-        J[951] += -2 * dqdci;         /* dwdot[O]/d[CH4] */
-        J[952] += dqdci;              /* dwdot[O2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[32][3] - 1)*q_nocor;
-        J[1024] += -2 * dqdci;        /* dwdot[O]/d[CO] */
-        J[1025] += dqdci;             /* dwdot[O2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[32][4] - 1)*q_nocor;
-        J[1097] += -2 * dqdci;        /* dwdot[O]/d[CO2] */
-        J[1098] += dqdci;             /* dwdot[O2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[32][5] - 1)*q_nocor;
-        J[1900] += -2 * dqdci;        /* dwdot[O]/d[C2H6] */
-        J[1901] += dqdci;             /* dwdot[O2]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[32][6] - 1)*q_nocor;
-        J[3506] += -2 * dqdci;        /* dwdot[O]/d[AR] */
-        J[3507] += dqdci;             /* dwdot[O2]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[32][0];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*2*sc[2];
-        dqdc[3] = dcdc_fac - k_r;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[32][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[32][2];
-        dqdc[14] = TB[32][3];
-        dqdc[15] = TB[32][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[32][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[32][6];
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+2] += -2 * dqdc[k];
-            J[73*k+3] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] += -2 * q_nocor;
+    Jmix[3] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[32][0] - 1)*q_nocor;
+    J[2] += -2 * dqdci;           /* dwdot[O]/d[H2] */
+    J[3] += dqdci;                /* dwdot[O2]/d[H2] */
+    /* d()/d[O] */
+    dqdci =  + k_f*2*sc[2];
+    J[148] += -2 * dqdci;         /* dwdot[O]/d[O] */
+    J[149] += dqdci;              /* dwdot[O2]/d[O] */
+    /* d()/d[O2] */
+    dqdci =  - k_r;
+    J[221] += -2 * dqdci;         /* dwdot[O]/d[O2] */
+    J[222] += dqdci;              /* dwdot[O2]/d[O2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[32][1] - 1)*q_nocor;
+    J[367] += -2 * dqdci;         /* dwdot[O]/d[H2O] */
+    J[368] += dqdci;              /* dwdot[O2]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[32][2] - 1)*q_nocor;
+    J[951] += -2 * dqdci;         /* dwdot[O]/d[CH4] */
+    J[952] += dqdci;              /* dwdot[O2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[32][3] - 1)*q_nocor;
+    J[1024] += -2 * dqdci;        /* dwdot[O]/d[CO] */
+    J[1025] += dqdci;             /* dwdot[O2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[32][4] - 1)*q_nocor;
+    J[1097] += -2 * dqdci;        /* dwdot[O]/d[CO2] */
+    J[1098] += dqdci;             /* dwdot[O2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[32][5] - 1)*q_nocor;
+    J[1900] += -2 * dqdci;        /* dwdot[O]/d[C2H6] */
+    J[1901] += dqdci;             /* dwdot[O2]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[32][6] - 1)*q_nocor;
+    J[3506] += -2 * dqdci;        /* dwdot[O]/d[AR] */
+    J[3507] += dqdci;             /* dwdot[O2]/d[AR] */
     J[5258] += -2 * dqdT; /* dwdot[O]/dT */
     J[5259] += dqdT; /* dwdot[O2]/dT */
 
     /*reaction 34: O + H + M <=> OH + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[33][0] - 1)*sc[0] + (TB[33][1] - 1)*sc[5] + (TB[33][2] - 1)*sc[13] + (TB[33][3] - 1)*sc[14] + (TB[33][4] - 1)*sc[15] + (TB[33][5] - 1)*sc[26] + (TB[33][6] - 1)*sc[48];
+    alpha = (memcmp(TB[33], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[33][0] - 1)*sc[0] + (TB[33][1] - 1)*sc[5] + (TB[33][2] - 1)*sc[13] + (TB[33][3] - 1)*sc[14] + (TB[33][4] - 1)*sc[15] + (TB[33][5] - 1)*sc[26] + (TB[33][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[1]*sc[2];
-    k_f = prefactor_units[33] * fwd_A[33]
-                * exp(fwd_beta[33] * tc[0] - activation_units[33] * fwd_Ea[33] * invT);
+    k_f = k_f_s[33];
     dlnkfdT = fwd_beta[33] * invT + activation_units[33] * fwd_Ea[33] * invT2;
     /* reverse */
     phi_r = sc[4];
-    Kc = refCinv * exp(g_RT[1] + g_RT[2] - g_RT[4]);
+    Kc = Kc_s[33];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[2]) + (h_RT[4]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43167,137 +41835,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[33][0] - 1)*q_nocor;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[2] -= dqdci;                /* dwdot[O]/d[H2] */
-        J[4] += dqdci;                /* dwdot[OH]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[2];
-        J[74] -= dqdci;               /* dwdot[H]/d[H] */
-        J[75] -= dqdci;               /* dwdot[O]/d[H] */
-        J[77] += dqdci;               /* dwdot[OH]/d[H] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[1];
-        J[147] -= dqdci;              /* dwdot[H]/d[O] */
-        J[148] -= dqdci;              /* dwdot[O]/d[O] */
-        J[150] += dqdci;              /* dwdot[OH]/d[O] */
-        /* d()/d[OH] */
-        dqdci =  - k_r;
-        J[293] -= dqdci;              /* dwdot[H]/d[OH] */
-        J[294] -= dqdci;              /* dwdot[O]/d[OH] */
-        J[296] += dqdci;              /* dwdot[OH]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[33][1] - 1)*q_nocor;
-        J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[367] -= dqdci;              /* dwdot[O]/d[H2O] */
-        J[369] += dqdci;              /* dwdot[OH]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[33][2] - 1)*q_nocor;
-        J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[951] -= dqdci;              /* dwdot[O]/d[CH4] */
-        J[953] += dqdci;              /* dwdot[OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[33][3] - 1)*q_nocor;
-        J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1024] -= dqdci;             /* dwdot[O]/d[CO] */
-        J[1026] += dqdci;             /* dwdot[OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[33][4] - 1)*q_nocor;
-        J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1097] -= dqdci;             /* dwdot[O]/d[CO2] */
-        J[1099] += dqdci;             /* dwdot[OH]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[33][5] - 1)*q_nocor;
-        J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1900] -= dqdci;             /* dwdot[O]/d[C2H6] */
-        J[1902] += dqdci;             /* dwdot[OH]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[33][6] - 1)*q_nocor;
-        J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[3506] -= dqdci;             /* dwdot[O]/d[AR] */
-        J[3508] += dqdci;             /* dwdot[OH]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[33][0];
-        dqdc[1] = dcdc_fac + k_f*sc[2];
-        dqdc[2] = dcdc_fac + k_f*sc[1];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac - k_r;
-        dqdc[5] = TB[33][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[33][2];
-        dqdc[14] = TB[33][3];
-        dqdc[15] = TB[33][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[33][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[33][6];
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+1] -= dqdc[k];
-            J[73*k+2] -= dqdc[k];
-            J[73*k+4] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= q_nocor;
+    Jmix[2] -= q_nocor;
+    Jmix[4] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[33][0] - 1)*q_nocor;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[2] -= dqdci;                /* dwdot[O]/d[H2] */
+    J[4] += dqdci;                /* dwdot[OH]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[2];
+    J[74] -= dqdci;               /* dwdot[H]/d[H] */
+    J[75] -= dqdci;               /* dwdot[O]/d[H] */
+    J[77] += dqdci;               /* dwdot[OH]/d[H] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[1];
+    J[147] -= dqdci;              /* dwdot[H]/d[O] */
+    J[148] -= dqdci;              /* dwdot[O]/d[O] */
+    J[150] += dqdci;              /* dwdot[OH]/d[O] */
+    /* d()/d[OH] */
+    dqdci =  - k_r;
+    J[293] -= dqdci;              /* dwdot[H]/d[OH] */
+    J[294] -= dqdci;              /* dwdot[O]/d[OH] */
+    J[296] += dqdci;              /* dwdot[OH]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[33][1] - 1)*q_nocor;
+    J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[367] -= dqdci;              /* dwdot[O]/d[H2O] */
+    J[369] += dqdci;              /* dwdot[OH]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[33][2] - 1)*q_nocor;
+    J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[951] -= dqdci;              /* dwdot[O]/d[CH4] */
+    J[953] += dqdci;              /* dwdot[OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[33][3] - 1)*q_nocor;
+    J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1024] -= dqdci;             /* dwdot[O]/d[CO] */
+    J[1026] += dqdci;             /* dwdot[OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[33][4] - 1)*q_nocor;
+    J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1097] -= dqdci;             /* dwdot[O]/d[CO2] */
+    J[1099] += dqdci;             /* dwdot[OH]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[33][5] - 1)*q_nocor;
+    J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1900] -= dqdci;             /* dwdot[O]/d[C2H6] */
+    J[1902] += dqdci;             /* dwdot[OH]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[33][6] - 1)*q_nocor;
+    J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[3506] -= dqdci;             /* dwdot[O]/d[AR] */
+    J[3508] += dqdci;             /* dwdot[OH]/d[AR] */
     J[5257] -= dqdT; /* dwdot[H]/dT */
     J[5258] -= dqdT; /* dwdot[O]/dT */
     J[5260] += dqdT; /* dwdot[OH]/dT */
@@ -43308,12 +41899,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[34][0] - 1)*sc[3] + (TB[34][1] - 1)*sc[5] + (TB[34][2] - 1)*sc[14] + (TB[34][3] - 1)*sc[15] + (TB[34][4] - 1)*sc[26] + (TB[34][5] - 1)*sc[47] + (TB[34][6] - 1)*sc[48];
     /* forward */
     phi_f = sc[1]*sc[3];
-    k_f = prefactor_units[34] * fwd_A[34]
-                * exp(fwd_beta[34] * tc[0] - activation_units[34] * fwd_Ea[34] * invT);
+    k_f = k_f_s[34];
     dlnkfdT = fwd_beta[34] * invT + activation_units[34] * fwd_Ea[34] * invT2;
     /* reverse */
     phi_r = sc[6];
-    Kc = refCinv * exp(g_RT[1] + g_RT[3] - g_RT[6]);
+    Kc = Kc_s[34];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3]) + (h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43328,132 +41918,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[3];
-        J[74] -= dqdci;               /* dwdot[H]/d[H] */
-        J[76] -= dqdci;               /* dwdot[O2]/d[H] */
-        J[79] += dqdci;               /* dwdot[HO2]/d[H] */
-        /* d()/d[O2] */
-        dqdci = (TB[34][0] - 1)*q_nocor + k_f*sc[1];
-        J[220] -= dqdci;              /* dwdot[H]/d[O2] */
-        J[222] -= dqdci;              /* dwdot[O2]/d[O2] */
-        J[225] += dqdci;              /* dwdot[HO2]/d[O2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[34][1] - 1)*q_nocor;
-        J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[368] -= dqdci;              /* dwdot[O2]/d[H2O] */
-        J[371] += dqdci;              /* dwdot[HO2]/d[H2O] */
-        /* d()/d[HO2] */
-        dqdci =  - k_r;
-        J[439] -= dqdci;              /* dwdot[H]/d[HO2] */
-        J[441] -= dqdci;              /* dwdot[O2]/d[HO2] */
-        J[444] += dqdci;              /* dwdot[HO2]/d[HO2] */
-        /* d()/d[CO] */
-        dqdci = (TB[34][2] - 1)*q_nocor;
-        J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1025] -= dqdci;             /* dwdot[O2]/d[CO] */
-        J[1028] += dqdci;             /* dwdot[HO2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[34][3] - 1)*q_nocor;
-        J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1098] -= dqdci;             /* dwdot[O2]/d[CO2] */
-        J[1101] += dqdci;             /* dwdot[HO2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[34][4] - 1)*q_nocor;
-        J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1901] -= dqdci;             /* dwdot[O2]/d[C2H6] */
-        J[1904] += dqdci;             /* dwdot[HO2]/d[C2H6] */
-        /* d()/d[N2] */
-        dqdci = (TB[34][5] - 1)*q_nocor;
-        J[3432] -= dqdci;             /* dwdot[H]/d[N2] */
-        J[3434] -= dqdci;             /* dwdot[O2]/d[N2] */
-        J[3437] += dqdci;             /* dwdot[HO2]/d[N2] */
-        /* d()/d[AR] */
-        dqdci = (TB[34][6] - 1)*q_nocor;
-        J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[3507] -= dqdci;             /* dwdot[O2]/d[AR] */
-        J[3510] += dqdci;             /* dwdot[HO2]/d[AR] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[3];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = TB[34][0] + k_f*sc[1];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[34][1];
-        dqdc[6] = dcdc_fac - k_r;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = TB[34][2];
-        dqdc[15] = TB[34][3];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[34][4];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = TB[34][5];
-        dqdc[48] = TB[34][6];
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+1] -= dqdc[k];
-            J[73*k+3] -= dqdc[k];
-            J[73*k+6] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= q_nocor;
+    Jmix[3] -= q_nocor;
+    Jmix[6] += q_nocor;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[3];
+    J[74] -= dqdci;               /* dwdot[H]/d[H] */
+    J[76] -= dqdci;               /* dwdot[O2]/d[H] */
+    J[79] += dqdci;               /* dwdot[HO2]/d[H] */
+    /* d()/d[O2] */
+    dqdci = (TB[34][0] - 1)*q_nocor + k_f*sc[1];
+    J[220] -= dqdci;              /* dwdot[H]/d[O2] */
+    J[222] -= dqdci;              /* dwdot[O2]/d[O2] */
+    J[225] += dqdci;              /* dwdot[HO2]/d[O2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[34][1] - 1)*q_nocor;
+    J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[368] -= dqdci;              /* dwdot[O2]/d[H2O] */
+    J[371] += dqdci;              /* dwdot[HO2]/d[H2O] */
+    /* d()/d[HO2] */
+    dqdci =  - k_r;
+    J[439] -= dqdci;              /* dwdot[H]/d[HO2] */
+    J[441] -= dqdci;              /* dwdot[O2]/d[HO2] */
+    J[444] += dqdci;              /* dwdot[HO2]/d[HO2] */
+    /* d()/d[CO] */
+    dqdci = (TB[34][2] - 1)*q_nocor;
+    J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1025] -= dqdci;             /* dwdot[O2]/d[CO] */
+    J[1028] += dqdci;             /* dwdot[HO2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[34][3] - 1)*q_nocor;
+    J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1098] -= dqdci;             /* dwdot[O2]/d[CO2] */
+    J[1101] += dqdci;             /* dwdot[HO2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[34][4] - 1)*q_nocor;
+    J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1901] -= dqdci;             /* dwdot[O2]/d[C2H6] */
+    J[1904] += dqdci;             /* dwdot[HO2]/d[C2H6] */
+    /* d()/d[N2] */
+    dqdci = (TB[34][5] - 1)*q_nocor;
+    J[3432] -= dqdci;             /* dwdot[H]/d[N2] */
+    J[3434] -= dqdci;             /* dwdot[O2]/d[N2] */
+    J[3437] += dqdci;             /* dwdot[HO2]/d[N2] */
+    /* d()/d[AR] */
+    dqdci = (TB[34][6] - 1)*q_nocor;
+    J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[3507] -= dqdci;             /* dwdot[O2]/d[AR] */
+    J[3510] += dqdci;             /* dwdot[HO2]/d[AR] */
     J[5257] -= dqdT; /* dwdot[H]/dT */
     J[5259] -= dqdT; /* dwdot[O2]/dT */
     J[5262] += dqdT; /* dwdot[HO2]/dT */
@@ -43464,12 +41977,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[35][0] - 1)*sc[0] + (TB[35][1] - 1)*sc[5] + (TB[35][2] - 1)*sc[13] + (TB[35][3] - 1)*sc[15] + (TB[35][4] - 1)*sc[26] + (TB[35][5] - 1)*sc[48];
     /* forward */
     phi_f = sc[1]*sc[1];
-    k_f = prefactor_units[35] * fwd_A[35]
-                * exp(fwd_beta[35] * tc[0] - activation_units[35] * fwd_Ea[35] * invT);
+    k_f = k_f_s[35];
     dlnkfdT = fwd_beta[35] * invT + activation_units[35] * fwd_Ea[35] * invT2;
     /* reverse */
     phi_r = sc[0];
-    Kc = refCinv * exp(-g_RT[0] + 2*g_RT[1]);
+    Kc = Kc_s[35];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[1]) + (h_RT[0]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43483,114 +41995,37 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[35][0] - 1)*q_nocor - k_r;
-        J[0] += dqdci;                /* dwdot[H2]/d[H2] */
-        J[1] += -2 * dqdci;           /* dwdot[H]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*2*sc[1];
-        J[73] += dqdci;               /* dwdot[H2]/d[H] */
-        J[74] += -2 * dqdci;          /* dwdot[H]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[35][1] - 1)*q_nocor;
-        J[365] += dqdci;              /* dwdot[H2]/d[H2O] */
-        J[366] += -2 * dqdci;         /* dwdot[H]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[35][2] - 1)*q_nocor;
-        J[949] += dqdci;              /* dwdot[H2]/d[CH4] */
-        J[950] += -2 * dqdci;         /* dwdot[H]/d[CH4] */
-        /* d()/d[CO2] */
-        dqdci = (TB[35][3] - 1)*q_nocor;
-        J[1095] += dqdci;             /* dwdot[H2]/d[CO2] */
-        J[1096] += -2 * dqdci;        /* dwdot[H]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[35][4] - 1)*q_nocor;
-        J[1898] += dqdci;             /* dwdot[H2]/d[C2H6] */
-        J[1899] += -2 * dqdci;        /* dwdot[H]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[35][5] - 1)*q_nocor;
-        J[3504] += dqdci;             /* dwdot[H2]/d[AR] */
-        J[3505] += -2 * dqdci;        /* dwdot[H]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[35][0] - k_r;
-        dqdc[1] = dcdc_fac + k_f*2*sc[1];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[35][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[35][2];
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[35][3];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[35][4];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[35][5];
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+0] += dqdc[k];
-            J[73*k+1] += -2 * dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += q_nocor;
+    Jmix[1] += -2 * q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[35][0] - 1)*q_nocor - k_r;
+    J[0] += dqdci;                /* dwdot[H2]/d[H2] */
+    J[1] += -2 * dqdci;           /* dwdot[H]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*2*sc[1];
+    J[73] += dqdci;               /* dwdot[H2]/d[H] */
+    J[74] += -2 * dqdci;          /* dwdot[H]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[35][1] - 1)*q_nocor;
+    J[365] += dqdci;              /* dwdot[H2]/d[H2O] */
+    J[366] += -2 * dqdci;         /* dwdot[H]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[35][2] - 1)*q_nocor;
+    J[949] += dqdci;              /* dwdot[H2]/d[CH4] */
+    J[950] += -2 * dqdci;         /* dwdot[H]/d[CH4] */
+    /* d()/d[CO2] */
+    dqdci = (TB[35][3] - 1)*q_nocor;
+    J[1095] += dqdci;             /* dwdot[H2]/d[CO2] */
+    J[1096] += -2 * dqdci;        /* dwdot[H]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[35][4] - 1)*q_nocor;
+    J[1898] += dqdci;             /* dwdot[H2]/d[C2H6] */
+    J[1899] += -2 * dqdci;        /* dwdot[H]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[35][5] - 1)*q_nocor;
+    J[3504] += dqdci;             /* dwdot[H2]/d[AR] */
+    J[3505] += -2 * dqdci;        /* dwdot[H]/d[AR] */
     J[5256] += dqdT; /* dwdot[H2]/dT */
     J[5257] += -2 * dqdT; /* dwdot[H]/dT */
 
@@ -43600,12 +42035,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[36][0] - 1)*sc[0] + (TB[36][1] - 1)*sc[5] + (TB[36][2] - 1)*sc[13] + (TB[36][3] - 1)*sc[26] + (TB[36][4] - 1)*sc[48];
     /* forward */
     phi_f = sc[1]*sc[4];
-    k_f = prefactor_units[36] * fwd_A[36]
-                * exp(fwd_beta[36] * tc[0] - activation_units[36] * fwd_Ea[36] * invT);
+    k_f = k_f_s[36];
     dlnkfdT = fwd_beta[36] * invT + activation_units[36] * fwd_Ea[36] * invT2;
     /* reverse */
     phi_r = sc[5];
-    Kc = refCinv * exp(g_RT[1] + g_RT[4] - g_RT[5]);
+    Kc = Kc_s[36];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[4]) + (h_RT[5]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43620,122 +42054,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[36][0] - 1)*q_nocor;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[4] -= dqdci;                /* dwdot[OH]/d[H2] */
-        J[5] += dqdci;                /* dwdot[H2O]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[4];
-        J[74] -= dqdci;               /* dwdot[H]/d[H] */
-        J[77] -= dqdci;               /* dwdot[OH]/d[H] */
-        J[78] += dqdci;               /* dwdot[H2O]/d[H] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*sc[1];
-        J[293] -= dqdci;              /* dwdot[H]/d[OH] */
-        J[296] -= dqdci;              /* dwdot[OH]/d[OH] */
-        J[297] += dqdci;              /* dwdot[H2O]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[36][1] - 1)*q_nocor - k_r;
-        J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[369] -= dqdci;              /* dwdot[OH]/d[H2O] */
-        J[370] += dqdci;              /* dwdot[H2O]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[36][2] - 1)*q_nocor;
-        J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[953] -= dqdci;              /* dwdot[OH]/d[CH4] */
-        J[954] += dqdci;              /* dwdot[H2O]/d[CH4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[36][3] - 1)*q_nocor;
-        J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1902] -= dqdci;             /* dwdot[OH]/d[C2H6] */
-        J[1903] += dqdci;             /* dwdot[H2O]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[36][4] - 1)*q_nocor;
-        J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[3508] -= dqdci;             /* dwdot[OH]/d[AR] */
-        J[3509] += dqdci;             /* dwdot[H2O]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[36][0];
-        dqdc[1] = dcdc_fac + k_f*sc[4];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac + k_f*sc[1];
-        dqdc[5] = TB[36][1] - k_r;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[36][2];
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[36][3];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[36][4];
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+1] -= dqdc[k];
-            J[73*k+4] -= dqdc[k];
-            J[73*k+5] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= q_nocor;
+    Jmix[4] -= q_nocor;
+    Jmix[5] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[36][0] - 1)*q_nocor;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[4] -= dqdci;                /* dwdot[OH]/d[H2] */
+    J[5] += dqdci;                /* dwdot[H2O]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[4];
+    J[74] -= dqdci;               /* dwdot[H]/d[H] */
+    J[77] -= dqdci;               /* dwdot[OH]/d[H] */
+    J[78] += dqdci;               /* dwdot[H2O]/d[H] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*sc[1];
+    J[293] -= dqdci;              /* dwdot[H]/d[OH] */
+    J[296] -= dqdci;              /* dwdot[OH]/d[OH] */
+    J[297] += dqdci;              /* dwdot[H2O]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[36][1] - 1)*q_nocor - k_r;
+    J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[369] -= dqdci;              /* dwdot[OH]/d[H2O] */
+    J[370] += dqdci;              /* dwdot[H2O]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[36][2] - 1)*q_nocor;
+    J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[953] -= dqdci;              /* dwdot[OH]/d[CH4] */
+    J[954] += dqdci;              /* dwdot[H2O]/d[CH4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[36][3] - 1)*q_nocor;
+    J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1902] -= dqdci;             /* dwdot[OH]/d[C2H6] */
+    J[1903] += dqdci;             /* dwdot[H2O]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[36][4] - 1)*q_nocor;
+    J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[3508] -= dqdci;             /* dwdot[OH]/d[AR] */
+    J[3509] += dqdci;             /* dwdot[H2O]/d[AR] */
     J[5257] -= dqdT; /* dwdot[H]/dT */
     J[5260] -= dqdT; /* dwdot[OH]/dT */
     J[5261] += dqdT; /* dwdot[H2O]/dT */
@@ -43746,12 +42103,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[37][0] - 1)*sc[0] + (TB[37][1] - 1)*sc[5] + (TB[37][2] - 1)*sc[13] + (TB[37][3] - 1)*sc[14] + (TB[37][4] - 1)*sc[15] + (TB[37][5] - 1)*sc[26];
     /* forward */
     phi_f = sc[16];
-    k_f = prefactor_units[37] * fwd_A[37]
-                * exp(fwd_beta[37] * tc[0] - activation_units[37] * fwd_Ea[37] * invT);
+    k_f = k_f_s[37];
     dlnkfdT = fwd_beta[37] * invT + activation_units[37] * fwd_Ea[37] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14];
-    Kc = refC * exp(-g_RT[1] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[37];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16]) + (h_RT[1] + h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43766,127 +42122,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[37][0] - 1)*q_nocor;
-        J[1] += dqdci;                /* dwdot[H]/d[H2] */
-        J[14] += dqdci;               /* dwdot[CO]/d[H2] */
-        J[16] -= dqdci;               /* dwdot[HCO]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[14];
-        J[74] += dqdci;               /* dwdot[H]/d[H] */
-        J[87] += dqdci;               /* dwdot[CO]/d[H] */
-        J[89] -= dqdci;               /* dwdot[HCO]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[37][1] - 1)*q_nocor;
-        J[366] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[379] += dqdci;              /* dwdot[CO]/d[H2O] */
-        J[381] -= dqdci;              /* dwdot[HCO]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[37][2] - 1)*q_nocor;
-        J[950] += dqdci;              /* dwdot[H]/d[CH4] */
-        J[963] += dqdci;              /* dwdot[CO]/d[CH4] */
-        J[965] -= dqdci;              /* dwdot[HCO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[37][3] - 1)*q_nocor - k_r*sc[1];
-        J[1023] += dqdci;             /* dwdot[H]/d[CO] */
-        J[1036] += dqdci;             /* dwdot[CO]/d[CO] */
-        J[1038] -= dqdci;             /* dwdot[HCO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[37][4] - 1)*q_nocor;
-        J[1096] += dqdci;             /* dwdot[H]/d[CO2] */
-        J[1109] += dqdci;             /* dwdot[CO]/d[CO2] */
-        J[1111] -= dqdci;             /* dwdot[HCO]/d[CO2] */
-        /* d()/d[HCO] */
-        dqdci =  + k_f;
-        J[1169] += dqdci;             /* dwdot[H]/d[HCO] */
-        J[1182] += dqdci;             /* dwdot[CO]/d[HCO] */
-        J[1184] -= dqdci;             /* dwdot[HCO]/d[HCO] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[37][5] - 1)*q_nocor;
-        J[1899] += dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1912] += dqdci;             /* dwdot[CO]/d[C2H6] */
-        J[1914] -= dqdci;             /* dwdot[HCO]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[37][0];
-        dqdc[1] = dcdc_fac - k_r*sc[14];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[37][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[37][2];
-        dqdc[14] = TB[37][3] - k_r*sc[1];
-        dqdc[15] = TB[37][4];
-        dqdc[16] = dcdc_fac + k_f;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[37][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+1] += dqdc[k];
-            J[73*k+14] += dqdc[k];
-            J[73*k+16] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] += q_nocor;
+    Jmix[14] += q_nocor;
+    Jmix[16] -= q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[37][0] - 1)*q_nocor;
+    J[1] += dqdci;                /* dwdot[H]/d[H2] */
+    J[14] += dqdci;               /* dwdot[CO]/d[H2] */
+    J[16] -= dqdci;               /* dwdot[HCO]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[14];
+    J[74] += dqdci;               /* dwdot[H]/d[H] */
+    J[87] += dqdci;               /* dwdot[CO]/d[H] */
+    J[89] -= dqdci;               /* dwdot[HCO]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[37][1] - 1)*q_nocor;
+    J[366] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[379] += dqdci;              /* dwdot[CO]/d[H2O] */
+    J[381] -= dqdci;              /* dwdot[HCO]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[37][2] - 1)*q_nocor;
+    J[950] += dqdci;              /* dwdot[H]/d[CH4] */
+    J[963] += dqdci;              /* dwdot[CO]/d[CH4] */
+    J[965] -= dqdci;              /* dwdot[HCO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[37][3] - 1)*q_nocor - k_r*sc[1];
+    J[1023] += dqdci;             /* dwdot[H]/d[CO] */
+    J[1036] += dqdci;             /* dwdot[CO]/d[CO] */
+    J[1038] -= dqdci;             /* dwdot[HCO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[37][4] - 1)*q_nocor;
+    J[1096] += dqdci;             /* dwdot[H]/d[CO2] */
+    J[1109] += dqdci;             /* dwdot[CO]/d[CO2] */
+    J[1111] -= dqdci;             /* dwdot[HCO]/d[CO2] */
+    /* d()/d[HCO] */
+    dqdci =  + k_f;
+    J[1169] += dqdci;             /* dwdot[H]/d[HCO] */
+    J[1182] += dqdci;             /* dwdot[CO]/d[HCO] */
+    J[1184] -= dqdci;             /* dwdot[HCO]/d[HCO] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[37][5] - 1)*q_nocor;
+    J[1899] += dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1912] += dqdci;             /* dwdot[CO]/d[C2H6] */
+    J[1914] -= dqdci;             /* dwdot[HCO]/d[C2H6] */
     J[5257] += dqdT; /* dwdot[H]/dT */
     J[5270] += dqdT; /* dwdot[CO]/dT */
     J[5272] -= dqdT; /* dwdot[HCO]/dT */
@@ -43894,15 +42173,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 39: NO + O + M <=> NO2 + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[38][0] - 1)*sc[0] + (TB[38][1] - 1)*sc[5] + (TB[38][2] - 1)*sc[13] + (TB[38][3] - 1)*sc[14] + (TB[38][4] - 1)*sc[15] + (TB[38][5] - 1)*sc[26] + (TB[38][6] - 1)*sc[48];
+    alpha = (memcmp(TB[38], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[38][0] - 1)*sc[0] + (TB[38][1] - 1)*sc[5] + (TB[38][2] - 1)*sc[13] + (TB[38][3] - 1)*sc[14] + (TB[38][4] - 1)*sc[15] + (TB[38][5] - 1)*sc[26] + (TB[38][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[2]*sc[35];
-    k_f = prefactor_units[38] * fwd_A[38]
-                * exp(fwd_beta[38] * tc[0] - activation_units[38] * fwd_Ea[38] * invT);
+    k_f = k_f_s[38];
     dlnkfdT = fwd_beta[38] * invT + activation_units[38] * fwd_Ea[38] * invT2;
     /* reverse */
     phi_r = sc[36];
-    Kc = refCinv * exp(g_RT[2] + g_RT[35] - g_RT[36]);
+    Kc = Kc_s[38];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[35]) + (h_RT[36]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43917,137 +42195,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[38][0] - 1)*q_nocor;
-        J[2] -= dqdci;                /* dwdot[O]/d[H2] */
-        J[35] -= dqdci;               /* dwdot[NO]/d[H2] */
-        J[36] += dqdci;               /* dwdot[NO2]/d[H2] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[35];
-        J[148] -= dqdci;              /* dwdot[O]/d[O] */
-        J[181] -= dqdci;              /* dwdot[NO]/d[O] */
-        J[182] += dqdci;              /* dwdot[NO2]/d[O] */
-        /* d()/d[H2O] */
-        dqdci = (TB[38][1] - 1)*q_nocor;
-        J[367] -= dqdci;              /* dwdot[O]/d[H2O] */
-        J[400] -= dqdci;              /* dwdot[NO]/d[H2O] */
-        J[401] += dqdci;              /* dwdot[NO2]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[38][2] - 1)*q_nocor;
-        J[951] -= dqdci;              /* dwdot[O]/d[CH4] */
-        J[984] -= dqdci;              /* dwdot[NO]/d[CH4] */
-        J[985] += dqdci;              /* dwdot[NO2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[38][3] - 1)*q_nocor;
-        J[1024] -= dqdci;             /* dwdot[O]/d[CO] */
-        J[1057] -= dqdci;             /* dwdot[NO]/d[CO] */
-        J[1058] += dqdci;             /* dwdot[NO2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[38][4] - 1)*q_nocor;
-        J[1097] -= dqdci;             /* dwdot[O]/d[CO2] */
-        J[1130] -= dqdci;             /* dwdot[NO]/d[CO2] */
-        J[1131] += dqdci;             /* dwdot[NO2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[38][5] - 1)*q_nocor;
-        J[1900] -= dqdci;             /* dwdot[O]/d[C2H6] */
-        J[1933] -= dqdci;             /* dwdot[NO]/d[C2H6] */
-        J[1934] += dqdci;             /* dwdot[NO2]/d[C2H6] */
-        /* d()/d[NO] */
-        dqdci =  + k_f*sc[2];
-        J[2557] -= dqdci;             /* dwdot[O]/d[NO] */
-        J[2590] -= dqdci;             /* dwdot[NO]/d[NO] */
-        J[2591] += dqdci;             /* dwdot[NO2]/d[NO] */
-        /* d()/d[NO2] */
-        dqdci =  - k_r;
-        J[2630] -= dqdci;             /* dwdot[O]/d[NO2] */
-        J[2663] -= dqdci;             /* dwdot[NO]/d[NO2] */
-        J[2664] += dqdci;             /* dwdot[NO2]/d[NO2] */
-        /* d()/d[AR] */
-        dqdci = (TB[38][6] - 1)*q_nocor;
-        J[3506] -= dqdci;             /* dwdot[O]/d[AR] */
-        J[3539] -= dqdci;             /* dwdot[NO]/d[AR] */
-        J[3540] += dqdci;             /* dwdot[NO2]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[38][0];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*sc[35];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[38][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[38][2];
-        dqdc[14] = TB[38][3];
-        dqdc[15] = TB[38][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[38][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac + k_f*sc[2];
-        dqdc[36] = dcdc_fac - k_r;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[38][6];
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+2] -= dqdc[k];
-            J[73*k+35] -= dqdc[k];
-            J[73*k+36] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] -= q_nocor;
+    Jmix[35] -= q_nocor;
+    Jmix[36] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[38][0] - 1)*q_nocor;
+    J[2] -= dqdci;                /* dwdot[O]/d[H2] */
+    J[35] -= dqdci;               /* dwdot[NO]/d[H2] */
+    J[36] += dqdci;               /* dwdot[NO2]/d[H2] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[35];
+    J[148] -= dqdci;              /* dwdot[O]/d[O] */
+    J[181] -= dqdci;              /* dwdot[NO]/d[O] */
+    J[182] += dqdci;              /* dwdot[NO2]/d[O] */
+    /* d()/d[H2O] */
+    dqdci = (TB[38][1] - 1)*q_nocor;
+    J[367] -= dqdci;              /* dwdot[O]/d[H2O] */
+    J[400] -= dqdci;              /* dwdot[NO]/d[H2O] */
+    J[401] += dqdci;              /* dwdot[NO2]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[38][2] - 1)*q_nocor;
+    J[951] -= dqdci;              /* dwdot[O]/d[CH4] */
+    J[984] -= dqdci;              /* dwdot[NO]/d[CH4] */
+    J[985] += dqdci;              /* dwdot[NO2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[38][3] - 1)*q_nocor;
+    J[1024] -= dqdci;             /* dwdot[O]/d[CO] */
+    J[1057] -= dqdci;             /* dwdot[NO]/d[CO] */
+    J[1058] += dqdci;             /* dwdot[NO2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[38][4] - 1)*q_nocor;
+    J[1097] -= dqdci;             /* dwdot[O]/d[CO2] */
+    J[1130] -= dqdci;             /* dwdot[NO]/d[CO2] */
+    J[1131] += dqdci;             /* dwdot[NO2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[38][5] - 1)*q_nocor;
+    J[1900] -= dqdci;             /* dwdot[O]/d[C2H6] */
+    J[1933] -= dqdci;             /* dwdot[NO]/d[C2H6] */
+    J[1934] += dqdci;             /* dwdot[NO2]/d[C2H6] */
+    /* d()/d[NO] */
+    dqdci =  + k_f*sc[2];
+    J[2557] -= dqdci;             /* dwdot[O]/d[NO] */
+    J[2590] -= dqdci;             /* dwdot[NO]/d[NO] */
+    J[2591] += dqdci;             /* dwdot[NO2]/d[NO] */
+    /* d()/d[NO2] */
+    dqdci =  - k_r;
+    J[2630] -= dqdci;             /* dwdot[O]/d[NO2] */
+    J[2663] -= dqdci;             /* dwdot[NO]/d[NO2] */
+    J[2664] += dqdci;             /* dwdot[NO2]/d[NO2] */
+    /* d()/d[AR] */
+    dqdci = (TB[38][6] - 1)*q_nocor;
+    J[3506] -= dqdci;             /* dwdot[O]/d[AR] */
+    J[3539] -= dqdci;             /* dwdot[NO]/d[AR] */
+    J[3540] += dqdci;             /* dwdot[NO2]/d[AR] */
     J[5258] -= dqdT; /* dwdot[O]/dT */
     J[5291] -= dqdT; /* dwdot[NO]/dT */
     J[5292] += dqdT; /* dwdot[NO2]/dT */
@@ -44055,15 +42256,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 40: NNH + M <=> N2 + H + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[39][0] - 1)*sc[0] + (TB[39][1] - 1)*sc[5] + (TB[39][2] - 1)*sc[13] + (TB[39][3] - 1)*sc[14] + (TB[39][4] - 1)*sc[15] + (TB[39][5] - 1)*sc[26] + (TB[39][6] - 1)*sc[48];
+    alpha = (memcmp(TB[39], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[39][0] - 1)*sc[0] + (TB[39][1] - 1)*sc[5] + (TB[39][2] - 1)*sc[13] + (TB[39][3] - 1)*sc[14] + (TB[39][4] - 1)*sc[15] + (TB[39][5] - 1)*sc[26] + (TB[39][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[34];
-    k_f = prefactor_units[39] * fwd_A[39]
-                * exp(fwd_beta[39] * tc[0] - activation_units[39] * fwd_Ea[39] * invT);
+    k_f = k_f_s[39];
     dlnkfdT = fwd_beta[39] * invT + activation_units[39] * fwd_Ea[39] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[47];
-    Kc = refC * exp(-g_RT[1] + g_RT[34] - g_RT[47]);
+    Kc = Kc_s[39];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[34]) + (h_RT[1] + h_RT[47]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44078,137 +42278,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[39][0] - 1)*q_nocor;
-        J[1] += dqdci;                /* dwdot[H]/d[H2] */
-        J[34] -= dqdci;               /* dwdot[NNH]/d[H2] */
-        J[47] += dqdci;               /* dwdot[N2]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[47];
-        J[74] += dqdci;               /* dwdot[H]/d[H] */
-        J[107] -= dqdci;              /* dwdot[NNH]/d[H] */
-        J[120] += dqdci;              /* dwdot[N2]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[39][1] - 1)*q_nocor;
-        J[366] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[399] -= dqdci;              /* dwdot[NNH]/d[H2O] */
-        J[412] += dqdci;              /* dwdot[N2]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[39][2] - 1)*q_nocor;
-        J[950] += dqdci;              /* dwdot[H]/d[CH4] */
-        J[983] -= dqdci;              /* dwdot[NNH]/d[CH4] */
-        J[996] += dqdci;              /* dwdot[N2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[39][3] - 1)*q_nocor;
-        J[1023] += dqdci;             /* dwdot[H]/d[CO] */
-        J[1056] -= dqdci;             /* dwdot[NNH]/d[CO] */
-        J[1069] += dqdci;             /* dwdot[N2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[39][4] - 1)*q_nocor;
-        J[1096] += dqdci;             /* dwdot[H]/d[CO2] */
-        J[1129] -= dqdci;             /* dwdot[NNH]/d[CO2] */
-        J[1142] += dqdci;             /* dwdot[N2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[39][5] - 1)*q_nocor;
-        J[1899] += dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1932] -= dqdci;             /* dwdot[NNH]/d[C2H6] */
-        J[1945] += dqdci;             /* dwdot[N2]/d[C2H6] */
-        /* d()/d[NNH] */
-        dqdci =  + k_f;
-        J[2483] += dqdci;             /* dwdot[H]/d[NNH] */
-        J[2516] -= dqdci;             /* dwdot[NNH]/d[NNH] */
-        J[2529] += dqdci;             /* dwdot[N2]/d[NNH] */
-        /* d()/d[N2] */
-        dqdci =  - k_r*sc[1];
-        J[3432] += dqdci;             /* dwdot[H]/d[N2] */
-        J[3465] -= dqdci;             /* dwdot[NNH]/d[N2] */
-        J[3478] += dqdci;             /* dwdot[N2]/d[N2] */
-        /* d()/d[AR] */
-        dqdci = (TB[39][6] - 1)*q_nocor;
-        J[3505] += dqdci;             /* dwdot[H]/d[AR] */
-        J[3538] -= dqdci;             /* dwdot[NNH]/d[AR] */
-        J[3551] += dqdci;             /* dwdot[N2]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[39][0];
-        dqdc[1] = dcdc_fac - k_r*sc[47];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[39][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[39][2];
-        dqdc[14] = TB[39][3];
-        dqdc[15] = TB[39][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[39][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac + k_f;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac - k_r*sc[1];
-        dqdc[48] = TB[39][6];
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+1] += dqdc[k];
-            J[73*k+34] -= dqdc[k];
-            J[73*k+47] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] += q_nocor;
+    Jmix[34] -= q_nocor;
+    Jmix[47] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[39][0] - 1)*q_nocor;
+    J[1] += dqdci;                /* dwdot[H]/d[H2] */
+    J[34] -= dqdci;               /* dwdot[NNH]/d[H2] */
+    J[47] += dqdci;               /* dwdot[N2]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[47];
+    J[74] += dqdci;               /* dwdot[H]/d[H] */
+    J[107] -= dqdci;              /* dwdot[NNH]/d[H] */
+    J[120] += dqdci;              /* dwdot[N2]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[39][1] - 1)*q_nocor;
+    J[366] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[399] -= dqdci;              /* dwdot[NNH]/d[H2O] */
+    J[412] += dqdci;              /* dwdot[N2]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[39][2] - 1)*q_nocor;
+    J[950] += dqdci;              /* dwdot[H]/d[CH4] */
+    J[983] -= dqdci;              /* dwdot[NNH]/d[CH4] */
+    J[996] += dqdci;              /* dwdot[N2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[39][3] - 1)*q_nocor;
+    J[1023] += dqdci;             /* dwdot[H]/d[CO] */
+    J[1056] -= dqdci;             /* dwdot[NNH]/d[CO] */
+    J[1069] += dqdci;             /* dwdot[N2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[39][4] - 1)*q_nocor;
+    J[1096] += dqdci;             /* dwdot[H]/d[CO2] */
+    J[1129] -= dqdci;             /* dwdot[NNH]/d[CO2] */
+    J[1142] += dqdci;             /* dwdot[N2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[39][5] - 1)*q_nocor;
+    J[1899] += dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1932] -= dqdci;             /* dwdot[NNH]/d[C2H6] */
+    J[1945] += dqdci;             /* dwdot[N2]/d[C2H6] */
+    /* d()/d[NNH] */
+    dqdci =  + k_f;
+    J[2483] += dqdci;             /* dwdot[H]/d[NNH] */
+    J[2516] -= dqdci;             /* dwdot[NNH]/d[NNH] */
+    J[2529] += dqdci;             /* dwdot[N2]/d[NNH] */
+    /* d()/d[N2] */
+    dqdci =  - k_r*sc[1];
+    J[3432] += dqdci;             /* dwdot[H]/d[N2] */
+    J[3465] -= dqdci;             /* dwdot[NNH]/d[N2] */
+    J[3478] += dqdci;             /* dwdot[N2]/d[N2] */
+    /* d()/d[AR] */
+    dqdci = (TB[39][6] - 1)*q_nocor;
+    J[3505] += dqdci;             /* dwdot[H]/d[AR] */
+    J[3538] -= dqdci;             /* dwdot[NNH]/d[AR] */
+    J[3551] += dqdci;             /* dwdot[N2]/d[AR] */
     J[5257] += dqdT; /* dwdot[H]/dT */
     J[5290] -= dqdT; /* dwdot[NNH]/dT */
     J[5303] += dqdT; /* dwdot[N2]/dT */
@@ -44216,15 +42339,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 41: H + NO + M <=> HNO + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[40][0] - 1)*sc[0] + (TB[40][1] - 1)*sc[5] + (TB[40][2] - 1)*sc[13] + (TB[40][3] - 1)*sc[14] + (TB[40][4] - 1)*sc[15] + (TB[40][5] - 1)*sc[26] + (TB[40][6] - 1)*sc[48];
+    alpha = (memcmp(TB[40], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[40][0] - 1)*sc[0] + (TB[40][1] - 1)*sc[5] + (TB[40][2] - 1)*sc[13] + (TB[40][3] - 1)*sc[14] + (TB[40][4] - 1)*sc[15] + (TB[40][5] - 1)*sc[26] + (TB[40][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[1]*sc[35];
-    k_f = prefactor_units[40] * fwd_A[40]
-                * exp(fwd_beta[40] * tc[0] - activation_units[40] * fwd_Ea[40] * invT);
+    k_f = k_f_s[40];
     dlnkfdT = fwd_beta[40] * invT + activation_units[40] * fwd_Ea[40] * invT2;
     /* reverse */
     phi_r = sc[38];
-    Kc = refCinv * exp(g_RT[1] + g_RT[35] - g_RT[38]);
+    Kc = Kc_s[40];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[35]) + (h_RT[38]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44239,137 +42361,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[40][0] - 1)*q_nocor;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[35] -= dqdci;               /* dwdot[NO]/d[H2] */
-        J[38] += dqdci;               /* dwdot[HNO]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[35];
-        J[74] -= dqdci;               /* dwdot[H]/d[H] */
-        J[108] -= dqdci;              /* dwdot[NO]/d[H] */
-        J[111] += dqdci;              /* dwdot[HNO]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[40][1] - 1)*q_nocor;
-        J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[400] -= dqdci;              /* dwdot[NO]/d[H2O] */
-        J[403] += dqdci;              /* dwdot[HNO]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[40][2] - 1)*q_nocor;
-        J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[984] -= dqdci;              /* dwdot[NO]/d[CH4] */
-        J[987] += dqdci;              /* dwdot[HNO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[40][3] - 1)*q_nocor;
-        J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1057] -= dqdci;             /* dwdot[NO]/d[CO] */
-        J[1060] += dqdci;             /* dwdot[HNO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[40][4] - 1)*q_nocor;
-        J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1130] -= dqdci;             /* dwdot[NO]/d[CO2] */
-        J[1133] += dqdci;             /* dwdot[HNO]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[40][5] - 1)*q_nocor;
-        J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1933] -= dqdci;             /* dwdot[NO]/d[C2H6] */
-        J[1936] += dqdci;             /* dwdot[HNO]/d[C2H6] */
-        /* d()/d[NO] */
-        dqdci =  + k_f*sc[1];
-        J[2556] -= dqdci;             /* dwdot[H]/d[NO] */
-        J[2590] -= dqdci;             /* dwdot[NO]/d[NO] */
-        J[2593] += dqdci;             /* dwdot[HNO]/d[NO] */
-        /* d()/d[HNO] */
-        dqdci =  - k_r;
-        J[2775] -= dqdci;             /* dwdot[H]/d[HNO] */
-        J[2809] -= dqdci;             /* dwdot[NO]/d[HNO] */
-        J[2812] += dqdci;             /* dwdot[HNO]/d[HNO] */
-        /* d()/d[AR] */
-        dqdci = (TB[40][6] - 1)*q_nocor;
-        J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[3539] -= dqdci;             /* dwdot[NO]/d[AR] */
-        J[3542] += dqdci;             /* dwdot[HNO]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[40][0];
-        dqdc[1] = dcdc_fac + k_f*sc[35];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[40][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[40][2];
-        dqdc[14] = TB[40][3];
-        dqdc[15] = TB[40][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[40][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac + k_f*sc[1];
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac - k_r;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[40][6];
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+1] -= dqdc[k];
-            J[73*k+35] -= dqdc[k];
-            J[73*k+38] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= q_nocor;
+    Jmix[35] -= q_nocor;
+    Jmix[38] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[40][0] - 1)*q_nocor;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[35] -= dqdci;               /* dwdot[NO]/d[H2] */
+    J[38] += dqdci;               /* dwdot[HNO]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[35];
+    J[74] -= dqdci;               /* dwdot[H]/d[H] */
+    J[108] -= dqdci;              /* dwdot[NO]/d[H] */
+    J[111] += dqdci;              /* dwdot[HNO]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[40][1] - 1)*q_nocor;
+    J[366] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[400] -= dqdci;              /* dwdot[NO]/d[H2O] */
+    J[403] += dqdci;              /* dwdot[HNO]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[40][2] - 1)*q_nocor;
+    J[950] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[984] -= dqdci;              /* dwdot[NO]/d[CH4] */
+    J[987] += dqdci;              /* dwdot[HNO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[40][3] - 1)*q_nocor;
+    J[1023] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1057] -= dqdci;             /* dwdot[NO]/d[CO] */
+    J[1060] += dqdci;             /* dwdot[HNO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[40][4] - 1)*q_nocor;
+    J[1096] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1130] -= dqdci;             /* dwdot[NO]/d[CO2] */
+    J[1133] += dqdci;             /* dwdot[HNO]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[40][5] - 1)*q_nocor;
+    J[1899] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1933] -= dqdci;             /* dwdot[NO]/d[C2H6] */
+    J[1936] += dqdci;             /* dwdot[HNO]/d[C2H6] */
+    /* d()/d[NO] */
+    dqdci =  + k_f*sc[1];
+    J[2556] -= dqdci;             /* dwdot[H]/d[NO] */
+    J[2590] -= dqdci;             /* dwdot[NO]/d[NO] */
+    J[2593] += dqdci;             /* dwdot[HNO]/d[NO] */
+    /* d()/d[HNO] */
+    dqdci =  - k_r;
+    J[2775] -= dqdci;             /* dwdot[H]/d[HNO] */
+    J[2809] -= dqdci;             /* dwdot[NO]/d[HNO] */
+    J[2812] += dqdci;             /* dwdot[HNO]/d[HNO] */
+    /* d()/d[AR] */
+    dqdci = (TB[40][6] - 1)*q_nocor;
+    J[3505] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[3539] -= dqdci;             /* dwdot[NO]/d[AR] */
+    J[3542] += dqdci;             /* dwdot[HNO]/d[AR] */
     J[5257] -= dqdT; /* dwdot[H]/dT */
     J[5291] -= dqdT; /* dwdot[NO]/dT */
     J[5294] += dqdT; /* dwdot[HNO]/dT */
@@ -44377,15 +42422,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 42: NCO + M <=> N + CO + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[41][0] - 1)*sc[0] + (TB[41][1] - 1)*sc[5] + (TB[41][2] - 1)*sc[13] + (TB[41][3] - 1)*sc[14] + (TB[41][4] - 1)*sc[15] + (TB[41][5] - 1)*sc[26] + (TB[41][6] - 1)*sc[48];
+    alpha = (memcmp(TB[41], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[41][0] - 1)*sc[0] + (TB[41][1] - 1)*sc[5] + (TB[41][2] - 1)*sc[13] + (TB[41][3] - 1)*sc[14] + (TB[41][4] - 1)*sc[15] + (TB[41][5] - 1)*sc[26] + (TB[41][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[46];
-    k_f = prefactor_units[41] * fwd_A[41]
-                * exp(fwd_beta[41] * tc[0] - activation_units[41] * fwd_Ea[41] * invT);
+    k_f = k_f_s[41];
     dlnkfdT = fwd_beta[41] * invT + activation_units[41] * fwd_Ea[41] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[30];
-    Kc = refC * exp(-g_RT[14] - g_RT[30] + g_RT[46]);
+    Kc = Kc_s[41];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[46]) + (h_RT[14] + h_RT[30]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44400,132 +42444,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[41][0] - 1)*q_nocor;
-        J[14] += dqdci;               /* dwdot[CO]/d[H2] */
-        J[30] += dqdci;               /* dwdot[N]/d[H2] */
-        J[46] -= dqdci;               /* dwdot[NCO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[41][1] - 1)*q_nocor;
-        J[379] += dqdci;              /* dwdot[CO]/d[H2O] */
-        J[395] += dqdci;              /* dwdot[N]/d[H2O] */
-        J[411] -= dqdci;              /* dwdot[NCO]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[41][2] - 1)*q_nocor;
-        J[963] += dqdci;              /* dwdot[CO]/d[CH4] */
-        J[979] += dqdci;              /* dwdot[N]/d[CH4] */
-        J[995] -= dqdci;              /* dwdot[NCO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[41][3] - 1)*q_nocor - k_r*sc[30];
-        J[1036] += dqdci;             /* dwdot[CO]/d[CO] */
-        J[1052] += dqdci;             /* dwdot[N]/d[CO] */
-        J[1068] -= dqdci;             /* dwdot[NCO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[41][4] - 1)*q_nocor;
-        J[1109] += dqdci;             /* dwdot[CO]/d[CO2] */
-        J[1125] += dqdci;             /* dwdot[N]/d[CO2] */
-        J[1141] -= dqdci;             /* dwdot[NCO]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[41][5] - 1)*q_nocor;
-        J[1912] += dqdci;             /* dwdot[CO]/d[C2H6] */
-        J[1928] += dqdci;             /* dwdot[N]/d[C2H6] */
-        J[1944] -= dqdci;             /* dwdot[NCO]/d[C2H6] */
-        /* d()/d[N] */
-        dqdci =  - k_r*sc[14];
-        J[2204] += dqdci;             /* dwdot[CO]/d[N] */
-        J[2220] += dqdci;             /* dwdot[N]/d[N] */
-        J[2236] -= dqdci;             /* dwdot[NCO]/d[N] */
-        /* d()/d[NCO] */
-        dqdci =  + k_f;
-        J[3372] += dqdci;             /* dwdot[CO]/d[NCO] */
-        J[3388] += dqdci;             /* dwdot[N]/d[NCO] */
-        J[3404] -= dqdci;             /* dwdot[NCO]/d[NCO] */
-        /* d()/d[AR] */
-        dqdci = (TB[41][6] - 1)*q_nocor;
-        J[3518] += dqdci;             /* dwdot[CO]/d[AR] */
-        J[3534] += dqdci;             /* dwdot[N]/d[AR] */
-        J[3550] -= dqdci;             /* dwdot[NCO]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[41][0];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[41][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[41][2];
-        dqdc[14] = TB[41][3] - k_r*sc[30];
-        dqdc[15] = TB[41][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[41][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac - k_r*sc[14];
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac + k_f;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[41][6];
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+14] += dqdc[k];
-            J[73*k+30] += dqdc[k];
-            J[73*k+46] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[14] += q_nocor;
+    Jmix[30] += q_nocor;
+    Jmix[46] -= q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[41][0] - 1)*q_nocor;
+    J[14] += dqdci;               /* dwdot[CO]/d[H2] */
+    J[30] += dqdci;               /* dwdot[N]/d[H2] */
+    J[46] -= dqdci;               /* dwdot[NCO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[41][1] - 1)*q_nocor;
+    J[379] += dqdci;              /* dwdot[CO]/d[H2O] */
+    J[395] += dqdci;              /* dwdot[N]/d[H2O] */
+    J[411] -= dqdci;              /* dwdot[NCO]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[41][2] - 1)*q_nocor;
+    J[963] += dqdci;              /* dwdot[CO]/d[CH4] */
+    J[979] += dqdci;              /* dwdot[N]/d[CH4] */
+    J[995] -= dqdci;              /* dwdot[NCO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[41][3] - 1)*q_nocor - k_r*sc[30];
+    J[1036] += dqdci;             /* dwdot[CO]/d[CO] */
+    J[1052] += dqdci;             /* dwdot[N]/d[CO] */
+    J[1068] -= dqdci;             /* dwdot[NCO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[41][4] - 1)*q_nocor;
+    J[1109] += dqdci;             /* dwdot[CO]/d[CO2] */
+    J[1125] += dqdci;             /* dwdot[N]/d[CO2] */
+    J[1141] -= dqdci;             /* dwdot[NCO]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[41][5] - 1)*q_nocor;
+    J[1912] += dqdci;             /* dwdot[CO]/d[C2H6] */
+    J[1928] += dqdci;             /* dwdot[N]/d[C2H6] */
+    J[1944] -= dqdci;             /* dwdot[NCO]/d[C2H6] */
+    /* d()/d[N] */
+    dqdci =  - k_r*sc[14];
+    J[2204] += dqdci;             /* dwdot[CO]/d[N] */
+    J[2220] += dqdci;             /* dwdot[N]/d[N] */
+    J[2236] -= dqdci;             /* dwdot[NCO]/d[N] */
+    /* d()/d[NCO] */
+    dqdci =  + k_f;
+    J[3372] += dqdci;             /* dwdot[CO]/d[NCO] */
+    J[3388] += dqdci;             /* dwdot[N]/d[NCO] */
+    J[3404] -= dqdci;             /* dwdot[NCO]/d[NCO] */
+    /* d()/d[AR] */
+    dqdci = (TB[41][6] - 1)*q_nocor;
+    J[3518] += dqdci;             /* dwdot[CO]/d[AR] */
+    J[3534] += dqdci;             /* dwdot[N]/d[AR] */
+    J[3550] -= dqdci;             /* dwdot[NCO]/d[AR] */
     J[5270] += dqdT; /* dwdot[CO]/dT */
     J[5286] += dqdT; /* dwdot[N]/dT */
     J[5302] -= dqdT; /* dwdot[NCO]/dT */
@@ -44533,15 +42500,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 43: HCN + M <=> H + CN + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[42][0] - 1)*sc[0] + (TB[42][1] - 1)*sc[5] + (TB[42][2] - 1)*sc[13] + (TB[42][3] - 1)*sc[14] + (TB[42][4] - 1)*sc[15] + (TB[42][5] - 1)*sc[26] + (TB[42][6] - 1)*sc[48];
+    alpha = (memcmp(TB[42], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[42][0] - 1)*sc[0] + (TB[42][1] - 1)*sc[5] + (TB[42][2] - 1)*sc[13] + (TB[42][3] - 1)*sc[14] + (TB[42][4] - 1)*sc[15] + (TB[42][5] - 1)*sc[26] + (TB[42][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[40];
-    k_f = prefactor_units[42] * fwd_A[42]
-                * exp(fwd_beta[42] * tc[0] - activation_units[42] * fwd_Ea[42] * invT);
+    k_f = k_f_s[42];
     dlnkfdT = fwd_beta[42] * invT + activation_units[42] * fwd_Ea[42] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[39];
-    Kc = refC * exp(-g_RT[1] - g_RT[39] + g_RT[40]);
+    Kc = Kc_s[42];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[40]) + (h_RT[1] + h_RT[39]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44556,137 +42522,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[42][0] - 1)*q_nocor;
-        J[1] += dqdci;                /* dwdot[H]/d[H2] */
-        J[39] += dqdci;               /* dwdot[CN]/d[H2] */
-        J[40] -= dqdci;               /* dwdot[HCN]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[39];
-        J[74] += dqdci;               /* dwdot[H]/d[H] */
-        J[112] += dqdci;              /* dwdot[CN]/d[H] */
-        J[113] -= dqdci;              /* dwdot[HCN]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[42][1] - 1)*q_nocor;
-        J[366] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[404] += dqdci;              /* dwdot[CN]/d[H2O] */
-        J[405] -= dqdci;              /* dwdot[HCN]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[42][2] - 1)*q_nocor;
-        J[950] += dqdci;              /* dwdot[H]/d[CH4] */
-        J[988] += dqdci;              /* dwdot[CN]/d[CH4] */
-        J[989] -= dqdci;              /* dwdot[HCN]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[42][3] - 1)*q_nocor;
-        J[1023] += dqdci;             /* dwdot[H]/d[CO] */
-        J[1061] += dqdci;             /* dwdot[CN]/d[CO] */
-        J[1062] -= dqdci;             /* dwdot[HCN]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[42][4] - 1)*q_nocor;
-        J[1096] += dqdci;             /* dwdot[H]/d[CO2] */
-        J[1134] += dqdci;             /* dwdot[CN]/d[CO2] */
-        J[1135] -= dqdci;             /* dwdot[HCN]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[42][5] - 1)*q_nocor;
-        J[1899] += dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1937] += dqdci;             /* dwdot[CN]/d[C2H6] */
-        J[1938] -= dqdci;             /* dwdot[HCN]/d[C2H6] */
-        /* d()/d[CN] */
-        dqdci =  - k_r*sc[1];
-        J[2848] += dqdci;             /* dwdot[H]/d[CN] */
-        J[2886] += dqdci;             /* dwdot[CN]/d[CN] */
-        J[2887] -= dqdci;             /* dwdot[HCN]/d[CN] */
-        /* d()/d[HCN] */
-        dqdci =  + k_f;
-        J[2921] += dqdci;             /* dwdot[H]/d[HCN] */
-        J[2959] += dqdci;             /* dwdot[CN]/d[HCN] */
-        J[2960] -= dqdci;             /* dwdot[HCN]/d[HCN] */
-        /* d()/d[AR] */
-        dqdci = (TB[42][6] - 1)*q_nocor;
-        J[3505] += dqdci;             /* dwdot[H]/d[AR] */
-        J[3543] += dqdci;             /* dwdot[CN]/d[AR] */
-        J[3544] -= dqdci;             /* dwdot[HCN]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[42][0];
-        dqdc[1] = dcdc_fac - k_r*sc[39];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[42][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[42][2];
-        dqdc[14] = TB[42][3];
-        dqdc[15] = TB[42][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[42][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac - k_r*sc[1];
-        dqdc[40] = dcdc_fac + k_f;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[42][6];
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+1] += dqdc[k];
-            J[73*k+39] += dqdc[k];
-            J[73*k+40] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] += q_nocor;
+    Jmix[39] += q_nocor;
+    Jmix[40] -= q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[42][0] - 1)*q_nocor;
+    J[1] += dqdci;                /* dwdot[H]/d[H2] */
+    J[39] += dqdci;               /* dwdot[CN]/d[H2] */
+    J[40] -= dqdci;               /* dwdot[HCN]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[39];
+    J[74] += dqdci;               /* dwdot[H]/d[H] */
+    J[112] += dqdci;              /* dwdot[CN]/d[H] */
+    J[113] -= dqdci;              /* dwdot[HCN]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[42][1] - 1)*q_nocor;
+    J[366] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[404] += dqdci;              /* dwdot[CN]/d[H2O] */
+    J[405] -= dqdci;              /* dwdot[HCN]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[42][2] - 1)*q_nocor;
+    J[950] += dqdci;              /* dwdot[H]/d[CH4] */
+    J[988] += dqdci;              /* dwdot[CN]/d[CH4] */
+    J[989] -= dqdci;              /* dwdot[HCN]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[42][3] - 1)*q_nocor;
+    J[1023] += dqdci;             /* dwdot[H]/d[CO] */
+    J[1061] += dqdci;             /* dwdot[CN]/d[CO] */
+    J[1062] -= dqdci;             /* dwdot[HCN]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[42][4] - 1)*q_nocor;
+    J[1096] += dqdci;             /* dwdot[H]/d[CO2] */
+    J[1134] += dqdci;             /* dwdot[CN]/d[CO2] */
+    J[1135] -= dqdci;             /* dwdot[HCN]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[42][5] - 1)*q_nocor;
+    J[1899] += dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1937] += dqdci;             /* dwdot[CN]/d[C2H6] */
+    J[1938] -= dqdci;             /* dwdot[HCN]/d[C2H6] */
+    /* d()/d[CN] */
+    dqdci =  - k_r*sc[1];
+    J[2848] += dqdci;             /* dwdot[H]/d[CN] */
+    J[2886] += dqdci;             /* dwdot[CN]/d[CN] */
+    J[2887] -= dqdci;             /* dwdot[HCN]/d[CN] */
+    /* d()/d[HCN] */
+    dqdci =  + k_f;
+    J[2921] += dqdci;             /* dwdot[H]/d[HCN] */
+    J[2959] += dqdci;             /* dwdot[CN]/d[HCN] */
+    J[2960] -= dqdci;             /* dwdot[HCN]/d[HCN] */
+    /* d()/d[AR] */
+    dqdci = (TB[42][6] - 1)*q_nocor;
+    J[3505] += dqdci;             /* dwdot[H]/d[AR] */
+    J[3543] += dqdci;             /* dwdot[CN]/d[AR] */
+    J[3544] -= dqdci;             /* dwdot[HCN]/d[AR] */
     J[5257] += dqdT; /* dwdot[H]/dT */
     J[5295] += dqdT; /* dwdot[CN]/dT */
     J[5296] -= dqdT; /* dwdot[HCN]/dT */
@@ -44694,15 +42583,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 44: HNCO + M <=> NH + CO + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[43][0] - 1)*sc[0] + (TB[43][1] - 1)*sc[5] + (TB[43][2] - 1)*sc[13] + (TB[43][3] - 1)*sc[14] + (TB[43][4] - 1)*sc[15] + (TB[43][5] - 1)*sc[26] + (TB[43][6] - 1)*sc[48];
+    alpha = (memcmp(TB[43], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[43][0] - 1)*sc[0] + (TB[43][1] - 1)*sc[5] + (TB[43][2] - 1)*sc[13] + (TB[43][3] - 1)*sc[14] + (TB[43][4] - 1)*sc[15] + (TB[43][5] - 1)*sc[26] + (TB[43][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[45];
-    k_f = prefactor_units[43] * fwd_A[43]
-                * exp(fwd_beta[43] * tc[0] - activation_units[43] * fwd_Ea[43] * invT);
+    k_f = k_f_s[43];
     dlnkfdT = fwd_beta[43] * invT + activation_units[43] * fwd_Ea[43] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[31];
-    Kc = refC * exp(-g_RT[14] - g_RT[31] + g_RT[45]);
+    Kc = Kc_s[43];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[45]) + (h_RT[14] + h_RT[31]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44717,132 +42605,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[43][0] - 1)*q_nocor;
-        J[14] += dqdci;               /* dwdot[CO]/d[H2] */
-        J[31] += dqdci;               /* dwdot[NH]/d[H2] */
-        J[45] -= dqdci;               /* dwdot[HNCO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[43][1] - 1)*q_nocor;
-        J[379] += dqdci;              /* dwdot[CO]/d[H2O] */
-        J[396] += dqdci;              /* dwdot[NH]/d[H2O] */
-        J[410] -= dqdci;              /* dwdot[HNCO]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[43][2] - 1)*q_nocor;
-        J[963] += dqdci;              /* dwdot[CO]/d[CH4] */
-        J[980] += dqdci;              /* dwdot[NH]/d[CH4] */
-        J[994] -= dqdci;              /* dwdot[HNCO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[43][3] - 1)*q_nocor - k_r*sc[31];
-        J[1036] += dqdci;             /* dwdot[CO]/d[CO] */
-        J[1053] += dqdci;             /* dwdot[NH]/d[CO] */
-        J[1067] -= dqdci;             /* dwdot[HNCO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[43][4] - 1)*q_nocor;
-        J[1109] += dqdci;             /* dwdot[CO]/d[CO2] */
-        J[1126] += dqdci;             /* dwdot[NH]/d[CO2] */
-        J[1140] -= dqdci;             /* dwdot[HNCO]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[43][5] - 1)*q_nocor;
-        J[1912] += dqdci;             /* dwdot[CO]/d[C2H6] */
-        J[1929] += dqdci;             /* dwdot[NH]/d[C2H6] */
-        J[1943] -= dqdci;             /* dwdot[HNCO]/d[C2H6] */
-        /* d()/d[NH] */
-        dqdci =  - k_r*sc[14];
-        J[2277] += dqdci;             /* dwdot[CO]/d[NH] */
-        J[2294] += dqdci;             /* dwdot[NH]/d[NH] */
-        J[2308] -= dqdci;             /* dwdot[HNCO]/d[NH] */
-        /* d()/d[HNCO] */
-        dqdci =  + k_f;
-        J[3299] += dqdci;             /* dwdot[CO]/d[HNCO] */
-        J[3316] += dqdci;             /* dwdot[NH]/d[HNCO] */
-        J[3330] -= dqdci;             /* dwdot[HNCO]/d[HNCO] */
-        /* d()/d[AR] */
-        dqdci = (TB[43][6] - 1)*q_nocor;
-        J[3518] += dqdci;             /* dwdot[CO]/d[AR] */
-        J[3535] += dqdci;             /* dwdot[NH]/d[AR] */
-        J[3549] -= dqdci;             /* dwdot[HNCO]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[43][0];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[43][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[43][2];
-        dqdc[14] = TB[43][3] - k_r*sc[31];
-        dqdc[15] = TB[43][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[43][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac - k_r*sc[14];
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac + k_f;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[43][6];
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+14] += dqdc[k];
-            J[73*k+31] += dqdc[k];
-            J[73*k+45] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[14] += q_nocor;
+    Jmix[31] += q_nocor;
+    Jmix[45] -= q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[43][0] - 1)*q_nocor;
+    J[14] += dqdci;               /* dwdot[CO]/d[H2] */
+    J[31] += dqdci;               /* dwdot[NH]/d[H2] */
+    J[45] -= dqdci;               /* dwdot[HNCO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[43][1] - 1)*q_nocor;
+    J[379] += dqdci;              /* dwdot[CO]/d[H2O] */
+    J[396] += dqdci;              /* dwdot[NH]/d[H2O] */
+    J[410] -= dqdci;              /* dwdot[HNCO]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[43][2] - 1)*q_nocor;
+    J[963] += dqdci;              /* dwdot[CO]/d[CH4] */
+    J[980] += dqdci;              /* dwdot[NH]/d[CH4] */
+    J[994] -= dqdci;              /* dwdot[HNCO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[43][3] - 1)*q_nocor - k_r*sc[31];
+    J[1036] += dqdci;             /* dwdot[CO]/d[CO] */
+    J[1053] += dqdci;             /* dwdot[NH]/d[CO] */
+    J[1067] -= dqdci;             /* dwdot[HNCO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[43][4] - 1)*q_nocor;
+    J[1109] += dqdci;             /* dwdot[CO]/d[CO2] */
+    J[1126] += dqdci;             /* dwdot[NH]/d[CO2] */
+    J[1140] -= dqdci;             /* dwdot[HNCO]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[43][5] - 1)*q_nocor;
+    J[1912] += dqdci;             /* dwdot[CO]/d[C2H6] */
+    J[1929] += dqdci;             /* dwdot[NH]/d[C2H6] */
+    J[1943] -= dqdci;             /* dwdot[HNCO]/d[C2H6] */
+    /* d()/d[NH] */
+    dqdci =  - k_r*sc[14];
+    J[2277] += dqdci;             /* dwdot[CO]/d[NH] */
+    J[2294] += dqdci;             /* dwdot[NH]/d[NH] */
+    J[2308] -= dqdci;             /* dwdot[HNCO]/d[NH] */
+    /* d()/d[HNCO] */
+    dqdci =  + k_f;
+    J[3299] += dqdci;             /* dwdot[CO]/d[HNCO] */
+    J[3316] += dqdci;             /* dwdot[NH]/d[HNCO] */
+    J[3330] -= dqdci;             /* dwdot[HNCO]/d[HNCO] */
+    /* d()/d[AR] */
+    dqdci = (TB[43][6] - 1)*q_nocor;
+    J[3518] += dqdci;             /* dwdot[CO]/d[AR] */
+    J[3535] += dqdci;             /* dwdot[NH]/d[AR] */
+    J[3549] -= dqdci;             /* dwdot[HNCO]/d[AR] */
     J[5270] += dqdT; /* dwdot[CO]/dT */
     J[5287] += dqdT; /* dwdot[NH]/dT */
     J[5301] -= dqdT; /* dwdot[HNCO]/dT */
@@ -44853,12 +42664,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[44][0] - 1)*sc[0] + (TB[44][1] - 1)*sc[5] + (TB[44][2] - 1)*sc[13] + (TB[44][3] - 1)*sc[14] + (TB[44][4] - 1)*sc[15] + (TB[44][5] - 1)*sc[26];
     /* forward */
     phi_f = sc[14]*sc[54];
-    k_f = prefactor_units[44] * fwd_A[44]
-                * exp(fwd_beta[44] * tc[0] - activation_units[44] * fwd_Ea[44] * invT);
+    k_f = k_f_s[44];
     dlnkfdT = fwd_beta[44] * invT + activation_units[44] * fwd_Ea[44] * invT2;
     /* reverse */
     phi_r = sc[69];
-    Kc = refCinv * exp(g_RT[14] + g_RT[54] - g_RT[69]);
+    Kc = Kc_s[44];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[14] + h_RT[54]) + (h_RT[69]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44873,127 +42683,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[44][0] - 1)*q_nocor;
-        J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
-        J[54] -= dqdci;               /* dwdot[F]/d[H2] */
-        J[69] += dqdci;               /* dwdot[CFO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[44][1] - 1)*q_nocor;
-        J[379] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[419] -= dqdci;              /* dwdot[F]/d[H2O] */
-        J[434] += dqdci;              /* dwdot[CFO]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[44][2] - 1)*q_nocor;
-        J[963] -= dqdci;              /* dwdot[CO]/d[CH4] */
-        J[1003] -= dqdci;             /* dwdot[F]/d[CH4] */
-        J[1018] += dqdci;             /* dwdot[CFO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[44][3] - 1)*q_nocor + k_f*sc[54];
-        J[1036] -= dqdci;             /* dwdot[CO]/d[CO] */
-        J[1076] -= dqdci;             /* dwdot[F]/d[CO] */
-        J[1091] += dqdci;             /* dwdot[CFO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[44][4] - 1)*q_nocor;
-        J[1109] -= dqdci;             /* dwdot[CO]/d[CO2] */
-        J[1149] -= dqdci;             /* dwdot[F]/d[CO2] */
-        J[1164] += dqdci;             /* dwdot[CFO]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[44][5] - 1)*q_nocor;
-        J[1912] -= dqdci;             /* dwdot[CO]/d[C2H6] */
-        J[1952] -= dqdci;             /* dwdot[F]/d[C2H6] */
-        J[1967] += dqdci;             /* dwdot[CFO]/d[C2H6] */
-        /* d()/d[F] */
-        dqdci =  + k_f*sc[14];
-        J[3956] -= dqdci;             /* dwdot[CO]/d[F] */
-        J[3996] -= dqdci;             /* dwdot[F]/d[F] */
-        J[4011] += dqdci;             /* dwdot[CFO]/d[F] */
-        /* d()/d[CFO] */
-        dqdci =  - k_r;
-        J[5051] -= dqdci;             /* dwdot[CO]/d[CFO] */
-        J[5091] -= dqdci;             /* dwdot[F]/d[CFO] */
-        J[5106] += dqdci;             /* dwdot[CFO]/d[CFO] */
-    }
-    else {
-        dqdc[0] = TB[44][0];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[44][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[44][2];
-        dqdc[14] = TB[44][3] + k_f*sc[54];
-        dqdc[15] = TB[44][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[44][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac + k_f*sc[14];
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac - k_r;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+14] -= dqdc[k];
-            J[73*k+54] -= dqdc[k];
-            J[73*k+69] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[14] -= q_nocor;
+    Jmix[54] -= q_nocor;
+    Jmix[69] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[44][0] - 1)*q_nocor;
+    J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
+    J[54] -= dqdci;               /* dwdot[F]/d[H2] */
+    J[69] += dqdci;               /* dwdot[CFO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[44][1] - 1)*q_nocor;
+    J[379] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[419] -= dqdci;              /* dwdot[F]/d[H2O] */
+    J[434] += dqdci;              /* dwdot[CFO]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[44][2] - 1)*q_nocor;
+    J[963] -= dqdci;              /* dwdot[CO]/d[CH4] */
+    J[1003] -= dqdci;             /* dwdot[F]/d[CH4] */
+    J[1018] += dqdci;             /* dwdot[CFO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[44][3] - 1)*q_nocor + k_f*sc[54];
+    J[1036] -= dqdci;             /* dwdot[CO]/d[CO] */
+    J[1076] -= dqdci;             /* dwdot[F]/d[CO] */
+    J[1091] += dqdci;             /* dwdot[CFO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[44][4] - 1)*q_nocor;
+    J[1109] -= dqdci;             /* dwdot[CO]/d[CO2] */
+    J[1149] -= dqdci;             /* dwdot[F]/d[CO2] */
+    J[1164] += dqdci;             /* dwdot[CFO]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[44][5] - 1)*q_nocor;
+    J[1912] -= dqdci;             /* dwdot[CO]/d[C2H6] */
+    J[1952] -= dqdci;             /* dwdot[F]/d[C2H6] */
+    J[1967] += dqdci;             /* dwdot[CFO]/d[C2H6] */
+    /* d()/d[F] */
+    dqdci =  + k_f*sc[14];
+    J[3956] -= dqdci;             /* dwdot[CO]/d[F] */
+    J[3996] -= dqdci;             /* dwdot[F]/d[F] */
+    J[4011] += dqdci;             /* dwdot[CFO]/d[F] */
+    /* d()/d[CFO] */
+    dqdci =  - k_r;
+    J[5051] -= dqdci;             /* dwdot[CO]/d[CFO] */
+    J[5091] -= dqdci;             /* dwdot[F]/d[CFO] */
+    J[5106] += dqdci;             /* dwdot[CFO]/d[CFO] */
     J[5270] -= dqdT; /* dwdot[CO]/dT */
     J[5310] -= dqdT; /* dwdot[F]/dT */
     J[5325] += dqdT; /* dwdot[CFO]/dT */
@@ -45004,12 +42737,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[53];
-    k_f = prefactor_units[45] * fwd_A[45]
-                * exp(fwd_beta[45] * tc[0] - activation_units[45] * fwd_Ea[45] * invT);
+    k_f = k_f_s[45];
     dlnkfdT = fwd_beta[45] * invT + activation_units[45] * fwd_Ea[45] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[54];
-    Kc = refC * exp(-g_RT[1] + g_RT[53] - g_RT[54]);
+    Kc = Kc_s[45];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[53]) + (h_RT[1] + h_RT[54]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45024,102 +42756,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[54];
-        J[74] += dqdci;               /* dwdot[H]/d[H] */
-        J[126] -= dqdci;              /* dwdot[HF]/d[H] */
-        J[127] += dqdci;              /* dwdot[F]/d[H] */
-        /* d()/d[HF] */
-        dqdci =  + k_f;
-        J[3870] += dqdci;             /* dwdot[H]/d[HF] */
-        J[3922] -= dqdci;             /* dwdot[HF]/d[HF] */
-        J[3923] += dqdci;             /* dwdot[F]/d[HF] */
-        /* d()/d[F] */
-        dqdci =  - k_r*sc[1];
-        J[3943] += dqdci;             /* dwdot[H]/d[F] */
-        J[3995] -= dqdci;             /* dwdot[HF]/d[F] */
-        J[3996] += dqdci;             /* dwdot[F]/d[F] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac - k_r*sc[54];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac + k_f;
-        dqdc[54] = dcdc_fac - k_r*sc[1];
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+1] += dqdc[k];
-            J[73*k+53] -= dqdc[k];
-            J[73*k+54] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] += q_nocor;
+    Jmix[53] -= q_nocor;
+    Jmix[54] += q_nocor;
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[54];
+    J[74] += dqdci;               /* dwdot[H]/d[H] */
+    J[126] -= dqdci;              /* dwdot[HF]/d[H] */
+    J[127] += dqdci;              /* dwdot[F]/d[H] */
+    /* d()/d[HF] */
+    dqdci =  + k_f;
+    J[3870] += dqdci;             /* dwdot[H]/d[HF] */
+    J[3922] -= dqdci;             /* dwdot[HF]/d[HF] */
+    J[3923] += dqdci;             /* dwdot[F]/d[HF] */
+    /* d()/d[F] */
+    dqdci =  - k_r*sc[1];
+    J[3943] += dqdci;             /* dwdot[H]/d[F] */
+    J[3995] -= dqdci;             /* dwdot[HF]/d[F] */
+    J[3996] += dqdci;             /* dwdot[F]/d[F] */
     J[5257] += dqdT; /* dwdot[H]/dT */
     J[5309] -= dqdT; /* dwdot[HF]/dT */
     J[5310] += dqdT; /* dwdot[F]/dT */
@@ -45127,15 +42782,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 47: CHF + HF + M <=> CH2F2 + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[46][0] - 1)*sc[0] + (TB[46][1] - 1)*sc[5] + (TB[46][2] - 1)*sc[13] + (TB[46][3] - 1)*sc[14] + (TB[46][4] - 1)*sc[15] + (TB[46][5] - 1)*sc[26] + (TB[46][6] - 1)*sc[56] + (TB[46][7] - 1)*sc[57] + (TB[46][8] - 1)*sc[58] + (TB[46][9] - 1)*sc[53];
+    alpha = (memcmp(TB[46], TB[29], 10*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[46][0] - 1)*sc[0] + (TB[46][1] - 1)*sc[5] + (TB[46][2] - 1)*sc[13] + (TB[46][3] - 1)*sc[14] + (TB[46][4] - 1)*sc[15] + (TB[46][5] - 1)*sc[26] + (TB[46][6] - 1)*sc[56] + (TB[46][7] - 1)*sc[57] + (TB[46][8] - 1)*sc[58] + (TB[46][9] - 1)*sc[53]);
     /* forward */
     phi_f = sc[53]*sc[63];
-    k_f = prefactor_units[46] * fwd_A[46]
-                * exp(fwd_beta[46] * tc[0] - activation_units[46] * fwd_Ea[46] * invT);
+    k_f = k_f_s[46];
     dlnkfdT = fwd_beta[46] * invT + activation_units[46] * fwd_Ea[46] * invT2;
     /* reverse */
     phi_r = sc[57];
-    Kc = refCinv * exp(g_RT[53] - g_RT[57] + g_RT[63]);
+    Kc = Kc_s[46];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[53] + h_RT[63]) + (h_RT[57]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45150,142 +42804,65 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[46][0] - 1)*q_nocor;
-        J[53] -= dqdci;               /* dwdot[HF]/d[H2] */
-        J[57] += dqdci;               /* dwdot[CH2F2]/d[H2] */
-        J[63] -= dqdci;               /* dwdot[CHF]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[46][1] - 1)*q_nocor;
-        J[418] -= dqdci;              /* dwdot[HF]/d[H2O] */
-        J[422] += dqdci;              /* dwdot[CH2F2]/d[H2O] */
-        J[428] -= dqdci;              /* dwdot[CHF]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[46][2] - 1)*q_nocor;
-        J[1002] -= dqdci;             /* dwdot[HF]/d[CH4] */
-        J[1006] += dqdci;             /* dwdot[CH2F2]/d[CH4] */
-        J[1012] -= dqdci;             /* dwdot[CHF]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[46][3] - 1)*q_nocor;
-        J[1075] -= dqdci;             /* dwdot[HF]/d[CO] */
-        J[1079] += dqdci;             /* dwdot[CH2F2]/d[CO] */
-        J[1085] -= dqdci;             /* dwdot[CHF]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[46][4] - 1)*q_nocor;
-        J[1148] -= dqdci;             /* dwdot[HF]/d[CO2] */
-        J[1152] += dqdci;             /* dwdot[CH2F2]/d[CO2] */
-        J[1158] -= dqdci;             /* dwdot[CHF]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[46][5] - 1)*q_nocor;
-        J[1951] -= dqdci;             /* dwdot[HF]/d[C2H6] */
-        J[1955] += dqdci;             /* dwdot[CH2F2]/d[C2H6] */
-        J[1961] -= dqdci;             /* dwdot[CHF]/d[C2H6] */
-        /* d()/d[HF] */
-        dqdci = (TB[46][9] - 1)*q_nocor + k_f*sc[63];
-        J[3922] -= dqdci;             /* dwdot[HF]/d[HF] */
-        J[3926] += dqdci;             /* dwdot[CH2F2]/d[HF] */
-        J[3932] -= dqdci;             /* dwdot[CHF]/d[HF] */
-        /* d()/d[CH3F] */
-        dqdci = (TB[46][6] - 1)*q_nocor;
-        J[4141] -= dqdci;             /* dwdot[HF]/d[CH3F] */
-        J[4145] += dqdci;             /* dwdot[CH2F2]/d[CH3F] */
-        J[4151] -= dqdci;             /* dwdot[CHF]/d[CH3F] */
-        /* d()/d[CH2F2] */
-        dqdci = (TB[46][7] - 1)*q_nocor - k_r;
-        J[4214] -= dqdci;             /* dwdot[HF]/d[CH2F2] */
-        J[4218] += dqdci;             /* dwdot[CH2F2]/d[CH2F2] */
-        J[4224] -= dqdci;             /* dwdot[CHF]/d[CH2F2] */
-        /* d()/d[CHF3] */
-        dqdci = (TB[46][8] - 1)*q_nocor;
-        J[4287] -= dqdci;             /* dwdot[HF]/d[CHF3] */
-        J[4291] += dqdci;             /* dwdot[CH2F2]/d[CHF3] */
-        J[4297] -= dqdci;             /* dwdot[CHF]/d[CHF3] */
-        /* d()/d[CHF] */
-        dqdci =  + k_f*sc[53];
-        J[4652] -= dqdci;             /* dwdot[HF]/d[CHF] */
-        J[4656] += dqdci;             /* dwdot[CH2F2]/d[CHF] */
-        J[4662] -= dqdci;             /* dwdot[CHF]/d[CHF] */
-    }
-    else {
-        dqdc[0] = TB[46][0];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[46][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[46][2];
-        dqdc[14] = TB[46][3];
-        dqdc[15] = TB[46][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[46][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = TB[46][9] + k_f*sc[63];
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = TB[46][6];
-        dqdc[57] = TB[46][7] - k_r;
-        dqdc[58] = TB[46][8];
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac + k_f*sc[53];
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+53] -= dqdc[k];
-            J[73*k+57] += dqdc[k];
-            J[73*k+63] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[53] -= q_nocor;
+    Jmix[57] += q_nocor;
+    Jmix[63] -= q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[46][0] - 1)*q_nocor;
+    J[53] -= dqdci;               /* dwdot[HF]/d[H2] */
+    J[57] += dqdci;               /* dwdot[CH2F2]/d[H2] */
+    J[63] -= dqdci;               /* dwdot[CHF]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[46][1] - 1)*q_nocor;
+    J[418] -= dqdci;              /* dwdot[HF]/d[H2O] */
+    J[422] += dqdci;              /* dwdot[CH2F2]/d[H2O] */
+    J[428] -= dqdci;              /* dwdot[CHF]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[46][2] - 1)*q_nocor;
+    J[1002] -= dqdci;             /* dwdot[HF]/d[CH4] */
+    J[1006] += dqdci;             /* dwdot[CH2F2]/d[CH4] */
+    J[1012] -= dqdci;             /* dwdot[CHF]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[46][3] - 1)*q_nocor;
+    J[1075] -= dqdci;             /* dwdot[HF]/d[CO] */
+    J[1079] += dqdci;             /* dwdot[CH2F2]/d[CO] */
+    J[1085] -= dqdci;             /* dwdot[CHF]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[46][4] - 1)*q_nocor;
+    J[1148] -= dqdci;             /* dwdot[HF]/d[CO2] */
+    J[1152] += dqdci;             /* dwdot[CH2F2]/d[CO2] */
+    J[1158] -= dqdci;             /* dwdot[CHF]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[46][5] - 1)*q_nocor;
+    J[1951] -= dqdci;             /* dwdot[HF]/d[C2H6] */
+    J[1955] += dqdci;             /* dwdot[CH2F2]/d[C2H6] */
+    J[1961] -= dqdci;             /* dwdot[CHF]/d[C2H6] */
+    /* d()/d[HF] */
+    dqdci = (TB[46][9] - 1)*q_nocor + k_f*sc[63];
+    J[3922] -= dqdci;             /* dwdot[HF]/d[HF] */
+    J[3926] += dqdci;             /* dwdot[CH2F2]/d[HF] */
+    J[3932] -= dqdci;             /* dwdot[CHF]/d[HF] */
+    /* d()/d[CH3F] */
+    dqdci = (TB[46][6] - 1)*q_nocor;
+    J[4141] -= dqdci;             /* dwdot[HF]/d[CH3F] */
+    J[4145] += dqdci;             /* dwdot[CH2F2]/d[CH3F] */
+    J[4151] -= dqdci;             /* dwdot[CHF]/d[CH3F] */
+    /* d()/d[CH2F2] */
+    dqdci = (TB[46][7] - 1)*q_nocor - k_r;
+    J[4214] -= dqdci;             /* dwdot[HF]/d[CH2F2] */
+    J[4218] += dqdci;             /* dwdot[CH2F2]/d[CH2F2] */
+    J[4224] -= dqdci;             /* dwdot[CHF]/d[CH2F2] */
+    /* d()/d[CHF3] */
+    dqdci = (TB[46][8] - 1)*q_nocor;
+    J[4287] -= dqdci;             /* dwdot[HF]/d[CHF3] */
+    J[4291] += dqdci;             /* dwdot[CH2F2]/d[CHF3] */
+    J[4297] -= dqdci;             /* dwdot[CHF]/d[CHF3] */
+    /* d()/d[CHF] */
+    dqdci =  + k_f*sc[53];
+    J[4652] -= dqdci;             /* dwdot[HF]/d[CHF] */
+    J[4656] += dqdci;             /* dwdot[CH2F2]/d[CHF] */
+    J[4662] -= dqdci;             /* dwdot[CHF]/d[CHF] */
     J[5309] -= dqdT; /* dwdot[HF]/dT */
     J[5313] += dqdT; /* dwdot[CH2F2]/dT */
     J[5319] -= dqdT; /* dwdot[CHF]/dT */
@@ -45296,12 +42873,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[47][0] - 1)*sc[0] + (TB[47][1] - 1)*sc[5] + (TB[47][2] - 1)*sc[13] + (TB[47][3] - 1)*sc[14] + (TB[47][4] - 1)*sc[15] + (TB[47][5] - 1)*sc[26] + (TB[47][6] - 1)*sc[58] + (TB[47][7] - 1)*sc[57] + (TB[47][8] - 1)*sc[56] + (TB[47][9] - 1)*sc[53];
     /* forward */
     phi_f = sc[58];
-    k_f = prefactor_units[47] * fwd_A[47]
-                * exp(fwd_beta[47] * tc[0] - activation_units[47] * fwd_Ea[47] * invT);
+    k_f = k_f_s[47];
     dlnkfdT = fwd_beta[47] * invT + activation_units[47] * fwd_Ea[47] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[64];
-    Kc = refC * exp(-g_RT[53] + g_RT[58] - g_RT[64]);
+    Kc = Kc_s[47];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[58]) + (h_RT[53] + h_RT[64]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45316,142 +42892,65 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[47][0] - 1)*q_nocor;
-        J[53] += dqdci;               /* dwdot[HF]/d[H2] */
-        J[58] -= dqdci;               /* dwdot[CHF3]/d[H2] */
-        J[64] += dqdci;               /* dwdot[CF2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[47][1] - 1)*q_nocor;
-        J[418] += dqdci;              /* dwdot[HF]/d[H2O] */
-        J[423] -= dqdci;              /* dwdot[CHF3]/d[H2O] */
-        J[429] += dqdci;              /* dwdot[CF2]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[47][2] - 1)*q_nocor;
-        J[1002] += dqdci;             /* dwdot[HF]/d[CH4] */
-        J[1007] -= dqdci;             /* dwdot[CHF3]/d[CH4] */
-        J[1013] += dqdci;             /* dwdot[CF2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[47][3] - 1)*q_nocor;
-        J[1075] += dqdci;             /* dwdot[HF]/d[CO] */
-        J[1080] -= dqdci;             /* dwdot[CHF3]/d[CO] */
-        J[1086] += dqdci;             /* dwdot[CF2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[47][4] - 1)*q_nocor;
-        J[1148] += dqdci;             /* dwdot[HF]/d[CO2] */
-        J[1153] -= dqdci;             /* dwdot[CHF3]/d[CO2] */
-        J[1159] += dqdci;             /* dwdot[CF2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[47][5] - 1)*q_nocor;
-        J[1951] += dqdci;             /* dwdot[HF]/d[C2H6] */
-        J[1956] -= dqdci;             /* dwdot[CHF3]/d[C2H6] */
-        J[1962] += dqdci;             /* dwdot[CF2]/d[C2H6] */
-        /* d()/d[HF] */
-        dqdci = (TB[47][9] - 1)*q_nocor - k_r*sc[64];
-        J[3922] += dqdci;             /* dwdot[HF]/d[HF] */
-        J[3927] -= dqdci;             /* dwdot[CHF3]/d[HF] */
-        J[3933] += dqdci;             /* dwdot[CF2]/d[HF] */
-        /* d()/d[CH3F] */
-        dqdci = (TB[47][8] - 1)*q_nocor;
-        J[4141] += dqdci;             /* dwdot[HF]/d[CH3F] */
-        J[4146] -= dqdci;             /* dwdot[CHF3]/d[CH3F] */
-        J[4152] += dqdci;             /* dwdot[CF2]/d[CH3F] */
-        /* d()/d[CH2F2] */
-        dqdci = (TB[47][7] - 1)*q_nocor;
-        J[4214] += dqdci;             /* dwdot[HF]/d[CH2F2] */
-        J[4219] -= dqdci;             /* dwdot[CHF3]/d[CH2F2] */
-        J[4225] += dqdci;             /* dwdot[CF2]/d[CH2F2] */
-        /* d()/d[CHF3] */
-        dqdci = (TB[47][6] - 1)*q_nocor + k_f;
-        J[4287] += dqdci;             /* dwdot[HF]/d[CHF3] */
-        J[4292] -= dqdci;             /* dwdot[CHF3]/d[CHF3] */
-        J[4298] += dqdci;             /* dwdot[CF2]/d[CHF3] */
-        /* d()/d[CF2] */
-        dqdci =  - k_r*sc[53];
-        J[4725] += dqdci;             /* dwdot[HF]/d[CF2] */
-        J[4730] -= dqdci;             /* dwdot[CHF3]/d[CF2] */
-        J[4736] += dqdci;             /* dwdot[CF2]/d[CF2] */
-    }
-    else {
-        dqdc[0] = TB[47][0];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[47][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[47][2];
-        dqdc[14] = TB[47][3];
-        dqdc[15] = TB[47][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[47][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = TB[47][9] - k_r*sc[64];
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = TB[47][8];
-        dqdc[57] = TB[47][7];
-        dqdc[58] = TB[47][6] + k_f;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac - k_r*sc[53];
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+53] += dqdc[k];
-            J[73*k+58] -= dqdc[k];
-            J[73*k+64] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[53] += q_nocor;
+    Jmix[58] -= q_nocor;
+    Jmix[64] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[47][0] - 1)*q_nocor;
+    J[53] += dqdci;               /* dwdot[HF]/d[H2] */
+    J[58] -= dqdci;               /* dwdot[CHF3]/d[H2] */
+    J[64] += dqdci;               /* dwdot[CF2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[47][1] - 1)*q_nocor;
+    J[418] += dqdci;              /* dwdot[HF]/d[H2O] */
+    J[423] -= dqdci;              /* dwdot[CHF3]/d[H2O] */
+    J[429] += dqdci;              /* dwdot[CF2]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[47][2] - 1)*q_nocor;
+    J[1002] += dqdci;             /* dwdot[HF]/d[CH4] */
+    J[1007] -= dqdci;             /* dwdot[CHF3]/d[CH4] */
+    J[1013] += dqdci;             /* dwdot[CF2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[47][3] - 1)*q_nocor;
+    J[1075] += dqdci;             /* dwdot[HF]/d[CO] */
+    J[1080] -= dqdci;             /* dwdot[CHF3]/d[CO] */
+    J[1086] += dqdci;             /* dwdot[CF2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[47][4] - 1)*q_nocor;
+    J[1148] += dqdci;             /* dwdot[HF]/d[CO2] */
+    J[1153] -= dqdci;             /* dwdot[CHF3]/d[CO2] */
+    J[1159] += dqdci;             /* dwdot[CF2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[47][5] - 1)*q_nocor;
+    J[1951] += dqdci;             /* dwdot[HF]/d[C2H6] */
+    J[1956] -= dqdci;             /* dwdot[CHF3]/d[C2H6] */
+    J[1962] += dqdci;             /* dwdot[CF2]/d[C2H6] */
+    /* d()/d[HF] */
+    dqdci = (TB[47][9] - 1)*q_nocor - k_r*sc[64];
+    J[3922] += dqdci;             /* dwdot[HF]/d[HF] */
+    J[3927] -= dqdci;             /* dwdot[CHF3]/d[HF] */
+    J[3933] += dqdci;             /* dwdot[CF2]/d[HF] */
+    /* d()/d[CH3F] */
+    dqdci = (TB[47][8] - 1)*q_nocor;
+    J[4141] += dqdci;             /* dwdot[HF]/d[CH3F] */
+    J[4146] -= dqdci;             /* dwdot[CHF3]/d[CH3F] */
+    J[4152] += dqdci;             /* dwdot[CF2]/d[CH3F] */
+    /* d()/d[CH2F2] */
+    dqdci = (TB[47][7] - 1)*q_nocor;
+    J[4214] += dqdci;             /* dwdot[HF]/d[CH2F2] */
+    J[4219] -= dqdci;             /* dwdot[CHF3]/d[CH2F2] */
+    J[4225] += dqdci;             /* dwdot[CF2]/d[CH2F2] */
+    /* d()/d[CHF3] */
+    dqdci = (TB[47][6] - 1)*q_nocor + k_f;
+    J[4287] += dqdci;             /* dwdot[HF]/d[CHF3] */
+    J[4292] -= dqdci;             /* dwdot[CHF3]/d[CHF3] */
+    J[4298] += dqdci;             /* dwdot[CF2]/d[CHF3] */
+    /* d()/d[CF2] */
+    dqdci =  - k_r*sc[53];
+    J[4725] += dqdci;             /* dwdot[HF]/d[CF2] */
+    J[4730] -= dqdci;             /* dwdot[CHF3]/d[CF2] */
+    J[4736] += dqdci;             /* dwdot[CF2]/d[CF2] */
     J[5309] += dqdT; /* dwdot[HF]/dT */
     J[5314] -= dqdT; /* dwdot[CHF3]/dT */
     J[5320] += dqdT; /* dwdot[CF2]/dT */
@@ -45462,12 +42961,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[48][0] - 1)*sc[0] + (TB[48][1] - 1)*sc[5] + (TB[48][2] - 1)*sc[13] + (TB[48][3] - 1)*sc[14] + (TB[48][4] - 1)*sc[15] + (TB[48][5] - 1)*sc[26] + (TB[48][6] - 1)*sc[56] + (TB[48][7] - 1)*sc[57] + (TB[48][8] - 1)*sc[58] + (TB[48][9] - 1)*sc[59];
     /* forward */
     phi_f = sc[59];
-    k_f = prefactor_units[48] * fwd_A[48]
-                * exp(fwd_beta[48] * tc[0] - activation_units[48] * fwd_Ea[48] * invT);
+    k_f = k_f_s[48];
     dlnkfdT = fwd_beta[48] * invT + activation_units[48] * fwd_Ea[48] * invT2;
     /* reverse */
     phi_r = sc[54]*sc[62];
-    Kc = refC * exp(-g_RT[54] + g_RT[59] - g_RT[62]);
+    Kc = Kc_s[48];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[59]) + (h_RT[54] + h_RT[62]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45482,147 +42980,70 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[48][0] - 1)*q_nocor;
-        J[54] += dqdci;               /* dwdot[F]/d[H2] */
-        J[59] -= dqdci;               /* dwdot[CF4]/d[H2] */
-        J[62] += dqdci;               /* dwdot[CF3]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[48][1] - 1)*q_nocor;
-        J[419] += dqdci;              /* dwdot[F]/d[H2O] */
-        J[424] -= dqdci;              /* dwdot[CF4]/d[H2O] */
-        J[427] += dqdci;              /* dwdot[CF3]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[48][2] - 1)*q_nocor;
-        J[1003] += dqdci;             /* dwdot[F]/d[CH4] */
-        J[1008] -= dqdci;             /* dwdot[CF4]/d[CH4] */
-        J[1011] += dqdci;             /* dwdot[CF3]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[48][3] - 1)*q_nocor;
-        J[1076] += dqdci;             /* dwdot[F]/d[CO] */
-        J[1081] -= dqdci;             /* dwdot[CF4]/d[CO] */
-        J[1084] += dqdci;             /* dwdot[CF3]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[48][4] - 1)*q_nocor;
-        J[1149] += dqdci;             /* dwdot[F]/d[CO2] */
-        J[1154] -= dqdci;             /* dwdot[CF4]/d[CO2] */
-        J[1157] += dqdci;             /* dwdot[CF3]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[48][5] - 1)*q_nocor;
-        J[1952] += dqdci;             /* dwdot[F]/d[C2H6] */
-        J[1957] -= dqdci;             /* dwdot[CF4]/d[C2H6] */
-        J[1960] += dqdci;             /* dwdot[CF3]/d[C2H6] */
-        /* d()/d[F] */
-        dqdci =  - k_r*sc[62];
-        J[3996] += dqdci;             /* dwdot[F]/d[F] */
-        J[4001] -= dqdci;             /* dwdot[CF4]/d[F] */
-        J[4004] += dqdci;             /* dwdot[CF3]/d[F] */
-        /* d()/d[CH3F] */
-        dqdci = (TB[48][6] - 1)*q_nocor;
-        J[4142] += dqdci;             /* dwdot[F]/d[CH3F] */
-        J[4147] -= dqdci;             /* dwdot[CF4]/d[CH3F] */
-        J[4150] += dqdci;             /* dwdot[CF3]/d[CH3F] */
-        /* d()/d[CH2F2] */
-        dqdci = (TB[48][7] - 1)*q_nocor;
-        J[4215] += dqdci;             /* dwdot[F]/d[CH2F2] */
-        J[4220] -= dqdci;             /* dwdot[CF4]/d[CH2F2] */
-        J[4223] += dqdci;             /* dwdot[CF3]/d[CH2F2] */
-        /* d()/d[CHF3] */
-        dqdci = (TB[48][8] - 1)*q_nocor;
-        J[4288] += dqdci;             /* dwdot[F]/d[CHF3] */
-        J[4293] -= dqdci;             /* dwdot[CF4]/d[CHF3] */
-        J[4296] += dqdci;             /* dwdot[CF3]/d[CHF3] */
-        /* d()/d[CF4] */
-        dqdci = (TB[48][9] - 1)*q_nocor + k_f;
-        J[4361] += dqdci;             /* dwdot[F]/d[CF4] */
-        J[4366] -= dqdci;             /* dwdot[CF4]/d[CF4] */
-        J[4369] += dqdci;             /* dwdot[CF3]/d[CF4] */
-        /* d()/d[CF3] */
-        dqdci =  - k_r*sc[54];
-        J[4580] += dqdci;             /* dwdot[F]/d[CF3] */
-        J[4585] -= dqdci;             /* dwdot[CF4]/d[CF3] */
-        J[4588] += dqdci;             /* dwdot[CF3]/d[CF3] */
-    }
-    else {
-        dqdc[0] = TB[48][0];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[48][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[48][2];
-        dqdc[14] = TB[48][3];
-        dqdc[15] = TB[48][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[48][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac - k_r*sc[62];
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = TB[48][6];
-        dqdc[57] = TB[48][7];
-        dqdc[58] = TB[48][8];
-        dqdc[59] = TB[48][9] + k_f;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac - k_r*sc[54];
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+54] += dqdc[k];
-            J[73*k+59] -= dqdc[k];
-            J[73*k+62] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[54] += q_nocor;
+    Jmix[59] -= q_nocor;
+    Jmix[62] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[48][0] - 1)*q_nocor;
+    J[54] += dqdci;               /* dwdot[F]/d[H2] */
+    J[59] -= dqdci;               /* dwdot[CF4]/d[H2] */
+    J[62] += dqdci;               /* dwdot[CF3]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[48][1] - 1)*q_nocor;
+    J[419] += dqdci;              /* dwdot[F]/d[H2O] */
+    J[424] -= dqdci;              /* dwdot[CF4]/d[H2O] */
+    J[427] += dqdci;              /* dwdot[CF3]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[48][2] - 1)*q_nocor;
+    J[1003] += dqdci;             /* dwdot[F]/d[CH4] */
+    J[1008] -= dqdci;             /* dwdot[CF4]/d[CH4] */
+    J[1011] += dqdci;             /* dwdot[CF3]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[48][3] - 1)*q_nocor;
+    J[1076] += dqdci;             /* dwdot[F]/d[CO] */
+    J[1081] -= dqdci;             /* dwdot[CF4]/d[CO] */
+    J[1084] += dqdci;             /* dwdot[CF3]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[48][4] - 1)*q_nocor;
+    J[1149] += dqdci;             /* dwdot[F]/d[CO2] */
+    J[1154] -= dqdci;             /* dwdot[CF4]/d[CO2] */
+    J[1157] += dqdci;             /* dwdot[CF3]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[48][5] - 1)*q_nocor;
+    J[1952] += dqdci;             /* dwdot[F]/d[C2H6] */
+    J[1957] -= dqdci;             /* dwdot[CF4]/d[C2H6] */
+    J[1960] += dqdci;             /* dwdot[CF3]/d[C2H6] */
+    /* d()/d[F] */
+    dqdci =  - k_r*sc[62];
+    J[3996] += dqdci;             /* dwdot[F]/d[F] */
+    J[4001] -= dqdci;             /* dwdot[CF4]/d[F] */
+    J[4004] += dqdci;             /* dwdot[CF3]/d[F] */
+    /* d()/d[CH3F] */
+    dqdci = (TB[48][6] - 1)*q_nocor;
+    J[4142] += dqdci;             /* dwdot[F]/d[CH3F] */
+    J[4147] -= dqdci;             /* dwdot[CF4]/d[CH3F] */
+    J[4150] += dqdci;             /* dwdot[CF3]/d[CH3F] */
+    /* d()/d[CH2F2] */
+    dqdci = (TB[48][7] - 1)*q_nocor;
+    J[4215] += dqdci;             /* dwdot[F]/d[CH2F2] */
+    J[4220] -= dqdci;             /* dwdot[CF4]/d[CH2F2] */
+    J[4223] += dqdci;             /* dwdot[CF3]/d[CH2F2] */
+    /* d()/d[CHF3] */
+    dqdci = (TB[48][8] - 1)*q_nocor;
+    J[4288] += dqdci;             /* dwdot[F]/d[CHF3] */
+    J[4293] -= dqdci;             /* dwdot[CF4]/d[CHF3] */
+    J[4296] += dqdci;             /* dwdot[CF3]/d[CHF3] */
+    /* d()/d[CF4] */
+    dqdci = (TB[48][9] - 1)*q_nocor + k_f;
+    J[4361] += dqdci;             /* dwdot[F]/d[CF4] */
+    J[4366] -= dqdci;             /* dwdot[CF4]/d[CF4] */
+    J[4369] += dqdci;             /* dwdot[CF3]/d[CF4] */
+    /* d()/d[CF3] */
+    dqdci =  - k_r*sc[54];
+    J[4580] += dqdci;             /* dwdot[F]/d[CF3] */
+    J[4585] -= dqdci;             /* dwdot[CF4]/d[CF3] */
+    J[4588] += dqdci;             /* dwdot[CF3]/d[CF3] */
     J[5310] += dqdT; /* dwdot[F]/dT */
     J[5315] -= dqdT; /* dwdot[CF4]/dT */
     J[5318] += dqdT; /* dwdot[CF3]/dT */
@@ -45633,12 +43054,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[66];
-    k_f = prefactor_units[49] * fwd_A[49]
-                * exp(fwd_beta[49] * tc[0] - activation_units[49] * fwd_Ea[49] * invT);
+    k_f = k_f_s[49];
     dlnkfdT = fwd_beta[49] * invT + activation_units[49] * fwd_Ea[49] * invT2;
     /* reverse */
     phi_r = sc[54]*sc[67];
-    Kc = refC * exp(-g_RT[54] + g_RT[66] - g_RT[67]);
+    Kc = Kc_s[49];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[66]) + (h_RT[54] + h_RT[67]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45653,102 +43073,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[F] */
-        dqdci =  - k_r*sc[67];
-        J[3996] += dqdci;             /* dwdot[F]/d[F] */
-        J[4008] -= dqdci;             /* dwdot[CF3O]/d[F] */
-        J[4009] += dqdci;             /* dwdot[CF2O]/d[F] */
-        /* d()/d[CF3O] */
-        dqdci =  + k_f;
-        J[4872] += dqdci;             /* dwdot[F]/d[CF3O] */
-        J[4884] -= dqdci;             /* dwdot[CF3O]/d[CF3O] */
-        J[4885] += dqdci;             /* dwdot[CF2O]/d[CF3O] */
-        /* d()/d[CF2O] */
-        dqdci =  - k_r*sc[54];
-        J[4945] += dqdci;             /* dwdot[F]/d[CF2O] */
-        J[4957] -= dqdci;             /* dwdot[CF3O]/d[CF2O] */
-        J[4958] += dqdci;             /* dwdot[CF2O]/d[CF2O] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac - k_r*sc[67];
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac + k_f;
-        dqdc[67] = dcdc_fac - k_r*sc[54];
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+54] += dqdc[k];
-            J[73*k+66] -= dqdc[k];
-            J[73*k+67] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[54] += q_nocor;
+    Jmix[66] -= q_nocor;
+    Jmix[67] += q_nocor;
+    /* d()/d[F] */
+    dqdci =  - k_r*sc[67];
+    J[3996] += dqdci;             /* dwdot[F]/d[F] */
+    J[4008] -= dqdci;             /* dwdot[CF3O]/d[F] */
+    J[4009] += dqdci;             /* dwdot[CF2O]/d[F] */
+    /* d()/d[CF3O] */
+    dqdci =  + k_f;
+    J[4872] += dqdci;             /* dwdot[F]/d[CF3O] */
+    J[4884] -= dqdci;             /* dwdot[CF3O]/d[CF3O] */
+    J[4885] += dqdci;             /* dwdot[CF2O]/d[CF3O] */
+    /* d()/d[CF2O] */
+    dqdci =  - k_r*sc[54];
+    J[4945] += dqdci;             /* dwdot[F]/d[CF2O] */
+    J[4957] -= dqdci;             /* dwdot[CF3O]/d[CF2O] */
+    J[4958] += dqdci;             /* dwdot[CF2O]/d[CF2O] */
     J[5310] += dqdT; /* dwdot[F]/dT */
     J[5322] -= dqdT; /* dwdot[CF3O]/dT */
     J[5323] += dqdT; /* dwdot[CF2O]/dT */
@@ -45759,12 +43102,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[68];
-    k_f = prefactor_units[50] * fwd_A[50]
-                * exp(fwd_beta[50] * tc[0] - activation_units[50] * fwd_Ea[50] * invT);
+    k_f = k_f_s[50];
     dlnkfdT = fwd_beta[50] * invT + activation_units[50] * fwd_Ea[50] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[53];
-    Kc = refC * exp(-g_RT[14] - g_RT[53] + g_RT[68]);
+    Kc = Kc_s[50];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[68]) + (h_RT[14] + h_RT[53]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45779,102 +43121,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[CO] */
-        dqdci =  - k_r*sc[53];
-        J[1036] += dqdci;             /* dwdot[CO]/d[CO] */
-        J[1075] += dqdci;             /* dwdot[HF]/d[CO] */
-        J[1090] -= dqdci;             /* dwdot[CHFO]/d[CO] */
-        /* d()/d[HF] */
-        dqdci =  - k_r*sc[14];
-        J[3883] += dqdci;             /* dwdot[CO]/d[HF] */
-        J[3922] += dqdci;             /* dwdot[HF]/d[HF] */
-        J[3937] -= dqdci;             /* dwdot[CHFO]/d[HF] */
-        /* d()/d[CHFO] */
-        dqdci =  + k_f;
-        J[4978] += dqdci;             /* dwdot[CO]/d[CHFO] */
-        J[5017] += dqdci;             /* dwdot[HF]/d[CHFO] */
-        J[5032] -= dqdci;             /* dwdot[CHFO]/d[CHFO] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac - k_r*sc[53];
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac - k_r*sc[14];
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac + k_f;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+14] += dqdc[k];
-            J[73*k+53] += dqdc[k];
-            J[73*k+68] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[14] += q_nocor;
+    Jmix[53] += q_nocor;
+    Jmix[68] -= q_nocor;
+    /* d()/d[CO] */
+    dqdci =  - k_r*sc[53];
+    J[1036] += dqdci;             /* dwdot[CO]/d[CO] */
+    J[1075] += dqdci;             /* dwdot[HF]/d[CO] */
+    J[1090] -= dqdci;             /* dwdot[CHFO]/d[CO] */
+    /* d()/d[HF] */
+    dqdci =  - k_r*sc[14];
+    J[3883] += dqdci;             /* dwdot[CO]/d[HF] */
+    J[3922] += dqdci;             /* dwdot[HF]/d[HF] */
+    J[3937] -= dqdci;             /* dwdot[CHFO]/d[HF] */
+    /* d()/d[CHFO] */
+    dqdci =  + k_f;
+    J[4978] += dqdci;             /* dwdot[CO]/d[CHFO] */
+    J[5017] += dqdci;             /* dwdot[HF]/d[CHFO] */
+    J[5032] -= dqdci;             /* dwdot[CHFO]/d[CHFO] */
     J[5270] += dqdT; /* dwdot[CO]/dT */
     J[5309] += dqdT; /* dwdot[HF]/dT */
     J[5324] -= dqdT; /* dwdot[CHFO]/dT */
@@ -45885,12 +43150,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[54]*sc[54];
-    k_f = prefactor_units[51] * fwd_A[51]
-                * exp(fwd_beta[51] * tc[0] - activation_units[51] * fwd_Ea[51] * invT);
+    k_f = k_f_s[51];
     dlnkfdT = fwd_beta[51] * invT + activation_units[51] * fwd_Ea[51] * invT2;
     /* reverse */
     phi_r = sc[55];
-    Kc = refCinv * exp(g_RT[54] + g_RT[54] - g_RT[55]);
+    Kc = Kc_s[51];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[54]) + (h_RT[55]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45904,94 +43168,17 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[F] */
-        dqdci =  + k_f*2*sc[54];
-        J[3996] += -2 * dqdci;        /* dwdot[F]/d[F] */
-        J[3997] += dqdci;             /* dwdot[F2]/d[F] */
-        /* d()/d[F2] */
-        dqdci =  - k_r;
-        J[4069] += -2 * dqdci;        /* dwdot[F]/d[F2] */
-        J[4070] += dqdci;             /* dwdot[F2]/d[F2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac + k_f*2*sc[54];
-        dqdc[55] = dcdc_fac - k_r;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        dqdc[70] = dcdc_fac;
-        dqdc[71] = dcdc_fac;
-        for (int k=0; k<72; k++) {
-            J[73*k+54] += -2 * dqdc[k];
-            J[73*k+55] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[54] += -2 * q_nocor;
+    Jmix[55] += q_nocor;
+    /* d()/d[F] */
+    dqdci =  + k_f*2*sc[54];
+    J[3996] += -2 * dqdci;        /* dwdot[F]/d[F] */
+    J[3997] += dqdci;             /* dwdot[F2]/d[F] */
+    /* d()/d[F2] */
+    dqdci =  - k_r;
+    J[4069] += -2 * dqdci;        /* dwdot[F]/d[F2] */
+    J[4070] += dqdci;             /* dwdot[F2]/d[F2] */
     J[5310] += -2 * dqdT; /* dwdot[F]/dT */
     J[5311] += dqdT; /* dwdot[F2]/dT */
 
@@ -45999,12 +43186,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[2];
-    k_f = prefactor_units[52] * fwd_A[52]
-                * exp(fwd_beta[52] * tc[0] - activation_units[52] * fwd_Ea[52] * invT);
+    k_f = k_f_s[52];
     dlnkfdT = fwd_beta[52] * invT + activation_units[52] * fwd_Ea[52] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[4];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[2] - g_RT[4]);
+    Kc = Kc_s[52];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[2]) + (h_RT[1] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46050,12 +43236,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[6];
-    k_f = prefactor_units[53] * fwd_A[53]
-                * exp(fwd_beta[53] * tc[0] - activation_units[53] * fwd_Ea[53] * invT);
+    k_f = k_f_s[53];
     dlnkfdT = fwd_beta[53] * invT + activation_units[53] * fwd_Ea[53] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[4];
-    Kc = exp(g_RT[2] - g_RT[3] - g_RT[4] + g_RT[6]);
+    Kc = Kc_s[53];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[6]) + (h_RT[3] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46101,12 +43286,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[7];
-    k_f = prefactor_units[54] * fwd_A[54]
-                * exp(fwd_beta[54] * tc[0] - activation_units[54] * fwd_Ea[54] * invT);
+    k_f = k_f_s[54];
     dlnkfdT = fwd_beta[54] * invT + activation_units[54] * fwd_Ea[54] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[6];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[54];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[7]) + (h_RT[4] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46152,12 +43336,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[9];
-    k_f = prefactor_units[55] * fwd_A[55]
-                * exp(fwd_beta[55] * tc[0] - activation_units[55] * fwd_Ea[55] * invT);
+    k_f = k_f_s[55];
     dlnkfdT = fwd_beta[55] * invT + activation_units[55] * fwd_Ea[55] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[9] - g_RT[14]);
+    Kc = Kc_s[55];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[9]) + (h_RT[1] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46203,12 +43386,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[10];
-    k_f = prefactor_units[56] * fwd_A[56]
-                * exp(fwd_beta[56] * tc[0] - activation_units[56] * fwd_Ea[56] * invT);
+    k_f = k_f_s[56];
     dlnkfdT = fwd_beta[56] * invT + activation_units[56] * fwd_Ea[56] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[16];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[10] - g_RT[16]);
+    Kc = Kc_s[56];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[10]) + (h_RT[1] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46254,12 +43436,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[11];
-    k_f = prefactor_units[57] * fwd_A[57]
-                * exp(fwd_beta[57] * tc[0] - activation_units[57] * fwd_Ea[57] * invT);
+    k_f = k_f_s[57];
     dlnkfdT = fwd_beta[57] * invT + activation_units[57] * fwd_Ea[57] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[14];
-    Kc = exp(-g_RT[0] + g_RT[2] + g_RT[11] - g_RT[14]);
+    Kc = Kc_s[57];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[11]) + (h_RT[0] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46305,12 +43486,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[11];
-    k_f = prefactor_units[58] * fwd_A[58]
-                * exp(fwd_beta[58] * tc[0] - activation_units[58] * fwd_Ea[58] * invT);
+    k_f = k_f_s[58];
     dlnkfdT = fwd_beta[58] * invT + activation_units[58] * fwd_Ea[58] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[16];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[11] - g_RT[16]);
+    Kc = Kc_s[58];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[11]) + (h_RT[1] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46356,12 +43536,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[12];
-    k_f = prefactor_units[59] * fwd_A[59]
-                * exp(fwd_beta[59] * tc[0] - activation_units[59] * fwd_Ea[59] * invT);
+    k_f = k_f_s[59];
     dlnkfdT = fwd_beta[59] * invT + activation_units[59] * fwd_Ea[59] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[17];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[12] - g_RT[17]);
+    Kc = Kc_s[59];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[12]) + (h_RT[1] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46407,12 +43586,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[13];
-    k_f = prefactor_units[60] * fwd_A[60]
-                * exp(fwd_beta[60] * tc[0] - activation_units[60] * fwd_Ea[60] * invT);
+    k_f = k_f_s[60];
     dlnkfdT = fwd_beta[60] * invT + activation_units[60] * fwd_Ea[60] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[12];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[12] + g_RT[13]);
+    Kc = Kc_s[60];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[13]) + (h_RT[4] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46458,12 +43636,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[16];
-    k_f = prefactor_units[61] * fwd_A[61]
-                * exp(fwd_beta[61] * tc[0] - activation_units[61] * fwd_Ea[61] * invT);
+    k_f = k_f_s[61];
     dlnkfdT = fwd_beta[61] * invT + activation_units[61] * fwd_Ea[61] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[14];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[61];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[16]) + (h_RT[4] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46509,12 +43686,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[16];
-    k_f = prefactor_units[62] * fwd_A[62]
-                * exp(fwd_beta[62] * tc[0] - activation_units[62] * fwd_Ea[62] * invT);
+    k_f = k_f_s[62];
     dlnkfdT = fwd_beta[62] * invT + activation_units[62] * fwd_Ea[62] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[15];
-    Kc = exp(-g_RT[1] + g_RT[2] - g_RT[15] + g_RT[16]);
+    Kc = Kc_s[62];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[16]) + (h_RT[1] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46560,12 +43736,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[17];
-    k_f = prefactor_units[63] * fwd_A[63]
-                * exp(fwd_beta[63] * tc[0] - activation_units[63] * fwd_Ea[63] * invT);
+    k_f = k_f_s[63];
     dlnkfdT = fwd_beta[63] * invT + activation_units[63] * fwd_Ea[63] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[16];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[63];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[17]) + (h_RT[4] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46611,12 +43786,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[18];
-    k_f = prefactor_units[64] * fwd_A[64]
-                * exp(fwd_beta[64] * tc[0] - activation_units[64] * fwd_Ea[64] * invT);
+    k_f = k_f_s[64];
     dlnkfdT = fwd_beta[64] * invT + activation_units[64] * fwd_Ea[64] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[17];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[64];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[18]) + (h_RT[4] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46662,12 +43836,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[19];
-    k_f = prefactor_units[65] * fwd_A[65]
-                * exp(fwd_beta[65] * tc[0] - activation_units[65] * fwd_Ea[65] * invT);
+    k_f = k_f_s[65];
     dlnkfdT = fwd_beta[65] * invT + activation_units[65] * fwd_Ea[65] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[17];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[17] + g_RT[19]);
+    Kc = Kc_s[65];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[19]) + (h_RT[4] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46713,12 +43886,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[20];
-    k_f = prefactor_units[66] * fwd_A[66]
-                * exp(fwd_beta[66] * tc[0] - activation_units[66] * fwd_Ea[66] * invT);
+    k_f = k_f_s[66];
     dlnkfdT = fwd_beta[66] * invT + activation_units[66] * fwd_Ea[66] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[18];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[66];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[20]) + (h_RT[4] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46764,12 +43936,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[20];
-    k_f = prefactor_units[67] * fwd_A[67]
-                * exp(fwd_beta[67] * tc[0] - activation_units[67] * fwd_Ea[67] * invT);
+    k_f = k_f_s[67];
     dlnkfdT = fwd_beta[67] * invT + activation_units[67] * fwd_Ea[67] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[19];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[19] + g_RT[20]);
+    Kc = Kc_s[67];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[20]) + (h_RT[4] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46815,12 +43986,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[21];
-    k_f = prefactor_units[68] * fwd_A[68]
-                * exp(fwd_beta[68] * tc[0] - activation_units[68] * fwd_Ea[68] * invT);
+    k_f = k_f_s[68];
     dlnkfdT = fwd_beta[68] * invT + activation_units[68] * fwd_Ea[68] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[14];
-    Kc = exp(g_RT[2] - g_RT[9] - g_RT[14] + g_RT[21]);
+    Kc = Kc_s[68];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[21]) + (h_RT[9] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46866,12 +44036,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[22];
-    k_f = prefactor_units[69] * fwd_A[69]
-                * exp(fwd_beta[69] * tc[0] - activation_units[69] * fwd_Ea[69] * invT);
+    k_f = k_f_s[69];
     dlnkfdT = fwd_beta[69] * invT + activation_units[69] * fwd_Ea[69] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[27];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[22] - g_RT[27]);
+    Kc = Kc_s[69];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[22]) + (h_RT[1] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46917,12 +44086,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[22];
-    k_f = prefactor_units[70] * fwd_A[70]
-                * exp(fwd_beta[70] * tc[0] - activation_units[70] * fwd_Ea[70] * invT);
+    k_f = k_f_s[70];
     dlnkfdT = fwd_beta[70] * invT + activation_units[70] * fwd_Ea[70] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[21];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[70];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[22]) + (h_RT[4] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46968,12 +44136,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[22];
-    k_f = prefactor_units[71] * fwd_A[71]
-                * exp(fwd_beta[71] * tc[0] - activation_units[71] * fwd_Ea[71] * invT);
+    k_f = k_f_s[71];
     dlnkfdT = fwd_beta[71] * invT + activation_units[71] * fwd_Ea[71] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[14];
-    Kc = exp(g_RT[2] - g_RT[10] - g_RT[14] + g_RT[22]);
+    Kc = Kc_s[71];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[22]) + (h_RT[10] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47019,12 +44186,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[23];
-    k_f = prefactor_units[72] * fwd_A[72]
-                * exp(fwd_beta[72] * tc[0] - activation_units[72] * fwd_Ea[72] * invT);
+    k_f = k_f_s[72];
     dlnkfdT = fwd_beta[72] * invT + activation_units[72] * fwd_Ea[72] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[28];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[23] - g_RT[28]);
+    Kc = Kc_s[72];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[23]) + (h_RT[1] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47070,12 +44236,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[24];
-    k_f = prefactor_units[73] * fwd_A[73]
-                * exp(fwd_beta[73] * tc[0] - activation_units[73] * fwd_Ea[73] * invT);
+    k_f = k_f_s[73];
     dlnkfdT = fwd_beta[73] * invT + activation_units[73] * fwd_Ea[73] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[16];
-    Kc = exp(g_RT[2] - g_RT[12] - g_RT[16] + g_RT[24]);
+    Kc = Kc_s[73];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[24]) + (h_RT[12] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47121,12 +44286,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[25];
-    k_f = prefactor_units[74] * fwd_A[74]
-                * exp(fwd_beta[74] * tc[0] - activation_units[74] * fwd_Ea[74] * invT);
+    k_f = k_f_s[74];
     dlnkfdT = fwd_beta[74] * invT + activation_units[74] * fwd_Ea[74] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[17];
-    Kc = exp(g_RT[2] - g_RT[12] - g_RT[17] + g_RT[25]);
+    Kc = Kc_s[74];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[25]) + (h_RT[12] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47172,12 +44336,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[26];
-    k_f = prefactor_units[75] * fwd_A[75]
-                * exp(fwd_beta[75] * tc[0] - activation_units[75] * fwd_Ea[75] * invT);
+    k_f = k_f_s[75];
     dlnkfdT = fwd_beta[75] * invT + activation_units[75] * fwd_Ea[75] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[25];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[25] + g_RT[26]);
+    Kc = Kc_s[75];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[26]) + (h_RT[4] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47223,12 +44386,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[27];
-    k_f = prefactor_units[76] * fwd_A[76]
-                * exp(fwd_beta[76] * tc[0] - activation_units[76] * fwd_Ea[76] * invT);
+    k_f = k_f_s[76];
     dlnkfdT = fwd_beta[76] * invT + activation_units[76] * fwd_Ea[76] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14]*sc[14];
-    Kc = refC * exp(-g_RT[1] + g_RT[2] - 2*g_RT[14] + g_RT[27]);
+    Kc = Kc_s[76];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[27]) + (h_RT[1] + 2*h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47274,12 +44436,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[28];
-    k_f = prefactor_units[77] * fwd_A[77]
-                * exp(fwd_beta[77] * tc[0] - activation_units[77] * fwd_Ea[77] * invT);
+    k_f = k_f_s[77];
     dlnkfdT = fwd_beta[77] * invT + activation_units[77] * fwd_Ea[77] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[27];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[27] + g_RT[28]);
+    Kc = Kc_s[77];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[28]) + (h_RT[4] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47325,12 +44486,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[28];
-    k_f = prefactor_units[78] * fwd_A[78]
-                * exp(fwd_beta[78] * tc[0] - activation_units[78] * fwd_Ea[78] * invT);
+    k_f = k_f_s[78];
     dlnkfdT = fwd_beta[78] * invT + activation_units[78] * fwd_Ea[78] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[15];
-    Kc = exp(g_RT[2] - g_RT[10] - g_RT[15] + g_RT[28]);
+    Kc = Kc_s[78];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[28]) + (h_RT[10] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47376,12 +44536,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[14];
-    k_f = prefactor_units[79] * fwd_A[79]
-                * exp(fwd_beta[79] * tc[0] - activation_units[79] * fwd_Ea[79] * invT);
+    k_f = k_f_s[79];
     dlnkfdT = fwd_beta[79] * invT + activation_units[79] * fwd_Ea[79] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[15];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[79];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[14]) + (h_RT[2] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47427,12 +44586,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[17];
-    k_f = prefactor_units[80] * fwd_A[80]
-                * exp(fwd_beta[80] * tc[0] - activation_units[80] * fwd_Ea[80] * invT);
+    k_f = k_f_s[80];
     dlnkfdT = fwd_beta[80] * invT + activation_units[80] * fwd_Ea[80] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[16];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[80];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[17]) + (h_RT[6] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47478,12 +44636,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3]*sc[3];
-    k_f = prefactor_units[81] * fwd_A[81]
-                * exp(fwd_beta[81] * tc[0] - activation_units[81] * fwd_Ea[81] * invT);
+    k_f = k_f_s[81];
     dlnkfdT = fwd_beta[81] * invT + activation_units[81] * fwd_Ea[81] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[6];
-    Kc = refCinv * exp(g_RT[1] + 2*g_RT[3] - g_RT[3] - g_RT[6]);
+    Kc = Kc_s[81];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + 2*h_RT[3]) + (h_RT[3] + h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47518,12 +44675,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3]*sc[5];
-    k_f = prefactor_units[82] * fwd_A[82]
-                * exp(fwd_beta[82] * tc[0] - activation_units[82] * fwd_Ea[82] * invT);
+    k_f = k_f_s[82];
     dlnkfdT = fwd_beta[82] * invT + activation_units[82] * fwd_Ea[82] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = refCinv * exp(g_RT[1] + g_RT[3] + g_RT[5] - g_RT[5] - g_RT[6]);
+    Kc = Kc_s[82];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3] + h_RT[5]) + (h_RT[5] + h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47563,12 +44719,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3]*sc[47];
-    k_f = prefactor_units[83] * fwd_A[83]
-                * exp(fwd_beta[83] * tc[0] - activation_units[83] * fwd_Ea[83] * invT);
+    k_f = k_f_s[83];
     dlnkfdT = fwd_beta[83] * invT + activation_units[83] * fwd_Ea[83] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[47];
-    Kc = refCinv * exp(g_RT[1] + g_RT[3] - g_RT[6] + g_RT[47] - g_RT[47]);
+    Kc = Kc_s[83];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3] + h_RT[47]) + (h_RT[6] + h_RT[47]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47608,12 +44763,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3]*sc[48];
-    k_f = prefactor_units[84] * fwd_A[84]
-                * exp(fwd_beta[84] * tc[0] - activation_units[84] * fwd_Ea[84] * invT);
+    k_f = k_f_s[84];
     dlnkfdT = fwd_beta[84] * invT + activation_units[84] * fwd_Ea[84] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[48];
-    Kc = refCinv * exp(g_RT[1] + g_RT[3] - g_RT[6] + g_RT[48] - g_RT[48]);
+    Kc = Kc_s[84];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3] + h_RT[48]) + (h_RT[6] + h_RT[48]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47653,12 +44807,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3];
-    k_f = prefactor_units[85] * fwd_A[85]
-                * exp(fwd_beta[85] * tc[0] - activation_units[85] * fwd_Ea[85] * invT);
+    k_f = k_f_s[85];
     dlnkfdT = fwd_beta[85] * invT + activation_units[85] * fwd_Ea[85] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[4];
-    Kc = exp(g_RT[1] - g_RT[2] + g_RT[3] - g_RT[4]);
+    Kc = Kc_s[85];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3]) + (h_RT[2] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47704,12 +44857,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[1]*sc[1];
-    k_f = prefactor_units[86] * fwd_A[86]
-                * exp(fwd_beta[86] * tc[0] - activation_units[86] * fwd_Ea[86] * invT);
+    k_f = k_f_s[86];
     dlnkfdT = fwd_beta[86] * invT + activation_units[86] * fwd_Ea[86] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[0];
-    Kc = refCinv * exp(g_RT[0] - 2*g_RT[0] + 2*g_RT[1]);
+    Kc = Kc_s[86];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + 2*h_RT[1]) + (2*h_RT[0]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47735,12 +44887,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[1]*sc[5];
-    k_f = prefactor_units[87] * fwd_A[87]
-                * exp(fwd_beta[87] * tc[0] - activation_units[87] * fwd_Ea[87] * invT);
+    k_f = k_f_s[87];
     dlnkfdT = fwd_beta[87] * invT + activation_units[87] * fwd_Ea[87] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[5];
-    Kc = refCinv * exp(-g_RT[0] + 2*g_RT[1] + g_RT[5] - g_RT[5]);
+    Kc = Kc_s[87];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[1] + h_RT[5]) + (h_RT[0] + h_RT[5]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47770,12 +44921,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[1]*sc[15];
-    k_f = prefactor_units[88] * fwd_A[88]
-                * exp(fwd_beta[88] * tc[0] - activation_units[88] * fwd_Ea[88] * invT);
+    k_f = k_f_s[88];
     dlnkfdT = fwd_beta[88] * invT + activation_units[88] * fwd_Ea[88] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[15];
-    Kc = refCinv * exp(-g_RT[0] + 2*g_RT[1] + g_RT[15] - g_RT[15]);
+    Kc = Kc_s[88];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[1] + h_RT[15]) + (h_RT[0] + h_RT[15]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47805,12 +44955,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[6];
-    k_f = prefactor_units[89] * fwd_A[89]
-                * exp(fwd_beta[89] * tc[0] - activation_units[89] * fwd_Ea[89] * invT);
+    k_f = k_f_s[89];
     dlnkfdT = fwd_beta[89] * invT + activation_units[89] * fwd_Ea[89] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[5];
-    Kc = exp(g_RT[1] - g_RT[2] - g_RT[5] + g_RT[6]);
+    Kc = Kc_s[89];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[6]) + (h_RT[2] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47856,12 +45005,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[6];
-    k_f = prefactor_units[90] * fwd_A[90]
-                * exp(fwd_beta[90] * tc[0] - activation_units[90] * fwd_Ea[90] * invT);
+    k_f = k_f_s[90];
     dlnkfdT = fwd_beta[90] * invT + activation_units[90] * fwd_Ea[90] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[3];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[3] + g_RT[6]);
+    Kc = Kc_s[90];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[6]) + (h_RT[0] + h_RT[3]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47907,12 +45055,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[6];
-    k_f = prefactor_units[91] * fwd_A[91]
-                * exp(fwd_beta[91] * tc[0] - activation_units[91] * fwd_Ea[91] * invT);
+    k_f = k_f_s[91];
     dlnkfdT = fwd_beta[91] * invT + activation_units[91] * fwd_Ea[91] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[4];
-    Kc = exp(g_RT[1] - 2*g_RT[4] + g_RT[6]);
+    Kc = Kc_s[91];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[6]) + (2*h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47947,12 +45094,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[7];
-    k_f = prefactor_units[92] * fwd_A[92]
-                * exp(fwd_beta[92] * tc[0] - activation_units[92] * fwd_Ea[92] * invT);
+    k_f = k_f_s[92];
     dlnkfdT = fwd_beta[92] * invT + activation_units[92] * fwd_Ea[92] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[6];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[92];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[7]) + (h_RT[0] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47998,12 +45144,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[7];
-    k_f = prefactor_units[93] * fwd_A[93]
-                * exp(fwd_beta[93] * tc[0] - activation_units[93] * fwd_Ea[93] * invT);
+    k_f = k_f_s[93];
     dlnkfdT = fwd_beta[93] * invT + activation_units[93] * fwd_Ea[93] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[5];
-    Kc = exp(g_RT[1] - g_RT[4] - g_RT[5] + g_RT[7]);
+    Kc = Kc_s[93];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[7]) + (h_RT[4] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48049,12 +45194,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[9];
-    k_f = prefactor_units[94] * fwd_A[94]
-                * exp(fwd_beta[94] * tc[0] - activation_units[94] * fwd_Ea[94] * invT);
+    k_f = k_f_s[94];
     dlnkfdT = fwd_beta[94] * invT + activation_units[94] * fwd_Ea[94] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[8];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[8] + g_RT[9]);
+    Kc = Kc_s[94];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[9]) + (h_RT[0] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48100,12 +45244,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[11];
-    k_f = prefactor_units[95] * fwd_A[95]
-                * exp(fwd_beta[95] * tc[0] - activation_units[95] * fwd_Ea[95] * invT);
+    k_f = k_f_s[95];
     dlnkfdT = fwd_beta[95] * invT + activation_units[95] * fwd_Ea[95] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[9];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[9] + g_RT[11]);
+    Kc = Kc_s[95];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[11]) + (h_RT[0] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48151,12 +45294,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[13];
-    k_f = prefactor_units[96] * fwd_A[96]
-                * exp(fwd_beta[96] * tc[0] - activation_units[96] * fwd_Ea[96] * invT);
+    k_f = k_f_s[96];
     dlnkfdT = fwd_beta[96] * invT + activation_units[96] * fwd_Ea[96] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[12];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[12] + g_RT[13]);
+    Kc = Kc_s[96];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[13]) + (h_RT[0] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48202,12 +45344,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[16];
-    k_f = prefactor_units[97] * fwd_A[97]
-                * exp(fwd_beta[97] * tc[0] - activation_units[97] * fwd_Ea[97] * invT);
+    k_f = k_f_s[97];
     dlnkfdT = fwd_beta[97] * invT + activation_units[97] * fwd_Ea[97] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[14];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[97];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[16]) + (h_RT[0] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48253,12 +45394,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[17];
-    k_f = prefactor_units[98] * fwd_A[98]
-                * exp(fwd_beta[98] * tc[0] - activation_units[98] * fwd_Ea[98] * invT);
+    k_f = k_f_s[98];
     dlnkfdT = fwd_beta[98] * invT + activation_units[98] * fwd_Ea[98] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[16];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[98];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[17]) + (h_RT[0] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48304,12 +45444,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[18];
-    k_f = prefactor_units[99] * fwd_A[99]
-                * exp(fwd_beta[99] * tc[0] - activation_units[99] * fwd_Ea[99] * invT);
+    k_f = k_f_s[99];
     dlnkfdT = fwd_beta[99] * invT + activation_units[99] * fwd_Ea[99] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[17];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[99];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[18]) + (h_RT[0] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48355,12 +45494,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[18];
-    k_f = prefactor_units[100] * fwd_A[100]
-                * exp(fwd_beta[100] * tc[0] - activation_units[100] * fwd_Ea[100] * invT);
+    k_f = k_f_s[100];
     dlnkfdT = fwd_beta[100] * invT + activation_units[100] * fwd_Ea[100] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[12];
-    Kc = exp(g_RT[1] - g_RT[4] - g_RT[12] + g_RT[18]);
+    Kc = Kc_s[100];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[18]) + (h_RT[4] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48406,12 +45544,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[18];
-    k_f = prefactor_units[101] * fwd_A[101]
-                * exp(fwd_beta[101] * tc[0] - activation_units[101] * fwd_Ea[101] * invT);
+    k_f = k_f_s[101];
     dlnkfdT = fwd_beta[101] * invT + activation_units[101] * fwd_Ea[101] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[11];
-    Kc = exp(g_RT[1] - g_RT[5] - g_RT[11] + g_RT[18]);
+    Kc = Kc_s[101];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[18]) + (h_RT[5] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48457,12 +45594,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[102] * fwd_A[102]
-                * exp(fwd_beta[102] * tc[0] - activation_units[102] * fwd_Ea[102] * invT);
+    k_f = k_f_s[102];
     dlnkfdT = fwd_beta[102] * invT + activation_units[102] * fwd_Ea[102] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[18];
-    Kc = exp(g_RT[1] - g_RT[1] - g_RT[18] + g_RT[19]);
+    Kc = Kc_s[102];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[1] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48492,12 +45628,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[103] * fwd_A[103]
-                * exp(fwd_beta[103] * tc[0] - activation_units[103] * fwd_Ea[103] * invT);
+    k_f = k_f_s[103];
     dlnkfdT = fwd_beta[103] * invT + activation_units[103] * fwd_Ea[103] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[17];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[17] + g_RT[19]);
+    Kc = Kc_s[103];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[0] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48543,12 +45678,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[104] * fwd_A[104]
-                * exp(fwd_beta[104] * tc[0] - activation_units[104] * fwd_Ea[104] * invT);
+    k_f = k_f_s[104];
     dlnkfdT = fwd_beta[104] * invT + activation_units[104] * fwd_Ea[104] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[12];
-    Kc = exp(g_RT[1] - g_RT[4] - g_RT[12] + g_RT[19]);
+    Kc = Kc_s[104];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[4] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48594,12 +45728,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[105] * fwd_A[105]
-                * exp(fwd_beta[105] * tc[0] - activation_units[105] * fwd_Ea[105] * invT);
+    k_f = k_f_s[105];
     dlnkfdT = fwd_beta[105] * invT + activation_units[105] * fwd_Ea[105] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[11];
-    Kc = exp(g_RT[1] - g_RT[5] - g_RT[11] + g_RT[19]);
+    Kc = Kc_s[105];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[5] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48645,12 +45778,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[20];
-    k_f = prefactor_units[106] * fwd_A[106]
-                * exp(fwd_beta[106] * tc[0] - activation_units[106] * fwd_Ea[106] * invT);
+    k_f = k_f_s[106];
     dlnkfdT = fwd_beta[106] * invT + activation_units[106] * fwd_Ea[106] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[18];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[106];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[20]) + (h_RT[0] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48696,12 +45828,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[20];
-    k_f = prefactor_units[107] * fwd_A[107]
-                * exp(fwd_beta[107] * tc[0] - activation_units[107] * fwd_Ea[107] * invT);
+    k_f = k_f_s[107];
     dlnkfdT = fwd_beta[107] * invT + activation_units[107] * fwd_Ea[107] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[19];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[19] + g_RT[20]);
+    Kc = Kc_s[107];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[20]) + (h_RT[0] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48747,12 +45878,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[23];
-    k_f = prefactor_units[108] * fwd_A[108]
-                * exp(fwd_beta[108] * tc[0] - activation_units[108] * fwd_Ea[108] * invT);
+    k_f = k_f_s[108];
     dlnkfdT = fwd_beta[108] * invT + activation_units[108] * fwd_Ea[108] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[22];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[22] + g_RT[23]);
+    Kc = Kc_s[108];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[23]) + (h_RT[0] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48798,12 +45928,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[24];
-    k_f = prefactor_units[109] * fwd_A[109]
-                * exp(fwd_beta[109] * tc[0] - activation_units[109] * fwd_Ea[109] * invT);
+    k_f = k_f_s[109];
     dlnkfdT = fwd_beta[109] * invT + activation_units[109] * fwd_Ea[109] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[23];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[23] + g_RT[24]);
+    Kc = Kc_s[109];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[24]) + (h_RT[0] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48849,12 +45978,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[25];
-    k_f = prefactor_units[110] * fwd_A[110]
-                * exp(fwd_beta[110] * tc[0] - activation_units[110] * fwd_Ea[110] * invT);
+    k_f = k_f_s[110];
     dlnkfdT = fwd_beta[110] * invT + activation_units[110] * fwd_Ea[110] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[24];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[24] + g_RT[25]);
+    Kc = Kc_s[110];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[25]) + (h_RT[0] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48900,12 +46028,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[26];
-    k_f = prefactor_units[111] * fwd_A[111]
-                * exp(fwd_beta[111] * tc[0] - activation_units[111] * fwd_Ea[111] * invT);
+    k_f = k_f_s[111];
     dlnkfdT = fwd_beta[111] * invT + activation_units[111] * fwd_Ea[111] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[25];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[25] + g_RT[26]);
+    Kc = Kc_s[111];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[26]) + (h_RT[0] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48951,12 +46078,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[27];
-    k_f = prefactor_units[112] * fwd_A[112]
-                * exp(fwd_beta[112] * tc[0] - activation_units[112] * fwd_Ea[112] * invT);
+    k_f = k_f_s[112];
     dlnkfdT = fwd_beta[112] * invT + activation_units[112] * fwd_Ea[112] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[14];
-    Kc = exp(g_RT[1] - g_RT[11] - g_RT[14] + g_RT[27]);
+    Kc = Kc_s[112];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[27]) + (h_RT[11] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49002,12 +46128,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[28];
-    k_f = prefactor_units[113] * fwd_A[113]
-                * exp(fwd_beta[113] * tc[0] - activation_units[113] * fwd_Ea[113] * invT);
+    k_f = k_f_s[113];
     dlnkfdT = fwd_beta[113] * invT + activation_units[113] * fwd_Ea[113] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[27];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[27] + g_RT[28]);
+    Kc = Kc_s[113];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[28]) + (h_RT[0] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49053,12 +46178,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[28];
-    k_f = prefactor_units[114] * fwd_A[114]
-                * exp(fwd_beta[114] * tc[0] - activation_units[114] * fwd_Ea[114] * invT);
+    k_f = k_f_s[114];
     dlnkfdT = fwd_beta[114] * invT + activation_units[114] * fwd_Ea[114] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[14];
-    Kc = exp(g_RT[1] - g_RT[12] - g_RT[14] + g_RT[28]);
+    Kc = Kc_s[114];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[28]) + (h_RT[12] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49104,12 +46228,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[29];
-    k_f = prefactor_units[115] * fwd_A[115]
-                * exp(fwd_beta[115] * tc[0] - activation_units[115] * fwd_Ea[115] * invT);
+    k_f = k_f_s[115];
     dlnkfdT = fwd_beta[115] * invT + activation_units[115] * fwd_Ea[115] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[28];
-    Kc = exp(g_RT[1] - g_RT[1] - g_RT[28] + g_RT[29]);
+    Kc = Kc_s[115];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[29]) + (h_RT[1] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49139,12 +46262,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[4];
-    k_f = prefactor_units[116] * fwd_A[116]
-                * exp(fwd_beta[116] * tc[0] - activation_units[116] * fwd_Ea[116] * invT);
+    k_f = k_f_s[116];
     dlnkfdT = fwd_beta[116] * invT + activation_units[116] * fwd_Ea[116] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[5];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[4] - g_RT[5]);
+    Kc = Kc_s[116];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[4]) + (h_RT[1] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49190,12 +46312,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[4];
-    k_f = prefactor_units[117] * fwd_A[117]
-                * exp(fwd_beta[117] * tc[0] - activation_units[117] * fwd_Ea[117] * invT);
+    k_f = k_f_s[117];
     dlnkfdT = fwd_beta[117] * invT + activation_units[117] * fwd_Ea[117] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[5];
-    Kc = exp(-g_RT[2] + 2*g_RT[4] - g_RT[5]);
+    Kc = Kc_s[117];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[4]) + (h_RT[2] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49230,12 +46351,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[6];
-    k_f = prefactor_units[118] * fwd_A[118]
-                * exp(fwd_beta[118] * tc[0] - activation_units[118] * fwd_Ea[118] * invT);
+    k_f = k_f_s[118];
     dlnkfdT = fwd_beta[118] * invT + activation_units[118] * fwd_Ea[118] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[5];
-    Kc = exp(-g_RT[3] + g_RT[4] - g_RT[5] + g_RT[6]);
+    Kc = Kc_s[118];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[6]) + (h_RT[3] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49281,12 +46401,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[7];
-    k_f = prefactor_units[119] * fwd_A[119]
-                * exp(fwd_beta[119] * tc[0] - activation_units[119] * fwd_Ea[119] * invT);
+    k_f = k_f_s[119];
     dlnkfdT = fwd_beta[119] * invT + activation_units[119] * fwd_Ea[119] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[119];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[7]) + (h_RT[5] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49332,12 +46451,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[7];
-    k_f = prefactor_units[120] * fwd_A[120]
-                * exp(fwd_beta[120] * tc[0] - activation_units[120] * fwd_Ea[120] * invT);
+    k_f = k_f_s[120];
     dlnkfdT = fwd_beta[120] * invT + activation_units[120] * fwd_Ea[120] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[120];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[7]) + (h_RT[5] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49383,12 +46501,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[8];
-    k_f = prefactor_units[121] * fwd_A[121]
-                * exp(fwd_beta[121] * tc[0] - activation_units[121] * fwd_Ea[121] * invT);
+    k_f = k_f_s[121];
     dlnkfdT = fwd_beta[121] * invT + activation_units[121] * fwd_Ea[121] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[8] - g_RT[14]);
+    Kc = Kc_s[121];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[8]) + (h_RT[1] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49434,12 +46551,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[9];
-    k_f = prefactor_units[122] * fwd_A[122]
-                * exp(fwd_beta[122] * tc[0] - activation_units[122] * fwd_Ea[122] * invT);
+    k_f = k_f_s[122];
     dlnkfdT = fwd_beta[122] * invT + activation_units[122] * fwd_Ea[122] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[16];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[9] - g_RT[16]);
+    Kc = Kc_s[122];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[9]) + (h_RT[1] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49485,12 +46601,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[10];
-    k_f = prefactor_units[123] * fwd_A[123]
-                * exp(fwd_beta[123] * tc[0] - activation_units[123] * fwd_Ea[123] * invT);
+    k_f = k_f_s[123];
     dlnkfdT = fwd_beta[123] * invT + activation_units[123] * fwd_Ea[123] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[17];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[10] - g_RT[17]);
+    Kc = Kc_s[123];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[10]) + (h_RT[1] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49536,12 +46651,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[10];
-    k_f = prefactor_units[124] * fwd_A[124]
-                * exp(fwd_beta[124] * tc[0] - activation_units[124] * fwd_Ea[124] * invT);
+    k_f = k_f_s[124];
     dlnkfdT = fwd_beta[124] * invT + activation_units[124] * fwd_Ea[124] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[9];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[9] + g_RT[10]);
+    Kc = Kc_s[124];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[10]) + (h_RT[5] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49587,12 +46701,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[11];
-    k_f = prefactor_units[125] * fwd_A[125]
-                * exp(fwd_beta[125] * tc[0] - activation_units[125] * fwd_Ea[125] * invT);
+    k_f = k_f_s[125];
     dlnkfdT = fwd_beta[125] * invT + activation_units[125] * fwd_Ea[125] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[17];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[11] - g_RT[17]);
+    Kc = Kc_s[125];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[11]) + (h_RT[1] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49638,12 +46751,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[12];
-    k_f = prefactor_units[126] * fwd_A[126]
-                * exp(fwd_beta[126] * tc[0] - activation_units[126] * fwd_Ea[126] * invT);
+    k_f = k_f_s[126];
     dlnkfdT = fwd_beta[126] * invT + activation_units[126] * fwd_Ea[126] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[10];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[10] + g_RT[12]);
+    Kc = Kc_s[126];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[12]) + (h_RT[5] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49689,12 +46801,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[12];
-    k_f = prefactor_units[127] * fwd_A[127]
-                * exp(fwd_beta[127] * tc[0] - activation_units[127] * fwd_Ea[127] * invT);
+    k_f = k_f_s[127];
     dlnkfdT = fwd_beta[127] * invT + activation_units[127] * fwd_Ea[127] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[11];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[11] + g_RT[12]);
+    Kc = Kc_s[127];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[12]) + (h_RT[5] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49740,12 +46851,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[13];
-    k_f = prefactor_units[128] * fwd_A[128]
-                * exp(fwd_beta[128] * tc[0] - activation_units[128] * fwd_Ea[128] * invT);
+    k_f = k_f_s[128];
     dlnkfdT = fwd_beta[128] * invT + activation_units[128] * fwd_Ea[128] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[12];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[12] + g_RT[13]);
+    Kc = Kc_s[128];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[13]) + (h_RT[5] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49791,12 +46901,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[14];
-    k_f = prefactor_units[129] * fwd_A[129]
-                * exp(fwd_beta[129] * tc[0] - activation_units[129] * fwd_Ea[129] * invT);
+    k_f = k_f_s[129];
     dlnkfdT = fwd_beta[129] * invT + activation_units[129] * fwd_Ea[129] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[15];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[129];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[14]) + (h_RT[1] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49842,12 +46951,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[16];
-    k_f = prefactor_units[130] * fwd_A[130]
-                * exp(fwd_beta[130] * tc[0] - activation_units[130] * fwd_Ea[130] * invT);
+    k_f = k_f_s[130];
     dlnkfdT = fwd_beta[130] * invT + activation_units[130] * fwd_Ea[130] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[14];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[130];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[16]) + (h_RT[5] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49893,12 +47001,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[17];
-    k_f = prefactor_units[131] * fwd_A[131]
-                * exp(fwd_beta[131] * tc[0] - activation_units[131] * fwd_Ea[131] * invT);
+    k_f = k_f_s[131];
     dlnkfdT = fwd_beta[131] * invT + activation_units[131] * fwd_Ea[131] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[16];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[131];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[17]) + (h_RT[5] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49944,12 +47051,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[18];
-    k_f = prefactor_units[132] * fwd_A[132]
-                * exp(fwd_beta[132] * tc[0] - activation_units[132] * fwd_Ea[132] * invT);
+    k_f = k_f_s[132];
     dlnkfdT = fwd_beta[132] * invT + activation_units[132] * fwd_Ea[132] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[17];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[132];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[18]) + (h_RT[5] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49995,12 +47101,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[19];
-    k_f = prefactor_units[133] * fwd_A[133]
-                * exp(fwd_beta[133] * tc[0] - activation_units[133] * fwd_Ea[133] * invT);
+    k_f = k_f_s[133];
     dlnkfdT = fwd_beta[133] * invT + activation_units[133] * fwd_Ea[133] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[17];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[17] + g_RT[19]);
+    Kc = Kc_s[133];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[19]) + (h_RT[5] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50046,12 +47151,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[20];
-    k_f = prefactor_units[134] * fwd_A[134]
-                * exp(fwd_beta[134] * tc[0] - activation_units[134] * fwd_Ea[134] * invT);
+    k_f = k_f_s[134];
     dlnkfdT = fwd_beta[134] * invT + activation_units[134] * fwd_Ea[134] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[18];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[134];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[20]) + (h_RT[5] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50097,12 +47201,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[20];
-    k_f = prefactor_units[135] * fwd_A[135]
-                * exp(fwd_beta[135] * tc[0] - activation_units[135] * fwd_Ea[135] * invT);
+    k_f = k_f_s[135];
     dlnkfdT = fwd_beta[135] * invT + activation_units[135] * fwd_Ea[135] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[19];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[19] + g_RT[20]);
+    Kc = Kc_s[135];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[20]) + (h_RT[5] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50148,12 +47251,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[21];
-    k_f = prefactor_units[136] * fwd_A[136]
-                * exp(fwd_beta[136] * tc[0] - activation_units[136] * fwd_Ea[136] * invT);
+    k_f = k_f_s[136];
     dlnkfdT = fwd_beta[136] * invT + activation_units[136] * fwd_Ea[136] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[27];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[21] - g_RT[27]);
+    Kc = Kc_s[136];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[21]) + (h_RT[1] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50199,12 +47301,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[22];
-    k_f = prefactor_units[137] * fwd_A[137]
-                * exp(fwd_beta[137] * tc[0] - activation_units[137] * fwd_Ea[137] * invT);
+    k_f = k_f_s[137];
     dlnkfdT = fwd_beta[137] * invT + activation_units[137] * fwd_Ea[137] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[28];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[22] - g_RT[28]);
+    Kc = Kc_s[137];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[22]) + (h_RT[1] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50250,12 +47351,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[22];
-    k_f = prefactor_units[138] * fwd_A[138]
-                * exp(fwd_beta[138] * tc[0] - activation_units[138] * fwd_Ea[138] * invT);
+    k_f = k_f_s[138];
     dlnkfdT = fwd_beta[138] * invT + activation_units[138] * fwd_Ea[138] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[29];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[22] - g_RT[29]);
+    Kc = Kc_s[138];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[22]) + (h_RT[1] + h_RT[29]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50301,12 +47401,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[22];
-    k_f = prefactor_units[139] * fwd_A[139]
-                * exp(fwd_beta[139] * tc[0] - activation_units[139] * fwd_Ea[139] * invT);
+    k_f = k_f_s[139];
     dlnkfdT = fwd_beta[139] * invT + activation_units[139] * fwd_Ea[139] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[21];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[139];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[22]) + (h_RT[5] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50352,12 +47451,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[22];
-    k_f = prefactor_units[140] * fwd_A[140]
-                * exp(fwd_beta[140] * tc[0] - activation_units[140] * fwd_Ea[140] * invT);
+    k_f = k_f_s[140];
     dlnkfdT = fwd_beta[140] * invT + activation_units[140] * fwd_Ea[140] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[14];
-    Kc = exp(g_RT[4] - g_RT[12] - g_RT[14] + g_RT[22]);
+    Kc = Kc_s[140];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[22]) + (h_RT[12] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50403,12 +47501,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[23];
-    k_f = prefactor_units[141] * fwd_A[141]
-                * exp(fwd_beta[141] * tc[0] - activation_units[141] * fwd_Ea[141] * invT);
+    k_f = k_f_s[141];
     dlnkfdT = fwd_beta[141] * invT + activation_units[141] * fwd_Ea[141] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[22];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[22] + g_RT[23]);
+    Kc = Kc_s[141];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[23]) + (h_RT[5] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50454,12 +47551,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[24];
-    k_f = prefactor_units[142] * fwd_A[142]
-                * exp(fwd_beta[142] * tc[0] - activation_units[142] * fwd_Ea[142] * invT);
+    k_f = k_f_s[142];
     dlnkfdT = fwd_beta[142] * invT + activation_units[142] * fwd_Ea[142] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[23];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[23] + g_RT[24]);
+    Kc = Kc_s[142];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[24]) + (h_RT[5] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50505,12 +47601,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[26];
-    k_f = prefactor_units[143] * fwd_A[143]
-                * exp(fwd_beta[143] * tc[0] - activation_units[143] * fwd_Ea[143] * invT);
+    k_f = k_f_s[143];
     dlnkfdT = fwd_beta[143] * invT + activation_units[143] * fwd_Ea[143] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[25];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[25] + g_RT[26]);
+    Kc = Kc_s[143];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[26]) + (h_RT[5] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50556,12 +47651,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[28];
-    k_f = prefactor_units[144] * fwd_A[144]
-                * exp(fwd_beta[144] * tc[0] - activation_units[144] * fwd_Ea[144] * invT);
+    k_f = k_f_s[144];
     dlnkfdT = fwd_beta[144] * invT + activation_units[144] * fwd_Ea[144] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[27];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[27] + g_RT[28]);
+    Kc = Kc_s[144];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[28]) + (h_RT[5] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50607,12 +47701,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[6];
-    k_f = prefactor_units[145] * fwd_A[145]
-                * exp(fwd_beta[145] * tc[0] - activation_units[145] * fwd_Ea[145] * invT);
+    k_f = k_f_s[145];
     dlnkfdT = fwd_beta[145] * invT + activation_units[145] * fwd_Ea[145] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[7];
-    Kc = exp(-g_RT[3] + 2*g_RT[6] - g_RT[7]);
+    Kc = Kc_s[145];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[6]) + (h_RT[3] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50647,12 +47740,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[6];
-    k_f = prefactor_units[146] * fwd_A[146]
-                * exp(fwd_beta[146] * tc[0] - activation_units[146] * fwd_Ea[146] * invT);
+    k_f = k_f_s[146];
     dlnkfdT = fwd_beta[146] * invT + activation_units[146] * fwd_Ea[146] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[7];
-    Kc = exp(-g_RT[3] + 2*g_RT[6] - g_RT[7]);
+    Kc = Kc_s[146];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[6]) + (h_RT[3] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50687,12 +47779,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[10];
-    k_f = prefactor_units[147] * fwd_A[147]
-                * exp(fwd_beta[147] * tc[0] - activation_units[147] * fwd_Ea[147] * invT);
+    k_f = k_f_s[147];
     dlnkfdT = fwd_beta[147] * invT + activation_units[147] * fwd_Ea[147] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[17];
-    Kc = exp(-g_RT[4] + g_RT[6] + g_RT[10] - g_RT[17]);
+    Kc = Kc_s[147];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[10]) + (h_RT[4] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50738,12 +47829,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[12];
-    k_f = prefactor_units[148] * fwd_A[148]
-                * exp(fwd_beta[148] * tc[0] - activation_units[148] * fwd_Ea[148] * invT);
+    k_f = k_f_s[148];
     dlnkfdT = fwd_beta[148] * invT + activation_units[148] * fwd_Ea[148] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[13];
-    Kc = exp(-g_RT[3] + g_RT[6] + g_RT[12] - g_RT[13]);
+    Kc = Kc_s[148];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[12]) + (h_RT[3] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50789,12 +47879,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[12];
-    k_f = prefactor_units[149] * fwd_A[149]
-                * exp(fwd_beta[149] * tc[0] - activation_units[149] * fwd_Ea[149] * invT);
+    k_f = k_f_s[149];
     dlnkfdT = fwd_beta[149] * invT + activation_units[149] * fwd_Ea[149] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[19];
-    Kc = exp(-g_RT[4] + g_RT[6] + g_RT[12] - g_RT[19]);
+    Kc = Kc_s[149];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[12]) + (h_RT[4] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50840,12 +47929,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[14];
-    k_f = prefactor_units[150] * fwd_A[150]
-                * exp(fwd_beta[150] * tc[0] - activation_units[150] * fwd_Ea[150] * invT);
+    k_f = k_f_s[150];
     dlnkfdT = fwd_beta[150] * invT + activation_units[150] * fwd_Ea[150] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[15];
-    Kc = exp(-g_RT[4] + g_RT[6] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[150];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[14]) + (h_RT[4] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50891,12 +47979,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[17];
-    k_f = prefactor_units[151] * fwd_A[151]
-                * exp(fwd_beta[151] * tc[0] - activation_units[151] * fwd_Ea[151] * invT);
+    k_f = k_f_s[151];
     dlnkfdT = fwd_beta[151] * invT + activation_units[151] * fwd_Ea[151] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[16];
-    Kc = exp(g_RT[6] - g_RT[7] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[151];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[17]) + (h_RT[7] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50942,12 +48029,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[8];
-    k_f = prefactor_units[152] * fwd_A[152]
-                * exp(fwd_beta[152] * tc[0] - activation_units[152] * fwd_Ea[152] * invT);
+    k_f = k_f_s[152];
     dlnkfdT = fwd_beta[152] * invT + activation_units[152] * fwd_Ea[152] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[14];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[8] - g_RT[14]);
+    Kc = Kc_s[152];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[8]) + (h_RT[2] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50993,12 +48079,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[10];
-    k_f = prefactor_units[153] * fwd_A[153]
-                * exp(fwd_beta[153] * tc[0] - activation_units[153] * fwd_Ea[153] * invT);
+    k_f = k_f_s[153];
     dlnkfdT = fwd_beta[153] * invT + activation_units[153] * fwd_Ea[153] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[21];
-    Kc = exp(-g_RT[1] + g_RT[8] + g_RT[10] - g_RT[21]);
+    Kc = Kc_s[153];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[10]) + (h_RT[1] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51044,12 +48129,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[12];
-    k_f = prefactor_units[154] * fwd_A[154]
-                * exp(fwd_beta[154] * tc[0] - activation_units[154] * fwd_Ea[154] * invT);
+    k_f = k_f_s[154];
     dlnkfdT = fwd_beta[154] * invT + activation_units[154] * fwd_Ea[154] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[22];
-    Kc = exp(-g_RT[1] + g_RT[8] + g_RT[12] - g_RT[22]);
+    Kc = Kc_s[154];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[12]) + (h_RT[1] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51095,12 +48179,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[9];
-    k_f = prefactor_units[155] * fwd_A[155]
-                * exp(fwd_beta[155] * tc[0] - activation_units[155] * fwd_Ea[155] * invT);
+    k_f = k_f_s[155];
     dlnkfdT = fwd_beta[155] * invT + activation_units[155] * fwd_Ea[155] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[16];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[9] - g_RT[16]);
+    Kc = Kc_s[155];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[9]) + (h_RT[2] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51146,12 +48229,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[9];
-    k_f = prefactor_units[156] * fwd_A[156]
-                * exp(fwd_beta[156] * tc[0] - activation_units[156] * fwd_Ea[156] * invT);
+    k_f = k_f_s[156];
     dlnkfdT = fwd_beta[156] * invT + activation_units[156] * fwd_Ea[156] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[10];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[9] - g_RT[10]);
+    Kc = Kc_s[156];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[9]) + (h_RT[1] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51197,12 +48279,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[9];
-    k_f = prefactor_units[157] * fwd_A[157]
-                * exp(fwd_beta[157] * tc[0] - activation_units[157] * fwd_Ea[157] * invT);
+    k_f = k_f_s[157];
     dlnkfdT = fwd_beta[157] * invT + activation_units[157] * fwd_Ea[157] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[17];
-    Kc = exp(-g_RT[1] + g_RT[5] + g_RT[9] - g_RT[17]);
+    Kc = Kc_s[157];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[9]) + (h_RT[1] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51248,12 +48329,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[10];
-    k_f = prefactor_units[158] * fwd_A[158]
-                * exp(fwd_beta[158] * tc[0] - activation_units[158] * fwd_Ea[158] * invT);
+    k_f = k_f_s[158];
     dlnkfdT = fwd_beta[158] * invT + activation_units[158] * fwd_Ea[158] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[22];
-    Kc = exp(-g_RT[1] + g_RT[9] + g_RT[10] - g_RT[22]);
+    Kc = Kc_s[158];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[10]) + (h_RT[1] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51299,12 +48379,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[12];
-    k_f = prefactor_units[159] * fwd_A[159]
-                * exp(fwd_beta[159] * tc[0] - activation_units[159] * fwd_Ea[159] * invT);
+    k_f = k_f_s[159];
     dlnkfdT = fwd_beta[159] * invT + activation_units[159] * fwd_Ea[159] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[23];
-    Kc = exp(-g_RT[1] + g_RT[9] + g_RT[12] - g_RT[23]);
+    Kc = Kc_s[159];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[12]) + (h_RT[1] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51350,12 +48429,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[13];
-    k_f = prefactor_units[160] * fwd_A[160]
-                * exp(fwd_beta[160] * tc[0] - activation_units[160] * fwd_Ea[160] * invT);
+    k_f = k_f_s[160];
     dlnkfdT = fwd_beta[160] * invT + activation_units[160] * fwd_Ea[160] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[24];
-    Kc = exp(-g_RT[1] + g_RT[9] + g_RT[13] - g_RT[24]);
+    Kc = Kc_s[160];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[13]) + (h_RT[1] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51401,12 +48479,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[15];
-    k_f = prefactor_units[161] * fwd_A[161]
-                * exp(fwd_beta[161] * tc[0] - activation_units[161] * fwd_Ea[161] * invT);
+    k_f = k_f_s[161];
     dlnkfdT = fwd_beta[161] * invT + activation_units[161] * fwd_Ea[161] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[16];
-    Kc = exp(g_RT[9] - g_RT[14] + g_RT[15] - g_RT[16]);
+    Kc = Kc_s[161];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[15]) + (h_RT[14] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51452,12 +48529,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[17];
-    k_f = prefactor_units[162] * fwd_A[162]
-                * exp(fwd_beta[162] * tc[0] - activation_units[162] * fwd_Ea[162] * invT);
+    k_f = k_f_s[162];
     dlnkfdT = fwd_beta[162] * invT + activation_units[162] * fwd_Ea[162] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[28];
-    Kc = exp(-g_RT[1] + g_RT[9] + g_RT[17] - g_RT[28]);
+    Kc = Kc_s[162];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[17]) + (h_RT[1] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51503,12 +48579,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[27];
-    k_f = prefactor_units[163] * fwd_A[163]
-                * exp(fwd_beta[163] * tc[0] - activation_units[163] * fwd_Ea[163] * invT);
+    k_f = k_f_s[163];
     dlnkfdT = fwd_beta[163] * invT + activation_units[163] * fwd_Ea[163] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[22];
-    Kc = exp(g_RT[9] - g_RT[14] - g_RT[22] + g_RT[27]);
+    Kc = Kc_s[163];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[27]) + (h_RT[14] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51554,8 +48629,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[10];
-    k_f = prefactor_units[164] * fwd_A[164]
-                * exp(fwd_beta[164] * tc[0] - activation_units[164] * fwd_Ea[164] * invT);
+    k_f = k_f_s[164];
     dlnkfdT = fwd_beta[164] * invT + activation_units[164] * fwd_Ea[164] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -51591,12 +48665,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[10];
-    k_f = prefactor_units[165] * fwd_A[165]
-                * exp(fwd_beta[165] * tc[0] - activation_units[165] * fwd_Ea[165] * invT);
+    k_f = k_f_s[165];
     dlnkfdT = fwd_beta[165] * invT + activation_units[165] * fwd_Ea[165] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[12];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[10] - g_RT[12]);
+    Kc = Kc_s[165];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[10]) + (h_RT[1] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51642,12 +48715,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[10];
-    k_f = prefactor_units[166] * fwd_A[166]
-                * exp(fwd_beta[166] * tc[0] - activation_units[166] * fwd_Ea[166] * invT);
+    k_f = k_f_s[166];
     dlnkfdT = fwd_beta[166] * invT + activation_units[166] * fwd_Ea[166] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[22];
-    Kc = exp(-g_RT[0] + 2*g_RT[10] - g_RT[22]);
+    Kc = Kc_s[166];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[10]) + (h_RT[0] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51682,12 +48754,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[12];
-    k_f = prefactor_units[167] * fwd_A[167]
-                * exp(fwd_beta[167] * tc[0] - activation_units[167] * fwd_Ea[167] * invT);
+    k_f = k_f_s[167];
     dlnkfdT = fwd_beta[167] * invT + activation_units[167] * fwd_Ea[167] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[24];
-    Kc = exp(-g_RT[1] + g_RT[10] + g_RT[12] - g_RT[24]);
+    Kc = Kc_s[167];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[12]) + (h_RT[1] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51733,12 +48804,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[13];
-    k_f = prefactor_units[168] * fwd_A[168]
-                * exp(fwd_beta[168] * tc[0] - activation_units[168] * fwd_Ea[168] * invT);
+    k_f = k_f_s[168];
     dlnkfdT = fwd_beta[168] * invT + activation_units[168] * fwd_Ea[168] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[12];
-    Kc = exp(g_RT[10] - 2*g_RT[12] + g_RT[13]);
+    Kc = Kc_s[168];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[13]) + (2*h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51773,12 +48843,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[27];
-    k_f = prefactor_units[169] * fwd_A[169]
-                * exp(fwd_beta[169] * tc[0] - activation_units[169] * fwd_Ea[169] * invT);
+    k_f = k_f_s[169];
     dlnkfdT = fwd_beta[169] * invT + activation_units[169] * fwd_Ea[169] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[23];
-    Kc = exp(g_RT[10] - g_RT[14] - g_RT[23] + g_RT[27]);
+    Kc = Kc_s[169];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[27]) + (h_RT[14] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51824,12 +48893,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[47];
-    k_f = prefactor_units[170] * fwd_A[170]
-                * exp(fwd_beta[170] * tc[0] - activation_units[170] * fwd_Ea[170] * invT);
+    k_f = k_f_s[170];
     dlnkfdT = fwd_beta[170] * invT + activation_units[170] * fwd_Ea[170] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[47];
-    Kc = exp(-g_RT[10] + g_RT[11] + g_RT[47] - g_RT[47]);
+    Kc = Kc_s[170];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[47]) + (h_RT[10] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51859,12 +48927,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[48];
-    k_f = prefactor_units[171] * fwd_A[171]
-                * exp(fwd_beta[171] * tc[0] - activation_units[171] * fwd_Ea[171] * invT);
+    k_f = k_f_s[171];
     dlnkfdT = fwd_beta[171] * invT + activation_units[171] * fwd_Ea[171] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[48];
-    Kc = exp(-g_RT[10] + g_RT[11] + g_RT[48] - g_RT[48]);
+    Kc = Kc_s[171];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[48]) + (h_RT[10] + h_RT[48]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51894,12 +48961,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[11];
-    k_f = prefactor_units[172] * fwd_A[172]
-                * exp(fwd_beta[172] * tc[0] - activation_units[172] * fwd_Ea[172] * invT);
+    k_f = k_f_s[172];
     dlnkfdT = fwd_beta[172] * invT + activation_units[172] * fwd_Ea[172] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[4]*sc[14];
-    Kc = refC * exp(-g_RT[1] + g_RT[3] - g_RT[4] + g_RT[11] - g_RT[14]);
+    Kc = Kc_s[172];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[11]) + (h_RT[1] + h_RT[4] + h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51958,12 +49024,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[11];
-    k_f = prefactor_units[173] * fwd_A[173]
-                * exp(fwd_beta[173] * tc[0] - activation_units[173] * fwd_Ea[173] * invT);
+    k_f = k_f_s[173];
     dlnkfdT = fwd_beta[173] * invT + activation_units[173] * fwd_Ea[173] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[14];
-    Kc = exp(g_RT[3] - g_RT[5] + g_RT[11] - g_RT[14]);
+    Kc = Kc_s[173];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[11]) + (h_RT[5] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52009,12 +49074,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[11];
-    k_f = prefactor_units[174] * fwd_A[174]
-                * exp(fwd_beta[174] * tc[0] - activation_units[174] * fwd_Ea[174] * invT);
+    k_f = k_f_s[174];
     dlnkfdT = fwd_beta[174] * invT + activation_units[174] * fwd_Ea[174] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[12];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[11] - g_RT[12]);
+    Kc = Kc_s[174];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[11]) + (h_RT[1] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52060,12 +49124,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[11];
-    k_f = prefactor_units[175] * fwd_A[175]
-                * exp(fwd_beta[175] * tc[0] - activation_units[175] * fwd_Ea[175] * invT);
+    k_f = k_f_s[175];
     dlnkfdT = fwd_beta[175] * invT + activation_units[175] * fwd_Ea[175] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[10];
-    Kc = exp(g_RT[5] - g_RT[5] - g_RT[10] + g_RT[11]);
+    Kc = Kc_s[175];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[11]) + (h_RT[5] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52095,12 +49158,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[12];
-    k_f = prefactor_units[176] * fwd_A[176]
-                * exp(fwd_beta[176] * tc[0] - activation_units[176] * fwd_Ea[176] * invT);
+    k_f = k_f_s[176];
     dlnkfdT = fwd_beta[176] * invT + activation_units[176] * fwd_Ea[176] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[24];
-    Kc = exp(-g_RT[1] + g_RT[11] + g_RT[12] - g_RT[24]);
+    Kc = Kc_s[176];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[12]) + (h_RT[1] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52146,12 +49208,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[13];
-    k_f = prefactor_units[177] * fwd_A[177]
-                * exp(fwd_beta[177] * tc[0] - activation_units[177] * fwd_Ea[177] * invT);
+    k_f = k_f_s[177];
     dlnkfdT = fwd_beta[177] * invT + activation_units[177] * fwd_Ea[177] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[12];
-    Kc = exp(g_RT[11] - 2*g_RT[12] + g_RT[13]);
+    Kc = Kc_s[177];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[13]) + (2*h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52186,12 +49247,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[14];
-    k_f = prefactor_units[178] * fwd_A[178]
-                * exp(fwd_beta[178] * tc[0] - activation_units[178] * fwd_Ea[178] * invT);
+    k_f = k_f_s[178];
     dlnkfdT = fwd_beta[178] * invT + activation_units[178] * fwd_Ea[178] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[14];
-    Kc = exp(-g_RT[10] + g_RT[11] + g_RT[14] - g_RT[14]);
+    Kc = Kc_s[178];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[14]) + (h_RT[10] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52221,12 +49281,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[15];
-    k_f = prefactor_units[179] * fwd_A[179]
-                * exp(fwd_beta[179] * tc[0] - activation_units[179] * fwd_Ea[179] * invT);
+    k_f = k_f_s[179];
     dlnkfdT = fwd_beta[179] * invT + activation_units[179] * fwd_Ea[179] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[15];
-    Kc = exp(-g_RT[10] + g_RT[11] + g_RT[15] - g_RT[15]);
+    Kc = Kc_s[179];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[15]) + (h_RT[10] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52256,12 +49315,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[15];
-    k_f = prefactor_units[180] * fwd_A[180]
-                * exp(fwd_beta[180] * tc[0] - activation_units[180] * fwd_Ea[180] * invT);
+    k_f = k_f_s[180];
     dlnkfdT = fwd_beta[180] * invT + activation_units[180] * fwd_Ea[180] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[17];
-    Kc = exp(g_RT[11] - g_RT[14] + g_RT[15] - g_RT[17]);
+    Kc = Kc_s[180];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[15]) + (h_RT[14] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52307,12 +49365,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[26];
-    k_f = prefactor_units[181] * fwd_A[181]
-                * exp(fwd_beta[181] * tc[0] - activation_units[181] * fwd_Ea[181] * invT);
+    k_f = k_f_s[181];
     dlnkfdT = fwd_beta[181] * invT + activation_units[181] * fwd_Ea[181] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[25];
-    Kc = exp(g_RT[11] - g_RT[12] - g_RT[25] + g_RT[26]);
+    Kc = Kc_s[181];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[26]) + (h_RT[12] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52358,12 +49415,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[12];
-    k_f = prefactor_units[182] * fwd_A[182]
-                * exp(fwd_beta[182] * tc[0] - activation_units[182] * fwd_Ea[182] * invT);
+    k_f = k_f_s[182];
     dlnkfdT = fwd_beta[182] * invT + activation_units[182] * fwd_Ea[182] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[19];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[12] - g_RT[19]);
+    Kc = Kc_s[182];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[12]) + (h_RT[2] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52409,12 +49465,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[12];
-    k_f = prefactor_units[183] * fwd_A[183]
-                * exp(fwd_beta[183] * tc[0] - activation_units[183] * fwd_Ea[183] * invT);
+    k_f = k_f_s[183];
     dlnkfdT = fwd_beta[183] * invT + activation_units[183] * fwd_Ea[183] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[17];
-    Kc = exp(g_RT[3] - g_RT[4] + g_RT[12] - g_RT[17]);
+    Kc = Kc_s[183];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[12]) + (h_RT[4] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52460,12 +49515,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[12];
-    k_f = prefactor_units[184] * fwd_A[184]
-                * exp(fwd_beta[184] * tc[0] - activation_units[184] * fwd_Ea[184] * invT);
+    k_f = k_f_s[184];
     dlnkfdT = fwd_beta[184] * invT + activation_units[184] * fwd_Ea[184] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[13];
-    Kc = exp(-g_RT[6] + g_RT[7] + g_RT[12] - g_RT[13]);
+    Kc = Kc_s[184];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[12]) + (h_RT[6] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52511,12 +49565,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[12];
-    k_f = prefactor_units[185] * fwd_A[185]
-                * exp(fwd_beta[185] * tc[0] - activation_units[185] * fwd_Ea[185] * invT);
+    k_f = k_f_s[185];
     dlnkfdT = fwd_beta[185] * invT + activation_units[185] * fwd_Ea[185] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[25];
-    Kc = exp(-g_RT[1] + 2*g_RT[12] - g_RT[25]);
+    Kc = Kc_s[185];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[12]) + (h_RT[1] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52551,12 +49604,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[16];
-    k_f = prefactor_units[186] * fwd_A[186]
-                * exp(fwd_beta[186] * tc[0] - activation_units[186] * fwd_Ea[186] * invT);
+    k_f = k_f_s[186];
     dlnkfdT = fwd_beta[186] * invT + activation_units[186] * fwd_Ea[186] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[14];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[186];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[16]) + (h_RT[13] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52602,12 +49654,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[17];
-    k_f = prefactor_units[187] * fwd_A[187]
-                * exp(fwd_beta[187] * tc[0] - activation_units[187] * fwd_Ea[187] * invT);
+    k_f = k_f_s[187];
     dlnkfdT = fwd_beta[187] * invT + activation_units[187] * fwd_Ea[187] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[16];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[187];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[17]) + (h_RT[13] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52653,12 +49704,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[20];
-    k_f = prefactor_units[188] * fwd_A[188]
-                * exp(fwd_beta[188] * tc[0] - activation_units[188] * fwd_Ea[188] * invT);
+    k_f = k_f_s[188];
     dlnkfdT = fwd_beta[188] * invT + activation_units[188] * fwd_Ea[188] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[18];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[188];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[20]) + (h_RT[13] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52704,12 +49754,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[20];
-    k_f = prefactor_units[189] * fwd_A[189]
-                * exp(fwd_beta[189] * tc[0] - activation_units[189] * fwd_Ea[189] * invT);
+    k_f = k_f_s[189];
     dlnkfdT = fwd_beta[189] * invT + activation_units[189] * fwd_Ea[189] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[19];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[19] + g_RT[20]);
+    Kc = Kc_s[189];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[20]) + (h_RT[13] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52755,12 +49804,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[24];
-    k_f = prefactor_units[190] * fwd_A[190]
-                * exp(fwd_beta[190] * tc[0] - activation_units[190] * fwd_Ea[190] * invT);
+    k_f = k_f_s[190];
     dlnkfdT = fwd_beta[190] * invT + activation_units[190] * fwd_Ea[190] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[23];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[23] + g_RT[24]);
+    Kc = Kc_s[190];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[24]) + (h_RT[13] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52806,12 +49854,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[26];
-    k_f = prefactor_units[191] * fwd_A[191]
-                * exp(fwd_beta[191] * tc[0] - activation_units[191] * fwd_Ea[191] * invT);
+    k_f = k_f_s[191];
     dlnkfdT = fwd_beta[191] * invT + activation_units[191] * fwd_Ea[191] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[25];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[25] + g_RT[26]);
+    Kc = Kc_s[191];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[26]) + (h_RT[13] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52857,12 +49904,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[16];
-    k_f = prefactor_units[192] * fwd_A[192]
-                * exp(fwd_beta[192] * tc[0] - activation_units[192] * fwd_Ea[192] * invT);
+    k_f = k_f_s[192];
     dlnkfdT = fwd_beta[192] * invT + activation_units[192] * fwd_Ea[192] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[5]*sc[14];
-    Kc = refC * exp(-g_RT[1] + g_RT[5] - g_RT[5] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[192];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[16]) + (h_RT[1] + h_RT[5] + h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52902,12 +49948,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[16];
-    k_f = prefactor_units[193] * fwd_A[193]
-                * exp(fwd_beta[193] * tc[0] - activation_units[193] * fwd_Ea[193] * invT);
+    k_f = k_f_s[193];
     dlnkfdT = fwd_beta[193] * invT + activation_units[193] * fwd_Ea[193] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[14];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[193];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[16]) + (h_RT[6] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52953,12 +49998,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[18];
-    k_f = prefactor_units[194] * fwd_A[194]
-                * exp(fwd_beta[194] * tc[0] - activation_units[194] * fwd_Ea[194] * invT);
+    k_f = k_f_s[194];
     dlnkfdT = fwd_beta[194] * invT + activation_units[194] * fwd_Ea[194] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[17];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[194];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[18]) + (h_RT[6] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53004,12 +50048,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[19];
-    k_f = prefactor_units[195] * fwd_A[195]
-                * exp(fwd_beta[195] * tc[0] - activation_units[195] * fwd_Ea[195] * invT);
+    k_f = k_f_s[195];
     dlnkfdT = fwd_beta[195] * invT + activation_units[195] * fwd_Ea[195] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[17];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[17] + g_RT[19]);
+    Kc = Kc_s[195];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[19]) + (h_RT[6] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53055,12 +50098,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[21];
-    k_f = prefactor_units[196] * fwd_A[196]
-                * exp(fwd_beta[196] * tc[0] - activation_units[196] * fwd_Ea[196] * invT);
+    k_f = k_f_s[196];
     dlnkfdT = fwd_beta[196] * invT + activation_units[196] * fwd_Ea[196] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[16];
-    Kc = exp(g_RT[3] - g_RT[14] - g_RT[16] + g_RT[21]);
+    Kc = Kc_s[196];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[21]) + (h_RT[14] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53106,12 +50148,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[21];
-    k_f = prefactor_units[197] * fwd_A[197]
-                * exp(fwd_beta[197] * tc[0] - activation_units[197] * fwd_Ea[197] * invT);
+    k_f = k_f_s[197];
     dlnkfdT = fwd_beta[197] * invT + activation_units[197] * fwd_Ea[197] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[22];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[21] - g_RT[22]);
+    Kc = Kc_s[197];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[21]) + (h_RT[1] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53157,12 +50198,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[23];
-    k_f = prefactor_units[198] * fwd_A[198]
-                * exp(fwd_beta[198] * tc[0] - activation_units[198] * fwd_Ea[198] * invT);
+    k_f = k_f_s[198];
     dlnkfdT = fwd_beta[198] * invT + activation_units[198] * fwd_Ea[198] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[17];
-    Kc = exp(g_RT[3] - g_RT[16] - g_RT[17] + g_RT[23]);
+    Kc = Kc_s[198];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[23]) + (h_RT[16] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53208,12 +50248,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[25];
-    k_f = prefactor_units[199] * fwd_A[199]
-                * exp(fwd_beta[199] * tc[0] - activation_units[199] * fwd_Ea[199] * invT);
+    k_f = k_f_s[199];
     dlnkfdT = fwd_beta[199] * invT + activation_units[199] * fwd_Ea[199] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[24];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[24] + g_RT[25]);
+    Kc = Kc_s[199];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[25]) + (h_RT[6] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53259,12 +50298,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[27];
-    k_f = prefactor_units[200] * fwd_A[200]
-                * exp(fwd_beta[200] * tc[0] - activation_units[200] * fwd_Ea[200] * invT);
+    k_f = k_f_s[200];
     dlnkfdT = fwd_beta[200] * invT + activation_units[200] * fwd_Ea[200] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[14]*sc[14];
-    Kc = refC * exp(g_RT[3] - g_RT[4] - 2*g_RT[14] + g_RT[27]);
+    Kc = Kc_s[200];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[27]) + (h_RT[4] + 2*h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53310,12 +50348,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[27]*sc[27];
-    k_f = prefactor_units[201] * fwd_A[201]
-                * exp(fwd_beta[201] * tc[0] - activation_units[201] * fwd_Ea[201] * invT);
+    k_f = k_f_s[201];
     dlnkfdT = fwd_beta[201] * invT + activation_units[201] * fwd_Ea[201] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[14]*sc[22];
-    Kc = refC * exp(-2*g_RT[14] - g_RT[22] + 2*g_RT[27]);
+    Kc = Kc_s[201];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[27]) + (2*h_RT[14] + h_RT[22]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53350,12 +50387,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[30]*sc[35];
-    k_f = prefactor_units[202] * fwd_A[202]
-                * exp(fwd_beta[202] * tc[0] - activation_units[202] * fwd_Ea[202] * invT);
+    k_f = k_f_s[202];
     dlnkfdT = fwd_beta[202] * invT + activation_units[202] * fwd_Ea[202] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[47];
-    Kc = exp(-g_RT[2] + g_RT[30] + g_RT[35] - g_RT[47]);
+    Kc = Kc_s[202];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[30] + h_RT[35]) + (h_RT[2] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53401,12 +50437,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[30];
-    k_f = prefactor_units[203] * fwd_A[203]
-                * exp(fwd_beta[203] * tc[0] - activation_units[203] * fwd_Ea[203] * invT);
+    k_f = k_f_s[203];
     dlnkfdT = fwd_beta[203] * invT + activation_units[203] * fwd_Ea[203] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[35];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[30] - g_RT[35]);
+    Kc = Kc_s[203];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[30]) + (h_RT[2] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53452,12 +50487,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[30];
-    k_f = prefactor_units[204] * fwd_A[204]
-                * exp(fwd_beta[204] * tc[0] - activation_units[204] * fwd_Ea[204] * invT);
+    k_f = k_f_s[204];
     dlnkfdT = fwd_beta[204] * invT + activation_units[204] * fwd_Ea[204] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[35];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[30] - g_RT[35]);
+    Kc = Kc_s[204];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[30]) + (h_RT[1] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53503,12 +50537,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[37];
-    k_f = prefactor_units[205] * fwd_A[205]
-                * exp(fwd_beta[205] * tc[0] - activation_units[205] * fwd_Ea[205] * invT);
+    k_f = k_f_s[205];
     dlnkfdT = fwd_beta[205] * invT + activation_units[205] * fwd_Ea[205] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[47];
-    Kc = exp(g_RT[2] - g_RT[3] + g_RT[37] - g_RT[47]);
+    Kc = Kc_s[205];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[37]) + (h_RT[3] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53554,12 +50587,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[37];
-    k_f = prefactor_units[206] * fwd_A[206]
-                * exp(fwd_beta[206] * tc[0] - activation_units[206] * fwd_Ea[206] * invT);
+    k_f = k_f_s[206];
     dlnkfdT = fwd_beta[206] * invT + activation_units[206] * fwd_Ea[206] * invT2;
     /* reverse */
     phi_r = sc[35]*sc[35];
-    Kc = exp(g_RT[2] - 2*g_RT[35] + g_RT[37]);
+    Kc = Kc_s[206];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[37]) + (2*h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53594,12 +50626,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[37];
-    k_f = prefactor_units[207] * fwd_A[207]
-                * exp(fwd_beta[207] * tc[0] - activation_units[207] * fwd_Ea[207] * invT);
+    k_f = k_f_s[207];
     dlnkfdT = fwd_beta[207] * invT + activation_units[207] * fwd_Ea[207] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[47];
-    Kc = exp(g_RT[1] - g_RT[4] + g_RT[37] - g_RT[47]);
+    Kc = Kc_s[207];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[37]) + (h_RT[4] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53645,12 +50676,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[37];
-    k_f = prefactor_units[208] * fwd_A[208]
-                * exp(fwd_beta[208] * tc[0] - activation_units[208] * fwd_Ea[208] * invT);
+    k_f = k_f_s[208];
     dlnkfdT = fwd_beta[208] * invT + activation_units[208] * fwd_Ea[208] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[47];
-    Kc = exp(g_RT[4] - g_RT[6] + g_RT[37] - g_RT[47]);
+    Kc = Kc_s[208];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[37]) + (h_RT[6] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53696,12 +50726,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[35];
-    k_f = prefactor_units[209] * fwd_A[209]
-                * exp(fwd_beta[209] * tc[0] - activation_units[209] * fwd_Ea[209] * invT);
+    k_f = k_f_s[209];
     dlnkfdT = fwd_beta[209] * invT + activation_units[209] * fwd_Ea[209] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[36];
-    Kc = exp(-g_RT[4] + g_RT[6] + g_RT[35] - g_RT[36]);
+    Kc = Kc_s[209];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[35]) + (h_RT[4] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53747,12 +50776,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[36];
-    k_f = prefactor_units[210] * fwd_A[210]
-                * exp(fwd_beta[210] * tc[0] - activation_units[210] * fwd_Ea[210] * invT);
+    k_f = k_f_s[210];
     dlnkfdT = fwd_beta[210] * invT + activation_units[210] * fwd_Ea[210] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[35];
-    Kc = exp(g_RT[2] - g_RT[3] - g_RT[35] + g_RT[36]);
+    Kc = Kc_s[210];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[36]) + (h_RT[3] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53798,12 +50826,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[36];
-    k_f = prefactor_units[211] * fwd_A[211]
-                * exp(fwd_beta[211] * tc[0] - activation_units[211] * fwd_Ea[211] * invT);
+    k_f = k_f_s[211];
     dlnkfdT = fwd_beta[211] * invT + activation_units[211] * fwd_Ea[211] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[35];
-    Kc = exp(g_RT[1] - g_RT[4] - g_RT[35] + g_RT[36]);
+    Kc = Kc_s[211];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[36]) + (h_RT[4] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53849,12 +50876,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[31];
-    k_f = prefactor_units[212] * fwd_A[212]
-                * exp(fwd_beta[212] * tc[0] - activation_units[212] * fwd_Ea[212] * invT);
+    k_f = k_f_s[212];
     dlnkfdT = fwd_beta[212] * invT + activation_units[212] * fwd_Ea[212] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[35];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[31] - g_RT[35]);
+    Kc = Kc_s[212];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[31]) + (h_RT[1] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53900,12 +50926,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[31];
-    k_f = prefactor_units[213] * fwd_A[213]
-                * exp(fwd_beta[213] * tc[0] - activation_units[213] * fwd_Ea[213] * invT);
+    k_f = k_f_s[213];
     dlnkfdT = fwd_beta[213] * invT + activation_units[213] * fwd_Ea[213] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[30];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[30] + g_RT[31]);
+    Kc = Kc_s[213];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[31]) + (h_RT[0] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53951,12 +50976,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[31];
-    k_f = prefactor_units[214] * fwd_A[214]
-                * exp(fwd_beta[214] * tc[0] - activation_units[214] * fwd_Ea[214] * invT);
+    k_f = k_f_s[214];
     dlnkfdT = fwd_beta[214] * invT + activation_units[214] * fwd_Ea[214] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[38];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[31] - g_RT[38]);
+    Kc = Kc_s[214];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[31]) + (h_RT[1] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54002,12 +51026,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[31];
-    k_f = prefactor_units[215] * fwd_A[215]
-                * exp(fwd_beta[215] * tc[0] - activation_units[215] * fwd_Ea[215] * invT);
+    k_f = k_f_s[215];
     dlnkfdT = fwd_beta[215] * invT + activation_units[215] * fwd_Ea[215] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[30];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[30] + g_RT[31]);
+    Kc = Kc_s[215];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[31]) + (h_RT[5] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54053,12 +51076,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[31];
-    k_f = prefactor_units[216] * fwd_A[216]
-                * exp(fwd_beta[216] * tc[0] - activation_units[216] * fwd_Ea[216] * invT);
+    k_f = k_f_s[216];
     dlnkfdT = fwd_beta[216] * invT + activation_units[216] * fwd_Ea[216] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[38];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[31] - g_RT[38]);
+    Kc = Kc_s[216];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[31]) + (h_RT[2] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54104,12 +51126,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[31];
-    k_f = prefactor_units[217] * fwd_A[217]
-                * exp(fwd_beta[217] * tc[0] - activation_units[217] * fwd_Ea[217] * invT);
+    k_f = k_f_s[217];
     dlnkfdT = fwd_beta[217] * invT + activation_units[217] * fwd_Ea[217] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[35];
-    Kc = exp(g_RT[3] - g_RT[4] + g_RT[31] - g_RT[35]);
+    Kc = Kc_s[217];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[31]) + (h_RT[4] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54155,12 +51176,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[30]*sc[31];
-    k_f = prefactor_units[218] * fwd_A[218]
-                * exp(fwd_beta[218] * tc[0] - activation_units[218] * fwd_Ea[218] * invT);
+    k_f = k_f_s[218];
     dlnkfdT = fwd_beta[218] * invT + activation_units[218] * fwd_Ea[218] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[47];
-    Kc = exp(-g_RT[1] + g_RT[30] + g_RT[31] - g_RT[47]);
+    Kc = Kc_s[218];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[30] + h_RT[31]) + (h_RT[1] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54206,12 +51226,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[31];
-    k_f = prefactor_units[219] * fwd_A[219]
-                * exp(fwd_beta[219] * tc[0] - activation_units[219] * fwd_Ea[219] * invT);
+    k_f = k_f_s[219];
     dlnkfdT = fwd_beta[219] * invT + activation_units[219] * fwd_Ea[219] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[38];
-    Kc = exp(-g_RT[0] + g_RT[5] + g_RT[31] - g_RT[38]);
+    Kc = Kc_s[219];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[31]) + (h_RT[0] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54257,12 +51276,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[31]*sc[35];
-    k_f = prefactor_units[220] * fwd_A[220]
-                * exp(fwd_beta[220] * tc[0] - activation_units[220] * fwd_Ea[220] * invT);
+    k_f = k_f_s[220];
     dlnkfdT = fwd_beta[220] * invT + activation_units[220] * fwd_Ea[220] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[47];
-    Kc = exp(-g_RT[4] + g_RT[31] + g_RT[35] - g_RT[47]);
+    Kc = Kc_s[220];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[31] + h_RT[35]) + (h_RT[4] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54308,12 +51326,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[31]*sc[35];
-    k_f = prefactor_units[221] * fwd_A[221]
-                * exp(fwd_beta[221] * tc[0] - activation_units[221] * fwd_Ea[221] * invT);
+    k_f = k_f_s[221];
     dlnkfdT = fwd_beta[221] * invT + activation_units[221] * fwd_Ea[221] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[37];
-    Kc = exp(-g_RT[1] + g_RT[31] + g_RT[35] - g_RT[37]);
+    Kc = Kc_s[221];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[31] + h_RT[35]) + (h_RT[1] + h_RT[37]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54359,12 +51376,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[32];
-    k_f = prefactor_units[222] * fwd_A[222]
-                * exp(fwd_beta[222] * tc[0] - activation_units[222] * fwd_Ea[222] * invT);
+    k_f = k_f_s[222];
     dlnkfdT = fwd_beta[222] * invT + activation_units[222] * fwd_Ea[222] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[31];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[31] + g_RT[32]);
+    Kc = Kc_s[222];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[32]) + (h_RT[4] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54410,12 +51426,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[32];
-    k_f = prefactor_units[223] * fwd_A[223]
-                * exp(fwd_beta[223] * tc[0] - activation_units[223] * fwd_Ea[223] * invT);
+    k_f = k_f_s[223];
     dlnkfdT = fwd_beta[223] * invT + activation_units[223] * fwd_Ea[223] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[38];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[32] - g_RT[38]);
+    Kc = Kc_s[223];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[32]) + (h_RT[1] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54461,12 +51476,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[32];
-    k_f = prefactor_units[224] * fwd_A[224]
-                * exp(fwd_beta[224] * tc[0] - activation_units[224] * fwd_Ea[224] * invT);
+    k_f = k_f_s[224];
     dlnkfdT = fwd_beta[224] * invT + activation_units[224] * fwd_Ea[224] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[31];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[31] + g_RT[32]);
+    Kc = Kc_s[224];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[32]) + (h_RT[0] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54512,12 +51526,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[32];
-    k_f = prefactor_units[225] * fwd_A[225]
-                * exp(fwd_beta[225] * tc[0] - activation_units[225] * fwd_Ea[225] * invT);
+    k_f = k_f_s[225];
     dlnkfdT = fwd_beta[225] * invT + activation_units[225] * fwd_Ea[225] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[31];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[31] + g_RT[32]);
+    Kc = Kc_s[225];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[32]) + (h_RT[5] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54563,12 +51576,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[34];
-    k_f = prefactor_units[226] * fwd_A[226]
-                * exp(fwd_beta[226] * tc[0] - activation_units[226] * fwd_Ea[226] * invT);
+    k_f = k_f_s[226];
     dlnkfdT = fwd_beta[226] * invT + activation_units[226] * fwd_Ea[226] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[47];
-    Kc = refC * exp(-g_RT[1] + g_RT[34] - g_RT[47]);
+    Kc = Kc_s[226];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[34]) + (h_RT[1] + h_RT[47]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54603,12 +51615,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[34];
-    k_f = prefactor_units[227] * fwd_A[227]
-                * exp(fwd_beta[227] * tc[0] - activation_units[227] * fwd_Ea[227] * invT);
+    k_f = k_f_s[227];
     dlnkfdT = fwd_beta[227] * invT + activation_units[227] * fwd_Ea[227] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[47];
-    Kc = exp(g_RT[3] - g_RT[6] + g_RT[34] - g_RT[47]);
+    Kc = Kc_s[227];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[34]) + (h_RT[6] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54654,12 +51665,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[34];
-    k_f = prefactor_units[228] * fwd_A[228]
-                * exp(fwd_beta[228] * tc[0] - activation_units[228] * fwd_Ea[228] * invT);
+    k_f = k_f_s[228];
     dlnkfdT = fwd_beta[228] * invT + activation_units[228] * fwd_Ea[228] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[47];
-    Kc = exp(g_RT[2] - g_RT[4] + g_RT[34] - g_RT[47]);
+    Kc = Kc_s[228];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[34]) + (h_RT[4] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54705,12 +51715,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[34];
-    k_f = prefactor_units[229] * fwd_A[229]
-                * exp(fwd_beta[229] * tc[0] - activation_units[229] * fwd_Ea[229] * invT);
+    k_f = k_f_s[229];
     dlnkfdT = fwd_beta[229] * invT + activation_units[229] * fwd_Ea[229] * invT2;
     /* reverse */
     phi_r = sc[31]*sc[35];
-    Kc = exp(g_RT[2] - g_RT[31] + g_RT[34] - g_RT[35]);
+    Kc = Kc_s[229];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[34]) + (h_RT[31] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54756,12 +51765,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[34];
-    k_f = prefactor_units[230] * fwd_A[230]
-                * exp(fwd_beta[230] * tc[0] - activation_units[230] * fwd_Ea[230] * invT);
+    k_f = k_f_s[230];
     dlnkfdT = fwd_beta[230] * invT + activation_units[230] * fwd_Ea[230] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[47];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[34] - g_RT[47]);
+    Kc = Kc_s[230];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[34]) + (h_RT[0] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54807,12 +51815,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[34];
-    k_f = prefactor_units[231] * fwd_A[231]
-                * exp(fwd_beta[231] * tc[0] - activation_units[231] * fwd_Ea[231] * invT);
+    k_f = k_f_s[231];
     dlnkfdT = fwd_beta[231] * invT + activation_units[231] * fwd_Ea[231] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[47];
-    Kc = exp(g_RT[4] - g_RT[5] + g_RT[34] - g_RT[47]);
+    Kc = Kc_s[231];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[34]) + (h_RT[5] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54858,12 +51865,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[34];
-    k_f = prefactor_units[232] * fwd_A[232]
-                * exp(fwd_beta[232] * tc[0] - activation_units[232] * fwd_Ea[232] * invT);
+    k_f = k_f_s[232];
     dlnkfdT = fwd_beta[232] * invT + activation_units[232] * fwd_Ea[232] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[47];
-    Kc = exp(g_RT[12] - g_RT[13] + g_RT[34] - g_RT[47]);
+    Kc = Kc_s[232];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[34]) + (h_RT[13] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54909,12 +51915,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[38];
-    k_f = prefactor_units[233] * fwd_A[233]
-                * exp(fwd_beta[233] * tc[0] - activation_units[233] * fwd_Ea[233] * invT);
+    k_f = k_f_s[233];
     dlnkfdT = fwd_beta[233] * invT + activation_units[233] * fwd_Ea[233] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[35];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[35] + g_RT[38]);
+    Kc = Kc_s[233];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[38]) + (h_RT[4] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54960,12 +51965,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[38];
-    k_f = prefactor_units[234] * fwd_A[234]
-                * exp(fwd_beta[234] * tc[0] - activation_units[234] * fwd_Ea[234] * invT);
+    k_f = k_f_s[234];
     dlnkfdT = fwd_beta[234] * invT + activation_units[234] * fwd_Ea[234] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[35];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[35] + g_RT[38]);
+    Kc = Kc_s[234];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[38]) + (h_RT[0] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55011,12 +52015,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[38];
-    k_f = prefactor_units[235] * fwd_A[235]
-                * exp(fwd_beta[235] * tc[0] - activation_units[235] * fwd_Ea[235] * invT);
+    k_f = k_f_s[235];
     dlnkfdT = fwd_beta[235] * invT + activation_units[235] * fwd_Ea[235] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[35];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[35] + g_RT[38]);
+    Kc = Kc_s[235];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[38]) + (h_RT[5] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55062,12 +52065,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[38];
-    k_f = prefactor_units[236] * fwd_A[236]
-                * exp(fwd_beta[236] * tc[0] - activation_units[236] * fwd_Ea[236] * invT);
+    k_f = k_f_s[236];
     dlnkfdT = fwd_beta[236] * invT + activation_units[236] * fwd_Ea[236] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[35];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[35] + g_RT[38]);
+    Kc = Kc_s[236];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[38]) + (h_RT[6] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55113,12 +52115,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[39];
-    k_f = prefactor_units[237] * fwd_A[237]
-                * exp(fwd_beta[237] * tc[0] - activation_units[237] * fwd_Ea[237] * invT);
+    k_f = k_f_s[237];
     dlnkfdT = fwd_beta[237] * invT + activation_units[237] * fwd_Ea[237] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[30];
-    Kc = exp(g_RT[2] - g_RT[14] - g_RT[30] + g_RT[39]);
+    Kc = Kc_s[237];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[39]) + (h_RT[14] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55164,12 +52165,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[39];
-    k_f = prefactor_units[238] * fwd_A[238]
-                * exp(fwd_beta[238] * tc[0] - activation_units[238] * fwd_Ea[238] * invT);
+    k_f = k_f_s[238];
     dlnkfdT = fwd_beta[238] * invT + activation_units[238] * fwd_Ea[238] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[46];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[39] - g_RT[46]);
+    Kc = Kc_s[238];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[39]) + (h_RT[1] + h_RT[46]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55215,12 +52215,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[39];
-    k_f = prefactor_units[239] * fwd_A[239]
-                * exp(fwd_beta[239] * tc[0] - activation_units[239] * fwd_Ea[239] * invT);
+    k_f = k_f_s[239];
     dlnkfdT = fwd_beta[239] * invT + activation_units[239] * fwd_Ea[239] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[40];
-    Kc = exp(-g_RT[4] + g_RT[5] + g_RT[39] - g_RT[40]);
+    Kc = Kc_s[239];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[39]) + (h_RT[4] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55266,12 +52265,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[39];
-    k_f = prefactor_units[240] * fwd_A[240]
-                * exp(fwd_beta[240] * tc[0] - activation_units[240] * fwd_Ea[240] * invT);
+    k_f = k_f_s[240];
     dlnkfdT = fwd_beta[240] * invT + activation_units[240] * fwd_Ea[240] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[46];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[39] - g_RT[46]);
+    Kc = Kc_s[240];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[39]) + (h_RT[2] + h_RT[46]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55317,12 +52315,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[39];
-    k_f = prefactor_units[241] * fwd_A[241]
-                * exp(fwd_beta[241] * tc[0] - activation_units[241] * fwd_Ea[241] * invT);
+    k_f = k_f_s[241];
     dlnkfdT = fwd_beta[241] * invT + activation_units[241] * fwd_Ea[241] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[40];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[39] - g_RT[40]);
+    Kc = Kc_s[241];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[39]) + (h_RT[1] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55368,12 +52365,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[46];
-    k_f = prefactor_units[242] * fwd_A[242]
-                * exp(fwd_beta[242] * tc[0] - activation_units[242] * fwd_Ea[242] * invT);
+    k_f = k_f_s[242];
     dlnkfdT = fwd_beta[242] * invT + activation_units[242] * fwd_Ea[242] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[35];
-    Kc = exp(g_RT[2] - g_RT[14] - g_RT[35] + g_RT[46]);
+    Kc = Kc_s[242];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[46]) + (h_RT[14] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55419,12 +52415,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[46];
-    k_f = prefactor_units[243] * fwd_A[243]
-                * exp(fwd_beta[243] * tc[0] - activation_units[243] * fwd_Ea[243] * invT);
+    k_f = k_f_s[243];
     dlnkfdT = fwd_beta[243] * invT + activation_units[243] * fwd_Ea[243] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[31];
-    Kc = exp(g_RT[1] - g_RT[14] - g_RT[31] + g_RT[46]);
+    Kc = Kc_s[243];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[46]) + (h_RT[14] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55470,12 +52465,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[46];
-    k_f = prefactor_units[244] * fwd_A[244]
-                * exp(fwd_beta[244] * tc[0] - activation_units[244] * fwd_Ea[244] * invT);
+    k_f = k_f_s[244];
     dlnkfdT = fwd_beta[244] * invT + activation_units[244] * fwd_Ea[244] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14]*sc[35];
-    Kc = refC * exp(-g_RT[1] + g_RT[4] - g_RT[14] - g_RT[35] + g_RT[46]);
+    Kc = Kc_s[244];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[46]) + (h_RT[1] + h_RT[14] + h_RT[35]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55534,12 +52528,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[30]*sc[46];
-    k_f = prefactor_units[245] * fwd_A[245]
-                * exp(fwd_beta[245] * tc[0] - activation_units[245] * fwd_Ea[245] * invT);
+    k_f = k_f_s[245];
     dlnkfdT = fwd_beta[245] * invT + activation_units[245] * fwd_Ea[245] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[47];
-    Kc = exp(-g_RT[14] + g_RT[30] + g_RT[46] - g_RT[47]);
+    Kc = Kc_s[245];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[30] + h_RT[46]) + (h_RT[14] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55585,12 +52578,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[46];
-    k_f = prefactor_units[246] * fwd_A[246]
-                * exp(fwd_beta[246] * tc[0] - activation_units[246] * fwd_Ea[246] * invT);
+    k_f = k_f_s[246];
     dlnkfdT = fwd_beta[246] * invT + activation_units[246] * fwd_Ea[246] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[35];
-    Kc = exp(g_RT[3] - g_RT[15] - g_RT[35] + g_RT[46]);
+    Kc = Kc_s[246];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[46]) + (h_RT[15] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55636,12 +52628,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[35]*sc[46];
-    k_f = prefactor_units[247] * fwd_A[247]
-                * exp(fwd_beta[247] * tc[0] - activation_units[247] * fwd_Ea[247] * invT);
+    k_f = k_f_s[247];
     dlnkfdT = fwd_beta[247] * invT + activation_units[247] * fwd_Ea[247] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[37];
-    Kc = exp(-g_RT[14] + g_RT[35] - g_RT[37] + g_RT[46]);
+    Kc = Kc_s[247];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[35] + h_RT[46]) + (h_RT[14] + h_RT[37]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55687,12 +52678,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[35]*sc[46];
-    k_f = prefactor_units[248] * fwd_A[248]
-                * exp(fwd_beta[248] * tc[0] - activation_units[248] * fwd_Ea[248] * invT);
+    k_f = k_f_s[248];
     dlnkfdT = fwd_beta[248] * invT + activation_units[248] * fwd_Ea[248] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[47];
-    Kc = exp(-g_RT[15] + g_RT[35] + g_RT[46] - g_RT[47]);
+    Kc = Kc_s[248];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[35] + h_RT[46]) + (h_RT[15] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55738,12 +52728,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[40];
-    k_f = prefactor_units[249] * fwd_A[249]
-                * exp(fwd_beta[249] * tc[0] - activation_units[249] * fwd_Ea[249] * invT);
+    k_f = k_f_s[249];
     dlnkfdT = fwd_beta[249] * invT + activation_units[249] * fwd_Ea[249] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[46];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[40] - g_RT[46]);
+    Kc = Kc_s[249];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[40]) + (h_RT[1] + h_RT[46]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55789,12 +52778,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[40];
-    k_f = prefactor_units[250] * fwd_A[250]
-                * exp(fwd_beta[250] * tc[0] - activation_units[250] * fwd_Ea[250] * invT);
+    k_f = k_f_s[250];
     dlnkfdT = fwd_beta[250] * invT + activation_units[250] * fwd_Ea[250] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[31];
-    Kc = exp(g_RT[2] - g_RT[14] - g_RT[31] + g_RT[40]);
+    Kc = Kc_s[250];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[40]) + (h_RT[14] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55840,12 +52828,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[40];
-    k_f = prefactor_units[251] * fwd_A[251]
-                * exp(fwd_beta[251] * tc[0] - activation_units[251] * fwd_Ea[251] * invT);
+    k_f = k_f_s[251];
     dlnkfdT = fwd_beta[251] * invT + activation_units[251] * fwd_Ea[251] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[39];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[39] + g_RT[40]);
+    Kc = Kc_s[251];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[40]) + (h_RT[4] + h_RT[39]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55891,12 +52878,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[40];
-    k_f = prefactor_units[252] * fwd_A[252]
-                * exp(fwd_beta[252] * tc[0] - activation_units[252] * fwd_Ea[252] * invT);
+    k_f = k_f_s[252];
     dlnkfdT = fwd_beta[252] * invT + activation_units[252] * fwd_Ea[252] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[44];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[40] - g_RT[44]);
+    Kc = Kc_s[252];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[40]) + (h_RT[1] + h_RT[44]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55942,12 +52928,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[40];
-    k_f = prefactor_units[253] * fwd_A[253]
-                * exp(fwd_beta[253] * tc[0] - activation_units[253] * fwd_Ea[253] * invT);
+    k_f = k_f_s[253];
     dlnkfdT = fwd_beta[253] * invT + activation_units[253] * fwd_Ea[253] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[45];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[40] - g_RT[45]);
+    Kc = Kc_s[253];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[40]) + (h_RT[1] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55993,12 +52978,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[40];
-    k_f = prefactor_units[254] * fwd_A[254]
-                * exp(fwd_beta[254] * tc[0] - activation_units[254] * fwd_Ea[254] * invT);
+    k_f = k_f_s[254];
     dlnkfdT = fwd_beta[254] * invT + activation_units[254] * fwd_Ea[254] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[32];
-    Kc = exp(g_RT[4] - g_RT[14] - g_RT[32] + g_RT[40]);
+    Kc = Kc_s[254];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[40]) + (h_RT[14] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56044,12 +53028,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[30]*sc[41];
-    k_f = prefactor_units[255] * fwd_A[255]
-                * exp(fwd_beta[255] * tc[0] - activation_units[255] * fwd_Ea[255] * invT);
+    k_f = k_f_s[255];
     dlnkfdT = fwd_beta[255] * invT + activation_units[255] * fwd_Ea[255] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[47];
-    Kc = exp(-g_RT[10] + g_RT[30] + g_RT[41] - g_RT[47]);
+    Kc = Kc_s[255];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[30] + h_RT[41]) + (h_RT[10] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56095,12 +53078,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[47];
-    k_f = prefactor_units[256] * fwd_A[256]
-                * exp(fwd_beta[256] * tc[0] - activation_units[256] * fwd_Ea[256] * invT);
+    k_f = k_f_s[256];
     dlnkfdT = fwd_beta[256] * invT + activation_units[256] * fwd_Ea[256] * invT2;
     /* reverse */
     phi_r = sc[30]*sc[39];
-    Kc = exp(g_RT[8] - g_RT[30] - g_RT[39] + g_RT[47]);
+    Kc = Kc_s[256];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[47]) + (h_RT[30] + h_RT[39]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56146,12 +53128,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[47];
-    k_f = prefactor_units[257] * fwd_A[257]
-                * exp(fwd_beta[257] * tc[0] - activation_units[257] * fwd_Ea[257] * invT);
+    k_f = k_f_s[257];
     dlnkfdT = fwd_beta[257] * invT + activation_units[257] * fwd_Ea[257] * invT2;
     /* reverse */
     phi_r = sc[30]*sc[40];
-    Kc = exp(g_RT[9] - g_RT[30] - g_RT[40] + g_RT[47]);
+    Kc = Kc_s[257];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[47]) + (h_RT[30] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56197,12 +53178,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[47];
-    k_f = prefactor_units[258] * fwd_A[258]
-                * exp(fwd_beta[258] * tc[0] - activation_units[258] * fwd_Ea[258] * invT);
+    k_f = k_f_s[258];
     dlnkfdT = fwd_beta[258] * invT + activation_units[258] * fwd_Ea[258] * invT2;
     /* reverse */
     phi_r = sc[31]*sc[40];
-    Kc = exp(g_RT[10] - g_RT[31] - g_RT[40] + g_RT[47]);
+    Kc = Kc_s[258];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[47]) + (h_RT[31] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56248,12 +53228,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[47];
-    k_f = prefactor_units[259] * fwd_A[259]
-                * exp(fwd_beta[259] * tc[0] - activation_units[259] * fwd_Ea[259] * invT);
+    k_f = k_f_s[259];
     dlnkfdT = fwd_beta[259] * invT + activation_units[259] * fwd_Ea[259] * invT2;
     /* reverse */
     phi_r = sc[31]*sc[40];
-    Kc = exp(g_RT[11] - g_RT[31] - g_RT[40] + g_RT[47]);
+    Kc = Kc_s[259];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[47]) + (h_RT[31] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56299,12 +53278,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[35];
-    k_f = prefactor_units[260] * fwd_A[260]
-                * exp(fwd_beta[260] * tc[0] - activation_units[260] * fwd_Ea[260] * invT);
+    k_f = k_f_s[260];
     dlnkfdT = fwd_beta[260] * invT + activation_units[260] * fwd_Ea[260] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[39];
-    Kc = exp(-g_RT[2] + g_RT[8] + g_RT[35] - g_RT[39]);
+    Kc = Kc_s[260];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[35]) + (h_RT[2] + h_RT[39]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56350,12 +53328,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[35];
-    k_f = prefactor_units[261] * fwd_A[261]
-                * exp(fwd_beta[261] * tc[0] - activation_units[261] * fwd_Ea[261] * invT);
+    k_f = k_f_s[261];
     dlnkfdT = fwd_beta[261] * invT + activation_units[261] * fwd_Ea[261] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[30];
-    Kc = exp(g_RT[8] - g_RT[14] - g_RT[30] + g_RT[35]);
+    Kc = Kc_s[261];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[35]) + (h_RT[14] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56401,12 +53378,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[35];
-    k_f = prefactor_units[262] * fwd_A[262]
-                * exp(fwd_beta[262] * tc[0] - activation_units[262] * fwd_Ea[262] * invT);
+    k_f = k_f_s[262];
     dlnkfdT = fwd_beta[262] * invT + activation_units[262] * fwd_Ea[262] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[40];
-    Kc = exp(-g_RT[2] + g_RT[9] + g_RT[35] - g_RT[40]);
+    Kc = Kc_s[262];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[35]) + (h_RT[2] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56452,12 +53428,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[35];
-    k_f = prefactor_units[263] * fwd_A[263]
-                * exp(fwd_beta[263] * tc[0] - activation_units[263] * fwd_Ea[263] * invT);
+    k_f = k_f_s[263];
     dlnkfdT = fwd_beta[263] * invT + activation_units[263] * fwd_Ea[263] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[46];
-    Kc = exp(-g_RT[1] + g_RT[9] + g_RT[35] - g_RT[46]);
+    Kc = Kc_s[263];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[35]) + (h_RT[1] + h_RT[46]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56503,12 +53478,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[35];
-    k_f = prefactor_units[264] * fwd_A[264]
-                * exp(fwd_beta[264] * tc[0] - activation_units[264] * fwd_Ea[264] * invT);
+    k_f = k_f_s[264];
     dlnkfdT = fwd_beta[264] * invT + activation_units[264] * fwd_Ea[264] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[30];
-    Kc = exp(g_RT[9] - g_RT[16] - g_RT[30] + g_RT[35]);
+    Kc = Kc_s[264];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[35]) + (h_RT[16] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56554,12 +53528,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[35];
-    k_f = prefactor_units[265] * fwd_A[265]
-                * exp(fwd_beta[265] * tc[0] - activation_units[265] * fwd_Ea[265] * invT);
+    k_f = k_f_s[265];
     dlnkfdT = fwd_beta[265] * invT + activation_units[265] * fwd_Ea[265] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[45];
-    Kc = exp(-g_RT[1] + g_RT[10] + g_RT[35] - g_RT[45]);
+    Kc = Kc_s[265];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[35]) + (h_RT[1] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56605,12 +53578,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[35];
-    k_f = prefactor_units[266] * fwd_A[266]
-                * exp(fwd_beta[266] * tc[0] - activation_units[266] * fwd_Ea[266] * invT);
+    k_f = k_f_s[266];
     dlnkfdT = fwd_beta[266] * invT + activation_units[266] * fwd_Ea[266] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[40];
-    Kc = exp(-g_RT[4] + g_RT[10] + g_RT[35] - g_RT[40]);
+    Kc = Kc_s[266];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[35]) + (h_RT[4] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56656,12 +53628,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[35];
-    k_f = prefactor_units[267] * fwd_A[267]
-                * exp(fwd_beta[267] * tc[0] - activation_units[267] * fwd_Ea[267] * invT);
+    k_f = k_f_s[267];
     dlnkfdT = fwd_beta[267] * invT + activation_units[267] * fwd_Ea[267] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[43];
-    Kc = exp(-g_RT[1] + g_RT[10] + g_RT[35] - g_RT[43]);
+    Kc = Kc_s[267];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[35]) + (h_RT[1] + h_RT[43]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56707,12 +53678,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[35];
-    k_f = prefactor_units[268] * fwd_A[268]
-                * exp(fwd_beta[268] * tc[0] - activation_units[268] * fwd_Ea[268] * invT);
+    k_f = k_f_s[268];
     dlnkfdT = fwd_beta[268] * invT + activation_units[268] * fwd_Ea[268] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[45];
-    Kc = exp(-g_RT[1] + g_RT[11] + g_RT[35] - g_RT[45]);
+    Kc = Kc_s[268];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[35]) + (h_RT[1] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56758,12 +53728,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[35];
-    k_f = prefactor_units[269] * fwd_A[269]
-                * exp(fwd_beta[269] * tc[0] - activation_units[269] * fwd_Ea[269] * invT);
+    k_f = k_f_s[269];
     dlnkfdT = fwd_beta[269] * invT + activation_units[269] * fwd_Ea[269] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[40];
-    Kc = exp(-g_RT[4] + g_RT[11] + g_RT[35] - g_RT[40]);
+    Kc = Kc_s[269];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[35]) + (h_RT[4] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56809,12 +53778,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[35];
-    k_f = prefactor_units[270] * fwd_A[270]
-                * exp(fwd_beta[270] * tc[0] - activation_units[270] * fwd_Ea[270] * invT);
+    k_f = k_f_s[270];
     dlnkfdT = fwd_beta[270] * invT + activation_units[270] * fwd_Ea[270] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[43];
-    Kc = exp(-g_RT[1] + g_RT[11] + g_RT[35] - g_RT[43]);
+    Kc = Kc_s[270];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[35]) + (h_RT[1] + h_RT[43]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56860,12 +53828,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[35];
-    k_f = prefactor_units[271] * fwd_A[271]
-                * exp(fwd_beta[271] * tc[0] - activation_units[271] * fwd_Ea[271] * invT);
+    k_f = k_f_s[271];
     dlnkfdT = fwd_beta[271] * invT + activation_units[271] * fwd_Ea[271] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[40];
-    Kc = exp(-g_RT[5] + g_RT[12] + g_RT[35] - g_RT[40]);
+    Kc = Kc_s[271];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[35]) + (h_RT[5] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56911,12 +53878,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[35];
-    k_f = prefactor_units[272] * fwd_A[272]
-                * exp(fwd_beta[272] * tc[0] - activation_units[272] * fwd_Ea[272] * invT);
+    k_f = k_f_s[272];
     dlnkfdT = fwd_beta[272] * invT + activation_units[272] * fwd_Ea[272] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[41];
-    Kc = exp(-g_RT[4] + g_RT[12] + g_RT[35] - g_RT[41]);
+    Kc = Kc_s[272];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[35]) + (h_RT[4] + h_RT[41]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56962,12 +53928,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[42];
-    k_f = prefactor_units[273] * fwd_A[273]
-                * exp(fwd_beta[273] * tc[0] - activation_units[273] * fwd_Ea[273] * invT);
+    k_f = k_f_s[273];
     dlnkfdT = fwd_beta[273] * invT + activation_units[273] * fwd_Ea[273] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14]*sc[47];
-    Kc = refC * exp(-g_RT[1] + g_RT[2] - g_RT[14] + g_RT[42] - g_RT[47]);
+    Kc = Kc_s[273];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[42]) + (h_RT[1] + h_RT[14] + h_RT[47]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57026,12 +53991,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[42];
-    k_f = prefactor_units[274] * fwd_A[274]
-                * exp(fwd_beta[274] * tc[0] - activation_units[274] * fwd_Ea[274] * invT);
+    k_f = k_f_s[274];
     dlnkfdT = fwd_beta[274] * invT + activation_units[274] * fwd_Ea[274] * invT2;
     /* reverse */
     phi_r = sc[35]*sc[40];
-    Kc = exp(g_RT[2] - g_RT[35] - g_RT[40] + g_RT[42]);
+    Kc = Kc_s[274];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[42]) + (h_RT[35] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57077,12 +54041,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[42];
-    k_f = prefactor_units[275] * fwd_A[275]
-                * exp(fwd_beta[275] * tc[0] - activation_units[275] * fwd_Ea[275] * invT);
+    k_f = k_f_s[275];
     dlnkfdT = fwd_beta[275] * invT + activation_units[275] * fwd_Ea[275] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[16]*sc[47];
-    Kc = refC * exp(-g_RT[2] + g_RT[3] - g_RT[16] + g_RT[42] - g_RT[47]);
+    Kc = Kc_s[275];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[42]) + (h_RT[2] + h_RT[16] + h_RT[47]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57141,12 +54104,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[42];
-    k_f = prefactor_units[276] * fwd_A[276]
-                * exp(fwd_beta[276] * tc[0] - activation_units[276] * fwd_Ea[276] * invT);
+    k_f = k_f_s[276];
     dlnkfdT = fwd_beta[276] * invT + activation_units[276] * fwd_Ea[276] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[16]*sc[47];
-    Kc = refC * exp(-g_RT[1] + g_RT[4] - g_RT[16] + g_RT[42] - g_RT[47]);
+    Kc = Kc_s[276];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[42]) + (h_RT[1] + h_RT[16] + h_RT[47]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57205,12 +54167,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[42];
-    k_f = prefactor_units[277] * fwd_A[277]
-                * exp(fwd_beta[277] * tc[0] - activation_units[277] * fwd_Ea[277] * invT);
+    k_f = k_f_s[277];
     dlnkfdT = fwd_beta[277] * invT + activation_units[277] * fwd_Ea[277] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[47];
-    Kc = exp(g_RT[1] - g_RT[10] + g_RT[42] - g_RT[47]);
+    Kc = Kc_s[277];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[42]) + (h_RT[10] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57256,12 +54217,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[45];
-    k_f = prefactor_units[278] * fwd_A[278]
-                * exp(fwd_beta[278] * tc[0] - activation_units[278] * fwd_Ea[278] * invT);
+    k_f = k_f_s[278];
     dlnkfdT = fwd_beta[278] * invT + activation_units[278] * fwd_Ea[278] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[31];
-    Kc = exp(g_RT[2] - g_RT[15] - g_RT[31] + g_RT[45]);
+    Kc = Kc_s[278];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[45]) + (h_RT[15] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57307,12 +54267,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[45];
-    k_f = prefactor_units[279] * fwd_A[279]
-                * exp(fwd_beta[279] * tc[0] - activation_units[279] * fwd_Ea[279] * invT);
+    k_f = k_f_s[279];
     dlnkfdT = fwd_beta[279] * invT + activation_units[279] * fwd_Ea[279] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[38];
-    Kc = exp(g_RT[2] - g_RT[14] - g_RT[38] + g_RT[45]);
+    Kc = Kc_s[279];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[45]) + (h_RT[14] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57358,12 +54317,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[45];
-    k_f = prefactor_units[280] * fwd_A[280]
-                * exp(fwd_beta[280] * tc[0] - activation_units[280] * fwd_Ea[280] * invT);
+    k_f = k_f_s[280];
     dlnkfdT = fwd_beta[280] * invT + activation_units[280] * fwd_Ea[280] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[46];
-    Kc = exp(g_RT[2] - g_RT[4] + g_RT[45] - g_RT[46]);
+    Kc = Kc_s[280];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[45]) + (h_RT[4] + h_RT[46]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57409,12 +54367,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[45];
-    k_f = prefactor_units[281] * fwd_A[281]
-                * exp(fwd_beta[281] * tc[0] - activation_units[281] * fwd_Ea[281] * invT);
+    k_f = k_f_s[281];
     dlnkfdT = fwd_beta[281] * invT + activation_units[281] * fwd_Ea[281] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[32];
-    Kc = exp(g_RT[1] - g_RT[14] - g_RT[32] + g_RT[45]);
+    Kc = Kc_s[281];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[45]) + (h_RT[14] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57460,12 +54417,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[45];
-    k_f = prefactor_units[282] * fwd_A[282]
-                * exp(fwd_beta[282] * tc[0] - activation_units[282] * fwd_Ea[282] * invT);
+    k_f = k_f_s[282];
     dlnkfdT = fwd_beta[282] * invT + activation_units[282] * fwd_Ea[282] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[46];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[45] - g_RT[46]);
+    Kc = Kc_s[282];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[45]) + (h_RT[0] + h_RT[46]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57511,12 +54467,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[45];
-    k_f = prefactor_units[283] * fwd_A[283]
-                * exp(fwd_beta[283] * tc[0] - activation_units[283] * fwd_Ea[283] * invT);
+    k_f = k_f_s[283];
     dlnkfdT = fwd_beta[283] * invT + activation_units[283] * fwd_Ea[283] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[46];
-    Kc = exp(g_RT[4] - g_RT[5] + g_RT[45] - g_RT[46]);
+    Kc = Kc_s[283];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[45]) + (h_RT[5] + h_RT[46]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57562,12 +54517,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[45];
-    k_f = prefactor_units[284] * fwd_A[284]
-                * exp(fwd_beta[284] * tc[0] - activation_units[284] * fwd_Ea[284] * invT);
+    k_f = k_f_s[284];
     dlnkfdT = fwd_beta[284] * invT + activation_units[284] * fwd_Ea[284] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[32];
-    Kc = exp(g_RT[4] - g_RT[15] - g_RT[32] + g_RT[45]);
+    Kc = Kc_s[284];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[45]) + (h_RT[15] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57613,12 +54567,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[43];
-    k_f = prefactor_units[285] * fwd_A[285]
-                * exp(fwd_beta[285] * tc[0] - activation_units[285] * fwd_Ea[285] * invT);
+    k_f = k_f_s[285];
     dlnkfdT = fwd_beta[285] * invT + activation_units[285] * fwd_Ea[285] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[45];
-    Kc = exp(g_RT[1] - g_RT[1] + g_RT[43] - g_RT[45]);
+    Kc = Kc_s[285];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[43]) + (h_RT[1] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57648,12 +54601,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[43];
-    k_f = prefactor_units[286] * fwd_A[286]
-                * exp(fwd_beta[286] * tc[0] - activation_units[286] * fwd_Ea[286] * invT);
+    k_f = k_f_s[286];
     dlnkfdT = fwd_beta[286] * invT + activation_units[286] * fwd_Ea[286] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[40];
-    Kc = exp(g_RT[1] - g_RT[4] - g_RT[40] + g_RT[43]);
+    Kc = Kc_s[286];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[43]) + (h_RT[4] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57699,12 +54651,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[43];
-    k_f = prefactor_units[287] * fwd_A[287]
-                * exp(fwd_beta[287] * tc[0] - activation_units[287] * fwd_Ea[287] * invT);
+    k_f = k_f_s[287];
     dlnkfdT = fwd_beta[287] * invT + activation_units[287] * fwd_Ea[287] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[32];
-    Kc = exp(g_RT[1] - g_RT[14] - g_RT[32] + g_RT[43]);
+    Kc = Kc_s[287];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[43]) + (h_RT[14] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57750,12 +54701,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[44];
-    k_f = prefactor_units[288] * fwd_A[288]
-                * exp(fwd_beta[288] * tc[0] - activation_units[288] * fwd_Ea[288] * invT);
+    k_f = k_f_s[288];
     dlnkfdT = fwd_beta[288] * invT + activation_units[288] * fwd_Ea[288] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[45];
-    Kc = exp(g_RT[1] - g_RT[1] + g_RT[44] - g_RT[45]);
+    Kc = Kc_s[288];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[44]) + (h_RT[1] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57785,12 +54735,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[27]*sc[35];
-    k_f = prefactor_units[289] * fwd_A[289]
-                * exp(fwd_beta[289] * tc[0] - activation_units[289] * fwd_Ea[289] * invT);
+    k_f = k_f_s[289];
     dlnkfdT = fwd_beta[289] * invT + activation_units[289] * fwd_Ea[289] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[43];
-    Kc = exp(-g_RT[14] + g_RT[27] + g_RT[35] - g_RT[43]);
+    Kc = Kc_s[289];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[27] + h_RT[35]) + (h_RT[14] + h_RT[43]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57836,12 +54785,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[30];
-    k_f = prefactor_units[290] * fwd_A[290]
-                * exp(fwd_beta[290] * tc[0] - activation_units[290] * fwd_Ea[290] * invT);
+    k_f = k_f_s[290];
     dlnkfdT = fwd_beta[290] * invT + activation_units[290] * fwd_Ea[290] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[41];
-    Kc = exp(-g_RT[1] + g_RT[12] + g_RT[30] - g_RT[41]);
+    Kc = Kc_s[290];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[30]) + (h_RT[1] + h_RT[41]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57887,12 +54835,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[30];
-    k_f = prefactor_units[291] * fwd_A[291]
-                * exp(fwd_beta[291] * tc[0] - activation_units[291] * fwd_Ea[291] * invT);
+    k_f = k_f_s[291];
     dlnkfdT = fwd_beta[291] * invT + activation_units[291] * fwd_Ea[291] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[40];
-    Kc = exp(-g_RT[0] + g_RT[12] + g_RT[30] - g_RT[40]);
+    Kc = Kc_s[291];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[30]) + (h_RT[0] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57938,12 +54885,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[33];
-    k_f = prefactor_units[292] * fwd_A[292]
-                * exp(fwd_beta[292] * tc[0] - activation_units[292] * fwd_Ea[292] * invT);
+    k_f = k_f_s[292];
     dlnkfdT = fwd_beta[292] * invT + activation_units[292] * fwd_Ea[292] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[32];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[32] + g_RT[33]);
+    Kc = Kc_s[292];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[33]) + (h_RT[0] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57989,12 +54935,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[33];
-    k_f = prefactor_units[293] * fwd_A[293]
-                * exp(fwd_beta[293] * tc[0] - activation_units[293] * fwd_Ea[293] * invT);
+    k_f = k_f_s[293];
     dlnkfdT = fwd_beta[293] * invT + activation_units[293] * fwd_Ea[293] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[32];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[32] + g_RT[33]);
+    Kc = Kc_s[293];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[33]) + (h_RT[5] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58040,12 +54985,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[33];
-    k_f = prefactor_units[294] * fwd_A[294]
-                * exp(fwd_beta[294] * tc[0] - activation_units[294] * fwd_Ea[294] * invT);
+    k_f = k_f_s[294];
     dlnkfdT = fwd_beta[294] * invT + activation_units[294] * fwd_Ea[294] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[32];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[32] + g_RT[33]);
+    Kc = Kc_s[294];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[33]) + (h_RT[4] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58091,12 +55035,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[15]*sc[31];
-    k_f = prefactor_units[295] * fwd_A[295]
-                * exp(fwd_beta[295] * tc[0] - activation_units[295] * fwd_Ea[295] * invT);
+    k_f = k_f_s[295];
     dlnkfdT = fwd_beta[295] * invT + activation_units[295] * fwd_Ea[295] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[38];
-    Kc = exp(-g_RT[14] + g_RT[15] + g_RT[31] - g_RT[38]);
+    Kc = Kc_s[295];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[15] + h_RT[31]) + (h_RT[14] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58142,12 +55085,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[36]*sc[39];
-    k_f = prefactor_units[296] * fwd_A[296]
-                * exp(fwd_beta[296] * tc[0] - activation_units[296] * fwd_Ea[296] * invT);
+    k_f = k_f_s[296];
     dlnkfdT = fwd_beta[296] * invT + activation_units[296] * fwd_Ea[296] * invT2;
     /* reverse */
     phi_r = sc[35]*sc[46];
-    Kc = exp(-g_RT[35] + g_RT[36] + g_RT[39] - g_RT[46]);
+    Kc = Kc_s[296];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[36] + h_RT[39]) + (h_RT[35] + h_RT[46]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58193,12 +55135,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[36]*sc[46];
-    k_f = prefactor_units[297] * fwd_A[297]
-                * exp(fwd_beta[297] * tc[0] - activation_units[297] * fwd_Ea[297] * invT);
+    k_f = k_f_s[297];
     dlnkfdT = fwd_beta[297] * invT + activation_units[297] * fwd_Ea[297] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[37];
-    Kc = exp(-g_RT[15] + g_RT[36] - g_RT[37] + g_RT[46]);
+    Kc = Kc_s[297];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[36] + h_RT[46]) + (h_RT[15] + h_RT[37]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58244,12 +55185,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[15]*sc[30];
-    k_f = prefactor_units[298] * fwd_A[298]
-                * exp(fwd_beta[298] * tc[0] - activation_units[298] * fwd_Ea[298] * invT);
+    k_f = k_f_s[298];
     dlnkfdT = fwd_beta[298] * invT + activation_units[298] * fwd_Ea[298] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[35];
-    Kc = exp(-g_RT[14] + g_RT[15] + g_RT[30] - g_RT[35]);
+    Kc = Kc_s[298];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[15] + h_RT[30]) + (h_RT[14] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58295,8 +55235,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[12];
-    k_f = prefactor_units[299] * fwd_A[299]
-                * exp(fwd_beta[299] * tc[0] - activation_units[299] * fwd_Ea[299] * invT);
+    k_f = k_f_s[299];
     dlnkfdT = fwd_beta[299] * invT + activation_units[299] * fwd_Ea[299] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -58332,12 +55271,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[24];
-    k_f = prefactor_units[300] * fwd_A[300]
-                * exp(fwd_beta[300] * tc[0] - activation_units[300] * fwd_Ea[300] * invT);
+    k_f = k_f_s[300];
     dlnkfdT = fwd_beta[300] * invT + activation_units[300] * fwd_Ea[300] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[51];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[24] - g_RT[51]);
+    Kc = Kc_s[300];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[24]) + (h_RT[1] + h_RT[51]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58383,12 +55321,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[25];
-    k_f = prefactor_units[301] * fwd_A[301]
-                * exp(fwd_beta[301] * tc[0] - activation_units[301] * fwd_Ea[301] * invT);
+    k_f = k_f_s[301];
     dlnkfdT = fwd_beta[301] * invT + activation_units[301] * fwd_Ea[301] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[52];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[25] - g_RT[52]);
+    Kc = Kc_s[301];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[25]) + (h_RT[1] + h_RT[52]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58434,12 +55371,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[6];
-    k_f = prefactor_units[302] * fwd_A[302]
-                * exp(fwd_beta[302] * tc[0] - activation_units[302] * fwd_Ea[302] * invT);
+    k_f = k_f_s[302];
     dlnkfdT = fwd_beta[302] * invT + activation_units[302] * fwd_Ea[302] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[5];
-    Kc = exp(-g_RT[3] + g_RT[4] - g_RT[5] + g_RT[6]);
+    Kc = Kc_s[302];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[6]) + (h_RT[3] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58485,8 +55421,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[12];
-    k_f = prefactor_units[303] * fwd_A[303]
-                * exp(fwd_beta[303] * tc[0] - activation_units[303] * fwd_Ea[303] * invT);
+    k_f = k_f_s[303];
     dlnkfdT = fwd_beta[303] * invT + activation_units[303] * fwd_Ea[303] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -58518,8 +55453,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[10];
-    k_f = prefactor_units[304] * fwd_A[304]
-                * exp(fwd_beta[304] * tc[0] - activation_units[304] * fwd_Ea[304] * invT);
+    k_f = k_f_s[304];
     dlnkfdT = fwd_beta[304] * invT + activation_units[304] * fwd_Ea[304] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -58551,12 +55485,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[10];
-    k_f = prefactor_units[305] * fwd_A[305]
-                * exp(fwd_beta[305] * tc[0] - activation_units[305] * fwd_Ea[305] * invT);
+    k_f = k_f_s[305];
     dlnkfdT = fwd_beta[305] * invT + activation_units[305] * fwd_Ea[305] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[17];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[10] - g_RT[17]);
+    Kc = Kc_s[305];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[10]) + (h_RT[2] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58602,8 +55535,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[10];
-    k_f = prefactor_units[306] * fwd_A[306]
-                * exp(fwd_beta[306] * tc[0] - activation_units[306] * fwd_Ea[306] * invT);
+    k_f = k_f_s[306];
     dlnkfdT = fwd_beta[306] * invT + activation_units[306] * fwd_Ea[306] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -58626,8 +55558,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[11];
-    k_f = prefactor_units[307] * fwd_A[307]
-                * exp(fwd_beta[307] * tc[0] - activation_units[307] * fwd_Ea[307] * invT);
+    k_f = k_f_s[307];
     dlnkfdT = fwd_beta[307] * invT + activation_units[307] * fwd_Ea[307] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -58659,12 +55590,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[23];
-    k_f = prefactor_units[308] * fwd_A[308]
-                * exp(fwd_beta[308] * tc[0] - activation_units[308] * fwd_Ea[308] * invT);
+    k_f = k_f_s[308];
     dlnkfdT = fwd_beta[308] * invT + activation_units[308] * fwd_Ea[308] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[51];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[23] - g_RT[51]);
+    Kc = Kc_s[308];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[23]) + (h_RT[2] + h_RT[51]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58710,12 +55640,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[23];
-    k_f = prefactor_units[309] * fwd_A[309]
-                * exp(fwd_beta[309] * tc[0] - activation_units[309] * fwd_Ea[309] * invT);
+    k_f = k_f_s[309];
     dlnkfdT = fwd_beta[309] * invT + activation_units[309] * fwd_Ea[309] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[22];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[22] + g_RT[23]);
+    Kc = Kc_s[309];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[23]) + (h_RT[6] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58761,12 +55690,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[52];
-    k_f = prefactor_units[310] * fwd_A[310]
-                * exp(fwd_beta[310] * tc[0] - activation_units[310] * fwd_Ea[310] * invT);
+    k_f = k_f_s[310];
     dlnkfdT = fwd_beta[310] * invT + activation_units[310] * fwd_Ea[310] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[51];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[51] + g_RT[52]);
+    Kc = Kc_s[310];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[52]) + (h_RT[4] + h_RT[51]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58812,8 +55740,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[52];
-    k_f = prefactor_units[311] * fwd_A[311]
-                * exp(fwd_beta[311] * tc[0] - activation_units[311] * fwd_Ea[311] * invT);
+    k_f = k_f_s[311];
     dlnkfdT = fwd_beta[311] * invT + activation_units[311] * fwd_Ea[311] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -58849,8 +55776,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[52];
-    k_f = prefactor_units[312] * fwd_A[312]
-                * exp(fwd_beta[312] * tc[0] - activation_units[312] * fwd_Ea[312] * invT);
+    k_f = k_f_s[312];
     dlnkfdT = fwd_beta[312] * invT + activation_units[312] * fwd_Ea[312] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -58886,12 +55812,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[52];
-    k_f = prefactor_units[313] * fwd_A[313]
-                * exp(fwd_beta[313] * tc[0] - activation_units[313] * fwd_Ea[313] * invT);
+    k_f = k_f_s[313];
     dlnkfdT = fwd_beta[313] * invT + activation_units[313] * fwd_Ea[313] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[51];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[51] + g_RT[52]);
+    Kc = Kc_s[313];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[52]) + (h_RT[0] + h_RT[51]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58937,8 +55862,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[52];
-    k_f = prefactor_units[314] * fwd_A[314]
-                * exp(fwd_beta[314] * tc[0] - activation_units[314] * fwd_Ea[314] * invT);
+    k_f = k_f_s[314];
     dlnkfdT = fwd_beta[314] * invT + activation_units[314] * fwd_Ea[314] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -58974,8 +55898,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[52];
-    k_f = prefactor_units[315] * fwd_A[315]
-                * exp(fwd_beta[315] * tc[0] - activation_units[315] * fwd_Ea[315] * invT);
+    k_f = k_f_s[315];
     dlnkfdT = fwd_beta[315] * invT + activation_units[315] * fwd_Ea[315] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -59011,8 +55934,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[52];
-    k_f = prefactor_units[316] * fwd_A[316]
-                * exp(fwd_beta[316] * tc[0] - activation_units[316] * fwd_Ea[316] * invT);
+    k_f = k_f_s[316];
     dlnkfdT = fwd_beta[316] * invT + activation_units[316] * fwd_Ea[316] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -59048,8 +55970,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[52];
-    k_f = prefactor_units[317] * fwd_A[317]
-                * exp(fwd_beta[317] * tc[0] - activation_units[317] * fwd_Ea[317] * invT);
+    k_f = k_f_s[317];
     dlnkfdT = fwd_beta[317] * invT + activation_units[317] * fwd_Ea[317] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -59077,8 +55998,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[51];
-    k_f = prefactor_units[318] * fwd_A[318]
-                * exp(fwd_beta[318] * tc[0] - activation_units[318] * fwd_Ea[318] * invT);
+    k_f = k_f_s[318];
     dlnkfdT = fwd_beta[318] * invT + activation_units[318] * fwd_Ea[318] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -59114,8 +56034,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[51];
-    k_f = prefactor_units[319] * fwd_A[319]
-                * exp(fwd_beta[319] * tc[0] - activation_units[319] * fwd_Ea[319] * invT);
+    k_f = k_f_s[319];
     dlnkfdT = fwd_beta[319] * invT + activation_units[319] * fwd_Ea[319] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -59151,8 +56070,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[51];
-    k_f = prefactor_units[320] * fwd_A[320]
-                * exp(fwd_beta[320] * tc[0] - activation_units[320] * fwd_Ea[320] * invT);
+    k_f = k_f_s[320];
     dlnkfdT = fwd_beta[320] * invT + activation_units[320] * fwd_Ea[320] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -59184,12 +56102,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[51];
-    k_f = prefactor_units[321] * fwd_A[321]
-                * exp(fwd_beta[321] * tc[0] - activation_units[321] * fwd_Ea[321] * invT);
+    k_f = k_f_s[321];
     dlnkfdT = fwd_beta[321] * invT + activation_units[321] * fwd_Ea[321] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[16];
-    Kc = exp(g_RT[1] - g_RT[12] - g_RT[16] + g_RT[51]);
+    Kc = Kc_s[321];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[51]) + (h_RT[12] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59235,12 +56152,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[51];
-    k_f = prefactor_units[322] * fwd_A[322]
-                * exp(fwd_beta[322] * tc[0] - activation_units[322] * fwd_Ea[322] * invT);
+    k_f = k_f_s[322];
     dlnkfdT = fwd_beta[322] * invT + activation_units[322] * fwd_Ea[322] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[28];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[28] + g_RT[51]);
+    Kc = Kc_s[322];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[51]) + (h_RT[0] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59286,12 +56202,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[51];
-    k_f = prefactor_units[323] * fwd_A[323]
-                * exp(fwd_beta[323] * tc[0] - activation_units[323] * fwd_Ea[323] * invT);
+    k_f = k_f_s[323];
     dlnkfdT = fwd_beta[323] * invT + activation_units[323] * fwd_Ea[323] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[28];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[28] + g_RT[51]);
+    Kc = Kc_s[323];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[51]) + (h_RT[5] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59337,12 +56252,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[51];
-    k_f = prefactor_units[324] * fwd_A[324]
-                * exp(fwd_beta[324] * tc[0] - activation_units[324] * fwd_Ea[324] * invT);
+    k_f = k_f_s[324];
     dlnkfdT = fwd_beta[324] * invT + activation_units[324] * fwd_Ea[324] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[18];
-    Kc = exp(g_RT[4] - g_RT[16] - g_RT[18] + g_RT[51]);
+    Kc = Kc_s[324];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[51]) + (h_RT[16] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59388,12 +56302,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[50];
-    k_f = prefactor_units[325] * fwd_A[325]
-                * exp(fwd_beta[325] * tc[0] - activation_units[325] * fwd_Ea[325] * invT);
+    k_f = k_f_s[325];
     dlnkfdT = fwd_beta[325] * invT + activation_units[325] * fwd_Ea[325] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[49];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[49] + g_RT[50]);
+    Kc = Kc_s[325];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[50]) + (h_RT[4] + h_RT[49]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59439,12 +56352,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[50];
-    k_f = prefactor_units[326] * fwd_A[326]
-                * exp(fwd_beta[326] * tc[0] - activation_units[326] * fwd_Ea[326] * invT);
+    k_f = k_f_s[326];
     dlnkfdT = fwd_beta[326] * invT + activation_units[326] * fwd_Ea[326] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[49];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[49] + g_RT[50]);
+    Kc = Kc_s[326];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[50]) + (h_RT[0] + h_RT[49]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59490,12 +56402,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[50];
-    k_f = prefactor_units[327] * fwd_A[327]
-                * exp(fwd_beta[327] * tc[0] - activation_units[327] * fwd_Ea[327] * invT);
+    k_f = k_f_s[327];
     dlnkfdT = fwd_beta[327] * invT + activation_units[327] * fwd_Ea[327] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[49];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[49] + g_RT[50]);
+    Kc = Kc_s[327];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[50]) + (h_RT[5] + h_RT[49]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59541,12 +56452,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[49];
-    k_f = prefactor_units[328] * fwd_A[328]
-                * exp(fwd_beta[328] * tc[0] - activation_units[328] * fwd_Ea[328] * invT);
+    k_f = k_f_s[328];
     dlnkfdT = fwd_beta[328] * invT + activation_units[328] * fwd_Ea[328] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[50];
-    Kc = exp(-g_RT[6] + g_RT[7] + g_RT[49] - g_RT[50]);
+    Kc = Kc_s[328];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[49]) + (h_RT[6] + h_RT[50]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59592,12 +56502,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[50];
-    k_f = prefactor_units[329] * fwd_A[329]
-                * exp(fwd_beta[329] * tc[0] - activation_units[329] * fwd_Ea[329] * invT);
+    k_f = k_f_s[329];
     dlnkfdT = fwd_beta[329] * invT + activation_units[329] * fwd_Ea[329] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[49];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[49] + g_RT[50]);
+    Kc = Kc_s[329];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[50]) + (h_RT[13] + h_RT[49]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59643,12 +56552,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[49];
-    k_f = prefactor_units[330] * fwd_A[330]
-                * exp(fwd_beta[330] * tc[0] - activation_units[330] * fwd_Ea[330] * invT);
+    k_f = k_f_s[330];
     dlnkfdT = fwd_beta[330] * invT + activation_units[330] * fwd_Ea[330] * invT2;
     /* reverse */
     phi_r = sc[17]*sc[25];
-    Kc = exp(g_RT[2] - g_RT[17] - g_RT[25] + g_RT[49]);
+    Kc = Kc_s[330];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[49]) + (h_RT[17] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59694,12 +56602,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[49];
-    k_f = prefactor_units[331] * fwd_A[331]
-                * exp(fwd_beta[331] * tc[0] - activation_units[331] * fwd_Ea[331] * invT);
+    k_f = k_f_s[331];
     dlnkfdT = fwd_beta[331] * invT + activation_units[331] * fwd_Ea[331] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[25];
-    Kc = exp(g_RT[1] - g_RT[12] - g_RT[25] + g_RT[49]);
+    Kc = Kc_s[331];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[49]) + (h_RT[12] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59745,12 +56652,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[49];
-    k_f = prefactor_units[332] * fwd_A[332]
-                * exp(fwd_beta[332] * tc[0] - activation_units[332] * fwd_Ea[332] * invT);
+    k_f = k_f_s[332];
     dlnkfdT = fwd_beta[332] * invT + activation_units[332] * fwd_Ea[332] * invT2;
     /* reverse */
     phi_r = sc[18]*sc[25];
-    Kc = exp(g_RT[4] - g_RT[18] - g_RT[25] + g_RT[49]);
+    Kc = Kc_s[332];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[49]) + (h_RT[18] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59796,12 +56702,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[49];
-    k_f = prefactor_units[333] * fwd_A[333]
-                * exp(fwd_beta[333] * tc[0] - activation_units[333] * fwd_Ea[333] * invT);
+    k_f = k_f_s[333];
     dlnkfdT = fwd_beta[333] * invT + activation_units[333] * fwd_Ea[333] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[50];
-    Kc = exp(-g_RT[3] + g_RT[6] + g_RT[49] - g_RT[50]);
+    Kc = Kc_s[333];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[49]) + (h_RT[3] + h_RT[50]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59847,8 +56752,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[49];
-    k_f = prefactor_units[334] * fwd_A[334]
-                * exp(fwd_beta[334] * tc[0] - activation_units[334] * fwd_Ea[334] * invT);
+    k_f = k_f_s[334];
     dlnkfdT = fwd_beta[334] * invT + activation_units[334] * fwd_Ea[334] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -59884,12 +56788,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[49];
-    k_f = prefactor_units[335] * fwd_A[335]
-                * exp(fwd_beta[335] * tc[0] - activation_units[335] * fwd_Ea[335] * invT);
+    k_f = k_f_s[335];
     dlnkfdT = fwd_beta[335] * invT + activation_units[335] * fwd_Ea[335] * invT2;
     /* reverse */
     phi_r = sc[25]*sc[25];
-    Kc = exp(g_RT[12] - 2*g_RT[25] + g_RT[49]);
+    Kc = Kc_s[335];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[49]) + (2*h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59924,12 +56827,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[60];
-    k_f = prefactor_units[336] * fwd_A[336]
-                * exp(fwd_beta[336] * tc[0] - activation_units[336] * fwd_Ea[336] * invT);
+    k_f = k_f_s[336];
     dlnkfdT = fwd_beta[336] * invT + activation_units[336] * fwd_Ea[336] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[53];
-    Kc = exp(g_RT[1] - g_RT[11] - g_RT[53] + g_RT[60]);
+    Kc = Kc_s[336];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[60]) + (h_RT[11] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59975,12 +56877,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[60];
-    k_f = prefactor_units[337] * fwd_A[337]
-                * exp(fwd_beta[337] * tc[0] - activation_units[337] * fwd_Ea[337] * invT);
+    k_f = k_f_s[337];
     dlnkfdT = fwd_beta[337] * invT + activation_units[337] * fwd_Ea[337] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[63];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[60] - g_RT[63]);
+    Kc = Kc_s[337];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[60]) + (h_RT[0] + h_RT[63]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60026,12 +56927,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[58];
-    k_f = prefactor_units[338] * fwd_A[338]
-                * exp(fwd_beta[338] * tc[0] - activation_units[338] * fwd_Ea[338] * invT);
+    k_f = k_f_s[338];
     dlnkfdT = fwd_beta[338] * invT + activation_units[338] * fwd_Ea[338] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[62];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[58] - g_RT[62]);
+    Kc = Kc_s[338];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[58]) + (h_RT[0] + h_RT[62]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60077,12 +56977,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[58];
-    k_f = prefactor_units[339] * fwd_A[339]
-                * exp(fwd_beta[339] * tc[0] - activation_units[339] * fwd_Ea[339] * invT);
+    k_f = k_f_s[339];
     dlnkfdT = fwd_beta[339] * invT + activation_units[339] * fwd_Ea[339] * invT2;
     /* reverse */
     phi_r = sc[54]*sc[57];
-    Kc = exp(g_RT[1] - g_RT[54] - g_RT[57] + g_RT[58]);
+    Kc = Kc_s[339];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[58]) + (h_RT[54] + h_RT[57]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60128,12 +57027,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[63];
-    k_f = prefactor_units[340] * fwd_A[340]
-                * exp(fwd_beta[340] * tc[0] - activation_units[340] * fwd_Ea[340] * invT);
+    k_f = k_f_s[340];
     dlnkfdT = fwd_beta[340] * invT + activation_units[340] * fwd_Ea[340] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[53];
-    Kc = exp(g_RT[1] - g_RT[9] - g_RT[53] + g_RT[63]);
+    Kc = Kc_s[340];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[63]) + (h_RT[9] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60179,12 +57077,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[63];
-    k_f = prefactor_units[341] * fwd_A[341]
-                * exp(fwd_beta[341] * tc[0] - activation_units[341] * fwd_Ea[341] * invT);
+    k_f = k_f_s[341];
     dlnkfdT = fwd_beta[341] * invT + activation_units[341] * fwd_Ea[341] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[65];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[63] - g_RT[65]);
+    Kc = Kc_s[341];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[63]) + (h_RT[0] + h_RT[65]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60230,12 +57127,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[53];
-    k_f = prefactor_units[342] * fwd_A[342]
-                * exp(fwd_beta[342] * tc[0] - activation_units[342] * fwd_Ea[342] * invT);
+    k_f = k_f_s[342];
     dlnkfdT = fwd_beta[342] * invT + activation_units[342] * fwd_Ea[342] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[65];
-    Kc = exp(-g_RT[0] + g_RT[9] + g_RT[53] - g_RT[65]);
+    Kc = Kc_s[342];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[53]) + (h_RT[0] + h_RT[65]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60281,12 +57177,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[69];
-    k_f = prefactor_units[343] * fwd_A[343]
-                * exp(fwd_beta[343] * tc[0] - activation_units[343] * fwd_Ea[343] * invT);
+    k_f = k_f_s[343];
     dlnkfdT = fwd_beta[343] * invT + activation_units[343] * fwd_Ea[343] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[53];
-    Kc = exp(g_RT[1] - g_RT[14] - g_RT[53] + g_RT[69]);
+    Kc = Kc_s[343];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[69]) + (h_RT[14] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60332,12 +57227,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[60];
-    k_f = prefactor_units[344] * fwd_A[344]
-                * exp(fwd_beta[344] * tc[0] - activation_units[344] * fwd_Ea[344] * invT);
+    k_f = k_f_s[344];
     dlnkfdT = fwd_beta[344] * invT + activation_units[344] * fwd_Ea[344] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[68];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[60] - g_RT[68]);
+    Kc = Kc_s[344];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[60]) + (h_RT[1] + h_RT[68]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60383,12 +57277,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[61];
-    k_f = prefactor_units[345] * fwd_A[345]
-                * exp(fwd_beta[345] * tc[0] - activation_units[345] * fwd_Ea[345] * invT);
+    k_f = k_f_s[345];
     dlnkfdT = fwd_beta[345] * invT + activation_units[345] * fwd_Ea[345] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[67];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[61] - g_RT[67]);
+    Kc = Kc_s[345];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[61]) + (h_RT[1] + h_RT[67]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60434,12 +57327,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[62];
-    k_f = prefactor_units[346] * fwd_A[346]
-                * exp(fwd_beta[346] * tc[0] - activation_units[346] * fwd_Ea[346] * invT);
+    k_f = k_f_s[346];
     dlnkfdT = fwd_beta[346] * invT + activation_units[346] * fwd_Ea[346] * invT2;
     /* reverse */
     phi_r = sc[54]*sc[67];
-    Kc = exp(g_RT[2] - g_RT[54] + g_RT[62] - g_RT[67]);
+    Kc = Kc_s[346];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[62]) + (h_RT[54] + h_RT[67]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60485,12 +57377,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[60];
-    k_f = prefactor_units[347] * fwd_A[347]
-                * exp(fwd_beta[347] * tc[0] - activation_units[347] * fwd_Ea[347] * invT);
+    k_f = k_f_s[347];
     dlnkfdT = fwd_beta[347] * invT + activation_units[347] * fwd_Ea[347] * invT2;
     /* reverse */
     phi_r = sc[17]*sc[53];
-    Kc = exp(g_RT[4] - g_RT[17] - g_RT[53] + g_RT[60]);
+    Kc = Kc_s[347];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[60]) + (h_RT[17] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60536,12 +57427,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[61];
-    k_f = prefactor_units[348] * fwd_A[348]
-                * exp(fwd_beta[348] * tc[0] - activation_units[348] * fwd_Ea[348] * invT);
+    k_f = k_f_s[348];
     dlnkfdT = fwd_beta[348] * invT + activation_units[348] * fwd_Ea[348] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[68];
-    Kc = exp(g_RT[4] - g_RT[53] + g_RT[61] - g_RT[68]);
+    Kc = Kc_s[348];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[61]) + (h_RT[53] + h_RT[68]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60587,12 +57477,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[62];
-    k_f = prefactor_units[349] * fwd_A[349]
-                * exp(fwd_beta[349] * tc[0] - activation_units[349] * fwd_Ea[349] * invT);
+    k_f = k_f_s[349];
     dlnkfdT = fwd_beta[349] * invT + activation_units[349] * fwd_Ea[349] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[67];
-    Kc = exp(g_RT[4] - g_RT[53] + g_RT[62] - g_RT[67]);
+    Kc = Kc_s[349];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[62]) + (h_RT[53] + h_RT[67]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60638,12 +57527,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[54];
-    k_f = prefactor_units[350] * fwd_A[350]
-                * exp(fwd_beta[350] * tc[0] - activation_units[350] * fwd_Ea[350] * invT);
+    k_f = k_f_s[350];
     dlnkfdT = fwd_beta[350] * invT + activation_units[350] * fwd_Ea[350] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[53];
-    Kc = exp(g_RT[0] - g_RT[1] - g_RT[53] + g_RT[54]);
+    Kc = Kc_s[350];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[54]) + (h_RT[1] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60689,12 +57577,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[54];
-    k_f = prefactor_units[351] * fwd_A[351]
-                * exp(fwd_beta[351] * tc[0] - activation_units[351] * fwd_Ea[351] * invT);
+    k_f = k_f_s[351];
     dlnkfdT = fwd_beta[351] * invT + activation_units[351] * fwd_Ea[351] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[53];
-    Kc = exp(-g_RT[2] + g_RT[4] - g_RT[53] + g_RT[54]);
+    Kc = Kc_s[351];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[54]) + (h_RT[2] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60740,12 +57627,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[54];
-    k_f = prefactor_units[352] * fwd_A[352]
-                * exp(fwd_beta[352] * tc[0] - activation_units[352] * fwd_Ea[352] * invT);
+    k_f = k_f_s[352];
     dlnkfdT = fwd_beta[352] * invT + activation_units[352] * fwd_Ea[352] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[53];
-    Kc = exp(-g_RT[3] + g_RT[6] - g_RT[53] + g_RT[54]);
+    Kc = Kc_s[352];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[54]) + (h_RT[3] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60791,12 +57677,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[54];
-    k_f = prefactor_units[353] * fwd_A[353]
-                * exp(fwd_beta[353] * tc[0] - activation_units[353] * fwd_Ea[353] * invT);
+    k_f = k_f_s[353];
     dlnkfdT = fwd_beta[353] * invT + activation_units[353] * fwd_Ea[353] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[53];
-    Kc = exp(-g_RT[4] + g_RT[5] - g_RT[53] + g_RT[54]);
+    Kc = Kc_s[353];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[54]) + (h_RT[4] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60842,12 +57727,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[54];
-    k_f = prefactor_units[354] * fwd_A[354]
-                * exp(fwd_beta[354] * tc[0] - activation_units[354] * fwd_Ea[354] * invT);
+    k_f = k_f_s[354];
     dlnkfdT = fwd_beta[354] * invT + activation_units[354] * fwd_Ea[354] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[53];
-    Kc = exp(-g_RT[6] + g_RT[7] - g_RT[53] + g_RT[54]);
+    Kc = Kc_s[354];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[54]) + (h_RT[6] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60893,12 +57777,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[63];
-    k_f = prefactor_units[355] * fwd_A[355]
-                * exp(fwd_beta[355] * tc[0] - activation_units[355] * fwd_Ea[355] * invT);
+    k_f = k_f_s[355];
     dlnkfdT = fwd_beta[355] * invT + activation_units[355] * fwd_Ea[355] * invT2;
     /* reverse */
     phi_r = sc[56];
-    Kc = refCinv * exp(g_RT[0] - g_RT[56] + g_RT[63]);
+    Kc = Kc_s[355];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[63]) + (h_RT[56]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60933,12 +57816,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[60];
-    k_f = prefactor_units[356] * fwd_A[356]
-                * exp(fwd_beta[356] * tc[0] - activation_units[356] * fwd_Ea[356] * invT);
+    k_f = k_f_s[356];
     dlnkfdT = fwd_beta[356] * invT + activation_units[356] * fwd_Ea[356] * invT2;
     /* reverse */
     phi_r = sc[56];
-    Kc = refCinv * exp(g_RT[1] - g_RT[56] + g_RT[60]);
+    Kc = Kc_s[356];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[60]) + (h_RT[56]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60973,12 +57855,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[64];
-    k_f = prefactor_units[357] * fwd_A[357]
-                * exp(fwd_beta[357] * tc[0] - activation_units[357] * fwd_Ea[357] * invT);
+    k_f = k_f_s[357];
     dlnkfdT = fwd_beta[357] * invT + activation_units[357] * fwd_Ea[357] * invT2;
     /* reverse */
     phi_r = sc[57];
-    Kc = refCinv * exp(g_RT[0] - g_RT[57] + g_RT[64]);
+    Kc = Kc_s[357];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[64]) + (h_RT[57]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61013,12 +57894,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[61];
-    k_f = prefactor_units[358] * fwd_A[358]
-                * exp(fwd_beta[358] * tc[0] - activation_units[358] * fwd_Ea[358] * invT);
+    k_f = k_f_s[358];
     dlnkfdT = fwd_beta[358] * invT + activation_units[358] * fwd_Ea[358] * invT2;
     /* reverse */
     phi_r = sc[57];
-    Kc = refCinv * exp(g_RT[1] - g_RT[57] + g_RT[61]);
+    Kc = Kc_s[358];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[61]) + (h_RT[57]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61053,12 +57933,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[53];
-    k_f = prefactor_units[359] * fwd_A[359]
-                * exp(fwd_beta[359] * tc[0] - activation_units[359] * fwd_Ea[359] * invT);
+    k_f = k_f_s[359];
     dlnkfdT = fwd_beta[359] * invT + activation_units[359] * fwd_Ea[359] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[63];
-    Kc = exp(-g_RT[0] + g_RT[11] + g_RT[53] - g_RT[63]);
+    Kc = Kc_s[359];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[53]) + (h_RT[0] + h_RT[63]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61104,12 +57983,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[54];
-    k_f = prefactor_units[360] * fwd_A[360]
-                * exp(fwd_beta[360] * tc[0] - activation_units[360] * fwd_Ea[360] * invT);
+    k_f = k_f_s[360];
     dlnkfdT = fwd_beta[360] * invT + activation_units[360] * fwd_Ea[360] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[53];
-    Kc = exp(-g_RT[11] + g_RT[12] - g_RT[53] + g_RT[54]);
+    Kc = Kc_s[360];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[54]) + (h_RT[11] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61155,12 +58033,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[54];
-    k_f = prefactor_units[361] * fwd_A[361]
-                * exp(fwd_beta[361] * tc[0] - activation_units[361] * fwd_Ea[361] * invT);
+    k_f = k_f_s[361];
     dlnkfdT = fwd_beta[361] * invT + activation_units[361] * fwd_Ea[361] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[60];
-    Kc = exp(-g_RT[1] + g_RT[12] + g_RT[54] - g_RT[60]);
+    Kc = Kc_s[361];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[54]) + (h_RT[1] + h_RT[60]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61206,12 +58083,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[53]*sc[63];
-    k_f = prefactor_units[362] * fwd_A[362]
-                * exp(fwd_beta[362] * tc[0] - activation_units[362] * fwd_Ea[362] * invT);
+    k_f = k_f_s[362];
     dlnkfdT = fwd_beta[362] * invT + activation_units[362] * fwd_Ea[362] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[64];
-    Kc = exp(-g_RT[0] + g_RT[53] + g_RT[63] - g_RT[64]);
+    Kc = Kc_s[362];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[53] + h_RT[63]) + (h_RT[0] + h_RT[64]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61257,12 +58133,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[61];
-    k_f = prefactor_units[363] * fwd_A[363]
-                * exp(fwd_beta[363] * tc[0] - activation_units[363] * fwd_Ea[363] * invT);
+    k_f = k_f_s[363];
     dlnkfdT = fwd_beta[363] * invT + activation_units[363] * fwd_Ea[363] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[63];
-    Kc = exp(g_RT[1] - g_RT[53] + g_RT[61] - g_RT[63]);
+    Kc = Kc_s[363];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[61]) + (h_RT[53] + h_RT[63]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61308,12 +58183,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[61];
-    k_f = prefactor_units[364] * fwd_A[364]
-                * exp(fwd_beta[364] * tc[0] - activation_units[364] * fwd_Ea[364] * invT);
+    k_f = k_f_s[364];
     dlnkfdT = fwd_beta[364] * invT + activation_units[364] * fwd_Ea[364] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[64];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[61] - g_RT[64]);
+    Kc = Kc_s[364];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[61]) + (h_RT[0] + h_RT[64]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61359,12 +58233,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[54]*sc[60];
-    k_f = prefactor_units[365] * fwd_A[365]
-                * exp(fwd_beta[365] * tc[0] - activation_units[365] * fwd_Ea[365] * invT);
+    k_f = k_f_s[365];
     dlnkfdT = fwd_beta[365] * invT + activation_units[365] * fwd_Ea[365] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[63];
-    Kc = exp(-g_RT[53] + g_RT[54] + g_RT[60] - g_RT[63]);
+    Kc = Kc_s[365];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[54] + h_RT[60]) + (h_RT[53] + h_RT[63]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61410,12 +58283,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[62];
-    k_f = prefactor_units[366] * fwd_A[366]
-                * exp(fwd_beta[366] * tc[0] - activation_units[366] * fwd_Ea[366] * invT);
+    k_f = k_f_s[366];
     dlnkfdT = fwd_beta[366] * invT + activation_units[366] * fwd_Ea[366] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[64];
-    Kc = exp(g_RT[1] - g_RT[53] + g_RT[62] - g_RT[64]);
+    Kc = Kc_s[366];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[62]) + (h_RT[53] + h_RT[64]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61461,12 +58333,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[54]*sc[61];
-    k_f = prefactor_units[367] * fwd_A[367]
-                * exp(fwd_beta[367] * tc[0] - activation_units[367] * fwd_Ea[367] * invT);
+    k_f = k_f_s[367];
     dlnkfdT = fwd_beta[367] * invT + activation_units[367] * fwd_Ea[367] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[64];
-    Kc = exp(-g_RT[53] + g_RT[54] + g_RT[61] - g_RT[64]);
+    Kc = Kc_s[367];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[54] + h_RT[61]) + (h_RT[53] + h_RT[64]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61512,12 +58383,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[56];
-    k_f = prefactor_units[368] * fwd_A[368]
-                * exp(fwd_beta[368] * tc[0] - activation_units[368] * fwd_Ea[368] * invT);
+    k_f = k_f_s[368];
     dlnkfdT = fwd_beta[368] * invT + activation_units[368] * fwd_Ea[368] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[60];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[56] - g_RT[60]);
+    Kc = Kc_s[368];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[56]) + (h_RT[0] + h_RT[60]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61563,12 +58433,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[57];
-    k_f = prefactor_units[369] * fwd_A[369]
-                * exp(fwd_beta[369] * tc[0] - activation_units[369] * fwd_Ea[369] * invT);
+    k_f = k_f_s[369];
     dlnkfdT = fwd_beta[369] * invT + activation_units[369] * fwd_Ea[369] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[61];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[57] - g_RT[61]);
+    Kc = Kc_s[369];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[57]) + (h_RT[0] + h_RT[61]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61614,12 +58483,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[56];
-    k_f = prefactor_units[370] * fwd_A[370]
-                * exp(fwd_beta[370] * tc[0] - activation_units[370] * fwd_Ea[370] * invT);
+    k_f = k_f_s[370];
     dlnkfdT = fwd_beta[370] * invT + activation_units[370] * fwd_Ea[370] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[53];
-    Kc = exp(g_RT[1] - g_RT[12] - g_RT[53] + g_RT[56]);
+    Kc = Kc_s[370];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[56]) + (h_RT[12] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61665,12 +58533,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[57];
-    k_f = prefactor_units[371] * fwd_A[371]
-                * exp(fwd_beta[371] * tc[0] - activation_units[371] * fwd_Ea[371] * invT);
+    k_f = k_f_s[371];
     dlnkfdT = fwd_beta[371] * invT + activation_units[371] * fwd_Ea[371] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[60];
-    Kc = exp(g_RT[1] - g_RT[53] + g_RT[57] - g_RT[60]);
+    Kc = Kc_s[371];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[57]) + (h_RT[53] + h_RT[60]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61716,12 +58583,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[58];
-    k_f = prefactor_units[372] * fwd_A[372]
-                * exp(fwd_beta[372] * tc[0] - activation_units[372] * fwd_Ea[372] * invT);
+    k_f = k_f_s[372];
     dlnkfdT = fwd_beta[372] * invT + activation_units[372] * fwd_Ea[372] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[61];
-    Kc = exp(g_RT[1] - g_RT[53] + g_RT[58] - g_RT[61]);
+    Kc = Kc_s[372];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[58]) + (h_RT[53] + h_RT[61]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61767,12 +58633,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[59];
-    k_f = prefactor_units[373] * fwd_A[373]
-                * exp(fwd_beta[373] * tc[0] - activation_units[373] * fwd_Ea[373] * invT);
+    k_f = k_f_s[373];
     dlnkfdT = fwd_beta[373] * invT + activation_units[373] * fwd_Ea[373] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[62];
-    Kc = exp(g_RT[1] - g_RT[53] + g_RT[59] - g_RT[62]);
+    Kc = Kc_s[373];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[59]) + (h_RT[53] + h_RT[62]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61818,12 +58683,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[59];
-    k_f = prefactor_units[374] * fwd_A[374]
-                * exp(fwd_beta[374] * tc[0] - activation_units[374] * fwd_Ea[374] * invT);
+    k_f = k_f_s[374];
     dlnkfdT = fwd_beta[374] * invT + activation_units[374] * fwd_Ea[374] * invT2;
     /* reverse */
     phi_r = sc[54]*sc[58];
-    Kc = exp(g_RT[1] - g_RT[54] - g_RT[58] + g_RT[59]);
+    Kc = Kc_s[374];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[59]) + (h_RT[54] + h_RT[58]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61869,12 +58733,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[56];
-    k_f = prefactor_units[375] * fwd_A[375]
-                * exp(fwd_beta[375] * tc[0] - activation_units[375] * fwd_Ea[375] * invT);
+    k_f = k_f_s[375];
     dlnkfdT = fwd_beta[375] * invT + activation_units[375] * fwd_Ea[375] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[60];
-    Kc = exp(g_RT[2] - g_RT[4] + g_RT[56] - g_RT[60]);
+    Kc = Kc_s[375];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[56]) + (h_RT[4] + h_RT[60]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61920,12 +58783,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[57];
-    k_f = prefactor_units[376] * fwd_A[376]
-                * exp(fwd_beta[376] * tc[0] - activation_units[376] * fwd_Ea[376] * invT);
+    k_f = k_f_s[376];
     dlnkfdT = fwd_beta[376] * invT + activation_units[376] * fwd_Ea[376] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[61];
-    Kc = exp(g_RT[2] - g_RT[4] + g_RT[57] - g_RT[61]);
+    Kc = Kc_s[376];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[57]) + (h_RT[4] + h_RT[61]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61971,12 +58833,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[58];
-    k_f = prefactor_units[377] * fwd_A[377]
-                * exp(fwd_beta[377] * tc[0] - activation_units[377] * fwd_Ea[377] * invT);
+    k_f = k_f_s[377];
     dlnkfdT = fwd_beta[377] * invT + activation_units[377] * fwd_Ea[377] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[62];
-    Kc = exp(g_RT[2] - g_RT[4] + g_RT[58] - g_RT[62]);
+    Kc = Kc_s[377];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[58]) + (h_RT[4] + h_RT[62]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62022,12 +58883,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[56];
-    k_f = prefactor_units[378] * fwd_A[378]
-                * exp(fwd_beta[378] * tc[0] - activation_units[378] * fwd_Ea[378] * invT);
+    k_f = k_f_s[378];
     dlnkfdT = fwd_beta[378] * invT + activation_units[378] * fwd_Ea[378] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[60];
-    Kc = exp(g_RT[4] - g_RT[5] + g_RT[56] - g_RT[60]);
+    Kc = Kc_s[378];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[56]) + (h_RT[5] + h_RT[60]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62073,12 +58933,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[57];
-    k_f = prefactor_units[379] * fwd_A[379]
-                * exp(fwd_beta[379] * tc[0] - activation_units[379] * fwd_Ea[379] * invT);
+    k_f = k_f_s[379];
     dlnkfdT = fwd_beta[379] * invT + activation_units[379] * fwd_Ea[379] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[61];
-    Kc = exp(g_RT[4] - g_RT[5] + g_RT[57] - g_RT[61]);
+    Kc = Kc_s[379];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[57]) + (h_RT[5] + h_RT[61]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62124,12 +58983,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[58];
-    k_f = prefactor_units[380] * fwd_A[380]
-                * exp(fwd_beta[380] * tc[0] - activation_units[380] * fwd_Ea[380] * invT);
+    k_f = k_f_s[380];
     dlnkfdT = fwd_beta[380] * invT + activation_units[380] * fwd_Ea[380] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[62];
-    Kc = exp(g_RT[4] - g_RT[5] + g_RT[58] - g_RT[62]);
+    Kc = Kc_s[380];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[58]) + (h_RT[5] + h_RT[62]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62175,12 +59033,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[60];
-    k_f = prefactor_units[381] * fwd_A[381]
-                * exp(fwd_beta[381] * tc[0] - activation_units[381] * fwd_Ea[381] * invT);
+    k_f = k_f_s[381];
     dlnkfdT = fwd_beta[381] * invT + activation_units[381] * fwd_Ea[381] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[56];
-    Kc = exp(-g_RT[6] + g_RT[7] - g_RT[56] + g_RT[60]);
+    Kc = Kc_s[381];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[60]) + (h_RT[6] + h_RT[56]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62226,12 +59083,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[61];
-    k_f = prefactor_units[382] * fwd_A[382]
-                * exp(fwd_beta[382] * tc[0] - activation_units[382] * fwd_Ea[382] * invT);
+    k_f = k_f_s[382];
     dlnkfdT = fwd_beta[382] * invT + activation_units[382] * fwd_Ea[382] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[57];
-    Kc = exp(-g_RT[6] + g_RT[7] - g_RT[57] + g_RT[61]);
+    Kc = Kc_s[382];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[61]) + (h_RT[6] + h_RT[57]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62277,12 +59133,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[62];
-    k_f = prefactor_units[383] * fwd_A[383]
-                * exp(fwd_beta[383] * tc[0] - activation_units[383] * fwd_Ea[383] * invT);
+    k_f = k_f_s[383];
     dlnkfdT = fwd_beta[383] * invT + activation_units[383] * fwd_Ea[383] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[58];
-    Kc = exp(-g_RT[6] + g_RT[7] - g_RT[58] + g_RT[62]);
+    Kc = Kc_s[383];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[62]) + (h_RT[6] + h_RT[58]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62328,12 +59183,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[56];
-    k_f = prefactor_units[384] * fwd_A[384]
-                * exp(fwd_beta[384] * tc[0] - activation_units[384] * fwd_Ea[384] * invT);
+    k_f = k_f_s[384];
     dlnkfdT = fwd_beta[384] * invT + activation_units[384] * fwd_Ea[384] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[60];
-    Kc = exp(g_RT[12] - g_RT[13] + g_RT[56] - g_RT[60]);
+    Kc = Kc_s[384];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[56]) + (h_RT[13] + h_RT[60]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62379,12 +59233,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[57];
-    k_f = prefactor_units[385] * fwd_A[385]
-                * exp(fwd_beta[385] * tc[0] - activation_units[385] * fwd_Ea[385] * invT);
+    k_f = k_f_s[385];
     dlnkfdT = fwd_beta[385] * invT + activation_units[385] * fwd_Ea[385] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[61];
-    Kc = exp(g_RT[12] - g_RT[13] + g_RT[57] - g_RT[61]);
+    Kc = Kc_s[385];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[57]) + (h_RT[13] + h_RT[61]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62430,12 +59283,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[62];
-    k_f = prefactor_units[386] * fwd_A[386]
-                * exp(fwd_beta[386] * tc[0] - activation_units[386] * fwd_Ea[386] * invT);
+    k_f = k_f_s[386];
     dlnkfdT = fwd_beta[386] * invT + activation_units[386] * fwd_Ea[386] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[58];
-    Kc = exp(-g_RT[12] + g_RT[13] - g_RT[58] + g_RT[62]);
+    Kc = Kc_s[386];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13] + h_RT[62]) + (h_RT[12] + h_RT[58]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62481,12 +59333,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[23]*sc[56];
-    k_f = prefactor_units[387] * fwd_A[387]
-                * exp(fwd_beta[387] * tc[0] - activation_units[387] * fwd_Ea[387] * invT);
+    k_f = k_f_s[387];
     dlnkfdT = fwd_beta[387] * invT + activation_units[387] * fwd_Ea[387] * invT2;
     /* reverse */
     phi_r = sc[24]*sc[60];
-    Kc = exp(g_RT[23] - g_RT[24] + g_RT[56] - g_RT[60]);
+    Kc = Kc_s[387];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[23] + h_RT[56]) + (h_RT[24] + h_RT[60]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62532,12 +59383,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[23]*sc[57];
-    k_f = prefactor_units[388] * fwd_A[388]
-                * exp(fwd_beta[388] * tc[0] - activation_units[388] * fwd_Ea[388] * invT);
+    k_f = k_f_s[388];
     dlnkfdT = fwd_beta[388] * invT + activation_units[388] * fwd_Ea[388] * invT2;
     /* reverse */
     phi_r = sc[24]*sc[61];
-    Kc = exp(g_RT[23] - g_RT[24] + g_RT[57] - g_RT[61]);
+    Kc = Kc_s[388];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[23] + h_RT[57]) + (h_RT[24] + h_RT[61]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62583,12 +59433,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[24]*sc[62];
-    k_f = prefactor_units[389] * fwd_A[389]
-                * exp(fwd_beta[389] * tc[0] - activation_units[389] * fwd_Ea[389] * invT);
+    k_f = k_f_s[389];
     dlnkfdT = fwd_beta[389] * invT + activation_units[389] * fwd_Ea[389] * invT2;
     /* reverse */
     phi_r = sc[23]*sc[58];
-    Kc = exp(-g_RT[23] + g_RT[24] - g_RT[58] + g_RT[62]);
+    Kc = Kc_s[389];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[24] + h_RT[62]) + (h_RT[23] + h_RT[58]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62634,12 +59483,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[56]*sc[62];
-    k_f = prefactor_units[390] * fwd_A[390]
-                * exp(fwd_beta[390] * tc[0] - activation_units[390] * fwd_Ea[390] * invT);
+    k_f = k_f_s[390];
     dlnkfdT = fwd_beta[390] * invT + activation_units[390] * fwd_Ea[390] * invT2;
     /* reverse */
     phi_r = sc[58]*sc[60];
-    Kc = exp(g_RT[56] - g_RT[58] - g_RT[60] + g_RT[62]);
+    Kc = Kc_s[390];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[56] + h_RT[62]) + (h_RT[58] + h_RT[60]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62685,12 +59533,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[57]*sc[60];
-    k_f = prefactor_units[391] * fwd_A[391]
-                * exp(fwd_beta[391] * tc[0] - activation_units[391] * fwd_Ea[391] * invT);
+    k_f = k_f_s[391];
     dlnkfdT = fwd_beta[391] * invT + activation_units[391] * fwd_Ea[391] * invT2;
     /* reverse */
     phi_r = sc[56]*sc[61];
-    Kc = exp(-g_RT[56] + g_RT[57] + g_RT[60] - g_RT[61]);
+    Kc = Kc_s[391];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[57] + h_RT[60]) + (h_RT[56] + h_RT[61]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62736,12 +59583,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[57]*sc[62];
-    k_f = prefactor_units[392] * fwd_A[392]
-                * exp(fwd_beta[392] * tc[0] - activation_units[392] * fwd_Ea[392] * invT);
+    k_f = k_f_s[392];
     dlnkfdT = fwd_beta[392] * invT + activation_units[392] * fwd_Ea[392] * invT2;
     /* reverse */
     phi_r = sc[58]*sc[61];
-    Kc = exp(g_RT[57] - g_RT[58] - g_RT[61] + g_RT[62]);
+    Kc = Kc_s[392];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[57] + h_RT[62]) + (h_RT[58] + h_RT[61]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62787,12 +59633,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[20]*sc[60];
-    k_f = prefactor_units[393] * fwd_A[393]
-                * exp(fwd_beta[393] * tc[0] - activation_units[393] * fwd_Ea[393] * invT);
+    k_f = k_f_s[393];
     dlnkfdT = fwd_beta[393] * invT + activation_units[393] * fwd_Ea[393] * invT2;
     /* reverse */
     phi_r = sc[19]*sc[56];
-    Kc = exp(-g_RT[19] + g_RT[20] - g_RT[56] + g_RT[60]);
+    Kc = Kc_s[393];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[20] + h_RT[60]) + (h_RT[19] + h_RT[56]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62838,12 +59683,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[20]*sc[61];
-    k_f = prefactor_units[394] * fwd_A[394]
-                * exp(fwd_beta[394] * tc[0] - activation_units[394] * fwd_Ea[394] * invT);
+    k_f = k_f_s[394];
     dlnkfdT = fwd_beta[394] * invT + activation_units[394] * fwd_Ea[394] * invT2;
     /* reverse */
     phi_r = sc[19]*sc[57];
-    Kc = exp(-g_RT[19] + g_RT[20] - g_RT[57] + g_RT[61]);
+    Kc = Kc_s[394];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[20] + h_RT[61]) + (h_RT[19] + h_RT[57]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62889,12 +59733,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[20]*sc[62];
-    k_f = prefactor_units[395] * fwd_A[395]
-                * exp(fwd_beta[395] * tc[0] - activation_units[395] * fwd_Ea[395] * invT);
+    k_f = k_f_s[395];
     dlnkfdT = fwd_beta[395] * invT + activation_units[395] * fwd_Ea[395] * invT2;
     /* reverse */
     phi_r = sc[19]*sc[58];
-    Kc = exp(-g_RT[19] + g_RT[20] - g_RT[58] + g_RT[62]);
+    Kc = Kc_s[395];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[20] + h_RT[62]) + (h_RT[19] + h_RT[58]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62940,12 +59783,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[20]*sc[60];
-    k_f = prefactor_units[396] * fwd_A[396]
-                * exp(fwd_beta[396] * tc[0] - activation_units[396] * fwd_Ea[396] * invT);
+    k_f = k_f_s[396];
     dlnkfdT = fwd_beta[396] * invT + activation_units[396] * fwd_Ea[396] * invT2;
     /* reverse */
     phi_r = sc[18]*sc[56];
-    Kc = exp(-g_RT[18] + g_RT[20] - g_RT[56] + g_RT[60]);
+    Kc = Kc_s[396];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[20] + h_RT[60]) + (h_RT[18] + h_RT[56]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62991,12 +59833,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[20]*sc[61];
-    k_f = prefactor_units[397] * fwd_A[397]
-                * exp(fwd_beta[397] * tc[0] - activation_units[397] * fwd_Ea[397] * invT);
+    k_f = k_f_s[397];
     dlnkfdT = fwd_beta[397] * invT + activation_units[397] * fwd_Ea[397] * invT2;
     /* reverse */
     phi_r = sc[18]*sc[57];
-    Kc = exp(-g_RT[18] + g_RT[20] - g_RT[57] + g_RT[61]);
+    Kc = Kc_s[397];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[20] + h_RT[61]) + (h_RT[18] + h_RT[57]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -63042,12 +59883,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[20]*sc[62];
-    k_f = prefactor_units[398] * fwd_A[398]
-                * exp(fwd_beta[398] * tc[0] - activation_units[398] * fwd_Ea[398] * invT);
+    k_f = k_f_s[398];
     dlnkfdT = fwd_beta[398] * invT + activation_units[398] * fwd_Ea[398] * invT2;
     /* reverse */
     phi_r = sc[18]*sc[58];
-    Kc = exp(-g_RT[18] + g_RT[20] - g_RT[58] + g_RT[62]);
+    Kc = Kc_s[398];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[20] + h_RT[62]) + (h_RT[18] + h_RT[58]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -63093,12 +59933,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[17]*sc[60];
-    k_f = prefactor_units[399] * fwd_A[399]
-                * exp(fwd_beta[399] * tc[0] - activation_units[399] * fwd_Ea[399] * invT);
+    k_f = k_f_s[399];
     dlnkfdT = fwd_beta[399] * invT + activation_units[399] * fwd_Ea[399] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[56];
-    Kc = exp(-g_RT[16] + g_RT[17] - g_RT[56] + g_RT[60]);
+    Kc = Kc_s[399];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[17] + h_RT[60]) + (h_RT[16] + h_RT[56]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -63144,12 +59983,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[17]*sc[61];
-    k_f = prefactor_units[400] * fwd_A[400]
-                * exp(fwd_beta[400] * tc[0] - activation_units[400] * fwd_Ea[400] * invT);
+    k_f = k_f_s[400];
     dlnkfdT = fwd_beta[400] * invT + activation_units[400] * fwd_Ea[400] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[57];
-    Kc = exp(-g_RT[16] + g_RT[17] - g_RT[57] + g_RT[61]);
+    Kc = Kc_s[400];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[17] + h_RT[61]) + (h_RT[16] + h_RT[57]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -63195,12 +60033,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[17]*sc[62];
-    k_f = prefactor_units[401] * fwd_A[401]
-                * exp(fwd_beta[401] * tc[0] - activation_units[401] * fwd_Ea[401] * invT);
+    k_f = k_f_s[401];
     dlnkfdT = fwd_beta[401] * invT + activation_units[401] * fwd_Ea[401] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[58];
-    Kc = exp(-g_RT[16] + g_RT[17] - g_RT[58] + g_RT[62]);
+    Kc = Kc_s[401];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[17] + h_RT[62]) + (h_RT[16] + h_RT[58]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -63246,12 +60083,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[60];
-    k_f = prefactor_units[402] * fwd_A[402]
-                * exp(fwd_beta[402] * tc[0] - activation_units[402] * fwd_Ea[402] * invT);
+    k_f = k_f_s[402];
     dlnkfdT = fwd_beta[402] * invT + activation_units[402] * fwd_Ea[402] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[56];
-    Kc = exp(-g_RT[14] + g_RT[16] - g_RT[56] + g_RT[60]);
+    Kc = Kc_s[402];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[60]) + (h_RT[14] + h_RT[56]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -63297,12 +60133,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[61];
-    k_f = prefactor_units[403] * fwd_A[403]
-                * exp(fwd_beta[403] * tc[0] - activation_units[403] * fwd_Ea[403] * invT);
+    k_f = k_f_s[403];
     dlnkfdT = fwd_beta[403] * invT + activation_units[403] * fwd_Ea[403] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[57];
-    Kc = exp(-g_RT[14] + g_RT[16] - g_RT[57] + g_RT[61]);
+    Kc = Kc_s[403];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[61]) + (h_RT[14] + h_RT[57]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -63348,12 +60183,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[62];
-    k_f = prefactor_units[404] * fwd_A[404]
-                * exp(fwd_beta[404] * tc[0] - activation_units[404] * fwd_Ea[404] * invT);
+    k_f = k_f_s[404];
     dlnkfdT = fwd_beta[404] * invT + activation_units[404] * fwd_Ea[404] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[58];
-    Kc = exp(-g_RT[14] + g_RT[16] - g_RT[58] + g_RT[62]);
+    Kc = Kc_s[404];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[62]) + (h_RT[14] + h_RT[58]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -63399,12 +60233,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[60];
-    k_f = prefactor_units[405] * fwd_A[405]
-                * exp(fwd_beta[405] * tc[0] - activation_units[405] * fwd_Ea[405] * invT);
+    k_f = k_f_s[405];
     dlnkfdT = fwd_beta[405] * invT + activation_units[405] * fwd_Ea[405] * invT2;
     /* reverse */
     phi_r = sc[28]*sc[53];
-    Kc = exp(g_RT[16] - g_RT[28] - g_RT[53] + g_RT[60]);
+    Kc = Kc_s[405];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[60]) + (h_RT[28] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -63450,8 +60283,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[60];
-    k_f = prefactor_units[406] * fwd_A[406]
-                * exp(fwd_beta[406] * tc[0] - activation_units[406] * fwd_Ea[406] * invT);
+    k_f = k_f_s[406];
     dlnkfdT = fwd_beta[406] * invT + activation_units[406] * fwd_Ea[406] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -63487,8 +60319,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[61];
-    k_f = prefactor_units[407] * fwd_A[407]
-                * exp(fwd_beta[407] * tc[0] - activation_units[407] * fwd_Ea[407] * invT);
+    k_f = k_f_s[407];
     dlnkfdT = fwd_beta[407] * invT + activation_units[407] * fwd_Ea[407] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -63524,12 +60355,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[62];
-    k_f = prefactor_units[408] * fwd_A[408]
-                * exp(fwd_beta[408] * tc[0] - activation_units[408] * fwd_Ea[408] * invT);
+    k_f = k_f_s[408];
     dlnkfdT = fwd_beta[408] * invT + activation_units[408] * fwd_Ea[408] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[66];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[62] - g_RT[66]);
+    Kc = Kc_s[408];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[62]) + (h_RT[2] + h_RT[66]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -63575,8 +60405,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[60];
-    k_f = prefactor_units[409] * fwd_A[409]
-                * exp(fwd_beta[409] * tc[0] - activation_units[409] * fwd_Ea[409] * invT);
+    k_f = k_f_s[409];
     dlnkfdT = fwd_beta[409] * invT + activation_units[409] * fwd_Ea[409] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -63612,8 +60441,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[61];
-    k_f = prefactor_units[410] * fwd_A[410]
-                * exp(fwd_beta[410] * tc[0] - activation_units[410] * fwd_Ea[410] * invT);
+    k_f = k_f_s[410];
     dlnkfdT = fwd_beta[410] * invT + activation_units[410] * fwd_Ea[410] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -63649,12 +60477,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[62];
-    k_f = prefactor_units[411] * fwd_A[411]
-                * exp(fwd_beta[411] * tc[0] - activation_units[411] * fwd_Ea[411] * invT);
+    k_f = k_f_s[411];
     dlnkfdT = fwd_beta[411] * invT + activation_units[411] * fwd_Ea[411] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[66];
-    Kc = exp(-g_RT[4] + g_RT[6] + g_RT[62] - g_RT[66]);
+    Kc = Kc_s[411];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[62]) + (h_RT[4] + h_RT[66]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -63700,12 +60527,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[60];
-    k_f = prefactor_units[412] * fwd_A[412]
-                * exp(fwd_beta[412] * tc[0] - activation_units[412] * fwd_Ea[412] * invT);
+    k_f = k_f_s[412];
     dlnkfdT = fwd_beta[412] * invT + activation_units[412] * fwd_Ea[412] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[56];
-    Kc = exp(-g_RT[3] + g_RT[6] - g_RT[56] + g_RT[60]);
+    Kc = Kc_s[412];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[60]) + (h_RT[3] + h_RT[56]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -63751,12 +60577,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[61];
-    k_f = prefactor_units[413] * fwd_A[413]
-                * exp(fwd_beta[413] * tc[0] - activation_units[413] * fwd_Ea[413] * invT);
+    k_f = k_f_s[413];
     dlnkfdT = fwd_beta[413] * invT + activation_units[413] * fwd_Ea[413] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[57];
-    Kc = exp(-g_RT[3] + g_RT[6] - g_RT[57] + g_RT[61]);
+    Kc = Kc_s[413];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[61]) + (h_RT[3] + h_RT[57]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -63802,12 +60627,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[62];
-    k_f = prefactor_units[414] * fwd_A[414]
-                * exp(fwd_beta[414] * tc[0] - activation_units[414] * fwd_Ea[414] * invT);
+    k_f = k_f_s[414];
     dlnkfdT = fwd_beta[414] * invT + activation_units[414] * fwd_Ea[414] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[58];
-    Kc = exp(-g_RT[3] + g_RT[6] - g_RT[58] + g_RT[62]);
+    Kc = Kc_s[414];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[62]) + (h_RT[3] + h_RT[58]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -63853,12 +60677,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[66];
-    k_f = prefactor_units[415] * fwd_A[415]
-                * exp(fwd_beta[415] * tc[0] - activation_units[415] * fwd_Ea[415] * invT);
+    k_f = k_f_s[415];
     dlnkfdT = fwd_beta[415] * invT + activation_units[415] * fwd_Ea[415] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[67];
-    Kc = exp(g_RT[1] - g_RT[53] + g_RT[66] - g_RT[67]);
+    Kc = Kc_s[415];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[66]) + (h_RT[53] + h_RT[67]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -63904,8 +60727,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[66];
-    k_f = prefactor_units[416] * fwd_A[416]
-                * exp(fwd_beta[416] * tc[0] - activation_units[416] * fwd_Ea[416] * invT);
+    k_f = k_f_s[416];
     dlnkfdT = fwd_beta[416] * invT + activation_units[416] * fwd_Ea[416] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -63941,8 +60763,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[66];
-    k_f = prefactor_units[417] * fwd_A[417]
-                * exp(fwd_beta[417] * tc[0] - activation_units[417] * fwd_Ea[417] * invT);
+    k_f = k_f_s[417];
     dlnkfdT = fwd_beta[417] * invT + activation_units[417] * fwd_Ea[417] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -63978,8 +60799,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[66];
-    k_f = prefactor_units[418] * fwd_A[418]
-                * exp(fwd_beta[418] * tc[0] - activation_units[418] * fwd_Ea[418] * invT);
+    k_f = k_f_s[418];
     dlnkfdT = fwd_beta[418] * invT + activation_units[418] * fwd_Ea[418] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -64015,8 +60835,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[26]*sc[66];
-    k_f = prefactor_units[419] * fwd_A[419]
-                * exp(fwd_beta[419] * tc[0] - activation_units[419] * fwd_Ea[419] * invT);
+    k_f = k_f_s[419];
     dlnkfdT = fwd_beta[419] * invT + activation_units[419] * fwd_Ea[419] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -64052,8 +60871,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[24]*sc[66];
-    k_f = prefactor_units[420] * fwd_A[420]
-                * exp(fwd_beta[420] * tc[0] - activation_units[420] * fwd_Ea[420] * invT);
+    k_f = k_f_s[420];
     dlnkfdT = fwd_beta[420] * invT + activation_units[420] * fwd_Ea[420] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -64089,8 +60907,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[17]*sc[66];
-    k_f = prefactor_units[421] * fwd_A[421]
-                * exp(fwd_beta[421] * tc[0] - activation_units[421] * fwd_Ea[421] * invT);
+    k_f = k_f_s[421];
     dlnkfdT = fwd_beta[421] * invT + activation_units[421] * fwd_Ea[421] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -64126,8 +60943,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[66];
-    k_f = prefactor_units[422] * fwd_A[422]
-                * exp(fwd_beta[422] * tc[0] - activation_units[422] * fwd_Ea[422] * invT);
+    k_f = k_f_s[422];
     dlnkfdT = fwd_beta[422] * invT + activation_units[422] * fwd_Ea[422] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -64163,12 +60979,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[63];
-    k_f = prefactor_units[423] * fwd_A[423]
-                * exp(fwd_beta[423] * tc[0] - activation_units[423] * fwd_Ea[423] * invT);
+    k_f = k_f_s[423];
     dlnkfdT = fwd_beta[423] * invT + activation_units[423] * fwd_Ea[423] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[68];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[63] - g_RT[68]);
+    Kc = Kc_s[423];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[63]) + (h_RT[2] + h_RT[68]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -64214,12 +61029,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[64];
-    k_f = prefactor_units[424] * fwd_A[424]
-                * exp(fwd_beta[424] * tc[0] - activation_units[424] * fwd_Ea[424] * invT);
+    k_f = k_f_s[424];
     dlnkfdT = fwd_beta[424] * invT + activation_units[424] * fwd_Ea[424] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[67];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[64] - g_RT[67]);
+    Kc = Kc_s[424];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[64]) + (h_RT[2] + h_RT[67]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -64265,12 +61079,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[63];
-    k_f = prefactor_units[425] * fwd_A[425]
-                * exp(fwd_beta[425] * tc[0] - activation_units[425] * fwd_Ea[425] * invT);
+    k_f = k_f_s[425];
     dlnkfdT = fwd_beta[425] * invT + activation_units[425] * fwd_Ea[425] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[53];
-    Kc = exp(g_RT[2] - g_RT[14] - g_RT[53] + g_RT[63]);
+    Kc = Kc_s[425];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[63]) + (h_RT[14] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -64316,12 +61129,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[64];
-    k_f = prefactor_units[426] * fwd_A[426]
-                * exp(fwd_beta[426] * tc[0] - activation_units[426] * fwd_Ea[426] * invT);
+    k_f = k_f_s[426];
     dlnkfdT = fwd_beta[426] * invT + activation_units[426] * fwd_Ea[426] * invT2;
     /* reverse */
     phi_r = sc[54]*sc[69];
-    Kc = exp(g_RT[2] - g_RT[54] + g_RT[64] - g_RT[69]);
+    Kc = Kc_s[426];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[64]) + (h_RT[54] + h_RT[69]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -64367,12 +61179,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[63];
-    k_f = prefactor_units[427] * fwd_A[427]
-                * exp(fwd_beta[427] * tc[0] - activation_units[427] * fwd_Ea[427] * invT);
+    k_f = k_f_s[427];
     dlnkfdT = fwd_beta[427] * invT + activation_units[427] * fwd_Ea[427] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[68];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[63] - g_RT[68]);
+    Kc = Kc_s[427];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[63]) + (h_RT[1] + h_RT[68]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -64418,12 +61229,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[64];
-    k_f = prefactor_units[428] * fwd_A[428]
-                * exp(fwd_beta[428] * tc[0] - activation_units[428] * fwd_Ea[428] * invT);
+    k_f = k_f_s[428];
     dlnkfdT = fwd_beta[428] * invT + activation_units[428] * fwd_Ea[428] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[67];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[64] - g_RT[67]);
+    Kc = Kc_s[428];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[64]) + (h_RT[1] + h_RT[67]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -64469,12 +61279,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[63];
-    k_f = prefactor_units[429] * fwd_A[429]
-                * exp(fwd_beta[429] * tc[0] - activation_units[429] * fwd_Ea[429] * invT);
+    k_f = k_f_s[429];
     dlnkfdT = fwd_beta[429] * invT + activation_units[429] * fwd_Ea[429] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[53];
-    Kc = exp(g_RT[4] - g_RT[16] - g_RT[53] + g_RT[63]);
+    Kc = Kc_s[429];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[63]) + (h_RT[16] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -64520,12 +61329,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[64];
-    k_f = prefactor_units[430] * fwd_A[430]
-                * exp(fwd_beta[430] * tc[0] - activation_units[430] * fwd_Ea[430] * invT);
+    k_f = k_f_s[430];
     dlnkfdT = fwd_beta[430] * invT + activation_units[430] * fwd_Ea[430] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[69];
-    Kc = exp(g_RT[4] - g_RT[53] + g_RT[64] - g_RT[69]);
+    Kc = Kc_s[430];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[64]) + (h_RT[53] + h_RT[69]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -64571,12 +61379,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[63];
-    k_f = prefactor_units[431] * fwd_A[431]
-                * exp(fwd_beta[431] * tc[0] - activation_units[431] * fwd_Ea[431] * invT);
+    k_f = k_f_s[431];
     dlnkfdT = fwd_beta[431] * invT + activation_units[431] * fwd_Ea[431] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[68];
-    Kc = exp(-g_RT[4] + g_RT[6] + g_RT[63] - g_RT[68]);
+    Kc = Kc_s[431];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[63]) + (h_RT[4] + h_RT[68]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -64622,12 +61429,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[64];
-    k_f = prefactor_units[432] * fwd_A[432]
-                * exp(fwd_beta[432] * tc[0] - activation_units[432] * fwd_Ea[432] * invT);
+    k_f = k_f_s[432];
     dlnkfdT = fwd_beta[432] * invT + activation_units[432] * fwd_Ea[432] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[67];
-    Kc = exp(-g_RT[4] + g_RT[6] + g_RT[64] - g_RT[67]);
+    Kc = Kc_s[432];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[64]) + (h_RT[4] + h_RT[67]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -64673,12 +61479,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[63];
-    k_f = prefactor_units[433] * fwd_A[433]
-                * exp(fwd_beta[433] * tc[0] - activation_units[433] * fwd_Ea[433] * invT);
+    k_f = k_f_s[433];
     dlnkfdT = fwd_beta[433] * invT + activation_units[433] * fwd_Ea[433] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[60];
-    Kc = exp(-g_RT[3] + g_RT[6] - g_RT[60] + g_RT[63]);
+    Kc = Kc_s[433];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[63]) + (h_RT[3] + h_RT[60]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -64724,12 +61529,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[64];
-    k_f = prefactor_units[434] * fwd_A[434]
-                * exp(fwd_beta[434] * tc[0] - activation_units[434] * fwd_Ea[434] * invT);
+    k_f = k_f_s[434];
     dlnkfdT = fwd_beta[434] * invT + activation_units[434] * fwd_Ea[434] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[61];
-    Kc = exp(-g_RT[3] + g_RT[6] - g_RT[61] + g_RT[64]);
+    Kc = Kc_s[434];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[64]) + (h_RT[3] + h_RT[61]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -64775,12 +61579,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[63];
-    k_f = prefactor_units[435] * fwd_A[435]
-                * exp(fwd_beta[435] * tc[0] - activation_units[435] * fwd_Ea[435] * invT);
+    k_f = k_f_s[435];
     dlnkfdT = fwd_beta[435] * invT + activation_units[435] * fwd_Ea[435] * invT2;
     /* reverse */
     phi_r = sc[17]*sc[53];
-    Kc = exp(g_RT[5] - g_RT[17] - g_RT[53] + g_RT[63]);
+    Kc = Kc_s[435];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[63]) + (h_RT[17] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -64826,12 +61629,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[64];
-    k_f = prefactor_units[436] * fwd_A[436]
-                * exp(fwd_beta[436] * tc[0] - activation_units[436] * fwd_Ea[436] * invT);
+    k_f = k_f_s[436];
     dlnkfdT = fwd_beta[436] * invT + activation_units[436] * fwd_Ea[436] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[68];
-    Kc = exp(g_RT[5] - g_RT[53] + g_RT[64] - g_RT[68]);
+    Kc = Kc_s[436];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[64]) + (h_RT[53] + h_RT[68]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -64877,12 +61679,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[64];
-    k_f = prefactor_units[437] * fwd_A[437]
-                * exp(fwd_beta[437] * tc[0] - activation_units[437] * fwd_Ea[437] * invT);
+    k_f = k_f_s[437];
     dlnkfdT = fwd_beta[437] * invT + activation_units[437] * fwd_Ea[437] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[65];
-    Kc = exp(g_RT[1] - g_RT[53] + g_RT[64] - g_RT[65]);
+    Kc = Kc_s[437];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[64]) + (h_RT[53] + h_RT[65]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -64928,12 +61729,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[17]*sc[63];
-    k_f = prefactor_units[438] * fwd_A[438]
-                * exp(fwd_beta[438] * tc[0] - activation_units[438] * fwd_Ea[438] * invT);
+    k_f = k_f_s[438];
     dlnkfdT = fwd_beta[438] * invT + activation_units[438] * fwd_Ea[438] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[60];
-    Kc = exp(-g_RT[16] + g_RT[17] - g_RT[60] + g_RT[63]);
+    Kc = Kc_s[438];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[17] + h_RT[63]) + (h_RT[16] + h_RT[60]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -64979,12 +61779,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[17]*sc[63];
-    k_f = prefactor_units[439] * fwd_A[439]
-                * exp(fwd_beta[439] * tc[0] - activation_units[439] * fwd_Ea[439] * invT);
+    k_f = k_f_s[439];
     dlnkfdT = fwd_beta[439] * invT + activation_units[439] * fwd_Ea[439] * invT2;
     /* reverse */
     phi_r = sc[28]*sc[53];
-    Kc = exp(g_RT[17] - g_RT[28] - g_RT[53] + g_RT[63]);
+    Kc = Kc_s[439];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[17] + h_RT[63]) + (h_RT[28] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -65030,12 +61829,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[17]*sc[64];
-    k_f = prefactor_units[440] * fwd_A[440]
-                * exp(fwd_beta[440] * tc[0] - activation_units[440] * fwd_Ea[440] * invT);
+    k_f = k_f_s[440];
     dlnkfdT = fwd_beta[440] * invT + activation_units[440] * fwd_Ea[440] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[61];
-    Kc = exp(-g_RT[16] + g_RT[17] - g_RT[61] + g_RT[64]);
+    Kc = Kc_s[440];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[17] + h_RT[64]) + (h_RT[16] + h_RT[61]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -65081,12 +61879,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[63];
-    k_f = prefactor_units[441] * fwd_A[441]
-                * exp(fwd_beta[441] * tc[0] - activation_units[441] * fwd_Ea[441] * invT);
+    k_f = k_f_s[441];
     dlnkfdT = fwd_beta[441] * invT + activation_units[441] * fwd_Ea[441] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[60];
-    Kc = exp(-g_RT[14] + g_RT[16] - g_RT[60] + g_RT[63]);
+    Kc = Kc_s[441];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[63]) + (h_RT[14] + h_RT[60]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -65132,12 +61929,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[64];
-    k_f = prefactor_units[442] * fwd_A[442]
-                * exp(fwd_beta[442] * tc[0] - activation_units[442] * fwd_Ea[442] * invT);
+    k_f = k_f_s[442];
     dlnkfdT = fwd_beta[442] * invT + activation_units[442] * fwd_Ea[442] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[61];
-    Kc = exp(-g_RT[14] + g_RT[16] - g_RT[61] + g_RT[64]);
+    Kc = Kc_s[442];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[64]) + (h_RT[14] + h_RT[61]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -65183,12 +61979,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[65];
-    k_f = prefactor_units[443] * fwd_A[443]
-                * exp(fwd_beta[443] * tc[0] - activation_units[443] * fwd_Ea[443] * invT);
+    k_f = k_f_s[443];
     dlnkfdT = fwd_beta[443] * invT + activation_units[443] * fwd_Ea[443] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[69];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[65] - g_RT[69]);
+    Kc = Kc_s[443];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[65]) + (h_RT[2] + h_RT[69]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -65234,12 +62029,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[65];
-    k_f = prefactor_units[444] * fwd_A[444]
-                * exp(fwd_beta[444] * tc[0] - activation_units[444] * fwd_Ea[444] * invT);
+    k_f = k_f_s[444];
     dlnkfdT = fwd_beta[444] * invT + activation_units[444] * fwd_Ea[444] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[68];
-    Kc = exp(-g_RT[1] + g_RT[5] + g_RT[65] - g_RT[68]);
+    Kc = Kc_s[444];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[65]) + (h_RT[1] + h_RT[68]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -65285,12 +62079,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[65];
-    k_f = prefactor_units[445] * fwd_A[445]
-                * exp(fwd_beta[445] * tc[0] - activation_units[445] * fwd_Ea[445] * invT);
+    k_f = k_f_s[445];
     dlnkfdT = fwd_beta[445] * invT + activation_units[445] * fwd_Ea[445] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[53];
-    Kc = exp(g_RT[1] - g_RT[8] - g_RT[53] + g_RT[65]);
+    Kc = Kc_s[445];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[65]) + (h_RT[8] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -65336,12 +62129,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[65];
-    k_f = prefactor_units[446] * fwd_A[446]
-                * exp(fwd_beta[446] * tc[0] - activation_units[446] * fwd_Ea[446] * invT);
+    k_f = k_f_s[446];
     dlnkfdT = fwd_beta[446] * invT + activation_units[446] * fwd_Ea[446] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[54];
-    Kc = exp(g_RT[2] - g_RT[14] - g_RT[54] + g_RT[65]);
+    Kc = Kc_s[446];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[65]) + (h_RT[14] + h_RT[54]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -65387,12 +62179,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[65];
-    k_f = prefactor_units[447] * fwd_A[447]
-                * exp(fwd_beta[447] * tc[0] - activation_units[447] * fwd_Ea[447] * invT);
+    k_f = k_f_s[447];
     dlnkfdT = fwd_beta[447] * invT + activation_units[447] * fwd_Ea[447] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[53];
-    Kc = exp(g_RT[4] - g_RT[14] - g_RT[53] + g_RT[65]);
+    Kc = Kc_s[447];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[65]) + (h_RT[14] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -65438,8 +62229,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[65];
-    k_f = prefactor_units[448] * fwd_A[448]
-                * exp(fwd_beta[448] * tc[0] - activation_units[448] * fwd_Ea[448] * invT);
+    k_f = k_f_s[448];
     dlnkfdT = fwd_beta[448] * invT + activation_units[448] * fwd_Ea[448] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -65471,8 +62261,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[24]*sc[65];
-    k_f = prefactor_units[449] * fwd_A[449]
-                * exp(fwd_beta[449] * tc[0] - activation_units[449] * fwd_Ea[449] * invT);
+    k_f = k_f_s[449];
     dlnkfdT = fwd_beta[449] * invT + activation_units[449] * fwd_Ea[449] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -65504,8 +62293,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[17]*sc[65];
-    k_f = prefactor_units[450] * fwd_A[450]
-                * exp(fwd_beta[450] * tc[0] - activation_units[450] * fwd_Ea[450] * invT);
+    k_f = k_f_s[450];
     dlnkfdT = fwd_beta[450] * invT + activation_units[450] * fwd_Ea[450] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -65537,8 +62325,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[65];
-    k_f = prefactor_units[451] * fwd_A[451]
-                * exp(fwd_beta[451] * tc[0] - activation_units[451] * fwd_Ea[451] * invT);
+    k_f = k_f_s[451];
     dlnkfdT = fwd_beta[451] * invT + activation_units[451] * fwd_Ea[451] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -65570,12 +62357,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[54]*sc[69];
-    k_f = prefactor_units[452] * fwd_A[452]
-                * exp(fwd_beta[452] * tc[0] - activation_units[452] * fwd_Ea[452] * invT);
+    k_f = k_f_s[452];
     dlnkfdT = fwd_beta[452] * invT + activation_units[452] * fwd_Ea[452] * invT2;
     /* reverse */
     phi_r = sc[67];
-    Kc = refCinv * exp(g_RT[54] - g_RT[67] + g_RT[69]);
+    Kc = Kc_s[452];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[54] + h_RT[69]) + (h_RT[67]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -65610,12 +62396,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[68];
-    k_f = prefactor_units[453] * fwd_A[453]
-                * exp(fwd_beta[453] * tc[0] - activation_units[453] * fwd_Ea[453] * invT);
+    k_f = k_f_s[453];
     dlnkfdT = fwd_beta[453] * invT + activation_units[453] * fwd_Ea[453] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[69];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[68] - g_RT[69]);
+    Kc = Kc_s[453];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[68]) + (h_RT[0] + h_RT[69]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -65661,12 +62446,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[67];
-    k_f = prefactor_units[454] * fwd_A[454]
-                * exp(fwd_beta[454] * tc[0] - activation_units[454] * fwd_Ea[454] * invT);
+    k_f = k_f_s[454];
     dlnkfdT = fwd_beta[454] * invT + activation_units[454] * fwd_Ea[454] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[69];
-    Kc = exp(g_RT[1] - g_RT[53] + g_RT[67] - g_RT[69]);
+    Kc = Kc_s[454];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[67]) + (h_RT[53] + h_RT[69]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -65712,12 +62496,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[67];
-    k_f = prefactor_units[455] * fwd_A[455]
-                * exp(fwd_beta[455] * tc[0] - activation_units[455] * fwd_Ea[455] * invT);
+    k_f = k_f_s[455];
     dlnkfdT = fwd_beta[455] * invT + activation_units[455] * fwd_Ea[455] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[69];
-    Kc = exp(g_RT[1] - g_RT[53] + g_RT[67] - g_RT[69]);
+    Kc = Kc_s[455];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[67]) + (h_RT[53] + h_RT[69]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -65763,12 +62546,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[67];
-    k_f = prefactor_units[456] * fwd_A[456]
-                * exp(fwd_beta[456] * tc[0] - activation_units[456] * fwd_Ea[456] * invT);
+    k_f = k_f_s[456];
     dlnkfdT = fwd_beta[456] * invT + activation_units[456] * fwd_Ea[456] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[69];
-    Kc = exp(g_RT[1] - g_RT[53] + g_RT[67] - g_RT[69]);
+    Kc = Kc_s[456];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[67]) + (h_RT[53] + h_RT[69]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -65814,8 +62596,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[67];
-    k_f = prefactor_units[457] * fwd_A[457]
-                * exp(fwd_beta[457] * tc[0] - activation_units[457] * fwd_Ea[457] * invT);
+    k_f = k_f_s[457];
     dlnkfdT = fwd_beta[457] * invT + activation_units[457] * fwd_Ea[457] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -65847,12 +62628,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[68];
-    k_f = prefactor_units[458] * fwd_A[458]
-                * exp(fwd_beta[458] * tc[0] - activation_units[458] * fwd_Ea[458] * invT);
+    k_f = k_f_s[458];
     dlnkfdT = fwd_beta[458] * invT + activation_units[458] * fwd_Ea[458] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[69];
-    Kc = exp(g_RT[2] - g_RT[4] + g_RT[68] - g_RT[69]);
+    Kc = Kc_s[458];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[68]) + (h_RT[4] + h_RT[69]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -65898,12 +62678,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[68];
-    k_f = prefactor_units[459] * fwd_A[459]
-                * exp(fwd_beta[459] * tc[0] - activation_units[459] * fwd_Ea[459] * invT);
+    k_f = k_f_s[459];
     dlnkfdT = fwd_beta[459] * invT + activation_units[459] * fwd_Ea[459] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[69];
-    Kc = exp(g_RT[4] - g_RT[5] + g_RT[68] - g_RT[69]);
+    Kc = Kc_s[459];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[68]) + (h_RT[5] + h_RT[69]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -65949,8 +62728,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[67];
-    k_f = prefactor_units[460] * fwd_A[460]
-                * exp(fwd_beta[460] * tc[0] - activation_units[460] * fwd_Ea[460] * invT);
+    k_f = k_f_s[460];
     dlnkfdT = fwd_beta[460] * invT + activation_units[460] * fwd_Ea[460] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -65986,12 +62764,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[69];
-    k_f = prefactor_units[461] * fwd_A[461]
-                * exp(fwd_beta[461] * tc[0] - activation_units[461] * fwd_Ea[461] * invT);
+    k_f = k_f_s[461];
     dlnkfdT = fwd_beta[461] * invT + activation_units[461] * fwd_Ea[461] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[68];
-    Kc = exp(-g_RT[6] + g_RT[7] - g_RT[68] + g_RT[69]);
+    Kc = Kc_s[461];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[69]) + (h_RT[6] + h_RT[68]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -66037,12 +62814,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[68];
-    k_f = prefactor_units[462] * fwd_A[462]
-                * exp(fwd_beta[462] * tc[0] - activation_units[462] * fwd_Ea[462] * invT);
+    k_f = k_f_s[462];
     dlnkfdT = fwd_beta[462] * invT + activation_units[462] * fwd_Ea[462] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[69];
-    Kc = exp(g_RT[12] - g_RT[13] + g_RT[68] - g_RT[69]);
+    Kc = Kc_s[462];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[68]) + (h_RT[13] + h_RT[69]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -66088,12 +62864,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[60]*sc[68];
-    k_f = prefactor_units[463] * fwd_A[463]
-                * exp(fwd_beta[463] * tc[0] - activation_units[463] * fwd_Ea[463] * invT);
+    k_f = k_f_s[463];
     dlnkfdT = fwd_beta[463] * invT + activation_units[463] * fwd_Ea[463] * invT2;
     /* reverse */
     phi_r = sc[56]*sc[69];
-    Kc = exp(-g_RT[56] + g_RT[60] + g_RT[68] - g_RT[69]);
+    Kc = Kc_s[463];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[60] + h_RT[68]) + (h_RT[56] + h_RT[69]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -66139,12 +62914,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[61]*sc[68];
-    k_f = prefactor_units[464] * fwd_A[464]
-                * exp(fwd_beta[464] * tc[0] - activation_units[464] * fwd_Ea[464] * invT);
+    k_f = k_f_s[464];
     dlnkfdT = fwd_beta[464] * invT + activation_units[464] * fwd_Ea[464] * invT2;
     /* reverse */
     phi_r = sc[57]*sc[69];
-    Kc = exp(-g_RT[57] + g_RT[61] + g_RT[68] - g_RT[69]);
+    Kc = Kc_s[464];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[61] + h_RT[68]) + (h_RT[57] + h_RT[69]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -66190,12 +62964,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[62]*sc[68];
-    k_f = prefactor_units[465] * fwd_A[465]
-                * exp(fwd_beta[465] * tc[0] - activation_units[465] * fwd_Ea[465] * invT);
+    k_f = k_f_s[465];
     dlnkfdT = fwd_beta[465] * invT + activation_units[465] * fwd_Ea[465] * invT2;
     /* reverse */
     phi_r = sc[58]*sc[69];
-    Kc = exp(-g_RT[58] + g_RT[62] + g_RT[68] - g_RT[69]);
+    Kc = Kc_s[465];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[62] + h_RT[68]) + (h_RT[58] + h_RT[69]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -66241,12 +63014,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[23]*sc[68];
-    k_f = prefactor_units[466] * fwd_A[466]
-                * exp(fwd_beta[466] * tc[0] - activation_units[466] * fwd_Ea[466] * invT);
+    k_f = k_f_s[466];
     dlnkfdT = fwd_beta[466] * invT + activation_units[466] * fwd_Ea[466] * invT2;
     /* reverse */
     phi_r = sc[24]*sc[69];
-    Kc = exp(g_RT[23] - g_RT[24] + g_RT[68] - g_RT[69]);
+    Kc = Kc_s[466];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[23] + h_RT[68]) + (h_RT[24] + h_RT[69]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -66292,12 +63064,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[69];
-    k_f = prefactor_units[467] * fwd_A[467]
-                * exp(fwd_beta[467] * tc[0] - activation_units[467] * fwd_Ea[467] * invT);
+    k_f = k_f_s[467];
     dlnkfdT = fwd_beta[467] * invT + activation_units[467] * fwd_Ea[467] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[54];
-    Kc = exp(g_RT[2] - g_RT[15] - g_RT[54] + g_RT[69]);
+    Kc = Kc_s[467];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[69]) + (h_RT[15] + h_RT[54]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -66343,12 +63114,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[69];
-    k_f = prefactor_units[468] * fwd_A[468]
-                * exp(fwd_beta[468] * tc[0] - activation_units[468] * fwd_Ea[468] * invT);
+    k_f = k_f_s[468];
     dlnkfdT = fwd_beta[468] * invT + activation_units[468] * fwd_Ea[468] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[53];
-    Kc = exp(g_RT[4] - g_RT[15] - g_RT[53] + g_RT[69]);
+    Kc = Kc_s[468];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[69]) + (h_RT[15] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -66394,8 +63164,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[69];
-    k_f = prefactor_units[469] * fwd_A[469]
-                * exp(fwd_beta[469] * tc[0] - activation_units[469] * fwd_Ea[469] * invT);
+    k_f = k_f_s[469];
     dlnkfdT = fwd_beta[469] * invT + activation_units[469] * fwd_Ea[469] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -66431,12 +63200,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[69];
-    k_f = prefactor_units[470] * fwd_A[470]
-                * exp(fwd_beta[470] * tc[0] - activation_units[470] * fwd_Ea[470] * invT);
+    k_f = k_f_s[470];
     dlnkfdT = fwd_beta[470] * invT + activation_units[470] * fwd_Ea[470] * invT2;
     /* reverse */
     phi_r = sc[28]*sc[53];
-    Kc = exp(g_RT[12] - g_RT[28] - g_RT[53] + g_RT[69]);
+    Kc = Kc_s[470];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[69]) + (h_RT[28] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -66482,12 +63250,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[69]*sc[69];
-    k_f = prefactor_units[471] * fwd_A[471]
-                * exp(fwd_beta[471] * tc[0] - activation_units[471] * fwd_Ea[471] * invT);
+    k_f = k_f_s[471];
     dlnkfdT = fwd_beta[471] * invT + activation_units[471] * fwd_Ea[471] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[67];
-    Kc = exp(-g_RT[14] - g_RT[67] + g_RT[69] + g_RT[69]);
+    Kc = Kc_s[471];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[69]) + (h_RT[14] + h_RT[67]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -66522,12 +63289,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[60];
-    k_f = prefactor_units[472] * fwd_A[472]
-                * exp(fwd_beta[472] * tc[0] - activation_units[472] * fwd_Ea[472] * invT);
+    k_f = k_f_s[472];
     dlnkfdT = fwd_beta[472] * invT + activation_units[472] * fwd_Ea[472] * invT2;
     /* reverse */
     phi_r = sc[24]*sc[53];
-    Kc = exp(g_RT[12] - g_RT[24] - g_RT[53] + g_RT[60]);
+    Kc = Kc_s[472];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[60]) + (h_RT[24] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -66573,12 +63339,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[56];
-    k_f = prefactor_units[473] * fwd_A[473]
-                * exp(fwd_beta[473] * tc[0] - activation_units[473] * fwd_Ea[473] * invT);
+    k_f = k_f_s[473];
     dlnkfdT = fwd_beta[473] * invT + activation_units[473] * fwd_Ea[473] * invT2;
     /* reverse */
     phi_r = sc[24]*sc[53];
-    Kc = exp(g_RT[11] - g_RT[24] - g_RT[53] + g_RT[56]);
+    Kc = Kc_s[473];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[56]) + (h_RT[24] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -66624,12 +63389,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[63];
-    k_f = prefactor_units[474] * fwd_A[474]
-                * exp(fwd_beta[474] * tc[0] - activation_units[474] * fwd_Ea[474] * invT);
+    k_f = k_f_s[474];
     dlnkfdT = fwd_beta[474] * invT + activation_units[474] * fwd_Ea[474] * invT2;
     /* reverse */
     phi_r = sc[24]*sc[53];
-    Kc = exp(g_RT[13] - g_RT[24] - g_RT[53] + g_RT[63]);
+    Kc = Kc_s[474];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13] + h_RT[63]) + (h_RT[24] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -66675,12 +63439,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[60];
-    k_f = prefactor_units[475] * fwd_A[475]
-                * exp(fwd_beta[475] * tc[0] - activation_units[475] * fwd_Ea[475] * invT);
+    k_f = k_f_s[475];
     dlnkfdT = fwd_beta[475] * invT + activation_units[475] * fwd_Ea[475] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[63];
-    Kc = exp(g_RT[12] - g_RT[13] + g_RT[60] - g_RT[63]);
+    Kc = Kc_s[475];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[60]) + (h_RT[13] + h_RT[63]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -66726,12 +63489,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[60]*sc[60];
-    k_f = prefactor_units[476] * fwd_A[476]
-                * exp(fwd_beta[476] * tc[0] - activation_units[476] * fwd_Ea[476] * invT);
+    k_f = k_f_s[476];
     dlnkfdT = fwd_beta[476] * invT + activation_units[476] * fwd_Ea[476] * invT2;
     /* reverse */
     phi_r = sc[56]*sc[63];
-    Kc = exp(-g_RT[56] + g_RT[60] + g_RT[60] - g_RT[63]);
+    Kc = Kc_s[476];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[60]) + (h_RT[56] + h_RT[63]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -66766,12 +63528,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[60]*sc[61];
-    k_f = prefactor_units[477] * fwd_A[477]
-                * exp(fwd_beta[477] * tc[0] - activation_units[477] * fwd_Ea[477] * invT);
+    k_f = k_f_s[477];
     dlnkfdT = fwd_beta[477] * invT + activation_units[477] * fwd_Ea[477] * invT2;
     /* reverse */
     phi_r = sc[57]*sc[63];
-    Kc = exp(-g_RT[57] + g_RT[60] + g_RT[61] - g_RT[63]);
+    Kc = Kc_s[477];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[60] + h_RT[61]) + (h_RT[57] + h_RT[63]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -66817,12 +63578,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[60]*sc[62];
-    k_f = prefactor_units[478] * fwd_A[478]
-                * exp(fwd_beta[478] * tc[0] - activation_units[478] * fwd_Ea[478] * invT);
+    k_f = k_f_s[478];
     dlnkfdT = fwd_beta[478] * invT + activation_units[478] * fwd_Ea[478] * invT2;
     /* reverse */
     phi_r = sc[58]*sc[63];
-    Kc = exp(-g_RT[58] + g_RT[60] + g_RT[62] - g_RT[63]);
+    Kc = Kc_s[478];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[60] + h_RT[62]) + (h_RT[58] + h_RT[63]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -66868,12 +63628,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[61];
-    k_f = prefactor_units[479] * fwd_A[479]
-                * exp(fwd_beta[479] * tc[0] - activation_units[479] * fwd_Ea[479] * invT);
+    k_f = k_f_s[479];
     dlnkfdT = fwd_beta[479] * invT + activation_units[479] * fwd_Ea[479] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[64];
-    Kc = exp(g_RT[12] - g_RT[13] + g_RT[61] - g_RT[64]);
+    Kc = Kc_s[479];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[61]) + (h_RT[13] + h_RT[64]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -66919,12 +63678,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[60]*sc[61];
-    k_f = prefactor_units[480] * fwd_A[480]
-                * exp(fwd_beta[480] * tc[0] - activation_units[480] * fwd_Ea[480] * invT);
+    k_f = k_f_s[480];
     dlnkfdT = fwd_beta[480] * invT + activation_units[480] * fwd_Ea[480] * invT2;
     /* reverse */
     phi_r = sc[56]*sc[64];
-    Kc = exp(-g_RT[56] + g_RT[60] + g_RT[61] - g_RT[64]);
+    Kc = Kc_s[480];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[60] + h_RT[61]) + (h_RT[56] + h_RT[64]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -66970,12 +63728,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[61]*sc[61];
-    k_f = prefactor_units[481] * fwd_A[481]
-                * exp(fwd_beta[481] * tc[0] - activation_units[481] * fwd_Ea[481] * invT);
+    k_f = k_f_s[481];
     dlnkfdT = fwd_beta[481] * invT + activation_units[481] * fwd_Ea[481] * invT2;
     /* reverse */
     phi_r = sc[57]*sc[64];
-    Kc = exp(-g_RT[57] + g_RT[61] + g_RT[61] - g_RT[64]);
+    Kc = Kc_s[481];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[61]) + (h_RT[57] + h_RT[64]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -67010,12 +63767,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[61]*sc[62];
-    k_f = prefactor_units[482] * fwd_A[482]
-                * exp(fwd_beta[482] * tc[0] - activation_units[482] * fwd_Ea[482] * invT);
+    k_f = k_f_s[482];
     dlnkfdT = fwd_beta[482] * invT + activation_units[482] * fwd_Ea[482] * invT2;
     /* reverse */
     phi_r = sc[58]*sc[64];
-    Kc = exp(-g_RT[58] + g_RT[61] + g_RT[62] - g_RT[64]);
+    Kc = Kc_s[482];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[61] + h_RT[62]) + (h_RT[58] + h_RT[64]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -67061,12 +63817,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[63];
-    k_f = prefactor_units[483] * fwd_A[483]
-                * exp(fwd_beta[483] * tc[0] - activation_units[483] * fwd_Ea[483] * invT);
+    k_f = k_f_s[483];
     dlnkfdT = fwd_beta[483] * invT + activation_units[483] * fwd_Ea[483] * invT2;
     /* reverse */
     phi_r = sc[22]*sc[53];
-    Kc = exp(g_RT[11] - g_RT[22] - g_RT[53] + g_RT[63]);
+    Kc = Kc_s[483];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[63]) + (h_RT[22] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -67112,12 +63867,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[60];
-    k_f = prefactor_units[484] * fwd_A[484]
-                * exp(fwd_beta[484] * tc[0] - activation_units[484] * fwd_Ea[484] * invT);
+    k_f = k_f_s[484];
     dlnkfdT = fwd_beta[484] * invT + activation_units[484] * fwd_Ea[484] * invT2;
     /* reverse */
     phi_r = sc[24]*sc[54];
-    Kc = exp(g_RT[10] - g_RT[24] - g_RT[54] + g_RT[60]);
+    Kc = Kc_s[484];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[60]) + (h_RT[24] + h_RT[54]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -67163,12 +63917,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[60];
-    k_f = prefactor_units[485] * fwd_A[485]
-                * exp(fwd_beta[485] * tc[0] - activation_units[485] * fwd_Ea[485] * invT);
+    k_f = k_f_s[485];
     dlnkfdT = fwd_beta[485] * invT + activation_units[485] * fwd_Ea[485] * invT2;
     /* reverse */
     phi_r = sc[24]*sc[54];
-    Kc = exp(g_RT[11] - g_RT[24] - g_RT[54] + g_RT[60]);
+    Kc = Kc_s[485];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[60]) + (h_RT[24] + h_RT[54]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -67214,12 +63967,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[27]*sc[54];
-    k_f = prefactor_units[486] * fwd_A[486]
-                * exp(fwd_beta[486] * tc[0] - activation_units[486] * fwd_Ea[486] * invT);
+    k_f = k_f_s[486];
     dlnkfdT = fwd_beta[486] * invT + activation_units[486] * fwd_Ea[486] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[63];
-    Kc = exp(-g_RT[14] + g_RT[27] + g_RT[54] - g_RT[63]);
+    Kc = Kc_s[486];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[27] + h_RT[54]) + (h_RT[14] + h_RT[63]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -67265,12 +64017,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[54];
-    k_f = prefactor_units[487] * fwd_A[487]
-                * exp(fwd_beta[487] * tc[0] - activation_units[487] * fwd_Ea[487] * invT);
+    k_f = k_f_s[487];
     dlnkfdT = fwd_beta[487] * invT + activation_units[487] * fwd_Ea[487] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[53];
-    Kc = exp(-g_RT[12] + g_RT[13] - g_RT[53] + g_RT[54]);
+    Kc = Kc_s[487];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13] + h_RT[54]) + (h_RT[12] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -67316,12 +64067,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[54]*sc[56];
-    k_f = prefactor_units[488] * fwd_A[488]
-                * exp(fwd_beta[488] * tc[0] - activation_units[488] * fwd_Ea[488] * invT);
+    k_f = k_f_s[488];
     dlnkfdT = fwd_beta[488] * invT + activation_units[488] * fwd_Ea[488] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[60];
-    Kc = exp(-g_RT[53] + g_RT[54] + g_RT[56] - g_RT[60]);
+    Kc = Kc_s[488];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[54] + h_RT[56]) + (h_RT[53] + h_RT[60]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -67367,12 +64117,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[54]*sc[57];
-    k_f = prefactor_units[489] * fwd_A[489]
-                * exp(fwd_beta[489] * tc[0] - activation_units[489] * fwd_Ea[489] * invT);
+    k_f = k_f_s[489];
     dlnkfdT = fwd_beta[489] * invT + activation_units[489] * fwd_Ea[489] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[61];
-    Kc = exp(-g_RT[53] + g_RT[54] + g_RT[57] - g_RT[61]);
+    Kc = Kc_s[489];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[54] + h_RT[57]) + (h_RT[53] + h_RT[61]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -67418,12 +64167,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[54]*sc[58];
-    k_f = prefactor_units[490] * fwd_A[490]
-                * exp(fwd_beta[490] * tc[0] - activation_units[490] * fwd_Ea[490] * invT);
+    k_f = k_f_s[490];
     dlnkfdT = fwd_beta[490] * invT + activation_units[490] * fwd_Ea[490] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[62];
-    Kc = exp(-g_RT[53] + g_RT[54] + g_RT[58] - g_RT[62]);
+    Kc = Kc_s[490];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[54] + h_RT[58]) + (h_RT[53] + h_RT[62]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -67469,12 +64217,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[20]*sc[54];
-    k_f = prefactor_units[491] * fwd_A[491]
-                * exp(fwd_beta[491] * tc[0] - activation_units[491] * fwd_Ea[491] * invT);
+    k_f = k_f_s[491];
     dlnkfdT = fwd_beta[491] * invT + activation_units[491] * fwd_Ea[491] * invT2;
     /* reverse */
     phi_r = sc[19]*sc[53];
-    Kc = exp(-g_RT[19] + g_RT[20] - g_RT[53] + g_RT[54]);
+    Kc = Kc_s[491];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[20] + h_RT[54]) + (h_RT[19] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -67520,12 +64267,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[20]*sc[54];
-    k_f = prefactor_units[492] * fwd_A[492]
-                * exp(fwd_beta[492] * tc[0] - activation_units[492] * fwd_Ea[492] * invT);
+    k_f = k_f_s[492];
     dlnkfdT = fwd_beta[492] * invT + activation_units[492] * fwd_Ea[492] * invT2;
     /* reverse */
     phi_r = sc[18]*sc[53];
-    Kc = exp(-g_RT[18] + g_RT[20] - g_RT[53] + g_RT[54]);
+    Kc = Kc_s[492];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[20] + h_RT[54]) + (h_RT[18] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -67571,12 +64317,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[17]*sc[54];
-    k_f = prefactor_units[493] * fwd_A[493]
-                * exp(fwd_beta[493] * tc[0] - activation_units[493] * fwd_Ea[493] * invT);
+    k_f = k_f_s[493];
     dlnkfdT = fwd_beta[493] * invT + activation_units[493] * fwd_Ea[493] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[53];
-    Kc = exp(-g_RT[16] + g_RT[17] - g_RT[53] + g_RT[54]);
+    Kc = Kc_s[493];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[17] + h_RT[54]) + (h_RT[16] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -67622,12 +64367,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[54]*sc[68];
-    k_f = prefactor_units[494] * fwd_A[494]
-                * exp(fwd_beta[494] * tc[0] - activation_units[494] * fwd_Ea[494] * invT);
+    k_f = k_f_s[494];
     dlnkfdT = fwd_beta[494] * invT + activation_units[494] * fwd_Ea[494] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[69];
-    Kc = exp(-g_RT[53] + g_RT[54] + g_RT[68] - g_RT[69]);
+    Kc = Kc_s[494];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[54] + h_RT[68]) + (h_RT[53] + h_RT[69]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -67673,12 +64417,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[19]*sc[54];
-    k_f = prefactor_units[495] * fwd_A[495]
-                * exp(fwd_beta[495] * tc[0] - activation_units[495] * fwd_Ea[495] * invT);
+    k_f = k_f_s[495];
     dlnkfdT = fwd_beta[495] * invT + activation_units[495] * fwd_Ea[495] * invT2;
     /* reverse */
     phi_r = sc[17]*sc[53];
-    Kc = exp(-g_RT[17] + g_RT[19] - g_RT[53] + g_RT[54]);
+    Kc = Kc_s[495];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[19] + h_RT[54]) + (h_RT[17] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -67724,12 +64467,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[54];
-    k_f = prefactor_units[496] * fwd_A[496]
-                * exp(fwd_beta[496] * tc[0] - activation_units[496] * fwd_Ea[496] * invT);
+    k_f = k_f_s[496];
     dlnkfdT = fwd_beta[496] * invT + activation_units[496] * fwd_Ea[496] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[53];
-    Kc = exp(-g_RT[14] + g_RT[16] - g_RT[53] + g_RT[54]);
+    Kc = Kc_s[496];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[54]) + (h_RT[14] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -67775,12 +64517,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[26]*sc[54];
-    k_f = prefactor_units[497] * fwd_A[497]
-                * exp(fwd_beta[497] * tc[0] - activation_units[497] * fwd_Ea[497] * invT);
+    k_f = k_f_s[497];
     dlnkfdT = fwd_beta[497] * invT + activation_units[497] * fwd_Ea[497] * invT2;
     /* reverse */
     phi_r = sc[25]*sc[53];
-    Kc = exp(-g_RT[25] + g_RT[26] - g_RT[53] + g_RT[54]);
+    Kc = Kc_s[497];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[26] + h_RT[54]) + (h_RT[25] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -67826,12 +64567,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[24]*sc[54];
-    k_f = prefactor_units[498] * fwd_A[498]
-                * exp(fwd_beta[498] * tc[0] - activation_units[498] * fwd_Ea[498] * invT);
+    k_f = k_f_s[498];
     dlnkfdT = fwd_beta[498] * invT + activation_units[498] * fwd_Ea[498] * invT2;
     /* reverse */
     phi_r = sc[23]*sc[53];
-    Kc = exp(-g_RT[23] + g_RT[24] - g_RT[53] + g_RT[54]);
+    Kc = Kc_s[498];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[24] + h_RT[54]) + (h_RT[23] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -67877,12 +64617,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[23]*sc[54];
-    k_f = prefactor_units[499] * fwd_A[499]
-                * exp(fwd_beta[499] * tc[0] - activation_units[499] * fwd_Ea[499] * invT);
+    k_f = k_f_s[499];
     dlnkfdT = fwd_beta[499] * invT + activation_units[499] * fwd_Ea[499] * invT2;
     /* reverse */
     phi_r = sc[22]*sc[53];
-    Kc = exp(-g_RT[22] + g_RT[23] - g_RT[53] + g_RT[54]);
+    Kc = Kc_s[499];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[23] + h_RT[54]) + (h_RT[22] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -67928,12 +64667,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[59];
-    k_f = prefactor_units[500] * fwd_A[500]
-                * exp(fwd_beta[500] * tc[0] - activation_units[500] * fwd_Ea[500] * invT);
+    k_f = k_f_s[500];
     dlnkfdT = fwd_beta[500] * invT + activation_units[500] * fwd_Ea[500] * invT2;
     /* reverse */
     phi_r = sc[56]*sc[62];
-    Kc = exp(g_RT[12] - g_RT[56] + g_RT[59] - g_RT[62]);
+    Kc = Kc_s[500];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[59]) + (h_RT[56] + h_RT[62]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -67979,12 +64717,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[14]*sc[66];
-    k_f = prefactor_units[501] * fwd_A[501]
-                * exp(fwd_beta[501] * tc[0] - activation_units[501] * fwd_Ea[501] * invT);
+    k_f = k_f_s[501];
     dlnkfdT = fwd_beta[501] * invT + activation_units[501] * fwd_Ea[501] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[62];
-    Kc = exp(g_RT[14] - g_RT[15] - g_RT[62] + g_RT[66]);
+    Kc = Kc_s[501];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[14] + h_RT[66]) + (h_RT[15] + h_RT[62]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -68030,12 +64767,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[64]*sc[69];
-    k_f = prefactor_units[502] * fwd_A[502]
-                * exp(fwd_beta[502] * tc[0] - activation_units[502] * fwd_Ea[502] * invT);
+    k_f = k_f_s[502];
     dlnkfdT = fwd_beta[502] * invT + activation_units[502] * fwd_Ea[502] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[62];
-    Kc = exp(-g_RT[14] - g_RT[62] + g_RT[64] + g_RT[69]);
+    Kc = Kc_s[502];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[64] + h_RT[69]) + (h_RT[14] + h_RT[62]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -68081,12 +64817,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[55];
-    k_f = prefactor_units[503] * fwd_A[503]
-                * exp(fwd_beta[503] * tc[0] - activation_units[503] * fwd_Ea[503] * invT);
+    k_f = k_f_s[503];
     dlnkfdT = fwd_beta[503] * invT + activation_units[503] * fwd_Ea[503] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[54];
-    Kc = exp(g_RT[1] - g_RT[53] - g_RT[54] + g_RT[55]);
+    Kc = Kc_s[503];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[55]) + (h_RT[53] + h_RT[54]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -68132,12 +64867,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[55]*sc[62];
-    k_f = prefactor_units[504] * fwd_A[504]
-                * exp(fwd_beta[504] * tc[0] - activation_units[504] * fwd_Ea[504] * invT);
+    k_f = k_f_s[504];
     dlnkfdT = fwd_beta[504] * invT + activation_units[504] * fwd_Ea[504] * invT2;
     /* reverse */
     phi_r = sc[54]*sc[59];
-    Kc = exp(-g_RT[54] + g_RT[55] - g_RT[59] + g_RT[62]);
+    Kc = Kc_s[504];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[55] + h_RT[62]) + (h_RT[54] + h_RT[59]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -68183,12 +64917,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[55];
-    k_f = prefactor_units[505] * fwd_A[505]
-                * exp(fwd_beta[505] * tc[0] - activation_units[505] * fwd_Ea[505] * invT);
+    k_f = k_f_s[505];
     dlnkfdT = fwd_beta[505] * invT + activation_units[505] * fwd_Ea[505] * invT2;
     /* reverse */
     phi_r = sc[54]*sc[56];
-    Kc = exp(g_RT[12] - g_RT[54] + g_RT[55] - g_RT[56]);
+    Kc = Kc_s[505];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[55]) + (h_RT[54] + h_RT[56]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -68234,12 +64967,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[55]*sc[64];
-    k_f = prefactor_units[506] * fwd_A[506]
-                * exp(fwd_beta[506] * tc[0] - activation_units[506] * fwd_Ea[506] * invT);
+    k_f = k_f_s[506];
     dlnkfdT = fwd_beta[506] * invT + activation_units[506] * fwd_Ea[506] * invT2;
     /* reverse */
     phi_r = sc[54]*sc[62];
-    Kc = exp(-g_RT[54] + g_RT[55] - g_RT[62] + g_RT[64]);
+    Kc = Kc_s[506];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[55] + h_RT[64]) + (h_RT[54] + h_RT[62]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -68285,12 +65017,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[55]*sc[69];
-    k_f = prefactor_units[507] * fwd_A[507]
-                * exp(fwd_beta[507] * tc[0] - activation_units[507] * fwd_Ea[507] * invT);
+    k_f = k_f_s[507];
     dlnkfdT = fwd_beta[507] * invT + activation_units[507] * fwd_Ea[507] * invT2;
     /* reverse */
     phi_r = sc[54]*sc[67];
-    Kc = exp(-g_RT[54] + g_RT[55] - g_RT[67] + g_RT[69]);
+    Kc = Kc_s[507];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[55] + h_RT[69]) + (h_RT[54] + h_RT[67]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -68336,12 +65067,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[55];
-    k_f = prefactor_units[508] * fwd_A[508]
-                * exp(fwd_beta[508] * tc[0] - activation_units[508] * fwd_Ea[508] * invT);
+    k_f = k_f_s[508];
     dlnkfdT = fwd_beta[508] * invT + activation_units[508] * fwd_Ea[508] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[53]*sc[54];
-    Kc = refC * exp(g_RT[0] - g_RT[1] - g_RT[53] - g_RT[54] + g_RT[55]);
+    Kc = Kc_s[508];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[55]) + (h_RT[1] + h_RT[53] + h_RT[54]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -68400,12 +65130,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[14]*sc[55];
-    k_f = prefactor_units[509] * fwd_A[509]
-                * exp(fwd_beta[509] * tc[0] - activation_units[509] * fwd_Ea[509] * invT);
+    k_f = k_f_s[509];
     dlnkfdT = fwd_beta[509] * invT + activation_units[509] * fwd_Ea[509] * invT2;
     /* reverse */
     phi_r = sc[54]*sc[69];
-    Kc = exp(g_RT[14] - g_RT[54] + g_RT[55] - g_RT[69]);
+    Kc = Kc_s[509];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[14] + h_RT[55]) + (h_RT[54] + h_RT[69]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -68451,12 +65180,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[55];
-    k_f = prefactor_units[510] * fwd_A[510]
-                * exp(fwd_beta[510] * tc[0] - activation_units[510] * fwd_Ea[510] * invT);
+    k_f = k_f_s[510];
     dlnkfdT = fwd_beta[510] * invT + activation_units[510] * fwd_Ea[510] * invT2;
     /* reverse */
     phi_r = sc[54]*sc[65];
-    Kc = exp(g_RT[8] - g_RT[54] + g_RT[55] - g_RT[65]);
+    Kc = Kc_s[510];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[55]) + (h_RT[54] + h_RT[65]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -68502,12 +65230,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[55]*sc[65];
-    k_f = prefactor_units[511] * fwd_A[511]
-                * exp(fwd_beta[511] * tc[0] - activation_units[511] * fwd_Ea[511] * invT);
+    k_f = k_f_s[511];
     dlnkfdT = fwd_beta[511] * invT + activation_units[511] * fwd_Ea[511] * invT2;
     /* reverse */
     phi_r = sc[54]*sc[64];
-    Kc = exp(-g_RT[54] + g_RT[55] - g_RT[64] + g_RT[65]);
+    Kc = Kc_s[511];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[55] + h_RT[65]) + (h_RT[54] + h_RT[64]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -68553,12 +65280,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[55];
-    k_f = prefactor_units[512] * fwd_A[512]
-                * exp(fwd_beta[512] * tc[0] - activation_units[512] * fwd_Ea[512] * invT);
+    k_f = k_f_s[512];
     dlnkfdT = fwd_beta[512] * invT + activation_units[512] * fwd_Ea[512] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[53]*sc[54];
-    Kc = refC * exp(-g_RT[12] + g_RT[13] - g_RT[53] - g_RT[54] + g_RT[55]);
+    Kc = Kc_s[512];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13] + h_RT[55]) + (h_RT[12] + h_RT[53] + h_RT[54]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -68617,12 +65343,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[55];
-    k_f = prefactor_units[513] * fwd_A[513]
-                * exp(fwd_beta[513] * tc[0] - activation_units[513] * fwd_Ea[513] * invT);
+    k_f = k_f_s[513];
     dlnkfdT = fwd_beta[513] * invT + activation_units[513] * fwd_Ea[513] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[53]*sc[54];
-    Kc = refC * exp(-g_RT[2] + g_RT[4] - g_RT[53] - g_RT[54] + g_RT[55]);
+    Kc = Kc_s[513];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[55]) + (h_RT[2] + h_RT[53] + h_RT[54]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -68681,12 +65406,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[50]*sc[54];
-    k_f = prefactor_units[514] * fwd_A[514]
-                * exp(fwd_beta[514] * tc[0] - activation_units[514] * fwd_Ea[514] * invT);
+    k_f = k_f_s[514];
     dlnkfdT = fwd_beta[514] * invT + activation_units[514] * fwd_Ea[514] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[71];
-    Kc = exp(g_RT[50] - g_RT[53] + g_RT[54] - g_RT[71]);
+    Kc = Kc_s[514];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[50] + h_RT[54]) + (h_RT[53] + h_RT[71]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -68732,12 +65456,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[50]*sc[54];
-    k_f = prefactor_units[515] * fwd_A[515]
-                * exp(fwd_beta[515] * tc[0] - activation_units[515] * fwd_Ea[515] * invT);
+    k_f = k_f_s[515];
     dlnkfdT = fwd_beta[515] * invT + activation_units[515] * fwd_Ea[515] * invT2;
     /* reverse */
     phi_r = sc[53]*sc[70];
-    Kc = exp(g_RT[50] - g_RT[53] + g_RT[54] - g_RT[70]);
+    Kc = Kc_s[515];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[50] + h_RT[54]) + (h_RT[53] + h_RT[70]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -68783,12 +65506,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[50]*sc[62];
-    k_f = prefactor_units[516] * fwd_A[516]
-                * exp(fwd_beta[516] * tc[0] - activation_units[516] * fwd_Ea[516] * invT);
+    k_f = k_f_s[516];
     dlnkfdT = fwd_beta[516] * invT + activation_units[516] * fwd_Ea[516] * invT2;
     /* reverse */
     phi_r = sc[58]*sc[71];
-    Kc = exp(g_RT[50] - g_RT[58] + g_RT[62] - g_RT[71]);
+    Kc = Kc_s[516];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[50] + h_RT[62]) + (h_RT[58] + h_RT[71]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -68834,12 +65556,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[50]*sc[62];
-    k_f = prefactor_units[517] * fwd_A[517]
-                * exp(fwd_beta[517] * tc[0] - activation_units[517] * fwd_Ea[517] * invT);
+    k_f = k_f_s[517];
     dlnkfdT = fwd_beta[517] * invT + activation_units[517] * fwd_Ea[517] * invT2;
     /* reverse */
     phi_r = sc[58]*sc[70];
-    Kc = exp(g_RT[50] - g_RT[58] + g_RT[62] - g_RT[70]);
+    Kc = Kc_s[517];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[50] + h_RT[62]) + (h_RT[58] + h_RT[70]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -68893,6 +65614,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         dcvpRdT(dcRdT, tc);
         speciesInternalEnergy(e_RT, tc);
         eh_RT = &e_RT[0];
+        for (int k=0; k<72; k++) {
+            for (int m=0; m<72; m++) {
+                J[k*73+m] += Jmix[m];
+            }
+        }
     }
 
     double cmix = 0.0, ehmix = 0.0, dcmixdT=0.0, dehmixdT=0.0;
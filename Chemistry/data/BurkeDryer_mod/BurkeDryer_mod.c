@@ -1,5 +1,6 @@
 
 #include <math.h>
+#include <float.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -86,6 +87,12 @@
 #define VCKPY VCKPY
 #define VCKWYR VCKWYR
 #define VCKYTX VCKYTX
+#define VCKCPBS VCKCPBS
+#define VCKCVBS VCKCVBS
+#define VCKHBMS VCKHBMS
+#define VCKUBMS VCKUBMS
+#define VCKRHOY VCKRHOY
+#define VCKMMWY VCKMMWY
 #define GET_T_GIVEN_EY GET_T_GIVEN_EY
 #define GET_T_GIVEN_HY GET_T_GIVEN_HY
 #define GET_REACTION_MAP GET_REACTION_MAP
@@ -171,6 +178,12 @@
 #define VCKPY vckpy
 #define VCKWYR vckwyr
 #define VCKYTX vckytx
+#define VCKCPBS vckcpbs
+#define VCKCVBS vckcvbs
+#define VCKHBMS vckhbms
+#define VCKUBMS vckubms
+#define VCKRHOY vckrhoy
+#define VCKMMWY vckmmwy
 #define GET_T_GIVEN_EY get_t_given_ey
 #define GET_T_GIVEN_HY get_t_given_hy
 #define GET_REACTION_MAP get_reaction_map
@@ -256,6 +269,12 @@
 #define VCKPY vckpy_
 #define VCKWYR vckwyr_
 #define VCKYTX vckytx_
+#define VCKCPBS vckcpbs_
+#define VCKCVBS vckcvbs_
+#define VCKHBMS vckhbms_
+#define VCKUBMS vckubms_
+#define VCKRHOY vckrhoy_
+#define VCKMMWY vckmmwy_
 #define GET_T_GIVEN_EY get_t_given_ey_
 #define GET_T_GIVEN_HY get_t_given_hy_
 #define GET_REACTION_MAP get_reaction_map_
@@ -369,6 +388,12 @@ void VCKWYR(int * restrict np, double * restrict rho, double * restrict T,
             double * restrict y, int * restrict iwrk, double * restrict rwrk,
             double * restrict wdot);
 void VCKYTX(int * restrict np, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict x);
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs);
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs);
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms);
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms);
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho);
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm);
 void vcomp_k_f(int npt, double * restrict k_f_s, double * restrict tc, double * restrict invT);
 void vcomp_gibbs(int npt, double * restrict g_RT, double * restrict tc);
 void vcomp_Kc(int npt, double * restrict Kc_s, double * restrict g_RT, double * restrict invT);
@@ -1261,6 +1286,28 @@ void CKRHOY(double * restrict P, double * restrict T, double * restrict y, int *
 }
 
 
+/*Compute rho = P*W(y)/RT */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho)
+{
+    for (int i=0; i<(*np); i++) {
+        rho[i] = 0.0;
+    }
+
+    for (int n=0; n<11; n++) {
+        for (int i=0; i<(*np); i++) {
+            rho[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        rho[i] = P[i] / (8.31451e+07 * T[i] * rho[i]);/*rho = P*W/(R*T) */
+    }
+
+    return;
+}
+
+
 /*Compute rho = P*W(c)/(R*T) */
 void CKRHOC(double * restrict P, double * restrict T, double * restrict c, int * iwrk, double * restrict rwrk, double * restrict rho)
 {
@@ -1324,6 +1371,29 @@ void CKMMWY(double * restrict y, int * iwrk, double * restrict rwrk, double * re
 }
 
 
+/*given y[species]: mass fractions */
+/*returns mean molecular weight (gm/mole) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm)
+{
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 0.0;
+    }
+
+    for (int n=0; n<11; n++) {
+        for (int i=0; i<(*np); i++) {
+            wtm[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 1.0 / wtm[i];
+    }
+
+    return;
+}
+
+
 /*given x[species]: mole fractions */
 /*returns mean molecular weight (gm/mole) */
 void CKMMWX(double * restrict x, int * iwrk, double * restrict rwrk, double * restrict wtm)
@@ -1941,6 +2011,30 @@ void CKCPBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CP (Eq. 34) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs)
+{
+    double tc[5], tmp[11], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cp_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<11; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cpbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean specific heat at CV (Eq. 35) */
 void CKCVBL(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict cvbl)
 {
@@ -1985,6 +2079,30 @@ void CKCVBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CV (Eq. 36) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs)
+{
+    double tc[5], tmp[11], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cv_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<11; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cvbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean enthalpy of the mixture in molar units */
 void CKHBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict hbml)
 {
@@ -2026,6 +2144,30 @@ void CKHBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns mean enthalpy of mixture in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms)
+{
+    double tc[5], tmp[11], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesEnthalpy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<11; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        hbms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mean internal energy in molar units */
 void CKUBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict ubml)
 {
@@ -2072,6 +2214,30 @@ void CKUBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*get mean internal energy in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms)
+{
+    double tc[5], tmp[11], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesInternalEnergy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<11; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        ubms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mixture entropy in molar units */
 void CKSBML(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict sbml)
 {
@@ -3643,12 +3809,51 @@ void productionRate(double * restrict wdot, double * restrict sc, double T)
 
 void comp_k_f(double * restrict tc, double invT, double * restrict k_f)
 {
+    double x[29];
+#ifdef __INTEL_COMPILER
+    #pragma simd
+#endif
+    for (int i=0; i<29; ++i) {
+        x[i] = fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT;
+    };
+
+    /*the exp is skipped when the exponent is zero or that of */
+    /*an earlier reaction with the same default beta and Ea */
+    k_f[0] = exp(x[0]);
+    k_f[1] = exp(x[1]);
+    k_f[2] = exp(x[2]);
+    k_f[3] = exp(x[3]);
+    k_f[4] = exp(x[4]);
+    k_f[5] = exp(x[5]);
+    k_f[6] = (x[6] == 0.0 ? 1.0 : exp(x[6]));
+    k_f[7] = exp(x[7]);
+    k_f[8] = exp(x[8]);
+    k_f[9] = exp(x[9]);
+    k_f[10] = exp(x[10]);
+    k_f[11] = exp(x[11]);
+    k_f[12] = exp(x[12]);
+    k_f[13] = (x[13] == x[12] ? k_f[12] : exp(x[13]));
+    k_f[14] = exp(x[14]);
+    k_f[15] = (x[15] == x[14] ? k_f[14] : exp(x[15]));
+    k_f[16] = exp(x[16]);
+    k_f[17] = exp(x[17]);
+    k_f[18] = exp(x[18]);
+    k_f[19] = exp(x[19]);
+    k_f[20] = exp(x[20]);
+    k_f[21] = exp(x[21]);
+    k_f[22] = exp(x[22]);
+    k_f[23] = exp(x[23]);
+    k_f[24] = exp(x[24]);
+    k_f[25] = exp(x[25]);
+    k_f[26] = exp(x[26]);
+    k_f[27] = exp(x[27]);
+    k_f[28] = exp(x[28]);
+
 #ifdef __INTEL_COMPILER
     #pragma simd
 #endif
     for (int i=0; i<29; ++i) {
-        k_f[i] = prefactor_units[i] * fwd_A[i]
-                    * exp(fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT);
+        k_f[i] *= prefactor_units[i] * fwd_A[i];
     };
     return;
 }
@@ -3659,59 +3864,101 @@ void comp_Kc(double * restrict tc, double invT, double * restrict Kc)
     double g_RT[11];
     gibbs(g_RT, tc);
 
-    Kc[0] = g_RT[0] + g_RT[5] - g_RT[6];
-    Kc[1] = -g_RT[3] - g_RT[3] + g_RT[7];
-    Kc[2] = -g_RT[0] - g_RT[0] + g_RT[1];
-    Kc[3] = g_RT[2] + g_RT[2] - g_RT[5];
-    Kc[4] = g_RT[0] + g_RT[2] - g_RT[3];
-    Kc[5] = -g_RT[0] - g_RT[3] + g_RT[4];
-    Kc[6] = g_RT[2] + g_RT[3] - g_RT[6];
-    Kc[7] = g_RT[0] - g_RT[2] - g_RT[3] + g_RT[5];
-    Kc[8] = -g_RT[0] + g_RT[1] + g_RT[2] - g_RT[3];
-    Kc[9] = -g_RT[0] + g_RT[1] + g_RT[2] - g_RT[3];
-    Kc[10] = -g_RT[0] + g_RT[1] + g_RT[3] - g_RT[4];
-    Kc[11] = -g_RT[2] + g_RT[3] + g_RT[3] - g_RT[4];
-    Kc[12] = -g_RT[0] - g_RT[0] + g_RT[1] + g_RT[9] - g_RT[9];
-    Kc[13] = -g_RT[0] - g_RT[0] + g_RT[1] + g_RT[10] - g_RT[10];
-    Kc[14] = g_RT[2] + g_RT[2] - g_RT[5] + g_RT[9] - g_RT[9];
-    Kc[15] = g_RT[2] + g_RT[2] - g_RT[5] + g_RT[10] - g_RT[10];
-    Kc[16] = -g_RT[0] - g_RT[3] + g_RT[4] + g_RT[4] - g_RT[4];
-    Kc[17] = g_RT[0] - g_RT[1] - g_RT[5] + g_RT[6];
-    Kc[18] = g_RT[0] - g_RT[3] - g_RT[3] + g_RT[6];
-    Kc[19] = g_RT[2] - g_RT[3] - g_RT[5] + g_RT[6];
-    Kc[20] = g_RT[3] - g_RT[4] - g_RT[5] + g_RT[6];
-    Kc[21] = -g_RT[5] + g_RT[6] + g_RT[6] - g_RT[7];
-    Kc[22] = -g_RT[5] + g_RT[6] + g_RT[6] - g_RT[7];
-    Kc[23] = g_RT[0] - g_RT[3] - g_RT[4] + g_RT[7];
-    Kc[24] = g_RT[0] - g_RT[1] - g_RT[6] + g_RT[7];
-    Kc[25] = g_RT[2] - g_RT[3] - g_RT[6] + g_RT[7];
-    Kc[26] = g_RT[3] - g_RT[4] - g_RT[6] + g_RT[7];
-    Kc[27] = g_RT[3] - g_RT[4] - g_RT[6] + g_RT[7];
-    Kc[28] = g_RT[0] - g_RT[2] - g_RT[4] + g_RT[6];
-
-#ifdef __INTEL_COMPILER
-     #pragma simd
-#endif
-    for (int i=0; i<29; ++i) {
-        Kc[i] = exp(Kc[i]);
-    };
-
     /*reference concentration: P_atm / (RT) in inverse mol/m^3 */
     double refC = 101325 / 8.31451 * invT;
     double refCinv = 1 / refC;
 
-    Kc[0] *= refCinv;
-    Kc[1] *= refC;
-    Kc[2] *= refC;
-    Kc[3] *= refCinv;
-    Kc[4] *= refCinv;
-    Kc[5] *= refC;
-    Kc[6] *= refCinv;
-    Kc[12] *= refC;
-    Kc[13] *= refC;
-    Kc[14] *= refCinv;
-    Kc[15] *= refCinv;
-    Kc[16] *= refC;
+    /*Kc as the ratio of the products of the species exp(g_RT)/refC, unless */
+    /*the product over a side of a reaction leaves the normal range */
+    double e_g[11], den[29];
+    for (int k=0; k<11; ++k) {
+        e_g[k] = exp(g_RT[k]) * refCinv;
+    }
+    Kc[0] = e_g[0]*e_g[5]; den[0] = e_g[6];
+    Kc[1] = e_g[7]; den[1] = e_g[3]*e_g[3];
+    Kc[2] = e_g[1]; den[2] = e_g[0]*e_g[0];
+    Kc[3] = e_g[2]*e_g[2]; den[3] = e_g[5];
+    Kc[4] = e_g[0]*e_g[2]; den[4] = e_g[3];
+    Kc[5] = e_g[4]; den[5] = e_g[0]*e_g[3];
+    Kc[6] = e_g[2]*e_g[3]; den[6] = e_g[6];
+    Kc[7] = e_g[0]*e_g[5]; den[7] = e_g[2]*e_g[3];
+    Kc[8] = e_g[1]*e_g[2]; den[8] = e_g[0]*e_g[3];
+    Kc[9] = e_g[1]*e_g[2]; den[9] = e_g[0]*e_g[3];
+    Kc[10] = e_g[1]*e_g[3]; den[10] = e_g[0]*e_g[4];
+    Kc[11] = e_g[3]*e_g[3]; den[11] = e_g[2]*e_g[4];
+    Kc[12] = e_g[1]*e_g[9]; den[12] = e_g[0]*e_g[0]*e_g[9];
+    Kc[13] = e_g[1]*e_g[10]; den[13] = e_g[0]*e_g[0]*e_g[10];
+    Kc[14] = e_g[2]*e_g[2]*e_g[9]; den[14] = e_g[5]*e_g[9];
+    Kc[15] = e_g[2]*e_g[2]*e_g[10]; den[15] = e_g[5]*e_g[10];
+    Kc[16] = e_g[4]*e_g[4]; den[16] = e_g[0]*e_g[3]*e_g[4];
+    Kc[17] = e_g[0]*e_g[6]; den[17] = e_g[1]*e_g[5];
+    Kc[18] = e_g[0]*e_g[6]; den[18] = e_g[3]*e_g[3];
+    Kc[19] = e_g[2]*e_g[6]; den[19] = e_g[3]*e_g[5];
+    Kc[20] = e_g[3]*e_g[6]; den[20] = e_g[4]*e_g[5];
+    Kc[21] = e_g[6]*e_g[6]; den[21] = e_g[5]*e_g[7];
+    Kc[22] = e_g[6]*e_g[6]; den[22] = e_g[5]*e_g[7];
+    Kc[23] = e_g[0]*e_g[7]; den[23] = e_g[3]*e_g[4];
+    Kc[24] = e_g[0]*e_g[7]; den[24] = e_g[1]*e_g[6];
+    Kc[25] = e_g[2]*e_g[7]; den[25] = e_g[3]*e_g[6];
+    Kc[26] = e_g[3]*e_g[7]; den[26] = e_g[4]*e_g[6];
+    Kc[27] = e_g[3]*e_g[7]; den[27] = e_g[4]*e_g[6];
+    Kc[28] = e_g[0]*e_g[6]; den[28] = e_g[2]*e_g[4];
+    int inrange = 1;
+    for (int i=0; i<29; ++i) {
+        inrange &= Kc[i] >= DBL_MIN && Kc[i] <= DBL_MAX && den[i] >= DBL_MIN && den[i] <= DBL_MAX;
+    }
+
+    if (inrange) {
+        for (int i=0; i<29; ++i) {
+            Kc[i] /= den[i];
+        }
+    }
+    else {
+        Kc[0] = exp(g_RT[0] + g_RT[5] - g_RT[6]);
+        Kc[1] = exp(-g_RT[3] - g_RT[3] + g_RT[7]);
+        Kc[2] = exp(-g_RT[0] - g_RT[0] + g_RT[1]);
+        Kc[3] = exp(g_RT[2] + g_RT[2] - g_RT[5]);
+        Kc[4] = exp(g_RT[0] + g_RT[2] - g_RT[3]);
+        Kc[5] = exp(-g_RT[0] - g_RT[3] + g_RT[4]);
+        Kc[6] = exp(g_RT[2] + g_RT[3] - g_RT[6]);
+        Kc[7] = exp(g_RT[0] - g_RT[2] - g_RT[3] + g_RT[5]);
+        Kc[8] = exp(-g_RT[0] + g_RT[1] + g_RT[2] - g_RT[3]);
+        Kc[10] = exp(-g_RT[0] + g_RT[1] + g_RT[3] - g_RT[4]);
+        Kc[11] = exp(-g_RT[2] + g_RT[3] + g_RT[3] - g_RT[4]);
+        Kc[12] = exp(-g_RT[0] - g_RT[0] + g_RT[1] + g_RT[9] - g_RT[9]);
+        Kc[13] = exp(-g_RT[0] - g_RT[0] + g_RT[1] + g_RT[10] - g_RT[10]);
+        Kc[14] = exp(g_RT[2] + g_RT[2] - g_RT[5] + g_RT[9] - g_RT[9]);
+        Kc[15] = exp(g_RT[2] + g_RT[2] - g_RT[5] + g_RT[10] - g_RT[10]);
+        Kc[16] = exp(-g_RT[0] - g_RT[3] + g_RT[4] + g_RT[4] - g_RT[4]);
+        Kc[17] = exp(g_RT[0] - g_RT[1] - g_RT[5] + g_RT[6]);
+        Kc[18] = exp(g_RT[0] - g_RT[3] - g_RT[3] + g_RT[6]);
+        Kc[19] = exp(g_RT[2] - g_RT[3] - g_RT[5] + g_RT[6]);
+        Kc[20] = exp(g_RT[3] - g_RT[4] - g_RT[5] + g_RT[6]);
+        Kc[21] = exp(-g_RT[5] + g_RT[6] + g_RT[6] - g_RT[7]);
+        Kc[23] = exp(g_RT[0] - g_RT[3] - g_RT[4] + g_RT[7]);
+        Kc[24] = exp(g_RT[0] - g_RT[1] - g_RT[6] + g_RT[7]);
+        Kc[25] = exp(g_RT[2] - g_RT[3] - g_RT[6] + g_RT[7]);
+        Kc[26] = exp(g_RT[3] - g_RT[4] - g_RT[6] + g_RT[7]);
+        Kc[28] = exp(g_RT[0] - g_RT[2] - g_RT[4] + g_RT[6]);
+
+        /*reactions with the net stoichiometry of an earlier one */
+        Kc[9] = Kc[8];
+        Kc[22] = Kc[21];
+        Kc[27] = Kc[26];
+
+        Kc[0] *= refCinv;
+        Kc[1] *= refC;
+        Kc[2] *= refC;
+        Kc[3] *= refCinv;
+        Kc[4] *= refCinv;
+        Kc[5] *= refC;
+        Kc[6] *= refCinv;
+        Kc[12] *= refC;
+        Kc[13] *= refC;
+        Kc[14] *= refCinv;
+        Kc[15] *= refCinv;
+        Kc[16] *= refC;
+    }
 
     return;
 }
@@ -3843,6 +4090,9 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         mixture += sc[i];
     }
 
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[2][0] - 1)*sc[1] + (TB[2][1] - 1)*sc[4] + (TB[2][2] - 1)*sc[9] + (TB[2][3] - 1)*sc[10];
+
     double Corr[29];
     for (int i = 0; i < 29; ++i) {
         Corr[i] = 1.0;
@@ -3874,9 +4124,9 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
     /* simple three-body correction */
     {
         double alpha;
-        alpha = mixture + (TB[2][0] - 1)*sc[1] + (TB[2][1] - 1)*sc[4] + (TB[2][2] - 1)*sc[9] + (TB[2][3] - 1)*sc[10];
+        alpha = alpha_eff0;
         Corr[2] = alpha;
-        alpha = mixture + (TB[3][0] - 1)*sc[1] + (TB[3][1] - 1)*sc[4] + (TB[3][2] - 1)*sc[9] + (TB[3][3] - 1)*sc[10];
+        alpha = (memcmp(TB[3], TB[2], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[3][0] - 1)*sc[1] + (TB[3][1] - 1)*sc[4] + (TB[3][2] - 1)*sc[9] + (TB[3][3] - 1)*sc[10]);
         Corr[3] = alpha;
         alpha = mixture + (TB[4][0] - 1)*sc[1] + (TB[4][1] - 1)*sc[4] + (TB[4][2] - 1)*sc[9] + (TB[4][3] - 1)*sc[10];
         Corr[4] = alpha;
@@ -4544,17 +4794,24 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         mixture += sc[k];
     }
 
-    /*compute the Gibbs free energy */
-    double g_RT[11];
-    gibbs(g_RT, tc);
-
     /*compute the species enthalpy */
     double h_RT[11];
     speciesEnthalpy(h_RT, tc);
 
+    /*compute the rate and equilibrium constants */
+    double k_f_s[29], Kc_s[29];
+    comp_k_f(tc, invT, k_f_s);
+    comp_Kc(tc, invT, Kc_s);
+
+    /*at constant volume, the part of dwdot/d[X] common to all species */
+    double Jmix[11];
+    for (int k=0; k<11; k++) {
+        Jmix[k] = 0.0;
+    }
+
     double phi_f, k_f, k_r, phi_r, Kc, q, q_nocor, Corr, alpha;
     double dlnkfdT, dlnk0dT, dlnKcdT, dkrdT, dqdT;
-    double dqdci, dcdc_fac, dqdc[11];
+    double dqdci, dcdc_fac;
     double Pr, fPr, F, k_0, logPr;
     double logFcent, troe_c, troe_n, troePr_den, troePr, troe;
     double Fcent1, Fcent2, Fcent3, Fcent;
@@ -4562,6 +4819,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     double dlogPrdT, dlogfPrdT, dlogFdT, dlogFcentdT, dlogFdlogPr, dlnCorrdT;
     const double ln10 = log(10.0);
     const double log10e = 1.0/log(10.0);
+
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[2][0] - 1)*sc[1] + (TB[2][1] - 1)*sc[4] + (TB[2][2] - 1)*sc[9] + (TB[2][3] - 1)*sc[10];
+
     /*reaction 1: H + O2 (+M) <=> HO2 (+M) */
     /*a pressure-fall-off reaction */
     /* also 3-body */
@@ -4569,8 +4830,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[0][0] - 1)*sc[1] + (TB[0][1] - 1)*sc[4] + (TB[0][2] - 1)*sc[5] + (TB[0][3] - 1)*sc[9] + (TB[0][4] - 1)*sc[10];
     /* forward */
     phi_f = sc[0]*sc[5];
-    k_f = prefactor_units[0] * fwd_A[0]
-                * exp(fwd_beta[0] * tc[0] - activation_units[0] * fwd_Ea[0] * invT);
+    k_f = k_f_s[0];
     dlnkfdT = fwd_beta[0] * invT + activation_units[0] * fwd_Ea[0] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[0] * exp(low_beta[0] * tc[0] - activation_units[0] * low_Ea[0] * invT);
@@ -4586,16 +4846,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[0] == 4 ? exp(-troe_Tss[0] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
+      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
+      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
-      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
-      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -4603,7 +4863,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[6];
-    Kc = refCinv * exp(g_RT[0] + g_RT[5] - g_RT[6]);
+    Kc = Kc_s[0];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[5]) + (h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -4621,61 +4881,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[5];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[5] -= dqdci;                /* dwdot[O2]/d[H] */
-        J[6] += dqdci;                /* dwdot[HO2]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[0][0] - 1)*dcdc_fac;
-        J[12] -= dqdci;               /* dwdot[H]/d[H2] */
-        J[17] -= dqdci;               /* dwdot[O2]/d[H2] */
-        J[18] += dqdci;               /* dwdot[HO2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[0][1] - 1)*dcdc_fac;
-        J[48] -= dqdci;               /* dwdot[H]/d[H2O] */
-        J[53] -= dqdci;               /* dwdot[O2]/d[H2O] */
-        J[54] += dqdci;               /* dwdot[HO2]/d[H2O] */
-        /* d()/d[O2] */
-        dqdci = (TB[0][2] - 1)*dcdc_fac + k_f*sc[0];
-        J[60] -= dqdci;               /* dwdot[H]/d[O2] */
-        J[65] -= dqdci;               /* dwdot[O2]/d[O2] */
-        J[66] += dqdci;               /* dwdot[HO2]/d[O2] */
-        /* d()/d[HO2] */
-        dqdci =  - k_r;
-        J[72] -= dqdci;               /* dwdot[H]/d[HO2] */
-        J[77] -= dqdci;               /* dwdot[O2]/d[HO2] */
-        J[78] += dqdci;               /* dwdot[HO2]/d[HO2] */
-        /* d()/d[AR] */
-        dqdci = (TB[0][3] - 1)*dcdc_fac;
-        J[108] -= dqdci;              /* dwdot[H]/d[AR] */
-        J[113] -= dqdci;              /* dwdot[O2]/d[AR] */
-        J[114] += dqdci;              /* dwdot[HO2]/d[AR] */
-        /* d()/d[HE] */
-        dqdci = (TB[0][4] - 1)*dcdc_fac;
-        J[120] -= dqdci;              /* dwdot[H]/d[HE] */
-        J[125] -= dqdci;              /* dwdot[O2]/d[HE] */
-        J[126] += dqdci;              /* dwdot[HO2]/d[HE] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[5];
-        dqdc[1] = TB[0][0]*dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[0][1]*dcdc_fac;
-        dqdc[5] = TB[0][2]*dcdc_fac + k_f*sc[0];
-        dqdc[6] = dcdc_fac - k_r;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = TB[0][3]*dcdc_fac;
-        dqdc[10] = TB[0][4]*dcdc_fac;
-        for (int k=0; k<11; k++) {
-            J[12*k+0] -= dqdc[k];
-            J[12*k+5] -= dqdc[k];
-            J[12*k+6] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[5] -= dcdc_fac;
+    Jmix[6] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[5];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[5] -= dqdci;                /* dwdot[O2]/d[H] */
+    J[6] += dqdci;                /* dwdot[HO2]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[0][0] - 1)*dcdc_fac;
+    J[12] -= dqdci;               /* dwdot[H]/d[H2] */
+    J[17] -= dqdci;               /* dwdot[O2]/d[H2] */
+    J[18] += dqdci;               /* dwdot[HO2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[0][1] - 1)*dcdc_fac;
+    J[48] -= dqdci;               /* dwdot[H]/d[H2O] */
+    J[53] -= dqdci;               /* dwdot[O2]/d[H2O] */
+    J[54] += dqdci;               /* dwdot[HO2]/d[H2O] */
+    /* d()/d[O2] */
+    dqdci = (TB[0][2] - 1)*dcdc_fac + k_f*sc[0];
+    J[60] -= dqdci;               /* dwdot[H]/d[O2] */
+    J[65] -= dqdci;               /* dwdot[O2]/d[O2] */
+    J[66] += dqdci;               /* dwdot[HO2]/d[O2] */
+    /* d()/d[HO2] */
+    dqdci =  - k_r;
+    J[72] -= dqdci;               /* dwdot[H]/d[HO2] */
+    J[77] -= dqdci;               /* dwdot[O2]/d[HO2] */
+    J[78] += dqdci;               /* dwdot[HO2]/d[HO2] */
+    /* d()/d[AR] */
+    dqdci = (TB[0][3] - 1)*dcdc_fac;
+    J[108] -= dqdci;              /* dwdot[H]/d[AR] */
+    J[113] -= dqdci;              /* dwdot[O2]/d[AR] */
+    J[114] += dqdci;              /* dwdot[HO2]/d[AR] */
+    /* d()/d[HE] */
+    dqdci = (TB[0][4] - 1)*dcdc_fac;
+    J[120] -= dqdci;              /* dwdot[H]/d[HE] */
+    J[125] -= dqdci;              /* dwdot[O2]/d[HE] */
+    J[126] += dqdci;              /* dwdot[HO2]/d[HE] */
     J[132] -= dqdT; /* dwdot[H]/dT */
     J[137] -= dqdT; /* dwdot[O2]/dT */
     J[138] += dqdT; /* dwdot[HO2]/dT */
@@ -4687,8 +4931,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[1][0] - 1)*sc[4] + (TB[1][1] - 1)*sc[8] + (TB[1][2] - 1)*sc[5] + (TB[1][3] - 1)*sc[10] + (TB[1][4] - 1)*sc[7] + (TB[1][5] - 1)*sc[1];
     /* forward */
     phi_f = sc[7];
-    k_f = prefactor_units[1] * fwd_A[1]
-                * exp(fwd_beta[1] * tc[0] - activation_units[1] * fwd_Ea[1] * invT);
+    k_f = k_f_s[1];
     dlnkfdT = fwd_beta[1] * invT + activation_units[1] * fwd_Ea[1] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[1] * exp(low_beta[1] * tc[0] - activation_units[1] * low_Ea[1] * invT);
@@ -4704,16 +4947,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[1] == 4 ? exp(-troe_Tss[1] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
+      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
+      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
-      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
-      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -4721,7 +4964,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[3]*sc[3];
-    Kc = refC * exp(-g_RT[3] - g_RT[3] + g_RT[7]);
+    Kc = Kc_s[1];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7]) + (2*h_RT[3]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -4738,68 +4981,51 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[1][5] - 1)*dcdc_fac;
-        J[15] += 2 * dqdci;           /* dwdot[OH]/d[H2] */
-        J[19] -= dqdci;               /* dwdot[H2O2]/d[H2] */
-        /* d()/d[OH] */
-        dqdci =  - k_r*2*sc[3];
-        J[39] += 2 * dqdci;           /* dwdot[OH]/d[OH] */
-        J[43] -= dqdci;               /* dwdot[H2O2]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[1][0] - 1)*dcdc_fac;
-        J[51] += 2 * dqdci;           /* dwdot[OH]/d[H2O] */
-        J[55] -= dqdci;               /* dwdot[H2O2]/d[H2O] */
-        /* d()/d[O2] */
-        dqdci = (TB[1][2] - 1)*dcdc_fac;
-        J[63] += 2 * dqdci;           /* dwdot[OH]/d[O2] */
-        J[67] -= dqdci;               /* dwdot[H2O2]/d[O2] */
-        /* d()/d[H2O2] */
-        dqdci = (TB[1][4] - 1)*dcdc_fac + k_f;
-        J[87] += 2 * dqdci;           /* dwdot[OH]/d[H2O2] */
-        J[91] -= dqdci;               /* dwdot[H2O2]/d[H2O2] */
-        /* d()/d[N2] */
-        dqdci = (TB[1][1] - 1)*dcdc_fac;
-        J[99] += 2 * dqdci;           /* dwdot[OH]/d[N2] */
-        J[103] -= dqdci;              /* dwdot[H2O2]/d[N2] */
-        /* d()/d[HE] */
-        dqdci = (TB[1][3] - 1)*dcdc_fac;
-        J[123] += 2 * dqdci;          /* dwdot[OH]/d[HE] */
-        J[127] -= dqdci;              /* dwdot[H2O2]/d[HE] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[1][5]*dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac - k_r*2*sc[3];
-        dqdc[4] = TB[1][0]*dcdc_fac;
-        dqdc[5] = TB[1][2]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[1][4]*dcdc_fac + k_f;
-        dqdc[8] = TB[1][1]*dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = TB[1][3]*dcdc_fac;
-        for (int k=0; k<11; k++) {
-            J[12*k+3] += 2 * dqdc[k];
-            J[12*k+7] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] += 2 * dcdc_fac;
+    Jmix[7] -= dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[1][5] - 1)*dcdc_fac;
+    J[15] += 2 * dqdci;           /* dwdot[OH]/d[H2] */
+    J[19] -= dqdci;               /* dwdot[H2O2]/d[H2] */
+    /* d()/d[OH] */
+    dqdci =  - k_r*2*sc[3];
+    J[39] += 2 * dqdci;           /* dwdot[OH]/d[OH] */
+    J[43] -= dqdci;               /* dwdot[H2O2]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[1][0] - 1)*dcdc_fac;
+    J[51] += 2 * dqdci;           /* dwdot[OH]/d[H2O] */
+    J[55] -= dqdci;               /* dwdot[H2O2]/d[H2O] */
+    /* d()/d[O2] */
+    dqdci = (TB[1][2] - 1)*dcdc_fac;
+    J[63] += 2 * dqdci;           /* dwdot[OH]/d[O2] */
+    J[67] -= dqdci;               /* dwdot[H2O2]/d[O2] */
+    /* d()/d[H2O2] */
+    dqdci = (TB[1][4] - 1)*dcdc_fac + k_f;
+    J[87] += 2 * dqdci;           /* dwdot[OH]/d[H2O2] */
+    J[91] -= dqdci;               /* dwdot[H2O2]/d[H2O2] */
+    /* d()/d[N2] */
+    dqdci = (TB[1][1] - 1)*dcdc_fac;
+    J[99] += 2 * dqdci;           /* dwdot[OH]/d[N2] */
+    J[103] -= dqdci;              /* dwdot[H2O2]/d[N2] */
+    /* d()/d[HE] */
+    dqdci = (TB[1][3] - 1)*dcdc_fac;
+    J[123] += 2 * dqdci;          /* dwdot[OH]/d[HE] */
+    J[127] -= dqdci;              /* dwdot[H2O2]/d[HE] */
     J[135] += 2 * dqdT; /* dwdot[OH]/dT */
     J[139] -= dqdT; /* dwdot[H2O2]/dT */
 
     /*reaction 3: H2 + M <=> H + H + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[2][0] - 1)*sc[1] + (TB[2][1] - 1)*sc[4] + (TB[2][2] - 1)*sc[9] + (TB[2][3] - 1)*sc[10];
+    alpha = alpha_eff0;
     /* forward */
     phi_f = sc[1];
-    k_f = prefactor_units[2] * fwd_A[2]
-                * exp(fwd_beta[2] * tc[0] - activation_units[2] * fwd_Ea[2] * invT);
+    k_f = k_f_s[2];
     dlnkfdT = fwd_beta[2] * invT + activation_units[2] * fwd_Ea[2] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[0];
-    Kc = refC * exp(-g_RT[0] - g_RT[0] + g_RT[1]);
+    Kc = Kc_s[2];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1]) + (2*h_RT[0]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -4813,60 +5039,43 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  - k_r*2*sc[0];
-        J[0] += 2 * dqdci;            /* dwdot[H]/d[H] */
-        J[1] -= dqdci;                /* dwdot[H2]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[2][0] - 1)*q_nocor + k_f;
-        J[12] += 2 * dqdci;           /* dwdot[H]/d[H2] */
-        J[13] -= dqdci;               /* dwdot[H2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[2][1] - 1)*q_nocor;
-        J[48] += 2 * dqdci;           /* dwdot[H]/d[H2O] */
-        J[49] -= dqdci;               /* dwdot[H2]/d[H2O] */
-        /* d()/d[AR] */
-        dqdci = (TB[2][2] - 1)*q_nocor;
-        J[108] += 2 * dqdci;          /* dwdot[H]/d[AR] */
-        J[109] -= dqdci;              /* dwdot[H2]/d[AR] */
-        /* d()/d[HE] */
-        dqdci = (TB[2][3] - 1)*q_nocor;
-        J[120] += 2 * dqdci;          /* dwdot[H]/d[HE] */
-        J[121] -= dqdci;              /* dwdot[H2]/d[HE] */
-    }
-    else {
-        dqdc[0] = dcdc_fac - k_r*2*sc[0];
-        dqdc[1] = TB[2][0] + k_f;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[2][1];
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = TB[2][2];
-        dqdc[10] = TB[2][3];
-        for (int k=0; k<11; k++) {
-            J[12*k+0] += 2 * dqdc[k];
-            J[12*k+1] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += 2 * q_nocor;
+    Jmix[1] -= q_nocor;
+    /* d()/d[H] */
+    dqdci =  - k_r*2*sc[0];
+    J[0] += 2 * dqdci;            /* dwdot[H]/d[H] */
+    J[1] -= dqdci;                /* dwdot[H2]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[2][0] - 1)*q_nocor + k_f;
+    J[12] += 2 * dqdci;           /* dwdot[H]/d[H2] */
+    J[13] -= dqdci;               /* dwdot[H2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[2][1] - 1)*q_nocor;
+    J[48] += 2 * dqdci;           /* dwdot[H]/d[H2O] */
+    J[49] -= dqdci;               /* dwdot[H2]/d[H2O] */
+    /* d()/d[AR] */
+    dqdci = (TB[2][2] - 1)*q_nocor;
+    J[108] += 2 * dqdci;          /* dwdot[H]/d[AR] */
+    J[109] -= dqdci;              /* dwdot[H2]/d[AR] */
+    /* d()/d[HE] */
+    dqdci = (TB[2][3] - 1)*q_nocor;
+    J[120] += 2 * dqdci;          /* dwdot[H]/d[HE] */
+    J[121] -= dqdci;              /* dwdot[H2]/d[HE] */
     J[132] += 2 * dqdT; /* dwdot[H]/dT */
     J[133] -= dqdT; /* dwdot[H2]/dT */
 
     /*reaction 4: O + O + M <=> O2 + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[3][0] - 1)*sc[1] + (TB[3][1] - 1)*sc[4] + (TB[3][2] - 1)*sc[9] + (TB[3][3] - 1)*sc[10];
+    alpha = (memcmp(TB[3], TB[2], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[3][0] - 1)*sc[1] + (TB[3][1] - 1)*sc[4] + (TB[3][2] - 1)*sc[9] + (TB[3][3] - 1)*sc[10]);
     /* forward */
     phi_f = sc[2]*sc[2];
-    k_f = prefactor_units[3] * fwd_A[3]
-                * exp(fwd_beta[3] * tc[0] - activation_units[3] * fwd_Ea[3] * invT);
+    k_f = k_f_s[3];
     dlnkfdT = fwd_beta[3] * invT + activation_units[3] * fwd_Ea[3] * invT2;
     /* reverse */
     phi_r = sc[5];
-    Kc = refCinv * exp(g_RT[2] + g_RT[2] - g_RT[5]);
+    Kc = Kc_s[3];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[2]) + (h_RT[5]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -4880,49 +5089,33 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[3][0] - 1)*q_nocor;
-        J[14] += -2 * dqdci;          /* dwdot[O]/d[H2] */
-        J[17] += dqdci;               /* dwdot[O2]/d[H2] */
-        /* d()/d[O] */
-        dqdci =  + k_f*2*sc[2];
-        J[26] += -2 * dqdci;          /* dwdot[O]/d[O] */
-        J[29] += dqdci;               /* dwdot[O2]/d[O] */
-        /* d()/d[H2O] */
-        dqdci = (TB[3][1] - 1)*q_nocor;
-        J[50] += -2 * dqdci;          /* dwdot[O]/d[H2O] */
-        J[53] += dqdci;               /* dwdot[O2]/d[H2O] */
-        /* d()/d[O2] */
-        dqdci =  - k_r;
-        J[62] += -2 * dqdci;          /* dwdot[O]/d[O2] */
-        J[65] += dqdci;               /* dwdot[O2]/d[O2] */
-        /* d()/d[AR] */
-        dqdci = (TB[3][2] - 1)*q_nocor;
-        J[110] += -2 * dqdci;         /* dwdot[O]/d[AR] */
-        J[113] += dqdci;              /* dwdot[O2]/d[AR] */
-        /* d()/d[HE] */
-        dqdci = (TB[3][3] - 1)*q_nocor;
-        J[122] += -2 * dqdci;         /* dwdot[O]/d[HE] */
-        J[125] += dqdci;              /* dwdot[O2]/d[HE] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[3][0];
-        dqdc[2] = dcdc_fac + k_f*2*sc[2];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[3][1];
-        dqdc[5] = dcdc_fac - k_r;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = TB[3][2];
-        dqdc[10] = TB[3][3];
-        for (int k=0; k<11; k++) {
-            J[12*k+2] += -2 * dqdc[k];
-            J[12*k+5] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] += -2 * q_nocor;
+    Jmix[5] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[3][0] - 1)*q_nocor;
+    J[14] += -2 * dqdci;          /* dwdot[O]/d[H2] */
+    J[17] += dqdci;               /* dwdot[O2]/d[H2] */
+    /* d()/d[O] */
+    dqdci =  + k_f*2*sc[2];
+    J[26] += -2 * dqdci;          /* dwdot[O]/d[O] */
+    J[29] += dqdci;               /* dwdot[O2]/d[O] */
+    /* d()/d[H2O] */
+    dqdci = (TB[3][1] - 1)*q_nocor;
+    J[50] += -2 * dqdci;          /* dwdot[O]/d[H2O] */
+    J[53] += dqdci;               /* dwdot[O2]/d[H2O] */
+    /* d()/d[O2] */
+    dqdci =  - k_r;
+    J[62] += -2 * dqdci;          /* dwdot[O]/d[O2] */
+    J[65] += dqdci;               /* dwdot[O2]/d[O2] */
+    /* d()/d[AR] */
+    dqdci = (TB[3][2] - 1)*q_nocor;
+    J[110] += -2 * dqdci;         /* dwdot[O]/d[AR] */
+    J[113] += dqdci;              /* dwdot[O2]/d[AR] */
+    /* d()/d[HE] */
+    dqdci = (TB[3][3] - 1)*q_nocor;
+    J[122] += -2 * dqdci;         /* dwdot[O]/d[HE] */
+    J[125] += dqdci;              /* dwdot[O2]/d[HE] */
     J[134] += -2 * dqdT; /* dwdot[O]/dT */
     J[137] += dqdT; /* dwdot[O2]/dT */
 
@@ -4932,12 +5125,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[4][0] - 1)*sc[1] + (TB[4][1] - 1)*sc[4] + (TB[4][2] - 1)*sc[9] + (TB[4][3] - 1)*sc[10];
     /* forward */
     phi_f = sc[0]*sc[2];
-    k_f = prefactor_units[4] * fwd_A[4]
-                * exp(fwd_beta[4] * tc[0] - activation_units[4] * fwd_Ea[4] * invT);
+    k_f = k_f_s[4];
     dlnkfdT = fwd_beta[4] * invT + activation_units[4] * fwd_Ea[4] * invT2;
     /* reverse */
     phi_r = sc[3];
-    Kc = refCinv * exp(g_RT[0] + g_RT[2] - g_RT[3]);
+    Kc = Kc_s[4];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[2]) + (h_RT[3]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -4952,61 +5144,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[2];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[2] -= dqdci;                /* dwdot[O]/d[H] */
-        J[3] += dqdci;                /* dwdot[OH]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[4][0] - 1)*q_nocor;
-        J[12] -= dqdci;               /* dwdot[H]/d[H2] */
-        J[14] -= dqdci;               /* dwdot[O]/d[H2] */
-        J[15] += dqdci;               /* dwdot[OH]/d[H2] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[0];
-        J[24] -= dqdci;               /* dwdot[H]/d[O] */
-        J[26] -= dqdci;               /* dwdot[O]/d[O] */
-        J[27] += dqdci;               /* dwdot[OH]/d[O] */
-        /* d()/d[OH] */
-        dqdci =  - k_r;
-        J[36] -= dqdci;               /* dwdot[H]/d[OH] */
-        J[38] -= dqdci;               /* dwdot[O]/d[OH] */
-        J[39] += dqdci;               /* dwdot[OH]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[4][1] - 1)*q_nocor;
-        J[48] -= dqdci;               /* dwdot[H]/d[H2O] */
-        J[50] -= dqdci;               /* dwdot[O]/d[H2O] */
-        J[51] += dqdci;               /* dwdot[OH]/d[H2O] */
-        /* d()/d[AR] */
-        dqdci = (TB[4][2] - 1)*q_nocor;
-        J[108] -= dqdci;              /* dwdot[H]/d[AR] */
-        J[110] -= dqdci;              /* dwdot[O]/d[AR] */
-        J[111] += dqdci;              /* dwdot[OH]/d[AR] */
-        /* d()/d[HE] */
-        dqdci = (TB[4][3] - 1)*q_nocor;
-        J[120] -= dqdci;              /* dwdot[H]/d[HE] */
-        J[122] -= dqdci;              /* dwdot[O]/d[HE] */
-        J[123] += dqdci;              /* dwdot[OH]/d[HE] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[2];
-        dqdc[1] = TB[4][0];
-        dqdc[2] = dcdc_fac + k_f*sc[0];
-        dqdc[3] = dcdc_fac - k_r;
-        dqdc[4] = TB[4][1];
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = TB[4][2];
-        dqdc[10] = TB[4][3];
-        for (int k=0; k<11; k++) {
-            J[12*k+0] -= dqdc[k];
-            J[12*k+2] -= dqdc[k];
-            J[12*k+3] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= q_nocor;
+    Jmix[2] -= q_nocor;
+    Jmix[3] += q_nocor;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[2];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[2] -= dqdci;                /* dwdot[O]/d[H] */
+    J[3] += dqdci;                /* dwdot[OH]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[4][0] - 1)*q_nocor;
+    J[12] -= dqdci;               /* dwdot[H]/d[H2] */
+    J[14] -= dqdci;               /* dwdot[O]/d[H2] */
+    J[15] += dqdci;               /* dwdot[OH]/d[H2] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[0];
+    J[24] -= dqdci;               /* dwdot[H]/d[O] */
+    J[26] -= dqdci;               /* dwdot[O]/d[O] */
+    J[27] += dqdci;               /* dwdot[OH]/d[O] */
+    /* d()/d[OH] */
+    dqdci =  - k_r;
+    J[36] -= dqdci;               /* dwdot[H]/d[OH] */
+    J[38] -= dqdci;               /* dwdot[O]/d[OH] */
+    J[39] += dqdci;               /* dwdot[OH]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[4][1] - 1)*q_nocor;
+    J[48] -= dqdci;               /* dwdot[H]/d[H2O] */
+    J[50] -= dqdci;               /* dwdot[O]/d[H2O] */
+    J[51] += dqdci;               /* dwdot[OH]/d[H2O] */
+    /* d()/d[AR] */
+    dqdci = (TB[4][2] - 1)*q_nocor;
+    J[108] -= dqdci;              /* dwdot[H]/d[AR] */
+    J[110] -= dqdci;              /* dwdot[O]/d[AR] */
+    J[111] += dqdci;              /* dwdot[OH]/d[AR] */
+    /* d()/d[HE] */
+    dqdci = (TB[4][3] - 1)*q_nocor;
+    J[120] -= dqdci;              /* dwdot[H]/d[HE] */
+    J[122] -= dqdci;              /* dwdot[O]/d[HE] */
+    J[123] += dqdci;              /* dwdot[OH]/d[HE] */
     J[132] -= dqdT; /* dwdot[H]/dT */
     J[134] -= dqdT; /* dwdot[O]/dT */
     J[135] += dqdT; /* dwdot[OH]/dT */
@@ -5017,12 +5193,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[5][0] - 1)*sc[1] + (TB[5][1] - 1)*sc[4] + (TB[5][2] - 1)*sc[10] + (TB[5][3] - 1)*sc[8] + (TB[5][4] - 1)*sc[5];
     /* forward */
     phi_f = sc[4];
-    k_f = prefactor_units[5] * fwd_A[5]
-                * exp(fwd_beta[5] * tc[0] - activation_units[5] * fwd_Ea[5] * invT);
+    k_f = k_f_s[5];
     dlnkfdT = fwd_beta[5] * invT + activation_units[5] * fwd_Ea[5] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[3];
-    Kc = refC * exp(-g_RT[0] - g_RT[3] + g_RT[4]);
+    Kc = Kc_s[5];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4]) + (h_RT[0] + h_RT[3]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5037,61 +5212,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[3];
-        J[0] += dqdci;                /* dwdot[H]/d[H] */
-        J[3] += dqdci;                /* dwdot[OH]/d[H] */
-        J[4] -= dqdci;                /* dwdot[H2O]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[5][0] - 1)*q_nocor;
-        J[12] += dqdci;               /* dwdot[H]/d[H2] */
-        J[15] += dqdci;               /* dwdot[OH]/d[H2] */
-        J[16] -= dqdci;               /* dwdot[H2O]/d[H2] */
-        /* d()/d[OH] */
-        dqdci =  - k_r*sc[0];
-        J[36] += dqdci;               /* dwdot[H]/d[OH] */
-        J[39] += dqdci;               /* dwdot[OH]/d[OH] */
-        J[40] -= dqdci;               /* dwdot[H2O]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[5][1] - 1)*q_nocor + k_f;
-        J[48] += dqdci;               /* dwdot[H]/d[H2O] */
-        J[51] += dqdci;               /* dwdot[OH]/d[H2O] */
-        J[52] -= dqdci;               /* dwdot[H2O]/d[H2O] */
-        /* d()/d[O2] */
-        dqdci = (TB[5][4] - 1)*q_nocor;
-        J[60] += dqdci;               /* dwdot[H]/d[O2] */
-        J[63] += dqdci;               /* dwdot[OH]/d[O2] */
-        J[64] -= dqdci;               /* dwdot[H2O]/d[O2] */
-        /* d()/d[N2] */
-        dqdci = (TB[5][3] - 1)*q_nocor;
-        J[96] += dqdci;               /* dwdot[H]/d[N2] */
-        J[99] += dqdci;               /* dwdot[OH]/d[N2] */
-        J[100] -= dqdci;              /* dwdot[H2O]/d[N2] */
-        /* d()/d[HE] */
-        dqdci = (TB[5][2] - 1)*q_nocor;
-        J[120] += dqdci;              /* dwdot[H]/d[HE] */
-        J[123] += dqdci;              /* dwdot[OH]/d[HE] */
-        J[124] -= dqdci;              /* dwdot[H2O]/d[HE] */
-    }
-    else {
-        dqdc[0] = dcdc_fac - k_r*sc[3];
-        dqdc[1] = TB[5][0];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac - k_r*sc[0];
-        dqdc[4] = TB[5][1] + k_f;
-        dqdc[5] = TB[5][4];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = TB[5][3];
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = TB[5][2];
-        for (int k=0; k<11; k++) {
-            J[12*k+0] += dqdc[k];
-            J[12*k+3] += dqdc[k];
-            J[12*k+4] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += q_nocor;
+    Jmix[3] += q_nocor;
+    Jmix[4] -= q_nocor;
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[3];
+    J[0] += dqdci;                /* dwdot[H]/d[H] */
+    J[3] += dqdci;                /* dwdot[OH]/d[H] */
+    J[4] -= dqdci;                /* dwdot[H2O]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[5][0] - 1)*q_nocor;
+    J[12] += dqdci;               /* dwdot[H]/d[H2] */
+    J[15] += dqdci;               /* dwdot[OH]/d[H2] */
+    J[16] -= dqdci;               /* dwdot[H2O]/d[H2] */
+    /* d()/d[OH] */
+    dqdci =  - k_r*sc[0];
+    J[36] += dqdci;               /* dwdot[H]/d[OH] */
+    J[39] += dqdci;               /* dwdot[OH]/d[OH] */
+    J[40] -= dqdci;               /* dwdot[H2O]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[5][1] - 1)*q_nocor + k_f;
+    J[48] += dqdci;               /* dwdot[H]/d[H2O] */
+    J[51] += dqdci;               /* dwdot[OH]/d[H2O] */
+    J[52] -= dqdci;               /* dwdot[H2O]/d[H2O] */
+    /* d()/d[O2] */
+    dqdci = (TB[5][4] - 1)*q_nocor;
+    J[60] += dqdci;               /* dwdot[H]/d[O2] */
+    J[63] += dqdci;               /* dwdot[OH]/d[O2] */
+    J[64] -= dqdci;               /* dwdot[H2O]/d[O2] */
+    /* d()/d[N2] */
+    dqdci = (TB[5][3] - 1)*q_nocor;
+    J[96] += dqdci;               /* dwdot[H]/d[N2] */
+    J[99] += dqdci;               /* dwdot[OH]/d[N2] */
+    J[100] -= dqdci;              /* dwdot[H2O]/d[N2] */
+    /* d()/d[HE] */
+    dqdci = (TB[5][2] - 1)*q_nocor;
+    J[120] += dqdci;              /* dwdot[H]/d[HE] */
+    J[123] += dqdci;              /* dwdot[OH]/d[HE] */
+    J[124] -= dqdci;              /* dwdot[H2O]/d[HE] */
     J[132] += dqdT; /* dwdot[H]/dT */
     J[135] += dqdT; /* dwdot[OH]/dT */
     J[136] -= dqdT; /* dwdot[H2O]/dT */
@@ -5102,12 +5261,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[6][0] - 1)*sc[1] + (TB[6][1] - 1)*sc[4] + (TB[6][2] - 1)*sc[9] + (TB[6][3] - 1)*sc[10];
     /* forward */
     phi_f = sc[2]*sc[3];
-    k_f = prefactor_units[6] * fwd_A[6]
-                * exp(fwd_beta[6] * tc[0] - activation_units[6] * fwd_Ea[6] * invT);
+    k_f = k_f_s[6];
     dlnkfdT = fwd_beta[6] * invT + activation_units[6] * fwd_Ea[6] * invT2;
     /* reverse */
     phi_r = sc[6];
-    Kc = refCinv * exp(g_RT[2] + g_RT[3] - g_RT[6]);
+    Kc = Kc_s[6];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[3]) + (h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5122,61 +5280,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[6][0] - 1)*q_nocor;
-        J[14] -= dqdci;               /* dwdot[O]/d[H2] */
-        J[15] -= dqdci;               /* dwdot[OH]/d[H2] */
-        J[18] += dqdci;               /* dwdot[HO2]/d[H2] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[3];
-        J[26] -= dqdci;               /* dwdot[O]/d[O] */
-        J[27] -= dqdci;               /* dwdot[OH]/d[O] */
-        J[30] += dqdci;               /* dwdot[HO2]/d[O] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*sc[2];
-        J[38] -= dqdci;               /* dwdot[O]/d[OH] */
-        J[39] -= dqdci;               /* dwdot[OH]/d[OH] */
-        J[42] += dqdci;               /* dwdot[HO2]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[6][1] - 1)*q_nocor;
-        J[50] -= dqdci;               /* dwdot[O]/d[H2O] */
-        J[51] -= dqdci;               /* dwdot[OH]/d[H2O] */
-        J[54] += dqdci;               /* dwdot[HO2]/d[H2O] */
-        /* d()/d[HO2] */
-        dqdci =  - k_r;
-        J[74] -= dqdci;               /* dwdot[O]/d[HO2] */
-        J[75] -= dqdci;               /* dwdot[OH]/d[HO2] */
-        J[78] += dqdci;               /* dwdot[HO2]/d[HO2] */
-        /* d()/d[AR] */
-        dqdci = (TB[6][2] - 1)*q_nocor;
-        J[110] -= dqdci;              /* dwdot[O]/d[AR] */
-        J[111] -= dqdci;              /* dwdot[OH]/d[AR] */
-        J[114] += dqdci;              /* dwdot[HO2]/d[AR] */
-        /* d()/d[HE] */
-        dqdci = (TB[6][3] - 1)*q_nocor;
-        J[122] -= dqdci;              /* dwdot[O]/d[HE] */
-        J[123] -= dqdci;              /* dwdot[OH]/d[HE] */
-        J[126] += dqdci;              /* dwdot[HO2]/d[HE] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[6][0];
-        dqdc[2] = dcdc_fac + k_f*sc[3];
-        dqdc[3] = dcdc_fac + k_f*sc[2];
-        dqdc[4] = TB[6][1];
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac - k_r;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = TB[6][2];
-        dqdc[10] = TB[6][3];
-        for (int k=0; k<11; k++) {
-            J[12*k+2] -= dqdc[k];
-            J[12*k+3] -= dqdc[k];
-            J[12*k+6] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] -= q_nocor;
+    Jmix[3] -= q_nocor;
+    Jmix[6] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[6][0] - 1)*q_nocor;
+    J[14] -= dqdci;               /* dwdot[O]/d[H2] */
+    J[15] -= dqdci;               /* dwdot[OH]/d[H2] */
+    J[18] += dqdci;               /* dwdot[HO2]/d[H2] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[3];
+    J[26] -= dqdci;               /* dwdot[O]/d[O] */
+    J[27] -= dqdci;               /* dwdot[OH]/d[O] */
+    J[30] += dqdci;               /* dwdot[HO2]/d[O] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*sc[2];
+    J[38] -= dqdci;               /* dwdot[O]/d[OH] */
+    J[39] -= dqdci;               /* dwdot[OH]/d[OH] */
+    J[42] += dqdci;               /* dwdot[HO2]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[6][1] - 1)*q_nocor;
+    J[50] -= dqdci;               /* dwdot[O]/d[H2O] */
+    J[51] -= dqdci;               /* dwdot[OH]/d[H2O] */
+    J[54] += dqdci;               /* dwdot[HO2]/d[H2O] */
+    /* d()/d[HO2] */
+    dqdci =  - k_r;
+    J[74] -= dqdci;               /* dwdot[O]/d[HO2] */
+    J[75] -= dqdci;               /* dwdot[OH]/d[HO2] */
+    J[78] += dqdci;               /* dwdot[HO2]/d[HO2] */
+    /* d()/d[AR] */
+    dqdci = (TB[6][2] - 1)*q_nocor;
+    J[110] -= dqdci;              /* dwdot[O]/d[AR] */
+    J[111] -= dqdci;              /* dwdot[OH]/d[AR] */
+    J[114] += dqdci;              /* dwdot[HO2]/d[AR] */
+    /* d()/d[HE] */
+    dqdci = (TB[6][3] - 1)*q_nocor;
+    J[122] -= dqdci;              /* dwdot[O]/d[HE] */
+    J[123] -= dqdci;              /* dwdot[OH]/d[HE] */
+    J[126] += dqdci;              /* dwdot[HO2]/d[HE] */
     J[134] -= dqdT; /* dwdot[O]/dT */
     J[135] -= dqdT; /* dwdot[OH]/dT */
     J[138] += dqdT; /* dwdot[HO2]/dT */
@@ -5185,12 +5327,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[5];
-    k_f = prefactor_units[7] * fwd_A[7]
-                * exp(fwd_beta[7] * tc[0] - activation_units[7] * fwd_Ea[7] * invT);
+    k_f = k_f_s[7];
     dlnkfdT = fwd_beta[7] * invT + activation_units[7] * fwd_Ea[7] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[3];
-    Kc = exp(g_RT[0] - g_RT[2] - g_RT[3] + g_RT[5]);
+    Kc = Kc_s[7];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[5]) + (h_RT[2] + h_RT[3]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5236,12 +5377,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[2];
-    k_f = prefactor_units[8] * fwd_A[8]
-                * exp(fwd_beta[8] * tc[0] - activation_units[8] * fwd_Ea[8] * invT);
+    k_f = k_f_s[8];
     dlnkfdT = fwd_beta[8] * invT + activation_units[8] * fwd_Ea[8] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[3];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[2] - g_RT[3]);
+    Kc = Kc_s[8];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[2]) + (h_RT[0] + h_RT[3]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5287,12 +5427,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[2];
-    k_f = prefactor_units[9] * fwd_A[9]
-                * exp(fwd_beta[9] * tc[0] - activation_units[9] * fwd_Ea[9] * invT);
+    k_f = k_f_s[9];
     dlnkfdT = fwd_beta[9] * invT + activation_units[9] * fwd_Ea[9] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[3];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[2] - g_RT[3]);
+    Kc = Kc_s[9];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[2]) + (h_RT[0] + h_RT[3]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5338,12 +5477,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3];
-    k_f = prefactor_units[10] * fwd_A[10]
-                * exp(fwd_beta[10] * tc[0] - activation_units[10] * fwd_Ea[10] * invT);
+    k_f = k_f_s[10];
     dlnkfdT = fwd_beta[10] * invT + activation_units[10] * fwd_Ea[10] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[4];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[3] - g_RT[4]);
+    Kc = Kc_s[10];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3]) + (h_RT[0] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5389,12 +5527,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[3];
-    k_f = prefactor_units[11] * fwd_A[11]
-                * exp(fwd_beta[11] * tc[0] - activation_units[11] * fwd_Ea[11] * invT);
+    k_f = k_f_s[11];
     dlnkfdT = fwd_beta[11] * invT + activation_units[11] * fwd_Ea[11] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[4];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[3] - g_RT[4]);
+    Kc = Kc_s[11];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[3]) + (h_RT[2] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5429,12 +5566,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[9];
-    k_f = prefactor_units[12] * fwd_A[12]
-                * exp(fwd_beta[12] * tc[0] - activation_units[12] * fwd_Ea[12] * invT);
+    k_f = k_f_s[12];
     dlnkfdT = fwd_beta[12] * invT + activation_units[12] * fwd_Ea[12] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[0]*sc[9];
-    Kc = refC * exp(-g_RT[0] - g_RT[0] + g_RT[1] + g_RT[9] - g_RT[9]);
+    Kc = Kc_s[12];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[9]) + (2*h_RT[0] + h_RT[9]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5464,12 +5600,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[10];
-    k_f = prefactor_units[13] * fwd_A[13]
-                * exp(fwd_beta[13] * tc[0] - activation_units[13] * fwd_Ea[13] * invT);
+    k_f = k_f_s[13];
     dlnkfdT = fwd_beta[13] * invT + activation_units[13] * fwd_Ea[13] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[0]*sc[10];
-    Kc = refC * exp(-g_RT[0] - g_RT[0] + g_RT[1] + g_RT[10] - g_RT[10]);
+    Kc = Kc_s[13];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[10]) + (2*h_RT[0] + h_RT[10]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5499,12 +5634,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[2]*sc[9];
-    k_f = prefactor_units[14] * fwd_A[14]
-                * exp(fwd_beta[14] * tc[0] - activation_units[14] * fwd_Ea[14] * invT);
+    k_f = k_f_s[14];
     dlnkfdT = fwd_beta[14] * invT + activation_units[14] * fwd_Ea[14] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[9];
-    Kc = refCinv * exp(g_RT[2] + g_RT[2] - g_RT[5] + g_RT[9] - g_RT[9]);
+    Kc = Kc_s[14];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[2] + h_RT[9]) + (h_RT[5] + h_RT[9]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5534,12 +5668,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[2]*sc[10];
-    k_f = prefactor_units[15] * fwd_A[15]
-                * exp(fwd_beta[15] * tc[0] - activation_units[15] * fwd_Ea[15] * invT);
+    k_f = k_f_s[15];
     dlnkfdT = fwd_beta[15] * invT + activation_units[15] * fwd_Ea[15] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[10];
-    Kc = refCinv * exp(g_RT[2] + g_RT[2] - g_RT[5] + g_RT[10] - g_RT[10]);
+    Kc = Kc_s[15];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[2] + h_RT[10]) + (h_RT[5] + h_RT[10]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5569,12 +5702,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[4];
-    k_f = prefactor_units[16] * fwd_A[16]
-                * exp(fwd_beta[16] * tc[0] - activation_units[16] * fwd_Ea[16] * invT);
+    k_f = k_f_s[16];
     dlnkfdT = fwd_beta[16] * invT + activation_units[16] * fwd_Ea[16] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[3]*sc[4];
-    Kc = refC * exp(-g_RT[0] - g_RT[3] + g_RT[4] + g_RT[4] - g_RT[4]);
+    Kc = Kc_s[16];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[4]) + (h_RT[0] + h_RT[3] + h_RT[4]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5609,12 +5741,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[6];
-    k_f = prefactor_units[17] * fwd_A[17]
-                * exp(fwd_beta[17] * tc[0] - activation_units[17] * fwd_Ea[17] * invT);
+    k_f = k_f_s[17];
     dlnkfdT = fwd_beta[17] * invT + activation_units[17] * fwd_Ea[17] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[5];
-    Kc = exp(g_RT[0] - g_RT[1] - g_RT[5] + g_RT[6]);
+    Kc = Kc_s[17];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[6]) + (h_RT[1] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5660,12 +5791,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[6];
-    k_f = prefactor_units[18] * fwd_A[18]
-                * exp(fwd_beta[18] * tc[0] - activation_units[18] * fwd_Ea[18] * invT);
+    k_f = k_f_s[18];
     dlnkfdT = fwd_beta[18] * invT + activation_units[18] * fwd_Ea[18] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[3];
-    Kc = exp(g_RT[0] - g_RT[3] - g_RT[3] + g_RT[6]);
+    Kc = Kc_s[18];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[6]) + (2*h_RT[3]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5700,12 +5830,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[6];
-    k_f = prefactor_units[19] * fwd_A[19]
-                * exp(fwd_beta[19] * tc[0] - activation_units[19] * fwd_Ea[19] * invT);
+    k_f = k_f_s[19];
     dlnkfdT = fwd_beta[19] * invT + activation_units[19] * fwd_Ea[19] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[5];
-    Kc = exp(g_RT[2] - g_RT[3] - g_RT[5] + g_RT[6]);
+    Kc = Kc_s[19];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[6]) + (h_RT[3] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5751,12 +5880,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[6];
-    k_f = prefactor_units[20] * fwd_A[20]
-                * exp(fwd_beta[20] * tc[0] - activation_units[20] * fwd_Ea[20] * invT);
+    k_f = k_f_s[20];
     dlnkfdT = fwd_beta[20] * invT + activation_units[20] * fwd_Ea[20] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[5];
-    Kc = exp(g_RT[3] - g_RT[4] - g_RT[5] + g_RT[6]);
+    Kc = Kc_s[20];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[6]) + (h_RT[4] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5802,12 +5930,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[6];
-    k_f = prefactor_units[21] * fwd_A[21]
-                * exp(fwd_beta[21] * tc[0] - activation_units[21] * fwd_Ea[21] * invT);
+    k_f = k_f_s[21];
     dlnkfdT = fwd_beta[21] * invT + activation_units[21] * fwd_Ea[21] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[7];
-    Kc = exp(-g_RT[5] + g_RT[6] + g_RT[6] - g_RT[7]);
+    Kc = Kc_s[21];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[6]) + (h_RT[5] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5842,12 +5969,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[6];
-    k_f = prefactor_units[22] * fwd_A[22]
-                * exp(fwd_beta[22] * tc[0] - activation_units[22] * fwd_Ea[22] * invT);
+    k_f = k_f_s[22];
     dlnkfdT = fwd_beta[22] * invT + activation_units[22] * fwd_Ea[22] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[7];
-    Kc = exp(-g_RT[5] + g_RT[6] + g_RT[6] - g_RT[7]);
+    Kc = Kc_s[22];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[6]) + (h_RT[5] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5882,12 +6008,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[7];
-    k_f = prefactor_units[23] * fwd_A[23]
-                * exp(fwd_beta[23] * tc[0] - activation_units[23] * fwd_Ea[23] * invT);
+    k_f = k_f_s[23];
     dlnkfdT = fwd_beta[23] * invT + activation_units[23] * fwd_Ea[23] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[4];
-    Kc = exp(g_RT[0] - g_RT[3] - g_RT[4] + g_RT[7]);
+    Kc = Kc_s[23];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[7]) + (h_RT[3] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5933,12 +6058,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[7];
-    k_f = prefactor_units[24] * fwd_A[24]
-                * exp(fwd_beta[24] * tc[0] - activation_units[24] * fwd_Ea[24] * invT);
+    k_f = k_f_s[24];
     dlnkfdT = fwd_beta[24] * invT + activation_units[24] * fwd_Ea[24] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[6];
-    Kc = exp(g_RT[0] - g_RT[1] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[24];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[7]) + (h_RT[1] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5984,12 +6108,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[7];
-    k_f = prefactor_units[25] * fwd_A[25]
-                * exp(fwd_beta[25] * tc[0] - activation_units[25] * fwd_Ea[25] * invT);
+    k_f = k_f_s[25];
     dlnkfdT = fwd_beta[25] * invT + activation_units[25] * fwd_Ea[25] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[6];
-    Kc = exp(g_RT[2] - g_RT[3] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[25];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[7]) + (h_RT[3] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6035,12 +6158,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[7];
-    k_f = prefactor_units[26] * fwd_A[26]
-                * exp(fwd_beta[26] * tc[0] - activation_units[26] * fwd_Ea[26] * invT);
+    k_f = k_f_s[26];
     dlnkfdT = fwd_beta[26] * invT + activation_units[26] * fwd_Ea[26] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[6];
-    Kc = exp(g_RT[3] - g_RT[4] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[26];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[7]) + (h_RT[4] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6086,12 +6208,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[7];
-    k_f = prefactor_units[27] * fwd_A[27]
-                * exp(fwd_beta[27] * tc[0] - activation_units[27] * fwd_Ea[27] * invT);
+    k_f = k_f_s[27];
     dlnkfdT = fwd_beta[27] * invT + activation_units[27] * fwd_Ea[27] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[6];
-    Kc = exp(g_RT[3] - g_RT[4] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[27];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[7]) + (h_RT[4] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6137,12 +6258,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[6];
-    k_f = prefactor_units[28] * fwd_A[28]
-                * exp(fwd_beta[28] * tc[0] - activation_units[28] * fwd_Ea[28] * invT);
+    k_f = k_f_s[28];
     dlnkfdT = fwd_beta[28] * invT + activation_units[28] * fwd_Ea[28] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[4];
-    Kc = exp(g_RT[0] - g_RT[2] - g_RT[4] + g_RT[6]);
+    Kc = Kc_s[28];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[6]) + (h_RT[2] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6196,6 +6316,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         dcvpRdT(dcRdT, tc);
         speciesInternalEnergy(e_RT, tc);
         eh_RT = &e_RT[0];
+        for (int k=0; k<11; k++) {
+            for (int m=0; m<11; m++) {
+                J[k*12+m] += Jmix[m];
+            }
+        }
     }
 
     double cmix = 0.0, ehmix = 0.0, dcmixdT=0.0, dehmixdT=0.0;
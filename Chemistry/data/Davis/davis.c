@@ -1,5 +1,6 @@
 
 #include <math.h>
+#include <float.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -86,7 +87,14 @@
 #define VCKPY VCKPY
 #define VCKWYR VCKWYR
 #define VCKYTX VCKYTX
+#define VCKCPBS VCKCPBS
+#define VCKCVBS VCKCVBS
+#define VCKHBMS VCKHBMS
+#define VCKUBMS VCKUBMS
+#define VCKRHOY VCKRHOY
+#define VCKMMWY VCKMMWY
 #define GET_T_GIVEN_EY GET_T_GIVEN_EY
+#define GET_T_GIVEN_HY GET_T_GIVEN_HY
 #define GET_REACTION_MAP GET_REACTION_MAP
 #elif defined(BL_FORT_USE_LOWERCASE)
 #define CKINDX ckindx
@@ -170,7 +178,14 @@
 #define VCKPY vckpy
 #define VCKWYR vckwyr
 #define VCKYTX vckytx
+#define VCKCPBS vckcpbs
+#define VCKCVBS vckcvbs
+#define VCKHBMS vckhbms
+#define VCKUBMS vckubms
+#define VCKRHOY vckrhoy
+#define VCKMMWY vckmmwy
 #define GET_T_GIVEN_EY get_t_given_ey
+#define GET_T_GIVEN_HY get_t_given_hy
 #define GET_REACTION_MAP get_reaction_map
 #elif defined(BL_FORT_USE_UNDERSCORE)
 #define CKINDX ckindx_
@@ -254,7 +269,14 @@
 #define VCKPY vckpy_
 #define VCKWYR vckwyr_
 #define VCKYTX vckytx_
+#define VCKCPBS vckcpbs_
+#define VCKCVBS vckcvbs_
+#define VCKHBMS vckhbms_
+#define VCKUBMS vckubms_
+#define VCKRHOY vckrhoy_
+#define VCKMMWY vckmmwy_
 #define GET_T_GIVEN_EY get_t_given_ey_
+#define GET_T_GIVEN_HY get_t_given_hy_
 #define GET_REACTION_MAP get_reaction_map_
 #endif
 
@@ -356,6 +378,7 @@ void DWDOT(double * restrict J, double * restrict sc, double * restrict T, int *
 void aJacobian(double * restrict J, double * restrict sc, double T, int consP);
 void dcvpRdT(double * restrict species, double * restrict tc);
 void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
+void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
 void GET_REACTION_MAP(int * restrict rmap);
 /*vector version */
 void vproductionRate(int npt, double * restrict wdot, double * restrict c, double * restrict T);
@@ -365,6 +388,12 @@ void VCKWYR(int * restrict np, double * restrict rho, double * restrict T,
             double * restrict y, int * restrict iwrk, double * restrict rwrk,
             double * restrict wdot);
 void VCKYTX(int * restrict np, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict x);
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs);
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs);
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms);
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms);
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho);
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm);
 void vcomp_k_f(int npt, double * restrict k_f_s, double * restrict tc, double * restrict invT);
 void vcomp_gibbs(int npt, double * restrict g_RT, double * restrict tc);
 void vcomp_Kc(int npt, double * restrict Kc_s, double * restrict g_RT, double * restrict invT);
@@ -1078,38 +1107,6 @@ void CKINDX(int * iwrk, double * restrict rwrk, int * mm, int * kk, int * ii, in
 }
 
 
-/* strtok_r: re-entrant (threadsafe) version of strtok, helper function for tokenizing strings  */
-char *strtok_r(char *s, const char *delim, char **save_ptr)
-{
-    char *token;
-
-    if (s == NULL)
-        s = *save_ptr;
-
-    /* Scan leading delimiters.  */
-    s += strspn (s, delim);
-    if (*s == '\0')
-    {
-        *save_ptr = s;
-        return NULL;
-    }
-
-    /* Find the end of the token.  */
-    token = s;
-    s = strpbrk (token, delim);
-    if (s == NULL)
-        /* This token finishes the string.  */
-        *save_ptr = __rawmemchr (token, '\0');
-    else
-    {
-        /* Terminate the token and make *SAVE_PTR point past it.  */
-        *s = '\0';
-        *save_ptr = s + 1;
-    }
-    return token;
-}
-
-
 
 /* ckxnum... for parsing strings  */
 void CKXNUM(char * line, int * nexp, int * lout, int * nval, double * restrict rval, int * kerr, int lenline )
@@ -1431,6 +1428,28 @@ void CKRHOY(double * restrict P, double * restrict T, double * restrict y, int *
 }
 
 
+/*Compute rho = P*W(y)/RT */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho)
+{
+    for (int i=0; i<(*np); i++) {
+        rho[i] = 0.0;
+    }
+
+    for (int n=0; n<14; n++) {
+        for (int i=0; i<(*np); i++) {
+            rho[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        rho[i] = P[i] / (8.31451e+07 * T[i] * rho[i]);/*rho = P*W/(R*T) */
+    }
+
+    return;
+}
+
+
 /*Compute rho = P*W(c)/(R*T) */
 void CKRHOC(double * restrict P, double * restrict T, double * restrict c, int * iwrk, double * restrict rwrk, double * restrict rho)
 {
@@ -1497,6 +1516,29 @@ void CKMMWY(double * restrict y, int * iwrk, double * restrict rwrk, double * re
 }
 
 
+/*given y[species]: mass fractions */
+/*returns mean molecular weight (gm/mole) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm)
+{
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 0.0;
+    }
+
+    for (int n=0; n<14; n++) {
+        for (int i=0; i<(*np); i++) {
+            wtm[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 1.0 / wtm[i];
+    }
+
+    return;
+}
+
+
 /*given x[species]: mole fractions */
 /*returns mean molecular weight (gm/mole) */
 void CKMMWX(double * restrict x, int * iwrk, double * restrict rwrk, double * restrict wtm)
@@ -2147,6 +2189,30 @@ void CKCPBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CP (Eq. 34) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs)
+{
+    double tc[5], tmp[14], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cp_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<14; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cpbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean specific heat at CV (Eq. 35) */
 void CKCVBL(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict cvbl)
 {
@@ -2194,6 +2260,30 @@ void CKCVBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CV (Eq. 36) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs)
+{
+    double tc[5], tmp[14], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cv_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<14; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cvbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean enthalpy of the mixture in molar units */
 void CKHBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict hbml)
 {
@@ -2235,6 +2325,30 @@ void CKHBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns mean enthalpy of mixture in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms)
+{
+    double tc[5], tmp[14], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesEnthalpy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<14; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        hbms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mean internal energy in molar units */
 void CKUBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict ubml)
 {
@@ -2284,6 +2398,30 @@ void CKUBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*get mean internal energy in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms)
+{
+    double tc[5], tmp[14], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesInternalEnergy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<14; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        ubms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mixture entropy in molar units */
 void CKSBML(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict sbml)
 {
@@ -4158,12 +4296,60 @@ void productionRate(double * restrict wdot, double * restrict sc, double T)
 
 void comp_k_f(double * restrict tc, double invT, double * restrict k_f)
 {
+    double x[38];
 #ifdef __INTEL_COMPILER
     #pragma simd
 #endif
     for (int i=0; i<38; ++i) {
-        k_f[i] = prefactor_units[i] * fwd_A[i]
-                    * exp(fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT);
+        x[i] = fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT;
+    };
+
+    /*the exp is skipped when the exponent is zero or that of */
+    /*an earlier reaction with the same default beta and Ea */
+    k_f[0] = exp(x[0]);
+    k_f[1] = exp(x[1]);
+    k_f[2] = exp(x[2]);
+    k_f[3] = exp(x[3]);
+    k_f[4] = exp(x[4]);
+    k_f[5] = (x[5] == x[3] ? k_f[3] : exp(x[5]));
+    k_f[6] = (x[6] == x[3] ? k_f[3] : exp(x[6]));
+    k_f[7] = exp(x[7]);
+    k_f[8] = exp(x[8]);
+    k_f[9] = exp(x[9]);
+    k_f[10] = exp(x[10]);
+    k_f[11] = exp(x[11]);
+    k_f[12] = exp(x[12]);
+    k_f[13] = exp(x[13]);
+    k_f[14] = (x[14] == x[4] ? k_f[4] : exp(x[14]));
+    k_f[15] = exp(x[15]);
+    k_f[16] = exp(x[16]);
+    k_f[17] = exp(x[17]);
+    k_f[18] = (x[18] == 0.0 ? 1.0 : exp(x[18]));
+    k_f[19] = exp(x[19]);
+    k_f[20] = exp(x[20]);
+    k_f[21] = exp(x[21]);
+    k_f[22] = exp(x[22]);
+    k_f[23] = exp(x[23]);
+    k_f[24] = exp(x[24]);
+    k_f[25] = exp(x[25]);
+    k_f[26] = exp(x[26]);
+    k_f[27] = exp(x[27]);
+    k_f[28] = exp(x[28]);
+    k_f[29] = exp(x[29]);
+    k_f[30] = exp(x[30]);
+    k_f[31] = exp(x[31]);
+    k_f[32] = (x[32] == 0.0 ? 1.0 : exp(x[32]));
+    k_f[33] = (x[33] == 0.0 ? 1.0 : exp(x[33]));
+    k_f[34] = (x[34] == 0.0 ? 1.0 : exp(x[34]));
+    k_f[35] = (x[35] == 0.0 ? 1.0 : exp(x[35]));
+    k_f[36] = (x[36] == x[7] ? k_f[7] : exp(x[36]));
+    k_f[37] = exp(x[37]);
+
+#ifdef __INTEL_COMPILER
+    #pragma simd
+#endif
+    for (int i=0; i<38; ++i) {
+        k_f[i] *= prefactor_units[i] * fwd_A[i];
     };
     return;
 }
@@ -4174,68 +4360,119 @@ void comp_Kc(double * restrict tc, double invT, double * restrict Kc)
     double g_RT[14];
     gibbs(g_RT, tc);
 
-    Kc[0] = g_RT[1] - g_RT[8] + g_RT[11];
-    Kc[1] = g_RT[6] + g_RT[6] - g_RT[12];
-    Kc[2] = g_RT[5] + g_RT[10] - g_RT[13];
-    Kc[3] = -g_RT[0] + g_RT[1] + g_RT[1];
-    Kc[4] = g_RT[1] + g_RT[6] - g_RT[9];
-    Kc[5] = g_RT[1] + g_RT[5] - g_RT[6];
-    Kc[6] = g_RT[5] + g_RT[5] - g_RT[11];
-    Kc[7] = -g_RT[1] + g_RT[7] - g_RT[10];
-    Kc[8] = g_RT[1] - g_RT[5] - g_RT[6] + g_RT[11];
-    Kc[9] = g_RT[0] - g_RT[1] + g_RT[5] - g_RT[6];
-    Kc[10] = g_RT[0] - g_RT[1] + g_RT[6] - g_RT[9];
-    Kc[11] = -g_RT[5] + g_RT[6] + g_RT[6] - g_RT[9];
-    Kc[12] = g_RT[0] - g_RT[0] - g_RT[0] + g_RT[1] + g_RT[1];
-    Kc[13] = -g_RT[0] + g_RT[1] + g_RT[1] + g_RT[9] - g_RT[9];
-    Kc[14] = -g_RT[0] + g_RT[1] + g_RT[1] + g_RT[13] - g_RT[13];
-    Kc[15] = g_RT[0] - g_RT[1] - g_RT[8] + g_RT[11];
-    Kc[16] = g_RT[1] - g_RT[5] + g_RT[8] - g_RT[9];
-    Kc[17] = g_RT[1] - g_RT[6] - g_RT[6] + g_RT[8];
-    Kc[18] = g_RT[5] - g_RT[6] + g_RT[8] - g_RT[11];
-    Kc[19] = g_RT[6] + g_RT[8] - g_RT[9] - g_RT[11];
-    Kc[20] = g_RT[6] + g_RT[8] - g_RT[9] - g_RT[11];
-    Kc[21] = g_RT[8] + g_RT[8] - g_RT[11] - g_RT[12];
-    Kc[22] = g_RT[8] + g_RT[8] - g_RT[11] - g_RT[12];
-    Kc[23] = -g_RT[0] + g_RT[1] - g_RT[8] + g_RT[12];
-    Kc[24] = g_RT[1] - g_RT[6] - g_RT[9] + g_RT[12];
-    Kc[25] = g_RT[5] - g_RT[6] - g_RT[8] + g_RT[12];
-    Kc[26] = g_RT[6] - g_RT[8] - g_RT[9] + g_RT[12];
-    Kc[27] = g_RT[6] - g_RT[8] - g_RT[9] + g_RT[12];
-    Kc[28] = -g_RT[1] + g_RT[6] + g_RT[10] - g_RT[13];
-    Kc[29] = -g_RT[1] + g_RT[6] + g_RT[10] - g_RT[13];
-    Kc[30] = -g_RT[5] + g_RT[10] + g_RT[11] - g_RT[13];
-    Kc[31] = -g_RT[6] + g_RT[8] + g_RT[10] - g_RT[13];
-    Kc[32] = -g_RT[0] + g_RT[1] + g_RT[7] - g_RT[10];
-    Kc[33] = g_RT[5] - g_RT[6] + g_RT[7] - g_RT[10];
-    Kc[34] = -g_RT[1] + g_RT[5] + g_RT[7] - g_RT[13];
-    Kc[35] = g_RT[6] + g_RT[7] - g_RT[9] - g_RT[10];
-    Kc[36] = -g_RT[1] + g_RT[7] + g_RT[9] - g_RT[9] - g_RT[10];
-    Kc[37] = g_RT[7] - g_RT[8] - g_RT[10] + g_RT[11];
-
-#ifdef __INTEL_COMPILER
-     #pragma simd
-#endif
-    for (int i=0; i<38; ++i) {
-        Kc[i] = exp(Kc[i]);
-    };
-
     /*reference concentration: P_atm / (RT) in inverse mol/m^3 */
     double refC = 101325 / 8.31451 * invT;
     double refCinv = 1 / refC;
 
-    Kc[0] *= refCinv;
-    Kc[1] *= refCinv;
-    Kc[2] *= refCinv;
-    Kc[3] *= refCinv;
-    Kc[4] *= refCinv;
-    Kc[5] *= refCinv;
-    Kc[6] *= refCinv;
-    Kc[7] *= refC;
-    Kc[12] *= refCinv;
-    Kc[13] *= refCinv;
-    Kc[14] *= refCinv;
-    Kc[36] *= refC;
+    /*Kc as the ratio of the products of the species exp(g_RT)/refC, unless */
+    /*the product over a side of a reaction leaves the normal range */
+    double e_g[14], den[38];
+    for (int k=0; k<14; ++k) {
+        e_g[k] = exp(g_RT[k]) * refCinv;
+    }
+    Kc[0] = e_g[1]*e_g[11]; den[0] = e_g[8];
+    Kc[1] = e_g[6]*e_g[6]; den[1] = e_g[12];
+    Kc[2] = e_g[5]*e_g[10]; den[2] = e_g[13];
+    Kc[3] = e_g[1]*e_g[1]; den[3] = e_g[0];
+    Kc[4] = e_g[1]*e_g[6]; den[4] = e_g[9];
+    Kc[5] = e_g[1]*e_g[5]; den[5] = e_g[6];
+    Kc[6] = e_g[5]*e_g[5]; den[6] = e_g[11];
+    Kc[7] = e_g[7]; den[7] = e_g[1]*e_g[10];
+    Kc[8] = e_g[1]*e_g[11]; den[8] = e_g[5]*e_g[6];
+    Kc[9] = e_g[0]*e_g[5]; den[9] = e_g[1]*e_g[6];
+    Kc[10] = e_g[0]*e_g[6]; den[10] = e_g[1]*e_g[9];
+    Kc[11] = e_g[6]*e_g[6]; den[11] = e_g[5]*e_g[9];
+    Kc[12] = e_g[0]*e_g[1]*e_g[1]; den[12] = e_g[0]*e_g[0];
+    Kc[13] = e_g[1]*e_g[1]*e_g[9]; den[13] = e_g[0]*e_g[9];
+    Kc[14] = e_g[1]*e_g[1]*e_g[13]; den[14] = e_g[0]*e_g[13];
+    Kc[15] = e_g[0]*e_g[11]; den[15] = e_g[1]*e_g[8];
+    Kc[16] = e_g[1]*e_g[8]; den[16] = e_g[5]*e_g[9];
+    Kc[17] = e_g[1]*e_g[8]; den[17] = e_g[6]*e_g[6];
+    Kc[18] = e_g[5]*e_g[8]; den[18] = e_g[6]*e_g[11];
+    Kc[19] = e_g[6]*e_g[8]; den[19] = e_g[9]*e_g[11];
+    Kc[20] = e_g[6]*e_g[8]; den[20] = e_g[9]*e_g[11];
+    Kc[21] = e_g[8]*e_g[8]; den[21] = e_g[11]*e_g[12];
+    Kc[22] = e_g[8]*e_g[8]; den[22] = e_g[11]*e_g[12];
+    Kc[23] = e_g[1]*e_g[12]; den[23] = e_g[0]*e_g[8];
+    Kc[24] = e_g[1]*e_g[12]; den[24] = e_g[6]*e_g[9];
+    Kc[25] = e_g[5]*e_g[12]; den[25] = e_g[6]*e_g[8];
+    Kc[26] = e_g[6]*e_g[12]; den[26] = e_g[8]*e_g[9];
+    Kc[27] = e_g[6]*e_g[12]; den[27] = e_g[8]*e_g[9];
+    Kc[28] = e_g[6]*e_g[10]; den[28] = e_g[1]*e_g[13];
+    Kc[29] = e_g[6]*e_g[10]; den[29] = e_g[1]*e_g[13];
+    Kc[30] = e_g[10]*e_g[11]; den[30] = e_g[5]*e_g[13];
+    Kc[31] = e_g[8]*e_g[10]; den[31] = e_g[6]*e_g[13];
+    Kc[32] = e_g[1]*e_g[7]; den[32] = e_g[0]*e_g[10];
+    Kc[33] = e_g[5]*e_g[7]; den[33] = e_g[6]*e_g[10];
+    Kc[34] = e_g[5]*e_g[7]; den[34] = e_g[1]*e_g[13];
+    Kc[35] = e_g[6]*e_g[7]; den[35] = e_g[9]*e_g[10];
+    Kc[36] = e_g[7]*e_g[9]; den[36] = e_g[1]*e_g[9]*e_g[10];
+    Kc[37] = e_g[7]*e_g[11]; den[37] = e_g[8]*e_g[10];
+    int inrange = 1;
+    for (int i=0; i<38; ++i) {
+        inrange &= Kc[i] >= DBL_MIN && Kc[i] <= DBL_MAX && den[i] >= DBL_MIN && den[i] <= DBL_MAX;
+    }
+
+    if (inrange) {
+        for (int i=0; i<38; ++i) {
+            Kc[i] /= den[i];
+        }
+    }
+    else {
+        Kc[0] = exp(g_RT[1] - g_RT[8] + g_RT[11]);
+        Kc[1] = exp(g_RT[6] + g_RT[6] - g_RT[12]);
+        Kc[2] = exp(g_RT[5] + g_RT[10] - g_RT[13]);
+        Kc[3] = exp(-g_RT[0] + g_RT[1] + g_RT[1]);
+        Kc[4] = exp(g_RT[1] + g_RT[6] - g_RT[9]);
+        Kc[5] = exp(g_RT[1] + g_RT[5] - g_RT[6]);
+        Kc[6] = exp(g_RT[5] + g_RT[5] - g_RT[11]);
+        Kc[7] = exp(-g_RT[1] + g_RT[7] - g_RT[10]);
+        Kc[8] = exp(g_RT[1] - g_RT[5] - g_RT[6] + g_RT[11]);
+        Kc[9] = exp(g_RT[0] - g_RT[1] + g_RT[5] - g_RT[6]);
+        Kc[10] = exp(g_RT[0] - g_RT[1] + g_RT[6] - g_RT[9]);
+        Kc[11] = exp(-g_RT[5] + g_RT[6] + g_RT[6] - g_RT[9]);
+        Kc[12] = exp(g_RT[0] - g_RT[0] - g_RT[0] + g_RT[1] + g_RT[1]);
+        Kc[13] = exp(-g_RT[0] + g_RT[1] + g_RT[1] + g_RT[9] - g_RT[9]);
+        Kc[14] = exp(-g_RT[0] + g_RT[1] + g_RT[1] + g_RT[13] - g_RT[13]);
+        Kc[15] = exp(g_RT[0] - g_RT[1] - g_RT[8] + g_RT[11]);
+        Kc[16] = exp(g_RT[1] - g_RT[5] + g_RT[8] - g_RT[9]);
+        Kc[17] = exp(g_RT[1] - g_RT[6] - g_RT[6] + g_RT[8]);
+        Kc[18] = exp(g_RT[5] - g_RT[6] + g_RT[8] - g_RT[11]);
+        Kc[19] = exp(g_RT[6] + g_RT[8] - g_RT[9] - g_RT[11]);
+        Kc[21] = exp(g_RT[8] + g_RT[8] - g_RT[11] - g_RT[12]);
+        Kc[23] = exp(-g_RT[0] + g_RT[1] - g_RT[8] + g_RT[12]);
+        Kc[24] = exp(g_RT[1] - g_RT[6] - g_RT[9] + g_RT[12]);
+        Kc[25] = exp(g_RT[5] - g_RT[6] - g_RT[8] + g_RT[12]);
+        Kc[26] = exp(g_RT[6] - g_RT[8] - g_RT[9] + g_RT[12]);
+        Kc[28] = exp(-g_RT[1] + g_RT[6] + g_RT[10] - g_RT[13]);
+        Kc[30] = exp(-g_RT[5] + g_RT[10] + g_RT[11] - g_RT[13]);
+        Kc[31] = exp(-g_RT[6] + g_RT[8] + g_RT[10] - g_RT[13]);
+        Kc[32] = exp(-g_RT[0] + g_RT[1] + g_RT[7] - g_RT[10]);
+        Kc[33] = exp(g_RT[5] - g_RT[6] + g_RT[7] - g_RT[10]);
+        Kc[34] = exp(-g_RT[1] + g_RT[5] + g_RT[7] - g_RT[13]);
+        Kc[35] = exp(g_RT[6] + g_RT[7] - g_RT[9] - g_RT[10]);
+        Kc[36] = exp(-g_RT[1] + g_RT[7] + g_RT[9] - g_RT[9] - g_RT[10]);
+        Kc[37] = exp(g_RT[7] - g_RT[8] - g_RT[10] + g_RT[11]);
+
+        /*reactions with the net stoichiometry of an earlier one */
+        Kc[20] = Kc[19];
+        Kc[22] = Kc[21];
+        Kc[27] = Kc[26];
+        Kc[29] = Kc[28];
+
+        Kc[0] *= refCinv;
+        Kc[1] *= refCinv;
+        Kc[2] *= refCinv;
+        Kc[3] *= refCinv;
+        Kc[4] *= refCinv;
+        Kc[5] *= refCinv;
+        Kc[6] *= refCinv;
+        Kc[7] *= refC;
+        Kc[12] *= refCinv;
+        Kc[13] *= refCinv;
+        Kc[14] *= refCinv;
+        Kc[36] *= refC;
+    }
 
     return;
 }
@@ -4403,6 +4640,9 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         mixture += sc[i];
     }
 
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[9] + (TB[2][2] - 1)*sc[10] + (TB[2][3] - 1)*sc[13] + (TB[2][4] - 1)*sc[2] + (TB[2][5] - 1)*sc[4];
+
     double Corr[38];
     for (int i = 0; i < 38; ++i) {
         Corr[i] = 1.0;
@@ -4434,7 +4674,7 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
     /* Lindemann */
     {
         double alpha;
-        alpha = mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[9] + (TB[2][2] - 1)*sc[10] + (TB[2][3] - 1)*sc[13] + (TB[2][4] - 1)*sc[2] + (TB[2][5] - 1)*sc[4];
+        alpha = alpha_eff0;
         double redP = alpha / k_f_save[2] * phase_units[2] * low_A[2] * exp(low_beta[2] * tc[0] - activation_units[2] * low_Ea[2] * invT);
         Corr[2] = redP / (1. + redP);
     }
@@ -4446,7 +4686,7 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         Corr[3] = alpha;
         alpha = mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[9] + (TB[4][2] - 1)*sc[10] + (TB[4][3] - 1)*sc[13] + (TB[4][4] - 1)*sc[2] + (TB[4][5] - 1)*sc[4];
         Corr[4] = alpha;
-        alpha = mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[9] + (TB[5][2] - 1)*sc[10] + (TB[5][3] - 1)*sc[13] + (TB[5][4] - 1)*sc[2] + (TB[5][5] - 1)*sc[4];
+        alpha = (memcmp(TB[5], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[9] + (TB[5][2] - 1)*sc[10] + (TB[5][3] - 1)*sc[13] + (TB[5][4] - 1)*sc[2] + (TB[5][5] - 1)*sc[4]);
         Corr[5] = alpha;
         alpha = mixture + (TB[6][0] - 1)*sc[0] + (TB[6][1] - 1)*sc[9] + (TB[6][2] - 1)*sc[10] + (TB[6][3] - 1)*sc[13] + (TB[6][4] - 1)*sc[2] + (TB[6][5] - 1)*sc[4];
         Corr[6] = alpha;
@@ -5261,17 +5501,24 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         mixture += sc[k];
     }
 
-    /*compute the Gibbs free energy */
-    double g_RT[14];
-    gibbs(g_RT, tc);
-
     /*compute the species enthalpy */
     double h_RT[14];
     speciesEnthalpy(h_RT, tc);
 
+    /*compute the rate and equilibrium constants */
+    double k_f_s[38], Kc_s[38];
+    comp_k_f(tc, invT, k_f_s);
+    comp_Kc(tc, invT, Kc_s);
+
+    /*at constant volume, the part of dwdot/d[X] common to all species */
+    double Jmix[14];
+    for (int k=0; k<14; k++) {
+        Jmix[k] = 0.0;
+    }
+
     double phi_f, k_f, k_r, phi_r, Kc, q, q_nocor, Corr, alpha;
     double dlnkfdT, dlnk0dT, dlnKcdT, dkrdT, dqdT;
-    double dqdci, dcdc_fac, dqdc[14];
+    double dqdci, dcdc_fac;
     double Pr, fPr, F, k_0, logPr;
     double logFcent, troe_c, troe_n, troePr_den, troePr, troe;
     double Fcent1, Fcent2, Fcent3, Fcent;
@@ -5279,6 +5526,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     double dlogPrdT, dlogfPrdT, dlogFdT, dlogFcentdT, dlogFdlogPr, dlnCorrdT;
     const double ln10 = log(10.0);
     const double log10e = 1.0/log(10.0);
+
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[9] + (TB[2][2] - 1)*sc[10] + (TB[2][3] - 1)*sc[13] + (TB[2][4] - 1)*sc[2] + (TB[2][5] - 1)*sc[4];
+
     /*reaction 1: H + O2 (+M) <=> HO2 (+M) */
     /*a pressure-fall-off reaction */
     /* also 3-body */
@@ -5286,8 +5537,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[0][0] - 1)*sc[11] + (TB[0][1] - 1)*sc[9] + (TB[0][2] - 1)*sc[10] + (TB[0][3] - 1)*sc[13] + (TB[0][4] - 1)*sc[2] + (TB[0][5] - 1)*sc[4] + (TB[0][6] - 1)*sc[0];
     /* forward */
     phi_f = sc[1]*sc[11];
-    k_f = prefactor_units[0] * fwd_A[0]
-                * exp(fwd_beta[0] * tc[0] - activation_units[0] * fwd_Ea[0] * invT);
+    k_f = k_f_s[0];
     dlnkfdT = fwd_beta[0] * invT + activation_units[0] * fwd_Ea[0] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[0] * exp(low_beta[0] * tc[0] - activation_units[0] * low_Ea[0] * invT);
@@ -5303,16 +5553,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[0] == 4 ? exp(-troe_Tss[0] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
+      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
+      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
-      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
-      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -5320,7 +5570,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[8];
-    Kc = refCinv * exp(g_RT[1] - g_RT[8] + g_RT[11]);
+    Kc = Kc_s[0];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[11]) + (h_RT[8]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5338,74 +5588,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[0][6] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[8] += dqdci;                /* dwdot[HO2]/d[H2] */
-        J[11] -= dqdci;               /* dwdot[O2]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[11];
-        J[16] -= dqdci;               /* dwdot[H]/d[H] */
-        J[23] += dqdci;               /* dwdot[HO2]/d[H] */
-        J[26] -= dqdci;               /* dwdot[O2]/d[H] */
-        /* d()/d[AR] */
-        dqdci = (TB[0][4] - 1)*dcdc_fac;
-        J[31] -= dqdci;               /* dwdot[H]/d[AR] */
-        J[38] += dqdci;               /* dwdot[HO2]/d[AR] */
-        J[41] -= dqdci;               /* dwdot[O2]/d[AR] */
-        /* d()/d[HE] */
-        dqdci = (TB[0][5] - 1)*dcdc_fac;
-        J[61] -= dqdci;               /* dwdot[H]/d[HE] */
-        J[68] += dqdci;               /* dwdot[HO2]/d[HE] */
-        J[71] -= dqdci;               /* dwdot[O2]/d[HE] */
-        /* d()/d[HO2] */
-        dqdci =  - k_r;
-        J[121] -= dqdci;              /* dwdot[H]/d[HO2] */
-        J[128] += dqdci;              /* dwdot[HO2]/d[HO2] */
-        J[131] -= dqdci;              /* dwdot[O2]/d[HO2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[0][1] - 1)*dcdc_fac;
-        J[136] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[143] += dqdci;              /* dwdot[HO2]/d[H2O] */
-        J[146] -= dqdci;              /* dwdot[O2]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[0][2] - 1)*dcdc_fac;
-        J[151] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[158] += dqdci;              /* dwdot[HO2]/d[CO] */
-        J[161] -= dqdci;              /* dwdot[O2]/d[CO] */
-        /* d()/d[O2] */
-        dqdci = (TB[0][0] - 1)*dcdc_fac + k_f*sc[1];
-        J[166] -= dqdci;              /* dwdot[H]/d[O2] */
-        J[173] += dqdci;              /* dwdot[HO2]/d[O2] */
-        J[176] -= dqdci;              /* dwdot[O2]/d[O2] */
-        /* d()/d[CO2] */
-        dqdci = (TB[0][3] - 1)*dcdc_fac;
-        J[196] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[203] += dqdci;              /* dwdot[HO2]/d[CO2] */
-        J[206] -= dqdci;              /* dwdot[O2]/d[CO2] */
-    }
-    else {
-        dqdc[0] = TB[0][6]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[11];
-        dqdc[2] = TB[0][4]*dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[0][5]*dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac - k_r;
-        dqdc[9] = TB[0][1]*dcdc_fac;
-        dqdc[10] = TB[0][2]*dcdc_fac;
-        dqdc[11] = TB[0][0]*dcdc_fac + k_f*sc[1];
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[0][3]*dcdc_fac;
-        for (int k=0; k<14; k++) {
-            J[15*k+1] -= dqdc[k];
-            J[15*k+8] += dqdc[k];
-            J[15*k+11] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[8] += dcdc_fac;
+    Jmix[11] -= dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[0][6] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[8] += dqdci;                /* dwdot[HO2]/d[H2] */
+    J[11] -= dqdci;               /* dwdot[O2]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[11];
+    J[16] -= dqdci;               /* dwdot[H]/d[H] */
+    J[23] += dqdci;               /* dwdot[HO2]/d[H] */
+    J[26] -= dqdci;               /* dwdot[O2]/d[H] */
+    /* d()/d[AR] */
+    dqdci = (TB[0][4] - 1)*dcdc_fac;
+    J[31] -= dqdci;               /* dwdot[H]/d[AR] */
+    J[38] += dqdci;               /* dwdot[HO2]/d[AR] */
+    J[41] -= dqdci;               /* dwdot[O2]/d[AR] */
+    /* d()/d[HE] */
+    dqdci = (TB[0][5] - 1)*dcdc_fac;
+    J[61] -= dqdci;               /* dwdot[H]/d[HE] */
+    J[68] += dqdci;               /* dwdot[HO2]/d[HE] */
+    J[71] -= dqdci;               /* dwdot[O2]/d[HE] */
+    /* d()/d[HO2] */
+    dqdci =  - k_r;
+    J[121] -= dqdci;              /* dwdot[H]/d[HO2] */
+    J[128] += dqdci;              /* dwdot[HO2]/d[HO2] */
+    J[131] -= dqdci;              /* dwdot[O2]/d[HO2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[0][1] - 1)*dcdc_fac;
+    J[136] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[143] += dqdci;              /* dwdot[HO2]/d[H2O] */
+    J[146] -= dqdci;              /* dwdot[O2]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[0][2] - 1)*dcdc_fac;
+    J[151] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[158] += dqdci;              /* dwdot[HO2]/d[CO] */
+    J[161] -= dqdci;              /* dwdot[O2]/d[CO] */
+    /* d()/d[O2] */
+    dqdci = (TB[0][0] - 1)*dcdc_fac + k_f*sc[1];
+    J[166] -= dqdci;              /* dwdot[H]/d[O2] */
+    J[173] += dqdci;              /* dwdot[HO2]/d[O2] */
+    J[176] -= dqdci;              /* dwdot[O2]/d[O2] */
+    /* d()/d[CO2] */
+    dqdci = (TB[0][3] - 1)*dcdc_fac;
+    J[196] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[203] += dqdci;              /* dwdot[HO2]/d[CO2] */
+    J[206] -= dqdci;              /* dwdot[O2]/d[CO2] */
     J[211] -= dqdT; /* dwdot[H]/dT */
     J[218] += dqdT; /* dwdot[HO2]/dT */
     J[221] -= dqdT; /* dwdot[O2]/dT */
@@ -5417,8 +5648,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[1][0] - 1)*sc[0] + (TB[1][1] - 1)*sc[9] + (TB[1][2] - 1)*sc[10] + (TB[1][3] - 1)*sc[13] + (TB[1][4] - 1)*sc[2] + (TB[1][5] - 1)*sc[4];
     /* forward */
     phi_f = sc[6]*sc[6];
-    k_f = prefactor_units[1] * fwd_A[1]
-                * exp(fwd_beta[1] * tc[0] - activation_units[1] * fwd_Ea[1] * invT);
+    k_f = k_f_s[1];
     dlnkfdT = fwd_beta[1] * invT + activation_units[1] * fwd_Ea[1] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[1] * exp(low_beta[1] * tc[0] - activation_units[1] * low_Ea[1] * invT);
@@ -5434,16 +5664,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[1] == 4 ? exp(-troe_Tss[1] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
+      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
+      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
-      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
-      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -5451,7 +5681,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[12];
-    Kc = refCinv * exp(g_RT[6] + g_RT[6] - g_RT[12]);
+    Kc = Kc_s[1];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[6]) + (h_RT[12]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5468,60 +5698,41 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[1][0] - 1)*dcdc_fac;
-        J[6] += -2 * dqdci;           /* dwdot[OH]/d[H2] */
-        J[12] += dqdci;               /* dwdot[H2O2]/d[H2] */
-        /* d()/d[AR] */
-        dqdci = (TB[1][4] - 1)*dcdc_fac;
-        J[36] += -2 * dqdci;          /* dwdot[OH]/d[AR] */
-        J[42] += dqdci;               /* dwdot[H2O2]/d[AR] */
-        /* d()/d[HE] */
-        dqdci = (TB[1][5] - 1)*dcdc_fac;
-        J[66] += -2 * dqdci;          /* dwdot[OH]/d[HE] */
-        J[72] += dqdci;               /* dwdot[H2O2]/d[HE] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*2*sc[6];
-        J[96] += -2 * dqdci;          /* dwdot[OH]/d[OH] */
-        J[102] += dqdci;              /* dwdot[H2O2]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[1][1] - 1)*dcdc_fac;
-        J[141] += -2 * dqdci;         /* dwdot[OH]/d[H2O] */
-        J[147] += dqdci;              /* dwdot[H2O2]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[1][2] - 1)*dcdc_fac;
-        J[156] += -2 * dqdci;         /* dwdot[OH]/d[CO] */
-        J[162] += dqdci;              /* dwdot[H2O2]/d[CO] */
-        /* d()/d[H2O2] */
-        dqdci =  - k_r;
-        J[186] += -2 * dqdci;         /* dwdot[OH]/d[H2O2] */
-        J[192] += dqdci;              /* dwdot[H2O2]/d[H2O2] */
-        /* d()/d[CO2] */
-        dqdci = (TB[1][3] - 1)*dcdc_fac;
-        J[201] += -2 * dqdci;         /* dwdot[OH]/d[CO2] */
-        J[207] += dqdci;              /* dwdot[H2O2]/d[CO2] */
-    }
-    else {
-        dqdc[0] = TB[1][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = TB[1][4]*dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[1][5]*dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac + k_f*2*sc[6];
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = TB[1][1]*dcdc_fac;
-        dqdc[10] = TB[1][2]*dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac - k_r;
-        dqdc[13] = TB[1][3]*dcdc_fac;
-        for (int k=0; k<14; k++) {
-            J[15*k+6] += -2 * dqdc[k];
-            J[15*k+12] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[6] += -2 * dcdc_fac;
+    Jmix[12] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[1][0] - 1)*dcdc_fac;
+    J[6] += -2 * dqdci;           /* dwdot[OH]/d[H2] */
+    J[12] += dqdci;               /* dwdot[H2O2]/d[H2] */
+    /* d()/d[AR] */
+    dqdci = (TB[1][4] - 1)*dcdc_fac;
+    J[36] += -2 * dqdci;          /* dwdot[OH]/d[AR] */
+    J[42] += dqdci;               /* dwdot[H2O2]/d[AR] */
+    /* d()/d[HE] */
+    dqdci = (TB[1][5] - 1)*dcdc_fac;
+    J[66] += -2 * dqdci;          /* dwdot[OH]/d[HE] */
+    J[72] += dqdci;               /* dwdot[H2O2]/d[HE] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*2*sc[6];
+    J[96] += -2 * dqdci;          /* dwdot[OH]/d[OH] */
+    J[102] += dqdci;              /* dwdot[H2O2]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[1][1] - 1)*dcdc_fac;
+    J[141] += -2 * dqdci;         /* dwdot[OH]/d[H2O] */
+    J[147] += dqdci;              /* dwdot[H2O2]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[1][2] - 1)*dcdc_fac;
+    J[156] += -2 * dqdci;         /* dwdot[OH]/d[CO] */
+    J[162] += dqdci;              /* dwdot[H2O2]/d[CO] */
+    /* d()/d[H2O2] */
+    dqdci =  - k_r;
+    J[186] += -2 * dqdci;         /* dwdot[OH]/d[H2O2] */
+    J[192] += dqdci;              /* dwdot[H2O2]/d[H2O2] */
+    /* d()/d[CO2] */
+    dqdci = (TB[1][3] - 1)*dcdc_fac;
+    J[201] += -2 * dqdci;         /* dwdot[OH]/d[CO2] */
+    J[207] += dqdci;              /* dwdot[H2O2]/d[CO2] */
     J[216] += -2 * dqdT; /* dwdot[OH]/dT */
     J[222] += dqdT; /* dwdot[H2O2]/dT */
 
@@ -5529,11 +5740,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[9] + (TB[2][2] - 1)*sc[10] + (TB[2][3] - 1)*sc[13] + (TB[2][4] - 1)*sc[2] + (TB[2][5] - 1)*sc[4];
+    alpha = alpha_eff0;
     /* forward */
     phi_f = sc[5]*sc[10];
-    k_f = prefactor_units[2] * fwd_A[2]
-                * exp(fwd_beta[2] * tc[0] - activation_units[2] * fwd_Ea[2] * invT);
+    k_f = k_f_s[2];
     dlnkfdT = fwd_beta[2] * invT + activation_units[2] * fwd_Ea[2] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[2] * exp(low_beta[2] * tc[0] - activation_units[2] * low_Ea[2] * invT);
@@ -5548,7 +5758,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = 0.0;
     /* reverse */
     phi_r = sc[13];
-    Kc = refCinv * exp(g_RT[5] + g_RT[10] - g_RT[13]);
+    Kc = Kc_s[2];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[10]) + (h_RT[13]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5566,64 +5776,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[2][0] - 1)*dcdc_fac;
-        J[5] -= dqdci;                /* dwdot[O]/d[H2] */
-        J[10] -= dqdci;               /* dwdot[CO]/d[H2] */
-        J[13] += dqdci;               /* dwdot[CO2]/d[H2] */
-        /* d()/d[AR] */
-        dqdci = (TB[2][4] - 1)*dcdc_fac;
-        J[35] -= dqdci;               /* dwdot[O]/d[AR] */
-        J[40] -= dqdci;               /* dwdot[CO]/d[AR] */
-        J[43] += dqdci;               /* dwdot[CO2]/d[AR] */
-        /* d()/d[HE] */
-        dqdci = (TB[2][5] - 1)*dcdc_fac;
-        J[65] -= dqdci;               /* dwdot[O]/d[HE] */
-        J[70] -= dqdci;               /* dwdot[CO]/d[HE] */
-        J[73] += dqdci;               /* dwdot[CO2]/d[HE] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[10];
-        J[80] -= dqdci;               /* dwdot[O]/d[O] */
-        J[85] -= dqdci;               /* dwdot[CO]/d[O] */
-        J[88] += dqdci;               /* dwdot[CO2]/d[O] */
-        /* d()/d[H2O] */
-        dqdci = (TB[2][1] - 1)*dcdc_fac;
-        J[140] -= dqdci;              /* dwdot[O]/d[H2O] */
-        J[145] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[148] += dqdci;              /* dwdot[CO2]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[2][2] - 1)*dcdc_fac + k_f*sc[5];
-        J[155] -= dqdci;              /* dwdot[O]/d[CO] */
-        J[160] -= dqdci;              /* dwdot[CO]/d[CO] */
-        J[163] += dqdci;              /* dwdot[CO2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[2][3] - 1)*dcdc_fac - k_r;
-        J[200] -= dqdci;              /* dwdot[O]/d[CO2] */
-        J[205] -= dqdci;              /* dwdot[CO]/d[CO2] */
-        J[208] += dqdci;              /* dwdot[CO2]/d[CO2] */
-    }
-    else {
-        dqdc[0] = TB[2][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = TB[2][4]*dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[2][5]*dcdc_fac;
-        dqdc[5] = dcdc_fac + k_f*sc[10];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = TB[2][1]*dcdc_fac;
-        dqdc[10] = TB[2][2]*dcdc_fac + k_f*sc[5];
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[2][3]*dcdc_fac - k_r;
-        for (int k=0; k<14; k++) {
-            J[15*k+5] -= dqdc[k];
-            J[15*k+10] -= dqdc[k];
-            J[15*k+13] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[5] -= dcdc_fac;
+    Jmix[10] -= dcdc_fac;
+    Jmix[13] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[2][0] - 1)*dcdc_fac;
+    J[5] -= dqdci;                /* dwdot[O]/d[H2] */
+    J[10] -= dqdci;               /* dwdot[CO]/d[H2] */
+    J[13] += dqdci;               /* dwdot[CO2]/d[H2] */
+    /* d()/d[AR] */
+    dqdci = (TB[2][4] - 1)*dcdc_fac;
+    J[35] -= dqdci;               /* dwdot[O]/d[AR] */
+    J[40] -= dqdci;               /* dwdot[CO]/d[AR] */
+    J[43] += dqdci;               /* dwdot[CO2]/d[AR] */
+    /* d()/d[HE] */
+    dqdci = (TB[2][5] - 1)*dcdc_fac;
+    J[65] -= dqdci;               /* dwdot[O]/d[HE] */
+    J[70] -= dqdci;               /* dwdot[CO]/d[HE] */
+    J[73] += dqdci;               /* dwdot[CO2]/d[HE] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[10];
+    J[80] -= dqdci;               /* dwdot[O]/d[O] */
+    J[85] -= dqdci;               /* dwdot[CO]/d[O] */
+    J[88] += dqdci;               /* dwdot[CO2]/d[O] */
+    /* d()/d[H2O] */
+    dqdci = (TB[2][1] - 1)*dcdc_fac;
+    J[140] -= dqdci;              /* dwdot[O]/d[H2O] */
+    J[145] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[148] += dqdci;              /* dwdot[CO2]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[2][2] - 1)*dcdc_fac + k_f*sc[5];
+    J[155] -= dqdci;              /* dwdot[O]/d[CO] */
+    J[160] -= dqdci;              /* dwdot[CO]/d[CO] */
+    J[163] += dqdci;              /* dwdot[CO2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[2][3] - 1)*dcdc_fac - k_r;
+    J[200] -= dqdci;              /* dwdot[O]/d[CO2] */
+    J[205] -= dqdci;              /* dwdot[CO]/d[CO2] */
+    J[208] += dqdci;              /* dwdot[CO2]/d[CO2] */
     J[215] -= dqdT; /* dwdot[O]/dT */
     J[220] -= dqdT; /* dwdot[CO]/dT */
     J[223] += dqdT; /* dwdot[CO2]/dT */
@@ -5634,12 +5825,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[9] + (TB[3][2] - 1)*sc[13] + (TB[3][3] - 1)*sc[2] + (TB[3][4] - 1)*sc[4];
     /* forward */
     phi_f = sc[1]*sc[1];
-    k_f = prefactor_units[3] * fwd_A[3]
-                * exp(fwd_beta[3] * tc[0] - activation_units[3] * fwd_Ea[3] * invT);
+    k_f = k_f_s[3];
     dlnkfdT = fwd_beta[3] * invT + activation_units[3] * fwd_Ea[3] * invT2;
     /* reverse */
     phi_r = sc[0];
-    Kc = refCinv * exp(-g_RT[0] + g_RT[1] + g_RT[1]);
+    Kc = Kc_s[3];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[1]) + (h_RT[0]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5653,52 +5843,33 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[3][0] - 1)*q_nocor - k_r;
-        J[0] += dqdci;                /* dwdot[H2]/d[H2] */
-        J[1] += -2 * dqdci;           /* dwdot[H]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*2*sc[1];
-        J[15] += dqdci;               /* dwdot[H2]/d[H] */
-        J[16] += -2 * dqdci;          /* dwdot[H]/d[H] */
-        /* d()/d[AR] */
-        dqdci = (TB[3][3] - 1)*q_nocor;
-        J[30] += dqdci;               /* dwdot[H2]/d[AR] */
-        J[31] += -2 * dqdci;          /* dwdot[H]/d[AR] */
-        /* d()/d[HE] */
-        dqdci = (TB[3][4] - 1)*q_nocor;
-        J[60] += dqdci;               /* dwdot[H2]/d[HE] */
-        J[61] += -2 * dqdci;          /* dwdot[H]/d[HE] */
-        /* d()/d[H2O] */
-        dqdci = (TB[3][1] - 1)*q_nocor;
-        J[135] += dqdci;              /* dwdot[H2]/d[H2O] */
-        J[136] += -2 * dqdci;         /* dwdot[H]/d[H2O] */
-        /* d()/d[CO2] */
-        dqdci = (TB[3][2] - 1)*q_nocor;
-        J[195] += dqdci;              /* dwdot[H2]/d[CO2] */
-        J[196] += -2 * dqdci;         /* dwdot[H]/d[CO2] */
-    }
-    else {
-        dqdc[0] = TB[3][0] - k_r;
-        dqdc[1] = dcdc_fac + k_f*2*sc[1];
-        dqdc[2] = TB[3][3];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[3][4];
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = TB[3][1];
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[3][2];
-        for (int k=0; k<14; k++) {
-            J[15*k+0] += dqdc[k];
-            J[15*k+1] += -2 * dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += q_nocor;
+    Jmix[1] += -2 * q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[3][0] - 1)*q_nocor - k_r;
+    J[0] += dqdci;                /* dwdot[H2]/d[H2] */
+    J[1] += -2 * dqdci;           /* dwdot[H]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*2*sc[1];
+    J[15] += dqdci;               /* dwdot[H2]/d[H] */
+    J[16] += -2 * dqdci;          /* dwdot[H]/d[H] */
+    /* d()/d[AR] */
+    dqdci = (TB[3][3] - 1)*q_nocor;
+    J[30] += dqdci;               /* dwdot[H2]/d[AR] */
+    J[31] += -2 * dqdci;          /* dwdot[H]/d[AR] */
+    /* d()/d[HE] */
+    dqdci = (TB[3][4] - 1)*q_nocor;
+    J[60] += dqdci;               /* dwdot[H2]/d[HE] */
+    J[61] += -2 * dqdci;          /* dwdot[H]/d[HE] */
+    /* d()/d[H2O] */
+    dqdci = (TB[3][1] - 1)*q_nocor;
+    J[135] += dqdci;              /* dwdot[H2]/d[H2O] */
+    J[136] += -2 * dqdci;         /* dwdot[H]/d[H2O] */
+    /* d()/d[CO2] */
+    dqdci = (TB[3][2] - 1)*q_nocor;
+    J[195] += dqdci;              /* dwdot[H2]/d[CO2] */
+    J[196] += -2 * dqdci;         /* dwdot[H]/d[CO2] */
     J[210] += dqdT; /* dwdot[H2]/dT */
     J[211] += -2 * dqdT; /* dwdot[H]/dT */
 
@@ -5708,12 +5879,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[9] + (TB[4][2] - 1)*sc[10] + (TB[4][3] - 1)*sc[13] + (TB[4][4] - 1)*sc[2] + (TB[4][5] - 1)*sc[4];
     /* forward */
     phi_f = sc[1]*sc[6];
-    k_f = prefactor_units[4] * fwd_A[4]
-                * exp(fwd_beta[4] * tc[0] - activation_units[4] * fwd_Ea[4] * invT);
+    k_f = k_f_s[4];
     dlnkfdT = fwd_beta[4] * invT + activation_units[4] * fwd_Ea[4] * invT2;
     /* reverse */
     phi_r = sc[9];
-    Kc = refCinv * exp(g_RT[1] + g_RT[6] - g_RT[9]);
+    Kc = Kc_s[4];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[6]) + (h_RT[9]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5728,69 +5898,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[4][0] - 1)*q_nocor;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[6] -= dqdci;                /* dwdot[OH]/d[H2] */
-        J[9] += dqdci;                /* dwdot[H2O]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[6];
-        J[16] -= dqdci;               /* dwdot[H]/d[H] */
-        J[21] -= dqdci;               /* dwdot[OH]/d[H] */
-        J[24] += dqdci;               /* dwdot[H2O]/d[H] */
-        /* d()/d[AR] */
-        dqdci = (TB[4][4] - 1)*q_nocor;
-        J[31] -= dqdci;               /* dwdot[H]/d[AR] */
-        J[36] -= dqdci;               /* dwdot[OH]/d[AR] */
-        J[39] += dqdci;               /* dwdot[H2O]/d[AR] */
-        /* d()/d[HE] */
-        dqdci = (TB[4][5] - 1)*q_nocor;
-        J[61] -= dqdci;               /* dwdot[H]/d[HE] */
-        J[66] -= dqdci;               /* dwdot[OH]/d[HE] */
-        J[69] += dqdci;               /* dwdot[H2O]/d[HE] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*sc[1];
-        J[91] -= dqdci;               /* dwdot[H]/d[OH] */
-        J[96] -= dqdci;               /* dwdot[OH]/d[OH] */
-        J[99] += dqdci;               /* dwdot[H2O]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[4][1] - 1)*q_nocor - k_r;
-        J[136] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[141] -= dqdci;              /* dwdot[OH]/d[H2O] */
-        J[144] += dqdci;              /* dwdot[H2O]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[4][2] - 1)*q_nocor;
-        J[151] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[156] -= dqdci;              /* dwdot[OH]/d[CO] */
-        J[159] += dqdci;              /* dwdot[H2O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[4][3] - 1)*q_nocor;
-        J[196] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[201] -= dqdci;              /* dwdot[OH]/d[CO2] */
-        J[204] += dqdci;              /* dwdot[H2O]/d[CO2] */
-    }
-    else {
-        dqdc[0] = TB[4][0];
-        dqdc[1] = dcdc_fac + k_f*sc[6];
-        dqdc[2] = TB[4][4];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[4][5];
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac + k_f*sc[1];
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = TB[4][1] - k_r;
-        dqdc[10] = TB[4][2];
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[4][3];
-        for (int k=0; k<14; k++) {
-            J[15*k+1] -= dqdc[k];
-            J[15*k+6] -= dqdc[k];
-            J[15*k+9] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= q_nocor;
+    Jmix[6] -= q_nocor;
+    Jmix[9] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[4][0] - 1)*q_nocor;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[6] -= dqdci;                /* dwdot[OH]/d[H2] */
+    J[9] += dqdci;                /* dwdot[H2O]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[6];
+    J[16] -= dqdci;               /* dwdot[H]/d[H] */
+    J[21] -= dqdci;               /* dwdot[OH]/d[H] */
+    J[24] += dqdci;               /* dwdot[H2O]/d[H] */
+    /* d()/d[AR] */
+    dqdci = (TB[4][4] - 1)*q_nocor;
+    J[31] -= dqdci;               /* dwdot[H]/d[AR] */
+    J[36] -= dqdci;               /* dwdot[OH]/d[AR] */
+    J[39] += dqdci;               /* dwdot[H2O]/d[AR] */
+    /* d()/d[HE] */
+    dqdci = (TB[4][5] - 1)*q_nocor;
+    J[61] -= dqdci;               /* dwdot[H]/d[HE] */
+    J[66] -= dqdci;               /* dwdot[OH]/d[HE] */
+    J[69] += dqdci;               /* dwdot[H2O]/d[HE] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*sc[1];
+    J[91] -= dqdci;               /* dwdot[H]/d[OH] */
+    J[96] -= dqdci;               /* dwdot[OH]/d[OH] */
+    J[99] += dqdci;               /* dwdot[H2O]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[4][1] - 1)*q_nocor - k_r;
+    J[136] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[141] -= dqdci;              /* dwdot[OH]/d[H2O] */
+    J[144] += dqdci;              /* dwdot[H2O]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[4][2] - 1)*q_nocor;
+    J[151] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[156] -= dqdci;              /* dwdot[OH]/d[CO] */
+    J[159] += dqdci;              /* dwdot[H2O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[4][3] - 1)*q_nocor;
+    J[196] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[201] -= dqdci;              /* dwdot[OH]/d[CO2] */
+    J[204] += dqdci;              /* dwdot[H2O]/d[CO2] */
     J[211] -= dqdT; /* dwdot[H]/dT */
     J[216] -= dqdT; /* dwdot[OH]/dT */
     J[219] += dqdT; /* dwdot[H2O]/dT */
@@ -5798,15 +5949,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 6: O + H + M <=> OH + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[9] + (TB[5][2] - 1)*sc[10] + (TB[5][3] - 1)*sc[13] + (TB[5][4] - 1)*sc[2] + (TB[5][5] - 1)*sc[4];
+    alpha = (memcmp(TB[5], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[9] + (TB[5][2] - 1)*sc[10] + (TB[5][3] - 1)*sc[13] + (TB[5][4] - 1)*sc[2] + (TB[5][5] - 1)*sc[4]);
     /* forward */
     phi_f = sc[1]*sc[5];
-    k_f = prefactor_units[5] * fwd_A[5]
-                * exp(fwd_beta[5] * tc[0] - activation_units[5] * fwd_Ea[5] * invT);
+    k_f = k_f_s[5];
     dlnkfdT = fwd_beta[5] * invT + activation_units[5] * fwd_Ea[5] * invT2;
     /* reverse */
     phi_r = sc[6];
-    Kc = refCinv * exp(g_RT[1] + g_RT[5] - g_RT[6]);
+    Kc = Kc_s[5];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[5]) + (h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5821,74 +5971,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[5][0] - 1)*q_nocor;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[5] -= dqdci;                /* dwdot[O]/d[H2] */
-        J[6] += dqdci;                /* dwdot[OH]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[5];
-        J[16] -= dqdci;               /* dwdot[H]/d[H] */
-        J[20] -= dqdci;               /* dwdot[O]/d[H] */
-        J[21] += dqdci;               /* dwdot[OH]/d[H] */
-        /* d()/d[AR] */
-        dqdci = (TB[5][4] - 1)*q_nocor;
-        J[31] -= dqdci;               /* dwdot[H]/d[AR] */
-        J[35] -= dqdci;               /* dwdot[O]/d[AR] */
-        J[36] += dqdci;               /* dwdot[OH]/d[AR] */
-        /* d()/d[HE] */
-        dqdci = (TB[5][5] - 1)*q_nocor;
-        J[61] -= dqdci;               /* dwdot[H]/d[HE] */
-        J[65] -= dqdci;               /* dwdot[O]/d[HE] */
-        J[66] += dqdci;               /* dwdot[OH]/d[HE] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[1];
-        J[76] -= dqdci;               /* dwdot[H]/d[O] */
-        J[80] -= dqdci;               /* dwdot[O]/d[O] */
-        J[81] += dqdci;               /* dwdot[OH]/d[O] */
-        /* d()/d[OH] */
-        dqdci =  - k_r;
-        J[91] -= dqdci;               /* dwdot[H]/d[OH] */
-        J[95] -= dqdci;               /* dwdot[O]/d[OH] */
-        J[96] += dqdci;               /* dwdot[OH]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[5][1] - 1)*q_nocor;
-        J[136] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[140] -= dqdci;              /* dwdot[O]/d[H2O] */
-        J[141] += dqdci;              /* dwdot[OH]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[5][2] - 1)*q_nocor;
-        J[151] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[155] -= dqdci;              /* dwdot[O]/d[CO] */
-        J[156] += dqdci;              /* dwdot[OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[5][3] - 1)*q_nocor;
-        J[196] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[200] -= dqdci;              /* dwdot[O]/d[CO2] */
-        J[201] += dqdci;              /* dwdot[OH]/d[CO2] */
-    }
-    else {
-        dqdc[0] = TB[5][0];
-        dqdc[1] = dcdc_fac + k_f*sc[5];
-        dqdc[2] = TB[5][4];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[5][5];
-        dqdc[5] = dcdc_fac + k_f*sc[1];
-        dqdc[6] = dcdc_fac - k_r;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = TB[5][1];
-        dqdc[10] = TB[5][2];
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[5][3];
-        for (int k=0; k<14; k++) {
-            J[15*k+1] -= dqdc[k];
-            J[15*k+5] -= dqdc[k];
-            J[15*k+6] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= q_nocor;
+    Jmix[5] -= q_nocor;
+    Jmix[6] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[5][0] - 1)*q_nocor;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[5] -= dqdci;                /* dwdot[O]/d[H2] */
+    J[6] += dqdci;                /* dwdot[OH]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[5];
+    J[16] -= dqdci;               /* dwdot[H]/d[H] */
+    J[20] -= dqdci;               /* dwdot[O]/d[H] */
+    J[21] += dqdci;               /* dwdot[OH]/d[H] */
+    /* d()/d[AR] */
+    dqdci = (TB[5][4] - 1)*q_nocor;
+    J[31] -= dqdci;               /* dwdot[H]/d[AR] */
+    J[35] -= dqdci;               /* dwdot[O]/d[AR] */
+    J[36] += dqdci;               /* dwdot[OH]/d[AR] */
+    /* d()/d[HE] */
+    dqdci = (TB[5][5] - 1)*q_nocor;
+    J[61] -= dqdci;               /* dwdot[H]/d[HE] */
+    J[65] -= dqdci;               /* dwdot[O]/d[HE] */
+    J[66] += dqdci;               /* dwdot[OH]/d[HE] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[1];
+    J[76] -= dqdci;               /* dwdot[H]/d[O] */
+    J[80] -= dqdci;               /* dwdot[O]/d[O] */
+    J[81] += dqdci;               /* dwdot[OH]/d[O] */
+    /* d()/d[OH] */
+    dqdci =  - k_r;
+    J[91] -= dqdci;               /* dwdot[H]/d[OH] */
+    J[95] -= dqdci;               /* dwdot[O]/d[OH] */
+    J[96] += dqdci;               /* dwdot[OH]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[5][1] - 1)*q_nocor;
+    J[136] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[140] -= dqdci;              /* dwdot[O]/d[H2O] */
+    J[141] += dqdci;              /* dwdot[OH]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[5][2] - 1)*q_nocor;
+    J[151] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[155] -= dqdci;              /* dwdot[O]/d[CO] */
+    J[156] += dqdci;              /* dwdot[OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[5][3] - 1)*q_nocor;
+    J[196] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[200] -= dqdci;              /* dwdot[O]/d[CO2] */
+    J[201] += dqdci;              /* dwdot[OH]/d[CO2] */
     J[211] -= dqdT; /* dwdot[H]/dT */
     J[215] -= dqdT; /* dwdot[O]/dT */
     J[216] += dqdT; /* dwdot[OH]/dT */
@@ -5899,12 +6030,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[6][0] - 1)*sc[0] + (TB[6][1] - 1)*sc[9] + (TB[6][2] - 1)*sc[10] + (TB[6][3] - 1)*sc[13] + (TB[6][4] - 1)*sc[2] + (TB[6][5] - 1)*sc[4];
     /* forward */
     phi_f = sc[5]*sc[5];
-    k_f = prefactor_units[6] * fwd_A[6]
-                * exp(fwd_beta[6] * tc[0] - activation_units[6] * fwd_Ea[6] * invT);
+    k_f = k_f_s[6];
     dlnkfdT = fwd_beta[6] * invT + activation_units[6] * fwd_Ea[6] * invT2;
     /* reverse */
     phi_r = sc[11];
-    Kc = refCinv * exp(g_RT[5] + g_RT[5] - g_RT[11]);
+    Kc = Kc_s[6];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[5]) + (h_RT[11]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5918,60 +6048,41 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[6][0] - 1)*q_nocor;
-        J[5] += -2 * dqdci;           /* dwdot[O]/d[H2] */
-        J[11] += dqdci;               /* dwdot[O2]/d[H2] */
-        /* d()/d[AR] */
-        dqdci = (TB[6][4] - 1)*q_nocor;
-        J[35] += -2 * dqdci;          /* dwdot[O]/d[AR] */
-        J[41] += dqdci;               /* dwdot[O2]/d[AR] */
-        /* d()/d[HE] */
-        dqdci = (TB[6][5] - 1)*q_nocor;
-        J[65] += -2 * dqdci;          /* dwdot[O]/d[HE] */
-        J[71] += dqdci;               /* dwdot[O2]/d[HE] */
-        /* d()/d[O] */
-        dqdci =  + k_f*2*sc[5];
-        J[80] += -2 * dqdci;          /* dwdot[O]/d[O] */
-        J[86] += dqdci;               /* dwdot[O2]/d[O] */
-        /* d()/d[H2O] */
-        dqdci = (TB[6][1] - 1)*q_nocor;
-        J[140] += -2 * dqdci;         /* dwdot[O]/d[H2O] */
-        J[146] += dqdci;              /* dwdot[O2]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[6][2] - 1)*q_nocor;
-        J[155] += -2 * dqdci;         /* dwdot[O]/d[CO] */
-        J[161] += dqdci;              /* dwdot[O2]/d[CO] */
-        /* d()/d[O2] */
-        dqdci =  - k_r;
-        J[170] += -2 * dqdci;         /* dwdot[O]/d[O2] */
-        J[176] += dqdci;              /* dwdot[O2]/d[O2] */
-        /* d()/d[CO2] */
-        dqdci = (TB[6][3] - 1)*q_nocor;
-        J[200] += -2 * dqdci;         /* dwdot[O]/d[CO2] */
-        J[206] += dqdci;              /* dwdot[O2]/d[CO2] */
-    }
-    else {
-        dqdc[0] = TB[6][0];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = TB[6][4];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[6][5];
-        dqdc[5] = dcdc_fac + k_f*2*sc[5];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = TB[6][1];
-        dqdc[10] = TB[6][2];
-        dqdc[11] = dcdc_fac - k_r;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[6][3];
-        for (int k=0; k<14; k++) {
-            J[15*k+5] += -2 * dqdc[k];
-            J[15*k+11] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[5] += -2 * q_nocor;
+    Jmix[11] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[6][0] - 1)*q_nocor;
+    J[5] += -2 * dqdci;           /* dwdot[O]/d[H2] */
+    J[11] += dqdci;               /* dwdot[O2]/d[H2] */
+    /* d()/d[AR] */
+    dqdci = (TB[6][4] - 1)*q_nocor;
+    J[35] += -2 * dqdci;          /* dwdot[O]/d[AR] */
+    J[41] += dqdci;               /* dwdot[O2]/d[AR] */
+    /* d()/d[HE] */
+    dqdci = (TB[6][5] - 1)*q_nocor;
+    J[65] += -2 * dqdci;          /* dwdot[O]/d[HE] */
+    J[71] += dqdci;               /* dwdot[O2]/d[HE] */
+    /* d()/d[O] */
+    dqdci =  + k_f*2*sc[5];
+    J[80] += -2 * dqdci;          /* dwdot[O]/d[O] */
+    J[86] += dqdci;               /* dwdot[O2]/d[O] */
+    /* d()/d[H2O] */
+    dqdci = (TB[6][1] - 1)*q_nocor;
+    J[140] += -2 * dqdci;         /* dwdot[O]/d[H2O] */
+    J[146] += dqdci;              /* dwdot[O2]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[6][2] - 1)*q_nocor;
+    J[155] += -2 * dqdci;         /* dwdot[O]/d[CO] */
+    J[161] += dqdci;              /* dwdot[O2]/d[CO] */
+    /* d()/d[O2] */
+    dqdci =  - k_r;
+    J[170] += -2 * dqdci;         /* dwdot[O]/d[O2] */
+    J[176] += dqdci;              /* dwdot[O2]/d[O2] */
+    /* d()/d[CO2] */
+    dqdci = (TB[6][3] - 1)*q_nocor;
+    J[200] += -2 * dqdci;         /* dwdot[O]/d[CO2] */
+    J[206] += dqdci;              /* dwdot[O2]/d[CO2] */
     J[215] += -2 * dqdT; /* dwdot[O]/dT */
     J[221] += dqdT; /* dwdot[O2]/dT */
 
@@ -5981,12 +6092,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[7][0] - 1)*sc[0] + (TB[7][1] - 1)*sc[9] + (TB[7][2] - 1)*sc[10] + (TB[7][3] - 1)*sc[13];
     /* forward */
     phi_f = sc[7];
-    k_f = prefactor_units[7] * fwd_A[7]
-                * exp(fwd_beta[7] * tc[0] - activation_units[7] * fwd_Ea[7] * invT);
+    k_f = k_f_s[7];
     dlnkfdT = fwd_beta[7] * invT + activation_units[7] * fwd_Ea[7] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[10];
-    Kc = refC * exp(-g_RT[1] + g_RT[7] - g_RT[10]);
+    Kc = Kc_s[7];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7]) + (h_RT[1] + h_RT[10]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6001,59 +6111,40 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[7][0] - 1)*q_nocor;
-        J[1] += dqdci;                /* dwdot[H]/d[H2] */
-        J[7] -= dqdci;                /* dwdot[HCO]/d[H2] */
-        J[10] += dqdci;               /* dwdot[CO]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[10];
-        J[16] += dqdci;               /* dwdot[H]/d[H] */
-        J[22] -= dqdci;               /* dwdot[HCO]/d[H] */
-        J[25] += dqdci;               /* dwdot[CO]/d[H] */
-        /* d()/d[HCO] */
-        dqdci =  + k_f;
-        J[106] += dqdci;              /* dwdot[H]/d[HCO] */
-        J[112] -= dqdci;              /* dwdot[HCO]/d[HCO] */
-        J[115] += dqdci;              /* dwdot[CO]/d[HCO] */
-        /* d()/d[H2O] */
-        dqdci = (TB[7][1] - 1)*q_nocor;
-        J[136] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[142] -= dqdci;              /* dwdot[HCO]/d[H2O] */
-        J[145] += dqdci;              /* dwdot[CO]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[7][2] - 1)*q_nocor - k_r*sc[1];
-        J[151] += dqdci;              /* dwdot[H]/d[CO] */
-        J[157] -= dqdci;              /* dwdot[HCO]/d[CO] */
-        J[160] += dqdci;              /* dwdot[CO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[7][3] - 1)*q_nocor;
-        J[196] += dqdci;              /* dwdot[H]/d[CO2] */
-        J[202] -= dqdci;              /* dwdot[HCO]/d[CO2] */
-        J[205] += dqdci;              /* dwdot[CO]/d[CO2] */
-    }
-    else {
-        dqdc[0] = TB[7][0];
-        dqdc[1] = dcdc_fac - k_r*sc[10];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac + k_f;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = TB[7][1];
-        dqdc[10] = TB[7][2] - k_r*sc[1];
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[7][3];
-        for (int k=0; k<14; k++) {
-            J[15*k+1] += dqdc[k];
-            J[15*k+7] -= dqdc[k];
-            J[15*k+10] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] += q_nocor;
+    Jmix[7] -= q_nocor;
+    Jmix[10] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[7][0] - 1)*q_nocor;
+    J[1] += dqdci;                /* dwdot[H]/d[H2] */
+    J[7] -= dqdci;                /* dwdot[HCO]/d[H2] */
+    J[10] += dqdci;               /* dwdot[CO]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[10];
+    J[16] += dqdci;               /* dwdot[H]/d[H] */
+    J[22] -= dqdci;               /* dwdot[HCO]/d[H] */
+    J[25] += dqdci;               /* dwdot[CO]/d[H] */
+    /* d()/d[HCO] */
+    dqdci =  + k_f;
+    J[106] += dqdci;              /* dwdot[H]/d[HCO] */
+    J[112] -= dqdci;              /* dwdot[HCO]/d[HCO] */
+    J[115] += dqdci;              /* dwdot[CO]/d[HCO] */
+    /* d()/d[H2O] */
+    dqdci = (TB[7][1] - 1)*q_nocor;
+    J[136] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[142] -= dqdci;              /* dwdot[HCO]/d[H2O] */
+    J[145] += dqdci;              /* dwdot[CO]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[7][2] - 1)*q_nocor - k_r*sc[1];
+    J[151] += dqdci;              /* dwdot[H]/d[CO] */
+    J[157] -= dqdci;              /* dwdot[HCO]/d[CO] */
+    J[160] += dqdci;              /* dwdot[CO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[7][3] - 1)*q_nocor;
+    J[196] += dqdci;              /* dwdot[H]/d[CO2] */
+    J[202] -= dqdci;              /* dwdot[HCO]/d[CO2] */
+    J[205] += dqdci;              /* dwdot[CO]/d[CO2] */
     J[211] += dqdT; /* dwdot[H]/dT */
     J[217] -= dqdT; /* dwdot[HCO]/dT */
     J[220] += dqdT; /* dwdot[CO]/dT */
@@ -6062,12 +6153,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[11];
-    k_f = prefactor_units[8] * fwd_A[8]
-                * exp(fwd_beta[8] * tc[0] - activation_units[8] * fwd_Ea[8] * invT);
+    k_f = k_f_s[8];
     dlnkfdT = fwd_beta[8] * invT + activation_units[8] * fwd_Ea[8] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = exp(g_RT[1] - g_RT[5] - g_RT[6] + g_RT[11]);
+    Kc = Kc_s[8];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[11]) + (h_RT[5] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6113,12 +6203,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[5];
-    k_f = prefactor_units[9] * fwd_A[9]
-                * exp(fwd_beta[9] * tc[0] - activation_units[9] * fwd_Ea[9] * invT);
+    k_f = k_f_s[9];
     dlnkfdT = fwd_beta[9] * invT + activation_units[9] * fwd_Ea[9] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[6];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[5] - g_RT[6]);
+    Kc = Kc_s[9];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[5]) + (h_RT[1] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6164,12 +6253,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[6];
-    k_f = prefactor_units[10] * fwd_A[10]
-                * exp(fwd_beta[10] * tc[0] - activation_units[10] * fwd_Ea[10] * invT);
+    k_f = k_f_s[10];
     dlnkfdT = fwd_beta[10] * invT + activation_units[10] * fwd_Ea[10] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[9];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[6] - g_RT[9]);
+    Kc = Kc_s[10];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[6]) + (h_RT[1] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6215,12 +6303,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[6];
-    k_f = prefactor_units[11] * fwd_A[11]
-                * exp(fwd_beta[11] * tc[0] - activation_units[11] * fwd_Ea[11] * invT);
+    k_f = k_f_s[11];
     dlnkfdT = fwd_beta[11] * invT + activation_units[11] * fwd_Ea[11] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[9];
-    Kc = exp(-g_RT[5] + g_RT[6] + g_RT[6] - g_RT[9]);
+    Kc = Kc_s[11];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[6]) + (h_RT[5] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6255,12 +6342,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[1]*sc[1];
-    k_f = prefactor_units[12] * fwd_A[12]
-                * exp(fwd_beta[12] * tc[0] - activation_units[12] * fwd_Ea[12] * invT);
+    k_f = k_f_s[12];
     dlnkfdT = fwd_beta[12] * invT + activation_units[12] * fwd_Ea[12] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[0];
-    Kc = refCinv * exp(g_RT[0] - g_RT[0] - g_RT[0] + g_RT[1] + g_RT[1]);
+    Kc = Kc_s[12];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + 2*h_RT[1]) + (2*h_RT[0]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6286,12 +6372,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[1]*sc[9];
-    k_f = prefactor_units[13] * fwd_A[13]
-                * exp(fwd_beta[13] * tc[0] - activation_units[13] * fwd_Ea[13] * invT);
+    k_f = k_f_s[13];
     dlnkfdT = fwd_beta[13] * invT + activation_units[13] * fwd_Ea[13] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[9];
-    Kc = refCinv * exp(-g_RT[0] + g_RT[1] + g_RT[1] + g_RT[9] - g_RT[9]);
+    Kc = Kc_s[13];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[1] + h_RT[9]) + (h_RT[0] + h_RT[9]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6321,12 +6406,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[1]*sc[13];
-    k_f = prefactor_units[14] * fwd_A[14]
-                * exp(fwd_beta[14] * tc[0] - activation_units[14] * fwd_Ea[14] * invT);
+    k_f = k_f_s[14];
     dlnkfdT = fwd_beta[14] * invT + activation_units[14] * fwd_Ea[14] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[13];
-    Kc = refCinv * exp(-g_RT[0] + g_RT[1] + g_RT[1] + g_RT[13] - g_RT[13]);
+    Kc = Kc_s[14];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[1] + h_RT[13]) + (h_RT[0] + h_RT[13]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6356,12 +6440,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[11];
-    k_f = prefactor_units[15] * fwd_A[15]
-                * exp(fwd_beta[15] * tc[0] - activation_units[15] * fwd_Ea[15] * invT);
+    k_f = k_f_s[15];
     dlnkfdT = fwd_beta[15] * invT + activation_units[15] * fwd_Ea[15] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[8];
-    Kc = exp(g_RT[0] - g_RT[1] - g_RT[8] + g_RT[11]);
+    Kc = Kc_s[15];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[11]) + (h_RT[1] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6407,12 +6490,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[8];
-    k_f = prefactor_units[16] * fwd_A[16]
-                * exp(fwd_beta[16] * tc[0] - activation_units[16] * fwd_Ea[16] * invT);
+    k_f = k_f_s[16];
     dlnkfdT = fwd_beta[16] * invT + activation_units[16] * fwd_Ea[16] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[9];
-    Kc = exp(g_RT[1] - g_RT[5] + g_RT[8] - g_RT[9]);
+    Kc = Kc_s[16];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[8]) + (h_RT[5] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6458,12 +6540,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[8];
-    k_f = prefactor_units[17] * fwd_A[17]
-                * exp(fwd_beta[17] * tc[0] - activation_units[17] * fwd_Ea[17] * invT);
+    k_f = k_f_s[17];
     dlnkfdT = fwd_beta[17] * invT + activation_units[17] * fwd_Ea[17] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[6];
-    Kc = exp(g_RT[1] - g_RT[6] - g_RT[6] + g_RT[8]);
+    Kc = Kc_s[17];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[8]) + (2*h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6498,12 +6579,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[8];
-    k_f = prefactor_units[18] * fwd_A[18]
-                * exp(fwd_beta[18] * tc[0] - activation_units[18] * fwd_Ea[18] * invT);
+    k_f = k_f_s[18];
     dlnkfdT = fwd_beta[18] * invT + activation_units[18] * fwd_Ea[18] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[11];
-    Kc = exp(g_RT[5] - g_RT[6] + g_RT[8] - g_RT[11]);
+    Kc = Kc_s[18];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[8]) + (h_RT[6] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6549,12 +6629,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[8];
-    k_f = prefactor_units[19] * fwd_A[19]
-                * exp(fwd_beta[19] * tc[0] - activation_units[19] * fwd_Ea[19] * invT);
+    k_f = k_f_s[19];
     dlnkfdT = fwd_beta[19] * invT + activation_units[19] * fwd_Ea[19] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[11];
-    Kc = exp(g_RT[6] + g_RT[8] - g_RT[9] - g_RT[11]);
+    Kc = Kc_s[19];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[8]) + (h_RT[9] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6600,12 +6679,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[8];
-    k_f = prefactor_units[20] * fwd_A[20]
-                * exp(fwd_beta[20] * tc[0] - activation_units[20] * fwd_Ea[20] * invT);
+    k_f = k_f_s[20];
     dlnkfdT = fwd_beta[20] * invT + activation_units[20] * fwd_Ea[20] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[11];
-    Kc = exp(g_RT[6] + g_RT[8] - g_RT[9] - g_RT[11]);
+    Kc = Kc_s[20];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[8]) + (h_RT[9] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6651,12 +6729,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[8];
-    k_f = prefactor_units[21] * fwd_A[21]
-                * exp(fwd_beta[21] * tc[0] - activation_units[21] * fwd_Ea[21] * invT);
+    k_f = k_f_s[21];
     dlnkfdT = fwd_beta[21] * invT + activation_units[21] * fwd_Ea[21] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[12];
-    Kc = exp(g_RT[8] + g_RT[8] - g_RT[11] - g_RT[12]);
+    Kc = Kc_s[21];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[8]) + (h_RT[11] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6691,12 +6768,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[8];
-    k_f = prefactor_units[22] * fwd_A[22]
-                * exp(fwd_beta[22] * tc[0] - activation_units[22] * fwd_Ea[22] * invT);
+    k_f = k_f_s[22];
     dlnkfdT = fwd_beta[22] * invT + activation_units[22] * fwd_Ea[22] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[12];
-    Kc = exp(g_RT[8] + g_RT[8] - g_RT[11] - g_RT[12]);
+    Kc = Kc_s[22];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[8]) + (h_RT[11] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6731,12 +6807,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[12];
-    k_f = prefactor_units[23] * fwd_A[23]
-                * exp(fwd_beta[23] * tc[0] - activation_units[23] * fwd_Ea[23] * invT);
+    k_f = k_f_s[23];
     dlnkfdT = fwd_beta[23] * invT + activation_units[23] * fwd_Ea[23] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[8];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[8] + g_RT[12]);
+    Kc = Kc_s[23];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[12]) + (h_RT[0] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6782,12 +6857,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[12];
-    k_f = prefactor_units[24] * fwd_A[24]
-                * exp(fwd_beta[24] * tc[0] - activation_units[24] * fwd_Ea[24] * invT);
+    k_f = k_f_s[24];
     dlnkfdT = fwd_beta[24] * invT + activation_units[24] * fwd_Ea[24] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[9];
-    Kc = exp(g_RT[1] - g_RT[6] - g_RT[9] + g_RT[12]);
+    Kc = Kc_s[24];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[12]) + (h_RT[6] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6833,12 +6907,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[12];
-    k_f = prefactor_units[25] * fwd_A[25]
-                * exp(fwd_beta[25] * tc[0] - activation_units[25] * fwd_Ea[25] * invT);
+    k_f = k_f_s[25];
     dlnkfdT = fwd_beta[25] * invT + activation_units[25] * fwd_Ea[25] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[8];
-    Kc = exp(g_RT[5] - g_RT[6] - g_RT[8] + g_RT[12]);
+    Kc = Kc_s[25];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[12]) + (h_RT[6] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6884,12 +6957,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[12];
-    k_f = prefactor_units[26] * fwd_A[26]
-                * exp(fwd_beta[26] * tc[0] - activation_units[26] * fwd_Ea[26] * invT);
+    k_f = k_f_s[26];
     dlnkfdT = fwd_beta[26] * invT + activation_units[26] * fwd_Ea[26] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[9];
-    Kc = exp(g_RT[6] - g_RT[8] - g_RT[9] + g_RT[12]);
+    Kc = Kc_s[26];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[12]) + (h_RT[8] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6935,12 +7007,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[12];
-    k_f = prefactor_units[27] * fwd_A[27]
-                * exp(fwd_beta[27] * tc[0] - activation_units[27] * fwd_Ea[27] * invT);
+    k_f = k_f_s[27];
     dlnkfdT = fwd_beta[27] * invT + activation_units[27] * fwd_Ea[27] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[9];
-    Kc = exp(g_RT[6] - g_RT[8] - g_RT[9] + g_RT[12]);
+    Kc = Kc_s[27];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[12]) + (h_RT[8] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6986,12 +7057,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[10];
-    k_f = prefactor_units[28] * fwd_A[28]
-                * exp(fwd_beta[28] * tc[0] - activation_units[28] * fwd_Ea[28] * invT);
+    k_f = k_f_s[28];
     dlnkfdT = fwd_beta[28] * invT + activation_units[28] * fwd_Ea[28] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[13];
-    Kc = exp(-g_RT[1] + g_RT[6] + g_RT[10] - g_RT[13]);
+    Kc = Kc_s[28];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[10]) + (h_RT[1] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7037,12 +7107,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[10];
-    k_f = prefactor_units[29] * fwd_A[29]
-                * exp(fwd_beta[29] * tc[0] - activation_units[29] * fwd_Ea[29] * invT);
+    k_f = k_f_s[29];
     dlnkfdT = fwd_beta[29] * invT + activation_units[29] * fwd_Ea[29] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[13];
-    Kc = exp(-g_RT[1] + g_RT[6] + g_RT[10] - g_RT[13]);
+    Kc = Kc_s[29];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[10]) + (h_RT[1] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7088,12 +7157,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[11];
-    k_f = prefactor_units[30] * fwd_A[30]
-                * exp(fwd_beta[30] * tc[0] - activation_units[30] * fwd_Ea[30] * invT);
+    k_f = k_f_s[30];
     dlnkfdT = fwd_beta[30] * invT + activation_units[30] * fwd_Ea[30] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[13];
-    Kc = exp(-g_RT[5] + g_RT[10] + g_RT[11] - g_RT[13]);
+    Kc = Kc_s[30];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[11]) + (h_RT[5] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7139,12 +7207,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[10];
-    k_f = prefactor_units[31] * fwd_A[31]
-                * exp(fwd_beta[31] * tc[0] - activation_units[31] * fwd_Ea[31] * invT);
+    k_f = k_f_s[31];
     dlnkfdT = fwd_beta[31] * invT + activation_units[31] * fwd_Ea[31] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[13];
-    Kc = exp(-g_RT[6] + g_RT[8] + g_RT[10] - g_RT[13]);
+    Kc = Kc_s[31];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[10]) + (h_RT[6] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7190,12 +7257,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[7];
-    k_f = prefactor_units[32] * fwd_A[32]
-                * exp(fwd_beta[32] * tc[0] - activation_units[32] * fwd_Ea[32] * invT);
+    k_f = k_f_s[32];
     dlnkfdT = fwd_beta[32] * invT + activation_units[32] * fwd_Ea[32] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[10];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[7] - g_RT[10]);
+    Kc = Kc_s[32];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[7]) + (h_RT[0] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7241,12 +7307,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[7];
-    k_f = prefactor_units[33] * fwd_A[33]
-                * exp(fwd_beta[33] * tc[0] - activation_units[33] * fwd_Ea[33] * invT);
+    k_f = k_f_s[33];
     dlnkfdT = fwd_beta[33] * invT + activation_units[33] * fwd_Ea[33] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[10];
-    Kc = exp(g_RT[5] - g_RT[6] + g_RT[7] - g_RT[10]);
+    Kc = Kc_s[33];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[7]) + (h_RT[6] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7292,12 +7357,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[7];
-    k_f = prefactor_units[34] * fwd_A[34]
-                * exp(fwd_beta[34] * tc[0] - activation_units[34] * fwd_Ea[34] * invT);
+    k_f = k_f_s[34];
     dlnkfdT = fwd_beta[34] * invT + activation_units[34] * fwd_Ea[34] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[13];
-    Kc = exp(-g_RT[1] + g_RT[5] + g_RT[7] - g_RT[13]);
+    Kc = Kc_s[34];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[7]) + (h_RT[1] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7343,12 +7407,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[7];
-    k_f = prefactor_units[35] * fwd_A[35]
-                * exp(fwd_beta[35] * tc[0] - activation_units[35] * fwd_Ea[35] * invT);
+    k_f = k_f_s[35];
     dlnkfdT = fwd_beta[35] * invT + activation_units[35] * fwd_Ea[35] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[10];
-    Kc = exp(g_RT[6] + g_RT[7] - g_RT[9] - g_RT[10]);
+    Kc = Kc_s[35];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[7]) + (h_RT[9] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7394,12 +7457,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[9];
-    k_f = prefactor_units[36] * fwd_A[36]
-                * exp(fwd_beta[36] * tc[0] - activation_units[36] * fwd_Ea[36] * invT);
+    k_f = k_f_s[36];
     dlnkfdT = fwd_beta[36] * invT + activation_units[36] * fwd_Ea[36] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[9]*sc[10];
-    Kc = refC * exp(-g_RT[1] + g_RT[7] + g_RT[9] - g_RT[9] - g_RT[10]);
+    Kc = Kc_s[36];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[9]) + (h_RT[1] + h_RT[9] + h_RT[10]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7439,12 +7501,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[11];
-    k_f = prefactor_units[37] * fwd_A[37]
-                * exp(fwd_beta[37] * tc[0] - activation_units[37] * fwd_Ea[37] * invT);
+    k_f = k_f_s[37];
     dlnkfdT = fwd_beta[37] * invT + activation_units[37] * fwd_Ea[37] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[10];
-    Kc = exp(g_RT[7] - g_RT[8] - g_RT[10] + g_RT[11]);
+    Kc = Kc_s[37];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[11]) + (h_RT[8] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7498,6 +7559,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         dcvpRdT(dcRdT, tc);
         speciesInternalEnergy(e_RT, tc);
         eh_RT = &e_RT[0];
+        for (int k=0; k<14; k++) {
+            for (int m=0; m<14; m++) {
+                J[k*15+m] += Jmix[m];
+            }
+        }
     }
 
     double cmix = 0.0, ehmix = 0.0, dcmixdT=0.0, dehmixdT=0.0;
@@ -9644,6 +9710,55 @@ void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double
     *ierr = 0;
     return;
 }
+/* get temperature given enthalpy in mass units and mass fracs */
+void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int * ierr)
+{
+#ifdef CONVERGENCE
+    const int maxiter = 5000;
+    const double tol  = 1.e-12;
+#else
+    const int maxiter = 200;
+    const double tol  = 1.e-6;
+#endif
+    double hin  = *h;
+    double tmin = 250;/*max lower bound for thermo def */
+    double tmax = 4000;/*min upper bound for thermo def */
+    double h1,hmin,hmax,cp,t1,dt;
+    int i;/* loop counter */
+    CKHBMS(&tmin, y, iwrk, rwrk, &hmin);
+    CKHBMS(&tmax, y, iwrk, rwrk, &hmax);
+    if (hin < hmin) {
+        /*Linear Extrapolation below tmin */
+        CKCPBS(&tmin, y, iwrk, rwrk, &cp);
+        *t = tmin - (hmin-hin)/cp;
+        *ierr = 1;
+        return;
+    }
+    if (hin > hmax) {
+        /*Linear Extrapolation above tmax */
+        CKCPBS(&tmax, y, iwrk, rwrk, &cp);
+        *t = tmax - (hmax-hin)/cp;
+        *ierr = 1;
+        return;
+    }
+    t1 = *t;
+    if (t1 < tmin || t1 > tmax) {
+        t1 = tmin + (tmax-tmin)/(hmax-hmin)*(hin-hmin);
+    }
+    for (i = 0; i < maxiter; ++i) {
+        CKHBMS(&t1,y,iwrk,rwrk,&h1);
+        CKCPBS(&t1,y,iwrk,rwrk,&cp);
+        dt = (hin - h1) / cp;
+        if (dt > 100.) { dt = 100.; }
+        else if (dt < -100.) { dt = -100.; }
+        else if (fabs(dt) < tol) break;
+        else if (t1+dt == t1) break;
+        t1 += dt;
+    }
+    *t = t1;
+    *ierr = 0;
+    return;
+}
 
 /* End of file  */
 #if defined(BL_FORT_USE_UPPERCASE)
@@ -1,5 +1,6 @@
 
 #include <math.h>
+#include <float.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -86,7 +87,14 @@
 #define VCKPY VCKPY
 #define VCKWYR VCKWYR
 #define VCKYTX VCKYTX
+#define VCKCPBS VCKCPBS
+#define VCKCVBS VCKCVBS
+#define VCKHBMS VCKHBMS
+#define VCKUBMS VCKUBMS
+#define VCKRHOY VCKRHOY
+#define VCKMMWY VCKMMWY
 #define GET_T_GIVEN_EY GET_T_GIVEN_EY
+#define GET_T_GIVEN_HY GET_T_GIVEN_HY
 #define GET_REACTION_MAP GET_REACTION_MAP
 #elif defined(BL_FORT_USE_LOWERCASE)
 #define CKINDX ckindx
@@ -170,7 +178,14 @@
 #define VCKPY vckpy
 #define VCKWYR vckwyr
 #define VCKYTX vckytx
+#define VCKCPBS vckcpbs
+#define VCKCVBS vckcvbs
+#define VCKHBMS vckhbms
+#define VCKUBMS vckubms
+#define VCKRHOY vckrhoy
+#define VCKMMWY vckmmwy
 #define GET_T_GIVEN_EY get_t_given_ey
+#define GET_T_GIVEN_HY get_t_given_hy
 #define GET_REACTION_MAP get_reaction_map
 #elif defined(BL_FORT_USE_UNDERSCORE)
 #define CKINDX ckindx_
@@ -254,7 +269,14 @@
 #define VCKPY vckpy_
 #define VCKWYR vckwyr_
 #define VCKYTX vckytx_
+#define VCKCPBS vckcpbs_
+#define VCKCVBS vckcvbs_
+#define VCKHBMS vckhbms_
+#define VCKUBMS vckubms_
+#define VCKRHOY vckrhoy_
+#define VCKMMWY vckmmwy_
 #define GET_T_GIVEN_EY get_t_given_ey_
+#define GET_T_GIVEN_HY get_t_given_hy_
 #define GET_REACTION_MAP get_reaction_map_
 #endif
 
@@ -356,6 +378,7 @@ void DWDOT(double * restrict J, double * restrict sc, double * restrict T, int *
 void aJacobian(double * restrict J, double * restrict sc, double T, int consP);
 void dcvpRdT(double * restrict species, double * restrict tc);
 void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
+void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
 void GET_REACTION_MAP(int * restrict rmap);
 /*vector version */
 void vproductionRate(int npt, double * restrict wdot, double * restrict c, double * restrict T);
@@ -365,6 +388,12 @@ void VCKWYR(int * restrict np, double * restrict rho, double * restrict T,
             double * restrict y, int * restrict iwrk, double * restrict rwrk,
             double * restrict wdot);
 void VCKYTX(int * restrict np, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict x);
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs);
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs);
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms);
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms);
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho);
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm);
 void vcomp_k_f(int npt, double * restrict k_f_s, double * restrict tc, double * restrict invT);
 void vcomp_gibbs(int npt, double * restrict g_RT, double * restrict tc);
 void vcomp_Kc(int npt, double * restrict Kc_s, double * restrict g_RT, double * restrict invT);
@@ -862,38 +891,6 @@ void CKINDX(int * iwrk, double * restrict rwrk, int * mm, int * kk, int * ii, in
 }
 
 
-/* strtok_r: re-entrant (threadsafe) version of strtok, helper function for tokenizing strings  */
-char *strtok_r(char *s, const char *delim, char **save_ptr)
-{
-    char *token;
-
-    if (s == NULL)
-        s = *save_ptr;
-
-    /* Scan leading delimiters.  */
-    s += strspn (s, delim);
-    if (*s == '\0')
-    {
-        *save_ptr = s;
-        return NULL;
-    }
-
-    /* Find the end of the token.  */
-    token = s;
-    s = strpbrk (token, delim);
-    if (s == NULL)
-        /* This token finishes the string.  */
-        *save_ptr = __rawmemchr (token, '\0');
-    else
-    {
-        /* Terminate the token and make *SAVE_PTR point past it.  */
-        *s = '\0';
-        *save_ptr = s + 1;
-    }
-    return token;
-}
-
-
 
 /* ckxnum... for parsing strings  */
 void CKXNUM(char * line, int * nexp, int * lout, int * nval, double * restrict rval, int * kerr, int lenline )
@@ -1154,6 +1151,28 @@ void CKRHOY(double * restrict P, double * restrict T, double * restrict y, int *
 }
 
 
+/*Compute rho = P*W(y)/RT */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho)
+{
+    for (int i=0; i<(*np); i++) {
+        rho[i] = 0.0;
+    }
+
+    for (int n=0; n<9; n++) {
+        for (int i=0; i<(*np); i++) {
+            rho[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        rho[i] = P[i] / (8.31451e+07 * T[i] * rho[i]);/*rho = P*W/(R*T) */
+    }
+
+    return;
+}
+
+
 /*Compute rho = P*W(c)/(R*T) */
 void CKRHOC(double * restrict P, double * restrict T, double * restrict c, int * iwrk, double * restrict rwrk, double * restrict rho)
 {
@@ -1215,6 +1234,29 @@ void CKMMWY(double * restrict y, int * iwrk, double * restrict rwrk, double * re
 }
 
 
+/*given y[species]: mass fractions */
+/*returns mean molecular weight (gm/mole) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm)
+{
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 0.0;
+    }
+
+    for (int n=0; n<9; n++) {
+        for (int i=0; i<(*np); i++) {
+            wtm[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 1.0 / wtm[i];
+    }
+
+    return;
+}
+
+
 /*given x[species]: mole fractions */
 /*returns mean molecular weight (gm/mole) */
 void CKMMWX(double * restrict x, int * iwrk, double * restrict rwrk, double * restrict wtm)
@@ -1810,6 +1852,30 @@ void CKCPBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CP (Eq. 34) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs)
+{
+    double tc[5], tmp[9], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cp_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<9; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cpbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean specific heat at CV (Eq. 35) */
 void CKCVBL(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict cvbl)
 {
@@ -1852,6 +1918,30 @@ void CKCVBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CV (Eq. 36) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs)
+{
+    double tc[5], tmp[9], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cv_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<9; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cvbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean enthalpy of the mixture in molar units */
 void CKHBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict hbml)
 {
@@ -1893,6 +1983,30 @@ void CKHBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns mean enthalpy of mixture in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms)
+{
+    double tc[5], tmp[9], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesEnthalpy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<9; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        hbms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mean internal energy in molar units */
 void CKUBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict ubml)
 {
@@ -1937,6 +2051,30 @@ void CKUBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*get mean internal energy in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms)
+{
+    double tc[5], tmp[9], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesInternalEnergy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<9; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        ubms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mixture entropy in molar units */
 void CKSBML(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict sbml)
 {
@@ -3244,12 +3382,43 @@ void productionRate(double * restrict wdot, double * restrict sc, double T)
 
 void comp_k_f(double * restrict tc, double invT, double * restrict k_f)
 {
+    double x[21];
+#ifdef __INTEL_COMPILER
+    #pragma simd
+#endif
+    for (int i=0; i<21; ++i) {
+        x[i] = fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT;
+    };
+
+    /*the exp is skipped when the exponent is zero or that of */
+    /*an earlier reaction with the same default beta and Ea */
+    k_f[0] = exp(x[0]);
+    k_f[1] = exp(x[1]);
+    k_f[2] = exp(x[2]);
+    k_f[3] = exp(x[3]);
+    k_f[4] = exp(x[4]);
+    k_f[5] = exp(x[5]);
+    k_f[6] = exp(x[6]);
+    k_f[7] = exp(x[7]);
+    k_f[8] = exp(x[8]);
+    k_f[9] = exp(x[9]);
+    k_f[10] = exp(x[10]);
+    k_f[11] = exp(x[11]);
+    k_f[12] = (x[12] == 0.0 ? 1.0 : exp(x[12]));
+    k_f[13] = exp(x[13]);
+    k_f[14] = exp(x[14]);
+    k_f[15] = exp(x[15]);
+    k_f[16] = exp(x[16]);
+    k_f[17] = exp(x[17]);
+    k_f[18] = exp(x[18]);
+    k_f[19] = (x[19] == 0.0 ? 1.0 : exp(x[19]));
+    k_f[20] = exp(x[20]);
+
 #ifdef __INTEL_COMPILER
     #pragma simd
 #endif
     for (int i=0; i<21; ++i) {
-        k_f[i] = prefactor_units[i] * fwd_A[i]
-                    * exp(fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT);
+        k_f[i] *= prefactor_units[i] * fwd_A[i];
     };
     return;
 }
@@ -3260,45 +3429,79 @@ void comp_Kc(double * restrict tc, double invT, double * restrict Kc)
     double g_RT[9];
     gibbs(g_RT, tc);
 
-    Kc[0] = g_RT[1] + g_RT[3] - g_RT[6];
-    Kc[1] = -g_RT[5] - g_RT[5] + g_RT[7];
-    Kc[2] = g_RT[0] - g_RT[3] - g_RT[3];
-    Kc[3] = -g_RT[1] + g_RT[4] + g_RT[4];
-    Kc[4] = g_RT[3] + g_RT[4] - g_RT[5];
-    Kc[5] = -g_RT[2] + g_RT[3] + g_RT[5];
-    Kc[6] = g_RT[1] + g_RT[3] - g_RT[4] - g_RT[5];
-    Kc[7] = g_RT[0] - g_RT[3] + g_RT[4] - g_RT[5];
-    Kc[8] = g_RT[0] - g_RT[2] - g_RT[3] + g_RT[5];
-    Kc[9] = g_RT[2] + g_RT[4] - g_RT[5] - g_RT[5];
-    Kc[10] = -g_RT[0] - g_RT[1] + g_RT[3] + g_RT[6];
-    Kc[11] = g_RT[3] - g_RT[5] - g_RT[5] + g_RT[6];
-    Kc[12] = -g_RT[1] + g_RT[4] - g_RT[5] + g_RT[6];
-    Kc[13] = -g_RT[1] - g_RT[2] + g_RT[5] + g_RT[6];
-    Kc[14] = -g_RT[1] + g_RT[6] + g_RT[6] - g_RT[7];
-    Kc[15] = -g_RT[1] + g_RT[6] + g_RT[6] - g_RT[7];
-    Kc[16] = -g_RT[2] + g_RT[3] - g_RT[5] + g_RT[7];
-    Kc[17] = -g_RT[0] + g_RT[3] - g_RT[6] + g_RT[7];
-    Kc[18] = g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7];
-    Kc[19] = -g_RT[2] + g_RT[5] - g_RT[6] + g_RT[7];
-    Kc[20] = -g_RT[2] + g_RT[5] - g_RT[6] + g_RT[7];
-
-#ifdef __INTEL_COMPILER
-     #pragma simd
-#endif
-    for (int i=0; i<21; ++i) {
-        Kc[i] = exp(Kc[i]);
-    };
-
     /*reference concentration: P_atm / (RT) in inverse mol/m^3 */
     double refC = 101325 / 8.31451 * invT;
     double refCinv = 1 / refC;
 
-    Kc[0] *= refCinv;
-    Kc[1] *= refC;
-    Kc[2] *= refC;
-    Kc[3] *= refCinv;
-    Kc[4] *= refCinv;
-    Kc[5] *= refCinv;
+    /*Kc as the ratio of the products of the species exp(g_RT)/refC, unless */
+    /*the product over a side of a reaction leaves the normal range */
+    double e_g[9], den[21];
+    for (int k=0; k<9; ++k) {
+        e_g[k] = exp(g_RT[k]) * refCinv;
+    }
+    Kc[0] = e_g[1]*e_g[3]; den[0] = e_g[6];
+    Kc[1] = e_g[7]; den[1] = e_g[5]*e_g[5];
+    Kc[2] = e_g[0]; den[2] = e_g[3]*e_g[3];
+    Kc[3] = e_g[4]*e_g[4]; den[3] = e_g[1];
+    Kc[4] = e_g[3]*e_g[4]; den[4] = e_g[5];
+    Kc[5] = e_g[3]*e_g[5]; den[5] = e_g[2];
+    Kc[6] = e_g[1]*e_g[3]; den[6] = e_g[4]*e_g[5];
+    Kc[7] = e_g[0]*e_g[4]; den[7] = e_g[3]*e_g[5];
+    Kc[8] = e_g[0]*e_g[5]; den[8] = e_g[2]*e_g[3];
+    Kc[9] = e_g[2]*e_g[4]; den[9] = e_g[5]*e_g[5];
+    Kc[10] = e_g[3]*e_g[6]; den[10] = e_g[0]*e_g[1];
+    Kc[11] = e_g[3]*e_g[6]; den[11] = e_g[5]*e_g[5];
+    Kc[12] = e_g[4]*e_g[6]; den[12] = e_g[1]*e_g[5];
+    Kc[13] = e_g[5]*e_g[6]; den[13] = e_g[1]*e_g[2];
+    Kc[14] = e_g[6]*e_g[6]; den[14] = e_g[1]*e_g[7];
+    Kc[15] = e_g[6]*e_g[6]; den[15] = e_g[1]*e_g[7];
+    Kc[16] = e_g[3]*e_g[7]; den[16] = e_g[2]*e_g[5];
+    Kc[17] = e_g[3]*e_g[7]; den[17] = e_g[0]*e_g[6];
+    Kc[18] = e_g[4]*e_g[7]; den[18] = e_g[5]*e_g[6];
+    Kc[19] = e_g[5]*e_g[7]; den[19] = e_g[2]*e_g[6];
+    Kc[20] = e_g[5]*e_g[7]; den[20] = e_g[2]*e_g[6];
+    int inrange = 1;
+    for (int i=0; i<21; ++i) {
+        inrange &= Kc[i] >= DBL_MIN && Kc[i] <= DBL_MAX && den[i] >= DBL_MIN && den[i] <= DBL_MAX;
+    }
+
+    if (inrange) {
+        for (int i=0; i<21; ++i) {
+            Kc[i] /= den[i];
+        }
+    }
+    else {
+        Kc[0] = exp(g_RT[1] + g_RT[3] - g_RT[6]);
+        Kc[1] = exp(-g_RT[5] - g_RT[5] + g_RT[7]);
+        Kc[2] = exp(g_RT[0] - g_RT[3] - g_RT[3]);
+        Kc[3] = exp(-g_RT[1] + g_RT[4] + g_RT[4]);
+        Kc[4] = exp(g_RT[3] + g_RT[4] - g_RT[5]);
+        Kc[5] = exp(-g_RT[2] + g_RT[3] + g_RT[5]);
+        Kc[6] = exp(g_RT[1] + g_RT[3] - g_RT[4] - g_RT[5]);
+        Kc[7] = exp(g_RT[0] - g_RT[3] + g_RT[4] - g_RT[5]);
+        Kc[8] = exp(g_RT[0] - g_RT[2] - g_RT[3] + g_RT[5]);
+        Kc[9] = exp(g_RT[2] + g_RT[4] - g_RT[5] - g_RT[5]);
+        Kc[10] = exp(-g_RT[0] - g_RT[1] + g_RT[3] + g_RT[6]);
+        Kc[11] = exp(g_RT[3] - g_RT[5] - g_RT[5] + g_RT[6]);
+        Kc[12] = exp(-g_RT[1] + g_RT[4] - g_RT[5] + g_RT[6]);
+        Kc[13] = exp(-g_RT[1] - g_RT[2] + g_RT[5] + g_RT[6]);
+        Kc[14] = exp(-g_RT[1] + g_RT[6] + g_RT[6] - g_RT[7]);
+        Kc[16] = exp(-g_RT[2] + g_RT[3] - g_RT[5] + g_RT[7]);
+        Kc[17] = exp(-g_RT[0] + g_RT[3] - g_RT[6] + g_RT[7]);
+        Kc[18] = exp(g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7]);
+        Kc[19] = exp(-g_RT[2] + g_RT[5] - g_RT[6] + g_RT[7]);
+
+        /*reactions with the net stoichiometry of an earlier one */
+        Kc[15] = Kc[14];
+        Kc[20] = Kc[19];
+
+        Kc[0] *= refCinv;
+        Kc[1] *= refC;
+        Kc[2] *= refC;
+        Kc[3] *= refCinv;
+        Kc[4] *= refCinv;
+        Kc[5] *= refCinv;
+    }
 
     return;
 }
@@ -3398,6 +3601,9 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         mixture += sc[i];
     }
 
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[1][0] - 1)*sc[0] + (TB[1][1] - 1)*sc[2];
+
     double Corr[21];
     for (int i = 0; i < 21; ++i) {
         Corr[i] = 1.0;
@@ -3407,7 +3613,7 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
     {
         double alpha[2];
         alpha[0] = mixture + (TB[0][0] - 1)*sc[0] + (TB[0][1] - 1)*sc[2] + (TB[0][2] - 1)*sc[1];
-        alpha[1] = mixture + (TB[1][0] - 1)*sc[0] + (TB[1][1] - 1)*sc[2];
+        alpha[1] = alpha_eff0;
         for (int i=0; i<2; i++)
         {
             double redP, F, logPred, logFcent, troe_c, troe_n, troe, F_troe;
@@ -3429,13 +3635,13 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
     /* simple three-body correction */
     {
         double alpha;
-        alpha = mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[2];
+        alpha = (memcmp(TB[2], TB[1], 2*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[2]);
         Corr[2] = alpha;
-        alpha = mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[2];
+        alpha = (memcmp(TB[3], TB[1], 2*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[2]);
         Corr[3] = alpha;
-        alpha = mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[2];
+        alpha = (memcmp(TB[4], TB[1], 2*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[2]);
         Corr[4] = alpha;
-        alpha = mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[2];
+        alpha = (memcmp(TB[5], TB[1], 2*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[2]);
         Corr[5] = alpha;
     }
 
@@ -3962,17 +4168,24 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         mixture += sc[k];
     }
 
-    /*compute the Gibbs free energy */
-    double g_RT[9];
-    gibbs(g_RT, tc);
-
     /*compute the species enthalpy */
     double h_RT[9];
     speciesEnthalpy(h_RT, tc);
 
+    /*compute the rate and equilibrium constants */
+    double k_f_s[21], Kc_s[21];
+    comp_k_f(tc, invT, k_f_s);
+    comp_Kc(tc, invT, Kc_s);
+
+    /*at constant volume, the part of dwdot/d[X] common to all species */
+    double Jmix[9];
+    for (int k=0; k<9; k++) {
+        Jmix[k] = 0.0;
+    }
+
     double phi_f, k_f, k_r, phi_r, Kc, q, q_nocor, Corr, alpha;
     double dlnkfdT, dlnk0dT, dlnKcdT, dkrdT, dqdT;
-    double dqdci, dcdc_fac, dqdc[9];
+    double dqdci, dcdc_fac;
     double Pr, fPr, F, k_0, logPr;
     double logFcent, troe_c, troe_n, troePr_den, troePr, troe;
     double Fcent1, Fcent2, Fcent3, Fcent;
@@ -3980,6 +4193,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     double dlogPrdT, dlogfPrdT, dlogFdT, dlogFcentdT, dlogFdlogPr, dlnCorrdT;
     const double ln10 = log(10.0);
     const double log10e = 1.0/log(10.0);
+
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[1][0] - 1)*sc[0] + (TB[1][1] - 1)*sc[2];
+
     /*reaction 1: H + O2 (+M) <=> HO2 (+M) */
     /*a pressure-fall-off reaction */
     /* also 3-body */
@@ -3987,8 +4204,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[0][0] - 1)*sc[0] + (TB[0][1] - 1)*sc[2] + (TB[0][2] - 1)*sc[1];
     /* forward */
     phi_f = sc[1]*sc[3];
-    k_f = prefactor_units[0] * fwd_A[0]
-                * exp(fwd_beta[0] * tc[0] - activation_units[0] * fwd_Ea[0] * invT);
+    k_f = k_f_s[0];
     dlnkfdT = fwd_beta[0] * invT + activation_units[0] * fwd_Ea[0] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[0] * exp(low_beta[0] * tc[0] - activation_units[0] * low_Ea[0] * invT);
@@ -4004,16 +4220,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[0] == 4 ? exp(-troe_Tss[0] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
+      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
+      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
-      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
-      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -4021,7 +4237,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[6];
-    Kc = refCinv * exp(g_RT[1] + g_RT[3] - g_RT[6]);
+    Kc = Kc_s[0];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3]) + (h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -4039,49 +4255,35 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[0][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[O2]/d[H2] */
-        J[3] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[6] += dqdci;                /* dwdot[HO2]/d[H2] */
-        /* d()/d[O2] */
-        dqdci = (TB[0][2] - 1)*dcdc_fac + k_f*sc[3];
-        J[11] -= dqdci;               /* dwdot[O2]/d[O2] */
-        J[13] -= dqdci;               /* dwdot[H]/d[O2] */
-        J[16] += dqdci;               /* dwdot[HO2]/d[O2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[0][1] - 1)*dcdc_fac;
-        J[21] -= dqdci;               /* dwdot[O2]/d[H2O] */
-        J[23] -= dqdci;               /* dwdot[H]/d[H2O] */
-        J[26] += dqdci;               /* dwdot[HO2]/d[H2O] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[1];
-        J[31] -= dqdci;               /* dwdot[O2]/d[H] */
-        J[33] -= dqdci;               /* dwdot[H]/d[H] */
-        J[36] += dqdci;               /* dwdot[HO2]/d[H] */
-        /* d()/d[HO2] */
-        dqdci =  - k_r;
-        J[61] -= dqdci;               /* dwdot[O2]/d[HO2] */
-        J[63] -= dqdci;               /* dwdot[H]/d[HO2] */
-        J[66] += dqdci;               /* dwdot[HO2]/d[HO2] */
-    }
-    else {
-        dqdc[0] = TB[0][0]*dcdc_fac;
-        dqdc[1] = TB[0][2]*dcdc_fac + k_f*sc[3];
-        dqdc[2] = TB[0][1]*dcdc_fac;
-        dqdc[3] = dcdc_fac + k_f*sc[1];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac - k_r;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        for (int k=0; k<9; k++) {
-            J[10*k+1] -= dqdc[k];
-            J[10*k+3] -= dqdc[k];
-            J[10*k+6] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[3] -= dcdc_fac;
+    Jmix[6] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[0][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[O2]/d[H2] */
+    J[3] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[6] += dqdci;                /* dwdot[HO2]/d[H2] */
+    /* d()/d[O2] */
+    dqdci = (TB[0][2] - 1)*dcdc_fac + k_f*sc[3];
+    J[11] -= dqdci;               /* dwdot[O2]/d[O2] */
+    J[13] -= dqdci;               /* dwdot[H]/d[O2] */
+    J[16] += dqdci;               /* dwdot[HO2]/d[O2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[0][1] - 1)*dcdc_fac;
+    J[21] -= dqdci;               /* dwdot[O2]/d[H2O] */
+    J[23] -= dqdci;               /* dwdot[H]/d[H2O] */
+    J[26] += dqdci;               /* dwdot[HO2]/d[H2O] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[1];
+    J[31] -= dqdci;               /* dwdot[O2]/d[H] */
+    J[33] -= dqdci;               /* dwdot[H]/d[H] */
+    J[36] += dqdci;               /* dwdot[HO2]/d[H] */
+    /* d()/d[HO2] */
+    dqdci =  - k_r;
+    J[61] -= dqdci;               /* dwdot[O2]/d[HO2] */
+    J[63] -= dqdci;               /* dwdot[H]/d[HO2] */
+    J[66] += dqdci;               /* dwdot[HO2]/d[HO2] */
     J[91] -= dqdT; /* dwdot[O2]/dT */
     J[93] -= dqdT; /* dwdot[H]/dT */
     J[96] += dqdT; /* dwdot[HO2]/dT */
@@ -4090,11 +4292,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[1][0] - 1)*sc[0] + (TB[1][1] - 1)*sc[2];
+    alpha = alpha_eff0;
     /* forward */
     phi_f = sc[7];
-    k_f = prefactor_units[1] * fwd_A[1]
-                * exp(fwd_beta[1] * tc[0] - activation_units[1] * fwd_Ea[1] * invT);
+    k_f = k_f_s[1];
     dlnkfdT = fwd_beta[1] * invT + activation_units[1] * fwd_Ea[1] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[1] * exp(low_beta[1] * tc[0] - activation_units[1] * low_Ea[1] * invT);
@@ -4110,16 +4311,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[1] == 4 ? exp(-troe_Tss[1] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
+      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
+      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
-      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
-      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -4127,7 +4328,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[5]*sc[5];
-    Kc = refC * exp(-g_RT[5] - g_RT[5] + g_RT[7]);
+    Kc = Kc_s[1];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7]) + (2*h_RT[5]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -4144,54 +4345,39 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[1][0] - 1)*dcdc_fac;
-        J[5] += 2 * dqdci;            /* dwdot[OH]/d[H2] */
-        J[7] -= dqdci;                /* dwdot[H2O2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[1][1] - 1)*dcdc_fac;
-        J[25] += 2 * dqdci;           /* dwdot[OH]/d[H2O] */
-        J[27] -= dqdci;               /* dwdot[H2O2]/d[H2O] */
-        /* d()/d[OH] */
-        dqdci =  - k_r*2*sc[5];
-        J[55] += 2 * dqdci;           /* dwdot[OH]/d[OH] */
-        J[57] -= dqdci;               /* dwdot[H2O2]/d[OH] */
-        /* d()/d[H2O2] */
-        dqdci =  + k_f;
-        J[75] += 2 * dqdci;           /* dwdot[OH]/d[H2O2] */
-        J[77] -= dqdci;               /* dwdot[H2O2]/d[H2O2] */
-    }
-    else {
-        dqdc[0] = TB[1][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = TB[1][1]*dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac - k_r*2*sc[5];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac + k_f;
-        dqdc[8] = dcdc_fac;
-        for (int k=0; k<9; k++) {
-            J[10*k+5] += 2 * dqdc[k];
-            J[10*k+7] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[5] += 2 * dcdc_fac;
+    Jmix[7] -= dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[1][0] - 1)*dcdc_fac;
+    J[5] += 2 * dqdci;            /* dwdot[OH]/d[H2] */
+    J[7] -= dqdci;                /* dwdot[H2O2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[1][1] - 1)*dcdc_fac;
+    J[25] += 2 * dqdci;           /* dwdot[OH]/d[H2O] */
+    J[27] -= dqdci;               /* dwdot[H2O2]/d[H2O] */
+    /* d()/d[OH] */
+    dqdci =  - k_r*2*sc[5];
+    J[55] += 2 * dqdci;           /* dwdot[OH]/d[OH] */
+    J[57] -= dqdci;               /* dwdot[H2O2]/d[OH] */
+    /* d()/d[H2O2] */
+    dqdci =  + k_f;
+    J[75] += 2 * dqdci;           /* dwdot[OH]/d[H2O2] */
+    J[77] -= dqdci;               /* dwdot[H2O2]/d[H2O2] */
     J[95] += 2 * dqdT; /* dwdot[OH]/dT */
     J[97] -= dqdT; /* dwdot[H2O2]/dT */
 
     /*reaction 3: H2 + M <=> H + H + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[2];
+    alpha = (memcmp(TB[2], TB[1], 2*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[2]);
     /* forward */
     phi_f = sc[0];
-    k_f = prefactor_units[2] * fwd_A[2]
-                * exp(fwd_beta[2] * tc[0] - activation_units[2] * fwd_Ea[2] * invT);
+    k_f = k_f_s[2];
     dlnkfdT = fwd_beta[2] * invT + activation_units[2] * fwd_Ea[2] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[3];
-    Kc = refC * exp(g_RT[0] - g_RT[3] - g_RT[3]);
+    Kc = Kc_s[2];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0]) + (2*h_RT[3]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -4205,50 +4391,35 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[2][0] - 1)*q_nocor + k_f;
-        J[0] -= dqdci;                /* dwdot[H2]/d[H2] */
-        J[3] += 2 * dqdci;            /* dwdot[H]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[2][1] - 1)*q_nocor;
-        J[20] -= dqdci;               /* dwdot[H2]/d[H2O] */
-        J[23] += 2 * dqdci;           /* dwdot[H]/d[H2O] */
-        /* d()/d[H] */
-        dqdci =  - k_r*2*sc[3];
-        J[30] -= dqdci;               /* dwdot[H2]/d[H] */
-        J[33] += 2 * dqdci;           /* dwdot[H]/d[H] */
-    }
-    else {
-        dqdc[0] = TB[2][0] + k_f;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = TB[2][1];
-        dqdc[3] = dcdc_fac - k_r*2*sc[3];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        for (int k=0; k<9; k++) {
-            J[10*k+0] -= dqdc[k];
-            J[10*k+3] += 2 * dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= q_nocor;
+    Jmix[3] += 2 * q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[2][0] - 1)*q_nocor + k_f;
+    J[0] -= dqdci;                /* dwdot[H2]/d[H2] */
+    J[3] += 2 * dqdci;            /* dwdot[H]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[2][1] - 1)*q_nocor;
+    J[20] -= dqdci;               /* dwdot[H2]/d[H2O] */
+    J[23] += 2 * dqdci;           /* dwdot[H]/d[H2O] */
+    /* d()/d[H] */
+    dqdci =  - k_r*2*sc[3];
+    J[30] -= dqdci;               /* dwdot[H2]/d[H] */
+    J[33] += 2 * dqdci;           /* dwdot[H]/d[H] */
     J[90] -= dqdT; /* dwdot[H2]/dT */
     J[93] += 2 * dqdT; /* dwdot[H]/dT */
 
     /*reaction 4: O + O + M <=> O2 + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[2];
+    alpha = (memcmp(TB[3], TB[1], 2*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[2]);
     /* forward */
     phi_f = sc[4]*sc[4];
-    k_f = prefactor_units[3] * fwd_A[3]
-                * exp(fwd_beta[3] * tc[0] - activation_units[3] * fwd_Ea[3] * invT);
+    k_f = k_f_s[3];
     dlnkfdT = fwd_beta[3] * invT + activation_units[3] * fwd_Ea[3] * invT2;
     /* reverse */
     phi_r = sc[1];
-    Kc = refCinv * exp(-g_RT[1] + g_RT[4] + g_RT[4]);
+    Kc = Kc_s[3];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[4]) + (h_RT[1]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -4262,54 +4433,39 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[3][0] - 1)*q_nocor;
-        J[1] += dqdci;                /* dwdot[O2]/d[H2] */
-        J[4] += -2 * dqdci;           /* dwdot[O]/d[H2] */
-        /* d()/d[O2] */
-        dqdci =  - k_r;
-        J[11] += dqdci;               /* dwdot[O2]/d[O2] */
-        J[14] += -2 * dqdci;          /* dwdot[O]/d[O2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[3][1] - 1)*q_nocor;
-        J[21] += dqdci;               /* dwdot[O2]/d[H2O] */
-        J[24] += -2 * dqdci;          /* dwdot[O]/d[H2O] */
-        /* d()/d[O] */
-        dqdci =  + k_f*2*sc[4];
-        J[41] += dqdci;               /* dwdot[O2]/d[O] */
-        J[44] += -2 * dqdci;          /* dwdot[O]/d[O] */
-    }
-    else {
-        dqdc[0] = TB[3][0];
-        dqdc[1] = dcdc_fac - k_r;
-        dqdc[2] = TB[3][1];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac + k_f*2*sc[4];
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        for (int k=0; k<9; k++) {
-            J[10*k+1] += dqdc[k];
-            J[10*k+4] += -2 * dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] += q_nocor;
+    Jmix[4] += -2 * q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[3][0] - 1)*q_nocor;
+    J[1] += dqdci;                /* dwdot[O2]/d[H2] */
+    J[4] += -2 * dqdci;           /* dwdot[O]/d[H2] */
+    /* d()/d[O2] */
+    dqdci =  - k_r;
+    J[11] += dqdci;               /* dwdot[O2]/d[O2] */
+    J[14] += -2 * dqdci;          /* dwdot[O]/d[O2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[3][1] - 1)*q_nocor;
+    J[21] += dqdci;               /* dwdot[O2]/d[H2O] */
+    J[24] += -2 * dqdci;          /* dwdot[O]/d[H2O] */
+    /* d()/d[O] */
+    dqdci =  + k_f*2*sc[4];
+    J[41] += dqdci;               /* dwdot[O2]/d[O] */
+    J[44] += -2 * dqdci;          /* dwdot[O]/d[O] */
     J[91] += dqdT; /* dwdot[O2]/dT */
     J[94] += -2 * dqdT; /* dwdot[O]/dT */
 
     /*reaction 5: O + H + M <=> OH + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[2];
+    alpha = (memcmp(TB[4], TB[1], 2*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[2]);
     /* forward */
     phi_f = sc[3]*sc[4];
-    k_f = prefactor_units[4] * fwd_A[4]
-                * exp(fwd_beta[4] * tc[0] - activation_units[4] * fwd_Ea[4] * invT);
+    k_f = k_f_s[4];
     dlnkfdT = fwd_beta[4] * invT + activation_units[4] * fwd_Ea[4] * invT2;
     /* reverse */
     phi_r = sc[5];
-    Kc = refCinv * exp(g_RT[3] + g_RT[4] - g_RT[5]);
+    Kc = Kc_s[4];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[4]) + (h_RT[5]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -4324,49 +4480,35 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[4][0] - 1)*q_nocor;
-        J[3] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[4] -= dqdci;                /* dwdot[O]/d[H2] */
-        J[5] += dqdci;                /* dwdot[OH]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[4][1] - 1)*q_nocor;
-        J[23] -= dqdci;               /* dwdot[H]/d[H2O] */
-        J[24] -= dqdci;               /* dwdot[O]/d[H2O] */
-        J[25] += dqdci;               /* dwdot[OH]/d[H2O] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[4];
-        J[33] -= dqdci;               /* dwdot[H]/d[H] */
-        J[34] -= dqdci;               /* dwdot[O]/d[H] */
-        J[35] += dqdci;               /* dwdot[OH]/d[H] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[3];
-        J[43] -= dqdci;               /* dwdot[H]/d[O] */
-        J[44] -= dqdci;               /* dwdot[O]/d[O] */
-        J[45] += dqdci;               /* dwdot[OH]/d[O] */
-        /* d()/d[OH] */
-        dqdci =  - k_r;
-        J[53] -= dqdci;               /* dwdot[H]/d[OH] */
-        J[54] -= dqdci;               /* dwdot[O]/d[OH] */
-        J[55] += dqdci;               /* dwdot[OH]/d[OH] */
-    }
-    else {
-        dqdc[0] = TB[4][0];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = TB[4][1];
-        dqdc[3] = dcdc_fac + k_f*sc[4];
-        dqdc[4] = dcdc_fac + k_f*sc[3];
-        dqdc[5] = dcdc_fac - k_r;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        for (int k=0; k<9; k++) {
-            J[10*k+3] -= dqdc[k];
-            J[10*k+4] -= dqdc[k];
-            J[10*k+5] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] -= q_nocor;
+    Jmix[4] -= q_nocor;
+    Jmix[5] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[4][0] - 1)*q_nocor;
+    J[3] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[4] -= dqdci;                /* dwdot[O]/d[H2] */
+    J[5] += dqdci;                /* dwdot[OH]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[4][1] - 1)*q_nocor;
+    J[23] -= dqdci;               /* dwdot[H]/d[H2O] */
+    J[24] -= dqdci;               /* dwdot[O]/d[H2O] */
+    J[25] += dqdci;               /* dwdot[OH]/d[H2O] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[4];
+    J[33] -= dqdci;               /* dwdot[H]/d[H] */
+    J[34] -= dqdci;               /* dwdot[O]/d[H] */
+    J[35] += dqdci;               /* dwdot[OH]/d[H] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[3];
+    J[43] -= dqdci;               /* dwdot[H]/d[O] */
+    J[44] -= dqdci;               /* dwdot[O]/d[O] */
+    J[45] += dqdci;               /* dwdot[OH]/d[O] */
+    /* d()/d[OH] */
+    dqdci =  - k_r;
+    J[53] -= dqdci;               /* dwdot[H]/d[OH] */
+    J[54] -= dqdci;               /* dwdot[O]/d[OH] */
+    J[55] += dqdci;               /* dwdot[OH]/d[OH] */
     J[93] -= dqdT; /* dwdot[H]/dT */
     J[94] -= dqdT; /* dwdot[O]/dT */
     J[95] += dqdT; /* dwdot[OH]/dT */
@@ -4374,15 +4516,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 6: H + OH + M <=> H2O + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[2];
+    alpha = (memcmp(TB[5], TB[1], 2*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[2]);
     /* forward */
     phi_f = sc[3]*sc[5];
-    k_f = prefactor_units[5] * fwd_A[5]
-                * exp(fwd_beta[5] * tc[0] - activation_units[5] * fwd_Ea[5] * invT);
+    k_f = k_f_s[5];
     dlnkfdT = fwd_beta[5] * invT + activation_units[5] * fwd_Ea[5] * invT2;
     /* reverse */
     phi_r = sc[2];
-    Kc = refCinv * exp(-g_RT[2] + g_RT[3] + g_RT[5]);
+    Kc = Kc_s[5];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[5]) + (h_RT[2]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -4397,44 +4538,30 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[5][0] - 1)*q_nocor;
-        J[2] += dqdci;                /* dwdot[H2O]/d[H2] */
-        J[3] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[5] -= dqdci;                /* dwdot[OH]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[5][1] - 1)*q_nocor - k_r;
-        J[22] += dqdci;               /* dwdot[H2O]/d[H2O] */
-        J[23] -= dqdci;               /* dwdot[H]/d[H2O] */
-        J[25] -= dqdci;               /* dwdot[OH]/d[H2O] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[5];
-        J[32] += dqdci;               /* dwdot[H2O]/d[H] */
-        J[33] -= dqdci;               /* dwdot[H]/d[H] */
-        J[35] -= dqdci;               /* dwdot[OH]/d[H] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*sc[3];
-        J[52] += dqdci;               /* dwdot[H2O]/d[OH] */
-        J[53] -= dqdci;               /* dwdot[H]/d[OH] */
-        J[55] -= dqdci;               /* dwdot[OH]/d[OH] */
-    }
-    else {
-        dqdc[0] = TB[5][0];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = TB[5][1] - k_r;
-        dqdc[3] = dcdc_fac + k_f*sc[5];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac + k_f*sc[3];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        for (int k=0; k<9; k++) {
-            J[10*k+2] += dqdc[k];
-            J[10*k+3] -= dqdc[k];
-            J[10*k+5] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] += q_nocor;
+    Jmix[3] -= q_nocor;
+    Jmix[5] -= q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[5][0] - 1)*q_nocor;
+    J[2] += dqdci;                /* dwdot[H2O]/d[H2] */
+    J[3] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[5] -= dqdci;                /* dwdot[OH]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[5][1] - 1)*q_nocor - k_r;
+    J[22] += dqdci;               /* dwdot[H2O]/d[H2O] */
+    J[23] -= dqdci;               /* dwdot[H]/d[H2O] */
+    J[25] -= dqdci;               /* dwdot[OH]/d[H2O] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[5];
+    J[32] += dqdci;               /* dwdot[H2O]/d[H] */
+    J[33] -= dqdci;               /* dwdot[H]/d[H] */
+    J[35] -= dqdci;               /* dwdot[OH]/d[H] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*sc[3];
+    J[52] += dqdci;               /* dwdot[H2O]/d[OH] */
+    J[53] -= dqdci;               /* dwdot[H]/d[OH] */
+    J[55] -= dqdci;               /* dwdot[OH]/d[OH] */
     J[92] += dqdT; /* dwdot[H2O]/dT */
     J[93] -= dqdT; /* dwdot[H]/dT */
     J[95] -= dqdT; /* dwdot[OH]/dT */
@@ -4443,12 +4570,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3];
-    k_f = prefactor_units[6] * fwd_A[6]
-                * exp(fwd_beta[6] * tc[0] - activation_units[6] * fwd_Ea[6] * invT);
+    k_f = k_f_s[6];
     dlnkfdT = fwd_beta[6] * invT + activation_units[6] * fwd_Ea[6] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[5];
-    Kc = exp(g_RT[1] + g_RT[3] - g_RT[4] - g_RT[5]);
+    Kc = Kc_s[6];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3]) + (h_RT[4] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -4494,12 +4620,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[4];
-    k_f = prefactor_units[7] * fwd_A[7]
-                * exp(fwd_beta[7] * tc[0] - activation_units[7] * fwd_Ea[7] * invT);
+    k_f = k_f_s[7];
     dlnkfdT = fwd_beta[7] * invT + activation_units[7] * fwd_Ea[7] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[5];
-    Kc = exp(g_RT[0] - g_RT[3] + g_RT[4] - g_RT[5]);
+    Kc = Kc_s[7];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[4]) + (h_RT[3] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -4545,12 +4670,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[5];
-    k_f = prefactor_units[8] * fwd_A[8]
-                * exp(fwd_beta[8] * tc[0] - activation_units[8] * fwd_Ea[8] * invT);
+    k_f = k_f_s[8];
     dlnkfdT = fwd_beta[8] * invT + activation_units[8] * fwd_Ea[8] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[3];
-    Kc = exp(g_RT[0] - g_RT[2] - g_RT[3] + g_RT[5]);
+    Kc = Kc_s[8];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[5]) + (h_RT[2] + h_RT[3]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -4596,12 +4720,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[4];
-    k_f = prefactor_units[9] * fwd_A[9]
-                * exp(fwd_beta[9] * tc[0] - activation_units[9] * fwd_Ea[9] * invT);
+    k_f = k_f_s[9];
     dlnkfdT = fwd_beta[9] * invT + activation_units[9] * fwd_Ea[9] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[5];
-    Kc = exp(g_RT[2] + g_RT[4] - g_RT[5] - g_RT[5]);
+    Kc = Kc_s[9];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[4]) + (2*h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -4636,12 +4759,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[6];
-    k_f = prefactor_units[10] * fwd_A[10]
-                * exp(fwd_beta[10] * tc[0] - activation_units[10] * fwd_Ea[10] * invT);
+    k_f = k_f_s[10];
     dlnkfdT = fwd_beta[10] * invT + activation_units[10] * fwd_Ea[10] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[1];
-    Kc = exp(-g_RT[0] - g_RT[1] + g_RT[3] + g_RT[6]);
+    Kc = Kc_s[10];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[6]) + (h_RT[0] + h_RT[1]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -4687,12 +4809,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[6];
-    k_f = prefactor_units[11] * fwd_A[11]
-                * exp(fwd_beta[11] * tc[0] - activation_units[11] * fwd_Ea[11] * invT);
+    k_f = k_f_s[11];
     dlnkfdT = fwd_beta[11] * invT + activation_units[11] * fwd_Ea[11] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[5];
-    Kc = exp(g_RT[3] - g_RT[5] - g_RT[5] + g_RT[6]);
+    Kc = Kc_s[11];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[6]) + (2*h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -4727,12 +4848,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[6];
-    k_f = prefactor_units[12] * fwd_A[12]
-                * exp(fwd_beta[12] * tc[0] - activation_units[12] * fwd_Ea[12] * invT);
+    k_f = k_f_s[12];
     dlnkfdT = fwd_beta[12] * invT + activation_units[12] * fwd_Ea[12] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[5];
-    Kc = exp(-g_RT[1] + g_RT[4] - g_RT[5] + g_RT[6]);
+    Kc = Kc_s[12];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[6]) + (h_RT[1] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -4778,12 +4898,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[6];
-    k_f = prefactor_units[13] * fwd_A[13]
-                * exp(fwd_beta[13] * tc[0] - activation_units[13] * fwd_Ea[13] * invT);
+    k_f = k_f_s[13];
     dlnkfdT = fwd_beta[13] * invT + activation_units[13] * fwd_Ea[13] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[2];
-    Kc = exp(-g_RT[1] - g_RT[2] + g_RT[5] + g_RT[6]);
+    Kc = Kc_s[13];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[6]) + (h_RT[1] + h_RT[2]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -4829,12 +4948,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[6];
-    k_f = prefactor_units[14] * fwd_A[14]
-                * exp(fwd_beta[14] * tc[0] - activation_units[14] * fwd_Ea[14] * invT);
+    k_f = k_f_s[14];
     dlnkfdT = fwd_beta[14] * invT + activation_units[14] * fwd_Ea[14] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[7];
-    Kc = exp(-g_RT[1] + g_RT[6] + g_RT[6] - g_RT[7]);
+    Kc = Kc_s[14];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[6]) + (h_RT[1] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -4869,12 +4987,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[6];
-    k_f = prefactor_units[15] * fwd_A[15]
-                * exp(fwd_beta[15] * tc[0] - activation_units[15] * fwd_Ea[15] * invT);
+    k_f = k_f_s[15];
     dlnkfdT = fwd_beta[15] * invT + activation_units[15] * fwd_Ea[15] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[7];
-    Kc = exp(-g_RT[1] + g_RT[6] + g_RT[6] - g_RT[7]);
+    Kc = Kc_s[15];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[6]) + (h_RT[1] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -4909,12 +5026,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[7];
-    k_f = prefactor_units[16] * fwd_A[16]
-                * exp(fwd_beta[16] * tc[0] - activation_units[16] * fwd_Ea[16] * invT);
+    k_f = k_f_s[16];
     dlnkfdT = fwd_beta[16] * invT + activation_units[16] * fwd_Ea[16] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[5];
-    Kc = exp(-g_RT[2] + g_RT[3] - g_RT[5] + g_RT[7]);
+    Kc = Kc_s[16];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[7]) + (h_RT[2] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -4960,12 +5076,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[7];
-    k_f = prefactor_units[17] * fwd_A[17]
-                * exp(fwd_beta[17] * tc[0] - activation_units[17] * fwd_Ea[17] * invT);
+    k_f = k_f_s[17];
     dlnkfdT = fwd_beta[17] * invT + activation_units[17] * fwd_Ea[17] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[6];
-    Kc = exp(-g_RT[0] + g_RT[3] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[17];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[7]) + (h_RT[0] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5011,12 +5126,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[7];
-    k_f = prefactor_units[18] * fwd_A[18]
-                * exp(fwd_beta[18] * tc[0] - activation_units[18] * fwd_Ea[18] * invT);
+    k_f = k_f_s[18];
     dlnkfdT = fwd_beta[18] * invT + activation_units[18] * fwd_Ea[18] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[18];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[7]) + (h_RT[5] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5062,12 +5176,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[7];
-    k_f = prefactor_units[19] * fwd_A[19]
-                * exp(fwd_beta[19] * tc[0] - activation_units[19] * fwd_Ea[19] * invT);
+    k_f = k_f_s[19];
     dlnkfdT = fwd_beta[19] * invT + activation_units[19] * fwd_Ea[19] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[6];
-    Kc = exp(-g_RT[2] + g_RT[5] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[19];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[7]) + (h_RT[2] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5113,12 +5226,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[7];
-    k_f = prefactor_units[20] * fwd_A[20]
-                * exp(fwd_beta[20] * tc[0] - activation_units[20] * fwd_Ea[20] * invT);
+    k_f = k_f_s[20];
     dlnkfdT = fwd_beta[20] * invT + activation_units[20] * fwd_Ea[20] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[6];
-    Kc = exp(-g_RT[2] + g_RT[5] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[20];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[7]) + (h_RT[2] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -5172,6 +5284,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         dcvpRdT(dcRdT, tc);
         speciesInternalEnergy(e_RT, tc);
         eh_RT = &e_RT[0];
+        for (int k=0; k<9; k++) {
+            for (int m=0; m<9; m++) {
+                J[k*10+m] += Jmix[m];
+            }
+        }
     }
 
     double cmix = 0.0, ehmix = 0.0, dcmixdT=0.0, dehmixdT=0.0;
@@ -6639,6 +6756,55 @@ void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double
     *ierr = 0;
     return;
 }
+/* get temperature given enthalpy in mass units and mass fracs */
+void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int * ierr)
+{
+#ifdef CONVERGENCE
+    const int maxiter = 5000;
+    const double tol  = 1.e-12;
+#else
+    const int maxiter = 200;
+    const double tol  = 1.e-6;
+#endif
+    double hin  = *h;
+    double tmin = 250;/*max lower bound for thermo def */
+    double tmax = 4000;/*min upper bound for thermo def */
+    double h1,hmin,hmax,cp,t1,dt;
+    int i;/* loop counter */
+    CKHBMS(&tmin, y, iwrk, rwrk, &hmin);
+    CKHBMS(&tmax, y, iwrk, rwrk, &hmax);
+    if (hin < hmin) {
+        /*Linear Extrapolation below tmin */
+        CKCPBS(&tmin, y, iwrk, rwrk, &cp);
+        *t = tmin - (hmin-hin)/cp;
+        *ierr = 1;
+        return;
+    }
+    if (hin > hmax) {
+        /*Linear Extrapolation above tmax */
+        CKCPBS(&tmax, y, iwrk, rwrk, &cp);
+        *t = tmax - (hmax-hin)/cp;
+        *ierr = 1;
+        return;
+    }
+    t1 = *t;
+    if (t1 < tmin || t1 > tmax) {
+        t1 = tmin + (tmax-tmin)/(hmax-hmin)*(hin-hmin);
+    }
+    for (i = 0; i < maxiter; ++i) {
+        CKHBMS(&t1,y,iwrk,rwrk,&h1);
+        CKCPBS(&t1,y,iwrk,rwrk,&cp);
+        dt = (hin - h1) / cp;
+        if (dt > 100.) { dt = 100.; }
+        else if (dt < -100.) { dt = -100.; }
+        else if (fabs(dt) < tol) break;
+        else if (t1+dt == t1) break;
+        t1 += dt;
+    }
+    *t = t1;
+    *ierr = 0;
+    return;
+}
 
 /* End of file  */
 #if defined(BL_FORT_USE_UPPERCASE)
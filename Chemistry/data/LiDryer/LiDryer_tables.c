@@ -0,0 +1,5940 @@
+
+#include <math.h>
+#include <float.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#if defined(BL_FORT_USE_UPPERCASE)
+#define CKINDX CKINDX
+#define CKINIT CKINIT
+#define CKFINALIZE CKFINALIZE
+#define CKXNUM CKXNUM
+#define CKSYME CKSYME
+#define CKSYMS CKSYMS
+#define CKRP CKRP
+#define CKPX CKPX
+#define CKPY CKPY
+#define CKPC CKPC
+#define CKRHOX CKRHOX
+#define CKRHOY CKRHOY
+#define CKRHOC CKRHOC
+#define CKWT CKWT
+#define CKAWT CKAWT
+#define CKMMWY CKMMWY
+#define CKMMWX CKMMWX
+#define CKMMWC CKMMWC
+#define CKYTX CKYTX
+#define CKYTCP CKYTCP
+#define CKYTCR CKYTCR
+#define CKXTY CKXTY
+#define CKXTCP CKXTCP
+#define CKXTCR CKXTCR
+#define CKCTX CKCTX
+#define CKCTY CKCTY
+#define CKCPOR CKCPOR
+#define CKHORT CKHORT
+#define CKSOR CKSOR
+#define CKCVML CKCVML
+#define CKCPML CKCPML
+#define CKUML CKUML
+#define CKHML CKHML
+#define CKGML CKGML
+#define CKAML CKAML
+#define CKSML CKSML
+#define CKCVMS CKCVMS
+#define CKCPMS CKCPMS
+#define CKUMS CKUMS
+#define CKHMS CKHMS
+#define CKGMS CKGMS
+#define CKAMS CKAMS
+#define CKSMS CKSMS
+#define CKCPBL CKCPBL
+#define CKCPBS CKCPBS
+#define CKCVBL CKCVBL
+#define CKCVBS CKCVBS
+#define CKHBML CKHBML
+#define CKHBMS CKHBMS
+#define CKUBML CKUBML
+#define CKUBMS CKUBMS
+#define CKSBML CKSBML
+#define CKSBMS CKSBMS
+#define CKGBML CKGBML
+#define CKGBMS CKGBMS
+#define CKABML CKABML
+#define CKABMS CKABMS
+#define CKWC CKWC
+#define CKWYP CKWYP
+#define CKWXP CKWXP
+#define CKWYR CKWYR
+#define CKWXR CKWXR
+#define CKQC CKQC
+#define CKKFKR CKKFKR
+#define CKQYP CKQYP
+#define CKQXP CKQXP
+#define CKQYR CKQYR
+#define CKQXR CKQXR
+#define CKNU CKNU
+#define CKNCF CKNCF
+#define CKABE CKABE
+#define CKEQC CKEQC
+#define CKEQYP CKEQYP
+#define CKEQXP CKEQXP
+#define CKEQYR CKEQYR
+#define CKEQXR CKEQXR
+#define DWDOT DWDOT
+#define VCKHMS VCKHMS
+#define VCKPY VCKPY
+#define VCKWYR VCKWYR
+#define VCKYTX VCKYTX
+#define VCKCPBS VCKCPBS
+#define VCKCVBS VCKCVBS
+#define VCKHBMS VCKHBMS
+#define VCKUBMS VCKUBMS
+#define VCKRHOY VCKRHOY
+#define VCKMMWY VCKMMWY
+#define GET_T_GIVEN_EY GET_T_GIVEN_EY
+#define GET_T_GIVEN_HY GET_T_GIVEN_HY
+#define GET_REACTION_MAP GET_REACTION_MAP
+#elif defined(BL_FORT_USE_LOWERCASE)
+#define CKINDX ckindx
+#define CKINIT ckinit
+#define CKFINALIZE ckfinalize
+#define CKXNUM ckxnum
+#define CKSYME cksyme
+#define CKSYMS cksyms
+#define CKRP ckrp
+#define CKPX ckpx
+#define CKPY ckpy
+#define CKPC ckpc
+#define CKRHOX ckrhox
+#define CKRHOY ckrhoy
+#define CKRHOC ckrhoc
+#define CKWT ckwt
+#define CKAWT ckawt
+#define CKMMWY ckmmwy
+#define CKMMWX ckmmwx
+#define CKMMWC ckmmwc
+#define CKYTX ckytx
+#define CKYTCP ckytcp
+#define CKYTCR ckytcr
+#define CKXTY ckxty
+#define CKXTCP ckxtcp
+#define CKXTCR ckxtcr
+#define CKCTX ckctx
+#define CKCTY ckcty
+#define CKCPOR ckcpor
+#define CKHORT ckhort
+#define CKSOR cksor
+#define CKCVML ckcvml
+#define CKCPML ckcpml
+#define CKUML ckuml
+#define CKHML ckhml
+#define CKGML ckgml
+#define CKAML ckaml
+#define CKSML cksml
+#define CKCVMS ckcvms
+#define CKCPMS ckcpms
+#define CKUMS ckums
+#define CKHMS ckhms
+#define CKGMS ckgms
+#define CKAMS ckams
+#define CKSMS cksms
+#define CKCPBL ckcpbl
+#define CKCPBS ckcpbs
+#define CKCVBL ckcvbl
+#define CKCVBS ckcvbs
+#define CKHBML ckhbml
+#define CKHBMS ckhbms
+#define CKUBML ckubml
+#define CKUBMS ckubms
+#define CKSBML cksbml
+#define CKSBMS cksbms
+#define CKGBML ckgbml
+#define CKGBMS ckgbms
+#define CKABML ckabml
+#define CKABMS ckabms
+#define CKWC ckwc
+#define CKWYP ckwyp
+#define CKWXP ckwxp
+#define CKWYR ckwyr
+#define CKWXR ckwxr
+#define CKQC ckqc
+#define CKKFKR ckkfkr
+#define CKQYP ckqyp
+#define CKQXP ckqxp
+#define CKQYR ckqyr
+#define CKQXR ckqxr
+#define CKNU cknu
+#define CKNCF ckncf
+#define CKABE ckabe
+#define CKEQC ckeqc
+#define CKEQYP ckeqyp
+#define CKEQXP ckeqxp
+#define CKEQYR ckeqyr
+#define CKEQXR ckeqxr
+#define DWDOT dwdot
+#define VCKHMS vckhms
+#define VCKPY vckpy
+#define VCKWYR vckwyr
+#define VCKYTX vckytx
+#define VCKCPBS vckcpbs
+#define VCKCVBS vckcvbs
+#define VCKHBMS vckhbms
+#define VCKUBMS vckubms
+#define VCKRHOY vckrhoy
+#define VCKMMWY vckmmwy
+#define GET_T_GIVEN_EY get_t_given_ey
+#define GET_T_GIVEN_HY get_t_given_hy
+#define GET_REACTION_MAP get_reaction_map
+#elif defined(BL_FORT_USE_UNDERSCORE)
+#define CKINDX ckindx_
+#define CKINIT ckinit_
+#define CKFINALIZE ckfinalize_
+#define CKXNUM ckxnum_
+#define CKSYME cksyme_
+#define CKSYMS cksyms_
+#define CKRP ckrp_
+#define CKPX ckpx_
+#define CKPY ckpy_
+#define CKPC ckpc_
+#define CKRHOX ckrhox_
+#define CKRHOY ckrhoy_
+#define CKRHOC ckrhoc_
+#define CKWT ckwt_
+#define CKAWT ckawt_
+#define CKMMWY ckmmwy_
+#define CKMMWX ckmmwx_
+#define CKMMWC ckmmwc_
+#define CKYTX ckytx_
+#define CKYTCP ckytcp_
+#define CKYTCR ckytcr_
+#define CKXTY ckxty_
+#define CKXTCP ckxtcp_
+#define CKXTCR ckxtcr_
+#define CKCTX ckctx_
+#define CKCTY ckcty_
+#define CKCPOR ckcpor_
+#define CKHORT ckhort_
+#define CKSOR cksor_
+#define CKCVML ckcvml_
+#define CKCPML ckcpml_
+#define CKUML ckuml_
+#define CKHML ckhml_
+#define CKGML ckgml_
+#define CKAML ckaml_
+#define CKSML cksml_
+#define CKCVMS ckcvms_
+#define CKCPMS ckcpms_
+#define CKUMS ckums_
+#define CKHMS ckhms_
+#define CKGMS ckgms_
+#define CKAMS ckams_
+#define CKSMS cksms_
+#define CKCPBL ckcpbl_
+#define CKCPBS ckcpbs_
+#define CKCVBL ckcvbl_
+#define CKCVBS ckcvbs_
+#define CKHBML ckhbml_
+#define CKHBMS ckhbms_
+#define CKUBML ckubml_
+#define CKUBMS ckubms_
+#define CKSBML cksbml_
+#define CKSBMS cksbms_
+#define CKGBML ckgbml_
+#define CKGBMS ckgbms_
+#define CKABML ckabml_
+#define CKABMS ckabms_
+#define CKWC ckwc_
+#define CKWYP ckwyp_
+#define CKWXP ckwxp_
+#define CKWYR ckwyr_
+#define CKWXR ckwxr_
+#define CKQC ckqc_
+#define CKKFKR ckkfkr_
+#define CKQYP ckqyp_
+#define CKQXP ckqxp_
+#define CKQYR ckqyr_
+#define CKQXR ckqxr_
+#define CKNU cknu_
+#define CKNCF ckncf_
+#define CKABE ckabe_
+#define CKEQC ckeqc_
+#define CKEQYP ckeqyp_
+#define CKEQXP ckeqxp_
+#define CKEQYR ckeqyr_
+#define CKEQXR ckeqxr_
+#define DWDOT dwdot_
+#define VCKHMS vckhms_
+#define VCKPY vckpy_
+#define VCKWYR vckwyr_
+#define VCKYTX vckytx_
+#define VCKCPBS vckcpbs_
+#define VCKCVBS vckcvbs_
+#define VCKHBMS vckhbms_
+#define VCKUBMS vckubms_
+#define VCKRHOY vckrhoy_
+#define VCKMMWY vckmmwy_
+#define GET_T_GIVEN_EY get_t_given_ey_
+#define GET_T_GIVEN_HY get_t_given_hy_
+#define GET_REACTION_MAP get_reaction_map_
+#endif
+
+/*function declarations */
+void atomicWeight(double * restrict awt);
+void molecularWeight(double * restrict wt);
+void gibbs(double * restrict species, double * restrict tc);
+void helmholtz(double * restrict species, double * restrict tc);
+void speciesInternalEnergy(double * restrict species, double * restrict tc);
+void speciesEnthalpy(double * restrict species, double * restrict tc);
+void speciesEntropy(double * restrict species, double * restrict tc);
+void cp_R(double * restrict species, double * restrict tc);
+void cv_R(double * restrict species, double * restrict tc);
+void equilibriumConstants(double * restrict kc, double * restrict g_RT, double T);
+void productionRate(double * restrict wdot, double * restrict sc, double T);
+void comp_k_f(double * restrict tc, double invT, double * restrict k_f);
+void comp_Kc(double * restrict tc, double invT, double * restrict Kc);
+void comp_qfqr(double * restrict q_f, double * restrict q_r, double * restrict sc, double * restrict tc, double invT);
+void progressRate(double * restrict qdot, double * restrict speciesConc, double T);
+void progressRateFR(double * restrict q_f, double * restrict q_r, double * restrict speciesConc, double T);
+void CKINIT();
+void CKFINALIZE();
+void CKINDX(int * iwrk, double * restrict rwrk, int * mm, int * kk, int * ii, int * nfit );
+void CKXNUM(char * line, int * nexp, int * lout, int * nval, double * restrict rval, int * kerr, int lenline);
+void CKSNUM(char * line, int * nexp, int * lout, char * kray, int * nn, int * knum, int * nval, double * restrict rval, int * kerr, int lenline, int lenkray);
+void CKSYME(int * kname, int * lenkname);
+void CKSYMS(int * kname, int * lenkname);
+void CKRP(int * ickwrk, double * restrict rckwrk, double * restrict ru, double * restrict ruc, double * restrict pa);
+void CKPX(double * restrict rho, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict P);
+void CKPY(double * restrict rho, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict P);
+void CKPC(double * restrict rho, double * restrict T, double * restrict c, int * iwrk, double * restrict rwrk, double * restrict P);
+void CKRHOX(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict rho);
+void CKRHOY(double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho);
+void CKRHOC(double * restrict P, double * restrict T, double * restrict c, int * iwrk, double * restrict rwrk, double * restrict rho);
+void CKWT(int * iwrk, double * restrict rwrk, double * restrict wt);
+void CKAWT(int * iwrk, double * restrict rwrk, double * restrict awt);
+void CKMMWY(double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm);
+void CKMMWX(double * restrict x, int * iwrk, double * restrict rwrk, double * restrict wtm);
+void CKMMWC(double * restrict c, int * iwrk, double * restrict rwrk, double * restrict wtm);
+void CKYTX(double * restrict y, int * iwrk, double * restrict rwrk, double * restrict x);
+void CKYTCP(double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict c);
+void CKYTCR(double * restrict rho, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict c);
+void CKXTY(double * restrict x, int * iwrk, double * restrict rwrk, double * restrict y);
+void CKXTCP(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict c);
+void CKXTCR(double * restrict rho, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict c);
+void CKCTX(double * restrict c, int * iwrk, double * restrict rwrk, double * restrict x);
+void CKCTY(double * restrict c, int * iwrk, double * restrict rwrk, double * restrict y);
+void CKCPOR(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict cpor);
+void CKHORT(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict hort);
+void CKSOR(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict sor);
+void CKCVML(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict cvml);
+void CKCPML(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict cvml);
+void CKUML(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict uml);
+void CKHML(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict uml);
+void CKGML(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict gml);
+void CKAML(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict aml);
+void CKSML(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict sml);
+void CKCVMS(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict cvms);
+void CKCPMS(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict cvms);
+void CKUMS(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict ums);
+void CKHMS(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict ums);
+void CKGMS(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict gms);
+void CKAMS(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict ams);
+void CKSMS(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict sms);
+void CKCPBL(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict cpbl);
+void CKCPBS(double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs);
+void CKCVBL(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict cpbl);
+void CKCVBS(double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs);
+void CKHBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict hbml);
+void CKHBMS(double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms);
+void CKUBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict ubml);
+void CKUBMS(double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms);
+void CKSBML(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict sbml);
+void CKSBMS(double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict sbms);
+void CKGBML(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict gbml);
+void CKGBMS(double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict gbms);
+void CKABML(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict abml);
+void CKABMS(double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict abms);
+void CKWC(double * restrict T, double * restrict C, int * iwrk, double * restrict rwrk, double * restrict wdot);
+void CKWYP(double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wdot);
+void CKWXP(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict wdot);
+void CKWYR(double * restrict rho, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wdot);
+void CKWXR(double * restrict rho, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict wdot);
+void CKQC(double * restrict T, double * restrict C, int * iwrk, double * restrict rwrk, double * restrict qdot);
+void CKKFKR(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict q_f, double * restrict q_r);
+void CKQYP(double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict qdot);
+void CKQXP(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict qdot);
+void CKQYR(double * restrict rho, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict qdot);
+void CKQXR(double * restrict rho, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict qdot);
+void CKNU(int * kdim, int * iwrk, double * restrict rwrk, int * nuki);
+void CKNCF(int * mdim, int * iwrk, double * restrict rwrk, int * ncf);
+void CKABE(int * iwrk, double * restrict rwrk, double * restrict a, double * restrict b, double * restrict e );
+void CKEQC(double * restrict T, double * restrict C , int * iwrk, double * restrict rwrk, double * restrict eqcon );
+void CKEQYP(double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict eqcon);
+void CKEQXP(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict eqcon);
+void CKEQYR(double * restrict rho, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict eqcon);
+void CKEQXR(double * restrict rho, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict eqcon);
+void DWDOT(double * restrict J, double * restrict sc, double * restrict T, int * consP);
+void aJacobian(double * restrict J, double * restrict sc, double T, int consP);
+void dcvpRdT(double * restrict species, double * restrict tc);
+void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
+void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
+void GET_REACTION_MAP(int * restrict rmap);
+/*vector version */
+void vproductionRate(int npt, double * restrict wdot, double * restrict c, double * restrict T);
+void VCKHMS(int * restrict np, double * restrict T, int * iwrk, double * restrict rwrk, double * restrict ums);
+void VCKPY(int * restrict np, double * restrict rho, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict P);
+void VCKWYR(int * restrict np, double * restrict rho, double * restrict T,
+            double * restrict y, int * restrict iwrk, double * restrict rwrk,
+            double * restrict wdot);
+void VCKYTX(int * restrict np, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict x);
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs);
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs);
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms);
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms);
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho);
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm);
+void vcomp_k_f(int npt, double * restrict k_f_s, double * restrict tc, double * restrict invT);
+void vcomp_gibbs(int npt, double * restrict g_RT, double * restrict tc);
+void vcomp_Kc(int npt, double * restrict Kc_s, double * restrict g_RT, double * restrict invT);
+void vcomp_wdot(int npt, double * restrict wdot, double * restrict mixture, double * restrict sc,
+                double * restrict k_f_s, double * restrict Kc_s,
+                double * restrict tc, double * restrict invT, double * restrict T);
+
+/* Inverse molecular weights */
+static const double imw[9] = {
+    1.0 / 2.015940,  /*H2 */
+    1.0 / 31.998800,  /*O2 */
+    1.0 / 18.015340,  /*H2O */
+    1.0 / 1.007970,  /*H */
+    1.0 / 15.999400,  /*O */
+    1.0 / 17.007370,  /*OH */
+    1.0 / 33.006770,  /*HO2 */
+    1.0 / 34.014740,  /*H2O2 */
+    1.0 / 28.013400};  /*N2 */
+
+
+
+static double fwd_A[21], fwd_beta[21], fwd_Ea[21];
+static double low_A[21], low_beta[21], low_Ea[21];
+static double rev_A[21], rev_beta[21], rev_Ea[21];
+static double troe_a[21],troe_Ts[21], troe_Tss[21], troe_Tsss[21];
+static double sri_a[21], sri_b[21], sri_c[21], sri_d[21], sri_e[21];
+static double activation_units[21], prefactor_units[21], phase_units[21];
+static int is_PD[21], troe_len[21], sri_len[21], nTB[21], *TBid[21];
+static double *TB[21];
+
+static double fwd_A_DEF[21], fwd_beta_DEF[21], fwd_Ea_DEF[21];
+static double low_A_DEF[21], low_beta_DEF[21], low_Ea_DEF[21];
+static double rev_A_DEF[21], rev_beta_DEF[21], rev_Ea_DEF[21];
+static double troe_a_DEF[21],troe_Ts_DEF[21], troe_Tss_DEF[21], troe_Tsss_DEF[21];
+static double sri_a_DEF[21], sri_b_DEF[21], sri_c_DEF[21], sri_d_DEF[21], sri_e_DEF[21];
+static double activation_units_DEF[21], prefactor_units_DEF[21], phase_units_DEF[21];
+static int is_PD_DEF[21], troe_len_DEF[21], sri_len_DEF[21], nTB_DEF[21], *TBid_DEF[21];
+static double *TB_DEF[21];
+static int rxn_map[21] = {6,7,8,9,2,3,4,5,0,10,11,12,13,14,15,1,16,17,18,19,20};
+
+void GET_REACTION_MAP(int *rmap)
+{
+    for (int i=0; i<21; ++i) {
+        rmap[i] = rxn_map[i];
+    }
+}
+
+
+#include <ReactionData.H>
+double* GetParamPtr(int                reaction_id,
+                    REACTION_PARAMETER param_id,
+                    int                species_id,
+                    int                get_default)
+{
+  double* ret = 0;
+  if (reaction_id<0 || reaction_id>=21) {
+    printf("Bad reaction id = %d",reaction_id);
+    abort();
+  };
+  int mrid = rxn_map[reaction_id];
+
+  if (param_id == THIRD_BODY) {
+    if (species_id<0 || species_id>=9) {
+      printf("GetParamPtr: Bad species id = %d",species_id);
+      abort();
+    }
+    if (get_default) {
+      for (int i=0; i<nTB_DEF[mrid]; ++i) {
+        if (species_id == TBid_DEF[mrid][i]) {
+          ret = &(TB_DEF[mrid][i]);
+        }
+      }
+    }
+    else {
+      for (int i=0; i<nTB[mrid]; ++i) {
+        if (species_id == TBid[mrid][i]) {
+          ret = &(TB[mrid][i]);
+        }
+      }
+    }
+    if (ret == 0) {
+      printf("GetParamPtr: No TB for reaction id = %d",reaction_id);
+      abort();
+    }
+  }
+  else {
+    if (     param_id == FWD_A)     {ret = (get_default ? &(fwd_A_DEF[mrid]) : &(fwd_A[mrid]));}
+      else if (param_id == FWD_BETA)  {ret = (get_default ? &(fwd_beta_DEF[mrid]) : &(fwd_beta[mrid]));}
+      else if (param_id == FWD_EA)    {ret = (get_default ? &(fwd_Ea_DEF[mrid]) : &(fwd_Ea[mrid]));}
+      else if (param_id == LOW_A)     {ret = (get_default ? &(low_A_DEF[mrid]) : &(low_A[mrid]));}
+      else if (param_id == LOW_BETA)  {ret = (get_default ? &(low_beta_DEF[mrid]) : &(low_beta[mrid]));}
+      else if (param_id == LOW_EA)    {ret = (get_default ? &(low_Ea_DEF[mrid]) : &(low_Ea[mrid]));}
+      else if (param_id == REV_A)     {ret = (get_default ? &(rev_A_DEF[mrid]) : &(rev_A[mrid]));}
+      else if (param_id == REV_BETA)  {ret = (get_default ? &(rev_beta_DEF[mrid]) : &(rev_beta[mrid]));}
+      else if (param_id == REV_EA)    {ret = (get_default ? &(rev_Ea_DEF[mrid]) : &(rev_Ea[mrid]));}
+      else if (param_id == TROE_A)    {ret = (get_default ? &(troe_a_DEF[mrid]) : &(troe_a[mrid]));}
+      else if (param_id == TROE_TS)   {ret = (get_default ? &(troe_Ts_DEF[mrid]) : &(troe_Ts[mrid]));}
+      else if (param_id == TROE_TSS)  {ret = (get_default ? &(troe_Tss_DEF[mrid]) : &(troe_Tss[mrid]));}
+      else if (param_id == TROE_TSSS) {ret = (get_default ? &(troe_Tsss_DEF[mrid]) : &(troe_Tsss[mrid]));}
+      else if (param_id == SRI_A)     {ret = (get_default ? &(sri_a_DEF[mrid]) : &(sri_a[mrid]));}
+      else if (param_id == SRI_B)     {ret = (get_default ? &(sri_b_DEF[mrid]) : &(sri_b[mrid]));}
+      else if (param_id == SRI_C)     {ret = (get_default ? &(sri_c_DEF[mrid]) : &(sri_c[mrid]));}
+      else if (param_id == SRI_D)     {ret = (get_default ? &(sri_d_DEF[mrid]) : &(sri_d[mrid]));}
+      else if (param_id == SRI_E)     {ret = (get_default ? &(sri_e_DEF[mrid]) : &(sri_e[mrid]));}
+    else {
+      printf("GetParamPtr: Unknown parameter id");
+      abort();
+    }
+  }
+  return ret;
+}
+
+void ResetAllParametersToDefault()
+{
+    for (int i=0; i<21; i++) {
+        if (nTB[i] != 0) {
+            nTB[i] = 0;
+            free(TB[i]);
+            free(TBid[i]);
+        }
+
+        fwd_A[i]    = fwd_A_DEF[i];
+        fwd_beta[i] = fwd_beta_DEF[i];
+        fwd_Ea[i]   = fwd_Ea_DEF[i];
+
+        low_A[i]    = low_A_DEF[i];
+        low_beta[i] = low_beta_DEF[i];
+        low_Ea[i]   = low_Ea_DEF[i];
+
+        rev_A[i]    = rev_A_DEF[i];
+        rev_beta[i] = rev_beta_DEF[i];
+        rev_Ea[i]   = rev_Ea_DEF[i];
+
+        troe_a[i]    = troe_a_DEF[i];
+        troe_Ts[i]   = troe_Ts_DEF[i];
+        troe_Tss[i]  = troe_Tss_DEF[i];
+        troe_Tsss[i] = troe_Tsss_DEF[i];
+
+        sri_a[i] = sri_a_DEF[i];
+        sri_b[i] = sri_b_DEF[i];
+        sri_c[i] = sri_c_DEF[i];
+        sri_d[i] = sri_d_DEF[i];
+        sri_e[i] = sri_e_DEF[i];
+
+        is_PD[i]    = is_PD_DEF[i];
+        troe_len[i] = troe_len_DEF[i];
+        sri_len[i]  = sri_len_DEF[i];
+
+        activation_units[i] = activation_units_DEF[i];
+        prefactor_units[i]  = prefactor_units_DEF[i];
+        phase_units[i]      = phase_units_DEF[i];
+
+        nTB[i]  = nTB_DEF[i];
+        if (nTB[i] != 0) {
+           TB[i] = (double *) malloc(sizeof(double) * nTB[i]);
+           TBid[i] = (int *) malloc(sizeof(int) * nTB[i]);
+           for (int j=0; j<nTB[i]; j++) {
+             TB[i][j] = TB_DEF[i][j];
+             TBid[i][j] = TBid_DEF[i][j];
+           }
+        }
+    }
+}
+
+void SetAllDefaults()
+{
+    for (int i=0; i<21; i++) {
+        if (nTB_DEF[i] != 0) {
+            nTB_DEF[i] = 0;
+            free(TB_DEF[i]);
+            free(TBid_DEF[i]);
+        }
+
+        fwd_A_DEF[i]    = fwd_A[i];
+        fwd_beta_DEF[i] = fwd_beta[i];
+        fwd_Ea_DEF[i]   = fwd_Ea[i];
+
+        low_A_DEF[i]    = low_A[i];
+        low_beta_DEF[i] = low_beta[i];
+        low_Ea_DEF[i]   = low_Ea[i];
+
+        rev_A_DEF[i]    = rev_A[i];
+        rev_beta_DEF[i] = rev_beta[i];
+        rev_Ea_DEF[i]   = rev_Ea[i];
+
+        troe_a_DEF[i]    = troe_a[i];
+        troe_Ts_DEF[i]   = troe_Ts[i];
+        troe_Tss_DEF[i]  = troe_Tss[i];
+        troe_Tsss_DEF[i] = troe_Tsss[i];
+
+        sri_a_DEF[i] = sri_a[i];
+        sri_b_DEF[i] = sri_b[i];
+        sri_c_DEF[i] = sri_c[i];
+        sri_d_DEF[i] = sri_d[i];
+        sri_e_DEF[i] = sri_e[i];
+
+        is_PD_DEF[i]    = is_PD[i];
+        troe_len_DEF[i] = troe_len[i];
+        sri_len_DEF[i]  = sri_len[i];
+
+        activation_units_DEF[i] = activation_units[i];
+        prefactor_units_DEF[i]  = prefactor_units[i];
+        phase_units_DEF[i]      = phase_units[i];
+
+        nTB_DEF[i]  = nTB[i];
+        if (nTB_DEF[i] != 0) {
+           TB_DEF[i] = (double *) malloc(sizeof(double) * nTB_DEF[i]);
+           TBid_DEF[i] = (int *) malloc(sizeof(int) * nTB_DEF[i]);
+           for (int j=0; j<nTB_DEF[i]; j++) {
+             TB_DEF[i][j] = TB[i][j];
+             TBid_DEF[i][j] = TBid[i][j];
+           }
+        }
+    }
+}
+
+/* Finalizes parameter database */
+void CKFINALIZE()
+{
+  for (int i=0; i<21; ++i) {
+    free(TB[i]); TB[i] = 0; 
+    free(TBid[i]); TBid[i] = 0;
+    nTB[i] = 0;
+
+    free(TB_DEF[i]); TB_DEF[i] = 0; 
+    free(TBid_DEF[i]); TBid_DEF[i] = 0;
+    nTB_DEF[i] = 0;
+  }
+}
+
+/* Initializes parameter database */
+void CKINIT()
+{
+    // (0):  H + O2 <=> O + OH
+    fwd_A[6]     = 3547000000000000;
+    fwd_beta[6]  = -0.40600000000000003;
+    fwd_Ea[6]    = 16599;
+    prefactor_units[6]  = 1.0000000000000002e-06;
+    activation_units[6] = 0.50321666580471969;
+    phase_units[6]      = 1e-12;
+    is_PD[6] = 0;
+    nTB[6] = 0;
+
+    // (1):  O + H2 <=> H + OH
+    fwd_A[7]     = 50800;
+    fwd_beta[7]  = 2.6699999999999999;
+    fwd_Ea[7]    = 6290;
+    prefactor_units[7]  = 1.0000000000000002e-06;
+    activation_units[7] = 0.50321666580471969;
+    phase_units[7]      = 1e-12;
+    is_PD[7] = 0;
+    nTB[7] = 0;
+
+    // (2):  H2 + OH <=> H2O + H
+    fwd_A[8]     = 216000000;
+    fwd_beta[8]  = 1.51;
+    fwd_Ea[8]    = 3430;
+    prefactor_units[8]  = 1.0000000000000002e-06;
+    activation_units[8] = 0.50321666580471969;
+    phase_units[8]      = 1e-12;
+    is_PD[8] = 0;
+    nTB[8] = 0;
+
+    // (3):  O + H2O <=> OH + OH
+    fwd_A[9]     = 2970000;
+    fwd_beta[9]  = 2.02;
+    fwd_Ea[9]    = 13400;
+    prefactor_units[9]  = 1.0000000000000002e-06;
+    activation_units[9] = 0.50321666580471969;
+    phase_units[9]      = 1e-12;
+    is_PD[9] = 0;
+    nTB[9] = 0;
+
+    // (4):  H2 + M <=> H + H + M
+    fwd_A[2]     = 4.577e+19;
+    fwd_beta[2]  = -1.3999999999999999;
+    fwd_Ea[2]    = 104380;
+    prefactor_units[2]  = 1.0000000000000002e-06;
+    activation_units[2] = 0.50321666580471969;
+    phase_units[2]      = 1e-6;
+    is_PD[2] = 0;
+    nTB[2] = 2;
+    TB[2] = (double *) malloc(2 * sizeof(double));
+    TBid[2] = (int *) malloc(2 * sizeof(int));
+    TBid[2][0] = 0; TB[2][0] = 2.5; // H2
+    TBid[2][1] = 2; TB[2][1] = 12; // H2O
+
+    // (5):  O + O + M <=> O2 + M
+    fwd_A[3]     = 6165000000000000;
+    fwd_beta[3]  = -0.5;
+    fwd_Ea[3]    = 0;
+    prefactor_units[3]  = 1.0000000000000002e-12;
+    activation_units[3] = 0.50321666580471969;
+    phase_units[3]      = 1e-12;
+    is_PD[3] = 0;
+    nTB[3] = 2;
+    TB[3] = (double *) malloc(2 * sizeof(double));
+    TBid[3] = (int *) malloc(2 * sizeof(int));
+    TBid[3][0] = 0; TB[3][0] = 2.5; // H2
+    TBid[3][1] = 2; TB[3][1] = 12; // H2O
+
+    // (6):  O + H + M <=> OH + M
+    fwd_A[4]     = 4.714e+18;
+    fwd_beta[4]  = -1;
+    fwd_Ea[4]    = 0;
+    prefactor_units[4]  = 1.0000000000000002e-12;
+    activation_units[4] = 0.50321666580471969;
+    phase_units[4]      = 1e-12;
+    is_PD[4] = 0;
+    nTB[4] = 2;
+    TB[4] = (double *) malloc(2 * sizeof(double));
+    TBid[4] = (int *) malloc(2 * sizeof(int));
+    TBid[4][0] = 0; TB[4][0] = 2.5; // H2
+    TBid[4][1] = 2; TB[4][1] = 12; // H2O
+
+    // (7):  H + OH + M <=> H2O + M
+    fwd_A[5]     = 3.8000000000000004e+22;
+    fwd_beta[5]  = -2;
+    fwd_Ea[5]    = 0;
+    prefactor_units[5]  = 1.0000000000000002e-12;
+    activation_units[5] = 0.50321666580471969;
+    phase_units[5]      = 1e-12;
+    is_PD[5] = 0;
+    nTB[5] = 2;
+    TB[5] = (double *) malloc(2 * sizeof(double));
+    TBid[5] = (int *) malloc(2 * sizeof(int));
+    TBid[5][0] = 0; TB[5][0] = 2.5; // H2
+    TBid[5][1] = 2; TB[5][1] = 12; // H2O
+
+    // (8):  H + O2 (+M) <=> HO2 (+M)
+    fwd_A[0]     = 1475000000000;
+    fwd_beta[0]  = 0.59999999999999998;
+    fwd_Ea[0]    = 0;
+    low_A[0]     = 6.366e+20;
+    low_beta[0]  = -1.72;
+    low_Ea[0]    = 524.79999999999995;
+    troe_a[0]    = 0.80000000000000004;
+    troe_Tsss[0] = 1.0000000000000001e-30;
+    troe_Ts[0]   = 1e+30;
+    troe_len[0]  = 3;
+    prefactor_units[0]  = 1.0000000000000002e-06;
+    activation_units[0] = 0.50321666580471969;
+    phase_units[0]      = 1e-12;
+    is_PD[0] = 1;
+    nTB[0] = 3;
+    TB[0] = (double *) malloc(3 * sizeof(double));
+    TBid[0] = (int *) malloc(3 * sizeof(int));
+    TBid[0][0] = 0; TB[0][0] = 2; // H2
+    TBid[0][1] = 2; TB[0][1] = 11; // H2O
+    TBid[0][2] = 1; TB[0][2] = 0.78000000000000003; // O2
+
+    // (9):  HO2 + H <=> H2 + O2
+    fwd_A[10]     = 16600000000000;
+    fwd_beta[10]  = 0;
+    fwd_Ea[10]    = 823;
+    prefactor_units[10]  = 1.0000000000000002e-06;
+    activation_units[10] = 0.50321666580471969;
+    phase_units[10]      = 1e-12;
+    is_PD[10] = 0;
+    nTB[10] = 0;
+
+    // (10):  HO2 + H <=> OH + OH
+    fwd_A[11]     = 70790000000000;
+    fwd_beta[11]  = 0;
+    fwd_Ea[11]    = 295;
+    prefactor_units[11]  = 1.0000000000000002e-06;
+    activation_units[11] = 0.50321666580471969;
+    phase_units[11]      = 1e-12;
+    is_PD[11] = 0;
+    nTB[11] = 0;
+
+    // (11):  HO2 + O <=> O2 + OH
+    fwd_A[12]     = 32500000000000;
+    fwd_beta[12]  = 0;
+    fwd_Ea[12]    = 0;
+    prefactor_units[12]  = 1.0000000000000002e-06;
+    activation_units[12] = 0.50321666580471969;
+    phase_units[12]      = 1e-12;
+    is_PD[12] = 0;
+    nTB[12] = 0;
+
+    // (12):  HO2 + OH <=> H2O + O2
+    fwd_A[13]     = 28900000000000;
+    fwd_beta[13]  = 0;
+    fwd_Ea[13]    = -497;
+    prefactor_units[13]  = 1.0000000000000002e-06;
+    activation_units[13] = 0.50321666580471969;
+    phase_units[13]      = 1e-12;
+    is_PD[13] = 0;
+    nTB[13] = 0;
+
+    // (13):  HO2 + HO2 <=> H2O2 + O2
+    fwd_A[14]     = 420000000000000;
+    fwd_beta[14]  = 0;
+    fwd_Ea[14]    = 11982;
+    prefactor_units[14]  = 1.0000000000000002e-06;
+    activation_units[14] = 0.50321666580471969;
+    phase_units[14]      = 1e-12;
+    is_PD[14] = 0;
+    nTB[14] = 0;
+
+    // (14):  HO2 + HO2 <=> H2O2 + O2
+    fwd_A[15]     = 130000000000;
+    fwd_beta[15]  = 0;
+    fwd_Ea[15]    = -1629.3;
+    prefactor_units[15]  = 1.0000000000000002e-06;
+    activation_units[15] = 0.50321666580471969;
+    phase_units[15]      = 1e-12;
+    is_PD[15] = 0;
+    nTB[15] = 0;
+
+    // (15):  H2O2 (+M) <=> OH + OH (+M)
+    fwd_A[1]     = 295100000000000;
+    fwd_beta[1]  = 0;
+    fwd_Ea[1]    = 48430;
+    low_A[1]     = 1.202e+17;
+    low_beta[1]  = 0;
+    low_Ea[1]    = 45500;
+    troe_a[1]    = 0.5;
+    troe_Tsss[1] = 1.0000000000000001e-30;
+    troe_Ts[1]   = 1e+30;
+    troe_len[1]  = 3;
+    prefactor_units[1]  = 1;
+    activation_units[1] = 0.50321666580471969;
+    phase_units[1]      = 1e-6;
+    is_PD[1] = 1;
+    nTB[1] = 2;
+    TB[1] = (double *) malloc(2 * sizeof(double));
+    TBid[1] = (int *) malloc(2 * sizeof(int));
+    TBid[1][0] = 0; TB[1][0] = 2.5; // H2
+    TBid[1][1] = 2; TB[1][1] = 12; // H2O
+
+    // (16):  H2O2 + H <=> H2O + OH
+    fwd_A[16]     = 24100000000000;
+    fwd_beta[16]  = 0;
+    fwd_Ea[16]    = 3970;
+    prefactor_units[16]  = 1.0000000000000002e-06;
+    activation_units[16] = 0.50321666580471969;
+    phase_units[16]      = 1e-12;
+    is_PD[16] = 0;
+    nTB[16] = 0;
+
+    // (17):  H2O2 + H <=> HO2 + H2
+    fwd_A[17]     = 48200000000000;
+    fwd_beta[17]  = 0;
+    fwd_Ea[17]    = 7950;
+    prefactor_units[17]  = 1.0000000000000002e-06;
+    activation_units[17] = 0.50321666580471969;
+    phase_units[17]      = 1e-12;
+    is_PD[17] = 0;
+    nTB[17] = 0;
+
+    // (18):  H2O2 + O <=> OH + HO2
+    fwd_A[18]     = 9550000;
+    fwd_beta[18]  = 2;
+    fwd_Ea[18]    = 3970;
+    prefactor_units[18]  = 1.0000000000000002e-06;
+    activation_units[18] = 0.50321666580471969;
+    phase_units[18]      = 1e-12;
+    is_PD[18] = 0;
+    nTB[18] = 0;
+
+    // (19):  H2O2 + OH <=> HO2 + H2O
+    fwd_A[19]     = 1000000000000;
+    fwd_beta[19]  = 0;
+    fwd_Ea[19]    = 0;
+    prefactor_units[19]  = 1.0000000000000002e-06;
+    activation_units[19] = 0.50321666580471969;
+    phase_units[19]      = 1e-12;
+    is_PD[19] = 0;
+    nTB[19] = 0;
+
+    // (20):  H2O2 + OH <=> HO2 + H2O
+    fwd_A[20]     = 580000000000000;
+    fwd_beta[20]  = 0;
+    fwd_Ea[20]    = 9557;
+    prefactor_units[20]  = 1.0000000000000002e-06;
+    activation_units[20] = 0.50321666580471969;
+    phase_units[20]      = 1e-12;
+    is_PD[20] = 0;
+    nTB[20] = 0;
+
+    SetAllDefaults();
+}
+
+
+
+/*A few mechanism parameters */
+void CKINDX(int * iwrk, double * restrict rwrk, int * mm, int * kk, int * ii, int * nfit)
+{
+    *mm = 3;
+    *kk = 9;
+    *ii = 21;
+    *nfit = -1; /*Why do you need this anyway ?  */
+}
+
+
+
+/* ckxnum... for parsing strings  */
+void CKXNUM(char * line, int * nexp, int * lout, int * nval, double * restrict rval, int * kerr, int lenline )
+{
+    int n,i; /*Loop Counters */
+    char cstr[1000];
+    char *saveptr;
+    char *p; /*String Tokens */
+    /* Strip Comments  */
+    for (i=0; i<lenline; ++i) {
+        if (line[i]=='!') {
+            break;
+        }
+        cstr[i] = line[i];
+    }
+    cstr[i] = '\0';
+
+    p = strtok_r(cstr," ", &saveptr);
+    if (!p) {
+        *nval = 0;
+        *kerr = 1;
+        return;
+    }
+    for (n=0; n<*nexp; ++n) {
+        rval[n] = atof(p);
+        p = strtok_r(NULL, " ", &saveptr);
+        if (!p) break;
+    }
+    *nval = n+1;
+    if (*nval < *nexp) *kerr = 1;
+    return;
+}
+
+
+/* cksnum... for parsing strings  */
+void CKSNUM(char * line, int * nexp, int * lout, char * kray, int * nn, int * knum, int * nval, double * restrict rval, int * kerr, int lenline, int lenkray)
+{
+    /*Not done yet ... */
+}
+
+
+/* Returns the char strings of element names */
+void CKSYME(int * kname, int * plenkname )
+{
+    int i; /*Loop Counter */
+    int lenkname = *plenkname;
+    /*clear kname */
+    for (i=0; i<lenkname*3; i++) {
+        kname[i] = ' ';
+    }
+
+    /* H  */
+    kname[ 0*lenkname + 0 ] = 'H';
+    kname[ 0*lenkname + 1 ] = ' ';
+
+    /* O  */
+    kname[ 1*lenkname + 0 ] = 'O';
+    kname[ 1*lenkname + 1 ] = ' ';
+
+    /* N  */
+    kname[ 2*lenkname + 0 ] = 'N';
+    kname[ 2*lenkname + 1 ] = ' ';
+
+}
+
+
+/* Returns the char strings of species names */
+void CKSYMS(int * kname, int * plenkname )
+{
+    int i; /*Loop Counter */
+    int lenkname = *plenkname;
+    /*clear kname */
+    for (i=0; i<lenkname*9; i++) {
+        kname[i] = ' ';
+    }
+
+    /* H2  */
+    kname[ 0*lenkname + 0 ] = 'H';
+    kname[ 0*lenkname + 1 ] = '2';
+    kname[ 0*lenkname + 2 ] = ' ';
+
+    /* O2  */
+    kname[ 1*lenkname + 0 ] = 'O';
+    kname[ 1*lenkname + 1 ] = '2';
+    kname[ 1*lenkname + 2 ] = ' ';
+
+    /* H2O  */
+    kname[ 2*lenkname + 0 ] = 'H';
+    kname[ 2*lenkname + 1 ] = '2';
+    kname[ 2*lenkname + 2 ] = 'O';
+    kname[ 2*lenkname + 3 ] = ' ';
+
+    /* H  */
+    kname[ 3*lenkname + 0 ] = 'H';
+    kname[ 3*lenkname + 1 ] = ' ';
+
+    /* O  */
+    kname[ 4*lenkname + 0 ] = 'O';
+    kname[ 4*lenkname + 1 ] = ' ';
+
+    /* OH  */
+    kname[ 5*lenkname + 0 ] = 'O';
+    kname[ 5*lenkname + 1 ] = 'H';
+    kname[ 5*lenkname + 2 ] = ' ';
+
+    /* HO2  */
+    kname[ 6*lenkname + 0 ] = 'H';
+    kname[ 6*lenkname + 1 ] = 'O';
+    kname[ 6*lenkname + 2 ] = '2';
+    kname[ 6*lenkname + 3 ] = ' ';
+
+    /* H2O2  */
+    kname[ 7*lenkname + 0 ] = 'H';
+    kname[ 7*lenkname + 1 ] = '2';
+    kname[ 7*lenkname + 2 ] = 'O';
+    kname[ 7*lenkname + 3 ] = '2';
+    kname[ 7*lenkname + 4 ] = ' ';
+
+    /* N2  */
+    kname[ 8*lenkname + 0 ] = 'N';
+    kname[ 8*lenkname + 1 ] = '2';
+    kname[ 8*lenkname + 2 ] = ' ';
+
+}
+
+
+/* Returns R, Rc, Patm */
+void CKRP(int * ickwrk, double * restrict rckwrk, double * restrict ru, double * restrict ruc, double * restrict pa)
+{
+     *ru  = 8.31451e+07; 
+     *ruc = 1.98721558317399615845; 
+     *pa  = 1.01325e+06; 
+}
+
+
+/*Compute P = rhoRT/W(x) */
+void CKPX(double * restrict rho, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict P)
+{
+    double XW = 0;/* To hold mean molecular wt */
+    XW += x[0]*2.015940; /*H2 */
+    XW += x[1]*31.998800; /*O2 */
+    XW += x[2]*18.015340; /*H2O */
+    XW += x[3]*1.007970; /*H */
+    XW += x[4]*15.999400; /*O */
+    XW += x[5]*17.007370; /*OH */
+    XW += x[6]*33.006770; /*HO2 */
+    XW += x[7]*34.014740; /*H2O2 */
+    XW += x[8]*28.013400; /*N2 */
+    *P = *rho * 8.31451e+07 * (*T) / XW; /*P = rho*R*T/W */
+
+    return;
+}
+
+
+/*Compute P = rhoRT/W(y) */
+void CKPY(double * restrict rho, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict P)
+{
+    double YOW = 0;/* for computing mean MW */
+    YOW += y[0]*imw[0]; /*H2 */
+    YOW += y[1]*imw[1]; /*O2 */
+    YOW += y[2]*imw[2]; /*H2O */
+    YOW += y[3]*imw[3]; /*H */
+    YOW += y[4]*imw[4]; /*O */
+    YOW += y[5]*imw[5]; /*OH */
+    YOW += y[6]*imw[6]; /*HO2 */
+    YOW += y[7]*imw[7]; /*H2O2 */
+    YOW += y[8]*imw[8]; /*N2 */
+    *P = *rho * 8.31451e+07 * (*T) * YOW; /*P = rho*R*T/W */
+
+    return;
+}
+
+
+/*Compute P = rhoRT/W(y) */
+void VCKPY(int * restrict np, double * restrict rho, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict P)
+{
+    double YOW[*np];
+    for (int i=0; i<(*np); i++) {
+        YOW[i] = 0.0;
+    }
+
+    for (int n=0; n<9; n++) {
+        for (int i=0; i<(*np); i++) {
+            YOW[i] += y[n*(*np)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        P[i] = rho[i] * 8.31451e+07 * T[i] * YOW[i]; /*P = rho*R*T/W */
+    }
+
+    return;
+}
+
+
+/*Compute P = rhoRT/W(c) */
+void CKPC(double * restrict rho, double * restrict T, double * restrict c, int * iwrk, double * restrict rwrk, double * restrict P)
+{
+    int id; /*loop counter */
+    /*See Eq 5 in CK Manual */
+    double W = 0;
+    double sumC = 0;
+    W += c[0]*2.015940; /*H2 */
+    W += c[1]*31.998800; /*O2 */
+    W += c[2]*18.015340; /*H2O */
+    W += c[3]*1.007970; /*H */
+    W += c[4]*15.999400; /*O */
+    W += c[5]*17.007370; /*OH */
+    W += c[6]*33.006770; /*HO2 */
+    W += c[7]*34.014740; /*H2O2 */
+    W += c[8]*28.013400; /*N2 */
+
+    for (id = 0; id < 9; ++id) {
+        sumC += c[id];
+    }
+    *P = *rho * 8.31451e+07 * (*T) * sumC / W; /*P = rho*R*T/W */
+
+    return;
+}
+
+
+/*Compute rho = PW(x)/RT */
+void CKRHOX(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict rho)
+{
+    double XW = 0;/* To hold mean molecular wt */
+    XW += x[0]*2.015940; /*H2 */
+    XW += x[1]*31.998800; /*O2 */
+    XW += x[2]*18.015340; /*H2O */
+    XW += x[3]*1.007970; /*H */
+    XW += x[4]*15.999400; /*O */
+    XW += x[5]*17.007370; /*OH */
+    XW += x[6]*33.006770; /*HO2 */
+    XW += x[7]*34.014740; /*H2O2 */
+    XW += x[8]*28.013400; /*N2 */
+    *rho = *P * XW / (8.31451e+07 * (*T)); /*rho = P*W/(R*T) */
+
+    return;
+}
+
+
+/*Compute rho = P*W(y)/RT */
+void CKRHOY(double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho)
+{
+    double YOW = 0;
+    double tmp[9];
+
+    for (int i = 0; i < 9; i++)
+    {
+        tmp[i] = y[i]*imw[i];
+    }
+    for (int i = 0; i < 9; i++)
+    {
+        YOW += tmp[i];
+    }
+
+    *rho = *P / (8.31451e+07 * (*T) * YOW);/*rho = P*W/(R*T) */
+    return;
+}
+
+
+/*Compute rho = P*W(y)/RT */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho)
+{
+    for (int i=0; i<(*np); i++) {
+        rho[i] = 0.0;
+    }
+
+    for (int n=0; n<9; n++) {
+        for (int i=0; i<(*np); i++) {
+            rho[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        rho[i] = P[i] / (8.31451e+07 * T[i] * rho[i]);/*rho = P*W/(R*T) */
+    }
+
+    return;
+}
+
+
+/*Compute rho = P*W(c)/(R*T) */
+void CKRHOC(double * restrict P, double * restrict T, double * restrict c, int * iwrk, double * restrict rwrk, double * restrict rho)
+{
+    int id; /*loop counter */
+    /*See Eq 5 in CK Manual */
+    double W = 0;
+    double sumC = 0;
+    W += c[0]*2.015940; /*H2 */
+    W += c[1]*31.998800; /*O2 */
+    W += c[2]*18.015340; /*H2O */
+    W += c[3]*1.007970; /*H */
+    W += c[4]*15.999400; /*O */
+    W += c[5]*17.007370; /*OH */
+    W += c[6]*33.006770; /*HO2 */
+    W += c[7]*34.014740; /*H2O2 */
+    W += c[8]*28.013400; /*N2 */
+
+    for (id = 0; id < 9; ++id) {
+        sumC += c[id];
+    }
+    *rho = *P * W / (sumC * (*T) * 8.31451e+07); /*rho = PW/(R*T) */
+
+    return;
+}
+
+
+/*get molecular weight for all species */
+void CKWT(int * iwrk, double * restrict rwrk, double * restrict wt)
+{
+    molecularWeight(wt);
+}
+
+
+/*get atomic weight for all elements */
+void CKAWT(int * iwrk, double * restrict rwrk, double * restrict awt)
+{
+    atomicWeight(awt);
+}
+
+
+/*given y[species]: mass fractions */
+/*returns mean molecular weight (gm/mole) */
+void CKMMWY(double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm)
+{
+    double YOW = 0;
+    double tmp[9];
+
+    for (int i = 0; i < 9; i++)
+    {
+        tmp[i] = y[i]*imw[i];
+    }
+    for (int i = 0; i < 9; i++)
+    {
+        YOW += tmp[i];
+    }
+
+    *wtm = 1.0 / YOW;
+    return;
+}
+
+
+/*given y[species]: mass fractions */
+/*returns mean molecular weight (gm/mole) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm)
+{
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 0.0;
+    }
+
+    for (int n=0; n<9; n++) {
+        for (int i=0; i<(*np); i++) {
+            wtm[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 1.0 / wtm[i];
+    }
+
+    return;
+}
+
+
+/*given x[species]: mole fractions */
+/*returns mean molecular weight (gm/mole) */
+void CKMMWX(double * restrict x, int * iwrk, double * restrict rwrk, double * restrict wtm)
+{
+    double XW = 0;/* see Eq 4 in CK Manual */
+    XW += x[0]*2.015940; /*H2 */
+    XW += x[1]*31.998800; /*O2 */
+    XW += x[2]*18.015340; /*H2O */
+    XW += x[3]*1.007970; /*H */
+    XW += x[4]*15.999400; /*O */
+    XW += x[5]*17.007370; /*OH */
+    XW += x[6]*33.006770; /*HO2 */
+    XW += x[7]*34.014740; /*H2O2 */
+    XW += x[8]*28.013400; /*N2 */
+    *wtm = XW;
+
+    return;
+}
+
+
+/*given c[species]: molar concentration */
+/*returns mean molecular weight (gm/mole) */
+void CKMMWC(double * restrict c, int * iwrk, double * restrict rwrk, double * restrict wtm)
+{
+    int id; /*loop counter */
+    /*See Eq 5 in CK Manual */
+    double W = 0;
+    double sumC = 0;
+    W += c[0]*2.015940; /*H2 */
+    W += c[1]*31.998800; /*O2 */
+    W += c[2]*18.015340; /*H2O */
+    W += c[3]*1.007970; /*H */
+    W += c[4]*15.999400; /*O */
+    W += c[5]*17.007370; /*OH */
+    W += c[6]*33.006770; /*HO2 */
+    W += c[7]*34.014740; /*H2O2 */
+    W += c[8]*28.013400; /*N2 */
+
+    for (id = 0; id < 9; ++id) {
+        sumC += c[id];
+    }
+    /* CK provides no guard against divison by zero */
+    *wtm = W/sumC;
+
+    return;
+}
+
+
+/*convert y[species] (mass fracs) to x[species] (mole fracs) */
+void CKYTX(double * restrict y, int * iwrk, double * restrict rwrk, double * restrict x)
+{
+    double YOW = 0;
+    double tmp[9];
+
+    for (int i = 0; i < 9; i++)
+    {
+        tmp[i] = y[i]*imw[i];
+    }
+    for (int i = 0; i < 9; i++)
+    {
+        YOW += tmp[i];
+    }
+
+    double YOWINV = 1.0/YOW;
+
+    for (int i = 0; i < 9; i++)
+    {
+        x[i] = y[i]*imw[i]*YOWINV;
+    }
+    return;
+}
+
+
+/*convert y[npoints*species] (mass fracs) to x[npoints*species] (mole fracs) */
+void VCKYTX(int * restrict np, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict x)
+{
+    double YOW[*np];
+    for (int i=0; i<(*np); i++) {
+        YOW[i] = 0.0;
+    }
+
+    for (int n=0; n<9; n++) {
+        for (int i=0; i<(*np); i++) {
+            x[n*(*np)+i] = y[n*(*np)+i] * imw[n];
+            YOW[i] += x[n*(*np)+i];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        YOW[i] = 1.0/YOW[i];
+    }
+
+    for (int n=0; n<9; n++) {
+        for (int i=0; i<(*np); i++) {
+            x[n*(*np)+i] *=  YOW[i];
+        }
+    }
+}
+
+
+/*convert y[species] (mass fracs) to c[species] (molar conc) */
+void CKYTCP(double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict c)
+{
+    double YOW = 0;
+    double PWORT;
+
+    /*Compute inverse of mean molecular wt first */
+    for (int i = 0; i < 9; i++)
+    {
+        c[i] = y[i]*imw[i];
+    }
+    for (int i = 0; i < 9; i++)
+    {
+        YOW += c[i];
+    }
+
+    /*PW/RT (see Eq. 7) */
+    PWORT = (*P)/(YOW * 8.31451e+07 * (*T)); 
+    /*Now compute conversion */
+
+    for (int i = 0; i < 9; i++)
+    {
+        c[i] = PWORT * y[i] * imw[i];
+    }
+    return;
+}
+
+
+/*convert y[species] (mass fracs) to c[species] (molar conc) */
+void CKYTCR(double * restrict rho, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict c)
+{
+    for (int i = 0; i < 9; i++)
+    {
+        c[i] = (*rho)  * y[i] * imw[i];
+    }
+}
+
+
+/*convert x[species] (mole fracs) to y[species] (mass fracs) */
+void CKXTY(double * restrict x, int * iwrk, double * restrict rwrk, double * restrict y)
+{
+    double XW = 0; /*See Eq 4, 9 in CK Manual */
+    /*Compute mean molecular wt first */
+    XW += x[0]*2.015940; /*H2 */
+    XW += x[1]*31.998800; /*O2 */
+    XW += x[2]*18.015340; /*H2O */
+    XW += x[3]*1.007970; /*H */
+    XW += x[4]*15.999400; /*O */
+    XW += x[5]*17.007370; /*OH */
+    XW += x[6]*33.006770; /*HO2 */
+    XW += x[7]*34.014740; /*H2O2 */
+    XW += x[8]*28.013400; /*N2 */
+    /*Now compute conversion */
+    double XWinv = 1.0/XW;
+    y[0] = x[0]*2.015940*XWinv; 
+    y[1] = x[1]*31.998800*XWinv; 
+    y[2] = x[2]*18.015340*XWinv; 
+    y[3] = x[3]*1.007970*XWinv; 
+    y[4] = x[4]*15.999400*XWinv; 
+    y[5] = x[5]*17.007370*XWinv; 
+    y[6] = x[6]*33.006770*XWinv; 
+    y[7] = x[7]*34.014740*XWinv; 
+    y[8] = x[8]*28.013400*XWinv; 
+
+    return;
+}
+
+
+/*convert x[species] (mole fracs) to c[species] (molar conc) */
+void CKXTCP(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict c)
+{
+    int id; /*loop counter */
+    double PORT = (*P)/(8.31451e+07 * (*T)); /*P/RT */
+
+    /*Compute conversion, see Eq 10 */
+    for (id = 0; id < 9; ++id) {
+        c[id] = x[id]*PORT;
+    }
+
+    return;
+}
+
+
+/*convert x[species] (mole fracs) to c[species] (molar conc) */
+void CKXTCR(double * restrict rho, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict c)
+{
+    int id; /*loop counter */
+    double XW = 0; /*See Eq 4, 11 in CK Manual */
+    double ROW; 
+    /*Compute mean molecular wt first */
+    XW += x[0]*2.015940; /*H2 */
+    XW += x[1]*31.998800; /*O2 */
+    XW += x[2]*18.015340; /*H2O */
+    XW += x[3]*1.007970; /*H */
+    XW += x[4]*15.999400; /*O */
+    XW += x[5]*17.007370; /*OH */
+    XW += x[6]*33.006770; /*HO2 */
+    XW += x[7]*34.014740; /*H2O2 */
+    XW += x[8]*28.013400; /*N2 */
+    ROW = (*rho) / XW;
+
+    /*Compute conversion, see Eq 11 */
+    for (id = 0; id < 9; ++id) {
+        c[id] = x[id]*ROW;
+    }
+
+    return;
+}
+
+
+/*convert c[species] (molar conc) to x[species] (mole fracs) */
+void CKCTX(double * restrict c, int * iwrk, double * restrict rwrk, double * restrict x)
+{
+    int id; /*loop counter */
+    double sumC = 0; 
+
+    /*compute sum of c  */
+    for (id = 0; id < 9; ++id) {
+        sumC += c[id];
+    }
+
+    /* See Eq 13  */
+    double sumCinv = 1.0/sumC;
+    for (id = 0; id < 9; ++id) {
+        x[id] = c[id]*sumCinv;
+    }
+
+    return;
+}
+
+
+/*convert c[species] (molar conc) to y[species] (mass fracs) */
+void CKCTY(double * restrict c, int * iwrk, double * restrict rwrk, double * restrict y)
+{
+    double CW = 0; /*See Eq 12 in CK Manual */
+    /*compute denominator in eq 12 first */
+    CW += c[0]*2.015940; /*H2 */
+    CW += c[1]*31.998800; /*O2 */
+    CW += c[2]*18.015340; /*H2O */
+    CW += c[3]*1.007970; /*H */
+    CW += c[4]*15.999400; /*O */
+    CW += c[5]*17.007370; /*OH */
+    CW += c[6]*33.006770; /*HO2 */
+    CW += c[7]*34.014740; /*H2O2 */
+    CW += c[8]*28.013400; /*N2 */
+    /*Now compute conversion */
+    double CWinv = 1.0/CW;
+    y[0] = c[0]*2.015940*CWinv; 
+    y[1] = c[1]*31.998800*CWinv; 
+    y[2] = c[2]*18.015340*CWinv; 
+    y[3] = c[3]*1.007970*CWinv; 
+    y[4] = c[4]*15.999400*CWinv; 
+    y[5] = c[5]*17.007370*CWinv; 
+    y[6] = c[6]*33.006770*CWinv; 
+    y[7] = c[7]*34.014740*CWinv; 
+    y[8] = c[8]*28.013400*CWinv; 
+
+    return;
+}
+
+
+/*get Cp/R as a function of T  */
+/*for all species (Eq 19) */
+void CKCPOR(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict cpor)
+{
+    double tT = *T; /*temporary temperature */
+    double tc[] = { 0, tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    cp_R(cpor, tc);
+}
+
+
+/*get H/RT as a function of T  */
+/*for all species (Eq 20) */
+void CKHORT(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict hort)
+{
+    double tT = *T; /*temporary temperature */
+    double tc[] = { 0, tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    speciesEnthalpy(hort, tc);
+}
+
+
+/*get S/R as a function of T  */
+/*for all species (Eq 21) */
+void CKSOR(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict sor)
+{
+    double tT = *T; /*temporary temperature */
+    double tc[] = { log(tT), tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    speciesEntropy(sor, tc);
+}
+
+
+/*get specific heat at constant volume as a function  */
+/*of T for all species (molar units) */
+void CKCVML(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict cvml)
+{
+    int id; /*loop counter */
+    double tT = *T; /*temporary temperature */
+    double tc[] = { 0, tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    cv_R(cvml, tc);
+
+    /*convert to chemkin units */
+    for (id = 0; id < 9; ++id) {
+        cvml[id] *= 8.31451e+07;
+    }
+}
+
+
+/*get specific heat at constant pressure as a  */
+/*function of T for all species (molar units) */
+void CKCPML(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict cpml)
+{
+    int id; /*loop counter */
+    double tT = *T; /*temporary temperature */
+    double tc[] = { 0, tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    cp_R(cpml, tc);
+
+    /*convert to chemkin units */
+    for (id = 0; id < 9; ++id) {
+        cpml[id] *= 8.31451e+07;
+    }
+}
+
+
+/*get internal energy as a function  */
+/*of T for all species (molar units) */
+void CKUML(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict uml)
+{
+    int id; /*loop counter */
+    double tT = *T; /*temporary temperature */
+    double tc[] = { 0, tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double RT = 8.31451e+07*tT; /*R*T */
+    speciesInternalEnergy(uml, tc);
+
+    /*convert to chemkin units */
+    for (id = 0; id < 9; ++id) {
+        uml[id] *= RT;
+    }
+}
+
+
+/*get enthalpy as a function  */
+/*of T for all species (molar units) */
+void CKHML(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict hml)
+{
+    int id; /*loop counter */
+    double tT = *T; /*temporary temperature */
+    double tc[] = { 0, tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double RT = 8.31451e+07*tT; /*R*T */
+    speciesEnthalpy(hml, tc);
+
+    /*convert to chemkin units */
+    for (id = 0; id < 9; ++id) {
+        hml[id] *= RT;
+    }
+}
+
+
+/*get standard-state Gibbs energy as a function  */
+/*of T for all species (molar units) */
+void CKGML(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict gml)
+{
+    int id; /*loop counter */
+    double tT = *T; /*temporary temperature */
+    double tc[] = { log(tT), tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double RT = 8.31451e+07*tT; /*R*T */
+    gibbs(gml, tc);
+
+    /*convert to chemkin units */
+    for (id = 0; id < 9; ++id) {
+        gml[id] *= RT;
+    }
+}
+
+
+/*get standard-state Helmholtz free energy as a  */
+/*function of T for all species (molar units) */
+void CKAML(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict aml)
+{
+    int id; /*loop counter */
+    double tT = *T; /*temporary temperature */
+    double tc[] = { log(tT), tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double RT = 8.31451e+07*tT; /*R*T */
+    helmholtz(aml, tc);
+
+    /*convert to chemkin units */
+    for (id = 0; id < 9; ++id) {
+        aml[id] *= RT;
+    }
+}
+
+
+/*Returns the standard-state entropies in molar units */
+void CKSML(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict sml)
+{
+    int id; /*loop counter */
+    double tT = *T; /*temporary temperature */
+    double tc[] = { log(tT), tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    speciesEntropy(sml, tc);
+
+    /*convert to chemkin units */
+    for (id = 0; id < 9; ++id) {
+        sml[id] *= 8.31451e+07;
+    }
+}
+
+
+/*Returns the specific heats at constant volume */
+/*in mass units (Eq. 29) */
+void CKCVMS(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict cvms)
+{
+    double tT = *T; /*temporary temperature */
+    double tc[] = { 0, tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    cv_R(cvms, tc);
+    /*multiply by R/molecularweight */
+    cvms[0] *= 4.124383662212169e+07; /*H2 */
+    cvms[1] *= 2.598381814318037e+06; /*O2 */
+    cvms[2] *= 4.615239012974499e+06; /*H2O */
+    cvms[3] *= 8.248767324424338e+07; /*H */
+    cvms[4] *= 5.196763628636074e+06; /*O */
+    cvms[5] *= 4.888768810227566e+06; /*OH */
+    cvms[6] *= 2.519031701678171e+06; /*HO2 */
+    cvms[7] *= 2.444384405113783e+06; /*H2O2 */
+    cvms[8] *= 2.968047434442088e+06; /*N2 */
+}
+
+
+/*Returns the specific heats at constant pressure */
+/*in mass units (Eq. 26) */
+void CKCPMS(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict cpms)
+{
+    double tT = *T; /*temporary temperature */
+    double tc[] = { 0, tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    cp_R(cpms, tc);
+    /*multiply by R/molecularweight */
+    cpms[0] *= 4.124383662212169e+07; /*H2 */
+    cpms[1] *= 2.598381814318037e+06; /*O2 */
+    cpms[2] *= 4.615239012974499e+06; /*H2O */
+    cpms[3] *= 8.248767324424338e+07; /*H */
+    cpms[4] *= 5.196763628636074e+06; /*O */
+    cpms[5] *= 4.888768810227566e+06; /*OH */
+    cpms[6] *= 2.519031701678171e+06; /*HO2 */
+    cpms[7] *= 2.444384405113783e+06; /*H2O2 */
+    cpms[8] *= 2.968047434442088e+06; /*N2 */
+}
+
+
+/*Returns internal energy in mass units (Eq 30.) */
+void CKUMS(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict ums)
+{
+    double tT = *T; /*temporary temperature */
+    double tc[] = { 0, tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double RT = 8.31451e+07*tT; /*R*T */
+    speciesInternalEnergy(ums, tc);
+    for (int i = 0; i < 9; i++)
+    {
+        ums[i] *= RT*imw[i];
+    }
+}
+
+
+/*Returns enthalpy in mass units (Eq 27.) */
+void CKHMS(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict hms)
+{
+    double tT = *T; /*temporary temperature */
+    double tc[] = { 0, tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double RT = 8.31451e+07*tT; /*R*T */
+    speciesEnthalpy(hms, tc);
+    for (int i = 0; i < 9; i++)
+    {
+        hms[i] *= RT*imw[i];
+    }
+}
+
+
+/*Returns enthalpy in mass units (Eq 27.) */
+void VCKHMS(int * restrict np, double * restrict T, int * iwrk, double * restrict rwrk, double * restrict hms)
+{
+    double tc[5], h[9];
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesEnthalpy(h, tc);
+
+        hms[0*(*np)+i] = h[0];
+        hms[1*(*np)+i] = h[1];
+        hms[2*(*np)+i] = h[2];
+        hms[3*(*np)+i] = h[3];
+        hms[4*(*np)+i] = h[4];
+        hms[5*(*np)+i] = h[5];
+        hms[6*(*np)+i] = h[6];
+        hms[7*(*np)+i] = h[7];
+        hms[8*(*np)+i] = h[8];
+    }
+
+    for (int n=0; n<9; n++) {
+        for (int i=0; i<(*np); i++) {
+            hms[n*(*np)+i] *= 8.31451e+07 * T[i] * imw[n];
+        }
+    }
+}
+
+
+/*Returns gibbs in mass units (Eq 31.) */
+void CKGMS(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict gms)
+{
+    double tT = *T; /*temporary temperature */
+    double tc[] = { log(tT), tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double RT = 8.31451e+07*tT; /*R*T */
+    gibbs(gms, tc);
+    for (int i = 0; i < 9; i++)
+    {
+        gms[i] *= RT*imw[i];
+    }
+}
+
+
+/*Returns helmholtz in mass units (Eq 32.) */
+void CKAMS(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict ams)
+{
+    double tT = *T; /*temporary temperature */
+    double tc[] = { log(tT), tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double RT = 8.31451e+07*tT; /*R*T */
+    helmholtz(ams, tc);
+    for (int i = 0; i < 9; i++)
+    {
+        ams[i] *= RT*imw[i];
+    }
+}
+
+
+/*Returns the entropies in mass units (Eq 28.) */
+void CKSMS(double * restrict T, int * iwrk, double * restrict rwrk, double * restrict sms)
+{
+    double tT = *T; /*temporary temperature */
+    double tc[] = { log(tT), tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    speciesEntropy(sms, tc);
+    /*multiply by R/molecularweight */
+    sms[0] *= 4.124383662212169e+07; /*H2 */
+    sms[1] *= 2.598381814318037e+06; /*O2 */
+    sms[2] *= 4.615239012974499e+06; /*H2O */
+    sms[3] *= 8.248767324424338e+07; /*H */
+    sms[4] *= 5.196763628636074e+06; /*O */
+    sms[5] *= 4.888768810227566e+06; /*OH */
+    sms[6] *= 2.519031701678171e+06; /*HO2 */
+    sms[7] *= 2.444384405113783e+06; /*H2O2 */
+    sms[8] *= 2.968047434442088e+06; /*N2 */
+}
+
+
+/*Returns the mean specific heat at CP (Eq. 33) */
+void CKCPBL(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict cpbl)
+{
+    int id; /*loop counter */
+    double result = 0; 
+    double tT = *T; /*temporary temperature */
+    double tc[] = { 0, tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double cpor[9]; /* temporary storage */
+    cp_R(cpor, tc);
+
+    /*perform dot product */
+    for (id = 0; id < 9; ++id) {
+        result += x[id]*cpor[id];
+    }
+
+    *cpbl = result * 8.31451e+07;
+}
+
+
+/*Returns the mean specific heat at CP (Eq. 34) */
+void CKCPBS(double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs)
+{
+    double result = 0; 
+    double tT = *T; /*temporary temperature */
+    double tc[] = { 0, tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double cpor[9], tresult[9]; /* temporary storage */
+    cp_R(cpor, tc);
+    for (int i = 0; i < 9; i++)
+    {
+        tresult[i] = cpor[i]*y[i]*imw[i];
+
+    }
+    for (int i = 0; i < 9; i++)
+    {
+        result += tresult[i];
+    }
+
+    *cpbs = result * 8.31451e+07;
+}
+
+
+/*Returns the mean specific heat at CP (Eq. 34) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs)
+{
+    double tc[5], tmp[9], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cp_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<9; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cpbs[i] = result * 8.31451e+07;
+    }
+}
+
+
+/*Returns the mean specific heat at CV (Eq. 35) */
+void CKCVBL(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict cvbl)
+{
+    int id; /*loop counter */
+    double result = 0; 
+    double tT = *T; /*temporary temperature */
+    double tc[] = { 0, tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double cvor[9]; /* temporary storage */
+    cv_R(cvor, tc);
+
+    /*perform dot product */
+    for (id = 0; id < 9; ++id) {
+        result += x[id]*cvor[id];
+    }
+
+    *cvbl = result * 8.31451e+07;
+}
+
+
+/*Returns the mean specific heat at CV (Eq. 36) */
+void CKCVBS(double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs)
+{
+    double result = 0; 
+    double tT = *T; /*temporary temperature */
+    double tc[] = { 0, tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double cvor[9]; /* temporary storage */
+    cv_R(cvor, tc);
+    /*multiply by y/molecularweight */
+    result += cvor[0]*y[0]*imw[0]; /*H2 */
+    result += cvor[1]*y[1]*imw[1]; /*O2 */
+    result += cvor[2]*y[2]*imw[2]; /*H2O */
+    result += cvor[3]*y[3]*imw[3]; /*H */
+    result += cvor[4]*y[4]*imw[4]; /*O */
+    result += cvor[5]*y[5]*imw[5]; /*OH */
+    result += cvor[6]*y[6]*imw[6]; /*HO2 */
+    result += cvor[7]*y[7]*imw[7]; /*H2O2 */
+    result += cvor[8]*y[8]*imw[8]; /*N2 */
+
+    *cvbs = result * 8.31451e+07;
+}
+
+
+/*Returns the mean specific heat at CV (Eq. 36) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs)
+{
+    double tc[5], tmp[9], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cv_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<9; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cvbs[i] = result * 8.31451e+07;
+    }
+}
+
+
+/*Returns the mean enthalpy of the mixture in molar units */
+void CKHBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict hbml)
+{
+    int id; /*loop counter */
+    double result = 0; 
+    double tT = *T; /*temporary temperature */
+    double tc[] = { 0, tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double hml[9]; /* temporary storage */
+    double RT = 8.31451e+07*tT; /*R*T */
+    speciesEnthalpy(hml, tc);
+
+    /*perform dot product */
+    for (id = 0; id < 9; ++id) {
+        result += x[id]*hml[id];
+    }
+
+    *hbml = result * RT;
+}
+
+
+/*Returns mean enthalpy of mixture in mass units */
+void CKHBMS(double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms)
+{
+    double result = 0;
+    double tT = *T; /*temporary temperature */
+    double tc[] = { 0, tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double hml[9], tmp[9]; /* temporary storage */
+    double RT = 8.31451e+07*tT; /*R*T */
+    speciesEnthalpy(hml, tc);
+    int id;
+    for (id = 0; id < 9; ++id) {
+        tmp[id] = y[id]*hml[id]*imw[id];
+    }
+    for (id = 0; id < 9; ++id) {
+        result += tmp[id];
+    }
+
+    *hbms = result * RT;
+}
+
+
+/*Returns mean enthalpy of mixture in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms)
+{
+    double tc[5], tmp[9], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesEnthalpy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<9; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        hbms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
+/*get mean internal energy in molar units */
+void CKUBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict ubml)
+{
+    int id; /*loop counter */
+    double result = 0; 
+    double tT = *T; /*temporary temperature */
+    double tc[] = { 0, tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double uml[9]; /* temporary energy array */
+    double RT = 8.31451e+07*tT; /*R*T */
+    speciesInternalEnergy(uml, tc);
+
+    /*perform dot product */
+    for (id = 0; id < 9; ++id) {
+        result += x[id]*uml[id];
+    }
+
+    *ubml = result * RT;
+}
+
+
+/*get mean internal energy in mass units */
+void CKUBMS(double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms)
+{
+    double result = 0;
+    double tT = *T; /*temporary temperature */
+    double tc[] = { 0, tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double ums[9]; /* temporary energy array */
+    double RT = 8.31451e+07*tT; /*R*T */
+    speciesInternalEnergy(ums, tc);
+    /*perform dot product + scaling by wt */
+    result += y[0]*ums[0]*imw[0]; /*H2 */
+    result += y[1]*ums[1]*imw[1]; /*O2 */
+    result += y[2]*ums[2]*imw[2]; /*H2O */
+    result += y[3]*ums[3]*imw[3]; /*H */
+    result += y[4]*ums[4]*imw[4]; /*O */
+    result += y[5]*ums[5]*imw[5]; /*OH */
+    result += y[6]*ums[6]*imw[6]; /*HO2 */
+    result += y[7]*ums[7]*imw[7]; /*H2O2 */
+    result += y[8]*ums[8]*imw[8]; /*N2 */
+
+    *ubms = result * RT;
+}
+
+
+/*get mean internal energy in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms)
+{
+    double tc[5], tmp[9], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesInternalEnergy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<9; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        ubms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
+/*get mixture entropy in molar units */
+void CKSBML(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict sbml)
+{
+    int id; /*loop counter */
+    double result = 0; 
+    /*Log of normalized pressure in cgs units dynes/cm^2 by Patm */
+    double logPratio = log ( *P / 1013250.0 ); 
+    double tT = *T; /*temporary temperature */
+    double tc[] = { log(tT), tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double sor[9]; /* temporary storage */
+    speciesEntropy(sor, tc);
+
+    /*Compute Eq 42 */
+    for (id = 0; id < 9; ++id) {
+        result += x[id]*(sor[id]-log((x[id]+1e-100))-logPratio);
+    }
+
+    *sbml = result * 8.31451e+07;
+}
+
+
+/*get mixture entropy in mass units */
+void CKSBMS(double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict sbms)
+{
+    double result = 0; 
+    /*Log of normalized pressure in cgs units dynes/cm^2 by Patm */
+    double logPratio = log ( *P / 1013250.0 ); 
+    double tT = *T; /*temporary temperature */
+    double tc[] = { log(tT), tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double sor[9]; /* temporary storage */
+    double x[9]; /* need a ytx conversion */
+    double YOW = 0; /*See Eq 4, 6 in CK Manual */
+    /*Compute inverse of mean molecular wt first */
+    YOW += y[0]*imw[0]; /*H2 */
+    YOW += y[1]*imw[1]; /*O2 */
+    YOW += y[2]*imw[2]; /*H2O */
+    YOW += y[3]*imw[3]; /*H */
+    YOW += y[4]*imw[4]; /*O */
+    YOW += y[5]*imw[5]; /*OH */
+    YOW += y[6]*imw[6]; /*HO2 */
+    YOW += y[7]*imw[7]; /*H2O2 */
+    YOW += y[8]*imw[8]; /*N2 */
+    /*Now compute y to x conversion */
+    x[0] = y[0]/(2.015940*YOW); 
+    x[1] = y[1]/(31.998800*YOW); 
+    x[2] = y[2]/(18.015340*YOW); 
+    x[3] = y[3]/(1.007970*YOW); 
+    x[4] = y[4]/(15.999400*YOW); 
+    x[5] = y[5]/(17.007370*YOW); 
+    x[6] = y[6]/(33.006770*YOW); 
+    x[7] = y[7]/(34.014740*YOW); 
+    x[8] = y[8]/(28.013400*YOW); 
+    speciesEntropy(sor, tc);
+    /*Perform computation in Eq 42 and 43 */
+    result += x[0]*(sor[0]-log((x[0]+1e-100))-logPratio);
+    result += x[1]*(sor[1]-log((x[1]+1e-100))-logPratio);
+    result += x[2]*(sor[2]-log((x[2]+1e-100))-logPratio);
+    result += x[3]*(sor[3]-log((x[3]+1e-100))-logPratio);
+    result += x[4]*(sor[4]-log((x[4]+1e-100))-logPratio);
+    result += x[5]*(sor[5]-log((x[5]+1e-100))-logPratio);
+    result += x[6]*(sor[6]-log((x[6]+1e-100))-logPratio);
+    result += x[7]*(sor[7]-log((x[7]+1e-100))-logPratio);
+    result += x[8]*(sor[8]-log((x[8]+1e-100))-logPratio);
+    /*Scale by R/W */
+    *sbms = result * 8.31451e+07 * YOW;
+}
+
+
+/*Returns mean gibbs free energy in molar units */
+void CKGBML(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict gbml)
+{
+    int id; /*loop counter */
+    double result = 0; 
+    /*Log of normalized pressure in cgs units dynes/cm^2 by Patm */
+    double logPratio = log ( *P / 1013250.0 ); 
+    double tT = *T; /*temporary temperature */
+    double tc[] = { log(tT), tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double RT = 8.31451e+07*tT; /*R*T */
+    double gort[9]; /* temporary storage */
+    /*Compute g/RT */
+    gibbs(gort, tc);
+
+    /*Compute Eq 44 */
+    for (id = 0; id < 9; ++id) {
+        result += x[id]*(gort[id]+log((x[id]+1e-100))+logPratio);
+    }
+
+    *gbml = result * RT;
+}
+
+
+/*Returns mixture gibbs free energy in mass units */
+void CKGBMS(double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict gbms)
+{
+    double result = 0; 
+    /*Log of normalized pressure in cgs units dynes/cm^2 by Patm */
+    double logPratio = log ( *P / 1013250.0 ); 
+    double tT = *T; /*temporary temperature */
+    double tc[] = { log(tT), tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double RT = 8.31451e+07*tT; /*R*T */
+    double gort[9]; /* temporary storage */
+    double x[9]; /* need a ytx conversion */
+    double YOW = 0; /*To hold 1/molecularweight */
+    /*Compute inverse of mean molecular wt first */
+    YOW += y[0]*imw[0]; /*H2 */
+    YOW += y[1]*imw[1]; /*O2 */
+    YOW += y[2]*imw[2]; /*H2O */
+    YOW += y[3]*imw[3]; /*H */
+    YOW += y[4]*imw[4]; /*O */
+    YOW += y[5]*imw[5]; /*OH */
+    YOW += y[6]*imw[6]; /*HO2 */
+    YOW += y[7]*imw[7]; /*H2O2 */
+    YOW += y[8]*imw[8]; /*N2 */
+    /*Now compute y to x conversion */
+    x[0] = y[0]/(2.015940*YOW); 
+    x[1] = y[1]/(31.998800*YOW); 
+    x[2] = y[2]/(18.015340*YOW); 
+    x[3] = y[3]/(1.007970*YOW); 
+    x[4] = y[4]/(15.999400*YOW); 
+    x[5] = y[5]/(17.007370*YOW); 
+    x[6] = y[6]/(33.006770*YOW); 
+    x[7] = y[7]/(34.014740*YOW); 
+    x[8] = y[8]/(28.013400*YOW); 
+    gibbs(gort, tc);
+    /*Perform computation in Eq 44 */
+    result += x[0]*(gort[0]+log((x[0]+1e-100))+logPratio);
+    result += x[1]*(gort[1]+log((x[1]+1e-100))+logPratio);
+    result += x[2]*(gort[2]+log((x[2]+1e-100))+logPratio);
+    result += x[3]*(gort[3]+log((x[3]+1e-100))+logPratio);
+    result += x[4]*(gort[4]+log((x[4]+1e-100))+logPratio);
+    result += x[5]*(gort[5]+log((x[5]+1e-100))+logPratio);
+    result += x[6]*(gort[6]+log((x[6]+1e-100))+logPratio);
+    result += x[7]*(gort[7]+log((x[7]+1e-100))+logPratio);
+    result += x[8]*(gort[8]+log((x[8]+1e-100))+logPratio);
+    /*Scale by RT/W */
+    *gbms = result * RT * YOW;
+}
+
+
+/*Returns mean helmholtz free energy in molar units */
+void CKABML(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict abml)
+{
+    int id; /*loop counter */
+    double result = 0; 
+    /*Log of normalized pressure in cgs units dynes/cm^2 by Patm */
+    double logPratio = log ( *P / 1013250.0 ); 
+    double tT = *T; /*temporary temperature */
+    double tc[] = { log(tT), tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double RT = 8.31451e+07*tT; /*R*T */
+    double aort[9]; /* temporary storage */
+    /*Compute g/RT */
+    helmholtz(aort, tc);
+
+    /*Compute Eq 44 */
+    for (id = 0; id < 9; ++id) {
+        result += x[id]*(aort[id]+log((x[id]+1e-100))+logPratio);
+    }
+
+    *abml = result * RT;
+}
+
+
+/*Returns mixture helmholtz free energy in mass units */
+void CKABMS(double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict abms)
+{
+    double result = 0; 
+    /*Log of normalized pressure in cgs units dynes/cm^2 by Patm */
+    double logPratio = log ( *P / 1013250.0 ); 
+    double tT = *T; /*temporary temperature */
+    double tc[] = { log(tT), tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double RT = 8.31451e+07*tT; /*R*T */
+    double aort[9]; /* temporary storage */
+    double x[9]; /* need a ytx conversion */
+    double YOW = 0; /*To hold 1/molecularweight */
+    /*Compute inverse of mean molecular wt first */
+    YOW += y[0]*imw[0]; /*H2 */
+    YOW += y[1]*imw[1]; /*O2 */
+    YOW += y[2]*imw[2]; /*H2O */
+    YOW += y[3]*imw[3]; /*H */
+    YOW += y[4]*imw[4]; /*O */
+    YOW += y[5]*imw[5]; /*OH */
+    YOW += y[6]*imw[6]; /*HO2 */
+    YOW += y[7]*imw[7]; /*H2O2 */
+    YOW += y[8]*imw[8]; /*N2 */
+    /*Now compute y to x conversion */
+    x[0] = y[0]/(2.015940*YOW); 
+    x[1] = y[1]/(31.998800*YOW); 
+    x[2] = y[2]/(18.015340*YOW); 
+    x[3] = y[3]/(1.007970*YOW); 
+    x[4] = y[4]/(15.999400*YOW); 
+    x[5] = y[5]/(17.007370*YOW); 
+    x[6] = y[6]/(33.006770*YOW); 
+    x[7] = y[7]/(34.014740*YOW); 
+    x[8] = y[8]/(28.013400*YOW); 
+    helmholtz(aort, tc);
+    /*Perform computation in Eq 44 */
+    result += x[0]*(aort[0]+log((x[0]+1e-100))+logPratio);
+    result += x[1]*(aort[1]+log((x[1]+1e-100))+logPratio);
+    result += x[2]*(aort[2]+log((x[2]+1e-100))+logPratio);
+    result += x[3]*(aort[3]+log((x[3]+1e-100))+logPratio);
+    result += x[4]*(aort[4]+log((x[4]+1e-100))+logPratio);
+    result += x[5]*(aort[5]+log((x[5]+1e-100))+logPratio);
+    result += x[6]*(aort[6]+log((x[6]+1e-100))+logPratio);
+    result += x[7]*(aort[7]+log((x[7]+1e-100))+logPratio);
+    result += x[8]*(aort[8]+log((x[8]+1e-100))+logPratio);
+    /*Scale by RT/W */
+    *abms = result * RT * YOW;
+}
+
+
+/*compute the production rate for each species */
+void CKWC(double * restrict T, double * restrict C, int * iwrk, double * restrict rwrk, double * restrict wdot)
+{
+    int id; /*loop counter */
+
+    /*convert to SI */
+    for (id = 0; id < 9; ++id) {
+        C[id] *= 1.0e6;
+    }
+
+    /*convert to chemkin units */
+    productionRate(wdot, C, *T);
+
+    /*convert to chemkin units */
+    for (id = 0; id < 9; ++id) {
+        C[id] *= 1.0e-6;
+        wdot[id] *= 1.0e-6;
+    }
+}
+
+
+/*Returns the molar production rate of species */
+/*Given P, T, and mass fractions */
+void CKWYP(double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wdot)
+{
+    int id; /*loop counter */
+    double c[9]; /*temporary storage */
+    double YOW = 0; 
+    double PWORT; 
+    /*Compute inverse of mean molecular wt first */
+    YOW += y[0]*imw[0]; /*H2 */
+    YOW += y[1]*imw[1]; /*O2 */
+    YOW += y[2]*imw[2]; /*H2O */
+    YOW += y[3]*imw[3]; /*H */
+    YOW += y[4]*imw[4]; /*O */
+    YOW += y[5]*imw[5]; /*OH */
+    YOW += y[6]*imw[6]; /*HO2 */
+    YOW += y[7]*imw[7]; /*H2O2 */
+    YOW += y[8]*imw[8]; /*N2 */
+    /*PW/RT (see Eq. 7) */
+    PWORT = (*P)/(YOW * 8.31451e+07 * (*T)); 
+    /*multiply by 1e6 so c goes to SI */
+    PWORT *= 1e6; 
+    /*Now compute conversion (and go to SI) */
+    c[0] = PWORT * y[0]*imw[0]; 
+    c[1] = PWORT * y[1]*imw[1]; 
+    c[2] = PWORT * y[2]*imw[2]; 
+    c[3] = PWORT * y[3]*imw[3]; 
+    c[4] = PWORT * y[4]*imw[4]; 
+    c[5] = PWORT * y[5]*imw[5]; 
+    c[6] = PWORT * y[6]*imw[6]; 
+    c[7] = PWORT * y[7]*imw[7]; 
+    c[8] = PWORT * y[8]*imw[8]; 
+
+    /*convert to chemkin units */
+    productionRate(wdot, c, *T);
+
+    /*convert to chemkin units */
+    for (id = 0; id < 9; ++id) {
+        wdot[id] *= 1.0e-6;
+    }
+}
+
+
+/*Returns the molar production rate of species */
+/*Given P, T, and mole fractions */
+void CKWXP(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict wdot)
+{
+    int id; /*loop counter */
+    double c[9]; /*temporary storage */
+    double PORT = 1e6 * (*P)/(8.31451e+07 * (*T)); /*1e6 * P/RT so c goes to SI units */
+
+    /*Compute conversion, see Eq 10 */
+    for (id = 0; id < 9; ++id) {
+        c[id] = x[id]*PORT;
+    }
+
+    /*convert to chemkin units */
+    productionRate(wdot, c, *T);
+
+    /*convert to chemkin units */
+    for (id = 0; id < 9; ++id) {
+        wdot[id] *= 1.0e-6;
+    }
+}
+
+
+/*Returns the molar production rate of species */
+/*Given rho, T, and mass fractions */
+void CKWYR(double * restrict rho, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wdot)
+{
+    int id; /*loop counter */
+    double c[9]; /*temporary storage */
+    /*See Eq 8 with an extra 1e6 so c goes to SI */
+    c[0] = 1e6 * (*rho) * y[0]*imw[0]; 
+    c[1] = 1e6 * (*rho) * y[1]*imw[1]; 
+    c[2] = 1e6 * (*rho) * y[2]*imw[2]; 
+    c[3] = 1e6 * (*rho) * y[3]*imw[3]; 
+    c[4] = 1e6 * (*rho) * y[4]*imw[4]; 
+    c[5] = 1e6 * (*rho) * y[5]*imw[5]; 
+    c[6] = 1e6 * (*rho) * y[6]*imw[6]; 
+    c[7] = 1e6 * (*rho) * y[7]*imw[7]; 
+    c[8] = 1e6 * (*rho) * y[8]*imw[8]; 
+
+    /*call productionRate */
+    productionRate(wdot, c, *T);
+
+    /*convert to chemkin units */
+    for (id = 0; id < 9; ++id) {
+        wdot[id] *= 1.0e-6;
+    }
+}
+
+
+/*Returns the molar production rate of species */
+/*Given rho, T, and mass fractions */
+void VCKWYR(int * restrict np, double * restrict rho, double * restrict T,
+	    double * restrict y, int * restrict iwrk, double * restrict rwrk,
+	    double * restrict wdot)
+{
+    double c[9*(*np)]; /*temporary storage */
+    /*See Eq 8 with an extra 1e6 so c goes to SI */
+    for (int n=0; n<9; n++) {
+        for (int i=0; i<(*np); i++) {
+            c[n*(*np)+i] = 1.0e6 * rho[i] * y[n*(*np)+i] * imw[n];
+        }
+    }
+
+    /*call productionRate */
+    vproductionRate(*np, wdot, c, T);
+
+    /*convert to chemkin units */
+    for (int i=0; i<9*(*np); i++) {
+        wdot[i] *= 1.0e-6;
+    }
+}
+
+
+/*Returns the molar production rate of species */
+/*Given rho, T, and mole fractions */
+void CKWXR(double * restrict rho, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict wdot)
+{
+    int id; /*loop counter */
+    double c[9]; /*temporary storage */
+    double XW = 0; /*See Eq 4, 11 in CK Manual */
+    double ROW; 
+    /*Compute mean molecular wt first */
+    XW += x[0]*2.015940; /*H2 */
+    XW += x[1]*31.998800; /*O2 */
+    XW += x[2]*18.015340; /*H2O */
+    XW += x[3]*1.007970; /*H */
+    XW += x[4]*15.999400; /*O */
+    XW += x[5]*17.007370; /*OH */
+    XW += x[6]*33.006770; /*HO2 */
+    XW += x[7]*34.014740; /*H2O2 */
+    XW += x[8]*28.013400; /*N2 */
+    /*Extra 1e6 factor to take c to SI */
+    ROW = 1e6*(*rho) / XW;
+
+    /*Compute conversion, see Eq 11 */
+    for (id = 0; id < 9; ++id) {
+        c[id] = x[id]*ROW;
+    }
+
+    /*convert to chemkin units */
+    productionRate(wdot, c, *T);
+
+    /*convert to chemkin units */
+    for (id = 0; id < 9; ++id) {
+        wdot[id] *= 1.0e-6;
+    }
+}
+
+
+/*Returns the rate of progress for each reaction */
+void CKQC(double * restrict T, double * restrict C, int * iwrk, double * restrict rwrk, double * restrict qdot)
+{
+    int id; /*loop counter */
+
+    /*convert to SI */
+    for (id = 0; id < 9; ++id) {
+        C[id] *= 1.0e6;
+    }
+
+    /*convert to chemkin units */
+    progressRate(qdot, C, *T);
+
+    /*convert to chemkin units */
+    for (id = 0; id < 9; ++id) {
+        C[id] *= 1.0e-6;
+    }
+
+    for (id = 0; id < 21; ++id) {
+        qdot[id] *= 1.0e-6;
+    }
+}
+
+
+/*Returns the progress rates of each reactions */
+/*Given P, T, and mole fractions */
+void CKKFKR(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict q_f, double * restrict q_r)
+{
+    int id; /*loop counter */
+    double c[9]; /*temporary storage */
+    double PORT = 1e6 * (*P)/(8.31451e+07 * (*T)); /*1e6 * P/RT so c goes to SI units */
+
+    /*Compute conversion, see Eq 10 */
+    for (id = 0; id < 9; ++id) {
+        c[id] = x[id]*PORT;
+    }
+
+    /*convert to chemkin units */
+    progressRateFR(q_f, q_r, c, *T);
+
+    /*convert to chemkin units */
+    for (id = 0; id < 21; ++id) {
+        q_f[id] *= 1.0e-6;
+        q_r[id] *= 1.0e-6;
+    }
+}
+
+
+/*Returns the progress rates of each reactions */
+/*Given P, T, and mass fractions */
+void CKQYP(double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict qdot)
+{
+    int id; /*loop counter */
+    double c[9]; /*temporary storage */
+    double YOW = 0; 
+    double PWORT; 
+    /*Compute inverse of mean molecular wt first */
+    YOW += y[0]*imw[0]; /*H2 */
+    YOW += y[1]*imw[1]; /*O2 */
+    YOW += y[2]*imw[2]; /*H2O */
+    YOW += y[3]*imw[3]; /*H */
+    YOW += y[4]*imw[4]; /*O */
+    YOW += y[5]*imw[5]; /*OH */
+    YOW += y[6]*imw[6]; /*HO2 */
+    YOW += y[7]*imw[7]; /*H2O2 */
+    YOW += y[8]*imw[8]; /*N2 */
+    /*PW/RT (see Eq. 7) */
+    PWORT = (*P)/(YOW * 8.31451e+07 * (*T)); 
+    /*multiply by 1e6 so c goes to SI */
+    PWORT *= 1e6; 
+    /*Now compute conversion (and go to SI) */
+    c[0] = PWORT * y[0]*imw[0]; 
+    c[1] = PWORT * y[1]*imw[1]; 
+    c[2] = PWORT * y[2]*imw[2]; 
+    c[3] = PWORT * y[3]*imw[3]; 
+    c[4] = PWORT * y[4]*imw[4]; 
+    c[5] = PWORT * y[5]*imw[5]; 
+    c[6] = PWORT * y[6]*imw[6]; 
+    c[7] = PWORT * y[7]*imw[7]; 
+    c[8] = PWORT * y[8]*imw[8]; 
+
+    /*convert to chemkin units */
+    progressRate(qdot, c, *T);
+
+    /*convert to chemkin units */
+    for (id = 0; id < 21; ++id) {
+        qdot[id] *= 1.0e-6;
+    }
+}
+
+
+/*Returns the progress rates of each reactions */
+/*Given P, T, and mole fractions */
+void CKQXP(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict qdot)
+{
+    int id; /*loop counter */
+    double c[9]; /*temporary storage */
+    double PORT = 1e6 * (*P)/(8.31451e+07 * (*T)); /*1e6 * P/RT so c goes to SI units */
+
+    /*Compute conversion, see Eq 10 */
+    for (id = 0; id < 9; ++id) {
+        c[id] = x[id]*PORT;
+    }
+
+    /*convert to chemkin units */
+    progressRate(qdot, c, *T);
+
+    /*convert to chemkin units */
+    for (id = 0; id < 21; ++id) {
+        qdot[id] *= 1.0e-6;
+    }
+}
+
+
+/*Returns the progress rates of each reactions */
+/*Given rho, T, and mass fractions */
+void CKQYR(double * restrict rho, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict qdot)
+{
+    int id; /*loop counter */
+    double c[9]; /*temporary storage */
+    /*See Eq 8 with an extra 1e6 so c goes to SI */
+    c[0] = 1e6 * (*rho) * y[0]*imw[0]; 
+    c[1] = 1e6 * (*rho) * y[1]*imw[1]; 
+    c[2] = 1e6 * (*rho) * y[2]*imw[2]; 
+    c[3] = 1e6 * (*rho) * y[3]*imw[3]; 
+    c[4] = 1e6 * (*rho) * y[4]*imw[4]; 
+    c[5] = 1e6 * (*rho) * y[5]*imw[5]; 
+    c[6] = 1e6 * (*rho) * y[6]*imw[6]; 
+    c[7] = 1e6 * (*rho) * y[7]*imw[7]; 
+    c[8] = 1e6 * (*rho) * y[8]*imw[8]; 
+
+    /*call progressRate */
+    progressRate(qdot, c, *T);
+
+    /*convert to chemkin units */
+    for (id = 0; id < 21; ++id) {
+        qdot[id] *= 1.0e-6;
+    }
+}
+
+
+/*Returns the progress rates of each reactions */
+/*Given rho, T, and mole fractions */
+void CKQXR(double * restrict rho, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict qdot)
+{
+    int id; /*loop counter */
+    double c[9]; /*temporary storage */
+    double XW = 0; /*See Eq 4, 11 in CK Manual */
+    double ROW; 
+    /*Compute mean molecular wt first */
+    XW += x[0]*2.015940; /*H2 */
+    XW += x[1]*31.998800; /*O2 */
+    XW += x[2]*18.015340; /*H2O */
+    XW += x[3]*1.007970; /*H */
+    XW += x[4]*15.999400; /*O */
+    XW += x[5]*17.007370; /*OH */
+    XW += x[6]*33.006770; /*HO2 */
+    XW += x[7]*34.014740; /*H2O2 */
+    XW += x[8]*28.013400; /*N2 */
+    /*Extra 1e6 factor to take c to SI */
+    ROW = 1e6*(*rho) / XW;
+
+    /*Compute conversion, see Eq 11 */
+    for (id = 0; id < 9; ++id) {
+        c[id] = x[id]*ROW;
+    }
+
+    /*convert to chemkin units */
+    progressRate(qdot, c, *T);
+
+    /*convert to chemkin units */
+    for (id = 0; id < 21; ++id) {
+        qdot[id] *= 1.0e-6;
+    }
+}
+
+
+/*Returns the stoichiometric coefficients */
+/*of the reaction mechanism. (Eq 50) */
+void CKNU(int * kdim, int * iwrk, double * restrict rwrk, int * nuki)
+{
+    int id; /*loop counter */
+    int kd = (*kdim); 
+    /*Zero nuki */
+    for (id = 0; id < 9 * kd; ++ id) {
+         nuki[id] = 0; 
+    }
+
+    /*reaction 1: H + O2 (+M) <=> HO2 (+M) */
+    nuki[ 3 * kd + 0 ] += -1 ;
+    nuki[ 1 * kd + 0 ] += -1 ;
+    nuki[ 6 * kd + 0 ] += +1 ;
+
+    /*reaction 2: H2O2 (+M) <=> OH + OH (+M) */
+    nuki[ 7 * kd + 1 ] += -1 ;
+    nuki[ 5 * kd + 1 ] += +1 ;
+    nuki[ 5 * kd + 1 ] += +1 ;
+
+    /*reaction 3: H2 + M <=> H + H + M */
+    nuki[ 0 * kd + 2 ] += -1 ;
+    nuki[ 3 * kd + 2 ] += +1 ;
+    nuki[ 3 * kd + 2 ] += +1 ;
+
+    /*reaction 4: O + O + M <=> O2 + M */
+    nuki[ 4 * kd + 3 ] += -1 ;
+    nuki[ 4 * kd + 3 ] += -1 ;
+    nuki[ 1 * kd + 3 ] += +1 ;
+
+    /*reaction 5: O + H + M <=> OH + M */
+    nuki[ 4 * kd + 4 ] += -1 ;
+    nuki[ 3 * kd + 4 ] += -1 ;
+    nuki[ 5 * kd + 4 ] += +1 ;
+
+    /*reaction 6: H + OH + M <=> H2O + M */
+    nuki[ 3 * kd + 5 ] += -1 ;
+    nuki[ 5 * kd + 5 ] += -1 ;
+    nuki[ 2 * kd + 5 ] += +1 ;
+
+    /*reaction 7: H + O2 <=> O + OH */
+    nuki[ 3 * kd + 6 ] += -1 ;
+    nuki[ 1 * kd + 6 ] += -1 ;
+    nuki[ 4 * kd + 6 ] += +1 ;
+    nuki[ 5 * kd + 6 ] += +1 ;
+
+    /*reaction 8: O + H2 <=> H + OH */
+    nuki[ 4 * kd + 7 ] += -1 ;
+    nuki[ 0 * kd + 7 ] += -1 ;
+    nuki[ 3 * kd + 7 ] += +1 ;
+    nuki[ 5 * kd + 7 ] += +1 ;
+
+    /*reaction 9: H2 + OH <=> H2O + H */
+    nuki[ 0 * kd + 8 ] += -1 ;
+    nuki[ 5 * kd + 8 ] += -1 ;
+    nuki[ 2 * kd + 8 ] += +1 ;
+    nuki[ 3 * kd + 8 ] += +1 ;
+
+    /*reaction 10: O + H2O <=> OH + OH */
+    nuki[ 4 * kd + 9 ] += -1 ;
+    nuki[ 2 * kd + 9 ] += -1 ;
+    nuki[ 5 * kd + 9 ] += +1 ;
+    nuki[ 5 * kd + 9 ] += +1 ;
+
+    /*reaction 11: HO2 + H <=> H2 + O2 */
+    nuki[ 6 * kd + 10 ] += -1 ;
+    nuki[ 3 * kd + 10 ] += -1 ;
+    nuki[ 0 * kd + 10 ] += +1 ;
+    nuki[ 1 * kd + 10 ] += +1 ;
+
+    /*reaction 12: HO2 + H <=> OH + OH */
+    nuki[ 6 * kd + 11 ] += -1 ;
+    nuki[ 3 * kd + 11 ] += -1 ;
+    nuki[ 5 * kd + 11 ] += +1 ;
+    nuki[ 5 * kd + 11 ] += +1 ;
+
+    /*reaction 13: HO2 + O <=> O2 + OH */
+    nuki[ 6 * kd + 12 ] += -1 ;
+    nuki[ 4 * kd + 12 ] += -1 ;
+    nuki[ 1 * kd + 12 ] += +1 ;
+    nuki[ 5 * kd + 12 ] += +1 ;
+
+    /*reaction 14: HO2 + OH <=> H2O + O2 */
+    nuki[ 6 * kd + 13 ] += -1 ;
+    nuki[ 5 * kd + 13 ] += -1 ;
+    nuki[ 2 * kd + 13 ] += +1 ;
+    nuki[ 1 * kd + 13 ] += +1 ;
+
+    /*reaction 15: HO2 + HO2 <=> H2O2 + O2 */
+    nuki[ 6 * kd + 14 ] += -1 ;
+    nuki[ 6 * kd + 14 ] += -1 ;
+    nuki[ 7 * kd + 14 ] += +1 ;
+    nuki[ 1 * kd + 14 ] += +1 ;
+
+    /*reaction 16: HO2 + HO2 <=> H2O2 + O2 */
+    nuki[ 6 * kd + 15 ] += -1 ;
+    nuki[ 6 * kd + 15 ] += -1 ;
+    nuki[ 7 * kd + 15 ] += +1 ;
+    nuki[ 1 * kd + 15 ] += +1 ;
+
+    /*reaction 17: H2O2 + H <=> H2O + OH */
+    nuki[ 7 * kd + 16 ] += -1 ;
+    nuki[ 3 * kd + 16 ] += -1 ;
+    nuki[ 2 * kd + 16 ] += +1 ;
+    nuki[ 5 * kd + 16 ] += +1 ;
+
+    /*reaction 18: H2O2 + H <=> HO2 + H2 */
+    nuki[ 7 * kd + 17 ] += -1 ;
+    nuki[ 3 * kd + 17 ] += -1 ;
+    nuki[ 6 * kd + 17 ] += +1 ;
+    nuki[ 0 * kd + 17 ] += +1 ;
+
+    /*reaction 19: H2O2 + O <=> OH + HO2 */
+    nuki[ 7 * kd + 18 ] += -1 ;
+    nuki[ 4 * kd + 18 ] += -1 ;
+    nuki[ 5 * kd + 18 ] += +1 ;
+    nuki[ 6 * kd + 18 ] += +1 ;
+
+    /*reaction 20: H2O2 + OH <=> HO2 + H2O */
+    nuki[ 7 * kd + 19 ] += -1 ;
+    nuki[ 5 * kd + 19 ] += -1 ;
+    nuki[ 6 * kd + 19 ] += +1 ;
+    nuki[ 2 * kd + 19 ] += +1 ;
+
+    /*reaction 21: H2O2 + OH <=> HO2 + H2O */
+    nuki[ 7 * kd + 20 ] += -1 ;
+    nuki[ 5 * kd + 20 ] += -1 ;
+    nuki[ 6 * kd + 20 ] += +1 ;
+    nuki[ 2 * kd + 20 ] += +1 ;
+}
+
+
+/*Returns the elemental composition  */
+/*of the speciesi (mdim is num of elements) */
+void CKNCF(int * mdim, int * iwrk, double * restrict rwrk, int * ncf)
+{
+    int id; /*loop counter */
+    int kd = (*mdim); 
+    /*Zero ncf */
+    for (id = 0; id < kd * 9; ++ id) {
+         ncf[id] = 0; 
+    }
+
+    /*H2 */
+    ncf[ 0 * kd + 0 ] = 2; /*H */
+
+    /*O2 */
+    ncf[ 1 * kd + 1 ] = 2; /*O */
+
+    /*H2O */
+    ncf[ 2 * kd + 0 ] = 2; /*H */
+    ncf[ 2 * kd + 1 ] = 1; /*O */
+
+    /*H */
+    ncf[ 3 * kd + 0 ] = 1; /*H */
+
+    /*O */
+    ncf[ 4 * kd + 1 ] = 1; /*O */
+
+    /*OH */
+    ncf[ 5 * kd + 1 ] = 1; /*O */
+    ncf[ 5 * kd + 0 ] = 1; /*H */
+
+    /*HO2 */
+    ncf[ 6 * kd + 0 ] = 1; /*H */
+    ncf[ 6 * kd + 1 ] = 2; /*O */
+
+    /*H2O2 */
+    ncf[ 7 * kd + 0 ] = 2; /*H */
+    ncf[ 7 * kd + 1 ] = 2; /*O */
+
+    /*N2 */
+    ncf[ 8 * kd + 2 ] = 2; /*N */
+
+}
+
+
+/*Returns the arrehenius coefficients  */
+/*for all reactions */
+void CKABE(int * iwrk, double * restrict rwrk, double * restrict a, double * restrict b, double * restrict e)
+{
+    for (int i=0; i<21; ++i) {
+        a[i] = fwd_A[i];
+        b[i] = fwd_beta[i];
+        e[i] = fwd_Ea[i];
+    }
+
+    return;
+}
+
+
+/*Returns the equil constants for each reaction */
+void CKEQC(double * restrict T, double * restrict C, int * iwrk, double * restrict rwrk, double * restrict eqcon)
+{
+    double tT = *T; /*temporary temperature */
+    double tc[] = { log(tT), tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double gort[9]; /* temporary storage */
+
+    /*compute the Gibbs free energy */
+    gibbs(gort, tc);
+
+    /*compute the equilibrium constants */
+    equilibriumConstants(eqcon, gort, tT);
+
+    /*reaction 1: H + O2 (+M) <=> HO2 (+M) */
+    eqcon[0] *= 1e+06; 
+
+    /*reaction 2: H2O2 (+M) <=> OH + OH (+M) */
+    eqcon[1] *= 1e-06; 
+
+    /*reaction 3: H2 + M <=> H + H + M */
+    eqcon[2] *= 1e-06; 
+
+    /*reaction 4: O + O + M <=> O2 + M */
+    eqcon[3] *= 1e+06; 
+
+    /*reaction 5: O + H + M <=> OH + M */
+    eqcon[4] *= 1e+06; 
+
+    /*reaction 6: H + OH + M <=> H2O + M */
+    eqcon[5] *= 1e+06; 
+
+    /*reaction 7: H + O2 <=> O + OH */
+    /*eqcon[6] *= 1;  */
+
+    /*reaction 8: O + H2 <=> H + OH */
+    /*eqcon[7] *= 1;  */
+
+    /*reaction 9: H2 + OH <=> H2O + H */
+    /*eqcon[8] *= 1;  */
+
+    /*reaction 10: O + H2O <=> OH + OH */
+    /*eqcon[9] *= 1;  */
+
+    /*reaction 11: HO2 + H <=> H2 + O2 */
+    /*eqcon[10] *= 1;  */
+
+    /*reaction 12: HO2 + H <=> OH + OH */
+    /*eqcon[11] *= 1;  */
+
+    /*reaction 13: HO2 + O <=> O2 + OH */
+    /*eqcon[12] *= 1;  */
+
+    /*reaction 14: HO2 + OH <=> H2O + O2 */
+    /*eqcon[13] *= 1;  */
+
+    /*reaction 15: HO2 + HO2 <=> H2O2 + O2 */
+    /*eqcon[14] *= 1;  */
+
+    /*reaction 16: HO2 + HO2 <=> H2O2 + O2 */
+    /*eqcon[15] *= 1;  */
+
+    /*reaction 17: H2O2 + H <=> H2O + OH */
+    /*eqcon[16] *= 1;  */
+
+    /*reaction 18: H2O2 + H <=> HO2 + H2 */
+    /*eqcon[17] *= 1;  */
+
+    /*reaction 19: H2O2 + O <=> OH + HO2 */
+    /*eqcon[18] *= 1;  */
+
+    /*reaction 20: H2O2 + OH <=> HO2 + H2O */
+    /*eqcon[19] *= 1;  */
+
+    /*reaction 21: H2O2 + OH <=> HO2 + H2O */
+    /*eqcon[20] *= 1;  */
+}
+
+
+/*Returns the equil constants for each reaction */
+/*Given P, T, and mass fractions */
+void CKEQYP(double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict eqcon)
+{
+    double tT = *T; /*temporary temperature */
+    double tc[] = { log(tT), tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double gort[9]; /* temporary storage */
+
+    /*compute the Gibbs free energy */
+    gibbs(gort, tc);
+
+    /*compute the equilibrium constants */
+    equilibriumConstants(eqcon, gort, tT);
+
+    /*reaction 1: H + O2 (+M) <=> HO2 (+M) */
+    eqcon[0] *= 1e+06; 
+
+    /*reaction 2: H2O2 (+M) <=> OH + OH (+M) */
+    eqcon[1] *= 1e-06; 
+
+    /*reaction 3: H2 + M <=> H + H + M */
+    eqcon[2] *= 1e-06; 
+
+    /*reaction 4: O + O + M <=> O2 + M */
+    eqcon[3] *= 1e+06; 
+
+    /*reaction 5: O + H + M <=> OH + M */
+    eqcon[4] *= 1e+06; 
+
+    /*reaction 6: H + OH + M <=> H2O + M */
+    eqcon[5] *= 1e+06; 
+
+    /*reaction 7: H + O2 <=> O + OH */
+    /*eqcon[6] *= 1;  */
+
+    /*reaction 8: O + H2 <=> H + OH */
+    /*eqcon[7] *= 1;  */
+
+    /*reaction 9: H2 + OH <=> H2O + H */
+    /*eqcon[8] *= 1;  */
+
+    /*reaction 10: O + H2O <=> OH + OH */
+    /*eqcon[9] *= 1;  */
+
+    /*reaction 11: HO2 + H <=> H2 + O2 */
+    /*eqcon[10] *= 1;  */
+
+    /*reaction 12: HO2 + H <=> OH + OH */
+    /*eqcon[11] *= 1;  */
+
+    /*reaction 13: HO2 + O <=> O2 + OH */
+    /*eqcon[12] *= 1;  */
+
+    /*reaction 14: HO2 + OH <=> H2O + O2 */
+    /*eqcon[13] *= 1;  */
+
+    /*reaction 15: HO2 + HO2 <=> H2O2 + O2 */
+    /*eqcon[14] *= 1;  */
+
+    /*reaction 16: HO2 + HO2 <=> H2O2 + O2 */
+    /*eqcon[15] *= 1;  */
+
+    /*reaction 17: H2O2 + H <=> H2O + OH */
+    /*eqcon[16] *= 1;  */
+
+    /*reaction 18: H2O2 + H <=> HO2 + H2 */
+    /*eqcon[17] *= 1;  */
+
+    /*reaction 19: H2O2 + O <=> OH + HO2 */
+    /*eqcon[18] *= 1;  */
+
+    /*reaction 20: H2O2 + OH <=> HO2 + H2O */
+    /*eqcon[19] *= 1;  */
+
+    /*reaction 21: H2O2 + OH <=> HO2 + H2O */
+    /*eqcon[20] *= 1;  */
+}
+
+
+/*Returns the equil constants for each reaction */
+/*Given P, T, and mole fractions */
+void CKEQXP(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict eqcon)
+{
+    double tT = *T; /*temporary temperature */
+    double tc[] = { log(tT), tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double gort[9]; /* temporary storage */
+
+    /*compute the Gibbs free energy */
+    gibbs(gort, tc);
+
+    /*compute the equilibrium constants */
+    equilibriumConstants(eqcon, gort, tT);
+
+    /*reaction 1: H + O2 (+M) <=> HO2 (+M) */
+    eqcon[0] *= 1e+06; 
+
+    /*reaction 2: H2O2 (+M) <=> OH + OH (+M) */
+    eqcon[1] *= 1e-06; 
+
+    /*reaction 3: H2 + M <=> H + H + M */
+    eqcon[2] *= 1e-06; 
+
+    /*reaction 4: O + O + M <=> O2 + M */
+    eqcon[3] *= 1e+06; 
+
+    /*reaction 5: O + H + M <=> OH + M */
+    eqcon[4] *= 1e+06; 
+
+    /*reaction 6: H + OH + M <=> H2O + M */
+    eqcon[5] *= 1e+06; 
+
+    /*reaction 7: H + O2 <=> O + OH */
+    /*eqcon[6] *= 1;  */
+
+    /*reaction 8: O + H2 <=> H + OH */
+    /*eqcon[7] *= 1;  */
+
+    /*reaction 9: H2 + OH <=> H2O + H */
+    /*eqcon[8] *= 1;  */
+
+    /*reaction 10: O + H2O <=> OH + OH */
+    /*eqcon[9] *= 1;  */
+
+    /*reaction 11: HO2 + H <=> H2 + O2 */
+    /*eqcon[10] *= 1;  */
+
+    /*reaction 12: HO2 + H <=> OH + OH */
+    /*eqcon[11] *= 1;  */
+
+    /*reaction 13: HO2 + O <=> O2 + OH */
+    /*eqcon[12] *= 1;  */
+
+    /*reaction 14: HO2 + OH <=> H2O + O2 */
+    /*eqcon[13] *= 1;  */
+
+    /*reaction 15: HO2 + HO2 <=> H2O2 + O2 */
+    /*eqcon[14] *= 1;  */
+
+    /*reaction 16: HO2 + HO2 <=> H2O2 + O2 */
+    /*eqcon[15] *= 1;  */
+
+    /*reaction 17: H2O2 + H <=> H2O + OH */
+    /*eqcon[16] *= 1;  */
+
+    /*reaction 18: H2O2 + H <=> HO2 + H2 */
+    /*eqcon[17] *= 1;  */
+
+    /*reaction 19: H2O2 + O <=> OH + HO2 */
+    /*eqcon[18] *= 1;  */
+
+    /*reaction 20: H2O2 + OH <=> HO2 + H2O */
+    /*eqcon[19] *= 1;  */
+
+    /*reaction 21: H2O2 + OH <=> HO2 + H2O */
+    /*eqcon[20] *= 1;  */
+}
+
+
+/*Returns the equil constants for each reaction */
+/*Given rho, T, and mass fractions */
+void CKEQYR(double * restrict rho, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict eqcon)
+{
+    double tT = *T; /*temporary temperature */
+    double tc[] = { log(tT), tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double gort[9]; /* temporary storage */
+
+    /*compute the Gibbs free energy */
+    gibbs(gort, tc);
+
+    /*compute the equilibrium constants */
+    equilibriumConstants(eqcon, gort, tT);
+
+    /*reaction 1: H + O2 (+M) <=> HO2 (+M) */
+    eqcon[0] *= 1e+06; 
+
+    /*reaction 2: H2O2 (+M) <=> OH + OH (+M) */
+    eqcon[1] *= 1e-06; 
+
+    /*reaction 3: H2 + M <=> H + H + M */
+    eqcon[2] *= 1e-06; 
+
+    /*reaction 4: O + O + M <=> O2 + M */
+    eqcon[3] *= 1e+06; 
+
+    /*reaction 5: O + H + M <=> OH + M */
+    eqcon[4] *= 1e+06; 
+
+    /*reaction 6: H + OH + M <=> H2O + M */
+    eqcon[5] *= 1e+06; 
+
+    /*reaction 7: H + O2 <=> O + OH */
+    /*eqcon[6] *= 1;  */
+
+    /*reaction 8: O + H2 <=> H + OH */
+    /*eqcon[7] *= 1;  */
+
+    /*reaction 9: H2 + OH <=> H2O + H */
+    /*eqcon[8] *= 1;  */
+
+    /*reaction 10: O + H2O <=> OH + OH */
+    /*eqcon[9] *= 1;  */
+
+    /*reaction 11: HO2 + H <=> H2 + O2 */
+    /*eqcon[10] *= 1;  */
+
+    /*reaction 12: HO2 + H <=> OH + OH */
+    /*eqcon[11] *= 1;  */
+
+    /*reaction 13: HO2 + O <=> O2 + OH */
+    /*eqcon[12] *= 1;  */
+
+    /*reaction 14: HO2 + OH <=> H2O + O2 */
+    /*eqcon[13] *= 1;  */
+
+    /*reaction 15: HO2 + HO2 <=> H2O2 + O2 */
+    /*eqcon[14] *= 1;  */
+
+    /*reaction 16: HO2 + HO2 <=> H2O2 + O2 */
+    /*eqcon[15] *= 1;  */
+
+    /*reaction 17: H2O2 + H <=> H2O + OH */
+    /*eqcon[16] *= 1;  */
+
+    /*reaction 18: H2O2 + H <=> HO2 + H2 */
+    /*eqcon[17] *= 1;  */
+
+    /*reaction 19: H2O2 + O <=> OH + HO2 */
+    /*eqcon[18] *= 1;  */
+
+    /*reaction 20: H2O2 + OH <=> HO2 + H2O */
+    /*eqcon[19] *= 1;  */
+
+    /*reaction 21: H2O2 + OH <=> HO2 + H2O */
+    /*eqcon[20] *= 1;  */
+}
+
+
+/*Returns the equil constants for each reaction */
+/*Given rho, T, and mole fractions */
+void CKEQXR(double * restrict rho, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict eqcon)
+{
+    double tT = *T; /*temporary temperature */
+    double tc[] = { log(tT), tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; /*temperature cache */
+    double gort[9]; /* temporary storage */
+
+    /*compute the Gibbs free energy */
+    gibbs(gort, tc);
+
+    /*compute the equilibrium constants */
+    equilibriumConstants(eqcon, gort, tT);
+
+    /*reaction 1: H + O2 (+M) <=> HO2 (+M) */
+    eqcon[0] *= 1e+06; 
+
+    /*reaction 2: H2O2 (+M) <=> OH + OH (+M) */
+    eqcon[1] *= 1e-06; 
+
+    /*reaction 3: H2 + M <=> H + H + M */
+    eqcon[2] *= 1e-06; 
+
+    /*reaction 4: O + O + M <=> O2 + M */
+    eqcon[3] *= 1e+06; 
+
+    /*reaction 5: O + H + M <=> OH + M */
+    eqcon[4] *= 1e+06; 
+
+    /*reaction 6: H + OH + M <=> H2O + M */
+    eqcon[5] *= 1e+06; 
+
+    /*reaction 7: H + O2 <=> O + OH */
+    /*eqcon[6] *= 1;  */
+
+    /*reaction 8: O + H2 <=> H + OH */
+    /*eqcon[7] *= 1;  */
+
+    /*reaction 9: H2 + OH <=> H2O + H */
+    /*eqcon[8] *= 1;  */
+
+    /*reaction 10: O + H2O <=> OH + OH */
+    /*eqcon[9] *= 1;  */
+
+    /*reaction 11: HO2 + H <=> H2 + O2 */
+    /*eqcon[10] *= 1;  */
+
+    /*reaction 12: HO2 + H <=> OH + OH */
+    /*eqcon[11] *= 1;  */
+
+    /*reaction 13: HO2 + O <=> O2 + OH */
+    /*eqcon[12] *= 1;  */
+
+    /*reaction 14: HO2 + OH <=> H2O + O2 */
+    /*eqcon[13] *= 1;  */
+
+    /*reaction 15: HO2 + HO2 <=> H2O2 + O2 */
+    /*eqcon[14] *= 1;  */
+
+    /*reaction 16: HO2 + HO2 <=> H2O2 + O2 */
+    /*eqcon[15] *= 1;  */
+
+    /*reaction 17: H2O2 + H <=> H2O + OH */
+    /*eqcon[16] *= 1;  */
+
+    /*reaction 18: H2O2 + H <=> HO2 + H2 */
+    /*eqcon[17] *= 1;  */
+
+    /*reaction 19: H2O2 + O <=> OH + HO2 */
+    /*eqcon[18] *= 1;  */
+
+    /*reaction 20: H2O2 + OH <=> HO2 + H2O */
+    /*eqcon[19] *= 1;  */
+
+    /*reaction 21: H2O2 + OH <=> HO2 + H2O */
+    /*eqcon[20] *= 1;  */
+}
+
+#include <ChemKernel.H>
+
+/*reaction tables of the ChemKernel rate and Jacobian engine */
+static const int kind[21] = {
+    CKT_TROE, CKT_TROE, CKT_THIRDBODY, CKT_THIRDBODY, CKT_THIRDBODY, CKT_THIRDBODY, CKT_SIMPLE, CKT_SIMPLE, CKT_SIMPLE, CKT_SIMPLE, CKT_SIMPLE, CKT_SIMPLE, CKT_SIMPLE, CKT_SIMPLE, CKT_SIMPLE, CKT_SIMPLE, CKT_SIMPLE, CKT_SIMPLE, CKT_SIMPLE, CKT_SIMPLE,
+    CKT_SIMPLE
+};
+static const int reversible[21] = {
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1
+};
+static const int tb_species[21] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1
+};
+static const int rea_ptr[22] = {
+    0, 2, 3, 4, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 26, 27, 29, 31, 33,
+    35, 37
+};
+static const int rea_spec[37] = {
+    1, 3, 7, 0, 4, 3, 4, 3, 5, 1, 3, 0, 4, 0, 5, 2, 4, 3, 6, 3,
+    6, 4, 6, 5, 6, 6, 6, 3, 7, 3, 7, 4, 7, 5, 7, 5, 7
+};
+static const int rea_nu[37] = {
+    1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+static const int pro_ptr[22] = {
+    0, 1, 2, 3, 4, 5, 6, 8, 10, 12, 13, 15, 16, 18, 20, 22, 24, 26, 28, 30,
+    32, 34
+};
+static const int pro_spec[34] = {
+    6, 5, 3, 1, 5, 2, 4, 5, 3, 5, 2, 3, 5, 0, 1, 5, 1, 5, 1, 2,
+    1, 7, 1, 7, 2, 5, 0, 6, 5, 6, 2, 6, 2, 6
+};
+static const int pro_nu[34] = {
+    1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const ckt_mech mech = {
+    9, 21,
+    kind, reversible, tb_species,
+    rea_ptr, rea_spec, rea_nu,
+    pro_ptr, pro_spec, pro_nu,
+    101325 / 8.31451,
+    fwd_A, fwd_beta, fwd_Ea,
+    low_A, low_beta, low_Ea,
+    troe_a, troe_Ts, troe_Tss, troe_Tsss,
+    sri_a, sri_b, sri_c, sri_d, sri_e,
+    activation_units, prefactor_units, phase_units,
+    troe_len, sri_len, nTB, TBid,
+    TB
+};
+
+/*compute the production rate for each species */
+void productionRate(double * restrict wdot, double * restrict sc, double T)
+{
+    ckt_production_rate(&mech, wdot, sc, T);
+}
+
+/*compute the production rate for each species */
+void vproductionRate(int npt, double * restrict wdot, double * restrict sc, double * restrict T)
+{
+    ckt_vproduction_rate(&mech, npt, wdot, sc, T);
+}
+
+/*compute the progress rate for each reaction */
+void progressRate(double * restrict qdot, double * restrict sc, double T)
+{
+    double q_f[21], q_r[21];
+    ckt_progress_rate_fr(&mech, q_f, q_r, sc, T);
+    for (int i = 0; i < 21; ++i) {
+        qdot[i] = q_f[i] - q_r[i];
+    }
+}
+
+/*compute the progress rate for each reaction */
+void progressRateFR(double * restrict q_f, double * restrict q_r, double * restrict sc, double T)
+{
+    ckt_progress_rate_fr(&mech, q_f, q_r, sc, T);
+}
+
+/*compute the reaction Jacobian */
+void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
+{
+    ckt_jacobian(&mech, J, sc, T, consP);
+}
+
+/*compute the reaction Jacobian */
+void DWDOT(double * restrict J, double * restrict sc, double * restrict Tp, int * consP)
+{
+    double c[9];
+
+    for (int k=0; k<9; k++) {
+        c[k] = 1.e6 * sc[k];
+    }
+
+    aJacobian(J, c, *Tp, *consP);
+
+    /* dwdot[k]/dT */
+    for (int k=0; k<9; k++) {
+        J[90+k] *= 1.e-6;
+    }
+
+    /* dTdot/d[X] */
+    for (int k=0; k<9; k++) {
+        J[k*10+9] *= 1.e6;
+    }
+
+    return;
+}
+
+
+/*compute d(Cp/R)/dT and d(Cv/R)/dT at the given temperature */
+/*tc contains precomputed powers of T, tc[0] = log(T) */
+void dcvpRdT(double * restrict species, double * restrict tc)
+{
+
+    /*temperature */
+    double T = tc[1];
+
+    /*species with midpoint at T=1000 kelvin */
+    if (T < 1000) {
+        /*species 0: H2 */
+        species[0] =
+            +8.24944174e-04
+            -1.62860306e-06 * tc[1]
+            -2.84263030e-10 * tc[2]
+            +1.65394890e-12 * tc[3];
+        /*species 1: O2 */
+        species[1] =
+            +1.12748635e-03
+            -1.15123009e-06 * tc[1]
+            +3.94163169e-09 * tc[2]
+            -3.50742157e-12 * tc[3];
+        /*species 2: H2O */
+        species[2] =
+            +3.47498246e-03
+            -1.27093927e-05 * tc[1]
+            +2.09057438e-08 * tc[2]
+            -1.00263539e-11 * tc[3];
+        /*species 3: H */
+        species[3] =
+            +0.00000000e+00
+            +0.00000000e+00 * tc[1]
+            +0.00000000e+00 * tc[2]
+            +0.00000000e+00 * tc[3];
+        /*species 4: O */
+        species[4] =
+            -1.63816649e-03
+            +4.84206340e-06 * tc[1]
+            -4.80852957e-09 * tc[2]
+            +1.55627854e-12 * tc[3];
+        /*species 5: OH */
+        species[5] =
+            -3.22544939e-03
+            +1.30552938e-05 * tc[1]
+            -1.73956093e-08 * tc[2]
+            +8.24949516e-12 * tc[3];
+        /*species 6: HO2 */
+        species[6] =
+            -4.74912051e-03
+            +4.23165782e-05 * tc[1]
+            -7.28291682e-08 * tc[2]
+            +3.71690050e-11 * tc[3];
+        /*species 7: H2O2 */
+        species[7] =
+            +6.56922581e-03
+            -2.97002516e-07 * tc[1]
+            -1.38774166e-08 * tc[2]
+            +9.88605900e-12 * tc[3];
+        /*species 8: N2 */
+        species[8] =
+            +1.40824000e-03
+            -7.92644400e-06 * tc[1]
+            +1.69245450e-08 * tc[2]
+            -9.77942000e-12 * tc[3];
+    } else {
+        /*species 0: H2 */
+        species[0] =
+            +7.00064411e-04
+            -1.12676574e-07 * tc[1]
+            -2.76947345e-11 * tc[2]
+            +6.33100716e-15 * tc[3];
+        /*species 1: O2 */
+        species[1] =
+            +6.13519689e-04
+            -2.51768398e-07 * tc[1]
+            +5.32584444e-11 * tc[2]
+            -4.54574124e-15 * tc[3];
+        /*species 2: H2O */
+        species[2] =
+            +3.05629289e-03
+            -1.74605202e-06 * tc[1]
+            +3.60298917e-10 * tc[2]
+            -2.55664715e-14 * tc[3];
+        /*species 3: H */
+        species[3] =
+            +0.00000000e+00
+            +0.00000000e+00 * tc[1]
+            +0.00000000e+00 * tc[2]
+            +0.00000000e+00 * tc[3];
+        /*species 4: O */
+        species[4] =
+            -2.75506191e-05
+            -6.20560670e-09 * tc[1]
+            +1.36532023e-11 * tc[2]
+            -1.74722060e-15 * tc[3];
+        /*species 5: OH */
+        species[5] =
+            +1.05650448e-03
+            -5.18165516e-07 * tc[1]
+            +9.15656022e-11 * tc[2]
+            -5.32783504e-15 * tc[3];
+        /*species 6: HO2 */
+        species[6] =
+            +2.23982013e-03
+            -1.26731630e-06 * tc[1]
+            +3.42739110e-10 * tc[2]
+            -4.31634140e-14 * tc[3];
+        /*species 7: H2O2 */
+        species[7] =
+            +4.33613639e-03
+            -2.94937764e-06 * tc[1]
+            +7.04671071e-10 * tc[2]
+            -5.72661424e-14 * tc[3];
+        /*species 8: N2 */
+        species[8] =
+            +1.48797700e-03
+            -1.13695220e-06 * tc[1]
+            +3.02911200e-10 * tc[2]
+            -2.70134040e-14 * tc[3];
+    }
+    return;
+}
+
+
+/*compute the equilibrium constants for each reaction */
+void equilibriumConstants(double * restrict kc, double * restrict g_RT, double T)
+{
+    /*reference concentration: P_atm / (RT) in inverse mol/m^3 */
+    double refC = 101325 / 8.31451 / T;
+
+    /*reaction 1: H + O2 (+M) <=> HO2 (+M) */
+    kc[0] = 1.0 / (refC) * exp((g_RT[3] + g_RT[1]) - (g_RT[6]));
+
+    /*reaction 2: H2O2 (+M) <=> OH + OH (+M) */
+    kc[1] = refC * exp((g_RT[7]) - (g_RT[5] + g_RT[5]));
+
+    /*reaction 3: H2 + M <=> H + H + M */
+    kc[2] = refC * exp((g_RT[0]) - (g_RT[3] + g_RT[3]));
+
+    /*reaction 4: O + O + M <=> O2 + M */
+    kc[3] = 1.0 / (refC) * exp((g_RT[4] + g_RT[4]) - (g_RT[1]));
+
+    /*reaction 5: O + H + M <=> OH + M */
+    kc[4] = 1.0 / (refC) * exp((g_RT[4] + g_RT[3]) - (g_RT[5]));
+
+    /*reaction 6: H + OH + M <=> H2O + M */
+    kc[5] = 1.0 / (refC) * exp((g_RT[3] + g_RT[5]) - (g_RT[2]));
+
+    /*reaction 7: H + O2 <=> O + OH */
+    kc[6] = exp((g_RT[3] + g_RT[1]) - (g_RT[4] + g_RT[5]));
+
+    /*reaction 8: O + H2 <=> H + OH */
+    kc[7] = exp((g_RT[4] + g_RT[0]) - (g_RT[3] + g_RT[5]));
+
+    /*reaction 9: H2 + OH <=> H2O + H */
+    kc[8] = exp((g_RT[0] + g_RT[5]) - (g_RT[2] + g_RT[3]));
+
+    /*reaction 10: O + H2O <=> OH + OH */
+    kc[9] = exp((g_RT[4] + g_RT[2]) - (g_RT[5] + g_RT[5]));
+
+    /*reaction 11: HO2 + H <=> H2 + O2 */
+    kc[10] = exp((g_RT[6] + g_RT[3]) - (g_RT[0] + g_RT[1]));
+
+    /*reaction 12: HO2 + H <=> OH + OH */
+    kc[11] = exp((g_RT[6] + g_RT[3]) - (g_RT[5] + g_RT[5]));
+
+    /*reaction 13: HO2 + O <=> O2 + OH */
+    kc[12] = exp((g_RT[6] + g_RT[4]) - (g_RT[1] + g_RT[5]));
+
+    /*reaction 14: HO2 + OH <=> H2O + O2 */
+    kc[13] = exp((g_RT[6] + g_RT[5]) - (g_RT[2] + g_RT[1]));
+
+    /*reaction 15: HO2 + HO2 <=> H2O2 + O2 */
+    kc[14] = exp((g_RT[6] + g_RT[6]) - (g_RT[7] + g_RT[1]));
+
+    /*reaction 16: HO2 + HO2 <=> H2O2 + O2 */
+    kc[15] = exp((g_RT[6] + g_RT[6]) - (g_RT[7] + g_RT[1]));
+
+    /*reaction 17: H2O2 + H <=> H2O + OH */
+    kc[16] = exp((g_RT[7] + g_RT[3]) - (g_RT[2] + g_RT[5]));
+
+    /*reaction 18: H2O2 + H <=> HO2 + H2 */
+    kc[17] = exp((g_RT[7] + g_RT[3]) - (g_RT[6] + g_RT[0]));
+
+    /*reaction 19: H2O2 + O <=> OH + HO2 */
+    kc[18] = exp((g_RT[7] + g_RT[4]) - (g_RT[5] + g_RT[6]));
+
+    /*reaction 20: H2O2 + OH <=> HO2 + H2O */
+    kc[19] = exp((g_RT[7] + g_RT[5]) - (g_RT[6] + g_RT[2]));
+
+    /*reaction 21: H2O2 + OH <=> HO2 + H2O */
+    kc[20] = exp((g_RT[7] + g_RT[5]) - (g_RT[6] + g_RT[2]));
+
+    return;
+}
+
+
+/*compute the g/(RT) at the given temperature */
+/*tc contains precomputed powers of T, tc[0] = log(T) */
+void gibbs(double * restrict species, double * restrict tc)
+{
+
+    /*temperature */
+    double T = tc[1];
+    double invT = 1 / T;
+
+    /*species with midpoint at T=1000 kelvin */
+    if (T < 1000) {
+        /*species 0: H2 */
+        species[0] =
+            -1.012520870000000e+03 * invT
+            +6.592218400000000e+00
+            -3.298124310000000e+00 * tc[0]
+            -4.124720870000000e-04 * tc[1]
+            +1.357169215000000e-07 * tc[2]
+            +7.896195275000000e-12 * tc[3]
+            -2.067436120000000e-14 * tc[4];
+        /*species 1: O2 */
+        species[1] =
+            -1.005249020000000e+03 * invT
+            -2.821801190000000e+00
+            -3.212936400000000e+00 * tc[0]
+            -5.637431750000000e-04 * tc[1]
+            +9.593584116666666e-08 * tc[2]
+            -1.094897691666667e-10 * tc[3]
+            +4.384276960000000e-14 * tc[4];
+        /*species 2: H2O */
+        species[2] =
+            -3.020811330000000e+04 * invT
+            +7.966096399999998e-01
+            -3.386842490000000e+00 * tc[0]
+            -1.737491230000000e-03 * tc[1]
+            +1.059116055000000e-06 * tc[2]
+            -5.807151058333333e-10 * tc[3]
+            +1.253294235000000e-13 * tc[4];
+        /*species 3: H */
+        species[3] =
+            +2.547162700000000e+04 * invT
+            +2.960117608000000e+00
+            -2.500000000000000e+00 * tc[0]
+            -0.000000000000000e+00 * tc[1]
+            -0.000000000000000e+00 * tc[2]
+            -0.000000000000000e+00 * tc[3]
+            -0.000000000000000e+00 * tc[4];
+        /*species 4: O */
+        species[4] =
+            +2.914764450000000e+04 * invT
+            -1.756619999999964e-02
+            -2.946428780000000e+00 * tc[0]
+            +8.190832450000000e-04 * tc[1]
+            -4.035052833333333e-07 * tc[2]
+            +1.335702658333333e-10 * tc[3]
+            -1.945348180000000e-14 * tc[4];
+        /*species 5: OH */
+        species[5] =
+            +3.346309130000000e+03 * invT
+            +4.815738570000000e+00
+            -4.125305610000000e+00 * tc[0]
+            +1.612724695000000e-03 * tc[1]
+            -1.087941151666667e-06 * tc[2]
+            +4.832113691666666e-10 * tc[3]
+            -1.031186895000000e-13 * tc[4];
+        /*species 6: HO2 */
+        species[6] =
+            +2.948080400000000e+02 * invT
+            +5.851355599999999e-01
+            -4.301798010000000e+00 * tc[0]
+            +2.374560255000000e-03 * tc[1]
+            -3.526381516666666e-06 * tc[2]
+            +2.023032450000000e-09 * tc[3]
+            -4.646125620000001e-13 * tc[4];
+        /*species 7: H2O2 */
+        species[7] =
+            -1.766314650000000e+04 * invT
+            -3.396609550000000e+00
+            -3.388753650000000e+00 * tc[0]
+            -3.284612905000000e-03 * tc[1]
+            +2.475020966666667e-08 * tc[2]
+            +3.854837933333333e-10 * tc[3]
+            -1.235757375000000e-13 * tc[4];
+        /*species 8: N2 */
+        species[8] =
+            -1.020900000000000e+03 * invT
+            -6.516950000000001e-01
+            -3.298677000000000e+00 * tc[0]
+            -7.041200000000000e-04 * tc[1]
+            +6.605369999999999e-07 * tc[2]
+            -4.701262500000001e-10 * tc[3]
+            +1.222427500000000e-13 * tc[4];
+    } else {
+        /*species 0: H2 */
+        species[0] =
+            -8.350339970000000e+02 * invT
+            +4.346533540000000e+00
+            -2.991423370000000e+00 * tc[0]
+            -3.500322055000000e-04 * tc[1]
+            +9.389714483333333e-09 * tc[2]
+            +7.692981816666667e-13 * tc[3]
+            -7.913758950000000e-17 * tc[4];
+        /*species 1: O2 */
+        species[1] =
+            -1.233930180000000e+03 * invT
+            +5.084126000000002e-01
+            -3.697578190000000e+00 * tc[0]
+            -3.067598445000000e-04 * tc[1]
+            +2.098069983333333e-08 * tc[2]
+            -1.479401233333333e-12 * tc[3]
+            +5.682176550000000e-17 * tc[4];
+        /*species 2: H2O */
+        species[2] =
+            -2.989920900000000e+04 * invT
+            -4.190671200000001e+00
+            -2.672145610000000e+00 * tc[0]
+            -1.528146445000000e-03 * tc[1]
+            +1.455043351666667e-07 * tc[2]
+            -1.000830325000000e-11 * tc[3]
+            +3.195808935000000e-16 * tc[4];
+        /*species 3: H */
+        species[3] =
+            +2.547162700000000e+04 * invT
+            +2.960117638000000e+00
+            -2.500000000000000e+00 * tc[0]
+            -0.000000000000000e+00 * tc[1]
+            -0.000000000000000e+00 * tc[2]
+            -0.000000000000000e+00 * tc[3]
+            -0.000000000000000e+00 * tc[4];
+        /*species 4: O */
+        species[4] =
+            +2.923080270000000e+04 * invT
+            -2.378248450000000e+00
+            -2.542059660000000e+00 * tc[0]
+            +1.377530955000000e-05 * tc[1]
+            +5.171338916666667e-10 * tc[2]
+            -3.792556183333333e-13 * tc[3]
+            +2.184025750000000e-17 * tc[4];
+        /*species 5: OH */
+        species[5] =
+            +3.683628750000000e+03 * invT
+            -2.836911870000000e+00
+            -2.864728860000000e+00 * tc[0]
+            -5.282522400000000e-04 * tc[1]
+            +4.318045966666667e-08 * tc[2]
+            -2.543488950000000e-12 * tc[3]
+            +6.659793800000000e-17 * tc[4];
+        /*species 6: HO2 */
+        species[6] =
+            +1.118567130000000e+02 * invT
+            +2.321087500000001e-01
+            -4.017210900000000e+00 * tc[0]
+            -1.119910065000000e-03 * tc[1]
+            +1.056096916666667e-07 * tc[2]
+            -9.520530833333334e-12 * tc[3]
+            +5.395426750000000e-16 * tc[4];
+        /*species 7: H2O2 */
+        species[7] =
+            -1.800696090000000e+04 * invT
+            +4.072029891000000e+00
+            -4.573166850000000e+00 * tc[0]
+            -2.168068195000000e-03 * tc[1]
+            +2.457814700000000e-07 * tc[2]
+            -1.957419641666667e-11 * tc[3]
+            +7.158267800000000e-16 * tc[4];
+        /*species 8: N2 */
+        species[8] =
+            -9.227977000000000e+02 * invT
+            -3.053888000000000e+00
+            -2.926640000000000e+00 * tc[0]
+            -7.439885000000000e-04 * tc[1]
+            +9.474601666666666e-08 * tc[2]
+            -8.414199999999999e-12 * tc[3]
+            +3.376675500000000e-16 * tc[4];
+    }
+    return;
+}
+
+
+/*compute the a/(RT) at the given temperature */
+/*tc contains precomputed powers of T, tc[0] = log(T) */
+void helmholtz(double * restrict species, double * restrict tc)
+{
+
+    /*temperature */
+    double T = tc[1];
+    double invT = 1 / T;
+
+    /*species with midpoint at T=1000 kelvin */
+    if (T < 1000) {
+        /*species 0: H2 */
+        species[0] =
+            -1.01252087e+03 * invT
+            +5.59221840e+00
+            -3.29812431e+00 * tc[0]
+            -4.12472087e-04 * tc[1]
+            +1.35716922e-07 * tc[2]
+            +7.89619527e-12 * tc[3]
+            -2.06743612e-14 * tc[4];
+        /*species 1: O2 */
+        species[1] =
+            -1.00524902e+03 * invT
+            -3.82180119e+00
+            -3.21293640e+00 * tc[0]
+            -5.63743175e-04 * tc[1]
+            +9.59358412e-08 * tc[2]
+            -1.09489769e-10 * tc[3]
+            +4.38427696e-14 * tc[4];
+        /*species 2: H2O */
+        species[2] =
+            -3.02081133e+04 * invT
+            -2.03390360e-01
+            -3.38684249e+00 * tc[0]
+            -1.73749123e-03 * tc[1]
+            +1.05911606e-06 * tc[2]
+            -5.80715106e-10 * tc[3]
+            +1.25329424e-13 * tc[4];
+        /*species 3: H */
+        species[3] =
+            +2.54716270e+04 * invT
+            +1.96011761e+00
+            -2.50000000e+00 * tc[0]
+            -0.00000000e+00 * tc[1]
+            -0.00000000e+00 * tc[2]
+            -0.00000000e+00 * tc[3]
+            -0.00000000e+00 * tc[4];
+        /*species 4: O */
+        species[4] =
+            +2.91476445e+04 * invT
+            -1.01756620e+00
+            -2.94642878e+00 * tc[0]
+            +8.19083245e-04 * tc[1]
+            -4.03505283e-07 * tc[2]
+            +1.33570266e-10 * tc[3]
+            -1.94534818e-14 * tc[4];
+        /*species 5: OH */
+        species[5] =
+            +3.34630913e+03 * invT
+            +3.81573857e+00
+            -4.12530561e+00 * tc[0]
+            +1.61272470e-03 * tc[1]
+            -1.08794115e-06 * tc[2]
+            +4.83211369e-10 * tc[3]
+            -1.03118689e-13 * tc[4];
+        /*species 6: HO2 */
+        species[6] =
+            +2.94808040e+02 * invT
+            -4.14864440e-01
+            -4.30179801e+00 * tc[0]
+            +2.37456025e-03 * tc[1]
+            -3.52638152e-06 * tc[2]
+            +2.02303245e-09 * tc[3]
+            -4.64612562e-13 * tc[4];
+        /*species 7: H2O2 */
+        species[7] =
+            -1.76631465e+04 * invT
+            -4.39660955e+00
+            -3.38875365e+00 * tc[0]
+            -3.28461290e-03 * tc[1]
+            +2.47502097e-08 * tc[2]
+            +3.85483793e-10 * tc[3]
+            -1.23575738e-13 * tc[4];
+        /*species 8: N2 */
+        species[8] =
+            -1.02090000e+03 * invT
+            -1.65169500e+00
+            -3.29867700e+00 * tc[0]
+            -7.04120000e-04 * tc[1]
+            +6.60537000e-07 * tc[2]
+            -4.70126250e-10 * tc[3]
+            +1.22242750e-13 * tc[4];
+    } else {
+        /*species 0: H2 */
+        species[0] =
+            -8.35033997e+02 * invT
+            +3.34653354e+00
+            -2.99142337e+00 * tc[0]
+            -3.50032206e-04 * tc[1]
+            +9.38971448e-09 * tc[2]
+            +7.69298182e-13 * tc[3]
+            -7.91375895e-17 * tc[4];
+        /*species 1: O2 */
+        species[1] =
+            -1.23393018e+03 * invT
+            -4.91587400e-01
+            -3.69757819e+00 * tc[0]
+            -3.06759845e-04 * tc[1]
+            +2.09806998e-08 * tc[2]
+            -1.47940123e-12 * tc[3]
+            +5.68217655e-17 * tc[4];
+        /*species 2: H2O */
+        species[2] =
+            -2.98992090e+04 * invT
+            -5.19067120e+00
+            -2.67214561e+00 * tc[0]
+            -1.52814644e-03 * tc[1]
+            +1.45504335e-07 * tc[2]
+            -1.00083033e-11 * tc[3]
+            +3.19580894e-16 * tc[4];
+        /*species 3: H */
+        species[3] =
+            +2.54716270e+04 * invT
+            +1.96011764e+00
+            -2.50000000e+00 * tc[0]
+            -0.00000000e+00 * tc[1]
+            -0.00000000e+00 * tc[2]
+            -0.00000000e+00 * tc[3]
+            -0.00000000e+00 * tc[4];
+        /*species 4: O */
+        species[4] =
+            +2.92308027e+04 * invT
+            -3.37824845e+00
+            -2.54205966e+00 * tc[0]
+            +1.37753096e-05 * tc[1]
+            +5.17133892e-10 * tc[2]
+            -3.79255618e-13 * tc[3]
+            +2.18402575e-17 * tc[4];
+        /*species 5: OH */
+        species[5] =
+            +3.68362875e+03 * invT
+            -3.83691187e+00
+            -2.86472886e+00 * tc[0]
+            -5.28252240e-04 * tc[1]
+            +4.31804597e-08 * tc[2]
+            -2.54348895e-12 * tc[3]
+            +6.65979380e-17 * tc[4];
+        /*species 6: HO2 */
+        species[6] =
+            +1.11856713e+02 * invT
+            -7.67891250e-01
+            -4.01721090e+00 * tc[0]
+            -1.11991006e-03 * tc[1]
+            +1.05609692e-07 * tc[2]
+            -9.52053083e-12 * tc[3]
+            +5.39542675e-16 * tc[4];
+        /*species 7: H2O2 */
+        species[7] =
+            -1.80069609e+04 * invT
+            +3.07202989e+00
+            -4.57316685e+00 * tc[0]
+            -2.16806820e-03 * tc[1]
+            +2.45781470e-07 * tc[2]
+            -1.95741964e-11 * tc[3]
+            +7.15826780e-16 * tc[4];
+        /*species 8: N2 */
+        species[8] =
+            -9.22797700e+02 * invT
+            -4.05388800e+00
+            -2.92664000e+00 * tc[0]
+            -7.43988500e-04 * tc[1]
+            +9.47460167e-08 * tc[2]
+            -8.41420000e-12 * tc[3]
+            +3.37667550e-16 * tc[4];
+    }
+    return;
+}
+
+
+/*compute Cv/R at the given temperature */
+/*tc contains precomputed powers of T, tc[0] = log(T) */
+void cv_R(double * restrict species, double * restrict tc)
+{
+
+    /*temperature */
+    double T = tc[1];
+
+    /*species with midpoint at T=1000 kelvin */
+    if (T < 1000) {
+        /*species 0: H2 */
+        species[0] =
+            +2.29812431e+00
+            +8.24944174e-04 * tc[1]
+            -8.14301529e-07 * tc[2]
+            -9.47543433e-11 * tc[3]
+            +4.13487224e-13 * tc[4];
+        /*species 1: O2 */
+        species[1] =
+            +2.21293640e+00
+            +1.12748635e-03 * tc[1]
+            -5.75615047e-07 * tc[2]
+            +1.31387723e-09 * tc[3]
+            -8.76855392e-13 * tc[4];
+        /*species 2: H2O */
+        species[2] =
+            +2.38684249e+00
+            +3.47498246e-03 * tc[1]
+            -6.35469633e-06 * tc[2]
+            +6.96858127e-09 * tc[3]
+            -2.50658847e-12 * tc[4];
+        /*species 3: H */
+        species[3] =
+            +1.50000000e+00
+            +0.00000000e+00 * tc[1]
+            +0.00000000e+00 * tc[2]
+            +0.00000000e+00 * tc[3]
+            +0.00000000e+00 * tc[4];
+        /*species 4: O */
+        species[4] =
+            +1.94642878e+00
+            -1.63816649e-03 * tc[1]
+            +2.42103170e-06 * tc[2]
+            -1.60284319e-09 * tc[3]
+            +3.89069636e-13 * tc[4];
+        /*species 5: OH */
+        species[5] =
+            +3.12530561e+00
+            -3.22544939e-03 * tc[1]
+            +6.52764691e-06 * tc[2]
+            -5.79853643e-09 * tc[3]
+            +2.06237379e-12 * tc[4];
+        /*species 6: HO2 */
+        species[6] =
+            +3.30179801e+00
+            -4.74912051e-03 * tc[1]
+            +2.11582891e-05 * tc[2]
+            -2.42763894e-08 * tc[3]
+            +9.29225124e-12 * tc[4];
+        /*species 7: H2O2 */
+        species[7] =
+            +2.38875365e+00
+            +6.56922581e-03 * tc[1]
+            -1.48501258e-07 * tc[2]
+            -4.62580552e-09 * tc[3]
+            +2.47151475e-12 * tc[4];
+        /*species 8: N2 */
+        species[8] =
+            +2.29867700e+00
+            +1.40824000e-03 * tc[1]
+            -3.96322200e-06 * tc[2]
+            +5.64151500e-09 * tc[3]
+            -2.44485500e-12 * tc[4];
+    } else {
+        /*species 0: H2 */
+        species[0] =
+            +1.99142337e+00
+            +7.00064411e-04 * tc[1]
+            -5.63382869e-08 * tc[2]
+            -9.23157818e-12 * tc[3]
+            +1.58275179e-15 * tc[4];
+        /*species 1: O2 */
+        species[1] =
+            +2.69757819e+00
+            +6.13519689e-04 * tc[1]
+            -1.25884199e-07 * tc[2]
+            +1.77528148e-11 * tc[3]
+            -1.13643531e-15 * tc[4];
+        /*species 2: H2O */
+        species[2] =
+            +1.67214561e+00
+            +3.05629289e-03 * tc[1]
+            -8.73026011e-07 * tc[2]
+            +1.20099639e-10 * tc[3]
+            -6.39161787e-15 * tc[4];
+        /*species 3: H */
+        species[3] =
+            +1.50000000e+00
+            +0.00000000e+00 * tc[1]
+            +0.00000000e+00 * tc[2]
+            +0.00000000e+00 * tc[3]
+            +0.00000000e+00 * tc[4];
+        /*species 4: O */
+        species[4] =
+            +1.54205966e+00
+            -2.75506191e-05 * tc[1]
+            -3.10280335e-09 * tc[2]
+            +4.55106742e-12 * tc[3]
+            -4.36805150e-16 * tc[4];
+        /*species 5: OH */
+        species[5] =
+            +1.86472886e+00
+            +1.05650448e-03 * tc[1]
+            -2.59082758e-07 * tc[2]
+            +3.05218674e-11 * tc[3]
+            -1.33195876e-15 * tc[4];
+        /*species 6: HO2 */
+        species[6] =
+            +3.01721090e+00
+            +2.23982013e-03 * tc[1]
+            -6.33658150e-07 * tc[2]
+            +1.14246370e-10 * tc[3]
+            -1.07908535e-14 * tc[4];
+        /*species 7: H2O2 */
+        species[7] =
+            +3.57316685e+00
+            +4.33613639e-03 * tc[1]
+            -1.47468882e-06 * tc[2]
+            +2.34890357e-10 * tc[3]
+            -1.43165356e-14 * tc[4];
+        /*species 8: N2 */
+        species[8] =
+            +1.92664000e+00
+            +1.48797700e-03 * tc[1]
+            -5.68476100e-07 * tc[2]
+            +1.00970400e-10 * tc[3]
+            -6.75335100e-15 * tc[4];
+    }
+    return;
+}
+
+
+/*compute Cp/R at the given temperature */
+/*tc contains precomputed powers of T, tc[0] = log(T) */
+void cp_R(double * restrict species, double * restrict tc)
+{
+
+    /*temperature */
+    double T = tc[1];
+
+    /*species with midpoint at T=1000 kelvin */
+    if (T < 1000) {
+        /*species 0: H2 */
+        species[0] =
+            +3.29812431e+00
+            +8.24944174e-04 * tc[1]
+            -8.14301529e-07 * tc[2]
+            -9.47543433e-11 * tc[3]
+            +4.13487224e-13 * tc[4];
+        /*species 1: O2 */
+        species[1] =
+            +3.21293640e+00
+            +1.12748635e-03 * tc[1]
+            -5.75615047e-07 * tc[2]
+            +1.31387723e-09 * tc[3]
+            -8.76855392e-13 * tc[4];
+        /*species 2: H2O */
+        species[2] =
+            +3.38684249e+00
+            +3.47498246e-03 * tc[1]
+            -6.35469633e-06 * tc[2]
+            +6.96858127e-09 * tc[3]
+            -2.50658847e-12 * tc[4];
+        /*species 3: H */
+        species[3] =
+            +2.50000000e+00
+            +0.00000000e+00 * tc[1]
+            +0.00000000e+00 * tc[2]
+            +0.00000000e+00 * tc[3]
+            +0.00000000e+00 * tc[4];
+        /*species 4: O */
+        species[4] =
+            +2.94642878e+00
+            -1.63816649e-03 * tc[1]
+            +2.42103170e-06 * tc[2]
+            -1.60284319e-09 * tc[3]
+            +3.89069636e-13 * tc[4];
+        /*species 5: OH */
+        species[5] =
+            +4.12530561e+00
+            -3.22544939e-03 * tc[1]
+            +6.52764691e-06 * tc[2]
+            -5.79853643e-09 * tc[3]
+            +2.06237379e-12 * tc[4];
+        /*species 6: HO2 */
+        species[6] =
+            +4.30179801e+00
+            -4.74912051e-03 * tc[1]
+            +2.11582891e-05 * tc[2]
+            -2.42763894e-08 * tc[3]
+            +9.29225124e-12 * tc[4];
+        /*species 7: H2O2 */
+        species[7] =
+            +3.38875365e+00
+            +6.56922581e-03 * tc[1]
+            -1.48501258e-07 * tc[2]
+            -4.62580552e-09 * tc[3]
+            +2.47151475e-12 * tc[4];
+        /*species 8: N2 */
+        species[8] =
+            +3.29867700e+00
+            +1.40824000e-03 * tc[1]
+            -3.96322200e-06 * tc[2]
+            +5.64151500e-09 * tc[3]
+            -2.44485500e-12 * tc[4];
+    } else {
+        /*species 0: H2 */
+        species[0] =
+            +2.99142337e+00
+            +7.00064411e-04 * tc[1]
+            -5.63382869e-08 * tc[2]
+            -9.23157818e-12 * tc[3]
+            +1.58275179e-15 * tc[4];
+        /*species 1: O2 */
+        species[1] =
+            +3.69757819e+00
+            +6.13519689e-04 * tc[1]
+            -1.25884199e-07 * tc[2]
+            +1.77528148e-11 * tc[3]
+            -1.13643531e-15 * tc[4];
+        /*species 2: H2O */
+        species[2] =
+            +2.67214561e+00
+            +3.05629289e-03 * tc[1]
+            -8.73026011e-07 * tc[2]
+            +1.20099639e-10 * tc[3]
+            -6.39161787e-15 * tc[4];
+        /*species 3: H */
+        species[3] =
+            +2.50000000e+00
+            +0.00000000e+00 * tc[1]
+            +0.00000000e+00 * tc[2]
+            +0.00000000e+00 * tc[3]
+            +0.00000000e+00 * tc[4];
+        /*species 4: O */
+        species[4] =
+            +2.54205966e+00
+            -2.75506191e-05 * tc[1]
+            -3.10280335e-09 * tc[2]
+            +4.55106742e-12 * tc[3]
+            -4.36805150e-16 * tc[4];
+        /*species 5: OH */
+        species[5] =
+            +2.86472886e+00
+            +1.05650448e-03 * tc[1]
+            -2.59082758e-07 * tc[2]
+            +3.05218674e-11 * tc[3]
+            -1.33195876e-15 * tc[4];
+        /*species 6: HO2 */
+        species[6] =
+            +4.01721090e+00
+            +2.23982013e-03 * tc[1]
+            -6.33658150e-07 * tc[2]
+            +1.14246370e-10 * tc[3]
+            -1.07908535e-14 * tc[4];
+        /*species 7: H2O2 */
+        species[7] =
+            +4.57316685e+00
+            +4.33613639e-03 * tc[1]
+            -1.47468882e-06 * tc[2]
+            +2.34890357e-10 * tc[3]
+            -1.43165356e-14 * tc[4];
+        /*species 8: N2 */
+        species[8] =
+            +2.92664000e+00
+            +1.48797700e-03 * tc[1]
+            -5.68476100e-07 * tc[2]
+            +1.00970400e-10 * tc[3]
+            -6.75335100e-15 * tc[4];
+    }
+    return;
+}
+
+
+/*compute the e/(RT) at the given temperature */
+/*tc contains precomputed powers of T, tc[0] = log(T) */
+void speciesInternalEnergy(double * restrict species, double * restrict tc)
+{
+
+    /*temperature */
+    double T = tc[1];
+    double invT = 1 / T;
+
+    /*species with midpoint at T=1000 kelvin */
+    if (T < 1000) {
+        /*species 0: H2 */
+        species[0] =
+            +2.29812431e+00
+            +4.12472087e-04 * tc[1]
+            -2.71433843e-07 * tc[2]
+            -2.36885858e-11 * tc[3]
+            +8.26974448e-14 * tc[4]
+            -1.01252087e+03 * invT;
+        /*species 1: O2 */
+        species[1] =
+            +2.21293640e+00
+            +5.63743175e-04 * tc[1]
+            -1.91871682e-07 * tc[2]
+            +3.28469308e-10 * tc[3]
+            -1.75371078e-13 * tc[4]
+            -1.00524902e+03 * invT;
+        /*species 2: H2O */
+        species[2] =
+            +2.38684249e+00
+            +1.73749123e-03 * tc[1]
+            -2.11823211e-06 * tc[2]
+            +1.74214532e-09 * tc[3]
+            -5.01317694e-13 * tc[4]
+            -3.02081133e+04 * invT;
+        /*species 3: H */
+        species[3] =
+            +1.50000000e+00
+            +0.00000000e+00 * tc[1]
+            +0.00000000e+00 * tc[2]
+            +0.00000000e+00 * tc[3]
+            +0.00000000e+00 * tc[4]
+            +2.54716270e+04 * invT;
+        /*species 4: O */
+        species[4] =
+            +1.94642878e+00
+            -8.19083245e-04 * tc[1]
+            +8.07010567e-07 * tc[2]
+            -4.00710797e-10 * tc[3]
+            +7.78139272e-14 * tc[4]
+            +2.91476445e+04 * invT;
+        /*species 5: OH */
+        species[5] =
+            +3.12530561e+00
+            -1.61272470e-03 * tc[1]
+            +2.17588230e-06 * tc[2]
+            -1.44963411e-09 * tc[3]
+            +4.12474758e-13 * tc[4]
+            +3.34630913e+03 * invT;
+        /*species 6: HO2 */
+        species[6] =
+            +3.30179801e+00
+            -2.37456025e-03 * tc[1]
+            +7.05276303e-06 * tc[2]
+            -6.06909735e-09 * tc[3]
+            +1.85845025e-12 * tc[4]
+            +2.94808040e+02 * invT;
+        /*species 7: H2O2 */
+        species[7] =
+            +2.38875365e+00
+            +3.28461290e-03 * tc[1]
+            -4.95004193e-08 * tc[2]
+            -1.15645138e-09 * tc[3]
+            +4.94302950e-13 * tc[4]
+            -1.76631465e+04 * invT;
+        /*species 8: N2 */
+        species[8] =
+            +2.29867700e+00
+            +7.04120000e-04 * tc[1]
+            -1.32107400e-06 * tc[2]
+            +1.41037875e-09 * tc[3]
+            -4.88971000e-13 * tc[4]
+            -1.02090000e+03 * invT;
+    } else {
+        /*species 0: H2 */
+        species[0] =
+            +1.99142337e+00
+            +3.50032206e-04 * tc[1]
+            -1.87794290e-08 * tc[2]
+            -2.30789455e-12 * tc[3]
+            +3.16550358e-16 * tc[4]
+            -8.35033997e+02 * invT;
+        /*species 1: O2 */
+        species[1] =
+            +2.69757819e+00
+            +3.06759845e-04 * tc[1]
+            -4.19613997e-08 * tc[2]
+            +4.43820370e-12 * tc[3]
+            -2.27287062e-16 * tc[4]
+            -1.23393018e+03 * invT;
+        /*species 2: H2O */
+        species[2] =
+            +1.67214561e+00
+            +1.52814644e-03 * tc[1]
+            -2.91008670e-07 * tc[2]
+            +3.00249098e-11 * tc[3]
+            -1.27832357e-15 * tc[4]
+            -2.98992090e+04 * invT;
+        /*species 3: H */
+        species[3] =
+            +1.50000000e+00
+            +0.00000000e+00 * tc[1]
+            +0.00000000e+00 * tc[2]
+            +0.00000000e+00 * tc[3]
+            +0.00000000e+00 * tc[4]
+            +2.54716270e+04 * invT;
+        /*species 4: O */
+        species[4] =
+            +1.54205966e+00
+            -1.37753096e-05 * tc[1]
+            -1.03426778e-09 * tc[2]
+            +1.13776685e-12 * tc[3]
+            -8.73610300e-17 * tc[4]
+            +2.92308027e+04 * invT;
+        /*species 5: OH */
+        species[5] =
+            +1.86472886e+00
+            +5.28252240e-04 * tc[1]
+            -8.63609193e-08 * tc[2]
+            +7.63046685e-12 * tc[3]
+            -2.66391752e-16 * tc[4]
+            +3.68362875e+03 * invT;
+        /*species 6: HO2 */
+        species[6] =
+            +3.01721090e+00
+            +1.11991006e-03 * tc[1]
+            -2.11219383e-07 * tc[2]
+            +2.85615925e-11 * tc[3]
+            -2.15817070e-15 * tc[4]
+            +1.11856713e+02 * invT;
+        /*species 7: H2O2 */
+        species[7] =
+            +3.57316685e+00
+            +2.16806820e-03 * tc[1]
+            -4.91562940e-07 * tc[2]
+            +5.87225893e-11 * tc[3]
+            -2.86330712e-15 * tc[4]
+            -1.80069609e+04 * invT;
+        /*species 8: N2 */
+        species[8] =
+            +1.92664000e+00
+            +7.43988500e-04 * tc[1]
+            -1.89492033e-07 * tc[2]
+            +2.52426000e-11 * tc[3]
+            -1.35067020e-15 * tc[4]
+            -9.22797700e+02 * invT;
+    }
+    return;
+}
+
+
+/*compute the h/(RT) at the given temperature (Eq 20) */
+/*tc contains precomputed powers of T, tc[0] = log(T) */
+void speciesEnthalpy(double * restrict species, double * restrict tc)
+{
+
+    /*temperature */
+    double T = tc[1];
+    double invT = 1 / T;
+
+    /*species with midpoint at T=1000 kelvin */
+    if (T < 1000) {
+        /*species 0: H2 */
+        species[0] =
+            +3.29812431e+00
+            +4.12472087e-04 * tc[1]
+            -2.71433843e-07 * tc[2]
+            -2.36885858e-11 * tc[3]
+            +8.26974448e-14 * tc[4]
+            -1.01252087e+03 * invT;
+        /*species 1: O2 */
+        species[1] =
+            +3.21293640e+00
+            +5.63743175e-04 * tc[1]
+            -1.91871682e-07 * tc[2]
+            +3.28469308e-10 * tc[3]
+            -1.75371078e-13 * tc[4]
+            -1.00524902e+03 * invT;
+        /*species 2: H2O */
+        species[2] =
+            +3.38684249e+00
+            +1.73749123e-03 * tc[1]
+            -2.11823211e-06 * tc[2]
+            +1.74214532e-09 * tc[3]
+            -5.01317694e-13 * tc[4]
+            -3.02081133e+04 * invT;
+        /*species 3: H */
+        species[3] =
+            +2.50000000e+00
+            +0.00000000e+00 * tc[1]
+            +0.00000000e+00 * tc[2]
+            +0.00000000e+00 * tc[3]
+            +0.00000000e+00 * tc[4]
+            +2.54716270e+04 * invT;
+        /*species 4: O */
+        species[4] =
+            +2.94642878e+00
+            -8.19083245e-04 * tc[1]
+            +8.07010567e-07 * tc[2]
+            -4.00710797e-10 * tc[3]
+            +7.78139272e-14 * tc[4]
+            +2.91476445e+04 * invT;
+        /*species 5: OH */
+        species[5] =
+            +4.12530561e+00
+            -1.61272470e-03 * tc[1]
+            +2.17588230e-06 * tc[2]
+            -1.44963411e-09 * tc[3]
+            +4.12474758e-13 * tc[4]
+            +3.34630913e+03 * invT;
+        /*species 6: HO2 */
+        species[6] =
+            +4.30179801e+00
+            -2.37456025e-03 * tc[1]
+            +7.05276303e-06 * tc[2]
+            -6.06909735e-09 * tc[3]
+            +1.85845025e-12 * tc[4]
+            +2.94808040e+02 * invT;
+        /*species 7: H2O2 */
+        species[7] =
+            +3.38875365e+00
+            +3.28461290e-03 * tc[1]
+            -4.95004193e-08 * tc[2]
+            -1.15645138e-09 * tc[3]
+            +4.94302950e-13 * tc[4]
+            -1.76631465e+04 * invT;
+        /*species 8: N2 */
+        species[8] =
+            +3.29867700e+00
+            +7.04120000e-04 * tc[1]
+            -1.32107400e-06 * tc[2]
+            +1.41037875e-09 * tc[3]
+            -4.88971000e-13 * tc[4]
+            -1.02090000e+03 * invT;
+    } else {
+        /*species 0: H2 */
+        species[0] =
+            +2.99142337e+00
+            +3.50032206e-04 * tc[1]
+            -1.87794290e-08 * tc[2]
+            -2.30789455e-12 * tc[3]
+            +3.16550358e-16 * tc[4]
+            -8.35033997e+02 * invT;
+        /*species 1: O2 */
+        species[1] =
+            +3.69757819e+00
+            +3.06759845e-04 * tc[1]
+            -4.19613997e-08 * tc[2]
+            +4.43820370e-12 * tc[3]
+            -2.27287062e-16 * tc[4]
+            -1.23393018e+03 * invT;
+        /*species 2: H2O */
+        species[2] =
+            +2.67214561e+00
+            +1.52814644e-03 * tc[1]
+            -2.91008670e-07 * tc[2]
+            +3.00249098e-11 * tc[3]
+            -1.27832357e-15 * tc[4]
+            -2.98992090e+04 * invT;
+        /*species 3: H */
+        species[3] =
+            +2.50000000e+00
+            +0.00000000e+00 * tc[1]
+            +0.00000000e+00 * tc[2]
+            +0.00000000e+00 * tc[3]
+            +0.00000000e+00 * tc[4]
+            +2.54716270e+04 * invT;
+        /*species 4: O */
+        species[4] =
+            +2.54205966e+00
+            -1.37753096e-05 * tc[1]
+            -1.03426778e-09 * tc[2]
+            +1.13776685e-12 * tc[3]
+            -8.73610300e-17 * tc[4]
+            +2.92308027e+04 * invT;
+        /*species 5: OH */
+        species[5] =
+            +2.86472886e+00
+            +5.28252240e-04 * tc[1]
+            -8.63609193e-08 * tc[2]
+            +7.63046685e-12 * tc[3]
+            -2.66391752e-16 * tc[4]
+            +3.68362875e+03 * invT;
+        /*species 6: HO2 */
+        species[6] =
+            +4.01721090e+00
+            +1.11991006e-03 * tc[1]
+            -2.11219383e-07 * tc[2]
+            +2.85615925e-11 * tc[3]
+            -2.15817070e-15 * tc[4]
+            +1.11856713e+02 * invT;
+        /*species 7: H2O2 */
+        species[7] =
+            +4.57316685e+00
+            +2.16806820e-03 * tc[1]
+            -4.91562940e-07 * tc[2]
+            +5.87225893e-11 * tc[3]
+            -2.86330712e-15 * tc[4]
+            -1.80069609e+04 * invT;
+        /*species 8: N2 */
+        species[8] =
+            +2.92664000e+00
+            +7.43988500e-04 * tc[1]
+            -1.89492033e-07 * tc[2]
+            +2.52426000e-11 * tc[3]
+            -1.35067020e-15 * tc[4]
+            -9.22797700e+02 * invT;
+    }
+    return;
+}
+
+
+/*compute the S/R at the given temperature (Eq 21) */
+/*tc contains precomputed powers of T, tc[0] = log(T) */
+void speciesEntropy(double * restrict species, double * restrict tc)
+{
+
+    /*temperature */
+    double T = tc[1];
+
+    /*species with midpoint at T=1000 kelvin */
+    if (T < 1000) {
+        /*species 0: H2 */
+        species[0] =
+            +3.29812431e+00 * tc[0]
+            +8.24944174e-04 * tc[1]
+            -4.07150765e-07 * tc[2]
+            -3.15847811e-11 * tc[3]
+            +1.03371806e-13 * tc[4]
+            -3.29409409e+00 ;
+        /*species 1: O2 */
+        species[1] =
+            +3.21293640e+00 * tc[0]
+            +1.12748635e-03 * tc[1]
+            -2.87807523e-07 * tc[2]
+            +4.37959077e-10 * tc[3]
+            -2.19213848e-13 * tc[4]
+            +6.03473759e+00 ;
+        /*species 2: H2O */
+        species[2] =
+            +3.38684249e+00 * tc[0]
+            +3.47498246e-03 * tc[1]
+            -3.17734817e-06 * tc[2]
+            +2.32286042e-09 * tc[3]
+            -6.26647117e-13 * tc[4]
+            +2.59023285e+00 ;
+        /*species 3: H */
+        species[3] =
+            +2.50000000e+00 * tc[0]
+            +0.00000000e+00 * tc[1]
+            +0.00000000e+00 * tc[2]
+            +0.00000000e+00 * tc[3]
+            +0.00000000e+00 * tc[4]
+            -4.60117608e-01 ;
+        /*species 4: O */
+        species[4] =
+            +2.94642878e+00 * tc[0]
+            -1.63816649e-03 * tc[1]
+            +1.21051585e-06 * tc[2]
+            -5.34281063e-10 * tc[3]
+            +9.72674090e-14 * tc[4]
+            +2.96399498e+00 ;
+        /*species 5: OH */
+        species[5] =
+            +4.12530561e+00 * tc[0]
+            -3.22544939e-03 * tc[1]
+            +3.26382346e-06 * tc[2]
+            -1.93284548e-09 * tc[3]
+            +5.15593447e-13 * tc[4]
+            -6.90432960e-01 ;
+        /*species 6: HO2 */
+        species[6] =
+            +4.30179801e+00 * tc[0]
+            -4.74912051e-03 * tc[1]
+            +1.05791445e-05 * tc[2]
+            -8.09212980e-09 * tc[3]
+            +2.32306281e-12 * tc[4]
+            +3.71666245e+00 ;
+        /*species 7: H2O2 */
+        species[7] =
+            +3.38875365e+00 * tc[0]
+            +6.56922581e-03 * tc[1]
+            -7.42506290e-08 * tc[2]
+            -1.54193517e-09 * tc[3]
+            +6.17878688e-13 * tc[4]
+            +6.78536320e+00 ;
+        /*species 8: N2 */
+        species[8] =
+            +3.29867700e+00 * tc[0]
+            +1.40824000e-03 * tc[1]
+            -1.98161100e-06 * tc[2]
+            +1.88050500e-09 * tc[3]
+            -6.11213750e-13 * tc[4]
+            +3.95037200e+00 ;
+    } else {
+        /*species 0: H2 */
+        species[0] =
+            +2.99142337e+00 * tc[0]
+            +7.00064411e-04 * tc[1]
+            -2.81691434e-08 * tc[2]
+            -3.07719273e-12 * tc[3]
+            +3.95687948e-16 * tc[4]
+            -1.35511017e+00 ;
+        /*species 1: O2 */
+        species[1] =
+            +3.69757819e+00 * tc[0]
+            +6.13519689e-04 * tc[1]
+            -6.29420995e-08 * tc[2]
+            +5.91760493e-12 * tc[3]
+            -2.84108828e-16 * tc[4]
+            +3.18916559e+00 ;
+        /*species 2: H2O */
+        species[2] =
+            +2.67214561e+00 * tc[0]
+            +3.05629289e-03 * tc[1]
+            -4.36513005e-07 * tc[2]
+            +4.00332130e-11 * tc[3]
+            -1.59790447e-15 * tc[4]
+            +6.86281681e+00 ;
+        /*species 3: H */
+        species[3] =
+            +2.50000000e+00 * tc[0]
+            +0.00000000e+00 * tc[1]
+            +0.00000000e+00 * tc[2]
+            +0.00000000e+00 * tc[3]
+            +0.00000000e+00 * tc[4]
+            -4.60117638e-01 ;
+        /*species 4: O */
+        species[4] =
+            +2.54205966e+00 * tc[0]
+            -2.75506191e-05 * tc[1]
+            -1.55140167e-09 * tc[2]
+            +1.51702247e-12 * tc[3]
+            -1.09201287e-16 * tc[4]
+            +4.92030811e+00 ;
+        /*species 5: OH */
+        species[5] =
+            +2.86472886e+00 * tc[0]
+            +1.05650448e-03 * tc[1]
+            -1.29541379e-07 * tc[2]
+            +1.01739558e-11 * tc[3]
+            -3.32989690e-16 * tc[4]
+            +5.70164073e+00 ;
+        /*species 6: HO2 */
+        species[6] =
+            +4.01721090e+00 * tc[0]
+            +2.23982013e-03 * tc[1]
+            -3.16829075e-07 * tc[2]
+            +3.80821233e-11 * tc[3]
+            -2.69771337e-15 * tc[4]
+            +3.78510215e+00 ;
+        /*species 7: H2O2 */
+        species[7] =
+            +4.57316685e+00 * tc[0]
+            +4.33613639e-03 * tc[1]
+            -7.37344410e-07 * tc[2]
+            +7.82967857e-11 * tc[3]
+            -3.57913390e-15 * tc[4]
+            +5.01136959e-01 ;
+        /*species 8: N2 */
+        species[8] =
+            +2.92664000e+00 * tc[0]
+            +1.48797700e-03 * tc[1]
+            -2.84238050e-07 * tc[2]
+            +3.36568000e-11 * tc[3]
+            -1.68833775e-15 * tc[4]
+            +5.98052800e+00 ;
+    }
+    return;
+}
+
+
+/*save molecular weights into array */
+void molecularWeight(double * restrict wt)
+{
+    wt[0] = 2.015940; /*H2 */
+    wt[1] = 31.998800; /*O2 */
+    wt[2] = 18.015340; /*H2O */
+    wt[3] = 1.007970; /*H */
+    wt[4] = 15.999400; /*O */
+    wt[5] = 17.007370; /*OH */
+    wt[6] = 33.006770; /*HO2 */
+    wt[7] = 34.014740; /*H2O2 */
+    wt[8] = 28.013400; /*N2 */
+
+    return;
+}
+
+
+/*save atomic weights into array */
+void atomicWeight(double * restrict awt)
+{
+    awt[0] = 1.007970; /*H */
+    awt[1] = 15.999400; /*O */
+    awt[2] = 14.006700; /*N */
+
+    return;
+}
+/* get temperature given internal energy in mass units and mass fracs */
+void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int * ierr)
+{
+#ifdef CONVERGENCE
+    const int maxiter = 5000;
+    const double tol  = 1.e-12;
+#else
+    const int maxiter = 200;
+    const double tol  = 1.e-6;
+#endif
+    double ein  = *e;
+    double tmin = 250;/*max lower bound for thermo def */
+    double tmax = 4000;/*min upper bound for thermo def */
+    double e1,emin,emax,cv,t1,dt;
+    int i;/* loop counter */
+    CKUBMS(&tmin, y, iwrk, rwrk, &emin);
+    CKUBMS(&tmax, y, iwrk, rwrk, &emax);
+    if (ein < emin) {
+        /*Linear Extrapolation below tmin */
+        CKCVBS(&tmin, y, iwrk, rwrk, &cv);
+        *t = tmin - (emin-ein)/cv;
+        *ierr = 1;
+        return;
+    }
+    if (ein > emax) {
+        /*Linear Extrapolation above tmax */
+        CKCVBS(&tmax, y, iwrk, rwrk, &cv);
+        *t = tmax - (emax-ein)/cv;
+        *ierr = 1;
+        return;
+    }
+    t1 = *t;
+    if (t1 < tmin || t1 > tmax) {
+        t1 = tmin + (tmax-tmin)/(emax-emin)*(ein-emin);
+    }
+    for (i = 0; i < maxiter; ++i) {
+        CKUBMS(&t1,y,iwrk,rwrk,&e1);
+        CKCVBS(&t1,y,iwrk,rwrk,&cv);
+        dt = (ein - e1) / cv;
+        if (dt > 100.) { dt = 100.; }
+        else if (dt < -100.) { dt = -100.; }
+        else if (fabs(dt) < tol) break;
+        else if (t1+dt == t1) break;
+        t1 += dt;
+    }
+    *t = t1;
+    *ierr = 0;
+    return;
+}
+/* get temperature given enthalpy in mass units and mass fracs */
+void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int * ierr)
+{
+#ifdef CONVERGENCE
+    const int maxiter = 5000;
+    const double tol  = 1.e-12;
+#else
+    const int maxiter = 200;
+    const double tol  = 1.e-6;
+#endif
+    double hin  = *h;
+    double tmin = 250;/*max lower bound for thermo def */
+    double tmax = 4000;/*min upper bound for thermo def */
+    double h1,hmin,hmax,cp,t1,dt;
+    int i;/* loop counter */
+    CKHBMS(&tmin, y, iwrk, rwrk, &hmin);
+    CKHBMS(&tmax, y, iwrk, rwrk, &hmax);
+    if (hin < hmin) {
+        /*Linear Extrapolation below tmin */
+        CKCPBS(&tmin, y, iwrk, rwrk, &cp);
+        *t = tmin - (hmin-hin)/cp;
+        *ierr = 1;
+        return;
+    }
+    if (hin > hmax) {
+        /*Linear Extrapolation above tmax */
+        CKCPBS(&tmax, y, iwrk, rwrk, &cp);
+        *t = tmax - (hmax-hin)/cp;
+        *ierr = 1;
+        return;
+    }
+    t1 = *t;
+    if (t1 < tmin || t1 > tmax) {
+        t1 = tmin + (tmax-tmin)/(hmax-hmin)*(hin-hmin);
+    }
+    for (i = 0; i < maxiter; ++i) {
+        CKHBMS(&t1,y,iwrk,rwrk,&h1);
+        CKCPBS(&t1,y,iwrk,rwrk,&cp);
+        dt = (hin - h1) / cp;
+        if (dt > 100.) { dt = 100.; }
+        else if (dt < -100.) { dt = -100.; }
+        else if (fabs(dt) < tol) break;
+        else if (t1+dt == t1) break;
+        t1 += dt;
+    }
+    *t = t1;
+    *ierr = 0;
+    return;
+}
+
+/* End of file  */
+#if defined(BL_FORT_USE_UPPERCASE)
+#define egtransetLENIMC EGTRANSETLENIMC
+#elif defined(BL_FORT_USE_LOWERCASE)
+#define egtransetLENIMC egtransetlenimc
+#elif defined(BL_FORT_USE_UNDERSCORE)
+#define egtransetLENIMC egtransetlenimc_
+#endif
+void egtransetLENIMC(int* LENIMC) {
+  *LENIMC =           38;}
+#if defined(BL_FORT_USE_UPPERCASE)
+#define egtransetLENRMC EGTRANSETLENRMC
+#elif defined(BL_FORT_USE_LOWERCASE)
+#define egtransetLENRMC egtransetlenrmc
+#elif defined(BL_FORT_USE_UNDERSCORE)
+#define egtransetLENRMC egtransetlenrmc_
+#endif
+void egtransetLENRMC(int* LENRMC) {
+  *LENRMC =         1854;}
+#if defined(BL_FORT_USE_UPPERCASE)
+#define egtransetNO EGTRANSETNO
+#elif defined(BL_FORT_USE_LOWERCASE)
+#define egtransetNO egtransetno
+#elif defined(BL_FORT_USE_UNDERSCORE)
+#define egtransetNO egtransetno_
+#endif
+void egtransetNO(int* NO) {
+  *NO =            4;}
+#if defined(BL_FORT_USE_UPPERCASE)
+#define egtransetKK EGTRANSETKK
+#elif defined(BL_FORT_USE_LOWERCASE)
+#define egtransetKK egtransetkk
+#elif defined(BL_FORT_USE_UNDERSCORE)
+#define egtransetKK egtransetkk_
+#endif
+void egtransetKK(int* KK) {
+  *KK =            9;}
+#if defined(BL_FORT_USE_UPPERCASE)
+#define egtransetNLITE EGTRANSETNLITE
+#elif defined(BL_FORT_USE_LOWERCASE)
+#define egtransetNLITE egtransetnlite
+#elif defined(BL_FORT_USE_UNDERSCORE)
+#define egtransetNLITE egtransetnlite_
+#endif
+void egtransetNLITE(int* NLITE) {
+  *NLITE =            2;}
+#if defined(BL_FORT_USE_UPPERCASE)
+#define egtransetPATM EGTRANSETPATM
+#elif defined(BL_FORT_USE_LOWERCASE)
+#define egtransetPATM egtransetpatm
+#elif defined(BL_FORT_USE_UNDERSCORE)
+#define egtransetPATM egtransetpatm_
+#endif
+void egtransetPATM(double* PATM) {
+  *PATM =   0.1013250000000000E+07;}
+#if defined(BL_FORT_USE_UPPERCASE)
+#define egtransetWT EGTRANSETWT
+#elif defined(BL_FORT_USE_LOWERCASE)
+#define egtransetWT egtransetwt
+#elif defined(BL_FORT_USE_UNDERSCORE)
+#define egtransetWT egtransetwt_
+#endif
+void egtransetWT(double* WT) {
+  WT[           0] =   0.2015939950942993E+01;
+  WT[           1] =   0.3199880027770996E+02;
+  WT[           2] =   0.1801534008979797E+02;
+  WT[           3] =   0.1007969975471497E+01;
+  WT[           4] =   0.1599940013885498E+02;
+  WT[           5] =   0.1700737011432648E+02;
+  WT[           6] =   0.3300677025318146E+02;
+  WT[           7] =   0.3401474022865295E+02;
+  WT[           8] =   0.2801339912414551E+02;
+};
+#if defined(BL_FORT_USE_UPPERCASE)
+#define egtransetEPS EGTRANSETEPS
+#elif defined(BL_FORT_USE_LOWERCASE)
+#define egtransetEPS egtranseteps
+#elif defined(BL_FORT_USE_UNDERSCORE)
+#define egtransetEPS egtranseteps_
+#endif
+void egtransetEPS(double* EPS) {
+  EPS[           0] =   0.3800000000000000E+02;
+  EPS[           1] =   0.1074000000000000E+03;
+  EPS[           2] =   0.5724000000000000E+03;
+  EPS[           3] =   0.1450000000000000E+03;
+  EPS[           4] =   0.8000000000000000E+02;
+  EPS[           5] =   0.8000000000000000E+02;
+  EPS[           6] =   0.1074000000000000E+03;
+  EPS[           7] =   0.1074000000000000E+03;
+  EPS[           8] =   0.9753000000000000E+02;
+};
+#if defined(BL_FORT_USE_UPPERCASE)
+#define egtransetSIG EGTRANSETSIG
+#elif defined(BL_FORT_USE_LOWERCASE)
+#define egtransetSIG egtransetsig
+#elif defined(BL_FORT_USE_UNDERSCORE)
+#define egtransetSIG egtransetsig_
+#endif
+void egtransetSIG(double* SIG) {
+  SIG[           0] =   0.2920000000000000E+01;
+  SIG[           1] =   0.3458000000000000E+01;
+  SIG[           2] =   0.2605000000000000E+01;
+  SIG[           3] =   0.2050000000000000E+01;
+  SIG[           4] =   0.2750000000000000E+01;
+  SIG[           5] =   0.2750000000000000E+01;
+  SIG[           6] =   0.3458000000000000E+01;
+  SIG[           7] =   0.3458000000000000E+01;
+  SIG[           8] =   0.3621000000000000E+01;
+};
+#if defined(BL_FORT_USE_UPPERCASE)
+#define egtransetDIP EGTRANSETDIP
+#elif defined(BL_FORT_USE_LOWERCASE)
+#define egtransetDIP egtransetdip
+#elif defined(BL_FORT_USE_UNDERSCORE)
+#define egtransetDIP egtransetdip_
+#endif
+void egtransetDIP(double* DIP) {
+  DIP[           0] =   0.0000000000000000E+00;
+  DIP[           1] =   0.0000000000000000E+00;
+  DIP[           2] =   0.1844000000000000E+01;
+  DIP[           3] =   0.0000000000000000E+00;
+  DIP[           4] =   0.0000000000000000E+00;
+  DIP[           5] =   0.0000000000000000E+00;
+  DIP[           6] =   0.0000000000000000E+00;
+  DIP[           7] =   0.0000000000000000E+00;
+  DIP[           8] =   0.0000000000000000E+00;
+};
+#if defined(BL_FORT_USE_UPPERCASE)
+#define egtransetPOL EGTRANSETPOL
+#elif defined(BL_FORT_USE_LOWERCASE)
+#define egtransetPOL egtransetpol
+#elif defined(BL_FORT_USE_UNDERSCORE)
+#define egtransetPOL egtransetpol_
+#endif
+void egtransetPOL(double* POL) {
+  POL[           0] =   0.7900000000000000E+00;
+  POL[           1] =   0.1600000000000000E+01;
+  POL[           2] =   0.0000000000000000E+00;
+  POL[           3] =   0.0000000000000000E+00;
+  POL[           4] =   0.0000000000000000E+00;
+  POL[           5] =   0.0000000000000000E+00;
+  POL[           6] =   0.0000000000000000E+00;
+  POL[           7] =   0.0000000000000000E+00;
+  POL[           8] =   0.1760000000000000E+01;
+};
+#if defined(BL_FORT_USE_UPPERCASE)
+#define egtransetZROT EGTRANSETZROT
+#elif defined(BL_FORT_USE_LOWERCASE)
+#define egtransetZROT egtransetzrot
+#elif defined(BL_FORT_USE_UNDERSCORE)
+#define egtransetZROT egtransetzrot_
+#endif
+void egtransetZROT(double* ZROT) {
+  ZROT[           0] =   0.2800000000000000E+03;
+  ZROT[           1] =   0.3800000000000000E+01;
+  ZROT[           2] =   0.4000000000000000E+01;
+  ZROT[           3] =   0.0000000000000000E+00;
+  ZROT[           4] =   0.0000000000000000E+00;
+  ZROT[           5] =   0.0000000000000000E+00;
+  ZROT[           6] =   0.1000000000000000E+01;
+  ZROT[           7] =   0.3800000000000000E+01;
+  ZROT[           8] =   0.4000000000000000E+01;
+};
+#if defined(BL_FORT_USE_UPPERCASE)
+#define egtransetNLIN EGTRANSETNLIN
+#elif defined(BL_FORT_USE_LOWERCASE)
+#define egtransetNLIN egtransetnlin
+#elif defined(BL_FORT_USE_UNDERSCORE)
+#define egtransetNLIN egtransetnlin_
+#endif
+void egtransetNLIN(int* NLIN) {
+  NLIN[           0] =            1;
+  NLIN[           1] =            1;
+  NLIN[           2] =            2;
+  NLIN[           3] =            0;
+  NLIN[           4] =            0;
+  NLIN[           5] =            1;
+  NLIN[           6] =            2;
+  NLIN[           7] =            2;
+  NLIN[           8] =            1;
+};
+#if defined(BL_FORT_USE_UPPERCASE)
+#define egtransetCOFLAM EGTRANSETCOFLAM
+#elif defined(BL_FORT_USE_LOWERCASE)
+#define egtransetCOFLAM egtransetcoflam
+#elif defined(BL_FORT_USE_UNDERSCORE)
+#define egtransetCOFLAM egtransetcoflam_
+#endif
+void egtransetCOFLAM(double* COFLAM) {
+  COFLAM[           0] =   0.1109466217088744E+02;
+  COFLAM[           1] =  -0.1314982879973400E+01;
+  COFLAM[           2] =   0.2434842345478272E+00;
+  COFLAM[           3] =  -0.8971821506339107E-02;
+  COFLAM[           4] =  -0.2513896927262683E+01;
+  COFLAM[           5] =   0.3151661994436593E+01;
+  COFLAM[           6] =  -0.3099623183029560E+00;
+  COFLAM[           7] =   0.1344793787858907E-01;
+  COFLAM[           8] =   0.2212500250653218E+02;
+  COFLAM[           9] =  -0.8451477268785496E+01;
+  COFLAM[          10] =   0.1459333704606090E+01;
+  COFLAM[          11] =  -0.7286069710088973E-01;
+  COFLAM[          12] =  -0.3253788579319486E+00;
+  COFLAM[          13] =   0.3416397862210875E+01;
+  COFLAM[          14] =  -0.3631104489846262E+00;
+  COFLAM[          15] =   0.1585986202702918E-01;
+  COFLAM[          16] =   0.1969666526185763E+01;
+  COFLAM[          17] =   0.1801396425547300E+01;
+  COFLAM[          18] =  -0.1549102264837655E+00;
+  COFLAM[          19] =   0.6908759721669425E-02;
+  COFLAM[          20] =   0.1605449323860262E+02;
+  COFLAM[          21] =  -0.4103244048729492E+01;
+  COFLAM[          22] =   0.6631513498156665E+00;
+  COFLAM[          23] =  -0.2977137989389932E-01;
+  COFLAM[          24] =   0.5546401577805573E+00;
+  COFLAM[          25] =   0.1591057931808813E+01;
+  COFLAM[          26] =  -0.5282455808284543E-01;
+  COFLAM[          27] =   0.4072391521895438E-03;
+  COFLAM[          28] =   0.1486267947622502E+01;
+  COFLAM[          29] =   0.1062271348472054E+01;
+  COFLAM[          30] =   0.5716895740566978E-01;
+  COFLAM[          31] =  -0.6382577562940780E-02;
+  COFLAM[          32] =   0.1154289596065436E+02;
+  COFLAM[          33] =  -0.2911524559760463E+01;
+  COFLAM[          34] =   0.5546581827235442E+00;
+  COFLAM[          35] =  -0.2750103005663747E-01;
+};
+#if defined(BL_FORT_USE_UPPERCASE)
+#define egtransetCOFETA EGTRANSETCOFETA
+#elif defined(BL_FORT_USE_LOWERCASE)
+#define egtransetCOFETA egtransetcofeta
+#elif defined(BL_FORT_USE_UNDERSCORE)
+#define egtransetCOFETA egtransetcofeta_
+#endif
+void egtransetCOFETA(double* COFETA) {
+  COFETA[           0] =  -0.1376710086380533E+02;
+  COFETA[           1] =   0.9708665581008417E+00;
+  COFETA[           2] =  -0.4534923959308444E-01;
+  COFETA[           3] =   0.2096011921433090E-02;
+  COFETA[           4] =  -0.1681080110872507E+02;
+  COFETA[           5] =   0.2522528725237932E+01;
+  COFETA[           6] =  -0.2490712798240462E+00;
+  COFETA[           7] =   0.1100615806447165E-01;
+  COFETA[           8] =  -0.1187800764707307E+02;
+  COFETA[           9] =  -0.7882519505482808E+00;
+  COFETA[          10] =   0.3341408170058896E+00;
+  COFETA[          11] =  -0.1986366361647418E-01;
+  COFETA[          12] =  -0.1987529414716897E+02;
+  COFETA[          13] =   0.3416397862210910E+01;
+  COFETA[          14] =  -0.3631104489846305E+00;
+  COFETA[          15] =   0.1585986202702936E-01;
+  COFETA[          16] =  -0.1481563591580279E+02;
+  COFETA[          17] =   0.1801396425547327E+01;
+  COFETA[          18] =  -0.1549102264837694E+00;
+  COFETA[          19] =   0.6908759721669611E-02;
+  COFETA[          20] =  -0.1478508813778873E+02;
+  COFETA[          21] =   0.1801396425547305E+01;
+  COFETA[          22] =  -0.1549102264837663E+00;
+  COFETA[          23] =   0.6908759721669463E-02;
+  COFETA[          24] =  -0.1679529396430702E+02;
+  COFETA[          25] =   0.2522528725237947E+01;
+  COFETA[          26] =  -0.2490712798240481E+00;
+  COFETA[          27] =   0.1100615806447173E-01;
+  COFETA[          28] =  -0.1678025333071109E+02;
+  COFETA[          29] =   0.2522528725237946E+01;
+  COFETA[          30] =  -0.2490712798240483E+00;
+  COFETA[          31] =   0.1100615806447175E-01;
+  COFETA[          32] =  -0.1626172843728175E+02;
+  COFETA[          33] =   0.2251740453876138E+01;
+  COFETA[          34] =  -0.2138340893699383E+00;
+  COFETA[          35] =   0.9477823154448534E-02;
+};
+#if defined(BL_FORT_USE_UPPERCASE)
+#define egtransetCOFD EGTRANSETCOFD
+#elif defined(BL_FORT_USE_LOWERCASE)
+#define egtransetCOFD egtransetcofd
+#elif defined(BL_FORT_USE_UNDERSCORE)
+#define egtransetCOFD egtransetcofd_
+#endif
+void egtransetCOFD(double* COFD) {
+  COFD[           0] =  -0.1023073719095340E+02;
+  COFD[           1] =   0.2153598714195162E+01;
+  COFD[           2] =  -0.6969019063693850E-01;
+  COFD[           3] =   0.3233961733522977E-02;
+  COFD[           4] =  -0.1228690337278460E+02;
+  COFD[           5] =   0.2739817607547901E+01;
+  COFD[           6] =  -0.1455907617836413E+00;
+  COFD[           7] =   0.6496697467578658E-02;
+  COFD[           8] =  -0.1787213075631945E+02;
+  COFD[           9] =   0.4905112324365878E+01;
+  COFD[          10] =  -0.4173872143518051E+00;
+  COFD[          11] =   0.1788845489573668E-01;
+  COFD[          12] =  -0.1168685516750758E+02;
+  COFD[          13] =   0.2883726644585007E+01;
+  COFD[          14] =  -0.1637777890869061E+00;
+  COFD[          15] =   0.7265872474830623E-02;
+  COFD[          16] =  -0.1060109579664357E+02;
+  COFD[          17] =   0.2157129122185176E+01;
+  COFD[          18] =  -0.6524729611183182E-01;
+  COFD[          19] =   0.2809597810849289E-02;
+  COFD[          20] =  -0.1060412419807472E+02;
+  COFD[          21] =   0.2157123706881953E+01;
+  COFD[          22] =  -0.6524690383610432E-01;
+  COFD[          23] =   0.2809593789707914E-02;
+  COFD[          24] =  -0.1229066279603360E+02;
+  COFD[          25] =   0.2741057082889793E+01;
+  COFD[          26] =  -0.1457627022193994E+00;
+  COFD[          27] =   0.6504615244946633E-02;
+  COFD[          28] =  -0.1229422250798061E+02;
+  COFD[          29] =   0.2742232459895579E+01;
+  COFD[          30] =  -0.1459257489141948E+00;
+  COFD[          31] =   0.6512123400236565E-02;
+  COFD[          32] =  -0.1217511489930491E+02;
+  COFD[          33] =   0.2679286720576265E+01;
+  COFD[          34] =  -0.1373997446113497E+00;
+  COFD[          35] =   0.6125379451516252E-02;
+  COFD[          36] =  -0.1228690337278460E+02;
+  COFD[          37] =   0.2739817607547901E+01;
+  COFD[          38] =  -0.1455907617836413E+00;
+  COFD[          39] =   0.6496697467578658E-02;
+  COFD[          40] =  -0.1579169675646239E+02;
+  COFD[          41] =   0.3572143437285479E+01;
+  COFD[          42] =  -0.2518469828462104E+00;
+  COFD[          43] =   0.1102533331592793E-01;
+  COFD[          44] =  -0.2036133619470493E+02;
+  COFD[          45] =   0.5195864695910879E+01;
+  COFD[          46] =  -0.4301216528920454E+00;
+  COFD[          47] =   0.1744936825492251E-01;
+  COFD[          48] =  -0.1719486110604737E+02;
+  COFD[          49] =   0.4862600572193149E+01;
+  COFD[          50] =  -0.4215909171603991E+00;
+  COFD[          51] =   0.1846373197001472E-01;
+  COFD[          52] =  -0.1474363832488901E+02;
+  COFD[          53] =   0.3350090901251298E+01;
+  COFD[          54] =  -0.2245382243795846E+00;
+  COFD[          55] =   0.9906528312288899E-02;
+  COFD[          56] =  -0.1473449002110577E+02;
+  COFD[          57] =   0.3337793989426398E+01;
+  COFD[          58] =  -0.2228575541864579E+00;
+  COFD[          59] =   0.9830229599517820E-02;
+  COFD[          60] =  -0.1579979030842146E+02;
+  COFD[          61] =   0.3572309323030401E+01;
+  COFD[          62] =  -0.2518694694768392E+00;
+  COFD[          63] =   0.1102634618303224E-01;
+  COFD[          64] =  -0.1580828869487550E+02;
+  COFD[          65] =   0.3572786632028933E+01;
+  COFD[          66] =  -0.2519341709914386E+00;
+  COFD[          67] =   0.1102926053643803E-01;
+  COFD[          68] =  -0.1544409203507008E+02;
+  COFD[          69] =   0.3434913447661099E+01;
+  COFD[          70] =  -0.2339977102148624E+00;
+  COFD[          71] =   0.1025033359000777E-01;
+  COFD[          72] =  -0.1787213075631945E+02;
+  COFD[          73] =   0.4905112324365878E+01;
+  COFD[          74] =  -0.4173872143518051E+00;
+  COFD[          75] =   0.1788845489573668E-01;
+  COFD[          76] =  -0.2036133619470493E+02;
+  COFD[          77] =   0.5195864695910879E+01;
+  COFD[          78] =  -0.4301216528920454E+00;
+  COFD[          79] =   0.1744936825492251E-01;
+  COFD[          80] =  -0.1301206458003408E+02;
+  COFD[          81] =   0.1429168452568504E+01;
+  COFD[          82] =   0.1661557715508861E+00;
+  COFD[          83] =  -0.1214321823404827E-01;
+  COFD[          84] =  -0.1695183404426207E+02;
+  COFD[          85] =   0.4416203740445888E+01;
+  COFD[          86] =  -0.3114890192543383E+00;
+  COFD[          87] =   0.1159663710619628E-01;
+  COFD[          88] =  -0.1894546586601941E+02;
+  COFD[          89] =   0.4935720676293722E+01;
+  COFD[          90] =  -0.4114057447467022E+00;
+  COFD[          91] =   0.1723315986098057E-01;
+  COFD[          92] =  -0.1896004007077217E+02;
+  COFD[          93] =   0.4935377774711531E+01;
+  COFD[          94] =  -0.4113926173034602E+00;
+  COFD[          95] =   0.1723402811988101E-01;
+  COFD[          96] =  -0.1973436691750415E+02;
+  COFD[          97] =   0.4993125184848788E+01;
+  COFD[          98] =  -0.4088531920998837E+00;
+  COFD[          99] =   0.1672325900844039E-01;
+  COFD[         100] =  -0.1972379377029397E+02;
+  COFD[         101] =   0.4985700637038792E+01;
+  COFD[         102] =  -0.4077156220815392E+00;
+  COFD[         103] =   0.1666668649763390E-01;
+  COFD[         104] =  -0.2025975101746627E+02;
+  COFD[         105] =   0.5176212790334279E+01;
+  COFD[         106] =  -0.4308686680573706E+00;
+  COFD[         107] =   0.1761066268522406E-01;
+  COFD[         108] =  -0.1168685516750758E+02;
+  COFD[         109] =   0.2883726644585007E+01;
+  COFD[         110] =  -0.1637777890869061E+00;
+  COFD[         111] =   0.7265872474830623E-02;
+  COFD[         112] =  -0.1719486110604737E+02;
+  COFD[         113] =   0.4862600572193149E+01;
+  COFD[         114] =  -0.4215909171603991E+00;
+  COFD[         115] =   0.1846373197001472E-01;
+  COFD[         116] =  -0.1695183404426207E+02;
+  COFD[         117] =   0.4416203740445888E+01;
+  COFD[         118] =  -0.3114890192543383E+00;
+  COFD[         119] =   0.1159663710619628E-01;
+  COFD[         120] =  -0.1476537827842222E+02;
+  COFD[         121] =   0.4195448036781197E+01;
+  COFD[         122] =  -0.3279615676730872E+00;
+  COFD[         123] =   0.1412388797372668E-01;
+  COFD[         124] =  -0.1500301598770682E+02;
+  COFD[         125] =   0.4131920691035950E+01;
+  COFD[         126] =  -0.3275337549968449E+00;
+  COFD[         127] =   0.1442760802547180E-01;
+  COFD[         128] =  -0.1502025959280452E+02;
+  COFD[         129] =   0.4138327950805945E+01;
+  COFD[         130] =  -0.3284006010219734E+00;
+  COFD[         131] =   0.1446660099762999E-01;
+  COFD[         132] =  -0.1720445512239349E+02;
+  COFD[         133] =   0.4866330968714804E+01;
+  COFD[         134] =  -0.4220901924876364E+00;
+  COFD[         135] =   0.1848595807162496E-01;
+  COFD[         136] =  -0.1721362788263434E+02;
+  COFD[         137] =   0.4869900420159440E+01;
+  COFD[         138] =  -0.4225679381202458E+00;
+  COFD[         139] =   0.1850722613298993E-01;
+  COFD[         140] =  -0.1676897875889624E+02;
+  COFD[         141] =   0.4677755283143664E+01;
+  COFD[         142] =  -0.3974479445519867E+00;
+  COFD[         143] =   0.1741111717763365E-01;
+  COFD[         144] =  -0.1060109579664357E+02;
+  COFD[         145] =   0.2157129122185176E+01;
+  COFD[         146] =  -0.6524729611183182E-01;
+  COFD[         147] =   0.2809597810849289E-02;
+  COFD[         148] =  -0.1474363832488901E+02;
+  COFD[         149] =   0.3350090901251298E+01;
+  COFD[         150] =  -0.2245382243795846E+00;
+  COFD[         151] =   0.9906528312288899E-02;
+  COFD[         152] =  -0.1894546586601941E+02;
+  COFD[         153] =   0.4935720676293722E+01;
+  COFD[         154] =  -0.4114057447467022E+00;
+  COFD[         155] =   0.1723315986098057E-01;
+  COFD[         156] =  -0.1500301598770682E+02;
+  COFD[         157] =   0.4131920691035950E+01;
+  COFD[         158] =  -0.3275337549968449E+00;
+  COFD[         159] =   0.1442760802547180E-01;
+  COFD[         160] =  -0.1329503778398344E+02;
+  COFD[         161] =   0.2938989816956702E+01;
+  COFD[         162] =  -0.1706012465018490E+00;
+  COFD[         163] =   0.7547358484820122E-02;
+  COFD[         164] =  -0.1331106228772027E+02;
+  COFD[         165] =   0.2939408772392007E+01;
+  COFD[         166] =  -0.1706589698617190E+00;
+  COFD[         167] =   0.7549998035548285E-02;
+  COFD[         168] =  -0.1476396639560408E+02;
+  COFD[         169] =   0.3356474034011327E+01;
+  COFD[         170] =  -0.2254105976116209E+00;
+  COFD[         171] =   0.9946130954817655E-02;
+  COFD[         172] =  -0.1478376315874751E+02;
+  COFD[         173] =   0.3362741024796286E+01;
+  COFD[         174] =  -0.2262670743508222E+00;
+  COFD[         175] =   0.9985011202484037E-02;
+  COFD[         176] =  -0.1442662508885140E+02;
+  COFD[         177] =   0.3216422191096490E+01;
+  COFD[         178] =  -0.2069561315576079E+00;
+  COFD[         179] =   0.9135288598631700E-02;
+  COFD[         180] =  -0.1060412419807472E+02;
+  COFD[         181] =   0.2157123706881953E+01;
+  COFD[         182] =  -0.6524690383610432E-01;
+  COFD[         183] =   0.2809593789707914E-02;
+  COFD[         184] =  -0.1473449002110577E+02;
+  COFD[         185] =   0.3337793989426398E+01;
+  COFD[         186] =  -0.2228575541864579E+00;
+  COFD[         187] =   0.9830229599517820E-02;
+  COFD[         188] =  -0.1896004007077217E+02;
+  COFD[         189] =   0.4935377774711531E+01;
+  COFD[         190] =  -0.4113926173034602E+00;
+  COFD[         191] =   0.1723402811988101E-01;
+  COFD[         192] =  -0.1502025959280452E+02;
+  COFD[         193] =   0.4138327950805945E+01;
+  COFD[         194] =  -0.3284006010219734E+00;
+  COFD[         195] =   0.1446660099762999E-01;
+  COFD[         196] =  -0.1331106228772027E+02;
+  COFD[         197] =   0.2939408772392007E+01;
+  COFD[         198] =  -0.1706589698617190E+00;
+  COFD[         199] =   0.7549998035548285E-02;
+  COFD[         200] =  -0.1332558556199739E+02;
+  COFD[         201] =   0.2938989816956671E+01;
+  COFD[         202] =  -0.1706012465018444E+00;
+  COFD[         203] =   0.7547358484819904E-02;
+  COFD[         204] =  -0.1475457475365462E+02;
+  COFD[         205] =   0.3343986593397501E+01;
+  COFD[         206] =  -0.2237039347662408E+00;
+  COFD[         207] =   0.9868653787965939E-02;
+  COFD[         208] =  -0.1477418610290300E+02;
+  COFD[         209] =   0.3350090901251285E+01;
+  COFD[         210] =  -0.2245382243795827E+00;
+  COFD[         211] =   0.9906528312288795E-02;
+  COFD[         212] =  -0.1442063092189782E+02;
+  COFD[         213] =   0.3205844724257626E+01;
+  COFD[         214] =  -0.2055144159347264E+00;
+  COFD[         215] =   0.9070008933822527E-02;
+  COFD[         216] =  -0.1229066279603360E+02;
+  COFD[         217] =   0.2741057082889793E+01;
+  COFD[         218] =  -0.1457627022193994E+00;
+  COFD[         219] =   0.6504615244946633E-02;
+  COFD[         220] =  -0.1579979030842146E+02;
+  COFD[         221] =   0.3572309323030401E+01;
+  COFD[         222] =  -0.2518694694768392E+00;
+  COFD[         223] =   0.1102634618303224E-01;
+  COFD[         224] =  -0.1973436691750415E+02;
+  COFD[         225] =   0.4993125184848788E+01;
+  COFD[         226] =  -0.4088531920998837E+00;
+  COFD[         227] =   0.1672325900844039E-01;
+  COFD[         228] =  -0.1720445512239349E+02;
+  COFD[         229] =   0.4866330968714804E+01;
+  COFD[         230] =  -0.4220901924876364E+00;
+  COFD[         231] =   0.1848595807162496E-01;
+  COFD[         232] =  -0.1476396639560408E+02;
+  COFD[         233] =   0.3356474034011327E+01;
+  COFD[         234] =  -0.2254105976116209E+00;
+  COFD[         235] =   0.9946130954817655E-02;
+  COFD[         236] =  -0.1475457475365462E+02;
+  COFD[         237] =   0.3343986593397501E+01;
+  COFD[         238] =  -0.2237039347662408E+00;
+  COFD[         239] =   0.9868653787965939E-02;
+  COFD[         240] =  -0.1580720390088048E+02;
+  COFD[         241] =   0.3572143437285478E+01;
+  COFD[         242] =  -0.2518469828462103E+00;
+  COFD[         243] =   0.1102533331592793E-01;
+  COFD[         244] =  -0.1581504405580379E+02;
+  COFD[         245] =   0.3572299494956542E+01;
+  COFD[         246] =  -0.2518681372333372E+00;
+  COFD[         247] =   0.1102628617469197E-01;
+  COFD[         248] =  -0.1545394137084459E+02;
+  COFD[         249] =   0.3436021618273004E+01;
+  COFD[         250] =  -0.2341477712817018E+00;
+  COFD[         251] =   0.1025708506984392E-01;
+  COFD[         252] =  -0.1229422250798061E+02;
+  COFD[         253] =   0.2742232459895579E+01;
+  COFD[         254] =  -0.1459257489141948E+00;
+  COFD[         255] =   0.6512123400236565E-02;
+  COFD[         256] =  -0.1580828869487550E+02;
+  COFD[         257] =   0.3572786632028933E+01;
+  COFD[         258] =  -0.2519341709914386E+00;
+  COFD[         259] =   0.1102926053643803E-01;
+  COFD[         260] =  -0.1972379377029397E+02;
+  COFD[         261] =   0.4985700637038792E+01;
+  COFD[         262] =  -0.4077156220815392E+00;
+  COFD[         263] =   0.1666668649763390E-01;
+  COFD[         264] =  -0.1721362788263434E+02;
+  COFD[         265] =   0.4869900420159440E+01;
+  COFD[         266] =  -0.4225679381202458E+00;
+  COFD[         267] =   0.1850722613298993E-01;
+  COFD[         268] =  -0.1478376315874751E+02;
+  COFD[         269] =   0.3362741024796286E+01;
+  COFD[         270] =  -0.2262670743508222E+00;
+  COFD[         271] =   0.9985011202484037E-02;
+  COFD[         272] =  -0.1477418610290300E+02;
+  COFD[         273] =   0.3350090901251285E+01;
+  COFD[         274] =  -0.2245382243795827E+00;
+  COFD[         275] =   0.9906528312288795E-02;
+  COFD[         276] =  -0.1581504405580379E+02;
+  COFD[         277] =   0.3572299494956542E+01;
+  COFD[         278] =  -0.2518681372333372E+00;
+  COFD[         279] =   0.1102628617469197E-01;
+  COFD[         280] =  -0.1582224453447645E+02;
+  COFD[         281] =   0.3572143437285498E+01;
+  COFD[         282] =  -0.2518469828462133E+00;
+  COFD[         283] =   0.1102533331592807E-01;
+  COFD[         284] =  -0.1546403419937241E+02;
+  COFD[         285] =   0.3437367417375052E+01;
+  COFD[         286] =  -0.2343299630280416E+00;
+  COFD[         287] =   0.1026528034463288E-01;
+  COFD[         288] =  -0.1217511489930491E+02;
+  COFD[         289] =   0.2679286720576265E+01;
+  COFD[         290] =  -0.1373997446113497E+00;
+  COFD[         291] =   0.6125379451516252E-02;
+  COFD[         292] =  -0.1544409203507008E+02;
+  COFD[         293] =   0.3434913447661099E+01;
+  COFD[         294] =  -0.2339977102148624E+00;
+  COFD[         295] =   0.1025033359000777E-01;
+  COFD[         296] =  -0.2025975101746627E+02;
+  COFD[         297] =   0.5176212790334279E+01;
+  COFD[         298] =  -0.4308686680573706E+00;
+  COFD[         299] =   0.1761066268522406E-01;
+  COFD[         300] =  -0.1676897875889624E+02;
+  COFD[         301] =   0.4677755283143664E+01;
+  COFD[         302] =  -0.3974479445519867E+00;
+  COFD[         303] =   0.1741111717763365E-01;
+  COFD[         304] =  -0.1442662508885140E+02;
+  COFD[         305] =   0.3216422191096490E+01;
+  COFD[         306] =  -0.2069561315576079E+00;
+  COFD[         307] =   0.9135288598631700E-02;
+  COFD[         308] =  -0.1442063092189782E+02;
+  COFD[         309] =   0.3205844724257626E+01;
+  COFD[         310] =  -0.2055144159347264E+00;
+  COFD[         311] =   0.9070008933822527E-02;
+  COFD[         312] =  -0.1545394137084459E+02;
+  COFD[         313] =   0.3436021618273004E+01;
+  COFD[         314] =  -0.2341477712817018E+00;
+  COFD[         315] =   0.1025708506984392E-01;
+  COFD[         316] =  -0.1546403419937241E+02;
+  COFD[         317] =   0.3437367417375052E+01;
+  COFD[         318] =  -0.2343299630280416E+00;
+  COFD[         319] =   0.1026528034463288E-01;
+  COFD[         320] =  -0.1521415383275665E+02;
+  COFD[         321] =   0.3348053449783496E+01;
+  COFD[         322] =  -0.2233657260417595E+00;
+  COFD[         323] =   0.9817787279109837E-02;
+};
+#if defined(BL_FORT_USE_UPPERCASE)
+#define egtransetKTDIF EGTRANSETKTDIF
+#elif defined(BL_FORT_USE_LOWERCASE)
+#define egtransetKTDIF egtransetktdif
+#elif defined(BL_FORT_USE_UNDERSCORE)
+#define egtransetKTDIF egtransetktdif_
+#endif
+void egtransetKTDIF(int* KTDIF) {
+  KTDIF[           0] =            1;
+  KTDIF[           1] =            4;
+};
+#if defined(BL_FORT_USE_UPPERCASE)
+#define egtransetCOFTD EGTRANSETCOFTD
+#elif defined(BL_FORT_USE_LOWERCASE)
+#define egtransetCOFTD egtransetcoftd
+#elif defined(BL_FORT_USE_UNDERSCORE)
+#define egtransetCOFTD egtransetcoftd_
+#endif
+void egtransetCOFTD(double* COFTD) {
+  COFTD[           0] =   0.0000000000000000E+00;
+  COFTD[           1] =   0.0000000000000000E+00;
+  COFTD[           2] =   0.0000000000000000E+00;
+  COFTD[           3] =   0.0000000000000000E+00;
+  COFTD[           4] =   0.4427392097103151E+00;
+  COFTD[           5] =   0.7117708739452678E-04;
+  COFTD[           6] =  -0.3847681435586731E-07;
+  COFTD[           7] =   0.6863235673780089E-11;
+  COFTD[           8] =   0.6020321200392946E-01;
+  COFTD[           9] =   0.5615615962686471E-03;
+  COFTD[          10] =  -0.2553727790421687E-06;
+  COFTD[          11] =   0.3633898304582181E-10;
+  COFTD[          12] =  -0.1525347878079855E+00;
+  COFTD[          13] =  -0.5464040665780899E-04;
+  COFTD[          14] =   0.2934125089337968E-07;
+  COFTD[          15] =  -0.4870919731196246E-11;
+  COFTD[          16] =   0.4155834523029710E+00;
+  COFTD[          17] =   0.1097383911871691E-04;
+  COFTD[          18] =  -0.3960224834087406E-08;
+  COFTD[          19] =   0.1144145307552153E-11;
+  COFTD[          20] =   0.4219325599835782E+00;
+  COFTD[          21] =   0.1114149277732201E-04;
+  COFTD[          22] =  -0.4020727469049531E-08;
+  COFTD[          23] =   0.1161625074178193E-11;
+  COFTD[          24] =   0.4444526949057779E+00;
+  COFTD[          25] =   0.7145255629999482E-04;
+  COFTD[          26] =  -0.3862572696699677E-07;
+  COFTD[          27] =   0.6889797705021213E-11;
+  COFTD[          28] =   0.4460703094919803E+00;
+  COFTD[          29] =   0.7171261254133862E-04;
+  COFTD[          30] =  -0.3876630782084383E-07;
+  COFTD[          31] =   0.6914873573367535E-11;
+  COFTD[          32] =   0.4452620885099525E+00;
+  COFTD[          33] =   0.4946972054970773E-04;
+  COFTD[          34] =  -0.2630235132337235E-07;
+  COFTD[          35] =   0.4903063330400376E-11;
+  COFTD[          36] =   0.1525347878079855E+00;
+  COFTD[          37] =   0.5464040665780899E-04;
+  COFTD[          38] =  -0.2934125089337968E-07;
+  COFTD[          39] =   0.4870919731196246E-11;
+  COFTD[          40] =   0.2204829568680314E+00;
+  COFTD[          41] =   0.4801643237618346E-03;
+  COFTD[          42] =  -0.2329279629943256E-06;
+  COFTD[          43] =   0.3464704623498651E-10;
+  COFTD[          44] =  -0.1418836567013430E+00;
+  COFTD[          45] =   0.7665588601033144E-03;
+  COFTD[          46] =  -0.3065500230258140E-06;
+  COFTD[          47] =   0.4029595271283201E-10;
+  COFTD[          48] =   0.0000000000000000E+00;
+  COFTD[          49] =   0.0000000000000000E+00;
+  COFTD[          50] =   0.0000000000000000E+00;
+  COFTD[          51] =   0.0000000000000000E+00;
+  COFTD[          52] =   0.2700102625474920E+00;
+  COFTD[          53] =   0.3615551214404962E-03;
+  COFTD[          54] =  -0.1807447676772846E-06;
+  COFTD[          55] =   0.2753212716087208E-10;
+  COFTD[          56] =   0.2720417770528547E+00;
+  COFTD[          57] =   0.3642754049836650E-03;
+  COFTD[          58] =  -0.1821046627192010E-06;
+  COFTD[          59] =   0.2773927453061686E-10;
+  COFTD[          60] =   0.2209079675460805E+00;
+  COFTD[          61] =   0.4810899053474402E-03;
+  COFTD[          62] =  -0.2333769631025201E-06;
+  COFTD[          63] =   0.3471383309607501E-10;
+  COFTD[          64] =   0.2213085142120510E+00;
+  COFTD[          65] =   0.4819622095914184E-03;
+  COFTD[          66] =  -0.2338001183446032E-06;
+  COFTD[          67] =   0.3477677564298334E-10;
+  COFTD[          68] =   0.2407445350007590E+00;
+  COFTD[          69] =   0.4453434831756282E-03;
+  COFTD[          70] =  -0.2181738909148746E-06;
+  COFTD[          71] =   0.3269585309435789E-10;
+};
+
+
+
+
+#if 0
+
+
+
+
+\\
+\\
+\\  This is the mechanism file
+\\
+\\
+!<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>
+!
+! H2/O2 oxidation reaction mechanism --
+! (c) Li, Zhao, Kazakov, and Dryer, Princeton University, 2003.
+!
+!!!!!!!!!!!!!!!! IMPORTANT !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+!
+! HOW TO USE THIS MECHANISM:
+!
+! Due to 
+! (1) limitations of CHEMKIN-II format (specifically, an inability to implement
+!     temperature-dependent collision efficiencies in falloff reactions)
+! and
+! (2) lack of fundamental understanding of the mixing rules for the falloff 
+!     reactions with the bath gases that have different broadening factors,
+!
+! the present implementation represents a compromise (approximate) formulation.
+!
+! As a consequence, PRIOR TO ITS USE IN THE CALCULATIONS, THIS FILE HAS TO BE
+! MODIFIED. DEPENDING ON WHAT BATH GAS (DILUTANT) IS MOST ABUNDANT IN YOUR SYSTEM
+! (THE PRESENT CHOICES ARE N2, AR, OR HE),  YOU  SHOULD UNCOMMENT THE CORRESPONDING
+! BLOCK FOR THE REACTION H+O2(+M)=HO2(+M), AND COMMENT THE BLOCK FOR OTHER DILUTANT(S).
+! AS GIVEN, THE MAIN DILUTANT IS SET TO BE N2.
+!
+! 
+! HOW TO REFERENCE THIS MECHANISM:
+!
+! Li, J., Zhao, Z., Kazakov, A., and Dryer, F.L. "An Updated Comprehensive Kinetic Model
+! of Hydrogen Combustion", Int. J. Chem. Kinet. 2004 (in press).
+!
+!
+! HOW TO CONTACT THE AUTHORS:
+!
+!    Prof. Frederick L. Dryer 
+!    D-329-D Engineering Quadrangle 
+!    Mechanical and Aerospace Engineering 
+!    Princeton University 
+!    Princeton, NJ 08544-5263 
+!    Phone: 609-258-5206 
+!    Lab:    609-258-0316 
+!    FAX:    609-258-1939
+!    Email: fldryer@Princeton.EDU
+! 
+!**********************************************************************************************
+! Development notes:
+!
+!The following H2/O2 mechanism is based on Mueller et al's (Int.J.Chem.Kinet.1999,31:113)
+!Changes:
+!
+!1.update the standard heat of formation of OH at 0K to 8.85kcal/mol (Ruscic et al, 
+!  J. Phys. Chem. A, 2002, 106:2727)
+!
+!2.update the rate constant of H+O2=O+OH as proposed by Hessler (J. Phys. Chem. A, 1998,
+!  102:4517)
+!
+!3.update the low-pressure-limit rate constant of H+O2(+M)=HO2(+M) with bath gases: H2, 
+!  O2, N2, AR, HE, H2O as proposed by Michael et al (J. Phys. Chem. A, 2002,106:5297).
+!  The third-body efficiency of H2, O2, and H2O are taken as the average value over 
+!  the temperature range of 300-3000K. 
+!  The Fc in Troe's form with N2 and AR/HE as bath gas are different, so the fall-off 
+!  kinetics is expressed in two sets, for N2 and AR/HE, respectively.
+! 
+!4.for all other recombination reactions, assume the third-body efficiency of HE is
+!  the same as AR.
+!
+!5.modify the A factor of the rate constant of H+OH+M=H2O+M to 3.8E+22.
+!
+!END OF NOTES
+!**********************************************************************************************
+ELEMENTS
+H O N
+END
+!C AR HE
+
+SPECIES
+H2 O2 H2O H O OH HO2 H2O2 N2
+END
+! AR HE CO CO2
+
+THERMO ALL
+300.0 1000.0 5000.0
+H                 120186H   1               G  0300.00   5000.00  1000.00      1
+ 2.50000000E+00 0.00000000E+00 0.00000000E+00 0.00000000E+00 0.00000000E+00    2
+ 2.54716270E+04-4.60117638E-01 2.50000000E+00 0.00000000E+00 0.00000000E+00    3
+ 0.00000000E+00 0.00000000E+00 2.54716270E+04-4.60117608E-01                   4
+O                 120186O   1               G  0300.00   5000.00  1000.00      1
+ 2.54205966E+00-2.75506191E-05-3.10280335E-09 4.55106742E-12-4.36805150E-16    2
+ 2.92308027E+04 4.92030811E+00 2.94642878E+00-1.63816649E-03 2.42103170E-06    3
+-1.60284319E-09 3.89069636E-13 2.91476445E+04 2.96399498E+00                   4
+OH                S 9/01O   1H   1    0    0G   200.000  6000.000 1000.        1
+ 2.86472886E+00 1.05650448E-03-2.59082758E-07 3.05218674E-11-1.33195876E-15    2
+ 3.68362875E+03 5.70164073E+00 4.12530561E+00-3.22544939E-03 6.52764691E-06    3
+-5.79853643E-09 2.06237379E-12 3.34630913E+03-6.90432960E-01 4.51532273E+03    4
+H2                121286H   2               G  0300.00   5000.00  1000.00      1
+ 2.99142337E+00 7.00064411E-04-5.63382869E-08-9.23157818E-12 1.58275179E-15    2
+-8.35033997E+02-1.35511017E+00 3.29812431E+00 8.24944174E-04-8.14301529E-07    3
+-9.47543433E-11 4.13487224E-13-1.01252087E+03-3.29409409E+00                   4
+O2                121386O   2               G  0300.00   5000.00  1000.00      1
+ 3.69757819E+00 6.13519689E-04-1.25884199E-07 1.77528148E-11-1.13643531E-15    2
+-1.23393018E+03 3.18916559E+00 3.21293640E+00 1.12748635E-03-5.75615047E-07    3
+ 1.31387723E-09-8.76855392E-13-1.00524902E+03 6.03473759E+00                   4
+H2O                20387H   2O   1          G  0300.00   5000.00  1000.00      1
+ 2.67214561E+00 3.05629289E-03-8.73026011E-07 1.20099639E-10-6.39161787E-15    2
+-2.98992090E+04 6.86281681E+00 3.38684249E+00 3.47498246E-03-6.35469633E-06    3
+ 6.96858127E-09-2.50658847E-12-3.02081133E+04 2.59023285E+00                   4
+HO2               L 5/89H   1O   2   00   00G   200.000  3500.000  1000.000    1
+ 4.01721090E+00 2.23982013E-03-6.33658150E-07 1.14246370E-10-1.07908535E-14    2
+ 1.11856713E+02 3.78510215E+00 4.30179801E+00-4.74912051E-03 2.11582891E-05    3
+-2.42763894E-08 9.29225124E-12 2.94808040E+02 3.71666245E+00 1.00021620E+04    4
+H2O2              120186H   2O   2          G  0300.00   5000.00  1000.00      1
+ 4.57316685E+00 4.33613639E-03-1.47468882E-06 2.34890357E-10-1.43165356E-14    2
+-1.80069609E+04 5.01136959E-01 3.38875365E+00 6.56922581E-03-1.48501258E-07    3
+-4.62580552E-09 2.47151475E-12-1.76631465E+04 6.78536320E+00                   4
+N2                121286N   2               G  0300.00   5000.00  1000.00      1
+ 0.02926640E+02 0.01487977E-01-0.05684761E-05 0.01009704E-08-0.06753351E-13    2
+-0.09227977E+04 0.05980528E+02 0.03298677E+02 0.01408240E-01-0.03963222E-04    3
+ 0.05641515E-07-0.02444855E-10-0.01020900E+05 0.03950372E+02                   4
+END
+
+!AR                120186AR  1               G  0300.00   5000.00  1000.00      1
+! 0.02500000E+02 0.00000000E+00 0.00000000E+00 0.00000000E+00 0.00000000E+00    2
+!-0.07453750E+04 0.04366001E+02 0.02500000E+02 0.00000000E+00 0.00000000E+00    3
+! 0.00000000E+00 0.00000000E+00-0.07453750E+04 0.04366001E+02                   4
+!HE                120186HE  1               G  0300.00   5000.00  1000.00      1
+! 0.02500000E+02 0.00000000E+00 0.00000000E+00 0.00000000E+00 0.00000000E+00    2
+!-0.07453750E+04 0.09153489E+01 0.02500000E+02 0.00000000E+00 0.00000000E+00    3
+! 0.00000000E+00 0.00000000E+00-0.07453750E+04 0.09153488E+01                   4
+!CO                121286C   1O   1          G  0300.00   5000.00  1000.00      1
+! 0.03025078E+02 0.01442689E-01-0.05630828E-05 0.01018581E-08-0.06910952E-13    2
+!-0.01426835E+06 0.06108218E+02 0.03262452E+02 0.01511941E-01-0.03881755E-04    3
+! 0.05581944E-07-0.02474951E-10-0.01431054E+06 0.04848897E+02                   4
+!CO2               121286C   1O   2          G  0300.00   5000.00  1000.00      1
+! 0.04453623E+02 0.03140169E-01-0.01278411E-04 0.02393997E-08-0.01669033E-12    2
+!-0.04896696E+06-0.09553959E+01 0.02275725E+02 0.09922072E-01-0.01040911E-03    3
+! 0.06866687E-07-0.02117280E-10-0.04837314E+06 0.01018849E+03                   4
+
+
+REACTIONS
+
+!H2-O2 Chain Reactions
+
+! Hessler, J. Phys. Chem. A, 102:4517 (1998)
+H+O2=O+OH                 3.547e+15 -0.406  1.6599E+4
+
+! Sutherland et al., 21st Symposium, p. 929 (1986)
+O+H2=H+OH                 0.508E+05  2.67  0.629E+04   
+
+! Michael and Sutherland, J. Phys. Chem. 92:3853 (1988)
+H2+OH=H2O+H               0.216E+09  1.51  0.343E+04
+
+! Sutherland et al., 23rd Symposium, p. 51 (1990)
+O+H2O=OH+OH               2.97e+06   2.02  1.34e+4
+
+
+!H2-O2 Dissociation Reactions
+
+! Tsang and Hampson, J. Phys. Chem. Ref. Data, 15:1087 (1986)
+H2+M=H+H+M                4.577E+19 -1.40  1.0438E+05
+   H2/2.5/ H2O/12/
+!   CO/1.9/ CO2/3.8/
+!   AR/0.0/ HE/0.0/
+
+! Tsang and Hampson, J. Phys. Chem. Ref. Data, 15:1087 (1986)
+!H2+AR=H+H+AR              5.84e18   -1.1   1.0438E+05 			
+
+!H2+HE=H+H+HE              5.84e18   -1.1   1.0438E+05
+
+! Tsang and Hampson, J. Phys. Chem. Ref. Data, 15:1087 (1986)
+O+O+M=O2+M                6.165E+15 -0.50  0.000E+00 
+   H2/2.5/ H2O/12/
+!   AR/0.0/  HE/0.0/
+!   CO/1.9/ CO2/3.8/
+
+! Tsang and Hampson, J. Phys. Chem. Ref. Data, 15:1087 (1986)
+!O+O+AR=O2+AR              1.886E+13 0.00  -1.788E+03
+
+!O+O+HE=O2+HE              1.886E+13 0.00  -1.788E+03
+
+! Tsang and Hampson, J. Phys. Chem. Ref. Data, 15:1087 (1986)
+O+H+M=OH+M                4.714E+18 -1.00  0.000E+00
+   H2/2.5/ H2O/12/
+!   AR/0.75/ HE/0.75/
+!   CO/1.9/ CO2/3.8/
+
+! Tsang and Hampson, J. Phys. Chem. Ref. Data, 15:1087 (1986)
+!H+OH+M=H2O+M              2.212E+22 -2.00  0.000E+00
+H+OH+M=H2O+M               3.800E+22 -2.00  0.000E+00  
+   H2/2.5/ H2O/12/   
+!   AR/0.38/ HE/0.38/  
+!   CO/1.9/ CO2/3.8/
+
+
+!Formation and Consumption of HO2
+
+! Cobos et al., J. Phys. Chem. 89:342 (1985) for kinf
+! Michael, et al., J. Phys. Chem. A, 106:5297 (2002) for k0
+
+!******************************************************************************
+! MAIN BATH GAS IS N2 (comment this reaction otherwise)
+!
+H+O2(+M)=HO2(+M)      1.475E+12  0.60  0.00E+00
+    LOW/6.366E+20  -1.72  5.248E+02/
+    TROE/0.8  1E-30  1E+30/
+    H2/2.0/ H2O/11./ O2/0.78/
+!CO/1.9/ CO2/3.8/
+    
+!******************************************************************************
+! MAIN BATH GAS IS AR OR HE (comment this reaction otherwise)
+!
+!H+O2(+M)=HO2(+M)      1.475E+12  0.60  0.00E+00
+!    LOW/9.042E+19  -1.50  4.922E+02/
+!    TROE/0.5 1E-30  1E+30/
+!    H2/3.0/ H2O/16/ O2/1.1/ CO/2.7/ CO2/5.4/ HE/1.2/
+
+! Tsang and Hampson, J. Phys. Chem. Ref. Data, 15:1087 (1986) [modified]
+HO2+H=H2+O2               1.66E+13   0.00   0.823E+03
+
+! Tsang and Hampson, J. Phys. Chem. Ref. Data, 15:1087 (1986) [modified]
+HO2+H=OH+OH               7.079E+13   0.00   2.95E+02
+
+! Baulch et al., J. Phys. Chem. Ref Data, 21:411 (1992)
+HO2+O=O2+OH               0.325E+14  0.00   0.00E+00   
+
+! Keyser, J. Phys. Chem. 92:1193 (1988)
+HO2+OH=H2O+O2             2.890E+13  0.00 -4.970E+02
+
+
+!Formation and Consumption of H2O2
+
+! Hippler et al., J. Chem. Phys. 93:1755 (1990)
+HO2+HO2=H2O2+O2            4.200e+14  0.00  1.1982e+04
+  DUPLICATE
+HO2+HO2=H2O2+O2            1.300e+11  0.00 -1.6293e+3
+  DUPLICATE
+
+! Brouwer et al., J. Chem. Phys. 86:6171 (1987) for kinf
+! Warnatz, J. in Combustion chemistry (1984) for k0
+H2O2(+M)=OH+OH(+M)         2.951e+14   0.00  4.843E+04 
+  LOW/1.202E+17  0.00  4.55E+04/
+  TROE/0.5 1E-30 1E+30/
+  H2/2.5/ H2O/12/          
+!  CO/1.9/ CO2/3.8/
+!  AR/0.64/ HE/0.64/
+
+! Tsang and Hampson, J. Phys. Chem. Ref. Data, 15:1087 (1986)
+H2O2+H=H2O+OH             0.241E+14  0.00  0.397E+04
+
+! Tsang and Hampson, J. Phys. Chem. Ref. Data, 15:1087 (1986)
+H2O2+H=HO2+H2             0.482E+14  0.00  0.795E+04  
+
+! Tsang and Hampson, J. Phys. Chem. Ref. Data, 15:1087 (1986)
+H2O2+O=OH+HO2 		  9.550E+06  2.00  3.970E+03 
+
+! Hippler and Troe, J. Chem. Phys. Lett. 192:333 (1992)
+H2O2+OH=HO2+H2O           1.000E+12  0.00  0.000	
+    DUPLICATE 
+H2O2+OH=HO2+H2O           5.800E+14  0.00  9.557E+03
+    DUPLICATE
+
+END
+
+\\
+\\
+\\  This is the therm file
+\\
+\\
+THERMO ALL
+300.0 1000.0 5000.0
+H                 120186H   1               G  0300.00   5000.00  1000.00      1
+ 2.50000000E+00 0.00000000E+00 0.00000000E+00 0.00000000E+00 0.00000000E+00    2
+ 2.54716270E+04-4.60117638E-01 2.50000000E+00 0.00000000E+00 0.00000000E+00    3
+ 0.00000000E+00 0.00000000E+00 2.54716270E+04-4.60117608E-01                   4
+O                 120186O   1               G  0300.00   5000.00  1000.00      1
+ 2.54205966E+00-2.75506191E-05-3.10280335E-09 4.55106742E-12-4.36805150E-16    2
+ 2.92308027E+04 4.92030811E+00 2.94642878E+00-1.63816649E-03 2.42103170E-06    3
+-1.60284319E-09 3.89069636E-13 2.91476445E+04 2.96399498E+00                   4
+OH                S 9/01O   1H   1    0    0G   200.000  6000.000 1000.        1
+ 2.86472886E+00 1.05650448E-03-2.59082758E-07 3.05218674E-11-1.33195876E-15    2
+ 3.68362875E+03 5.70164073E+00 4.12530561E+00-3.22544939E-03 6.52764691E-06    3
+-5.79853643E-09 2.06237379E-12 3.34630913E+03-6.90432960E-01 4.51532273E+03    4
+H2                121286H   2               G  0300.00   5000.00  1000.00      1
+ 2.99142337E+00 7.00064411E-04-5.63382869E-08-9.23157818E-12 1.58275179E-15    2
+-8.35033997E+02-1.35511017E+00 3.29812431E+00 8.24944174E-04-8.14301529E-07    3
+-9.47543433E-11 4.13487224E-13-1.01252087E+03-3.29409409E+00                   4
+O2                121386O   2               G  0300.00   5000.00  1000.00      1
+ 3.69757819E+00 6.13519689E-04-1.25884199E-07 1.77528148E-11-1.13643531E-15    2
+-1.23393018E+03 3.18916559E+00 3.21293640E+00 1.12748635E-03-5.75615047E-07    3
+ 1.31387723E-09-8.76855392E-13-1.00524902E+03 6.03473759E+00                   4
+H2O                20387H   2O   1          G  0300.00   5000.00  1000.00      1
+ 2.67214561E+00 3.05629289E-03-8.73026011E-07 1.20099639E-10-6.39161787E-15    2
+-2.98992090E+04 6.86281681E+00 3.38684249E+00 3.47498246E-03-6.35469633E-06    3
+ 6.96858127E-09-2.50658847E-12-3.02081133E+04 2.59023285E+00                   4
+HO2               L 5/89H   1O   2   00   00G   200.000  3500.000  1000.000    1
+ 4.01721090E+00 2.23982013E-03-6.33658150E-07 1.14246370E-10-1.07908535E-14    2
+ 1.11856713E+02 3.78510215E+00 4.30179801E+00-4.74912051E-03 2.11582891E-05    3
+-2.42763894E-08 9.29225124E-12 2.94808040E+02 3.71666245E+00 1.00021620E+04    4
+H2O2              120186H   2O   2          G  0300.00   5000.00  1000.00      1
+ 4.57316685E+00 4.33613639E-03-1.47468882E-06 2.34890357E-10-1.43165356E-14    2
+-1.80069609E+04 5.01136959E-01 3.38875365E+00 6.56922581E-03-1.48501258E-07    3
+-4.62580552E-09 2.47151475E-12-1.76631465E+04 6.78536320E+00                   4
+N2                121286N   2               G  0300.00   5000.00  1000.00      1
+ 0.02926640E+02 0.01487977E-01-0.05684761E-05 0.01009704E-08-0.06753351E-13    2
+-0.09227977E+04 0.05980528E+02 0.03298677E+02 0.01408240E-01-0.03963222E-04    3
+ 0.05641515E-07-0.02444855E-10-0.01020900E+05 0.03950372E+02                   4
+END
+
+\\
+\\
+\\  This is the tran file
+\\
+\\
+                                                                                
+AR                 0   136.500     3.330     0.000     0.000     0.000          
+C                  0    71.400     3.298     0.000     0.000     0.000 ! *      
+CH                 1    80.000     2.750     0.000     0.000     0.000          
+CH2                1   144.000     3.800     0.000     0.000     0.000          
+CH2*               1   144.000     3.800     0.000     0.000     0.000          
+CH3                1   144.000     3.800     0.000     0.000     0.000          
+CH4                2   141.400     3.746     0.000     2.600    13.000          
+CO                 1    98.100     3.650     0.000     1.950     1.800          
+CO2                1   244.000     3.763     0.000     2.650     2.100          
+HCO                2   498.000     3.590     0.000     0.000     0.000          
+CH2O               2   498.000     3.590     0.000     0.000     2.000          
+CH2OH              2   417.000     3.690     1.700     0.000     2.000          
+CH3O               2   417.000     3.690     1.700     0.000     2.000          
+CH3OH              2   481.800     3.626     0.000     0.000     1.000 ! SVE    
+                                                                                
+C2                 1    97.530     3.621     0.000     1.760     4.000          
+C2O                1   232.400     3.828     0.000     0.000     1.000 ! *      
+C2H                1   209.000     4.100     0.000     0.000     2.500          
+C2H2               1   209.000     4.100     0.000     0.000     2.500          
+H2CC               2   209.000     4.100     0.000     0.000     2.500
+C2H3               2   209.000     4.100     0.000     0.000     1.000 ! *      
+C2H4               2   280.800     3.971     0.000     0.000     1.500          
+C2H5               2   252.300     4.302     0.000     0.000     1.500          
+C2H6               2   252.300     4.302     0.000     0.000     1.500          
+HCCO               2   150.000     2.500     0.000     0.000     1.000 ! *      
+HCCOH              2   436.000     3.970     0.000     0.000     2.000          
+CH2CO              2   436.000     3.970     0.000     0.000     2.000          
+CH2CHO             2   436.000     3.970     0.000     0.000     2.000          
+C2H2OH             2   224.700     4.162     0.000     0.000     1.000 ! *      
+                                                                                
+C3H2               2   209.000     4.100     0.000     0.000     1.000 ! *      
+C3H3               2   252.000     4.760     0.000     0.000     1.000 ! JAM    
+aC3H4              1   252.000     4.760     0.000     0.000     1.000          
+pC3H4              1   252.000     4.760     0.000     0.000     1.000          
+cC3H4              1   252.000     4.760     0.000     0.000     1.000
+                                                                                
+C4H                1   357.000     5.180     0.000     0.000     1.000          
+C4H2               1   357.000     5.180     0.000     0.000     1.000          
+H2C4O              2   357.000     5.180     0.000     0.000     1.000 ! JAM    
+C4H2OH             2   224.700     4.162     0.000     0.000     1.000 ! *      
+i-C4H3             2   357.000     5.180     0.000     0.000     1.000 ! JAM    
+n-C4H3             2   357.000     5.180     0.000     0.000     1.000 ! JAM    
+C4H4               2   357.000     5.180     0.000     0.000     1.000 ! JAM    
+i-C4H5             2   357.000     5.180     0.000     0.000     1.000 ! JAM    
+n-C4H5             2   357.000     5.180     0.000     0.000     1.000 ! JAM    
+C4H6               2   357.000     5.180     0.000     0.000     1.000         
+C4H612             2   357.000     5.180     0.000     0.000     1.000 
+                                                                                
+C5H2               1   357.000     5.180     0.000     0.000     1.000          
+C5H3               1   357.000     5.180     0.000     0.000     1.000          
+C5H5               1   357.000     5.180     0.000     0.000     1.000          
+C5H6               1   357.000     5.180     0.000     0.000     1.000          
+                                                                                
+C6H                1   357.000     5.180     0.000     0.000     1.000          
+C6H2               1   357.000     5.180     0.000     0.000     1.000          
+C6H3               2   357.000     5.180     0.000     0.000     1.000  !       
+l-C6H4             2   412.300     5.349     0.000     0.000     1.000  !(JAM)  
+n-C6H5             2   412.300     5.349     0.000     0.000     1.000  !(JAM)  
+i-C6H5             2   412.300     5.349     0.000     0.000     1.000  !(JAM)  
+l-C6H6             2   412.300     5.349     0.000     0.000     1.000  !(SVE)  
+n-C6H7             2   412.300     5.349     0.000     0.000     1.000  !(JAM)  
+i-C6H7             2   412.300     5.349     0.000     0.000     1.000  !(JAM)  
+C6H8               2   412.300     5.349     0.000     0.000     1.000  !(JAM)  
+                                                                                
+HE                 0    10.200     2.576     0.000     0.000     0.000 ! *      
+H                  0   145.000     2.050     0.000     0.000     0.000          
+H2                 1    38.000     2.920     0.000     0.790   280.000          
+H2O                2   572.400     2.605     1.844     0.000     4.000          
+H2O2               2   107.400     3.458     0.000     0.000     3.800          
+HO2                2   107.400     3.458     0.000     0.000     1.000 ! *      
+N2                 1    97.530     3.621     0.000     1.760     4.000          
+O                  0    80.000     2.750     0.000     0.000     0.000          
+O2                 1   107.400     3.458     0.000     1.600     3.800          
+OH                 1    80.000     2.750     0.000     0.000     0.000          
+                                                                                
+                                                                                
+The Lennard-Jones parameters of polycyclic aromatic hydrocarbons were estimated 
+based on the critical temperature and pressure. See H. Wang and M. Frenklach,   
+"Transport Properties of Polycyclic Aromatic Hydrocarbons for Flame Modeling."  
+Combustion and Flame, 96:163-170 (1994)                                         
+                                                                                
+c-C6H4             2   464.8       5.29      0.00     10.32      0.000  !  benze
+A1                 2   464.8       5.29      0.00     10.32      0.000  !  benze
+A1-                2   464.8       5.29      0.00     10.32      0.000  !  benze
+c-C6H7             2   464.8       5.29      0.00     10.32      0.000  !  benze
+C5H4O              2   464.8       5.29      0.00     10.32      0.000  !  benze
+C5H5O              2   464.8       5.29      0.00     10.32      0.000  !  benze
+C5H4OH             2   464.8       5.29      0.00     10.32      0.000  !  benze
+C6H5O              2   464.8       5.29      0.00     10.32      0.000  !  benze
+C6H5OH             2   464.8       5.29      0.00     10.32      0.000  !  benze
+
+aC3H5              2   266.800     4.982     0.000     0.000     1.000
+CH3CCH2            2   266.800     4.982     0.000     0.000     1.000
+CH3CHCH            2   266.800     4.982     0.000     0.000     1.000
+C3H6               2   266.800     4.982     0.000     0.000     1.000
+C3H7               2   266.800     4.982     0.000     0.000     1.000
+C4H6               2   357.000     5.180     0.000     0.000     1.000
+iC3H7              2   266.800     4.982     0.000     0.000     1.000
+nC3H7              2   266.800     4.982     0.000     0.000     1.000
+C3H8               2   266.800     4.982     0.000     0.000     1.000
+C4H                1   357.000     5.180     0.000     0.000     1.000
+C4H2               1   357.000     5.180     0.000     0.000     1.000
+C4H2OH             2   224.700     4.162     0.000     0.000     1.000 ! *
+iC4H5              2   357.000     5.176     0.000     0.000     1.000
+C4H6               2   357.000     5.176     0.000     0.000     1.000
+C4H7               2   357.000     5.176     0.000     0.000     1.000
+iC4H7              2   357.000     5.176     0.000     0.000     1.000
+C4H81              2   357.000     5.176     0.000     0.000     1.000
+C4H82              2   357.000     5.176     0.000     0.000     1.000
+iC4H8              2   357.000     5.176     0.000     0.000     1.000
+tC4H9              2   357.000     5.176     0.000     0.000     1.000
+iC4H9              2   357.000     5.176     0.000     0.000     1.000
+pC4H9              2   357.000     5.176     0.000     0.000     1.000
+sC4H9              2   357.000     5.176     0.000     0.000     1.000
+C4H10              2   357.000     5.176     0.000     0.000     1.000
+iC4H10             2   357.000     5.176     0.000     0.000     1.000
+CH3COCH3           2   357.000     5.176     0.000     0.000     1.000
+C2H3CHO            2   357.000     5.176     0.000     0.000     1.000
+iC4H7O             2   450.000     5.500     0.000     0.000     1.000 ! JAM
+CH3CHO             2   436.000     3.970     0.000     0.000     2.000
+CH3CO              2   436.000     3.970     0.000     0.000     2.000
+                                                                                
+ 1-15: Species name                                                             
+ 16-80: Molecular parameters                                                    
+        molecule index: 0 = atom, 1= linear molec.                              
+                        2 = nonlinear molec.                                    
+        L-J potential well depth, e/kb (K)                                      
+        L-J collision diameter, s,                                             
+        Dipole moment, f, Debye                                                 
+        Polarizability, `, 2                                                   
+        Rotational relaxation number, Zrot at 298K                              
+        Comments                                                                
+                                                                                
+
+#endif
@@ -15,7 +15,22 @@ CHEMC=chem.c
 TRANLOG=tran.log
 HEADERDIR=${CHEMTOOLSDIR}/../data/header
 
-python ${FMC} -mechanism=${CHEMINP} -thermo=${THERMINP} -name=${CHEMC}
+# KERNEL=tables writes LiDryer_tables.c for CHEMISTRY_KERNEL=TABLES instead
+KERNEL=${KERNEL:-unrolled}
+if [ ${KERNEL} = tables ]; then
+  FINALFILE=${FINALFILE%.c}_tables.c
+fi
+
+# SPLIT=N writes LiDryer.h and LiDryer_*.c instead (fmc.py -split=N, build
+# with CHEMISTRY_SPLIT=TRUE); the transport data goes into LiDryer_params.c
+SPLIT=${SPLIT:-0}
+if [ ${SPLIT} -gt 0 ]; then
+  python ${FMC} -mechanism=${CHEMINP} -thermo=${THERMINP} -name=${FINALFILE} -split=${SPLIT} -kernel=${KERNEL}
+  FINALFILE=${FINALFILE%.c}_params.c
+  mv ${FINALFILE} ${CHEMC}
+else
+  python ${FMC} -mechanism=${CHEMINP} -thermo=${THERMINP} -name=${CHEMC} -kernel=${KERNEL}
+fi
 echo Compiling ${FINALFILE}...
 echo " &files"  > model_files.dat
 echo "   CHEMKIN_input = \"$CHEMINP\"" >> model_files.dat
@@ -1,5 +1,6 @@
 
 #include <math.h>
+#include <float.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -86,7 +87,14 @@
 #define VCKPY VCKPY
 #define VCKWYR VCKWYR
 #define VCKYTX VCKYTX
+#define VCKCPBS VCKCPBS
+#define VCKCVBS VCKCVBS
+#define VCKHBMS VCKHBMS
+#define VCKUBMS VCKUBMS
+#define VCKRHOY VCKRHOY
+#define VCKMMWY VCKMMWY
 #define GET_T_GIVEN_EY GET_T_GIVEN_EY
+#define GET_T_GIVEN_HY GET_T_GIVEN_HY
 #define GET_REACTION_MAP GET_REACTION_MAP
 #elif defined(BL_FORT_USE_LOWERCASE)
 #define CKINDX ckindx
@@ -170,7 +178,14 @@
 #define VCKPY vckpy
 #define VCKWYR vckwyr
 #define VCKYTX vckytx
+#define VCKCPBS vckcpbs
+#define VCKCVBS vckcvbs
+#define VCKHBMS vckhbms
+#define VCKUBMS vckubms
+#define VCKRHOY vckrhoy
+#define VCKMMWY vckmmwy
 #define GET_T_GIVEN_EY get_t_given_ey
+#define GET_T_GIVEN_HY get_t_given_hy
 #define GET_REACTION_MAP get_reaction_map
 #elif defined(BL_FORT_USE_UNDERSCORE)
 #define CKINDX ckindx_
@@ -254,7 +269,14 @@
 #define VCKPY vckpy_
 #define VCKWYR vckwyr_
 #define VCKYTX vckytx_
+#define VCKCPBS vckcpbs_
+#define VCKCVBS vckcvbs_
+#define VCKHBMS vckhbms_
+#define VCKUBMS vckubms_
+#define VCKRHOY vckrhoy_
+#define VCKMMWY vckmmwy_
 #define GET_T_GIVEN_EY get_t_given_ey_
+#define GET_T_GIVEN_HY get_t_given_hy_
 #define GET_REACTION_MAP get_reaction_map_
 #endif
 
@@ -356,6 +378,7 @@ void DWDOT(double * restrict J, double * restrict sc, double * restrict T, int *
 void aJacobian(double * restrict J, double * restrict sc, double T, int consP);
 void dcvpRdT(double * restrict species, double * restrict tc);
 void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
+void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
 void GET_REACTION_MAP(int * restrict rmap);
 /*vector version */
 void vproductionRate(int npt, double * restrict wdot, double * restrict c, double * restrict T);
@@ -365,6 +388,12 @@ void VCKWYR(int * restrict np, double * restrict rho, double * restrict T,
             double * restrict y, int * restrict iwrk, double * restrict rwrk,
             double * restrict wdot);
 void VCKYTX(int * restrict np, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict x);
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs);
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs);
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms);
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms);
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho);
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm);
 void vcomp_k_f(int npt, double * restrict k_f_s, double * restrict tc, double * restrict invT);
 void vcomp_gibbs(int npt, double * restrict g_RT, double * restrict tc);
 void vcomp_Kc(int npt, double * restrict Kc_s, double * restrict g_RT, double * restrict invT);
@@ -3164,38 +3193,6 @@ void CKINDX(int * iwrk, double * restrict rwrk, int * mm, int * kk, int * ii, in
 }
 
 
-/* strtok_r: re-entrant (threadsafe) version of strtok, helper function for tokenizing strings  */
-char *strtok_r(char *s, const char *delim, char **save_ptr)
-{
-    char *token;
-
-    if (s == NULL)
-        s = *save_ptr;
-
-    /* Scan leading delimiters.  */
-    s += strspn (s, delim);
-    if (*s == '\0')
-    {
-        *save_ptr = s;
-        return NULL;
-    }
-
-    /* Find the end of the token.  */
-    token = s;
-    s = strpbrk (token, delim);
-    if (s == NULL)
-        /* This token finishes the string.  */
-        *save_ptr = __rawmemchr (token, '\0');
-    else
-    {
-        /* Terminate the token and make *SAVE_PTR point past it.  */
-        *s = '\0';
-        *save_ptr = s + 1;
-    }
-    return token;
-}
-
-
 
 /* ckxnum... for parsing strings  */
 void CKXNUM(char * line, int * nexp, int * lout, int * nval, double * restrict rval, int * kerr, int lenline )
@@ -3789,6 +3786,28 @@ void CKRHOY(double * restrict P, double * restrict T, double * restrict y, int *
 }
 
 
+/*Compute rho = P*W(y)/RT */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho)
+{
+    for (int i=0; i<(*np); i++) {
+        rho[i] = 0.0;
+    }
+
+    for (int n=0; n<38; n++) {
+        for (int i=0; i<(*np); i++) {
+            rho[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        rho[i] = P[i] / (8.31451e+07 * T[i] * rho[i]);/*rho = P*W/(R*T) */
+    }
+
+    return;
+}
+
+
 /*Compute rho = P*W(c)/(R*T) */
 void CKRHOC(double * restrict P, double * restrict T, double * restrict c, int * iwrk, double * restrict rwrk, double * restrict rho)
 {
@@ -3879,6 +3898,29 @@ void CKMMWY(double * restrict y, int * iwrk, double * restrict rwrk, double * re
 }
 
 
+/*given y[species]: mass fractions */
+/*returns mean molecular weight (gm/mole) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm)
+{
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 0.0;
+    }
+
+    for (int n=0; n<38; n++) {
+        for (int i=0; i<(*np); i++) {
+            wtm[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 1.0 / wtm[i];
+    }
+
+    return;
+}
+
+
 /*given x[species]: mole fractions */
 /*returns mean molecular weight (gm/mole) */
 void CKMMWX(double * restrict x, int * iwrk, double * restrict rwrk, double * restrict wtm)
@@ -4793,6 +4835,30 @@ void CKCPBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CP (Eq. 34) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs)
+{
+    double tc[5], tmp[38], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cp_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<38; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cpbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean specific heat at CV (Eq. 35) */
 void CKCVBL(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict cvbl)
 {
@@ -4864,6 +4930,30 @@ void CKCVBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CV (Eq. 36) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs)
+{
+    double tc[5], tmp[38], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cv_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<38; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cvbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean enthalpy of the mixture in molar units */
 void CKHBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict hbml)
 {
@@ -4905,6 +4995,30 @@ void CKHBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns mean enthalpy of mixture in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms)
+{
+    double tc[5], tmp[38], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesEnthalpy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<38; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        hbms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mean internal energy in molar units */
 void CKUBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict ubml)
 {
@@ -4978,6 +5092,30 @@ void CKUBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*get mean internal energy in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms)
+{
+    double tc[5], tmp[38], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesInternalEnergy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<38; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        ubms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mixture entropy in molar units */
 void CKSBML(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict sbml)
 {
@@ -12463,12 +12601,250 @@ void productionRate(double * restrict wdot, double * restrict sc, double T)
 
 void comp_k_f(double * restrict tc, double invT, double * restrict k_f)
 {
+    double x[228];
+#ifdef __INTEL_COMPILER
+    #pragma simd
+#endif
+    for (int i=0; i<228; ++i) {
+        x[i] = fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT;
+    };
+
+    /*the exp is skipped when the exponent is zero or that of */
+    /*an earlier reaction with the same default beta and Ea */
+    k_f[0] = exp(x[0]);
+    k_f[1] = exp(x[1]);
+    k_f[2] = exp(x[2]);
+    k_f[3] = exp(x[3]);
+    k_f[4] = exp(x[4]);
+    k_f[5] = exp(x[5]);
+    k_f[6] = exp(x[6]);
+    k_f[7] = exp(x[7]);
+    k_f[8] = exp(x[8]);
+    k_f[9] = exp(x[9]);
+    k_f[10] = exp(x[10]);
+    k_f[11] = exp(x[11]);
+    k_f[12] = (x[12] == 0.0 ? 1.0 : exp(x[12]));
+    k_f[13] = (x[13] == 0.0 ? 1.0 : exp(x[13]));
+    k_f[14] = (x[14] == 0.0 ? 1.0 : exp(x[14]));
+    k_f[15] = (x[15] == 0.0 ? 1.0 : exp(x[15]));
+    k_f[16] = exp(x[16]);
+    k_f[17] = exp(x[17]);
+    k_f[18] = exp(x[18]);
+    k_f[19] = exp(x[19]);
+    k_f[20] = exp(x[20]);
+    k_f[21] = (x[21] == x[19] ? k_f[19] : exp(x[21]));
+    k_f[22] = exp(x[22]);
+    k_f[23] = exp(x[23]);
+    k_f[24] = exp(x[24]);
+    k_f[25] = (x[25] == 0.0 ? 1.0 : exp(x[25]));
+    k_f[26] = exp(x[26]);
+    k_f[27] = exp(x[27]);
+    k_f[28] = exp(x[28]);
+    k_f[29] = exp(x[29]);
+    k_f[30] = exp(x[30]);
+    k_f[31] = exp(x[31]);
+    k_f[32] = exp(x[32]);
+    k_f[33] = exp(x[33]);
+    k_f[34] = (x[34] == x[2] ? k_f[2] : exp(x[34]));
+    k_f[35] = exp(x[35]);
+    k_f[36] = exp(x[36]);
+    k_f[37] = exp(x[37]);
+    k_f[38] = exp(x[38]);
+    k_f[39] = exp(x[39]);
+    k_f[40] = exp(x[40]);
+    k_f[41] = (x[41] == 0.0 ? 1.0 : exp(x[41]));
+    k_f[42] = exp(x[42]);
+    k_f[43] = exp(x[43]);
+    k_f[44] = exp(x[44]);
+    k_f[45] = exp(x[45]);
+    k_f[46] = exp(x[46]);
+    k_f[47] = exp(x[47]);
+    k_f[48] = exp(x[48]);
+    k_f[49] = exp(x[49]);
+    k_f[50] = exp(x[50]);
+    k_f[51] = exp(x[51]);
+    k_f[52] = exp(x[52]);
+    k_f[53] = exp(x[53]);
+    k_f[54] = exp(x[54]);
+    k_f[55] = (x[55] == 0.0 ? 1.0 : exp(x[55]));
+    k_f[56] = (x[56] == 0.0 ? 1.0 : exp(x[56]));
+    k_f[57] = (x[57] == 0.0 ? 1.0 : exp(x[57]));
+    k_f[58] = exp(x[58]);
+    k_f[59] = exp(x[59]);
+    k_f[60] = (x[60] == 0.0 ? 1.0 : exp(x[60]));
+    k_f[61] = (x[61] == 0.0 ? 1.0 : exp(x[61]));
+    k_f[62] = exp(x[62]);
+    k_f[63] = exp(x[63]);
+    k_f[64] = exp(x[64]);
+    k_f[65] = (x[65] == 0.0 ? 1.0 : exp(x[65]));
+    k_f[66] = (x[66] == 0.0 ? 1.0 : exp(x[66]));
+    k_f[67] = (x[67] == 0.0 ? 1.0 : exp(x[67]));
+    k_f[68] = (x[68] == 0.0 ? 1.0 : exp(x[68]));
+    k_f[69] = (x[69] == 0.0 ? 1.0 : exp(x[69]));
+    k_f[70] = (x[70] == 0.0 ? 1.0 : exp(x[70]));
+    k_f[71] = (x[71] == 0.0 ? 1.0 : exp(x[71]));
+    k_f[72] = exp(x[72]);
+    k_f[73] = exp(x[73]);
+    k_f[74] = (x[74] == x[19] ? k_f[19] : exp(x[74]));
+    k_f[75] = exp(x[75]);
+    k_f[76] = exp(x[76]);
+    k_f[77] = exp(x[77]);
+    k_f[78] = (x[78] == 0.0 ? 1.0 : exp(x[78]));
+    k_f[79] = (x[79] == x[38] ? k_f[38] : exp(x[79]));
+    k_f[80] = (x[80] == 0.0 ? 1.0 : exp(x[80]));
+    k_f[81] = (x[81] == 0.0 ? 1.0 : exp(x[81]));
+    k_f[82] = exp(x[82]);
+    k_f[83] = (x[83] == x[82] ? k_f[82] : exp(x[83]));
+    k_f[84] = exp(x[84]);
+    k_f[85] = exp(x[85]);
+    k_f[86] = exp(x[86]);
+    k_f[87] = (x[87] == 0.0 ? 1.0 : exp(x[87]));
+    k_f[88] = (x[88] == 0.0 ? 1.0 : exp(x[88]));
+    k_f[89] = (x[89] == 0.0 ? 1.0 : exp(x[89]));
+    k_f[90] = exp(x[90]);
+    k_f[91] = (x[91] == 0.0 ? 1.0 : exp(x[91]));
+    k_f[92] = (x[92] == 0.0 ? 1.0 : exp(x[92]));
+    k_f[93] = (x[93] == 0.0 ? 1.0 : exp(x[93]));
+    k_f[94] = (x[94] == 0.0 ? 1.0 : exp(x[94]));
+    k_f[95] = (x[95] == 0.0 ? 1.0 : exp(x[95]));
+    k_f[96] = (x[96] == 0.0 ? 1.0 : exp(x[96]));
+    k_f[97] = (x[97] == 0.0 ? 1.0 : exp(x[97]));
+    k_f[98] = (x[98] == 0.0 ? 1.0 : exp(x[98]));
+    k_f[99] = (x[99] == 0.0 ? 1.0 : exp(x[99]));
+    k_f[100] = (x[100] == 0.0 ? 1.0 : exp(x[100]));
+    k_f[101] = (x[101] == 0.0 ? 1.0 : exp(x[101]));
+    k_f[102] = (x[102] == 0.0 ? 1.0 : exp(x[102]));
+    k_f[103] = (x[103] == 0.0 ? 1.0 : exp(x[103]));
+    k_f[104] = (x[104] == 0.0 ? 1.0 : exp(x[104]));
+    k_f[105] = exp(x[105]);
+    k_f[106] = exp(x[106]);
+    k_f[107] = exp(x[107]);
+    k_f[108] = (x[108] == 0.0 ? 1.0 : exp(x[108]));
+    k_f[109] = (x[109] == 0.0 ? 1.0 : exp(x[109]));
+    k_f[110] = (x[110] == 0.0 ? 1.0 : exp(x[110]));
+    k_f[111] = (x[111] == 0.0 ? 1.0 : exp(x[111]));
+    k_f[112] = exp(x[112]);
+    k_f[113] = exp(x[113]);
+    k_f[114] = exp(x[114]);
+    k_f[115] = exp(x[115]);
+    k_f[116] = (x[116] == 0.0 ? 1.0 : exp(x[116]));
+    k_f[117] = exp(x[117]);
+    k_f[118] = (x[118] == 0.0 ? 1.0 : exp(x[118]));
+    k_f[119] = (x[119] == 0.0 ? 1.0 : exp(x[119]));
+    k_f[120] = exp(x[120]);
+    k_f[121] = exp(x[121]);
+    k_f[122] = exp(x[122]);
+    k_f[123] = exp(x[123]);
+    k_f[124] = exp(x[124]);
+    k_f[125] = exp(x[125]);
+    k_f[126] = exp(x[126]);
+    k_f[127] = exp(x[127]);
+    k_f[128] = exp(x[128]);
+    k_f[129] = exp(x[129]);
+    k_f[130] = exp(x[130]);
+    k_f[131] = exp(x[131]);
+    k_f[132] = exp(x[132]);
+    k_f[133] = exp(x[133]);
+    k_f[134] = exp(x[134]);
+    k_f[135] = exp(x[135]);
+    k_f[136] = exp(x[136]);
+    k_f[137] = exp(x[137]);
+    k_f[138] = exp(x[138]);
+    k_f[139] = (x[139] == x[73] ? k_f[73] : exp(x[139]));
+    k_f[140] = (x[140] == 0.0 ? 1.0 : exp(x[140]));
+    k_f[141] = (x[141] == 0.0 ? 1.0 : exp(x[141]));
+    k_f[142] = (x[142] == 0.0 ? 1.0 : exp(x[142]));
+    k_f[143] = exp(x[143]);
+    k_f[144] = exp(x[144]);
+    k_f[145] = (x[145] == 0.0 ? 1.0 : exp(x[145]));
+    k_f[146] = (x[146] == 0.0 ? 1.0 : exp(x[146]));
+    k_f[147] = (x[147] == 0.0 ? 1.0 : exp(x[147]));
+    k_f[148] = (x[148] == 0.0 ? 1.0 : exp(x[148]));
+    k_f[149] = (x[149] == 0.0 ? 1.0 : exp(x[149]));
+    k_f[150] = exp(x[150]);
+    k_f[151] = exp(x[151]);
+    k_f[152] = exp(x[152]);
+    k_f[153] = exp(x[153]);
+    k_f[154] = exp(x[154]);
+    k_f[155] = exp(x[155]);
+    k_f[156] = exp(x[156]);
+    k_f[157] = exp(x[157]);
+    k_f[158] = exp(x[158]);
+    k_f[159] = exp(x[159]);
+    k_f[160] = exp(x[160]);
+    k_f[161] = exp(x[161]);
+    k_f[162] = exp(x[162]);
+    k_f[163] = exp(x[163]);
+    k_f[164] = exp(x[164]);
+    k_f[165] = exp(x[165]);
+    k_f[166] = (x[166] == 0.0 ? 1.0 : exp(x[166]));
+    k_f[167] = (x[167] == 0.0 ? 1.0 : exp(x[167]));
+    k_f[168] = (x[168] == 0.0 ? 1.0 : exp(x[168]));
+    k_f[169] = (x[169] == 0.0 ? 1.0 : exp(x[169]));
+    k_f[170] = (x[170] == 0.0 ? 1.0 : exp(x[170]));
+    k_f[171] = (x[171] == 0.0 ? 1.0 : exp(x[171]));
+    k_f[172] = exp(x[172]);
+    k_f[173] = exp(x[173]);
+    k_f[174] = exp(x[174]);
+    k_f[175] = exp(x[175]);
+    k_f[176] = exp(x[176]);
+    k_f[177] = (x[177] == x[176] ? k_f[176] : exp(x[177]));
+    k_f[178] = exp(x[178]);
+    k_f[179] = exp(x[179]);
+    k_f[180] = (x[180] == 0.0 ? 1.0 : exp(x[180]));
+    k_f[181] = (x[181] == 0.0 ? 1.0 : exp(x[181]));
+    k_f[182] = exp(x[182]);
+    k_f[183] = exp(x[183]);
+    k_f[184] = exp(x[184]);
+    k_f[185] = (x[185] == 0.0 ? 1.0 : exp(x[185]));
+    k_f[186] = (x[186] == 0.0 ? 1.0 : exp(x[186]));
+    k_f[187] = (x[187] == 0.0 ? 1.0 : exp(x[187]));
+    k_f[188] = (x[188] == 0.0 ? 1.0 : exp(x[188]));
+    k_f[189] = exp(x[189]);
+    k_f[190] = exp(x[190]);
+    k_f[191] = exp(x[191]);
+    k_f[192] = (x[192] == 0.0 ? 1.0 : exp(x[192]));
+    k_f[193] = exp(x[193]);
+    k_f[194] = (x[194] == 0.0 ? 1.0 : exp(x[194]));
+    k_f[195] = exp(x[195]);
+    k_f[196] = (x[196] == x[195] ? k_f[195] : exp(x[196]));
+    k_f[197] = exp(x[197]);
+    k_f[198] = exp(x[198]);
+    k_f[199] = exp(x[199]);
+    k_f[200] = (x[200] == 0.0 ? 1.0 : exp(x[200]));
+    k_f[201] = (x[201] == 0.0 ? 1.0 : exp(x[201]));
+    k_f[202] = (x[202] == 0.0 ? 1.0 : exp(x[202]));
+    k_f[203] = (x[203] == 0.0 ? 1.0 : exp(x[203]));
+    k_f[204] = (x[204] == 0.0 ? 1.0 : exp(x[204]));
+    k_f[205] = exp(x[205]);
+    k_f[206] = (x[206] == 0.0 ? 1.0 : exp(x[206]));
+    k_f[207] = (x[207] == 0.0 ? 1.0 : exp(x[207]));
+    k_f[208] = exp(x[208]);
+    k_f[209] = exp(x[209]);
+    k_f[210] = exp(x[210]);
+    k_f[211] = exp(x[211]);
+    k_f[212] = (x[212] == x[165] ? k_f[165] : exp(x[212]));
+    k_f[213] = (x[213] == x[165] ? k_f[165] : exp(x[213]));
+    k_f[214] = exp(x[214]);
+    k_f[215] = exp(x[215]);
+    k_f[216] = exp(x[216]);
+    k_f[217] = (x[217] == 0.0 ? 1.0 : exp(x[217]));
+    k_f[218] = (x[218] == 0.0 ? 1.0 : exp(x[218]));
+    k_f[219] = exp(x[219]);
+    k_f[220] = (x[220] == x[28] ? k_f[28] : exp(x[220]));
+    k_f[221] = (x[221] == 0.0 ? 1.0 : exp(x[221]));
+    k_f[222] = (x[222] == 0.0 ? 1.0 : exp(x[222]));
+    k_f[223] = exp(x[223]);
+    k_f[224] = exp(x[224]);
+    k_f[225] = exp(x[225]);
+    k_f[226] = (x[226] == 0.0 ? 1.0 : exp(x[226]));
+    k_f[227] = (x[227] == 0.0 ? 1.0 : exp(x[227]));
+
 #ifdef __INTEL_COMPILER
     #pragma simd
 #endif
     for (int i=0; i<228; ++i) {
-        k_f[i] = prefactor_units[i] * fwd_A[i]
-                    * exp(fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT);
+        k_f[i] *= prefactor_units[i] * fwd_A[i];
     };
     return;
 }
@@ -12479,297 +12855,538 @@ void comp_Kc(double * restrict tc, double invT, double * restrict Kc)
     double g_RT[38];
     gibbs(g_RT, tc);
 
-    Kc[0] = g_RT[12] + g_RT[12] - g_RT[14];
-    Kc[1] = g_RT[3] + g_RT[3] - g_RT[22];
-    Kc[2] = g_RT[1] - g_RT[2] + g_RT[3];
-    Kc[3] = g_RT[1] + g_RT[6] - g_RT[24];
-    Kc[4] = g_RT[1] + g_RT[6] - g_RT[23];
-    Kc[5] = -g_RT[3] - g_RT[23] + g_RT[33];
-    Kc[6] = -g_RT[12] - g_RT[21] + g_RT[33];
-    Kc[7] = -g_RT[15] - g_RT[20] + g_RT[33];
-    Kc[8] = -g_RT[0] - g_RT[32] + g_RT[33];
-    Kc[9] = g_RT[1] + g_RT[20] - g_RT[21];
-    Kc[10] = g_RT[1] + g_RT[19] - g_RT[20];
-    Kc[11] = g_RT[1] + g_RT[18] - g_RT[19];
-    Kc[12] = g_RT[1] + g_RT[10] - g_RT[13];
-    Kc[13] = g_RT[1] + g_RT[10] - g_RT[13];
-    Kc[14] = g_RT[1] + g_RT[10] - g_RT[13];
-    Kc[15] = g_RT[1] + g_RT[10] - g_RT[13];
-    Kc[16] = -g_RT[0] - g_RT[18] + g_RT[20];
-    Kc[17] = -g_RT[3] - g_RT[9] + g_RT[31];
-    Kc[18] = -g_RT[4] - g_RT[9] + g_RT[29];
-    Kc[19] = -g_RT[0] + g_RT[1] + g_RT[1];
-    Kc[20] = g_RT[1] + g_RT[12] - g_RT[15];
-    Kc[21] = g_RT[1] + g_RT[11] - g_RT[12];
-    Kc[22] = -g_RT[10] + g_RT[11] + g_RT[11];
-    Kc[23] = -g_RT[0] + g_RT[3] - g_RT[5];
-    Kc[24] = -g_RT[1] + g_RT[3] - g_RT[4];
-    Kc[25] = -g_RT[4] + g_RT[28];
-    Kc[26] = -g_RT[1] + g_RT[6] - g_RT[7];
-    Kc[27] = -g_RT[1] + g_RT[7] - g_RT[9];
-    Kc[28] = -g_RT[8] + g_RT[9] + g_RT[11];
-    Kc[29] = -g_RT[1] - g_RT[32] + g_RT[36];
-    Kc[30] = -g_RT[3] - g_RT[6] + g_RT[36];
-    Kc[31] = -g_RT[1] - g_RT[32] + g_RT[35];
-    Kc[32] = -g_RT[1] - g_RT[16] + g_RT[18];
-    Kc[33] = g_RT[0] - g_RT[1] + g_RT[12] - g_RT[15];
-    Kc[34] = -g_RT[1] - g_RT[10] + g_RT[11] + g_RT[12];
-    Kc[35] = g_RT[0] - g_RT[1] + g_RT[11] - g_RT[12];
-    Kc[36] = -g_RT[10] + g_RT[12] + g_RT[13] - g_RT[15];
-    Kc[37] = -g_RT[10] + g_RT[12] + g_RT[13] - g_RT[15];
-    Kc[38] = g_RT[1] - g_RT[12] - g_RT[12] + g_RT[13];
-    Kc[39] = -g_RT[0] + g_RT[1] - g_RT[10] + g_RT[13];
-    Kc[40] = g_RT[1] - g_RT[11] + g_RT[13] - g_RT[15];
-    Kc[41] = -g_RT[10] + g_RT[11] - g_RT[12] + g_RT[13];
-    Kc[42] = -g_RT[11] + g_RT[12] + g_RT[12] - g_RT[15];
-    Kc[43] = g_RT[0] - g_RT[0] - g_RT[0] + g_RT[1] + g_RT[1];
-    Kc[44] = -g_RT[0] + g_RT[1] + g_RT[1] + g_RT[15] - g_RT[15];
-    Kc[45] = -g_RT[10] + g_RT[13] + g_RT[13] - g_RT[14];
-    Kc[46] = -g_RT[10] + g_RT[13] + g_RT[13] - g_RT[14];
-    Kc[47] = -g_RT[0] + g_RT[1] - g_RT[13] + g_RT[14];
-    Kc[48] = g_RT[1] - g_RT[12] + g_RT[14] - g_RT[15];
-    Kc[49] = g_RT[11] - g_RT[12] - g_RT[13] + g_RT[14];
-    Kc[50] = g_RT[12] - g_RT[13] + g_RT[14] - g_RT[15];
-    Kc[51] = -g_RT[0] + g_RT[1] + g_RT[2] - g_RT[3];
-    Kc[52] = g_RT[2] - g_RT[3] + g_RT[12] - g_RT[15];
-    Kc[53] = g_RT[2] - g_RT[3] + g_RT[11] - g_RT[12];
-    Kc[54] = g_RT[2] - g_RT[3] + g_RT[13] - g_RT[14];
-    Kc[55] = g_RT[3] - g_RT[12] + g_RT[13] - g_RT[24];
-    Kc[56] = -g_RT[2] + g_RT[3] - g_RT[10] + g_RT[13];
-    Kc[57] = -g_RT[1] + g_RT[3] - g_RT[6] + g_RT[11];
-    Kc[58] = g_RT[3] + g_RT[10] - g_RT[11] - g_RT[24];
-    Kc[59] = g_RT[3] - g_RT[6] + g_RT[10] - g_RT[12];
-    Kc[60] = g_RT[1] - g_RT[3] - g_RT[12] + g_RT[24];
-    Kc[61] = g_RT[1] - g_RT[3] - g_RT[12] + g_RT[23];
-    Kc[62] = g_RT[3] + g_RT[12] - g_RT[15] - g_RT[28];
-    Kc[63] = g_RT[3] - g_RT[4] + g_RT[12] - g_RT[15];
-    Kc[64] = -g_RT[0] + g_RT[1] + g_RT[3] - g_RT[4];
-    Kc[65] = -g_RT[2] + g_RT[3] - g_RT[6] + g_RT[24];
-    Kc[66] = -g_RT[0] + g_RT[1] - g_RT[6] + g_RT[24];
-    Kc[67] = -g_RT[0] + g_RT[1] - g_RT[6] + g_RT[23];
-    Kc[68] = -g_RT[6] + g_RT[12] - g_RT[15] + g_RT[24];
-    Kc[69] = -g_RT[6] + g_RT[12] - g_RT[15] + g_RT[23];
-    Kc[70] = -g_RT[6] + g_RT[11] - g_RT[12] + g_RT[24];
-    Kc[71] = -g_RT[6] + g_RT[11] - g_RT[12] + g_RT[23];
-    Kc[72] = -g_RT[6] + g_RT[10] - g_RT[13] + g_RT[24];
-    Kc[73] = -g_RT[3] - g_RT[8] + g_RT[9] + g_RT[24];
-    Kc[74] = -g_RT[6] + g_RT[10] - g_RT[13] + g_RT[23];
-    Kc[75] = -g_RT[6] + g_RT[10] - g_RT[13] + g_RT[23];
-    Kc[76] = -g_RT[0] + g_RT[1] + g_RT[4] - g_RT[5];
-    Kc[77] = g_RT[4] - g_RT[5] + g_RT[12] - g_RT[15];
-    Kc[78] = -g_RT[1] + g_RT[4] - g_RT[6] + g_RT[12];
-    Kc[79] = g_RT[4] - g_RT[6] + g_RT[8] - g_RT[9];
-    Kc[80] = -g_RT[1] - g_RT[1] + g_RT[4] - g_RT[9] + g_RT[11];
-    Kc[81] = -g_RT[0] + g_RT[4] - g_RT[9] + g_RT[11];
-    Kc[82] = g_RT[4] - g_RT[6] + g_RT[10] - g_RT[11];
-    Kc[83] = -g_RT[1] - g_RT[1] + g_RT[4] - g_RT[8] + g_RT[10];
-    Kc[84] = -g_RT[0] + g_RT[4] - g_RT[8] + g_RT[10];
-    Kc[85] = g_RT[4] - g_RT[9] + g_RT[10] - g_RT[15];
-    Kc[86] = g_RT[4] - g_RT[7] + g_RT[10] - g_RT[12];
-    Kc[87] = -g_RT[1] + g_RT[3] + g_RT[4] - g_RT[20];
-    Kc[88] = -g_RT[1] - g_RT[1] + g_RT[4] + g_RT[4] - g_RT[18];
-    Kc[89] = g_RT[4] - g_RT[9] + g_RT[17] - g_RT[19];
-    Kc[90] = -g_RT[1] + g_RT[4] + g_RT[18] - g_RT[26];
-    Kc[91] = g_RT[2] - g_RT[3] - g_RT[3] + g_RT[28];
-    Kc[92] = -g_RT[3] - g_RT[21] + g_RT[22] + g_RT[28];
-    Kc[93] = -g_RT[1] - g_RT[9] + g_RT[10] - g_RT[12] + g_RT[28];
-    Kc[94] = g_RT[0] - g_RT[1] - g_RT[3] + g_RT[28];
-    Kc[95] = -g_RT[1] + g_RT[18] - g_RT[26] + g_RT[28];
-    Kc[96] = -g_RT[1] - g_RT[1] - g_RT[9] + g_RT[11] + g_RT[28];
-    Kc[97] = -g_RT[1] - g_RT[6] + g_RT[12] + g_RT[28];
-    Kc[98] = -g_RT[0] + g_RT[1] - g_RT[5] + g_RT[28];
-    Kc[99] = -g_RT[6] + g_RT[8] - g_RT[9] + g_RT[28];
-    Kc[100] = -g_RT[1] + g_RT[3] - g_RT[20] + g_RT[28];
-    Kc[101] = -g_RT[9] - g_RT[20] + g_RT[28] + g_RT[29];
-    Kc[102] = g_RT[5] - g_RT[7] + g_RT[10] - g_RT[11];
-    Kc[103] = -g_RT[1] + g_RT[5] - g_RT[9] + g_RT[11];
-    Kc[104] = -g_RT[1] + g_RT[5] - g_RT[7] + g_RT[12];
-    Kc[105] = g_RT[5] - g_RT[7] + g_RT[8] - g_RT[9];
-    Kc[106] = -g_RT[1] + g_RT[5] - g_RT[6] + g_RT[15];
-    Kc[107] = -g_RT[1] + g_RT[5] + g_RT[6] - g_RT[29];
-    Kc[108] = -g_RT[1] + g_RT[5] + g_RT[18] - g_RT[27];
-    Kc[109] = -g_RT[1] + g_RT[4] + g_RT[5] - g_RT[18];
-    Kc[110] = -g_RT[1] + g_RT[3] + g_RT[5] - g_RT[19];
-    Kc[111] = -g_RT[1] + g_RT[2] + g_RT[5] - g_RT[20];
-    Kc[112] = g_RT[6] - g_RT[7] + g_RT[12] - g_RT[15];
-    Kc[113] = -g_RT[0] + g_RT[1] + g_RT[6] - g_RT[7];
-    Kc[114] = g_RT[6] - g_RT[7] + g_RT[11] - g_RT[12];
-    Kc[115] = g_RT[7] - g_RT[9] + g_RT[10] - g_RT[13];
-    Kc[116] = g_RT[7] - g_RT[9] + g_RT[12] - g_RT[15];
-    Kc[117] = -g_RT[0] + g_RT[1] + g_RT[7] - g_RT[9];
-    Kc[118] = g_RT[7] - g_RT[9] + g_RT[11] - g_RT[12];
-    Kc[119] = -g_RT[1] + g_RT[7] - g_RT[8] + g_RT[11];
-    Kc[120] = -g_RT[1] - g_RT[8] + g_RT[9] + g_RT[12];
-    Kc[121] = -g_RT[8] + g_RT[9] + g_RT[10] - g_RT[11];
-    Kc[122] = -g_RT[8] + g_RT[9] - g_RT[12] + g_RT[13];
-    Kc[123] = g_RT[12] - g_RT[15] + g_RT[33] - g_RT[34];
-    Kc[124] = g_RT[12] - g_RT[15] + g_RT[33] - g_RT[35];
-    Kc[125] = g_RT[12] - g_RT[15] + g_RT[33] - g_RT[36];
-    Kc[126] = -g_RT[0] + g_RT[1] + g_RT[33] - g_RT[34];
-    Kc[127] = -g_RT[0] + g_RT[1] + g_RT[33] - g_RT[35];
-    Kc[128] = -g_RT[0] + g_RT[1] + g_RT[33] - g_RT[36];
-    Kc[129] = g_RT[11] - g_RT[12] + g_RT[33] - g_RT[34];
-    Kc[130] = g_RT[11] - g_RT[12] + g_RT[33] - g_RT[35];
-    Kc[131] = g_RT[11] - g_RT[12] + g_RT[33] - g_RT[36];
-    Kc[132] = -g_RT[2] + g_RT[3] + g_RT[33] - g_RT[34];
-    Kc[133] = -g_RT[2] + g_RT[3] + g_RT[33] - g_RT[35];
-    Kc[134] = -g_RT[2] + g_RT[3] + g_RT[33] - g_RT[36];
-    Kc[135] = g_RT[13] - g_RT[14] + g_RT[33] - g_RT[35];
-    Kc[136] = g_RT[13] - g_RT[14] + g_RT[33] - g_RT[34];
-    Kc[137] = g_RT[13] - g_RT[14] + g_RT[33] - g_RT[36];
-    Kc[138] = g_RT[10] - g_RT[13] - g_RT[32] + g_RT[36];
-    Kc[139] = -g_RT[8] + g_RT[9] - g_RT[21] + g_RT[36];
-    Kc[140] = g_RT[1] - g_RT[3] - g_RT[23] + g_RT[36];
-    Kc[141] = g_RT[1] - g_RT[15] - g_RT[20] + g_RT[36];
-    Kc[142] = g_RT[12] - g_RT[15] - g_RT[32] + g_RT[36];
-    Kc[143] = g_RT[10] - g_RT[13] - g_RT[32] + g_RT[35];
-    Kc[144] = g_RT[10] - g_RT[13] - g_RT[32] + g_RT[35];
-    Kc[145] = g_RT[11] - g_RT[12] - g_RT[32] + g_RT[35];
-    Kc[146] = g_RT[1] - g_RT[15] - g_RT[20] + g_RT[35];
-    Kc[147] = g_RT[1] - g_RT[3] - g_RT[23] + g_RT[35];
-    Kc[148] = -g_RT[12] - g_RT[12] + g_RT[13] - g_RT[32] + g_RT[35];
-    Kc[149] = g_RT[12] - g_RT[15] - g_RT[32] + g_RT[35];
-    Kc[150] = g_RT[12] - g_RT[15] - g_RT[31] + g_RT[32];
-    Kc[151] = g_RT[12] - g_RT[15] - g_RT[30] + g_RT[32];
-    Kc[152] = g_RT[11] - g_RT[12] - g_RT[31] + g_RT[32];
-    Kc[153] = g_RT[11] - g_RT[12] - g_RT[30] + g_RT[32];
-    Kc[154] = -g_RT[0] + g_RT[1] - g_RT[31] + g_RT[32];
-    Kc[155] = -g_RT[0] + g_RT[1] - g_RT[30] + g_RT[32];
-    Kc[156] = -g_RT[2] + g_RT[3] - g_RT[31] + g_RT[32];
-    Kc[157] = -g_RT[2] + g_RT[3] - g_RT[30] + g_RT[32];
-    Kc[158] = g_RT[13] - g_RT[14] - g_RT[31] + g_RT[32];
-    Kc[159] = g_RT[13] - g_RT[14] - g_RT[30] + g_RT[32];
-    Kc[160] = g_RT[10] - g_RT[13] - g_RT[31] + g_RT[32];
-    Kc[161] = -g_RT[2] + g_RT[3] - g_RT[21] + g_RT[22];
-    Kc[162] = -g_RT[0] + g_RT[1] - g_RT[21] + g_RT[22];
-    Kc[163] = g_RT[11] - g_RT[12] - g_RT[21] + g_RT[22];
-    Kc[164] = g_RT[12] - g_RT[15] - g_RT[21] + g_RT[22];
-    Kc[165] = -g_RT[0] + g_RT[1] - g_RT[20] + g_RT[21];
-    Kc[166] = g_RT[1] - g_RT[3] - g_RT[3] + g_RT[21];
-    Kc[167] = g_RT[1] + g_RT[21] - g_RT[22];
-    Kc[168] = g_RT[12] - g_RT[15] - g_RT[20] + g_RT[21];
-    Kc[169] = -g_RT[3] - g_RT[6] + g_RT[11] + g_RT[21];
-    Kc[170] = -g_RT[10] + g_RT[13] + g_RT[21] - g_RT[22];
-    Kc[171] = -g_RT[12] + g_RT[13] + g_RT[21] - g_RT[36];
-    Kc[172] = g_RT[10] - g_RT[13] - g_RT[20] + g_RT[21];
-    Kc[173] = g_RT[10] - g_RT[12] + g_RT[21] - g_RT[32];
-    Kc[174] = g_RT[12] + g_RT[20] - g_RT[34];
-    Kc[175] = g_RT[12] - g_RT[15] - g_RT[19] + g_RT[20];
-    Kc[176] = -g_RT[3] - g_RT[7] + g_RT[11] + g_RT[20];
-    Kc[177] = -g_RT[1] + g_RT[11] + g_RT[20] - g_RT[30];
-    Kc[178] = -g_RT[2] + g_RT[3] - g_RT[19] + g_RT[20];
-    Kc[179] = -g_RT[0] + g_RT[1] - g_RT[19] + g_RT[20];
-    Kc[180] = -g_RT[0] + g_RT[1] - g_RT[18] + g_RT[19];
-    Kc[181] = -g_RT[1] + g_RT[11] + g_RT[19] - g_RT[29];
-    Kc[182] = -g_RT[6] - g_RT[7] + g_RT[10] + g_RT[19];
-    Kc[183] = g_RT[10] - g_RT[11] + g_RT[19] - g_RT[30];
-    Kc[184] = g_RT[10] - g_RT[13] - g_RT[18] + g_RT[19];
-    Kc[185] = g_RT[12] - g_RT[15] - g_RT[18] + g_RT[19];
-    Kc[186] = g_RT[16] - g_RT[18] - g_RT[18] + g_RT[19];
-    Kc[187] = -g_RT[4] + g_RT[5] - g_RT[18] + g_RT[19];
-    Kc[188] = -g_RT[2] + g_RT[3] - g_RT[18] + g_RT[19];
-    Kc[189] = g_RT[12] - g_RT[15] - g_RT[16] + g_RT[18];
-    Kc[190] = -g_RT[1] + g_RT[12] + g_RT[18] - g_RT[25];
-    Kc[191] = -g_RT[1] + g_RT[12] + g_RT[18] - g_RT[29];
-    Kc[192] = -g_RT[1] + g_RT[12] + g_RT[18] - g_RT[29];
-    Kc[193] = -g_RT[3] - g_RT[9] + g_RT[12] + g_RT[18];
-    Kc[194] = g_RT[1] - g_RT[1] + g_RT[25] - g_RT[29];
-    Kc[195] = -g_RT[4] - g_RT[9] + g_RT[11] + g_RT[18];
-    Kc[196] = -g_RT[1] + g_RT[11] - g_RT[17] + g_RT[18];
-    Kc[197] = g_RT[11] - g_RT[12] - g_RT[16] + g_RT[18];
-    Kc[198] = -g_RT[2] + g_RT[3] - g_RT[16] + g_RT[18];
-    Kc[199] = g_RT[10] - g_RT[12] - g_RT[17] + g_RT[18];
-    Kc[200] = g_RT[1] - g_RT[3] - g_RT[7] + g_RT[30];
-    Kc[201] = -g_RT[0] + g_RT[1] - g_RT[29] + g_RT[30];
-    Kc[202] = -g_RT[6] - g_RT[7] + g_RT[11] + g_RT[30];
-    Kc[203] = g_RT[12] - g_RT[15] - g_RT[29] + g_RT[30];
-    Kc[204] = -g_RT[6] - g_RT[9] + g_RT[10] - g_RT[12] + g_RT[30];
-    Kc[205] = -g_RT[1] + g_RT[3] - g_RT[9] - g_RT[21] + g_RT[30];
-    Kc[206] = -g_RT[6] - g_RT[7] - g_RT[12] + g_RT[13] + g_RT[30];
-    Kc[207] = -g_RT[10] + g_RT[13] + g_RT[30] - g_RT[32];
-    Kc[208] = -g_RT[3] - g_RT[9] + g_RT[30];
-    Kc[209] = -g_RT[1] - g_RT[29] + g_RT[30];
-    Kc[210] = -g_RT[4] - g_RT[8] + g_RT[11] + g_RT[29];
-    Kc[211] = g_RT[1] - g_RT[3] - g_RT[9] + g_RT[29];
-    Kc[212] = -g_RT[0] + g_RT[1] - g_RT[17] + g_RT[29];
-    Kc[213] = g_RT[11] - g_RT[12] - g_RT[17] + g_RT[29];
-    Kc[214] = g_RT[12] - g_RT[15] - g_RT[17] + g_RT[29];
-    Kc[215] = -g_RT[9] + g_RT[12] - g_RT[23] + g_RT[29];
-    Kc[216] = g_RT[0] - g_RT[1] + g_RT[16] - g_RT[18];
-    Kc[217] = -g_RT[5] - g_RT[9] + g_RT[11] + g_RT[16];
-    Kc[218] = -g_RT[1] + g_RT[12] + g_RT[16] - g_RT[17];
-    Kc[219] = -g_RT[1] - g_RT[9] - g_RT[9] + g_RT[10] + g_RT[16];
-    Kc[220] = -g_RT[9] + g_RT[17] + g_RT[18] - g_RT[26];
-    Kc[221] = g_RT[1] - g_RT[9] + g_RT[17] - g_RT[28];
-    Kc[222] = -g_RT[1] - g_RT[9] - g_RT[9] + g_RT[11] + g_RT[17];
-    Kc[223] = -g_RT[5] - g_RT[8] + g_RT[11] + g_RT[17];
-    Kc[224] = -g_RT[7] - g_RT[9] + g_RT[10] - g_RT[11] + g_RT[17];
-    Kc[225] = -g_RT[7] - g_RT[8] + g_RT[10] + g_RT[17];
-    Kc[226] = g_RT[5] - g_RT[9] + g_RT[17] - g_RT[18];
-    Kc[227] = -g_RT[9] - g_RT[9] + g_RT[17] + g_RT[17] - g_RT[18];
-
-#ifdef __INTEL_COMPILER
-     #pragma simd
-#endif
-    for (int i=0; i<228; ++i) {
-        Kc[i] = exp(Kc[i]);
-    };
-
     /*reference concentration: P_atm / (RT) in inverse mol/m^3 */
     double refC = 101325 / 8.31451 * invT;
     double refCinv = 1 / refC;
 
-    Kc[0] *= refCinv;
-    Kc[1] *= refCinv;
-    Kc[2] *= refCinv;
-    Kc[3] *= refCinv;
-    Kc[4] *= refCinv;
-    Kc[5] *= refC;
-    Kc[6] *= refC;
-    Kc[7] *= refC;
-    Kc[8] *= refC;
-    Kc[9] *= refCinv;
-    Kc[10] *= refCinv;
-    Kc[11] *= refCinv;
-    Kc[12] *= refCinv;
-    Kc[13] *= refCinv;
-    Kc[14] *= refCinv;
-    Kc[15] *= refCinv;
-    Kc[16] *= refC;
-    Kc[17] *= refC;
-    Kc[18] *= refC;
-    Kc[19] *= refCinv;
-    Kc[20] *= refCinv;
-    Kc[21] *= refCinv;
-    Kc[22] *= refCinv;
-    Kc[23] *= refC;
-    Kc[24] *= refC;
-    Kc[26] *= refC;
-    Kc[27] *= refC;
-    Kc[28] *= refCinv;
-    Kc[29] *= refC;
-    Kc[30] *= refC;
-    Kc[31] *= refC;
-    Kc[32] *= refC;
-    Kc[43] *= refCinv;
-    Kc[44] *= refCinv;
-    Kc[80] *= refC;
-    Kc[83] *= refC;
-    Kc[88] *= refC;
-    Kc[93] *= refC;
-    Kc[96] *= refC;
-    Kc[148] *= refC;
-    Kc[167] *= refCinv;
-    Kc[174] *= refCinv;
-    Kc[204] *= refC;
-    Kc[205] *= refC;
-    Kc[206] *= refC;
-    Kc[208] *= refC;
-    Kc[209] *= refC;
-    Kc[219] *= refC;
-    Kc[222] *= refC;
-    Kc[224] *= refC;
-    Kc[227] *= refC;
+    /*Kc as the ratio of the products of the species exp(g_RT)/refC, unless */
+    /*the product over a side of a reaction leaves the normal range */
+    double e_g[38], den[228];
+    for (int k=0; k<38; ++k) {
+        e_g[k] = exp(g_RT[k]) * refCinv;
+    }
+    Kc[0] = e_g[12]*e_g[12]; den[0] = e_g[14];
+    Kc[1] = e_g[3]*e_g[3]; den[1] = e_g[22];
+    Kc[2] = e_g[1]*e_g[3]; den[2] = e_g[2];
+    Kc[3] = e_g[1]*e_g[6]; den[3] = e_g[24];
+    Kc[4] = e_g[1]*e_g[6]; den[4] = e_g[23];
+    Kc[5] = e_g[33]; den[5] = e_g[3]*e_g[23];
+    Kc[6] = e_g[33]; den[6] = e_g[12]*e_g[21];
+    Kc[7] = e_g[33]; den[7] = e_g[15]*e_g[20];
+    Kc[8] = e_g[33]; den[8] = e_g[0]*e_g[32];
+    Kc[9] = e_g[1]*e_g[20]; den[9] = e_g[21];
+    Kc[10] = e_g[1]*e_g[19]; den[10] = e_g[20];
+    Kc[11] = e_g[1]*e_g[18]; den[11] = e_g[19];
+    Kc[12] = e_g[1]*e_g[10]; den[12] = e_g[13];
+    Kc[13] = e_g[1]*e_g[10]; den[13] = e_g[13];
+    Kc[14] = e_g[1]*e_g[10]; den[14] = e_g[13];
+    Kc[15] = e_g[1]*e_g[10]; den[15] = e_g[13];
+    Kc[16] = e_g[20]; den[16] = e_g[0]*e_g[18];
+    Kc[17] = e_g[31]; den[17] = e_g[3]*e_g[9];
+    Kc[18] = e_g[29]; den[18] = e_g[4]*e_g[9];
+    Kc[19] = e_g[1]*e_g[1]; den[19] = e_g[0];
+    Kc[20] = e_g[1]*e_g[12]; den[20] = e_g[15];
+    Kc[21] = e_g[1]*e_g[11]; den[21] = e_g[12];
+    Kc[22] = e_g[11]*e_g[11]; den[22] = e_g[10];
+    Kc[23] = e_g[3]; den[23] = e_g[0]*e_g[5];
+    Kc[24] = e_g[3]; den[24] = e_g[1]*e_g[4];
+    Kc[25] = e_g[28]; den[25] = e_g[4];
+    Kc[26] = e_g[6]; den[26] = e_g[1]*e_g[7];
+    Kc[27] = e_g[7]; den[27] = e_g[1]*e_g[9];
+    Kc[28] = e_g[9]*e_g[11]; den[28] = e_g[8];
+    Kc[29] = e_g[36]; den[29] = e_g[1]*e_g[32];
+    Kc[30] = e_g[36]; den[30] = e_g[3]*e_g[6];
+    Kc[31] = e_g[35]; den[31] = e_g[1]*e_g[32];
+    Kc[32] = e_g[18]; den[32] = e_g[1]*e_g[16];
+    Kc[33] = e_g[0]*e_g[12]; den[33] = e_g[1]*e_g[15];
+    Kc[34] = e_g[11]*e_g[12]; den[34] = e_g[1]*e_g[10];
+    Kc[35] = e_g[0]*e_g[11]; den[35] = e_g[1]*e_g[12];
+    Kc[36] = e_g[12]*e_g[13]; den[36] = e_g[10]*e_g[15];
+    Kc[37] = e_g[12]*e_g[13]; den[37] = e_g[10]*e_g[15];
+    Kc[38] = e_g[1]*e_g[13]; den[38] = e_g[12]*e_g[12];
+    Kc[39] = e_g[1]*e_g[13]; den[39] = e_g[0]*e_g[10];
+    Kc[40] = e_g[1]*e_g[13]; den[40] = e_g[11]*e_g[15];
+    Kc[41] = e_g[11]*e_g[13]; den[41] = e_g[10]*e_g[12];
+    Kc[42] = e_g[12]*e_g[12]; den[42] = e_g[11]*e_g[15];
+    Kc[43] = e_g[0]*e_g[1]*e_g[1]; den[43] = e_g[0]*e_g[0];
+    Kc[44] = e_g[1]*e_g[1]*e_g[15]; den[44] = e_g[0]*e_g[15];
+    Kc[45] = e_g[13]*e_g[13]; den[45] = e_g[10]*e_g[14];
+    Kc[46] = e_g[13]*e_g[13]; den[46] = e_g[10]*e_g[14];
+    Kc[47] = e_g[1]*e_g[14]; den[47] = e_g[0]*e_g[13];
+    Kc[48] = e_g[1]*e_g[14]; den[48] = e_g[12]*e_g[15];
+    Kc[49] = e_g[11]*e_g[14]; den[49] = e_g[12]*e_g[13];
+    Kc[50] = e_g[12]*e_g[14]; den[50] = e_g[13]*e_g[15];
+    Kc[51] = e_g[1]*e_g[2]; den[51] = e_g[0]*e_g[3];
+    Kc[52] = e_g[2]*e_g[12]; den[52] = e_g[3]*e_g[15];
+    Kc[53] = e_g[2]*e_g[11]; den[53] = e_g[3]*e_g[12];
+    Kc[54] = e_g[2]*e_g[13]; den[54] = e_g[3]*e_g[14];
+    Kc[55] = e_g[3]*e_g[13]; den[55] = e_g[12]*e_g[24];
+    Kc[56] = e_g[3]*e_g[13]; den[56] = e_g[2]*e_g[10];
+    Kc[57] = e_g[3]*e_g[11]; den[57] = e_g[1]*e_g[6];
+    Kc[58] = e_g[3]*e_g[10]; den[58] = e_g[11]*e_g[24];
+    Kc[59] = e_g[3]*e_g[10]; den[59] = e_g[6]*e_g[12];
+    Kc[60] = e_g[1]*e_g[24]; den[60] = e_g[3]*e_g[12];
+    Kc[61] = e_g[1]*e_g[23]; den[61] = e_g[3]*e_g[12];
+    Kc[62] = e_g[3]*e_g[12]; den[62] = e_g[15]*e_g[28];
+    Kc[63] = e_g[3]*e_g[12]; den[63] = e_g[4]*e_g[15];
+    Kc[64] = e_g[1]*e_g[3]; den[64] = e_g[0]*e_g[4];
+    Kc[65] = e_g[3]*e_g[24]; den[65] = e_g[2]*e_g[6];
+    Kc[66] = e_g[1]*e_g[24]; den[66] = e_g[0]*e_g[6];
+    Kc[67] = e_g[1]*e_g[23]; den[67] = e_g[0]*e_g[6];
+    Kc[68] = e_g[12]*e_g[24]; den[68] = e_g[6]*e_g[15];
+    Kc[69] = e_g[12]*e_g[23]; den[69] = e_g[6]*e_g[15];
+    Kc[70] = e_g[11]*e_g[24]; den[70] = e_g[6]*e_g[12];
+    Kc[71] = e_g[11]*e_g[23]; den[71] = e_g[6]*e_g[12];
+    Kc[72] = e_g[10]*e_g[24]; den[72] = e_g[6]*e_g[13];
+    Kc[73] = e_g[9]*e_g[24]; den[73] = e_g[3]*e_g[8];
+    Kc[74] = e_g[10]*e_g[23]; den[74] = e_g[6]*e_g[13];
+    Kc[75] = e_g[10]*e_g[23]; den[75] = e_g[6]*e_g[13];
+    Kc[76] = e_g[1]*e_g[4]; den[76] = e_g[0]*e_g[5];
+    Kc[77] = e_g[4]*e_g[12]; den[77] = e_g[5]*e_g[15];
+    Kc[78] = e_g[4]*e_g[12]; den[78] = e_g[1]*e_g[6];
+    Kc[79] = e_g[4]*e_g[8]; den[79] = e_g[6]*e_g[9];
+    Kc[80] = e_g[4]*e_g[11]; den[80] = e_g[1]*e_g[1]*e_g[9];
+    Kc[81] = e_g[4]*e_g[11]; den[81] = e_g[0]*e_g[9];
+    Kc[82] = e_g[4]*e_g[10]; den[82] = e_g[6]*e_g[11];
+    Kc[83] = e_g[4]*e_g[10]; den[83] = e_g[1]*e_g[1]*e_g[8];
+    Kc[84] = e_g[4]*e_g[10]; den[84] = e_g[0]*e_g[8];
+    Kc[85] = e_g[4]*e_g[10]; den[85] = e_g[9]*e_g[15];
+    Kc[86] = e_g[4]*e_g[10]; den[86] = e_g[7]*e_g[12];
+    Kc[87] = e_g[3]*e_g[4]; den[87] = e_g[1]*e_g[20];
+    Kc[88] = e_g[4]*e_g[4]; den[88] = e_g[1]*e_g[1]*e_g[18];
+    Kc[89] = e_g[4]*e_g[17]; den[89] = e_g[9]*e_g[19];
+    Kc[90] = e_g[4]*e_g[18]; den[90] = e_g[1]*e_g[26];
+    Kc[91] = e_g[2]*e_g[28]; den[91] = e_g[3]*e_g[3];
+    Kc[92] = e_g[22]*e_g[28]; den[92] = e_g[3]*e_g[21];
+    Kc[93] = e_g[10]*e_g[28]; den[93] = e_g[1]*e_g[9]*e_g[12];
+    Kc[94] = e_g[0]*e_g[28]; den[94] = e_g[1]*e_g[3];
+    Kc[95] = e_g[18]*e_g[28]; den[95] = e_g[1]*e_g[26];
+    Kc[96] = e_g[11]*e_g[28]; den[96] = e_g[1]*e_g[1]*e_g[9];
+    Kc[97] = e_g[12]*e_g[28]; den[97] = e_g[1]*e_g[6];
+    Kc[98] = e_g[1]*e_g[28]; den[98] = e_g[0]*e_g[5];
+    Kc[99] = e_g[8]*e_g[28]; den[99] = e_g[6]*e_g[9];
+    Kc[100] = e_g[3]*e_g[28]; den[100] = e_g[1]*e_g[20];
+    Kc[101] = e_g[28]*e_g[29]; den[101] = e_g[9]*e_g[20];
+    Kc[102] = e_g[5]*e_g[10]; den[102] = e_g[7]*e_g[11];
+    Kc[103] = e_g[5]*e_g[11]; den[103] = e_g[1]*e_g[9];
+    Kc[104] = e_g[5]*e_g[12]; den[104] = e_g[1]*e_g[7];
+    Kc[105] = e_g[5]*e_g[8]; den[105] = e_g[7]*e_g[9];
+    Kc[106] = e_g[5]*e_g[15]; den[106] = e_g[1]*e_g[6];
+    Kc[107] = e_g[5]*e_g[6]; den[107] = e_g[1]*e_g[29];
+    Kc[108] = e_g[5]*e_g[18]; den[108] = e_g[1]*e_g[27];
+    Kc[109] = e_g[4]*e_g[5]; den[109] = e_g[1]*e_g[18];
+    Kc[110] = e_g[3]*e_g[5]; den[110] = e_g[1]*e_g[19];
+    Kc[111] = e_g[2]*e_g[5]; den[111] = e_g[1]*e_g[20];
+    Kc[112] = e_g[6]*e_g[12]; den[112] = e_g[7]*e_g[15];
+    Kc[113] = e_g[1]*e_g[6]; den[113] = e_g[0]*e_g[7];
+    Kc[114] = e_g[6]*e_g[11]; den[114] = e_g[7]*e_g[12];
+    Kc[115] = e_g[7]*e_g[10]; den[115] = e_g[9]*e_g[13];
+    Kc[116] = e_g[7]*e_g[12]; den[116] = e_g[9]*e_g[15];
+    Kc[117] = e_g[1]*e_g[7]; den[117] = e_g[0]*e_g[9];
+    Kc[118] = e_g[7]*e_g[11]; den[118] = e_g[9]*e_g[12];
+    Kc[119] = e_g[7]*e_g[11]; den[119] = e_g[1]*e_g[8];
+    Kc[120] = e_g[9]*e_g[12]; den[120] = e_g[1]*e_g[8];
+    Kc[121] = e_g[9]*e_g[10]; den[121] = e_g[8]*e_g[11];
+    Kc[122] = e_g[9]*e_g[13]; den[122] = e_g[8]*e_g[12];
+    Kc[123] = e_g[12]*e_g[33]; den[123] = e_g[15]*e_g[34];
+    Kc[124] = e_g[12]*e_g[33]; den[124] = e_g[15]*e_g[35];
+    Kc[125] = e_g[12]*e_g[33]; den[125] = e_g[15]*e_g[36];
+    Kc[126] = e_g[1]*e_g[33]; den[126] = e_g[0]*e_g[34];
+    Kc[127] = e_g[1]*e_g[33]; den[127] = e_g[0]*e_g[35];
+    Kc[128] = e_g[1]*e_g[33]; den[128] = e_g[0]*e_g[36];
+    Kc[129] = e_g[11]*e_g[33]; den[129] = e_g[12]*e_g[34];
+    Kc[130] = e_g[11]*e_g[33]; den[130] = e_g[12]*e_g[35];
+    Kc[131] = e_g[11]*e_g[33]; den[131] = e_g[12]*e_g[36];
+    Kc[132] = e_g[3]*e_g[33]; den[132] = e_g[2]*e_g[34];
+    Kc[133] = e_g[3]*e_g[33]; den[133] = e_g[2]*e_g[35];
+    Kc[134] = e_g[3]*e_g[33]; den[134] = e_g[2]*e_g[36];
+    Kc[135] = e_g[13]*e_g[33]; den[135] = e_g[14]*e_g[35];
+    Kc[136] = e_g[13]*e_g[33]; den[136] = e_g[14]*e_g[34];
+    Kc[137] = e_g[13]*e_g[33]; den[137] = e_g[14]*e_g[36];
+    Kc[138] = e_g[10]*e_g[36]; den[138] = e_g[13]*e_g[32];
+    Kc[139] = e_g[9]*e_g[36]; den[139] = e_g[8]*e_g[21];
+    Kc[140] = e_g[1]*e_g[36]; den[140] = e_g[3]*e_g[23];
+    Kc[141] = e_g[1]*e_g[36]; den[141] = e_g[15]*e_g[20];
+    Kc[142] = e_g[12]*e_g[36]; den[142] = e_g[15]*e_g[32];
+    Kc[143] = e_g[10]*e_g[35]; den[143] = e_g[13]*e_g[32];
+    Kc[144] = e_g[10]*e_g[35]; den[144] = e_g[13]*e_g[32];
+    Kc[145] = e_g[11]*e_g[35]; den[145] = e_g[12]*e_g[32];
+    Kc[146] = e_g[1]*e_g[35]; den[146] = e_g[15]*e_g[20];
+    Kc[147] = e_g[1]*e_g[35]; den[147] = e_g[3]*e_g[23];
+    Kc[148] = e_g[13]*e_g[35]; den[148] = e_g[12]*e_g[12]*e_g[32];
+    Kc[149] = e_g[12]*e_g[35]; den[149] = e_g[15]*e_g[32];
+    Kc[150] = e_g[12]*e_g[32]; den[150] = e_g[15]*e_g[31];
+    Kc[151] = e_g[12]*e_g[32]; den[151] = e_g[15]*e_g[30];
+    Kc[152] = e_g[11]*e_g[32]; den[152] = e_g[12]*e_g[31];
+    Kc[153] = e_g[11]*e_g[32]; den[153] = e_g[12]*e_g[30];
+    Kc[154] = e_g[1]*e_g[32]; den[154] = e_g[0]*e_g[31];
+    Kc[155] = e_g[1]*e_g[32]; den[155] = e_g[0]*e_g[30];
+    Kc[156] = e_g[3]*e_g[32]; den[156] = e_g[2]*e_g[31];
+    Kc[157] = e_g[3]*e_g[32]; den[157] = e_g[2]*e_g[30];
+    Kc[158] = e_g[13]*e_g[32]; den[158] = e_g[14]*e_g[31];
+    Kc[159] = e_g[13]*e_g[32]; den[159] = e_g[14]*e_g[30];
+    Kc[160] = e_g[10]*e_g[32]; den[160] = e_g[13]*e_g[31];
+    Kc[161] = e_g[3]*e_g[22]; den[161] = e_g[2]*e_g[21];
+    Kc[162] = e_g[1]*e_g[22]; den[162] = e_g[0]*e_g[21];
+    Kc[163] = e_g[11]*e_g[22]; den[163] = e_g[12]*e_g[21];
+    Kc[164] = e_g[12]*e_g[22]; den[164] = e_g[15]*e_g[21];
+    Kc[165] = e_g[1]*e_g[21]; den[165] = e_g[0]*e_g[20];
+    Kc[166] = e_g[1]*e_g[21]; den[166] = e_g[3]*e_g[3];
+    Kc[167] = e_g[1]*e_g[21]; den[167] = e_g[22];
+    Kc[168] = e_g[12]*e_g[21]; den[168] = e_g[15]*e_g[20];
+    Kc[169] = e_g[11]*e_g[21]; den[169] = e_g[3]*e_g[6];
+    Kc[170] = e_g[13]*e_g[21]; den[170] = e_g[10]*e_g[22];
+    Kc[171] = e_g[13]*e_g[21]; den[171] = e_g[12]*e_g[36];
+    Kc[172] = e_g[10]*e_g[21]; den[172] = e_g[13]*e_g[20];
+    Kc[173] = e_g[10]*e_g[21]; den[173] = e_g[12]*e_g[32];
+    Kc[174] = e_g[12]*e_g[20]; den[174] = e_g[34];
+    Kc[175] = e_g[12]*e_g[20]; den[175] = e_g[15]*e_g[19];
+    Kc[176] = e_g[11]*e_g[20]; den[176] = e_g[3]*e_g[7];
+    Kc[177] = e_g[11]*e_g[20]; den[177] = e_g[1]*e_g[30];
+    Kc[178] = e_g[3]*e_g[20]; den[178] = e_g[2]*e_g[19];
+    Kc[179] = e_g[1]*e_g[20]; den[179] = e_g[0]*e_g[19];
+    Kc[180] = e_g[1]*e_g[19]; den[180] = e_g[0]*e_g[18];
+    Kc[181] = e_g[11]*e_g[19]; den[181] = e_g[1]*e_g[29];
+    Kc[182] = e_g[10]*e_g[19]; den[182] = e_g[6]*e_g[7];
+    Kc[183] = e_g[10]*e_g[19]; den[183] = e_g[11]*e_g[30];
+    Kc[184] = e_g[10]*e_g[19]; den[184] = e_g[13]*e_g[18];
+    Kc[185] = e_g[12]*e_g[19]; den[185] = e_g[15]*e_g[18];
+    Kc[186] = e_g[16]*e_g[19]; den[186] = e_g[18]*e_g[18];
+    Kc[187] = e_g[5]*e_g[19]; den[187] = e_g[4]*e_g[18];
+    Kc[188] = e_g[3]*e_g[19]; den[188] = e_g[2]*e_g[18];
+    Kc[189] = e_g[12]*e_g[18]; den[189] = e_g[15]*e_g[16];
+    Kc[190] = e_g[12]*e_g[18]; den[190] = e_g[1]*e_g[25];
+    Kc[191] = e_g[12]*e_g[18]; den[191] = e_g[1]*e_g[29];
+    Kc[192] = e_g[12]*e_g[18]; den[192] = e_g[1]*e_g[29];
+    Kc[193] = e_g[12]*e_g[18]; den[193] = e_g[3]*e_g[9];
+    Kc[194] = e_g[1]*e_g[25]; den[194] = e_g[1]*e_g[29];
+    Kc[195] = e_g[11]*e_g[18]; den[195] = e_g[4]*e_g[9];
+    Kc[196] = e_g[11]*e_g[18]; den[196] = e_g[1]*e_g[17];
+    Kc[197] = e_g[11]*e_g[18]; den[197] = e_g[12]*e_g[16];
+    Kc[198] = e_g[3]*e_g[18]; den[198] = e_g[2]*e_g[16];
+    Kc[199] = e_g[10]*e_g[18]; den[199] = e_g[12]*e_g[17];
+    Kc[200] = e_g[1]*e_g[30]; den[200] = e_g[3]*e_g[7];
+    Kc[201] = e_g[1]*e_g[30]; den[201] = e_g[0]*e_g[29];
+    Kc[202] = e_g[11]*e_g[30]; den[202] = e_g[6]*e_g[7];
+    Kc[203] = e_g[12]*e_g[30]; den[203] = e_g[15]*e_g[29];
+    Kc[204] = e_g[10]*e_g[30]; den[204] = e_g[6]*e_g[9]*e_g[12];
+    Kc[205] = e_g[3]*e_g[30]; den[205] = e_g[1]*e_g[9]*e_g[21];
+    Kc[206] = e_g[13]*e_g[30]; den[206] = e_g[6]*e_g[7]*e_g[12];
+    Kc[207] = e_g[13]*e_g[30]; den[207] = e_g[10]*e_g[32];
+    Kc[208] = e_g[30]; den[208] = e_g[3]*e_g[9];
+    Kc[209] = e_g[30]; den[209] = e_g[1]*e_g[29];
+    Kc[210] = e_g[11]*e_g[29]; den[210] = e_g[4]*e_g[8];
+    Kc[211] = e_g[1]*e_g[29]; den[211] = e_g[3]*e_g[9];
+    Kc[212] = e_g[1]*e_g[29]; den[212] = e_g[0]*e_g[17];
+    Kc[213] = e_g[11]*e_g[29]; den[213] = e_g[12]*e_g[17];
+    Kc[214] = e_g[12]*e_g[29]; den[214] = e_g[15]*e_g[17];
+    Kc[215] = e_g[12]*e_g[29]; den[215] = e_g[9]*e_g[23];
+    Kc[216] = e_g[0]*e_g[16]; den[216] = e_g[1]*e_g[18];
+    Kc[217] = e_g[11]*e_g[16]; den[217] = e_g[5]*e_g[9];
+    Kc[218] = e_g[12]*e_g[16]; den[218] = e_g[1]*e_g[17];
+    Kc[219] = e_g[10]*e_g[16]; den[219] = e_g[1]*e_g[9]*e_g[9];
+    Kc[220] = e_g[17]*e_g[18]; den[220] = e_g[9]*e_g[26];
+    Kc[221] = e_g[1]*e_g[17]; den[221] = e_g[9]*e_g[28];
+    Kc[222] = e_g[11]*e_g[17]; den[222] = e_g[1]*e_g[9]*e_g[9];
+    Kc[223] = e_g[11]*e_g[17]; den[223] = e_g[5]*e_g[8];
+    Kc[224] = e_g[10]*e_g[17]; den[224] = e_g[7]*e_g[9]*e_g[11];
+    Kc[225] = e_g[10]*e_g[17]; den[225] = e_g[7]*e_g[8];
+    Kc[226] = e_g[5]*e_g[17]; den[226] = e_g[9]*e_g[18];
+    Kc[227] = e_g[17]*e_g[17]; den[227] = e_g[9]*e_g[9]*e_g[18];
+    int inrange = 1;
+    for (int i=0; i<228; ++i) {
+        inrange &= Kc[i] >= DBL_MIN && Kc[i] <= DBL_MAX && den[i] >= DBL_MIN && den[i] <= DBL_MAX;
+    }
+
+    if (inrange) {
+        for (int i=0; i<228; ++i) {
+            Kc[i] /= den[i];
+        }
+    }
+    else {
+        Kc[0] = exp(g_RT[12] + g_RT[12] - g_RT[14]);
+        Kc[1] = exp(g_RT[3] + g_RT[3] - g_RT[22]);
+        Kc[2] = exp(g_RT[1] - g_RT[2] + g_RT[3]);
+        Kc[3] = exp(g_RT[1] + g_RT[6] - g_RT[24]);
+        Kc[4] = exp(g_RT[1] + g_RT[6] - g_RT[23]);
+        Kc[5] = exp(-g_RT[3] - g_RT[23] + g_RT[33]);
+        Kc[6] = exp(-g_RT[12] - g_RT[21] + g_RT[33]);
+        Kc[7] = exp(-g_RT[15] - g_RT[20] + g_RT[33]);
+        Kc[8] = exp(-g_RT[0] - g_RT[32] + g_RT[33]);
+        Kc[9] = exp(g_RT[1] + g_RT[20] - g_RT[21]);
+        Kc[10] = exp(g_RT[1] + g_RT[19] - g_RT[20]);
+        Kc[11] = exp(g_RT[1] + g_RT[18] - g_RT[19]);
+        Kc[12] = exp(g_RT[1] + g_RT[10] - g_RT[13]);
+        Kc[16] = exp(-g_RT[0] - g_RT[18] + g_RT[20]);
+        Kc[17] = exp(-g_RT[3] - g_RT[9] + g_RT[31]);
+        Kc[18] = exp(-g_RT[4] - g_RT[9] + g_RT[29]);
+        Kc[19] = exp(-g_RT[0] + g_RT[1] + g_RT[1]);
+        Kc[20] = exp(g_RT[1] + g_RT[12] - g_RT[15]);
+        Kc[21] = exp(g_RT[1] + g_RT[11] - g_RT[12]);
+        Kc[22] = exp(-g_RT[10] + g_RT[11] + g_RT[11]);
+        Kc[23] = exp(-g_RT[0] + g_RT[3] - g_RT[5]);
+        Kc[24] = exp(-g_RT[1] + g_RT[3] - g_RT[4]);
+        Kc[25] = exp(-g_RT[4] + g_RT[28]);
+        Kc[26] = exp(-g_RT[1] + g_RT[6] - g_RT[7]);
+        Kc[27] = exp(-g_RT[1] + g_RT[7] - g_RT[9]);
+        Kc[28] = exp(-g_RT[8] + g_RT[9] + g_RT[11]);
+        Kc[29] = exp(-g_RT[1] - g_RT[32] + g_RT[36]);
+        Kc[30] = exp(-g_RT[3] - g_RT[6] + g_RT[36]);
+        Kc[31] = exp(-g_RT[1] - g_RT[32] + g_RT[35]);
+        Kc[32] = exp(-g_RT[1] - g_RT[16] + g_RT[18]);
+        Kc[33] = exp(g_RT[0] - g_RT[1] + g_RT[12] - g_RT[15]);
+        Kc[34] = exp(-g_RT[1] - g_RT[10] + g_RT[11] + g_RT[12]);
+        Kc[35] = exp(g_RT[0] - g_RT[1] + g_RT[11] - g_RT[12]);
+        Kc[36] = exp(-g_RT[10] + g_RT[12] + g_RT[13] - g_RT[15]);
+        Kc[38] = exp(g_RT[1] - g_RT[12] - g_RT[12] + g_RT[13]);
+        Kc[39] = exp(-g_RT[0] + g_RT[1] - g_RT[10] + g_RT[13]);
+        Kc[40] = exp(g_RT[1] - g_RT[11] + g_RT[13] - g_RT[15]);
+        Kc[41] = exp(-g_RT[10] + g_RT[11] - g_RT[12] + g_RT[13]);
+        Kc[42] = exp(-g_RT[11] + g_RT[12] + g_RT[12] - g_RT[15]);
+        Kc[43] = exp(g_RT[0] - g_RT[0] - g_RT[0] + g_RT[1] + g_RT[1]);
+        Kc[44] = exp(-g_RT[0] + g_RT[1] + g_RT[1] + g_RT[15] - g_RT[15]);
+        Kc[45] = exp(-g_RT[10] + g_RT[13] + g_RT[13] - g_RT[14]);
+        Kc[47] = exp(-g_RT[0] + g_RT[1] - g_RT[13] + g_RT[14]);
+        Kc[48] = exp(g_RT[1] - g_RT[12] + g_RT[14] - g_RT[15]);
+        Kc[49] = exp(g_RT[11] - g_RT[12] - g_RT[13] + g_RT[14]);
+        Kc[50] = exp(g_RT[12] - g_RT[13] + g_RT[14] - g_RT[15]);
+        Kc[51] = exp(-g_RT[0] + g_RT[1] + g_RT[2] - g_RT[3]);
+        Kc[52] = exp(g_RT[2] - g_RT[3] + g_RT[12] - g_RT[15]);
+        Kc[53] = exp(g_RT[2] - g_RT[3] + g_RT[11] - g_RT[12]);
+        Kc[54] = exp(g_RT[2] - g_RT[3] + g_RT[13] - g_RT[14]);
+        Kc[55] = exp(g_RT[3] - g_RT[12] + g_RT[13] - g_RT[24]);
+        Kc[56] = exp(-g_RT[2] + g_RT[3] - g_RT[10] + g_RT[13]);
+        Kc[57] = exp(-g_RT[1] + g_RT[3] - g_RT[6] + g_RT[11]);
+        Kc[58] = exp(g_RT[3] + g_RT[10] - g_RT[11] - g_RT[24]);
+        Kc[59] = exp(g_RT[3] - g_RT[6] + g_RT[10] - g_RT[12]);
+        Kc[60] = exp(g_RT[1] - g_RT[3] - g_RT[12] + g_RT[24]);
+        Kc[61] = exp(g_RT[1] - g_RT[3] - g_RT[12] + g_RT[23]);
+        Kc[62] = exp(g_RT[3] + g_RT[12] - g_RT[15] - g_RT[28]);
+        Kc[63] = exp(g_RT[3] - g_RT[4] + g_RT[12] - g_RT[15]);
+        Kc[64] = exp(-g_RT[0] + g_RT[1] + g_RT[3] - g_RT[4]);
+        Kc[65] = exp(-g_RT[2] + g_RT[3] - g_RT[6] + g_RT[24]);
+        Kc[66] = exp(-g_RT[0] + g_RT[1] - g_RT[6] + g_RT[24]);
+        Kc[67] = exp(-g_RT[0] + g_RT[1] - g_RT[6] + g_RT[23]);
+        Kc[68] = exp(-g_RT[6] + g_RT[12] - g_RT[15] + g_RT[24]);
+        Kc[69] = exp(-g_RT[6] + g_RT[12] - g_RT[15] + g_RT[23]);
+        Kc[70] = exp(-g_RT[6] + g_RT[11] - g_RT[12] + g_RT[24]);
+        Kc[71] = exp(-g_RT[6] + g_RT[11] - g_RT[12] + g_RT[23]);
+        Kc[72] = exp(-g_RT[6] + g_RT[10] - g_RT[13] + g_RT[24]);
+        Kc[73] = exp(-g_RT[3] - g_RT[8] + g_RT[9] + g_RT[24]);
+        Kc[74] = exp(-g_RT[6] + g_RT[10] - g_RT[13] + g_RT[23]);
+        Kc[76] = exp(-g_RT[0] + g_RT[1] + g_RT[4] - g_RT[5]);
+        Kc[77] = exp(g_RT[4] - g_RT[5] + g_RT[12] - g_RT[15]);
+        Kc[78] = exp(-g_RT[1] + g_RT[4] - g_RT[6] + g_RT[12]);
+        Kc[79] = exp(g_RT[4] - g_RT[6] + g_RT[8] - g_RT[9]);
+        Kc[80] = exp(-g_RT[1] - g_RT[1] + g_RT[4] - g_RT[9] + g_RT[11]);
+        Kc[81] = exp(-g_RT[0] + g_RT[4] - g_RT[9] + g_RT[11]);
+        Kc[82] = exp(g_RT[4] - g_RT[6] + g_RT[10] - g_RT[11]);
+        Kc[83] = exp(-g_RT[1] - g_RT[1] + g_RT[4] - g_RT[8] + g_RT[10]);
+        Kc[84] = exp(-g_RT[0] + g_RT[4] - g_RT[8] + g_RT[10]);
+        Kc[85] = exp(g_RT[4] - g_RT[9] + g_RT[10] - g_RT[15]);
+        Kc[86] = exp(g_RT[4] - g_RT[7] + g_RT[10] - g_RT[12]);
+        Kc[87] = exp(-g_RT[1] + g_RT[3] + g_RT[4] - g_RT[20]);
+        Kc[88] = exp(-g_RT[1] - g_RT[1] + g_RT[4] + g_RT[4] - g_RT[18]);
+        Kc[89] = exp(g_RT[4] - g_RT[9] + g_RT[17] - g_RT[19]);
+        Kc[90] = exp(-g_RT[1] + g_RT[4] + g_RT[18] - g_RT[26]);
+        Kc[91] = exp(g_RT[2] - g_RT[3] - g_RT[3] + g_RT[28]);
+        Kc[92] = exp(-g_RT[3] - g_RT[21] + g_RT[22] + g_RT[28]);
+        Kc[93] = exp(-g_RT[1] - g_RT[9] + g_RT[10] - g_RT[12] + g_RT[28]);
+        Kc[94] = exp(g_RT[0] - g_RT[1] - g_RT[3] + g_RT[28]);
+        Kc[95] = exp(-g_RT[1] + g_RT[18] - g_RT[26] + g_RT[28]);
+        Kc[96] = exp(-g_RT[1] - g_RT[1] - g_RT[9] + g_RT[11] + g_RT[28]);
+        Kc[97] = exp(-g_RT[1] - g_RT[6] + g_RT[12] + g_RT[28]);
+        Kc[98] = exp(-g_RT[0] + g_RT[1] - g_RT[5] + g_RT[28]);
+        Kc[99] = exp(-g_RT[6] + g_RT[8] - g_RT[9] + g_RT[28]);
+        Kc[100] = exp(-g_RT[1] + g_RT[3] - g_RT[20] + g_RT[28]);
+        Kc[101] = exp(-g_RT[9] - g_RT[20] + g_RT[28] + g_RT[29]);
+        Kc[102] = exp(g_RT[5] - g_RT[7] + g_RT[10] - g_RT[11]);
+        Kc[103] = exp(-g_RT[1] + g_RT[5] - g_RT[9] + g_RT[11]);
+        Kc[104] = exp(-g_RT[1] + g_RT[5] - g_RT[7] + g_RT[12]);
+        Kc[105] = exp(g_RT[5] - g_RT[7] + g_RT[8] - g_RT[9]);
+        Kc[106] = exp(-g_RT[1] + g_RT[5] - g_RT[6] + g_RT[15]);
+        Kc[107] = exp(-g_RT[1] + g_RT[5] + g_RT[6] - g_RT[29]);
+        Kc[108] = exp(-g_RT[1] + g_RT[5] + g_RT[18] - g_RT[27]);
+        Kc[109] = exp(-g_RT[1] + g_RT[4] + g_RT[5] - g_RT[18]);
+        Kc[110] = exp(-g_RT[1] + g_RT[3] + g_RT[5] - g_RT[19]);
+        Kc[111] = exp(-g_RT[1] + g_RT[2] + g_RT[5] - g_RT[20]);
+        Kc[112] = exp(g_RT[6] - g_RT[7] + g_RT[12] - g_RT[15]);
+        Kc[113] = exp(-g_RT[0] + g_RT[1] + g_RT[6] - g_RT[7]);
+        Kc[114] = exp(g_RT[6] - g_RT[7] + g_RT[11] - g_RT[12]);
+        Kc[115] = exp(g_RT[7] - g_RT[9] + g_RT[10] - g_RT[13]);
+        Kc[116] = exp(g_RT[7] - g_RT[9] + g_RT[12] - g_RT[15]);
+        Kc[117] = exp(-g_RT[0] + g_RT[1] + g_RT[7] - g_RT[9]);
+        Kc[118] = exp(g_RT[7] - g_RT[9] + g_RT[11] - g_RT[12]);
+        Kc[119] = exp(-g_RT[1] + g_RT[7] - g_RT[8] + g_RT[11]);
+        Kc[120] = exp(-g_RT[1] - g_RT[8] + g_RT[9] + g_RT[12]);
+        Kc[121] = exp(-g_RT[8] + g_RT[9] + g_RT[10] - g_RT[11]);
+        Kc[122] = exp(-g_RT[8] + g_RT[9] - g_RT[12] + g_RT[13]);
+        Kc[123] = exp(g_RT[12] - g_RT[15] + g_RT[33] - g_RT[34]);
+        Kc[124] = exp(g_RT[12] - g_RT[15] + g_RT[33] - g_RT[35]);
+        Kc[125] = exp(g_RT[12] - g_RT[15] + g_RT[33] - g_RT[36]);
+        Kc[126] = exp(-g_RT[0] + g_RT[1] + g_RT[33] - g_RT[34]);
+        Kc[127] = exp(-g_RT[0] + g_RT[1] + g_RT[33] - g_RT[35]);
+        Kc[128] = exp(-g_RT[0] + g_RT[1] + g_RT[33] - g_RT[36]);
+        Kc[129] = exp(g_RT[11] - g_RT[12] + g_RT[33] - g_RT[34]);
+        Kc[130] = exp(g_RT[11] - g_RT[12] + g_RT[33] - g_RT[35]);
+        Kc[131] = exp(g_RT[11] - g_RT[12] + g_RT[33] - g_RT[36]);
+        Kc[132] = exp(-g_RT[2] + g_RT[3] + g_RT[33] - g_RT[34]);
+        Kc[133] = exp(-g_RT[2] + g_RT[3] + g_RT[33] - g_RT[35]);
+        Kc[134] = exp(-g_RT[2] + g_RT[3] + g_RT[33] - g_RT[36]);
+        Kc[135] = exp(g_RT[13] - g_RT[14] + g_RT[33] - g_RT[35]);
+        Kc[136] = exp(g_RT[13] - g_RT[14] + g_RT[33] - g_RT[34]);
+        Kc[137] = exp(g_RT[13] - g_RT[14] + g_RT[33] - g_RT[36]);
+        Kc[138] = exp(g_RT[10] - g_RT[13] - g_RT[32] + g_RT[36]);
+        Kc[139] = exp(-g_RT[8] + g_RT[9] - g_RT[21] + g_RT[36]);
+        Kc[140] = exp(g_RT[1] - g_RT[3] - g_RT[23] + g_RT[36]);
+        Kc[141] = exp(g_RT[1] - g_RT[15] - g_RT[20] + g_RT[36]);
+        Kc[142] = exp(g_RT[12] - g_RT[15] - g_RT[32] + g_RT[36]);
+        Kc[143] = exp(g_RT[10] - g_RT[13] - g_RT[32] + g_RT[35]);
+        Kc[145] = exp(g_RT[11] - g_RT[12] - g_RT[32] + g_RT[35]);
+        Kc[146] = exp(g_RT[1] - g_RT[15] - g_RT[20] + g_RT[35]);
+        Kc[147] = exp(g_RT[1] - g_RT[3] - g_RT[23] + g_RT[35]);
+        Kc[148] = exp(-g_RT[12] - g_RT[12] + g_RT[13] - g_RT[32] + g_RT[35]);
+        Kc[149] = exp(g_RT[12] - g_RT[15] - g_RT[32] + g_RT[35]);
+        Kc[150] = exp(g_RT[12] - g_RT[15] - g_RT[31] + g_RT[32]);
+        Kc[151] = exp(g_RT[12] - g_RT[15] - g_RT[30] + g_RT[32]);
+        Kc[152] = exp(g_RT[11] - g_RT[12] - g_RT[31] + g_RT[32]);
+        Kc[153] = exp(g_RT[11] - g_RT[12] - g_RT[30] + g_RT[32]);
+        Kc[154] = exp(-g_RT[0] + g_RT[1] - g_RT[31] + g_RT[32]);
+        Kc[155] = exp(-g_RT[0] + g_RT[1] - g_RT[30] + g_RT[32]);
+        Kc[156] = exp(-g_RT[2] + g_RT[3] - g_RT[31] + g_RT[32]);
+        Kc[157] = exp(-g_RT[2] + g_RT[3] - g_RT[30] + g_RT[32]);
+        Kc[158] = exp(g_RT[13] - g_RT[14] - g_RT[31] + g_RT[32]);
+        Kc[159] = exp(g_RT[13] - g_RT[14] - g_RT[30] + g_RT[32]);
+        Kc[160] = exp(g_RT[10] - g_RT[13] - g_RT[31] + g_RT[32]);
+        Kc[161] = exp(-g_RT[2] + g_RT[3] - g_RT[21] + g_RT[22]);
+        Kc[162] = exp(-g_RT[0] + g_RT[1] - g_RT[21] + g_RT[22]);
+        Kc[163] = exp(g_RT[11] - g_RT[12] - g_RT[21] + g_RT[22]);
+        Kc[164] = exp(g_RT[12] - g_RT[15] - g_RT[21] + g_RT[22]);
+        Kc[165] = exp(-g_RT[0] + g_RT[1] - g_RT[20] + g_RT[21]);
+        Kc[166] = exp(g_RT[1] - g_RT[3] - g_RT[3] + g_RT[21]);
+        Kc[167] = exp(g_RT[1] + g_RT[21] - g_RT[22]);
+        Kc[168] = exp(g_RT[12] - g_RT[15] - g_RT[20] + g_RT[21]);
+        Kc[169] = exp(-g_RT[3] - g_RT[6] + g_RT[11] + g_RT[21]);
+        Kc[170] = exp(-g_RT[10] + g_RT[13] + g_RT[21] - g_RT[22]);
+        Kc[171] = exp(-g_RT[12] + g_RT[13] + g_RT[21] - g_RT[36]);
+        Kc[172] = exp(g_RT[10] - g_RT[13] - g_RT[20] + g_RT[21]);
+        Kc[173] = exp(g_RT[10] - g_RT[12] + g_RT[21] - g_RT[32]);
+        Kc[174] = exp(g_RT[12] + g_RT[20] - g_RT[34]);
+        Kc[175] = exp(g_RT[12] - g_RT[15] - g_RT[19] + g_RT[20]);
+        Kc[176] = exp(-g_RT[3] - g_RT[7] + g_RT[11] + g_RT[20]);
+        Kc[177] = exp(-g_RT[1] + g_RT[11] + g_RT[20] - g_RT[30]);
+        Kc[178] = exp(-g_RT[2] + g_RT[3] - g_RT[19] + g_RT[20]);
+        Kc[179] = exp(-g_RT[0] + g_RT[1] - g_RT[19] + g_RT[20]);
+        Kc[180] = exp(-g_RT[0] + g_RT[1] - g_RT[18] + g_RT[19]);
+        Kc[181] = exp(-g_RT[1] + g_RT[11] + g_RT[19] - g_RT[29]);
+        Kc[182] = exp(-g_RT[6] - g_RT[7] + g_RT[10] + g_RT[19]);
+        Kc[183] = exp(g_RT[10] - g_RT[11] + g_RT[19] - g_RT[30]);
+        Kc[184] = exp(g_RT[10] - g_RT[13] - g_RT[18] + g_RT[19]);
+        Kc[185] = exp(g_RT[12] - g_RT[15] - g_RT[18] + g_RT[19]);
+        Kc[186] = exp(g_RT[16] - g_RT[18] - g_RT[18] + g_RT[19]);
+        Kc[187] = exp(-g_RT[4] + g_RT[5] - g_RT[18] + g_RT[19]);
+        Kc[188] = exp(-g_RT[2] + g_RT[3] - g_RT[18] + g_RT[19]);
+        Kc[189] = exp(g_RT[12] - g_RT[15] - g_RT[16] + g_RT[18]);
+        Kc[190] = exp(-g_RT[1] + g_RT[12] + g_RT[18] - g_RT[25]);
+        Kc[191] = exp(-g_RT[1] + g_RT[12] + g_RT[18] - g_RT[29]);
+        Kc[193] = exp(-g_RT[3] - g_RT[9] + g_RT[12] + g_RT[18]);
+        Kc[194] = exp(g_RT[1] - g_RT[1] + g_RT[25] - g_RT[29]);
+        Kc[195] = exp(-g_RT[4] - g_RT[9] + g_RT[11] + g_RT[18]);
+        Kc[196] = exp(-g_RT[1] + g_RT[11] - g_RT[17] + g_RT[18]);
+        Kc[197] = exp(g_RT[11] - g_RT[12] - g_RT[16] + g_RT[18]);
+        Kc[198] = exp(-g_RT[2] + g_RT[3] - g_RT[16] + g_RT[18]);
+        Kc[199] = exp(g_RT[10] - g_RT[12] - g_RT[17] + g_RT[18]);
+        Kc[200] = exp(g_RT[1] - g_RT[3] - g_RT[7] + g_RT[30]);
+        Kc[201] = exp(-g_RT[0] + g_RT[1] - g_RT[29] + g_RT[30]);
+        Kc[202] = exp(-g_RT[6] - g_RT[7] + g_RT[11] + g_RT[30]);
+        Kc[203] = exp(g_RT[12] - g_RT[15] - g_RT[29] + g_RT[30]);
+        Kc[204] = exp(-g_RT[6] - g_RT[9] + g_RT[10] - g_RT[12] + g_RT[30]);
+        Kc[205] = exp(-g_RT[1] + g_RT[3] - g_RT[9] - g_RT[21] + g_RT[30]);
+        Kc[206] = exp(-g_RT[6] - g_RT[7] - g_RT[12] + g_RT[13] + g_RT[30]);
+        Kc[207] = exp(-g_RT[10] + g_RT[13] + g_RT[30] - g_RT[32]);
+        Kc[208] = exp(-g_RT[3] - g_RT[9] + g_RT[30]);
+        Kc[209] = exp(-g_RT[1] - g_RT[29] + g_RT[30]);
+        Kc[210] = exp(-g_RT[4] - g_RT[8] + g_RT[11] + g_RT[29]);
+        Kc[211] = exp(g_RT[1] - g_RT[3] - g_RT[9] + g_RT[29]);
+        Kc[212] = exp(-g_RT[0] + g_RT[1] - g_RT[17] + g_RT[29]);
+        Kc[213] = exp(g_RT[11] - g_RT[12] - g_RT[17] + g_RT[29]);
+        Kc[214] = exp(g_RT[12] - g_RT[15] - g_RT[17] + g_RT[29]);
+        Kc[215] = exp(-g_RT[9] + g_RT[12] - g_RT[23] + g_RT[29]);
+        Kc[216] = exp(g_RT[0] - g_RT[1] + g_RT[16] - g_RT[18]);
+        Kc[217] = exp(-g_RT[5] - g_RT[9] + g_RT[11] + g_RT[16]);
+        Kc[218] = exp(-g_RT[1] + g_RT[12] + g_RT[16] - g_RT[17]);
+        Kc[219] = exp(-g_RT[1] - g_RT[9] - g_RT[9] + g_RT[10] + g_RT[16]);
+        Kc[220] = exp(-g_RT[9] + g_RT[17] + g_RT[18] - g_RT[26]);
+        Kc[221] = exp(g_RT[1] - g_RT[9] + g_RT[17] - g_RT[28]);
+        Kc[222] = exp(-g_RT[1] - g_RT[9] - g_RT[9] + g_RT[11] + g_RT[17]);
+        Kc[223] = exp(-g_RT[5] - g_RT[8] + g_RT[11] + g_RT[17]);
+        Kc[224] = exp(-g_RT[7] - g_RT[9] + g_RT[10] - g_RT[11] + g_RT[17]);
+        Kc[225] = exp(-g_RT[7] - g_RT[8] + g_RT[10] + g_RT[17]);
+        Kc[226] = exp(g_RT[5] - g_RT[9] + g_RT[17] - g_RT[18]);
+        Kc[227] = exp(-g_RT[9] - g_RT[9] + g_RT[17] + g_RT[17] - g_RT[18]);
+
+        /*reactions with the net stoichiometry of an earlier one */
+        Kc[13] = Kc[12];
+        Kc[14] = Kc[12];
+        Kc[15] = Kc[12];
+        Kc[37] = Kc[36];
+        Kc[46] = Kc[45];
+        Kc[75] = Kc[74];
+        Kc[144] = Kc[143];
+        Kc[192] = Kc[191];
+
+        Kc[0] *= refCinv;
+        Kc[1] *= refCinv;
+        Kc[2] *= refCinv;
+        Kc[3] *= refCinv;
+        Kc[4] *= refCinv;
+        Kc[5] *= refC;
+        Kc[6] *= refC;
+        Kc[7] *= refC;
+        Kc[8] *= refC;
+        Kc[9] *= refCinv;
+        Kc[10] *= refCinv;
+        Kc[11] *= refCinv;
+        Kc[12] *= refCinv;
+        Kc[13] *= refCinv;
+        Kc[14] *= refCinv;
+        Kc[15] *= refCinv;
+        Kc[16] *= refC;
+        Kc[17] *= refC;
+        Kc[18] *= refC;
+        Kc[19] *= refCinv;
+        Kc[20] *= refCinv;
+        Kc[21] *= refCinv;
+        Kc[22] *= refCinv;
+        Kc[23] *= refC;
+        Kc[24] *= refC;
+        Kc[26] *= refC;
+        Kc[27] *= refC;
+        Kc[28] *= refCinv;
+        Kc[29] *= refC;
+        Kc[30] *= refC;
+        Kc[31] *= refC;
+        Kc[32] *= refC;
+        Kc[43] *= refCinv;
+        Kc[44] *= refCinv;
+        Kc[80] *= refC;
+        Kc[83] *= refC;
+        Kc[88] *= refC;
+        Kc[93] *= refC;
+        Kc[96] *= refC;
+        Kc[148] *= refC;
+        Kc[167] *= refCinv;
+        Kc[174] *= refCinv;
+        Kc[204] *= refC;
+        Kc[205] *= refC;
+        Kc[206] *= refC;
+        Kc[208] *= refC;
+        Kc[209] *= refC;
+        Kc[219] *= refC;
+        Kc[222] *= refC;
+        Kc[224] *= refC;
+        Kc[227] *= refC;
+    }
 
     return;
 }
@@ -13697,6 +14314,11 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         mixture += sc[i];
     }
 
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[1][0] - 1)*sc[15] + (TB[1][1] - 1)*sc[0] + (TB[1][2] - 1)*sc[8] + (TB[1][3] - 1)*sc[9];
+    double alpha_eff1 = mixture + (TB[3][0] - 1)*sc[15];
+    double alpha_eff2 = mixture + (TB[20][0] - 1)*sc[15];
+
     double Corr[228];
     for (int i = 0; i < 228; ++i) {
         Corr[i] = 1.0;
@@ -13706,17 +14328,17 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
     {
         double alpha[12];
         alpha[0] = mixture;
-        alpha[1] = mixture + (TB[1][0] - 1)*sc[15] + (TB[1][1] - 1)*sc[0] + (TB[1][2] - 1)*sc[8] + (TB[1][3] - 1)*sc[9];
-        alpha[2] = mixture + (TB[2][0] - 1)*sc[15] + (TB[2][1] - 1)*sc[0] + (TB[2][2] - 1)*sc[8] + (TB[2][3] - 1)*sc[9];
-        alpha[3] = mixture + (TB[3][0] - 1)*sc[15];
-        alpha[4] = mixture + (TB[4][0] - 1)*sc[15];
-        alpha[5] = mixture + (TB[5][0] - 1)*sc[15] + (TB[5][1] - 1)*sc[0] + (TB[5][2] - 1)*sc[8] + (TB[5][3] - 1)*sc[9];
-        alpha[6] = mixture + (TB[6][0] - 1)*sc[15] + (TB[6][1] - 1)*sc[0] + (TB[6][2] - 1)*sc[8] + (TB[6][3] - 1)*sc[9];
-        alpha[7] = mixture + (TB[7][0] - 1)*sc[15];
-        alpha[8] = mixture + (TB[8][0] - 1)*sc[15];
-        alpha[9] = mixture + (TB[9][0] - 1)*sc[15] + (TB[9][1] - 1)*sc[0] + (TB[9][2] - 1)*sc[8] + (TB[9][3] - 1)*sc[9];
-        alpha[10] = mixture + (TB[10][0] - 1)*sc[15];
-        alpha[11] = mixture + (TB[11][0] - 1)*sc[15] + (TB[11][1] - 1)*sc[0] + (TB[11][2] - 1)*sc[8] + (TB[11][3] - 1)*sc[9];
+        alpha[1] = alpha_eff0;
+        alpha[2] = (memcmp(TB[2], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[2][0] - 1)*sc[15] + (TB[2][1] - 1)*sc[0] + (TB[2][2] - 1)*sc[8] + (TB[2][3] - 1)*sc[9]);
+        alpha[3] = alpha_eff1;
+        alpha[4] = (memcmp(TB[4], TB[3], 1*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[4][0] - 1)*sc[15]);
+        alpha[5] = (memcmp(TB[5], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[5][0] - 1)*sc[15] + (TB[5][1] - 1)*sc[0] + (TB[5][2] - 1)*sc[8] + (TB[5][3] - 1)*sc[9]);
+        alpha[6] = (memcmp(TB[6], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[6][0] - 1)*sc[15] + (TB[6][1] - 1)*sc[0] + (TB[6][2] - 1)*sc[8] + (TB[6][3] - 1)*sc[9]);
+        alpha[7] = (memcmp(TB[7], TB[3], 1*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[7][0] - 1)*sc[15]);
+        alpha[8] = (memcmp(TB[8], TB[3], 1*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[8][0] - 1)*sc[15]);
+        alpha[9] = (memcmp(TB[9], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[9][0] - 1)*sc[15] + (TB[9][1] - 1)*sc[0] + (TB[9][2] - 1)*sc[8] + (TB[9][3] - 1)*sc[9]);
+        alpha[10] = (memcmp(TB[10], TB[3], 1*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[10][0] - 1)*sc[15]);
+        alpha[11] = (memcmp(TB[11], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[11][0] - 1)*sc[15] + (TB[11][1] - 1)*sc[0] + (TB[11][2] - 1)*sc[8] + (TB[11][3] - 1)*sc[9]);
 #ifdef __INTEL_COMPILER
          #pragma simd
 #endif
@@ -13763,9 +14385,9 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         double alpha;
         alpha = mixture + (TB[19][0] - 1)*sc[15] + (TB[19][1] - 1)*sc[0];
         Corr[19] = alpha;
-        alpha = mixture + (TB[20][0] - 1)*sc[15];
+        alpha = alpha_eff2;
         Corr[20] = alpha;
-        alpha = mixture + (TB[21][0] - 1)*sc[15];
+        alpha = (memcmp(TB[21], TB[20], 1*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[21][0] - 1)*sc[15]);
         Corr[21] = alpha;
         alpha = mixture;
         Corr[22] = alpha;
@@ -17863,17 +18485,24 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         mixture += sc[k];
     }
 
-    /*compute the Gibbs free energy */
-    double g_RT[38];
-    gibbs(g_RT, tc);
-
     /*compute the species enthalpy */
     double h_RT[38];
     speciesEnthalpy(h_RT, tc);
 
+    /*compute the rate and equilibrium constants */
+    double k_f_s[228], Kc_s[228];
+    comp_k_f(tc, invT, k_f_s);
+    comp_Kc(tc, invT, Kc_s);
+
+    /*at constant volume, the part of dwdot/d[X] common to all species */
+    double Jmix[38];
+    for (int k=0; k<38; k++) {
+        Jmix[k] = 0.0;
+    }
+
     double phi_f, k_f, k_r, phi_r, Kc, q, q_nocor, Corr, alpha;
     double dlnkfdT, dlnk0dT, dlnKcdT, dkrdT, dqdT;
-    double dqdci, dcdc_fac, dqdc[38];
+    double dqdci, dcdc_fac;
     double Pr, fPr, F, k_0, logPr;
     double logFcent, troe_c, troe_n, troePr_den, troePr, troe;
     double Fcent1, Fcent2, Fcent3, Fcent;
@@ -17881,6 +18510,12 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     double dlogPrdT, dlogfPrdT, dlogFdT, dlogFcentdT, dlogFdlogPr, dlnCorrdT;
     const double ln10 = log(10.0);
     const double log10e = 1.0/log(10.0);
+
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[1][0] - 1)*sc[15] + (TB[1][1] - 1)*sc[0] + (TB[1][2] - 1)*sc[8] + (TB[1][3] - 1)*sc[9];
+    double alpha_eff1 = mixture + (TB[3][0] - 1)*sc[15];
+    double alpha_eff2 = mixture + (TB[20][0] - 1)*sc[15];
+
     /*reaction 1: oh + oh (+M) <=> h2o2 (+M) */
     /*a pressure-fall-off reaction */
     /* also 3-body */
@@ -17888,8 +18523,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[12]*sc[12];
-    k_f = prefactor_units[0] * fwd_A[0]
-                * exp(fwd_beta[0] * tc[0] - activation_units[0] * fwd_Ea[0] * invT);
+    k_f = k_f_s[0];
     dlnkfdT = fwd_beta[0] * invT + activation_units[0] * fwd_Ea[0] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[0] * exp(low_beta[0] * tc[0] - activation_units[0] * low_Ea[0] * invT);
@@ -17905,16 +18539,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[0] == 4 ? exp(-troe_Tss[0] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
+      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
+      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
-      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
-      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -17922,7 +18556,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[14];
-    Kc = refCinv * exp(g_RT[12] + g_RT[12] - g_RT[14]);
+    Kc = Kc_s[0];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[12]) + (h_RT[14]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -17939,60 +18573,17 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[oh] */
-        dqdci =  + k_f*2*sc[12];
-        J[480] += -2 * dqdci;         /* dwdot[oh]/d[oh] */
-        J[482] += dqdci;              /* dwdot[h2o2]/d[oh] */
-        /* d()/d[h2o2] */
-        dqdci =  - k_r;
-        J[558] += -2 * dqdci;         /* dwdot[oh]/d[h2o2] */
-        J[560] += dqdci;              /* dwdot[h2o2]/d[h2o2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*2*sc[12];
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac - k_r;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+12] += -2 * dqdc[k];
-            J[39*k+14] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[12] += -2 * dcdc_fac;
+    Jmix[14] += dcdc_fac;
+    /* d()/d[oh] */
+    dqdci =  + k_f*2*sc[12];
+    J[480] += -2 * dqdci;         /* dwdot[oh]/d[oh] */
+    J[482] += dqdci;              /* dwdot[h2o2]/d[oh] */
+    /* d()/d[h2o2] */
+    dqdci =  - k_r;
+    J[558] += -2 * dqdci;         /* dwdot[oh]/d[h2o2] */
+    J[560] += dqdci;              /* dwdot[h2o2]/d[h2o2] */
     J[1494] += -2 * dqdT; /* dwdot[oh]/dT */
     J[1496] += dqdT; /* dwdot[h2o2]/dT */
 
@@ -18000,11 +18591,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[1][0] - 1)*sc[15] + (TB[1][1] - 1)*sc[0] + (TB[1][2] - 1)*sc[8] + (TB[1][3] - 1)*sc[9];
+    alpha = alpha_eff0;
     /* forward */
     phi_f = sc[3]*sc[3];
-    k_f = prefactor_units[1] * fwd_A[1]
-                * exp(fwd_beta[1] * tc[0] - activation_units[1] * fwd_Ea[1] * invT);
+    k_f = k_f_s[1];
     dlnkfdT = fwd_beta[1] * invT + activation_units[1] * fwd_Ea[1] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[1] * exp(low_beta[1] * tc[0] - activation_units[1] * low_Ea[1] * invT);
@@ -18020,16 +18610,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[1] == 4 ? exp(-troe_Tss[1] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
+      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
+      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
-      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
-      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -18037,7 +18627,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[22];
-    Kc = refCinv * exp(g_RT[3] + g_RT[3] - g_RT[22]);
+    Kc = Kc_s[1];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[3]) + (h_RT[22]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18054,76 +18644,33 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[h2] */
-        dqdci = (TB[1][1] - 1)*dcdc_fac;
-        J[3] += -2 * dqdci;           /* dwdot[ch3]/d[h2] */
-        J[22] += dqdci;               /* dwdot[c2h6]/d[h2] */
-        /* d()/d[ch3] */
-        dqdci =  + k_f*2*sc[3];
-        J[120] += -2 * dqdci;         /* dwdot[ch3]/d[ch3] */
-        J[139] += dqdci;              /* dwdot[c2h6]/d[ch3] */
-        /* d()/d[co2] */
-        dqdci = (TB[1][2] - 1)*dcdc_fac;
-        J[315] += -2 * dqdci;         /* dwdot[ch3]/d[co2] */
-        J[334] += dqdci;              /* dwdot[c2h6]/d[co2] */
-        /* d()/d[co] */
-        dqdci = (TB[1][3] - 1)*dcdc_fac;
-        J[354] += -2 * dqdci;         /* dwdot[ch3]/d[co] */
-        J[373] += dqdci;              /* dwdot[c2h6]/d[co] */
-        /* d()/d[h2o] */
-        dqdci = (TB[1][0] - 1)*dcdc_fac;
-        J[588] += -2 * dqdci;         /* dwdot[ch3]/d[h2o] */
-        J[607] += dqdci;              /* dwdot[c2h6]/d[h2o] */
-        /* d()/d[c2h6] */
-        dqdci =  - k_r;
-        J[861] += -2 * dqdci;         /* dwdot[ch3]/d[c2h6] */
-        J[880] += dqdci;              /* dwdot[c2h6]/d[c2h6] */
-    }
-    else {
-        dqdc[0] = TB[1][1]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac + k_f*2*sc[3];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = TB[1][2]*dcdc_fac;
-        dqdc[9] = TB[1][3]*dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[1][0]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac - k_r;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+3] += -2 * dqdc[k];
-            J[39*k+22] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] += -2 * dcdc_fac;
+    Jmix[22] += dcdc_fac;
+    /* d()/d[h2] */
+    dqdci = (TB[1][1] - 1)*dcdc_fac;
+    J[3] += -2 * dqdci;           /* dwdot[ch3]/d[h2] */
+    J[22] += dqdci;               /* dwdot[c2h6]/d[h2] */
+    /* d()/d[ch3] */
+    dqdci =  + k_f*2*sc[3];
+    J[120] += -2 * dqdci;         /* dwdot[ch3]/d[ch3] */
+    J[139] += dqdci;              /* dwdot[c2h6]/d[ch3] */
+    /* d()/d[co2] */
+    dqdci = (TB[1][2] - 1)*dcdc_fac;
+    J[315] += -2 * dqdci;         /* dwdot[ch3]/d[co2] */
+    J[334] += dqdci;              /* dwdot[c2h6]/d[co2] */
+    /* d()/d[co] */
+    dqdci = (TB[1][3] - 1)*dcdc_fac;
+    J[354] += -2 * dqdci;         /* dwdot[ch3]/d[co] */
+    J[373] += dqdci;              /* dwdot[c2h6]/d[co] */
+    /* d()/d[h2o] */
+    dqdci = (TB[1][0] - 1)*dcdc_fac;
+    J[588] += -2 * dqdci;         /* dwdot[ch3]/d[h2o] */
+    J[607] += dqdci;              /* dwdot[c2h6]/d[h2o] */
+    /* d()/d[c2h6] */
+    dqdci =  - k_r;
+    J[861] += -2 * dqdci;         /* dwdot[ch3]/d[c2h6] */
+    J[880] += dqdci;              /* dwdot[c2h6]/d[c2h6] */
     J[1485] += -2 * dqdT; /* dwdot[ch3]/dT */
     J[1504] += dqdT; /* dwdot[c2h6]/dT */
 
@@ -18131,11 +18678,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[2][0] - 1)*sc[15] + (TB[2][1] - 1)*sc[0] + (TB[2][2] - 1)*sc[8] + (TB[2][3] - 1)*sc[9];
+    alpha = (memcmp(TB[2], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[2][0] - 1)*sc[15] + (TB[2][1] - 1)*sc[0] + (TB[2][2] - 1)*sc[8] + (TB[2][3] - 1)*sc[9]);
     /* forward */
     phi_f = sc[1]*sc[3];
-    k_f = prefactor_units[2] * fwd_A[2]
-                * exp(fwd_beta[2] * tc[0] - activation_units[2] * fwd_Ea[2] * invT);
+    k_f = k_f_s[2];
     dlnkfdT = fwd_beta[2] * invT + activation_units[2] * fwd_Ea[2] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[2] * exp(low_beta[2] * tc[0] - activation_units[2] * low_Ea[2] * invT);
@@ -18151,16 +18697,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[2] == 4 ? exp(-troe_Tss[2] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[2]) > 1.e-100 ? -Fcent1/troe_Tsss[2] : 0.)
+      + (fabs(troe_Ts[2]) > 1.e-100 ? -Fcent2/troe_Ts[2] : 0.)
+      + (troe_len[2] == 4 ? Fcent3*troe_Tss[2]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[2]) > 1.e-100 ? -Fcent1/troe_Tsss[2] : 0.)
-      + (fabs(troe_Ts[2]) > 1.e-100 ? -Fcent2/troe_Ts[2] : 0.)
-      + (troe_len[2] == 4 ? Fcent3*troe_Tss[2]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -18168,7 +18714,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[2];
-    Kc = refCinv * exp(g_RT[1] - g_RT[2] + g_RT[3]);
+    Kc = Kc_s[2];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3]) + (h_RT[2]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18186,88 +18732,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[h2] */
-        dqdci = (TB[2][1] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[h]/d[h2] */
-        J[2] += dqdci;                /* dwdot[ch4]/d[h2] */
-        J[3] -= dqdci;                /* dwdot[ch3]/d[h2] */
-        /* d()/d[h] */
-        dqdci =  + k_f*sc[3];
-        J[40] -= dqdci;               /* dwdot[h]/d[h] */
-        J[41] += dqdci;               /* dwdot[ch4]/d[h] */
-        J[42] -= dqdci;               /* dwdot[ch3]/d[h] */
-        /* d()/d[ch4] */
-        dqdci =  - k_r;
-        J[79] -= dqdci;               /* dwdot[h]/d[ch4] */
-        J[80] += dqdci;               /* dwdot[ch4]/d[ch4] */
-        J[81] -= dqdci;               /* dwdot[ch3]/d[ch4] */
-        /* d()/d[ch3] */
-        dqdci =  + k_f*sc[1];
-        J[118] -= dqdci;              /* dwdot[h]/d[ch3] */
-        J[119] += dqdci;              /* dwdot[ch4]/d[ch3] */
-        J[120] -= dqdci;              /* dwdot[ch3]/d[ch3] */
-        /* d()/d[co2] */
-        dqdci = (TB[2][2] - 1)*dcdc_fac;
-        J[313] -= dqdci;              /* dwdot[h]/d[co2] */
-        J[314] += dqdci;              /* dwdot[ch4]/d[co2] */
-        J[315] -= dqdci;              /* dwdot[ch3]/d[co2] */
-        /* d()/d[co] */
-        dqdci = (TB[2][3] - 1)*dcdc_fac;
-        J[352] -= dqdci;              /* dwdot[h]/d[co] */
-        J[353] += dqdci;              /* dwdot[ch4]/d[co] */
-        J[354] -= dqdci;              /* dwdot[ch3]/d[co] */
-        /* d()/d[h2o] */
-        dqdci = (TB[2][0] - 1)*dcdc_fac;
-        J[586] -= dqdci;              /* dwdot[h]/d[h2o] */
-        J[587] += dqdci;              /* dwdot[ch4]/d[h2o] */
-        J[588] -= dqdci;              /* dwdot[ch3]/d[h2o] */
-    }
-    else {
-        dqdc[0] = TB[2][1]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[3];
-        dqdc[2] = dcdc_fac - k_r;
-        dqdc[3] = dcdc_fac + k_f*sc[1];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = TB[2][2]*dcdc_fac;
-        dqdc[9] = TB[2][3]*dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[2][0]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+1] -= dqdc[k];
-            J[39*k+2] += dqdc[k];
-            J[39*k+3] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[2] += dcdc_fac;
+    Jmix[3] -= dcdc_fac;
+    /* d()/d[h2] */
+    dqdci = (TB[2][1] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[h]/d[h2] */
+    J[2] += dqdci;                /* dwdot[ch4]/d[h2] */
+    J[3] -= dqdci;                /* dwdot[ch3]/d[h2] */
+    /* d()/d[h] */
+    dqdci =  + k_f*sc[3];
+    J[40] -= dqdci;               /* dwdot[h]/d[h] */
+    J[41] += dqdci;               /* dwdot[ch4]/d[h] */
+    J[42] -= dqdci;               /* dwdot[ch3]/d[h] */
+    /* d()/d[ch4] */
+    dqdci =  - k_r;
+    J[79] -= dqdci;               /* dwdot[h]/d[ch4] */
+    J[80] += dqdci;               /* dwdot[ch4]/d[ch4] */
+    J[81] -= dqdci;               /* dwdot[ch3]/d[ch4] */
+    /* d()/d[ch3] */
+    dqdci =  + k_f*sc[1];
+    J[118] -= dqdci;              /* dwdot[h]/d[ch3] */
+    J[119] += dqdci;              /* dwdot[ch4]/d[ch3] */
+    J[120] -= dqdci;              /* dwdot[ch3]/d[ch3] */
+    /* d()/d[co2] */
+    dqdci = (TB[2][2] - 1)*dcdc_fac;
+    J[313] -= dqdci;              /* dwdot[h]/d[co2] */
+    J[314] += dqdci;              /* dwdot[ch4]/d[co2] */
+    J[315] -= dqdci;              /* dwdot[ch3]/d[co2] */
+    /* d()/d[co] */
+    dqdci = (TB[2][3] - 1)*dcdc_fac;
+    J[352] -= dqdci;              /* dwdot[h]/d[co] */
+    J[353] += dqdci;              /* dwdot[ch4]/d[co] */
+    J[354] -= dqdci;              /* dwdot[ch3]/d[co] */
+    /* d()/d[h2o] */
+    dqdci = (TB[2][0] - 1)*dcdc_fac;
+    J[586] -= dqdci;              /* dwdot[h]/d[h2o] */
+    J[587] += dqdci;              /* dwdot[ch4]/d[h2o] */
+    J[588] -= dqdci;              /* dwdot[ch3]/d[h2o] */
     J[1483] -= dqdT; /* dwdot[h]/dT */
     J[1484] += dqdT; /* dwdot[ch4]/dT */
     J[1485] -= dqdT; /* dwdot[ch3]/dT */
@@ -18276,11 +18779,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[3][0] - 1)*sc[15];
+    alpha = alpha_eff1;
     /* forward */
     phi_f = sc[1]*sc[6];
-    k_f = prefactor_units[3] * fwd_A[3]
-                * exp(fwd_beta[3] * tc[0] - activation_units[3] * fwd_Ea[3] * invT);
+    k_f = k_f_s[3];
     dlnkfdT = fwd_beta[3] * invT + activation_units[3] * fwd_Ea[3] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[3] * exp(low_beta[3] * tc[0] - activation_units[3] * low_Ea[3] * invT);
@@ -18296,16 +18798,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[3] == 4 ? exp(-troe_Tss[3] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[3]) > 1.e-100 ? -Fcent1/troe_Tsss[3] : 0.)
+      + (fabs(troe_Ts[3]) > 1.e-100 ? -Fcent2/troe_Ts[3] : 0.)
+      + (troe_len[3] == 4 ? Fcent3*troe_Tss[3]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[3]) > 1.e-100 ? -Fcent1/troe_Tsss[3] : 0.)
-      + (fabs(troe_Ts[3]) > 1.e-100 ? -Fcent2/troe_Ts[3] : 0.)
-      + (troe_len[3] == 4 ? Fcent3*troe_Tss[3]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -18313,7 +18815,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[24];
-    Kc = refCinv * exp(g_RT[1] + g_RT[6] - g_RT[24]);
+    Kc = Kc_s[3];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[6]) + (h_RT[24]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18331,73 +18833,30 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[h] */
-        dqdci =  + k_f*sc[6];
-        J[40] -= dqdci;               /* dwdot[h]/d[h] */
-        J[45] -= dqdci;               /* dwdot[ch2o]/d[h] */
-        J[63] += dqdci;               /* dwdot[ch3o]/d[h] */
-        /* d()/d[ch2o] */
-        dqdci =  + k_f*sc[1];
-        J[235] -= dqdci;              /* dwdot[h]/d[ch2o] */
-        J[240] -= dqdci;              /* dwdot[ch2o]/d[ch2o] */
-        J[258] += dqdci;              /* dwdot[ch3o]/d[ch2o] */
-        /* d()/d[h2o] */
-        dqdci = (TB[3][0] - 1)*dcdc_fac;
-        J[586] -= dqdci;              /* dwdot[h]/d[h2o] */
-        J[591] -= dqdci;              /* dwdot[ch2o]/d[h2o] */
-        J[609] += dqdci;              /* dwdot[ch3o]/d[h2o] */
-        /* d()/d[ch3o] */
-        dqdci =  - k_r;
-        J[937] -= dqdci;              /* dwdot[h]/d[ch3o] */
-        J[942] -= dqdci;              /* dwdot[ch2o]/d[ch3o] */
-        J[960] += dqdci;              /* dwdot[ch3o]/d[ch3o] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[6];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac + k_f*sc[1];
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[3][0]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac - k_r;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+1] -= dqdc[k];
-            J[39*k+6] -= dqdc[k];
-            J[39*k+24] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[6] -= dcdc_fac;
+    Jmix[24] += dcdc_fac;
+    /* d()/d[h] */
+    dqdci =  + k_f*sc[6];
+    J[40] -= dqdci;               /* dwdot[h]/d[h] */
+    J[45] -= dqdci;               /* dwdot[ch2o]/d[h] */
+    J[63] += dqdci;               /* dwdot[ch3o]/d[h] */
+    /* d()/d[ch2o] */
+    dqdci =  + k_f*sc[1];
+    J[235] -= dqdci;              /* dwdot[h]/d[ch2o] */
+    J[240] -= dqdci;              /* dwdot[ch2o]/d[ch2o] */
+    J[258] += dqdci;              /* dwdot[ch3o]/d[ch2o] */
+    /* d()/d[h2o] */
+    dqdci = (TB[3][0] - 1)*dcdc_fac;
+    J[586] -= dqdci;              /* dwdot[h]/d[h2o] */
+    J[591] -= dqdci;              /* dwdot[ch2o]/d[h2o] */
+    J[609] += dqdci;              /* dwdot[ch3o]/d[h2o] */
+    /* d()/d[ch3o] */
+    dqdci =  - k_r;
+    J[937] -= dqdci;              /* dwdot[h]/d[ch3o] */
+    J[942] -= dqdci;              /* dwdot[ch2o]/d[ch3o] */
+    J[960] += dqdci;              /* dwdot[ch3o]/d[ch3o] */
     J[1483] -= dqdT; /* dwdot[h]/dT */
     J[1488] -= dqdT; /* dwdot[ch2o]/dT */
     J[1506] += dqdT; /* dwdot[ch3o]/dT */
@@ -18406,11 +18865,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[4][0] - 1)*sc[15];
+    alpha = (memcmp(TB[4], TB[3], 1*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[4][0] - 1)*sc[15]);
     /* forward */
     phi_f = sc[1]*sc[6];
-    k_f = prefactor_units[4] * fwd_A[4]
-                * exp(fwd_beta[4] * tc[0] - activation_units[4] * fwd_Ea[4] * invT);
+    k_f = k_f_s[4];
     dlnkfdT = fwd_beta[4] * invT + activation_units[4] * fwd_Ea[4] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[4] * exp(low_beta[4] * tc[0] - activation_units[4] * low_Ea[4] * invT);
@@ -18426,16 +18884,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[4] == 4 ? exp(-troe_Tss[4] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[4]) > 1.e-100 ? -Fcent1/troe_Tsss[4] : 0.)
+      + (fabs(troe_Ts[4]) > 1.e-100 ? -Fcent2/troe_Ts[4] : 0.)
+      + (troe_len[4] == 4 ? Fcent3*troe_Tss[4]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[4]) > 1.e-100 ? -Fcent1/troe_Tsss[4] : 0.)
-      + (fabs(troe_Ts[4]) > 1.e-100 ? -Fcent2/troe_Ts[4] : 0.)
-      + (troe_len[4] == 4 ? Fcent3*troe_Tss[4]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -18443,7 +18901,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[23];
-    Kc = refCinv * exp(g_RT[1] + g_RT[6] - g_RT[23]);
+    Kc = Kc_s[4];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[6]) + (h_RT[23]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18461,73 +18919,30 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[h] */
-        dqdci =  + k_f*sc[6];
-        J[40] -= dqdci;               /* dwdot[h]/d[h] */
-        J[45] -= dqdci;               /* dwdot[ch2o]/d[h] */
-        J[62] += dqdci;               /* dwdot[ch2oh]/d[h] */
-        /* d()/d[ch2o] */
-        dqdci =  + k_f*sc[1];
-        J[235] -= dqdci;              /* dwdot[h]/d[ch2o] */
-        J[240] -= dqdci;              /* dwdot[ch2o]/d[ch2o] */
-        J[257] += dqdci;              /* dwdot[ch2oh]/d[ch2o] */
-        /* d()/d[h2o] */
-        dqdci = (TB[4][0] - 1)*dcdc_fac;
-        J[586] -= dqdci;              /* dwdot[h]/d[h2o] */
-        J[591] -= dqdci;              /* dwdot[ch2o]/d[h2o] */
-        J[608] += dqdci;              /* dwdot[ch2oh]/d[h2o] */
-        /* d()/d[ch2oh] */
-        dqdci =  - k_r;
-        J[898] -= dqdci;              /* dwdot[h]/d[ch2oh] */
-        J[903] -= dqdci;              /* dwdot[ch2o]/d[ch2oh] */
-        J[920] += dqdci;              /* dwdot[ch2oh]/d[ch2oh] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[6];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac + k_f*sc[1];
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[4][0]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac - k_r;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+1] -= dqdc[k];
-            J[39*k+6] -= dqdc[k];
-            J[39*k+23] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[6] -= dcdc_fac;
+    Jmix[23] += dcdc_fac;
+    /* d()/d[h] */
+    dqdci =  + k_f*sc[6];
+    J[40] -= dqdci;               /* dwdot[h]/d[h] */
+    J[45] -= dqdci;               /* dwdot[ch2o]/d[h] */
+    J[62] += dqdci;               /* dwdot[ch2oh]/d[h] */
+    /* d()/d[ch2o] */
+    dqdci =  + k_f*sc[1];
+    J[235] -= dqdci;              /* dwdot[h]/d[ch2o] */
+    J[240] -= dqdci;              /* dwdot[ch2o]/d[ch2o] */
+    J[257] += dqdci;              /* dwdot[ch2oh]/d[ch2o] */
+    /* d()/d[h2o] */
+    dqdci = (TB[4][0] - 1)*dcdc_fac;
+    J[586] -= dqdci;              /* dwdot[h]/d[h2o] */
+    J[591] -= dqdci;              /* dwdot[ch2o]/d[h2o] */
+    J[608] += dqdci;              /* dwdot[ch2oh]/d[h2o] */
+    /* d()/d[ch2oh] */
+    dqdci =  - k_r;
+    J[898] -= dqdci;              /* dwdot[h]/d[ch2oh] */
+    J[903] -= dqdci;              /* dwdot[ch2o]/d[ch2oh] */
+    J[920] += dqdci;              /* dwdot[ch2oh]/d[ch2oh] */
     J[1483] -= dqdT; /* dwdot[h]/dT */
     J[1488] -= dqdT; /* dwdot[ch2o]/dT */
     J[1505] += dqdT; /* dwdot[ch2oh]/dT */
@@ -18536,11 +18951,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[5][0] - 1)*sc[15] + (TB[5][1] - 1)*sc[0] + (TB[5][2] - 1)*sc[8] + (TB[5][3] - 1)*sc[9];
+    alpha = (memcmp(TB[5], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[5][0] - 1)*sc[15] + (TB[5][1] - 1)*sc[0] + (TB[5][2] - 1)*sc[8] + (TB[5][3] - 1)*sc[9]);
     /* forward */
     phi_f = sc[33];
-    k_f = prefactor_units[5] * fwd_A[5]
-                * exp(fwd_beta[5] * tc[0] - activation_units[5] * fwd_Ea[5] * invT);
+    k_f = k_f_s[5];
     dlnkfdT = fwd_beta[5] * invT + activation_units[5] * fwd_Ea[5] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[5] * exp(low_beta[5] * tc[0] - activation_units[5] * low_Ea[5] * invT);
@@ -18556,16 +18970,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[5] == 4 ? exp(-troe_Tss[5] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[5]) > 1.e-100 ? -Fcent1/troe_Tsss[5] : 0.)
+      + (fabs(troe_Ts[5]) > 1.e-100 ? -Fcent2/troe_Ts[5] : 0.)
+      + (troe_len[5] == 4 ? Fcent3*troe_Tss[5]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[5]) > 1.e-100 ? -Fcent1/troe_Tsss[5] : 0.)
-      + (fabs(troe_Ts[5]) > 1.e-100 ? -Fcent2/troe_Ts[5] : 0.)
-      + (troe_len[5] == 4 ? Fcent3*troe_Tss[5]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -18573,7 +18987,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[3]*sc[23];
-    Kc = refC * exp(-g_RT[3] - g_RT[23] + g_RT[33]);
+    Kc = Kc_s[5];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[33]) + (h_RT[3] + h_RT[23]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18591,88 +19005,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[h2] */
-        dqdci = (TB[5][1] - 1)*dcdc_fac;
-        J[3] += dqdci;                /* dwdot[ch3]/d[h2] */
-        J[23] += dqdci;               /* dwdot[ch2oh]/d[h2] */
-        J[33] -= dqdci;               /* dwdot[c2h5oh]/d[h2] */
-        /* d()/d[ch3] */
-        dqdci =  - k_r*sc[23];
-        J[120] += dqdci;              /* dwdot[ch3]/d[ch3] */
-        J[140] += dqdci;              /* dwdot[ch2oh]/d[ch3] */
-        J[150] -= dqdci;              /* dwdot[c2h5oh]/d[ch3] */
-        /* d()/d[co2] */
-        dqdci = (TB[5][2] - 1)*dcdc_fac;
-        J[315] += dqdci;              /* dwdot[ch3]/d[co2] */
-        J[335] += dqdci;              /* dwdot[ch2oh]/d[co2] */
-        J[345] -= dqdci;              /* dwdot[c2h5oh]/d[co2] */
-        /* d()/d[co] */
-        dqdci = (TB[5][3] - 1)*dcdc_fac;
-        J[354] += dqdci;              /* dwdot[ch3]/d[co] */
-        J[374] += dqdci;              /* dwdot[ch2oh]/d[co] */
-        J[384] -= dqdci;              /* dwdot[c2h5oh]/d[co] */
-        /* d()/d[h2o] */
-        dqdci = (TB[5][0] - 1)*dcdc_fac;
-        J[588] += dqdci;              /* dwdot[ch3]/d[h2o] */
-        J[608] += dqdci;              /* dwdot[ch2oh]/d[h2o] */
-        J[618] -= dqdci;              /* dwdot[c2h5oh]/d[h2o] */
-        /* d()/d[ch2oh] */
-        dqdci =  - k_r*sc[3];
-        J[900] += dqdci;              /* dwdot[ch3]/d[ch2oh] */
-        J[920] += dqdci;              /* dwdot[ch2oh]/d[ch2oh] */
-        J[930] -= dqdci;              /* dwdot[c2h5oh]/d[ch2oh] */
-        /* d()/d[c2h5oh] */
-        dqdci =  + k_f;
-        J[1290] += dqdci;             /* dwdot[ch3]/d[c2h5oh] */
-        J[1310] += dqdci;             /* dwdot[ch2oh]/d[c2h5oh] */
-        J[1320] -= dqdci;             /* dwdot[c2h5oh]/d[c2h5oh] */
-    }
-    else {
-        dqdc[0] = TB[5][1]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac - k_r*sc[23];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = TB[5][2]*dcdc_fac;
-        dqdc[9] = TB[5][3]*dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[5][0]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac - k_r*sc[3];
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac + k_f;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+3] += dqdc[k];
-            J[39*k+23] += dqdc[k];
-            J[39*k+33] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] += dcdc_fac;
+    Jmix[23] += dcdc_fac;
+    Jmix[33] -= dcdc_fac;
+    /* d()/d[h2] */
+    dqdci = (TB[5][1] - 1)*dcdc_fac;
+    J[3] += dqdci;                /* dwdot[ch3]/d[h2] */
+    J[23] += dqdci;               /* dwdot[ch2oh]/d[h2] */
+    J[33] -= dqdci;               /* dwdot[c2h5oh]/d[h2] */
+    /* d()/d[ch3] */
+    dqdci =  - k_r*sc[23];
+    J[120] += dqdci;              /* dwdot[ch3]/d[ch3] */
+    J[140] += dqdci;              /* dwdot[ch2oh]/d[ch3] */
+    J[150] -= dqdci;              /* dwdot[c2h5oh]/d[ch3] */
+    /* d()/d[co2] */
+    dqdci = (TB[5][2] - 1)*dcdc_fac;
+    J[315] += dqdci;              /* dwdot[ch3]/d[co2] */
+    J[335] += dqdci;              /* dwdot[ch2oh]/d[co2] */
+    J[345] -= dqdci;              /* dwdot[c2h5oh]/d[co2] */
+    /* d()/d[co] */
+    dqdci = (TB[5][3] - 1)*dcdc_fac;
+    J[354] += dqdci;              /* dwdot[ch3]/d[co] */
+    J[374] += dqdci;              /* dwdot[ch2oh]/d[co] */
+    J[384] -= dqdci;              /* dwdot[c2h5oh]/d[co] */
+    /* d()/d[h2o] */
+    dqdci = (TB[5][0] - 1)*dcdc_fac;
+    J[588] += dqdci;              /* dwdot[ch3]/d[h2o] */
+    J[608] += dqdci;              /* dwdot[ch2oh]/d[h2o] */
+    J[618] -= dqdci;              /* dwdot[c2h5oh]/d[h2o] */
+    /* d()/d[ch2oh] */
+    dqdci =  - k_r*sc[3];
+    J[900] += dqdci;              /* dwdot[ch3]/d[ch2oh] */
+    J[920] += dqdci;              /* dwdot[ch2oh]/d[ch2oh] */
+    J[930] -= dqdci;              /* dwdot[c2h5oh]/d[ch2oh] */
+    /* d()/d[c2h5oh] */
+    dqdci =  + k_f;
+    J[1290] += dqdci;             /* dwdot[ch3]/d[c2h5oh] */
+    J[1310] += dqdci;             /* dwdot[ch2oh]/d[c2h5oh] */
+    J[1320] -= dqdci;             /* dwdot[c2h5oh]/d[c2h5oh] */
     J[1485] += dqdT; /* dwdot[ch3]/dT */
     J[1505] += dqdT; /* dwdot[ch2oh]/dT */
     J[1515] -= dqdT; /* dwdot[c2h5oh]/dT */
@@ -18681,11 +19052,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[6][0] - 1)*sc[15] + (TB[6][1] - 1)*sc[0] + (TB[6][2] - 1)*sc[8] + (TB[6][3] - 1)*sc[9];
+    alpha = (memcmp(TB[6], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[6][0] - 1)*sc[15] + (TB[6][1] - 1)*sc[0] + (TB[6][2] - 1)*sc[8] + (TB[6][3] - 1)*sc[9]);
     /* forward */
     phi_f = sc[33];
-    k_f = prefactor_units[6] * fwd_A[6]
-                * exp(fwd_beta[6] * tc[0] - activation_units[6] * fwd_Ea[6] * invT);
+    k_f = k_f_s[6];
     dlnkfdT = fwd_beta[6] * invT + activation_units[6] * fwd_Ea[6] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[6] * exp(low_beta[6] * tc[0] - activation_units[6] * low_Ea[6] * invT);
@@ -18701,16 +19071,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[6] == 4 ? exp(-troe_Tss[6] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[6]) > 1.e-100 ? -Fcent1/troe_Tsss[6] : 0.)
+      + (fabs(troe_Ts[6]) > 1.e-100 ? -Fcent2/troe_Ts[6] : 0.)
+      + (troe_len[6] == 4 ? Fcent3*troe_Tss[6]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[6]) > 1.e-100 ? -Fcent1/troe_Tsss[6] : 0.)
-      + (fabs(troe_Ts[6]) > 1.e-100 ? -Fcent2/troe_Ts[6] : 0.)
-      + (troe_len[6] == 4 ? Fcent3*troe_Tss[6]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -18718,7 +19088,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[12]*sc[21];
-    Kc = refC * exp(-g_RT[12] - g_RT[21] + g_RT[33]);
+    Kc = Kc_s[6];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[33]) + (h_RT[12] + h_RT[21]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18736,88 +19106,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[h2] */
-        dqdci = (TB[6][1] - 1)*dcdc_fac;
-        J[12] += dqdci;               /* dwdot[oh]/d[h2] */
-        J[21] += dqdci;               /* dwdot[c2h5]/d[h2] */
-        J[33] -= dqdci;               /* dwdot[c2h5oh]/d[h2] */
-        /* d()/d[co2] */
-        dqdci = (TB[6][2] - 1)*dcdc_fac;
-        J[324] += dqdci;              /* dwdot[oh]/d[co2] */
-        J[333] += dqdci;              /* dwdot[c2h5]/d[co2] */
-        J[345] -= dqdci;              /* dwdot[c2h5oh]/d[co2] */
-        /* d()/d[co] */
-        dqdci = (TB[6][3] - 1)*dcdc_fac;
-        J[363] += dqdci;              /* dwdot[oh]/d[co] */
-        J[372] += dqdci;              /* dwdot[c2h5]/d[co] */
-        J[384] -= dqdci;              /* dwdot[c2h5oh]/d[co] */
-        /* d()/d[oh] */
-        dqdci =  - k_r*sc[21];
-        J[480] += dqdci;              /* dwdot[oh]/d[oh] */
-        J[489] += dqdci;              /* dwdot[c2h5]/d[oh] */
-        J[501] -= dqdci;              /* dwdot[c2h5oh]/d[oh] */
-        /* d()/d[h2o] */
-        dqdci = (TB[6][0] - 1)*dcdc_fac;
-        J[597] += dqdci;              /* dwdot[oh]/d[h2o] */
-        J[606] += dqdci;              /* dwdot[c2h5]/d[h2o] */
-        J[618] -= dqdci;              /* dwdot[c2h5oh]/d[h2o] */
-        /* d()/d[c2h5] */
-        dqdci =  - k_r*sc[12];
-        J[831] += dqdci;              /* dwdot[oh]/d[c2h5] */
-        J[840] += dqdci;              /* dwdot[c2h5]/d[c2h5] */
-        J[852] -= dqdci;              /* dwdot[c2h5oh]/d[c2h5] */
-        /* d()/d[c2h5oh] */
-        dqdci =  + k_f;
-        J[1299] += dqdci;             /* dwdot[oh]/d[c2h5oh] */
-        J[1308] += dqdci;             /* dwdot[c2h5]/d[c2h5oh] */
-        J[1320] -= dqdci;             /* dwdot[c2h5oh]/d[c2h5oh] */
-    }
-    else {
-        dqdc[0] = TB[6][1]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = TB[6][2]*dcdc_fac;
-        dqdc[9] = TB[6][3]*dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac - k_r*sc[21];
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[6][0]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac - k_r*sc[12];
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac + k_f;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+12] += dqdc[k];
-            J[39*k+21] += dqdc[k];
-            J[39*k+33] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[12] += dcdc_fac;
+    Jmix[21] += dcdc_fac;
+    Jmix[33] -= dcdc_fac;
+    /* d()/d[h2] */
+    dqdci = (TB[6][1] - 1)*dcdc_fac;
+    J[12] += dqdci;               /* dwdot[oh]/d[h2] */
+    J[21] += dqdci;               /* dwdot[c2h5]/d[h2] */
+    J[33] -= dqdci;               /* dwdot[c2h5oh]/d[h2] */
+    /* d()/d[co2] */
+    dqdci = (TB[6][2] - 1)*dcdc_fac;
+    J[324] += dqdci;              /* dwdot[oh]/d[co2] */
+    J[333] += dqdci;              /* dwdot[c2h5]/d[co2] */
+    J[345] -= dqdci;              /* dwdot[c2h5oh]/d[co2] */
+    /* d()/d[co] */
+    dqdci = (TB[6][3] - 1)*dcdc_fac;
+    J[363] += dqdci;              /* dwdot[oh]/d[co] */
+    J[372] += dqdci;              /* dwdot[c2h5]/d[co] */
+    J[384] -= dqdci;              /* dwdot[c2h5oh]/d[co] */
+    /* d()/d[oh] */
+    dqdci =  - k_r*sc[21];
+    J[480] += dqdci;              /* dwdot[oh]/d[oh] */
+    J[489] += dqdci;              /* dwdot[c2h5]/d[oh] */
+    J[501] -= dqdci;              /* dwdot[c2h5oh]/d[oh] */
+    /* d()/d[h2o] */
+    dqdci = (TB[6][0] - 1)*dcdc_fac;
+    J[597] += dqdci;              /* dwdot[oh]/d[h2o] */
+    J[606] += dqdci;              /* dwdot[c2h5]/d[h2o] */
+    J[618] -= dqdci;              /* dwdot[c2h5oh]/d[h2o] */
+    /* d()/d[c2h5] */
+    dqdci =  - k_r*sc[12];
+    J[831] += dqdci;              /* dwdot[oh]/d[c2h5] */
+    J[840] += dqdci;              /* dwdot[c2h5]/d[c2h5] */
+    J[852] -= dqdci;              /* dwdot[c2h5oh]/d[c2h5] */
+    /* d()/d[c2h5oh] */
+    dqdci =  + k_f;
+    J[1299] += dqdci;             /* dwdot[oh]/d[c2h5oh] */
+    J[1308] += dqdci;             /* dwdot[c2h5]/d[c2h5oh] */
+    J[1320] -= dqdci;             /* dwdot[c2h5oh]/d[c2h5oh] */
     J[1494] += dqdT; /* dwdot[oh]/dT */
     J[1503] += dqdT; /* dwdot[c2h5]/dT */
     J[1515] -= dqdT; /* dwdot[c2h5oh]/dT */
@@ -18826,11 +19153,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[7][0] - 1)*sc[15];
+    alpha = (memcmp(TB[7], TB[3], 1*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[7][0] - 1)*sc[15]);
     /* forward */
     phi_f = sc[33];
-    k_f = prefactor_units[7] * fwd_A[7]
-                * exp(fwd_beta[7] * tc[0] - activation_units[7] * fwd_Ea[7] * invT);
+    k_f = k_f_s[7];
     dlnkfdT = fwd_beta[7] * invT + activation_units[7] * fwd_Ea[7] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[7] * exp(low_beta[7] * tc[0] - activation_units[7] * low_Ea[7] * invT);
@@ -18846,16 +19172,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[7] == 4 ? exp(-troe_Tss[7] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[7]) > 1.e-100 ? -Fcent1/troe_Tsss[7] : 0.)
+      + (fabs(troe_Ts[7]) > 1.e-100 ? -Fcent2/troe_Ts[7] : 0.)
+      + (troe_len[7] == 4 ? Fcent3*troe_Tss[7]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[7]) > 1.e-100 ? -Fcent1/troe_Tsss[7] : 0.)
-      + (fabs(troe_Ts[7]) > 1.e-100 ? -Fcent2/troe_Ts[7] : 0.)
-      + (troe_len[7] == 4 ? Fcent3*troe_Tss[7]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -18863,7 +19189,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[15]*sc[20];
-    Kc = refC * exp(-g_RT[15] - g_RT[20] + g_RT[33]);
+    Kc = Kc_s[7];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[33]) + (h_RT[15] + h_RT[20]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18881,68 +19207,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[h2o] */
-        dqdci = (TB[7][0] - 1)*dcdc_fac - k_r*sc[20];
-        J[600] += dqdci;              /* dwdot[h2o]/d[h2o] */
-        J[605] += dqdci;              /* dwdot[c2h4]/d[h2o] */
-        J[618] -= dqdci;              /* dwdot[c2h5oh]/d[h2o] */
-        /* d()/d[c2h4] */
-        dqdci =  - k_r*sc[15];
-        J[795] += dqdci;              /* dwdot[h2o]/d[c2h4] */
-        J[800] += dqdci;              /* dwdot[c2h4]/d[c2h4] */
-        J[813] -= dqdci;              /* dwdot[c2h5oh]/d[c2h4] */
-        /* d()/d[c2h5oh] */
-        dqdci =  + k_f;
-        J[1302] += dqdci;             /* dwdot[h2o]/d[c2h5oh] */
-        J[1307] += dqdci;             /* dwdot[c2h4]/d[c2h5oh] */
-        J[1320] -= dqdci;             /* dwdot[c2h5oh]/d[c2h5oh] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[7][0]*dcdc_fac - k_r*sc[20];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac - k_r*sc[15];
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac + k_f;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+15] += dqdc[k];
-            J[39*k+20] += dqdc[k];
-            J[39*k+33] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[15] += dcdc_fac;
+    Jmix[20] += dcdc_fac;
+    Jmix[33] -= dcdc_fac;
+    /* d()/d[h2o] */
+    dqdci = (TB[7][0] - 1)*dcdc_fac - k_r*sc[20];
+    J[600] += dqdci;              /* dwdot[h2o]/d[h2o] */
+    J[605] += dqdci;              /* dwdot[c2h4]/d[h2o] */
+    J[618] -= dqdci;              /* dwdot[c2h5oh]/d[h2o] */
+    /* d()/d[c2h4] */
+    dqdci =  - k_r*sc[15];
+    J[795] += dqdci;              /* dwdot[h2o]/d[c2h4] */
+    J[800] += dqdci;              /* dwdot[c2h4]/d[c2h4] */
+    J[813] -= dqdci;              /* dwdot[c2h5oh]/d[c2h4] */
+    /* d()/d[c2h5oh] */
+    dqdci =  + k_f;
+    J[1302] += dqdci;             /* dwdot[h2o]/d[c2h5oh] */
+    J[1307] += dqdci;             /* dwdot[c2h4]/d[c2h5oh] */
+    J[1320] -= dqdci;             /* dwdot[c2h5oh]/d[c2h5oh] */
     J[1497] += dqdT; /* dwdot[h2o]/dT */
     J[1502] += dqdT; /* dwdot[c2h4]/dT */
     J[1515] -= dqdT; /* dwdot[c2h5oh]/dT */
@@ -18951,11 +19234,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[8][0] - 1)*sc[15];
+    alpha = (memcmp(TB[8], TB[3], 1*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[8][0] - 1)*sc[15]);
     /* forward */
     phi_f = sc[33];
-    k_f = prefactor_units[8] * fwd_A[8]
-                * exp(fwd_beta[8] * tc[0] - activation_units[8] * fwd_Ea[8] * invT);
+    k_f = k_f_s[8];
     dlnkfdT = fwd_beta[8] * invT + activation_units[8] * fwd_Ea[8] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[8] * exp(low_beta[8] * tc[0] - activation_units[8] * low_Ea[8] * invT);
@@ -18971,16 +19253,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[8] == 4 ? exp(-troe_Tss[8] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[8]) > 1.e-100 ? -Fcent1/troe_Tsss[8] : 0.)
+      + (fabs(troe_Ts[8]) > 1.e-100 ? -Fcent2/troe_Ts[8] : 0.)
+      + (troe_len[8] == 4 ? Fcent3*troe_Tss[8]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[8]) > 1.e-100 ? -Fcent1/troe_Tsss[8] : 0.)
-      + (fabs(troe_Ts[8]) > 1.e-100 ? -Fcent2/troe_Ts[8] : 0.)
-      + (troe_len[8] == 4 ? Fcent3*troe_Tss[8]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -18988,7 +19270,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[0]*sc[32];
-    Kc = refC * exp(-g_RT[0] - g_RT[32] + g_RT[33]);
+    Kc = Kc_s[8];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[33]) + (h_RT[0] + h_RT[32]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19006,73 +19288,30 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[h2] */
-        dqdci =  - k_r*sc[32];
-        J[0] += dqdci;                /* dwdot[h2]/d[h2] */
-        J[32] += dqdci;               /* dwdot[ch3hco]/d[h2] */
-        J[33] -= dqdci;               /* dwdot[c2h5oh]/d[h2] */
-        /* d()/d[h2o] */
-        dqdci = (TB[8][0] - 1)*dcdc_fac;
-        J[585] += dqdci;              /* dwdot[h2]/d[h2o] */
-        J[617] += dqdci;              /* dwdot[ch3hco]/d[h2o] */
-        J[618] -= dqdci;              /* dwdot[c2h5oh]/d[h2o] */
-        /* d()/d[ch3hco] */
-        dqdci =  - k_r*sc[0];
-        J[1248] += dqdci;             /* dwdot[h2]/d[ch3hco] */
-        J[1280] += dqdci;             /* dwdot[ch3hco]/d[ch3hco] */
-        J[1281] -= dqdci;             /* dwdot[c2h5oh]/d[ch3hco] */
-        /* d()/d[c2h5oh] */
-        dqdci =  + k_f;
-        J[1287] += dqdci;             /* dwdot[h2]/d[c2h5oh] */
-        J[1319] += dqdci;             /* dwdot[ch3hco]/d[c2h5oh] */
-        J[1320] -= dqdci;             /* dwdot[c2h5oh]/d[c2h5oh] */
-    }
-    else {
-        dqdc[0] = dcdc_fac - k_r*sc[32];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[8][0]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac - k_r*sc[0];
-        dqdc[33] = dcdc_fac + k_f;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+0] += dqdc[k];
-            J[39*k+32] += dqdc[k];
-            J[39*k+33] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += dcdc_fac;
+    Jmix[32] += dcdc_fac;
+    Jmix[33] -= dcdc_fac;
+    /* d()/d[h2] */
+    dqdci =  - k_r*sc[32];
+    J[0] += dqdci;                /* dwdot[h2]/d[h2] */
+    J[32] += dqdci;               /* dwdot[ch3hco]/d[h2] */
+    J[33] -= dqdci;               /* dwdot[c2h5oh]/d[h2] */
+    /* d()/d[h2o] */
+    dqdci = (TB[8][0] - 1)*dcdc_fac;
+    J[585] += dqdci;              /* dwdot[h2]/d[h2o] */
+    J[617] += dqdci;              /* dwdot[ch3hco]/d[h2o] */
+    J[618] -= dqdci;              /* dwdot[c2h5oh]/d[h2o] */
+    /* d()/d[ch3hco] */
+    dqdci =  - k_r*sc[0];
+    J[1248] += dqdci;             /* dwdot[h2]/d[ch3hco] */
+    J[1280] += dqdci;             /* dwdot[ch3hco]/d[ch3hco] */
+    J[1281] -= dqdci;             /* dwdot[c2h5oh]/d[ch3hco] */
+    /* d()/d[c2h5oh] */
+    dqdci =  + k_f;
+    J[1287] += dqdci;             /* dwdot[h2]/d[c2h5oh] */
+    J[1319] += dqdci;             /* dwdot[ch3hco]/d[c2h5oh] */
+    J[1320] -= dqdci;             /* dwdot[c2h5oh]/d[c2h5oh] */
     J[1482] += dqdT; /* dwdot[h2]/dT */
     J[1514] += dqdT; /* dwdot[ch3hco]/dT */
     J[1515] -= dqdT; /* dwdot[c2h5oh]/dT */
@@ -19081,11 +19320,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[9][0] - 1)*sc[15] + (TB[9][1] - 1)*sc[0] + (TB[9][2] - 1)*sc[8] + (TB[9][3] - 1)*sc[9];
+    alpha = (memcmp(TB[9], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[9][0] - 1)*sc[15] + (TB[9][1] - 1)*sc[0] + (TB[9][2] - 1)*sc[8] + (TB[9][3] - 1)*sc[9]);
     /* forward */
     phi_f = sc[1]*sc[20];
-    k_f = prefactor_units[9] * fwd_A[9]
-                * exp(fwd_beta[9] * tc[0] - activation_units[9] * fwd_Ea[9] * invT);
+    k_f = k_f_s[9];
     dlnkfdT = fwd_beta[9] * invT + activation_units[9] * fwd_Ea[9] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[9] * exp(low_beta[9] * tc[0] - activation_units[9] * low_Ea[9] * invT);
@@ -19101,16 +19339,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[9] == 4 ? exp(-troe_Tss[9] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[9]) > 1.e-100 ? -Fcent1/troe_Tsss[9] : 0.)
+      + (fabs(troe_Ts[9]) > 1.e-100 ? -Fcent2/troe_Ts[9] : 0.)
+      + (troe_len[9] == 4 ? Fcent3*troe_Tss[9]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[9]) > 1.e-100 ? -Fcent1/troe_Tsss[9] : 0.)
-      + (fabs(troe_Ts[9]) > 1.e-100 ? -Fcent2/troe_Ts[9] : 0.)
-      + (troe_len[9] == 4 ? Fcent3*troe_Tss[9]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -19118,7 +19356,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[21];
-    Kc = refCinv * exp(g_RT[1] + g_RT[20] - g_RT[21]);
+    Kc = Kc_s[9];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[20]) + (h_RT[21]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19136,88 +19374,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[h2] */
-        dqdci = (TB[9][1] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[h]/d[h2] */
-        J[20] -= dqdci;               /* dwdot[c2h4]/d[h2] */
-        J[21] += dqdci;               /* dwdot[c2h5]/d[h2] */
-        /* d()/d[h] */
-        dqdci =  + k_f*sc[20];
-        J[40] -= dqdci;               /* dwdot[h]/d[h] */
-        J[59] -= dqdci;               /* dwdot[c2h4]/d[h] */
-        J[60] += dqdci;               /* dwdot[c2h5]/d[h] */
-        /* d()/d[co2] */
-        dqdci = (TB[9][2] - 1)*dcdc_fac;
-        J[313] -= dqdci;              /* dwdot[h]/d[co2] */
-        J[332] -= dqdci;              /* dwdot[c2h4]/d[co2] */
-        J[333] += dqdci;              /* dwdot[c2h5]/d[co2] */
-        /* d()/d[co] */
-        dqdci = (TB[9][3] - 1)*dcdc_fac;
-        J[352] -= dqdci;              /* dwdot[h]/d[co] */
-        J[371] -= dqdci;              /* dwdot[c2h4]/d[co] */
-        J[372] += dqdci;              /* dwdot[c2h5]/d[co] */
-        /* d()/d[h2o] */
-        dqdci = (TB[9][0] - 1)*dcdc_fac;
-        J[586] -= dqdci;              /* dwdot[h]/d[h2o] */
-        J[605] -= dqdci;              /* dwdot[c2h4]/d[h2o] */
-        J[606] += dqdci;              /* dwdot[c2h5]/d[h2o] */
-        /* d()/d[c2h4] */
-        dqdci =  + k_f*sc[1];
-        J[781] -= dqdci;              /* dwdot[h]/d[c2h4] */
-        J[800] -= dqdci;              /* dwdot[c2h4]/d[c2h4] */
-        J[801] += dqdci;              /* dwdot[c2h5]/d[c2h4] */
-        /* d()/d[c2h5] */
-        dqdci =  - k_r;
-        J[820] -= dqdci;              /* dwdot[h]/d[c2h5] */
-        J[839] -= dqdci;              /* dwdot[c2h4]/d[c2h5] */
-        J[840] += dqdci;              /* dwdot[c2h5]/d[c2h5] */
-    }
-    else {
-        dqdc[0] = TB[9][1]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[20];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = TB[9][2]*dcdc_fac;
-        dqdc[9] = TB[9][3]*dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[9][0]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac + k_f*sc[1];
-        dqdc[21] = dcdc_fac - k_r;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+1] -= dqdc[k];
-            J[39*k+20] -= dqdc[k];
-            J[39*k+21] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[20] -= dcdc_fac;
+    Jmix[21] += dcdc_fac;
+    /* d()/d[h2] */
+    dqdci = (TB[9][1] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[h]/d[h2] */
+    J[20] -= dqdci;               /* dwdot[c2h4]/d[h2] */
+    J[21] += dqdci;               /* dwdot[c2h5]/d[h2] */
+    /* d()/d[h] */
+    dqdci =  + k_f*sc[20];
+    J[40] -= dqdci;               /* dwdot[h]/d[h] */
+    J[59] -= dqdci;               /* dwdot[c2h4]/d[h] */
+    J[60] += dqdci;               /* dwdot[c2h5]/d[h] */
+    /* d()/d[co2] */
+    dqdci = (TB[9][2] - 1)*dcdc_fac;
+    J[313] -= dqdci;              /* dwdot[h]/d[co2] */
+    J[332] -= dqdci;              /* dwdot[c2h4]/d[co2] */
+    J[333] += dqdci;              /* dwdot[c2h5]/d[co2] */
+    /* d()/d[co] */
+    dqdci = (TB[9][3] - 1)*dcdc_fac;
+    J[352] -= dqdci;              /* dwdot[h]/d[co] */
+    J[371] -= dqdci;              /* dwdot[c2h4]/d[co] */
+    J[372] += dqdci;              /* dwdot[c2h5]/d[co] */
+    /* d()/d[h2o] */
+    dqdci = (TB[9][0] - 1)*dcdc_fac;
+    J[586] -= dqdci;              /* dwdot[h]/d[h2o] */
+    J[605] -= dqdci;              /* dwdot[c2h4]/d[h2o] */
+    J[606] += dqdci;              /* dwdot[c2h5]/d[h2o] */
+    /* d()/d[c2h4] */
+    dqdci =  + k_f*sc[1];
+    J[781] -= dqdci;              /* dwdot[h]/d[c2h4] */
+    J[800] -= dqdci;              /* dwdot[c2h4]/d[c2h4] */
+    J[801] += dqdci;              /* dwdot[c2h5]/d[c2h4] */
+    /* d()/d[c2h5] */
+    dqdci =  - k_r;
+    J[820] -= dqdci;              /* dwdot[h]/d[c2h5] */
+    J[839] -= dqdci;              /* dwdot[c2h4]/d[c2h5] */
+    J[840] += dqdci;              /* dwdot[c2h5]/d[c2h5] */
     J[1483] -= dqdT; /* dwdot[h]/dT */
     J[1502] -= dqdT; /* dwdot[c2h4]/dT */
     J[1503] += dqdT; /* dwdot[c2h5]/dT */
@@ -19226,11 +19421,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[10][0] - 1)*sc[15];
+    alpha = (memcmp(TB[10], TB[3], 1*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[10][0] - 1)*sc[15]);
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[10] * fwd_A[10]
-                * exp(fwd_beta[10] * tc[0] - activation_units[10] * fwd_Ea[10] * invT);
+    k_f = k_f_s[10];
     dlnkfdT = fwd_beta[10] * invT + activation_units[10] * fwd_Ea[10] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[10] * exp(low_beta[10] * tc[0] - activation_units[10] * low_Ea[10] * invT);
@@ -19246,16 +19440,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[10] == 4 ? exp(-troe_Tss[10] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[10]) > 1.e-100 ? -Fcent1/troe_Tsss[10] : 0.)
+      + (fabs(troe_Ts[10]) > 1.e-100 ? -Fcent2/troe_Ts[10] : 0.)
+      + (troe_len[10] == 4 ? Fcent3*troe_Tss[10]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[10]) > 1.e-100 ? -Fcent1/troe_Tsss[10] : 0.)
-      + (fabs(troe_Ts[10]) > 1.e-100 ? -Fcent2/troe_Ts[10] : 0.)
-      + (troe_len[10] == 4 ? Fcent3*troe_Tss[10]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -19263,7 +19457,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[20];
-    Kc = refCinv * exp(g_RT[1] + g_RT[19] - g_RT[20]);
+    Kc = Kc_s[10];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[20]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19281,73 +19475,30 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[h] */
-        dqdci =  + k_f*sc[19];
-        J[40] -= dqdci;               /* dwdot[h]/d[h] */
-        J[58] -= dqdci;               /* dwdot[c2h3]/d[h] */
-        J[59] += dqdci;               /* dwdot[c2h4]/d[h] */
-        /* d()/d[h2o] */
-        dqdci = (TB[10][0] - 1)*dcdc_fac;
-        J[586] -= dqdci;              /* dwdot[h]/d[h2o] */
-        J[604] -= dqdci;              /* dwdot[c2h3]/d[h2o] */
-        J[605] += dqdci;              /* dwdot[c2h4]/d[h2o] */
-        /* d()/d[c2h3] */
-        dqdci =  + k_f*sc[1];
-        J[742] -= dqdci;              /* dwdot[h]/d[c2h3] */
-        J[760] -= dqdci;              /* dwdot[c2h3]/d[c2h3] */
-        J[761] += dqdci;              /* dwdot[c2h4]/d[c2h3] */
-        /* d()/d[c2h4] */
-        dqdci =  - k_r;
-        J[781] -= dqdci;              /* dwdot[h]/d[c2h4] */
-        J[799] -= dqdci;              /* dwdot[c2h3]/d[c2h4] */
-        J[800] += dqdci;              /* dwdot[c2h4]/d[c2h4] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[19];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[10][0]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac + k_f*sc[1];
-        dqdc[20] = dcdc_fac - k_r;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+1] -= dqdc[k];
-            J[39*k+19] -= dqdc[k];
-            J[39*k+20] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[19] -= dcdc_fac;
+    Jmix[20] += dcdc_fac;
+    /* d()/d[h] */
+    dqdci =  + k_f*sc[19];
+    J[40] -= dqdci;               /* dwdot[h]/d[h] */
+    J[58] -= dqdci;               /* dwdot[c2h3]/d[h] */
+    J[59] += dqdci;               /* dwdot[c2h4]/d[h] */
+    /* d()/d[h2o] */
+    dqdci = (TB[10][0] - 1)*dcdc_fac;
+    J[586] -= dqdci;              /* dwdot[h]/d[h2o] */
+    J[604] -= dqdci;              /* dwdot[c2h3]/d[h2o] */
+    J[605] += dqdci;              /* dwdot[c2h4]/d[h2o] */
+    /* d()/d[c2h3] */
+    dqdci =  + k_f*sc[1];
+    J[742] -= dqdci;              /* dwdot[h]/d[c2h3] */
+    J[760] -= dqdci;              /* dwdot[c2h3]/d[c2h3] */
+    J[761] += dqdci;              /* dwdot[c2h4]/d[c2h3] */
+    /* d()/d[c2h4] */
+    dqdci =  - k_r;
+    J[781] -= dqdci;              /* dwdot[h]/d[c2h4] */
+    J[799] -= dqdci;              /* dwdot[c2h3]/d[c2h4] */
+    J[800] += dqdci;              /* dwdot[c2h4]/d[c2h4] */
     J[1483] -= dqdT; /* dwdot[h]/dT */
     J[1501] -= dqdT; /* dwdot[c2h3]/dT */
     J[1502] += dqdT; /* dwdot[c2h4]/dT */
@@ -19356,11 +19507,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[11][0] - 1)*sc[15] + (TB[11][1] - 1)*sc[0] + (TB[11][2] - 1)*sc[8] + (TB[11][3] - 1)*sc[9];
+    alpha = (memcmp(TB[11], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[11][0] - 1)*sc[15] + (TB[11][1] - 1)*sc[0] + (TB[11][2] - 1)*sc[8] + (TB[11][3] - 1)*sc[9]);
     /* forward */
     phi_f = sc[1]*sc[18];
-    k_f = prefactor_units[11] * fwd_A[11]
-                * exp(fwd_beta[11] * tc[0] - activation_units[11] * fwd_Ea[11] * invT);
+    k_f = k_f_s[11];
     dlnkfdT = fwd_beta[11] * invT + activation_units[11] * fwd_Ea[11] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[11] * exp(low_beta[11] * tc[0] - activation_units[11] * low_Ea[11] * invT);
@@ -19376,16 +19526,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[11] == 4 ? exp(-troe_Tss[11] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[11]) > 1.e-100 ? -Fcent1/troe_Tsss[11] : 0.)
+      + (fabs(troe_Ts[11]) > 1.e-100 ? -Fcent2/troe_Ts[11] : 0.)
+      + (troe_len[11] == 4 ? Fcent3*troe_Tss[11]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[11]) > 1.e-100 ? -Fcent1/troe_Tsss[11] : 0.)
-      + (fabs(troe_Ts[11]) > 1.e-100 ? -Fcent2/troe_Ts[11] : 0.)
-      + (troe_len[11] == 4 ? Fcent3*troe_Tss[11]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -19393,7 +19543,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[19];
-    Kc = refCinv * exp(g_RT[1] + g_RT[18] - g_RT[19]);
+    Kc = Kc_s[11];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[18]) + (h_RT[19]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19411,88 +19561,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[h2] */
-        dqdci = (TB[11][1] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[h]/d[h2] */
-        J[18] -= dqdci;               /* dwdot[c2h2]/d[h2] */
-        J[19] += dqdci;               /* dwdot[c2h3]/d[h2] */
-        /* d()/d[h] */
-        dqdci =  + k_f*sc[18];
-        J[40] -= dqdci;               /* dwdot[h]/d[h] */
-        J[57] -= dqdci;               /* dwdot[c2h2]/d[h] */
-        J[58] += dqdci;               /* dwdot[c2h3]/d[h] */
-        /* d()/d[co2] */
-        dqdci = (TB[11][2] - 1)*dcdc_fac;
-        J[313] -= dqdci;              /* dwdot[h]/d[co2] */
-        J[330] -= dqdci;              /* dwdot[c2h2]/d[co2] */
-        J[331] += dqdci;              /* dwdot[c2h3]/d[co2] */
-        /* d()/d[co] */
-        dqdci = (TB[11][3] - 1)*dcdc_fac;
-        J[352] -= dqdci;              /* dwdot[h]/d[co] */
-        J[369] -= dqdci;              /* dwdot[c2h2]/d[co] */
-        J[370] += dqdci;              /* dwdot[c2h3]/d[co] */
-        /* d()/d[h2o] */
-        dqdci = (TB[11][0] - 1)*dcdc_fac;
-        J[586] -= dqdci;              /* dwdot[h]/d[h2o] */
-        J[603] -= dqdci;              /* dwdot[c2h2]/d[h2o] */
-        J[604] += dqdci;              /* dwdot[c2h3]/d[h2o] */
-        /* d()/d[c2h2] */
-        dqdci =  + k_f*sc[1];
-        J[703] -= dqdci;              /* dwdot[h]/d[c2h2] */
-        J[720] -= dqdci;              /* dwdot[c2h2]/d[c2h2] */
-        J[721] += dqdci;              /* dwdot[c2h3]/d[c2h2] */
-        /* d()/d[c2h3] */
-        dqdci =  - k_r;
-        J[742] -= dqdci;              /* dwdot[h]/d[c2h3] */
-        J[759] -= dqdci;              /* dwdot[c2h2]/d[c2h3] */
-        J[760] += dqdci;              /* dwdot[c2h3]/d[c2h3] */
-    }
-    else {
-        dqdc[0] = TB[11][1]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[18];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = TB[11][2]*dcdc_fac;
-        dqdc[9] = TB[11][3]*dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[11][0]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac + k_f*sc[1];
-        dqdc[19] = dcdc_fac - k_r;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+1] -= dqdc[k];
-            J[39*k+18] -= dqdc[k];
-            J[39*k+19] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[18] -= dcdc_fac;
+    Jmix[19] += dcdc_fac;
+    /* d()/d[h2] */
+    dqdci = (TB[11][1] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[h]/d[h2] */
+    J[18] -= dqdci;               /* dwdot[c2h2]/d[h2] */
+    J[19] += dqdci;               /* dwdot[c2h3]/d[h2] */
+    /* d()/d[h] */
+    dqdci =  + k_f*sc[18];
+    J[40] -= dqdci;               /* dwdot[h]/d[h] */
+    J[57] -= dqdci;               /* dwdot[c2h2]/d[h] */
+    J[58] += dqdci;               /* dwdot[c2h3]/d[h] */
+    /* d()/d[co2] */
+    dqdci = (TB[11][2] - 1)*dcdc_fac;
+    J[313] -= dqdci;              /* dwdot[h]/d[co2] */
+    J[330] -= dqdci;              /* dwdot[c2h2]/d[co2] */
+    J[331] += dqdci;              /* dwdot[c2h3]/d[co2] */
+    /* d()/d[co] */
+    dqdci = (TB[11][3] - 1)*dcdc_fac;
+    J[352] -= dqdci;              /* dwdot[h]/d[co] */
+    J[369] -= dqdci;              /* dwdot[c2h2]/d[co] */
+    J[370] += dqdci;              /* dwdot[c2h3]/d[co] */
+    /* d()/d[h2o] */
+    dqdci = (TB[11][0] - 1)*dcdc_fac;
+    J[586] -= dqdci;              /* dwdot[h]/d[h2o] */
+    J[603] -= dqdci;              /* dwdot[c2h2]/d[h2o] */
+    J[604] += dqdci;              /* dwdot[c2h3]/d[h2o] */
+    /* d()/d[c2h2] */
+    dqdci =  + k_f*sc[1];
+    J[703] -= dqdci;              /* dwdot[h]/d[c2h2] */
+    J[720] -= dqdci;              /* dwdot[c2h2]/d[c2h2] */
+    J[721] += dqdci;              /* dwdot[c2h3]/d[c2h2] */
+    /* d()/d[c2h3] */
+    dqdci =  - k_r;
+    J[742] -= dqdci;              /* dwdot[h]/d[c2h3] */
+    J[759] -= dqdci;              /* dwdot[c2h2]/d[c2h3] */
+    J[760] += dqdci;              /* dwdot[c2h3]/d[c2h3] */
     J[1483] -= dqdT; /* dwdot[h]/dT */
     J[1500] -= dqdT; /* dwdot[c2h2]/dT */
     J[1501] += dqdT; /* dwdot[c2h3]/dT */
@@ -19504,8 +19611,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[12][0] - 1)*sc[15] + (TB[12][1] - 1)*sc[0] + (TB[12][2] - 1)*sc[37] + (TB[12][3] - 1)*sc[2] + (TB[12][4] - 1)*sc[8] + (TB[12][5] - 1)*sc[9];
     /* forward */
     phi_f = sc[1]*sc[10];
-    k_f = prefactor_units[12] * fwd_A[12]
-                * exp(fwd_beta[12] * tc[0] - activation_units[12] * fwd_Ea[12] * invT);
+    k_f = k_f_s[12];
     dlnkfdT = fwd_beta[12] * invT + activation_units[12] * fwd_Ea[12] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[12] * exp(low_beta[12] * tc[0] - activation_units[12] * low_Ea[12] * invT);
@@ -19520,7 +19626,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = 0.0;
     /* reverse */
     phi_r = sc[13];
-    Kc = refCinv * exp(g_RT[1] + g_RT[10] - g_RT[13]);
+    Kc = Kc_s[12];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[10]) + (h_RT[13]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19538,98 +19644,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[h2] */
-        dqdci = (TB[12][1] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[h]/d[h2] */
-        J[10] -= dqdci;               /* dwdot[o2]/d[h2] */
-        J[13] += dqdci;               /* dwdot[ho2]/d[h2] */
-        /* d()/d[h] */
-        dqdci =  + k_f*sc[10];
-        J[40] -= dqdci;               /* dwdot[h]/d[h] */
-        J[49] -= dqdci;               /* dwdot[o2]/d[h] */
-        J[52] += dqdci;               /* dwdot[ho2]/d[h] */
-        /* d()/d[ch4] */
-        dqdci = (TB[12][3] - 1)*dcdc_fac;
-        J[79] -= dqdci;               /* dwdot[h]/d[ch4] */
-        J[88] -= dqdci;               /* dwdot[o2]/d[ch4] */
-        J[91] += dqdci;               /* dwdot[ho2]/d[ch4] */
-        /* d()/d[co2] */
-        dqdci = (TB[12][4] - 1)*dcdc_fac;
-        J[313] -= dqdci;              /* dwdot[h]/d[co2] */
-        J[322] -= dqdci;              /* dwdot[o2]/d[co2] */
-        J[325] += dqdci;              /* dwdot[ho2]/d[co2] */
-        /* d()/d[co] */
-        dqdci = (TB[12][5] - 1)*dcdc_fac;
-        J[352] -= dqdci;              /* dwdot[h]/d[co] */
-        J[361] -= dqdci;              /* dwdot[o2]/d[co] */
-        J[364] += dqdci;              /* dwdot[ho2]/d[co] */
-        /* d()/d[o2] */
-        dqdci =  + k_f*sc[1];
-        J[391] -= dqdci;              /* dwdot[h]/d[o2] */
-        J[400] -= dqdci;              /* dwdot[o2]/d[o2] */
-        J[403] += dqdci;              /* dwdot[ho2]/d[o2] */
-        /* d()/d[ho2] */
-        dqdci =  - k_r;
-        J[508] -= dqdci;              /* dwdot[h]/d[ho2] */
-        J[517] -= dqdci;              /* dwdot[o2]/d[ho2] */
-        J[520] += dqdci;              /* dwdot[ho2]/d[ho2] */
-        /* d()/d[h2o] */
-        dqdci = (TB[12][0] - 1)*dcdc_fac;
-        J[586] -= dqdci;              /* dwdot[h]/d[h2o] */
-        J[595] -= dqdci;              /* dwdot[o2]/d[h2o] */
-        J[598] += dqdci;              /* dwdot[ho2]/d[h2o] */
-        /* d()/d[n2] */
-        dqdci = (TB[12][2] - 1)*dcdc_fac;
-        J[1444] -= dqdci;             /* dwdot[h]/d[n2] */
-        J[1453] -= dqdci;             /* dwdot[o2]/d[n2] */
-        J[1456] += dqdci;             /* dwdot[ho2]/d[n2] */
-    }
-    else {
-        dqdc[0] = TB[12][1]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[10];
-        dqdc[2] = TB[12][3]*dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = TB[12][4]*dcdc_fac;
-        dqdc[9] = TB[12][5]*dcdc_fac;
-        dqdc[10] = dcdc_fac + k_f*sc[1];
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac - k_r;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[12][0]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = TB[12][2]*dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+1] -= dqdc[k];
-            J[39*k+10] -= dqdc[k];
-            J[39*k+13] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[10] -= dcdc_fac;
+    Jmix[13] += dcdc_fac;
+    /* d()/d[h2] */
+    dqdci = (TB[12][1] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[h]/d[h2] */
+    J[10] -= dqdci;               /* dwdot[o2]/d[h2] */
+    J[13] += dqdci;               /* dwdot[ho2]/d[h2] */
+    /* d()/d[h] */
+    dqdci =  + k_f*sc[10];
+    J[40] -= dqdci;               /* dwdot[h]/d[h] */
+    J[49] -= dqdci;               /* dwdot[o2]/d[h] */
+    J[52] += dqdci;               /* dwdot[ho2]/d[h] */
+    /* d()/d[ch4] */
+    dqdci = (TB[12][3] - 1)*dcdc_fac;
+    J[79] -= dqdci;               /* dwdot[h]/d[ch4] */
+    J[88] -= dqdci;               /* dwdot[o2]/d[ch4] */
+    J[91] += dqdci;               /* dwdot[ho2]/d[ch4] */
+    /* d()/d[co2] */
+    dqdci = (TB[12][4] - 1)*dcdc_fac;
+    J[313] -= dqdci;              /* dwdot[h]/d[co2] */
+    J[322] -= dqdci;              /* dwdot[o2]/d[co2] */
+    J[325] += dqdci;              /* dwdot[ho2]/d[co2] */
+    /* d()/d[co] */
+    dqdci = (TB[12][5] - 1)*dcdc_fac;
+    J[352] -= dqdci;              /* dwdot[h]/d[co] */
+    J[361] -= dqdci;              /* dwdot[o2]/d[co] */
+    J[364] += dqdci;              /* dwdot[ho2]/d[co] */
+    /* d()/d[o2] */
+    dqdci =  + k_f*sc[1];
+    J[391] -= dqdci;              /* dwdot[h]/d[o2] */
+    J[400] -= dqdci;              /* dwdot[o2]/d[o2] */
+    J[403] += dqdci;              /* dwdot[ho2]/d[o2] */
+    /* d()/d[ho2] */
+    dqdci =  - k_r;
+    J[508] -= dqdci;              /* dwdot[h]/d[ho2] */
+    J[517] -= dqdci;              /* dwdot[o2]/d[ho2] */
+    J[520] += dqdci;              /* dwdot[ho2]/d[ho2] */
+    /* d()/d[h2o] */
+    dqdci = (TB[12][0] - 1)*dcdc_fac;
+    J[586] -= dqdci;              /* dwdot[h]/d[h2o] */
+    J[595] -= dqdci;              /* dwdot[o2]/d[h2o] */
+    J[598] += dqdci;              /* dwdot[ho2]/d[h2o] */
+    /* d()/d[n2] */
+    dqdci = (TB[12][2] - 1)*dcdc_fac;
+    J[1444] -= dqdci;             /* dwdot[h]/d[n2] */
+    J[1453] -= dqdci;             /* dwdot[o2]/d[n2] */
+    J[1456] += dqdci;             /* dwdot[ho2]/d[n2] */
     J[1483] -= dqdT; /* dwdot[h]/dT */
     J[1492] -= dqdT; /* dwdot[o2]/dT */
     J[1495] += dqdT; /* dwdot[ho2]/dT */
@@ -19641,8 +19704,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = sc[37];
     /* forward */
     phi_f = sc[1]*sc[10];
-    k_f = prefactor_units[13] * fwd_A[13]
-                * exp(fwd_beta[13] * tc[0] - activation_units[13] * fwd_Ea[13] * invT);
+    k_f = k_f_s[13];
     dlnkfdT = fwd_beta[13] * invT + activation_units[13] * fwd_Ea[13] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[13] * exp(low_beta[13] * tc[0] - activation_units[13] * low_Ea[13] * invT);
@@ -19657,7 +19719,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = 0.0;
     /* reverse */
     phi_r = sc[13];
-    Kc = refCinv * exp(g_RT[1] + g_RT[10] - g_RT[13]);
+    Kc = Kc_s[13];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[10]) + (h_RT[13]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19675,73 +19737,26 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[h] */
-        dqdci =  + k_f*sc[10];
-        J[40] -= dqdci;               /* dwdot[h]/d[h] */
-        J[49] -= dqdci;               /* dwdot[o2]/d[h] */
-        J[52] += dqdci;               /* dwdot[ho2]/d[h] */
-        /* d()/d[o2] */
-        dqdci =  + k_f*sc[1];
-        J[391] -= dqdci;              /* dwdot[h]/d[o2] */
-        J[400] -= dqdci;              /* dwdot[o2]/d[o2] */
-        J[403] += dqdci;              /* dwdot[ho2]/d[o2] */
-        /* d()/d[ho2] */
-        dqdci =  - k_r;
-        J[508] -= dqdci;              /* dwdot[h]/d[ho2] */
-        J[517] -= dqdci;              /* dwdot[o2]/d[ho2] */
-        J[520] += dqdci;              /* dwdot[ho2]/d[ho2] */
-        /* d()/d[n2] */
-        dqdci = dcdc_fac;
-        J[1444] -= dqdci;             /* dwdot[h]/d[n2] */
-        J[1453] -= dqdci;             /* dwdot[o2]/d[n2] */
-        J[1456] += dqdci;             /* dwdot[ho2]/d[n2] */
-    }
-    else {
-        dqdc[0] = 0*q_nocor;
-        dqdc[1] = 0*q_nocor + k_f*sc[10];
-        dqdc[2] = 0*q_nocor;
-        dqdc[3] = 0*q_nocor;
-        dqdc[4] = 0*q_nocor;
-        dqdc[5] = 0*q_nocor;
-        dqdc[6] = 0*q_nocor;
-        dqdc[7] = 0*q_nocor;
-        dqdc[8] = 0*q_nocor;
-        dqdc[9] = 0*q_nocor;
-        dqdc[10] = 0*q_nocor + k_f*sc[1];
-        dqdc[11] = 0*q_nocor;
-        dqdc[12] = 0*q_nocor;
-        dqdc[13] = 0*q_nocor - k_r;
-        dqdc[14] = 0*q_nocor;
-        dqdc[15] = 0*q_nocor;
-        dqdc[16] = 0*q_nocor;
-        dqdc[17] = 0*q_nocor;
-        dqdc[18] = 0*q_nocor;
-        dqdc[19] = 0*q_nocor;
-        dqdc[20] = 0*q_nocor;
-        dqdc[21] = 0*q_nocor;
-        dqdc[22] = 0*q_nocor;
-        dqdc[23] = 0*q_nocor;
-        dqdc[24] = 0*q_nocor;
-        dqdc[25] = 0*q_nocor;
-        dqdc[26] = 0*q_nocor;
-        dqdc[27] = 0*q_nocor;
-        dqdc[28] = 0*q_nocor;
-        dqdc[29] = 0*q_nocor;
-        dqdc[30] = 0*q_nocor;
-        dqdc[31] = 0*q_nocor;
-        dqdc[32] = 0*q_nocor;
-        dqdc[33] = 0*q_nocor;
-        dqdc[34] = 0*q_nocor;
-        dqdc[35] = 0*q_nocor;
-        dqdc[36] = 0*q_nocor;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+1] -= dqdc[k];
-            J[39*k+10] -= dqdc[k];
-            J[39*k+13] += dqdc[k];
-        }
-    }
+    /* d()/d[h] */
+    dqdci =  + k_f*sc[10];
+    J[40] -= dqdci;               /* dwdot[h]/d[h] */
+    J[49] -= dqdci;               /* dwdot[o2]/d[h] */
+    J[52] += dqdci;               /* dwdot[ho2]/d[h] */
+    /* d()/d[o2] */
+    dqdci =  + k_f*sc[1];
+    J[391] -= dqdci;              /* dwdot[h]/d[o2] */
+    J[400] -= dqdci;              /* dwdot[o2]/d[o2] */
+    J[403] += dqdci;              /* dwdot[ho2]/d[o2] */
+    /* d()/d[ho2] */
+    dqdci =  - k_r;
+    J[508] -= dqdci;              /* dwdot[h]/d[ho2] */
+    J[517] -= dqdci;              /* dwdot[o2]/d[ho2] */
+    J[520] += dqdci;              /* dwdot[ho2]/d[ho2] */
+    /* d()/d[n2] */
+    dqdci = dcdc_fac;
+    J[1444] -= dqdci;             /* dwdot[h]/d[n2] */
+    J[1453] -= dqdci;             /* dwdot[o2]/d[n2] */
+    J[1456] += dqdci;             /* dwdot[ho2]/d[n2] */
     J[1483] -= dqdT; /* dwdot[h]/dT */
     J[1492] -= dqdT; /* dwdot[o2]/dT */
     J[1495] += dqdT; /* dwdot[ho2]/dT */
@@ -19753,8 +19768,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = sc[0];
     /* forward */
     phi_f = sc[1]*sc[10];
-    k_f = prefactor_units[14] * fwd_A[14]
-                * exp(fwd_beta[14] * tc[0] - activation_units[14] * fwd_Ea[14] * invT);
+    k_f = k_f_s[14];
     dlnkfdT = fwd_beta[14] * invT + activation_units[14] * fwd_Ea[14] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[14] * exp(low_beta[14] * tc[0] - activation_units[14] * low_Ea[14] * invT);
@@ -19769,7 +19783,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = 0.0;
     /* reverse */
     phi_r = sc[13];
-    Kc = refCinv * exp(g_RT[1] + g_RT[10] - g_RT[13]);
+    Kc = Kc_s[14];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[10]) + (h_RT[13]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19787,73 +19801,26 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[h2] */
-        dqdci = dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[h]/d[h2] */
-        J[10] -= dqdci;               /* dwdot[o2]/d[h2] */
-        J[13] += dqdci;               /* dwdot[ho2]/d[h2] */
-        /* d()/d[h] */
-        dqdci =  + k_f*sc[10];
-        J[40] -= dqdci;               /* dwdot[h]/d[h] */
-        J[49] -= dqdci;               /* dwdot[o2]/d[h] */
-        J[52] += dqdci;               /* dwdot[ho2]/d[h] */
-        /* d()/d[o2] */
-        dqdci =  + k_f*sc[1];
-        J[391] -= dqdci;              /* dwdot[h]/d[o2] */
-        J[400] -= dqdci;              /* dwdot[o2]/d[o2] */
-        J[403] += dqdci;              /* dwdot[ho2]/d[o2] */
-        /* d()/d[ho2] */
-        dqdci =  - k_r;
-        J[508] -= dqdci;              /* dwdot[h]/d[ho2] */
-        J[517] -= dqdci;              /* dwdot[o2]/d[ho2] */
-        J[520] += dqdci;              /* dwdot[ho2]/d[ho2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = 0*q_nocor + k_f*sc[10];
-        dqdc[2] = 0*q_nocor;
-        dqdc[3] = 0*q_nocor;
-        dqdc[4] = 0*q_nocor;
-        dqdc[5] = 0*q_nocor;
-        dqdc[6] = 0*q_nocor;
-        dqdc[7] = 0*q_nocor;
-        dqdc[8] = 0*q_nocor;
-        dqdc[9] = 0*q_nocor;
-        dqdc[10] = 0*q_nocor + k_f*sc[1];
-        dqdc[11] = 0*q_nocor;
-        dqdc[12] = 0*q_nocor;
-        dqdc[13] = 0*q_nocor - k_r;
-        dqdc[14] = 0*q_nocor;
-        dqdc[15] = 0*q_nocor;
-        dqdc[16] = 0*q_nocor;
-        dqdc[17] = 0*q_nocor;
-        dqdc[18] = 0*q_nocor;
-        dqdc[19] = 0*q_nocor;
-        dqdc[20] = 0*q_nocor;
-        dqdc[21] = 0*q_nocor;
-        dqdc[22] = 0*q_nocor;
-        dqdc[23] = 0*q_nocor;
-        dqdc[24] = 0*q_nocor;
-        dqdc[25] = 0*q_nocor;
-        dqdc[26] = 0*q_nocor;
-        dqdc[27] = 0*q_nocor;
-        dqdc[28] = 0*q_nocor;
-        dqdc[29] = 0*q_nocor;
-        dqdc[30] = 0*q_nocor;
-        dqdc[31] = 0*q_nocor;
-        dqdc[32] = 0*q_nocor;
-        dqdc[33] = 0*q_nocor;
-        dqdc[34] = 0*q_nocor;
-        dqdc[35] = 0*q_nocor;
-        dqdc[36] = 0*q_nocor;
-        dqdc[37] = 0*q_nocor;
-        for (int k=0; k<38; k++) {
-            J[39*k+1] -= dqdc[k];
-            J[39*k+10] -= dqdc[k];
-            J[39*k+13] += dqdc[k];
-        }
-    }
+    /* d()/d[h2] */
+    dqdci = dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[h]/d[h2] */
+    J[10] -= dqdci;               /* dwdot[o2]/d[h2] */
+    J[13] += dqdci;               /* dwdot[ho2]/d[h2] */
+    /* d()/d[h] */
+    dqdci =  + k_f*sc[10];
+    J[40] -= dqdci;               /* dwdot[h]/d[h] */
+    J[49] -= dqdci;               /* dwdot[o2]/d[h] */
+    J[52] += dqdci;               /* dwdot[ho2]/d[h] */
+    /* d()/d[o2] */
+    dqdci =  + k_f*sc[1];
+    J[391] -= dqdci;              /* dwdot[h]/d[o2] */
+    J[400] -= dqdci;              /* dwdot[o2]/d[o2] */
+    J[403] += dqdci;              /* dwdot[ho2]/d[o2] */
+    /* d()/d[ho2] */
+    dqdci =  - k_r;
+    J[508] -= dqdci;              /* dwdot[h]/d[ho2] */
+    J[517] -= dqdci;              /* dwdot[o2]/d[ho2] */
+    J[520] += dqdci;              /* dwdot[ho2]/d[ho2] */
     J[1483] -= dqdT; /* dwdot[h]/dT */
     J[1492] -= dqdT; /* dwdot[o2]/dT */
     J[1495] += dqdT; /* dwdot[ho2]/dT */
@@ -19865,8 +19832,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = sc[15];
     /* forward */
     phi_f = sc[1]*sc[10];
-    k_f = prefactor_units[15] * fwd_A[15]
-                * exp(fwd_beta[15] * tc[0] - activation_units[15] * fwd_Ea[15] * invT);
+    k_f = k_f_s[15];
     dlnkfdT = fwd_beta[15] * invT + activation_units[15] * fwd_Ea[15] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[15] * exp(low_beta[15] * tc[0] - activation_units[15] * low_Ea[15] * invT);
@@ -19881,7 +19847,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = 0.0;
     /* reverse */
     phi_r = sc[13];
-    Kc = refCinv * exp(g_RT[1] + g_RT[10] - g_RT[13]);
+    Kc = Kc_s[15];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[10]) + (h_RT[13]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19899,73 +19865,26 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[h] */
-        dqdci =  + k_f*sc[10];
-        J[40] -= dqdci;               /* dwdot[h]/d[h] */
-        J[49] -= dqdci;               /* dwdot[o2]/d[h] */
-        J[52] += dqdci;               /* dwdot[ho2]/d[h] */
-        /* d()/d[o2] */
-        dqdci =  + k_f*sc[1];
-        J[391] -= dqdci;              /* dwdot[h]/d[o2] */
-        J[400] -= dqdci;              /* dwdot[o2]/d[o2] */
-        J[403] += dqdci;              /* dwdot[ho2]/d[o2] */
-        /* d()/d[ho2] */
-        dqdci =  - k_r;
-        J[508] -= dqdci;              /* dwdot[h]/d[ho2] */
-        J[517] -= dqdci;              /* dwdot[o2]/d[ho2] */
-        J[520] += dqdci;              /* dwdot[ho2]/d[ho2] */
-        /* d()/d[h2o] */
-        dqdci = dcdc_fac;
-        J[586] -= dqdci;              /* dwdot[h]/d[h2o] */
-        J[595] -= dqdci;              /* dwdot[o2]/d[h2o] */
-        J[598] += dqdci;              /* dwdot[ho2]/d[h2o] */
-    }
-    else {
-        dqdc[0] = 0*q_nocor;
-        dqdc[1] = 0*q_nocor + k_f*sc[10];
-        dqdc[2] = 0*q_nocor;
-        dqdc[3] = 0*q_nocor;
-        dqdc[4] = 0*q_nocor;
-        dqdc[5] = 0*q_nocor;
-        dqdc[6] = 0*q_nocor;
-        dqdc[7] = 0*q_nocor;
-        dqdc[8] = 0*q_nocor;
-        dqdc[9] = 0*q_nocor;
-        dqdc[10] = 0*q_nocor + k_f*sc[1];
-        dqdc[11] = 0*q_nocor;
-        dqdc[12] = 0*q_nocor;
-        dqdc[13] = 0*q_nocor - k_r;
-        dqdc[14] = 0*q_nocor;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = 0*q_nocor;
-        dqdc[17] = 0*q_nocor;
-        dqdc[18] = 0*q_nocor;
-        dqdc[19] = 0*q_nocor;
-        dqdc[20] = 0*q_nocor;
-        dqdc[21] = 0*q_nocor;
-        dqdc[22] = 0*q_nocor;
-        dqdc[23] = 0*q_nocor;
-        dqdc[24] = 0*q_nocor;
-        dqdc[25] = 0*q_nocor;
-        dqdc[26] = 0*q_nocor;
-        dqdc[27] = 0*q_nocor;
-        dqdc[28] = 0*q_nocor;
-        dqdc[29] = 0*q_nocor;
-        dqdc[30] = 0*q_nocor;
-        dqdc[31] = 0*q_nocor;
-        dqdc[32] = 0*q_nocor;
-        dqdc[33] = 0*q_nocor;
-        dqdc[34] = 0*q_nocor;
-        dqdc[35] = 0*q_nocor;
-        dqdc[36] = 0*q_nocor;
-        dqdc[37] = 0*q_nocor;
-        for (int k=0; k<38; k++) {
-            J[39*k+1] -= dqdc[k];
-            J[39*k+10] -= dqdc[k];
-            J[39*k+13] += dqdc[k];
-        }
-    }
+    /* d()/d[h] */
+    dqdci =  + k_f*sc[10];
+    J[40] -= dqdci;               /* dwdot[h]/d[h] */
+    J[49] -= dqdci;               /* dwdot[o2]/d[h] */
+    J[52] += dqdci;               /* dwdot[ho2]/d[h] */
+    /* d()/d[o2] */
+    dqdci =  + k_f*sc[1];
+    J[391] -= dqdci;              /* dwdot[h]/d[o2] */
+    J[400] -= dqdci;              /* dwdot[o2]/d[o2] */
+    J[403] += dqdci;              /* dwdot[ho2]/d[o2] */
+    /* d()/d[ho2] */
+    dqdci =  - k_r;
+    J[508] -= dqdci;              /* dwdot[h]/d[ho2] */
+    J[517] -= dqdci;              /* dwdot[o2]/d[ho2] */
+    J[520] += dqdci;              /* dwdot[ho2]/d[ho2] */
+    /* d()/d[h2o] */
+    dqdci = dcdc_fac;
+    J[586] -= dqdci;              /* dwdot[h]/d[h2o] */
+    J[595] -= dqdci;              /* dwdot[o2]/d[h2o] */
+    J[598] += dqdci;              /* dwdot[ho2]/d[h2o] */
     J[1483] -= dqdT; /* dwdot[h]/dT */
     J[1492] -= dqdT; /* dwdot[o2]/dT */
     J[1495] += dqdT; /* dwdot[ho2]/dT */
@@ -19977,8 +19896,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[20];
-    k_f = prefactor_units[16] * fwd_A[16]
-                * exp(fwd_beta[16] * tc[0] - activation_units[16] * fwd_Ea[16] * invT);
+    k_f = k_f_s[16];
     dlnkfdT = fwd_beta[16] * invT + activation_units[16] * fwd_Ea[16] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[16] * exp(low_beta[16] * tc[0] - activation_units[16] * low_Ea[16] * invT);
@@ -19993,7 +19911,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = 0.0;
     /* reverse */
     phi_r = sc[0]*sc[18];
-    Kc = refC * exp(-g_RT[0] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[16];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[20]) + (h_RT[0] + h_RT[18]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20011,68 +19929,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[h2] */
-        dqdci =  - k_r*sc[18];
-        J[0] += dqdci;                /* dwdot[h2]/d[h2] */
-        J[18] += dqdci;               /* dwdot[c2h2]/d[h2] */
-        J[20] -= dqdci;               /* dwdot[c2h4]/d[h2] */
-        /* d()/d[c2h2] */
-        dqdci =  - k_r*sc[0];
-        J[702] += dqdci;              /* dwdot[h2]/d[c2h2] */
-        J[720] += dqdci;              /* dwdot[c2h2]/d[c2h2] */
-        J[722] -= dqdci;              /* dwdot[c2h4]/d[c2h2] */
-        /* d()/d[c2h4] */
-        dqdci =  + k_f;
-        J[780] += dqdci;              /* dwdot[h2]/d[c2h4] */
-        J[798] += dqdci;              /* dwdot[c2h2]/d[c2h4] */
-        J[800] -= dqdci;              /* dwdot[c2h4]/d[c2h4] */
-    }
-    else {
-        dqdc[0] = dcdc_fac - k_r*sc[18];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac - k_r*sc[0];
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac + k_f;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+0] += dqdc[k];
-            J[39*k+18] += dqdc[k];
-            J[39*k+20] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += dcdc_fac;
+    Jmix[18] += dcdc_fac;
+    Jmix[20] -= dcdc_fac;
+    /* d()/d[h2] */
+    dqdci =  - k_r*sc[18];
+    J[0] += dqdci;                /* dwdot[h2]/d[h2] */
+    J[18] += dqdci;               /* dwdot[c2h2]/d[h2] */
+    J[20] -= dqdci;               /* dwdot[c2h4]/d[h2] */
+    /* d()/d[c2h2] */
+    dqdci =  - k_r*sc[0];
+    J[702] += dqdci;              /* dwdot[h2]/d[c2h2] */
+    J[720] += dqdci;              /* dwdot[c2h2]/d[c2h2] */
+    J[722] -= dqdci;              /* dwdot[c2h4]/d[c2h2] */
+    /* d()/d[c2h4] */
+    dqdci =  + k_f;
+    J[780] += dqdci;              /* dwdot[h2]/d[c2h4] */
+    J[798] += dqdci;              /* dwdot[c2h2]/d[c2h4] */
+    J[800] -= dqdci;              /* dwdot[c2h4]/d[c2h4] */
     J[1482] += dqdT; /* dwdot[h2]/dT */
     J[1500] += dqdT; /* dwdot[c2h2]/dT */
     J[1502] -= dqdT; /* dwdot[c2h4]/dT */
@@ -20084,8 +19959,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[31];
-    k_f = prefactor_units[17] * fwd_A[17]
-                * exp(fwd_beta[17] * tc[0] - activation_units[17] * fwd_Ea[17] * invT);
+    k_f = k_f_s[17];
     dlnkfdT = fwd_beta[17] * invT + activation_units[17] * fwd_Ea[17] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[17] * exp(low_beta[17] * tc[0] - activation_units[17] * low_Ea[17] * invT);
@@ -20100,7 +19974,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = 0.0;
     /* reverse */
     phi_r = sc[3]*sc[9];
-    Kc = refC * exp(-g_RT[3] - g_RT[9] + g_RT[31]);
+    Kc = Kc_s[17];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[31]) + (h_RT[3] + h_RT[9]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20118,68 +19992,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[ch3] */
-        dqdci =  - k_r*sc[9];
-        J[120] += dqdci;              /* dwdot[ch3]/d[ch3] */
-        J[126] += dqdci;              /* dwdot[co]/d[ch3] */
-        J[148] -= dqdci;              /* dwdot[ch3co]/d[ch3] */
-        /* d()/d[co] */
-        dqdci =  - k_r*sc[3];
-        J[354] += dqdci;              /* dwdot[ch3]/d[co] */
-        J[360] += dqdci;              /* dwdot[co]/d[co] */
-        J[382] -= dqdci;              /* dwdot[ch3co]/d[co] */
-        /* d()/d[ch3co] */
-        dqdci =  + k_f;
-        J[1212] += dqdci;             /* dwdot[ch3]/d[ch3co] */
-        J[1218] += dqdci;             /* dwdot[co]/d[ch3co] */
-        J[1240] -= dqdci;             /* dwdot[ch3co]/d[ch3co] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac - k_r*sc[9];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac - k_r*sc[3];
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac + k_f;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+3] += dqdc[k];
-            J[39*k+9] += dqdc[k];
-            J[39*k+31] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] += dcdc_fac;
+    Jmix[9] += dcdc_fac;
+    Jmix[31] -= dcdc_fac;
+    /* d()/d[ch3] */
+    dqdci =  - k_r*sc[9];
+    J[120] += dqdci;              /* dwdot[ch3]/d[ch3] */
+    J[126] += dqdci;              /* dwdot[co]/d[ch3] */
+    J[148] -= dqdci;              /* dwdot[ch3co]/d[ch3] */
+    /* d()/d[co] */
+    dqdci =  - k_r*sc[3];
+    J[354] += dqdci;              /* dwdot[ch3]/d[co] */
+    J[360] += dqdci;              /* dwdot[co]/d[co] */
+    J[382] -= dqdci;              /* dwdot[ch3co]/d[co] */
+    /* d()/d[ch3co] */
+    dqdci =  + k_f;
+    J[1212] += dqdci;             /* dwdot[ch3]/d[ch3co] */
+    J[1218] += dqdci;             /* dwdot[co]/d[ch3co] */
+    J[1240] -= dqdci;             /* dwdot[ch3co]/d[ch3co] */
     J[1485] += dqdT; /* dwdot[ch3]/dT */
     J[1491] += dqdT; /* dwdot[co]/dT */
     J[1513] -= dqdT; /* dwdot[ch3co]/dT */
@@ -20191,8 +20022,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[29];
-    k_f = prefactor_units[18] * fwd_A[18]
-                * exp(fwd_beta[18] * tc[0] - activation_units[18] * fwd_Ea[18] * invT);
+    k_f = k_f_s[18];
     dlnkfdT = fwd_beta[18] * invT + activation_units[18] * fwd_Ea[18] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[18] * exp(low_beta[18] * tc[0] - activation_units[18] * low_Ea[18] * invT);
@@ -20207,7 +20037,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = 0.0;
     /* reverse */
     phi_r = sc[4]*sc[9];
-    Kc = refC * exp(-g_RT[4] - g_RT[9] + g_RT[29]);
+    Kc = Kc_s[18];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[29]) + (h_RT[4] + h_RT[9]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20225,68 +20055,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[ch2] */
-        dqdci =  - k_r*sc[9];
-        J[160] += dqdci;              /* dwdot[ch2]/d[ch2] */
-        J[165] += dqdci;              /* dwdot[co]/d[ch2] */
-        J[185] -= dqdci;              /* dwdot[ch2co]/d[ch2] */
-        /* d()/d[co] */
-        dqdci =  - k_r*sc[4];
-        J[355] += dqdci;              /* dwdot[ch2]/d[co] */
-        J[360] += dqdci;              /* dwdot[co]/d[co] */
-        J[380] -= dqdci;              /* dwdot[ch2co]/d[co] */
-        /* d()/d[ch2co] */
-        dqdci =  + k_f;
-        J[1135] += dqdci;             /* dwdot[ch2]/d[ch2co] */
-        J[1140] += dqdci;             /* dwdot[co]/d[ch2co] */
-        J[1160] -= dqdci;             /* dwdot[ch2co]/d[ch2co] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac - k_r*sc[9];
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac - k_r*sc[4];
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac + k_f;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+4] += dqdc[k];
-            J[39*k+9] += dqdc[k];
-            J[39*k+29] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[4] += dcdc_fac;
+    Jmix[9] += dcdc_fac;
+    Jmix[29] -= dcdc_fac;
+    /* d()/d[ch2] */
+    dqdci =  - k_r*sc[9];
+    J[160] += dqdci;              /* dwdot[ch2]/d[ch2] */
+    J[165] += dqdci;              /* dwdot[co]/d[ch2] */
+    J[185] -= dqdci;              /* dwdot[ch2co]/d[ch2] */
+    /* d()/d[co] */
+    dqdci =  - k_r*sc[4];
+    J[355] += dqdci;              /* dwdot[ch2]/d[co] */
+    J[360] += dqdci;              /* dwdot[co]/d[co] */
+    J[380] -= dqdci;              /* dwdot[ch2co]/d[co] */
+    /* d()/d[ch2co] */
+    dqdci =  + k_f;
+    J[1135] += dqdci;             /* dwdot[ch2]/d[ch2co] */
+    J[1140] += dqdci;             /* dwdot[co]/d[ch2co] */
+    J[1160] -= dqdci;             /* dwdot[ch2co]/d[ch2co] */
     J[1486] += dqdT; /* dwdot[ch2]/dT */
     J[1491] += dqdT; /* dwdot[co]/dT */
     J[1511] -= dqdT; /* dwdot[ch2co]/dT */
@@ -20297,12 +20084,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[19][0] - 1)*sc[15] + (TB[19][1] - 1)*sc[0];
     /* forward */
     phi_f = sc[1]*sc[1];
-    k_f = prefactor_units[19] * fwd_A[19]
-                * exp(fwd_beta[19] * tc[0] - activation_units[19] * fwd_Ea[19] * invT);
+    k_f = k_f_s[19];
     dlnkfdT = fwd_beta[19] * invT + activation_units[19] * fwd_Ea[19] * invT2;
     /* reverse */
     phi_r = sc[0];
-    Kc = refCinv * exp(-g_RT[0] + g_RT[1] + g_RT[1]);
+    Kc = Kc_s[19];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[1]) + (h_RT[0]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20316,79 +20102,35 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[h2] */
-        dqdci = (TB[19][1] - 1)*q_nocor - k_r;
-        J[0] += dqdci;                /* dwdot[h2]/d[h2] */
-        J[1] += -2 * dqdci;           /* dwdot[h]/d[h2] */
-        /* d()/d[h] */
-        dqdci =  + k_f*2*sc[1];
-        J[39] += dqdci;               /* dwdot[h2]/d[h] */
-        J[40] += -2 * dqdci;          /* dwdot[h]/d[h] */
-        /* d()/d[h2o] */
-        dqdci = (TB[19][0] - 1)*q_nocor;
-        J[585] += dqdci;              /* dwdot[h2]/d[h2o] */
-        J[586] += -2 * dqdci;         /* dwdot[h]/d[h2o] */
-    }
-    else {
-        dqdc[0] = TB[19][1] - k_r;
-        dqdc[1] = dcdc_fac + k_f*2*sc[1];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[19][0];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+0] += dqdc[k];
-            J[39*k+1] += -2 * dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += q_nocor;
+    Jmix[1] += -2 * q_nocor;
+    /* d()/d[h2] */
+    dqdci = (TB[19][1] - 1)*q_nocor - k_r;
+    J[0] += dqdci;                /* dwdot[h2]/d[h2] */
+    J[1] += -2 * dqdci;           /* dwdot[h]/d[h2] */
+    /* d()/d[h] */
+    dqdci =  + k_f*2*sc[1];
+    J[39] += dqdci;               /* dwdot[h2]/d[h] */
+    J[40] += -2 * dqdci;          /* dwdot[h]/d[h] */
+    /* d()/d[h2o] */
+    dqdci = (TB[19][0] - 1)*q_nocor;
+    J[585] += dqdci;              /* dwdot[h2]/d[h2o] */
+    J[586] += -2 * dqdci;         /* dwdot[h]/d[h2o] */
     J[1482] += dqdT; /* dwdot[h2]/dT */
     J[1483] += -2 * dqdT; /* dwdot[h]/dT */
 
     /*reaction 21: h + oh + M <=> h2o + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[20][0] - 1)*sc[15];
+    alpha = alpha_eff2;
     /* forward */
     phi_f = sc[1]*sc[12];
-    k_f = prefactor_units[20] * fwd_A[20]
-                * exp(fwd_beta[20] * tc[0] - activation_units[20] * fwd_Ea[20] * invT);
+    k_f = k_f_s[20];
     dlnkfdT = fwd_beta[20] * invT + activation_units[20] * fwd_Ea[20] * invT2;
     /* reverse */
     phi_r = sc[15];
-    Kc = refCinv * exp(g_RT[1] + g_RT[12] - g_RT[15]);
+    Kc = Kc_s[20];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[12]) + (h_RT[15]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20403,68 +20145,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[h] */
-        dqdci =  + k_f*sc[12];
-        J[40] -= dqdci;               /* dwdot[h]/d[h] */
-        J[51] -= dqdci;               /* dwdot[oh]/d[h] */
-        J[54] += dqdci;               /* dwdot[h2o]/d[h] */
-        /* d()/d[oh] */
-        dqdci =  + k_f*sc[1];
-        J[469] -= dqdci;              /* dwdot[h]/d[oh] */
-        J[480] -= dqdci;              /* dwdot[oh]/d[oh] */
-        J[483] += dqdci;              /* dwdot[h2o]/d[oh] */
-        /* d()/d[h2o] */
-        dqdci = (TB[20][0] - 1)*q_nocor - k_r;
-        J[586] -= dqdci;              /* dwdot[h]/d[h2o] */
-        J[597] -= dqdci;              /* dwdot[oh]/d[h2o] */
-        J[600] += dqdci;              /* dwdot[h2o]/d[h2o] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[12];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*sc[1];
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[20][0] - k_r;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+1] -= dqdc[k];
-            J[39*k+12] -= dqdc[k];
-            J[39*k+15] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= q_nocor;
+    Jmix[12] -= q_nocor;
+    Jmix[15] += q_nocor;
+    /* d()/d[h] */
+    dqdci =  + k_f*sc[12];
+    J[40] -= dqdci;               /* dwdot[h]/d[h] */
+    J[51] -= dqdci;               /* dwdot[oh]/d[h] */
+    J[54] += dqdci;               /* dwdot[h2o]/d[h] */
+    /* d()/d[oh] */
+    dqdci =  + k_f*sc[1];
+    J[469] -= dqdci;              /* dwdot[h]/d[oh] */
+    J[480] -= dqdci;              /* dwdot[oh]/d[oh] */
+    J[483] += dqdci;              /* dwdot[h2o]/d[oh] */
+    /* d()/d[h2o] */
+    dqdci = (TB[20][0] - 1)*q_nocor - k_r;
+    J[586] -= dqdci;              /* dwdot[h]/d[h2o] */
+    J[597] -= dqdci;              /* dwdot[oh]/d[h2o] */
+    J[600] += dqdci;              /* dwdot[h2o]/d[h2o] */
     J[1483] -= dqdT; /* dwdot[h]/dT */
     J[1494] -= dqdT; /* dwdot[oh]/dT */
     J[1497] += dqdT; /* dwdot[h2o]/dT */
@@ -20472,15 +20171,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 22: h + o + M <=> oh + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[21][0] - 1)*sc[15];
+    alpha = (memcmp(TB[21], TB[20], 1*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[21][0] - 1)*sc[15]);
     /* forward */
     phi_f = sc[1]*sc[11];
-    k_f = prefactor_units[21] * fwd_A[21]
-                * exp(fwd_beta[21] * tc[0] - activation_units[21] * fwd_Ea[21] * invT);
+    k_f = k_f_s[21];
     dlnkfdT = fwd_beta[21] * invT + activation_units[21] * fwd_Ea[21] * invT2;
     /* reverse */
     phi_r = sc[12];
-    Kc = refCinv * exp(g_RT[1] + g_RT[11] - g_RT[12]);
+    Kc = Kc_s[21];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[11]) + (h_RT[12]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20495,73 +20193,30 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[h] */
-        dqdci =  + k_f*sc[11];
-        J[40] -= dqdci;               /* dwdot[h]/d[h] */
-        J[50] -= dqdci;               /* dwdot[o]/d[h] */
-        J[51] += dqdci;               /* dwdot[oh]/d[h] */
-        /* d()/d[o] */
-        dqdci =  + k_f*sc[1];
-        J[430] -= dqdci;              /* dwdot[h]/d[o] */
-        J[440] -= dqdci;              /* dwdot[o]/d[o] */
-        J[441] += dqdci;              /* dwdot[oh]/d[o] */
-        /* d()/d[oh] */
-        dqdci =  - k_r;
-        J[469] -= dqdci;              /* dwdot[h]/d[oh] */
-        J[479] -= dqdci;              /* dwdot[o]/d[oh] */
-        J[480] += dqdci;              /* dwdot[oh]/d[oh] */
-        /* d()/d[h2o] */
-        dqdci = (TB[21][0] - 1)*q_nocor;
-        J[586] -= dqdci;              /* dwdot[h]/d[h2o] */
-        J[596] -= dqdci;              /* dwdot[o]/d[h2o] */
-        J[597] += dqdci;              /* dwdot[oh]/d[h2o] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[11];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac + k_f*sc[1];
-        dqdc[12] = dcdc_fac - k_r;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[21][0];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+1] -= dqdc[k];
-            J[39*k+11] -= dqdc[k];
-            J[39*k+12] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= q_nocor;
+    Jmix[11] -= q_nocor;
+    Jmix[12] += q_nocor;
+    /* d()/d[h] */
+    dqdci =  + k_f*sc[11];
+    J[40] -= dqdci;               /* dwdot[h]/d[h] */
+    J[50] -= dqdci;               /* dwdot[o]/d[h] */
+    J[51] += dqdci;               /* dwdot[oh]/d[h] */
+    /* d()/d[o] */
+    dqdci =  + k_f*sc[1];
+    J[430] -= dqdci;              /* dwdot[h]/d[o] */
+    J[440] -= dqdci;              /* dwdot[o]/d[o] */
+    J[441] += dqdci;              /* dwdot[oh]/d[o] */
+    /* d()/d[oh] */
+    dqdci =  - k_r;
+    J[469] -= dqdci;              /* dwdot[h]/d[oh] */
+    J[479] -= dqdci;              /* dwdot[o]/d[oh] */
+    J[480] += dqdci;              /* dwdot[oh]/d[oh] */
+    /* d()/d[h2o] */
+    dqdci = (TB[21][0] - 1)*q_nocor;
+    J[586] -= dqdci;              /* dwdot[h]/d[h2o] */
+    J[596] -= dqdci;              /* dwdot[o]/d[h2o] */
+    J[597] += dqdci;              /* dwdot[oh]/d[h2o] */
     J[1483] -= dqdT; /* dwdot[h]/dT */
     J[1493] -= dqdT; /* dwdot[o]/dT */
     J[1494] += dqdT; /* dwdot[oh]/dT */
@@ -20572,12 +20227,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[11]*sc[11];
-    k_f = prefactor_units[22] * fwd_A[22]
-                * exp(fwd_beta[22] * tc[0] - activation_units[22] * fwd_Ea[22] * invT);
+    k_f = k_f_s[22];
     dlnkfdT = fwd_beta[22] * invT + activation_units[22] * fwd_Ea[22] * invT2;
     /* reverse */
     phi_r = sc[10];
-    Kc = refCinv * exp(-g_RT[10] + g_RT[11] + g_RT[11]);
+    Kc = Kc_s[22];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[11]) + (h_RT[10]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20591,60 +20245,17 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[o2] */
-        dqdci =  - k_r;
-        J[400] += dqdci;              /* dwdot[o2]/d[o2] */
-        J[401] += -2 * dqdci;         /* dwdot[o]/d[o2] */
-        /* d()/d[o] */
-        dqdci =  + k_f*2*sc[11];
-        J[439] += dqdci;              /* dwdot[o2]/d[o] */
-        J[440] += -2 * dqdci;         /* dwdot[o]/d[o] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac - k_r;
-        dqdc[11] = dcdc_fac + k_f*2*sc[11];
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+10] += dqdc[k];
-            J[39*k+11] += -2 * dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[10] += q_nocor;
+    Jmix[11] += -2 * q_nocor;
+    /* d()/d[o2] */
+    dqdci =  - k_r;
+    J[400] += dqdci;              /* dwdot[o2]/d[o2] */
+    J[401] += -2 * dqdci;         /* dwdot[o]/d[o2] */
+    /* d()/d[o] */
+    dqdci =  + k_f*2*sc[11];
+    J[439] += dqdci;              /* dwdot[o2]/d[o] */
+    J[440] += -2 * dqdci;         /* dwdot[o]/d[o] */
     J[1492] += dqdT; /* dwdot[o2]/dT */
     J[1493] += -2 * dqdT; /* dwdot[o]/dT */
 
@@ -20654,12 +20265,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[3];
-    k_f = prefactor_units[23] * fwd_A[23]
-                * exp(fwd_beta[23] * tc[0] - activation_units[23] * fwd_Ea[23] * invT);
+    k_f = k_f_s[23];
     dlnkfdT = fwd_beta[23] * invT + activation_units[23] * fwd_Ea[23] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[5];
-    Kc = refC * exp(-g_RT[0] + g_RT[3] - g_RT[5]);
+    Kc = Kc_s[23];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3]) + (h_RT[0] + h_RT[5]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20674,68 +20284,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[h2] */
-        dqdci =  - k_r*sc[5];
-        J[0] += dqdci;                /* dwdot[h2]/d[h2] */
-        J[3] -= dqdci;                /* dwdot[ch3]/d[h2] */
-        J[5] += dqdci;                /* dwdot[ch]/d[h2] */
-        /* d()/d[ch3] */
-        dqdci =  + k_f;
-        J[117] += dqdci;              /* dwdot[h2]/d[ch3] */
-        J[120] -= dqdci;              /* dwdot[ch3]/d[ch3] */
-        J[122] += dqdci;              /* dwdot[ch]/d[ch3] */
-        /* d()/d[ch] */
-        dqdci =  - k_r*sc[0];
-        J[195] += dqdci;              /* dwdot[h2]/d[ch] */
-        J[198] -= dqdci;              /* dwdot[ch3]/d[ch] */
-        J[200] += dqdci;              /* dwdot[ch]/d[ch] */
-    }
-    else {
-        dqdc[0] = dcdc_fac - k_r*sc[5];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac + k_f;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac - k_r*sc[0];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+0] += dqdc[k];
-            J[39*k+3] -= dqdc[k];
-            J[39*k+5] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += q_nocor;
+    Jmix[3] -= q_nocor;
+    Jmix[5] += q_nocor;
+    /* d()/d[h2] */
+    dqdci =  - k_r*sc[5];
+    J[0] += dqdci;                /* dwdot[h2]/d[h2] */
+    J[3] -= dqdci;                /* dwdot[ch3]/d[h2] */
+    J[5] += dqdci;                /* dwdot[ch]/d[h2] */
+    /* d()/d[ch3] */
+    dqdci =  + k_f;
+    J[117] += dqdci;              /* dwdot[h2]/d[ch3] */
+    J[120] -= dqdci;              /* dwdot[ch3]/d[ch3] */
+    J[122] += dqdci;              /* dwdot[ch]/d[ch3] */
+    /* d()/d[ch] */
+    dqdci =  - k_r*sc[0];
+    J[195] += dqdci;              /* dwdot[h2]/d[ch] */
+    J[198] -= dqdci;              /* dwdot[ch3]/d[ch] */
+    J[200] += dqdci;              /* dwdot[ch]/d[ch] */
     J[1482] += dqdT; /* dwdot[h2]/dT */
     J[1485] -= dqdT; /* dwdot[ch3]/dT */
     J[1487] += dqdT; /* dwdot[ch]/dT */
@@ -20746,12 +20313,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[3];
-    k_f = prefactor_units[24] * fwd_A[24]
-                * exp(fwd_beta[24] * tc[0] - activation_units[24] * fwd_Ea[24] * invT);
+    k_f = k_f_s[24];
     dlnkfdT = fwd_beta[24] * invT + activation_units[24] * fwd_Ea[24] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[4];
-    Kc = refC * exp(-g_RT[1] + g_RT[3] - g_RT[4]);
+    Kc = Kc_s[24];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3]) + (h_RT[1] + h_RT[4]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20766,68 +20332,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[h] */
-        dqdci =  - k_r*sc[4];
-        J[40] += dqdci;               /* dwdot[h]/d[h] */
-        J[42] -= dqdci;               /* dwdot[ch3]/d[h] */
-        J[43] += dqdci;               /* dwdot[ch2]/d[h] */
-        /* d()/d[ch3] */
-        dqdci =  + k_f;
-        J[118] += dqdci;              /* dwdot[h]/d[ch3] */
-        J[120] -= dqdci;              /* dwdot[ch3]/d[ch3] */
-        J[121] += dqdci;              /* dwdot[ch2]/d[ch3] */
-        /* d()/d[ch2] */
-        dqdci =  - k_r*sc[1];
-        J[157] += dqdci;              /* dwdot[h]/d[ch2] */
-        J[159] -= dqdci;              /* dwdot[ch3]/d[ch2] */
-        J[160] += dqdci;              /* dwdot[ch2]/d[ch2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac - k_r*sc[4];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac + k_f;
-        dqdc[4] = dcdc_fac - k_r*sc[1];
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+1] += dqdc[k];
-            J[39*k+3] -= dqdc[k];
-            J[39*k+4] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] += q_nocor;
+    Jmix[3] -= q_nocor;
+    Jmix[4] += q_nocor;
+    /* d()/d[h] */
+    dqdci =  - k_r*sc[4];
+    J[40] += dqdci;               /* dwdot[h]/d[h] */
+    J[42] -= dqdci;               /* dwdot[ch3]/d[h] */
+    J[43] += dqdci;               /* dwdot[ch2]/d[h] */
+    /* d()/d[ch3] */
+    dqdci =  + k_f;
+    J[118] += dqdci;              /* dwdot[h]/d[ch3] */
+    J[120] -= dqdci;              /* dwdot[ch3]/d[ch3] */
+    J[121] += dqdci;              /* dwdot[ch2]/d[ch3] */
+    /* d()/d[ch2] */
+    dqdci =  - k_r*sc[1];
+    J[157] += dqdci;              /* dwdot[h]/d[ch2] */
+    J[159] -= dqdci;              /* dwdot[ch3]/d[ch2] */
+    J[160] += dqdci;              /* dwdot[ch2]/d[ch2] */
     J[1483] += dqdT; /* dwdot[h]/dT */
     J[1485] -= dqdT; /* dwdot[ch3]/dT */
     J[1486] += dqdT; /* dwdot[ch2]/dT */
@@ -20838,12 +20361,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[25][0] - 1)*sc[1] + (TB[25][1] - 1)*sc[18] + (TB[25][2] - 1)*sc[15];
     /* forward */
     phi_f = sc[28];
-    k_f = prefactor_units[25] * fwd_A[25]
-                * exp(fwd_beta[25] * tc[0] - activation_units[25] * fwd_Ea[25] * invT);
+    k_f = k_f_s[25];
     dlnkfdT = fwd_beta[25] * invT + activation_units[25] * fwd_Ea[25] * invT2;
     /* reverse */
     phi_r = sc[4];
-    Kc = exp(-g_RT[4] + g_RT[28]);
+    Kc = Kc_s[25];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[28]) + (h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20857,72 +20379,29 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[h] */
-        dqdci = (TB[25][0] - 1)*q_nocor;
-        J[43] += dqdci;               /* dwdot[ch2]/d[h] */
-        J[67] -= dqdci;               /* dwdot[ch2s]/d[h] */
-        /* d()/d[ch2] */
-        dqdci =  - k_r;
-        J[160] += dqdci;              /* dwdot[ch2]/d[ch2] */
-        J[184] -= dqdci;              /* dwdot[ch2s]/d[ch2] */
-        /* d()/d[h2o] */
-        dqdci = (TB[25][2] - 1)*q_nocor;
-        J[589] += dqdci;              /* dwdot[ch2]/d[h2o] */
-        J[613] -= dqdci;              /* dwdot[ch2s]/d[h2o] */
-        /* d()/d[c2h2] */
-        dqdci = (TB[25][1] - 1)*q_nocor;
-        J[706] += dqdci;              /* dwdot[ch2]/d[c2h2] */
-        J[730] -= dqdci;              /* dwdot[ch2s]/d[c2h2] */
-        /* d()/d[ch2s] */
-        dqdci =  + k_f;
-        J[1096] += dqdci;             /* dwdot[ch2]/d[ch2s] */
-        J[1120] -= dqdci;             /* dwdot[ch2s]/d[ch2s] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[25][0];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac - k_r;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[25][2];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[25][1];
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac + k_f;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+4] += dqdc[k];
-            J[39*k+28] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[4] += q_nocor;
+    Jmix[28] -= q_nocor;
+    /* d()/d[h] */
+    dqdci = (TB[25][0] - 1)*q_nocor;
+    J[43] += dqdci;               /* dwdot[ch2]/d[h] */
+    J[67] -= dqdci;               /* dwdot[ch2s]/d[h] */
+    /* d()/d[ch2] */
+    dqdci =  - k_r;
+    J[160] += dqdci;              /* dwdot[ch2]/d[ch2] */
+    J[184] -= dqdci;              /* dwdot[ch2s]/d[ch2] */
+    /* d()/d[h2o] */
+    dqdci = (TB[25][2] - 1)*q_nocor;
+    J[589] += dqdci;              /* dwdot[ch2]/d[h2o] */
+    J[613] -= dqdci;              /* dwdot[ch2s]/d[h2o] */
+    /* d()/d[c2h2] */
+    dqdci = (TB[25][1] - 1)*q_nocor;
+    J[706] += dqdci;              /* dwdot[ch2]/d[c2h2] */
+    J[730] -= dqdci;              /* dwdot[ch2s]/d[c2h2] */
+    /* d()/d[ch2s] */
+    dqdci =  + k_f;
+    J[1096] += dqdci;             /* dwdot[ch2]/d[ch2s] */
+    J[1120] -= dqdci;             /* dwdot[ch2s]/d[ch2s] */
     J[1486] += dqdT; /* dwdot[ch2]/dT */
     J[1510] -= dqdT; /* dwdot[ch2s]/dT */
 
@@ -20932,12 +20411,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[6];
-    k_f = prefactor_units[26] * fwd_A[26]
-                * exp(fwd_beta[26] * tc[0] - activation_units[26] * fwd_Ea[26] * invT);
+    k_f = k_f_s[26];
     dlnkfdT = fwd_beta[26] * invT + activation_units[26] * fwd_Ea[26] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[7];
-    Kc = refC * exp(-g_RT[1] + g_RT[6] - g_RT[7]);
+    Kc = Kc_s[26];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6]) + (h_RT[1] + h_RT[7]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20952,68 +20430,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[h] */
-        dqdci =  - k_r*sc[7];
-        J[40] += dqdci;               /* dwdot[h]/d[h] */
-        J[45] -= dqdci;               /* dwdot[ch2o]/d[h] */
-        J[46] += dqdci;               /* dwdot[hco]/d[h] */
-        /* d()/d[ch2o] */
-        dqdci =  + k_f;
-        J[235] += dqdci;              /* dwdot[h]/d[ch2o] */
-        J[240] -= dqdci;              /* dwdot[ch2o]/d[ch2o] */
-        J[241] += dqdci;              /* dwdot[hco]/d[ch2o] */
-        /* d()/d[hco] */
-        dqdci =  - k_r*sc[1];
-        J[274] += dqdci;              /* dwdot[h]/d[hco] */
-        J[279] -= dqdci;              /* dwdot[ch2o]/d[hco] */
-        J[280] += dqdci;              /* dwdot[hco]/d[hco] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac - k_r*sc[7];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac + k_f;
-        dqdc[7] = dcdc_fac - k_r*sc[1];
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+1] += dqdc[k];
-            J[39*k+6] -= dqdc[k];
-            J[39*k+7] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] += q_nocor;
+    Jmix[6] -= q_nocor;
+    Jmix[7] += q_nocor;
+    /* d()/d[h] */
+    dqdci =  - k_r*sc[7];
+    J[40] += dqdci;               /* dwdot[h]/d[h] */
+    J[45] -= dqdci;               /* dwdot[ch2o]/d[h] */
+    J[46] += dqdci;               /* dwdot[hco]/d[h] */
+    /* d()/d[ch2o] */
+    dqdci =  + k_f;
+    J[235] += dqdci;              /* dwdot[h]/d[ch2o] */
+    J[240] -= dqdci;              /* dwdot[ch2o]/d[ch2o] */
+    J[241] += dqdci;              /* dwdot[hco]/d[ch2o] */
+    /* d()/d[hco] */
+    dqdci =  - k_r*sc[1];
+    J[274] += dqdci;              /* dwdot[h]/d[hco] */
+    J[279] -= dqdci;              /* dwdot[ch2o]/d[hco] */
+    J[280] += dqdci;              /* dwdot[hco]/d[hco] */
     J[1483] += dqdT; /* dwdot[h]/dT */
     J[1488] -= dqdT; /* dwdot[ch2o]/dT */
     J[1489] += dqdT; /* dwdot[hco]/dT */
@@ -21024,12 +20459,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[27][0] - 1)*sc[15] + (TB[27][1] - 1)*sc[0] + (TB[27][2] - 1)*sc[8] + (TB[27][3] - 1)*sc[9] + (TB[27][4] - 1)*sc[2];
     /* forward */
     phi_f = sc[7];
-    k_f = prefactor_units[27] * fwd_A[27]
-                * exp(fwd_beta[27] * tc[0] - activation_units[27] * fwd_Ea[27] * invT);
+    k_f = k_f_s[27];
     dlnkfdT = fwd_beta[27] * invT + activation_units[27] * fwd_Ea[27] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[9];
-    Kc = refC * exp(-g_RT[1] + g_RT[7] - g_RT[9]);
+    Kc = Kc_s[27];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7]) + (h_RT[1] + h_RT[9]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21044,88 +20478,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[h2] */
-        dqdci = (TB[27][1] - 1)*q_nocor;
-        J[1] += dqdci;                /* dwdot[h]/d[h2] */
-        J[7] -= dqdci;                /* dwdot[hco]/d[h2] */
-        J[9] += dqdci;                /* dwdot[co]/d[h2] */
-        /* d()/d[h] */
-        dqdci =  - k_r*sc[9];
-        J[40] += dqdci;               /* dwdot[h]/d[h] */
-        J[46] -= dqdci;               /* dwdot[hco]/d[h] */
-        J[48] += dqdci;               /* dwdot[co]/d[h] */
-        /* d()/d[ch4] */
-        dqdci = (TB[27][4] - 1)*q_nocor;
-        J[79] += dqdci;               /* dwdot[h]/d[ch4] */
-        J[85] -= dqdci;               /* dwdot[hco]/d[ch4] */
-        J[87] += dqdci;               /* dwdot[co]/d[ch4] */
-        /* d()/d[hco] */
-        dqdci =  + k_f;
-        J[274] += dqdci;              /* dwdot[h]/d[hco] */
-        J[280] -= dqdci;              /* dwdot[hco]/d[hco] */
-        J[282] += dqdci;              /* dwdot[co]/d[hco] */
-        /* d()/d[co2] */
-        dqdci = (TB[27][2] - 1)*q_nocor;
-        J[313] += dqdci;              /* dwdot[h]/d[co2] */
-        J[319] -= dqdci;              /* dwdot[hco]/d[co2] */
-        J[321] += dqdci;              /* dwdot[co]/d[co2] */
-        /* d()/d[co] */
-        dqdci = (TB[27][3] - 1)*q_nocor - k_r*sc[1];
-        J[352] += dqdci;              /* dwdot[h]/d[co] */
-        J[358] -= dqdci;              /* dwdot[hco]/d[co] */
-        J[360] += dqdci;              /* dwdot[co]/d[co] */
-        /* d()/d[h2o] */
-        dqdci = (TB[27][0] - 1)*q_nocor;
-        J[586] += dqdci;              /* dwdot[h]/d[h2o] */
-        J[592] -= dqdci;              /* dwdot[hco]/d[h2o] */
-        J[594] += dqdci;              /* dwdot[co]/d[h2o] */
-    }
-    else {
-        dqdc[0] = TB[27][1];
-        dqdc[1] = dcdc_fac - k_r*sc[9];
-        dqdc[2] = TB[27][4];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac + k_f;
-        dqdc[8] = TB[27][2];
-        dqdc[9] = TB[27][3] - k_r*sc[1];
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[27][0];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+1] += dqdc[k];
-            J[39*k+7] -= dqdc[k];
-            J[39*k+9] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] += q_nocor;
+    Jmix[7] -= q_nocor;
+    Jmix[9] += q_nocor;
+    /* d()/d[h2] */
+    dqdci = (TB[27][1] - 1)*q_nocor;
+    J[1] += dqdci;                /* dwdot[h]/d[h2] */
+    J[7] -= dqdci;                /* dwdot[hco]/d[h2] */
+    J[9] += dqdci;                /* dwdot[co]/d[h2] */
+    /* d()/d[h] */
+    dqdci =  - k_r*sc[9];
+    J[40] += dqdci;               /* dwdot[h]/d[h] */
+    J[46] -= dqdci;               /* dwdot[hco]/d[h] */
+    J[48] += dqdci;               /* dwdot[co]/d[h] */
+    /* d()/d[ch4] */
+    dqdci = (TB[27][4] - 1)*q_nocor;
+    J[79] += dqdci;               /* dwdot[h]/d[ch4] */
+    J[85] -= dqdci;               /* dwdot[hco]/d[ch4] */
+    J[87] += dqdci;               /* dwdot[co]/d[ch4] */
+    /* d()/d[hco] */
+    dqdci =  + k_f;
+    J[274] += dqdci;              /* dwdot[h]/d[hco] */
+    J[280] -= dqdci;              /* dwdot[hco]/d[hco] */
+    J[282] += dqdci;              /* dwdot[co]/d[hco] */
+    /* d()/d[co2] */
+    dqdci = (TB[27][2] - 1)*q_nocor;
+    J[313] += dqdci;              /* dwdot[h]/d[co2] */
+    J[319] -= dqdci;              /* dwdot[hco]/d[co2] */
+    J[321] += dqdci;              /* dwdot[co]/d[co2] */
+    /* d()/d[co] */
+    dqdci = (TB[27][3] - 1)*q_nocor - k_r*sc[1];
+    J[352] += dqdci;              /* dwdot[h]/d[co] */
+    J[358] -= dqdci;              /* dwdot[hco]/d[co] */
+    J[360] += dqdci;              /* dwdot[co]/d[co] */
+    /* d()/d[h2o] */
+    dqdci = (TB[27][0] - 1)*q_nocor;
+    J[586] += dqdci;              /* dwdot[h]/d[h2o] */
+    J[592] -= dqdci;              /* dwdot[hco]/d[h2o] */
+    J[594] += dqdci;              /* dwdot[co]/d[h2o] */
     J[1483] += dqdT; /* dwdot[h]/dT */
     J[1489] -= dqdT; /* dwdot[hco]/dT */
     J[1491] += dqdT; /* dwdot[co]/dT */
@@ -21136,12 +20527,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[9]*sc[11];
-    k_f = prefactor_units[28] * fwd_A[28]
-                * exp(fwd_beta[28] * tc[0] - activation_units[28] * fwd_Ea[28] * invT);
+    k_f = k_f_s[28];
     dlnkfdT = fwd_beta[28] * invT + activation_units[28] * fwd_Ea[28] * invT2;
     /* reverse */
     phi_r = sc[8];
-    Kc = refCinv * exp(-g_RT[8] + g_RT[9] + g_RT[11]);
+    Kc = Kc_s[28];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[11]) + (h_RT[8]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21156,68 +20546,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[co2] */
-        dqdci =  - k_r;
-        J[320] += dqdci;              /* dwdot[co2]/d[co2] */
-        J[321] -= dqdci;              /* dwdot[co]/d[co2] */
-        J[323] -= dqdci;              /* dwdot[o]/d[co2] */
-        /* d()/d[co] */
-        dqdci =  + k_f*sc[11];
-        J[359] += dqdci;              /* dwdot[co2]/d[co] */
-        J[360] -= dqdci;              /* dwdot[co]/d[co] */
-        J[362] -= dqdci;              /* dwdot[o]/d[co] */
-        /* d()/d[o] */
-        dqdci =  + k_f*sc[9];
-        J[437] += dqdci;              /* dwdot[co2]/d[o] */
-        J[438] -= dqdci;              /* dwdot[co]/d[o] */
-        J[440] -= dqdci;              /* dwdot[o]/d[o] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac - k_r;
-        dqdc[9] = dcdc_fac + k_f*sc[11];
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac + k_f*sc[9];
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+8] += dqdc[k];
-            J[39*k+9] -= dqdc[k];
-            J[39*k+11] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[8] += q_nocor;
+    Jmix[9] -= q_nocor;
+    Jmix[11] -= q_nocor;
+    /* d()/d[co2] */
+    dqdci =  - k_r;
+    J[320] += dqdci;              /* dwdot[co2]/d[co2] */
+    J[321] -= dqdci;              /* dwdot[co]/d[co2] */
+    J[323] -= dqdci;              /* dwdot[o]/d[co2] */
+    /* d()/d[co] */
+    dqdci =  + k_f*sc[11];
+    J[359] += dqdci;              /* dwdot[co2]/d[co] */
+    J[360] -= dqdci;              /* dwdot[co]/d[co] */
+    J[362] -= dqdci;              /* dwdot[o]/d[co] */
+    /* d()/d[o] */
+    dqdci =  + k_f*sc[9];
+    J[437] += dqdci;              /* dwdot[co2]/d[o] */
+    J[438] -= dqdci;              /* dwdot[co]/d[o] */
+    J[440] -= dqdci;              /* dwdot[o]/d[o] */
     J[1490] += dqdT; /* dwdot[co2]/dT */
     J[1491] -= dqdT; /* dwdot[co]/dT */
     J[1493] -= dqdT; /* dwdot[o]/dT */
@@ -21228,12 +20575,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[36];
-    k_f = prefactor_units[29] * fwd_A[29]
-                * exp(fwd_beta[29] * tc[0] - activation_units[29] * fwd_Ea[29] * invT);
+    k_f = k_f_s[29];
     dlnkfdT = fwd_beta[29] * invT + activation_units[29] * fwd_Ea[29] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[32];
-    Kc = refC * exp(-g_RT[1] - g_RT[32] + g_RT[36]);
+    Kc = Kc_s[29];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[36]) + (h_RT[1] + h_RT[32]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21248,68 +20594,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[h] */
-        dqdci =  - k_r*sc[32];
-        J[40] += dqdci;               /* dwdot[h]/d[h] */
-        J[71] += dqdci;               /* dwdot[ch3hco]/d[h] */
-        J[75] -= dqdci;               /* dwdot[ch3ch2o]/d[h] */
-        /* d()/d[ch3hco] */
-        dqdci =  - k_r*sc[1];
-        J[1249] += dqdci;             /* dwdot[h]/d[ch3hco] */
-        J[1280] += dqdci;             /* dwdot[ch3hco]/d[ch3hco] */
-        J[1284] -= dqdci;             /* dwdot[ch3ch2o]/d[ch3hco] */
-        /* d()/d[ch3ch2o] */
-        dqdci =  + k_f;
-        J[1405] += dqdci;             /* dwdot[h]/d[ch3ch2o] */
-        J[1436] += dqdci;             /* dwdot[ch3hco]/d[ch3ch2o] */
-        J[1440] -= dqdci;             /* dwdot[ch3ch2o]/d[ch3ch2o] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac - k_r*sc[32];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac - k_r*sc[1];
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac + k_f;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+1] += dqdc[k];
-            J[39*k+32] += dqdc[k];
-            J[39*k+36] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] += q_nocor;
+    Jmix[32] += q_nocor;
+    Jmix[36] -= q_nocor;
+    /* d()/d[h] */
+    dqdci =  - k_r*sc[32];
+    J[40] += dqdci;               /* dwdot[h]/d[h] */
+    J[71] += dqdci;               /* dwdot[ch3hco]/d[h] */
+    J[75] -= dqdci;               /* dwdot[ch3ch2o]/d[h] */
+    /* d()/d[ch3hco] */
+    dqdci =  - k_r*sc[1];
+    J[1249] += dqdci;             /* dwdot[h]/d[ch3hco] */
+    J[1280] += dqdci;             /* dwdot[ch3hco]/d[ch3hco] */
+    J[1284] -= dqdci;             /* dwdot[ch3ch2o]/d[ch3hco] */
+    /* d()/d[ch3ch2o] */
+    dqdci =  + k_f;
+    J[1405] += dqdci;             /* dwdot[h]/d[ch3ch2o] */
+    J[1436] += dqdci;             /* dwdot[ch3hco]/d[ch3ch2o] */
+    J[1440] -= dqdci;             /* dwdot[ch3ch2o]/d[ch3ch2o] */
     J[1483] += dqdT; /* dwdot[h]/dT */
     J[1514] += dqdT; /* dwdot[ch3hco]/dT */
     J[1518] -= dqdT; /* dwdot[ch3ch2o]/dT */
@@ -21320,12 +20623,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[36];
-    k_f = prefactor_units[30] * fwd_A[30]
-                * exp(fwd_beta[30] * tc[0] - activation_units[30] * fwd_Ea[30] * invT);
+    k_f = k_f_s[30];
     dlnkfdT = fwd_beta[30] * invT + activation_units[30] * fwd_Ea[30] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[6];
-    Kc = refC * exp(-g_RT[3] - g_RT[6] + g_RT[36]);
+    Kc = Kc_s[30];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[36]) + (h_RT[3] + h_RT[6]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21340,68 +20642,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[ch3] */
-        dqdci =  - k_r*sc[6];
-        J[120] += dqdci;              /* dwdot[ch3]/d[ch3] */
-        J[123] += dqdci;              /* dwdot[ch2o]/d[ch3] */
-        J[153] -= dqdci;              /* dwdot[ch3ch2o]/d[ch3] */
-        /* d()/d[ch2o] */
-        dqdci =  - k_r*sc[3];
-        J[237] += dqdci;              /* dwdot[ch3]/d[ch2o] */
-        J[240] += dqdci;              /* dwdot[ch2o]/d[ch2o] */
-        J[270] -= dqdci;              /* dwdot[ch3ch2o]/d[ch2o] */
-        /* d()/d[ch3ch2o] */
-        dqdci =  + k_f;
-        J[1407] += dqdci;             /* dwdot[ch3]/d[ch3ch2o] */
-        J[1410] += dqdci;             /* dwdot[ch2o]/d[ch3ch2o] */
-        J[1440] -= dqdci;             /* dwdot[ch3ch2o]/d[ch3ch2o] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac - k_r*sc[6];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac - k_r*sc[3];
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac + k_f;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+3] += dqdc[k];
-            J[39*k+6] += dqdc[k];
-            J[39*k+36] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] += q_nocor;
+    Jmix[6] += q_nocor;
+    Jmix[36] -= q_nocor;
+    /* d()/d[ch3] */
+    dqdci =  - k_r*sc[6];
+    J[120] += dqdci;              /* dwdot[ch3]/d[ch3] */
+    J[123] += dqdci;              /* dwdot[ch2o]/d[ch3] */
+    J[153] -= dqdci;              /* dwdot[ch3ch2o]/d[ch3] */
+    /* d()/d[ch2o] */
+    dqdci =  - k_r*sc[3];
+    J[237] += dqdci;              /* dwdot[ch3]/d[ch2o] */
+    J[240] += dqdci;              /* dwdot[ch2o]/d[ch2o] */
+    J[270] -= dqdci;              /* dwdot[ch3ch2o]/d[ch2o] */
+    /* d()/d[ch3ch2o] */
+    dqdci =  + k_f;
+    J[1407] += dqdci;             /* dwdot[ch3]/d[ch3ch2o] */
+    J[1410] += dqdci;             /* dwdot[ch2o]/d[ch3ch2o] */
+    J[1440] -= dqdci;             /* dwdot[ch3ch2o]/d[ch3ch2o] */
     J[1485] += dqdT; /* dwdot[ch3]/dT */
     J[1488] += dqdT; /* dwdot[ch2o]/dT */
     J[1518] -= dqdT; /* dwdot[ch3ch2o]/dT */
@@ -21412,12 +20671,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[35];
-    k_f = prefactor_units[31] * fwd_A[31]
-                * exp(fwd_beta[31] * tc[0] - activation_units[31] * fwd_Ea[31] * invT);
+    k_f = k_f_s[31];
     dlnkfdT = fwd_beta[31] * invT + activation_units[31] * fwd_Ea[31] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[32];
-    Kc = refC * exp(-g_RT[1] - g_RT[32] + g_RT[35]);
+    Kc = Kc_s[31];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[35]) + (h_RT[1] + h_RT[32]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21432,68 +20690,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[h] */
-        dqdci =  - k_r*sc[32];
-        J[40] += dqdci;               /* dwdot[h]/d[h] */
-        J[71] += dqdci;               /* dwdot[ch3hco]/d[h] */
-        J[74] -= dqdci;               /* dwdot[ch3choh]/d[h] */
-        /* d()/d[ch3hco] */
-        dqdci =  - k_r*sc[1];
-        J[1249] += dqdci;             /* dwdot[h]/d[ch3hco] */
-        J[1280] += dqdci;             /* dwdot[ch3hco]/d[ch3hco] */
-        J[1283] -= dqdci;             /* dwdot[ch3choh]/d[ch3hco] */
-        /* d()/d[ch3choh] */
-        dqdci =  + k_f;
-        J[1366] += dqdci;             /* dwdot[h]/d[ch3choh] */
-        J[1397] += dqdci;             /* dwdot[ch3hco]/d[ch3choh] */
-        J[1400] -= dqdci;             /* dwdot[ch3choh]/d[ch3choh] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac - k_r*sc[32];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac - k_r*sc[1];
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac + k_f;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+1] += dqdc[k];
-            J[39*k+32] += dqdc[k];
-            J[39*k+35] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] += q_nocor;
+    Jmix[32] += q_nocor;
+    Jmix[35] -= q_nocor;
+    /* d()/d[h] */
+    dqdci =  - k_r*sc[32];
+    J[40] += dqdci;               /* dwdot[h]/d[h] */
+    J[71] += dqdci;               /* dwdot[ch3hco]/d[h] */
+    J[74] -= dqdci;               /* dwdot[ch3choh]/d[h] */
+    /* d()/d[ch3hco] */
+    dqdci =  - k_r*sc[1];
+    J[1249] += dqdci;             /* dwdot[h]/d[ch3hco] */
+    J[1280] += dqdci;             /* dwdot[ch3hco]/d[ch3hco] */
+    J[1283] -= dqdci;             /* dwdot[ch3choh]/d[ch3hco] */
+    /* d()/d[ch3choh] */
+    dqdci =  + k_f;
+    J[1366] += dqdci;             /* dwdot[h]/d[ch3choh] */
+    J[1397] += dqdci;             /* dwdot[ch3hco]/d[ch3choh] */
+    J[1400] -= dqdci;             /* dwdot[ch3choh]/d[ch3choh] */
     J[1483] += dqdT; /* dwdot[h]/dT */
     J[1514] += dqdT; /* dwdot[ch3hco]/dT */
     J[1517] -= dqdT; /* dwdot[ch3choh]/dT */
@@ -21504,12 +20719,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[18];
-    k_f = prefactor_units[32] * fwd_A[32]
-                * exp(fwd_beta[32] * tc[0] - activation_units[32] * fwd_Ea[32] * invT);
+    k_f = k_f_s[32];
     dlnkfdT = fwd_beta[32] * invT + activation_units[32] * fwd_Ea[32] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[16];
-    Kc = refC * exp(-g_RT[1] - g_RT[16] + g_RT[18]);
+    Kc = Kc_s[32];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[18]) + (h_RT[1] + h_RT[16]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21524,68 +20738,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[h] */
-        dqdci =  - k_r*sc[16];
-        J[40] += dqdci;               /* dwdot[h]/d[h] */
-        J[55] += dqdci;               /* dwdot[c2h]/d[h] */
-        J[57] -= dqdci;               /* dwdot[c2h2]/d[h] */
-        /* d()/d[c2h] */
-        dqdci =  - k_r*sc[1];
-        J[625] += dqdci;              /* dwdot[h]/d[c2h] */
-        J[640] += dqdci;              /* dwdot[c2h]/d[c2h] */
-        J[642] -= dqdci;              /* dwdot[c2h2]/d[c2h] */
-        /* d()/d[c2h2] */
-        dqdci =  + k_f;
-        J[703] += dqdci;              /* dwdot[h]/d[c2h2] */
-        J[718] += dqdci;              /* dwdot[c2h]/d[c2h2] */
-        J[720] -= dqdci;              /* dwdot[c2h2]/d[c2h2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac - k_r*sc[16];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac - k_r*sc[1];
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac + k_f;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        for (int k=0; k<38; k++) {
-            J[39*k+1] += dqdc[k];
-            J[39*k+16] += dqdc[k];
-            J[39*k+18] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] += q_nocor;
+    Jmix[16] += q_nocor;
+    Jmix[18] -= q_nocor;
+    /* d()/d[h] */
+    dqdci =  - k_r*sc[16];
+    J[40] += dqdci;               /* dwdot[h]/d[h] */
+    J[55] += dqdci;               /* dwdot[c2h]/d[h] */
+    J[57] -= dqdci;               /* dwdot[c2h2]/d[h] */
+    /* d()/d[c2h] */
+    dqdci =  - k_r*sc[1];
+    J[625] += dqdci;              /* dwdot[h]/d[c2h] */
+    J[640] += dqdci;              /* dwdot[c2h]/d[c2h] */
+    J[642] -= dqdci;              /* dwdot[c2h2]/d[c2h] */
+    /* d()/d[c2h2] */
+    dqdci =  + k_f;
+    J[703] += dqdci;              /* dwdot[h]/d[c2h2] */
+    J[718] += dqdci;              /* dwdot[c2h]/d[c2h2] */
+    J[720] -= dqdci;              /* dwdot[c2h2]/d[c2h2] */
     J[1483] += dqdT; /* dwdot[h]/dT */
     J[1498] += dqdT; /* dwdot[c2h]/dT */
     J[1500] -= dqdT; /* dwdot[c2h2]/dT */
@@ -21594,12 +20765,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[12];
-    k_f = prefactor_units[33] * fwd_A[33]
-                * exp(fwd_beta[33] * tc[0] - activation_units[33] * fwd_Ea[33] * invT);
+    k_f = k_f_s[33];
     dlnkfdT = fwd_beta[33] * invT + activation_units[33] * fwd_Ea[33] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[15];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[12] - g_RT[15]);
+    Kc = Kc_s[33];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[12]) + (h_RT[1] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21645,12 +20815,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[12];
-    k_f = prefactor_units[34] * fwd_A[34]
-                * exp(fwd_beta[34] * tc[0] - activation_units[34] * fwd_Ea[34] * invT);
+    k_f = k_f_s[34];
     dlnkfdT = fwd_beta[34] * invT + activation_units[34] * fwd_Ea[34] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[10];
-    Kc = exp(-g_RT[1] - g_RT[10] + g_RT[11] + g_RT[12]);
+    Kc = Kc_s[34];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[12]) + (h_RT[1] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21696,12 +20865,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[11];
-    k_f = prefactor_units[35] * fwd_A[35]
-                * exp(fwd_beta[35] * tc[0] - activation_units[35] * fwd_Ea[35] * invT);
+    k_f = k_f_s[35];
     dlnkfdT = fwd_beta[35] * invT + activation_units[35] * fwd_Ea[35] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[12];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[11] - g_RT[12]);
+    Kc = Kc_s[35];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[11]) + (h_RT[1] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21747,12 +20915,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[13];
-    k_f = prefactor_units[36] * fwd_A[36]
-                * exp(fwd_beta[36] * tc[0] - activation_units[36] * fwd_Ea[36] * invT);
+    k_f = k_f_s[36];
     dlnkfdT = fwd_beta[36] * invT + activation_units[36] * fwd_Ea[36] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[15];
-    Kc = exp(-g_RT[10] + g_RT[12] + g_RT[13] - g_RT[15]);
+    Kc = Kc_s[36];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[13]) + (h_RT[10] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21798,12 +20965,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[13];
-    k_f = prefactor_units[37] * fwd_A[37]
-                * exp(fwd_beta[37] * tc[0] - activation_units[37] * fwd_Ea[37] * invT);
+    k_f = k_f_s[37];
     dlnkfdT = fwd_beta[37] * invT + activation_units[37] * fwd_Ea[37] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[15];
-    Kc = exp(-g_RT[10] + g_RT[12] + g_RT[13] - g_RT[15]);
+    Kc = Kc_s[37];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[13]) + (h_RT[10] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21849,12 +21015,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[13];
-    k_f = prefactor_units[38] * fwd_A[38]
-                * exp(fwd_beta[38] * tc[0] - activation_units[38] * fwd_Ea[38] * invT);
+    k_f = k_f_s[38];
     dlnkfdT = fwd_beta[38] * invT + activation_units[38] * fwd_Ea[38] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[12];
-    Kc = exp(g_RT[1] - g_RT[12] - g_RT[12] + g_RT[13]);
+    Kc = Kc_s[38];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[13]) + (2*h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21889,12 +21054,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[13];
-    k_f = prefactor_units[39] * fwd_A[39]
-                * exp(fwd_beta[39] * tc[0] - activation_units[39] * fwd_Ea[39] * invT);
+    k_f = k_f_s[39];
     dlnkfdT = fwd_beta[39] * invT + activation_units[39] * fwd_Ea[39] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[10];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[10] + g_RT[13]);
+    Kc = Kc_s[39];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[13]) + (h_RT[0] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21940,12 +21104,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[13];
-    k_f = prefactor_units[40] * fwd_A[40]
-                * exp(fwd_beta[40] * tc[0] - activation_units[40] * fwd_Ea[40] * invT);
+    k_f = k_f_s[40];
     dlnkfdT = fwd_beta[40] * invT + activation_units[40] * fwd_Ea[40] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[15];
-    Kc = exp(g_RT[1] - g_RT[11] + g_RT[13] - g_RT[15]);
+    Kc = Kc_s[40];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[13]) + (h_RT[11] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21991,12 +21154,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[13];
-    k_f = prefactor_units[41] * fwd_A[41]
-                * exp(fwd_beta[41] * tc[0] - activation_units[41] * fwd_Ea[41] * invT);
+    k_f = k_f_s[41];
     dlnkfdT = fwd_beta[41] * invT + activation_units[41] * fwd_Ea[41] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[12];
-    Kc = exp(-g_RT[10] + g_RT[11] - g_RT[12] + g_RT[13]);
+    Kc = Kc_s[41];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[13]) + (h_RT[10] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22042,12 +21204,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[12];
-    k_f = prefactor_units[42] * fwd_A[42]
-                * exp(fwd_beta[42] * tc[0] - activation_units[42] * fwd_Ea[42] * invT);
+    k_f = k_f_s[42];
     dlnkfdT = fwd_beta[42] * invT + activation_units[42] * fwd_Ea[42] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[15];
-    Kc = exp(-g_RT[11] + g_RT[12] + g_RT[12] - g_RT[15]);
+    Kc = Kc_s[42];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[12]) + (h_RT[11] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22082,12 +21243,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[1]*sc[1];
-    k_f = prefactor_units[43] * fwd_A[43]
-                * exp(fwd_beta[43] * tc[0] - activation_units[43] * fwd_Ea[43] * invT);
+    k_f = k_f_s[43];
     dlnkfdT = fwd_beta[43] * invT + activation_units[43] * fwd_Ea[43] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[0];
-    Kc = refCinv * exp(g_RT[0] - g_RT[0] - g_RT[0] + g_RT[1] + g_RT[1]);
+    Kc = Kc_s[43];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + 2*h_RT[1]) + (2*h_RT[0]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22113,12 +21273,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[1]*sc[15];
-    k_f = prefactor_units[44] * fwd_A[44]
-                * exp(fwd_beta[44] * tc[0] - activation_units[44] * fwd_Ea[44] * invT);
+    k_f = k_f_s[44];
     dlnkfdT = fwd_beta[44] * invT + activation_units[44] * fwd_Ea[44] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[15];
-    Kc = refCinv * exp(-g_RT[0] + g_RT[1] + g_RT[1] + g_RT[15] - g_RT[15]);
+    Kc = Kc_s[44];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[1] + h_RT[15]) + (h_RT[0] + h_RT[15]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22148,12 +21307,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[13];
-    k_f = prefactor_units[45] * fwd_A[45]
-                * exp(fwd_beta[45] * tc[0] - activation_units[45] * fwd_Ea[45] * invT);
+    k_f = k_f_s[45];
     dlnkfdT = fwd_beta[45] * invT + activation_units[45] * fwd_Ea[45] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[14];
-    Kc = exp(-g_RT[10] + g_RT[13] + g_RT[13] - g_RT[14]);
+    Kc = Kc_s[45];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[13]) + (h_RT[10] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22188,12 +21346,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[13];
-    k_f = prefactor_units[46] * fwd_A[46]
-                * exp(fwd_beta[46] * tc[0] - activation_units[46] * fwd_Ea[46] * invT);
+    k_f = k_f_s[46];
     dlnkfdT = fwd_beta[46] * invT + activation_units[46] * fwd_Ea[46] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[14];
-    Kc = exp(-g_RT[10] + g_RT[13] + g_RT[13] - g_RT[14]);
+    Kc = Kc_s[46];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[13]) + (h_RT[10] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22228,12 +21385,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[14];
-    k_f = prefactor_units[47] * fwd_A[47]
-                * exp(fwd_beta[47] * tc[0] - activation_units[47] * fwd_Ea[47] * invT);
+    k_f = k_f_s[47];
     dlnkfdT = fwd_beta[47] * invT + activation_units[47] * fwd_Ea[47] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[13];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[13] + g_RT[14]);
+    Kc = Kc_s[47];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[14]) + (h_RT[0] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22279,12 +21435,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[14];
-    k_f = prefactor_units[48] * fwd_A[48]
-                * exp(fwd_beta[48] * tc[0] - activation_units[48] * fwd_Ea[48] * invT);
+    k_f = k_f_s[48];
     dlnkfdT = fwd_beta[48] * invT + activation_units[48] * fwd_Ea[48] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[15];
-    Kc = exp(g_RT[1] - g_RT[12] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[48];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[14]) + (h_RT[12] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22330,12 +21485,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[14];
-    k_f = prefactor_units[49] * fwd_A[49]
-                * exp(fwd_beta[49] * tc[0] - activation_units[49] * fwd_Ea[49] * invT);
+    k_f = k_f_s[49];
     dlnkfdT = fwd_beta[49] * invT + activation_units[49] * fwd_Ea[49] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[13];
-    Kc = exp(g_RT[11] - g_RT[12] - g_RT[13] + g_RT[14]);
+    Kc = Kc_s[49];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[14]) + (h_RT[12] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22381,12 +21535,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[14];
-    k_f = prefactor_units[50] * fwd_A[50]
-                * exp(fwd_beta[50] * tc[0] - activation_units[50] * fwd_Ea[50] * invT);
+    k_f = k_f_s[50];
     dlnkfdT = fwd_beta[50] * invT + activation_units[50] * fwd_Ea[50] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[15];
-    Kc = exp(g_RT[12] - g_RT[13] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[50];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[14]) + (h_RT[13] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22432,12 +21585,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[2];
-    k_f = prefactor_units[51] * fwd_A[51]
-                * exp(fwd_beta[51] * tc[0] - activation_units[51] * fwd_Ea[51] * invT);
+    k_f = k_f_s[51];
     dlnkfdT = fwd_beta[51] * invT + activation_units[51] * fwd_Ea[51] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[3];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[2] - g_RT[3]);
+    Kc = Kc_s[51];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[2]) + (h_RT[0] + h_RT[3]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22483,12 +21635,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[12];
-    k_f = prefactor_units[52] * fwd_A[52]
-                * exp(fwd_beta[52] * tc[0] - activation_units[52] * fwd_Ea[52] * invT);
+    k_f = k_f_s[52];
     dlnkfdT = fwd_beta[52] * invT + activation_units[52] * fwd_Ea[52] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[15];
-    Kc = exp(g_RT[2] - g_RT[3] + g_RT[12] - g_RT[15]);
+    Kc = Kc_s[52];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[12]) + (h_RT[3] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22534,12 +21685,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[11];
-    k_f = prefactor_units[53] * fwd_A[53]
-                * exp(fwd_beta[53] * tc[0] - activation_units[53] * fwd_Ea[53] * invT);
+    k_f = k_f_s[53];
     dlnkfdT = fwd_beta[53] * invT + activation_units[53] * fwd_Ea[53] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[12];
-    Kc = exp(g_RT[2] - g_RT[3] + g_RT[11] - g_RT[12]);
+    Kc = Kc_s[53];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[11]) + (h_RT[3] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22585,12 +21735,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[13];
-    k_f = prefactor_units[54] * fwd_A[54]
-                * exp(fwd_beta[54] * tc[0] - activation_units[54] * fwd_Ea[54] * invT);
+    k_f = k_f_s[54];
     dlnkfdT = fwd_beta[54] * invT + activation_units[54] * fwd_Ea[54] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[14];
-    Kc = exp(g_RT[2] - g_RT[3] + g_RT[13] - g_RT[14]);
+    Kc = Kc_s[54];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[13]) + (h_RT[3] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22636,12 +21785,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[13];
-    k_f = prefactor_units[55] * fwd_A[55]
-                * exp(fwd_beta[55] * tc[0] - activation_units[55] * fwd_Ea[55] * invT);
+    k_f = k_f_s[55];
     dlnkfdT = fwd_beta[55] * invT + activation_units[55] * fwd_Ea[55] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[24];
-    Kc = exp(g_RT[3] - g_RT[12] + g_RT[13] - g_RT[24]);
+    Kc = Kc_s[55];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[13]) + (h_RT[12] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22687,12 +21835,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[13];
-    k_f = prefactor_units[56] * fwd_A[56]
-                * exp(fwd_beta[56] * tc[0] - activation_units[56] * fwd_Ea[56] * invT);
+    k_f = k_f_s[56];
     dlnkfdT = fwd_beta[56] * invT + activation_units[56] * fwd_Ea[56] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[10];
-    Kc = exp(-g_RT[2] + g_RT[3] - g_RT[10] + g_RT[13]);
+    Kc = Kc_s[56];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[13]) + (h_RT[2] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22738,12 +21885,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[11];
-    k_f = prefactor_units[57] * fwd_A[57]
-                * exp(fwd_beta[57] * tc[0] - activation_units[57] * fwd_Ea[57] * invT);
+    k_f = k_f_s[57];
     dlnkfdT = fwd_beta[57] * invT + activation_units[57] * fwd_Ea[57] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[6];
-    Kc = exp(-g_RT[1] + g_RT[3] - g_RT[6] + g_RT[11]);
+    Kc = Kc_s[57];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[11]) + (h_RT[1] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22789,12 +21935,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[10];
-    k_f = prefactor_units[58] * fwd_A[58]
-                * exp(fwd_beta[58] * tc[0] - activation_units[58] * fwd_Ea[58] * invT);
+    k_f = k_f_s[58];
     dlnkfdT = fwd_beta[58] * invT + activation_units[58] * fwd_Ea[58] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[24];
-    Kc = exp(g_RT[3] + g_RT[10] - g_RT[11] - g_RT[24]);
+    Kc = Kc_s[58];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[10]) + (h_RT[11] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22840,12 +21985,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[10];
-    k_f = prefactor_units[59] * fwd_A[59]
-                * exp(fwd_beta[59] * tc[0] - activation_units[59] * fwd_Ea[59] * invT);
+    k_f = k_f_s[59];
     dlnkfdT = fwd_beta[59] * invT + activation_units[59] * fwd_Ea[59] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[12];
-    Kc = exp(g_RT[3] - g_RT[6] + g_RT[10] - g_RT[12]);
+    Kc = Kc_s[59];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[10]) + (h_RT[6] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22891,12 +22035,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[24];
-    k_f = prefactor_units[60] * fwd_A[60]
-                * exp(fwd_beta[60] * tc[0] - activation_units[60] * fwd_Ea[60] * invT);
+    k_f = k_f_s[60];
     dlnkfdT = fwd_beta[60] * invT + activation_units[60] * fwd_Ea[60] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[12];
-    Kc = exp(g_RT[1] - g_RT[3] - g_RT[12] + g_RT[24]);
+    Kc = Kc_s[60];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[24]) + (h_RT[3] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22942,12 +22085,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[23];
-    k_f = prefactor_units[61] * fwd_A[61]
-                * exp(fwd_beta[61] * tc[0] - activation_units[61] * fwd_Ea[61] * invT);
+    k_f = k_f_s[61];
     dlnkfdT = fwd_beta[61] * invT + activation_units[61] * fwd_Ea[61] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[12];
-    Kc = exp(g_RT[1] - g_RT[3] - g_RT[12] + g_RT[23]);
+    Kc = Kc_s[61];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[23]) + (h_RT[3] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22993,12 +22135,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[12];
-    k_f = prefactor_units[62] * fwd_A[62]
-                * exp(fwd_beta[62] * tc[0] - activation_units[62] * fwd_Ea[62] * invT);
+    k_f = k_f_s[62];
     dlnkfdT = fwd_beta[62] * invT + activation_units[62] * fwd_Ea[62] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[28];
-    Kc = exp(g_RT[3] + g_RT[12] - g_RT[15] - g_RT[28]);
+    Kc = Kc_s[62];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[12]) + (h_RT[15] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23044,12 +22185,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[12];
-    k_f = prefactor_units[63] * fwd_A[63]
-                * exp(fwd_beta[63] * tc[0] - activation_units[63] * fwd_Ea[63] * invT);
+    k_f = k_f_s[63];
     dlnkfdT = fwd_beta[63] * invT + activation_units[63] * fwd_Ea[63] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[15];
-    Kc = exp(g_RT[3] - g_RT[4] + g_RT[12] - g_RT[15]);
+    Kc = Kc_s[63];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[12]) + (h_RT[4] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23095,12 +22235,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3];
-    k_f = prefactor_units[64] * fwd_A[64]
-                * exp(fwd_beta[64] * tc[0] - activation_units[64] * fwd_Ea[64] * invT);
+    k_f = k_f_s[64];
     dlnkfdT = fwd_beta[64] * invT + activation_units[64] * fwd_Ea[64] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[4];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[3] - g_RT[4]);
+    Kc = Kc_s[64];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3]) + (h_RT[0] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23146,12 +22285,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[24];
-    k_f = prefactor_units[65] * fwd_A[65]
-                * exp(fwd_beta[65] * tc[0] - activation_units[65] * fwd_Ea[65] * invT);
+    k_f = k_f_s[65];
     dlnkfdT = fwd_beta[65] * invT + activation_units[65] * fwd_Ea[65] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[6];
-    Kc = exp(-g_RT[2] + g_RT[3] - g_RT[6] + g_RT[24]);
+    Kc = Kc_s[65];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[24]) + (h_RT[2] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23197,12 +22335,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[24];
-    k_f = prefactor_units[66] * fwd_A[66]
-                * exp(fwd_beta[66] * tc[0] - activation_units[66] * fwd_Ea[66] * invT);
+    k_f = k_f_s[66];
     dlnkfdT = fwd_beta[66] * invT + activation_units[66] * fwd_Ea[66] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[6];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[6] + g_RT[24]);
+    Kc = Kc_s[66];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[24]) + (h_RT[0] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23248,12 +22385,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[23];
-    k_f = prefactor_units[67] * fwd_A[67]
-                * exp(fwd_beta[67] * tc[0] - activation_units[67] * fwd_Ea[67] * invT);
+    k_f = k_f_s[67];
     dlnkfdT = fwd_beta[67] * invT + activation_units[67] * fwd_Ea[67] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[6];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[6] + g_RT[23]);
+    Kc = Kc_s[67];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[23]) + (h_RT[0] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23299,12 +22435,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[24];
-    k_f = prefactor_units[68] * fwd_A[68]
-                * exp(fwd_beta[68] * tc[0] - activation_units[68] * fwd_Ea[68] * invT);
+    k_f = k_f_s[68];
     dlnkfdT = fwd_beta[68] * invT + activation_units[68] * fwd_Ea[68] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[15];
-    Kc = exp(-g_RT[6] + g_RT[12] - g_RT[15] + g_RT[24]);
+    Kc = Kc_s[68];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[24]) + (h_RT[6] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23350,12 +22485,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[23];
-    k_f = prefactor_units[69] * fwd_A[69]
-                * exp(fwd_beta[69] * tc[0] - activation_units[69] * fwd_Ea[69] * invT);
+    k_f = k_f_s[69];
     dlnkfdT = fwd_beta[69] * invT + activation_units[69] * fwd_Ea[69] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[15];
-    Kc = exp(-g_RT[6] + g_RT[12] - g_RT[15] + g_RT[23]);
+    Kc = Kc_s[69];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[23]) + (h_RT[6] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23401,12 +22535,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[24];
-    k_f = prefactor_units[70] * fwd_A[70]
-                * exp(fwd_beta[70] * tc[0] - activation_units[70] * fwd_Ea[70] * invT);
+    k_f = k_f_s[70];
     dlnkfdT = fwd_beta[70] * invT + activation_units[70] * fwd_Ea[70] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[12];
-    Kc = exp(-g_RT[6] + g_RT[11] - g_RT[12] + g_RT[24]);
+    Kc = Kc_s[70];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[24]) + (h_RT[6] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23452,12 +22585,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[23];
-    k_f = prefactor_units[71] * fwd_A[71]
-                * exp(fwd_beta[71] * tc[0] - activation_units[71] * fwd_Ea[71] * invT);
+    k_f = k_f_s[71];
     dlnkfdT = fwd_beta[71] * invT + activation_units[71] * fwd_Ea[71] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[12];
-    Kc = exp(-g_RT[6] + g_RT[11] - g_RT[12] + g_RT[23]);
+    Kc = Kc_s[71];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[23]) + (h_RT[6] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23503,12 +22635,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[24];
-    k_f = prefactor_units[72] * fwd_A[72]
-                * exp(fwd_beta[72] * tc[0] - activation_units[72] * fwd_Ea[72] * invT);
+    k_f = k_f_s[72];
     dlnkfdT = fwd_beta[72] * invT + activation_units[72] * fwd_Ea[72] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[13];
-    Kc = exp(-g_RT[6] + g_RT[10] - g_RT[13] + g_RT[24]);
+    Kc = Kc_s[72];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[24]) + (h_RT[6] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23554,12 +22685,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[24];
-    k_f = prefactor_units[73] * fwd_A[73]
-                * exp(fwd_beta[73] * tc[0] - activation_units[73] * fwd_Ea[73] * invT);
+    k_f = k_f_s[73];
     dlnkfdT = fwd_beta[73] * invT + activation_units[73] * fwd_Ea[73] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[8];
-    Kc = exp(-g_RT[3] - g_RT[8] + g_RT[9] + g_RT[24]);
+    Kc = Kc_s[73];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[24]) + (h_RT[3] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23605,12 +22735,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[23];
-    k_f = prefactor_units[74] * fwd_A[74]
-                * exp(fwd_beta[74] * tc[0] - activation_units[74] * fwd_Ea[74] * invT);
+    k_f = k_f_s[74];
     dlnkfdT = fwd_beta[74] * invT + activation_units[74] * fwd_Ea[74] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[13];
-    Kc = exp(-g_RT[6] + g_RT[10] - g_RT[13] + g_RT[23]);
+    Kc = Kc_s[74];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[23]) + (h_RT[6] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23656,12 +22785,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[23];
-    k_f = prefactor_units[75] * fwd_A[75]
-                * exp(fwd_beta[75] * tc[0] - activation_units[75] * fwd_Ea[75] * invT);
+    k_f = k_f_s[75];
     dlnkfdT = fwd_beta[75] * invT + activation_units[75] * fwd_Ea[75] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[13];
-    Kc = exp(-g_RT[6] + g_RT[10] - g_RT[13] + g_RT[23]);
+    Kc = Kc_s[75];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[23]) + (h_RT[6] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23707,12 +22835,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[4];
-    k_f = prefactor_units[76] * fwd_A[76]
-                * exp(fwd_beta[76] * tc[0] - activation_units[76] * fwd_Ea[76] * invT);
+    k_f = k_f_s[76];
     dlnkfdT = fwd_beta[76] * invT + activation_units[76] * fwd_Ea[76] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[5];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[4] - g_RT[5]);
+    Kc = Kc_s[76];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[4]) + (h_RT[0] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23758,12 +22885,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[12];
-    k_f = prefactor_units[77] * fwd_A[77]
-                * exp(fwd_beta[77] * tc[0] - activation_units[77] * fwd_Ea[77] * invT);
+    k_f = k_f_s[77];
     dlnkfdT = fwd_beta[77] * invT + activation_units[77] * fwd_Ea[77] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[15];
-    Kc = exp(g_RT[4] - g_RT[5] + g_RT[12] - g_RT[15]);
+    Kc = Kc_s[77];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[12]) + (h_RT[5] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23809,12 +22935,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[12];
-    k_f = prefactor_units[78] * fwd_A[78]
-                * exp(fwd_beta[78] * tc[0] - activation_units[78] * fwd_Ea[78] * invT);
+    k_f = k_f_s[78];
     dlnkfdT = fwd_beta[78] * invT + activation_units[78] * fwd_Ea[78] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[6];
-    Kc = exp(-g_RT[1] + g_RT[4] - g_RT[6] + g_RT[12]);
+    Kc = Kc_s[78];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[12]) + (h_RT[1] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23860,12 +22985,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[8];
-    k_f = prefactor_units[79] * fwd_A[79]
-                * exp(fwd_beta[79] * tc[0] - activation_units[79] * fwd_Ea[79] * invT);
+    k_f = k_f_s[79];
     dlnkfdT = fwd_beta[79] * invT + activation_units[79] * fwd_Ea[79] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[9];
-    Kc = exp(g_RT[4] - g_RT[6] + g_RT[8] - g_RT[9]);
+    Kc = Kc_s[79];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[8]) + (h_RT[6] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23911,12 +23035,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[11];
-    k_f = prefactor_units[80] * fwd_A[80]
-                * exp(fwd_beta[80] * tc[0] - activation_units[80] * fwd_Ea[80] * invT);
+    k_f = k_f_s[80];
     dlnkfdT = fwd_beta[80] * invT + activation_units[80] * fwd_Ea[80] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[1]*sc[9];
-    Kc = refC * exp(-g_RT[1] - g_RT[1] + g_RT[4] - g_RT[9] + g_RT[11]);
+    Kc = Kc_s[80];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[11]) + (2*h_RT[1] + h_RT[9]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23962,12 +23085,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[11];
-    k_f = prefactor_units[81] * fwd_A[81]
-                * exp(fwd_beta[81] * tc[0] - activation_units[81] * fwd_Ea[81] * invT);
+    k_f = k_f_s[81];
     dlnkfdT = fwd_beta[81] * invT + activation_units[81] * fwd_Ea[81] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[9];
-    Kc = exp(-g_RT[0] + g_RT[4] - g_RT[9] + g_RT[11]);
+    Kc = Kc_s[81];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[11]) + (h_RT[0] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24013,12 +23135,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[10];
-    k_f = prefactor_units[82] * fwd_A[82]
-                * exp(fwd_beta[82] * tc[0] - activation_units[82] * fwd_Ea[82] * invT);
+    k_f = k_f_s[82];
     dlnkfdT = fwd_beta[82] * invT + activation_units[82] * fwd_Ea[82] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[11];
-    Kc = exp(g_RT[4] - g_RT[6] + g_RT[10] - g_RT[11]);
+    Kc = Kc_s[82];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[10]) + (h_RT[6] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24064,12 +23185,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[10];
-    k_f = prefactor_units[83] * fwd_A[83]
-                * exp(fwd_beta[83] * tc[0] - activation_units[83] * fwd_Ea[83] * invT);
+    k_f = k_f_s[83];
     dlnkfdT = fwd_beta[83] * invT + activation_units[83] * fwd_Ea[83] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[1]*sc[8];
-    Kc = refC * exp(-g_RT[1] - g_RT[1] + g_RT[4] - g_RT[8] + g_RT[10]);
+    Kc = Kc_s[83];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[10]) + (2*h_RT[1] + h_RT[8]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24115,12 +23235,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[10];
-    k_f = prefactor_units[84] * fwd_A[84]
-                * exp(fwd_beta[84] * tc[0] - activation_units[84] * fwd_Ea[84] * invT);
+    k_f = k_f_s[84];
     dlnkfdT = fwd_beta[84] * invT + activation_units[84] * fwd_Ea[84] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[8];
-    Kc = exp(-g_RT[0] + g_RT[4] - g_RT[8] + g_RT[10]);
+    Kc = Kc_s[84];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[10]) + (h_RT[0] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24166,12 +23285,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[10];
-    k_f = prefactor_units[85] * fwd_A[85]
-                * exp(fwd_beta[85] * tc[0] - activation_units[85] * fwd_Ea[85] * invT);
+    k_f = k_f_s[85];
     dlnkfdT = fwd_beta[85] * invT + activation_units[85] * fwd_Ea[85] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[15];
-    Kc = exp(g_RT[4] - g_RT[9] + g_RT[10] - g_RT[15]);
+    Kc = Kc_s[85];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[10]) + (h_RT[9] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24217,12 +23335,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[10];
-    k_f = prefactor_units[86] * fwd_A[86]
-                * exp(fwd_beta[86] * tc[0] - activation_units[86] * fwd_Ea[86] * invT);
+    k_f = k_f_s[86];
     dlnkfdT = fwd_beta[86] * invT + activation_units[86] * fwd_Ea[86] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[12];
-    Kc = exp(g_RT[4] - g_RT[7] + g_RT[10] - g_RT[12]);
+    Kc = Kc_s[86];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[10]) + (h_RT[7] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24268,12 +23385,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[4];
-    k_f = prefactor_units[87] * fwd_A[87]
-                * exp(fwd_beta[87] * tc[0] - activation_units[87] * fwd_Ea[87] * invT);
+    k_f = k_f_s[87];
     dlnkfdT = fwd_beta[87] * invT + activation_units[87] * fwd_Ea[87] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[20];
-    Kc = exp(-g_RT[1] + g_RT[3] + g_RT[4] - g_RT[20]);
+    Kc = Kc_s[87];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[4]) + (h_RT[1] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24319,12 +23435,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[4];
-    k_f = prefactor_units[88] * fwd_A[88]
-                * exp(fwd_beta[88] * tc[0] - activation_units[88] * fwd_Ea[88] * invT);
+    k_f = k_f_s[88];
     dlnkfdT = fwd_beta[88] * invT + activation_units[88] * fwd_Ea[88] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[1]*sc[18];
-    Kc = refC * exp(-g_RT[1] - g_RT[1] + g_RT[4] + g_RT[4] - g_RT[18]);
+    Kc = Kc_s[88];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[4]) + (2*h_RT[1] + h_RT[18]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24359,12 +23474,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[17];
-    k_f = prefactor_units[89] * fwd_A[89]
-                * exp(fwd_beta[89] * tc[0] - activation_units[89] * fwd_Ea[89] * invT);
+    k_f = k_f_s[89];
     dlnkfdT = fwd_beta[89] * invT + activation_units[89] * fwd_Ea[89] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[19];
-    Kc = exp(g_RT[4] - g_RT[9] + g_RT[17] - g_RT[19]);
+    Kc = Kc_s[89];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[17]) + (h_RT[9] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24410,12 +23524,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[18];
-    k_f = prefactor_units[90] * fwd_A[90]
-                * exp(fwd_beta[90] * tc[0] - activation_units[90] * fwd_Ea[90] * invT);
+    k_f = k_f_s[90];
     dlnkfdT = fwd_beta[90] * invT + activation_units[90] * fwd_Ea[90] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[26];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[18] - g_RT[26]);
+    Kc = Kc_s[90];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[18]) + (h_RT[1] + h_RT[26]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24461,12 +23574,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[28];
-    k_f = prefactor_units[91] * fwd_A[91]
-                * exp(fwd_beta[91] * tc[0] - activation_units[91] * fwd_Ea[91] * invT);
+    k_f = k_f_s[91];
     dlnkfdT = fwd_beta[91] * invT + activation_units[91] * fwd_Ea[91] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[3];
-    Kc = exp(g_RT[2] - g_RT[3] - g_RT[3] + g_RT[28]);
+    Kc = Kc_s[91];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[28]) + (2*h_RT[3]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24501,12 +23613,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[22]*sc[28];
-    k_f = prefactor_units[92] * fwd_A[92]
-                * exp(fwd_beta[92] * tc[0] - activation_units[92] * fwd_Ea[92] * invT);
+    k_f = k_f_s[92];
     dlnkfdT = fwd_beta[92] * invT + activation_units[92] * fwd_Ea[92] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[21];
-    Kc = exp(-g_RT[3] - g_RT[21] + g_RT[22] + g_RT[28]);
+    Kc = Kc_s[92];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[22] + h_RT[28]) + (h_RT[3] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24552,12 +23663,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[28];
-    k_f = prefactor_units[93] * fwd_A[93]
-                * exp(fwd_beta[93] * tc[0] - activation_units[93] * fwd_Ea[93] * invT);
+    k_f = k_f_s[93];
     dlnkfdT = fwd_beta[93] * invT + activation_units[93] * fwd_Ea[93] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[9]*sc[12];
-    Kc = refC * exp(-g_RT[1] - g_RT[9] + g_RT[10] - g_RT[12] + g_RT[28]);
+    Kc = Kc_s[93];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[28]) + (h_RT[1] + h_RT[9] + h_RT[12]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24616,12 +23726,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[28];
-    k_f = prefactor_units[94] * fwd_A[94]
-                * exp(fwd_beta[94] * tc[0] - activation_units[94] * fwd_Ea[94] * invT);
+    k_f = k_f_s[94];
     dlnkfdT = fwd_beta[94] * invT + activation_units[94] * fwd_Ea[94] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[3];
-    Kc = exp(g_RT[0] - g_RT[1] - g_RT[3] + g_RT[28]);
+    Kc = Kc_s[94];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[28]) + (h_RT[1] + h_RT[3]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24667,12 +23776,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[18]*sc[28];
-    k_f = prefactor_units[95] * fwd_A[95]
-                * exp(fwd_beta[95] * tc[0] - activation_units[95] * fwd_Ea[95] * invT);
+    k_f = k_f_s[95];
     dlnkfdT = fwd_beta[95] * invT + activation_units[95] * fwd_Ea[95] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[26];
-    Kc = exp(-g_RT[1] + g_RT[18] - g_RT[26] + g_RT[28]);
+    Kc = Kc_s[95];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[18] + h_RT[28]) + (h_RT[1] + h_RT[26]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24718,12 +23826,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[28];
-    k_f = prefactor_units[96] * fwd_A[96]
-                * exp(fwd_beta[96] * tc[0] - activation_units[96] * fwd_Ea[96] * invT);
+    k_f = k_f_s[96];
     dlnkfdT = fwd_beta[96] * invT + activation_units[96] * fwd_Ea[96] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[1]*sc[9];
-    Kc = refC * exp(-g_RT[1] - g_RT[1] - g_RT[9] + g_RT[11] + g_RT[28]);
+    Kc = Kc_s[96];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[28]) + (2*h_RT[1] + h_RT[9]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24769,12 +23876,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[28];
-    k_f = prefactor_units[97] * fwd_A[97]
-                * exp(fwd_beta[97] * tc[0] - activation_units[97] * fwd_Ea[97] * invT);
+    k_f = k_f_s[97];
     dlnkfdT = fwd_beta[97] * invT + activation_units[97] * fwd_Ea[97] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[6];
-    Kc = exp(-g_RT[1] - g_RT[6] + g_RT[12] + g_RT[28]);
+    Kc = Kc_s[97];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[28]) + (h_RT[1] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24820,12 +23926,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[28];
-    k_f = prefactor_units[98] * fwd_A[98]
-                * exp(fwd_beta[98] * tc[0] - activation_units[98] * fwd_Ea[98] * invT);
+    k_f = k_f_s[98];
     dlnkfdT = fwd_beta[98] * invT + activation_units[98] * fwd_Ea[98] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[5];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[5] + g_RT[28]);
+    Kc = Kc_s[98];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[28]) + (h_RT[0] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24871,12 +23976,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[28];
-    k_f = prefactor_units[99] * fwd_A[99]
-                * exp(fwd_beta[99] * tc[0] - activation_units[99] * fwd_Ea[99] * invT);
+    k_f = k_f_s[99];
     dlnkfdT = fwd_beta[99] * invT + activation_units[99] * fwd_Ea[99] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[9];
-    Kc = exp(-g_RT[6] + g_RT[8] - g_RT[9] + g_RT[28]);
+    Kc = Kc_s[99];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[28]) + (h_RT[6] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24922,12 +24026,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[28];
-    k_f = prefactor_units[100] * fwd_A[100]
-                * exp(fwd_beta[100] * tc[0] - activation_units[100] * fwd_Ea[100] * invT);
+    k_f = k_f_s[100];
     dlnkfdT = fwd_beta[100] * invT + activation_units[100] * fwd_Ea[100] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[20];
-    Kc = exp(-g_RT[1] + g_RT[3] - g_RT[20] + g_RT[28]);
+    Kc = Kc_s[100];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[28]) + (h_RT[1] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24973,12 +24076,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[28]*sc[29];
-    k_f = prefactor_units[101] * fwd_A[101]
-                * exp(fwd_beta[101] * tc[0] - activation_units[101] * fwd_Ea[101] * invT);
+    k_f = k_f_s[101];
     dlnkfdT = fwd_beta[101] * invT + activation_units[101] * fwd_Ea[101] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[20];
-    Kc = exp(-g_RT[9] - g_RT[20] + g_RT[28] + g_RT[29]);
+    Kc = Kc_s[101];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[28] + h_RT[29]) + (h_RT[9] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25024,12 +24126,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[10];
-    k_f = prefactor_units[102] * fwd_A[102]
-                * exp(fwd_beta[102] * tc[0] - activation_units[102] * fwd_Ea[102] * invT);
+    k_f = k_f_s[102];
     dlnkfdT = fwd_beta[102] * invT + activation_units[102] * fwd_Ea[102] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[11];
-    Kc = exp(g_RT[5] - g_RT[7] + g_RT[10] - g_RT[11]);
+    Kc = Kc_s[102];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[10]) + (h_RT[7] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25075,12 +24176,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[11];
-    k_f = prefactor_units[103] * fwd_A[103]
-                * exp(fwd_beta[103] * tc[0] - activation_units[103] * fwd_Ea[103] * invT);
+    k_f = k_f_s[103];
     dlnkfdT = fwd_beta[103] * invT + activation_units[103] * fwd_Ea[103] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[9];
-    Kc = exp(-g_RT[1] + g_RT[5] - g_RT[9] + g_RT[11]);
+    Kc = Kc_s[103];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[11]) + (h_RT[1] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25126,12 +24226,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[12];
-    k_f = prefactor_units[104] * fwd_A[104]
-                * exp(fwd_beta[104] * tc[0] - activation_units[104] * fwd_Ea[104] * invT);
+    k_f = k_f_s[104];
     dlnkfdT = fwd_beta[104] * invT + activation_units[104] * fwd_Ea[104] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[7];
-    Kc = exp(-g_RT[1] + g_RT[5] - g_RT[7] + g_RT[12]);
+    Kc = Kc_s[104];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[12]) + (h_RT[1] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25177,12 +24276,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[8];
-    k_f = prefactor_units[105] * fwd_A[105]
-                * exp(fwd_beta[105] * tc[0] - activation_units[105] * fwd_Ea[105] * invT);
+    k_f = k_f_s[105];
     dlnkfdT = fwd_beta[105] * invT + activation_units[105] * fwd_Ea[105] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[9];
-    Kc = exp(g_RT[5] - g_RT[7] + g_RT[8] - g_RT[9]);
+    Kc = Kc_s[105];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[8]) + (h_RT[7] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25228,12 +24326,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[15];
-    k_f = prefactor_units[106] * fwd_A[106]
-                * exp(fwd_beta[106] * tc[0] - activation_units[106] * fwd_Ea[106] * invT);
+    k_f = k_f_s[106];
     dlnkfdT = fwd_beta[106] * invT + activation_units[106] * fwd_Ea[106] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[6];
-    Kc = exp(-g_RT[1] + g_RT[5] - g_RT[6] + g_RT[15]);
+    Kc = Kc_s[106];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[15]) + (h_RT[1] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25279,12 +24376,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[6];
-    k_f = prefactor_units[107] * fwd_A[107]
-                * exp(fwd_beta[107] * tc[0] - activation_units[107] * fwd_Ea[107] * invT);
+    k_f = k_f_s[107];
     dlnkfdT = fwd_beta[107] * invT + activation_units[107] * fwd_Ea[107] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[29];
-    Kc = exp(-g_RT[1] + g_RT[5] + g_RT[6] - g_RT[29]);
+    Kc = Kc_s[107];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[6]) + (h_RT[1] + h_RT[29]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25330,12 +24426,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[18];
-    k_f = prefactor_units[108] * fwd_A[108]
-                * exp(fwd_beta[108] * tc[0] - activation_units[108] * fwd_Ea[108] * invT);
+    k_f = k_f_s[108];
     dlnkfdT = fwd_beta[108] * invT + activation_units[108] * fwd_Ea[108] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[27];
-    Kc = exp(-g_RT[1] + g_RT[5] + g_RT[18] - g_RT[27]);
+    Kc = Kc_s[108];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[18]) + (h_RT[1] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25381,12 +24476,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[5];
-    k_f = prefactor_units[109] * fwd_A[109]
-                * exp(fwd_beta[109] * tc[0] - activation_units[109] * fwd_Ea[109] * invT);
+    k_f = k_f_s[109];
     dlnkfdT = fwd_beta[109] * invT + activation_units[109] * fwd_Ea[109] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[18];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[5] - g_RT[18]);
+    Kc = Kc_s[109];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[5]) + (h_RT[1] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25432,12 +24526,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[5];
-    k_f = prefactor_units[110] * fwd_A[110]
-                * exp(fwd_beta[110] * tc[0] - activation_units[110] * fwd_Ea[110] * invT);
+    k_f = k_f_s[110];
     dlnkfdT = fwd_beta[110] * invT + activation_units[110] * fwd_Ea[110] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[19];
-    Kc = exp(-g_RT[1] + g_RT[3] + g_RT[5] - g_RT[19]);
+    Kc = Kc_s[110];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[5]) + (h_RT[1] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25483,12 +24576,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[5];
-    k_f = prefactor_units[111] * fwd_A[111]
-                * exp(fwd_beta[111] * tc[0] - activation_units[111] * fwd_Ea[111] * invT);
+    k_f = k_f_s[111];
     dlnkfdT = fwd_beta[111] * invT + activation_units[111] * fwd_Ea[111] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[20];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[5] - g_RT[20]);
+    Kc = Kc_s[111];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[5]) + (h_RT[1] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25534,12 +24626,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[12];
-    k_f = prefactor_units[112] * fwd_A[112]
-                * exp(fwd_beta[112] * tc[0] - activation_units[112] * fwd_Ea[112] * invT);
+    k_f = k_f_s[112];
     dlnkfdT = fwd_beta[112] * invT + activation_units[112] * fwd_Ea[112] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[15];
-    Kc = exp(g_RT[6] - g_RT[7] + g_RT[12] - g_RT[15]);
+    Kc = Kc_s[112];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[12]) + (h_RT[7] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25585,12 +24676,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[6];
-    k_f = prefactor_units[113] * fwd_A[113]
-                * exp(fwd_beta[113] * tc[0] - activation_units[113] * fwd_Ea[113] * invT);
+    k_f = k_f_s[113];
     dlnkfdT = fwd_beta[113] * invT + activation_units[113] * fwd_Ea[113] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[7];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[6] - g_RT[7]);
+    Kc = Kc_s[113];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[6]) + (h_RT[0] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25636,12 +24726,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[11];
-    k_f = prefactor_units[114] * fwd_A[114]
-                * exp(fwd_beta[114] * tc[0] - activation_units[114] * fwd_Ea[114] * invT);
+    k_f = k_f_s[114];
     dlnkfdT = fwd_beta[114] * invT + activation_units[114] * fwd_Ea[114] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[12];
-    Kc = exp(g_RT[6] - g_RT[7] + g_RT[11] - g_RT[12]);
+    Kc = Kc_s[114];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[11]) + (h_RT[7] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25687,12 +24776,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[10];
-    k_f = prefactor_units[115] * fwd_A[115]
-                * exp(fwd_beta[115] * tc[0] - activation_units[115] * fwd_Ea[115] * invT);
+    k_f = k_f_s[115];
     dlnkfdT = fwd_beta[115] * invT + activation_units[115] * fwd_Ea[115] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[13];
-    Kc = exp(g_RT[7] - g_RT[9] + g_RT[10] - g_RT[13]);
+    Kc = Kc_s[115];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[10]) + (h_RT[9] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25738,12 +24826,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[12];
-    k_f = prefactor_units[116] * fwd_A[116]
-                * exp(fwd_beta[116] * tc[0] - activation_units[116] * fwd_Ea[116] * invT);
+    k_f = k_f_s[116];
     dlnkfdT = fwd_beta[116] * invT + activation_units[116] * fwd_Ea[116] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[15];
-    Kc = exp(g_RT[7] - g_RT[9] + g_RT[12] - g_RT[15]);
+    Kc = Kc_s[116];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[12]) + (h_RT[9] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25789,12 +24876,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[7];
-    k_f = prefactor_units[117] * fwd_A[117]
-                * exp(fwd_beta[117] * tc[0] - activation_units[117] * fwd_Ea[117] * invT);
+    k_f = k_f_s[117];
     dlnkfdT = fwd_beta[117] * invT + activation_units[117] * fwd_Ea[117] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[9];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[7] - g_RT[9]);
+    Kc = Kc_s[117];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[7]) + (h_RT[0] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25840,12 +24926,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[11];
-    k_f = prefactor_units[118] * fwd_A[118]
-                * exp(fwd_beta[118] * tc[0] - activation_units[118] * fwd_Ea[118] * invT);
+    k_f = k_f_s[118];
     dlnkfdT = fwd_beta[118] * invT + activation_units[118] * fwd_Ea[118] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[12];
-    Kc = exp(g_RT[7] - g_RT[9] + g_RT[11] - g_RT[12]);
+    Kc = Kc_s[118];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[11]) + (h_RT[9] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25891,12 +24976,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[11];
-    k_f = prefactor_units[119] * fwd_A[119]
-                * exp(fwd_beta[119] * tc[0] - activation_units[119] * fwd_Ea[119] * invT);
+    k_f = k_f_s[119];
     dlnkfdT = fwd_beta[119] * invT + activation_units[119] * fwd_Ea[119] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[8];
-    Kc = exp(-g_RT[1] + g_RT[7] - g_RT[8] + g_RT[11]);
+    Kc = Kc_s[119];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[11]) + (h_RT[1] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25942,12 +25026,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[12];
-    k_f = prefactor_units[120] * fwd_A[120]
-                * exp(fwd_beta[120] * tc[0] - activation_units[120] * fwd_Ea[120] * invT);
+    k_f = k_f_s[120];
     dlnkfdT = fwd_beta[120] * invT + activation_units[120] * fwd_Ea[120] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[8];
-    Kc = exp(-g_RT[1] - g_RT[8] + g_RT[9] + g_RT[12]);
+    Kc = Kc_s[120];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[12]) + (h_RT[1] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25993,12 +25076,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[10];
-    k_f = prefactor_units[121] * fwd_A[121]
-                * exp(fwd_beta[121] * tc[0] - activation_units[121] * fwd_Ea[121] * invT);
+    k_f = k_f_s[121];
     dlnkfdT = fwd_beta[121] * invT + activation_units[121] * fwd_Ea[121] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[11];
-    Kc = exp(-g_RT[8] + g_RT[9] + g_RT[10] - g_RT[11]);
+    Kc = Kc_s[121];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[10]) + (h_RT[8] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26044,12 +25126,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[13];
-    k_f = prefactor_units[122] * fwd_A[122]
-                * exp(fwd_beta[122] * tc[0] - activation_units[122] * fwd_Ea[122] * invT);
+    k_f = k_f_s[122];
     dlnkfdT = fwd_beta[122] * invT + activation_units[122] * fwd_Ea[122] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[12];
-    Kc = exp(-g_RT[8] + g_RT[9] - g_RT[12] + g_RT[13]);
+    Kc = Kc_s[122];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[13]) + (h_RT[8] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26095,12 +25176,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[33];
-    k_f = prefactor_units[123] * fwd_A[123]
-                * exp(fwd_beta[123] * tc[0] - activation_units[123] * fwd_Ea[123] * invT);
+    k_f = k_f_s[123];
     dlnkfdT = fwd_beta[123] * invT + activation_units[123] * fwd_Ea[123] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[34];
-    Kc = exp(g_RT[12] - g_RT[15] + g_RT[33] - g_RT[34]);
+    Kc = Kc_s[123];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[33]) + (h_RT[15] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26146,12 +25226,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[33];
-    k_f = prefactor_units[124] * fwd_A[124]
-                * exp(fwd_beta[124] * tc[0] - activation_units[124] * fwd_Ea[124] * invT);
+    k_f = k_f_s[124];
     dlnkfdT = fwd_beta[124] * invT + activation_units[124] * fwd_Ea[124] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[35];
-    Kc = exp(g_RT[12] - g_RT[15] + g_RT[33] - g_RT[35]);
+    Kc = Kc_s[124];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[33]) + (h_RT[15] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26197,12 +25276,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[33];
-    k_f = prefactor_units[125] * fwd_A[125]
-                * exp(fwd_beta[125] * tc[0] - activation_units[125] * fwd_Ea[125] * invT);
+    k_f = k_f_s[125];
     dlnkfdT = fwd_beta[125] * invT + activation_units[125] * fwd_Ea[125] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[36];
-    Kc = exp(g_RT[12] - g_RT[15] + g_RT[33] - g_RT[36]);
+    Kc = Kc_s[125];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[33]) + (h_RT[15] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26248,12 +25326,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[33];
-    k_f = prefactor_units[126] * fwd_A[126]
-                * exp(fwd_beta[126] * tc[0] - activation_units[126] * fwd_Ea[126] * invT);
+    k_f = k_f_s[126];
     dlnkfdT = fwd_beta[126] * invT + activation_units[126] * fwd_Ea[126] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[34];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[33] - g_RT[34]);
+    Kc = Kc_s[126];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[33]) + (h_RT[0] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26299,12 +25376,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[33];
-    k_f = prefactor_units[127] * fwd_A[127]
-                * exp(fwd_beta[127] * tc[0] - activation_units[127] * fwd_Ea[127] * invT);
+    k_f = k_f_s[127];
     dlnkfdT = fwd_beta[127] * invT + activation_units[127] * fwd_Ea[127] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[35];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[33] - g_RT[35]);
+    Kc = Kc_s[127];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[33]) + (h_RT[0] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26350,12 +25426,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[33];
-    k_f = prefactor_units[128] * fwd_A[128]
-                * exp(fwd_beta[128] * tc[0] - activation_units[128] * fwd_Ea[128] * invT);
+    k_f = k_f_s[128];
     dlnkfdT = fwd_beta[128] * invT + activation_units[128] * fwd_Ea[128] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[36];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[33] - g_RT[36]);
+    Kc = Kc_s[128];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[33]) + (h_RT[0] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26401,12 +25476,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[33];
-    k_f = prefactor_units[129] * fwd_A[129]
-                * exp(fwd_beta[129] * tc[0] - activation_units[129] * fwd_Ea[129] * invT);
+    k_f = k_f_s[129];
     dlnkfdT = fwd_beta[129] * invT + activation_units[129] * fwd_Ea[129] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[34];
-    Kc = exp(g_RT[11] - g_RT[12] + g_RT[33] - g_RT[34]);
+    Kc = Kc_s[129];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[33]) + (h_RT[12] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26452,12 +25526,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[33];
-    k_f = prefactor_units[130] * fwd_A[130]
-                * exp(fwd_beta[130] * tc[0] - activation_units[130] * fwd_Ea[130] * invT);
+    k_f = k_f_s[130];
     dlnkfdT = fwd_beta[130] * invT + activation_units[130] * fwd_Ea[130] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[35];
-    Kc = exp(g_RT[11] - g_RT[12] + g_RT[33] - g_RT[35]);
+    Kc = Kc_s[130];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[33]) + (h_RT[12] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26503,12 +25576,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[33];
-    k_f = prefactor_units[131] * fwd_A[131]
-                * exp(fwd_beta[131] * tc[0] - activation_units[131] * fwd_Ea[131] * invT);
+    k_f = k_f_s[131];
     dlnkfdT = fwd_beta[131] * invT + activation_units[131] * fwd_Ea[131] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[36];
-    Kc = exp(g_RT[11] - g_RT[12] + g_RT[33] - g_RT[36]);
+    Kc = Kc_s[131];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[33]) + (h_RT[12] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26554,12 +25626,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[33];
-    k_f = prefactor_units[132] * fwd_A[132]
-                * exp(fwd_beta[132] * tc[0] - activation_units[132] * fwd_Ea[132] * invT);
+    k_f = k_f_s[132];
     dlnkfdT = fwd_beta[132] * invT + activation_units[132] * fwd_Ea[132] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[34];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[33] - g_RT[34]);
+    Kc = Kc_s[132];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[33]) + (h_RT[2] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26605,12 +25676,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[33];
-    k_f = prefactor_units[133] * fwd_A[133]
-                * exp(fwd_beta[133] * tc[0] - activation_units[133] * fwd_Ea[133] * invT);
+    k_f = k_f_s[133];
     dlnkfdT = fwd_beta[133] * invT + activation_units[133] * fwd_Ea[133] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[35];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[33] - g_RT[35]);
+    Kc = Kc_s[133];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[33]) + (h_RT[2] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26656,12 +25726,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[33];
-    k_f = prefactor_units[134] * fwd_A[134]
-                * exp(fwd_beta[134] * tc[0] - activation_units[134] * fwd_Ea[134] * invT);
+    k_f = k_f_s[134];
     dlnkfdT = fwd_beta[134] * invT + activation_units[134] * fwd_Ea[134] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[36];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[33] - g_RT[36]);
+    Kc = Kc_s[134];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[33]) + (h_RT[2] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26707,12 +25776,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[33];
-    k_f = prefactor_units[135] * fwd_A[135]
-                * exp(fwd_beta[135] * tc[0] - activation_units[135] * fwd_Ea[135] * invT);
+    k_f = k_f_s[135];
     dlnkfdT = fwd_beta[135] * invT + activation_units[135] * fwd_Ea[135] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[35];
-    Kc = exp(g_RT[13] - g_RT[14] + g_RT[33] - g_RT[35]);
+    Kc = Kc_s[135];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13] + h_RT[33]) + (h_RT[14] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26758,12 +25826,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[33];
-    k_f = prefactor_units[136] * fwd_A[136]
-                * exp(fwd_beta[136] * tc[0] - activation_units[136] * fwd_Ea[136] * invT);
+    k_f = k_f_s[136];
     dlnkfdT = fwd_beta[136] * invT + activation_units[136] * fwd_Ea[136] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[34];
-    Kc = exp(g_RT[13] - g_RT[14] + g_RT[33] - g_RT[34]);
+    Kc = Kc_s[136];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13] + h_RT[33]) + (h_RT[14] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26809,12 +25876,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[33];
-    k_f = prefactor_units[137] * fwd_A[137]
-                * exp(fwd_beta[137] * tc[0] - activation_units[137] * fwd_Ea[137] * invT);
+    k_f = k_f_s[137];
     dlnkfdT = fwd_beta[137] * invT + activation_units[137] * fwd_Ea[137] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[36];
-    Kc = exp(g_RT[13] - g_RT[14] + g_RT[33] - g_RT[36]);
+    Kc = Kc_s[137];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13] + h_RT[33]) + (h_RT[14] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26860,12 +25926,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[36];
-    k_f = prefactor_units[138] * fwd_A[138]
-                * exp(fwd_beta[138] * tc[0] - activation_units[138] * fwd_Ea[138] * invT);
+    k_f = k_f_s[138];
     dlnkfdT = fwd_beta[138] * invT + activation_units[138] * fwd_Ea[138] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[32];
-    Kc = exp(g_RT[10] - g_RT[13] - g_RT[32] + g_RT[36]);
+    Kc = Kc_s[138];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[36]) + (h_RT[13] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26911,12 +25976,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[36];
-    k_f = prefactor_units[139] * fwd_A[139]
-                * exp(fwd_beta[139] * tc[0] - activation_units[139] * fwd_Ea[139] * invT);
+    k_f = k_f_s[139];
     dlnkfdT = fwd_beta[139] * invT + activation_units[139] * fwd_Ea[139] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[21];
-    Kc = exp(-g_RT[8] + g_RT[9] - g_RT[21] + g_RT[36]);
+    Kc = Kc_s[139];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[36]) + (h_RT[8] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26962,12 +26026,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[36];
-    k_f = prefactor_units[140] * fwd_A[140]
-                * exp(fwd_beta[140] * tc[0] - activation_units[140] * fwd_Ea[140] * invT);
+    k_f = k_f_s[140];
     dlnkfdT = fwd_beta[140] * invT + activation_units[140] * fwd_Ea[140] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[23];
-    Kc = exp(g_RT[1] - g_RT[3] - g_RT[23] + g_RT[36]);
+    Kc = Kc_s[140];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[36]) + (h_RT[3] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27013,12 +26076,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[36];
-    k_f = prefactor_units[141] * fwd_A[141]
-                * exp(fwd_beta[141] * tc[0] - activation_units[141] * fwd_Ea[141] * invT);
+    k_f = k_f_s[141];
     dlnkfdT = fwd_beta[141] * invT + activation_units[141] * fwd_Ea[141] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[20];
-    Kc = exp(g_RT[1] - g_RT[15] - g_RT[20] + g_RT[36]);
+    Kc = Kc_s[141];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[36]) + (h_RT[15] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27064,12 +26126,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[36];
-    k_f = prefactor_units[142] * fwd_A[142]
-                * exp(fwd_beta[142] * tc[0] - activation_units[142] * fwd_Ea[142] * invT);
+    k_f = k_f_s[142];
     dlnkfdT = fwd_beta[142] * invT + activation_units[142] * fwd_Ea[142] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[32];
-    Kc = exp(g_RT[12] - g_RT[15] - g_RT[32] + g_RT[36]);
+    Kc = Kc_s[142];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[36]) + (h_RT[15] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27115,12 +26176,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[35];
-    k_f = prefactor_units[143] * fwd_A[143]
-                * exp(fwd_beta[143] * tc[0] - activation_units[143] * fwd_Ea[143] * invT);
+    k_f = k_f_s[143];
     dlnkfdT = fwd_beta[143] * invT + activation_units[143] * fwd_Ea[143] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[32];
-    Kc = exp(g_RT[10] - g_RT[13] - g_RT[32] + g_RT[35]);
+    Kc = Kc_s[143];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[35]) + (h_RT[13] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27166,12 +26226,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[35];
-    k_f = prefactor_units[144] * fwd_A[144]
-                * exp(fwd_beta[144] * tc[0] - activation_units[144] * fwd_Ea[144] * invT);
+    k_f = k_f_s[144];
     dlnkfdT = fwd_beta[144] * invT + activation_units[144] * fwd_Ea[144] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[32];
-    Kc = exp(g_RT[10] - g_RT[13] - g_RT[32] + g_RT[35]);
+    Kc = Kc_s[144];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[35]) + (h_RT[13] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27217,12 +26276,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[35];
-    k_f = prefactor_units[145] * fwd_A[145]
-                * exp(fwd_beta[145] * tc[0] - activation_units[145] * fwd_Ea[145] * invT);
+    k_f = k_f_s[145];
     dlnkfdT = fwd_beta[145] * invT + activation_units[145] * fwd_Ea[145] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[32];
-    Kc = exp(g_RT[11] - g_RT[12] - g_RT[32] + g_RT[35]);
+    Kc = Kc_s[145];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[35]) + (h_RT[12] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27268,12 +26326,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[35];
-    k_f = prefactor_units[146] * fwd_A[146]
-                * exp(fwd_beta[146] * tc[0] - activation_units[146] * fwd_Ea[146] * invT);
+    k_f = k_f_s[146];
     dlnkfdT = fwd_beta[146] * invT + activation_units[146] * fwd_Ea[146] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[20];
-    Kc = exp(g_RT[1] - g_RT[15] - g_RT[20] + g_RT[35]);
+    Kc = Kc_s[146];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[35]) + (h_RT[15] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27319,12 +26376,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[35];
-    k_f = prefactor_units[147] * fwd_A[147]
-                * exp(fwd_beta[147] * tc[0] - activation_units[147] * fwd_Ea[147] * invT);
+    k_f = k_f_s[147];
     dlnkfdT = fwd_beta[147] * invT + activation_units[147] * fwd_Ea[147] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[23];
-    Kc = exp(g_RT[1] - g_RT[3] - g_RT[23] + g_RT[35]);
+    Kc = Kc_s[147];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[35]) + (h_RT[3] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27370,12 +26426,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[35];
-    k_f = prefactor_units[148] * fwd_A[148]
-                * exp(fwd_beta[148] * tc[0] - activation_units[148] * fwd_Ea[148] * invT);
+    k_f = k_f_s[148];
     dlnkfdT = fwd_beta[148] * invT + activation_units[148] * fwd_Ea[148] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[12]*sc[32];
-    Kc = refC * exp(-g_RT[12] - g_RT[12] + g_RT[13] - g_RT[32] + g_RT[35]);
+    Kc = Kc_s[148];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13] + h_RT[35]) + (2*h_RT[12] + h_RT[32]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27421,12 +26476,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[35];
-    k_f = prefactor_units[149] * fwd_A[149]
-                * exp(fwd_beta[149] * tc[0] - activation_units[149] * fwd_Ea[149] * invT);
+    k_f = k_f_s[149];
     dlnkfdT = fwd_beta[149] * invT + activation_units[149] * fwd_Ea[149] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[32];
-    Kc = exp(g_RT[12] - g_RT[15] - g_RT[32] + g_RT[35]);
+    Kc = Kc_s[149];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[35]) + (h_RT[15] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27472,12 +26526,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[32];
-    k_f = prefactor_units[150] * fwd_A[150]
-                * exp(fwd_beta[150] * tc[0] - activation_units[150] * fwd_Ea[150] * invT);
+    k_f = k_f_s[150];
     dlnkfdT = fwd_beta[150] * invT + activation_units[150] * fwd_Ea[150] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[31];
-    Kc = exp(g_RT[12] - g_RT[15] - g_RT[31] + g_RT[32]);
+    Kc = Kc_s[150];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[32]) + (h_RT[15] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27523,12 +26576,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[32];
-    k_f = prefactor_units[151] * fwd_A[151]
-                * exp(fwd_beta[151] * tc[0] - activation_units[151] * fwd_Ea[151] * invT);
+    k_f = k_f_s[151];
     dlnkfdT = fwd_beta[151] * invT + activation_units[151] * fwd_Ea[151] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[30];
-    Kc = exp(g_RT[12] - g_RT[15] - g_RT[30] + g_RT[32]);
+    Kc = Kc_s[151];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[32]) + (h_RT[15] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27574,12 +26626,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[32];
-    k_f = prefactor_units[152] * fwd_A[152]
-                * exp(fwd_beta[152] * tc[0] - activation_units[152] * fwd_Ea[152] * invT);
+    k_f = k_f_s[152];
     dlnkfdT = fwd_beta[152] * invT + activation_units[152] * fwd_Ea[152] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[31];
-    Kc = exp(g_RT[11] - g_RT[12] - g_RT[31] + g_RT[32]);
+    Kc = Kc_s[152];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[32]) + (h_RT[12] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27625,12 +26676,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[32];
-    k_f = prefactor_units[153] * fwd_A[153]
-                * exp(fwd_beta[153] * tc[0] - activation_units[153] * fwd_Ea[153] * invT);
+    k_f = k_f_s[153];
     dlnkfdT = fwd_beta[153] * invT + activation_units[153] * fwd_Ea[153] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[30];
-    Kc = exp(g_RT[11] - g_RT[12] - g_RT[30] + g_RT[32]);
+    Kc = Kc_s[153];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[32]) + (h_RT[12] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27676,12 +26726,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[32];
-    k_f = prefactor_units[154] * fwd_A[154]
-                * exp(fwd_beta[154] * tc[0] - activation_units[154] * fwd_Ea[154] * invT);
+    k_f = k_f_s[154];
     dlnkfdT = fwd_beta[154] * invT + activation_units[154] * fwd_Ea[154] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[31];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[31] + g_RT[32]);
+    Kc = Kc_s[154];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[32]) + (h_RT[0] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27727,12 +26776,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[32];
-    k_f = prefactor_units[155] * fwd_A[155]
-                * exp(fwd_beta[155] * tc[0] - activation_units[155] * fwd_Ea[155] * invT);
+    k_f = k_f_s[155];
     dlnkfdT = fwd_beta[155] * invT + activation_units[155] * fwd_Ea[155] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[30];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[30] + g_RT[32]);
+    Kc = Kc_s[155];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[32]) + (h_RT[0] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27778,12 +26826,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[32];
-    k_f = prefactor_units[156] * fwd_A[156]
-                * exp(fwd_beta[156] * tc[0] - activation_units[156] * fwd_Ea[156] * invT);
+    k_f = k_f_s[156];
     dlnkfdT = fwd_beta[156] * invT + activation_units[156] * fwd_Ea[156] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[31];
-    Kc = exp(-g_RT[2] + g_RT[3] - g_RT[31] + g_RT[32]);
+    Kc = Kc_s[156];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[32]) + (h_RT[2] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27829,12 +26876,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[32];
-    k_f = prefactor_units[157] * fwd_A[157]
-                * exp(fwd_beta[157] * tc[0] - activation_units[157] * fwd_Ea[157] * invT);
+    k_f = k_f_s[157];
     dlnkfdT = fwd_beta[157] * invT + activation_units[157] * fwd_Ea[157] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[30];
-    Kc = exp(-g_RT[2] + g_RT[3] - g_RT[30] + g_RT[32]);
+    Kc = Kc_s[157];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[32]) + (h_RT[2] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27880,12 +26926,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[32];
-    k_f = prefactor_units[158] * fwd_A[158]
-                * exp(fwd_beta[158] * tc[0] - activation_units[158] * fwd_Ea[158] * invT);
+    k_f = k_f_s[158];
     dlnkfdT = fwd_beta[158] * invT + activation_units[158] * fwd_Ea[158] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[31];
-    Kc = exp(g_RT[13] - g_RT[14] - g_RT[31] + g_RT[32]);
+    Kc = Kc_s[158];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13] + h_RT[32]) + (h_RT[14] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27931,12 +26976,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[32];
-    k_f = prefactor_units[159] * fwd_A[159]
-                * exp(fwd_beta[159] * tc[0] - activation_units[159] * fwd_Ea[159] * invT);
+    k_f = k_f_s[159];
     dlnkfdT = fwd_beta[159] * invT + activation_units[159] * fwd_Ea[159] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[30];
-    Kc = exp(g_RT[13] - g_RT[14] - g_RT[30] + g_RT[32]);
+    Kc = Kc_s[159];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13] + h_RT[32]) + (h_RT[14] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27982,12 +27026,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[32];
-    k_f = prefactor_units[160] * fwd_A[160]
-                * exp(fwd_beta[160] * tc[0] - activation_units[160] * fwd_Ea[160] * invT);
+    k_f = k_f_s[160];
     dlnkfdT = fwd_beta[160] * invT + activation_units[160] * fwd_Ea[160] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[31];
-    Kc = exp(g_RT[10] - g_RT[13] - g_RT[31] + g_RT[32]);
+    Kc = Kc_s[160];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[32]) + (h_RT[13] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28033,12 +27076,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[22];
-    k_f = prefactor_units[161] * fwd_A[161]
-                * exp(fwd_beta[161] * tc[0] - activation_units[161] * fwd_Ea[161] * invT);
+    k_f = k_f_s[161];
     dlnkfdT = fwd_beta[161] * invT + activation_units[161] * fwd_Ea[161] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[21];
-    Kc = exp(-g_RT[2] + g_RT[3] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[161];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[22]) + (h_RT[2] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28084,12 +27126,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[22];
-    k_f = prefactor_units[162] * fwd_A[162]
-                * exp(fwd_beta[162] * tc[0] - activation_units[162] * fwd_Ea[162] * invT);
+    k_f = k_f_s[162];
     dlnkfdT = fwd_beta[162] * invT + activation_units[162] * fwd_Ea[162] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[21];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[162];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[22]) + (h_RT[0] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28135,12 +27176,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[22];
-    k_f = prefactor_units[163] * fwd_A[163]
-                * exp(fwd_beta[163] * tc[0] - activation_units[163] * fwd_Ea[163] * invT);
+    k_f = k_f_s[163];
     dlnkfdT = fwd_beta[163] * invT + activation_units[163] * fwd_Ea[163] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[21];
-    Kc = exp(g_RT[11] - g_RT[12] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[163];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[22]) + (h_RT[12] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28186,12 +27226,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[22];
-    k_f = prefactor_units[164] * fwd_A[164]
-                * exp(fwd_beta[164] * tc[0] - activation_units[164] * fwd_Ea[164] * invT);
+    k_f = k_f_s[164];
     dlnkfdT = fwd_beta[164] * invT + activation_units[164] * fwd_Ea[164] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[21];
-    Kc = exp(g_RT[12] - g_RT[15] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[164];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[22]) + (h_RT[15] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28237,12 +27276,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[21];
-    k_f = prefactor_units[165] * fwd_A[165]
-                * exp(fwd_beta[165] * tc[0] - activation_units[165] * fwd_Ea[165] * invT);
+    k_f = k_f_s[165];
     dlnkfdT = fwd_beta[165] * invT + activation_units[165] * fwd_Ea[165] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[20];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[20] + g_RT[21]);
+    Kc = Kc_s[165];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[21]) + (h_RT[0] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28288,12 +27326,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[21];
-    k_f = prefactor_units[166] * fwd_A[166]
-                * exp(fwd_beta[166] * tc[0] - activation_units[166] * fwd_Ea[166] * invT);
+    k_f = k_f_s[166];
     dlnkfdT = fwd_beta[166] * invT + activation_units[166] * fwd_Ea[166] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[3];
-    Kc = exp(g_RT[1] - g_RT[3] - g_RT[3] + g_RT[21]);
+    Kc = Kc_s[166];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[21]) + (2*h_RT[3]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28328,12 +27365,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[21];
-    k_f = prefactor_units[167] * fwd_A[167]
-                * exp(fwd_beta[167] * tc[0] - activation_units[167] * fwd_Ea[167] * invT);
+    k_f = k_f_s[167];
     dlnkfdT = fwd_beta[167] * invT + activation_units[167] * fwd_Ea[167] * invT2;
     /* reverse */
     phi_r = sc[22];
-    Kc = refCinv * exp(g_RT[1] + g_RT[21] - g_RT[22]);
+    Kc = Kc_s[167];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[21]) + (h_RT[22]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28368,12 +27404,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[21];
-    k_f = prefactor_units[168] * fwd_A[168]
-                * exp(fwd_beta[168] * tc[0] - activation_units[168] * fwd_Ea[168] * invT);
+    k_f = k_f_s[168];
     dlnkfdT = fwd_beta[168] * invT + activation_units[168] * fwd_Ea[168] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[20];
-    Kc = exp(g_RT[12] - g_RT[15] - g_RT[20] + g_RT[21]);
+    Kc = Kc_s[168];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[21]) + (h_RT[15] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28419,12 +27454,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[21];
-    k_f = prefactor_units[169] * fwd_A[169]
-                * exp(fwd_beta[169] * tc[0] - activation_units[169] * fwd_Ea[169] * invT);
+    k_f = k_f_s[169];
     dlnkfdT = fwd_beta[169] * invT + activation_units[169] * fwd_Ea[169] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[6];
-    Kc = exp(-g_RT[3] - g_RT[6] + g_RT[11] + g_RT[21]);
+    Kc = Kc_s[169];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[21]) + (h_RT[3] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28470,12 +27504,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[21];
-    k_f = prefactor_units[170] * fwd_A[170]
-                * exp(fwd_beta[170] * tc[0] - activation_units[170] * fwd_Ea[170] * invT);
+    k_f = k_f_s[170];
     dlnkfdT = fwd_beta[170] * invT + activation_units[170] * fwd_Ea[170] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[22];
-    Kc = exp(-g_RT[10] + g_RT[13] + g_RT[21] - g_RT[22]);
+    Kc = Kc_s[170];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13] + h_RT[21]) + (h_RT[10] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28521,12 +27554,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[21];
-    k_f = prefactor_units[171] * fwd_A[171]
-                * exp(fwd_beta[171] * tc[0] - activation_units[171] * fwd_Ea[171] * invT);
+    k_f = k_f_s[171];
     dlnkfdT = fwd_beta[171] * invT + activation_units[171] * fwd_Ea[171] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[36];
-    Kc = exp(-g_RT[12] + g_RT[13] + g_RT[21] - g_RT[36]);
+    Kc = Kc_s[171];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13] + h_RT[21]) + (h_RT[12] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28572,12 +27604,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[21];
-    k_f = prefactor_units[172] * fwd_A[172]
-                * exp(fwd_beta[172] * tc[0] - activation_units[172] * fwd_Ea[172] * invT);
+    k_f = k_f_s[172];
     dlnkfdT = fwd_beta[172] * invT + activation_units[172] * fwd_Ea[172] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[20];
-    Kc = exp(g_RT[10] - g_RT[13] - g_RT[20] + g_RT[21]);
+    Kc = Kc_s[172];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[21]) + (h_RT[13] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28623,12 +27654,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[21];
-    k_f = prefactor_units[173] * fwd_A[173]
-                * exp(fwd_beta[173] * tc[0] - activation_units[173] * fwd_Ea[173] * invT);
+    k_f = k_f_s[173];
     dlnkfdT = fwd_beta[173] * invT + activation_units[173] * fwd_Ea[173] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[32];
-    Kc = exp(g_RT[10] - g_RT[12] + g_RT[21] - g_RT[32]);
+    Kc = Kc_s[173];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[21]) + (h_RT[12] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28674,12 +27704,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[20];
-    k_f = prefactor_units[174] * fwd_A[174]
-                * exp(fwd_beta[174] * tc[0] - activation_units[174] * fwd_Ea[174] * invT);
+    k_f = k_f_s[174];
     dlnkfdT = fwd_beta[174] * invT + activation_units[174] * fwd_Ea[174] * invT2;
     /* reverse */
     phi_r = sc[34];
-    Kc = refCinv * exp(g_RT[12] + g_RT[20] - g_RT[34]);
+    Kc = Kc_s[174];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[20]) + (h_RT[34]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28714,12 +27743,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[20];
-    k_f = prefactor_units[175] * fwd_A[175]
-                * exp(fwd_beta[175] * tc[0] - activation_units[175] * fwd_Ea[175] * invT);
+    k_f = k_f_s[175];
     dlnkfdT = fwd_beta[175] * invT + activation_units[175] * fwd_Ea[175] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[19];
-    Kc = exp(g_RT[12] - g_RT[15] - g_RT[19] + g_RT[20]);
+    Kc = Kc_s[175];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[20]) + (h_RT[15] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28765,12 +27793,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[20];
-    k_f = prefactor_units[176] * fwd_A[176]
-                * exp(fwd_beta[176] * tc[0] - activation_units[176] * fwd_Ea[176] * invT);
+    k_f = k_f_s[176];
     dlnkfdT = fwd_beta[176] * invT + activation_units[176] * fwd_Ea[176] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[7];
-    Kc = exp(-g_RT[3] - g_RT[7] + g_RT[11] + g_RT[20]);
+    Kc = Kc_s[176];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[20]) + (h_RT[3] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28816,12 +27843,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[20];
-    k_f = prefactor_units[177] * fwd_A[177]
-                * exp(fwd_beta[177] * tc[0] - activation_units[177] * fwd_Ea[177] * invT);
+    k_f = k_f_s[177];
     dlnkfdT = fwd_beta[177] * invT + activation_units[177] * fwd_Ea[177] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[30];
-    Kc = exp(-g_RT[1] + g_RT[11] + g_RT[20] - g_RT[30]);
+    Kc = Kc_s[177];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[20]) + (h_RT[1] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28867,12 +27893,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[20];
-    k_f = prefactor_units[178] * fwd_A[178]
-                * exp(fwd_beta[178] * tc[0] - activation_units[178] * fwd_Ea[178] * invT);
+    k_f = k_f_s[178];
     dlnkfdT = fwd_beta[178] * invT + activation_units[178] * fwd_Ea[178] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[19];
-    Kc = exp(-g_RT[2] + g_RT[3] - g_RT[19] + g_RT[20]);
+    Kc = Kc_s[178];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[20]) + (h_RT[2] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28918,12 +27943,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[20];
-    k_f = prefactor_units[179] * fwd_A[179]
-                * exp(fwd_beta[179] * tc[0] - activation_units[179] * fwd_Ea[179] * invT);
+    k_f = k_f_s[179];
     dlnkfdT = fwd_beta[179] * invT + activation_units[179] * fwd_Ea[179] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[19];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[19] + g_RT[20]);
+    Kc = Kc_s[179];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[20]) + (h_RT[0] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28969,12 +27993,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[180] * fwd_A[180]
-                * exp(fwd_beta[180] * tc[0] - activation_units[180] * fwd_Ea[180] * invT);
+    k_f = k_f_s[180];
     dlnkfdT = fwd_beta[180] * invT + activation_units[180] * fwd_Ea[180] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[18];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[18] + g_RT[19]);
+    Kc = Kc_s[180];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[0] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29020,12 +28043,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[19];
-    k_f = prefactor_units[181] * fwd_A[181]
-                * exp(fwd_beta[181] * tc[0] - activation_units[181] * fwd_Ea[181] * invT);
+    k_f = k_f_s[181];
     dlnkfdT = fwd_beta[181] * invT + activation_units[181] * fwd_Ea[181] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[29];
-    Kc = exp(-g_RT[1] + g_RT[11] + g_RT[19] - g_RT[29]);
+    Kc = Kc_s[181];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[19]) + (h_RT[1] + h_RT[29]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29071,12 +28093,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[19];
-    k_f = prefactor_units[182] * fwd_A[182]
-                * exp(fwd_beta[182] * tc[0] - activation_units[182] * fwd_Ea[182] * invT);
+    k_f = k_f_s[182];
     dlnkfdT = fwd_beta[182] * invT + activation_units[182] * fwd_Ea[182] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[7];
-    Kc = exp(-g_RT[6] - g_RT[7] + g_RT[10] + g_RT[19]);
+    Kc = Kc_s[182];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[19]) + (h_RT[6] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29122,12 +28143,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[19];
-    k_f = prefactor_units[183] * fwd_A[183]
-                * exp(fwd_beta[183] * tc[0] - activation_units[183] * fwd_Ea[183] * invT);
+    k_f = k_f_s[183];
     dlnkfdT = fwd_beta[183] * invT + activation_units[183] * fwd_Ea[183] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[30];
-    Kc = exp(g_RT[10] - g_RT[11] + g_RT[19] - g_RT[30]);
+    Kc = Kc_s[183];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[19]) + (h_RT[11] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29173,12 +28193,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[19];
-    k_f = prefactor_units[184] * fwd_A[184]
-                * exp(fwd_beta[184] * tc[0] - activation_units[184] * fwd_Ea[184] * invT);
+    k_f = k_f_s[184];
     dlnkfdT = fwd_beta[184] * invT + activation_units[184] * fwd_Ea[184] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[18];
-    Kc = exp(g_RT[10] - g_RT[13] - g_RT[18] + g_RT[19]);
+    Kc = Kc_s[184];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[19]) + (h_RT[13] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29224,12 +28243,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[19];
-    k_f = prefactor_units[185] * fwd_A[185]
-                * exp(fwd_beta[185] * tc[0] - activation_units[185] * fwd_Ea[185] * invT);
+    k_f = k_f_s[185];
     dlnkfdT = fwd_beta[185] * invT + activation_units[185] * fwd_Ea[185] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[18];
-    Kc = exp(g_RT[12] - g_RT[15] - g_RT[18] + g_RT[19]);
+    Kc = Kc_s[185];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[19]) + (h_RT[15] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29275,12 +28293,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[19];
-    k_f = prefactor_units[186] * fwd_A[186]
-                * exp(fwd_beta[186] * tc[0] - activation_units[186] * fwd_Ea[186] * invT);
+    k_f = k_f_s[186];
     dlnkfdT = fwd_beta[186] * invT + activation_units[186] * fwd_Ea[186] * invT2;
     /* reverse */
     phi_r = sc[18]*sc[18];
-    Kc = exp(g_RT[16] - g_RT[18] - g_RT[18] + g_RT[19]);
+    Kc = Kc_s[186];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[19]) + (2*h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29315,12 +28332,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[19];
-    k_f = prefactor_units[187] * fwd_A[187]
-                * exp(fwd_beta[187] * tc[0] - activation_units[187] * fwd_Ea[187] * invT);
+    k_f = k_f_s[187];
     dlnkfdT = fwd_beta[187] * invT + activation_units[187] * fwd_Ea[187] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[18];
-    Kc = exp(-g_RT[4] + g_RT[5] - g_RT[18] + g_RT[19]);
+    Kc = Kc_s[187];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[19]) + (h_RT[4] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29366,12 +28382,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[19];
-    k_f = prefactor_units[188] * fwd_A[188]
-                * exp(fwd_beta[188] * tc[0] - activation_units[188] * fwd_Ea[188] * invT);
+    k_f = k_f_s[188];
     dlnkfdT = fwd_beta[188] * invT + activation_units[188] * fwd_Ea[188] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[18];
-    Kc = exp(-g_RT[2] + g_RT[3] - g_RT[18] + g_RT[19]);
+    Kc = Kc_s[188];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[19]) + (h_RT[2] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29417,12 +28432,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[18];
-    k_f = prefactor_units[189] * fwd_A[189]
-                * exp(fwd_beta[189] * tc[0] - activation_units[189] * fwd_Ea[189] * invT);
+    k_f = k_f_s[189];
     dlnkfdT = fwd_beta[189] * invT + activation_units[189] * fwd_Ea[189] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[16];
-    Kc = exp(g_RT[12] - g_RT[15] - g_RT[16] + g_RT[18]);
+    Kc = Kc_s[189];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[18]) + (h_RT[15] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29468,12 +28482,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[18];
-    k_f = prefactor_units[190] * fwd_A[190]
-                * exp(fwd_beta[190] * tc[0] - activation_units[190] * fwd_Ea[190] * invT);
+    k_f = k_f_s[190];
     dlnkfdT = fwd_beta[190] * invT + activation_units[190] * fwd_Ea[190] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[25];
-    Kc = exp(-g_RT[1] + g_RT[12] + g_RT[18] - g_RT[25]);
+    Kc = Kc_s[190];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[18]) + (h_RT[1] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29519,12 +28532,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[18];
-    k_f = prefactor_units[191] * fwd_A[191]
-                * exp(fwd_beta[191] * tc[0] - activation_units[191] * fwd_Ea[191] * invT);
+    k_f = k_f_s[191];
     dlnkfdT = fwd_beta[191] * invT + activation_units[191] * fwd_Ea[191] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[29];
-    Kc = exp(-g_RT[1] + g_RT[12] + g_RT[18] - g_RT[29]);
+    Kc = Kc_s[191];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[18]) + (h_RT[1] + h_RT[29]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29570,12 +28582,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[18];
-    k_f = prefactor_units[192] * fwd_A[192]
-                * exp(fwd_beta[192] * tc[0] - activation_units[192] * fwd_Ea[192] * invT);
+    k_f = k_f_s[192];
     dlnkfdT = fwd_beta[192] * invT + activation_units[192] * fwd_Ea[192] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[29];
-    Kc = exp(-g_RT[1] + g_RT[12] + g_RT[18] - g_RT[29]);
+    Kc = Kc_s[192];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[18]) + (h_RT[1] + h_RT[29]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29621,12 +28632,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[18];
-    k_f = prefactor_units[193] * fwd_A[193]
-                * exp(fwd_beta[193] * tc[0] - activation_units[193] * fwd_Ea[193] * invT);
+    k_f = k_f_s[193];
     dlnkfdT = fwd_beta[193] * invT + activation_units[193] * fwd_Ea[193] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[9];
-    Kc = exp(-g_RT[3] - g_RT[9] + g_RT[12] + g_RT[18]);
+    Kc = Kc_s[193];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[18]) + (h_RT[3] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29672,12 +28682,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[25];
-    k_f = prefactor_units[194] * fwd_A[194]
-                * exp(fwd_beta[194] * tc[0] - activation_units[194] * fwd_Ea[194] * invT);
+    k_f = k_f_s[194];
     dlnkfdT = fwd_beta[194] * invT + activation_units[194] * fwd_Ea[194] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[29];
-    Kc = exp(g_RT[1] - g_RT[1] + g_RT[25] - g_RT[29]);
+    Kc = Kc_s[194];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[25]) + (h_RT[1] + h_RT[29]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29707,12 +28716,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[18];
-    k_f = prefactor_units[195] * fwd_A[195]
-                * exp(fwd_beta[195] * tc[0] - activation_units[195] * fwd_Ea[195] * invT);
+    k_f = k_f_s[195];
     dlnkfdT = fwd_beta[195] * invT + activation_units[195] * fwd_Ea[195] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[9];
-    Kc = exp(-g_RT[4] - g_RT[9] + g_RT[11] + g_RT[18]);
+    Kc = Kc_s[195];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[18]) + (h_RT[4] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29758,12 +28766,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[18];
-    k_f = prefactor_units[196] * fwd_A[196]
-                * exp(fwd_beta[196] * tc[0] - activation_units[196] * fwd_Ea[196] * invT);
+    k_f = k_f_s[196];
     dlnkfdT = fwd_beta[196] * invT + activation_units[196] * fwd_Ea[196] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[17];
-    Kc = exp(-g_RT[1] + g_RT[11] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[196];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[18]) + (h_RT[1] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29809,12 +28816,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[18];
-    k_f = prefactor_units[197] * fwd_A[197]
-                * exp(fwd_beta[197] * tc[0] - activation_units[197] * fwd_Ea[197] * invT);
+    k_f = k_f_s[197];
     dlnkfdT = fwd_beta[197] * invT + activation_units[197] * fwd_Ea[197] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[16];
-    Kc = exp(g_RT[11] - g_RT[12] - g_RT[16] + g_RT[18]);
+    Kc = Kc_s[197];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[18]) + (h_RT[12] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29860,12 +28866,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[18];
-    k_f = prefactor_units[198] * fwd_A[198]
-                * exp(fwd_beta[198] * tc[0] - activation_units[198] * fwd_Ea[198] * invT);
+    k_f = k_f_s[198];
     dlnkfdT = fwd_beta[198] * invT + activation_units[198] * fwd_Ea[198] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[16];
-    Kc = exp(-g_RT[2] + g_RT[3] - g_RT[16] + g_RT[18]);
+    Kc = Kc_s[198];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[18]) + (h_RT[2] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29911,12 +28916,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[18];
-    k_f = prefactor_units[199] * fwd_A[199]
-                * exp(fwd_beta[199] * tc[0] - activation_units[199] * fwd_Ea[199] * invT);
+    k_f = k_f_s[199];
     dlnkfdT = fwd_beta[199] * invT + activation_units[199] * fwd_Ea[199] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[17];
-    Kc = exp(g_RT[10] - g_RT[12] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[199];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[18]) + (h_RT[12] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29962,12 +28966,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[30];
-    k_f = prefactor_units[200] * fwd_A[200]
-                * exp(fwd_beta[200] * tc[0] - activation_units[200] * fwd_Ea[200] * invT);
+    k_f = k_f_s[200];
     dlnkfdT = fwd_beta[200] * invT + activation_units[200] * fwd_Ea[200] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[7];
-    Kc = exp(g_RT[1] - g_RT[3] - g_RT[7] + g_RT[30]);
+    Kc = Kc_s[200];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[30]) + (h_RT[3] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30013,12 +29016,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[30];
-    k_f = prefactor_units[201] * fwd_A[201]
-                * exp(fwd_beta[201] * tc[0] - activation_units[201] * fwd_Ea[201] * invT);
+    k_f = k_f_s[201];
     dlnkfdT = fwd_beta[201] * invT + activation_units[201] * fwd_Ea[201] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[29];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[29] + g_RT[30]);
+    Kc = Kc_s[201];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[30]) + (h_RT[0] + h_RT[29]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30064,12 +29066,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[30];
-    k_f = prefactor_units[202] * fwd_A[202]
-                * exp(fwd_beta[202] * tc[0] - activation_units[202] * fwd_Ea[202] * invT);
+    k_f = k_f_s[202];
     dlnkfdT = fwd_beta[202] * invT + activation_units[202] * fwd_Ea[202] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[7];
-    Kc = exp(-g_RT[6] - g_RT[7] + g_RT[11] + g_RT[30]);
+    Kc = Kc_s[202];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[30]) + (h_RT[6] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30115,12 +29116,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[30];
-    k_f = prefactor_units[203] * fwd_A[203]
-                * exp(fwd_beta[203] * tc[0] - activation_units[203] * fwd_Ea[203] * invT);
+    k_f = k_f_s[203];
     dlnkfdT = fwd_beta[203] * invT + activation_units[203] * fwd_Ea[203] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[29];
-    Kc = exp(g_RT[12] - g_RT[15] - g_RT[29] + g_RT[30]);
+    Kc = Kc_s[203];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[30]) + (h_RT[15] + h_RT[29]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30166,12 +29166,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[30];
-    k_f = prefactor_units[204] * fwd_A[204]
-                * exp(fwd_beta[204] * tc[0] - activation_units[204] * fwd_Ea[204] * invT);
+    k_f = k_f_s[204];
     dlnkfdT = fwd_beta[204] * invT + activation_units[204] * fwd_Ea[204] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[9]*sc[12];
-    Kc = refC * exp(-g_RT[6] - g_RT[9] + g_RT[10] - g_RT[12] + g_RT[30]);
+    Kc = Kc_s[204];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[30]) + (h_RT[6] + h_RT[9] + h_RT[12]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30230,12 +29229,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[30];
-    k_f = prefactor_units[205] * fwd_A[205]
-                * exp(fwd_beta[205] * tc[0] - activation_units[205] * fwd_Ea[205] * invT);
+    k_f = k_f_s[205];
     dlnkfdT = fwd_beta[205] * invT + activation_units[205] * fwd_Ea[205] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[9]*sc[21];
-    Kc = refC * exp(-g_RT[1] + g_RT[3] - g_RT[9] - g_RT[21] + g_RT[30]);
+    Kc = Kc_s[205];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[30]) + (h_RT[1] + h_RT[9] + h_RT[21]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30294,12 +29292,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[30];
-    k_f = prefactor_units[206] * fwd_A[206]
-                * exp(fwd_beta[206] * tc[0] - activation_units[206] * fwd_Ea[206] * invT);
+    k_f = k_f_s[206];
     dlnkfdT = fwd_beta[206] * invT + activation_units[206] * fwd_Ea[206] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[7]*sc[12];
-    Kc = refC * exp(-g_RT[6] - g_RT[7] - g_RT[12] + g_RT[13] + g_RT[30]);
+    Kc = Kc_s[206];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13] + h_RT[30]) + (h_RT[6] + h_RT[7] + h_RT[12]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30358,12 +29355,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[30];
-    k_f = prefactor_units[207] * fwd_A[207]
-                * exp(fwd_beta[207] * tc[0] - activation_units[207] * fwd_Ea[207] * invT);
+    k_f = k_f_s[207];
     dlnkfdT = fwd_beta[207] * invT + activation_units[207] * fwd_Ea[207] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[32];
-    Kc = exp(-g_RT[10] + g_RT[13] + g_RT[30] - g_RT[32]);
+    Kc = Kc_s[207];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13] + h_RT[30]) + (h_RT[10] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30409,12 +29405,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[30];
-    k_f = prefactor_units[208] * fwd_A[208]
-                * exp(fwd_beta[208] * tc[0] - activation_units[208] * fwd_Ea[208] * invT);
+    k_f = k_f_s[208];
     dlnkfdT = fwd_beta[208] * invT + activation_units[208] * fwd_Ea[208] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[9];
-    Kc = refC * exp(-g_RT[3] - g_RT[9] + g_RT[30]);
+    Kc = Kc_s[208];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[30]) + (h_RT[3] + h_RT[9]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30449,12 +29444,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[30];
-    k_f = prefactor_units[209] * fwd_A[209]
-                * exp(fwd_beta[209] * tc[0] - activation_units[209] * fwd_Ea[209] * invT);
+    k_f = k_f_s[209];
     dlnkfdT = fwd_beta[209] * invT + activation_units[209] * fwd_Ea[209] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[29];
-    Kc = refC * exp(-g_RT[1] - g_RT[29] + g_RT[30]);
+    Kc = Kc_s[209];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[30]) + (h_RT[1] + h_RT[29]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30489,12 +29483,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[29];
-    k_f = prefactor_units[210] * fwd_A[210]
-                * exp(fwd_beta[210] * tc[0] - activation_units[210] * fwd_Ea[210] * invT);
+    k_f = k_f_s[210];
     dlnkfdT = fwd_beta[210] * invT + activation_units[210] * fwd_Ea[210] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[8];
-    Kc = exp(-g_RT[4] - g_RT[8] + g_RT[11] + g_RT[29]);
+    Kc = Kc_s[210];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[29]) + (h_RT[4] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30540,12 +29533,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[29];
-    k_f = prefactor_units[211] * fwd_A[211]
-                * exp(fwd_beta[211] * tc[0] - activation_units[211] * fwd_Ea[211] * invT);
+    k_f = k_f_s[211];
     dlnkfdT = fwd_beta[211] * invT + activation_units[211] * fwd_Ea[211] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[9];
-    Kc = exp(g_RT[1] - g_RT[3] - g_RT[9] + g_RT[29]);
+    Kc = Kc_s[211];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[29]) + (h_RT[3] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30591,12 +29583,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[29];
-    k_f = prefactor_units[212] * fwd_A[212]
-                * exp(fwd_beta[212] * tc[0] - activation_units[212] * fwd_Ea[212] * invT);
+    k_f = k_f_s[212];
     dlnkfdT = fwd_beta[212] * invT + activation_units[212] * fwd_Ea[212] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[17];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[17] + g_RT[29]);
+    Kc = Kc_s[212];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[29]) + (h_RT[0] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30642,12 +29633,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[29];
-    k_f = prefactor_units[213] * fwd_A[213]
-                * exp(fwd_beta[213] * tc[0] - activation_units[213] * fwd_Ea[213] * invT);
+    k_f = k_f_s[213];
     dlnkfdT = fwd_beta[213] * invT + activation_units[213] * fwd_Ea[213] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[17];
-    Kc = exp(g_RT[11] - g_RT[12] - g_RT[17] + g_RT[29]);
+    Kc = Kc_s[213];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[29]) + (h_RT[12] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30693,12 +29683,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[29];
-    k_f = prefactor_units[214] * fwd_A[214]
-                * exp(fwd_beta[214] * tc[0] - activation_units[214] * fwd_Ea[214] * invT);
+    k_f = k_f_s[214];
     dlnkfdT = fwd_beta[214] * invT + activation_units[214] * fwd_Ea[214] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[17];
-    Kc = exp(g_RT[12] - g_RT[15] - g_RT[17] + g_RT[29]);
+    Kc = Kc_s[214];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[29]) + (h_RT[15] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30744,12 +29733,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[29];
-    k_f = prefactor_units[215] * fwd_A[215]
-                * exp(fwd_beta[215] * tc[0] - activation_units[215] * fwd_Ea[215] * invT);
+    k_f = k_f_s[215];
     dlnkfdT = fwd_beta[215] * invT + activation_units[215] * fwd_Ea[215] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[23];
-    Kc = exp(-g_RT[9] + g_RT[12] - g_RT[23] + g_RT[29]);
+    Kc = Kc_s[215];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[29]) + (h_RT[9] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30795,12 +29783,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[16];
-    k_f = prefactor_units[216] * fwd_A[216]
-                * exp(fwd_beta[216] * tc[0] - activation_units[216] * fwd_Ea[216] * invT);
+    k_f = k_f_s[216];
     dlnkfdT = fwd_beta[216] * invT + activation_units[216] * fwd_Ea[216] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[18];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[16] - g_RT[18]);
+    Kc = Kc_s[216];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[16]) + (h_RT[1] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30846,12 +29833,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[16];
-    k_f = prefactor_units[217] * fwd_A[217]
-                * exp(fwd_beta[217] * tc[0] - activation_units[217] * fwd_Ea[217] * invT);
+    k_f = k_f_s[217];
     dlnkfdT = fwd_beta[217] * invT + activation_units[217] * fwd_Ea[217] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[9];
-    Kc = exp(-g_RT[5] - g_RT[9] + g_RT[11] + g_RT[16]);
+    Kc = Kc_s[217];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[16]) + (h_RT[5] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30897,12 +29883,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[16];
-    k_f = prefactor_units[218] * fwd_A[218]
-                * exp(fwd_beta[218] * tc[0] - activation_units[218] * fwd_Ea[218] * invT);
+    k_f = k_f_s[218];
     dlnkfdT = fwd_beta[218] * invT + activation_units[218] * fwd_Ea[218] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[17];
-    Kc = exp(-g_RT[1] + g_RT[12] + g_RT[16] - g_RT[17]);
+    Kc = Kc_s[218];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[16]) + (h_RT[1] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30948,12 +29933,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[16];
-    k_f = prefactor_units[219] * fwd_A[219]
-                * exp(fwd_beta[219] * tc[0] - activation_units[219] * fwd_Ea[219] * invT);
+    k_f = k_f_s[219];
     dlnkfdT = fwd_beta[219] * invT + activation_units[219] * fwd_Ea[219] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[9]*sc[9];
-    Kc = refC * exp(-g_RT[1] - g_RT[9] - g_RT[9] + g_RT[10] + g_RT[16]);
+    Kc = Kc_s[219];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[16]) + (h_RT[1] + 2*h_RT[9]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30999,12 +29983,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[17]*sc[18];
-    k_f = prefactor_units[220] * fwd_A[220]
-                * exp(fwd_beta[220] * tc[0] - activation_units[220] * fwd_Ea[220] * invT);
+    k_f = k_f_s[220];
     dlnkfdT = fwd_beta[220] * invT + activation_units[220] * fwd_Ea[220] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[26];
-    Kc = exp(-g_RT[9] + g_RT[17] + g_RT[18] - g_RT[26]);
+    Kc = Kc_s[220];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[17] + h_RT[18]) + (h_RT[9] + h_RT[26]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31050,12 +30033,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[17];
-    k_f = prefactor_units[221] * fwd_A[221]
-                * exp(fwd_beta[221] * tc[0] - activation_units[221] * fwd_Ea[221] * invT);
+    k_f = k_f_s[221];
     dlnkfdT = fwd_beta[221] * invT + activation_units[221] * fwd_Ea[221] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[28];
-    Kc = exp(g_RT[1] - g_RT[9] + g_RT[17] - g_RT[28]);
+    Kc = Kc_s[221];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[17]) + (h_RT[9] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31101,12 +30083,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[17];
-    k_f = prefactor_units[222] * fwd_A[222]
-                * exp(fwd_beta[222] * tc[0] - activation_units[222] * fwd_Ea[222] * invT);
+    k_f = k_f_s[222];
     dlnkfdT = fwd_beta[222] * invT + activation_units[222] * fwd_Ea[222] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[9]*sc[9];
-    Kc = refC * exp(-g_RT[1] - g_RT[9] - g_RT[9] + g_RT[11] + g_RT[17]);
+    Kc = Kc_s[222];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[17]) + (h_RT[1] + 2*h_RT[9]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31152,12 +30133,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[17];
-    k_f = prefactor_units[223] * fwd_A[223]
-                * exp(fwd_beta[223] * tc[0] - activation_units[223] * fwd_Ea[223] * invT);
+    k_f = k_f_s[223];
     dlnkfdT = fwd_beta[223] * invT + activation_units[223] * fwd_Ea[223] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[8];
-    Kc = exp(-g_RT[5] - g_RT[8] + g_RT[11] + g_RT[17]);
+    Kc = Kc_s[223];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[17]) + (h_RT[5] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31203,12 +30183,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[17];
-    k_f = prefactor_units[224] * fwd_A[224]
-                * exp(fwd_beta[224] * tc[0] - activation_units[224] * fwd_Ea[224] * invT);
+    k_f = k_f_s[224];
     dlnkfdT = fwd_beta[224] * invT + activation_units[224] * fwd_Ea[224] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[9]*sc[11];
-    Kc = refC * exp(-g_RT[7] - g_RT[9] + g_RT[10] - g_RT[11] + g_RT[17]);
+    Kc = Kc_s[224];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[17]) + (h_RT[7] + h_RT[9] + h_RT[11]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31267,12 +30246,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[17];
-    k_f = prefactor_units[225] * fwd_A[225]
-                * exp(fwd_beta[225] * tc[0] - activation_units[225] * fwd_Ea[225] * invT);
+    k_f = k_f_s[225];
     dlnkfdT = fwd_beta[225] * invT + activation_units[225] * fwd_Ea[225] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[8];
-    Kc = exp(-g_RT[7] - g_RT[8] + g_RT[10] + g_RT[17]);
+    Kc = Kc_s[225];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[17]) + (h_RT[7] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31318,12 +30296,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[17];
-    k_f = prefactor_units[226] * fwd_A[226]
-                * exp(fwd_beta[226] * tc[0] - activation_units[226] * fwd_Ea[226] * invT);
+    k_f = k_f_s[226];
     dlnkfdT = fwd_beta[226] * invT + activation_units[226] * fwd_Ea[226] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[18];
-    Kc = exp(g_RT[5] - g_RT[9] + g_RT[17] - g_RT[18]);
+    Kc = Kc_s[226];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[17]) + (h_RT[9] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31369,12 +30346,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[17]*sc[17];
-    k_f = prefactor_units[227] * fwd_A[227]
-                * exp(fwd_beta[227] * tc[0] - activation_units[227] * fwd_Ea[227] * invT);
+    k_f = k_f_s[227];
     dlnkfdT = fwd_beta[227] * invT + activation_units[227] * fwd_Ea[227] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[9]*sc[18];
-    Kc = refC * exp(-g_RT[9] - g_RT[9] + g_RT[17] + g_RT[17] - g_RT[18]);
+    Kc = Kc_s[227];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[17]) + (2*h_RT[9] + h_RT[18]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31417,6 +30393,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         dcvpRdT(dcRdT, tc);
         speciesInternalEnergy(e_RT, tc);
         eh_RT = &e_RT[0];
+        for (int k=0; k<38; k++) {
+            for (int m=0; m<38; m++) {
+                J[k*39+m] += Jmix[m];
+            }
+        }
     }
 
     double cmix = 0.0, ehmix = 0.0, dcmixdT=0.0, dehmixdT=0.0;
@@ -37451,6 +36432,55 @@ void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double
     *ierr = 0;
     return;
 }
+/* get temperature given enthalpy in mass units and mass fracs */
+void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int * ierr)
+{
+#ifdef CONVERGENCE
+    const int maxiter = 5000;
+    const double tol  = 1.e-12;
+#else
+    const int maxiter = 200;
+    const double tol  = 1.e-6;
+#endif
+    double hin  = *h;
+    double tmin = 250;/*max lower bound for thermo def */
+    double tmax = 4000;/*min upper bound for thermo def */
+    double h1,hmin,hmax,cp,t1,dt;
+    int i;/* loop counter */
+    CKHBMS(&tmin, y, iwrk, rwrk, &hmin);
+    CKHBMS(&tmax, y, iwrk, rwrk, &hmax);
+    if (hin < hmin) {
+        /*Linear Extrapolation below tmin */
+        CKCPBS(&tmin, y, iwrk, rwrk, &cp);
+        *t = tmin - (hmin-hin)/cp;
+        *ierr = 1;
+        return;
+    }
+    if (hin > hmax) {
+        /*Linear Extrapolation above tmax */
+        CKCPBS(&tmax, y, iwrk, rwrk, &cp);
+        *t = tmax - (hmax-hin)/cp;
+        *ierr = 1;
+        return;
+    }
+    t1 = *t;
+    if (t1 < tmin || t1 > tmax) {
+        t1 = tmin + (tmax-tmin)/(hmax-hmin)*(hin-hmin);
+    }
+    for (i = 0; i < maxiter; ++i) {
+        CKHBMS(&t1,y,iwrk,rwrk,&h1);
+        CKCPBS(&t1,y,iwrk,rwrk,&cp);
+        dt = (hin - h1) / cp;
+        if (dt > 100.) { dt = 100.; }
+        else if (dt < -100.) { dt = -100.; }
+        else if (fabs(dt) < tol) break;
+        else if (t1+dt == t1) break;
+        t1 += dt;
+    }
+    *t = t1;
+    *ierr = 0;
+    return;
+}
 
 /* End of file  */
 #if defined(BL_FORT_USE_UPPERCASE)
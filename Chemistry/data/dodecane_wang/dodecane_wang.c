@@ -1,5 +1,6 @@
 
 #include <math.h>
+#include <float.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -86,6 +87,12 @@
 #define VCKPY VCKPY
 #define VCKWYR VCKWYR
 #define VCKYTX VCKYTX
+#define VCKCPBS VCKCPBS
+#define VCKCVBS VCKCVBS
+#define VCKHBMS VCKHBMS
+#define VCKUBMS VCKUBMS
+#define VCKRHOY VCKRHOY
+#define VCKMMWY VCKMMWY
 #define GET_T_GIVEN_EY GET_T_GIVEN_EY
 #define GET_T_GIVEN_HY GET_T_GIVEN_HY
 #define GET_REACTION_MAP GET_REACTION_MAP
@@ -171,6 +178,12 @@
 #define VCKPY vckpy
 #define VCKWYR vckwyr
 #define VCKYTX vckytx
+#define VCKCPBS vckcpbs
+#define VCKCVBS vckcvbs
+#define VCKHBMS vckhbms
+#define VCKUBMS vckubms
+#define VCKRHOY vckrhoy
+#define VCKMMWY vckmmwy
 #define GET_T_GIVEN_EY get_t_given_ey
 #define GET_T_GIVEN_HY get_t_given_hy
 #define GET_REACTION_MAP get_reaction_map
@@ -256,6 +269,12 @@
 #define VCKPY vckpy_
 #define VCKWYR vckwyr_
 #define VCKYTX vckytx_
+#define VCKCPBS vckcpbs_
+#define VCKCVBS vckcvbs_
+#define VCKHBMS vckhbms_
+#define VCKUBMS vckubms_
+#define VCKRHOY vckrhoy_
+#define VCKMMWY vckmmwy_
 #define GET_T_GIVEN_EY get_t_given_ey_
 #define GET_T_GIVEN_HY get_t_given_hy_
 #define GET_REACTION_MAP get_reaction_map_
@@ -369,6 +388,12 @@ void VCKWYR(int * restrict np, double * restrict rho, double * restrict T,
             double * restrict y, int * restrict iwrk, double * restrict rwrk,
             double * restrict wdot);
 void VCKYTX(int * restrict np, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict x);
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs);
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs);
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms);
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms);
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho);
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm);
 void vcomp_k_f(int npt, double * restrict k_f_s, double * restrict tc, double * restrict invT);
 void vcomp_gibbs(int npt, double * restrict g_RT, double * restrict tc);
 void vcomp_Kc(int npt, double * restrict Kc_s, double * restrict g_RT, double * restrict invT);
@@ -4813,6 +4838,28 @@ void CKRHOY(double * restrict P, double * restrict T, double * restrict y, int *
 }
 
 
+/*Compute rho = P*W(y)/RT */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho)
+{
+    for (int i=0; i<(*np); i++) {
+        rho[i] = 0.0;
+    }
+
+    for (int n=0; n<56; n++) {
+        for (int i=0; i<(*np); i++) {
+            rho[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        rho[i] = P[i] / (8.31451e+07 * T[i] * rho[i]);/*rho = P*W/(R*T) */
+    }
+
+    return;
+}
+
+
 /*Compute rho = P*W(c)/(R*T) */
 void CKRHOC(double * restrict P, double * restrict T, double * restrict c, int * iwrk, double * restrict rwrk, double * restrict rho)
 {
@@ -4921,6 +4968,29 @@ void CKMMWY(double * restrict y, int * iwrk, double * restrict rwrk, double * re
 }
 
 
+/*given y[species]: mass fractions */
+/*returns mean molecular weight (gm/mole) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm)
+{
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 0.0;
+    }
+
+    for (int n=0; n<56; n++) {
+        for (int i=0; i<(*np); i++) {
+            wtm[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 1.0 / wtm[i];
+    }
+
+    return;
+}
+
+
 /*given x[species]: mole fractions */
 /*returns mean molecular weight (gm/mole) */
 void CKMMWX(double * restrict x, int * iwrk, double * restrict rwrk, double * restrict wtm)
@@ -6033,6 +6103,30 @@ void CKCPBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CP (Eq. 34) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs)
+{
+    double tc[5], tmp[56], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cp_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<56; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cpbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean specific heat at CV (Eq. 35) */
 void CKCVBL(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict cvbl)
 {
@@ -6122,6 +6216,30 @@ void CKCVBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CV (Eq. 36) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs)
+{
+    double tc[5], tmp[56], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cv_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<56; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cvbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean enthalpy of the mixture in molar units */
 void CKHBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict hbml)
 {
@@ -6163,6 +6281,30 @@ void CKHBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns mean enthalpy of mixture in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms)
+{
+    double tc[5], tmp[56], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesEnthalpy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<56; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        hbms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mean internal energy in molar units */
 void CKUBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict ubml)
 {
@@ -6254,6 +6396,30 @@ void CKUBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*get mean internal energy in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms)
+{
+    double tc[5], tmp[56], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesInternalEnergy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<56; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        ubms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mixture entropy in molar units */
 void CKSBML(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict sbml)
 {
@@ -15797,12 +15963,311 @@ void productionRate(double * restrict wdot, double * restrict sc, double T)
 
 void comp_k_f(double * restrict tc, double invT, double * restrict k_f)
 {
+    double x[289];
 #ifdef __INTEL_COMPILER
     #pragma simd
 #endif
     for (int i=0; i<289; ++i) {
-        k_f[i] = prefactor_units[i] * fwd_A[i]
-                    * exp(fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT);
+        x[i] = fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT;
+    };
+
+    /*the exp is skipped when the exponent is zero or that of */
+    /*an earlier reaction with the same default beta and Ea */
+    k_f[0] = exp(x[0]);
+    k_f[1] = exp(x[1]);
+    k_f[2] = exp(x[2]);
+    k_f[3] = (x[3] == 0.0 ? 1.0 : exp(x[3]));
+    k_f[4] = exp(x[4]);
+    k_f[5] = exp(x[5]);
+    k_f[6] = exp(x[6]);
+    k_f[7] = (x[7] == 0.0 ? 1.0 : exp(x[7]));
+    k_f[8] = exp(x[8]);
+    k_f[9] = exp(x[9]);
+    k_f[10] = exp(x[10]);
+    k_f[11] = exp(x[11]);
+    k_f[12] = (x[12] == 0.0 ? 1.0 : exp(x[12]));
+    k_f[13] = exp(x[13]);
+    k_f[14] = (x[14] == 0.0 ? 1.0 : exp(x[14]));
+    k_f[15] = exp(x[15]);
+    k_f[16] = exp(x[16]);
+    k_f[17] = exp(x[17]);
+    k_f[18] = (x[18] == 0.0 ? 1.0 : exp(x[18]));
+    k_f[19] = (x[19] == 0.0 ? 1.0 : exp(x[19]));
+    k_f[20] = exp(x[20]);
+    k_f[21] = exp(x[21]);
+    k_f[22] = exp(x[22]);
+    k_f[23] = (x[23] == x[22] ? k_f[22] : exp(x[23]));
+    k_f[24] = (x[24] == x[22] ? k_f[22] : exp(x[24]));
+    k_f[25] = exp(x[25]);
+    k_f[26] = exp(x[26]);
+    k_f[27] = exp(x[27]);
+    k_f[28] = (x[28] == x[26] ? k_f[26] : exp(x[28]));
+    k_f[29] = (x[29] == x[26] ? k_f[26] : exp(x[29]));
+    k_f[30] = exp(x[30]);
+    k_f[31] = exp(x[31]);
+    k_f[32] = exp(x[32]);
+    k_f[33] = exp(x[33]);
+    k_f[34] = exp(x[34]);
+    k_f[35] = exp(x[35]);
+    k_f[36] = exp(x[36]);
+    k_f[37] = exp(x[37]);
+    k_f[38] = exp(x[38]);
+    k_f[39] = (x[39] == 0.0 ? 1.0 : exp(x[39]));
+    k_f[40] = exp(x[40]);
+    k_f[41] = exp(x[41]);
+    k_f[42] = exp(x[42]);
+    k_f[43] = exp(x[43]);
+    k_f[44] = exp(x[44]);
+    k_f[45] = exp(x[45]);
+    k_f[46] = exp(x[46]);
+    k_f[47] = exp(x[47]);
+    k_f[48] = exp(x[48]);
+    k_f[49] = exp(x[49]);
+    k_f[50] = exp(x[50]);
+    k_f[51] = exp(x[51]);
+    k_f[52] = (x[52] == 0.0 ? 1.0 : exp(x[52]));
+    k_f[53] = (x[53] == 0.0 ? 1.0 : exp(x[53]));
+    k_f[54] = (x[54] == 0.0 ? 1.0 : exp(x[54]));
+    k_f[55] = (x[55] == 0.0 ? 1.0 : exp(x[55]));
+    k_f[56] = (x[56] == x[30] ? k_f[30] : exp(x[56]));
+    k_f[57] = exp(x[57]);
+    k_f[58] = (x[58] == 0.0 ? 1.0 : exp(x[58]));
+    k_f[59] = (x[59] == 0.0 ? 1.0 : exp(x[59]));
+    k_f[60] = exp(x[60]);
+    k_f[61] = exp(x[61]);
+    k_f[62] = (x[62] == 0.0 ? 1.0 : exp(x[62]));
+    k_f[63] = exp(x[63]);
+    k_f[64] = (x[64] == 0.0 ? 1.0 : exp(x[64]));
+    k_f[65] = (x[65] == 0.0 ? 1.0 : exp(x[65]));
+    k_f[66] = exp(x[66]);
+    k_f[67] = exp(x[67]);
+    k_f[68] = exp(x[68]);
+    k_f[69] = (x[69] == x[68] ? k_f[68] : exp(x[69]));
+    k_f[70] = (x[70] == 0.0 ? 1.0 : exp(x[70]));
+    k_f[71] = exp(x[71]);
+    k_f[72] = (x[72] == 0.0 ? 1.0 : exp(x[72]));
+    k_f[73] = (x[73] == 0.0 ? 1.0 : exp(x[73]));
+    k_f[74] = (x[74] == 0.0 ? 1.0 : exp(x[74]));
+    k_f[75] = (x[75] == 0.0 ? 1.0 : exp(x[75]));
+    k_f[76] = (x[76] == 0.0 ? 1.0 : exp(x[76]));
+    k_f[77] = (x[77] == 0.0 ? 1.0 : exp(x[77]));
+    k_f[78] = (x[78] == 0.0 ? 1.0 : exp(x[78]));
+    k_f[79] = (x[79] == 0.0 ? 1.0 : exp(x[79]));
+    k_f[80] = (x[80] == 0.0 ? 1.0 : exp(x[80]));
+    k_f[81] = exp(x[81]);
+    k_f[82] = exp(x[82]);
+    k_f[83] = exp(x[83]);
+    k_f[84] = exp(x[84]);
+    k_f[85] = exp(x[85]);
+    k_f[86] = exp(x[86]);
+    k_f[87] = (x[87] == 0.0 ? 1.0 : exp(x[87]));
+    k_f[88] = exp(x[88]);
+    k_f[89] = (x[89] == 0.0 ? 1.0 : exp(x[89]));
+    k_f[90] = exp(x[90]);
+    k_f[91] = exp(x[91]);
+    k_f[92] = (x[92] == 0.0 ? 1.0 : exp(x[92]));
+    k_f[93] = (x[93] == 0.0 ? 1.0 : exp(x[93]));
+    k_f[94] = (x[94] == 0.0 ? 1.0 : exp(x[94]));
+    k_f[95] = (x[95] == 0.0 ? 1.0 : exp(x[95]));
+    k_f[96] = exp(x[96]);
+    k_f[97] = (x[97] == 0.0 ? 1.0 : exp(x[97]));
+    k_f[98] = exp(x[98]);
+    k_f[99] = (x[99] == 0.0 ? 1.0 : exp(x[99]));
+    k_f[100] = (x[100] == 0.0 ? 1.0 : exp(x[100]));
+    k_f[101] = (x[101] == 0.0 ? 1.0 : exp(x[101]));
+    k_f[102] = (x[102] == 0.0 ? 1.0 : exp(x[102]));
+    k_f[103] = (x[103] == 0.0 ? 1.0 : exp(x[103]));
+    k_f[104] = exp(x[104]);
+    k_f[105] = (x[105] == 0.0 ? 1.0 : exp(x[105]));
+    k_f[106] = (x[106] == 0.0 ? 1.0 : exp(x[106]));
+    k_f[107] = (x[107] == 0.0 ? 1.0 : exp(x[107]));
+    k_f[108] = exp(x[108]);
+    k_f[109] = exp(x[109]);
+    k_f[110] = exp(x[110]);
+    k_f[111] = exp(x[111]);
+    k_f[112] = (x[112] == 0.0 ? 1.0 : exp(x[112]));
+    k_f[113] = exp(x[113]);
+    k_f[114] = exp(x[114]);
+    k_f[115] = exp(x[115]);
+    k_f[116] = (x[116] == x[115] ? k_f[115] : exp(x[116]));
+    k_f[117] = exp(x[117]);
+    k_f[118] = exp(x[118]);
+    k_f[119] = exp(x[119]);
+    k_f[120] = (x[120] == 0.0 ? 1.0 : exp(x[120]));
+    k_f[121] = (x[121] == 0.0 ? 1.0 : exp(x[121]));
+    k_f[122] = (x[122] == x[68] ? k_f[68] : exp(x[122]));
+    k_f[123] = exp(x[123]);
+    k_f[124] = (x[124] == 0.0 ? 1.0 : exp(x[124]));
+    k_f[125] = (x[125] == 0.0 ? 1.0 : exp(x[125]));
+    k_f[126] = exp(x[126]);
+    k_f[127] = exp(x[127]);
+    k_f[128] = exp(x[128]);
+    k_f[129] = (x[129] == x[128] ? k_f[128] : exp(x[129]));
+    k_f[130] = exp(x[130]);
+    k_f[131] = exp(x[131]);
+    k_f[132] = exp(x[132]);
+    k_f[133] = exp(x[133]);
+    k_f[134] = exp(x[134]);
+    k_f[135] = (x[135] == 0.0 ? 1.0 : exp(x[135]));
+    k_f[136] = (x[136] == 0.0 ? 1.0 : exp(x[136]));
+    k_f[137] = exp(x[137]);
+    k_f[138] = exp(x[138]);
+    k_f[139] = (x[139] == x[85] ? k_f[85] : exp(x[139]));
+    k_f[140] = exp(x[140]);
+    k_f[141] = exp(x[141]);
+    k_f[142] = (x[142] == 0.0 ? 1.0 : exp(x[142]));
+    k_f[143] = (x[143] == 0.0 ? 1.0 : exp(x[143]));
+    k_f[144] = (x[144] == 0.0 ? 1.0 : exp(x[144]));
+    k_f[145] = (x[145] == 0.0 ? 1.0 : exp(x[145]));
+    k_f[146] = exp(x[146]);
+    k_f[147] = exp(x[147]);
+    k_f[148] = exp(x[148]);
+    k_f[149] = (x[149] == 0.0 ? 1.0 : exp(x[149]));
+    k_f[150] = (x[150] == 0.0 ? 1.0 : exp(x[150]));
+    k_f[151] = (x[151] == 0.0 ? 1.0 : exp(x[151]));
+    k_f[152] = exp(x[152]);
+    k_f[153] = exp(x[153]);
+    k_f[154] = (x[154] == 0.0 ? 1.0 : exp(x[154]));
+    k_f[155] = (x[155] == 0.0 ? 1.0 : exp(x[155]));
+    k_f[156] = exp(x[156]);
+    k_f[157] = (x[157] == x[141] ? k_f[141] : exp(x[157]));
+    k_f[158] = (x[158] == 0.0 ? 1.0 : exp(x[158]));
+    k_f[159] = (x[159] == 0.0 ? 1.0 : exp(x[159]));
+    k_f[160] = (x[160] == 0.0 ? 1.0 : exp(x[160]));
+    k_f[161] = (x[161] == 0.0 ? 1.0 : exp(x[161]));
+    k_f[162] = exp(x[162]);
+    k_f[163] = exp(x[163]);
+    k_f[164] = exp(x[164]);
+    k_f[165] = exp(x[165]);
+    k_f[166] = exp(x[166]);
+    k_f[167] = exp(x[167]);
+    k_f[168] = exp(x[168]);
+    k_f[169] = (x[169] == x[168] ? k_f[168] : exp(x[169]));
+    k_f[170] = exp(x[170]);
+    k_f[171] = exp(x[171]);
+    k_f[172] = (x[172] == 0.0 ? 1.0 : exp(x[172]));
+    k_f[173] = (x[173] == 0.0 ? 1.0 : exp(x[173]));
+    k_f[174] = exp(x[174]);
+    k_f[175] = (x[175] == 0.0 ? 1.0 : exp(x[175]));
+    k_f[176] = exp(x[176]);
+    k_f[177] = exp(x[177]);
+    k_f[178] = exp(x[178]);
+    k_f[179] = (x[179] == 0.0 ? 1.0 : exp(x[179]));
+    k_f[180] = (x[180] == 0.0 ? 1.0 : exp(x[180]));
+    k_f[181] = (x[181] == 0.0 ? 1.0 : exp(x[181]));
+    k_f[182] = (x[182] == 0.0 ? 1.0 : exp(x[182]));
+    k_f[183] = (x[183] == 0.0 ? 1.0 : exp(x[183]));
+    k_f[184] = (x[184] == 0.0 ? 1.0 : exp(x[184]));
+    k_f[185] = (x[185] == 0.0 ? 1.0 : exp(x[185]));
+    k_f[186] = exp(x[186]);
+    k_f[187] = exp(x[187]);
+    k_f[188] = exp(x[188]);
+    k_f[189] = exp(x[189]);
+    k_f[190] = exp(x[190]);
+    k_f[191] = exp(x[191]);
+    k_f[192] = (x[192] == 0.0 ? 1.0 : exp(x[192]));
+    k_f[193] = (x[193] == 0.0 ? 1.0 : exp(x[193]));
+    k_f[194] = exp(x[194]);
+    k_f[195] = (x[195] == 0.0 ? 1.0 : exp(x[195]));
+    k_f[196] = exp(x[196]);
+    k_f[197] = exp(x[197]);
+    k_f[198] = exp(x[198]);
+    k_f[199] = exp(x[199]);
+    k_f[200] = exp(x[200]);
+    k_f[201] = exp(x[201]);
+    k_f[202] = exp(x[202]);
+    k_f[203] = exp(x[203]);
+    k_f[204] = exp(x[204]);
+    k_f[205] = (x[205] == 0.0 ? 1.0 : exp(x[205]));
+    k_f[206] = (x[206] == 0.0 ? 1.0 : exp(x[206]));
+    k_f[207] = exp(x[207]);
+    k_f[208] = (x[208] == 0.0 ? 1.0 : exp(x[208]));
+    k_f[209] = (x[209] == 0.0 ? 1.0 : exp(x[209]));
+    k_f[210] = (x[210] == 0.0 ? 1.0 : exp(x[210]));
+    k_f[211] = (x[211] == 0.0 ? 1.0 : exp(x[211]));
+    k_f[212] = exp(x[212]);
+    k_f[213] = (x[213] == 0.0 ? 1.0 : exp(x[213]));
+    k_f[214] = (x[214] == 0.0 ? 1.0 : exp(x[214]));
+    k_f[215] = exp(x[215]);
+    k_f[216] = exp(x[216]);
+    k_f[217] = exp(x[217]);
+    k_f[218] = exp(x[218]);
+    k_f[219] = (x[219] == x[218] ? k_f[218] : exp(x[219]));
+    k_f[220] = exp(x[220]);
+    k_f[221] = exp(x[221]);
+    k_f[222] = exp(x[222]);
+    k_f[223] = exp(x[223]);
+    k_f[224] = exp(x[224]);
+    k_f[225] = exp(x[225]);
+    k_f[226] = (x[226] == x[82] ? k_f[82] : exp(x[226]));
+    k_f[227] = exp(x[227]);
+    k_f[228] = exp(x[228]);
+    k_f[229] = (x[229] == 0.0 ? 1.0 : exp(x[229]));
+    k_f[230] = (x[230] == 0.0 ? 1.0 : exp(x[230]));
+    k_f[231] = (x[231] == 0.0 ? 1.0 : exp(x[231]));
+    k_f[232] = (x[232] == 0.0 ? 1.0 : exp(x[232]));
+    k_f[233] = exp(x[233]);
+    k_f[234] = exp(x[234]);
+    k_f[235] = (x[235] == 0.0 ? 1.0 : exp(x[235]));
+    k_f[236] = (x[236] == 0.0 ? 1.0 : exp(x[236]));
+    k_f[237] = (x[237] == 0.0 ? 1.0 : exp(x[237]));
+    k_f[238] = (x[238] == 0.0 ? 1.0 : exp(x[238]));
+    k_f[239] = exp(x[239]);
+    k_f[240] = (x[240] == 0.0 ? 1.0 : exp(x[240]));
+    k_f[241] = exp(x[241]);
+    k_f[242] = exp(x[242]);
+    k_f[243] = exp(x[243]);
+    k_f[244] = (x[244] == x[241] ? k_f[241] : exp(x[244]));
+    k_f[245] = exp(x[245]);
+    k_f[246] = exp(x[246]);
+    k_f[247] = exp(x[247]);
+    k_f[248] = (x[248] == 0.0 ? 1.0 : exp(x[248]));
+    k_f[249] = (x[249] == 0.0 ? 1.0 : exp(x[249]));
+    k_f[250] = (x[250] == x[215] ? k_f[215] : exp(x[250]));
+    k_f[251] = (x[251] == x[215] ? k_f[215] : exp(x[251]));
+    k_f[252] = exp(x[252]);
+    k_f[253] = exp(x[253]);
+    k_f[254] = exp(x[254]);
+    k_f[255] = (x[255] == 0.0 ? 1.0 : exp(x[255]));
+    k_f[256] = (x[256] == 0.0 ? 1.0 : exp(x[256]));
+    k_f[257] = (x[257] == 0.0 ? 1.0 : exp(x[257]));
+    k_f[258] = (x[258] == 0.0 ? 1.0 : exp(x[258]));
+    k_f[259] = exp(x[259]);
+    k_f[260] = exp(x[260]);
+    k_f[261] = (x[261] == x[252] ? k_f[252] : exp(x[261]));
+    k_f[262] = exp(x[262]);
+    k_f[263] = (x[263] == x[262] ? k_f[262] : exp(x[263]));
+    k_f[264] = (x[264] == x[262] ? k_f[262] : exp(x[264]));
+    k_f[265] = (x[265] == x[262] ? k_f[262] : exp(x[265]));
+    k_f[266] = exp(x[266]);
+    k_f[267] = exp(x[267]);
+    k_f[268] = (x[268] == x[267] ? k_f[267] : exp(x[268]));
+    k_f[269] = (x[269] == x[267] ? k_f[267] : exp(x[269]));
+    k_f[270] = (x[270] == x[267] ? k_f[267] : exp(x[270]));
+    k_f[271] = exp(x[271]);
+    k_f[272] = exp(x[272]);
+    k_f[273] = (x[273] == x[272] ? k_f[272] : exp(x[273]));
+    k_f[274] = (x[274] == x[272] ? k_f[272] : exp(x[274]));
+    k_f[275] = (x[275] == x[272] ? k_f[272] : exp(x[275]));
+    k_f[276] = exp(x[276]);
+    k_f[277] = exp(x[277]);
+    k_f[278] = (x[278] == x[277] ? k_f[277] : exp(x[278]));
+    k_f[279] = (x[279] == x[277] ? k_f[277] : exp(x[279]));
+    k_f[280] = (x[280] == x[277] ? k_f[277] : exp(x[280]));
+    k_f[281] = (x[281] == x[215] ? k_f[215] : exp(x[281]));
+    k_f[282] = (x[282] == x[252] ? k_f[252] : exp(x[282]));
+    k_f[283] = (x[283] == x[215] ? k_f[215] : exp(x[283]));
+    k_f[284] = (x[284] == x[252] ? k_f[252] : exp(x[284]));
+    k_f[285] = exp(x[285]);
+    k_f[286] = (x[286] == 0.0 ? 1.0 : exp(x[286]));
+    k_f[287] = (x[287] == x[253] ? k_f[253] : exp(x[287]));
+    k_f[288] = (x[288] == x[253] ? k_f[253] : exp(x[288]));
+
+#ifdef __INTEL_COMPILER
+    #pragma simd
+#endif
+    for (int i=0; i<289; ++i) {
+        k_f[i] *= prefactor_units[i] * fwd_A[i];
     };
     return;
 }
@@ -15813,394 +16278,696 @@ void comp_Kc(double * restrict tc, double invT, double * restrict Kc)
     double g_RT[56];
     gibbs(g_RT, tc);
 
-    Kc[0] = g_RT[0] - g_RT[3] + g_RT[7];
-    Kc[1] = 2*g_RT[2] - g_RT[6];
-    Kc[2] = g_RT[9] + g_RT[18] - g_RT[27];
-    Kc[3] = g_RT[5] + g_RT[10] - g_RT[17];
-    Kc[4] = g_RT[0] + g_RT[14] - g_RT[16];
-    Kc[5] = g_RT[0] + g_RT[14] - g_RT[15];
-    Kc[6] = g_RT[0] + g_RT[11] - g_RT[12];
-    Kc[7] = g_RT[2] + g_RT[11] - g_RT[17];
-    Kc[8] = 2*g_RT[11] - g_RT[25];
-    Kc[9] = -g_RT[0] - g_RT[21] + g_RT[22];
-    Kc[10] = g_RT[0] + g_RT[27] - g_RT[29];
-    Kc[11] = g_RT[0] + g_RT[22] - g_RT[23];
-    Kc[12] = g_RT[11] + g_RT[22] - g_RT[36];
-    Kc[13] = g_RT[11] + g_RT[18] - g_RT[28];
-    Kc[14] = g_RT[11] + g_RT[13] - g_RT[30];
-    Kc[15] = -g_RT[4] - g_RT[21] + g_RT[23];
-    Kc[16] = g_RT[0] + g_RT[23] - g_RT[24];
-    Kc[17] = g_RT[0] + g_RT[24] - g_RT[25];
-    Kc[18] = g_RT[22] + g_RT[24] - g_RT[49];
-    Kc[19] = g_RT[0] + g_RT[34] - g_RT[36];
-    Kc[20] = g_RT[11] + g_RT[34] - g_RT[49];
-    Kc[21] = g_RT[0] + g_RT[36] - g_RT[37];
-    Kc[22] = g_RT[0] + g_RT[36] - g_RT[38];
-    Kc[23] = g_RT[0] - g_RT[36] - g_RT[37] + g_RT[52];
-    Kc[24] = g_RT[0] - g_RT[24] - g_RT[36] + g_RT[54];
-    Kc[25] = g_RT[1] + g_RT[18] - g_RT[19];
-    Kc[26] = 2*g_RT[0] - g_RT[4];
-    Kc[27] = g_RT[0] + g_RT[2] - g_RT[5];
-    Kc[28] = g_RT[0] + g_RT[1] - g_RT[2];
-    Kc[29] = 2*g_RT[1] - g_RT[7];
-    Kc[30] = -g_RT[0] + g_RT[13] - g_RT[18];
-    Kc[31] = g_RT[0] - g_RT[1] - g_RT[2] + g_RT[7];
-    Kc[32] = -g_RT[0] + g_RT[1] - g_RT[2] + g_RT[4];
-    Kc[33] = -g_RT[0] + g_RT[2] + g_RT[4] - g_RT[5];
-    Kc[34] = -g_RT[1] + 2*g_RT[2] - g_RT[5];
-    Kc[35] = 2*g_RT[0] - g_RT[4] + g_RT[5] - g_RT[5];
-    Kc[36] = -g_RT[0] - g_RT[3] + g_RT[4] + g_RT[7];
-    Kc[37] = g_RT[0] - g_RT[1] + g_RT[3] - g_RT[5];
-    Kc[38] = g_RT[0] - 2*g_RT[2] + g_RT[3];
-    Kc[39] = g_RT[1] - g_RT[2] + g_RT[3] - g_RT[7];
-    Kc[40] = g_RT[2] + g_RT[3] - g_RT[5] - g_RT[7];
-    Kc[41] = g_RT[2] + g_RT[3] - g_RT[5] - g_RT[7];
-    Kc[42] = 2*g_RT[3] - g_RT[6] - g_RT[7];
-    Kc[43] = 2*g_RT[3] - g_RT[6] - g_RT[7];
-    Kc[44] = g_RT[0] - g_RT[3] - g_RT[4] + g_RT[6];
-    Kc[45] = g_RT[0] - g_RT[2] - g_RT[5] + g_RT[6];
-    Kc[46] = g_RT[1] - g_RT[2] - g_RT[3] + g_RT[6];
-    Kc[47] = g_RT[2] - g_RT[3] - g_RT[5] + g_RT[6];
-    Kc[48] = g_RT[2] - g_RT[3] - g_RT[5] + g_RT[6];
-    Kc[49] = -g_RT[0] + g_RT[2] + g_RT[18] - g_RT[19];
-    Kc[50] = -g_RT[0] + g_RT[2] + g_RT[18] - g_RT[19];
-    Kc[51] = -g_RT[2] + g_RT[3] + g_RT[18] - g_RT[19];
-    Kc[52] = g_RT[0] - g_RT[4] + g_RT[13] - g_RT[18];
-    Kc[53] = g_RT[1] - g_RT[2] + g_RT[13] - g_RT[18];
-    Kc[54] = -g_RT[0] + g_RT[1] + g_RT[13] - g_RT[19];
-    Kc[55] = g_RT[2] - g_RT[5] + g_RT[13] - g_RT[18];
-    Kc[56] = -g_RT[0] + g_RT[5] - g_RT[5] + g_RT[13] - g_RT[18];
-    Kc[57] = -g_RT[3] + g_RT[7] + g_RT[13] - g_RT[18];
-    Kc[58] = -g_RT[0] + g_RT[1] + g_RT[8] - g_RT[18];
-    Kc[59] = -g_RT[0] + g_RT[2] + g_RT[8] - g_RT[13];
-    Kc[60] = -g_RT[0] + g_RT[4] + g_RT[8] - g_RT[9];
-    Kc[61] = -g_RT[0] + g_RT[5] + g_RT[8] - g_RT[14];
-    Kc[62] = -g_RT[1] + g_RT[7] + g_RT[8] - g_RT[13];
-    Kc[63] = g_RT[8] - g_RT[13] - g_RT[18] + g_RT[19];
-    Kc[64] = -g_RT[0] + g_RT[1] + g_RT[9] - g_RT[13];
-    Kc[65] = -g_RT[0] + g_RT[2] + g_RT[9] - g_RT[14];
-    Kc[66] = g_RT[2] - g_RT[5] - g_RT[8] + g_RT[9];
-    Kc[67] = -g_RT[0] + g_RT[4] + g_RT[9] - g_RT[11];
-    Kc[68] = -g_RT[2] + g_RT[7] + g_RT[9] - g_RT[13];
-    Kc[69] = -2*g_RT[0] + g_RT[7] + g_RT[9] - g_RT[19];
-    Kc[70] = -g_RT[2] + g_RT[3] + g_RT[9] - g_RT[14];
-    Kc[71] = -g_RT[9] + g_RT[10] + g_RT[55] - g_RT[55];
-    Kc[72] = g_RT[0] - g_RT[4] - g_RT[8] + g_RT[10];
-    Kc[73] = -g_RT[0] + g_RT[2] + g_RT[10] - g_RT[14];
-    Kc[74] = -g_RT[0] + g_RT[4] + g_RT[10] - g_RT[11];
-    Kc[75] = -g_RT[0] - g_RT[2] + g_RT[7] + g_RT[10] - g_RT[18];
-    Kc[76] = -g_RT[5] + g_RT[7] + g_RT[10] - g_RT[18];
-    Kc[77] = g_RT[5] - g_RT[5] - g_RT[9] + g_RT[10];
-    Kc[78] = -g_RT[9] + g_RT[10] + g_RT[18] - g_RT[18];
-    Kc[79] = -g_RT[9] + g_RT[10] + g_RT[19] - g_RT[19];
-    Kc[80] = g_RT[10] - g_RT[14] - g_RT[18] + g_RT[19];
-    Kc[81] = g_RT[0] - g_RT[4] - g_RT[13] + g_RT[14];
-    Kc[82] = g_RT[1] - g_RT[2] - g_RT[13] + g_RT[14];
-    Kc[83] = g_RT[2] - g_RT[5] - g_RT[13] + g_RT[14];
-    Kc[84] = -g_RT[3] + g_RT[7] - g_RT[13] + g_RT[14];
-    Kc[85] = g_RT[3] - g_RT[6] - g_RT[13] + g_RT[14];
-    Kc[86] = -g_RT[0] + g_RT[8] + g_RT[14] - g_RT[27];
-    Kc[87] = -g_RT[0] + g_RT[1] + g_RT[11] - g_RT[14];
-    Kc[88] = g_RT[2] - g_RT[5] - g_RT[9] + g_RT[11];
-    Kc[89] = g_RT[2] - g_RT[5] - g_RT[10] + g_RT[11];
-    Kc[90] = -g_RT[1] + g_RT[7] + g_RT[11] - g_RT[15];
-    Kc[91] = -g_RT[2] + g_RT[7] + g_RT[11] - g_RT[14];
-    Kc[92] = g_RT[3] - g_RT[7] + g_RT[11] - g_RT[12];
-    Kc[93] = -g_RT[2] + g_RT[3] + g_RT[11] - g_RT[15];
-    Kc[94] = -g_RT[0] + g_RT[8] + g_RT[11] - g_RT[22];
-    Kc[95] = g_RT[11] - g_RT[12] + g_RT[13] - g_RT[18];
-    Kc[96] = g_RT[11] - g_RT[12] - g_RT[13] + g_RT[14];
-    Kc[97] = -g_RT[0] + g_RT[9] + g_RT[11] - g_RT[23];
-    Kc[98] = -g_RT[0] + 2*g_RT[11] - g_RT[24];
-    Kc[99] = g_RT[11] - g_RT[18] - g_RT[23] + g_RT[26];
-    Kc[100] = g_RT[0] - g_RT[4] - g_RT[14] + g_RT[15];
-    Kc[101] = g_RT[0] - g_RT[2] - g_RT[11] + g_RT[15];
-    Kc[102] = g_RT[0] - g_RT[5] - g_RT[10] + g_RT[15];
-    Kc[103] = g_RT[2] - g_RT[5] - g_RT[14] + g_RT[15];
-    Kc[104] = -g_RT[3] + g_RT[7] - g_RT[14] + g_RT[15];
-    Kc[105] = g_RT[0] - g_RT[4] - g_RT[14] + g_RT[16];
-    Kc[106] = g_RT[0] - g_RT[2] - g_RT[11] + g_RT[16];
-    Kc[107] = g_RT[0] - g_RT[5] - g_RT[10] + g_RT[16];
-    Kc[108] = -g_RT[3] + g_RT[7] - g_RT[14] + g_RT[16];
-    Kc[109] = g_RT[0] - g_RT[4] - g_RT[11] + g_RT[12];
-    Kc[110] = g_RT[1] - g_RT[2] - g_RT[11] + g_RT[12];
-    Kc[111] = g_RT[2] - g_RT[5] - g_RT[11] + g_RT[12];
-    Kc[112] = -g_RT[0] + g_RT[8] + g_RT[12] - g_RT[23];
-    Kc[113] = g_RT[9] - 2*g_RT[11] + g_RT[12];
-    Kc[114] = g_RT[10] - 2*g_RT[11] + g_RT[12];
-    Kc[115] = g_RT[0] - g_RT[4] - g_RT[16] + g_RT[17];
-    Kc[116] = g_RT[0] - g_RT[4] - g_RT[15] + g_RT[17];
-    Kc[117] = g_RT[1] - g_RT[2] - g_RT[16] + g_RT[17];
-    Kc[118] = g_RT[2] - g_RT[5] - g_RT[16] + g_RT[17];
-    Kc[119] = g_RT[2] - g_RT[5] - g_RT[15] + g_RT[17];
-    Kc[120] = g_RT[1] - g_RT[8] - g_RT[18] + g_RT[20];
-    Kc[121] = -g_RT[0] + g_RT[2] + g_RT[20] - g_RT[26];
-    Kc[122] = g_RT[7] - g_RT[13] - g_RT[18] + g_RT[20];
-    Kc[123] = -g_RT[0] + g_RT[4] + g_RT[20] - g_RT[21];
-    Kc[124] = g_RT[0] - g_RT[10] - g_RT[18] + g_RT[26];
-    Kc[125] = -g_RT[0] + g_RT[1] - 2*g_RT[18] + g_RT[26];
-    Kc[126] = -g_RT[2] + g_RT[7] - 2*g_RT[18] + g_RT[26];
-    Kc[127] = g_RT[1] - g_RT[2] - g_RT[20] + g_RT[21];
-    Kc[128] = g_RT[1] - g_RT[9] - g_RT[18] + g_RT[21];
-    Kc[129] = -g_RT[0] + g_RT[1] + g_RT[21] - g_RT[26];
-    Kc[130] = -g_RT[0] + g_RT[2] + g_RT[21] - g_RT[27];
-    Kc[131] = -g_RT[0] + g_RT[2] + g_RT[21] - g_RT[27];
-    Kc[132] = g_RT[2] - g_RT[5] - g_RT[20] + g_RT[21];
-    Kc[133] = g_RT[13] - g_RT[18] + g_RT[21] - g_RT[22];
-    Kc[134] = -g_RT[0] + g_RT[9] + g_RT[21] - g_RT[31];
-    Kc[135] = -g_RT[0] + g_RT[10] + g_RT[21] - g_RT[31];
-    Kc[136] = -g_RT[0] + g_RT[20] + g_RT[21] - g_RT[40];
-    Kc[137] = -g_RT[0] + g_RT[11] + g_RT[21] - g_RT[32];
-    Kc[138] = -g_RT[0] + g_RT[11] + g_RT[21] - g_RT[33];
-    Kc[139] = g_RT[0] - g_RT[4] - g_RT[26] + g_RT[27];
-    Kc[140] = g_RT[0] - g_RT[11] - g_RT[18] + g_RT[27];
-    Kc[141] = g_RT[2] - g_RT[5] - g_RT[26] + g_RT[27];
-    Kc[142] = g_RT[0] - g_RT[4] - g_RT[21] + g_RT[22];
-    Kc[143] = -g_RT[0] + g_RT[1] + g_RT[22] - g_RT[27];
-    Kc[144] = g_RT[1] - g_RT[11] - g_RT[18] + g_RT[22];
-    Kc[145] = g_RT[2] - g_RT[5] - g_RT[21] + g_RT[22];
-    Kc[146] = -g_RT[3] + g_RT[7] - g_RT[21] + g_RT[22];
-    Kc[147] = -g_RT[1] + g_RT[7] + g_RT[22] - g_RT[29];
-    Kc[148] = g_RT[7] - g_RT[13] - g_RT[14] + g_RT[22];
-    Kc[149] = -g_RT[2] + g_RT[3] + g_RT[22] - g_RT[29];
-    Kc[150] = g_RT[13] - g_RT[18] + g_RT[22] - g_RT[23];
-    Kc[151] = g_RT[13] + g_RT[22] - g_RT[39];
-    Kc[152] = -g_RT[0] + g_RT[11] + g_RT[22] - g_RT[34];
-    Kc[153] = -g_RT[11] - g_RT[18] + g_RT[29];
-    Kc[154] = g_RT[0] - g_RT[0] - g_RT[28] + g_RT[29];
-    Kc[155] = g_RT[0] - g_RT[11] - g_RT[13] + g_RT[29];
-    Kc[156] = g_RT[0] - g_RT[4] - g_RT[27] + g_RT[29];
-    Kc[157] = g_RT[2] - g_RT[5] - g_RT[27] + g_RT[29];
-    Kc[158] = -g_RT[3] + g_RT[7] - g_RT[27] + g_RT[29];
-    Kc[159] = -g_RT[2] + g_RT[7] - g_RT[14] - g_RT[18] + g_RT[29];
-    Kc[160] = g_RT[0] - g_RT[11] - g_RT[13] + g_RT[28];
-    Kc[161] = -g_RT[2] + g_RT[3] - g_RT[11] - g_RT[19] + g_RT[28];
-    Kc[162] = g_RT[0] - g_RT[4] - g_RT[28] + g_RT[30];
-    Kc[163] = g_RT[2] - g_RT[5] - g_RT[28] + g_RT[30];
-    Kc[164] = g_RT[11] - g_RT[12] - g_RT[28] + g_RT[30];
-    Kc[165] = -g_RT[3] + g_RT[7] - g_RT[28] + g_RT[30];
-    Kc[166] = g_RT[0] - g_RT[4] - g_RT[22] + g_RT[23];
-    Kc[167] = g_RT[1] - g_RT[2] - g_RT[22] + g_RT[23];
-    Kc[168] = g_RT[1] - g_RT[11] - g_RT[13] + g_RT[23];
-    Kc[169] = g_RT[1] - g_RT[9] - g_RT[14] + g_RT[23];
-    Kc[170] = g_RT[2] - g_RT[5] - g_RT[22] + g_RT[23];
-    Kc[171] = g_RT[13] - g_RT[18] + g_RT[23] - g_RT[24];
-    Kc[172] = -g_RT[0] + g_RT[8] + g_RT[23] - g_RT[33];
-    Kc[173] = -g_RT[0] + g_RT[8] + g_RT[23] - g_RT[32];
-    Kc[174] = -g_RT[0] + g_RT[9] + g_RT[23] - g_RT[34];
-    Kc[175] = -g_RT[0] + g_RT[10] + g_RT[23] - g_RT[34];
-    Kc[176] = g_RT[11] - g_RT[12] - g_RT[22] + g_RT[23];
-    Kc[177] = g_RT[11] + g_RT[23] - g_RT[37];
-    Kc[178] = g_RT[22] + g_RT[23] - g_RT[48];
-    Kc[179] = g_RT[0] - g_RT[4] - g_RT[23] + g_RT[24];
-    Kc[180] = g_RT[1] - g_RT[11] - g_RT[14] + g_RT[24];
-    Kc[181] = -g_RT[0] + g_RT[1] + g_RT[24] - g_RT[30];
-    Kc[182] = -g_RT[3] + g_RT[7] - g_RT[23] + g_RT[24];
-    Kc[183] = g_RT[3] - g_RT[7] + g_RT[24] - g_RT[25];
-    Kc[184] = g_RT[3] - g_RT[6] - g_RT[23] + g_RT[24];
-    Kc[185] = -g_RT[2] + g_RT[3] - g_RT[11] - g_RT[14] + g_RT[24];
-    Kc[186] = -g_RT[11] + g_RT[22] + g_RT[24] - g_RT[34];
-    Kc[187] = g_RT[0] - g_RT[4] - g_RT[24] + g_RT[25];
-    Kc[188] = g_RT[1] - g_RT[2] - g_RT[24] + g_RT[25];
-    Kc[189] = g_RT[2] - g_RT[5] - g_RT[24] + g_RT[25];
-    Kc[190] = g_RT[10] - g_RT[11] - g_RT[24] + g_RT[25];
-    Kc[191] = g_RT[11] - g_RT[12] - g_RT[24] + g_RT[25];
-    Kc[192] = g_RT[0] + g_RT[31] - g_RT[32];
-    Kc[193] = g_RT[1] - g_RT[14] - g_RT[20] + g_RT[31];
-    Kc[194] = g_RT[7] - g_RT[13] - g_RT[27] + g_RT[31];
-    Kc[195] = g_RT[3] - g_RT[7] + g_RT[31] - g_RT[32];
-    Kc[196] = g_RT[0] + g_RT[33] - g_RT[35];
-    Kc[197] = g_RT[0] + g_RT[33] - g_RT[34];
-    Kc[198] = g_RT[1] - g_RT[18] - g_RT[23] + g_RT[33];
-    Kc[199] = g_RT[2] - g_RT[5] - g_RT[31] + g_RT[33];
-    Kc[200] = g_RT[32] - g_RT[33];
-    Kc[201] = g_RT[0] - g_RT[0] + g_RT[32] - g_RT[33];
-    Kc[202] = g_RT[0] + g_RT[32] - g_RT[35];
-    Kc[203] = g_RT[1] - g_RT[18] - g_RT[23] + g_RT[32];
-    Kc[204] = g_RT[2] - g_RT[5] - g_RT[31] + g_RT[32];
-    Kc[205] = g_RT[0] - g_RT[4] - g_RT[33] + g_RT[34];
-    Kc[206] = -g_RT[0] + g_RT[1] + g_RT[34] - g_RT[39];
-    Kc[207] = -2*g_RT[0] + g_RT[2] + g_RT[34] - g_RT[39];
-    Kc[208] = g_RT[2] - g_RT[5] - g_RT[33] + g_RT[34];
-    Kc[209] = g_RT[3] - g_RT[7] + g_RT[34] - g_RT[36];
-    Kc[210] = -g_RT[2] + g_RT[3] - g_RT[14] - g_RT[22] + g_RT[34];
-    Kc[211] = g_RT[13] - g_RT[18] + g_RT[34] - g_RT[36];
-    Kc[212] = g_RT[11] - g_RT[12] - g_RT[33] + g_RT[34];
-    Kc[213] = g_RT[7] - g_RT[14] - g_RT[28] + g_RT[35];
-    Kc[214] = -g_RT[2] + g_RT[3] - g_RT[11] - g_RT[27] + g_RT[35];
-    Kc[215] = g_RT[0] - g_RT[11] - g_RT[23] + g_RT[36];
-    Kc[216] = g_RT[0] - g_RT[4] - g_RT[34] + g_RT[36];
-    Kc[217] = g_RT[0] - g_RT[4] - g_RT[35] + g_RT[36];
-    Kc[218] = -g_RT[0] + g_RT[1] - g_RT[11] - g_RT[27] + g_RT[36];
-    Kc[219] = -2*g_RT[0] + g_RT[1] + g_RT[36] - g_RT[39];
-    Kc[220] = g_RT[1] - g_RT[13] - g_RT[24] + g_RT[36];
-    Kc[221] = g_RT[1] - g_RT[2] - g_RT[34] + g_RT[36];
-    Kc[222] = g_RT[1] - g_RT[2] - g_RT[35] + g_RT[36];
-    Kc[223] = g_RT[2] - g_RT[5] - g_RT[34] + g_RT[36];
-    Kc[224] = g_RT[2] - g_RT[5] - g_RT[35] + g_RT[36];
-    Kc[225] = g_RT[11] - g_RT[12] - g_RT[34] + g_RT[36];
-    Kc[226] = g_RT[1] - g_RT[2] - g_RT[18] - g_RT[22] + g_RT[39];
-    Kc[227] = g_RT[1] - g_RT[14] - g_RT[27] + g_RT[39];
-    Kc[228] = g_RT[0] - g_RT[11] - g_RT[24] + g_RT[38];
-    Kc[229] = g_RT[1] - g_RT[11] - g_RT[30] + g_RT[38];
-    Kc[230] = g_RT[2] - g_RT[5] - g_RT[36] + g_RT[38];
-    Kc[231] = -g_RT[3] + g_RT[7] - g_RT[36] + g_RT[38];
-    Kc[232] = -g_RT[2] + g_RT[3] - g_RT[11] - g_RT[30] + g_RT[38];
-    Kc[233] = g_RT[11] - g_RT[12] - g_RT[36] + g_RT[38];
-    Kc[234] = g_RT[0] - g_RT[11] - g_RT[24] + g_RT[37];
-    Kc[235] = g_RT[2] - g_RT[5] - g_RT[36] + g_RT[37];
-    Kc[236] = -g_RT[3] + g_RT[7] - g_RT[36] + g_RT[37];
-    Kc[237] = -g_RT[2] + g_RT[3] - g_RT[14] - g_RT[24] + g_RT[37];
-    Kc[238] = g_RT[11] - g_RT[12] - g_RT[36] + g_RT[37];
-    Kc[239] = g_RT[0] + g_RT[40] - g_RT[41];
-    Kc[240] = g_RT[0] - g_RT[4] - g_RT[40] + g_RT[41];
-    Kc[241] = g_RT[2] - g_RT[5] - g_RT[41] + g_RT[42];
-    Kc[242] = -g_RT[43] + g_RT[44];
-    Kc[243] = g_RT[0] - g_RT[22] - g_RT[23] + g_RT[45];
-    Kc[244] = g_RT[2] - g_RT[5] - g_RT[43] + g_RT[45];
-    Kc[245] = -g_RT[0] - g_RT[43] + g_RT[46];
-    Kc[246] = -g_RT[0] - g_RT[44] + g_RT[47];
-    Kc[247] = -g_RT[0] - g_RT[45] + g_RT[48];
-    Kc[248] = -g_RT[3] + g_RT[7] - g_RT[45] + g_RT[48];
-    Kc[249] = -g_RT[2] + g_RT[3] - g_RT[14] - g_RT[34] + g_RT[48];
-    Kc[250] = g_RT[0] - g_RT[23] - g_RT[24] + g_RT[49];
-    Kc[251] = g_RT[0] - g_RT[11] - g_RT[36] + g_RT[49];
-    Kc[252] = g_RT[0] - g_RT[4] - g_RT[48] + g_RT[49];
-    Kc[253] = g_RT[1] - g_RT[13] - g_RT[37] + g_RT[49];
-    Kc[254] = g_RT[23] + g_RT[24] - g_RT[50];
-    Kc[255] = g_RT[2] - g_RT[5] - g_RT[49] + g_RT[50];
-    Kc[256] = -g_RT[3] + g_RT[7] - g_RT[49] + g_RT[50];
-    Kc[257] = -g_RT[2] + g_RT[3] - g_RT[14] - g_RT[37] + g_RT[50];
-    Kc[258] = g_RT[11] - g_RT[12] - g_RT[49] + g_RT[50];
-    Kc[259] = -3*g_RT[23] - 2*g_RT[37] + g_RT[51];
-    Kc[260] = -2*g_RT[23] - 2*g_RT[50] + g_RT[51];
-    Kc[261] = g_RT[0] - g_RT[4] - 4*g_RT[23] - g_RT[50] + g_RT[51];
-    Kc[262] = g_RT[0] - g_RT[4] - 2*g_RT[23] - g_RT[49] - g_RT[50] + g_RT[51];
-    Kc[263] = g_RT[0] - g_RT[4] - g_RT[36] - g_RT[37] + g_RT[51] - g_RT[52];
-    Kc[264] = g_RT[0] - g_RT[4] - 2*g_RT[23] - g_RT[37] + g_RT[51] - g_RT[54];
-    Kc[265] = g_RT[0] - g_RT[4] - g_RT[23] - g_RT[50] + g_RT[51] - g_RT[52];
-    Kc[266] = g_RT[11] - g_RT[12] - 4*g_RT[23] - g_RT[50] + g_RT[51];
-    Kc[267] = g_RT[11] - g_RT[12] - 2*g_RT[23] - g_RT[49] - g_RT[50] + g_RT[51];
-    Kc[268] = g_RT[11] - g_RT[12] - g_RT[36] - g_RT[37] + g_RT[51] - g_RT[52];
-    Kc[269] = g_RT[11] - g_RT[12] - 2*g_RT[23] - g_RT[37] + g_RT[51] - g_RT[54];
-    Kc[270] = g_RT[11] - g_RT[12] - g_RT[23] - g_RT[50] + g_RT[51] - g_RT[52];
-    Kc[271] = g_RT[1] - g_RT[2] - 4*g_RT[23] - g_RT[50] + g_RT[51];
-    Kc[272] = g_RT[1] - g_RT[2] - 2*g_RT[23] - g_RT[49] - g_RT[50] + g_RT[51];
-    Kc[273] = g_RT[1] - g_RT[2] - g_RT[36] - g_RT[37] + g_RT[51] - g_RT[52];
-    Kc[274] = g_RT[1] - g_RT[2] - 2*g_RT[23] - g_RT[37] + g_RT[51] - g_RT[54];
-    Kc[275] = g_RT[1] - g_RT[2] - g_RT[23] - g_RT[50] + g_RT[51] - g_RT[52];
-    Kc[276] = g_RT[2] - g_RT[5] - 4*g_RT[23] - g_RT[50] + g_RT[51];
-    Kc[277] = g_RT[2] - g_RT[5] - 2*g_RT[23] - g_RT[49] - g_RT[50] + g_RT[51];
-    Kc[278] = g_RT[2] - g_RT[5] - g_RT[36] - g_RT[37] + g_RT[51] - g_RT[52];
-    Kc[279] = g_RT[2] - g_RT[5] - 2*g_RT[23] - g_RT[37] + g_RT[51] - g_RT[54];
-    Kc[280] = g_RT[2] - g_RT[5] - g_RT[23] - g_RT[50] + g_RT[51] - g_RT[52];
-    Kc[281] = g_RT[0] - g_RT[23] - g_RT[50] + g_RT[52];
-    Kc[282] = g_RT[0] - g_RT[4] + g_RT[52] - g_RT[53];
-    Kc[283] = g_RT[0] - g_RT[23] - g_RT[37] + g_RT[54];
-    Kc[284] = g_RT[0] - g_RT[4] - g_RT[23] - g_RT[34] + g_RT[54];
-    Kc[285] = g_RT[0] - g_RT[11] - g_RT[23] - g_RT[34] + g_RT[53];
-    Kc[286] = -g_RT[2] + g_RT[3] - g_RT[14] - g_RT[23] - g_RT[34] + g_RT[53];
-    Kc[287] = g_RT[1] - g_RT[13] - g_RT[23] - g_RT[37] + g_RT[52];
-    Kc[288] = g_RT[1] - g_RT[13] - g_RT[50] + g_RT[54];
-
-#ifdef __INTEL_COMPILER
-     #pragma simd
-#endif
-    for (int i=0; i<289; ++i) {
-        Kc[i] = exp(Kc[i]);
-    };
-
     /*reference concentration: P_atm / (RT) in inverse mol/m^3 */
     double refC = 101325 / 8.31451 * invT;
     double refCinv = 1 / refC;
 
-    Kc[0] *= refCinv;
-    Kc[1] *= refCinv;
-    Kc[2] *= refCinv;
-    Kc[3] *= refCinv;
-    Kc[4] *= refCinv;
-    Kc[5] *= refCinv;
-    Kc[6] *= refCinv;
-    Kc[7] *= refCinv;
-    Kc[8] *= refCinv;
-    Kc[9] *= refC;
-    Kc[10] *= refCinv;
-    Kc[11] *= refCinv;
-    Kc[12] *= refCinv;
-    Kc[13] *= refCinv;
-    Kc[14] *= refCinv;
-    Kc[15] *= refC;
-    Kc[16] *= refCinv;
-    Kc[17] *= refCinv;
-    Kc[18] *= refCinv;
-    Kc[19] *= refCinv;
-    Kc[20] *= refCinv;
-    Kc[21] *= refCinv;
-    Kc[22] *= refCinv;
-    Kc[25] *= refCinv;
-    Kc[26] *= refCinv;
-    Kc[27] *= refCinv;
-    Kc[28] *= refCinv;
-    Kc[29] *= refCinv;
-    Kc[30] *= refC;
-    Kc[35] *= refCinv;
-    Kc[56] *= refC;
-    Kc[69] *= refC;
-    Kc[75] *= refC;
-    Kc[125] *= refC;
-    Kc[126] *= refC;
-    Kc[151] *= refCinv;
-    Kc[153] *= refC;
-    Kc[159] *= refC;
-    Kc[161] *= refC;
-    Kc[177] *= refCinv;
-    Kc[178] *= refCinv;
-    Kc[185] *= refC;
-    Kc[192] *= refCinv;
-    Kc[196] *= refCinv;
-    Kc[197] *= refCinv;
-    Kc[202] *= refCinv;
-    Kc[207] *= refC;
-    Kc[210] *= refC;
-    Kc[214] *= refC;
-    Kc[218] *= refC;
-    Kc[219] *= refC;
-    Kc[226] *= refC;
-    Kc[232] *= refC;
-    Kc[237] *= refC;
-    Kc[239] *= refCinv;
-    Kc[245] *= refC;
-    Kc[246] *= refC;
-    Kc[247] *= refC;
-    Kc[249] *= refC;
-    Kc[254] *= refCinv;
-    Kc[257] *= refC;
-    Kc[259] *= refC*refC*refC*refC;
-    Kc[260] *= refC*refC*refC;
-    Kc[261] *= refC*refC*refC*refC;
-    Kc[262] *= refC*refC*refC;
-    Kc[263] *= refC*refC;
-    Kc[264] *= refC*refC*refC;
-    Kc[265] *= refC*refC;
-    Kc[266] *= refC*refC*refC*refC;
-    Kc[267] *= refC*refC*refC;
-    Kc[268] *= refC*refC;
-    Kc[269] *= refC*refC*refC;
-    Kc[270] *= refC*refC;
-    Kc[271] *= refC*refC*refC*refC;
-    Kc[272] *= refC*refC*refC;
-    Kc[273] *= refC*refC;
-    Kc[274] *= refC*refC*refC;
-    Kc[275] *= refC*refC;
-    Kc[276] *= refC*refC*refC*refC;
-    Kc[277] *= refC*refC*refC;
-    Kc[278] *= refC*refC;
-    Kc[279] *= refC*refC*refC;
-    Kc[280] *= refC*refC;
-    Kc[284] *= refC;
-    Kc[285] *= refC;
-    Kc[286] *= refC*refC;
-    Kc[287] *= refC;
+    /*Kc as the ratio of the products of the species exp(g_RT)/refC, unless */
+    /*the product over a side of a reaction leaves the normal range */
+    double e_g[56], den[289];
+    for (int k=0; k<56; ++k) {
+        e_g[k] = exp(g_RT[k]) * refCinv;
+    }
+    Kc[0] = e_g[0]*e_g[7]; den[0] = e_g[3];
+    Kc[1] = e_g[2]*e_g[2]; den[1] = e_g[6];
+    Kc[2] = e_g[9]*e_g[18]; den[2] = e_g[27];
+    Kc[3] = e_g[5]*e_g[10]; den[3] = e_g[17];
+    Kc[4] = e_g[0]*e_g[14]; den[4] = e_g[16];
+    Kc[5] = e_g[0]*e_g[14]; den[5] = e_g[15];
+    Kc[6] = e_g[0]*e_g[11]; den[6] = e_g[12];
+    Kc[7] = e_g[2]*e_g[11]; den[7] = e_g[17];
+    Kc[8] = e_g[11]*e_g[11]; den[8] = e_g[25];
+    Kc[9] = e_g[22]; den[9] = e_g[0]*e_g[21];
+    Kc[10] = e_g[0]*e_g[27]; den[10] = e_g[29];
+    Kc[11] = e_g[0]*e_g[22]; den[11] = e_g[23];
+    Kc[12] = e_g[11]*e_g[22]; den[12] = e_g[36];
+    Kc[13] = e_g[11]*e_g[18]; den[13] = e_g[28];
+    Kc[14] = e_g[11]*e_g[13]; den[14] = e_g[30];
+    Kc[15] = e_g[23]; den[15] = e_g[4]*e_g[21];
+    Kc[16] = e_g[0]*e_g[23]; den[16] = e_g[24];
+    Kc[17] = e_g[0]*e_g[24]; den[17] = e_g[25];
+    Kc[18] = e_g[22]*e_g[24]; den[18] = e_g[49];
+    Kc[19] = e_g[0]*e_g[34]; den[19] = e_g[36];
+    Kc[20] = e_g[11]*e_g[34]; den[20] = e_g[49];
+    Kc[21] = e_g[0]*e_g[36]; den[21] = e_g[37];
+    Kc[22] = e_g[0]*e_g[36]; den[22] = e_g[38];
+    Kc[23] = e_g[0]*e_g[52]; den[23] = e_g[36]*e_g[37];
+    Kc[24] = e_g[0]*e_g[54]; den[24] = e_g[24]*e_g[36];
+    Kc[25] = e_g[1]*e_g[18]; den[25] = e_g[19];
+    Kc[26] = e_g[0]*e_g[0]; den[26] = e_g[4];
+    Kc[27] = e_g[0]*e_g[2]; den[27] = e_g[5];
+    Kc[28] = e_g[0]*e_g[1]; den[28] = e_g[2];
+    Kc[29] = e_g[1]*e_g[1]; den[29] = e_g[7];
+    Kc[30] = e_g[13]; den[30] = e_g[0]*e_g[18];
+    Kc[31] = e_g[0]*e_g[7]; den[31] = e_g[1]*e_g[2];
+    Kc[32] = e_g[1]*e_g[4]; den[32] = e_g[0]*e_g[2];
+    Kc[33] = e_g[2]*e_g[4]; den[33] = e_g[0]*e_g[5];
+    Kc[34] = e_g[2]*e_g[2]; den[34] = e_g[1]*e_g[5];
+    Kc[35] = e_g[0]*e_g[0]*e_g[5]; den[35] = e_g[4]*e_g[5];
+    Kc[36] = e_g[4]*e_g[7]; den[36] = e_g[0]*e_g[3];
+    Kc[37] = e_g[0]*e_g[3]; den[37] = e_g[1]*e_g[5];
+    Kc[38] = e_g[0]*e_g[3]; den[38] = e_g[2]*e_g[2];
+    Kc[39] = e_g[1]*e_g[3]; den[39] = e_g[2]*e_g[7];
+    Kc[40] = e_g[2]*e_g[3]; den[40] = e_g[5]*e_g[7];
+    Kc[41] = e_g[2]*e_g[3]; den[41] = e_g[5]*e_g[7];
+    Kc[42] = e_g[3]*e_g[3]; den[42] = e_g[6]*e_g[7];
+    Kc[43] = e_g[3]*e_g[3]; den[43] = e_g[6]*e_g[7];
+    Kc[44] = e_g[0]*e_g[6]; den[44] = e_g[3]*e_g[4];
+    Kc[45] = e_g[0]*e_g[6]; den[45] = e_g[2]*e_g[5];
+    Kc[46] = e_g[1]*e_g[6]; den[46] = e_g[2]*e_g[3];
+    Kc[47] = e_g[2]*e_g[6]; den[47] = e_g[3]*e_g[5];
+    Kc[48] = e_g[2]*e_g[6]; den[48] = e_g[3]*e_g[5];
+    Kc[49] = e_g[2]*e_g[18]; den[49] = e_g[0]*e_g[19];
+    Kc[50] = e_g[2]*e_g[18]; den[50] = e_g[0]*e_g[19];
+    Kc[51] = e_g[3]*e_g[18]; den[51] = e_g[2]*e_g[19];
+    Kc[52] = e_g[0]*e_g[13]; den[52] = e_g[4]*e_g[18];
+    Kc[53] = e_g[1]*e_g[13]; den[53] = e_g[2]*e_g[18];
+    Kc[54] = e_g[1]*e_g[13]; den[54] = e_g[0]*e_g[19];
+    Kc[55] = e_g[2]*e_g[13]; den[55] = e_g[5]*e_g[18];
+    Kc[56] = e_g[5]*e_g[13]; den[56] = e_g[0]*e_g[5]*e_g[18];
+    Kc[57] = e_g[7]*e_g[13]; den[57] = e_g[3]*e_g[18];
+    Kc[58] = e_g[1]*e_g[8]; den[58] = e_g[0]*e_g[18];
+    Kc[59] = e_g[2]*e_g[8]; den[59] = e_g[0]*e_g[13];
+    Kc[60] = e_g[4]*e_g[8]; den[60] = e_g[0]*e_g[9];
+    Kc[61] = e_g[5]*e_g[8]; den[61] = e_g[0]*e_g[14];
+    Kc[62] = e_g[7]*e_g[8]; den[62] = e_g[1]*e_g[13];
+    Kc[63] = e_g[8]*e_g[19]; den[63] = e_g[13]*e_g[18];
+    Kc[64] = e_g[1]*e_g[9]; den[64] = e_g[0]*e_g[13];
+    Kc[65] = e_g[2]*e_g[9]; den[65] = e_g[0]*e_g[14];
+    Kc[66] = e_g[2]*e_g[9]; den[66] = e_g[5]*e_g[8];
+    Kc[67] = e_g[4]*e_g[9]; den[67] = e_g[0]*e_g[11];
+    Kc[68] = e_g[7]*e_g[9]; den[68] = e_g[2]*e_g[13];
+    Kc[69] = e_g[7]*e_g[9]; den[69] = e_g[0]*e_g[0]*e_g[19];
+    Kc[70] = e_g[3]*e_g[9]; den[70] = e_g[2]*e_g[14];
+    Kc[71] = e_g[10]*e_g[55]; den[71] = e_g[9]*e_g[55];
+    Kc[72] = e_g[0]*e_g[10]; den[72] = e_g[4]*e_g[8];
+    Kc[73] = e_g[2]*e_g[10]; den[73] = e_g[0]*e_g[14];
+    Kc[74] = e_g[4]*e_g[10]; den[74] = e_g[0]*e_g[11];
+    Kc[75] = e_g[7]*e_g[10]; den[75] = e_g[0]*e_g[2]*e_g[18];
+    Kc[76] = e_g[7]*e_g[10]; den[76] = e_g[5]*e_g[18];
+    Kc[77] = e_g[5]*e_g[10]; den[77] = e_g[5]*e_g[9];
+    Kc[78] = e_g[10]*e_g[18]; den[78] = e_g[9]*e_g[18];
+    Kc[79] = e_g[10]*e_g[19]; den[79] = e_g[9]*e_g[19];
+    Kc[80] = e_g[10]*e_g[19]; den[80] = e_g[14]*e_g[18];
+    Kc[81] = e_g[0]*e_g[14]; den[81] = e_g[4]*e_g[13];
+    Kc[82] = e_g[1]*e_g[14]; den[82] = e_g[2]*e_g[13];
+    Kc[83] = e_g[2]*e_g[14]; den[83] = e_g[5]*e_g[13];
+    Kc[84] = e_g[7]*e_g[14]; den[84] = e_g[3]*e_g[13];
+    Kc[85] = e_g[3]*e_g[14]; den[85] = e_g[6]*e_g[13];
+    Kc[86] = e_g[8]*e_g[14]; den[86] = e_g[0]*e_g[27];
+    Kc[87] = e_g[1]*e_g[11]; den[87] = e_g[0]*e_g[14];
+    Kc[88] = e_g[2]*e_g[11]; den[88] = e_g[5]*e_g[9];
+    Kc[89] = e_g[2]*e_g[11]; den[89] = e_g[5]*e_g[10];
+    Kc[90] = e_g[7]*e_g[11]; den[90] = e_g[1]*e_g[15];
+    Kc[91] = e_g[7]*e_g[11]; den[91] = e_g[2]*e_g[14];
+    Kc[92] = e_g[3]*e_g[11]; den[92] = e_g[7]*e_g[12];
+    Kc[93] = e_g[3]*e_g[11]; den[93] = e_g[2]*e_g[15];
+    Kc[94] = e_g[8]*e_g[11]; den[94] = e_g[0]*e_g[22];
+    Kc[95] = e_g[11]*e_g[13]; den[95] = e_g[12]*e_g[18];
+    Kc[96] = e_g[11]*e_g[14]; den[96] = e_g[12]*e_g[13];
+    Kc[97] = e_g[9]*e_g[11]; den[97] = e_g[0]*e_g[23];
+    Kc[98] = e_g[11]*e_g[11]; den[98] = e_g[0]*e_g[24];
+    Kc[99] = e_g[11]*e_g[26]; den[99] = e_g[18]*e_g[23];
+    Kc[100] = e_g[0]*e_g[15]; den[100] = e_g[4]*e_g[14];
+    Kc[101] = e_g[0]*e_g[15]; den[101] = e_g[2]*e_g[11];
+    Kc[102] = e_g[0]*e_g[15]; den[102] = e_g[5]*e_g[10];
+    Kc[103] = e_g[2]*e_g[15]; den[103] = e_g[5]*e_g[14];
+    Kc[104] = e_g[7]*e_g[15]; den[104] = e_g[3]*e_g[14];
+    Kc[105] = e_g[0]*e_g[16]; den[105] = e_g[4]*e_g[14];
+    Kc[106] = e_g[0]*e_g[16]; den[106] = e_g[2]*e_g[11];
+    Kc[107] = e_g[0]*e_g[16]; den[107] = e_g[5]*e_g[10];
+    Kc[108] = e_g[7]*e_g[16]; den[108] = e_g[3]*e_g[14];
+    Kc[109] = e_g[0]*e_g[12]; den[109] = e_g[4]*e_g[11];
+    Kc[110] = e_g[1]*e_g[12]; den[110] = e_g[2]*e_g[11];
+    Kc[111] = e_g[2]*e_g[12]; den[111] = e_g[5]*e_g[11];
+    Kc[112] = e_g[8]*e_g[12]; den[112] = e_g[0]*e_g[23];
+    Kc[113] = e_g[9]*e_g[12]; den[113] = e_g[11]*e_g[11];
+    Kc[114] = e_g[10]*e_g[12]; den[114] = e_g[11]*e_g[11];
+    Kc[115] = e_g[0]*e_g[17]; den[115] = e_g[4]*e_g[16];
+    Kc[116] = e_g[0]*e_g[17]; den[116] = e_g[4]*e_g[15];
+    Kc[117] = e_g[1]*e_g[17]; den[117] = e_g[2]*e_g[16];
+    Kc[118] = e_g[2]*e_g[17]; den[118] = e_g[5]*e_g[16];
+    Kc[119] = e_g[2]*e_g[17]; den[119] = e_g[5]*e_g[15];
+    Kc[120] = e_g[1]*e_g[20]; den[120] = e_g[8]*e_g[18];
+    Kc[121] = e_g[2]*e_g[20]; den[121] = e_g[0]*e_g[26];
+    Kc[122] = e_g[7]*e_g[20]; den[122] = e_g[13]*e_g[18];
+    Kc[123] = e_g[4]*e_g[20]; den[123] = e_g[0]*e_g[21];
+    Kc[124] = e_g[0]*e_g[26]; den[124] = e_g[10]*e_g[18];
+    Kc[125] = e_g[1]*e_g[26]; den[125] = e_g[0]*e_g[18]*e_g[18];
+    Kc[126] = e_g[7]*e_g[26]; den[126] = e_g[2]*e_g[18]*e_g[18];
+    Kc[127] = e_g[1]*e_g[21]; den[127] = e_g[2]*e_g[20];
+    Kc[128] = e_g[1]*e_g[21]; den[128] = e_g[9]*e_g[18];
+    Kc[129] = e_g[1]*e_g[21]; den[129] = e_g[0]*e_g[26];
+    Kc[130] = e_g[2]*e_g[21]; den[130] = e_g[0]*e_g[27];
+    Kc[131] = e_g[2]*e_g[21]; den[131] = e_g[0]*e_g[27];
+    Kc[132] = e_g[2]*e_g[21]; den[132] = e_g[5]*e_g[20];
+    Kc[133] = e_g[13]*e_g[21]; den[133] = e_g[18]*e_g[22];
+    Kc[134] = e_g[9]*e_g[21]; den[134] = e_g[0]*e_g[31];
+    Kc[135] = e_g[10]*e_g[21]; den[135] = e_g[0]*e_g[31];
+    Kc[136] = e_g[20]*e_g[21]; den[136] = e_g[0]*e_g[40];
+    Kc[137] = e_g[11]*e_g[21]; den[137] = e_g[0]*e_g[32];
+    Kc[138] = e_g[11]*e_g[21]; den[138] = e_g[0]*e_g[33];
+    Kc[139] = e_g[0]*e_g[27]; den[139] = e_g[4]*e_g[26];
+    Kc[140] = e_g[0]*e_g[27]; den[140] = e_g[11]*e_g[18];
+    Kc[141] = e_g[2]*e_g[27]; den[141] = e_g[5]*e_g[26];
+    Kc[142] = e_g[0]*e_g[22]; den[142] = e_g[4]*e_g[21];
+    Kc[143] = e_g[1]*e_g[22]; den[143] = e_g[0]*e_g[27];
+    Kc[144] = e_g[1]*e_g[22]; den[144] = e_g[11]*e_g[18];
+    Kc[145] = e_g[2]*e_g[22]; den[145] = e_g[5]*e_g[21];
+    Kc[146] = e_g[7]*e_g[22]; den[146] = e_g[3]*e_g[21];
+    Kc[147] = e_g[7]*e_g[22]; den[147] = e_g[1]*e_g[29];
+    Kc[148] = e_g[7]*e_g[22]; den[148] = e_g[13]*e_g[14];
+    Kc[149] = e_g[3]*e_g[22]; den[149] = e_g[2]*e_g[29];
+    Kc[150] = e_g[13]*e_g[22]; den[150] = e_g[18]*e_g[23];
+    Kc[151] = e_g[13]*e_g[22]; den[151] = e_g[39];
+    Kc[152] = e_g[11]*e_g[22]; den[152] = e_g[0]*e_g[34];
+    Kc[153] = e_g[29]; den[153] = e_g[11]*e_g[18];
+    Kc[154] = e_g[0]*e_g[29]; den[154] = e_g[0]*e_g[28];
+    Kc[155] = e_g[0]*e_g[29]; den[155] = e_g[11]*e_g[13];
+    Kc[156] = e_g[0]*e_g[29]; den[156] = e_g[4]*e_g[27];
+    Kc[157] = e_g[2]*e_g[29]; den[157] = e_g[5]*e_g[27];
+    Kc[158] = e_g[7]*e_g[29]; den[158] = e_g[3]*e_g[27];
+    Kc[159] = e_g[7]*e_g[29]; den[159] = e_g[2]*e_g[14]*e_g[18];
+    Kc[160] = e_g[0]*e_g[28]; den[160] = e_g[11]*e_g[13];
+    Kc[161] = e_g[3]*e_g[28]; den[161] = e_g[2]*e_g[11]*e_g[19];
+    Kc[162] = e_g[0]*e_g[30]; den[162] = e_g[4]*e_g[28];
+    Kc[163] = e_g[2]*e_g[30]; den[163] = e_g[5]*e_g[28];
+    Kc[164] = e_g[11]*e_g[30]; den[164] = e_g[12]*e_g[28];
+    Kc[165] = e_g[7]*e_g[30]; den[165] = e_g[3]*e_g[28];
+    Kc[166] = e_g[0]*e_g[23]; den[166] = e_g[4]*e_g[22];
+    Kc[167] = e_g[1]*e_g[23]; den[167] = e_g[2]*e_g[22];
+    Kc[168] = e_g[1]*e_g[23]; den[168] = e_g[11]*e_g[13];
+    Kc[169] = e_g[1]*e_g[23]; den[169] = e_g[9]*e_g[14];
+    Kc[170] = e_g[2]*e_g[23]; den[170] = e_g[5]*e_g[22];
+    Kc[171] = e_g[13]*e_g[23]; den[171] = e_g[18]*e_g[24];
+    Kc[172] = e_g[8]*e_g[23]; den[172] = e_g[0]*e_g[33];
+    Kc[173] = e_g[8]*e_g[23]; den[173] = e_g[0]*e_g[32];
+    Kc[174] = e_g[9]*e_g[23]; den[174] = e_g[0]*e_g[34];
+    Kc[175] = e_g[10]*e_g[23]; den[175] = e_g[0]*e_g[34];
+    Kc[176] = e_g[11]*e_g[23]; den[176] = e_g[12]*e_g[22];
+    Kc[177] = e_g[11]*e_g[23]; den[177] = e_g[37];
+    Kc[178] = e_g[22]*e_g[23]; den[178] = e_g[48];
+    Kc[179] = e_g[0]*e_g[24]; den[179] = e_g[4]*e_g[23];
+    Kc[180] = e_g[1]*e_g[24]; den[180] = e_g[11]*e_g[14];
+    Kc[181] = e_g[1]*e_g[24]; den[181] = e_g[0]*e_g[30];
+    Kc[182] = e_g[7]*e_g[24]; den[182] = e_g[3]*e_g[23];
+    Kc[183] = e_g[3]*e_g[24]; den[183] = e_g[7]*e_g[25];
+    Kc[184] = e_g[3]*e_g[24]; den[184] = e_g[6]*e_g[23];
+    Kc[185] = e_g[3]*e_g[24]; den[185] = e_g[2]*e_g[11]*e_g[14];
+    Kc[186] = e_g[22]*e_g[24]; den[186] = e_g[11]*e_g[34];
+    Kc[187] = e_g[0]*e_g[25]; den[187] = e_g[4]*e_g[24];
+    Kc[188] = e_g[1]*e_g[25]; den[188] = e_g[2]*e_g[24];
+    Kc[189] = e_g[2]*e_g[25]; den[189] = e_g[5]*e_g[24];
+    Kc[190] = e_g[10]*e_g[25]; den[190] = e_g[11]*e_g[24];
+    Kc[191] = e_g[11]*e_g[25]; den[191] = e_g[12]*e_g[24];
+    Kc[192] = e_g[0]*e_g[31]; den[192] = e_g[32];
+    Kc[193] = e_g[1]*e_g[31]; den[193] = e_g[14]*e_g[20];
+    Kc[194] = e_g[7]*e_g[31]; den[194] = e_g[13]*e_g[27];
+    Kc[195] = e_g[3]*e_g[31]; den[195] = e_g[7]*e_g[32];
+    Kc[196] = e_g[0]*e_g[33]; den[196] = e_g[35];
+    Kc[197] = e_g[0]*e_g[33]; den[197] = e_g[34];
+    Kc[198] = e_g[1]*e_g[33]; den[198] = e_g[18]*e_g[23];
+    Kc[199] = e_g[2]*e_g[33]; den[199] = e_g[5]*e_g[31];
+    Kc[200] = e_g[32]; den[200] = e_g[33];
+    Kc[201] = e_g[0]*e_g[32]; den[201] = e_g[0]*e_g[33];
+    Kc[202] = e_g[0]*e_g[32]; den[202] = e_g[35];
+    Kc[203] = e_g[1]*e_g[32]; den[203] = e_g[18]*e_g[23];
+    Kc[204] = e_g[2]*e_g[32]; den[204] = e_g[5]*e_g[31];
+    Kc[205] = e_g[0]*e_g[34]; den[205] = e_g[4]*e_g[33];
+    Kc[206] = e_g[1]*e_g[34]; den[206] = e_g[0]*e_g[39];
+    Kc[207] = e_g[2]*e_g[34]; den[207] = e_g[0]*e_g[0]*e_g[39];
+    Kc[208] = e_g[2]*e_g[34]; den[208] = e_g[5]*e_g[33];
+    Kc[209] = e_g[3]*e_g[34]; den[209] = e_g[7]*e_g[36];
+    Kc[210] = e_g[3]*e_g[34]; den[210] = e_g[2]*e_g[14]*e_g[22];
+    Kc[211] = e_g[13]*e_g[34]; den[211] = e_g[18]*e_g[36];
+    Kc[212] = e_g[11]*e_g[34]; den[212] = e_g[12]*e_g[33];
+    Kc[213] = e_g[7]*e_g[35]; den[213] = e_g[14]*e_g[28];
+    Kc[214] = e_g[3]*e_g[35]; den[214] = e_g[2]*e_g[11]*e_g[27];
+    Kc[215] = e_g[0]*e_g[36]; den[215] = e_g[11]*e_g[23];
+    Kc[216] = e_g[0]*e_g[36]; den[216] = e_g[4]*e_g[34];
+    Kc[217] = e_g[0]*e_g[36]; den[217] = e_g[4]*e_g[35];
+    Kc[218] = e_g[1]*e_g[36]; den[218] = e_g[0]*e_g[11]*e_g[27];
+    Kc[219] = e_g[1]*e_g[36]; den[219] = e_g[0]*e_g[0]*e_g[39];
+    Kc[220] = e_g[1]*e_g[36]; den[220] = e_g[13]*e_g[24];
+    Kc[221] = e_g[1]*e_g[36]; den[221] = e_g[2]*e_g[34];
+    Kc[222] = e_g[1]*e_g[36]; den[222] = e_g[2]*e_g[35];
+    Kc[223] = e_g[2]*e_g[36]; den[223] = e_g[5]*e_g[34];
+    Kc[224] = e_g[2]*e_g[36]; den[224] = e_g[5]*e_g[35];
+    Kc[225] = e_g[11]*e_g[36]; den[225] = e_g[12]*e_g[34];
+    Kc[226] = e_g[1]*e_g[39]; den[226] = e_g[2]*e_g[18]*e_g[22];
+    Kc[227] = e_g[1]*e_g[39]; den[227] = e_g[14]*e_g[27];
+    Kc[228] = e_g[0]*e_g[38]; den[228] = e_g[11]*e_g[24];
+    Kc[229] = e_g[1]*e_g[38]; den[229] = e_g[11]*e_g[30];
+    Kc[230] = e_g[2]*e_g[38]; den[230] = e_g[5]*e_g[36];
+    Kc[231] = e_g[7]*e_g[38]; den[231] = e_g[3]*e_g[36];
+    Kc[232] = e_g[3]*e_g[38]; den[232] = e_g[2]*e_g[11]*e_g[30];
+    Kc[233] = e_g[11]*e_g[38]; den[233] = e_g[12]*e_g[36];
+    Kc[234] = e_g[0]*e_g[37]; den[234] = e_g[11]*e_g[24];
+    Kc[235] = e_g[2]*e_g[37]; den[235] = e_g[5]*e_g[36];
+    Kc[236] = e_g[7]*e_g[37]; den[236] = e_g[3]*e_g[36];
+    Kc[237] = e_g[3]*e_g[37]; den[237] = e_g[2]*e_g[14]*e_g[24];
+    Kc[238] = e_g[11]*e_g[37]; den[238] = e_g[12]*e_g[36];
+    Kc[239] = e_g[0]*e_g[40]; den[239] = e_g[41];
+    Kc[240] = e_g[0]*e_g[41]; den[240] = e_g[4]*e_g[40];
+    Kc[241] = e_g[2]*e_g[42]; den[241] = e_g[5]*e_g[41];
+    Kc[242] = e_g[44]; den[242] = e_g[43];
+    Kc[243] = e_g[0]*e_g[45]; den[243] = e_g[22]*e_g[23];
+    Kc[244] = e_g[2]*e_g[45]; den[244] = e_g[5]*e_g[43];
+    Kc[245] = e_g[46]; den[245] = e_g[0]*e_g[43];
+    Kc[246] = e_g[47]; den[246] = e_g[0]*e_g[44];
+    Kc[247] = e_g[48]; den[247] = e_g[0]*e_g[45];
+    Kc[248] = e_g[7]*e_g[48]; den[248] = e_g[3]*e_g[45];
+    Kc[249] = e_g[3]*e_g[48]; den[249] = e_g[2]*e_g[14]*e_g[34];
+    Kc[250] = e_g[0]*e_g[49]; den[250] = e_g[23]*e_g[24];
+    Kc[251] = e_g[0]*e_g[49]; den[251] = e_g[11]*e_g[36];
+    Kc[252] = e_g[0]*e_g[49]; den[252] = e_g[4]*e_g[48];
+    Kc[253] = e_g[1]*e_g[49]; den[253] = e_g[13]*e_g[37];
+    Kc[254] = e_g[23]*e_g[24]; den[254] = e_g[50];
+    Kc[255] = e_g[2]*e_g[50]; den[255] = e_g[5]*e_g[49];
+    Kc[256] = e_g[7]*e_g[50]; den[256] = e_g[3]*e_g[49];
+    Kc[257] = e_g[3]*e_g[50]; den[257] = e_g[2]*e_g[14]*e_g[37];
+    Kc[258] = e_g[11]*e_g[50]; den[258] = e_g[12]*e_g[49];
+    Kc[259] = e_g[51]; den[259] = e_g[23]*e_g[23]*e_g[23]*e_g[37]*e_g[37];
+    Kc[260] = e_g[51]; den[260] = e_g[23]*e_g[23]*e_g[50]*e_g[50];
+    Kc[261] = e_g[0]*e_g[51]; den[261] = e_g[4]*e_g[23]*e_g[23]*e_g[23]*e_g[23]*e_g[50];
+    Kc[262] = e_g[0]*e_g[51]; den[262] = e_g[4]*e_g[23]*e_g[23]*e_g[49]*e_g[50];
+    Kc[263] = e_g[0]*e_g[51]; den[263] = e_g[4]*e_g[36]*e_g[37]*e_g[52];
+    Kc[264] = e_g[0]*e_g[51]; den[264] = e_g[4]*e_g[23]*e_g[23]*e_g[37]*e_g[54];
+    Kc[265] = e_g[0]*e_g[51]; den[265] = e_g[4]*e_g[23]*e_g[50]*e_g[52];
+    Kc[266] = e_g[11]*e_g[51]; den[266] = e_g[12]*e_g[23]*e_g[23]*e_g[23]*e_g[23]*e_g[50];
+    Kc[267] = e_g[11]*e_g[51]; den[267] = e_g[12]*e_g[23]*e_g[23]*e_g[49]*e_g[50];
+    Kc[268] = e_g[11]*e_g[51]; den[268] = e_g[12]*e_g[36]*e_g[37]*e_g[52];
+    Kc[269] = e_g[11]*e_g[51]; den[269] = e_g[12]*e_g[23]*e_g[23]*e_g[37]*e_g[54];
+    Kc[270] = e_g[11]*e_g[51]; den[270] = e_g[12]*e_g[23]*e_g[50]*e_g[52];
+    Kc[271] = e_g[1]*e_g[51]; den[271] = e_g[2]*e_g[23]*e_g[23]*e_g[23]*e_g[23]*e_g[50];
+    Kc[272] = e_g[1]*e_g[51]; den[272] = e_g[2]*e_g[23]*e_g[23]*e_g[49]*e_g[50];
+    Kc[273] = e_g[1]*e_g[51]; den[273] = e_g[2]*e_g[36]*e_g[37]*e_g[52];
+    Kc[274] = e_g[1]*e_g[51]; den[274] = e_g[2]*e_g[23]*e_g[23]*e_g[37]*e_g[54];
+    Kc[275] = e_g[1]*e_g[51]; den[275] = e_g[2]*e_g[23]*e_g[50]*e_g[52];
+    Kc[276] = e_g[2]*e_g[51]; den[276] = e_g[5]*e_g[23]*e_g[23]*e_g[23]*e_g[23]*e_g[50];
+    Kc[277] = e_g[2]*e_g[51]; den[277] = e_g[5]*e_g[23]*e_g[23]*e_g[49]*e_g[50];
+    Kc[278] = e_g[2]*e_g[51]; den[278] = e_g[5]*e_g[36]*e_g[37]*e_g[52];
+    Kc[279] = e_g[2]*e_g[51]; den[279] = e_g[5]*e_g[23]*e_g[23]*e_g[37]*e_g[54];
+    Kc[280] = e_g[2]*e_g[51]; den[280] = e_g[5]*e_g[23]*e_g[50]*e_g[52];
+    Kc[281] = e_g[0]*e_g[52]; den[281] = e_g[23]*e_g[50];
+    Kc[282] = e_g[0]*e_g[52]; den[282] = e_g[4]*e_g[53];
+    Kc[283] = e_g[0]*e_g[54]; den[283] = e_g[23]*e_g[37];
+    Kc[284] = e_g[0]*e_g[54]; den[284] = e_g[4]*e_g[23]*e_g[34];
+    Kc[285] = e_g[0]*e_g[53]; den[285] = e_g[11]*e_g[23]*e_g[34];
+    Kc[286] = e_g[3]*e_g[53]; den[286] = e_g[2]*e_g[14]*e_g[23]*e_g[34];
+    Kc[287] = e_g[1]*e_g[52]; den[287] = e_g[13]*e_g[23]*e_g[37];
+    Kc[288] = e_g[1]*e_g[54]; den[288] = e_g[13]*e_g[50];
+    int inrange = 1;
+    for (int i=0; i<289; ++i) {
+        inrange &= Kc[i] >= DBL_MIN && Kc[i] <= DBL_MAX && den[i] >= DBL_MIN && den[i] <= DBL_MAX;
+    }
+
+    if (inrange) {
+        for (int i=0; i<289; ++i) {
+            Kc[i] /= den[i];
+        }
+    }
+    else {
+        Kc[0] = exp(g_RT[0] - g_RT[3] + g_RT[7]);
+        Kc[1] = exp(2*g_RT[2] - g_RT[6]);
+        Kc[2] = exp(g_RT[9] + g_RT[18] - g_RT[27]);
+        Kc[3] = exp(g_RT[5] + g_RT[10] - g_RT[17]);
+        Kc[4] = exp(g_RT[0] + g_RT[14] - g_RT[16]);
+        Kc[5] = exp(g_RT[0] + g_RT[14] - g_RT[15]);
+        Kc[6] = exp(g_RT[0] + g_RT[11] - g_RT[12]);
+        Kc[7] = exp(g_RT[2] + g_RT[11] - g_RT[17]);
+        Kc[8] = exp(2*g_RT[11] - g_RT[25]);
+        Kc[9] = exp(-g_RT[0] - g_RT[21] + g_RT[22]);
+        Kc[10] = exp(g_RT[0] + g_RT[27] - g_RT[29]);
+        Kc[11] = exp(g_RT[0] + g_RT[22] - g_RT[23]);
+        Kc[12] = exp(g_RT[11] + g_RT[22] - g_RT[36]);
+        Kc[13] = exp(g_RT[11] + g_RT[18] - g_RT[28]);
+        Kc[14] = exp(g_RT[11] + g_RT[13] - g_RT[30]);
+        Kc[15] = exp(-g_RT[4] - g_RT[21] + g_RT[23]);
+        Kc[16] = exp(g_RT[0] + g_RT[23] - g_RT[24]);
+        Kc[17] = exp(g_RT[0] + g_RT[24] - g_RT[25]);
+        Kc[18] = exp(g_RT[22] + g_RT[24] - g_RT[49]);
+        Kc[19] = exp(g_RT[0] + g_RT[34] - g_RT[36]);
+        Kc[20] = exp(g_RT[11] + g_RT[34] - g_RT[49]);
+        Kc[21] = exp(g_RT[0] + g_RT[36] - g_RT[37]);
+        Kc[22] = exp(g_RT[0] + g_RT[36] - g_RT[38]);
+        Kc[23] = exp(g_RT[0] - g_RT[36] - g_RT[37] + g_RT[52]);
+        Kc[24] = exp(g_RT[0] - g_RT[24] - g_RT[36] + g_RT[54]);
+        Kc[25] = exp(g_RT[1] + g_RT[18] - g_RT[19]);
+        Kc[26] = exp(2*g_RT[0] - g_RT[4]);
+        Kc[27] = exp(g_RT[0] + g_RT[2] - g_RT[5]);
+        Kc[28] = exp(g_RT[0] + g_RT[1] - g_RT[2]);
+        Kc[29] = exp(2*g_RT[1] - g_RT[7]);
+        Kc[30] = exp(-g_RT[0] + g_RT[13] - g_RT[18]);
+        Kc[31] = exp(g_RT[0] - g_RT[1] - g_RT[2] + g_RT[7]);
+        Kc[32] = exp(-g_RT[0] + g_RT[1] - g_RT[2] + g_RT[4]);
+        Kc[33] = exp(-g_RT[0] + g_RT[2] + g_RT[4] - g_RT[5]);
+        Kc[34] = exp(-g_RT[1] + 2*g_RT[2] - g_RT[5]);
+        Kc[35] = exp(2*g_RT[0] - g_RT[4] + g_RT[5] - g_RT[5]);
+        Kc[36] = exp(-g_RT[0] - g_RT[3] + g_RT[4] + g_RT[7]);
+        Kc[37] = exp(g_RT[0] - g_RT[1] + g_RT[3] - g_RT[5]);
+        Kc[38] = exp(g_RT[0] - 2*g_RT[2] + g_RT[3]);
+        Kc[39] = exp(g_RT[1] - g_RT[2] + g_RT[3] - g_RT[7]);
+        Kc[40] = exp(g_RT[2] + g_RT[3] - g_RT[5] - g_RT[7]);
+        Kc[42] = exp(2*g_RT[3] - g_RT[6] - g_RT[7]);
+        Kc[44] = exp(g_RT[0] - g_RT[3] - g_RT[4] + g_RT[6]);
+        Kc[45] = exp(g_RT[0] - g_RT[2] - g_RT[5] + g_RT[6]);
+        Kc[46] = exp(g_RT[1] - g_RT[2] - g_RT[3] + g_RT[6]);
+        Kc[47] = exp(g_RT[2] - g_RT[3] - g_RT[5] + g_RT[6]);
+        Kc[49] = exp(-g_RT[0] + g_RT[2] + g_RT[18] - g_RT[19]);
+        Kc[51] = exp(-g_RT[2] + g_RT[3] + g_RT[18] - g_RT[19]);
+        Kc[52] = exp(g_RT[0] - g_RT[4] + g_RT[13] - g_RT[18]);
+        Kc[53] = exp(g_RT[1] - g_RT[2] + g_RT[13] - g_RT[18]);
+        Kc[54] = exp(-g_RT[0] + g_RT[1] + g_RT[13] - g_RT[19]);
+        Kc[55] = exp(g_RT[2] - g_RT[5] + g_RT[13] - g_RT[18]);
+        Kc[56] = exp(-g_RT[0] + g_RT[5] - g_RT[5] + g_RT[13] - g_RT[18]);
+        Kc[57] = exp(-g_RT[3] + g_RT[7] + g_RT[13] - g_RT[18]);
+        Kc[58] = exp(-g_RT[0] + g_RT[1] + g_RT[8] - g_RT[18]);
+        Kc[59] = exp(-g_RT[0] + g_RT[2] + g_RT[8] - g_RT[13]);
+        Kc[60] = exp(-g_RT[0] + g_RT[4] + g_RT[8] - g_RT[9]);
+        Kc[61] = exp(-g_RT[0] + g_RT[5] + g_RT[8] - g_RT[14]);
+        Kc[62] = exp(-g_RT[1] + g_RT[7] + g_RT[8] - g_RT[13]);
+        Kc[63] = exp(g_RT[8] - g_RT[13] - g_RT[18] + g_RT[19]);
+        Kc[64] = exp(-g_RT[0] + g_RT[1] + g_RT[9] - g_RT[13]);
+        Kc[65] = exp(-g_RT[0] + g_RT[2] + g_RT[9] - g_RT[14]);
+        Kc[66] = exp(g_RT[2] - g_RT[5] - g_RT[8] + g_RT[9]);
+        Kc[67] = exp(-g_RT[0] + g_RT[4] + g_RT[9] - g_RT[11]);
+        Kc[68] = exp(-g_RT[2] + g_RT[7] + g_RT[9] - g_RT[13]);
+        Kc[69] = exp(-2*g_RT[0] + g_RT[7] + g_RT[9] - g_RT[19]);
+        Kc[70] = exp(-g_RT[2] + g_RT[3] + g_RT[9] - g_RT[14]);
+        Kc[71] = exp(-g_RT[9] + g_RT[10] + g_RT[55] - g_RT[55]);
+        Kc[72] = exp(g_RT[0] - g_RT[4] - g_RT[8] + g_RT[10]);
+        Kc[73] = exp(-g_RT[0] + g_RT[2] + g_RT[10] - g_RT[14]);
+        Kc[74] = exp(-g_RT[0] + g_RT[4] + g_RT[10] - g_RT[11]);
+        Kc[75] = exp(-g_RT[0] - g_RT[2] + g_RT[7] + g_RT[10] - g_RT[18]);
+        Kc[76] = exp(-g_RT[5] + g_RT[7] + g_RT[10] - g_RT[18]);
+        Kc[77] = exp(g_RT[5] - g_RT[5] - g_RT[9] + g_RT[10]);
+        Kc[78] = exp(-g_RT[9] + g_RT[10] + g_RT[18] - g_RT[18]);
+        Kc[79] = exp(-g_RT[9] + g_RT[10] + g_RT[19] - g_RT[19]);
+        Kc[80] = exp(g_RT[10] - g_RT[14] - g_RT[18] + g_RT[19]);
+        Kc[81] = exp(g_RT[0] - g_RT[4] - g_RT[13] + g_RT[14]);
+        Kc[82] = exp(g_RT[1] - g_RT[2] - g_RT[13] + g_RT[14]);
+        Kc[83] = exp(g_RT[2] - g_RT[5] - g_RT[13] + g_RT[14]);
+        Kc[84] = exp(-g_RT[3] + g_RT[7] - g_RT[13] + g_RT[14]);
+        Kc[85] = exp(g_RT[3] - g_RT[6] - g_RT[13] + g_RT[14]);
+        Kc[86] = exp(-g_RT[0] + g_RT[8] + g_RT[14] - g_RT[27]);
+        Kc[87] = exp(-g_RT[0] + g_RT[1] + g_RT[11] - g_RT[14]);
+        Kc[88] = exp(g_RT[2] - g_RT[5] - g_RT[9] + g_RT[11]);
+        Kc[89] = exp(g_RT[2] - g_RT[5] - g_RT[10] + g_RT[11]);
+        Kc[90] = exp(-g_RT[1] + g_RT[7] + g_RT[11] - g_RT[15]);
+        Kc[91] = exp(-g_RT[2] + g_RT[7] + g_RT[11] - g_RT[14]);
+        Kc[92] = exp(g_RT[3] - g_RT[7] + g_RT[11] - g_RT[12]);
+        Kc[93] = exp(-g_RT[2] + g_RT[3] + g_RT[11] - g_RT[15]);
+        Kc[94] = exp(-g_RT[0] + g_RT[8] + g_RT[11] - g_RT[22]);
+        Kc[95] = exp(g_RT[11] - g_RT[12] + g_RT[13] - g_RT[18]);
+        Kc[96] = exp(g_RT[11] - g_RT[12] - g_RT[13] + g_RT[14]);
+        Kc[97] = exp(-g_RT[0] + g_RT[9] + g_RT[11] - g_RT[23]);
+        Kc[98] = exp(-g_RT[0] + 2*g_RT[11] - g_RT[24]);
+        Kc[99] = exp(g_RT[11] - g_RT[18] - g_RT[23] + g_RT[26]);
+        Kc[100] = exp(g_RT[0] - g_RT[4] - g_RT[14] + g_RT[15]);
+        Kc[101] = exp(g_RT[0] - g_RT[2] - g_RT[11] + g_RT[15]);
+        Kc[102] = exp(g_RT[0] - g_RT[5] - g_RT[10] + g_RT[15]);
+        Kc[103] = exp(g_RT[2] - g_RT[5] - g_RT[14] + g_RT[15]);
+        Kc[104] = exp(-g_RT[3] + g_RT[7] - g_RT[14] + g_RT[15]);
+        Kc[105] = exp(g_RT[0] - g_RT[4] - g_RT[14] + g_RT[16]);
+        Kc[106] = exp(g_RT[0] - g_RT[2] - g_RT[11] + g_RT[16]);
+        Kc[107] = exp(g_RT[0] - g_RT[5] - g_RT[10] + g_RT[16]);
+        Kc[108] = exp(-g_RT[3] + g_RT[7] - g_RT[14] + g_RT[16]);
+        Kc[109] = exp(g_RT[0] - g_RT[4] - g_RT[11] + g_RT[12]);
+        Kc[110] = exp(g_RT[1] - g_RT[2] - g_RT[11] + g_RT[12]);
+        Kc[111] = exp(g_RT[2] - g_RT[5] - g_RT[11] + g_RT[12]);
+        Kc[112] = exp(-g_RT[0] + g_RT[8] + g_RT[12] - g_RT[23]);
+        Kc[113] = exp(g_RT[9] - 2*g_RT[11] + g_RT[12]);
+        Kc[114] = exp(g_RT[10] - 2*g_RT[11] + g_RT[12]);
+        Kc[115] = exp(g_RT[0] - g_RT[4] - g_RT[16] + g_RT[17]);
+        Kc[116] = exp(g_RT[0] - g_RT[4] - g_RT[15] + g_RT[17]);
+        Kc[117] = exp(g_RT[1] - g_RT[2] - g_RT[16] + g_RT[17]);
+        Kc[118] = exp(g_RT[2] - g_RT[5] - g_RT[16] + g_RT[17]);
+        Kc[119] = exp(g_RT[2] - g_RT[5] - g_RT[15] + g_RT[17]);
+        Kc[120] = exp(g_RT[1] - g_RT[8] - g_RT[18] + g_RT[20]);
+        Kc[121] = exp(-g_RT[0] + g_RT[2] + g_RT[20] - g_RT[26]);
+        Kc[122] = exp(g_RT[7] - g_RT[13] - g_RT[18] + g_RT[20]);
+        Kc[123] = exp(-g_RT[0] + g_RT[4] + g_RT[20] - g_RT[21]);
+        Kc[124] = exp(g_RT[0] - g_RT[10] - g_RT[18] + g_RT[26]);
+        Kc[125] = exp(-g_RT[0] + g_RT[1] - 2*g_RT[18] + g_RT[26]);
+        Kc[126] = exp(-g_RT[2] + g_RT[7] - 2*g_RT[18] + g_RT[26]);
+        Kc[127] = exp(g_RT[1] - g_RT[2] - g_RT[20] + g_RT[21]);
+        Kc[128] = exp(g_RT[1] - g_RT[9] - g_RT[18] + g_RT[21]);
+        Kc[129] = exp(-g_RT[0] + g_RT[1] + g_RT[21] - g_RT[26]);
+        Kc[130] = exp(-g_RT[0] + g_RT[2] + g_RT[21] - g_RT[27]);
+        Kc[132] = exp(g_RT[2] - g_RT[5] - g_RT[20] + g_RT[21]);
+        Kc[133] = exp(g_RT[13] - g_RT[18] + g_RT[21] - g_RT[22]);
+        Kc[134] = exp(-g_RT[0] + g_RT[9] + g_RT[21] - g_RT[31]);
+        Kc[135] = exp(-g_RT[0] + g_RT[10] + g_RT[21] - g_RT[31]);
+        Kc[136] = exp(-g_RT[0] + g_RT[20] + g_RT[21] - g_RT[40]);
+        Kc[137] = exp(-g_RT[0] + g_RT[11] + g_RT[21] - g_RT[32]);
+        Kc[138] = exp(-g_RT[0] + g_RT[11] + g_RT[21] - g_RT[33]);
+        Kc[139] = exp(g_RT[0] - g_RT[4] - g_RT[26] + g_RT[27]);
+        Kc[140] = exp(g_RT[0] - g_RT[11] - g_RT[18] + g_RT[27]);
+        Kc[141] = exp(g_RT[2] - g_RT[5] - g_RT[26] + g_RT[27]);
+        Kc[142] = exp(g_RT[0] - g_RT[4] - g_RT[21] + g_RT[22]);
+        Kc[143] = exp(-g_RT[0] + g_RT[1] + g_RT[22] - g_RT[27]);
+        Kc[144] = exp(g_RT[1] - g_RT[11] - g_RT[18] + g_RT[22]);
+        Kc[145] = exp(g_RT[2] - g_RT[5] - g_RT[21] + g_RT[22]);
+        Kc[146] = exp(-g_RT[3] + g_RT[7] - g_RT[21] + g_RT[22]);
+        Kc[147] = exp(-g_RT[1] + g_RT[7] + g_RT[22] - g_RT[29]);
+        Kc[148] = exp(g_RT[7] - g_RT[13] - g_RT[14] + g_RT[22]);
+        Kc[149] = exp(-g_RT[2] + g_RT[3] + g_RT[22] - g_RT[29]);
+        Kc[150] = exp(g_RT[13] - g_RT[18] + g_RT[22] - g_RT[23]);
+        Kc[151] = exp(g_RT[13] + g_RT[22] - g_RT[39]);
+        Kc[152] = exp(-g_RT[0] + g_RT[11] + g_RT[22] - g_RT[34]);
+        Kc[153] = exp(-g_RT[11] - g_RT[18] + g_RT[29]);
+        Kc[154] = exp(g_RT[0] - g_RT[0] - g_RT[28] + g_RT[29]);
+        Kc[155] = exp(g_RT[0] - g_RT[11] - g_RT[13] + g_RT[29]);
+        Kc[156] = exp(g_RT[0] - g_RT[4] - g_RT[27] + g_RT[29]);
+        Kc[157] = exp(g_RT[2] - g_RT[5] - g_RT[27] + g_RT[29]);
+        Kc[158] = exp(-g_RT[3] + g_RT[7] - g_RT[27] + g_RT[29]);
+        Kc[159] = exp(-g_RT[2] + g_RT[7] - g_RT[14] - g_RT[18] + g_RT[29]);
+        Kc[160] = exp(g_RT[0] - g_RT[11] - g_RT[13] + g_RT[28]);
+        Kc[161] = exp(-g_RT[2] + g_RT[3] - g_RT[11] - g_RT[19] + g_RT[28]);
+        Kc[162] = exp(g_RT[0] - g_RT[4] - g_RT[28] + g_RT[30]);
+        Kc[163] = exp(g_RT[2] - g_RT[5] - g_RT[28] + g_RT[30]);
+        Kc[164] = exp(g_RT[11] - g_RT[12] - g_RT[28] + g_RT[30]);
+        Kc[165] = exp(-g_RT[3] + g_RT[7] - g_RT[28] + g_RT[30]);
+        Kc[166] = exp(g_RT[0] - g_RT[4] - g_RT[22] + g_RT[23]);
+        Kc[167] = exp(g_RT[1] - g_RT[2] - g_RT[22] + g_RT[23]);
+        Kc[168] = exp(g_RT[1] - g_RT[11] - g_RT[13] + g_RT[23]);
+        Kc[169] = exp(g_RT[1] - g_RT[9] - g_RT[14] + g_RT[23]);
+        Kc[170] = exp(g_RT[2] - g_RT[5] - g_RT[22] + g_RT[23]);
+        Kc[171] = exp(g_RT[13] - g_RT[18] + g_RT[23] - g_RT[24]);
+        Kc[172] = exp(-g_RT[0] + g_RT[8] + g_RT[23] - g_RT[33]);
+        Kc[173] = exp(-g_RT[0] + g_RT[8] + g_RT[23] - g_RT[32]);
+        Kc[174] = exp(-g_RT[0] + g_RT[9] + g_RT[23] - g_RT[34]);
+        Kc[175] = exp(-g_RT[0] + g_RT[10] + g_RT[23] - g_RT[34]);
+        Kc[176] = exp(g_RT[11] - g_RT[12] - g_RT[22] + g_RT[23]);
+        Kc[177] = exp(g_RT[11] + g_RT[23] - g_RT[37]);
+        Kc[178] = exp(g_RT[22] + g_RT[23] - g_RT[48]);
+        Kc[179] = exp(g_RT[0] - g_RT[4] - g_RT[23] + g_RT[24]);
+        Kc[180] = exp(g_RT[1] - g_RT[11] - g_RT[14] + g_RT[24]);
+        Kc[181] = exp(-g_RT[0] + g_RT[1] + g_RT[24] - g_RT[30]);
+        Kc[182] = exp(-g_RT[3] + g_RT[7] - g_RT[23] + g_RT[24]);
+        Kc[183] = exp(g_RT[3] - g_RT[7] + g_RT[24] - g_RT[25]);
+        Kc[184] = exp(g_RT[3] - g_RT[6] - g_RT[23] + g_RT[24]);
+        Kc[185] = exp(-g_RT[2] + g_RT[3] - g_RT[11] - g_RT[14] + g_RT[24]);
+        Kc[186] = exp(-g_RT[11] + g_RT[22] + g_RT[24] - g_RT[34]);
+        Kc[187] = exp(g_RT[0] - g_RT[4] - g_RT[24] + g_RT[25]);
+        Kc[188] = exp(g_RT[1] - g_RT[2] - g_RT[24] + g_RT[25]);
+        Kc[189] = exp(g_RT[2] - g_RT[5] - g_RT[24] + g_RT[25]);
+        Kc[190] = exp(g_RT[10] - g_RT[11] - g_RT[24] + g_RT[25]);
+        Kc[191] = exp(g_RT[11] - g_RT[12] - g_RT[24] + g_RT[25]);
+        Kc[192] = exp(g_RT[0] + g_RT[31] - g_RT[32]);
+        Kc[193] = exp(g_RT[1] - g_RT[14] - g_RT[20] + g_RT[31]);
+        Kc[194] = exp(g_RT[7] - g_RT[13] - g_RT[27] + g_RT[31]);
+        Kc[195] = exp(g_RT[3] - g_RT[7] + g_RT[31] - g_RT[32]);
+        Kc[196] = exp(g_RT[0] + g_RT[33] - g_RT[35]);
+        Kc[197] = exp(g_RT[0] + g_RT[33] - g_RT[34]);
+        Kc[198] = exp(g_RT[1] - g_RT[18] - g_RT[23] + g_RT[33]);
+        Kc[199] = exp(g_RT[2] - g_RT[5] - g_RT[31] + g_RT[33]);
+        Kc[200] = exp(g_RT[32] - g_RT[33]);
+        Kc[201] = exp(g_RT[0] - g_RT[0] + g_RT[32] - g_RT[33]);
+        Kc[202] = exp(g_RT[0] + g_RT[32] - g_RT[35]);
+        Kc[203] = exp(g_RT[1] - g_RT[18] - g_RT[23] + g_RT[32]);
+        Kc[204] = exp(g_RT[2] - g_RT[5] - g_RT[31] + g_RT[32]);
+        Kc[205] = exp(g_RT[0] - g_RT[4] - g_RT[33] + g_RT[34]);
+        Kc[206] = exp(-g_RT[0] + g_RT[1] + g_RT[34] - g_RT[39]);
+        Kc[207] = exp(-2*g_RT[0] + g_RT[2] + g_RT[34] - g_RT[39]);
+        Kc[208] = exp(g_RT[2] - g_RT[5] - g_RT[33] + g_RT[34]);
+        Kc[209] = exp(g_RT[3] - g_RT[7] + g_RT[34] - g_RT[36]);
+        Kc[210] = exp(-g_RT[2] + g_RT[3] - g_RT[14] - g_RT[22] + g_RT[34]);
+        Kc[211] = exp(g_RT[13] - g_RT[18] + g_RT[34] - g_RT[36]);
+        Kc[212] = exp(g_RT[11] - g_RT[12] - g_RT[33] + g_RT[34]);
+        Kc[213] = exp(g_RT[7] - g_RT[14] - g_RT[28] + g_RT[35]);
+        Kc[214] = exp(-g_RT[2] + g_RT[3] - g_RT[11] - g_RT[27] + g_RT[35]);
+        Kc[215] = exp(g_RT[0] - g_RT[11] - g_RT[23] + g_RT[36]);
+        Kc[216] = exp(g_RT[0] - g_RT[4] - g_RT[34] + g_RT[36]);
+        Kc[217] = exp(g_RT[0] - g_RT[4] - g_RT[35] + g_RT[36]);
+        Kc[218] = exp(-g_RT[0] + g_RT[1] - g_RT[11] - g_RT[27] + g_RT[36]);
+        Kc[219] = exp(-2*g_RT[0] + g_RT[1] + g_RT[36] - g_RT[39]);
+        Kc[220] = exp(g_RT[1] - g_RT[13] - g_RT[24] + g_RT[36]);
+        Kc[221] = exp(g_RT[1] - g_RT[2] - g_RT[34] + g_RT[36]);
+        Kc[222] = exp(g_RT[1] - g_RT[2] - g_RT[35] + g_RT[36]);
+        Kc[223] = exp(g_RT[2] - g_RT[5] - g_RT[34] + g_RT[36]);
+        Kc[224] = exp(g_RT[2] - g_RT[5] - g_RT[35] + g_RT[36]);
+        Kc[225] = exp(g_RT[11] - g_RT[12] - g_RT[34] + g_RT[36]);
+        Kc[226] = exp(g_RT[1] - g_RT[2] - g_RT[18] - g_RT[22] + g_RT[39]);
+        Kc[227] = exp(g_RT[1] - g_RT[14] - g_RT[27] + g_RT[39]);
+        Kc[228] = exp(g_RT[0] - g_RT[11] - g_RT[24] + g_RT[38]);
+        Kc[229] = exp(g_RT[1] - g_RT[11] - g_RT[30] + g_RT[38]);
+        Kc[230] = exp(g_RT[2] - g_RT[5] - g_RT[36] + g_RT[38]);
+        Kc[231] = exp(-g_RT[3] + g_RT[7] - g_RT[36] + g_RT[38]);
+        Kc[232] = exp(-g_RT[2] + g_RT[3] - g_RT[11] - g_RT[30] + g_RT[38]);
+        Kc[233] = exp(g_RT[11] - g_RT[12] - g_RT[36] + g_RT[38]);
+        Kc[234] = exp(g_RT[0] - g_RT[11] - g_RT[24] + g_RT[37]);
+        Kc[235] = exp(g_RT[2] - g_RT[5] - g_RT[36] + g_RT[37]);
+        Kc[236] = exp(-g_RT[3] + g_RT[7] - g_RT[36] + g_RT[37]);
+        Kc[237] = exp(-g_RT[2] + g_RT[3] - g_RT[14] - g_RT[24] + g_RT[37]);
+        Kc[238] = exp(g_RT[11] - g_RT[12] - g_RT[36] + g_RT[37]);
+        Kc[239] = exp(g_RT[0] + g_RT[40] - g_RT[41]);
+        Kc[240] = exp(g_RT[0] - g_RT[4] - g_RT[40] + g_RT[41]);
+        Kc[241] = exp(g_RT[2] - g_RT[5] - g_RT[41] + g_RT[42]);
+        Kc[242] = exp(-g_RT[43] + g_RT[44]);
+        Kc[243] = exp(g_RT[0] - g_RT[22] - g_RT[23] + g_RT[45]);
+        Kc[244] = exp(g_RT[2] - g_RT[5] - g_RT[43] + g_RT[45]);
+        Kc[245] = exp(-g_RT[0] - g_RT[43] + g_RT[46]);
+        Kc[246] = exp(-g_RT[0] - g_RT[44] + g_RT[47]);
+        Kc[247] = exp(-g_RT[0] - g_RT[45] + g_RT[48]);
+        Kc[248] = exp(-g_RT[3] + g_RT[7] - g_RT[45] + g_RT[48]);
+        Kc[249] = exp(-g_RT[2] + g_RT[3] - g_RT[14] - g_RT[34] + g_RT[48]);
+        Kc[250] = exp(g_RT[0] - g_RT[23] - g_RT[24] + g_RT[49]);
+        Kc[251] = exp(g_RT[0] - g_RT[11] - g_RT[36] + g_RT[49]);
+        Kc[252] = exp(g_RT[0] - g_RT[4] - g_RT[48] + g_RT[49]);
+        Kc[253] = exp(g_RT[1] - g_RT[13] - g_RT[37] + g_RT[49]);
+        Kc[254] = exp(g_RT[23] + g_RT[24] - g_RT[50]);
+        Kc[255] = exp(g_RT[2] - g_RT[5] - g_RT[49] + g_RT[50]);
+        Kc[256] = exp(-g_RT[3] + g_RT[7] - g_RT[49] + g_RT[50]);
+        Kc[257] = exp(-g_RT[2] + g_RT[3] - g_RT[14] - g_RT[37] + g_RT[50]);
+        Kc[258] = exp(g_RT[11] - g_RT[12] - g_RT[49] + g_RT[50]);
+        Kc[259] = exp(-3*g_RT[23] - 2*g_RT[37] + g_RT[51]);
+        Kc[260] = exp(-2*g_RT[23] - 2*g_RT[50] + g_RT[51]);
+        Kc[261] = exp(g_RT[0] - g_RT[4] - 4*g_RT[23] - g_RT[50] + g_RT[51]);
+        Kc[262] = exp(g_RT[0] - g_RT[4] - 2*g_RT[23] - g_RT[49] - g_RT[50] + g_RT[51]);
+        Kc[263] = exp(g_RT[0] - g_RT[4] - g_RT[36] - g_RT[37] + g_RT[51] - g_RT[52]);
+        Kc[264] = exp(g_RT[0] - g_RT[4] - 2*g_RT[23] - g_RT[37] + g_RT[51] - g_RT[54]);
+        Kc[265] = exp(g_RT[0] - g_RT[4] - g_RT[23] - g_RT[50] + g_RT[51] - g_RT[52]);
+        Kc[266] = exp(g_RT[11] - g_RT[12] - 4*g_RT[23] - g_RT[50] + g_RT[51]);
+        Kc[267] = exp(g_RT[11] - g_RT[12] - 2*g_RT[23] - g_RT[49] - g_RT[50] + g_RT[51]);
+        Kc[268] = exp(g_RT[11] - g_RT[12] - g_RT[36] - g_RT[37] + g_RT[51] - g_RT[52]);
+        Kc[269] = exp(g_RT[11] - g_RT[12] - 2*g_RT[23] - g_RT[37] + g_RT[51] - g_RT[54]);
+        Kc[270] = exp(g_RT[11] - g_RT[12] - g_RT[23] - g_RT[50] + g_RT[51] - g_RT[52]);
+        Kc[271] = exp(g_RT[1] - g_RT[2] - 4*g_RT[23] - g_RT[50] + g_RT[51]);
+        Kc[272] = exp(g_RT[1] - g_RT[2] - 2*g_RT[23] - g_RT[49] - g_RT[50] + g_RT[51]);
+        Kc[273] = exp(g_RT[1] - g_RT[2] - g_RT[36] - g_RT[37] + g_RT[51] - g_RT[52]);
+        Kc[274] = exp(g_RT[1] - g_RT[2] - 2*g_RT[23] - g_RT[37] + g_RT[51] - g_RT[54]);
+        Kc[275] = exp(g_RT[1] - g_RT[2] - g_RT[23] - g_RT[50] + g_RT[51] - g_RT[52]);
+        Kc[276] = exp(g_RT[2] - g_RT[5] - 4*g_RT[23] - g_RT[50] + g_RT[51]);
+        Kc[277] = exp(g_RT[2] - g_RT[5] - 2*g_RT[23] - g_RT[49] - g_RT[50] + g_RT[51]);
+        Kc[278] = exp(g_RT[2] - g_RT[5] - g_RT[36] - g_RT[37] + g_RT[51] - g_RT[52]);
+        Kc[279] = exp(g_RT[2] - g_RT[5] - 2*g_RT[23] - g_RT[37] + g_RT[51] - g_RT[54]);
+        Kc[280] = exp(g_RT[2] - g_RT[5] - g_RT[23] - g_RT[50] + g_RT[51] - g_RT[52]);
+        Kc[281] = exp(g_RT[0] - g_RT[23] - g_RT[50] + g_RT[52]);
+        Kc[282] = exp(g_RT[0] - g_RT[4] + g_RT[52] - g_RT[53]);
+        Kc[283] = exp(g_RT[0] - g_RT[23] - g_RT[37] + g_RT[54]);
+        Kc[284] = exp(g_RT[0] - g_RT[4] - g_RT[23] - g_RT[34] + g_RT[54]);
+        Kc[285] = exp(g_RT[0] - g_RT[11] - g_RT[23] - g_RT[34] + g_RT[53]);
+        Kc[286] = exp(-g_RT[2] + g_RT[3] - g_RT[14] - g_RT[23] - g_RT[34] + g_RT[53]);
+        Kc[287] = exp(g_RT[1] - g_RT[13] - g_RT[23] - g_RT[37] + g_RT[52]);
+        Kc[288] = exp(g_RT[1] - g_RT[13] - g_RT[50] + g_RT[54]);
+
+        /*reactions with the net stoichiometry of an earlier one */
+        Kc[41] = Kc[40];
+        Kc[43] = Kc[42];
+        Kc[48] = Kc[47];
+        Kc[50] = Kc[49];
+        Kc[131] = Kc[130];
+
+        Kc[0] *= refCinv;
+        Kc[1] *= refCinv;
+        Kc[2] *= refCinv;
+        Kc[3] *= refCinv;
+        Kc[4] *= refCinv;
+        Kc[5] *= refCinv;
+        Kc[6] *= refCinv;
+        Kc[7] *= refCinv;
+        Kc[8] *= refCinv;
+        Kc[9] *= refC;
+        Kc[10] *= refCinv;
+        Kc[11] *= refCinv;
+        Kc[12] *= refCinv;
+        Kc[13] *= refCinv;
+        Kc[14] *= refCinv;
+        Kc[15] *= refC;
+        Kc[16] *= refCinv;
+        Kc[17] *= refCinv;
+        Kc[18] *= refCinv;
+        Kc[19] *= refCinv;
+        Kc[20] *= refCinv;
+        Kc[21] *= refCinv;
+        Kc[22] *= refCinv;
+        Kc[25] *= refCinv;
+        Kc[26] *= refCinv;
+        Kc[27] *= refCinv;
+        Kc[28] *= refCinv;
+        Kc[29] *= refCinv;
+        Kc[30] *= refC;
+        Kc[35] *= refCinv;
+        Kc[56] *= refC;
+        Kc[69] *= refC;
+        Kc[75] *= refC;
+        Kc[125] *= refC;
+        Kc[126] *= refC;
+        Kc[151] *= refCinv;
+        Kc[153] *= refC;
+        Kc[159] *= refC;
+        Kc[161] *= refC;
+        Kc[177] *= refCinv;
+        Kc[178] *= refCinv;
+        Kc[185] *= refC;
+        Kc[192] *= refCinv;
+        Kc[196] *= refCinv;
+        Kc[197] *= refCinv;
+        Kc[202] *= refCinv;
+        Kc[207] *= refC;
+        Kc[210] *= refC;
+        Kc[214] *= refC;
+        Kc[218] *= refC;
+        Kc[219] *= refC;
+        Kc[226] *= refC;
+        Kc[232] *= refC;
+        Kc[237] *= refC;
+        Kc[239] *= refCinv;
+        Kc[245] *= refC;
+        Kc[246] *= refC;
+        Kc[247] *= refC;
+        Kc[249] *= refC;
+        Kc[254] *= refCinv;
+        Kc[257] *= refC;
+        Kc[259] *= refC*refC*refC*refC;
+        Kc[260] *= refC*refC*refC;
+        Kc[261] *= refC*refC*refC*refC;
+        Kc[262] *= refC*refC*refC;
+        Kc[263] *= refC*refC;
+        Kc[264] *= refC*refC*refC;
+        Kc[265] *= refC*refC;
+        Kc[266] *= refC*refC*refC*refC;
+        Kc[267] *= refC*refC*refC;
+        Kc[268] *= refC*refC;
+        Kc[269] *= refC*refC*refC;
+        Kc[270] *= refC*refC;
+        Kc[271] *= refC*refC*refC*refC;
+        Kc[272] *= refC*refC*refC;
+        Kc[273] *= refC*refC;
+        Kc[274] *= refC*refC*refC;
+        Kc[275] *= refC*refC;
+        Kc[276] *= refC*refC*refC*refC;
+        Kc[277] *= refC*refC*refC;
+        Kc[278] *= refC*refC;
+        Kc[279] *= refC*refC*refC;
+        Kc[280] *= refC*refC;
+        Kc[284] *= refC;
+        Kc[285] *= refC;
+        Kc[286] *= refC*refC;
+        Kc[287] *= refC;
+    }
 
     return;
 }
@@ -17372,6 +18139,11 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         mixture += sc[i];
     }
 
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[2][0] - 1)*sc[4] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[12] + (TB[2][3] - 1)*sc[18] + (TB[2][4] - 1)*sc[19] + (TB[2][5] - 1)*sc[25];
+    double alpha_eff1 = mixture + (TB[9][0] - 1)*sc[4] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[12] + (TB[9][3] - 1)*sc[18] + (TB[9][4] - 1)*sc[19] + (TB[9][5] - 1)*sc[21] + (TB[9][6] - 1)*sc[23] + (TB[9][7] - 1)*sc[25];
+    double alpha_eff2 = mixture + (TB[25][0] - 1)*sc[4] + (TB[25][1] - 1)*sc[5] + (TB[25][2] - 1)*sc[18] + (TB[25][3] - 1)*sc[19];
+
     double Corr[289];
     for (int i = 0; i < 289; ++i) {
         Corr[i] = 1.0;
@@ -17382,29 +18154,29 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         double alpha[25];
         alpha[0] = mixture + (TB[0][0] - 1)*sc[5] + (TB[0][1] - 1)*sc[7] + (TB[0][2] - 1)*sc[18] + (TB[0][3] - 1)*sc[19];
         alpha[1] = mixture + (TB[1][0] - 1)*sc[4] + (TB[1][1] - 1)*sc[5] + (TB[1][2] - 1)*sc[18] + (TB[1][3] - 1)*sc[19];
-        alpha[2] = mixture + (TB[2][0] - 1)*sc[4] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[12] + (TB[2][3] - 1)*sc[18] + (TB[2][4] - 1)*sc[19] + (TB[2][5] - 1)*sc[25];
-        alpha[3] = mixture + (TB[3][0] - 1)*sc[4] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[12] + (TB[3][3] - 1)*sc[18] + (TB[3][4] - 1)*sc[19] + (TB[3][5] - 1)*sc[25];
-        alpha[4] = mixture + (TB[4][0] - 1)*sc[4] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[12] + (TB[4][3] - 1)*sc[18] + (TB[4][4] - 1)*sc[19] + (TB[4][5] - 1)*sc[25];
-        alpha[5] = mixture + (TB[5][0] - 1)*sc[4] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[12] + (TB[5][3] - 1)*sc[18] + (TB[5][4] - 1)*sc[19] + (TB[5][5] - 1)*sc[25];
-        alpha[6] = mixture + (TB[6][0] - 1)*sc[4] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[12] + (TB[6][3] - 1)*sc[18] + (TB[6][4] - 1)*sc[19] + (TB[6][5] - 1)*sc[25];
-        alpha[7] = mixture + (TB[7][0] - 1)*sc[4] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[12] + (TB[7][3] - 1)*sc[18] + (TB[7][4] - 1)*sc[19] + (TB[7][5] - 1)*sc[25];
-        alpha[8] = mixture + (TB[8][0] - 1)*sc[4] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[12] + (TB[8][3] - 1)*sc[18] + (TB[8][4] - 1)*sc[19] + (TB[8][5] - 1)*sc[25];
-        alpha[9] = mixture + (TB[9][0] - 1)*sc[4] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[12] + (TB[9][3] - 1)*sc[18] + (TB[9][4] - 1)*sc[19] + (TB[9][5] - 1)*sc[21] + (TB[9][6] - 1)*sc[23] + (TB[9][7] - 1)*sc[25];
-        alpha[10] = mixture + (TB[10][0] - 1)*sc[4] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[12] + (TB[10][3] - 1)*sc[18] + (TB[10][4] - 1)*sc[19] + (TB[10][5] - 1)*sc[21] + (TB[10][6] - 1)*sc[23] + (TB[10][7] - 1)*sc[25];
-        alpha[11] = mixture + (TB[11][0] - 1)*sc[4] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[12] + (TB[11][3] - 1)*sc[18] + (TB[11][4] - 1)*sc[19] + (TB[11][5] - 1)*sc[21] + (TB[11][6] - 1)*sc[23] + (TB[11][7] - 1)*sc[25];
+        alpha[2] = alpha_eff0;
+        alpha[3] = (memcmp(TB[3], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[3][0] - 1)*sc[4] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[12] + (TB[3][3] - 1)*sc[18] + (TB[3][4] - 1)*sc[19] + (TB[3][5] - 1)*sc[25]);
+        alpha[4] = (memcmp(TB[4], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[4][0] - 1)*sc[4] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[12] + (TB[4][3] - 1)*sc[18] + (TB[4][4] - 1)*sc[19] + (TB[4][5] - 1)*sc[25]);
+        alpha[5] = (memcmp(TB[5], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[5][0] - 1)*sc[4] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[12] + (TB[5][3] - 1)*sc[18] + (TB[5][4] - 1)*sc[19] + (TB[5][5] - 1)*sc[25]);
+        alpha[6] = (memcmp(TB[6], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[6][0] - 1)*sc[4] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[12] + (TB[6][3] - 1)*sc[18] + (TB[6][4] - 1)*sc[19] + (TB[6][5] - 1)*sc[25]);
+        alpha[7] = (memcmp(TB[7], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[7][0] - 1)*sc[4] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[12] + (TB[7][3] - 1)*sc[18] + (TB[7][4] - 1)*sc[19] + (TB[7][5] - 1)*sc[25]);
+        alpha[8] = (memcmp(TB[8], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[8][0] - 1)*sc[4] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[12] + (TB[8][3] - 1)*sc[18] + (TB[8][4] - 1)*sc[19] + (TB[8][5] - 1)*sc[25]);
+        alpha[9] = alpha_eff1;
+        alpha[10] = (memcmp(TB[10], TB[9], 8*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[10][0] - 1)*sc[4] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[12] + (TB[10][3] - 1)*sc[18] + (TB[10][4] - 1)*sc[19] + (TB[10][5] - 1)*sc[21] + (TB[10][6] - 1)*sc[23] + (TB[10][7] - 1)*sc[25]);
+        alpha[11] = (memcmp(TB[11], TB[9], 8*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[11][0] - 1)*sc[4] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[12] + (TB[11][3] - 1)*sc[18] + (TB[11][4] - 1)*sc[19] + (TB[11][5] - 1)*sc[21] + (TB[11][6] - 1)*sc[23] + (TB[11][7] - 1)*sc[25]);
         alpha[12] = mixture + (TB[12][0] - 1)*sc[4] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[12] + (TB[12][3] - 1)*sc[18] + (TB[12][4] - 1)*sc[19] + (TB[12][5] - 1)*sc[23] + (TB[12][6] - 1)*sc[25];
-        alpha[13] = mixture + (TB[13][0] - 1)*sc[4] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[12] + (TB[13][3] - 1)*sc[18] + (TB[13][4] - 1)*sc[19] + (TB[13][5] - 1)*sc[21] + (TB[13][6] - 1)*sc[23] + (TB[13][7] - 1)*sc[25];
-        alpha[14] = mixture + (TB[14][0] - 1)*sc[4] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[12] + (TB[14][3] - 1)*sc[18] + (TB[14][4] - 1)*sc[19] + (TB[14][5] - 1)*sc[21] + (TB[14][6] - 1)*sc[23] + (TB[14][7] - 1)*sc[25];
-        alpha[15] = mixture + (TB[15][0] - 1)*sc[4] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[12] + (TB[15][3] - 1)*sc[18] + (TB[15][4] - 1)*sc[19] + (TB[15][5] - 1)*sc[25];
+        alpha[13] = (memcmp(TB[13], TB[9], 8*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[13][0] - 1)*sc[4] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[12] + (TB[13][3] - 1)*sc[18] + (TB[13][4] - 1)*sc[19] + (TB[13][5] - 1)*sc[21] + (TB[13][6] - 1)*sc[23] + (TB[13][7] - 1)*sc[25]);
+        alpha[14] = (memcmp(TB[14], TB[9], 8*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[14][0] - 1)*sc[4] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[12] + (TB[14][3] - 1)*sc[18] + (TB[14][4] - 1)*sc[19] + (TB[14][5] - 1)*sc[21] + (TB[14][6] - 1)*sc[23] + (TB[14][7] - 1)*sc[25]);
+        alpha[15] = (memcmp(TB[15], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[15][0] - 1)*sc[4] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[12] + (TB[15][3] - 1)*sc[18] + (TB[15][4] - 1)*sc[19] + (TB[15][5] - 1)*sc[25]);
         alpha[16] = mixture;
-        alpha[17] = mixture + (TB[17][0] - 1)*sc[4] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[12] + (TB[17][3] - 1)*sc[18] + (TB[17][4] - 1)*sc[19] + (TB[17][5] - 1)*sc[25];
-        alpha[18] = mixture + (TB[18][0] - 1)*sc[4] + (TB[18][1] - 1)*sc[5] + (TB[18][2] - 1)*sc[12] + (TB[18][3] - 1)*sc[18] + (TB[18][4] - 1)*sc[19] + (TB[18][5] - 1)*sc[25];
-        alpha[19] = mixture + (TB[19][0] - 1)*sc[4] + (TB[19][1] - 1)*sc[5] + (TB[19][2] - 1)*sc[12] + (TB[19][3] - 1)*sc[18] + (TB[19][4] - 1)*sc[19] + (TB[19][5] - 1)*sc[25];
-        alpha[20] = mixture + (TB[20][0] - 1)*sc[4] + (TB[20][1] - 1)*sc[5] + (TB[20][2] - 1)*sc[12] + (TB[20][3] - 1)*sc[18] + (TB[20][4] - 1)*sc[19] + (TB[20][5] - 1)*sc[25];
-        alpha[21] = mixture + (TB[21][0] - 1)*sc[4] + (TB[21][1] - 1)*sc[5] + (TB[21][2] - 1)*sc[12] + (TB[21][3] - 1)*sc[18] + (TB[21][4] - 1)*sc[19] + (TB[21][5] - 1)*sc[25];
-        alpha[22] = mixture + (TB[22][0] - 1)*sc[4] + (TB[22][1] - 1)*sc[5] + (TB[22][2] - 1)*sc[12] + (TB[22][3] - 1)*sc[18] + (TB[22][4] - 1)*sc[19] + (TB[22][5] - 1)*sc[25];
-        alpha[23] = mixture + (TB[23][0] - 1)*sc[4] + (TB[23][1] - 1)*sc[5] + (TB[23][2] - 1)*sc[12] + (TB[23][3] - 1)*sc[18] + (TB[23][4] - 1)*sc[19] + (TB[23][5] - 1)*sc[25];
-        alpha[24] = mixture + (TB[24][0] - 1)*sc[4] + (TB[24][1] - 1)*sc[5] + (TB[24][2] - 1)*sc[12] + (TB[24][3] - 1)*sc[18] + (TB[24][4] - 1)*sc[19] + (TB[24][5] - 1)*sc[25];
+        alpha[17] = (memcmp(TB[17], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[17][0] - 1)*sc[4] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[12] + (TB[17][3] - 1)*sc[18] + (TB[17][4] - 1)*sc[19] + (TB[17][5] - 1)*sc[25]);
+        alpha[18] = (memcmp(TB[18], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[18][0] - 1)*sc[4] + (TB[18][1] - 1)*sc[5] + (TB[18][2] - 1)*sc[12] + (TB[18][3] - 1)*sc[18] + (TB[18][4] - 1)*sc[19] + (TB[18][5] - 1)*sc[25]);
+        alpha[19] = (memcmp(TB[19], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[19][0] - 1)*sc[4] + (TB[19][1] - 1)*sc[5] + (TB[19][2] - 1)*sc[12] + (TB[19][3] - 1)*sc[18] + (TB[19][4] - 1)*sc[19] + (TB[19][5] - 1)*sc[25]);
+        alpha[20] = (memcmp(TB[20], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[20][0] - 1)*sc[4] + (TB[20][1] - 1)*sc[5] + (TB[20][2] - 1)*sc[12] + (TB[20][3] - 1)*sc[18] + (TB[20][4] - 1)*sc[19] + (TB[20][5] - 1)*sc[25]);
+        alpha[21] = (memcmp(TB[21], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[21][0] - 1)*sc[4] + (TB[21][1] - 1)*sc[5] + (TB[21][2] - 1)*sc[12] + (TB[21][3] - 1)*sc[18] + (TB[21][4] - 1)*sc[19] + (TB[21][5] - 1)*sc[25]);
+        alpha[22] = (memcmp(TB[22], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[22][0] - 1)*sc[4] + (TB[22][1] - 1)*sc[5] + (TB[22][2] - 1)*sc[12] + (TB[22][3] - 1)*sc[18] + (TB[22][4] - 1)*sc[19] + (TB[22][5] - 1)*sc[25]);
+        alpha[23] = (memcmp(TB[23], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[23][0] - 1)*sc[4] + (TB[23][1] - 1)*sc[5] + (TB[23][2] - 1)*sc[12] + (TB[23][3] - 1)*sc[18] + (TB[23][4] - 1)*sc[19] + (TB[23][5] - 1)*sc[25]);
+        alpha[24] = (memcmp(TB[24], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[24][0] - 1)*sc[4] + (TB[24][1] - 1)*sc[5] + (TB[24][2] - 1)*sc[12] + (TB[24][3] - 1)*sc[18] + (TB[24][4] - 1)*sc[19] + (TB[24][5] - 1)*sc[25]);
 #ifdef __INTEL_COMPILER
          #pragma simd
 #endif
@@ -17429,7 +18201,7 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
     /* Lindemann */
     {
         double alpha;
-        alpha = mixture + (TB[25][0] - 1)*sc[4] + (TB[25][1] - 1)*sc[5] + (TB[25][2] - 1)*sc[18] + (TB[25][3] - 1)*sc[19];
+        alpha = alpha_eff2;
         double redP = alpha / k_f_save[25] * phase_units[25] * low_A[25] * exp(low_beta[25] * tc[0] - activation_units[25] * low_Ea[25] * invT);
         Corr[25] = redP / (1. + redP);
     }
@@ -17441,7 +18213,7 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         Corr[26] = alpha;
         alpha = mixture + (TB[27][0] - 1)*sc[4] + (TB[27][1] - 1)*sc[5] + (TB[27][2] - 1)*sc[18] + (TB[27][3] - 1)*sc[19];
         Corr[27] = alpha;
-        alpha = mixture + (TB[28][0] - 1)*sc[4] + (TB[28][1] - 1)*sc[5] + (TB[28][2] - 1)*sc[18] + (TB[28][3] - 1)*sc[19];
+        alpha = (memcmp(TB[28], TB[25], 4*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[28][0] - 1)*sc[4] + (TB[28][1] - 1)*sc[5] + (TB[28][2] - 1)*sc[18] + (TB[28][3] - 1)*sc[19]);
         Corr[28] = alpha;
         alpha = mixture + (TB[29][0] - 1)*sc[4] + (TB[29][1] - 1)*sc[5] + (TB[29][2] - 1)*sc[18] + (TB[29][3] - 1)*sc[19];
         Corr[29] = alpha;
@@ -22632,17 +23404,24 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         mixture += sc[k];
     }
 
-    /*compute the Gibbs free energy */
-    double g_RT[56];
-    gibbs(g_RT, tc);
-
     /*compute the species enthalpy */
     double h_RT[56];
     speciesEnthalpy(h_RT, tc);
 
+    /*compute the rate and equilibrium constants */
+    double k_f_s[289], Kc_s[289];
+    comp_k_f(tc, invT, k_f_s);
+    comp_Kc(tc, invT, Kc_s);
+
+    /*at constant volume, the part of dwdot/d[X] common to all species */
+    double Jmix[56];
+    for (int k=0; k<56; k++) {
+        Jmix[k] = 0.0;
+    }
+
     double phi_f, k_f, k_r, phi_r, Kc, q, q_nocor, Corr, alpha;
     double dlnkfdT, dlnk0dT, dlnKcdT, dkrdT, dqdT;
-    double dqdci, dcdc_fac, dqdc[56];
+    double dqdci, dcdc_fac;
     double Pr, fPr, F, k_0, logPr;
     double logFcent, troe_c, troe_n, troePr_den, troePr, troe;
     double Fcent1, Fcent2, Fcent3, Fcent;
@@ -22650,6 +23429,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     double dlogPrdT, dlogfPrdT, dlogFdT, dlogFcentdT, dlogFdlogPr, dlnCorrdT;
     const double ln10 = log(10.0);
     const double log10e = 1.0/log(10.0);
+    double x_0, x_0_s[2], e_0_s[2];
+    double logFcent_s[1], dlogFcentdT_s[1];
+
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[2][0] - 1)*sc[4] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[12] + (TB[2][3] - 1)*sc[18] + (TB[2][4] - 1)*sc[19] + (TB[2][5] - 1)*sc[25];
+    double alpha_eff1 = mixture + (TB[9][0] - 1)*sc[4] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[12] + (TB[9][3] - 1)*sc[18] + (TB[9][4] - 1)*sc[19] + (TB[9][5] - 1)*sc[21] + (TB[9][6] - 1)*sc[23] + (TB[9][7] - 1)*sc[25];
+    double alpha_eff2 = mixture + (TB[25][0] - 1)*sc[4] + (TB[25][1] - 1)*sc[5] + (TB[25][2] - 1)*sc[18] + (TB[25][3] - 1)*sc[19];
+
     /*reaction 1: H + O2 (+M) <=> HO2 (+M) */
     /*a pressure-fall-off reaction */
     /* also 3-body */
@@ -22657,8 +23444,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[0][0] - 1)*sc[5] + (TB[0][1] - 1)*sc[7] + (TB[0][2] - 1)*sc[18] + (TB[0][3] - 1)*sc[19];
     /* forward */
     phi_f = sc[0]*sc[7];
-    k_f = prefactor_units[0] * fwd_A[0]
-                * exp(fwd_beta[0] * tc[0] - activation_units[0] * fwd_Ea[0] * invT);
+    k_f = k_f_s[0];
     dlnkfdT = fwd_beta[0] * invT + activation_units[0] * fwd_Ea[0] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[0] * exp(low_beta[0] * tc[0] - activation_units[0] * low_Ea[0] * invT);
@@ -22674,16 +23460,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[0] == 4 ? exp(-troe_Tss[0] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
+      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
+      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
-      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
-      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -22691,7 +23477,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[3];
-    Kc = refCinv * exp(g_RT[0] - g_RT[3] + g_RT[7]);
+    Kc = Kc_s[0];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[7]) + (h_RT[3]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22709,101 +23495,40 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[7];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[3] += dqdci;                /* dwdot[HO2]/d[H] */
-        J[7] -= dqdci;                /* dwdot[O2]/d[H] */
-        /* d()/d[HO2] */
-        dqdci =  - k_r;
-        J[171] -= dqdci;              /* dwdot[H]/d[HO2] */
-        J[174] += dqdci;              /* dwdot[HO2]/d[HO2] */
-        J[178] -= dqdci;              /* dwdot[O2]/d[HO2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[0][0] - 1)*dcdc_fac;
-        J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[288] += dqdci;              /* dwdot[HO2]/d[H2O] */
-        J[292] -= dqdci;              /* dwdot[O2]/d[H2O] */
-        /* d()/d[O2] */
-        dqdci = (TB[0][1] - 1)*dcdc_fac + k_f*sc[0];
-        J[399] -= dqdci;              /* dwdot[H]/d[O2] */
-        J[402] += dqdci;              /* dwdot[HO2]/d[O2] */
-        J[406] -= dqdci;              /* dwdot[O2]/d[O2] */
-        /* d()/d[CO] */
-        dqdci = (TB[0][2] - 1)*dcdc_fac;
-        J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1029] += dqdci;             /* dwdot[HO2]/d[CO] */
-        J[1033] -= dqdci;             /* dwdot[O2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[0][3] - 1)*dcdc_fac;
-        J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1086] += dqdci;             /* dwdot[HO2]/d[CO2] */
-        J[1090] -= dqdci;             /* dwdot[O2]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[7];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac - k_r;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[0][0]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[0][1]*dcdc_fac + k_f*sc[0];
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[0][2]*dcdc_fac;
-        dqdc[19] = TB[0][3]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+0] -= dqdc[k];
-            J[57*k+3] += dqdc[k];
-            J[57*k+7] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[3] += dcdc_fac;
+    Jmix[7] -= dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[7];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[3] += dqdci;                /* dwdot[HO2]/d[H] */
+    J[7] -= dqdci;                /* dwdot[O2]/d[H] */
+    /* d()/d[HO2] */
+    dqdci =  - k_r;
+    J[171] -= dqdci;              /* dwdot[H]/d[HO2] */
+    J[174] += dqdci;              /* dwdot[HO2]/d[HO2] */
+    J[178] -= dqdci;              /* dwdot[O2]/d[HO2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[0][0] - 1)*dcdc_fac;
+    J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[288] += dqdci;              /* dwdot[HO2]/d[H2O] */
+    J[292] -= dqdci;              /* dwdot[O2]/d[H2O] */
+    /* d()/d[O2] */
+    dqdci = (TB[0][1] - 1)*dcdc_fac + k_f*sc[0];
+    J[399] -= dqdci;              /* dwdot[H]/d[O2] */
+    J[402] += dqdci;              /* dwdot[HO2]/d[O2] */
+    J[406] -= dqdci;              /* dwdot[O2]/d[O2] */
+    /* d()/d[CO] */
+    dqdci = (TB[0][2] - 1)*dcdc_fac;
+    J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1029] += dqdci;             /* dwdot[HO2]/d[CO] */
+    J[1033] -= dqdci;             /* dwdot[O2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[0][3] - 1)*dcdc_fac;
+    J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1086] += dqdci;             /* dwdot[HO2]/d[CO2] */
+    J[1090] -= dqdci;             /* dwdot[O2]/d[CO2] */
     J[3192] -= dqdT; /* dwdot[H]/dT */
     J[3195] += dqdT; /* dwdot[HO2]/dT */
     J[3199] -= dqdT; /* dwdot[O2]/dT */
@@ -22815,8 +23540,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[1][0] - 1)*sc[4] + (TB[1][1] - 1)*sc[5] + (TB[1][2] - 1)*sc[18] + (TB[1][3] - 1)*sc[19];
     /* forward */
     phi_f = sc[2]*sc[2];
-    k_f = prefactor_units[1] * fwd_A[1]
-                * exp(fwd_beta[1] * tc[0] - activation_units[1] * fwd_Ea[1] * invT);
+    k_f = k_f_s[1];
     dlnkfdT = fwd_beta[1] * invT + activation_units[1] * fwd_Ea[1] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[1] * exp(low_beta[1] * tc[0] - activation_units[1] * low_Ea[1] * invT);
@@ -22832,16 +23556,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[1] == 4 ? exp(-troe_Tss[1] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
+      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
+      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
-      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
-      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -22849,7 +23573,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[6];
-    Kc = refCinv * exp(2*g_RT[2] - g_RT[6]);
+    Kc = Kc_s[1];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[2]) + (h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22866,94 +23590,33 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[OH] */
-        dqdci =  + k_f*2*sc[2];
-        J[116] += -2 * dqdci;         /* dwdot[OH]/d[OH] */
-        J[120] += dqdci;              /* dwdot[H2O2]/d[OH] */
-        /* d()/d[H2] */
-        dqdci = (TB[1][0] - 1)*dcdc_fac;
-        J[230] += -2 * dqdci;         /* dwdot[OH]/d[H2] */
-        J[234] += dqdci;              /* dwdot[H2O2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[1][1] - 1)*dcdc_fac;
-        J[287] += -2 * dqdci;         /* dwdot[OH]/d[H2O] */
-        J[291] += dqdci;              /* dwdot[H2O2]/d[H2O] */
-        /* d()/d[H2O2] */
-        dqdci =  - k_r;
-        J[344] += -2 * dqdci;         /* dwdot[OH]/d[H2O2] */
-        J[348] += dqdci;              /* dwdot[H2O2]/d[H2O2] */
-        /* d()/d[CO] */
-        dqdci = (TB[1][2] - 1)*dcdc_fac;
-        J[1028] += -2 * dqdci;        /* dwdot[OH]/d[CO] */
-        J[1032] += dqdci;             /* dwdot[H2O2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[1][3] - 1)*dcdc_fac;
-        J[1085] += -2 * dqdci;        /* dwdot[OH]/d[CO2] */
-        J[1089] += dqdci;             /* dwdot[H2O2]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*2*sc[2];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[1][0]*dcdc_fac;
-        dqdc[5] = TB[1][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac - k_r;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[1][2]*dcdc_fac;
-        dqdc[19] = TB[1][3]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+2] += -2 * dqdc[k];
-            J[57*k+6] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] += -2 * dcdc_fac;
+    Jmix[6] += dcdc_fac;
+    /* d()/d[OH] */
+    dqdci =  + k_f*2*sc[2];
+    J[116] += -2 * dqdci;         /* dwdot[OH]/d[OH] */
+    J[120] += dqdci;              /* dwdot[H2O2]/d[OH] */
+    /* d()/d[H2] */
+    dqdci = (TB[1][0] - 1)*dcdc_fac;
+    J[230] += -2 * dqdci;         /* dwdot[OH]/d[H2] */
+    J[234] += dqdci;              /* dwdot[H2O2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[1][1] - 1)*dcdc_fac;
+    J[287] += -2 * dqdci;         /* dwdot[OH]/d[H2O] */
+    J[291] += dqdci;              /* dwdot[H2O2]/d[H2O] */
+    /* d()/d[H2O2] */
+    dqdci =  - k_r;
+    J[344] += -2 * dqdci;         /* dwdot[OH]/d[H2O2] */
+    J[348] += dqdci;              /* dwdot[H2O2]/d[H2O2] */
+    /* d()/d[CO] */
+    dqdci = (TB[1][2] - 1)*dcdc_fac;
+    J[1028] += -2 * dqdci;        /* dwdot[OH]/d[CO] */
+    J[1032] += dqdci;             /* dwdot[H2O2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[1][3] - 1)*dcdc_fac;
+    J[1085] += -2 * dqdci;        /* dwdot[OH]/d[CO2] */
+    J[1089] += dqdci;             /* dwdot[H2O2]/d[CO2] */
     J[3194] += -2 * dqdT; /* dwdot[OH]/dT */
     J[3198] += dqdT; /* dwdot[H2O2]/dT */
 
@@ -22961,11 +23624,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[2][0] - 1)*sc[4] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[12] + (TB[2][3] - 1)*sc[18] + (TB[2][4] - 1)*sc[19] + (TB[2][5] - 1)*sc[25];
+    alpha = alpha_eff0;
     /* forward */
     phi_f = sc[9]*sc[18];
-    k_f = prefactor_units[2] * fwd_A[2]
-                * exp(fwd_beta[2] * tc[0] - activation_units[2] * fwd_Ea[2] * invT);
+    k_f = k_f_s[2];
     dlnkfdT = fwd_beta[2] * invT + activation_units[2] * fwd_Ea[2] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[2] * exp(low_beta[2] * tc[0] - activation_units[2] * low_Ea[2] * invT);
@@ -22981,16 +23643,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[2] == 4 ? exp(-troe_Tss[2] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[2]) > 1.e-100 ? -Fcent1/troe_Tsss[2] : 0.)
+      + (fabs(troe_Ts[2]) > 1.e-100 ? -Fcent2/troe_Ts[2] : 0.)
+      + (troe_len[2] == 4 ? Fcent3*troe_Tss[2]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[2]) > 1.e-100 ? -Fcent1/troe_Tsss[2] : 0.)
-      + (fabs(troe_Ts[2]) > 1.e-100 ? -Fcent2/troe_Ts[2] : 0.)
-      + (troe_len[2] == 4 ? Fcent3*troe_Tss[2]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -22998,7 +23660,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[27];
-    Kc = refCinv * exp(g_RT[9] + g_RT[18] - g_RT[27]);
+    Kc = Kc_s[2];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[18]) + (h_RT[27]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23016,111 +23678,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[2][0] - 1)*dcdc_fac;
-        J[237] -= dqdci;              /* dwdot[CH2]/d[H2] */
-        J[246] -= dqdci;              /* dwdot[CO]/d[H2] */
-        J[255] += dqdci;              /* dwdot[CH2CO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[2][1] - 1)*dcdc_fac;
-        J[294] -= dqdci;              /* dwdot[CH2]/d[H2O] */
-        J[303] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[312] += dqdci;              /* dwdot[CH2CO]/d[H2O] */
-        /* d()/d[CH2] */
-        dqdci =  + k_f*sc[18];
-        J[522] -= dqdci;              /* dwdot[CH2]/d[CH2] */
-        J[531] -= dqdci;              /* dwdot[CO]/d[CH2] */
-        J[540] += dqdci;              /* dwdot[CH2CO]/d[CH2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[2][2] - 1)*dcdc_fac;
-        J[693] -= dqdci;              /* dwdot[CH2]/d[CH4] */
-        J[702] -= dqdci;              /* dwdot[CO]/d[CH4] */
-        J[711] += dqdci;              /* dwdot[CH2CO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[2][3] - 1)*dcdc_fac + k_f*sc[9];
-        J[1035] -= dqdci;             /* dwdot[CH2]/d[CO] */
-        J[1044] -= dqdci;             /* dwdot[CO]/d[CO] */
-        J[1053] += dqdci;             /* dwdot[CH2CO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[2][4] - 1)*dcdc_fac;
-        J[1092] -= dqdci;             /* dwdot[CH2]/d[CO2] */
-        J[1101] -= dqdci;             /* dwdot[CO]/d[CO2] */
-        J[1110] += dqdci;             /* dwdot[CH2CO]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[2][5] - 1)*dcdc_fac;
-        J[1434] -= dqdci;             /* dwdot[CH2]/d[C2H6] */
-        J[1443] -= dqdci;             /* dwdot[CO]/d[C2H6] */
-        J[1452] += dqdci;             /* dwdot[CH2CO]/d[C2H6] */
-        /* d()/d[CH2CO] */
-        dqdci =  - k_r;
-        J[1548] -= dqdci;             /* dwdot[CH2]/d[CH2CO] */
-        J[1557] -= dqdci;             /* dwdot[CO]/d[CH2CO] */
-        J[1566] += dqdci;             /* dwdot[CH2CO]/d[CH2CO] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[2][0]*dcdc_fac;
-        dqdc[5] = TB[2][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac + k_f*sc[18];
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = TB[2][2]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[2][3]*dcdc_fac + k_f*sc[9];
-        dqdc[19] = TB[2][4]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = TB[2][5]*dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac - k_r;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+9] -= dqdc[k];
-            J[57*k+18] -= dqdc[k];
-            J[57*k+27] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[9] -= dcdc_fac;
+    Jmix[18] -= dcdc_fac;
+    Jmix[27] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[2][0] - 1)*dcdc_fac;
+    J[237] -= dqdci;              /* dwdot[CH2]/d[H2] */
+    J[246] -= dqdci;              /* dwdot[CO]/d[H2] */
+    J[255] += dqdci;              /* dwdot[CH2CO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[2][1] - 1)*dcdc_fac;
+    J[294] -= dqdci;              /* dwdot[CH2]/d[H2O] */
+    J[303] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[312] += dqdci;              /* dwdot[CH2CO]/d[H2O] */
+    /* d()/d[CH2] */
+    dqdci =  + k_f*sc[18];
+    J[522] -= dqdci;              /* dwdot[CH2]/d[CH2] */
+    J[531] -= dqdci;              /* dwdot[CO]/d[CH2] */
+    J[540] += dqdci;              /* dwdot[CH2CO]/d[CH2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[2][2] - 1)*dcdc_fac;
+    J[693] -= dqdci;              /* dwdot[CH2]/d[CH4] */
+    J[702] -= dqdci;              /* dwdot[CO]/d[CH4] */
+    J[711] += dqdci;              /* dwdot[CH2CO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[2][3] - 1)*dcdc_fac + k_f*sc[9];
+    J[1035] -= dqdci;             /* dwdot[CH2]/d[CO] */
+    J[1044] -= dqdci;             /* dwdot[CO]/d[CO] */
+    J[1053] += dqdci;             /* dwdot[CH2CO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[2][4] - 1)*dcdc_fac;
+    J[1092] -= dqdci;             /* dwdot[CH2]/d[CO2] */
+    J[1101] -= dqdci;             /* dwdot[CO]/d[CO2] */
+    J[1110] += dqdci;             /* dwdot[CH2CO]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[2][5] - 1)*dcdc_fac;
+    J[1434] -= dqdci;             /* dwdot[CH2]/d[C2H6] */
+    J[1443] -= dqdci;             /* dwdot[CO]/d[C2H6] */
+    J[1452] += dqdci;             /* dwdot[CH2CO]/d[C2H6] */
+    /* d()/d[CH2CO] */
+    dqdci =  - k_r;
+    J[1548] -= dqdci;             /* dwdot[CH2]/d[CH2CO] */
+    J[1557] -= dqdci;             /* dwdot[CO]/d[CH2CO] */
+    J[1566] += dqdci;             /* dwdot[CH2CO]/d[CH2CO] */
     J[3201] -= dqdT; /* dwdot[CH2]/dT */
     J[3210] -= dqdT; /* dwdot[CO]/dT */
     J[3219] += dqdT; /* dwdot[CH2CO]/dT */
@@ -23129,14 +23730,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[3][0] - 1)*sc[4] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[12] + (TB[3][3] - 1)*sc[18] + (TB[3][4] - 1)*sc[19] + (TB[3][5] - 1)*sc[25];
+    alpha = (memcmp(TB[3], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[3][0] - 1)*sc[4] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[12] + (TB[3][3] - 1)*sc[18] + (TB[3][4] - 1)*sc[19] + (TB[3][5] - 1)*sc[25]);
     /* forward */
     phi_f = sc[5]*sc[10];
-    k_f = prefactor_units[3] * fwd_A[3]
-                * exp(fwd_beta[3] * tc[0] - activation_units[3] * fwd_Ea[3] * invT);
+    k_f = k_f_s[3];
     dlnkfdT = fwd_beta[3] * invT + activation_units[3] * fwd_Ea[3] * invT2;
     /* pressure-fall-off */
-    k_0 = low_A[3] * exp(low_beta[3] * tc[0] - activation_units[3] * low_Ea[3] * invT);
+    x_0 = low_beta[3] * tc[0] - activation_units[3] * low_Ea[3] * invT;
+    x_0_s[0] = x_0;
+    e_0_s[0] = exp(x_0);
+    k_0 = low_A[3] * e_0_s[0];
     Pr = phase_units[3] * alpha / k_f * k_0;
     fPr = Pr / (1.0+Pr);
     dlnk0dT = low_beta[3] * invT + activation_units[3] * low_Ea[3] * invT2;
@@ -23149,16 +23752,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[3] == 4 ? exp(-troe_Tss[3] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[3]) > 1.e-100 ? -Fcent1/troe_Tsss[3] : 0.)
+      + (fabs(troe_Ts[3]) > 1.e-100 ? -Fcent2/troe_Ts[3] : 0.)
+      + (troe_len[3] == 4 ? Fcent3*troe_Tss[3]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[3]) > 1.e-100 ? -Fcent1/troe_Tsss[3] : 0.)
-      + (fabs(troe_Ts[3]) > 1.e-100 ? -Fcent2/troe_Ts[3] : 0.)
-      + (troe_len[3] == 4 ? Fcent3*troe_Tss[3]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -23166,7 +23769,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[17];
-    Kc = refCinv * exp(g_RT[5] + g_RT[10] - g_RT[17]);
+    Kc = Kc_s[3];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[10]) + (h_RT[17]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23184,111 +23787,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[3][0] - 1)*dcdc_fac;
-        J[233] -= dqdci;              /* dwdot[H2O]/d[H2] */
-        J[238] -= dqdci;              /* dwdot[CH2*]/d[H2] */
-        J[245] += dqdci;              /* dwdot[CH3OH]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[3][1] - 1)*dcdc_fac + k_f*sc[10];
-        J[290] -= dqdci;              /* dwdot[H2O]/d[H2O] */
-        J[295] -= dqdci;              /* dwdot[CH2*]/d[H2O] */
-        J[302] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
-        /* d()/d[CH2*] */
-        dqdci =  + k_f*sc[5];
-        J[575] -= dqdci;              /* dwdot[H2O]/d[CH2*] */
-        J[580] -= dqdci;              /* dwdot[CH2*]/d[CH2*] */
-        J[587] += dqdci;              /* dwdot[CH3OH]/d[CH2*] */
-        /* d()/d[CH4] */
-        dqdci = (TB[3][2] - 1)*dcdc_fac;
-        J[689] -= dqdci;              /* dwdot[H2O]/d[CH4] */
-        J[694] -= dqdci;              /* dwdot[CH2*]/d[CH4] */
-        J[701] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
-        /* d()/d[CH3OH] */
-        dqdci =  - k_r;
-        J[974] -= dqdci;              /* dwdot[H2O]/d[CH3OH] */
-        J[979] -= dqdci;              /* dwdot[CH2*]/d[CH3OH] */
-        J[986] += dqdci;              /* dwdot[CH3OH]/d[CH3OH] */
-        /* d()/d[CO] */
-        dqdci = (TB[3][3] - 1)*dcdc_fac;
-        J[1031] -= dqdci;             /* dwdot[H2O]/d[CO] */
-        J[1036] -= dqdci;             /* dwdot[CH2*]/d[CO] */
-        J[1043] += dqdci;             /* dwdot[CH3OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[3][4] - 1)*dcdc_fac;
-        J[1088] -= dqdci;             /* dwdot[H2O]/d[CO2] */
-        J[1093] -= dqdci;             /* dwdot[CH2*]/d[CO2] */
-        J[1100] += dqdci;             /* dwdot[CH3OH]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[3][5] - 1)*dcdc_fac;
-        J[1430] -= dqdci;             /* dwdot[H2O]/d[C2H6] */
-        J[1435] -= dqdci;             /* dwdot[CH2*]/d[C2H6] */
-        J[1442] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[3][0]*dcdc_fac;
-        dqdc[5] = TB[3][1]*dcdc_fac + k_f*sc[10];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac + k_f*sc[5];
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = TB[3][2]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac - k_r;
-        dqdc[18] = TB[3][3]*dcdc_fac;
-        dqdc[19] = TB[3][4]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = TB[3][5]*dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+5] -= dqdc[k];
-            J[57*k+10] -= dqdc[k];
-            J[57*k+17] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[5] -= dcdc_fac;
+    Jmix[10] -= dcdc_fac;
+    Jmix[17] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[3][0] - 1)*dcdc_fac;
+    J[233] -= dqdci;              /* dwdot[H2O]/d[H2] */
+    J[238] -= dqdci;              /* dwdot[CH2*]/d[H2] */
+    J[245] += dqdci;              /* dwdot[CH3OH]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[3][1] - 1)*dcdc_fac + k_f*sc[10];
+    J[290] -= dqdci;              /* dwdot[H2O]/d[H2O] */
+    J[295] -= dqdci;              /* dwdot[CH2*]/d[H2O] */
+    J[302] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
+    /* d()/d[CH2*] */
+    dqdci =  + k_f*sc[5];
+    J[575] -= dqdci;              /* dwdot[H2O]/d[CH2*] */
+    J[580] -= dqdci;              /* dwdot[CH2*]/d[CH2*] */
+    J[587] += dqdci;              /* dwdot[CH3OH]/d[CH2*] */
+    /* d()/d[CH4] */
+    dqdci = (TB[3][2] - 1)*dcdc_fac;
+    J[689] -= dqdci;              /* dwdot[H2O]/d[CH4] */
+    J[694] -= dqdci;              /* dwdot[CH2*]/d[CH4] */
+    J[701] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
+    /* d()/d[CH3OH] */
+    dqdci =  - k_r;
+    J[974] -= dqdci;              /* dwdot[H2O]/d[CH3OH] */
+    J[979] -= dqdci;              /* dwdot[CH2*]/d[CH3OH] */
+    J[986] += dqdci;              /* dwdot[CH3OH]/d[CH3OH] */
+    /* d()/d[CO] */
+    dqdci = (TB[3][3] - 1)*dcdc_fac;
+    J[1031] -= dqdci;             /* dwdot[H2O]/d[CO] */
+    J[1036] -= dqdci;             /* dwdot[CH2*]/d[CO] */
+    J[1043] += dqdci;             /* dwdot[CH3OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[3][4] - 1)*dcdc_fac;
+    J[1088] -= dqdci;             /* dwdot[H2O]/d[CO2] */
+    J[1093] -= dqdci;             /* dwdot[CH2*]/d[CO2] */
+    J[1100] += dqdci;             /* dwdot[CH3OH]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[3][5] - 1)*dcdc_fac;
+    J[1430] -= dqdci;             /* dwdot[H2O]/d[C2H6] */
+    J[1435] -= dqdci;             /* dwdot[CH2*]/d[C2H6] */
+    J[1442] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
     J[3197] -= dqdT; /* dwdot[H2O]/dT */
     J[3202] -= dqdT; /* dwdot[CH2*]/dT */
     J[3209] += dqdT; /* dwdot[CH3OH]/dT */
@@ -23297,11 +23839,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[4][0] - 1)*sc[4] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[12] + (TB[4][3] - 1)*sc[18] + (TB[4][4] - 1)*sc[19] + (TB[4][5] - 1)*sc[25];
+    alpha = (memcmp(TB[4], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[4][0] - 1)*sc[4] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[12] + (TB[4][3] - 1)*sc[18] + (TB[4][4] - 1)*sc[19] + (TB[4][5] - 1)*sc[25]);
     /* forward */
     phi_f = sc[0]*sc[14];
-    k_f = prefactor_units[4] * fwd_A[4]
-                * exp(fwd_beta[4] * tc[0] - activation_units[4] * fwd_Ea[4] * invT);
+    k_f = k_f_s[4];
     dlnkfdT = fwd_beta[4] * invT + activation_units[4] * fwd_Ea[4] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[4] * exp(low_beta[4] * tc[0] - activation_units[4] * low_Ea[4] * invT);
@@ -23317,16 +23858,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[4] == 4 ? exp(-troe_Tss[4] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[4]) > 1.e-100 ? -Fcent1/troe_Tsss[4] : 0.)
+      + (fabs(troe_Ts[4]) > 1.e-100 ? -Fcent2/troe_Ts[4] : 0.)
+      + (troe_len[4] == 4 ? Fcent3*troe_Tss[4]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[4]) > 1.e-100 ? -Fcent1/troe_Tsss[4] : 0.)
-      + (fabs(troe_Ts[4]) > 1.e-100 ? -Fcent2/troe_Ts[4] : 0.)
-      + (troe_len[4] == 4 ? Fcent3*troe_Tss[4]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -23334,7 +23875,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[16];
-    Kc = refCinv * exp(g_RT[0] + g_RT[14] - g_RT[16]);
+    Kc = Kc_s[4];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[14]) + (h_RT[16]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23352,116 +23893,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[14];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[14] -= dqdci;               /* dwdot[CH2O]/d[H] */
-        J[16] += dqdci;               /* dwdot[CH2OH]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[4][0] - 1)*dcdc_fac;
-        J[228] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[242] -= dqdci;              /* dwdot[CH2O]/d[H2] */
-        J[244] += dqdci;              /* dwdot[CH2OH]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[4][1] - 1)*dcdc_fac;
-        J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[299] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
-        J[301] += dqdci;              /* dwdot[CH2OH]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[4][2] - 1)*dcdc_fac;
-        J[684] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[698] -= dqdci;              /* dwdot[CH2O]/d[CH4] */
-        J[700] += dqdci;              /* dwdot[CH2OH]/d[CH4] */
-        /* d()/d[CH2O] */
-        dqdci =  + k_f*sc[0];
-        J[798] -= dqdci;              /* dwdot[H]/d[CH2O] */
-        J[812] -= dqdci;              /* dwdot[CH2O]/d[CH2O] */
-        J[814] += dqdci;              /* dwdot[CH2OH]/d[CH2O] */
-        /* d()/d[CH2OH] */
-        dqdci =  - k_r;
-        J[912] -= dqdci;              /* dwdot[H]/d[CH2OH] */
-        J[926] -= dqdci;              /* dwdot[CH2O]/d[CH2OH] */
-        J[928] += dqdci;              /* dwdot[CH2OH]/d[CH2OH] */
-        /* d()/d[CO] */
-        dqdci = (TB[4][3] - 1)*dcdc_fac;
-        J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1040] -= dqdci;             /* dwdot[CH2O]/d[CO] */
-        J[1042] += dqdci;             /* dwdot[CH2OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[4][4] - 1)*dcdc_fac;
-        J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1097] -= dqdci;             /* dwdot[CH2O]/d[CO2] */
-        J[1099] += dqdci;             /* dwdot[CH2OH]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[4][5] - 1)*dcdc_fac;
-        J[1425] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1439] -= dqdci;             /* dwdot[CH2O]/d[C2H6] */
-        J[1441] += dqdci;             /* dwdot[CH2OH]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[14];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[4][0]*dcdc_fac;
-        dqdc[5] = TB[4][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = TB[4][2]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac + k_f*sc[0];
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac - k_r;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[4][3]*dcdc_fac;
-        dqdc[19] = TB[4][4]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = TB[4][5]*dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+0] -= dqdc[k];
-            J[57*k+14] -= dqdc[k];
-            J[57*k+16] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[14] -= dcdc_fac;
+    Jmix[16] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[14];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[14] -= dqdci;               /* dwdot[CH2O]/d[H] */
+    J[16] += dqdci;               /* dwdot[CH2OH]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[4][0] - 1)*dcdc_fac;
+    J[228] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[242] -= dqdci;              /* dwdot[CH2O]/d[H2] */
+    J[244] += dqdci;              /* dwdot[CH2OH]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[4][1] - 1)*dcdc_fac;
+    J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[299] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
+    J[301] += dqdci;              /* dwdot[CH2OH]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[4][2] - 1)*dcdc_fac;
+    J[684] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[698] -= dqdci;              /* dwdot[CH2O]/d[CH4] */
+    J[700] += dqdci;              /* dwdot[CH2OH]/d[CH4] */
+    /* d()/d[CH2O] */
+    dqdci =  + k_f*sc[0];
+    J[798] -= dqdci;              /* dwdot[H]/d[CH2O] */
+    J[812] -= dqdci;              /* dwdot[CH2O]/d[CH2O] */
+    J[814] += dqdci;              /* dwdot[CH2OH]/d[CH2O] */
+    /* d()/d[CH2OH] */
+    dqdci =  - k_r;
+    J[912] -= dqdci;              /* dwdot[H]/d[CH2OH] */
+    J[926] -= dqdci;              /* dwdot[CH2O]/d[CH2OH] */
+    J[928] += dqdci;              /* dwdot[CH2OH]/d[CH2OH] */
+    /* d()/d[CO] */
+    dqdci = (TB[4][3] - 1)*dcdc_fac;
+    J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1040] -= dqdci;             /* dwdot[CH2O]/d[CO] */
+    J[1042] += dqdci;             /* dwdot[CH2OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[4][4] - 1)*dcdc_fac;
+    J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1097] -= dqdci;             /* dwdot[CH2O]/d[CO2] */
+    J[1099] += dqdci;             /* dwdot[CH2OH]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[4][5] - 1)*dcdc_fac;
+    J[1425] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1439] -= dqdci;             /* dwdot[CH2O]/d[C2H6] */
+    J[1441] += dqdci;             /* dwdot[CH2OH]/d[C2H6] */
     J[3192] -= dqdT; /* dwdot[H]/dT */
     J[3206] -= dqdT; /* dwdot[CH2O]/dT */
     J[3208] += dqdT; /* dwdot[CH2OH]/dT */
@@ -23470,11 +23950,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[5][0] - 1)*sc[4] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[12] + (TB[5][3] - 1)*sc[18] + (TB[5][4] - 1)*sc[19] + (TB[5][5] - 1)*sc[25];
+    alpha = (memcmp(TB[5], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[5][0] - 1)*sc[4] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[12] + (TB[5][3] - 1)*sc[18] + (TB[5][4] - 1)*sc[19] + (TB[5][5] - 1)*sc[25]);
     /* forward */
     phi_f = sc[0]*sc[14];
-    k_f = prefactor_units[5] * fwd_A[5]
-                * exp(fwd_beta[5] * tc[0] - activation_units[5] * fwd_Ea[5] * invT);
+    k_f = k_f_s[5];
     dlnkfdT = fwd_beta[5] * invT + activation_units[5] * fwd_Ea[5] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[5] * exp(low_beta[5] * tc[0] - activation_units[5] * low_Ea[5] * invT);
@@ -23490,16 +23969,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[5] == 4 ? exp(-troe_Tss[5] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[5]) > 1.e-100 ? -Fcent1/troe_Tsss[5] : 0.)
+      + (fabs(troe_Ts[5]) > 1.e-100 ? -Fcent2/troe_Ts[5] : 0.)
+      + (troe_len[5] == 4 ? Fcent3*troe_Tss[5]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[5]) > 1.e-100 ? -Fcent1/troe_Tsss[5] : 0.)
-      + (fabs(troe_Ts[5]) > 1.e-100 ? -Fcent2/troe_Ts[5] : 0.)
-      + (troe_len[5] == 4 ? Fcent3*troe_Tss[5]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -23507,7 +23986,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[15];
-    Kc = refCinv * exp(g_RT[0] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[5];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[14]) + (h_RT[15]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23525,116 +24004,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[14];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[14] -= dqdci;               /* dwdot[CH2O]/d[H] */
-        J[15] += dqdci;               /* dwdot[CH3O]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[5][0] - 1)*dcdc_fac;
-        J[228] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[242] -= dqdci;              /* dwdot[CH2O]/d[H2] */
-        J[243] += dqdci;              /* dwdot[CH3O]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[5][1] - 1)*dcdc_fac;
-        J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[299] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
-        J[300] += dqdci;              /* dwdot[CH3O]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[5][2] - 1)*dcdc_fac;
-        J[684] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[698] -= dqdci;              /* dwdot[CH2O]/d[CH4] */
-        J[699] += dqdci;              /* dwdot[CH3O]/d[CH4] */
-        /* d()/d[CH2O] */
-        dqdci =  + k_f*sc[0];
-        J[798] -= dqdci;              /* dwdot[H]/d[CH2O] */
-        J[812] -= dqdci;              /* dwdot[CH2O]/d[CH2O] */
-        J[813] += dqdci;              /* dwdot[CH3O]/d[CH2O] */
-        /* d()/d[CH3O] */
-        dqdci =  - k_r;
-        J[855] -= dqdci;              /* dwdot[H]/d[CH3O] */
-        J[869] -= dqdci;              /* dwdot[CH2O]/d[CH3O] */
-        J[870] += dqdci;              /* dwdot[CH3O]/d[CH3O] */
-        /* d()/d[CO] */
-        dqdci = (TB[5][3] - 1)*dcdc_fac;
-        J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1040] -= dqdci;             /* dwdot[CH2O]/d[CO] */
-        J[1041] += dqdci;             /* dwdot[CH3O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[5][4] - 1)*dcdc_fac;
-        J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1097] -= dqdci;             /* dwdot[CH2O]/d[CO2] */
-        J[1098] += dqdci;             /* dwdot[CH3O]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[5][5] - 1)*dcdc_fac;
-        J[1425] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1439] -= dqdci;             /* dwdot[CH2O]/d[C2H6] */
-        J[1440] += dqdci;             /* dwdot[CH3O]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[14];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[5][0]*dcdc_fac;
-        dqdc[5] = TB[5][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = TB[5][2]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac + k_f*sc[0];
-        dqdc[15] = dcdc_fac - k_r;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[5][3]*dcdc_fac;
-        dqdc[19] = TB[5][4]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = TB[5][5]*dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+0] -= dqdc[k];
-            J[57*k+14] -= dqdc[k];
-            J[57*k+15] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[14] -= dcdc_fac;
+    Jmix[15] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[14];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[14] -= dqdci;               /* dwdot[CH2O]/d[H] */
+    J[15] += dqdci;               /* dwdot[CH3O]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[5][0] - 1)*dcdc_fac;
+    J[228] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[242] -= dqdci;              /* dwdot[CH2O]/d[H2] */
+    J[243] += dqdci;              /* dwdot[CH3O]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[5][1] - 1)*dcdc_fac;
+    J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[299] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
+    J[300] += dqdci;              /* dwdot[CH3O]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[5][2] - 1)*dcdc_fac;
+    J[684] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[698] -= dqdci;              /* dwdot[CH2O]/d[CH4] */
+    J[699] += dqdci;              /* dwdot[CH3O]/d[CH4] */
+    /* d()/d[CH2O] */
+    dqdci =  + k_f*sc[0];
+    J[798] -= dqdci;              /* dwdot[H]/d[CH2O] */
+    J[812] -= dqdci;              /* dwdot[CH2O]/d[CH2O] */
+    J[813] += dqdci;              /* dwdot[CH3O]/d[CH2O] */
+    /* d()/d[CH3O] */
+    dqdci =  - k_r;
+    J[855] -= dqdci;              /* dwdot[H]/d[CH3O] */
+    J[869] -= dqdci;              /* dwdot[CH2O]/d[CH3O] */
+    J[870] += dqdci;              /* dwdot[CH3O]/d[CH3O] */
+    /* d()/d[CO] */
+    dqdci = (TB[5][3] - 1)*dcdc_fac;
+    J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1040] -= dqdci;             /* dwdot[CH2O]/d[CO] */
+    J[1041] += dqdci;             /* dwdot[CH3O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[5][4] - 1)*dcdc_fac;
+    J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1097] -= dqdci;             /* dwdot[CH2O]/d[CO2] */
+    J[1098] += dqdci;             /* dwdot[CH3O]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[5][5] - 1)*dcdc_fac;
+    J[1425] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1439] -= dqdci;             /* dwdot[CH2O]/d[C2H6] */
+    J[1440] += dqdci;             /* dwdot[CH3O]/d[C2H6] */
     J[3192] -= dqdT; /* dwdot[H]/dT */
     J[3206] -= dqdT; /* dwdot[CH2O]/dT */
     J[3207] += dqdT; /* dwdot[CH3O]/dT */
@@ -23643,11 +24061,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[6][0] - 1)*sc[4] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[12] + (TB[6][3] - 1)*sc[18] + (TB[6][4] - 1)*sc[19] + (TB[6][5] - 1)*sc[25];
+    alpha = (memcmp(TB[6], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[6][0] - 1)*sc[4] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[12] + (TB[6][3] - 1)*sc[18] + (TB[6][4] - 1)*sc[19] + (TB[6][5] - 1)*sc[25]);
     /* forward */
     phi_f = sc[0]*sc[11];
-    k_f = prefactor_units[6] * fwd_A[6]
-                * exp(fwd_beta[6] * tc[0] - activation_units[6] * fwd_Ea[6] * invT);
+    k_f = k_f_s[6];
     dlnkfdT = fwd_beta[6] * invT + activation_units[6] * fwd_Ea[6] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[6] * exp(low_beta[6] * tc[0] - activation_units[6] * low_Ea[6] * invT);
@@ -23663,16 +24080,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[6] == 4 ? exp(-troe_Tss[6] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[6]) > 1.e-100 ? -Fcent1/troe_Tsss[6] : 0.)
+      + (fabs(troe_Ts[6]) > 1.e-100 ? -Fcent2/troe_Ts[6] : 0.)
+      + (troe_len[6] == 4 ? Fcent3*troe_Tss[6]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[6]) > 1.e-100 ? -Fcent1/troe_Tsss[6] : 0.)
-      + (fabs(troe_Ts[6]) > 1.e-100 ? -Fcent2/troe_Ts[6] : 0.)
-      + (troe_len[6] == 4 ? Fcent3*troe_Tss[6]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -23680,7 +24097,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[12];
-    Kc = refCinv * exp(g_RT[0] + g_RT[11] - g_RT[12]);
+    Kc = Kc_s[6];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[11]) + (h_RT[12]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23698,111 +24115,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[11];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[11] -= dqdci;               /* dwdot[CH3]/d[H] */
-        J[12] += dqdci;               /* dwdot[CH4]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[6][0] - 1)*dcdc_fac;
-        J[228] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[239] -= dqdci;              /* dwdot[CH3]/d[H2] */
-        J[240] += dqdci;              /* dwdot[CH4]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[6][1] - 1)*dcdc_fac;
-        J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[296] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[297] += dqdci;              /* dwdot[CH4]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[0];
-        J[627] -= dqdci;              /* dwdot[H]/d[CH3] */
-        J[638] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[639] += dqdci;              /* dwdot[CH4]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[6][2] - 1)*dcdc_fac - k_r;
-        J[684] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[695] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[696] += dqdci;              /* dwdot[CH4]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[6][3] - 1)*dcdc_fac;
-        J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1037] -= dqdci;             /* dwdot[CH3]/d[CO] */
-        J[1038] += dqdci;             /* dwdot[CH4]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[6][4] - 1)*dcdc_fac;
-        J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1094] -= dqdci;             /* dwdot[CH3]/d[CO2] */
-        J[1095] += dqdci;             /* dwdot[CH4]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[6][5] - 1)*dcdc_fac;
-        J[1425] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1436] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
-        J[1437] += dqdci;             /* dwdot[CH4]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[11];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[6][0]*dcdc_fac;
-        dqdc[5] = TB[6][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac + k_f*sc[0];
-        dqdc[12] = TB[6][2]*dcdc_fac - k_r;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[6][3]*dcdc_fac;
-        dqdc[19] = TB[6][4]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = TB[6][5]*dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+0] -= dqdc[k];
-            J[57*k+11] -= dqdc[k];
-            J[57*k+12] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[11] -= dcdc_fac;
+    Jmix[12] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[11];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[11] -= dqdci;               /* dwdot[CH3]/d[H] */
+    J[12] += dqdci;               /* dwdot[CH4]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[6][0] - 1)*dcdc_fac;
+    J[228] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[239] -= dqdci;              /* dwdot[CH3]/d[H2] */
+    J[240] += dqdci;              /* dwdot[CH4]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[6][1] - 1)*dcdc_fac;
+    J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[296] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[297] += dqdci;              /* dwdot[CH4]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[0];
+    J[627] -= dqdci;              /* dwdot[H]/d[CH3] */
+    J[638] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[639] += dqdci;              /* dwdot[CH4]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[6][2] - 1)*dcdc_fac - k_r;
+    J[684] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[695] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[696] += dqdci;              /* dwdot[CH4]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[6][3] - 1)*dcdc_fac;
+    J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1037] -= dqdci;             /* dwdot[CH3]/d[CO] */
+    J[1038] += dqdci;             /* dwdot[CH4]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[6][4] - 1)*dcdc_fac;
+    J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1094] -= dqdci;             /* dwdot[CH3]/d[CO2] */
+    J[1095] += dqdci;             /* dwdot[CH4]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[6][5] - 1)*dcdc_fac;
+    J[1425] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1436] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
+    J[1437] += dqdci;             /* dwdot[CH4]/d[C2H6] */
     J[3192] -= dqdT; /* dwdot[H]/dT */
     J[3203] -= dqdT; /* dwdot[CH3]/dT */
     J[3204] += dqdT; /* dwdot[CH4]/dT */
@@ -23811,14 +24167,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[7][0] - 1)*sc[4] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[12] + (TB[7][3] - 1)*sc[18] + (TB[7][4] - 1)*sc[19] + (TB[7][5] - 1)*sc[25];
+    alpha = (memcmp(TB[7], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[7][0] - 1)*sc[4] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[12] + (TB[7][3] - 1)*sc[18] + (TB[7][4] - 1)*sc[19] + (TB[7][5] - 1)*sc[25]);
     /* forward */
     phi_f = sc[2]*sc[11];
-    k_f = prefactor_units[7] * fwd_A[7]
-                * exp(fwd_beta[7] * tc[0] - activation_units[7] * fwd_Ea[7] * invT);
+    k_f = k_f_s[7];
     dlnkfdT = fwd_beta[7] * invT + activation_units[7] * fwd_Ea[7] * invT2;
     /* pressure-fall-off */
-    k_0 = low_A[7] * exp(low_beta[7] * tc[0] - activation_units[7] * low_Ea[7] * invT);
+    x_0 = low_beta[7] * tc[0] - activation_units[7] * low_Ea[7] * invT;
+    k_0 = low_A[7] * (x_0 == x_0_s[0] ? e_0_s[0] : exp(x_0));
     Pr = phase_units[7] * alpha / k_f * k_0;
     fPr = Pr / (1.0+Pr);
     dlnk0dT = low_beta[7] * invT + activation_units[7] * low_Ea[7] * invT2;
@@ -23831,16 +24187,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[7] == 4 ? exp(-troe_Tss[7] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[7]) > 1.e-100 ? -Fcent1/troe_Tsss[7] : 0.)
+      + (fabs(troe_Ts[7]) > 1.e-100 ? -Fcent2/troe_Ts[7] : 0.)
+      + (troe_len[7] == 4 ? Fcent3*troe_Tss[7]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[7]) > 1.e-100 ? -Fcent1/troe_Tsss[7] : 0.)
-      + (fabs(troe_Ts[7]) > 1.e-100 ? -Fcent2/troe_Ts[7] : 0.)
-      + (troe_len[7] == 4 ? Fcent3*troe_Tss[7]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -23848,7 +24204,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[17];
-    Kc = refCinv * exp(g_RT[2] + g_RT[11] - g_RT[17]);
+    Kc = Kc_s[7];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[11]) + (h_RT[17]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23866,116 +24222,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[OH] */
-        dqdci =  + k_f*sc[11];
-        J[116] -= dqdci;              /* dwdot[OH]/d[OH] */
-        J[125] -= dqdci;              /* dwdot[CH3]/d[OH] */
-        J[131] += dqdci;              /* dwdot[CH3OH]/d[OH] */
-        /* d()/d[H2] */
-        dqdci = (TB[7][0] - 1)*dcdc_fac;
-        J[230] -= dqdci;              /* dwdot[OH]/d[H2] */
-        J[239] -= dqdci;              /* dwdot[CH3]/d[H2] */
-        J[245] += dqdci;              /* dwdot[CH3OH]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[7][1] - 1)*dcdc_fac;
-        J[287] -= dqdci;              /* dwdot[OH]/d[H2O] */
-        J[296] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[302] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[2];
-        J[629] -= dqdci;              /* dwdot[OH]/d[CH3] */
-        J[638] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[644] += dqdci;              /* dwdot[CH3OH]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[7][2] - 1)*dcdc_fac;
-        J[686] -= dqdci;              /* dwdot[OH]/d[CH4] */
-        J[695] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[701] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
-        /* d()/d[CH3OH] */
-        dqdci =  - k_r;
-        J[971] -= dqdci;              /* dwdot[OH]/d[CH3OH] */
-        J[980] -= dqdci;              /* dwdot[CH3]/d[CH3OH] */
-        J[986] += dqdci;              /* dwdot[CH3OH]/d[CH3OH] */
-        /* d()/d[CO] */
-        dqdci = (TB[7][3] - 1)*dcdc_fac;
-        J[1028] -= dqdci;             /* dwdot[OH]/d[CO] */
-        J[1037] -= dqdci;             /* dwdot[CH3]/d[CO] */
-        J[1043] += dqdci;             /* dwdot[CH3OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[7][4] - 1)*dcdc_fac;
-        J[1085] -= dqdci;             /* dwdot[OH]/d[CO2] */
-        J[1094] -= dqdci;             /* dwdot[CH3]/d[CO2] */
-        J[1100] += dqdci;             /* dwdot[CH3OH]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[7][5] - 1)*dcdc_fac;
-        J[1427] -= dqdci;             /* dwdot[OH]/d[C2H6] */
-        J[1436] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
-        J[1442] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*sc[11];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[7][0]*dcdc_fac;
-        dqdc[5] = TB[7][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac + k_f*sc[2];
-        dqdc[12] = TB[7][2]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac - k_r;
-        dqdc[18] = TB[7][3]*dcdc_fac;
-        dqdc[19] = TB[7][4]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = TB[7][5]*dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+2] -= dqdc[k];
-            J[57*k+11] -= dqdc[k];
-            J[57*k+17] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] -= dcdc_fac;
+    Jmix[11] -= dcdc_fac;
+    Jmix[17] += dcdc_fac;
+    /* d()/d[OH] */
+    dqdci =  + k_f*sc[11];
+    J[116] -= dqdci;              /* dwdot[OH]/d[OH] */
+    J[125] -= dqdci;              /* dwdot[CH3]/d[OH] */
+    J[131] += dqdci;              /* dwdot[CH3OH]/d[OH] */
+    /* d()/d[H2] */
+    dqdci = (TB[7][0] - 1)*dcdc_fac;
+    J[230] -= dqdci;              /* dwdot[OH]/d[H2] */
+    J[239] -= dqdci;              /* dwdot[CH3]/d[H2] */
+    J[245] += dqdci;              /* dwdot[CH3OH]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[7][1] - 1)*dcdc_fac;
+    J[287] -= dqdci;              /* dwdot[OH]/d[H2O] */
+    J[296] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[302] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[2];
+    J[629] -= dqdci;              /* dwdot[OH]/d[CH3] */
+    J[638] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[644] += dqdci;              /* dwdot[CH3OH]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[7][2] - 1)*dcdc_fac;
+    J[686] -= dqdci;              /* dwdot[OH]/d[CH4] */
+    J[695] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[701] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
+    /* d()/d[CH3OH] */
+    dqdci =  - k_r;
+    J[971] -= dqdci;              /* dwdot[OH]/d[CH3OH] */
+    J[980] -= dqdci;              /* dwdot[CH3]/d[CH3OH] */
+    J[986] += dqdci;              /* dwdot[CH3OH]/d[CH3OH] */
+    /* d()/d[CO] */
+    dqdci = (TB[7][3] - 1)*dcdc_fac;
+    J[1028] -= dqdci;             /* dwdot[OH]/d[CO] */
+    J[1037] -= dqdci;             /* dwdot[CH3]/d[CO] */
+    J[1043] += dqdci;             /* dwdot[CH3OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[7][4] - 1)*dcdc_fac;
+    J[1085] -= dqdci;             /* dwdot[OH]/d[CO2] */
+    J[1094] -= dqdci;             /* dwdot[CH3]/d[CO2] */
+    J[1100] += dqdci;             /* dwdot[CH3OH]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[7][5] - 1)*dcdc_fac;
+    J[1427] -= dqdci;             /* dwdot[OH]/d[C2H6] */
+    J[1436] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
+    J[1442] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
     J[3194] -= dqdT; /* dwdot[OH]/dT */
     J[3203] -= dqdT; /* dwdot[CH3]/dT */
     J[3209] += dqdT; /* dwdot[CH3OH]/dT */
@@ -23984,11 +24279,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[8][0] - 1)*sc[4] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[12] + (TB[8][3] - 1)*sc[18] + (TB[8][4] - 1)*sc[19] + (TB[8][5] - 1)*sc[25];
+    alpha = (memcmp(TB[8], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[8][0] - 1)*sc[4] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[12] + (TB[8][3] - 1)*sc[18] + (TB[8][4] - 1)*sc[19] + (TB[8][5] - 1)*sc[25]);
     /* forward */
     phi_f = sc[11]*sc[11];
-    k_f = prefactor_units[8] * fwd_A[8]
-                * exp(fwd_beta[8] * tc[0] - activation_units[8] * fwd_Ea[8] * invT);
+    k_f = k_f_s[8];
     dlnkfdT = fwd_beta[8] * invT + activation_units[8] * fwd_Ea[8] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[8] * exp(low_beta[8] * tc[0] - activation_units[8] * low_Ea[8] * invT);
@@ -24004,16 +24298,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[8] == 4 ? exp(-troe_Tss[8] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[8]) > 1.e-100 ? -Fcent1/troe_Tsss[8] : 0.)
+      + (fabs(troe_Ts[8]) > 1.e-100 ? -Fcent2/troe_Ts[8] : 0.)
+      + (troe_len[8] == 4 ? Fcent3*troe_Tss[8]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[8]) > 1.e-100 ? -Fcent1/troe_Tsss[8] : 0.)
-      + (fabs(troe_Ts[8]) > 1.e-100 ? -Fcent2/troe_Ts[8] : 0.)
-      + (troe_len[8] == 4 ? Fcent3*troe_Tss[8]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -24021,7 +24315,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[25];
-    Kc = refCinv * exp(2*g_RT[11] - g_RT[25]);
+    Kc = Kc_s[8];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[11]) + (h_RT[25]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24038,98 +24332,37 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[8][0] - 1)*dcdc_fac;
-        J[239] += -2 * dqdci;         /* dwdot[CH3]/d[H2] */
-        J[253] += dqdci;              /* dwdot[C2H6]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[8][1] - 1)*dcdc_fac;
-        J[296] += -2 * dqdci;         /* dwdot[CH3]/d[H2O] */
-        J[310] += dqdci;              /* dwdot[C2H6]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*2*sc[11];
-        J[638] += -2 * dqdci;         /* dwdot[CH3]/d[CH3] */
-        J[652] += dqdci;              /* dwdot[C2H6]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[8][2] - 1)*dcdc_fac;
-        J[695] += -2 * dqdci;         /* dwdot[CH3]/d[CH4] */
-        J[709] += dqdci;              /* dwdot[C2H6]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[8][3] - 1)*dcdc_fac;
-        J[1037] += -2 * dqdci;        /* dwdot[CH3]/d[CO] */
-        J[1051] += dqdci;             /* dwdot[C2H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[8][4] - 1)*dcdc_fac;
-        J[1094] += -2 * dqdci;        /* dwdot[CH3]/d[CO2] */
-        J[1108] += dqdci;             /* dwdot[C2H6]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[8][5] - 1)*dcdc_fac - k_r;
-        J[1436] += -2 * dqdci;        /* dwdot[CH3]/d[C2H6] */
-        J[1450] += dqdci;             /* dwdot[C2H6]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[8][0]*dcdc_fac;
-        dqdc[5] = TB[8][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac + k_f*2*sc[11];
-        dqdc[12] = TB[8][2]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[8][3]*dcdc_fac;
-        dqdc[19] = TB[8][4]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = TB[8][5]*dcdc_fac - k_r;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+11] += -2 * dqdc[k];
-            J[57*k+25] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[11] += -2 * dcdc_fac;
+    Jmix[25] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[8][0] - 1)*dcdc_fac;
+    J[239] += -2 * dqdci;         /* dwdot[CH3]/d[H2] */
+    J[253] += dqdci;              /* dwdot[C2H6]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[8][1] - 1)*dcdc_fac;
+    J[296] += -2 * dqdci;         /* dwdot[CH3]/d[H2O] */
+    J[310] += dqdci;              /* dwdot[C2H6]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*2*sc[11];
+    J[638] += -2 * dqdci;         /* dwdot[CH3]/d[CH3] */
+    J[652] += dqdci;              /* dwdot[C2H6]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[8][2] - 1)*dcdc_fac;
+    J[695] += -2 * dqdci;         /* dwdot[CH3]/d[CH4] */
+    J[709] += dqdci;              /* dwdot[C2H6]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[8][3] - 1)*dcdc_fac;
+    J[1037] += -2 * dqdci;        /* dwdot[CH3]/d[CO] */
+    J[1051] += dqdci;             /* dwdot[C2H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[8][4] - 1)*dcdc_fac;
+    J[1094] += -2 * dqdci;        /* dwdot[CH3]/d[CO2] */
+    J[1108] += dqdci;             /* dwdot[C2H6]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[8][5] - 1)*dcdc_fac - k_r;
+    J[1436] += -2 * dqdci;        /* dwdot[CH3]/d[C2H6] */
+    J[1450] += dqdci;             /* dwdot[C2H6]/d[C2H6] */
     J[3203] += -2 * dqdT; /* dwdot[CH3]/dT */
     J[3217] += dqdT; /* dwdot[C2H6]/dT */
 
@@ -24137,11 +24370,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[9][0] - 1)*sc[4] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[12] + (TB[9][3] - 1)*sc[18] + (TB[9][4] - 1)*sc[19] + (TB[9][5] - 1)*sc[21] + (TB[9][6] - 1)*sc[23] + (TB[9][7] - 1)*sc[25];
+    alpha = alpha_eff1;
     /* forward */
     phi_f = sc[22];
-    k_f = prefactor_units[9] * fwd_A[9]
-                * exp(fwd_beta[9] * tc[0] - activation_units[9] * fwd_Ea[9] * invT);
+    k_f = k_f_s[9];
     dlnkfdT = fwd_beta[9] * invT + activation_units[9] * fwd_Ea[9] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[9] * exp(low_beta[9] * tc[0] - activation_units[9] * low_Ea[9] * invT);
@@ -24157,16 +24389,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[9] == 4 ? exp(-troe_Tss[9] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[9]) > 1.e-100 ? -Fcent1/troe_Tsss[9] : 0.)
+      + (fabs(troe_Ts[9]) > 1.e-100 ? -Fcent2/troe_Ts[9] : 0.)
+      + (troe_len[9] == 4 ? Fcent3*troe_Tss[9]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[9]) > 1.e-100 ? -Fcent1/troe_Tsss[9] : 0.)
-      + (fabs(troe_Ts[9]) > 1.e-100 ? -Fcent2/troe_Ts[9] : 0.)
-      + (troe_len[9] == 4 ? Fcent3*troe_Tss[9]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -24174,7 +24406,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[0]*sc[21];
-    Kc = refC * exp(-g_RT[0] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[9];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[22]) + (h_RT[0] + h_RT[21]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24192,121 +24424,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[21];
-        J[0] += dqdci;                /* dwdot[H]/d[H] */
-        J[21] += dqdci;               /* dwdot[C2H2]/d[H] */
-        J[22] -= dqdci;               /* dwdot[C2H3]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[9][0] - 1)*dcdc_fac;
-        J[228] += dqdci;              /* dwdot[H]/d[H2] */
-        J[249] += dqdci;              /* dwdot[C2H2]/d[H2] */
-        J[250] -= dqdci;              /* dwdot[C2H3]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[9][1] - 1)*dcdc_fac;
-        J[285] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[306] += dqdci;              /* dwdot[C2H2]/d[H2O] */
-        J[307] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[9][2] - 1)*dcdc_fac;
-        J[684] += dqdci;              /* dwdot[H]/d[CH4] */
-        J[705] += dqdci;              /* dwdot[C2H2]/d[CH4] */
-        J[706] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[9][3] - 1)*dcdc_fac;
-        J[1026] += dqdci;             /* dwdot[H]/d[CO] */
-        J[1047] += dqdci;             /* dwdot[C2H2]/d[CO] */
-        J[1048] -= dqdci;             /* dwdot[C2H3]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[9][4] - 1)*dcdc_fac;
-        J[1083] += dqdci;             /* dwdot[H]/d[CO2] */
-        J[1104] += dqdci;             /* dwdot[C2H2]/d[CO2] */
-        J[1105] -= dqdci;             /* dwdot[C2H3]/d[CO2] */
-        /* d()/d[C2H2] */
-        dqdci = (TB[9][5] - 1)*dcdc_fac - k_r*sc[0];
-        J[1197] += dqdci;             /* dwdot[H]/d[C2H2] */
-        J[1218] += dqdci;             /* dwdot[C2H2]/d[C2H2] */
-        J[1219] -= dqdci;             /* dwdot[C2H3]/d[C2H2] */
-        /* d()/d[C2H3] */
-        dqdci =  + k_f;
-        J[1254] += dqdci;             /* dwdot[H]/d[C2H3] */
-        J[1275] += dqdci;             /* dwdot[C2H2]/d[C2H3] */
-        J[1276] -= dqdci;             /* dwdot[C2H3]/d[C2H3] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[9][6] - 1)*dcdc_fac;
-        J[1311] += dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1332] += dqdci;             /* dwdot[C2H2]/d[C2H4] */
-        J[1333] -= dqdci;             /* dwdot[C2H3]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[9][7] - 1)*dcdc_fac;
-        J[1425] += dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1446] += dqdci;             /* dwdot[C2H2]/d[C2H6] */
-        J[1447] -= dqdci;             /* dwdot[C2H3]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac - k_r*sc[21];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[9][0]*dcdc_fac;
-        dqdc[5] = TB[9][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = TB[9][2]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[9][3]*dcdc_fac;
-        dqdc[19] = TB[9][4]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[9][5]*dcdc_fac - k_r*sc[0];
-        dqdc[22] = dcdc_fac + k_f;
-        dqdc[23] = TB[9][6]*dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = TB[9][7]*dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+0] += dqdc[k];
-            J[57*k+21] += dqdc[k];
-            J[57*k+22] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += dcdc_fac;
+    Jmix[21] += dcdc_fac;
+    Jmix[22] -= dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[21];
+    J[0] += dqdci;                /* dwdot[H]/d[H] */
+    J[21] += dqdci;               /* dwdot[C2H2]/d[H] */
+    J[22] -= dqdci;               /* dwdot[C2H3]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[9][0] - 1)*dcdc_fac;
+    J[228] += dqdci;              /* dwdot[H]/d[H2] */
+    J[249] += dqdci;              /* dwdot[C2H2]/d[H2] */
+    J[250] -= dqdci;              /* dwdot[C2H3]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[9][1] - 1)*dcdc_fac;
+    J[285] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[306] += dqdci;              /* dwdot[C2H2]/d[H2O] */
+    J[307] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[9][2] - 1)*dcdc_fac;
+    J[684] += dqdci;              /* dwdot[H]/d[CH4] */
+    J[705] += dqdci;              /* dwdot[C2H2]/d[CH4] */
+    J[706] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[9][3] - 1)*dcdc_fac;
+    J[1026] += dqdci;             /* dwdot[H]/d[CO] */
+    J[1047] += dqdci;             /* dwdot[C2H2]/d[CO] */
+    J[1048] -= dqdci;             /* dwdot[C2H3]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[9][4] - 1)*dcdc_fac;
+    J[1083] += dqdci;             /* dwdot[H]/d[CO2] */
+    J[1104] += dqdci;             /* dwdot[C2H2]/d[CO2] */
+    J[1105] -= dqdci;             /* dwdot[C2H3]/d[CO2] */
+    /* d()/d[C2H2] */
+    dqdci = (TB[9][5] - 1)*dcdc_fac - k_r*sc[0];
+    J[1197] += dqdci;             /* dwdot[H]/d[C2H2] */
+    J[1218] += dqdci;             /* dwdot[C2H2]/d[C2H2] */
+    J[1219] -= dqdci;             /* dwdot[C2H3]/d[C2H2] */
+    /* d()/d[C2H3] */
+    dqdci =  + k_f;
+    J[1254] += dqdci;             /* dwdot[H]/d[C2H3] */
+    J[1275] += dqdci;             /* dwdot[C2H2]/d[C2H3] */
+    J[1276] -= dqdci;             /* dwdot[C2H3]/d[C2H3] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[9][6] - 1)*dcdc_fac;
+    J[1311] += dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1332] += dqdci;             /* dwdot[C2H2]/d[C2H4] */
+    J[1333] -= dqdci;             /* dwdot[C2H3]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[9][7] - 1)*dcdc_fac;
+    J[1425] += dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1446] += dqdci;             /* dwdot[C2H2]/d[C2H6] */
+    J[1447] -= dqdci;             /* dwdot[C2H3]/d[C2H6] */
     J[3192] += dqdT; /* dwdot[H]/dT */
     J[3213] += dqdT; /* dwdot[C2H2]/dT */
     J[3214] -= dqdT; /* dwdot[C2H3]/dT */
@@ -24315,11 +24486,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[10][0] - 1)*sc[4] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[12] + (TB[10][3] - 1)*sc[18] + (TB[10][4] - 1)*sc[19] + (TB[10][5] - 1)*sc[21] + (TB[10][6] - 1)*sc[23] + (TB[10][7] - 1)*sc[25];
+    alpha = (memcmp(TB[10], TB[9], 8*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[10][0] - 1)*sc[4] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[12] + (TB[10][3] - 1)*sc[18] + (TB[10][4] - 1)*sc[19] + (TB[10][5] - 1)*sc[21] + (TB[10][6] - 1)*sc[23] + (TB[10][7] - 1)*sc[25]);
     /* forward */
     phi_f = sc[0]*sc[27];
-    k_f = prefactor_units[10] * fwd_A[10]
-                * exp(fwd_beta[10] * tc[0] - activation_units[10] * fwd_Ea[10] * invT);
+    k_f = k_f_s[10];
     dlnkfdT = fwd_beta[10] * invT + activation_units[10] * fwd_Ea[10] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[10] * exp(low_beta[10] * tc[0] - activation_units[10] * low_Ea[10] * invT);
@@ -24335,16 +24505,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[10] == 4 ? exp(-troe_Tss[10] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[10]) > 1.e-100 ? -Fcent1/troe_Tsss[10] : 0.)
+      + (fabs(troe_Ts[10]) > 1.e-100 ? -Fcent2/troe_Ts[10] : 0.)
+      + (troe_len[10] == 4 ? Fcent3*troe_Tss[10]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[10]) > 1.e-100 ? -Fcent1/troe_Tsss[10] : 0.)
-      + (fabs(troe_Ts[10]) > 1.e-100 ? -Fcent2/troe_Ts[10] : 0.)
-      + (troe_len[10] == 4 ? Fcent3*troe_Tss[10]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -24352,7 +24522,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[29];
-    Kc = refCinv * exp(g_RT[0] + g_RT[27] - g_RT[29]);
+    Kc = Kc_s[10];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[27]) + (h_RT[29]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24370,126 +24540,65 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[27];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[27] -= dqdci;               /* dwdot[CH2CO]/d[H] */
-        J[29] += dqdci;               /* dwdot[CH2CHO]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[10][0] - 1)*dcdc_fac;
-        J[228] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[255] -= dqdci;              /* dwdot[CH2CO]/d[H2] */
-        J[257] += dqdci;              /* dwdot[CH2CHO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[10][1] - 1)*dcdc_fac;
-        J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[312] -= dqdci;              /* dwdot[CH2CO]/d[H2O] */
-        J[314] += dqdci;              /* dwdot[CH2CHO]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[10][2] - 1)*dcdc_fac;
-        J[684] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[711] -= dqdci;              /* dwdot[CH2CO]/d[CH4] */
-        J[713] += dqdci;              /* dwdot[CH2CHO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[10][3] - 1)*dcdc_fac;
-        J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1053] -= dqdci;             /* dwdot[CH2CO]/d[CO] */
-        J[1055] += dqdci;             /* dwdot[CH2CHO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[10][4] - 1)*dcdc_fac;
-        J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1110] -= dqdci;             /* dwdot[CH2CO]/d[CO2] */
-        J[1112] += dqdci;             /* dwdot[CH2CHO]/d[CO2] */
-        /* d()/d[C2H2] */
-        dqdci = (TB[10][5] - 1)*dcdc_fac;
-        J[1197] -= dqdci;             /* dwdot[H]/d[C2H2] */
-        J[1224] -= dqdci;             /* dwdot[CH2CO]/d[C2H2] */
-        J[1226] += dqdci;             /* dwdot[CH2CHO]/d[C2H2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[10][6] - 1)*dcdc_fac;
-        J[1311] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1338] -= dqdci;             /* dwdot[CH2CO]/d[C2H4] */
-        J[1340] += dqdci;             /* dwdot[CH2CHO]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[10][7] - 1)*dcdc_fac;
-        J[1425] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1452] -= dqdci;             /* dwdot[CH2CO]/d[C2H6] */
-        J[1454] += dqdci;             /* dwdot[CH2CHO]/d[C2H6] */
-        /* d()/d[CH2CO] */
-        dqdci =  + k_f*sc[0];
-        J[1539] -= dqdci;             /* dwdot[H]/d[CH2CO] */
-        J[1566] -= dqdci;             /* dwdot[CH2CO]/d[CH2CO] */
-        J[1568] += dqdci;             /* dwdot[CH2CHO]/d[CH2CO] */
-        /* d()/d[CH2CHO] */
-        dqdci =  - k_r;
-        J[1653] -= dqdci;             /* dwdot[H]/d[CH2CHO] */
-        J[1680] -= dqdci;             /* dwdot[CH2CO]/d[CH2CHO] */
-        J[1682] += dqdci;             /* dwdot[CH2CHO]/d[CH2CHO] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[27];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[10][0]*dcdc_fac;
-        dqdc[5] = TB[10][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = TB[10][2]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[10][3]*dcdc_fac;
-        dqdc[19] = TB[10][4]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[10][5]*dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = TB[10][6]*dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = TB[10][7]*dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac + k_f*sc[0];
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac - k_r;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+0] -= dqdc[k];
-            J[57*k+27] -= dqdc[k];
-            J[57*k+29] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[27] -= dcdc_fac;
+    Jmix[29] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[27];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[27] -= dqdci;               /* dwdot[CH2CO]/d[H] */
+    J[29] += dqdci;               /* dwdot[CH2CHO]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[10][0] - 1)*dcdc_fac;
+    J[228] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[255] -= dqdci;              /* dwdot[CH2CO]/d[H2] */
+    J[257] += dqdci;              /* dwdot[CH2CHO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[10][1] - 1)*dcdc_fac;
+    J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[312] -= dqdci;              /* dwdot[CH2CO]/d[H2O] */
+    J[314] += dqdci;              /* dwdot[CH2CHO]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[10][2] - 1)*dcdc_fac;
+    J[684] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[711] -= dqdci;              /* dwdot[CH2CO]/d[CH4] */
+    J[713] += dqdci;              /* dwdot[CH2CHO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[10][3] - 1)*dcdc_fac;
+    J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1053] -= dqdci;             /* dwdot[CH2CO]/d[CO] */
+    J[1055] += dqdci;             /* dwdot[CH2CHO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[10][4] - 1)*dcdc_fac;
+    J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1110] -= dqdci;             /* dwdot[CH2CO]/d[CO2] */
+    J[1112] += dqdci;             /* dwdot[CH2CHO]/d[CO2] */
+    /* d()/d[C2H2] */
+    dqdci = (TB[10][5] - 1)*dcdc_fac;
+    J[1197] -= dqdci;             /* dwdot[H]/d[C2H2] */
+    J[1224] -= dqdci;             /* dwdot[CH2CO]/d[C2H2] */
+    J[1226] += dqdci;             /* dwdot[CH2CHO]/d[C2H2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[10][6] - 1)*dcdc_fac;
+    J[1311] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1338] -= dqdci;             /* dwdot[CH2CO]/d[C2H4] */
+    J[1340] += dqdci;             /* dwdot[CH2CHO]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[10][7] - 1)*dcdc_fac;
+    J[1425] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1452] -= dqdci;             /* dwdot[CH2CO]/d[C2H6] */
+    J[1454] += dqdci;             /* dwdot[CH2CHO]/d[C2H6] */
+    /* d()/d[CH2CO] */
+    dqdci =  + k_f*sc[0];
+    J[1539] -= dqdci;             /* dwdot[H]/d[CH2CO] */
+    J[1566] -= dqdci;             /* dwdot[CH2CO]/d[CH2CO] */
+    J[1568] += dqdci;             /* dwdot[CH2CHO]/d[CH2CO] */
+    /* d()/d[CH2CHO] */
+    dqdci =  - k_r;
+    J[1653] -= dqdci;             /* dwdot[H]/d[CH2CHO] */
+    J[1680] -= dqdci;             /* dwdot[CH2CO]/d[CH2CHO] */
+    J[1682] += dqdci;             /* dwdot[CH2CHO]/d[CH2CHO] */
     J[3192] -= dqdT; /* dwdot[H]/dT */
     J[3219] -= dqdT; /* dwdot[CH2CO]/dT */
     J[3221] += dqdT; /* dwdot[CH2CHO]/dT */
@@ -24498,11 +24607,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[11][0] - 1)*sc[4] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[12] + (TB[11][3] - 1)*sc[18] + (TB[11][4] - 1)*sc[19] + (TB[11][5] - 1)*sc[21] + (TB[11][6] - 1)*sc[23] + (TB[11][7] - 1)*sc[25];
+    alpha = (memcmp(TB[11], TB[9], 8*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[11][0] - 1)*sc[4] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[12] + (TB[11][3] - 1)*sc[18] + (TB[11][4] - 1)*sc[19] + (TB[11][5] - 1)*sc[21] + (TB[11][6] - 1)*sc[23] + (TB[11][7] - 1)*sc[25]);
     /* forward */
     phi_f = sc[0]*sc[22];
-    k_f = prefactor_units[11] * fwd_A[11]
-                * exp(fwd_beta[11] * tc[0] - activation_units[11] * fwd_Ea[11] * invT);
+    k_f = k_f_s[11];
     dlnkfdT = fwd_beta[11] * invT + activation_units[11] * fwd_Ea[11] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[11] * exp(low_beta[11] * tc[0] - activation_units[11] * low_Ea[11] * invT);
@@ -24518,16 +24626,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[11] == 4 ? exp(-troe_Tss[11] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[11]) > 1.e-100 ? -Fcent1/troe_Tsss[11] : 0.)
+      + (fabs(troe_Ts[11]) > 1.e-100 ? -Fcent2/troe_Ts[11] : 0.)
+      + (troe_len[11] == 4 ? Fcent3*troe_Tss[11]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[11]) > 1.e-100 ? -Fcent1/troe_Tsss[11] : 0.)
-      + (fabs(troe_Ts[11]) > 1.e-100 ? -Fcent2/troe_Ts[11] : 0.)
-      + (troe_len[11] == 4 ? Fcent3*troe_Tss[11]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -24535,7 +24643,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[23];
-    Kc = refCinv * exp(g_RT[0] + g_RT[22] - g_RT[23]);
+    Kc = Kc_s[11];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[22]) + (h_RT[23]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24553,121 +24661,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[22];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[22] -= dqdci;               /* dwdot[C2H3]/d[H] */
-        J[23] += dqdci;               /* dwdot[C2H4]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[11][0] - 1)*dcdc_fac;
-        J[228] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[250] -= dqdci;              /* dwdot[C2H3]/d[H2] */
-        J[251] += dqdci;              /* dwdot[C2H4]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[11][1] - 1)*dcdc_fac;
-        J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[307] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
-        J[308] += dqdci;              /* dwdot[C2H4]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[11][2] - 1)*dcdc_fac;
-        J[684] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[706] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
-        J[707] += dqdci;              /* dwdot[C2H4]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[11][3] - 1)*dcdc_fac;
-        J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1048] -= dqdci;             /* dwdot[C2H3]/d[CO] */
-        J[1049] += dqdci;             /* dwdot[C2H4]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[11][4] - 1)*dcdc_fac;
-        J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1105] -= dqdci;             /* dwdot[C2H3]/d[CO2] */
-        J[1106] += dqdci;             /* dwdot[C2H4]/d[CO2] */
-        /* d()/d[C2H2] */
-        dqdci = (TB[11][5] - 1)*dcdc_fac;
-        J[1197] -= dqdci;             /* dwdot[H]/d[C2H2] */
-        J[1219] -= dqdci;             /* dwdot[C2H3]/d[C2H2] */
-        J[1220] += dqdci;             /* dwdot[C2H4]/d[C2H2] */
-        /* d()/d[C2H3] */
-        dqdci =  + k_f*sc[0];
-        J[1254] -= dqdci;             /* dwdot[H]/d[C2H3] */
-        J[1276] -= dqdci;             /* dwdot[C2H3]/d[C2H3] */
-        J[1277] += dqdci;             /* dwdot[C2H4]/d[C2H3] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[11][6] - 1)*dcdc_fac - k_r;
-        J[1311] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1333] -= dqdci;             /* dwdot[C2H3]/d[C2H4] */
-        J[1334] += dqdci;             /* dwdot[C2H4]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[11][7] - 1)*dcdc_fac;
-        J[1425] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1447] -= dqdci;             /* dwdot[C2H3]/d[C2H6] */
-        J[1448] += dqdci;             /* dwdot[C2H4]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[22];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[11][0]*dcdc_fac;
-        dqdc[5] = TB[11][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = TB[11][2]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[11][3]*dcdc_fac;
-        dqdc[19] = TB[11][4]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[11][5]*dcdc_fac;
-        dqdc[22] = dcdc_fac + k_f*sc[0];
-        dqdc[23] = TB[11][6]*dcdc_fac - k_r;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = TB[11][7]*dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+0] -= dqdc[k];
-            J[57*k+22] -= dqdc[k];
-            J[57*k+23] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[22] -= dcdc_fac;
+    Jmix[23] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[22];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[22] -= dqdci;               /* dwdot[C2H3]/d[H] */
+    J[23] += dqdci;               /* dwdot[C2H4]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[11][0] - 1)*dcdc_fac;
+    J[228] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[250] -= dqdci;              /* dwdot[C2H3]/d[H2] */
+    J[251] += dqdci;              /* dwdot[C2H4]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[11][1] - 1)*dcdc_fac;
+    J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[307] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
+    J[308] += dqdci;              /* dwdot[C2H4]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[11][2] - 1)*dcdc_fac;
+    J[684] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[706] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
+    J[707] += dqdci;              /* dwdot[C2H4]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[11][3] - 1)*dcdc_fac;
+    J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1048] -= dqdci;             /* dwdot[C2H3]/d[CO] */
+    J[1049] += dqdci;             /* dwdot[C2H4]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[11][4] - 1)*dcdc_fac;
+    J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1105] -= dqdci;             /* dwdot[C2H3]/d[CO2] */
+    J[1106] += dqdci;             /* dwdot[C2H4]/d[CO2] */
+    /* d()/d[C2H2] */
+    dqdci = (TB[11][5] - 1)*dcdc_fac;
+    J[1197] -= dqdci;             /* dwdot[H]/d[C2H2] */
+    J[1219] -= dqdci;             /* dwdot[C2H3]/d[C2H2] */
+    J[1220] += dqdci;             /* dwdot[C2H4]/d[C2H2] */
+    /* d()/d[C2H3] */
+    dqdci =  + k_f*sc[0];
+    J[1254] -= dqdci;             /* dwdot[H]/d[C2H3] */
+    J[1276] -= dqdci;             /* dwdot[C2H3]/d[C2H3] */
+    J[1277] += dqdci;             /* dwdot[C2H4]/d[C2H3] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[11][6] - 1)*dcdc_fac - k_r;
+    J[1311] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1333] -= dqdci;             /* dwdot[C2H3]/d[C2H4] */
+    J[1334] += dqdci;             /* dwdot[C2H4]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[11][7] - 1)*dcdc_fac;
+    J[1425] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1447] -= dqdci;             /* dwdot[C2H3]/d[C2H6] */
+    J[1448] += dqdci;             /* dwdot[C2H4]/d[C2H6] */
     J[3192] -= dqdT; /* dwdot[H]/dT */
     J[3214] -= dqdT; /* dwdot[C2H3]/dT */
     J[3215] += dqdT; /* dwdot[C2H4]/dT */
@@ -24679,8 +24726,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[12][0] - 1)*sc[4] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[12] + (TB[12][3] - 1)*sc[18] + (TB[12][4] - 1)*sc[19] + (TB[12][5] - 1)*sc[23] + (TB[12][6] - 1)*sc[25];
     /* forward */
     phi_f = sc[11]*sc[22];
-    k_f = prefactor_units[12] * fwd_A[12]
-                * exp(fwd_beta[12] * tc[0] - activation_units[12] * fwd_Ea[12] * invT);
+    k_f = k_f_s[12];
     dlnkfdT = fwd_beta[12] * invT + activation_units[12] * fwd_Ea[12] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[12] * exp(low_beta[12] * tc[0] - activation_units[12] * low_Ea[12] * invT);
@@ -24696,16 +24742,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[12] == 4 ? exp(-troe_Tss[12] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[12]) > 1.e-100 ? -Fcent1/troe_Tsss[12] : 0.)
+      + (fabs(troe_Ts[12]) > 1.e-100 ? -Fcent2/troe_Ts[12] : 0.)
+      + (troe_len[12] == 4 ? Fcent3*troe_Tss[12]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[12]) > 1.e-100 ? -Fcent1/troe_Tsss[12] : 0.)
-      + (fabs(troe_Ts[12]) > 1.e-100 ? -Fcent2/troe_Ts[12] : 0.)
-      + (troe_len[12] == 4 ? Fcent3*troe_Tss[12]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -24713,7 +24759,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[36];
-    Kc = refCinv * exp(g_RT[11] + g_RT[22] - g_RT[36]);
+    Kc = Kc_s[12];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[22]) + (h_RT[36]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24731,121 +24777,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[12][0] - 1)*dcdc_fac;
-        J[239] -= dqdci;              /* dwdot[CH3]/d[H2] */
-        J[250] -= dqdci;              /* dwdot[C2H3]/d[H2] */
-        J[264] += dqdci;              /* dwdot[C3H6]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[12][1] - 1)*dcdc_fac;
-        J[296] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[307] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
-        J[321] += dqdci;              /* dwdot[C3H6]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[22];
-        J[638] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[649] -= dqdci;              /* dwdot[C2H3]/d[CH3] */
-        J[663] += dqdci;              /* dwdot[C3H6]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[12][2] - 1)*dcdc_fac;
-        J[695] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[706] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
-        J[720] += dqdci;              /* dwdot[C3H6]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[12][3] - 1)*dcdc_fac;
-        J[1037] -= dqdci;             /* dwdot[CH3]/d[CO] */
-        J[1048] -= dqdci;             /* dwdot[C2H3]/d[CO] */
-        J[1062] += dqdci;             /* dwdot[C3H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[12][4] - 1)*dcdc_fac;
-        J[1094] -= dqdci;             /* dwdot[CH3]/d[CO2] */
-        J[1105] -= dqdci;             /* dwdot[C2H3]/d[CO2] */
-        J[1119] += dqdci;             /* dwdot[C3H6]/d[CO2] */
-        /* d()/d[C2H3] */
-        dqdci =  + k_f*sc[11];
-        J[1265] -= dqdci;             /* dwdot[CH3]/d[C2H3] */
-        J[1276] -= dqdci;             /* dwdot[C2H3]/d[C2H3] */
-        J[1290] += dqdci;             /* dwdot[C3H6]/d[C2H3] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[12][5] - 1)*dcdc_fac;
-        J[1322] -= dqdci;             /* dwdot[CH3]/d[C2H4] */
-        J[1333] -= dqdci;             /* dwdot[C2H3]/d[C2H4] */
-        J[1347] += dqdci;             /* dwdot[C3H6]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[12][6] - 1)*dcdc_fac;
-        J[1436] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
-        J[1447] -= dqdci;             /* dwdot[C2H3]/d[C2H6] */
-        J[1461] += dqdci;             /* dwdot[C3H6]/d[C2H6] */
-        /* d()/d[C3H6] */
-        dqdci =  - k_r;
-        J[2063] -= dqdci;             /* dwdot[CH3]/d[C3H6] */
-        J[2074] -= dqdci;             /* dwdot[C2H3]/d[C3H6] */
-        J[2088] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[12][0]*dcdc_fac;
-        dqdc[5] = TB[12][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac + k_f*sc[22];
-        dqdc[12] = TB[12][2]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[12][3]*dcdc_fac;
-        dqdc[19] = TB[12][4]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac + k_f*sc[11];
-        dqdc[23] = TB[12][5]*dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = TB[12][6]*dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac - k_r;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+11] -= dqdc[k];
-            J[57*k+22] -= dqdc[k];
-            J[57*k+36] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[11] -= dcdc_fac;
+    Jmix[22] -= dcdc_fac;
+    Jmix[36] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[12][0] - 1)*dcdc_fac;
+    J[239] -= dqdci;              /* dwdot[CH3]/d[H2] */
+    J[250] -= dqdci;              /* dwdot[C2H3]/d[H2] */
+    J[264] += dqdci;              /* dwdot[C3H6]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[12][1] - 1)*dcdc_fac;
+    J[296] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[307] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
+    J[321] += dqdci;              /* dwdot[C3H6]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[22];
+    J[638] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[649] -= dqdci;              /* dwdot[C2H3]/d[CH3] */
+    J[663] += dqdci;              /* dwdot[C3H6]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[12][2] - 1)*dcdc_fac;
+    J[695] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[706] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
+    J[720] += dqdci;              /* dwdot[C3H6]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[12][3] - 1)*dcdc_fac;
+    J[1037] -= dqdci;             /* dwdot[CH3]/d[CO] */
+    J[1048] -= dqdci;             /* dwdot[C2H3]/d[CO] */
+    J[1062] += dqdci;             /* dwdot[C3H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[12][4] - 1)*dcdc_fac;
+    J[1094] -= dqdci;             /* dwdot[CH3]/d[CO2] */
+    J[1105] -= dqdci;             /* dwdot[C2H3]/d[CO2] */
+    J[1119] += dqdci;             /* dwdot[C3H6]/d[CO2] */
+    /* d()/d[C2H3] */
+    dqdci =  + k_f*sc[11];
+    J[1265] -= dqdci;             /* dwdot[CH3]/d[C2H3] */
+    J[1276] -= dqdci;             /* dwdot[C2H3]/d[C2H3] */
+    J[1290] += dqdci;             /* dwdot[C3H6]/d[C2H3] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[12][5] - 1)*dcdc_fac;
+    J[1322] -= dqdci;             /* dwdot[CH3]/d[C2H4] */
+    J[1333] -= dqdci;             /* dwdot[C2H3]/d[C2H4] */
+    J[1347] += dqdci;             /* dwdot[C3H6]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[12][6] - 1)*dcdc_fac;
+    J[1436] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
+    J[1447] -= dqdci;             /* dwdot[C2H3]/d[C2H6] */
+    J[1461] += dqdci;             /* dwdot[C3H6]/d[C2H6] */
+    /* d()/d[C3H6] */
+    dqdci =  - k_r;
+    J[2063] -= dqdci;             /* dwdot[CH3]/d[C3H6] */
+    J[2074] -= dqdci;             /* dwdot[C2H3]/d[C3H6] */
+    J[2088] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
     J[3203] -= dqdT; /* dwdot[CH3]/dT */
     J[3214] -= dqdT; /* dwdot[C2H3]/dT */
     J[3228] += dqdT; /* dwdot[C3H6]/dT */
@@ -24854,11 +24839,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[13][0] - 1)*sc[4] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[12] + (TB[13][3] - 1)*sc[18] + (TB[13][4] - 1)*sc[19] + (TB[13][5] - 1)*sc[21] + (TB[13][6] - 1)*sc[23] + (TB[13][7] - 1)*sc[25];
+    alpha = (memcmp(TB[13], TB[9], 8*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[13][0] - 1)*sc[4] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[12] + (TB[13][3] - 1)*sc[18] + (TB[13][4] - 1)*sc[19] + (TB[13][5] - 1)*sc[21] + (TB[13][6] - 1)*sc[23] + (TB[13][7] - 1)*sc[25]);
     /* forward */
     phi_f = sc[11]*sc[18];
-    k_f = prefactor_units[13] * fwd_A[13]
-                * exp(fwd_beta[13] * tc[0] - activation_units[13] * fwd_Ea[13] * invT);
+    k_f = k_f_s[13];
     dlnkfdT = fwd_beta[13] * invT + activation_units[13] * fwd_Ea[13] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[13] * exp(low_beta[13] * tc[0] - activation_units[13] * low_Ea[13] * invT);
@@ -24874,16 +24858,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[13] == 4 ? exp(-troe_Tss[13] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[13]) > 1.e-100 ? -Fcent1/troe_Tsss[13] : 0.)
+      + (fabs(troe_Ts[13]) > 1.e-100 ? -Fcent2/troe_Ts[13] : 0.)
+      + (troe_len[13] == 4 ? Fcent3*troe_Tss[13]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[13]) > 1.e-100 ? -Fcent1/troe_Tsss[13] : 0.)
-      + (fabs(troe_Ts[13]) > 1.e-100 ? -Fcent2/troe_Ts[13] : 0.)
-      + (troe_len[13] == 4 ? Fcent3*troe_Tss[13]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -24891,7 +24875,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[28];
-    Kc = refCinv * exp(g_RT[11] + g_RT[18] - g_RT[28]);
+    Kc = Kc_s[13];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[18]) + (h_RT[28]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24909,121 +24893,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[13][0] - 1)*dcdc_fac;
-        J[239] -= dqdci;              /* dwdot[CH3]/d[H2] */
-        J[246] -= dqdci;              /* dwdot[CO]/d[H2] */
-        J[256] += dqdci;              /* dwdot[CH3CO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[13][1] - 1)*dcdc_fac;
-        J[296] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[303] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[313] += dqdci;              /* dwdot[CH3CO]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[18];
-        J[638] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[645] -= dqdci;              /* dwdot[CO]/d[CH3] */
-        J[655] += dqdci;              /* dwdot[CH3CO]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[13][2] - 1)*dcdc_fac;
-        J[695] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[702] -= dqdci;              /* dwdot[CO]/d[CH4] */
-        J[712] += dqdci;              /* dwdot[CH3CO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[13][3] - 1)*dcdc_fac + k_f*sc[11];
-        J[1037] -= dqdci;             /* dwdot[CH3]/d[CO] */
-        J[1044] -= dqdci;             /* dwdot[CO]/d[CO] */
-        J[1054] += dqdci;             /* dwdot[CH3CO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[13][4] - 1)*dcdc_fac;
-        J[1094] -= dqdci;             /* dwdot[CH3]/d[CO2] */
-        J[1101] -= dqdci;             /* dwdot[CO]/d[CO2] */
-        J[1111] += dqdci;             /* dwdot[CH3CO]/d[CO2] */
-        /* d()/d[C2H2] */
-        dqdci = (TB[13][5] - 1)*dcdc_fac;
-        J[1208] -= dqdci;             /* dwdot[CH3]/d[C2H2] */
-        J[1215] -= dqdci;             /* dwdot[CO]/d[C2H2] */
-        J[1225] += dqdci;             /* dwdot[CH3CO]/d[C2H2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[13][6] - 1)*dcdc_fac;
-        J[1322] -= dqdci;             /* dwdot[CH3]/d[C2H4] */
-        J[1329] -= dqdci;             /* dwdot[CO]/d[C2H4] */
-        J[1339] += dqdci;             /* dwdot[CH3CO]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[13][7] - 1)*dcdc_fac;
-        J[1436] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
-        J[1443] -= dqdci;             /* dwdot[CO]/d[C2H6] */
-        J[1453] += dqdci;             /* dwdot[CH3CO]/d[C2H6] */
-        /* d()/d[CH3CO] */
-        dqdci =  - k_r;
-        J[1607] -= dqdci;             /* dwdot[CH3]/d[CH3CO] */
-        J[1614] -= dqdci;             /* dwdot[CO]/d[CH3CO] */
-        J[1624] += dqdci;             /* dwdot[CH3CO]/d[CH3CO] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[13][0]*dcdc_fac;
-        dqdc[5] = TB[13][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac + k_f*sc[18];
-        dqdc[12] = TB[13][2]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[13][3]*dcdc_fac + k_f*sc[11];
-        dqdc[19] = TB[13][4]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[13][5]*dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = TB[13][6]*dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = TB[13][7]*dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac - k_r;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+11] -= dqdc[k];
-            J[57*k+18] -= dqdc[k];
-            J[57*k+28] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[11] -= dcdc_fac;
+    Jmix[18] -= dcdc_fac;
+    Jmix[28] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[13][0] - 1)*dcdc_fac;
+    J[239] -= dqdci;              /* dwdot[CH3]/d[H2] */
+    J[246] -= dqdci;              /* dwdot[CO]/d[H2] */
+    J[256] += dqdci;              /* dwdot[CH3CO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[13][1] - 1)*dcdc_fac;
+    J[296] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[303] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[313] += dqdci;              /* dwdot[CH3CO]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[18];
+    J[638] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[645] -= dqdci;              /* dwdot[CO]/d[CH3] */
+    J[655] += dqdci;              /* dwdot[CH3CO]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[13][2] - 1)*dcdc_fac;
+    J[695] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[702] -= dqdci;              /* dwdot[CO]/d[CH4] */
+    J[712] += dqdci;              /* dwdot[CH3CO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[13][3] - 1)*dcdc_fac + k_f*sc[11];
+    J[1037] -= dqdci;             /* dwdot[CH3]/d[CO] */
+    J[1044] -= dqdci;             /* dwdot[CO]/d[CO] */
+    J[1054] += dqdci;             /* dwdot[CH3CO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[13][4] - 1)*dcdc_fac;
+    J[1094] -= dqdci;             /* dwdot[CH3]/d[CO2] */
+    J[1101] -= dqdci;             /* dwdot[CO]/d[CO2] */
+    J[1111] += dqdci;             /* dwdot[CH3CO]/d[CO2] */
+    /* d()/d[C2H2] */
+    dqdci = (TB[13][5] - 1)*dcdc_fac;
+    J[1208] -= dqdci;             /* dwdot[CH3]/d[C2H2] */
+    J[1215] -= dqdci;             /* dwdot[CO]/d[C2H2] */
+    J[1225] += dqdci;             /* dwdot[CH3CO]/d[C2H2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[13][6] - 1)*dcdc_fac;
+    J[1322] -= dqdci;             /* dwdot[CH3]/d[C2H4] */
+    J[1329] -= dqdci;             /* dwdot[CO]/d[C2H4] */
+    J[1339] += dqdci;             /* dwdot[CH3CO]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[13][7] - 1)*dcdc_fac;
+    J[1436] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
+    J[1443] -= dqdci;             /* dwdot[CO]/d[C2H6] */
+    J[1453] += dqdci;             /* dwdot[CH3CO]/d[C2H6] */
+    /* d()/d[CH3CO] */
+    dqdci =  - k_r;
+    J[1607] -= dqdci;             /* dwdot[CH3]/d[CH3CO] */
+    J[1614] -= dqdci;             /* dwdot[CO]/d[CH3CO] */
+    J[1624] += dqdci;             /* dwdot[CH3CO]/d[CH3CO] */
     J[3203] -= dqdT; /* dwdot[CH3]/dT */
     J[3210] -= dqdT; /* dwdot[CO]/dT */
     J[3220] += dqdT; /* dwdot[CH3CO]/dT */
@@ -25032,11 +24955,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[14][0] - 1)*sc[4] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[12] + (TB[14][3] - 1)*sc[18] + (TB[14][4] - 1)*sc[19] + (TB[14][5] - 1)*sc[21] + (TB[14][6] - 1)*sc[23] + (TB[14][7] - 1)*sc[25];
+    alpha = (memcmp(TB[14], TB[9], 8*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[14][0] - 1)*sc[4] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[12] + (TB[14][3] - 1)*sc[18] + (TB[14][4] - 1)*sc[19] + (TB[14][5] - 1)*sc[21] + (TB[14][6] - 1)*sc[23] + (TB[14][7] - 1)*sc[25]);
     /* forward */
     phi_f = sc[11]*sc[13];
-    k_f = prefactor_units[14] * fwd_A[14]
-                * exp(fwd_beta[14] * tc[0] - activation_units[14] * fwd_Ea[14] * invT);
+    k_f = k_f_s[14];
     dlnkfdT = fwd_beta[14] * invT + activation_units[14] * fwd_Ea[14] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[14] * exp(low_beta[14] * tc[0] - activation_units[14] * low_Ea[14] * invT);
@@ -25052,16 +24974,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[14] == 4 ? exp(-troe_Tss[14] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[14]) > 1.e-100 ? -Fcent1/troe_Tsss[14] : 0.)
+      + (fabs(troe_Ts[14]) > 1.e-100 ? -Fcent2/troe_Ts[14] : 0.)
+      + (troe_len[14] == 4 ? Fcent3*troe_Tss[14]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[14]) > 1.e-100 ? -Fcent1/troe_Tsss[14] : 0.)
-      + (fabs(troe_Ts[14]) > 1.e-100 ? -Fcent2/troe_Ts[14] : 0.)
-      + (troe_len[14] == 4 ? Fcent3*troe_Tss[14]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -25069,7 +24991,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[30];
-    Kc = refCinv * exp(g_RT[11] + g_RT[13] - g_RT[30]);
+    Kc = Kc_s[14];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[13]) + (h_RT[30]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25087,126 +25009,65 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[14][0] - 1)*dcdc_fac;
-        J[239] -= dqdci;              /* dwdot[CH3]/d[H2] */
-        J[241] -= dqdci;              /* dwdot[HCO]/d[H2] */
-        J[258] += dqdci;              /* dwdot[CH3CHO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[14][1] - 1)*dcdc_fac;
-        J[296] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[298] -= dqdci;              /* dwdot[HCO]/d[H2O] */
-        J[315] += dqdci;              /* dwdot[CH3CHO]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[13];
-        J[638] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[640] -= dqdci;              /* dwdot[HCO]/d[CH3] */
-        J[657] += dqdci;              /* dwdot[CH3CHO]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[14][2] - 1)*dcdc_fac;
-        J[695] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[697] -= dqdci;              /* dwdot[HCO]/d[CH4] */
-        J[714] += dqdci;              /* dwdot[CH3CHO]/d[CH4] */
-        /* d()/d[HCO] */
-        dqdci =  + k_f*sc[11];
-        J[752] -= dqdci;              /* dwdot[CH3]/d[HCO] */
-        J[754] -= dqdci;              /* dwdot[HCO]/d[HCO] */
-        J[771] += dqdci;              /* dwdot[CH3CHO]/d[HCO] */
-        /* d()/d[CO] */
-        dqdci = (TB[14][3] - 1)*dcdc_fac;
-        J[1037] -= dqdci;             /* dwdot[CH3]/d[CO] */
-        J[1039] -= dqdci;             /* dwdot[HCO]/d[CO] */
-        J[1056] += dqdci;             /* dwdot[CH3CHO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[14][4] - 1)*dcdc_fac;
-        J[1094] -= dqdci;             /* dwdot[CH3]/d[CO2] */
-        J[1096] -= dqdci;             /* dwdot[HCO]/d[CO2] */
-        J[1113] += dqdci;             /* dwdot[CH3CHO]/d[CO2] */
-        /* d()/d[C2H2] */
-        dqdci = (TB[14][5] - 1)*dcdc_fac;
-        J[1208] -= dqdci;             /* dwdot[CH3]/d[C2H2] */
-        J[1210] -= dqdci;             /* dwdot[HCO]/d[C2H2] */
-        J[1227] += dqdci;             /* dwdot[CH3CHO]/d[C2H2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[14][6] - 1)*dcdc_fac;
-        J[1322] -= dqdci;             /* dwdot[CH3]/d[C2H4] */
-        J[1324] -= dqdci;             /* dwdot[HCO]/d[C2H4] */
-        J[1341] += dqdci;             /* dwdot[CH3CHO]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[14][7] - 1)*dcdc_fac;
-        J[1436] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
-        J[1438] -= dqdci;             /* dwdot[HCO]/d[C2H6] */
-        J[1455] += dqdci;             /* dwdot[CH3CHO]/d[C2H6] */
-        /* d()/d[CH3CHO] */
-        dqdci =  - k_r;
-        J[1721] -= dqdci;             /* dwdot[CH3]/d[CH3CHO] */
-        J[1723] -= dqdci;             /* dwdot[HCO]/d[CH3CHO] */
-        J[1740] += dqdci;             /* dwdot[CH3CHO]/d[CH3CHO] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[14][0]*dcdc_fac;
-        dqdc[5] = TB[14][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac + k_f*sc[13];
-        dqdc[12] = TB[14][2]*dcdc_fac;
-        dqdc[13] = dcdc_fac + k_f*sc[11];
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[14][3]*dcdc_fac;
-        dqdc[19] = TB[14][4]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[14][5]*dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = TB[14][6]*dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = TB[14][7]*dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac - k_r;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+11] -= dqdc[k];
-            J[57*k+13] -= dqdc[k];
-            J[57*k+30] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[11] -= dcdc_fac;
+    Jmix[13] -= dcdc_fac;
+    Jmix[30] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[14][0] - 1)*dcdc_fac;
+    J[239] -= dqdci;              /* dwdot[CH3]/d[H2] */
+    J[241] -= dqdci;              /* dwdot[HCO]/d[H2] */
+    J[258] += dqdci;              /* dwdot[CH3CHO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[14][1] - 1)*dcdc_fac;
+    J[296] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[298] -= dqdci;              /* dwdot[HCO]/d[H2O] */
+    J[315] += dqdci;              /* dwdot[CH3CHO]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[13];
+    J[638] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[640] -= dqdci;              /* dwdot[HCO]/d[CH3] */
+    J[657] += dqdci;              /* dwdot[CH3CHO]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[14][2] - 1)*dcdc_fac;
+    J[695] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[697] -= dqdci;              /* dwdot[HCO]/d[CH4] */
+    J[714] += dqdci;              /* dwdot[CH3CHO]/d[CH4] */
+    /* d()/d[HCO] */
+    dqdci =  + k_f*sc[11];
+    J[752] -= dqdci;              /* dwdot[CH3]/d[HCO] */
+    J[754] -= dqdci;              /* dwdot[HCO]/d[HCO] */
+    J[771] += dqdci;              /* dwdot[CH3CHO]/d[HCO] */
+    /* d()/d[CO] */
+    dqdci = (TB[14][3] - 1)*dcdc_fac;
+    J[1037] -= dqdci;             /* dwdot[CH3]/d[CO] */
+    J[1039] -= dqdci;             /* dwdot[HCO]/d[CO] */
+    J[1056] += dqdci;             /* dwdot[CH3CHO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[14][4] - 1)*dcdc_fac;
+    J[1094] -= dqdci;             /* dwdot[CH3]/d[CO2] */
+    J[1096] -= dqdci;             /* dwdot[HCO]/d[CO2] */
+    J[1113] += dqdci;             /* dwdot[CH3CHO]/d[CO2] */
+    /* d()/d[C2H2] */
+    dqdci = (TB[14][5] - 1)*dcdc_fac;
+    J[1208] -= dqdci;             /* dwdot[CH3]/d[C2H2] */
+    J[1210] -= dqdci;             /* dwdot[HCO]/d[C2H2] */
+    J[1227] += dqdci;             /* dwdot[CH3CHO]/d[C2H2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[14][6] - 1)*dcdc_fac;
+    J[1322] -= dqdci;             /* dwdot[CH3]/d[C2H4] */
+    J[1324] -= dqdci;             /* dwdot[HCO]/d[C2H4] */
+    J[1341] += dqdci;             /* dwdot[CH3CHO]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[14][7] - 1)*dcdc_fac;
+    J[1436] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
+    J[1438] -= dqdci;             /* dwdot[HCO]/d[C2H6] */
+    J[1455] += dqdci;             /* dwdot[CH3CHO]/d[C2H6] */
+    /* d()/d[CH3CHO] */
+    dqdci =  - k_r;
+    J[1721] -= dqdci;             /* dwdot[CH3]/d[CH3CHO] */
+    J[1723] -= dqdci;             /* dwdot[HCO]/d[CH3CHO] */
+    J[1740] += dqdci;             /* dwdot[CH3CHO]/d[CH3CHO] */
     J[3203] -= dqdT; /* dwdot[CH3]/dT */
     J[3205] -= dqdT; /* dwdot[HCO]/dT */
     J[3222] += dqdT; /* dwdot[CH3CHO]/dT */
@@ -25215,11 +25076,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[15][0] - 1)*sc[4] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[12] + (TB[15][3] - 1)*sc[18] + (TB[15][4] - 1)*sc[19] + (TB[15][5] - 1)*sc[25];
+    alpha = (memcmp(TB[15], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[15][0] - 1)*sc[4] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[12] + (TB[15][3] - 1)*sc[18] + (TB[15][4] - 1)*sc[19] + (TB[15][5] - 1)*sc[25]);
     /* forward */
     phi_f = sc[23];
-    k_f = prefactor_units[15] * fwd_A[15]
-                * exp(fwd_beta[15] * tc[0] - activation_units[15] * fwd_Ea[15] * invT);
+    k_f = k_f_s[15];
     dlnkfdT = fwd_beta[15] * invT + activation_units[15] * fwd_Ea[15] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[15] * exp(low_beta[15] * tc[0] - activation_units[15] * low_Ea[15] * invT);
@@ -25235,16 +25095,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[15] == 4 ? exp(-troe_Tss[15] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[15]) > 1.e-100 ? -Fcent1/troe_Tsss[15] : 0.)
+      + (fabs(troe_Ts[15]) > 1.e-100 ? -Fcent2/troe_Ts[15] : 0.)
+      + (troe_len[15] == 4 ? Fcent3*troe_Tss[15]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[15]) > 1.e-100 ? -Fcent1/troe_Tsss[15] : 0.)
-      + (fabs(troe_Ts[15]) > 1.e-100 ? -Fcent2/troe_Ts[15] : 0.)
-      + (troe_len[15] == 4 ? Fcent3*troe_Tss[15]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -25252,7 +25112,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[4]*sc[21];
-    Kc = refC * exp(-g_RT[4] - g_RT[21] + g_RT[23]);
+    Kc = Kc_s[15];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[23]) + (h_RT[4] + h_RT[21]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25270,111 +25130,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[15][0] - 1)*dcdc_fac - k_r*sc[21];
-        J[232] += dqdci;              /* dwdot[H2]/d[H2] */
-        J[249] += dqdci;              /* dwdot[C2H2]/d[H2] */
-        J[251] -= dqdci;              /* dwdot[C2H4]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[15][1] - 1)*dcdc_fac;
-        J[289] += dqdci;              /* dwdot[H2]/d[H2O] */
-        J[306] += dqdci;              /* dwdot[C2H2]/d[H2O] */
-        J[308] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[15][2] - 1)*dcdc_fac;
-        J[688] += dqdci;              /* dwdot[H2]/d[CH4] */
-        J[705] += dqdci;              /* dwdot[C2H2]/d[CH4] */
-        J[707] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[15][3] - 1)*dcdc_fac;
-        J[1030] += dqdci;             /* dwdot[H2]/d[CO] */
-        J[1047] += dqdci;             /* dwdot[C2H2]/d[CO] */
-        J[1049] -= dqdci;             /* dwdot[C2H4]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[15][4] - 1)*dcdc_fac;
-        J[1087] += dqdci;             /* dwdot[H2]/d[CO2] */
-        J[1104] += dqdci;             /* dwdot[C2H2]/d[CO2] */
-        J[1106] -= dqdci;             /* dwdot[C2H4]/d[CO2] */
-        /* d()/d[C2H2] */
-        dqdci =  - k_r*sc[4];
-        J[1201] += dqdci;             /* dwdot[H2]/d[C2H2] */
-        J[1218] += dqdci;             /* dwdot[C2H2]/d[C2H2] */
-        J[1220] -= dqdci;             /* dwdot[C2H4]/d[C2H2] */
-        /* d()/d[C2H4] */
-        dqdci =  + k_f;
-        J[1315] += dqdci;             /* dwdot[H2]/d[C2H4] */
-        J[1332] += dqdci;             /* dwdot[C2H2]/d[C2H4] */
-        J[1334] -= dqdci;             /* dwdot[C2H4]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[15][5] - 1)*dcdc_fac;
-        J[1429] += dqdci;             /* dwdot[H2]/d[C2H6] */
-        J[1446] += dqdci;             /* dwdot[C2H2]/d[C2H6] */
-        J[1448] -= dqdci;             /* dwdot[C2H4]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[15][0]*dcdc_fac - k_r*sc[21];
-        dqdc[5] = TB[15][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = TB[15][2]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[15][3]*dcdc_fac;
-        dqdc[19] = TB[15][4]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac - k_r*sc[4];
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac + k_f;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = TB[15][5]*dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+4] += dqdc[k];
-            J[57*k+21] += dqdc[k];
-            J[57*k+23] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[4] += dcdc_fac;
+    Jmix[21] += dcdc_fac;
+    Jmix[23] -= dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[15][0] - 1)*dcdc_fac - k_r*sc[21];
+    J[232] += dqdci;              /* dwdot[H2]/d[H2] */
+    J[249] += dqdci;              /* dwdot[C2H2]/d[H2] */
+    J[251] -= dqdci;              /* dwdot[C2H4]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[15][1] - 1)*dcdc_fac;
+    J[289] += dqdci;              /* dwdot[H2]/d[H2O] */
+    J[306] += dqdci;              /* dwdot[C2H2]/d[H2O] */
+    J[308] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[15][2] - 1)*dcdc_fac;
+    J[688] += dqdci;              /* dwdot[H2]/d[CH4] */
+    J[705] += dqdci;              /* dwdot[C2H2]/d[CH4] */
+    J[707] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[15][3] - 1)*dcdc_fac;
+    J[1030] += dqdci;             /* dwdot[H2]/d[CO] */
+    J[1047] += dqdci;             /* dwdot[C2H2]/d[CO] */
+    J[1049] -= dqdci;             /* dwdot[C2H4]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[15][4] - 1)*dcdc_fac;
+    J[1087] += dqdci;             /* dwdot[H2]/d[CO2] */
+    J[1104] += dqdci;             /* dwdot[C2H2]/d[CO2] */
+    J[1106] -= dqdci;             /* dwdot[C2H4]/d[CO2] */
+    /* d()/d[C2H2] */
+    dqdci =  - k_r*sc[4];
+    J[1201] += dqdci;             /* dwdot[H2]/d[C2H2] */
+    J[1218] += dqdci;             /* dwdot[C2H2]/d[C2H2] */
+    J[1220] -= dqdci;             /* dwdot[C2H4]/d[C2H2] */
+    /* d()/d[C2H4] */
+    dqdci =  + k_f;
+    J[1315] += dqdci;             /* dwdot[H2]/d[C2H4] */
+    J[1332] += dqdci;             /* dwdot[C2H2]/d[C2H4] */
+    J[1334] -= dqdci;             /* dwdot[C2H4]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[15][5] - 1)*dcdc_fac;
+    J[1429] += dqdci;             /* dwdot[H2]/d[C2H6] */
+    J[1446] += dqdci;             /* dwdot[C2H2]/d[C2H6] */
+    J[1448] -= dqdci;             /* dwdot[C2H4]/d[C2H6] */
     J[3196] += dqdT; /* dwdot[H2]/dT */
     J[3213] += dqdT; /* dwdot[C2H2]/dT */
     J[3215] -= dqdT; /* dwdot[C2H4]/dT */
@@ -25386,8 +25185,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[0]*sc[23];
-    k_f = prefactor_units[16] * fwd_A[16]
-                * exp(fwd_beta[16] * tc[0] - activation_units[16] * fwd_Ea[16] * invT);
+    k_f = k_f_s[16];
     dlnkfdT = fwd_beta[16] * invT + activation_units[16] * fwd_Ea[16] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[16] * exp(low_beta[16] * tc[0] - activation_units[16] * low_Ea[16] * invT);
@@ -25403,16 +25201,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[16] == 4 ? exp(-troe_Tss[16] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[16]) > 1.e-100 ? -Fcent1/troe_Tsss[16] : 0.)
+      + (fabs(troe_Ts[16]) > 1.e-100 ? -Fcent2/troe_Ts[16] : 0.)
+      + (troe_len[16] == 4 ? Fcent3*troe_Tss[16]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[16]) > 1.e-100 ? -Fcent1/troe_Tsss[16] : 0.)
-      + (fabs(troe_Ts[16]) > 1.e-100 ? -Fcent2/troe_Ts[16] : 0.)
-      + (troe_len[16] == 4 ? Fcent3*troe_Tss[16]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -25420,7 +25218,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[24];
-    Kc = refCinv * exp(g_RT[0] + g_RT[23] - g_RT[24]);
+    Kc = Kc_s[16];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[23]) + (h_RT[24]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25438,86 +25236,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[23];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[23] -= dqdci;               /* dwdot[C2H4]/d[H] */
-        J[24] += dqdci;               /* dwdot[C2H5]/d[H] */
-        /* d()/d[C2H4] */
-        dqdci =  + k_f*sc[0];
-        J[1311] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1334] -= dqdci;             /* dwdot[C2H4]/d[C2H4] */
-        J[1335] += dqdci;             /* dwdot[C2H5]/d[C2H4] */
-        /* d()/d[C2H5] */
-        dqdci =  - k_r;
-        J[1368] -= dqdci;             /* dwdot[H]/d[C2H5] */
-        J[1391] -= dqdci;             /* dwdot[C2H4]/d[C2H5] */
-        J[1392] += dqdci;             /* dwdot[C2H5]/d[C2H5] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[23];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac + k_f*sc[0];
-        dqdc[24] = dcdc_fac - k_r;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+0] -= dqdc[k];
-            J[57*k+23] -= dqdc[k];
-            J[57*k+24] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[23] -= dcdc_fac;
+    Jmix[24] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[23];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[23] -= dqdci;               /* dwdot[C2H4]/d[H] */
+    J[24] += dqdci;               /* dwdot[C2H5]/d[H] */
+    /* d()/d[C2H4] */
+    dqdci =  + k_f*sc[0];
+    J[1311] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1334] -= dqdci;             /* dwdot[C2H4]/d[C2H4] */
+    J[1335] += dqdci;             /* dwdot[C2H5]/d[C2H4] */
+    /* d()/d[C2H5] */
+    dqdci =  - k_r;
+    J[1368] -= dqdci;             /* dwdot[H]/d[C2H5] */
+    J[1391] -= dqdci;             /* dwdot[C2H4]/d[C2H5] */
+    J[1392] += dqdci;             /* dwdot[C2H5]/d[C2H5] */
     J[3192] -= dqdT; /* dwdot[H]/dT */
     J[3215] -= dqdT; /* dwdot[C2H4]/dT */
     J[3216] += dqdT; /* dwdot[C2H5]/dT */
@@ -25526,11 +25263,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[17][0] - 1)*sc[4] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[12] + (TB[17][3] - 1)*sc[18] + (TB[17][4] - 1)*sc[19] + (TB[17][5] - 1)*sc[25];
+    alpha = (memcmp(TB[17], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[17][0] - 1)*sc[4] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[12] + (TB[17][3] - 1)*sc[18] + (TB[17][4] - 1)*sc[19] + (TB[17][5] - 1)*sc[25]);
     /* forward */
     phi_f = sc[0]*sc[24];
-    k_f = prefactor_units[17] * fwd_A[17]
-                * exp(fwd_beta[17] * tc[0] - activation_units[17] * fwd_Ea[17] * invT);
+    k_f = k_f_s[17];
     dlnkfdT = fwd_beta[17] * invT + activation_units[17] * fwd_Ea[17] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[17] * exp(low_beta[17] * tc[0] - activation_units[17] * low_Ea[17] * invT);
@@ -25546,16 +25282,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[17] == 4 ? exp(-troe_Tss[17] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[17]) > 1.e-100 ? -Fcent1/troe_Tsss[17] : 0.)
+      + (fabs(troe_Ts[17]) > 1.e-100 ? -Fcent2/troe_Ts[17] : 0.)
+      + (troe_len[17] == 4 ? Fcent3*troe_Tss[17]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[17]) > 1.e-100 ? -Fcent1/troe_Tsss[17] : 0.)
-      + (fabs(troe_Ts[17]) > 1.e-100 ? -Fcent2/troe_Ts[17] : 0.)
-      + (troe_len[17] == 4 ? Fcent3*troe_Tss[17]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -25563,7 +25299,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[25];
-    Kc = refCinv * exp(g_RT[0] + g_RT[24] - g_RT[25]);
+    Kc = Kc_s[17];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[24]) + (h_RT[25]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25581,111 +25317,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[24];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[24] -= dqdci;               /* dwdot[C2H5]/d[H] */
-        J[25] += dqdci;               /* dwdot[C2H6]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[17][0] - 1)*dcdc_fac;
-        J[228] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[252] -= dqdci;              /* dwdot[C2H5]/d[H2] */
-        J[253] += dqdci;              /* dwdot[C2H6]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[17][1] - 1)*dcdc_fac;
-        J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[309] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
-        J[310] += dqdci;              /* dwdot[C2H6]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[17][2] - 1)*dcdc_fac;
-        J[684] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[708] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
-        J[709] += dqdci;              /* dwdot[C2H6]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[17][3] - 1)*dcdc_fac;
-        J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1050] -= dqdci;             /* dwdot[C2H5]/d[CO] */
-        J[1051] += dqdci;             /* dwdot[C2H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[17][4] - 1)*dcdc_fac;
-        J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1107] -= dqdci;             /* dwdot[C2H5]/d[CO2] */
-        J[1108] += dqdci;             /* dwdot[C2H6]/d[CO2] */
-        /* d()/d[C2H5] */
-        dqdci =  + k_f*sc[0];
-        J[1368] -= dqdci;             /* dwdot[H]/d[C2H5] */
-        J[1392] -= dqdci;             /* dwdot[C2H5]/d[C2H5] */
-        J[1393] += dqdci;             /* dwdot[C2H6]/d[C2H5] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[17][5] - 1)*dcdc_fac - k_r;
-        J[1425] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1449] -= dqdci;             /* dwdot[C2H5]/d[C2H6] */
-        J[1450] += dqdci;             /* dwdot[C2H6]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[24];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[17][0]*dcdc_fac;
-        dqdc[5] = TB[17][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = TB[17][2]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[17][3]*dcdc_fac;
-        dqdc[19] = TB[17][4]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac + k_f*sc[0];
-        dqdc[25] = TB[17][5]*dcdc_fac - k_r;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+0] -= dqdc[k];
-            J[57*k+24] -= dqdc[k];
-            J[57*k+25] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[24] -= dcdc_fac;
+    Jmix[25] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[24];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[24] -= dqdci;               /* dwdot[C2H5]/d[H] */
+    J[25] += dqdci;               /* dwdot[C2H6]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[17][0] - 1)*dcdc_fac;
+    J[228] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[252] -= dqdci;              /* dwdot[C2H5]/d[H2] */
+    J[253] += dqdci;              /* dwdot[C2H6]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[17][1] - 1)*dcdc_fac;
+    J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[309] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
+    J[310] += dqdci;              /* dwdot[C2H6]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[17][2] - 1)*dcdc_fac;
+    J[684] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[708] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
+    J[709] += dqdci;              /* dwdot[C2H6]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[17][3] - 1)*dcdc_fac;
+    J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1050] -= dqdci;             /* dwdot[C2H5]/d[CO] */
+    J[1051] += dqdci;             /* dwdot[C2H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[17][4] - 1)*dcdc_fac;
+    J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1107] -= dqdci;             /* dwdot[C2H5]/d[CO2] */
+    J[1108] += dqdci;             /* dwdot[C2H6]/d[CO2] */
+    /* d()/d[C2H5] */
+    dqdci =  + k_f*sc[0];
+    J[1368] -= dqdci;             /* dwdot[H]/d[C2H5] */
+    J[1392] -= dqdci;             /* dwdot[C2H5]/d[C2H5] */
+    J[1393] += dqdci;             /* dwdot[C2H6]/d[C2H5] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[17][5] - 1)*dcdc_fac - k_r;
+    J[1425] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1449] -= dqdci;             /* dwdot[C2H5]/d[C2H6] */
+    J[1450] += dqdci;             /* dwdot[C2H6]/d[C2H6] */
     J[3192] -= dqdT; /* dwdot[H]/dT */
     J[3216] -= dqdT; /* dwdot[C2H5]/dT */
     J[3217] += dqdT; /* dwdot[C2H6]/dT */
@@ -25694,11 +25369,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[18][0] - 1)*sc[4] + (TB[18][1] - 1)*sc[5] + (TB[18][2] - 1)*sc[12] + (TB[18][3] - 1)*sc[18] + (TB[18][4] - 1)*sc[19] + (TB[18][5] - 1)*sc[25];
+    alpha = (memcmp(TB[18], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[18][0] - 1)*sc[4] + (TB[18][1] - 1)*sc[5] + (TB[18][2] - 1)*sc[12] + (TB[18][3] - 1)*sc[18] + (TB[18][4] - 1)*sc[19] + (TB[18][5] - 1)*sc[25]);
     /* forward */
     phi_f = sc[22]*sc[24];
-    k_f = prefactor_units[18] * fwd_A[18]
-                * exp(fwd_beta[18] * tc[0] - activation_units[18] * fwd_Ea[18] * invT);
+    k_f = k_f_s[18];
     dlnkfdT = fwd_beta[18] * invT + activation_units[18] * fwd_Ea[18] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[18] * exp(low_beta[18] * tc[0] - activation_units[18] * low_Ea[18] * invT);
@@ -25714,16 +25388,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[18] == 4 ? exp(-troe_Tss[18] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[18]) > 1.e-100 ? -Fcent1/troe_Tsss[18] : 0.)
+      + (fabs(troe_Ts[18]) > 1.e-100 ? -Fcent2/troe_Ts[18] : 0.)
+      + (troe_len[18] == 4 ? Fcent3*troe_Tss[18]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[18]) > 1.e-100 ? -Fcent1/troe_Tsss[18] : 0.)
-      + (fabs(troe_Ts[18]) > 1.e-100 ? -Fcent2/troe_Ts[18] : 0.)
-      + (troe_len[18] == 4 ? Fcent3*troe_Tss[18]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -25731,7 +25405,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[49];
-    Kc = refCinv * exp(g_RT[22] + g_RT[24] - g_RT[49]);
+    Kc = Kc_s[18];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[22] + h_RT[24]) + (h_RT[49]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25749,116 +25423,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[18][0] - 1)*dcdc_fac;
-        J[250] -= dqdci;              /* dwdot[C2H3]/d[H2] */
-        J[252] -= dqdci;              /* dwdot[C2H5]/d[H2] */
-        J[277] += dqdci;              /* dwdot[C4H81]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[18][1] - 1)*dcdc_fac;
-        J[307] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
-        J[309] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
-        J[334] += dqdci;              /* dwdot[C4H81]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[18][2] - 1)*dcdc_fac;
-        J[706] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
-        J[708] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
-        J[733] += dqdci;              /* dwdot[C4H81]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[18][3] - 1)*dcdc_fac;
-        J[1048] -= dqdci;             /* dwdot[C2H3]/d[CO] */
-        J[1050] -= dqdci;             /* dwdot[C2H5]/d[CO] */
-        J[1075] += dqdci;             /* dwdot[C4H81]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[18][4] - 1)*dcdc_fac;
-        J[1105] -= dqdci;             /* dwdot[C2H3]/d[CO2] */
-        J[1107] -= dqdci;             /* dwdot[C2H5]/d[CO2] */
-        J[1132] += dqdci;             /* dwdot[C4H81]/d[CO2] */
-        /* d()/d[C2H3] */
-        dqdci =  + k_f*sc[24];
-        J[1276] -= dqdci;             /* dwdot[C2H3]/d[C2H3] */
-        J[1278] -= dqdci;             /* dwdot[C2H5]/d[C2H3] */
-        J[1303] += dqdci;             /* dwdot[C4H81]/d[C2H3] */
-        /* d()/d[C2H5] */
-        dqdci =  + k_f*sc[22];
-        J[1390] -= dqdci;             /* dwdot[C2H3]/d[C2H5] */
-        J[1392] -= dqdci;             /* dwdot[C2H5]/d[C2H5] */
-        J[1417] += dqdci;             /* dwdot[C4H81]/d[C2H5] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[18][5] - 1)*dcdc_fac;
-        J[1447] -= dqdci;             /* dwdot[C2H3]/d[C2H6] */
-        J[1449] -= dqdci;             /* dwdot[C2H5]/d[C2H6] */
-        J[1474] += dqdci;             /* dwdot[C4H81]/d[C2H6] */
-        /* d()/d[C4H81] */
-        dqdci =  - k_r;
-        J[2815] -= dqdci;             /* dwdot[C2H3]/d[C4H81] */
-        J[2817] -= dqdci;             /* dwdot[C2H5]/d[C4H81] */
-        J[2842] += dqdci;             /* dwdot[C4H81]/d[C4H81] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[18][0]*dcdc_fac;
-        dqdc[5] = TB[18][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = TB[18][2]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[18][3]*dcdc_fac;
-        dqdc[19] = TB[18][4]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac + k_f*sc[24];
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac + k_f*sc[22];
-        dqdc[25] = TB[18][5]*dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac - k_r;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+22] -= dqdc[k];
-            J[57*k+24] -= dqdc[k];
-            J[57*k+49] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[22] -= dcdc_fac;
+    Jmix[24] -= dcdc_fac;
+    Jmix[49] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[18][0] - 1)*dcdc_fac;
+    J[250] -= dqdci;              /* dwdot[C2H3]/d[H2] */
+    J[252] -= dqdci;              /* dwdot[C2H5]/d[H2] */
+    J[277] += dqdci;              /* dwdot[C4H81]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[18][1] - 1)*dcdc_fac;
+    J[307] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
+    J[309] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
+    J[334] += dqdci;              /* dwdot[C4H81]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[18][2] - 1)*dcdc_fac;
+    J[706] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
+    J[708] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
+    J[733] += dqdci;              /* dwdot[C4H81]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[18][3] - 1)*dcdc_fac;
+    J[1048] -= dqdci;             /* dwdot[C2H3]/d[CO] */
+    J[1050] -= dqdci;             /* dwdot[C2H5]/d[CO] */
+    J[1075] += dqdci;             /* dwdot[C4H81]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[18][4] - 1)*dcdc_fac;
+    J[1105] -= dqdci;             /* dwdot[C2H3]/d[CO2] */
+    J[1107] -= dqdci;             /* dwdot[C2H5]/d[CO2] */
+    J[1132] += dqdci;             /* dwdot[C4H81]/d[CO2] */
+    /* d()/d[C2H3] */
+    dqdci =  + k_f*sc[24];
+    J[1276] -= dqdci;             /* dwdot[C2H3]/d[C2H3] */
+    J[1278] -= dqdci;             /* dwdot[C2H5]/d[C2H3] */
+    J[1303] += dqdci;             /* dwdot[C4H81]/d[C2H3] */
+    /* d()/d[C2H5] */
+    dqdci =  + k_f*sc[22];
+    J[1390] -= dqdci;             /* dwdot[C2H3]/d[C2H5] */
+    J[1392] -= dqdci;             /* dwdot[C2H5]/d[C2H5] */
+    J[1417] += dqdci;             /* dwdot[C4H81]/d[C2H5] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[18][5] - 1)*dcdc_fac;
+    J[1447] -= dqdci;             /* dwdot[C2H3]/d[C2H6] */
+    J[1449] -= dqdci;             /* dwdot[C2H5]/d[C2H6] */
+    J[1474] += dqdci;             /* dwdot[C4H81]/d[C2H6] */
+    /* d()/d[C4H81] */
+    dqdci =  - k_r;
+    J[2815] -= dqdci;             /* dwdot[C2H3]/d[C4H81] */
+    J[2817] -= dqdci;             /* dwdot[C2H5]/d[C4H81] */
+    J[2842] += dqdci;             /* dwdot[C4H81]/d[C4H81] */
     J[3214] -= dqdT; /* dwdot[C2H3]/dT */
     J[3216] -= dqdT; /* dwdot[C2H5]/dT */
     J[3241] += dqdT; /* dwdot[C4H81]/dT */
@@ -25867,11 +25480,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[19][0] - 1)*sc[4] + (TB[19][1] - 1)*sc[5] + (TB[19][2] - 1)*sc[12] + (TB[19][3] - 1)*sc[18] + (TB[19][4] - 1)*sc[19] + (TB[19][5] - 1)*sc[25];
+    alpha = (memcmp(TB[19], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[19][0] - 1)*sc[4] + (TB[19][1] - 1)*sc[5] + (TB[19][2] - 1)*sc[12] + (TB[19][3] - 1)*sc[18] + (TB[19][4] - 1)*sc[19] + (TB[19][5] - 1)*sc[25]);
     /* forward */
     phi_f = sc[0]*sc[34];
-    k_f = prefactor_units[19] * fwd_A[19]
-                * exp(fwd_beta[19] * tc[0] - activation_units[19] * fwd_Ea[19] * invT);
+    k_f = k_f_s[19];
     dlnkfdT = fwd_beta[19] * invT + activation_units[19] * fwd_Ea[19] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[19] * exp(low_beta[19] * tc[0] - activation_units[19] * low_Ea[19] * invT);
@@ -25887,16 +25499,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[19] == 4 ? exp(-troe_Tss[19] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[19]) > 1.e-100 ? -Fcent1/troe_Tsss[19] : 0.)
+      + (fabs(troe_Ts[19]) > 1.e-100 ? -Fcent2/troe_Ts[19] : 0.)
+      + (troe_len[19] == 4 ? Fcent3*troe_Tss[19]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[19]) > 1.e-100 ? -Fcent1/troe_Tsss[19] : 0.)
-      + (fabs(troe_Ts[19]) > 1.e-100 ? -Fcent2/troe_Ts[19] : 0.)
-      + (troe_len[19] == 4 ? Fcent3*troe_Tss[19]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -25904,7 +25516,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[36];
-    Kc = refCinv * exp(g_RT[0] + g_RT[34] - g_RT[36]);
+    Kc = Kc_s[19];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[34]) + (h_RT[36]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25922,116 +25534,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[34];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[34] -= dqdci;               /* dwdot[aC3H5]/d[H] */
-        J[36] += dqdci;               /* dwdot[C3H6]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[19][0] - 1)*dcdc_fac;
-        J[228] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[262] -= dqdci;              /* dwdot[aC3H5]/d[H2] */
-        J[264] += dqdci;              /* dwdot[C3H6]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[19][1] - 1)*dcdc_fac;
-        J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[319] -= dqdci;              /* dwdot[aC3H5]/d[H2O] */
-        J[321] += dqdci;              /* dwdot[C3H6]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[19][2] - 1)*dcdc_fac;
-        J[684] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[718] -= dqdci;              /* dwdot[aC3H5]/d[CH4] */
-        J[720] += dqdci;              /* dwdot[C3H6]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[19][3] - 1)*dcdc_fac;
-        J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1060] -= dqdci;             /* dwdot[aC3H5]/d[CO] */
-        J[1062] += dqdci;             /* dwdot[C3H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[19][4] - 1)*dcdc_fac;
-        J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1117] -= dqdci;             /* dwdot[aC3H5]/d[CO2] */
-        J[1119] += dqdci;             /* dwdot[C3H6]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[19][5] - 1)*dcdc_fac;
-        J[1425] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1459] -= dqdci;             /* dwdot[aC3H5]/d[C2H6] */
-        J[1461] += dqdci;             /* dwdot[C3H6]/d[C2H6] */
-        /* d()/d[aC3H5] */
-        dqdci =  + k_f*sc[0];
-        J[1938] -= dqdci;             /* dwdot[H]/d[aC3H5] */
-        J[1972] -= dqdci;             /* dwdot[aC3H5]/d[aC3H5] */
-        J[1974] += dqdci;             /* dwdot[C3H6]/d[aC3H5] */
-        /* d()/d[C3H6] */
-        dqdci =  - k_r;
-        J[2052] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[2086] -= dqdci;             /* dwdot[aC3H5]/d[C3H6] */
-        J[2088] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[34];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[19][0]*dcdc_fac;
-        dqdc[5] = TB[19][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = TB[19][2]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[19][3]*dcdc_fac;
-        dqdc[19] = TB[19][4]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = TB[19][5]*dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac + k_f*sc[0];
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac - k_r;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+0] -= dqdc[k];
-            J[57*k+34] -= dqdc[k];
-            J[57*k+36] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[34] -= dcdc_fac;
+    Jmix[36] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[34];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[34] -= dqdci;               /* dwdot[aC3H5]/d[H] */
+    J[36] += dqdci;               /* dwdot[C3H6]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[19][0] - 1)*dcdc_fac;
+    J[228] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[262] -= dqdci;              /* dwdot[aC3H5]/d[H2] */
+    J[264] += dqdci;              /* dwdot[C3H6]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[19][1] - 1)*dcdc_fac;
+    J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[319] -= dqdci;              /* dwdot[aC3H5]/d[H2O] */
+    J[321] += dqdci;              /* dwdot[C3H6]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[19][2] - 1)*dcdc_fac;
+    J[684] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[718] -= dqdci;              /* dwdot[aC3H5]/d[CH4] */
+    J[720] += dqdci;              /* dwdot[C3H6]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[19][3] - 1)*dcdc_fac;
+    J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1060] -= dqdci;             /* dwdot[aC3H5]/d[CO] */
+    J[1062] += dqdci;             /* dwdot[C3H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[19][4] - 1)*dcdc_fac;
+    J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1117] -= dqdci;             /* dwdot[aC3H5]/d[CO2] */
+    J[1119] += dqdci;             /* dwdot[C3H6]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[19][5] - 1)*dcdc_fac;
+    J[1425] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1459] -= dqdci;             /* dwdot[aC3H5]/d[C2H6] */
+    J[1461] += dqdci;             /* dwdot[C3H6]/d[C2H6] */
+    /* d()/d[aC3H5] */
+    dqdci =  + k_f*sc[0];
+    J[1938] -= dqdci;             /* dwdot[H]/d[aC3H5] */
+    J[1972] -= dqdci;             /* dwdot[aC3H5]/d[aC3H5] */
+    J[1974] += dqdci;             /* dwdot[C3H6]/d[aC3H5] */
+    /* d()/d[C3H6] */
+    dqdci =  - k_r;
+    J[2052] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[2086] -= dqdci;             /* dwdot[aC3H5]/d[C3H6] */
+    J[2088] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
     J[3192] -= dqdT; /* dwdot[H]/dT */
     J[3226] -= dqdT; /* dwdot[aC3H5]/dT */
     J[3228] += dqdT; /* dwdot[C3H6]/dT */
@@ -26040,11 +25591,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[20][0] - 1)*sc[4] + (TB[20][1] - 1)*sc[5] + (TB[20][2] - 1)*sc[12] + (TB[20][3] - 1)*sc[18] + (TB[20][4] - 1)*sc[19] + (TB[20][5] - 1)*sc[25];
+    alpha = (memcmp(TB[20], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[20][0] - 1)*sc[4] + (TB[20][1] - 1)*sc[5] + (TB[20][2] - 1)*sc[12] + (TB[20][3] - 1)*sc[18] + (TB[20][4] - 1)*sc[19] + (TB[20][5] - 1)*sc[25]);
     /* forward */
     phi_f = sc[11]*sc[34];
-    k_f = prefactor_units[20] * fwd_A[20]
-                * exp(fwd_beta[20] * tc[0] - activation_units[20] * fwd_Ea[20] * invT);
+    k_f = k_f_s[20];
     dlnkfdT = fwd_beta[20] * invT + activation_units[20] * fwd_Ea[20] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[20] * exp(low_beta[20] * tc[0] - activation_units[20] * low_Ea[20] * invT);
@@ -26060,16 +25610,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[20] == 4 ? exp(-troe_Tss[20] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[20]) > 1.e-100 ? -Fcent1/troe_Tsss[20] : 0.)
+      + (fabs(troe_Ts[20]) > 1.e-100 ? -Fcent2/troe_Ts[20] : 0.)
+      + (troe_len[20] == 4 ? Fcent3*troe_Tss[20]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[20]) > 1.e-100 ? -Fcent1/troe_Tsss[20] : 0.)
-      + (fabs(troe_Ts[20]) > 1.e-100 ? -Fcent2/troe_Ts[20] : 0.)
-      + (troe_len[20] == 4 ? Fcent3*troe_Tss[20]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -26077,7 +25627,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[49];
-    Kc = refCinv * exp(g_RT[11] + g_RT[34] - g_RT[49]);
+    Kc = Kc_s[20];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[34]) + (h_RT[49]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26095,116 +25645,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[20][0] - 1)*dcdc_fac;
-        J[239] -= dqdci;              /* dwdot[CH3]/d[H2] */
-        J[262] -= dqdci;              /* dwdot[aC3H5]/d[H2] */
-        J[277] += dqdci;              /* dwdot[C4H81]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[20][1] - 1)*dcdc_fac;
-        J[296] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[319] -= dqdci;              /* dwdot[aC3H5]/d[H2O] */
-        J[334] += dqdci;              /* dwdot[C4H81]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[34];
-        J[638] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[661] -= dqdci;              /* dwdot[aC3H5]/d[CH3] */
-        J[676] += dqdci;              /* dwdot[C4H81]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[20][2] - 1)*dcdc_fac;
-        J[695] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[718] -= dqdci;              /* dwdot[aC3H5]/d[CH4] */
-        J[733] += dqdci;              /* dwdot[C4H81]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[20][3] - 1)*dcdc_fac;
-        J[1037] -= dqdci;             /* dwdot[CH3]/d[CO] */
-        J[1060] -= dqdci;             /* dwdot[aC3H5]/d[CO] */
-        J[1075] += dqdci;             /* dwdot[C4H81]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[20][4] - 1)*dcdc_fac;
-        J[1094] -= dqdci;             /* dwdot[CH3]/d[CO2] */
-        J[1117] -= dqdci;             /* dwdot[aC3H5]/d[CO2] */
-        J[1132] += dqdci;             /* dwdot[C4H81]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[20][5] - 1)*dcdc_fac;
-        J[1436] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
-        J[1459] -= dqdci;             /* dwdot[aC3H5]/d[C2H6] */
-        J[1474] += dqdci;             /* dwdot[C4H81]/d[C2H6] */
-        /* d()/d[aC3H5] */
-        dqdci =  + k_f*sc[11];
-        J[1949] -= dqdci;             /* dwdot[CH3]/d[aC3H5] */
-        J[1972] -= dqdci;             /* dwdot[aC3H5]/d[aC3H5] */
-        J[1987] += dqdci;             /* dwdot[C4H81]/d[aC3H5] */
-        /* d()/d[C4H81] */
-        dqdci =  - k_r;
-        J[2804] -= dqdci;             /* dwdot[CH3]/d[C4H81] */
-        J[2827] -= dqdci;             /* dwdot[aC3H5]/d[C4H81] */
-        J[2842] += dqdci;             /* dwdot[C4H81]/d[C4H81] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[20][0]*dcdc_fac;
-        dqdc[5] = TB[20][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac + k_f*sc[34];
-        dqdc[12] = TB[20][2]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[20][3]*dcdc_fac;
-        dqdc[19] = TB[20][4]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = TB[20][5]*dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac + k_f*sc[11];
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac - k_r;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+11] -= dqdc[k];
-            J[57*k+34] -= dqdc[k];
-            J[57*k+49] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[11] -= dcdc_fac;
+    Jmix[34] -= dcdc_fac;
+    Jmix[49] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[20][0] - 1)*dcdc_fac;
+    J[239] -= dqdci;              /* dwdot[CH3]/d[H2] */
+    J[262] -= dqdci;              /* dwdot[aC3H5]/d[H2] */
+    J[277] += dqdci;              /* dwdot[C4H81]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[20][1] - 1)*dcdc_fac;
+    J[296] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[319] -= dqdci;              /* dwdot[aC3H5]/d[H2O] */
+    J[334] += dqdci;              /* dwdot[C4H81]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[34];
+    J[638] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[661] -= dqdci;              /* dwdot[aC3H5]/d[CH3] */
+    J[676] += dqdci;              /* dwdot[C4H81]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[20][2] - 1)*dcdc_fac;
+    J[695] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[718] -= dqdci;              /* dwdot[aC3H5]/d[CH4] */
+    J[733] += dqdci;              /* dwdot[C4H81]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[20][3] - 1)*dcdc_fac;
+    J[1037] -= dqdci;             /* dwdot[CH3]/d[CO] */
+    J[1060] -= dqdci;             /* dwdot[aC3H5]/d[CO] */
+    J[1075] += dqdci;             /* dwdot[C4H81]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[20][4] - 1)*dcdc_fac;
+    J[1094] -= dqdci;             /* dwdot[CH3]/d[CO2] */
+    J[1117] -= dqdci;             /* dwdot[aC3H5]/d[CO2] */
+    J[1132] += dqdci;             /* dwdot[C4H81]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[20][5] - 1)*dcdc_fac;
+    J[1436] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
+    J[1459] -= dqdci;             /* dwdot[aC3H5]/d[C2H6] */
+    J[1474] += dqdci;             /* dwdot[C4H81]/d[C2H6] */
+    /* d()/d[aC3H5] */
+    dqdci =  + k_f*sc[11];
+    J[1949] -= dqdci;             /* dwdot[CH3]/d[aC3H5] */
+    J[1972] -= dqdci;             /* dwdot[aC3H5]/d[aC3H5] */
+    J[1987] += dqdci;             /* dwdot[C4H81]/d[aC3H5] */
+    /* d()/d[C4H81] */
+    dqdci =  - k_r;
+    J[2804] -= dqdci;             /* dwdot[CH3]/d[C4H81] */
+    J[2827] -= dqdci;             /* dwdot[aC3H5]/d[C4H81] */
+    J[2842] += dqdci;             /* dwdot[C4H81]/d[C4H81] */
     J[3203] -= dqdT; /* dwdot[CH3]/dT */
     J[3226] -= dqdT; /* dwdot[aC3H5]/dT */
     J[3241] += dqdT; /* dwdot[C4H81]/dT */
@@ -26213,11 +25702,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[21][0] - 1)*sc[4] + (TB[21][1] - 1)*sc[5] + (TB[21][2] - 1)*sc[12] + (TB[21][3] - 1)*sc[18] + (TB[21][4] - 1)*sc[19] + (TB[21][5] - 1)*sc[25];
+    alpha = (memcmp(TB[21], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[21][0] - 1)*sc[4] + (TB[21][1] - 1)*sc[5] + (TB[21][2] - 1)*sc[12] + (TB[21][3] - 1)*sc[18] + (TB[21][4] - 1)*sc[19] + (TB[21][5] - 1)*sc[25]);
     /* forward */
     phi_f = sc[0]*sc[36];
-    k_f = prefactor_units[21] * fwd_A[21]
-                * exp(fwd_beta[21] * tc[0] - activation_units[21] * fwd_Ea[21] * invT);
+    k_f = k_f_s[21];
     dlnkfdT = fwd_beta[21] * invT + activation_units[21] * fwd_Ea[21] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[21] * exp(low_beta[21] * tc[0] - activation_units[21] * low_Ea[21] * invT);
@@ -26233,16 +25721,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[21] == 4 ? exp(-troe_Tss[21] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[21]) > 1.e-100 ? -Fcent1/troe_Tsss[21] : 0.)
+      + (fabs(troe_Ts[21]) > 1.e-100 ? -Fcent2/troe_Ts[21] : 0.)
+      + (troe_len[21] == 4 ? Fcent3*troe_Tss[21]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[21]) > 1.e-100 ? -Fcent1/troe_Tsss[21] : 0.)
-      + (fabs(troe_Ts[21]) > 1.e-100 ? -Fcent2/troe_Ts[21] : 0.)
-      + (troe_len[21] == 4 ? Fcent3*troe_Tss[21]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -26250,7 +25738,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[37];
-    Kc = refCinv * exp(g_RT[0] + g_RT[36] - g_RT[37]);
+    Kc = Kc_s[21];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[36]) + (h_RT[37]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26268,116 +25756,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[36];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[36] -= dqdci;               /* dwdot[C3H6]/d[H] */
-        J[37] += dqdci;               /* dwdot[nC3H7]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[21][0] - 1)*dcdc_fac;
-        J[228] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[264] -= dqdci;              /* dwdot[C3H6]/d[H2] */
-        J[265] += dqdci;              /* dwdot[nC3H7]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[21][1] - 1)*dcdc_fac;
-        J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[321] -= dqdci;              /* dwdot[C3H6]/d[H2O] */
-        J[322] += dqdci;              /* dwdot[nC3H7]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[21][2] - 1)*dcdc_fac;
-        J[684] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[720] -= dqdci;              /* dwdot[C3H6]/d[CH4] */
-        J[721] += dqdci;              /* dwdot[nC3H7]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[21][3] - 1)*dcdc_fac;
-        J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1062] -= dqdci;             /* dwdot[C3H6]/d[CO] */
-        J[1063] += dqdci;             /* dwdot[nC3H7]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[21][4] - 1)*dcdc_fac;
-        J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1119] -= dqdci;             /* dwdot[C3H6]/d[CO2] */
-        J[1120] += dqdci;             /* dwdot[nC3H7]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[21][5] - 1)*dcdc_fac;
-        J[1425] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1461] -= dqdci;             /* dwdot[C3H6]/d[C2H6] */
-        J[1462] += dqdci;             /* dwdot[nC3H7]/d[C2H6] */
-        /* d()/d[C3H6] */
-        dqdci =  + k_f*sc[0];
-        J[2052] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[2088] -= dqdci;             /* dwdot[C3H6]/d[C3H6] */
-        J[2089] += dqdci;             /* dwdot[nC3H7]/d[C3H6] */
-        /* d()/d[nC3H7] */
-        dqdci =  - k_r;
-        J[2109] -= dqdci;             /* dwdot[H]/d[nC3H7] */
-        J[2145] -= dqdci;             /* dwdot[C3H6]/d[nC3H7] */
-        J[2146] += dqdci;             /* dwdot[nC3H7]/d[nC3H7] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[36];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[21][0]*dcdc_fac;
-        dqdc[5] = TB[21][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = TB[21][2]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[21][3]*dcdc_fac;
-        dqdc[19] = TB[21][4]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = TB[21][5]*dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac + k_f*sc[0];
-        dqdc[37] = dcdc_fac - k_r;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+0] -= dqdc[k];
-            J[57*k+36] -= dqdc[k];
-            J[57*k+37] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[36] -= dcdc_fac;
+    Jmix[37] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[36];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[36] -= dqdci;               /* dwdot[C3H6]/d[H] */
+    J[37] += dqdci;               /* dwdot[nC3H7]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[21][0] - 1)*dcdc_fac;
+    J[228] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[264] -= dqdci;              /* dwdot[C3H6]/d[H2] */
+    J[265] += dqdci;              /* dwdot[nC3H7]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[21][1] - 1)*dcdc_fac;
+    J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[321] -= dqdci;              /* dwdot[C3H6]/d[H2O] */
+    J[322] += dqdci;              /* dwdot[nC3H7]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[21][2] - 1)*dcdc_fac;
+    J[684] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[720] -= dqdci;              /* dwdot[C3H6]/d[CH4] */
+    J[721] += dqdci;              /* dwdot[nC3H7]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[21][3] - 1)*dcdc_fac;
+    J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1062] -= dqdci;             /* dwdot[C3H6]/d[CO] */
+    J[1063] += dqdci;             /* dwdot[nC3H7]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[21][4] - 1)*dcdc_fac;
+    J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1119] -= dqdci;             /* dwdot[C3H6]/d[CO2] */
+    J[1120] += dqdci;             /* dwdot[nC3H7]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[21][5] - 1)*dcdc_fac;
+    J[1425] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1461] -= dqdci;             /* dwdot[C3H6]/d[C2H6] */
+    J[1462] += dqdci;             /* dwdot[nC3H7]/d[C2H6] */
+    /* d()/d[C3H6] */
+    dqdci =  + k_f*sc[0];
+    J[2052] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[2088] -= dqdci;             /* dwdot[C3H6]/d[C3H6] */
+    J[2089] += dqdci;             /* dwdot[nC3H7]/d[C3H6] */
+    /* d()/d[nC3H7] */
+    dqdci =  - k_r;
+    J[2109] -= dqdci;             /* dwdot[H]/d[nC3H7] */
+    J[2145] -= dqdci;             /* dwdot[C3H6]/d[nC3H7] */
+    J[2146] += dqdci;             /* dwdot[nC3H7]/d[nC3H7] */
     J[3192] -= dqdT; /* dwdot[H]/dT */
     J[3228] -= dqdT; /* dwdot[C3H6]/dT */
     J[3229] += dqdT; /* dwdot[nC3H7]/dT */
@@ -26386,14 +25813,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[22][0] - 1)*sc[4] + (TB[22][1] - 1)*sc[5] + (TB[22][2] - 1)*sc[12] + (TB[22][3] - 1)*sc[18] + (TB[22][4] - 1)*sc[19] + (TB[22][5] - 1)*sc[25];
+    alpha = (memcmp(TB[22], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[22][0] - 1)*sc[4] + (TB[22][1] - 1)*sc[5] + (TB[22][2] - 1)*sc[12] + (TB[22][3] - 1)*sc[18] + (TB[22][4] - 1)*sc[19] + (TB[22][5] - 1)*sc[25]);
     /* forward */
     phi_f = sc[0]*sc[36];
-    k_f = prefactor_units[22] * fwd_A[22]
-                * exp(fwd_beta[22] * tc[0] - activation_units[22] * fwd_Ea[22] * invT);
+    k_f = k_f_s[22];
     dlnkfdT = fwd_beta[22] * invT + activation_units[22] * fwd_Ea[22] * invT2;
     /* pressure-fall-off */
-    k_0 = low_A[22] * exp(low_beta[22] * tc[0] - activation_units[22] * low_Ea[22] * invT);
+    x_0 = low_beta[22] * tc[0] - activation_units[22] * low_Ea[22] * invT;
+    x_0_s[1] = x_0;
+    e_0_s[1] = exp(x_0);
+    k_0 = low_A[22] * e_0_s[1];
     Pr = phase_units[22] * alpha / k_f * k_0;
     fPr = Pr / (1.0+Pr);
     dlnk0dT = low_beta[22] * invT + activation_units[22] * low_Ea[22] * invT2;
@@ -26406,16 +25835,18 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[22] == 4 ? exp(-troe_Tss[22] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[22]) > 1.e-100 ? -Fcent1/troe_Tsss[22] : 0.)
+      + (fabs(troe_Ts[22]) > 1.e-100 ? -Fcent2/troe_Ts[22] : 0.)
+      + (troe_len[22] == 4 ? Fcent3*troe_Tss[22]*invT2 : 0.) );
+    logFcent_s[0] = logFcent;
+    dlogFcentdT_s[0] = dlogFcentdT;
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[22]) > 1.e-100 ? -Fcent1/troe_Tsss[22] : 0.)
-      + (fabs(troe_Ts[22]) > 1.e-100 ? -Fcent2/troe_Ts[22] : 0.)
-      + (troe_len[22] == 4 ? Fcent3*troe_Tss[22]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -26423,7 +25854,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[38];
-    Kc = refCinv * exp(g_RT[0] + g_RT[36] - g_RT[38]);
+    Kc = Kc_s[22];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[36]) + (h_RT[38]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26441,116 +25872,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[36];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[36] -= dqdci;               /* dwdot[C3H6]/d[H] */
-        J[38] += dqdci;               /* dwdot[iC3H7]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[22][0] - 1)*dcdc_fac;
-        J[228] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[264] -= dqdci;              /* dwdot[C3H6]/d[H2] */
-        J[266] += dqdci;              /* dwdot[iC3H7]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[22][1] - 1)*dcdc_fac;
-        J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[321] -= dqdci;              /* dwdot[C3H6]/d[H2O] */
-        J[323] += dqdci;              /* dwdot[iC3H7]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[22][2] - 1)*dcdc_fac;
-        J[684] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[720] -= dqdci;              /* dwdot[C3H6]/d[CH4] */
-        J[722] += dqdci;              /* dwdot[iC3H7]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[22][3] - 1)*dcdc_fac;
-        J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1062] -= dqdci;             /* dwdot[C3H6]/d[CO] */
-        J[1064] += dqdci;             /* dwdot[iC3H7]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[22][4] - 1)*dcdc_fac;
-        J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1119] -= dqdci;             /* dwdot[C3H6]/d[CO2] */
-        J[1121] += dqdci;             /* dwdot[iC3H7]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[22][5] - 1)*dcdc_fac;
-        J[1425] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1461] -= dqdci;             /* dwdot[C3H6]/d[C2H6] */
-        J[1463] += dqdci;             /* dwdot[iC3H7]/d[C2H6] */
-        /* d()/d[C3H6] */
-        dqdci =  + k_f*sc[0];
-        J[2052] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[2088] -= dqdci;             /* dwdot[C3H6]/d[C3H6] */
-        J[2090] += dqdci;             /* dwdot[iC3H7]/d[C3H6] */
-        /* d()/d[iC3H7] */
-        dqdci =  - k_r;
-        J[2166] -= dqdci;             /* dwdot[H]/d[iC3H7] */
-        J[2202] -= dqdci;             /* dwdot[C3H6]/d[iC3H7] */
-        J[2204] += dqdci;             /* dwdot[iC3H7]/d[iC3H7] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[36];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[22][0]*dcdc_fac;
-        dqdc[5] = TB[22][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = TB[22][2]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[22][3]*dcdc_fac;
-        dqdc[19] = TB[22][4]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = TB[22][5]*dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac + k_f*sc[0];
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac - k_r;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+0] -= dqdc[k];
-            J[57*k+36] -= dqdc[k];
-            J[57*k+38] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[36] -= dcdc_fac;
+    Jmix[38] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[36];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[36] -= dqdci;               /* dwdot[C3H6]/d[H] */
+    J[38] += dqdci;               /* dwdot[iC3H7]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[22][0] - 1)*dcdc_fac;
+    J[228] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[264] -= dqdci;              /* dwdot[C3H6]/d[H2] */
+    J[266] += dqdci;              /* dwdot[iC3H7]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[22][1] - 1)*dcdc_fac;
+    J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[321] -= dqdci;              /* dwdot[C3H6]/d[H2O] */
+    J[323] += dqdci;              /* dwdot[iC3H7]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[22][2] - 1)*dcdc_fac;
+    J[684] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[720] -= dqdci;              /* dwdot[C3H6]/d[CH4] */
+    J[722] += dqdci;              /* dwdot[iC3H7]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[22][3] - 1)*dcdc_fac;
+    J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1062] -= dqdci;             /* dwdot[C3H6]/d[CO] */
+    J[1064] += dqdci;             /* dwdot[iC3H7]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[22][4] - 1)*dcdc_fac;
+    J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1119] -= dqdci;             /* dwdot[C3H6]/d[CO2] */
+    J[1121] += dqdci;             /* dwdot[iC3H7]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[22][5] - 1)*dcdc_fac;
+    J[1425] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1461] -= dqdci;             /* dwdot[C3H6]/d[C2H6] */
+    J[1463] += dqdci;             /* dwdot[iC3H7]/d[C2H6] */
+    /* d()/d[C3H6] */
+    dqdci =  + k_f*sc[0];
+    J[2052] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[2088] -= dqdci;             /* dwdot[C3H6]/d[C3H6] */
+    J[2090] += dqdci;             /* dwdot[iC3H7]/d[C3H6] */
+    /* d()/d[iC3H7] */
+    dqdci =  - k_r;
+    J[2166] -= dqdci;             /* dwdot[H]/d[iC3H7] */
+    J[2202] -= dqdci;             /* dwdot[C3H6]/d[iC3H7] */
+    J[2204] += dqdci;             /* dwdot[iC3H7]/d[iC3H7] */
     J[3192] -= dqdT; /* dwdot[H]/dT */
     J[3228] -= dqdT; /* dwdot[C3H6]/dT */
     J[3230] += dqdT; /* dwdot[iC3H7]/dT */
@@ -26559,14 +25929,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[23][0] - 1)*sc[4] + (TB[23][1] - 1)*sc[5] + (TB[23][2] - 1)*sc[12] + (TB[23][3] - 1)*sc[18] + (TB[23][4] - 1)*sc[19] + (TB[23][5] - 1)*sc[25];
+    alpha = (memcmp(TB[23], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[23][0] - 1)*sc[4] + (TB[23][1] - 1)*sc[5] + (TB[23][2] - 1)*sc[12] + (TB[23][3] - 1)*sc[18] + (TB[23][4] - 1)*sc[19] + (TB[23][5] - 1)*sc[25]);
     /* forward */
     phi_f = sc[0]*sc[52];
-    k_f = prefactor_units[23] * fwd_A[23]
-                * exp(fwd_beta[23] * tc[0] - activation_units[23] * fwd_Ea[23] * invT);
+    k_f = k_f_s[23];
     dlnkfdT = fwd_beta[23] * invT + activation_units[23] * fwd_Ea[23] * invT2;
     /* pressure-fall-off */
-    k_0 = low_A[23] * exp(low_beta[23] * tc[0] - activation_units[23] * low_Ea[23] * invT);
+    x_0 = low_beta[23] * tc[0] - activation_units[23] * low_Ea[23] * invT;
+    k_0 = low_A[23] * (x_0 == x_0_s[1] ? e_0_s[1] : exp(x_0));
     Pr = phase_units[23] * alpha / k_f * k_0;
     fPr = Pr / (1.0+Pr);
     dlnk0dT = low_beta[23] * invT + activation_units[23] * low_Ea[23] * invT2;
@@ -26574,21 +25944,28 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogfPrdT = dlogPrdT / (1.0+Pr);
     /* Troe form */
     logPr = log10(Pr);
-    Fcent1 = (fabs(troe_Tsss[23]) > 1.e-100 ? (1.-troe_a[23])*exp(-T/troe_Tsss[23]) : 0.);
-    Fcent2 = (fabs(troe_Ts[23]) > 1.e-100 ? troe_a[23] * exp(-T/troe_Ts[23]) : 0.);
-    Fcent3 = (troe_len[23] == 4 ? exp(-troe_Tss[23] * invT) : 0.);
-    Fcent = Fcent1 + Fcent2 + Fcent3;
-    logFcent = log10(Fcent);
+    if (troe_a[23] == troe_a[22] && troe_Tsss[23] == troe_Tsss[22] && troe_Ts[23] == troe_Ts[22]
+        && troe_Tss[23] == troe_Tss[22] && troe_len[23] == troe_len[22]) {
+        logFcent = logFcent_s[0];
+        dlogFcentdT = dlogFcentdT_s[0];
+    }
+    else {
+        Fcent1 = (fabs(troe_Tsss[23]) > 1.e-100 ? (1.-troe_a[23])*exp(-T/troe_Tsss[23]) : 0.);
+        Fcent2 = (fabs(troe_Ts[23]) > 1.e-100 ? troe_a[23] * exp(-T/troe_Ts[23]) : 0.);
+        Fcent3 = (troe_len[23] == 4 ? exp(-troe_Tss[23] * invT) : 0.);
+        Fcent = Fcent1 + Fcent2 + Fcent3;
+        logFcent = log10(Fcent);
+        dlogFcentdT = log10e/Fcent*( 
+            (fabs(troe_Tsss[23]) > 1.e-100 ? -Fcent1/troe_Tsss[23] : 0.)
+          + (fabs(troe_Ts[23]) > 1.e-100 ? -Fcent2/troe_Ts[23] : 0.)
+          + (troe_len[23] == 4 ? Fcent3*troe_Tss[23]*invT2 : 0.) );
+    }
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[23]) > 1.e-100 ? -Fcent1/troe_Tsss[23] : 0.)
-      + (fabs(troe_Ts[23]) > 1.e-100 ? -Fcent2/troe_Ts[23] : 0.)
-      + (troe_len[23] == 4 ? Fcent3*troe_Tss[23]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -26596,7 +25973,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[36]*sc[37];
-    Kc = exp(g_RT[0] - g_RT[36] - g_RT[37] + g_RT[52]);
+    Kc = Kc_s[23];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[52]) + (h_RT[36] + h_RT[37]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26615,132 +25992,71 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[52];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[36] += dqdci;               /* dwdot[C3H6]/d[H] */
-        J[37] += dqdci;               /* dwdot[nC3H7]/d[H] */
-        J[52] -= dqdci;               /* dwdot[C6H12]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[23][0] - 1)*dcdc_fac;
-        J[228] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[264] += dqdci;              /* dwdot[C3H6]/d[H2] */
-        J[265] += dqdci;              /* dwdot[nC3H7]/d[H2] */
-        J[280] -= dqdci;              /* dwdot[C6H12]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[23][1] - 1)*dcdc_fac;
-        J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[321] += dqdci;              /* dwdot[C3H6]/d[H2O] */
-        J[322] += dqdci;              /* dwdot[nC3H7]/d[H2O] */
-        J[337] -= dqdci;              /* dwdot[C6H12]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[23][2] - 1)*dcdc_fac;
-        J[684] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[720] += dqdci;              /* dwdot[C3H6]/d[CH4] */
-        J[721] += dqdci;              /* dwdot[nC3H7]/d[CH4] */
-        J[736] -= dqdci;              /* dwdot[C6H12]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[23][3] - 1)*dcdc_fac;
-        J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1062] += dqdci;             /* dwdot[C3H6]/d[CO] */
-        J[1063] += dqdci;             /* dwdot[nC3H7]/d[CO] */
-        J[1078] -= dqdci;             /* dwdot[C6H12]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[23][4] - 1)*dcdc_fac;
-        J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1119] += dqdci;             /* dwdot[C3H6]/d[CO2] */
-        J[1120] += dqdci;             /* dwdot[nC3H7]/d[CO2] */
-        J[1135] -= dqdci;             /* dwdot[C6H12]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[23][5] - 1)*dcdc_fac;
-        J[1425] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1461] += dqdci;             /* dwdot[C3H6]/d[C2H6] */
-        J[1462] += dqdci;             /* dwdot[nC3H7]/d[C2H6] */
-        J[1477] -= dqdci;             /* dwdot[C6H12]/d[C2H6] */
-        /* d()/d[C3H6] */
-        dqdci =  - k_r*sc[37];
-        J[2052] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[2088] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
-        J[2089] += dqdci;             /* dwdot[nC3H7]/d[C3H6] */
-        J[2104] -= dqdci;             /* dwdot[C6H12]/d[C3H6] */
-        /* d()/d[nC3H7] */
-        dqdci =  - k_r*sc[36];
-        J[2109] -= dqdci;             /* dwdot[H]/d[nC3H7] */
-        J[2145] += dqdci;             /* dwdot[C3H6]/d[nC3H7] */
-        J[2146] += dqdci;             /* dwdot[nC3H7]/d[nC3H7] */
-        J[2161] -= dqdci;             /* dwdot[C6H12]/d[nC3H7] */
-        /* d()/d[C6H12] */
-        dqdci =  + k_f*sc[0];
-        J[2964] -= dqdci;             /* dwdot[H]/d[C6H12] */
-        J[3000] += dqdci;             /* dwdot[C3H6]/d[C6H12] */
-        J[3001] += dqdci;             /* dwdot[nC3H7]/d[C6H12] */
-        J[3016] -= dqdci;             /* dwdot[C6H12]/d[C6H12] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[52];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[23][0]*dcdc_fac;
-        dqdc[5] = TB[23][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = TB[23][2]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[23][3]*dcdc_fac;
-        dqdc[19] = TB[23][4]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = TB[23][5]*dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac - k_r*sc[37];
-        dqdc[37] = dcdc_fac - k_r*sc[36];
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac + k_f*sc[0];
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+0] -= dqdc[k];
-            J[57*k+36] += dqdc[k];
-            J[57*k+37] += dqdc[k];
-            J[57*k+52] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[36] += dcdc_fac;
+    Jmix[37] += dcdc_fac;
+    Jmix[52] -= dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[52];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[36] += dqdci;               /* dwdot[C3H6]/d[H] */
+    J[37] += dqdci;               /* dwdot[nC3H7]/d[H] */
+    J[52] -= dqdci;               /* dwdot[C6H12]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[23][0] - 1)*dcdc_fac;
+    J[228] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[264] += dqdci;              /* dwdot[C3H6]/d[H2] */
+    J[265] += dqdci;              /* dwdot[nC3H7]/d[H2] */
+    J[280] -= dqdci;              /* dwdot[C6H12]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[23][1] - 1)*dcdc_fac;
+    J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[321] += dqdci;              /* dwdot[C3H6]/d[H2O] */
+    J[322] += dqdci;              /* dwdot[nC3H7]/d[H2O] */
+    J[337] -= dqdci;              /* dwdot[C6H12]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[23][2] - 1)*dcdc_fac;
+    J[684] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[720] += dqdci;              /* dwdot[C3H6]/d[CH4] */
+    J[721] += dqdci;              /* dwdot[nC3H7]/d[CH4] */
+    J[736] -= dqdci;              /* dwdot[C6H12]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[23][3] - 1)*dcdc_fac;
+    J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1062] += dqdci;             /* dwdot[C3H6]/d[CO] */
+    J[1063] += dqdci;             /* dwdot[nC3H7]/d[CO] */
+    J[1078] -= dqdci;             /* dwdot[C6H12]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[23][4] - 1)*dcdc_fac;
+    J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1119] += dqdci;             /* dwdot[C3H6]/d[CO2] */
+    J[1120] += dqdci;             /* dwdot[nC3H7]/d[CO2] */
+    J[1135] -= dqdci;             /* dwdot[C6H12]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[23][5] - 1)*dcdc_fac;
+    J[1425] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1461] += dqdci;             /* dwdot[C3H6]/d[C2H6] */
+    J[1462] += dqdci;             /* dwdot[nC3H7]/d[C2H6] */
+    J[1477] -= dqdci;             /* dwdot[C6H12]/d[C2H6] */
+    /* d()/d[C3H6] */
+    dqdci =  - k_r*sc[37];
+    J[2052] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[2088] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
+    J[2089] += dqdci;             /* dwdot[nC3H7]/d[C3H6] */
+    J[2104] -= dqdci;             /* dwdot[C6H12]/d[C3H6] */
+    /* d()/d[nC3H7] */
+    dqdci =  - k_r*sc[36];
+    J[2109] -= dqdci;             /* dwdot[H]/d[nC3H7] */
+    J[2145] += dqdci;             /* dwdot[C3H6]/d[nC3H7] */
+    J[2146] += dqdci;             /* dwdot[nC3H7]/d[nC3H7] */
+    J[2161] -= dqdci;             /* dwdot[C6H12]/d[nC3H7] */
+    /* d()/d[C6H12] */
+    dqdci =  + k_f*sc[0];
+    J[2964] -= dqdci;             /* dwdot[H]/d[C6H12] */
+    J[3000] += dqdci;             /* dwdot[C3H6]/d[C6H12] */
+    J[3001] += dqdci;             /* dwdot[nC3H7]/d[C6H12] */
+    J[3016] -= dqdci;             /* dwdot[C6H12]/d[C6H12] */
     J[3192] -= dqdT; /* dwdot[H]/dT */
     J[3228] += dqdT; /* dwdot[C3H6]/dT */
     J[3229] += dqdT; /* dwdot[nC3H7]/dT */
@@ -26750,14 +26066,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[24][0] - 1)*sc[4] + (TB[24][1] - 1)*sc[5] + (TB[24][2] - 1)*sc[12] + (TB[24][3] - 1)*sc[18] + (TB[24][4] - 1)*sc[19] + (TB[24][5] - 1)*sc[25];
+    alpha = (memcmp(TB[24], TB[2], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[24][0] - 1)*sc[4] + (TB[24][1] - 1)*sc[5] + (TB[24][2] - 1)*sc[12] + (TB[24][3] - 1)*sc[18] + (TB[24][4] - 1)*sc[19] + (TB[24][5] - 1)*sc[25]);
     /* forward */
     phi_f = sc[0]*sc[54];
-    k_f = prefactor_units[24] * fwd_A[24]
-                * exp(fwd_beta[24] * tc[0] - activation_units[24] * fwd_Ea[24] * invT);
+    k_f = k_f_s[24];
     dlnkfdT = fwd_beta[24] * invT + activation_units[24] * fwd_Ea[24] * invT2;
     /* pressure-fall-off */
-    k_0 = low_A[24] * exp(low_beta[24] * tc[0] - activation_units[24] * low_Ea[24] * invT);
+    x_0 = low_beta[24] * tc[0] - activation_units[24] * low_Ea[24] * invT;
+    k_0 = low_A[24] * (x_0 == x_0_s[1] ? e_0_s[1] : exp(x_0));
     Pr = phase_units[24] * alpha / k_f * k_0;
     fPr = Pr / (1.0+Pr);
     dlnk0dT = low_beta[24] * invT + activation_units[24] * low_Ea[24] * invT2;
@@ -26765,21 +26081,28 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogfPrdT = dlogPrdT / (1.0+Pr);
     /* Troe form */
     logPr = log10(Pr);
-    Fcent1 = (fabs(troe_Tsss[24]) > 1.e-100 ? (1.-troe_a[24])*exp(-T/troe_Tsss[24]) : 0.);
-    Fcent2 = (fabs(troe_Ts[24]) > 1.e-100 ? troe_a[24] * exp(-T/troe_Ts[24]) : 0.);
-    Fcent3 = (troe_len[24] == 4 ? exp(-troe_Tss[24] * invT) : 0.);
-    Fcent = Fcent1 + Fcent2 + Fcent3;
-    logFcent = log10(Fcent);
+    if (troe_a[24] == troe_a[22] && troe_Tsss[24] == troe_Tsss[22] && troe_Ts[24] == troe_Ts[22]
+        && troe_Tss[24] == troe_Tss[22] && troe_len[24] == troe_len[22]) {
+        logFcent = logFcent_s[0];
+        dlogFcentdT = dlogFcentdT_s[0];
+    }
+    else {
+        Fcent1 = (fabs(troe_Tsss[24]) > 1.e-100 ? (1.-troe_a[24])*exp(-T/troe_Tsss[24]) : 0.);
+        Fcent2 = (fabs(troe_Ts[24]) > 1.e-100 ? troe_a[24] * exp(-T/troe_Ts[24]) : 0.);
+        Fcent3 = (troe_len[24] == 4 ? exp(-troe_Tss[24] * invT) : 0.);
+        Fcent = Fcent1 + Fcent2 + Fcent3;
+        logFcent = log10(Fcent);
+        dlogFcentdT = log10e/Fcent*( 
+            (fabs(troe_Tsss[24]) > 1.e-100 ? -Fcent1/troe_Tsss[24] : 0.)
+          + (fabs(troe_Ts[24]) > 1.e-100 ? -Fcent2/troe_Ts[24] : 0.)
+          + (troe_len[24] == 4 ? Fcent3*troe_Tss[24]*invT2 : 0.) );
+    }
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[24]) > 1.e-100 ? -Fcent1/troe_Tsss[24] : 0.)
-      + (fabs(troe_Ts[24]) > 1.e-100 ? -Fcent2/troe_Ts[24] : 0.)
-      + (troe_len[24] == 4 ? Fcent3*troe_Tss[24]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -26787,7 +26110,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[24]*sc[36];
-    Kc = exp(g_RT[0] - g_RT[24] - g_RT[36] + g_RT[54]);
+    Kc = Kc_s[24];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[54]) + (h_RT[24] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26806,132 +26129,71 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[54];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[24] += dqdci;               /* dwdot[C2H5]/d[H] */
-        J[36] += dqdci;               /* dwdot[C3H6]/d[H] */
-        J[54] -= dqdci;               /* dwdot[C5H10]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[24][0] - 1)*dcdc_fac;
-        J[228] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[252] += dqdci;              /* dwdot[C2H5]/d[H2] */
-        J[264] += dqdci;              /* dwdot[C3H6]/d[H2] */
-        J[282] -= dqdci;              /* dwdot[C5H10]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[24][1] - 1)*dcdc_fac;
-        J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[309] += dqdci;              /* dwdot[C2H5]/d[H2O] */
-        J[321] += dqdci;              /* dwdot[C3H6]/d[H2O] */
-        J[339] -= dqdci;              /* dwdot[C5H10]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[24][2] - 1)*dcdc_fac;
-        J[684] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[708] += dqdci;              /* dwdot[C2H5]/d[CH4] */
-        J[720] += dqdci;              /* dwdot[C3H6]/d[CH4] */
-        J[738] -= dqdci;              /* dwdot[C5H10]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[24][3] - 1)*dcdc_fac;
-        J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1050] += dqdci;             /* dwdot[C2H5]/d[CO] */
-        J[1062] += dqdci;             /* dwdot[C3H6]/d[CO] */
-        J[1080] -= dqdci;             /* dwdot[C5H10]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[24][4] - 1)*dcdc_fac;
-        J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1107] += dqdci;             /* dwdot[C2H5]/d[CO2] */
-        J[1119] += dqdci;             /* dwdot[C3H6]/d[CO2] */
-        J[1137] -= dqdci;             /* dwdot[C5H10]/d[CO2] */
-        /* d()/d[C2H5] */
-        dqdci =  - k_r*sc[36];
-        J[1368] -= dqdci;             /* dwdot[H]/d[C2H5] */
-        J[1392] += dqdci;             /* dwdot[C2H5]/d[C2H5] */
-        J[1404] += dqdci;             /* dwdot[C3H6]/d[C2H5] */
-        J[1422] -= dqdci;             /* dwdot[C5H10]/d[C2H5] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[24][5] - 1)*dcdc_fac;
-        J[1425] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1449] += dqdci;             /* dwdot[C2H5]/d[C2H6] */
-        J[1461] += dqdci;             /* dwdot[C3H6]/d[C2H6] */
-        J[1479] -= dqdci;             /* dwdot[C5H10]/d[C2H6] */
-        /* d()/d[C3H6] */
-        dqdci =  - k_r*sc[24];
-        J[2052] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[2076] += dqdci;             /* dwdot[C2H5]/d[C3H6] */
-        J[2088] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
-        J[2106] -= dqdci;             /* dwdot[C5H10]/d[C3H6] */
-        /* d()/d[C5H10] */
-        dqdci =  + k_f*sc[0];
-        J[3078] -= dqdci;             /* dwdot[H]/d[C5H10] */
-        J[3102] += dqdci;             /* dwdot[C2H5]/d[C5H10] */
-        J[3114] += dqdci;             /* dwdot[C3H6]/d[C5H10] */
-        J[3132] -= dqdci;             /* dwdot[C5H10]/d[C5H10] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[54];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[24][0]*dcdc_fac;
-        dqdc[5] = TB[24][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = TB[24][2]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[24][3]*dcdc_fac;
-        dqdc[19] = TB[24][4]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac - k_r*sc[36];
-        dqdc[25] = TB[24][5]*dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac - k_r*sc[24];
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac + k_f*sc[0];
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+0] -= dqdc[k];
-            J[57*k+24] += dqdc[k];
-            J[57*k+36] += dqdc[k];
-            J[57*k+54] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[24] += dcdc_fac;
+    Jmix[36] += dcdc_fac;
+    Jmix[54] -= dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[54];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[24] += dqdci;               /* dwdot[C2H5]/d[H] */
+    J[36] += dqdci;               /* dwdot[C3H6]/d[H] */
+    J[54] -= dqdci;               /* dwdot[C5H10]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[24][0] - 1)*dcdc_fac;
+    J[228] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[252] += dqdci;              /* dwdot[C2H5]/d[H2] */
+    J[264] += dqdci;              /* dwdot[C3H6]/d[H2] */
+    J[282] -= dqdci;              /* dwdot[C5H10]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[24][1] - 1)*dcdc_fac;
+    J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[309] += dqdci;              /* dwdot[C2H5]/d[H2O] */
+    J[321] += dqdci;              /* dwdot[C3H6]/d[H2O] */
+    J[339] -= dqdci;              /* dwdot[C5H10]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[24][2] - 1)*dcdc_fac;
+    J[684] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[708] += dqdci;              /* dwdot[C2H5]/d[CH4] */
+    J[720] += dqdci;              /* dwdot[C3H6]/d[CH4] */
+    J[738] -= dqdci;              /* dwdot[C5H10]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[24][3] - 1)*dcdc_fac;
+    J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1050] += dqdci;             /* dwdot[C2H5]/d[CO] */
+    J[1062] += dqdci;             /* dwdot[C3H6]/d[CO] */
+    J[1080] -= dqdci;             /* dwdot[C5H10]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[24][4] - 1)*dcdc_fac;
+    J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1107] += dqdci;             /* dwdot[C2H5]/d[CO2] */
+    J[1119] += dqdci;             /* dwdot[C3H6]/d[CO2] */
+    J[1137] -= dqdci;             /* dwdot[C5H10]/d[CO2] */
+    /* d()/d[C2H5] */
+    dqdci =  - k_r*sc[36];
+    J[1368] -= dqdci;             /* dwdot[H]/d[C2H5] */
+    J[1392] += dqdci;             /* dwdot[C2H5]/d[C2H5] */
+    J[1404] += dqdci;             /* dwdot[C3H6]/d[C2H5] */
+    J[1422] -= dqdci;             /* dwdot[C5H10]/d[C2H5] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[24][5] - 1)*dcdc_fac;
+    J[1425] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1449] += dqdci;             /* dwdot[C2H5]/d[C2H6] */
+    J[1461] += dqdci;             /* dwdot[C3H6]/d[C2H6] */
+    J[1479] -= dqdci;             /* dwdot[C5H10]/d[C2H6] */
+    /* d()/d[C3H6] */
+    dqdci =  - k_r*sc[24];
+    J[2052] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[2076] += dqdci;             /* dwdot[C2H5]/d[C3H6] */
+    J[2088] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
+    J[2106] -= dqdci;             /* dwdot[C5H10]/d[C3H6] */
+    /* d()/d[C5H10] */
+    dqdci =  + k_f*sc[0];
+    J[3078] -= dqdci;             /* dwdot[H]/d[C5H10] */
+    J[3102] += dqdci;             /* dwdot[C2H5]/d[C5H10] */
+    J[3114] += dqdci;             /* dwdot[C3H6]/d[C5H10] */
+    J[3132] -= dqdci;             /* dwdot[C5H10]/d[C5H10] */
     J[3192] -= dqdT; /* dwdot[H]/dT */
     J[3216] += dqdT; /* dwdot[C2H5]/dT */
     J[3228] += dqdT; /* dwdot[C3H6]/dT */
@@ -26941,11 +26203,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[25][0] - 1)*sc[4] + (TB[25][1] - 1)*sc[5] + (TB[25][2] - 1)*sc[18] + (TB[25][3] - 1)*sc[19];
+    alpha = alpha_eff2;
     /* forward */
     phi_f = sc[1]*sc[18];
-    k_f = prefactor_units[25] * fwd_A[25]
-                * exp(fwd_beta[25] * tc[0] - activation_units[25] * fwd_Ea[25] * invT);
+    k_f = k_f_s[25];
     dlnkfdT = fwd_beta[25] * invT + activation_units[25] * fwd_Ea[25] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[25] * exp(low_beta[25] * tc[0] - activation_units[25] * low_Ea[25] * invT);
@@ -26960,7 +26221,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = 0.0;
     /* reverse */
     phi_r = sc[19];
-    Kc = refCinv * exp(g_RT[1] + g_RT[18] - g_RT[19]);
+    Kc = Kc_s[25];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[18]) + (h_RT[19]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26978,96 +26239,35 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[18];
-        J[58] -= dqdci;               /* dwdot[O]/d[O] */
-        J[75] -= dqdci;               /* dwdot[CO]/d[O] */
-        J[76] += dqdci;               /* dwdot[CO2]/d[O] */
-        /* d()/d[H2] */
-        dqdci = (TB[25][0] - 1)*dcdc_fac;
-        J[229] -= dqdci;              /* dwdot[O]/d[H2] */
-        J[246] -= dqdci;              /* dwdot[CO]/d[H2] */
-        J[247] += dqdci;              /* dwdot[CO2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[25][1] - 1)*dcdc_fac;
-        J[286] -= dqdci;              /* dwdot[O]/d[H2O] */
-        J[303] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[304] += dqdci;              /* dwdot[CO2]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[25][2] - 1)*dcdc_fac + k_f*sc[1];
-        J[1027] -= dqdci;             /* dwdot[O]/d[CO] */
-        J[1044] -= dqdci;             /* dwdot[CO]/d[CO] */
-        J[1045] += dqdci;             /* dwdot[CO2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[25][3] - 1)*dcdc_fac - k_r;
-        J[1084] -= dqdci;             /* dwdot[O]/d[CO2] */
-        J[1101] -= dqdci;             /* dwdot[CO]/d[CO2] */
-        J[1102] += dqdci;             /* dwdot[CO2]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[18];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[25][0]*dcdc_fac;
-        dqdc[5] = TB[25][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[25][2]*dcdc_fac + k_f*sc[1];
-        dqdc[19] = TB[25][3]*dcdc_fac - k_r;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+1] -= dqdc[k];
-            J[57*k+18] -= dqdc[k];
-            J[57*k+19] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[18] -= dcdc_fac;
+    Jmix[19] += dcdc_fac;
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[18];
+    J[58] -= dqdci;               /* dwdot[O]/d[O] */
+    J[75] -= dqdci;               /* dwdot[CO]/d[O] */
+    J[76] += dqdci;               /* dwdot[CO2]/d[O] */
+    /* d()/d[H2] */
+    dqdci = (TB[25][0] - 1)*dcdc_fac;
+    J[229] -= dqdci;              /* dwdot[O]/d[H2] */
+    J[246] -= dqdci;              /* dwdot[CO]/d[H2] */
+    J[247] += dqdci;              /* dwdot[CO2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[25][1] - 1)*dcdc_fac;
+    J[286] -= dqdci;              /* dwdot[O]/d[H2O] */
+    J[303] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[304] += dqdci;              /* dwdot[CO2]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[25][2] - 1)*dcdc_fac + k_f*sc[1];
+    J[1027] -= dqdci;             /* dwdot[O]/d[CO] */
+    J[1044] -= dqdci;             /* dwdot[CO]/d[CO] */
+    J[1045] += dqdci;             /* dwdot[CO2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[25][3] - 1)*dcdc_fac - k_r;
+    J[1084] -= dqdci;             /* dwdot[O]/d[CO2] */
+    J[1101] -= dqdci;             /* dwdot[CO]/d[CO2] */
+    J[1102] += dqdci;             /* dwdot[CO2]/d[CO2] */
     J[3193] -= dqdT; /* dwdot[O]/dT */
     J[3210] -= dqdT; /* dwdot[CO]/dT */
     J[3211] += dqdT; /* dwdot[CO2]/dT */
@@ -27078,12 +26278,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[26][0] - 1)*sc[4] + (TB[26][1] - 1)*sc[5] + (TB[26][2] - 1)*sc[19];
     /* forward */
     phi_f = sc[0]*sc[0];
-    k_f = prefactor_units[26] * fwd_A[26]
-                * exp(fwd_beta[26] * tc[0] - activation_units[26] * fwd_Ea[26] * invT);
+    k_f = k_f_s[26];
     dlnkfdT = fwd_beta[26] * invT + activation_units[26] * fwd_Ea[26] * invT2;
     /* reverse */
     phi_r = sc[4];
-    Kc = refCinv * exp(2*g_RT[0] - g_RT[4]);
+    Kc = Kc_s[26];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[0]) + (h_RT[4]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27097,86 +26296,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*2*sc[0];
-        J[0] += -2 * dqdci;           /* dwdot[H]/d[H] */
-        J[4] += dqdci;                /* dwdot[H2]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[26][0] - 1)*q_nocor - k_r;
-        J[228] += -2 * dqdci;         /* dwdot[H]/d[H2] */
-        J[232] += dqdci;              /* dwdot[H2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[26][1] - 1)*q_nocor;
-        J[285] += -2 * dqdci;         /* dwdot[H]/d[H2O] */
-        J[289] += dqdci;              /* dwdot[H2]/d[H2O] */
-        /* d()/d[CO2] */
-        dqdci = (TB[26][2] - 1)*q_nocor;
-        J[1083] += -2 * dqdci;        /* dwdot[H]/d[CO2] */
-        J[1087] += dqdci;             /* dwdot[H2]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*2*sc[0];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[26][0] - k_r;
-        dqdc[5] = TB[26][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = TB[26][2];
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+0] += -2 * dqdc[k];
-            J[57*k+4] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += -2 * q_nocor;
+    Jmix[4] += q_nocor;
+    /* d()/d[H] */
+    dqdci =  + k_f*2*sc[0];
+    J[0] += -2 * dqdci;           /* dwdot[H]/d[H] */
+    J[4] += dqdci;                /* dwdot[H2]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[26][0] - 1)*q_nocor - k_r;
+    J[228] += -2 * dqdci;         /* dwdot[H]/d[H2] */
+    J[232] += dqdci;              /* dwdot[H2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[26][1] - 1)*q_nocor;
+    J[285] += -2 * dqdci;         /* dwdot[H]/d[H2O] */
+    J[289] += dqdci;              /* dwdot[H2]/d[H2O] */
+    /* d()/d[CO2] */
+    dqdci = (TB[26][2] - 1)*q_nocor;
+    J[1083] += -2 * dqdci;        /* dwdot[H]/d[CO2] */
+    J[1087] += dqdci;             /* dwdot[H2]/d[CO2] */
     J[3192] += -2 * dqdT; /* dwdot[H]/dT */
     J[3196] += dqdT; /* dwdot[H2]/dT */
 
@@ -27186,12 +26324,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[27][0] - 1)*sc[4] + (TB[27][1] - 1)*sc[5] + (TB[27][2] - 1)*sc[18] + (TB[27][3] - 1)*sc[19];
     /* forward */
     phi_f = sc[0]*sc[2];
-    k_f = prefactor_units[27] * fwd_A[27]
-                * exp(fwd_beta[27] * tc[0] - activation_units[27] * fwd_Ea[27] * invT);
+    k_f = k_f_s[27];
     dlnkfdT = fwd_beta[27] * invT + activation_units[27] * fwd_Ea[27] * invT2;
     /* reverse */
     phi_r = sc[5];
-    Kc = refCinv * exp(g_RT[0] + g_RT[2] - g_RT[5]);
+    Kc = Kc_s[27];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[2]) + (h_RT[5]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27206,101 +26343,40 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[2];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[2] -= dqdci;                /* dwdot[OH]/d[H] */
-        J[5] += dqdci;                /* dwdot[H2O]/d[H] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*sc[0];
-        J[114] -= dqdci;              /* dwdot[H]/d[OH] */
-        J[116] -= dqdci;              /* dwdot[OH]/d[OH] */
-        J[119] += dqdci;              /* dwdot[H2O]/d[OH] */
-        /* d()/d[H2] */
-        dqdci = (TB[27][0] - 1)*q_nocor;
-        J[228] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[230] -= dqdci;              /* dwdot[OH]/d[H2] */
-        J[233] += dqdci;              /* dwdot[H2O]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[27][1] - 1)*q_nocor - k_r;
-        J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[287] -= dqdci;              /* dwdot[OH]/d[H2O] */
-        J[290] += dqdci;              /* dwdot[H2O]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[27][2] - 1)*q_nocor;
-        J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1028] -= dqdci;             /* dwdot[OH]/d[CO] */
-        J[1031] += dqdci;             /* dwdot[H2O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[27][3] - 1)*q_nocor;
-        J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1085] -= dqdci;             /* dwdot[OH]/d[CO2] */
-        J[1088] += dqdci;             /* dwdot[H2O]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[2];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*sc[0];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[27][0];
-        dqdc[5] = TB[27][1] - k_r;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[27][2];
-        dqdc[19] = TB[27][3];
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+0] -= dqdc[k];
-            J[57*k+2] -= dqdc[k];
-            J[57*k+5] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= q_nocor;
+    Jmix[2] -= q_nocor;
+    Jmix[5] += q_nocor;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[2];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[2] -= dqdci;                /* dwdot[OH]/d[H] */
+    J[5] += dqdci;                /* dwdot[H2O]/d[H] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*sc[0];
+    J[114] -= dqdci;              /* dwdot[H]/d[OH] */
+    J[116] -= dqdci;              /* dwdot[OH]/d[OH] */
+    J[119] += dqdci;              /* dwdot[H2O]/d[OH] */
+    /* d()/d[H2] */
+    dqdci = (TB[27][0] - 1)*q_nocor;
+    J[228] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[230] -= dqdci;              /* dwdot[OH]/d[H2] */
+    J[233] += dqdci;              /* dwdot[H2O]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[27][1] - 1)*q_nocor - k_r;
+    J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[287] -= dqdci;              /* dwdot[OH]/d[H2O] */
+    J[290] += dqdci;              /* dwdot[H2O]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[27][2] - 1)*q_nocor;
+    J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1028] -= dqdci;             /* dwdot[OH]/d[CO] */
+    J[1031] += dqdci;             /* dwdot[H2O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[27][3] - 1)*q_nocor;
+    J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1085] -= dqdci;             /* dwdot[OH]/d[CO2] */
+    J[1088] += dqdci;             /* dwdot[H2O]/d[CO2] */
     J[3192] -= dqdT; /* dwdot[H]/dT */
     J[3194] -= dqdT; /* dwdot[OH]/dT */
     J[3197] += dqdT; /* dwdot[H2O]/dT */
@@ -27308,15 +26384,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 29: O + H + M <=> OH + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[28][0] - 1)*sc[4] + (TB[28][1] - 1)*sc[5] + (TB[28][2] - 1)*sc[18] + (TB[28][3] - 1)*sc[19];
+    alpha = (memcmp(TB[28], TB[25], 4*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[28][0] - 1)*sc[4] + (TB[28][1] - 1)*sc[5] + (TB[28][2] - 1)*sc[18] + (TB[28][3] - 1)*sc[19]);
     /* forward */
     phi_f = sc[0]*sc[1];
-    k_f = prefactor_units[28] * fwd_A[28]
-                * exp(fwd_beta[28] * tc[0] - activation_units[28] * fwd_Ea[28] * invT);
+    k_f = k_f_s[28];
     dlnkfdT = fwd_beta[28] * invT + activation_units[28] * fwd_Ea[28] * invT2;
     /* reverse */
     phi_r = sc[2];
-    Kc = refCinv * exp(g_RT[0] + g_RT[1] - g_RT[2]);
+    Kc = Kc_s[28];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[1]) + (h_RT[2]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27331,106 +26406,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[1];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[1] -= dqdci;                /* dwdot[O]/d[H] */
-        J[2] += dqdci;                /* dwdot[OH]/d[H] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[0];
-        J[57] -= dqdci;               /* dwdot[H]/d[O] */
-        J[58] -= dqdci;               /* dwdot[O]/d[O] */
-        J[59] += dqdci;               /* dwdot[OH]/d[O] */
-        /* d()/d[OH] */
-        dqdci =  - k_r;
-        J[114] -= dqdci;              /* dwdot[H]/d[OH] */
-        J[115] -= dqdci;              /* dwdot[O]/d[OH] */
-        J[116] += dqdci;              /* dwdot[OH]/d[OH] */
-        /* d()/d[H2] */
-        dqdci = (TB[28][0] - 1)*q_nocor;
-        J[228] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[229] -= dqdci;              /* dwdot[O]/d[H2] */
-        J[230] += dqdci;              /* dwdot[OH]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[28][1] - 1)*q_nocor;
-        J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[286] -= dqdci;              /* dwdot[O]/d[H2O] */
-        J[287] += dqdci;              /* dwdot[OH]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[28][2] - 1)*q_nocor;
-        J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
-        J[1027] -= dqdci;             /* dwdot[O]/d[CO] */
-        J[1028] += dqdci;             /* dwdot[OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[28][3] - 1)*q_nocor;
-        J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1084] -= dqdci;             /* dwdot[O]/d[CO2] */
-        J[1085] += dqdci;             /* dwdot[OH]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[1];
-        dqdc[1] = dcdc_fac + k_f*sc[0];
-        dqdc[2] = dcdc_fac - k_r;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[28][0];
-        dqdc[5] = TB[28][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[28][2];
-        dqdc[19] = TB[28][3];
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+0] -= dqdc[k];
-            J[57*k+1] -= dqdc[k];
-            J[57*k+2] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= q_nocor;
+    Jmix[1] -= q_nocor;
+    Jmix[2] += q_nocor;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[1];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[1] -= dqdci;                /* dwdot[O]/d[H] */
+    J[2] += dqdci;                /* dwdot[OH]/d[H] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[0];
+    J[57] -= dqdci;               /* dwdot[H]/d[O] */
+    J[58] -= dqdci;               /* dwdot[O]/d[O] */
+    J[59] += dqdci;               /* dwdot[OH]/d[O] */
+    /* d()/d[OH] */
+    dqdci =  - k_r;
+    J[114] -= dqdci;              /* dwdot[H]/d[OH] */
+    J[115] -= dqdci;              /* dwdot[O]/d[OH] */
+    J[116] += dqdci;              /* dwdot[OH]/d[OH] */
+    /* d()/d[H2] */
+    dqdci = (TB[28][0] - 1)*q_nocor;
+    J[228] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[229] -= dqdci;              /* dwdot[O]/d[H2] */
+    J[230] += dqdci;              /* dwdot[OH]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[28][1] - 1)*q_nocor;
+    J[285] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[286] -= dqdci;              /* dwdot[O]/d[H2O] */
+    J[287] += dqdci;              /* dwdot[OH]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[28][2] - 1)*q_nocor;
+    J[1026] -= dqdci;             /* dwdot[H]/d[CO] */
+    J[1027] -= dqdci;             /* dwdot[O]/d[CO] */
+    J[1028] += dqdci;             /* dwdot[OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[28][3] - 1)*q_nocor;
+    J[1083] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1084] -= dqdci;             /* dwdot[O]/d[CO2] */
+    J[1085] += dqdci;             /* dwdot[OH]/d[CO2] */
     J[3192] -= dqdT; /* dwdot[H]/dT */
     J[3193] -= dqdT; /* dwdot[O]/dT */
     J[3194] += dqdT; /* dwdot[OH]/dT */
@@ -27441,12 +26455,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[29][0] - 1)*sc[4] + (TB[29][1] - 1)*sc[5] + (TB[29][2] - 1)*sc[18] + (TB[29][3] - 1)*sc[19];
     /* forward */
     phi_f = sc[1]*sc[1];
-    k_f = prefactor_units[29] * fwd_A[29]
-                * exp(fwd_beta[29] * tc[0] - activation_units[29] * fwd_Ea[29] * invT);
+    k_f = k_f_s[29];
     dlnkfdT = fwd_beta[29] * invT + activation_units[29] * fwd_Ea[29] * invT2;
     /* reverse */
     phi_r = sc[7];
-    Kc = refCinv * exp(2*g_RT[1] - g_RT[7]);
+    Kc = Kc_s[29];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[1]) + (h_RT[7]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27460,94 +26473,33 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[O] */
-        dqdci =  + k_f*2*sc[1];
-        J[58] += -2 * dqdci;          /* dwdot[O]/d[O] */
-        J[64] += dqdci;               /* dwdot[O2]/d[O] */
-        /* d()/d[H2] */
-        dqdci = (TB[29][0] - 1)*q_nocor;
-        J[229] += -2 * dqdci;         /* dwdot[O]/d[H2] */
-        J[235] += dqdci;              /* dwdot[O2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[29][1] - 1)*q_nocor;
-        J[286] += -2 * dqdci;         /* dwdot[O]/d[H2O] */
-        J[292] += dqdci;              /* dwdot[O2]/d[H2O] */
-        /* d()/d[O2] */
-        dqdci =  - k_r;
-        J[400] += -2 * dqdci;         /* dwdot[O]/d[O2] */
-        J[406] += dqdci;              /* dwdot[O2]/d[O2] */
-        /* d()/d[CO] */
-        dqdci = (TB[29][2] - 1)*q_nocor;
-        J[1027] += -2 * dqdci;        /* dwdot[O]/d[CO] */
-        J[1033] += dqdci;             /* dwdot[O2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[29][3] - 1)*q_nocor;
-        J[1084] += -2 * dqdci;        /* dwdot[O]/d[CO2] */
-        J[1090] += dqdci;             /* dwdot[O2]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*2*sc[1];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[29][0];
-        dqdc[5] = TB[29][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac - k_r;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[29][2];
-        dqdc[19] = TB[29][3];
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+1] += -2 * dqdc[k];
-            J[57*k+7] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] += -2 * q_nocor;
+    Jmix[7] += q_nocor;
+    /* d()/d[O] */
+    dqdci =  + k_f*2*sc[1];
+    J[58] += -2 * dqdci;          /* dwdot[O]/d[O] */
+    J[64] += dqdci;               /* dwdot[O2]/d[O] */
+    /* d()/d[H2] */
+    dqdci = (TB[29][0] - 1)*q_nocor;
+    J[229] += -2 * dqdci;         /* dwdot[O]/d[H2] */
+    J[235] += dqdci;              /* dwdot[O2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[29][1] - 1)*q_nocor;
+    J[286] += -2 * dqdci;         /* dwdot[O]/d[H2O] */
+    J[292] += dqdci;              /* dwdot[O2]/d[H2O] */
+    /* d()/d[O2] */
+    dqdci =  - k_r;
+    J[400] += -2 * dqdci;         /* dwdot[O]/d[O2] */
+    J[406] += dqdci;              /* dwdot[O2]/d[O2] */
+    /* d()/d[CO] */
+    dqdci = (TB[29][2] - 1)*q_nocor;
+    J[1027] += -2 * dqdci;        /* dwdot[O]/d[CO] */
+    J[1033] += dqdci;             /* dwdot[O2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[29][3] - 1)*q_nocor;
+    J[1084] += -2 * dqdci;        /* dwdot[O]/d[CO2] */
+    J[1090] += dqdci;             /* dwdot[O2]/d[CO2] */
     J[3193] += -2 * dqdT; /* dwdot[O]/dT */
     J[3199] += dqdT; /* dwdot[O2]/dT */
 
@@ -27557,12 +26509,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[30][0] - 1)*sc[4] + (TB[30][1] - 1)*sc[5] + (TB[30][2] - 1)*sc[18] + (TB[30][3] - 1)*sc[19];
     /* forward */
     phi_f = sc[13];
-    k_f = prefactor_units[30] * fwd_A[30]
-                * exp(fwd_beta[30] * tc[0] - activation_units[30] * fwd_Ea[30] * invT);
+    k_f = k_f_s[30];
     dlnkfdT = fwd_beta[30] * invT + activation_units[30] * fwd_Ea[30] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[18];
-    Kc = refC * exp(-g_RT[0] + g_RT[13] - g_RT[18]);
+    Kc = Kc_s[30];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13]) + (h_RT[0] + h_RT[18]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27577,101 +26528,40 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[18];
-        J[0] += dqdci;                /* dwdot[H]/d[H] */
-        J[13] -= dqdci;               /* dwdot[HCO]/d[H] */
-        J[18] += dqdci;               /* dwdot[CO]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[30][0] - 1)*q_nocor;
-        J[228] += dqdci;              /* dwdot[H]/d[H2] */
-        J[241] -= dqdci;              /* dwdot[HCO]/d[H2] */
-        J[246] += dqdci;              /* dwdot[CO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[30][1] - 1)*q_nocor;
-        J[285] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[298] -= dqdci;              /* dwdot[HCO]/d[H2O] */
-        J[303] += dqdci;              /* dwdot[CO]/d[H2O] */
-        /* d()/d[HCO] */
-        dqdci =  + k_f;
-        J[741] += dqdci;              /* dwdot[H]/d[HCO] */
-        J[754] -= dqdci;              /* dwdot[HCO]/d[HCO] */
-        J[759] += dqdci;              /* dwdot[CO]/d[HCO] */
-        /* d()/d[CO] */
-        dqdci = (TB[30][2] - 1)*q_nocor - k_r*sc[0];
-        J[1026] += dqdci;             /* dwdot[H]/d[CO] */
-        J[1039] -= dqdci;             /* dwdot[HCO]/d[CO] */
-        J[1044] += dqdci;             /* dwdot[CO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[30][3] - 1)*q_nocor;
-        J[1083] += dqdci;             /* dwdot[H]/d[CO2] */
-        J[1096] -= dqdci;             /* dwdot[HCO]/d[CO2] */
-        J[1101] += dqdci;             /* dwdot[CO]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac - k_r*sc[18];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[30][0];
-        dqdc[5] = TB[30][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac + k_f;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = TB[30][2] - k_r*sc[0];
-        dqdc[19] = TB[30][3];
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        for (int k=0; k<56; k++) {
-            J[57*k+0] += dqdc[k];
-            J[57*k+13] -= dqdc[k];
-            J[57*k+18] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += q_nocor;
+    Jmix[13] -= q_nocor;
+    Jmix[18] += q_nocor;
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[18];
+    J[0] += dqdci;                /* dwdot[H]/d[H] */
+    J[13] -= dqdci;               /* dwdot[HCO]/d[H] */
+    J[18] += dqdci;               /* dwdot[CO]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[30][0] - 1)*q_nocor;
+    J[228] += dqdci;              /* dwdot[H]/d[H2] */
+    J[241] -= dqdci;              /* dwdot[HCO]/d[H2] */
+    J[246] += dqdci;              /* dwdot[CO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[30][1] - 1)*q_nocor;
+    J[285] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[298] -= dqdci;              /* dwdot[HCO]/d[H2O] */
+    J[303] += dqdci;              /* dwdot[CO]/d[H2O] */
+    /* d()/d[HCO] */
+    dqdci =  + k_f;
+    J[741] += dqdci;              /* dwdot[H]/d[HCO] */
+    J[754] -= dqdci;              /* dwdot[HCO]/d[HCO] */
+    J[759] += dqdci;              /* dwdot[CO]/d[HCO] */
+    /* d()/d[CO] */
+    dqdci = (TB[30][2] - 1)*q_nocor - k_r*sc[0];
+    J[1026] += dqdci;             /* dwdot[H]/d[CO] */
+    J[1039] -= dqdci;             /* dwdot[HCO]/d[CO] */
+    J[1044] += dqdci;             /* dwdot[CO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[30][3] - 1)*q_nocor;
+    J[1083] += dqdci;             /* dwdot[H]/d[CO2] */
+    J[1096] -= dqdci;             /* dwdot[HCO]/d[CO2] */
+    J[1101] += dqdci;             /* dwdot[CO]/d[CO2] */
     J[3192] += dqdT; /* dwdot[H]/dT */
     J[3205] -= dqdT; /* dwdot[HCO]/dT */
     J[3210] += dqdT; /* dwdot[CO]/dT */
@@ -27680,12 +26570,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[7];
-    k_f = prefactor_units[31] * fwd_A[31]
-                * exp(fwd_beta[31] * tc[0] - activation_units[31] * fwd_Ea[31] * invT);
+    k_f = k_f_s[31];
     dlnkfdT = fwd_beta[31] * invT + activation_units[31] * fwd_Ea[31] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[2];
-    Kc = exp(g_RT[0] - g_RT[1] - g_RT[2] + g_RT[7]);
+    Kc = Kc_s[31];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[7]) + (h_RT[1] + h_RT[2]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27731,12 +26620,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[4];
-    k_f = prefactor_units[32] * fwd_A[32]
-                * exp(fwd_beta[32] * tc[0] - activation_units[32] * fwd_Ea[32] * invT);
+    k_f = k_f_s[32];
     dlnkfdT = fwd_beta[32] * invT + activation_units[32] * fwd_Ea[32] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[2];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[2] + g_RT[4]);
+    Kc = Kc_s[32];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[4]) + (h_RT[0] + h_RT[2]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27782,12 +26670,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[4];
-    k_f = prefactor_units[33] * fwd_A[33]
-                * exp(fwd_beta[33] * tc[0] - activation_units[33] * fwd_Ea[33] * invT);
+    k_f = k_f_s[33];
     dlnkfdT = fwd_beta[33] * invT + activation_units[33] * fwd_Ea[33] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[5];
-    Kc = exp(-g_RT[0] + g_RT[2] + g_RT[4] - g_RT[5]);
+    Kc = Kc_s[33];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[4]) + (h_RT[0] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27833,12 +26720,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[2];
-    k_f = prefactor_units[34] * fwd_A[34]
-                * exp(fwd_beta[34] * tc[0] - activation_units[34] * fwd_Ea[34] * invT);
+    k_f = k_f_s[34];
     dlnkfdT = fwd_beta[34] * invT + activation_units[34] * fwd_Ea[34] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[5];
-    Kc = exp(-g_RT[1] + 2*g_RT[2] - g_RT[5]);
+    Kc = Kc_s[34];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[2]) + (h_RT[1] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27873,12 +26759,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[0]*sc[5];
-    k_f = prefactor_units[35] * fwd_A[35]
-                * exp(fwd_beta[35] * tc[0] - activation_units[35] * fwd_Ea[35] * invT);
+    k_f = k_f_s[35];
     dlnkfdT = fwd_beta[35] * invT + activation_units[35] * fwd_Ea[35] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[5];
-    Kc = refCinv * exp(2*g_RT[0] - g_RT[4] + g_RT[5] - g_RT[5]);
+    Kc = Kc_s[35];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[0] + h_RT[5]) + (h_RT[4] + h_RT[5]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27908,12 +26793,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[7];
-    k_f = prefactor_units[36] * fwd_A[36]
-                * exp(fwd_beta[36] * tc[0] - activation_units[36] * fwd_Ea[36] * invT);
+    k_f = k_f_s[36];
     dlnkfdT = fwd_beta[36] * invT + activation_units[36] * fwd_Ea[36] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[3];
-    Kc = exp(-g_RT[0] - g_RT[3] + g_RT[4] + g_RT[7]);
+    Kc = Kc_s[36];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[7]) + (h_RT[0] + h_RT[3]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27959,12 +26843,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[3];
-    k_f = prefactor_units[37] * fwd_A[37]
-                * exp(fwd_beta[37] * tc[0] - activation_units[37] * fwd_Ea[37] * invT);
+    k_f = k_f_s[37];
     dlnkfdT = fwd_beta[37] * invT + activation_units[37] * fwd_Ea[37] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[5];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[3] - g_RT[5]);
+    Kc = Kc_s[37];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[3]) + (h_RT[1] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28010,12 +26893,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[3];
-    k_f = prefactor_units[38] * fwd_A[38]
-                * exp(fwd_beta[38] * tc[0] - activation_units[38] * fwd_Ea[38] * invT);
+    k_f = k_f_s[38];
     dlnkfdT = fwd_beta[38] * invT + activation_units[38] * fwd_Ea[38] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[2];
-    Kc = exp(g_RT[0] - 2*g_RT[2] + g_RT[3]);
+    Kc = Kc_s[38];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[3]) + (2*h_RT[2]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28050,12 +26932,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3];
-    k_f = prefactor_units[39] * fwd_A[39]
-                * exp(fwd_beta[39] * tc[0] - activation_units[39] * fwd_Ea[39] * invT);
+    k_f = k_f_s[39];
     dlnkfdT = fwd_beta[39] * invT + activation_units[39] * fwd_Ea[39] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[7];
-    Kc = exp(g_RT[1] - g_RT[2] + g_RT[3] - g_RT[7]);
+    Kc = Kc_s[39];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3]) + (h_RT[2] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28101,12 +26982,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[3];
-    k_f = prefactor_units[40] * fwd_A[40]
-                * exp(fwd_beta[40] * tc[0] - activation_units[40] * fwd_Ea[40] * invT);
+    k_f = k_f_s[40];
     dlnkfdT = fwd_beta[40] * invT + activation_units[40] * fwd_Ea[40] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[7];
-    Kc = exp(g_RT[2] + g_RT[3] - g_RT[5] - g_RT[7]);
+    Kc = Kc_s[40];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[3]) + (h_RT[5] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28152,12 +27032,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[3];
-    k_f = prefactor_units[41] * fwd_A[41]
-                * exp(fwd_beta[41] * tc[0] - activation_units[41] * fwd_Ea[41] * invT);
+    k_f = k_f_s[41];
     dlnkfdT = fwd_beta[41] * invT + activation_units[41] * fwd_Ea[41] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[7];
-    Kc = exp(g_RT[2] + g_RT[3] - g_RT[5] - g_RT[7]);
+    Kc = Kc_s[41];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[3]) + (h_RT[5] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28203,12 +27082,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[3];
-    k_f = prefactor_units[42] * fwd_A[42]
-                * exp(fwd_beta[42] * tc[0] - activation_units[42] * fwd_Ea[42] * invT);
+    k_f = k_f_s[42];
     dlnkfdT = fwd_beta[42] * invT + activation_units[42] * fwd_Ea[42] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[7];
-    Kc = exp(2*g_RT[3] - g_RT[6] - g_RT[7]);
+    Kc = Kc_s[42];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[3]) + (h_RT[6] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28243,12 +27121,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[3];
-    k_f = prefactor_units[43] * fwd_A[43]
-                * exp(fwd_beta[43] * tc[0] - activation_units[43] * fwd_Ea[43] * invT);
+    k_f = k_f_s[43];
     dlnkfdT = fwd_beta[43] * invT + activation_units[43] * fwd_Ea[43] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[7];
-    Kc = exp(2*g_RT[3] - g_RT[6] - g_RT[7]);
+    Kc = Kc_s[43];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[3]) + (h_RT[6] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28283,12 +27160,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[6];
-    k_f = prefactor_units[44] * fwd_A[44]
-                * exp(fwd_beta[44] * tc[0] - activation_units[44] * fwd_Ea[44] * invT);
+    k_f = k_f_s[44];
     dlnkfdT = fwd_beta[44] * invT + activation_units[44] * fwd_Ea[44] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[4];
-    Kc = exp(g_RT[0] - g_RT[3] - g_RT[4] + g_RT[6]);
+    Kc = Kc_s[44];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[6]) + (h_RT[3] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28334,12 +27210,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[6];
-    k_f = prefactor_units[45] * fwd_A[45]
-                * exp(fwd_beta[45] * tc[0] - activation_units[45] * fwd_Ea[45] * invT);
+    k_f = k_f_s[45];
     dlnkfdT = fwd_beta[45] * invT + activation_units[45] * fwd_Ea[45] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[5];
-    Kc = exp(g_RT[0] - g_RT[2] - g_RT[5] + g_RT[6]);
+    Kc = Kc_s[45];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[6]) + (h_RT[2] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28385,12 +27260,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[6];
-    k_f = prefactor_units[46] * fwd_A[46]
-                * exp(fwd_beta[46] * tc[0] - activation_units[46] * fwd_Ea[46] * invT);
+    k_f = k_f_s[46];
     dlnkfdT = fwd_beta[46] * invT + activation_units[46] * fwd_Ea[46] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[3];
-    Kc = exp(g_RT[1] - g_RT[2] - g_RT[3] + g_RT[6]);
+    Kc = Kc_s[46];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[6]) + (h_RT[2] + h_RT[3]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28436,12 +27310,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[6];
-    k_f = prefactor_units[47] * fwd_A[47]
-                * exp(fwd_beta[47] * tc[0] - activation_units[47] * fwd_Ea[47] * invT);
+    k_f = k_f_s[47];
     dlnkfdT = fwd_beta[47] * invT + activation_units[47] * fwd_Ea[47] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[5];
-    Kc = exp(g_RT[2] - g_RT[3] - g_RT[5] + g_RT[6]);
+    Kc = Kc_s[47];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[6]) + (h_RT[3] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28487,12 +27360,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[6];
-    k_f = prefactor_units[48] * fwd_A[48]
-                * exp(fwd_beta[48] * tc[0] - activation_units[48] * fwd_Ea[48] * invT);
+    k_f = k_f_s[48];
     dlnkfdT = fwd_beta[48] * invT + activation_units[48] * fwd_Ea[48] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[5];
-    Kc = exp(g_RT[2] - g_RT[3] - g_RT[5] + g_RT[6]);
+    Kc = Kc_s[48];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[6]) + (h_RT[3] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28538,12 +27410,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[18];
-    k_f = prefactor_units[49] * fwd_A[49]
-                * exp(fwd_beta[49] * tc[0] - activation_units[49] * fwd_Ea[49] * invT);
+    k_f = k_f_s[49];
     dlnkfdT = fwd_beta[49] * invT + activation_units[49] * fwd_Ea[49] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[19];
-    Kc = exp(-g_RT[0] + g_RT[2] + g_RT[18] - g_RT[19]);
+    Kc = Kc_s[49];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[18]) + (h_RT[0] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28589,12 +27460,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[18];
-    k_f = prefactor_units[50] * fwd_A[50]
-                * exp(fwd_beta[50] * tc[0] - activation_units[50] * fwd_Ea[50] * invT);
+    k_f = k_f_s[50];
     dlnkfdT = fwd_beta[50] * invT + activation_units[50] * fwd_Ea[50] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[19];
-    Kc = exp(-g_RT[0] + g_RT[2] + g_RT[18] - g_RT[19]);
+    Kc = Kc_s[50];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[18]) + (h_RT[0] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28640,12 +27510,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[18];
-    k_f = prefactor_units[51] * fwd_A[51]
-                * exp(fwd_beta[51] * tc[0] - activation_units[51] * fwd_Ea[51] * invT);
+    k_f = k_f_s[51];
     dlnkfdT = fwd_beta[51] * invT + activation_units[51] * fwd_Ea[51] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[19];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[18] - g_RT[19]);
+    Kc = Kc_s[51];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[18]) + (h_RT[2] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28691,12 +27560,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[13];
-    k_f = prefactor_units[52] * fwd_A[52]
-                * exp(fwd_beta[52] * tc[0] - activation_units[52] * fwd_Ea[52] * invT);
+    k_f = k_f_s[52];
     dlnkfdT = fwd_beta[52] * invT + activation_units[52] * fwd_Ea[52] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[18];
-    Kc = exp(g_RT[0] - g_RT[4] + g_RT[13] - g_RT[18]);
+    Kc = Kc_s[52];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[13]) + (h_RT[4] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28742,12 +27610,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[13];
-    k_f = prefactor_units[53] * fwd_A[53]
-                * exp(fwd_beta[53] * tc[0] - activation_units[53] * fwd_Ea[53] * invT);
+    k_f = k_f_s[53];
     dlnkfdT = fwd_beta[53] * invT + activation_units[53] * fwd_Ea[53] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[18];
-    Kc = exp(g_RT[1] - g_RT[2] + g_RT[13] - g_RT[18]);
+    Kc = Kc_s[53];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[13]) + (h_RT[2] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28793,12 +27660,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[13];
-    k_f = prefactor_units[54] * fwd_A[54]
-                * exp(fwd_beta[54] * tc[0] - activation_units[54] * fwd_Ea[54] * invT);
+    k_f = k_f_s[54];
     dlnkfdT = fwd_beta[54] * invT + activation_units[54] * fwd_Ea[54] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[19];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[13] - g_RT[19]);
+    Kc = Kc_s[54];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[13]) + (h_RT[0] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28844,12 +27710,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[13];
-    k_f = prefactor_units[55] * fwd_A[55]
-                * exp(fwd_beta[55] * tc[0] - activation_units[55] * fwd_Ea[55] * invT);
+    k_f = k_f_s[55];
     dlnkfdT = fwd_beta[55] * invT + activation_units[55] * fwd_Ea[55] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[18];
-    Kc = exp(g_RT[2] - g_RT[5] + g_RT[13] - g_RT[18]);
+    Kc = Kc_s[55];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[13]) + (h_RT[5] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28895,12 +27760,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[13];
-    k_f = prefactor_units[56] * fwd_A[56]
-                * exp(fwd_beta[56] * tc[0] - activation_units[56] * fwd_Ea[56] * invT);
+    k_f = k_f_s[56];
     dlnkfdT = fwd_beta[56] * invT + activation_units[56] * fwd_Ea[56] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[5]*sc[18];
-    Kc = refC * exp(-g_RT[0] + g_RT[5] - g_RT[5] + g_RT[13] - g_RT[18]);
+    Kc = Kc_s[56];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[13]) + (h_RT[0] + h_RT[5] + h_RT[18]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28940,12 +27804,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[13];
-    k_f = prefactor_units[57] * fwd_A[57]
-                * exp(fwd_beta[57] * tc[0] - activation_units[57] * fwd_Ea[57] * invT);
+    k_f = k_f_s[57];
     dlnkfdT = fwd_beta[57] * invT + activation_units[57] * fwd_Ea[57] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[18];
-    Kc = exp(-g_RT[3] + g_RT[7] + g_RT[13] - g_RT[18]);
+    Kc = Kc_s[57];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[13]) + (h_RT[3] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28991,12 +27854,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[8];
-    k_f = prefactor_units[58] * fwd_A[58]
-                * exp(fwd_beta[58] * tc[0] - activation_units[58] * fwd_Ea[58] * invT);
+    k_f = k_f_s[58];
     dlnkfdT = fwd_beta[58] * invT + activation_units[58] * fwd_Ea[58] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[18];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[8] - g_RT[18]);
+    Kc = Kc_s[58];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[8]) + (h_RT[0] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29042,12 +27904,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[8];
-    k_f = prefactor_units[59] * fwd_A[59]
-                * exp(fwd_beta[59] * tc[0] - activation_units[59] * fwd_Ea[59] * invT);
+    k_f = k_f_s[59];
     dlnkfdT = fwd_beta[59] * invT + activation_units[59] * fwd_Ea[59] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[13];
-    Kc = exp(-g_RT[0] + g_RT[2] + g_RT[8] - g_RT[13]);
+    Kc = Kc_s[59];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[8]) + (h_RT[0] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29093,12 +27954,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[8];
-    k_f = prefactor_units[60] * fwd_A[60]
-                * exp(fwd_beta[60] * tc[0] - activation_units[60] * fwd_Ea[60] * invT);
+    k_f = k_f_s[60];
     dlnkfdT = fwd_beta[60] * invT + activation_units[60] * fwd_Ea[60] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[9];
-    Kc = exp(-g_RT[0] + g_RT[4] + g_RT[8] - g_RT[9]);
+    Kc = Kc_s[60];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[8]) + (h_RT[0] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29144,12 +28004,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[8];
-    k_f = prefactor_units[61] * fwd_A[61]
-                * exp(fwd_beta[61] * tc[0] - activation_units[61] * fwd_Ea[61] * invT);
+    k_f = k_f_s[61];
     dlnkfdT = fwd_beta[61] * invT + activation_units[61] * fwd_Ea[61] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[14];
-    Kc = exp(-g_RT[0] + g_RT[5] + g_RT[8] - g_RT[14]);
+    Kc = Kc_s[61];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[8]) + (h_RT[0] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29195,12 +28054,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[8];
-    k_f = prefactor_units[62] * fwd_A[62]
-                * exp(fwd_beta[62] * tc[0] - activation_units[62] * fwd_Ea[62] * invT);
+    k_f = k_f_s[62];
     dlnkfdT = fwd_beta[62] * invT + activation_units[62] * fwd_Ea[62] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[13];
-    Kc = exp(-g_RT[1] + g_RT[7] + g_RT[8] - g_RT[13]);
+    Kc = Kc_s[62];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[8]) + (h_RT[1] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29246,12 +28104,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[19];
-    k_f = prefactor_units[63] * fwd_A[63]
-                * exp(fwd_beta[63] * tc[0] - activation_units[63] * fwd_Ea[63] * invT);
+    k_f = k_f_s[63];
     dlnkfdT = fwd_beta[63] * invT + activation_units[63] * fwd_Ea[63] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[18];
-    Kc = exp(g_RT[8] - g_RT[13] - g_RT[18] + g_RT[19]);
+    Kc = Kc_s[63];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[19]) + (h_RT[13] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29297,12 +28154,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[9];
-    k_f = prefactor_units[64] * fwd_A[64]
-                * exp(fwd_beta[64] * tc[0] - activation_units[64] * fwd_Ea[64] * invT);
+    k_f = k_f_s[64];
     dlnkfdT = fwd_beta[64] * invT + activation_units[64] * fwd_Ea[64] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[13];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[9] - g_RT[13]);
+    Kc = Kc_s[64];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[9]) + (h_RT[0] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29348,12 +28204,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[9];
-    k_f = prefactor_units[65] * fwd_A[65]
-                * exp(fwd_beta[65] * tc[0] - activation_units[65] * fwd_Ea[65] * invT);
+    k_f = k_f_s[65];
     dlnkfdT = fwd_beta[65] * invT + activation_units[65] * fwd_Ea[65] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[14];
-    Kc = exp(-g_RT[0] + g_RT[2] + g_RT[9] - g_RT[14]);
+    Kc = Kc_s[65];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[9]) + (h_RT[0] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29399,12 +28254,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[9];
-    k_f = prefactor_units[66] * fwd_A[66]
-                * exp(fwd_beta[66] * tc[0] - activation_units[66] * fwd_Ea[66] * invT);
+    k_f = k_f_s[66];
     dlnkfdT = fwd_beta[66] * invT + activation_units[66] * fwd_Ea[66] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[8];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[8] + g_RT[9]);
+    Kc = Kc_s[66];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[9]) + (h_RT[5] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29450,12 +28304,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[9];
-    k_f = prefactor_units[67] * fwd_A[67]
-                * exp(fwd_beta[67] * tc[0] - activation_units[67] * fwd_Ea[67] * invT);
+    k_f = k_f_s[67];
     dlnkfdT = fwd_beta[67] * invT + activation_units[67] * fwd_Ea[67] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[11];
-    Kc = exp(-g_RT[0] + g_RT[4] + g_RT[9] - g_RT[11]);
+    Kc = Kc_s[67];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[9]) + (h_RT[0] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29501,12 +28354,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[9];
-    k_f = prefactor_units[68] * fwd_A[68]
-                * exp(fwd_beta[68] * tc[0] - activation_units[68] * fwd_Ea[68] * invT);
+    k_f = k_f_s[68];
     dlnkfdT = fwd_beta[68] * invT + activation_units[68] * fwd_Ea[68] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[13];
-    Kc = exp(-g_RT[2] + g_RT[7] + g_RT[9] - g_RT[13]);
+    Kc = Kc_s[68];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[9]) + (h_RT[2] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29552,12 +28404,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[9];
-    k_f = prefactor_units[69] * fwd_A[69]
-                * exp(fwd_beta[69] * tc[0] - activation_units[69] * fwd_Ea[69] * invT);
+    k_f = k_f_s[69];
     dlnkfdT = fwd_beta[69] * invT + activation_units[69] * fwd_Ea[69] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[0]*sc[19];
-    Kc = refC * exp(-2*g_RT[0] + g_RT[7] + g_RT[9] - g_RT[19]);
+    Kc = Kc_s[69];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[9]) + (2*h_RT[0] + h_RT[19]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29603,12 +28454,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[9];
-    k_f = prefactor_units[70] * fwd_A[70]
-                * exp(fwd_beta[70] * tc[0] - activation_units[70] * fwd_Ea[70] * invT);
+    k_f = k_f_s[70];
     dlnkfdT = fwd_beta[70] * invT + activation_units[70] * fwd_Ea[70] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[14];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[9] - g_RT[14]);
+    Kc = Kc_s[70];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[9]) + (h_RT[2] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29654,12 +28504,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[55];
-    k_f = prefactor_units[71] * fwd_A[71]
-                * exp(fwd_beta[71] * tc[0] - activation_units[71] * fwd_Ea[71] * invT);
+    k_f = k_f_s[71];
     dlnkfdT = fwd_beta[71] * invT + activation_units[71] * fwd_Ea[71] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[55];
-    Kc = exp(-g_RT[9] + g_RT[10] + g_RT[55] - g_RT[55]);
+    Kc = Kc_s[71];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[55]) + (h_RT[9] + h_RT[55]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29689,12 +28538,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[10];
-    k_f = prefactor_units[72] * fwd_A[72]
-                * exp(fwd_beta[72] * tc[0] - activation_units[72] * fwd_Ea[72] * invT);
+    k_f = k_f_s[72];
     dlnkfdT = fwd_beta[72] * invT + activation_units[72] * fwd_Ea[72] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[8];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[8] + g_RT[10]);
+    Kc = Kc_s[72];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[10]) + (h_RT[4] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29740,12 +28588,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[10];
-    k_f = prefactor_units[73] * fwd_A[73]
-                * exp(fwd_beta[73] * tc[0] - activation_units[73] * fwd_Ea[73] * invT);
+    k_f = k_f_s[73];
     dlnkfdT = fwd_beta[73] * invT + activation_units[73] * fwd_Ea[73] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[14];
-    Kc = exp(-g_RT[0] + g_RT[2] + g_RT[10] - g_RT[14]);
+    Kc = Kc_s[73];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[10]) + (h_RT[0] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29791,12 +28638,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[10];
-    k_f = prefactor_units[74] * fwd_A[74]
-                * exp(fwd_beta[74] * tc[0] - activation_units[74] * fwd_Ea[74] * invT);
+    k_f = k_f_s[74];
     dlnkfdT = fwd_beta[74] * invT + activation_units[74] * fwd_Ea[74] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[11];
-    Kc = exp(-g_RT[0] + g_RT[4] + g_RT[10] - g_RT[11]);
+    Kc = Kc_s[74];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[10]) + (h_RT[0] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29842,12 +28688,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[10];
-    k_f = prefactor_units[75] * fwd_A[75]
-                * exp(fwd_beta[75] * tc[0] - activation_units[75] * fwd_Ea[75] * invT);
+    k_f = k_f_s[75];
     dlnkfdT = fwd_beta[75] * invT + activation_units[75] * fwd_Ea[75] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[2]*sc[18];
-    Kc = refC * exp(-g_RT[0] - g_RT[2] + g_RT[7] + g_RT[10] - g_RT[18]);
+    Kc = Kc_s[75];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[10]) + (h_RT[0] + h_RT[2] + h_RT[18]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29906,12 +28751,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[10];
-    k_f = prefactor_units[76] * fwd_A[76]
-                * exp(fwd_beta[76] * tc[0] - activation_units[76] * fwd_Ea[76] * invT);
+    k_f = k_f_s[76];
     dlnkfdT = fwd_beta[76] * invT + activation_units[76] * fwd_Ea[76] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[18];
-    Kc = exp(-g_RT[5] + g_RT[7] + g_RT[10] - g_RT[18]);
+    Kc = Kc_s[76];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[10]) + (h_RT[5] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29957,12 +28801,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[10];
-    k_f = prefactor_units[77] * fwd_A[77]
-                * exp(fwd_beta[77] * tc[0] - activation_units[77] * fwd_Ea[77] * invT);
+    k_f = k_f_s[77];
     dlnkfdT = fwd_beta[77] * invT + activation_units[77] * fwd_Ea[77] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[9];
-    Kc = exp(g_RT[5] - g_RT[5] - g_RT[9] + g_RT[10]);
+    Kc = Kc_s[77];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[10]) + (h_RT[5] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29992,12 +28835,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[18];
-    k_f = prefactor_units[78] * fwd_A[78]
-                * exp(fwd_beta[78] * tc[0] - activation_units[78] * fwd_Ea[78] * invT);
+    k_f = k_f_s[78];
     dlnkfdT = fwd_beta[78] * invT + activation_units[78] * fwd_Ea[78] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[18];
-    Kc = exp(-g_RT[9] + g_RT[10] + g_RT[18] - g_RT[18]);
+    Kc = Kc_s[78];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[18]) + (h_RT[9] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30027,12 +28869,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[19];
-    k_f = prefactor_units[79] * fwd_A[79]
-                * exp(fwd_beta[79] * tc[0] - activation_units[79] * fwd_Ea[79] * invT);
+    k_f = k_f_s[79];
     dlnkfdT = fwd_beta[79] * invT + activation_units[79] * fwd_Ea[79] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[19];
-    Kc = exp(-g_RT[9] + g_RT[10] + g_RT[19] - g_RT[19]);
+    Kc = Kc_s[79];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[19]) + (h_RT[9] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30062,12 +28903,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[19];
-    k_f = prefactor_units[80] * fwd_A[80]
-                * exp(fwd_beta[80] * tc[0] - activation_units[80] * fwd_Ea[80] * invT);
+    k_f = k_f_s[80];
     dlnkfdT = fwd_beta[80] * invT + activation_units[80] * fwd_Ea[80] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[18];
-    Kc = exp(g_RT[10] - g_RT[14] - g_RT[18] + g_RT[19]);
+    Kc = Kc_s[80];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[19]) + (h_RT[14] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30113,12 +28953,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[14];
-    k_f = prefactor_units[81] * fwd_A[81]
-                * exp(fwd_beta[81] * tc[0] - activation_units[81] * fwd_Ea[81] * invT);
+    k_f = k_f_s[81];
     dlnkfdT = fwd_beta[81] * invT + activation_units[81] * fwd_Ea[81] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[13];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[13] + g_RT[14]);
+    Kc = Kc_s[81];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[14]) + (h_RT[4] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30164,12 +29003,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[14];
-    k_f = prefactor_units[82] * fwd_A[82]
-                * exp(fwd_beta[82] * tc[0] - activation_units[82] * fwd_Ea[82] * invT);
+    k_f = k_f_s[82];
     dlnkfdT = fwd_beta[82] * invT + activation_units[82] * fwd_Ea[82] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[13];
-    Kc = exp(g_RT[1] - g_RT[2] - g_RT[13] + g_RT[14]);
+    Kc = Kc_s[82];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[14]) + (h_RT[2] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30215,12 +29053,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[14];
-    k_f = prefactor_units[83] * fwd_A[83]
-                * exp(fwd_beta[83] * tc[0] - activation_units[83] * fwd_Ea[83] * invT);
+    k_f = k_f_s[83];
     dlnkfdT = fwd_beta[83] * invT + activation_units[83] * fwd_Ea[83] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[13];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[13] + g_RT[14]);
+    Kc = Kc_s[83];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[14]) + (h_RT[5] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30266,12 +29103,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[14];
-    k_f = prefactor_units[84] * fwd_A[84]
-                * exp(fwd_beta[84] * tc[0] - activation_units[84] * fwd_Ea[84] * invT);
+    k_f = k_f_s[84];
     dlnkfdT = fwd_beta[84] * invT + activation_units[84] * fwd_Ea[84] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[13];
-    Kc = exp(-g_RT[3] + g_RT[7] - g_RT[13] + g_RT[14]);
+    Kc = Kc_s[84];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[14]) + (h_RT[3] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30317,12 +29153,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[14];
-    k_f = prefactor_units[85] * fwd_A[85]
-                * exp(fwd_beta[85] * tc[0] - activation_units[85] * fwd_Ea[85] * invT);
+    k_f = k_f_s[85];
     dlnkfdT = fwd_beta[85] * invT + activation_units[85] * fwd_Ea[85] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[13];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[13] + g_RT[14]);
+    Kc = Kc_s[85];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[14]) + (h_RT[6] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30368,12 +29203,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[14];
-    k_f = prefactor_units[86] * fwd_A[86]
-                * exp(fwd_beta[86] * tc[0] - activation_units[86] * fwd_Ea[86] * invT);
+    k_f = k_f_s[86];
     dlnkfdT = fwd_beta[86] * invT + activation_units[86] * fwd_Ea[86] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[27];
-    Kc = exp(-g_RT[0] + g_RT[8] + g_RT[14] - g_RT[27]);
+    Kc = Kc_s[86];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[14]) + (h_RT[0] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30419,12 +29253,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[11];
-    k_f = prefactor_units[87] * fwd_A[87]
-                * exp(fwd_beta[87] * tc[0] - activation_units[87] * fwd_Ea[87] * invT);
+    k_f = k_f_s[87];
     dlnkfdT = fwd_beta[87] * invT + activation_units[87] * fwd_Ea[87] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[14];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[11] - g_RT[14]);
+    Kc = Kc_s[87];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[11]) + (h_RT[0] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30470,12 +29303,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[11];
-    k_f = prefactor_units[88] * fwd_A[88]
-                * exp(fwd_beta[88] * tc[0] - activation_units[88] * fwd_Ea[88] * invT);
+    k_f = k_f_s[88];
     dlnkfdT = fwd_beta[88] * invT + activation_units[88] * fwd_Ea[88] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[9];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[9] + g_RT[11]);
+    Kc = Kc_s[88];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[11]) + (h_RT[5] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30521,12 +29353,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[11];
-    k_f = prefactor_units[89] * fwd_A[89]
-                * exp(fwd_beta[89] * tc[0] - activation_units[89] * fwd_Ea[89] * invT);
+    k_f = k_f_s[89];
     dlnkfdT = fwd_beta[89] * invT + activation_units[89] * fwd_Ea[89] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[10];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[10] + g_RT[11]);
+    Kc = Kc_s[89];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[11]) + (h_RT[5] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30572,12 +29403,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[11];
-    k_f = prefactor_units[90] * fwd_A[90]
-                * exp(fwd_beta[90] * tc[0] - activation_units[90] * fwd_Ea[90] * invT);
+    k_f = k_f_s[90];
     dlnkfdT = fwd_beta[90] * invT + activation_units[90] * fwd_Ea[90] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[15];
-    Kc = exp(-g_RT[1] + g_RT[7] + g_RT[11] - g_RT[15]);
+    Kc = Kc_s[90];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[11]) + (h_RT[1] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30623,12 +29453,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[11];
-    k_f = prefactor_units[91] * fwd_A[91]
-                * exp(fwd_beta[91] * tc[0] - activation_units[91] * fwd_Ea[91] * invT);
+    k_f = k_f_s[91];
     dlnkfdT = fwd_beta[91] * invT + activation_units[91] * fwd_Ea[91] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[14];
-    Kc = exp(-g_RT[2] + g_RT[7] + g_RT[11] - g_RT[14]);
+    Kc = Kc_s[91];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[11]) + (h_RT[2] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30674,12 +29503,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[11];
-    k_f = prefactor_units[92] * fwd_A[92]
-                * exp(fwd_beta[92] * tc[0] - activation_units[92] * fwd_Ea[92] * invT);
+    k_f = k_f_s[92];
     dlnkfdT = fwd_beta[92] * invT + activation_units[92] * fwd_Ea[92] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[12];
-    Kc = exp(g_RT[3] - g_RT[7] + g_RT[11] - g_RT[12]);
+    Kc = Kc_s[92];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[11]) + (h_RT[7] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30725,12 +29553,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[11];
-    k_f = prefactor_units[93] * fwd_A[93]
-                * exp(fwd_beta[93] * tc[0] - activation_units[93] * fwd_Ea[93] * invT);
+    k_f = k_f_s[93];
     dlnkfdT = fwd_beta[93] * invT + activation_units[93] * fwd_Ea[93] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[15];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[11] - g_RT[15]);
+    Kc = Kc_s[93];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[11]) + (h_RT[2] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30776,12 +29603,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[11];
-    k_f = prefactor_units[94] * fwd_A[94]
-                * exp(fwd_beta[94] * tc[0] - activation_units[94] * fwd_Ea[94] * invT);
+    k_f = k_f_s[94];
     dlnkfdT = fwd_beta[94] * invT + activation_units[94] * fwd_Ea[94] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[22];
-    Kc = exp(-g_RT[0] + g_RT[8] + g_RT[11] - g_RT[22]);
+    Kc = Kc_s[94];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[11]) + (h_RT[0] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30827,12 +29653,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[13];
-    k_f = prefactor_units[95] * fwd_A[95]
-                * exp(fwd_beta[95] * tc[0] - activation_units[95] * fwd_Ea[95] * invT);
+    k_f = k_f_s[95];
     dlnkfdT = fwd_beta[95] * invT + activation_units[95] * fwd_Ea[95] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[18];
-    Kc = exp(g_RT[11] - g_RT[12] + g_RT[13] - g_RT[18]);
+    Kc = Kc_s[95];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[13]) + (h_RT[12] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30878,12 +29703,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[14];
-    k_f = prefactor_units[96] * fwd_A[96]
-                * exp(fwd_beta[96] * tc[0] - activation_units[96] * fwd_Ea[96] * invT);
+    k_f = k_f_s[96];
     dlnkfdT = fwd_beta[96] * invT + activation_units[96] * fwd_Ea[96] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[13];
-    Kc = exp(g_RT[11] - g_RT[12] - g_RT[13] + g_RT[14]);
+    Kc = Kc_s[96];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[14]) + (h_RT[12] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30929,12 +29753,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[11];
-    k_f = prefactor_units[97] * fwd_A[97]
-                * exp(fwd_beta[97] * tc[0] - activation_units[97] * fwd_Ea[97] * invT);
+    k_f = k_f_s[97];
     dlnkfdT = fwd_beta[97] * invT + activation_units[97] * fwd_Ea[97] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[23];
-    Kc = exp(-g_RT[0] + g_RT[9] + g_RT[11] - g_RT[23]);
+    Kc = Kc_s[97];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[11]) + (h_RT[0] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30980,12 +29803,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[11];
-    k_f = prefactor_units[98] * fwd_A[98]
-                * exp(fwd_beta[98] * tc[0] - activation_units[98] * fwd_Ea[98] * invT);
+    k_f = k_f_s[98];
     dlnkfdT = fwd_beta[98] * invT + activation_units[98] * fwd_Ea[98] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[24];
-    Kc = exp(-g_RT[0] + 2*g_RT[11] - g_RT[24]);
+    Kc = Kc_s[98];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[11]) + (h_RT[0] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31020,12 +29842,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[26];
-    k_f = prefactor_units[99] * fwd_A[99]
-                * exp(fwd_beta[99] * tc[0] - activation_units[99] * fwd_Ea[99] * invT);
+    k_f = k_f_s[99];
     dlnkfdT = fwd_beta[99] * invT + activation_units[99] * fwd_Ea[99] * invT2;
     /* reverse */
     phi_r = sc[18]*sc[23];
-    Kc = exp(g_RT[11] - g_RT[18] - g_RT[23] + g_RT[26]);
+    Kc = Kc_s[99];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[26]) + (h_RT[18] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31071,12 +29892,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[15];
-    k_f = prefactor_units[100] * fwd_A[100]
-                * exp(fwd_beta[100] * tc[0] - activation_units[100] * fwd_Ea[100] * invT);
+    k_f = k_f_s[100];
     dlnkfdT = fwd_beta[100] * invT + activation_units[100] * fwd_Ea[100] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[14];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[14] + g_RT[15]);
+    Kc = Kc_s[100];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[15]) + (h_RT[4] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31122,12 +29942,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[15];
-    k_f = prefactor_units[101] * fwd_A[101]
-                * exp(fwd_beta[101] * tc[0] - activation_units[101] * fwd_Ea[101] * invT);
+    k_f = k_f_s[101];
     dlnkfdT = fwd_beta[101] * invT + activation_units[101] * fwd_Ea[101] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[11];
-    Kc = exp(g_RT[0] - g_RT[2] - g_RT[11] + g_RT[15]);
+    Kc = Kc_s[101];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[15]) + (h_RT[2] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31173,12 +29992,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[15];
-    k_f = prefactor_units[102] * fwd_A[102]
-                * exp(fwd_beta[102] * tc[0] - activation_units[102] * fwd_Ea[102] * invT);
+    k_f = k_f_s[102];
     dlnkfdT = fwd_beta[102] * invT + activation_units[102] * fwd_Ea[102] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[10];
-    Kc = exp(g_RT[0] - g_RT[5] - g_RT[10] + g_RT[15]);
+    Kc = Kc_s[102];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[15]) + (h_RT[5] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31224,12 +30042,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[15];
-    k_f = prefactor_units[103] * fwd_A[103]
-                * exp(fwd_beta[103] * tc[0] - activation_units[103] * fwd_Ea[103] * invT);
+    k_f = k_f_s[103];
     dlnkfdT = fwd_beta[103] * invT + activation_units[103] * fwd_Ea[103] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[14];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[14] + g_RT[15]);
+    Kc = Kc_s[103];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[15]) + (h_RT[5] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31275,12 +30092,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[15];
-    k_f = prefactor_units[104] * fwd_A[104]
-                * exp(fwd_beta[104] * tc[0] - activation_units[104] * fwd_Ea[104] * invT);
+    k_f = k_f_s[104];
     dlnkfdT = fwd_beta[104] * invT + activation_units[104] * fwd_Ea[104] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[14];
-    Kc = exp(-g_RT[3] + g_RT[7] - g_RT[14] + g_RT[15]);
+    Kc = Kc_s[104];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[15]) + (h_RT[3] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31326,12 +30142,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[16];
-    k_f = prefactor_units[105] * fwd_A[105]
-                * exp(fwd_beta[105] * tc[0] - activation_units[105] * fwd_Ea[105] * invT);
+    k_f = k_f_s[105];
     dlnkfdT = fwd_beta[105] * invT + activation_units[105] * fwd_Ea[105] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[14];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[105];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[16]) + (h_RT[4] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31377,12 +30192,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[16];
-    k_f = prefactor_units[106] * fwd_A[106]
-                * exp(fwd_beta[106] * tc[0] - activation_units[106] * fwd_Ea[106] * invT);
+    k_f = k_f_s[106];
     dlnkfdT = fwd_beta[106] * invT + activation_units[106] * fwd_Ea[106] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[11];
-    Kc = exp(g_RT[0] - g_RT[2] - g_RT[11] + g_RT[16]);
+    Kc = Kc_s[106];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[16]) + (h_RT[2] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31428,12 +30242,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[16];
-    k_f = prefactor_units[107] * fwd_A[107]
-                * exp(fwd_beta[107] * tc[0] - activation_units[107] * fwd_Ea[107] * invT);
+    k_f = k_f_s[107];
     dlnkfdT = fwd_beta[107] * invT + activation_units[107] * fwd_Ea[107] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[10];
-    Kc = exp(g_RT[0] - g_RT[5] - g_RT[10] + g_RT[16]);
+    Kc = Kc_s[107];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[16]) + (h_RT[5] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31479,12 +30292,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[16];
-    k_f = prefactor_units[108] * fwd_A[108]
-                * exp(fwd_beta[108] * tc[0] - activation_units[108] * fwd_Ea[108] * invT);
+    k_f = k_f_s[108];
     dlnkfdT = fwd_beta[108] * invT + activation_units[108] * fwd_Ea[108] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[14];
-    Kc = exp(-g_RT[3] + g_RT[7] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[108];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[16]) + (h_RT[3] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31530,12 +30342,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[12];
-    k_f = prefactor_units[109] * fwd_A[109]
-                * exp(fwd_beta[109] * tc[0] - activation_units[109] * fwd_Ea[109] * invT);
+    k_f = k_f_s[109];
     dlnkfdT = fwd_beta[109] * invT + activation_units[109] * fwd_Ea[109] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[11];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[11] + g_RT[12]);
+    Kc = Kc_s[109];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[12]) + (h_RT[4] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31581,12 +30392,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[12];
-    k_f = prefactor_units[110] * fwd_A[110]
-                * exp(fwd_beta[110] * tc[0] - activation_units[110] * fwd_Ea[110] * invT);
+    k_f = k_f_s[110];
     dlnkfdT = fwd_beta[110] * invT + activation_units[110] * fwd_Ea[110] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[11];
-    Kc = exp(g_RT[1] - g_RT[2] - g_RT[11] + g_RT[12]);
+    Kc = Kc_s[110];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[12]) + (h_RT[2] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31632,12 +30442,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[12];
-    k_f = prefactor_units[111] * fwd_A[111]
-                * exp(fwd_beta[111] * tc[0] - activation_units[111] * fwd_Ea[111] * invT);
+    k_f = k_f_s[111];
     dlnkfdT = fwd_beta[111] * invT + activation_units[111] * fwd_Ea[111] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[11];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[11] + g_RT[12]);
+    Kc = Kc_s[111];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[12]) + (h_RT[5] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31683,12 +30492,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[12];
-    k_f = prefactor_units[112] * fwd_A[112]
-                * exp(fwd_beta[112] * tc[0] - activation_units[112] * fwd_Ea[112] * invT);
+    k_f = k_f_s[112];
     dlnkfdT = fwd_beta[112] * invT + activation_units[112] * fwd_Ea[112] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[23];
-    Kc = exp(-g_RT[0] + g_RT[8] + g_RT[12] - g_RT[23]);
+    Kc = Kc_s[112];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[12]) + (h_RT[0] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31734,12 +30542,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[12];
-    k_f = prefactor_units[113] * fwd_A[113]
-                * exp(fwd_beta[113] * tc[0] - activation_units[113] * fwd_Ea[113] * invT);
+    k_f = k_f_s[113];
     dlnkfdT = fwd_beta[113] * invT + activation_units[113] * fwd_Ea[113] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[11];
-    Kc = exp(g_RT[9] - 2*g_RT[11] + g_RT[12]);
+    Kc = Kc_s[113];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[12]) + (2*h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31774,12 +30581,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[12];
-    k_f = prefactor_units[114] * fwd_A[114]
-                * exp(fwd_beta[114] * tc[0] - activation_units[114] * fwd_Ea[114] * invT);
+    k_f = k_f_s[114];
     dlnkfdT = fwd_beta[114] * invT + activation_units[114] * fwd_Ea[114] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[11];
-    Kc = exp(g_RT[10] - 2*g_RT[11] + g_RT[12]);
+    Kc = Kc_s[114];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[12]) + (2*h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31814,12 +30620,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[17];
-    k_f = prefactor_units[115] * fwd_A[115]
-                * exp(fwd_beta[115] * tc[0] - activation_units[115] * fwd_Ea[115] * invT);
+    k_f = k_f_s[115];
     dlnkfdT = fwd_beta[115] * invT + activation_units[115] * fwd_Ea[115] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[16];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[115];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[17]) + (h_RT[4] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31865,12 +30670,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[17];
-    k_f = prefactor_units[116] * fwd_A[116]
-                * exp(fwd_beta[116] * tc[0] - activation_units[116] * fwd_Ea[116] * invT);
+    k_f = k_f_s[116];
     dlnkfdT = fwd_beta[116] * invT + activation_units[116] * fwd_Ea[116] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[15];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[15] + g_RT[17]);
+    Kc = Kc_s[116];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[17]) + (h_RT[4] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31916,12 +30720,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[17];
-    k_f = prefactor_units[117] * fwd_A[117]
-                * exp(fwd_beta[117] * tc[0] - activation_units[117] * fwd_Ea[117] * invT);
+    k_f = k_f_s[117];
     dlnkfdT = fwd_beta[117] * invT + activation_units[117] * fwd_Ea[117] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[16];
-    Kc = exp(g_RT[1] - g_RT[2] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[117];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[17]) + (h_RT[2] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31967,12 +30770,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[17];
-    k_f = prefactor_units[118] * fwd_A[118]
-                * exp(fwd_beta[118] * tc[0] - activation_units[118] * fwd_Ea[118] * invT);
+    k_f = k_f_s[118];
     dlnkfdT = fwd_beta[118] * invT + activation_units[118] * fwd_Ea[118] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[16];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[118];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[17]) + (h_RT[5] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32018,12 +30820,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[17];
-    k_f = prefactor_units[119] * fwd_A[119]
-                * exp(fwd_beta[119] * tc[0] - activation_units[119] * fwd_Ea[119] * invT);
+    k_f = k_f_s[119];
     dlnkfdT = fwd_beta[119] * invT + activation_units[119] * fwd_Ea[119] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[15];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[15] + g_RT[17]);
+    Kc = Kc_s[119];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[17]) + (h_RT[5] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32069,12 +30870,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[20];
-    k_f = prefactor_units[120] * fwd_A[120]
-                * exp(fwd_beta[120] * tc[0] - activation_units[120] * fwd_Ea[120] * invT);
+    k_f = k_f_s[120];
     dlnkfdT = fwd_beta[120] * invT + activation_units[120] * fwd_Ea[120] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[18];
-    Kc = exp(g_RT[1] - g_RT[8] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[120];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[20]) + (h_RT[8] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32120,12 +30920,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[20];
-    k_f = prefactor_units[121] * fwd_A[121]
-                * exp(fwd_beta[121] * tc[0] - activation_units[121] * fwd_Ea[121] * invT);
+    k_f = k_f_s[121];
     dlnkfdT = fwd_beta[121] * invT + activation_units[121] * fwd_Ea[121] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[26];
-    Kc = exp(-g_RT[0] + g_RT[2] + g_RT[20] - g_RT[26]);
+    Kc = Kc_s[121];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[20]) + (h_RT[0] + h_RT[26]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32171,12 +30970,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[20];
-    k_f = prefactor_units[122] * fwd_A[122]
-                * exp(fwd_beta[122] * tc[0] - activation_units[122] * fwd_Ea[122] * invT);
+    k_f = k_f_s[122];
     dlnkfdT = fwd_beta[122] * invT + activation_units[122] * fwd_Ea[122] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[18];
-    Kc = exp(g_RT[7] - g_RT[13] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[122];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[20]) + (h_RT[13] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32222,12 +31020,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[20];
-    k_f = prefactor_units[123] * fwd_A[123]
-                * exp(fwd_beta[123] * tc[0] - activation_units[123] * fwd_Ea[123] * invT);
+    k_f = k_f_s[123];
     dlnkfdT = fwd_beta[123] * invT + activation_units[123] * fwd_Ea[123] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[21];
-    Kc = exp(-g_RT[0] + g_RT[4] + g_RT[20] - g_RT[21]);
+    Kc = Kc_s[123];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[20]) + (h_RT[0] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32273,12 +31070,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[26];
-    k_f = prefactor_units[124] * fwd_A[124]
-                * exp(fwd_beta[124] * tc[0] - activation_units[124] * fwd_Ea[124] * invT);
+    k_f = k_f_s[124];
     dlnkfdT = fwd_beta[124] * invT + activation_units[124] * fwd_Ea[124] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[18];
-    Kc = exp(g_RT[0] - g_RT[10] - g_RT[18] + g_RT[26]);
+    Kc = Kc_s[124];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[26]) + (h_RT[10] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32324,12 +31120,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[26];
-    k_f = prefactor_units[125] * fwd_A[125]
-                * exp(fwd_beta[125] * tc[0] - activation_units[125] * fwd_Ea[125] * invT);
+    k_f = k_f_s[125];
     dlnkfdT = fwd_beta[125] * invT + activation_units[125] * fwd_Ea[125] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[18]*sc[18];
-    Kc = refC * exp(-g_RT[0] + g_RT[1] - 2*g_RT[18] + g_RT[26]);
+    Kc = Kc_s[125];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[26]) + (h_RT[0] + 2*h_RT[18]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32375,12 +31170,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[26];
-    k_f = prefactor_units[126] * fwd_A[126]
-                * exp(fwd_beta[126] * tc[0] - activation_units[126] * fwd_Ea[126] * invT);
+    k_f = k_f_s[126];
     dlnkfdT = fwd_beta[126] * invT + activation_units[126] * fwd_Ea[126] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[18]*sc[18];
-    Kc = refC * exp(-g_RT[2] + g_RT[7] - 2*g_RT[18] + g_RT[26]);
+    Kc = Kc_s[126];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[26]) + (h_RT[2] + 2*h_RT[18]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32426,12 +31220,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[21];
-    k_f = prefactor_units[127] * fwd_A[127]
-                * exp(fwd_beta[127] * tc[0] - activation_units[127] * fwd_Ea[127] * invT);
+    k_f = k_f_s[127];
     dlnkfdT = fwd_beta[127] * invT + activation_units[127] * fwd_Ea[127] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[20];
-    Kc = exp(g_RT[1] - g_RT[2] - g_RT[20] + g_RT[21]);
+    Kc = Kc_s[127];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[21]) + (h_RT[2] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32477,12 +31270,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[21];
-    k_f = prefactor_units[128] * fwd_A[128]
-                * exp(fwd_beta[128] * tc[0] - activation_units[128] * fwd_Ea[128] * invT);
+    k_f = k_f_s[128];
     dlnkfdT = fwd_beta[128] * invT + activation_units[128] * fwd_Ea[128] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[18];
-    Kc = exp(g_RT[1] - g_RT[9] - g_RT[18] + g_RT[21]);
+    Kc = Kc_s[128];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[21]) + (h_RT[9] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32528,12 +31320,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[21];
-    k_f = prefactor_units[129] * fwd_A[129]
-                * exp(fwd_beta[129] * tc[0] - activation_units[129] * fwd_Ea[129] * invT);
+    k_f = k_f_s[129];
     dlnkfdT = fwd_beta[129] * invT + activation_units[129] * fwd_Ea[129] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[26];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[21] - g_RT[26]);
+    Kc = Kc_s[129];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[21]) + (h_RT[0] + h_RT[26]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32579,12 +31370,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[21];
-    k_f = prefactor_units[130] * fwd_A[130]
-                * exp(fwd_beta[130] * tc[0] - activation_units[130] * fwd_Ea[130] * invT);
+    k_f = k_f_s[130];
     dlnkfdT = fwd_beta[130] * invT + activation_units[130] * fwd_Ea[130] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[27];
-    Kc = exp(-g_RT[0] + g_RT[2] + g_RT[21] - g_RT[27]);
+    Kc = Kc_s[130];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[21]) + (h_RT[0] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32630,12 +31420,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[21];
-    k_f = prefactor_units[131] * fwd_A[131]
-                * exp(fwd_beta[131] * tc[0] - activation_units[131] * fwd_Ea[131] * invT);
+    k_f = k_f_s[131];
     dlnkfdT = fwd_beta[131] * invT + activation_units[131] * fwd_Ea[131] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[27];
-    Kc = exp(-g_RT[0] + g_RT[2] + g_RT[21] - g_RT[27]);
+    Kc = Kc_s[131];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[21]) + (h_RT[0] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32681,12 +31470,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[21];
-    k_f = prefactor_units[132] * fwd_A[132]
-                * exp(fwd_beta[132] * tc[0] - activation_units[132] * fwd_Ea[132] * invT);
+    k_f = k_f_s[132];
     dlnkfdT = fwd_beta[132] * invT + activation_units[132] * fwd_Ea[132] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[20];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[20] + g_RT[21]);
+    Kc = Kc_s[132];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[21]) + (h_RT[5] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32732,12 +31520,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[21];
-    k_f = prefactor_units[133] * fwd_A[133]
-                * exp(fwd_beta[133] * tc[0] - activation_units[133] * fwd_Ea[133] * invT);
+    k_f = k_f_s[133];
     dlnkfdT = fwd_beta[133] * invT + activation_units[133] * fwd_Ea[133] * invT2;
     /* reverse */
     phi_r = sc[18]*sc[22];
-    Kc = exp(g_RT[13] - g_RT[18] + g_RT[21] - g_RT[22]);
+    Kc = Kc_s[133];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13] + h_RT[21]) + (h_RT[18] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32783,12 +31570,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[21];
-    k_f = prefactor_units[134] * fwd_A[134]
-                * exp(fwd_beta[134] * tc[0] - activation_units[134] * fwd_Ea[134] * invT);
+    k_f = k_f_s[134];
     dlnkfdT = fwd_beta[134] * invT + activation_units[134] * fwd_Ea[134] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[31];
-    Kc = exp(-g_RT[0] + g_RT[9] + g_RT[21] - g_RT[31]);
+    Kc = Kc_s[134];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[21]) + (h_RT[0] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32834,12 +31620,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[21];
-    k_f = prefactor_units[135] * fwd_A[135]
-                * exp(fwd_beta[135] * tc[0] - activation_units[135] * fwd_Ea[135] * invT);
+    k_f = k_f_s[135];
     dlnkfdT = fwd_beta[135] * invT + activation_units[135] * fwd_Ea[135] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[31];
-    Kc = exp(-g_RT[0] + g_RT[10] + g_RT[21] - g_RT[31]);
+    Kc = Kc_s[135];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[21]) + (h_RT[0] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32885,12 +31670,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[20]*sc[21];
-    k_f = prefactor_units[136] * fwd_A[136]
-                * exp(fwd_beta[136] * tc[0] - activation_units[136] * fwd_Ea[136] * invT);
+    k_f = k_f_s[136];
     dlnkfdT = fwd_beta[136] * invT + activation_units[136] * fwd_Ea[136] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[40];
-    Kc = exp(-g_RT[0] + g_RT[20] + g_RT[21] - g_RT[40]);
+    Kc = Kc_s[136];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[20] + h_RT[21]) + (h_RT[0] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32936,12 +31720,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[21];
-    k_f = prefactor_units[137] * fwd_A[137]
-                * exp(fwd_beta[137] * tc[0] - activation_units[137] * fwd_Ea[137] * invT);
+    k_f = k_f_s[137];
     dlnkfdT = fwd_beta[137] * invT + activation_units[137] * fwd_Ea[137] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[32];
-    Kc = exp(-g_RT[0] + g_RT[11] + g_RT[21] - g_RT[32]);
+    Kc = Kc_s[137];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[21]) + (h_RT[0] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32987,12 +31770,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[21];
-    k_f = prefactor_units[138] * fwd_A[138]
-                * exp(fwd_beta[138] * tc[0] - activation_units[138] * fwd_Ea[138] * invT);
+    k_f = k_f_s[138];
     dlnkfdT = fwd_beta[138] * invT + activation_units[138] * fwd_Ea[138] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[33];
-    Kc = exp(-g_RT[0] + g_RT[11] + g_RT[21] - g_RT[33]);
+    Kc = Kc_s[138];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[21]) + (h_RT[0] + h_RT[33]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33038,12 +31820,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[27];
-    k_f = prefactor_units[139] * fwd_A[139]
-                * exp(fwd_beta[139] * tc[0] - activation_units[139] * fwd_Ea[139] * invT);
+    k_f = k_f_s[139];
     dlnkfdT = fwd_beta[139] * invT + activation_units[139] * fwd_Ea[139] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[26];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[26] + g_RT[27]);
+    Kc = Kc_s[139];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[27]) + (h_RT[4] + h_RT[26]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33089,12 +31870,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[27];
-    k_f = prefactor_units[140] * fwd_A[140]
-                * exp(fwd_beta[140] * tc[0] - activation_units[140] * fwd_Ea[140] * invT);
+    k_f = k_f_s[140];
     dlnkfdT = fwd_beta[140] * invT + activation_units[140] * fwd_Ea[140] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[18];
-    Kc = exp(g_RT[0] - g_RT[11] - g_RT[18] + g_RT[27]);
+    Kc = Kc_s[140];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[27]) + (h_RT[11] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33140,12 +31920,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[27];
-    k_f = prefactor_units[141] * fwd_A[141]
-                * exp(fwd_beta[141] * tc[0] - activation_units[141] * fwd_Ea[141] * invT);
+    k_f = k_f_s[141];
     dlnkfdT = fwd_beta[141] * invT + activation_units[141] * fwd_Ea[141] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[26];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[26] + g_RT[27]);
+    Kc = Kc_s[141];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[27]) + (h_RT[5] + h_RT[26]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33191,12 +31970,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[22];
-    k_f = prefactor_units[142] * fwd_A[142]
-                * exp(fwd_beta[142] * tc[0] - activation_units[142] * fwd_Ea[142] * invT);
+    k_f = k_f_s[142];
     dlnkfdT = fwd_beta[142] * invT + activation_units[142] * fwd_Ea[142] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[21];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[142];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[22]) + (h_RT[4] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33242,12 +32020,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[22];
-    k_f = prefactor_units[143] * fwd_A[143]
-                * exp(fwd_beta[143] * tc[0] - activation_units[143] * fwd_Ea[143] * invT);
+    k_f = k_f_s[143];
     dlnkfdT = fwd_beta[143] * invT + activation_units[143] * fwd_Ea[143] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[27];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[22] - g_RT[27]);
+    Kc = Kc_s[143];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[22]) + (h_RT[0] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33293,12 +32070,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[22];
-    k_f = prefactor_units[144] * fwd_A[144]
-                * exp(fwd_beta[144] * tc[0] - activation_units[144] * fwd_Ea[144] * invT);
+    k_f = k_f_s[144];
     dlnkfdT = fwd_beta[144] * invT + activation_units[144] * fwd_Ea[144] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[18];
-    Kc = exp(g_RT[1] - g_RT[11] - g_RT[18] + g_RT[22]);
+    Kc = Kc_s[144];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[22]) + (h_RT[11] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33344,12 +32120,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[22];
-    k_f = prefactor_units[145] * fwd_A[145]
-                * exp(fwd_beta[145] * tc[0] - activation_units[145] * fwd_Ea[145] * invT);
+    k_f = k_f_s[145];
     dlnkfdT = fwd_beta[145] * invT + activation_units[145] * fwd_Ea[145] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[21];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[145];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[22]) + (h_RT[5] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33395,12 +32170,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[22];
-    k_f = prefactor_units[146] * fwd_A[146]
-                * exp(fwd_beta[146] * tc[0] - activation_units[146] * fwd_Ea[146] * invT);
+    k_f = k_f_s[146];
     dlnkfdT = fwd_beta[146] * invT + activation_units[146] * fwd_Ea[146] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[21];
-    Kc = exp(-g_RT[3] + g_RT[7] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[146];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[22]) + (h_RT[3] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33446,12 +32220,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[22];
-    k_f = prefactor_units[147] * fwd_A[147]
-                * exp(fwd_beta[147] * tc[0] - activation_units[147] * fwd_Ea[147] * invT);
+    k_f = k_f_s[147];
     dlnkfdT = fwd_beta[147] * invT + activation_units[147] * fwd_Ea[147] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[29];
-    Kc = exp(-g_RT[1] + g_RT[7] + g_RT[22] - g_RT[29]);
+    Kc = Kc_s[147];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[22]) + (h_RT[1] + h_RT[29]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33497,12 +32270,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[22];
-    k_f = prefactor_units[148] * fwd_A[148]
-                * exp(fwd_beta[148] * tc[0] - activation_units[148] * fwd_Ea[148] * invT);
+    k_f = k_f_s[148];
     dlnkfdT = fwd_beta[148] * invT + activation_units[148] * fwd_Ea[148] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[14];
-    Kc = exp(g_RT[7] - g_RT[13] - g_RT[14] + g_RT[22]);
+    Kc = Kc_s[148];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[22]) + (h_RT[13] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33548,12 +32320,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[22];
-    k_f = prefactor_units[149] * fwd_A[149]
-                * exp(fwd_beta[149] * tc[0] - activation_units[149] * fwd_Ea[149] * invT);
+    k_f = k_f_s[149];
     dlnkfdT = fwd_beta[149] * invT + activation_units[149] * fwd_Ea[149] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[29];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[22] - g_RT[29]);
+    Kc = Kc_s[149];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[22]) + (h_RT[2] + h_RT[29]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33599,12 +32370,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[22];
-    k_f = prefactor_units[150] * fwd_A[150]
-                * exp(fwd_beta[150] * tc[0] - activation_units[150] * fwd_Ea[150] * invT);
+    k_f = k_f_s[150];
     dlnkfdT = fwd_beta[150] * invT + activation_units[150] * fwd_Ea[150] * invT2;
     /* reverse */
     phi_r = sc[18]*sc[23];
-    Kc = exp(g_RT[13] - g_RT[18] + g_RT[22] - g_RT[23]);
+    Kc = Kc_s[150];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13] + h_RT[22]) + (h_RT[18] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33650,12 +32420,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[22];
-    k_f = prefactor_units[151] * fwd_A[151]
-                * exp(fwd_beta[151] * tc[0] - activation_units[151] * fwd_Ea[151] * invT);
+    k_f = k_f_s[151];
     dlnkfdT = fwd_beta[151] * invT + activation_units[151] * fwd_Ea[151] * invT2;
     /* reverse */
     phi_r = sc[39];
-    Kc = refCinv * exp(g_RT[13] + g_RT[22] - g_RT[39]);
+    Kc = Kc_s[151];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13] + h_RT[22]) + (h_RT[39]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33690,12 +32459,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[22];
-    k_f = prefactor_units[152] * fwd_A[152]
-                * exp(fwd_beta[152] * tc[0] - activation_units[152] * fwd_Ea[152] * invT);
+    k_f = k_f_s[152];
     dlnkfdT = fwd_beta[152] * invT + activation_units[152] * fwd_Ea[152] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[34];
-    Kc = exp(-g_RT[0] + g_RT[11] + g_RT[22] - g_RT[34]);
+    Kc = Kc_s[152];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[22]) + (h_RT[0] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33741,12 +32509,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[29];
-    k_f = prefactor_units[153] * fwd_A[153]
-                * exp(fwd_beta[153] * tc[0] - activation_units[153] * fwd_Ea[153] * invT);
+    k_f = k_f_s[153];
     dlnkfdT = fwd_beta[153] * invT + activation_units[153] * fwd_Ea[153] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[18];
-    Kc = refC * exp(-g_RT[11] - g_RT[18] + g_RT[29]);
+    Kc = Kc_s[153];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[29]) + (h_RT[11] + h_RT[18]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33781,12 +32548,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[29];
-    k_f = prefactor_units[154] * fwd_A[154]
-                * exp(fwd_beta[154] * tc[0] - activation_units[154] * fwd_Ea[154] * invT);
+    k_f = k_f_s[154];
     dlnkfdT = fwd_beta[154] * invT + activation_units[154] * fwd_Ea[154] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[28];
-    Kc = exp(g_RT[0] - g_RT[0] - g_RT[28] + g_RT[29]);
+    Kc = Kc_s[154];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[29]) + (h_RT[0] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33816,12 +32582,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[29];
-    k_f = prefactor_units[155] * fwd_A[155]
-                * exp(fwd_beta[155] * tc[0] - activation_units[155] * fwd_Ea[155] * invT);
+    k_f = k_f_s[155];
     dlnkfdT = fwd_beta[155] * invT + activation_units[155] * fwd_Ea[155] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[13];
-    Kc = exp(g_RT[0] - g_RT[11] - g_RT[13] + g_RT[29]);
+    Kc = Kc_s[155];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[29]) + (h_RT[11] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33867,12 +32632,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[29];
-    k_f = prefactor_units[156] * fwd_A[156]
-                * exp(fwd_beta[156] * tc[0] - activation_units[156] * fwd_Ea[156] * invT);
+    k_f = k_f_s[156];
     dlnkfdT = fwd_beta[156] * invT + activation_units[156] * fwd_Ea[156] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[27];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[27] + g_RT[29]);
+    Kc = Kc_s[156];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[29]) + (h_RT[4] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33918,12 +32682,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[29];
-    k_f = prefactor_units[157] * fwd_A[157]
-                * exp(fwd_beta[157] * tc[0] - activation_units[157] * fwd_Ea[157] * invT);
+    k_f = k_f_s[157];
     dlnkfdT = fwd_beta[157] * invT + activation_units[157] * fwd_Ea[157] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[27];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[27] + g_RT[29]);
+    Kc = Kc_s[157];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[29]) + (h_RT[5] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33969,12 +32732,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[29];
-    k_f = prefactor_units[158] * fwd_A[158]
-                * exp(fwd_beta[158] * tc[0] - activation_units[158] * fwd_Ea[158] * invT);
+    k_f = k_f_s[158];
     dlnkfdT = fwd_beta[158] * invT + activation_units[158] * fwd_Ea[158] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[27];
-    Kc = exp(-g_RT[3] + g_RT[7] - g_RT[27] + g_RT[29]);
+    Kc = Kc_s[158];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[29]) + (h_RT[3] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34020,12 +32782,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[29];
-    k_f = prefactor_units[159] * fwd_A[159]
-                * exp(fwd_beta[159] * tc[0] - activation_units[159] * fwd_Ea[159] * invT);
+    k_f = k_f_s[159];
     dlnkfdT = fwd_beta[159] * invT + activation_units[159] * fwd_Ea[159] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[14]*sc[18];
-    Kc = refC * exp(-g_RT[2] + g_RT[7] - g_RT[14] - g_RT[18] + g_RT[29]);
+    Kc = Kc_s[159];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[29]) + (h_RT[2] + h_RT[14] + h_RT[18]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34084,12 +32845,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[28];
-    k_f = prefactor_units[160] * fwd_A[160]
-                * exp(fwd_beta[160] * tc[0] - activation_units[160] * fwd_Ea[160] * invT);
+    k_f = k_f_s[160];
     dlnkfdT = fwd_beta[160] * invT + activation_units[160] * fwd_Ea[160] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[13];
-    Kc = exp(g_RT[0] - g_RT[11] - g_RT[13] + g_RT[28]);
+    Kc = Kc_s[160];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[28]) + (h_RT[11] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34135,12 +32895,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[28];
-    k_f = prefactor_units[161] * fwd_A[161]
-                * exp(fwd_beta[161] * tc[0] - activation_units[161] * fwd_Ea[161] * invT);
+    k_f = k_f_s[161];
     dlnkfdT = fwd_beta[161] * invT + activation_units[161] * fwd_Ea[161] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[11]*sc[19];
-    Kc = refC * exp(-g_RT[2] + g_RT[3] - g_RT[11] - g_RT[19] + g_RT[28]);
+    Kc = Kc_s[161];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[28]) + (h_RT[2] + h_RT[11] + h_RT[19]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34199,12 +32958,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[30];
-    k_f = prefactor_units[162] * fwd_A[162]
-                * exp(fwd_beta[162] * tc[0] - activation_units[162] * fwd_Ea[162] * invT);
+    k_f = k_f_s[162];
     dlnkfdT = fwd_beta[162] * invT + activation_units[162] * fwd_Ea[162] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[28];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[28] + g_RT[30]);
+    Kc = Kc_s[162];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[30]) + (h_RT[4] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34250,12 +33008,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[30];
-    k_f = prefactor_units[163] * fwd_A[163]
-                * exp(fwd_beta[163] * tc[0] - activation_units[163] * fwd_Ea[163] * invT);
+    k_f = k_f_s[163];
     dlnkfdT = fwd_beta[163] * invT + activation_units[163] * fwd_Ea[163] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[28];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[28] + g_RT[30]);
+    Kc = Kc_s[163];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[30]) + (h_RT[5] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34301,12 +33058,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[30];
-    k_f = prefactor_units[164] * fwd_A[164]
-                * exp(fwd_beta[164] * tc[0] - activation_units[164] * fwd_Ea[164] * invT);
+    k_f = k_f_s[164];
     dlnkfdT = fwd_beta[164] * invT + activation_units[164] * fwd_Ea[164] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[28];
-    Kc = exp(g_RT[11] - g_RT[12] - g_RT[28] + g_RT[30]);
+    Kc = Kc_s[164];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[30]) + (h_RT[12] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34352,12 +33108,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[30];
-    k_f = prefactor_units[165] * fwd_A[165]
-                * exp(fwd_beta[165] * tc[0] - activation_units[165] * fwd_Ea[165] * invT);
+    k_f = k_f_s[165];
     dlnkfdT = fwd_beta[165] * invT + activation_units[165] * fwd_Ea[165] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[28];
-    Kc = exp(-g_RT[3] + g_RT[7] - g_RT[28] + g_RT[30]);
+    Kc = Kc_s[165];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[30]) + (h_RT[3] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34403,12 +33158,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[23];
-    k_f = prefactor_units[166] * fwd_A[166]
-                * exp(fwd_beta[166] * tc[0] - activation_units[166] * fwd_Ea[166] * invT);
+    k_f = k_f_s[166];
     dlnkfdT = fwd_beta[166] * invT + activation_units[166] * fwd_Ea[166] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[22];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[22] + g_RT[23]);
+    Kc = Kc_s[166];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[23]) + (h_RT[4] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34454,12 +33208,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[23];
-    k_f = prefactor_units[167] * fwd_A[167]
-                * exp(fwd_beta[167] * tc[0] - activation_units[167] * fwd_Ea[167] * invT);
+    k_f = k_f_s[167];
     dlnkfdT = fwd_beta[167] * invT + activation_units[167] * fwd_Ea[167] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[22];
-    Kc = exp(g_RT[1] - g_RT[2] - g_RT[22] + g_RT[23]);
+    Kc = Kc_s[167];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[23]) + (h_RT[2] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34505,12 +33258,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[23];
-    k_f = prefactor_units[168] * fwd_A[168]
-                * exp(fwd_beta[168] * tc[0] - activation_units[168] * fwd_Ea[168] * invT);
+    k_f = k_f_s[168];
     dlnkfdT = fwd_beta[168] * invT + activation_units[168] * fwd_Ea[168] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[13];
-    Kc = exp(g_RT[1] - g_RT[11] - g_RT[13] + g_RT[23]);
+    Kc = Kc_s[168];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[23]) + (h_RT[11] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34556,12 +33308,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[23];
-    k_f = prefactor_units[169] * fwd_A[169]
-                * exp(fwd_beta[169] * tc[0] - activation_units[169] * fwd_Ea[169] * invT);
+    k_f = k_f_s[169];
     dlnkfdT = fwd_beta[169] * invT + activation_units[169] * fwd_Ea[169] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[14];
-    Kc = exp(g_RT[1] - g_RT[9] - g_RT[14] + g_RT[23]);
+    Kc = Kc_s[169];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[23]) + (h_RT[9] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34607,12 +33358,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[23];
-    k_f = prefactor_units[170] * fwd_A[170]
-                * exp(fwd_beta[170] * tc[0] - activation_units[170] * fwd_Ea[170] * invT);
+    k_f = k_f_s[170];
     dlnkfdT = fwd_beta[170] * invT + activation_units[170] * fwd_Ea[170] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[22];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[22] + g_RT[23]);
+    Kc = Kc_s[170];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[23]) + (h_RT[5] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34658,12 +33408,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[23];
-    k_f = prefactor_units[171] * fwd_A[171]
-                * exp(fwd_beta[171] * tc[0] - activation_units[171] * fwd_Ea[171] * invT);
+    k_f = k_f_s[171];
     dlnkfdT = fwd_beta[171] * invT + activation_units[171] * fwd_Ea[171] * invT2;
     /* reverse */
     phi_r = sc[18]*sc[24];
-    Kc = exp(g_RT[13] - g_RT[18] + g_RT[23] - g_RT[24]);
+    Kc = Kc_s[171];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13] + h_RT[23]) + (h_RT[18] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34709,12 +33458,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[23];
-    k_f = prefactor_units[172] * fwd_A[172]
-                * exp(fwd_beta[172] * tc[0] - activation_units[172] * fwd_Ea[172] * invT);
+    k_f = k_f_s[172];
     dlnkfdT = fwd_beta[172] * invT + activation_units[172] * fwd_Ea[172] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[33];
-    Kc = exp(-g_RT[0] + g_RT[8] + g_RT[23] - g_RT[33]);
+    Kc = Kc_s[172];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[23]) + (h_RT[0] + h_RT[33]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34760,12 +33508,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[23];
-    k_f = prefactor_units[173] * fwd_A[173]
-                * exp(fwd_beta[173] * tc[0] - activation_units[173] * fwd_Ea[173] * invT);
+    k_f = k_f_s[173];
     dlnkfdT = fwd_beta[173] * invT + activation_units[173] * fwd_Ea[173] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[32];
-    Kc = exp(-g_RT[0] + g_RT[8] + g_RT[23] - g_RT[32]);
+    Kc = Kc_s[173];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[23]) + (h_RT[0] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34811,12 +33558,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[23];
-    k_f = prefactor_units[174] * fwd_A[174]
-                * exp(fwd_beta[174] * tc[0] - activation_units[174] * fwd_Ea[174] * invT);
+    k_f = k_f_s[174];
     dlnkfdT = fwd_beta[174] * invT + activation_units[174] * fwd_Ea[174] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[34];
-    Kc = exp(-g_RT[0] + g_RT[9] + g_RT[23] - g_RT[34]);
+    Kc = Kc_s[174];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[23]) + (h_RT[0] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34862,12 +33608,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[23];
-    k_f = prefactor_units[175] * fwd_A[175]
-                * exp(fwd_beta[175] * tc[0] - activation_units[175] * fwd_Ea[175] * invT);
+    k_f = k_f_s[175];
     dlnkfdT = fwd_beta[175] * invT + activation_units[175] * fwd_Ea[175] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[34];
-    Kc = exp(-g_RT[0] + g_RT[10] + g_RT[23] - g_RT[34]);
+    Kc = Kc_s[175];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[23]) + (h_RT[0] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34913,12 +33658,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[23];
-    k_f = prefactor_units[176] * fwd_A[176]
-                * exp(fwd_beta[176] * tc[0] - activation_units[176] * fwd_Ea[176] * invT);
+    k_f = k_f_s[176];
     dlnkfdT = fwd_beta[176] * invT + activation_units[176] * fwd_Ea[176] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[22];
-    Kc = exp(g_RT[11] - g_RT[12] - g_RT[22] + g_RT[23]);
+    Kc = Kc_s[176];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[23]) + (h_RT[12] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34964,12 +33708,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[23];
-    k_f = prefactor_units[177] * fwd_A[177]
-                * exp(fwd_beta[177] * tc[0] - activation_units[177] * fwd_Ea[177] * invT);
+    k_f = k_f_s[177];
     dlnkfdT = fwd_beta[177] * invT + activation_units[177] * fwd_Ea[177] * invT2;
     /* reverse */
     phi_r = sc[37];
-    Kc = refCinv * exp(g_RT[11] + g_RT[23] - g_RT[37]);
+    Kc = Kc_s[177];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[23]) + (h_RT[37]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35004,12 +33747,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[22]*sc[23];
-    k_f = prefactor_units[178] * fwd_A[178]
-                * exp(fwd_beta[178] * tc[0] - activation_units[178] * fwd_Ea[178] * invT);
+    k_f = k_f_s[178];
     dlnkfdT = fwd_beta[178] * invT + activation_units[178] * fwd_Ea[178] * invT2;
     /* reverse */
     phi_r = sc[48];
-    Kc = refCinv * exp(g_RT[22] + g_RT[23] - g_RT[48]);
+    Kc = Kc_s[178];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[22] + h_RT[23]) + (h_RT[48]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35044,12 +33786,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[24];
-    k_f = prefactor_units[179] * fwd_A[179]
-                * exp(fwd_beta[179] * tc[0] - activation_units[179] * fwd_Ea[179] * invT);
+    k_f = k_f_s[179];
     dlnkfdT = fwd_beta[179] * invT + activation_units[179] * fwd_Ea[179] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[23];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[23] + g_RT[24]);
+    Kc = Kc_s[179];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[24]) + (h_RT[4] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35095,12 +33836,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[24];
-    k_f = prefactor_units[180] * fwd_A[180]
-                * exp(fwd_beta[180] * tc[0] - activation_units[180] * fwd_Ea[180] * invT);
+    k_f = k_f_s[180];
     dlnkfdT = fwd_beta[180] * invT + activation_units[180] * fwd_Ea[180] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[14];
-    Kc = exp(g_RT[1] - g_RT[11] - g_RT[14] + g_RT[24]);
+    Kc = Kc_s[180];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[24]) + (h_RT[11] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35146,12 +33886,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[24];
-    k_f = prefactor_units[181] * fwd_A[181]
-                * exp(fwd_beta[181] * tc[0] - activation_units[181] * fwd_Ea[181] * invT);
+    k_f = k_f_s[181];
     dlnkfdT = fwd_beta[181] * invT + activation_units[181] * fwd_Ea[181] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[30];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[24] - g_RT[30]);
+    Kc = Kc_s[181];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[24]) + (h_RT[0] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35197,12 +33936,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[24];
-    k_f = prefactor_units[182] * fwd_A[182]
-                * exp(fwd_beta[182] * tc[0] - activation_units[182] * fwd_Ea[182] * invT);
+    k_f = k_f_s[182];
     dlnkfdT = fwd_beta[182] * invT + activation_units[182] * fwd_Ea[182] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[23];
-    Kc = exp(-g_RT[3] + g_RT[7] - g_RT[23] + g_RT[24]);
+    Kc = Kc_s[182];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[24]) + (h_RT[3] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35248,12 +33986,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[24];
-    k_f = prefactor_units[183] * fwd_A[183]
-                * exp(fwd_beta[183] * tc[0] - activation_units[183] * fwd_Ea[183] * invT);
+    k_f = k_f_s[183];
     dlnkfdT = fwd_beta[183] * invT + activation_units[183] * fwd_Ea[183] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[25];
-    Kc = exp(g_RT[3] - g_RT[7] + g_RT[24] - g_RT[25]);
+    Kc = Kc_s[183];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[24]) + (h_RT[7] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35299,12 +34036,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[24];
-    k_f = prefactor_units[184] * fwd_A[184]
-                * exp(fwd_beta[184] * tc[0] - activation_units[184] * fwd_Ea[184] * invT);
+    k_f = k_f_s[184];
     dlnkfdT = fwd_beta[184] * invT + activation_units[184] * fwd_Ea[184] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[23];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[23] + g_RT[24]);
+    Kc = Kc_s[184];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[24]) + (h_RT[6] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35350,12 +34086,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[24];
-    k_f = prefactor_units[185] * fwd_A[185]
-                * exp(fwd_beta[185] * tc[0] - activation_units[185] * fwd_Ea[185] * invT);
+    k_f = k_f_s[185];
     dlnkfdT = fwd_beta[185] * invT + activation_units[185] * fwd_Ea[185] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[11]*sc[14];
-    Kc = refC * exp(-g_RT[2] + g_RT[3] - g_RT[11] - g_RT[14] + g_RT[24]);
+    Kc = Kc_s[185];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[24]) + (h_RT[2] + h_RT[11] + h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35414,12 +34149,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[22]*sc[24];
-    k_f = prefactor_units[186] * fwd_A[186]
-                * exp(fwd_beta[186] * tc[0] - activation_units[186] * fwd_Ea[186] * invT);
+    k_f = k_f_s[186];
     dlnkfdT = fwd_beta[186] * invT + activation_units[186] * fwd_Ea[186] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[34];
-    Kc = exp(-g_RT[11] + g_RT[22] + g_RT[24] - g_RT[34]);
+    Kc = Kc_s[186];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[22] + h_RT[24]) + (h_RT[11] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35465,12 +34199,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[25];
-    k_f = prefactor_units[187] * fwd_A[187]
-                * exp(fwd_beta[187] * tc[0] - activation_units[187] * fwd_Ea[187] * invT);
+    k_f = k_f_s[187];
     dlnkfdT = fwd_beta[187] * invT + activation_units[187] * fwd_Ea[187] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[24];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[24] + g_RT[25]);
+    Kc = Kc_s[187];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[25]) + (h_RT[4] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35516,12 +34249,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[25];
-    k_f = prefactor_units[188] * fwd_A[188]
-                * exp(fwd_beta[188] * tc[0] - activation_units[188] * fwd_Ea[188] * invT);
+    k_f = k_f_s[188];
     dlnkfdT = fwd_beta[188] * invT + activation_units[188] * fwd_Ea[188] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[24];
-    Kc = exp(g_RT[1] - g_RT[2] - g_RT[24] + g_RT[25]);
+    Kc = Kc_s[188];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[25]) + (h_RT[2] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35567,12 +34299,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[25];
-    k_f = prefactor_units[189] * fwd_A[189]
-                * exp(fwd_beta[189] * tc[0] - activation_units[189] * fwd_Ea[189] * invT);
+    k_f = k_f_s[189];
     dlnkfdT = fwd_beta[189] * invT + activation_units[189] * fwd_Ea[189] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[24];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[24] + g_RT[25]);
+    Kc = Kc_s[189];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[25]) + (h_RT[5] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35618,12 +34349,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[25];
-    k_f = prefactor_units[190] * fwd_A[190]
-                * exp(fwd_beta[190] * tc[0] - activation_units[190] * fwd_Ea[190] * invT);
+    k_f = k_f_s[190];
     dlnkfdT = fwd_beta[190] * invT + activation_units[190] * fwd_Ea[190] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[24];
-    Kc = exp(g_RT[10] - g_RT[11] - g_RT[24] + g_RT[25]);
+    Kc = Kc_s[190];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[25]) + (h_RT[11] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35669,12 +34399,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[25];
-    k_f = prefactor_units[191] * fwd_A[191]
-                * exp(fwd_beta[191] * tc[0] - activation_units[191] * fwd_Ea[191] * invT);
+    k_f = k_f_s[191];
     dlnkfdT = fwd_beta[191] * invT + activation_units[191] * fwd_Ea[191] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[24];
-    Kc = exp(g_RT[11] - g_RT[12] - g_RT[24] + g_RT[25]);
+    Kc = Kc_s[191];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[25]) + (h_RT[12] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35720,12 +34449,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[31];
-    k_f = prefactor_units[192] * fwd_A[192]
-                * exp(fwd_beta[192] * tc[0] - activation_units[192] * fwd_Ea[192] * invT);
+    k_f = k_f_s[192];
     dlnkfdT = fwd_beta[192] * invT + activation_units[192] * fwd_Ea[192] * invT2;
     /* reverse */
     phi_r = sc[32];
-    Kc = refCinv * exp(g_RT[0] + g_RT[31] - g_RT[32]);
+    Kc = Kc_s[192];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[31]) + (h_RT[32]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35760,12 +34488,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[31];
-    k_f = prefactor_units[193] * fwd_A[193]
-                * exp(fwd_beta[193] * tc[0] - activation_units[193] * fwd_Ea[193] * invT);
+    k_f = k_f_s[193];
     dlnkfdT = fwd_beta[193] * invT + activation_units[193] * fwd_Ea[193] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[20];
-    Kc = exp(g_RT[1] - g_RT[14] - g_RT[20] + g_RT[31]);
+    Kc = Kc_s[193];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[31]) + (h_RT[14] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35811,12 +34538,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[31];
-    k_f = prefactor_units[194] * fwd_A[194]
-                * exp(fwd_beta[194] * tc[0] - activation_units[194] * fwd_Ea[194] * invT);
+    k_f = k_f_s[194];
     dlnkfdT = fwd_beta[194] * invT + activation_units[194] * fwd_Ea[194] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[27];
-    Kc = exp(g_RT[7] - g_RT[13] - g_RT[27] + g_RT[31]);
+    Kc = Kc_s[194];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[31]) + (h_RT[13] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35862,12 +34588,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[31];
-    k_f = prefactor_units[195] * fwd_A[195]
-                * exp(fwd_beta[195] * tc[0] - activation_units[195] * fwd_Ea[195] * invT);
+    k_f = k_f_s[195];
     dlnkfdT = fwd_beta[195] * invT + activation_units[195] * fwd_Ea[195] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[32];
-    Kc = exp(g_RT[3] - g_RT[7] + g_RT[31] - g_RT[32]);
+    Kc = Kc_s[195];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[31]) + (h_RT[7] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35913,12 +34638,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[33];
-    k_f = prefactor_units[196] * fwd_A[196]
-                * exp(fwd_beta[196] * tc[0] - activation_units[196] * fwd_Ea[196] * invT);
+    k_f = k_f_s[196];
     dlnkfdT = fwd_beta[196] * invT + activation_units[196] * fwd_Ea[196] * invT2;
     /* reverse */
     phi_r = sc[35];
-    Kc = refCinv * exp(g_RT[0] + g_RT[33] - g_RT[35]);
+    Kc = Kc_s[196];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[33]) + (h_RT[35]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35953,12 +34677,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[33];
-    k_f = prefactor_units[197] * fwd_A[197]
-                * exp(fwd_beta[197] * tc[0] - activation_units[197] * fwd_Ea[197] * invT);
+    k_f = k_f_s[197];
     dlnkfdT = fwd_beta[197] * invT + activation_units[197] * fwd_Ea[197] * invT2;
     /* reverse */
     phi_r = sc[34];
-    Kc = refCinv * exp(g_RT[0] + g_RT[33] - g_RT[34]);
+    Kc = Kc_s[197];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[33]) + (h_RT[34]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35993,12 +34716,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[33];
-    k_f = prefactor_units[198] * fwd_A[198]
-                * exp(fwd_beta[198] * tc[0] - activation_units[198] * fwd_Ea[198] * invT);
+    k_f = k_f_s[198];
     dlnkfdT = fwd_beta[198] * invT + activation_units[198] * fwd_Ea[198] * invT2;
     /* reverse */
     phi_r = sc[18]*sc[23];
-    Kc = exp(g_RT[1] - g_RT[18] - g_RT[23] + g_RT[33]);
+    Kc = Kc_s[198];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[33]) + (h_RT[18] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36044,12 +34766,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[33];
-    k_f = prefactor_units[199] * fwd_A[199]
-                * exp(fwd_beta[199] * tc[0] - activation_units[199] * fwd_Ea[199] * invT);
+    k_f = k_f_s[199];
     dlnkfdT = fwd_beta[199] * invT + activation_units[199] * fwd_Ea[199] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[31];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[31] + g_RT[33]);
+    Kc = Kc_s[199];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[33]) + (h_RT[5] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36095,12 +34816,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[32];
-    k_f = prefactor_units[200] * fwd_A[200]
-                * exp(fwd_beta[200] * tc[0] - activation_units[200] * fwd_Ea[200] * invT);
+    k_f = k_f_s[200];
     dlnkfdT = fwd_beta[200] * invT + activation_units[200] * fwd_Ea[200] * invT2;
     /* reverse */
     phi_r = sc[33];
-    Kc = exp(g_RT[32] - g_RT[33]);
+    Kc = Kc_s[200];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[32]) + (h_RT[33]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36126,12 +34846,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[32];
-    k_f = prefactor_units[201] * fwd_A[201]
-                * exp(fwd_beta[201] * tc[0] - activation_units[201] * fwd_Ea[201] * invT);
+    k_f = k_f_s[201];
     dlnkfdT = fwd_beta[201] * invT + activation_units[201] * fwd_Ea[201] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[33];
-    Kc = exp(g_RT[0] - g_RT[0] + g_RT[32] - g_RT[33]);
+    Kc = Kc_s[201];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[32]) + (h_RT[0] + h_RT[33]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36161,12 +34880,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[32];
-    k_f = prefactor_units[202] * fwd_A[202]
-                * exp(fwd_beta[202] * tc[0] - activation_units[202] * fwd_Ea[202] * invT);
+    k_f = k_f_s[202];
     dlnkfdT = fwd_beta[202] * invT + activation_units[202] * fwd_Ea[202] * invT2;
     /* reverse */
     phi_r = sc[35];
-    Kc = refCinv * exp(g_RT[0] + g_RT[32] - g_RT[35]);
+    Kc = Kc_s[202];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[32]) + (h_RT[35]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36201,12 +34919,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[32];
-    k_f = prefactor_units[203] * fwd_A[203]
-                * exp(fwd_beta[203] * tc[0] - activation_units[203] * fwd_Ea[203] * invT);
+    k_f = k_f_s[203];
     dlnkfdT = fwd_beta[203] * invT + activation_units[203] * fwd_Ea[203] * invT2;
     /* reverse */
     phi_r = sc[18]*sc[23];
-    Kc = exp(g_RT[1] - g_RT[18] - g_RT[23] + g_RT[32]);
+    Kc = Kc_s[203];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[32]) + (h_RT[18] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36252,12 +34969,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[32];
-    k_f = prefactor_units[204] * fwd_A[204]
-                * exp(fwd_beta[204] * tc[0] - activation_units[204] * fwd_Ea[204] * invT);
+    k_f = k_f_s[204];
     dlnkfdT = fwd_beta[204] * invT + activation_units[204] * fwd_Ea[204] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[31];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[31] + g_RT[32]);
+    Kc = Kc_s[204];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[32]) + (h_RT[5] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36303,12 +35019,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[34];
-    k_f = prefactor_units[205] * fwd_A[205]
-                * exp(fwd_beta[205] * tc[0] - activation_units[205] * fwd_Ea[205] * invT);
+    k_f = k_f_s[205];
     dlnkfdT = fwd_beta[205] * invT + activation_units[205] * fwd_Ea[205] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[33];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[33] + g_RT[34]);
+    Kc = Kc_s[205];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[34]) + (h_RT[4] + h_RT[33]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36354,12 +35069,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[34];
-    k_f = prefactor_units[206] * fwd_A[206]
-                * exp(fwd_beta[206] * tc[0] - activation_units[206] * fwd_Ea[206] * invT);
+    k_f = k_f_s[206];
     dlnkfdT = fwd_beta[206] * invT + activation_units[206] * fwd_Ea[206] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[39];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[34] - g_RT[39]);
+    Kc = Kc_s[206];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[34]) + (h_RT[0] + h_RT[39]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36405,12 +35119,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[34];
-    k_f = prefactor_units[207] * fwd_A[207]
-                * exp(fwd_beta[207] * tc[0] - activation_units[207] * fwd_Ea[207] * invT);
+    k_f = k_f_s[207];
     dlnkfdT = fwd_beta[207] * invT + activation_units[207] * fwd_Ea[207] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[0]*sc[39];
-    Kc = refC * exp(-2*g_RT[0] + g_RT[2] + g_RT[34] - g_RT[39]);
+    Kc = Kc_s[207];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[34]) + (2*h_RT[0] + h_RT[39]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36456,12 +35169,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[34];
-    k_f = prefactor_units[208] * fwd_A[208]
-                * exp(fwd_beta[208] * tc[0] - activation_units[208] * fwd_Ea[208] * invT);
+    k_f = k_f_s[208];
     dlnkfdT = fwd_beta[208] * invT + activation_units[208] * fwd_Ea[208] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[33];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[33] + g_RT[34]);
+    Kc = Kc_s[208];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[34]) + (h_RT[5] + h_RT[33]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36507,12 +35219,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[34];
-    k_f = prefactor_units[209] * fwd_A[209]
-                * exp(fwd_beta[209] * tc[0] - activation_units[209] * fwd_Ea[209] * invT);
+    k_f = k_f_s[209];
     dlnkfdT = fwd_beta[209] * invT + activation_units[209] * fwd_Ea[209] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[36];
-    Kc = exp(g_RT[3] - g_RT[7] + g_RT[34] - g_RT[36]);
+    Kc = Kc_s[209];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[34]) + (h_RT[7] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36558,12 +35269,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[34];
-    k_f = prefactor_units[210] * fwd_A[210]
-                * exp(fwd_beta[210] * tc[0] - activation_units[210] * fwd_Ea[210] * invT);
+    k_f = k_f_s[210];
     dlnkfdT = fwd_beta[210] * invT + activation_units[210] * fwd_Ea[210] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[14]*sc[22];
-    Kc = refC * exp(-g_RT[2] + g_RT[3] - g_RT[14] - g_RT[22] + g_RT[34]);
+    Kc = Kc_s[210];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[34]) + (h_RT[2] + h_RT[14] + h_RT[22]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36622,12 +35332,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[34];
-    k_f = prefactor_units[211] * fwd_A[211]
-                * exp(fwd_beta[211] * tc[0] - activation_units[211] * fwd_Ea[211] * invT);
+    k_f = k_f_s[211];
     dlnkfdT = fwd_beta[211] * invT + activation_units[211] * fwd_Ea[211] * invT2;
     /* reverse */
     phi_r = sc[18]*sc[36];
-    Kc = exp(g_RT[13] - g_RT[18] + g_RT[34] - g_RT[36]);
+    Kc = Kc_s[211];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13] + h_RT[34]) + (h_RT[18] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36673,12 +35382,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[34];
-    k_f = prefactor_units[212] * fwd_A[212]
-                * exp(fwd_beta[212] * tc[0] - activation_units[212] * fwd_Ea[212] * invT);
+    k_f = k_f_s[212];
     dlnkfdT = fwd_beta[212] * invT + activation_units[212] * fwd_Ea[212] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[33];
-    Kc = exp(g_RT[11] - g_RT[12] - g_RT[33] + g_RT[34]);
+    Kc = Kc_s[212];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[34]) + (h_RT[12] + h_RT[33]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36724,12 +35432,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[35];
-    k_f = prefactor_units[213] * fwd_A[213]
-                * exp(fwd_beta[213] * tc[0] - activation_units[213] * fwd_Ea[213] * invT);
+    k_f = k_f_s[213];
     dlnkfdT = fwd_beta[213] * invT + activation_units[213] * fwd_Ea[213] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[28];
-    Kc = exp(g_RT[7] - g_RT[14] - g_RT[28] + g_RT[35]);
+    Kc = Kc_s[213];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[35]) + (h_RT[14] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36775,12 +35482,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[35];
-    k_f = prefactor_units[214] * fwd_A[214]
-                * exp(fwd_beta[214] * tc[0] - activation_units[214] * fwd_Ea[214] * invT);
+    k_f = k_f_s[214];
     dlnkfdT = fwd_beta[214] * invT + activation_units[214] * fwd_Ea[214] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[11]*sc[27];
-    Kc = refC * exp(-g_RT[2] + g_RT[3] - g_RT[11] - g_RT[27] + g_RT[35]);
+    Kc = Kc_s[214];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[35]) + (h_RT[2] + h_RT[11] + h_RT[27]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36839,12 +35545,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[36];
-    k_f = prefactor_units[215] * fwd_A[215]
-                * exp(fwd_beta[215] * tc[0] - activation_units[215] * fwd_Ea[215] * invT);
+    k_f = k_f_s[215];
     dlnkfdT = fwd_beta[215] * invT + activation_units[215] * fwd_Ea[215] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[23];
-    Kc = exp(g_RT[0] - g_RT[11] - g_RT[23] + g_RT[36]);
+    Kc = Kc_s[215];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[36]) + (h_RT[11] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36890,12 +35595,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[36];
-    k_f = prefactor_units[216] * fwd_A[216]
-                * exp(fwd_beta[216] * tc[0] - activation_units[216] * fwd_Ea[216] * invT);
+    k_f = k_f_s[216];
     dlnkfdT = fwd_beta[216] * invT + activation_units[216] * fwd_Ea[216] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[34];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[34] + g_RT[36]);
+    Kc = Kc_s[216];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[36]) + (h_RT[4] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36941,12 +35645,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[36];
-    k_f = prefactor_units[217] * fwd_A[217]
-                * exp(fwd_beta[217] * tc[0] - activation_units[217] * fwd_Ea[217] * invT);
+    k_f = k_f_s[217];
     dlnkfdT = fwd_beta[217] * invT + activation_units[217] * fwd_Ea[217] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[35];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[35] + g_RT[36]);
+    Kc = Kc_s[217];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[36]) + (h_RT[4] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36992,12 +35695,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[36];
-    k_f = prefactor_units[218] * fwd_A[218]
-                * exp(fwd_beta[218] * tc[0] - activation_units[218] * fwd_Ea[218] * invT);
+    k_f = k_f_s[218];
     dlnkfdT = fwd_beta[218] * invT + activation_units[218] * fwd_Ea[218] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[11]*sc[27];
-    Kc = refC * exp(-g_RT[0] + g_RT[1] - g_RT[11] - g_RT[27] + g_RT[36]);
+    Kc = Kc_s[218];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[36]) + (h_RT[0] + h_RT[11] + h_RT[27]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37056,12 +35758,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[36];
-    k_f = prefactor_units[219] * fwd_A[219]
-                * exp(fwd_beta[219] * tc[0] - activation_units[219] * fwd_Ea[219] * invT);
+    k_f = k_f_s[219];
     dlnkfdT = fwd_beta[219] * invT + activation_units[219] * fwd_Ea[219] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[0]*sc[39];
-    Kc = refC * exp(-2*g_RT[0] + g_RT[1] + g_RT[36] - g_RT[39]);
+    Kc = Kc_s[219];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[36]) + (2*h_RT[0] + h_RT[39]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37107,12 +35808,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[36];
-    k_f = prefactor_units[220] * fwd_A[220]
-                * exp(fwd_beta[220] * tc[0] - activation_units[220] * fwd_Ea[220] * invT);
+    k_f = k_f_s[220];
     dlnkfdT = fwd_beta[220] * invT + activation_units[220] * fwd_Ea[220] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[24];
-    Kc = exp(g_RT[1] - g_RT[13] - g_RT[24] + g_RT[36]);
+    Kc = Kc_s[220];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[36]) + (h_RT[13] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37158,12 +35858,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[36];
-    k_f = prefactor_units[221] * fwd_A[221]
-                * exp(fwd_beta[221] * tc[0] - activation_units[221] * fwd_Ea[221] * invT);
+    k_f = k_f_s[221];
     dlnkfdT = fwd_beta[221] * invT + activation_units[221] * fwd_Ea[221] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[34];
-    Kc = exp(g_RT[1] - g_RT[2] - g_RT[34] + g_RT[36]);
+    Kc = Kc_s[221];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[36]) + (h_RT[2] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37209,12 +35908,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[36];
-    k_f = prefactor_units[222] * fwd_A[222]
-                * exp(fwd_beta[222] * tc[0] - activation_units[222] * fwd_Ea[222] * invT);
+    k_f = k_f_s[222];
     dlnkfdT = fwd_beta[222] * invT + activation_units[222] * fwd_Ea[222] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[35];
-    Kc = exp(g_RT[1] - g_RT[2] - g_RT[35] + g_RT[36]);
+    Kc = Kc_s[222];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[36]) + (h_RT[2] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37260,12 +35958,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[36];
-    k_f = prefactor_units[223] * fwd_A[223]
-                * exp(fwd_beta[223] * tc[0] - activation_units[223] * fwd_Ea[223] * invT);
+    k_f = k_f_s[223];
     dlnkfdT = fwd_beta[223] * invT + activation_units[223] * fwd_Ea[223] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[34];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[34] + g_RT[36]);
+    Kc = Kc_s[223];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[36]) + (h_RT[5] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37311,12 +36008,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[36];
-    k_f = prefactor_units[224] * fwd_A[224]
-                * exp(fwd_beta[224] * tc[0] - activation_units[224] * fwd_Ea[224] * invT);
+    k_f = k_f_s[224];
     dlnkfdT = fwd_beta[224] * invT + activation_units[224] * fwd_Ea[224] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[35];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[35] + g_RT[36]);
+    Kc = Kc_s[224];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[36]) + (h_RT[5] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37362,12 +36058,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[36];
-    k_f = prefactor_units[225] * fwd_A[225]
-                * exp(fwd_beta[225] * tc[0] - activation_units[225] * fwd_Ea[225] * invT);
+    k_f = k_f_s[225];
     dlnkfdT = fwd_beta[225] * invT + activation_units[225] * fwd_Ea[225] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[34];
-    Kc = exp(g_RT[11] - g_RT[12] - g_RT[34] + g_RT[36]);
+    Kc = Kc_s[225];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[36]) + (h_RT[12] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37413,12 +36108,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[39];
-    k_f = prefactor_units[226] * fwd_A[226]
-                * exp(fwd_beta[226] * tc[0] - activation_units[226] * fwd_Ea[226] * invT);
+    k_f = k_f_s[226];
     dlnkfdT = fwd_beta[226] * invT + activation_units[226] * fwd_Ea[226] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[18]*sc[22];
-    Kc = refC * exp(g_RT[1] - g_RT[2] - g_RT[18] - g_RT[22] + g_RT[39]);
+    Kc = Kc_s[226];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[39]) + (h_RT[2] + h_RT[18] + h_RT[22]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37477,12 +36171,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[39];
-    k_f = prefactor_units[227] * fwd_A[227]
-                * exp(fwd_beta[227] * tc[0] - activation_units[227] * fwd_Ea[227] * invT);
+    k_f = k_f_s[227];
     dlnkfdT = fwd_beta[227] * invT + activation_units[227] * fwd_Ea[227] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[27];
-    Kc = exp(g_RT[1] - g_RT[14] - g_RT[27] + g_RT[39]);
+    Kc = Kc_s[227];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[39]) + (h_RT[14] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37528,12 +36221,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[38];
-    k_f = prefactor_units[228] * fwd_A[228]
-                * exp(fwd_beta[228] * tc[0] - activation_units[228] * fwd_Ea[228] * invT);
+    k_f = k_f_s[228];
     dlnkfdT = fwd_beta[228] * invT + activation_units[228] * fwd_Ea[228] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[24];
-    Kc = exp(g_RT[0] - g_RT[11] - g_RT[24] + g_RT[38]);
+    Kc = Kc_s[228];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[38]) + (h_RT[11] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37579,12 +36271,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[38];
-    k_f = prefactor_units[229] * fwd_A[229]
-                * exp(fwd_beta[229] * tc[0] - activation_units[229] * fwd_Ea[229] * invT);
+    k_f = k_f_s[229];
     dlnkfdT = fwd_beta[229] * invT + activation_units[229] * fwd_Ea[229] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[30];
-    Kc = exp(g_RT[1] - g_RT[11] - g_RT[30] + g_RT[38]);
+    Kc = Kc_s[229];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[38]) + (h_RT[11] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37630,12 +36321,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[38];
-    k_f = prefactor_units[230] * fwd_A[230]
-                * exp(fwd_beta[230] * tc[0] - activation_units[230] * fwd_Ea[230] * invT);
+    k_f = k_f_s[230];
     dlnkfdT = fwd_beta[230] * invT + activation_units[230] * fwd_Ea[230] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[36];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[36] + g_RT[38]);
+    Kc = Kc_s[230];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[38]) + (h_RT[5] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37681,12 +36371,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[38];
-    k_f = prefactor_units[231] * fwd_A[231]
-                * exp(fwd_beta[231] * tc[0] - activation_units[231] * fwd_Ea[231] * invT);
+    k_f = k_f_s[231];
     dlnkfdT = fwd_beta[231] * invT + activation_units[231] * fwd_Ea[231] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[36];
-    Kc = exp(-g_RT[3] + g_RT[7] - g_RT[36] + g_RT[38]);
+    Kc = Kc_s[231];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[38]) + (h_RT[3] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37732,12 +36421,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[38];
-    k_f = prefactor_units[232] * fwd_A[232]
-                * exp(fwd_beta[232] * tc[0] - activation_units[232] * fwd_Ea[232] * invT);
+    k_f = k_f_s[232];
     dlnkfdT = fwd_beta[232] * invT + activation_units[232] * fwd_Ea[232] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[11]*sc[30];
-    Kc = refC * exp(-g_RT[2] + g_RT[3] - g_RT[11] - g_RT[30] + g_RT[38]);
+    Kc = Kc_s[232];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[38]) + (h_RT[2] + h_RT[11] + h_RT[30]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37796,12 +36484,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[38];
-    k_f = prefactor_units[233] * fwd_A[233]
-                * exp(fwd_beta[233] * tc[0] - activation_units[233] * fwd_Ea[233] * invT);
+    k_f = k_f_s[233];
     dlnkfdT = fwd_beta[233] * invT + activation_units[233] * fwd_Ea[233] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[36];
-    Kc = exp(g_RT[11] - g_RT[12] - g_RT[36] + g_RT[38]);
+    Kc = Kc_s[233];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[38]) + (h_RT[12] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37847,12 +36534,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[37];
-    k_f = prefactor_units[234] * fwd_A[234]
-                * exp(fwd_beta[234] * tc[0] - activation_units[234] * fwd_Ea[234] * invT);
+    k_f = k_f_s[234];
     dlnkfdT = fwd_beta[234] * invT + activation_units[234] * fwd_Ea[234] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[24];
-    Kc = exp(g_RT[0] - g_RT[11] - g_RT[24] + g_RT[37]);
+    Kc = Kc_s[234];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[37]) + (h_RT[11] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37898,12 +36584,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[37];
-    k_f = prefactor_units[235] * fwd_A[235]
-                * exp(fwd_beta[235] * tc[0] - activation_units[235] * fwd_Ea[235] * invT);
+    k_f = k_f_s[235];
     dlnkfdT = fwd_beta[235] * invT + activation_units[235] * fwd_Ea[235] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[36];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[36] + g_RT[37]);
+    Kc = Kc_s[235];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[37]) + (h_RT[5] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37949,12 +36634,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[37];
-    k_f = prefactor_units[236] * fwd_A[236]
-                * exp(fwd_beta[236] * tc[0] - activation_units[236] * fwd_Ea[236] * invT);
+    k_f = k_f_s[236];
     dlnkfdT = fwd_beta[236] * invT + activation_units[236] * fwd_Ea[236] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[36];
-    Kc = exp(-g_RT[3] + g_RT[7] - g_RT[36] + g_RT[37]);
+    Kc = Kc_s[236];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[37]) + (h_RT[3] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38000,12 +36684,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[37];
-    k_f = prefactor_units[237] * fwd_A[237]
-                * exp(fwd_beta[237] * tc[0] - activation_units[237] * fwd_Ea[237] * invT);
+    k_f = k_f_s[237];
     dlnkfdT = fwd_beta[237] * invT + activation_units[237] * fwd_Ea[237] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[14]*sc[24];
-    Kc = refC * exp(-g_RT[2] + g_RT[3] - g_RT[14] - g_RT[24] + g_RT[37]);
+    Kc = Kc_s[237];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[37]) + (h_RT[2] + h_RT[14] + h_RT[24]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38064,12 +36747,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[37];
-    k_f = prefactor_units[238] * fwd_A[238]
-                * exp(fwd_beta[238] * tc[0] - activation_units[238] * fwd_Ea[238] * invT);
+    k_f = k_f_s[238];
     dlnkfdT = fwd_beta[238] * invT + activation_units[238] * fwd_Ea[238] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[36];
-    Kc = exp(g_RT[11] - g_RT[12] - g_RT[36] + g_RT[37]);
+    Kc = Kc_s[238];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[37]) + (h_RT[12] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38115,12 +36797,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[40];
-    k_f = prefactor_units[239] * fwd_A[239]
-                * exp(fwd_beta[239] * tc[0] - activation_units[239] * fwd_Ea[239] * invT);
+    k_f = k_f_s[239];
     dlnkfdT = fwd_beta[239] * invT + activation_units[239] * fwd_Ea[239] * invT2;
     /* reverse */
     phi_r = sc[41];
-    Kc = refCinv * exp(g_RT[0] + g_RT[40] - g_RT[41]);
+    Kc = Kc_s[239];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[40]) + (h_RT[41]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38155,12 +36836,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[41];
-    k_f = prefactor_units[240] * fwd_A[240]
-                * exp(fwd_beta[240] * tc[0] - activation_units[240] * fwd_Ea[240] * invT);
+    k_f = k_f_s[240];
     dlnkfdT = fwd_beta[240] * invT + activation_units[240] * fwd_Ea[240] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[40];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[40] + g_RT[41]);
+    Kc = Kc_s[240];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[41]) + (h_RT[4] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38206,12 +36886,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[42];
-    k_f = prefactor_units[241] * fwd_A[241]
-                * exp(fwd_beta[241] * tc[0] - activation_units[241] * fwd_Ea[241] * invT);
+    k_f = k_f_s[241];
     dlnkfdT = fwd_beta[241] * invT + activation_units[241] * fwd_Ea[241] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[41];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[41] + g_RT[42]);
+    Kc = Kc_s[241];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[42]) + (h_RT[5] + h_RT[41]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38257,12 +36936,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[44];
-    k_f = prefactor_units[242] * fwd_A[242]
-                * exp(fwd_beta[242] * tc[0] - activation_units[242] * fwd_Ea[242] * invT);
+    k_f = k_f_s[242];
     dlnkfdT = fwd_beta[242] * invT + activation_units[242] * fwd_Ea[242] * invT2;
     /* reverse */
     phi_r = sc[43];
-    Kc = exp(-g_RT[43] + g_RT[44]);
+    Kc = Kc_s[242];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[44]) + (h_RT[43]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38288,12 +36966,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[45];
-    k_f = prefactor_units[243] * fwd_A[243]
-                * exp(fwd_beta[243] * tc[0] - activation_units[243] * fwd_Ea[243] * invT);
+    k_f = k_f_s[243];
     dlnkfdT = fwd_beta[243] * invT + activation_units[243] * fwd_Ea[243] * invT2;
     /* reverse */
     phi_r = sc[22]*sc[23];
-    Kc = exp(g_RT[0] - g_RT[22] - g_RT[23] + g_RT[45]);
+    Kc = Kc_s[243];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[45]) + (h_RT[22] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38339,12 +37016,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[45];
-    k_f = prefactor_units[244] * fwd_A[244]
-                * exp(fwd_beta[244] * tc[0] - activation_units[244] * fwd_Ea[244] * invT);
+    k_f = k_f_s[244];
     dlnkfdT = fwd_beta[244] * invT + activation_units[244] * fwd_Ea[244] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[43];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[43] + g_RT[45]);
+    Kc = Kc_s[244];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[45]) + (h_RT[5] + h_RT[43]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38390,12 +37066,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[46];
-    k_f = prefactor_units[245] * fwd_A[245]
-                * exp(fwd_beta[245] * tc[0] - activation_units[245] * fwd_Ea[245] * invT);
+    k_f = k_f_s[245];
     dlnkfdT = fwd_beta[245] * invT + activation_units[245] * fwd_Ea[245] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[43];
-    Kc = refC * exp(-g_RT[0] - g_RT[43] + g_RT[46]);
+    Kc = Kc_s[245];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[46]) + (h_RT[0] + h_RT[43]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38430,12 +37105,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[47];
-    k_f = prefactor_units[246] * fwd_A[246]
-                * exp(fwd_beta[246] * tc[0] - activation_units[246] * fwd_Ea[246] * invT);
+    k_f = k_f_s[246];
     dlnkfdT = fwd_beta[246] * invT + activation_units[246] * fwd_Ea[246] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[44];
-    Kc = refC * exp(-g_RT[0] - g_RT[44] + g_RT[47]);
+    Kc = Kc_s[246];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[47]) + (h_RT[0] + h_RT[44]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38470,12 +37144,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[48];
-    k_f = prefactor_units[247] * fwd_A[247]
-                * exp(fwd_beta[247] * tc[0] - activation_units[247] * fwd_Ea[247] * invT);
+    k_f = k_f_s[247];
     dlnkfdT = fwd_beta[247] * invT + activation_units[247] * fwd_Ea[247] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[45];
-    Kc = refC * exp(-g_RT[0] - g_RT[45] + g_RT[48]);
+    Kc = Kc_s[247];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[48]) + (h_RT[0] + h_RT[45]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38510,12 +37183,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[48];
-    k_f = prefactor_units[248] * fwd_A[248]
-                * exp(fwd_beta[248] * tc[0] - activation_units[248] * fwd_Ea[248] * invT);
+    k_f = k_f_s[248];
     dlnkfdT = fwd_beta[248] * invT + activation_units[248] * fwd_Ea[248] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[45];
-    Kc = exp(-g_RT[3] + g_RT[7] - g_RT[45] + g_RT[48]);
+    Kc = Kc_s[248];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[48]) + (h_RT[3] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38561,12 +37233,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[48];
-    k_f = prefactor_units[249] * fwd_A[249]
-                * exp(fwd_beta[249] * tc[0] - activation_units[249] * fwd_Ea[249] * invT);
+    k_f = k_f_s[249];
     dlnkfdT = fwd_beta[249] * invT + activation_units[249] * fwd_Ea[249] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[14]*sc[34];
-    Kc = refC * exp(-g_RT[2] + g_RT[3] - g_RT[14] - g_RT[34] + g_RT[48]);
+    Kc = Kc_s[249];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[48]) + (h_RT[2] + h_RT[14] + h_RT[34]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38625,12 +37296,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[49];
-    k_f = prefactor_units[250] * fwd_A[250]
-                * exp(fwd_beta[250] * tc[0] - activation_units[250] * fwd_Ea[250] * invT);
+    k_f = k_f_s[250];
     dlnkfdT = fwd_beta[250] * invT + activation_units[250] * fwd_Ea[250] * invT2;
     /* reverse */
     phi_r = sc[23]*sc[24];
-    Kc = exp(g_RT[0] - g_RT[23] - g_RT[24] + g_RT[49]);
+    Kc = Kc_s[250];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[49]) + (h_RT[23] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38676,12 +37346,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[49];
-    k_f = prefactor_units[251] * fwd_A[251]
-                * exp(fwd_beta[251] * tc[0] - activation_units[251] * fwd_Ea[251] * invT);
+    k_f = k_f_s[251];
     dlnkfdT = fwd_beta[251] * invT + activation_units[251] * fwd_Ea[251] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[36];
-    Kc = exp(g_RT[0] - g_RT[11] - g_RT[36] + g_RT[49]);
+    Kc = Kc_s[251];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[49]) + (h_RT[11] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38727,12 +37396,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[49];
-    k_f = prefactor_units[252] * fwd_A[252]
-                * exp(fwd_beta[252] * tc[0] - activation_units[252] * fwd_Ea[252] * invT);
+    k_f = k_f_s[252];
     dlnkfdT = fwd_beta[252] * invT + activation_units[252] * fwd_Ea[252] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[48];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[48] + g_RT[49]);
+    Kc = Kc_s[252];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[49]) + (h_RT[4] + h_RT[48]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38778,12 +37446,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[49];
-    k_f = prefactor_units[253] * fwd_A[253]
-                * exp(fwd_beta[253] * tc[0] - activation_units[253] * fwd_Ea[253] * invT);
+    k_f = k_f_s[253];
     dlnkfdT = fwd_beta[253] * invT + activation_units[253] * fwd_Ea[253] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[37];
-    Kc = exp(g_RT[1] - g_RT[13] - g_RT[37] + g_RT[49]);
+    Kc = Kc_s[253];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[49]) + (h_RT[13] + h_RT[37]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38829,12 +37496,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[23]*sc[24];
-    k_f = prefactor_units[254] * fwd_A[254]
-                * exp(fwd_beta[254] * tc[0] - activation_units[254] * fwd_Ea[254] * invT);
+    k_f = k_f_s[254];
     dlnkfdT = fwd_beta[254] * invT + activation_units[254] * fwd_Ea[254] * invT2;
     /* reverse */
     phi_r = sc[50];
-    Kc = refCinv * exp(g_RT[23] + g_RT[24] - g_RT[50]);
+    Kc = Kc_s[254];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[23] + h_RT[24]) + (h_RT[50]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38869,12 +37535,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[50];
-    k_f = prefactor_units[255] * fwd_A[255]
-                * exp(fwd_beta[255] * tc[0] - activation_units[255] * fwd_Ea[255] * invT);
+    k_f = k_f_s[255];
     dlnkfdT = fwd_beta[255] * invT + activation_units[255] * fwd_Ea[255] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[49];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[49] + g_RT[50]);
+    Kc = Kc_s[255];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[50]) + (h_RT[5] + h_RT[49]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38920,12 +37585,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[50];
-    k_f = prefactor_units[256] * fwd_A[256]
-                * exp(fwd_beta[256] * tc[0] - activation_units[256] * fwd_Ea[256] * invT);
+    k_f = k_f_s[256];
     dlnkfdT = fwd_beta[256] * invT + activation_units[256] * fwd_Ea[256] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[49];
-    Kc = exp(-g_RT[3] + g_RT[7] - g_RT[49] + g_RT[50]);
+    Kc = Kc_s[256];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[50]) + (h_RT[3] + h_RT[49]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38971,12 +37635,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[50];
-    k_f = prefactor_units[257] * fwd_A[257]
-                * exp(fwd_beta[257] * tc[0] - activation_units[257] * fwd_Ea[257] * invT);
+    k_f = k_f_s[257];
     dlnkfdT = fwd_beta[257] * invT + activation_units[257] * fwd_Ea[257] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[14]*sc[37];
-    Kc = refC * exp(-g_RT[2] + g_RT[3] - g_RT[14] - g_RT[37] + g_RT[50]);
+    Kc = Kc_s[257];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[50]) + (h_RT[2] + h_RT[14] + h_RT[37]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39035,12 +37698,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[50];
-    k_f = prefactor_units[258] * fwd_A[258]
-                * exp(fwd_beta[258] * tc[0] - activation_units[258] * fwd_Ea[258] * invT);
+    k_f = k_f_s[258];
     dlnkfdT = fwd_beta[258] * invT + activation_units[258] * fwd_Ea[258] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[49];
-    Kc = exp(g_RT[11] - g_RT[12] - g_RT[49] + g_RT[50]);
+    Kc = Kc_s[258];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[50]) + (h_RT[12] + h_RT[49]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39086,8 +37748,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[51];
-    k_f = prefactor_units[259] * fwd_A[259]
-                * exp(fwd_beta[259] * tc[0] - activation_units[259] * fwd_Ea[259] * invT);
+    k_f = k_f_s[259];
     dlnkfdT = fwd_beta[259] * invT + activation_units[259] * fwd_Ea[259] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -39110,8 +37771,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[51];
-    k_f = prefactor_units[260] * fwd_A[260]
-                * exp(fwd_beta[260] * tc[0] - activation_units[260] * fwd_Ea[260] * invT);
+    k_f = k_f_s[260];
     dlnkfdT = fwd_beta[260] * invT + activation_units[260] * fwd_Ea[260] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -39134,8 +37794,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[51];
-    k_f = prefactor_units[261] * fwd_A[261]
-                * exp(fwd_beta[261] * tc[0] - activation_units[261] * fwd_Ea[261] * invT);
+    k_f = k_f_s[261];
     dlnkfdT = fwd_beta[261] * invT + activation_units[261] * fwd_Ea[261] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -39171,8 +37830,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[51];
-    k_f = prefactor_units[262] * fwd_A[262]
-                * exp(fwd_beta[262] * tc[0] - activation_units[262] * fwd_Ea[262] * invT);
+    k_f = k_f_s[262];
     dlnkfdT = fwd_beta[262] * invT + activation_units[262] * fwd_Ea[262] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -39212,8 +37870,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[51];
-    k_f = prefactor_units[263] * fwd_A[263]
-                * exp(fwd_beta[263] * tc[0] - activation_units[263] * fwd_Ea[263] * invT);
+    k_f = k_f_s[263];
     dlnkfdT = fwd_beta[263] * invT + activation_units[263] * fwd_Ea[263] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -39253,8 +37910,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[51];
-    k_f = prefactor_units[264] * fwd_A[264]
-                * exp(fwd_beta[264] * tc[0] - activation_units[264] * fwd_Ea[264] * invT);
+    k_f = k_f_s[264];
     dlnkfdT = fwd_beta[264] * invT + activation_units[264] * fwd_Ea[264] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -39294,8 +37950,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[51];
-    k_f = prefactor_units[265] * fwd_A[265]
-                * exp(fwd_beta[265] * tc[0] - activation_units[265] * fwd_Ea[265] * invT);
+    k_f = k_f_s[265];
     dlnkfdT = fwd_beta[265] * invT + activation_units[265] * fwd_Ea[265] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -39335,8 +37990,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[51];
-    k_f = prefactor_units[266] * fwd_A[266]
-                * exp(fwd_beta[266] * tc[0] - activation_units[266] * fwd_Ea[266] * invT);
+    k_f = k_f_s[266];
     dlnkfdT = fwd_beta[266] * invT + activation_units[266] * fwd_Ea[266] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -39372,8 +38026,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[51];
-    k_f = prefactor_units[267] * fwd_A[267]
-                * exp(fwd_beta[267] * tc[0] - activation_units[267] * fwd_Ea[267] * invT);
+    k_f = k_f_s[267];
     dlnkfdT = fwd_beta[267] * invT + activation_units[267] * fwd_Ea[267] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -39413,8 +38066,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[51];
-    k_f = prefactor_units[268] * fwd_A[268]
-                * exp(fwd_beta[268] * tc[0] - activation_units[268] * fwd_Ea[268] * invT);
+    k_f = k_f_s[268];
     dlnkfdT = fwd_beta[268] * invT + activation_units[268] * fwd_Ea[268] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -39454,8 +38106,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[51];
-    k_f = prefactor_units[269] * fwd_A[269]
-                * exp(fwd_beta[269] * tc[0] - activation_units[269] * fwd_Ea[269] * invT);
+    k_f = k_f_s[269];
     dlnkfdT = fwd_beta[269] * invT + activation_units[269] * fwd_Ea[269] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -39495,8 +38146,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[51];
-    k_f = prefactor_units[270] * fwd_A[270]
-                * exp(fwd_beta[270] * tc[0] - activation_units[270] * fwd_Ea[270] * invT);
+    k_f = k_f_s[270];
     dlnkfdT = fwd_beta[270] * invT + activation_units[270] * fwd_Ea[270] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -39536,8 +38186,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[51];
-    k_f = prefactor_units[271] * fwd_A[271]
-                * exp(fwd_beta[271] * tc[0] - activation_units[271] * fwd_Ea[271] * invT);
+    k_f = k_f_s[271];
     dlnkfdT = fwd_beta[271] * invT + activation_units[271] * fwd_Ea[271] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -39573,8 +38222,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[51];
-    k_f = prefactor_units[272] * fwd_A[272]
-                * exp(fwd_beta[272] * tc[0] - activation_units[272] * fwd_Ea[272] * invT);
+    k_f = k_f_s[272];
     dlnkfdT = fwd_beta[272] * invT + activation_units[272] * fwd_Ea[272] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -39614,8 +38262,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[51];
-    k_f = prefactor_units[273] * fwd_A[273]
-                * exp(fwd_beta[273] * tc[0] - activation_units[273] * fwd_Ea[273] * invT);
+    k_f = k_f_s[273];
     dlnkfdT = fwd_beta[273] * invT + activation_units[273] * fwd_Ea[273] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -39655,8 +38302,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[51];
-    k_f = prefactor_units[274] * fwd_A[274]
-                * exp(fwd_beta[274] * tc[0] - activation_units[274] * fwd_Ea[274] * invT);
+    k_f = k_f_s[274];
     dlnkfdT = fwd_beta[274] * invT + activation_units[274] * fwd_Ea[274] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -39696,8 +38342,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[51];
-    k_f = prefactor_units[275] * fwd_A[275]
-                * exp(fwd_beta[275] * tc[0] - activation_units[275] * fwd_Ea[275] * invT);
+    k_f = k_f_s[275];
     dlnkfdT = fwd_beta[275] * invT + activation_units[275] * fwd_Ea[275] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -39737,8 +38382,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[51];
-    k_f = prefactor_units[276] * fwd_A[276]
-                * exp(fwd_beta[276] * tc[0] - activation_units[276] * fwd_Ea[276] * invT);
+    k_f = k_f_s[276];
     dlnkfdT = fwd_beta[276] * invT + activation_units[276] * fwd_Ea[276] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -39774,8 +38418,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[51];
-    k_f = prefactor_units[277] * fwd_A[277]
-                * exp(fwd_beta[277] * tc[0] - activation_units[277] * fwd_Ea[277] * invT);
+    k_f = k_f_s[277];
     dlnkfdT = fwd_beta[277] * invT + activation_units[277] * fwd_Ea[277] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -39815,8 +38458,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[51];
-    k_f = prefactor_units[278] * fwd_A[278]
-                * exp(fwd_beta[278] * tc[0] - activation_units[278] * fwd_Ea[278] * invT);
+    k_f = k_f_s[278];
     dlnkfdT = fwd_beta[278] * invT + activation_units[278] * fwd_Ea[278] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -39856,8 +38498,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[51];
-    k_f = prefactor_units[279] * fwd_A[279]
-                * exp(fwd_beta[279] * tc[0] - activation_units[279] * fwd_Ea[279] * invT);
+    k_f = k_f_s[279];
     dlnkfdT = fwd_beta[279] * invT + activation_units[279] * fwd_Ea[279] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -39897,8 +38538,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[51];
-    k_f = prefactor_units[280] * fwd_A[280]
-                * exp(fwd_beta[280] * tc[0] - activation_units[280] * fwd_Ea[280] * invT);
+    k_f = k_f_s[280];
     dlnkfdT = fwd_beta[280] * invT + activation_units[280] * fwd_Ea[280] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -39938,12 +38578,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[52];
-    k_f = prefactor_units[281] * fwd_A[281]
-                * exp(fwd_beta[281] * tc[0] - activation_units[281] * fwd_Ea[281] * invT);
+    k_f = k_f_s[281];
     dlnkfdT = fwd_beta[281] * invT + activation_units[281] * fwd_Ea[281] * invT2;
     /* reverse */
     phi_r = sc[23]*sc[50];
-    Kc = exp(g_RT[0] - g_RT[23] - g_RT[50] + g_RT[52]);
+    Kc = Kc_s[281];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[52]) + (h_RT[23] + h_RT[50]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39989,12 +38628,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[52];
-    k_f = prefactor_units[282] * fwd_A[282]
-                * exp(fwd_beta[282] * tc[0] - activation_units[282] * fwd_Ea[282] * invT);
+    k_f = k_f_s[282];
     dlnkfdT = fwd_beta[282] * invT + activation_units[282] * fwd_Ea[282] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[53];
-    Kc = exp(g_RT[0] - g_RT[4] + g_RT[52] - g_RT[53]);
+    Kc = Kc_s[282];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[52]) + (h_RT[4] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40040,12 +38678,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[54];
-    k_f = prefactor_units[283] * fwd_A[283]
-                * exp(fwd_beta[283] * tc[0] - activation_units[283] * fwd_Ea[283] * invT);
+    k_f = k_f_s[283];
     dlnkfdT = fwd_beta[283] * invT + activation_units[283] * fwd_Ea[283] * invT2;
     /* reverse */
     phi_r = sc[23]*sc[37];
-    Kc = exp(g_RT[0] - g_RT[23] - g_RT[37] + g_RT[54]);
+    Kc = Kc_s[283];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[54]) + (h_RT[23] + h_RT[37]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40091,12 +38728,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[54];
-    k_f = prefactor_units[284] * fwd_A[284]
-                * exp(fwd_beta[284] * tc[0] - activation_units[284] * fwd_Ea[284] * invT);
+    k_f = k_f_s[284];
     dlnkfdT = fwd_beta[284] * invT + activation_units[284] * fwd_Ea[284] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[23]*sc[34];
-    Kc = refC * exp(g_RT[0] - g_RT[4] - g_RT[23] - g_RT[34] + g_RT[54]);
+    Kc = Kc_s[284];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[54]) + (h_RT[4] + h_RT[23] + h_RT[34]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40155,12 +38791,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[53];
-    k_f = prefactor_units[285] * fwd_A[285]
-                * exp(fwd_beta[285] * tc[0] - activation_units[285] * fwd_Ea[285] * invT);
+    k_f = k_f_s[285];
     dlnkfdT = fwd_beta[285] * invT + activation_units[285] * fwd_Ea[285] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[23]*sc[34];
-    Kc = refC * exp(g_RT[0] - g_RT[11] - g_RT[23] - g_RT[34] + g_RT[53]);
+    Kc = Kc_s[285];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[53]) + (h_RT[11] + h_RT[23] + h_RT[34]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40219,8 +38854,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[53];
-    k_f = prefactor_units[286] * fwd_A[286]
-                * exp(fwd_beta[286] * tc[0] - activation_units[286] * fwd_Ea[286] * invT);
+    k_f = k_f_s[286];
     dlnkfdT = fwd_beta[286] * invT + activation_units[286] * fwd_Ea[286] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -40260,12 +38894,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[52];
-    k_f = prefactor_units[287] * fwd_A[287]
-                * exp(fwd_beta[287] * tc[0] - activation_units[287] * fwd_Ea[287] * invT);
+    k_f = k_f_s[287];
     dlnkfdT = fwd_beta[287] * invT + activation_units[287] * fwd_Ea[287] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[23]*sc[37];
-    Kc = refC * exp(g_RT[1] - g_RT[13] - g_RT[23] - g_RT[37] + g_RT[52]);
+    Kc = Kc_s[287];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[52]) + (h_RT[13] + h_RT[23] + h_RT[37]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40324,12 +38957,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[54];
-    k_f = prefactor_units[288] * fwd_A[288]
-                * exp(fwd_beta[288] * tc[0] - activation_units[288] * fwd_Ea[288] * invT);
+    k_f = k_f_s[288];
     dlnkfdT = fwd_beta[288] * invT + activation_units[288] * fwd_Ea[288] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[50];
-    Kc = exp(g_RT[1] - g_RT[13] - g_RT[50] + g_RT[54]);
+    Kc = Kc_s[288];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[54]) + (h_RT[13] + h_RT[50]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40383,6 +39015,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         dcvpRdT(dcRdT, tc);
         speciesInternalEnergy(e_RT, tc);
         eh_RT = &e_RT[0];
+        for (int k=0; k<56; k++) {
+            for (int m=0; m<56; m++) {
+                J[k*57+m] += Jmix[m];
+            }
+        }
     }
 
     double cmix = 0.0, ehmix = 0.0, dcmixdT=0.0, dehmixdT=0.0;
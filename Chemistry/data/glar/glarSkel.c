@@ -1,5 +1,6 @@
 
 #include <math.h>
+#include <float.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -86,7 +87,14 @@
 #define VCKPY VCKPY
 #define VCKWYR VCKWYR
 #define VCKYTX VCKYTX
+#define VCKCPBS VCKCPBS
+#define VCKCVBS VCKCVBS
+#define VCKHBMS VCKHBMS
+#define VCKUBMS VCKUBMS
+#define VCKRHOY VCKRHOY
+#define VCKMMWY VCKMMWY
 #define GET_T_GIVEN_EY GET_T_GIVEN_EY
+#define GET_T_GIVEN_HY GET_T_GIVEN_HY
 #define GET_REACTION_MAP GET_REACTION_MAP
 #elif defined(BL_FORT_USE_LOWERCASE)
 #define CKINDX ckindx
@@ -170,7 +178,14 @@
 #define VCKPY vckpy
 #define VCKWYR vckwyr
 #define VCKYTX vckytx
+#define VCKCPBS vckcpbs
+#define VCKCVBS vckcvbs
+#define VCKHBMS vckhbms
+#define VCKUBMS vckubms
+#define VCKRHOY vckrhoy
+#define VCKMMWY vckmmwy
 #define GET_T_GIVEN_EY get_t_given_ey
+#define GET_T_GIVEN_HY get_t_given_hy
 #define GET_REACTION_MAP get_reaction_map
 #elif defined(BL_FORT_USE_UNDERSCORE)
 #define CKINDX ckindx_
@@ -254,7 +269,14 @@
 #define VCKPY vckpy_
 #define VCKWYR vckwyr_
 #define VCKYTX vckytx_
+#define VCKCPBS vckcpbs_
+#define VCKCVBS vckcvbs_
+#define VCKHBMS vckhbms_
+#define VCKUBMS vckubms_
+#define VCKRHOY vckrhoy_
+#define VCKMMWY vckmmwy_
 #define GET_T_GIVEN_EY get_t_given_ey_
+#define GET_T_GIVEN_HY get_t_given_hy_
 #define GET_REACTION_MAP get_reaction_map_
 #endif
 
@@ -356,6 +378,7 @@ void DWDOT(double * restrict J, double * restrict sc, double * restrict T, int *
 void aJacobian(double * restrict J, double * restrict sc, double T, int consP);
 void dcvpRdT(double * restrict species, double * restrict tc);
 void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
+void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
 void GET_REACTION_MAP(int * restrict rmap);
 /*vector version */
 void vproductionRate(int npt, double * restrict wdot, double * restrict c, double * restrict T);
@@ -365,6 +388,12 @@ void VCKWYR(int * restrict np, double * restrict rho, double * restrict T,
             double * restrict y, int * restrict iwrk, double * restrict rwrk,
             double * restrict wdot);
 void VCKYTX(int * restrict np, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict x);
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs);
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs);
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms);
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms);
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho);
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm);
 void vcomp_k_f(int npt, double * restrict k_f_s, double * restrict tc, double * restrict invT);
 void vcomp_gibbs(int npt, double * restrict g_RT, double * restrict tc);
 void vcomp_Kc(int npt, double * restrict Kc_s, double * restrict g_RT, double * restrict invT);
@@ -1271,38 +1300,6 @@ void CKINDX(int * iwrk, double * restrict rwrk, int * mm, int * kk, int * ii, in
 }
 
 
-/* strtok_r: re-entrant (threadsafe) version of strtok, helper function for tokenizing strings  */
-char *strtok_r(char *s, const char *delim, char **save_ptr)
-{
-    char *token;
-
-    if (s == NULL)
-        s = *save_ptr;
-
-    /* Scan leading delimiters.  */
-    s += strspn (s, delim);
-    if (*s == '\0')
-    {
-        *save_ptr = s;
-        return NULL;
-    }
-
-    /* Find the end of the token.  */
-    token = s;
-    s = strpbrk (token, delim);
-    if (s == NULL)
-        /* This token finishes the string.  */
-        *save_ptr = __rawmemchr (token, '\0');
-    else
-    {
-        /* Terminate the token and make *SAVE_PTR point past it.  */
-        *s = '\0';
-        *save_ptr = s + 1;
-    }
-    return token;
-}
-
-
 
 /* ckxnum... for parsing strings  */
 void CKXNUM(char * line, int * nexp, int * lout, int * nval, double * restrict rval, int * kerr, int lenline )
@@ -1619,6 +1616,28 @@ void CKRHOY(double * restrict P, double * restrict T, double * restrict y, int *
 }
 
 
+/*Compute rho = P*W(y)/RT */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho)
+{
+    for (int i=0; i<(*np); i++) {
+        rho[i] = 0.0;
+    }
+
+    for (int n=0; n<15; n++) {
+        for (int i=0; i<(*np); i++) {
+            rho[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        rho[i] = P[i] / (8.31451e+07 * T[i] * rho[i]);/*rho = P*W/(R*T) */
+    }
+
+    return;
+}
+
+
 /*Compute rho = P*W(c)/(R*T) */
 void CKRHOC(double * restrict P, double * restrict T, double * restrict c, int * iwrk, double * restrict rwrk, double * restrict rho)
 {
@@ -1686,6 +1705,29 @@ void CKMMWY(double * restrict y, int * iwrk, double * restrict rwrk, double * re
 }
 
 
+/*given y[species]: mass fractions */
+/*returns mean molecular weight (gm/mole) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm)
+{
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 0.0;
+    }
+
+    for (int n=0; n<15; n++) {
+        for (int i=0; i<(*np); i++) {
+            wtm[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 1.0 / wtm[i];
+    }
+
+    return;
+}
+
+
 /*given x[species]: mole fractions */
 /*returns mean molecular weight (gm/mole) */
 void CKMMWX(double * restrict x, int * iwrk, double * restrict rwrk, double * restrict wtm)
@@ -2347,6 +2389,30 @@ void CKCPBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CP (Eq. 34) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs)
+{
+    double tc[5], tmp[15], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cp_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<15; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cpbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean specific heat at CV (Eq. 35) */
 void CKCVBL(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict cvbl)
 {
@@ -2395,6 +2461,30 @@ void CKCVBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CV (Eq. 36) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs)
+{
+    double tc[5], tmp[15], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cv_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<15; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cvbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean enthalpy of the mixture in molar units */
 void CKHBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict hbml)
 {
@@ -2436,6 +2526,30 @@ void CKHBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns mean enthalpy of mixture in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms)
+{
+    double tc[5], tmp[15], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesEnthalpy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<15; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        hbms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mean internal energy in molar units */
 void CKUBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict ubml)
 {
@@ -2486,6 +2600,30 @@ void CKUBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*get mean internal energy in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms)
+{
+    double tc[5], tmp[15], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesInternalEnergy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<15; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        ubms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mixture entropy in molar units */
 void CKSBML(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict sbml)
 {
@@ -4919,12 +5057,80 @@ void productionRate(double * restrict wdot, double * restrict sc, double T)
 
 void comp_k_f(double * restrict tc, double invT, double * restrict k_f)
 {
+    double x[58];
 #ifdef __INTEL_COMPILER
     #pragma simd
 #endif
     for (int i=0; i<58; ++i) {
-        k_f[i] = prefactor_units[i] * fwd_A[i]
-                    * exp(fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT);
+        x[i] = fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT;
+    };
+
+    /*the exp is skipped when the exponent is zero or that of */
+    /*an earlier reaction with the same default beta and Ea */
+    k_f[0] = exp(x[0]);
+    k_f[1] = (x[1] == x[0] ? k_f[0] : exp(x[1]));
+    k_f[2] = exp(x[2]);
+    k_f[3] = exp(x[3]);
+    k_f[4] = exp(x[4]);
+    k_f[5] = exp(x[5]);
+    k_f[6] = exp(x[6]);
+    k_f[7] = exp(x[7]);
+    k_f[8] = exp(x[8]);
+    k_f[9] = exp(x[9]);
+    k_f[10] = exp(x[10]);
+    k_f[11] = (x[11] == x[6] ? k_f[6] : exp(x[11]));
+    k_f[12] = (x[12] == x[5] ? k_f[5] : exp(x[12]));
+    k_f[13] = exp(x[13]);
+    k_f[14] = exp(x[14]);
+    k_f[15] = exp(x[15]);
+    k_f[16] = exp(x[16]);
+    k_f[17] = exp(x[17]);
+    k_f[18] = exp(x[18]);
+    k_f[19] = (x[19] == 0.0 ? 1.0 : exp(x[19]));
+    k_f[20] = exp(x[20]);
+    k_f[21] = exp(x[21]);
+    k_f[22] = (x[22] == x[6] ? k_f[6] : exp(x[22]));
+    k_f[23] = exp(x[23]);
+    k_f[24] = exp(x[24]);
+    k_f[25] = exp(x[25]);
+    k_f[26] = exp(x[26]);
+    k_f[27] = exp(x[27]);
+    k_f[28] = exp(x[28]);
+    k_f[29] = exp(x[29]);
+    k_f[30] = exp(x[30]);
+    k_f[31] = exp(x[31]);
+    k_f[32] = exp(x[32]);
+    k_f[33] = exp(x[33]);
+    k_f[34] = exp(x[34]);
+    k_f[35] = exp(x[35]);
+    k_f[36] = exp(x[36]);
+    k_f[37] = exp(x[37]);
+    k_f[38] = exp(x[38]);
+    k_f[39] = (x[39] == 0.0 ? 1.0 : exp(x[39]));
+    k_f[40] = (x[40] == 0.0 ? 1.0 : exp(x[40]));
+    k_f[41] = exp(x[41]);
+    k_f[42] = exp(x[42]);
+    k_f[43] = exp(x[43]);
+    k_f[44] = exp(x[44]);
+    k_f[45] = (x[45] == x[44] ? k_f[44] : exp(x[45]));
+    k_f[46] = (x[46] == 0.0 ? 1.0 : exp(x[46]));
+    k_f[47] = (x[47] == 0.0 ? 1.0 : exp(x[47]));
+    k_f[48] = exp(x[48]);
+    k_f[49] = (x[49] == 0.0 ? 1.0 : exp(x[49]));
+    k_f[50] = (x[50] == 0.0 ? 1.0 : exp(x[50]));
+    k_f[51] = (x[51] == 0.0 ? 1.0 : exp(x[51]));
+    k_f[52] = (x[52] == 0.0 ? 1.0 : exp(x[52]));
+    k_f[53] = (x[53] == 0.0 ? 1.0 : exp(x[53]));
+    k_f[54] = (x[54] == 0.0 ? 1.0 : exp(x[54]));
+    k_f[55] = (x[55] == 0.0 ? 1.0 : exp(x[55]));
+    k_f[56] = (x[56] == 0.0 ? 1.0 : exp(x[56]));
+    k_f[57] = (x[57] == 0.0 ? 1.0 : exp(x[57]));
+
+#ifdef __INTEL_COMPILER
+    #pragma simd
+#endif
+    for (int i=0; i<58; ++i) {
+        k_f[i] *= prefactor_units[i] * fwd_A[i];
     };
     return;
 }
@@ -4935,91 +5141,162 @@ void comp_Kc(double * restrict tc, double invT, double * restrict Kc)
     double g_RT[15];
     gibbs(g_RT, tc);
 
-    Kc[0] = g_RT[0] + g_RT[4] - g_RT[5];
-    Kc[1] = g_RT[0] + g_RT[4] - g_RT[5];
-    Kc[2] = -g_RT[2] - g_RT[2] + g_RT[7];
-    Kc[3] = g_RT[1] + g_RT[8] - g_RT[9];
-    Kc[4] = -g_RT[1] + g_RT[10] - g_RT[14];
-    Kc[5] = g_RT[0] + g_RT[0] - g_RT[3];
-    Kc[6] = g_RT[0] + g_RT[1] - g_RT[2];
-    Kc[7] = g_RT[1] + g_RT[1] - g_RT[4];
-    Kc[8] = g_RT[0] + g_RT[2] - g_RT[6];
-    Kc[9] = g_RT[0] - g_RT[1] - g_RT[2] + g_RT[4];
-    Kc[10] = g_RT[0] + g_RT[0] - g_RT[3] + g_RT[14] - g_RT[14];
-    Kc[11] = g_RT[0] + g_RT[0] + g_RT[3] - g_RT[3] - g_RT[3];
-    Kc[12] = g_RT[0] + g_RT[0] - g_RT[3] + g_RT[6] - g_RT[6];
-    Kc[13] = -g_RT[0] + g_RT[1] - g_RT[2] + g_RT[3];
-    Kc[14] = -g_RT[0] + g_RT[1] - g_RT[2] + g_RT[3];
-    Kc[15] = -g_RT[1] + g_RT[2] + g_RT[2] - g_RT[6];
-    Kc[16] = -g_RT[0] + g_RT[2] + g_RT[3] - g_RT[6];
-    Kc[17] = -g_RT[0] + g_RT[3] + g_RT[4] - g_RT[5];
-    Kc[18] = g_RT[0] - g_RT[2] - g_RT[2] + g_RT[5];
-    Kc[19] = g_RT[0] - g_RT[1] + g_RT[5] - g_RT[6];
-    Kc[20] = g_RT[1] - g_RT[2] - g_RT[4] + g_RT[5];
-    Kc[21] = g_RT[2] - g_RT[4] + g_RT[5] - g_RT[6];
-    Kc[22] = g_RT[2] - g_RT[4] + g_RT[5] - g_RT[6];
-    Kc[23] = g_RT[2] - g_RT[4] + g_RT[5] - g_RT[6];
-    Kc[24] = -g_RT[4] + g_RT[5] + g_RT[5] - g_RT[7];
-    Kc[25] = -g_RT[4] + g_RT[5] + g_RT[5] - g_RT[7];
-    Kc[26] = g_RT[0] - g_RT[2] - g_RT[6] + g_RT[7];
-    Kc[27] = g_RT[0] - g_RT[3] - g_RT[5] + g_RT[7];
-    Kc[28] = g_RT[1] - g_RT[2] - g_RT[5] + g_RT[7];
-    Kc[29] = g_RT[2] - g_RT[5] - g_RT[6] + g_RT[7];
-    Kc[30] = g_RT[2] - g_RT[5] - g_RT[6] + g_RT[7];
-    Kc[31] = -g_RT[2] + g_RT[5] + g_RT[8] - g_RT[9];
-    Kc[32] = g_RT[0] - g_RT[2] - g_RT[8] + g_RT[9];
-    Kc[33] = g_RT[1] - g_RT[4] - g_RT[8] + g_RT[9];
-    Kc[34] = -g_RT[4] - g_RT[8] - g_RT[8] + g_RT[9] + g_RT[9];
-    Kc[35] = g_RT[0] - g_RT[2] + g_RT[10] - g_RT[14];
-    Kc[36] = g_RT[0] - g_RT[2] + g_RT[10] - g_RT[14];
-    Kc[37] = g_RT[1] - g_RT[8] - g_RT[8] + g_RT[10];
-    Kc[38] = g_RT[1] - g_RT[4] + g_RT[10] - g_RT[14];
-    Kc[39] = g_RT[0] - g_RT[3] + g_RT[11] - g_RT[12];
-    Kc[40] = -g_RT[0] + g_RT[1] - g_RT[8] + g_RT[11];
-    Kc[41] = g_RT[2] - g_RT[6] + g_RT[11] - g_RT[12];
-    Kc[42] = -g_RT[2] + g_RT[4] - g_RT[8] + g_RT[11];
-    Kc[43] = -g_RT[0] + g_RT[8] - g_RT[10] + g_RT[11];
-    Kc[44] = -g_RT[0] + g_RT[8] - g_RT[10] + g_RT[11];
-    Kc[45] = -g_RT[2] + g_RT[8] + g_RT[11] - g_RT[14];
-    Kc[46] = -g_RT[2] + g_RT[9] - g_RT[10] + g_RT[11];
-    Kc[47] = -g_RT[0] + g_RT[2] - g_RT[8] + g_RT[12];
-    Kc[48] = -g_RT[1] + g_RT[4] - g_RT[8] + g_RT[12];
-    Kc[49] = -g_RT[1] + g_RT[8] + g_RT[12] - g_RT[14];
-    Kc[50] = -g_RT[0] + g_RT[13] - g_RT[14];
-    Kc[51] = g_RT[0] - g_RT[3] + g_RT[13] - g_RT[14];
-    Kc[52] = -g_RT[0] + g_RT[1] - g_RT[10] + g_RT[13];
-    Kc[53] = g_RT[1] - g_RT[2] + g_RT[13] - g_RT[14];
-    Kc[54] = g_RT[1] - g_RT[8] - g_RT[11] + g_RT[13];
-    Kc[55] = g_RT[2] - g_RT[6] + g_RT[13] - g_RT[14];
-    Kc[56] = g_RT[4] - g_RT[5] + g_RT[13] - g_RT[14];
-    Kc[57] = -g_RT[0] + g_RT[4] - g_RT[4] + g_RT[13] - g_RT[14];
-
-#ifdef __INTEL_COMPILER
-     #pragma simd
-#endif
-    for (int i=0; i<58; ++i) {
-        Kc[i] = exp(Kc[i]);
-    };
-
     /*reference concentration: P_atm / (RT) in inverse mol/m^3 */
     double refC = 101325 / 8.31451 * invT;
     double refCinv = 1 / refC;
 
-    Kc[0] *= refCinv;
-    Kc[1] *= refCinv;
-    Kc[2] *= refC;
-    Kc[3] *= refCinv;
-    Kc[4] *= refC;
-    Kc[5] *= refCinv;
-    Kc[6] *= refCinv;
-    Kc[7] *= refCinv;
-    Kc[8] *= refCinv;
-    Kc[10] *= refCinv;
-    Kc[11] *= refCinv;
-    Kc[12] *= refCinv;
-    Kc[34] *= refC;
-    Kc[50] *= refC;
-    Kc[57] *= refC;
+    /*Kc as the ratio of the products of the species exp(g_RT)/refC, unless */
+    /*the product over a side of a reaction leaves the normal range */
+    double e_g[15], den[58];
+    for (int k=0; k<15; ++k) {
+        e_g[k] = exp(g_RT[k]) * refCinv;
+    }
+    Kc[0] = e_g[0]*e_g[4]; den[0] = e_g[5];
+    Kc[1] = e_g[0]*e_g[4]; den[1] = e_g[5];
+    Kc[2] = e_g[7]; den[2] = e_g[2]*e_g[2];
+    Kc[3] = e_g[1]*e_g[8]; den[3] = e_g[9];
+    Kc[4] = e_g[10]; den[4] = e_g[1]*e_g[14];
+    Kc[5] = e_g[0]*e_g[0]; den[5] = e_g[3];
+    Kc[6] = e_g[0]*e_g[1]; den[6] = e_g[2];
+    Kc[7] = e_g[1]*e_g[1]; den[7] = e_g[4];
+    Kc[8] = e_g[0]*e_g[2]; den[8] = e_g[6];
+    Kc[9] = e_g[0]*e_g[4]; den[9] = e_g[1]*e_g[2];
+    Kc[10] = e_g[0]*e_g[0]*e_g[14]; den[10] = e_g[3]*e_g[14];
+    Kc[11] = e_g[0]*e_g[0]*e_g[3]; den[11] = e_g[3]*e_g[3];
+    Kc[12] = e_g[0]*e_g[0]*e_g[6]; den[12] = e_g[3]*e_g[6];
+    Kc[13] = e_g[1]*e_g[3]; den[13] = e_g[0]*e_g[2];
+    Kc[14] = e_g[1]*e_g[3]; den[14] = e_g[0]*e_g[2];
+    Kc[15] = e_g[2]*e_g[2]; den[15] = e_g[1]*e_g[6];
+    Kc[16] = e_g[2]*e_g[3]; den[16] = e_g[0]*e_g[6];
+    Kc[17] = e_g[3]*e_g[4]; den[17] = e_g[0]*e_g[5];
+    Kc[18] = e_g[0]*e_g[5]; den[18] = e_g[2]*e_g[2];
+    Kc[19] = e_g[0]*e_g[5]; den[19] = e_g[1]*e_g[6];
+    Kc[20] = e_g[1]*e_g[5]; den[20] = e_g[2]*e_g[4];
+    Kc[21] = e_g[2]*e_g[5]; den[21] = e_g[4]*e_g[6];
+    Kc[22] = e_g[2]*e_g[5]; den[22] = e_g[4]*e_g[6];
+    Kc[23] = e_g[2]*e_g[5]; den[23] = e_g[4]*e_g[6];
+    Kc[24] = e_g[5]*e_g[5]; den[24] = e_g[4]*e_g[7];
+    Kc[25] = e_g[5]*e_g[5]; den[25] = e_g[4]*e_g[7];
+    Kc[26] = e_g[0]*e_g[7]; den[26] = e_g[2]*e_g[6];
+    Kc[27] = e_g[0]*e_g[7]; den[27] = e_g[3]*e_g[5];
+    Kc[28] = e_g[1]*e_g[7]; den[28] = e_g[2]*e_g[5];
+    Kc[29] = e_g[2]*e_g[7]; den[29] = e_g[5]*e_g[6];
+    Kc[30] = e_g[2]*e_g[7]; den[30] = e_g[5]*e_g[6];
+    Kc[31] = e_g[5]*e_g[8]; den[31] = e_g[2]*e_g[9];
+    Kc[32] = e_g[0]*e_g[9]; den[32] = e_g[2]*e_g[8];
+    Kc[33] = e_g[1]*e_g[9]; den[33] = e_g[4]*e_g[8];
+    Kc[34] = e_g[9]*e_g[9]; den[34] = e_g[4]*e_g[8]*e_g[8];
+    Kc[35] = e_g[0]*e_g[10]; den[35] = e_g[2]*e_g[14];
+    Kc[36] = e_g[0]*e_g[10]; den[36] = e_g[2]*e_g[14];
+    Kc[37] = e_g[1]*e_g[10]; den[37] = e_g[8]*e_g[8];
+    Kc[38] = e_g[1]*e_g[10]; den[38] = e_g[4]*e_g[14];
+    Kc[39] = e_g[0]*e_g[11]; den[39] = e_g[3]*e_g[12];
+    Kc[40] = e_g[1]*e_g[11]; den[40] = e_g[0]*e_g[8];
+    Kc[41] = e_g[2]*e_g[11]; den[41] = e_g[6]*e_g[12];
+    Kc[42] = e_g[4]*e_g[11]; den[42] = e_g[2]*e_g[8];
+    Kc[43] = e_g[8]*e_g[11]; den[43] = e_g[0]*e_g[10];
+    Kc[44] = e_g[8]*e_g[11]; den[44] = e_g[0]*e_g[10];
+    Kc[45] = e_g[8]*e_g[11]; den[45] = e_g[2]*e_g[14];
+    Kc[46] = e_g[9]*e_g[11]; den[46] = e_g[2]*e_g[10];
+    Kc[47] = e_g[2]*e_g[12]; den[47] = e_g[0]*e_g[8];
+    Kc[48] = e_g[4]*e_g[12]; den[48] = e_g[1]*e_g[8];
+    Kc[49] = e_g[8]*e_g[12]; den[49] = e_g[1]*e_g[14];
+    Kc[50] = e_g[13]; den[50] = e_g[0]*e_g[14];
+    Kc[51] = e_g[0]*e_g[13]; den[51] = e_g[3]*e_g[14];
+    Kc[52] = e_g[1]*e_g[13]; den[52] = e_g[0]*e_g[10];
+    Kc[53] = e_g[1]*e_g[13]; den[53] = e_g[2]*e_g[14];
+    Kc[54] = e_g[1]*e_g[13]; den[54] = e_g[8]*e_g[11];
+    Kc[55] = e_g[2]*e_g[13]; den[55] = e_g[6]*e_g[14];
+    Kc[56] = e_g[4]*e_g[13]; den[56] = e_g[5]*e_g[14];
+    Kc[57] = e_g[4]*e_g[13]; den[57] = e_g[0]*e_g[4]*e_g[14];
+    int inrange = 1;
+    for (int i=0; i<58; ++i) {
+        inrange &= Kc[i] >= DBL_MIN && Kc[i] <= DBL_MAX && den[i] >= DBL_MIN && den[i] <= DBL_MAX;
+    }
+
+    if (inrange) {
+        for (int i=0; i<58; ++i) {
+            Kc[i] /= den[i];
+        }
+    }
+    else {
+        Kc[0] = exp(g_RT[0] + g_RT[4] - g_RT[5]);
+        Kc[2] = exp(-g_RT[2] - g_RT[2] + g_RT[7]);
+        Kc[3] = exp(g_RT[1] + g_RT[8] - g_RT[9]);
+        Kc[4] = exp(-g_RT[1] + g_RT[10] - g_RT[14]);
+        Kc[5] = exp(g_RT[0] + g_RT[0] - g_RT[3]);
+        Kc[6] = exp(g_RT[0] + g_RT[1] - g_RT[2]);
+        Kc[7] = exp(g_RT[1] + g_RT[1] - g_RT[4]);
+        Kc[8] = exp(g_RT[0] + g_RT[2] - g_RT[6]);
+        Kc[9] = exp(g_RT[0] - g_RT[1] - g_RT[2] + g_RT[4]);
+        Kc[10] = exp(g_RT[0] + g_RT[0] - g_RT[3] + g_RT[14] - g_RT[14]);
+        Kc[11] = exp(g_RT[0] + g_RT[0] + g_RT[3] - g_RT[3] - g_RT[3]);
+        Kc[12] = exp(g_RT[0] + g_RT[0] - g_RT[3] + g_RT[6] - g_RT[6]);
+        Kc[13] = exp(-g_RT[0] + g_RT[1] - g_RT[2] + g_RT[3]);
+        Kc[15] = exp(-g_RT[1] + g_RT[2] + g_RT[2] - g_RT[6]);
+        Kc[16] = exp(-g_RT[0] + g_RT[2] + g_RT[3] - g_RT[6]);
+        Kc[17] = exp(-g_RT[0] + g_RT[3] + g_RT[4] - g_RT[5]);
+        Kc[18] = exp(g_RT[0] - g_RT[2] - g_RT[2] + g_RT[5]);
+        Kc[19] = exp(g_RT[0] - g_RT[1] + g_RT[5] - g_RT[6]);
+        Kc[20] = exp(g_RT[1] - g_RT[2] - g_RT[4] + g_RT[5]);
+        Kc[21] = exp(g_RT[2] - g_RT[4] + g_RT[5] - g_RT[6]);
+        Kc[24] = exp(-g_RT[4] + g_RT[5] + g_RT[5] - g_RT[7]);
+        Kc[26] = exp(g_RT[0] - g_RT[2] - g_RT[6] + g_RT[7]);
+        Kc[27] = exp(g_RT[0] - g_RT[3] - g_RT[5] + g_RT[7]);
+        Kc[28] = exp(g_RT[1] - g_RT[2] - g_RT[5] + g_RT[7]);
+        Kc[29] = exp(g_RT[2] - g_RT[5] - g_RT[6] + g_RT[7]);
+        Kc[31] = exp(-g_RT[2] + g_RT[5] + g_RT[8] - g_RT[9]);
+        Kc[32] = exp(g_RT[0] - g_RT[2] - g_RT[8] + g_RT[9]);
+        Kc[33] = exp(g_RT[1] - g_RT[4] - g_RT[8] + g_RT[9]);
+        Kc[34] = exp(-g_RT[4] - g_RT[8] - g_RT[8] + g_RT[9] + g_RT[9]);
+        Kc[35] = exp(g_RT[0] - g_RT[2] + g_RT[10] - g_RT[14]);
+        Kc[37] = exp(g_RT[1] - g_RT[8] - g_RT[8] + g_RT[10]);
+        Kc[38] = exp(g_RT[1] - g_RT[4] + g_RT[10] - g_RT[14]);
+        Kc[39] = exp(g_RT[0] - g_RT[3] + g_RT[11] - g_RT[12]);
+        Kc[40] = exp(-g_RT[0] + g_RT[1] - g_RT[8] + g_RT[11]);
+        Kc[41] = exp(g_RT[2] - g_RT[6] + g_RT[11] - g_RT[12]);
+        Kc[42] = exp(-g_RT[2] + g_RT[4] - g_RT[8] + g_RT[11]);
+        Kc[43] = exp(-g_RT[0] + g_RT[8] - g_RT[10] + g_RT[11]);
+        Kc[45] = exp(-g_RT[2] + g_RT[8] + g_RT[11] - g_RT[14]);
+        Kc[46] = exp(-g_RT[2] + g_RT[9] - g_RT[10] + g_RT[11]);
+        Kc[47] = exp(-g_RT[0] + g_RT[2] - g_RT[8] + g_RT[12]);
+        Kc[48] = exp(-g_RT[1] + g_RT[4] - g_RT[8] + g_RT[12]);
+        Kc[49] = exp(-g_RT[1] + g_RT[8] + g_RT[12] - g_RT[14]);
+        Kc[50] = exp(-g_RT[0] + g_RT[13] - g_RT[14]);
+        Kc[51] = exp(g_RT[0] - g_RT[3] + g_RT[13] - g_RT[14]);
+        Kc[52] = exp(-g_RT[0] + g_RT[1] - g_RT[10] + g_RT[13]);
+        Kc[53] = exp(g_RT[1] - g_RT[2] + g_RT[13] - g_RT[14]);
+        Kc[54] = exp(g_RT[1] - g_RT[8] - g_RT[11] + g_RT[13]);
+        Kc[55] = exp(g_RT[2] - g_RT[6] + g_RT[13] - g_RT[14]);
+        Kc[56] = exp(g_RT[4] - g_RT[5] + g_RT[13] - g_RT[14]);
+        Kc[57] = exp(-g_RT[0] + g_RT[4] - g_RT[4] + g_RT[13] - g_RT[14]);
+
+        /*reactions with the net stoichiometry of an earlier one */
+        Kc[1] = Kc[0];
+        Kc[14] = Kc[13];
+        Kc[22] = Kc[21];
+        Kc[23] = Kc[21];
+        Kc[25] = Kc[24];
+        Kc[30] = Kc[29];
+        Kc[36] = Kc[35];
+        Kc[44] = Kc[43];
+
+        Kc[0] *= refCinv;
+        Kc[1] *= refCinv;
+        Kc[2] *= refC;
+        Kc[3] *= refCinv;
+        Kc[4] *= refC;
+        Kc[5] *= refCinv;
+        Kc[6] *= refCinv;
+        Kc[7] *= refCinv;
+        Kc[8] *= refCinv;
+        Kc[10] *= refCinv;
+        Kc[11] *= refCinv;
+        Kc[12] *= refCinv;
+        Kc[34] *= refC;
+        Kc[50] *= refC;
+        Kc[57] *= refC;
+    }
 
     return;
 }
@@ -6489,17 +6766,24 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         mixture += sc[k];
     }
 
-    /*compute the Gibbs free energy */
-    double g_RT[15];
-    gibbs(g_RT, tc);
-
     /*compute the species enthalpy */
     double h_RT[15];
     speciesEnthalpy(h_RT, tc);
 
+    /*compute the rate and equilibrium constants */
+    double k_f_s[58], Kc_s[58];
+    comp_k_f(tc, invT, k_f_s);
+    comp_Kc(tc, invT, Kc_s);
+
+    /*at constant volume, the part of dwdot/d[X] common to all species */
+    double Jmix[15];
+    for (int k=0; k<15; k++) {
+        Jmix[k] = 0.0;
+    }
+
     double phi_f, k_f, k_r, phi_r, Kc, q, q_nocor, Corr, alpha;
     double dlnkfdT, dlnk0dT, dlnKcdT, dkrdT, dqdT;
-    double dqdci, dcdc_fac, dqdc[15];
+    double dqdci, dcdc_fac;
     double Pr, fPr, F, k_0, logPr;
     double logFcent, troe_c, troe_n, troePr_den, troePr, troe;
     double Fcent1, Fcent2, Fcent3, Fcent;
@@ -6507,6 +6791,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     double dlogPrdT, dlogfPrdT, dlogFdT, dlogFcentdT, dlogFdlogPr, dlnCorrdT;
     const double ln10 = log(10.0);
     const double log10e = 1.0/log(10.0);
+
     /*reaction 1: H + O2 (+M) <=> HO2 (+M) */
     /*a pressure-fall-off reaction */
     /* also 3-body */
@@ -6514,8 +6799,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[0][0] - 1)*sc[14] + (TB[0][1] - 1)*sc[6] + (TB[0][2] - 1)*sc[3] + (TB[0][3] - 1)*sc[4];
     /* forward */
     phi_f = sc[0]*sc[4];
-    k_f = prefactor_units[0] * fwd_A[0]
-                * exp(fwd_beta[0] * tc[0] - activation_units[0] * fwd_Ea[0] * invT);
+    k_f = k_f_s[0];
     dlnkfdT = fwd_beta[0] * invT + activation_units[0] * fwd_Ea[0] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[0] * exp(low_beta[0] * tc[0] - activation_units[0] * low_Ea[0] * invT);
@@ -6531,16 +6815,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[0] == 4 ? exp(-troe_Tss[0] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
+      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
+      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
-      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
-      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -6548,7 +6832,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[5];
-    Kc = refCinv * exp(g_RT[0] + g_RT[4] - g_RT[5]);
+    Kc = Kc_s[0];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[4]) + (h_RT[5]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6566,60 +6850,40 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[4];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[4] -= dqdci;                /* dwdot[O2]/d[H] */
-        J[5] += dqdci;                /* dwdot[HO2]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[0][2] - 1)*dcdc_fac;
-        J[48] -= dqdci;               /* dwdot[H]/d[H2] */
-        J[52] -= dqdci;               /* dwdot[O2]/d[H2] */
-        J[53] += dqdci;               /* dwdot[HO2]/d[H2] */
-        /* d()/d[O2] */
-        dqdci = (TB[0][3] - 1)*dcdc_fac + k_f*sc[0];
-        J[64] -= dqdci;               /* dwdot[H]/d[O2] */
-        J[68] -= dqdci;               /* dwdot[O2]/d[O2] */
-        J[69] += dqdci;               /* dwdot[HO2]/d[O2] */
-        /* d()/d[HO2] */
-        dqdci =  - k_r;
-        J[80] -= dqdci;               /* dwdot[H]/d[HO2] */
-        J[84] -= dqdci;               /* dwdot[O2]/d[HO2] */
-        J[85] += dqdci;               /* dwdot[HO2]/d[HO2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[0][1] - 1)*dcdc_fac;
-        J[96] -= dqdci;               /* dwdot[H]/d[H2O] */
-        J[100] -= dqdci;              /* dwdot[O2]/d[H2O] */
-        J[101] += dqdci;              /* dwdot[HO2]/d[H2O] */
-        /* d()/d[N2] */
-        dqdci = (TB[0][0] - 1)*dcdc_fac;
-        J[224] -= dqdci;              /* dwdot[H]/d[N2] */
-        J[228] -= dqdci;              /* dwdot[O2]/d[N2] */
-        J[229] += dqdci;              /* dwdot[HO2]/d[N2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[4];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = TB[0][2]*dcdc_fac;
-        dqdc[4] = TB[0][3]*dcdc_fac + k_f*sc[0];
-        dqdc[5] = dcdc_fac - k_r;
-        dqdc[6] = TB[0][1]*dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = TB[0][0]*dcdc_fac;
-        for (int k=0; k<15; k++) {
-            J[16*k+0] -= dqdc[k];
-            J[16*k+4] -= dqdc[k];
-            J[16*k+5] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[4] -= dcdc_fac;
+    Jmix[5] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[4];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[4] -= dqdci;                /* dwdot[O2]/d[H] */
+    J[5] += dqdci;                /* dwdot[HO2]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[0][2] - 1)*dcdc_fac;
+    J[48] -= dqdci;               /* dwdot[H]/d[H2] */
+    J[52] -= dqdci;               /* dwdot[O2]/d[H2] */
+    J[53] += dqdci;               /* dwdot[HO2]/d[H2] */
+    /* d()/d[O2] */
+    dqdci = (TB[0][3] - 1)*dcdc_fac + k_f*sc[0];
+    J[64] -= dqdci;               /* dwdot[H]/d[O2] */
+    J[68] -= dqdci;               /* dwdot[O2]/d[O2] */
+    J[69] += dqdci;               /* dwdot[HO2]/d[O2] */
+    /* d()/d[HO2] */
+    dqdci =  - k_r;
+    J[80] -= dqdci;               /* dwdot[H]/d[HO2] */
+    J[84] -= dqdci;               /* dwdot[O2]/d[HO2] */
+    J[85] += dqdci;               /* dwdot[HO2]/d[HO2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[0][1] - 1)*dcdc_fac;
+    J[96] -= dqdci;               /* dwdot[H]/d[H2O] */
+    J[100] -= dqdci;              /* dwdot[O2]/d[H2O] */
+    J[101] += dqdci;              /* dwdot[HO2]/d[H2O] */
+    /* d()/d[N2] */
+    dqdci = (TB[0][0] - 1)*dcdc_fac;
+    J[224] -= dqdci;              /* dwdot[H]/d[N2] */
+    J[228] -= dqdci;              /* dwdot[O2]/d[N2] */
+    J[229] += dqdci;              /* dwdot[HO2]/d[N2] */
     J[240] -= dqdT; /* dwdot[H]/dT */
     J[244] -= dqdT; /* dwdot[O2]/dT */
     J[245] += dqdT; /* dwdot[HO2]/dT */
@@ -6631,8 +6895,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = sc[14];
     /* forward */
     phi_f = sc[0]*sc[4];
-    k_f = prefactor_units[1] * fwd_A[1]
-                * exp(fwd_beta[1] * tc[0] - activation_units[1] * fwd_Ea[1] * invT);
+    k_f = k_f_s[1];
     dlnkfdT = fwd_beta[1] * invT + activation_units[1] * fwd_Ea[1] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[1] * exp(low_beta[1] * tc[0] - activation_units[1] * low_Ea[1] * invT);
@@ -6648,16 +6911,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[1] == 4 ? exp(-troe_Tss[1] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
+      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
+      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
-      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
-      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -6665,7 +6928,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[5];
-    Kc = refCinv * exp(g_RT[0] + g_RT[4] - g_RT[5]);
+    Kc = Kc_s[1];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[4]) + (h_RT[5]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6683,50 +6946,26 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[4];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[4] -= dqdci;                /* dwdot[O2]/d[H] */
-        J[5] += dqdci;                /* dwdot[HO2]/d[H] */
-        /* d()/d[O2] */
-        dqdci =  + k_f*sc[0];
-        J[64] -= dqdci;               /* dwdot[H]/d[O2] */
-        J[68] -= dqdci;               /* dwdot[O2]/d[O2] */
-        J[69] += dqdci;               /* dwdot[HO2]/d[O2] */
-        /* d()/d[HO2] */
-        dqdci =  - k_r;
-        J[80] -= dqdci;               /* dwdot[H]/d[HO2] */
-        J[84] -= dqdci;               /* dwdot[O2]/d[HO2] */
-        J[85] += dqdci;               /* dwdot[HO2]/d[HO2] */
-        /* d()/d[N2] */
-        dqdci = dcdc_fac;
-        J[224] -= dqdci;              /* dwdot[H]/d[N2] */
-        J[228] -= dqdci;              /* dwdot[O2]/d[N2] */
-        J[229] += dqdci;              /* dwdot[HO2]/d[N2] */
-    }
-    else {
-        dqdc[0] = 0*q_nocor + k_f*sc[4];
-        dqdc[1] = 0*q_nocor;
-        dqdc[2] = 0*q_nocor;
-        dqdc[3] = 0*q_nocor;
-        dqdc[4] = 0*q_nocor + k_f*sc[0];
-        dqdc[5] = 0*q_nocor - k_r;
-        dqdc[6] = 0*q_nocor;
-        dqdc[7] = 0*q_nocor;
-        dqdc[8] = 0*q_nocor;
-        dqdc[9] = 0*q_nocor;
-        dqdc[10] = 0*q_nocor;
-        dqdc[11] = 0*q_nocor;
-        dqdc[12] = 0*q_nocor;
-        dqdc[13] = 0*q_nocor;
-        dqdc[14] = dcdc_fac;
-        for (int k=0; k<15; k++) {
-            J[16*k+0] -= dqdc[k];
-            J[16*k+4] -= dqdc[k];
-            J[16*k+5] += dqdc[k];
-        }
-    }
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[4];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[4] -= dqdci;                /* dwdot[O2]/d[H] */
+    J[5] += dqdci;                /* dwdot[HO2]/d[H] */
+    /* d()/d[O2] */
+    dqdci =  + k_f*sc[0];
+    J[64] -= dqdci;               /* dwdot[H]/d[O2] */
+    J[68] -= dqdci;               /* dwdot[O2]/d[O2] */
+    J[69] += dqdci;               /* dwdot[HO2]/d[O2] */
+    /* d()/d[HO2] */
+    dqdci =  - k_r;
+    J[80] -= dqdci;               /* dwdot[H]/d[HO2] */
+    J[84] -= dqdci;               /* dwdot[O2]/d[HO2] */
+    J[85] += dqdci;               /* dwdot[HO2]/d[HO2] */
+    /* d()/d[N2] */
+    dqdci = dcdc_fac;
+    J[224] -= dqdci;              /* dwdot[H]/d[N2] */
+    J[228] -= dqdci;              /* dwdot[O2]/d[N2] */
+    J[229] += dqdci;              /* dwdot[HO2]/d[N2] */
     J[240] -= dqdT; /* dwdot[H]/dT */
     J[244] -= dqdT; /* dwdot[O2]/dT */
     J[245] += dqdT; /* dwdot[HO2]/dT */
@@ -6738,8 +6977,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[2][0] - 1)*sc[6] + (TB[2][1] - 1)*sc[3];
     /* forward */
     phi_f = sc[7];
-    k_f = prefactor_units[2] * fwd_A[2]
-                * exp(fwd_beta[2] * tc[0] - activation_units[2] * fwd_Ea[2] * invT);
+    k_f = k_f_s[2];
     dlnkfdT = fwd_beta[2] * invT + activation_units[2] * fwd_Ea[2] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[2] * exp(low_beta[2] * tc[0] - activation_units[2] * low_Ea[2] * invT);
@@ -6755,16 +6993,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[2] == 4 ? exp(-troe_Tss[2] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[2]) > 1.e-100 ? -Fcent1/troe_Tsss[2] : 0.)
+      + (fabs(troe_Ts[2]) > 1.e-100 ? -Fcent2/troe_Ts[2] : 0.)
+      + (troe_len[2] == 4 ? Fcent3*troe_Tss[2]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[2]) > 1.e-100 ? -Fcent1/troe_Tsss[2] : 0.)
-      + (fabs(troe_Ts[2]) > 1.e-100 ? -Fcent2/troe_Ts[2] : 0.)
-      + (troe_len[2] == 4 ? Fcent3*troe_Tss[2]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -6772,7 +7010,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[2]*sc[2];
-    Kc = refC * exp(-g_RT[2] - g_RT[2] + g_RT[7]);
+    Kc = Kc_s[2];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7]) + (2*h_RT[2]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6789,45 +7027,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[OH] */
-        dqdci =  - k_r*2*sc[2];
-        J[34] += 2 * dqdci;           /* dwdot[OH]/d[OH] */
-        J[39] -= dqdci;               /* dwdot[H2O2]/d[OH] */
-        /* d()/d[H2] */
-        dqdci = (TB[2][1] - 1)*dcdc_fac;
-        J[50] += 2 * dqdci;           /* dwdot[OH]/d[H2] */
-        J[55] -= dqdci;               /* dwdot[H2O2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[2][0] - 1)*dcdc_fac;
-        J[98] += 2 * dqdci;           /* dwdot[OH]/d[H2O] */
-        J[103] -= dqdci;              /* dwdot[H2O2]/d[H2O] */
-        /* d()/d[H2O2] */
-        dqdci =  + k_f;
-        J[114] += 2 * dqdci;          /* dwdot[OH]/d[H2O2] */
-        J[119] -= dqdci;              /* dwdot[H2O2]/d[H2O2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac - k_r*2*sc[2];
-        dqdc[3] = TB[2][1]*dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = TB[2][0]*dcdc_fac;
-        dqdc[7] = dcdc_fac + k_f;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        for (int k=0; k<15; k++) {
-            J[16*k+2] += 2 * dqdc[k];
-            J[16*k+7] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] += 2 * dcdc_fac;
+    Jmix[7] -= dcdc_fac;
+    /* d()/d[OH] */
+    dqdci =  - k_r*2*sc[2];
+    J[34] += 2 * dqdci;           /* dwdot[OH]/d[OH] */
+    J[39] -= dqdci;               /* dwdot[H2O2]/d[OH] */
+    /* d()/d[H2] */
+    dqdci = (TB[2][1] - 1)*dcdc_fac;
+    J[50] += 2 * dqdci;           /* dwdot[OH]/d[H2] */
+    J[55] -= dqdci;               /* dwdot[H2O2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[2][0] - 1)*dcdc_fac;
+    J[98] += 2 * dqdci;           /* dwdot[OH]/d[H2O] */
+    J[103] -= dqdci;              /* dwdot[H2O2]/d[H2O] */
+    /* d()/d[H2O2] */
+    dqdci =  + k_f;
+    J[114] += 2 * dqdci;          /* dwdot[OH]/d[H2O2] */
+    J[119] -= dqdci;              /* dwdot[H2O2]/d[H2O2] */
     J[242] += 2 * dqdT; /* dwdot[OH]/dT */
     J[247] -= dqdT; /* dwdot[H2O2]/dT */
 
@@ -6838,8 +7056,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[1]*sc[8];
-    k_f = prefactor_units[3] * fwd_A[3]
-                * exp(fwd_beta[3] * tc[0] - activation_units[3] * fwd_Ea[3] * invT);
+    k_f = k_f_s[3];
     dlnkfdT = fwd_beta[3] * invT + activation_units[3] * fwd_Ea[3] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[3] * exp(low_beta[3] * tc[0] - activation_units[3] * low_Ea[3] * invT);
@@ -6855,16 +7072,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[3] == 4 ? exp(-troe_Tss[3] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[3]) > 1.e-100 ? -Fcent1/troe_Tsss[3] : 0.)
+      + (fabs(troe_Ts[3]) > 1.e-100 ? -Fcent2/troe_Ts[3] : 0.)
+      + (troe_len[3] == 4 ? Fcent3*troe_Tss[3]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[3]) > 1.e-100 ? -Fcent1/troe_Tsss[3] : 0.)
-      + (fabs(troe_Ts[3]) > 1.e-100 ? -Fcent2/troe_Ts[3] : 0.)
-      + (troe_len[3] == 4 ? Fcent3*troe_Tss[3]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -6872,7 +7089,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[9];
-    Kc = refCinv * exp(g_RT[1] + g_RT[8] - g_RT[9]);
+    Kc = Kc_s[3];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[8]) + (h_RT[9]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6890,45 +7107,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[8];
-        J[17] -= dqdci;               /* dwdot[O]/d[O] */
-        J[24] -= dqdci;               /* dwdot[NO]/d[O] */
-        J[25] += dqdci;               /* dwdot[NO2]/d[O] */
-        /* d()/d[NO] */
-        dqdci =  + k_f*sc[1];
-        J[129] -= dqdci;              /* dwdot[O]/d[NO] */
-        J[136] -= dqdci;              /* dwdot[NO]/d[NO] */
-        J[137] += dqdci;              /* dwdot[NO2]/d[NO] */
-        /* d()/d[NO2] */
-        dqdci =  - k_r;
-        J[145] -= dqdci;              /* dwdot[O]/d[NO2] */
-        J[152] -= dqdci;              /* dwdot[NO]/d[NO2] */
-        J[153] += dqdci;              /* dwdot[NO2]/d[NO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[8];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac + k_f*sc[1];
-        dqdc[9] = dcdc_fac - k_r;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        for (int k=0; k<15; k++) {
-            J[16*k+1] -= dqdc[k];
-            J[16*k+8] -= dqdc[k];
-            J[16*k+9] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[8] -= dcdc_fac;
+    Jmix[9] += dcdc_fac;
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[8];
+    J[17] -= dqdci;               /* dwdot[O]/d[O] */
+    J[24] -= dqdci;               /* dwdot[NO]/d[O] */
+    J[25] += dqdci;               /* dwdot[NO2]/d[O] */
+    /* d()/d[NO] */
+    dqdci =  + k_f*sc[1];
+    J[129] -= dqdci;              /* dwdot[O]/d[NO] */
+    J[136] -= dqdci;              /* dwdot[NO]/d[NO] */
+    J[137] += dqdci;              /* dwdot[NO2]/d[NO] */
+    /* d()/d[NO2] */
+    dqdci =  - k_r;
+    J[145] -= dqdci;              /* dwdot[O]/d[NO2] */
+    J[152] -= dqdci;              /* dwdot[NO]/d[NO2] */
+    J[153] += dqdci;              /* dwdot[NO2]/d[NO2] */
     J[241] -= dqdT; /* dwdot[O]/dT */
     J[248] -= dqdT; /* dwdot[NO]/dT */
     J[249] += dqdT; /* dwdot[NO2]/dT */
@@ -6940,8 +7137,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[4][0] - 1)*sc[14] + (TB[4][1] - 1)*sc[4] + (TB[4][2] - 1)*sc[6];
     /* forward */
     phi_f = sc[10];
-    k_f = prefactor_units[4] * fwd_A[4]
-                * exp(fwd_beta[4] * tc[0] - activation_units[4] * fwd_Ea[4] * invT);
+    k_f = k_f_s[4];
     dlnkfdT = fwd_beta[4] * invT + activation_units[4] * fwd_Ea[4] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[4] * exp(low_beta[4] * tc[0] - activation_units[4] * low_Ea[4] * invT);
@@ -6956,7 +7152,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = 0.0;
     /* reverse */
     phi_r = sc[1]*sc[14];
-    Kc = refC * exp(-g_RT[1] + g_RT[10] - g_RT[14]);
+    Kc = Kc_s[4];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10]) + (h_RT[1] + h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -6974,55 +7170,35 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[O] */
-        dqdci =  - k_r*sc[14];
-        J[17] += dqdci;               /* dwdot[O]/d[O] */
-        J[26] -= dqdci;               /* dwdot[N2O]/d[O] */
-        J[30] += dqdci;               /* dwdot[N2]/d[O] */
-        /* d()/d[O2] */
-        dqdci = (TB[4][1] - 1)*dcdc_fac;
-        J[65] += dqdci;               /* dwdot[O]/d[O2] */
-        J[74] -= dqdci;               /* dwdot[N2O]/d[O2] */
-        J[78] += dqdci;               /* dwdot[N2]/d[O2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[4][2] - 1)*dcdc_fac;
-        J[97] += dqdci;               /* dwdot[O]/d[H2O] */
-        J[106] -= dqdci;              /* dwdot[N2O]/d[H2O] */
-        J[110] += dqdci;              /* dwdot[N2]/d[H2O] */
-        /* d()/d[N2O] */
-        dqdci =  + k_f;
-        J[161] += dqdci;              /* dwdot[O]/d[N2O] */
-        J[170] -= dqdci;              /* dwdot[N2O]/d[N2O] */
-        J[174] += dqdci;              /* dwdot[N2]/d[N2O] */
-        /* d()/d[N2] */
-        dqdci = (TB[4][0] - 1)*dcdc_fac - k_r*sc[1];
-        J[225] += dqdci;              /* dwdot[O]/d[N2] */
-        J[234] -= dqdci;              /* dwdot[N2O]/d[N2] */
-        J[238] += dqdci;              /* dwdot[N2]/d[N2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac - k_r*sc[14];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[4][1]*dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = TB[4][2]*dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac + k_f;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = TB[4][0]*dcdc_fac - k_r*sc[1];
-        for (int k=0; k<15; k++) {
-            J[16*k+1] += dqdc[k];
-            J[16*k+10] -= dqdc[k];
-            J[16*k+14] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] += dcdc_fac;
+    Jmix[10] -= dcdc_fac;
+    Jmix[14] += dcdc_fac;
+    /* d()/d[O] */
+    dqdci =  - k_r*sc[14];
+    J[17] += dqdci;               /* dwdot[O]/d[O] */
+    J[26] -= dqdci;               /* dwdot[N2O]/d[O] */
+    J[30] += dqdci;               /* dwdot[N2]/d[O] */
+    /* d()/d[O2] */
+    dqdci = (TB[4][1] - 1)*dcdc_fac;
+    J[65] += dqdci;               /* dwdot[O]/d[O2] */
+    J[74] -= dqdci;               /* dwdot[N2O]/d[O2] */
+    J[78] += dqdci;               /* dwdot[N2]/d[O2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[4][2] - 1)*dcdc_fac;
+    J[97] += dqdci;               /* dwdot[O]/d[H2O] */
+    J[106] -= dqdci;              /* dwdot[N2O]/d[H2O] */
+    J[110] += dqdci;              /* dwdot[N2]/d[H2O] */
+    /* d()/d[N2O] */
+    dqdci =  + k_f;
+    J[161] += dqdci;              /* dwdot[O]/d[N2O] */
+    J[170] -= dqdci;              /* dwdot[N2O]/d[N2O] */
+    J[174] += dqdci;              /* dwdot[N2]/d[N2O] */
+    /* d()/d[N2] */
+    dqdci = (TB[4][0] - 1)*dcdc_fac - k_r*sc[1];
+    J[225] += dqdci;              /* dwdot[O]/d[N2] */
+    J[234] -= dqdci;              /* dwdot[N2O]/d[N2] */
+    J[238] += dqdci;              /* dwdot[N2]/d[N2] */
     J[241] += dqdT; /* dwdot[O]/dT */
     J[250] -= dqdT; /* dwdot[N2O]/dT */
     J[254] += dqdT; /* dwdot[N2]/dT */
@@ -7033,12 +7209,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[5][0] - 1)*sc[14] + (TB[5][1] - 1)*sc[6] + (TB[5][2] - 1)*sc[3];
     /* forward */
     phi_f = sc[0]*sc[0];
-    k_f = prefactor_units[5] * fwd_A[5]
-                * exp(fwd_beta[5] * tc[0] - activation_units[5] * fwd_Ea[5] * invT);
+    k_f = k_f_s[5];
     dlnkfdT = fwd_beta[5] * invT + activation_units[5] * fwd_Ea[5] * invT2;
     /* reverse */
     phi_r = sc[3];
-    Kc = refCinv * exp(g_RT[0] + g_RT[0] - g_RT[3]);
+    Kc = Kc_s[5];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[0]) + (h_RT[3]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7052,45 +7227,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*2*sc[0];
-        J[0] += -2 * dqdci;           /* dwdot[H]/d[H] */
-        J[3] += dqdci;                /* dwdot[H2]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[5][2] - 1)*q_nocor - k_r;
-        J[48] += -2 * dqdci;          /* dwdot[H]/d[H2] */
-        J[51] += dqdci;               /* dwdot[H2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[5][1] - 1)*q_nocor;
-        J[96] += -2 * dqdci;          /* dwdot[H]/d[H2O] */
-        J[99] += dqdci;               /* dwdot[H2]/d[H2O] */
-        /* d()/d[N2] */
-        dqdci = (TB[5][0] - 1)*q_nocor;
-        J[224] += -2 * dqdci;         /* dwdot[H]/d[N2] */
-        J[227] += dqdci;              /* dwdot[H2]/d[N2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*2*sc[0];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = TB[5][2] - k_r;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = TB[5][1];
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = TB[5][0];
-        for (int k=0; k<15; k++) {
-            J[16*k+0] += -2 * dqdc[k];
-            J[16*k+3] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += -2 * q_nocor;
+    Jmix[3] += q_nocor;
+    /* d()/d[H] */
+    dqdci =  + k_f*2*sc[0];
+    J[0] += -2 * dqdci;           /* dwdot[H]/d[H] */
+    J[3] += dqdci;                /* dwdot[H2]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[5][2] - 1)*q_nocor - k_r;
+    J[48] += -2 * dqdci;          /* dwdot[H]/d[H2] */
+    J[51] += dqdci;               /* dwdot[H2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[5][1] - 1)*q_nocor;
+    J[96] += -2 * dqdci;          /* dwdot[H]/d[H2O] */
+    J[99] += dqdci;               /* dwdot[H2]/d[H2O] */
+    /* d()/d[N2] */
+    dqdci = (TB[5][0] - 1)*q_nocor;
+    J[224] += -2 * dqdci;         /* dwdot[H]/d[N2] */
+    J[227] += dqdci;              /* dwdot[H2]/d[N2] */
     J[240] += -2 * dqdT; /* dwdot[H]/dT */
     J[243] += dqdT; /* dwdot[H2]/dT */
 
@@ -7100,12 +7255,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[6][0] - 1)*sc[6];
     /* forward */
     phi_f = sc[0]*sc[1];
-    k_f = prefactor_units[6] * fwd_A[6]
-                * exp(fwd_beta[6] * tc[0] - activation_units[6] * fwd_Ea[6] * invT);
+    k_f = k_f_s[6];
     dlnkfdT = fwd_beta[6] * invT + activation_units[6] * fwd_Ea[6] * invT2;
     /* reverse */
     phi_r = sc[2];
-    Kc = refCinv * exp(g_RT[0] + g_RT[1] - g_RT[2]);
+    Kc = Kc_s[6];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[1]) + (h_RT[2]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7120,50 +7274,30 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[1];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[1] -= dqdci;                /* dwdot[O]/d[H] */
-        J[2] += dqdci;                /* dwdot[OH]/d[H] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[0];
-        J[16] -= dqdci;               /* dwdot[H]/d[O] */
-        J[17] -= dqdci;               /* dwdot[O]/d[O] */
-        J[18] += dqdci;               /* dwdot[OH]/d[O] */
-        /* d()/d[OH] */
-        dqdci =  - k_r;
-        J[32] -= dqdci;               /* dwdot[H]/d[OH] */
-        J[33] -= dqdci;               /* dwdot[O]/d[OH] */
-        J[34] += dqdci;               /* dwdot[OH]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[6][0] - 1)*q_nocor;
-        J[96] -= dqdci;               /* dwdot[H]/d[H2O] */
-        J[97] -= dqdci;               /* dwdot[O]/d[H2O] */
-        J[98] += dqdci;               /* dwdot[OH]/d[H2O] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[1];
-        dqdc[1] = dcdc_fac + k_f*sc[0];
-        dqdc[2] = dcdc_fac - k_r;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = TB[6][0];
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        for (int k=0; k<15; k++) {
-            J[16*k+0] -= dqdc[k];
-            J[16*k+1] -= dqdc[k];
-            J[16*k+2] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= q_nocor;
+    Jmix[1] -= q_nocor;
+    Jmix[2] += q_nocor;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[1];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[1] -= dqdci;                /* dwdot[O]/d[H] */
+    J[2] += dqdci;                /* dwdot[OH]/d[H] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[0];
+    J[16] -= dqdci;               /* dwdot[H]/d[O] */
+    J[17] -= dqdci;               /* dwdot[O]/d[O] */
+    J[18] += dqdci;               /* dwdot[OH]/d[O] */
+    /* d()/d[OH] */
+    dqdci =  - k_r;
+    J[32] -= dqdci;               /* dwdot[H]/d[OH] */
+    J[33] -= dqdci;               /* dwdot[O]/d[OH] */
+    J[34] += dqdci;               /* dwdot[OH]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[6][0] - 1)*q_nocor;
+    J[96] -= dqdci;               /* dwdot[H]/d[H2O] */
+    J[97] -= dqdci;               /* dwdot[O]/d[H2O] */
+    J[98] += dqdci;               /* dwdot[OH]/d[H2O] */
     J[240] -= dqdT; /* dwdot[H]/dT */
     J[241] -= dqdT; /* dwdot[O]/dT */
     J[242] += dqdT; /* dwdot[OH]/dT */
@@ -7174,12 +7308,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[7][0] - 1)*sc[14] + (TB[7][1] - 1)*sc[4] + (TB[7][2] - 1)*sc[6];
     /* forward */
     phi_f = sc[1]*sc[1];
-    k_f = prefactor_units[7] * fwd_A[7]
-                * exp(fwd_beta[7] * tc[0] - activation_units[7] * fwd_Ea[7] * invT);
+    k_f = k_f_s[7];
     dlnkfdT = fwd_beta[7] * invT + activation_units[7] * fwd_Ea[7] * invT2;
     /* reverse */
     phi_r = sc[4];
-    Kc = refCinv * exp(g_RT[1] + g_RT[1] - g_RT[4]);
+    Kc = Kc_s[7];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[1]) + (h_RT[4]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7193,45 +7326,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[O] */
-        dqdci =  + k_f*2*sc[1];
-        J[17] += -2 * dqdci;          /* dwdot[O]/d[O] */
-        J[20] += dqdci;               /* dwdot[O2]/d[O] */
-        /* d()/d[O2] */
-        dqdci = (TB[7][1] - 1)*q_nocor - k_r;
-        J[65] += -2 * dqdci;          /* dwdot[O]/d[O2] */
-        J[68] += dqdci;               /* dwdot[O2]/d[O2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[7][2] - 1)*q_nocor;
-        J[97] += -2 * dqdci;          /* dwdot[O]/d[H2O] */
-        J[100] += dqdci;              /* dwdot[O2]/d[H2O] */
-        /* d()/d[N2] */
-        dqdci = (TB[7][0] - 1)*q_nocor;
-        J[225] += -2 * dqdci;         /* dwdot[O]/d[N2] */
-        J[228] += dqdci;              /* dwdot[O2]/d[N2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*2*sc[1];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[7][1] - k_r;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = TB[7][2];
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = TB[7][0];
-        for (int k=0; k<15; k++) {
-            J[16*k+1] += -2 * dqdc[k];
-            J[16*k+4] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] += -2 * q_nocor;
+    Jmix[4] += q_nocor;
+    /* d()/d[O] */
+    dqdci =  + k_f*2*sc[1];
+    J[17] += -2 * dqdci;          /* dwdot[O]/d[O] */
+    J[20] += dqdci;               /* dwdot[O2]/d[O] */
+    /* d()/d[O2] */
+    dqdci = (TB[7][1] - 1)*q_nocor - k_r;
+    J[65] += -2 * dqdci;          /* dwdot[O]/d[O2] */
+    J[68] += dqdci;               /* dwdot[O2]/d[O2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[7][2] - 1)*q_nocor;
+    J[97] += -2 * dqdci;          /* dwdot[O]/d[H2O] */
+    J[100] += dqdci;              /* dwdot[O2]/d[H2O] */
+    /* d()/d[N2] */
+    dqdci = (TB[7][0] - 1)*q_nocor;
+    J[225] += -2 * dqdci;         /* dwdot[O]/d[N2] */
+    J[228] += dqdci;              /* dwdot[O2]/d[N2] */
     J[241] += -2 * dqdT; /* dwdot[O]/dT */
     J[244] += dqdT; /* dwdot[O2]/dT */
 
@@ -7241,12 +7354,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[8][0] - 1)*sc[3] + (TB[8][1] - 1)*sc[6];
     /* forward */
     phi_f = sc[0]*sc[2];
-    k_f = prefactor_units[8] * fwd_A[8]
-                * exp(fwd_beta[8] * tc[0] - activation_units[8] * fwd_Ea[8] * invT);
+    k_f = k_f_s[8];
     dlnkfdT = fwd_beta[8] * invT + activation_units[8] * fwd_Ea[8] * invT2;
     /* reverse */
     phi_r = sc[6];
-    Kc = refCinv * exp(g_RT[0] + g_RT[2] - g_RT[6]);
+    Kc = Kc_s[8];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[2]) + (h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7261,50 +7373,30 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[2];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[2] -= dqdci;                /* dwdot[OH]/d[H] */
-        J[6] += dqdci;                /* dwdot[H2O]/d[H] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*sc[0];
-        J[32] -= dqdci;               /* dwdot[H]/d[OH] */
-        J[34] -= dqdci;               /* dwdot[OH]/d[OH] */
-        J[38] += dqdci;               /* dwdot[H2O]/d[OH] */
-        /* d()/d[H2] */
-        dqdci = (TB[8][0] - 1)*q_nocor;
-        J[48] -= dqdci;               /* dwdot[H]/d[H2] */
-        J[50] -= dqdci;               /* dwdot[OH]/d[H2] */
-        J[54] += dqdci;               /* dwdot[H2O]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[8][1] - 1)*q_nocor - k_r;
-        J[96] -= dqdci;               /* dwdot[H]/d[H2O] */
-        J[98] -= dqdci;               /* dwdot[OH]/d[H2O] */
-        J[102] += dqdci;              /* dwdot[H2O]/d[H2O] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[2];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*sc[0];
-        dqdc[3] = TB[8][0];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = TB[8][1] - k_r;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        for (int k=0; k<15; k++) {
-            J[16*k+0] -= dqdc[k];
-            J[16*k+2] -= dqdc[k];
-            J[16*k+6] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= q_nocor;
+    Jmix[2] -= q_nocor;
+    Jmix[6] += q_nocor;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[2];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[2] -= dqdci;                /* dwdot[OH]/d[H] */
+    J[6] += dqdci;                /* dwdot[H2O]/d[H] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*sc[0];
+    J[32] -= dqdci;               /* dwdot[H]/d[OH] */
+    J[34] -= dqdci;               /* dwdot[OH]/d[OH] */
+    J[38] += dqdci;               /* dwdot[H2O]/d[OH] */
+    /* d()/d[H2] */
+    dqdci = (TB[8][0] - 1)*q_nocor;
+    J[48] -= dqdci;               /* dwdot[H]/d[H2] */
+    J[50] -= dqdci;               /* dwdot[OH]/d[H2] */
+    J[54] += dqdci;               /* dwdot[H2O]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[8][1] - 1)*q_nocor - k_r;
+    J[96] -= dqdci;               /* dwdot[H]/d[H2O] */
+    J[98] -= dqdci;               /* dwdot[OH]/d[H2O] */
+    J[102] += dqdci;              /* dwdot[H2O]/d[H2O] */
     J[240] -= dqdT; /* dwdot[H]/dT */
     J[242] -= dqdT; /* dwdot[OH]/dT */
     J[246] += dqdT; /* dwdot[H2O]/dT */
@@ -7313,12 +7405,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[4];
-    k_f = prefactor_units[9] * fwd_A[9]
-                * exp(fwd_beta[9] * tc[0] - activation_units[9] * fwd_Ea[9] * invT);
+    k_f = k_f_s[9];
     dlnkfdT = fwd_beta[9] * invT + activation_units[9] * fwd_Ea[9] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[2];
-    Kc = exp(g_RT[0] - g_RT[1] - g_RT[2] + g_RT[4]);
+    Kc = Kc_s[9];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[4]) + (h_RT[1] + h_RT[2]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7364,12 +7455,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[0]*sc[14];
-    k_f = prefactor_units[10] * fwd_A[10]
-                * exp(fwd_beta[10] * tc[0] - activation_units[10] * fwd_Ea[10] * invT);
+    k_f = k_f_s[10];
     dlnkfdT = fwd_beta[10] * invT + activation_units[10] * fwd_Ea[10] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[14];
-    Kc = refCinv * exp(g_RT[0] + g_RT[0] - g_RT[3] + g_RT[14] - g_RT[14]);
+    Kc = Kc_s[10];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[0] + h_RT[14]) + (h_RT[3] + h_RT[14]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7399,12 +7489,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[0]*sc[3];
-    k_f = prefactor_units[11] * fwd_A[11]
-                * exp(fwd_beta[11] * tc[0] - activation_units[11] * fwd_Ea[11] * invT);
+    k_f = k_f_s[11];
     dlnkfdT = fwd_beta[11] * invT + activation_units[11] * fwd_Ea[11] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[3];
-    Kc = refCinv * exp(g_RT[0] + g_RT[0] + g_RT[3] - g_RT[3] - g_RT[3]);
+    Kc = Kc_s[11];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[0] + h_RT[3]) + (2*h_RT[3]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7430,12 +7519,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[0]*sc[6];
-    k_f = prefactor_units[12] * fwd_A[12]
-                * exp(fwd_beta[12] * tc[0] - activation_units[12] * fwd_Ea[12] * invT);
+    k_f = k_f_s[12];
     dlnkfdT = fwd_beta[12] * invT + activation_units[12] * fwd_Ea[12] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[6];
-    Kc = refCinv * exp(g_RT[0] + g_RT[0] - g_RT[3] + g_RT[6] - g_RT[6]);
+    Kc = Kc_s[12];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[0] + h_RT[6]) + (h_RT[3] + h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7465,12 +7553,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3];
-    k_f = prefactor_units[13] * fwd_A[13]
-                * exp(fwd_beta[13] * tc[0] - activation_units[13] * fwd_Ea[13] * invT);
+    k_f = k_f_s[13];
     dlnkfdT = fwd_beta[13] * invT + activation_units[13] * fwd_Ea[13] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[2];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[2] + g_RT[3]);
+    Kc = Kc_s[13];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3]) + (h_RT[0] + h_RT[2]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7516,12 +7603,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3];
-    k_f = prefactor_units[14] * fwd_A[14]
-                * exp(fwd_beta[14] * tc[0] - activation_units[14] * fwd_Ea[14] * invT);
+    k_f = k_f_s[14];
     dlnkfdT = fwd_beta[14] * invT + activation_units[14] * fwd_Ea[14] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[2];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[2] + g_RT[3]);
+    Kc = Kc_s[14];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3]) + (h_RT[0] + h_RT[2]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7567,12 +7653,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[2];
-    k_f = prefactor_units[15] * fwd_A[15]
-                * exp(fwd_beta[15] * tc[0] - activation_units[15] * fwd_Ea[15] * invT);
+    k_f = k_f_s[15];
     dlnkfdT = fwd_beta[15] * invT + activation_units[15] * fwd_Ea[15] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[6];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[2] - g_RT[6]);
+    Kc = Kc_s[15];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[2]) + (h_RT[1] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7607,12 +7692,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[3];
-    k_f = prefactor_units[16] * fwd_A[16]
-                * exp(fwd_beta[16] * tc[0] - activation_units[16] * fwd_Ea[16] * invT);
+    k_f = k_f_s[16];
     dlnkfdT = fwd_beta[16] * invT + activation_units[16] * fwd_Ea[16] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[6];
-    Kc = exp(-g_RT[0] + g_RT[2] + g_RT[3] - g_RT[6]);
+    Kc = Kc_s[16];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[3]) + (h_RT[0] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7658,12 +7742,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[4];
-    k_f = prefactor_units[17] * fwd_A[17]
-                * exp(fwd_beta[17] * tc[0] - activation_units[17] * fwd_Ea[17] * invT);
+    k_f = k_f_s[17];
     dlnkfdT = fwd_beta[17] * invT + activation_units[17] * fwd_Ea[17] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[5];
-    Kc = exp(-g_RT[0] + g_RT[3] + g_RT[4] - g_RT[5]);
+    Kc = Kc_s[17];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[4]) + (h_RT[0] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7709,12 +7792,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[5];
-    k_f = prefactor_units[18] * fwd_A[18]
-                * exp(fwd_beta[18] * tc[0] - activation_units[18] * fwd_Ea[18] * invT);
+    k_f = k_f_s[18];
     dlnkfdT = fwd_beta[18] * invT + activation_units[18] * fwd_Ea[18] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[2];
-    Kc = exp(g_RT[0] - g_RT[2] - g_RT[2] + g_RT[5]);
+    Kc = Kc_s[18];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[5]) + (2*h_RT[2]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7749,12 +7831,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[5];
-    k_f = prefactor_units[19] * fwd_A[19]
-                * exp(fwd_beta[19] * tc[0] - activation_units[19] * fwd_Ea[19] * invT);
+    k_f = k_f_s[19];
     dlnkfdT = fwd_beta[19] * invT + activation_units[19] * fwd_Ea[19] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[6];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[5] - g_RT[6]);
+    Kc = Kc_s[19];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[5]) + (h_RT[1] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7800,12 +7881,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[5];
-    k_f = prefactor_units[20] * fwd_A[20]
-                * exp(fwd_beta[20] * tc[0] - activation_units[20] * fwd_Ea[20] * invT);
+    k_f = k_f_s[20];
     dlnkfdT = fwd_beta[20] * invT + activation_units[20] * fwd_Ea[20] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[4];
-    Kc = exp(g_RT[1] - g_RT[2] - g_RT[4] + g_RT[5]);
+    Kc = Kc_s[20];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[5]) + (h_RT[2] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7851,12 +7931,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[5];
-    k_f = prefactor_units[21] * fwd_A[21]
-                * exp(fwd_beta[21] * tc[0] - activation_units[21] * fwd_Ea[21] * invT);
+    k_f = k_f_s[21];
     dlnkfdT = fwd_beta[21] * invT + activation_units[21] * fwd_Ea[21] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[6];
-    Kc = exp(g_RT[2] - g_RT[4] + g_RT[5] - g_RT[6]);
+    Kc = Kc_s[21];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[5]) + (h_RT[4] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7902,12 +7981,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[5];
-    k_f = prefactor_units[22] * fwd_A[22]
-                * exp(fwd_beta[22] * tc[0] - activation_units[22] * fwd_Ea[22] * invT);
+    k_f = k_f_s[22];
     dlnkfdT = fwd_beta[22] * invT + activation_units[22] * fwd_Ea[22] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[6];
-    Kc = exp(g_RT[2] - g_RT[4] + g_RT[5] - g_RT[6]);
+    Kc = Kc_s[22];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[5]) + (h_RT[4] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -7953,12 +8031,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[5];
-    k_f = prefactor_units[23] * fwd_A[23]
-                * exp(fwd_beta[23] * tc[0] - activation_units[23] * fwd_Ea[23] * invT);
+    k_f = k_f_s[23];
     dlnkfdT = fwd_beta[23] * invT + activation_units[23] * fwd_Ea[23] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[6];
-    Kc = exp(g_RT[2] - g_RT[4] + g_RT[5] - g_RT[6]);
+    Kc = Kc_s[23];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[5]) + (h_RT[4] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -8004,12 +8081,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[5];
-    k_f = prefactor_units[24] * fwd_A[24]
-                * exp(fwd_beta[24] * tc[0] - activation_units[24] * fwd_Ea[24] * invT);
+    k_f = k_f_s[24];
     dlnkfdT = fwd_beta[24] * invT + activation_units[24] * fwd_Ea[24] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[7];
-    Kc = exp(-g_RT[4] + g_RT[5] + g_RT[5] - g_RT[7]);
+    Kc = Kc_s[24];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[5]) + (h_RT[4] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -8044,12 +8120,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[5];
-    k_f = prefactor_units[25] * fwd_A[25]
-                * exp(fwd_beta[25] * tc[0] - activation_units[25] * fwd_Ea[25] * invT);
+    k_f = k_f_s[25];
     dlnkfdT = fwd_beta[25] * invT + activation_units[25] * fwd_Ea[25] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[7];
-    Kc = exp(-g_RT[4] + g_RT[5] + g_RT[5] - g_RT[7]);
+    Kc = Kc_s[25];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[5]) + (h_RT[4] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -8084,12 +8159,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[7];
-    k_f = prefactor_units[26] * fwd_A[26]
-                * exp(fwd_beta[26] * tc[0] - activation_units[26] * fwd_Ea[26] * invT);
+    k_f = k_f_s[26];
     dlnkfdT = fwd_beta[26] * invT + activation_units[26] * fwd_Ea[26] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[6];
-    Kc = exp(g_RT[0] - g_RT[2] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[26];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[7]) + (h_RT[2] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -8135,12 +8209,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[7];
-    k_f = prefactor_units[27] * fwd_A[27]
-                * exp(fwd_beta[27] * tc[0] - activation_units[27] * fwd_Ea[27] * invT);
+    k_f = k_f_s[27];
     dlnkfdT = fwd_beta[27] * invT + activation_units[27] * fwd_Ea[27] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[5];
-    Kc = exp(g_RT[0] - g_RT[3] - g_RT[5] + g_RT[7]);
+    Kc = Kc_s[27];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[7]) + (h_RT[3] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -8186,12 +8259,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[7];
-    k_f = prefactor_units[28] * fwd_A[28]
-                * exp(fwd_beta[28] * tc[0] - activation_units[28] * fwd_Ea[28] * invT);
+    k_f = k_f_s[28];
     dlnkfdT = fwd_beta[28] * invT + activation_units[28] * fwd_Ea[28] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[5];
-    Kc = exp(g_RT[1] - g_RT[2] - g_RT[5] + g_RT[7]);
+    Kc = Kc_s[28];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[7]) + (h_RT[2] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -8237,12 +8309,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[7];
-    k_f = prefactor_units[29] * fwd_A[29]
-                * exp(fwd_beta[29] * tc[0] - activation_units[29] * fwd_Ea[29] * invT);
+    k_f = k_f_s[29];
     dlnkfdT = fwd_beta[29] * invT + activation_units[29] * fwd_Ea[29] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[29];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[7]) + (h_RT[5] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -8288,12 +8359,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[7];
-    k_f = prefactor_units[30] * fwd_A[30]
-                * exp(fwd_beta[30] * tc[0] - activation_units[30] * fwd_Ea[30] * invT);
+    k_f = k_f_s[30];
     dlnkfdT = fwd_beta[30] * invT + activation_units[30] * fwd_Ea[30] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[30];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[7]) + (h_RT[5] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -8339,12 +8409,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[8];
-    k_f = prefactor_units[31] * fwd_A[31]
-                * exp(fwd_beta[31] * tc[0] - activation_units[31] * fwd_Ea[31] * invT);
+    k_f = k_f_s[31];
     dlnkfdT = fwd_beta[31] * invT + activation_units[31] * fwd_Ea[31] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[9];
-    Kc = exp(-g_RT[2] + g_RT[5] + g_RT[8] - g_RT[9]);
+    Kc = Kc_s[31];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[8]) + (h_RT[2] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -8390,12 +8459,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[9];
-    k_f = prefactor_units[32] * fwd_A[32]
-                * exp(fwd_beta[32] * tc[0] - activation_units[32] * fwd_Ea[32] * invT);
+    k_f = k_f_s[32];
     dlnkfdT = fwd_beta[32] * invT + activation_units[32] * fwd_Ea[32] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[8];
-    Kc = exp(g_RT[0] - g_RT[2] - g_RT[8] + g_RT[9]);
+    Kc = Kc_s[32];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[9]) + (h_RT[2] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -8441,12 +8509,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[9];
-    k_f = prefactor_units[33] * fwd_A[33]
-                * exp(fwd_beta[33] * tc[0] - activation_units[33] * fwd_Ea[33] * invT);
+    k_f = k_f_s[33];
     dlnkfdT = fwd_beta[33] * invT + activation_units[33] * fwd_Ea[33] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[8];
-    Kc = exp(g_RT[1] - g_RT[4] - g_RT[8] + g_RT[9]);
+    Kc = Kc_s[33];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[9]) + (h_RT[4] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -8492,12 +8559,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[9];
-    k_f = prefactor_units[34] * fwd_A[34]
-                * exp(fwd_beta[34] * tc[0] - activation_units[34] * fwd_Ea[34] * invT);
+    k_f = k_f_s[34];
     dlnkfdT = fwd_beta[34] * invT + activation_units[34] * fwd_Ea[34] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[8]*sc[8];
-    Kc = refC * exp(-g_RT[4] - g_RT[8] - g_RT[8] + g_RT[9] + g_RT[9]);
+    Kc = Kc_s[34];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[9]) + (h_RT[4] + 2*h_RT[8]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -8532,12 +8598,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[10];
-    k_f = prefactor_units[35] * fwd_A[35]
-                * exp(fwd_beta[35] * tc[0] - activation_units[35] * fwd_Ea[35] * invT);
+    k_f = k_f_s[35];
     dlnkfdT = fwd_beta[35] * invT + activation_units[35] * fwd_Ea[35] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[14];
-    Kc = exp(g_RT[0] - g_RT[2] + g_RT[10] - g_RT[14]);
+    Kc = Kc_s[35];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[10]) + (h_RT[2] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -8583,12 +8648,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[10];
-    k_f = prefactor_units[36] * fwd_A[36]
-                * exp(fwd_beta[36] * tc[0] - activation_units[36] * fwd_Ea[36] * invT);
+    k_f = k_f_s[36];
     dlnkfdT = fwd_beta[36] * invT + activation_units[36] * fwd_Ea[36] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[14];
-    Kc = exp(g_RT[0] - g_RT[2] + g_RT[10] - g_RT[14]);
+    Kc = Kc_s[36];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[10]) + (h_RT[2] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -8634,12 +8698,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[10];
-    k_f = prefactor_units[37] * fwd_A[37]
-                * exp(fwd_beta[37] * tc[0] - activation_units[37] * fwd_Ea[37] * invT);
+    k_f = k_f_s[37];
     dlnkfdT = fwd_beta[37] * invT + activation_units[37] * fwd_Ea[37] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[8];
-    Kc = exp(g_RT[1] - g_RT[8] - g_RT[8] + g_RT[10]);
+    Kc = Kc_s[37];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[10]) + (2*h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -8674,12 +8737,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[10];
-    k_f = prefactor_units[38] * fwd_A[38]
-                * exp(fwd_beta[38] * tc[0] - activation_units[38] * fwd_Ea[38] * invT);
+    k_f = k_f_s[38];
     dlnkfdT = fwd_beta[38] * invT + activation_units[38] * fwd_Ea[38] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[14];
-    Kc = exp(g_RT[1] - g_RT[4] + g_RT[10] - g_RT[14]);
+    Kc = Kc_s[38];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[10]) + (h_RT[4] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -8725,12 +8787,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[11];
-    k_f = prefactor_units[39] * fwd_A[39]
-                * exp(fwd_beta[39] * tc[0] - activation_units[39] * fwd_Ea[39] * invT);
+    k_f = k_f_s[39];
     dlnkfdT = fwd_beta[39] * invT + activation_units[39] * fwd_Ea[39] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[12];
-    Kc = exp(g_RT[0] - g_RT[3] + g_RT[11] - g_RT[12]);
+    Kc = Kc_s[39];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[11]) + (h_RT[3] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -8776,12 +8837,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[11];
-    k_f = prefactor_units[40] * fwd_A[40]
-                * exp(fwd_beta[40] * tc[0] - activation_units[40] * fwd_Ea[40] * invT);
+    k_f = k_f_s[40];
     dlnkfdT = fwd_beta[40] * invT + activation_units[40] * fwd_Ea[40] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[8];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[8] + g_RT[11]);
+    Kc = Kc_s[40];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[11]) + (h_RT[0] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -8827,12 +8887,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[11];
-    k_f = prefactor_units[41] * fwd_A[41]
-                * exp(fwd_beta[41] * tc[0] - activation_units[41] * fwd_Ea[41] * invT);
+    k_f = k_f_s[41];
     dlnkfdT = fwd_beta[41] * invT + activation_units[41] * fwd_Ea[41] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[12];
-    Kc = exp(g_RT[2] - g_RT[6] + g_RT[11] - g_RT[12]);
+    Kc = Kc_s[41];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[11]) + (h_RT[6] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -8878,12 +8937,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[11];
-    k_f = prefactor_units[42] * fwd_A[42]
-                * exp(fwd_beta[42] * tc[0] - activation_units[42] * fwd_Ea[42] * invT);
+    k_f = k_f_s[42];
     dlnkfdT = fwd_beta[42] * invT + activation_units[42] * fwd_Ea[42] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[8];
-    Kc = exp(-g_RT[2] + g_RT[4] - g_RT[8] + g_RT[11]);
+    Kc = Kc_s[42];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[11]) + (h_RT[2] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -8929,12 +8987,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[11];
-    k_f = prefactor_units[43] * fwd_A[43]
-                * exp(fwd_beta[43] * tc[0] - activation_units[43] * fwd_Ea[43] * invT);
+    k_f = k_f_s[43];
     dlnkfdT = fwd_beta[43] * invT + activation_units[43] * fwd_Ea[43] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[10];
-    Kc = exp(-g_RT[0] + g_RT[8] - g_RT[10] + g_RT[11]);
+    Kc = Kc_s[43];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[11]) + (h_RT[0] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -8980,12 +9037,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[11];
-    k_f = prefactor_units[44] * fwd_A[44]
-                * exp(fwd_beta[44] * tc[0] - activation_units[44] * fwd_Ea[44] * invT);
+    k_f = k_f_s[44];
     dlnkfdT = fwd_beta[44] * invT + activation_units[44] * fwd_Ea[44] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[10];
-    Kc = exp(-g_RT[0] + g_RT[8] - g_RT[10] + g_RT[11]);
+    Kc = Kc_s[44];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[11]) + (h_RT[0] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -9031,12 +9087,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[11];
-    k_f = prefactor_units[45] * fwd_A[45]
-                * exp(fwd_beta[45] * tc[0] - activation_units[45] * fwd_Ea[45] * invT);
+    k_f = k_f_s[45];
     dlnkfdT = fwd_beta[45] * invT + activation_units[45] * fwd_Ea[45] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[14];
-    Kc = exp(-g_RT[2] + g_RT[8] + g_RT[11] - g_RT[14]);
+    Kc = Kc_s[45];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[11]) + (h_RT[2] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -9082,12 +9137,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[11];
-    k_f = prefactor_units[46] * fwd_A[46]
-                * exp(fwd_beta[46] * tc[0] - activation_units[46] * fwd_Ea[46] * invT);
+    k_f = k_f_s[46];
     dlnkfdT = fwd_beta[46] * invT + activation_units[46] * fwd_Ea[46] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[10];
-    Kc = exp(-g_RT[2] + g_RT[9] - g_RT[10] + g_RT[11]);
+    Kc = Kc_s[46];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[11]) + (h_RT[2] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -9133,12 +9187,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[12];
-    k_f = prefactor_units[47] * fwd_A[47]
-                * exp(fwd_beta[47] * tc[0] - activation_units[47] * fwd_Ea[47] * invT);
+    k_f = k_f_s[47];
     dlnkfdT = fwd_beta[47] * invT + activation_units[47] * fwd_Ea[47] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[8];
-    Kc = exp(-g_RT[0] + g_RT[2] - g_RT[8] + g_RT[12]);
+    Kc = Kc_s[47];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[12]) + (h_RT[0] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -9184,12 +9237,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[12];
-    k_f = prefactor_units[48] * fwd_A[48]
-                * exp(fwd_beta[48] * tc[0] - activation_units[48] * fwd_Ea[48] * invT);
+    k_f = k_f_s[48];
     dlnkfdT = fwd_beta[48] * invT + activation_units[48] * fwd_Ea[48] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[8];
-    Kc = exp(-g_RT[1] + g_RT[4] - g_RT[8] + g_RT[12]);
+    Kc = Kc_s[48];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[12]) + (h_RT[1] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -9235,12 +9287,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[12];
-    k_f = prefactor_units[49] * fwd_A[49]
-                * exp(fwd_beta[49] * tc[0] - activation_units[49] * fwd_Ea[49] * invT);
+    k_f = k_f_s[49];
     dlnkfdT = fwd_beta[49] * invT + activation_units[49] * fwd_Ea[49] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14];
-    Kc = exp(-g_RT[1] + g_RT[8] + g_RT[12] - g_RT[14]);
+    Kc = Kc_s[49];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[12]) + (h_RT[1] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -9286,12 +9337,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13];
-    k_f = prefactor_units[50] * fwd_A[50]
-                * exp(fwd_beta[50] * tc[0] - activation_units[50] * fwd_Ea[50] * invT);
+    k_f = k_f_s[50];
     dlnkfdT = fwd_beta[50] * invT + activation_units[50] * fwd_Ea[50] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[14];
-    Kc = refC * exp(-g_RT[0] + g_RT[13] - g_RT[14]);
+    Kc = Kc_s[50];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13]) + (h_RT[0] + h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -9326,12 +9376,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[13];
-    k_f = prefactor_units[51] * fwd_A[51]
-                * exp(fwd_beta[51] * tc[0] - activation_units[51] * fwd_Ea[51] * invT);
+    k_f = k_f_s[51];
     dlnkfdT = fwd_beta[51] * invT + activation_units[51] * fwd_Ea[51] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[14];
-    Kc = exp(g_RT[0] - g_RT[3] + g_RT[13] - g_RT[14]);
+    Kc = Kc_s[51];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[13]) + (h_RT[3] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -9377,12 +9426,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[13];
-    k_f = prefactor_units[52] * fwd_A[52]
-                * exp(fwd_beta[52] * tc[0] - activation_units[52] * fwd_Ea[52] * invT);
+    k_f = k_f_s[52];
     dlnkfdT = fwd_beta[52] * invT + activation_units[52] * fwd_Ea[52] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[10];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[10] + g_RT[13]);
+    Kc = Kc_s[52];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[13]) + (h_RT[0] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -9428,12 +9476,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[13];
-    k_f = prefactor_units[53] * fwd_A[53]
-                * exp(fwd_beta[53] * tc[0] - activation_units[53] * fwd_Ea[53] * invT);
+    k_f = k_f_s[53];
     dlnkfdT = fwd_beta[53] * invT + activation_units[53] * fwd_Ea[53] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[14];
-    Kc = exp(g_RT[1] - g_RT[2] + g_RT[13] - g_RT[14]);
+    Kc = Kc_s[53];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[13]) + (h_RT[2] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -9479,12 +9526,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[13];
-    k_f = prefactor_units[54] * fwd_A[54]
-                * exp(fwd_beta[54] * tc[0] - activation_units[54] * fwd_Ea[54] * invT);
+    k_f = k_f_s[54];
     dlnkfdT = fwd_beta[54] * invT + activation_units[54] * fwd_Ea[54] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[11];
-    Kc = exp(g_RT[1] - g_RT[8] - g_RT[11] + g_RT[13]);
+    Kc = Kc_s[54];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[13]) + (h_RT[8] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -9530,12 +9576,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[13];
-    k_f = prefactor_units[55] * fwd_A[55]
-                * exp(fwd_beta[55] * tc[0] - activation_units[55] * fwd_Ea[55] * invT);
+    k_f = k_f_s[55];
     dlnkfdT = fwd_beta[55] * invT + activation_units[55] * fwd_Ea[55] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[14];
-    Kc = exp(g_RT[2] - g_RT[6] + g_RT[13] - g_RT[14]);
+    Kc = Kc_s[55];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[13]) + (h_RT[6] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -9581,12 +9626,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[13];
-    k_f = prefactor_units[56] * fwd_A[56]
-                * exp(fwd_beta[56] * tc[0] - activation_units[56] * fwd_Ea[56] * invT);
+    k_f = k_f_s[56];
     dlnkfdT = fwd_beta[56] * invT + activation_units[56] * fwd_Ea[56] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[14];
-    Kc = exp(g_RT[4] - g_RT[5] + g_RT[13] - g_RT[14]);
+    Kc = Kc_s[56];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[13]) + (h_RT[5] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -9632,12 +9676,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[13];
-    k_f = prefactor_units[57] * fwd_A[57]
-                * exp(fwd_beta[57] * tc[0] - activation_units[57] * fwd_Ea[57] * invT);
+    k_f = k_f_s[57];
     dlnkfdT = fwd_beta[57] * invT + activation_units[57] * fwd_Ea[57] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[4]*sc[14];
-    Kc = refC * exp(-g_RT[0] + g_RT[4] - g_RT[4] + g_RT[13] - g_RT[14]);
+    Kc = Kc_s[57];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[13]) + (h_RT[0] + h_RT[4] + h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -9685,6 +9728,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         dcvpRdT(dcRdT, tc);
         speciesInternalEnergy(e_RT, tc);
         eh_RT = &e_RT[0];
+        for (int k=0; k<15; k++) {
+            for (int m=0; m<15; m++) {
+                J[k*16+m] += Jmix[m];
+            }
+        }
     }
 
     double cmix = 0.0, ehmix = 0.0, dcmixdT=0.0, dehmixdT=0.0;
@@ -12013,6 +12061,55 @@ void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double
     *ierr = 0;
     return;
 }
+/* get temperature given enthalpy in mass units and mass fracs */
+void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int * ierr)
+{
+#ifdef CONVERGENCE
+    const int maxiter = 5000;
+    const double tol  = 1.e-12;
+#else
+    const int maxiter = 200;
+    const double tol  = 1.e-6;
+#endif
+    double hin  = *h;
+    double tmin = 250;/*max lower bound for thermo def */
+    double tmax = 4000;/*min upper bound for thermo def */
+    double h1,hmin,hmax,cp,t1,dt;
+    int i;/* loop counter */
+    CKHBMS(&tmin, y, iwrk, rwrk, &hmin);
+    CKHBMS(&tmax, y, iwrk, rwrk, &hmax);
+    if (hin < hmin) {
+        /*Linear Extrapolation below tmin */
+        CKCPBS(&tmin, y, iwrk, rwrk, &cp);
+        *t = tmin - (hmin-hin)/cp;
+        *ierr = 1;
+        return;
+    }
+    if (hin > hmax) {
+        /*Linear Extrapolation above tmax */
+        CKCPBS(&tmax, y, iwrk, rwrk, &cp);
+        *t = tmax - (hmax-hin)/cp;
+        *ierr = 1;
+        return;
+    }
+    t1 = *t;
+    if (t1 < tmin || t1 > tmax) {
+        t1 = tmin + (tmax-tmin)/(hmax-hmin)*(hin-hmin);
+    }
+    for (i = 0; i < maxiter; ++i) {
+        CKHBMS(&t1,y,iwrk,rwrk,&h1);
+        CKCPBS(&t1,y,iwrk,rwrk,&cp);
+        dt = (hin - h1) / cp;
+        if (dt > 100.) { dt = 100.; }
+        else if (dt < -100.) { dt = -100.; }
+        else if (fabs(dt) < tol) break;
+        else if (t1+dt == t1) break;
+        t1 += dt;
+    }
+    *t = t1;
+    *ierr = 0;
+    return;
+}
 
 /* End of file  */
 #if defined(BL_FORT_USE_UPPERCASE)
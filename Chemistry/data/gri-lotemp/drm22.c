@@ -1,5 +1,6 @@
 
 #include <math.h>
+#include <float.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -86,7 +87,14 @@
 #define VCKPY VCKPY
 #define VCKWYR VCKWYR
 #define VCKYTX VCKYTX
+#define VCKCPBS VCKCPBS
+#define VCKCVBS VCKCVBS
+#define VCKHBMS VCKHBMS
+#define VCKUBMS VCKUBMS
+#define VCKRHOY VCKRHOY
+#define VCKMMWY VCKMMWY
 #define GET_T_GIVEN_EY GET_T_GIVEN_EY
+#define GET_T_GIVEN_HY GET_T_GIVEN_HY
 #define GET_REACTION_MAP GET_REACTION_MAP
 #elif defined(BL_FORT_USE_LOWERCASE)
 #define CKINDX ckindx
@@ -170,7 +178,14 @@
 #define VCKPY vckpy
 #define VCKWYR vckwyr
 #define VCKYTX vckytx
+#define VCKCPBS vckcpbs
+#define VCKCVBS vckcvbs
+#define VCKHBMS vckhbms
+#define VCKUBMS vckubms
+#define VCKRHOY vckrhoy
+#define VCKMMWY vckmmwy
 #define GET_T_GIVEN_EY get_t_given_ey
+#define GET_T_GIVEN_HY get_t_given_hy
 #define GET_REACTION_MAP get_reaction_map
 #elif defined(BL_FORT_USE_UNDERSCORE)
 #define CKINDX ckindx_
@@ -254,7 +269,14 @@
 #define VCKPY vckpy_
 #define VCKWYR vckwyr_
 #define VCKYTX vckytx_
+#define VCKCPBS vckcpbs_
+#define VCKCVBS vckcvbs_
+#define VCKHBMS vckhbms_
+#define VCKUBMS vckubms_
+#define VCKRHOY vckrhoy_
+#define VCKMMWY vckmmwy_
 #define GET_T_GIVEN_EY get_t_given_ey_
+#define GET_T_GIVEN_HY get_t_given_hy_
 #define GET_REACTION_MAP get_reaction_map_
 #endif
 
@@ -356,6 +378,7 @@ void DWDOT(double * restrict J, double * restrict sc, double * restrict T, int *
 void aJacobian(double * restrict J, double * restrict sc, double T, int consP);
 void dcvpRdT(double * restrict species, double * restrict tc);
 void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
+void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
 void GET_REACTION_MAP(int * restrict rmap);
 /*vector version */
 void vproductionRate(int npt, double * restrict wdot, double * restrict c, double * restrict T);
@@ -365,6 +388,12 @@ void VCKWYR(int * restrict np, double * restrict rho, double * restrict T,
             double * restrict y, int * restrict iwrk, double * restrict rwrk,
             double * restrict wdot);
 void VCKYTX(int * restrict np, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict x);
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs);
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs);
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms);
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms);
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho);
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm);
 void vcomp_k_f(int npt, double * restrict k_f_s, double * restrict tc, double * restrict invT);
 void vcomp_gibbs(int npt, double * restrict g_RT, double * restrict tc);
 void vcomp_Kc(int npt, double * restrict Kc_s, double * restrict g_RT, double * restrict invT);
@@ -1928,38 +1957,6 @@ void CKINDX(int * iwrk, double * restrict rwrk, int * mm, int * kk, int * ii, in
 }
 
 
-/* strtok_r: re-entrant (threadsafe) version of strtok, helper function for tokenizing strings  */
-char *strtok_r(char *s, const char *delim, char **save_ptr)
-{
-    char *token;
-
-    if (s == NULL)
-        s = *save_ptr;
-
-    /* Scan leading delimiters.  */
-    s += strspn (s, delim);
-    if (*s == '\0')
-    {
-        *save_ptr = s;
-        return NULL;
-    }
-
-    /* Find the end of the token.  */
-    token = s;
-    s = strpbrk (token, delim);
-    if (s == NULL)
-        /* This token finishes the string.  */
-        *save_ptr = __rawmemchr (token, '\0');
-    else
-    {
-        /* Terminate the token and make *SAVE_PTR point past it.  */
-        *s = '\0';
-        *save_ptr = s + 1;
-    }
-    return token;
-}
-
-
 
 /* ckxnum... for parsing strings  */
 void CKXNUM(char * line, int * nexp, int * lout, int * nval, double * restrict rval, int * kerr, int lenline )
@@ -2387,6 +2384,28 @@ void CKRHOY(double * restrict P, double * restrict T, double * restrict y, int *
 }
 
 
+/*Compute rho = P*W(y)/RT */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho)
+{
+    for (int i=0; i<(*np); i++) {
+        rho[i] = 0.0;
+    }
+
+    for (int n=0; n<24; n++) {
+        for (int i=0; i<(*np); i++) {
+            rho[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        rho[i] = P[i] / (8.31451e+07 * T[i] * rho[i]);/*rho = P*W/(R*T) */
+    }
+
+    return;
+}
+
+
 /*Compute rho = P*W(c)/(R*T) */
 void CKRHOC(double * restrict P, double * restrict T, double * restrict c, int * iwrk, double * restrict rwrk, double * restrict rho)
 {
@@ -2463,6 +2482,29 @@ void CKMMWY(double * restrict y, int * iwrk, double * restrict rwrk, double * re
 }
 
 
+/*given y[species]: mass fractions */
+/*returns mean molecular weight (gm/mole) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm)
+{
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 0.0;
+    }
+
+    for (int n=0; n<24; n++) {
+        for (int i=0; i<(*np); i++) {
+            wtm[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 1.0 / wtm[i];
+    }
+
+    return;
+}
+
+
 /*given x[species]: mole fractions */
 /*returns mean molecular weight (gm/mole) */
 void CKMMWX(double * restrict x, int * iwrk, double * restrict rwrk, double * restrict wtm)
@@ -3223,6 +3265,30 @@ void CKCPBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CP (Eq. 34) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs)
+{
+    double tc[5], tmp[24], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cp_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<24; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cpbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean specific heat at CV (Eq. 35) */
 void CKCVBL(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict cvbl)
 {
@@ -3280,6 +3346,30 @@ void CKCVBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CV (Eq. 36) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs)
+{
+    double tc[5], tmp[24], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cv_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<24; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cvbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean enthalpy of the mixture in molar units */
 void CKHBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict hbml)
 {
@@ -3321,6 +3411,30 @@ void CKHBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns mean enthalpy of mixture in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms)
+{
+    double tc[5], tmp[24], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesEnthalpy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<24; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        hbms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mean internal energy in molar units */
 void CKUBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict ubml)
 {
@@ -3380,6 +3494,30 @@ void CKUBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*get mean internal energy in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms)
+{
+    double tc[5], tmp[24], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesInternalEnergy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<24; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        ubms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mixture entropy in molar units */
 void CKSBML(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict sbml)
 {
@@ -7207,12 +7345,126 @@ void productionRate(double * restrict wdot, double * restrict sc, double T)
 
 void comp_k_f(double * restrict tc, double invT, double * restrict k_f)
 {
+    double x[104];
+#ifdef __INTEL_COMPILER
+    #pragma simd
+#endif
+    for (int i=0; i<104; ++i) {
+        x[i] = fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT;
+    };
+
+    /*the exp is skipped when the exponent is zero or that of */
+    /*an earlier reaction with the same default beta and Ea */
+    k_f[0] = exp(x[0]);
+    k_f[1] = exp(x[1]);
+    k_f[2] = exp(x[2]);
+    k_f[3] = exp(x[3]);
+    k_f[4] = exp(x[4]);
+    k_f[5] = exp(x[5]);
+    k_f[6] = exp(x[6]);
+    k_f[7] = exp(x[7]);
+    k_f[8] = exp(x[8]);
+    k_f[9] = exp(x[9]);
+    k_f[10] = exp(x[10]);
+    k_f[11] = exp(x[11]);
+    k_f[12] = exp(x[12]);
+    k_f[13] = exp(x[13]);
+    k_f[14] = exp(x[14]);
+    k_f[15] = (x[15] == x[12] ? k_f[12] : exp(x[15]));
+    k_f[16] = exp(x[16]);
+    k_f[17] = exp(x[17]);
+    k_f[18] = exp(x[18]);
+    k_f[19] = (x[19] == 0.0 ? 1.0 : exp(x[19]));
+    k_f[20] = (x[20] == 0.0 ? 1.0 : exp(x[20]));
+    k_f[21] = (x[21] == 0.0 ? 1.0 : exp(x[21]));
+    k_f[22] = (x[22] == 0.0 ? 1.0 : exp(x[22]));
+    k_f[23] = exp(x[23]);
+    k_f[24] = (x[24] == 0.0 ? 1.0 : exp(x[24]));
+    k_f[25] = (x[25] == 0.0 ? 1.0 : exp(x[25]));
+    k_f[26] = exp(x[26]);
+    k_f[27] = exp(x[27]);
+    k_f[28] = (x[28] == x[27] ? k_f[27] : exp(x[28]));
+    k_f[29] = exp(x[29]);
+    k_f[30] = (x[30] == 0.0 ? 1.0 : exp(x[30]));
+    k_f[31] = exp(x[31]);
+    k_f[32] = exp(x[32]);
+    k_f[33] = exp(x[33]);
+    k_f[34] = exp(x[34]);
+    k_f[35] = exp(x[35]);
+    k_f[36] = (x[36] == x[34] ? k_f[34] : exp(x[36]));
+    k_f[37] = (x[37] == x[0] ? k_f[0] : exp(x[37]));
+    k_f[38] = exp(x[38]);
+    k_f[39] = exp(x[39]);
+    k_f[40] = exp(x[40]);
+    k_f[41] = (x[41] == x[16] ? k_f[16] : exp(x[41]));
+    k_f[42] = exp(x[42]);
+    k_f[43] = exp(x[43]);
+    k_f[44] = exp(x[44]);
+    k_f[45] = exp(x[45]);
+    k_f[46] = (x[46] == 0.0 ? 1.0 : exp(x[46]));
+    k_f[47] = exp(x[47]);
+    k_f[48] = (x[48] == 0.0 ? 1.0 : exp(x[48]));
+    k_f[49] = (x[49] == 0.0 ? 1.0 : exp(x[49]));
+    k_f[50] = exp(x[50]);
+    k_f[51] = exp(x[51]);
+    k_f[52] = exp(x[52]);
+    k_f[53] = exp(x[53]);
+    k_f[54] = exp(x[54]);
+    k_f[55] = exp(x[55]);
+    k_f[56] = (x[56] == 0.0 ? 1.0 : exp(x[56]));
+    k_f[57] = (x[57] == 0.0 ? 1.0 : exp(x[57]));
+    k_f[58] = exp(x[58]);
+    k_f[59] = (x[59] == 0.0 ? 1.0 : exp(x[59]));
+    k_f[60] = exp(x[60]);
+    k_f[61] = exp(x[61]);
+    k_f[62] = (x[62] == 0.0 ? 1.0 : exp(x[62]));
+    k_f[63] = exp(x[63]);
+    k_f[64] = exp(x[64]);
+    k_f[65] = (x[65] == 0.0 ? 1.0 : exp(x[65]));
+    k_f[66] = exp(x[66]);
+    k_f[67] = exp(x[67]);
+    k_f[68] = exp(x[68]);
+    k_f[69] = exp(x[69]);
+    k_f[70] = (x[70] == 0.0 ? 1.0 : exp(x[70]));
+    k_f[71] = (x[71] == 0.0 ? 1.0 : exp(x[71]));
+    k_f[72] = (x[72] == 0.0 ? 1.0 : exp(x[72]));
+    k_f[73] = exp(x[73]);
+    k_f[74] = exp(x[74]);
+    k_f[75] = exp(x[75]);
+    k_f[76] = exp(x[76]);
+    k_f[77] = (x[77] == 0.0 ? 1.0 : exp(x[77]));
+    k_f[78] = (x[78] == 0.0 ? 1.0 : exp(x[78]));
+    k_f[79] = exp(x[79]);
+    k_f[80] = exp(x[80]);
+    k_f[81] = (x[81] == x[80] ? k_f[80] : exp(x[81]));
+    k_f[82] = (x[82] == 0.0 ? 1.0 : exp(x[82]));
+    k_f[83] = (x[83] == 0.0 ? 1.0 : exp(x[83]));
+    k_f[84] = (x[84] == 0.0 ? 1.0 : exp(x[84]));
+    k_f[85] = (x[85] == 0.0 ? 1.0 : exp(x[85]));
+    k_f[86] = exp(x[86]);
+    k_f[87] = (x[87] == x[86] ? k_f[86] : exp(x[87]));
+    k_f[88] = (x[88] == 0.0 ? 1.0 : exp(x[88]));
+    k_f[89] = (x[89] == 0.0 ? 1.0 : exp(x[89]));
+    k_f[90] = (x[90] == 0.0 ? 1.0 : exp(x[90]));
+    k_f[91] = exp(x[91]);
+    k_f[92] = exp(x[92]);
+    k_f[93] = exp(x[93]);
+    k_f[94] = exp(x[94]);
+    k_f[95] = (x[95] == 0.0 ? 1.0 : exp(x[95]));
+    k_f[96] = exp(x[96]);
+    k_f[97] = exp(x[97]);
+    k_f[98] = exp(x[98]);
+    k_f[99] = (x[99] == x[17] ? k_f[17] : exp(x[99]));
+    k_f[100] = exp(x[100]);
+    k_f[101] = exp(x[101]);
+    k_f[102] = exp(x[102]);
+    k_f[103] = exp(x[103]);
+
 #ifdef __INTEL_COMPILER
     #pragma simd
 #endif
     for (int i=0; i<104; ++i) {
-        k_f[i] = prefactor_units[i] * fwd_A[i]
-                    * exp(fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT);
+        k_f[i] *= prefactor_units[i] * fwd_A[i];
     };
     return;
 }
@@ -7223,149 +7475,266 @@ void comp_Kc(double * restrict tc, double invT, double * restrict Kc)
     double g_RT[24];
     gibbs(g_RT, tc);
 
-    Kc[0] = g_RT[1] + g_RT[8] - g_RT[10];
-    Kc[1] = g_RT[1] + g_RT[10] - g_RT[11];
-    Kc[2] = g_RT[1] + g_RT[14] - g_RT[15];
-    Kc[3] = g_RT[1] + g_RT[15] - g_RT[16];
-    Kc[4] = g_RT[1] + g_RT[17] - g_RT[18];
-    Kc[5] = g_RT[1] + g_RT[18] - g_RT[19];
-    Kc[6] = g_RT[1] + g_RT[19] - g_RT[20];
-    Kc[7] = g_RT[1] + g_RT[20] - g_RT[21];
-    Kc[8] = g_RT[0] + g_RT[12] - g_RT[15];
-    Kc[9] = 2*g_RT[4] - g_RT[7];
-    Kc[10] = 2*g_RT[10] - g_RT[21];
-    Kc[11] = -g_RT[0] - g_RT[17] + g_RT[19];
-    Kc[12] = g_RT[1] + g_RT[2] - g_RT[4];
-    Kc[13] = g_RT[2] + g_RT[12] - g_RT[13];
-    Kc[14] = g_RT[1] + g_RT[3] - g_RT[6];
-    Kc[15] = -g_RT[0] + 2*g_RT[1];
-    Kc[16] = g_RT[1] + g_RT[4] - g_RT[5];
-    Kc[17] = -g_RT[1] - g_RT[12] + g_RT[14];
-    Kc[18] = g_RT[0] - g_RT[1] + g_RT[2] - g_RT[4];
-    Kc[19] = g_RT[2] - g_RT[3] - g_RT[4] + g_RT[6];
-    Kc[20] = -g_RT[1] + g_RT[2] + g_RT[8] - g_RT[14];
-    Kc[21] = -g_RT[1] + g_RT[2] + g_RT[9] - g_RT[14];
-    Kc[22] = -g_RT[1] + g_RT[2] + g_RT[10] - g_RT[15];
-    Kc[23] = g_RT[2] - g_RT[4] - g_RT[10] + g_RT[11];
-    Kc[24] = g_RT[2] - g_RT[4] - g_RT[12] + g_RT[14];
-    Kc[25] = -g_RT[1] + g_RT[2] - g_RT[13] + g_RT[14];
-    Kc[26] = g_RT[2] - g_RT[4] - g_RT[14] + g_RT[15];
-    Kc[27] = g_RT[2] - g_RT[9] - g_RT[12] + g_RT[17];
-    Kc[28] = g_RT[2] - g_RT[8] - g_RT[12] + g_RT[17];
-    Kc[29] = g_RT[2] - g_RT[10] - g_RT[14] + g_RT[19];
-    Kc[30] = g_RT[2] - g_RT[10] - g_RT[15] + g_RT[20];
-    Kc[31] = g_RT[2] - g_RT[4] - g_RT[20] + g_RT[21];
-    Kc[32] = -g_RT[2] + g_RT[3] + g_RT[12] - g_RT[13];
-    Kc[33] = g_RT[3] - g_RT[6] - g_RT[14] + g_RT[15];
-    Kc[34] = g_RT[1] + 2*g_RT[3] - g_RT[3] - g_RT[6];
-    Kc[35] = g_RT[1] + g_RT[3] + g_RT[5] - g_RT[5] - g_RT[6];
-    Kc[36] = g_RT[1] + g_RT[3] - g_RT[6] + g_RT[22] - g_RT[22];
-    Kc[37] = g_RT[1] + g_RT[3] - g_RT[6] + g_RT[23] - g_RT[23];
-    Kc[38] = g_RT[1] - g_RT[2] + g_RT[3] - g_RT[4];
-    Kc[39] = g_RT[0] - 2*g_RT[0] + 2*g_RT[1];
-    Kc[40] = -g_RT[0] + 2*g_RT[1] + g_RT[5] - g_RT[5];
-    Kc[41] = -g_RT[0] + 2*g_RT[1] + g_RT[13] - g_RT[13];
-    Kc[42] = -g_RT[0] + g_RT[1] - g_RT[3] + g_RT[6];
-    Kc[43] = g_RT[1] - 2*g_RT[4] + g_RT[6];
-    Kc[44] = -g_RT[0] + g_RT[1] - g_RT[6] + g_RT[7];
-    Kc[45] = -g_RT[0] + g_RT[1] - g_RT[10] + g_RT[11];
-    Kc[46] = -g_RT[0] + g_RT[1] - g_RT[12] + g_RT[14];
-    Kc[47] = -g_RT[0] + g_RT[1] - g_RT[14] + g_RT[15];
-    Kc[48] = g_RT[1] - g_RT[4] - g_RT[10] + g_RT[16];
-    Kc[49] = -g_RT[0] + g_RT[1] - g_RT[17] + g_RT[18];
-    Kc[50] = -g_RT[0] + g_RT[1] - g_RT[18] + g_RT[19];
-    Kc[51] = -g_RT[0] + g_RT[1] - g_RT[20] + g_RT[21];
-    Kc[52] = g_RT[0] - g_RT[1] + g_RT[4] - g_RT[5];
-    Kc[53] = -g_RT[2] + 2*g_RT[4] - g_RT[5];
-    Kc[54] = -g_RT[3] + g_RT[4] - g_RT[5] + g_RT[6];
-    Kc[55] = g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7];
-    Kc[56] = -g_RT[1] + g_RT[4] + g_RT[8] - g_RT[15];
-    Kc[57] = -g_RT[1] + g_RT[4] + g_RT[9] - g_RT[15];
-    Kc[58] = g_RT[4] - g_RT[5] - g_RT[8] + g_RT[10];
-    Kc[59] = g_RT[4] - g_RT[5] - g_RT[9] + g_RT[10];
-    Kc[60] = g_RT[4] - g_RT[5] - g_RT[10] + g_RT[11];
-    Kc[61] = -g_RT[1] + g_RT[4] + g_RT[12] - g_RT[13];
-    Kc[62] = g_RT[4] - g_RT[5] - g_RT[12] + g_RT[14];
-    Kc[63] = g_RT[4] - g_RT[5] - g_RT[14] + g_RT[15];
-    Kc[64] = g_RT[4] - g_RT[10] - g_RT[12] + g_RT[17];
-    Kc[65] = g_RT[4] - g_RT[5] - g_RT[17] + g_RT[18];
-    Kc[66] = g_RT[4] - g_RT[5] - g_RT[18] + g_RT[19];
-    Kc[67] = g_RT[4] - g_RT[5] - g_RT[20] + g_RT[21];
-    Kc[68] = -g_RT[3] + 2*g_RT[6] - g_RT[7];
-    Kc[69] = -g_RT[3] + 2*g_RT[6] - g_RT[7];
-    Kc[70] = -g_RT[4] + g_RT[6] + g_RT[8] - g_RT[15];
-    Kc[71] = -g_RT[3] + g_RT[6] + g_RT[10] - g_RT[11];
-    Kc[72] = -g_RT[4] + g_RT[6] + g_RT[10] - g_RT[16];
-    Kc[73] = -g_RT[4] + g_RT[6] + g_RT[12] - g_RT[13];
-    Kc[74] = g_RT[6] - g_RT[7] - g_RT[14] + g_RT[15];
-    Kc[75] = g_RT[3] - g_RT[4] + g_RT[8] - g_RT[14];
-    Kc[76] = g_RT[0] - g_RT[1] + g_RT[8] - g_RT[10];
-    Kc[77] = -g_RT[0] + 2*g_RT[8] - g_RT[17];
-    Kc[78] = -g_RT[1] + g_RT[8] + g_RT[10] - g_RT[19];
-    Kc[79] = g_RT[8] - 2*g_RT[10] + g_RT[11];
-    Kc[80] = -g_RT[8] + g_RT[9] + g_RT[22] - g_RT[22];
-    Kc[81] = -g_RT[8] + g_RT[9] + g_RT[23] - g_RT[23];
-    Kc[82] = -g_RT[1] + g_RT[3] - g_RT[4] + g_RT[9] - g_RT[12];
-    Kc[83] = g_RT[3] - g_RT[5] + g_RT[9] - g_RT[12];
-    Kc[84] = g_RT[0] - g_RT[1] + g_RT[9] - g_RT[10];
-    Kc[85] = g_RT[5] - g_RT[5] - g_RT[8] + g_RT[9];
-    Kc[86] = -g_RT[1] + g_RT[9] + g_RT[10] - g_RT[19];
-    Kc[87] = g_RT[9] - 2*g_RT[10] + g_RT[11];
-    Kc[88] = -g_RT[8] + g_RT[9] + g_RT[12] - g_RT[12];
-    Kc[89] = -g_RT[8] + g_RT[9] + g_RT[13] - g_RT[13];
-    Kc[90] = g_RT[9] - g_RT[12] + g_RT[13] - g_RT[15];
-    Kc[91] = -g_RT[2] + g_RT[3] + g_RT[10] - g_RT[16];
-    Kc[92] = g_RT[3] - g_RT[4] + g_RT[10] - g_RT[15];
-    Kc[93] = -g_RT[6] + g_RT[7] + g_RT[10] - g_RT[11];
-    Kc[94] = -g_RT[1] + 2*g_RT[10] - g_RT[20];
-    Kc[95] = g_RT[10] - g_RT[11] - g_RT[12] + g_RT[14];
-    Kc[96] = g_RT[10] - g_RT[11] - g_RT[14] + g_RT[15];
-    Kc[97] = g_RT[10] - g_RT[11] - g_RT[18] + g_RT[19];
-    Kc[98] = g_RT[10] - g_RT[11] - g_RT[20] + g_RT[21];
-    Kc[99] = -g_RT[1] + g_RT[5] - g_RT[5] - g_RT[12] + g_RT[14];
-    Kc[100] = g_RT[3] - g_RT[6] - g_RT[12] + g_RT[14];
-    Kc[101] = g_RT[3] - g_RT[6] - g_RT[15] + g_RT[16];
-    Kc[102] = g_RT[3] - g_RT[14] - g_RT[15] + g_RT[18];
-    Kc[103] = g_RT[3] - g_RT[6] - g_RT[19] + g_RT[20];
-
-#ifdef __INTEL_COMPILER
-     #pragma simd
-#endif
-    for (int i=0; i<104; ++i) {
-        Kc[i] = exp(Kc[i]);
-    };
-
     /*reference concentration: P_atm / (RT) in inverse mol/m^3 */
     double refC = 101325 / 8.31451 * invT;
     double refCinv = 1 / refC;
 
-    Kc[0] *= refCinv;
-    Kc[1] *= refCinv;
-    Kc[2] *= refCinv;
-    Kc[3] *= refCinv;
-    Kc[4] *= refCinv;
-    Kc[5] *= refCinv;
-    Kc[6] *= refCinv;
-    Kc[7] *= refCinv;
-    Kc[8] *= refCinv;
-    Kc[9] *= refCinv;
-    Kc[10] *= refCinv;
-    Kc[11] *= refC;
-    Kc[12] *= refCinv;
-    Kc[13] *= refCinv;
-    Kc[14] *= refCinv;
-    Kc[15] *= refCinv;
-    Kc[16] *= refCinv;
-    Kc[17] *= refC;
-    Kc[34] *= refCinv;
-    Kc[35] *= refCinv;
-    Kc[36] *= refCinv;
-    Kc[37] *= refCinv;
-    Kc[39] *= refCinv;
-    Kc[40] *= refCinv;
-    Kc[41] *= refCinv;
-    Kc[82] *= refC;
-    Kc[99] *= refC;
+    /*Kc as the ratio of the products of the species exp(g_RT)/refC, unless */
+    /*the product over a side of a reaction leaves the normal range */
+    double e_g[24], den[104];
+    for (int k=0; k<24; ++k) {
+        e_g[k] = exp(g_RT[k]) * refCinv;
+    }
+    Kc[0] = e_g[1]*e_g[8]; den[0] = e_g[10];
+    Kc[1] = e_g[1]*e_g[10]; den[1] = e_g[11];
+    Kc[2] = e_g[1]*e_g[14]; den[2] = e_g[15];
+    Kc[3] = e_g[1]*e_g[15]; den[3] = e_g[16];
+    Kc[4] = e_g[1]*e_g[17]; den[4] = e_g[18];
+    Kc[5] = e_g[1]*e_g[18]; den[5] = e_g[19];
+    Kc[6] = e_g[1]*e_g[19]; den[6] = e_g[20];
+    Kc[7] = e_g[1]*e_g[20]; den[7] = e_g[21];
+    Kc[8] = e_g[0]*e_g[12]; den[8] = e_g[15];
+    Kc[9] = e_g[4]*e_g[4]; den[9] = e_g[7];
+    Kc[10] = e_g[10]*e_g[10]; den[10] = e_g[21];
+    Kc[11] = e_g[19]; den[11] = e_g[0]*e_g[17];
+    Kc[12] = e_g[1]*e_g[2]; den[12] = e_g[4];
+    Kc[13] = e_g[2]*e_g[12]; den[13] = e_g[13];
+    Kc[14] = e_g[1]*e_g[3]; den[14] = e_g[6];
+    Kc[15] = e_g[1]*e_g[1]; den[15] = e_g[0];
+    Kc[16] = e_g[1]*e_g[4]; den[16] = e_g[5];
+    Kc[17] = e_g[14]; den[17] = e_g[1]*e_g[12];
+    Kc[18] = e_g[0]*e_g[2]; den[18] = e_g[1]*e_g[4];
+    Kc[19] = e_g[2]*e_g[6]; den[19] = e_g[3]*e_g[4];
+    Kc[20] = e_g[2]*e_g[8]; den[20] = e_g[1]*e_g[14];
+    Kc[21] = e_g[2]*e_g[9]; den[21] = e_g[1]*e_g[14];
+    Kc[22] = e_g[2]*e_g[10]; den[22] = e_g[1]*e_g[15];
+    Kc[23] = e_g[2]*e_g[11]; den[23] = e_g[4]*e_g[10];
+    Kc[24] = e_g[2]*e_g[14]; den[24] = e_g[4]*e_g[12];
+    Kc[25] = e_g[2]*e_g[14]; den[25] = e_g[1]*e_g[13];
+    Kc[26] = e_g[2]*e_g[15]; den[26] = e_g[4]*e_g[14];
+    Kc[27] = e_g[2]*e_g[17]; den[27] = e_g[9]*e_g[12];
+    Kc[28] = e_g[2]*e_g[17]; den[28] = e_g[8]*e_g[12];
+    Kc[29] = e_g[2]*e_g[19]; den[29] = e_g[10]*e_g[14];
+    Kc[30] = e_g[2]*e_g[20]; den[30] = e_g[10]*e_g[15];
+    Kc[31] = e_g[2]*e_g[21]; den[31] = e_g[4]*e_g[20];
+    Kc[32] = e_g[3]*e_g[12]; den[32] = e_g[2]*e_g[13];
+    Kc[33] = e_g[3]*e_g[15]; den[33] = e_g[6]*e_g[14];
+    Kc[34] = e_g[1]*e_g[3]*e_g[3]; den[34] = e_g[3]*e_g[6];
+    Kc[35] = e_g[1]*e_g[3]*e_g[5]; den[35] = e_g[5]*e_g[6];
+    Kc[36] = e_g[1]*e_g[3]*e_g[22]; den[36] = e_g[6]*e_g[22];
+    Kc[37] = e_g[1]*e_g[3]*e_g[23]; den[37] = e_g[6]*e_g[23];
+    Kc[38] = e_g[1]*e_g[3]; den[38] = e_g[2]*e_g[4];
+    Kc[39] = e_g[0]*e_g[1]*e_g[1]; den[39] = e_g[0]*e_g[0];
+    Kc[40] = e_g[1]*e_g[1]*e_g[5]; den[40] = e_g[0]*e_g[5];
+    Kc[41] = e_g[1]*e_g[1]*e_g[13]; den[41] = e_g[0]*e_g[13];
+    Kc[42] = e_g[1]*e_g[6]; den[42] = e_g[0]*e_g[3];
+    Kc[43] = e_g[1]*e_g[6]; den[43] = e_g[4]*e_g[4];
+    Kc[44] = e_g[1]*e_g[7]; den[44] = e_g[0]*e_g[6];
+    Kc[45] = e_g[1]*e_g[11]; den[45] = e_g[0]*e_g[10];
+    Kc[46] = e_g[1]*e_g[14]; den[46] = e_g[0]*e_g[12];
+    Kc[47] = e_g[1]*e_g[15]; den[47] = e_g[0]*e_g[14];
+    Kc[48] = e_g[1]*e_g[16]; den[48] = e_g[4]*e_g[10];
+    Kc[49] = e_g[1]*e_g[18]; den[49] = e_g[0]*e_g[17];
+    Kc[50] = e_g[1]*e_g[19]; den[50] = e_g[0]*e_g[18];
+    Kc[51] = e_g[1]*e_g[21]; den[51] = e_g[0]*e_g[20];
+    Kc[52] = e_g[0]*e_g[4]; den[52] = e_g[1]*e_g[5];
+    Kc[53] = e_g[4]*e_g[4]; den[53] = e_g[2]*e_g[5];
+    Kc[54] = e_g[4]*e_g[6]; den[54] = e_g[3]*e_g[5];
+    Kc[55] = e_g[4]*e_g[7]; den[55] = e_g[5]*e_g[6];
+    Kc[56] = e_g[4]*e_g[8]; den[56] = e_g[1]*e_g[15];
+    Kc[57] = e_g[4]*e_g[9]; den[57] = e_g[1]*e_g[15];
+    Kc[58] = e_g[4]*e_g[10]; den[58] = e_g[5]*e_g[8];
+    Kc[59] = e_g[4]*e_g[10]; den[59] = e_g[5]*e_g[9];
+    Kc[60] = e_g[4]*e_g[11]; den[60] = e_g[5]*e_g[10];
+    Kc[61] = e_g[4]*e_g[12]; den[61] = e_g[1]*e_g[13];
+    Kc[62] = e_g[4]*e_g[14]; den[62] = e_g[5]*e_g[12];
+    Kc[63] = e_g[4]*e_g[15]; den[63] = e_g[5]*e_g[14];
+    Kc[64] = e_g[4]*e_g[17]; den[64] = e_g[10]*e_g[12];
+    Kc[65] = e_g[4]*e_g[18]; den[65] = e_g[5]*e_g[17];
+    Kc[66] = e_g[4]*e_g[19]; den[66] = e_g[5]*e_g[18];
+    Kc[67] = e_g[4]*e_g[21]; den[67] = e_g[5]*e_g[20];
+    Kc[68] = e_g[6]*e_g[6]; den[68] = e_g[3]*e_g[7];
+    Kc[69] = e_g[6]*e_g[6]; den[69] = e_g[3]*e_g[7];
+    Kc[70] = e_g[6]*e_g[8]; den[70] = e_g[4]*e_g[15];
+    Kc[71] = e_g[6]*e_g[10]; den[71] = e_g[3]*e_g[11];
+    Kc[72] = e_g[6]*e_g[10]; den[72] = e_g[4]*e_g[16];
+    Kc[73] = e_g[6]*e_g[12]; den[73] = e_g[4]*e_g[13];
+    Kc[74] = e_g[6]*e_g[15]; den[74] = e_g[7]*e_g[14];
+    Kc[75] = e_g[3]*e_g[8]; den[75] = e_g[4]*e_g[14];
+    Kc[76] = e_g[0]*e_g[8]; den[76] = e_g[1]*e_g[10];
+    Kc[77] = e_g[8]*e_g[8]; den[77] = e_g[0]*e_g[17];
+    Kc[78] = e_g[8]*e_g[10]; den[78] = e_g[1]*e_g[19];
+    Kc[79] = e_g[8]*e_g[11]; den[79] = e_g[10]*e_g[10];
+    Kc[80] = e_g[9]*e_g[22]; den[80] = e_g[8]*e_g[22];
+    Kc[81] = e_g[9]*e_g[23]; den[81] = e_g[8]*e_g[23];
+    Kc[82] = e_g[3]*e_g[9]; den[82] = e_g[1]*e_g[4]*e_g[12];
+    Kc[83] = e_g[3]*e_g[9]; den[83] = e_g[5]*e_g[12];
+    Kc[84] = e_g[0]*e_g[9]; den[84] = e_g[1]*e_g[10];
+    Kc[85] = e_g[5]*e_g[9]; den[85] = e_g[5]*e_g[8];
+    Kc[86] = e_g[9]*e_g[10]; den[86] = e_g[1]*e_g[19];
+    Kc[87] = e_g[9]*e_g[11]; den[87] = e_g[10]*e_g[10];
+    Kc[88] = e_g[9]*e_g[12]; den[88] = e_g[8]*e_g[12];
+    Kc[89] = e_g[9]*e_g[13]; den[89] = e_g[8]*e_g[13];
+    Kc[90] = e_g[9]*e_g[13]; den[90] = e_g[12]*e_g[15];
+    Kc[91] = e_g[3]*e_g[10]; den[91] = e_g[2]*e_g[16];
+    Kc[92] = e_g[3]*e_g[10]; den[92] = e_g[4]*e_g[15];
+    Kc[93] = e_g[7]*e_g[10]; den[93] = e_g[6]*e_g[11];
+    Kc[94] = e_g[10]*e_g[10]; den[94] = e_g[1]*e_g[20];
+    Kc[95] = e_g[10]*e_g[14]; den[95] = e_g[11]*e_g[12];
+    Kc[96] = e_g[10]*e_g[15]; den[96] = e_g[11]*e_g[14];
+    Kc[97] = e_g[10]*e_g[19]; den[97] = e_g[11]*e_g[18];
+    Kc[98] = e_g[10]*e_g[21]; den[98] = e_g[11]*e_g[20];
+    Kc[99] = e_g[5]*e_g[14]; den[99] = e_g[1]*e_g[5]*e_g[12];
+    Kc[100] = e_g[3]*e_g[14]; den[100] = e_g[6]*e_g[12];
+    Kc[101] = e_g[3]*e_g[16]; den[101] = e_g[6]*e_g[15];
+    Kc[102] = e_g[3]*e_g[18]; den[102] = e_g[14]*e_g[15];
+    Kc[103] = e_g[3]*e_g[20]; den[103] = e_g[6]*e_g[19];
+    int inrange = 1;
+    for (int i=0; i<104; ++i) {
+        inrange &= Kc[i] >= DBL_MIN && Kc[i] <= DBL_MAX && den[i] >= DBL_MIN && den[i] <= DBL_MAX;
+    }
+
+    if (inrange) {
+        for (int i=0; i<104; ++i) {
+            Kc[i] /= den[i];
+        }
+    }
+    else {
+        Kc[0] = exp(g_RT[1] + g_RT[8] - g_RT[10]);
+        Kc[1] = exp(g_RT[1] + g_RT[10] - g_RT[11]);
+        Kc[2] = exp(g_RT[1] + g_RT[14] - g_RT[15]);
+        Kc[3] = exp(g_RT[1] + g_RT[15] - g_RT[16]);
+        Kc[4] = exp(g_RT[1] + g_RT[17] - g_RT[18]);
+        Kc[5] = exp(g_RT[1] + g_RT[18] - g_RT[19]);
+        Kc[6] = exp(g_RT[1] + g_RT[19] - g_RT[20]);
+        Kc[7] = exp(g_RT[1] + g_RT[20] - g_RT[21]);
+        Kc[8] = exp(g_RT[0] + g_RT[12] - g_RT[15]);
+        Kc[9] = exp(2*g_RT[4] - g_RT[7]);
+        Kc[10] = exp(2*g_RT[10] - g_RT[21]);
+        Kc[11] = exp(-g_RT[0] - g_RT[17] + g_RT[19]);
+        Kc[12] = exp(g_RT[1] + g_RT[2] - g_RT[4]);
+        Kc[13] = exp(g_RT[2] + g_RT[12] - g_RT[13]);
+        Kc[14] = exp(g_RT[1] + g_RT[3] - g_RT[6]);
+        Kc[15] = exp(-g_RT[0] + 2*g_RT[1]);
+        Kc[16] = exp(g_RT[1] + g_RT[4] - g_RT[5]);
+        Kc[17] = exp(-g_RT[1] - g_RT[12] + g_RT[14]);
+        Kc[18] = exp(g_RT[0] - g_RT[1] + g_RT[2] - g_RT[4]);
+        Kc[19] = exp(g_RT[2] - g_RT[3] - g_RT[4] + g_RT[6]);
+        Kc[20] = exp(-g_RT[1] + g_RT[2] + g_RT[8] - g_RT[14]);
+        Kc[21] = exp(-g_RT[1] + g_RT[2] + g_RT[9] - g_RT[14]);
+        Kc[22] = exp(-g_RT[1] + g_RT[2] + g_RT[10] - g_RT[15]);
+        Kc[23] = exp(g_RT[2] - g_RT[4] - g_RT[10] + g_RT[11]);
+        Kc[24] = exp(g_RT[2] - g_RT[4] - g_RT[12] + g_RT[14]);
+        Kc[25] = exp(-g_RT[1] + g_RT[2] - g_RT[13] + g_RT[14]);
+        Kc[26] = exp(g_RT[2] - g_RT[4] - g_RT[14] + g_RT[15]);
+        Kc[27] = exp(g_RT[2] - g_RT[9] - g_RT[12] + g_RT[17]);
+        Kc[28] = exp(g_RT[2] - g_RT[8] - g_RT[12] + g_RT[17]);
+        Kc[29] = exp(g_RT[2] - g_RT[10] - g_RT[14] + g_RT[19]);
+        Kc[30] = exp(g_RT[2] - g_RT[10] - g_RT[15] + g_RT[20]);
+        Kc[31] = exp(g_RT[2] - g_RT[4] - g_RT[20] + g_RT[21]);
+        Kc[32] = exp(-g_RT[2] + g_RT[3] + g_RT[12] - g_RT[13]);
+        Kc[33] = exp(g_RT[3] - g_RT[6] - g_RT[14] + g_RT[15]);
+        Kc[34] = exp(g_RT[1] + 2*g_RT[3] - g_RT[3] - g_RT[6]);
+        Kc[35] = exp(g_RT[1] + g_RT[3] + g_RT[5] - g_RT[5] - g_RT[6]);
+        Kc[36] = exp(g_RT[1] + g_RT[3] - g_RT[6] + g_RT[22] - g_RT[22]);
+        Kc[37] = exp(g_RT[1] + g_RT[3] - g_RT[6] + g_RT[23] - g_RT[23]);
+        Kc[38] = exp(g_RT[1] - g_RT[2] + g_RT[3] - g_RT[4]);
+        Kc[39] = exp(g_RT[0] - 2*g_RT[0] + 2*g_RT[1]);
+        Kc[40] = exp(-g_RT[0] + 2*g_RT[1] + g_RT[5] - g_RT[5]);
+        Kc[41] = exp(-g_RT[0] + 2*g_RT[1] + g_RT[13] - g_RT[13]);
+        Kc[42] = exp(-g_RT[0] + g_RT[1] - g_RT[3] + g_RT[6]);
+        Kc[43] = exp(g_RT[1] - 2*g_RT[4] + g_RT[6]);
+        Kc[44] = exp(-g_RT[0] + g_RT[1] - g_RT[6] + g_RT[7]);
+        Kc[45] = exp(-g_RT[0] + g_RT[1] - g_RT[10] + g_RT[11]);
+        Kc[46] = exp(-g_RT[0] + g_RT[1] - g_RT[12] + g_RT[14]);
+        Kc[47] = exp(-g_RT[0] + g_RT[1] - g_RT[14] + g_RT[15]);
+        Kc[48] = exp(g_RT[1] - g_RT[4] - g_RT[10] + g_RT[16]);
+        Kc[49] = exp(-g_RT[0] + g_RT[1] - g_RT[17] + g_RT[18]);
+        Kc[50] = exp(-g_RT[0] + g_RT[1] - g_RT[18] + g_RT[19]);
+        Kc[51] = exp(-g_RT[0] + g_RT[1] - g_RT[20] + g_RT[21]);
+        Kc[52] = exp(g_RT[0] - g_RT[1] + g_RT[4] - g_RT[5]);
+        Kc[53] = exp(-g_RT[2] + 2*g_RT[4] - g_RT[5]);
+        Kc[54] = exp(-g_RT[3] + g_RT[4] - g_RT[5] + g_RT[6]);
+        Kc[55] = exp(g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7]);
+        Kc[56] = exp(-g_RT[1] + g_RT[4] + g_RT[8] - g_RT[15]);
+        Kc[57] = exp(-g_RT[1] + g_RT[4] + g_RT[9] - g_RT[15]);
+        Kc[58] = exp(g_RT[4] - g_RT[5] - g_RT[8] + g_RT[10]);
+        Kc[59] = exp(g_RT[4] - g_RT[5] - g_RT[9] + g_RT[10]);
+        Kc[60] = exp(g_RT[4] - g_RT[5] - g_RT[10] + g_RT[11]);
+        Kc[61] = exp(-g_RT[1] + g_RT[4] + g_RT[12] - g_RT[13]);
+        Kc[62] = exp(g_RT[4] - g_RT[5] - g_RT[12] + g_RT[14]);
+        Kc[63] = exp(g_RT[4] - g_RT[5] - g_RT[14] + g_RT[15]);
+        Kc[64] = exp(g_RT[4] - g_RT[10] - g_RT[12] + g_RT[17]);
+        Kc[65] = exp(g_RT[4] - g_RT[5] - g_RT[17] + g_RT[18]);
+        Kc[66] = exp(g_RT[4] - g_RT[5] - g_RT[18] + g_RT[19]);
+        Kc[67] = exp(g_RT[4] - g_RT[5] - g_RT[20] + g_RT[21]);
+        Kc[68] = exp(-g_RT[3] + 2*g_RT[6] - g_RT[7]);
+        Kc[70] = exp(-g_RT[4] + g_RT[6] + g_RT[8] - g_RT[15]);
+        Kc[71] = exp(-g_RT[3] + g_RT[6] + g_RT[10] - g_RT[11]);
+        Kc[72] = exp(-g_RT[4] + g_RT[6] + g_RT[10] - g_RT[16]);
+        Kc[73] = exp(-g_RT[4] + g_RT[6] + g_RT[12] - g_RT[13]);
+        Kc[74] = exp(g_RT[6] - g_RT[7] - g_RT[14] + g_RT[15]);
+        Kc[75] = exp(g_RT[3] - g_RT[4] + g_RT[8] - g_RT[14]);
+        Kc[76] = exp(g_RT[0] - g_RT[1] + g_RT[8] - g_RT[10]);
+        Kc[77] = exp(-g_RT[0] + 2*g_RT[8] - g_RT[17]);
+        Kc[78] = exp(-g_RT[1] + g_RT[8] + g_RT[10] - g_RT[19]);
+        Kc[79] = exp(g_RT[8] - 2*g_RT[10] + g_RT[11]);
+        Kc[80] = exp(-g_RT[8] + g_RT[9] + g_RT[22] - g_RT[22]);
+        Kc[81] = exp(-g_RT[8] + g_RT[9] + g_RT[23] - g_RT[23]);
+        Kc[82] = exp(-g_RT[1] + g_RT[3] - g_RT[4] + g_RT[9] - g_RT[12]);
+        Kc[83] = exp(g_RT[3] - g_RT[5] + g_RT[9] - g_RT[12]);
+        Kc[84] = exp(g_RT[0] - g_RT[1] + g_RT[9] - g_RT[10]);
+        Kc[85] = exp(g_RT[5] - g_RT[5] - g_RT[8] + g_RT[9]);
+        Kc[86] = exp(-g_RT[1] + g_RT[9] + g_RT[10] - g_RT[19]);
+        Kc[87] = exp(g_RT[9] - 2*g_RT[10] + g_RT[11]);
+        Kc[88] = exp(-g_RT[8] + g_RT[9] + g_RT[12] - g_RT[12]);
+        Kc[89] = exp(-g_RT[8] + g_RT[9] + g_RT[13] - g_RT[13]);
+        Kc[90] = exp(g_RT[9] - g_RT[12] + g_RT[13] - g_RT[15]);
+        Kc[91] = exp(-g_RT[2] + g_RT[3] + g_RT[10] - g_RT[16]);
+        Kc[92] = exp(g_RT[3] - g_RT[4] + g_RT[10] - g_RT[15]);
+        Kc[93] = exp(-g_RT[6] + g_RT[7] + g_RT[10] - g_RT[11]);
+        Kc[94] = exp(-g_RT[1] + 2*g_RT[10] - g_RT[20]);
+        Kc[95] = exp(g_RT[10] - g_RT[11] - g_RT[12] + g_RT[14]);
+        Kc[96] = exp(g_RT[10] - g_RT[11] - g_RT[14] + g_RT[15]);
+        Kc[97] = exp(g_RT[10] - g_RT[11] - g_RT[18] + g_RT[19]);
+        Kc[98] = exp(g_RT[10] - g_RT[11] - g_RT[20] + g_RT[21]);
+        Kc[99] = exp(-g_RT[1] + g_RT[5] - g_RT[5] - g_RT[12] + g_RT[14]);
+        Kc[100] = exp(g_RT[3] - g_RT[6] - g_RT[12] + g_RT[14]);
+        Kc[101] = exp(g_RT[3] - g_RT[6] - g_RT[15] + g_RT[16]);
+        Kc[102] = exp(g_RT[3] - g_RT[14] - g_RT[15] + g_RT[18]);
+        Kc[103] = exp(g_RT[3] - g_RT[6] - g_RT[19] + g_RT[20]);
+
+        /*reactions with the net stoichiometry of an earlier one */
+        Kc[69] = Kc[68];
+
+        Kc[0] *= refCinv;
+        Kc[1] *= refCinv;
+        Kc[2] *= refCinv;
+        Kc[3] *= refCinv;
+        Kc[4] *= refCinv;
+        Kc[5] *= refCinv;
+        Kc[6] *= refCinv;
+        Kc[7] *= refCinv;
+        Kc[8] *= refCinv;
+        Kc[9] *= refCinv;
+        Kc[10] *= refCinv;
+        Kc[11] *= refC;
+        Kc[12] *= refCinv;
+        Kc[13] *= refCinv;
+        Kc[14] *= refCinv;
+        Kc[15] *= refCinv;
+        Kc[16] *= refCinv;
+        Kc[17] *= refC;
+        Kc[34] *= refCinv;
+        Kc[35] *= refCinv;
+        Kc[36] *= refCinv;
+        Kc[37] *= refCinv;
+        Kc[39] *= refCinv;
+        Kc[40] *= refCinv;
+        Kc[41] *= refCinv;
+        Kc[82] *= refC;
+        Kc[99] *= refC;
+    }
 
     return;
 }
@@ -7797,6 +8166,9 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         mixture += sc[i];
     }
 
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[0][0] - 1)*sc[0] + (TB[0][1] - 1)*sc[5] + (TB[0][2] - 1)*sc[11] + (TB[0][3] - 1)*sc[12] + (TB[0][4] - 1)*sc[13] + (TB[0][5] - 1)*sc[21] + (TB[0][6] - 1)*sc[23];
+
     double Corr[104];
     for (int i = 0; i < 104; ++i) {
         Corr[i] = 1.0;
@@ -7805,18 +8177,18 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
     /* troe */
     {
         double alpha[12];
-        alpha[0] = mixture + (TB[0][0] - 1)*sc[0] + (TB[0][1] - 1)*sc[5] + (TB[0][2] - 1)*sc[11] + (TB[0][3] - 1)*sc[12] + (TB[0][4] - 1)*sc[13] + (TB[0][5] - 1)*sc[21] + (TB[0][6] - 1)*sc[23];
-        alpha[1] = mixture + (TB[1][0] - 1)*sc[0] + (TB[1][1] - 1)*sc[5] + (TB[1][2] - 1)*sc[11] + (TB[1][3] - 1)*sc[12] + (TB[1][4] - 1)*sc[13] + (TB[1][5] - 1)*sc[21] + (TB[1][6] - 1)*sc[23];
-        alpha[2] = mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[11] + (TB[2][3] - 1)*sc[12] + (TB[2][4] - 1)*sc[13] + (TB[2][5] - 1)*sc[21] + (TB[2][6] - 1)*sc[23];
+        alpha[0] = alpha_eff0;
+        alpha[1] = (memcmp(TB[1], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[1][0] - 1)*sc[0] + (TB[1][1] - 1)*sc[5] + (TB[1][2] - 1)*sc[11] + (TB[1][3] - 1)*sc[12] + (TB[1][4] - 1)*sc[13] + (TB[1][5] - 1)*sc[21] + (TB[1][6] - 1)*sc[23]);
+        alpha[2] = (memcmp(TB[2], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[11] + (TB[2][3] - 1)*sc[12] + (TB[2][4] - 1)*sc[13] + (TB[2][5] - 1)*sc[21] + (TB[2][6] - 1)*sc[23]);
         alpha[3] = mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[11] + (TB[3][3] - 1)*sc[12] + (TB[3][4] - 1)*sc[13] + (TB[3][5] - 1)*sc[21];
-        alpha[4] = mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[11] + (TB[4][3] - 1)*sc[12] + (TB[4][4] - 1)*sc[13] + (TB[4][5] - 1)*sc[21] + (TB[4][6] - 1)*sc[23];
-        alpha[5] = mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[11] + (TB[5][3] - 1)*sc[12] + (TB[5][4] - 1)*sc[13] + (TB[5][5] - 1)*sc[21] + (TB[5][6] - 1)*sc[23];
-        alpha[6] = mixture + (TB[6][0] - 1)*sc[0] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[11] + (TB[6][3] - 1)*sc[12] + (TB[6][4] - 1)*sc[13] + (TB[6][5] - 1)*sc[21] + (TB[6][6] - 1)*sc[23];
-        alpha[7] = mixture + (TB[7][0] - 1)*sc[0] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[11] + (TB[7][3] - 1)*sc[12] + (TB[7][4] - 1)*sc[13] + (TB[7][5] - 1)*sc[21] + (TB[7][6] - 1)*sc[23];
-        alpha[8] = mixture + (TB[8][0] - 1)*sc[0] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[11] + (TB[8][3] - 1)*sc[12] + (TB[8][4] - 1)*sc[13] + (TB[8][5] - 1)*sc[21] + (TB[8][6] - 1)*sc[23];
-        alpha[9] = mixture + (TB[9][0] - 1)*sc[0] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[11] + (TB[9][3] - 1)*sc[12] + (TB[9][4] - 1)*sc[13] + (TB[9][5] - 1)*sc[21] + (TB[9][6] - 1)*sc[23];
-        alpha[10] = mixture + (TB[10][0] - 1)*sc[0] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[11] + (TB[10][3] - 1)*sc[12] + (TB[10][4] - 1)*sc[13] + (TB[10][5] - 1)*sc[21] + (TB[10][6] - 1)*sc[23];
-        alpha[11] = mixture + (TB[11][0] - 1)*sc[0] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[11] + (TB[11][3] - 1)*sc[12] + (TB[11][4] - 1)*sc[13] + (TB[11][5] - 1)*sc[21] + (TB[11][6] - 1)*sc[23];
+        alpha[4] = (memcmp(TB[4], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[11] + (TB[4][3] - 1)*sc[12] + (TB[4][4] - 1)*sc[13] + (TB[4][5] - 1)*sc[21] + (TB[4][6] - 1)*sc[23]);
+        alpha[5] = (memcmp(TB[5], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[11] + (TB[5][3] - 1)*sc[12] + (TB[5][4] - 1)*sc[13] + (TB[5][5] - 1)*sc[21] + (TB[5][6] - 1)*sc[23]);
+        alpha[6] = (memcmp(TB[6], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[6][0] - 1)*sc[0] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[11] + (TB[6][3] - 1)*sc[12] + (TB[6][4] - 1)*sc[13] + (TB[6][5] - 1)*sc[21] + (TB[6][6] - 1)*sc[23]);
+        alpha[7] = (memcmp(TB[7], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[7][0] - 1)*sc[0] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[11] + (TB[7][3] - 1)*sc[12] + (TB[7][4] - 1)*sc[13] + (TB[7][5] - 1)*sc[21] + (TB[7][6] - 1)*sc[23]);
+        alpha[8] = (memcmp(TB[8], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[8][0] - 1)*sc[0] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[11] + (TB[8][3] - 1)*sc[12] + (TB[8][4] - 1)*sc[13] + (TB[8][5] - 1)*sc[21] + (TB[8][6] - 1)*sc[23]);
+        alpha[9] = (memcmp(TB[9], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[9][0] - 1)*sc[0] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[11] + (TB[9][3] - 1)*sc[12] + (TB[9][4] - 1)*sc[13] + (TB[9][5] - 1)*sc[21] + (TB[9][6] - 1)*sc[23]);
+        alpha[10] = (memcmp(TB[10], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[10][0] - 1)*sc[0] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[11] + (TB[10][3] - 1)*sc[12] + (TB[10][4] - 1)*sc[13] + (TB[10][5] - 1)*sc[21] + (TB[10][6] - 1)*sc[23]);
+        alpha[11] = (memcmp(TB[11], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[11][0] - 1)*sc[0] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[11] + (TB[11][3] - 1)*sc[12] + (TB[11][4] - 1)*sc[13] + (TB[11][5] - 1)*sc[21] + (TB[11][6] - 1)*sc[23]);
 #ifdef __INTEL_COMPILER
          #pragma simd
 #endif
@@ -7841,7 +8213,7 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
     /* simple three-body correction */
     {
         double alpha;
-        alpha = mixture + (TB[12][0] - 1)*sc[0] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[11] + (TB[12][3] - 1)*sc[12] + (TB[12][4] - 1)*sc[13] + (TB[12][5] - 1)*sc[21] + (TB[12][6] - 1)*sc[23];
+        alpha = (memcmp(TB[12], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[12][0] - 1)*sc[0] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[11] + (TB[12][3] - 1)*sc[12] + (TB[12][4] - 1)*sc[13] + (TB[12][5] - 1)*sc[21] + (TB[12][6] - 1)*sc[23]);
         Corr[12] = alpha;
         alpha = mixture + (TB[13][0] - 1)*sc[0] + (TB[13][1] - 1)*sc[3] + (TB[13][2] - 1)*sc[5] + (TB[13][3] - 1)*sc[11] + (TB[13][4] - 1)*sc[12] + (TB[13][5] - 1)*sc[13] + (TB[13][6] - 1)*sc[21] + (TB[13][7] - 1)*sc[23];
         Corr[13] = alpha;
@@ -9871,17 +10243,24 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         mixture += sc[k];
     }
 
-    /*compute the Gibbs free energy */
-    double g_RT[24];
-    gibbs(g_RT, tc);
-
     /*compute the species enthalpy */
     double h_RT[24];
     speciesEnthalpy(h_RT, tc);
 
+    /*compute the rate and equilibrium constants */
+    double k_f_s[104], Kc_s[104];
+    comp_k_f(tc, invT, k_f_s);
+    comp_Kc(tc, invT, Kc_s);
+
+    /*at constant volume, the part of dwdot/d[X] common to all species */
+    double Jmix[24];
+    for (int k=0; k<24; k++) {
+        Jmix[k] = 0.0;
+    }
+
     double phi_f, k_f, k_r, phi_r, Kc, q, q_nocor, Corr, alpha;
     double dlnkfdT, dlnk0dT, dlnKcdT, dkrdT, dqdT;
-    double dqdci, dcdc_fac, dqdc[24];
+    double dqdci, dcdc_fac;
     double Pr, fPr, F, k_0, logPr;
     double logFcent, troe_c, troe_n, troePr_den, troePr, troe;
     double Fcent1, Fcent2, Fcent3, Fcent;
@@ -9889,15 +10268,18 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     double dlogPrdT, dlogfPrdT, dlogFdT, dlogFcentdT, dlogFdlogPr, dlnCorrdT;
     const double ln10 = log(10.0);
     const double log10e = 1.0/log(10.0);
+
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[0][0] - 1)*sc[0] + (TB[0][1] - 1)*sc[5] + (TB[0][2] - 1)*sc[11] + (TB[0][3] - 1)*sc[12] + (TB[0][4] - 1)*sc[13] + (TB[0][5] - 1)*sc[21] + (TB[0][6] - 1)*sc[23];
+
     /*reaction 1: H + CH2 (+M) <=> CH3 (+M) */
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[0][0] - 1)*sc[0] + (TB[0][1] - 1)*sc[5] + (TB[0][2] - 1)*sc[11] + (TB[0][3] - 1)*sc[12] + (TB[0][4] - 1)*sc[13] + (TB[0][5] - 1)*sc[21] + (TB[0][6] - 1)*sc[23];
+    alpha = alpha_eff0;
     /* forward */
     phi_f = sc[1]*sc[8];
-    k_f = prefactor_units[0] * fwd_A[0]
-                * exp(fwd_beta[0] * tc[0] - activation_units[0] * fwd_Ea[0] * invT);
+    k_f = k_f_s[0];
     dlnkfdT = fwd_beta[0] * invT + activation_units[0] * fwd_Ea[0] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[0] * exp(low_beta[0] * tc[0] - activation_units[0] * low_Ea[0] * invT);
@@ -9913,16 +10295,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[0] == 4 ? exp(-troe_Tss[0] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
+      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
+      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
-      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
-      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -9930,7 +10312,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[10];
-    Kc = refCinv * exp(g_RT[1] + g_RT[8] - g_RT[10]);
+    Kc = Kc_s[0];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[8]) + (h_RT[10]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -9948,89 +10330,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[0][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[8] -= dqdci;                /* dwdot[CH2]/d[H2] */
-        J[10] += dqdci;               /* dwdot[CH3]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[8];
-        J[26] -= dqdci;               /* dwdot[H]/d[H] */
-        J[33] -= dqdci;               /* dwdot[CH2]/d[H] */
-        J[35] += dqdci;               /* dwdot[CH3]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[0][1] - 1)*dcdc_fac;
-        J[126] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[133] -= dqdci;              /* dwdot[CH2]/d[H2O] */
-        J[135] += dqdci;              /* dwdot[CH3]/d[H2O] */
-        /* d()/d[CH2] */
-        dqdci =  + k_f*sc[1];
-        J[201] -= dqdci;              /* dwdot[H]/d[CH2] */
-        J[208] -= dqdci;              /* dwdot[CH2]/d[CH2] */
-        J[210] += dqdci;              /* dwdot[CH3]/d[CH2] */
-        /* d()/d[CH3] */
-        dqdci =  - k_r;
-        J[251] -= dqdci;              /* dwdot[H]/d[CH3] */
-        J[258] -= dqdci;              /* dwdot[CH2]/d[CH3] */
-        J[260] += dqdci;              /* dwdot[CH3]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[0][2] - 1)*dcdc_fac;
-        J[276] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[283] -= dqdci;              /* dwdot[CH2]/d[CH4] */
-        J[285] += dqdci;              /* dwdot[CH3]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[0][3] - 1)*dcdc_fac;
-        J[301] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[308] -= dqdci;              /* dwdot[CH2]/d[CO] */
-        J[310] += dqdci;              /* dwdot[CH3]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[0][4] - 1)*dcdc_fac;
-        J[326] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[333] -= dqdci;              /* dwdot[CH2]/d[CO2] */
-        J[335] += dqdci;              /* dwdot[CH3]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[0][5] - 1)*dcdc_fac;
-        J[526] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[533] -= dqdci;              /* dwdot[CH2]/d[C2H6] */
-        J[535] += dqdci;              /* dwdot[CH3]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[0][6] - 1)*dcdc_fac;
-        J[576] -= dqdci;              /* dwdot[H]/d[AR] */
-        J[583] -= dqdci;              /* dwdot[CH2]/d[AR] */
-        J[585] += dqdci;              /* dwdot[CH3]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[0][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[8];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[0][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac + k_f*sc[1];
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac - k_r;
-        dqdc[11] = TB[0][2]*dcdc_fac;
-        dqdc[12] = TB[0][3]*dcdc_fac;
-        dqdc[13] = TB[0][4]*dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[0][5]*dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = TB[0][6]*dcdc_fac;
-        for (int k=0; k<24; k++) {
-            J[25*k+1] -= dqdc[k];
-            J[25*k+8] -= dqdc[k];
-            J[25*k+10] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[8] -= dcdc_fac;
+    Jmix[10] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[0][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[8] -= dqdci;                /* dwdot[CH2]/d[H2] */
+    J[10] += dqdci;               /* dwdot[CH3]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[8];
+    J[26] -= dqdci;               /* dwdot[H]/d[H] */
+    J[33] -= dqdci;               /* dwdot[CH2]/d[H] */
+    J[35] += dqdci;               /* dwdot[CH3]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[0][1] - 1)*dcdc_fac;
+    J[126] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[133] -= dqdci;              /* dwdot[CH2]/d[H2O] */
+    J[135] += dqdci;              /* dwdot[CH3]/d[H2O] */
+    /* d()/d[CH2] */
+    dqdci =  + k_f*sc[1];
+    J[201] -= dqdci;              /* dwdot[H]/d[CH2] */
+    J[208] -= dqdci;              /* dwdot[CH2]/d[CH2] */
+    J[210] += dqdci;              /* dwdot[CH3]/d[CH2] */
+    /* d()/d[CH3] */
+    dqdci =  - k_r;
+    J[251] -= dqdci;              /* dwdot[H]/d[CH3] */
+    J[258] -= dqdci;              /* dwdot[CH2]/d[CH3] */
+    J[260] += dqdci;              /* dwdot[CH3]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[0][2] - 1)*dcdc_fac;
+    J[276] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[283] -= dqdci;              /* dwdot[CH2]/d[CH4] */
+    J[285] += dqdci;              /* dwdot[CH3]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[0][3] - 1)*dcdc_fac;
+    J[301] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[308] -= dqdci;              /* dwdot[CH2]/d[CO] */
+    J[310] += dqdci;              /* dwdot[CH3]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[0][4] - 1)*dcdc_fac;
+    J[326] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[333] -= dqdci;              /* dwdot[CH2]/d[CO2] */
+    J[335] += dqdci;              /* dwdot[CH3]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[0][5] - 1)*dcdc_fac;
+    J[526] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[533] -= dqdci;              /* dwdot[CH2]/d[C2H6] */
+    J[535] += dqdci;              /* dwdot[CH3]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[0][6] - 1)*dcdc_fac;
+    J[576] -= dqdci;              /* dwdot[H]/d[AR] */
+    J[583] -= dqdci;              /* dwdot[CH2]/d[AR] */
+    J[585] += dqdci;              /* dwdot[CH3]/d[AR] */
     J[601] -= dqdT; /* dwdot[H]/dT */
     J[608] -= dqdT; /* dwdot[CH2]/dT */
     J[610] += dqdT; /* dwdot[CH3]/dT */
@@ -10039,11 +10392,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[1][0] - 1)*sc[0] + (TB[1][1] - 1)*sc[5] + (TB[1][2] - 1)*sc[11] + (TB[1][3] - 1)*sc[12] + (TB[1][4] - 1)*sc[13] + (TB[1][5] - 1)*sc[21] + (TB[1][6] - 1)*sc[23];
+    alpha = (memcmp(TB[1], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[1][0] - 1)*sc[0] + (TB[1][1] - 1)*sc[5] + (TB[1][2] - 1)*sc[11] + (TB[1][3] - 1)*sc[12] + (TB[1][4] - 1)*sc[13] + (TB[1][5] - 1)*sc[21] + (TB[1][6] - 1)*sc[23]);
     /* forward */
     phi_f = sc[1]*sc[10];
-    k_f = prefactor_units[1] * fwd_A[1]
-                * exp(fwd_beta[1] * tc[0] - activation_units[1] * fwd_Ea[1] * invT);
+    k_f = k_f_s[1];
     dlnkfdT = fwd_beta[1] * invT + activation_units[1] * fwd_Ea[1] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[1] * exp(low_beta[1] * tc[0] - activation_units[1] * low_Ea[1] * invT);
@@ -10059,16 +10411,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[1] == 4 ? exp(-troe_Tss[1] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
+      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
+      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
-      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
-      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -10076,7 +10428,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[11];
-    Kc = refCinv * exp(g_RT[1] + g_RT[10] - g_RT[11]);
+    Kc = Kc_s[1];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[10]) + (h_RT[11]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -10094,84 +10446,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[1][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[10] -= dqdci;               /* dwdot[CH3]/d[H2] */
-        J[11] += dqdci;               /* dwdot[CH4]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[10];
-        J[26] -= dqdci;               /* dwdot[H]/d[H] */
-        J[35] -= dqdci;               /* dwdot[CH3]/d[H] */
-        J[36] += dqdci;               /* dwdot[CH4]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[1][1] - 1)*dcdc_fac;
-        J[126] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[135] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[136] += dqdci;              /* dwdot[CH4]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[1];
-        J[251] -= dqdci;              /* dwdot[H]/d[CH3] */
-        J[260] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[261] += dqdci;              /* dwdot[CH4]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[1][2] - 1)*dcdc_fac - k_r;
-        J[276] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[285] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[286] += dqdci;              /* dwdot[CH4]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[1][3] - 1)*dcdc_fac;
-        J[301] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[310] -= dqdci;              /* dwdot[CH3]/d[CO] */
-        J[311] += dqdci;              /* dwdot[CH4]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[1][4] - 1)*dcdc_fac;
-        J[326] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[335] -= dqdci;              /* dwdot[CH3]/d[CO2] */
-        J[336] += dqdci;              /* dwdot[CH4]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[1][5] - 1)*dcdc_fac;
-        J[526] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[535] -= dqdci;              /* dwdot[CH3]/d[C2H6] */
-        J[536] += dqdci;              /* dwdot[CH4]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[1][6] - 1)*dcdc_fac;
-        J[576] -= dqdci;              /* dwdot[H]/d[AR] */
-        J[585] -= dqdci;              /* dwdot[CH3]/d[AR] */
-        J[586] += dqdci;              /* dwdot[CH4]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[1][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[10];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[1][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac + k_f*sc[1];
-        dqdc[11] = TB[1][2]*dcdc_fac - k_r;
-        dqdc[12] = TB[1][3]*dcdc_fac;
-        dqdc[13] = TB[1][4]*dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[1][5]*dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = TB[1][6]*dcdc_fac;
-        for (int k=0; k<24; k++) {
-            J[25*k+1] -= dqdc[k];
-            J[25*k+10] -= dqdc[k];
-            J[25*k+11] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[10] -= dcdc_fac;
+    Jmix[11] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[1][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[10] -= dqdci;               /* dwdot[CH3]/d[H2] */
+    J[11] += dqdci;               /* dwdot[CH4]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[10];
+    J[26] -= dqdci;               /* dwdot[H]/d[H] */
+    J[35] -= dqdci;               /* dwdot[CH3]/d[H] */
+    J[36] += dqdci;               /* dwdot[CH4]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[1][1] - 1)*dcdc_fac;
+    J[126] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[135] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[136] += dqdci;              /* dwdot[CH4]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[1];
+    J[251] -= dqdci;              /* dwdot[H]/d[CH3] */
+    J[260] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[261] += dqdci;              /* dwdot[CH4]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[1][2] - 1)*dcdc_fac - k_r;
+    J[276] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[285] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[286] += dqdci;              /* dwdot[CH4]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[1][3] - 1)*dcdc_fac;
+    J[301] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[310] -= dqdci;              /* dwdot[CH3]/d[CO] */
+    J[311] += dqdci;              /* dwdot[CH4]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[1][4] - 1)*dcdc_fac;
+    J[326] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[335] -= dqdci;              /* dwdot[CH3]/d[CO2] */
+    J[336] += dqdci;              /* dwdot[CH4]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[1][5] - 1)*dcdc_fac;
+    J[526] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[535] -= dqdci;              /* dwdot[CH3]/d[C2H6] */
+    J[536] += dqdci;              /* dwdot[CH4]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[1][6] - 1)*dcdc_fac;
+    J[576] -= dqdci;              /* dwdot[H]/d[AR] */
+    J[585] -= dqdci;              /* dwdot[CH3]/d[AR] */
+    J[586] += dqdci;              /* dwdot[CH4]/d[AR] */
     J[601] -= dqdT; /* dwdot[H]/dT */
     J[610] -= dqdT; /* dwdot[CH3]/dT */
     J[611] += dqdT; /* dwdot[CH4]/dT */
@@ -10180,11 +10503,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[11] + (TB[2][3] - 1)*sc[12] + (TB[2][4] - 1)*sc[13] + (TB[2][5] - 1)*sc[21] + (TB[2][6] - 1)*sc[23];
+    alpha = (memcmp(TB[2], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[11] + (TB[2][3] - 1)*sc[12] + (TB[2][4] - 1)*sc[13] + (TB[2][5] - 1)*sc[21] + (TB[2][6] - 1)*sc[23]);
     /* forward */
     phi_f = sc[1]*sc[14];
-    k_f = prefactor_units[2] * fwd_A[2]
-                * exp(fwd_beta[2] * tc[0] - activation_units[2] * fwd_Ea[2] * invT);
+    k_f = k_f_s[2];
     dlnkfdT = fwd_beta[2] * invT + activation_units[2] * fwd_Ea[2] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[2] * exp(low_beta[2] * tc[0] - activation_units[2] * low_Ea[2] * invT);
@@ -10200,16 +10522,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[2] == 4 ? exp(-troe_Tss[2] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[2]) > 1.e-100 ? -Fcent1/troe_Tsss[2] : 0.)
+      + (fabs(troe_Ts[2]) > 1.e-100 ? -Fcent2/troe_Ts[2] : 0.)
+      + (troe_len[2] == 4 ? Fcent3*troe_Tss[2]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[2]) > 1.e-100 ? -Fcent1/troe_Tsss[2] : 0.)
-      + (fabs(troe_Ts[2]) > 1.e-100 ? -Fcent2/troe_Ts[2] : 0.)
-      + (troe_len[2] == 4 ? Fcent3*troe_Tss[2]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -10217,7 +10539,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[15];
-    Kc = refCinv * exp(g_RT[1] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[2];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[14]) + (h_RT[15]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -10235,102 +10557,72 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[2][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[14] -= dqdci;               /* dwdot[HCO]/d[H2] */
-        J[15] += dqdci;               /* dwdot[CH2O]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[14];
-        J[26] -= dqdci;               /* dwdot[H]/d[H] */
-        J[39] -= dqdci;               /* dwdot[HCO]/d[H] */
-        J[40] += dqdci;               /* dwdot[CH2O]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[2][1] - 1)*dcdc_fac;
-        J[126] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[139] -= dqdci;              /* dwdot[HCO]/d[H2O] */
-        J[140] += dqdci;              /* dwdot[CH2O]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[2][2] - 1)*dcdc_fac;
-        J[276] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[289] -= dqdci;              /* dwdot[HCO]/d[CH4] */
-        J[290] += dqdci;              /* dwdot[CH2O]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[2][3] - 1)*dcdc_fac;
-        J[301] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[314] -= dqdci;              /* dwdot[HCO]/d[CO] */
-        J[315] += dqdci;              /* dwdot[CH2O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[2][4] - 1)*dcdc_fac;
-        J[326] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[339] -= dqdci;              /* dwdot[HCO]/d[CO2] */
-        J[340] += dqdci;              /* dwdot[CH2O]/d[CO2] */
-        /* d()/d[HCO] */
-        dqdci =  + k_f*sc[1];
-        J[351] -= dqdci;              /* dwdot[H]/d[HCO] */
-        J[364] -= dqdci;              /* dwdot[HCO]/d[HCO] */
-        J[365] += dqdci;              /* dwdot[CH2O]/d[HCO] */
-        /* d()/d[CH2O] */
-        dqdci =  - k_r;
-        J[376] -= dqdci;              /* dwdot[H]/d[CH2O] */
-        J[389] -= dqdci;              /* dwdot[HCO]/d[CH2O] */
-        J[390] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[2][5] - 1)*dcdc_fac;
-        J[526] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[539] -= dqdci;              /* dwdot[HCO]/d[C2H6] */
-        J[540] += dqdci;              /* dwdot[CH2O]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[2][6] - 1)*dcdc_fac;
-        J[576] -= dqdci;              /* dwdot[H]/d[AR] */
-        J[589] -= dqdci;              /* dwdot[HCO]/d[AR] */
-        J[590] += dqdci;              /* dwdot[CH2O]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[2][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[14];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[2][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[2][2]*dcdc_fac;
-        dqdc[12] = TB[2][3]*dcdc_fac;
-        dqdc[13] = TB[2][4]*dcdc_fac;
-        dqdc[14] = dcdc_fac + k_f*sc[1];
-        dqdc[15] = dcdc_fac - k_r;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[2][5]*dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = TB[2][6]*dcdc_fac;
-        for (int k=0; k<24; k++) {
-            J[25*k+1] -= dqdc[k];
-            J[25*k+14] -= dqdc[k];
-            J[25*k+15] += dqdc[k];
-        }
-    }
-    J[601] -= dqdT; /* dwdot[H]/dT */
-    J[614] -= dqdT; /* dwdot[HCO]/dT */
-    J[615] += dqdT; /* dwdot[CH2O]/dT */
-
-    /*reaction 4: H + CH2O (+M) <=> CH3O (+M) */
-    /*a pressure-fall-off reaction */
-    /* also 3-body */
-    /* 3-body correction factor */
-    alpha = mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[11] + (TB[3][3] - 1)*sc[12] + (TB[3][4] - 1)*sc[13] + (TB[3][5] - 1)*sc[21];
-    /* forward */
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[14] -= dcdc_fac;
+    Jmix[15] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[2][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[14] -= dqdci;               /* dwdot[HCO]/d[H2] */
+    J[15] += dqdci;               /* dwdot[CH2O]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[14];
+    J[26] -= dqdci;               /* dwdot[H]/d[H] */
+    J[39] -= dqdci;               /* dwdot[HCO]/d[H] */
+    J[40] += dqdci;               /* dwdot[CH2O]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[2][1] - 1)*dcdc_fac;
+    J[126] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[139] -= dqdci;              /* dwdot[HCO]/d[H2O] */
+    J[140] += dqdci;              /* dwdot[CH2O]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[2][2] - 1)*dcdc_fac;
+    J[276] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[289] -= dqdci;              /* dwdot[HCO]/d[CH4] */
+    J[290] += dqdci;              /* dwdot[CH2O]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[2][3] - 1)*dcdc_fac;
+    J[301] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[314] -= dqdci;              /* dwdot[HCO]/d[CO] */
+    J[315] += dqdci;              /* dwdot[CH2O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[2][4] - 1)*dcdc_fac;
+    J[326] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[339] -= dqdci;              /* dwdot[HCO]/d[CO2] */
+    J[340] += dqdci;              /* dwdot[CH2O]/d[CO2] */
+    /* d()/d[HCO] */
+    dqdci =  + k_f*sc[1];
+    J[351] -= dqdci;              /* dwdot[H]/d[HCO] */
+    J[364] -= dqdci;              /* dwdot[HCO]/d[HCO] */
+    J[365] += dqdci;              /* dwdot[CH2O]/d[HCO] */
+    /* d()/d[CH2O] */
+    dqdci =  - k_r;
+    J[376] -= dqdci;              /* dwdot[H]/d[CH2O] */
+    J[389] -= dqdci;              /* dwdot[HCO]/d[CH2O] */
+    J[390] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[2][5] - 1)*dcdc_fac;
+    J[526] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[539] -= dqdci;              /* dwdot[HCO]/d[C2H6] */
+    J[540] += dqdci;              /* dwdot[CH2O]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[2][6] - 1)*dcdc_fac;
+    J[576] -= dqdci;              /* dwdot[H]/d[AR] */
+    J[589] -= dqdci;              /* dwdot[HCO]/d[AR] */
+    J[590] += dqdci;              /* dwdot[CH2O]/d[AR] */
+    J[601] -= dqdT; /* dwdot[H]/dT */
+    J[614] -= dqdT; /* dwdot[HCO]/dT */
+    J[615] += dqdT; /* dwdot[CH2O]/dT */
+
+    /*reaction 4: H + CH2O (+M) <=> CH3O (+M) */
+    /*a pressure-fall-off reaction */
+    /* also 3-body */
+    /* 3-body correction factor */
+    alpha = mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[11] + (TB[3][3] - 1)*sc[12] + (TB[3][4] - 1)*sc[13] + (TB[3][5] - 1)*sc[21];
+    /* forward */
     phi_f = sc[1]*sc[15];
-    k_f = prefactor_units[3] * fwd_A[3]
-                * exp(fwd_beta[3] * tc[0] - activation_units[3] * fwd_Ea[3] * invT);
+    k_f = k_f_s[3];
     dlnkfdT = fwd_beta[3] * invT + activation_units[3] * fwd_Ea[3] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[3] * exp(low_beta[3] * tc[0] - activation_units[3] * low_Ea[3] * invT);
@@ -10346,16 +10638,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[3] == 4 ? exp(-troe_Tss[3] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[3]) > 1.e-100 ? -Fcent1/troe_Tsss[3] : 0.)
+      + (fabs(troe_Ts[3]) > 1.e-100 ? -Fcent2/troe_Ts[3] : 0.)
+      + (troe_len[3] == 4 ? Fcent3*troe_Tss[3]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[3]) > 1.e-100 ? -Fcent1/troe_Tsss[3] : 0.)
-      + (fabs(troe_Ts[3]) > 1.e-100 ? -Fcent2/troe_Ts[3] : 0.)
-      + (troe_len[3] == 4 ? Fcent3*troe_Tss[3]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -10363,7 +10655,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[16];
-    Kc = refCinv * exp(g_RT[1] + g_RT[15] - g_RT[16]);
+    Kc = Kc_s[3];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[15]) + (h_RT[16]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -10381,84 +10673,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[3][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[15] -= dqdci;               /* dwdot[CH2O]/d[H2] */
-        J[16] += dqdci;               /* dwdot[CH3O]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[15];
-        J[26] -= dqdci;               /* dwdot[H]/d[H] */
-        J[40] -= dqdci;               /* dwdot[CH2O]/d[H] */
-        J[41] += dqdci;               /* dwdot[CH3O]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[3][1] - 1)*dcdc_fac;
-        J[126] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[140] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
-        J[141] += dqdci;              /* dwdot[CH3O]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[3][2] - 1)*dcdc_fac;
-        J[276] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[290] -= dqdci;              /* dwdot[CH2O]/d[CH4] */
-        J[291] += dqdci;              /* dwdot[CH3O]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[3][3] - 1)*dcdc_fac;
-        J[301] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[315] -= dqdci;              /* dwdot[CH2O]/d[CO] */
-        J[316] += dqdci;              /* dwdot[CH3O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[3][4] - 1)*dcdc_fac;
-        J[326] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[340] -= dqdci;              /* dwdot[CH2O]/d[CO2] */
-        J[341] += dqdci;              /* dwdot[CH3O]/d[CO2] */
-        /* d()/d[CH2O] */
-        dqdci =  + k_f*sc[1];
-        J[376] -= dqdci;              /* dwdot[H]/d[CH2O] */
-        J[390] -= dqdci;              /* dwdot[CH2O]/d[CH2O] */
-        J[391] += dqdci;              /* dwdot[CH3O]/d[CH2O] */
-        /* d()/d[CH3O] */
-        dqdci =  - k_r;
-        J[401] -= dqdci;              /* dwdot[H]/d[CH3O] */
-        J[415] -= dqdci;              /* dwdot[CH2O]/d[CH3O] */
-        J[416] += dqdci;              /* dwdot[CH3O]/d[CH3O] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[3][5] - 1)*dcdc_fac;
-        J[526] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[540] -= dqdci;              /* dwdot[CH2O]/d[C2H6] */
-        J[541] += dqdci;              /* dwdot[CH3O]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[3][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[15];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[3][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[3][2]*dcdc_fac;
-        dqdc[12] = TB[3][3]*dcdc_fac;
-        dqdc[13] = TB[3][4]*dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac + k_f*sc[1];
-        dqdc[16] = dcdc_fac - k_r;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[3][5]*dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        for (int k=0; k<24; k++) {
-            J[25*k+1] -= dqdc[k];
-            J[25*k+15] -= dqdc[k];
-            J[25*k+16] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[15] -= dcdc_fac;
+    Jmix[16] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[3][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[15] -= dqdci;               /* dwdot[CH2O]/d[H2] */
+    J[16] += dqdci;               /* dwdot[CH3O]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[15];
+    J[26] -= dqdci;               /* dwdot[H]/d[H] */
+    J[40] -= dqdci;               /* dwdot[CH2O]/d[H] */
+    J[41] += dqdci;               /* dwdot[CH3O]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[3][1] - 1)*dcdc_fac;
+    J[126] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[140] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
+    J[141] += dqdci;              /* dwdot[CH3O]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[3][2] - 1)*dcdc_fac;
+    J[276] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[290] -= dqdci;              /* dwdot[CH2O]/d[CH4] */
+    J[291] += dqdci;              /* dwdot[CH3O]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[3][3] - 1)*dcdc_fac;
+    J[301] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[315] -= dqdci;              /* dwdot[CH2O]/d[CO] */
+    J[316] += dqdci;              /* dwdot[CH3O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[3][4] - 1)*dcdc_fac;
+    J[326] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[340] -= dqdci;              /* dwdot[CH2O]/d[CO2] */
+    J[341] += dqdci;              /* dwdot[CH3O]/d[CO2] */
+    /* d()/d[CH2O] */
+    dqdci =  + k_f*sc[1];
+    J[376] -= dqdci;              /* dwdot[H]/d[CH2O] */
+    J[390] -= dqdci;              /* dwdot[CH2O]/d[CH2O] */
+    J[391] += dqdci;              /* dwdot[CH3O]/d[CH2O] */
+    /* d()/d[CH3O] */
+    dqdci =  - k_r;
+    J[401] -= dqdci;              /* dwdot[H]/d[CH3O] */
+    J[415] -= dqdci;              /* dwdot[CH2O]/d[CH3O] */
+    J[416] += dqdci;              /* dwdot[CH3O]/d[CH3O] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[3][5] - 1)*dcdc_fac;
+    J[526] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[540] -= dqdci;              /* dwdot[CH2O]/d[C2H6] */
+    J[541] += dqdci;              /* dwdot[CH3O]/d[C2H6] */
     J[601] -= dqdT; /* dwdot[H]/dT */
     J[615] -= dqdT; /* dwdot[CH2O]/dT */
     J[616] += dqdT; /* dwdot[CH3O]/dT */
@@ -10467,11 +10730,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[11] + (TB[4][3] - 1)*sc[12] + (TB[4][4] - 1)*sc[13] + (TB[4][5] - 1)*sc[21] + (TB[4][6] - 1)*sc[23];
+    alpha = (memcmp(TB[4], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[11] + (TB[4][3] - 1)*sc[12] + (TB[4][4] - 1)*sc[13] + (TB[4][5] - 1)*sc[21] + (TB[4][6] - 1)*sc[23]);
     /* forward */
     phi_f = sc[1]*sc[17];
-    k_f = prefactor_units[4] * fwd_A[4]
-                * exp(fwd_beta[4] * tc[0] - activation_units[4] * fwd_Ea[4] * invT);
+    k_f = k_f_s[4];
     dlnkfdT = fwd_beta[4] * invT + activation_units[4] * fwd_Ea[4] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[4] * exp(low_beta[4] * tc[0] - activation_units[4] * low_Ea[4] * invT);
@@ -10487,16 +10749,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[4] == 4 ? exp(-troe_Tss[4] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[4]) > 1.e-100 ? -Fcent1/troe_Tsss[4] : 0.)
+      + (fabs(troe_Ts[4]) > 1.e-100 ? -Fcent2/troe_Ts[4] : 0.)
+      + (troe_len[4] == 4 ? Fcent3*troe_Tss[4]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[4]) > 1.e-100 ? -Fcent1/troe_Tsss[4] : 0.)
-      + (fabs(troe_Ts[4]) > 1.e-100 ? -Fcent2/troe_Ts[4] : 0.)
-      + (troe_len[4] == 4 ? Fcent3*troe_Tss[4]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -10504,7 +10766,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[18];
-    Kc = refCinv * exp(g_RT[1] + g_RT[17] - g_RT[18]);
+    Kc = Kc_s[4];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[17]) + (h_RT[18]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -10522,89 +10784,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[4][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[17] -= dqdci;               /* dwdot[C2H2]/d[H2] */
-        J[18] += dqdci;               /* dwdot[C2H3]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[17];
-        J[26] -= dqdci;               /* dwdot[H]/d[H] */
-        J[42] -= dqdci;               /* dwdot[C2H2]/d[H] */
-        J[43] += dqdci;               /* dwdot[C2H3]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[4][1] - 1)*dcdc_fac;
-        J[126] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[142] -= dqdci;              /* dwdot[C2H2]/d[H2O] */
-        J[143] += dqdci;              /* dwdot[C2H3]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[4][2] - 1)*dcdc_fac;
-        J[276] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[292] -= dqdci;              /* dwdot[C2H2]/d[CH4] */
-        J[293] += dqdci;              /* dwdot[C2H3]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[4][3] - 1)*dcdc_fac;
-        J[301] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[317] -= dqdci;              /* dwdot[C2H2]/d[CO] */
-        J[318] += dqdci;              /* dwdot[C2H3]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[4][4] - 1)*dcdc_fac;
-        J[326] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[342] -= dqdci;              /* dwdot[C2H2]/d[CO2] */
-        J[343] += dqdci;              /* dwdot[C2H3]/d[CO2] */
-        /* d()/d[C2H2] */
-        dqdci =  + k_f*sc[1];
-        J[426] -= dqdci;              /* dwdot[H]/d[C2H2] */
-        J[442] -= dqdci;              /* dwdot[C2H2]/d[C2H2] */
-        J[443] += dqdci;              /* dwdot[C2H3]/d[C2H2] */
-        /* d()/d[C2H3] */
-        dqdci =  - k_r;
-        J[451] -= dqdci;              /* dwdot[H]/d[C2H3] */
-        J[467] -= dqdci;              /* dwdot[C2H2]/d[C2H3] */
-        J[468] += dqdci;              /* dwdot[C2H3]/d[C2H3] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[4][5] - 1)*dcdc_fac;
-        J[526] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[542] -= dqdci;              /* dwdot[C2H2]/d[C2H6] */
-        J[543] += dqdci;              /* dwdot[C2H3]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[4][6] - 1)*dcdc_fac;
-        J[576] -= dqdci;              /* dwdot[H]/d[AR] */
-        J[592] -= dqdci;              /* dwdot[C2H2]/d[AR] */
-        J[593] += dqdci;              /* dwdot[C2H3]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[4][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[17];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[4][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[4][2]*dcdc_fac;
-        dqdc[12] = TB[4][3]*dcdc_fac;
-        dqdc[13] = TB[4][4]*dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac + k_f*sc[1];
-        dqdc[18] = dcdc_fac - k_r;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[4][5]*dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = TB[4][6]*dcdc_fac;
-        for (int k=0; k<24; k++) {
-            J[25*k+1] -= dqdc[k];
-            J[25*k+17] -= dqdc[k];
-            J[25*k+18] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[17] -= dcdc_fac;
+    Jmix[18] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[4][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[17] -= dqdci;               /* dwdot[C2H2]/d[H2] */
+    J[18] += dqdci;               /* dwdot[C2H3]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[17];
+    J[26] -= dqdci;               /* dwdot[H]/d[H] */
+    J[42] -= dqdci;               /* dwdot[C2H2]/d[H] */
+    J[43] += dqdci;               /* dwdot[C2H3]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[4][1] - 1)*dcdc_fac;
+    J[126] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[142] -= dqdci;              /* dwdot[C2H2]/d[H2O] */
+    J[143] += dqdci;              /* dwdot[C2H3]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[4][2] - 1)*dcdc_fac;
+    J[276] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[292] -= dqdci;              /* dwdot[C2H2]/d[CH4] */
+    J[293] += dqdci;              /* dwdot[C2H3]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[4][3] - 1)*dcdc_fac;
+    J[301] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[317] -= dqdci;              /* dwdot[C2H2]/d[CO] */
+    J[318] += dqdci;              /* dwdot[C2H3]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[4][4] - 1)*dcdc_fac;
+    J[326] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[342] -= dqdci;              /* dwdot[C2H2]/d[CO2] */
+    J[343] += dqdci;              /* dwdot[C2H3]/d[CO2] */
+    /* d()/d[C2H2] */
+    dqdci =  + k_f*sc[1];
+    J[426] -= dqdci;              /* dwdot[H]/d[C2H2] */
+    J[442] -= dqdci;              /* dwdot[C2H2]/d[C2H2] */
+    J[443] += dqdci;              /* dwdot[C2H3]/d[C2H2] */
+    /* d()/d[C2H3] */
+    dqdci =  - k_r;
+    J[451] -= dqdci;              /* dwdot[H]/d[C2H3] */
+    J[467] -= dqdci;              /* dwdot[C2H2]/d[C2H3] */
+    J[468] += dqdci;              /* dwdot[C2H3]/d[C2H3] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[4][5] - 1)*dcdc_fac;
+    J[526] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[542] -= dqdci;              /* dwdot[C2H2]/d[C2H6] */
+    J[543] += dqdci;              /* dwdot[C2H3]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[4][6] - 1)*dcdc_fac;
+    J[576] -= dqdci;              /* dwdot[H]/d[AR] */
+    J[592] -= dqdci;              /* dwdot[C2H2]/d[AR] */
+    J[593] += dqdci;              /* dwdot[C2H3]/d[AR] */
     J[601] -= dqdT; /* dwdot[H]/dT */
     J[617] -= dqdT; /* dwdot[C2H2]/dT */
     J[618] += dqdT; /* dwdot[C2H3]/dT */
@@ -10613,11 +10846,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[11] + (TB[5][3] - 1)*sc[12] + (TB[5][4] - 1)*sc[13] + (TB[5][5] - 1)*sc[21] + (TB[5][6] - 1)*sc[23];
+    alpha = (memcmp(TB[5], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[11] + (TB[5][3] - 1)*sc[12] + (TB[5][4] - 1)*sc[13] + (TB[5][5] - 1)*sc[21] + (TB[5][6] - 1)*sc[23]);
     /* forward */
     phi_f = sc[1]*sc[18];
-    k_f = prefactor_units[5] * fwd_A[5]
-                * exp(fwd_beta[5] * tc[0] - activation_units[5] * fwd_Ea[5] * invT);
+    k_f = k_f_s[5];
     dlnkfdT = fwd_beta[5] * invT + activation_units[5] * fwd_Ea[5] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[5] * exp(low_beta[5] * tc[0] - activation_units[5] * low_Ea[5] * invT);
@@ -10633,16 +10865,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[5] == 4 ? exp(-troe_Tss[5] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[5]) > 1.e-100 ? -Fcent1/troe_Tsss[5] : 0.)
+      + (fabs(troe_Ts[5]) > 1.e-100 ? -Fcent2/troe_Ts[5] : 0.)
+      + (troe_len[5] == 4 ? Fcent3*troe_Tss[5]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[5]) > 1.e-100 ? -Fcent1/troe_Tsss[5] : 0.)
-      + (fabs(troe_Ts[5]) > 1.e-100 ? -Fcent2/troe_Ts[5] : 0.)
-      + (troe_len[5] == 4 ? Fcent3*troe_Tss[5]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -10650,7 +10882,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[19];
-    Kc = refCinv * exp(g_RT[1] + g_RT[18] - g_RT[19]);
+    Kc = Kc_s[5];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[18]) + (h_RT[19]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -10668,89 +10900,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[5][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[18] -= dqdci;               /* dwdot[C2H3]/d[H2] */
-        J[19] += dqdci;               /* dwdot[C2H4]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[18];
-        J[26] -= dqdci;               /* dwdot[H]/d[H] */
-        J[43] -= dqdci;               /* dwdot[C2H3]/d[H] */
-        J[44] += dqdci;               /* dwdot[C2H4]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[5][1] - 1)*dcdc_fac;
-        J[126] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[143] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
-        J[144] += dqdci;              /* dwdot[C2H4]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[5][2] - 1)*dcdc_fac;
-        J[276] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[293] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
-        J[294] += dqdci;              /* dwdot[C2H4]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[5][3] - 1)*dcdc_fac;
-        J[301] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[318] -= dqdci;              /* dwdot[C2H3]/d[CO] */
-        J[319] += dqdci;              /* dwdot[C2H4]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[5][4] - 1)*dcdc_fac;
-        J[326] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[343] -= dqdci;              /* dwdot[C2H3]/d[CO2] */
-        J[344] += dqdci;              /* dwdot[C2H4]/d[CO2] */
-        /* d()/d[C2H3] */
-        dqdci =  + k_f*sc[1];
-        J[451] -= dqdci;              /* dwdot[H]/d[C2H3] */
-        J[468] -= dqdci;              /* dwdot[C2H3]/d[C2H3] */
-        J[469] += dqdci;              /* dwdot[C2H4]/d[C2H3] */
-        /* d()/d[C2H4] */
-        dqdci =  - k_r;
-        J[476] -= dqdci;              /* dwdot[H]/d[C2H4] */
-        J[493] -= dqdci;              /* dwdot[C2H3]/d[C2H4] */
-        J[494] += dqdci;              /* dwdot[C2H4]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[5][5] - 1)*dcdc_fac;
-        J[526] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[543] -= dqdci;              /* dwdot[C2H3]/d[C2H6] */
-        J[544] += dqdci;              /* dwdot[C2H4]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[5][6] - 1)*dcdc_fac;
-        J[576] -= dqdci;              /* dwdot[H]/d[AR] */
-        J[593] -= dqdci;              /* dwdot[C2H3]/d[AR] */
-        J[594] += dqdci;              /* dwdot[C2H4]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[5][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[18];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[5][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[5][2]*dcdc_fac;
-        dqdc[12] = TB[5][3]*dcdc_fac;
-        dqdc[13] = TB[5][4]*dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac + k_f*sc[1];
-        dqdc[19] = dcdc_fac - k_r;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[5][5]*dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = TB[5][6]*dcdc_fac;
-        for (int k=0; k<24; k++) {
-            J[25*k+1] -= dqdc[k];
-            J[25*k+18] -= dqdc[k];
-            J[25*k+19] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[18] -= dcdc_fac;
+    Jmix[19] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[5][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[18] -= dqdci;               /* dwdot[C2H3]/d[H2] */
+    J[19] += dqdci;               /* dwdot[C2H4]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[18];
+    J[26] -= dqdci;               /* dwdot[H]/d[H] */
+    J[43] -= dqdci;               /* dwdot[C2H3]/d[H] */
+    J[44] += dqdci;               /* dwdot[C2H4]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[5][1] - 1)*dcdc_fac;
+    J[126] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[143] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
+    J[144] += dqdci;              /* dwdot[C2H4]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[5][2] - 1)*dcdc_fac;
+    J[276] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[293] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
+    J[294] += dqdci;              /* dwdot[C2H4]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[5][3] - 1)*dcdc_fac;
+    J[301] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[318] -= dqdci;              /* dwdot[C2H3]/d[CO] */
+    J[319] += dqdci;              /* dwdot[C2H4]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[5][4] - 1)*dcdc_fac;
+    J[326] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[343] -= dqdci;              /* dwdot[C2H3]/d[CO2] */
+    J[344] += dqdci;              /* dwdot[C2H4]/d[CO2] */
+    /* d()/d[C2H3] */
+    dqdci =  + k_f*sc[1];
+    J[451] -= dqdci;              /* dwdot[H]/d[C2H3] */
+    J[468] -= dqdci;              /* dwdot[C2H3]/d[C2H3] */
+    J[469] += dqdci;              /* dwdot[C2H4]/d[C2H3] */
+    /* d()/d[C2H4] */
+    dqdci =  - k_r;
+    J[476] -= dqdci;              /* dwdot[H]/d[C2H4] */
+    J[493] -= dqdci;              /* dwdot[C2H3]/d[C2H4] */
+    J[494] += dqdci;              /* dwdot[C2H4]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[5][5] - 1)*dcdc_fac;
+    J[526] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[543] -= dqdci;              /* dwdot[C2H3]/d[C2H6] */
+    J[544] += dqdci;              /* dwdot[C2H4]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[5][6] - 1)*dcdc_fac;
+    J[576] -= dqdci;              /* dwdot[H]/d[AR] */
+    J[593] -= dqdci;              /* dwdot[C2H3]/d[AR] */
+    J[594] += dqdci;              /* dwdot[C2H4]/d[AR] */
     J[601] -= dqdT; /* dwdot[H]/dT */
     J[618] -= dqdT; /* dwdot[C2H3]/dT */
     J[619] += dqdT; /* dwdot[C2H4]/dT */
@@ -10759,11 +10962,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[6][0] - 1)*sc[0] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[11] + (TB[6][3] - 1)*sc[12] + (TB[6][4] - 1)*sc[13] + (TB[6][5] - 1)*sc[21] + (TB[6][6] - 1)*sc[23];
+    alpha = (memcmp(TB[6], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[6][0] - 1)*sc[0] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[11] + (TB[6][3] - 1)*sc[12] + (TB[6][4] - 1)*sc[13] + (TB[6][5] - 1)*sc[21] + (TB[6][6] - 1)*sc[23]);
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[6] * fwd_A[6]
-                * exp(fwd_beta[6] * tc[0] - activation_units[6] * fwd_Ea[6] * invT);
+    k_f = k_f_s[6];
     dlnkfdT = fwd_beta[6] * invT + activation_units[6] * fwd_Ea[6] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[6] * exp(low_beta[6] * tc[0] - activation_units[6] * low_Ea[6] * invT);
@@ -10779,16 +10981,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[6] == 4 ? exp(-troe_Tss[6] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[6]) > 1.e-100 ? -Fcent1/troe_Tsss[6] : 0.)
+      + (fabs(troe_Ts[6]) > 1.e-100 ? -Fcent2/troe_Ts[6] : 0.)
+      + (troe_len[6] == 4 ? Fcent3*troe_Tss[6]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[6]) > 1.e-100 ? -Fcent1/troe_Tsss[6] : 0.)
-      + (fabs(troe_Ts[6]) > 1.e-100 ? -Fcent2/troe_Ts[6] : 0.)
-      + (troe_len[6] == 4 ? Fcent3*troe_Tss[6]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -10796,7 +10998,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[20];
-    Kc = refCinv * exp(g_RT[1] + g_RT[19] - g_RT[20]);
+    Kc = Kc_s[6];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[20]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -10814,89 +11016,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[6][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[19] -= dqdci;               /* dwdot[C2H4]/d[H2] */
-        J[20] += dqdci;               /* dwdot[C2H5]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[19];
-        J[26] -= dqdci;               /* dwdot[H]/d[H] */
-        J[44] -= dqdci;               /* dwdot[C2H4]/d[H] */
-        J[45] += dqdci;               /* dwdot[C2H5]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[6][1] - 1)*dcdc_fac;
-        J[126] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[144] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
-        J[145] += dqdci;              /* dwdot[C2H5]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[6][2] - 1)*dcdc_fac;
-        J[276] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[294] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
-        J[295] += dqdci;              /* dwdot[C2H5]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[6][3] - 1)*dcdc_fac;
-        J[301] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[319] -= dqdci;              /* dwdot[C2H4]/d[CO] */
-        J[320] += dqdci;              /* dwdot[C2H5]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[6][4] - 1)*dcdc_fac;
-        J[326] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[344] -= dqdci;              /* dwdot[C2H4]/d[CO2] */
-        J[345] += dqdci;              /* dwdot[C2H5]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci =  + k_f*sc[1];
-        J[476] -= dqdci;              /* dwdot[H]/d[C2H4] */
-        J[494] -= dqdci;              /* dwdot[C2H4]/d[C2H4] */
-        J[495] += dqdci;              /* dwdot[C2H5]/d[C2H4] */
-        /* d()/d[C2H5] */
-        dqdci =  - k_r;
-        J[501] -= dqdci;              /* dwdot[H]/d[C2H5] */
-        J[519] -= dqdci;              /* dwdot[C2H4]/d[C2H5] */
-        J[520] += dqdci;              /* dwdot[C2H5]/d[C2H5] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[6][5] - 1)*dcdc_fac;
-        J[526] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[544] -= dqdci;              /* dwdot[C2H4]/d[C2H6] */
-        J[545] += dqdci;              /* dwdot[C2H5]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[6][6] - 1)*dcdc_fac;
-        J[576] -= dqdci;              /* dwdot[H]/d[AR] */
-        J[594] -= dqdci;              /* dwdot[C2H4]/d[AR] */
-        J[595] += dqdci;              /* dwdot[C2H5]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[6][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[19];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[6][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[6][2]*dcdc_fac;
-        dqdc[12] = TB[6][3]*dcdc_fac;
-        dqdc[13] = TB[6][4]*dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac + k_f*sc[1];
-        dqdc[20] = dcdc_fac - k_r;
-        dqdc[21] = TB[6][5]*dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = TB[6][6]*dcdc_fac;
-        for (int k=0; k<24; k++) {
-            J[25*k+1] -= dqdc[k];
-            J[25*k+19] -= dqdc[k];
-            J[25*k+20] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[19] -= dcdc_fac;
+    Jmix[20] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[6][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[19] -= dqdci;               /* dwdot[C2H4]/d[H2] */
+    J[20] += dqdci;               /* dwdot[C2H5]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[19];
+    J[26] -= dqdci;               /* dwdot[H]/d[H] */
+    J[44] -= dqdci;               /* dwdot[C2H4]/d[H] */
+    J[45] += dqdci;               /* dwdot[C2H5]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[6][1] - 1)*dcdc_fac;
+    J[126] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[144] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
+    J[145] += dqdci;              /* dwdot[C2H5]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[6][2] - 1)*dcdc_fac;
+    J[276] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[294] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
+    J[295] += dqdci;              /* dwdot[C2H5]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[6][3] - 1)*dcdc_fac;
+    J[301] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[319] -= dqdci;              /* dwdot[C2H4]/d[CO] */
+    J[320] += dqdci;              /* dwdot[C2H5]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[6][4] - 1)*dcdc_fac;
+    J[326] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[344] -= dqdci;              /* dwdot[C2H4]/d[CO2] */
+    J[345] += dqdci;              /* dwdot[C2H5]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci =  + k_f*sc[1];
+    J[476] -= dqdci;              /* dwdot[H]/d[C2H4] */
+    J[494] -= dqdci;              /* dwdot[C2H4]/d[C2H4] */
+    J[495] += dqdci;              /* dwdot[C2H5]/d[C2H4] */
+    /* d()/d[C2H5] */
+    dqdci =  - k_r;
+    J[501] -= dqdci;              /* dwdot[H]/d[C2H5] */
+    J[519] -= dqdci;              /* dwdot[C2H4]/d[C2H5] */
+    J[520] += dqdci;              /* dwdot[C2H5]/d[C2H5] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[6][5] - 1)*dcdc_fac;
+    J[526] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[544] -= dqdci;              /* dwdot[C2H4]/d[C2H6] */
+    J[545] += dqdci;              /* dwdot[C2H5]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[6][6] - 1)*dcdc_fac;
+    J[576] -= dqdci;              /* dwdot[H]/d[AR] */
+    J[594] -= dqdci;              /* dwdot[C2H4]/d[AR] */
+    J[595] += dqdci;              /* dwdot[C2H5]/d[AR] */
     J[601] -= dqdT; /* dwdot[H]/dT */
     J[619] -= dqdT; /* dwdot[C2H4]/dT */
     J[620] += dqdT; /* dwdot[C2H5]/dT */
@@ -10905,11 +11078,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[7][0] - 1)*sc[0] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[11] + (TB[7][3] - 1)*sc[12] + (TB[7][4] - 1)*sc[13] + (TB[7][5] - 1)*sc[21] + (TB[7][6] - 1)*sc[23];
+    alpha = (memcmp(TB[7], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[7][0] - 1)*sc[0] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[11] + (TB[7][3] - 1)*sc[12] + (TB[7][4] - 1)*sc[13] + (TB[7][5] - 1)*sc[21] + (TB[7][6] - 1)*sc[23]);
     /* forward */
     phi_f = sc[1]*sc[20];
-    k_f = prefactor_units[7] * fwd_A[7]
-                * exp(fwd_beta[7] * tc[0] - activation_units[7] * fwd_Ea[7] * invT);
+    k_f = k_f_s[7];
     dlnkfdT = fwd_beta[7] * invT + activation_units[7] * fwd_Ea[7] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[7] * exp(low_beta[7] * tc[0] - activation_units[7] * low_Ea[7] * invT);
@@ -10925,16 +11097,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[7] == 4 ? exp(-troe_Tss[7] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[7]) > 1.e-100 ? -Fcent1/troe_Tsss[7] : 0.)
+      + (fabs(troe_Ts[7]) > 1.e-100 ? -Fcent2/troe_Ts[7] : 0.)
+      + (troe_len[7] == 4 ? Fcent3*troe_Tss[7]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[7]) > 1.e-100 ? -Fcent1/troe_Tsss[7] : 0.)
-      + (fabs(troe_Ts[7]) > 1.e-100 ? -Fcent2/troe_Ts[7] : 0.)
-      + (troe_len[7] == 4 ? Fcent3*troe_Tss[7]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -10942,7 +11114,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[21];
-    Kc = refCinv * exp(g_RT[1] + g_RT[20] - g_RT[21]);
+    Kc = Kc_s[7];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[20]) + (h_RT[21]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -10960,84 +11132,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[7][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[20] -= dqdci;               /* dwdot[C2H5]/d[H2] */
-        J[21] += dqdci;               /* dwdot[C2H6]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[20];
-        J[26] -= dqdci;               /* dwdot[H]/d[H] */
-        J[45] -= dqdci;               /* dwdot[C2H5]/d[H] */
-        J[46] += dqdci;               /* dwdot[C2H6]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[7][1] - 1)*dcdc_fac;
-        J[126] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[145] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
-        J[146] += dqdci;              /* dwdot[C2H6]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[7][2] - 1)*dcdc_fac;
-        J[276] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[295] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
-        J[296] += dqdci;              /* dwdot[C2H6]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[7][3] - 1)*dcdc_fac;
-        J[301] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[320] -= dqdci;              /* dwdot[C2H5]/d[CO] */
-        J[321] += dqdci;              /* dwdot[C2H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[7][4] - 1)*dcdc_fac;
-        J[326] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[345] -= dqdci;              /* dwdot[C2H5]/d[CO2] */
-        J[346] += dqdci;              /* dwdot[C2H6]/d[CO2] */
-        /* d()/d[C2H5] */
-        dqdci =  + k_f*sc[1];
-        J[501] -= dqdci;              /* dwdot[H]/d[C2H5] */
-        J[520] -= dqdci;              /* dwdot[C2H5]/d[C2H5] */
-        J[521] += dqdci;              /* dwdot[C2H6]/d[C2H5] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[7][5] - 1)*dcdc_fac - k_r;
-        J[526] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[545] -= dqdci;              /* dwdot[C2H5]/d[C2H6] */
-        J[546] += dqdci;              /* dwdot[C2H6]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[7][6] - 1)*dcdc_fac;
-        J[576] -= dqdci;              /* dwdot[H]/d[AR] */
-        J[595] -= dqdci;              /* dwdot[C2H5]/d[AR] */
-        J[596] += dqdci;              /* dwdot[C2H6]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[7][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[20];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[7][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[7][2]*dcdc_fac;
-        dqdc[12] = TB[7][3]*dcdc_fac;
-        dqdc[13] = TB[7][4]*dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac + k_f*sc[1];
-        dqdc[21] = TB[7][5]*dcdc_fac - k_r;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = TB[7][6]*dcdc_fac;
-        for (int k=0; k<24; k++) {
-            J[25*k+1] -= dqdc[k];
-            J[25*k+20] -= dqdc[k];
-            J[25*k+21] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[20] -= dcdc_fac;
+    Jmix[21] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[7][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[20] -= dqdci;               /* dwdot[C2H5]/d[H2] */
+    J[21] += dqdci;               /* dwdot[C2H6]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[20];
+    J[26] -= dqdci;               /* dwdot[H]/d[H] */
+    J[45] -= dqdci;               /* dwdot[C2H5]/d[H] */
+    J[46] += dqdci;               /* dwdot[C2H6]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[7][1] - 1)*dcdc_fac;
+    J[126] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[145] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
+    J[146] += dqdci;              /* dwdot[C2H6]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[7][2] - 1)*dcdc_fac;
+    J[276] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[295] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
+    J[296] += dqdci;              /* dwdot[C2H6]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[7][3] - 1)*dcdc_fac;
+    J[301] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[320] -= dqdci;              /* dwdot[C2H5]/d[CO] */
+    J[321] += dqdci;              /* dwdot[C2H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[7][4] - 1)*dcdc_fac;
+    J[326] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[345] -= dqdci;              /* dwdot[C2H5]/d[CO2] */
+    J[346] += dqdci;              /* dwdot[C2H6]/d[CO2] */
+    /* d()/d[C2H5] */
+    dqdci =  + k_f*sc[1];
+    J[501] -= dqdci;              /* dwdot[H]/d[C2H5] */
+    J[520] -= dqdci;              /* dwdot[C2H5]/d[C2H5] */
+    J[521] += dqdci;              /* dwdot[C2H6]/d[C2H5] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[7][5] - 1)*dcdc_fac - k_r;
+    J[526] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[545] -= dqdci;              /* dwdot[C2H5]/d[C2H6] */
+    J[546] += dqdci;              /* dwdot[C2H6]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[7][6] - 1)*dcdc_fac;
+    J[576] -= dqdci;              /* dwdot[H]/d[AR] */
+    J[595] -= dqdci;              /* dwdot[C2H5]/d[AR] */
+    J[596] += dqdci;              /* dwdot[C2H6]/d[AR] */
     J[601] -= dqdT; /* dwdot[H]/dT */
     J[620] -= dqdT; /* dwdot[C2H5]/dT */
     J[621] += dqdT; /* dwdot[C2H6]/dT */
@@ -11046,11 +11189,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[8][0] - 1)*sc[0] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[11] + (TB[8][3] - 1)*sc[12] + (TB[8][4] - 1)*sc[13] + (TB[8][5] - 1)*sc[21] + (TB[8][6] - 1)*sc[23];
+    alpha = (memcmp(TB[8], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[8][0] - 1)*sc[0] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[11] + (TB[8][3] - 1)*sc[12] + (TB[8][4] - 1)*sc[13] + (TB[8][5] - 1)*sc[21] + (TB[8][6] - 1)*sc[23]);
     /* forward */
     phi_f = sc[0]*sc[12];
-    k_f = prefactor_units[8] * fwd_A[8]
-                * exp(fwd_beta[8] * tc[0] - activation_units[8] * fwd_Ea[8] * invT);
+    k_f = k_f_s[8];
     dlnkfdT = fwd_beta[8] * invT + activation_units[8] * fwd_Ea[8] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[8] * exp(low_beta[8] * tc[0] - activation_units[8] * low_Ea[8] * invT);
@@ -11066,16 +11208,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[8] == 4 ? exp(-troe_Tss[8] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[8]) > 1.e-100 ? -Fcent1/troe_Tsss[8] : 0.)
+      + (fabs(troe_Ts[8]) > 1.e-100 ? -Fcent2/troe_Ts[8] : 0.)
+      + (troe_len[8] == 4 ? Fcent3*troe_Tss[8]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[8]) > 1.e-100 ? -Fcent1/troe_Tsss[8] : 0.)
-      + (fabs(troe_Ts[8]) > 1.e-100 ? -Fcent2/troe_Ts[8] : 0.)
-      + (troe_len[8] == 4 ? Fcent3*troe_Tss[8]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -11083,7 +11225,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[15];
-    Kc = refCinv * exp(g_RT[0] + g_RT[12] - g_RT[15]);
+    Kc = Kc_s[8];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[12]) + (h_RT[15]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -11101,79 +11243,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[8][0] - 1)*dcdc_fac + k_f*sc[12];
-        J[0] -= dqdci;                /* dwdot[H2]/d[H2] */
-        J[12] -= dqdci;               /* dwdot[CO]/d[H2] */
-        J[15] += dqdci;               /* dwdot[CH2O]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[8][1] - 1)*dcdc_fac;
-        J[125] -= dqdci;              /* dwdot[H2]/d[H2O] */
-        J[137] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[140] += dqdci;              /* dwdot[CH2O]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[8][2] - 1)*dcdc_fac;
-        J[275] -= dqdci;              /* dwdot[H2]/d[CH4] */
-        J[287] -= dqdci;              /* dwdot[CO]/d[CH4] */
-        J[290] += dqdci;              /* dwdot[CH2O]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[8][3] - 1)*dcdc_fac + k_f*sc[0];
-        J[300] -= dqdci;              /* dwdot[H2]/d[CO] */
-        J[312] -= dqdci;              /* dwdot[CO]/d[CO] */
-        J[315] += dqdci;              /* dwdot[CH2O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[8][4] - 1)*dcdc_fac;
-        J[325] -= dqdci;              /* dwdot[H2]/d[CO2] */
-        J[337] -= dqdci;              /* dwdot[CO]/d[CO2] */
-        J[340] += dqdci;              /* dwdot[CH2O]/d[CO2] */
-        /* d()/d[CH2O] */
-        dqdci =  - k_r;
-        J[375] -= dqdci;              /* dwdot[H2]/d[CH2O] */
-        J[387] -= dqdci;              /* dwdot[CO]/d[CH2O] */
-        J[390] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[8][5] - 1)*dcdc_fac;
-        J[525] -= dqdci;              /* dwdot[H2]/d[C2H6] */
-        J[537] -= dqdci;              /* dwdot[CO]/d[C2H6] */
-        J[540] += dqdci;              /* dwdot[CH2O]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[8][6] - 1)*dcdc_fac;
-        J[575] -= dqdci;              /* dwdot[H2]/d[AR] */
-        J[587] -= dqdci;              /* dwdot[CO]/d[AR] */
-        J[590] += dqdci;              /* dwdot[CH2O]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[8][0]*dcdc_fac + k_f*sc[12];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[8][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[8][2]*dcdc_fac;
-        dqdc[12] = TB[8][3]*dcdc_fac + k_f*sc[0];
-        dqdc[13] = TB[8][4]*dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac - k_r;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[8][5]*dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = TB[8][6]*dcdc_fac;
-        for (int k=0; k<24; k++) {
-            J[25*k+0] -= dqdc[k];
-            J[25*k+12] -= dqdc[k];
-            J[25*k+15] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[12] -= dcdc_fac;
+    Jmix[15] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[8][0] - 1)*dcdc_fac + k_f*sc[12];
+    J[0] -= dqdci;                /* dwdot[H2]/d[H2] */
+    J[12] -= dqdci;               /* dwdot[CO]/d[H2] */
+    J[15] += dqdci;               /* dwdot[CH2O]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[8][1] - 1)*dcdc_fac;
+    J[125] -= dqdci;              /* dwdot[H2]/d[H2O] */
+    J[137] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[140] += dqdci;              /* dwdot[CH2O]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[8][2] - 1)*dcdc_fac;
+    J[275] -= dqdci;              /* dwdot[H2]/d[CH4] */
+    J[287] -= dqdci;              /* dwdot[CO]/d[CH4] */
+    J[290] += dqdci;              /* dwdot[CH2O]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[8][3] - 1)*dcdc_fac + k_f*sc[0];
+    J[300] -= dqdci;              /* dwdot[H2]/d[CO] */
+    J[312] -= dqdci;              /* dwdot[CO]/d[CO] */
+    J[315] += dqdci;              /* dwdot[CH2O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[8][4] - 1)*dcdc_fac;
+    J[325] -= dqdci;              /* dwdot[H2]/d[CO2] */
+    J[337] -= dqdci;              /* dwdot[CO]/d[CO2] */
+    J[340] += dqdci;              /* dwdot[CH2O]/d[CO2] */
+    /* d()/d[CH2O] */
+    dqdci =  - k_r;
+    J[375] -= dqdci;              /* dwdot[H2]/d[CH2O] */
+    J[387] -= dqdci;              /* dwdot[CO]/d[CH2O] */
+    J[390] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[8][5] - 1)*dcdc_fac;
+    J[525] -= dqdci;              /* dwdot[H2]/d[C2H6] */
+    J[537] -= dqdci;              /* dwdot[CO]/d[C2H6] */
+    J[540] += dqdci;              /* dwdot[CH2O]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[8][6] - 1)*dcdc_fac;
+    J[575] -= dqdci;              /* dwdot[H2]/d[AR] */
+    J[587] -= dqdci;              /* dwdot[CO]/d[AR] */
+    J[590] += dqdci;              /* dwdot[CH2O]/d[AR] */
     J[600] -= dqdT; /* dwdot[H2]/dT */
     J[612] -= dqdT; /* dwdot[CO]/dT */
     J[615] += dqdT; /* dwdot[CH2O]/dT */
@@ -11182,11 +11295,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[9][0] - 1)*sc[0] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[11] + (TB[9][3] - 1)*sc[12] + (TB[9][4] - 1)*sc[13] + (TB[9][5] - 1)*sc[21] + (TB[9][6] - 1)*sc[23];
+    alpha = (memcmp(TB[9], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[9][0] - 1)*sc[0] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[11] + (TB[9][3] - 1)*sc[12] + (TB[9][4] - 1)*sc[13] + (TB[9][5] - 1)*sc[21] + (TB[9][6] - 1)*sc[23]);
     /* forward */
     phi_f = sc[4]*sc[4];
-    k_f = prefactor_units[9] * fwd_A[9]
-                * exp(fwd_beta[9] * tc[0] - activation_units[9] * fwd_Ea[9] * invT);
+    k_f = k_f_s[9];
     dlnkfdT = fwd_beta[9] * invT + activation_units[9] * fwd_Ea[9] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[9] * exp(low_beta[9] * tc[0] - activation_units[9] * low_Ea[9] * invT);
@@ -11202,16 +11314,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[9] == 4 ? exp(-troe_Tss[9] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[9]) > 1.e-100 ? -Fcent1/troe_Tsss[9] : 0.)
+      + (fabs(troe_Ts[9]) > 1.e-100 ? -Fcent2/troe_Ts[9] : 0.)
+      + (troe_len[9] == 4 ? Fcent3*troe_Tss[9]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[9]) > 1.e-100 ? -Fcent1/troe_Tsss[9] : 0.)
-      + (fabs(troe_Ts[9]) > 1.e-100 ? -Fcent2/troe_Ts[9] : 0.)
-      + (troe_len[9] == 4 ? Fcent3*troe_Tss[9]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -11219,7 +11331,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[7];
-    Kc = refCinv * exp(2*g_RT[4] - g_RT[7]);
+    Kc = Kc_s[9];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[4]) + (h_RT[7]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -11236,74 +11348,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[9][0] - 1)*dcdc_fac;
-        J[4] += -2 * dqdci;           /* dwdot[OH]/d[H2] */
-        J[7] += dqdci;                /* dwdot[H2O2]/d[H2] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*2*sc[4];
-        J[104] += -2 * dqdci;         /* dwdot[OH]/d[OH] */
-        J[107] += dqdci;              /* dwdot[H2O2]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[9][1] - 1)*dcdc_fac;
-        J[129] += -2 * dqdci;         /* dwdot[OH]/d[H2O] */
-        J[132] += dqdci;              /* dwdot[H2O2]/d[H2O] */
-        /* d()/d[H2O2] */
-        dqdci =  - k_r;
-        J[179] += -2 * dqdci;         /* dwdot[OH]/d[H2O2] */
-        J[182] += dqdci;              /* dwdot[H2O2]/d[H2O2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[9][2] - 1)*dcdc_fac;
-        J[279] += -2 * dqdci;         /* dwdot[OH]/d[CH4] */
-        J[282] += dqdci;              /* dwdot[H2O2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[9][3] - 1)*dcdc_fac;
-        J[304] += -2 * dqdci;         /* dwdot[OH]/d[CO] */
-        J[307] += dqdci;              /* dwdot[H2O2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[9][4] - 1)*dcdc_fac;
-        J[329] += -2 * dqdci;         /* dwdot[OH]/d[CO2] */
-        J[332] += dqdci;              /* dwdot[H2O2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[9][5] - 1)*dcdc_fac;
-        J[529] += -2 * dqdci;         /* dwdot[OH]/d[C2H6] */
-        J[532] += dqdci;              /* dwdot[H2O2]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[9][6] - 1)*dcdc_fac;
-        J[579] += -2 * dqdci;         /* dwdot[OH]/d[AR] */
-        J[582] += dqdci;              /* dwdot[H2O2]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[9][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac + k_f*2*sc[4];
-        dqdc[5] = TB[9][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac - k_r;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[9][2]*dcdc_fac;
-        dqdc[12] = TB[9][3]*dcdc_fac;
-        dqdc[13] = TB[9][4]*dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[9][5]*dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = TB[9][6]*dcdc_fac;
-        for (int k=0; k<24; k++) {
-            J[25*k+4] += -2 * dqdc[k];
-            J[25*k+7] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[4] += -2 * dcdc_fac;
+    Jmix[7] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[9][0] - 1)*dcdc_fac;
+    J[4] += -2 * dqdci;           /* dwdot[OH]/d[H2] */
+    J[7] += dqdci;                /* dwdot[H2O2]/d[H2] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*2*sc[4];
+    J[104] += -2 * dqdci;         /* dwdot[OH]/d[OH] */
+    J[107] += dqdci;              /* dwdot[H2O2]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[9][1] - 1)*dcdc_fac;
+    J[129] += -2 * dqdci;         /* dwdot[OH]/d[H2O] */
+    J[132] += dqdci;              /* dwdot[H2O2]/d[H2O] */
+    /* d()/d[H2O2] */
+    dqdci =  - k_r;
+    J[179] += -2 * dqdci;         /* dwdot[OH]/d[H2O2] */
+    J[182] += dqdci;              /* dwdot[H2O2]/d[H2O2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[9][2] - 1)*dcdc_fac;
+    J[279] += -2 * dqdci;         /* dwdot[OH]/d[CH4] */
+    J[282] += dqdci;              /* dwdot[H2O2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[9][3] - 1)*dcdc_fac;
+    J[304] += -2 * dqdci;         /* dwdot[OH]/d[CO] */
+    J[307] += dqdci;              /* dwdot[H2O2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[9][4] - 1)*dcdc_fac;
+    J[329] += -2 * dqdci;         /* dwdot[OH]/d[CO2] */
+    J[332] += dqdci;              /* dwdot[H2O2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[9][5] - 1)*dcdc_fac;
+    J[529] += -2 * dqdci;         /* dwdot[OH]/d[C2H6] */
+    J[532] += dqdci;              /* dwdot[H2O2]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[9][6] - 1)*dcdc_fac;
+    J[579] += -2 * dqdci;         /* dwdot[OH]/d[AR] */
+    J[582] += dqdci;              /* dwdot[H2O2]/d[AR] */
     J[604] += -2 * dqdT; /* dwdot[OH]/dT */
     J[607] += dqdT; /* dwdot[H2O2]/dT */
 
@@ -11311,11 +11394,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[10][0] - 1)*sc[0] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[11] + (TB[10][3] - 1)*sc[12] + (TB[10][4] - 1)*sc[13] + (TB[10][5] - 1)*sc[21] + (TB[10][6] - 1)*sc[23];
+    alpha = (memcmp(TB[10], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[10][0] - 1)*sc[0] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[11] + (TB[10][3] - 1)*sc[12] + (TB[10][4] - 1)*sc[13] + (TB[10][5] - 1)*sc[21] + (TB[10][6] - 1)*sc[23]);
     /* forward */
     phi_f = sc[10]*sc[10];
-    k_f = prefactor_units[10] * fwd_A[10]
-                * exp(fwd_beta[10] * tc[0] - activation_units[10] * fwd_Ea[10] * invT);
+    k_f = k_f_s[10];
     dlnkfdT = fwd_beta[10] * invT + activation_units[10] * fwd_Ea[10] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[10] * exp(low_beta[10] * tc[0] - activation_units[10] * low_Ea[10] * invT);
@@ -11331,16 +11413,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[10] == 4 ? exp(-troe_Tss[10] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[10]) > 1.e-100 ? -Fcent1/troe_Tsss[10] : 0.)
+      + (fabs(troe_Ts[10]) > 1.e-100 ? -Fcent2/troe_Ts[10] : 0.)
+      + (troe_len[10] == 4 ? Fcent3*troe_Tss[10]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[10]) > 1.e-100 ? -Fcent1/troe_Tsss[10] : 0.)
-      + (fabs(troe_Ts[10]) > 1.e-100 ? -Fcent2/troe_Ts[10] : 0.)
-      + (troe_len[10] == 4 ? Fcent3*troe_Tss[10]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -11348,7 +11430,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[21];
-    Kc = refCinv * exp(2*g_RT[10] - g_RT[21]);
+    Kc = Kc_s[10];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[10]) + (h_RT[21]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -11365,70 +11447,41 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[10][0] - 1)*dcdc_fac;
-        J[10] += -2 * dqdci;          /* dwdot[CH3]/d[H2] */
-        J[21] += dqdci;               /* dwdot[C2H6]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[10][1] - 1)*dcdc_fac;
-        J[135] += -2 * dqdci;         /* dwdot[CH3]/d[H2O] */
-        J[146] += dqdci;              /* dwdot[C2H6]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*2*sc[10];
-        J[260] += -2 * dqdci;         /* dwdot[CH3]/d[CH3] */
-        J[271] += dqdci;              /* dwdot[C2H6]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[10][2] - 1)*dcdc_fac;
-        J[285] += -2 * dqdci;         /* dwdot[CH3]/d[CH4] */
-        J[296] += dqdci;              /* dwdot[C2H6]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[10][3] - 1)*dcdc_fac;
-        J[310] += -2 * dqdci;         /* dwdot[CH3]/d[CO] */
-        J[321] += dqdci;              /* dwdot[C2H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[10][4] - 1)*dcdc_fac;
-        J[335] += -2 * dqdci;         /* dwdot[CH3]/d[CO2] */
-        J[346] += dqdci;              /* dwdot[C2H6]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[10][5] - 1)*dcdc_fac - k_r;
-        J[535] += -2 * dqdci;         /* dwdot[CH3]/d[C2H6] */
-        J[546] += dqdci;              /* dwdot[C2H6]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[10][6] - 1)*dcdc_fac;
-        J[585] += -2 * dqdci;         /* dwdot[CH3]/d[AR] */
-        J[596] += dqdci;              /* dwdot[C2H6]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[10][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[10][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac + k_f*2*sc[10];
-        dqdc[11] = TB[10][2]*dcdc_fac;
-        dqdc[12] = TB[10][3]*dcdc_fac;
-        dqdc[13] = TB[10][4]*dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[10][5]*dcdc_fac - k_r;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = TB[10][6]*dcdc_fac;
-        for (int k=0; k<24; k++) {
-            J[25*k+10] += -2 * dqdc[k];
-            J[25*k+21] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[10] += -2 * dcdc_fac;
+    Jmix[21] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[10][0] - 1)*dcdc_fac;
+    J[10] += -2 * dqdci;          /* dwdot[CH3]/d[H2] */
+    J[21] += dqdci;               /* dwdot[C2H6]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[10][1] - 1)*dcdc_fac;
+    J[135] += -2 * dqdci;         /* dwdot[CH3]/d[H2O] */
+    J[146] += dqdci;              /* dwdot[C2H6]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*2*sc[10];
+    J[260] += -2 * dqdci;         /* dwdot[CH3]/d[CH3] */
+    J[271] += dqdci;              /* dwdot[C2H6]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[10][2] - 1)*dcdc_fac;
+    J[285] += -2 * dqdci;         /* dwdot[CH3]/d[CH4] */
+    J[296] += dqdci;              /* dwdot[C2H6]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[10][3] - 1)*dcdc_fac;
+    J[310] += -2 * dqdci;         /* dwdot[CH3]/d[CO] */
+    J[321] += dqdci;              /* dwdot[C2H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[10][4] - 1)*dcdc_fac;
+    J[335] += -2 * dqdci;         /* dwdot[CH3]/d[CO2] */
+    J[346] += dqdci;              /* dwdot[C2H6]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[10][5] - 1)*dcdc_fac - k_r;
+    J[535] += -2 * dqdci;         /* dwdot[CH3]/d[C2H6] */
+    J[546] += dqdci;              /* dwdot[C2H6]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[10][6] - 1)*dcdc_fac;
+    J[585] += -2 * dqdci;         /* dwdot[CH3]/d[AR] */
+    J[596] += dqdci;              /* dwdot[C2H6]/d[AR] */
     J[610] += -2 * dqdT; /* dwdot[CH3]/dT */
     J[621] += dqdT; /* dwdot[C2H6]/dT */
 
@@ -11436,11 +11489,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[11][0] - 1)*sc[0] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[11] + (TB[11][3] - 1)*sc[12] + (TB[11][4] - 1)*sc[13] + (TB[11][5] - 1)*sc[21] + (TB[11][6] - 1)*sc[23];
+    alpha = (memcmp(TB[11], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[11][0] - 1)*sc[0] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[11] + (TB[11][3] - 1)*sc[12] + (TB[11][4] - 1)*sc[13] + (TB[11][5] - 1)*sc[21] + (TB[11][6] - 1)*sc[23]);
     /* forward */
     phi_f = sc[19];
-    k_f = prefactor_units[11] * fwd_A[11]
-                * exp(fwd_beta[11] * tc[0] - activation_units[11] * fwd_Ea[11] * invT);
+    k_f = k_f_s[11];
     dlnkfdT = fwd_beta[11] * invT + activation_units[11] * fwd_Ea[11] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[11] * exp(low_beta[11] * tc[0] - activation_units[11] * low_Ea[11] * invT);
@@ -11456,16 +11508,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[11] == 4 ? exp(-troe_Tss[11] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[11]) > 1.e-100 ? -Fcent1/troe_Tsss[11] : 0.)
+      + (fabs(troe_Ts[11]) > 1.e-100 ? -Fcent2/troe_Ts[11] : 0.)
+      + (troe_len[11] == 4 ? Fcent3*troe_Tss[11]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[11]) > 1.e-100 ? -Fcent1/troe_Tsss[11] : 0.)
-      + (fabs(troe_Ts[11]) > 1.e-100 ? -Fcent2/troe_Ts[11] : 0.)
-      + (troe_len[11] == 4 ? Fcent3*troe_Tss[11]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -11473,7 +11525,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[0]*sc[17];
-    Kc = refC * exp(-g_RT[0] - g_RT[17] + g_RT[19]);
+    Kc = Kc_s[11];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[19]) + (h_RT[0] + h_RT[17]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -11491,84 +11543,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[11][0] - 1)*dcdc_fac - k_r*sc[17];
-        J[0] += dqdci;                /* dwdot[H2]/d[H2] */
-        J[17] += dqdci;               /* dwdot[C2H2]/d[H2] */
-        J[19] -= dqdci;               /* dwdot[C2H4]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[11][1] - 1)*dcdc_fac;
-        J[125] += dqdci;              /* dwdot[H2]/d[H2O] */
-        J[142] += dqdci;              /* dwdot[C2H2]/d[H2O] */
-        J[144] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[11][2] - 1)*dcdc_fac;
-        J[275] += dqdci;              /* dwdot[H2]/d[CH4] */
-        J[292] += dqdci;              /* dwdot[C2H2]/d[CH4] */
-        J[294] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[11][3] - 1)*dcdc_fac;
-        J[300] += dqdci;              /* dwdot[H2]/d[CO] */
-        J[317] += dqdci;              /* dwdot[C2H2]/d[CO] */
-        J[319] -= dqdci;              /* dwdot[C2H4]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[11][4] - 1)*dcdc_fac;
-        J[325] += dqdci;              /* dwdot[H2]/d[CO2] */
-        J[342] += dqdci;              /* dwdot[C2H2]/d[CO2] */
-        J[344] -= dqdci;              /* dwdot[C2H4]/d[CO2] */
-        /* d()/d[C2H2] */
-        dqdci =  - k_r*sc[0];
-        J[425] += dqdci;              /* dwdot[H2]/d[C2H2] */
-        J[442] += dqdci;              /* dwdot[C2H2]/d[C2H2] */
-        J[444] -= dqdci;              /* dwdot[C2H4]/d[C2H2] */
-        /* d()/d[C2H4] */
-        dqdci =  + k_f;
-        J[475] += dqdci;              /* dwdot[H2]/d[C2H4] */
-        J[492] += dqdci;              /* dwdot[C2H2]/d[C2H4] */
-        J[494] -= dqdci;              /* dwdot[C2H4]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[11][5] - 1)*dcdc_fac;
-        J[525] += dqdci;              /* dwdot[H2]/d[C2H6] */
-        J[542] += dqdci;              /* dwdot[C2H2]/d[C2H6] */
-        J[544] -= dqdci;              /* dwdot[C2H4]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[11][6] - 1)*dcdc_fac;
-        J[575] += dqdci;              /* dwdot[H2]/d[AR] */
-        J[592] += dqdci;              /* dwdot[C2H2]/d[AR] */
-        J[594] -= dqdci;              /* dwdot[C2H4]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[11][0]*dcdc_fac - k_r*sc[17];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[11][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[11][2]*dcdc_fac;
-        dqdc[12] = TB[11][3]*dcdc_fac;
-        dqdc[13] = TB[11][4]*dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac - k_r*sc[0];
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac + k_f;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[11][5]*dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = TB[11][6]*dcdc_fac;
-        for (int k=0; k<24; k++) {
-            J[25*k+0] += dqdc[k];
-            J[25*k+17] += dqdc[k];
-            J[25*k+19] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += dcdc_fac;
+    Jmix[17] += dcdc_fac;
+    Jmix[19] -= dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[11][0] - 1)*dcdc_fac - k_r*sc[17];
+    J[0] += dqdci;                /* dwdot[H2]/d[H2] */
+    J[17] += dqdci;               /* dwdot[C2H2]/d[H2] */
+    J[19] -= dqdci;               /* dwdot[C2H4]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[11][1] - 1)*dcdc_fac;
+    J[125] += dqdci;              /* dwdot[H2]/d[H2O] */
+    J[142] += dqdci;              /* dwdot[C2H2]/d[H2O] */
+    J[144] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[11][2] - 1)*dcdc_fac;
+    J[275] += dqdci;              /* dwdot[H2]/d[CH4] */
+    J[292] += dqdci;              /* dwdot[C2H2]/d[CH4] */
+    J[294] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[11][3] - 1)*dcdc_fac;
+    J[300] += dqdci;              /* dwdot[H2]/d[CO] */
+    J[317] += dqdci;              /* dwdot[C2H2]/d[CO] */
+    J[319] -= dqdci;              /* dwdot[C2H4]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[11][4] - 1)*dcdc_fac;
+    J[325] += dqdci;              /* dwdot[H2]/d[CO2] */
+    J[342] += dqdci;              /* dwdot[C2H2]/d[CO2] */
+    J[344] -= dqdci;              /* dwdot[C2H4]/d[CO2] */
+    /* d()/d[C2H2] */
+    dqdci =  - k_r*sc[0];
+    J[425] += dqdci;              /* dwdot[H2]/d[C2H2] */
+    J[442] += dqdci;              /* dwdot[C2H2]/d[C2H2] */
+    J[444] -= dqdci;              /* dwdot[C2H4]/d[C2H2] */
+    /* d()/d[C2H4] */
+    dqdci =  + k_f;
+    J[475] += dqdci;              /* dwdot[H2]/d[C2H4] */
+    J[492] += dqdci;              /* dwdot[C2H2]/d[C2H4] */
+    J[494] -= dqdci;              /* dwdot[C2H4]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[11][5] - 1)*dcdc_fac;
+    J[525] += dqdci;              /* dwdot[H2]/d[C2H6] */
+    J[542] += dqdci;              /* dwdot[C2H2]/d[C2H6] */
+    J[544] -= dqdci;              /* dwdot[C2H4]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[11][6] - 1)*dcdc_fac;
+    J[575] += dqdci;              /* dwdot[H2]/d[AR] */
+    J[592] += dqdci;              /* dwdot[C2H2]/d[AR] */
+    J[594] -= dqdci;              /* dwdot[C2H4]/d[AR] */
     J[600] += dqdT; /* dwdot[H2]/dT */
     J[617] += dqdT; /* dwdot[C2H2]/dT */
     J[619] -= dqdT; /* dwdot[C2H4]/dT */
@@ -11576,15 +11599,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 13: O + H + M <=> OH + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[12][0] - 1)*sc[0] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[11] + (TB[12][3] - 1)*sc[12] + (TB[12][4] - 1)*sc[13] + (TB[12][5] - 1)*sc[21] + (TB[12][6] - 1)*sc[23];
+    alpha = (memcmp(TB[12], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[12][0] - 1)*sc[0] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[11] + (TB[12][3] - 1)*sc[12] + (TB[12][4] - 1)*sc[13] + (TB[12][5] - 1)*sc[21] + (TB[12][6] - 1)*sc[23]);
     /* forward */
     phi_f = sc[1]*sc[2];
-    k_f = prefactor_units[12] * fwd_A[12]
-                * exp(fwd_beta[12] * tc[0] - activation_units[12] * fwd_Ea[12] * invT);
+    k_f = k_f_s[12];
     dlnkfdT = fwd_beta[12] * invT + activation_units[12] * fwd_Ea[12] * invT2;
     /* reverse */
     phi_r = sc[4];
-    Kc = refCinv * exp(g_RT[1] + g_RT[2] - g_RT[4]);
+    Kc = Kc_s[12];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[2]) + (h_RT[4]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -11599,89 +11621,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[12][0] - 1)*q_nocor;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[2] -= dqdci;                /* dwdot[O]/d[H2] */
-        J[4] += dqdci;                /* dwdot[OH]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[2];
-        J[26] -= dqdci;               /* dwdot[H]/d[H] */
-        J[27] -= dqdci;               /* dwdot[O]/d[H] */
-        J[29] += dqdci;               /* dwdot[OH]/d[H] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[1];
-        J[51] -= dqdci;               /* dwdot[H]/d[O] */
-        J[52] -= dqdci;               /* dwdot[O]/d[O] */
-        J[54] += dqdci;               /* dwdot[OH]/d[O] */
-        /* d()/d[OH] */
-        dqdci =  - k_r;
-        J[101] -= dqdci;              /* dwdot[H]/d[OH] */
-        J[102] -= dqdci;              /* dwdot[O]/d[OH] */
-        J[104] += dqdci;              /* dwdot[OH]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[12][1] - 1)*q_nocor;
-        J[126] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[127] -= dqdci;              /* dwdot[O]/d[H2O] */
-        J[129] += dqdci;              /* dwdot[OH]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[12][2] - 1)*q_nocor;
-        J[276] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[277] -= dqdci;              /* dwdot[O]/d[CH4] */
-        J[279] += dqdci;              /* dwdot[OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[12][3] - 1)*q_nocor;
-        J[301] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[302] -= dqdci;              /* dwdot[O]/d[CO] */
-        J[304] += dqdci;              /* dwdot[OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[12][4] - 1)*q_nocor;
-        J[326] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[327] -= dqdci;              /* dwdot[O]/d[CO2] */
-        J[329] += dqdci;              /* dwdot[OH]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[12][5] - 1)*q_nocor;
-        J[526] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[527] -= dqdci;              /* dwdot[O]/d[C2H6] */
-        J[529] += dqdci;              /* dwdot[OH]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[12][6] - 1)*q_nocor;
-        J[576] -= dqdci;              /* dwdot[H]/d[AR] */
-        J[577] -= dqdci;              /* dwdot[O]/d[AR] */
-        J[579] += dqdci;              /* dwdot[OH]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[12][0];
-        dqdc[1] = dcdc_fac + k_f*sc[2];
-        dqdc[2] = dcdc_fac + k_f*sc[1];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac - k_r;
-        dqdc[5] = TB[12][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[12][2];
-        dqdc[12] = TB[12][3];
-        dqdc[13] = TB[12][4];
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[12][5];
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = TB[12][6];
-        for (int k=0; k<24; k++) {
-            J[25*k+1] -= dqdc[k];
-            J[25*k+2] -= dqdc[k];
-            J[25*k+4] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= q_nocor;
+    Jmix[2] -= q_nocor;
+    Jmix[4] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[12][0] - 1)*q_nocor;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[2] -= dqdci;                /* dwdot[O]/d[H2] */
+    J[4] += dqdci;                /* dwdot[OH]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[2];
+    J[26] -= dqdci;               /* dwdot[H]/d[H] */
+    J[27] -= dqdci;               /* dwdot[O]/d[H] */
+    J[29] += dqdci;               /* dwdot[OH]/d[H] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[1];
+    J[51] -= dqdci;               /* dwdot[H]/d[O] */
+    J[52] -= dqdci;               /* dwdot[O]/d[O] */
+    J[54] += dqdci;               /* dwdot[OH]/d[O] */
+    /* d()/d[OH] */
+    dqdci =  - k_r;
+    J[101] -= dqdci;              /* dwdot[H]/d[OH] */
+    J[102] -= dqdci;              /* dwdot[O]/d[OH] */
+    J[104] += dqdci;              /* dwdot[OH]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[12][1] - 1)*q_nocor;
+    J[126] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[127] -= dqdci;              /* dwdot[O]/d[H2O] */
+    J[129] += dqdci;              /* dwdot[OH]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[12][2] - 1)*q_nocor;
+    J[276] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[277] -= dqdci;              /* dwdot[O]/d[CH4] */
+    J[279] += dqdci;              /* dwdot[OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[12][3] - 1)*q_nocor;
+    J[301] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[302] -= dqdci;              /* dwdot[O]/d[CO] */
+    J[304] += dqdci;              /* dwdot[OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[12][4] - 1)*q_nocor;
+    J[326] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[327] -= dqdci;              /* dwdot[O]/d[CO2] */
+    J[329] += dqdci;              /* dwdot[OH]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[12][5] - 1)*q_nocor;
+    J[526] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[527] -= dqdci;              /* dwdot[O]/d[C2H6] */
+    J[529] += dqdci;              /* dwdot[OH]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[12][6] - 1)*q_nocor;
+    J[576] -= dqdci;              /* dwdot[H]/d[AR] */
+    J[577] -= dqdci;              /* dwdot[O]/d[AR] */
+    J[579] += dqdci;              /* dwdot[OH]/d[AR] */
     J[601] -= dqdT; /* dwdot[H]/dT */
     J[602] -= dqdT; /* dwdot[O]/dT */
     J[604] += dqdT; /* dwdot[OH]/dT */
@@ -11692,12 +11685,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[13][0] - 1)*sc[0] + (TB[13][1] - 1)*sc[3] + (TB[13][2] - 1)*sc[5] + (TB[13][3] - 1)*sc[11] + (TB[13][4] - 1)*sc[12] + (TB[13][5] - 1)*sc[13] + (TB[13][6] - 1)*sc[21] + (TB[13][7] - 1)*sc[23];
     /* forward */
     phi_f = sc[2]*sc[12];
-    k_f = prefactor_units[13] * fwd_A[13]
-                * exp(fwd_beta[13] * tc[0] - activation_units[13] * fwd_Ea[13] * invT);
+    k_f = k_f_s[13];
     dlnkfdT = fwd_beta[13] * invT + activation_units[13] * fwd_Ea[13] * invT2;
     /* reverse */
     phi_r = sc[13];
-    Kc = refCinv * exp(g_RT[2] + g_RT[12] - g_RT[13]);
+    Kc = Kc_s[13];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[12]) + (h_RT[13]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -11712,84 +11704,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[13][0] - 1)*q_nocor;
-        J[2] -= dqdci;                /* dwdot[O]/d[H2] */
-        J[12] -= dqdci;               /* dwdot[CO]/d[H2] */
-        J[13] += dqdci;               /* dwdot[CO2]/d[H2] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[12];
-        J[52] -= dqdci;               /* dwdot[O]/d[O] */
-        J[62] -= dqdci;               /* dwdot[CO]/d[O] */
-        J[63] += dqdci;               /* dwdot[CO2]/d[O] */
-        /* d()/d[O2] */
-        dqdci = (TB[13][1] - 1)*q_nocor;
-        J[77] -= dqdci;               /* dwdot[O]/d[O2] */
-        J[87] -= dqdci;               /* dwdot[CO]/d[O2] */
-        J[88] += dqdci;               /* dwdot[CO2]/d[O2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[13][2] - 1)*q_nocor;
-        J[127] -= dqdci;              /* dwdot[O]/d[H2O] */
-        J[137] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[138] += dqdci;              /* dwdot[CO2]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[13][3] - 1)*q_nocor;
-        J[277] -= dqdci;              /* dwdot[O]/d[CH4] */
-        J[287] -= dqdci;              /* dwdot[CO]/d[CH4] */
-        J[288] += dqdci;              /* dwdot[CO2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[13][4] - 1)*q_nocor + k_f*sc[2];
-        J[302] -= dqdci;              /* dwdot[O]/d[CO] */
-        J[312] -= dqdci;              /* dwdot[CO]/d[CO] */
-        J[313] += dqdci;              /* dwdot[CO2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[13][5] - 1)*q_nocor - k_r;
-        J[327] -= dqdci;              /* dwdot[O]/d[CO2] */
-        J[337] -= dqdci;              /* dwdot[CO]/d[CO2] */
-        J[338] += dqdci;              /* dwdot[CO2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[13][6] - 1)*q_nocor;
-        J[527] -= dqdci;              /* dwdot[O]/d[C2H6] */
-        J[537] -= dqdci;              /* dwdot[CO]/d[C2H6] */
-        J[538] += dqdci;              /* dwdot[CO2]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[13][7] - 1)*q_nocor;
-        J[577] -= dqdci;              /* dwdot[O]/d[AR] */
-        J[587] -= dqdci;              /* dwdot[CO]/d[AR] */
-        J[588] += dqdci;              /* dwdot[CO2]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[13][0];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*sc[12];
-        dqdc[3] = TB[13][1];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[13][2];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[13][3];
-        dqdc[12] = TB[13][4] + k_f*sc[2];
-        dqdc[13] = TB[13][5] - k_r;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[13][6];
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = TB[13][7];
-        for (int k=0; k<24; k++) {
-            J[25*k+2] -= dqdc[k];
-            J[25*k+12] -= dqdc[k];
-            J[25*k+13] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] -= q_nocor;
+    Jmix[12] -= q_nocor;
+    Jmix[13] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[13][0] - 1)*q_nocor;
+    J[2] -= dqdci;                /* dwdot[O]/d[H2] */
+    J[12] -= dqdci;               /* dwdot[CO]/d[H2] */
+    J[13] += dqdci;               /* dwdot[CO2]/d[H2] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[12];
+    J[52] -= dqdci;               /* dwdot[O]/d[O] */
+    J[62] -= dqdci;               /* dwdot[CO]/d[O] */
+    J[63] += dqdci;               /* dwdot[CO2]/d[O] */
+    /* d()/d[O2] */
+    dqdci = (TB[13][1] - 1)*q_nocor;
+    J[77] -= dqdci;               /* dwdot[O]/d[O2] */
+    J[87] -= dqdci;               /* dwdot[CO]/d[O2] */
+    J[88] += dqdci;               /* dwdot[CO2]/d[O2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[13][2] - 1)*q_nocor;
+    J[127] -= dqdci;              /* dwdot[O]/d[H2O] */
+    J[137] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[138] += dqdci;              /* dwdot[CO2]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[13][3] - 1)*q_nocor;
+    J[277] -= dqdci;              /* dwdot[O]/d[CH4] */
+    J[287] -= dqdci;              /* dwdot[CO]/d[CH4] */
+    J[288] += dqdci;              /* dwdot[CO2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[13][4] - 1)*q_nocor + k_f*sc[2];
+    J[302] -= dqdci;              /* dwdot[O]/d[CO] */
+    J[312] -= dqdci;              /* dwdot[CO]/d[CO] */
+    J[313] += dqdci;              /* dwdot[CO2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[13][5] - 1)*q_nocor - k_r;
+    J[327] -= dqdci;              /* dwdot[O]/d[CO2] */
+    J[337] -= dqdci;              /* dwdot[CO]/d[CO2] */
+    J[338] += dqdci;              /* dwdot[CO2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[13][6] - 1)*q_nocor;
+    J[527] -= dqdci;              /* dwdot[O]/d[C2H6] */
+    J[537] -= dqdci;              /* dwdot[CO]/d[C2H6] */
+    J[538] += dqdci;              /* dwdot[CO2]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[13][7] - 1)*q_nocor;
+    J[577] -= dqdci;              /* dwdot[O]/d[AR] */
+    J[587] -= dqdci;              /* dwdot[CO]/d[AR] */
+    J[588] += dqdci;              /* dwdot[CO2]/d[AR] */
     J[602] -= dqdT; /* dwdot[O]/dT */
     J[612] -= dqdT; /* dwdot[CO]/dT */
     J[613] += dqdT; /* dwdot[CO2]/dT */
@@ -11800,12 +11763,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[14][0] - 1)*sc[3] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[12] + (TB[14][3] - 1)*sc[13] + (TB[14][4] - 1)*sc[21] + (TB[14][5] - 1)*sc[22] + (TB[14][6] - 1)*sc[23];
     /* forward */
     phi_f = sc[1]*sc[3];
-    k_f = prefactor_units[14] * fwd_A[14]
-                * exp(fwd_beta[14] * tc[0] - activation_units[14] * fwd_Ea[14] * invT);
+    k_f = k_f_s[14];
     dlnkfdT = fwd_beta[14] * invT + activation_units[14] * fwd_Ea[14] * invT2;
     /* reverse */
     phi_r = sc[6];
-    Kc = refCinv * exp(g_RT[1] + g_RT[3] - g_RT[6]);
+    Kc = Kc_s[14];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3]) + (h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -11820,84 +11782,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[3];
-        J[26] -= dqdci;               /* dwdot[H]/d[H] */
-        J[28] -= dqdci;               /* dwdot[O2]/d[H] */
-        J[31] += dqdci;               /* dwdot[HO2]/d[H] */
-        /* d()/d[O2] */
-        dqdci = (TB[14][0] - 1)*q_nocor + k_f*sc[1];
-        J[76] -= dqdci;               /* dwdot[H]/d[O2] */
-        J[78] -= dqdci;               /* dwdot[O2]/d[O2] */
-        J[81] += dqdci;               /* dwdot[HO2]/d[O2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[14][1] - 1)*q_nocor;
-        J[126] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[128] -= dqdci;              /* dwdot[O2]/d[H2O] */
-        J[131] += dqdci;              /* dwdot[HO2]/d[H2O] */
-        /* d()/d[HO2] */
-        dqdci =  - k_r;
-        J[151] -= dqdci;              /* dwdot[H]/d[HO2] */
-        J[153] -= dqdci;              /* dwdot[O2]/d[HO2] */
-        J[156] += dqdci;              /* dwdot[HO2]/d[HO2] */
-        /* d()/d[CO] */
-        dqdci = (TB[14][2] - 1)*q_nocor;
-        J[301] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[303] -= dqdci;              /* dwdot[O2]/d[CO] */
-        J[306] += dqdci;              /* dwdot[HO2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[14][3] - 1)*q_nocor;
-        J[326] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[328] -= dqdci;              /* dwdot[O2]/d[CO2] */
-        J[331] += dqdci;              /* dwdot[HO2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[14][4] - 1)*q_nocor;
-        J[526] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[528] -= dqdci;              /* dwdot[O2]/d[C2H6] */
-        J[531] += dqdci;              /* dwdot[HO2]/d[C2H6] */
-        /* d()/d[N2] */
-        dqdci = (TB[14][5] - 1)*q_nocor;
-        J[551] -= dqdci;              /* dwdot[H]/d[N2] */
-        J[553] -= dqdci;              /* dwdot[O2]/d[N2] */
-        J[556] += dqdci;              /* dwdot[HO2]/d[N2] */
-        /* d()/d[AR] */
-        dqdci = (TB[14][6] - 1)*q_nocor;
-        J[576] -= dqdci;              /* dwdot[H]/d[AR] */
-        J[578] -= dqdci;              /* dwdot[O2]/d[AR] */
-        J[581] += dqdci;              /* dwdot[HO2]/d[AR] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[3];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = TB[14][0] + k_f*sc[1];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[14][1];
-        dqdc[6] = dcdc_fac - k_r;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = TB[14][2];
-        dqdc[13] = TB[14][3];
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[14][4];
-        dqdc[22] = TB[14][5];
-        dqdc[23] = TB[14][6];
-        for (int k=0; k<24; k++) {
-            J[25*k+1] -= dqdc[k];
-            J[25*k+3] -= dqdc[k];
-            J[25*k+6] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= q_nocor;
+    Jmix[3] -= q_nocor;
+    Jmix[6] += q_nocor;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[3];
+    J[26] -= dqdci;               /* dwdot[H]/d[H] */
+    J[28] -= dqdci;               /* dwdot[O2]/d[H] */
+    J[31] += dqdci;               /* dwdot[HO2]/d[H] */
+    /* d()/d[O2] */
+    dqdci = (TB[14][0] - 1)*q_nocor + k_f*sc[1];
+    J[76] -= dqdci;               /* dwdot[H]/d[O2] */
+    J[78] -= dqdci;               /* dwdot[O2]/d[O2] */
+    J[81] += dqdci;               /* dwdot[HO2]/d[O2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[14][1] - 1)*q_nocor;
+    J[126] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[128] -= dqdci;              /* dwdot[O2]/d[H2O] */
+    J[131] += dqdci;              /* dwdot[HO2]/d[H2O] */
+    /* d()/d[HO2] */
+    dqdci =  - k_r;
+    J[151] -= dqdci;              /* dwdot[H]/d[HO2] */
+    J[153] -= dqdci;              /* dwdot[O2]/d[HO2] */
+    J[156] += dqdci;              /* dwdot[HO2]/d[HO2] */
+    /* d()/d[CO] */
+    dqdci = (TB[14][2] - 1)*q_nocor;
+    J[301] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[303] -= dqdci;              /* dwdot[O2]/d[CO] */
+    J[306] += dqdci;              /* dwdot[HO2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[14][3] - 1)*q_nocor;
+    J[326] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[328] -= dqdci;              /* dwdot[O2]/d[CO2] */
+    J[331] += dqdci;              /* dwdot[HO2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[14][4] - 1)*q_nocor;
+    J[526] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[528] -= dqdci;              /* dwdot[O2]/d[C2H6] */
+    J[531] += dqdci;              /* dwdot[HO2]/d[C2H6] */
+    /* d()/d[N2] */
+    dqdci = (TB[14][5] - 1)*q_nocor;
+    J[551] -= dqdci;              /* dwdot[H]/d[N2] */
+    J[553] -= dqdci;              /* dwdot[O2]/d[N2] */
+    J[556] += dqdci;              /* dwdot[HO2]/d[N2] */
+    /* d()/d[AR] */
+    dqdci = (TB[14][6] - 1)*q_nocor;
+    J[576] -= dqdci;              /* dwdot[H]/d[AR] */
+    J[578] -= dqdci;              /* dwdot[O2]/d[AR] */
+    J[581] += dqdci;              /* dwdot[HO2]/d[AR] */
     J[601] -= dqdT; /* dwdot[H]/dT */
     J[603] -= dqdT; /* dwdot[O2]/dT */
     J[606] += dqdT; /* dwdot[HO2]/dT */
@@ -11908,12 +11841,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[15][0] - 1)*sc[0] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[11] + (TB[15][3] - 1)*sc[13] + (TB[15][4] - 1)*sc[21] + (TB[15][5] - 1)*sc[23];
     /* forward */
     phi_f = sc[1]*sc[1];
-    k_f = prefactor_units[15] * fwd_A[15]
-                * exp(fwd_beta[15] * tc[0] - activation_units[15] * fwd_Ea[15] * invT);
+    k_f = k_f_s[15];
     dlnkfdT = fwd_beta[15] * invT + activation_units[15] * fwd_Ea[15] * invT2;
     /* reverse */
     phi_r = sc[0];
-    Kc = refCinv * exp(-g_RT[0] + 2*g_RT[1]);
+    Kc = Kc_s[15];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[1]) + (h_RT[0]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -11927,66 +11859,37 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[15][0] - 1)*q_nocor - k_r;
-        J[0] += dqdci;                /* dwdot[H2]/d[H2] */
-        J[1] += -2 * dqdci;           /* dwdot[H]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*2*sc[1];
-        J[25] += dqdci;               /* dwdot[H2]/d[H] */
-        J[26] += -2 * dqdci;          /* dwdot[H]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[15][1] - 1)*q_nocor;
-        J[125] += dqdci;              /* dwdot[H2]/d[H2O] */
-        J[126] += -2 * dqdci;         /* dwdot[H]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[15][2] - 1)*q_nocor;
-        J[275] += dqdci;              /* dwdot[H2]/d[CH4] */
-        J[276] += -2 * dqdci;         /* dwdot[H]/d[CH4] */
-        /* d()/d[CO2] */
-        dqdci = (TB[15][3] - 1)*q_nocor;
-        J[325] += dqdci;              /* dwdot[H2]/d[CO2] */
-        J[326] += -2 * dqdci;         /* dwdot[H]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[15][4] - 1)*q_nocor;
-        J[525] += dqdci;              /* dwdot[H2]/d[C2H6] */
-        J[526] += -2 * dqdci;         /* dwdot[H]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[15][5] - 1)*q_nocor;
-        J[575] += dqdci;              /* dwdot[H2]/d[AR] */
-        J[576] += -2 * dqdci;         /* dwdot[H]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[15][0] - k_r;
-        dqdc[1] = dcdc_fac + k_f*2*sc[1];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[15][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[15][2];
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[15][3];
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[15][4];
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = TB[15][5];
-        for (int k=0; k<24; k++) {
-            J[25*k+0] += dqdc[k];
-            J[25*k+1] += -2 * dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += q_nocor;
+    Jmix[1] += -2 * q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[15][0] - 1)*q_nocor - k_r;
+    J[0] += dqdci;                /* dwdot[H2]/d[H2] */
+    J[1] += -2 * dqdci;           /* dwdot[H]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*2*sc[1];
+    J[25] += dqdci;               /* dwdot[H2]/d[H] */
+    J[26] += -2 * dqdci;          /* dwdot[H]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[15][1] - 1)*q_nocor;
+    J[125] += dqdci;              /* dwdot[H2]/d[H2O] */
+    J[126] += -2 * dqdci;         /* dwdot[H]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[15][2] - 1)*q_nocor;
+    J[275] += dqdci;              /* dwdot[H2]/d[CH4] */
+    J[276] += -2 * dqdci;         /* dwdot[H]/d[CH4] */
+    /* d()/d[CO2] */
+    dqdci = (TB[15][3] - 1)*q_nocor;
+    J[325] += dqdci;              /* dwdot[H2]/d[CO2] */
+    J[326] += -2 * dqdci;         /* dwdot[H]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[15][4] - 1)*q_nocor;
+    J[525] += dqdci;              /* dwdot[H2]/d[C2H6] */
+    J[526] += -2 * dqdci;         /* dwdot[H]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[15][5] - 1)*q_nocor;
+    J[575] += dqdci;              /* dwdot[H2]/d[AR] */
+    J[576] += -2 * dqdci;         /* dwdot[H]/d[AR] */
     J[600] += dqdT; /* dwdot[H2]/dT */
     J[601] += -2 * dqdT; /* dwdot[H]/dT */
 
@@ -11996,12 +11899,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[16][0] - 1)*sc[0] + (TB[16][1] - 1)*sc[5] + (TB[16][2] - 1)*sc[11] + (TB[16][3] - 1)*sc[21] + (TB[16][4] - 1)*sc[23];
     /* forward */
     phi_f = sc[1]*sc[4];
-    k_f = prefactor_units[16] * fwd_A[16]
-                * exp(fwd_beta[16] * tc[0] - activation_units[16] * fwd_Ea[16] * invT);
+    k_f = k_f_s[16];
     dlnkfdT = fwd_beta[16] * invT + activation_units[16] * fwd_Ea[16] * invT2;
     /* reverse */
     phi_r = sc[5];
-    Kc = refCinv * exp(g_RT[1] + g_RT[4] - g_RT[5]);
+    Kc = Kc_s[16];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[4]) + (h_RT[5]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -12016,74 +11918,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[16][0] - 1)*q_nocor;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[4] -= dqdci;                /* dwdot[OH]/d[H2] */
-        J[5] += dqdci;                /* dwdot[H2O]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[4];
-        J[26] -= dqdci;               /* dwdot[H]/d[H] */
-        J[29] -= dqdci;               /* dwdot[OH]/d[H] */
-        J[30] += dqdci;               /* dwdot[H2O]/d[H] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*sc[1];
-        J[101] -= dqdci;              /* dwdot[H]/d[OH] */
-        J[104] -= dqdci;              /* dwdot[OH]/d[OH] */
-        J[105] += dqdci;              /* dwdot[H2O]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[16][1] - 1)*q_nocor - k_r;
-        J[126] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[129] -= dqdci;              /* dwdot[OH]/d[H2O] */
-        J[130] += dqdci;              /* dwdot[H2O]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[16][2] - 1)*q_nocor;
-        J[276] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[279] -= dqdci;              /* dwdot[OH]/d[CH4] */
-        J[280] += dqdci;              /* dwdot[H2O]/d[CH4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[16][3] - 1)*q_nocor;
-        J[526] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[529] -= dqdci;              /* dwdot[OH]/d[C2H6] */
-        J[530] += dqdci;              /* dwdot[H2O]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[16][4] - 1)*q_nocor;
-        J[576] -= dqdci;              /* dwdot[H]/d[AR] */
-        J[579] -= dqdci;              /* dwdot[OH]/d[AR] */
-        J[580] += dqdci;              /* dwdot[H2O]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[16][0];
-        dqdc[1] = dcdc_fac + k_f*sc[4];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac + k_f*sc[1];
-        dqdc[5] = TB[16][1] - k_r;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[16][2];
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[16][3];
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = TB[16][4];
-        for (int k=0; k<24; k++) {
-            J[25*k+1] -= dqdc[k];
-            J[25*k+4] -= dqdc[k];
-            J[25*k+5] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= q_nocor;
+    Jmix[4] -= q_nocor;
+    Jmix[5] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[16][0] - 1)*q_nocor;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[4] -= dqdci;                /* dwdot[OH]/d[H2] */
+    J[5] += dqdci;                /* dwdot[H2O]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[4];
+    J[26] -= dqdci;               /* dwdot[H]/d[H] */
+    J[29] -= dqdci;               /* dwdot[OH]/d[H] */
+    J[30] += dqdci;               /* dwdot[H2O]/d[H] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*sc[1];
+    J[101] -= dqdci;              /* dwdot[H]/d[OH] */
+    J[104] -= dqdci;              /* dwdot[OH]/d[OH] */
+    J[105] += dqdci;              /* dwdot[H2O]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[16][1] - 1)*q_nocor - k_r;
+    J[126] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[129] -= dqdci;              /* dwdot[OH]/d[H2O] */
+    J[130] += dqdci;              /* dwdot[H2O]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[16][2] - 1)*q_nocor;
+    J[276] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[279] -= dqdci;              /* dwdot[OH]/d[CH4] */
+    J[280] += dqdci;              /* dwdot[H2O]/d[CH4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[16][3] - 1)*q_nocor;
+    J[526] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[529] -= dqdci;              /* dwdot[OH]/d[C2H6] */
+    J[530] += dqdci;              /* dwdot[H2O]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[16][4] - 1)*q_nocor;
+    J[576] -= dqdci;              /* dwdot[H]/d[AR] */
+    J[579] -= dqdci;              /* dwdot[OH]/d[AR] */
+    J[580] += dqdci;              /* dwdot[H2O]/d[AR] */
     J[601] -= dqdT; /* dwdot[H]/dT */
     J[604] -= dqdT; /* dwdot[OH]/dT */
     J[605] += dqdT; /* dwdot[H2O]/dT */
@@ -12094,12 +11967,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[17][0] - 1)*sc[0] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[11] + (TB[17][3] - 1)*sc[12] + (TB[17][4] - 1)*sc[13] + (TB[17][5] - 1)*sc[21];
     /* forward */
     phi_f = sc[14];
-    k_f = prefactor_units[17] * fwd_A[17]
-                * exp(fwd_beta[17] * tc[0] - activation_units[17] * fwd_Ea[17] * invT);
+    k_f = k_f_s[17];
     dlnkfdT = fwd_beta[17] * invT + activation_units[17] * fwd_Ea[17] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[12];
-    Kc = refC * exp(-g_RT[1] - g_RT[12] + g_RT[14]);
+    Kc = Kc_s[17];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[14]) + (h_RT[1] + h_RT[12]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -12114,79 +11986,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[17][0] - 1)*q_nocor;
-        J[1] += dqdci;                /* dwdot[H]/d[H2] */
-        J[12] += dqdci;               /* dwdot[CO]/d[H2] */
-        J[14] -= dqdci;               /* dwdot[HCO]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[12];
-        J[26] += dqdci;               /* dwdot[H]/d[H] */
-        J[37] += dqdci;               /* dwdot[CO]/d[H] */
-        J[39] -= dqdci;               /* dwdot[HCO]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[17][1] - 1)*q_nocor;
-        J[126] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[137] += dqdci;              /* dwdot[CO]/d[H2O] */
-        J[139] -= dqdci;              /* dwdot[HCO]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[17][2] - 1)*q_nocor;
-        J[276] += dqdci;              /* dwdot[H]/d[CH4] */
-        J[287] += dqdci;              /* dwdot[CO]/d[CH4] */
-        J[289] -= dqdci;              /* dwdot[HCO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[17][3] - 1)*q_nocor - k_r*sc[1];
-        J[301] += dqdci;              /* dwdot[H]/d[CO] */
-        J[312] += dqdci;              /* dwdot[CO]/d[CO] */
-        J[314] -= dqdci;              /* dwdot[HCO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[17][4] - 1)*q_nocor;
-        J[326] += dqdci;              /* dwdot[H]/d[CO2] */
-        J[337] += dqdci;              /* dwdot[CO]/d[CO2] */
-        J[339] -= dqdci;              /* dwdot[HCO]/d[CO2] */
-        /* d()/d[HCO] */
-        dqdci =  + k_f;
-        J[351] += dqdci;              /* dwdot[H]/d[HCO] */
-        J[362] += dqdci;              /* dwdot[CO]/d[HCO] */
-        J[364] -= dqdci;              /* dwdot[HCO]/d[HCO] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[17][5] - 1)*q_nocor;
-        J[526] += dqdci;              /* dwdot[H]/d[C2H6] */
-        J[537] += dqdci;              /* dwdot[CO]/d[C2H6] */
-        J[539] -= dqdci;              /* dwdot[HCO]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[17][0];
-        dqdc[1] = dcdc_fac - k_r*sc[12];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[17][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[17][2];
-        dqdc[12] = TB[17][3] - k_r*sc[1];
-        dqdc[13] = TB[17][4];
-        dqdc[14] = dcdc_fac + k_f;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[17][5];
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        for (int k=0; k<24; k++) {
-            J[25*k+1] += dqdc[k];
-            J[25*k+12] += dqdc[k];
-            J[25*k+14] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] += q_nocor;
+    Jmix[12] += q_nocor;
+    Jmix[14] -= q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[17][0] - 1)*q_nocor;
+    J[1] += dqdci;                /* dwdot[H]/d[H2] */
+    J[12] += dqdci;               /* dwdot[CO]/d[H2] */
+    J[14] -= dqdci;               /* dwdot[HCO]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[12];
+    J[26] += dqdci;               /* dwdot[H]/d[H] */
+    J[37] += dqdci;               /* dwdot[CO]/d[H] */
+    J[39] -= dqdci;               /* dwdot[HCO]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[17][1] - 1)*q_nocor;
+    J[126] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[137] += dqdci;              /* dwdot[CO]/d[H2O] */
+    J[139] -= dqdci;              /* dwdot[HCO]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[17][2] - 1)*q_nocor;
+    J[276] += dqdci;              /* dwdot[H]/d[CH4] */
+    J[287] += dqdci;              /* dwdot[CO]/d[CH4] */
+    J[289] -= dqdci;              /* dwdot[HCO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[17][3] - 1)*q_nocor - k_r*sc[1];
+    J[301] += dqdci;              /* dwdot[H]/d[CO] */
+    J[312] += dqdci;              /* dwdot[CO]/d[CO] */
+    J[314] -= dqdci;              /* dwdot[HCO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[17][4] - 1)*q_nocor;
+    J[326] += dqdci;              /* dwdot[H]/d[CO2] */
+    J[337] += dqdci;              /* dwdot[CO]/d[CO2] */
+    J[339] -= dqdci;              /* dwdot[HCO]/d[CO2] */
+    /* d()/d[HCO] */
+    dqdci =  + k_f;
+    J[351] += dqdci;              /* dwdot[H]/d[HCO] */
+    J[362] += dqdci;              /* dwdot[CO]/d[HCO] */
+    J[364] -= dqdci;              /* dwdot[HCO]/d[HCO] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[17][5] - 1)*q_nocor;
+    J[526] += dqdci;              /* dwdot[H]/d[C2H6] */
+    J[537] += dqdci;              /* dwdot[CO]/d[C2H6] */
+    J[539] -= dqdci;              /* dwdot[HCO]/d[C2H6] */
     J[601] += dqdT; /* dwdot[H]/dT */
     J[612] += dqdT; /* dwdot[CO]/dT */
     J[614] -= dqdT; /* dwdot[HCO]/dT */
@@ -12195,12 +12038,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[2];
-    k_f = prefactor_units[18] * fwd_A[18]
-                * exp(fwd_beta[18] * tc[0] - activation_units[18] * fwd_Ea[18] * invT);
+    k_f = k_f_s[18];
     dlnkfdT = fwd_beta[18] * invT + activation_units[18] * fwd_Ea[18] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[4];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[2] - g_RT[4]);
+    Kc = Kc_s[18];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[2]) + (h_RT[1] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -12246,12 +12088,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[6];
-    k_f = prefactor_units[19] * fwd_A[19]
-                * exp(fwd_beta[19] * tc[0] - activation_units[19] * fwd_Ea[19] * invT);
+    k_f = k_f_s[19];
     dlnkfdT = fwd_beta[19] * invT + activation_units[19] * fwd_Ea[19] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[4];
-    Kc = exp(g_RT[2] - g_RT[3] - g_RT[4] + g_RT[6]);
+    Kc = Kc_s[19];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[6]) + (h_RT[3] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -12297,12 +12138,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[8];
-    k_f = prefactor_units[20] * fwd_A[20]
-                * exp(fwd_beta[20] * tc[0] - activation_units[20] * fwd_Ea[20] * invT);
+    k_f = k_f_s[20];
     dlnkfdT = fwd_beta[20] * invT + activation_units[20] * fwd_Ea[20] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[8] - g_RT[14]);
+    Kc = Kc_s[20];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[8]) + (h_RT[1] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -12348,12 +12188,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[9];
-    k_f = prefactor_units[21] * fwd_A[21]
-                * exp(fwd_beta[21] * tc[0] - activation_units[21] * fwd_Ea[21] * invT);
+    k_f = k_f_s[21];
     dlnkfdT = fwd_beta[21] * invT + activation_units[21] * fwd_Ea[21] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[9] - g_RT[14]);
+    Kc = Kc_s[21];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[9]) + (h_RT[1] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -12399,12 +12238,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[10];
-    k_f = prefactor_units[22] * fwd_A[22]
-                * exp(fwd_beta[22] * tc[0] - activation_units[22] * fwd_Ea[22] * invT);
+    k_f = k_f_s[22];
     dlnkfdT = fwd_beta[22] * invT + activation_units[22] * fwd_Ea[22] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[15];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[10] - g_RT[15]);
+    Kc = Kc_s[22];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[10]) + (h_RT[1] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -12450,12 +12288,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[11];
-    k_f = prefactor_units[23] * fwd_A[23]
-                * exp(fwd_beta[23] * tc[0] - activation_units[23] * fwd_Ea[23] * invT);
+    k_f = k_f_s[23];
     dlnkfdT = fwd_beta[23] * invT + activation_units[23] * fwd_Ea[23] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[10];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[10] + g_RT[11]);
+    Kc = Kc_s[23];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[11]) + (h_RT[4] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -12501,12 +12338,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[14];
-    k_f = prefactor_units[24] * fwd_A[24]
-                * exp(fwd_beta[24] * tc[0] - activation_units[24] * fwd_Ea[24] * invT);
+    k_f = k_f_s[24];
     dlnkfdT = fwd_beta[24] * invT + activation_units[24] * fwd_Ea[24] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[12];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[12] + g_RT[14]);
+    Kc = Kc_s[24];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[14]) + (h_RT[4] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -12552,12 +12388,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[14];
-    k_f = prefactor_units[25] * fwd_A[25]
-                * exp(fwd_beta[25] * tc[0] - activation_units[25] * fwd_Ea[25] * invT);
+    k_f = k_f_s[25];
     dlnkfdT = fwd_beta[25] * invT + activation_units[25] * fwd_Ea[25] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[13];
-    Kc = exp(-g_RT[1] + g_RT[2] - g_RT[13] + g_RT[14]);
+    Kc = Kc_s[25];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[14]) + (h_RT[1] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -12603,12 +12438,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[15];
-    k_f = prefactor_units[26] * fwd_A[26]
-                * exp(fwd_beta[26] * tc[0] - activation_units[26] * fwd_Ea[26] * invT);
+    k_f = k_f_s[26];
     dlnkfdT = fwd_beta[26] * invT + activation_units[26] * fwd_Ea[26] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[14];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[14] + g_RT[15]);
+    Kc = Kc_s[26];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[15]) + (h_RT[4] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -12654,12 +12488,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[17];
-    k_f = prefactor_units[27] * fwd_A[27]
-                * exp(fwd_beta[27] * tc[0] - activation_units[27] * fwd_Ea[27] * invT);
+    k_f = k_f_s[27];
     dlnkfdT = fwd_beta[27] * invT + activation_units[27] * fwd_Ea[27] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[12];
-    Kc = exp(g_RT[2] - g_RT[9] - g_RT[12] + g_RT[17]);
+    Kc = Kc_s[27];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[17]) + (h_RT[9] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -12705,12 +12538,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[17];
-    k_f = prefactor_units[28] * fwd_A[28]
-                * exp(fwd_beta[28] * tc[0] - activation_units[28] * fwd_Ea[28] * invT);
+    k_f = k_f_s[28];
     dlnkfdT = fwd_beta[28] * invT + activation_units[28] * fwd_Ea[28] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[12];
-    Kc = exp(g_RT[2] - g_RT[8] - g_RT[12] + g_RT[17]);
+    Kc = Kc_s[28];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[17]) + (h_RT[8] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -12756,12 +12588,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[19];
-    k_f = prefactor_units[29] * fwd_A[29]
-                * exp(fwd_beta[29] * tc[0] - activation_units[29] * fwd_Ea[29] * invT);
+    k_f = k_f_s[29];
     dlnkfdT = fwd_beta[29] * invT + activation_units[29] * fwd_Ea[29] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[14];
-    Kc = exp(g_RT[2] - g_RT[10] - g_RT[14] + g_RT[19]);
+    Kc = Kc_s[29];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[19]) + (h_RT[10] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -12807,12 +12638,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[20];
-    k_f = prefactor_units[30] * fwd_A[30]
-                * exp(fwd_beta[30] * tc[0] - activation_units[30] * fwd_Ea[30] * invT);
+    k_f = k_f_s[30];
     dlnkfdT = fwd_beta[30] * invT + activation_units[30] * fwd_Ea[30] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[15];
-    Kc = exp(g_RT[2] - g_RT[10] - g_RT[15] + g_RT[20]);
+    Kc = Kc_s[30];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[20]) + (h_RT[10] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -12858,12 +12688,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[21];
-    k_f = prefactor_units[31] * fwd_A[31]
-                * exp(fwd_beta[31] * tc[0] - activation_units[31] * fwd_Ea[31] * invT);
+    k_f = k_f_s[31];
     dlnkfdT = fwd_beta[31] * invT + activation_units[31] * fwd_Ea[31] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[20];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[20] + g_RT[21]);
+    Kc = Kc_s[31];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[21]) + (h_RT[4] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -12909,12 +12738,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[12];
-    k_f = prefactor_units[32] * fwd_A[32]
-                * exp(fwd_beta[32] * tc[0] - activation_units[32] * fwd_Ea[32] * invT);
+    k_f = k_f_s[32];
     dlnkfdT = fwd_beta[32] * invT + activation_units[32] * fwd_Ea[32] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[13];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[12] - g_RT[13]);
+    Kc = Kc_s[32];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[12]) + (h_RT[2] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -12960,12 +12788,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[15];
-    k_f = prefactor_units[33] * fwd_A[33]
-                * exp(fwd_beta[33] * tc[0] - activation_units[33] * fwd_Ea[33] * invT);
+    k_f = k_f_s[33];
     dlnkfdT = fwd_beta[33] * invT + activation_units[33] * fwd_Ea[33] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[14];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[14] + g_RT[15]);
+    Kc = Kc_s[33];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[15]) + (h_RT[6] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -13011,12 +12838,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3]*sc[3];
-    k_f = prefactor_units[34] * fwd_A[34]
-                * exp(fwd_beta[34] * tc[0] - activation_units[34] * fwd_Ea[34] * invT);
+    k_f = k_f_s[34];
     dlnkfdT = fwd_beta[34] * invT + activation_units[34] * fwd_Ea[34] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[6];
-    Kc = refCinv * exp(g_RT[1] + 2*g_RT[3] - g_RT[3] - g_RT[6]);
+    Kc = Kc_s[34];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + 2*h_RT[3]) + (h_RT[3] + h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -13051,12 +12877,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3]*sc[5];
-    k_f = prefactor_units[35] * fwd_A[35]
-                * exp(fwd_beta[35] * tc[0] - activation_units[35] * fwd_Ea[35] * invT);
+    k_f = k_f_s[35];
     dlnkfdT = fwd_beta[35] * invT + activation_units[35] * fwd_Ea[35] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = refCinv * exp(g_RT[1] + g_RT[3] + g_RT[5] - g_RT[5] - g_RT[6]);
+    Kc = Kc_s[35];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3] + h_RT[5]) + (h_RT[5] + h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -13096,12 +12921,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3]*sc[22];
-    k_f = prefactor_units[36] * fwd_A[36]
-                * exp(fwd_beta[36] * tc[0] - activation_units[36] * fwd_Ea[36] * invT);
+    k_f = k_f_s[36];
     dlnkfdT = fwd_beta[36] * invT + activation_units[36] * fwd_Ea[36] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[22];
-    Kc = refCinv * exp(g_RT[1] + g_RT[3] - g_RT[6] + g_RT[22] - g_RT[22]);
+    Kc = Kc_s[36];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3] + h_RT[22]) + (h_RT[6] + h_RT[22]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -13141,12 +12965,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3]*sc[23];
-    k_f = prefactor_units[37] * fwd_A[37]
-                * exp(fwd_beta[37] * tc[0] - activation_units[37] * fwd_Ea[37] * invT);
+    k_f = k_f_s[37];
     dlnkfdT = fwd_beta[37] * invT + activation_units[37] * fwd_Ea[37] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[23];
-    Kc = refCinv * exp(g_RT[1] + g_RT[3] - g_RT[6] + g_RT[23] - g_RT[23]);
+    Kc = Kc_s[37];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3] + h_RT[23]) + (h_RT[6] + h_RT[23]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -13186,12 +13009,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3];
-    k_f = prefactor_units[38] * fwd_A[38]
-                * exp(fwd_beta[38] * tc[0] - activation_units[38] * fwd_Ea[38] * invT);
+    k_f = k_f_s[38];
     dlnkfdT = fwd_beta[38] * invT + activation_units[38] * fwd_Ea[38] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[4];
-    Kc = exp(g_RT[1] - g_RT[2] + g_RT[3] - g_RT[4]);
+    Kc = Kc_s[38];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3]) + (h_RT[2] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -13237,12 +13059,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[1]*sc[1];
-    k_f = prefactor_units[39] * fwd_A[39]
-                * exp(fwd_beta[39] * tc[0] - activation_units[39] * fwd_Ea[39] * invT);
+    k_f = k_f_s[39];
     dlnkfdT = fwd_beta[39] * invT + activation_units[39] * fwd_Ea[39] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[0];
-    Kc = refCinv * exp(g_RT[0] - 2*g_RT[0] + 2*g_RT[1]);
+    Kc = Kc_s[39];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + 2*h_RT[1]) + (2*h_RT[0]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -13268,12 +13089,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[1]*sc[5];
-    k_f = prefactor_units[40] * fwd_A[40]
-                * exp(fwd_beta[40] * tc[0] - activation_units[40] * fwd_Ea[40] * invT);
+    k_f = k_f_s[40];
     dlnkfdT = fwd_beta[40] * invT + activation_units[40] * fwd_Ea[40] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[5];
-    Kc = refCinv * exp(-g_RT[0] + 2*g_RT[1] + g_RT[5] - g_RT[5]);
+    Kc = Kc_s[40];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[1] + h_RT[5]) + (h_RT[0] + h_RT[5]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -13303,12 +13123,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[1]*sc[13];
-    k_f = prefactor_units[41] * fwd_A[41]
-                * exp(fwd_beta[41] * tc[0] - activation_units[41] * fwd_Ea[41] * invT);
+    k_f = k_f_s[41];
     dlnkfdT = fwd_beta[41] * invT + activation_units[41] * fwd_Ea[41] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[13];
-    Kc = refCinv * exp(-g_RT[0] + 2*g_RT[1] + g_RT[13] - g_RT[13]);
+    Kc = Kc_s[41];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[1] + h_RT[13]) + (h_RT[0] + h_RT[13]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -13338,12 +13157,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[6];
-    k_f = prefactor_units[42] * fwd_A[42]
-                * exp(fwd_beta[42] * tc[0] - activation_units[42] * fwd_Ea[42] * invT);
+    k_f = k_f_s[42];
     dlnkfdT = fwd_beta[42] * invT + activation_units[42] * fwd_Ea[42] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[3];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[3] + g_RT[6]);
+    Kc = Kc_s[42];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[6]) + (h_RT[0] + h_RT[3]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -13389,12 +13207,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[6];
-    k_f = prefactor_units[43] * fwd_A[43]
-                * exp(fwd_beta[43] * tc[0] - activation_units[43] * fwd_Ea[43] * invT);
+    k_f = k_f_s[43];
     dlnkfdT = fwd_beta[43] * invT + activation_units[43] * fwd_Ea[43] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[4];
-    Kc = exp(g_RT[1] - 2*g_RT[4] + g_RT[6]);
+    Kc = Kc_s[43];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[6]) + (2*h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -13429,12 +13246,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[7];
-    k_f = prefactor_units[44] * fwd_A[44]
-                * exp(fwd_beta[44] * tc[0] - activation_units[44] * fwd_Ea[44] * invT);
+    k_f = k_f_s[44];
     dlnkfdT = fwd_beta[44] * invT + activation_units[44] * fwd_Ea[44] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[6];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[44];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[7]) + (h_RT[0] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -13480,12 +13296,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[11];
-    k_f = prefactor_units[45] * fwd_A[45]
-                * exp(fwd_beta[45] * tc[0] - activation_units[45] * fwd_Ea[45] * invT);
+    k_f = k_f_s[45];
     dlnkfdT = fwd_beta[45] * invT + activation_units[45] * fwd_Ea[45] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[10];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[10] + g_RT[11]);
+    Kc = Kc_s[45];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[11]) + (h_RT[0] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -13531,12 +13346,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[14];
-    k_f = prefactor_units[46] * fwd_A[46]
-                * exp(fwd_beta[46] * tc[0] - activation_units[46] * fwd_Ea[46] * invT);
+    k_f = k_f_s[46];
     dlnkfdT = fwd_beta[46] * invT + activation_units[46] * fwd_Ea[46] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[12];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[12] + g_RT[14]);
+    Kc = Kc_s[46];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[14]) + (h_RT[0] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -13582,12 +13396,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[15];
-    k_f = prefactor_units[47] * fwd_A[47]
-                * exp(fwd_beta[47] * tc[0] - activation_units[47] * fwd_Ea[47] * invT);
+    k_f = k_f_s[47];
     dlnkfdT = fwd_beta[47] * invT + activation_units[47] * fwd_Ea[47] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[14];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[14] + g_RT[15]);
+    Kc = Kc_s[47];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[15]) + (h_RT[0] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -13633,12 +13446,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[16];
-    k_f = prefactor_units[48] * fwd_A[48]
-                * exp(fwd_beta[48] * tc[0] - activation_units[48] * fwd_Ea[48] * invT);
+    k_f = k_f_s[48];
     dlnkfdT = fwd_beta[48] * invT + activation_units[48] * fwd_Ea[48] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[10];
-    Kc = exp(g_RT[1] - g_RT[4] - g_RT[10] + g_RT[16]);
+    Kc = Kc_s[48];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[16]) + (h_RT[4] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -13684,12 +13496,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[18];
-    k_f = prefactor_units[49] * fwd_A[49]
-                * exp(fwd_beta[49] * tc[0] - activation_units[49] * fwd_Ea[49] * invT);
+    k_f = k_f_s[49];
     dlnkfdT = fwd_beta[49] * invT + activation_units[49] * fwd_Ea[49] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[17];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[49];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[18]) + (h_RT[0] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -13735,12 +13546,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[50] * fwd_A[50]
-                * exp(fwd_beta[50] * tc[0] - activation_units[50] * fwd_Ea[50] * invT);
+    k_f = k_f_s[50];
     dlnkfdT = fwd_beta[50] * invT + activation_units[50] * fwd_Ea[50] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[18];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[18] + g_RT[19]);
+    Kc = Kc_s[50];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[0] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -13786,12 +13596,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[21];
-    k_f = prefactor_units[51] * fwd_A[51]
-                * exp(fwd_beta[51] * tc[0] - activation_units[51] * fwd_Ea[51] * invT);
+    k_f = k_f_s[51];
     dlnkfdT = fwd_beta[51] * invT + activation_units[51] * fwd_Ea[51] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[20];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[20] + g_RT[21]);
+    Kc = Kc_s[51];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[21]) + (h_RT[0] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -13837,12 +13646,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[4];
-    k_f = prefactor_units[52] * fwd_A[52]
-                * exp(fwd_beta[52] * tc[0] - activation_units[52] * fwd_Ea[52] * invT);
+    k_f = k_f_s[52];
     dlnkfdT = fwd_beta[52] * invT + activation_units[52] * fwd_Ea[52] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[5];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[4] - g_RT[5]);
+    Kc = Kc_s[52];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[4]) + (h_RT[1] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -13888,12 +13696,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[4];
-    k_f = prefactor_units[53] * fwd_A[53]
-                * exp(fwd_beta[53] * tc[0] - activation_units[53] * fwd_Ea[53] * invT);
+    k_f = k_f_s[53];
     dlnkfdT = fwd_beta[53] * invT + activation_units[53] * fwd_Ea[53] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[5];
-    Kc = exp(-g_RT[2] + 2*g_RT[4] - g_RT[5]);
+    Kc = Kc_s[53];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[4]) + (h_RT[2] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -13928,12 +13735,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[6];
-    k_f = prefactor_units[54] * fwd_A[54]
-                * exp(fwd_beta[54] * tc[0] - activation_units[54] * fwd_Ea[54] * invT);
+    k_f = k_f_s[54];
     dlnkfdT = fwd_beta[54] * invT + activation_units[54] * fwd_Ea[54] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[5];
-    Kc = exp(-g_RT[3] + g_RT[4] - g_RT[5] + g_RT[6]);
+    Kc = Kc_s[54];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[6]) + (h_RT[3] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -13979,12 +13785,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[7];
-    k_f = prefactor_units[55] * fwd_A[55]
-                * exp(fwd_beta[55] * tc[0] - activation_units[55] * fwd_Ea[55] * invT);
+    k_f = k_f_s[55];
     dlnkfdT = fwd_beta[55] * invT + activation_units[55] * fwd_Ea[55] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[55];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[7]) + (h_RT[5] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -14030,12 +13835,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[8];
-    k_f = prefactor_units[56] * fwd_A[56]
-                * exp(fwd_beta[56] * tc[0] - activation_units[56] * fwd_Ea[56] * invT);
+    k_f = k_f_s[56];
     dlnkfdT = fwd_beta[56] * invT + activation_units[56] * fwd_Ea[56] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[15];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[8] - g_RT[15]);
+    Kc = Kc_s[56];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[8]) + (h_RT[1] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -14081,12 +13885,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[9];
-    k_f = prefactor_units[57] * fwd_A[57]
-                * exp(fwd_beta[57] * tc[0] - activation_units[57] * fwd_Ea[57] * invT);
+    k_f = k_f_s[57];
     dlnkfdT = fwd_beta[57] * invT + activation_units[57] * fwd_Ea[57] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[15];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[9] - g_RT[15]);
+    Kc = Kc_s[57];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[9]) + (h_RT[1] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -14132,12 +13935,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[10];
-    k_f = prefactor_units[58] * fwd_A[58]
-                * exp(fwd_beta[58] * tc[0] - activation_units[58] * fwd_Ea[58] * invT);
+    k_f = k_f_s[58];
     dlnkfdT = fwd_beta[58] * invT + activation_units[58] * fwd_Ea[58] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[8];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[8] + g_RT[10]);
+    Kc = Kc_s[58];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[10]) + (h_RT[5] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -14183,12 +13985,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[10];
-    k_f = prefactor_units[59] * fwd_A[59]
-                * exp(fwd_beta[59] * tc[0] - activation_units[59] * fwd_Ea[59] * invT);
+    k_f = k_f_s[59];
     dlnkfdT = fwd_beta[59] * invT + activation_units[59] * fwd_Ea[59] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[9];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[9] + g_RT[10]);
+    Kc = Kc_s[59];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[10]) + (h_RT[5] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -14234,12 +14035,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[11];
-    k_f = prefactor_units[60] * fwd_A[60]
-                * exp(fwd_beta[60] * tc[0] - activation_units[60] * fwd_Ea[60] * invT);
+    k_f = k_f_s[60];
     dlnkfdT = fwd_beta[60] * invT + activation_units[60] * fwd_Ea[60] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[10];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[10] + g_RT[11]);
+    Kc = Kc_s[60];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[11]) + (h_RT[5] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -14285,12 +14085,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[12];
-    k_f = prefactor_units[61] * fwd_A[61]
-                * exp(fwd_beta[61] * tc[0] - activation_units[61] * fwd_Ea[61] * invT);
+    k_f = k_f_s[61];
     dlnkfdT = fwd_beta[61] * invT + activation_units[61] * fwd_Ea[61] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[13];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[12] - g_RT[13]);
+    Kc = Kc_s[61];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[12]) + (h_RT[1] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -14336,12 +14135,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[14];
-    k_f = prefactor_units[62] * fwd_A[62]
-                * exp(fwd_beta[62] * tc[0] - activation_units[62] * fwd_Ea[62] * invT);
+    k_f = k_f_s[62];
     dlnkfdT = fwd_beta[62] * invT + activation_units[62] * fwd_Ea[62] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[12];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[12] + g_RT[14]);
+    Kc = Kc_s[62];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[14]) + (h_RT[5] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -14387,12 +14185,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[15];
-    k_f = prefactor_units[63] * fwd_A[63]
-                * exp(fwd_beta[63] * tc[0] - activation_units[63] * fwd_Ea[63] * invT);
+    k_f = k_f_s[63];
     dlnkfdT = fwd_beta[63] * invT + activation_units[63] * fwd_Ea[63] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[14];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[14] + g_RT[15]);
+    Kc = Kc_s[63];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[15]) + (h_RT[5] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -14438,12 +14235,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[17];
-    k_f = prefactor_units[64] * fwd_A[64]
-                * exp(fwd_beta[64] * tc[0] - activation_units[64] * fwd_Ea[64] * invT);
+    k_f = k_f_s[64];
     dlnkfdT = fwd_beta[64] * invT + activation_units[64] * fwd_Ea[64] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[12];
-    Kc = exp(g_RT[4] - g_RT[10] - g_RT[12] + g_RT[17]);
+    Kc = Kc_s[64];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[17]) + (h_RT[10] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -14489,12 +14285,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[18];
-    k_f = prefactor_units[65] * fwd_A[65]
-                * exp(fwd_beta[65] * tc[0] - activation_units[65] * fwd_Ea[65] * invT);
+    k_f = k_f_s[65];
     dlnkfdT = fwd_beta[65] * invT + activation_units[65] * fwd_Ea[65] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[17];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[65];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[18]) + (h_RT[5] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -14540,12 +14335,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[19];
-    k_f = prefactor_units[66] * fwd_A[66]
-                * exp(fwd_beta[66] * tc[0] - activation_units[66] * fwd_Ea[66] * invT);
+    k_f = k_f_s[66];
     dlnkfdT = fwd_beta[66] * invT + activation_units[66] * fwd_Ea[66] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[18];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[18] + g_RT[19]);
+    Kc = Kc_s[66];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[19]) + (h_RT[5] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -14591,12 +14385,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[21];
-    k_f = prefactor_units[67] * fwd_A[67]
-                * exp(fwd_beta[67] * tc[0] - activation_units[67] * fwd_Ea[67] * invT);
+    k_f = k_f_s[67];
     dlnkfdT = fwd_beta[67] * invT + activation_units[67] * fwd_Ea[67] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[20];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[20] + g_RT[21]);
+    Kc = Kc_s[67];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[21]) + (h_RT[5] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -14642,12 +14435,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[6];
-    k_f = prefactor_units[68] * fwd_A[68]
-                * exp(fwd_beta[68] * tc[0] - activation_units[68] * fwd_Ea[68] * invT);
+    k_f = k_f_s[68];
     dlnkfdT = fwd_beta[68] * invT + activation_units[68] * fwd_Ea[68] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[7];
-    Kc = exp(-g_RT[3] + 2*g_RT[6] - g_RT[7]);
+    Kc = Kc_s[68];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[6]) + (h_RT[3] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -14682,12 +14474,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[6];
-    k_f = prefactor_units[69] * fwd_A[69]
-                * exp(fwd_beta[69] * tc[0] - activation_units[69] * fwd_Ea[69] * invT);
+    k_f = k_f_s[69];
     dlnkfdT = fwd_beta[69] * invT + activation_units[69] * fwd_Ea[69] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[7];
-    Kc = exp(-g_RT[3] + 2*g_RT[6] - g_RT[7]);
+    Kc = Kc_s[69];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[6]) + (h_RT[3] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -14722,12 +14513,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[8];
-    k_f = prefactor_units[70] * fwd_A[70]
-                * exp(fwd_beta[70] * tc[0] - activation_units[70] * fwd_Ea[70] * invT);
+    k_f = k_f_s[70];
     dlnkfdT = fwd_beta[70] * invT + activation_units[70] * fwd_Ea[70] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[15];
-    Kc = exp(-g_RT[4] + g_RT[6] + g_RT[8] - g_RT[15]);
+    Kc = Kc_s[70];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[8]) + (h_RT[4] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -14773,12 +14563,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[10];
-    k_f = prefactor_units[71] * fwd_A[71]
-                * exp(fwd_beta[71] * tc[0] - activation_units[71] * fwd_Ea[71] * invT);
+    k_f = k_f_s[71];
     dlnkfdT = fwd_beta[71] * invT + activation_units[71] * fwd_Ea[71] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[11];
-    Kc = exp(-g_RT[3] + g_RT[6] + g_RT[10] - g_RT[11]);
+    Kc = Kc_s[71];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[10]) + (h_RT[3] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -14824,12 +14613,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[10];
-    k_f = prefactor_units[72] * fwd_A[72]
-                * exp(fwd_beta[72] * tc[0] - activation_units[72] * fwd_Ea[72] * invT);
+    k_f = k_f_s[72];
     dlnkfdT = fwd_beta[72] * invT + activation_units[72] * fwd_Ea[72] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[16];
-    Kc = exp(-g_RT[4] + g_RT[6] + g_RT[10] - g_RT[16]);
+    Kc = Kc_s[72];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[10]) + (h_RT[4] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -14875,12 +14663,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[12];
-    k_f = prefactor_units[73] * fwd_A[73]
-                * exp(fwd_beta[73] * tc[0] - activation_units[73] * fwd_Ea[73] * invT);
+    k_f = k_f_s[73];
     dlnkfdT = fwd_beta[73] * invT + activation_units[73] * fwd_Ea[73] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[13];
-    Kc = exp(-g_RT[4] + g_RT[6] + g_RT[12] - g_RT[13]);
+    Kc = Kc_s[73];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[12]) + (h_RT[4] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -14926,12 +14713,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[15];
-    k_f = prefactor_units[74] * fwd_A[74]
-                * exp(fwd_beta[74] * tc[0] - activation_units[74] * fwd_Ea[74] * invT);
+    k_f = k_f_s[74];
     dlnkfdT = fwd_beta[74] * invT + activation_units[74] * fwd_Ea[74] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[14];
-    Kc = exp(g_RT[6] - g_RT[7] - g_RT[14] + g_RT[15]);
+    Kc = Kc_s[74];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[15]) + (h_RT[7] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -14977,12 +14763,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[8];
-    k_f = prefactor_units[75] * fwd_A[75]
-                * exp(fwd_beta[75] * tc[0] - activation_units[75] * fwd_Ea[75] * invT);
+    k_f = k_f_s[75];
     dlnkfdT = fwd_beta[75] * invT + activation_units[75] * fwd_Ea[75] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[14];
-    Kc = exp(g_RT[3] - g_RT[4] + g_RT[8] - g_RT[14]);
+    Kc = Kc_s[75];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[8]) + (h_RT[4] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15028,12 +14813,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[8];
-    k_f = prefactor_units[76] * fwd_A[76]
-                * exp(fwd_beta[76] * tc[0] - activation_units[76] * fwd_Ea[76] * invT);
+    k_f = k_f_s[76];
     dlnkfdT = fwd_beta[76] * invT + activation_units[76] * fwd_Ea[76] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[10];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[8] - g_RT[10]);
+    Kc = Kc_s[76];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[8]) + (h_RT[1] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15079,12 +14863,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[8];
-    k_f = prefactor_units[77] * fwd_A[77]
-                * exp(fwd_beta[77] * tc[0] - activation_units[77] * fwd_Ea[77] * invT);
+    k_f = k_f_s[77];
     dlnkfdT = fwd_beta[77] * invT + activation_units[77] * fwd_Ea[77] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[17];
-    Kc = exp(-g_RT[0] + 2*g_RT[8] - g_RT[17]);
+    Kc = Kc_s[77];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[8]) + (h_RT[0] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15119,12 +14902,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[10];
-    k_f = prefactor_units[78] * fwd_A[78]
-                * exp(fwd_beta[78] * tc[0] - activation_units[78] * fwd_Ea[78] * invT);
+    k_f = k_f_s[78];
     dlnkfdT = fwd_beta[78] * invT + activation_units[78] * fwd_Ea[78] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[19];
-    Kc = exp(-g_RT[1] + g_RT[8] + g_RT[10] - g_RT[19]);
+    Kc = Kc_s[78];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[10]) + (h_RT[1] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15170,12 +14952,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[11];
-    k_f = prefactor_units[79] * fwd_A[79]
-                * exp(fwd_beta[79] * tc[0] - activation_units[79] * fwd_Ea[79] * invT);
+    k_f = k_f_s[79];
     dlnkfdT = fwd_beta[79] * invT + activation_units[79] * fwd_Ea[79] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[10];
-    Kc = exp(g_RT[8] - 2*g_RT[10] + g_RT[11]);
+    Kc = Kc_s[79];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[11]) + (2*h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15210,12 +14991,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[22];
-    k_f = prefactor_units[80] * fwd_A[80]
-                * exp(fwd_beta[80] * tc[0] - activation_units[80] * fwd_Ea[80] * invT);
+    k_f = k_f_s[80];
     dlnkfdT = fwd_beta[80] * invT + activation_units[80] * fwd_Ea[80] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[22];
-    Kc = exp(-g_RT[8] + g_RT[9] + g_RT[22] - g_RT[22]);
+    Kc = Kc_s[80];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[22]) + (h_RT[8] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15245,12 +15025,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[23];
-    k_f = prefactor_units[81] * fwd_A[81]
-                * exp(fwd_beta[81] * tc[0] - activation_units[81] * fwd_Ea[81] * invT);
+    k_f = k_f_s[81];
     dlnkfdT = fwd_beta[81] * invT + activation_units[81] * fwd_Ea[81] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[23];
-    Kc = exp(-g_RT[8] + g_RT[9] + g_RT[23] - g_RT[23]);
+    Kc = Kc_s[81];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[23]) + (h_RT[8] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15280,12 +15059,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[9];
-    k_f = prefactor_units[82] * fwd_A[82]
-                * exp(fwd_beta[82] * tc[0] - activation_units[82] * fwd_Ea[82] * invT);
+    k_f = k_f_s[82];
     dlnkfdT = fwd_beta[82] * invT + activation_units[82] * fwd_Ea[82] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[4]*sc[12];
-    Kc = refC * exp(-g_RT[1] + g_RT[3] - g_RT[4] + g_RT[9] - g_RT[12]);
+    Kc = Kc_s[82];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[9]) + (h_RT[1] + h_RT[4] + h_RT[12]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15344,12 +15122,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[9];
-    k_f = prefactor_units[83] * fwd_A[83]
-                * exp(fwd_beta[83] * tc[0] - activation_units[83] * fwd_Ea[83] * invT);
+    k_f = k_f_s[83];
     dlnkfdT = fwd_beta[83] * invT + activation_units[83] * fwd_Ea[83] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[12];
-    Kc = exp(g_RT[3] - g_RT[5] + g_RT[9] - g_RT[12]);
+    Kc = Kc_s[83];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[9]) + (h_RT[5] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15395,12 +15172,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[9];
-    k_f = prefactor_units[84] * fwd_A[84]
-                * exp(fwd_beta[84] * tc[0] - activation_units[84] * fwd_Ea[84] * invT);
+    k_f = k_f_s[84];
     dlnkfdT = fwd_beta[84] * invT + activation_units[84] * fwd_Ea[84] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[10];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[9] - g_RT[10]);
+    Kc = Kc_s[84];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[9]) + (h_RT[1] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15446,12 +15222,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[9];
-    k_f = prefactor_units[85] * fwd_A[85]
-                * exp(fwd_beta[85] * tc[0] - activation_units[85] * fwd_Ea[85] * invT);
+    k_f = k_f_s[85];
     dlnkfdT = fwd_beta[85] * invT + activation_units[85] * fwd_Ea[85] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[8];
-    Kc = exp(g_RT[5] - g_RT[5] - g_RT[8] + g_RT[9]);
+    Kc = Kc_s[85];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[9]) + (h_RT[5] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15481,12 +15256,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[10];
-    k_f = prefactor_units[86] * fwd_A[86]
-                * exp(fwd_beta[86] * tc[0] - activation_units[86] * fwd_Ea[86] * invT);
+    k_f = k_f_s[86];
     dlnkfdT = fwd_beta[86] * invT + activation_units[86] * fwd_Ea[86] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[19];
-    Kc = exp(-g_RT[1] + g_RT[9] + g_RT[10] - g_RT[19]);
+    Kc = Kc_s[86];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[10]) + (h_RT[1] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15532,12 +15306,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[11];
-    k_f = prefactor_units[87] * fwd_A[87]
-                * exp(fwd_beta[87] * tc[0] - activation_units[87] * fwd_Ea[87] * invT);
+    k_f = k_f_s[87];
     dlnkfdT = fwd_beta[87] * invT + activation_units[87] * fwd_Ea[87] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[10];
-    Kc = exp(g_RT[9] - 2*g_RT[10] + g_RT[11]);
+    Kc = Kc_s[87];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[11]) + (2*h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15572,12 +15345,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[12];
-    k_f = prefactor_units[88] * fwd_A[88]
-                * exp(fwd_beta[88] * tc[0] - activation_units[88] * fwd_Ea[88] * invT);
+    k_f = k_f_s[88];
     dlnkfdT = fwd_beta[88] * invT + activation_units[88] * fwd_Ea[88] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[12];
-    Kc = exp(-g_RT[8] + g_RT[9] + g_RT[12] - g_RT[12]);
+    Kc = Kc_s[88];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[12]) + (h_RT[8] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15607,12 +15379,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[13];
-    k_f = prefactor_units[89] * fwd_A[89]
-                * exp(fwd_beta[89] * tc[0] - activation_units[89] * fwd_Ea[89] * invT);
+    k_f = k_f_s[89];
     dlnkfdT = fwd_beta[89] * invT + activation_units[89] * fwd_Ea[89] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[13];
-    Kc = exp(-g_RT[8] + g_RT[9] + g_RT[13] - g_RT[13]);
+    Kc = Kc_s[89];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[13]) + (h_RT[8] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15642,12 +15413,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[13];
-    k_f = prefactor_units[90] * fwd_A[90]
-                * exp(fwd_beta[90] * tc[0] - activation_units[90] * fwd_Ea[90] * invT);
+    k_f = k_f_s[90];
     dlnkfdT = fwd_beta[90] * invT + activation_units[90] * fwd_Ea[90] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[15];
-    Kc = exp(g_RT[9] - g_RT[12] + g_RT[13] - g_RT[15]);
+    Kc = Kc_s[90];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[13]) + (h_RT[12] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15693,12 +15463,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[10];
-    k_f = prefactor_units[91] * fwd_A[91]
-                * exp(fwd_beta[91] * tc[0] - activation_units[91] * fwd_Ea[91] * invT);
+    k_f = k_f_s[91];
     dlnkfdT = fwd_beta[91] * invT + activation_units[91] * fwd_Ea[91] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[16];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[10] - g_RT[16]);
+    Kc = Kc_s[91];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[10]) + (h_RT[2] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15744,12 +15513,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[10];
-    k_f = prefactor_units[92] * fwd_A[92]
-                * exp(fwd_beta[92] * tc[0] - activation_units[92] * fwd_Ea[92] * invT);
+    k_f = k_f_s[92];
     dlnkfdT = fwd_beta[92] * invT + activation_units[92] * fwd_Ea[92] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[15];
-    Kc = exp(g_RT[3] - g_RT[4] + g_RT[10] - g_RT[15]);
+    Kc = Kc_s[92];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[10]) + (h_RT[4] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15795,12 +15563,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[10];
-    k_f = prefactor_units[93] * fwd_A[93]
-                * exp(fwd_beta[93] * tc[0] - activation_units[93] * fwd_Ea[93] * invT);
+    k_f = k_f_s[93];
     dlnkfdT = fwd_beta[93] * invT + activation_units[93] * fwd_Ea[93] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[11];
-    Kc = exp(-g_RT[6] + g_RT[7] + g_RT[10] - g_RT[11]);
+    Kc = Kc_s[93];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[10]) + (h_RT[6] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15846,12 +15613,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[10];
-    k_f = prefactor_units[94] * fwd_A[94]
-                * exp(fwd_beta[94] * tc[0] - activation_units[94] * fwd_Ea[94] * invT);
+    k_f = k_f_s[94];
     dlnkfdT = fwd_beta[94] * invT + activation_units[94] * fwd_Ea[94] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[20];
-    Kc = exp(-g_RT[1] + 2*g_RT[10] - g_RT[20]);
+    Kc = Kc_s[94];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[10]) + (h_RT[1] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15886,12 +15652,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[14];
-    k_f = prefactor_units[95] * fwd_A[95]
-                * exp(fwd_beta[95] * tc[0] - activation_units[95] * fwd_Ea[95] * invT);
+    k_f = k_f_s[95];
     dlnkfdT = fwd_beta[95] * invT + activation_units[95] * fwd_Ea[95] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[12];
-    Kc = exp(g_RT[10] - g_RT[11] - g_RT[12] + g_RT[14]);
+    Kc = Kc_s[95];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[14]) + (h_RT[11] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15937,12 +15702,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[15];
-    k_f = prefactor_units[96] * fwd_A[96]
-                * exp(fwd_beta[96] * tc[0] - activation_units[96] * fwd_Ea[96] * invT);
+    k_f = k_f_s[96];
     dlnkfdT = fwd_beta[96] * invT + activation_units[96] * fwd_Ea[96] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[14];
-    Kc = exp(g_RT[10] - g_RT[11] - g_RT[14] + g_RT[15]);
+    Kc = Kc_s[96];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[15]) + (h_RT[11] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15988,12 +15752,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[19];
-    k_f = prefactor_units[97] * fwd_A[97]
-                * exp(fwd_beta[97] * tc[0] - activation_units[97] * fwd_Ea[97] * invT);
+    k_f = k_f_s[97];
     dlnkfdT = fwd_beta[97] * invT + activation_units[97] * fwd_Ea[97] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[18];
-    Kc = exp(g_RT[10] - g_RT[11] - g_RT[18] + g_RT[19]);
+    Kc = Kc_s[97];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[19]) + (h_RT[11] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -16039,12 +15802,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[21];
-    k_f = prefactor_units[98] * fwd_A[98]
-                * exp(fwd_beta[98] * tc[0] - activation_units[98] * fwd_Ea[98] * invT);
+    k_f = k_f_s[98];
     dlnkfdT = fwd_beta[98] * invT + activation_units[98] * fwd_Ea[98] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[20];
-    Kc = exp(g_RT[10] - g_RT[11] - g_RT[20] + g_RT[21]);
+    Kc = Kc_s[98];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[21]) + (h_RT[11] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -16090,12 +15852,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[14];
-    k_f = prefactor_units[99] * fwd_A[99]
-                * exp(fwd_beta[99] * tc[0] - activation_units[99] * fwd_Ea[99] * invT);
+    k_f = k_f_s[99];
     dlnkfdT = fwd_beta[99] * invT + activation_units[99] * fwd_Ea[99] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[5]*sc[12];
-    Kc = refC * exp(-g_RT[1] + g_RT[5] - g_RT[5] - g_RT[12] + g_RT[14]);
+    Kc = Kc_s[99];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[14]) + (h_RT[1] + h_RT[5] + h_RT[12]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -16135,12 +15896,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[14];
-    k_f = prefactor_units[100] * fwd_A[100]
-                * exp(fwd_beta[100] * tc[0] - activation_units[100] * fwd_Ea[100] * invT);
+    k_f = k_f_s[100];
     dlnkfdT = fwd_beta[100] * invT + activation_units[100] * fwd_Ea[100] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[12];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[12] + g_RT[14]);
+    Kc = Kc_s[100];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[14]) + (h_RT[6] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -16186,12 +15946,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[16];
-    k_f = prefactor_units[101] * fwd_A[101]
-                * exp(fwd_beta[101] * tc[0] - activation_units[101] * fwd_Ea[101] * invT);
+    k_f = k_f_s[101];
     dlnkfdT = fwd_beta[101] * invT + activation_units[101] * fwd_Ea[101] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[15];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[15] + g_RT[16]);
+    Kc = Kc_s[101];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[16]) + (h_RT[6] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -16237,12 +15996,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[18];
-    k_f = prefactor_units[102] * fwd_A[102]
-                * exp(fwd_beta[102] * tc[0] - activation_units[102] * fwd_Ea[102] * invT);
+    k_f = k_f_s[102];
     dlnkfdT = fwd_beta[102] * invT + activation_units[102] * fwd_Ea[102] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[15];
-    Kc = exp(g_RT[3] - g_RT[14] - g_RT[15] + g_RT[18]);
+    Kc = Kc_s[102];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[18]) + (h_RT[14] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -16288,12 +16046,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[20];
-    k_f = prefactor_units[103] * fwd_A[103]
-                * exp(fwd_beta[103] * tc[0] - activation_units[103] * fwd_Ea[103] * invT);
+    k_f = k_f_s[103];
     dlnkfdT = fwd_beta[103] * invT + activation_units[103] * fwd_Ea[103] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[19];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[19] + g_RT[20]);
+    Kc = Kc_s[103];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[20]) + (h_RT[6] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -16347,6 +16104,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         dcvpRdT(dcRdT, tc);
         speciesInternalEnergy(e_RT, tc);
         eh_RT = &e_RT[0];
+        for (int k=0; k<24; k++) {
+            for (int m=0; m<24; m++) {
+                J[k*25+m] += Jmix[m];
+            }
+        }
     }
 
     double cmix = 0.0, ehmix = 0.0, dcmixdT=0.0, dehmixdT=0.0;
@@ -19940,6 +19702,55 @@ void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double
     *ierr = 0;
     return;
 }
+/* get temperature given enthalpy in mass units and mass fracs */
+void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int * ierr)
+{
+#ifdef CONVERGENCE
+    const int maxiter = 5000;
+    const double tol  = 1.e-12;
+#else
+    const int maxiter = 200;
+    const double tol  = 1.e-6;
+#endif
+    double hin  = *h;
+    double tmin = 250;/*max lower bound for thermo def */
+    double tmax = 4000;/*min upper bound for thermo def */
+    double h1,hmin,hmax,cp,t1,dt;
+    int i;/* loop counter */
+    CKHBMS(&tmin, y, iwrk, rwrk, &hmin);
+    CKHBMS(&tmax, y, iwrk, rwrk, &hmax);
+    if (hin < hmin) {
+        /*Linear Extrapolation below tmin */
+        CKCPBS(&tmin, y, iwrk, rwrk, &cp);
+        *t = tmin - (hmin-hin)/cp;
+        *ierr = 1;
+        return;
+    }
+    if (hin > hmax) {
+        /*Linear Extrapolation above tmax */
+        CKCPBS(&tmax, y, iwrk, rwrk, &cp);
+        *t = tmax - (hmax-hin)/cp;
+        *ierr = 1;
+        return;
+    }
+    t1 = *t;
+    if (t1 < tmin || t1 > tmax) {
+        t1 = tmin + (tmax-tmin)/(hmax-hmin)*(hin-hmin);
+    }
+    for (i = 0; i < maxiter; ++i) {
+        CKHBMS(&t1,y,iwrk,rwrk,&h1);
+        CKCPBS(&t1,y,iwrk,rwrk,&cp);
+        dt = (hin - h1) / cp;
+        if (dt > 100.) { dt = 100.; }
+        else if (dt < -100.) { dt = -100.; }
+        else if (fabs(dt) < tol) break;
+        else if (t1+dt == t1) break;
+        t1 += dt;
+    }
+    *t = t1;
+    *ierr = 0;
+    return;
+}
 
 /* End of file  */
 #if defined(BL_FORT_USE_UPPERCASE)
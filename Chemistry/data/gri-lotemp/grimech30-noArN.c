@@ -1,5 +1,6 @@
 
 #include <math.h>
+#include <float.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -86,7 +87,14 @@
 #define VCKPY VCKPY
 #define VCKWYR VCKWYR
 #define VCKYTX VCKYTX
+#define VCKCPBS VCKCPBS
+#define VCKCVBS VCKCVBS
+#define VCKHBMS VCKHBMS
+#define VCKUBMS VCKUBMS
+#define VCKRHOY VCKRHOY
+#define VCKMMWY VCKMMWY
 #define GET_T_GIVEN_EY GET_T_GIVEN_EY
+#define GET_T_GIVEN_HY GET_T_GIVEN_HY
 #define GET_REACTION_MAP GET_REACTION_MAP
 #elif defined(BL_FORT_USE_LOWERCASE)
 #define CKINDX ckindx
@@ -170,7 +178,14 @@
 #define VCKPY vckpy
 #define VCKWYR vckwyr
 #define VCKYTX vckytx
+#define VCKCPBS vckcpbs
+#define VCKCVBS vckcvbs
+#define VCKHBMS vckhbms
+#define VCKUBMS vckubms
+#define VCKRHOY vckrhoy
+#define VCKMMWY vckmmwy
 #define GET_T_GIVEN_EY get_t_given_ey
+#define GET_T_GIVEN_HY get_t_given_hy
 #define GET_REACTION_MAP get_reaction_map
 #elif defined(BL_FORT_USE_UNDERSCORE)
 #define CKINDX ckindx_
@@ -254,7 +269,14 @@
 #define VCKPY vckpy_
 #define VCKWYR vckwyr_
 #define VCKYTX vckytx_
+#define VCKCPBS vckcpbs_
+#define VCKCVBS vckcvbs_
+#define VCKHBMS vckhbms_
+#define VCKUBMS vckubms_
+#define VCKRHOY vckrhoy_
+#define VCKMMWY vckmmwy_
 #define GET_T_GIVEN_EY get_t_given_ey_
+#define GET_T_GIVEN_HY get_t_given_hy_
 #define GET_REACTION_MAP get_reaction_map_
 #endif
 
@@ -356,6 +378,7 @@ void DWDOT(double * restrict J, double * restrict sc, double * restrict T, int *
 void aJacobian(double * restrict J, double * restrict sc, double T, int consP);
 void dcvpRdT(double * restrict species, double * restrict tc);
 void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
+void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
 void GET_REACTION_MAP(int * restrict rmap);
 /*vector version */
 void vproductionRate(int npt, double * restrict wdot, double * restrict c, double * restrict T);
@@ -365,6 +388,12 @@ void VCKWYR(int * restrict np, double * restrict rho, double * restrict T,
             double * restrict y, int * restrict iwrk, double * restrict rwrk,
             double * restrict wdot);
 void VCKYTX(int * restrict np, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict x);
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs);
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs);
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms);
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms);
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho);
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm);
 void vcomp_k_f(int npt, double * restrict k_f_s, double * restrict tc, double * restrict invT);
 void vcomp_gibbs(int npt, double * restrict g_RT, double * restrict tc);
 void vcomp_Kc(int npt, double * restrict Kc_s, double * restrict g_RT, double * restrict invT);
@@ -3278,38 +3307,6 @@ void CKINDX(int * iwrk, double * restrict rwrk, int * mm, int * kk, int * ii, in
 }
 
 
-/* strtok_r: re-entrant (threadsafe) version of strtok, helper function for tokenizing strings  */
-char *strtok_r(char *s, const char *delim, char **save_ptr)
-{
-    char *token;
-
-    if (s == NULL)
-        s = *save_ptr;
-
-    /* Scan leading delimiters.  */
-    s += strspn (s, delim);
-    if (*s == '\0')
-    {
-        *save_ptr = s;
-        return NULL;
-    }
-
-    /* Find the end of the token.  */
-    token = s;
-    s = strpbrk (token, delim);
-    if (s == NULL)
-        /* This token finishes the string.  */
-        *save_ptr = __rawmemchr (token, '\0');
-    else
-    {
-        /* Terminate the token and make *SAVE_PTR point past it.  */
-        *s = '\0';
-        *save_ptr = s + 1;
-    }
-    return token;
-}
-
-
 
 /* ckxnum... for parsing strings  */
 void CKXNUM(char * line, int * nexp, int * lout, int * nval, double * restrict rval, int * kerr, int lenline )
@@ -3857,6 +3854,28 @@ void CKRHOY(double * restrict P, double * restrict T, double * restrict y, int *
 }
 
 
+/*Compute rho = P*W(y)/RT */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho)
+{
+    for (int i=0; i<(*np); i++) {
+        rho[i] = 0.0;
+    }
+
+    for (int n=0; n<35; n++) {
+        for (int i=0; i<(*np); i++) {
+            rho[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        rho[i] = P[i] / (8.31451e+07 * T[i] * rho[i]);/*rho = P*W/(R*T) */
+    }
+
+    return;
+}
+
+
 /*Compute rho = P*W(c)/(R*T) */
 void CKRHOC(double * restrict P, double * restrict T, double * restrict c, int * iwrk, double * restrict rwrk, double * restrict rho)
 {
@@ -3944,6 +3963,29 @@ void CKMMWY(double * restrict y, int * iwrk, double * restrict rwrk, double * re
 }
 
 
+/*given y[species]: mass fractions */
+/*returns mean molecular weight (gm/mole) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm)
+{
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 0.0;
+    }
+
+    for (int n=0; n<35; n++) {
+        for (int i=0; i<(*np); i++) {
+            wtm[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 1.0 / wtm[i];
+    }
+
+    return;
+}
+
+
 /*given x[species]: mole fractions */
 /*returns mean molecular weight (gm/mole) */
 void CKMMWX(double * restrict x, int * iwrk, double * restrict rwrk, double * restrict wtm)
@@ -4825,6 +4867,30 @@ void CKCPBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CP (Eq. 34) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs)
+{
+    double tc[5], tmp[35], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cp_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<35; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cpbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean specific heat at CV (Eq. 35) */
 void CKCVBL(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict cvbl)
 {
@@ -4893,6 +4959,30 @@ void CKCVBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CV (Eq. 36) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs)
+{
+    double tc[5], tmp[35], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cv_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<35; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cvbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean enthalpy of the mixture in molar units */
 void CKHBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict hbml)
 {
@@ -4934,6 +5024,30 @@ void CKHBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns mean enthalpy of mixture in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms)
+{
+    double tc[5], tmp[35], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesEnthalpy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<35; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        hbms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mean internal energy in molar units */
 void CKUBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict ubml)
 {
@@ -5004,6 +5118,30 @@ void CKUBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*get mean internal energy in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms)
+{
+    double tc[5], tmp[35], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesInternalEnergy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<35; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        ubms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mixture entropy in molar units */
 void CKSBML(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict sbml)
 {
@@ -12106,12 +12244,239 @@ void productionRate(double * restrict wdot, double * restrict sc, double T)
 
 void comp_k_f(double * restrict tc, double invT, double * restrict k_f)
 {
+    double x[217];
 #ifdef __INTEL_COMPILER
     #pragma simd
 #endif
     for (int i=0; i<217; ++i) {
-        k_f[i] = prefactor_units[i] * fwd_A[i]
-                    * exp(fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT);
+        x[i] = fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT;
+    };
+
+    /*the exp is skipped when the exponent is zero or that of */
+    /*an earlier reaction with the same default beta and Ea */
+    k_f[0] = (x[0] == 0.0 ? 1.0 : exp(x[0]));
+    k_f[1] = exp(x[1]);
+    k_f[2] = exp(x[2]);
+    k_f[3] = exp(x[3]);
+    k_f[4] = exp(x[4]);
+    k_f[5] = exp(x[5]);
+    k_f[6] = exp(x[6]);
+    k_f[7] = exp(x[7]);
+    k_f[8] = exp(x[8]);
+    k_f[9] = exp(x[9]);
+    k_f[10] = exp(x[10]);
+    k_f[11] = exp(x[11]);
+    k_f[12] = exp(x[12]);
+    k_f[13] = exp(x[13]);
+    k_f[14] = exp(x[14]);
+    k_f[15] = (x[15] == 0.0 ? 1.0 : exp(x[15]));
+    k_f[16] = exp(x[16]);
+    k_f[17] = exp(x[17]);
+    k_f[18] = exp(x[18]);
+    k_f[19] = exp(x[19]);
+    k_f[20] = exp(x[20]);
+    k_f[21] = exp(x[21]);
+    k_f[22] = (x[22] == 0.0 ? 1.0 : exp(x[22]));
+    k_f[23] = exp(x[23]);
+    k_f[24] = (x[24] == 0.0 ? 1.0 : exp(x[24]));
+    k_f[25] = exp(x[25]);
+    k_f[26] = (x[26] == x[7] ? k_f[7] : exp(x[26]));
+    k_f[27] = (x[27] == x[7] ? k_f[7] : exp(x[27]));
+    k_f[28] = exp(x[28]);
+    k_f[29] = (x[29] == x[7] ? k_f[7] : exp(x[29]));
+    k_f[30] = exp(x[30]);
+    k_f[31] = exp(x[31]);
+    k_f[32] = exp(x[32]);
+    k_f[33] = (x[33] == 0.0 ? 1.0 : exp(x[33]));
+    k_f[34] = exp(x[34]);
+    k_f[35] = (x[35] == 0.0 ? 1.0 : exp(x[35]));
+    k_f[36] = (x[36] == 0.0 ? 1.0 : exp(x[36]));
+    k_f[37] = (x[37] == 0.0 ? 1.0 : exp(x[37]));
+    k_f[38] = (x[38] == 0.0 ? 1.0 : exp(x[38]));
+    k_f[39] = (x[39] == 0.0 ? 1.0 : exp(x[39]));
+    k_f[40] = exp(x[40]);
+    k_f[41] = (x[41] == 0.0 ? 1.0 : exp(x[41]));
+    k_f[42] = (x[42] == 0.0 ? 1.0 : exp(x[42]));
+    k_f[43] = exp(x[43]);
+    k_f[44] = (x[44] == 0.0 ? 1.0 : exp(x[44]));
+    k_f[45] = (x[45] == 0.0 ? 1.0 : exp(x[45]));
+    k_f[46] = exp(x[46]);
+    k_f[47] = exp(x[47]);
+    k_f[48] = (x[48] == 0.0 ? 1.0 : exp(x[48]));
+    k_f[49] = exp(x[49]);
+    k_f[50] = exp(x[50]);
+    k_f[51] = (x[51] == x[49] ? k_f[49] : exp(x[51]));
+    k_f[52] = (x[52] == 0.0 ? 1.0 : exp(x[52]));
+    k_f[53] = exp(x[53]);
+    k_f[54] = (x[54] == 0.0 ? 1.0 : exp(x[54]));
+    k_f[55] = exp(x[55]);
+    k_f[56] = (x[56] == 0.0 ? 1.0 : exp(x[56]));
+    k_f[57] = exp(x[57]);
+    k_f[58] = exp(x[58]);
+    k_f[59] = exp(x[59]);
+    k_f[60] = exp(x[60]);
+    k_f[61] = exp(x[61]);
+    k_f[62] = exp(x[62]);
+    k_f[63] = (x[63] == x[61] ? k_f[61] : exp(x[63]));
+    k_f[64] = exp(x[64]);
+    k_f[65] = exp(x[65]);
+    k_f[66] = exp(x[66]);
+    k_f[67] = (x[67] == x[30] ? k_f[30] : exp(x[67]));
+    k_f[68] = exp(x[68]);
+    k_f[69] = exp(x[69]);
+    k_f[70] = exp(x[70]);
+    k_f[71] = exp(x[71]);
+    k_f[72] = exp(x[72]);
+    k_f[73] = (x[73] == 0.0 ? 1.0 : exp(x[73]));
+    k_f[74] = (x[74] == 0.0 ? 1.0 : exp(x[74]));
+    k_f[75] = exp(x[75]);
+    k_f[76] = (x[76] == 0.0 ? 1.0 : exp(x[76]));
+    k_f[77] = exp(x[77]);
+    k_f[78] = (x[78] == 0.0 ? 1.0 : exp(x[78]));
+    k_f[79] = exp(x[79]);
+    k_f[80] = exp(x[80]);
+    k_f[81] = exp(x[81]);
+    k_f[82] = (x[82] == 0.0 ? 1.0 : exp(x[82]));
+    k_f[83] = exp(x[83]);
+    k_f[84] = exp(x[84]);
+    k_f[85] = exp(x[85]);
+    k_f[86] = (x[86] == x[85] ? k_f[85] : exp(x[86]));
+    k_f[87] = (x[87] == 0.0 ? 1.0 : exp(x[87]));
+    k_f[88] = exp(x[88]);
+    k_f[89] = (x[89] == 0.0 ? 1.0 : exp(x[89]));
+    k_f[90] = exp(x[90]);
+    k_f[91] = (x[91] == 0.0 ? 1.0 : exp(x[91]));
+    k_f[92] = (x[92] == x[57] ? k_f[57] : exp(x[92]));
+    k_f[93] = exp(x[93]);
+    k_f[94] = (x[94] == 0.0 ? 1.0 : exp(x[94]));
+    k_f[95] = exp(x[95]);
+    k_f[96] = exp(x[96]);
+    k_f[97] = exp(x[97]);
+    k_f[98] = exp(x[98]);
+    k_f[99] = exp(x[99]);
+    k_f[100] = (x[100] == 0.0 ? 1.0 : exp(x[100]));
+    k_f[101] = (x[101] == 0.0 ? 1.0 : exp(x[101]));
+    k_f[102] = (x[102] == 0.0 ? 1.0 : exp(x[102]));
+    k_f[103] = exp(x[103]);
+    k_f[104] = (x[104] == 0.0 ? 1.0 : exp(x[104]));
+    k_f[105] = exp(x[105]);
+    k_f[106] = exp(x[106]);
+    k_f[107] = exp(x[107]);
+    k_f[108] = exp(x[108]);
+    k_f[109] = (x[109] == 0.0 ? 1.0 : exp(x[109]));
+    k_f[110] = exp(x[110]);
+    k_f[111] = (x[111] == 0.0 ? 1.0 : exp(x[111]));
+    k_f[112] = (x[112] == 0.0 ? 1.0 : exp(x[112]));
+    k_f[113] = exp(x[113]);
+    k_f[114] = exp(x[114]);
+    k_f[115] = (x[115] == 0.0 ? 1.0 : exp(x[115]));
+    k_f[116] = exp(x[116]);
+    k_f[117] = exp(x[117]);
+    k_f[118] = exp(x[118]);
+    k_f[119] = exp(x[119]);
+    k_f[120] = (x[120] == 0.0 ? 1.0 : exp(x[120]));
+    k_f[121] = exp(x[121]);
+    k_f[122] = exp(x[122]);
+    k_f[123] = exp(x[123]);
+    k_f[124] = exp(x[124]);
+    k_f[125] = exp(x[125]);
+    k_f[126] = (x[126] == 0.0 ? 1.0 : exp(x[126]));
+    k_f[127] = (x[127] == 0.0 ? 1.0 : exp(x[127]));
+    k_f[128] = (x[128] == 0.0 ? 1.0 : exp(x[128]));
+    k_f[129] = exp(x[129]);
+    k_f[130] = exp(x[130]);
+    k_f[131] = exp(x[131]);
+    k_f[132] = (x[132] == 0.0 ? 1.0 : exp(x[132]));
+    k_f[133] = (x[133] == 0.0 ? 1.0 : exp(x[133]));
+    k_f[134] = (x[134] == 0.0 ? 1.0 : exp(x[134]));
+    k_f[135] = exp(x[135]);
+    k_f[136] = exp(x[136]);
+    k_f[137] = (x[137] == 0.0 ? 1.0 : exp(x[137]));
+    k_f[138] = (x[138] == 0.0 ? 1.0 : exp(x[138]));
+    k_f[139] = (x[139] == 0.0 ? 1.0 : exp(x[139]));
+    k_f[140] = exp(x[140]);
+    k_f[141] = exp(x[141]);
+    k_f[142] = (x[142] == 0.0 ? 1.0 : exp(x[142]));
+    k_f[143] = exp(x[143]);
+    k_f[144] = exp(x[144]);
+    k_f[145] = exp(x[145]);
+    k_f[146] = (x[146] == 0.0 ? 1.0 : exp(x[146]));
+    k_f[147] = exp(x[147]);
+    k_f[148] = (x[148] == 0.0 ? 1.0 : exp(x[148]));
+    k_f[149] = exp(x[149]);
+    k_f[150] = (x[150] == 0.0 ? 1.0 : exp(x[150]));
+    k_f[151] = (x[151] == 0.0 ? 1.0 : exp(x[151]));
+    k_f[152] = (x[152] == 0.0 ? 1.0 : exp(x[152]));
+    k_f[153] = (x[153] == 0.0 ? 1.0 : exp(x[153]));
+    k_f[154] = exp(x[154]);
+    k_f[155] = (x[155] == x[154] ? k_f[154] : exp(x[155]));
+    k_f[156] = (x[156] == 0.0 ? 1.0 : exp(x[156]));
+    k_f[157] = (x[157] == 0.0 ? 1.0 : exp(x[157]));
+    k_f[158] = (x[158] == 0.0 ? 1.0 : exp(x[158]));
+    k_f[159] = exp(x[159]);
+    k_f[160] = exp(x[160]);
+    k_f[161] = exp(x[161]);
+    k_f[162] = exp(x[162]);
+    k_f[163] = exp(x[163]);
+    k_f[164] = (x[164] == 0.0 ? 1.0 : exp(x[164]));
+    k_f[165] = exp(x[165]);
+    k_f[166] = exp(x[166]);
+    k_f[167] = (x[167] == x[166] ? k_f[166] : exp(x[167]));
+    k_f[168] = exp(x[168]);
+    k_f[169] = exp(x[169]);
+    k_f[170] = (x[170] == x[31] ? k_f[31] : exp(x[170]));
+    k_f[171] = exp(x[171]);
+    k_f[172] = exp(x[172]);
+    k_f[173] = exp(x[173]);
+    k_f[174] = (x[174] == x[136] ? k_f[136] : exp(x[174]));
+    k_f[175] = exp(x[175]);
+    k_f[176] = exp(x[176]);
+    k_f[177] = exp(x[177]);
+    k_f[178] = exp(x[178]);
+    k_f[179] = (x[179] == 0.0 ? 1.0 : exp(x[179]));
+    k_f[180] = (x[180] == 0.0 ? 1.0 : exp(x[180]));
+    k_f[181] = (x[181] == x[53] ? k_f[53] : exp(x[181]));
+    k_f[182] = (x[182] == 0.0 ? 1.0 : exp(x[182]));
+    k_f[183] = exp(x[183]);
+    k_f[184] = exp(x[184]);
+    k_f[185] = (x[185] == x[143] ? k_f[143] : exp(x[185]));
+    k_f[186] = (x[186] == x[143] ? k_f[143] : exp(x[186]));
+    k_f[187] = exp(x[187]);
+    k_f[188] = exp(x[188]);
+    k_f[189] = exp(x[189]);
+    k_f[190] = exp(x[190]);
+    k_f[191] = exp(x[191]);
+    k_f[192] = (x[192] == x[191] ? k_f[191] : exp(x[192]));
+    k_f[193] = exp(x[193]);
+    k_f[194] = exp(x[194]);
+    k_f[195] = (x[195] == x[194] ? k_f[194] : exp(x[195]));
+    k_f[196] = exp(x[196]);
+    k_f[197] = exp(x[197]);
+    k_f[198] = exp(x[198]);
+    k_f[199] = (x[199] == 0.0 ? 1.0 : exp(x[199]));
+    k_f[200] = (x[200] == 0.0 ? 1.0 : exp(x[200]));
+    k_f[201] = (x[201] == 0.0 ? 1.0 : exp(x[201]));
+    k_f[202] = (x[202] == 0.0 ? 1.0 : exp(x[202]));
+    k_f[203] = (x[203] == 0.0 ? 1.0 : exp(x[203]));
+    k_f[204] = (x[204] == 0.0 ? 1.0 : exp(x[204]));
+    k_f[205] = (x[205] == 0.0 ? 1.0 : exp(x[205]));
+    k_f[206] = exp(x[206]);
+    k_f[207] = exp(x[207]);
+    k_f[208] = exp(x[208]);
+    k_f[209] = exp(x[209]);
+    k_f[210] = exp(x[210]);
+    k_f[211] = (x[211] == 0.0 ? 1.0 : exp(x[211]));
+    k_f[212] = exp(x[212]);
+    k_f[213] = (x[213] == 0.0 ? 1.0 : exp(x[213]));
+    k_f[214] = exp(x[214]);
+    k_f[215] = (x[215] == 0.0 ? 1.0 : exp(x[215]));
+    k_f[216] = exp(x[216]);
+
+#ifdef __INTEL_COMPILER
+    #pragma simd
+#endif
+    for (int i=0; i<217; ++i) {
+        k_f[i] *= prefactor_units[i] * fwd_A[i];
     };
     return;
 }
@@ -12122,292 +12487,522 @@ void comp_Kc(double * restrict tc, double invT, double * restrict Kc)
     double g_RT[35];
     gibbs(g_RT, tc);
 
-    Kc[0] = g_RT[1] + g_RT[10] - g_RT[12];
-    Kc[1] = g_RT[1] + g_RT[12] - g_RT[13];
-    Kc[2] = g_RT[1] + g_RT[16] - g_RT[17];
-    Kc[3] = g_RT[1] + g_RT[17] - g_RT[18];
-    Kc[4] = g_RT[1] + g_RT[17] - g_RT[19];
-    Kc[5] = g_RT[1] + g_RT[18] - g_RT[20];
-    Kc[6] = g_RT[1] + g_RT[19] - g_RT[20];
-    Kc[7] = g_RT[1] + g_RT[21] - g_RT[22];
-    Kc[8] = g_RT[1] + g_RT[22] - g_RT[23];
-    Kc[9] = g_RT[1] + g_RT[23] - g_RT[24];
-    Kc[10] = g_RT[1] + g_RT[24] - g_RT[25];
-    Kc[11] = g_RT[1] + g_RT[25] - g_RT[26];
-    Kc[12] = g_RT[0] + g_RT[14] - g_RT[17];
-    Kc[13] = 2*g_RT[4] - g_RT[7];
-    Kc[14] = g_RT[4] + g_RT[12] - g_RT[20];
-    Kc[15] = g_RT[9] + g_RT[14] - g_RT[27];
-    Kc[16] = g_RT[10] + g_RT[14] - g_RT[28];
-    Kc[17] = g_RT[5] + g_RT[11] - g_RT[20];
-    Kc[18] = 2*g_RT[12] - g_RT[26];
-    Kc[19] = -g_RT[0] - g_RT[22] + g_RT[24];
-    Kc[20] = g_RT[0] + g_RT[9] - g_RT[12];
-    Kc[21] = g_RT[1] + g_RT[28] - g_RT[33];
-    Kc[22] = g_RT[12] + g_RT[25] - g_RT[32];
-    Kc[23] = g_RT[12] + g_RT[24] - g_RT[31];
-    Kc[24] = g_RT[1] + g_RT[31] - g_RT[32];
-    Kc[25] = g_RT[2] + g_RT[14] - g_RT[15];
-    Kc[26] = 2*g_RT[2] - g_RT[3];
-    Kc[27] = g_RT[1] + g_RT[2] - g_RT[4];
-    Kc[28] = g_RT[1] + g_RT[3] - g_RT[6];
-    Kc[29] = -g_RT[0] + 2*g_RT[1];
-    Kc[30] = g_RT[1] + g_RT[4] - g_RT[5];
-    Kc[31] = -g_RT[1] - g_RT[14] + g_RT[16];
-    Kc[32] = g_RT[0] - g_RT[1] + g_RT[2] - g_RT[4];
-    Kc[33] = g_RT[2] - g_RT[3] - g_RT[4] + g_RT[6];
-    Kc[34] = g_RT[2] - g_RT[4] - g_RT[6] + g_RT[7];
-    Kc[35] = -g_RT[1] + g_RT[2] + g_RT[9] - g_RT[14];
-    Kc[36] = -g_RT[1] + g_RT[2] + g_RT[10] - g_RT[16];
-    Kc[37] = -g_RT[0] + g_RT[2] + g_RT[11] - g_RT[14];
-    Kc[38] = -g_RT[1] + g_RT[2] + g_RT[11] - g_RT[16];
-    Kc[39] = -g_RT[1] + g_RT[2] + g_RT[12] - g_RT[17];
-    Kc[40] = g_RT[2] - g_RT[4] - g_RT[12] + g_RT[13];
-    Kc[41] = g_RT[2] - g_RT[4] - g_RT[14] + g_RT[16];
-    Kc[42] = -g_RT[1] + g_RT[2] - g_RT[15] + g_RT[16];
-    Kc[43] = g_RT[2] - g_RT[4] - g_RT[16] + g_RT[17];
-    Kc[44] = g_RT[2] - g_RT[4] - g_RT[17] + g_RT[18];
-    Kc[45] = g_RT[2] - g_RT[4] - g_RT[17] + g_RT[19];
-    Kc[46] = g_RT[2] - g_RT[4] - g_RT[18] + g_RT[20];
-    Kc[47] = g_RT[2] - g_RT[4] - g_RT[19] + g_RT[20];
-    Kc[48] = g_RT[2] - g_RT[9] - g_RT[14] + g_RT[21];
-    Kc[49] = -g_RT[1] + g_RT[2] + g_RT[22] - g_RT[27];
-    Kc[50] = g_RT[2] - g_RT[4] - g_RT[21] + g_RT[22];
-    Kc[51] = g_RT[2] - g_RT[10] - g_RT[14] + g_RT[22];
-    Kc[52] = -g_RT[1] + g_RT[2] + g_RT[23] - g_RT[28];
-    Kc[53] = g_RT[2] - g_RT[12] - g_RT[16] + g_RT[24];
-    Kc[54] = g_RT[2] - g_RT[12] - g_RT[17] + g_RT[25];
-    Kc[55] = g_RT[2] - g_RT[4] - g_RT[25] + g_RT[26];
-    Kc[56] = -g_RT[1] + g_RT[2] - 2*g_RT[14] + g_RT[27];
-    Kc[57] = g_RT[2] - g_RT[4] - g_RT[27] + g_RT[28];
-    Kc[58] = g_RT[2] - g_RT[10] - g_RT[15] + g_RT[28];
-    Kc[59] = -g_RT[2] + g_RT[3] + g_RT[14] - g_RT[15];
-    Kc[60] = g_RT[3] - g_RT[6] - g_RT[16] + g_RT[17];
-    Kc[61] = g_RT[1] + 2*g_RT[3] - g_RT[3] - g_RT[6];
-    Kc[62] = g_RT[1] + g_RT[3] + g_RT[5] - g_RT[5] - g_RT[6];
-    Kc[63] = g_RT[1] + g_RT[3] - g_RT[6] + g_RT[30] - g_RT[30];
-    Kc[64] = g_RT[1] - g_RT[2] + g_RT[3] - g_RT[4];
-    Kc[65] = g_RT[0] - 2*g_RT[0] + 2*g_RT[1];
-    Kc[66] = -g_RT[0] + 2*g_RT[1] + g_RT[5] - g_RT[5];
-    Kc[67] = -g_RT[0] + 2*g_RT[1] + g_RT[15] - g_RT[15];
-    Kc[68] = g_RT[1] - g_RT[2] - g_RT[5] + g_RT[6];
-    Kc[69] = -g_RT[0] + g_RT[1] - g_RT[3] + g_RT[6];
-    Kc[70] = g_RT[1] - 2*g_RT[4] + g_RT[6];
-    Kc[71] = -g_RT[0] + g_RT[1] - g_RT[6] + g_RT[7];
-    Kc[72] = g_RT[1] - g_RT[4] - g_RT[5] + g_RT[7];
-    Kc[73] = -g_RT[0] + g_RT[1] - g_RT[8] + g_RT[9];
-    Kc[74] = -g_RT[0] + g_RT[1] - g_RT[9] + g_RT[11];
-    Kc[75] = -g_RT[0] + g_RT[1] - g_RT[12] + g_RT[13];
-    Kc[76] = -g_RT[0] + g_RT[1] - g_RT[14] + g_RT[16];
-    Kc[77] = -g_RT[0] + g_RT[1] - g_RT[16] + g_RT[17];
-    Kc[78] = -g_RT[0] + g_RT[1] - g_RT[17] + g_RT[18];
-    Kc[79] = g_RT[1] - g_RT[4] - g_RT[12] + g_RT[18];
-    Kc[80] = g_RT[1] - g_RT[5] - g_RT[11] + g_RT[18];
-    Kc[81] = g_RT[1] - g_RT[1] - g_RT[18] + g_RT[19];
-    Kc[82] = -g_RT[0] + g_RT[1] - g_RT[17] + g_RT[19];
-    Kc[83] = g_RT[1] - g_RT[4] - g_RT[12] + g_RT[19];
-    Kc[84] = g_RT[1] - g_RT[5] - g_RT[11] + g_RT[19];
-    Kc[85] = -g_RT[0] + g_RT[1] - g_RT[18] + g_RT[20];
-    Kc[86] = -g_RT[0] + g_RT[1] - g_RT[19] + g_RT[20];
-    Kc[87] = -g_RT[0] + g_RT[1] - g_RT[22] + g_RT[23];
-    Kc[88] = -g_RT[0] + g_RT[1] - g_RT[23] + g_RT[24];
-    Kc[89] = -g_RT[0] + g_RT[1] - g_RT[24] + g_RT[25];
-    Kc[90] = -g_RT[0] + g_RT[1] - g_RT[25] + g_RT[26];
-    Kc[91] = g_RT[1] - g_RT[11] - g_RT[14] + g_RT[27];
-    Kc[92] = -g_RT[0] + g_RT[1] - g_RT[27] + g_RT[28];
-    Kc[93] = g_RT[1] - g_RT[12] - g_RT[14] + g_RT[28];
-    Kc[94] = g_RT[1] - g_RT[1] - g_RT[28] + g_RT[29];
-    Kc[95] = g_RT[0] - g_RT[1] + g_RT[4] - g_RT[5];
-    Kc[96] = -g_RT[2] + 2*g_RT[4] - g_RT[5];
-    Kc[97] = -g_RT[3] + g_RT[4] - g_RT[5] + g_RT[6];
-    Kc[98] = g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7];
-    Kc[99] = g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7];
-    Kc[100] = -g_RT[1] + g_RT[4] + g_RT[8] - g_RT[14];
-    Kc[101] = -g_RT[1] + g_RT[4] + g_RT[9] - g_RT[16];
-    Kc[102] = -g_RT[1] + g_RT[4] + g_RT[10] - g_RT[17];
-    Kc[103] = g_RT[4] - g_RT[5] - g_RT[9] + g_RT[10];
-    Kc[104] = -g_RT[1] + g_RT[4] + g_RT[11] - g_RT[17];
-    Kc[105] = g_RT[4] - g_RT[5] - g_RT[10] + g_RT[12];
-    Kc[106] = g_RT[4] - g_RT[5] - g_RT[11] + g_RT[12];
-    Kc[107] = g_RT[4] - g_RT[5] - g_RT[12] + g_RT[13];
-    Kc[108] = -g_RT[1] + g_RT[4] + g_RT[14] - g_RT[15];
-    Kc[109] = g_RT[4] - g_RT[5] - g_RT[14] + g_RT[16];
-    Kc[110] = g_RT[4] - g_RT[5] - g_RT[16] + g_RT[17];
-    Kc[111] = g_RT[4] - g_RT[5] - g_RT[17] + g_RT[18];
-    Kc[112] = g_RT[4] - g_RT[5] - g_RT[17] + g_RT[19];
-    Kc[113] = g_RT[4] - g_RT[5] - g_RT[18] + g_RT[20];
-    Kc[114] = g_RT[4] - g_RT[5] - g_RT[19] + g_RT[20];
-    Kc[115] = -g_RT[1] + g_RT[4] + g_RT[21] - g_RT[27];
-    Kc[116] = -g_RT[1] + g_RT[4] + g_RT[22] - g_RT[28];
-    Kc[117] = -g_RT[1] + g_RT[4] + g_RT[22] - g_RT[29];
-    Kc[118] = g_RT[4] - g_RT[5] - g_RT[21] + g_RT[22];
-    Kc[119] = g_RT[4] - g_RT[12] - g_RT[14] + g_RT[22];
-    Kc[120] = g_RT[4] - g_RT[5] - g_RT[22] + g_RT[23];
-    Kc[121] = g_RT[4] - g_RT[5] - g_RT[23] + g_RT[24];
-    Kc[122] = g_RT[4] - g_RT[5] - g_RT[25] + g_RT[26];
-    Kc[123] = g_RT[4] - g_RT[5] - g_RT[27] + g_RT[28];
-    Kc[124] = -g_RT[3] + 2*g_RT[6] - g_RT[7];
-    Kc[125] = -g_RT[3] + 2*g_RT[6] - g_RT[7];
-    Kc[126] = -g_RT[4] + g_RT[6] + g_RT[10] - g_RT[17];
-    Kc[127] = -g_RT[3] + g_RT[6] + g_RT[12] - g_RT[13];
-    Kc[128] = -g_RT[4] + g_RT[6] + g_RT[12] - g_RT[19];
-    Kc[129] = -g_RT[4] + g_RT[6] + g_RT[14] - g_RT[15];
-    Kc[130] = g_RT[6] - g_RT[7] - g_RT[16] + g_RT[17];
-    Kc[131] = -g_RT[2] + g_RT[3] + g_RT[8] - g_RT[14];
-    Kc[132] = -g_RT[1] + g_RT[8] + g_RT[10] - g_RT[21];
-    Kc[133] = -g_RT[1] + g_RT[8] + g_RT[12] - g_RT[22];
-    Kc[134] = -g_RT[2] + g_RT[3] + g_RT[9] - g_RT[16];
-    Kc[135] = g_RT[0] - g_RT[1] + g_RT[9] - g_RT[10];
-    Kc[136] = -g_RT[1] + g_RT[5] + g_RT[9] - g_RT[17];
-    Kc[137] = -g_RT[1] + g_RT[9] + g_RT[10] - g_RT[22];
-    Kc[138] = -g_RT[1] + g_RT[9] + g_RT[12] - g_RT[23];
-    Kc[139] = -g_RT[1] + g_RT[9] + g_RT[13] - g_RT[24];
-    Kc[140] = g_RT[9] - g_RT[14] + g_RT[15] - g_RT[16];
-    Kc[141] = -g_RT[1] + g_RT[9] + g_RT[17] - g_RT[28];
-    Kc[142] = g_RT[9] - g_RT[14] - g_RT[22] + g_RT[27];
-    Kc[143] = -g_RT[1] + g_RT[3] - g_RT[4] + g_RT[10] - g_RT[14];
-    Kc[144] = g_RT[0] - g_RT[1] + g_RT[10] - g_RT[12];
-    Kc[145] = -g_RT[0] + 2*g_RT[10] - g_RT[22];
-    Kc[146] = -g_RT[1] + g_RT[10] + g_RT[12] - g_RT[24];
-    Kc[147] = g_RT[10] - 2*g_RT[12] + g_RT[13];
-    Kc[148] = g_RT[10] - g_RT[14] - g_RT[23] + g_RT[27];
-    Kc[149] = -g_RT[10] + g_RT[11] + g_RT[30] - g_RT[30];
-    Kc[150] = -g_RT[1] + g_RT[3] - g_RT[4] + g_RT[11] - g_RT[14];
-    Kc[151] = g_RT[3] - g_RT[5] + g_RT[11] - g_RT[14];
-    Kc[152] = g_RT[0] - g_RT[1] + g_RT[11] - g_RT[12];
-    Kc[153] = g_RT[5] - g_RT[5] - g_RT[10] + g_RT[11];
-    Kc[154] = -g_RT[1] + g_RT[11] + g_RT[12] - g_RT[24];
-    Kc[155] = g_RT[11] - 2*g_RT[12] + g_RT[13];
-    Kc[156] = -g_RT[10] + g_RT[11] + g_RT[14] - g_RT[14];
-    Kc[157] = -g_RT[10] + g_RT[11] + g_RT[15] - g_RT[15];
-    Kc[158] = g_RT[11] - g_RT[14] + g_RT[15] - g_RT[17];
-    Kc[159] = g_RT[11] - g_RT[12] - g_RT[25] + g_RT[26];
-    Kc[160] = -g_RT[2] + g_RT[3] + g_RT[12] - g_RT[19];
-    Kc[161] = g_RT[3] - g_RT[4] + g_RT[12] - g_RT[17];
-    Kc[162] = -g_RT[6] + g_RT[7] + g_RT[12] - g_RT[13];
-    Kc[163] = -g_RT[1] + 2*g_RT[12] - g_RT[25];
-    Kc[164] = g_RT[12] - g_RT[13] - g_RT[14] + g_RT[16];
-    Kc[165] = g_RT[12] - g_RT[13] - g_RT[16] + g_RT[17];
-    Kc[166] = g_RT[12] - g_RT[13] - g_RT[18] + g_RT[20];
-    Kc[167] = g_RT[12] - g_RT[13] - g_RT[19] + g_RT[20];
-    Kc[168] = g_RT[12] - g_RT[13] - g_RT[23] + g_RT[24];
-    Kc[169] = g_RT[12] - g_RT[13] - g_RT[25] + g_RT[26];
-    Kc[170] = -g_RT[1] + g_RT[5] - g_RT[5] - g_RT[14] + g_RT[16];
-    Kc[171] = g_RT[3] - g_RT[6] - g_RT[14] + g_RT[16];
-    Kc[172] = g_RT[3] - g_RT[6] - g_RT[17] + g_RT[18];
-    Kc[173] = g_RT[3] - g_RT[6] - g_RT[17] + g_RT[19];
-    Kc[174] = g_RT[3] - g_RT[14] - g_RT[16] + g_RT[21];
-    Kc[175] = g_RT[0] - g_RT[1] + g_RT[21] - g_RT[22];
-    Kc[176] = g_RT[3] - g_RT[16] - g_RT[17] + g_RT[23];
-    Kc[177] = g_RT[3] - g_RT[6] - g_RT[24] + g_RT[25];
-    Kc[178] = g_RT[3] - g_RT[4] - 2*g_RT[14] + g_RT[27];
-    Kc[179] = -2*g_RT[14] - g_RT[22] + 2*g_RT[27];
-    Kc[180] = -g_RT[0] - g_RT[1] + g_RT[2] + g_RT[12] - g_RT[14];
-    Kc[181] = -g_RT[1] + g_RT[2] + g_RT[24] - g_RT[33];
-    Kc[182] = -g_RT[1] + g_RT[2] + g_RT[25] - g_RT[34];
-    Kc[183] = -g_RT[3] + g_RT[4] - g_RT[5] + g_RT[6];
-    Kc[184] = -g_RT[0] + g_RT[4] + g_RT[12] - g_RT[17];
-    Kc[185] = -2*g_RT[1] + g_RT[3] + g_RT[10] - g_RT[15];
-    Kc[186] = -g_RT[2] + g_RT[3] + g_RT[10] - g_RT[17];
-    Kc[187] = -2*g_RT[1] + g_RT[10] + g_RT[10] - g_RT[22];
-    Kc[188] = -g_RT[0] + g_RT[5] + g_RT[11] - g_RT[17];
-    Kc[189] = -g_RT[2] + g_RT[3] + g_RT[23] - g_RT[33];
-    Kc[190] = g_RT[3] - g_RT[6] - g_RT[22] + g_RT[23];
-    Kc[191] = g_RT[2] - g_RT[4] - g_RT[33] + g_RT[34];
-    Kc[192] = g_RT[2] - g_RT[4] - g_RT[12] - g_RT[14] + g_RT[34];
-    Kc[193] = g_RT[3] - g_RT[6] - g_RT[12] - g_RT[14] + g_RT[34];
-    Kc[194] = -g_RT[0] + g_RT[1] - g_RT[33] + g_RT[34];
-    Kc[195] = -g_RT[0] + g_RT[1] - g_RT[12] - g_RT[14] + g_RT[34];
-    Kc[196] = g_RT[4] - g_RT[5] - g_RT[12] - g_RT[14] + g_RT[34];
-    Kc[197] = g_RT[6] - g_RT[7] - g_RT[12] - g_RT[14] + g_RT[34];
-    Kc[198] = g_RT[12] - g_RT[12] - g_RT[13] - g_RT[14] + g_RT[34];
-    Kc[199] = -g_RT[1] + g_RT[2] - g_RT[10] - g_RT[15] + g_RT[33];
-    Kc[200] = g_RT[3] - g_RT[4] - g_RT[14] - g_RT[17] + g_RT[33];
-    Kc[201] = g_RT[3] - g_RT[4] - 2*g_RT[16] + g_RT[33];
-    Kc[202] = g_RT[1] - g_RT[12] - g_RT[16] + g_RT[33];
-    Kc[203] = -g_RT[0] + g_RT[1] - g_RT[28] + g_RT[33];
-    Kc[204] = g_RT[4] - g_RT[5] - g_RT[28] + g_RT[33];
-    Kc[205] = g_RT[4] - g_RT[16] - g_RT[18] + g_RT[33];
-    Kc[206] = g_RT[2] - g_RT[4] - g_RT[31] + g_RT[32];
-    Kc[207] = -g_RT[0] + g_RT[1] - g_RT[31] + g_RT[32];
-    Kc[208] = g_RT[4] - g_RT[5] - g_RT[31] + g_RT[32];
-    Kc[209] = -g_RT[6] + g_RT[7] + g_RT[31] - g_RT[32];
-    Kc[210] = g_RT[12] - g_RT[13] - g_RT[31] + g_RT[32];
-    Kc[211] = g_RT[2] - g_RT[17] - g_RT[25] + g_RT[31];
-    Kc[212] = g_RT[1] - g_RT[12] - g_RT[25] + g_RT[31];
-    Kc[213] = g_RT[4] - g_RT[18] - g_RT[25] + g_RT[31];
-    Kc[214] = -g_RT[3] + g_RT[6] + g_RT[31] - g_RT[32];
-    Kc[215] = -g_RT[4] + g_RT[6] - g_RT[17] - g_RT[25] + g_RT[31];
-    Kc[216] = g_RT[12] - 2*g_RT[25] + g_RT[31];
-
-#ifdef __INTEL_COMPILER
-     #pragma simd
-#endif
-    for (int i=0; i<217; ++i) {
-        Kc[i] = exp(Kc[i]);
-    };
-
     /*reference concentration: P_atm / (RT) in inverse mol/m^3 */
     double refC = 101325 / 8.31451 * invT;
     double refCinv = 1 / refC;
 
-    Kc[0] *= refCinv;
-    Kc[1] *= refCinv;
-    Kc[2] *= refCinv;
-    Kc[3] *= refCinv;
-    Kc[4] *= refCinv;
-    Kc[5] *= refCinv;
-    Kc[6] *= refCinv;
-    Kc[7] *= refCinv;
-    Kc[8] *= refCinv;
-    Kc[9] *= refCinv;
-    Kc[10] *= refCinv;
-    Kc[11] *= refCinv;
-    Kc[12] *= refCinv;
-    Kc[13] *= refCinv;
-    Kc[14] *= refCinv;
-    Kc[15] *= refCinv;
-    Kc[16] *= refCinv;
-    Kc[17] *= refCinv;
-    Kc[18] *= refCinv;
-    Kc[19] *= refC;
-    Kc[20] *= refCinv;
-    Kc[21] *= refCinv;
-    Kc[22] *= refCinv;
-    Kc[23] *= refCinv;
-    Kc[24] *= refCinv;
-    Kc[25] *= refCinv;
-    Kc[26] *= refCinv;
-    Kc[27] *= refCinv;
-    Kc[28] *= refCinv;
-    Kc[29] *= refCinv;
-    Kc[30] *= refCinv;
-    Kc[31] *= refC;
-    Kc[56] *= refC;
-    Kc[61] *= refCinv;
-    Kc[62] *= refCinv;
-    Kc[63] *= refCinv;
-    Kc[65] *= refCinv;
-    Kc[66] *= refCinv;
-    Kc[67] *= refCinv;
-    Kc[143] *= refC;
-    Kc[150] *= refC;
-    Kc[170] *= refC;
-    Kc[178] *= refC;
-    Kc[179] *= refC;
-    Kc[180] *= refC;
-    Kc[185] *= refC;
-    Kc[187] *= refC;
-    Kc[192] *= refC;
-    Kc[193] *= refC;
-    Kc[195] *= refC;
-    Kc[196] *= refC;
-    Kc[197] *= refC;
-    Kc[198] *= refC;
-    Kc[199] *= refC;
-    Kc[200] *= refC;
-    Kc[201] *= refC;
-    Kc[215] *= refC;
+    /*Kc as the ratio of the products of the species exp(g_RT)/refC, unless */
+    /*the product over a side of a reaction leaves the normal range */
+    double e_g[35], den[217];
+    for (int k=0; k<35; ++k) {
+        e_g[k] = exp(g_RT[k]) * refCinv;
+    }
+    Kc[0] = e_g[1]*e_g[10]; den[0] = e_g[12];
+    Kc[1] = e_g[1]*e_g[12]; den[1] = e_g[13];
+    Kc[2] = e_g[1]*e_g[16]; den[2] = e_g[17];
+    Kc[3] = e_g[1]*e_g[17]; den[3] = e_g[18];
+    Kc[4] = e_g[1]*e_g[17]; den[4] = e_g[19];
+    Kc[5] = e_g[1]*e_g[18]; den[5] = e_g[20];
+    Kc[6] = e_g[1]*e_g[19]; den[6] = e_g[20];
+    Kc[7] = e_g[1]*e_g[21]; den[7] = e_g[22];
+    Kc[8] = e_g[1]*e_g[22]; den[8] = e_g[23];
+    Kc[9] = e_g[1]*e_g[23]; den[9] = e_g[24];
+    Kc[10] = e_g[1]*e_g[24]; den[10] = e_g[25];
+    Kc[11] = e_g[1]*e_g[25]; den[11] = e_g[26];
+    Kc[12] = e_g[0]*e_g[14]; den[12] = e_g[17];
+    Kc[13] = e_g[4]*e_g[4]; den[13] = e_g[7];
+    Kc[14] = e_g[4]*e_g[12]; den[14] = e_g[20];
+    Kc[15] = e_g[9]*e_g[14]; den[15] = e_g[27];
+    Kc[16] = e_g[10]*e_g[14]; den[16] = e_g[28];
+    Kc[17] = e_g[5]*e_g[11]; den[17] = e_g[20];
+    Kc[18] = e_g[12]*e_g[12]; den[18] = e_g[26];
+    Kc[19] = e_g[24]; den[19] = e_g[0]*e_g[22];
+    Kc[20] = e_g[0]*e_g[9]; den[20] = e_g[12];
+    Kc[21] = e_g[1]*e_g[28]; den[21] = e_g[33];
+    Kc[22] = e_g[12]*e_g[25]; den[22] = e_g[32];
+    Kc[23] = e_g[12]*e_g[24]; den[23] = e_g[31];
+    Kc[24] = e_g[1]*e_g[31]; den[24] = e_g[32];
+    Kc[25] = e_g[2]*e_g[14]; den[25] = e_g[15];
+    Kc[26] = e_g[2]*e_g[2]; den[26] = e_g[3];
+    Kc[27] = e_g[1]*e_g[2]; den[27] = e_g[4];
+    Kc[28] = e_g[1]*e_g[3]; den[28] = e_g[6];
+    Kc[29] = e_g[1]*e_g[1]; den[29] = e_g[0];
+    Kc[30] = e_g[1]*e_g[4]; den[30] = e_g[5];
+    Kc[31] = e_g[16]; den[31] = e_g[1]*e_g[14];
+    Kc[32] = e_g[0]*e_g[2]; den[32] = e_g[1]*e_g[4];
+    Kc[33] = e_g[2]*e_g[6]; den[33] = e_g[3]*e_g[4];
+    Kc[34] = e_g[2]*e_g[7]; den[34] = e_g[4]*e_g[6];
+    Kc[35] = e_g[2]*e_g[9]; den[35] = e_g[1]*e_g[14];
+    Kc[36] = e_g[2]*e_g[10]; den[36] = e_g[1]*e_g[16];
+    Kc[37] = e_g[2]*e_g[11]; den[37] = e_g[0]*e_g[14];
+    Kc[38] = e_g[2]*e_g[11]; den[38] = e_g[1]*e_g[16];
+    Kc[39] = e_g[2]*e_g[12]; den[39] = e_g[1]*e_g[17];
+    Kc[40] = e_g[2]*e_g[13]; den[40] = e_g[4]*e_g[12];
+    Kc[41] = e_g[2]*e_g[16]; den[41] = e_g[4]*e_g[14];
+    Kc[42] = e_g[2]*e_g[16]; den[42] = e_g[1]*e_g[15];
+    Kc[43] = e_g[2]*e_g[17]; den[43] = e_g[4]*e_g[16];
+    Kc[44] = e_g[2]*e_g[18]; den[44] = e_g[4]*e_g[17];
+    Kc[45] = e_g[2]*e_g[19]; den[45] = e_g[4]*e_g[17];
+    Kc[46] = e_g[2]*e_g[20]; den[46] = e_g[4]*e_g[18];
+    Kc[47] = e_g[2]*e_g[20]; den[47] = e_g[4]*e_g[19];
+    Kc[48] = e_g[2]*e_g[21]; den[48] = e_g[9]*e_g[14];
+    Kc[49] = e_g[2]*e_g[22]; den[49] = e_g[1]*e_g[27];
+    Kc[50] = e_g[2]*e_g[22]; den[50] = e_g[4]*e_g[21];
+    Kc[51] = e_g[2]*e_g[22]; den[51] = e_g[10]*e_g[14];
+    Kc[52] = e_g[2]*e_g[23]; den[52] = e_g[1]*e_g[28];
+    Kc[53] = e_g[2]*e_g[24]; den[53] = e_g[12]*e_g[16];
+    Kc[54] = e_g[2]*e_g[25]; den[54] = e_g[12]*e_g[17];
+    Kc[55] = e_g[2]*e_g[26]; den[55] = e_g[4]*e_g[25];
+    Kc[56] = e_g[2]*e_g[27]; den[56] = e_g[1]*e_g[14]*e_g[14];
+    Kc[57] = e_g[2]*e_g[28]; den[57] = e_g[4]*e_g[27];
+    Kc[58] = e_g[2]*e_g[28]; den[58] = e_g[10]*e_g[15];
+    Kc[59] = e_g[3]*e_g[14]; den[59] = e_g[2]*e_g[15];
+    Kc[60] = e_g[3]*e_g[17]; den[60] = e_g[6]*e_g[16];
+    Kc[61] = e_g[1]*e_g[3]*e_g[3]; den[61] = e_g[3]*e_g[6];
+    Kc[62] = e_g[1]*e_g[3]*e_g[5]; den[62] = e_g[5]*e_g[6];
+    Kc[63] = e_g[1]*e_g[3]*e_g[30]; den[63] = e_g[6]*e_g[30];
+    Kc[64] = e_g[1]*e_g[3]; den[64] = e_g[2]*e_g[4];
+    Kc[65] = e_g[0]*e_g[1]*e_g[1]; den[65] = e_g[0]*e_g[0];
+    Kc[66] = e_g[1]*e_g[1]*e_g[5]; den[66] = e_g[0]*e_g[5];
+    Kc[67] = e_g[1]*e_g[1]*e_g[15]; den[67] = e_g[0]*e_g[15];
+    Kc[68] = e_g[1]*e_g[6]; den[68] = e_g[2]*e_g[5];
+    Kc[69] = e_g[1]*e_g[6]; den[69] = e_g[0]*e_g[3];
+    Kc[70] = e_g[1]*e_g[6]; den[70] = e_g[4]*e_g[4];
+    Kc[71] = e_g[1]*e_g[7]; den[71] = e_g[0]*e_g[6];
+    Kc[72] = e_g[1]*e_g[7]; den[72] = e_g[4]*e_g[5];
+    Kc[73] = e_g[1]*e_g[9]; den[73] = e_g[0]*e_g[8];
+    Kc[74] = e_g[1]*e_g[11]; den[74] = e_g[0]*e_g[9];
+    Kc[75] = e_g[1]*e_g[13]; den[75] = e_g[0]*e_g[12];
+    Kc[76] = e_g[1]*e_g[16]; den[76] = e_g[0]*e_g[14];
+    Kc[77] = e_g[1]*e_g[17]; den[77] = e_g[0]*e_g[16];
+    Kc[78] = e_g[1]*e_g[18]; den[78] = e_g[0]*e_g[17];
+    Kc[79] = e_g[1]*e_g[18]; den[79] = e_g[4]*e_g[12];
+    Kc[80] = e_g[1]*e_g[18]; den[80] = e_g[5]*e_g[11];
+    Kc[81] = e_g[1]*e_g[19]; den[81] = e_g[1]*e_g[18];
+    Kc[82] = e_g[1]*e_g[19]; den[82] = e_g[0]*e_g[17];
+    Kc[83] = e_g[1]*e_g[19]; den[83] = e_g[4]*e_g[12];
+    Kc[84] = e_g[1]*e_g[19]; den[84] = e_g[5]*e_g[11];
+    Kc[85] = e_g[1]*e_g[20]; den[85] = e_g[0]*e_g[18];
+    Kc[86] = e_g[1]*e_g[20]; den[86] = e_g[0]*e_g[19];
+    Kc[87] = e_g[1]*e_g[23]; den[87] = e_g[0]*e_g[22];
+    Kc[88] = e_g[1]*e_g[24]; den[88] = e_g[0]*e_g[23];
+    Kc[89] = e_g[1]*e_g[25]; den[89] = e_g[0]*e_g[24];
+    Kc[90] = e_g[1]*e_g[26]; den[90] = e_g[0]*e_g[25];
+    Kc[91] = e_g[1]*e_g[27]; den[91] = e_g[11]*e_g[14];
+    Kc[92] = e_g[1]*e_g[28]; den[92] = e_g[0]*e_g[27];
+    Kc[93] = e_g[1]*e_g[28]; den[93] = e_g[12]*e_g[14];
+    Kc[94] = e_g[1]*e_g[29]; den[94] = e_g[1]*e_g[28];
+    Kc[95] = e_g[0]*e_g[4]; den[95] = e_g[1]*e_g[5];
+    Kc[96] = e_g[4]*e_g[4]; den[96] = e_g[2]*e_g[5];
+    Kc[97] = e_g[4]*e_g[6]; den[97] = e_g[3]*e_g[5];
+    Kc[98] = e_g[4]*e_g[7]; den[98] = e_g[5]*e_g[6];
+    Kc[99] = e_g[4]*e_g[7]; den[99] = e_g[5]*e_g[6];
+    Kc[100] = e_g[4]*e_g[8]; den[100] = e_g[1]*e_g[14];
+    Kc[101] = e_g[4]*e_g[9]; den[101] = e_g[1]*e_g[16];
+    Kc[102] = e_g[4]*e_g[10]; den[102] = e_g[1]*e_g[17];
+    Kc[103] = e_g[4]*e_g[10]; den[103] = e_g[5]*e_g[9];
+    Kc[104] = e_g[4]*e_g[11]; den[104] = e_g[1]*e_g[17];
+    Kc[105] = e_g[4]*e_g[12]; den[105] = e_g[5]*e_g[10];
+    Kc[106] = e_g[4]*e_g[12]; den[106] = e_g[5]*e_g[11];
+    Kc[107] = e_g[4]*e_g[13]; den[107] = e_g[5]*e_g[12];
+    Kc[108] = e_g[4]*e_g[14]; den[108] = e_g[1]*e_g[15];
+    Kc[109] = e_g[4]*e_g[16]; den[109] = e_g[5]*e_g[14];
+    Kc[110] = e_g[4]*e_g[17]; den[110] = e_g[5]*e_g[16];
+    Kc[111] = e_g[4]*e_g[18]; den[111] = e_g[5]*e_g[17];
+    Kc[112] = e_g[4]*e_g[19]; den[112] = e_g[5]*e_g[17];
+    Kc[113] = e_g[4]*e_g[20]; den[113] = e_g[5]*e_g[18];
+    Kc[114] = e_g[4]*e_g[20]; den[114] = e_g[5]*e_g[19];
+    Kc[115] = e_g[4]*e_g[21]; den[115] = e_g[1]*e_g[27];
+    Kc[116] = e_g[4]*e_g[22]; den[116] = e_g[1]*e_g[28];
+    Kc[117] = e_g[4]*e_g[22]; den[117] = e_g[1]*e_g[29];
+    Kc[118] = e_g[4]*e_g[22]; den[118] = e_g[5]*e_g[21];
+    Kc[119] = e_g[4]*e_g[22]; den[119] = e_g[12]*e_g[14];
+    Kc[120] = e_g[4]*e_g[23]; den[120] = e_g[5]*e_g[22];
+    Kc[121] = e_g[4]*e_g[24]; den[121] = e_g[5]*e_g[23];
+    Kc[122] = e_g[4]*e_g[26]; den[122] = e_g[5]*e_g[25];
+    Kc[123] = e_g[4]*e_g[28]; den[123] = e_g[5]*e_g[27];
+    Kc[124] = e_g[6]*e_g[6]; den[124] = e_g[3]*e_g[7];
+    Kc[125] = e_g[6]*e_g[6]; den[125] = e_g[3]*e_g[7];
+    Kc[126] = e_g[6]*e_g[10]; den[126] = e_g[4]*e_g[17];
+    Kc[127] = e_g[6]*e_g[12]; den[127] = e_g[3]*e_g[13];
+    Kc[128] = e_g[6]*e_g[12]; den[128] = e_g[4]*e_g[19];
+    Kc[129] = e_g[6]*e_g[14]; den[129] = e_g[4]*e_g[15];
+    Kc[130] = e_g[6]*e_g[17]; den[130] = e_g[7]*e_g[16];
+    Kc[131] = e_g[3]*e_g[8]; den[131] = e_g[2]*e_g[14];
+    Kc[132] = e_g[8]*e_g[10]; den[132] = e_g[1]*e_g[21];
+    Kc[133] = e_g[8]*e_g[12]; den[133] = e_g[1]*e_g[22];
+    Kc[134] = e_g[3]*e_g[9]; den[134] = e_g[2]*e_g[16];
+    Kc[135] = e_g[0]*e_g[9]; den[135] = e_g[1]*e_g[10];
+    Kc[136] = e_g[5]*e_g[9]; den[136] = e_g[1]*e_g[17];
+    Kc[137] = e_g[9]*e_g[10]; den[137] = e_g[1]*e_g[22];
+    Kc[138] = e_g[9]*e_g[12]; den[138] = e_g[1]*e_g[23];
+    Kc[139] = e_g[9]*e_g[13]; den[139] = e_g[1]*e_g[24];
+    Kc[140] = e_g[9]*e_g[15]; den[140] = e_g[14]*e_g[16];
+    Kc[141] = e_g[9]*e_g[17]; den[141] = e_g[1]*e_g[28];
+    Kc[142] = e_g[9]*e_g[27]; den[142] = e_g[14]*e_g[22];
+    Kc[143] = e_g[3]*e_g[10]; den[143] = e_g[1]*e_g[4]*e_g[14];
+    Kc[144] = e_g[0]*e_g[10]; den[144] = e_g[1]*e_g[12];
+    Kc[145] = e_g[10]*e_g[10]; den[145] = e_g[0]*e_g[22];
+    Kc[146] = e_g[10]*e_g[12]; den[146] = e_g[1]*e_g[24];
+    Kc[147] = e_g[10]*e_g[13]; den[147] = e_g[12]*e_g[12];
+    Kc[148] = e_g[10]*e_g[27]; den[148] = e_g[14]*e_g[23];
+    Kc[149] = e_g[11]*e_g[30]; den[149] = e_g[10]*e_g[30];
+    Kc[150] = e_g[3]*e_g[11]; den[150] = e_g[1]*e_g[4]*e_g[14];
+    Kc[151] = e_g[3]*e_g[11]; den[151] = e_g[5]*e_g[14];
+    Kc[152] = e_g[0]*e_g[11]; den[152] = e_g[1]*e_g[12];
+    Kc[153] = e_g[5]*e_g[11]; den[153] = e_g[5]*e_g[10];
+    Kc[154] = e_g[11]*e_g[12]; den[154] = e_g[1]*e_g[24];
+    Kc[155] = e_g[11]*e_g[13]; den[155] = e_g[12]*e_g[12];
+    Kc[156] = e_g[11]*e_g[14]; den[156] = e_g[10]*e_g[14];
+    Kc[157] = e_g[11]*e_g[15]; den[157] = e_g[10]*e_g[15];
+    Kc[158] = e_g[11]*e_g[15]; den[158] = e_g[14]*e_g[17];
+    Kc[159] = e_g[11]*e_g[26]; den[159] = e_g[12]*e_g[25];
+    Kc[160] = e_g[3]*e_g[12]; den[160] = e_g[2]*e_g[19];
+    Kc[161] = e_g[3]*e_g[12]; den[161] = e_g[4]*e_g[17];
+    Kc[162] = e_g[7]*e_g[12]; den[162] = e_g[6]*e_g[13];
+    Kc[163] = e_g[12]*e_g[12]; den[163] = e_g[1]*e_g[25];
+    Kc[164] = e_g[12]*e_g[16]; den[164] = e_g[13]*e_g[14];
+    Kc[165] = e_g[12]*e_g[17]; den[165] = e_g[13]*e_g[16];
+    Kc[166] = e_g[12]*e_g[20]; den[166] = e_g[13]*e_g[18];
+    Kc[167] = e_g[12]*e_g[20]; den[167] = e_g[13]*e_g[19];
+    Kc[168] = e_g[12]*e_g[24]; den[168] = e_g[13]*e_g[23];
+    Kc[169] = e_g[12]*e_g[26]; den[169] = e_g[13]*e_g[25];
+    Kc[170] = e_g[5]*e_g[16]; den[170] = e_g[1]*e_g[5]*e_g[14];
+    Kc[171] = e_g[3]*e_g[16]; den[171] = e_g[6]*e_g[14];
+    Kc[172] = e_g[3]*e_g[18]; den[172] = e_g[6]*e_g[17];
+    Kc[173] = e_g[3]*e_g[19]; den[173] = e_g[6]*e_g[17];
+    Kc[174] = e_g[3]*e_g[21]; den[174] = e_g[14]*e_g[16];
+    Kc[175] = e_g[0]*e_g[21]; den[175] = e_g[1]*e_g[22];
+    Kc[176] = e_g[3]*e_g[23]; den[176] = e_g[16]*e_g[17];
+    Kc[177] = e_g[3]*e_g[25]; den[177] = e_g[6]*e_g[24];
+    Kc[178] = e_g[3]*e_g[27]; den[178] = e_g[4]*e_g[14]*e_g[14];
+    Kc[179] = e_g[27]*e_g[27]; den[179] = e_g[14]*e_g[14]*e_g[22];
+    Kc[180] = e_g[2]*e_g[12]; den[180] = e_g[0]*e_g[1]*e_g[14];
+    Kc[181] = e_g[2]*e_g[24]; den[181] = e_g[1]*e_g[33];
+    Kc[182] = e_g[2]*e_g[25]; den[182] = e_g[1]*e_g[34];
+    Kc[183] = e_g[4]*e_g[6]; den[183] = e_g[3]*e_g[5];
+    Kc[184] = e_g[4]*e_g[12]; den[184] = e_g[0]*e_g[17];
+    Kc[185] = e_g[3]*e_g[10]; den[185] = e_g[1]*e_g[1]*e_g[15];
+    Kc[186] = e_g[3]*e_g[10]; den[186] = e_g[2]*e_g[17];
+    Kc[187] = e_g[10]*e_g[10]; den[187] = e_g[1]*e_g[1]*e_g[22];
+    Kc[188] = e_g[5]*e_g[11]; den[188] = e_g[0]*e_g[17];
+    Kc[189] = e_g[3]*e_g[23]; den[189] = e_g[2]*e_g[33];
+    Kc[190] = e_g[3]*e_g[23]; den[190] = e_g[6]*e_g[22];
+    Kc[191] = e_g[2]*e_g[34]; den[191] = e_g[4]*e_g[33];
+    Kc[192] = e_g[2]*e_g[34]; den[192] = e_g[4]*e_g[12]*e_g[14];
+    Kc[193] = e_g[3]*e_g[34]; den[193] = e_g[6]*e_g[12]*e_g[14];
+    Kc[194] = e_g[1]*e_g[34]; den[194] = e_g[0]*e_g[33];
+    Kc[195] = e_g[1]*e_g[34]; den[195] = e_g[0]*e_g[12]*e_g[14];
+    Kc[196] = e_g[4]*e_g[34]; den[196] = e_g[5]*e_g[12]*e_g[14];
+    Kc[197] = e_g[6]*e_g[34]; den[197] = e_g[7]*e_g[12]*e_g[14];
+    Kc[198] = e_g[12]*e_g[34]; den[198] = e_g[12]*e_g[13]*e_g[14];
+    Kc[199] = e_g[2]*e_g[33]; den[199] = e_g[1]*e_g[10]*e_g[15];
+    Kc[200] = e_g[3]*e_g[33]; den[200] = e_g[4]*e_g[14]*e_g[17];
+    Kc[201] = e_g[3]*e_g[33]; den[201] = e_g[4]*e_g[16]*e_g[16];
+    Kc[202] = e_g[1]*e_g[33]; den[202] = e_g[12]*e_g[16];
+    Kc[203] = e_g[1]*e_g[33]; den[203] = e_g[0]*e_g[28];
+    Kc[204] = e_g[4]*e_g[33]; den[204] = e_g[5]*e_g[28];
+    Kc[205] = e_g[4]*e_g[33]; den[205] = e_g[16]*e_g[18];
+    Kc[206] = e_g[2]*e_g[32]; den[206] = e_g[4]*e_g[31];
+    Kc[207] = e_g[1]*e_g[32]; den[207] = e_g[0]*e_g[31];
+    Kc[208] = e_g[4]*e_g[32]; den[208] = e_g[5]*e_g[31];
+    Kc[209] = e_g[7]*e_g[31]; den[209] = e_g[6]*e_g[32];
+    Kc[210] = e_g[12]*e_g[32]; den[210] = e_g[13]*e_g[31];
+    Kc[211] = e_g[2]*e_g[31]; den[211] = e_g[17]*e_g[25];
+    Kc[212] = e_g[1]*e_g[31]; den[212] = e_g[12]*e_g[25];
+    Kc[213] = e_g[4]*e_g[31]; den[213] = e_g[18]*e_g[25];
+    Kc[214] = e_g[6]*e_g[31]; den[214] = e_g[3]*e_g[32];
+    Kc[215] = e_g[6]*e_g[31]; den[215] = e_g[4]*e_g[17]*e_g[25];
+    Kc[216] = e_g[12]*e_g[31]; den[216] = e_g[25]*e_g[25];
+    int inrange = 1;
+    for (int i=0; i<217; ++i) {
+        inrange &= Kc[i] >= DBL_MIN && Kc[i] <= DBL_MAX && den[i] >= DBL_MIN && den[i] <= DBL_MAX;
+    }
+
+    if (inrange) {
+        for (int i=0; i<217; ++i) {
+            Kc[i] /= den[i];
+        }
+    }
+    else {
+        Kc[0] = exp(g_RT[1] + g_RT[10] - g_RT[12]);
+        Kc[1] = exp(g_RT[1] + g_RT[12] - g_RT[13]);
+        Kc[2] = exp(g_RT[1] + g_RT[16] - g_RT[17]);
+        Kc[3] = exp(g_RT[1] + g_RT[17] - g_RT[18]);
+        Kc[4] = exp(g_RT[1] + g_RT[17] - g_RT[19]);
+        Kc[5] = exp(g_RT[1] + g_RT[18] - g_RT[20]);
+        Kc[6] = exp(g_RT[1] + g_RT[19] - g_RT[20]);
+        Kc[7] = exp(g_RT[1] + g_RT[21] - g_RT[22]);
+        Kc[8] = exp(g_RT[1] + g_RT[22] - g_RT[23]);
+        Kc[9] = exp(g_RT[1] + g_RT[23] - g_RT[24]);
+        Kc[10] = exp(g_RT[1] + g_RT[24] - g_RT[25]);
+        Kc[11] = exp(g_RT[1] + g_RT[25] - g_RT[26]);
+        Kc[12] = exp(g_RT[0] + g_RT[14] - g_RT[17]);
+        Kc[13] = exp(2*g_RT[4] - g_RT[7]);
+        Kc[14] = exp(g_RT[4] + g_RT[12] - g_RT[20]);
+        Kc[15] = exp(g_RT[9] + g_RT[14] - g_RT[27]);
+        Kc[16] = exp(g_RT[10] + g_RT[14] - g_RT[28]);
+        Kc[17] = exp(g_RT[5] + g_RT[11] - g_RT[20]);
+        Kc[18] = exp(2*g_RT[12] - g_RT[26]);
+        Kc[19] = exp(-g_RT[0] - g_RT[22] + g_RT[24]);
+        Kc[20] = exp(g_RT[0] + g_RT[9] - g_RT[12]);
+        Kc[21] = exp(g_RT[1] + g_RT[28] - g_RT[33]);
+        Kc[22] = exp(g_RT[12] + g_RT[25] - g_RT[32]);
+        Kc[23] = exp(g_RT[12] + g_RT[24] - g_RT[31]);
+        Kc[24] = exp(g_RT[1] + g_RT[31] - g_RT[32]);
+        Kc[25] = exp(g_RT[2] + g_RT[14] - g_RT[15]);
+        Kc[26] = exp(2*g_RT[2] - g_RT[3]);
+        Kc[27] = exp(g_RT[1] + g_RT[2] - g_RT[4]);
+        Kc[28] = exp(g_RT[1] + g_RT[3] - g_RT[6]);
+        Kc[29] = exp(-g_RT[0] + 2*g_RT[1]);
+        Kc[30] = exp(g_RT[1] + g_RT[4] - g_RT[5]);
+        Kc[31] = exp(-g_RT[1] - g_RT[14] + g_RT[16]);
+        Kc[32] = exp(g_RT[0] - g_RT[1] + g_RT[2] - g_RT[4]);
+        Kc[33] = exp(g_RT[2] - g_RT[3] - g_RT[4] + g_RT[6]);
+        Kc[34] = exp(g_RT[2] - g_RT[4] - g_RT[6] + g_RT[7]);
+        Kc[35] = exp(-g_RT[1] + g_RT[2] + g_RT[9] - g_RT[14]);
+        Kc[36] = exp(-g_RT[1] + g_RT[2] + g_RT[10] - g_RT[16]);
+        Kc[37] = exp(-g_RT[0] + g_RT[2] + g_RT[11] - g_RT[14]);
+        Kc[38] = exp(-g_RT[1] + g_RT[2] + g_RT[11] - g_RT[16]);
+        Kc[39] = exp(-g_RT[1] + g_RT[2] + g_RT[12] - g_RT[17]);
+        Kc[40] = exp(g_RT[2] - g_RT[4] - g_RT[12] + g_RT[13]);
+        Kc[41] = exp(g_RT[2] - g_RT[4] - g_RT[14] + g_RT[16]);
+        Kc[42] = exp(-g_RT[1] + g_RT[2] - g_RT[15] + g_RT[16]);
+        Kc[43] = exp(g_RT[2] - g_RT[4] - g_RT[16] + g_RT[17]);
+        Kc[44] = exp(g_RT[2] - g_RT[4] - g_RT[17] + g_RT[18]);
+        Kc[45] = exp(g_RT[2] - g_RT[4] - g_RT[17] + g_RT[19]);
+        Kc[46] = exp(g_RT[2] - g_RT[4] - g_RT[18] + g_RT[20]);
+        Kc[47] = exp(g_RT[2] - g_RT[4] - g_RT[19] + g_RT[20]);
+        Kc[48] = exp(g_RT[2] - g_RT[9] - g_RT[14] + g_RT[21]);
+        Kc[49] = exp(-g_RT[1] + g_RT[2] + g_RT[22] - g_RT[27]);
+        Kc[50] = exp(g_RT[2] - g_RT[4] - g_RT[21] + g_RT[22]);
+        Kc[51] = exp(g_RT[2] - g_RT[10] - g_RT[14] + g_RT[22]);
+        Kc[52] = exp(-g_RT[1] + g_RT[2] + g_RT[23] - g_RT[28]);
+        Kc[53] = exp(g_RT[2] - g_RT[12] - g_RT[16] + g_RT[24]);
+        Kc[54] = exp(g_RT[2] - g_RT[12] - g_RT[17] + g_RT[25]);
+        Kc[55] = exp(g_RT[2] - g_RT[4] - g_RT[25] + g_RT[26]);
+        Kc[56] = exp(-g_RT[1] + g_RT[2] - 2*g_RT[14] + g_RT[27]);
+        Kc[57] = exp(g_RT[2] - g_RT[4] - g_RT[27] + g_RT[28]);
+        Kc[58] = exp(g_RT[2] - g_RT[10] - g_RT[15] + g_RT[28]);
+        Kc[59] = exp(-g_RT[2] + g_RT[3] + g_RT[14] - g_RT[15]);
+        Kc[60] = exp(g_RT[3] - g_RT[6] - g_RT[16] + g_RT[17]);
+        Kc[61] = exp(g_RT[1] + 2*g_RT[3] - g_RT[3] - g_RT[6]);
+        Kc[62] = exp(g_RT[1] + g_RT[3] + g_RT[5] - g_RT[5] - g_RT[6]);
+        Kc[63] = exp(g_RT[1] + g_RT[3] - g_RT[6] + g_RT[30] - g_RT[30]);
+        Kc[64] = exp(g_RT[1] - g_RT[2] + g_RT[3] - g_RT[4]);
+        Kc[65] = exp(g_RT[0] - 2*g_RT[0] + 2*g_RT[1]);
+        Kc[66] = exp(-g_RT[0] + 2*g_RT[1] + g_RT[5] - g_RT[5]);
+        Kc[67] = exp(-g_RT[0] + 2*g_RT[1] + g_RT[15] - g_RT[15]);
+        Kc[68] = exp(g_RT[1] - g_RT[2] - g_RT[5] + g_RT[6]);
+        Kc[69] = exp(-g_RT[0] + g_RT[1] - g_RT[3] + g_RT[6]);
+        Kc[70] = exp(g_RT[1] - 2*g_RT[4] + g_RT[6]);
+        Kc[71] = exp(-g_RT[0] + g_RT[1] - g_RT[6] + g_RT[7]);
+        Kc[72] = exp(g_RT[1] - g_RT[4] - g_RT[5] + g_RT[7]);
+        Kc[73] = exp(-g_RT[0] + g_RT[1] - g_RT[8] + g_RT[9]);
+        Kc[74] = exp(-g_RT[0] + g_RT[1] - g_RT[9] + g_RT[11]);
+        Kc[75] = exp(-g_RT[0] + g_RT[1] - g_RT[12] + g_RT[13]);
+        Kc[76] = exp(-g_RT[0] + g_RT[1] - g_RT[14] + g_RT[16]);
+        Kc[77] = exp(-g_RT[0] + g_RT[1] - g_RT[16] + g_RT[17]);
+        Kc[78] = exp(-g_RT[0] + g_RT[1] - g_RT[17] + g_RT[18]);
+        Kc[79] = exp(g_RT[1] - g_RT[4] - g_RT[12] + g_RT[18]);
+        Kc[80] = exp(g_RT[1] - g_RT[5] - g_RT[11] + g_RT[18]);
+        Kc[81] = exp(g_RT[1] - g_RT[1] - g_RT[18] + g_RT[19]);
+        Kc[82] = exp(-g_RT[0] + g_RT[1] - g_RT[17] + g_RT[19]);
+        Kc[83] = exp(g_RT[1] - g_RT[4] - g_RT[12] + g_RT[19]);
+        Kc[84] = exp(g_RT[1] - g_RT[5] - g_RT[11] + g_RT[19]);
+        Kc[85] = exp(-g_RT[0] + g_RT[1] - g_RT[18] + g_RT[20]);
+        Kc[86] = exp(-g_RT[0] + g_RT[1] - g_RT[19] + g_RT[20]);
+        Kc[87] = exp(-g_RT[0] + g_RT[1] - g_RT[22] + g_RT[23]);
+        Kc[88] = exp(-g_RT[0] + g_RT[1] - g_RT[23] + g_RT[24]);
+        Kc[89] = exp(-g_RT[0] + g_RT[1] - g_RT[24] + g_RT[25]);
+        Kc[90] = exp(-g_RT[0] + g_RT[1] - g_RT[25] + g_RT[26]);
+        Kc[91] = exp(g_RT[1] - g_RT[11] - g_RT[14] + g_RT[27]);
+        Kc[92] = exp(-g_RT[0] + g_RT[1] - g_RT[27] + g_RT[28]);
+        Kc[93] = exp(g_RT[1] - g_RT[12] - g_RT[14] + g_RT[28]);
+        Kc[94] = exp(g_RT[1] - g_RT[1] - g_RT[28] + g_RT[29]);
+        Kc[95] = exp(g_RT[0] - g_RT[1] + g_RT[4] - g_RT[5]);
+        Kc[96] = exp(-g_RT[2] + 2*g_RT[4] - g_RT[5]);
+        Kc[97] = exp(-g_RT[3] + g_RT[4] - g_RT[5] + g_RT[6]);
+        Kc[98] = exp(g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7]);
+        Kc[100] = exp(-g_RT[1] + g_RT[4] + g_RT[8] - g_RT[14]);
+        Kc[101] = exp(-g_RT[1] + g_RT[4] + g_RT[9] - g_RT[16]);
+        Kc[102] = exp(-g_RT[1] + g_RT[4] + g_RT[10] - g_RT[17]);
+        Kc[103] = exp(g_RT[4] - g_RT[5] - g_RT[9] + g_RT[10]);
+        Kc[104] = exp(-g_RT[1] + g_RT[4] + g_RT[11] - g_RT[17]);
+        Kc[105] = exp(g_RT[4] - g_RT[5] - g_RT[10] + g_RT[12]);
+        Kc[106] = exp(g_RT[4] - g_RT[5] - g_RT[11] + g_RT[12]);
+        Kc[107] = exp(g_RT[4] - g_RT[5] - g_RT[12] + g_RT[13]);
+        Kc[108] = exp(-g_RT[1] + g_RT[4] + g_RT[14] - g_RT[15]);
+        Kc[109] = exp(g_RT[4] - g_RT[5] - g_RT[14] + g_RT[16]);
+        Kc[110] = exp(g_RT[4] - g_RT[5] - g_RT[16] + g_RT[17]);
+        Kc[111] = exp(g_RT[4] - g_RT[5] - g_RT[17] + g_RT[18]);
+        Kc[112] = exp(g_RT[4] - g_RT[5] - g_RT[17] + g_RT[19]);
+        Kc[113] = exp(g_RT[4] - g_RT[5] - g_RT[18] + g_RT[20]);
+        Kc[114] = exp(g_RT[4] - g_RT[5] - g_RT[19] + g_RT[20]);
+        Kc[115] = exp(-g_RT[1] + g_RT[4] + g_RT[21] - g_RT[27]);
+        Kc[116] = exp(-g_RT[1] + g_RT[4] + g_RT[22] - g_RT[28]);
+        Kc[117] = exp(-g_RT[1] + g_RT[4] + g_RT[22] - g_RT[29]);
+        Kc[118] = exp(g_RT[4] - g_RT[5] - g_RT[21] + g_RT[22]);
+        Kc[119] = exp(g_RT[4] - g_RT[12] - g_RT[14] + g_RT[22]);
+        Kc[120] = exp(g_RT[4] - g_RT[5] - g_RT[22] + g_RT[23]);
+        Kc[121] = exp(g_RT[4] - g_RT[5] - g_RT[23] + g_RT[24]);
+        Kc[122] = exp(g_RT[4] - g_RT[5] - g_RT[25] + g_RT[26]);
+        Kc[123] = exp(g_RT[4] - g_RT[5] - g_RT[27] + g_RT[28]);
+        Kc[124] = exp(-g_RT[3] + 2*g_RT[6] - g_RT[7]);
+        Kc[126] = exp(-g_RT[4] + g_RT[6] + g_RT[10] - g_RT[17]);
+        Kc[127] = exp(-g_RT[3] + g_RT[6] + g_RT[12] - g_RT[13]);
+        Kc[128] = exp(-g_RT[4] + g_RT[6] + g_RT[12] - g_RT[19]);
+        Kc[129] = exp(-g_RT[4] + g_RT[6] + g_RT[14] - g_RT[15]);
+        Kc[130] = exp(g_RT[6] - g_RT[7] - g_RT[16] + g_RT[17]);
+        Kc[131] = exp(-g_RT[2] + g_RT[3] + g_RT[8] - g_RT[14]);
+        Kc[132] = exp(-g_RT[1] + g_RT[8] + g_RT[10] - g_RT[21]);
+        Kc[133] = exp(-g_RT[1] + g_RT[8] + g_RT[12] - g_RT[22]);
+        Kc[134] = exp(-g_RT[2] + g_RT[3] + g_RT[9] - g_RT[16]);
+        Kc[135] = exp(g_RT[0] - g_RT[1] + g_RT[9] - g_RT[10]);
+        Kc[136] = exp(-g_RT[1] + g_RT[5] + g_RT[9] - g_RT[17]);
+        Kc[137] = exp(-g_RT[1] + g_RT[9] + g_RT[10] - g_RT[22]);
+        Kc[138] = exp(-g_RT[1] + g_RT[9] + g_RT[12] - g_RT[23]);
+        Kc[139] = exp(-g_RT[1] + g_RT[9] + g_RT[13] - g_RT[24]);
+        Kc[140] = exp(g_RT[9] - g_RT[14] + g_RT[15] - g_RT[16]);
+        Kc[141] = exp(-g_RT[1] + g_RT[9] + g_RT[17] - g_RT[28]);
+        Kc[142] = exp(g_RT[9] - g_RT[14] - g_RT[22] + g_RT[27]);
+        Kc[143] = exp(-g_RT[1] + g_RT[3] - g_RT[4] + g_RT[10] - g_RT[14]);
+        Kc[144] = exp(g_RT[0] - g_RT[1] + g_RT[10] - g_RT[12]);
+        Kc[145] = exp(-g_RT[0] + 2*g_RT[10] - g_RT[22]);
+        Kc[146] = exp(-g_RT[1] + g_RT[10] + g_RT[12] - g_RT[24]);
+        Kc[147] = exp(g_RT[10] - 2*g_RT[12] + g_RT[13]);
+        Kc[148] = exp(g_RT[10] - g_RT[14] - g_RT[23] + g_RT[27]);
+        Kc[149] = exp(-g_RT[10] + g_RT[11] + g_RT[30] - g_RT[30]);
+        Kc[150] = exp(-g_RT[1] + g_RT[3] - g_RT[4] + g_RT[11] - g_RT[14]);
+        Kc[151] = exp(g_RT[3] - g_RT[5] + g_RT[11] - g_RT[14]);
+        Kc[152] = exp(g_RT[0] - g_RT[1] + g_RT[11] - g_RT[12]);
+        Kc[153] = exp(g_RT[5] - g_RT[5] - g_RT[10] + g_RT[11]);
+        Kc[154] = exp(-g_RT[1] + g_RT[11] + g_RT[12] - g_RT[24]);
+        Kc[155] = exp(g_RT[11] - 2*g_RT[12] + g_RT[13]);
+        Kc[156] = exp(-g_RT[10] + g_RT[11] + g_RT[14] - g_RT[14]);
+        Kc[157] = exp(-g_RT[10] + g_RT[11] + g_RT[15] - g_RT[15]);
+        Kc[158] = exp(g_RT[11] - g_RT[14] + g_RT[15] - g_RT[17]);
+        Kc[159] = exp(g_RT[11] - g_RT[12] - g_RT[25] + g_RT[26]);
+        Kc[160] = exp(-g_RT[2] + g_RT[3] + g_RT[12] - g_RT[19]);
+        Kc[161] = exp(g_RT[3] - g_RT[4] + g_RT[12] - g_RT[17]);
+        Kc[162] = exp(-g_RT[6] + g_RT[7] + g_RT[12] - g_RT[13]);
+        Kc[163] = exp(-g_RT[1] + 2*g_RT[12] - g_RT[25]);
+        Kc[164] = exp(g_RT[12] - g_RT[13] - g_RT[14] + g_RT[16]);
+        Kc[165] = exp(g_RT[12] - g_RT[13] - g_RT[16] + g_RT[17]);
+        Kc[166] = exp(g_RT[12] - g_RT[13] - g_RT[18] + g_RT[20]);
+        Kc[167] = exp(g_RT[12] - g_RT[13] - g_RT[19] + g_RT[20]);
+        Kc[168] = exp(g_RT[12] - g_RT[13] - g_RT[23] + g_RT[24]);
+        Kc[169] = exp(g_RT[12] - g_RT[13] - g_RT[25] + g_RT[26]);
+        Kc[170] = exp(-g_RT[1] + g_RT[5] - g_RT[5] - g_RT[14] + g_RT[16]);
+        Kc[171] = exp(g_RT[3] - g_RT[6] - g_RT[14] + g_RT[16]);
+        Kc[172] = exp(g_RT[3] - g_RT[6] - g_RT[17] + g_RT[18]);
+        Kc[173] = exp(g_RT[3] - g_RT[6] - g_RT[17] + g_RT[19]);
+        Kc[174] = exp(g_RT[3] - g_RT[14] - g_RT[16] + g_RT[21]);
+        Kc[175] = exp(g_RT[0] - g_RT[1] + g_RT[21] - g_RT[22]);
+        Kc[176] = exp(g_RT[3] - g_RT[16] - g_RT[17] + g_RT[23]);
+        Kc[177] = exp(g_RT[3] - g_RT[6] - g_RT[24] + g_RT[25]);
+        Kc[178] = exp(g_RT[3] - g_RT[4] - 2*g_RT[14] + g_RT[27]);
+        Kc[179] = exp(-2*g_RT[14] - g_RT[22] + 2*g_RT[27]);
+        Kc[180] = exp(-g_RT[0] - g_RT[1] + g_RT[2] + g_RT[12] - g_RT[14]);
+        Kc[181] = exp(-g_RT[1] + g_RT[2] + g_RT[24] - g_RT[33]);
+        Kc[182] = exp(-g_RT[1] + g_RT[2] + g_RT[25] - g_RT[34]);
+        Kc[184] = exp(-g_RT[0] + g_RT[4] + g_RT[12] - g_RT[17]);
+        Kc[185] = exp(-2*g_RT[1] + g_RT[3] + g_RT[10] - g_RT[15]);
+        Kc[186] = exp(-g_RT[2] + g_RT[3] + g_RT[10] - g_RT[17]);
+        Kc[187] = exp(-2*g_RT[1] + g_RT[10] + g_RT[10] - g_RT[22]);
+        Kc[188] = exp(-g_RT[0] + g_RT[5] + g_RT[11] - g_RT[17]);
+        Kc[189] = exp(-g_RT[2] + g_RT[3] + g_RT[23] - g_RT[33]);
+        Kc[190] = exp(g_RT[3] - g_RT[6] - g_RT[22] + g_RT[23]);
+        Kc[191] = exp(g_RT[2] - g_RT[4] - g_RT[33] + g_RT[34]);
+        Kc[192] = exp(g_RT[2] - g_RT[4] - g_RT[12] - g_RT[14] + g_RT[34]);
+        Kc[193] = exp(g_RT[3] - g_RT[6] - g_RT[12] - g_RT[14] + g_RT[34]);
+        Kc[194] = exp(-g_RT[0] + g_RT[1] - g_RT[33] + g_RT[34]);
+        Kc[195] = exp(-g_RT[0] + g_RT[1] - g_RT[12] - g_RT[14] + g_RT[34]);
+        Kc[196] = exp(g_RT[4] - g_RT[5] - g_RT[12] - g_RT[14] + g_RT[34]);
+        Kc[197] = exp(g_RT[6] - g_RT[7] - g_RT[12] - g_RT[14] + g_RT[34]);
+        Kc[198] = exp(g_RT[12] - g_RT[12] - g_RT[13] - g_RT[14] + g_RT[34]);
+        Kc[199] = exp(-g_RT[1] + g_RT[2] - g_RT[10] - g_RT[15] + g_RT[33]);
+        Kc[200] = exp(g_RT[3] - g_RT[4] - g_RT[14] - g_RT[17] + g_RT[33]);
+        Kc[201] = exp(g_RT[3] - g_RT[4] - 2*g_RT[16] + g_RT[33]);
+        Kc[202] = exp(g_RT[1] - g_RT[12] - g_RT[16] + g_RT[33]);
+        Kc[203] = exp(-g_RT[0] + g_RT[1] - g_RT[28] + g_RT[33]);
+        Kc[204] = exp(g_RT[4] - g_RT[5] - g_RT[28] + g_RT[33]);
+        Kc[205] = exp(g_RT[4] - g_RT[16] - g_RT[18] + g_RT[33]);
+        Kc[206] = exp(g_RT[2] - g_RT[4] - g_RT[31] + g_RT[32]);
+        Kc[207] = exp(-g_RT[0] + g_RT[1] - g_RT[31] + g_RT[32]);
+        Kc[208] = exp(g_RT[4] - g_RT[5] - g_RT[31] + g_RT[32]);
+        Kc[209] = exp(-g_RT[6] + g_RT[7] + g_RT[31] - g_RT[32]);
+        Kc[210] = exp(g_RT[12] - g_RT[13] - g_RT[31] + g_RT[32]);
+        Kc[211] = exp(g_RT[2] - g_RT[17] - g_RT[25] + g_RT[31]);
+        Kc[212] = exp(g_RT[1] - g_RT[12] - g_RT[25] + g_RT[31]);
+        Kc[213] = exp(g_RT[4] - g_RT[18] - g_RT[25] + g_RT[31]);
+        Kc[214] = exp(-g_RT[3] + g_RT[6] + g_RT[31] - g_RT[32]);
+        Kc[215] = exp(-g_RT[4] + g_RT[6] - g_RT[17] - g_RT[25] + g_RT[31]);
+        Kc[216] = exp(g_RT[12] - 2*g_RT[25] + g_RT[31]);
+
+        /*reactions with the net stoichiometry of an earlier one */
+        Kc[99] = Kc[98];
+        Kc[125] = Kc[124];
+        Kc[183] = Kc[97];
+
+        Kc[0] *= refCinv;
+        Kc[1] *= refCinv;
+        Kc[2] *= refCinv;
+        Kc[3] *= refCinv;
+        Kc[4] *= refCinv;
+        Kc[5] *= refCinv;
+        Kc[6] *= refCinv;
+        Kc[7] *= refCinv;
+        Kc[8] *= refCinv;
+        Kc[9] *= refCinv;
+        Kc[10] *= refCinv;
+        Kc[11] *= refCinv;
+        Kc[12] *= refCinv;
+        Kc[13] *= refCinv;
+        Kc[14] *= refCinv;
+        Kc[15] *= refCinv;
+        Kc[16] *= refCinv;
+        Kc[17] *= refCinv;
+        Kc[18] *= refCinv;
+        Kc[19] *= refC;
+        Kc[20] *= refCinv;
+        Kc[21] *= refCinv;
+        Kc[22] *= refCinv;
+        Kc[23] *= refCinv;
+        Kc[24] *= refCinv;
+        Kc[25] *= refCinv;
+        Kc[26] *= refCinv;
+        Kc[27] *= refCinv;
+        Kc[28] *= refCinv;
+        Kc[29] *= refCinv;
+        Kc[30] *= refCinv;
+        Kc[31] *= refC;
+        Kc[56] *= refC;
+        Kc[61] *= refCinv;
+        Kc[62] *= refCinv;
+        Kc[63] *= refCinv;
+        Kc[65] *= refCinv;
+        Kc[66] *= refCinv;
+        Kc[67] *= refCinv;
+        Kc[143] *= refC;
+        Kc[150] *= refC;
+        Kc[170] *= refC;
+        Kc[178] *= refC;
+        Kc[179] *= refC;
+        Kc[180] *= refC;
+        Kc[185] *= refC;
+        Kc[187] *= refC;
+        Kc[192] *= refC;
+        Kc[193] *= refC;
+        Kc[195] *= refC;
+        Kc[196] *= refC;
+        Kc[197] *= refC;
+        Kc[198] *= refC;
+        Kc[199] *= refC;
+        Kc[200] *= refC;
+        Kc[201] *= refC;
+        Kc[215] *= refC;
+    }
 
     return;
 }
@@ -13291,6 +13886,9 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         mixture += sc[i];
     }
 
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[0][0] - 1)*sc[0] + (TB[0][1] - 1)*sc[5] + (TB[0][2] - 1)*sc[13] + (TB[0][3] - 1)*sc[14] + (TB[0][4] - 1)*sc[15] + (TB[0][5] - 1)*sc[26];
+
     double Corr[217];
     for (int i = 0; i < 217; ++i) {
         Corr[i] = 1.0;
@@ -13299,31 +13897,31 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
     /* troe */
     {
         double alpha[25];
-        alpha[0] = mixture + (TB[0][0] - 1)*sc[0] + (TB[0][1] - 1)*sc[5] + (TB[0][2] - 1)*sc[13] + (TB[0][3] - 1)*sc[14] + (TB[0][4] - 1)*sc[15] + (TB[0][5] - 1)*sc[26];
+        alpha[0] = alpha_eff0;
         alpha[1] = mixture + (TB[1][0] - 1)*sc[0] + (TB[1][1] - 1)*sc[5] + (TB[1][2] - 1)*sc[13] + (TB[1][3] - 1)*sc[14] + (TB[1][4] - 1)*sc[15] + (TB[1][5] - 1)*sc[26];
-        alpha[2] = mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[13] + (TB[2][3] - 1)*sc[14] + (TB[2][4] - 1)*sc[15] + (TB[2][5] - 1)*sc[26];
-        alpha[3] = mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[13] + (TB[3][3] - 1)*sc[14] + (TB[3][4] - 1)*sc[15] + (TB[3][5] - 1)*sc[26];
-        alpha[4] = mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[13] + (TB[4][3] - 1)*sc[14] + (TB[4][4] - 1)*sc[15] + (TB[4][5] - 1)*sc[26];
-        alpha[5] = mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[13] + (TB[5][3] - 1)*sc[14] + (TB[5][4] - 1)*sc[15] + (TB[5][5] - 1)*sc[26];
-        alpha[6] = mixture + (TB[6][0] - 1)*sc[0] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[13] + (TB[6][3] - 1)*sc[14] + (TB[6][4] - 1)*sc[15] + (TB[6][5] - 1)*sc[26];
-        alpha[7] = mixture + (TB[7][0] - 1)*sc[0] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[13] + (TB[7][3] - 1)*sc[14] + (TB[7][4] - 1)*sc[15] + (TB[7][5] - 1)*sc[26];
-        alpha[8] = mixture + (TB[8][0] - 1)*sc[0] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[13] + (TB[8][3] - 1)*sc[14] + (TB[8][4] - 1)*sc[15] + (TB[8][5] - 1)*sc[26];
-        alpha[9] = mixture + (TB[9][0] - 1)*sc[0] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[13] + (TB[9][3] - 1)*sc[14] + (TB[9][4] - 1)*sc[15] + (TB[9][5] - 1)*sc[26];
-        alpha[10] = mixture + (TB[10][0] - 1)*sc[0] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[13] + (TB[10][3] - 1)*sc[14] + (TB[10][4] - 1)*sc[15] + (TB[10][5] - 1)*sc[26];
-        alpha[11] = mixture + (TB[11][0] - 1)*sc[0] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[13] + (TB[11][3] - 1)*sc[14] + (TB[11][4] - 1)*sc[15] + (TB[11][5] - 1)*sc[26];
-        alpha[12] = mixture + (TB[12][0] - 1)*sc[0] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[13] + (TB[12][3] - 1)*sc[14] + (TB[12][4] - 1)*sc[15] + (TB[12][5] - 1)*sc[26];
-        alpha[13] = mixture + (TB[13][0] - 1)*sc[0] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[13] + (TB[13][3] - 1)*sc[14] + (TB[13][4] - 1)*sc[15] + (TB[13][5] - 1)*sc[26];
-        alpha[14] = mixture + (TB[14][0] - 1)*sc[0] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[13] + (TB[14][3] - 1)*sc[14] + (TB[14][4] - 1)*sc[15] + (TB[14][5] - 1)*sc[26];
-        alpha[15] = mixture + (TB[15][0] - 1)*sc[0] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[13] + (TB[15][3] - 1)*sc[14] + (TB[15][4] - 1)*sc[15] + (TB[15][5] - 1)*sc[26];
-        alpha[16] = mixture + (TB[16][0] - 1)*sc[0] + (TB[16][1] - 1)*sc[5] + (TB[16][2] - 1)*sc[13] + (TB[16][3] - 1)*sc[14] + (TB[16][4] - 1)*sc[15] + (TB[16][5] - 1)*sc[26];
-        alpha[17] = mixture + (TB[17][0] - 1)*sc[0] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[13] + (TB[17][3] - 1)*sc[14] + (TB[17][4] - 1)*sc[15] + (TB[17][5] - 1)*sc[26];
-        alpha[18] = mixture + (TB[18][0] - 1)*sc[0] + (TB[18][1] - 1)*sc[5] + (TB[18][2] - 1)*sc[13] + (TB[18][3] - 1)*sc[14] + (TB[18][4] - 1)*sc[15] + (TB[18][5] - 1)*sc[26];
-        alpha[19] = mixture + (TB[19][0] - 1)*sc[0] + (TB[19][1] - 1)*sc[5] + (TB[19][2] - 1)*sc[13] + (TB[19][3] - 1)*sc[14] + (TB[19][4] - 1)*sc[15] + (TB[19][5] - 1)*sc[26];
-        alpha[20] = mixture + (TB[20][0] - 1)*sc[0] + (TB[20][1] - 1)*sc[5] + (TB[20][2] - 1)*sc[13] + (TB[20][3] - 1)*sc[14] + (TB[20][4] - 1)*sc[15] + (TB[20][5] - 1)*sc[26];
-        alpha[21] = mixture + (TB[21][0] - 1)*sc[0] + (TB[21][1] - 1)*sc[5] + (TB[21][2] - 1)*sc[13] + (TB[21][3] - 1)*sc[14] + (TB[21][4] - 1)*sc[15] + (TB[21][5] - 1)*sc[26];
-        alpha[22] = mixture + (TB[22][0] - 1)*sc[0] + (TB[22][1] - 1)*sc[5] + (TB[22][2] - 1)*sc[13] + (TB[22][3] - 1)*sc[14] + (TB[22][4] - 1)*sc[15] + (TB[22][5] - 1)*sc[26];
-        alpha[23] = mixture + (TB[23][0] - 1)*sc[0] + (TB[23][1] - 1)*sc[5] + (TB[23][2] - 1)*sc[13] + (TB[23][3] - 1)*sc[14] + (TB[23][4] - 1)*sc[15] + (TB[23][5] - 1)*sc[26];
-        alpha[24] = mixture + (TB[24][0] - 1)*sc[0] + (TB[24][1] - 1)*sc[5] + (TB[24][2] - 1)*sc[13] + (TB[24][3] - 1)*sc[14] + (TB[24][4] - 1)*sc[15] + (TB[24][5] - 1)*sc[26];
+        alpha[2] = (memcmp(TB[2], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[13] + (TB[2][3] - 1)*sc[14] + (TB[2][4] - 1)*sc[15] + (TB[2][5] - 1)*sc[26]);
+        alpha[3] = (memcmp(TB[3], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[13] + (TB[3][3] - 1)*sc[14] + (TB[3][4] - 1)*sc[15] + (TB[3][5] - 1)*sc[26]);
+        alpha[4] = (memcmp(TB[4], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[13] + (TB[4][3] - 1)*sc[14] + (TB[4][4] - 1)*sc[15] + (TB[4][5] - 1)*sc[26]);
+        alpha[5] = (memcmp(TB[5], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[13] + (TB[5][3] - 1)*sc[14] + (TB[5][4] - 1)*sc[15] + (TB[5][5] - 1)*sc[26]);
+        alpha[6] = (memcmp(TB[6], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[6][0] - 1)*sc[0] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[13] + (TB[6][3] - 1)*sc[14] + (TB[6][4] - 1)*sc[15] + (TB[6][5] - 1)*sc[26]);
+        alpha[7] = (memcmp(TB[7], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[7][0] - 1)*sc[0] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[13] + (TB[7][3] - 1)*sc[14] + (TB[7][4] - 1)*sc[15] + (TB[7][5] - 1)*sc[26]);
+        alpha[8] = (memcmp(TB[8], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[8][0] - 1)*sc[0] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[13] + (TB[8][3] - 1)*sc[14] + (TB[8][4] - 1)*sc[15] + (TB[8][5] - 1)*sc[26]);
+        alpha[9] = (memcmp(TB[9], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[9][0] - 1)*sc[0] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[13] + (TB[9][3] - 1)*sc[14] + (TB[9][4] - 1)*sc[15] + (TB[9][5] - 1)*sc[26]);
+        alpha[10] = (memcmp(TB[10], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[10][0] - 1)*sc[0] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[13] + (TB[10][3] - 1)*sc[14] + (TB[10][4] - 1)*sc[15] + (TB[10][5] - 1)*sc[26]);
+        alpha[11] = (memcmp(TB[11], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[11][0] - 1)*sc[0] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[13] + (TB[11][3] - 1)*sc[14] + (TB[11][4] - 1)*sc[15] + (TB[11][5] - 1)*sc[26]);
+        alpha[12] = (memcmp(TB[12], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[12][0] - 1)*sc[0] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[13] + (TB[12][3] - 1)*sc[14] + (TB[12][4] - 1)*sc[15] + (TB[12][5] - 1)*sc[26]);
+        alpha[13] = (memcmp(TB[13], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[13][0] - 1)*sc[0] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[13] + (TB[13][3] - 1)*sc[14] + (TB[13][4] - 1)*sc[15] + (TB[13][5] - 1)*sc[26]);
+        alpha[14] = (memcmp(TB[14], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[14][0] - 1)*sc[0] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[13] + (TB[14][3] - 1)*sc[14] + (TB[14][4] - 1)*sc[15] + (TB[14][5] - 1)*sc[26]);
+        alpha[15] = (memcmp(TB[15], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[15][0] - 1)*sc[0] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[13] + (TB[15][3] - 1)*sc[14] + (TB[15][4] - 1)*sc[15] + (TB[15][5] - 1)*sc[26]);
+        alpha[16] = (memcmp(TB[16], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[16][0] - 1)*sc[0] + (TB[16][1] - 1)*sc[5] + (TB[16][2] - 1)*sc[13] + (TB[16][3] - 1)*sc[14] + (TB[16][4] - 1)*sc[15] + (TB[16][5] - 1)*sc[26]);
+        alpha[17] = (memcmp(TB[17], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[17][0] - 1)*sc[0] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[13] + (TB[17][3] - 1)*sc[14] + (TB[17][4] - 1)*sc[15] + (TB[17][5] - 1)*sc[26]);
+        alpha[18] = (memcmp(TB[18], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[18][0] - 1)*sc[0] + (TB[18][1] - 1)*sc[5] + (TB[18][2] - 1)*sc[13] + (TB[18][3] - 1)*sc[14] + (TB[18][4] - 1)*sc[15] + (TB[18][5] - 1)*sc[26]);
+        alpha[19] = (memcmp(TB[19], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[19][0] - 1)*sc[0] + (TB[19][1] - 1)*sc[5] + (TB[19][2] - 1)*sc[13] + (TB[19][3] - 1)*sc[14] + (TB[19][4] - 1)*sc[15] + (TB[19][5] - 1)*sc[26]);
+        alpha[20] = (memcmp(TB[20], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[20][0] - 1)*sc[0] + (TB[20][1] - 1)*sc[5] + (TB[20][2] - 1)*sc[13] + (TB[20][3] - 1)*sc[14] + (TB[20][4] - 1)*sc[15] + (TB[20][5] - 1)*sc[26]);
+        alpha[21] = (memcmp(TB[21], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[21][0] - 1)*sc[0] + (TB[21][1] - 1)*sc[5] + (TB[21][2] - 1)*sc[13] + (TB[21][3] - 1)*sc[14] + (TB[21][4] - 1)*sc[15] + (TB[21][5] - 1)*sc[26]);
+        alpha[22] = (memcmp(TB[22], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[22][0] - 1)*sc[0] + (TB[22][1] - 1)*sc[5] + (TB[22][2] - 1)*sc[13] + (TB[22][3] - 1)*sc[14] + (TB[22][4] - 1)*sc[15] + (TB[22][5] - 1)*sc[26]);
+        alpha[23] = (memcmp(TB[23], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[23][0] - 1)*sc[0] + (TB[23][1] - 1)*sc[5] + (TB[23][2] - 1)*sc[13] + (TB[23][3] - 1)*sc[14] + (TB[23][4] - 1)*sc[15] + (TB[23][5] - 1)*sc[26]);
+        alpha[24] = (memcmp(TB[24], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[24][0] - 1)*sc[0] + (TB[24][1] - 1)*sc[5] + (TB[24][2] - 1)*sc[13] + (TB[24][3] - 1)*sc[14] + (TB[24][4] - 1)*sc[15] + (TB[24][5] - 1)*sc[26]);
 #ifdef __INTEL_COMPILER
          #pragma simd
 #endif
@@ -13358,7 +13956,7 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         double alpha;
         alpha = mixture + (TB[26][0] - 1)*sc[0] + (TB[26][1] - 1)*sc[5] + (TB[26][2] - 1)*sc[13] + (TB[26][3] - 1)*sc[14] + (TB[26][4] - 1)*sc[15] + (TB[26][5] - 1)*sc[26];
         Corr[26] = alpha;
-        alpha = mixture + (TB[27][0] - 1)*sc[0] + (TB[27][1] - 1)*sc[5] + (TB[27][2] - 1)*sc[13] + (TB[27][3] - 1)*sc[14] + (TB[27][4] - 1)*sc[15] + (TB[27][5] - 1)*sc[26];
+        alpha = (memcmp(TB[27], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[27][0] - 1)*sc[0] + (TB[27][1] - 1)*sc[5] + (TB[27][2] - 1)*sc[13] + (TB[27][3] - 1)*sc[14] + (TB[27][4] - 1)*sc[15] + (TB[27][5] - 1)*sc[26]);
         Corr[27] = alpha;
         alpha = mixture + (TB[28][0] - 1)*sc[3] + (TB[28][1] - 1)*sc[5] + (TB[28][2] - 1)*sc[14] + (TB[28][3] - 1)*sc[15] + (TB[28][4] - 1)*sc[26] + (TB[28][5] - 1)*sc[30];
         Corr[28] = alpha;
@@ -17362,17 +17960,24 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         mixture += sc[k];
     }
 
-    /*compute the Gibbs free energy */
-    double g_RT[35];
-    gibbs(g_RT, tc);
-
     /*compute the species enthalpy */
     double h_RT[35];
     speciesEnthalpy(h_RT, tc);
 
+    /*compute the rate and equilibrium constants */
+    double k_f_s[217], Kc_s[217];
+    comp_k_f(tc, invT, k_f_s);
+    comp_Kc(tc, invT, Kc_s);
+
+    /*at constant volume, the part of dwdot/d[X] common to all species */
+    double Jmix[35];
+    for (int k=0; k<35; k++) {
+        Jmix[k] = 0.0;
+    }
+
     double phi_f, k_f, k_r, phi_r, Kc, q, q_nocor, Corr, alpha;
     double dlnkfdT, dlnk0dT, dlnKcdT, dkrdT, dqdT;
-    double dqdci, dcdc_fac, dqdc[35];
+    double dqdci, dcdc_fac;
     double Pr, fPr, F, k_0, logPr;
     double logFcent, troe_c, troe_n, troePr_den, troePr, troe;
     double Fcent1, Fcent2, Fcent3, Fcent;
@@ -17380,15 +17985,18 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     double dlogPrdT, dlogfPrdT, dlogFdT, dlogFcentdT, dlogFdlogPr, dlnCorrdT;
     const double ln10 = log(10.0);
     const double log10e = 1.0/log(10.0);
+
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[0][0] - 1)*sc[0] + (TB[0][1] - 1)*sc[5] + (TB[0][2] - 1)*sc[13] + (TB[0][3] - 1)*sc[14] + (TB[0][4] - 1)*sc[15] + (TB[0][5] - 1)*sc[26];
+
     /*reaction 1: H + CH2 (+M) <=> CH3 (+M) */
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[0][0] - 1)*sc[0] + (TB[0][1] - 1)*sc[5] + (TB[0][2] - 1)*sc[13] + (TB[0][3] - 1)*sc[14] + (TB[0][4] - 1)*sc[15] + (TB[0][5] - 1)*sc[26];
+    alpha = alpha_eff0;
     /* forward */
     phi_f = sc[1]*sc[10];
-    k_f = prefactor_units[0] * fwd_A[0]
-                * exp(fwd_beta[0] * tc[0] - activation_units[0] * fwd_Ea[0] * invT);
+    k_f = k_f_s[0];
     dlnkfdT = fwd_beta[0] * invT + activation_units[0] * fwd_Ea[0] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[0] * exp(low_beta[0] * tc[0] - activation_units[0] * low_Ea[0] * invT);
@@ -17404,16 +18012,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[0] == 4 ? exp(-troe_Tss[0] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
+      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
+      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
-      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
-      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -17421,7 +18029,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[12];
-    Kc = refCinv * exp(g_RT[1] + g_RT[10] - g_RT[12]);
+    Kc = Kc_s[0];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[10]) + (h_RT[12]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -17439,95 +18047,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[0][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[10] -= dqdci;               /* dwdot[CH2]/d[H2] */
-        J[12] += dqdci;               /* dwdot[CH3]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[10];
-        J[37] -= dqdci;               /* dwdot[H]/d[H] */
-        J[46] -= dqdci;               /* dwdot[CH2]/d[H] */
-        J[48] += dqdci;               /* dwdot[CH3]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[0][1] - 1)*dcdc_fac;
-        J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[190] -= dqdci;              /* dwdot[CH2]/d[H2O] */
-        J[192] += dqdci;              /* dwdot[CH3]/d[H2O] */
-        /* d()/d[CH2] */
-        dqdci =  + k_f*sc[1];
-        J[361] -= dqdci;              /* dwdot[H]/d[CH2] */
-        J[370] -= dqdci;              /* dwdot[CH2]/d[CH2] */
-        J[372] += dqdci;              /* dwdot[CH3]/d[CH2] */
-        /* d()/d[CH3] */
-        dqdci =  - k_r;
-        J[433] -= dqdci;              /* dwdot[H]/d[CH3] */
-        J[442] -= dqdci;              /* dwdot[CH2]/d[CH3] */
-        J[444] += dqdci;              /* dwdot[CH3]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[0][2] - 1)*dcdc_fac;
-        J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[478] -= dqdci;              /* dwdot[CH2]/d[CH4] */
-        J[480] += dqdci;              /* dwdot[CH3]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[0][3] - 1)*dcdc_fac;
-        J[505] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[514] -= dqdci;              /* dwdot[CH2]/d[CO] */
-        J[516] += dqdci;              /* dwdot[CH3]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[0][4] - 1)*dcdc_fac;
-        J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[550] -= dqdci;              /* dwdot[CH2]/d[CO2] */
-        J[552] += dqdci;              /* dwdot[CH3]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[0][5] - 1)*dcdc_fac;
-        J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[946] -= dqdci;              /* dwdot[CH2]/d[C2H6] */
-        J[948] += dqdci;              /* dwdot[CH3]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[0][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[10];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[0][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac + k_f*sc[1];
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac - k_r;
-        dqdc[13] = TB[0][2]*dcdc_fac;
-        dqdc[14] = TB[0][3]*dcdc_fac;
-        dqdc[15] = TB[0][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[0][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+1] -= dqdc[k];
-            J[36*k+10] -= dqdc[k];
-            J[36*k+12] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[10] -= dcdc_fac;
+    Jmix[12] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[0][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[10] -= dqdci;               /* dwdot[CH2]/d[H2] */
+    J[12] += dqdci;               /* dwdot[CH3]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[10];
+    J[37] -= dqdci;               /* dwdot[H]/d[H] */
+    J[46] -= dqdci;               /* dwdot[CH2]/d[H] */
+    J[48] += dqdci;               /* dwdot[CH3]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[0][1] - 1)*dcdc_fac;
+    J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[190] -= dqdci;              /* dwdot[CH2]/d[H2O] */
+    J[192] += dqdci;              /* dwdot[CH3]/d[H2O] */
+    /* d()/d[CH2] */
+    dqdci =  + k_f*sc[1];
+    J[361] -= dqdci;              /* dwdot[H]/d[CH2] */
+    J[370] -= dqdci;              /* dwdot[CH2]/d[CH2] */
+    J[372] += dqdci;              /* dwdot[CH3]/d[CH2] */
+    /* d()/d[CH3] */
+    dqdci =  - k_r;
+    J[433] -= dqdci;              /* dwdot[H]/d[CH3] */
+    J[442] -= dqdci;              /* dwdot[CH2]/d[CH3] */
+    J[444] += dqdci;              /* dwdot[CH3]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[0][2] - 1)*dcdc_fac;
+    J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[478] -= dqdci;              /* dwdot[CH2]/d[CH4] */
+    J[480] += dqdci;              /* dwdot[CH3]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[0][3] - 1)*dcdc_fac;
+    J[505] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[514] -= dqdci;              /* dwdot[CH2]/d[CO] */
+    J[516] += dqdci;              /* dwdot[CH3]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[0][4] - 1)*dcdc_fac;
+    J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[550] -= dqdci;              /* dwdot[CH2]/d[CO2] */
+    J[552] += dqdci;              /* dwdot[CH3]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[0][5] - 1)*dcdc_fac;
+    J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[946] -= dqdci;              /* dwdot[CH2]/d[C2H6] */
+    J[948] += dqdci;              /* dwdot[CH3]/d[C2H6] */
     J[1261] -= dqdT; /* dwdot[H]/dT */
     J[1270] -= dqdT; /* dwdot[CH2]/dT */
     J[1272] += dqdT; /* dwdot[CH3]/dT */
@@ -17539,8 +18107,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[1][0] - 1)*sc[0] + (TB[1][1] - 1)*sc[5] + (TB[1][2] - 1)*sc[13] + (TB[1][3] - 1)*sc[14] + (TB[1][4] - 1)*sc[15] + (TB[1][5] - 1)*sc[26];
     /* forward */
     phi_f = sc[1]*sc[12];
-    k_f = prefactor_units[1] * fwd_A[1]
-                * exp(fwd_beta[1] * tc[0] - activation_units[1] * fwd_Ea[1] * invT);
+    k_f = k_f_s[1];
     dlnkfdT = fwd_beta[1] * invT + activation_units[1] * fwd_Ea[1] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[1] * exp(low_beta[1] * tc[0] - activation_units[1] * low_Ea[1] * invT);
@@ -17556,16 +18123,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[1] == 4 ? exp(-troe_Tss[1] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
+      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
+      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
-      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
-      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -17573,7 +18140,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[13];
-    Kc = refCinv * exp(g_RT[1] + g_RT[12] - g_RT[13]);
+    Kc = Kc_s[1];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[12]) + (h_RT[13]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -17591,90 +18158,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[1][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
-        J[13] += dqdci;               /* dwdot[CH4]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[12];
-        J[37] -= dqdci;               /* dwdot[H]/d[H] */
-        J[48] -= dqdci;               /* dwdot[CH3]/d[H] */
-        J[49] += dqdci;               /* dwdot[CH4]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[1][1] - 1)*dcdc_fac;
-        J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[192] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[193] += dqdci;              /* dwdot[CH4]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[1];
-        J[433] -= dqdci;              /* dwdot[H]/d[CH3] */
-        J[444] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[445] += dqdci;              /* dwdot[CH4]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[1][2] - 1)*dcdc_fac - k_r;
-        J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[480] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[481] += dqdci;              /* dwdot[CH4]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[1][3] - 1)*dcdc_fac;
-        J[505] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[516] -= dqdci;              /* dwdot[CH3]/d[CO] */
-        J[517] += dqdci;              /* dwdot[CH4]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[1][4] - 1)*dcdc_fac;
-        J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[552] -= dqdci;              /* dwdot[CH3]/d[CO2] */
-        J[553] += dqdci;              /* dwdot[CH4]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[1][5] - 1)*dcdc_fac;
-        J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[948] -= dqdci;              /* dwdot[CH3]/d[C2H6] */
-        J[949] += dqdci;              /* dwdot[CH4]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[1][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[12];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[1][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*sc[1];
-        dqdc[13] = TB[1][2]*dcdc_fac - k_r;
-        dqdc[14] = TB[1][3]*dcdc_fac;
-        dqdc[15] = TB[1][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[1][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+1] -= dqdc[k];
-            J[36*k+12] -= dqdc[k];
-            J[36*k+13] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[12] -= dcdc_fac;
+    Jmix[13] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[1][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
+    J[13] += dqdci;               /* dwdot[CH4]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[12];
+    J[37] -= dqdci;               /* dwdot[H]/d[H] */
+    J[48] -= dqdci;               /* dwdot[CH3]/d[H] */
+    J[49] += dqdci;               /* dwdot[CH4]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[1][1] - 1)*dcdc_fac;
+    J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[192] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[193] += dqdci;              /* dwdot[CH4]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[1];
+    J[433] -= dqdci;              /* dwdot[H]/d[CH3] */
+    J[444] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[445] += dqdci;              /* dwdot[CH4]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[1][2] - 1)*dcdc_fac - k_r;
+    J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[480] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[481] += dqdci;              /* dwdot[CH4]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[1][3] - 1)*dcdc_fac;
+    J[505] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[516] -= dqdci;              /* dwdot[CH3]/d[CO] */
+    J[517] += dqdci;              /* dwdot[CH4]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[1][4] - 1)*dcdc_fac;
+    J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[552] -= dqdci;              /* dwdot[CH3]/d[CO2] */
+    J[553] += dqdci;              /* dwdot[CH4]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[1][5] - 1)*dcdc_fac;
+    J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[948] -= dqdci;              /* dwdot[CH3]/d[C2H6] */
+    J[949] += dqdci;              /* dwdot[CH4]/d[C2H6] */
     J[1261] -= dqdT; /* dwdot[H]/dT */
     J[1272] -= dqdT; /* dwdot[CH3]/dT */
     J[1273] += dqdT; /* dwdot[CH4]/dT */
@@ -17683,11 +18210,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[13] + (TB[2][3] - 1)*sc[14] + (TB[2][4] - 1)*sc[15] + (TB[2][5] - 1)*sc[26];
+    alpha = (memcmp(TB[2], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[13] + (TB[2][3] - 1)*sc[14] + (TB[2][4] - 1)*sc[15] + (TB[2][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[1]*sc[16];
-    k_f = prefactor_units[2] * fwd_A[2]
-                * exp(fwd_beta[2] * tc[0] - activation_units[2] * fwd_Ea[2] * invT);
+    k_f = k_f_s[2];
     dlnkfdT = fwd_beta[2] * invT + activation_units[2] * fwd_Ea[2] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[2] * exp(low_beta[2] * tc[0] - activation_units[2] * low_Ea[2] * invT);
@@ -17703,16 +18229,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[2] == 4 ? exp(-troe_Tss[2] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[2]) > 1.e-100 ? -Fcent1/troe_Tsss[2] : 0.)
+      + (fabs(troe_Ts[2]) > 1.e-100 ? -Fcent2/troe_Ts[2] : 0.)
+      + (troe_len[2] == 4 ? Fcent3*troe_Tss[2]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[2]) > 1.e-100 ? -Fcent1/troe_Tsss[2] : 0.)
-      + (fabs(troe_Ts[2]) > 1.e-100 ? -Fcent2/troe_Ts[2] : 0.)
-      + (troe_len[2] == 4 ? Fcent3*troe_Tss[2]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -17720,7 +18246,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[17];
-    Kc = refCinv * exp(g_RT[1] + g_RT[16] - g_RT[17]);
+    Kc = Kc_s[2];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[16]) + (h_RT[17]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -17738,95 +18264,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[2][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[16] -= dqdci;               /* dwdot[HCO]/d[H2] */
-        J[17] += dqdci;               /* dwdot[CH2O]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[16];
-        J[37] -= dqdci;               /* dwdot[H]/d[H] */
-        J[52] -= dqdci;               /* dwdot[HCO]/d[H] */
-        J[53] += dqdci;               /* dwdot[CH2O]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[2][1] - 1)*dcdc_fac;
-        J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[196] -= dqdci;              /* dwdot[HCO]/d[H2O] */
-        J[197] += dqdci;              /* dwdot[CH2O]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[2][2] - 1)*dcdc_fac;
-        J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[484] -= dqdci;              /* dwdot[HCO]/d[CH4] */
-        J[485] += dqdci;              /* dwdot[CH2O]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[2][3] - 1)*dcdc_fac;
-        J[505] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[520] -= dqdci;              /* dwdot[HCO]/d[CO] */
-        J[521] += dqdci;              /* dwdot[CH2O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[2][4] - 1)*dcdc_fac;
-        J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[556] -= dqdci;              /* dwdot[HCO]/d[CO2] */
-        J[557] += dqdci;              /* dwdot[CH2O]/d[CO2] */
-        /* d()/d[HCO] */
-        dqdci =  + k_f*sc[1];
-        J[577] -= dqdci;              /* dwdot[H]/d[HCO] */
-        J[592] -= dqdci;              /* dwdot[HCO]/d[HCO] */
-        J[593] += dqdci;              /* dwdot[CH2O]/d[HCO] */
-        /* d()/d[CH2O] */
-        dqdci =  - k_r;
-        J[613] -= dqdci;              /* dwdot[H]/d[CH2O] */
-        J[628] -= dqdci;              /* dwdot[HCO]/d[CH2O] */
-        J[629] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[2][5] - 1)*dcdc_fac;
-        J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[952] -= dqdci;              /* dwdot[HCO]/d[C2H6] */
-        J[953] += dqdci;              /* dwdot[CH2O]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[2][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[16];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[2][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[2][2]*dcdc_fac;
-        dqdc[14] = TB[2][3]*dcdc_fac;
-        dqdc[15] = TB[2][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac + k_f*sc[1];
-        dqdc[17] = dcdc_fac - k_r;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[2][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+1] -= dqdc[k];
-            J[36*k+16] -= dqdc[k];
-            J[36*k+17] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[16] -= dcdc_fac;
+    Jmix[17] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[2][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[16] -= dqdci;               /* dwdot[HCO]/d[H2] */
+    J[17] += dqdci;               /* dwdot[CH2O]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[16];
+    J[37] -= dqdci;               /* dwdot[H]/d[H] */
+    J[52] -= dqdci;               /* dwdot[HCO]/d[H] */
+    J[53] += dqdci;               /* dwdot[CH2O]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[2][1] - 1)*dcdc_fac;
+    J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[196] -= dqdci;              /* dwdot[HCO]/d[H2O] */
+    J[197] += dqdci;              /* dwdot[CH2O]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[2][2] - 1)*dcdc_fac;
+    J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[484] -= dqdci;              /* dwdot[HCO]/d[CH4] */
+    J[485] += dqdci;              /* dwdot[CH2O]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[2][3] - 1)*dcdc_fac;
+    J[505] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[520] -= dqdci;              /* dwdot[HCO]/d[CO] */
+    J[521] += dqdci;              /* dwdot[CH2O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[2][4] - 1)*dcdc_fac;
+    J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[556] -= dqdci;              /* dwdot[HCO]/d[CO2] */
+    J[557] += dqdci;              /* dwdot[CH2O]/d[CO2] */
+    /* d()/d[HCO] */
+    dqdci =  + k_f*sc[1];
+    J[577] -= dqdci;              /* dwdot[H]/d[HCO] */
+    J[592] -= dqdci;              /* dwdot[HCO]/d[HCO] */
+    J[593] += dqdci;              /* dwdot[CH2O]/d[HCO] */
+    /* d()/d[CH2O] */
+    dqdci =  - k_r;
+    J[613] -= dqdci;              /* dwdot[H]/d[CH2O] */
+    J[628] -= dqdci;              /* dwdot[HCO]/d[CH2O] */
+    J[629] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[2][5] - 1)*dcdc_fac;
+    J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[952] -= dqdci;              /* dwdot[HCO]/d[C2H6] */
+    J[953] += dqdci;              /* dwdot[CH2O]/d[C2H6] */
     J[1261] -= dqdT; /* dwdot[H]/dT */
     J[1276] -= dqdT; /* dwdot[HCO]/dT */
     J[1277] += dqdT; /* dwdot[CH2O]/dT */
@@ -17835,11 +18321,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[13] + (TB[3][3] - 1)*sc[14] + (TB[3][4] - 1)*sc[15] + (TB[3][5] - 1)*sc[26];
+    alpha = (memcmp(TB[3], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[13] + (TB[3][3] - 1)*sc[14] + (TB[3][4] - 1)*sc[15] + (TB[3][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[1]*sc[17];
-    k_f = prefactor_units[3] * fwd_A[3]
-                * exp(fwd_beta[3] * tc[0] - activation_units[3] * fwd_Ea[3] * invT);
+    k_f = k_f_s[3];
     dlnkfdT = fwd_beta[3] * invT + activation_units[3] * fwd_Ea[3] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[3] * exp(low_beta[3] * tc[0] - activation_units[3] * low_Ea[3] * invT);
@@ -17855,16 +18340,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[3] == 4 ? exp(-troe_Tss[3] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[3]) > 1.e-100 ? -Fcent1/troe_Tsss[3] : 0.)
+      + (fabs(troe_Ts[3]) > 1.e-100 ? -Fcent2/troe_Ts[3] : 0.)
+      + (troe_len[3] == 4 ? Fcent3*troe_Tss[3]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[3]) > 1.e-100 ? -Fcent1/troe_Tsss[3] : 0.)
-      + (fabs(troe_Ts[3]) > 1.e-100 ? -Fcent2/troe_Ts[3] : 0.)
-      + (troe_len[3] == 4 ? Fcent3*troe_Tss[3]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -17872,7 +18357,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[18];
-    Kc = refCinv * exp(g_RT[1] + g_RT[17] - g_RT[18]);
+    Kc = Kc_s[3];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[17]) + (h_RT[18]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -17890,95 +18375,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[3][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[17] -= dqdci;               /* dwdot[CH2O]/d[H2] */
-        J[18] += dqdci;               /* dwdot[CH2OH]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[17];
-        J[37] -= dqdci;               /* dwdot[H]/d[H] */
-        J[53] -= dqdci;               /* dwdot[CH2O]/d[H] */
-        J[54] += dqdci;               /* dwdot[CH2OH]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[3][1] - 1)*dcdc_fac;
-        J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[197] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
-        J[198] += dqdci;              /* dwdot[CH2OH]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[3][2] - 1)*dcdc_fac;
-        J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[485] -= dqdci;              /* dwdot[CH2O]/d[CH4] */
-        J[486] += dqdci;              /* dwdot[CH2OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[3][3] - 1)*dcdc_fac;
-        J[505] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[521] -= dqdci;              /* dwdot[CH2O]/d[CO] */
-        J[522] += dqdci;              /* dwdot[CH2OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[3][4] - 1)*dcdc_fac;
-        J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[557] -= dqdci;              /* dwdot[CH2O]/d[CO2] */
-        J[558] += dqdci;              /* dwdot[CH2OH]/d[CO2] */
-        /* d()/d[CH2O] */
-        dqdci =  + k_f*sc[1];
-        J[613] -= dqdci;              /* dwdot[H]/d[CH2O] */
-        J[629] -= dqdci;              /* dwdot[CH2O]/d[CH2O] */
-        J[630] += dqdci;              /* dwdot[CH2OH]/d[CH2O] */
-        /* d()/d[CH2OH] */
-        dqdci =  - k_r;
-        J[649] -= dqdci;              /* dwdot[H]/d[CH2OH] */
-        J[665] -= dqdci;              /* dwdot[CH2O]/d[CH2OH] */
-        J[666] += dqdci;              /* dwdot[CH2OH]/d[CH2OH] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[3][5] - 1)*dcdc_fac;
-        J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[953] -= dqdci;              /* dwdot[CH2O]/d[C2H6] */
-        J[954] += dqdci;              /* dwdot[CH2OH]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[3][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[17];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[3][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[3][2]*dcdc_fac;
-        dqdc[14] = TB[3][3]*dcdc_fac;
-        dqdc[15] = TB[3][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac + k_f*sc[1];
-        dqdc[18] = dcdc_fac - k_r;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[3][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+1] -= dqdc[k];
-            J[36*k+17] -= dqdc[k];
-            J[36*k+18] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[17] -= dcdc_fac;
+    Jmix[18] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[3][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[17] -= dqdci;               /* dwdot[CH2O]/d[H2] */
+    J[18] += dqdci;               /* dwdot[CH2OH]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[17];
+    J[37] -= dqdci;               /* dwdot[H]/d[H] */
+    J[53] -= dqdci;               /* dwdot[CH2O]/d[H] */
+    J[54] += dqdci;               /* dwdot[CH2OH]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[3][1] - 1)*dcdc_fac;
+    J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[197] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
+    J[198] += dqdci;              /* dwdot[CH2OH]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[3][2] - 1)*dcdc_fac;
+    J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[485] -= dqdci;              /* dwdot[CH2O]/d[CH4] */
+    J[486] += dqdci;              /* dwdot[CH2OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[3][3] - 1)*dcdc_fac;
+    J[505] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[521] -= dqdci;              /* dwdot[CH2O]/d[CO] */
+    J[522] += dqdci;              /* dwdot[CH2OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[3][4] - 1)*dcdc_fac;
+    J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[557] -= dqdci;              /* dwdot[CH2O]/d[CO2] */
+    J[558] += dqdci;              /* dwdot[CH2OH]/d[CO2] */
+    /* d()/d[CH2O] */
+    dqdci =  + k_f*sc[1];
+    J[613] -= dqdci;              /* dwdot[H]/d[CH2O] */
+    J[629] -= dqdci;              /* dwdot[CH2O]/d[CH2O] */
+    J[630] += dqdci;              /* dwdot[CH2OH]/d[CH2O] */
+    /* d()/d[CH2OH] */
+    dqdci =  - k_r;
+    J[649] -= dqdci;              /* dwdot[H]/d[CH2OH] */
+    J[665] -= dqdci;              /* dwdot[CH2O]/d[CH2OH] */
+    J[666] += dqdci;              /* dwdot[CH2OH]/d[CH2OH] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[3][5] - 1)*dcdc_fac;
+    J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[953] -= dqdci;              /* dwdot[CH2O]/d[C2H6] */
+    J[954] += dqdci;              /* dwdot[CH2OH]/d[C2H6] */
     J[1261] -= dqdT; /* dwdot[H]/dT */
     J[1277] -= dqdT; /* dwdot[CH2O]/dT */
     J[1278] += dqdT; /* dwdot[CH2OH]/dT */
@@ -17987,11 +18432,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[13] + (TB[4][3] - 1)*sc[14] + (TB[4][4] - 1)*sc[15] + (TB[4][5] - 1)*sc[26];
+    alpha = (memcmp(TB[4], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[13] + (TB[4][3] - 1)*sc[14] + (TB[4][4] - 1)*sc[15] + (TB[4][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[1]*sc[17];
-    k_f = prefactor_units[4] * fwd_A[4]
-                * exp(fwd_beta[4] * tc[0] - activation_units[4] * fwd_Ea[4] * invT);
+    k_f = k_f_s[4];
     dlnkfdT = fwd_beta[4] * invT + activation_units[4] * fwd_Ea[4] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[4] * exp(low_beta[4] * tc[0] - activation_units[4] * low_Ea[4] * invT);
@@ -18007,16 +18451,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[4] == 4 ? exp(-troe_Tss[4] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[4]) > 1.e-100 ? -Fcent1/troe_Tsss[4] : 0.)
+      + (fabs(troe_Ts[4]) > 1.e-100 ? -Fcent2/troe_Ts[4] : 0.)
+      + (troe_len[4] == 4 ? Fcent3*troe_Tss[4]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[4]) > 1.e-100 ? -Fcent1/troe_Tsss[4] : 0.)
-      + (fabs(troe_Ts[4]) > 1.e-100 ? -Fcent2/troe_Ts[4] : 0.)
-      + (troe_len[4] == 4 ? Fcent3*troe_Tss[4]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -18024,7 +18468,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[19];
-    Kc = refCinv * exp(g_RT[1] + g_RT[17] - g_RT[19]);
+    Kc = Kc_s[4];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[17]) + (h_RT[19]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18042,95 +18486,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[4][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[17] -= dqdci;               /* dwdot[CH2O]/d[H2] */
-        J[19] += dqdci;               /* dwdot[CH3O]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[17];
-        J[37] -= dqdci;               /* dwdot[H]/d[H] */
-        J[53] -= dqdci;               /* dwdot[CH2O]/d[H] */
-        J[55] += dqdci;               /* dwdot[CH3O]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[4][1] - 1)*dcdc_fac;
-        J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[197] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
-        J[199] += dqdci;              /* dwdot[CH3O]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[4][2] - 1)*dcdc_fac;
-        J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[485] -= dqdci;              /* dwdot[CH2O]/d[CH4] */
-        J[487] += dqdci;              /* dwdot[CH3O]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[4][3] - 1)*dcdc_fac;
-        J[505] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[521] -= dqdci;              /* dwdot[CH2O]/d[CO] */
-        J[523] += dqdci;              /* dwdot[CH3O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[4][4] - 1)*dcdc_fac;
-        J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[557] -= dqdci;              /* dwdot[CH2O]/d[CO2] */
-        J[559] += dqdci;              /* dwdot[CH3O]/d[CO2] */
-        /* d()/d[CH2O] */
-        dqdci =  + k_f*sc[1];
-        J[613] -= dqdci;              /* dwdot[H]/d[CH2O] */
-        J[629] -= dqdci;              /* dwdot[CH2O]/d[CH2O] */
-        J[631] += dqdci;              /* dwdot[CH3O]/d[CH2O] */
-        /* d()/d[CH3O] */
-        dqdci =  - k_r;
-        J[685] -= dqdci;              /* dwdot[H]/d[CH3O] */
-        J[701] -= dqdci;              /* dwdot[CH2O]/d[CH3O] */
-        J[703] += dqdci;              /* dwdot[CH3O]/d[CH3O] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[4][5] - 1)*dcdc_fac;
-        J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[953] -= dqdci;              /* dwdot[CH2O]/d[C2H6] */
-        J[955] += dqdci;              /* dwdot[CH3O]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[4][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[17];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[4][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[4][2]*dcdc_fac;
-        dqdc[14] = TB[4][3]*dcdc_fac;
-        dqdc[15] = TB[4][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac + k_f*sc[1];
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac - k_r;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[4][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+1] -= dqdc[k];
-            J[36*k+17] -= dqdc[k];
-            J[36*k+19] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[17] -= dcdc_fac;
+    Jmix[19] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[4][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[17] -= dqdci;               /* dwdot[CH2O]/d[H2] */
+    J[19] += dqdci;               /* dwdot[CH3O]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[17];
+    J[37] -= dqdci;               /* dwdot[H]/d[H] */
+    J[53] -= dqdci;               /* dwdot[CH2O]/d[H] */
+    J[55] += dqdci;               /* dwdot[CH3O]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[4][1] - 1)*dcdc_fac;
+    J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[197] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
+    J[199] += dqdci;              /* dwdot[CH3O]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[4][2] - 1)*dcdc_fac;
+    J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[485] -= dqdci;              /* dwdot[CH2O]/d[CH4] */
+    J[487] += dqdci;              /* dwdot[CH3O]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[4][3] - 1)*dcdc_fac;
+    J[505] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[521] -= dqdci;              /* dwdot[CH2O]/d[CO] */
+    J[523] += dqdci;              /* dwdot[CH3O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[4][4] - 1)*dcdc_fac;
+    J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[557] -= dqdci;              /* dwdot[CH2O]/d[CO2] */
+    J[559] += dqdci;              /* dwdot[CH3O]/d[CO2] */
+    /* d()/d[CH2O] */
+    dqdci =  + k_f*sc[1];
+    J[613] -= dqdci;              /* dwdot[H]/d[CH2O] */
+    J[629] -= dqdci;              /* dwdot[CH2O]/d[CH2O] */
+    J[631] += dqdci;              /* dwdot[CH3O]/d[CH2O] */
+    /* d()/d[CH3O] */
+    dqdci =  - k_r;
+    J[685] -= dqdci;              /* dwdot[H]/d[CH3O] */
+    J[701] -= dqdci;              /* dwdot[CH2O]/d[CH3O] */
+    J[703] += dqdci;              /* dwdot[CH3O]/d[CH3O] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[4][5] - 1)*dcdc_fac;
+    J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[953] -= dqdci;              /* dwdot[CH2O]/d[C2H6] */
+    J[955] += dqdci;              /* dwdot[CH3O]/d[C2H6] */
     J[1261] -= dqdT; /* dwdot[H]/dT */
     J[1277] -= dqdT; /* dwdot[CH2O]/dT */
     J[1279] += dqdT; /* dwdot[CH3O]/dT */
@@ -18139,11 +18543,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[13] + (TB[5][3] - 1)*sc[14] + (TB[5][4] - 1)*sc[15] + (TB[5][5] - 1)*sc[26];
+    alpha = (memcmp(TB[5], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[13] + (TB[5][3] - 1)*sc[14] + (TB[5][4] - 1)*sc[15] + (TB[5][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[1]*sc[18];
-    k_f = prefactor_units[5] * fwd_A[5]
-                * exp(fwd_beta[5] * tc[0] - activation_units[5] * fwd_Ea[5] * invT);
+    k_f = k_f_s[5];
     dlnkfdT = fwd_beta[5] * invT + activation_units[5] * fwd_Ea[5] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[5] * exp(low_beta[5] * tc[0] - activation_units[5] * low_Ea[5] * invT);
@@ -18159,16 +18562,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[5] == 4 ? exp(-troe_Tss[5] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[5]) > 1.e-100 ? -Fcent1/troe_Tsss[5] : 0.)
+      + (fabs(troe_Ts[5]) > 1.e-100 ? -Fcent2/troe_Ts[5] : 0.)
+      + (troe_len[5] == 4 ? Fcent3*troe_Tss[5]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[5]) > 1.e-100 ? -Fcent1/troe_Tsss[5] : 0.)
-      + (fabs(troe_Ts[5]) > 1.e-100 ? -Fcent2/troe_Ts[5] : 0.)
-      + (troe_len[5] == 4 ? Fcent3*troe_Tss[5]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -18176,7 +18579,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[20];
-    Kc = refCinv * exp(g_RT[1] + g_RT[18] - g_RT[20]);
+    Kc = Kc_s[5];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[18]) + (h_RT[20]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18194,95 +18597,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[5][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[18] -= dqdci;               /* dwdot[CH2OH]/d[H2] */
-        J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[18];
-        J[37] -= dqdci;               /* dwdot[H]/d[H] */
-        J[54] -= dqdci;               /* dwdot[CH2OH]/d[H] */
-        J[56] += dqdci;               /* dwdot[CH3OH]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[5][1] - 1)*dcdc_fac;
-        J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[198] -= dqdci;              /* dwdot[CH2OH]/d[H2O] */
-        J[200] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[5][2] - 1)*dcdc_fac;
-        J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[486] -= dqdci;              /* dwdot[CH2OH]/d[CH4] */
-        J[488] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[5][3] - 1)*dcdc_fac;
-        J[505] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[522] -= dqdci;              /* dwdot[CH2OH]/d[CO] */
-        J[524] += dqdci;              /* dwdot[CH3OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[5][4] - 1)*dcdc_fac;
-        J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[558] -= dqdci;              /* dwdot[CH2OH]/d[CO2] */
-        J[560] += dqdci;              /* dwdot[CH3OH]/d[CO2] */
-        /* d()/d[CH2OH] */
-        dqdci =  + k_f*sc[1];
-        J[649] -= dqdci;              /* dwdot[H]/d[CH2OH] */
-        J[666] -= dqdci;              /* dwdot[CH2OH]/d[CH2OH] */
-        J[668] += dqdci;              /* dwdot[CH3OH]/d[CH2OH] */
-        /* d()/d[CH3OH] */
-        dqdci =  - k_r;
-        J[721] -= dqdci;              /* dwdot[H]/d[CH3OH] */
-        J[738] -= dqdci;              /* dwdot[CH2OH]/d[CH3OH] */
-        J[740] += dqdci;              /* dwdot[CH3OH]/d[CH3OH] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[5][5] - 1)*dcdc_fac;
-        J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[954] -= dqdci;              /* dwdot[CH2OH]/d[C2H6] */
-        J[956] += dqdci;              /* dwdot[CH3OH]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[5][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[18];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[5][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[5][2]*dcdc_fac;
-        dqdc[14] = TB[5][3]*dcdc_fac;
-        dqdc[15] = TB[5][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac + k_f*sc[1];
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac - k_r;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[5][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+1] -= dqdc[k];
-            J[36*k+18] -= dqdc[k];
-            J[36*k+20] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[18] -= dcdc_fac;
+    Jmix[20] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[5][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[18] -= dqdci;               /* dwdot[CH2OH]/d[H2] */
+    J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[18];
+    J[37] -= dqdci;               /* dwdot[H]/d[H] */
+    J[54] -= dqdci;               /* dwdot[CH2OH]/d[H] */
+    J[56] += dqdci;               /* dwdot[CH3OH]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[5][1] - 1)*dcdc_fac;
+    J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[198] -= dqdci;              /* dwdot[CH2OH]/d[H2O] */
+    J[200] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[5][2] - 1)*dcdc_fac;
+    J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[486] -= dqdci;              /* dwdot[CH2OH]/d[CH4] */
+    J[488] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[5][3] - 1)*dcdc_fac;
+    J[505] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[522] -= dqdci;              /* dwdot[CH2OH]/d[CO] */
+    J[524] += dqdci;              /* dwdot[CH3OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[5][4] - 1)*dcdc_fac;
+    J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[558] -= dqdci;              /* dwdot[CH2OH]/d[CO2] */
+    J[560] += dqdci;              /* dwdot[CH3OH]/d[CO2] */
+    /* d()/d[CH2OH] */
+    dqdci =  + k_f*sc[1];
+    J[649] -= dqdci;              /* dwdot[H]/d[CH2OH] */
+    J[666] -= dqdci;              /* dwdot[CH2OH]/d[CH2OH] */
+    J[668] += dqdci;              /* dwdot[CH3OH]/d[CH2OH] */
+    /* d()/d[CH3OH] */
+    dqdci =  - k_r;
+    J[721] -= dqdci;              /* dwdot[H]/d[CH3OH] */
+    J[738] -= dqdci;              /* dwdot[CH2OH]/d[CH3OH] */
+    J[740] += dqdci;              /* dwdot[CH3OH]/d[CH3OH] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[5][5] - 1)*dcdc_fac;
+    J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[954] -= dqdci;              /* dwdot[CH2OH]/d[C2H6] */
+    J[956] += dqdci;              /* dwdot[CH3OH]/d[C2H6] */
     J[1261] -= dqdT; /* dwdot[H]/dT */
     J[1278] -= dqdT; /* dwdot[CH2OH]/dT */
     J[1280] += dqdT; /* dwdot[CH3OH]/dT */
@@ -18291,11 +18654,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[6][0] - 1)*sc[0] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[13] + (TB[6][3] - 1)*sc[14] + (TB[6][4] - 1)*sc[15] + (TB[6][5] - 1)*sc[26];
+    alpha = (memcmp(TB[6], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[6][0] - 1)*sc[0] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[13] + (TB[6][3] - 1)*sc[14] + (TB[6][4] - 1)*sc[15] + (TB[6][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[6] * fwd_A[6]
-                * exp(fwd_beta[6] * tc[0] - activation_units[6] * fwd_Ea[6] * invT);
+    k_f = k_f_s[6];
     dlnkfdT = fwd_beta[6] * invT + activation_units[6] * fwd_Ea[6] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[6] * exp(low_beta[6] * tc[0] - activation_units[6] * low_Ea[6] * invT);
@@ -18311,16 +18673,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[6] == 4 ? exp(-troe_Tss[6] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[6]) > 1.e-100 ? -Fcent1/troe_Tsss[6] : 0.)
+      + (fabs(troe_Ts[6]) > 1.e-100 ? -Fcent2/troe_Ts[6] : 0.)
+      + (troe_len[6] == 4 ? Fcent3*troe_Tss[6]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[6]) > 1.e-100 ? -Fcent1/troe_Tsss[6] : 0.)
-      + (fabs(troe_Ts[6]) > 1.e-100 ? -Fcent2/troe_Ts[6] : 0.)
-      + (troe_len[6] == 4 ? Fcent3*troe_Tss[6]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -18328,7 +18690,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[20];
-    Kc = refCinv * exp(g_RT[1] + g_RT[19] - g_RT[20]);
+    Kc = Kc_s[6];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[20]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18346,95 +18708,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[6][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[19] -= dqdci;               /* dwdot[CH3O]/d[H2] */
-        J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[19];
-        J[37] -= dqdci;               /* dwdot[H]/d[H] */
-        J[55] -= dqdci;               /* dwdot[CH3O]/d[H] */
-        J[56] += dqdci;               /* dwdot[CH3OH]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[6][1] - 1)*dcdc_fac;
-        J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[199] -= dqdci;              /* dwdot[CH3O]/d[H2O] */
-        J[200] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[6][2] - 1)*dcdc_fac;
-        J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[487] -= dqdci;              /* dwdot[CH3O]/d[CH4] */
-        J[488] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[6][3] - 1)*dcdc_fac;
-        J[505] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[523] -= dqdci;              /* dwdot[CH3O]/d[CO] */
-        J[524] += dqdci;              /* dwdot[CH3OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[6][4] - 1)*dcdc_fac;
-        J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[559] -= dqdci;              /* dwdot[CH3O]/d[CO2] */
-        J[560] += dqdci;              /* dwdot[CH3OH]/d[CO2] */
-        /* d()/d[CH3O] */
-        dqdci =  + k_f*sc[1];
-        J[685] -= dqdci;              /* dwdot[H]/d[CH3O] */
-        J[703] -= dqdci;              /* dwdot[CH3O]/d[CH3O] */
-        J[704] += dqdci;              /* dwdot[CH3OH]/d[CH3O] */
-        /* d()/d[CH3OH] */
-        dqdci =  - k_r;
-        J[721] -= dqdci;              /* dwdot[H]/d[CH3OH] */
-        J[739] -= dqdci;              /* dwdot[CH3O]/d[CH3OH] */
-        J[740] += dqdci;              /* dwdot[CH3OH]/d[CH3OH] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[6][5] - 1)*dcdc_fac;
-        J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[955] -= dqdci;              /* dwdot[CH3O]/d[C2H6] */
-        J[956] += dqdci;              /* dwdot[CH3OH]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[6][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[19];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[6][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[6][2]*dcdc_fac;
-        dqdc[14] = TB[6][3]*dcdc_fac;
-        dqdc[15] = TB[6][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac + k_f*sc[1];
-        dqdc[20] = dcdc_fac - k_r;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[6][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+1] -= dqdc[k];
-            J[36*k+19] -= dqdc[k];
-            J[36*k+20] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[19] -= dcdc_fac;
+    Jmix[20] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[6][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[19] -= dqdci;               /* dwdot[CH3O]/d[H2] */
+    J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[19];
+    J[37] -= dqdci;               /* dwdot[H]/d[H] */
+    J[55] -= dqdci;               /* dwdot[CH3O]/d[H] */
+    J[56] += dqdci;               /* dwdot[CH3OH]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[6][1] - 1)*dcdc_fac;
+    J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[199] -= dqdci;              /* dwdot[CH3O]/d[H2O] */
+    J[200] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[6][2] - 1)*dcdc_fac;
+    J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[487] -= dqdci;              /* dwdot[CH3O]/d[CH4] */
+    J[488] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[6][3] - 1)*dcdc_fac;
+    J[505] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[523] -= dqdci;              /* dwdot[CH3O]/d[CO] */
+    J[524] += dqdci;              /* dwdot[CH3OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[6][4] - 1)*dcdc_fac;
+    J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[559] -= dqdci;              /* dwdot[CH3O]/d[CO2] */
+    J[560] += dqdci;              /* dwdot[CH3OH]/d[CO2] */
+    /* d()/d[CH3O] */
+    dqdci =  + k_f*sc[1];
+    J[685] -= dqdci;              /* dwdot[H]/d[CH3O] */
+    J[703] -= dqdci;              /* dwdot[CH3O]/d[CH3O] */
+    J[704] += dqdci;              /* dwdot[CH3OH]/d[CH3O] */
+    /* d()/d[CH3OH] */
+    dqdci =  - k_r;
+    J[721] -= dqdci;              /* dwdot[H]/d[CH3OH] */
+    J[739] -= dqdci;              /* dwdot[CH3O]/d[CH3OH] */
+    J[740] += dqdci;              /* dwdot[CH3OH]/d[CH3OH] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[6][5] - 1)*dcdc_fac;
+    J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[955] -= dqdci;              /* dwdot[CH3O]/d[C2H6] */
+    J[956] += dqdci;              /* dwdot[CH3OH]/d[C2H6] */
     J[1261] -= dqdT; /* dwdot[H]/dT */
     J[1279] -= dqdT; /* dwdot[CH3O]/dT */
     J[1280] += dqdT; /* dwdot[CH3OH]/dT */
@@ -18443,11 +18765,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[7][0] - 1)*sc[0] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[13] + (TB[7][3] - 1)*sc[14] + (TB[7][4] - 1)*sc[15] + (TB[7][5] - 1)*sc[26];
+    alpha = (memcmp(TB[7], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[7][0] - 1)*sc[0] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[13] + (TB[7][3] - 1)*sc[14] + (TB[7][4] - 1)*sc[15] + (TB[7][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[1]*sc[21];
-    k_f = prefactor_units[7] * fwd_A[7]
-                * exp(fwd_beta[7] * tc[0] - activation_units[7] * fwd_Ea[7] * invT);
+    k_f = k_f_s[7];
     dlnkfdT = fwd_beta[7] * invT + activation_units[7] * fwd_Ea[7] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[7] * exp(low_beta[7] * tc[0] - activation_units[7] * low_Ea[7] * invT);
@@ -18463,16 +18784,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[7] == 4 ? exp(-troe_Tss[7] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[7]) > 1.e-100 ? -Fcent1/troe_Tsss[7] : 0.)
+      + (fabs(troe_Ts[7]) > 1.e-100 ? -Fcent2/troe_Ts[7] : 0.)
+      + (troe_len[7] == 4 ? Fcent3*troe_Tss[7]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[7]) > 1.e-100 ? -Fcent1/troe_Tsss[7] : 0.)
-      + (fabs(troe_Ts[7]) > 1.e-100 ? -Fcent2/troe_Ts[7] : 0.)
-      + (troe_len[7] == 4 ? Fcent3*troe_Tss[7]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -18480,7 +18801,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[22];
-    Kc = refCinv * exp(g_RT[1] + g_RT[21] - g_RT[22]);
+    Kc = Kc_s[7];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[21]) + (h_RT[22]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18498,95 +18819,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[7][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[21] -= dqdci;               /* dwdot[C2H]/d[H2] */
-        J[22] += dqdci;               /* dwdot[C2H2]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[21];
-        J[37] -= dqdci;               /* dwdot[H]/d[H] */
-        J[57] -= dqdci;               /* dwdot[C2H]/d[H] */
-        J[58] += dqdci;               /* dwdot[C2H2]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[7][1] - 1)*dcdc_fac;
-        J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[201] -= dqdci;              /* dwdot[C2H]/d[H2O] */
-        J[202] += dqdci;              /* dwdot[C2H2]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[7][2] - 1)*dcdc_fac;
-        J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[489] -= dqdci;              /* dwdot[C2H]/d[CH4] */
-        J[490] += dqdci;              /* dwdot[C2H2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[7][3] - 1)*dcdc_fac;
-        J[505] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[525] -= dqdci;              /* dwdot[C2H]/d[CO] */
-        J[526] += dqdci;              /* dwdot[C2H2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[7][4] - 1)*dcdc_fac;
-        J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[561] -= dqdci;              /* dwdot[C2H]/d[CO2] */
-        J[562] += dqdci;              /* dwdot[C2H2]/d[CO2] */
-        /* d()/d[C2H] */
-        dqdci =  + k_f*sc[1];
-        J[757] -= dqdci;              /* dwdot[H]/d[C2H] */
-        J[777] -= dqdci;              /* dwdot[C2H]/d[C2H] */
-        J[778] += dqdci;              /* dwdot[C2H2]/d[C2H] */
-        /* d()/d[C2H2] */
-        dqdci =  - k_r;
-        J[793] -= dqdci;              /* dwdot[H]/d[C2H2] */
-        J[813] -= dqdci;              /* dwdot[C2H]/d[C2H2] */
-        J[814] += dqdci;              /* dwdot[C2H2]/d[C2H2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[7][5] - 1)*dcdc_fac;
-        J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[957] -= dqdci;              /* dwdot[C2H]/d[C2H6] */
-        J[958] += dqdci;              /* dwdot[C2H2]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[7][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[21];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[7][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[7][2]*dcdc_fac;
-        dqdc[14] = TB[7][3]*dcdc_fac;
-        dqdc[15] = TB[7][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac + k_f*sc[1];
-        dqdc[22] = dcdc_fac - k_r;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[7][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+1] -= dqdc[k];
-            J[36*k+21] -= dqdc[k];
-            J[36*k+22] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[21] -= dcdc_fac;
+    Jmix[22] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[7][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[21] -= dqdci;               /* dwdot[C2H]/d[H2] */
+    J[22] += dqdci;               /* dwdot[C2H2]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[21];
+    J[37] -= dqdci;               /* dwdot[H]/d[H] */
+    J[57] -= dqdci;               /* dwdot[C2H]/d[H] */
+    J[58] += dqdci;               /* dwdot[C2H2]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[7][1] - 1)*dcdc_fac;
+    J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[201] -= dqdci;              /* dwdot[C2H]/d[H2O] */
+    J[202] += dqdci;              /* dwdot[C2H2]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[7][2] - 1)*dcdc_fac;
+    J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[489] -= dqdci;              /* dwdot[C2H]/d[CH4] */
+    J[490] += dqdci;              /* dwdot[C2H2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[7][3] - 1)*dcdc_fac;
+    J[505] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[525] -= dqdci;              /* dwdot[C2H]/d[CO] */
+    J[526] += dqdci;              /* dwdot[C2H2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[7][4] - 1)*dcdc_fac;
+    J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[561] -= dqdci;              /* dwdot[C2H]/d[CO2] */
+    J[562] += dqdci;              /* dwdot[C2H2]/d[CO2] */
+    /* d()/d[C2H] */
+    dqdci =  + k_f*sc[1];
+    J[757] -= dqdci;              /* dwdot[H]/d[C2H] */
+    J[777] -= dqdci;              /* dwdot[C2H]/d[C2H] */
+    J[778] += dqdci;              /* dwdot[C2H2]/d[C2H] */
+    /* d()/d[C2H2] */
+    dqdci =  - k_r;
+    J[793] -= dqdci;              /* dwdot[H]/d[C2H2] */
+    J[813] -= dqdci;              /* dwdot[C2H]/d[C2H2] */
+    J[814] += dqdci;              /* dwdot[C2H2]/d[C2H2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[7][5] - 1)*dcdc_fac;
+    J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[957] -= dqdci;              /* dwdot[C2H]/d[C2H6] */
+    J[958] += dqdci;              /* dwdot[C2H2]/d[C2H6] */
     J[1261] -= dqdT; /* dwdot[H]/dT */
     J[1281] -= dqdT; /* dwdot[C2H]/dT */
     J[1282] += dqdT; /* dwdot[C2H2]/dT */
@@ -18595,11 +18876,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[8][0] - 1)*sc[0] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[13] + (TB[8][3] - 1)*sc[14] + (TB[8][4] - 1)*sc[15] + (TB[8][5] - 1)*sc[26];
+    alpha = (memcmp(TB[8], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[8][0] - 1)*sc[0] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[13] + (TB[8][3] - 1)*sc[14] + (TB[8][4] - 1)*sc[15] + (TB[8][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[1]*sc[22];
-    k_f = prefactor_units[8] * fwd_A[8]
-                * exp(fwd_beta[8] * tc[0] - activation_units[8] * fwd_Ea[8] * invT);
+    k_f = k_f_s[8];
     dlnkfdT = fwd_beta[8] * invT + activation_units[8] * fwd_Ea[8] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[8] * exp(low_beta[8] * tc[0] - activation_units[8] * low_Ea[8] * invT);
@@ -18615,16 +18895,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[8] == 4 ? exp(-troe_Tss[8] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[8]) > 1.e-100 ? -Fcent1/troe_Tsss[8] : 0.)
+      + (fabs(troe_Ts[8]) > 1.e-100 ? -Fcent2/troe_Ts[8] : 0.)
+      + (troe_len[8] == 4 ? Fcent3*troe_Tss[8]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[8]) > 1.e-100 ? -Fcent1/troe_Tsss[8] : 0.)
-      + (fabs(troe_Ts[8]) > 1.e-100 ? -Fcent2/troe_Ts[8] : 0.)
-      + (troe_len[8] == 4 ? Fcent3*troe_Tss[8]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -18632,7 +18912,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[23];
-    Kc = refCinv * exp(g_RT[1] + g_RT[22] - g_RT[23]);
+    Kc = Kc_s[8];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[22]) + (h_RT[23]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18650,95 +18930,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[8][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[22] -= dqdci;               /* dwdot[C2H2]/d[H2] */
-        J[23] += dqdci;               /* dwdot[C2H3]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[22];
-        J[37] -= dqdci;               /* dwdot[H]/d[H] */
-        J[58] -= dqdci;               /* dwdot[C2H2]/d[H] */
-        J[59] += dqdci;               /* dwdot[C2H3]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[8][1] - 1)*dcdc_fac;
-        J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[202] -= dqdci;              /* dwdot[C2H2]/d[H2O] */
-        J[203] += dqdci;              /* dwdot[C2H3]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[8][2] - 1)*dcdc_fac;
-        J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[490] -= dqdci;              /* dwdot[C2H2]/d[CH4] */
-        J[491] += dqdci;              /* dwdot[C2H3]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[8][3] - 1)*dcdc_fac;
-        J[505] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[526] -= dqdci;              /* dwdot[C2H2]/d[CO] */
-        J[527] += dqdci;              /* dwdot[C2H3]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[8][4] - 1)*dcdc_fac;
-        J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[562] -= dqdci;              /* dwdot[C2H2]/d[CO2] */
-        J[563] += dqdci;              /* dwdot[C2H3]/d[CO2] */
-        /* d()/d[C2H2] */
-        dqdci =  + k_f*sc[1];
-        J[793] -= dqdci;              /* dwdot[H]/d[C2H2] */
-        J[814] -= dqdci;              /* dwdot[C2H2]/d[C2H2] */
-        J[815] += dqdci;              /* dwdot[C2H3]/d[C2H2] */
-        /* d()/d[C2H3] */
-        dqdci =  - k_r;
-        J[829] -= dqdci;              /* dwdot[H]/d[C2H3] */
-        J[850] -= dqdci;              /* dwdot[C2H2]/d[C2H3] */
-        J[851] += dqdci;              /* dwdot[C2H3]/d[C2H3] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[8][5] - 1)*dcdc_fac;
-        J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[958] -= dqdci;              /* dwdot[C2H2]/d[C2H6] */
-        J[959] += dqdci;              /* dwdot[C2H3]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[8][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[22];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[8][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[8][2]*dcdc_fac;
-        dqdc[14] = TB[8][3]*dcdc_fac;
-        dqdc[15] = TB[8][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac + k_f*sc[1];
-        dqdc[23] = dcdc_fac - k_r;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[8][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+1] -= dqdc[k];
-            J[36*k+22] -= dqdc[k];
-            J[36*k+23] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[22] -= dcdc_fac;
+    Jmix[23] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[8][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[22] -= dqdci;               /* dwdot[C2H2]/d[H2] */
+    J[23] += dqdci;               /* dwdot[C2H3]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[22];
+    J[37] -= dqdci;               /* dwdot[H]/d[H] */
+    J[58] -= dqdci;               /* dwdot[C2H2]/d[H] */
+    J[59] += dqdci;               /* dwdot[C2H3]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[8][1] - 1)*dcdc_fac;
+    J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[202] -= dqdci;              /* dwdot[C2H2]/d[H2O] */
+    J[203] += dqdci;              /* dwdot[C2H3]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[8][2] - 1)*dcdc_fac;
+    J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[490] -= dqdci;              /* dwdot[C2H2]/d[CH4] */
+    J[491] += dqdci;              /* dwdot[C2H3]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[8][3] - 1)*dcdc_fac;
+    J[505] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[526] -= dqdci;              /* dwdot[C2H2]/d[CO] */
+    J[527] += dqdci;              /* dwdot[C2H3]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[8][4] - 1)*dcdc_fac;
+    J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[562] -= dqdci;              /* dwdot[C2H2]/d[CO2] */
+    J[563] += dqdci;              /* dwdot[C2H3]/d[CO2] */
+    /* d()/d[C2H2] */
+    dqdci =  + k_f*sc[1];
+    J[793] -= dqdci;              /* dwdot[H]/d[C2H2] */
+    J[814] -= dqdci;              /* dwdot[C2H2]/d[C2H2] */
+    J[815] += dqdci;              /* dwdot[C2H3]/d[C2H2] */
+    /* d()/d[C2H3] */
+    dqdci =  - k_r;
+    J[829] -= dqdci;              /* dwdot[H]/d[C2H3] */
+    J[850] -= dqdci;              /* dwdot[C2H2]/d[C2H3] */
+    J[851] += dqdci;              /* dwdot[C2H3]/d[C2H3] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[8][5] - 1)*dcdc_fac;
+    J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[958] -= dqdci;              /* dwdot[C2H2]/d[C2H6] */
+    J[959] += dqdci;              /* dwdot[C2H3]/d[C2H6] */
     J[1261] -= dqdT; /* dwdot[H]/dT */
     J[1282] -= dqdT; /* dwdot[C2H2]/dT */
     J[1283] += dqdT; /* dwdot[C2H3]/dT */
@@ -18747,11 +18987,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[9][0] - 1)*sc[0] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[13] + (TB[9][3] - 1)*sc[14] + (TB[9][4] - 1)*sc[15] + (TB[9][5] - 1)*sc[26];
+    alpha = (memcmp(TB[9], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[9][0] - 1)*sc[0] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[13] + (TB[9][3] - 1)*sc[14] + (TB[9][4] - 1)*sc[15] + (TB[9][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[1]*sc[23];
-    k_f = prefactor_units[9] * fwd_A[9]
-                * exp(fwd_beta[9] * tc[0] - activation_units[9] * fwd_Ea[9] * invT);
+    k_f = k_f_s[9];
     dlnkfdT = fwd_beta[9] * invT + activation_units[9] * fwd_Ea[9] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[9] * exp(low_beta[9] * tc[0] - activation_units[9] * low_Ea[9] * invT);
@@ -18767,16 +19006,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[9] == 4 ? exp(-troe_Tss[9] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[9]) > 1.e-100 ? -Fcent1/troe_Tsss[9] : 0.)
+      + (fabs(troe_Ts[9]) > 1.e-100 ? -Fcent2/troe_Ts[9] : 0.)
+      + (troe_len[9] == 4 ? Fcent3*troe_Tss[9]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[9]) > 1.e-100 ? -Fcent1/troe_Tsss[9] : 0.)
-      + (fabs(troe_Ts[9]) > 1.e-100 ? -Fcent2/troe_Ts[9] : 0.)
-      + (troe_len[9] == 4 ? Fcent3*troe_Tss[9]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -18784,7 +19023,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[24];
-    Kc = refCinv * exp(g_RT[1] + g_RT[23] - g_RT[24]);
+    Kc = Kc_s[9];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[23]) + (h_RT[24]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18802,95 +19041,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[9][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[23] -= dqdci;               /* dwdot[C2H3]/d[H2] */
-        J[24] += dqdci;               /* dwdot[C2H4]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[23];
-        J[37] -= dqdci;               /* dwdot[H]/d[H] */
-        J[59] -= dqdci;               /* dwdot[C2H3]/d[H] */
-        J[60] += dqdci;               /* dwdot[C2H4]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[9][1] - 1)*dcdc_fac;
-        J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[203] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
-        J[204] += dqdci;              /* dwdot[C2H4]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[9][2] - 1)*dcdc_fac;
-        J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[491] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
-        J[492] += dqdci;              /* dwdot[C2H4]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[9][3] - 1)*dcdc_fac;
-        J[505] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[527] -= dqdci;              /* dwdot[C2H3]/d[CO] */
-        J[528] += dqdci;              /* dwdot[C2H4]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[9][4] - 1)*dcdc_fac;
-        J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[563] -= dqdci;              /* dwdot[C2H3]/d[CO2] */
-        J[564] += dqdci;              /* dwdot[C2H4]/d[CO2] */
-        /* d()/d[C2H3] */
-        dqdci =  + k_f*sc[1];
-        J[829] -= dqdci;              /* dwdot[H]/d[C2H3] */
-        J[851] -= dqdci;              /* dwdot[C2H3]/d[C2H3] */
-        J[852] += dqdci;              /* dwdot[C2H4]/d[C2H3] */
-        /* d()/d[C2H4] */
-        dqdci =  - k_r;
-        J[865] -= dqdci;              /* dwdot[H]/d[C2H4] */
-        J[887] -= dqdci;              /* dwdot[C2H3]/d[C2H4] */
-        J[888] += dqdci;              /* dwdot[C2H4]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[9][5] - 1)*dcdc_fac;
-        J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[959] -= dqdci;              /* dwdot[C2H3]/d[C2H6] */
-        J[960] += dqdci;              /* dwdot[C2H4]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[9][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[23];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[9][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[9][2]*dcdc_fac;
-        dqdc[14] = TB[9][3]*dcdc_fac;
-        dqdc[15] = TB[9][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac + k_f*sc[1];
-        dqdc[24] = dcdc_fac - k_r;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[9][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+1] -= dqdc[k];
-            J[36*k+23] -= dqdc[k];
-            J[36*k+24] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[23] -= dcdc_fac;
+    Jmix[24] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[9][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[23] -= dqdci;               /* dwdot[C2H3]/d[H2] */
+    J[24] += dqdci;               /* dwdot[C2H4]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[23];
+    J[37] -= dqdci;               /* dwdot[H]/d[H] */
+    J[59] -= dqdci;               /* dwdot[C2H3]/d[H] */
+    J[60] += dqdci;               /* dwdot[C2H4]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[9][1] - 1)*dcdc_fac;
+    J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[203] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
+    J[204] += dqdci;              /* dwdot[C2H4]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[9][2] - 1)*dcdc_fac;
+    J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[491] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
+    J[492] += dqdci;              /* dwdot[C2H4]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[9][3] - 1)*dcdc_fac;
+    J[505] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[527] -= dqdci;              /* dwdot[C2H3]/d[CO] */
+    J[528] += dqdci;              /* dwdot[C2H4]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[9][4] - 1)*dcdc_fac;
+    J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[563] -= dqdci;              /* dwdot[C2H3]/d[CO2] */
+    J[564] += dqdci;              /* dwdot[C2H4]/d[CO2] */
+    /* d()/d[C2H3] */
+    dqdci =  + k_f*sc[1];
+    J[829] -= dqdci;              /* dwdot[H]/d[C2H3] */
+    J[851] -= dqdci;              /* dwdot[C2H3]/d[C2H3] */
+    J[852] += dqdci;              /* dwdot[C2H4]/d[C2H3] */
+    /* d()/d[C2H4] */
+    dqdci =  - k_r;
+    J[865] -= dqdci;              /* dwdot[H]/d[C2H4] */
+    J[887] -= dqdci;              /* dwdot[C2H3]/d[C2H4] */
+    J[888] += dqdci;              /* dwdot[C2H4]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[9][5] - 1)*dcdc_fac;
+    J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[959] -= dqdci;              /* dwdot[C2H3]/d[C2H6] */
+    J[960] += dqdci;              /* dwdot[C2H4]/d[C2H6] */
     J[1261] -= dqdT; /* dwdot[H]/dT */
     J[1283] -= dqdT; /* dwdot[C2H3]/dT */
     J[1284] += dqdT; /* dwdot[C2H4]/dT */
@@ -18899,11 +19098,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[10][0] - 1)*sc[0] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[13] + (TB[10][3] - 1)*sc[14] + (TB[10][4] - 1)*sc[15] + (TB[10][5] - 1)*sc[26];
+    alpha = (memcmp(TB[10], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[10][0] - 1)*sc[0] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[13] + (TB[10][3] - 1)*sc[14] + (TB[10][4] - 1)*sc[15] + (TB[10][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[1]*sc[24];
-    k_f = prefactor_units[10] * fwd_A[10]
-                * exp(fwd_beta[10] * tc[0] - activation_units[10] * fwd_Ea[10] * invT);
+    k_f = k_f_s[10];
     dlnkfdT = fwd_beta[10] * invT + activation_units[10] * fwd_Ea[10] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[10] * exp(low_beta[10] * tc[0] - activation_units[10] * low_Ea[10] * invT);
@@ -18919,16 +19117,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[10] == 4 ? exp(-troe_Tss[10] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[10]) > 1.e-100 ? -Fcent1/troe_Tsss[10] : 0.)
+      + (fabs(troe_Ts[10]) > 1.e-100 ? -Fcent2/troe_Ts[10] : 0.)
+      + (troe_len[10] == 4 ? Fcent3*troe_Tss[10]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[10]) > 1.e-100 ? -Fcent1/troe_Tsss[10] : 0.)
-      + (fabs(troe_Ts[10]) > 1.e-100 ? -Fcent2/troe_Ts[10] : 0.)
-      + (troe_len[10] == 4 ? Fcent3*troe_Tss[10]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -18936,7 +19134,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[25];
-    Kc = refCinv * exp(g_RT[1] + g_RT[24] - g_RT[25]);
+    Kc = Kc_s[10];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[24]) + (h_RT[25]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18954,95 +19152,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[10][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[24] -= dqdci;               /* dwdot[C2H4]/d[H2] */
-        J[25] += dqdci;               /* dwdot[C2H5]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[24];
-        J[37] -= dqdci;               /* dwdot[H]/d[H] */
-        J[60] -= dqdci;               /* dwdot[C2H4]/d[H] */
-        J[61] += dqdci;               /* dwdot[C2H5]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[10][1] - 1)*dcdc_fac;
-        J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[204] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
-        J[205] += dqdci;              /* dwdot[C2H5]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[10][2] - 1)*dcdc_fac;
-        J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[492] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
-        J[493] += dqdci;              /* dwdot[C2H5]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[10][3] - 1)*dcdc_fac;
-        J[505] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[528] -= dqdci;              /* dwdot[C2H4]/d[CO] */
-        J[529] += dqdci;              /* dwdot[C2H5]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[10][4] - 1)*dcdc_fac;
-        J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[564] -= dqdci;              /* dwdot[C2H4]/d[CO2] */
-        J[565] += dqdci;              /* dwdot[C2H5]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci =  + k_f*sc[1];
-        J[865] -= dqdci;              /* dwdot[H]/d[C2H4] */
-        J[888] -= dqdci;              /* dwdot[C2H4]/d[C2H4] */
-        J[889] += dqdci;              /* dwdot[C2H5]/d[C2H4] */
-        /* d()/d[C2H5] */
-        dqdci =  - k_r;
-        J[901] -= dqdci;              /* dwdot[H]/d[C2H5] */
-        J[924] -= dqdci;              /* dwdot[C2H4]/d[C2H5] */
-        J[925] += dqdci;              /* dwdot[C2H5]/d[C2H5] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[10][5] - 1)*dcdc_fac;
-        J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[960] -= dqdci;              /* dwdot[C2H4]/d[C2H6] */
-        J[961] += dqdci;              /* dwdot[C2H5]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[10][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[24];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[10][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[10][2]*dcdc_fac;
-        dqdc[14] = TB[10][3]*dcdc_fac;
-        dqdc[15] = TB[10][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac + k_f*sc[1];
-        dqdc[25] = dcdc_fac - k_r;
-        dqdc[26] = TB[10][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+1] -= dqdc[k];
-            J[36*k+24] -= dqdc[k];
-            J[36*k+25] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[24] -= dcdc_fac;
+    Jmix[25] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[10][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[24] -= dqdci;               /* dwdot[C2H4]/d[H2] */
+    J[25] += dqdci;               /* dwdot[C2H5]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[24];
+    J[37] -= dqdci;               /* dwdot[H]/d[H] */
+    J[60] -= dqdci;               /* dwdot[C2H4]/d[H] */
+    J[61] += dqdci;               /* dwdot[C2H5]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[10][1] - 1)*dcdc_fac;
+    J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[204] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
+    J[205] += dqdci;              /* dwdot[C2H5]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[10][2] - 1)*dcdc_fac;
+    J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[492] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
+    J[493] += dqdci;              /* dwdot[C2H5]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[10][3] - 1)*dcdc_fac;
+    J[505] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[528] -= dqdci;              /* dwdot[C2H4]/d[CO] */
+    J[529] += dqdci;              /* dwdot[C2H5]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[10][4] - 1)*dcdc_fac;
+    J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[564] -= dqdci;              /* dwdot[C2H4]/d[CO2] */
+    J[565] += dqdci;              /* dwdot[C2H5]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci =  + k_f*sc[1];
+    J[865] -= dqdci;              /* dwdot[H]/d[C2H4] */
+    J[888] -= dqdci;              /* dwdot[C2H4]/d[C2H4] */
+    J[889] += dqdci;              /* dwdot[C2H5]/d[C2H4] */
+    /* d()/d[C2H5] */
+    dqdci =  - k_r;
+    J[901] -= dqdci;              /* dwdot[H]/d[C2H5] */
+    J[924] -= dqdci;              /* dwdot[C2H4]/d[C2H5] */
+    J[925] += dqdci;              /* dwdot[C2H5]/d[C2H5] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[10][5] - 1)*dcdc_fac;
+    J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[960] -= dqdci;              /* dwdot[C2H4]/d[C2H6] */
+    J[961] += dqdci;              /* dwdot[C2H5]/d[C2H6] */
     J[1261] -= dqdT; /* dwdot[H]/dT */
     J[1284] -= dqdT; /* dwdot[C2H4]/dT */
     J[1285] += dqdT; /* dwdot[C2H5]/dT */
@@ -19051,11 +19209,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[11][0] - 1)*sc[0] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[13] + (TB[11][3] - 1)*sc[14] + (TB[11][4] - 1)*sc[15] + (TB[11][5] - 1)*sc[26];
+    alpha = (memcmp(TB[11], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[11][0] - 1)*sc[0] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[13] + (TB[11][3] - 1)*sc[14] + (TB[11][4] - 1)*sc[15] + (TB[11][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[1]*sc[25];
-    k_f = prefactor_units[11] * fwd_A[11]
-                * exp(fwd_beta[11] * tc[0] - activation_units[11] * fwd_Ea[11] * invT);
+    k_f = k_f_s[11];
     dlnkfdT = fwd_beta[11] * invT + activation_units[11] * fwd_Ea[11] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[11] * exp(low_beta[11] * tc[0] - activation_units[11] * low_Ea[11] * invT);
@@ -19071,16 +19228,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[11] == 4 ? exp(-troe_Tss[11] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[11]) > 1.e-100 ? -Fcent1/troe_Tsss[11] : 0.)
+      + (fabs(troe_Ts[11]) > 1.e-100 ? -Fcent2/troe_Ts[11] : 0.)
+      + (troe_len[11] == 4 ? Fcent3*troe_Tss[11]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[11]) > 1.e-100 ? -Fcent1/troe_Tsss[11] : 0.)
-      + (fabs(troe_Ts[11]) > 1.e-100 ? -Fcent2/troe_Ts[11] : 0.)
-      + (troe_len[11] == 4 ? Fcent3*troe_Tss[11]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -19088,7 +19245,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[26];
-    Kc = refCinv * exp(g_RT[1] + g_RT[25] - g_RT[26]);
+    Kc = Kc_s[11];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[25]) + (h_RT[26]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19106,90 +19263,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[11][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[25] -= dqdci;               /* dwdot[C2H5]/d[H2] */
-        J[26] += dqdci;               /* dwdot[C2H6]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[25];
-        J[37] -= dqdci;               /* dwdot[H]/d[H] */
-        J[61] -= dqdci;               /* dwdot[C2H5]/d[H] */
-        J[62] += dqdci;               /* dwdot[C2H6]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[11][1] - 1)*dcdc_fac;
-        J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[205] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
-        J[206] += dqdci;              /* dwdot[C2H6]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[11][2] - 1)*dcdc_fac;
-        J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[493] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
-        J[494] += dqdci;              /* dwdot[C2H6]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[11][3] - 1)*dcdc_fac;
-        J[505] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[529] -= dqdci;              /* dwdot[C2H5]/d[CO] */
-        J[530] += dqdci;              /* dwdot[C2H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[11][4] - 1)*dcdc_fac;
-        J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[565] -= dqdci;              /* dwdot[C2H5]/d[CO2] */
-        J[566] += dqdci;              /* dwdot[C2H6]/d[CO2] */
-        /* d()/d[C2H5] */
-        dqdci =  + k_f*sc[1];
-        J[901] -= dqdci;              /* dwdot[H]/d[C2H5] */
-        J[925] -= dqdci;              /* dwdot[C2H5]/d[C2H5] */
-        J[926] += dqdci;              /* dwdot[C2H6]/d[C2H5] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[11][5] - 1)*dcdc_fac - k_r;
-        J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[961] -= dqdci;              /* dwdot[C2H5]/d[C2H6] */
-        J[962] += dqdci;              /* dwdot[C2H6]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[11][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[25];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[11][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[11][2]*dcdc_fac;
-        dqdc[14] = TB[11][3]*dcdc_fac;
-        dqdc[15] = TB[11][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac + k_f*sc[1];
-        dqdc[26] = TB[11][5]*dcdc_fac - k_r;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+1] -= dqdc[k];
-            J[36*k+25] -= dqdc[k];
-            J[36*k+26] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[25] -= dcdc_fac;
+    Jmix[26] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[11][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[25] -= dqdci;               /* dwdot[C2H5]/d[H2] */
+    J[26] += dqdci;               /* dwdot[C2H6]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[25];
+    J[37] -= dqdci;               /* dwdot[H]/d[H] */
+    J[61] -= dqdci;               /* dwdot[C2H5]/d[H] */
+    J[62] += dqdci;               /* dwdot[C2H6]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[11][1] - 1)*dcdc_fac;
+    J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[205] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
+    J[206] += dqdci;              /* dwdot[C2H6]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[11][2] - 1)*dcdc_fac;
+    J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[493] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
+    J[494] += dqdci;              /* dwdot[C2H6]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[11][3] - 1)*dcdc_fac;
+    J[505] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[529] -= dqdci;              /* dwdot[C2H5]/d[CO] */
+    J[530] += dqdci;              /* dwdot[C2H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[11][4] - 1)*dcdc_fac;
+    J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[565] -= dqdci;              /* dwdot[C2H5]/d[CO2] */
+    J[566] += dqdci;              /* dwdot[C2H6]/d[CO2] */
+    /* d()/d[C2H5] */
+    dqdci =  + k_f*sc[1];
+    J[901] -= dqdci;              /* dwdot[H]/d[C2H5] */
+    J[925] -= dqdci;              /* dwdot[C2H5]/d[C2H5] */
+    J[926] += dqdci;              /* dwdot[C2H6]/d[C2H5] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[11][5] - 1)*dcdc_fac - k_r;
+    J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[961] -= dqdci;              /* dwdot[C2H5]/d[C2H6] */
+    J[962] += dqdci;              /* dwdot[C2H6]/d[C2H6] */
     J[1261] -= dqdT; /* dwdot[H]/dT */
     J[1285] -= dqdT; /* dwdot[C2H5]/dT */
     J[1286] += dqdT; /* dwdot[C2H6]/dT */
@@ -19198,11 +19315,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[12][0] - 1)*sc[0] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[13] + (TB[12][3] - 1)*sc[14] + (TB[12][4] - 1)*sc[15] + (TB[12][5] - 1)*sc[26];
+    alpha = (memcmp(TB[12], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[12][0] - 1)*sc[0] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[13] + (TB[12][3] - 1)*sc[14] + (TB[12][4] - 1)*sc[15] + (TB[12][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[0]*sc[14];
-    k_f = prefactor_units[12] * fwd_A[12]
-                * exp(fwd_beta[12] * tc[0] - activation_units[12] * fwd_Ea[12] * invT);
+    k_f = k_f_s[12];
     dlnkfdT = fwd_beta[12] * invT + activation_units[12] * fwd_Ea[12] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[12] * exp(low_beta[12] * tc[0] - activation_units[12] * low_Ea[12] * invT);
@@ -19218,16 +19334,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[12] == 4 ? exp(-troe_Tss[12] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[12]) > 1.e-100 ? -Fcent1/troe_Tsss[12] : 0.)
+      + (fabs(troe_Ts[12]) > 1.e-100 ? -Fcent2/troe_Ts[12] : 0.)
+      + (troe_len[12] == 4 ? Fcent3*troe_Tss[12]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[12]) > 1.e-100 ? -Fcent1/troe_Tsss[12] : 0.)
-      + (fabs(troe_Ts[12]) > 1.e-100 ? -Fcent2/troe_Ts[12] : 0.)
-      + (troe_len[12] == 4 ? Fcent3*troe_Tss[12]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -19235,7 +19351,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[17];
-    Kc = refCinv * exp(g_RT[0] + g_RT[14] - g_RT[17]);
+    Kc = Kc_s[12];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[14]) + (h_RT[17]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19253,85 +19369,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[12][0] - 1)*dcdc_fac + k_f*sc[14];
-        J[0] -= dqdci;                /* dwdot[H2]/d[H2] */
-        J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
-        J[17] += dqdci;               /* dwdot[CH2O]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[12][1] - 1)*dcdc_fac;
-        J[180] -= dqdci;              /* dwdot[H2]/d[H2O] */
-        J[194] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[197] += dqdci;              /* dwdot[CH2O]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[12][2] - 1)*dcdc_fac;
-        J[468] -= dqdci;              /* dwdot[H2]/d[CH4] */
-        J[482] -= dqdci;              /* dwdot[CO]/d[CH4] */
-        J[485] += dqdci;              /* dwdot[CH2O]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[12][3] - 1)*dcdc_fac + k_f*sc[0];
-        J[504] -= dqdci;              /* dwdot[H2]/d[CO] */
-        J[518] -= dqdci;              /* dwdot[CO]/d[CO] */
-        J[521] += dqdci;              /* dwdot[CH2O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[12][4] - 1)*dcdc_fac;
-        J[540] -= dqdci;              /* dwdot[H2]/d[CO2] */
-        J[554] -= dqdci;              /* dwdot[CO]/d[CO2] */
-        J[557] += dqdci;              /* dwdot[CH2O]/d[CO2] */
-        /* d()/d[CH2O] */
-        dqdci =  - k_r;
-        J[612] -= dqdci;              /* dwdot[H2]/d[CH2O] */
-        J[626] -= dqdci;              /* dwdot[CO]/d[CH2O] */
-        J[629] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[12][5] - 1)*dcdc_fac;
-        J[936] -= dqdci;              /* dwdot[H2]/d[C2H6] */
-        J[950] -= dqdci;              /* dwdot[CO]/d[C2H6] */
-        J[953] += dqdci;              /* dwdot[CH2O]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[12][0]*dcdc_fac + k_f*sc[14];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[12][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[12][2]*dcdc_fac;
-        dqdc[14] = TB[12][3]*dcdc_fac + k_f*sc[0];
-        dqdc[15] = TB[12][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac - k_r;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[12][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+0] -= dqdc[k];
-            J[36*k+14] -= dqdc[k];
-            J[36*k+17] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[14] -= dcdc_fac;
+    Jmix[17] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[12][0] - 1)*dcdc_fac + k_f*sc[14];
+    J[0] -= dqdci;                /* dwdot[H2]/d[H2] */
+    J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
+    J[17] += dqdci;               /* dwdot[CH2O]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[12][1] - 1)*dcdc_fac;
+    J[180] -= dqdci;              /* dwdot[H2]/d[H2O] */
+    J[194] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[197] += dqdci;              /* dwdot[CH2O]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[12][2] - 1)*dcdc_fac;
+    J[468] -= dqdci;              /* dwdot[H2]/d[CH4] */
+    J[482] -= dqdci;              /* dwdot[CO]/d[CH4] */
+    J[485] += dqdci;              /* dwdot[CH2O]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[12][3] - 1)*dcdc_fac + k_f*sc[0];
+    J[504] -= dqdci;              /* dwdot[H2]/d[CO] */
+    J[518] -= dqdci;              /* dwdot[CO]/d[CO] */
+    J[521] += dqdci;              /* dwdot[CH2O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[12][4] - 1)*dcdc_fac;
+    J[540] -= dqdci;              /* dwdot[H2]/d[CO2] */
+    J[554] -= dqdci;              /* dwdot[CO]/d[CO2] */
+    J[557] += dqdci;              /* dwdot[CH2O]/d[CO2] */
+    /* d()/d[CH2O] */
+    dqdci =  - k_r;
+    J[612] -= dqdci;              /* dwdot[H2]/d[CH2O] */
+    J[626] -= dqdci;              /* dwdot[CO]/d[CH2O] */
+    J[629] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[12][5] - 1)*dcdc_fac;
+    J[936] -= dqdci;              /* dwdot[H2]/d[C2H6] */
+    J[950] -= dqdci;              /* dwdot[CO]/d[C2H6] */
+    J[953] += dqdci;              /* dwdot[CH2O]/d[C2H6] */
     J[1260] -= dqdT; /* dwdot[H2]/dT */
     J[1274] -= dqdT; /* dwdot[CO]/dT */
     J[1277] += dqdT; /* dwdot[CH2O]/dT */
@@ -19340,11 +19416,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[13][0] - 1)*sc[0] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[13] + (TB[13][3] - 1)*sc[14] + (TB[13][4] - 1)*sc[15] + (TB[13][5] - 1)*sc[26];
+    alpha = (memcmp(TB[13], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[13][0] - 1)*sc[0] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[13] + (TB[13][3] - 1)*sc[14] + (TB[13][4] - 1)*sc[15] + (TB[13][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[4]*sc[4];
-    k_f = prefactor_units[13] * fwd_A[13]
-                * exp(fwd_beta[13] * tc[0] - activation_units[13] * fwd_Ea[13] * invT);
+    k_f = k_f_s[13];
     dlnkfdT = fwd_beta[13] * invT + activation_units[13] * fwd_Ea[13] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[13] * exp(low_beta[13] * tc[0] - activation_units[13] * low_Ea[13] * invT);
@@ -19360,16 +19435,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[13] == 4 ? exp(-troe_Tss[13] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[13]) > 1.e-100 ? -Fcent1/troe_Tsss[13] : 0.)
+      + (fabs(troe_Ts[13]) > 1.e-100 ? -Fcent2/troe_Ts[13] : 0.)
+      + (troe_len[13] == 4 ? Fcent3*troe_Tss[13]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[13]) > 1.e-100 ? -Fcent1/troe_Tsss[13] : 0.)
-      + (fabs(troe_Ts[13]) > 1.e-100 ? -Fcent2/troe_Ts[13] : 0.)
-      + (troe_len[13] == 4 ? Fcent3*troe_Tss[13]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -19377,7 +19452,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[7];
-    Kc = refCinv * exp(2*g_RT[4] - g_RT[7]);
+    Kc = Kc_s[13];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[4]) + (h_RT[7]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19394,81 +19469,41 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[13][0] - 1)*dcdc_fac;
-        J[4] += -2 * dqdci;           /* dwdot[OH]/d[H2] */
-        J[7] += dqdci;                /* dwdot[H2O2]/d[H2] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*2*sc[4];
-        J[148] += -2 * dqdci;         /* dwdot[OH]/d[OH] */
-        J[151] += dqdci;              /* dwdot[H2O2]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[13][1] - 1)*dcdc_fac;
-        J[184] += -2 * dqdci;         /* dwdot[OH]/d[H2O] */
-        J[187] += dqdci;              /* dwdot[H2O2]/d[H2O] */
-        /* d()/d[H2O2] */
-        dqdci =  - k_r;
-        J[256] += -2 * dqdci;         /* dwdot[OH]/d[H2O2] */
-        J[259] += dqdci;              /* dwdot[H2O2]/d[H2O2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[13][2] - 1)*dcdc_fac;
-        J[472] += -2 * dqdci;         /* dwdot[OH]/d[CH4] */
-        J[475] += dqdci;              /* dwdot[H2O2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[13][3] - 1)*dcdc_fac;
-        J[508] += -2 * dqdci;         /* dwdot[OH]/d[CO] */
-        J[511] += dqdci;              /* dwdot[H2O2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[13][4] - 1)*dcdc_fac;
-        J[544] += -2 * dqdci;         /* dwdot[OH]/d[CO2] */
-        J[547] += dqdci;              /* dwdot[H2O2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[13][5] - 1)*dcdc_fac;
-        J[940] += -2 * dqdci;         /* dwdot[OH]/d[C2H6] */
-        J[943] += dqdci;              /* dwdot[H2O2]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[13][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac + k_f*2*sc[4];
-        dqdc[5] = TB[13][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac - k_r;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[13][2]*dcdc_fac;
-        dqdc[14] = TB[13][3]*dcdc_fac;
-        dqdc[15] = TB[13][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[13][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+4] += -2 * dqdc[k];
-            J[36*k+7] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[4] += -2 * dcdc_fac;
+    Jmix[7] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[13][0] - 1)*dcdc_fac;
+    J[4] += -2 * dqdci;           /* dwdot[OH]/d[H2] */
+    J[7] += dqdci;                /* dwdot[H2O2]/d[H2] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*2*sc[4];
+    J[148] += -2 * dqdci;         /* dwdot[OH]/d[OH] */
+    J[151] += dqdci;              /* dwdot[H2O2]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[13][1] - 1)*dcdc_fac;
+    J[184] += -2 * dqdci;         /* dwdot[OH]/d[H2O] */
+    J[187] += dqdci;              /* dwdot[H2O2]/d[H2O] */
+    /* d()/d[H2O2] */
+    dqdci =  - k_r;
+    J[256] += -2 * dqdci;         /* dwdot[OH]/d[H2O2] */
+    J[259] += dqdci;              /* dwdot[H2O2]/d[H2O2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[13][2] - 1)*dcdc_fac;
+    J[472] += -2 * dqdci;         /* dwdot[OH]/d[CH4] */
+    J[475] += dqdci;              /* dwdot[H2O2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[13][3] - 1)*dcdc_fac;
+    J[508] += -2 * dqdci;         /* dwdot[OH]/d[CO] */
+    J[511] += dqdci;              /* dwdot[H2O2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[13][4] - 1)*dcdc_fac;
+    J[544] += -2 * dqdci;         /* dwdot[OH]/d[CO2] */
+    J[547] += dqdci;              /* dwdot[H2O2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[13][5] - 1)*dcdc_fac;
+    J[940] += -2 * dqdci;         /* dwdot[OH]/d[C2H6] */
+    J[943] += dqdci;              /* dwdot[H2O2]/d[C2H6] */
     J[1264] += -2 * dqdT; /* dwdot[OH]/dT */
     J[1267] += dqdT; /* dwdot[H2O2]/dT */
 
@@ -19476,11 +19511,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[14][0] - 1)*sc[0] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[13] + (TB[14][3] - 1)*sc[14] + (TB[14][4] - 1)*sc[15] + (TB[14][5] - 1)*sc[26];
+    alpha = (memcmp(TB[14], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[14][0] - 1)*sc[0] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[13] + (TB[14][3] - 1)*sc[14] + (TB[14][4] - 1)*sc[15] + (TB[14][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[4]*sc[12];
-    k_f = prefactor_units[14] * fwd_A[14]
-                * exp(fwd_beta[14] * tc[0] - activation_units[14] * fwd_Ea[14] * invT);
+    k_f = k_f_s[14];
     dlnkfdT = fwd_beta[14] * invT + activation_units[14] * fwd_Ea[14] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[14] * exp(low_beta[14] * tc[0] - activation_units[14] * low_Ea[14] * invT);
@@ -19496,16 +19530,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[14] == 4 ? exp(-troe_Tss[14] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[14]) > 1.e-100 ? -Fcent1/troe_Tsss[14] : 0.)
+      + (fabs(troe_Ts[14]) > 1.e-100 ? -Fcent2/troe_Ts[14] : 0.)
+      + (troe_len[14] == 4 ? Fcent3*troe_Tss[14]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[14]) > 1.e-100 ? -Fcent1/troe_Tsss[14] : 0.)
-      + (fabs(troe_Ts[14]) > 1.e-100 ? -Fcent2/troe_Ts[14] : 0.)
-      + (troe_len[14] == 4 ? Fcent3*troe_Tss[14]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -19513,7 +19547,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[20];
-    Kc = refCinv * exp(g_RT[4] + g_RT[12] - g_RT[20]);
+    Kc = Kc_s[14];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[12]) + (h_RT[20]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19531,95 +19565,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[14][0] - 1)*dcdc_fac;
-        J[4] -= dqdci;                /* dwdot[OH]/d[H2] */
-        J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
-        J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*sc[12];
-        J[148] -= dqdci;              /* dwdot[OH]/d[OH] */
-        J[156] -= dqdci;              /* dwdot[CH3]/d[OH] */
-        J[164] += dqdci;              /* dwdot[CH3OH]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[14][1] - 1)*dcdc_fac;
-        J[184] -= dqdci;              /* dwdot[OH]/d[H2O] */
-        J[192] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[200] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[4];
-        J[436] -= dqdci;              /* dwdot[OH]/d[CH3] */
-        J[444] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[452] += dqdci;              /* dwdot[CH3OH]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[14][2] - 1)*dcdc_fac;
-        J[472] -= dqdci;              /* dwdot[OH]/d[CH4] */
-        J[480] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[488] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[14][3] - 1)*dcdc_fac;
-        J[508] -= dqdci;              /* dwdot[OH]/d[CO] */
-        J[516] -= dqdci;              /* dwdot[CH3]/d[CO] */
-        J[524] += dqdci;              /* dwdot[CH3OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[14][4] - 1)*dcdc_fac;
-        J[544] -= dqdci;              /* dwdot[OH]/d[CO2] */
-        J[552] -= dqdci;              /* dwdot[CH3]/d[CO2] */
-        J[560] += dqdci;              /* dwdot[CH3OH]/d[CO2] */
-        /* d()/d[CH3OH] */
-        dqdci =  - k_r;
-        J[724] -= dqdci;              /* dwdot[OH]/d[CH3OH] */
-        J[732] -= dqdci;              /* dwdot[CH3]/d[CH3OH] */
-        J[740] += dqdci;              /* dwdot[CH3OH]/d[CH3OH] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[14][5] - 1)*dcdc_fac;
-        J[940] -= dqdci;              /* dwdot[OH]/d[C2H6] */
-        J[948] -= dqdci;              /* dwdot[CH3]/d[C2H6] */
-        J[956] += dqdci;              /* dwdot[CH3OH]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[14][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac + k_f*sc[12];
-        dqdc[5] = TB[14][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*sc[4];
-        dqdc[13] = TB[14][2]*dcdc_fac;
-        dqdc[14] = TB[14][3]*dcdc_fac;
-        dqdc[15] = TB[14][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac - k_r;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[14][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+4] -= dqdc[k];
-            J[36*k+12] -= dqdc[k];
-            J[36*k+20] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[4] -= dcdc_fac;
+    Jmix[12] -= dcdc_fac;
+    Jmix[20] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[14][0] - 1)*dcdc_fac;
+    J[4] -= dqdci;                /* dwdot[OH]/d[H2] */
+    J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
+    J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*sc[12];
+    J[148] -= dqdci;              /* dwdot[OH]/d[OH] */
+    J[156] -= dqdci;              /* dwdot[CH3]/d[OH] */
+    J[164] += dqdci;              /* dwdot[CH3OH]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[14][1] - 1)*dcdc_fac;
+    J[184] -= dqdci;              /* dwdot[OH]/d[H2O] */
+    J[192] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[200] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[4];
+    J[436] -= dqdci;              /* dwdot[OH]/d[CH3] */
+    J[444] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[452] += dqdci;              /* dwdot[CH3OH]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[14][2] - 1)*dcdc_fac;
+    J[472] -= dqdci;              /* dwdot[OH]/d[CH4] */
+    J[480] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[488] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[14][3] - 1)*dcdc_fac;
+    J[508] -= dqdci;              /* dwdot[OH]/d[CO] */
+    J[516] -= dqdci;              /* dwdot[CH3]/d[CO] */
+    J[524] += dqdci;              /* dwdot[CH3OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[14][4] - 1)*dcdc_fac;
+    J[544] -= dqdci;              /* dwdot[OH]/d[CO2] */
+    J[552] -= dqdci;              /* dwdot[CH3]/d[CO2] */
+    J[560] += dqdci;              /* dwdot[CH3OH]/d[CO2] */
+    /* d()/d[CH3OH] */
+    dqdci =  - k_r;
+    J[724] -= dqdci;              /* dwdot[OH]/d[CH3OH] */
+    J[732] -= dqdci;              /* dwdot[CH3]/d[CH3OH] */
+    J[740] += dqdci;              /* dwdot[CH3OH]/d[CH3OH] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[14][5] - 1)*dcdc_fac;
+    J[940] -= dqdci;              /* dwdot[OH]/d[C2H6] */
+    J[948] -= dqdci;              /* dwdot[CH3]/d[C2H6] */
+    J[956] += dqdci;              /* dwdot[CH3OH]/d[C2H6] */
     J[1264] -= dqdT; /* dwdot[OH]/dT */
     J[1272] -= dqdT; /* dwdot[CH3]/dT */
     J[1280] += dqdT; /* dwdot[CH3OH]/dT */
@@ -19628,11 +19622,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[15][0] - 1)*sc[0] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[13] + (TB[15][3] - 1)*sc[14] + (TB[15][4] - 1)*sc[15] + (TB[15][5] - 1)*sc[26];
+    alpha = (memcmp(TB[15], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[15][0] - 1)*sc[0] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[13] + (TB[15][3] - 1)*sc[14] + (TB[15][4] - 1)*sc[15] + (TB[15][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[9]*sc[14];
-    k_f = prefactor_units[15] * fwd_A[15]
-                * exp(fwd_beta[15] * tc[0] - activation_units[15] * fwd_Ea[15] * invT);
+    k_f = k_f_s[15];
     dlnkfdT = fwd_beta[15] * invT + activation_units[15] * fwd_Ea[15] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[15] * exp(low_beta[15] * tc[0] - activation_units[15] * low_Ea[15] * invT);
@@ -19648,16 +19641,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[15] == 4 ? exp(-troe_Tss[15] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[15]) > 1.e-100 ? -Fcent1/troe_Tsss[15] : 0.)
+      + (fabs(troe_Ts[15]) > 1.e-100 ? -Fcent2/troe_Ts[15] : 0.)
+      + (troe_len[15] == 4 ? Fcent3*troe_Tss[15]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[15]) > 1.e-100 ? -Fcent1/troe_Tsss[15] : 0.)
-      + (fabs(troe_Ts[15]) > 1.e-100 ? -Fcent2/troe_Ts[15] : 0.)
-      + (troe_len[15] == 4 ? Fcent3*troe_Tss[15]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -19665,7 +19658,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[27];
-    Kc = refCinv * exp(g_RT[9] + g_RT[14] - g_RT[27]);
+    Kc = Kc_s[15];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[14]) + (h_RT[27]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19683,90 +19676,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[15][0] - 1)*dcdc_fac;
-        J[9] -= dqdci;                /* dwdot[CH]/d[H2] */
-        J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
-        J[27] += dqdci;               /* dwdot[HCCO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[15][1] - 1)*dcdc_fac;
-        J[189] -= dqdci;              /* dwdot[CH]/d[H2O] */
-        J[194] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[207] += dqdci;              /* dwdot[HCCO]/d[H2O] */
-        /* d()/d[CH] */
-        dqdci =  + k_f*sc[14];
-        J[333] -= dqdci;              /* dwdot[CH]/d[CH] */
-        J[338] -= dqdci;              /* dwdot[CO]/d[CH] */
-        J[351] += dqdci;              /* dwdot[HCCO]/d[CH] */
-        /* d()/d[CH4] */
-        dqdci = (TB[15][2] - 1)*dcdc_fac;
-        J[477] -= dqdci;              /* dwdot[CH]/d[CH4] */
-        J[482] -= dqdci;              /* dwdot[CO]/d[CH4] */
-        J[495] += dqdci;              /* dwdot[HCCO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[15][3] - 1)*dcdc_fac + k_f*sc[9];
-        J[513] -= dqdci;              /* dwdot[CH]/d[CO] */
-        J[518] -= dqdci;              /* dwdot[CO]/d[CO] */
-        J[531] += dqdci;              /* dwdot[HCCO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[15][4] - 1)*dcdc_fac;
-        J[549] -= dqdci;              /* dwdot[CH]/d[CO2] */
-        J[554] -= dqdci;              /* dwdot[CO]/d[CO2] */
-        J[567] += dqdci;              /* dwdot[HCCO]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[15][5] - 1)*dcdc_fac;
-        J[945] -= dqdci;              /* dwdot[CH]/d[C2H6] */
-        J[950] -= dqdci;              /* dwdot[CO]/d[C2H6] */
-        J[963] += dqdci;              /* dwdot[HCCO]/d[C2H6] */
-        /* d()/d[HCCO] */
-        dqdci =  - k_r;
-        J[981] -= dqdci;              /* dwdot[CH]/d[HCCO] */
-        J[986] -= dqdci;              /* dwdot[CO]/d[HCCO] */
-        J[999] += dqdci;              /* dwdot[HCCO]/d[HCCO] */
-    }
-    else {
-        dqdc[0] = TB[15][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[15][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac + k_f*sc[14];
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[15][2]*dcdc_fac;
-        dqdc[14] = TB[15][3]*dcdc_fac + k_f*sc[9];
-        dqdc[15] = TB[15][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[15][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac - k_r;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+9] -= dqdc[k];
-            J[36*k+14] -= dqdc[k];
-            J[36*k+27] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[9] -= dcdc_fac;
+    Jmix[14] -= dcdc_fac;
+    Jmix[27] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[15][0] - 1)*dcdc_fac;
+    J[9] -= dqdci;                /* dwdot[CH]/d[H2] */
+    J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
+    J[27] += dqdci;               /* dwdot[HCCO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[15][1] - 1)*dcdc_fac;
+    J[189] -= dqdci;              /* dwdot[CH]/d[H2O] */
+    J[194] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[207] += dqdci;              /* dwdot[HCCO]/d[H2O] */
+    /* d()/d[CH] */
+    dqdci =  + k_f*sc[14];
+    J[333] -= dqdci;              /* dwdot[CH]/d[CH] */
+    J[338] -= dqdci;              /* dwdot[CO]/d[CH] */
+    J[351] += dqdci;              /* dwdot[HCCO]/d[CH] */
+    /* d()/d[CH4] */
+    dqdci = (TB[15][2] - 1)*dcdc_fac;
+    J[477] -= dqdci;              /* dwdot[CH]/d[CH4] */
+    J[482] -= dqdci;              /* dwdot[CO]/d[CH4] */
+    J[495] += dqdci;              /* dwdot[HCCO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[15][3] - 1)*dcdc_fac + k_f*sc[9];
+    J[513] -= dqdci;              /* dwdot[CH]/d[CO] */
+    J[518] -= dqdci;              /* dwdot[CO]/d[CO] */
+    J[531] += dqdci;              /* dwdot[HCCO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[15][4] - 1)*dcdc_fac;
+    J[549] -= dqdci;              /* dwdot[CH]/d[CO2] */
+    J[554] -= dqdci;              /* dwdot[CO]/d[CO2] */
+    J[567] += dqdci;              /* dwdot[HCCO]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[15][5] - 1)*dcdc_fac;
+    J[945] -= dqdci;              /* dwdot[CH]/d[C2H6] */
+    J[950] -= dqdci;              /* dwdot[CO]/d[C2H6] */
+    J[963] += dqdci;              /* dwdot[HCCO]/d[C2H6] */
+    /* d()/d[HCCO] */
+    dqdci =  - k_r;
+    J[981] -= dqdci;              /* dwdot[CH]/d[HCCO] */
+    J[986] -= dqdci;              /* dwdot[CO]/d[HCCO] */
+    J[999] += dqdci;              /* dwdot[HCCO]/d[HCCO] */
     J[1269] -= dqdT; /* dwdot[CH]/dT */
     J[1274] -= dqdT; /* dwdot[CO]/dT */
     J[1287] += dqdT; /* dwdot[HCCO]/dT */
@@ -19775,11 +19728,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[16][0] - 1)*sc[0] + (TB[16][1] - 1)*sc[5] + (TB[16][2] - 1)*sc[13] + (TB[16][3] - 1)*sc[14] + (TB[16][4] - 1)*sc[15] + (TB[16][5] - 1)*sc[26];
+    alpha = (memcmp(TB[16], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[16][0] - 1)*sc[0] + (TB[16][1] - 1)*sc[5] + (TB[16][2] - 1)*sc[13] + (TB[16][3] - 1)*sc[14] + (TB[16][4] - 1)*sc[15] + (TB[16][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[10]*sc[14];
-    k_f = prefactor_units[16] * fwd_A[16]
-                * exp(fwd_beta[16] * tc[0] - activation_units[16] * fwd_Ea[16] * invT);
+    k_f = k_f_s[16];
     dlnkfdT = fwd_beta[16] * invT + activation_units[16] * fwd_Ea[16] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[16] * exp(low_beta[16] * tc[0] - activation_units[16] * low_Ea[16] * invT);
@@ -19795,16 +19747,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[16] == 4 ? exp(-troe_Tss[16] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[16]) > 1.e-100 ? -Fcent1/troe_Tsss[16] : 0.)
+      + (fabs(troe_Ts[16]) > 1.e-100 ? -Fcent2/troe_Ts[16] : 0.)
+      + (troe_len[16] == 4 ? Fcent3*troe_Tss[16]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[16]) > 1.e-100 ? -Fcent1/troe_Tsss[16] : 0.)
-      + (fabs(troe_Ts[16]) > 1.e-100 ? -Fcent2/troe_Ts[16] : 0.)
-      + (troe_len[16] == 4 ? Fcent3*troe_Tss[16]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -19812,7 +19764,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[28];
-    Kc = refCinv * exp(g_RT[10] + g_RT[14] - g_RT[28]);
+    Kc = Kc_s[16];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[14]) + (h_RT[28]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19830,90 +19782,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[16][0] - 1)*dcdc_fac;
-        J[10] -= dqdci;               /* dwdot[CH2]/d[H2] */
-        J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
-        J[28] += dqdci;               /* dwdot[CH2CO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[16][1] - 1)*dcdc_fac;
-        J[190] -= dqdci;              /* dwdot[CH2]/d[H2O] */
-        J[194] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[208] += dqdci;              /* dwdot[CH2CO]/d[H2O] */
-        /* d()/d[CH2] */
-        dqdci =  + k_f*sc[14];
-        J[370] -= dqdci;              /* dwdot[CH2]/d[CH2] */
-        J[374] -= dqdci;              /* dwdot[CO]/d[CH2] */
-        J[388] += dqdci;              /* dwdot[CH2CO]/d[CH2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[16][2] - 1)*dcdc_fac;
-        J[478] -= dqdci;              /* dwdot[CH2]/d[CH4] */
-        J[482] -= dqdci;              /* dwdot[CO]/d[CH4] */
-        J[496] += dqdci;              /* dwdot[CH2CO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[16][3] - 1)*dcdc_fac + k_f*sc[10];
-        J[514] -= dqdci;              /* dwdot[CH2]/d[CO] */
-        J[518] -= dqdci;              /* dwdot[CO]/d[CO] */
-        J[532] += dqdci;              /* dwdot[CH2CO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[16][4] - 1)*dcdc_fac;
-        J[550] -= dqdci;              /* dwdot[CH2]/d[CO2] */
-        J[554] -= dqdci;              /* dwdot[CO]/d[CO2] */
-        J[568] += dqdci;              /* dwdot[CH2CO]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[16][5] - 1)*dcdc_fac;
-        J[946] -= dqdci;              /* dwdot[CH2]/d[C2H6] */
-        J[950] -= dqdci;              /* dwdot[CO]/d[C2H6] */
-        J[964] += dqdci;              /* dwdot[CH2CO]/d[C2H6] */
-        /* d()/d[CH2CO] */
-        dqdci =  - k_r;
-        J[1018] -= dqdci;             /* dwdot[CH2]/d[CH2CO] */
-        J[1022] -= dqdci;             /* dwdot[CO]/d[CH2CO] */
-        J[1036] += dqdci;             /* dwdot[CH2CO]/d[CH2CO] */
-    }
-    else {
-        dqdc[0] = TB[16][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[16][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac + k_f*sc[14];
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[16][2]*dcdc_fac;
-        dqdc[14] = TB[16][3]*dcdc_fac + k_f*sc[10];
-        dqdc[15] = TB[16][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[16][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac - k_r;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+10] -= dqdc[k];
-            J[36*k+14] -= dqdc[k];
-            J[36*k+28] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[10] -= dcdc_fac;
+    Jmix[14] -= dcdc_fac;
+    Jmix[28] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[16][0] - 1)*dcdc_fac;
+    J[10] -= dqdci;               /* dwdot[CH2]/d[H2] */
+    J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
+    J[28] += dqdci;               /* dwdot[CH2CO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[16][1] - 1)*dcdc_fac;
+    J[190] -= dqdci;              /* dwdot[CH2]/d[H2O] */
+    J[194] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[208] += dqdci;              /* dwdot[CH2CO]/d[H2O] */
+    /* d()/d[CH2] */
+    dqdci =  + k_f*sc[14];
+    J[370] -= dqdci;              /* dwdot[CH2]/d[CH2] */
+    J[374] -= dqdci;              /* dwdot[CO]/d[CH2] */
+    J[388] += dqdci;              /* dwdot[CH2CO]/d[CH2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[16][2] - 1)*dcdc_fac;
+    J[478] -= dqdci;              /* dwdot[CH2]/d[CH4] */
+    J[482] -= dqdci;              /* dwdot[CO]/d[CH4] */
+    J[496] += dqdci;              /* dwdot[CH2CO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[16][3] - 1)*dcdc_fac + k_f*sc[10];
+    J[514] -= dqdci;              /* dwdot[CH2]/d[CO] */
+    J[518] -= dqdci;              /* dwdot[CO]/d[CO] */
+    J[532] += dqdci;              /* dwdot[CH2CO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[16][4] - 1)*dcdc_fac;
+    J[550] -= dqdci;              /* dwdot[CH2]/d[CO2] */
+    J[554] -= dqdci;              /* dwdot[CO]/d[CO2] */
+    J[568] += dqdci;              /* dwdot[CH2CO]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[16][5] - 1)*dcdc_fac;
+    J[946] -= dqdci;              /* dwdot[CH2]/d[C2H6] */
+    J[950] -= dqdci;              /* dwdot[CO]/d[C2H6] */
+    J[964] += dqdci;              /* dwdot[CH2CO]/d[C2H6] */
+    /* d()/d[CH2CO] */
+    dqdci =  - k_r;
+    J[1018] -= dqdci;             /* dwdot[CH2]/d[CH2CO] */
+    J[1022] -= dqdci;             /* dwdot[CO]/d[CH2CO] */
+    J[1036] += dqdci;             /* dwdot[CH2CO]/d[CH2CO] */
     J[1270] -= dqdT; /* dwdot[CH2]/dT */
     J[1274] -= dqdT; /* dwdot[CO]/dT */
     J[1288] += dqdT; /* dwdot[CH2CO]/dT */
@@ -19922,11 +19834,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[17][0] - 1)*sc[0] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[13] + (TB[17][3] - 1)*sc[14] + (TB[17][4] - 1)*sc[15] + (TB[17][5] - 1)*sc[26];
+    alpha = (memcmp(TB[17], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[17][0] - 1)*sc[0] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[13] + (TB[17][3] - 1)*sc[14] + (TB[17][4] - 1)*sc[15] + (TB[17][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[5]*sc[11];
-    k_f = prefactor_units[17] * fwd_A[17]
-                * exp(fwd_beta[17] * tc[0] - activation_units[17] * fwd_Ea[17] * invT);
+    k_f = k_f_s[17];
     dlnkfdT = fwd_beta[17] * invT + activation_units[17] * fwd_Ea[17] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[17] * exp(low_beta[17] * tc[0] - activation_units[17] * low_Ea[17] * invT);
@@ -19942,16 +19853,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[17] == 4 ? exp(-troe_Tss[17] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[17]) > 1.e-100 ? -Fcent1/troe_Tsss[17] : 0.)
+      + (fabs(troe_Ts[17]) > 1.e-100 ? -Fcent2/troe_Ts[17] : 0.)
+      + (troe_len[17] == 4 ? Fcent3*troe_Tss[17]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[17]) > 1.e-100 ? -Fcent1/troe_Tsss[17] : 0.)
-      + (fabs(troe_Ts[17]) > 1.e-100 ? -Fcent2/troe_Ts[17] : 0.)
-      + (troe_len[17] == 4 ? Fcent3*troe_Tss[17]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -19959,7 +19870,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[20];
-    Kc = refCinv * exp(g_RT[5] + g_RT[11] - g_RT[20]);
+    Kc = Kc_s[17];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[11]) + (h_RT[20]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19977,90 +19888,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[17][0] - 1)*dcdc_fac;
-        J[5] -= dqdci;                /* dwdot[H2O]/d[H2] */
-        J[11] -= dqdci;               /* dwdot[CH2(S)]/d[H2] */
-        J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[17][1] - 1)*dcdc_fac + k_f*sc[11];
-        J[185] -= dqdci;              /* dwdot[H2O]/d[H2O] */
-        J[191] -= dqdci;              /* dwdot[CH2(S)]/d[H2O] */
-        J[200] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
-        /* d()/d[CH2(S)] */
-        dqdci =  + k_f*sc[5];
-        J[401] -= dqdci;              /* dwdot[H2O]/d[CH2(S)] */
-        J[407] -= dqdci;              /* dwdot[CH2(S)]/d[CH2(S)] */
-        J[416] += dqdci;              /* dwdot[CH3OH]/d[CH2(S)] */
-        /* d()/d[CH4] */
-        dqdci = (TB[17][2] - 1)*dcdc_fac;
-        J[473] -= dqdci;              /* dwdot[H2O]/d[CH4] */
-        J[479] -= dqdci;              /* dwdot[CH2(S)]/d[CH4] */
-        J[488] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[17][3] - 1)*dcdc_fac;
-        J[509] -= dqdci;              /* dwdot[H2O]/d[CO] */
-        J[515] -= dqdci;              /* dwdot[CH2(S)]/d[CO] */
-        J[524] += dqdci;              /* dwdot[CH3OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[17][4] - 1)*dcdc_fac;
-        J[545] -= dqdci;              /* dwdot[H2O]/d[CO2] */
-        J[551] -= dqdci;              /* dwdot[CH2(S)]/d[CO2] */
-        J[560] += dqdci;              /* dwdot[CH3OH]/d[CO2] */
-        /* d()/d[CH3OH] */
-        dqdci =  - k_r;
-        J[725] -= dqdci;              /* dwdot[H2O]/d[CH3OH] */
-        J[731] -= dqdci;              /* dwdot[CH2(S)]/d[CH3OH] */
-        J[740] += dqdci;              /* dwdot[CH3OH]/d[CH3OH] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[17][5] - 1)*dcdc_fac;
-        J[941] -= dqdci;              /* dwdot[H2O]/d[C2H6] */
-        J[947] -= dqdci;              /* dwdot[CH2(S)]/d[C2H6] */
-        J[956] += dqdci;              /* dwdot[CH3OH]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[17][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[17][1]*dcdc_fac + k_f*sc[11];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac + k_f*sc[5];
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[17][2]*dcdc_fac;
-        dqdc[14] = TB[17][3]*dcdc_fac;
-        dqdc[15] = TB[17][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac - k_r;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[17][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+5] -= dqdc[k];
-            J[36*k+11] -= dqdc[k];
-            J[36*k+20] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[5] -= dcdc_fac;
+    Jmix[11] -= dcdc_fac;
+    Jmix[20] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[17][0] - 1)*dcdc_fac;
+    J[5] -= dqdci;                /* dwdot[H2O]/d[H2] */
+    J[11] -= dqdci;               /* dwdot[CH2(S)]/d[H2] */
+    J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[17][1] - 1)*dcdc_fac + k_f*sc[11];
+    J[185] -= dqdci;              /* dwdot[H2O]/d[H2O] */
+    J[191] -= dqdci;              /* dwdot[CH2(S)]/d[H2O] */
+    J[200] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
+    /* d()/d[CH2(S)] */
+    dqdci =  + k_f*sc[5];
+    J[401] -= dqdci;              /* dwdot[H2O]/d[CH2(S)] */
+    J[407] -= dqdci;              /* dwdot[CH2(S)]/d[CH2(S)] */
+    J[416] += dqdci;              /* dwdot[CH3OH]/d[CH2(S)] */
+    /* d()/d[CH4] */
+    dqdci = (TB[17][2] - 1)*dcdc_fac;
+    J[473] -= dqdci;              /* dwdot[H2O]/d[CH4] */
+    J[479] -= dqdci;              /* dwdot[CH2(S)]/d[CH4] */
+    J[488] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[17][3] - 1)*dcdc_fac;
+    J[509] -= dqdci;              /* dwdot[H2O]/d[CO] */
+    J[515] -= dqdci;              /* dwdot[CH2(S)]/d[CO] */
+    J[524] += dqdci;              /* dwdot[CH3OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[17][4] - 1)*dcdc_fac;
+    J[545] -= dqdci;              /* dwdot[H2O]/d[CO2] */
+    J[551] -= dqdci;              /* dwdot[CH2(S)]/d[CO2] */
+    J[560] += dqdci;              /* dwdot[CH3OH]/d[CO2] */
+    /* d()/d[CH3OH] */
+    dqdci =  - k_r;
+    J[725] -= dqdci;              /* dwdot[H2O]/d[CH3OH] */
+    J[731] -= dqdci;              /* dwdot[CH2(S)]/d[CH3OH] */
+    J[740] += dqdci;              /* dwdot[CH3OH]/d[CH3OH] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[17][5] - 1)*dcdc_fac;
+    J[941] -= dqdci;              /* dwdot[H2O]/d[C2H6] */
+    J[947] -= dqdci;              /* dwdot[CH2(S)]/d[C2H6] */
+    J[956] += dqdci;              /* dwdot[CH3OH]/d[C2H6] */
     J[1265] -= dqdT; /* dwdot[H2O]/dT */
     J[1271] -= dqdT; /* dwdot[CH2(S)]/dT */
     J[1280] += dqdT; /* dwdot[CH3OH]/dT */
@@ -20069,11 +19940,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[18][0] - 1)*sc[0] + (TB[18][1] - 1)*sc[5] + (TB[18][2] - 1)*sc[13] + (TB[18][3] - 1)*sc[14] + (TB[18][4] - 1)*sc[15] + (TB[18][5] - 1)*sc[26];
+    alpha = (memcmp(TB[18], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[18][0] - 1)*sc[0] + (TB[18][1] - 1)*sc[5] + (TB[18][2] - 1)*sc[13] + (TB[18][3] - 1)*sc[14] + (TB[18][4] - 1)*sc[15] + (TB[18][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[12]*sc[12];
-    k_f = prefactor_units[18] * fwd_A[18]
-                * exp(fwd_beta[18] * tc[0] - activation_units[18] * fwd_Ea[18] * invT);
+    k_f = k_f_s[18];
     dlnkfdT = fwd_beta[18] * invT + activation_units[18] * fwd_Ea[18] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[18] * exp(low_beta[18] * tc[0] - activation_units[18] * low_Ea[18] * invT);
@@ -20089,16 +19959,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[18] == 4 ? exp(-troe_Tss[18] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[18]) > 1.e-100 ? -Fcent1/troe_Tsss[18] : 0.)
+      + (fabs(troe_Ts[18]) > 1.e-100 ? -Fcent2/troe_Ts[18] : 0.)
+      + (troe_len[18] == 4 ? Fcent3*troe_Tss[18]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[18]) > 1.e-100 ? -Fcent1/troe_Tsss[18] : 0.)
-      + (fabs(troe_Ts[18]) > 1.e-100 ? -Fcent2/troe_Ts[18] : 0.)
-      + (troe_len[18] == 4 ? Fcent3*troe_Tss[18]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -20106,7 +19976,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[26];
-    Kc = refCinv * exp(2*g_RT[12] - g_RT[26]);
+    Kc = Kc_s[18];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[12]) + (h_RT[26]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20123,77 +19993,37 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[18][0] - 1)*dcdc_fac;
-        J[12] += -2 * dqdci;          /* dwdot[CH3]/d[H2] */
-        J[26] += dqdci;               /* dwdot[C2H6]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[18][1] - 1)*dcdc_fac;
-        J[192] += -2 * dqdci;         /* dwdot[CH3]/d[H2O] */
-        J[206] += dqdci;              /* dwdot[C2H6]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*2*sc[12];
-        J[444] += -2 * dqdci;         /* dwdot[CH3]/d[CH3] */
-        J[458] += dqdci;              /* dwdot[C2H6]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[18][2] - 1)*dcdc_fac;
-        J[480] += -2 * dqdci;         /* dwdot[CH3]/d[CH4] */
-        J[494] += dqdci;              /* dwdot[C2H6]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[18][3] - 1)*dcdc_fac;
-        J[516] += -2 * dqdci;         /* dwdot[CH3]/d[CO] */
-        J[530] += dqdci;              /* dwdot[C2H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[18][4] - 1)*dcdc_fac;
-        J[552] += -2 * dqdci;         /* dwdot[CH3]/d[CO2] */
-        J[566] += dqdci;              /* dwdot[C2H6]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[18][5] - 1)*dcdc_fac - k_r;
-        J[948] += -2 * dqdci;         /* dwdot[CH3]/d[C2H6] */
-        J[962] += dqdci;              /* dwdot[C2H6]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[18][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[18][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*2*sc[12];
-        dqdc[13] = TB[18][2]*dcdc_fac;
-        dqdc[14] = TB[18][3]*dcdc_fac;
-        dqdc[15] = TB[18][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[18][5]*dcdc_fac - k_r;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+12] += -2 * dqdc[k];
-            J[36*k+26] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[12] += -2 * dcdc_fac;
+    Jmix[26] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[18][0] - 1)*dcdc_fac;
+    J[12] += -2 * dqdci;          /* dwdot[CH3]/d[H2] */
+    J[26] += dqdci;               /* dwdot[C2H6]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[18][1] - 1)*dcdc_fac;
+    J[192] += -2 * dqdci;         /* dwdot[CH3]/d[H2O] */
+    J[206] += dqdci;              /* dwdot[C2H6]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*2*sc[12];
+    J[444] += -2 * dqdci;         /* dwdot[CH3]/d[CH3] */
+    J[458] += dqdci;              /* dwdot[C2H6]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[18][2] - 1)*dcdc_fac;
+    J[480] += -2 * dqdci;         /* dwdot[CH3]/d[CH4] */
+    J[494] += dqdci;              /* dwdot[C2H6]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[18][3] - 1)*dcdc_fac;
+    J[516] += -2 * dqdci;         /* dwdot[CH3]/d[CO] */
+    J[530] += dqdci;              /* dwdot[C2H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[18][4] - 1)*dcdc_fac;
+    J[552] += -2 * dqdci;         /* dwdot[CH3]/d[CO2] */
+    J[566] += dqdci;              /* dwdot[C2H6]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[18][5] - 1)*dcdc_fac - k_r;
+    J[948] += -2 * dqdci;         /* dwdot[CH3]/d[C2H6] */
+    J[962] += dqdci;              /* dwdot[C2H6]/d[C2H6] */
     J[1272] += -2 * dqdT; /* dwdot[CH3]/dT */
     J[1286] += dqdT; /* dwdot[C2H6]/dT */
 
@@ -20201,11 +20031,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[19][0] - 1)*sc[0] + (TB[19][1] - 1)*sc[5] + (TB[19][2] - 1)*sc[13] + (TB[19][3] - 1)*sc[14] + (TB[19][4] - 1)*sc[15] + (TB[19][5] - 1)*sc[26];
+    alpha = (memcmp(TB[19], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[19][0] - 1)*sc[0] + (TB[19][1] - 1)*sc[5] + (TB[19][2] - 1)*sc[13] + (TB[19][3] - 1)*sc[14] + (TB[19][4] - 1)*sc[15] + (TB[19][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[24];
-    k_f = prefactor_units[19] * fwd_A[19]
-                * exp(fwd_beta[19] * tc[0] - activation_units[19] * fwd_Ea[19] * invT);
+    k_f = k_f_s[19];
     dlnkfdT = fwd_beta[19] * invT + activation_units[19] * fwd_Ea[19] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[19] * exp(low_beta[19] * tc[0] - activation_units[19] * low_Ea[19] * invT);
@@ -20221,16 +20050,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[19] == 4 ? exp(-troe_Tss[19] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[19]) > 1.e-100 ? -Fcent1/troe_Tsss[19] : 0.)
+      + (fabs(troe_Ts[19]) > 1.e-100 ? -Fcent2/troe_Ts[19] : 0.)
+      + (troe_len[19] == 4 ? Fcent3*troe_Tss[19]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[19]) > 1.e-100 ? -Fcent1/troe_Tsss[19] : 0.)
-      + (fabs(troe_Ts[19]) > 1.e-100 ? -Fcent2/troe_Ts[19] : 0.)
-      + (troe_len[19] == 4 ? Fcent3*troe_Tss[19]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -20238,7 +20067,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[0]*sc[22];
-    Kc = refC * exp(-g_RT[0] - g_RT[22] + g_RT[24]);
+    Kc = Kc_s[19];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[24]) + (h_RT[0] + h_RT[22]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20256,90 +20085,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[19][0] - 1)*dcdc_fac - k_r*sc[22];
-        J[0] += dqdci;                /* dwdot[H2]/d[H2] */
-        J[22] += dqdci;               /* dwdot[C2H2]/d[H2] */
-        J[24] -= dqdci;               /* dwdot[C2H4]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[19][1] - 1)*dcdc_fac;
-        J[180] += dqdci;              /* dwdot[H2]/d[H2O] */
-        J[202] += dqdci;              /* dwdot[C2H2]/d[H2O] */
-        J[204] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[19][2] - 1)*dcdc_fac;
-        J[468] += dqdci;              /* dwdot[H2]/d[CH4] */
-        J[490] += dqdci;              /* dwdot[C2H2]/d[CH4] */
-        J[492] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[19][3] - 1)*dcdc_fac;
-        J[504] += dqdci;              /* dwdot[H2]/d[CO] */
-        J[526] += dqdci;              /* dwdot[C2H2]/d[CO] */
-        J[528] -= dqdci;              /* dwdot[C2H4]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[19][4] - 1)*dcdc_fac;
-        J[540] += dqdci;              /* dwdot[H2]/d[CO2] */
-        J[562] += dqdci;              /* dwdot[C2H2]/d[CO2] */
-        J[564] -= dqdci;              /* dwdot[C2H4]/d[CO2] */
-        /* d()/d[C2H2] */
-        dqdci =  - k_r*sc[0];
-        J[792] += dqdci;              /* dwdot[H2]/d[C2H2] */
-        J[814] += dqdci;              /* dwdot[C2H2]/d[C2H2] */
-        J[816] -= dqdci;              /* dwdot[C2H4]/d[C2H2] */
-        /* d()/d[C2H4] */
-        dqdci =  + k_f;
-        J[864] += dqdci;              /* dwdot[H2]/d[C2H4] */
-        J[886] += dqdci;              /* dwdot[C2H2]/d[C2H4] */
-        J[888] -= dqdci;              /* dwdot[C2H4]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[19][5] - 1)*dcdc_fac;
-        J[936] += dqdci;              /* dwdot[H2]/d[C2H6] */
-        J[958] += dqdci;              /* dwdot[C2H2]/d[C2H6] */
-        J[960] -= dqdci;              /* dwdot[C2H4]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[19][0]*dcdc_fac - k_r*sc[22];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[19][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[19][2]*dcdc_fac;
-        dqdc[14] = TB[19][3]*dcdc_fac;
-        dqdc[15] = TB[19][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac - k_r*sc[0];
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac + k_f;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[19][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+0] += dqdc[k];
-            J[36*k+22] += dqdc[k];
-            J[36*k+24] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += dcdc_fac;
+    Jmix[22] += dcdc_fac;
+    Jmix[24] -= dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[19][0] - 1)*dcdc_fac - k_r*sc[22];
+    J[0] += dqdci;                /* dwdot[H2]/d[H2] */
+    J[22] += dqdci;               /* dwdot[C2H2]/d[H2] */
+    J[24] -= dqdci;               /* dwdot[C2H4]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[19][1] - 1)*dcdc_fac;
+    J[180] += dqdci;              /* dwdot[H2]/d[H2O] */
+    J[202] += dqdci;              /* dwdot[C2H2]/d[H2O] */
+    J[204] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[19][2] - 1)*dcdc_fac;
+    J[468] += dqdci;              /* dwdot[H2]/d[CH4] */
+    J[490] += dqdci;              /* dwdot[C2H2]/d[CH4] */
+    J[492] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[19][3] - 1)*dcdc_fac;
+    J[504] += dqdci;              /* dwdot[H2]/d[CO] */
+    J[526] += dqdci;              /* dwdot[C2H2]/d[CO] */
+    J[528] -= dqdci;              /* dwdot[C2H4]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[19][4] - 1)*dcdc_fac;
+    J[540] += dqdci;              /* dwdot[H2]/d[CO2] */
+    J[562] += dqdci;              /* dwdot[C2H2]/d[CO2] */
+    J[564] -= dqdci;              /* dwdot[C2H4]/d[CO2] */
+    /* d()/d[C2H2] */
+    dqdci =  - k_r*sc[0];
+    J[792] += dqdci;              /* dwdot[H2]/d[C2H2] */
+    J[814] += dqdci;              /* dwdot[C2H2]/d[C2H2] */
+    J[816] -= dqdci;              /* dwdot[C2H4]/d[C2H2] */
+    /* d()/d[C2H4] */
+    dqdci =  + k_f;
+    J[864] += dqdci;              /* dwdot[H2]/d[C2H4] */
+    J[886] += dqdci;              /* dwdot[C2H2]/d[C2H4] */
+    J[888] -= dqdci;              /* dwdot[C2H4]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[19][5] - 1)*dcdc_fac;
+    J[936] += dqdci;              /* dwdot[H2]/d[C2H6] */
+    J[958] += dqdci;              /* dwdot[C2H2]/d[C2H6] */
+    J[960] -= dqdci;              /* dwdot[C2H4]/d[C2H6] */
     J[1260] += dqdT; /* dwdot[H2]/dT */
     J[1282] += dqdT; /* dwdot[C2H2]/dT */
     J[1284] -= dqdT; /* dwdot[C2H4]/dT */
@@ -20348,11 +20137,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[20][0] - 1)*sc[0] + (TB[20][1] - 1)*sc[5] + (TB[20][2] - 1)*sc[13] + (TB[20][3] - 1)*sc[14] + (TB[20][4] - 1)*sc[15] + (TB[20][5] - 1)*sc[26];
+    alpha = (memcmp(TB[20], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[20][0] - 1)*sc[0] + (TB[20][1] - 1)*sc[5] + (TB[20][2] - 1)*sc[13] + (TB[20][3] - 1)*sc[14] + (TB[20][4] - 1)*sc[15] + (TB[20][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[0]*sc[9];
-    k_f = prefactor_units[20] * fwd_A[20]
-                * exp(fwd_beta[20] * tc[0] - activation_units[20] * fwd_Ea[20] * invT);
+    k_f = k_f_s[20];
     dlnkfdT = fwd_beta[20] * invT + activation_units[20] * fwd_Ea[20] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[20] * exp(low_beta[20] * tc[0] - activation_units[20] * low_Ea[20] * invT);
@@ -20368,16 +20156,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[20] == 4 ? exp(-troe_Tss[20] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[20]) > 1.e-100 ? -Fcent1/troe_Tsss[20] : 0.)
+      + (fabs(troe_Ts[20]) > 1.e-100 ? -Fcent2/troe_Ts[20] : 0.)
+      + (troe_len[20] == 4 ? Fcent3*troe_Tss[20]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[20]) > 1.e-100 ? -Fcent1/troe_Tsss[20] : 0.)
-      + (fabs(troe_Ts[20]) > 1.e-100 ? -Fcent2/troe_Ts[20] : 0.)
-      + (troe_len[20] == 4 ? Fcent3*troe_Tss[20]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -20385,7 +20173,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[12];
-    Kc = refCinv * exp(g_RT[0] + g_RT[9] - g_RT[12]);
+    Kc = Kc_s[20];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[9]) + (h_RT[12]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20403,90 +20191,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[20][0] - 1)*dcdc_fac + k_f*sc[9];
-        J[0] -= dqdci;                /* dwdot[H2]/d[H2] */
-        J[9] -= dqdci;                /* dwdot[CH]/d[H2] */
-        J[12] += dqdci;               /* dwdot[CH3]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[20][1] - 1)*dcdc_fac;
-        J[180] -= dqdci;              /* dwdot[H2]/d[H2O] */
-        J[189] -= dqdci;              /* dwdot[CH]/d[H2O] */
-        J[192] += dqdci;              /* dwdot[CH3]/d[H2O] */
-        /* d()/d[CH] */
-        dqdci =  + k_f*sc[0];
-        J[324] -= dqdci;              /* dwdot[H2]/d[CH] */
-        J[333] -= dqdci;              /* dwdot[CH]/d[CH] */
-        J[336] += dqdci;              /* dwdot[CH3]/d[CH] */
-        /* d()/d[CH3] */
-        dqdci =  - k_r;
-        J[432] -= dqdci;              /* dwdot[H2]/d[CH3] */
-        J[441] -= dqdci;              /* dwdot[CH]/d[CH3] */
-        J[444] += dqdci;              /* dwdot[CH3]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[20][2] - 1)*dcdc_fac;
-        J[468] -= dqdci;              /* dwdot[H2]/d[CH4] */
-        J[477] -= dqdci;              /* dwdot[CH]/d[CH4] */
-        J[480] += dqdci;              /* dwdot[CH3]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[20][3] - 1)*dcdc_fac;
-        J[504] -= dqdci;              /* dwdot[H2]/d[CO] */
-        J[513] -= dqdci;              /* dwdot[CH]/d[CO] */
-        J[516] += dqdci;              /* dwdot[CH3]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[20][4] - 1)*dcdc_fac;
-        J[540] -= dqdci;              /* dwdot[H2]/d[CO2] */
-        J[549] -= dqdci;              /* dwdot[CH]/d[CO2] */
-        J[552] += dqdci;              /* dwdot[CH3]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[20][5] - 1)*dcdc_fac;
-        J[936] -= dqdci;              /* dwdot[H2]/d[C2H6] */
-        J[945] -= dqdci;              /* dwdot[CH]/d[C2H6] */
-        J[948] += dqdci;              /* dwdot[CH3]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[20][0]*dcdc_fac + k_f*sc[9];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[20][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac + k_f*sc[0];
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac - k_r;
-        dqdc[13] = TB[20][2]*dcdc_fac;
-        dqdc[14] = TB[20][3]*dcdc_fac;
-        dqdc[15] = TB[20][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[20][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+0] -= dqdc[k];
-            J[36*k+9] -= dqdc[k];
-            J[36*k+12] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[9] -= dcdc_fac;
+    Jmix[12] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[20][0] - 1)*dcdc_fac + k_f*sc[9];
+    J[0] -= dqdci;                /* dwdot[H2]/d[H2] */
+    J[9] -= dqdci;                /* dwdot[CH]/d[H2] */
+    J[12] += dqdci;               /* dwdot[CH3]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[20][1] - 1)*dcdc_fac;
+    J[180] -= dqdci;              /* dwdot[H2]/d[H2O] */
+    J[189] -= dqdci;              /* dwdot[CH]/d[H2O] */
+    J[192] += dqdci;              /* dwdot[CH3]/d[H2O] */
+    /* d()/d[CH] */
+    dqdci =  + k_f*sc[0];
+    J[324] -= dqdci;              /* dwdot[H2]/d[CH] */
+    J[333] -= dqdci;              /* dwdot[CH]/d[CH] */
+    J[336] += dqdci;              /* dwdot[CH3]/d[CH] */
+    /* d()/d[CH3] */
+    dqdci =  - k_r;
+    J[432] -= dqdci;              /* dwdot[H2]/d[CH3] */
+    J[441] -= dqdci;              /* dwdot[CH]/d[CH3] */
+    J[444] += dqdci;              /* dwdot[CH3]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[20][2] - 1)*dcdc_fac;
+    J[468] -= dqdci;              /* dwdot[H2]/d[CH4] */
+    J[477] -= dqdci;              /* dwdot[CH]/d[CH4] */
+    J[480] += dqdci;              /* dwdot[CH3]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[20][3] - 1)*dcdc_fac;
+    J[504] -= dqdci;              /* dwdot[H2]/d[CO] */
+    J[513] -= dqdci;              /* dwdot[CH]/d[CO] */
+    J[516] += dqdci;              /* dwdot[CH3]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[20][4] - 1)*dcdc_fac;
+    J[540] -= dqdci;              /* dwdot[H2]/d[CO2] */
+    J[549] -= dqdci;              /* dwdot[CH]/d[CO2] */
+    J[552] += dqdci;              /* dwdot[CH3]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[20][5] - 1)*dcdc_fac;
+    J[936] -= dqdci;              /* dwdot[H2]/d[C2H6] */
+    J[945] -= dqdci;              /* dwdot[CH]/d[C2H6] */
+    J[948] += dqdci;              /* dwdot[CH3]/d[C2H6] */
     J[1260] -= dqdT; /* dwdot[H2]/dT */
     J[1269] -= dqdT; /* dwdot[CH]/dT */
     J[1272] += dqdT; /* dwdot[CH3]/dT */
@@ -20495,11 +20243,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[21][0] - 1)*sc[0] + (TB[21][1] - 1)*sc[5] + (TB[21][2] - 1)*sc[13] + (TB[21][3] - 1)*sc[14] + (TB[21][4] - 1)*sc[15] + (TB[21][5] - 1)*sc[26];
+    alpha = (memcmp(TB[21], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[21][0] - 1)*sc[0] + (TB[21][1] - 1)*sc[5] + (TB[21][2] - 1)*sc[13] + (TB[21][3] - 1)*sc[14] + (TB[21][4] - 1)*sc[15] + (TB[21][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[1]*sc[28];
-    k_f = prefactor_units[21] * fwd_A[21]
-                * exp(fwd_beta[21] * tc[0] - activation_units[21] * fwd_Ea[21] * invT);
+    k_f = k_f_s[21];
     dlnkfdT = fwd_beta[21] * invT + activation_units[21] * fwd_Ea[21] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[21] * exp(low_beta[21] * tc[0] - activation_units[21] * low_Ea[21] * invT);
@@ -20515,16 +20262,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[21] == 4 ? exp(-troe_Tss[21] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[21]) > 1.e-100 ? -Fcent1/troe_Tsss[21] : 0.)
+      + (fabs(troe_Ts[21]) > 1.e-100 ? -Fcent2/troe_Ts[21] : 0.)
+      + (troe_len[21] == 4 ? Fcent3*troe_Tss[21]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[21]) > 1.e-100 ? -Fcent1/troe_Tsss[21] : 0.)
-      + (fabs(troe_Ts[21]) > 1.e-100 ? -Fcent2/troe_Ts[21] : 0.)
-      + (troe_len[21] == 4 ? Fcent3*troe_Tss[21]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -20532,7 +20279,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[33];
-    Kc = refCinv * exp(g_RT[1] + g_RT[28] - g_RT[33]);
+    Kc = Kc_s[21];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[28]) + (h_RT[33]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20550,95 +20297,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[21][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[28] -= dqdci;               /* dwdot[CH2CO]/d[H2] */
-        J[33] += dqdci;               /* dwdot[CH2CHO]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[28];
-        J[37] -= dqdci;               /* dwdot[H]/d[H] */
-        J[64] -= dqdci;               /* dwdot[CH2CO]/d[H] */
-        J[69] += dqdci;               /* dwdot[CH2CHO]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[21][1] - 1)*dcdc_fac;
-        J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[208] -= dqdci;              /* dwdot[CH2CO]/d[H2O] */
-        J[213] += dqdci;              /* dwdot[CH2CHO]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[21][2] - 1)*dcdc_fac;
-        J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[496] -= dqdci;              /* dwdot[CH2CO]/d[CH4] */
-        J[501] += dqdci;              /* dwdot[CH2CHO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[21][3] - 1)*dcdc_fac;
-        J[505] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[532] -= dqdci;              /* dwdot[CH2CO]/d[CO] */
-        J[537] += dqdci;              /* dwdot[CH2CHO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[21][4] - 1)*dcdc_fac;
-        J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[568] -= dqdci;              /* dwdot[CH2CO]/d[CO2] */
-        J[573] += dqdci;              /* dwdot[CH2CHO]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[21][5] - 1)*dcdc_fac;
-        J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[964] -= dqdci;              /* dwdot[CH2CO]/d[C2H6] */
-        J[969] += dqdci;              /* dwdot[CH2CHO]/d[C2H6] */
-        /* d()/d[CH2CO] */
-        dqdci =  + k_f*sc[1];
-        J[1009] -= dqdci;             /* dwdot[H]/d[CH2CO] */
-        J[1036] -= dqdci;             /* dwdot[CH2CO]/d[CH2CO] */
-        J[1041] += dqdci;             /* dwdot[CH2CHO]/d[CH2CO] */
-        /* d()/d[CH2CHO] */
-        dqdci =  - k_r;
-        J[1189] -= dqdci;             /* dwdot[H]/d[CH2CHO] */
-        J[1216] -= dqdci;             /* dwdot[CH2CO]/d[CH2CHO] */
-        J[1221] += dqdci;             /* dwdot[CH2CHO]/d[CH2CHO] */
-    }
-    else {
-        dqdc[0] = TB[21][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[28];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[21][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[21][2]*dcdc_fac;
-        dqdc[14] = TB[21][3]*dcdc_fac;
-        dqdc[15] = TB[21][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[21][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac + k_f*sc[1];
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac - k_r;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+1] -= dqdc[k];
-            J[36*k+28] -= dqdc[k];
-            J[36*k+33] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[28] -= dcdc_fac;
+    Jmix[33] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[21][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[28] -= dqdci;               /* dwdot[CH2CO]/d[H2] */
+    J[33] += dqdci;               /* dwdot[CH2CHO]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[28];
+    J[37] -= dqdci;               /* dwdot[H]/d[H] */
+    J[64] -= dqdci;               /* dwdot[CH2CO]/d[H] */
+    J[69] += dqdci;               /* dwdot[CH2CHO]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[21][1] - 1)*dcdc_fac;
+    J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[208] -= dqdci;              /* dwdot[CH2CO]/d[H2O] */
+    J[213] += dqdci;              /* dwdot[CH2CHO]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[21][2] - 1)*dcdc_fac;
+    J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[496] -= dqdci;              /* dwdot[CH2CO]/d[CH4] */
+    J[501] += dqdci;              /* dwdot[CH2CHO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[21][3] - 1)*dcdc_fac;
+    J[505] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[532] -= dqdci;              /* dwdot[CH2CO]/d[CO] */
+    J[537] += dqdci;              /* dwdot[CH2CHO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[21][4] - 1)*dcdc_fac;
+    J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[568] -= dqdci;              /* dwdot[CH2CO]/d[CO2] */
+    J[573] += dqdci;              /* dwdot[CH2CHO]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[21][5] - 1)*dcdc_fac;
+    J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[964] -= dqdci;              /* dwdot[CH2CO]/d[C2H6] */
+    J[969] += dqdci;              /* dwdot[CH2CHO]/d[C2H6] */
+    /* d()/d[CH2CO] */
+    dqdci =  + k_f*sc[1];
+    J[1009] -= dqdci;             /* dwdot[H]/d[CH2CO] */
+    J[1036] -= dqdci;             /* dwdot[CH2CO]/d[CH2CO] */
+    J[1041] += dqdci;             /* dwdot[CH2CHO]/d[CH2CO] */
+    /* d()/d[CH2CHO] */
+    dqdci =  - k_r;
+    J[1189] -= dqdci;             /* dwdot[H]/d[CH2CHO] */
+    J[1216] -= dqdci;             /* dwdot[CH2CO]/d[CH2CHO] */
+    J[1221] += dqdci;             /* dwdot[CH2CHO]/d[CH2CHO] */
     J[1261] -= dqdT; /* dwdot[H]/dT */
     J[1288] -= dqdT; /* dwdot[CH2CO]/dT */
     J[1293] += dqdT; /* dwdot[CH2CHO]/dT */
@@ -20647,11 +20354,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[22][0] - 1)*sc[0] + (TB[22][1] - 1)*sc[5] + (TB[22][2] - 1)*sc[13] + (TB[22][3] - 1)*sc[14] + (TB[22][4] - 1)*sc[15] + (TB[22][5] - 1)*sc[26];
+    alpha = (memcmp(TB[22], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[22][0] - 1)*sc[0] + (TB[22][1] - 1)*sc[5] + (TB[22][2] - 1)*sc[13] + (TB[22][3] - 1)*sc[14] + (TB[22][4] - 1)*sc[15] + (TB[22][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[12]*sc[25];
-    k_f = prefactor_units[22] * fwd_A[22]
-                * exp(fwd_beta[22] * tc[0] - activation_units[22] * fwd_Ea[22] * invT);
+    k_f = k_f_s[22];
     dlnkfdT = fwd_beta[22] * invT + activation_units[22] * fwd_Ea[22] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[22] * exp(low_beta[22] * tc[0] - activation_units[22] * low_Ea[22] * invT);
@@ -20667,16 +20373,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[22] == 4 ? exp(-troe_Tss[22] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[22]) > 1.e-100 ? -Fcent1/troe_Tsss[22] : 0.)
+      + (fabs(troe_Ts[22]) > 1.e-100 ? -Fcent2/troe_Ts[22] : 0.)
+      + (troe_len[22] == 4 ? Fcent3*troe_Tss[22]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[22]) > 1.e-100 ? -Fcent1/troe_Tsss[22] : 0.)
-      + (fabs(troe_Ts[22]) > 1.e-100 ? -Fcent2/troe_Ts[22] : 0.)
-      + (troe_len[22] == 4 ? Fcent3*troe_Tss[22]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -20684,7 +20390,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[32];
-    Kc = refCinv * exp(g_RT[12] + g_RT[25] - g_RT[32]);
+    Kc = Kc_s[22];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[25]) + (h_RT[32]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20702,95 +20408,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[22][0] - 1)*dcdc_fac;
-        J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
-        J[25] -= dqdci;               /* dwdot[C2H5]/d[H2] */
-        J[32] += dqdci;               /* dwdot[C3H8]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[22][1] - 1)*dcdc_fac;
-        J[192] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[205] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
-        J[212] += dqdci;              /* dwdot[C3H8]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[25];
-        J[444] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[457] -= dqdci;              /* dwdot[C2H5]/d[CH3] */
-        J[464] += dqdci;              /* dwdot[C3H8]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[22][2] - 1)*dcdc_fac;
-        J[480] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[493] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
-        J[500] += dqdci;              /* dwdot[C3H8]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[22][3] - 1)*dcdc_fac;
-        J[516] -= dqdci;              /* dwdot[CH3]/d[CO] */
-        J[529] -= dqdci;              /* dwdot[C2H5]/d[CO] */
-        J[536] += dqdci;              /* dwdot[C3H8]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[22][4] - 1)*dcdc_fac;
-        J[552] -= dqdci;              /* dwdot[CH3]/d[CO2] */
-        J[565] -= dqdci;              /* dwdot[C2H5]/d[CO2] */
-        J[572] += dqdci;              /* dwdot[C3H8]/d[CO2] */
-        /* d()/d[C2H5] */
-        dqdci =  + k_f*sc[12];
-        J[912] -= dqdci;              /* dwdot[CH3]/d[C2H5] */
-        J[925] -= dqdci;              /* dwdot[C2H5]/d[C2H5] */
-        J[932] += dqdci;              /* dwdot[C3H8]/d[C2H5] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[22][5] - 1)*dcdc_fac;
-        J[948] -= dqdci;              /* dwdot[CH3]/d[C2H6] */
-        J[961] -= dqdci;              /* dwdot[C2H5]/d[C2H6] */
-        J[968] += dqdci;              /* dwdot[C3H8]/d[C2H6] */
-        /* d()/d[C3H8] */
-        dqdci =  - k_r;
-        J[1164] -= dqdci;             /* dwdot[CH3]/d[C3H8] */
-        J[1177] -= dqdci;             /* dwdot[C2H5]/d[C3H8] */
-        J[1184] += dqdci;             /* dwdot[C3H8]/d[C3H8] */
-    }
-    else {
-        dqdc[0] = TB[22][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[22][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*sc[25];
-        dqdc[13] = TB[22][2]*dcdc_fac;
-        dqdc[14] = TB[22][3]*dcdc_fac;
-        dqdc[15] = TB[22][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac + k_f*sc[12];
-        dqdc[26] = TB[22][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac - k_r;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+12] -= dqdc[k];
-            J[36*k+25] -= dqdc[k];
-            J[36*k+32] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[12] -= dcdc_fac;
+    Jmix[25] -= dcdc_fac;
+    Jmix[32] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[22][0] - 1)*dcdc_fac;
+    J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
+    J[25] -= dqdci;               /* dwdot[C2H5]/d[H2] */
+    J[32] += dqdci;               /* dwdot[C3H8]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[22][1] - 1)*dcdc_fac;
+    J[192] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[205] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
+    J[212] += dqdci;              /* dwdot[C3H8]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[25];
+    J[444] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[457] -= dqdci;              /* dwdot[C2H5]/d[CH3] */
+    J[464] += dqdci;              /* dwdot[C3H8]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[22][2] - 1)*dcdc_fac;
+    J[480] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[493] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
+    J[500] += dqdci;              /* dwdot[C3H8]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[22][3] - 1)*dcdc_fac;
+    J[516] -= dqdci;              /* dwdot[CH3]/d[CO] */
+    J[529] -= dqdci;              /* dwdot[C2H5]/d[CO] */
+    J[536] += dqdci;              /* dwdot[C3H8]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[22][4] - 1)*dcdc_fac;
+    J[552] -= dqdci;              /* dwdot[CH3]/d[CO2] */
+    J[565] -= dqdci;              /* dwdot[C2H5]/d[CO2] */
+    J[572] += dqdci;              /* dwdot[C3H8]/d[CO2] */
+    /* d()/d[C2H5] */
+    dqdci =  + k_f*sc[12];
+    J[912] -= dqdci;              /* dwdot[CH3]/d[C2H5] */
+    J[925] -= dqdci;              /* dwdot[C2H5]/d[C2H5] */
+    J[932] += dqdci;              /* dwdot[C3H8]/d[C2H5] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[22][5] - 1)*dcdc_fac;
+    J[948] -= dqdci;              /* dwdot[CH3]/d[C2H6] */
+    J[961] -= dqdci;              /* dwdot[C2H5]/d[C2H6] */
+    J[968] += dqdci;              /* dwdot[C3H8]/d[C2H6] */
+    /* d()/d[C3H8] */
+    dqdci =  - k_r;
+    J[1164] -= dqdci;             /* dwdot[CH3]/d[C3H8] */
+    J[1177] -= dqdci;             /* dwdot[C2H5]/d[C3H8] */
+    J[1184] += dqdci;             /* dwdot[C3H8]/d[C3H8] */
     J[1272] -= dqdT; /* dwdot[CH3]/dT */
     J[1285] -= dqdT; /* dwdot[C2H5]/dT */
     J[1292] += dqdT; /* dwdot[C3H8]/dT */
@@ -20799,11 +20465,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[23][0] - 1)*sc[0] + (TB[23][1] - 1)*sc[5] + (TB[23][2] - 1)*sc[13] + (TB[23][3] - 1)*sc[14] + (TB[23][4] - 1)*sc[15] + (TB[23][5] - 1)*sc[26];
+    alpha = (memcmp(TB[23], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[23][0] - 1)*sc[0] + (TB[23][1] - 1)*sc[5] + (TB[23][2] - 1)*sc[13] + (TB[23][3] - 1)*sc[14] + (TB[23][4] - 1)*sc[15] + (TB[23][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[12]*sc[24];
-    k_f = prefactor_units[23] * fwd_A[23]
-                * exp(fwd_beta[23] * tc[0] - activation_units[23] * fwd_Ea[23] * invT);
+    k_f = k_f_s[23];
     dlnkfdT = fwd_beta[23] * invT + activation_units[23] * fwd_Ea[23] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[23] * exp(low_beta[23] * tc[0] - activation_units[23] * low_Ea[23] * invT);
@@ -20819,16 +20484,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[23] == 4 ? exp(-troe_Tss[23] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[23]) > 1.e-100 ? -Fcent1/troe_Tsss[23] : 0.)
+      + (fabs(troe_Ts[23]) > 1.e-100 ? -Fcent2/troe_Ts[23] : 0.)
+      + (troe_len[23] == 4 ? Fcent3*troe_Tss[23]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[23]) > 1.e-100 ? -Fcent1/troe_Tsss[23] : 0.)
-      + (fabs(troe_Ts[23]) > 1.e-100 ? -Fcent2/troe_Ts[23] : 0.)
-      + (troe_len[23] == 4 ? Fcent3*troe_Tss[23]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -20836,7 +20501,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[31];
-    Kc = refCinv * exp(g_RT[12] + g_RT[24] - g_RT[31]);
+    Kc = Kc_s[23];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[24]) + (h_RT[31]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20854,95 +20519,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[23][0] - 1)*dcdc_fac;
-        J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
-        J[24] -= dqdci;               /* dwdot[C2H4]/d[H2] */
-        J[31] += dqdci;               /* dwdot[C3H7]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[23][1] - 1)*dcdc_fac;
-        J[192] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[204] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
-        J[211] += dqdci;              /* dwdot[C3H7]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[24];
-        J[444] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[456] -= dqdci;              /* dwdot[C2H4]/d[CH3] */
-        J[463] += dqdci;              /* dwdot[C3H7]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[23][2] - 1)*dcdc_fac;
-        J[480] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[492] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
-        J[499] += dqdci;              /* dwdot[C3H7]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[23][3] - 1)*dcdc_fac;
-        J[516] -= dqdci;              /* dwdot[CH3]/d[CO] */
-        J[528] -= dqdci;              /* dwdot[C2H4]/d[CO] */
-        J[535] += dqdci;              /* dwdot[C3H7]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[23][4] - 1)*dcdc_fac;
-        J[552] -= dqdci;              /* dwdot[CH3]/d[CO2] */
-        J[564] -= dqdci;              /* dwdot[C2H4]/d[CO2] */
-        J[571] += dqdci;              /* dwdot[C3H7]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci =  + k_f*sc[12];
-        J[876] -= dqdci;              /* dwdot[CH3]/d[C2H4] */
-        J[888] -= dqdci;              /* dwdot[C2H4]/d[C2H4] */
-        J[895] += dqdci;              /* dwdot[C3H7]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[23][5] - 1)*dcdc_fac;
-        J[948] -= dqdci;              /* dwdot[CH3]/d[C2H6] */
-        J[960] -= dqdci;              /* dwdot[C2H4]/d[C2H6] */
-        J[967] += dqdci;              /* dwdot[C3H7]/d[C2H6] */
-        /* d()/d[C3H7] */
-        dqdci =  - k_r;
-        J[1128] -= dqdci;             /* dwdot[CH3]/d[C3H7] */
-        J[1140] -= dqdci;             /* dwdot[C2H4]/d[C3H7] */
-        J[1147] += dqdci;             /* dwdot[C3H7]/d[C3H7] */
-    }
-    else {
-        dqdc[0] = TB[23][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[23][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*sc[24];
-        dqdc[13] = TB[23][2]*dcdc_fac;
-        dqdc[14] = TB[23][3]*dcdc_fac;
-        dqdc[15] = TB[23][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac + k_f*sc[12];
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[23][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac - k_r;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+12] -= dqdc[k];
-            J[36*k+24] -= dqdc[k];
-            J[36*k+31] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[12] -= dcdc_fac;
+    Jmix[24] -= dcdc_fac;
+    Jmix[31] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[23][0] - 1)*dcdc_fac;
+    J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
+    J[24] -= dqdci;               /* dwdot[C2H4]/d[H2] */
+    J[31] += dqdci;               /* dwdot[C3H7]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[23][1] - 1)*dcdc_fac;
+    J[192] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[204] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
+    J[211] += dqdci;              /* dwdot[C3H7]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[24];
+    J[444] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[456] -= dqdci;              /* dwdot[C2H4]/d[CH3] */
+    J[463] += dqdci;              /* dwdot[C3H7]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[23][2] - 1)*dcdc_fac;
+    J[480] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[492] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
+    J[499] += dqdci;              /* dwdot[C3H7]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[23][3] - 1)*dcdc_fac;
+    J[516] -= dqdci;              /* dwdot[CH3]/d[CO] */
+    J[528] -= dqdci;              /* dwdot[C2H4]/d[CO] */
+    J[535] += dqdci;              /* dwdot[C3H7]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[23][4] - 1)*dcdc_fac;
+    J[552] -= dqdci;              /* dwdot[CH3]/d[CO2] */
+    J[564] -= dqdci;              /* dwdot[C2H4]/d[CO2] */
+    J[571] += dqdci;              /* dwdot[C3H7]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci =  + k_f*sc[12];
+    J[876] -= dqdci;              /* dwdot[CH3]/d[C2H4] */
+    J[888] -= dqdci;              /* dwdot[C2H4]/d[C2H4] */
+    J[895] += dqdci;              /* dwdot[C3H7]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[23][5] - 1)*dcdc_fac;
+    J[948] -= dqdci;              /* dwdot[CH3]/d[C2H6] */
+    J[960] -= dqdci;              /* dwdot[C2H4]/d[C2H6] */
+    J[967] += dqdci;              /* dwdot[C3H7]/d[C2H6] */
+    /* d()/d[C3H7] */
+    dqdci =  - k_r;
+    J[1128] -= dqdci;             /* dwdot[CH3]/d[C3H7] */
+    J[1140] -= dqdci;             /* dwdot[C2H4]/d[C3H7] */
+    J[1147] += dqdci;             /* dwdot[C3H7]/d[C3H7] */
     J[1272] -= dqdT; /* dwdot[CH3]/dT */
     J[1284] -= dqdT; /* dwdot[C2H4]/dT */
     J[1291] += dqdT; /* dwdot[C3H7]/dT */
@@ -20951,11 +20576,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[24][0] - 1)*sc[0] + (TB[24][1] - 1)*sc[5] + (TB[24][2] - 1)*sc[13] + (TB[24][3] - 1)*sc[14] + (TB[24][4] - 1)*sc[15] + (TB[24][5] - 1)*sc[26];
+    alpha = (memcmp(TB[24], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[24][0] - 1)*sc[0] + (TB[24][1] - 1)*sc[5] + (TB[24][2] - 1)*sc[13] + (TB[24][3] - 1)*sc[14] + (TB[24][4] - 1)*sc[15] + (TB[24][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[1]*sc[31];
-    k_f = prefactor_units[24] * fwd_A[24]
-                * exp(fwd_beta[24] * tc[0] - activation_units[24] * fwd_Ea[24] * invT);
+    k_f = k_f_s[24];
     dlnkfdT = fwd_beta[24] * invT + activation_units[24] * fwd_Ea[24] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[24] * exp(low_beta[24] * tc[0] - activation_units[24] * low_Ea[24] * invT);
@@ -20971,16 +20595,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[24] == 4 ? exp(-troe_Tss[24] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[24]) > 1.e-100 ? -Fcent1/troe_Tsss[24] : 0.)
+      + (fabs(troe_Ts[24]) > 1.e-100 ? -Fcent2/troe_Ts[24] : 0.)
+      + (troe_len[24] == 4 ? Fcent3*troe_Tss[24]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[24]) > 1.e-100 ? -Fcent1/troe_Tsss[24] : 0.)
-      + (fabs(troe_Ts[24]) > 1.e-100 ? -Fcent2/troe_Ts[24] : 0.)
-      + (troe_len[24] == 4 ? Fcent3*troe_Tss[24]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -20988,7 +20612,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[32];
-    Kc = refCinv * exp(g_RT[1] + g_RT[31] - g_RT[32]);
+    Kc = Kc_s[24];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[31]) + (h_RT[32]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21006,95 +20630,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[24][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[31] -= dqdci;               /* dwdot[C3H7]/d[H2] */
-        J[32] += dqdci;               /* dwdot[C3H8]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[31];
-        J[37] -= dqdci;               /* dwdot[H]/d[H] */
-        J[67] -= dqdci;               /* dwdot[C3H7]/d[H] */
-        J[68] += dqdci;               /* dwdot[C3H8]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[24][1] - 1)*dcdc_fac;
-        J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[211] -= dqdci;              /* dwdot[C3H7]/d[H2O] */
-        J[212] += dqdci;              /* dwdot[C3H8]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[24][2] - 1)*dcdc_fac;
-        J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[499] -= dqdci;              /* dwdot[C3H7]/d[CH4] */
-        J[500] += dqdci;              /* dwdot[C3H8]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[24][3] - 1)*dcdc_fac;
-        J[505] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[535] -= dqdci;              /* dwdot[C3H7]/d[CO] */
-        J[536] += dqdci;              /* dwdot[C3H8]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[24][4] - 1)*dcdc_fac;
-        J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[571] -= dqdci;              /* dwdot[C3H7]/d[CO2] */
-        J[572] += dqdci;              /* dwdot[C3H8]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[24][5] - 1)*dcdc_fac;
-        J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[967] -= dqdci;              /* dwdot[C3H7]/d[C2H6] */
-        J[968] += dqdci;              /* dwdot[C3H8]/d[C2H6] */
-        /* d()/d[C3H7] */
-        dqdci =  + k_f*sc[1];
-        J[1117] -= dqdci;             /* dwdot[H]/d[C3H7] */
-        J[1147] -= dqdci;             /* dwdot[C3H7]/d[C3H7] */
-        J[1148] += dqdci;             /* dwdot[C3H8]/d[C3H7] */
-        /* d()/d[C3H8] */
-        dqdci =  - k_r;
-        J[1153] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[1183] -= dqdci;             /* dwdot[C3H7]/d[C3H8] */
-        J[1184] += dqdci;             /* dwdot[C3H8]/d[C3H8] */
-    }
-    else {
-        dqdc[0] = TB[24][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[31];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[24][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[24][2]*dcdc_fac;
-        dqdc[14] = TB[24][3]*dcdc_fac;
-        dqdc[15] = TB[24][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[24][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac + k_f*sc[1];
-        dqdc[32] = dcdc_fac - k_r;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+1] -= dqdc[k];
-            J[36*k+31] -= dqdc[k];
-            J[36*k+32] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[31] -= dcdc_fac;
+    Jmix[32] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[24][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[31] -= dqdci;               /* dwdot[C3H7]/d[H2] */
+    J[32] += dqdci;               /* dwdot[C3H8]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[31];
+    J[37] -= dqdci;               /* dwdot[H]/d[H] */
+    J[67] -= dqdci;               /* dwdot[C3H7]/d[H] */
+    J[68] += dqdci;               /* dwdot[C3H8]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[24][1] - 1)*dcdc_fac;
+    J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[211] -= dqdci;              /* dwdot[C3H7]/d[H2O] */
+    J[212] += dqdci;              /* dwdot[C3H8]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[24][2] - 1)*dcdc_fac;
+    J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[499] -= dqdci;              /* dwdot[C3H7]/d[CH4] */
+    J[500] += dqdci;              /* dwdot[C3H8]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[24][3] - 1)*dcdc_fac;
+    J[505] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[535] -= dqdci;              /* dwdot[C3H7]/d[CO] */
+    J[536] += dqdci;              /* dwdot[C3H8]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[24][4] - 1)*dcdc_fac;
+    J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[571] -= dqdci;              /* dwdot[C3H7]/d[CO2] */
+    J[572] += dqdci;              /* dwdot[C3H8]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[24][5] - 1)*dcdc_fac;
+    J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[967] -= dqdci;              /* dwdot[C3H7]/d[C2H6] */
+    J[968] += dqdci;              /* dwdot[C3H8]/d[C2H6] */
+    /* d()/d[C3H7] */
+    dqdci =  + k_f*sc[1];
+    J[1117] -= dqdci;             /* dwdot[H]/d[C3H7] */
+    J[1147] -= dqdci;             /* dwdot[C3H7]/d[C3H7] */
+    J[1148] += dqdci;             /* dwdot[C3H8]/d[C3H7] */
+    /* d()/d[C3H8] */
+    dqdci =  - k_r;
+    J[1153] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[1183] -= dqdci;             /* dwdot[C3H7]/d[C3H8] */
+    J[1184] += dqdci;             /* dwdot[C3H8]/d[C3H8] */
     J[1261] -= dqdT; /* dwdot[H]/dT */
     J[1291] -= dqdT; /* dwdot[C3H7]/dT */
     J[1292] += dqdT; /* dwdot[C3H8]/dT */
@@ -21106,8 +20690,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[25][0] - 1)*sc[0] + (TB[25][1] - 1)*sc[3] + (TB[25][2] - 1)*sc[5] + (TB[25][3] - 1)*sc[13] + (TB[25][4] - 1)*sc[14] + (TB[25][5] - 1)*sc[15] + (TB[25][6] - 1)*sc[26];
     /* forward */
     phi_f = sc[2]*sc[14];
-    k_f = prefactor_units[25] * fwd_A[25]
-                * exp(fwd_beta[25] * tc[0] - activation_units[25] * fwd_Ea[25] * invT);
+    k_f = k_f_s[25];
     dlnkfdT = fwd_beta[25] * invT + activation_units[25] * fwd_Ea[25] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[25] * exp(low_beta[25] * tc[0] - activation_units[25] * low_Ea[25] * invT);
@@ -21122,7 +20705,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = 0.0;
     /* reverse */
     phi_r = sc[15];
-    Kc = refCinv * exp(g_RT[2] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[25];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[14]) + (h_RT[15]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21140,90 +20723,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[25][0] - 1)*dcdc_fac;
-        J[2] -= dqdci;                /* dwdot[O]/d[H2] */
-        J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
-        J[15] += dqdci;               /* dwdot[CO2]/d[H2] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[14];
-        J[74] -= dqdci;               /* dwdot[O]/d[O] */
-        J[86] -= dqdci;               /* dwdot[CO]/d[O] */
-        J[87] += dqdci;               /* dwdot[CO2]/d[O] */
-        /* d()/d[O2] */
-        dqdci = (TB[25][1] - 1)*dcdc_fac;
-        J[110] -= dqdci;              /* dwdot[O]/d[O2] */
-        J[122] -= dqdci;              /* dwdot[CO]/d[O2] */
-        J[123] += dqdci;              /* dwdot[CO2]/d[O2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[25][2] - 1)*dcdc_fac;
-        J[182] -= dqdci;              /* dwdot[O]/d[H2O] */
-        J[194] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[195] += dqdci;              /* dwdot[CO2]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[25][3] - 1)*dcdc_fac;
-        J[470] -= dqdci;              /* dwdot[O]/d[CH4] */
-        J[482] -= dqdci;              /* dwdot[CO]/d[CH4] */
-        J[483] += dqdci;              /* dwdot[CO2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[25][4] - 1)*dcdc_fac + k_f*sc[2];
-        J[506] -= dqdci;              /* dwdot[O]/d[CO] */
-        J[518] -= dqdci;              /* dwdot[CO]/d[CO] */
-        J[519] += dqdci;              /* dwdot[CO2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[25][5] - 1)*dcdc_fac - k_r;
-        J[542] -= dqdci;              /* dwdot[O]/d[CO2] */
-        J[554] -= dqdci;              /* dwdot[CO]/d[CO2] */
-        J[555] += dqdci;              /* dwdot[CO2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[25][6] - 1)*dcdc_fac;
-        J[938] -= dqdci;              /* dwdot[O]/d[C2H6] */
-        J[950] -= dqdci;              /* dwdot[CO]/d[C2H6] */
-        J[951] += dqdci;              /* dwdot[CO2]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[25][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*sc[14];
-        dqdc[3] = TB[25][1]*dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[25][2]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[25][3]*dcdc_fac;
-        dqdc[14] = TB[25][4]*dcdc_fac + k_f*sc[2];
-        dqdc[15] = TB[25][5]*dcdc_fac - k_r;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[25][6]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+2] -= dqdc[k];
-            J[36*k+14] -= dqdc[k];
-            J[36*k+15] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] -= dcdc_fac;
+    Jmix[14] -= dcdc_fac;
+    Jmix[15] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[25][0] - 1)*dcdc_fac;
+    J[2] -= dqdci;                /* dwdot[O]/d[H2] */
+    J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
+    J[15] += dqdci;               /* dwdot[CO2]/d[H2] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[14];
+    J[74] -= dqdci;               /* dwdot[O]/d[O] */
+    J[86] -= dqdci;               /* dwdot[CO]/d[O] */
+    J[87] += dqdci;               /* dwdot[CO2]/d[O] */
+    /* d()/d[O2] */
+    dqdci = (TB[25][1] - 1)*dcdc_fac;
+    J[110] -= dqdci;              /* dwdot[O]/d[O2] */
+    J[122] -= dqdci;              /* dwdot[CO]/d[O2] */
+    J[123] += dqdci;              /* dwdot[CO2]/d[O2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[25][2] - 1)*dcdc_fac;
+    J[182] -= dqdci;              /* dwdot[O]/d[H2O] */
+    J[194] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[195] += dqdci;              /* dwdot[CO2]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[25][3] - 1)*dcdc_fac;
+    J[470] -= dqdci;              /* dwdot[O]/d[CH4] */
+    J[482] -= dqdci;              /* dwdot[CO]/d[CH4] */
+    J[483] += dqdci;              /* dwdot[CO2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[25][4] - 1)*dcdc_fac + k_f*sc[2];
+    J[506] -= dqdci;              /* dwdot[O]/d[CO] */
+    J[518] -= dqdci;              /* dwdot[CO]/d[CO] */
+    J[519] += dqdci;              /* dwdot[CO2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[25][5] - 1)*dcdc_fac - k_r;
+    J[542] -= dqdci;              /* dwdot[O]/d[CO2] */
+    J[554] -= dqdci;              /* dwdot[CO]/d[CO2] */
+    J[555] += dqdci;              /* dwdot[CO2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[25][6] - 1)*dcdc_fac;
+    J[938] -= dqdci;              /* dwdot[O]/d[C2H6] */
+    J[950] -= dqdci;              /* dwdot[CO]/d[C2H6] */
+    J[951] += dqdci;              /* dwdot[CO2]/d[C2H6] */
     J[1262] -= dqdT; /* dwdot[O]/dT */
     J[1274] -= dqdT; /* dwdot[CO]/dT */
     J[1275] += dqdT; /* dwdot[CO2]/dT */
@@ -21234,12 +20777,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[26][0] - 1)*sc[0] + (TB[26][1] - 1)*sc[5] + (TB[26][2] - 1)*sc[13] + (TB[26][3] - 1)*sc[14] + (TB[26][4] - 1)*sc[15] + (TB[26][5] - 1)*sc[26];
     /* forward */
     phi_f = sc[2]*sc[2];
-    k_f = prefactor_units[26] * fwd_A[26]
-                * exp(fwd_beta[26] * tc[0] - activation_units[26] * fwd_Ea[26] * invT);
+    k_f = k_f_s[26];
     dlnkfdT = fwd_beta[26] * invT + activation_units[26] * fwd_Ea[26] * invT2;
     /* reverse */
     phi_r = sc[3];
-    Kc = refCinv * exp(2*g_RT[2] - g_RT[3]);
+    Kc = Kc_s[26];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[2]) + (h_RT[3]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21253,96 +20795,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[26][0] - 1)*q_nocor;
-        J[2] += -2 * dqdci;           /* dwdot[O]/d[H2] */
-        J[3] += dqdci;                /* dwdot[O2]/d[H2] */
-        /* d()/d[O] */
-        dqdci =  + k_f*2*sc[2];
-        J[74] += -2 * dqdci;          /* dwdot[O]/d[O] */
-        J[75] += dqdci;               /* dwdot[O2]/d[O] */
-        /* d()/d[O2] */
-        dqdci =  - k_r;
-        J[110] += -2 * dqdci;         /* dwdot[O]/d[O2] */
-        J[111] += dqdci;              /* dwdot[O2]/d[O2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[26][1] - 1)*q_nocor;
-        J[182] += -2 * dqdci;         /* dwdot[O]/d[H2O] */
-        J[183] += dqdci;              /* dwdot[O2]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[26][2] - 1)*q_nocor;
-        J[470] += -2 * dqdci;         /* dwdot[O]/d[CH4] */
-        J[471] += dqdci;              /* dwdot[O2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[26][3] - 1)*q_nocor;
-        J[506] += -2 * dqdci;         /* dwdot[O]/d[CO] */
-        J[507] += dqdci;              /* dwdot[O2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[26][4] - 1)*q_nocor;
-        J[542] += -2 * dqdci;         /* dwdot[O]/d[CO2] */
-        J[543] += dqdci;              /* dwdot[O2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[26][5] - 1)*q_nocor;
-        J[938] += -2 * dqdci;         /* dwdot[O]/d[C2H6] */
-        J[939] += dqdci;              /* dwdot[O2]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[26][0];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*2*sc[2];
-        dqdc[3] = dcdc_fac - k_r;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[26][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[26][2];
-        dqdc[14] = TB[26][3];
-        dqdc[15] = TB[26][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[26][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+2] += -2 * dqdc[k];
-            J[36*k+3] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] += -2 * q_nocor;
+    Jmix[3] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[26][0] - 1)*q_nocor;
+    J[2] += -2 * dqdci;           /* dwdot[O]/d[H2] */
+    J[3] += dqdci;                /* dwdot[O2]/d[H2] */
+    /* d()/d[O] */
+    dqdci =  + k_f*2*sc[2];
+    J[74] += -2 * dqdci;          /* dwdot[O]/d[O] */
+    J[75] += dqdci;               /* dwdot[O2]/d[O] */
+    /* d()/d[O2] */
+    dqdci =  - k_r;
+    J[110] += -2 * dqdci;         /* dwdot[O]/d[O2] */
+    J[111] += dqdci;              /* dwdot[O2]/d[O2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[26][1] - 1)*q_nocor;
+    J[182] += -2 * dqdci;         /* dwdot[O]/d[H2O] */
+    J[183] += dqdci;              /* dwdot[O2]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[26][2] - 1)*q_nocor;
+    J[470] += -2 * dqdci;         /* dwdot[O]/d[CH4] */
+    J[471] += dqdci;              /* dwdot[O2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[26][3] - 1)*q_nocor;
+    J[506] += -2 * dqdci;         /* dwdot[O]/d[CO] */
+    J[507] += dqdci;              /* dwdot[O2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[26][4] - 1)*q_nocor;
+    J[542] += -2 * dqdci;         /* dwdot[O]/d[CO2] */
+    J[543] += dqdci;              /* dwdot[O2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[26][5] - 1)*q_nocor;
+    J[938] += -2 * dqdci;         /* dwdot[O]/d[C2H6] */
+    J[939] += dqdci;              /* dwdot[O2]/d[C2H6] */
     J[1262] += -2 * dqdT; /* dwdot[O]/dT */
     J[1263] += dqdT; /* dwdot[O2]/dT */
 
     /*reaction 28: O + H + M <=> OH + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[27][0] - 1)*sc[0] + (TB[27][1] - 1)*sc[5] + (TB[27][2] - 1)*sc[13] + (TB[27][3] - 1)*sc[14] + (TB[27][4] - 1)*sc[15] + (TB[27][5] - 1)*sc[26];
+    alpha = (memcmp(TB[27], TB[0], 6*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[27][0] - 1)*sc[0] + (TB[27][1] - 1)*sc[5] + (TB[27][2] - 1)*sc[13] + (TB[27][3] - 1)*sc[14] + (TB[27][4] - 1)*sc[15] + (TB[27][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[1]*sc[2];
-    k_f = prefactor_units[27] * fwd_A[27]
-                * exp(fwd_beta[27] * tc[0] - activation_units[27] * fwd_Ea[27] * invT);
+    k_f = k_f_s[27];
     dlnkfdT = fwd_beta[27] * invT + activation_units[27] * fwd_Ea[27] * invT2;
     /* reverse */
     phi_r = sc[4];
-    Kc = refCinv * exp(g_RT[1] + g_RT[2] - g_RT[4]);
+    Kc = Kc_s[27];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[2]) + (h_RT[4]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21357,95 +20858,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[27][0] - 1)*q_nocor;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[2] -= dqdci;                /* dwdot[O]/d[H2] */
-        J[4] += dqdci;                /* dwdot[OH]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[2];
-        J[37] -= dqdci;               /* dwdot[H]/d[H] */
-        J[38] -= dqdci;               /* dwdot[O]/d[H] */
-        J[40] += dqdci;               /* dwdot[OH]/d[H] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[1];
-        J[73] -= dqdci;               /* dwdot[H]/d[O] */
-        J[74] -= dqdci;               /* dwdot[O]/d[O] */
-        J[76] += dqdci;               /* dwdot[OH]/d[O] */
-        /* d()/d[OH] */
-        dqdci =  - k_r;
-        J[145] -= dqdci;              /* dwdot[H]/d[OH] */
-        J[146] -= dqdci;              /* dwdot[O]/d[OH] */
-        J[148] += dqdci;              /* dwdot[OH]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[27][1] - 1)*q_nocor;
-        J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[182] -= dqdci;              /* dwdot[O]/d[H2O] */
-        J[184] += dqdci;              /* dwdot[OH]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[27][2] - 1)*q_nocor;
-        J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[470] -= dqdci;              /* dwdot[O]/d[CH4] */
-        J[472] += dqdci;              /* dwdot[OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[27][3] - 1)*q_nocor;
-        J[505] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[506] -= dqdci;              /* dwdot[O]/d[CO] */
-        J[508] += dqdci;              /* dwdot[OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[27][4] - 1)*q_nocor;
-        J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[542] -= dqdci;              /* dwdot[O]/d[CO2] */
-        J[544] += dqdci;              /* dwdot[OH]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[27][5] - 1)*q_nocor;
-        J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[938] -= dqdci;              /* dwdot[O]/d[C2H6] */
-        J[940] += dqdci;              /* dwdot[OH]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[27][0];
-        dqdc[1] = dcdc_fac + k_f*sc[2];
-        dqdc[2] = dcdc_fac + k_f*sc[1];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac - k_r;
-        dqdc[5] = TB[27][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[27][2];
-        dqdc[14] = TB[27][3];
-        dqdc[15] = TB[27][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[27][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+1] -= dqdc[k];
-            J[36*k+2] -= dqdc[k];
-            J[36*k+4] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= q_nocor;
+    Jmix[2] -= q_nocor;
+    Jmix[4] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[27][0] - 1)*q_nocor;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[2] -= dqdci;                /* dwdot[O]/d[H2] */
+    J[4] += dqdci;                /* dwdot[OH]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[2];
+    J[37] -= dqdci;               /* dwdot[H]/d[H] */
+    J[38] -= dqdci;               /* dwdot[O]/d[H] */
+    J[40] += dqdci;               /* dwdot[OH]/d[H] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[1];
+    J[73] -= dqdci;               /* dwdot[H]/d[O] */
+    J[74] -= dqdci;               /* dwdot[O]/d[O] */
+    J[76] += dqdci;               /* dwdot[OH]/d[O] */
+    /* d()/d[OH] */
+    dqdci =  - k_r;
+    J[145] -= dqdci;              /* dwdot[H]/d[OH] */
+    J[146] -= dqdci;              /* dwdot[O]/d[OH] */
+    J[148] += dqdci;              /* dwdot[OH]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[27][1] - 1)*q_nocor;
+    J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[182] -= dqdci;              /* dwdot[O]/d[H2O] */
+    J[184] += dqdci;              /* dwdot[OH]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[27][2] - 1)*q_nocor;
+    J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[470] -= dqdci;              /* dwdot[O]/d[CH4] */
+    J[472] += dqdci;              /* dwdot[OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[27][3] - 1)*q_nocor;
+    J[505] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[506] -= dqdci;              /* dwdot[O]/d[CO] */
+    J[508] += dqdci;              /* dwdot[OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[27][4] - 1)*q_nocor;
+    J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[542] -= dqdci;              /* dwdot[O]/d[CO2] */
+    J[544] += dqdci;              /* dwdot[OH]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[27][5] - 1)*q_nocor;
+    J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[938] -= dqdci;              /* dwdot[O]/d[C2H6] */
+    J[940] += dqdci;              /* dwdot[OH]/d[C2H6] */
     J[1261] -= dqdT; /* dwdot[H]/dT */
     J[1262] -= dqdT; /* dwdot[O]/dT */
     J[1264] += dqdT; /* dwdot[OH]/dT */
@@ -21456,12 +20917,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[28][0] - 1)*sc[3] + (TB[28][1] - 1)*sc[5] + (TB[28][2] - 1)*sc[14] + (TB[28][3] - 1)*sc[15] + (TB[28][4] - 1)*sc[26] + (TB[28][5] - 1)*sc[30];
     /* forward */
     phi_f = sc[1]*sc[3];
-    k_f = prefactor_units[28] * fwd_A[28]
-                * exp(fwd_beta[28] * tc[0] - activation_units[28] * fwd_Ea[28] * invT);
+    k_f = k_f_s[28];
     dlnkfdT = fwd_beta[28] * invT + activation_units[28] * fwd_Ea[28] * invT2;
     /* reverse */
     phi_r = sc[6];
-    Kc = refCinv * exp(g_RT[1] + g_RT[3] - g_RT[6]);
+    Kc = Kc_s[28];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3]) + (h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21476,90 +20936,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[3];
-        J[37] -= dqdci;               /* dwdot[H]/d[H] */
-        J[39] -= dqdci;               /* dwdot[O2]/d[H] */
-        J[42] += dqdci;               /* dwdot[HO2]/d[H] */
-        /* d()/d[O2] */
-        dqdci = (TB[28][0] - 1)*q_nocor + k_f*sc[1];
-        J[109] -= dqdci;              /* dwdot[H]/d[O2] */
-        J[111] -= dqdci;              /* dwdot[O2]/d[O2] */
-        J[114] += dqdci;              /* dwdot[HO2]/d[O2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[28][1] - 1)*q_nocor;
-        J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[183] -= dqdci;              /* dwdot[O2]/d[H2O] */
-        J[186] += dqdci;              /* dwdot[HO2]/d[H2O] */
-        /* d()/d[HO2] */
-        dqdci =  - k_r;
-        J[217] -= dqdci;              /* dwdot[H]/d[HO2] */
-        J[219] -= dqdci;              /* dwdot[O2]/d[HO2] */
-        J[222] += dqdci;              /* dwdot[HO2]/d[HO2] */
-        /* d()/d[CO] */
-        dqdci = (TB[28][2] - 1)*q_nocor;
-        J[505] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[507] -= dqdci;              /* dwdot[O2]/d[CO] */
-        J[510] += dqdci;              /* dwdot[HO2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[28][3] - 1)*q_nocor;
-        J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[543] -= dqdci;              /* dwdot[O2]/d[CO2] */
-        J[546] += dqdci;              /* dwdot[HO2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[28][4] - 1)*q_nocor;
-        J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[939] -= dqdci;              /* dwdot[O2]/d[C2H6] */
-        J[942] += dqdci;              /* dwdot[HO2]/d[C2H6] */
-        /* d()/d[N2] */
-        dqdci = (TB[28][5] - 1)*q_nocor;
-        J[1081] -= dqdci;             /* dwdot[H]/d[N2] */
-        J[1083] -= dqdci;             /* dwdot[O2]/d[N2] */
-        J[1086] += dqdci;             /* dwdot[HO2]/d[N2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[3];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = TB[28][0] + k_f*sc[1];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[28][1];
-        dqdc[6] = dcdc_fac - k_r;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = TB[28][2];
-        dqdc[15] = TB[28][3];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[28][4];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[28][5];
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+1] -= dqdc[k];
-            J[36*k+3] -= dqdc[k];
-            J[36*k+6] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= q_nocor;
+    Jmix[3] -= q_nocor;
+    Jmix[6] += q_nocor;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[3];
+    J[37] -= dqdci;               /* dwdot[H]/d[H] */
+    J[39] -= dqdci;               /* dwdot[O2]/d[H] */
+    J[42] += dqdci;               /* dwdot[HO2]/d[H] */
+    /* d()/d[O2] */
+    dqdci = (TB[28][0] - 1)*q_nocor + k_f*sc[1];
+    J[109] -= dqdci;              /* dwdot[H]/d[O2] */
+    J[111] -= dqdci;              /* dwdot[O2]/d[O2] */
+    J[114] += dqdci;              /* dwdot[HO2]/d[O2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[28][1] - 1)*q_nocor;
+    J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[183] -= dqdci;              /* dwdot[O2]/d[H2O] */
+    J[186] += dqdci;              /* dwdot[HO2]/d[H2O] */
+    /* d()/d[HO2] */
+    dqdci =  - k_r;
+    J[217] -= dqdci;              /* dwdot[H]/d[HO2] */
+    J[219] -= dqdci;              /* dwdot[O2]/d[HO2] */
+    J[222] += dqdci;              /* dwdot[HO2]/d[HO2] */
+    /* d()/d[CO] */
+    dqdci = (TB[28][2] - 1)*q_nocor;
+    J[505] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[507] -= dqdci;              /* dwdot[O2]/d[CO] */
+    J[510] += dqdci;              /* dwdot[HO2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[28][3] - 1)*q_nocor;
+    J[541] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[543] -= dqdci;              /* dwdot[O2]/d[CO2] */
+    J[546] += dqdci;              /* dwdot[HO2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[28][4] - 1)*q_nocor;
+    J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[939] -= dqdci;              /* dwdot[O2]/d[C2H6] */
+    J[942] += dqdci;              /* dwdot[HO2]/d[C2H6] */
+    /* d()/d[N2] */
+    dqdci = (TB[28][5] - 1)*q_nocor;
+    J[1081] -= dqdci;             /* dwdot[H]/d[N2] */
+    J[1083] -= dqdci;             /* dwdot[O2]/d[N2] */
+    J[1086] += dqdci;             /* dwdot[HO2]/d[N2] */
     J[1261] -= dqdT; /* dwdot[H]/dT */
     J[1263] -= dqdT; /* dwdot[O2]/dT */
     J[1266] += dqdT; /* dwdot[HO2]/dT */
@@ -21570,12 +20990,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[29][0] - 1)*sc[0] + (TB[29][1] - 1)*sc[5] + (TB[29][2] - 1)*sc[13] + (TB[29][3] - 1)*sc[15] + (TB[29][4] - 1)*sc[26];
     /* forward */
     phi_f = sc[1]*sc[1];
-    k_f = prefactor_units[29] * fwd_A[29]
-                * exp(fwd_beta[29] * tc[0] - activation_units[29] * fwd_Ea[29] * invT);
+    k_f = k_f_s[29];
     dlnkfdT = fwd_beta[29] * invT + activation_units[29] * fwd_Ea[29] * invT2;
     /* reverse */
     phi_r = sc[0];
-    Kc = refCinv * exp(-g_RT[0] + 2*g_RT[1]);
+    Kc = Kc_s[29];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[1]) + (h_RT[0]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21589,73 +21008,33 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[29][0] - 1)*q_nocor - k_r;
-        J[0] += dqdci;                /* dwdot[H2]/d[H2] */
-        J[1] += -2 * dqdci;           /* dwdot[H]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*2*sc[1];
-        J[36] += dqdci;               /* dwdot[H2]/d[H] */
-        J[37] += -2 * dqdci;          /* dwdot[H]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[29][1] - 1)*q_nocor;
-        J[180] += dqdci;              /* dwdot[H2]/d[H2O] */
-        J[181] += -2 * dqdci;         /* dwdot[H]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[29][2] - 1)*q_nocor;
-        J[468] += dqdci;              /* dwdot[H2]/d[CH4] */
-        J[469] += -2 * dqdci;         /* dwdot[H]/d[CH4] */
-        /* d()/d[CO2] */
-        dqdci = (TB[29][3] - 1)*q_nocor;
-        J[540] += dqdci;              /* dwdot[H2]/d[CO2] */
-        J[541] += -2 * dqdci;         /* dwdot[H]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[29][4] - 1)*q_nocor;
-        J[936] += dqdci;              /* dwdot[H2]/d[C2H6] */
-        J[937] += -2 * dqdci;         /* dwdot[H]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[29][0] - k_r;
-        dqdc[1] = dcdc_fac + k_f*2*sc[1];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[29][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[29][2];
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[29][3];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[29][4];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+0] += dqdc[k];
-            J[36*k+1] += -2 * dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += q_nocor;
+    Jmix[1] += -2 * q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[29][0] - 1)*q_nocor - k_r;
+    J[0] += dqdci;                /* dwdot[H2]/d[H2] */
+    J[1] += -2 * dqdci;           /* dwdot[H]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*2*sc[1];
+    J[36] += dqdci;               /* dwdot[H2]/d[H] */
+    J[37] += -2 * dqdci;          /* dwdot[H]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[29][1] - 1)*q_nocor;
+    J[180] += dqdci;              /* dwdot[H2]/d[H2O] */
+    J[181] += -2 * dqdci;         /* dwdot[H]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[29][2] - 1)*q_nocor;
+    J[468] += dqdci;              /* dwdot[H2]/d[CH4] */
+    J[469] += -2 * dqdci;         /* dwdot[H]/d[CH4] */
+    /* d()/d[CO2] */
+    dqdci = (TB[29][3] - 1)*q_nocor;
+    J[540] += dqdci;              /* dwdot[H2]/d[CO2] */
+    J[541] += -2 * dqdci;         /* dwdot[H]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[29][4] - 1)*q_nocor;
+    J[936] += dqdci;              /* dwdot[H2]/d[C2H6] */
+    J[937] += -2 * dqdci;         /* dwdot[H]/d[C2H6] */
     J[1260] += dqdT; /* dwdot[H2]/dT */
     J[1261] += -2 * dqdT; /* dwdot[H]/dT */
 
@@ -21665,12 +21044,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[30][0] - 1)*sc[0] + (TB[30][1] - 1)*sc[5] + (TB[30][2] - 1)*sc[13] + (TB[30][3] - 1)*sc[26];
     /* forward */
     phi_f = sc[1]*sc[4];
-    k_f = prefactor_units[30] * fwd_A[30]
-                * exp(fwd_beta[30] * tc[0] - activation_units[30] * fwd_Ea[30] * invT);
+    k_f = k_f_s[30];
     dlnkfdT = fwd_beta[30] * invT + activation_units[30] * fwd_Ea[30] * invT2;
     /* reverse */
     phi_r = sc[5];
-    Kc = refCinv * exp(g_RT[1] + g_RT[4] - g_RT[5]);
+    Kc = Kc_s[30];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[4]) + (h_RT[5]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21685,80 +21063,40 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[30][0] - 1)*q_nocor;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[4] -= dqdci;                /* dwdot[OH]/d[H2] */
-        J[5] += dqdci;                /* dwdot[H2O]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[4];
-        J[37] -= dqdci;               /* dwdot[H]/d[H] */
-        J[40] -= dqdci;               /* dwdot[OH]/d[H] */
-        J[41] += dqdci;               /* dwdot[H2O]/d[H] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*sc[1];
-        J[145] -= dqdci;              /* dwdot[H]/d[OH] */
-        J[148] -= dqdci;              /* dwdot[OH]/d[OH] */
-        J[149] += dqdci;              /* dwdot[H2O]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[30][1] - 1)*q_nocor - k_r;
-        J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[184] -= dqdci;              /* dwdot[OH]/d[H2O] */
-        J[185] += dqdci;              /* dwdot[H2O]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[30][2] - 1)*q_nocor;
-        J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[472] -= dqdci;              /* dwdot[OH]/d[CH4] */
-        J[473] += dqdci;              /* dwdot[H2O]/d[CH4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[30][3] - 1)*q_nocor;
-        J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[940] -= dqdci;              /* dwdot[OH]/d[C2H6] */
-        J[941] += dqdci;              /* dwdot[H2O]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[30][0];
-        dqdc[1] = dcdc_fac + k_f*sc[4];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac + k_f*sc[1];
-        dqdc[5] = TB[30][1] - k_r;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[30][2];
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[30][3];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+1] -= dqdc[k];
-            J[36*k+4] -= dqdc[k];
-            J[36*k+5] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= q_nocor;
+    Jmix[4] -= q_nocor;
+    Jmix[5] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[30][0] - 1)*q_nocor;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[4] -= dqdci;                /* dwdot[OH]/d[H2] */
+    J[5] += dqdci;                /* dwdot[H2O]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[4];
+    J[37] -= dqdci;               /* dwdot[H]/d[H] */
+    J[40] -= dqdci;               /* dwdot[OH]/d[H] */
+    J[41] += dqdci;               /* dwdot[H2O]/d[H] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*sc[1];
+    J[145] -= dqdci;              /* dwdot[H]/d[OH] */
+    J[148] -= dqdci;              /* dwdot[OH]/d[OH] */
+    J[149] += dqdci;              /* dwdot[H2O]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[30][1] - 1)*q_nocor - k_r;
+    J[181] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[184] -= dqdci;              /* dwdot[OH]/d[H2O] */
+    J[185] += dqdci;              /* dwdot[H2O]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[30][2] - 1)*q_nocor;
+    J[469] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[472] -= dqdci;              /* dwdot[OH]/d[CH4] */
+    J[473] += dqdci;              /* dwdot[H2O]/d[CH4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[30][3] - 1)*q_nocor;
+    J[937] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[940] -= dqdci;              /* dwdot[OH]/d[C2H6] */
+    J[941] += dqdci;              /* dwdot[H2O]/d[C2H6] */
     J[1261] -= dqdT; /* dwdot[H]/dT */
     J[1264] -= dqdT; /* dwdot[OH]/dT */
     J[1265] += dqdT; /* dwdot[H2O]/dT */
@@ -21769,12 +21107,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[31][0] - 1)*sc[0] + (TB[31][1] - 1)*sc[5] + (TB[31][2] - 1)*sc[13] + (TB[31][3] - 1)*sc[14] + (TB[31][4] - 1)*sc[15] + (TB[31][5] - 1)*sc[26];
     /* forward */
     phi_f = sc[16];
-    k_f = prefactor_units[31] * fwd_A[31]
-                * exp(fwd_beta[31] * tc[0] - activation_units[31] * fwd_Ea[31] * invT);
+    k_f = k_f_s[31];
     dlnkfdT = fwd_beta[31] * invT + activation_units[31] * fwd_Ea[31] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14];
-    Kc = refC * exp(-g_RT[1] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[31];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16]) + (h_RT[1] + h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21789,90 +21126,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[31][0] - 1)*q_nocor;
-        J[1] += dqdci;                /* dwdot[H]/d[H2] */
-        J[14] += dqdci;               /* dwdot[CO]/d[H2] */
-        J[16] -= dqdci;               /* dwdot[HCO]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[14];
-        J[37] += dqdci;               /* dwdot[H]/d[H] */
-        J[50] += dqdci;               /* dwdot[CO]/d[H] */
-        J[52] -= dqdci;               /* dwdot[HCO]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[31][1] - 1)*q_nocor;
-        J[181] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[194] += dqdci;              /* dwdot[CO]/d[H2O] */
-        J[196] -= dqdci;              /* dwdot[HCO]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[31][2] - 1)*q_nocor;
-        J[469] += dqdci;              /* dwdot[H]/d[CH4] */
-        J[482] += dqdci;              /* dwdot[CO]/d[CH4] */
-        J[484] -= dqdci;              /* dwdot[HCO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[31][3] - 1)*q_nocor - k_r*sc[1];
-        J[505] += dqdci;              /* dwdot[H]/d[CO] */
-        J[518] += dqdci;              /* dwdot[CO]/d[CO] */
-        J[520] -= dqdci;              /* dwdot[HCO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[31][4] - 1)*q_nocor;
-        J[541] += dqdci;              /* dwdot[H]/d[CO2] */
-        J[554] += dqdci;              /* dwdot[CO]/d[CO2] */
-        J[556] -= dqdci;              /* dwdot[HCO]/d[CO2] */
-        /* d()/d[HCO] */
-        dqdci =  + k_f;
-        J[577] += dqdci;              /* dwdot[H]/d[HCO] */
-        J[590] += dqdci;              /* dwdot[CO]/d[HCO] */
-        J[592] -= dqdci;              /* dwdot[HCO]/d[HCO] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[31][5] - 1)*q_nocor;
-        J[937] += dqdci;              /* dwdot[H]/d[C2H6] */
-        J[950] += dqdci;              /* dwdot[CO]/d[C2H6] */
-        J[952] -= dqdci;              /* dwdot[HCO]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[31][0];
-        dqdc[1] = dcdc_fac - k_r*sc[14];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[31][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[31][2];
-        dqdc[14] = TB[31][3] - k_r*sc[1];
-        dqdc[15] = TB[31][4];
-        dqdc[16] = dcdc_fac + k_f;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[31][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        for (int k=0; k<35; k++) {
-            J[36*k+1] += dqdc[k];
-            J[36*k+14] += dqdc[k];
-            J[36*k+16] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] += q_nocor;
+    Jmix[14] += q_nocor;
+    Jmix[16] -= q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[31][0] - 1)*q_nocor;
+    J[1] += dqdci;                /* dwdot[H]/d[H2] */
+    J[14] += dqdci;               /* dwdot[CO]/d[H2] */
+    J[16] -= dqdci;               /* dwdot[HCO]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[14];
+    J[37] += dqdci;               /* dwdot[H]/d[H] */
+    J[50] += dqdci;               /* dwdot[CO]/d[H] */
+    J[52] -= dqdci;               /* dwdot[HCO]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[31][1] - 1)*q_nocor;
+    J[181] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[194] += dqdci;              /* dwdot[CO]/d[H2O] */
+    J[196] -= dqdci;              /* dwdot[HCO]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[31][2] - 1)*q_nocor;
+    J[469] += dqdci;              /* dwdot[H]/d[CH4] */
+    J[482] += dqdci;              /* dwdot[CO]/d[CH4] */
+    J[484] -= dqdci;              /* dwdot[HCO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[31][3] - 1)*q_nocor - k_r*sc[1];
+    J[505] += dqdci;              /* dwdot[H]/d[CO] */
+    J[518] += dqdci;              /* dwdot[CO]/d[CO] */
+    J[520] -= dqdci;              /* dwdot[HCO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[31][4] - 1)*q_nocor;
+    J[541] += dqdci;              /* dwdot[H]/d[CO2] */
+    J[554] += dqdci;              /* dwdot[CO]/d[CO2] */
+    J[556] -= dqdci;              /* dwdot[HCO]/d[CO2] */
+    /* d()/d[HCO] */
+    dqdci =  + k_f;
+    J[577] += dqdci;              /* dwdot[H]/d[HCO] */
+    J[590] += dqdci;              /* dwdot[CO]/d[HCO] */
+    J[592] -= dqdci;              /* dwdot[HCO]/d[HCO] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[31][5] - 1)*q_nocor;
+    J[937] += dqdci;              /* dwdot[H]/d[C2H6] */
+    J[950] += dqdci;              /* dwdot[CO]/d[C2H6] */
+    J[952] -= dqdci;              /* dwdot[HCO]/d[C2H6] */
     J[1261] += dqdT; /* dwdot[H]/dT */
     J[1274] += dqdT; /* dwdot[CO]/dT */
     J[1276] -= dqdT; /* dwdot[HCO]/dT */
@@ -21881,12 +21178,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[2];
-    k_f = prefactor_units[32] * fwd_A[32]
-                * exp(fwd_beta[32] * tc[0] - activation_units[32] * fwd_Ea[32] * invT);
+    k_f = k_f_s[32];
     dlnkfdT = fwd_beta[32] * invT + activation_units[32] * fwd_Ea[32] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[4];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[2] - g_RT[4]);
+    Kc = Kc_s[32];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[2]) + (h_RT[1] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21932,12 +21228,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[6];
-    k_f = prefactor_units[33] * fwd_A[33]
-                * exp(fwd_beta[33] * tc[0] - activation_units[33] * fwd_Ea[33] * invT);
+    k_f = k_f_s[33];
     dlnkfdT = fwd_beta[33] * invT + activation_units[33] * fwd_Ea[33] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[4];
-    Kc = exp(g_RT[2] - g_RT[3] - g_RT[4] + g_RT[6]);
+    Kc = Kc_s[33];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[6]) + (h_RT[3] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21983,12 +21278,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[7];
-    k_f = prefactor_units[34] * fwd_A[34]
-                * exp(fwd_beta[34] * tc[0] - activation_units[34] * fwd_Ea[34] * invT);
+    k_f = k_f_s[34];
     dlnkfdT = fwd_beta[34] * invT + activation_units[34] * fwd_Ea[34] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[6];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[34];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[7]) + (h_RT[4] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22034,12 +21328,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[9];
-    k_f = prefactor_units[35] * fwd_A[35]
-                * exp(fwd_beta[35] * tc[0] - activation_units[35] * fwd_Ea[35] * invT);
+    k_f = k_f_s[35];
     dlnkfdT = fwd_beta[35] * invT + activation_units[35] * fwd_Ea[35] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[9] - g_RT[14]);
+    Kc = Kc_s[35];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[9]) + (h_RT[1] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22085,12 +21378,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[10];
-    k_f = prefactor_units[36] * fwd_A[36]
-                * exp(fwd_beta[36] * tc[0] - activation_units[36] * fwd_Ea[36] * invT);
+    k_f = k_f_s[36];
     dlnkfdT = fwd_beta[36] * invT + activation_units[36] * fwd_Ea[36] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[16];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[10] - g_RT[16]);
+    Kc = Kc_s[36];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[10]) + (h_RT[1] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22136,12 +21428,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[11];
-    k_f = prefactor_units[37] * fwd_A[37]
-                * exp(fwd_beta[37] * tc[0] - activation_units[37] * fwd_Ea[37] * invT);
+    k_f = k_f_s[37];
     dlnkfdT = fwd_beta[37] * invT + activation_units[37] * fwd_Ea[37] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[14];
-    Kc = exp(-g_RT[0] + g_RT[2] + g_RT[11] - g_RT[14]);
+    Kc = Kc_s[37];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[11]) + (h_RT[0] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22187,12 +21478,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[11];
-    k_f = prefactor_units[38] * fwd_A[38]
-                * exp(fwd_beta[38] * tc[0] - activation_units[38] * fwd_Ea[38] * invT);
+    k_f = k_f_s[38];
     dlnkfdT = fwd_beta[38] * invT + activation_units[38] * fwd_Ea[38] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[16];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[11] - g_RT[16]);
+    Kc = Kc_s[38];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[11]) + (h_RT[1] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22238,12 +21528,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[12];
-    k_f = prefactor_units[39] * fwd_A[39]
-                * exp(fwd_beta[39] * tc[0] - activation_units[39] * fwd_Ea[39] * invT);
+    k_f = k_f_s[39];
     dlnkfdT = fwd_beta[39] * invT + activation_units[39] * fwd_Ea[39] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[17];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[12] - g_RT[17]);
+    Kc = Kc_s[39];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[12]) + (h_RT[1] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22289,12 +21578,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[13];
-    k_f = prefactor_units[40] * fwd_A[40]
-                * exp(fwd_beta[40] * tc[0] - activation_units[40] * fwd_Ea[40] * invT);
+    k_f = k_f_s[40];
     dlnkfdT = fwd_beta[40] * invT + activation_units[40] * fwd_Ea[40] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[12];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[12] + g_RT[13]);
+    Kc = Kc_s[40];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[13]) + (h_RT[4] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22340,12 +21628,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[16];
-    k_f = prefactor_units[41] * fwd_A[41]
-                * exp(fwd_beta[41] * tc[0] - activation_units[41] * fwd_Ea[41] * invT);
+    k_f = k_f_s[41];
     dlnkfdT = fwd_beta[41] * invT + activation_units[41] * fwd_Ea[41] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[14];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[41];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[16]) + (h_RT[4] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22391,12 +21678,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[16];
-    k_f = prefactor_units[42] * fwd_A[42]
-                * exp(fwd_beta[42] * tc[0] - activation_units[42] * fwd_Ea[42] * invT);
+    k_f = k_f_s[42];
     dlnkfdT = fwd_beta[42] * invT + activation_units[42] * fwd_Ea[42] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[15];
-    Kc = exp(-g_RT[1] + g_RT[2] - g_RT[15] + g_RT[16]);
+    Kc = Kc_s[42];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[16]) + (h_RT[1] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22442,12 +21728,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[17];
-    k_f = prefactor_units[43] * fwd_A[43]
-                * exp(fwd_beta[43] * tc[0] - activation_units[43] * fwd_Ea[43] * invT);
+    k_f = k_f_s[43];
     dlnkfdT = fwd_beta[43] * invT + activation_units[43] * fwd_Ea[43] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[16];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[43];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[17]) + (h_RT[4] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22493,12 +21778,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[18];
-    k_f = prefactor_units[44] * fwd_A[44]
-                * exp(fwd_beta[44] * tc[0] - activation_units[44] * fwd_Ea[44] * invT);
+    k_f = k_f_s[44];
     dlnkfdT = fwd_beta[44] * invT + activation_units[44] * fwd_Ea[44] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[17];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[44];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[18]) + (h_RT[4] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22544,12 +21828,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[19];
-    k_f = prefactor_units[45] * fwd_A[45]
-                * exp(fwd_beta[45] * tc[0] - activation_units[45] * fwd_Ea[45] * invT);
+    k_f = k_f_s[45];
     dlnkfdT = fwd_beta[45] * invT + activation_units[45] * fwd_Ea[45] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[17];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[17] + g_RT[19]);
+    Kc = Kc_s[45];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[19]) + (h_RT[4] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22595,12 +21878,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[20];
-    k_f = prefactor_units[46] * fwd_A[46]
-                * exp(fwd_beta[46] * tc[0] - activation_units[46] * fwd_Ea[46] * invT);
+    k_f = k_f_s[46];
     dlnkfdT = fwd_beta[46] * invT + activation_units[46] * fwd_Ea[46] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[18];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[46];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[20]) + (h_RT[4] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22646,12 +21928,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[20];
-    k_f = prefactor_units[47] * fwd_A[47]
-                * exp(fwd_beta[47] * tc[0] - activation_units[47] * fwd_Ea[47] * invT);
+    k_f = k_f_s[47];
     dlnkfdT = fwd_beta[47] * invT + activation_units[47] * fwd_Ea[47] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[19];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[19] + g_RT[20]);
+    Kc = Kc_s[47];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[20]) + (h_RT[4] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22697,12 +21978,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[21];
-    k_f = prefactor_units[48] * fwd_A[48]
-                * exp(fwd_beta[48] * tc[0] - activation_units[48] * fwd_Ea[48] * invT);
+    k_f = k_f_s[48];
     dlnkfdT = fwd_beta[48] * invT + activation_units[48] * fwd_Ea[48] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[14];
-    Kc = exp(g_RT[2] - g_RT[9] - g_RT[14] + g_RT[21]);
+    Kc = Kc_s[48];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[21]) + (h_RT[9] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22748,12 +22028,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[22];
-    k_f = prefactor_units[49] * fwd_A[49]
-                * exp(fwd_beta[49] * tc[0] - activation_units[49] * fwd_Ea[49] * invT);
+    k_f = k_f_s[49];
     dlnkfdT = fwd_beta[49] * invT + activation_units[49] * fwd_Ea[49] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[27];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[22] - g_RT[27]);
+    Kc = Kc_s[49];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[22]) + (h_RT[1] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22799,12 +22078,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[22];
-    k_f = prefactor_units[50] * fwd_A[50]
-                * exp(fwd_beta[50] * tc[0] - activation_units[50] * fwd_Ea[50] * invT);
+    k_f = k_f_s[50];
     dlnkfdT = fwd_beta[50] * invT + activation_units[50] * fwd_Ea[50] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[21];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[50];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[22]) + (h_RT[4] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22850,12 +22128,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[22];
-    k_f = prefactor_units[51] * fwd_A[51]
-                * exp(fwd_beta[51] * tc[0] - activation_units[51] * fwd_Ea[51] * invT);
+    k_f = k_f_s[51];
     dlnkfdT = fwd_beta[51] * invT + activation_units[51] * fwd_Ea[51] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[14];
-    Kc = exp(g_RT[2] - g_RT[10] - g_RT[14] + g_RT[22]);
+    Kc = Kc_s[51];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[22]) + (h_RT[10] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22901,12 +22178,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[23];
-    k_f = prefactor_units[52] * fwd_A[52]
-                * exp(fwd_beta[52] * tc[0] - activation_units[52] * fwd_Ea[52] * invT);
+    k_f = k_f_s[52];
     dlnkfdT = fwd_beta[52] * invT + activation_units[52] * fwd_Ea[52] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[28];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[23] - g_RT[28]);
+    Kc = Kc_s[52];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[23]) + (h_RT[1] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22952,12 +22228,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[24];
-    k_f = prefactor_units[53] * fwd_A[53]
-                * exp(fwd_beta[53] * tc[0] - activation_units[53] * fwd_Ea[53] * invT);
+    k_f = k_f_s[53];
     dlnkfdT = fwd_beta[53] * invT + activation_units[53] * fwd_Ea[53] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[16];
-    Kc = exp(g_RT[2] - g_RT[12] - g_RT[16] + g_RT[24]);
+    Kc = Kc_s[53];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[24]) + (h_RT[12] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23003,12 +22278,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[25];
-    k_f = prefactor_units[54] * fwd_A[54]
-                * exp(fwd_beta[54] * tc[0] - activation_units[54] * fwd_Ea[54] * invT);
+    k_f = k_f_s[54];
     dlnkfdT = fwd_beta[54] * invT + activation_units[54] * fwd_Ea[54] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[17];
-    Kc = exp(g_RT[2] - g_RT[12] - g_RT[17] + g_RT[25]);
+    Kc = Kc_s[54];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[25]) + (h_RT[12] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23054,12 +22328,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[26];
-    k_f = prefactor_units[55] * fwd_A[55]
-                * exp(fwd_beta[55] * tc[0] - activation_units[55] * fwd_Ea[55] * invT);
+    k_f = k_f_s[55];
     dlnkfdT = fwd_beta[55] * invT + activation_units[55] * fwd_Ea[55] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[25];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[25] + g_RT[26]);
+    Kc = Kc_s[55];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[26]) + (h_RT[4] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23105,12 +22378,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[27];
-    k_f = prefactor_units[56] * fwd_A[56]
-                * exp(fwd_beta[56] * tc[0] - activation_units[56] * fwd_Ea[56] * invT);
+    k_f = k_f_s[56];
     dlnkfdT = fwd_beta[56] * invT + activation_units[56] * fwd_Ea[56] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14]*sc[14];
-    Kc = refC * exp(-g_RT[1] + g_RT[2] - 2*g_RT[14] + g_RT[27]);
+    Kc = Kc_s[56];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[27]) + (h_RT[1] + 2*h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23156,12 +22428,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[28];
-    k_f = prefactor_units[57] * fwd_A[57]
-                * exp(fwd_beta[57] * tc[0] - activation_units[57] * fwd_Ea[57] * invT);
+    k_f = k_f_s[57];
     dlnkfdT = fwd_beta[57] * invT + activation_units[57] * fwd_Ea[57] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[27];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[27] + g_RT[28]);
+    Kc = Kc_s[57];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[28]) + (h_RT[4] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23207,12 +22478,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[28];
-    k_f = prefactor_units[58] * fwd_A[58]
-                * exp(fwd_beta[58] * tc[0] - activation_units[58] * fwd_Ea[58] * invT);
+    k_f = k_f_s[58];
     dlnkfdT = fwd_beta[58] * invT + activation_units[58] * fwd_Ea[58] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[15];
-    Kc = exp(g_RT[2] - g_RT[10] - g_RT[15] + g_RT[28]);
+    Kc = Kc_s[58];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[28]) + (h_RT[10] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23258,12 +22528,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[14];
-    k_f = prefactor_units[59] * fwd_A[59]
-                * exp(fwd_beta[59] * tc[0] - activation_units[59] * fwd_Ea[59] * invT);
+    k_f = k_f_s[59];
     dlnkfdT = fwd_beta[59] * invT + activation_units[59] * fwd_Ea[59] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[15];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[59];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[14]) + (h_RT[2] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23309,12 +22578,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[17];
-    k_f = prefactor_units[60] * fwd_A[60]
-                * exp(fwd_beta[60] * tc[0] - activation_units[60] * fwd_Ea[60] * invT);
+    k_f = k_f_s[60];
     dlnkfdT = fwd_beta[60] * invT + activation_units[60] * fwd_Ea[60] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[16];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[60];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[17]) + (h_RT[6] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23360,12 +22628,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3]*sc[3];
-    k_f = prefactor_units[61] * fwd_A[61]
-                * exp(fwd_beta[61] * tc[0] - activation_units[61] * fwd_Ea[61] * invT);
+    k_f = k_f_s[61];
     dlnkfdT = fwd_beta[61] * invT + activation_units[61] * fwd_Ea[61] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[6];
-    Kc = refCinv * exp(g_RT[1] + 2*g_RT[3] - g_RT[3] - g_RT[6]);
+    Kc = Kc_s[61];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + 2*h_RT[3]) + (h_RT[3] + h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23400,12 +22667,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3]*sc[5];
-    k_f = prefactor_units[62] * fwd_A[62]
-                * exp(fwd_beta[62] * tc[0] - activation_units[62] * fwd_Ea[62] * invT);
+    k_f = k_f_s[62];
     dlnkfdT = fwd_beta[62] * invT + activation_units[62] * fwd_Ea[62] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = refCinv * exp(g_RT[1] + g_RT[3] + g_RT[5] - g_RT[5] - g_RT[6]);
+    Kc = Kc_s[62];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3] + h_RT[5]) + (h_RT[5] + h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23445,12 +22711,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3]*sc[30];
-    k_f = prefactor_units[63] * fwd_A[63]
-                * exp(fwd_beta[63] * tc[0] - activation_units[63] * fwd_Ea[63] * invT);
+    k_f = k_f_s[63];
     dlnkfdT = fwd_beta[63] * invT + activation_units[63] * fwd_Ea[63] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[30];
-    Kc = refCinv * exp(g_RT[1] + g_RT[3] - g_RT[6] + g_RT[30] - g_RT[30]);
+    Kc = Kc_s[63];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3] + h_RT[30]) + (h_RT[6] + h_RT[30]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23490,12 +22755,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3];
-    k_f = prefactor_units[64] * fwd_A[64]
-                * exp(fwd_beta[64] * tc[0] - activation_units[64] * fwd_Ea[64] * invT);
+    k_f = k_f_s[64];
     dlnkfdT = fwd_beta[64] * invT + activation_units[64] * fwd_Ea[64] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[4];
-    Kc = exp(g_RT[1] - g_RT[2] + g_RT[3] - g_RT[4]);
+    Kc = Kc_s[64];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3]) + (h_RT[2] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23541,12 +22805,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[1]*sc[1];
-    k_f = prefactor_units[65] * fwd_A[65]
-                * exp(fwd_beta[65] * tc[0] - activation_units[65] * fwd_Ea[65] * invT);
+    k_f = k_f_s[65];
     dlnkfdT = fwd_beta[65] * invT + activation_units[65] * fwd_Ea[65] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[0];
-    Kc = refCinv * exp(g_RT[0] - 2*g_RT[0] + 2*g_RT[1]);
+    Kc = Kc_s[65];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + 2*h_RT[1]) + (2*h_RT[0]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23572,12 +22835,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[1]*sc[5];
-    k_f = prefactor_units[66] * fwd_A[66]
-                * exp(fwd_beta[66] * tc[0] - activation_units[66] * fwd_Ea[66] * invT);
+    k_f = k_f_s[66];
     dlnkfdT = fwd_beta[66] * invT + activation_units[66] * fwd_Ea[66] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[5];
-    Kc = refCinv * exp(-g_RT[0] + 2*g_RT[1] + g_RT[5] - g_RT[5]);
+    Kc = Kc_s[66];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[1] + h_RT[5]) + (h_RT[0] + h_RT[5]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23607,12 +22869,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[1]*sc[15];
-    k_f = prefactor_units[67] * fwd_A[67]
-                * exp(fwd_beta[67] * tc[0] - activation_units[67] * fwd_Ea[67] * invT);
+    k_f = k_f_s[67];
     dlnkfdT = fwd_beta[67] * invT + activation_units[67] * fwd_Ea[67] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[15];
-    Kc = refCinv * exp(-g_RT[0] + 2*g_RT[1] + g_RT[15] - g_RT[15]);
+    Kc = Kc_s[67];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[1] + h_RT[15]) + (h_RT[0] + h_RT[15]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23642,12 +22903,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[6];
-    k_f = prefactor_units[68] * fwd_A[68]
-                * exp(fwd_beta[68] * tc[0] - activation_units[68] * fwd_Ea[68] * invT);
+    k_f = k_f_s[68];
     dlnkfdT = fwd_beta[68] * invT + activation_units[68] * fwd_Ea[68] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[5];
-    Kc = exp(g_RT[1] - g_RT[2] - g_RT[5] + g_RT[6]);
+    Kc = Kc_s[68];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[6]) + (h_RT[2] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23693,12 +22953,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[6];
-    k_f = prefactor_units[69] * fwd_A[69]
-                * exp(fwd_beta[69] * tc[0] - activation_units[69] * fwd_Ea[69] * invT);
+    k_f = k_f_s[69];
     dlnkfdT = fwd_beta[69] * invT + activation_units[69] * fwd_Ea[69] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[3];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[3] + g_RT[6]);
+    Kc = Kc_s[69];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[6]) + (h_RT[0] + h_RT[3]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23744,12 +23003,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[6];
-    k_f = prefactor_units[70] * fwd_A[70]
-                * exp(fwd_beta[70] * tc[0] - activation_units[70] * fwd_Ea[70] * invT);
+    k_f = k_f_s[70];
     dlnkfdT = fwd_beta[70] * invT + activation_units[70] * fwd_Ea[70] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[4];
-    Kc = exp(g_RT[1] - 2*g_RT[4] + g_RT[6]);
+    Kc = Kc_s[70];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[6]) + (2*h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23784,12 +23042,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[7];
-    k_f = prefactor_units[71] * fwd_A[71]
-                * exp(fwd_beta[71] * tc[0] - activation_units[71] * fwd_Ea[71] * invT);
+    k_f = k_f_s[71];
     dlnkfdT = fwd_beta[71] * invT + activation_units[71] * fwd_Ea[71] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[6];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[71];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[7]) + (h_RT[0] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23835,12 +23092,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[7];
-    k_f = prefactor_units[72] * fwd_A[72]
-                * exp(fwd_beta[72] * tc[0] - activation_units[72] * fwd_Ea[72] * invT);
+    k_f = k_f_s[72];
     dlnkfdT = fwd_beta[72] * invT + activation_units[72] * fwd_Ea[72] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[5];
-    Kc = exp(g_RT[1] - g_RT[4] - g_RT[5] + g_RT[7]);
+    Kc = Kc_s[72];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[7]) + (h_RT[4] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23886,12 +23142,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[9];
-    k_f = prefactor_units[73] * fwd_A[73]
-                * exp(fwd_beta[73] * tc[0] - activation_units[73] * fwd_Ea[73] * invT);
+    k_f = k_f_s[73];
     dlnkfdT = fwd_beta[73] * invT + activation_units[73] * fwd_Ea[73] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[8];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[8] + g_RT[9]);
+    Kc = Kc_s[73];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[9]) + (h_RT[0] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23937,12 +23192,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[11];
-    k_f = prefactor_units[74] * fwd_A[74]
-                * exp(fwd_beta[74] * tc[0] - activation_units[74] * fwd_Ea[74] * invT);
+    k_f = k_f_s[74];
     dlnkfdT = fwd_beta[74] * invT + activation_units[74] * fwd_Ea[74] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[9];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[9] + g_RT[11]);
+    Kc = Kc_s[74];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[11]) + (h_RT[0] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23988,12 +23242,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[13];
-    k_f = prefactor_units[75] * fwd_A[75]
-                * exp(fwd_beta[75] * tc[0] - activation_units[75] * fwd_Ea[75] * invT);
+    k_f = k_f_s[75];
     dlnkfdT = fwd_beta[75] * invT + activation_units[75] * fwd_Ea[75] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[12];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[12] + g_RT[13]);
+    Kc = Kc_s[75];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[13]) + (h_RT[0] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24039,12 +23292,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[16];
-    k_f = prefactor_units[76] * fwd_A[76]
-                * exp(fwd_beta[76] * tc[0] - activation_units[76] * fwd_Ea[76] * invT);
+    k_f = k_f_s[76];
     dlnkfdT = fwd_beta[76] * invT + activation_units[76] * fwd_Ea[76] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[14];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[76];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[16]) + (h_RT[0] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24090,12 +23342,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[17];
-    k_f = prefactor_units[77] * fwd_A[77]
-                * exp(fwd_beta[77] * tc[0] - activation_units[77] * fwd_Ea[77] * invT);
+    k_f = k_f_s[77];
     dlnkfdT = fwd_beta[77] * invT + activation_units[77] * fwd_Ea[77] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[16];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[77];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[17]) + (h_RT[0] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24141,12 +23392,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[18];
-    k_f = prefactor_units[78] * fwd_A[78]
-                * exp(fwd_beta[78] * tc[0] - activation_units[78] * fwd_Ea[78] * invT);
+    k_f = k_f_s[78];
     dlnkfdT = fwd_beta[78] * invT + activation_units[78] * fwd_Ea[78] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[17];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[78];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[18]) + (h_RT[0] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24192,12 +23442,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[18];
-    k_f = prefactor_units[79] * fwd_A[79]
-                * exp(fwd_beta[79] * tc[0] - activation_units[79] * fwd_Ea[79] * invT);
+    k_f = k_f_s[79];
     dlnkfdT = fwd_beta[79] * invT + activation_units[79] * fwd_Ea[79] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[12];
-    Kc = exp(g_RT[1] - g_RT[4] - g_RT[12] + g_RT[18]);
+    Kc = Kc_s[79];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[18]) + (h_RT[4] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24243,12 +23492,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[18];
-    k_f = prefactor_units[80] * fwd_A[80]
-                * exp(fwd_beta[80] * tc[0] - activation_units[80] * fwd_Ea[80] * invT);
+    k_f = k_f_s[80];
     dlnkfdT = fwd_beta[80] * invT + activation_units[80] * fwd_Ea[80] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[11];
-    Kc = exp(g_RT[1] - g_RT[5] - g_RT[11] + g_RT[18]);
+    Kc = Kc_s[80];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[18]) + (h_RT[5] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24294,12 +23542,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[81] * fwd_A[81]
-                * exp(fwd_beta[81] * tc[0] - activation_units[81] * fwd_Ea[81] * invT);
+    k_f = k_f_s[81];
     dlnkfdT = fwd_beta[81] * invT + activation_units[81] * fwd_Ea[81] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[18];
-    Kc = exp(g_RT[1] - g_RT[1] - g_RT[18] + g_RT[19]);
+    Kc = Kc_s[81];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[1] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24329,12 +23576,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[82] * fwd_A[82]
-                * exp(fwd_beta[82] * tc[0] - activation_units[82] * fwd_Ea[82] * invT);
+    k_f = k_f_s[82];
     dlnkfdT = fwd_beta[82] * invT + activation_units[82] * fwd_Ea[82] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[17];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[17] + g_RT[19]);
+    Kc = Kc_s[82];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[0] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24380,12 +23626,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[83] * fwd_A[83]
-                * exp(fwd_beta[83] * tc[0] - activation_units[83] * fwd_Ea[83] * invT);
+    k_f = k_f_s[83];
     dlnkfdT = fwd_beta[83] * invT + activation_units[83] * fwd_Ea[83] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[12];
-    Kc = exp(g_RT[1] - g_RT[4] - g_RT[12] + g_RT[19]);
+    Kc = Kc_s[83];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[4] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24431,12 +23676,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[84] * fwd_A[84]
-                * exp(fwd_beta[84] * tc[0] - activation_units[84] * fwd_Ea[84] * invT);
+    k_f = k_f_s[84];
     dlnkfdT = fwd_beta[84] * invT + activation_units[84] * fwd_Ea[84] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[11];
-    Kc = exp(g_RT[1] - g_RT[5] - g_RT[11] + g_RT[19]);
+    Kc = Kc_s[84];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[5] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24482,12 +23726,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[20];
-    k_f = prefactor_units[85] * fwd_A[85]
-                * exp(fwd_beta[85] * tc[0] - activation_units[85] * fwd_Ea[85] * invT);
+    k_f = k_f_s[85];
     dlnkfdT = fwd_beta[85] * invT + activation_units[85] * fwd_Ea[85] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[18];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[85];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[20]) + (h_RT[0] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24533,12 +23776,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[20];
-    k_f = prefactor_units[86] * fwd_A[86]
-                * exp(fwd_beta[86] * tc[0] - activation_units[86] * fwd_Ea[86] * invT);
+    k_f = k_f_s[86];
     dlnkfdT = fwd_beta[86] * invT + activation_units[86] * fwd_Ea[86] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[19];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[19] + g_RT[20]);
+    Kc = Kc_s[86];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[20]) + (h_RT[0] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24584,12 +23826,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[23];
-    k_f = prefactor_units[87] * fwd_A[87]
-                * exp(fwd_beta[87] * tc[0] - activation_units[87] * fwd_Ea[87] * invT);
+    k_f = k_f_s[87];
     dlnkfdT = fwd_beta[87] * invT + activation_units[87] * fwd_Ea[87] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[22];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[22] + g_RT[23]);
+    Kc = Kc_s[87];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[23]) + (h_RT[0] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24635,12 +23876,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[24];
-    k_f = prefactor_units[88] * fwd_A[88]
-                * exp(fwd_beta[88] * tc[0] - activation_units[88] * fwd_Ea[88] * invT);
+    k_f = k_f_s[88];
     dlnkfdT = fwd_beta[88] * invT + activation_units[88] * fwd_Ea[88] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[23];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[23] + g_RT[24]);
+    Kc = Kc_s[88];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[24]) + (h_RT[0] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24686,12 +23926,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[25];
-    k_f = prefactor_units[89] * fwd_A[89]
-                * exp(fwd_beta[89] * tc[0] - activation_units[89] * fwd_Ea[89] * invT);
+    k_f = k_f_s[89];
     dlnkfdT = fwd_beta[89] * invT + activation_units[89] * fwd_Ea[89] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[24];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[24] + g_RT[25]);
+    Kc = Kc_s[89];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[25]) + (h_RT[0] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24737,12 +23976,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[26];
-    k_f = prefactor_units[90] * fwd_A[90]
-                * exp(fwd_beta[90] * tc[0] - activation_units[90] * fwd_Ea[90] * invT);
+    k_f = k_f_s[90];
     dlnkfdT = fwd_beta[90] * invT + activation_units[90] * fwd_Ea[90] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[25];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[25] + g_RT[26]);
+    Kc = Kc_s[90];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[26]) + (h_RT[0] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24788,12 +24026,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[27];
-    k_f = prefactor_units[91] * fwd_A[91]
-                * exp(fwd_beta[91] * tc[0] - activation_units[91] * fwd_Ea[91] * invT);
+    k_f = k_f_s[91];
     dlnkfdT = fwd_beta[91] * invT + activation_units[91] * fwd_Ea[91] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[14];
-    Kc = exp(g_RT[1] - g_RT[11] - g_RT[14] + g_RT[27]);
+    Kc = Kc_s[91];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[27]) + (h_RT[11] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24839,12 +24076,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[28];
-    k_f = prefactor_units[92] * fwd_A[92]
-                * exp(fwd_beta[92] * tc[0] - activation_units[92] * fwd_Ea[92] * invT);
+    k_f = k_f_s[92];
     dlnkfdT = fwd_beta[92] * invT + activation_units[92] * fwd_Ea[92] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[27];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[27] + g_RT[28]);
+    Kc = Kc_s[92];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[28]) + (h_RT[0] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24890,12 +24126,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[28];
-    k_f = prefactor_units[93] * fwd_A[93]
-                * exp(fwd_beta[93] * tc[0] - activation_units[93] * fwd_Ea[93] * invT);
+    k_f = k_f_s[93];
     dlnkfdT = fwd_beta[93] * invT + activation_units[93] * fwd_Ea[93] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[14];
-    Kc = exp(g_RT[1] - g_RT[12] - g_RT[14] + g_RT[28]);
+    Kc = Kc_s[93];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[28]) + (h_RT[12] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24941,12 +24176,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[29];
-    k_f = prefactor_units[94] * fwd_A[94]
-                * exp(fwd_beta[94] * tc[0] - activation_units[94] * fwd_Ea[94] * invT);
+    k_f = k_f_s[94];
     dlnkfdT = fwd_beta[94] * invT + activation_units[94] * fwd_Ea[94] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[28];
-    Kc = exp(g_RT[1] - g_RT[1] - g_RT[28] + g_RT[29]);
+    Kc = Kc_s[94];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[29]) + (h_RT[1] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24976,12 +24210,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[4];
-    k_f = prefactor_units[95] * fwd_A[95]
-                * exp(fwd_beta[95] * tc[0] - activation_units[95] * fwd_Ea[95] * invT);
+    k_f = k_f_s[95];
     dlnkfdT = fwd_beta[95] * invT + activation_units[95] * fwd_Ea[95] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[5];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[4] - g_RT[5]);
+    Kc = Kc_s[95];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[4]) + (h_RT[1] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25027,12 +24260,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[4];
-    k_f = prefactor_units[96] * fwd_A[96]
-                * exp(fwd_beta[96] * tc[0] - activation_units[96] * fwd_Ea[96] * invT);
+    k_f = k_f_s[96];
     dlnkfdT = fwd_beta[96] * invT + activation_units[96] * fwd_Ea[96] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[5];
-    Kc = exp(-g_RT[2] + 2*g_RT[4] - g_RT[5]);
+    Kc = Kc_s[96];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[4]) + (h_RT[2] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25067,12 +24299,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[6];
-    k_f = prefactor_units[97] * fwd_A[97]
-                * exp(fwd_beta[97] * tc[0] - activation_units[97] * fwd_Ea[97] * invT);
+    k_f = k_f_s[97];
     dlnkfdT = fwd_beta[97] * invT + activation_units[97] * fwd_Ea[97] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[5];
-    Kc = exp(-g_RT[3] + g_RT[4] - g_RT[5] + g_RT[6]);
+    Kc = Kc_s[97];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[6]) + (h_RT[3] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25118,12 +24349,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[7];
-    k_f = prefactor_units[98] * fwd_A[98]
-                * exp(fwd_beta[98] * tc[0] - activation_units[98] * fwd_Ea[98] * invT);
+    k_f = k_f_s[98];
     dlnkfdT = fwd_beta[98] * invT + activation_units[98] * fwd_Ea[98] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[98];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[7]) + (h_RT[5] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25169,12 +24399,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[7];
-    k_f = prefactor_units[99] * fwd_A[99]
-                * exp(fwd_beta[99] * tc[0] - activation_units[99] * fwd_Ea[99] * invT);
+    k_f = k_f_s[99];
     dlnkfdT = fwd_beta[99] * invT + activation_units[99] * fwd_Ea[99] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[99];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[7]) + (h_RT[5] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25220,12 +24449,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[8];
-    k_f = prefactor_units[100] * fwd_A[100]
-                * exp(fwd_beta[100] * tc[0] - activation_units[100] * fwd_Ea[100] * invT);
+    k_f = k_f_s[100];
     dlnkfdT = fwd_beta[100] * invT + activation_units[100] * fwd_Ea[100] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[8] - g_RT[14]);
+    Kc = Kc_s[100];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[8]) + (h_RT[1] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25271,12 +24499,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[9];
-    k_f = prefactor_units[101] * fwd_A[101]
-                * exp(fwd_beta[101] * tc[0] - activation_units[101] * fwd_Ea[101] * invT);
+    k_f = k_f_s[101];
     dlnkfdT = fwd_beta[101] * invT + activation_units[101] * fwd_Ea[101] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[16];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[9] - g_RT[16]);
+    Kc = Kc_s[101];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[9]) + (h_RT[1] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25322,12 +24549,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[10];
-    k_f = prefactor_units[102] * fwd_A[102]
-                * exp(fwd_beta[102] * tc[0] - activation_units[102] * fwd_Ea[102] * invT);
+    k_f = k_f_s[102];
     dlnkfdT = fwd_beta[102] * invT + activation_units[102] * fwd_Ea[102] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[17];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[10] - g_RT[17]);
+    Kc = Kc_s[102];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[10]) + (h_RT[1] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25373,12 +24599,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[10];
-    k_f = prefactor_units[103] * fwd_A[103]
-                * exp(fwd_beta[103] * tc[0] - activation_units[103] * fwd_Ea[103] * invT);
+    k_f = k_f_s[103];
     dlnkfdT = fwd_beta[103] * invT + activation_units[103] * fwd_Ea[103] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[9];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[9] + g_RT[10]);
+    Kc = Kc_s[103];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[10]) + (h_RT[5] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25424,12 +24649,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[11];
-    k_f = prefactor_units[104] * fwd_A[104]
-                * exp(fwd_beta[104] * tc[0] - activation_units[104] * fwd_Ea[104] * invT);
+    k_f = k_f_s[104];
     dlnkfdT = fwd_beta[104] * invT + activation_units[104] * fwd_Ea[104] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[17];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[11] - g_RT[17]);
+    Kc = Kc_s[104];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[11]) + (h_RT[1] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25475,12 +24699,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[12];
-    k_f = prefactor_units[105] * fwd_A[105]
-                * exp(fwd_beta[105] * tc[0] - activation_units[105] * fwd_Ea[105] * invT);
+    k_f = k_f_s[105];
     dlnkfdT = fwd_beta[105] * invT + activation_units[105] * fwd_Ea[105] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[10];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[10] + g_RT[12]);
+    Kc = Kc_s[105];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[12]) + (h_RT[5] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25526,12 +24749,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[12];
-    k_f = prefactor_units[106] * fwd_A[106]
-                * exp(fwd_beta[106] * tc[0] - activation_units[106] * fwd_Ea[106] * invT);
+    k_f = k_f_s[106];
     dlnkfdT = fwd_beta[106] * invT + activation_units[106] * fwd_Ea[106] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[11];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[11] + g_RT[12]);
+    Kc = Kc_s[106];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[12]) + (h_RT[5] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25577,12 +24799,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[13];
-    k_f = prefactor_units[107] * fwd_A[107]
-                * exp(fwd_beta[107] * tc[0] - activation_units[107] * fwd_Ea[107] * invT);
+    k_f = k_f_s[107];
     dlnkfdT = fwd_beta[107] * invT + activation_units[107] * fwd_Ea[107] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[12];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[12] + g_RT[13]);
+    Kc = Kc_s[107];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[13]) + (h_RT[5] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25628,12 +24849,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[14];
-    k_f = prefactor_units[108] * fwd_A[108]
-                * exp(fwd_beta[108] * tc[0] - activation_units[108] * fwd_Ea[108] * invT);
+    k_f = k_f_s[108];
     dlnkfdT = fwd_beta[108] * invT + activation_units[108] * fwd_Ea[108] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[15];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[108];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[14]) + (h_RT[1] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25679,12 +24899,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[16];
-    k_f = prefactor_units[109] * fwd_A[109]
-                * exp(fwd_beta[109] * tc[0] - activation_units[109] * fwd_Ea[109] * invT);
+    k_f = k_f_s[109];
     dlnkfdT = fwd_beta[109] * invT + activation_units[109] * fwd_Ea[109] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[14];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[109];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[16]) + (h_RT[5] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25730,12 +24949,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[17];
-    k_f = prefactor_units[110] * fwd_A[110]
-                * exp(fwd_beta[110] * tc[0] - activation_units[110] * fwd_Ea[110] * invT);
+    k_f = k_f_s[110];
     dlnkfdT = fwd_beta[110] * invT + activation_units[110] * fwd_Ea[110] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[16];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[110];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[17]) + (h_RT[5] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25781,12 +24999,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[18];
-    k_f = prefactor_units[111] * fwd_A[111]
-                * exp(fwd_beta[111] * tc[0] - activation_units[111] * fwd_Ea[111] * invT);
+    k_f = k_f_s[111];
     dlnkfdT = fwd_beta[111] * invT + activation_units[111] * fwd_Ea[111] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[17];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[111];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[18]) + (h_RT[5] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25832,12 +25049,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[19];
-    k_f = prefactor_units[112] * fwd_A[112]
-                * exp(fwd_beta[112] * tc[0] - activation_units[112] * fwd_Ea[112] * invT);
+    k_f = k_f_s[112];
     dlnkfdT = fwd_beta[112] * invT + activation_units[112] * fwd_Ea[112] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[17];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[17] + g_RT[19]);
+    Kc = Kc_s[112];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[19]) + (h_RT[5] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25883,12 +25099,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[20];
-    k_f = prefactor_units[113] * fwd_A[113]
-                * exp(fwd_beta[113] * tc[0] - activation_units[113] * fwd_Ea[113] * invT);
+    k_f = k_f_s[113];
     dlnkfdT = fwd_beta[113] * invT + activation_units[113] * fwd_Ea[113] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[18];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[113];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[20]) + (h_RT[5] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25934,12 +25149,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[20];
-    k_f = prefactor_units[114] * fwd_A[114]
-                * exp(fwd_beta[114] * tc[0] - activation_units[114] * fwd_Ea[114] * invT);
+    k_f = k_f_s[114];
     dlnkfdT = fwd_beta[114] * invT + activation_units[114] * fwd_Ea[114] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[19];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[19] + g_RT[20]);
+    Kc = Kc_s[114];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[20]) + (h_RT[5] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25985,12 +25199,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[21];
-    k_f = prefactor_units[115] * fwd_A[115]
-                * exp(fwd_beta[115] * tc[0] - activation_units[115] * fwd_Ea[115] * invT);
+    k_f = k_f_s[115];
     dlnkfdT = fwd_beta[115] * invT + activation_units[115] * fwd_Ea[115] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[27];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[21] - g_RT[27]);
+    Kc = Kc_s[115];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[21]) + (h_RT[1] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26036,12 +25249,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[22];
-    k_f = prefactor_units[116] * fwd_A[116]
-                * exp(fwd_beta[116] * tc[0] - activation_units[116] * fwd_Ea[116] * invT);
+    k_f = k_f_s[116];
     dlnkfdT = fwd_beta[116] * invT + activation_units[116] * fwd_Ea[116] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[28];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[22] - g_RT[28]);
+    Kc = Kc_s[116];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[22]) + (h_RT[1] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26087,12 +25299,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[22];
-    k_f = prefactor_units[117] * fwd_A[117]
-                * exp(fwd_beta[117] * tc[0] - activation_units[117] * fwd_Ea[117] * invT);
+    k_f = k_f_s[117];
     dlnkfdT = fwd_beta[117] * invT + activation_units[117] * fwd_Ea[117] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[29];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[22] - g_RT[29]);
+    Kc = Kc_s[117];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[22]) + (h_RT[1] + h_RT[29]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26138,12 +25349,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[22];
-    k_f = prefactor_units[118] * fwd_A[118]
-                * exp(fwd_beta[118] * tc[0] - activation_units[118] * fwd_Ea[118] * invT);
+    k_f = k_f_s[118];
     dlnkfdT = fwd_beta[118] * invT + activation_units[118] * fwd_Ea[118] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[21];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[118];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[22]) + (h_RT[5] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26189,12 +25399,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[22];
-    k_f = prefactor_units[119] * fwd_A[119]
-                * exp(fwd_beta[119] * tc[0] - activation_units[119] * fwd_Ea[119] * invT);
+    k_f = k_f_s[119];
     dlnkfdT = fwd_beta[119] * invT + activation_units[119] * fwd_Ea[119] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[14];
-    Kc = exp(g_RT[4] - g_RT[12] - g_RT[14] + g_RT[22]);
+    Kc = Kc_s[119];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[22]) + (h_RT[12] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26240,12 +25449,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[23];
-    k_f = prefactor_units[120] * fwd_A[120]
-                * exp(fwd_beta[120] * tc[0] - activation_units[120] * fwd_Ea[120] * invT);
+    k_f = k_f_s[120];
     dlnkfdT = fwd_beta[120] * invT + activation_units[120] * fwd_Ea[120] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[22];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[22] + g_RT[23]);
+    Kc = Kc_s[120];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[23]) + (h_RT[5] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26291,12 +25499,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[24];
-    k_f = prefactor_units[121] * fwd_A[121]
-                * exp(fwd_beta[121] * tc[0] - activation_units[121] * fwd_Ea[121] * invT);
+    k_f = k_f_s[121];
     dlnkfdT = fwd_beta[121] * invT + activation_units[121] * fwd_Ea[121] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[23];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[23] + g_RT[24]);
+    Kc = Kc_s[121];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[24]) + (h_RT[5] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26342,12 +25549,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[26];
-    k_f = prefactor_units[122] * fwd_A[122]
-                * exp(fwd_beta[122] * tc[0] - activation_units[122] * fwd_Ea[122] * invT);
+    k_f = k_f_s[122];
     dlnkfdT = fwd_beta[122] * invT + activation_units[122] * fwd_Ea[122] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[25];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[25] + g_RT[26]);
+    Kc = Kc_s[122];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[26]) + (h_RT[5] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26393,12 +25599,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[28];
-    k_f = prefactor_units[123] * fwd_A[123]
-                * exp(fwd_beta[123] * tc[0] - activation_units[123] * fwd_Ea[123] * invT);
+    k_f = k_f_s[123];
     dlnkfdT = fwd_beta[123] * invT + activation_units[123] * fwd_Ea[123] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[27];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[27] + g_RT[28]);
+    Kc = Kc_s[123];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[28]) + (h_RT[5] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26444,12 +25649,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[6];
-    k_f = prefactor_units[124] * fwd_A[124]
-                * exp(fwd_beta[124] * tc[0] - activation_units[124] * fwd_Ea[124] * invT);
+    k_f = k_f_s[124];
     dlnkfdT = fwd_beta[124] * invT + activation_units[124] * fwd_Ea[124] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[7];
-    Kc = exp(-g_RT[3] + 2*g_RT[6] - g_RT[7]);
+    Kc = Kc_s[124];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[6]) + (h_RT[3] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26484,12 +25688,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[6];
-    k_f = prefactor_units[125] * fwd_A[125]
-                * exp(fwd_beta[125] * tc[0] - activation_units[125] * fwd_Ea[125] * invT);
+    k_f = k_f_s[125];
     dlnkfdT = fwd_beta[125] * invT + activation_units[125] * fwd_Ea[125] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[7];
-    Kc = exp(-g_RT[3] + 2*g_RT[6] - g_RT[7]);
+    Kc = Kc_s[125];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[6]) + (h_RT[3] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26524,12 +25727,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[10];
-    k_f = prefactor_units[126] * fwd_A[126]
-                * exp(fwd_beta[126] * tc[0] - activation_units[126] * fwd_Ea[126] * invT);
+    k_f = k_f_s[126];
     dlnkfdT = fwd_beta[126] * invT + activation_units[126] * fwd_Ea[126] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[17];
-    Kc = exp(-g_RT[4] + g_RT[6] + g_RT[10] - g_RT[17]);
+    Kc = Kc_s[126];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[10]) + (h_RT[4] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26575,12 +25777,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[12];
-    k_f = prefactor_units[127] * fwd_A[127]
-                * exp(fwd_beta[127] * tc[0] - activation_units[127] * fwd_Ea[127] * invT);
+    k_f = k_f_s[127];
     dlnkfdT = fwd_beta[127] * invT + activation_units[127] * fwd_Ea[127] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[13];
-    Kc = exp(-g_RT[3] + g_RT[6] + g_RT[12] - g_RT[13]);
+    Kc = Kc_s[127];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[12]) + (h_RT[3] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26626,12 +25827,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[12];
-    k_f = prefactor_units[128] * fwd_A[128]
-                * exp(fwd_beta[128] * tc[0] - activation_units[128] * fwd_Ea[128] * invT);
+    k_f = k_f_s[128];
     dlnkfdT = fwd_beta[128] * invT + activation_units[128] * fwd_Ea[128] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[19];
-    Kc = exp(-g_RT[4] + g_RT[6] + g_RT[12] - g_RT[19]);
+    Kc = Kc_s[128];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[12]) + (h_RT[4] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26677,12 +25877,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[14];
-    k_f = prefactor_units[129] * fwd_A[129]
-                * exp(fwd_beta[129] * tc[0] - activation_units[129] * fwd_Ea[129] * invT);
+    k_f = k_f_s[129];
     dlnkfdT = fwd_beta[129] * invT + activation_units[129] * fwd_Ea[129] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[15];
-    Kc = exp(-g_RT[4] + g_RT[6] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[129];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[14]) + (h_RT[4] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26728,12 +25927,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[17];
-    k_f = prefactor_units[130] * fwd_A[130]
-                * exp(fwd_beta[130] * tc[0] - activation_units[130] * fwd_Ea[130] * invT);
+    k_f = k_f_s[130];
     dlnkfdT = fwd_beta[130] * invT + activation_units[130] * fwd_Ea[130] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[16];
-    Kc = exp(g_RT[6] - g_RT[7] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[130];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[17]) + (h_RT[7] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26779,12 +25977,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[8];
-    k_f = prefactor_units[131] * fwd_A[131]
-                * exp(fwd_beta[131] * tc[0] - activation_units[131] * fwd_Ea[131] * invT);
+    k_f = k_f_s[131];
     dlnkfdT = fwd_beta[131] * invT + activation_units[131] * fwd_Ea[131] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[14];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[8] - g_RT[14]);
+    Kc = Kc_s[131];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[8]) + (h_RT[2] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26830,12 +26027,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[10];
-    k_f = prefactor_units[132] * fwd_A[132]
-                * exp(fwd_beta[132] * tc[0] - activation_units[132] * fwd_Ea[132] * invT);
+    k_f = k_f_s[132];
     dlnkfdT = fwd_beta[132] * invT + activation_units[132] * fwd_Ea[132] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[21];
-    Kc = exp(-g_RT[1] + g_RT[8] + g_RT[10] - g_RT[21]);
+    Kc = Kc_s[132];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[10]) + (h_RT[1] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26881,12 +26077,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[12];
-    k_f = prefactor_units[133] * fwd_A[133]
-                * exp(fwd_beta[133] * tc[0] - activation_units[133] * fwd_Ea[133] * invT);
+    k_f = k_f_s[133];
     dlnkfdT = fwd_beta[133] * invT + activation_units[133] * fwd_Ea[133] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[22];
-    Kc = exp(-g_RT[1] + g_RT[8] + g_RT[12] - g_RT[22]);
+    Kc = Kc_s[133];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[12]) + (h_RT[1] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26932,12 +26127,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[9];
-    k_f = prefactor_units[134] * fwd_A[134]
-                * exp(fwd_beta[134] * tc[0] - activation_units[134] * fwd_Ea[134] * invT);
+    k_f = k_f_s[134];
     dlnkfdT = fwd_beta[134] * invT + activation_units[134] * fwd_Ea[134] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[16];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[9] - g_RT[16]);
+    Kc = Kc_s[134];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[9]) + (h_RT[2] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26983,12 +26177,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[9];
-    k_f = prefactor_units[135] * fwd_A[135]
-                * exp(fwd_beta[135] * tc[0] - activation_units[135] * fwd_Ea[135] * invT);
+    k_f = k_f_s[135];
     dlnkfdT = fwd_beta[135] * invT + activation_units[135] * fwd_Ea[135] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[10];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[9] - g_RT[10]);
+    Kc = Kc_s[135];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[9]) + (h_RT[1] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27034,12 +26227,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[9];
-    k_f = prefactor_units[136] * fwd_A[136]
-                * exp(fwd_beta[136] * tc[0] - activation_units[136] * fwd_Ea[136] * invT);
+    k_f = k_f_s[136];
     dlnkfdT = fwd_beta[136] * invT + activation_units[136] * fwd_Ea[136] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[17];
-    Kc = exp(-g_RT[1] + g_RT[5] + g_RT[9] - g_RT[17]);
+    Kc = Kc_s[136];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[9]) + (h_RT[1] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27085,12 +26277,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[10];
-    k_f = prefactor_units[137] * fwd_A[137]
-                * exp(fwd_beta[137] * tc[0] - activation_units[137] * fwd_Ea[137] * invT);
+    k_f = k_f_s[137];
     dlnkfdT = fwd_beta[137] * invT + activation_units[137] * fwd_Ea[137] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[22];
-    Kc = exp(-g_RT[1] + g_RT[9] + g_RT[10] - g_RT[22]);
+    Kc = Kc_s[137];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[10]) + (h_RT[1] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27136,12 +26327,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[12];
-    k_f = prefactor_units[138] * fwd_A[138]
-                * exp(fwd_beta[138] * tc[0] - activation_units[138] * fwd_Ea[138] * invT);
+    k_f = k_f_s[138];
     dlnkfdT = fwd_beta[138] * invT + activation_units[138] * fwd_Ea[138] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[23];
-    Kc = exp(-g_RT[1] + g_RT[9] + g_RT[12] - g_RT[23]);
+    Kc = Kc_s[138];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[12]) + (h_RT[1] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27187,12 +26377,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[13];
-    k_f = prefactor_units[139] * fwd_A[139]
-                * exp(fwd_beta[139] * tc[0] - activation_units[139] * fwd_Ea[139] * invT);
+    k_f = k_f_s[139];
     dlnkfdT = fwd_beta[139] * invT + activation_units[139] * fwd_Ea[139] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[24];
-    Kc = exp(-g_RT[1] + g_RT[9] + g_RT[13] - g_RT[24]);
+    Kc = Kc_s[139];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[13]) + (h_RT[1] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27238,12 +26427,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[15];
-    k_f = prefactor_units[140] * fwd_A[140]
-                * exp(fwd_beta[140] * tc[0] - activation_units[140] * fwd_Ea[140] * invT);
+    k_f = k_f_s[140];
     dlnkfdT = fwd_beta[140] * invT + activation_units[140] * fwd_Ea[140] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[16];
-    Kc = exp(g_RT[9] - g_RT[14] + g_RT[15] - g_RT[16]);
+    Kc = Kc_s[140];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[15]) + (h_RT[14] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27289,12 +26477,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[17];
-    k_f = prefactor_units[141] * fwd_A[141]
-                * exp(fwd_beta[141] * tc[0] - activation_units[141] * fwd_Ea[141] * invT);
+    k_f = k_f_s[141];
     dlnkfdT = fwd_beta[141] * invT + activation_units[141] * fwd_Ea[141] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[28];
-    Kc = exp(-g_RT[1] + g_RT[9] + g_RT[17] - g_RT[28]);
+    Kc = Kc_s[141];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[17]) + (h_RT[1] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27340,12 +26527,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[27];
-    k_f = prefactor_units[142] * fwd_A[142]
-                * exp(fwd_beta[142] * tc[0] - activation_units[142] * fwd_Ea[142] * invT);
+    k_f = k_f_s[142];
     dlnkfdT = fwd_beta[142] * invT + activation_units[142] * fwd_Ea[142] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[22];
-    Kc = exp(g_RT[9] - g_RT[14] - g_RT[22] + g_RT[27]);
+    Kc = Kc_s[142];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[27]) + (h_RT[14] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27391,8 +26577,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[10];
-    k_f = prefactor_units[143] * fwd_A[143]
-                * exp(fwd_beta[143] * tc[0] - activation_units[143] * fwd_Ea[143] * invT);
+    k_f = k_f_s[143];
     dlnkfdT = fwd_beta[143] * invT + activation_units[143] * fwd_Ea[143] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -27428,12 +26613,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[10];
-    k_f = prefactor_units[144] * fwd_A[144]
-                * exp(fwd_beta[144] * tc[0] - activation_units[144] * fwd_Ea[144] * invT);
+    k_f = k_f_s[144];
     dlnkfdT = fwd_beta[144] * invT + activation_units[144] * fwd_Ea[144] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[12];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[10] - g_RT[12]);
+    Kc = Kc_s[144];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[10]) + (h_RT[1] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27479,12 +26663,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[10];
-    k_f = prefactor_units[145] * fwd_A[145]
-                * exp(fwd_beta[145] * tc[0] - activation_units[145] * fwd_Ea[145] * invT);
+    k_f = k_f_s[145];
     dlnkfdT = fwd_beta[145] * invT + activation_units[145] * fwd_Ea[145] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[22];
-    Kc = exp(-g_RT[0] + 2*g_RT[10] - g_RT[22]);
+    Kc = Kc_s[145];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[10]) + (h_RT[0] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27519,12 +26702,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[12];
-    k_f = prefactor_units[146] * fwd_A[146]
-                * exp(fwd_beta[146] * tc[0] - activation_units[146] * fwd_Ea[146] * invT);
+    k_f = k_f_s[146];
     dlnkfdT = fwd_beta[146] * invT + activation_units[146] * fwd_Ea[146] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[24];
-    Kc = exp(-g_RT[1] + g_RT[10] + g_RT[12] - g_RT[24]);
+    Kc = Kc_s[146];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[12]) + (h_RT[1] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27570,12 +26752,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[13];
-    k_f = prefactor_units[147] * fwd_A[147]
-                * exp(fwd_beta[147] * tc[0] - activation_units[147] * fwd_Ea[147] * invT);
+    k_f = k_f_s[147];
     dlnkfdT = fwd_beta[147] * invT + activation_units[147] * fwd_Ea[147] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[12];
-    Kc = exp(g_RT[10] - 2*g_RT[12] + g_RT[13]);
+    Kc = Kc_s[147];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[13]) + (2*h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27610,12 +26791,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[27];
-    k_f = prefactor_units[148] * fwd_A[148]
-                * exp(fwd_beta[148] * tc[0] - activation_units[148] * fwd_Ea[148] * invT);
+    k_f = k_f_s[148];
     dlnkfdT = fwd_beta[148] * invT + activation_units[148] * fwd_Ea[148] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[23];
-    Kc = exp(g_RT[10] - g_RT[14] - g_RT[23] + g_RT[27]);
+    Kc = Kc_s[148];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[27]) + (h_RT[14] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27661,12 +26841,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[30];
-    k_f = prefactor_units[149] * fwd_A[149]
-                * exp(fwd_beta[149] * tc[0] - activation_units[149] * fwd_Ea[149] * invT);
+    k_f = k_f_s[149];
     dlnkfdT = fwd_beta[149] * invT + activation_units[149] * fwd_Ea[149] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[30];
-    Kc = exp(-g_RT[10] + g_RT[11] + g_RT[30] - g_RT[30]);
+    Kc = Kc_s[149];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[30]) + (h_RT[10] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27696,12 +26875,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[11];
-    k_f = prefactor_units[150] * fwd_A[150]
-                * exp(fwd_beta[150] * tc[0] - activation_units[150] * fwd_Ea[150] * invT);
+    k_f = k_f_s[150];
     dlnkfdT = fwd_beta[150] * invT + activation_units[150] * fwd_Ea[150] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[4]*sc[14];
-    Kc = refC * exp(-g_RT[1] + g_RT[3] - g_RT[4] + g_RT[11] - g_RT[14]);
+    Kc = Kc_s[150];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[11]) + (h_RT[1] + h_RT[4] + h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27760,12 +26938,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[11];
-    k_f = prefactor_units[151] * fwd_A[151]
-                * exp(fwd_beta[151] * tc[0] - activation_units[151] * fwd_Ea[151] * invT);
+    k_f = k_f_s[151];
     dlnkfdT = fwd_beta[151] * invT + activation_units[151] * fwd_Ea[151] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[14];
-    Kc = exp(g_RT[3] - g_RT[5] + g_RT[11] - g_RT[14]);
+    Kc = Kc_s[151];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[11]) + (h_RT[5] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27811,12 +26988,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[11];
-    k_f = prefactor_units[152] * fwd_A[152]
-                * exp(fwd_beta[152] * tc[0] - activation_units[152] * fwd_Ea[152] * invT);
+    k_f = k_f_s[152];
     dlnkfdT = fwd_beta[152] * invT + activation_units[152] * fwd_Ea[152] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[12];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[11] - g_RT[12]);
+    Kc = Kc_s[152];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[11]) + (h_RT[1] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27862,12 +27038,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[11];
-    k_f = prefactor_units[153] * fwd_A[153]
-                * exp(fwd_beta[153] * tc[0] - activation_units[153] * fwd_Ea[153] * invT);
+    k_f = k_f_s[153];
     dlnkfdT = fwd_beta[153] * invT + activation_units[153] * fwd_Ea[153] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[10];
-    Kc = exp(g_RT[5] - g_RT[5] - g_RT[10] + g_RT[11]);
+    Kc = Kc_s[153];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[11]) + (h_RT[5] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27897,12 +27072,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[12];
-    k_f = prefactor_units[154] * fwd_A[154]
-                * exp(fwd_beta[154] * tc[0] - activation_units[154] * fwd_Ea[154] * invT);
+    k_f = k_f_s[154];
     dlnkfdT = fwd_beta[154] * invT + activation_units[154] * fwd_Ea[154] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[24];
-    Kc = exp(-g_RT[1] + g_RT[11] + g_RT[12] - g_RT[24]);
+    Kc = Kc_s[154];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[12]) + (h_RT[1] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27948,12 +27122,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[13];
-    k_f = prefactor_units[155] * fwd_A[155]
-                * exp(fwd_beta[155] * tc[0] - activation_units[155] * fwd_Ea[155] * invT);
+    k_f = k_f_s[155];
     dlnkfdT = fwd_beta[155] * invT + activation_units[155] * fwd_Ea[155] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[12];
-    Kc = exp(g_RT[11] - 2*g_RT[12] + g_RT[13]);
+    Kc = Kc_s[155];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[13]) + (2*h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27988,12 +27161,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[14];
-    k_f = prefactor_units[156] * fwd_A[156]
-                * exp(fwd_beta[156] * tc[0] - activation_units[156] * fwd_Ea[156] * invT);
+    k_f = k_f_s[156];
     dlnkfdT = fwd_beta[156] * invT + activation_units[156] * fwd_Ea[156] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[14];
-    Kc = exp(-g_RT[10] + g_RT[11] + g_RT[14] - g_RT[14]);
+    Kc = Kc_s[156];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[14]) + (h_RT[10] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28023,12 +27195,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[15];
-    k_f = prefactor_units[157] * fwd_A[157]
-                * exp(fwd_beta[157] * tc[0] - activation_units[157] * fwd_Ea[157] * invT);
+    k_f = k_f_s[157];
     dlnkfdT = fwd_beta[157] * invT + activation_units[157] * fwd_Ea[157] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[15];
-    Kc = exp(-g_RT[10] + g_RT[11] + g_RT[15] - g_RT[15]);
+    Kc = Kc_s[157];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[15]) + (h_RT[10] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28058,12 +27229,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[15];
-    k_f = prefactor_units[158] * fwd_A[158]
-                * exp(fwd_beta[158] * tc[0] - activation_units[158] * fwd_Ea[158] * invT);
+    k_f = k_f_s[158];
     dlnkfdT = fwd_beta[158] * invT + activation_units[158] * fwd_Ea[158] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[17];
-    Kc = exp(g_RT[11] - g_RT[14] + g_RT[15] - g_RT[17]);
+    Kc = Kc_s[158];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[15]) + (h_RT[14] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28109,12 +27279,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[26];
-    k_f = prefactor_units[159] * fwd_A[159]
-                * exp(fwd_beta[159] * tc[0] - activation_units[159] * fwd_Ea[159] * invT);
+    k_f = k_f_s[159];
     dlnkfdT = fwd_beta[159] * invT + activation_units[159] * fwd_Ea[159] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[25];
-    Kc = exp(g_RT[11] - g_RT[12] - g_RT[25] + g_RT[26]);
+    Kc = Kc_s[159];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[26]) + (h_RT[12] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28160,12 +27329,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[12];
-    k_f = prefactor_units[160] * fwd_A[160]
-                * exp(fwd_beta[160] * tc[0] - activation_units[160] * fwd_Ea[160] * invT);
+    k_f = k_f_s[160];
     dlnkfdT = fwd_beta[160] * invT + activation_units[160] * fwd_Ea[160] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[19];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[12] - g_RT[19]);
+    Kc = Kc_s[160];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[12]) + (h_RT[2] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28211,12 +27379,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[12];
-    k_f = prefactor_units[161] * fwd_A[161]
-                * exp(fwd_beta[161] * tc[0] - activation_units[161] * fwd_Ea[161] * invT);
+    k_f = k_f_s[161];
     dlnkfdT = fwd_beta[161] * invT + activation_units[161] * fwd_Ea[161] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[17];
-    Kc = exp(g_RT[3] - g_RT[4] + g_RT[12] - g_RT[17]);
+    Kc = Kc_s[161];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[12]) + (h_RT[4] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28262,12 +27429,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[12];
-    k_f = prefactor_units[162] * fwd_A[162]
-                * exp(fwd_beta[162] * tc[0] - activation_units[162] * fwd_Ea[162] * invT);
+    k_f = k_f_s[162];
     dlnkfdT = fwd_beta[162] * invT + activation_units[162] * fwd_Ea[162] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[13];
-    Kc = exp(-g_RT[6] + g_RT[7] + g_RT[12] - g_RT[13]);
+    Kc = Kc_s[162];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[12]) + (h_RT[6] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28313,12 +27479,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[12];
-    k_f = prefactor_units[163] * fwd_A[163]
-                * exp(fwd_beta[163] * tc[0] - activation_units[163] * fwd_Ea[163] * invT);
+    k_f = k_f_s[163];
     dlnkfdT = fwd_beta[163] * invT + activation_units[163] * fwd_Ea[163] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[25];
-    Kc = exp(-g_RT[1] + 2*g_RT[12] - g_RT[25]);
+    Kc = Kc_s[163];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[12]) + (h_RT[1] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28353,12 +27518,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[16];
-    k_f = prefactor_units[164] * fwd_A[164]
-                * exp(fwd_beta[164] * tc[0] - activation_units[164] * fwd_Ea[164] * invT);
+    k_f = k_f_s[164];
     dlnkfdT = fwd_beta[164] * invT + activation_units[164] * fwd_Ea[164] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[14];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[164];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[16]) + (h_RT[13] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28404,12 +27568,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[17];
-    k_f = prefactor_units[165] * fwd_A[165]
-                * exp(fwd_beta[165] * tc[0] - activation_units[165] * fwd_Ea[165] * invT);
+    k_f = k_f_s[165];
     dlnkfdT = fwd_beta[165] * invT + activation_units[165] * fwd_Ea[165] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[16];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[165];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[17]) + (h_RT[13] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28455,12 +27618,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[20];
-    k_f = prefactor_units[166] * fwd_A[166]
-                * exp(fwd_beta[166] * tc[0] - activation_units[166] * fwd_Ea[166] * invT);
+    k_f = k_f_s[166];
     dlnkfdT = fwd_beta[166] * invT + activation_units[166] * fwd_Ea[166] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[18];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[166];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[20]) + (h_RT[13] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28506,12 +27668,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[20];
-    k_f = prefactor_units[167] * fwd_A[167]
-                * exp(fwd_beta[167] * tc[0] - activation_units[167] * fwd_Ea[167] * invT);
+    k_f = k_f_s[167];
     dlnkfdT = fwd_beta[167] * invT + activation_units[167] * fwd_Ea[167] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[19];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[19] + g_RT[20]);
+    Kc = Kc_s[167];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[20]) + (h_RT[13] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28557,12 +27718,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[24];
-    k_f = prefactor_units[168] * fwd_A[168]
-                * exp(fwd_beta[168] * tc[0] - activation_units[168] * fwd_Ea[168] * invT);
+    k_f = k_f_s[168];
     dlnkfdT = fwd_beta[168] * invT + activation_units[168] * fwd_Ea[168] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[23];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[23] + g_RT[24]);
+    Kc = Kc_s[168];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[24]) + (h_RT[13] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28608,12 +27768,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[26];
-    k_f = prefactor_units[169] * fwd_A[169]
-                * exp(fwd_beta[169] * tc[0] - activation_units[169] * fwd_Ea[169] * invT);
+    k_f = k_f_s[169];
     dlnkfdT = fwd_beta[169] * invT + activation_units[169] * fwd_Ea[169] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[25];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[25] + g_RT[26]);
+    Kc = Kc_s[169];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[26]) + (h_RT[13] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28659,12 +27818,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[16];
-    k_f = prefactor_units[170] * fwd_A[170]
-                * exp(fwd_beta[170] * tc[0] - activation_units[170] * fwd_Ea[170] * invT);
+    k_f = k_f_s[170];
     dlnkfdT = fwd_beta[170] * invT + activation_units[170] * fwd_Ea[170] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[5]*sc[14];
-    Kc = refC * exp(-g_RT[1] + g_RT[5] - g_RT[5] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[170];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[16]) + (h_RT[1] + h_RT[5] + h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28704,12 +27862,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[16];
-    k_f = prefactor_units[171] * fwd_A[171]
-                * exp(fwd_beta[171] * tc[0] - activation_units[171] * fwd_Ea[171] * invT);
+    k_f = k_f_s[171];
     dlnkfdT = fwd_beta[171] * invT + activation_units[171] * fwd_Ea[171] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[14];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[171];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[16]) + (h_RT[6] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28755,12 +27912,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[18];
-    k_f = prefactor_units[172] * fwd_A[172]
-                * exp(fwd_beta[172] * tc[0] - activation_units[172] * fwd_Ea[172] * invT);
+    k_f = k_f_s[172];
     dlnkfdT = fwd_beta[172] * invT + activation_units[172] * fwd_Ea[172] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[17];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[172];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[18]) + (h_RT[6] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28806,12 +27962,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[19];
-    k_f = prefactor_units[173] * fwd_A[173]
-                * exp(fwd_beta[173] * tc[0] - activation_units[173] * fwd_Ea[173] * invT);
+    k_f = k_f_s[173];
     dlnkfdT = fwd_beta[173] * invT + activation_units[173] * fwd_Ea[173] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[17];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[17] + g_RT[19]);
+    Kc = Kc_s[173];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[19]) + (h_RT[6] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28857,12 +28012,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[21];
-    k_f = prefactor_units[174] * fwd_A[174]
-                * exp(fwd_beta[174] * tc[0] - activation_units[174] * fwd_Ea[174] * invT);
+    k_f = k_f_s[174];
     dlnkfdT = fwd_beta[174] * invT + activation_units[174] * fwd_Ea[174] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[16];
-    Kc = exp(g_RT[3] - g_RT[14] - g_RT[16] + g_RT[21]);
+    Kc = Kc_s[174];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[21]) + (h_RT[14] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28908,12 +28062,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[21];
-    k_f = prefactor_units[175] * fwd_A[175]
-                * exp(fwd_beta[175] * tc[0] - activation_units[175] * fwd_Ea[175] * invT);
+    k_f = k_f_s[175];
     dlnkfdT = fwd_beta[175] * invT + activation_units[175] * fwd_Ea[175] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[22];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[21] - g_RT[22]);
+    Kc = Kc_s[175];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[21]) + (h_RT[1] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28959,12 +28112,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[23];
-    k_f = prefactor_units[176] * fwd_A[176]
-                * exp(fwd_beta[176] * tc[0] - activation_units[176] * fwd_Ea[176] * invT);
+    k_f = k_f_s[176];
     dlnkfdT = fwd_beta[176] * invT + activation_units[176] * fwd_Ea[176] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[17];
-    Kc = exp(g_RT[3] - g_RT[16] - g_RT[17] + g_RT[23]);
+    Kc = Kc_s[176];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[23]) + (h_RT[16] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29010,12 +28162,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[25];
-    k_f = prefactor_units[177] * fwd_A[177]
-                * exp(fwd_beta[177] * tc[0] - activation_units[177] * fwd_Ea[177] * invT);
+    k_f = k_f_s[177];
     dlnkfdT = fwd_beta[177] * invT + activation_units[177] * fwd_Ea[177] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[24];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[24] + g_RT[25]);
+    Kc = Kc_s[177];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[25]) + (h_RT[6] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29061,12 +28212,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[27];
-    k_f = prefactor_units[178] * fwd_A[178]
-                * exp(fwd_beta[178] * tc[0] - activation_units[178] * fwd_Ea[178] * invT);
+    k_f = k_f_s[178];
     dlnkfdT = fwd_beta[178] * invT + activation_units[178] * fwd_Ea[178] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[14]*sc[14];
-    Kc = refC * exp(g_RT[3] - g_RT[4] - 2*g_RT[14] + g_RT[27]);
+    Kc = Kc_s[178];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[27]) + (h_RT[4] + 2*h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29112,12 +28262,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[27]*sc[27];
-    k_f = prefactor_units[179] * fwd_A[179]
-                * exp(fwd_beta[179] * tc[0] - activation_units[179] * fwd_Ea[179] * invT);
+    k_f = k_f_s[179];
     dlnkfdT = fwd_beta[179] * invT + activation_units[179] * fwd_Ea[179] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[14]*sc[22];
-    Kc = refC * exp(-2*g_RT[14] - g_RT[22] + 2*g_RT[27]);
+    Kc = Kc_s[179];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[27]) + (2*h_RT[14] + h_RT[22]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29152,8 +28301,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[12];
-    k_f = prefactor_units[180] * fwd_A[180]
-                * exp(fwd_beta[180] * tc[0] - activation_units[180] * fwd_Ea[180] * invT);
+    k_f = k_f_s[180];
     dlnkfdT = fwd_beta[180] * invT + activation_units[180] * fwd_Ea[180] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -29189,12 +28337,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[24];
-    k_f = prefactor_units[181] * fwd_A[181]
-                * exp(fwd_beta[181] * tc[0] - activation_units[181] * fwd_Ea[181] * invT);
+    k_f = k_f_s[181];
     dlnkfdT = fwd_beta[181] * invT + activation_units[181] * fwd_Ea[181] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[33];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[24] - g_RT[33]);
+    Kc = Kc_s[181];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[24]) + (h_RT[1] + h_RT[33]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29240,12 +28387,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[25];
-    k_f = prefactor_units[182] * fwd_A[182]
-                * exp(fwd_beta[182] * tc[0] - activation_units[182] * fwd_Ea[182] * invT);
+    k_f = k_f_s[182];
     dlnkfdT = fwd_beta[182] * invT + activation_units[182] * fwd_Ea[182] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[34];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[25] - g_RT[34]);
+    Kc = Kc_s[182];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[25]) + (h_RT[1] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29291,12 +28437,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[6];
-    k_f = prefactor_units[183] * fwd_A[183]
-                * exp(fwd_beta[183] * tc[0] - activation_units[183] * fwd_Ea[183] * invT);
+    k_f = k_f_s[183];
     dlnkfdT = fwd_beta[183] * invT + activation_units[183] * fwd_Ea[183] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[5];
-    Kc = exp(-g_RT[3] + g_RT[4] - g_RT[5] + g_RT[6]);
+    Kc = Kc_s[183];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[6]) + (h_RT[3] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29342,8 +28487,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[12];
-    k_f = prefactor_units[184] * fwd_A[184]
-                * exp(fwd_beta[184] * tc[0] - activation_units[184] * fwd_Ea[184] * invT);
+    k_f = k_f_s[184];
     dlnkfdT = fwd_beta[184] * invT + activation_units[184] * fwd_Ea[184] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -29375,8 +28519,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[10];
-    k_f = prefactor_units[185] * fwd_A[185]
-                * exp(fwd_beta[185] * tc[0] - activation_units[185] * fwd_Ea[185] * invT);
+    k_f = k_f_s[185];
     dlnkfdT = fwd_beta[185] * invT + activation_units[185] * fwd_Ea[185] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -29408,12 +28551,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[10];
-    k_f = prefactor_units[186] * fwd_A[186]
-                * exp(fwd_beta[186] * tc[0] - activation_units[186] * fwd_Ea[186] * invT);
+    k_f = k_f_s[186];
     dlnkfdT = fwd_beta[186] * invT + activation_units[186] * fwd_Ea[186] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[17];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[10] - g_RT[17]);
+    Kc = Kc_s[186];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[10]) + (h_RT[2] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29459,8 +28601,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[10];
-    k_f = prefactor_units[187] * fwd_A[187]
-                * exp(fwd_beta[187] * tc[0] - activation_units[187] * fwd_Ea[187] * invT);
+    k_f = k_f_s[187];
     dlnkfdT = fwd_beta[187] * invT + activation_units[187] * fwd_Ea[187] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -29483,8 +28624,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[11];
-    k_f = prefactor_units[188] * fwd_A[188]
-                * exp(fwd_beta[188] * tc[0] - activation_units[188] * fwd_Ea[188] * invT);
+    k_f = k_f_s[188];
     dlnkfdT = fwd_beta[188] * invT + activation_units[188] * fwd_Ea[188] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -29516,12 +28656,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[23];
-    k_f = prefactor_units[189] * fwd_A[189]
-                * exp(fwd_beta[189] * tc[0] - activation_units[189] * fwd_Ea[189] * invT);
+    k_f = k_f_s[189];
     dlnkfdT = fwd_beta[189] * invT + activation_units[189] * fwd_Ea[189] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[33];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[23] - g_RT[33]);
+    Kc = Kc_s[189];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[23]) + (h_RT[2] + h_RT[33]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29567,12 +28706,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[23];
-    k_f = prefactor_units[190] * fwd_A[190]
-                * exp(fwd_beta[190] * tc[0] - activation_units[190] * fwd_Ea[190] * invT);
+    k_f = k_f_s[190];
     dlnkfdT = fwd_beta[190] * invT + activation_units[190] * fwd_Ea[190] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[22];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[22] + g_RT[23]);
+    Kc = Kc_s[190];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[23]) + (h_RT[6] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29618,12 +28756,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[34];
-    k_f = prefactor_units[191] * fwd_A[191]
-                * exp(fwd_beta[191] * tc[0] - activation_units[191] * fwd_Ea[191] * invT);
+    k_f = k_f_s[191];
     dlnkfdT = fwd_beta[191] * invT + activation_units[191] * fwd_Ea[191] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[33];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[33] + g_RT[34]);
+    Kc = Kc_s[191];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[34]) + (h_RT[4] + h_RT[33]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29669,8 +28806,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[34];
-    k_f = prefactor_units[192] * fwd_A[192]
-                * exp(fwd_beta[192] * tc[0] - activation_units[192] * fwd_Ea[192] * invT);
+    k_f = k_f_s[192];
     dlnkfdT = fwd_beta[192] * invT + activation_units[192] * fwd_Ea[192] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -29706,8 +28842,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[34];
-    k_f = prefactor_units[193] * fwd_A[193]
-                * exp(fwd_beta[193] * tc[0] - activation_units[193] * fwd_Ea[193] * invT);
+    k_f = k_f_s[193];
     dlnkfdT = fwd_beta[193] * invT + activation_units[193] * fwd_Ea[193] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -29743,12 +28878,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[34];
-    k_f = prefactor_units[194] * fwd_A[194]
-                * exp(fwd_beta[194] * tc[0] - activation_units[194] * fwd_Ea[194] * invT);
+    k_f = k_f_s[194];
     dlnkfdT = fwd_beta[194] * invT + activation_units[194] * fwd_Ea[194] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[33];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[33] + g_RT[34]);
+    Kc = Kc_s[194];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[34]) + (h_RT[0] + h_RT[33]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29794,8 +28928,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[34];
-    k_f = prefactor_units[195] * fwd_A[195]
-                * exp(fwd_beta[195] * tc[0] - activation_units[195] * fwd_Ea[195] * invT);
+    k_f = k_f_s[195];
     dlnkfdT = fwd_beta[195] * invT + activation_units[195] * fwd_Ea[195] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -29831,8 +28964,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[34];
-    k_f = prefactor_units[196] * fwd_A[196]
-                * exp(fwd_beta[196] * tc[0] - activation_units[196] * fwd_Ea[196] * invT);
+    k_f = k_f_s[196];
     dlnkfdT = fwd_beta[196] * invT + activation_units[196] * fwd_Ea[196] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -29868,8 +29000,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[34];
-    k_f = prefactor_units[197] * fwd_A[197]
-                * exp(fwd_beta[197] * tc[0] - activation_units[197] * fwd_Ea[197] * invT);
+    k_f = k_f_s[197];
     dlnkfdT = fwd_beta[197] * invT + activation_units[197] * fwd_Ea[197] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -29905,8 +29036,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[34];
-    k_f = prefactor_units[198] * fwd_A[198]
-                * exp(fwd_beta[198] * tc[0] - activation_units[198] * fwd_Ea[198] * invT);
+    k_f = k_f_s[198];
     dlnkfdT = fwd_beta[198] * invT + activation_units[198] * fwd_Ea[198] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -29934,8 +29064,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[33];
-    k_f = prefactor_units[199] * fwd_A[199]
-                * exp(fwd_beta[199] * tc[0] - activation_units[199] * fwd_Ea[199] * invT);
+    k_f = k_f_s[199];
     dlnkfdT = fwd_beta[199] * invT + activation_units[199] * fwd_Ea[199] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -29971,8 +29100,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[33];
-    k_f = prefactor_units[200] * fwd_A[200]
-                * exp(fwd_beta[200] * tc[0] - activation_units[200] * fwd_Ea[200] * invT);
+    k_f = k_f_s[200];
     dlnkfdT = fwd_beta[200] * invT + activation_units[200] * fwd_Ea[200] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -30008,8 +29136,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[33];
-    k_f = prefactor_units[201] * fwd_A[201]
-                * exp(fwd_beta[201] * tc[0] - activation_units[201] * fwd_Ea[201] * invT);
+    k_f = k_f_s[201];
     dlnkfdT = fwd_beta[201] * invT + activation_units[201] * fwd_Ea[201] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -30041,12 +29168,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[33];
-    k_f = prefactor_units[202] * fwd_A[202]
-                * exp(fwd_beta[202] * tc[0] - activation_units[202] * fwd_Ea[202] * invT);
+    k_f = k_f_s[202];
     dlnkfdT = fwd_beta[202] * invT + activation_units[202] * fwd_Ea[202] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[16];
-    Kc = exp(g_RT[1] - g_RT[12] - g_RT[16] + g_RT[33]);
+    Kc = Kc_s[202];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[33]) + (h_RT[12] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30092,12 +29218,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[33];
-    k_f = prefactor_units[203] * fwd_A[203]
-                * exp(fwd_beta[203] * tc[0] - activation_units[203] * fwd_Ea[203] * invT);
+    k_f = k_f_s[203];
     dlnkfdT = fwd_beta[203] * invT + activation_units[203] * fwd_Ea[203] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[28];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[28] + g_RT[33]);
+    Kc = Kc_s[203];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[33]) + (h_RT[0] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30143,12 +29268,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[33];
-    k_f = prefactor_units[204] * fwd_A[204]
-                * exp(fwd_beta[204] * tc[0] - activation_units[204] * fwd_Ea[204] * invT);
+    k_f = k_f_s[204];
     dlnkfdT = fwd_beta[204] * invT + activation_units[204] * fwd_Ea[204] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[28];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[28] + g_RT[33]);
+    Kc = Kc_s[204];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[33]) + (h_RT[5] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30194,12 +29318,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[33];
-    k_f = prefactor_units[205] * fwd_A[205]
-                * exp(fwd_beta[205] * tc[0] - activation_units[205] * fwd_Ea[205] * invT);
+    k_f = k_f_s[205];
     dlnkfdT = fwd_beta[205] * invT + activation_units[205] * fwd_Ea[205] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[18];
-    Kc = exp(g_RT[4] - g_RT[16] - g_RT[18] + g_RT[33]);
+    Kc = Kc_s[205];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[33]) + (h_RT[16] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30245,12 +29368,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[32];
-    k_f = prefactor_units[206] * fwd_A[206]
-                * exp(fwd_beta[206] * tc[0] - activation_units[206] * fwd_Ea[206] * invT);
+    k_f = k_f_s[206];
     dlnkfdT = fwd_beta[206] * invT + activation_units[206] * fwd_Ea[206] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[31];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[31] + g_RT[32]);
+    Kc = Kc_s[206];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[32]) + (h_RT[4] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30296,12 +29418,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[32];
-    k_f = prefactor_units[207] * fwd_A[207]
-                * exp(fwd_beta[207] * tc[0] - activation_units[207] * fwd_Ea[207] * invT);
+    k_f = k_f_s[207];
     dlnkfdT = fwd_beta[207] * invT + activation_units[207] * fwd_Ea[207] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[31];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[31] + g_RT[32]);
+    Kc = Kc_s[207];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[32]) + (h_RT[0] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30347,12 +29468,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[32];
-    k_f = prefactor_units[208] * fwd_A[208]
-                * exp(fwd_beta[208] * tc[0] - activation_units[208] * fwd_Ea[208] * invT);
+    k_f = k_f_s[208];
     dlnkfdT = fwd_beta[208] * invT + activation_units[208] * fwd_Ea[208] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[31];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[31] + g_RT[32]);
+    Kc = Kc_s[208];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[32]) + (h_RT[5] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30398,12 +29518,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[31];
-    k_f = prefactor_units[209] * fwd_A[209]
-                * exp(fwd_beta[209] * tc[0] - activation_units[209] * fwd_Ea[209] * invT);
+    k_f = k_f_s[209];
     dlnkfdT = fwd_beta[209] * invT + activation_units[209] * fwd_Ea[209] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[32];
-    Kc = exp(-g_RT[6] + g_RT[7] + g_RT[31] - g_RT[32]);
+    Kc = Kc_s[209];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[31]) + (h_RT[6] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30449,12 +29568,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[32];
-    k_f = prefactor_units[210] * fwd_A[210]
-                * exp(fwd_beta[210] * tc[0] - activation_units[210] * fwd_Ea[210] * invT);
+    k_f = k_f_s[210];
     dlnkfdT = fwd_beta[210] * invT + activation_units[210] * fwd_Ea[210] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[31];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[31] + g_RT[32]);
+    Kc = Kc_s[210];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[32]) + (h_RT[13] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30500,12 +29618,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[31];
-    k_f = prefactor_units[211] * fwd_A[211]
-                * exp(fwd_beta[211] * tc[0] - activation_units[211] * fwd_Ea[211] * invT);
+    k_f = k_f_s[211];
     dlnkfdT = fwd_beta[211] * invT + activation_units[211] * fwd_Ea[211] * invT2;
     /* reverse */
     phi_r = sc[17]*sc[25];
-    Kc = exp(g_RT[2] - g_RT[17] - g_RT[25] + g_RT[31]);
+    Kc = Kc_s[211];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[31]) + (h_RT[17] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30551,12 +29668,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[31];
-    k_f = prefactor_units[212] * fwd_A[212]
-                * exp(fwd_beta[212] * tc[0] - activation_units[212] * fwd_Ea[212] * invT);
+    k_f = k_f_s[212];
     dlnkfdT = fwd_beta[212] * invT + activation_units[212] * fwd_Ea[212] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[25];
-    Kc = exp(g_RT[1] - g_RT[12] - g_RT[25] + g_RT[31]);
+    Kc = Kc_s[212];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[31]) + (h_RT[12] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30602,12 +29718,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[31];
-    k_f = prefactor_units[213] * fwd_A[213]
-                * exp(fwd_beta[213] * tc[0] - activation_units[213] * fwd_Ea[213] * invT);
+    k_f = k_f_s[213];
     dlnkfdT = fwd_beta[213] * invT + activation_units[213] * fwd_Ea[213] * invT2;
     /* reverse */
     phi_r = sc[18]*sc[25];
-    Kc = exp(g_RT[4] - g_RT[18] - g_RT[25] + g_RT[31]);
+    Kc = Kc_s[213];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[31]) + (h_RT[18] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30653,12 +29768,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[31];
-    k_f = prefactor_units[214] * fwd_A[214]
-                * exp(fwd_beta[214] * tc[0] - activation_units[214] * fwd_Ea[214] * invT);
+    k_f = k_f_s[214];
     dlnkfdT = fwd_beta[214] * invT + activation_units[214] * fwd_Ea[214] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[32];
-    Kc = exp(-g_RT[3] + g_RT[6] + g_RT[31] - g_RT[32]);
+    Kc = Kc_s[214];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[31]) + (h_RT[3] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30704,8 +29818,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[31];
-    k_f = prefactor_units[215] * fwd_A[215]
-                * exp(fwd_beta[215] * tc[0] - activation_units[215] * fwd_Ea[215] * invT);
+    k_f = k_f_s[215];
     dlnkfdT = fwd_beta[215] * invT + activation_units[215] * fwd_Ea[215] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -30741,12 +29854,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[31];
-    k_f = prefactor_units[216] * fwd_A[216]
-                * exp(fwd_beta[216] * tc[0] - activation_units[216] * fwd_Ea[216] * invT);
+    k_f = k_f_s[216];
     dlnkfdT = fwd_beta[216] * invT + activation_units[216] * fwd_Ea[216] * invT2;
     /* reverse */
     phi_r = sc[25]*sc[25];
-    Kc = exp(g_RT[12] - 2*g_RT[25] + g_RT[31]);
+    Kc = Kc_s[216];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[31]) + (2*h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30789,6 +29901,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         dcvpRdT(dcRdT, tc);
         speciesInternalEnergy(e_RT, tc);
         eh_RT = &e_RT[0];
+        for (int k=0; k<35; k++) {
+            for (int m=0; m<35; m++) {
+                J[k*36+m] += Jmix[m];
+            }
+        }
     }
 
     double cmix = 0.0, ehmix = 0.0, dcmixdT=0.0, dehmixdT=0.0;
@@ -36095,6 +35212,55 @@ void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double
     *ierr = 0;
     return;
 }
+/* get temperature given enthalpy in mass units and mass fracs */
+void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int * ierr)
+{
+#ifdef CONVERGENCE
+    const int maxiter = 5000;
+    const double tol  = 1.e-12;
+#else
+    const int maxiter = 200;
+    const double tol  = 1.e-6;
+#endif
+    double hin  = *h;
+    double tmin = 250;/*max lower bound for thermo def */
+    double tmax = 4000;/*min upper bound for thermo def */
+    double h1,hmin,hmax,cp,t1,dt;
+    int i;/* loop counter */
+    CKHBMS(&tmin, y, iwrk, rwrk, &hmin);
+    CKHBMS(&tmax, y, iwrk, rwrk, &hmax);
+    if (hin < hmin) {
+        /*Linear Extrapolation below tmin */
+        CKCPBS(&tmin, y, iwrk, rwrk, &cp);
+        *t = tmin - (hmin-hin)/cp;
+        *ierr = 1;
+        return;
+    }
+    if (hin > hmax) {
+        /*Linear Extrapolation above tmax */
+        CKCPBS(&tmax, y, iwrk, rwrk, &cp);
+        *t = tmax - (hmax-hin)/cp;
+        *ierr = 1;
+        return;
+    }
+    t1 = *t;
+    if (t1 < tmin || t1 > tmax) {
+        t1 = tmin + (tmax-tmin)/(hmax-hmin)*(hin-hmin);
+    }
+    for (i = 0; i < maxiter; ++i) {
+        CKHBMS(&t1,y,iwrk,rwrk,&h1);
+        CKCPBS(&t1,y,iwrk,rwrk,&cp);
+        dt = (hin - h1) / cp;
+        if (dt > 100.) { dt = 100.; }
+        else if (dt < -100.) { dt = -100.; }
+        else if (fabs(dt) < tol) break;
+        else if (t1+dt == t1) break;
+        t1 += dt;
+    }
+    *t = t1;
+    *ierr = 0;
+    return;
+}
 
 /* End of file  */
 #if defined(BL_FORT_USE_UPPERCASE)
@@ -1,5 +1,6 @@
 
 #include <math.h>
+#include <float.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -86,7 +87,14 @@
 #define VCKPY VCKPY
 #define VCKWYR VCKWYR
 #define VCKYTX VCKYTX
+#define VCKCPBS VCKCPBS
+#define VCKCVBS VCKCVBS
+#define VCKHBMS VCKHBMS
+#define VCKUBMS VCKUBMS
+#define VCKRHOY VCKRHOY
+#define VCKMMWY VCKMMWY
 #define GET_T_GIVEN_EY GET_T_GIVEN_EY
+#define GET_T_GIVEN_HY GET_T_GIVEN_HY
 #define GET_REACTION_MAP GET_REACTION_MAP
 #elif defined(BL_FORT_USE_LOWERCASE)
 #define CKINDX ckindx
@@ -170,7 +178,14 @@
 #define VCKPY vckpy
 #define VCKWYR vckwyr
 #define VCKYTX vckytx
+#define VCKCPBS vckcpbs
+#define VCKCVBS vckcvbs
+#define VCKHBMS vckhbms
+#define VCKUBMS vckubms
+#define VCKRHOY vckrhoy
+#define VCKMMWY vckmmwy
 #define GET_T_GIVEN_EY get_t_given_ey
+#define GET_T_GIVEN_HY get_t_given_hy
 #define GET_REACTION_MAP get_reaction_map
 #elif defined(BL_FORT_USE_UNDERSCORE)
 #define CKINDX ckindx_
@@ -254,7 +269,14 @@
 #define VCKPY vckpy_
 #define VCKWYR vckwyr_
 #define VCKYTX vckytx_
+#define VCKCPBS vckcpbs_
+#define VCKCVBS vckcvbs_
+#define VCKHBMS vckhbms_
+#define VCKUBMS vckubms_
+#define VCKRHOY vckrhoy_
+#define VCKMMWY vckmmwy_
 #define GET_T_GIVEN_EY get_t_given_ey_
+#define GET_T_GIVEN_HY get_t_given_hy_
 #define GET_REACTION_MAP get_reaction_map_
 #endif
 
@@ -356,6 +378,7 @@ void DWDOT(double * restrict J, double * restrict sc, double * restrict T, int *
 void aJacobian(double * restrict J, double * restrict sc, double T, int consP);
 void dcvpRdT(double * restrict species, double * restrict tc);
 void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
+void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
 void GET_REACTION_MAP(int * restrict rmap);
 /*vector version */
 void vproductionRate(int npt, double * restrict wdot, double * restrict c, double * restrict T);
@@ -365,6 +388,12 @@ void VCKWYR(int * restrict np, double * restrict rho, double * restrict T,
             double * restrict y, int * restrict iwrk, double * restrict rwrk,
             double * restrict wdot);
 void VCKYTX(int * restrict np, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict x);
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs);
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs);
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms);
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms);
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho);
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm);
 void vcomp_k_f(int npt, double * restrict k_f_s, double * restrict tc, double * restrict invT);
 void vcomp_gibbs(int npt, double * restrict g_RT, double * restrict tc);
 void vcomp_Kc(int npt, double * restrict Kc_s, double * restrict g_RT, double * restrict invT);
@@ -4502,38 +4531,6 @@ void CKINDX(int * iwrk, double * restrict rwrk, int * mm, int * kk, int * ii, in
 }
 
 
-/* strtok_r: re-entrant (threadsafe) version of strtok, helper function for tokenizing strings  */
-char *strtok_r(char *s, const char *delim, char **save_ptr)
-{
-    char *token;
-
-    if (s == NULL)
-        s = *save_ptr;
-
-    /* Scan leading delimiters.  */
-    s += strspn (s, delim);
-    if (*s == '\0')
-    {
-        *save_ptr = s;
-        return NULL;
-    }
-
-    /* Find the end of the token.  */
-    token = s;
-    s = strpbrk (token, delim);
-    if (s == NULL)
-        /* This token finishes the string.  */
-        *save_ptr = __rawmemchr (token, '\0');
-    else
-    {
-        /* Terminate the token and make *SAVE_PTR point past it.  */
-        *s = '\0';
-        *save_ptr = s + 1;
-    }
-    return token;
-}
-
-
 
 /* ckxnum... for parsing strings  */
 void CKXNUM(char * line, int * nexp, int * lout, int * nval, double * restrict rval, int * kerr, int lenline )
@@ -5265,6 +5262,28 @@ void CKRHOY(double * restrict P, double * restrict T, double * restrict y, int *
 }
 
 
+/*Compute rho = P*W(y)/RT */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho)
+{
+    for (int i=0; i<(*np); i++) {
+        rho[i] = 0.0;
+    }
+
+    for (int n=0; n<53; n++) {
+        for (int i=0; i<(*np); i++) {
+            rho[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        rho[i] = P[i] / (8.31451e+07 * T[i] * rho[i]);/*rho = P*W/(R*T) */
+    }
+
+    return;
+}
+
+
 /*Compute rho = P*W(c)/(R*T) */
 void CKRHOC(double * restrict P, double * restrict T, double * restrict c, int * iwrk, double * restrict rwrk, double * restrict rho)
 {
@@ -5370,6 +5389,29 @@ void CKMMWY(double * restrict y, int * iwrk, double * restrict rwrk, double * re
 }
 
 
+/*given y[species]: mass fractions */
+/*returns mean molecular weight (gm/mole) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm)
+{
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 0.0;
+    }
+
+    for (int n=0; n<53; n++) {
+        for (int i=0; i<(*np); i++) {
+            wtm[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 1.0 / wtm[i];
+    }
+
+    return;
+}
+
+
 /*given x[species]: mole fractions */
 /*returns mean molecular weight (gm/mole) */
 void CKMMWX(double * restrict x, int * iwrk, double * restrict rwrk, double * restrict wtm)
@@ -6449,6 +6491,30 @@ void CKCPBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CP (Eq. 34) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs)
+{
+    double tc[5], tmp[53], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cp_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<53; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cpbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean specific heat at CV (Eq. 35) */
 void CKCVBL(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict cvbl)
 {
@@ -6535,6 +6601,30 @@ void CKCVBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CV (Eq. 36) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs)
+{
+    double tc[5], tmp[53], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cv_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<53; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cvbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean enthalpy of the mixture in molar units */
 void CKHBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict hbml)
 {
@@ -6576,6 +6666,30 @@ void CKHBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns mean enthalpy of mixture in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms)
+{
+    double tc[5], tmp[53], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesEnthalpy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<53; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        hbms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mean internal energy in molar units */
 void CKUBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict ubml)
 {
@@ -6664,6 +6778,30 @@ void CKUBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*get mean internal energy in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms)
+{
+    double tc[5], tmp[53], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesInternalEnergy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<53; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        ubms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mixture entropy in molar units */
 void CKSBML(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict sbml)
 {
@@ -17057,12 +17195,347 @@ void productionRate(double * restrict wdot, double * restrict sc, double T)
 
 void comp_k_f(double * restrict tc, double invT, double * restrict k_f)
 {
+    double x[325];
+#ifdef __INTEL_COMPILER
+    #pragma simd
+#endif
+    for (int i=0; i<325; ++i) {
+        x[i] = fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT;
+    };
+
+    /*the exp is skipped when the exponent is zero or that of */
+    /*an earlier reaction with the same default beta and Ea */
+    k_f[0] = (x[0] == 0.0 ? 1.0 : exp(x[0]));
+    k_f[1] = exp(x[1]);
+    k_f[2] = exp(x[2]);
+    k_f[3] = exp(x[3]);
+    k_f[4] = exp(x[4]);
+    k_f[5] = exp(x[5]);
+    k_f[6] = exp(x[6]);
+    k_f[7] = exp(x[7]);
+    k_f[8] = exp(x[8]);
+    k_f[9] = exp(x[9]);
+    k_f[10] = exp(x[10]);
+    k_f[11] = exp(x[11]);
+    k_f[12] = exp(x[12]);
+    k_f[13] = exp(x[13]);
+    k_f[14] = exp(x[14]);
+    k_f[15] = (x[15] == 0.0 ? 1.0 : exp(x[15]));
+    k_f[16] = exp(x[16]);
+    k_f[17] = exp(x[17]);
+    k_f[18] = exp(x[18]);
+    k_f[19] = exp(x[19]);
+    k_f[20] = exp(x[20]);
+    k_f[21] = exp(x[21]);
+    k_f[22] = exp(x[22]);
+    k_f[23] = (x[23] == 0.0 ? 1.0 : exp(x[23]));
+    k_f[24] = exp(x[24]);
+    k_f[25] = (x[25] == 0.0 ? 1.0 : exp(x[25]));
+    k_f[26] = exp(x[26]);
+    k_f[27] = exp(x[27]);
+    k_f[28] = (x[28] == 0.0 ? 1.0 : exp(x[28]));
+    k_f[29] = (x[29] == x[7] ? k_f[7] : exp(x[29]));
+    k_f[30] = (x[30] == x[7] ? k_f[7] : exp(x[30]));
+    k_f[31] = exp(x[31]);
+    k_f[32] = (x[32] == x[7] ? k_f[7] : exp(x[32]));
+    k_f[33] = exp(x[33]);
+    k_f[34] = exp(x[34]);
+    k_f[35] = exp(x[35]);
+    k_f[36] = exp(x[36]);
+    k_f[37] = exp(x[37]);
+    k_f[38] = exp(x[38]);
+    k_f[39] = exp(x[39]);
+    k_f[40] = exp(x[40]);
+    k_f[41] = exp(x[41]);
+    k_f[42] = (x[42] == 0.0 ? 1.0 : exp(x[42]));
+    k_f[43] = exp(x[43]);
+    k_f[44] = (x[44] == 0.0 ? 1.0 : exp(x[44]));
+    k_f[45] = (x[45] == 0.0 ? 1.0 : exp(x[45]));
+    k_f[46] = (x[46] == 0.0 ? 1.0 : exp(x[46]));
+    k_f[47] = (x[47] == 0.0 ? 1.0 : exp(x[47]));
+    k_f[48] = (x[48] == 0.0 ? 1.0 : exp(x[48]));
+    k_f[49] = exp(x[49]);
+    k_f[50] = (x[50] == 0.0 ? 1.0 : exp(x[50]));
+    k_f[51] = (x[51] == 0.0 ? 1.0 : exp(x[51]));
+    k_f[52] = exp(x[52]);
+    k_f[53] = (x[53] == 0.0 ? 1.0 : exp(x[53]));
+    k_f[54] = (x[54] == 0.0 ? 1.0 : exp(x[54]));
+    k_f[55] = exp(x[55]);
+    k_f[56] = exp(x[56]);
+    k_f[57] = (x[57] == 0.0 ? 1.0 : exp(x[57]));
+    k_f[58] = exp(x[58]);
+    k_f[59] = exp(x[59]);
+    k_f[60] = (x[60] == x[58] ? k_f[58] : exp(x[60]));
+    k_f[61] = (x[61] == 0.0 ? 1.0 : exp(x[61]));
+    k_f[62] = exp(x[62]);
+    k_f[63] = (x[63] == 0.0 ? 1.0 : exp(x[63]));
+    k_f[64] = exp(x[64]);
+    k_f[65] = (x[65] == 0.0 ? 1.0 : exp(x[65]));
+    k_f[66] = exp(x[66]);
+    k_f[67] = exp(x[67]);
+    k_f[68] = exp(x[68]);
+    k_f[69] = exp(x[69]);
+    k_f[70] = exp(x[70]);
+    k_f[71] = exp(x[71]);
+    k_f[72] = (x[72] == x[70] ? k_f[70] : exp(x[72]));
+    k_f[73] = exp(x[73]);
+    k_f[74] = exp(x[74]);
+    k_f[75] = exp(x[75]);
+    k_f[76] = exp(x[76]);
+    k_f[77] = (x[77] == x[33] ? k_f[33] : exp(x[77]));
+    k_f[78] = exp(x[78]);
+    k_f[79] = exp(x[79]);
+    k_f[80] = exp(x[80]);
+    k_f[81] = exp(x[81]);
+    k_f[82] = exp(x[82]);
+    k_f[83] = (x[83] == 0.0 ? 1.0 : exp(x[83]));
+    k_f[84] = (x[84] == 0.0 ? 1.0 : exp(x[84]));
+    k_f[85] = exp(x[85]);
+    k_f[86] = (x[86] == 0.0 ? 1.0 : exp(x[86]));
+    k_f[87] = exp(x[87]);
+    k_f[88] = (x[88] == 0.0 ? 1.0 : exp(x[88]));
+    k_f[89] = exp(x[89]);
+    k_f[90] = exp(x[90]);
+    k_f[91] = exp(x[91]);
+    k_f[92] = (x[92] == 0.0 ? 1.0 : exp(x[92]));
+    k_f[93] = exp(x[93]);
+    k_f[94] = exp(x[94]);
+    k_f[95] = exp(x[95]);
+    k_f[96] = (x[96] == x[95] ? k_f[95] : exp(x[96]));
+    k_f[97] = (x[97] == 0.0 ? 1.0 : exp(x[97]));
+    k_f[98] = exp(x[98]);
+    k_f[99] = (x[99] == 0.0 ? 1.0 : exp(x[99]));
+    k_f[100] = exp(x[100]);
+    k_f[101] = (x[101] == 0.0 ? 1.0 : exp(x[101]));
+    k_f[102] = (x[102] == x[66] ? k_f[66] : exp(x[102]));
+    k_f[103] = exp(x[103]);
+    k_f[104] = (x[104] == 0.0 ? 1.0 : exp(x[104]));
+    k_f[105] = exp(x[105]);
+    k_f[106] = exp(x[106]);
+    k_f[107] = exp(x[107]);
+    k_f[108] = exp(x[108]);
+    k_f[109] = exp(x[109]);
+    k_f[110] = (x[110] == 0.0 ? 1.0 : exp(x[110]));
+    k_f[111] = (x[111] == 0.0 ? 1.0 : exp(x[111]));
+    k_f[112] = (x[112] == 0.0 ? 1.0 : exp(x[112]));
+    k_f[113] = exp(x[113]);
+    k_f[114] = (x[114] == 0.0 ? 1.0 : exp(x[114]));
+    k_f[115] = exp(x[115]);
+    k_f[116] = exp(x[116]);
+    k_f[117] = exp(x[117]);
+    k_f[118] = exp(x[118]);
+    k_f[119] = (x[119] == 0.0 ? 1.0 : exp(x[119]));
+    k_f[120] = exp(x[120]);
+    k_f[121] = (x[121] == 0.0 ? 1.0 : exp(x[121]));
+    k_f[122] = (x[122] == 0.0 ? 1.0 : exp(x[122]));
+    k_f[123] = exp(x[123]);
+    k_f[124] = exp(x[124]);
+    k_f[125] = (x[125] == 0.0 ? 1.0 : exp(x[125]));
+    k_f[126] = exp(x[126]);
+    k_f[127] = exp(x[127]);
+    k_f[128] = exp(x[128]);
+    k_f[129] = exp(x[129]);
+    k_f[130] = (x[130] == 0.0 ? 1.0 : exp(x[130]));
+    k_f[131] = exp(x[131]);
+    k_f[132] = exp(x[132]);
+    k_f[133] = exp(x[133]);
+    k_f[134] = exp(x[134]);
+    k_f[135] = exp(x[135]);
+    k_f[136] = (x[136] == 0.0 ? 1.0 : exp(x[136]));
+    k_f[137] = (x[137] == 0.0 ? 1.0 : exp(x[137]));
+    k_f[138] = (x[138] == 0.0 ? 1.0 : exp(x[138]));
+    k_f[139] = exp(x[139]);
+    k_f[140] = exp(x[140]);
+    k_f[141] = exp(x[141]);
+    k_f[142] = (x[142] == 0.0 ? 1.0 : exp(x[142]));
+    k_f[143] = (x[143] == 0.0 ? 1.0 : exp(x[143]));
+    k_f[144] = (x[144] == 0.0 ? 1.0 : exp(x[144]));
+    k_f[145] = exp(x[145]);
+    k_f[146] = exp(x[146]);
+    k_f[147] = (x[147] == 0.0 ? 1.0 : exp(x[147]));
+    k_f[148] = (x[148] == 0.0 ? 1.0 : exp(x[148]));
+    k_f[149] = (x[149] == 0.0 ? 1.0 : exp(x[149]));
+    k_f[150] = exp(x[150]);
+    k_f[151] = exp(x[151]);
+    k_f[152] = (x[152] == 0.0 ? 1.0 : exp(x[152]));
+    k_f[153] = exp(x[153]);
+    k_f[154] = exp(x[154]);
+    k_f[155] = exp(x[155]);
+    k_f[156] = (x[156] == 0.0 ? 1.0 : exp(x[156]));
+    k_f[157] = exp(x[157]);
+    k_f[158] = (x[158] == 0.0 ? 1.0 : exp(x[158]));
+    k_f[159] = exp(x[159]);
+    k_f[160] = (x[160] == x[159] ? k_f[159] : exp(x[160]));
+    k_f[161] = (x[161] == 0.0 ? 1.0 : exp(x[161]));
+    k_f[162] = (x[162] == 0.0 ? 1.0 : exp(x[162]));
+    k_f[163] = (x[163] == 0.0 ? 1.0 : exp(x[163]));
+    k_f[164] = (x[164] == 0.0 ? 1.0 : exp(x[164]));
+    k_f[165] = exp(x[165]);
+    k_f[166] = (x[166] == x[165] ? k_f[165] : exp(x[166]));
+    k_f[167] = (x[167] == 0.0 ? 1.0 : exp(x[167]));
+    k_f[168] = (x[168] == 0.0 ? 1.0 : exp(x[168]));
+    k_f[169] = (x[169] == 0.0 ? 1.0 : exp(x[169]));
+    k_f[170] = exp(x[170]);
+    k_f[171] = exp(x[171]);
+    k_f[172] = exp(x[172]);
+    k_f[173] = exp(x[173]);
+    k_f[174] = exp(x[174]);
+    k_f[175] = (x[175] == 0.0 ? 1.0 : exp(x[175]));
+    k_f[176] = exp(x[176]);
+    k_f[177] = exp(x[177]);
+    k_f[178] = (x[178] == x[177] ? k_f[177] : exp(x[178]));
+    k_f[179] = exp(x[179]);
+    k_f[180] = exp(x[180]);
+    k_f[181] = (x[181] == x[34] ? k_f[34] : exp(x[181]));
+    k_f[182] = exp(x[182]);
+    k_f[183] = exp(x[183]);
+    k_f[184] = exp(x[184]);
+    k_f[185] = (x[185] == x[146] ? k_f[146] : exp(x[185]));
+    k_f[186] = exp(x[186]);
+    k_f[187] = exp(x[187]);
+    k_f[188] = exp(x[188]);
+    k_f[189] = exp(x[189]);
+    k_f[190] = (x[190] == 0.0 ? 1.0 : exp(x[190]));
+    k_f[191] = exp(x[191]);
+    k_f[192] = exp(x[192]);
+    k_f[193] = exp(x[193]);
+    k_f[194] = exp(x[194]);
+    k_f[195] = exp(x[195]);
+    k_f[196] = exp(x[196]);
+    k_f[197] = exp(x[197]);
+    k_f[198] = exp(x[198]);
+    k_f[199] = exp(x[199]);
+    k_f[200] = exp(x[200]);
+    k_f[201] = (x[201] == 0.0 ? 1.0 : exp(x[201]));
+    k_f[202] = exp(x[202]);
+    k_f[203] = (x[203] == 0.0 ? 1.0 : exp(x[203]));
+    k_f[204] = exp(x[204]);
+    k_f[205] = exp(x[205]);
+    k_f[206] = exp(x[206]);
+    k_f[207] = (x[207] == 0.0 ? 1.0 : exp(x[207]));
+    k_f[208] = exp(x[208]);
+    k_f[209] = exp(x[209]);
+    k_f[210] = exp(x[210]);
+    k_f[211] = (x[211] == 0.0 ? 1.0 : exp(x[211]));
+    k_f[212] = (x[212] == 0.0 ? 1.0 : exp(x[212]));
+    k_f[213] = exp(x[213]);
+    k_f[214] = exp(x[214]);
+    k_f[215] = (x[215] == 0.0 ? 1.0 : exp(x[215]));
+    k_f[216] = (x[216] == 0.0 ? 1.0 : exp(x[216]));
+    k_f[217] = (x[217] == 0.0 ? 1.0 : exp(x[217]));
+    k_f[218] = (x[218] == 0.0 ? 1.0 : exp(x[218]));
+    k_f[219] = (x[219] == 0.0 ? 1.0 : exp(x[219]));
+    k_f[220] = (x[220] == 0.0 ? 1.0 : exp(x[220]));
+    k_f[221] = (x[221] == 0.0 ? 1.0 : exp(x[221]));
+    k_f[222] = (x[222] == 0.0 ? 1.0 : exp(x[222]));
+    k_f[223] = exp(x[223]);
+    k_f[224] = exp(x[224]);
+    k_f[225] = exp(x[225]);
+    k_f[226] = (x[226] == 0.0 ? 1.0 : exp(x[226]));
+    k_f[227] = (x[227] == 0.0 ? 1.0 : exp(x[227]));
+    k_f[228] = exp(x[228]);
+    k_f[229] = exp(x[229]);
+    k_f[230] = exp(x[230]);
+    k_f[231] = (x[231] == 0.0 ? 1.0 : exp(x[231]));
+    k_f[232] = (x[232] == 0.0 ? 1.0 : exp(x[232]));
+    k_f[233] = (x[233] == 0.0 ? 1.0 : exp(x[233]));
+    k_f[234] = (x[234] == 0.0 ? 1.0 : exp(x[234]));
+    k_f[235] = exp(x[235]);
+    k_f[236] = exp(x[236]);
+    k_f[237] = exp(x[237]);
+    k_f[238] = exp(x[238]);
+    k_f[239] = (x[239] == x[238] ? k_f[238] : exp(x[239]));
+    k_f[240] = exp(x[240]);
+    k_f[241] = exp(x[241]);
+    k_f[242] = exp(x[242]);
+    k_f[243] = exp(x[243]);
+    k_f[244] = (x[244] == x[182] ? k_f[182] : exp(x[244]));
+    k_f[245] = exp(x[245]);
+    k_f[246] = exp(x[246]);
+    k_f[247] = exp(x[247]);
+    k_f[248] = exp(x[248]);
+    k_f[249] = (x[249] == 0.0 ? 1.0 : exp(x[249]));
+    k_f[250] = (x[250] == 0.0 ? 1.0 : exp(x[250]));
+    k_f[251] = (x[251] == 0.0 ? 1.0 : exp(x[251]));
+    k_f[252] = (x[252] == 0.0 ? 1.0 : exp(x[252]));
+    k_f[253] = (x[253] == 0.0 ? 1.0 : exp(x[253]));
+    k_f[254] = exp(x[254]);
+    k_f[255] = exp(x[255]);
+    k_f[256] = exp(x[256]);
+    k_f[257] = (x[257] == x[254] ? k_f[254] : exp(x[257]));
+    k_f[258] = (x[258] == x[255] ? k_f[255] : exp(x[258]));
+    k_f[259] = (x[259] == x[256] ? k_f[256] : exp(x[259]));
+    k_f[260] = exp(x[260]);
+    k_f[261] = exp(x[261]);
+    k_f[262] = (x[262] == 0.0 ? 1.0 : exp(x[262]));
+    k_f[263] = (x[263] == 0.0 ? 1.0 : exp(x[263]));
+    k_f[264] = (x[264] == 0.0 ? 1.0 : exp(x[264]));
+    k_f[265] = (x[265] == 0.0 ? 1.0 : exp(x[265]));
+    k_f[266] = (x[266] == 0.0 ? 1.0 : exp(x[266]));
+    k_f[267] = exp(x[267]);
+    k_f[268] = exp(x[268]);
+    k_f[269] = exp(x[269]);
+    k_f[270] = exp(x[270]);
+    k_f[271] = exp(x[271]);
+    k_f[272] = exp(x[272]);
+    k_f[273] = (x[273] == x[272] ? k_f[272] : exp(x[273]));
+    k_f[274] = exp(x[274]);
+    k_f[275] = exp(x[275]);
+    k_f[276] = exp(x[276]);
+    k_f[277] = exp(x[277]);
+    k_f[278] = (x[278] == 0.0 ? 1.0 : exp(x[278]));
+    k_f[279] = exp(x[279]);
+    k_f[280] = exp(x[280]);
+    k_f[281] = exp(x[281]);
+    k_f[282] = exp(x[282]);
+    k_f[283] = exp(x[283]);
+    k_f[284] = exp(x[284]);
+    k_f[285] = exp(x[285]);
+    k_f[286] = exp(x[286]);
+    k_f[287] = exp(x[287]);
+    k_f[288] = (x[288] == 0.0 ? 1.0 : exp(x[288]));
+    k_f[289] = (x[289] == x[62] ? k_f[62] : exp(x[289]));
+    k_f[290] = (x[290] == 0.0 ? 1.0 : exp(x[290]));
+    k_f[291] = exp(x[291]);
+    k_f[292] = exp(x[292]);
+    k_f[293] = (x[293] == x[153] ? k_f[153] : exp(x[293]));
+    k_f[294] = (x[294] == x[153] ? k_f[153] : exp(x[294]));
+    k_f[295] = exp(x[295]);
+    k_f[296] = exp(x[296]);
+    k_f[297] = exp(x[297]);
+    k_f[298] = exp(x[298]);
+    k_f[299] = exp(x[299]);
+    k_f[300] = (x[300] == x[299] ? k_f[299] : exp(x[300]));
+    k_f[301] = exp(x[301]);
+    k_f[302] = exp(x[302]);
+    k_f[303] = (x[303] == x[302] ? k_f[302] : exp(x[303]));
+    k_f[304] = exp(x[304]);
+    k_f[305] = exp(x[305]);
+    k_f[306] = exp(x[306]);
+    k_f[307] = (x[307] == 0.0 ? 1.0 : exp(x[307]));
+    k_f[308] = (x[308] == 0.0 ? 1.0 : exp(x[308]));
+    k_f[309] = (x[309] == 0.0 ? 1.0 : exp(x[309]));
+    k_f[310] = (x[310] == 0.0 ? 1.0 : exp(x[310]));
+    k_f[311] = (x[311] == 0.0 ? 1.0 : exp(x[311]));
+    k_f[312] = (x[312] == 0.0 ? 1.0 : exp(x[312]));
+    k_f[313] = (x[313] == 0.0 ? 1.0 : exp(x[313]));
+    k_f[314] = exp(x[314]);
+    k_f[315] = exp(x[315]);
+    k_f[316] = exp(x[316]);
+    k_f[317] = exp(x[317]);
+    k_f[318] = exp(x[318]);
+    k_f[319] = (x[319] == 0.0 ? 1.0 : exp(x[319]));
+    k_f[320] = exp(x[320]);
+    k_f[321] = (x[321] == 0.0 ? 1.0 : exp(x[321]));
+    k_f[322] = exp(x[322]);
+    k_f[323] = (x[323] == 0.0 ? 1.0 : exp(x[323]));
+    k_f[324] = exp(x[324]);
+
 #ifdef __INTEL_COMPILER
     #pragma simd
 #endif
     for (int i=0; i<325; ++i) {
-        k_f[i] = prefactor_units[i] * fwd_A[i]
-                    * exp(fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT);
+        k_f[i] *= prefactor_units[i] * fwd_A[i];
     };
     return;
 }
@@ -17073,415 +17546,753 @@ void comp_Kc(double * restrict tc, double invT, double * restrict Kc)
     double g_RT[53];
     gibbs(g_RT, tc);
 
-    Kc[0] = g_RT[1] + g_RT[10] - g_RT[12];
-    Kc[1] = g_RT[1] + g_RT[12] - g_RT[13];
-    Kc[2] = g_RT[1] + g_RT[16] - g_RT[17];
-    Kc[3] = g_RT[1] + g_RT[17] - g_RT[18];
-    Kc[4] = g_RT[1] + g_RT[17] - g_RT[19];
-    Kc[5] = g_RT[1] + g_RT[18] - g_RT[20];
-    Kc[6] = g_RT[1] + g_RT[19] - g_RT[20];
-    Kc[7] = g_RT[1] + g_RT[21] - g_RT[22];
-    Kc[8] = g_RT[1] + g_RT[22] - g_RT[23];
-    Kc[9] = g_RT[1] + g_RT[23] - g_RT[24];
-    Kc[10] = g_RT[1] + g_RT[24] - g_RT[25];
-    Kc[11] = g_RT[1] + g_RT[25] - g_RT[26];
-    Kc[12] = g_RT[0] + g_RT[14] - g_RT[17];
-    Kc[13] = 2*g_RT[4] - g_RT[7];
-    Kc[14] = g_RT[4] + g_RT[12] - g_RT[20];
-    Kc[15] = g_RT[9] + g_RT[14] - g_RT[27];
-    Kc[16] = g_RT[10] + g_RT[14] - g_RT[28];
-    Kc[17] = g_RT[5] + g_RT[11] - g_RT[20];
-    Kc[18] = 2*g_RT[12] - g_RT[26];
-    Kc[19] = -g_RT[0] - g_RT[22] + g_RT[24];
-    Kc[20] = g_RT[9] - g_RT[42] + g_RT[47];
-    Kc[21] = g_RT[0] + g_RT[9] - g_RT[12];
-    Kc[22] = g_RT[1] + g_RT[28] - g_RT[51];
-    Kc[23] = g_RT[12] + g_RT[25] - g_RT[50];
-    Kc[24] = g_RT[12] + g_RT[24] - g_RT[49];
-    Kc[25] = g_RT[1] + g_RT[49] - g_RT[50];
-    Kc[26] = g_RT[2] + g_RT[14] - g_RT[15];
-    Kc[27] = -g_RT[2] + g_RT[37] - g_RT[47];
-    Kc[28] = g_RT[1] + g_RT[40] - g_RT[41];
-    Kc[29] = 2*g_RT[2] - g_RT[3];
-    Kc[30] = g_RT[1] + g_RT[2] - g_RT[4];
-    Kc[31] = g_RT[1] + g_RT[3] - g_RT[6];
-    Kc[32] = -g_RT[0] + 2*g_RT[1];
-    Kc[33] = g_RT[1] + g_RT[4] - g_RT[5];
-    Kc[34] = -g_RT[1] - g_RT[14] + g_RT[16];
-    Kc[35] = g_RT[2] + g_RT[35] - g_RT[36];
-    Kc[36] = -g_RT[1] + g_RT[34] - g_RT[47];
-    Kc[37] = g_RT[1] + g_RT[35] - g_RT[38];
-    Kc[38] = -g_RT[14] - g_RT[30] + g_RT[46];
-    Kc[39] = -g_RT[1] - g_RT[39] + g_RT[40];
-    Kc[40] = -g_RT[14] - g_RT[31] + g_RT[45];
-    Kc[41] = g_RT[0] - g_RT[1] + g_RT[2] - g_RT[4];
-    Kc[42] = g_RT[2] - g_RT[3] - g_RT[4] + g_RT[6];
-    Kc[43] = g_RT[2] - g_RT[4] - g_RT[6] + g_RT[7];
-    Kc[44] = -g_RT[1] + g_RT[2] + g_RT[9] - g_RT[14];
-    Kc[45] = -g_RT[1] + g_RT[2] + g_RT[10] - g_RT[16];
-    Kc[46] = -g_RT[0] + g_RT[2] + g_RT[11] - g_RT[14];
-    Kc[47] = -g_RT[1] + g_RT[2] + g_RT[11] - g_RT[16];
-    Kc[48] = -g_RT[1] + g_RT[2] + g_RT[12] - g_RT[17];
-    Kc[49] = g_RT[2] - g_RT[4] - g_RT[12] + g_RT[13];
-    Kc[50] = g_RT[2] - g_RT[4] - g_RT[14] + g_RT[16];
-    Kc[51] = -g_RT[1] + g_RT[2] - g_RT[15] + g_RT[16];
-    Kc[52] = g_RT[2] - g_RT[4] - g_RT[16] + g_RT[17];
-    Kc[53] = g_RT[2] - g_RT[4] - g_RT[17] + g_RT[18];
-    Kc[54] = g_RT[2] - g_RT[4] - g_RT[17] + g_RT[19];
-    Kc[55] = g_RT[2] - g_RT[4] - g_RT[18] + g_RT[20];
-    Kc[56] = g_RT[2] - g_RT[4] - g_RT[19] + g_RT[20];
-    Kc[57] = g_RT[2] - g_RT[9] - g_RT[14] + g_RT[21];
-    Kc[58] = -g_RT[1] + g_RT[2] + g_RT[22] - g_RT[27];
-    Kc[59] = g_RT[2] - g_RT[4] - g_RT[21] + g_RT[22];
-    Kc[60] = g_RT[2] - g_RT[10] - g_RT[14] + g_RT[22];
-    Kc[61] = -g_RT[1] + g_RT[2] + g_RT[23] - g_RT[28];
-    Kc[62] = g_RT[2] - g_RT[12] - g_RT[16] + g_RT[24];
-    Kc[63] = g_RT[2] - g_RT[12] - g_RT[17] + g_RT[25];
-    Kc[64] = g_RT[2] - g_RT[4] - g_RT[25] + g_RT[26];
-    Kc[65] = -g_RT[1] + g_RT[2] - 2*g_RT[14] + g_RT[27];
-    Kc[66] = g_RT[2] - g_RT[4] - g_RT[27] + g_RT[28];
-    Kc[67] = g_RT[2] - g_RT[10] - g_RT[15] + g_RT[28];
-    Kc[68] = -g_RT[2] + g_RT[3] + g_RT[14] - g_RT[15];
-    Kc[69] = g_RT[3] - g_RT[6] - g_RT[16] + g_RT[17];
-    Kc[70] = g_RT[1] + 2*g_RT[3] - g_RT[3] - g_RT[6];
-    Kc[71] = g_RT[1] + g_RT[3] + g_RT[5] - g_RT[5] - g_RT[6];
-    Kc[72] = g_RT[1] + g_RT[3] - g_RT[6] + g_RT[47] - g_RT[47];
-    Kc[73] = g_RT[1] + g_RT[3] - g_RT[6] + g_RT[48] - g_RT[48];
-    Kc[74] = g_RT[1] - g_RT[2] + g_RT[3] - g_RT[4];
-    Kc[75] = g_RT[0] - 2*g_RT[0] + 2*g_RT[1];
-    Kc[76] = -g_RT[0] + 2*g_RT[1] + g_RT[5] - g_RT[5];
-    Kc[77] = -g_RT[0] + 2*g_RT[1] + g_RT[15] - g_RT[15];
-    Kc[78] = g_RT[1] - g_RT[2] - g_RT[5] + g_RT[6];
-    Kc[79] = -g_RT[0] + g_RT[1] - g_RT[3] + g_RT[6];
-    Kc[80] = g_RT[1] - 2*g_RT[4] + g_RT[6];
-    Kc[81] = -g_RT[0] + g_RT[1] - g_RT[6] + g_RT[7];
-    Kc[82] = g_RT[1] - g_RT[4] - g_RT[5] + g_RT[7];
-    Kc[83] = -g_RT[0] + g_RT[1] - g_RT[8] + g_RT[9];
-    Kc[84] = -g_RT[0] + g_RT[1] - g_RT[9] + g_RT[11];
-    Kc[85] = -g_RT[0] + g_RT[1] - g_RT[12] + g_RT[13];
-    Kc[86] = -g_RT[0] + g_RT[1] - g_RT[14] + g_RT[16];
-    Kc[87] = -g_RT[0] + g_RT[1] - g_RT[16] + g_RT[17];
-    Kc[88] = -g_RT[0] + g_RT[1] - g_RT[17] + g_RT[18];
-    Kc[89] = g_RT[1] - g_RT[4] - g_RT[12] + g_RT[18];
-    Kc[90] = g_RT[1] - g_RT[5] - g_RT[11] + g_RT[18];
-    Kc[91] = g_RT[1] - g_RT[1] - g_RT[18] + g_RT[19];
-    Kc[92] = -g_RT[0] + g_RT[1] - g_RT[17] + g_RT[19];
-    Kc[93] = g_RT[1] - g_RT[4] - g_RT[12] + g_RT[19];
-    Kc[94] = g_RT[1] - g_RT[5] - g_RT[11] + g_RT[19];
-    Kc[95] = -g_RT[0] + g_RT[1] - g_RT[18] + g_RT[20];
-    Kc[96] = -g_RT[0] + g_RT[1] - g_RT[19] + g_RT[20];
-    Kc[97] = -g_RT[0] + g_RT[1] - g_RT[22] + g_RT[23];
-    Kc[98] = -g_RT[0] + g_RT[1] - g_RT[23] + g_RT[24];
-    Kc[99] = -g_RT[0] + g_RT[1] - g_RT[24] + g_RT[25];
-    Kc[100] = -g_RT[0] + g_RT[1] - g_RT[25] + g_RT[26];
-    Kc[101] = g_RT[1] - g_RT[11] - g_RT[14] + g_RT[27];
-    Kc[102] = -g_RT[0] + g_RT[1] - g_RT[27] + g_RT[28];
-    Kc[103] = g_RT[1] - g_RT[12] - g_RT[14] + g_RT[28];
-    Kc[104] = g_RT[1] - g_RT[1] - g_RT[28] + g_RT[29];
-    Kc[105] = g_RT[0] - g_RT[1] + g_RT[4] - g_RT[5];
-    Kc[106] = -g_RT[2] + 2*g_RT[4] - g_RT[5];
-    Kc[107] = -g_RT[3] + g_RT[4] - g_RT[5] + g_RT[6];
-    Kc[108] = g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7];
-    Kc[109] = g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7];
-    Kc[110] = -g_RT[1] + g_RT[4] + g_RT[8] - g_RT[14];
-    Kc[111] = -g_RT[1] + g_RT[4] + g_RT[9] - g_RT[16];
-    Kc[112] = -g_RT[1] + g_RT[4] + g_RT[10] - g_RT[17];
-    Kc[113] = g_RT[4] - g_RT[5] - g_RT[9] + g_RT[10];
-    Kc[114] = -g_RT[1] + g_RT[4] + g_RT[11] - g_RT[17];
-    Kc[115] = g_RT[4] - g_RT[5] - g_RT[10] + g_RT[12];
-    Kc[116] = g_RT[4] - g_RT[5] - g_RT[11] + g_RT[12];
-    Kc[117] = g_RT[4] - g_RT[5] - g_RT[12] + g_RT[13];
-    Kc[118] = -g_RT[1] + g_RT[4] + g_RT[14] - g_RT[15];
-    Kc[119] = g_RT[4] - g_RT[5] - g_RT[14] + g_RT[16];
-    Kc[120] = g_RT[4] - g_RT[5] - g_RT[16] + g_RT[17];
-    Kc[121] = g_RT[4] - g_RT[5] - g_RT[17] + g_RT[18];
-    Kc[122] = g_RT[4] - g_RT[5] - g_RT[17] + g_RT[19];
-    Kc[123] = g_RT[4] - g_RT[5] - g_RT[18] + g_RT[20];
-    Kc[124] = g_RT[4] - g_RT[5] - g_RT[19] + g_RT[20];
-    Kc[125] = -g_RT[1] + g_RT[4] + g_RT[21] - g_RT[27];
-    Kc[126] = -g_RT[1] + g_RT[4] + g_RT[22] - g_RT[28];
-    Kc[127] = -g_RT[1] + g_RT[4] + g_RT[22] - g_RT[29];
-    Kc[128] = g_RT[4] - g_RT[5] - g_RT[21] + g_RT[22];
-    Kc[129] = g_RT[4] - g_RT[12] - g_RT[14] + g_RT[22];
-    Kc[130] = g_RT[4] - g_RT[5] - g_RT[22] + g_RT[23];
-    Kc[131] = g_RT[4] - g_RT[5] - g_RT[23] + g_RT[24];
-    Kc[132] = g_RT[4] - g_RT[5] - g_RT[25] + g_RT[26];
-    Kc[133] = g_RT[4] - g_RT[5] - g_RT[27] + g_RT[28];
-    Kc[134] = -g_RT[3] + 2*g_RT[6] - g_RT[7];
-    Kc[135] = -g_RT[3] + 2*g_RT[6] - g_RT[7];
-    Kc[136] = -g_RT[4] + g_RT[6] + g_RT[10] - g_RT[17];
-    Kc[137] = -g_RT[3] + g_RT[6] + g_RT[12] - g_RT[13];
-    Kc[138] = -g_RT[4] + g_RT[6] + g_RT[12] - g_RT[19];
-    Kc[139] = -g_RT[4] + g_RT[6] + g_RT[14] - g_RT[15];
-    Kc[140] = g_RT[6] - g_RT[7] - g_RT[16] + g_RT[17];
-    Kc[141] = -g_RT[2] + g_RT[3] + g_RT[8] - g_RT[14];
-    Kc[142] = -g_RT[1] + g_RT[8] + g_RT[10] - g_RT[21];
-    Kc[143] = -g_RT[1] + g_RT[8] + g_RT[12] - g_RT[22];
-    Kc[144] = -g_RT[2] + g_RT[3] + g_RT[9] - g_RT[16];
-    Kc[145] = g_RT[0] - g_RT[1] + g_RT[9] - g_RT[10];
-    Kc[146] = -g_RT[1] + g_RT[5] + g_RT[9] - g_RT[17];
-    Kc[147] = -g_RT[1] + g_RT[9] + g_RT[10] - g_RT[22];
-    Kc[148] = -g_RT[1] + g_RT[9] + g_RT[12] - g_RT[23];
-    Kc[149] = -g_RT[1] + g_RT[9] + g_RT[13] - g_RT[24];
-    Kc[150] = g_RT[9] - g_RT[14] + g_RT[15] - g_RT[16];
-    Kc[151] = -g_RT[1] + g_RT[9] + g_RT[17] - g_RT[28];
-    Kc[152] = g_RT[9] - g_RT[14] - g_RT[22] + g_RT[27];
-    Kc[153] = -g_RT[1] + g_RT[3] - g_RT[4] + g_RT[10] - g_RT[14];
-    Kc[154] = g_RT[0] - g_RT[1] + g_RT[10] - g_RT[12];
-    Kc[155] = -g_RT[0] + 2*g_RT[10] - g_RT[22];
-    Kc[156] = -g_RT[1] + g_RT[10] + g_RT[12] - g_RT[24];
-    Kc[157] = g_RT[10] - 2*g_RT[12] + g_RT[13];
-    Kc[158] = g_RT[10] - g_RT[14] - g_RT[23] + g_RT[27];
-    Kc[159] = -g_RT[10] + g_RT[11] + g_RT[47] - g_RT[47];
-    Kc[160] = -g_RT[10] + g_RT[11] + g_RT[48] - g_RT[48];
-    Kc[161] = -g_RT[1] + g_RT[3] - g_RT[4] + g_RT[11] - g_RT[14];
-    Kc[162] = g_RT[3] - g_RT[5] + g_RT[11] - g_RT[14];
-    Kc[163] = g_RT[0] - g_RT[1] + g_RT[11] - g_RT[12];
-    Kc[164] = g_RT[5] - g_RT[5] - g_RT[10] + g_RT[11];
-    Kc[165] = -g_RT[1] + g_RT[11] + g_RT[12] - g_RT[24];
-    Kc[166] = g_RT[11] - 2*g_RT[12] + g_RT[13];
-    Kc[167] = -g_RT[10] + g_RT[11] + g_RT[14] - g_RT[14];
-    Kc[168] = -g_RT[10] + g_RT[11] + g_RT[15] - g_RT[15];
-    Kc[169] = g_RT[11] - g_RT[14] + g_RT[15] - g_RT[17];
-    Kc[170] = g_RT[11] - g_RT[12] - g_RT[25] + g_RT[26];
-    Kc[171] = -g_RT[2] + g_RT[3] + g_RT[12] - g_RT[19];
-    Kc[172] = g_RT[3] - g_RT[4] + g_RT[12] - g_RT[17];
-    Kc[173] = -g_RT[6] + g_RT[7] + g_RT[12] - g_RT[13];
-    Kc[174] = -g_RT[1] + 2*g_RT[12] - g_RT[25];
-    Kc[175] = g_RT[12] - g_RT[13] - g_RT[14] + g_RT[16];
-    Kc[176] = g_RT[12] - g_RT[13] - g_RT[16] + g_RT[17];
-    Kc[177] = g_RT[12] - g_RT[13] - g_RT[18] + g_RT[20];
-    Kc[178] = g_RT[12] - g_RT[13] - g_RT[19] + g_RT[20];
-    Kc[179] = g_RT[12] - g_RT[13] - g_RT[23] + g_RT[24];
-    Kc[180] = g_RT[12] - g_RT[13] - g_RT[25] + g_RT[26];
-    Kc[181] = -g_RT[1] + g_RT[5] - g_RT[5] - g_RT[14] + g_RT[16];
-    Kc[182] = g_RT[3] - g_RT[6] - g_RT[14] + g_RT[16];
-    Kc[183] = g_RT[3] - g_RT[6] - g_RT[17] + g_RT[18];
-    Kc[184] = g_RT[3] - g_RT[6] - g_RT[17] + g_RT[19];
-    Kc[185] = g_RT[3] - g_RT[14] - g_RT[16] + g_RT[21];
-    Kc[186] = g_RT[0] - g_RT[1] + g_RT[21] - g_RT[22];
-    Kc[187] = g_RT[3] - g_RT[16] - g_RT[17] + g_RT[23];
-    Kc[188] = g_RT[3] - g_RT[6] - g_RT[24] + g_RT[25];
-    Kc[189] = g_RT[3] - g_RT[4] - 2*g_RT[14] + g_RT[27];
-    Kc[190] = -2*g_RT[14] - g_RT[22] + 2*g_RT[27];
-    Kc[191] = -g_RT[2] + g_RT[30] + g_RT[35] - g_RT[47];
-    Kc[192] = -g_RT[2] + g_RT[3] + g_RT[30] - g_RT[35];
-    Kc[193] = -g_RT[1] + g_RT[4] + g_RT[30] - g_RT[35];
-    Kc[194] = g_RT[2] - g_RT[3] + g_RT[37] - g_RT[47];
-    Kc[195] = g_RT[2] - 2*g_RT[35] + g_RT[37];
-    Kc[196] = g_RT[1] - g_RT[4] + g_RT[37] - g_RT[47];
-    Kc[197] = g_RT[4] - g_RT[6] + g_RT[37] - g_RT[47];
-    Kc[198] = -g_RT[4] + g_RT[6] + g_RT[35] - g_RT[36];
-    Kc[199] = g_RT[2] - g_RT[3] - g_RT[35] + g_RT[36];
-    Kc[200] = g_RT[1] - g_RT[4] - g_RT[35] + g_RT[36];
-    Kc[201] = -g_RT[1] + g_RT[2] + g_RT[31] - g_RT[35];
-    Kc[202] = -g_RT[0] + g_RT[1] - g_RT[30] + g_RT[31];
-    Kc[203] = -g_RT[1] + g_RT[4] + g_RT[31] - g_RT[38];
-    Kc[204] = g_RT[4] - g_RT[5] - g_RT[30] + g_RT[31];
-    Kc[205] = -g_RT[2] + g_RT[3] + g_RT[31] - g_RT[38];
-    Kc[206] = g_RT[3] - g_RT[4] + g_RT[31] - g_RT[35];
-    Kc[207] = -g_RT[1] + g_RT[30] + g_RT[31] - g_RT[47];
-    Kc[208] = -g_RT[0] + g_RT[5] + g_RT[31] - g_RT[38];
-    Kc[209] = -g_RT[4] + g_RT[31] + g_RT[35] - g_RT[47];
-    Kc[210] = -g_RT[1] + g_RT[31] + g_RT[35] - g_RT[37];
-    Kc[211] = g_RT[2] - g_RT[4] - g_RT[31] + g_RT[32];
-    Kc[212] = -g_RT[1] + g_RT[2] + g_RT[32] - g_RT[38];
-    Kc[213] = -g_RT[0] + g_RT[1] - g_RT[31] + g_RT[32];
-    Kc[214] = g_RT[4] - g_RT[5] - g_RT[31] + g_RT[32];
-    Kc[215] = -g_RT[1] + g_RT[34] - g_RT[47];
-    Kc[216] = g_RT[3] - g_RT[6] + g_RT[34] - g_RT[47];
-    Kc[217] = g_RT[2] - g_RT[4] + g_RT[34] - g_RT[47];
-    Kc[218] = g_RT[2] - g_RT[31] + g_RT[34] - g_RT[35];
-    Kc[219] = -g_RT[0] + g_RT[1] + g_RT[34] - g_RT[47];
-    Kc[220] = g_RT[4] - g_RT[5] + g_RT[34] - g_RT[47];
-    Kc[221] = g_RT[12] - g_RT[13] + g_RT[34] - g_RT[47];
-    Kc[222] = g_RT[2] - g_RT[4] - g_RT[35] + g_RT[38];
-    Kc[223] = -g_RT[0] + g_RT[1] - g_RT[35] + g_RT[38];
-    Kc[224] = g_RT[4] - g_RT[5] - g_RT[35] + g_RT[38];
-    Kc[225] = g_RT[3] - g_RT[6] - g_RT[35] + g_RT[38];
-    Kc[226] = g_RT[2] - g_RT[14] - g_RT[30] + g_RT[39];
-    Kc[227] = -g_RT[1] + g_RT[4] + g_RT[39] - g_RT[46];
-    Kc[228] = -g_RT[4] + g_RT[5] + g_RT[39] - g_RT[40];
-    Kc[229] = -g_RT[2] + g_RT[3] + g_RT[39] - g_RT[46];
-    Kc[230] = g_RT[0] - g_RT[1] + g_RT[39] - g_RT[40];
-    Kc[231] = g_RT[2] - g_RT[14] - g_RT[35] + g_RT[46];
-    Kc[232] = g_RT[1] - g_RT[14] - g_RT[31] + g_RT[46];
-    Kc[233] = -g_RT[1] + g_RT[4] - g_RT[14] - g_RT[35] + g_RT[46];
-    Kc[234] = -g_RT[14] + g_RT[30] + g_RT[46] - g_RT[47];
-    Kc[235] = g_RT[3] - g_RT[15] - g_RT[35] + g_RT[46];
-    Kc[236] = -g_RT[14] + g_RT[35] - g_RT[37] + g_RT[46];
-    Kc[237] = -g_RT[15] + g_RT[35] + g_RT[46] - g_RT[47];
-    Kc[238] = -g_RT[1] + g_RT[2] + g_RT[40] - g_RT[46];
-    Kc[239] = g_RT[2] - g_RT[14] - g_RT[31] + g_RT[40];
-    Kc[240] = g_RT[2] - g_RT[4] - g_RT[39] + g_RT[40];
-    Kc[241] = -g_RT[1] + g_RT[4] + g_RT[40] - g_RT[44];
-    Kc[242] = -g_RT[1] + g_RT[4] + g_RT[40] - g_RT[45];
-    Kc[243] = g_RT[4] - g_RT[14] - g_RT[32] + g_RT[40];
-    Kc[244] = -g_RT[10] + g_RT[30] + g_RT[41] - g_RT[47];
-    Kc[245] = g_RT[8] - g_RT[30] - g_RT[39] + g_RT[47];
-    Kc[246] = g_RT[9] - g_RT[30] - g_RT[40] + g_RT[47];
-    Kc[247] = g_RT[10] - g_RT[31] - g_RT[40] + g_RT[47];
-    Kc[248] = g_RT[11] - g_RT[31] - g_RT[40] + g_RT[47];
-    Kc[249] = -g_RT[2] + g_RT[8] + g_RT[35] - g_RT[39];
-    Kc[250] = g_RT[8] - g_RT[14] - g_RT[30] + g_RT[35];
-    Kc[251] = -g_RT[2] + g_RT[9] + g_RT[35] - g_RT[40];
-    Kc[252] = -g_RT[1] + g_RT[9] + g_RT[35] - g_RT[46];
-    Kc[253] = g_RT[9] - g_RT[16] - g_RT[30] + g_RT[35];
-    Kc[254] = -g_RT[1] + g_RT[10] + g_RT[35] - g_RT[45];
-    Kc[255] = -g_RT[4] + g_RT[10] + g_RT[35] - g_RT[40];
-    Kc[256] = -g_RT[1] + g_RT[10] + g_RT[35] - g_RT[43];
-    Kc[257] = -g_RT[1] + g_RT[11] + g_RT[35] - g_RT[45];
-    Kc[258] = -g_RT[4] + g_RT[11] + g_RT[35] - g_RT[40];
-    Kc[259] = -g_RT[1] + g_RT[11] + g_RT[35] - g_RT[43];
-    Kc[260] = -g_RT[5] + g_RT[12] + g_RT[35] - g_RT[40];
-    Kc[261] = -g_RT[4] + g_RT[12] + g_RT[35] - g_RT[41];
-    Kc[262] = -g_RT[1] + g_RT[2] - g_RT[14] + g_RT[42] - g_RT[47];
-    Kc[263] = g_RT[2] - g_RT[35] - g_RT[40] + g_RT[42];
-    Kc[264] = -g_RT[2] + g_RT[3] - g_RT[16] + g_RT[42] - g_RT[47];
-    Kc[265] = -g_RT[1] + g_RT[4] - g_RT[16] + g_RT[42] - g_RT[47];
-    Kc[266] = g_RT[1] - g_RT[10] + g_RT[42] - g_RT[47];
-    Kc[267] = g_RT[2] - g_RT[15] - g_RT[31] + g_RT[45];
-    Kc[268] = g_RT[2] - g_RT[14] - g_RT[38] + g_RT[45];
-    Kc[269] = g_RT[2] - g_RT[4] + g_RT[45] - g_RT[46];
-    Kc[270] = g_RT[1] - g_RT[14] - g_RT[32] + g_RT[45];
-    Kc[271] = -g_RT[0] + g_RT[1] + g_RT[45] - g_RT[46];
-    Kc[272] = g_RT[4] - g_RT[5] + g_RT[45] - g_RT[46];
-    Kc[273] = g_RT[4] - g_RT[15] - g_RT[32] + g_RT[45];
-    Kc[274] = g_RT[1] - g_RT[1] + g_RT[43] - g_RT[45];
-    Kc[275] = g_RT[1] - g_RT[4] - g_RT[40] + g_RT[43];
-    Kc[276] = g_RT[1] - g_RT[14] - g_RT[32] + g_RT[43];
-    Kc[277] = g_RT[1] - g_RT[1] + g_RT[44] - g_RT[45];
-    Kc[278] = -g_RT[14] + g_RT[27] + g_RT[35] - g_RT[43];
-    Kc[279] = -g_RT[1] + g_RT[12] + g_RT[30] - g_RT[41];
-    Kc[280] = -g_RT[0] + g_RT[12] + g_RT[30] - g_RT[40];
-    Kc[281] = -g_RT[0] + g_RT[1] - g_RT[32] + g_RT[33];
-    Kc[282] = g_RT[4] - g_RT[5] - g_RT[32] + g_RT[33];
-    Kc[283] = g_RT[2] - g_RT[4] - g_RT[32] + g_RT[33];
-    Kc[284] = -g_RT[14] + g_RT[15] + g_RT[31] - g_RT[38];
-    Kc[285] = -g_RT[35] + g_RT[36] + g_RT[39] - g_RT[46];
-    Kc[286] = -g_RT[15] + g_RT[36] - g_RT[37] + g_RT[46];
-    Kc[287] = -g_RT[14] + g_RT[15] + g_RT[30] - g_RT[35];
-    Kc[288] = -g_RT[0] - g_RT[1] + g_RT[2] + g_RT[12] - g_RT[14];
-    Kc[289] = -g_RT[1] + g_RT[2] + g_RT[24] - g_RT[51];
-    Kc[290] = -g_RT[1] + g_RT[2] + g_RT[25] - g_RT[52];
-    Kc[291] = -g_RT[3] + g_RT[4] - g_RT[5] + g_RT[6];
-    Kc[292] = -g_RT[0] + g_RT[4] + g_RT[12] - g_RT[17];
-    Kc[293] = -2*g_RT[1] + g_RT[3] + g_RT[10] - g_RT[15];
-    Kc[294] = -g_RT[2] + g_RT[3] + g_RT[10] - g_RT[17];
-    Kc[295] = -2*g_RT[1] + g_RT[10] + g_RT[10] - g_RT[22];
-    Kc[296] = -g_RT[0] + g_RT[5] + g_RT[11] - g_RT[17];
-    Kc[297] = -g_RT[2] + g_RT[3] + g_RT[23] - g_RT[51];
-    Kc[298] = g_RT[3] - g_RT[6] - g_RT[22] + g_RT[23];
-    Kc[299] = g_RT[2] - g_RT[4] - g_RT[51] + g_RT[52];
-    Kc[300] = g_RT[2] - g_RT[4] - g_RT[12] - g_RT[14] + g_RT[52];
-    Kc[301] = g_RT[3] - g_RT[6] - g_RT[12] - g_RT[14] + g_RT[52];
-    Kc[302] = -g_RT[0] + g_RT[1] - g_RT[51] + g_RT[52];
-    Kc[303] = -g_RT[0] + g_RT[1] - g_RT[12] - g_RT[14] + g_RT[52];
-    Kc[304] = g_RT[4] - g_RT[5] - g_RT[12] - g_RT[14] + g_RT[52];
-    Kc[305] = g_RT[6] - g_RT[7] - g_RT[12] - g_RT[14] + g_RT[52];
-    Kc[306] = g_RT[12] - g_RT[12] - g_RT[13] - g_RT[14] + g_RT[52];
-    Kc[307] = -g_RT[1] + g_RT[2] - g_RT[10] - g_RT[15] + g_RT[51];
-    Kc[308] = g_RT[3] - g_RT[4] - g_RT[14] - g_RT[17] + g_RT[51];
-    Kc[309] = g_RT[3] - g_RT[4] - 2*g_RT[16] + g_RT[51];
-    Kc[310] = g_RT[1] - g_RT[12] - g_RT[16] + g_RT[51];
-    Kc[311] = -g_RT[0] + g_RT[1] - g_RT[28] + g_RT[51];
-    Kc[312] = g_RT[4] - g_RT[5] - g_RT[28] + g_RT[51];
-    Kc[313] = g_RT[4] - g_RT[16] - g_RT[18] + g_RT[51];
-    Kc[314] = g_RT[2] - g_RT[4] - g_RT[49] + g_RT[50];
-    Kc[315] = -g_RT[0] + g_RT[1] - g_RT[49] + g_RT[50];
-    Kc[316] = g_RT[4] - g_RT[5] - g_RT[49] + g_RT[50];
-    Kc[317] = -g_RT[6] + g_RT[7] + g_RT[49] - g_RT[50];
-    Kc[318] = g_RT[12] - g_RT[13] - g_RT[49] + g_RT[50];
-    Kc[319] = g_RT[2] - g_RT[17] - g_RT[25] + g_RT[49];
-    Kc[320] = g_RT[1] - g_RT[12] - g_RT[25] + g_RT[49];
-    Kc[321] = g_RT[4] - g_RT[18] - g_RT[25] + g_RT[49];
-    Kc[322] = -g_RT[3] + g_RT[6] + g_RT[49] - g_RT[50];
-    Kc[323] = -g_RT[4] + g_RT[6] - g_RT[17] - g_RT[25] + g_RT[49];
-    Kc[324] = g_RT[12] - 2*g_RT[25] + g_RT[49];
-
-#ifdef __INTEL_COMPILER
-     #pragma simd
-#endif
-    for (int i=0; i<325; ++i) {
-        Kc[i] = exp(Kc[i]);
-    };
-
     /*reference concentration: P_atm / (RT) in inverse mol/m^3 */
     double refC = 101325 / 8.31451 * invT;
     double refCinv = 1 / refC;
 
-    Kc[0] *= refCinv;
-    Kc[1] *= refCinv;
-    Kc[2] *= refCinv;
-    Kc[3] *= refCinv;
-    Kc[4] *= refCinv;
-    Kc[5] *= refCinv;
-    Kc[6] *= refCinv;
-    Kc[7] *= refCinv;
-    Kc[8] *= refCinv;
-    Kc[9] *= refCinv;
-    Kc[10] *= refCinv;
-    Kc[11] *= refCinv;
-    Kc[12] *= refCinv;
-    Kc[13] *= refCinv;
-    Kc[14] *= refCinv;
-    Kc[15] *= refCinv;
-    Kc[16] *= refCinv;
-    Kc[17] *= refCinv;
-    Kc[18] *= refCinv;
-    Kc[19] *= refC;
-    Kc[20] *= refCinv;
-    Kc[21] *= refCinv;
-    Kc[22] *= refCinv;
-    Kc[23] *= refCinv;
-    Kc[24] *= refCinv;
-    Kc[25] *= refCinv;
-    Kc[26] *= refCinv;
-    Kc[27] *= refC;
-    Kc[28] *= refCinv;
-    Kc[29] *= refCinv;
-    Kc[30] *= refCinv;
-    Kc[31] *= refCinv;
-    Kc[32] *= refCinv;
-    Kc[33] *= refCinv;
-    Kc[34] *= refC;
-    Kc[35] *= refCinv;
-    Kc[36] *= refC;
-    Kc[37] *= refCinv;
-    Kc[38] *= refC;
-    Kc[39] *= refC;
-    Kc[40] *= refC;
-    Kc[65] *= refC;
-    Kc[70] *= refCinv;
-    Kc[71] *= refCinv;
-    Kc[72] *= refCinv;
-    Kc[73] *= refCinv;
-    Kc[75] *= refCinv;
-    Kc[76] *= refCinv;
-    Kc[77] *= refCinv;
-    Kc[153] *= refC;
-    Kc[161] *= refC;
-    Kc[181] *= refC;
-    Kc[189] *= refC;
-    Kc[190] *= refC;
-    Kc[215] *= refC;
-    Kc[233] *= refC;
-    Kc[262] *= refC;
-    Kc[264] *= refC;
-    Kc[265] *= refC;
-    Kc[288] *= refC;
-    Kc[293] *= refC;
-    Kc[295] *= refC;
-    Kc[300] *= refC;
-    Kc[301] *= refC;
-    Kc[303] *= refC;
-    Kc[304] *= refC;
-    Kc[305] *= refC;
-    Kc[306] *= refC;
-    Kc[307] *= refC;
-    Kc[308] *= refC;
-    Kc[309] *= refC;
-    Kc[323] *= refC;
+    /*Kc as the ratio of the products of the species exp(g_RT)/refC, unless */
+    /*the product over a side of a reaction leaves the normal range */
+    double e_g[53], den[325];
+    for (int k=0; k<53; ++k) {
+        e_g[k] = exp(g_RT[k]) * refCinv;
+    }
+    Kc[0] = e_g[1]*e_g[10]; den[0] = e_g[12];
+    Kc[1] = e_g[1]*e_g[12]; den[1] = e_g[13];
+    Kc[2] = e_g[1]*e_g[16]; den[2] = e_g[17];
+    Kc[3] = e_g[1]*e_g[17]; den[3] = e_g[18];
+    Kc[4] = e_g[1]*e_g[17]; den[4] = e_g[19];
+    Kc[5] = e_g[1]*e_g[18]; den[5] = e_g[20];
+    Kc[6] = e_g[1]*e_g[19]; den[6] = e_g[20];
+    Kc[7] = e_g[1]*e_g[21]; den[7] = e_g[22];
+    Kc[8] = e_g[1]*e_g[22]; den[8] = e_g[23];
+    Kc[9] = e_g[1]*e_g[23]; den[9] = e_g[24];
+    Kc[10] = e_g[1]*e_g[24]; den[10] = e_g[25];
+    Kc[11] = e_g[1]*e_g[25]; den[11] = e_g[26];
+    Kc[12] = e_g[0]*e_g[14]; den[12] = e_g[17];
+    Kc[13] = e_g[4]*e_g[4]; den[13] = e_g[7];
+    Kc[14] = e_g[4]*e_g[12]; den[14] = e_g[20];
+    Kc[15] = e_g[9]*e_g[14]; den[15] = e_g[27];
+    Kc[16] = e_g[10]*e_g[14]; den[16] = e_g[28];
+    Kc[17] = e_g[5]*e_g[11]; den[17] = e_g[20];
+    Kc[18] = e_g[12]*e_g[12]; den[18] = e_g[26];
+    Kc[19] = e_g[24]; den[19] = e_g[0]*e_g[22];
+    Kc[20] = e_g[9]*e_g[47]; den[20] = e_g[42];
+    Kc[21] = e_g[0]*e_g[9]; den[21] = e_g[12];
+    Kc[22] = e_g[1]*e_g[28]; den[22] = e_g[51];
+    Kc[23] = e_g[12]*e_g[25]; den[23] = e_g[50];
+    Kc[24] = e_g[12]*e_g[24]; den[24] = e_g[49];
+    Kc[25] = e_g[1]*e_g[49]; den[25] = e_g[50];
+    Kc[26] = e_g[2]*e_g[14]; den[26] = e_g[15];
+    Kc[27] = e_g[37]; den[27] = e_g[2]*e_g[47];
+    Kc[28] = e_g[1]*e_g[40]; den[28] = e_g[41];
+    Kc[29] = e_g[2]*e_g[2]; den[29] = e_g[3];
+    Kc[30] = e_g[1]*e_g[2]; den[30] = e_g[4];
+    Kc[31] = e_g[1]*e_g[3]; den[31] = e_g[6];
+    Kc[32] = e_g[1]*e_g[1]; den[32] = e_g[0];
+    Kc[33] = e_g[1]*e_g[4]; den[33] = e_g[5];
+    Kc[34] = e_g[16]; den[34] = e_g[1]*e_g[14];
+    Kc[35] = e_g[2]*e_g[35]; den[35] = e_g[36];
+    Kc[36] = e_g[34]; den[36] = e_g[1]*e_g[47];
+    Kc[37] = e_g[1]*e_g[35]; den[37] = e_g[38];
+    Kc[38] = e_g[46]; den[38] = e_g[14]*e_g[30];
+    Kc[39] = e_g[40]; den[39] = e_g[1]*e_g[39];
+    Kc[40] = e_g[45]; den[40] = e_g[14]*e_g[31];
+    Kc[41] = e_g[0]*e_g[2]; den[41] = e_g[1]*e_g[4];
+    Kc[42] = e_g[2]*e_g[6]; den[42] = e_g[3]*e_g[4];
+    Kc[43] = e_g[2]*e_g[7]; den[43] = e_g[4]*e_g[6];
+    Kc[44] = e_g[2]*e_g[9]; den[44] = e_g[1]*e_g[14];
+    Kc[45] = e_g[2]*e_g[10]; den[45] = e_g[1]*e_g[16];
+    Kc[46] = e_g[2]*e_g[11]; den[46] = e_g[0]*e_g[14];
+    Kc[47] = e_g[2]*e_g[11]; den[47] = e_g[1]*e_g[16];
+    Kc[48] = e_g[2]*e_g[12]; den[48] = e_g[1]*e_g[17];
+    Kc[49] = e_g[2]*e_g[13]; den[49] = e_g[4]*e_g[12];
+    Kc[50] = e_g[2]*e_g[16]; den[50] = e_g[4]*e_g[14];
+    Kc[51] = e_g[2]*e_g[16]; den[51] = e_g[1]*e_g[15];
+    Kc[52] = e_g[2]*e_g[17]; den[52] = e_g[4]*e_g[16];
+    Kc[53] = e_g[2]*e_g[18]; den[53] = e_g[4]*e_g[17];
+    Kc[54] = e_g[2]*e_g[19]; den[54] = e_g[4]*e_g[17];
+    Kc[55] = e_g[2]*e_g[20]; den[55] = e_g[4]*e_g[18];
+    Kc[56] = e_g[2]*e_g[20]; den[56] = e_g[4]*e_g[19];
+    Kc[57] = e_g[2]*e_g[21]; den[57] = e_g[9]*e_g[14];
+    Kc[58] = e_g[2]*e_g[22]; den[58] = e_g[1]*e_g[27];
+    Kc[59] = e_g[2]*e_g[22]; den[59] = e_g[4]*e_g[21];
+    Kc[60] = e_g[2]*e_g[22]; den[60] = e_g[10]*e_g[14];
+    Kc[61] = e_g[2]*e_g[23]; den[61] = e_g[1]*e_g[28];
+    Kc[62] = e_g[2]*e_g[24]; den[62] = e_g[12]*e_g[16];
+    Kc[63] = e_g[2]*e_g[25]; den[63] = e_g[12]*e_g[17];
+    Kc[64] = e_g[2]*e_g[26]; den[64] = e_g[4]*e_g[25];
+    Kc[65] = e_g[2]*e_g[27]; den[65] = e_g[1]*e_g[14]*e_g[14];
+    Kc[66] = e_g[2]*e_g[28]; den[66] = e_g[4]*e_g[27];
+    Kc[67] = e_g[2]*e_g[28]; den[67] = e_g[10]*e_g[15];
+    Kc[68] = e_g[3]*e_g[14]; den[68] = e_g[2]*e_g[15];
+    Kc[69] = e_g[3]*e_g[17]; den[69] = e_g[6]*e_g[16];
+    Kc[70] = e_g[1]*e_g[3]*e_g[3]; den[70] = e_g[3]*e_g[6];
+    Kc[71] = e_g[1]*e_g[3]*e_g[5]; den[71] = e_g[5]*e_g[6];
+    Kc[72] = e_g[1]*e_g[3]*e_g[47]; den[72] = e_g[6]*e_g[47];
+    Kc[73] = e_g[1]*e_g[3]*e_g[48]; den[73] = e_g[6]*e_g[48];
+    Kc[74] = e_g[1]*e_g[3]; den[74] = e_g[2]*e_g[4];
+    Kc[75] = e_g[0]*e_g[1]*e_g[1]; den[75] = e_g[0]*e_g[0];
+    Kc[76] = e_g[1]*e_g[1]*e_g[5]; den[76] = e_g[0]*e_g[5];
+    Kc[77] = e_g[1]*e_g[1]*e_g[15]; den[77] = e_g[0]*e_g[15];
+    Kc[78] = e_g[1]*e_g[6]; den[78] = e_g[2]*e_g[5];
+    Kc[79] = e_g[1]*e_g[6]; den[79] = e_g[0]*e_g[3];
+    Kc[80] = e_g[1]*e_g[6]; den[80] = e_g[4]*e_g[4];
+    Kc[81] = e_g[1]*e_g[7]; den[81] = e_g[0]*e_g[6];
+    Kc[82] = e_g[1]*e_g[7]; den[82] = e_g[4]*e_g[5];
+    Kc[83] = e_g[1]*e_g[9]; den[83] = e_g[0]*e_g[8];
+    Kc[84] = e_g[1]*e_g[11]; den[84] = e_g[0]*e_g[9];
+    Kc[85] = e_g[1]*e_g[13]; den[85] = e_g[0]*e_g[12];
+    Kc[86] = e_g[1]*e_g[16]; den[86] = e_g[0]*e_g[14];
+    Kc[87] = e_g[1]*e_g[17]; den[87] = e_g[0]*e_g[16];
+    Kc[88] = e_g[1]*e_g[18]; den[88] = e_g[0]*e_g[17];
+    Kc[89] = e_g[1]*e_g[18]; den[89] = e_g[4]*e_g[12];
+    Kc[90] = e_g[1]*e_g[18]; den[90] = e_g[5]*e_g[11];
+    Kc[91] = e_g[1]*e_g[19]; den[91] = e_g[1]*e_g[18];
+    Kc[92] = e_g[1]*e_g[19]; den[92] = e_g[0]*e_g[17];
+    Kc[93] = e_g[1]*e_g[19]; den[93] = e_g[4]*e_g[12];
+    Kc[94] = e_g[1]*e_g[19]; den[94] = e_g[5]*e_g[11];
+    Kc[95] = e_g[1]*e_g[20]; den[95] = e_g[0]*e_g[18];
+    Kc[96] = e_g[1]*e_g[20]; den[96] = e_g[0]*e_g[19];
+    Kc[97] = e_g[1]*e_g[23]; den[97] = e_g[0]*e_g[22];
+    Kc[98] = e_g[1]*e_g[24]; den[98] = e_g[0]*e_g[23];
+    Kc[99] = e_g[1]*e_g[25]; den[99] = e_g[0]*e_g[24];
+    Kc[100] = e_g[1]*e_g[26]; den[100] = e_g[0]*e_g[25];
+    Kc[101] = e_g[1]*e_g[27]; den[101] = e_g[11]*e_g[14];
+    Kc[102] = e_g[1]*e_g[28]; den[102] = e_g[0]*e_g[27];
+    Kc[103] = e_g[1]*e_g[28]; den[103] = e_g[12]*e_g[14];
+    Kc[104] = e_g[1]*e_g[29]; den[104] = e_g[1]*e_g[28];
+    Kc[105] = e_g[0]*e_g[4]; den[105] = e_g[1]*e_g[5];
+    Kc[106] = e_g[4]*e_g[4]; den[106] = e_g[2]*e_g[5];
+    Kc[107] = e_g[4]*e_g[6]; den[107] = e_g[3]*e_g[5];
+    Kc[108] = e_g[4]*e_g[7]; den[108] = e_g[5]*e_g[6];
+    Kc[109] = e_g[4]*e_g[7]; den[109] = e_g[5]*e_g[6];
+    Kc[110] = e_g[4]*e_g[8]; den[110] = e_g[1]*e_g[14];
+    Kc[111] = e_g[4]*e_g[9]; den[111] = e_g[1]*e_g[16];
+    Kc[112] = e_g[4]*e_g[10]; den[112] = e_g[1]*e_g[17];
+    Kc[113] = e_g[4]*e_g[10]; den[113] = e_g[5]*e_g[9];
+    Kc[114] = e_g[4]*e_g[11]; den[114] = e_g[1]*e_g[17];
+    Kc[115] = e_g[4]*e_g[12]; den[115] = e_g[5]*e_g[10];
+    Kc[116] = e_g[4]*e_g[12]; den[116] = e_g[5]*e_g[11];
+    Kc[117] = e_g[4]*e_g[13]; den[117] = e_g[5]*e_g[12];
+    Kc[118] = e_g[4]*e_g[14]; den[118] = e_g[1]*e_g[15];
+    Kc[119] = e_g[4]*e_g[16]; den[119] = e_g[5]*e_g[14];
+    Kc[120] = e_g[4]*e_g[17]; den[120] = e_g[5]*e_g[16];
+    Kc[121] = e_g[4]*e_g[18]; den[121] = e_g[5]*e_g[17];
+    Kc[122] = e_g[4]*e_g[19]; den[122] = e_g[5]*e_g[17];
+    Kc[123] = e_g[4]*e_g[20]; den[123] = e_g[5]*e_g[18];
+    Kc[124] = e_g[4]*e_g[20]; den[124] = e_g[5]*e_g[19];
+    Kc[125] = e_g[4]*e_g[21]; den[125] = e_g[1]*e_g[27];
+    Kc[126] = e_g[4]*e_g[22]; den[126] = e_g[1]*e_g[28];
+    Kc[127] = e_g[4]*e_g[22]; den[127] = e_g[1]*e_g[29];
+    Kc[128] = e_g[4]*e_g[22]; den[128] = e_g[5]*e_g[21];
+    Kc[129] = e_g[4]*e_g[22]; den[129] = e_g[12]*e_g[14];
+    Kc[130] = e_g[4]*e_g[23]; den[130] = e_g[5]*e_g[22];
+    Kc[131] = e_g[4]*e_g[24]; den[131] = e_g[5]*e_g[23];
+    Kc[132] = e_g[4]*e_g[26]; den[132] = e_g[5]*e_g[25];
+    Kc[133] = e_g[4]*e_g[28]; den[133] = e_g[5]*e_g[27];
+    Kc[134] = e_g[6]*e_g[6]; den[134] = e_g[3]*e_g[7];
+    Kc[135] = e_g[6]*e_g[6]; den[135] = e_g[3]*e_g[7];
+    Kc[136] = e_g[6]*e_g[10]; den[136] = e_g[4]*e_g[17];
+    Kc[137] = e_g[6]*e_g[12]; den[137] = e_g[3]*e_g[13];
+    Kc[138] = e_g[6]*e_g[12]; den[138] = e_g[4]*e_g[19];
+    Kc[139] = e_g[6]*e_g[14]; den[139] = e_g[4]*e_g[15];
+    Kc[140] = e_g[6]*e_g[17]; den[140] = e_g[7]*e_g[16];
+    Kc[141] = e_g[3]*e_g[8]; den[141] = e_g[2]*e_g[14];
+    Kc[142] = e_g[8]*e_g[10]; den[142] = e_g[1]*e_g[21];
+    Kc[143] = e_g[8]*e_g[12]; den[143] = e_g[1]*e_g[22];
+    Kc[144] = e_g[3]*e_g[9]; den[144] = e_g[2]*e_g[16];
+    Kc[145] = e_g[0]*e_g[9]; den[145] = e_g[1]*e_g[10];
+    Kc[146] = e_g[5]*e_g[9]; den[146] = e_g[1]*e_g[17];
+    Kc[147] = e_g[9]*e_g[10]; den[147] = e_g[1]*e_g[22];
+    Kc[148] = e_g[9]*e_g[12]; den[148] = e_g[1]*e_g[23];
+    Kc[149] = e_g[9]*e_g[13]; den[149] = e_g[1]*e_g[24];
+    Kc[150] = e_g[9]*e_g[15]; den[150] = e_g[14]*e_g[16];
+    Kc[151] = e_g[9]*e_g[17]; den[151] = e_g[1]*e_g[28];
+    Kc[152] = e_g[9]*e_g[27]; den[152] = e_g[14]*e_g[22];
+    Kc[153] = e_g[3]*e_g[10]; den[153] = e_g[1]*e_g[4]*e_g[14];
+    Kc[154] = e_g[0]*e_g[10]; den[154] = e_g[1]*e_g[12];
+    Kc[155] = e_g[10]*e_g[10]; den[155] = e_g[0]*e_g[22];
+    Kc[156] = e_g[10]*e_g[12]; den[156] = e_g[1]*e_g[24];
+    Kc[157] = e_g[10]*e_g[13]; den[157] = e_g[12]*e_g[12];
+    Kc[158] = e_g[10]*e_g[27]; den[158] = e_g[14]*e_g[23];
+    Kc[159] = e_g[11]*e_g[47]; den[159] = e_g[10]*e_g[47];
+    Kc[160] = e_g[11]*e_g[48]; den[160] = e_g[10]*e_g[48];
+    Kc[161] = e_g[3]*e_g[11]; den[161] = e_g[1]*e_g[4]*e_g[14];
+    Kc[162] = e_g[3]*e_g[11]; den[162] = e_g[5]*e_g[14];
+    Kc[163] = e_g[0]*e_g[11]; den[163] = e_g[1]*e_g[12];
+    Kc[164] = e_g[5]*e_g[11]; den[164] = e_g[5]*e_g[10];
+    Kc[165] = e_g[11]*e_g[12]; den[165] = e_g[1]*e_g[24];
+    Kc[166] = e_g[11]*e_g[13]; den[166] = e_g[12]*e_g[12];
+    Kc[167] = e_g[11]*e_g[14]; den[167] = e_g[10]*e_g[14];
+    Kc[168] = e_g[11]*e_g[15]; den[168] = e_g[10]*e_g[15];
+    Kc[169] = e_g[11]*e_g[15]; den[169] = e_g[14]*e_g[17];
+    Kc[170] = e_g[11]*e_g[26]; den[170] = e_g[12]*e_g[25];
+    Kc[171] = e_g[3]*e_g[12]; den[171] = e_g[2]*e_g[19];
+    Kc[172] = e_g[3]*e_g[12]; den[172] = e_g[4]*e_g[17];
+    Kc[173] = e_g[7]*e_g[12]; den[173] = e_g[6]*e_g[13];
+    Kc[174] = e_g[12]*e_g[12]; den[174] = e_g[1]*e_g[25];
+    Kc[175] = e_g[12]*e_g[16]; den[175] = e_g[13]*e_g[14];
+    Kc[176] = e_g[12]*e_g[17]; den[176] = e_g[13]*e_g[16];
+    Kc[177] = e_g[12]*e_g[20]; den[177] = e_g[13]*e_g[18];
+    Kc[178] = e_g[12]*e_g[20]; den[178] = e_g[13]*e_g[19];
+    Kc[179] = e_g[12]*e_g[24]; den[179] = e_g[13]*e_g[23];
+    Kc[180] = e_g[12]*e_g[26]; den[180] = e_g[13]*e_g[25];
+    Kc[181] = e_g[5]*e_g[16]; den[181] = e_g[1]*e_g[5]*e_g[14];
+    Kc[182] = e_g[3]*e_g[16]; den[182] = e_g[6]*e_g[14];
+    Kc[183] = e_g[3]*e_g[18]; den[183] = e_g[6]*e_g[17];
+    Kc[184] = e_g[3]*e_g[19]; den[184] = e_g[6]*e_g[17];
+    Kc[185] = e_g[3]*e_g[21]; den[185] = e_g[14]*e_g[16];
+    Kc[186] = e_g[0]*e_g[21]; den[186] = e_g[1]*e_g[22];
+    Kc[187] = e_g[3]*e_g[23]; den[187] = e_g[16]*e_g[17];
+    Kc[188] = e_g[3]*e_g[25]; den[188] = e_g[6]*e_g[24];
+    Kc[189] = e_g[3]*e_g[27]; den[189] = e_g[4]*e_g[14]*e_g[14];
+    Kc[190] = e_g[27]*e_g[27]; den[190] = e_g[14]*e_g[14]*e_g[22];
+    Kc[191] = e_g[30]*e_g[35]; den[191] = e_g[2]*e_g[47];
+    Kc[192] = e_g[3]*e_g[30]; den[192] = e_g[2]*e_g[35];
+    Kc[193] = e_g[4]*e_g[30]; den[193] = e_g[1]*e_g[35];
+    Kc[194] = e_g[2]*e_g[37]; den[194] = e_g[3]*e_g[47];
+    Kc[195] = e_g[2]*e_g[37]; den[195] = e_g[35]*e_g[35];
+    Kc[196] = e_g[1]*e_g[37]; den[196] = e_g[4]*e_g[47];
+    Kc[197] = e_g[4]*e_g[37]; den[197] = e_g[6]*e_g[47];
+    Kc[198] = e_g[6]*e_g[35]; den[198] = e_g[4]*e_g[36];
+    Kc[199] = e_g[2]*e_g[36]; den[199] = e_g[3]*e_g[35];
+    Kc[200] = e_g[1]*e_g[36]; den[200] = e_g[4]*e_g[35];
+    Kc[201] = e_g[2]*e_g[31]; den[201] = e_g[1]*e_g[35];
+    Kc[202] = e_g[1]*e_g[31]; den[202] = e_g[0]*e_g[30];
+    Kc[203] = e_g[4]*e_g[31]; den[203] = e_g[1]*e_g[38];
+    Kc[204] = e_g[4]*e_g[31]; den[204] = e_g[5]*e_g[30];
+    Kc[205] = e_g[3]*e_g[31]; den[205] = e_g[2]*e_g[38];
+    Kc[206] = e_g[3]*e_g[31]; den[206] = e_g[4]*e_g[35];
+    Kc[207] = e_g[30]*e_g[31]; den[207] = e_g[1]*e_g[47];
+    Kc[208] = e_g[5]*e_g[31]; den[208] = e_g[0]*e_g[38];
+    Kc[209] = e_g[31]*e_g[35]; den[209] = e_g[4]*e_g[47];
+    Kc[210] = e_g[31]*e_g[35]; den[210] = e_g[1]*e_g[37];
+    Kc[211] = e_g[2]*e_g[32]; den[211] = e_g[4]*e_g[31];
+    Kc[212] = e_g[2]*e_g[32]; den[212] = e_g[1]*e_g[38];
+    Kc[213] = e_g[1]*e_g[32]; den[213] = e_g[0]*e_g[31];
+    Kc[214] = e_g[4]*e_g[32]; den[214] = e_g[5]*e_g[31];
+    Kc[215] = e_g[34]; den[215] = e_g[1]*e_g[47];
+    Kc[216] = e_g[3]*e_g[34]; den[216] = e_g[6]*e_g[47];
+    Kc[217] = e_g[2]*e_g[34]; den[217] = e_g[4]*e_g[47];
+    Kc[218] = e_g[2]*e_g[34]; den[218] = e_g[31]*e_g[35];
+    Kc[219] = e_g[1]*e_g[34]; den[219] = e_g[0]*e_g[47];
+    Kc[220] = e_g[4]*e_g[34]; den[220] = e_g[5]*e_g[47];
+    Kc[221] = e_g[12]*e_g[34]; den[221] = e_g[13]*e_g[47];
+    Kc[222] = e_g[2]*e_g[38]; den[222] = e_g[4]*e_g[35];
+    Kc[223] = e_g[1]*e_g[38]; den[223] = e_g[0]*e_g[35];
+    Kc[224] = e_g[4]*e_g[38]; den[224] = e_g[5]*e_g[35];
+    Kc[225] = e_g[3]*e_g[38]; den[225] = e_g[6]*e_g[35];
+    Kc[226] = e_g[2]*e_g[39]; den[226] = e_g[14]*e_g[30];
+    Kc[227] = e_g[4]*e_g[39]; den[227] = e_g[1]*e_g[46];
+    Kc[228] = e_g[5]*e_g[39]; den[228] = e_g[4]*e_g[40];
+    Kc[229] = e_g[3]*e_g[39]; den[229] = e_g[2]*e_g[46];
+    Kc[230] = e_g[0]*e_g[39]; den[230] = e_g[1]*e_g[40];
+    Kc[231] = e_g[2]*e_g[46]; den[231] = e_g[14]*e_g[35];
+    Kc[232] = e_g[1]*e_g[46]; den[232] = e_g[14]*e_g[31];
+    Kc[233] = e_g[4]*e_g[46]; den[233] = e_g[1]*e_g[14]*e_g[35];
+    Kc[234] = e_g[30]*e_g[46]; den[234] = e_g[14]*e_g[47];
+    Kc[235] = e_g[3]*e_g[46]; den[235] = e_g[15]*e_g[35];
+    Kc[236] = e_g[35]*e_g[46]; den[236] = e_g[14]*e_g[37];
+    Kc[237] = e_g[35]*e_g[46]; den[237] = e_g[15]*e_g[47];
+    Kc[238] = e_g[2]*e_g[40]; den[238] = e_g[1]*e_g[46];
+    Kc[239] = e_g[2]*e_g[40]; den[239] = e_g[14]*e_g[31];
+    Kc[240] = e_g[2]*e_g[40]; den[240] = e_g[4]*e_g[39];
+    Kc[241] = e_g[4]*e_g[40]; den[241] = e_g[1]*e_g[44];
+    Kc[242] = e_g[4]*e_g[40]; den[242] = e_g[1]*e_g[45];
+    Kc[243] = e_g[4]*e_g[40]; den[243] = e_g[14]*e_g[32];
+    Kc[244] = e_g[30]*e_g[41]; den[244] = e_g[10]*e_g[47];
+    Kc[245] = e_g[8]*e_g[47]; den[245] = e_g[30]*e_g[39];
+    Kc[246] = e_g[9]*e_g[47]; den[246] = e_g[30]*e_g[40];
+    Kc[247] = e_g[10]*e_g[47]; den[247] = e_g[31]*e_g[40];
+    Kc[248] = e_g[11]*e_g[47]; den[248] = e_g[31]*e_g[40];
+    Kc[249] = e_g[8]*e_g[35]; den[249] = e_g[2]*e_g[39];
+    Kc[250] = e_g[8]*e_g[35]; den[250] = e_g[14]*e_g[30];
+    Kc[251] = e_g[9]*e_g[35]; den[251] = e_g[2]*e_g[40];
+    Kc[252] = e_g[9]*e_g[35]; den[252] = e_g[1]*e_g[46];
+    Kc[253] = e_g[9]*e_g[35]; den[253] = e_g[16]*e_g[30];
+    Kc[254] = e_g[10]*e_g[35]; den[254] = e_g[1]*e_g[45];
+    Kc[255] = e_g[10]*e_g[35]; den[255] = e_g[4]*e_g[40];
+    Kc[256] = e_g[10]*e_g[35]; den[256] = e_g[1]*e_g[43];
+    Kc[257] = e_g[11]*e_g[35]; den[257] = e_g[1]*e_g[45];
+    Kc[258] = e_g[11]*e_g[35]; den[258] = e_g[4]*e_g[40];
+    Kc[259] = e_g[11]*e_g[35]; den[259] = e_g[1]*e_g[43];
+    Kc[260] = e_g[12]*e_g[35]; den[260] = e_g[5]*e_g[40];
+    Kc[261] = e_g[12]*e_g[35]; den[261] = e_g[4]*e_g[41];
+    Kc[262] = e_g[2]*e_g[42]; den[262] = e_g[1]*e_g[14]*e_g[47];
+    Kc[263] = e_g[2]*e_g[42]; den[263] = e_g[35]*e_g[40];
+    Kc[264] = e_g[3]*e_g[42]; den[264] = e_g[2]*e_g[16]*e_g[47];
+    Kc[265] = e_g[4]*e_g[42]; den[265] = e_g[1]*e_g[16]*e_g[47];
+    Kc[266] = e_g[1]*e_g[42]; den[266] = e_g[10]*e_g[47];
+    Kc[267] = e_g[2]*e_g[45]; den[267] = e_g[15]*e_g[31];
+    Kc[268] = e_g[2]*e_g[45]; den[268] = e_g[14]*e_g[38];
+    Kc[269] = e_g[2]*e_g[45]; den[269] = e_g[4]*e_g[46];
+    Kc[270] = e_g[1]*e_g[45]; den[270] = e_g[14]*e_g[32];
+    Kc[271] = e_g[1]*e_g[45]; den[271] = e_g[0]*e_g[46];
+    Kc[272] = e_g[4]*e_g[45]; den[272] = e_g[5]*e_g[46];
+    Kc[273] = e_g[4]*e_g[45]; den[273] = e_g[15]*e_g[32];
+    Kc[274] = e_g[1]*e_g[43]; den[274] = e_g[1]*e_g[45];
+    Kc[275] = e_g[1]*e_g[43]; den[275] = e_g[4]*e_g[40];
+    Kc[276] = e_g[1]*e_g[43]; den[276] = e_g[14]*e_g[32];
+    Kc[277] = e_g[1]*e_g[44]; den[277] = e_g[1]*e_g[45];
+    Kc[278] = e_g[27]*e_g[35]; den[278] = e_g[14]*e_g[43];
+    Kc[279] = e_g[12]*e_g[30]; den[279] = e_g[1]*e_g[41];
+    Kc[280] = e_g[12]*e_g[30]; den[280] = e_g[0]*e_g[40];
+    Kc[281] = e_g[1]*e_g[33]; den[281] = e_g[0]*e_g[32];
+    Kc[282] = e_g[4]*e_g[33]; den[282] = e_g[5]*e_g[32];
+    Kc[283] = e_g[2]*e_g[33]; den[283] = e_g[4]*e_g[32];
+    Kc[284] = e_g[15]*e_g[31]; den[284] = e_g[14]*e_g[38];
+    Kc[285] = e_g[36]*e_g[39]; den[285] = e_g[35]*e_g[46];
+    Kc[286] = e_g[36]*e_g[46]; den[286] = e_g[15]*e_g[37];
+    Kc[287] = e_g[15]*e_g[30]; den[287] = e_g[14]*e_g[35];
+    Kc[288] = e_g[2]*e_g[12]; den[288] = e_g[0]*e_g[1]*e_g[14];
+    Kc[289] = e_g[2]*e_g[24]; den[289] = e_g[1]*e_g[51];
+    Kc[290] = e_g[2]*e_g[25]; den[290] = e_g[1]*e_g[52];
+    Kc[291] = e_g[4]*e_g[6]; den[291] = e_g[3]*e_g[5];
+    Kc[292] = e_g[4]*e_g[12]; den[292] = e_g[0]*e_g[17];
+    Kc[293] = e_g[3]*e_g[10]; den[293] = e_g[1]*e_g[1]*e_g[15];
+    Kc[294] = e_g[3]*e_g[10]; den[294] = e_g[2]*e_g[17];
+    Kc[295] = e_g[10]*e_g[10]; den[295] = e_g[1]*e_g[1]*e_g[22];
+    Kc[296] = e_g[5]*e_g[11]; den[296] = e_g[0]*e_g[17];
+    Kc[297] = e_g[3]*e_g[23]; den[297] = e_g[2]*e_g[51];
+    Kc[298] = e_g[3]*e_g[23]; den[298] = e_g[6]*e_g[22];
+    Kc[299] = e_g[2]*e_g[52]; den[299] = e_g[4]*e_g[51];
+    Kc[300] = e_g[2]*e_g[52]; den[300] = e_g[4]*e_g[12]*e_g[14];
+    Kc[301] = e_g[3]*e_g[52]; den[301] = e_g[6]*e_g[12]*e_g[14];
+    Kc[302] = e_g[1]*e_g[52]; den[302] = e_g[0]*e_g[51];
+    Kc[303] = e_g[1]*e_g[52]; den[303] = e_g[0]*e_g[12]*e_g[14];
+    Kc[304] = e_g[4]*e_g[52]; den[304] = e_g[5]*e_g[12]*e_g[14];
+    Kc[305] = e_g[6]*e_g[52]; den[305] = e_g[7]*e_g[12]*e_g[14];
+    Kc[306] = e_g[12]*e_g[52]; den[306] = e_g[12]*e_g[13]*e_g[14];
+    Kc[307] = e_g[2]*e_g[51]; den[307] = e_g[1]*e_g[10]*e_g[15];
+    Kc[308] = e_g[3]*e_g[51]; den[308] = e_g[4]*e_g[14]*e_g[17];
+    Kc[309] = e_g[3]*e_g[51]; den[309] = e_g[4]*e_g[16]*e_g[16];
+    Kc[310] = e_g[1]*e_g[51]; den[310] = e_g[12]*e_g[16];
+    Kc[311] = e_g[1]*e_g[51]; den[311] = e_g[0]*e_g[28];
+    Kc[312] = e_g[4]*e_g[51]; den[312] = e_g[5]*e_g[28];
+    Kc[313] = e_g[4]*e_g[51]; den[313] = e_g[16]*e_g[18];
+    Kc[314] = e_g[2]*e_g[50]; den[314] = e_g[4]*e_g[49];
+    Kc[315] = e_g[1]*e_g[50]; den[315] = e_g[0]*e_g[49];
+    Kc[316] = e_g[4]*e_g[50]; den[316] = e_g[5]*e_g[49];
+    Kc[317] = e_g[7]*e_g[49]; den[317] = e_g[6]*e_g[50];
+    Kc[318] = e_g[12]*e_g[50]; den[318] = e_g[13]*e_g[49];
+    Kc[319] = e_g[2]*e_g[49]; den[319] = e_g[17]*e_g[25];
+    Kc[320] = e_g[1]*e_g[49]; den[320] = e_g[12]*e_g[25];
+    Kc[321] = e_g[4]*e_g[49]; den[321] = e_g[18]*e_g[25];
+    Kc[322] = e_g[6]*e_g[49]; den[322] = e_g[3]*e_g[50];
+    Kc[323] = e_g[6]*e_g[49]; den[323] = e_g[4]*e_g[17]*e_g[25];
+    Kc[324] = e_g[12]*e_g[49]; den[324] = e_g[25]*e_g[25];
+    int inrange = 1;
+    for (int i=0; i<325; ++i) {
+        inrange &= Kc[i] >= DBL_MIN && Kc[i] <= DBL_MAX && den[i] >= DBL_MIN && den[i] <= DBL_MAX;
+    }
+
+    if (inrange) {
+        for (int i=0; i<325; ++i) {
+            Kc[i] /= den[i];
+        }
+    }
+    else {
+        Kc[0] = exp(g_RT[1] + g_RT[10] - g_RT[12]);
+        Kc[1] = exp(g_RT[1] + g_RT[12] - g_RT[13]);
+        Kc[2] = exp(g_RT[1] + g_RT[16] - g_RT[17]);
+        Kc[3] = exp(g_RT[1] + g_RT[17] - g_RT[18]);
+        Kc[4] = exp(g_RT[1] + g_RT[17] - g_RT[19]);
+        Kc[5] = exp(g_RT[1] + g_RT[18] - g_RT[20]);
+        Kc[6] = exp(g_RT[1] + g_RT[19] - g_RT[20]);
+        Kc[7] = exp(g_RT[1] + g_RT[21] - g_RT[22]);
+        Kc[8] = exp(g_RT[1] + g_RT[22] - g_RT[23]);
+        Kc[9] = exp(g_RT[1] + g_RT[23] - g_RT[24]);
+        Kc[10] = exp(g_RT[1] + g_RT[24] - g_RT[25]);
+        Kc[11] = exp(g_RT[1] + g_RT[25] - g_RT[26]);
+        Kc[12] = exp(g_RT[0] + g_RT[14] - g_RT[17]);
+        Kc[13] = exp(2*g_RT[4] - g_RT[7]);
+        Kc[14] = exp(g_RT[4] + g_RT[12] - g_RT[20]);
+        Kc[15] = exp(g_RT[9] + g_RT[14] - g_RT[27]);
+        Kc[16] = exp(g_RT[10] + g_RT[14] - g_RT[28]);
+        Kc[17] = exp(g_RT[5] + g_RT[11] - g_RT[20]);
+        Kc[18] = exp(2*g_RT[12] - g_RT[26]);
+        Kc[19] = exp(-g_RT[0] - g_RT[22] + g_RT[24]);
+        Kc[20] = exp(g_RT[9] - g_RT[42] + g_RT[47]);
+        Kc[21] = exp(g_RT[0] + g_RT[9] - g_RT[12]);
+        Kc[22] = exp(g_RT[1] + g_RT[28] - g_RT[51]);
+        Kc[23] = exp(g_RT[12] + g_RT[25] - g_RT[50]);
+        Kc[24] = exp(g_RT[12] + g_RT[24] - g_RT[49]);
+        Kc[25] = exp(g_RT[1] + g_RT[49] - g_RT[50]);
+        Kc[26] = exp(g_RT[2] + g_RT[14] - g_RT[15]);
+        Kc[27] = exp(-g_RT[2] + g_RT[37] - g_RT[47]);
+        Kc[28] = exp(g_RT[1] + g_RT[40] - g_RT[41]);
+        Kc[29] = exp(2*g_RT[2] - g_RT[3]);
+        Kc[30] = exp(g_RT[1] + g_RT[2] - g_RT[4]);
+        Kc[31] = exp(g_RT[1] + g_RT[3] - g_RT[6]);
+        Kc[32] = exp(-g_RT[0] + 2*g_RT[1]);
+        Kc[33] = exp(g_RT[1] + g_RT[4] - g_RT[5]);
+        Kc[34] = exp(-g_RT[1] - g_RT[14] + g_RT[16]);
+        Kc[35] = exp(g_RT[2] + g_RT[35] - g_RT[36]);
+        Kc[36] = exp(-g_RT[1] + g_RT[34] - g_RT[47]);
+        Kc[37] = exp(g_RT[1] + g_RT[35] - g_RT[38]);
+        Kc[38] = exp(-g_RT[14] - g_RT[30] + g_RT[46]);
+        Kc[39] = exp(-g_RT[1] - g_RT[39] + g_RT[40]);
+        Kc[40] = exp(-g_RT[14] - g_RT[31] + g_RT[45]);
+        Kc[41] = exp(g_RT[0] - g_RT[1] + g_RT[2] - g_RT[4]);
+        Kc[42] = exp(g_RT[2] - g_RT[3] - g_RT[4] + g_RT[6]);
+        Kc[43] = exp(g_RT[2] - g_RT[4] - g_RT[6] + g_RT[7]);
+        Kc[44] = exp(-g_RT[1] + g_RT[2] + g_RT[9] - g_RT[14]);
+        Kc[45] = exp(-g_RT[1] + g_RT[2] + g_RT[10] - g_RT[16]);
+        Kc[46] = exp(-g_RT[0] + g_RT[2] + g_RT[11] - g_RT[14]);
+        Kc[47] = exp(-g_RT[1] + g_RT[2] + g_RT[11] - g_RT[16]);
+        Kc[48] = exp(-g_RT[1] + g_RT[2] + g_RT[12] - g_RT[17]);
+        Kc[49] = exp(g_RT[2] - g_RT[4] - g_RT[12] + g_RT[13]);
+        Kc[50] = exp(g_RT[2] - g_RT[4] - g_RT[14] + g_RT[16]);
+        Kc[51] = exp(-g_RT[1] + g_RT[2] - g_RT[15] + g_RT[16]);
+        Kc[52] = exp(g_RT[2] - g_RT[4] - g_RT[16] + g_RT[17]);
+        Kc[53] = exp(g_RT[2] - g_RT[4] - g_RT[17] + g_RT[18]);
+        Kc[54] = exp(g_RT[2] - g_RT[4] - g_RT[17] + g_RT[19]);
+        Kc[55] = exp(g_RT[2] - g_RT[4] - g_RT[18] + g_RT[20]);
+        Kc[56] = exp(g_RT[2] - g_RT[4] - g_RT[19] + g_RT[20]);
+        Kc[57] = exp(g_RT[2] - g_RT[9] - g_RT[14] + g_RT[21]);
+        Kc[58] = exp(-g_RT[1] + g_RT[2] + g_RT[22] - g_RT[27]);
+        Kc[59] = exp(g_RT[2] - g_RT[4] - g_RT[21] + g_RT[22]);
+        Kc[60] = exp(g_RT[2] - g_RT[10] - g_RT[14] + g_RT[22]);
+        Kc[61] = exp(-g_RT[1] + g_RT[2] + g_RT[23] - g_RT[28]);
+        Kc[62] = exp(g_RT[2] - g_RT[12] - g_RT[16] + g_RT[24]);
+        Kc[63] = exp(g_RT[2] - g_RT[12] - g_RT[17] + g_RT[25]);
+        Kc[64] = exp(g_RT[2] - g_RT[4] - g_RT[25] + g_RT[26]);
+        Kc[65] = exp(-g_RT[1] + g_RT[2] - 2*g_RT[14] + g_RT[27]);
+        Kc[66] = exp(g_RT[2] - g_RT[4] - g_RT[27] + g_RT[28]);
+        Kc[67] = exp(g_RT[2] - g_RT[10] - g_RT[15] + g_RT[28]);
+        Kc[68] = exp(-g_RT[2] + g_RT[3] + g_RT[14] - g_RT[15]);
+        Kc[69] = exp(g_RT[3] - g_RT[6] - g_RT[16] + g_RT[17]);
+        Kc[70] = exp(g_RT[1] + 2*g_RT[3] - g_RT[3] - g_RT[6]);
+        Kc[71] = exp(g_RT[1] + g_RT[3] + g_RT[5] - g_RT[5] - g_RT[6]);
+        Kc[72] = exp(g_RT[1] + g_RT[3] - g_RT[6] + g_RT[47] - g_RT[47]);
+        Kc[73] = exp(g_RT[1] + g_RT[3] - g_RT[6] + g_RT[48] - g_RT[48]);
+        Kc[74] = exp(g_RT[1] - g_RT[2] + g_RT[3] - g_RT[4]);
+        Kc[75] = exp(g_RT[0] - 2*g_RT[0] + 2*g_RT[1]);
+        Kc[76] = exp(-g_RT[0] + 2*g_RT[1] + g_RT[5] - g_RT[5]);
+        Kc[77] = exp(-g_RT[0] + 2*g_RT[1] + g_RT[15] - g_RT[15]);
+        Kc[78] = exp(g_RT[1] - g_RT[2] - g_RT[5] + g_RT[6]);
+        Kc[79] = exp(-g_RT[0] + g_RT[1] - g_RT[3] + g_RT[6]);
+        Kc[80] = exp(g_RT[1] - 2*g_RT[4] + g_RT[6]);
+        Kc[81] = exp(-g_RT[0] + g_RT[1] - g_RT[6] + g_RT[7]);
+        Kc[82] = exp(g_RT[1] - g_RT[4] - g_RT[5] + g_RT[7]);
+        Kc[83] = exp(-g_RT[0] + g_RT[1] - g_RT[8] + g_RT[9]);
+        Kc[84] = exp(-g_RT[0] + g_RT[1] - g_RT[9] + g_RT[11]);
+        Kc[85] = exp(-g_RT[0] + g_RT[1] - g_RT[12] + g_RT[13]);
+        Kc[86] = exp(-g_RT[0] + g_RT[1] - g_RT[14] + g_RT[16]);
+        Kc[87] = exp(-g_RT[0] + g_RT[1] - g_RT[16] + g_RT[17]);
+        Kc[88] = exp(-g_RT[0] + g_RT[1] - g_RT[17] + g_RT[18]);
+        Kc[89] = exp(g_RT[1] - g_RT[4] - g_RT[12] + g_RT[18]);
+        Kc[90] = exp(g_RT[1] - g_RT[5] - g_RT[11] + g_RT[18]);
+        Kc[91] = exp(g_RT[1] - g_RT[1] - g_RT[18] + g_RT[19]);
+        Kc[92] = exp(-g_RT[0] + g_RT[1] - g_RT[17] + g_RT[19]);
+        Kc[93] = exp(g_RT[1] - g_RT[4] - g_RT[12] + g_RT[19]);
+        Kc[94] = exp(g_RT[1] - g_RT[5] - g_RT[11] + g_RT[19]);
+        Kc[95] = exp(-g_RT[0] + g_RT[1] - g_RT[18] + g_RT[20]);
+        Kc[96] = exp(-g_RT[0] + g_RT[1] - g_RT[19] + g_RT[20]);
+        Kc[97] = exp(-g_RT[0] + g_RT[1] - g_RT[22] + g_RT[23]);
+        Kc[98] = exp(-g_RT[0] + g_RT[1] - g_RT[23] + g_RT[24]);
+        Kc[99] = exp(-g_RT[0] + g_RT[1] - g_RT[24] + g_RT[25]);
+        Kc[100] = exp(-g_RT[0] + g_RT[1] - g_RT[25] + g_RT[26]);
+        Kc[101] = exp(g_RT[1] - g_RT[11] - g_RT[14] + g_RT[27]);
+        Kc[102] = exp(-g_RT[0] + g_RT[1] - g_RT[27] + g_RT[28]);
+        Kc[103] = exp(g_RT[1] - g_RT[12] - g_RT[14] + g_RT[28]);
+        Kc[104] = exp(g_RT[1] - g_RT[1] - g_RT[28] + g_RT[29]);
+        Kc[105] = exp(g_RT[0] - g_RT[1] + g_RT[4] - g_RT[5]);
+        Kc[106] = exp(-g_RT[2] + 2*g_RT[4] - g_RT[5]);
+        Kc[107] = exp(-g_RT[3] + g_RT[4] - g_RT[5] + g_RT[6]);
+        Kc[108] = exp(g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7]);
+        Kc[110] = exp(-g_RT[1] + g_RT[4] + g_RT[8] - g_RT[14]);
+        Kc[111] = exp(-g_RT[1] + g_RT[4] + g_RT[9] - g_RT[16]);
+        Kc[112] = exp(-g_RT[1] + g_RT[4] + g_RT[10] - g_RT[17]);
+        Kc[113] = exp(g_RT[4] - g_RT[5] - g_RT[9] + g_RT[10]);
+        Kc[114] = exp(-g_RT[1] + g_RT[4] + g_RT[11] - g_RT[17]);
+        Kc[115] = exp(g_RT[4] - g_RT[5] - g_RT[10] + g_RT[12]);
+        Kc[116] = exp(g_RT[4] - g_RT[5] - g_RT[11] + g_RT[12]);
+        Kc[117] = exp(g_RT[4] - g_RT[5] - g_RT[12] + g_RT[13]);
+        Kc[118] = exp(-g_RT[1] + g_RT[4] + g_RT[14] - g_RT[15]);
+        Kc[119] = exp(g_RT[4] - g_RT[5] - g_RT[14] + g_RT[16]);
+        Kc[120] = exp(g_RT[4] - g_RT[5] - g_RT[16] + g_RT[17]);
+        Kc[121] = exp(g_RT[4] - g_RT[5] - g_RT[17] + g_RT[18]);
+        Kc[122] = exp(g_RT[4] - g_RT[5] - g_RT[17] + g_RT[19]);
+        Kc[123] = exp(g_RT[4] - g_RT[5] - g_RT[18] + g_RT[20]);
+        Kc[124] = exp(g_RT[4] - g_RT[5] - g_RT[19] + g_RT[20]);
+        Kc[125] = exp(-g_RT[1] + g_RT[4] + g_RT[21] - g_RT[27]);
+        Kc[126] = exp(-g_RT[1] + g_RT[4] + g_RT[22] - g_RT[28]);
+        Kc[127] = exp(-g_RT[1] + g_RT[4] + g_RT[22] - g_RT[29]);
+        Kc[128] = exp(g_RT[4] - g_RT[5] - g_RT[21] + g_RT[22]);
+        Kc[129] = exp(g_RT[4] - g_RT[12] - g_RT[14] + g_RT[22]);
+        Kc[130] = exp(g_RT[4] - g_RT[5] - g_RT[22] + g_RT[23]);
+        Kc[131] = exp(g_RT[4] - g_RT[5] - g_RT[23] + g_RT[24]);
+        Kc[132] = exp(g_RT[4] - g_RT[5] - g_RT[25] + g_RT[26]);
+        Kc[133] = exp(g_RT[4] - g_RT[5] - g_RT[27] + g_RT[28]);
+        Kc[134] = exp(-g_RT[3] + 2*g_RT[6] - g_RT[7]);
+        Kc[136] = exp(-g_RT[4] + g_RT[6] + g_RT[10] - g_RT[17]);
+        Kc[137] = exp(-g_RT[3] + g_RT[6] + g_RT[12] - g_RT[13]);
+        Kc[138] = exp(-g_RT[4] + g_RT[6] + g_RT[12] - g_RT[19]);
+        Kc[139] = exp(-g_RT[4] + g_RT[6] + g_RT[14] - g_RT[15]);
+        Kc[140] = exp(g_RT[6] - g_RT[7] - g_RT[16] + g_RT[17]);
+        Kc[141] = exp(-g_RT[2] + g_RT[3] + g_RT[8] - g_RT[14]);
+        Kc[142] = exp(-g_RT[1] + g_RT[8] + g_RT[10] - g_RT[21]);
+        Kc[143] = exp(-g_RT[1] + g_RT[8] + g_RT[12] - g_RT[22]);
+        Kc[144] = exp(-g_RT[2] + g_RT[3] + g_RT[9] - g_RT[16]);
+        Kc[145] = exp(g_RT[0] - g_RT[1] + g_RT[9] - g_RT[10]);
+        Kc[146] = exp(-g_RT[1] + g_RT[5] + g_RT[9] - g_RT[17]);
+        Kc[147] = exp(-g_RT[1] + g_RT[9] + g_RT[10] - g_RT[22]);
+        Kc[148] = exp(-g_RT[1] + g_RT[9] + g_RT[12] - g_RT[23]);
+        Kc[149] = exp(-g_RT[1] + g_RT[9] + g_RT[13] - g_RT[24]);
+        Kc[150] = exp(g_RT[9] - g_RT[14] + g_RT[15] - g_RT[16]);
+        Kc[151] = exp(-g_RT[1] + g_RT[9] + g_RT[17] - g_RT[28]);
+        Kc[152] = exp(g_RT[9] - g_RT[14] - g_RT[22] + g_RT[27]);
+        Kc[153] = exp(-g_RT[1] + g_RT[3] - g_RT[4] + g_RT[10] - g_RT[14]);
+        Kc[154] = exp(g_RT[0] - g_RT[1] + g_RT[10] - g_RT[12]);
+        Kc[155] = exp(-g_RT[0] + 2*g_RT[10] - g_RT[22]);
+        Kc[156] = exp(-g_RT[1] + g_RT[10] + g_RT[12] - g_RT[24]);
+        Kc[157] = exp(g_RT[10] - 2*g_RT[12] + g_RT[13]);
+        Kc[158] = exp(g_RT[10] - g_RT[14] - g_RT[23] + g_RT[27]);
+        Kc[159] = exp(-g_RT[10] + g_RT[11] + g_RT[47] - g_RT[47]);
+        Kc[160] = exp(-g_RT[10] + g_RT[11] + g_RT[48] - g_RT[48]);
+        Kc[161] = exp(-g_RT[1] + g_RT[3] - g_RT[4] + g_RT[11] - g_RT[14]);
+        Kc[162] = exp(g_RT[3] - g_RT[5] + g_RT[11] - g_RT[14]);
+        Kc[163] = exp(g_RT[0] - g_RT[1] + g_RT[11] - g_RT[12]);
+        Kc[164] = exp(g_RT[5] - g_RT[5] - g_RT[10] + g_RT[11]);
+        Kc[165] = exp(-g_RT[1] + g_RT[11] + g_RT[12] - g_RT[24]);
+        Kc[166] = exp(g_RT[11] - 2*g_RT[12] + g_RT[13]);
+        Kc[167] = exp(-g_RT[10] + g_RT[11] + g_RT[14] - g_RT[14]);
+        Kc[168] = exp(-g_RT[10] + g_RT[11] + g_RT[15] - g_RT[15]);
+        Kc[169] = exp(g_RT[11] - g_RT[14] + g_RT[15] - g_RT[17]);
+        Kc[170] = exp(g_RT[11] - g_RT[12] - g_RT[25] + g_RT[26]);
+        Kc[171] = exp(-g_RT[2] + g_RT[3] + g_RT[12] - g_RT[19]);
+        Kc[172] = exp(g_RT[3] - g_RT[4] + g_RT[12] - g_RT[17]);
+        Kc[173] = exp(-g_RT[6] + g_RT[7] + g_RT[12] - g_RT[13]);
+        Kc[174] = exp(-g_RT[1] + 2*g_RT[12] - g_RT[25]);
+        Kc[175] = exp(g_RT[12] - g_RT[13] - g_RT[14] + g_RT[16]);
+        Kc[176] = exp(g_RT[12] - g_RT[13] - g_RT[16] + g_RT[17]);
+        Kc[177] = exp(g_RT[12] - g_RT[13] - g_RT[18] + g_RT[20]);
+        Kc[178] = exp(g_RT[12] - g_RT[13] - g_RT[19] + g_RT[20]);
+        Kc[179] = exp(g_RT[12] - g_RT[13] - g_RT[23] + g_RT[24]);
+        Kc[180] = exp(g_RT[12] - g_RT[13] - g_RT[25] + g_RT[26]);
+        Kc[181] = exp(-g_RT[1] + g_RT[5] - g_RT[5] - g_RT[14] + g_RT[16]);
+        Kc[182] = exp(g_RT[3] - g_RT[6] - g_RT[14] + g_RT[16]);
+        Kc[183] = exp(g_RT[3] - g_RT[6] - g_RT[17] + g_RT[18]);
+        Kc[184] = exp(g_RT[3] - g_RT[6] - g_RT[17] + g_RT[19]);
+        Kc[185] = exp(g_RT[3] - g_RT[14] - g_RT[16] + g_RT[21]);
+        Kc[186] = exp(g_RT[0] - g_RT[1] + g_RT[21] - g_RT[22]);
+        Kc[187] = exp(g_RT[3] - g_RT[16] - g_RT[17] + g_RT[23]);
+        Kc[188] = exp(g_RT[3] - g_RT[6] - g_RT[24] + g_RT[25]);
+        Kc[189] = exp(g_RT[3] - g_RT[4] - 2*g_RT[14] + g_RT[27]);
+        Kc[190] = exp(-2*g_RT[14] - g_RT[22] + 2*g_RT[27]);
+        Kc[191] = exp(-g_RT[2] + g_RT[30] + g_RT[35] - g_RT[47]);
+        Kc[192] = exp(-g_RT[2] + g_RT[3] + g_RT[30] - g_RT[35]);
+        Kc[193] = exp(-g_RT[1] + g_RT[4] + g_RT[30] - g_RT[35]);
+        Kc[194] = exp(g_RT[2] - g_RT[3] + g_RT[37] - g_RT[47]);
+        Kc[195] = exp(g_RT[2] - 2*g_RT[35] + g_RT[37]);
+        Kc[196] = exp(g_RT[1] - g_RT[4] + g_RT[37] - g_RT[47]);
+        Kc[197] = exp(g_RT[4] - g_RT[6] + g_RT[37] - g_RT[47]);
+        Kc[198] = exp(-g_RT[4] + g_RT[6] + g_RT[35] - g_RT[36]);
+        Kc[199] = exp(g_RT[2] - g_RT[3] - g_RT[35] + g_RT[36]);
+        Kc[200] = exp(g_RT[1] - g_RT[4] - g_RT[35] + g_RT[36]);
+        Kc[201] = exp(-g_RT[1] + g_RT[2] + g_RT[31] - g_RT[35]);
+        Kc[202] = exp(-g_RT[0] + g_RT[1] - g_RT[30] + g_RT[31]);
+        Kc[203] = exp(-g_RT[1] + g_RT[4] + g_RT[31] - g_RT[38]);
+        Kc[204] = exp(g_RT[4] - g_RT[5] - g_RT[30] + g_RT[31]);
+        Kc[205] = exp(-g_RT[2] + g_RT[3] + g_RT[31] - g_RT[38]);
+        Kc[206] = exp(g_RT[3] - g_RT[4] + g_RT[31] - g_RT[35]);
+        Kc[207] = exp(-g_RT[1] + g_RT[30] + g_RT[31] - g_RT[47]);
+        Kc[208] = exp(-g_RT[0] + g_RT[5] + g_RT[31] - g_RT[38]);
+        Kc[209] = exp(-g_RT[4] + g_RT[31] + g_RT[35] - g_RT[47]);
+        Kc[210] = exp(-g_RT[1] + g_RT[31] + g_RT[35] - g_RT[37]);
+        Kc[211] = exp(g_RT[2] - g_RT[4] - g_RT[31] + g_RT[32]);
+        Kc[212] = exp(-g_RT[1] + g_RT[2] + g_RT[32] - g_RT[38]);
+        Kc[213] = exp(-g_RT[0] + g_RT[1] - g_RT[31] + g_RT[32]);
+        Kc[214] = exp(g_RT[4] - g_RT[5] - g_RT[31] + g_RT[32]);
+        Kc[216] = exp(g_RT[3] - g_RT[6] + g_RT[34] - g_RT[47]);
+        Kc[217] = exp(g_RT[2] - g_RT[4] + g_RT[34] - g_RT[47]);
+        Kc[218] = exp(g_RT[2] - g_RT[31] + g_RT[34] - g_RT[35]);
+        Kc[219] = exp(-g_RT[0] + g_RT[1] + g_RT[34] - g_RT[47]);
+        Kc[220] = exp(g_RT[4] - g_RT[5] + g_RT[34] - g_RT[47]);
+        Kc[221] = exp(g_RT[12] - g_RT[13] + g_RT[34] - g_RT[47]);
+        Kc[222] = exp(g_RT[2] - g_RT[4] - g_RT[35] + g_RT[38]);
+        Kc[223] = exp(-g_RT[0] + g_RT[1] - g_RT[35] + g_RT[38]);
+        Kc[224] = exp(g_RT[4] - g_RT[5] - g_RT[35] + g_RT[38]);
+        Kc[225] = exp(g_RT[3] - g_RT[6] - g_RT[35] + g_RT[38]);
+        Kc[226] = exp(g_RT[2] - g_RT[14] - g_RT[30] + g_RT[39]);
+        Kc[227] = exp(-g_RT[1] + g_RT[4] + g_RT[39] - g_RT[46]);
+        Kc[228] = exp(-g_RT[4] + g_RT[5] + g_RT[39] - g_RT[40]);
+        Kc[229] = exp(-g_RT[2] + g_RT[3] + g_RT[39] - g_RT[46]);
+        Kc[230] = exp(g_RT[0] - g_RT[1] + g_RT[39] - g_RT[40]);
+        Kc[231] = exp(g_RT[2] - g_RT[14] - g_RT[35] + g_RT[46]);
+        Kc[232] = exp(g_RT[1] - g_RT[14] - g_RT[31] + g_RT[46]);
+        Kc[233] = exp(-g_RT[1] + g_RT[4] - g_RT[14] - g_RT[35] + g_RT[46]);
+        Kc[234] = exp(-g_RT[14] + g_RT[30] + g_RT[46] - g_RT[47]);
+        Kc[235] = exp(g_RT[3] - g_RT[15] - g_RT[35] + g_RT[46]);
+        Kc[236] = exp(-g_RT[14] + g_RT[35] - g_RT[37] + g_RT[46]);
+        Kc[237] = exp(-g_RT[15] + g_RT[35] + g_RT[46] - g_RT[47]);
+        Kc[238] = exp(-g_RT[1] + g_RT[2] + g_RT[40] - g_RT[46]);
+        Kc[239] = exp(g_RT[2] - g_RT[14] - g_RT[31] + g_RT[40]);
+        Kc[240] = exp(g_RT[2] - g_RT[4] - g_RT[39] + g_RT[40]);
+        Kc[241] = exp(-g_RT[1] + g_RT[4] + g_RT[40] - g_RT[44]);
+        Kc[242] = exp(-g_RT[1] + g_RT[4] + g_RT[40] - g_RT[45]);
+        Kc[243] = exp(g_RT[4] - g_RT[14] - g_RT[32] + g_RT[40]);
+        Kc[244] = exp(-g_RT[10] + g_RT[30] + g_RT[41] - g_RT[47]);
+        Kc[245] = exp(g_RT[8] - g_RT[30] - g_RT[39] + g_RT[47]);
+        Kc[246] = exp(g_RT[9] - g_RT[30] - g_RT[40] + g_RT[47]);
+        Kc[247] = exp(g_RT[10] - g_RT[31] - g_RT[40] + g_RT[47]);
+        Kc[248] = exp(g_RT[11] - g_RT[31] - g_RT[40] + g_RT[47]);
+        Kc[249] = exp(-g_RT[2] + g_RT[8] + g_RT[35] - g_RT[39]);
+        Kc[250] = exp(g_RT[8] - g_RT[14] - g_RT[30] + g_RT[35]);
+        Kc[251] = exp(-g_RT[2] + g_RT[9] + g_RT[35] - g_RT[40]);
+        Kc[252] = exp(-g_RT[1] + g_RT[9] + g_RT[35] - g_RT[46]);
+        Kc[253] = exp(g_RT[9] - g_RT[16] - g_RT[30] + g_RT[35]);
+        Kc[254] = exp(-g_RT[1] + g_RT[10] + g_RT[35] - g_RT[45]);
+        Kc[255] = exp(-g_RT[4] + g_RT[10] + g_RT[35] - g_RT[40]);
+        Kc[256] = exp(-g_RT[1] + g_RT[10] + g_RT[35] - g_RT[43]);
+        Kc[257] = exp(-g_RT[1] + g_RT[11] + g_RT[35] - g_RT[45]);
+        Kc[258] = exp(-g_RT[4] + g_RT[11] + g_RT[35] - g_RT[40]);
+        Kc[259] = exp(-g_RT[1] + g_RT[11] + g_RT[35] - g_RT[43]);
+        Kc[260] = exp(-g_RT[5] + g_RT[12] + g_RT[35] - g_RT[40]);
+        Kc[261] = exp(-g_RT[4] + g_RT[12] + g_RT[35] - g_RT[41]);
+        Kc[262] = exp(-g_RT[1] + g_RT[2] - g_RT[14] + g_RT[42] - g_RT[47]);
+        Kc[263] = exp(g_RT[2] - g_RT[35] - g_RT[40] + g_RT[42]);
+        Kc[264] = exp(-g_RT[2] + g_RT[3] - g_RT[16] + g_RT[42] - g_RT[47]);
+        Kc[265] = exp(-g_RT[1] + g_RT[4] - g_RT[16] + g_RT[42] - g_RT[47]);
+        Kc[266] = exp(g_RT[1] - g_RT[10] + g_RT[42] - g_RT[47]);
+        Kc[267] = exp(g_RT[2] - g_RT[15] - g_RT[31] + g_RT[45]);
+        Kc[268] = exp(g_RT[2] - g_RT[14] - g_RT[38] + g_RT[45]);
+        Kc[269] = exp(g_RT[2] - g_RT[4] + g_RT[45] - g_RT[46]);
+        Kc[270] = exp(g_RT[1] - g_RT[14] - g_RT[32] + g_RT[45]);
+        Kc[271] = exp(-g_RT[0] + g_RT[1] + g_RT[45] - g_RT[46]);
+        Kc[272] = exp(g_RT[4] - g_RT[5] + g_RT[45] - g_RT[46]);
+        Kc[273] = exp(g_RT[4] - g_RT[15] - g_RT[32] + g_RT[45]);
+        Kc[274] = exp(g_RT[1] - g_RT[1] + g_RT[43] - g_RT[45]);
+        Kc[275] = exp(g_RT[1] - g_RT[4] - g_RT[40] + g_RT[43]);
+        Kc[276] = exp(g_RT[1] - g_RT[14] - g_RT[32] + g_RT[43]);
+        Kc[277] = exp(g_RT[1] - g_RT[1] + g_RT[44] - g_RT[45]);
+        Kc[278] = exp(-g_RT[14] + g_RT[27] + g_RT[35] - g_RT[43]);
+        Kc[279] = exp(-g_RT[1] + g_RT[12] + g_RT[30] - g_RT[41]);
+        Kc[280] = exp(-g_RT[0] + g_RT[12] + g_RT[30] - g_RT[40]);
+        Kc[281] = exp(-g_RT[0] + g_RT[1] - g_RT[32] + g_RT[33]);
+        Kc[282] = exp(g_RT[4] - g_RT[5] - g_RT[32] + g_RT[33]);
+        Kc[283] = exp(g_RT[2] - g_RT[4] - g_RT[32] + g_RT[33]);
+        Kc[284] = exp(-g_RT[14] + g_RT[15] + g_RT[31] - g_RT[38]);
+        Kc[285] = exp(-g_RT[35] + g_RT[36] + g_RT[39] - g_RT[46]);
+        Kc[286] = exp(-g_RT[15] + g_RT[36] - g_RT[37] + g_RT[46]);
+        Kc[287] = exp(-g_RT[14] + g_RT[15] + g_RT[30] - g_RT[35]);
+        Kc[288] = exp(-g_RT[0] - g_RT[1] + g_RT[2] + g_RT[12] - g_RT[14]);
+        Kc[289] = exp(-g_RT[1] + g_RT[2] + g_RT[24] - g_RT[51]);
+        Kc[290] = exp(-g_RT[1] + g_RT[2] + g_RT[25] - g_RT[52]);
+        Kc[292] = exp(-g_RT[0] + g_RT[4] + g_RT[12] - g_RT[17]);
+        Kc[293] = exp(-2*g_RT[1] + g_RT[3] + g_RT[10] - g_RT[15]);
+        Kc[294] = exp(-g_RT[2] + g_RT[3] + g_RT[10] - g_RT[17]);
+        Kc[295] = exp(-2*g_RT[1] + g_RT[10] + g_RT[10] - g_RT[22]);
+        Kc[296] = exp(-g_RT[0] + g_RT[5] + g_RT[11] - g_RT[17]);
+        Kc[297] = exp(-g_RT[2] + g_RT[3] + g_RT[23] - g_RT[51]);
+        Kc[298] = exp(g_RT[3] - g_RT[6] - g_RT[22] + g_RT[23]);
+        Kc[299] = exp(g_RT[2] - g_RT[4] - g_RT[51] + g_RT[52]);
+        Kc[300] = exp(g_RT[2] - g_RT[4] - g_RT[12] - g_RT[14] + g_RT[52]);
+        Kc[301] = exp(g_RT[3] - g_RT[6] - g_RT[12] - g_RT[14] + g_RT[52]);
+        Kc[302] = exp(-g_RT[0] + g_RT[1] - g_RT[51] + g_RT[52]);
+        Kc[303] = exp(-g_RT[0] + g_RT[1] - g_RT[12] - g_RT[14] + g_RT[52]);
+        Kc[304] = exp(g_RT[4] - g_RT[5] - g_RT[12] - g_RT[14] + g_RT[52]);
+        Kc[305] = exp(g_RT[6] - g_RT[7] - g_RT[12] - g_RT[14] + g_RT[52]);
+        Kc[306] = exp(g_RT[12] - g_RT[12] - g_RT[13] - g_RT[14] + g_RT[52]);
+        Kc[307] = exp(-g_RT[1] + g_RT[2] - g_RT[10] - g_RT[15] + g_RT[51]);
+        Kc[308] = exp(g_RT[3] - g_RT[4] - g_RT[14] - g_RT[17] + g_RT[51]);
+        Kc[309] = exp(g_RT[3] - g_RT[4] - 2*g_RT[16] + g_RT[51]);
+        Kc[310] = exp(g_RT[1] - g_RT[12] - g_RT[16] + g_RT[51]);
+        Kc[311] = exp(-g_RT[0] + g_RT[1] - g_RT[28] + g_RT[51]);
+        Kc[312] = exp(g_RT[4] - g_RT[5] - g_RT[28] + g_RT[51]);
+        Kc[313] = exp(g_RT[4] - g_RT[16] - g_RT[18] + g_RT[51]);
+        Kc[314] = exp(g_RT[2] - g_RT[4] - g_RT[49] + g_RT[50]);
+        Kc[315] = exp(-g_RT[0] + g_RT[1] - g_RT[49] + g_RT[50]);
+        Kc[316] = exp(g_RT[4] - g_RT[5] - g_RT[49] + g_RT[50]);
+        Kc[317] = exp(-g_RT[6] + g_RT[7] + g_RT[49] - g_RT[50]);
+        Kc[318] = exp(g_RT[12] - g_RT[13] - g_RT[49] + g_RT[50]);
+        Kc[319] = exp(g_RT[2] - g_RT[17] - g_RT[25] + g_RT[49]);
+        Kc[320] = exp(g_RT[1] - g_RT[12] - g_RT[25] + g_RT[49]);
+        Kc[321] = exp(g_RT[4] - g_RT[18] - g_RT[25] + g_RT[49]);
+        Kc[322] = exp(-g_RT[3] + g_RT[6] + g_RT[49] - g_RT[50]);
+        Kc[323] = exp(-g_RT[4] + g_RT[6] - g_RT[17] - g_RT[25] + g_RT[49]);
+        Kc[324] = exp(g_RT[12] - 2*g_RT[25] + g_RT[49]);
+
+        /*reactions with the net stoichiometry of an earlier one */
+        Kc[109] = Kc[108];
+        Kc[135] = Kc[134];
+        Kc[215] = Kc[36];
+        Kc[291] = Kc[107];
+
+        Kc[0] *= refCinv;
+        Kc[1] *= refCinv;
+        Kc[2] *= refCinv;
+        Kc[3] *= refCinv;
+        Kc[4] *= refCinv;
+        Kc[5] *= refCinv;
+        Kc[6] *= refCinv;
+        Kc[7] *= refCinv;
+        Kc[8] *= refCinv;
+        Kc[9] *= refCinv;
+        Kc[10] *= refCinv;
+        Kc[11] *= refCinv;
+        Kc[12] *= refCinv;
+        Kc[13] *= refCinv;
+        Kc[14] *= refCinv;
+        Kc[15] *= refCinv;
+        Kc[16] *= refCinv;
+        Kc[17] *= refCinv;
+        Kc[18] *= refCinv;
+        Kc[19] *= refC;
+        Kc[20] *= refCinv;
+        Kc[21] *= refCinv;
+        Kc[22] *= refCinv;
+        Kc[23] *= refCinv;
+        Kc[24] *= refCinv;
+        Kc[25] *= refCinv;
+        Kc[26] *= refCinv;
+        Kc[27] *= refC;
+        Kc[28] *= refCinv;
+        Kc[29] *= refCinv;
+        Kc[30] *= refCinv;
+        Kc[31] *= refCinv;
+        Kc[32] *= refCinv;
+        Kc[33] *= refCinv;
+        Kc[34] *= refC;
+        Kc[35] *= refCinv;
+        Kc[36] *= refC;
+        Kc[37] *= refCinv;
+        Kc[38] *= refC;
+        Kc[39] *= refC;
+        Kc[40] *= refC;
+        Kc[65] *= refC;
+        Kc[70] *= refCinv;
+        Kc[71] *= refCinv;
+        Kc[72] *= refCinv;
+        Kc[73] *= refCinv;
+        Kc[75] *= refCinv;
+        Kc[76] *= refCinv;
+        Kc[77] *= refCinv;
+        Kc[153] *= refC;
+        Kc[161] *= refC;
+        Kc[181] *= refC;
+        Kc[189] *= refC;
+        Kc[190] *= refC;
+        Kc[215] *= refC;
+        Kc[233] *= refC;
+        Kc[262] *= refC;
+        Kc[264] *= refC;
+        Kc[265] *= refC;
+        Kc[288] *= refC;
+        Kc[293] *= refC;
+        Kc[295] *= refC;
+        Kc[300] *= refC;
+        Kc[301] *= refC;
+        Kc[303] *= refC;
+        Kc[304] *= refC;
+        Kc[305] *= refC;
+        Kc[306] *= refC;
+        Kc[307] *= refC;
+        Kc[308] *= refC;
+        Kc[309] *= refC;
+        Kc[323] *= refC;
+    }
 
     return;
 }
@@ -18797,6 +19608,10 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         mixture += sc[i];
     }
 
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[0][0] - 1)*sc[0] + (TB[0][1] - 1)*sc[5] + (TB[0][2] - 1)*sc[13] + (TB[0][3] - 1)*sc[14] + (TB[0][4] - 1)*sc[15] + (TB[0][5] - 1)*sc[26] + (TB[0][6] - 1)*sc[48];
+    double alpha_eff1 = mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[13] + (TB[3][3] - 1)*sc[14] + (TB[3][4] - 1)*sc[15] + (TB[3][5] - 1)*sc[26];
+
     double Corr[325];
     for (int i = 0; i < 325; ++i) {
         Corr[i] = 1.0;
@@ -18805,32 +19620,32 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
     /* troe */
     {
         double alpha[26];
-        alpha[0] = mixture + (TB[0][0] - 1)*sc[0] + (TB[0][1] - 1)*sc[5] + (TB[0][2] - 1)*sc[13] + (TB[0][3] - 1)*sc[14] + (TB[0][4] - 1)*sc[15] + (TB[0][5] - 1)*sc[26] + (TB[0][6] - 1)*sc[48];
+        alpha[0] = alpha_eff0;
         alpha[1] = mixture + (TB[1][0] - 1)*sc[0] + (TB[1][1] - 1)*sc[5] + (TB[1][2] - 1)*sc[13] + (TB[1][3] - 1)*sc[14] + (TB[1][4] - 1)*sc[15] + (TB[1][5] - 1)*sc[26] + (TB[1][6] - 1)*sc[48];
-        alpha[2] = mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[13] + (TB[2][3] - 1)*sc[14] + (TB[2][4] - 1)*sc[15] + (TB[2][5] - 1)*sc[26] + (TB[2][6] - 1)*sc[48];
-        alpha[3] = mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[13] + (TB[3][3] - 1)*sc[14] + (TB[3][4] - 1)*sc[15] + (TB[3][5] - 1)*sc[26];
-        alpha[4] = mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[13] + (TB[4][3] - 1)*sc[14] + (TB[4][4] - 1)*sc[15] + (TB[4][5] - 1)*sc[26];
-        alpha[5] = mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[13] + (TB[5][3] - 1)*sc[14] + (TB[5][4] - 1)*sc[15] + (TB[5][5] - 1)*sc[26];
-        alpha[6] = mixture + (TB[6][0] - 1)*sc[0] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[13] + (TB[6][3] - 1)*sc[14] + (TB[6][4] - 1)*sc[15] + (TB[6][5] - 1)*sc[26];
-        alpha[7] = mixture + (TB[7][0] - 1)*sc[0] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[13] + (TB[7][3] - 1)*sc[14] + (TB[7][4] - 1)*sc[15] + (TB[7][5] - 1)*sc[26] + (TB[7][6] - 1)*sc[48];
-        alpha[8] = mixture + (TB[8][0] - 1)*sc[0] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[13] + (TB[8][3] - 1)*sc[14] + (TB[8][4] - 1)*sc[15] + (TB[8][5] - 1)*sc[26] + (TB[8][6] - 1)*sc[48];
-        alpha[9] = mixture + (TB[9][0] - 1)*sc[0] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[13] + (TB[9][3] - 1)*sc[14] + (TB[9][4] - 1)*sc[15] + (TB[9][5] - 1)*sc[26] + (TB[9][6] - 1)*sc[48];
-        alpha[10] = mixture + (TB[10][0] - 1)*sc[0] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[13] + (TB[10][3] - 1)*sc[14] + (TB[10][4] - 1)*sc[15] + (TB[10][5] - 1)*sc[26] + (TB[10][6] - 1)*sc[48];
-        alpha[11] = mixture + (TB[11][0] - 1)*sc[0] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[13] + (TB[11][3] - 1)*sc[14] + (TB[11][4] - 1)*sc[15] + (TB[11][5] - 1)*sc[26] + (TB[11][6] - 1)*sc[48];
-        alpha[12] = mixture + (TB[12][0] - 1)*sc[0] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[13] + (TB[12][3] - 1)*sc[14] + (TB[12][4] - 1)*sc[15] + (TB[12][5] - 1)*sc[26] + (TB[12][6] - 1)*sc[48];
-        alpha[13] = mixture + (TB[13][0] - 1)*sc[0] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[13] + (TB[13][3] - 1)*sc[14] + (TB[13][4] - 1)*sc[15] + (TB[13][5] - 1)*sc[26] + (TB[13][6] - 1)*sc[48];
-        alpha[14] = mixture + (TB[14][0] - 1)*sc[0] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[13] + (TB[14][3] - 1)*sc[14] + (TB[14][4] - 1)*sc[15] + (TB[14][5] - 1)*sc[26];
-        alpha[15] = mixture + (TB[15][0] - 1)*sc[0] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[13] + (TB[15][3] - 1)*sc[14] + (TB[15][4] - 1)*sc[15] + (TB[15][5] - 1)*sc[26] + (TB[15][6] - 1)*sc[48];
-        alpha[16] = mixture + (TB[16][0] - 1)*sc[0] + (TB[16][1] - 1)*sc[5] + (TB[16][2] - 1)*sc[13] + (TB[16][3] - 1)*sc[14] + (TB[16][4] - 1)*sc[15] + (TB[16][5] - 1)*sc[26] + (TB[16][6] - 1)*sc[48];
-        alpha[17] = mixture + (TB[17][0] - 1)*sc[0] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[13] + (TB[17][3] - 1)*sc[14] + (TB[17][4] - 1)*sc[15] + (TB[17][5] - 1)*sc[26];
-        alpha[18] = mixture + (TB[18][0] - 1)*sc[0] + (TB[18][1] - 1)*sc[5] + (TB[18][2] - 1)*sc[13] + (TB[18][3] - 1)*sc[14] + (TB[18][4] - 1)*sc[15] + (TB[18][5] - 1)*sc[26] + (TB[18][6] - 1)*sc[48];
-        alpha[19] = mixture + (TB[19][0] - 1)*sc[0] + (TB[19][1] - 1)*sc[5] + (TB[19][2] - 1)*sc[13] + (TB[19][3] - 1)*sc[14] + (TB[19][4] - 1)*sc[15] + (TB[19][5] - 1)*sc[26] + (TB[19][6] - 1)*sc[48];
+        alpha[2] = (memcmp(TB[2], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[13] + (TB[2][3] - 1)*sc[14] + (TB[2][4] - 1)*sc[15] + (TB[2][5] - 1)*sc[26] + (TB[2][6] - 1)*sc[48]);
+        alpha[3] = alpha_eff1;
+        alpha[4] = (memcmp(TB[4], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[13] + (TB[4][3] - 1)*sc[14] + (TB[4][4] - 1)*sc[15] + (TB[4][5] - 1)*sc[26]);
+        alpha[5] = (memcmp(TB[5], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[13] + (TB[5][3] - 1)*sc[14] + (TB[5][4] - 1)*sc[15] + (TB[5][5] - 1)*sc[26]);
+        alpha[6] = (memcmp(TB[6], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[6][0] - 1)*sc[0] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[13] + (TB[6][3] - 1)*sc[14] + (TB[6][4] - 1)*sc[15] + (TB[6][5] - 1)*sc[26]);
+        alpha[7] = (memcmp(TB[7], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[7][0] - 1)*sc[0] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[13] + (TB[7][3] - 1)*sc[14] + (TB[7][4] - 1)*sc[15] + (TB[7][5] - 1)*sc[26] + (TB[7][6] - 1)*sc[48]);
+        alpha[8] = (memcmp(TB[8], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[8][0] - 1)*sc[0] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[13] + (TB[8][3] - 1)*sc[14] + (TB[8][4] - 1)*sc[15] + (TB[8][5] - 1)*sc[26] + (TB[8][6] - 1)*sc[48]);
+        alpha[9] = (memcmp(TB[9], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[9][0] - 1)*sc[0] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[13] + (TB[9][3] - 1)*sc[14] + (TB[9][4] - 1)*sc[15] + (TB[9][5] - 1)*sc[26] + (TB[9][6] - 1)*sc[48]);
+        alpha[10] = (memcmp(TB[10], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[10][0] - 1)*sc[0] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[13] + (TB[10][3] - 1)*sc[14] + (TB[10][4] - 1)*sc[15] + (TB[10][5] - 1)*sc[26] + (TB[10][6] - 1)*sc[48]);
+        alpha[11] = (memcmp(TB[11], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[11][0] - 1)*sc[0] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[13] + (TB[11][3] - 1)*sc[14] + (TB[11][4] - 1)*sc[15] + (TB[11][5] - 1)*sc[26] + (TB[11][6] - 1)*sc[48]);
+        alpha[12] = (memcmp(TB[12], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[12][0] - 1)*sc[0] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[13] + (TB[12][3] - 1)*sc[14] + (TB[12][4] - 1)*sc[15] + (TB[12][5] - 1)*sc[26] + (TB[12][6] - 1)*sc[48]);
+        alpha[13] = (memcmp(TB[13], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[13][0] - 1)*sc[0] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[13] + (TB[13][3] - 1)*sc[14] + (TB[13][4] - 1)*sc[15] + (TB[13][5] - 1)*sc[26] + (TB[13][6] - 1)*sc[48]);
+        alpha[14] = (memcmp(TB[14], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[14][0] - 1)*sc[0] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[13] + (TB[14][3] - 1)*sc[14] + (TB[14][4] - 1)*sc[15] + (TB[14][5] - 1)*sc[26]);
+        alpha[15] = (memcmp(TB[15], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[15][0] - 1)*sc[0] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[13] + (TB[15][3] - 1)*sc[14] + (TB[15][4] - 1)*sc[15] + (TB[15][5] - 1)*sc[26] + (TB[15][6] - 1)*sc[48]);
+        alpha[16] = (memcmp(TB[16], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[16][0] - 1)*sc[0] + (TB[16][1] - 1)*sc[5] + (TB[16][2] - 1)*sc[13] + (TB[16][3] - 1)*sc[14] + (TB[16][4] - 1)*sc[15] + (TB[16][5] - 1)*sc[26] + (TB[16][6] - 1)*sc[48]);
+        alpha[17] = (memcmp(TB[17], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[17][0] - 1)*sc[0] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[13] + (TB[17][3] - 1)*sc[14] + (TB[17][4] - 1)*sc[15] + (TB[17][5] - 1)*sc[26]);
+        alpha[18] = (memcmp(TB[18], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[18][0] - 1)*sc[0] + (TB[18][1] - 1)*sc[5] + (TB[18][2] - 1)*sc[13] + (TB[18][3] - 1)*sc[14] + (TB[18][4] - 1)*sc[15] + (TB[18][5] - 1)*sc[26] + (TB[18][6] - 1)*sc[48]);
+        alpha[19] = (memcmp(TB[19], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[19][0] - 1)*sc[0] + (TB[19][1] - 1)*sc[5] + (TB[19][2] - 1)*sc[13] + (TB[19][3] - 1)*sc[14] + (TB[19][4] - 1)*sc[15] + (TB[19][5] - 1)*sc[26] + (TB[19][6] - 1)*sc[48]);
         alpha[20] = mixture + (TB[20][0] - 1)*sc[0] + (TB[20][1] - 1)*sc[5] + (TB[20][2] - 1)*sc[13] + (TB[20][3] - 1)*sc[14] + (TB[20][4] - 1)*sc[15] + (TB[20][5] - 1)*sc[26] + (TB[20][6] - 1)*sc[48];
-        alpha[21] = mixture + (TB[21][0] - 1)*sc[0] + (TB[21][1] - 1)*sc[5] + (TB[21][2] - 1)*sc[13] + (TB[21][3] - 1)*sc[14] + (TB[21][4] - 1)*sc[15] + (TB[21][5] - 1)*sc[26] + (TB[21][6] - 1)*sc[48];
-        alpha[22] = mixture + (TB[22][0] - 1)*sc[0] + (TB[22][1] - 1)*sc[5] + (TB[22][2] - 1)*sc[13] + (TB[22][3] - 1)*sc[14] + (TB[22][4] - 1)*sc[15] + (TB[22][5] - 1)*sc[26] + (TB[22][6] - 1)*sc[48];
-        alpha[23] = mixture + (TB[23][0] - 1)*sc[0] + (TB[23][1] - 1)*sc[5] + (TB[23][2] - 1)*sc[13] + (TB[23][3] - 1)*sc[14] + (TB[23][4] - 1)*sc[15] + (TB[23][5] - 1)*sc[26] + (TB[23][6] - 1)*sc[48];
-        alpha[24] = mixture + (TB[24][0] - 1)*sc[0] + (TB[24][1] - 1)*sc[5] + (TB[24][2] - 1)*sc[13] + (TB[24][3] - 1)*sc[14] + (TB[24][4] - 1)*sc[15] + (TB[24][5] - 1)*sc[26] + (TB[24][6] - 1)*sc[48];
-        alpha[25] = mixture + (TB[25][0] - 1)*sc[0] + (TB[25][1] - 1)*sc[5] + (TB[25][2] - 1)*sc[13] + (TB[25][3] - 1)*sc[14] + (TB[25][4] - 1)*sc[15] + (TB[25][5] - 1)*sc[26] + (TB[25][6] - 1)*sc[48];
+        alpha[21] = (memcmp(TB[21], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[21][0] - 1)*sc[0] + (TB[21][1] - 1)*sc[5] + (TB[21][2] - 1)*sc[13] + (TB[21][3] - 1)*sc[14] + (TB[21][4] - 1)*sc[15] + (TB[21][5] - 1)*sc[26] + (TB[21][6] - 1)*sc[48]);
+        alpha[22] = (memcmp(TB[22], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[22][0] - 1)*sc[0] + (TB[22][1] - 1)*sc[5] + (TB[22][2] - 1)*sc[13] + (TB[22][3] - 1)*sc[14] + (TB[22][4] - 1)*sc[15] + (TB[22][5] - 1)*sc[26] + (TB[22][6] - 1)*sc[48]);
+        alpha[23] = (memcmp(TB[23], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[23][0] - 1)*sc[0] + (TB[23][1] - 1)*sc[5] + (TB[23][2] - 1)*sc[13] + (TB[23][3] - 1)*sc[14] + (TB[23][4] - 1)*sc[15] + (TB[23][5] - 1)*sc[26] + (TB[23][6] - 1)*sc[48]);
+        alpha[24] = (memcmp(TB[24], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[24][0] - 1)*sc[0] + (TB[24][1] - 1)*sc[5] + (TB[24][2] - 1)*sc[13] + (TB[24][3] - 1)*sc[14] + (TB[24][4] - 1)*sc[15] + (TB[24][5] - 1)*sc[26] + (TB[24][6] - 1)*sc[48]);
+        alpha[25] = (memcmp(TB[25], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[25][0] - 1)*sc[0] + (TB[25][1] - 1)*sc[5] + (TB[25][2] - 1)*sc[13] + (TB[25][3] - 1)*sc[14] + (TB[25][4] - 1)*sc[15] + (TB[25][5] - 1)*sc[26] + (TB[25][6] - 1)*sc[48]);
 #ifdef __INTEL_COMPILER
          #pragma simd
 #endif
@@ -18857,7 +19672,7 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         double alpha[3];
         alpha[0] = mixture + (TB[26][0] - 1)*sc[0] + (TB[26][1] - 1)*sc[3] + (TB[26][2] - 1)*sc[5] + (TB[26][3] - 1)*sc[13] + (TB[26][4] - 1)*sc[14] + (TB[26][5] - 1)*sc[15] + (TB[26][6] - 1)*sc[26] + (TB[26][7] - 1)*sc[48];
         alpha[1] = mixture + (TB[27][0] - 1)*sc[0] + (TB[27][1] - 1)*sc[5] + (TB[27][2] - 1)*sc[13] + (TB[27][3] - 1)*sc[14] + (TB[27][4] - 1)*sc[15] + (TB[27][5] - 1)*sc[26] + (TB[27][6] - 1)*sc[48];
-        alpha[2] = mixture + (TB[28][0] - 1)*sc[0] + (TB[28][1] - 1)*sc[5] + (TB[28][2] - 1)*sc[13] + (TB[28][3] - 1)*sc[14] + (TB[28][4] - 1)*sc[15] + (TB[28][5] - 1)*sc[26] + (TB[28][6] - 1)*sc[48];
+        alpha[2] = (memcmp(TB[28], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[28][0] - 1)*sc[0] + (TB[28][1] - 1)*sc[5] + (TB[28][2] - 1)*sc[13] + (TB[28][3] - 1)*sc[14] + (TB[28][4] - 1)*sc[15] + (TB[28][5] - 1)*sc[26] + (TB[28][6] - 1)*sc[48]);
         for (int i=26; i<29; i++)
         {
             double redP = alpha[i-26] / k_f_save[i] * phase_units[i] * low_A[i] * exp(low_beta[i] * tc[0] - activation_units[i] * low_Ea[i] * invT);
@@ -18870,7 +19685,7 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         double alpha;
         alpha = mixture + (TB[29][0] - 1)*sc[0] + (TB[29][1] - 1)*sc[5] + (TB[29][2] - 1)*sc[13] + (TB[29][3] - 1)*sc[14] + (TB[29][4] - 1)*sc[15] + (TB[29][5] - 1)*sc[26] + (TB[29][6] - 1)*sc[48];
         Corr[29] = alpha;
-        alpha = mixture + (TB[30][0] - 1)*sc[0] + (TB[30][1] - 1)*sc[5] + (TB[30][2] - 1)*sc[13] + (TB[30][3] - 1)*sc[14] + (TB[30][4] - 1)*sc[15] + (TB[30][5] - 1)*sc[26] + (TB[30][6] - 1)*sc[48];
+        alpha = (memcmp(TB[30], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[30][0] - 1)*sc[0] + (TB[30][1] - 1)*sc[5] + (TB[30][2] - 1)*sc[13] + (TB[30][3] - 1)*sc[14] + (TB[30][4] - 1)*sc[15] + (TB[30][5] - 1)*sc[26] + (TB[30][6] - 1)*sc[48]);
         Corr[30] = alpha;
         alpha = mixture + (TB[31][0] - 1)*sc[3] + (TB[31][1] - 1)*sc[5] + (TB[31][2] - 1)*sc[14] + (TB[31][3] - 1)*sc[15] + (TB[31][4] - 1)*sc[26] + (TB[31][5] - 1)*sc[47] + (TB[31][6] - 1)*sc[48];
         Corr[31] = alpha;
@@ -18880,17 +19695,17 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         Corr[33] = alpha;
         alpha = mixture + (TB[34][0] - 1)*sc[0] + (TB[34][1] - 1)*sc[5] + (TB[34][2] - 1)*sc[13] + (TB[34][3] - 1)*sc[14] + (TB[34][4] - 1)*sc[15] + (TB[34][5] - 1)*sc[26];
         Corr[34] = alpha;
-        alpha = mixture + (TB[35][0] - 1)*sc[0] + (TB[35][1] - 1)*sc[5] + (TB[35][2] - 1)*sc[13] + (TB[35][3] - 1)*sc[14] + (TB[35][4] - 1)*sc[15] + (TB[35][5] - 1)*sc[26] + (TB[35][6] - 1)*sc[48];
+        alpha = (memcmp(TB[35], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[35][0] - 1)*sc[0] + (TB[35][1] - 1)*sc[5] + (TB[35][2] - 1)*sc[13] + (TB[35][3] - 1)*sc[14] + (TB[35][4] - 1)*sc[15] + (TB[35][5] - 1)*sc[26] + (TB[35][6] - 1)*sc[48]);
         Corr[35] = alpha;
-        alpha = mixture + (TB[36][0] - 1)*sc[0] + (TB[36][1] - 1)*sc[5] + (TB[36][2] - 1)*sc[13] + (TB[36][3] - 1)*sc[14] + (TB[36][4] - 1)*sc[15] + (TB[36][5] - 1)*sc[26] + (TB[36][6] - 1)*sc[48];
+        alpha = (memcmp(TB[36], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[36][0] - 1)*sc[0] + (TB[36][1] - 1)*sc[5] + (TB[36][2] - 1)*sc[13] + (TB[36][3] - 1)*sc[14] + (TB[36][4] - 1)*sc[15] + (TB[36][5] - 1)*sc[26] + (TB[36][6] - 1)*sc[48]);
         Corr[36] = alpha;
-        alpha = mixture + (TB[37][0] - 1)*sc[0] + (TB[37][1] - 1)*sc[5] + (TB[37][2] - 1)*sc[13] + (TB[37][3] - 1)*sc[14] + (TB[37][4] - 1)*sc[15] + (TB[37][5] - 1)*sc[26] + (TB[37][6] - 1)*sc[48];
+        alpha = (memcmp(TB[37], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[37][0] - 1)*sc[0] + (TB[37][1] - 1)*sc[5] + (TB[37][2] - 1)*sc[13] + (TB[37][3] - 1)*sc[14] + (TB[37][4] - 1)*sc[15] + (TB[37][5] - 1)*sc[26] + (TB[37][6] - 1)*sc[48]);
         Corr[37] = alpha;
-        alpha = mixture + (TB[38][0] - 1)*sc[0] + (TB[38][1] - 1)*sc[5] + (TB[38][2] - 1)*sc[13] + (TB[38][3] - 1)*sc[14] + (TB[38][4] - 1)*sc[15] + (TB[38][5] - 1)*sc[26] + (TB[38][6] - 1)*sc[48];
+        alpha = (memcmp(TB[38], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[38][0] - 1)*sc[0] + (TB[38][1] - 1)*sc[5] + (TB[38][2] - 1)*sc[13] + (TB[38][3] - 1)*sc[14] + (TB[38][4] - 1)*sc[15] + (TB[38][5] - 1)*sc[26] + (TB[38][6] - 1)*sc[48]);
         Corr[38] = alpha;
-        alpha = mixture + (TB[39][0] - 1)*sc[0] + (TB[39][1] - 1)*sc[5] + (TB[39][2] - 1)*sc[13] + (TB[39][3] - 1)*sc[14] + (TB[39][4] - 1)*sc[15] + (TB[39][5] - 1)*sc[26] + (TB[39][6] - 1)*sc[48];
+        alpha = (memcmp(TB[39], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[39][0] - 1)*sc[0] + (TB[39][1] - 1)*sc[5] + (TB[39][2] - 1)*sc[13] + (TB[39][3] - 1)*sc[14] + (TB[39][4] - 1)*sc[15] + (TB[39][5] - 1)*sc[26] + (TB[39][6] - 1)*sc[48]);
         Corr[39] = alpha;
-        alpha = mixture + (TB[40][0] - 1)*sc[0] + (TB[40][1] - 1)*sc[5] + (TB[40][2] - 1)*sc[13] + (TB[40][3] - 1)*sc[14] + (TB[40][4] - 1)*sc[15] + (TB[40][5] - 1)*sc[26] + (TB[40][6] - 1)*sc[48];
+        alpha = (memcmp(TB[40], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[40][0] - 1)*sc[0] + (TB[40][1] - 1)*sc[5] + (TB[40][2] - 1)*sc[13] + (TB[40][3] - 1)*sc[14] + (TB[40][4] - 1)*sc[15] + (TB[40][5] - 1)*sc[26] + (TB[40][6] - 1)*sc[48]);
         Corr[40] = alpha;
     }
 
@@ -24680,17 +25495,24 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         mixture += sc[k];
     }
 
-    /*compute the Gibbs free energy */
-    double g_RT[53];
-    gibbs(g_RT, tc);
-
     /*compute the species enthalpy */
     double h_RT[53];
     speciesEnthalpy(h_RT, tc);
 
+    /*compute the rate and equilibrium constants */
+    double k_f_s[325], Kc_s[325];
+    comp_k_f(tc, invT, k_f_s);
+    comp_Kc(tc, invT, Kc_s);
+
+    /*at constant volume, the part of dwdot/d[X] common to all species */
+    double Jmix[53];
+    for (int k=0; k<53; k++) {
+        Jmix[k] = 0.0;
+    }
+
     double phi_f, k_f, k_r, phi_r, Kc, q, q_nocor, Corr, alpha;
     double dlnkfdT, dlnk0dT, dlnKcdT, dkrdT, dqdT;
-    double dqdci, dcdc_fac, dqdc[53];
+    double dqdci, dcdc_fac;
     double Pr, fPr, F, k_0, logPr;
     double logFcent, troe_c, troe_n, troePr_den, troePr, troe;
     double Fcent1, Fcent2, Fcent3, Fcent;
@@ -24698,15 +25520,19 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     double dlogPrdT, dlogfPrdT, dlogFdT, dlogFcentdT, dlogFdlogPr, dlnCorrdT;
     const double ln10 = log(10.0);
     const double log10e = 1.0/log(10.0);
+
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[0][0] - 1)*sc[0] + (TB[0][1] - 1)*sc[5] + (TB[0][2] - 1)*sc[13] + (TB[0][3] - 1)*sc[14] + (TB[0][4] - 1)*sc[15] + (TB[0][5] - 1)*sc[26] + (TB[0][6] - 1)*sc[48];
+    double alpha_eff1 = mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[13] + (TB[3][3] - 1)*sc[14] + (TB[3][4] - 1)*sc[15] + (TB[3][5] - 1)*sc[26];
+
     /*reaction 1: H + CH2 (+M) <=> CH3 (+M) */
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[0][0] - 1)*sc[0] + (TB[0][1] - 1)*sc[5] + (TB[0][2] - 1)*sc[13] + (TB[0][3] - 1)*sc[14] + (TB[0][4] - 1)*sc[15] + (TB[0][5] - 1)*sc[26] + (TB[0][6] - 1)*sc[48];
+    alpha = alpha_eff0;
     /* forward */
     phi_f = sc[1]*sc[10];
-    k_f = prefactor_units[0] * fwd_A[0]
-                * exp(fwd_beta[0] * tc[0] - activation_units[0] * fwd_Ea[0] * invT);
+    k_f = k_f_s[0];
     dlnkfdT = fwd_beta[0] * invT + activation_units[0] * fwd_Ea[0] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[0] * exp(low_beta[0] * tc[0] - activation_units[0] * low_Ea[0] * invT);
@@ -24722,16 +25548,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[0] == 4 ? exp(-troe_Tss[0] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
+      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
+      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
-      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
-      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -24739,7 +25565,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[12];
-    Kc = refCinv * exp(g_RT[1] + g_RT[10] - g_RT[12]);
+    Kc = Kc_s[0];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[10]) + (h_RT[12]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24757,118 +25583,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[0][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[10] -= dqdci;               /* dwdot[CH2]/d[H2] */
-        J[12] += dqdci;               /* dwdot[CH3]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[10];
-        J[55] -= dqdci;               /* dwdot[H]/d[H] */
-        J[64] -= dqdci;               /* dwdot[CH2]/d[H] */
-        J[66] += dqdci;               /* dwdot[CH3]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[0][1] - 1)*dcdc_fac;
-        J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[280] -= dqdci;              /* dwdot[CH2]/d[H2O] */
-        J[282] += dqdci;              /* dwdot[CH3]/d[H2O] */
-        /* d()/d[CH2] */
-        dqdci =  + k_f*sc[1];
-        J[541] -= dqdci;              /* dwdot[H]/d[CH2] */
-        J[550] -= dqdci;              /* dwdot[CH2]/d[CH2] */
-        J[552] += dqdci;              /* dwdot[CH3]/d[CH2] */
-        /* d()/d[CH3] */
-        dqdci =  - k_r;
-        J[649] -= dqdci;              /* dwdot[H]/d[CH3] */
-        J[658] -= dqdci;              /* dwdot[CH2]/d[CH3] */
-        J[660] += dqdci;              /* dwdot[CH3]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[0][2] - 1)*dcdc_fac;
-        J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[712] -= dqdci;              /* dwdot[CH2]/d[CH4] */
-        J[714] += dqdci;              /* dwdot[CH3]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[0][3] - 1)*dcdc_fac;
-        J[757] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[766] -= dqdci;              /* dwdot[CH2]/d[CO] */
-        J[768] += dqdci;              /* dwdot[CH3]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[0][4] - 1)*dcdc_fac;
-        J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[820] -= dqdci;              /* dwdot[CH2]/d[CO2] */
-        J[822] += dqdci;              /* dwdot[CH3]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[0][5] - 1)*dcdc_fac;
-        J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1414] -= dqdci;             /* dwdot[CH2]/d[C2H6] */
-        J[1416] += dqdci;             /* dwdot[CH3]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[0][6] - 1)*dcdc_fac;
-        J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2602] -= dqdci;             /* dwdot[CH2]/d[AR] */
-        J[2604] += dqdci;             /* dwdot[CH3]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[0][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[10];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[0][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac + k_f*sc[1];
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac - k_r;
-        dqdc[13] = TB[0][2]*dcdc_fac;
-        dqdc[14] = TB[0][3]*dcdc_fac;
-        dqdc[15] = TB[0][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[0][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[0][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+1] -= dqdc[k];
-            J[54*k+10] -= dqdc[k];
-            J[54*k+12] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[10] -= dcdc_fac;
+    Jmix[12] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[0][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[10] -= dqdci;               /* dwdot[CH2]/d[H2] */
+    J[12] += dqdci;               /* dwdot[CH3]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[10];
+    J[55] -= dqdci;               /* dwdot[H]/d[H] */
+    J[64] -= dqdci;               /* dwdot[CH2]/d[H] */
+    J[66] += dqdci;               /* dwdot[CH3]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[0][1] - 1)*dcdc_fac;
+    J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[280] -= dqdci;              /* dwdot[CH2]/d[H2O] */
+    J[282] += dqdci;              /* dwdot[CH3]/d[H2O] */
+    /* d()/d[CH2] */
+    dqdci =  + k_f*sc[1];
+    J[541] -= dqdci;              /* dwdot[H]/d[CH2] */
+    J[550] -= dqdci;              /* dwdot[CH2]/d[CH2] */
+    J[552] += dqdci;              /* dwdot[CH3]/d[CH2] */
+    /* d()/d[CH3] */
+    dqdci =  - k_r;
+    J[649] -= dqdci;              /* dwdot[H]/d[CH3] */
+    J[658] -= dqdci;              /* dwdot[CH2]/d[CH3] */
+    J[660] += dqdci;              /* dwdot[CH3]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[0][2] - 1)*dcdc_fac;
+    J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[712] -= dqdci;              /* dwdot[CH2]/d[CH4] */
+    J[714] += dqdci;              /* dwdot[CH3]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[0][3] - 1)*dcdc_fac;
+    J[757] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[766] -= dqdci;              /* dwdot[CH2]/d[CO] */
+    J[768] += dqdci;              /* dwdot[CH3]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[0][4] - 1)*dcdc_fac;
+    J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[820] -= dqdci;              /* dwdot[CH2]/d[CO2] */
+    J[822] += dqdci;              /* dwdot[CH3]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[0][5] - 1)*dcdc_fac;
+    J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1414] -= dqdci;             /* dwdot[CH2]/d[C2H6] */
+    J[1416] += dqdci;             /* dwdot[CH3]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[0][6] - 1)*dcdc_fac;
+    J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2602] -= dqdci;             /* dwdot[CH2]/d[AR] */
+    J[2604] += dqdci;             /* dwdot[CH3]/d[AR] */
     J[2863] -= dqdT; /* dwdot[H]/dT */
     J[2872] -= dqdT; /* dwdot[CH2]/dT */
     J[2874] += dqdT; /* dwdot[CH3]/dT */
@@ -24880,8 +25648,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[1][0] - 1)*sc[0] + (TB[1][1] - 1)*sc[5] + (TB[1][2] - 1)*sc[13] + (TB[1][3] - 1)*sc[14] + (TB[1][4] - 1)*sc[15] + (TB[1][5] - 1)*sc[26] + (TB[1][6] - 1)*sc[48];
     /* forward */
     phi_f = sc[1]*sc[12];
-    k_f = prefactor_units[1] * fwd_A[1]
-                * exp(fwd_beta[1] * tc[0] - activation_units[1] * fwd_Ea[1] * invT);
+    k_f = k_f_s[1];
     dlnkfdT = fwd_beta[1] * invT + activation_units[1] * fwd_Ea[1] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[1] * exp(low_beta[1] * tc[0] - activation_units[1] * low_Ea[1] * invT);
@@ -24897,16 +25664,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[1] == 4 ? exp(-troe_Tss[1] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
+      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
+      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
-      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
-      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -24914,7 +25681,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[13];
-    Kc = refCinv * exp(g_RT[1] + g_RT[12] - g_RT[13]);
+    Kc = Kc_s[1];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[12]) + (h_RT[13]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24932,113 +25699,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[1][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
-        J[13] += dqdci;               /* dwdot[CH4]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[12];
-        J[55] -= dqdci;               /* dwdot[H]/d[H] */
-        J[66] -= dqdci;               /* dwdot[CH3]/d[H] */
-        J[67] += dqdci;               /* dwdot[CH4]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[1][1] - 1)*dcdc_fac;
-        J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[282] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[283] += dqdci;              /* dwdot[CH4]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[1];
-        J[649] -= dqdci;              /* dwdot[H]/d[CH3] */
-        J[660] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[661] += dqdci;              /* dwdot[CH4]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[1][2] - 1)*dcdc_fac - k_r;
-        J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[714] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[715] += dqdci;              /* dwdot[CH4]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[1][3] - 1)*dcdc_fac;
-        J[757] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[768] -= dqdci;              /* dwdot[CH3]/d[CO] */
-        J[769] += dqdci;              /* dwdot[CH4]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[1][4] - 1)*dcdc_fac;
-        J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[822] -= dqdci;              /* dwdot[CH3]/d[CO2] */
-        J[823] += dqdci;              /* dwdot[CH4]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[1][5] - 1)*dcdc_fac;
-        J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1416] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
-        J[1417] += dqdci;             /* dwdot[CH4]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[1][6] - 1)*dcdc_fac;
-        J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2604] -= dqdci;             /* dwdot[CH3]/d[AR] */
-        J[2605] += dqdci;             /* dwdot[CH4]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[1][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[12];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[1][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*sc[1];
-        dqdc[13] = TB[1][2]*dcdc_fac - k_r;
-        dqdc[14] = TB[1][3]*dcdc_fac;
-        dqdc[15] = TB[1][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[1][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[1][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+1] -= dqdc[k];
-            J[54*k+12] -= dqdc[k];
-            J[54*k+13] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[12] -= dcdc_fac;
+    Jmix[13] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[1][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
+    J[13] += dqdci;               /* dwdot[CH4]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[12];
+    J[55] -= dqdci;               /* dwdot[H]/d[H] */
+    J[66] -= dqdci;               /* dwdot[CH3]/d[H] */
+    J[67] += dqdci;               /* dwdot[CH4]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[1][1] - 1)*dcdc_fac;
+    J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[282] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[283] += dqdci;              /* dwdot[CH4]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[1];
+    J[649] -= dqdci;              /* dwdot[H]/d[CH3] */
+    J[660] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[661] += dqdci;              /* dwdot[CH4]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[1][2] - 1)*dcdc_fac - k_r;
+    J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[714] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[715] += dqdci;              /* dwdot[CH4]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[1][3] - 1)*dcdc_fac;
+    J[757] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[768] -= dqdci;              /* dwdot[CH3]/d[CO] */
+    J[769] += dqdci;              /* dwdot[CH4]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[1][4] - 1)*dcdc_fac;
+    J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[822] -= dqdci;              /* dwdot[CH3]/d[CO2] */
+    J[823] += dqdci;              /* dwdot[CH4]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[1][5] - 1)*dcdc_fac;
+    J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1416] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
+    J[1417] += dqdci;             /* dwdot[CH4]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[1][6] - 1)*dcdc_fac;
+    J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2604] -= dqdci;             /* dwdot[CH3]/d[AR] */
+    J[2605] += dqdci;             /* dwdot[CH4]/d[AR] */
     J[2863] -= dqdT; /* dwdot[H]/dT */
     J[2874] -= dqdT; /* dwdot[CH3]/dT */
     J[2875] += dqdT; /* dwdot[CH4]/dT */
@@ -25047,11 +25756,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[13] + (TB[2][3] - 1)*sc[14] + (TB[2][4] - 1)*sc[15] + (TB[2][5] - 1)*sc[26] + (TB[2][6] - 1)*sc[48];
+    alpha = (memcmp(TB[2], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[13] + (TB[2][3] - 1)*sc[14] + (TB[2][4] - 1)*sc[15] + (TB[2][5] - 1)*sc[26] + (TB[2][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[1]*sc[16];
-    k_f = prefactor_units[2] * fwd_A[2]
-                * exp(fwd_beta[2] * tc[0] - activation_units[2] * fwd_Ea[2] * invT);
+    k_f = k_f_s[2];
     dlnkfdT = fwd_beta[2] * invT + activation_units[2] * fwd_Ea[2] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[2] * exp(low_beta[2] * tc[0] - activation_units[2] * low_Ea[2] * invT);
@@ -25067,16 +25775,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[2] == 4 ? exp(-troe_Tss[2] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[2]) > 1.e-100 ? -Fcent1/troe_Tsss[2] : 0.)
+      + (fabs(troe_Ts[2]) > 1.e-100 ? -Fcent2/troe_Ts[2] : 0.)
+      + (troe_len[2] == 4 ? Fcent3*troe_Tss[2]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[2]) > 1.e-100 ? -Fcent1/troe_Tsss[2] : 0.)
-      + (fabs(troe_Ts[2]) > 1.e-100 ? -Fcent2/troe_Ts[2] : 0.)
-      + (troe_len[2] == 4 ? Fcent3*troe_Tss[2]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -25084,7 +25792,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[17];
-    Kc = refCinv * exp(g_RT[1] + g_RT[16] - g_RT[17]);
+    Kc = Kc_s[2];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[16]) + (h_RT[17]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25102,118 +25810,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[2][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[16] -= dqdci;               /* dwdot[HCO]/d[H2] */
-        J[17] += dqdci;               /* dwdot[CH2O]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[16];
-        J[55] -= dqdci;               /* dwdot[H]/d[H] */
-        J[70] -= dqdci;               /* dwdot[HCO]/d[H] */
-        J[71] += dqdci;               /* dwdot[CH2O]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[2][1] - 1)*dcdc_fac;
-        J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[286] -= dqdci;              /* dwdot[HCO]/d[H2O] */
-        J[287] += dqdci;              /* dwdot[CH2O]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[2][2] - 1)*dcdc_fac;
-        J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[718] -= dqdci;              /* dwdot[HCO]/d[CH4] */
-        J[719] += dqdci;              /* dwdot[CH2O]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[2][3] - 1)*dcdc_fac;
-        J[757] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[772] -= dqdci;              /* dwdot[HCO]/d[CO] */
-        J[773] += dqdci;              /* dwdot[CH2O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[2][4] - 1)*dcdc_fac;
-        J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[826] -= dqdci;              /* dwdot[HCO]/d[CO2] */
-        J[827] += dqdci;              /* dwdot[CH2O]/d[CO2] */
-        /* d()/d[HCO] */
-        dqdci =  + k_f*sc[1];
-        J[865] -= dqdci;              /* dwdot[H]/d[HCO] */
-        J[880] -= dqdci;              /* dwdot[HCO]/d[HCO] */
-        J[881] += dqdci;              /* dwdot[CH2O]/d[HCO] */
-        /* d()/d[CH2O] */
-        dqdci =  - k_r;
-        J[919] -= dqdci;              /* dwdot[H]/d[CH2O] */
-        J[934] -= dqdci;              /* dwdot[HCO]/d[CH2O] */
-        J[935] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[2][5] - 1)*dcdc_fac;
-        J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1420] -= dqdci;             /* dwdot[HCO]/d[C2H6] */
-        J[1421] += dqdci;             /* dwdot[CH2O]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[2][6] - 1)*dcdc_fac;
-        J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2608] -= dqdci;             /* dwdot[HCO]/d[AR] */
-        J[2609] += dqdci;             /* dwdot[CH2O]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[2][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[16];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[2][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[2][2]*dcdc_fac;
-        dqdc[14] = TB[2][3]*dcdc_fac;
-        dqdc[15] = TB[2][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac + k_f*sc[1];
-        dqdc[17] = dcdc_fac - k_r;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[2][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[2][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+1] -= dqdc[k];
-            J[54*k+16] -= dqdc[k];
-            J[54*k+17] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[16] -= dcdc_fac;
+    Jmix[17] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[2][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[16] -= dqdci;               /* dwdot[HCO]/d[H2] */
+    J[17] += dqdci;               /* dwdot[CH2O]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[16];
+    J[55] -= dqdci;               /* dwdot[H]/d[H] */
+    J[70] -= dqdci;               /* dwdot[HCO]/d[H] */
+    J[71] += dqdci;               /* dwdot[CH2O]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[2][1] - 1)*dcdc_fac;
+    J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[286] -= dqdci;              /* dwdot[HCO]/d[H2O] */
+    J[287] += dqdci;              /* dwdot[CH2O]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[2][2] - 1)*dcdc_fac;
+    J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[718] -= dqdci;              /* dwdot[HCO]/d[CH4] */
+    J[719] += dqdci;              /* dwdot[CH2O]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[2][3] - 1)*dcdc_fac;
+    J[757] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[772] -= dqdci;              /* dwdot[HCO]/d[CO] */
+    J[773] += dqdci;              /* dwdot[CH2O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[2][4] - 1)*dcdc_fac;
+    J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[826] -= dqdci;              /* dwdot[HCO]/d[CO2] */
+    J[827] += dqdci;              /* dwdot[CH2O]/d[CO2] */
+    /* d()/d[HCO] */
+    dqdci =  + k_f*sc[1];
+    J[865] -= dqdci;              /* dwdot[H]/d[HCO] */
+    J[880] -= dqdci;              /* dwdot[HCO]/d[HCO] */
+    J[881] += dqdci;              /* dwdot[CH2O]/d[HCO] */
+    /* d()/d[CH2O] */
+    dqdci =  - k_r;
+    J[919] -= dqdci;              /* dwdot[H]/d[CH2O] */
+    J[934] -= dqdci;              /* dwdot[HCO]/d[CH2O] */
+    J[935] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[2][5] - 1)*dcdc_fac;
+    J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1420] -= dqdci;             /* dwdot[HCO]/d[C2H6] */
+    J[1421] += dqdci;             /* dwdot[CH2O]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[2][6] - 1)*dcdc_fac;
+    J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2608] -= dqdci;             /* dwdot[HCO]/d[AR] */
+    J[2609] += dqdci;             /* dwdot[CH2O]/d[AR] */
     J[2863] -= dqdT; /* dwdot[H]/dT */
     J[2878] -= dqdT; /* dwdot[HCO]/dT */
     J[2879] += dqdT; /* dwdot[CH2O]/dT */
@@ -25222,11 +25872,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[13] + (TB[3][3] - 1)*sc[14] + (TB[3][4] - 1)*sc[15] + (TB[3][5] - 1)*sc[26];
+    alpha = alpha_eff1;
     /* forward */
     phi_f = sc[1]*sc[17];
-    k_f = prefactor_units[3] * fwd_A[3]
-                * exp(fwd_beta[3] * tc[0] - activation_units[3] * fwd_Ea[3] * invT);
+    k_f = k_f_s[3];
     dlnkfdT = fwd_beta[3] * invT + activation_units[3] * fwd_Ea[3] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[3] * exp(low_beta[3] * tc[0] - activation_units[3] * low_Ea[3] * invT);
@@ -25242,16 +25891,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[3] == 4 ? exp(-troe_Tss[3] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[3]) > 1.e-100 ? -Fcent1/troe_Tsss[3] : 0.)
+      + (fabs(troe_Ts[3]) > 1.e-100 ? -Fcent2/troe_Ts[3] : 0.)
+      + (troe_len[3] == 4 ? Fcent3*troe_Tss[3]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[3]) > 1.e-100 ? -Fcent1/troe_Tsss[3] : 0.)
-      + (fabs(troe_Ts[3]) > 1.e-100 ? -Fcent2/troe_Ts[3] : 0.)
-      + (troe_len[3] == 4 ? Fcent3*troe_Tss[3]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -25259,7 +25908,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[18];
-    Kc = refCinv * exp(g_RT[1] + g_RT[17] - g_RT[18]);
+    Kc = Kc_s[3];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[17]) + (h_RT[18]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25277,113 +25926,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[3][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[17] -= dqdci;               /* dwdot[CH2O]/d[H2] */
-        J[18] += dqdci;               /* dwdot[CH2OH]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[17];
-        J[55] -= dqdci;               /* dwdot[H]/d[H] */
-        J[71] -= dqdci;               /* dwdot[CH2O]/d[H] */
-        J[72] += dqdci;               /* dwdot[CH2OH]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[3][1] - 1)*dcdc_fac;
-        J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[287] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
-        J[288] += dqdci;              /* dwdot[CH2OH]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[3][2] - 1)*dcdc_fac;
-        J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[719] -= dqdci;              /* dwdot[CH2O]/d[CH4] */
-        J[720] += dqdci;              /* dwdot[CH2OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[3][3] - 1)*dcdc_fac;
-        J[757] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[773] -= dqdci;              /* dwdot[CH2O]/d[CO] */
-        J[774] += dqdci;              /* dwdot[CH2OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[3][4] - 1)*dcdc_fac;
-        J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[827] -= dqdci;              /* dwdot[CH2O]/d[CO2] */
-        J[828] += dqdci;              /* dwdot[CH2OH]/d[CO2] */
-        /* d()/d[CH2O] */
-        dqdci =  + k_f*sc[1];
-        J[919] -= dqdci;              /* dwdot[H]/d[CH2O] */
-        J[935] -= dqdci;              /* dwdot[CH2O]/d[CH2O] */
-        J[936] += dqdci;              /* dwdot[CH2OH]/d[CH2O] */
-        /* d()/d[CH2OH] */
-        dqdci =  - k_r;
-        J[973] -= dqdci;              /* dwdot[H]/d[CH2OH] */
-        J[989] -= dqdci;              /* dwdot[CH2O]/d[CH2OH] */
-        J[990] += dqdci;              /* dwdot[CH2OH]/d[CH2OH] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[3][5] - 1)*dcdc_fac;
-        J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1421] -= dqdci;             /* dwdot[CH2O]/d[C2H6] */
-        J[1422] += dqdci;             /* dwdot[CH2OH]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[3][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[17];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[3][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[3][2]*dcdc_fac;
-        dqdc[14] = TB[3][3]*dcdc_fac;
-        dqdc[15] = TB[3][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac + k_f*sc[1];
-        dqdc[18] = dcdc_fac - k_r;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[3][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+1] -= dqdc[k];
-            J[54*k+17] -= dqdc[k];
-            J[54*k+18] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[17] -= dcdc_fac;
+    Jmix[18] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[3][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[17] -= dqdci;               /* dwdot[CH2O]/d[H2] */
+    J[18] += dqdci;               /* dwdot[CH2OH]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[17];
+    J[55] -= dqdci;               /* dwdot[H]/d[H] */
+    J[71] -= dqdci;               /* dwdot[CH2O]/d[H] */
+    J[72] += dqdci;               /* dwdot[CH2OH]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[3][1] - 1)*dcdc_fac;
+    J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[287] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
+    J[288] += dqdci;              /* dwdot[CH2OH]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[3][2] - 1)*dcdc_fac;
+    J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[719] -= dqdci;              /* dwdot[CH2O]/d[CH4] */
+    J[720] += dqdci;              /* dwdot[CH2OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[3][3] - 1)*dcdc_fac;
+    J[757] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[773] -= dqdci;              /* dwdot[CH2O]/d[CO] */
+    J[774] += dqdci;              /* dwdot[CH2OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[3][4] - 1)*dcdc_fac;
+    J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[827] -= dqdci;              /* dwdot[CH2O]/d[CO2] */
+    J[828] += dqdci;              /* dwdot[CH2OH]/d[CO2] */
+    /* d()/d[CH2O] */
+    dqdci =  + k_f*sc[1];
+    J[919] -= dqdci;              /* dwdot[H]/d[CH2O] */
+    J[935] -= dqdci;              /* dwdot[CH2O]/d[CH2O] */
+    J[936] += dqdci;              /* dwdot[CH2OH]/d[CH2O] */
+    /* d()/d[CH2OH] */
+    dqdci =  - k_r;
+    J[973] -= dqdci;              /* dwdot[H]/d[CH2OH] */
+    J[989] -= dqdci;              /* dwdot[CH2O]/d[CH2OH] */
+    J[990] += dqdci;              /* dwdot[CH2OH]/d[CH2OH] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[3][5] - 1)*dcdc_fac;
+    J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1421] -= dqdci;             /* dwdot[CH2O]/d[C2H6] */
+    J[1422] += dqdci;             /* dwdot[CH2OH]/d[C2H6] */
     J[2863] -= dqdT; /* dwdot[H]/dT */
     J[2879] -= dqdT; /* dwdot[CH2O]/dT */
     J[2880] += dqdT; /* dwdot[CH2OH]/dT */
@@ -25392,11 +25983,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[13] + (TB[4][3] - 1)*sc[14] + (TB[4][4] - 1)*sc[15] + (TB[4][5] - 1)*sc[26];
+    alpha = (memcmp(TB[4], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[13] + (TB[4][3] - 1)*sc[14] + (TB[4][4] - 1)*sc[15] + (TB[4][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[1]*sc[17];
-    k_f = prefactor_units[4] * fwd_A[4]
-                * exp(fwd_beta[4] * tc[0] - activation_units[4] * fwd_Ea[4] * invT);
+    k_f = k_f_s[4];
     dlnkfdT = fwd_beta[4] * invT + activation_units[4] * fwd_Ea[4] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[4] * exp(low_beta[4] * tc[0] - activation_units[4] * low_Ea[4] * invT);
@@ -25412,16 +26002,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[4] == 4 ? exp(-troe_Tss[4] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[4]) > 1.e-100 ? -Fcent1/troe_Tsss[4] : 0.)
+      + (fabs(troe_Ts[4]) > 1.e-100 ? -Fcent2/troe_Ts[4] : 0.)
+      + (troe_len[4] == 4 ? Fcent3*troe_Tss[4]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[4]) > 1.e-100 ? -Fcent1/troe_Tsss[4] : 0.)
-      + (fabs(troe_Ts[4]) > 1.e-100 ? -Fcent2/troe_Ts[4] : 0.)
-      + (troe_len[4] == 4 ? Fcent3*troe_Tss[4]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -25429,7 +26019,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[19];
-    Kc = refCinv * exp(g_RT[1] + g_RT[17] - g_RT[19]);
+    Kc = Kc_s[4];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[17]) + (h_RT[19]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25447,113 +26037,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[4][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[17] -= dqdci;               /* dwdot[CH2O]/d[H2] */
-        J[19] += dqdci;               /* dwdot[CH3O]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[17];
-        J[55] -= dqdci;               /* dwdot[H]/d[H] */
-        J[71] -= dqdci;               /* dwdot[CH2O]/d[H] */
-        J[73] += dqdci;               /* dwdot[CH3O]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[4][1] - 1)*dcdc_fac;
-        J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[287] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
-        J[289] += dqdci;              /* dwdot[CH3O]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[4][2] - 1)*dcdc_fac;
-        J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[719] -= dqdci;              /* dwdot[CH2O]/d[CH4] */
-        J[721] += dqdci;              /* dwdot[CH3O]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[4][3] - 1)*dcdc_fac;
-        J[757] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[773] -= dqdci;              /* dwdot[CH2O]/d[CO] */
-        J[775] += dqdci;              /* dwdot[CH3O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[4][4] - 1)*dcdc_fac;
-        J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[827] -= dqdci;              /* dwdot[CH2O]/d[CO2] */
-        J[829] += dqdci;              /* dwdot[CH3O]/d[CO2] */
-        /* d()/d[CH2O] */
-        dqdci =  + k_f*sc[1];
-        J[919] -= dqdci;              /* dwdot[H]/d[CH2O] */
-        J[935] -= dqdci;              /* dwdot[CH2O]/d[CH2O] */
-        J[937] += dqdci;              /* dwdot[CH3O]/d[CH2O] */
-        /* d()/d[CH3O] */
-        dqdci =  - k_r;
-        J[1027] -= dqdci;             /* dwdot[H]/d[CH3O] */
-        J[1043] -= dqdci;             /* dwdot[CH2O]/d[CH3O] */
-        J[1045] += dqdci;             /* dwdot[CH3O]/d[CH3O] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[4][5] - 1)*dcdc_fac;
-        J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1421] -= dqdci;             /* dwdot[CH2O]/d[C2H6] */
-        J[1423] += dqdci;             /* dwdot[CH3O]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[4][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[17];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[4][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[4][2]*dcdc_fac;
-        dqdc[14] = TB[4][3]*dcdc_fac;
-        dqdc[15] = TB[4][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac + k_f*sc[1];
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac - k_r;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[4][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+1] -= dqdc[k];
-            J[54*k+17] -= dqdc[k];
-            J[54*k+19] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[17] -= dcdc_fac;
+    Jmix[19] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[4][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[17] -= dqdci;               /* dwdot[CH2O]/d[H2] */
+    J[19] += dqdci;               /* dwdot[CH3O]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[17];
+    J[55] -= dqdci;               /* dwdot[H]/d[H] */
+    J[71] -= dqdci;               /* dwdot[CH2O]/d[H] */
+    J[73] += dqdci;               /* dwdot[CH3O]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[4][1] - 1)*dcdc_fac;
+    J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[287] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
+    J[289] += dqdci;              /* dwdot[CH3O]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[4][2] - 1)*dcdc_fac;
+    J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[719] -= dqdci;              /* dwdot[CH2O]/d[CH4] */
+    J[721] += dqdci;              /* dwdot[CH3O]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[4][3] - 1)*dcdc_fac;
+    J[757] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[773] -= dqdci;              /* dwdot[CH2O]/d[CO] */
+    J[775] += dqdci;              /* dwdot[CH3O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[4][4] - 1)*dcdc_fac;
+    J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[827] -= dqdci;              /* dwdot[CH2O]/d[CO2] */
+    J[829] += dqdci;              /* dwdot[CH3O]/d[CO2] */
+    /* d()/d[CH2O] */
+    dqdci =  + k_f*sc[1];
+    J[919] -= dqdci;              /* dwdot[H]/d[CH2O] */
+    J[935] -= dqdci;              /* dwdot[CH2O]/d[CH2O] */
+    J[937] += dqdci;              /* dwdot[CH3O]/d[CH2O] */
+    /* d()/d[CH3O] */
+    dqdci =  - k_r;
+    J[1027] -= dqdci;             /* dwdot[H]/d[CH3O] */
+    J[1043] -= dqdci;             /* dwdot[CH2O]/d[CH3O] */
+    J[1045] += dqdci;             /* dwdot[CH3O]/d[CH3O] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[4][5] - 1)*dcdc_fac;
+    J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1421] -= dqdci;             /* dwdot[CH2O]/d[C2H6] */
+    J[1423] += dqdci;             /* dwdot[CH3O]/d[C2H6] */
     J[2863] -= dqdT; /* dwdot[H]/dT */
     J[2879] -= dqdT; /* dwdot[CH2O]/dT */
     J[2881] += dqdT; /* dwdot[CH3O]/dT */
@@ -25562,11 +26094,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[13] + (TB[5][3] - 1)*sc[14] + (TB[5][4] - 1)*sc[15] + (TB[5][5] - 1)*sc[26];
+    alpha = (memcmp(TB[5], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[13] + (TB[5][3] - 1)*sc[14] + (TB[5][4] - 1)*sc[15] + (TB[5][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[1]*sc[18];
-    k_f = prefactor_units[5] * fwd_A[5]
-                * exp(fwd_beta[5] * tc[0] - activation_units[5] * fwd_Ea[5] * invT);
+    k_f = k_f_s[5];
     dlnkfdT = fwd_beta[5] * invT + activation_units[5] * fwd_Ea[5] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[5] * exp(low_beta[5] * tc[0] - activation_units[5] * low_Ea[5] * invT);
@@ -25582,16 +26113,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[5] == 4 ? exp(-troe_Tss[5] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[5]) > 1.e-100 ? -Fcent1/troe_Tsss[5] : 0.)
+      + (fabs(troe_Ts[5]) > 1.e-100 ? -Fcent2/troe_Ts[5] : 0.)
+      + (troe_len[5] == 4 ? Fcent3*troe_Tss[5]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[5]) > 1.e-100 ? -Fcent1/troe_Tsss[5] : 0.)
-      + (fabs(troe_Ts[5]) > 1.e-100 ? -Fcent2/troe_Ts[5] : 0.)
-      + (troe_len[5] == 4 ? Fcent3*troe_Tss[5]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -25599,7 +26130,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[20];
-    Kc = refCinv * exp(g_RT[1] + g_RT[18] - g_RT[20]);
+    Kc = Kc_s[5];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[18]) + (h_RT[20]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25617,113 +26148,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[5][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[18] -= dqdci;               /* dwdot[CH2OH]/d[H2] */
-        J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[18];
-        J[55] -= dqdci;               /* dwdot[H]/d[H] */
-        J[72] -= dqdci;               /* dwdot[CH2OH]/d[H] */
-        J[74] += dqdci;               /* dwdot[CH3OH]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[5][1] - 1)*dcdc_fac;
-        J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[288] -= dqdci;              /* dwdot[CH2OH]/d[H2O] */
-        J[290] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[5][2] - 1)*dcdc_fac;
-        J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[720] -= dqdci;              /* dwdot[CH2OH]/d[CH4] */
-        J[722] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[5][3] - 1)*dcdc_fac;
-        J[757] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[774] -= dqdci;              /* dwdot[CH2OH]/d[CO] */
-        J[776] += dqdci;              /* dwdot[CH3OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[5][4] - 1)*dcdc_fac;
-        J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[828] -= dqdci;              /* dwdot[CH2OH]/d[CO2] */
-        J[830] += dqdci;              /* dwdot[CH3OH]/d[CO2] */
-        /* d()/d[CH2OH] */
-        dqdci =  + k_f*sc[1];
-        J[973] -= dqdci;              /* dwdot[H]/d[CH2OH] */
-        J[990] -= dqdci;              /* dwdot[CH2OH]/d[CH2OH] */
-        J[992] += dqdci;              /* dwdot[CH3OH]/d[CH2OH] */
-        /* d()/d[CH3OH] */
-        dqdci =  - k_r;
-        J[1081] -= dqdci;             /* dwdot[H]/d[CH3OH] */
-        J[1098] -= dqdci;             /* dwdot[CH2OH]/d[CH3OH] */
-        J[1100] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[5][5] - 1)*dcdc_fac;
-        J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1422] -= dqdci;             /* dwdot[CH2OH]/d[C2H6] */
-        J[1424] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[5][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[18];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[5][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[5][2]*dcdc_fac;
-        dqdc[14] = TB[5][3]*dcdc_fac;
-        dqdc[15] = TB[5][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac + k_f*sc[1];
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac - k_r;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[5][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+1] -= dqdc[k];
-            J[54*k+18] -= dqdc[k];
-            J[54*k+20] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[18] -= dcdc_fac;
+    Jmix[20] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[5][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[18] -= dqdci;               /* dwdot[CH2OH]/d[H2] */
+    J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[18];
+    J[55] -= dqdci;               /* dwdot[H]/d[H] */
+    J[72] -= dqdci;               /* dwdot[CH2OH]/d[H] */
+    J[74] += dqdci;               /* dwdot[CH3OH]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[5][1] - 1)*dcdc_fac;
+    J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[288] -= dqdci;              /* dwdot[CH2OH]/d[H2O] */
+    J[290] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[5][2] - 1)*dcdc_fac;
+    J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[720] -= dqdci;              /* dwdot[CH2OH]/d[CH4] */
+    J[722] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[5][3] - 1)*dcdc_fac;
+    J[757] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[774] -= dqdci;              /* dwdot[CH2OH]/d[CO] */
+    J[776] += dqdci;              /* dwdot[CH3OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[5][4] - 1)*dcdc_fac;
+    J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[828] -= dqdci;              /* dwdot[CH2OH]/d[CO2] */
+    J[830] += dqdci;              /* dwdot[CH3OH]/d[CO2] */
+    /* d()/d[CH2OH] */
+    dqdci =  + k_f*sc[1];
+    J[973] -= dqdci;              /* dwdot[H]/d[CH2OH] */
+    J[990] -= dqdci;              /* dwdot[CH2OH]/d[CH2OH] */
+    J[992] += dqdci;              /* dwdot[CH3OH]/d[CH2OH] */
+    /* d()/d[CH3OH] */
+    dqdci =  - k_r;
+    J[1081] -= dqdci;             /* dwdot[H]/d[CH3OH] */
+    J[1098] -= dqdci;             /* dwdot[CH2OH]/d[CH3OH] */
+    J[1100] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[5][5] - 1)*dcdc_fac;
+    J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1422] -= dqdci;             /* dwdot[CH2OH]/d[C2H6] */
+    J[1424] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
     J[2863] -= dqdT; /* dwdot[H]/dT */
     J[2880] -= dqdT; /* dwdot[CH2OH]/dT */
     J[2882] += dqdT; /* dwdot[CH3OH]/dT */
@@ -25732,11 +26205,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[6][0] - 1)*sc[0] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[13] + (TB[6][3] - 1)*sc[14] + (TB[6][4] - 1)*sc[15] + (TB[6][5] - 1)*sc[26];
+    alpha = (memcmp(TB[6], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[6][0] - 1)*sc[0] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[13] + (TB[6][3] - 1)*sc[14] + (TB[6][4] - 1)*sc[15] + (TB[6][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[6] * fwd_A[6]
-                * exp(fwd_beta[6] * tc[0] - activation_units[6] * fwd_Ea[6] * invT);
+    k_f = k_f_s[6];
     dlnkfdT = fwd_beta[6] * invT + activation_units[6] * fwd_Ea[6] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[6] * exp(low_beta[6] * tc[0] - activation_units[6] * low_Ea[6] * invT);
@@ -25752,16 +26224,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[6] == 4 ? exp(-troe_Tss[6] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[6]) > 1.e-100 ? -Fcent1/troe_Tsss[6] : 0.)
+      + (fabs(troe_Ts[6]) > 1.e-100 ? -Fcent2/troe_Ts[6] : 0.)
+      + (troe_len[6] == 4 ? Fcent3*troe_Tss[6]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[6]) > 1.e-100 ? -Fcent1/troe_Tsss[6] : 0.)
-      + (fabs(troe_Ts[6]) > 1.e-100 ? -Fcent2/troe_Ts[6] : 0.)
-      + (troe_len[6] == 4 ? Fcent3*troe_Tss[6]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -25769,7 +26241,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[20];
-    Kc = refCinv * exp(g_RT[1] + g_RT[19] - g_RT[20]);
+    Kc = Kc_s[6];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[20]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25787,113 +26259,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[6][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[19] -= dqdci;               /* dwdot[CH3O]/d[H2] */
-        J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[19];
-        J[55] -= dqdci;               /* dwdot[H]/d[H] */
-        J[73] -= dqdci;               /* dwdot[CH3O]/d[H] */
-        J[74] += dqdci;               /* dwdot[CH3OH]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[6][1] - 1)*dcdc_fac;
-        J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[289] -= dqdci;              /* dwdot[CH3O]/d[H2O] */
-        J[290] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[6][2] - 1)*dcdc_fac;
-        J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[721] -= dqdci;              /* dwdot[CH3O]/d[CH4] */
-        J[722] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[6][3] - 1)*dcdc_fac;
-        J[757] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[775] -= dqdci;              /* dwdot[CH3O]/d[CO] */
-        J[776] += dqdci;              /* dwdot[CH3OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[6][4] - 1)*dcdc_fac;
-        J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[829] -= dqdci;              /* dwdot[CH3O]/d[CO2] */
-        J[830] += dqdci;              /* dwdot[CH3OH]/d[CO2] */
-        /* d()/d[CH3O] */
-        dqdci =  + k_f*sc[1];
-        J[1027] -= dqdci;             /* dwdot[H]/d[CH3O] */
-        J[1045] -= dqdci;             /* dwdot[CH3O]/d[CH3O] */
-        J[1046] += dqdci;             /* dwdot[CH3OH]/d[CH3O] */
-        /* d()/d[CH3OH] */
-        dqdci =  - k_r;
-        J[1081] -= dqdci;             /* dwdot[H]/d[CH3OH] */
-        J[1099] -= dqdci;             /* dwdot[CH3O]/d[CH3OH] */
-        J[1100] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[6][5] - 1)*dcdc_fac;
-        J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1423] -= dqdci;             /* dwdot[CH3O]/d[C2H6] */
-        J[1424] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[6][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[19];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[6][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[6][2]*dcdc_fac;
-        dqdc[14] = TB[6][3]*dcdc_fac;
-        dqdc[15] = TB[6][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac + k_f*sc[1];
-        dqdc[20] = dcdc_fac - k_r;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[6][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+1] -= dqdc[k];
-            J[54*k+19] -= dqdc[k];
-            J[54*k+20] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[19] -= dcdc_fac;
+    Jmix[20] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[6][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[19] -= dqdci;               /* dwdot[CH3O]/d[H2] */
+    J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[19];
+    J[55] -= dqdci;               /* dwdot[H]/d[H] */
+    J[73] -= dqdci;               /* dwdot[CH3O]/d[H] */
+    J[74] += dqdci;               /* dwdot[CH3OH]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[6][1] - 1)*dcdc_fac;
+    J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[289] -= dqdci;              /* dwdot[CH3O]/d[H2O] */
+    J[290] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[6][2] - 1)*dcdc_fac;
+    J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[721] -= dqdci;              /* dwdot[CH3O]/d[CH4] */
+    J[722] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[6][3] - 1)*dcdc_fac;
+    J[757] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[775] -= dqdci;              /* dwdot[CH3O]/d[CO] */
+    J[776] += dqdci;              /* dwdot[CH3OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[6][4] - 1)*dcdc_fac;
+    J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[829] -= dqdci;              /* dwdot[CH3O]/d[CO2] */
+    J[830] += dqdci;              /* dwdot[CH3OH]/d[CO2] */
+    /* d()/d[CH3O] */
+    dqdci =  + k_f*sc[1];
+    J[1027] -= dqdci;             /* dwdot[H]/d[CH3O] */
+    J[1045] -= dqdci;             /* dwdot[CH3O]/d[CH3O] */
+    J[1046] += dqdci;             /* dwdot[CH3OH]/d[CH3O] */
+    /* d()/d[CH3OH] */
+    dqdci =  - k_r;
+    J[1081] -= dqdci;             /* dwdot[H]/d[CH3OH] */
+    J[1099] -= dqdci;             /* dwdot[CH3O]/d[CH3OH] */
+    J[1100] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[6][5] - 1)*dcdc_fac;
+    J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1423] -= dqdci;             /* dwdot[CH3O]/d[C2H6] */
+    J[1424] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
     J[2863] -= dqdT; /* dwdot[H]/dT */
     J[2881] -= dqdT; /* dwdot[CH3O]/dT */
     J[2882] += dqdT; /* dwdot[CH3OH]/dT */
@@ -25902,11 +26316,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[7][0] - 1)*sc[0] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[13] + (TB[7][3] - 1)*sc[14] + (TB[7][4] - 1)*sc[15] + (TB[7][5] - 1)*sc[26] + (TB[7][6] - 1)*sc[48];
+    alpha = (memcmp(TB[7], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[7][0] - 1)*sc[0] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[13] + (TB[7][3] - 1)*sc[14] + (TB[7][4] - 1)*sc[15] + (TB[7][5] - 1)*sc[26] + (TB[7][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[1]*sc[21];
-    k_f = prefactor_units[7] * fwd_A[7]
-                * exp(fwd_beta[7] * tc[0] - activation_units[7] * fwd_Ea[7] * invT);
+    k_f = k_f_s[7];
     dlnkfdT = fwd_beta[7] * invT + activation_units[7] * fwd_Ea[7] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[7] * exp(low_beta[7] * tc[0] - activation_units[7] * low_Ea[7] * invT);
@@ -25922,16 +26335,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[7] == 4 ? exp(-troe_Tss[7] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[7]) > 1.e-100 ? -Fcent1/troe_Tsss[7] : 0.)
+      + (fabs(troe_Ts[7]) > 1.e-100 ? -Fcent2/troe_Ts[7] : 0.)
+      + (troe_len[7] == 4 ? Fcent3*troe_Tss[7]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[7]) > 1.e-100 ? -Fcent1/troe_Tsss[7] : 0.)
-      + (fabs(troe_Ts[7]) > 1.e-100 ? -Fcent2/troe_Ts[7] : 0.)
-      + (troe_len[7] == 4 ? Fcent3*troe_Tss[7]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -25939,7 +26352,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[22];
-    Kc = refCinv * exp(g_RT[1] + g_RT[21] - g_RT[22]);
+    Kc = Kc_s[7];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[21]) + (h_RT[22]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25957,118 +26370,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[7][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[21] -= dqdci;               /* dwdot[C2H]/d[H2] */
-        J[22] += dqdci;               /* dwdot[C2H2]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[21];
-        J[55] -= dqdci;               /* dwdot[H]/d[H] */
-        J[75] -= dqdci;               /* dwdot[C2H]/d[H] */
-        J[76] += dqdci;               /* dwdot[C2H2]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[7][1] - 1)*dcdc_fac;
-        J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[291] -= dqdci;              /* dwdot[C2H]/d[H2O] */
-        J[292] += dqdci;              /* dwdot[C2H2]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[7][2] - 1)*dcdc_fac;
-        J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[723] -= dqdci;              /* dwdot[C2H]/d[CH4] */
-        J[724] += dqdci;              /* dwdot[C2H2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[7][3] - 1)*dcdc_fac;
-        J[757] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[777] -= dqdci;              /* dwdot[C2H]/d[CO] */
-        J[778] += dqdci;              /* dwdot[C2H2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[7][4] - 1)*dcdc_fac;
-        J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[831] -= dqdci;              /* dwdot[C2H]/d[CO2] */
-        J[832] += dqdci;              /* dwdot[C2H2]/d[CO2] */
-        /* d()/d[C2H] */
-        dqdci =  + k_f*sc[1];
-        J[1135] -= dqdci;             /* dwdot[H]/d[C2H] */
-        J[1155] -= dqdci;             /* dwdot[C2H]/d[C2H] */
-        J[1156] += dqdci;             /* dwdot[C2H2]/d[C2H] */
-        /* d()/d[C2H2] */
-        dqdci =  - k_r;
-        J[1189] -= dqdci;             /* dwdot[H]/d[C2H2] */
-        J[1209] -= dqdci;             /* dwdot[C2H]/d[C2H2] */
-        J[1210] += dqdci;             /* dwdot[C2H2]/d[C2H2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[7][5] - 1)*dcdc_fac;
-        J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1425] -= dqdci;             /* dwdot[C2H]/d[C2H6] */
-        J[1426] += dqdci;             /* dwdot[C2H2]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[7][6] - 1)*dcdc_fac;
-        J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2613] -= dqdci;             /* dwdot[C2H]/d[AR] */
-        J[2614] += dqdci;             /* dwdot[C2H2]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[7][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[21];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[7][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[7][2]*dcdc_fac;
-        dqdc[14] = TB[7][3]*dcdc_fac;
-        dqdc[15] = TB[7][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac + k_f*sc[1];
-        dqdc[22] = dcdc_fac - k_r;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[7][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[7][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+1] -= dqdc[k];
-            J[54*k+21] -= dqdc[k];
-            J[54*k+22] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[21] -= dcdc_fac;
+    Jmix[22] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[7][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[21] -= dqdci;               /* dwdot[C2H]/d[H2] */
+    J[22] += dqdci;               /* dwdot[C2H2]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[21];
+    J[55] -= dqdci;               /* dwdot[H]/d[H] */
+    J[75] -= dqdci;               /* dwdot[C2H]/d[H] */
+    J[76] += dqdci;               /* dwdot[C2H2]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[7][1] - 1)*dcdc_fac;
+    J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[291] -= dqdci;              /* dwdot[C2H]/d[H2O] */
+    J[292] += dqdci;              /* dwdot[C2H2]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[7][2] - 1)*dcdc_fac;
+    J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[723] -= dqdci;              /* dwdot[C2H]/d[CH4] */
+    J[724] += dqdci;              /* dwdot[C2H2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[7][3] - 1)*dcdc_fac;
+    J[757] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[777] -= dqdci;              /* dwdot[C2H]/d[CO] */
+    J[778] += dqdci;              /* dwdot[C2H2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[7][4] - 1)*dcdc_fac;
+    J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[831] -= dqdci;              /* dwdot[C2H]/d[CO2] */
+    J[832] += dqdci;              /* dwdot[C2H2]/d[CO2] */
+    /* d()/d[C2H] */
+    dqdci =  + k_f*sc[1];
+    J[1135] -= dqdci;             /* dwdot[H]/d[C2H] */
+    J[1155] -= dqdci;             /* dwdot[C2H]/d[C2H] */
+    J[1156] += dqdci;             /* dwdot[C2H2]/d[C2H] */
+    /* d()/d[C2H2] */
+    dqdci =  - k_r;
+    J[1189] -= dqdci;             /* dwdot[H]/d[C2H2] */
+    J[1209] -= dqdci;             /* dwdot[C2H]/d[C2H2] */
+    J[1210] += dqdci;             /* dwdot[C2H2]/d[C2H2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[7][5] - 1)*dcdc_fac;
+    J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1425] -= dqdci;             /* dwdot[C2H]/d[C2H6] */
+    J[1426] += dqdci;             /* dwdot[C2H2]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[7][6] - 1)*dcdc_fac;
+    J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2613] -= dqdci;             /* dwdot[C2H]/d[AR] */
+    J[2614] += dqdci;             /* dwdot[C2H2]/d[AR] */
     J[2863] -= dqdT; /* dwdot[H]/dT */
     J[2883] -= dqdT; /* dwdot[C2H]/dT */
     J[2884] += dqdT; /* dwdot[C2H2]/dT */
@@ -26077,11 +26432,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[8][0] - 1)*sc[0] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[13] + (TB[8][3] - 1)*sc[14] + (TB[8][4] - 1)*sc[15] + (TB[8][5] - 1)*sc[26] + (TB[8][6] - 1)*sc[48];
+    alpha = (memcmp(TB[8], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[8][0] - 1)*sc[0] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[13] + (TB[8][3] - 1)*sc[14] + (TB[8][4] - 1)*sc[15] + (TB[8][5] - 1)*sc[26] + (TB[8][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[1]*sc[22];
-    k_f = prefactor_units[8] * fwd_A[8]
-                * exp(fwd_beta[8] * tc[0] - activation_units[8] * fwd_Ea[8] * invT);
+    k_f = k_f_s[8];
     dlnkfdT = fwd_beta[8] * invT + activation_units[8] * fwd_Ea[8] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[8] * exp(low_beta[8] * tc[0] - activation_units[8] * low_Ea[8] * invT);
@@ -26097,16 +26451,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[8] == 4 ? exp(-troe_Tss[8] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[8]) > 1.e-100 ? -Fcent1/troe_Tsss[8] : 0.)
+      + (fabs(troe_Ts[8]) > 1.e-100 ? -Fcent2/troe_Ts[8] : 0.)
+      + (troe_len[8] == 4 ? Fcent3*troe_Tss[8]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[8]) > 1.e-100 ? -Fcent1/troe_Tsss[8] : 0.)
-      + (fabs(troe_Ts[8]) > 1.e-100 ? -Fcent2/troe_Ts[8] : 0.)
-      + (troe_len[8] == 4 ? Fcent3*troe_Tss[8]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -26114,7 +26468,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[23];
-    Kc = refCinv * exp(g_RT[1] + g_RT[22] - g_RT[23]);
+    Kc = Kc_s[8];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[22]) + (h_RT[23]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26132,118 +26486,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[8][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[22] -= dqdci;               /* dwdot[C2H2]/d[H2] */
-        J[23] += dqdci;               /* dwdot[C2H3]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[22];
-        J[55] -= dqdci;               /* dwdot[H]/d[H] */
-        J[76] -= dqdci;               /* dwdot[C2H2]/d[H] */
-        J[77] += dqdci;               /* dwdot[C2H3]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[8][1] - 1)*dcdc_fac;
-        J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[292] -= dqdci;              /* dwdot[C2H2]/d[H2O] */
-        J[293] += dqdci;              /* dwdot[C2H3]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[8][2] - 1)*dcdc_fac;
-        J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[724] -= dqdci;              /* dwdot[C2H2]/d[CH4] */
-        J[725] += dqdci;              /* dwdot[C2H3]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[8][3] - 1)*dcdc_fac;
-        J[757] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[778] -= dqdci;              /* dwdot[C2H2]/d[CO] */
-        J[779] += dqdci;              /* dwdot[C2H3]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[8][4] - 1)*dcdc_fac;
-        J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[832] -= dqdci;              /* dwdot[C2H2]/d[CO2] */
-        J[833] += dqdci;              /* dwdot[C2H3]/d[CO2] */
-        /* d()/d[C2H2] */
-        dqdci =  + k_f*sc[1];
-        J[1189] -= dqdci;             /* dwdot[H]/d[C2H2] */
-        J[1210] -= dqdci;             /* dwdot[C2H2]/d[C2H2] */
-        J[1211] += dqdci;             /* dwdot[C2H3]/d[C2H2] */
-        /* d()/d[C2H3] */
-        dqdci =  - k_r;
-        J[1243] -= dqdci;             /* dwdot[H]/d[C2H3] */
-        J[1264] -= dqdci;             /* dwdot[C2H2]/d[C2H3] */
-        J[1265] += dqdci;             /* dwdot[C2H3]/d[C2H3] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[8][5] - 1)*dcdc_fac;
-        J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1426] -= dqdci;             /* dwdot[C2H2]/d[C2H6] */
-        J[1427] += dqdci;             /* dwdot[C2H3]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[8][6] - 1)*dcdc_fac;
-        J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2614] -= dqdci;             /* dwdot[C2H2]/d[AR] */
-        J[2615] += dqdci;             /* dwdot[C2H3]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[8][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[22];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[8][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[8][2]*dcdc_fac;
-        dqdc[14] = TB[8][3]*dcdc_fac;
-        dqdc[15] = TB[8][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac + k_f*sc[1];
-        dqdc[23] = dcdc_fac - k_r;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[8][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[8][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+1] -= dqdc[k];
-            J[54*k+22] -= dqdc[k];
-            J[54*k+23] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[22] -= dcdc_fac;
+    Jmix[23] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[8][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[22] -= dqdci;               /* dwdot[C2H2]/d[H2] */
+    J[23] += dqdci;               /* dwdot[C2H3]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[22];
+    J[55] -= dqdci;               /* dwdot[H]/d[H] */
+    J[76] -= dqdci;               /* dwdot[C2H2]/d[H] */
+    J[77] += dqdci;               /* dwdot[C2H3]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[8][1] - 1)*dcdc_fac;
+    J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[292] -= dqdci;              /* dwdot[C2H2]/d[H2O] */
+    J[293] += dqdci;              /* dwdot[C2H3]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[8][2] - 1)*dcdc_fac;
+    J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[724] -= dqdci;              /* dwdot[C2H2]/d[CH4] */
+    J[725] += dqdci;              /* dwdot[C2H3]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[8][3] - 1)*dcdc_fac;
+    J[757] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[778] -= dqdci;              /* dwdot[C2H2]/d[CO] */
+    J[779] += dqdci;              /* dwdot[C2H3]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[8][4] - 1)*dcdc_fac;
+    J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[832] -= dqdci;              /* dwdot[C2H2]/d[CO2] */
+    J[833] += dqdci;              /* dwdot[C2H3]/d[CO2] */
+    /* d()/d[C2H2] */
+    dqdci =  + k_f*sc[1];
+    J[1189] -= dqdci;             /* dwdot[H]/d[C2H2] */
+    J[1210] -= dqdci;             /* dwdot[C2H2]/d[C2H2] */
+    J[1211] += dqdci;             /* dwdot[C2H3]/d[C2H2] */
+    /* d()/d[C2H3] */
+    dqdci =  - k_r;
+    J[1243] -= dqdci;             /* dwdot[H]/d[C2H3] */
+    J[1264] -= dqdci;             /* dwdot[C2H2]/d[C2H3] */
+    J[1265] += dqdci;             /* dwdot[C2H3]/d[C2H3] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[8][5] - 1)*dcdc_fac;
+    J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1426] -= dqdci;             /* dwdot[C2H2]/d[C2H6] */
+    J[1427] += dqdci;             /* dwdot[C2H3]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[8][6] - 1)*dcdc_fac;
+    J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2614] -= dqdci;             /* dwdot[C2H2]/d[AR] */
+    J[2615] += dqdci;             /* dwdot[C2H3]/d[AR] */
     J[2863] -= dqdT; /* dwdot[H]/dT */
     J[2884] -= dqdT; /* dwdot[C2H2]/dT */
     J[2885] += dqdT; /* dwdot[C2H3]/dT */
@@ -26252,11 +26548,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[9][0] - 1)*sc[0] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[13] + (TB[9][3] - 1)*sc[14] + (TB[9][4] - 1)*sc[15] + (TB[9][5] - 1)*sc[26] + (TB[9][6] - 1)*sc[48];
+    alpha = (memcmp(TB[9], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[9][0] - 1)*sc[0] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[13] + (TB[9][3] - 1)*sc[14] + (TB[9][4] - 1)*sc[15] + (TB[9][5] - 1)*sc[26] + (TB[9][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[1]*sc[23];
-    k_f = prefactor_units[9] * fwd_A[9]
-                * exp(fwd_beta[9] * tc[0] - activation_units[9] * fwd_Ea[9] * invT);
+    k_f = k_f_s[9];
     dlnkfdT = fwd_beta[9] * invT + activation_units[9] * fwd_Ea[9] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[9] * exp(low_beta[9] * tc[0] - activation_units[9] * low_Ea[9] * invT);
@@ -26272,16 +26567,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[9] == 4 ? exp(-troe_Tss[9] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[9]) > 1.e-100 ? -Fcent1/troe_Tsss[9] : 0.)
+      + (fabs(troe_Ts[9]) > 1.e-100 ? -Fcent2/troe_Ts[9] : 0.)
+      + (troe_len[9] == 4 ? Fcent3*troe_Tss[9]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[9]) > 1.e-100 ? -Fcent1/troe_Tsss[9] : 0.)
-      + (fabs(troe_Ts[9]) > 1.e-100 ? -Fcent2/troe_Ts[9] : 0.)
-      + (troe_len[9] == 4 ? Fcent3*troe_Tss[9]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -26289,7 +26584,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[24];
-    Kc = refCinv * exp(g_RT[1] + g_RT[23] - g_RT[24]);
+    Kc = Kc_s[9];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[23]) + (h_RT[24]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26307,118 +26602,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[9][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[23] -= dqdci;               /* dwdot[C2H3]/d[H2] */
-        J[24] += dqdci;               /* dwdot[C2H4]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[23];
-        J[55] -= dqdci;               /* dwdot[H]/d[H] */
-        J[77] -= dqdci;               /* dwdot[C2H3]/d[H] */
-        J[78] += dqdci;               /* dwdot[C2H4]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[9][1] - 1)*dcdc_fac;
-        J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[293] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
-        J[294] += dqdci;              /* dwdot[C2H4]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[9][2] - 1)*dcdc_fac;
-        J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[725] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
-        J[726] += dqdci;              /* dwdot[C2H4]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[9][3] - 1)*dcdc_fac;
-        J[757] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[779] -= dqdci;              /* dwdot[C2H3]/d[CO] */
-        J[780] += dqdci;              /* dwdot[C2H4]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[9][4] - 1)*dcdc_fac;
-        J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[833] -= dqdci;              /* dwdot[C2H3]/d[CO2] */
-        J[834] += dqdci;              /* dwdot[C2H4]/d[CO2] */
-        /* d()/d[C2H3] */
-        dqdci =  + k_f*sc[1];
-        J[1243] -= dqdci;             /* dwdot[H]/d[C2H3] */
-        J[1265] -= dqdci;             /* dwdot[C2H3]/d[C2H3] */
-        J[1266] += dqdci;             /* dwdot[C2H4]/d[C2H3] */
-        /* d()/d[C2H4] */
-        dqdci =  - k_r;
-        J[1297] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1319] -= dqdci;             /* dwdot[C2H3]/d[C2H4] */
-        J[1320] += dqdci;             /* dwdot[C2H4]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[9][5] - 1)*dcdc_fac;
-        J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1427] -= dqdci;             /* dwdot[C2H3]/d[C2H6] */
-        J[1428] += dqdci;             /* dwdot[C2H4]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[9][6] - 1)*dcdc_fac;
-        J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2615] -= dqdci;             /* dwdot[C2H3]/d[AR] */
-        J[2616] += dqdci;             /* dwdot[C2H4]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[9][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[23];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[9][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[9][2]*dcdc_fac;
-        dqdc[14] = TB[9][3]*dcdc_fac;
-        dqdc[15] = TB[9][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac + k_f*sc[1];
-        dqdc[24] = dcdc_fac - k_r;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[9][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[9][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+1] -= dqdc[k];
-            J[54*k+23] -= dqdc[k];
-            J[54*k+24] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[23] -= dcdc_fac;
+    Jmix[24] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[9][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[23] -= dqdci;               /* dwdot[C2H3]/d[H2] */
+    J[24] += dqdci;               /* dwdot[C2H4]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[23];
+    J[55] -= dqdci;               /* dwdot[H]/d[H] */
+    J[77] -= dqdci;               /* dwdot[C2H3]/d[H] */
+    J[78] += dqdci;               /* dwdot[C2H4]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[9][1] - 1)*dcdc_fac;
+    J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[293] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
+    J[294] += dqdci;              /* dwdot[C2H4]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[9][2] - 1)*dcdc_fac;
+    J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[725] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
+    J[726] += dqdci;              /* dwdot[C2H4]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[9][3] - 1)*dcdc_fac;
+    J[757] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[779] -= dqdci;              /* dwdot[C2H3]/d[CO] */
+    J[780] += dqdci;              /* dwdot[C2H4]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[9][4] - 1)*dcdc_fac;
+    J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[833] -= dqdci;              /* dwdot[C2H3]/d[CO2] */
+    J[834] += dqdci;              /* dwdot[C2H4]/d[CO2] */
+    /* d()/d[C2H3] */
+    dqdci =  + k_f*sc[1];
+    J[1243] -= dqdci;             /* dwdot[H]/d[C2H3] */
+    J[1265] -= dqdci;             /* dwdot[C2H3]/d[C2H3] */
+    J[1266] += dqdci;             /* dwdot[C2H4]/d[C2H3] */
+    /* d()/d[C2H4] */
+    dqdci =  - k_r;
+    J[1297] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1319] -= dqdci;             /* dwdot[C2H3]/d[C2H4] */
+    J[1320] += dqdci;             /* dwdot[C2H4]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[9][5] - 1)*dcdc_fac;
+    J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1427] -= dqdci;             /* dwdot[C2H3]/d[C2H6] */
+    J[1428] += dqdci;             /* dwdot[C2H4]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[9][6] - 1)*dcdc_fac;
+    J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2615] -= dqdci;             /* dwdot[C2H3]/d[AR] */
+    J[2616] += dqdci;             /* dwdot[C2H4]/d[AR] */
     J[2863] -= dqdT; /* dwdot[H]/dT */
     J[2885] -= dqdT; /* dwdot[C2H3]/dT */
     J[2886] += dqdT; /* dwdot[C2H4]/dT */
@@ -26427,11 +26664,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[10][0] - 1)*sc[0] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[13] + (TB[10][3] - 1)*sc[14] + (TB[10][4] - 1)*sc[15] + (TB[10][5] - 1)*sc[26] + (TB[10][6] - 1)*sc[48];
+    alpha = (memcmp(TB[10], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[10][0] - 1)*sc[0] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[13] + (TB[10][3] - 1)*sc[14] + (TB[10][4] - 1)*sc[15] + (TB[10][5] - 1)*sc[26] + (TB[10][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[1]*sc[24];
-    k_f = prefactor_units[10] * fwd_A[10]
-                * exp(fwd_beta[10] * tc[0] - activation_units[10] * fwd_Ea[10] * invT);
+    k_f = k_f_s[10];
     dlnkfdT = fwd_beta[10] * invT + activation_units[10] * fwd_Ea[10] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[10] * exp(low_beta[10] * tc[0] - activation_units[10] * low_Ea[10] * invT);
@@ -26447,16 +26683,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[10] == 4 ? exp(-troe_Tss[10] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[10]) > 1.e-100 ? -Fcent1/troe_Tsss[10] : 0.)
+      + (fabs(troe_Ts[10]) > 1.e-100 ? -Fcent2/troe_Ts[10] : 0.)
+      + (troe_len[10] == 4 ? Fcent3*troe_Tss[10]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[10]) > 1.e-100 ? -Fcent1/troe_Tsss[10] : 0.)
-      + (fabs(troe_Ts[10]) > 1.e-100 ? -Fcent2/troe_Ts[10] : 0.)
-      + (troe_len[10] == 4 ? Fcent3*troe_Tss[10]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -26464,7 +26700,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[25];
-    Kc = refCinv * exp(g_RT[1] + g_RT[24] - g_RT[25]);
+    Kc = Kc_s[10];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[24]) + (h_RT[25]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26482,118 +26718,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[10][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[24] -= dqdci;               /* dwdot[C2H4]/d[H2] */
-        J[25] += dqdci;               /* dwdot[C2H5]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[24];
-        J[55] -= dqdci;               /* dwdot[H]/d[H] */
-        J[78] -= dqdci;               /* dwdot[C2H4]/d[H] */
-        J[79] += dqdci;               /* dwdot[C2H5]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[10][1] - 1)*dcdc_fac;
-        J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[294] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
-        J[295] += dqdci;              /* dwdot[C2H5]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[10][2] - 1)*dcdc_fac;
-        J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[726] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
-        J[727] += dqdci;              /* dwdot[C2H5]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[10][3] - 1)*dcdc_fac;
-        J[757] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[780] -= dqdci;              /* dwdot[C2H4]/d[CO] */
-        J[781] += dqdci;              /* dwdot[C2H5]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[10][4] - 1)*dcdc_fac;
-        J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[834] -= dqdci;              /* dwdot[C2H4]/d[CO2] */
-        J[835] += dqdci;              /* dwdot[C2H5]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci =  + k_f*sc[1];
-        J[1297] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1320] -= dqdci;             /* dwdot[C2H4]/d[C2H4] */
-        J[1321] += dqdci;             /* dwdot[C2H5]/d[C2H4] */
-        /* d()/d[C2H5] */
-        dqdci =  - k_r;
-        J[1351] -= dqdci;             /* dwdot[H]/d[C2H5] */
-        J[1374] -= dqdci;             /* dwdot[C2H4]/d[C2H5] */
-        J[1375] += dqdci;             /* dwdot[C2H5]/d[C2H5] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[10][5] - 1)*dcdc_fac;
-        J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1428] -= dqdci;             /* dwdot[C2H4]/d[C2H6] */
-        J[1429] += dqdci;             /* dwdot[C2H5]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[10][6] - 1)*dcdc_fac;
-        J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2616] -= dqdci;             /* dwdot[C2H4]/d[AR] */
-        J[2617] += dqdci;             /* dwdot[C2H5]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[10][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[24];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[10][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[10][2]*dcdc_fac;
-        dqdc[14] = TB[10][3]*dcdc_fac;
-        dqdc[15] = TB[10][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac + k_f*sc[1];
-        dqdc[25] = dcdc_fac - k_r;
-        dqdc[26] = TB[10][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[10][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+1] -= dqdc[k];
-            J[54*k+24] -= dqdc[k];
-            J[54*k+25] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[24] -= dcdc_fac;
+    Jmix[25] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[10][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[24] -= dqdci;               /* dwdot[C2H4]/d[H2] */
+    J[25] += dqdci;               /* dwdot[C2H5]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[24];
+    J[55] -= dqdci;               /* dwdot[H]/d[H] */
+    J[78] -= dqdci;               /* dwdot[C2H4]/d[H] */
+    J[79] += dqdci;               /* dwdot[C2H5]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[10][1] - 1)*dcdc_fac;
+    J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[294] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
+    J[295] += dqdci;              /* dwdot[C2H5]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[10][2] - 1)*dcdc_fac;
+    J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[726] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
+    J[727] += dqdci;              /* dwdot[C2H5]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[10][3] - 1)*dcdc_fac;
+    J[757] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[780] -= dqdci;              /* dwdot[C2H4]/d[CO] */
+    J[781] += dqdci;              /* dwdot[C2H5]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[10][4] - 1)*dcdc_fac;
+    J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[834] -= dqdci;              /* dwdot[C2H4]/d[CO2] */
+    J[835] += dqdci;              /* dwdot[C2H5]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci =  + k_f*sc[1];
+    J[1297] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1320] -= dqdci;             /* dwdot[C2H4]/d[C2H4] */
+    J[1321] += dqdci;             /* dwdot[C2H5]/d[C2H4] */
+    /* d()/d[C2H5] */
+    dqdci =  - k_r;
+    J[1351] -= dqdci;             /* dwdot[H]/d[C2H5] */
+    J[1374] -= dqdci;             /* dwdot[C2H4]/d[C2H5] */
+    J[1375] += dqdci;             /* dwdot[C2H5]/d[C2H5] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[10][5] - 1)*dcdc_fac;
+    J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1428] -= dqdci;             /* dwdot[C2H4]/d[C2H6] */
+    J[1429] += dqdci;             /* dwdot[C2H5]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[10][6] - 1)*dcdc_fac;
+    J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2616] -= dqdci;             /* dwdot[C2H4]/d[AR] */
+    J[2617] += dqdci;             /* dwdot[C2H5]/d[AR] */
     J[2863] -= dqdT; /* dwdot[H]/dT */
     J[2886] -= dqdT; /* dwdot[C2H4]/dT */
     J[2887] += dqdT; /* dwdot[C2H5]/dT */
@@ -26602,11 +26780,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[11][0] - 1)*sc[0] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[13] + (TB[11][3] - 1)*sc[14] + (TB[11][4] - 1)*sc[15] + (TB[11][5] - 1)*sc[26] + (TB[11][6] - 1)*sc[48];
+    alpha = (memcmp(TB[11], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[11][0] - 1)*sc[0] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[13] + (TB[11][3] - 1)*sc[14] + (TB[11][4] - 1)*sc[15] + (TB[11][5] - 1)*sc[26] + (TB[11][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[1]*sc[25];
-    k_f = prefactor_units[11] * fwd_A[11]
-                * exp(fwd_beta[11] * tc[0] - activation_units[11] * fwd_Ea[11] * invT);
+    k_f = k_f_s[11];
     dlnkfdT = fwd_beta[11] * invT + activation_units[11] * fwd_Ea[11] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[11] * exp(low_beta[11] * tc[0] - activation_units[11] * low_Ea[11] * invT);
@@ -26622,16 +26799,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[11] == 4 ? exp(-troe_Tss[11] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[11]) > 1.e-100 ? -Fcent1/troe_Tsss[11] : 0.)
+      + (fabs(troe_Ts[11]) > 1.e-100 ? -Fcent2/troe_Ts[11] : 0.)
+      + (troe_len[11] == 4 ? Fcent3*troe_Tss[11]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[11]) > 1.e-100 ? -Fcent1/troe_Tsss[11] : 0.)
-      + (fabs(troe_Ts[11]) > 1.e-100 ? -Fcent2/troe_Ts[11] : 0.)
-      + (troe_len[11] == 4 ? Fcent3*troe_Tss[11]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -26639,7 +26816,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[26];
-    Kc = refCinv * exp(g_RT[1] + g_RT[25] - g_RT[26]);
+    Kc = Kc_s[11];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[25]) + (h_RT[26]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26657,113 +26834,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[11][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[25] -= dqdci;               /* dwdot[C2H5]/d[H2] */
-        J[26] += dqdci;               /* dwdot[C2H6]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[25];
-        J[55] -= dqdci;               /* dwdot[H]/d[H] */
-        J[79] -= dqdci;               /* dwdot[C2H5]/d[H] */
-        J[80] += dqdci;               /* dwdot[C2H6]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[11][1] - 1)*dcdc_fac;
-        J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[295] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
-        J[296] += dqdci;              /* dwdot[C2H6]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[11][2] - 1)*dcdc_fac;
-        J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[727] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
-        J[728] += dqdci;              /* dwdot[C2H6]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[11][3] - 1)*dcdc_fac;
-        J[757] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[781] -= dqdci;              /* dwdot[C2H5]/d[CO] */
-        J[782] += dqdci;              /* dwdot[C2H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[11][4] - 1)*dcdc_fac;
-        J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[835] -= dqdci;              /* dwdot[C2H5]/d[CO2] */
-        J[836] += dqdci;              /* dwdot[C2H6]/d[CO2] */
-        /* d()/d[C2H5] */
-        dqdci =  + k_f*sc[1];
-        J[1351] -= dqdci;             /* dwdot[H]/d[C2H5] */
-        J[1375] -= dqdci;             /* dwdot[C2H5]/d[C2H5] */
-        J[1376] += dqdci;             /* dwdot[C2H6]/d[C2H5] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[11][5] - 1)*dcdc_fac - k_r;
-        J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1429] -= dqdci;             /* dwdot[C2H5]/d[C2H6] */
-        J[1430] += dqdci;             /* dwdot[C2H6]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[11][6] - 1)*dcdc_fac;
-        J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2617] -= dqdci;             /* dwdot[C2H5]/d[AR] */
-        J[2618] += dqdci;             /* dwdot[C2H6]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[11][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[25];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[11][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[11][2]*dcdc_fac;
-        dqdc[14] = TB[11][3]*dcdc_fac;
-        dqdc[15] = TB[11][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac + k_f*sc[1];
-        dqdc[26] = TB[11][5]*dcdc_fac - k_r;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[11][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+1] -= dqdc[k];
-            J[54*k+25] -= dqdc[k];
-            J[54*k+26] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[25] -= dcdc_fac;
+    Jmix[26] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[11][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[25] -= dqdci;               /* dwdot[C2H5]/d[H2] */
+    J[26] += dqdci;               /* dwdot[C2H6]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[25];
+    J[55] -= dqdci;               /* dwdot[H]/d[H] */
+    J[79] -= dqdci;               /* dwdot[C2H5]/d[H] */
+    J[80] += dqdci;               /* dwdot[C2H6]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[11][1] - 1)*dcdc_fac;
+    J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[295] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
+    J[296] += dqdci;              /* dwdot[C2H6]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[11][2] - 1)*dcdc_fac;
+    J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[727] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
+    J[728] += dqdci;              /* dwdot[C2H6]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[11][3] - 1)*dcdc_fac;
+    J[757] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[781] -= dqdci;              /* dwdot[C2H5]/d[CO] */
+    J[782] += dqdci;              /* dwdot[C2H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[11][4] - 1)*dcdc_fac;
+    J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[835] -= dqdci;              /* dwdot[C2H5]/d[CO2] */
+    J[836] += dqdci;              /* dwdot[C2H6]/d[CO2] */
+    /* d()/d[C2H5] */
+    dqdci =  + k_f*sc[1];
+    J[1351] -= dqdci;             /* dwdot[H]/d[C2H5] */
+    J[1375] -= dqdci;             /* dwdot[C2H5]/d[C2H5] */
+    J[1376] += dqdci;             /* dwdot[C2H6]/d[C2H5] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[11][5] - 1)*dcdc_fac - k_r;
+    J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1429] -= dqdci;             /* dwdot[C2H5]/d[C2H6] */
+    J[1430] += dqdci;             /* dwdot[C2H6]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[11][6] - 1)*dcdc_fac;
+    J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2617] -= dqdci;             /* dwdot[C2H5]/d[AR] */
+    J[2618] += dqdci;             /* dwdot[C2H6]/d[AR] */
     J[2863] -= dqdT; /* dwdot[H]/dT */
     J[2887] -= dqdT; /* dwdot[C2H5]/dT */
     J[2888] += dqdT; /* dwdot[C2H6]/dT */
@@ -26772,11 +26891,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[12][0] - 1)*sc[0] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[13] + (TB[12][3] - 1)*sc[14] + (TB[12][4] - 1)*sc[15] + (TB[12][5] - 1)*sc[26] + (TB[12][6] - 1)*sc[48];
+    alpha = (memcmp(TB[12], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[12][0] - 1)*sc[0] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[13] + (TB[12][3] - 1)*sc[14] + (TB[12][4] - 1)*sc[15] + (TB[12][5] - 1)*sc[26] + (TB[12][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[0]*sc[14];
-    k_f = prefactor_units[12] * fwd_A[12]
-                * exp(fwd_beta[12] * tc[0] - activation_units[12] * fwd_Ea[12] * invT);
+    k_f = k_f_s[12];
     dlnkfdT = fwd_beta[12] * invT + activation_units[12] * fwd_Ea[12] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[12] * exp(low_beta[12] * tc[0] - activation_units[12] * low_Ea[12] * invT);
@@ -26792,16 +26910,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[12] == 4 ? exp(-troe_Tss[12] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[12]) > 1.e-100 ? -Fcent1/troe_Tsss[12] : 0.)
+      + (fabs(troe_Ts[12]) > 1.e-100 ? -Fcent2/troe_Ts[12] : 0.)
+      + (troe_len[12] == 4 ? Fcent3*troe_Tss[12]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[12]) > 1.e-100 ? -Fcent1/troe_Tsss[12] : 0.)
-      + (fabs(troe_Ts[12]) > 1.e-100 ? -Fcent2/troe_Ts[12] : 0.)
-      + (troe_len[12] == 4 ? Fcent3*troe_Tss[12]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -26809,7 +26927,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[17];
-    Kc = refCinv * exp(g_RT[0] + g_RT[14] - g_RT[17]);
+    Kc = Kc_s[12];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[14]) + (h_RT[17]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26827,108 +26945,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[12][0] - 1)*dcdc_fac + k_f*sc[14];
-        J[0] -= dqdci;                /* dwdot[H2]/d[H2] */
-        J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
-        J[17] += dqdci;               /* dwdot[CH2O]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[12][1] - 1)*dcdc_fac;
-        J[270] -= dqdci;              /* dwdot[H2]/d[H2O] */
-        J[284] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[287] += dqdci;              /* dwdot[CH2O]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[12][2] - 1)*dcdc_fac;
-        J[702] -= dqdci;              /* dwdot[H2]/d[CH4] */
-        J[716] -= dqdci;              /* dwdot[CO]/d[CH4] */
-        J[719] += dqdci;              /* dwdot[CH2O]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[12][3] - 1)*dcdc_fac + k_f*sc[0];
-        J[756] -= dqdci;              /* dwdot[H2]/d[CO] */
-        J[770] -= dqdci;              /* dwdot[CO]/d[CO] */
-        J[773] += dqdci;              /* dwdot[CH2O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[12][4] - 1)*dcdc_fac;
-        J[810] -= dqdci;              /* dwdot[H2]/d[CO2] */
-        J[824] -= dqdci;              /* dwdot[CO]/d[CO2] */
-        J[827] += dqdci;              /* dwdot[CH2O]/d[CO2] */
-        /* d()/d[CH2O] */
-        dqdci =  - k_r;
-        J[918] -= dqdci;              /* dwdot[H2]/d[CH2O] */
-        J[932] -= dqdci;              /* dwdot[CO]/d[CH2O] */
-        J[935] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[12][5] - 1)*dcdc_fac;
-        J[1404] -= dqdci;             /* dwdot[H2]/d[C2H6] */
-        J[1418] -= dqdci;             /* dwdot[CO]/d[C2H6] */
-        J[1421] += dqdci;             /* dwdot[CH2O]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[12][6] - 1)*dcdc_fac;
-        J[2592] -= dqdci;             /* dwdot[H2]/d[AR] */
-        J[2606] -= dqdci;             /* dwdot[CO]/d[AR] */
-        J[2609] += dqdci;             /* dwdot[CH2O]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[12][0]*dcdc_fac + k_f*sc[14];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[12][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[12][2]*dcdc_fac;
-        dqdc[14] = TB[12][3]*dcdc_fac + k_f*sc[0];
-        dqdc[15] = TB[12][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac - k_r;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[12][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[12][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+0] -= dqdc[k];
-            J[54*k+14] -= dqdc[k];
-            J[54*k+17] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[14] -= dcdc_fac;
+    Jmix[17] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[12][0] - 1)*dcdc_fac + k_f*sc[14];
+    J[0] -= dqdci;                /* dwdot[H2]/d[H2] */
+    J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
+    J[17] += dqdci;               /* dwdot[CH2O]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[12][1] - 1)*dcdc_fac;
+    J[270] -= dqdci;              /* dwdot[H2]/d[H2O] */
+    J[284] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[287] += dqdci;              /* dwdot[CH2O]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[12][2] - 1)*dcdc_fac;
+    J[702] -= dqdci;              /* dwdot[H2]/d[CH4] */
+    J[716] -= dqdci;              /* dwdot[CO]/d[CH4] */
+    J[719] += dqdci;              /* dwdot[CH2O]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[12][3] - 1)*dcdc_fac + k_f*sc[0];
+    J[756] -= dqdci;              /* dwdot[H2]/d[CO] */
+    J[770] -= dqdci;              /* dwdot[CO]/d[CO] */
+    J[773] += dqdci;              /* dwdot[CH2O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[12][4] - 1)*dcdc_fac;
+    J[810] -= dqdci;              /* dwdot[H2]/d[CO2] */
+    J[824] -= dqdci;              /* dwdot[CO]/d[CO2] */
+    J[827] += dqdci;              /* dwdot[CH2O]/d[CO2] */
+    /* d()/d[CH2O] */
+    dqdci =  - k_r;
+    J[918] -= dqdci;              /* dwdot[H2]/d[CH2O] */
+    J[932] -= dqdci;              /* dwdot[CO]/d[CH2O] */
+    J[935] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[12][5] - 1)*dcdc_fac;
+    J[1404] -= dqdci;             /* dwdot[H2]/d[C2H6] */
+    J[1418] -= dqdci;             /* dwdot[CO]/d[C2H6] */
+    J[1421] += dqdci;             /* dwdot[CH2O]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[12][6] - 1)*dcdc_fac;
+    J[2592] -= dqdci;             /* dwdot[H2]/d[AR] */
+    J[2606] -= dqdci;             /* dwdot[CO]/d[AR] */
+    J[2609] += dqdci;             /* dwdot[CH2O]/d[AR] */
     J[2862] -= dqdT; /* dwdot[H2]/dT */
     J[2876] -= dqdT; /* dwdot[CO]/dT */
     J[2879] += dqdT; /* dwdot[CH2O]/dT */
@@ -26937,11 +26997,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[13][0] - 1)*sc[0] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[13] + (TB[13][3] - 1)*sc[14] + (TB[13][4] - 1)*sc[15] + (TB[13][5] - 1)*sc[26] + (TB[13][6] - 1)*sc[48];
+    alpha = (memcmp(TB[13], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[13][0] - 1)*sc[0] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[13] + (TB[13][3] - 1)*sc[14] + (TB[13][4] - 1)*sc[15] + (TB[13][5] - 1)*sc[26] + (TB[13][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[4]*sc[4];
-    k_f = prefactor_units[13] * fwd_A[13]
-                * exp(fwd_beta[13] * tc[0] - activation_units[13] * fwd_Ea[13] * invT);
+    k_f = k_f_s[13];
     dlnkfdT = fwd_beta[13] * invT + activation_units[13] * fwd_Ea[13] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[13] * exp(low_beta[13] * tc[0] - activation_units[13] * low_Ea[13] * invT);
@@ -26957,16 +27016,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[13] == 4 ? exp(-troe_Tss[13] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[13]) > 1.e-100 ? -Fcent1/troe_Tsss[13] : 0.)
+      + (fabs(troe_Ts[13]) > 1.e-100 ? -Fcent2/troe_Ts[13] : 0.)
+      + (troe_len[13] == 4 ? Fcent3*troe_Tss[13]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[13]) > 1.e-100 ? -Fcent1/troe_Tsss[13] : 0.)
-      + (fabs(troe_Ts[13]) > 1.e-100 ? -Fcent2/troe_Ts[13] : 0.)
-      + (troe_len[13] == 4 ? Fcent3*troe_Tss[13]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -26974,7 +27033,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[7];
-    Kc = refCinv * exp(2*g_RT[4] - g_RT[7]);
+    Kc = Kc_s[13];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[4]) + (h_RT[7]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26991,103 +27050,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[13][0] - 1)*dcdc_fac;
-        J[4] += -2 * dqdci;           /* dwdot[OH]/d[H2] */
-        J[7] += dqdci;                /* dwdot[H2O2]/d[H2] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*2*sc[4];
-        J[220] += -2 * dqdci;         /* dwdot[OH]/d[OH] */
-        J[223] += dqdci;              /* dwdot[H2O2]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[13][1] - 1)*dcdc_fac;
-        J[274] += -2 * dqdci;         /* dwdot[OH]/d[H2O] */
-        J[277] += dqdci;              /* dwdot[H2O2]/d[H2O] */
-        /* d()/d[H2O2] */
-        dqdci =  - k_r;
-        J[382] += -2 * dqdci;         /* dwdot[OH]/d[H2O2] */
-        J[385] += dqdci;              /* dwdot[H2O2]/d[H2O2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[13][2] - 1)*dcdc_fac;
-        J[706] += -2 * dqdci;         /* dwdot[OH]/d[CH4] */
-        J[709] += dqdci;              /* dwdot[H2O2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[13][3] - 1)*dcdc_fac;
-        J[760] += -2 * dqdci;         /* dwdot[OH]/d[CO] */
-        J[763] += dqdci;              /* dwdot[H2O2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[13][4] - 1)*dcdc_fac;
-        J[814] += -2 * dqdci;         /* dwdot[OH]/d[CO2] */
-        J[817] += dqdci;              /* dwdot[H2O2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[13][5] - 1)*dcdc_fac;
-        J[1408] += -2 * dqdci;        /* dwdot[OH]/d[C2H6] */
-        J[1411] += dqdci;             /* dwdot[H2O2]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[13][6] - 1)*dcdc_fac;
-        J[2596] += -2 * dqdci;        /* dwdot[OH]/d[AR] */
-        J[2599] += dqdci;             /* dwdot[H2O2]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[13][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac + k_f*2*sc[4];
-        dqdc[5] = TB[13][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac - k_r;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[13][2]*dcdc_fac;
-        dqdc[14] = TB[13][3]*dcdc_fac;
-        dqdc[15] = TB[13][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[13][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[13][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+4] += -2 * dqdc[k];
-            J[54*k+7] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[4] += -2 * dcdc_fac;
+    Jmix[7] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[13][0] - 1)*dcdc_fac;
+    J[4] += -2 * dqdci;           /* dwdot[OH]/d[H2] */
+    J[7] += dqdci;                /* dwdot[H2O2]/d[H2] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*2*sc[4];
+    J[220] += -2 * dqdci;         /* dwdot[OH]/d[OH] */
+    J[223] += dqdci;              /* dwdot[H2O2]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[13][1] - 1)*dcdc_fac;
+    J[274] += -2 * dqdci;         /* dwdot[OH]/d[H2O] */
+    J[277] += dqdci;              /* dwdot[H2O2]/d[H2O] */
+    /* d()/d[H2O2] */
+    dqdci =  - k_r;
+    J[382] += -2 * dqdci;         /* dwdot[OH]/d[H2O2] */
+    J[385] += dqdci;              /* dwdot[H2O2]/d[H2O2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[13][2] - 1)*dcdc_fac;
+    J[706] += -2 * dqdci;         /* dwdot[OH]/d[CH4] */
+    J[709] += dqdci;              /* dwdot[H2O2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[13][3] - 1)*dcdc_fac;
+    J[760] += -2 * dqdci;         /* dwdot[OH]/d[CO] */
+    J[763] += dqdci;              /* dwdot[H2O2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[13][4] - 1)*dcdc_fac;
+    J[814] += -2 * dqdci;         /* dwdot[OH]/d[CO2] */
+    J[817] += dqdci;              /* dwdot[H2O2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[13][5] - 1)*dcdc_fac;
+    J[1408] += -2 * dqdci;        /* dwdot[OH]/d[C2H6] */
+    J[1411] += dqdci;             /* dwdot[H2O2]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[13][6] - 1)*dcdc_fac;
+    J[2596] += -2 * dqdci;        /* dwdot[OH]/d[AR] */
+    J[2599] += dqdci;             /* dwdot[H2O2]/d[AR] */
     J[2866] += -2 * dqdT; /* dwdot[OH]/dT */
     J[2869] += dqdT; /* dwdot[H2O2]/dT */
 
@@ -27095,11 +27096,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[14][0] - 1)*sc[0] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[13] + (TB[14][3] - 1)*sc[14] + (TB[14][4] - 1)*sc[15] + (TB[14][5] - 1)*sc[26];
+    alpha = (memcmp(TB[14], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[14][0] - 1)*sc[0] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[13] + (TB[14][3] - 1)*sc[14] + (TB[14][4] - 1)*sc[15] + (TB[14][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[4]*sc[12];
-    k_f = prefactor_units[14] * fwd_A[14]
-                * exp(fwd_beta[14] * tc[0] - activation_units[14] * fwd_Ea[14] * invT);
+    k_f = k_f_s[14];
     dlnkfdT = fwd_beta[14] * invT + activation_units[14] * fwd_Ea[14] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[14] * exp(low_beta[14] * tc[0] - activation_units[14] * low_Ea[14] * invT);
@@ -27115,16 +27115,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[14] == 4 ? exp(-troe_Tss[14] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[14]) > 1.e-100 ? -Fcent1/troe_Tsss[14] : 0.)
+      + (fabs(troe_Ts[14]) > 1.e-100 ? -Fcent2/troe_Ts[14] : 0.)
+      + (troe_len[14] == 4 ? Fcent3*troe_Tss[14]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[14]) > 1.e-100 ? -Fcent1/troe_Tsss[14] : 0.)
-      + (fabs(troe_Ts[14]) > 1.e-100 ? -Fcent2/troe_Ts[14] : 0.)
-      + (troe_len[14] == 4 ? Fcent3*troe_Tss[14]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -27132,7 +27132,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[20];
-    Kc = refCinv * exp(g_RT[4] + g_RT[12] - g_RT[20]);
+    Kc = Kc_s[14];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[12]) + (h_RT[20]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27150,113 +27150,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[14][0] - 1)*dcdc_fac;
-        J[4] -= dqdci;                /* dwdot[OH]/d[H2] */
-        J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
-        J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*sc[12];
-        J[220] -= dqdci;              /* dwdot[OH]/d[OH] */
-        J[228] -= dqdci;              /* dwdot[CH3]/d[OH] */
-        J[236] += dqdci;              /* dwdot[CH3OH]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[14][1] - 1)*dcdc_fac;
-        J[274] -= dqdci;              /* dwdot[OH]/d[H2O] */
-        J[282] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[290] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[4];
-        J[652] -= dqdci;              /* dwdot[OH]/d[CH3] */
-        J[660] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[668] += dqdci;              /* dwdot[CH3OH]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[14][2] - 1)*dcdc_fac;
-        J[706] -= dqdci;              /* dwdot[OH]/d[CH4] */
-        J[714] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[722] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[14][3] - 1)*dcdc_fac;
-        J[760] -= dqdci;              /* dwdot[OH]/d[CO] */
-        J[768] -= dqdci;              /* dwdot[CH3]/d[CO] */
-        J[776] += dqdci;              /* dwdot[CH3OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[14][4] - 1)*dcdc_fac;
-        J[814] -= dqdci;              /* dwdot[OH]/d[CO2] */
-        J[822] -= dqdci;              /* dwdot[CH3]/d[CO2] */
-        J[830] += dqdci;              /* dwdot[CH3OH]/d[CO2] */
-        /* d()/d[CH3OH] */
-        dqdci =  - k_r;
-        J[1084] -= dqdci;             /* dwdot[OH]/d[CH3OH] */
-        J[1092] -= dqdci;             /* dwdot[CH3]/d[CH3OH] */
-        J[1100] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[14][5] - 1)*dcdc_fac;
-        J[1408] -= dqdci;             /* dwdot[OH]/d[C2H6] */
-        J[1416] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
-        J[1424] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[14][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac + k_f*sc[12];
-        dqdc[5] = TB[14][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*sc[4];
-        dqdc[13] = TB[14][2]*dcdc_fac;
-        dqdc[14] = TB[14][3]*dcdc_fac;
-        dqdc[15] = TB[14][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac - k_r;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[14][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+4] -= dqdc[k];
-            J[54*k+12] -= dqdc[k];
-            J[54*k+20] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[4] -= dcdc_fac;
+    Jmix[12] -= dcdc_fac;
+    Jmix[20] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[14][0] - 1)*dcdc_fac;
+    J[4] -= dqdci;                /* dwdot[OH]/d[H2] */
+    J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
+    J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*sc[12];
+    J[220] -= dqdci;              /* dwdot[OH]/d[OH] */
+    J[228] -= dqdci;              /* dwdot[CH3]/d[OH] */
+    J[236] += dqdci;              /* dwdot[CH3OH]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[14][1] - 1)*dcdc_fac;
+    J[274] -= dqdci;              /* dwdot[OH]/d[H2O] */
+    J[282] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[290] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[4];
+    J[652] -= dqdci;              /* dwdot[OH]/d[CH3] */
+    J[660] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[668] += dqdci;              /* dwdot[CH3OH]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[14][2] - 1)*dcdc_fac;
+    J[706] -= dqdci;              /* dwdot[OH]/d[CH4] */
+    J[714] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[722] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[14][3] - 1)*dcdc_fac;
+    J[760] -= dqdci;              /* dwdot[OH]/d[CO] */
+    J[768] -= dqdci;              /* dwdot[CH3]/d[CO] */
+    J[776] += dqdci;              /* dwdot[CH3OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[14][4] - 1)*dcdc_fac;
+    J[814] -= dqdci;              /* dwdot[OH]/d[CO2] */
+    J[822] -= dqdci;              /* dwdot[CH3]/d[CO2] */
+    J[830] += dqdci;              /* dwdot[CH3OH]/d[CO2] */
+    /* d()/d[CH3OH] */
+    dqdci =  - k_r;
+    J[1084] -= dqdci;             /* dwdot[OH]/d[CH3OH] */
+    J[1092] -= dqdci;             /* dwdot[CH3]/d[CH3OH] */
+    J[1100] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[14][5] - 1)*dcdc_fac;
+    J[1408] -= dqdci;             /* dwdot[OH]/d[C2H6] */
+    J[1416] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
+    J[1424] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
     J[2866] -= dqdT; /* dwdot[OH]/dT */
     J[2874] -= dqdT; /* dwdot[CH3]/dT */
     J[2882] += dqdT; /* dwdot[CH3OH]/dT */
@@ -27265,11 +27207,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[15][0] - 1)*sc[0] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[13] + (TB[15][3] - 1)*sc[14] + (TB[15][4] - 1)*sc[15] + (TB[15][5] - 1)*sc[26] + (TB[15][6] - 1)*sc[48];
+    alpha = (memcmp(TB[15], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[15][0] - 1)*sc[0] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[13] + (TB[15][3] - 1)*sc[14] + (TB[15][4] - 1)*sc[15] + (TB[15][5] - 1)*sc[26] + (TB[15][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[9]*sc[14];
-    k_f = prefactor_units[15] * fwd_A[15]
-                * exp(fwd_beta[15] * tc[0] - activation_units[15] * fwd_Ea[15] * invT);
+    k_f = k_f_s[15];
     dlnkfdT = fwd_beta[15] * invT + activation_units[15] * fwd_Ea[15] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[15] * exp(low_beta[15] * tc[0] - activation_units[15] * low_Ea[15] * invT);
@@ -27285,16 +27226,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[15] == 4 ? exp(-troe_Tss[15] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[15]) > 1.e-100 ? -Fcent1/troe_Tsss[15] : 0.)
+      + (fabs(troe_Ts[15]) > 1.e-100 ? -Fcent2/troe_Ts[15] : 0.)
+      + (troe_len[15] == 4 ? Fcent3*troe_Tss[15]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[15]) > 1.e-100 ? -Fcent1/troe_Tsss[15] : 0.)
-      + (fabs(troe_Ts[15]) > 1.e-100 ? -Fcent2/troe_Ts[15] : 0.)
-      + (troe_len[15] == 4 ? Fcent3*troe_Tss[15]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -27302,7 +27243,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[27];
-    Kc = refCinv * exp(g_RT[9] + g_RT[14] - g_RT[27]);
+    Kc = Kc_s[15];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[14]) + (h_RT[27]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27320,113 +27261,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[15][0] - 1)*dcdc_fac;
-        J[9] -= dqdci;                /* dwdot[CH]/d[H2] */
-        J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
-        J[27] += dqdci;               /* dwdot[HCCO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[15][1] - 1)*dcdc_fac;
-        J[279] -= dqdci;              /* dwdot[CH]/d[H2O] */
-        J[284] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[297] += dqdci;              /* dwdot[HCCO]/d[H2O] */
-        /* d()/d[CH] */
-        dqdci =  + k_f*sc[14];
-        J[495] -= dqdci;              /* dwdot[CH]/d[CH] */
-        J[500] -= dqdci;              /* dwdot[CO]/d[CH] */
-        J[513] += dqdci;              /* dwdot[HCCO]/d[CH] */
-        /* d()/d[CH4] */
-        dqdci = (TB[15][2] - 1)*dcdc_fac;
-        J[711] -= dqdci;              /* dwdot[CH]/d[CH4] */
-        J[716] -= dqdci;              /* dwdot[CO]/d[CH4] */
-        J[729] += dqdci;              /* dwdot[HCCO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[15][3] - 1)*dcdc_fac + k_f*sc[9];
-        J[765] -= dqdci;              /* dwdot[CH]/d[CO] */
-        J[770] -= dqdci;              /* dwdot[CO]/d[CO] */
-        J[783] += dqdci;              /* dwdot[HCCO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[15][4] - 1)*dcdc_fac;
-        J[819] -= dqdci;              /* dwdot[CH]/d[CO2] */
-        J[824] -= dqdci;              /* dwdot[CO]/d[CO2] */
-        J[837] += dqdci;              /* dwdot[HCCO]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[15][5] - 1)*dcdc_fac;
-        J[1413] -= dqdci;             /* dwdot[CH]/d[C2H6] */
-        J[1418] -= dqdci;             /* dwdot[CO]/d[C2H6] */
-        J[1431] += dqdci;             /* dwdot[HCCO]/d[C2H6] */
-        /* d()/d[HCCO] */
-        dqdci =  - k_r;
-        J[1467] -= dqdci;             /* dwdot[CH]/d[HCCO] */
-        J[1472] -= dqdci;             /* dwdot[CO]/d[HCCO] */
-        J[1485] += dqdci;             /* dwdot[HCCO]/d[HCCO] */
-        /* d()/d[AR] */
-        dqdci = (TB[15][6] - 1)*dcdc_fac;
-        J[2601] -= dqdci;             /* dwdot[CH]/d[AR] */
-        J[2606] -= dqdci;             /* dwdot[CO]/d[AR] */
-        J[2619] += dqdci;             /* dwdot[HCCO]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[15][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[15][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac + k_f*sc[14];
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[15][2]*dcdc_fac;
-        dqdc[14] = TB[15][3]*dcdc_fac + k_f*sc[9];
-        dqdc[15] = TB[15][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[15][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac - k_r;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[15][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+9] -= dqdc[k];
-            J[54*k+14] -= dqdc[k];
-            J[54*k+27] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[9] -= dcdc_fac;
+    Jmix[14] -= dcdc_fac;
+    Jmix[27] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[15][0] - 1)*dcdc_fac;
+    J[9] -= dqdci;                /* dwdot[CH]/d[H2] */
+    J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
+    J[27] += dqdci;               /* dwdot[HCCO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[15][1] - 1)*dcdc_fac;
+    J[279] -= dqdci;              /* dwdot[CH]/d[H2O] */
+    J[284] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[297] += dqdci;              /* dwdot[HCCO]/d[H2O] */
+    /* d()/d[CH] */
+    dqdci =  + k_f*sc[14];
+    J[495] -= dqdci;              /* dwdot[CH]/d[CH] */
+    J[500] -= dqdci;              /* dwdot[CO]/d[CH] */
+    J[513] += dqdci;              /* dwdot[HCCO]/d[CH] */
+    /* d()/d[CH4] */
+    dqdci = (TB[15][2] - 1)*dcdc_fac;
+    J[711] -= dqdci;              /* dwdot[CH]/d[CH4] */
+    J[716] -= dqdci;              /* dwdot[CO]/d[CH4] */
+    J[729] += dqdci;              /* dwdot[HCCO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[15][3] - 1)*dcdc_fac + k_f*sc[9];
+    J[765] -= dqdci;              /* dwdot[CH]/d[CO] */
+    J[770] -= dqdci;              /* dwdot[CO]/d[CO] */
+    J[783] += dqdci;              /* dwdot[HCCO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[15][4] - 1)*dcdc_fac;
+    J[819] -= dqdci;              /* dwdot[CH]/d[CO2] */
+    J[824] -= dqdci;              /* dwdot[CO]/d[CO2] */
+    J[837] += dqdci;              /* dwdot[HCCO]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[15][5] - 1)*dcdc_fac;
+    J[1413] -= dqdci;             /* dwdot[CH]/d[C2H6] */
+    J[1418] -= dqdci;             /* dwdot[CO]/d[C2H6] */
+    J[1431] += dqdci;             /* dwdot[HCCO]/d[C2H6] */
+    /* d()/d[HCCO] */
+    dqdci =  - k_r;
+    J[1467] -= dqdci;             /* dwdot[CH]/d[HCCO] */
+    J[1472] -= dqdci;             /* dwdot[CO]/d[HCCO] */
+    J[1485] += dqdci;             /* dwdot[HCCO]/d[HCCO] */
+    /* d()/d[AR] */
+    dqdci = (TB[15][6] - 1)*dcdc_fac;
+    J[2601] -= dqdci;             /* dwdot[CH]/d[AR] */
+    J[2606] -= dqdci;             /* dwdot[CO]/d[AR] */
+    J[2619] += dqdci;             /* dwdot[HCCO]/d[AR] */
     J[2871] -= dqdT; /* dwdot[CH]/dT */
     J[2876] -= dqdT; /* dwdot[CO]/dT */
     J[2889] += dqdT; /* dwdot[HCCO]/dT */
@@ -27435,11 +27318,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[16][0] - 1)*sc[0] + (TB[16][1] - 1)*sc[5] + (TB[16][2] - 1)*sc[13] + (TB[16][3] - 1)*sc[14] + (TB[16][4] - 1)*sc[15] + (TB[16][5] - 1)*sc[26] + (TB[16][6] - 1)*sc[48];
+    alpha = (memcmp(TB[16], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[16][0] - 1)*sc[0] + (TB[16][1] - 1)*sc[5] + (TB[16][2] - 1)*sc[13] + (TB[16][3] - 1)*sc[14] + (TB[16][4] - 1)*sc[15] + (TB[16][5] - 1)*sc[26] + (TB[16][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[10]*sc[14];
-    k_f = prefactor_units[16] * fwd_A[16]
-                * exp(fwd_beta[16] * tc[0] - activation_units[16] * fwd_Ea[16] * invT);
+    k_f = k_f_s[16];
     dlnkfdT = fwd_beta[16] * invT + activation_units[16] * fwd_Ea[16] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[16] * exp(low_beta[16] * tc[0] - activation_units[16] * low_Ea[16] * invT);
@@ -27455,16 +27337,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[16] == 4 ? exp(-troe_Tss[16] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
-    troe_c = -.4 - .67 * logFcent;
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[16]) > 1.e-100 ? -Fcent1/troe_Tsss[16] : 0.)
+      + (fabs(troe_Ts[16]) > 1.e-100 ? -Fcent2/troe_Ts[16] : 0.)
+      + (troe_len[16] == 4 ? Fcent3*troe_Tss[16]*invT2 : 0.) );
+    troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[16]) > 1.e-100 ? -Fcent1/troe_Tsss[16] : 0.)
-      + (fabs(troe_Ts[16]) > 1.e-100 ? -Fcent2/troe_Ts[16] : 0.)
-      + (troe_len[16] == 4 ? Fcent3*troe_Tss[16]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -27472,7 +27354,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[28];
-    Kc = refCinv * exp(g_RT[10] + g_RT[14] - g_RT[28]);
+    Kc = Kc_s[16];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[14]) + (h_RT[28]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27490,113 +27372,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[16][0] - 1)*dcdc_fac;
-        J[10] -= dqdci;               /* dwdot[CH2]/d[H2] */
-        J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
-        J[28] += dqdci;               /* dwdot[CH2CO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[16][1] - 1)*dcdc_fac;
-        J[280] -= dqdci;              /* dwdot[CH2]/d[H2O] */
-        J[284] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[298] += dqdci;              /* dwdot[CH2CO]/d[H2O] */
-        /* d()/d[CH2] */
-        dqdci =  + k_f*sc[14];
-        J[550] -= dqdci;              /* dwdot[CH2]/d[CH2] */
-        J[554] -= dqdci;              /* dwdot[CO]/d[CH2] */
-        J[568] += dqdci;              /* dwdot[CH2CO]/d[CH2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[16][2] - 1)*dcdc_fac;
-        J[712] -= dqdci;              /* dwdot[CH2]/d[CH4] */
-        J[716] -= dqdci;              /* dwdot[CO]/d[CH4] */
-        J[730] += dqdci;              /* dwdot[CH2CO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[16][3] - 1)*dcdc_fac + k_f*sc[10];
-        J[766] -= dqdci;              /* dwdot[CH2]/d[CO] */
-        J[770] -= dqdci;              /* dwdot[CO]/d[CO] */
-        J[784] += dqdci;              /* dwdot[CH2CO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[16][4] - 1)*dcdc_fac;
-        J[820] -= dqdci;              /* dwdot[CH2]/d[CO2] */
-        J[824] -= dqdci;              /* dwdot[CO]/d[CO2] */
-        J[838] += dqdci;              /* dwdot[CH2CO]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[16][5] - 1)*dcdc_fac;
-        J[1414] -= dqdci;             /* dwdot[CH2]/d[C2H6] */
-        J[1418] -= dqdci;             /* dwdot[CO]/d[C2H6] */
-        J[1432] += dqdci;             /* dwdot[CH2CO]/d[C2H6] */
-        /* d()/d[CH2CO] */
-        dqdci =  - k_r;
-        J[1522] -= dqdci;             /* dwdot[CH2]/d[CH2CO] */
-        J[1526] -= dqdci;             /* dwdot[CO]/d[CH2CO] */
-        J[1540] += dqdci;             /* dwdot[CH2CO]/d[CH2CO] */
-        /* d()/d[AR] */
-        dqdci = (TB[16][6] - 1)*dcdc_fac;
-        J[2602] -= dqdci;             /* dwdot[CH2]/d[AR] */
-        J[2606] -= dqdci;             /* dwdot[CO]/d[AR] */
-        J[2620] += dqdci;             /* dwdot[CH2CO]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[16][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[16][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac + k_f*sc[14];
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[16][2]*dcdc_fac;
-        dqdc[14] = TB[16][3]*dcdc_fac + k_f*sc[10];
-        dqdc[15] = TB[16][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[16][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac - k_r;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[16][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+10] -= dqdc[k];
-            J[54*k+14] -= dqdc[k];
-            J[54*k+28] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[10] -= dcdc_fac;
+    Jmix[14] -= dcdc_fac;
+    Jmix[28] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[16][0] - 1)*dcdc_fac;
+    J[10] -= dqdci;               /* dwdot[CH2]/d[H2] */
+    J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
+    J[28] += dqdci;               /* dwdot[CH2CO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[16][1] - 1)*dcdc_fac;
+    J[280] -= dqdci;              /* dwdot[CH2]/d[H2O] */
+    J[284] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[298] += dqdci;              /* dwdot[CH2CO]/d[H2O] */
+    /* d()/d[CH2] */
+    dqdci =  + k_f*sc[14];
+    J[550] -= dqdci;              /* dwdot[CH2]/d[CH2] */
+    J[554] -= dqdci;              /* dwdot[CO]/d[CH2] */
+    J[568] += dqdci;              /* dwdot[CH2CO]/d[CH2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[16][2] - 1)*dcdc_fac;
+    J[712] -= dqdci;              /* dwdot[CH2]/d[CH4] */
+    J[716] -= dqdci;              /* dwdot[CO]/d[CH4] */
+    J[730] += dqdci;              /* dwdot[CH2CO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[16][3] - 1)*dcdc_fac + k_f*sc[10];
+    J[766] -= dqdci;              /* dwdot[CH2]/d[CO] */
+    J[770] -= dqdci;              /* dwdot[CO]/d[CO] */
+    J[784] += dqdci;              /* dwdot[CH2CO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[16][4] - 1)*dcdc_fac;
+    J[820] -= dqdci;              /* dwdot[CH2]/d[CO2] */
+    J[824] -= dqdci;              /* dwdot[CO]/d[CO2] */
+    J[838] += dqdci;              /* dwdot[CH2CO]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[16][5] - 1)*dcdc_fac;
+    J[1414] -= dqdci;             /* dwdot[CH2]/d[C2H6] */
+    J[1418] -= dqdci;             /* dwdot[CO]/d[C2H6] */
+    J[1432] += dqdci;             /* dwdot[CH2CO]/d[C2H6] */
+    /* d()/d[CH2CO] */
+    dqdci =  - k_r;
+    J[1522] -= dqdci;             /* dwdot[CH2]/d[CH2CO] */
+    J[1526] -= dqdci;             /* dwdot[CO]/d[CH2CO] */
+    J[1540] += dqdci;             /* dwdot[CH2CO]/d[CH2CO] */
+    /* d()/d[AR] */
+    dqdci = (TB[16][6] - 1)*dcdc_fac;
+    J[2602] -= dqdci;             /* dwdot[CH2]/d[AR] */
+    J[2606] -= dqdci;             /* dwdot[CO]/d[AR] */
+    J[2620] += dqdci;             /* dwdot[CH2CO]/d[AR] */
     J[2872] -= dqdT; /* dwdot[CH2]/dT */
     J[2876] -= dqdT; /* dwdot[CO]/dT */
     J[2890] += dqdT; /* dwdot[CH2CO]/dT */
@@ -27605,11 +27429,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[17][0] - 1)*sc[0] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[13] + (TB[17][3] - 1)*sc[14] + (TB[17][4] - 1)*sc[15] + (TB[17][5] - 1)*sc[26];
+    alpha = (memcmp(TB[17], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[17][0] - 1)*sc[0] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[13] + (TB[17][3] - 1)*sc[14] + (TB[17][4] - 1)*sc[15] + (TB[17][5] - 1)*sc[26]);
     /* forward */
     phi_f = sc[5]*sc[11];
-    k_f = prefactor_units[17] * fwd_A[17]
-                * exp(fwd_beta[17] * tc[0] - activation_units[17] * fwd_Ea[17] * invT);
+    k_f = k_f_s[17];
     dlnkfdT = fwd_beta[17] * invT + activation_units[17] * fwd_Ea[17] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[17] * exp(low_beta[17] * tc[0] - activation_units[17] * low_Ea[17] * invT);
@@ -27625,16 +27448,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[17] == 4 ? exp(-troe_Tss[17] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[17]) > 1.e-100 ? -Fcent1/troe_Tsss[17] : 0.)
+      + (fabs(troe_Ts[17]) > 1.e-100 ? -Fcent2/troe_Ts[17] : 0.)
+      + (troe_len[17] == 4 ? Fcent3*troe_Tss[17]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[17]) > 1.e-100 ? -Fcent1/troe_Tsss[17] : 0.)
-      + (fabs(troe_Ts[17]) > 1.e-100 ? -Fcent2/troe_Ts[17] : 0.)
-      + (troe_len[17] == 4 ? Fcent3*troe_Tss[17]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -27642,7 +27465,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[20];
-    Kc = refCinv * exp(g_RT[5] + g_RT[11] - g_RT[20]);
+    Kc = Kc_s[17];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[11]) + (h_RT[20]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27660,108 +27483,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[17][0] - 1)*dcdc_fac;
-        J[5] -= dqdci;                /* dwdot[H2O]/d[H2] */
-        J[11] -= dqdci;               /* dwdot[CH2(S)]/d[H2] */
-        J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[17][1] - 1)*dcdc_fac + k_f*sc[11];
-        J[275] -= dqdci;              /* dwdot[H2O]/d[H2O] */
-        J[281] -= dqdci;              /* dwdot[CH2(S)]/d[H2O] */
-        J[290] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
-        /* d()/d[CH2(S)] */
-        dqdci =  + k_f*sc[5];
-        J[599] -= dqdci;              /* dwdot[H2O]/d[CH2(S)] */
-        J[605] -= dqdci;              /* dwdot[CH2(S)]/d[CH2(S)] */
-        J[614] += dqdci;              /* dwdot[CH3OH]/d[CH2(S)] */
-        /* d()/d[CH4] */
-        dqdci = (TB[17][2] - 1)*dcdc_fac;
-        J[707] -= dqdci;              /* dwdot[H2O]/d[CH4] */
-        J[713] -= dqdci;              /* dwdot[CH2(S)]/d[CH4] */
-        J[722] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[17][3] - 1)*dcdc_fac;
-        J[761] -= dqdci;              /* dwdot[H2O]/d[CO] */
-        J[767] -= dqdci;              /* dwdot[CH2(S)]/d[CO] */
-        J[776] += dqdci;              /* dwdot[CH3OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[17][4] - 1)*dcdc_fac;
-        J[815] -= dqdci;              /* dwdot[H2O]/d[CO2] */
-        J[821] -= dqdci;              /* dwdot[CH2(S)]/d[CO2] */
-        J[830] += dqdci;              /* dwdot[CH3OH]/d[CO2] */
-        /* d()/d[CH3OH] */
-        dqdci =  - k_r;
-        J[1085] -= dqdci;             /* dwdot[H2O]/d[CH3OH] */
-        J[1091] -= dqdci;             /* dwdot[CH2(S)]/d[CH3OH] */
-        J[1100] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[17][5] - 1)*dcdc_fac;
-        J[1409] -= dqdci;             /* dwdot[H2O]/d[C2H6] */
-        J[1415] -= dqdci;             /* dwdot[CH2(S)]/d[C2H6] */
-        J[1424] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[17][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[17][1]*dcdc_fac + k_f*sc[11];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac + k_f*sc[5];
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[17][2]*dcdc_fac;
-        dqdc[14] = TB[17][3]*dcdc_fac;
-        dqdc[15] = TB[17][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac - k_r;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[17][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+5] -= dqdc[k];
-            J[54*k+11] -= dqdc[k];
-            J[54*k+20] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[5] -= dcdc_fac;
+    Jmix[11] -= dcdc_fac;
+    Jmix[20] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[17][0] - 1)*dcdc_fac;
+    J[5] -= dqdci;                /* dwdot[H2O]/d[H2] */
+    J[11] -= dqdci;               /* dwdot[CH2(S)]/d[H2] */
+    J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[17][1] - 1)*dcdc_fac + k_f*sc[11];
+    J[275] -= dqdci;              /* dwdot[H2O]/d[H2O] */
+    J[281] -= dqdci;              /* dwdot[CH2(S)]/d[H2O] */
+    J[290] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
+    /* d()/d[CH2(S)] */
+    dqdci =  + k_f*sc[5];
+    J[599] -= dqdci;              /* dwdot[H2O]/d[CH2(S)] */
+    J[605] -= dqdci;              /* dwdot[CH2(S)]/d[CH2(S)] */
+    J[614] += dqdci;              /* dwdot[CH3OH]/d[CH2(S)] */
+    /* d()/d[CH4] */
+    dqdci = (TB[17][2] - 1)*dcdc_fac;
+    J[707] -= dqdci;              /* dwdot[H2O]/d[CH4] */
+    J[713] -= dqdci;              /* dwdot[CH2(S)]/d[CH4] */
+    J[722] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[17][3] - 1)*dcdc_fac;
+    J[761] -= dqdci;              /* dwdot[H2O]/d[CO] */
+    J[767] -= dqdci;              /* dwdot[CH2(S)]/d[CO] */
+    J[776] += dqdci;              /* dwdot[CH3OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[17][4] - 1)*dcdc_fac;
+    J[815] -= dqdci;              /* dwdot[H2O]/d[CO2] */
+    J[821] -= dqdci;              /* dwdot[CH2(S)]/d[CO2] */
+    J[830] += dqdci;              /* dwdot[CH3OH]/d[CO2] */
+    /* d()/d[CH3OH] */
+    dqdci =  - k_r;
+    J[1085] -= dqdci;             /* dwdot[H2O]/d[CH3OH] */
+    J[1091] -= dqdci;             /* dwdot[CH2(S)]/d[CH3OH] */
+    J[1100] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[17][5] - 1)*dcdc_fac;
+    J[1409] -= dqdci;             /* dwdot[H2O]/d[C2H6] */
+    J[1415] -= dqdci;             /* dwdot[CH2(S)]/d[C2H6] */
+    J[1424] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
     J[2867] -= dqdT; /* dwdot[H2O]/dT */
     J[2873] -= dqdT; /* dwdot[CH2(S)]/dT */
     J[2882] += dqdT; /* dwdot[CH3OH]/dT */
@@ -27770,11 +27535,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[18][0] - 1)*sc[0] + (TB[18][1] - 1)*sc[5] + (TB[18][2] - 1)*sc[13] + (TB[18][3] - 1)*sc[14] + (TB[18][4] - 1)*sc[15] + (TB[18][5] - 1)*sc[26] + (TB[18][6] - 1)*sc[48];
+    alpha = (memcmp(TB[18], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[18][0] - 1)*sc[0] + (TB[18][1] - 1)*sc[5] + (TB[18][2] - 1)*sc[13] + (TB[18][3] - 1)*sc[14] + (TB[18][4] - 1)*sc[15] + (TB[18][5] - 1)*sc[26] + (TB[18][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[12]*sc[12];
-    k_f = prefactor_units[18] * fwd_A[18]
-                * exp(fwd_beta[18] * tc[0] - activation_units[18] * fwd_Ea[18] * invT);
+    k_f = k_f_s[18];
     dlnkfdT = fwd_beta[18] * invT + activation_units[18] * fwd_Ea[18] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[18] * exp(low_beta[18] * tc[0] - activation_units[18] * low_Ea[18] * invT);
@@ -27790,16 +27554,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[18] == 4 ? exp(-troe_Tss[18] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[18]) > 1.e-100 ? -Fcent1/troe_Tsss[18] : 0.)
+      + (fabs(troe_Ts[18]) > 1.e-100 ? -Fcent2/troe_Ts[18] : 0.)
+      + (troe_len[18] == 4 ? Fcent3*troe_Tss[18]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[18]) > 1.e-100 ? -Fcent1/troe_Tsss[18] : 0.)
-      + (fabs(troe_Ts[18]) > 1.e-100 ? -Fcent2/troe_Ts[18] : 0.)
-      + (troe_len[18] == 4 ? Fcent3*troe_Tss[18]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -27807,7 +27571,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[26];
-    Kc = refCinv * exp(2*g_RT[12] - g_RT[26]);
+    Kc = Kc_s[18];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[12]) + (h_RT[26]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27824,99 +27588,41 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[18][0] - 1)*dcdc_fac;
-        J[12] += -2 * dqdci;          /* dwdot[CH3]/d[H2] */
-        J[26] += dqdci;               /* dwdot[C2H6]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[18][1] - 1)*dcdc_fac;
-        J[282] += -2 * dqdci;         /* dwdot[CH3]/d[H2O] */
-        J[296] += dqdci;              /* dwdot[C2H6]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*2*sc[12];
-        J[660] += -2 * dqdci;         /* dwdot[CH3]/d[CH3] */
-        J[674] += dqdci;              /* dwdot[C2H6]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[18][2] - 1)*dcdc_fac;
-        J[714] += -2 * dqdci;         /* dwdot[CH3]/d[CH4] */
-        J[728] += dqdci;              /* dwdot[C2H6]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[18][3] - 1)*dcdc_fac;
-        J[768] += -2 * dqdci;         /* dwdot[CH3]/d[CO] */
-        J[782] += dqdci;              /* dwdot[C2H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[18][4] - 1)*dcdc_fac;
-        J[822] += -2 * dqdci;         /* dwdot[CH3]/d[CO2] */
-        J[836] += dqdci;              /* dwdot[C2H6]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[18][5] - 1)*dcdc_fac - k_r;
-        J[1416] += -2 * dqdci;        /* dwdot[CH3]/d[C2H6] */
-        J[1430] += dqdci;             /* dwdot[C2H6]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[18][6] - 1)*dcdc_fac;
-        J[2604] += -2 * dqdci;        /* dwdot[CH3]/d[AR] */
-        J[2618] += dqdci;             /* dwdot[C2H6]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[18][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[18][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*2*sc[12];
-        dqdc[13] = TB[18][2]*dcdc_fac;
-        dqdc[14] = TB[18][3]*dcdc_fac;
-        dqdc[15] = TB[18][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[18][5]*dcdc_fac - k_r;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[18][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+12] += -2 * dqdc[k];
-            J[54*k+26] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[12] += -2 * dcdc_fac;
+    Jmix[26] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[18][0] - 1)*dcdc_fac;
+    J[12] += -2 * dqdci;          /* dwdot[CH3]/d[H2] */
+    J[26] += dqdci;               /* dwdot[C2H6]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[18][1] - 1)*dcdc_fac;
+    J[282] += -2 * dqdci;         /* dwdot[CH3]/d[H2O] */
+    J[296] += dqdci;              /* dwdot[C2H6]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*2*sc[12];
+    J[660] += -2 * dqdci;         /* dwdot[CH3]/d[CH3] */
+    J[674] += dqdci;              /* dwdot[C2H6]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[18][2] - 1)*dcdc_fac;
+    J[714] += -2 * dqdci;         /* dwdot[CH3]/d[CH4] */
+    J[728] += dqdci;              /* dwdot[C2H6]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[18][3] - 1)*dcdc_fac;
+    J[768] += -2 * dqdci;         /* dwdot[CH3]/d[CO] */
+    J[782] += dqdci;              /* dwdot[C2H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[18][4] - 1)*dcdc_fac;
+    J[822] += -2 * dqdci;         /* dwdot[CH3]/d[CO2] */
+    J[836] += dqdci;              /* dwdot[C2H6]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[18][5] - 1)*dcdc_fac - k_r;
+    J[1416] += -2 * dqdci;        /* dwdot[CH3]/d[C2H6] */
+    J[1430] += dqdci;             /* dwdot[C2H6]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[18][6] - 1)*dcdc_fac;
+    J[2604] += -2 * dqdci;        /* dwdot[CH3]/d[AR] */
+    J[2618] += dqdci;             /* dwdot[C2H6]/d[AR] */
     J[2874] += -2 * dqdT; /* dwdot[CH3]/dT */
     J[2888] += dqdT; /* dwdot[C2H6]/dT */
 
@@ -27924,11 +27630,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[19][0] - 1)*sc[0] + (TB[19][1] - 1)*sc[5] + (TB[19][2] - 1)*sc[13] + (TB[19][3] - 1)*sc[14] + (TB[19][4] - 1)*sc[15] + (TB[19][5] - 1)*sc[26] + (TB[19][6] - 1)*sc[48];
+    alpha = (memcmp(TB[19], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[19][0] - 1)*sc[0] + (TB[19][1] - 1)*sc[5] + (TB[19][2] - 1)*sc[13] + (TB[19][3] - 1)*sc[14] + (TB[19][4] - 1)*sc[15] + (TB[19][5] - 1)*sc[26] + (TB[19][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[24];
-    k_f = prefactor_units[19] * fwd_A[19]
-                * exp(fwd_beta[19] * tc[0] - activation_units[19] * fwd_Ea[19] * invT);
+    k_f = k_f_s[19];
     dlnkfdT = fwd_beta[19] * invT + activation_units[19] * fwd_Ea[19] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[19] * exp(low_beta[19] * tc[0] - activation_units[19] * low_Ea[19] * invT);
@@ -27944,16 +27649,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[19] == 4 ? exp(-troe_Tss[19] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[19]) > 1.e-100 ? -Fcent1/troe_Tsss[19] : 0.)
+      + (fabs(troe_Ts[19]) > 1.e-100 ? -Fcent2/troe_Ts[19] : 0.)
+      + (troe_len[19] == 4 ? Fcent3*troe_Tss[19]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[19]) > 1.e-100 ? -Fcent1/troe_Tsss[19] : 0.)
-      + (fabs(troe_Ts[19]) > 1.e-100 ? -Fcent2/troe_Ts[19] : 0.)
-      + (troe_len[19] == 4 ? Fcent3*troe_Tss[19]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -27961,7 +27666,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[0]*sc[22];
-    Kc = refC * exp(-g_RT[0] - g_RT[22] + g_RT[24]);
+    Kc = Kc_s[19];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[24]) + (h_RT[0] + h_RT[22]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27979,113 +27684,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[19][0] - 1)*dcdc_fac - k_r*sc[22];
-        J[0] += dqdci;                /* dwdot[H2]/d[H2] */
-        J[22] += dqdci;               /* dwdot[C2H2]/d[H2] */
-        J[24] -= dqdci;               /* dwdot[C2H4]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[19][1] - 1)*dcdc_fac;
-        J[270] += dqdci;              /* dwdot[H2]/d[H2O] */
-        J[292] += dqdci;              /* dwdot[C2H2]/d[H2O] */
-        J[294] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[19][2] - 1)*dcdc_fac;
-        J[702] += dqdci;              /* dwdot[H2]/d[CH4] */
-        J[724] += dqdci;              /* dwdot[C2H2]/d[CH4] */
-        J[726] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[19][3] - 1)*dcdc_fac;
-        J[756] += dqdci;              /* dwdot[H2]/d[CO] */
-        J[778] += dqdci;              /* dwdot[C2H2]/d[CO] */
-        J[780] -= dqdci;              /* dwdot[C2H4]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[19][4] - 1)*dcdc_fac;
-        J[810] += dqdci;              /* dwdot[H2]/d[CO2] */
-        J[832] += dqdci;              /* dwdot[C2H2]/d[CO2] */
-        J[834] -= dqdci;              /* dwdot[C2H4]/d[CO2] */
-        /* d()/d[C2H2] */
-        dqdci =  - k_r*sc[0];
-        J[1188] += dqdci;             /* dwdot[H2]/d[C2H2] */
-        J[1210] += dqdci;             /* dwdot[C2H2]/d[C2H2] */
-        J[1212] -= dqdci;             /* dwdot[C2H4]/d[C2H2] */
-        /* d()/d[C2H4] */
-        dqdci =  + k_f;
-        J[1296] += dqdci;             /* dwdot[H2]/d[C2H4] */
-        J[1318] += dqdci;             /* dwdot[C2H2]/d[C2H4] */
-        J[1320] -= dqdci;             /* dwdot[C2H4]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[19][5] - 1)*dcdc_fac;
-        J[1404] += dqdci;             /* dwdot[H2]/d[C2H6] */
-        J[1426] += dqdci;             /* dwdot[C2H2]/d[C2H6] */
-        J[1428] -= dqdci;             /* dwdot[C2H4]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[19][6] - 1)*dcdc_fac;
-        J[2592] += dqdci;             /* dwdot[H2]/d[AR] */
-        J[2614] += dqdci;             /* dwdot[C2H2]/d[AR] */
-        J[2616] -= dqdci;             /* dwdot[C2H4]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[19][0]*dcdc_fac - k_r*sc[22];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[19][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[19][2]*dcdc_fac;
-        dqdc[14] = TB[19][3]*dcdc_fac;
-        dqdc[15] = TB[19][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac - k_r*sc[0];
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac + k_f;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[19][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[19][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+0] += dqdc[k];
-            J[54*k+22] += dqdc[k];
-            J[54*k+24] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += dcdc_fac;
+    Jmix[22] += dcdc_fac;
+    Jmix[24] -= dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[19][0] - 1)*dcdc_fac - k_r*sc[22];
+    J[0] += dqdci;                /* dwdot[H2]/d[H2] */
+    J[22] += dqdci;               /* dwdot[C2H2]/d[H2] */
+    J[24] -= dqdci;               /* dwdot[C2H4]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[19][1] - 1)*dcdc_fac;
+    J[270] += dqdci;              /* dwdot[H2]/d[H2O] */
+    J[292] += dqdci;              /* dwdot[C2H2]/d[H2O] */
+    J[294] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[19][2] - 1)*dcdc_fac;
+    J[702] += dqdci;              /* dwdot[H2]/d[CH4] */
+    J[724] += dqdci;              /* dwdot[C2H2]/d[CH4] */
+    J[726] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[19][3] - 1)*dcdc_fac;
+    J[756] += dqdci;              /* dwdot[H2]/d[CO] */
+    J[778] += dqdci;              /* dwdot[C2H2]/d[CO] */
+    J[780] -= dqdci;              /* dwdot[C2H4]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[19][4] - 1)*dcdc_fac;
+    J[810] += dqdci;              /* dwdot[H2]/d[CO2] */
+    J[832] += dqdci;              /* dwdot[C2H2]/d[CO2] */
+    J[834] -= dqdci;              /* dwdot[C2H4]/d[CO2] */
+    /* d()/d[C2H2] */
+    dqdci =  - k_r*sc[0];
+    J[1188] += dqdci;             /* dwdot[H2]/d[C2H2] */
+    J[1210] += dqdci;             /* dwdot[C2H2]/d[C2H2] */
+    J[1212] -= dqdci;             /* dwdot[C2H4]/d[C2H2] */
+    /* d()/d[C2H4] */
+    dqdci =  + k_f;
+    J[1296] += dqdci;             /* dwdot[H2]/d[C2H4] */
+    J[1318] += dqdci;             /* dwdot[C2H2]/d[C2H4] */
+    J[1320] -= dqdci;             /* dwdot[C2H4]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[19][5] - 1)*dcdc_fac;
+    J[1404] += dqdci;             /* dwdot[H2]/d[C2H6] */
+    J[1426] += dqdci;             /* dwdot[C2H2]/d[C2H6] */
+    J[1428] -= dqdci;             /* dwdot[C2H4]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[19][6] - 1)*dcdc_fac;
+    J[2592] += dqdci;             /* dwdot[H2]/d[AR] */
+    J[2614] += dqdci;             /* dwdot[C2H2]/d[AR] */
+    J[2616] -= dqdci;             /* dwdot[C2H4]/d[AR] */
     J[2862] += dqdT; /* dwdot[H2]/dT */
     J[2884] += dqdT; /* dwdot[C2H2]/dT */
     J[2886] -= dqdT; /* dwdot[C2H4]/dT */
@@ -28097,8 +27744,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[20][0] - 1)*sc[0] + (TB[20][1] - 1)*sc[5] + (TB[20][2] - 1)*sc[13] + (TB[20][3] - 1)*sc[14] + (TB[20][4] - 1)*sc[15] + (TB[20][5] - 1)*sc[26] + (TB[20][6] - 1)*sc[48];
     /* forward */
     phi_f = sc[9]*sc[47];
-    k_f = prefactor_units[20] * fwd_A[20]
-                * exp(fwd_beta[20] * tc[0] - activation_units[20] * fwd_Ea[20] * invT);
+    k_f = k_f_s[20];
     dlnkfdT = fwd_beta[20] * invT + activation_units[20] * fwd_Ea[20] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[20] * exp(low_beta[20] * tc[0] - activation_units[20] * low_Ea[20] * invT);
@@ -28114,16 +27760,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[20] == 4 ? exp(-troe_Tss[20] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[20]) > 1.e-100 ? -Fcent1/troe_Tsss[20] : 0.)
+      + (fabs(troe_Ts[20]) > 1.e-100 ? -Fcent2/troe_Ts[20] : 0.)
+      + (troe_len[20] == 4 ? Fcent3*troe_Tss[20]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[20]) > 1.e-100 ? -Fcent1/troe_Tsss[20] : 0.)
-      + (fabs(troe_Ts[20]) > 1.e-100 ? -Fcent2/troe_Ts[20] : 0.)
-      + (troe_len[20] == 4 ? Fcent3*troe_Tss[20]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -28131,7 +27777,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[42];
-    Kc = refCinv * exp(g_RT[9] - g_RT[42] + g_RT[47]);
+    Kc = Kc_s[20];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[47]) + (h_RT[42]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28149,118 +27795,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[20][0] - 1)*dcdc_fac;
-        J[9] -= dqdci;                /* dwdot[CH]/d[H2] */
-        J[42] += dqdci;               /* dwdot[HCNN]/d[H2] */
-        J[47] -= dqdci;               /* dwdot[N2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[20][1] - 1)*dcdc_fac;
-        J[279] -= dqdci;              /* dwdot[CH]/d[H2O] */
-        J[312] += dqdci;              /* dwdot[HCNN]/d[H2O] */
-        J[317] -= dqdci;              /* dwdot[N2]/d[H2O] */
-        /* d()/d[CH] */
-        dqdci =  + k_f*sc[47];
-        J[495] -= dqdci;              /* dwdot[CH]/d[CH] */
-        J[528] += dqdci;              /* dwdot[HCNN]/d[CH] */
-        J[533] -= dqdci;              /* dwdot[N2]/d[CH] */
-        /* d()/d[CH4] */
-        dqdci = (TB[20][2] - 1)*dcdc_fac;
-        J[711] -= dqdci;              /* dwdot[CH]/d[CH4] */
-        J[744] += dqdci;              /* dwdot[HCNN]/d[CH4] */
-        J[749] -= dqdci;              /* dwdot[N2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[20][3] - 1)*dcdc_fac;
-        J[765] -= dqdci;              /* dwdot[CH]/d[CO] */
-        J[798] += dqdci;              /* dwdot[HCNN]/d[CO] */
-        J[803] -= dqdci;              /* dwdot[N2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[20][4] - 1)*dcdc_fac;
-        J[819] -= dqdci;              /* dwdot[CH]/d[CO2] */
-        J[852] += dqdci;              /* dwdot[HCNN]/d[CO2] */
-        J[857] -= dqdci;              /* dwdot[N2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[20][5] - 1)*dcdc_fac;
-        J[1413] -= dqdci;             /* dwdot[CH]/d[C2H6] */
-        J[1446] += dqdci;             /* dwdot[HCNN]/d[C2H6] */
-        J[1451] -= dqdci;             /* dwdot[N2]/d[C2H6] */
-        /* d()/d[HCNN] */
-        dqdci =  - k_r;
-        J[2277] -= dqdci;             /* dwdot[CH]/d[HCNN] */
-        J[2310] += dqdci;             /* dwdot[HCNN]/d[HCNN] */
-        J[2315] -= dqdci;             /* dwdot[N2]/d[HCNN] */
-        /* d()/d[N2] */
-        dqdci =  + k_f*sc[9];
-        J[2547] -= dqdci;             /* dwdot[CH]/d[N2] */
-        J[2580] += dqdci;             /* dwdot[HCNN]/d[N2] */
-        J[2585] -= dqdci;             /* dwdot[N2]/d[N2] */
-        /* d()/d[AR] */
-        dqdci = (TB[20][6] - 1)*dcdc_fac;
-        J[2601] -= dqdci;             /* dwdot[CH]/d[AR] */
-        J[2634] += dqdci;             /* dwdot[HCNN]/d[AR] */
-        J[2639] -= dqdci;             /* dwdot[N2]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[20][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[20][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac + k_f*sc[47];
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[20][2]*dcdc_fac;
-        dqdc[14] = TB[20][3]*dcdc_fac;
-        dqdc[15] = TB[20][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[20][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac - k_r;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac + k_f*sc[9];
-        dqdc[48] = TB[20][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+9] -= dqdc[k];
-            J[54*k+42] += dqdc[k];
-            J[54*k+47] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[9] -= dcdc_fac;
+    Jmix[42] += dcdc_fac;
+    Jmix[47] -= dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[20][0] - 1)*dcdc_fac;
+    J[9] -= dqdci;                /* dwdot[CH]/d[H2] */
+    J[42] += dqdci;               /* dwdot[HCNN]/d[H2] */
+    J[47] -= dqdci;               /* dwdot[N2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[20][1] - 1)*dcdc_fac;
+    J[279] -= dqdci;              /* dwdot[CH]/d[H2O] */
+    J[312] += dqdci;              /* dwdot[HCNN]/d[H2O] */
+    J[317] -= dqdci;              /* dwdot[N2]/d[H2O] */
+    /* d()/d[CH] */
+    dqdci =  + k_f*sc[47];
+    J[495] -= dqdci;              /* dwdot[CH]/d[CH] */
+    J[528] += dqdci;              /* dwdot[HCNN]/d[CH] */
+    J[533] -= dqdci;              /* dwdot[N2]/d[CH] */
+    /* d()/d[CH4] */
+    dqdci = (TB[20][2] - 1)*dcdc_fac;
+    J[711] -= dqdci;              /* dwdot[CH]/d[CH4] */
+    J[744] += dqdci;              /* dwdot[HCNN]/d[CH4] */
+    J[749] -= dqdci;              /* dwdot[N2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[20][3] - 1)*dcdc_fac;
+    J[765] -= dqdci;              /* dwdot[CH]/d[CO] */
+    J[798] += dqdci;              /* dwdot[HCNN]/d[CO] */
+    J[803] -= dqdci;              /* dwdot[N2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[20][4] - 1)*dcdc_fac;
+    J[819] -= dqdci;              /* dwdot[CH]/d[CO2] */
+    J[852] += dqdci;              /* dwdot[HCNN]/d[CO2] */
+    J[857] -= dqdci;              /* dwdot[N2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[20][5] - 1)*dcdc_fac;
+    J[1413] -= dqdci;             /* dwdot[CH]/d[C2H6] */
+    J[1446] += dqdci;             /* dwdot[HCNN]/d[C2H6] */
+    J[1451] -= dqdci;             /* dwdot[N2]/d[C2H6] */
+    /* d()/d[HCNN] */
+    dqdci =  - k_r;
+    J[2277] -= dqdci;             /* dwdot[CH]/d[HCNN] */
+    J[2310] += dqdci;             /* dwdot[HCNN]/d[HCNN] */
+    J[2315] -= dqdci;             /* dwdot[N2]/d[HCNN] */
+    /* d()/d[N2] */
+    dqdci =  + k_f*sc[9];
+    J[2547] -= dqdci;             /* dwdot[CH]/d[N2] */
+    J[2580] += dqdci;             /* dwdot[HCNN]/d[N2] */
+    J[2585] -= dqdci;             /* dwdot[N2]/d[N2] */
+    /* d()/d[AR] */
+    dqdci = (TB[20][6] - 1)*dcdc_fac;
+    J[2601] -= dqdci;             /* dwdot[CH]/d[AR] */
+    J[2634] += dqdci;             /* dwdot[HCNN]/d[AR] */
+    J[2639] -= dqdci;             /* dwdot[N2]/d[AR] */
     J[2871] -= dqdT; /* dwdot[CH]/dT */
     J[2904] += dqdT; /* dwdot[HCNN]/dT */
     J[2909] -= dqdT; /* dwdot[N2]/dT */
@@ -28269,11 +27857,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[21][0] - 1)*sc[0] + (TB[21][1] - 1)*sc[5] + (TB[21][2] - 1)*sc[13] + (TB[21][3] - 1)*sc[14] + (TB[21][4] - 1)*sc[15] + (TB[21][5] - 1)*sc[26] + (TB[21][6] - 1)*sc[48];
+    alpha = (memcmp(TB[21], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[21][0] - 1)*sc[0] + (TB[21][1] - 1)*sc[5] + (TB[21][2] - 1)*sc[13] + (TB[21][3] - 1)*sc[14] + (TB[21][4] - 1)*sc[15] + (TB[21][5] - 1)*sc[26] + (TB[21][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[0]*sc[9];
-    k_f = prefactor_units[21] * fwd_A[21]
-                * exp(fwd_beta[21] * tc[0] - activation_units[21] * fwd_Ea[21] * invT);
+    k_f = k_f_s[21];
     dlnkfdT = fwd_beta[21] * invT + activation_units[21] * fwd_Ea[21] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[21] * exp(low_beta[21] * tc[0] - activation_units[21] * low_Ea[21] * invT);
@@ -28289,16 +27876,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[21] == 4 ? exp(-troe_Tss[21] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[21]) > 1.e-100 ? -Fcent1/troe_Tsss[21] : 0.)
+      + (fabs(troe_Ts[21]) > 1.e-100 ? -Fcent2/troe_Ts[21] : 0.)
+      + (troe_len[21] == 4 ? Fcent3*troe_Tss[21]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[21]) > 1.e-100 ? -Fcent1/troe_Tsss[21] : 0.)
-      + (fabs(troe_Ts[21]) > 1.e-100 ? -Fcent2/troe_Ts[21] : 0.)
-      + (troe_len[21] == 4 ? Fcent3*troe_Tss[21]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -28306,7 +27893,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[12];
-    Kc = refCinv * exp(g_RT[0] + g_RT[9] - g_RT[12]);
+    Kc = Kc_s[21];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[9]) + (h_RT[12]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28324,113 +27911,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[21][0] - 1)*dcdc_fac + k_f*sc[9];
-        J[0] -= dqdci;                /* dwdot[H2]/d[H2] */
-        J[9] -= dqdci;                /* dwdot[CH]/d[H2] */
-        J[12] += dqdci;               /* dwdot[CH3]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[21][1] - 1)*dcdc_fac;
-        J[270] -= dqdci;              /* dwdot[H2]/d[H2O] */
-        J[279] -= dqdci;              /* dwdot[CH]/d[H2O] */
-        J[282] += dqdci;              /* dwdot[CH3]/d[H2O] */
-        /* d()/d[CH] */
-        dqdci =  + k_f*sc[0];
-        J[486] -= dqdci;              /* dwdot[H2]/d[CH] */
-        J[495] -= dqdci;              /* dwdot[CH]/d[CH] */
-        J[498] += dqdci;              /* dwdot[CH3]/d[CH] */
-        /* d()/d[CH3] */
-        dqdci =  - k_r;
-        J[648] -= dqdci;              /* dwdot[H2]/d[CH3] */
-        J[657] -= dqdci;              /* dwdot[CH]/d[CH3] */
-        J[660] += dqdci;              /* dwdot[CH3]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[21][2] - 1)*dcdc_fac;
-        J[702] -= dqdci;              /* dwdot[H2]/d[CH4] */
-        J[711] -= dqdci;              /* dwdot[CH]/d[CH4] */
-        J[714] += dqdci;              /* dwdot[CH3]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[21][3] - 1)*dcdc_fac;
-        J[756] -= dqdci;              /* dwdot[H2]/d[CO] */
-        J[765] -= dqdci;              /* dwdot[CH]/d[CO] */
-        J[768] += dqdci;              /* dwdot[CH3]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[21][4] - 1)*dcdc_fac;
-        J[810] -= dqdci;              /* dwdot[H2]/d[CO2] */
-        J[819] -= dqdci;              /* dwdot[CH]/d[CO2] */
-        J[822] += dqdci;              /* dwdot[CH3]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[21][5] - 1)*dcdc_fac;
-        J[1404] -= dqdci;             /* dwdot[H2]/d[C2H6] */
-        J[1413] -= dqdci;             /* dwdot[CH]/d[C2H6] */
-        J[1416] += dqdci;             /* dwdot[CH3]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[21][6] - 1)*dcdc_fac;
-        J[2592] -= dqdci;             /* dwdot[H2]/d[AR] */
-        J[2601] -= dqdci;             /* dwdot[CH]/d[AR] */
-        J[2604] += dqdci;             /* dwdot[CH3]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[21][0]*dcdc_fac + k_f*sc[9];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[21][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac + k_f*sc[0];
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac - k_r;
-        dqdc[13] = TB[21][2]*dcdc_fac;
-        dqdc[14] = TB[21][3]*dcdc_fac;
-        dqdc[15] = TB[21][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[21][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[21][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+0] -= dqdc[k];
-            J[54*k+9] -= dqdc[k];
-            J[54*k+12] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[9] -= dcdc_fac;
+    Jmix[12] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[21][0] - 1)*dcdc_fac + k_f*sc[9];
+    J[0] -= dqdci;                /* dwdot[H2]/d[H2] */
+    J[9] -= dqdci;                /* dwdot[CH]/d[H2] */
+    J[12] += dqdci;               /* dwdot[CH3]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[21][1] - 1)*dcdc_fac;
+    J[270] -= dqdci;              /* dwdot[H2]/d[H2O] */
+    J[279] -= dqdci;              /* dwdot[CH]/d[H2O] */
+    J[282] += dqdci;              /* dwdot[CH3]/d[H2O] */
+    /* d()/d[CH] */
+    dqdci =  + k_f*sc[0];
+    J[486] -= dqdci;              /* dwdot[H2]/d[CH] */
+    J[495] -= dqdci;              /* dwdot[CH]/d[CH] */
+    J[498] += dqdci;              /* dwdot[CH3]/d[CH] */
+    /* d()/d[CH3] */
+    dqdci =  - k_r;
+    J[648] -= dqdci;              /* dwdot[H2]/d[CH3] */
+    J[657] -= dqdci;              /* dwdot[CH]/d[CH3] */
+    J[660] += dqdci;              /* dwdot[CH3]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[21][2] - 1)*dcdc_fac;
+    J[702] -= dqdci;              /* dwdot[H2]/d[CH4] */
+    J[711] -= dqdci;              /* dwdot[CH]/d[CH4] */
+    J[714] += dqdci;              /* dwdot[CH3]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[21][3] - 1)*dcdc_fac;
+    J[756] -= dqdci;              /* dwdot[H2]/d[CO] */
+    J[765] -= dqdci;              /* dwdot[CH]/d[CO] */
+    J[768] += dqdci;              /* dwdot[CH3]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[21][4] - 1)*dcdc_fac;
+    J[810] -= dqdci;              /* dwdot[H2]/d[CO2] */
+    J[819] -= dqdci;              /* dwdot[CH]/d[CO2] */
+    J[822] += dqdci;              /* dwdot[CH3]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[21][5] - 1)*dcdc_fac;
+    J[1404] -= dqdci;             /* dwdot[H2]/d[C2H6] */
+    J[1413] -= dqdci;             /* dwdot[CH]/d[C2H6] */
+    J[1416] += dqdci;             /* dwdot[CH3]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[21][6] - 1)*dcdc_fac;
+    J[2592] -= dqdci;             /* dwdot[H2]/d[AR] */
+    J[2601] -= dqdci;             /* dwdot[CH]/d[AR] */
+    J[2604] += dqdci;             /* dwdot[CH3]/d[AR] */
     J[2862] -= dqdT; /* dwdot[H2]/dT */
     J[2871] -= dqdT; /* dwdot[CH]/dT */
     J[2874] += dqdT; /* dwdot[CH3]/dT */
@@ -28439,11 +27968,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[22][0] - 1)*sc[0] + (TB[22][1] - 1)*sc[5] + (TB[22][2] - 1)*sc[13] + (TB[22][3] - 1)*sc[14] + (TB[22][4] - 1)*sc[15] + (TB[22][5] - 1)*sc[26] + (TB[22][6] - 1)*sc[48];
+    alpha = (memcmp(TB[22], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[22][0] - 1)*sc[0] + (TB[22][1] - 1)*sc[5] + (TB[22][2] - 1)*sc[13] + (TB[22][3] - 1)*sc[14] + (TB[22][4] - 1)*sc[15] + (TB[22][5] - 1)*sc[26] + (TB[22][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[1]*sc[28];
-    k_f = prefactor_units[22] * fwd_A[22]
-                * exp(fwd_beta[22] * tc[0] - activation_units[22] * fwd_Ea[22] * invT);
+    k_f = k_f_s[22];
     dlnkfdT = fwd_beta[22] * invT + activation_units[22] * fwd_Ea[22] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[22] * exp(low_beta[22] * tc[0] - activation_units[22] * low_Ea[22] * invT);
@@ -28459,16 +27987,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[22] == 4 ? exp(-troe_Tss[22] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[22]) > 1.e-100 ? -Fcent1/troe_Tsss[22] : 0.)
+      + (fabs(troe_Ts[22]) > 1.e-100 ? -Fcent2/troe_Ts[22] : 0.)
+      + (troe_len[22] == 4 ? Fcent3*troe_Tss[22]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[22]) > 1.e-100 ? -Fcent1/troe_Tsss[22] : 0.)
-      + (fabs(troe_Ts[22]) > 1.e-100 ? -Fcent2/troe_Ts[22] : 0.)
-      + (troe_len[22] == 4 ? Fcent3*troe_Tss[22]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -28476,7 +28004,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[51];
-    Kc = refCinv * exp(g_RT[1] + g_RT[28] - g_RT[51]);
+    Kc = Kc_s[22];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[28]) + (h_RT[51]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28494,118 +28022,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[22][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[28] -= dqdci;               /* dwdot[CH2CO]/d[H2] */
-        J[51] += dqdci;               /* dwdot[CH2CHO]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[28];
-        J[55] -= dqdci;               /* dwdot[H]/d[H] */
-        J[82] -= dqdci;               /* dwdot[CH2CO]/d[H] */
-        J[105] += dqdci;              /* dwdot[CH2CHO]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[22][1] - 1)*dcdc_fac;
-        J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[298] -= dqdci;              /* dwdot[CH2CO]/d[H2O] */
-        J[321] += dqdci;              /* dwdot[CH2CHO]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[22][2] - 1)*dcdc_fac;
-        J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[730] -= dqdci;              /* dwdot[CH2CO]/d[CH4] */
-        J[753] += dqdci;              /* dwdot[CH2CHO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[22][3] - 1)*dcdc_fac;
-        J[757] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[784] -= dqdci;              /* dwdot[CH2CO]/d[CO] */
-        J[807] += dqdci;              /* dwdot[CH2CHO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[22][4] - 1)*dcdc_fac;
-        J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[838] -= dqdci;              /* dwdot[CH2CO]/d[CO2] */
-        J[861] += dqdci;              /* dwdot[CH2CHO]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[22][5] - 1)*dcdc_fac;
-        J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1432] -= dqdci;             /* dwdot[CH2CO]/d[C2H6] */
-        J[1455] += dqdci;             /* dwdot[CH2CHO]/d[C2H6] */
-        /* d()/d[CH2CO] */
-        dqdci =  + k_f*sc[1];
-        J[1513] -= dqdci;             /* dwdot[H]/d[CH2CO] */
-        J[1540] -= dqdci;             /* dwdot[CH2CO]/d[CH2CO] */
-        J[1563] += dqdci;             /* dwdot[CH2CHO]/d[CH2CO] */
-        /* d()/d[AR] */
-        dqdci = (TB[22][6] - 1)*dcdc_fac;
-        J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2620] -= dqdci;             /* dwdot[CH2CO]/d[AR] */
-        J[2643] += dqdci;             /* dwdot[CH2CHO]/d[AR] */
-        /* d()/d[CH2CHO] */
-        dqdci =  - k_r;
-        J[2755] -= dqdci;             /* dwdot[H]/d[CH2CHO] */
-        J[2782] -= dqdci;             /* dwdot[CH2CO]/d[CH2CHO] */
-        J[2805] += dqdci;             /* dwdot[CH2CHO]/d[CH2CHO] */
-    }
-    else {
-        dqdc[0] = TB[22][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[28];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[22][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[22][2]*dcdc_fac;
-        dqdc[14] = TB[22][3]*dcdc_fac;
-        dqdc[15] = TB[22][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[22][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac + k_f*sc[1];
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[22][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac - k_r;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+1] -= dqdc[k];
-            J[54*k+28] -= dqdc[k];
-            J[54*k+51] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[28] -= dcdc_fac;
+    Jmix[51] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[22][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[28] -= dqdci;               /* dwdot[CH2CO]/d[H2] */
+    J[51] += dqdci;               /* dwdot[CH2CHO]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[28];
+    J[55] -= dqdci;               /* dwdot[H]/d[H] */
+    J[82] -= dqdci;               /* dwdot[CH2CO]/d[H] */
+    J[105] += dqdci;              /* dwdot[CH2CHO]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[22][1] - 1)*dcdc_fac;
+    J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[298] -= dqdci;              /* dwdot[CH2CO]/d[H2O] */
+    J[321] += dqdci;              /* dwdot[CH2CHO]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[22][2] - 1)*dcdc_fac;
+    J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[730] -= dqdci;              /* dwdot[CH2CO]/d[CH4] */
+    J[753] += dqdci;              /* dwdot[CH2CHO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[22][3] - 1)*dcdc_fac;
+    J[757] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[784] -= dqdci;              /* dwdot[CH2CO]/d[CO] */
+    J[807] += dqdci;              /* dwdot[CH2CHO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[22][4] - 1)*dcdc_fac;
+    J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[838] -= dqdci;              /* dwdot[CH2CO]/d[CO2] */
+    J[861] += dqdci;              /* dwdot[CH2CHO]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[22][5] - 1)*dcdc_fac;
+    J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1432] -= dqdci;             /* dwdot[CH2CO]/d[C2H6] */
+    J[1455] += dqdci;             /* dwdot[CH2CHO]/d[C2H6] */
+    /* d()/d[CH2CO] */
+    dqdci =  + k_f*sc[1];
+    J[1513] -= dqdci;             /* dwdot[H]/d[CH2CO] */
+    J[1540] -= dqdci;             /* dwdot[CH2CO]/d[CH2CO] */
+    J[1563] += dqdci;             /* dwdot[CH2CHO]/d[CH2CO] */
+    /* d()/d[AR] */
+    dqdci = (TB[22][6] - 1)*dcdc_fac;
+    J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2620] -= dqdci;             /* dwdot[CH2CO]/d[AR] */
+    J[2643] += dqdci;             /* dwdot[CH2CHO]/d[AR] */
+    /* d()/d[CH2CHO] */
+    dqdci =  - k_r;
+    J[2755] -= dqdci;             /* dwdot[H]/d[CH2CHO] */
+    J[2782] -= dqdci;             /* dwdot[CH2CO]/d[CH2CHO] */
+    J[2805] += dqdci;             /* dwdot[CH2CHO]/d[CH2CHO] */
     J[2863] -= dqdT; /* dwdot[H]/dT */
     J[2890] -= dqdT; /* dwdot[CH2CO]/dT */
     J[2913] += dqdT; /* dwdot[CH2CHO]/dT */
@@ -28614,11 +28084,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[23][0] - 1)*sc[0] + (TB[23][1] - 1)*sc[5] + (TB[23][2] - 1)*sc[13] + (TB[23][3] - 1)*sc[14] + (TB[23][4] - 1)*sc[15] + (TB[23][5] - 1)*sc[26] + (TB[23][6] - 1)*sc[48];
+    alpha = (memcmp(TB[23], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[23][0] - 1)*sc[0] + (TB[23][1] - 1)*sc[5] + (TB[23][2] - 1)*sc[13] + (TB[23][3] - 1)*sc[14] + (TB[23][4] - 1)*sc[15] + (TB[23][5] - 1)*sc[26] + (TB[23][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[12]*sc[25];
-    k_f = prefactor_units[23] * fwd_A[23]
-                * exp(fwd_beta[23] * tc[0] - activation_units[23] * fwd_Ea[23] * invT);
+    k_f = k_f_s[23];
     dlnkfdT = fwd_beta[23] * invT + activation_units[23] * fwd_Ea[23] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[23] * exp(low_beta[23] * tc[0] - activation_units[23] * low_Ea[23] * invT);
@@ -28634,16 +28103,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[23] == 4 ? exp(-troe_Tss[23] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[23]) > 1.e-100 ? -Fcent1/troe_Tsss[23] : 0.)
+      + (fabs(troe_Ts[23]) > 1.e-100 ? -Fcent2/troe_Ts[23] : 0.)
+      + (troe_len[23] == 4 ? Fcent3*troe_Tss[23]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[23]) > 1.e-100 ? -Fcent1/troe_Tsss[23] : 0.)
-      + (fabs(troe_Ts[23]) > 1.e-100 ? -Fcent2/troe_Ts[23] : 0.)
-      + (troe_len[23] == 4 ? Fcent3*troe_Tss[23]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -28651,7 +28120,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[50];
-    Kc = refCinv * exp(g_RT[12] + g_RT[25] - g_RT[50]);
+    Kc = Kc_s[23];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[25]) + (h_RT[50]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28669,118 +28138,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[23][0] - 1)*dcdc_fac;
-        J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
-        J[25] -= dqdci;               /* dwdot[C2H5]/d[H2] */
-        J[50] += dqdci;               /* dwdot[C3H8]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[23][1] - 1)*dcdc_fac;
-        J[282] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[295] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
-        J[320] += dqdci;              /* dwdot[C3H8]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[25];
-        J[660] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[673] -= dqdci;              /* dwdot[C2H5]/d[CH3] */
-        J[698] += dqdci;              /* dwdot[C3H8]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[23][2] - 1)*dcdc_fac;
-        J[714] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[727] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
-        J[752] += dqdci;              /* dwdot[C3H8]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[23][3] - 1)*dcdc_fac;
-        J[768] -= dqdci;              /* dwdot[CH3]/d[CO] */
-        J[781] -= dqdci;              /* dwdot[C2H5]/d[CO] */
-        J[806] += dqdci;              /* dwdot[C3H8]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[23][4] - 1)*dcdc_fac;
-        J[822] -= dqdci;              /* dwdot[CH3]/d[CO2] */
-        J[835] -= dqdci;              /* dwdot[C2H5]/d[CO2] */
-        J[860] += dqdci;              /* dwdot[C3H8]/d[CO2] */
-        /* d()/d[C2H5] */
-        dqdci =  + k_f*sc[12];
-        J[1362] -= dqdci;             /* dwdot[CH3]/d[C2H5] */
-        J[1375] -= dqdci;             /* dwdot[C2H5]/d[C2H5] */
-        J[1400] += dqdci;             /* dwdot[C3H8]/d[C2H5] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[23][5] - 1)*dcdc_fac;
-        J[1416] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
-        J[1429] -= dqdci;             /* dwdot[C2H5]/d[C2H6] */
-        J[1454] += dqdci;             /* dwdot[C3H8]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[23][6] - 1)*dcdc_fac;
-        J[2604] -= dqdci;             /* dwdot[CH3]/d[AR] */
-        J[2617] -= dqdci;             /* dwdot[C2H5]/d[AR] */
-        J[2642] += dqdci;             /* dwdot[C3H8]/d[AR] */
-        /* d()/d[C3H8] */
-        dqdci =  - k_r;
-        J[2712] -= dqdci;             /* dwdot[CH3]/d[C3H8] */
-        J[2725] -= dqdci;             /* dwdot[C2H5]/d[C3H8] */
-        J[2750] += dqdci;             /* dwdot[C3H8]/d[C3H8] */
-    }
-    else {
-        dqdc[0] = TB[23][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[23][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*sc[25];
-        dqdc[13] = TB[23][2]*dcdc_fac;
-        dqdc[14] = TB[23][3]*dcdc_fac;
-        dqdc[15] = TB[23][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac + k_f*sc[12];
-        dqdc[26] = TB[23][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[23][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac - k_r;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+12] -= dqdc[k];
-            J[54*k+25] -= dqdc[k];
-            J[54*k+50] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[12] -= dcdc_fac;
+    Jmix[25] -= dcdc_fac;
+    Jmix[50] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[23][0] - 1)*dcdc_fac;
+    J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
+    J[25] -= dqdci;               /* dwdot[C2H5]/d[H2] */
+    J[50] += dqdci;               /* dwdot[C3H8]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[23][1] - 1)*dcdc_fac;
+    J[282] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[295] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
+    J[320] += dqdci;              /* dwdot[C3H8]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[25];
+    J[660] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[673] -= dqdci;              /* dwdot[C2H5]/d[CH3] */
+    J[698] += dqdci;              /* dwdot[C3H8]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[23][2] - 1)*dcdc_fac;
+    J[714] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[727] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
+    J[752] += dqdci;              /* dwdot[C3H8]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[23][3] - 1)*dcdc_fac;
+    J[768] -= dqdci;              /* dwdot[CH3]/d[CO] */
+    J[781] -= dqdci;              /* dwdot[C2H5]/d[CO] */
+    J[806] += dqdci;              /* dwdot[C3H8]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[23][4] - 1)*dcdc_fac;
+    J[822] -= dqdci;              /* dwdot[CH3]/d[CO2] */
+    J[835] -= dqdci;              /* dwdot[C2H5]/d[CO2] */
+    J[860] += dqdci;              /* dwdot[C3H8]/d[CO2] */
+    /* d()/d[C2H5] */
+    dqdci =  + k_f*sc[12];
+    J[1362] -= dqdci;             /* dwdot[CH3]/d[C2H5] */
+    J[1375] -= dqdci;             /* dwdot[C2H5]/d[C2H5] */
+    J[1400] += dqdci;             /* dwdot[C3H8]/d[C2H5] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[23][5] - 1)*dcdc_fac;
+    J[1416] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
+    J[1429] -= dqdci;             /* dwdot[C2H5]/d[C2H6] */
+    J[1454] += dqdci;             /* dwdot[C3H8]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[23][6] - 1)*dcdc_fac;
+    J[2604] -= dqdci;             /* dwdot[CH3]/d[AR] */
+    J[2617] -= dqdci;             /* dwdot[C2H5]/d[AR] */
+    J[2642] += dqdci;             /* dwdot[C3H8]/d[AR] */
+    /* d()/d[C3H8] */
+    dqdci =  - k_r;
+    J[2712] -= dqdci;             /* dwdot[CH3]/d[C3H8] */
+    J[2725] -= dqdci;             /* dwdot[C2H5]/d[C3H8] */
+    J[2750] += dqdci;             /* dwdot[C3H8]/d[C3H8] */
     J[2874] -= dqdT; /* dwdot[CH3]/dT */
     J[2887] -= dqdT; /* dwdot[C2H5]/dT */
     J[2912] += dqdT; /* dwdot[C3H8]/dT */
@@ -28789,11 +28200,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[24][0] - 1)*sc[0] + (TB[24][1] - 1)*sc[5] + (TB[24][2] - 1)*sc[13] + (TB[24][3] - 1)*sc[14] + (TB[24][4] - 1)*sc[15] + (TB[24][5] - 1)*sc[26] + (TB[24][6] - 1)*sc[48];
+    alpha = (memcmp(TB[24], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[24][0] - 1)*sc[0] + (TB[24][1] - 1)*sc[5] + (TB[24][2] - 1)*sc[13] + (TB[24][3] - 1)*sc[14] + (TB[24][4] - 1)*sc[15] + (TB[24][5] - 1)*sc[26] + (TB[24][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[12]*sc[24];
-    k_f = prefactor_units[24] * fwd_A[24]
-                * exp(fwd_beta[24] * tc[0] - activation_units[24] * fwd_Ea[24] * invT);
+    k_f = k_f_s[24];
     dlnkfdT = fwd_beta[24] * invT + activation_units[24] * fwd_Ea[24] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[24] * exp(low_beta[24] * tc[0] - activation_units[24] * low_Ea[24] * invT);
@@ -28809,16 +28219,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[24] == 4 ? exp(-troe_Tss[24] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[24]) > 1.e-100 ? -Fcent1/troe_Tsss[24] : 0.)
+      + (fabs(troe_Ts[24]) > 1.e-100 ? -Fcent2/troe_Ts[24] : 0.)
+      + (troe_len[24] == 4 ? Fcent3*troe_Tss[24]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[24]) > 1.e-100 ? -Fcent1/troe_Tsss[24] : 0.)
-      + (fabs(troe_Ts[24]) > 1.e-100 ? -Fcent2/troe_Ts[24] : 0.)
-      + (troe_len[24] == 4 ? Fcent3*troe_Tss[24]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -28826,7 +28236,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[49];
-    Kc = refCinv * exp(g_RT[12] + g_RT[24] - g_RT[49]);
+    Kc = Kc_s[24];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[24]) + (h_RT[49]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28844,118 +28254,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[24][0] - 1)*dcdc_fac;
-        J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
-        J[24] -= dqdci;               /* dwdot[C2H4]/d[H2] */
-        J[49] += dqdci;               /* dwdot[C3H7]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[24][1] - 1)*dcdc_fac;
-        J[282] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[294] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
-        J[319] += dqdci;              /* dwdot[C3H7]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[24];
-        J[660] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[672] -= dqdci;              /* dwdot[C2H4]/d[CH3] */
-        J[697] += dqdci;              /* dwdot[C3H7]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[24][2] - 1)*dcdc_fac;
-        J[714] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[726] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
-        J[751] += dqdci;              /* dwdot[C3H7]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[24][3] - 1)*dcdc_fac;
-        J[768] -= dqdci;              /* dwdot[CH3]/d[CO] */
-        J[780] -= dqdci;              /* dwdot[C2H4]/d[CO] */
-        J[805] += dqdci;              /* dwdot[C3H7]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[24][4] - 1)*dcdc_fac;
-        J[822] -= dqdci;              /* dwdot[CH3]/d[CO2] */
-        J[834] -= dqdci;              /* dwdot[C2H4]/d[CO2] */
-        J[859] += dqdci;              /* dwdot[C3H7]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci =  + k_f*sc[12];
-        J[1308] -= dqdci;             /* dwdot[CH3]/d[C2H4] */
-        J[1320] -= dqdci;             /* dwdot[C2H4]/d[C2H4] */
-        J[1345] += dqdci;             /* dwdot[C3H7]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[24][5] - 1)*dcdc_fac;
-        J[1416] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
-        J[1428] -= dqdci;             /* dwdot[C2H4]/d[C2H6] */
-        J[1453] += dqdci;             /* dwdot[C3H7]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[24][6] - 1)*dcdc_fac;
-        J[2604] -= dqdci;             /* dwdot[CH3]/d[AR] */
-        J[2616] -= dqdci;             /* dwdot[C2H4]/d[AR] */
-        J[2641] += dqdci;             /* dwdot[C3H7]/d[AR] */
-        /* d()/d[C3H7] */
-        dqdci =  - k_r;
-        J[2658] -= dqdci;             /* dwdot[CH3]/d[C3H7] */
-        J[2670] -= dqdci;             /* dwdot[C2H4]/d[C3H7] */
-        J[2695] += dqdci;             /* dwdot[C3H7]/d[C3H7] */
-    }
-    else {
-        dqdc[0] = TB[24][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[24][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*sc[24];
-        dqdc[13] = TB[24][2]*dcdc_fac;
-        dqdc[14] = TB[24][3]*dcdc_fac;
-        dqdc[15] = TB[24][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac + k_f*sc[12];
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[24][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[24][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac - k_r;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+12] -= dqdc[k];
-            J[54*k+24] -= dqdc[k];
-            J[54*k+49] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[12] -= dcdc_fac;
+    Jmix[24] -= dcdc_fac;
+    Jmix[49] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[24][0] - 1)*dcdc_fac;
+    J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
+    J[24] -= dqdci;               /* dwdot[C2H4]/d[H2] */
+    J[49] += dqdci;               /* dwdot[C3H7]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[24][1] - 1)*dcdc_fac;
+    J[282] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[294] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
+    J[319] += dqdci;              /* dwdot[C3H7]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[24];
+    J[660] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[672] -= dqdci;              /* dwdot[C2H4]/d[CH3] */
+    J[697] += dqdci;              /* dwdot[C3H7]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[24][2] - 1)*dcdc_fac;
+    J[714] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[726] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
+    J[751] += dqdci;              /* dwdot[C3H7]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[24][3] - 1)*dcdc_fac;
+    J[768] -= dqdci;              /* dwdot[CH3]/d[CO] */
+    J[780] -= dqdci;              /* dwdot[C2H4]/d[CO] */
+    J[805] += dqdci;              /* dwdot[C3H7]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[24][4] - 1)*dcdc_fac;
+    J[822] -= dqdci;              /* dwdot[CH3]/d[CO2] */
+    J[834] -= dqdci;              /* dwdot[C2H4]/d[CO2] */
+    J[859] += dqdci;              /* dwdot[C3H7]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci =  + k_f*sc[12];
+    J[1308] -= dqdci;             /* dwdot[CH3]/d[C2H4] */
+    J[1320] -= dqdci;             /* dwdot[C2H4]/d[C2H4] */
+    J[1345] += dqdci;             /* dwdot[C3H7]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[24][5] - 1)*dcdc_fac;
+    J[1416] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
+    J[1428] -= dqdci;             /* dwdot[C2H4]/d[C2H6] */
+    J[1453] += dqdci;             /* dwdot[C3H7]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[24][6] - 1)*dcdc_fac;
+    J[2604] -= dqdci;             /* dwdot[CH3]/d[AR] */
+    J[2616] -= dqdci;             /* dwdot[C2H4]/d[AR] */
+    J[2641] += dqdci;             /* dwdot[C3H7]/d[AR] */
+    /* d()/d[C3H7] */
+    dqdci =  - k_r;
+    J[2658] -= dqdci;             /* dwdot[CH3]/d[C3H7] */
+    J[2670] -= dqdci;             /* dwdot[C2H4]/d[C3H7] */
+    J[2695] += dqdci;             /* dwdot[C3H7]/d[C3H7] */
     J[2874] -= dqdT; /* dwdot[CH3]/dT */
     J[2886] -= dqdT; /* dwdot[C2H4]/dT */
     J[2911] += dqdT; /* dwdot[C3H7]/dT */
@@ -28964,11 +28316,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[25][0] - 1)*sc[0] + (TB[25][1] - 1)*sc[5] + (TB[25][2] - 1)*sc[13] + (TB[25][3] - 1)*sc[14] + (TB[25][4] - 1)*sc[15] + (TB[25][5] - 1)*sc[26] + (TB[25][6] - 1)*sc[48];
+    alpha = (memcmp(TB[25], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[25][0] - 1)*sc[0] + (TB[25][1] - 1)*sc[5] + (TB[25][2] - 1)*sc[13] + (TB[25][3] - 1)*sc[14] + (TB[25][4] - 1)*sc[15] + (TB[25][5] - 1)*sc[26] + (TB[25][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[1]*sc[49];
-    k_f = prefactor_units[25] * fwd_A[25]
-                * exp(fwd_beta[25] * tc[0] - activation_units[25] * fwd_Ea[25] * invT);
+    k_f = k_f_s[25];
     dlnkfdT = fwd_beta[25] * invT + activation_units[25] * fwd_Ea[25] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[25] * exp(low_beta[25] * tc[0] - activation_units[25] * low_Ea[25] * invT);
@@ -28984,16 +28335,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[25] == 4 ? exp(-troe_Tss[25] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[25]) > 1.e-100 ? -Fcent1/troe_Tsss[25] : 0.)
+      + (fabs(troe_Ts[25]) > 1.e-100 ? -Fcent2/troe_Ts[25] : 0.)
+      + (troe_len[25] == 4 ? Fcent3*troe_Tss[25]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[25]) > 1.e-100 ? -Fcent1/troe_Tsss[25] : 0.)
-      + (fabs(troe_Ts[25]) > 1.e-100 ? -Fcent2/troe_Ts[25] : 0.)
-      + (troe_len[25] == 4 ? Fcent3*troe_Tss[25]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -29001,7 +28352,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[50];
-    Kc = refCinv * exp(g_RT[1] + g_RT[49] - g_RT[50]);
+    Kc = Kc_s[25];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[49]) + (h_RT[50]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29019,118 +28370,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[25][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[49] -= dqdci;               /* dwdot[C3H7]/d[H2] */
-        J[50] += dqdci;               /* dwdot[C3H8]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[49];
-        J[55] -= dqdci;               /* dwdot[H]/d[H] */
-        J[103] -= dqdci;              /* dwdot[C3H7]/d[H] */
-        J[104] += dqdci;              /* dwdot[C3H8]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[25][1] - 1)*dcdc_fac;
-        J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[319] -= dqdci;              /* dwdot[C3H7]/d[H2O] */
-        J[320] += dqdci;              /* dwdot[C3H8]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[25][2] - 1)*dcdc_fac;
-        J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[751] -= dqdci;              /* dwdot[C3H7]/d[CH4] */
-        J[752] += dqdci;              /* dwdot[C3H8]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[25][3] - 1)*dcdc_fac;
-        J[757] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[805] -= dqdci;              /* dwdot[C3H7]/d[CO] */
-        J[806] += dqdci;              /* dwdot[C3H8]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[25][4] - 1)*dcdc_fac;
-        J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[859] -= dqdci;              /* dwdot[C3H7]/d[CO2] */
-        J[860] += dqdci;              /* dwdot[C3H8]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[25][5] - 1)*dcdc_fac;
-        J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1453] -= dqdci;             /* dwdot[C3H7]/d[C2H6] */
-        J[1454] += dqdci;             /* dwdot[C3H8]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[25][6] - 1)*dcdc_fac;
-        J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2641] -= dqdci;             /* dwdot[C3H7]/d[AR] */
-        J[2642] += dqdci;             /* dwdot[C3H8]/d[AR] */
-        /* d()/d[C3H7] */
-        dqdci =  + k_f*sc[1];
-        J[2647] -= dqdci;             /* dwdot[H]/d[C3H7] */
-        J[2695] -= dqdci;             /* dwdot[C3H7]/d[C3H7] */
-        J[2696] += dqdci;             /* dwdot[C3H8]/d[C3H7] */
-        /* d()/d[C3H8] */
-        dqdci =  - k_r;
-        J[2701] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[2749] -= dqdci;             /* dwdot[C3H7]/d[C3H8] */
-        J[2750] += dqdci;             /* dwdot[C3H8]/d[C3H8] */
-    }
-    else {
-        dqdc[0] = TB[25][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[49];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[25][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[25][2]*dcdc_fac;
-        dqdc[14] = TB[25][3]*dcdc_fac;
-        dqdc[15] = TB[25][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[25][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[25][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac + k_f*sc[1];
-        dqdc[50] = dcdc_fac - k_r;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+1] -= dqdc[k];
-            J[54*k+49] -= dqdc[k];
-            J[54*k+50] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[49] -= dcdc_fac;
+    Jmix[50] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[25][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[49] -= dqdci;               /* dwdot[C3H7]/d[H2] */
+    J[50] += dqdci;               /* dwdot[C3H8]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[49];
+    J[55] -= dqdci;               /* dwdot[H]/d[H] */
+    J[103] -= dqdci;              /* dwdot[C3H7]/d[H] */
+    J[104] += dqdci;              /* dwdot[C3H8]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[25][1] - 1)*dcdc_fac;
+    J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[319] -= dqdci;              /* dwdot[C3H7]/d[H2O] */
+    J[320] += dqdci;              /* dwdot[C3H8]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[25][2] - 1)*dcdc_fac;
+    J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[751] -= dqdci;              /* dwdot[C3H7]/d[CH4] */
+    J[752] += dqdci;              /* dwdot[C3H8]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[25][3] - 1)*dcdc_fac;
+    J[757] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[805] -= dqdci;              /* dwdot[C3H7]/d[CO] */
+    J[806] += dqdci;              /* dwdot[C3H8]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[25][4] - 1)*dcdc_fac;
+    J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[859] -= dqdci;              /* dwdot[C3H7]/d[CO2] */
+    J[860] += dqdci;              /* dwdot[C3H8]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[25][5] - 1)*dcdc_fac;
+    J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1453] -= dqdci;             /* dwdot[C3H7]/d[C2H6] */
+    J[1454] += dqdci;             /* dwdot[C3H8]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[25][6] - 1)*dcdc_fac;
+    J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2641] -= dqdci;             /* dwdot[C3H7]/d[AR] */
+    J[2642] += dqdci;             /* dwdot[C3H8]/d[AR] */
+    /* d()/d[C3H7] */
+    dqdci =  + k_f*sc[1];
+    J[2647] -= dqdci;             /* dwdot[H]/d[C3H7] */
+    J[2695] -= dqdci;             /* dwdot[C3H7]/d[C3H7] */
+    J[2696] += dqdci;             /* dwdot[C3H8]/d[C3H7] */
+    /* d()/d[C3H8] */
+    dqdci =  - k_r;
+    J[2701] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[2749] -= dqdci;             /* dwdot[C3H7]/d[C3H8] */
+    J[2750] += dqdci;             /* dwdot[C3H8]/d[C3H8] */
     J[2863] -= dqdT; /* dwdot[H]/dT */
     J[2911] -= dqdT; /* dwdot[C3H7]/dT */
     J[2912] += dqdT; /* dwdot[C3H8]/dT */
@@ -29142,8 +28435,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[26][0] - 1)*sc[0] + (TB[26][1] - 1)*sc[3] + (TB[26][2] - 1)*sc[5] + (TB[26][3] - 1)*sc[13] + (TB[26][4] - 1)*sc[14] + (TB[26][5] - 1)*sc[15] + (TB[26][6] - 1)*sc[26] + (TB[26][7] - 1)*sc[48];
     /* forward */
     phi_f = sc[2]*sc[14];
-    k_f = prefactor_units[26] * fwd_A[26]
-                * exp(fwd_beta[26] * tc[0] - activation_units[26] * fwd_Ea[26] * invT);
+    k_f = k_f_s[26];
     dlnkfdT = fwd_beta[26] * invT + activation_units[26] * fwd_Ea[26] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[26] * exp(low_beta[26] * tc[0] - activation_units[26] * low_Ea[26] * invT);
@@ -29158,7 +28450,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = 0.0;
     /* reverse */
     phi_r = sc[15];
-    Kc = refCinv * exp(g_RT[2] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[26];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[14]) + (h_RT[15]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29176,113 +28468,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[26][0] - 1)*dcdc_fac;
-        J[2] -= dqdci;                /* dwdot[O]/d[H2] */
-        J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
-        J[15] += dqdci;               /* dwdot[CO2]/d[H2] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[14];
-        J[110] -= dqdci;              /* dwdot[O]/d[O] */
-        J[122] -= dqdci;              /* dwdot[CO]/d[O] */
-        J[123] += dqdci;              /* dwdot[CO2]/d[O] */
-        /* d()/d[O2] */
-        dqdci = (TB[26][1] - 1)*dcdc_fac;
-        J[164] -= dqdci;              /* dwdot[O]/d[O2] */
-        J[176] -= dqdci;              /* dwdot[CO]/d[O2] */
-        J[177] += dqdci;              /* dwdot[CO2]/d[O2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[26][2] - 1)*dcdc_fac;
-        J[272] -= dqdci;              /* dwdot[O]/d[H2O] */
-        J[284] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[285] += dqdci;              /* dwdot[CO2]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[26][3] - 1)*dcdc_fac;
-        J[704] -= dqdci;              /* dwdot[O]/d[CH4] */
-        J[716] -= dqdci;              /* dwdot[CO]/d[CH4] */
-        J[717] += dqdci;              /* dwdot[CO2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[26][4] - 1)*dcdc_fac + k_f*sc[2];
-        J[758] -= dqdci;              /* dwdot[O]/d[CO] */
-        J[770] -= dqdci;              /* dwdot[CO]/d[CO] */
-        J[771] += dqdci;              /* dwdot[CO2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[26][5] - 1)*dcdc_fac - k_r;
-        J[812] -= dqdci;              /* dwdot[O]/d[CO2] */
-        J[824] -= dqdci;              /* dwdot[CO]/d[CO2] */
-        J[825] += dqdci;              /* dwdot[CO2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[26][6] - 1)*dcdc_fac;
-        J[1406] -= dqdci;             /* dwdot[O]/d[C2H6] */
-        J[1418] -= dqdci;             /* dwdot[CO]/d[C2H6] */
-        J[1419] += dqdci;             /* dwdot[CO2]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[26][7] - 1)*dcdc_fac;
-        J[2594] -= dqdci;             /* dwdot[O]/d[AR] */
-        J[2606] -= dqdci;             /* dwdot[CO]/d[AR] */
-        J[2607] += dqdci;             /* dwdot[CO2]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[26][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*sc[14];
-        dqdc[3] = TB[26][1]*dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[26][2]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[26][3]*dcdc_fac;
-        dqdc[14] = TB[26][4]*dcdc_fac + k_f*sc[2];
-        dqdc[15] = TB[26][5]*dcdc_fac - k_r;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[26][6]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[26][7]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+2] -= dqdc[k];
-            J[54*k+14] -= dqdc[k];
-            J[54*k+15] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] -= dcdc_fac;
+    Jmix[14] -= dcdc_fac;
+    Jmix[15] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[26][0] - 1)*dcdc_fac;
+    J[2] -= dqdci;                /* dwdot[O]/d[H2] */
+    J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
+    J[15] += dqdci;               /* dwdot[CO2]/d[H2] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[14];
+    J[110] -= dqdci;              /* dwdot[O]/d[O] */
+    J[122] -= dqdci;              /* dwdot[CO]/d[O] */
+    J[123] += dqdci;              /* dwdot[CO2]/d[O] */
+    /* d()/d[O2] */
+    dqdci = (TB[26][1] - 1)*dcdc_fac;
+    J[164] -= dqdci;              /* dwdot[O]/d[O2] */
+    J[176] -= dqdci;              /* dwdot[CO]/d[O2] */
+    J[177] += dqdci;              /* dwdot[CO2]/d[O2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[26][2] - 1)*dcdc_fac;
+    J[272] -= dqdci;              /* dwdot[O]/d[H2O] */
+    J[284] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[285] += dqdci;              /* dwdot[CO2]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[26][3] - 1)*dcdc_fac;
+    J[704] -= dqdci;              /* dwdot[O]/d[CH4] */
+    J[716] -= dqdci;              /* dwdot[CO]/d[CH4] */
+    J[717] += dqdci;              /* dwdot[CO2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[26][4] - 1)*dcdc_fac + k_f*sc[2];
+    J[758] -= dqdci;              /* dwdot[O]/d[CO] */
+    J[770] -= dqdci;              /* dwdot[CO]/d[CO] */
+    J[771] += dqdci;              /* dwdot[CO2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[26][5] - 1)*dcdc_fac - k_r;
+    J[812] -= dqdci;              /* dwdot[O]/d[CO2] */
+    J[824] -= dqdci;              /* dwdot[CO]/d[CO2] */
+    J[825] += dqdci;              /* dwdot[CO2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[26][6] - 1)*dcdc_fac;
+    J[1406] -= dqdci;             /* dwdot[O]/d[C2H6] */
+    J[1418] -= dqdci;             /* dwdot[CO]/d[C2H6] */
+    J[1419] += dqdci;             /* dwdot[CO2]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[26][7] - 1)*dcdc_fac;
+    J[2594] -= dqdci;             /* dwdot[O]/d[AR] */
+    J[2606] -= dqdci;             /* dwdot[CO]/d[AR] */
+    J[2607] += dqdci;             /* dwdot[CO2]/d[AR] */
     J[2864] -= dqdT; /* dwdot[O]/dT */
     J[2876] -= dqdT; /* dwdot[CO]/dT */
     J[2877] += dqdT; /* dwdot[CO2]/dT */
@@ -29294,8 +28528,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[27][0] - 1)*sc[0] + (TB[27][1] - 1)*sc[5] + (TB[27][2] - 1)*sc[13] + (TB[27][3] - 1)*sc[14] + (TB[27][4] - 1)*sc[15] + (TB[27][5] - 1)*sc[26] + (TB[27][6] - 1)*sc[48];
     /* forward */
     phi_f = sc[37];
-    k_f = prefactor_units[27] * fwd_A[27]
-                * exp(fwd_beta[27] * tc[0] - activation_units[27] * fwd_Ea[27] * invT);
+    k_f = k_f_s[27];
     dlnkfdT = fwd_beta[27] * invT + activation_units[27] * fwd_Ea[27] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[27] * exp(low_beta[27] * tc[0] - activation_units[27] * low_Ea[27] * invT);
@@ -29310,7 +28543,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = 0.0;
     /* reverse */
     phi_r = sc[2]*sc[47];
-    Kc = refC * exp(-g_RT[2] + g_RT[37] - g_RT[47]);
+    Kc = Kc_s[27];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[37]) + (h_RT[2] + h_RT[47]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29328,118 +28561,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[27][0] - 1)*dcdc_fac;
-        J[2] += dqdci;                /* dwdot[O]/d[H2] */
-        J[37] -= dqdci;               /* dwdot[N2O]/d[H2] */
-        J[47] += dqdci;               /* dwdot[N2]/d[H2] */
-        /* d()/d[O] */
-        dqdci =  - k_r*sc[47];
-        J[110] += dqdci;              /* dwdot[O]/d[O] */
-        J[145] -= dqdci;              /* dwdot[N2O]/d[O] */
-        J[155] += dqdci;              /* dwdot[N2]/d[O] */
-        /* d()/d[H2O] */
-        dqdci = (TB[27][1] - 1)*dcdc_fac;
-        J[272] += dqdci;              /* dwdot[O]/d[H2O] */
-        J[307] -= dqdci;              /* dwdot[N2O]/d[H2O] */
-        J[317] += dqdci;              /* dwdot[N2]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[27][2] - 1)*dcdc_fac;
-        J[704] += dqdci;              /* dwdot[O]/d[CH4] */
-        J[739] -= dqdci;              /* dwdot[N2O]/d[CH4] */
-        J[749] += dqdci;              /* dwdot[N2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[27][3] - 1)*dcdc_fac;
-        J[758] += dqdci;              /* dwdot[O]/d[CO] */
-        J[793] -= dqdci;              /* dwdot[N2O]/d[CO] */
-        J[803] += dqdci;              /* dwdot[N2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[27][4] - 1)*dcdc_fac;
-        J[812] += dqdci;              /* dwdot[O]/d[CO2] */
-        J[847] -= dqdci;              /* dwdot[N2O]/d[CO2] */
-        J[857] += dqdci;              /* dwdot[N2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[27][5] - 1)*dcdc_fac;
-        J[1406] += dqdci;             /* dwdot[O]/d[C2H6] */
-        J[1441] -= dqdci;             /* dwdot[N2O]/d[C2H6] */
-        J[1451] += dqdci;             /* dwdot[N2]/d[C2H6] */
-        /* d()/d[N2O] */
-        dqdci =  + k_f;
-        J[2000] += dqdci;             /* dwdot[O]/d[N2O] */
-        J[2035] -= dqdci;             /* dwdot[N2O]/d[N2O] */
-        J[2045] += dqdci;             /* dwdot[N2]/d[N2O] */
-        /* d()/d[N2] */
-        dqdci =  - k_r*sc[2];
-        J[2540] += dqdci;             /* dwdot[O]/d[N2] */
-        J[2575] -= dqdci;             /* dwdot[N2O]/d[N2] */
-        J[2585] += dqdci;             /* dwdot[N2]/d[N2] */
-        /* d()/d[AR] */
-        dqdci = (TB[27][6] - 1)*dcdc_fac;
-        J[2594] += dqdci;             /* dwdot[O]/d[AR] */
-        J[2629] -= dqdci;             /* dwdot[N2O]/d[AR] */
-        J[2639] += dqdci;             /* dwdot[N2]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[27][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac - k_r*sc[47];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[27][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[27][2]*dcdc_fac;
-        dqdc[14] = TB[27][3]*dcdc_fac;
-        dqdc[15] = TB[27][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[27][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac + k_f;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac - k_r*sc[2];
-        dqdc[48] = TB[27][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+2] += dqdc[k];
-            J[54*k+37] -= dqdc[k];
-            J[54*k+47] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] += dcdc_fac;
+    Jmix[37] -= dcdc_fac;
+    Jmix[47] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[27][0] - 1)*dcdc_fac;
+    J[2] += dqdci;                /* dwdot[O]/d[H2] */
+    J[37] -= dqdci;               /* dwdot[N2O]/d[H2] */
+    J[47] += dqdci;               /* dwdot[N2]/d[H2] */
+    /* d()/d[O] */
+    dqdci =  - k_r*sc[47];
+    J[110] += dqdci;              /* dwdot[O]/d[O] */
+    J[145] -= dqdci;              /* dwdot[N2O]/d[O] */
+    J[155] += dqdci;              /* dwdot[N2]/d[O] */
+    /* d()/d[H2O] */
+    dqdci = (TB[27][1] - 1)*dcdc_fac;
+    J[272] += dqdci;              /* dwdot[O]/d[H2O] */
+    J[307] -= dqdci;              /* dwdot[N2O]/d[H2O] */
+    J[317] += dqdci;              /* dwdot[N2]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[27][2] - 1)*dcdc_fac;
+    J[704] += dqdci;              /* dwdot[O]/d[CH4] */
+    J[739] -= dqdci;              /* dwdot[N2O]/d[CH4] */
+    J[749] += dqdci;              /* dwdot[N2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[27][3] - 1)*dcdc_fac;
+    J[758] += dqdci;              /* dwdot[O]/d[CO] */
+    J[793] -= dqdci;              /* dwdot[N2O]/d[CO] */
+    J[803] += dqdci;              /* dwdot[N2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[27][4] - 1)*dcdc_fac;
+    J[812] += dqdci;              /* dwdot[O]/d[CO2] */
+    J[847] -= dqdci;              /* dwdot[N2O]/d[CO2] */
+    J[857] += dqdci;              /* dwdot[N2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[27][5] - 1)*dcdc_fac;
+    J[1406] += dqdci;             /* dwdot[O]/d[C2H6] */
+    J[1441] -= dqdci;             /* dwdot[N2O]/d[C2H6] */
+    J[1451] += dqdci;             /* dwdot[N2]/d[C2H6] */
+    /* d()/d[N2O] */
+    dqdci =  + k_f;
+    J[2000] += dqdci;             /* dwdot[O]/d[N2O] */
+    J[2035] -= dqdci;             /* dwdot[N2O]/d[N2O] */
+    J[2045] += dqdci;             /* dwdot[N2]/d[N2O] */
+    /* d()/d[N2] */
+    dqdci =  - k_r*sc[2];
+    J[2540] += dqdci;             /* dwdot[O]/d[N2] */
+    J[2575] -= dqdci;             /* dwdot[N2O]/d[N2] */
+    J[2585] += dqdci;             /* dwdot[N2]/d[N2] */
+    /* d()/d[AR] */
+    dqdci = (TB[27][6] - 1)*dcdc_fac;
+    J[2594] += dqdci;             /* dwdot[O]/d[AR] */
+    J[2629] -= dqdci;             /* dwdot[N2O]/d[AR] */
+    J[2639] += dqdci;             /* dwdot[N2]/d[AR] */
     J[2864] += dqdT; /* dwdot[O]/dT */
     J[2899] -= dqdT; /* dwdot[N2O]/dT */
     J[2909] += dqdT; /* dwdot[N2]/dT */
@@ -29448,11 +28623,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[28][0] - 1)*sc[0] + (TB[28][1] - 1)*sc[5] + (TB[28][2] - 1)*sc[13] + (TB[28][3] - 1)*sc[14] + (TB[28][4] - 1)*sc[15] + (TB[28][5] - 1)*sc[26] + (TB[28][6] - 1)*sc[48];
+    alpha = (memcmp(TB[28], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[28][0] - 1)*sc[0] + (TB[28][1] - 1)*sc[5] + (TB[28][2] - 1)*sc[13] + (TB[28][3] - 1)*sc[14] + (TB[28][4] - 1)*sc[15] + (TB[28][5] - 1)*sc[26] + (TB[28][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[1]*sc[40];
-    k_f = prefactor_units[28] * fwd_A[28]
-                * exp(fwd_beta[28] * tc[0] - activation_units[28] * fwd_Ea[28] * invT);
+    k_f = k_f_s[28];
     dlnkfdT = fwd_beta[28] * invT + activation_units[28] * fwd_Ea[28] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[28] * exp(low_beta[28] * tc[0] - activation_units[28] * low_Ea[28] * invT);
@@ -29467,7 +28641,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = 0.0;
     /* reverse */
     phi_r = sc[41];
-    Kc = refCinv * exp(g_RT[1] + g_RT[40] - g_RT[41]);
+    Kc = Kc_s[28];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[40]) + (h_RT[41]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29485,118 +28659,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[28][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[40] -= dqdci;               /* dwdot[HCN]/d[H2] */
-        J[41] += dqdci;               /* dwdot[H2CN]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[40];
-        J[55] -= dqdci;               /* dwdot[H]/d[H] */
-        J[94] -= dqdci;               /* dwdot[HCN]/d[H] */
-        J[95] += dqdci;               /* dwdot[H2CN]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[28][1] - 1)*dcdc_fac;
-        J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[310] -= dqdci;              /* dwdot[HCN]/d[H2O] */
-        J[311] += dqdci;              /* dwdot[H2CN]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[28][2] - 1)*dcdc_fac;
-        J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[742] -= dqdci;              /* dwdot[HCN]/d[CH4] */
-        J[743] += dqdci;              /* dwdot[H2CN]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[28][3] - 1)*dcdc_fac;
-        J[757] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[796] -= dqdci;              /* dwdot[HCN]/d[CO] */
-        J[797] += dqdci;              /* dwdot[H2CN]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[28][4] - 1)*dcdc_fac;
-        J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[850] -= dqdci;              /* dwdot[HCN]/d[CO2] */
-        J[851] += dqdci;              /* dwdot[H2CN]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[28][5] - 1)*dcdc_fac;
-        J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1444] -= dqdci;             /* dwdot[HCN]/d[C2H6] */
-        J[1445] += dqdci;             /* dwdot[H2CN]/d[C2H6] */
-        /* d()/d[HCN] */
-        dqdci =  + k_f*sc[1];
-        J[2161] -= dqdci;             /* dwdot[H]/d[HCN] */
-        J[2200] -= dqdci;             /* dwdot[HCN]/d[HCN] */
-        J[2201] += dqdci;             /* dwdot[H2CN]/d[HCN] */
-        /* d()/d[H2CN] */
-        dqdci =  - k_r;
-        J[2215] -= dqdci;             /* dwdot[H]/d[H2CN] */
-        J[2254] -= dqdci;             /* dwdot[HCN]/d[H2CN] */
-        J[2255] += dqdci;             /* dwdot[H2CN]/d[H2CN] */
-        /* d()/d[AR] */
-        dqdci = (TB[28][6] - 1)*dcdc_fac;
-        J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2632] -= dqdci;             /* dwdot[HCN]/d[AR] */
-        J[2633] += dqdci;             /* dwdot[H2CN]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[28][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[40];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[28][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[28][2]*dcdc_fac;
-        dqdc[14] = TB[28][3]*dcdc_fac;
-        dqdc[15] = TB[28][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[28][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac + k_f*sc[1];
-        dqdc[41] = dcdc_fac - k_r;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[28][6]*dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+1] -= dqdc[k];
-            J[54*k+40] -= dqdc[k];
-            J[54*k+41] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[40] -= dcdc_fac;
+    Jmix[41] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[28][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[40] -= dqdci;               /* dwdot[HCN]/d[H2] */
+    J[41] += dqdci;               /* dwdot[H2CN]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[40];
+    J[55] -= dqdci;               /* dwdot[H]/d[H] */
+    J[94] -= dqdci;               /* dwdot[HCN]/d[H] */
+    J[95] += dqdci;               /* dwdot[H2CN]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[28][1] - 1)*dcdc_fac;
+    J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[310] -= dqdci;              /* dwdot[HCN]/d[H2O] */
+    J[311] += dqdci;              /* dwdot[H2CN]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[28][2] - 1)*dcdc_fac;
+    J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[742] -= dqdci;              /* dwdot[HCN]/d[CH4] */
+    J[743] += dqdci;              /* dwdot[H2CN]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[28][3] - 1)*dcdc_fac;
+    J[757] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[796] -= dqdci;              /* dwdot[HCN]/d[CO] */
+    J[797] += dqdci;              /* dwdot[H2CN]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[28][4] - 1)*dcdc_fac;
+    J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[850] -= dqdci;              /* dwdot[HCN]/d[CO2] */
+    J[851] += dqdci;              /* dwdot[H2CN]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[28][5] - 1)*dcdc_fac;
+    J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1444] -= dqdci;             /* dwdot[HCN]/d[C2H6] */
+    J[1445] += dqdci;             /* dwdot[H2CN]/d[C2H6] */
+    /* d()/d[HCN] */
+    dqdci =  + k_f*sc[1];
+    J[2161] -= dqdci;             /* dwdot[H]/d[HCN] */
+    J[2200] -= dqdci;             /* dwdot[HCN]/d[HCN] */
+    J[2201] += dqdci;             /* dwdot[H2CN]/d[HCN] */
+    /* d()/d[H2CN] */
+    dqdci =  - k_r;
+    J[2215] -= dqdci;             /* dwdot[H]/d[H2CN] */
+    J[2254] -= dqdci;             /* dwdot[HCN]/d[H2CN] */
+    J[2255] += dqdci;             /* dwdot[H2CN]/d[H2CN] */
+    /* d()/d[AR] */
+    dqdci = (TB[28][6] - 1)*dcdc_fac;
+    J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2632] -= dqdci;             /* dwdot[HCN]/d[AR] */
+    J[2633] += dqdci;             /* dwdot[H2CN]/d[AR] */
     J[2863] -= dqdT; /* dwdot[H]/dT */
     J[2902] -= dqdT; /* dwdot[HCN]/dT */
     J[2903] += dqdT; /* dwdot[H2CN]/dT */
@@ -29607,12 +28723,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[29][0] - 1)*sc[0] + (TB[29][1] - 1)*sc[5] + (TB[29][2] - 1)*sc[13] + (TB[29][3] - 1)*sc[14] + (TB[29][4] - 1)*sc[15] + (TB[29][5] - 1)*sc[26] + (TB[29][6] - 1)*sc[48];
     /* forward */
     phi_f = sc[2]*sc[2];
-    k_f = prefactor_units[29] * fwd_A[29]
-                * exp(fwd_beta[29] * tc[0] - activation_units[29] * fwd_Ea[29] * invT);
+    k_f = k_f_s[29];
     dlnkfdT = fwd_beta[29] * invT + activation_units[29] * fwd_Ea[29] * invT2;
     /* reverse */
     phi_r = sc[3];
-    Kc = refCinv * exp(2*g_RT[2] - g_RT[3]);
+    Kc = Kc_s[29];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[2]) + (h_RT[3]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29626,118 +28741,59 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[29][0] - 1)*q_nocor;
-        J[2] += -2 * dqdci;           /* dwdot[O]/d[H2] */
-        J[3] += dqdci;                /* dwdot[O2]/d[H2] */
-        /* d()/d[O] */
-        dqdci =  + k_f*2*sc[2];
-        J[110] += -2 * dqdci;         /* dwdot[O]/d[O] */
-        J[111] += dqdci;              /* dwdot[O2]/d[O] */
-        /* d()/d[O2] */
-        dqdci =  - k_r;
-        J[164] += -2 * dqdci;         /* dwdot[O]/d[O2] */
-        J[165] += dqdci;              /* dwdot[O2]/d[O2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[29][1] - 1)*q_nocor;
-        J[272] += -2 * dqdci;         /* dwdot[O]/d[H2O] */
-        J[273] += dqdci;              /* dwdot[O2]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[29][2] - 1)*q_nocor;
-        J[704] += -2 * dqdci;         /* dwdot[O]/d[CH4] */
-        J[705] += dqdci;              /* dwdot[O2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[29][3] - 1)*q_nocor;
-        J[758] += -2 * dqdci;         /* dwdot[O]/d[CO] */
-        J[759] += dqdci;              /* dwdot[O2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[29][4] - 1)*q_nocor;
-        J[812] += -2 * dqdci;         /* dwdot[O]/d[CO2] */
-        J[813] += dqdci;              /* dwdot[O2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[29][5] - 1)*q_nocor;
-        J[1406] += -2 * dqdci;        /* dwdot[O]/d[C2H6] */
-        J[1407] += dqdci;             /* dwdot[O2]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[29][6] - 1)*q_nocor;
-        J[2594] += -2 * dqdci;        /* dwdot[O]/d[AR] */
-        J[2595] += dqdci;             /* dwdot[O2]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[29][0];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*2*sc[2];
-        dqdc[3] = dcdc_fac - k_r;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[29][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[29][2];
-        dqdc[14] = TB[29][3];
-        dqdc[15] = TB[29][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[29][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[29][6];
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+2] += -2 * dqdc[k];
-            J[54*k+3] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] += -2 * q_nocor;
+    Jmix[3] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[29][0] - 1)*q_nocor;
+    J[2] += -2 * dqdci;           /* dwdot[O]/d[H2] */
+    J[3] += dqdci;                /* dwdot[O2]/d[H2] */
+    /* d()/d[O] */
+    dqdci =  + k_f*2*sc[2];
+    J[110] += -2 * dqdci;         /* dwdot[O]/d[O] */
+    J[111] += dqdci;              /* dwdot[O2]/d[O] */
+    /* d()/d[O2] */
+    dqdci =  - k_r;
+    J[164] += -2 * dqdci;         /* dwdot[O]/d[O2] */
+    J[165] += dqdci;              /* dwdot[O2]/d[O2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[29][1] - 1)*q_nocor;
+    J[272] += -2 * dqdci;         /* dwdot[O]/d[H2O] */
+    J[273] += dqdci;              /* dwdot[O2]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[29][2] - 1)*q_nocor;
+    J[704] += -2 * dqdci;         /* dwdot[O]/d[CH4] */
+    J[705] += dqdci;              /* dwdot[O2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[29][3] - 1)*q_nocor;
+    J[758] += -2 * dqdci;         /* dwdot[O]/d[CO] */
+    J[759] += dqdci;              /* dwdot[O2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[29][4] - 1)*q_nocor;
+    J[812] += -2 * dqdci;         /* dwdot[O]/d[CO2] */
+    J[813] += dqdci;              /* dwdot[O2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[29][5] - 1)*q_nocor;
+    J[1406] += -2 * dqdci;        /* dwdot[O]/d[C2H6] */
+    J[1407] += dqdci;             /* dwdot[O2]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[29][6] - 1)*q_nocor;
+    J[2594] += -2 * dqdci;        /* dwdot[O]/d[AR] */
+    J[2595] += dqdci;             /* dwdot[O2]/d[AR] */
     J[2864] += -2 * dqdT; /* dwdot[O]/dT */
     J[2865] += dqdT; /* dwdot[O2]/dT */
 
     /*reaction 31: O + H + M <=> OH + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[30][0] - 1)*sc[0] + (TB[30][1] - 1)*sc[5] + (TB[30][2] - 1)*sc[13] + (TB[30][3] - 1)*sc[14] + (TB[30][4] - 1)*sc[15] + (TB[30][5] - 1)*sc[26] + (TB[30][6] - 1)*sc[48];
+    alpha = (memcmp(TB[30], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[30][0] - 1)*sc[0] + (TB[30][1] - 1)*sc[5] + (TB[30][2] - 1)*sc[13] + (TB[30][3] - 1)*sc[14] + (TB[30][4] - 1)*sc[15] + (TB[30][5] - 1)*sc[26] + (TB[30][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[1]*sc[2];
-    k_f = prefactor_units[30] * fwd_A[30]
-                * exp(fwd_beta[30] * tc[0] - activation_units[30] * fwd_Ea[30] * invT);
+    k_f = k_f_s[30];
     dlnkfdT = fwd_beta[30] * invT + activation_units[30] * fwd_Ea[30] * invT2;
     /* reverse */
     phi_r = sc[4];
-    Kc = refCinv * exp(g_RT[1] + g_RT[2] - g_RT[4]);
+    Kc = Kc_s[30];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[2]) + (h_RT[4]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29752,118 +28808,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[30][0] - 1)*q_nocor;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[2] -= dqdci;                /* dwdot[O]/d[H2] */
-        J[4] += dqdci;                /* dwdot[OH]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[2];
-        J[55] -= dqdci;               /* dwdot[H]/d[H] */
-        J[56] -= dqdci;               /* dwdot[O]/d[H] */
-        J[58] += dqdci;               /* dwdot[OH]/d[H] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[1];
-        J[109] -= dqdci;              /* dwdot[H]/d[O] */
-        J[110] -= dqdci;              /* dwdot[O]/d[O] */
-        J[112] += dqdci;              /* dwdot[OH]/d[O] */
-        /* d()/d[OH] */
-        dqdci =  - k_r;
-        J[217] -= dqdci;              /* dwdot[H]/d[OH] */
-        J[218] -= dqdci;              /* dwdot[O]/d[OH] */
-        J[220] += dqdci;              /* dwdot[OH]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[30][1] - 1)*q_nocor;
-        J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[272] -= dqdci;              /* dwdot[O]/d[H2O] */
-        J[274] += dqdci;              /* dwdot[OH]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[30][2] - 1)*q_nocor;
-        J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[704] -= dqdci;              /* dwdot[O]/d[CH4] */
-        J[706] += dqdci;              /* dwdot[OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[30][3] - 1)*q_nocor;
-        J[757] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[758] -= dqdci;              /* dwdot[O]/d[CO] */
-        J[760] += dqdci;              /* dwdot[OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[30][4] - 1)*q_nocor;
-        J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[812] -= dqdci;              /* dwdot[O]/d[CO2] */
-        J[814] += dqdci;              /* dwdot[OH]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[30][5] - 1)*q_nocor;
-        J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1406] -= dqdci;             /* dwdot[O]/d[C2H6] */
-        J[1408] += dqdci;             /* dwdot[OH]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[30][6] - 1)*q_nocor;
-        J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2594] -= dqdci;             /* dwdot[O]/d[AR] */
-        J[2596] += dqdci;             /* dwdot[OH]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[30][0];
-        dqdc[1] = dcdc_fac + k_f*sc[2];
-        dqdc[2] = dcdc_fac + k_f*sc[1];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac - k_r;
-        dqdc[5] = TB[30][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[30][2];
-        dqdc[14] = TB[30][3];
-        dqdc[15] = TB[30][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[30][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[30][6];
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+1] -= dqdc[k];
-            J[54*k+2] -= dqdc[k];
-            J[54*k+4] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= q_nocor;
+    Jmix[2] -= q_nocor;
+    Jmix[4] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[30][0] - 1)*q_nocor;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[2] -= dqdci;                /* dwdot[O]/d[H2] */
+    J[4] += dqdci;                /* dwdot[OH]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[2];
+    J[55] -= dqdci;               /* dwdot[H]/d[H] */
+    J[56] -= dqdci;               /* dwdot[O]/d[H] */
+    J[58] += dqdci;               /* dwdot[OH]/d[H] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[1];
+    J[109] -= dqdci;              /* dwdot[H]/d[O] */
+    J[110] -= dqdci;              /* dwdot[O]/d[O] */
+    J[112] += dqdci;              /* dwdot[OH]/d[O] */
+    /* d()/d[OH] */
+    dqdci =  - k_r;
+    J[217] -= dqdci;              /* dwdot[H]/d[OH] */
+    J[218] -= dqdci;              /* dwdot[O]/d[OH] */
+    J[220] += dqdci;              /* dwdot[OH]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[30][1] - 1)*q_nocor;
+    J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[272] -= dqdci;              /* dwdot[O]/d[H2O] */
+    J[274] += dqdci;              /* dwdot[OH]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[30][2] - 1)*q_nocor;
+    J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[704] -= dqdci;              /* dwdot[O]/d[CH4] */
+    J[706] += dqdci;              /* dwdot[OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[30][3] - 1)*q_nocor;
+    J[757] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[758] -= dqdci;              /* dwdot[O]/d[CO] */
+    J[760] += dqdci;              /* dwdot[OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[30][4] - 1)*q_nocor;
+    J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[812] -= dqdci;              /* dwdot[O]/d[CO2] */
+    J[814] += dqdci;              /* dwdot[OH]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[30][5] - 1)*q_nocor;
+    J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1406] -= dqdci;             /* dwdot[O]/d[C2H6] */
+    J[1408] += dqdci;             /* dwdot[OH]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[30][6] - 1)*q_nocor;
+    J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2594] -= dqdci;             /* dwdot[O]/d[AR] */
+    J[2596] += dqdci;             /* dwdot[OH]/d[AR] */
     J[2863] -= dqdT; /* dwdot[H]/dT */
     J[2864] -= dqdT; /* dwdot[O]/dT */
     J[2866] += dqdT; /* dwdot[OH]/dT */
@@ -29874,12 +28872,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[31][0] - 1)*sc[3] + (TB[31][1] - 1)*sc[5] + (TB[31][2] - 1)*sc[14] + (TB[31][3] - 1)*sc[15] + (TB[31][4] - 1)*sc[26] + (TB[31][5] - 1)*sc[47] + (TB[31][6] - 1)*sc[48];
     /* forward */
     phi_f = sc[1]*sc[3];
-    k_f = prefactor_units[31] * fwd_A[31]
-                * exp(fwd_beta[31] * tc[0] - activation_units[31] * fwd_Ea[31] * invT);
+    k_f = k_f_s[31];
     dlnkfdT = fwd_beta[31] * invT + activation_units[31] * fwd_Ea[31] * invT2;
     /* reverse */
     phi_r = sc[6];
-    Kc = refCinv * exp(g_RT[1] + g_RT[3] - g_RT[6]);
+    Kc = Kc_s[31];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3]) + (h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29894,113 +28891,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[3];
-        J[55] -= dqdci;               /* dwdot[H]/d[H] */
-        J[57] -= dqdci;               /* dwdot[O2]/d[H] */
-        J[60] += dqdci;               /* dwdot[HO2]/d[H] */
-        /* d()/d[O2] */
-        dqdci = (TB[31][0] - 1)*q_nocor + k_f*sc[1];
-        J[163] -= dqdci;              /* dwdot[H]/d[O2] */
-        J[165] -= dqdci;              /* dwdot[O2]/d[O2] */
-        J[168] += dqdci;              /* dwdot[HO2]/d[O2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[31][1] - 1)*q_nocor;
-        J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[273] -= dqdci;              /* dwdot[O2]/d[H2O] */
-        J[276] += dqdci;              /* dwdot[HO2]/d[H2O] */
-        /* d()/d[HO2] */
-        dqdci =  - k_r;
-        J[325] -= dqdci;              /* dwdot[H]/d[HO2] */
-        J[327] -= dqdci;              /* dwdot[O2]/d[HO2] */
-        J[330] += dqdci;              /* dwdot[HO2]/d[HO2] */
-        /* d()/d[CO] */
-        dqdci = (TB[31][2] - 1)*q_nocor;
-        J[757] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[759] -= dqdci;              /* dwdot[O2]/d[CO] */
-        J[762] += dqdci;              /* dwdot[HO2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[31][3] - 1)*q_nocor;
-        J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[813] -= dqdci;              /* dwdot[O2]/d[CO2] */
-        J[816] += dqdci;              /* dwdot[HO2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[31][4] - 1)*q_nocor;
-        J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1407] -= dqdci;             /* dwdot[O2]/d[C2H6] */
-        J[1410] += dqdci;             /* dwdot[HO2]/d[C2H6] */
-        /* d()/d[N2] */
-        dqdci = (TB[31][5] - 1)*q_nocor;
-        J[2539] -= dqdci;             /* dwdot[H]/d[N2] */
-        J[2541] -= dqdci;             /* dwdot[O2]/d[N2] */
-        J[2544] += dqdci;             /* dwdot[HO2]/d[N2] */
-        /* d()/d[AR] */
-        dqdci = (TB[31][6] - 1)*q_nocor;
-        J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2595] -= dqdci;             /* dwdot[O2]/d[AR] */
-        J[2598] += dqdci;             /* dwdot[HO2]/d[AR] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[3];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = TB[31][0] + k_f*sc[1];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[31][1];
-        dqdc[6] = dcdc_fac - k_r;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = TB[31][2];
-        dqdc[15] = TB[31][3];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[31][4];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = TB[31][5];
-        dqdc[48] = TB[31][6];
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+1] -= dqdc[k];
-            J[54*k+3] -= dqdc[k];
-            J[54*k+6] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= q_nocor;
+    Jmix[3] -= q_nocor;
+    Jmix[6] += q_nocor;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[3];
+    J[55] -= dqdci;               /* dwdot[H]/d[H] */
+    J[57] -= dqdci;               /* dwdot[O2]/d[H] */
+    J[60] += dqdci;               /* dwdot[HO2]/d[H] */
+    /* d()/d[O2] */
+    dqdci = (TB[31][0] - 1)*q_nocor + k_f*sc[1];
+    J[163] -= dqdci;              /* dwdot[H]/d[O2] */
+    J[165] -= dqdci;              /* dwdot[O2]/d[O2] */
+    J[168] += dqdci;              /* dwdot[HO2]/d[O2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[31][1] - 1)*q_nocor;
+    J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[273] -= dqdci;              /* dwdot[O2]/d[H2O] */
+    J[276] += dqdci;              /* dwdot[HO2]/d[H2O] */
+    /* d()/d[HO2] */
+    dqdci =  - k_r;
+    J[325] -= dqdci;              /* dwdot[H]/d[HO2] */
+    J[327] -= dqdci;              /* dwdot[O2]/d[HO2] */
+    J[330] += dqdci;              /* dwdot[HO2]/d[HO2] */
+    /* d()/d[CO] */
+    dqdci = (TB[31][2] - 1)*q_nocor;
+    J[757] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[759] -= dqdci;              /* dwdot[O2]/d[CO] */
+    J[762] += dqdci;              /* dwdot[HO2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[31][3] - 1)*q_nocor;
+    J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[813] -= dqdci;              /* dwdot[O2]/d[CO2] */
+    J[816] += dqdci;              /* dwdot[HO2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[31][4] - 1)*q_nocor;
+    J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1407] -= dqdci;             /* dwdot[O2]/d[C2H6] */
+    J[1410] += dqdci;             /* dwdot[HO2]/d[C2H6] */
+    /* d()/d[N2] */
+    dqdci = (TB[31][5] - 1)*q_nocor;
+    J[2539] -= dqdci;             /* dwdot[H]/d[N2] */
+    J[2541] -= dqdci;             /* dwdot[O2]/d[N2] */
+    J[2544] += dqdci;             /* dwdot[HO2]/d[N2] */
+    /* d()/d[AR] */
+    dqdci = (TB[31][6] - 1)*q_nocor;
+    J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2595] -= dqdci;             /* dwdot[O2]/d[AR] */
+    J[2598] += dqdci;             /* dwdot[HO2]/d[AR] */
     J[2863] -= dqdT; /* dwdot[H]/dT */
     J[2865] -= dqdT; /* dwdot[O2]/dT */
     J[2868] += dqdT; /* dwdot[HO2]/dT */
@@ -30011,12 +28950,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[32][0] - 1)*sc[0] + (TB[32][1] - 1)*sc[5] + (TB[32][2] - 1)*sc[13] + (TB[32][3] - 1)*sc[15] + (TB[32][4] - 1)*sc[26] + (TB[32][5] - 1)*sc[48];
     /* forward */
     phi_f = sc[1]*sc[1];
-    k_f = prefactor_units[32] * fwd_A[32]
-                * exp(fwd_beta[32] * tc[0] - activation_units[32] * fwd_Ea[32] * invT);
+    k_f = k_f_s[32];
     dlnkfdT = fwd_beta[32] * invT + activation_units[32] * fwd_Ea[32] * invT2;
     /* reverse */
     phi_r = sc[0];
-    Kc = refCinv * exp(-g_RT[0] + 2*g_RT[1]);
+    Kc = Kc_s[32];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[1]) + (h_RT[0]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30030,95 +28968,37 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[32][0] - 1)*q_nocor - k_r;
-        J[0] += dqdci;                /* dwdot[H2]/d[H2] */
-        J[1] += -2 * dqdci;           /* dwdot[H]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*2*sc[1];
-        J[54] += dqdci;               /* dwdot[H2]/d[H] */
-        J[55] += -2 * dqdci;          /* dwdot[H]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[32][1] - 1)*q_nocor;
-        J[270] += dqdci;              /* dwdot[H2]/d[H2O] */
-        J[271] += -2 * dqdci;         /* dwdot[H]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[32][2] - 1)*q_nocor;
-        J[702] += dqdci;              /* dwdot[H2]/d[CH4] */
-        J[703] += -2 * dqdci;         /* dwdot[H]/d[CH4] */
-        /* d()/d[CO2] */
-        dqdci = (TB[32][3] - 1)*q_nocor;
-        J[810] += dqdci;              /* dwdot[H2]/d[CO2] */
-        J[811] += -2 * dqdci;         /* dwdot[H]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[32][4] - 1)*q_nocor;
-        J[1404] += dqdci;             /* dwdot[H2]/d[C2H6] */
-        J[1405] += -2 * dqdci;        /* dwdot[H]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[32][5] - 1)*q_nocor;
-        J[2592] += dqdci;             /* dwdot[H2]/d[AR] */
-        J[2593] += -2 * dqdci;        /* dwdot[H]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[32][0] - k_r;
-        dqdc[1] = dcdc_fac + k_f*2*sc[1];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[32][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[32][2];
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[32][3];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[32][4];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[32][5];
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+0] += dqdc[k];
-            J[54*k+1] += -2 * dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += q_nocor;
+    Jmix[1] += -2 * q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[32][0] - 1)*q_nocor - k_r;
+    J[0] += dqdci;                /* dwdot[H2]/d[H2] */
+    J[1] += -2 * dqdci;           /* dwdot[H]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*2*sc[1];
+    J[54] += dqdci;               /* dwdot[H2]/d[H] */
+    J[55] += -2 * dqdci;          /* dwdot[H]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[32][1] - 1)*q_nocor;
+    J[270] += dqdci;              /* dwdot[H2]/d[H2O] */
+    J[271] += -2 * dqdci;         /* dwdot[H]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[32][2] - 1)*q_nocor;
+    J[702] += dqdci;              /* dwdot[H2]/d[CH4] */
+    J[703] += -2 * dqdci;         /* dwdot[H]/d[CH4] */
+    /* d()/d[CO2] */
+    dqdci = (TB[32][3] - 1)*q_nocor;
+    J[810] += dqdci;              /* dwdot[H2]/d[CO2] */
+    J[811] += -2 * dqdci;         /* dwdot[H]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[32][4] - 1)*q_nocor;
+    J[1404] += dqdci;             /* dwdot[H2]/d[C2H6] */
+    J[1405] += -2 * dqdci;        /* dwdot[H]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[32][5] - 1)*q_nocor;
+    J[2592] += dqdci;             /* dwdot[H2]/d[AR] */
+    J[2593] += -2 * dqdci;        /* dwdot[H]/d[AR] */
     J[2862] += dqdT; /* dwdot[H2]/dT */
     J[2863] += -2 * dqdT; /* dwdot[H]/dT */
 
@@ -30128,12 +29008,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[33][0] - 1)*sc[0] + (TB[33][1] - 1)*sc[5] + (TB[33][2] - 1)*sc[13] + (TB[33][3] - 1)*sc[26] + (TB[33][4] - 1)*sc[48];
     /* forward */
     phi_f = sc[1]*sc[4];
-    k_f = prefactor_units[33] * fwd_A[33]
-                * exp(fwd_beta[33] * tc[0] - activation_units[33] * fwd_Ea[33] * invT);
+    k_f = k_f_s[33];
     dlnkfdT = fwd_beta[33] * invT + activation_units[33] * fwd_Ea[33] * invT2;
     /* reverse */
     phi_r = sc[5];
-    Kc = refCinv * exp(g_RT[1] + g_RT[4] - g_RT[5]);
+    Kc = Kc_s[33];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[4]) + (h_RT[5]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30148,103 +29027,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[33][0] - 1)*q_nocor;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[4] -= dqdci;                /* dwdot[OH]/d[H2] */
-        J[5] += dqdci;                /* dwdot[H2O]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[4];
-        J[55] -= dqdci;               /* dwdot[H]/d[H] */
-        J[58] -= dqdci;               /* dwdot[OH]/d[H] */
-        J[59] += dqdci;               /* dwdot[H2O]/d[H] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*sc[1];
-        J[217] -= dqdci;              /* dwdot[H]/d[OH] */
-        J[220] -= dqdci;              /* dwdot[OH]/d[OH] */
-        J[221] += dqdci;              /* dwdot[H2O]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[33][1] - 1)*q_nocor - k_r;
-        J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[274] -= dqdci;              /* dwdot[OH]/d[H2O] */
-        J[275] += dqdci;              /* dwdot[H2O]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[33][2] - 1)*q_nocor;
-        J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[706] -= dqdci;              /* dwdot[OH]/d[CH4] */
-        J[707] += dqdci;              /* dwdot[H2O]/d[CH4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[33][3] - 1)*q_nocor;
-        J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1408] -= dqdci;             /* dwdot[OH]/d[C2H6] */
-        J[1409] += dqdci;             /* dwdot[H2O]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[33][4] - 1)*q_nocor;
-        J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2596] -= dqdci;             /* dwdot[OH]/d[AR] */
-        J[2597] += dqdci;             /* dwdot[H2O]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[33][0];
-        dqdc[1] = dcdc_fac + k_f*sc[4];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac + k_f*sc[1];
-        dqdc[5] = TB[33][1] - k_r;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[33][2];
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[33][3];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[33][4];
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+1] -= dqdc[k];
-            J[54*k+4] -= dqdc[k];
-            J[54*k+5] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= q_nocor;
+    Jmix[4] -= q_nocor;
+    Jmix[5] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[33][0] - 1)*q_nocor;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[4] -= dqdci;                /* dwdot[OH]/d[H2] */
+    J[5] += dqdci;                /* dwdot[H2O]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[4];
+    J[55] -= dqdci;               /* dwdot[H]/d[H] */
+    J[58] -= dqdci;               /* dwdot[OH]/d[H] */
+    J[59] += dqdci;               /* dwdot[H2O]/d[H] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*sc[1];
+    J[217] -= dqdci;              /* dwdot[H]/d[OH] */
+    J[220] -= dqdci;              /* dwdot[OH]/d[OH] */
+    J[221] += dqdci;              /* dwdot[H2O]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[33][1] - 1)*q_nocor - k_r;
+    J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[274] -= dqdci;              /* dwdot[OH]/d[H2O] */
+    J[275] += dqdci;              /* dwdot[H2O]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[33][2] - 1)*q_nocor;
+    J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[706] -= dqdci;              /* dwdot[OH]/d[CH4] */
+    J[707] += dqdci;              /* dwdot[H2O]/d[CH4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[33][3] - 1)*q_nocor;
+    J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1408] -= dqdci;             /* dwdot[OH]/d[C2H6] */
+    J[1409] += dqdci;             /* dwdot[H2O]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[33][4] - 1)*q_nocor;
+    J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2596] -= dqdci;             /* dwdot[OH]/d[AR] */
+    J[2597] += dqdci;             /* dwdot[H2O]/d[AR] */
     J[2863] -= dqdT; /* dwdot[H]/dT */
     J[2866] -= dqdT; /* dwdot[OH]/dT */
     J[2867] += dqdT; /* dwdot[H2O]/dT */
@@ -30255,12 +29076,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[34][0] - 1)*sc[0] + (TB[34][1] - 1)*sc[5] + (TB[34][2] - 1)*sc[13] + (TB[34][3] - 1)*sc[14] + (TB[34][4] - 1)*sc[15] + (TB[34][5] - 1)*sc[26];
     /* forward */
     phi_f = sc[16];
-    k_f = prefactor_units[34] * fwd_A[34]
-                * exp(fwd_beta[34] * tc[0] - activation_units[34] * fwd_Ea[34] * invT);
+    k_f = k_f_s[34];
     dlnkfdT = fwd_beta[34] * invT + activation_units[34] * fwd_Ea[34] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14];
-    Kc = refC * exp(-g_RT[1] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[34];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16]) + (h_RT[1] + h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30275,108 +29095,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[34][0] - 1)*q_nocor;
-        J[1] += dqdci;                /* dwdot[H]/d[H2] */
-        J[14] += dqdci;               /* dwdot[CO]/d[H2] */
-        J[16] -= dqdci;               /* dwdot[HCO]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[14];
-        J[55] += dqdci;               /* dwdot[H]/d[H] */
-        J[68] += dqdci;               /* dwdot[CO]/d[H] */
-        J[70] -= dqdci;               /* dwdot[HCO]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[34][1] - 1)*q_nocor;
-        J[271] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[284] += dqdci;              /* dwdot[CO]/d[H2O] */
-        J[286] -= dqdci;              /* dwdot[HCO]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[34][2] - 1)*q_nocor;
-        J[703] += dqdci;              /* dwdot[H]/d[CH4] */
-        J[716] += dqdci;              /* dwdot[CO]/d[CH4] */
-        J[718] -= dqdci;              /* dwdot[HCO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[34][3] - 1)*q_nocor - k_r*sc[1];
-        J[757] += dqdci;              /* dwdot[H]/d[CO] */
-        J[770] += dqdci;              /* dwdot[CO]/d[CO] */
-        J[772] -= dqdci;              /* dwdot[HCO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[34][4] - 1)*q_nocor;
-        J[811] += dqdci;              /* dwdot[H]/d[CO2] */
-        J[824] += dqdci;              /* dwdot[CO]/d[CO2] */
-        J[826] -= dqdci;              /* dwdot[HCO]/d[CO2] */
-        /* d()/d[HCO] */
-        dqdci =  + k_f;
-        J[865] += dqdci;              /* dwdot[H]/d[HCO] */
-        J[878] += dqdci;              /* dwdot[CO]/d[HCO] */
-        J[880] -= dqdci;              /* dwdot[HCO]/d[HCO] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[34][5] - 1)*q_nocor;
-        J[1405] += dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1418] += dqdci;             /* dwdot[CO]/d[C2H6] */
-        J[1420] -= dqdci;             /* dwdot[HCO]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[34][0];
-        dqdc[1] = dcdc_fac - k_r*sc[14];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[34][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[34][2];
-        dqdc[14] = TB[34][3] - k_r*sc[1];
-        dqdc[15] = TB[34][4];
-        dqdc[16] = dcdc_fac + k_f;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[34][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+1] += dqdc[k];
-            J[54*k+14] += dqdc[k];
-            J[54*k+16] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] += q_nocor;
+    Jmix[14] += q_nocor;
+    Jmix[16] -= q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[34][0] - 1)*q_nocor;
+    J[1] += dqdci;                /* dwdot[H]/d[H2] */
+    J[14] += dqdci;               /* dwdot[CO]/d[H2] */
+    J[16] -= dqdci;               /* dwdot[HCO]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[14];
+    J[55] += dqdci;               /* dwdot[H]/d[H] */
+    J[68] += dqdci;               /* dwdot[CO]/d[H] */
+    J[70] -= dqdci;               /* dwdot[HCO]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[34][1] - 1)*q_nocor;
+    J[271] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[284] += dqdci;              /* dwdot[CO]/d[H2O] */
+    J[286] -= dqdci;              /* dwdot[HCO]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[34][2] - 1)*q_nocor;
+    J[703] += dqdci;              /* dwdot[H]/d[CH4] */
+    J[716] += dqdci;              /* dwdot[CO]/d[CH4] */
+    J[718] -= dqdci;              /* dwdot[HCO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[34][3] - 1)*q_nocor - k_r*sc[1];
+    J[757] += dqdci;              /* dwdot[H]/d[CO] */
+    J[770] += dqdci;              /* dwdot[CO]/d[CO] */
+    J[772] -= dqdci;              /* dwdot[HCO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[34][4] - 1)*q_nocor;
+    J[811] += dqdci;              /* dwdot[H]/d[CO2] */
+    J[824] += dqdci;              /* dwdot[CO]/d[CO2] */
+    J[826] -= dqdci;              /* dwdot[HCO]/d[CO2] */
+    /* d()/d[HCO] */
+    dqdci =  + k_f;
+    J[865] += dqdci;              /* dwdot[H]/d[HCO] */
+    J[878] += dqdci;              /* dwdot[CO]/d[HCO] */
+    J[880] -= dqdci;              /* dwdot[HCO]/d[HCO] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[34][5] - 1)*q_nocor;
+    J[1405] += dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1418] += dqdci;             /* dwdot[CO]/d[C2H6] */
+    J[1420] -= dqdci;             /* dwdot[HCO]/d[C2H6] */
     J[2863] += dqdT; /* dwdot[H]/dT */
     J[2876] += dqdT; /* dwdot[CO]/dT */
     J[2878] -= dqdT; /* dwdot[HCO]/dT */
@@ -30384,15 +29146,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 36: NO + O + M <=> NO2 + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[35][0] - 1)*sc[0] + (TB[35][1] - 1)*sc[5] + (TB[35][2] - 1)*sc[13] + (TB[35][3] - 1)*sc[14] + (TB[35][4] - 1)*sc[15] + (TB[35][5] - 1)*sc[26] + (TB[35][6] - 1)*sc[48];
+    alpha = (memcmp(TB[35], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[35][0] - 1)*sc[0] + (TB[35][1] - 1)*sc[5] + (TB[35][2] - 1)*sc[13] + (TB[35][3] - 1)*sc[14] + (TB[35][4] - 1)*sc[15] + (TB[35][5] - 1)*sc[26] + (TB[35][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[2]*sc[35];
-    k_f = prefactor_units[35] * fwd_A[35]
-                * exp(fwd_beta[35] * tc[0] - activation_units[35] * fwd_Ea[35] * invT);
+    k_f = k_f_s[35];
     dlnkfdT = fwd_beta[35] * invT + activation_units[35] * fwd_Ea[35] * invT2;
     /* reverse */
     phi_r = sc[36];
-    Kc = refCinv * exp(g_RT[2] + g_RT[35] - g_RT[36]);
+    Kc = Kc_s[35];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[35]) + (h_RT[36]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30407,118 +29168,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[35][0] - 1)*q_nocor;
-        J[2] -= dqdci;                /* dwdot[O]/d[H2] */
-        J[35] -= dqdci;               /* dwdot[NO]/d[H2] */
-        J[36] += dqdci;               /* dwdot[NO2]/d[H2] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[35];
-        J[110] -= dqdci;              /* dwdot[O]/d[O] */
-        J[143] -= dqdci;              /* dwdot[NO]/d[O] */
-        J[144] += dqdci;              /* dwdot[NO2]/d[O] */
-        /* d()/d[H2O] */
-        dqdci = (TB[35][1] - 1)*q_nocor;
-        J[272] -= dqdci;              /* dwdot[O]/d[H2O] */
-        J[305] -= dqdci;              /* dwdot[NO]/d[H2O] */
-        J[306] += dqdci;              /* dwdot[NO2]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[35][2] - 1)*q_nocor;
-        J[704] -= dqdci;              /* dwdot[O]/d[CH4] */
-        J[737] -= dqdci;              /* dwdot[NO]/d[CH4] */
-        J[738] += dqdci;              /* dwdot[NO2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[35][3] - 1)*q_nocor;
-        J[758] -= dqdci;              /* dwdot[O]/d[CO] */
-        J[791] -= dqdci;              /* dwdot[NO]/d[CO] */
-        J[792] += dqdci;              /* dwdot[NO2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[35][4] - 1)*q_nocor;
-        J[812] -= dqdci;              /* dwdot[O]/d[CO2] */
-        J[845] -= dqdci;              /* dwdot[NO]/d[CO2] */
-        J[846] += dqdci;              /* dwdot[NO2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[35][5] - 1)*q_nocor;
-        J[1406] -= dqdci;             /* dwdot[O]/d[C2H6] */
-        J[1439] -= dqdci;             /* dwdot[NO]/d[C2H6] */
-        J[1440] += dqdci;             /* dwdot[NO2]/d[C2H6] */
-        /* d()/d[NO] */
-        dqdci =  + k_f*sc[2];
-        J[1892] -= dqdci;             /* dwdot[O]/d[NO] */
-        J[1925] -= dqdci;             /* dwdot[NO]/d[NO] */
-        J[1926] += dqdci;             /* dwdot[NO2]/d[NO] */
-        /* d()/d[NO2] */
-        dqdci =  - k_r;
-        J[1946] -= dqdci;             /* dwdot[O]/d[NO2] */
-        J[1979] -= dqdci;             /* dwdot[NO]/d[NO2] */
-        J[1980] += dqdci;             /* dwdot[NO2]/d[NO2] */
-        /* d()/d[AR] */
-        dqdci = (TB[35][6] - 1)*q_nocor;
-        J[2594] -= dqdci;             /* dwdot[O]/d[AR] */
-        J[2627] -= dqdci;             /* dwdot[NO]/d[AR] */
-        J[2628] += dqdci;             /* dwdot[NO2]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[35][0];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*sc[35];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[35][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[35][2];
-        dqdc[14] = TB[35][3];
-        dqdc[15] = TB[35][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[35][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac + k_f*sc[2];
-        dqdc[36] = dcdc_fac - k_r;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[35][6];
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+2] -= dqdc[k];
-            J[54*k+35] -= dqdc[k];
-            J[54*k+36] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] -= q_nocor;
+    Jmix[35] -= q_nocor;
+    Jmix[36] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[35][0] - 1)*q_nocor;
+    J[2] -= dqdci;                /* dwdot[O]/d[H2] */
+    J[35] -= dqdci;               /* dwdot[NO]/d[H2] */
+    J[36] += dqdci;               /* dwdot[NO2]/d[H2] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[35];
+    J[110] -= dqdci;              /* dwdot[O]/d[O] */
+    J[143] -= dqdci;              /* dwdot[NO]/d[O] */
+    J[144] += dqdci;              /* dwdot[NO2]/d[O] */
+    /* d()/d[H2O] */
+    dqdci = (TB[35][1] - 1)*q_nocor;
+    J[272] -= dqdci;              /* dwdot[O]/d[H2O] */
+    J[305] -= dqdci;              /* dwdot[NO]/d[H2O] */
+    J[306] += dqdci;              /* dwdot[NO2]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[35][2] - 1)*q_nocor;
+    J[704] -= dqdci;              /* dwdot[O]/d[CH4] */
+    J[737] -= dqdci;              /* dwdot[NO]/d[CH4] */
+    J[738] += dqdci;              /* dwdot[NO2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[35][3] - 1)*q_nocor;
+    J[758] -= dqdci;              /* dwdot[O]/d[CO] */
+    J[791] -= dqdci;              /* dwdot[NO]/d[CO] */
+    J[792] += dqdci;              /* dwdot[NO2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[35][4] - 1)*q_nocor;
+    J[812] -= dqdci;              /* dwdot[O]/d[CO2] */
+    J[845] -= dqdci;              /* dwdot[NO]/d[CO2] */
+    J[846] += dqdci;              /* dwdot[NO2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[35][5] - 1)*q_nocor;
+    J[1406] -= dqdci;             /* dwdot[O]/d[C2H6] */
+    J[1439] -= dqdci;             /* dwdot[NO]/d[C2H6] */
+    J[1440] += dqdci;             /* dwdot[NO2]/d[C2H6] */
+    /* d()/d[NO] */
+    dqdci =  + k_f*sc[2];
+    J[1892] -= dqdci;             /* dwdot[O]/d[NO] */
+    J[1925] -= dqdci;             /* dwdot[NO]/d[NO] */
+    J[1926] += dqdci;             /* dwdot[NO2]/d[NO] */
+    /* d()/d[NO2] */
+    dqdci =  - k_r;
+    J[1946] -= dqdci;             /* dwdot[O]/d[NO2] */
+    J[1979] -= dqdci;             /* dwdot[NO]/d[NO2] */
+    J[1980] += dqdci;             /* dwdot[NO2]/d[NO2] */
+    /* d()/d[AR] */
+    dqdci = (TB[35][6] - 1)*q_nocor;
+    J[2594] -= dqdci;             /* dwdot[O]/d[AR] */
+    J[2627] -= dqdci;             /* dwdot[NO]/d[AR] */
+    J[2628] += dqdci;             /* dwdot[NO2]/d[AR] */
     J[2864] -= dqdT; /* dwdot[O]/dT */
     J[2897] -= dqdT; /* dwdot[NO]/dT */
     J[2898] += dqdT; /* dwdot[NO2]/dT */
@@ -30526,15 +29229,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 37: NNH + M <=> N2 + H + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[36][0] - 1)*sc[0] + (TB[36][1] - 1)*sc[5] + (TB[36][2] - 1)*sc[13] + (TB[36][3] - 1)*sc[14] + (TB[36][4] - 1)*sc[15] + (TB[36][5] - 1)*sc[26] + (TB[36][6] - 1)*sc[48];
+    alpha = (memcmp(TB[36], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[36][0] - 1)*sc[0] + (TB[36][1] - 1)*sc[5] + (TB[36][2] - 1)*sc[13] + (TB[36][3] - 1)*sc[14] + (TB[36][4] - 1)*sc[15] + (TB[36][5] - 1)*sc[26] + (TB[36][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[34];
-    k_f = prefactor_units[36] * fwd_A[36]
-                * exp(fwd_beta[36] * tc[0] - activation_units[36] * fwd_Ea[36] * invT);
+    k_f = k_f_s[36];
     dlnkfdT = fwd_beta[36] * invT + activation_units[36] * fwd_Ea[36] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[47];
-    Kc = refC * exp(-g_RT[1] + g_RT[34] - g_RT[47]);
+    Kc = Kc_s[36];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[34]) + (h_RT[1] + h_RT[47]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30549,118 +29251,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[36][0] - 1)*q_nocor;
-        J[1] += dqdci;                /* dwdot[H]/d[H2] */
-        J[34] -= dqdci;               /* dwdot[NNH]/d[H2] */
-        J[47] += dqdci;               /* dwdot[N2]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[47];
-        J[55] += dqdci;               /* dwdot[H]/d[H] */
-        J[88] -= dqdci;               /* dwdot[NNH]/d[H] */
-        J[101] += dqdci;              /* dwdot[N2]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[36][1] - 1)*q_nocor;
-        J[271] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[304] -= dqdci;              /* dwdot[NNH]/d[H2O] */
-        J[317] += dqdci;              /* dwdot[N2]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[36][2] - 1)*q_nocor;
-        J[703] += dqdci;              /* dwdot[H]/d[CH4] */
-        J[736] -= dqdci;              /* dwdot[NNH]/d[CH4] */
-        J[749] += dqdci;              /* dwdot[N2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[36][3] - 1)*q_nocor;
-        J[757] += dqdci;              /* dwdot[H]/d[CO] */
-        J[790] -= dqdci;              /* dwdot[NNH]/d[CO] */
-        J[803] += dqdci;              /* dwdot[N2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[36][4] - 1)*q_nocor;
-        J[811] += dqdci;              /* dwdot[H]/d[CO2] */
-        J[844] -= dqdci;              /* dwdot[NNH]/d[CO2] */
-        J[857] += dqdci;              /* dwdot[N2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[36][5] - 1)*q_nocor;
-        J[1405] += dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1438] -= dqdci;             /* dwdot[NNH]/d[C2H6] */
-        J[1451] += dqdci;             /* dwdot[N2]/d[C2H6] */
-        /* d()/d[NNH] */
-        dqdci =  + k_f;
-        J[1837] += dqdci;             /* dwdot[H]/d[NNH] */
-        J[1870] -= dqdci;             /* dwdot[NNH]/d[NNH] */
-        J[1883] += dqdci;             /* dwdot[N2]/d[NNH] */
-        /* d()/d[N2] */
-        dqdci =  - k_r*sc[1];
-        J[2539] += dqdci;             /* dwdot[H]/d[N2] */
-        J[2572] -= dqdci;             /* dwdot[NNH]/d[N2] */
-        J[2585] += dqdci;             /* dwdot[N2]/d[N2] */
-        /* d()/d[AR] */
-        dqdci = (TB[36][6] - 1)*q_nocor;
-        J[2593] += dqdci;             /* dwdot[H]/d[AR] */
-        J[2626] -= dqdci;             /* dwdot[NNH]/d[AR] */
-        J[2639] += dqdci;             /* dwdot[N2]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[36][0];
-        dqdc[1] = dcdc_fac - k_r*sc[47];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[36][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[36][2];
-        dqdc[14] = TB[36][3];
-        dqdc[15] = TB[36][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[36][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac + k_f;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac - k_r*sc[1];
-        dqdc[48] = TB[36][6];
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+1] += dqdc[k];
-            J[54*k+34] -= dqdc[k];
-            J[54*k+47] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] += q_nocor;
+    Jmix[34] -= q_nocor;
+    Jmix[47] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[36][0] - 1)*q_nocor;
+    J[1] += dqdci;                /* dwdot[H]/d[H2] */
+    J[34] -= dqdci;               /* dwdot[NNH]/d[H2] */
+    J[47] += dqdci;               /* dwdot[N2]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[47];
+    J[55] += dqdci;               /* dwdot[H]/d[H] */
+    J[88] -= dqdci;               /* dwdot[NNH]/d[H] */
+    J[101] += dqdci;              /* dwdot[N2]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[36][1] - 1)*q_nocor;
+    J[271] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[304] -= dqdci;              /* dwdot[NNH]/d[H2O] */
+    J[317] += dqdci;              /* dwdot[N2]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[36][2] - 1)*q_nocor;
+    J[703] += dqdci;              /* dwdot[H]/d[CH4] */
+    J[736] -= dqdci;              /* dwdot[NNH]/d[CH4] */
+    J[749] += dqdci;              /* dwdot[N2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[36][3] - 1)*q_nocor;
+    J[757] += dqdci;              /* dwdot[H]/d[CO] */
+    J[790] -= dqdci;              /* dwdot[NNH]/d[CO] */
+    J[803] += dqdci;              /* dwdot[N2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[36][4] - 1)*q_nocor;
+    J[811] += dqdci;              /* dwdot[H]/d[CO2] */
+    J[844] -= dqdci;              /* dwdot[NNH]/d[CO2] */
+    J[857] += dqdci;              /* dwdot[N2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[36][5] - 1)*q_nocor;
+    J[1405] += dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1438] -= dqdci;             /* dwdot[NNH]/d[C2H6] */
+    J[1451] += dqdci;             /* dwdot[N2]/d[C2H6] */
+    /* d()/d[NNH] */
+    dqdci =  + k_f;
+    J[1837] += dqdci;             /* dwdot[H]/d[NNH] */
+    J[1870] -= dqdci;             /* dwdot[NNH]/d[NNH] */
+    J[1883] += dqdci;             /* dwdot[N2]/d[NNH] */
+    /* d()/d[N2] */
+    dqdci =  - k_r*sc[1];
+    J[2539] += dqdci;             /* dwdot[H]/d[N2] */
+    J[2572] -= dqdci;             /* dwdot[NNH]/d[N2] */
+    J[2585] += dqdci;             /* dwdot[N2]/d[N2] */
+    /* d()/d[AR] */
+    dqdci = (TB[36][6] - 1)*q_nocor;
+    J[2593] += dqdci;             /* dwdot[H]/d[AR] */
+    J[2626] -= dqdci;             /* dwdot[NNH]/d[AR] */
+    J[2639] += dqdci;             /* dwdot[N2]/d[AR] */
     J[2863] += dqdT; /* dwdot[H]/dT */
     J[2896] -= dqdT; /* dwdot[NNH]/dT */
     J[2909] += dqdT; /* dwdot[N2]/dT */
@@ -30668,15 +29312,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 38: H + NO + M <=> HNO + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[37][0] - 1)*sc[0] + (TB[37][1] - 1)*sc[5] + (TB[37][2] - 1)*sc[13] + (TB[37][3] - 1)*sc[14] + (TB[37][4] - 1)*sc[15] + (TB[37][5] - 1)*sc[26] + (TB[37][6] - 1)*sc[48];
+    alpha = (memcmp(TB[37], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[37][0] - 1)*sc[0] + (TB[37][1] - 1)*sc[5] + (TB[37][2] - 1)*sc[13] + (TB[37][3] - 1)*sc[14] + (TB[37][4] - 1)*sc[15] + (TB[37][5] - 1)*sc[26] + (TB[37][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[1]*sc[35];
-    k_f = prefactor_units[37] * fwd_A[37]
-                * exp(fwd_beta[37] * tc[0] - activation_units[37] * fwd_Ea[37] * invT);
+    k_f = k_f_s[37];
     dlnkfdT = fwd_beta[37] * invT + activation_units[37] * fwd_Ea[37] * invT2;
     /* reverse */
     phi_r = sc[38];
-    Kc = refCinv * exp(g_RT[1] + g_RT[35] - g_RT[38]);
+    Kc = Kc_s[37];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[35]) + (h_RT[38]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30691,118 +29334,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[37][0] - 1)*q_nocor;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[35] -= dqdci;               /* dwdot[NO]/d[H2] */
-        J[38] += dqdci;               /* dwdot[HNO]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[35];
-        J[55] -= dqdci;               /* dwdot[H]/d[H] */
-        J[89] -= dqdci;               /* dwdot[NO]/d[H] */
-        J[92] += dqdci;               /* dwdot[HNO]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[37][1] - 1)*q_nocor;
-        J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[305] -= dqdci;              /* dwdot[NO]/d[H2O] */
-        J[308] += dqdci;              /* dwdot[HNO]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[37][2] - 1)*q_nocor;
-        J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[737] -= dqdci;              /* dwdot[NO]/d[CH4] */
-        J[740] += dqdci;              /* dwdot[HNO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[37][3] - 1)*q_nocor;
-        J[757] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[791] -= dqdci;              /* dwdot[NO]/d[CO] */
-        J[794] += dqdci;              /* dwdot[HNO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[37][4] - 1)*q_nocor;
-        J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[845] -= dqdci;              /* dwdot[NO]/d[CO2] */
-        J[848] += dqdci;              /* dwdot[HNO]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[37][5] - 1)*q_nocor;
-        J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1439] -= dqdci;             /* dwdot[NO]/d[C2H6] */
-        J[1442] += dqdci;             /* dwdot[HNO]/d[C2H6] */
-        /* d()/d[NO] */
-        dqdci =  + k_f*sc[1];
-        J[1891] -= dqdci;             /* dwdot[H]/d[NO] */
-        J[1925] -= dqdci;             /* dwdot[NO]/d[NO] */
-        J[1928] += dqdci;             /* dwdot[HNO]/d[NO] */
-        /* d()/d[HNO] */
-        dqdci =  - k_r;
-        J[2053] -= dqdci;             /* dwdot[H]/d[HNO] */
-        J[2087] -= dqdci;             /* dwdot[NO]/d[HNO] */
-        J[2090] += dqdci;             /* dwdot[HNO]/d[HNO] */
-        /* d()/d[AR] */
-        dqdci = (TB[37][6] - 1)*q_nocor;
-        J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2627] -= dqdci;             /* dwdot[NO]/d[AR] */
-        J[2630] += dqdci;             /* dwdot[HNO]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[37][0];
-        dqdc[1] = dcdc_fac + k_f*sc[35];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[37][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[37][2];
-        dqdc[14] = TB[37][3];
-        dqdc[15] = TB[37][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[37][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac + k_f*sc[1];
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac - k_r;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[37][6];
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+1] -= dqdc[k];
-            J[54*k+35] -= dqdc[k];
-            J[54*k+38] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= q_nocor;
+    Jmix[35] -= q_nocor;
+    Jmix[38] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[37][0] - 1)*q_nocor;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[35] -= dqdci;               /* dwdot[NO]/d[H2] */
+    J[38] += dqdci;               /* dwdot[HNO]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[35];
+    J[55] -= dqdci;               /* dwdot[H]/d[H] */
+    J[89] -= dqdci;               /* dwdot[NO]/d[H] */
+    J[92] += dqdci;               /* dwdot[HNO]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[37][1] - 1)*q_nocor;
+    J[271] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[305] -= dqdci;              /* dwdot[NO]/d[H2O] */
+    J[308] += dqdci;              /* dwdot[HNO]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[37][2] - 1)*q_nocor;
+    J[703] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[737] -= dqdci;              /* dwdot[NO]/d[CH4] */
+    J[740] += dqdci;              /* dwdot[HNO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[37][3] - 1)*q_nocor;
+    J[757] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[791] -= dqdci;              /* dwdot[NO]/d[CO] */
+    J[794] += dqdci;              /* dwdot[HNO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[37][4] - 1)*q_nocor;
+    J[811] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[845] -= dqdci;              /* dwdot[NO]/d[CO2] */
+    J[848] += dqdci;              /* dwdot[HNO]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[37][5] - 1)*q_nocor;
+    J[1405] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1439] -= dqdci;             /* dwdot[NO]/d[C2H6] */
+    J[1442] += dqdci;             /* dwdot[HNO]/d[C2H6] */
+    /* d()/d[NO] */
+    dqdci =  + k_f*sc[1];
+    J[1891] -= dqdci;             /* dwdot[H]/d[NO] */
+    J[1925] -= dqdci;             /* dwdot[NO]/d[NO] */
+    J[1928] += dqdci;             /* dwdot[HNO]/d[NO] */
+    /* d()/d[HNO] */
+    dqdci =  - k_r;
+    J[2053] -= dqdci;             /* dwdot[H]/d[HNO] */
+    J[2087] -= dqdci;             /* dwdot[NO]/d[HNO] */
+    J[2090] += dqdci;             /* dwdot[HNO]/d[HNO] */
+    /* d()/d[AR] */
+    dqdci = (TB[37][6] - 1)*q_nocor;
+    J[2593] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2627] -= dqdci;             /* dwdot[NO]/d[AR] */
+    J[2630] += dqdci;             /* dwdot[HNO]/d[AR] */
     J[2863] -= dqdT; /* dwdot[H]/dT */
     J[2897] -= dqdT; /* dwdot[NO]/dT */
     J[2900] += dqdT; /* dwdot[HNO]/dT */
@@ -30810,15 +29395,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 39: NCO + M <=> N + CO + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[38][0] - 1)*sc[0] + (TB[38][1] - 1)*sc[5] + (TB[38][2] - 1)*sc[13] + (TB[38][3] - 1)*sc[14] + (TB[38][4] - 1)*sc[15] + (TB[38][5] - 1)*sc[26] + (TB[38][6] - 1)*sc[48];
+    alpha = (memcmp(TB[38], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[38][0] - 1)*sc[0] + (TB[38][1] - 1)*sc[5] + (TB[38][2] - 1)*sc[13] + (TB[38][3] - 1)*sc[14] + (TB[38][4] - 1)*sc[15] + (TB[38][5] - 1)*sc[26] + (TB[38][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[46];
-    k_f = prefactor_units[38] * fwd_A[38]
-                * exp(fwd_beta[38] * tc[0] - activation_units[38] * fwd_Ea[38] * invT);
+    k_f = k_f_s[38];
     dlnkfdT = fwd_beta[38] * invT + activation_units[38] * fwd_Ea[38] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[30];
-    Kc = refC * exp(-g_RT[14] - g_RT[30] + g_RT[46]);
+    Kc = Kc_s[38];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[46]) + (h_RT[14] + h_RT[30]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30833,113 +29417,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[38][0] - 1)*q_nocor;
-        J[14] += dqdci;               /* dwdot[CO]/d[H2] */
-        J[30] += dqdci;               /* dwdot[N]/d[H2] */
-        J[46] -= dqdci;               /* dwdot[NCO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[38][1] - 1)*q_nocor;
-        J[284] += dqdci;              /* dwdot[CO]/d[H2O] */
-        J[300] += dqdci;              /* dwdot[N]/d[H2O] */
-        J[316] -= dqdci;              /* dwdot[NCO]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[38][2] - 1)*q_nocor;
-        J[716] += dqdci;              /* dwdot[CO]/d[CH4] */
-        J[732] += dqdci;              /* dwdot[N]/d[CH4] */
-        J[748] -= dqdci;              /* dwdot[NCO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[38][3] - 1)*q_nocor - k_r*sc[30];
-        J[770] += dqdci;              /* dwdot[CO]/d[CO] */
-        J[786] += dqdci;              /* dwdot[N]/d[CO] */
-        J[802] -= dqdci;              /* dwdot[NCO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[38][4] - 1)*q_nocor;
-        J[824] += dqdci;              /* dwdot[CO]/d[CO2] */
-        J[840] += dqdci;              /* dwdot[N]/d[CO2] */
-        J[856] -= dqdci;              /* dwdot[NCO]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[38][5] - 1)*q_nocor;
-        J[1418] += dqdci;             /* dwdot[CO]/d[C2H6] */
-        J[1434] += dqdci;             /* dwdot[N]/d[C2H6] */
-        J[1450] -= dqdci;             /* dwdot[NCO]/d[C2H6] */
-        /* d()/d[N] */
-        dqdci =  - k_r*sc[14];
-        J[1634] += dqdci;             /* dwdot[CO]/d[N] */
-        J[1650] += dqdci;             /* dwdot[N]/d[N] */
-        J[1666] -= dqdci;             /* dwdot[NCO]/d[N] */
-        /* d()/d[NCO] */
-        dqdci =  + k_f;
-        J[2498] += dqdci;             /* dwdot[CO]/d[NCO] */
-        J[2514] += dqdci;             /* dwdot[N]/d[NCO] */
-        J[2530] -= dqdci;             /* dwdot[NCO]/d[NCO] */
-        /* d()/d[AR] */
-        dqdci = (TB[38][6] - 1)*q_nocor;
-        J[2606] += dqdci;             /* dwdot[CO]/d[AR] */
-        J[2622] += dqdci;             /* dwdot[N]/d[AR] */
-        J[2638] -= dqdci;             /* dwdot[NCO]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[38][0];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[38][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[38][2];
-        dqdc[14] = TB[38][3] - k_r*sc[30];
-        dqdc[15] = TB[38][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[38][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac - k_r*sc[14];
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac + k_f;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[38][6];
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+14] += dqdc[k];
-            J[54*k+30] += dqdc[k];
-            J[54*k+46] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[14] += q_nocor;
+    Jmix[30] += q_nocor;
+    Jmix[46] -= q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[38][0] - 1)*q_nocor;
+    J[14] += dqdci;               /* dwdot[CO]/d[H2] */
+    J[30] += dqdci;               /* dwdot[N]/d[H2] */
+    J[46] -= dqdci;               /* dwdot[NCO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[38][1] - 1)*q_nocor;
+    J[284] += dqdci;              /* dwdot[CO]/d[H2O] */
+    J[300] += dqdci;              /* dwdot[N]/d[H2O] */
+    J[316] -= dqdci;              /* dwdot[NCO]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[38][2] - 1)*q_nocor;
+    J[716] += dqdci;              /* dwdot[CO]/d[CH4] */
+    J[732] += dqdci;              /* dwdot[N]/d[CH4] */
+    J[748] -= dqdci;              /* dwdot[NCO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[38][3] - 1)*q_nocor - k_r*sc[30];
+    J[770] += dqdci;              /* dwdot[CO]/d[CO] */
+    J[786] += dqdci;              /* dwdot[N]/d[CO] */
+    J[802] -= dqdci;              /* dwdot[NCO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[38][4] - 1)*q_nocor;
+    J[824] += dqdci;              /* dwdot[CO]/d[CO2] */
+    J[840] += dqdci;              /* dwdot[N]/d[CO2] */
+    J[856] -= dqdci;              /* dwdot[NCO]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[38][5] - 1)*q_nocor;
+    J[1418] += dqdci;             /* dwdot[CO]/d[C2H6] */
+    J[1434] += dqdci;             /* dwdot[N]/d[C2H6] */
+    J[1450] -= dqdci;             /* dwdot[NCO]/d[C2H6] */
+    /* d()/d[N] */
+    dqdci =  - k_r*sc[14];
+    J[1634] += dqdci;             /* dwdot[CO]/d[N] */
+    J[1650] += dqdci;             /* dwdot[N]/d[N] */
+    J[1666] -= dqdci;             /* dwdot[NCO]/d[N] */
+    /* d()/d[NCO] */
+    dqdci =  + k_f;
+    J[2498] += dqdci;             /* dwdot[CO]/d[NCO] */
+    J[2514] += dqdci;             /* dwdot[N]/d[NCO] */
+    J[2530] -= dqdci;             /* dwdot[NCO]/d[NCO] */
+    /* d()/d[AR] */
+    dqdci = (TB[38][6] - 1)*q_nocor;
+    J[2606] += dqdci;             /* dwdot[CO]/d[AR] */
+    J[2622] += dqdci;             /* dwdot[N]/d[AR] */
+    J[2638] -= dqdci;             /* dwdot[NCO]/d[AR] */
     J[2876] += dqdT; /* dwdot[CO]/dT */
     J[2892] += dqdT; /* dwdot[N]/dT */
     J[2908] -= dqdT; /* dwdot[NCO]/dT */
@@ -30947,15 +29473,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 40: HCN + M <=> H + CN + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[39][0] - 1)*sc[0] + (TB[39][1] - 1)*sc[5] + (TB[39][2] - 1)*sc[13] + (TB[39][3] - 1)*sc[14] + (TB[39][4] - 1)*sc[15] + (TB[39][5] - 1)*sc[26] + (TB[39][6] - 1)*sc[48];
+    alpha = (memcmp(TB[39], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[39][0] - 1)*sc[0] + (TB[39][1] - 1)*sc[5] + (TB[39][2] - 1)*sc[13] + (TB[39][3] - 1)*sc[14] + (TB[39][4] - 1)*sc[15] + (TB[39][5] - 1)*sc[26] + (TB[39][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[40];
-    k_f = prefactor_units[39] * fwd_A[39]
-                * exp(fwd_beta[39] * tc[0] - activation_units[39] * fwd_Ea[39] * invT);
+    k_f = k_f_s[39];
     dlnkfdT = fwd_beta[39] * invT + activation_units[39] * fwd_Ea[39] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[39];
-    Kc = refC * exp(-g_RT[1] - g_RT[39] + g_RT[40]);
+    Kc = Kc_s[39];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[40]) + (h_RT[1] + h_RT[39]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30970,118 +29495,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[39][0] - 1)*q_nocor;
-        J[1] += dqdci;                /* dwdot[H]/d[H2] */
-        J[39] += dqdci;               /* dwdot[CN]/d[H2] */
-        J[40] -= dqdci;               /* dwdot[HCN]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[39];
-        J[55] += dqdci;               /* dwdot[H]/d[H] */
-        J[93] += dqdci;               /* dwdot[CN]/d[H] */
-        J[94] -= dqdci;               /* dwdot[HCN]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[39][1] - 1)*q_nocor;
-        J[271] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[309] += dqdci;              /* dwdot[CN]/d[H2O] */
-        J[310] -= dqdci;              /* dwdot[HCN]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[39][2] - 1)*q_nocor;
-        J[703] += dqdci;              /* dwdot[H]/d[CH4] */
-        J[741] += dqdci;              /* dwdot[CN]/d[CH4] */
-        J[742] -= dqdci;              /* dwdot[HCN]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[39][3] - 1)*q_nocor;
-        J[757] += dqdci;              /* dwdot[H]/d[CO] */
-        J[795] += dqdci;              /* dwdot[CN]/d[CO] */
-        J[796] -= dqdci;              /* dwdot[HCN]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[39][4] - 1)*q_nocor;
-        J[811] += dqdci;              /* dwdot[H]/d[CO2] */
-        J[849] += dqdci;              /* dwdot[CN]/d[CO2] */
-        J[850] -= dqdci;              /* dwdot[HCN]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[39][5] - 1)*q_nocor;
-        J[1405] += dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1443] += dqdci;             /* dwdot[CN]/d[C2H6] */
-        J[1444] -= dqdci;             /* dwdot[HCN]/d[C2H6] */
-        /* d()/d[CN] */
-        dqdci =  - k_r*sc[1];
-        J[2107] += dqdci;             /* dwdot[H]/d[CN] */
-        J[2145] += dqdci;             /* dwdot[CN]/d[CN] */
-        J[2146] -= dqdci;             /* dwdot[HCN]/d[CN] */
-        /* d()/d[HCN] */
-        dqdci =  + k_f;
-        J[2161] += dqdci;             /* dwdot[H]/d[HCN] */
-        J[2199] += dqdci;             /* dwdot[CN]/d[HCN] */
-        J[2200] -= dqdci;             /* dwdot[HCN]/d[HCN] */
-        /* d()/d[AR] */
-        dqdci = (TB[39][6] - 1)*q_nocor;
-        J[2593] += dqdci;             /* dwdot[H]/d[AR] */
-        J[2631] += dqdci;             /* dwdot[CN]/d[AR] */
-        J[2632] -= dqdci;             /* dwdot[HCN]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[39][0];
-        dqdc[1] = dcdc_fac - k_r*sc[39];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[39][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[39][2];
-        dqdc[14] = TB[39][3];
-        dqdc[15] = TB[39][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[39][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac - k_r*sc[1];
-        dqdc[40] = dcdc_fac + k_f;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[39][6];
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+1] += dqdc[k];
-            J[54*k+39] += dqdc[k];
-            J[54*k+40] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] += q_nocor;
+    Jmix[39] += q_nocor;
+    Jmix[40] -= q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[39][0] - 1)*q_nocor;
+    J[1] += dqdci;                /* dwdot[H]/d[H2] */
+    J[39] += dqdci;               /* dwdot[CN]/d[H2] */
+    J[40] -= dqdci;               /* dwdot[HCN]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[39];
+    J[55] += dqdci;               /* dwdot[H]/d[H] */
+    J[93] += dqdci;               /* dwdot[CN]/d[H] */
+    J[94] -= dqdci;               /* dwdot[HCN]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[39][1] - 1)*q_nocor;
+    J[271] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[309] += dqdci;              /* dwdot[CN]/d[H2O] */
+    J[310] -= dqdci;              /* dwdot[HCN]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[39][2] - 1)*q_nocor;
+    J[703] += dqdci;              /* dwdot[H]/d[CH4] */
+    J[741] += dqdci;              /* dwdot[CN]/d[CH4] */
+    J[742] -= dqdci;              /* dwdot[HCN]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[39][3] - 1)*q_nocor;
+    J[757] += dqdci;              /* dwdot[H]/d[CO] */
+    J[795] += dqdci;              /* dwdot[CN]/d[CO] */
+    J[796] -= dqdci;              /* dwdot[HCN]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[39][4] - 1)*q_nocor;
+    J[811] += dqdci;              /* dwdot[H]/d[CO2] */
+    J[849] += dqdci;              /* dwdot[CN]/d[CO2] */
+    J[850] -= dqdci;              /* dwdot[HCN]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[39][5] - 1)*q_nocor;
+    J[1405] += dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1443] += dqdci;             /* dwdot[CN]/d[C2H6] */
+    J[1444] -= dqdci;             /* dwdot[HCN]/d[C2H6] */
+    /* d()/d[CN] */
+    dqdci =  - k_r*sc[1];
+    J[2107] += dqdci;             /* dwdot[H]/d[CN] */
+    J[2145] += dqdci;             /* dwdot[CN]/d[CN] */
+    J[2146] -= dqdci;             /* dwdot[HCN]/d[CN] */
+    /* d()/d[HCN] */
+    dqdci =  + k_f;
+    J[2161] += dqdci;             /* dwdot[H]/d[HCN] */
+    J[2199] += dqdci;             /* dwdot[CN]/d[HCN] */
+    J[2200] -= dqdci;             /* dwdot[HCN]/d[HCN] */
+    /* d()/d[AR] */
+    dqdci = (TB[39][6] - 1)*q_nocor;
+    J[2593] += dqdci;             /* dwdot[H]/d[AR] */
+    J[2631] += dqdci;             /* dwdot[CN]/d[AR] */
+    J[2632] -= dqdci;             /* dwdot[HCN]/d[AR] */
     J[2863] += dqdT; /* dwdot[H]/dT */
     J[2901] += dqdT; /* dwdot[CN]/dT */
     J[2902] -= dqdT; /* dwdot[HCN]/dT */
@@ -31089,15 +29556,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 41: HNCO + M <=> NH + CO + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[40][0] - 1)*sc[0] + (TB[40][1] - 1)*sc[5] + (TB[40][2] - 1)*sc[13] + (TB[40][3] - 1)*sc[14] + (TB[40][4] - 1)*sc[15] + (TB[40][5] - 1)*sc[26] + (TB[40][6] - 1)*sc[48];
+    alpha = (memcmp(TB[40], TB[0], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[40][0] - 1)*sc[0] + (TB[40][1] - 1)*sc[5] + (TB[40][2] - 1)*sc[13] + (TB[40][3] - 1)*sc[14] + (TB[40][4] - 1)*sc[15] + (TB[40][5] - 1)*sc[26] + (TB[40][6] - 1)*sc[48]);
     /* forward */
     phi_f = sc[45];
-    k_f = prefactor_units[40] * fwd_A[40]
-                * exp(fwd_beta[40] * tc[0] - activation_units[40] * fwd_Ea[40] * invT);
+    k_f = k_f_s[40];
     dlnkfdT = fwd_beta[40] * invT + activation_units[40] * fwd_Ea[40] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[31];
-    Kc = refC * exp(-g_RT[14] - g_RT[31] + g_RT[45]);
+    Kc = Kc_s[40];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[45]) + (h_RT[14] + h_RT[31]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31112,113 +29578,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[40][0] - 1)*q_nocor;
-        J[14] += dqdci;               /* dwdot[CO]/d[H2] */
-        J[31] += dqdci;               /* dwdot[NH]/d[H2] */
-        J[45] -= dqdci;               /* dwdot[HNCO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[40][1] - 1)*q_nocor;
-        J[284] += dqdci;              /* dwdot[CO]/d[H2O] */
-        J[301] += dqdci;              /* dwdot[NH]/d[H2O] */
-        J[315] -= dqdci;              /* dwdot[HNCO]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[40][2] - 1)*q_nocor;
-        J[716] += dqdci;              /* dwdot[CO]/d[CH4] */
-        J[733] += dqdci;              /* dwdot[NH]/d[CH4] */
-        J[747] -= dqdci;              /* dwdot[HNCO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[40][3] - 1)*q_nocor - k_r*sc[31];
-        J[770] += dqdci;              /* dwdot[CO]/d[CO] */
-        J[787] += dqdci;              /* dwdot[NH]/d[CO] */
-        J[801] -= dqdci;              /* dwdot[HNCO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[40][4] - 1)*q_nocor;
-        J[824] += dqdci;              /* dwdot[CO]/d[CO2] */
-        J[841] += dqdci;              /* dwdot[NH]/d[CO2] */
-        J[855] -= dqdci;              /* dwdot[HNCO]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[40][5] - 1)*q_nocor;
-        J[1418] += dqdci;             /* dwdot[CO]/d[C2H6] */
-        J[1435] += dqdci;             /* dwdot[NH]/d[C2H6] */
-        J[1449] -= dqdci;             /* dwdot[HNCO]/d[C2H6] */
-        /* d()/d[NH] */
-        dqdci =  - k_r*sc[14];
-        J[1688] += dqdci;             /* dwdot[CO]/d[NH] */
-        J[1705] += dqdci;             /* dwdot[NH]/d[NH] */
-        J[1719] -= dqdci;             /* dwdot[HNCO]/d[NH] */
-        /* d()/d[HNCO] */
-        dqdci =  + k_f;
-        J[2444] += dqdci;             /* dwdot[CO]/d[HNCO] */
-        J[2461] += dqdci;             /* dwdot[NH]/d[HNCO] */
-        J[2475] -= dqdci;             /* dwdot[HNCO]/d[HNCO] */
-        /* d()/d[AR] */
-        dqdci = (TB[40][6] - 1)*q_nocor;
-        J[2606] += dqdci;             /* dwdot[CO]/d[AR] */
-        J[2623] += dqdci;             /* dwdot[NH]/d[AR] */
-        J[2637] -= dqdci;             /* dwdot[HNCO]/d[AR] */
-    }
-    else {
-        dqdc[0] = TB[40][0];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[40][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[40][2];
-        dqdc[14] = TB[40][3] - k_r*sc[31];
-        dqdc[15] = TB[40][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[40][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac - k_r*sc[14];
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac + k_f;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = TB[40][6];
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        for (int k=0; k<53; k++) {
-            J[54*k+14] += dqdc[k];
-            J[54*k+31] += dqdc[k];
-            J[54*k+45] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[14] += q_nocor;
+    Jmix[31] += q_nocor;
+    Jmix[45] -= q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[40][0] - 1)*q_nocor;
+    J[14] += dqdci;               /* dwdot[CO]/d[H2] */
+    J[31] += dqdci;               /* dwdot[NH]/d[H2] */
+    J[45] -= dqdci;               /* dwdot[HNCO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[40][1] - 1)*q_nocor;
+    J[284] += dqdci;              /* dwdot[CO]/d[H2O] */
+    J[301] += dqdci;              /* dwdot[NH]/d[H2O] */
+    J[315] -= dqdci;              /* dwdot[HNCO]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[40][2] - 1)*q_nocor;
+    J[716] += dqdci;              /* dwdot[CO]/d[CH4] */
+    J[733] += dqdci;              /* dwdot[NH]/d[CH4] */
+    J[747] -= dqdci;              /* dwdot[HNCO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[40][3] - 1)*q_nocor - k_r*sc[31];
+    J[770] += dqdci;              /* dwdot[CO]/d[CO] */
+    J[787] += dqdci;              /* dwdot[NH]/d[CO] */
+    J[801] -= dqdci;              /* dwdot[HNCO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[40][4] - 1)*q_nocor;
+    J[824] += dqdci;              /* dwdot[CO]/d[CO2] */
+    J[841] += dqdci;              /* dwdot[NH]/d[CO2] */
+    J[855] -= dqdci;              /* dwdot[HNCO]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[40][5] - 1)*q_nocor;
+    J[1418] += dqdci;             /* dwdot[CO]/d[C2H6] */
+    J[1435] += dqdci;             /* dwdot[NH]/d[C2H6] */
+    J[1449] -= dqdci;             /* dwdot[HNCO]/d[C2H6] */
+    /* d()/d[NH] */
+    dqdci =  - k_r*sc[14];
+    J[1688] += dqdci;             /* dwdot[CO]/d[NH] */
+    J[1705] += dqdci;             /* dwdot[NH]/d[NH] */
+    J[1719] -= dqdci;             /* dwdot[HNCO]/d[NH] */
+    /* d()/d[HNCO] */
+    dqdci =  + k_f;
+    J[2444] += dqdci;             /* dwdot[CO]/d[HNCO] */
+    J[2461] += dqdci;             /* dwdot[NH]/d[HNCO] */
+    J[2475] -= dqdci;             /* dwdot[HNCO]/d[HNCO] */
+    /* d()/d[AR] */
+    dqdci = (TB[40][6] - 1)*q_nocor;
+    J[2606] += dqdci;             /* dwdot[CO]/d[AR] */
+    J[2623] += dqdci;             /* dwdot[NH]/d[AR] */
+    J[2637] -= dqdci;             /* dwdot[HNCO]/d[AR] */
     J[2876] += dqdT; /* dwdot[CO]/dT */
     J[2893] += dqdT; /* dwdot[NH]/dT */
     J[2907] -= dqdT; /* dwdot[HNCO]/dT */
@@ -31227,12 +29635,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[2];
-    k_f = prefactor_units[41] * fwd_A[41]
-                * exp(fwd_beta[41] * tc[0] - activation_units[41] * fwd_Ea[41] * invT);
+    k_f = k_f_s[41];
     dlnkfdT = fwd_beta[41] * invT + activation_units[41] * fwd_Ea[41] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[4];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[2] - g_RT[4]);
+    Kc = Kc_s[41];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[2]) + (h_RT[1] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31278,12 +29685,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[6];
-    k_f = prefactor_units[42] * fwd_A[42]
-                * exp(fwd_beta[42] * tc[0] - activation_units[42] * fwd_Ea[42] * invT);
+    k_f = k_f_s[42];
     dlnkfdT = fwd_beta[42] * invT + activation_units[42] * fwd_Ea[42] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[4];
-    Kc = exp(g_RT[2] - g_RT[3] - g_RT[4] + g_RT[6]);
+    Kc = Kc_s[42];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[6]) + (h_RT[3] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31329,12 +29735,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[7];
-    k_f = prefactor_units[43] * fwd_A[43]
-                * exp(fwd_beta[43] * tc[0] - activation_units[43] * fwd_Ea[43] * invT);
+    k_f = k_f_s[43];
     dlnkfdT = fwd_beta[43] * invT + activation_units[43] * fwd_Ea[43] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[6];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[43];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[7]) + (h_RT[4] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31380,12 +29785,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[9];
-    k_f = prefactor_units[44] * fwd_A[44]
-                * exp(fwd_beta[44] * tc[0] - activation_units[44] * fwd_Ea[44] * invT);
+    k_f = k_f_s[44];
     dlnkfdT = fwd_beta[44] * invT + activation_units[44] * fwd_Ea[44] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[9] - g_RT[14]);
+    Kc = Kc_s[44];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[9]) + (h_RT[1] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31431,12 +29835,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[10];
-    k_f = prefactor_units[45] * fwd_A[45]
-                * exp(fwd_beta[45] * tc[0] - activation_units[45] * fwd_Ea[45] * invT);
+    k_f = k_f_s[45];
     dlnkfdT = fwd_beta[45] * invT + activation_units[45] * fwd_Ea[45] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[16];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[10] - g_RT[16]);
+    Kc = Kc_s[45];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[10]) + (h_RT[1] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31482,12 +29885,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[11];
-    k_f = prefactor_units[46] * fwd_A[46]
-                * exp(fwd_beta[46] * tc[0] - activation_units[46] * fwd_Ea[46] * invT);
+    k_f = k_f_s[46];
     dlnkfdT = fwd_beta[46] * invT + activation_units[46] * fwd_Ea[46] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[14];
-    Kc = exp(-g_RT[0] + g_RT[2] + g_RT[11] - g_RT[14]);
+    Kc = Kc_s[46];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[11]) + (h_RT[0] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31533,12 +29935,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[11];
-    k_f = prefactor_units[47] * fwd_A[47]
-                * exp(fwd_beta[47] * tc[0] - activation_units[47] * fwd_Ea[47] * invT);
+    k_f = k_f_s[47];
     dlnkfdT = fwd_beta[47] * invT + activation_units[47] * fwd_Ea[47] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[16];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[11] - g_RT[16]);
+    Kc = Kc_s[47];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[11]) + (h_RT[1] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31584,12 +29985,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[12];
-    k_f = prefactor_units[48] * fwd_A[48]
-                * exp(fwd_beta[48] * tc[0] - activation_units[48] * fwd_Ea[48] * invT);
+    k_f = k_f_s[48];
     dlnkfdT = fwd_beta[48] * invT + activation_units[48] * fwd_Ea[48] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[17];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[12] - g_RT[17]);
+    Kc = Kc_s[48];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[12]) + (h_RT[1] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31635,12 +30035,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[13];
-    k_f = prefactor_units[49] * fwd_A[49]
-                * exp(fwd_beta[49] * tc[0] - activation_units[49] * fwd_Ea[49] * invT);
+    k_f = k_f_s[49];
     dlnkfdT = fwd_beta[49] * invT + activation_units[49] * fwd_Ea[49] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[12];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[12] + g_RT[13]);
+    Kc = Kc_s[49];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[13]) + (h_RT[4] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31686,12 +30085,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[16];
-    k_f = prefactor_units[50] * fwd_A[50]
-                * exp(fwd_beta[50] * tc[0] - activation_units[50] * fwd_Ea[50] * invT);
+    k_f = k_f_s[50];
     dlnkfdT = fwd_beta[50] * invT + activation_units[50] * fwd_Ea[50] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[14];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[50];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[16]) + (h_RT[4] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31737,12 +30135,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[16];
-    k_f = prefactor_units[51] * fwd_A[51]
-                * exp(fwd_beta[51] * tc[0] - activation_units[51] * fwd_Ea[51] * invT);
+    k_f = k_f_s[51];
     dlnkfdT = fwd_beta[51] * invT + activation_units[51] * fwd_Ea[51] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[15];
-    Kc = exp(-g_RT[1] + g_RT[2] - g_RT[15] + g_RT[16]);
+    Kc = Kc_s[51];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[16]) + (h_RT[1] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31788,12 +30185,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[17];
-    k_f = prefactor_units[52] * fwd_A[52]
-                * exp(fwd_beta[52] * tc[0] - activation_units[52] * fwd_Ea[52] * invT);
+    k_f = k_f_s[52];
     dlnkfdT = fwd_beta[52] * invT + activation_units[52] * fwd_Ea[52] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[16];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[52];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[17]) + (h_RT[4] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31839,12 +30235,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[18];
-    k_f = prefactor_units[53] * fwd_A[53]
-                * exp(fwd_beta[53] * tc[0] - activation_units[53] * fwd_Ea[53] * invT);
+    k_f = k_f_s[53];
     dlnkfdT = fwd_beta[53] * invT + activation_units[53] * fwd_Ea[53] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[17];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[53];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[18]) + (h_RT[4] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31890,12 +30285,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[19];
-    k_f = prefactor_units[54] * fwd_A[54]
-                * exp(fwd_beta[54] * tc[0] - activation_units[54] * fwd_Ea[54] * invT);
+    k_f = k_f_s[54];
     dlnkfdT = fwd_beta[54] * invT + activation_units[54] * fwd_Ea[54] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[17];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[17] + g_RT[19]);
+    Kc = Kc_s[54];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[19]) + (h_RT[4] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31941,12 +30335,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[20];
-    k_f = prefactor_units[55] * fwd_A[55]
-                * exp(fwd_beta[55] * tc[0] - activation_units[55] * fwd_Ea[55] * invT);
+    k_f = k_f_s[55];
     dlnkfdT = fwd_beta[55] * invT + activation_units[55] * fwd_Ea[55] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[18];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[55];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[20]) + (h_RT[4] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31992,12 +30385,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[20];
-    k_f = prefactor_units[56] * fwd_A[56]
-                * exp(fwd_beta[56] * tc[0] - activation_units[56] * fwd_Ea[56] * invT);
+    k_f = k_f_s[56];
     dlnkfdT = fwd_beta[56] * invT + activation_units[56] * fwd_Ea[56] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[19];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[19] + g_RT[20]);
+    Kc = Kc_s[56];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[20]) + (h_RT[4] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32043,12 +30435,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[21];
-    k_f = prefactor_units[57] * fwd_A[57]
-                * exp(fwd_beta[57] * tc[0] - activation_units[57] * fwd_Ea[57] * invT);
+    k_f = k_f_s[57];
     dlnkfdT = fwd_beta[57] * invT + activation_units[57] * fwd_Ea[57] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[14];
-    Kc = exp(g_RT[2] - g_RT[9] - g_RT[14] + g_RT[21]);
+    Kc = Kc_s[57];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[21]) + (h_RT[9] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32094,12 +30485,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[22];
-    k_f = prefactor_units[58] * fwd_A[58]
-                * exp(fwd_beta[58] * tc[0] - activation_units[58] * fwd_Ea[58] * invT);
+    k_f = k_f_s[58];
     dlnkfdT = fwd_beta[58] * invT + activation_units[58] * fwd_Ea[58] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[27];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[22] - g_RT[27]);
+    Kc = Kc_s[58];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[22]) + (h_RT[1] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32145,12 +30535,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[22];
-    k_f = prefactor_units[59] * fwd_A[59]
-                * exp(fwd_beta[59] * tc[0] - activation_units[59] * fwd_Ea[59] * invT);
+    k_f = k_f_s[59];
     dlnkfdT = fwd_beta[59] * invT + activation_units[59] * fwd_Ea[59] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[21];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[59];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[22]) + (h_RT[4] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32196,12 +30585,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[22];
-    k_f = prefactor_units[60] * fwd_A[60]
-                * exp(fwd_beta[60] * tc[0] - activation_units[60] * fwd_Ea[60] * invT);
+    k_f = k_f_s[60];
     dlnkfdT = fwd_beta[60] * invT + activation_units[60] * fwd_Ea[60] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[14];
-    Kc = exp(g_RT[2] - g_RT[10] - g_RT[14] + g_RT[22]);
+    Kc = Kc_s[60];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[22]) + (h_RT[10] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32247,12 +30635,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[23];
-    k_f = prefactor_units[61] * fwd_A[61]
-                * exp(fwd_beta[61] * tc[0] - activation_units[61] * fwd_Ea[61] * invT);
+    k_f = k_f_s[61];
     dlnkfdT = fwd_beta[61] * invT + activation_units[61] * fwd_Ea[61] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[28];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[23] - g_RT[28]);
+    Kc = Kc_s[61];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[23]) + (h_RT[1] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32298,12 +30685,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[24];
-    k_f = prefactor_units[62] * fwd_A[62]
-                * exp(fwd_beta[62] * tc[0] - activation_units[62] * fwd_Ea[62] * invT);
+    k_f = k_f_s[62];
     dlnkfdT = fwd_beta[62] * invT + activation_units[62] * fwd_Ea[62] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[16];
-    Kc = exp(g_RT[2] - g_RT[12] - g_RT[16] + g_RT[24]);
+    Kc = Kc_s[62];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[24]) + (h_RT[12] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32349,12 +30735,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[25];
-    k_f = prefactor_units[63] * fwd_A[63]
-                * exp(fwd_beta[63] * tc[0] - activation_units[63] * fwd_Ea[63] * invT);
+    k_f = k_f_s[63];
     dlnkfdT = fwd_beta[63] * invT + activation_units[63] * fwd_Ea[63] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[17];
-    Kc = exp(g_RT[2] - g_RT[12] - g_RT[17] + g_RT[25]);
+    Kc = Kc_s[63];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[25]) + (h_RT[12] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32400,12 +30785,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[26];
-    k_f = prefactor_units[64] * fwd_A[64]
-                * exp(fwd_beta[64] * tc[0] - activation_units[64] * fwd_Ea[64] * invT);
+    k_f = k_f_s[64];
     dlnkfdT = fwd_beta[64] * invT + activation_units[64] * fwd_Ea[64] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[25];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[25] + g_RT[26]);
+    Kc = Kc_s[64];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[26]) + (h_RT[4] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32451,12 +30835,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[27];
-    k_f = prefactor_units[65] * fwd_A[65]
-                * exp(fwd_beta[65] * tc[0] - activation_units[65] * fwd_Ea[65] * invT);
+    k_f = k_f_s[65];
     dlnkfdT = fwd_beta[65] * invT + activation_units[65] * fwd_Ea[65] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14]*sc[14];
-    Kc = refC * exp(-g_RT[1] + g_RT[2] - 2*g_RT[14] + g_RT[27]);
+    Kc = Kc_s[65];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[27]) + (h_RT[1] + 2*h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32502,12 +30885,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[28];
-    k_f = prefactor_units[66] * fwd_A[66]
-                * exp(fwd_beta[66] * tc[0] - activation_units[66] * fwd_Ea[66] * invT);
+    k_f = k_f_s[66];
     dlnkfdT = fwd_beta[66] * invT + activation_units[66] * fwd_Ea[66] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[27];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[27] + g_RT[28]);
+    Kc = Kc_s[66];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[28]) + (h_RT[4] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32553,12 +30935,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[28];
-    k_f = prefactor_units[67] * fwd_A[67]
-                * exp(fwd_beta[67] * tc[0] - activation_units[67] * fwd_Ea[67] * invT);
+    k_f = k_f_s[67];
     dlnkfdT = fwd_beta[67] * invT + activation_units[67] * fwd_Ea[67] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[15];
-    Kc = exp(g_RT[2] - g_RT[10] - g_RT[15] + g_RT[28]);
+    Kc = Kc_s[67];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[28]) + (h_RT[10] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32604,12 +30985,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[14];
-    k_f = prefactor_units[68] * fwd_A[68]
-                * exp(fwd_beta[68] * tc[0] - activation_units[68] * fwd_Ea[68] * invT);
+    k_f = k_f_s[68];
     dlnkfdT = fwd_beta[68] * invT + activation_units[68] * fwd_Ea[68] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[15];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[68];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[14]) + (h_RT[2] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32655,12 +31035,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[17];
-    k_f = prefactor_units[69] * fwd_A[69]
-                * exp(fwd_beta[69] * tc[0] - activation_units[69] * fwd_Ea[69] * invT);
+    k_f = k_f_s[69];
     dlnkfdT = fwd_beta[69] * invT + activation_units[69] * fwd_Ea[69] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[16];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[69];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[17]) + (h_RT[6] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32706,12 +31085,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3]*sc[3];
-    k_f = prefactor_units[70] * fwd_A[70]
-                * exp(fwd_beta[70] * tc[0] - activation_units[70] * fwd_Ea[70] * invT);
+    k_f = k_f_s[70];
     dlnkfdT = fwd_beta[70] * invT + activation_units[70] * fwd_Ea[70] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[6];
-    Kc = refCinv * exp(g_RT[1] + 2*g_RT[3] - g_RT[3] - g_RT[6]);
+    Kc = Kc_s[70];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + 2*h_RT[3]) + (h_RT[3] + h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32746,12 +31124,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3]*sc[5];
-    k_f = prefactor_units[71] * fwd_A[71]
-                * exp(fwd_beta[71] * tc[0] - activation_units[71] * fwd_Ea[71] * invT);
+    k_f = k_f_s[71];
     dlnkfdT = fwd_beta[71] * invT + activation_units[71] * fwd_Ea[71] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = refCinv * exp(g_RT[1] + g_RT[3] + g_RT[5] - g_RT[5] - g_RT[6]);
+    Kc = Kc_s[71];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3] + h_RT[5]) + (h_RT[5] + h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32791,12 +31168,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3]*sc[47];
-    k_f = prefactor_units[72] * fwd_A[72]
-                * exp(fwd_beta[72] * tc[0] - activation_units[72] * fwd_Ea[72] * invT);
+    k_f = k_f_s[72];
     dlnkfdT = fwd_beta[72] * invT + activation_units[72] * fwd_Ea[72] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[47];
-    Kc = refCinv * exp(g_RT[1] + g_RT[3] - g_RT[6] + g_RT[47] - g_RT[47]);
+    Kc = Kc_s[72];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3] + h_RT[47]) + (h_RT[6] + h_RT[47]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32836,12 +31212,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3]*sc[48];
-    k_f = prefactor_units[73] * fwd_A[73]
-                * exp(fwd_beta[73] * tc[0] - activation_units[73] * fwd_Ea[73] * invT);
+    k_f = k_f_s[73];
     dlnkfdT = fwd_beta[73] * invT + activation_units[73] * fwd_Ea[73] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[48];
-    Kc = refCinv * exp(g_RT[1] + g_RT[3] - g_RT[6] + g_RT[48] - g_RT[48]);
+    Kc = Kc_s[73];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3] + h_RT[48]) + (h_RT[6] + h_RT[48]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32881,12 +31256,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3];
-    k_f = prefactor_units[74] * fwd_A[74]
-                * exp(fwd_beta[74] * tc[0] - activation_units[74] * fwd_Ea[74] * invT);
+    k_f = k_f_s[74];
     dlnkfdT = fwd_beta[74] * invT + activation_units[74] * fwd_Ea[74] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[4];
-    Kc = exp(g_RT[1] - g_RT[2] + g_RT[3] - g_RT[4]);
+    Kc = Kc_s[74];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3]) + (h_RT[2] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32932,12 +31306,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[1]*sc[1];
-    k_f = prefactor_units[75] * fwd_A[75]
-                * exp(fwd_beta[75] * tc[0] - activation_units[75] * fwd_Ea[75] * invT);
+    k_f = k_f_s[75];
     dlnkfdT = fwd_beta[75] * invT + activation_units[75] * fwd_Ea[75] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[0];
-    Kc = refCinv * exp(g_RT[0] - 2*g_RT[0] + 2*g_RT[1]);
+    Kc = Kc_s[75];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + 2*h_RT[1]) + (2*h_RT[0]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32963,12 +31336,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[1]*sc[5];
-    k_f = prefactor_units[76] * fwd_A[76]
-                * exp(fwd_beta[76] * tc[0] - activation_units[76] * fwd_Ea[76] * invT);
+    k_f = k_f_s[76];
     dlnkfdT = fwd_beta[76] * invT + activation_units[76] * fwd_Ea[76] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[5];
-    Kc = refCinv * exp(-g_RT[0] + 2*g_RT[1] + g_RT[5] - g_RT[5]);
+    Kc = Kc_s[76];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[1] + h_RT[5]) + (h_RT[0] + h_RT[5]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32998,12 +31370,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[1]*sc[15];
-    k_f = prefactor_units[77] * fwd_A[77]
-                * exp(fwd_beta[77] * tc[0] - activation_units[77] * fwd_Ea[77] * invT);
+    k_f = k_f_s[77];
     dlnkfdT = fwd_beta[77] * invT + activation_units[77] * fwd_Ea[77] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[15];
-    Kc = refCinv * exp(-g_RT[0] + 2*g_RT[1] + g_RT[15] - g_RT[15]);
+    Kc = Kc_s[77];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[1] + h_RT[15]) + (h_RT[0] + h_RT[15]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33033,12 +31404,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[6];
-    k_f = prefactor_units[78] * fwd_A[78]
-                * exp(fwd_beta[78] * tc[0] - activation_units[78] * fwd_Ea[78] * invT);
+    k_f = k_f_s[78];
     dlnkfdT = fwd_beta[78] * invT + activation_units[78] * fwd_Ea[78] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[5];
-    Kc = exp(g_RT[1] - g_RT[2] - g_RT[5] + g_RT[6]);
+    Kc = Kc_s[78];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[6]) + (h_RT[2] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33084,12 +31454,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[6];
-    k_f = prefactor_units[79] * fwd_A[79]
-                * exp(fwd_beta[79] * tc[0] - activation_units[79] * fwd_Ea[79] * invT);
+    k_f = k_f_s[79];
     dlnkfdT = fwd_beta[79] * invT + activation_units[79] * fwd_Ea[79] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[3];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[3] + g_RT[6]);
+    Kc = Kc_s[79];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[6]) + (h_RT[0] + h_RT[3]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33135,12 +31504,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[6];
-    k_f = prefactor_units[80] * fwd_A[80]
-                * exp(fwd_beta[80] * tc[0] - activation_units[80] * fwd_Ea[80] * invT);
+    k_f = k_f_s[80];
     dlnkfdT = fwd_beta[80] * invT + activation_units[80] * fwd_Ea[80] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[4];
-    Kc = exp(g_RT[1] - 2*g_RT[4] + g_RT[6]);
+    Kc = Kc_s[80];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[6]) + (2*h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33175,12 +31543,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[7];
-    k_f = prefactor_units[81] * fwd_A[81]
-                * exp(fwd_beta[81] * tc[0] - activation_units[81] * fwd_Ea[81] * invT);
+    k_f = k_f_s[81];
     dlnkfdT = fwd_beta[81] * invT + activation_units[81] * fwd_Ea[81] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[6];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[81];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[7]) + (h_RT[0] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33226,12 +31593,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[7];
-    k_f = prefactor_units[82] * fwd_A[82]
-                * exp(fwd_beta[82] * tc[0] - activation_units[82] * fwd_Ea[82] * invT);
+    k_f = k_f_s[82];
     dlnkfdT = fwd_beta[82] * invT + activation_units[82] * fwd_Ea[82] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[5];
-    Kc = exp(g_RT[1] - g_RT[4] - g_RT[5] + g_RT[7]);
+    Kc = Kc_s[82];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[7]) + (h_RT[4] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33277,12 +31643,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[9];
-    k_f = prefactor_units[83] * fwd_A[83]
-                * exp(fwd_beta[83] * tc[0] - activation_units[83] * fwd_Ea[83] * invT);
+    k_f = k_f_s[83];
     dlnkfdT = fwd_beta[83] * invT + activation_units[83] * fwd_Ea[83] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[8];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[8] + g_RT[9]);
+    Kc = Kc_s[83];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[9]) + (h_RT[0] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33328,12 +31693,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[11];
-    k_f = prefactor_units[84] * fwd_A[84]
-                * exp(fwd_beta[84] * tc[0] - activation_units[84] * fwd_Ea[84] * invT);
+    k_f = k_f_s[84];
     dlnkfdT = fwd_beta[84] * invT + activation_units[84] * fwd_Ea[84] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[9];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[9] + g_RT[11]);
+    Kc = Kc_s[84];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[11]) + (h_RT[0] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33379,12 +31743,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[13];
-    k_f = prefactor_units[85] * fwd_A[85]
-                * exp(fwd_beta[85] * tc[0] - activation_units[85] * fwd_Ea[85] * invT);
+    k_f = k_f_s[85];
     dlnkfdT = fwd_beta[85] * invT + activation_units[85] * fwd_Ea[85] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[12];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[12] + g_RT[13]);
+    Kc = Kc_s[85];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[13]) + (h_RT[0] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33430,12 +31793,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[16];
-    k_f = prefactor_units[86] * fwd_A[86]
-                * exp(fwd_beta[86] * tc[0] - activation_units[86] * fwd_Ea[86] * invT);
+    k_f = k_f_s[86];
     dlnkfdT = fwd_beta[86] * invT + activation_units[86] * fwd_Ea[86] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[14];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[86];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[16]) + (h_RT[0] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33481,12 +31843,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[17];
-    k_f = prefactor_units[87] * fwd_A[87]
-                * exp(fwd_beta[87] * tc[0] - activation_units[87] * fwd_Ea[87] * invT);
+    k_f = k_f_s[87];
     dlnkfdT = fwd_beta[87] * invT + activation_units[87] * fwd_Ea[87] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[16];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[87];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[17]) + (h_RT[0] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33532,12 +31893,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[18];
-    k_f = prefactor_units[88] * fwd_A[88]
-                * exp(fwd_beta[88] * tc[0] - activation_units[88] * fwd_Ea[88] * invT);
+    k_f = k_f_s[88];
     dlnkfdT = fwd_beta[88] * invT + activation_units[88] * fwd_Ea[88] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[17];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[88];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[18]) + (h_RT[0] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33583,12 +31943,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[18];
-    k_f = prefactor_units[89] * fwd_A[89]
-                * exp(fwd_beta[89] * tc[0] - activation_units[89] * fwd_Ea[89] * invT);
+    k_f = k_f_s[89];
     dlnkfdT = fwd_beta[89] * invT + activation_units[89] * fwd_Ea[89] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[12];
-    Kc = exp(g_RT[1] - g_RT[4] - g_RT[12] + g_RT[18]);
+    Kc = Kc_s[89];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[18]) + (h_RT[4] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33634,12 +31993,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[18];
-    k_f = prefactor_units[90] * fwd_A[90]
-                * exp(fwd_beta[90] * tc[0] - activation_units[90] * fwd_Ea[90] * invT);
+    k_f = k_f_s[90];
     dlnkfdT = fwd_beta[90] * invT + activation_units[90] * fwd_Ea[90] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[11];
-    Kc = exp(g_RT[1] - g_RT[5] - g_RT[11] + g_RT[18]);
+    Kc = Kc_s[90];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[18]) + (h_RT[5] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33685,12 +32043,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[91] * fwd_A[91]
-                * exp(fwd_beta[91] * tc[0] - activation_units[91] * fwd_Ea[91] * invT);
+    k_f = k_f_s[91];
     dlnkfdT = fwd_beta[91] * invT + activation_units[91] * fwd_Ea[91] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[18];
-    Kc = exp(g_RT[1] - g_RT[1] - g_RT[18] + g_RT[19]);
+    Kc = Kc_s[91];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[1] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33720,12 +32077,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[92] * fwd_A[92]
-                * exp(fwd_beta[92] * tc[0] - activation_units[92] * fwd_Ea[92] * invT);
+    k_f = k_f_s[92];
     dlnkfdT = fwd_beta[92] * invT + activation_units[92] * fwd_Ea[92] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[17];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[17] + g_RT[19]);
+    Kc = Kc_s[92];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[0] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33771,12 +32127,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[93] * fwd_A[93]
-                * exp(fwd_beta[93] * tc[0] - activation_units[93] * fwd_Ea[93] * invT);
+    k_f = k_f_s[93];
     dlnkfdT = fwd_beta[93] * invT + activation_units[93] * fwd_Ea[93] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[12];
-    Kc = exp(g_RT[1] - g_RT[4] - g_RT[12] + g_RT[19]);
+    Kc = Kc_s[93];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[4] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33822,12 +32177,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[94] * fwd_A[94]
-                * exp(fwd_beta[94] * tc[0] - activation_units[94] * fwd_Ea[94] * invT);
+    k_f = k_f_s[94];
     dlnkfdT = fwd_beta[94] * invT + activation_units[94] * fwd_Ea[94] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[11];
-    Kc = exp(g_RT[1] - g_RT[5] - g_RT[11] + g_RT[19]);
+    Kc = Kc_s[94];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[5] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33873,12 +32227,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[20];
-    k_f = prefactor_units[95] * fwd_A[95]
-                * exp(fwd_beta[95] * tc[0] - activation_units[95] * fwd_Ea[95] * invT);
+    k_f = k_f_s[95];
     dlnkfdT = fwd_beta[95] * invT + activation_units[95] * fwd_Ea[95] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[18];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[95];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[20]) + (h_RT[0] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33924,12 +32277,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[20];
-    k_f = prefactor_units[96] * fwd_A[96]
-                * exp(fwd_beta[96] * tc[0] - activation_units[96] * fwd_Ea[96] * invT);
+    k_f = k_f_s[96];
     dlnkfdT = fwd_beta[96] * invT + activation_units[96] * fwd_Ea[96] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[19];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[19] + g_RT[20]);
+    Kc = Kc_s[96];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[20]) + (h_RT[0] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33975,12 +32327,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[23];
-    k_f = prefactor_units[97] * fwd_A[97]
-                * exp(fwd_beta[97] * tc[0] - activation_units[97] * fwd_Ea[97] * invT);
+    k_f = k_f_s[97];
     dlnkfdT = fwd_beta[97] * invT + activation_units[97] * fwd_Ea[97] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[22];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[22] + g_RT[23]);
+    Kc = Kc_s[97];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[23]) + (h_RT[0] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34026,12 +32377,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[24];
-    k_f = prefactor_units[98] * fwd_A[98]
-                * exp(fwd_beta[98] * tc[0] - activation_units[98] * fwd_Ea[98] * invT);
+    k_f = k_f_s[98];
     dlnkfdT = fwd_beta[98] * invT + activation_units[98] * fwd_Ea[98] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[23];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[23] + g_RT[24]);
+    Kc = Kc_s[98];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[24]) + (h_RT[0] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34077,12 +32427,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[25];
-    k_f = prefactor_units[99] * fwd_A[99]
-                * exp(fwd_beta[99] * tc[0] - activation_units[99] * fwd_Ea[99] * invT);
+    k_f = k_f_s[99];
     dlnkfdT = fwd_beta[99] * invT + activation_units[99] * fwd_Ea[99] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[24];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[24] + g_RT[25]);
+    Kc = Kc_s[99];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[25]) + (h_RT[0] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34128,12 +32477,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[26];
-    k_f = prefactor_units[100] * fwd_A[100]
-                * exp(fwd_beta[100] * tc[0] - activation_units[100] * fwd_Ea[100] * invT);
+    k_f = k_f_s[100];
     dlnkfdT = fwd_beta[100] * invT + activation_units[100] * fwd_Ea[100] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[25];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[25] + g_RT[26]);
+    Kc = Kc_s[100];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[26]) + (h_RT[0] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34179,12 +32527,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[27];
-    k_f = prefactor_units[101] * fwd_A[101]
-                * exp(fwd_beta[101] * tc[0] - activation_units[101] * fwd_Ea[101] * invT);
+    k_f = k_f_s[101];
     dlnkfdT = fwd_beta[101] * invT + activation_units[101] * fwd_Ea[101] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[14];
-    Kc = exp(g_RT[1] - g_RT[11] - g_RT[14] + g_RT[27]);
+    Kc = Kc_s[101];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[27]) + (h_RT[11] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34230,12 +32577,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[28];
-    k_f = prefactor_units[102] * fwd_A[102]
-                * exp(fwd_beta[102] * tc[0] - activation_units[102] * fwd_Ea[102] * invT);
+    k_f = k_f_s[102];
     dlnkfdT = fwd_beta[102] * invT + activation_units[102] * fwd_Ea[102] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[27];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[27] + g_RT[28]);
+    Kc = Kc_s[102];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[28]) + (h_RT[0] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34281,12 +32627,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[28];
-    k_f = prefactor_units[103] * fwd_A[103]
-                * exp(fwd_beta[103] * tc[0] - activation_units[103] * fwd_Ea[103] * invT);
+    k_f = k_f_s[103];
     dlnkfdT = fwd_beta[103] * invT + activation_units[103] * fwd_Ea[103] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[14];
-    Kc = exp(g_RT[1] - g_RT[12] - g_RT[14] + g_RT[28]);
+    Kc = Kc_s[103];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[28]) + (h_RT[12] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34332,12 +32677,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[29];
-    k_f = prefactor_units[104] * fwd_A[104]
-                * exp(fwd_beta[104] * tc[0] - activation_units[104] * fwd_Ea[104] * invT);
+    k_f = k_f_s[104];
     dlnkfdT = fwd_beta[104] * invT + activation_units[104] * fwd_Ea[104] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[28];
-    Kc = exp(g_RT[1] - g_RT[1] - g_RT[28] + g_RT[29]);
+    Kc = Kc_s[104];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[29]) + (h_RT[1] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34367,12 +32711,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[4];
-    k_f = prefactor_units[105] * fwd_A[105]
-                * exp(fwd_beta[105] * tc[0] - activation_units[105] * fwd_Ea[105] * invT);
+    k_f = k_f_s[105];
     dlnkfdT = fwd_beta[105] * invT + activation_units[105] * fwd_Ea[105] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[5];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[4] - g_RT[5]);
+    Kc = Kc_s[105];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[4]) + (h_RT[1] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34418,12 +32761,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[4];
-    k_f = prefactor_units[106] * fwd_A[106]
-                * exp(fwd_beta[106] * tc[0] - activation_units[106] * fwd_Ea[106] * invT);
+    k_f = k_f_s[106];
     dlnkfdT = fwd_beta[106] * invT + activation_units[106] * fwd_Ea[106] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[5];
-    Kc = exp(-g_RT[2] + 2*g_RT[4] - g_RT[5]);
+    Kc = Kc_s[106];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[4]) + (h_RT[2] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34458,12 +32800,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[6];
-    k_f = prefactor_units[107] * fwd_A[107]
-                * exp(fwd_beta[107] * tc[0] - activation_units[107] * fwd_Ea[107] * invT);
+    k_f = k_f_s[107];
     dlnkfdT = fwd_beta[107] * invT + activation_units[107] * fwd_Ea[107] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[5];
-    Kc = exp(-g_RT[3] + g_RT[4] - g_RT[5] + g_RT[6]);
+    Kc = Kc_s[107];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[6]) + (h_RT[3] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34509,12 +32850,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[7];
-    k_f = prefactor_units[108] * fwd_A[108]
-                * exp(fwd_beta[108] * tc[0] - activation_units[108] * fwd_Ea[108] * invT);
+    k_f = k_f_s[108];
     dlnkfdT = fwd_beta[108] * invT + activation_units[108] * fwd_Ea[108] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[108];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[7]) + (h_RT[5] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34560,12 +32900,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[7];
-    k_f = prefactor_units[109] * fwd_A[109]
-                * exp(fwd_beta[109] * tc[0] - activation_units[109] * fwd_Ea[109] * invT);
+    k_f = k_f_s[109];
     dlnkfdT = fwd_beta[109] * invT + activation_units[109] * fwd_Ea[109] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[109];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[7]) + (h_RT[5] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34611,12 +32950,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[8];
-    k_f = prefactor_units[110] * fwd_A[110]
-                * exp(fwd_beta[110] * tc[0] - activation_units[110] * fwd_Ea[110] * invT);
+    k_f = k_f_s[110];
     dlnkfdT = fwd_beta[110] * invT + activation_units[110] * fwd_Ea[110] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[8] - g_RT[14]);
+    Kc = Kc_s[110];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[8]) + (h_RT[1] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34662,12 +33000,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[9];
-    k_f = prefactor_units[111] * fwd_A[111]
-                * exp(fwd_beta[111] * tc[0] - activation_units[111] * fwd_Ea[111] * invT);
+    k_f = k_f_s[111];
     dlnkfdT = fwd_beta[111] * invT + activation_units[111] * fwd_Ea[111] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[16];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[9] - g_RT[16]);
+    Kc = Kc_s[111];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[9]) + (h_RT[1] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34713,12 +33050,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[10];
-    k_f = prefactor_units[112] * fwd_A[112]
-                * exp(fwd_beta[112] * tc[0] - activation_units[112] * fwd_Ea[112] * invT);
+    k_f = k_f_s[112];
     dlnkfdT = fwd_beta[112] * invT + activation_units[112] * fwd_Ea[112] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[17];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[10] - g_RT[17]);
+    Kc = Kc_s[112];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[10]) + (h_RT[1] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34764,12 +33100,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[10];
-    k_f = prefactor_units[113] * fwd_A[113]
-                * exp(fwd_beta[113] * tc[0] - activation_units[113] * fwd_Ea[113] * invT);
+    k_f = k_f_s[113];
     dlnkfdT = fwd_beta[113] * invT + activation_units[113] * fwd_Ea[113] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[9];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[9] + g_RT[10]);
+    Kc = Kc_s[113];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[10]) + (h_RT[5] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34815,12 +33150,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[11];
-    k_f = prefactor_units[114] * fwd_A[114]
-                * exp(fwd_beta[114] * tc[0] - activation_units[114] * fwd_Ea[114] * invT);
+    k_f = k_f_s[114];
     dlnkfdT = fwd_beta[114] * invT + activation_units[114] * fwd_Ea[114] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[17];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[11] - g_RT[17]);
+    Kc = Kc_s[114];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[11]) + (h_RT[1] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34866,12 +33200,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[12];
-    k_f = prefactor_units[115] * fwd_A[115]
-                * exp(fwd_beta[115] * tc[0] - activation_units[115] * fwd_Ea[115] * invT);
+    k_f = k_f_s[115];
     dlnkfdT = fwd_beta[115] * invT + activation_units[115] * fwd_Ea[115] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[10];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[10] + g_RT[12]);
+    Kc = Kc_s[115];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[12]) + (h_RT[5] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34917,12 +33250,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[12];
-    k_f = prefactor_units[116] * fwd_A[116]
-                * exp(fwd_beta[116] * tc[0] - activation_units[116] * fwd_Ea[116] * invT);
+    k_f = k_f_s[116];
     dlnkfdT = fwd_beta[116] * invT + activation_units[116] * fwd_Ea[116] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[11];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[11] + g_RT[12]);
+    Kc = Kc_s[116];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[12]) + (h_RT[5] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34968,12 +33300,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[13];
-    k_f = prefactor_units[117] * fwd_A[117]
-                * exp(fwd_beta[117] * tc[0] - activation_units[117] * fwd_Ea[117] * invT);
+    k_f = k_f_s[117];
     dlnkfdT = fwd_beta[117] * invT + activation_units[117] * fwd_Ea[117] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[12];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[12] + g_RT[13]);
+    Kc = Kc_s[117];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[13]) + (h_RT[5] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35019,12 +33350,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[14];
-    k_f = prefactor_units[118] * fwd_A[118]
-                * exp(fwd_beta[118] * tc[0] - activation_units[118] * fwd_Ea[118] * invT);
+    k_f = k_f_s[118];
     dlnkfdT = fwd_beta[118] * invT + activation_units[118] * fwd_Ea[118] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[15];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[118];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[14]) + (h_RT[1] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35070,12 +33400,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[16];
-    k_f = prefactor_units[119] * fwd_A[119]
-                * exp(fwd_beta[119] * tc[0] - activation_units[119] * fwd_Ea[119] * invT);
+    k_f = k_f_s[119];
     dlnkfdT = fwd_beta[119] * invT + activation_units[119] * fwd_Ea[119] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[14];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[119];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[16]) + (h_RT[5] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35121,12 +33450,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[17];
-    k_f = prefactor_units[120] * fwd_A[120]
-                * exp(fwd_beta[120] * tc[0] - activation_units[120] * fwd_Ea[120] * invT);
+    k_f = k_f_s[120];
     dlnkfdT = fwd_beta[120] * invT + activation_units[120] * fwd_Ea[120] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[16];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[120];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[17]) + (h_RT[5] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35172,12 +33500,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[18];
-    k_f = prefactor_units[121] * fwd_A[121]
-                * exp(fwd_beta[121] * tc[0] - activation_units[121] * fwd_Ea[121] * invT);
+    k_f = k_f_s[121];
     dlnkfdT = fwd_beta[121] * invT + activation_units[121] * fwd_Ea[121] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[17];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[121];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[18]) + (h_RT[5] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35223,12 +33550,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[19];
-    k_f = prefactor_units[122] * fwd_A[122]
-                * exp(fwd_beta[122] * tc[0] - activation_units[122] * fwd_Ea[122] * invT);
+    k_f = k_f_s[122];
     dlnkfdT = fwd_beta[122] * invT + activation_units[122] * fwd_Ea[122] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[17];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[17] + g_RT[19]);
+    Kc = Kc_s[122];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[19]) + (h_RT[5] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35274,12 +33600,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[20];
-    k_f = prefactor_units[123] * fwd_A[123]
-                * exp(fwd_beta[123] * tc[0] - activation_units[123] * fwd_Ea[123] * invT);
+    k_f = k_f_s[123];
     dlnkfdT = fwd_beta[123] * invT + activation_units[123] * fwd_Ea[123] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[18];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[123];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[20]) + (h_RT[5] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35325,12 +33650,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[20];
-    k_f = prefactor_units[124] * fwd_A[124]
-                * exp(fwd_beta[124] * tc[0] - activation_units[124] * fwd_Ea[124] * invT);
+    k_f = k_f_s[124];
     dlnkfdT = fwd_beta[124] * invT + activation_units[124] * fwd_Ea[124] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[19];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[19] + g_RT[20]);
+    Kc = Kc_s[124];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[20]) + (h_RT[5] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35376,12 +33700,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[21];
-    k_f = prefactor_units[125] * fwd_A[125]
-                * exp(fwd_beta[125] * tc[0] - activation_units[125] * fwd_Ea[125] * invT);
+    k_f = k_f_s[125];
     dlnkfdT = fwd_beta[125] * invT + activation_units[125] * fwd_Ea[125] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[27];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[21] - g_RT[27]);
+    Kc = Kc_s[125];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[21]) + (h_RT[1] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35427,12 +33750,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[22];
-    k_f = prefactor_units[126] * fwd_A[126]
-                * exp(fwd_beta[126] * tc[0] - activation_units[126] * fwd_Ea[126] * invT);
+    k_f = k_f_s[126];
     dlnkfdT = fwd_beta[126] * invT + activation_units[126] * fwd_Ea[126] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[28];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[22] - g_RT[28]);
+    Kc = Kc_s[126];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[22]) + (h_RT[1] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35478,12 +33800,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[22];
-    k_f = prefactor_units[127] * fwd_A[127]
-                * exp(fwd_beta[127] * tc[0] - activation_units[127] * fwd_Ea[127] * invT);
+    k_f = k_f_s[127];
     dlnkfdT = fwd_beta[127] * invT + activation_units[127] * fwd_Ea[127] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[29];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[22] - g_RT[29]);
+    Kc = Kc_s[127];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[22]) + (h_RT[1] + h_RT[29]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35529,12 +33850,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[22];
-    k_f = prefactor_units[128] * fwd_A[128]
-                * exp(fwd_beta[128] * tc[0] - activation_units[128] * fwd_Ea[128] * invT);
+    k_f = k_f_s[128];
     dlnkfdT = fwd_beta[128] * invT + activation_units[128] * fwd_Ea[128] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[21];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[128];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[22]) + (h_RT[5] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35580,12 +33900,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[22];
-    k_f = prefactor_units[129] * fwd_A[129]
-                * exp(fwd_beta[129] * tc[0] - activation_units[129] * fwd_Ea[129] * invT);
+    k_f = k_f_s[129];
     dlnkfdT = fwd_beta[129] * invT + activation_units[129] * fwd_Ea[129] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[14];
-    Kc = exp(g_RT[4] - g_RT[12] - g_RT[14] + g_RT[22]);
+    Kc = Kc_s[129];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[22]) + (h_RT[12] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35631,12 +33950,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[23];
-    k_f = prefactor_units[130] * fwd_A[130]
-                * exp(fwd_beta[130] * tc[0] - activation_units[130] * fwd_Ea[130] * invT);
+    k_f = k_f_s[130];
     dlnkfdT = fwd_beta[130] * invT + activation_units[130] * fwd_Ea[130] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[22];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[22] + g_RT[23]);
+    Kc = Kc_s[130];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[23]) + (h_RT[5] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35682,12 +34000,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[24];
-    k_f = prefactor_units[131] * fwd_A[131]
-                * exp(fwd_beta[131] * tc[0] - activation_units[131] * fwd_Ea[131] * invT);
+    k_f = k_f_s[131];
     dlnkfdT = fwd_beta[131] * invT + activation_units[131] * fwd_Ea[131] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[23];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[23] + g_RT[24]);
+    Kc = Kc_s[131];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[24]) + (h_RT[5] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35733,12 +34050,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[26];
-    k_f = prefactor_units[132] * fwd_A[132]
-                * exp(fwd_beta[132] * tc[0] - activation_units[132] * fwd_Ea[132] * invT);
+    k_f = k_f_s[132];
     dlnkfdT = fwd_beta[132] * invT + activation_units[132] * fwd_Ea[132] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[25];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[25] + g_RT[26]);
+    Kc = Kc_s[132];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[26]) + (h_RT[5] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35784,12 +34100,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[28];
-    k_f = prefactor_units[133] * fwd_A[133]
-                * exp(fwd_beta[133] * tc[0] - activation_units[133] * fwd_Ea[133] * invT);
+    k_f = k_f_s[133];
     dlnkfdT = fwd_beta[133] * invT + activation_units[133] * fwd_Ea[133] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[27];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[27] + g_RT[28]);
+    Kc = Kc_s[133];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[28]) + (h_RT[5] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35835,12 +34150,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[6];
-    k_f = prefactor_units[134] * fwd_A[134]
-                * exp(fwd_beta[134] * tc[0] - activation_units[134] * fwd_Ea[134] * invT);
+    k_f = k_f_s[134];
     dlnkfdT = fwd_beta[134] * invT + activation_units[134] * fwd_Ea[134] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[7];
-    Kc = exp(-g_RT[3] + 2*g_RT[6] - g_RT[7]);
+    Kc = Kc_s[134];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[6]) + (h_RT[3] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35875,12 +34189,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[6];
-    k_f = prefactor_units[135] * fwd_A[135]
-                * exp(fwd_beta[135] * tc[0] - activation_units[135] * fwd_Ea[135] * invT);
+    k_f = k_f_s[135];
     dlnkfdT = fwd_beta[135] * invT + activation_units[135] * fwd_Ea[135] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[7];
-    Kc = exp(-g_RT[3] + 2*g_RT[6] - g_RT[7]);
+    Kc = Kc_s[135];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[6]) + (h_RT[3] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35915,12 +34228,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[10];
-    k_f = prefactor_units[136] * fwd_A[136]
-                * exp(fwd_beta[136] * tc[0] - activation_units[136] * fwd_Ea[136] * invT);
+    k_f = k_f_s[136];
     dlnkfdT = fwd_beta[136] * invT + activation_units[136] * fwd_Ea[136] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[17];
-    Kc = exp(-g_RT[4] + g_RT[6] + g_RT[10] - g_RT[17]);
+    Kc = Kc_s[136];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[10]) + (h_RT[4] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35966,12 +34278,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[12];
-    k_f = prefactor_units[137] * fwd_A[137]
-                * exp(fwd_beta[137] * tc[0] - activation_units[137] * fwd_Ea[137] * invT);
+    k_f = k_f_s[137];
     dlnkfdT = fwd_beta[137] * invT + activation_units[137] * fwd_Ea[137] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[13];
-    Kc = exp(-g_RT[3] + g_RT[6] + g_RT[12] - g_RT[13]);
+    Kc = Kc_s[137];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[12]) + (h_RT[3] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36017,12 +34328,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[12];
-    k_f = prefactor_units[138] * fwd_A[138]
-                * exp(fwd_beta[138] * tc[0] - activation_units[138] * fwd_Ea[138] * invT);
+    k_f = k_f_s[138];
     dlnkfdT = fwd_beta[138] * invT + activation_units[138] * fwd_Ea[138] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[19];
-    Kc = exp(-g_RT[4] + g_RT[6] + g_RT[12] - g_RT[19]);
+    Kc = Kc_s[138];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[12]) + (h_RT[4] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36068,12 +34378,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[14];
-    k_f = prefactor_units[139] * fwd_A[139]
-                * exp(fwd_beta[139] * tc[0] - activation_units[139] * fwd_Ea[139] * invT);
+    k_f = k_f_s[139];
     dlnkfdT = fwd_beta[139] * invT + activation_units[139] * fwd_Ea[139] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[15];
-    Kc = exp(-g_RT[4] + g_RT[6] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[139];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[14]) + (h_RT[4] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36119,12 +34428,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[17];
-    k_f = prefactor_units[140] * fwd_A[140]
-                * exp(fwd_beta[140] * tc[0] - activation_units[140] * fwd_Ea[140] * invT);
+    k_f = k_f_s[140];
     dlnkfdT = fwd_beta[140] * invT + activation_units[140] * fwd_Ea[140] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[16];
-    Kc = exp(g_RT[6] - g_RT[7] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[140];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[17]) + (h_RT[7] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36170,12 +34478,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[8];
-    k_f = prefactor_units[141] * fwd_A[141]
-                * exp(fwd_beta[141] * tc[0] - activation_units[141] * fwd_Ea[141] * invT);
+    k_f = k_f_s[141];
     dlnkfdT = fwd_beta[141] * invT + activation_units[141] * fwd_Ea[141] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[14];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[8] - g_RT[14]);
+    Kc = Kc_s[141];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[8]) + (h_RT[2] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36221,12 +34528,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[10];
-    k_f = prefactor_units[142] * fwd_A[142]
-                * exp(fwd_beta[142] * tc[0] - activation_units[142] * fwd_Ea[142] * invT);
+    k_f = k_f_s[142];
     dlnkfdT = fwd_beta[142] * invT + activation_units[142] * fwd_Ea[142] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[21];
-    Kc = exp(-g_RT[1] + g_RT[8] + g_RT[10] - g_RT[21]);
+    Kc = Kc_s[142];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[10]) + (h_RT[1] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36272,12 +34578,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[12];
-    k_f = prefactor_units[143] * fwd_A[143]
-                * exp(fwd_beta[143] * tc[0] - activation_units[143] * fwd_Ea[143] * invT);
+    k_f = k_f_s[143];
     dlnkfdT = fwd_beta[143] * invT + activation_units[143] * fwd_Ea[143] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[22];
-    Kc = exp(-g_RT[1] + g_RT[8] + g_RT[12] - g_RT[22]);
+    Kc = Kc_s[143];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[12]) + (h_RT[1] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36323,12 +34628,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[9];
-    k_f = prefactor_units[144] * fwd_A[144]
-                * exp(fwd_beta[144] * tc[0] - activation_units[144] * fwd_Ea[144] * invT);
+    k_f = k_f_s[144];
     dlnkfdT = fwd_beta[144] * invT + activation_units[144] * fwd_Ea[144] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[16];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[9] - g_RT[16]);
+    Kc = Kc_s[144];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[9]) + (h_RT[2] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36374,12 +34678,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[9];
-    k_f = prefactor_units[145] * fwd_A[145]
-                * exp(fwd_beta[145] * tc[0] - activation_units[145] * fwd_Ea[145] * invT);
+    k_f = k_f_s[145];
     dlnkfdT = fwd_beta[145] * invT + activation_units[145] * fwd_Ea[145] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[10];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[9] - g_RT[10]);
+    Kc = Kc_s[145];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[9]) + (h_RT[1] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36425,12 +34728,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[9];
-    k_f = prefactor_units[146] * fwd_A[146]
-                * exp(fwd_beta[146] * tc[0] - activation_units[146] * fwd_Ea[146] * invT);
+    k_f = k_f_s[146];
     dlnkfdT = fwd_beta[146] * invT + activation_units[146] * fwd_Ea[146] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[17];
-    Kc = exp(-g_RT[1] + g_RT[5] + g_RT[9] - g_RT[17]);
+    Kc = Kc_s[146];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[9]) + (h_RT[1] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36476,12 +34778,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[10];
-    k_f = prefactor_units[147] * fwd_A[147]
-                * exp(fwd_beta[147] * tc[0] - activation_units[147] * fwd_Ea[147] * invT);
+    k_f = k_f_s[147];
     dlnkfdT = fwd_beta[147] * invT + activation_units[147] * fwd_Ea[147] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[22];
-    Kc = exp(-g_RT[1] + g_RT[9] + g_RT[10] - g_RT[22]);
+    Kc = Kc_s[147];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[10]) + (h_RT[1] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36527,12 +34828,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[12];
-    k_f = prefactor_units[148] * fwd_A[148]
-                * exp(fwd_beta[148] * tc[0] - activation_units[148] * fwd_Ea[148] * invT);
+    k_f = k_f_s[148];
     dlnkfdT = fwd_beta[148] * invT + activation_units[148] * fwd_Ea[148] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[23];
-    Kc = exp(-g_RT[1] + g_RT[9] + g_RT[12] - g_RT[23]);
+    Kc = Kc_s[148];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[12]) + (h_RT[1] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36578,12 +34878,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[13];
-    k_f = prefactor_units[149] * fwd_A[149]
-                * exp(fwd_beta[149] * tc[0] - activation_units[149] * fwd_Ea[149] * invT);
+    k_f = k_f_s[149];
     dlnkfdT = fwd_beta[149] * invT + activation_units[149] * fwd_Ea[149] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[24];
-    Kc = exp(-g_RT[1] + g_RT[9] + g_RT[13] - g_RT[24]);
+    Kc = Kc_s[149];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[13]) + (h_RT[1] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36629,12 +34928,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[15];
-    k_f = prefactor_units[150] * fwd_A[150]
-                * exp(fwd_beta[150] * tc[0] - activation_units[150] * fwd_Ea[150] * invT);
+    k_f = k_f_s[150];
     dlnkfdT = fwd_beta[150] * invT + activation_units[150] * fwd_Ea[150] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[16];
-    Kc = exp(g_RT[9] - g_RT[14] + g_RT[15] - g_RT[16]);
+    Kc = Kc_s[150];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[15]) + (h_RT[14] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36680,12 +34978,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[17];
-    k_f = prefactor_units[151] * fwd_A[151]
-                * exp(fwd_beta[151] * tc[0] - activation_units[151] * fwd_Ea[151] * invT);
+    k_f = k_f_s[151];
     dlnkfdT = fwd_beta[151] * invT + activation_units[151] * fwd_Ea[151] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[28];
-    Kc = exp(-g_RT[1] + g_RT[9] + g_RT[17] - g_RT[28]);
+    Kc = Kc_s[151];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[17]) + (h_RT[1] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36731,12 +35028,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[27];
-    k_f = prefactor_units[152] * fwd_A[152]
-                * exp(fwd_beta[152] * tc[0] - activation_units[152] * fwd_Ea[152] * invT);
+    k_f = k_f_s[152];
     dlnkfdT = fwd_beta[152] * invT + activation_units[152] * fwd_Ea[152] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[22];
-    Kc = exp(g_RT[9] - g_RT[14] - g_RT[22] + g_RT[27]);
+    Kc = Kc_s[152];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[27]) + (h_RT[14] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36782,8 +35078,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[10];
-    k_f = prefactor_units[153] * fwd_A[153]
-                * exp(fwd_beta[153] * tc[0] - activation_units[153] * fwd_Ea[153] * invT);
+    k_f = k_f_s[153];
     dlnkfdT = fwd_beta[153] * invT + activation_units[153] * fwd_Ea[153] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -36819,12 +35114,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[10];
-    k_f = prefactor_units[154] * fwd_A[154]
-                * exp(fwd_beta[154] * tc[0] - activation_units[154] * fwd_Ea[154] * invT);
+    k_f = k_f_s[154];
     dlnkfdT = fwd_beta[154] * invT + activation_units[154] * fwd_Ea[154] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[12];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[10] - g_RT[12]);
+    Kc = Kc_s[154];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[10]) + (h_RT[1] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36870,12 +35164,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[10];
-    k_f = prefactor_units[155] * fwd_A[155]
-                * exp(fwd_beta[155] * tc[0] - activation_units[155] * fwd_Ea[155] * invT);
+    k_f = k_f_s[155];
     dlnkfdT = fwd_beta[155] * invT + activation_units[155] * fwd_Ea[155] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[22];
-    Kc = exp(-g_RT[0] + 2*g_RT[10] - g_RT[22]);
+    Kc = Kc_s[155];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[10]) + (h_RT[0] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36910,12 +35203,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[12];
-    k_f = prefactor_units[156] * fwd_A[156]
-                * exp(fwd_beta[156] * tc[0] - activation_units[156] * fwd_Ea[156] * invT);
+    k_f = k_f_s[156];
     dlnkfdT = fwd_beta[156] * invT + activation_units[156] * fwd_Ea[156] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[24];
-    Kc = exp(-g_RT[1] + g_RT[10] + g_RT[12] - g_RT[24]);
+    Kc = Kc_s[156];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[12]) + (h_RT[1] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36961,12 +35253,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[13];
-    k_f = prefactor_units[157] * fwd_A[157]
-                * exp(fwd_beta[157] * tc[0] - activation_units[157] * fwd_Ea[157] * invT);
+    k_f = k_f_s[157];
     dlnkfdT = fwd_beta[157] * invT + activation_units[157] * fwd_Ea[157] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[12];
-    Kc = exp(g_RT[10] - 2*g_RT[12] + g_RT[13]);
+    Kc = Kc_s[157];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[13]) + (2*h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37001,12 +35292,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[27];
-    k_f = prefactor_units[158] * fwd_A[158]
-                * exp(fwd_beta[158] * tc[0] - activation_units[158] * fwd_Ea[158] * invT);
+    k_f = k_f_s[158];
     dlnkfdT = fwd_beta[158] * invT + activation_units[158] * fwd_Ea[158] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[23];
-    Kc = exp(g_RT[10] - g_RT[14] - g_RT[23] + g_RT[27]);
+    Kc = Kc_s[158];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[27]) + (h_RT[14] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37052,12 +35342,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[47];
-    k_f = prefactor_units[159] * fwd_A[159]
-                * exp(fwd_beta[159] * tc[0] - activation_units[159] * fwd_Ea[159] * invT);
+    k_f = k_f_s[159];
     dlnkfdT = fwd_beta[159] * invT + activation_units[159] * fwd_Ea[159] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[47];
-    Kc = exp(-g_RT[10] + g_RT[11] + g_RT[47] - g_RT[47]);
+    Kc = Kc_s[159];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[47]) + (h_RT[10] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37087,12 +35376,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[48];
-    k_f = prefactor_units[160] * fwd_A[160]
-                * exp(fwd_beta[160] * tc[0] - activation_units[160] * fwd_Ea[160] * invT);
+    k_f = k_f_s[160];
     dlnkfdT = fwd_beta[160] * invT + activation_units[160] * fwd_Ea[160] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[48];
-    Kc = exp(-g_RT[10] + g_RT[11] + g_RT[48] - g_RT[48]);
+    Kc = Kc_s[160];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[48]) + (h_RT[10] + h_RT[48]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37122,12 +35410,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[11];
-    k_f = prefactor_units[161] * fwd_A[161]
-                * exp(fwd_beta[161] * tc[0] - activation_units[161] * fwd_Ea[161] * invT);
+    k_f = k_f_s[161];
     dlnkfdT = fwd_beta[161] * invT + activation_units[161] * fwd_Ea[161] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[4]*sc[14];
-    Kc = refC * exp(-g_RT[1] + g_RT[3] - g_RT[4] + g_RT[11] - g_RT[14]);
+    Kc = Kc_s[161];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[11]) + (h_RT[1] + h_RT[4] + h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37186,12 +35473,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[11];
-    k_f = prefactor_units[162] * fwd_A[162]
-                * exp(fwd_beta[162] * tc[0] - activation_units[162] * fwd_Ea[162] * invT);
+    k_f = k_f_s[162];
     dlnkfdT = fwd_beta[162] * invT + activation_units[162] * fwd_Ea[162] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[14];
-    Kc = exp(g_RT[3] - g_RT[5] + g_RT[11] - g_RT[14]);
+    Kc = Kc_s[162];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[11]) + (h_RT[5] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37237,12 +35523,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[11];
-    k_f = prefactor_units[163] * fwd_A[163]
-                * exp(fwd_beta[163] * tc[0] - activation_units[163] * fwd_Ea[163] * invT);
+    k_f = k_f_s[163];
     dlnkfdT = fwd_beta[163] * invT + activation_units[163] * fwd_Ea[163] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[12];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[11] - g_RT[12]);
+    Kc = Kc_s[163];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[11]) + (h_RT[1] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37288,12 +35573,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[11];
-    k_f = prefactor_units[164] * fwd_A[164]
-                * exp(fwd_beta[164] * tc[0] - activation_units[164] * fwd_Ea[164] * invT);
+    k_f = k_f_s[164];
     dlnkfdT = fwd_beta[164] * invT + activation_units[164] * fwd_Ea[164] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[10];
-    Kc = exp(g_RT[5] - g_RT[5] - g_RT[10] + g_RT[11]);
+    Kc = Kc_s[164];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[11]) + (h_RT[5] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37323,12 +35607,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[12];
-    k_f = prefactor_units[165] * fwd_A[165]
-                * exp(fwd_beta[165] * tc[0] - activation_units[165] * fwd_Ea[165] * invT);
+    k_f = k_f_s[165];
     dlnkfdT = fwd_beta[165] * invT + activation_units[165] * fwd_Ea[165] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[24];
-    Kc = exp(-g_RT[1] + g_RT[11] + g_RT[12] - g_RT[24]);
+    Kc = Kc_s[165];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[12]) + (h_RT[1] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37374,12 +35657,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[13];
-    k_f = prefactor_units[166] * fwd_A[166]
-                * exp(fwd_beta[166] * tc[0] - activation_units[166] * fwd_Ea[166] * invT);
+    k_f = k_f_s[166];
     dlnkfdT = fwd_beta[166] * invT + activation_units[166] * fwd_Ea[166] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[12];
-    Kc = exp(g_RT[11] - 2*g_RT[12] + g_RT[13]);
+    Kc = Kc_s[166];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[13]) + (2*h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37414,12 +35696,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[14];
-    k_f = prefactor_units[167] * fwd_A[167]
-                * exp(fwd_beta[167] * tc[0] - activation_units[167] * fwd_Ea[167] * invT);
+    k_f = k_f_s[167];
     dlnkfdT = fwd_beta[167] * invT + activation_units[167] * fwd_Ea[167] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[14];
-    Kc = exp(-g_RT[10] + g_RT[11] + g_RT[14] - g_RT[14]);
+    Kc = Kc_s[167];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[14]) + (h_RT[10] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37449,12 +35730,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[15];
-    k_f = prefactor_units[168] * fwd_A[168]
-                * exp(fwd_beta[168] * tc[0] - activation_units[168] * fwd_Ea[168] * invT);
+    k_f = k_f_s[168];
     dlnkfdT = fwd_beta[168] * invT + activation_units[168] * fwd_Ea[168] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[15];
-    Kc = exp(-g_RT[10] + g_RT[11] + g_RT[15] - g_RT[15]);
+    Kc = Kc_s[168];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[15]) + (h_RT[10] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37484,12 +35764,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[15];
-    k_f = prefactor_units[169] * fwd_A[169]
-                * exp(fwd_beta[169] * tc[0] - activation_units[169] * fwd_Ea[169] * invT);
+    k_f = k_f_s[169];
     dlnkfdT = fwd_beta[169] * invT + activation_units[169] * fwd_Ea[169] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[17];
-    Kc = exp(g_RT[11] - g_RT[14] + g_RT[15] - g_RT[17]);
+    Kc = Kc_s[169];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[15]) + (h_RT[14] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37535,12 +35814,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[26];
-    k_f = prefactor_units[170] * fwd_A[170]
-                * exp(fwd_beta[170] * tc[0] - activation_units[170] * fwd_Ea[170] * invT);
+    k_f = k_f_s[170];
     dlnkfdT = fwd_beta[170] * invT + activation_units[170] * fwd_Ea[170] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[25];
-    Kc = exp(g_RT[11] - g_RT[12] - g_RT[25] + g_RT[26]);
+    Kc = Kc_s[170];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[26]) + (h_RT[12] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37586,12 +35864,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[12];
-    k_f = prefactor_units[171] * fwd_A[171]
-                * exp(fwd_beta[171] * tc[0] - activation_units[171] * fwd_Ea[171] * invT);
+    k_f = k_f_s[171];
     dlnkfdT = fwd_beta[171] * invT + activation_units[171] * fwd_Ea[171] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[19];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[12] - g_RT[19]);
+    Kc = Kc_s[171];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[12]) + (h_RT[2] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37637,12 +35914,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[12];
-    k_f = prefactor_units[172] * fwd_A[172]
-                * exp(fwd_beta[172] * tc[0] - activation_units[172] * fwd_Ea[172] * invT);
+    k_f = k_f_s[172];
     dlnkfdT = fwd_beta[172] * invT + activation_units[172] * fwd_Ea[172] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[17];
-    Kc = exp(g_RT[3] - g_RT[4] + g_RT[12] - g_RT[17]);
+    Kc = Kc_s[172];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[12]) + (h_RT[4] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37688,12 +35964,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[12];
-    k_f = prefactor_units[173] * fwd_A[173]
-                * exp(fwd_beta[173] * tc[0] - activation_units[173] * fwd_Ea[173] * invT);
+    k_f = k_f_s[173];
     dlnkfdT = fwd_beta[173] * invT + activation_units[173] * fwd_Ea[173] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[13];
-    Kc = exp(-g_RT[6] + g_RT[7] + g_RT[12] - g_RT[13]);
+    Kc = Kc_s[173];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[12]) + (h_RT[6] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37739,12 +36014,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[12];
-    k_f = prefactor_units[174] * fwd_A[174]
-                * exp(fwd_beta[174] * tc[0] - activation_units[174] * fwd_Ea[174] * invT);
+    k_f = k_f_s[174];
     dlnkfdT = fwd_beta[174] * invT + activation_units[174] * fwd_Ea[174] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[25];
-    Kc = exp(-g_RT[1] + 2*g_RT[12] - g_RT[25]);
+    Kc = Kc_s[174];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[12]) + (h_RT[1] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37779,12 +36053,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[16];
-    k_f = prefactor_units[175] * fwd_A[175]
-                * exp(fwd_beta[175] * tc[0] - activation_units[175] * fwd_Ea[175] * invT);
+    k_f = k_f_s[175];
     dlnkfdT = fwd_beta[175] * invT + activation_units[175] * fwd_Ea[175] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[14];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[175];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[16]) + (h_RT[13] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37830,12 +36103,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[17];
-    k_f = prefactor_units[176] * fwd_A[176]
-                * exp(fwd_beta[176] * tc[0] - activation_units[176] * fwd_Ea[176] * invT);
+    k_f = k_f_s[176];
     dlnkfdT = fwd_beta[176] * invT + activation_units[176] * fwd_Ea[176] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[16];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[176];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[17]) + (h_RT[13] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37881,12 +36153,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[20];
-    k_f = prefactor_units[177] * fwd_A[177]
-                * exp(fwd_beta[177] * tc[0] - activation_units[177] * fwd_Ea[177] * invT);
+    k_f = k_f_s[177];
     dlnkfdT = fwd_beta[177] * invT + activation_units[177] * fwd_Ea[177] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[18];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[177];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[20]) + (h_RT[13] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37932,12 +36203,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[20];
-    k_f = prefactor_units[178] * fwd_A[178]
-                * exp(fwd_beta[178] * tc[0] - activation_units[178] * fwd_Ea[178] * invT);
+    k_f = k_f_s[178];
     dlnkfdT = fwd_beta[178] * invT + activation_units[178] * fwd_Ea[178] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[19];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[19] + g_RT[20]);
+    Kc = Kc_s[178];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[20]) + (h_RT[13] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37983,12 +36253,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[24];
-    k_f = prefactor_units[179] * fwd_A[179]
-                * exp(fwd_beta[179] * tc[0] - activation_units[179] * fwd_Ea[179] * invT);
+    k_f = k_f_s[179];
     dlnkfdT = fwd_beta[179] * invT + activation_units[179] * fwd_Ea[179] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[23];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[23] + g_RT[24]);
+    Kc = Kc_s[179];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[24]) + (h_RT[13] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38034,12 +36303,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[26];
-    k_f = prefactor_units[180] * fwd_A[180]
-                * exp(fwd_beta[180] * tc[0] - activation_units[180] * fwd_Ea[180] * invT);
+    k_f = k_f_s[180];
     dlnkfdT = fwd_beta[180] * invT + activation_units[180] * fwd_Ea[180] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[25];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[25] + g_RT[26]);
+    Kc = Kc_s[180];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[26]) + (h_RT[13] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38085,12 +36353,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[16];
-    k_f = prefactor_units[181] * fwd_A[181]
-                * exp(fwd_beta[181] * tc[0] - activation_units[181] * fwd_Ea[181] * invT);
+    k_f = k_f_s[181];
     dlnkfdT = fwd_beta[181] * invT + activation_units[181] * fwd_Ea[181] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[5]*sc[14];
-    Kc = refC * exp(-g_RT[1] + g_RT[5] - g_RT[5] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[181];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[16]) + (h_RT[1] + h_RT[5] + h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38130,12 +36397,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[16];
-    k_f = prefactor_units[182] * fwd_A[182]
-                * exp(fwd_beta[182] * tc[0] - activation_units[182] * fwd_Ea[182] * invT);
+    k_f = k_f_s[182];
     dlnkfdT = fwd_beta[182] * invT + activation_units[182] * fwd_Ea[182] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[14];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[182];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[16]) + (h_RT[6] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38181,12 +36447,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[18];
-    k_f = prefactor_units[183] * fwd_A[183]
-                * exp(fwd_beta[183] * tc[0] - activation_units[183] * fwd_Ea[183] * invT);
+    k_f = k_f_s[183];
     dlnkfdT = fwd_beta[183] * invT + activation_units[183] * fwd_Ea[183] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[17];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[183];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[18]) + (h_RT[6] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38232,12 +36497,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[19];
-    k_f = prefactor_units[184] * fwd_A[184]
-                * exp(fwd_beta[184] * tc[0] - activation_units[184] * fwd_Ea[184] * invT);
+    k_f = k_f_s[184];
     dlnkfdT = fwd_beta[184] * invT + activation_units[184] * fwd_Ea[184] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[17];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[17] + g_RT[19]);
+    Kc = Kc_s[184];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[19]) + (h_RT[6] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38283,12 +36547,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[21];
-    k_f = prefactor_units[185] * fwd_A[185]
-                * exp(fwd_beta[185] * tc[0] - activation_units[185] * fwd_Ea[185] * invT);
+    k_f = k_f_s[185];
     dlnkfdT = fwd_beta[185] * invT + activation_units[185] * fwd_Ea[185] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[16];
-    Kc = exp(g_RT[3] - g_RT[14] - g_RT[16] + g_RT[21]);
+    Kc = Kc_s[185];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[21]) + (h_RT[14] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38334,12 +36597,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[21];
-    k_f = prefactor_units[186] * fwd_A[186]
-                * exp(fwd_beta[186] * tc[0] - activation_units[186] * fwd_Ea[186] * invT);
+    k_f = k_f_s[186];
     dlnkfdT = fwd_beta[186] * invT + activation_units[186] * fwd_Ea[186] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[22];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[21] - g_RT[22]);
+    Kc = Kc_s[186];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[21]) + (h_RT[1] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38385,12 +36647,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[23];
-    k_f = prefactor_units[187] * fwd_A[187]
-                * exp(fwd_beta[187] * tc[0] - activation_units[187] * fwd_Ea[187] * invT);
+    k_f = k_f_s[187];
     dlnkfdT = fwd_beta[187] * invT + activation_units[187] * fwd_Ea[187] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[17];
-    Kc = exp(g_RT[3] - g_RT[16] - g_RT[17] + g_RT[23]);
+    Kc = Kc_s[187];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[23]) + (h_RT[16] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38436,12 +36697,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[25];
-    k_f = prefactor_units[188] * fwd_A[188]
-                * exp(fwd_beta[188] * tc[0] - activation_units[188] * fwd_Ea[188] * invT);
+    k_f = k_f_s[188];
     dlnkfdT = fwd_beta[188] * invT + activation_units[188] * fwd_Ea[188] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[24];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[24] + g_RT[25]);
+    Kc = Kc_s[188];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[25]) + (h_RT[6] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38487,12 +36747,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[27];
-    k_f = prefactor_units[189] * fwd_A[189]
-                * exp(fwd_beta[189] * tc[0] - activation_units[189] * fwd_Ea[189] * invT);
+    k_f = k_f_s[189];
     dlnkfdT = fwd_beta[189] * invT + activation_units[189] * fwd_Ea[189] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[14]*sc[14];
-    Kc = refC * exp(g_RT[3] - g_RT[4] - 2*g_RT[14] + g_RT[27]);
+    Kc = Kc_s[189];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[27]) + (h_RT[4] + 2*h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38538,12 +36797,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[27]*sc[27];
-    k_f = prefactor_units[190] * fwd_A[190]
-                * exp(fwd_beta[190] * tc[0] - activation_units[190] * fwd_Ea[190] * invT);
+    k_f = k_f_s[190];
     dlnkfdT = fwd_beta[190] * invT + activation_units[190] * fwd_Ea[190] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[14]*sc[22];
-    Kc = refC * exp(-2*g_RT[14] - g_RT[22] + 2*g_RT[27]);
+    Kc = Kc_s[190];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[27]) + (2*h_RT[14] + h_RT[22]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38578,12 +36836,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[30]*sc[35];
-    k_f = prefactor_units[191] * fwd_A[191]
-                * exp(fwd_beta[191] * tc[0] - activation_units[191] * fwd_Ea[191] * invT);
+    k_f = k_f_s[191];
     dlnkfdT = fwd_beta[191] * invT + activation_units[191] * fwd_Ea[191] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[47];
-    Kc = exp(-g_RT[2] + g_RT[30] + g_RT[35] - g_RT[47]);
+    Kc = Kc_s[191];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[30] + h_RT[35]) + (h_RT[2] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38629,12 +36886,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[30];
-    k_f = prefactor_units[192] * fwd_A[192]
-                * exp(fwd_beta[192] * tc[0] - activation_units[192] * fwd_Ea[192] * invT);
+    k_f = k_f_s[192];
     dlnkfdT = fwd_beta[192] * invT + activation_units[192] * fwd_Ea[192] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[35];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[30] - g_RT[35]);
+    Kc = Kc_s[192];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[30]) + (h_RT[2] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38680,12 +36936,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[30];
-    k_f = prefactor_units[193] * fwd_A[193]
-                * exp(fwd_beta[193] * tc[0] - activation_units[193] * fwd_Ea[193] * invT);
+    k_f = k_f_s[193];
     dlnkfdT = fwd_beta[193] * invT + activation_units[193] * fwd_Ea[193] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[35];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[30] - g_RT[35]);
+    Kc = Kc_s[193];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[30]) + (h_RT[1] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38731,12 +36986,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[37];
-    k_f = prefactor_units[194] * fwd_A[194]
-                * exp(fwd_beta[194] * tc[0] - activation_units[194] * fwd_Ea[194] * invT);
+    k_f = k_f_s[194];
     dlnkfdT = fwd_beta[194] * invT + activation_units[194] * fwd_Ea[194] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[47];
-    Kc = exp(g_RT[2] - g_RT[3] + g_RT[37] - g_RT[47]);
+    Kc = Kc_s[194];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[37]) + (h_RT[3] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38782,12 +37036,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[37];
-    k_f = prefactor_units[195] * fwd_A[195]
-                * exp(fwd_beta[195] * tc[0] - activation_units[195] * fwd_Ea[195] * invT);
+    k_f = k_f_s[195];
     dlnkfdT = fwd_beta[195] * invT + activation_units[195] * fwd_Ea[195] * invT2;
     /* reverse */
     phi_r = sc[35]*sc[35];
-    Kc = exp(g_RT[2] - 2*g_RT[35] + g_RT[37]);
+    Kc = Kc_s[195];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[37]) + (2*h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38822,12 +37075,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[37];
-    k_f = prefactor_units[196] * fwd_A[196]
-                * exp(fwd_beta[196] * tc[0] - activation_units[196] * fwd_Ea[196] * invT);
+    k_f = k_f_s[196];
     dlnkfdT = fwd_beta[196] * invT + activation_units[196] * fwd_Ea[196] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[47];
-    Kc = exp(g_RT[1] - g_RT[4] + g_RT[37] - g_RT[47]);
+    Kc = Kc_s[196];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[37]) + (h_RT[4] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38873,12 +37125,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[37];
-    k_f = prefactor_units[197] * fwd_A[197]
-                * exp(fwd_beta[197] * tc[0] - activation_units[197] * fwd_Ea[197] * invT);
+    k_f = k_f_s[197];
     dlnkfdT = fwd_beta[197] * invT + activation_units[197] * fwd_Ea[197] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[47];
-    Kc = exp(g_RT[4] - g_RT[6] + g_RT[37] - g_RT[47]);
+    Kc = Kc_s[197];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[37]) + (h_RT[6] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38924,12 +37175,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[35];
-    k_f = prefactor_units[198] * fwd_A[198]
-                * exp(fwd_beta[198] * tc[0] - activation_units[198] * fwd_Ea[198] * invT);
+    k_f = k_f_s[198];
     dlnkfdT = fwd_beta[198] * invT + activation_units[198] * fwd_Ea[198] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[36];
-    Kc = exp(-g_RT[4] + g_RT[6] + g_RT[35] - g_RT[36]);
+    Kc = Kc_s[198];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[35]) + (h_RT[4] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38975,12 +37225,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[36];
-    k_f = prefactor_units[199] * fwd_A[199]
-                * exp(fwd_beta[199] * tc[0] - activation_units[199] * fwd_Ea[199] * invT);
+    k_f = k_f_s[199];
     dlnkfdT = fwd_beta[199] * invT + activation_units[199] * fwd_Ea[199] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[35];
-    Kc = exp(g_RT[2] - g_RT[3] - g_RT[35] + g_RT[36]);
+    Kc = Kc_s[199];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[36]) + (h_RT[3] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39026,12 +37275,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[36];
-    k_f = prefactor_units[200] * fwd_A[200]
-                * exp(fwd_beta[200] * tc[0] - activation_units[200] * fwd_Ea[200] * invT);
+    k_f = k_f_s[200];
     dlnkfdT = fwd_beta[200] * invT + activation_units[200] * fwd_Ea[200] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[35];
-    Kc = exp(g_RT[1] - g_RT[4] - g_RT[35] + g_RT[36]);
+    Kc = Kc_s[200];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[36]) + (h_RT[4] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39077,12 +37325,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[31];
-    k_f = prefactor_units[201] * fwd_A[201]
-                * exp(fwd_beta[201] * tc[0] - activation_units[201] * fwd_Ea[201] * invT);
+    k_f = k_f_s[201];
     dlnkfdT = fwd_beta[201] * invT + activation_units[201] * fwd_Ea[201] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[35];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[31] - g_RT[35]);
+    Kc = Kc_s[201];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[31]) + (h_RT[1] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39128,12 +37375,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[31];
-    k_f = prefactor_units[202] * fwd_A[202]
-                * exp(fwd_beta[202] * tc[0] - activation_units[202] * fwd_Ea[202] * invT);
+    k_f = k_f_s[202];
     dlnkfdT = fwd_beta[202] * invT + activation_units[202] * fwd_Ea[202] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[30];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[30] + g_RT[31]);
+    Kc = Kc_s[202];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[31]) + (h_RT[0] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39179,12 +37425,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[31];
-    k_f = prefactor_units[203] * fwd_A[203]
-                * exp(fwd_beta[203] * tc[0] - activation_units[203] * fwd_Ea[203] * invT);
+    k_f = k_f_s[203];
     dlnkfdT = fwd_beta[203] * invT + activation_units[203] * fwd_Ea[203] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[38];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[31] - g_RT[38]);
+    Kc = Kc_s[203];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[31]) + (h_RT[1] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39230,12 +37475,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[31];
-    k_f = prefactor_units[204] * fwd_A[204]
-                * exp(fwd_beta[204] * tc[0] - activation_units[204] * fwd_Ea[204] * invT);
+    k_f = k_f_s[204];
     dlnkfdT = fwd_beta[204] * invT + activation_units[204] * fwd_Ea[204] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[30];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[30] + g_RT[31]);
+    Kc = Kc_s[204];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[31]) + (h_RT[5] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39281,12 +37525,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[31];
-    k_f = prefactor_units[205] * fwd_A[205]
-                * exp(fwd_beta[205] * tc[0] - activation_units[205] * fwd_Ea[205] * invT);
+    k_f = k_f_s[205];
     dlnkfdT = fwd_beta[205] * invT + activation_units[205] * fwd_Ea[205] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[38];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[31] - g_RT[38]);
+    Kc = Kc_s[205];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[31]) + (h_RT[2] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39332,12 +37575,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[31];
-    k_f = prefactor_units[206] * fwd_A[206]
-                * exp(fwd_beta[206] * tc[0] - activation_units[206] * fwd_Ea[206] * invT);
+    k_f = k_f_s[206];
     dlnkfdT = fwd_beta[206] * invT + activation_units[206] * fwd_Ea[206] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[35];
-    Kc = exp(g_RT[3] - g_RT[4] + g_RT[31] - g_RT[35]);
+    Kc = Kc_s[206];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[31]) + (h_RT[4] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39383,12 +37625,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[30]*sc[31];
-    k_f = prefactor_units[207] * fwd_A[207]
-                * exp(fwd_beta[207] * tc[0] - activation_units[207] * fwd_Ea[207] * invT);
+    k_f = k_f_s[207];
     dlnkfdT = fwd_beta[207] * invT + activation_units[207] * fwd_Ea[207] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[47];
-    Kc = exp(-g_RT[1] + g_RT[30] + g_RT[31] - g_RT[47]);
+    Kc = Kc_s[207];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[30] + h_RT[31]) + (h_RT[1] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39434,12 +37675,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[31];
-    k_f = prefactor_units[208] * fwd_A[208]
-                * exp(fwd_beta[208] * tc[0] - activation_units[208] * fwd_Ea[208] * invT);
+    k_f = k_f_s[208];
     dlnkfdT = fwd_beta[208] * invT + activation_units[208] * fwd_Ea[208] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[38];
-    Kc = exp(-g_RT[0] + g_RT[5] + g_RT[31] - g_RT[38]);
+    Kc = Kc_s[208];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[31]) + (h_RT[0] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39485,12 +37725,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[31]*sc[35];
-    k_f = prefactor_units[209] * fwd_A[209]
-                * exp(fwd_beta[209] * tc[0] - activation_units[209] * fwd_Ea[209] * invT);
+    k_f = k_f_s[209];
     dlnkfdT = fwd_beta[209] * invT + activation_units[209] * fwd_Ea[209] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[47];
-    Kc = exp(-g_RT[4] + g_RT[31] + g_RT[35] - g_RT[47]);
+    Kc = Kc_s[209];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[31] + h_RT[35]) + (h_RT[4] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39536,12 +37775,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[31]*sc[35];
-    k_f = prefactor_units[210] * fwd_A[210]
-                * exp(fwd_beta[210] * tc[0] - activation_units[210] * fwd_Ea[210] * invT);
+    k_f = k_f_s[210];
     dlnkfdT = fwd_beta[210] * invT + activation_units[210] * fwd_Ea[210] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[37];
-    Kc = exp(-g_RT[1] + g_RT[31] + g_RT[35] - g_RT[37]);
+    Kc = Kc_s[210];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[31] + h_RT[35]) + (h_RT[1] + h_RT[37]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39587,12 +37825,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[32];
-    k_f = prefactor_units[211] * fwd_A[211]
-                * exp(fwd_beta[211] * tc[0] - activation_units[211] * fwd_Ea[211] * invT);
+    k_f = k_f_s[211];
     dlnkfdT = fwd_beta[211] * invT + activation_units[211] * fwd_Ea[211] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[31];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[31] + g_RT[32]);
+    Kc = Kc_s[211];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[32]) + (h_RT[4] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39638,12 +37875,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[32];
-    k_f = prefactor_units[212] * fwd_A[212]
-                * exp(fwd_beta[212] * tc[0] - activation_units[212] * fwd_Ea[212] * invT);
+    k_f = k_f_s[212];
     dlnkfdT = fwd_beta[212] * invT + activation_units[212] * fwd_Ea[212] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[38];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[32] - g_RT[38]);
+    Kc = Kc_s[212];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[32]) + (h_RT[1] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39689,12 +37925,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[32];
-    k_f = prefactor_units[213] * fwd_A[213]
-                * exp(fwd_beta[213] * tc[0] - activation_units[213] * fwd_Ea[213] * invT);
+    k_f = k_f_s[213];
     dlnkfdT = fwd_beta[213] * invT + activation_units[213] * fwd_Ea[213] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[31];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[31] + g_RT[32]);
+    Kc = Kc_s[213];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[32]) + (h_RT[0] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39740,12 +37975,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[32];
-    k_f = prefactor_units[214] * fwd_A[214]
-                * exp(fwd_beta[214] * tc[0] - activation_units[214] * fwd_Ea[214] * invT);
+    k_f = k_f_s[214];
     dlnkfdT = fwd_beta[214] * invT + activation_units[214] * fwd_Ea[214] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[31];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[31] + g_RT[32]);
+    Kc = Kc_s[214];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[32]) + (h_RT[5] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39791,12 +38025,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[34];
-    k_f = prefactor_units[215] * fwd_A[215]
-                * exp(fwd_beta[215] * tc[0] - activation_units[215] * fwd_Ea[215] * invT);
+    k_f = k_f_s[215];
     dlnkfdT = fwd_beta[215] * invT + activation_units[215] * fwd_Ea[215] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[47];
-    Kc = refC * exp(-g_RT[1] + g_RT[34] - g_RT[47]);
+    Kc = Kc_s[215];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[34]) + (h_RT[1] + h_RT[47]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39831,12 +38064,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[34];
-    k_f = prefactor_units[216] * fwd_A[216]
-                * exp(fwd_beta[216] * tc[0] - activation_units[216] * fwd_Ea[216] * invT);
+    k_f = k_f_s[216];
     dlnkfdT = fwd_beta[216] * invT + activation_units[216] * fwd_Ea[216] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[47];
-    Kc = exp(g_RT[3] - g_RT[6] + g_RT[34] - g_RT[47]);
+    Kc = Kc_s[216];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[34]) + (h_RT[6] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39882,12 +38114,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[34];
-    k_f = prefactor_units[217] * fwd_A[217]
-                * exp(fwd_beta[217] * tc[0] - activation_units[217] * fwd_Ea[217] * invT);
+    k_f = k_f_s[217];
     dlnkfdT = fwd_beta[217] * invT + activation_units[217] * fwd_Ea[217] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[47];
-    Kc = exp(g_RT[2] - g_RT[4] + g_RT[34] - g_RT[47]);
+    Kc = Kc_s[217];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[34]) + (h_RT[4] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39933,12 +38164,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[34];
-    k_f = prefactor_units[218] * fwd_A[218]
-                * exp(fwd_beta[218] * tc[0] - activation_units[218] * fwd_Ea[218] * invT);
+    k_f = k_f_s[218];
     dlnkfdT = fwd_beta[218] * invT + activation_units[218] * fwd_Ea[218] * invT2;
     /* reverse */
     phi_r = sc[31]*sc[35];
-    Kc = exp(g_RT[2] - g_RT[31] + g_RT[34] - g_RT[35]);
+    Kc = Kc_s[218];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[34]) + (h_RT[31] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39984,12 +38214,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[34];
-    k_f = prefactor_units[219] * fwd_A[219]
-                * exp(fwd_beta[219] * tc[0] - activation_units[219] * fwd_Ea[219] * invT);
+    k_f = k_f_s[219];
     dlnkfdT = fwd_beta[219] * invT + activation_units[219] * fwd_Ea[219] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[47];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[34] - g_RT[47]);
+    Kc = Kc_s[219];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[34]) + (h_RT[0] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40035,12 +38264,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[34];
-    k_f = prefactor_units[220] * fwd_A[220]
-                * exp(fwd_beta[220] * tc[0] - activation_units[220] * fwd_Ea[220] * invT);
+    k_f = k_f_s[220];
     dlnkfdT = fwd_beta[220] * invT + activation_units[220] * fwd_Ea[220] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[47];
-    Kc = exp(g_RT[4] - g_RT[5] + g_RT[34] - g_RT[47]);
+    Kc = Kc_s[220];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[34]) + (h_RT[5] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40086,12 +38314,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[34];
-    k_f = prefactor_units[221] * fwd_A[221]
-                * exp(fwd_beta[221] * tc[0] - activation_units[221] * fwd_Ea[221] * invT);
+    k_f = k_f_s[221];
     dlnkfdT = fwd_beta[221] * invT + activation_units[221] * fwd_Ea[221] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[47];
-    Kc = exp(g_RT[12] - g_RT[13] + g_RT[34] - g_RT[47]);
+    Kc = Kc_s[221];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[34]) + (h_RT[13] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40137,12 +38364,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[38];
-    k_f = prefactor_units[222] * fwd_A[222]
-                * exp(fwd_beta[222] * tc[0] - activation_units[222] * fwd_Ea[222] * invT);
+    k_f = k_f_s[222];
     dlnkfdT = fwd_beta[222] * invT + activation_units[222] * fwd_Ea[222] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[35];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[35] + g_RT[38]);
+    Kc = Kc_s[222];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[38]) + (h_RT[4] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40188,12 +38414,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[38];
-    k_f = prefactor_units[223] * fwd_A[223]
-                * exp(fwd_beta[223] * tc[0] - activation_units[223] * fwd_Ea[223] * invT);
+    k_f = k_f_s[223];
     dlnkfdT = fwd_beta[223] * invT + activation_units[223] * fwd_Ea[223] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[35];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[35] + g_RT[38]);
+    Kc = Kc_s[223];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[38]) + (h_RT[0] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40239,12 +38464,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[38];
-    k_f = prefactor_units[224] * fwd_A[224]
-                * exp(fwd_beta[224] * tc[0] - activation_units[224] * fwd_Ea[224] * invT);
+    k_f = k_f_s[224];
     dlnkfdT = fwd_beta[224] * invT + activation_units[224] * fwd_Ea[224] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[35];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[35] + g_RT[38]);
+    Kc = Kc_s[224];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[38]) + (h_RT[5] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40290,12 +38514,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[38];
-    k_f = prefactor_units[225] * fwd_A[225]
-                * exp(fwd_beta[225] * tc[0] - activation_units[225] * fwd_Ea[225] * invT);
+    k_f = k_f_s[225];
     dlnkfdT = fwd_beta[225] * invT + activation_units[225] * fwd_Ea[225] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[35];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[35] + g_RT[38]);
+    Kc = Kc_s[225];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[38]) + (h_RT[6] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40341,12 +38564,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[39];
-    k_f = prefactor_units[226] * fwd_A[226]
-                * exp(fwd_beta[226] * tc[0] - activation_units[226] * fwd_Ea[226] * invT);
+    k_f = k_f_s[226];
     dlnkfdT = fwd_beta[226] * invT + activation_units[226] * fwd_Ea[226] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[30];
-    Kc = exp(g_RT[2] - g_RT[14] - g_RT[30] + g_RT[39]);
+    Kc = Kc_s[226];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[39]) + (h_RT[14] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40392,12 +38614,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[39];
-    k_f = prefactor_units[227] * fwd_A[227]
-                * exp(fwd_beta[227] * tc[0] - activation_units[227] * fwd_Ea[227] * invT);
+    k_f = k_f_s[227];
     dlnkfdT = fwd_beta[227] * invT + activation_units[227] * fwd_Ea[227] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[46];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[39] - g_RT[46]);
+    Kc = Kc_s[227];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[39]) + (h_RT[1] + h_RT[46]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40443,12 +38664,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[39];
-    k_f = prefactor_units[228] * fwd_A[228]
-                * exp(fwd_beta[228] * tc[0] - activation_units[228] * fwd_Ea[228] * invT);
+    k_f = k_f_s[228];
     dlnkfdT = fwd_beta[228] * invT + activation_units[228] * fwd_Ea[228] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[40];
-    Kc = exp(-g_RT[4] + g_RT[5] + g_RT[39] - g_RT[40]);
+    Kc = Kc_s[228];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[39]) + (h_RT[4] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40494,12 +38714,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[39];
-    k_f = prefactor_units[229] * fwd_A[229]
-                * exp(fwd_beta[229] * tc[0] - activation_units[229] * fwd_Ea[229] * invT);
+    k_f = k_f_s[229];
     dlnkfdT = fwd_beta[229] * invT + activation_units[229] * fwd_Ea[229] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[46];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[39] - g_RT[46]);
+    Kc = Kc_s[229];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[39]) + (h_RT[2] + h_RT[46]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40545,12 +38764,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[39];
-    k_f = prefactor_units[230] * fwd_A[230]
-                * exp(fwd_beta[230] * tc[0] - activation_units[230] * fwd_Ea[230] * invT);
+    k_f = k_f_s[230];
     dlnkfdT = fwd_beta[230] * invT + activation_units[230] * fwd_Ea[230] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[40];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[39] - g_RT[40]);
+    Kc = Kc_s[230];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[39]) + (h_RT[1] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40596,12 +38814,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[46];
-    k_f = prefactor_units[231] * fwd_A[231]
-                * exp(fwd_beta[231] * tc[0] - activation_units[231] * fwd_Ea[231] * invT);
+    k_f = k_f_s[231];
     dlnkfdT = fwd_beta[231] * invT + activation_units[231] * fwd_Ea[231] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[35];
-    Kc = exp(g_RT[2] - g_RT[14] - g_RT[35] + g_RT[46]);
+    Kc = Kc_s[231];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[46]) + (h_RT[14] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40647,12 +38864,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[46];
-    k_f = prefactor_units[232] * fwd_A[232]
-                * exp(fwd_beta[232] * tc[0] - activation_units[232] * fwd_Ea[232] * invT);
+    k_f = k_f_s[232];
     dlnkfdT = fwd_beta[232] * invT + activation_units[232] * fwd_Ea[232] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[31];
-    Kc = exp(g_RT[1] - g_RT[14] - g_RT[31] + g_RT[46]);
+    Kc = Kc_s[232];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[46]) + (h_RT[14] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40698,12 +38914,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[46];
-    k_f = prefactor_units[233] * fwd_A[233]
-                * exp(fwd_beta[233] * tc[0] - activation_units[233] * fwd_Ea[233] * invT);
+    k_f = k_f_s[233];
     dlnkfdT = fwd_beta[233] * invT + activation_units[233] * fwd_Ea[233] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14]*sc[35];
-    Kc = refC * exp(-g_RT[1] + g_RT[4] - g_RT[14] - g_RT[35] + g_RT[46]);
+    Kc = Kc_s[233];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[46]) + (h_RT[1] + h_RT[14] + h_RT[35]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40762,12 +38977,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[30]*sc[46];
-    k_f = prefactor_units[234] * fwd_A[234]
-                * exp(fwd_beta[234] * tc[0] - activation_units[234] * fwd_Ea[234] * invT);
+    k_f = k_f_s[234];
     dlnkfdT = fwd_beta[234] * invT + activation_units[234] * fwd_Ea[234] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[47];
-    Kc = exp(-g_RT[14] + g_RT[30] + g_RT[46] - g_RT[47]);
+    Kc = Kc_s[234];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[30] + h_RT[46]) + (h_RT[14] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40813,12 +39027,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[46];
-    k_f = prefactor_units[235] * fwd_A[235]
-                * exp(fwd_beta[235] * tc[0] - activation_units[235] * fwd_Ea[235] * invT);
+    k_f = k_f_s[235];
     dlnkfdT = fwd_beta[235] * invT + activation_units[235] * fwd_Ea[235] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[35];
-    Kc = exp(g_RT[3] - g_RT[15] - g_RT[35] + g_RT[46]);
+    Kc = Kc_s[235];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[46]) + (h_RT[15] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40864,12 +39077,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[35]*sc[46];
-    k_f = prefactor_units[236] * fwd_A[236]
-                * exp(fwd_beta[236] * tc[0] - activation_units[236] * fwd_Ea[236] * invT);
+    k_f = k_f_s[236];
     dlnkfdT = fwd_beta[236] * invT + activation_units[236] * fwd_Ea[236] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[37];
-    Kc = exp(-g_RT[14] + g_RT[35] - g_RT[37] + g_RT[46]);
+    Kc = Kc_s[236];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[35] + h_RT[46]) + (h_RT[14] + h_RT[37]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40915,12 +39127,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[35]*sc[46];
-    k_f = prefactor_units[237] * fwd_A[237]
-                * exp(fwd_beta[237] * tc[0] - activation_units[237] * fwd_Ea[237] * invT);
+    k_f = k_f_s[237];
     dlnkfdT = fwd_beta[237] * invT + activation_units[237] * fwd_Ea[237] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[47];
-    Kc = exp(-g_RT[15] + g_RT[35] + g_RT[46] - g_RT[47]);
+    Kc = Kc_s[237];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[35] + h_RT[46]) + (h_RT[15] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40966,12 +39177,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[40];
-    k_f = prefactor_units[238] * fwd_A[238]
-                * exp(fwd_beta[238] * tc[0] - activation_units[238] * fwd_Ea[238] * invT);
+    k_f = k_f_s[238];
     dlnkfdT = fwd_beta[238] * invT + activation_units[238] * fwd_Ea[238] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[46];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[40] - g_RT[46]);
+    Kc = Kc_s[238];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[40]) + (h_RT[1] + h_RT[46]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41017,12 +39227,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[40];
-    k_f = prefactor_units[239] * fwd_A[239]
-                * exp(fwd_beta[239] * tc[0] - activation_units[239] * fwd_Ea[239] * invT);
+    k_f = k_f_s[239];
     dlnkfdT = fwd_beta[239] * invT + activation_units[239] * fwd_Ea[239] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[31];
-    Kc = exp(g_RT[2] - g_RT[14] - g_RT[31] + g_RT[40]);
+    Kc = Kc_s[239];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[40]) + (h_RT[14] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41068,12 +39277,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[40];
-    k_f = prefactor_units[240] * fwd_A[240]
-                * exp(fwd_beta[240] * tc[0] - activation_units[240] * fwd_Ea[240] * invT);
+    k_f = k_f_s[240];
     dlnkfdT = fwd_beta[240] * invT + activation_units[240] * fwd_Ea[240] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[39];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[39] + g_RT[40]);
+    Kc = Kc_s[240];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[40]) + (h_RT[4] + h_RT[39]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41119,12 +39327,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[40];
-    k_f = prefactor_units[241] * fwd_A[241]
-                * exp(fwd_beta[241] * tc[0] - activation_units[241] * fwd_Ea[241] * invT);
+    k_f = k_f_s[241];
     dlnkfdT = fwd_beta[241] * invT + activation_units[241] * fwd_Ea[241] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[44];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[40] - g_RT[44]);
+    Kc = Kc_s[241];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[40]) + (h_RT[1] + h_RT[44]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41170,12 +39377,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[40];
-    k_f = prefactor_units[242] * fwd_A[242]
-                * exp(fwd_beta[242] * tc[0] - activation_units[242] * fwd_Ea[242] * invT);
+    k_f = k_f_s[242];
     dlnkfdT = fwd_beta[242] * invT + activation_units[242] * fwd_Ea[242] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[45];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[40] - g_RT[45]);
+    Kc = Kc_s[242];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[40]) + (h_RT[1] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41221,12 +39427,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[40];
-    k_f = prefactor_units[243] * fwd_A[243]
-                * exp(fwd_beta[243] * tc[0] - activation_units[243] * fwd_Ea[243] * invT);
+    k_f = k_f_s[243];
     dlnkfdT = fwd_beta[243] * invT + activation_units[243] * fwd_Ea[243] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[32];
-    Kc = exp(g_RT[4] - g_RT[14] - g_RT[32] + g_RT[40]);
+    Kc = Kc_s[243];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[40]) + (h_RT[14] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41272,12 +39477,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[30]*sc[41];
-    k_f = prefactor_units[244] * fwd_A[244]
-                * exp(fwd_beta[244] * tc[0] - activation_units[244] * fwd_Ea[244] * invT);
+    k_f = k_f_s[244];
     dlnkfdT = fwd_beta[244] * invT + activation_units[244] * fwd_Ea[244] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[47];
-    Kc = exp(-g_RT[10] + g_RT[30] + g_RT[41] - g_RT[47]);
+    Kc = Kc_s[244];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[30] + h_RT[41]) + (h_RT[10] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41323,12 +39527,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[47];
-    k_f = prefactor_units[245] * fwd_A[245]
-                * exp(fwd_beta[245] * tc[0] - activation_units[245] * fwd_Ea[245] * invT);
+    k_f = k_f_s[245];
     dlnkfdT = fwd_beta[245] * invT + activation_units[245] * fwd_Ea[245] * invT2;
     /* reverse */
     phi_r = sc[30]*sc[39];
-    Kc = exp(g_RT[8] - g_RT[30] - g_RT[39] + g_RT[47]);
+    Kc = Kc_s[245];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[47]) + (h_RT[30] + h_RT[39]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41374,12 +39577,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[47];
-    k_f = prefactor_units[246] * fwd_A[246]
-                * exp(fwd_beta[246] * tc[0] - activation_units[246] * fwd_Ea[246] * invT);
+    k_f = k_f_s[246];
     dlnkfdT = fwd_beta[246] * invT + activation_units[246] * fwd_Ea[246] * invT2;
     /* reverse */
     phi_r = sc[30]*sc[40];
-    Kc = exp(g_RT[9] - g_RT[30] - g_RT[40] + g_RT[47]);
+    Kc = Kc_s[246];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[47]) + (h_RT[30] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41425,12 +39627,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[47];
-    k_f = prefactor_units[247] * fwd_A[247]
-                * exp(fwd_beta[247] * tc[0] - activation_units[247] * fwd_Ea[247] * invT);
+    k_f = k_f_s[247];
     dlnkfdT = fwd_beta[247] * invT + activation_units[247] * fwd_Ea[247] * invT2;
     /* reverse */
     phi_r = sc[31]*sc[40];
-    Kc = exp(g_RT[10] - g_RT[31] - g_RT[40] + g_RT[47]);
+    Kc = Kc_s[247];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[47]) + (h_RT[31] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41476,12 +39677,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[47];
-    k_f = prefactor_units[248] * fwd_A[248]
-                * exp(fwd_beta[248] * tc[0] - activation_units[248] * fwd_Ea[248] * invT);
+    k_f = k_f_s[248];
     dlnkfdT = fwd_beta[248] * invT + activation_units[248] * fwd_Ea[248] * invT2;
     /* reverse */
     phi_r = sc[31]*sc[40];
-    Kc = exp(g_RT[11] - g_RT[31] - g_RT[40] + g_RT[47]);
+    Kc = Kc_s[248];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[47]) + (h_RT[31] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41527,12 +39727,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[35];
-    k_f = prefactor_units[249] * fwd_A[249]
-                * exp(fwd_beta[249] * tc[0] - activation_units[249] * fwd_Ea[249] * invT);
+    k_f = k_f_s[249];
     dlnkfdT = fwd_beta[249] * invT + activation_units[249] * fwd_Ea[249] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[39];
-    Kc = exp(-g_RT[2] + g_RT[8] + g_RT[35] - g_RT[39]);
+    Kc = Kc_s[249];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[35]) + (h_RT[2] + h_RT[39]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41578,12 +39777,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[35];
-    k_f = prefactor_units[250] * fwd_A[250]
-                * exp(fwd_beta[250] * tc[0] - activation_units[250] * fwd_Ea[250] * invT);
+    k_f = k_f_s[250];
     dlnkfdT = fwd_beta[250] * invT + activation_units[250] * fwd_Ea[250] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[30];
-    Kc = exp(g_RT[8] - g_RT[14] - g_RT[30] + g_RT[35]);
+    Kc = Kc_s[250];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[35]) + (h_RT[14] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41629,12 +39827,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[35];
-    k_f = prefactor_units[251] * fwd_A[251]
-                * exp(fwd_beta[251] * tc[0] - activation_units[251] * fwd_Ea[251] * invT);
+    k_f = k_f_s[251];
     dlnkfdT = fwd_beta[251] * invT + activation_units[251] * fwd_Ea[251] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[40];
-    Kc = exp(-g_RT[2] + g_RT[9] + g_RT[35] - g_RT[40]);
+    Kc = Kc_s[251];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[35]) + (h_RT[2] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41680,12 +39877,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[35];
-    k_f = prefactor_units[252] * fwd_A[252]
-                * exp(fwd_beta[252] * tc[0] - activation_units[252] * fwd_Ea[252] * invT);
+    k_f = k_f_s[252];
     dlnkfdT = fwd_beta[252] * invT + activation_units[252] * fwd_Ea[252] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[46];
-    Kc = exp(-g_RT[1] + g_RT[9] + g_RT[35] - g_RT[46]);
+    Kc = Kc_s[252];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[35]) + (h_RT[1] + h_RT[46]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41731,12 +39927,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[35];
-    k_f = prefactor_units[253] * fwd_A[253]
-                * exp(fwd_beta[253] * tc[0] - activation_units[253] * fwd_Ea[253] * invT);
+    k_f = k_f_s[253];
     dlnkfdT = fwd_beta[253] * invT + activation_units[253] * fwd_Ea[253] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[30];
-    Kc = exp(g_RT[9] - g_RT[16] - g_RT[30] + g_RT[35]);
+    Kc = Kc_s[253];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[35]) + (h_RT[16] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41782,12 +39977,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[35];
-    k_f = prefactor_units[254] * fwd_A[254]
-                * exp(fwd_beta[254] * tc[0] - activation_units[254] * fwd_Ea[254] * invT);
+    k_f = k_f_s[254];
     dlnkfdT = fwd_beta[254] * invT + activation_units[254] * fwd_Ea[254] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[45];
-    Kc = exp(-g_RT[1] + g_RT[10] + g_RT[35] - g_RT[45]);
+    Kc = Kc_s[254];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[35]) + (h_RT[1] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41833,12 +40027,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[35];
-    k_f = prefactor_units[255] * fwd_A[255]
-                * exp(fwd_beta[255] * tc[0] - activation_units[255] * fwd_Ea[255] * invT);
+    k_f = k_f_s[255];
     dlnkfdT = fwd_beta[255] * invT + activation_units[255] * fwd_Ea[255] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[40];
-    Kc = exp(-g_RT[4] + g_RT[10] + g_RT[35] - g_RT[40]);
+    Kc = Kc_s[255];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[35]) + (h_RT[4] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41884,12 +40077,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[35];
-    k_f = prefactor_units[256] * fwd_A[256]
-                * exp(fwd_beta[256] * tc[0] - activation_units[256] * fwd_Ea[256] * invT);
+    k_f = k_f_s[256];
     dlnkfdT = fwd_beta[256] * invT + activation_units[256] * fwd_Ea[256] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[43];
-    Kc = exp(-g_RT[1] + g_RT[10] + g_RT[35] - g_RT[43]);
+    Kc = Kc_s[256];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[35]) + (h_RT[1] + h_RT[43]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41935,12 +40127,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[35];
-    k_f = prefactor_units[257] * fwd_A[257]
-                * exp(fwd_beta[257] * tc[0] - activation_units[257] * fwd_Ea[257] * invT);
+    k_f = k_f_s[257];
     dlnkfdT = fwd_beta[257] * invT + activation_units[257] * fwd_Ea[257] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[45];
-    Kc = exp(-g_RT[1] + g_RT[11] + g_RT[35] - g_RT[45]);
+    Kc = Kc_s[257];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[35]) + (h_RT[1] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41986,12 +40177,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[35];
-    k_f = prefactor_units[258] * fwd_A[258]
-                * exp(fwd_beta[258] * tc[0] - activation_units[258] * fwd_Ea[258] * invT);
+    k_f = k_f_s[258];
     dlnkfdT = fwd_beta[258] * invT + activation_units[258] * fwd_Ea[258] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[40];
-    Kc = exp(-g_RT[4] + g_RT[11] + g_RT[35] - g_RT[40]);
+    Kc = Kc_s[258];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[35]) + (h_RT[4] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42037,12 +40227,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[35];
-    k_f = prefactor_units[259] * fwd_A[259]
-                * exp(fwd_beta[259] * tc[0] - activation_units[259] * fwd_Ea[259] * invT);
+    k_f = k_f_s[259];
     dlnkfdT = fwd_beta[259] * invT + activation_units[259] * fwd_Ea[259] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[43];
-    Kc = exp(-g_RT[1] + g_RT[11] + g_RT[35] - g_RT[43]);
+    Kc = Kc_s[259];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[35]) + (h_RT[1] + h_RT[43]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42088,12 +40277,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[35];
-    k_f = prefactor_units[260] * fwd_A[260]
-                * exp(fwd_beta[260] * tc[0] - activation_units[260] * fwd_Ea[260] * invT);
+    k_f = k_f_s[260];
     dlnkfdT = fwd_beta[260] * invT + activation_units[260] * fwd_Ea[260] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[40];
-    Kc = exp(-g_RT[5] + g_RT[12] + g_RT[35] - g_RT[40]);
+    Kc = Kc_s[260];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[35]) + (h_RT[5] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42139,12 +40327,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[35];
-    k_f = prefactor_units[261] * fwd_A[261]
-                * exp(fwd_beta[261] * tc[0] - activation_units[261] * fwd_Ea[261] * invT);
+    k_f = k_f_s[261];
     dlnkfdT = fwd_beta[261] * invT + activation_units[261] * fwd_Ea[261] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[41];
-    Kc = exp(-g_RT[4] + g_RT[12] + g_RT[35] - g_RT[41]);
+    Kc = Kc_s[261];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[35]) + (h_RT[4] + h_RT[41]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42190,12 +40377,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[42];
-    k_f = prefactor_units[262] * fwd_A[262]
-                * exp(fwd_beta[262] * tc[0] - activation_units[262] * fwd_Ea[262] * invT);
+    k_f = k_f_s[262];
     dlnkfdT = fwd_beta[262] * invT + activation_units[262] * fwd_Ea[262] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14]*sc[47];
-    Kc = refC * exp(-g_RT[1] + g_RT[2] - g_RT[14] + g_RT[42] - g_RT[47]);
+    Kc = Kc_s[262];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[42]) + (h_RT[1] + h_RT[14] + h_RT[47]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42254,12 +40440,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[42];
-    k_f = prefactor_units[263] * fwd_A[263]
-                * exp(fwd_beta[263] * tc[0] - activation_units[263] * fwd_Ea[263] * invT);
+    k_f = k_f_s[263];
     dlnkfdT = fwd_beta[263] * invT + activation_units[263] * fwd_Ea[263] * invT2;
     /* reverse */
     phi_r = sc[35]*sc[40];
-    Kc = exp(g_RT[2] - g_RT[35] - g_RT[40] + g_RT[42]);
+    Kc = Kc_s[263];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[42]) + (h_RT[35] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42305,12 +40490,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[42];
-    k_f = prefactor_units[264] * fwd_A[264]
-                * exp(fwd_beta[264] * tc[0] - activation_units[264] * fwd_Ea[264] * invT);
+    k_f = k_f_s[264];
     dlnkfdT = fwd_beta[264] * invT + activation_units[264] * fwd_Ea[264] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[16]*sc[47];
-    Kc = refC * exp(-g_RT[2] + g_RT[3] - g_RT[16] + g_RT[42] - g_RT[47]);
+    Kc = Kc_s[264];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[42]) + (h_RT[2] + h_RT[16] + h_RT[47]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42369,12 +40553,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[42];
-    k_f = prefactor_units[265] * fwd_A[265]
-                * exp(fwd_beta[265] * tc[0] - activation_units[265] * fwd_Ea[265] * invT);
+    k_f = k_f_s[265];
     dlnkfdT = fwd_beta[265] * invT + activation_units[265] * fwd_Ea[265] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[16]*sc[47];
-    Kc = refC * exp(-g_RT[1] + g_RT[4] - g_RT[16] + g_RT[42] - g_RT[47]);
+    Kc = Kc_s[265];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[42]) + (h_RT[1] + h_RT[16] + h_RT[47]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42433,12 +40616,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[42];
-    k_f = prefactor_units[266] * fwd_A[266]
-                * exp(fwd_beta[266] * tc[0] - activation_units[266] * fwd_Ea[266] * invT);
+    k_f = k_f_s[266];
     dlnkfdT = fwd_beta[266] * invT + activation_units[266] * fwd_Ea[266] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[47];
-    Kc = exp(g_RT[1] - g_RT[10] + g_RT[42] - g_RT[47]);
+    Kc = Kc_s[266];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[42]) + (h_RT[10] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42484,12 +40666,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[45];
-    k_f = prefactor_units[267] * fwd_A[267]
-                * exp(fwd_beta[267] * tc[0] - activation_units[267] * fwd_Ea[267] * invT);
+    k_f = k_f_s[267];
     dlnkfdT = fwd_beta[267] * invT + activation_units[267] * fwd_Ea[267] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[31];
-    Kc = exp(g_RT[2] - g_RT[15] - g_RT[31] + g_RT[45]);
+    Kc = Kc_s[267];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[45]) + (h_RT[15] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42535,12 +40716,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[45];
-    k_f = prefactor_units[268] * fwd_A[268]
-                * exp(fwd_beta[268] * tc[0] - activation_units[268] * fwd_Ea[268] * invT);
+    k_f = k_f_s[268];
     dlnkfdT = fwd_beta[268] * invT + activation_units[268] * fwd_Ea[268] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[38];
-    Kc = exp(g_RT[2] - g_RT[14] - g_RT[38] + g_RT[45]);
+    Kc = Kc_s[268];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[45]) + (h_RT[14] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42586,12 +40766,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[45];
-    k_f = prefactor_units[269] * fwd_A[269]
-                * exp(fwd_beta[269] * tc[0] - activation_units[269] * fwd_Ea[269] * invT);
+    k_f = k_f_s[269];
     dlnkfdT = fwd_beta[269] * invT + activation_units[269] * fwd_Ea[269] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[46];
-    Kc = exp(g_RT[2] - g_RT[4] + g_RT[45] - g_RT[46]);
+    Kc = Kc_s[269];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[45]) + (h_RT[4] + h_RT[46]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42637,12 +40816,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[45];
-    k_f = prefactor_units[270] * fwd_A[270]
-                * exp(fwd_beta[270] * tc[0] - activation_units[270] * fwd_Ea[270] * invT);
+    k_f = k_f_s[270];
     dlnkfdT = fwd_beta[270] * invT + activation_units[270] * fwd_Ea[270] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[32];
-    Kc = exp(g_RT[1] - g_RT[14] - g_RT[32] + g_RT[45]);
+    Kc = Kc_s[270];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[45]) + (h_RT[14] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42688,12 +40866,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[45];
-    k_f = prefactor_units[271] * fwd_A[271]
-                * exp(fwd_beta[271] * tc[0] - activation_units[271] * fwd_Ea[271] * invT);
+    k_f = k_f_s[271];
     dlnkfdT = fwd_beta[271] * invT + activation_units[271] * fwd_Ea[271] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[46];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[45] - g_RT[46]);
+    Kc = Kc_s[271];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[45]) + (h_RT[0] + h_RT[46]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42739,12 +40916,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[45];
-    k_f = prefactor_units[272] * fwd_A[272]
-                * exp(fwd_beta[272] * tc[0] - activation_units[272] * fwd_Ea[272] * invT);
+    k_f = k_f_s[272];
     dlnkfdT = fwd_beta[272] * invT + activation_units[272] * fwd_Ea[272] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[46];
-    Kc = exp(g_RT[4] - g_RT[5] + g_RT[45] - g_RT[46]);
+    Kc = Kc_s[272];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[45]) + (h_RT[5] + h_RT[46]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42790,12 +40966,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[45];
-    k_f = prefactor_units[273] * fwd_A[273]
-                * exp(fwd_beta[273] * tc[0] - activation_units[273] * fwd_Ea[273] * invT);
+    k_f = k_f_s[273];
     dlnkfdT = fwd_beta[273] * invT + activation_units[273] * fwd_Ea[273] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[32];
-    Kc = exp(g_RT[4] - g_RT[15] - g_RT[32] + g_RT[45]);
+    Kc = Kc_s[273];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[45]) + (h_RT[15] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42841,12 +41016,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[43];
-    k_f = prefactor_units[274] * fwd_A[274]
-                * exp(fwd_beta[274] * tc[0] - activation_units[274] * fwd_Ea[274] * invT);
+    k_f = k_f_s[274];
     dlnkfdT = fwd_beta[274] * invT + activation_units[274] * fwd_Ea[274] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[45];
-    Kc = exp(g_RT[1] - g_RT[1] + g_RT[43] - g_RT[45]);
+    Kc = Kc_s[274];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[43]) + (h_RT[1] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42876,12 +41050,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[43];
-    k_f = prefactor_units[275] * fwd_A[275]
-                * exp(fwd_beta[275] * tc[0] - activation_units[275] * fwd_Ea[275] * invT);
+    k_f = k_f_s[275];
     dlnkfdT = fwd_beta[275] * invT + activation_units[275] * fwd_Ea[275] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[40];
-    Kc = exp(g_RT[1] - g_RT[4] - g_RT[40] + g_RT[43]);
+    Kc = Kc_s[275];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[43]) + (h_RT[4] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42927,12 +41100,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[43];
-    k_f = prefactor_units[276] * fwd_A[276]
-                * exp(fwd_beta[276] * tc[0] - activation_units[276] * fwd_Ea[276] * invT);
+    k_f = k_f_s[276];
     dlnkfdT = fwd_beta[276] * invT + activation_units[276] * fwd_Ea[276] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[32];
-    Kc = exp(g_RT[1] - g_RT[14] - g_RT[32] + g_RT[43]);
+    Kc = Kc_s[276];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[43]) + (h_RT[14] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42978,12 +41150,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[44];
-    k_f = prefactor_units[277] * fwd_A[277]
-                * exp(fwd_beta[277] * tc[0] - activation_units[277] * fwd_Ea[277] * invT);
+    k_f = k_f_s[277];
     dlnkfdT = fwd_beta[277] * invT + activation_units[277] * fwd_Ea[277] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[45];
-    Kc = exp(g_RT[1] - g_RT[1] + g_RT[44] - g_RT[45]);
+    Kc = Kc_s[277];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[44]) + (h_RT[1] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43013,12 +41184,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[27]*sc[35];
-    k_f = prefactor_units[278] * fwd_A[278]
-                * exp(fwd_beta[278] * tc[0] - activation_units[278] * fwd_Ea[278] * invT);
+    k_f = k_f_s[278];
     dlnkfdT = fwd_beta[278] * invT + activation_units[278] * fwd_Ea[278] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[43];
-    Kc = exp(-g_RT[14] + g_RT[27] + g_RT[35] - g_RT[43]);
+    Kc = Kc_s[278];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[27] + h_RT[35]) + (h_RT[14] + h_RT[43]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43064,12 +41234,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[30];
-    k_f = prefactor_units[279] * fwd_A[279]
-                * exp(fwd_beta[279] * tc[0] - activation_units[279] * fwd_Ea[279] * invT);
+    k_f = k_f_s[279];
     dlnkfdT = fwd_beta[279] * invT + activation_units[279] * fwd_Ea[279] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[41];
-    Kc = exp(-g_RT[1] + g_RT[12] + g_RT[30] - g_RT[41]);
+    Kc = Kc_s[279];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[30]) + (h_RT[1] + h_RT[41]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43115,12 +41284,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[30];
-    k_f = prefactor_units[280] * fwd_A[280]
-                * exp(fwd_beta[280] * tc[0] - activation_units[280] * fwd_Ea[280] * invT);
+    k_f = k_f_s[280];
     dlnkfdT = fwd_beta[280] * invT + activation_units[280] * fwd_Ea[280] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[40];
-    Kc = exp(-g_RT[0] + g_RT[12] + g_RT[30] - g_RT[40]);
+    Kc = Kc_s[280];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[30]) + (h_RT[0] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43166,12 +41334,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[33];
-    k_f = prefactor_units[281] * fwd_A[281]
-                * exp(fwd_beta[281] * tc[0] - activation_units[281] * fwd_Ea[281] * invT);
+    k_f = k_f_s[281];
     dlnkfdT = fwd_beta[281] * invT + activation_units[281] * fwd_Ea[281] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[32];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[32] + g_RT[33]);
+    Kc = Kc_s[281];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[33]) + (h_RT[0] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43217,12 +41384,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[33];
-    k_f = prefactor_units[282] * fwd_A[282]
-                * exp(fwd_beta[282] * tc[0] - activation_units[282] * fwd_Ea[282] * invT);
+    k_f = k_f_s[282];
     dlnkfdT = fwd_beta[282] * invT + activation_units[282] * fwd_Ea[282] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[32];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[32] + g_RT[33]);
+    Kc = Kc_s[282];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[33]) + (h_RT[5] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43268,12 +41434,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[33];
-    k_f = prefactor_units[283] * fwd_A[283]
-                * exp(fwd_beta[283] * tc[0] - activation_units[283] * fwd_Ea[283] * invT);
+    k_f = k_f_s[283];
     dlnkfdT = fwd_beta[283] * invT + activation_units[283] * fwd_Ea[283] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[32];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[32] + g_RT[33]);
+    Kc = Kc_s[283];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[33]) + (h_RT[4] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43319,12 +41484,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[15]*sc[31];
-    k_f = prefactor_units[284] * fwd_A[284]
-                * exp(fwd_beta[284] * tc[0] - activation_units[284] * fwd_Ea[284] * invT);
+    k_f = k_f_s[284];
     dlnkfdT = fwd_beta[284] * invT + activation_units[284] * fwd_Ea[284] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[38];
-    Kc = exp(-g_RT[14] + g_RT[15] + g_RT[31] - g_RT[38]);
+    Kc = Kc_s[284];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[15] + h_RT[31]) + (h_RT[14] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43370,12 +41534,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[36]*sc[39];
-    k_f = prefactor_units[285] * fwd_A[285]
-                * exp(fwd_beta[285] * tc[0] - activation_units[285] * fwd_Ea[285] * invT);
+    k_f = k_f_s[285];
     dlnkfdT = fwd_beta[285] * invT + activation_units[285] * fwd_Ea[285] * invT2;
     /* reverse */
     phi_r = sc[35]*sc[46];
-    Kc = exp(-g_RT[35] + g_RT[36] + g_RT[39] - g_RT[46]);
+    Kc = Kc_s[285];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[36] + h_RT[39]) + (h_RT[35] + h_RT[46]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43421,12 +41584,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[36]*sc[46];
-    k_f = prefactor_units[286] * fwd_A[286]
-                * exp(fwd_beta[286] * tc[0] - activation_units[286] * fwd_Ea[286] * invT);
+    k_f = k_f_s[286];
     dlnkfdT = fwd_beta[286] * invT + activation_units[286] * fwd_Ea[286] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[37];
-    Kc = exp(-g_RT[15] + g_RT[36] - g_RT[37] + g_RT[46]);
+    Kc = Kc_s[286];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[36] + h_RT[46]) + (h_RT[15] + h_RT[37]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43472,12 +41634,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[15]*sc[30];
-    k_f = prefactor_units[287] * fwd_A[287]
-                * exp(fwd_beta[287] * tc[0] - activation_units[287] * fwd_Ea[287] * invT);
+    k_f = k_f_s[287];
     dlnkfdT = fwd_beta[287] * invT + activation_units[287] * fwd_Ea[287] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[35];
-    Kc = exp(-g_RT[14] + g_RT[15] + g_RT[30] - g_RT[35]);
+    Kc = Kc_s[287];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[15] + h_RT[30]) + (h_RT[14] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43523,8 +41684,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[12];
-    k_f = prefactor_units[288] * fwd_A[288]
-                * exp(fwd_beta[288] * tc[0] - activation_units[288] * fwd_Ea[288] * invT);
+    k_f = k_f_s[288];
     dlnkfdT = fwd_beta[288] * invT + activation_units[288] * fwd_Ea[288] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -43560,12 +41720,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[24];
-    k_f = prefactor_units[289] * fwd_A[289]
-                * exp(fwd_beta[289] * tc[0] - activation_units[289] * fwd_Ea[289] * invT);
+    k_f = k_f_s[289];
     dlnkfdT = fwd_beta[289] * invT + activation_units[289] * fwd_Ea[289] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[51];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[24] - g_RT[51]);
+    Kc = Kc_s[289];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[24]) + (h_RT[1] + h_RT[51]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43611,12 +41770,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[25];
-    k_f = prefactor_units[290] * fwd_A[290]
-                * exp(fwd_beta[290] * tc[0] - activation_units[290] * fwd_Ea[290] * invT);
+    k_f = k_f_s[290];
     dlnkfdT = fwd_beta[290] * invT + activation_units[290] * fwd_Ea[290] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[52];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[25] - g_RT[52]);
+    Kc = Kc_s[290];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[25]) + (h_RT[1] + h_RT[52]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43662,12 +41820,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[6];
-    k_f = prefactor_units[291] * fwd_A[291]
-                * exp(fwd_beta[291] * tc[0] - activation_units[291] * fwd_Ea[291] * invT);
+    k_f = k_f_s[291];
     dlnkfdT = fwd_beta[291] * invT + activation_units[291] * fwd_Ea[291] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[5];
-    Kc = exp(-g_RT[3] + g_RT[4] - g_RT[5] + g_RT[6]);
+    Kc = Kc_s[291];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[6]) + (h_RT[3] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43713,8 +41870,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[12];
-    k_f = prefactor_units[292] * fwd_A[292]
-                * exp(fwd_beta[292] * tc[0] - activation_units[292] * fwd_Ea[292] * invT);
+    k_f = k_f_s[292];
     dlnkfdT = fwd_beta[292] * invT + activation_units[292] * fwd_Ea[292] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -43746,8 +41902,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[10];
-    k_f = prefactor_units[293] * fwd_A[293]
-                * exp(fwd_beta[293] * tc[0] - activation_units[293] * fwd_Ea[293] * invT);
+    k_f = k_f_s[293];
     dlnkfdT = fwd_beta[293] * invT + activation_units[293] * fwd_Ea[293] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -43779,12 +41934,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[10];
-    k_f = prefactor_units[294] * fwd_A[294]
-                * exp(fwd_beta[294] * tc[0] - activation_units[294] * fwd_Ea[294] * invT);
+    k_f = k_f_s[294];
     dlnkfdT = fwd_beta[294] * invT + activation_units[294] * fwd_Ea[294] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[17];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[10] - g_RT[17]);
+    Kc = Kc_s[294];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[10]) + (h_RT[2] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43830,8 +41984,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[10];
-    k_f = prefactor_units[295] * fwd_A[295]
-                * exp(fwd_beta[295] * tc[0] - activation_units[295] * fwd_Ea[295] * invT);
+    k_f = k_f_s[295];
     dlnkfdT = fwd_beta[295] * invT + activation_units[295] * fwd_Ea[295] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -43854,8 +42007,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[11];
-    k_f = prefactor_units[296] * fwd_A[296]
-                * exp(fwd_beta[296] * tc[0] - activation_units[296] * fwd_Ea[296] * invT);
+    k_f = k_f_s[296];
     dlnkfdT = fwd_beta[296] * invT + activation_units[296] * fwd_Ea[296] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -43887,12 +42039,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[23];
-    k_f = prefactor_units[297] * fwd_A[297]
-                * exp(fwd_beta[297] * tc[0] - activation_units[297] * fwd_Ea[297] * invT);
+    k_f = k_f_s[297];
     dlnkfdT = fwd_beta[297] * invT + activation_units[297] * fwd_Ea[297] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[51];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[23] - g_RT[51]);
+    Kc = Kc_s[297];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[23]) + (h_RT[2] + h_RT[51]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43938,12 +42089,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[23];
-    k_f = prefactor_units[298] * fwd_A[298]
-                * exp(fwd_beta[298] * tc[0] - activation_units[298] * fwd_Ea[298] * invT);
+    k_f = k_f_s[298];
     dlnkfdT = fwd_beta[298] * invT + activation_units[298] * fwd_Ea[298] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[22];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[22] + g_RT[23]);
+    Kc = Kc_s[298];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[23]) + (h_RT[6] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43989,12 +42139,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[52];
-    k_f = prefactor_units[299] * fwd_A[299]
-                * exp(fwd_beta[299] * tc[0] - activation_units[299] * fwd_Ea[299] * invT);
+    k_f = k_f_s[299];
     dlnkfdT = fwd_beta[299] * invT + activation_units[299] * fwd_Ea[299] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[51];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[51] + g_RT[52]);
+    Kc = Kc_s[299];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[52]) + (h_RT[4] + h_RT[51]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44040,8 +42189,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[52];
-    k_f = prefactor_units[300] * fwd_A[300]
-                * exp(fwd_beta[300] * tc[0] - activation_units[300] * fwd_Ea[300] * invT);
+    k_f = k_f_s[300];
     dlnkfdT = fwd_beta[300] * invT + activation_units[300] * fwd_Ea[300] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -44077,8 +42225,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[52];
-    k_f = prefactor_units[301] * fwd_A[301]
-                * exp(fwd_beta[301] * tc[0] - activation_units[301] * fwd_Ea[301] * invT);
+    k_f = k_f_s[301];
     dlnkfdT = fwd_beta[301] * invT + activation_units[301] * fwd_Ea[301] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -44114,12 +42261,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[52];
-    k_f = prefactor_units[302] * fwd_A[302]
-                * exp(fwd_beta[302] * tc[0] - activation_units[302] * fwd_Ea[302] * invT);
+    k_f = k_f_s[302];
     dlnkfdT = fwd_beta[302] * invT + activation_units[302] * fwd_Ea[302] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[51];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[51] + g_RT[52]);
+    Kc = Kc_s[302];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[52]) + (h_RT[0] + h_RT[51]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44165,8 +42311,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[52];
-    k_f = prefactor_units[303] * fwd_A[303]
-                * exp(fwd_beta[303] * tc[0] - activation_units[303] * fwd_Ea[303] * invT);
+    k_f = k_f_s[303];
     dlnkfdT = fwd_beta[303] * invT + activation_units[303] * fwd_Ea[303] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -44202,8 +42347,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[52];
-    k_f = prefactor_units[304] * fwd_A[304]
-                * exp(fwd_beta[304] * tc[0] - activation_units[304] * fwd_Ea[304] * invT);
+    k_f = k_f_s[304];
     dlnkfdT = fwd_beta[304] * invT + activation_units[304] * fwd_Ea[304] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -44239,8 +42383,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[52];
-    k_f = prefactor_units[305] * fwd_A[305]
-                * exp(fwd_beta[305] * tc[0] - activation_units[305] * fwd_Ea[305] * invT);
+    k_f = k_f_s[305];
     dlnkfdT = fwd_beta[305] * invT + activation_units[305] * fwd_Ea[305] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -44276,8 +42419,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[52];
-    k_f = prefactor_units[306] * fwd_A[306]
-                * exp(fwd_beta[306] * tc[0] - activation_units[306] * fwd_Ea[306] * invT);
+    k_f = k_f_s[306];
     dlnkfdT = fwd_beta[306] * invT + activation_units[306] * fwd_Ea[306] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -44305,8 +42447,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[51];
-    k_f = prefactor_units[307] * fwd_A[307]
-                * exp(fwd_beta[307] * tc[0] - activation_units[307] * fwd_Ea[307] * invT);
+    k_f = k_f_s[307];
     dlnkfdT = fwd_beta[307] * invT + activation_units[307] * fwd_Ea[307] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -44342,8 +42483,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[51];
-    k_f = prefactor_units[308] * fwd_A[308]
-                * exp(fwd_beta[308] * tc[0] - activation_units[308] * fwd_Ea[308] * invT);
+    k_f = k_f_s[308];
     dlnkfdT = fwd_beta[308] * invT + activation_units[308] * fwd_Ea[308] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -44379,8 +42519,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[51];
-    k_f = prefactor_units[309] * fwd_A[309]
-                * exp(fwd_beta[309] * tc[0] - activation_units[309] * fwd_Ea[309] * invT);
+    k_f = k_f_s[309];
     dlnkfdT = fwd_beta[309] * invT + activation_units[309] * fwd_Ea[309] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -44412,12 +42551,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[51];
-    k_f = prefactor_units[310] * fwd_A[310]
-                * exp(fwd_beta[310] * tc[0] - activation_units[310] * fwd_Ea[310] * invT);
+    k_f = k_f_s[310];
     dlnkfdT = fwd_beta[310] * invT + activation_units[310] * fwd_Ea[310] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[16];
-    Kc = exp(g_RT[1] - g_RT[12] - g_RT[16] + g_RT[51]);
+    Kc = Kc_s[310];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[51]) + (h_RT[12] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44463,12 +42601,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[51];
-    k_f = prefactor_units[311] * fwd_A[311]
-                * exp(fwd_beta[311] * tc[0] - activation_units[311] * fwd_Ea[311] * invT);
+    k_f = k_f_s[311];
     dlnkfdT = fwd_beta[311] * invT + activation_units[311] * fwd_Ea[311] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[28];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[28] + g_RT[51]);
+    Kc = Kc_s[311];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[51]) + (h_RT[0] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44514,12 +42651,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[51];
-    k_f = prefactor_units[312] * fwd_A[312]
-                * exp(fwd_beta[312] * tc[0] - activation_units[312] * fwd_Ea[312] * invT);
+    k_f = k_f_s[312];
     dlnkfdT = fwd_beta[312] * invT + activation_units[312] * fwd_Ea[312] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[28];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[28] + g_RT[51]);
+    Kc = Kc_s[312];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[51]) + (h_RT[5] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44565,12 +42701,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[51];
-    k_f = prefactor_units[313] * fwd_A[313]
-                * exp(fwd_beta[313] * tc[0] - activation_units[313] * fwd_Ea[313] * invT);
+    k_f = k_f_s[313];
     dlnkfdT = fwd_beta[313] * invT + activation_units[313] * fwd_Ea[313] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[18];
-    Kc = exp(g_RT[4] - g_RT[16] - g_RT[18] + g_RT[51]);
+    Kc = Kc_s[313];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[51]) + (h_RT[16] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44616,12 +42751,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[50];
-    k_f = prefactor_units[314] * fwd_A[314]
-                * exp(fwd_beta[314] * tc[0] - activation_units[314] * fwd_Ea[314] * invT);
+    k_f = k_f_s[314];
     dlnkfdT = fwd_beta[314] * invT + activation_units[314] * fwd_Ea[314] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[49];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[49] + g_RT[50]);
+    Kc = Kc_s[314];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[50]) + (h_RT[4] + h_RT[49]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44667,12 +42801,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[50];
-    k_f = prefactor_units[315] * fwd_A[315]
-                * exp(fwd_beta[315] * tc[0] - activation_units[315] * fwd_Ea[315] * invT);
+    k_f = k_f_s[315];
     dlnkfdT = fwd_beta[315] * invT + activation_units[315] * fwd_Ea[315] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[49];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[49] + g_RT[50]);
+    Kc = Kc_s[315];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[50]) + (h_RT[0] + h_RT[49]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44718,12 +42851,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[50];
-    k_f = prefactor_units[316] * fwd_A[316]
-                * exp(fwd_beta[316] * tc[0] - activation_units[316] * fwd_Ea[316] * invT);
+    k_f = k_f_s[316];
     dlnkfdT = fwd_beta[316] * invT + activation_units[316] * fwd_Ea[316] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[49];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[49] + g_RT[50]);
+    Kc = Kc_s[316];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[50]) + (h_RT[5] + h_RT[49]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44769,12 +42901,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[49];
-    k_f = prefactor_units[317] * fwd_A[317]
-                * exp(fwd_beta[317] * tc[0] - activation_units[317] * fwd_Ea[317] * invT);
+    k_f = k_f_s[317];
     dlnkfdT = fwd_beta[317] * invT + activation_units[317] * fwd_Ea[317] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[50];
-    Kc = exp(-g_RT[6] + g_RT[7] + g_RT[49] - g_RT[50]);
+    Kc = Kc_s[317];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[49]) + (h_RT[6] + h_RT[50]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44820,12 +42951,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[50];
-    k_f = prefactor_units[318] * fwd_A[318]
-                * exp(fwd_beta[318] * tc[0] - activation_units[318] * fwd_Ea[318] * invT);
+    k_f = k_f_s[318];
     dlnkfdT = fwd_beta[318] * invT + activation_units[318] * fwd_Ea[318] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[49];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[49] + g_RT[50]);
+    Kc = Kc_s[318];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[50]) + (h_RT[13] + h_RT[49]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44871,12 +43001,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[49];
-    k_f = prefactor_units[319] * fwd_A[319]
-                * exp(fwd_beta[319] * tc[0] - activation_units[319] * fwd_Ea[319] * invT);
+    k_f = k_f_s[319];
     dlnkfdT = fwd_beta[319] * invT + activation_units[319] * fwd_Ea[319] * invT2;
     /* reverse */
     phi_r = sc[17]*sc[25];
-    Kc = exp(g_RT[2] - g_RT[17] - g_RT[25] + g_RT[49]);
+    Kc = Kc_s[319];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[49]) + (h_RT[17] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44922,12 +43051,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[49];
-    k_f = prefactor_units[320] * fwd_A[320]
-                * exp(fwd_beta[320] * tc[0] - activation_units[320] * fwd_Ea[320] * invT);
+    k_f = k_f_s[320];
     dlnkfdT = fwd_beta[320] * invT + activation_units[320] * fwd_Ea[320] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[25];
-    Kc = exp(g_RT[1] - g_RT[12] - g_RT[25] + g_RT[49]);
+    Kc = Kc_s[320];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[49]) + (h_RT[12] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44973,12 +43101,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[49];
-    k_f = prefactor_units[321] * fwd_A[321]
-                * exp(fwd_beta[321] * tc[0] - activation_units[321] * fwd_Ea[321] * invT);
+    k_f = k_f_s[321];
     dlnkfdT = fwd_beta[321] * invT + activation_units[321] * fwd_Ea[321] * invT2;
     /* reverse */
     phi_r = sc[18]*sc[25];
-    Kc = exp(g_RT[4] - g_RT[18] - g_RT[25] + g_RT[49]);
+    Kc = Kc_s[321];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[49]) + (h_RT[18] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45024,12 +43151,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[49];
-    k_f = prefactor_units[322] * fwd_A[322]
-                * exp(fwd_beta[322] * tc[0] - activation_units[322] * fwd_Ea[322] * invT);
+    k_f = k_f_s[322];
     dlnkfdT = fwd_beta[322] * invT + activation_units[322] * fwd_Ea[322] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[50];
-    Kc = exp(-g_RT[3] + g_RT[6] + g_RT[49] - g_RT[50]);
+    Kc = Kc_s[322];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[49]) + (h_RT[3] + h_RT[50]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45075,8 +43201,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[49];
-    k_f = prefactor_units[323] * fwd_A[323]
-                * exp(fwd_beta[323] * tc[0] - activation_units[323] * fwd_Ea[323] * invT);
+    k_f = k_f_s[323];
     dlnkfdT = fwd_beta[323] * invT + activation_units[323] * fwd_Ea[323] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -45112,12 +43237,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[49];
-    k_f = prefactor_units[324] * fwd_A[324]
-                * exp(fwd_beta[324] * tc[0] - activation_units[324] * fwd_Ea[324] * invT);
+    k_f = k_f_s[324];
     dlnkfdT = fwd_beta[324] * invT + activation_units[324] * fwd_Ea[324] * invT2;
     /* reverse */
     phi_r = sc[25]*sc[25];
-    Kc = exp(g_RT[12] - 2*g_RT[25] + g_RT[49]);
+    Kc = Kc_s[324];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[49]) + (2*h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45160,6 +43284,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         dcvpRdT(dcRdT, tc);
         speciesInternalEnergy(e_RT, tc);
         eh_RT = &e_RT[0];
+        for (int k=0; k<53; k++) {
+            for (int m=0; m<53; m++) {
+                J[k*54+m] += Jmix[m];
+            }
+        }
     }
 
     double cmix = 0.0, ehmix = 0.0, dcmixdT=0.0, dehmixdT=0.0;
@@ -53081,6 +51210,55 @@ void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double
     *ierr = 0;
     return;
 }
+/* get temperature given enthalpy in mass units and mass fracs */
+void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int * ierr)
+{
+#ifdef CONVERGENCE
+    const int maxiter = 5000;
+    const double tol  = 1.e-12;
+#else
+    const int maxiter = 200;
+    const double tol  = 1.e-6;
+#endif
+    double hin  = *h;
+    double tmin = 250;/*max lower bound for thermo def */
+    double tmax = 4000;/*min upper bound for thermo def */
+    double h1,hmin,hmax,cp,t1,dt;
+    int i;/* loop counter */
+    CKHBMS(&tmin, y, iwrk, rwrk, &hmin);
+    CKHBMS(&tmax, y, iwrk, rwrk, &hmax);
+    if (hin < hmin) {
+        /*Linear Extrapolation below tmin */
+        CKCPBS(&tmin, y, iwrk, rwrk, &cp);
+        *t = tmin - (hmin-hin)/cp;
+        *ierr = 1;
+        return;
+    }
+    if (hin > hmax) {
+        /*Linear Extrapolation above tmax */
+        CKCPBS(&tmax, y, iwrk, rwrk, &cp);
+        *t = tmax - (hmax-hin)/cp;
+        *ierr = 1;
+        return;
+    }
+    t1 = *t;
+    if (t1 < tmin || t1 > tmax) {
+        t1 = tmin + (tmax-tmin)/(hmax-hmin)*(hin-hmin);
+    }
+    for (i = 0; i < maxiter; ++i) {
+        CKHBMS(&t1,y,iwrk,rwrk,&h1);
+        CKCPBS(&t1,y,iwrk,rwrk,&cp);
+        dt = (hin - h1) / cp;
+        if (dt > 100.) { dt = 100.; }
+        else if (dt < -100.) { dt = -100.; }
+        else if (fabs(dt) < tol) break;
+        else if (t1+dt == t1) break;
+        t1 += dt;
+    }
+    *t = t1;
+    *ierr = 0;
+    return;
+}
 
 /* End of file  */
 #if defined(BL_FORT_USE_UPPERCASE)
@@ -1,5 +1,6 @@
 
 #include <math.h>
+#include <float.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -86,7 +87,14 @@
 #define VCKPY VCKPY
 #define VCKWYR VCKWYR
 #define VCKYTX VCKYTX
+#define VCKCPBS VCKCPBS
+#define VCKCVBS VCKCVBS
+#define VCKHBMS VCKHBMS
+#define VCKUBMS VCKUBMS
+#define VCKRHOY VCKRHOY
+#define VCKMMWY VCKMMWY
 #define GET_T_GIVEN_EY GET_T_GIVEN_EY
+#define GET_T_GIVEN_HY GET_T_GIVEN_HY
 #define GET_REACTION_MAP GET_REACTION_MAP
 #elif defined(BL_FORT_USE_LOWERCASE)
 #define CKINDX ckindx
@@ -170,7 +178,14 @@
 #define VCKPY vckpy
 #define VCKWYR vckwyr
 #define VCKYTX vckytx
+#define VCKCPBS vckcpbs
+#define VCKCVBS vckcvbs
+#define VCKHBMS vckhbms
+#define VCKUBMS vckubms
+#define VCKRHOY vckrhoy
+#define VCKMMWY vckmmwy
 #define GET_T_GIVEN_EY get_t_given_ey
+#define GET_T_GIVEN_HY get_t_given_hy
 #define GET_REACTION_MAP get_reaction_map
 #elif defined(BL_FORT_USE_UNDERSCORE)
 #define CKINDX ckindx_
@@ -254,7 +269,14 @@
 #define VCKPY vckpy_
 #define VCKWYR vckwyr_
 #define VCKYTX vckytx_
+#define VCKCPBS vckcpbs_
+#define VCKCVBS vckcvbs_
+#define VCKHBMS vckhbms_
+#define VCKUBMS vckubms_
+#define VCKRHOY vckrhoy_
+#define VCKMMWY vckmmwy_
 #define GET_T_GIVEN_EY get_t_given_ey_
+#define GET_T_GIVEN_HY get_t_given_hy_
 #define GET_REACTION_MAP get_reaction_map_
 #endif
 
@@ -356,6 +378,7 @@ void DWDOT(double * restrict J, double * restrict sc, double * restrict T, int *
 void aJacobian(double * restrict J, double * restrict sc, double T, int consP);
 void dcvpRdT(double * restrict species, double * restrict tc);
 void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
+void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
 void GET_REACTION_MAP(int * restrict rmap);
 /*vector version */
 void vproductionRate(int npt, double * restrict wdot, double * restrict c, double * restrict T);
@@ -365,6 +388,12 @@ void VCKWYR(int * restrict np, double * restrict rho, double * restrict T,
             double * restrict y, int * restrict iwrk, double * restrict rwrk,
             double * restrict wdot);
 void VCKYTX(int * restrict np, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict x);
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs);
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs);
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms);
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms);
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho);
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm);
 void vcomp_k_f(int npt, double * restrict k_f_s, double * restrict tc, double * restrict invT);
 void vcomp_gibbs(int npt, double * restrict g_RT, double * restrict tc);
 void vcomp_Kc(int npt, double * restrict Kc_s, double * restrict g_RT, double * restrict invT);
@@ -2657,38 +2686,6 @@ void CKINDX(int * iwrk, double * restrict rwrk, int * mm, int * kk, int * ii, in
 }
 
 
-/* strtok_r: re-entrant (threadsafe) version of strtok, helper function for tokenizing strings  */
-char *strtok_r(char *s, const char *delim, char **save_ptr)
-{
-    char *token;
-
-    if (s == NULL)
-        s = *save_ptr;
-
-    /* Scan leading delimiters.  */
-    s += strspn (s, delim);
-    if (*s == '\0')
-    {
-        *save_ptr = s;
-        return NULL;
-    }
-
-    /* Find the end of the token.  */
-    token = s;
-    s = strpbrk (token, delim);
-    if (s == NULL)
-        /* This token finishes the string.  */
-        *save_ptr = __rawmemchr (token, '\0');
-    else
-    {
-        /* Terminate the token and make *SAVE_PTR point past it.  */
-        *s = '\0';
-        *save_ptr = s + 1;
-    }
-    return token;
-}
-
-
 
 /* ckxnum... for parsing strings  */
 void CKXNUM(char * line, int * nexp, int * lout, int * nval, double * restrict rval, int * kerr, int lenline )
@@ -3289,6 +3286,28 @@ void CKRHOY(double * restrict P, double * restrict T, double * restrict y, int *
 }
 
 
+/*Compute rho = P*W(y)/RT */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho)
+{
+    for (int i=0; i<(*np); i++) {
+        rho[i] = 0.0;
+    }
+
+    for (int n=0; n<39; n++) {
+        for (int i=0; i<(*np); i++) {
+            rho[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        rho[i] = P[i] / (8.31451e+07 * T[i] * rho[i]);/*rho = P*W/(R*T) */
+    }
+
+    return;
+}
+
+
 /*Compute rho = P*W(c)/(R*T) */
 void CKRHOC(double * restrict P, double * restrict T, double * restrict c, int * iwrk, double * restrict rwrk, double * restrict rho)
 {
@@ -3380,6 +3399,29 @@ void CKMMWY(double * restrict y, int * iwrk, double * restrict rwrk, double * re
 }
 
 
+/*given y[species]: mass fractions */
+/*returns mean molecular weight (gm/mole) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm)
+{
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 0.0;
+    }
+
+    for (int n=0; n<39; n++) {
+        for (int i=0; i<(*np); i++) {
+            wtm[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 1.0 / wtm[i];
+    }
+
+    return;
+}
+
+
 /*given x[species]: mole fractions */
 /*returns mean molecular weight (gm/mole) */
 void CKMMWX(double * restrict x, int * iwrk, double * restrict rwrk, double * restrict wtm)
@@ -4305,6 +4347,30 @@ void CKCPBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CP (Eq. 34) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs)
+{
+    double tc[5], tmp[39], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cp_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<39; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cpbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean specific heat at CV (Eq. 35) */
 void CKCVBL(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict cvbl)
 {
@@ -4377,6 +4443,30 @@ void CKCVBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CV (Eq. 36) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs)
+{
+    double tc[5], tmp[39], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cv_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<39; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cvbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean enthalpy of the mixture in molar units */
 void CKHBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict hbml)
 {
@@ -4418,6 +4508,30 @@ void CKHBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns mean enthalpy of mixture in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms)
+{
+    double tc[5], tmp[39], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesEnthalpy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<39; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        hbms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mean internal energy in molar units */
 void CKUBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict ubml)
 {
@@ -4492,6 +4606,30 @@ void CKUBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*get mean internal energy in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms)
+{
+    double tc[5], tmp[39], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesInternalEnergy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<39; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        ubms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mixture entropy in molar units */
 void CKSBML(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict sbml)
 {
@@ -10537,12 +10675,197 @@ void productionRate(double * restrict wdot, double * restrict sc, double T)
 
 void comp_k_f(double * restrict tc, double invT, double * restrict k_f)
 {
+    double x[175];
+#ifdef __INTEL_COMPILER
+    #pragma simd
+#endif
+    for (int i=0; i<175; ++i) {
+        x[i] = fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT;
+    };
+
+    /*the exp is skipped when the exponent is zero or that of */
+    /*an earlier reaction with the same default beta and Ea */
+    k_f[0] = exp(x[0]);
+    k_f[1] = exp(x[1]);
+    k_f[2] = (x[2] == 0.0 ? 1.0 : exp(x[2]));
+    k_f[3] = (x[3] == 0.0 ? 1.0 : exp(x[3]));
+    k_f[4] = exp(x[4]);
+    k_f[5] = exp(x[5]);
+    k_f[6] = exp(x[6]);
+    k_f[7] = (x[7] == 0.0 ? 1.0 : exp(x[7]));
+    k_f[8] = (x[8] == 0.0 ? 1.0 : exp(x[8]));
+    k_f[9] = (x[9] == 0.0 ? 1.0 : exp(x[9]));
+    k_f[10] = (x[10] == 0.0 ? 1.0 : exp(x[10]));
+    k_f[11] = (x[11] == 0.0 ? 1.0 : exp(x[11]));
+    k_f[12] = exp(x[12]);
+    k_f[13] = exp(x[13]);
+    k_f[14] = exp(x[14]);
+    k_f[15] = exp(x[15]);
+    k_f[16] = exp(x[16]);
+    k_f[17] = exp(x[17]);
+    k_f[18] = exp(x[18]);
+    k_f[19] = exp(x[19]);
+    k_f[20] = (x[20] == 0.0 ? 1.0 : exp(x[20]));
+    k_f[21] = exp(x[21]);
+    k_f[22] = exp(x[22]);
+    k_f[23] = (x[23] == 0.0 ? 1.0 : exp(x[23]));
+    k_f[24] = exp(x[24]);
+    k_f[25] = exp(x[25]);
+    k_f[26] = exp(x[26]);
+    k_f[27] = exp(x[27]);
+    k_f[28] = exp(x[28]);
+    k_f[29] = exp(x[29]);
+    k_f[30] = exp(x[30]);
+    k_f[31] = exp(x[31]);
+    k_f[32] = exp(x[32]);
+    k_f[33] = exp(x[33]);
+    k_f[34] = exp(x[34]);
+    k_f[35] = exp(x[35]);
+    k_f[36] = exp(x[36]);
+    k_f[37] = (x[37] == 0.0 ? 1.0 : exp(x[37]));
+    k_f[38] = exp(x[38]);
+    k_f[39] = exp(x[39]);
+    k_f[40] = exp(x[40]);
+    k_f[41] = exp(x[41]);
+    k_f[42] = exp(x[42]);
+    k_f[43] = exp(x[43]);
+    k_f[44] = exp(x[44]);
+    k_f[45] = exp(x[45]);
+    k_f[46] = (x[46] == 0.0 ? 1.0 : exp(x[46]));
+    k_f[47] = (x[47] == 0.0 ? 1.0 : exp(x[47]));
+    k_f[48] = (x[48] == 0.0 ? 1.0 : exp(x[48]));
+    k_f[49] = (x[49] == 0.0 ? 1.0 : exp(x[49]));
+    k_f[50] = (x[50] == 0.0 ? 1.0 : exp(x[50]));
+    k_f[51] = exp(x[51]);
+    k_f[52] = exp(x[52]);
+    k_f[53] = exp(x[53]);
+    k_f[54] = exp(x[54]);
+    k_f[55] = exp(x[55]);
+    k_f[56] = exp(x[56]);
+    k_f[57] = exp(x[57]);
+    k_f[58] = exp(x[58]);
+    k_f[59] = exp(x[59]);
+    k_f[60] = exp(x[60]);
+    k_f[61] = exp(x[61]);
+    k_f[62] = (x[62] == 0.0 ? 1.0 : exp(x[62]));
+    k_f[63] = (x[63] == 0.0 ? 1.0 : exp(x[63]));
+    k_f[64] = (x[64] == 0.0 ? 1.0 : exp(x[64]));
+    k_f[65] = exp(x[65]);
+    k_f[66] = exp(x[66]);
+    k_f[67] = exp(x[67]);
+    k_f[68] = exp(x[68]);
+    k_f[69] = (x[69] == 0.0 ? 1.0 : exp(x[69]));
+    k_f[70] = (x[70] == 0.0 ? 1.0 : exp(x[70]));
+    k_f[71] = (x[71] == 0.0 ? 1.0 : exp(x[71]));
+    k_f[72] = exp(x[72]);
+    k_f[73] = (x[73] == 0.0 ? 1.0 : exp(x[73]));
+    k_f[74] = exp(x[74]);
+    k_f[75] = (x[75] == 0.0 ? 1.0 : exp(x[75]));
+    k_f[76] = (x[76] == 0.0 ? 1.0 : exp(x[76]));
+    k_f[77] = exp(x[77]);
+    k_f[78] = (x[78] == x[77] ? k_f[77] : exp(x[78]));
+    k_f[79] = (x[79] == 0.0 ? 1.0 : exp(x[79]));
+    k_f[80] = (x[80] == 0.0 ? 1.0 : exp(x[80]));
+    k_f[81] = exp(x[81]);
+    k_f[82] = exp(x[82]);
+    k_f[83] = exp(x[83]);
+    k_f[84] = (x[84] == 0.0 ? 1.0 : exp(x[84]));
+    k_f[85] = (x[85] == 0.0 ? 1.0 : exp(x[85]));
+    k_f[86] = (x[86] == 0.0 ? 1.0 : exp(x[86]));
+    k_f[87] = (x[87] == 0.0 ? 1.0 : exp(x[87]));
+    k_f[88] = exp(x[88]);
+    k_f[89] = exp(x[89]);
+    k_f[90] = exp(x[90]);
+    k_f[91] = exp(x[91]);
+    k_f[92] = exp(x[92]);
+    k_f[93] = (x[93] == 0.0 ? 1.0 : exp(x[93]));
+    k_f[94] = (x[94] == 0.0 ? 1.0 : exp(x[94]));
+    k_f[95] = (x[95] == 0.0 ? 1.0 : exp(x[95]));
+    k_f[96] = exp(x[96]);
+    k_f[97] = exp(x[97]);
+    k_f[98] = exp(x[98]);
+    k_f[99] = exp(x[99]);
+    k_f[100] = (x[100] == x[99] ? k_f[99] : exp(x[100]));
+    k_f[101] = exp(x[101]);
+    k_f[102] = exp(x[102]);
+    k_f[103] = exp(x[103]);
+    k_f[104] = exp(x[104]);
+    k_f[105] = (x[105] == 0.0 ? 1.0 : exp(x[105]));
+    k_f[106] = exp(x[106]);
+    k_f[107] = exp(x[107]);
+    k_f[108] = exp(x[108]);
+    k_f[109] = exp(x[109]);
+    k_f[110] = exp(x[110]);
+    k_f[111] = exp(x[111]);
+    k_f[112] = exp(x[112]);
+    k_f[113] = exp(x[113]);
+    k_f[114] = exp(x[114]);
+    k_f[115] = exp(x[115]);
+    k_f[116] = exp(x[116]);
+    k_f[117] = exp(x[117]);
+    k_f[118] = (x[118] == 0.0 ? 1.0 : exp(x[118]));
+    k_f[119] = (x[119] == 0.0 ? 1.0 : exp(x[119]));
+    k_f[120] = (x[120] == 0.0 ? 1.0 : exp(x[120]));
+    k_f[121] = (x[121] == 0.0 ? 1.0 : exp(x[121]));
+    k_f[122] = exp(x[122]);
+    k_f[123] = (x[123] == x[122] ? k_f[122] : exp(x[123]));
+    k_f[124] = (x[124] == 0.0 ? 1.0 : exp(x[124]));
+    k_f[125] = (x[125] == 0.0 ? 1.0 : exp(x[125]));
+    k_f[126] = (x[126] == 0.0 ? 1.0 : exp(x[126]));
+    k_f[127] = exp(x[127]);
+    k_f[128] = (x[128] == 0.0 ? 1.0 : exp(x[128]));
+    k_f[129] = (x[129] == 0.0 ? 1.0 : exp(x[129]));
+    k_f[130] = exp(x[130]);
+    k_f[131] = (x[131] == 0.0 ? 1.0 : exp(x[131]));
+    k_f[132] = (x[132] == 0.0 ? 1.0 : exp(x[132]));
+    k_f[133] = (x[133] == 0.0 ? 1.0 : exp(x[133]));
+    k_f[134] = exp(x[134]);
+    k_f[135] = exp(x[135]);
+    k_f[136] = exp(x[136]);
+    k_f[137] = exp(x[137]);
+    k_f[138] = exp(x[138]);
+    k_f[139] = exp(x[139]);
+    k_f[140] = exp(x[140]);
+    k_f[141] = exp(x[141]);
+    k_f[142] = exp(x[142]);
+    k_f[143] = exp(x[143]);
+    k_f[144] = (x[144] == 0.0 ? 1.0 : exp(x[144]));
+    k_f[145] = exp(x[145]);
+    k_f[146] = exp(x[146]);
+    k_f[147] = (x[147] == 0.0 ? 1.0 : exp(x[147]));
+    k_f[148] = exp(x[148]);
+    k_f[149] = exp(x[149]);
+    k_f[150] = (x[150] == 0.0 ? 1.0 : exp(x[150]));
+    k_f[151] = (x[151] == 0.0 ? 1.0 : exp(x[151]));
+    k_f[152] = (x[152] == 0.0 ? 1.0 : exp(x[152]));
+    k_f[153] = exp(x[153]);
+    k_f[154] = exp(x[154]);
+    k_f[155] = exp(x[155]);
+    k_f[156] = exp(x[156]);
+    k_f[157] = exp(x[157]);
+    k_f[158] = (x[158] == 0.0 ? 1.0 : exp(x[158]));
+    k_f[159] = (x[159] == 0.0 ? 1.0 : exp(x[159]));
+    k_f[160] = exp(x[160]);
+    k_f[161] = exp(x[161]);
+    k_f[162] = exp(x[162]);
+    k_f[163] = exp(x[163]);
+    k_f[164] = exp(x[164]);
+    k_f[165] = exp(x[165]);
+    k_f[166] = exp(x[166]);
+    k_f[167] = exp(x[167]);
+    k_f[168] = exp(x[168]);
+    k_f[169] = exp(x[169]);
+    k_f[170] = exp(x[170]);
+    k_f[171] = exp(x[171]);
+    k_f[172] = exp(x[172]);
+    k_f[173] = (x[173] == 0.0 ? 1.0 : exp(x[173]));
+    k_f[174] = (x[174] == 0.0 ? 1.0 : exp(x[174]));
+
 #ifdef __INTEL_COMPILER
     #pragma simd
 #endif
     for (int i=0; i<175; ++i) {
-        k_f[i] = prefactor_units[i] * fwd_A[i]
-                    * exp(fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT);
+        k_f[i] *= prefactor_units[i] * fwd_A[i];
     };
     return;
 }
@@ -10553,234 +10876,422 @@ void comp_Kc(double * restrict tc, double invT, double * restrict Kc)
     double g_RT[39];
     gibbs(g_RT, tc);
 
-    Kc[0] = g_RT[2] + g_RT[3] - g_RT[8];
-    Kc[1] = 2*g_RT[4] - g_RT[9];
-    Kc[2] = g_RT[2] - g_RT[14] + g_RT[15];
-    Kc[3] = 2*g_RT[15] - g_RT[21];
-    Kc[4] = -g_RT[2] - g_RT[20] + g_RT[21];
-    Kc[5] = -g_RT[2] - g_RT[18] + g_RT[20];
-    Kc[6] = -g_RT[2] - g_RT[23] + g_RT[24];
-    Kc[7] = g_RT[2] - g_RT[32] + g_RT[33];
-    Kc[8] = g_RT[2] + g_RT[32] - g_RT[34];
-    Kc[9] = g_RT[15] + g_RT[23] - g_RT[34];
-    Kc[10] = g_RT[2] + g_RT[34] - g_RT[35];
-    Kc[11] = g_RT[15] + g_RT[24] - g_RT[35];
-    Kc[12] = -g_RT[15] - g_RT[20] + g_RT[36];
-    Kc[13] = g_RT[2] + g_RT[35] - g_RT[37];
-    Kc[14] = -g_RT[15] - g_RT[18] + g_RT[38];
-    Kc[15] = g_RT[2] + g_RT[35] - g_RT[38];
-    Kc[16] = g_RT[2] - g_RT[4] + g_RT[5];
-    Kc[17] = 2*g_RT[2] - g_RT[6];
-    Kc[18] = g_RT[2] + g_RT[4] - g_RT[7];
-    Kc[19] = -g_RT[3] + 2*g_RT[5];
-    Kc[20] = g_RT[4] + g_RT[5] - g_RT[8];
-    Kc[21] = -g_RT[2] - g_RT[10] + g_RT[12];
-    Kc[22] = -g_RT[2] - g_RT[12] + g_RT[13];
-    Kc[23] = -g_RT[16] + g_RT[17];
-    Kc[24] = -g_RT[2] - g_RT[13] + g_RT[19];
-    Kc[25] = -g_RT[2] + g_RT[18] - g_RT[24];
-    Kc[26] = -g_RT[6] + g_RT[18] - g_RT[23];
-    Kc[27] = -g_RT[2] - g_RT[13] + g_RT[30];
-    Kc[28] = g_RT[19] - g_RT[30];
-    Kc[29] = g_RT[2] + g_RT[3] - g_RT[4] - g_RT[5];
-    Kc[30] = -g_RT[2] - g_RT[4] + g_RT[5] + g_RT[6];
-    Kc[31] = -g_RT[2] + g_RT[4] + g_RT[6] - g_RT[7];
-    Kc[32] = -2*g_RT[4] + g_RT[5] + g_RT[7];
-    Kc[33] = g_RT[3] - 2*g_RT[4] + g_RT[6];
-    Kc[34] = g_RT[2] - 2*g_RT[4] + g_RT[8];
-    Kc[35] = g_RT[2] - g_RT[3] - g_RT[6] + g_RT[8];
-    Kc[36] = g_RT[2] - g_RT[5] - g_RT[7] + g_RT[8];
-    Kc[37] = -g_RT[3] - g_RT[4] + g_RT[5] + g_RT[8];
-    Kc[38] = -g_RT[3] + g_RT[4] - g_RT[7] + g_RT[8];
-    Kc[39] = -g_RT[3] + 2*g_RT[8] - g_RT[9];
-    Kc[40] = g_RT[2] - g_RT[6] - g_RT[8] + g_RT[9];
-    Kc[41] = g_RT[2] - g_RT[4] - g_RT[7] + g_RT[9];
-    Kc[42] = g_RT[4] - g_RT[7] - g_RT[8] + g_RT[9];
-    Kc[43] = -g_RT[4] + g_RT[5] - g_RT[8] + g_RT[9];
-    Kc[44] = -g_RT[2] + g_RT[4] + g_RT[10] - g_RT[11];
-    Kc[45] = -g_RT[4] + g_RT[8] + g_RT[10] - g_RT[11];
-    Kc[46] = g_RT[2] - g_RT[6] - g_RT[10] + g_RT[12];
-    Kc[47] = -g_RT[4] + g_RT[5] - g_RT[10] + g_RT[12];
-    Kc[48] = -g_RT[2] + g_RT[5] - g_RT[11] + g_RT[12];
-    Kc[49] = g_RT[4] - g_RT[7] - g_RT[10] + g_RT[12];
-    Kc[50] = g_RT[3] - g_RT[8] - g_RT[10] + g_RT[12];
-    Kc[51] = g_RT[2] - g_RT[6] - g_RT[12] + g_RT[13];
-    Kc[52] = -g_RT[4] + g_RT[5] - g_RT[12] + g_RT[13];
-    Kc[53] = g_RT[4] - g_RT[7] - g_RT[12] + g_RT[13];
-    Kc[54] = g_RT[2] - g_RT[6] + g_RT[14] - g_RT[15];
-    Kc[55] = g_RT[4] - g_RT[7] + g_RT[14] - g_RT[15];
-    Kc[56] = -g_RT[4] + g_RT[5] + g_RT[14] - g_RT[15];
-    Kc[57] = g_RT[3] - g_RT[8] + g_RT[14] - g_RT[15];
-    Kc[58] = g_RT[8] - g_RT[9] + g_RT[14] - g_RT[15];
-    Kc[59] = g_RT[2] - g_RT[6] + g_RT[15] - g_RT[16];
-    Kc[60] = g_RT[2] - g_RT[6] + g_RT[15] - g_RT[17];
-    Kc[61] = g_RT[4] - g_RT[7] + g_RT[15] - g_RT[17];
-    Kc[62] = -g_RT[2] + g_RT[5] - g_RT[13] + g_RT[15];
-    Kc[63] = -g_RT[2] + g_RT[15] + g_RT[16] - g_RT[18];
-    Kc[64] = -g_RT[4] + g_RT[8] + g_RT[15] - g_RT[19];
-    Kc[65] = g_RT[3] - g_RT[4] - g_RT[13] + g_RT[15];
-    Kc[66] = g_RT[3] - g_RT[5] + g_RT[15] - g_RT[19];
-    Kc[67] = -g_RT[6] + 2*g_RT[15] - g_RT[18];
-    Kc[68] = -g_RT[2] + 2*g_RT[15] - g_RT[20];
-    Kc[69] = -g_RT[2] + g_RT[4] - g_RT[13] + g_RT[17];
-    Kc[70] = -g_RT[2] + g_RT[3] - g_RT[4] - g_RT[10] + g_RT[17];
-    Kc[71] = -g_RT[10] + g_RT[11] - g_RT[13] + g_RT[17];
-    Kc[72] = g_RT[2] - g_RT[6] + g_RT[16] - g_RT[22];
-    Kc[73] = -g_RT[2] + g_RT[4] - g_RT[13] + g_RT[16];
-    Kc[74] = g_RT[4] - g_RT[7] + g_RT[16] - g_RT[22];
-    Kc[75] = -2*g_RT[2] + g_RT[5] - g_RT[10] + g_RT[16];
-    Kc[76] = g_RT[5] - g_RT[6] - g_RT[10] + g_RT[16];
-    Kc[77] = g_RT[3] - g_RT[6] - g_RT[11] + g_RT[16];
-    Kc[78] = -g_RT[2] + g_RT[3] - g_RT[4] - g_RT[10] + g_RT[16];
-    Kc[79] = -2*g_RT[2] + 2*g_RT[16] - g_RT[23];
-    Kc[80] = -g_RT[2] + g_RT[5] - g_RT[10] + g_RT[22];
-    Kc[81] = g_RT[3] - g_RT[5] - g_RT[12] + g_RT[22];
-    Kc[82] = -g_RT[2] + g_RT[7] - g_RT[13] + g_RT[22];
-    Kc[83] = -g_RT[10] + g_RT[11] - g_RT[12] + g_RT[22];
-    Kc[84] = g_RT[2] - g_RT[6] - g_RT[13] + g_RT[19];
-    Kc[85] = g_RT[2] - g_RT[7] - g_RT[17] + g_RT[19];
-    Kc[86] = g_RT[4] - g_RT[7] - g_RT[13] + g_RT[19];
-    Kc[87] = -g_RT[4] + g_RT[5] - g_RT[13] + g_RT[19];
-    Kc[88] = g_RT[3] - g_RT[8] - g_RT[13] + g_RT[19];
-    Kc[89] = g_RT[2] - g_RT[6] - g_RT[20] + g_RT[21];
-    Kc[90] = -g_RT[4] + g_RT[5] - g_RT[20] + g_RT[21];
-    Kc[91] = g_RT[4] - g_RT[7] - g_RT[20] + g_RT[21];
-    Kc[92] = -g_RT[14] + g_RT[15] - g_RT[20] + g_RT[21];
-    Kc[93] = g_RT[2] - g_RT[6] - g_RT[18] + g_RT[20];
-    Kc[94] = -g_RT[4] + g_RT[5] - g_RT[18] + g_RT[20];
-    Kc[95] = g_RT[5] - g_RT[13] - g_RT[15] + g_RT[20];
-    Kc[96] = g_RT[3] - g_RT[8] - g_RT[18] + g_RT[20];
-    Kc[97] = g_RT[2] - g_RT[6] + g_RT[18] - g_RT[24];
-    Kc[98] = g_RT[4] - g_RT[7] + g_RT[18] - g_RT[24];
-    Kc[99] = g_RT[5] - g_RT[12] - g_RT[15] + g_RT[18];
-    Kc[100] = -g_RT[2] + g_RT[5] + g_RT[18] - g_RT[25];
-    Kc[101] = 2*g_RT[18] - g_RT[20] - g_RT[24];
-    Kc[102] = g_RT[3] - g_RT[8] + g_RT[18] - g_RT[24];
-    Kc[103] = -g_RT[4] + g_RT[8] + g_RT[18] - g_RT[26];
-    Kc[104] = g_RT[8] - g_RT[9] - g_RT[10] - g_RT[15] + g_RT[26];
-    Kc[105] = g_RT[2] - g_RT[6] - g_RT[23] + g_RT[24];
-    Kc[106] = g_RT[3] - g_RT[12] - g_RT[13] + g_RT[24];
-    Kc[107] = g_RT[3] - g_RT[5] + g_RT[24] - g_RT[25];
-    Kc[108] = g_RT[3] - g_RT[8] - g_RT[23] + g_RT[24];
-    Kc[109] = -g_RT[2] + g_RT[25] - g_RT[27];
-    Kc[110] = -g_RT[2] + g_RT[5] + g_RT[23] - g_RT[28];
-    Kc[111] = g_RT[5] - g_RT[10] - g_RT[16] + g_RT[23];
-    Kc[112] = g_RT[3] - g_RT[10] - g_RT[13] + g_RT[23];
-    Kc[113] = -g_RT[2] + g_RT[4] + g_RT[23] - g_RT[27];
-    Kc[114] = g_RT[4] - g_RT[7] + g_RT[23] - g_RT[29];
-    Kc[115] = g_RT[2] - g_RT[10] - g_RT[15] + g_RT[27];
-    Kc[116] = g_RT[5] - g_RT[11] - g_RT[16] + g_RT[27];
-    Kc[117] = -g_RT[4] + g_RT[5] + g_RT[27] - g_RT[28];
-    Kc[118] = -g_RT[10] + g_RT[15] - g_RT[20] + g_RT[27];
-    Kc[119] = g_RT[2] - g_RT[10] - g_RT[17] + g_RT[28];
-    Kc[120] = -g_RT[2] + g_RT[4] - g_RT[10] - g_RT[12] + g_RT[28];
-    Kc[121] = -g_RT[2] + g_RT[5] - 2*g_RT[10] + g_RT[28];
-    Kc[122] = g_RT[3] - g_RT[4] - 2*g_RT[10] + g_RT[28];
-    Kc[123] = -g_RT[2] + g_RT[3] - g_RT[10] - g_RT[11] + g_RT[28];
-    Kc[124] = -g_RT[2] + g_RT[4] - g_RT[28] + g_RT[29];
-    Kc[125] = g_RT[5] - g_RT[10] - g_RT[22] + g_RT[29];
-    Kc[126] = g_RT[3] - g_RT[5] - g_RT[28] + g_RT[29];
-    Kc[127] = g_RT[3] - g_RT[11] - g_RT[22] + g_RT[29];
-    Kc[128] = g_RT[3] - g_RT[10] - g_RT[12] + g_RT[29];
-    Kc[129] = g_RT[2] - g_RT[6] - g_RT[13] + g_RT[30];
-    Kc[130] = g_RT[2] - g_RT[4] - g_RT[15] + g_RT[30];
-    Kc[131] = g_RT[4] - g_RT[7] - g_RT[13] + g_RT[30];
-    Kc[132] = g_RT[3] - g_RT[8] - g_RT[13] + g_RT[30];
-    Kc[133] = g_RT[4] - g_RT[10] + g_RT[27] - g_RT[30];
-    Kc[134] = g_RT[4] - g_RT[7] - g_RT[30] + g_RT[31];
-    Kc[135] = g_RT[4] - g_RT[7] - g_RT[19] + g_RT[31];
-    Kc[136] = g_RT[2] - g_RT[6] - g_RT[30] + g_RT[31];
-    Kc[137] = g_RT[2] - g_RT[6] - g_RT[19] + g_RT[31];
-    Kc[138] = -g_RT[4] + g_RT[5] - g_RT[30] + g_RT[31];
-    Kc[139] = g_RT[8] - g_RT[9] - g_RT[30] + g_RT[31];
-    Kc[140] = g_RT[3] - g_RT[8] - g_RT[30] + g_RT[31];
-    Kc[141] = g_RT[5] - g_RT[10] - g_RT[18] + g_RT[32];
-    Kc[142] = -g_RT[2] + g_RT[15] + g_RT[23] - g_RT[32];
-    Kc[143] = g_RT[5] - g_RT[15] - g_RT[28] + g_RT[32];
-    Kc[144] = -g_RT[3] + g_RT[8] - g_RT[32] + g_RT[33];
-    Kc[145] = g_RT[4] - g_RT[7] + g_RT[32] - g_RT[33];
-    Kc[146] = g_RT[3] - g_RT[12] - g_RT[27] + g_RT[33];
-    Kc[147] = g_RT[2] - g_RT[6] - g_RT[32] + g_RT[34];
-    Kc[148] = g_RT[3] - g_RT[8] - g_RT[32] + g_RT[34];
-    Kc[149] = -g_RT[14] + g_RT[15] - g_RT[32] + g_RT[34];
-    Kc[150] = g_RT[4] - g_RT[7] - g_RT[32] + g_RT[34];
-    Kc[151] = -g_RT[10] + g_RT[12] - g_RT[32] + g_RT[33];
-    Kc[152] = -g_RT[4] + g_RT[8] - g_RT[10] - g_RT[24] + g_RT[33];
-    Kc[153] = g_RT[3] - g_RT[10] - g_RT[12] - g_RT[15] + g_RT[32];
-    Kc[154] = g_RT[5] - g_RT[12] - g_RT[20] + g_RT[35];
-    Kc[155] = g_RT[4] - g_RT[7] - g_RT[34] + g_RT[35];
-    Kc[156] = -g_RT[2] + g_RT[5] - g_RT[15] - g_RT[27] + g_RT[35];
-    Kc[157] = g_RT[2] - g_RT[6] - g_RT[34] + g_RT[35];
-    Kc[158] = -g_RT[3] + g_RT[8] + g_RT[34] - g_RT[35];
-    Kc[159] = -g_RT[4] + g_RT[8] - g_RT[13] - g_RT[24] + g_RT[34];
-    Kc[160] = g_RT[2] - g_RT[15] - g_RT[18] + g_RT[35];
-    Kc[161] = -g_RT[2] + g_RT[15] + g_RT[24] - g_RT[34];
-    Kc[162] = g_RT[3] - g_RT[8] + g_RT[36] - g_RT[37];
-    Kc[163] = g_RT[3] - g_RT[8] + g_RT[36] - g_RT[38];
-    Kc[164] = g_RT[2] - g_RT[6] + g_RT[36] - g_RT[37];
-    Kc[165] = g_RT[2] - g_RT[6] + g_RT[36] - g_RT[38];
-    Kc[166] = -g_RT[4] + g_RT[5] + g_RT[36] - g_RT[37];
-    Kc[167] = -g_RT[4] + g_RT[5] + g_RT[36] - g_RT[38];
-    Kc[168] = g_RT[4] - g_RT[7] + g_RT[36] - g_RT[38];
-    Kc[169] = g_RT[4] - g_RT[7] + g_RT[36] - g_RT[37];
-    Kc[170] = g_RT[8] - g_RT[9] + g_RT[36] - g_RT[37];
-    Kc[171] = g_RT[8] - g_RT[9] + g_RT[36] - g_RT[38];
-    Kc[172] = g_RT[36] - g_RT[36] + g_RT[37] - g_RT[38];
-    Kc[173] = g_RT[3] - g_RT[8] - g_RT[35] + g_RT[37];
-    Kc[174] = g_RT[3] - g_RT[8] - g_RT[35] + g_RT[38];
-
-#ifdef __INTEL_COMPILER
-     #pragma simd
-#endif
-    for (int i=0; i<175; ++i) {
-        Kc[i] = exp(Kc[i]);
-    };
-
     /*reference concentration: P_atm / (RT) in inverse mol/m^3 */
     double refC = 101325 / 8.31451 * invT;
     double refCinv = 1 / refC;
 
-    Kc[0] *= refCinv;
-    Kc[1] *= refCinv;
-    Kc[2] *= refCinv;
-    Kc[3] *= refCinv;
-    Kc[4] *= refC;
-    Kc[5] *= refC;
-    Kc[6] *= refC;
-    Kc[7] *= refCinv;
-    Kc[8] *= refCinv;
-    Kc[9] *= refCinv;
-    Kc[10] *= refCinv;
-    Kc[11] *= refCinv;
-    Kc[12] *= refC;
-    Kc[13] *= refCinv;
-    Kc[14] *= refC;
-    Kc[15] *= refCinv;
-    Kc[16] *= refCinv;
-    Kc[17] *= refCinv;
-    Kc[18] *= refCinv;
-    Kc[19] *= refCinv;
-    Kc[20] *= refCinv;
-    Kc[21] *= refC;
-    Kc[22] *= refC;
-    Kc[24] *= refC;
-    Kc[25] *= refC;
-    Kc[26] *= refC;
-    Kc[27] *= refC;
-    Kc[70] *= refC;
-    Kc[75] *= refC;
-    Kc[78] *= refC;
-    Kc[79] *= refC;
-    Kc[104] *= refC;
-    Kc[109] *= refC;
-    Kc[120] *= refC;
-    Kc[121] *= refC;
-    Kc[122] *= refC;
-    Kc[123] *= refC;
-    Kc[152] *= refC;
-    Kc[153] *= refC;
-    Kc[156] *= refC;
-    Kc[159] *= refC;
+    /*Kc as the ratio of the products of the species exp(g_RT)/refC, unless */
+    /*the product over a side of a reaction leaves the normal range */
+    double e_g[39], den[175];
+    for (int k=0; k<39; ++k) {
+        e_g[k] = exp(g_RT[k]) * refCinv;
+    }
+    Kc[0] = e_g[2]*e_g[3]; den[0] = e_g[8];
+    Kc[1] = e_g[4]*e_g[4]; den[1] = e_g[9];
+    Kc[2] = e_g[2]*e_g[15]; den[2] = e_g[14];
+    Kc[3] = e_g[15]*e_g[15]; den[3] = e_g[21];
+    Kc[4] = e_g[21]; den[4] = e_g[2]*e_g[20];
+    Kc[5] = e_g[20]; den[5] = e_g[2]*e_g[18];
+    Kc[6] = e_g[24]; den[6] = e_g[2]*e_g[23];
+    Kc[7] = e_g[2]*e_g[33]; den[7] = e_g[32];
+    Kc[8] = e_g[2]*e_g[32]; den[8] = e_g[34];
+    Kc[9] = e_g[15]*e_g[23]; den[9] = e_g[34];
+    Kc[10] = e_g[2]*e_g[34]; den[10] = e_g[35];
+    Kc[11] = e_g[15]*e_g[24]; den[11] = e_g[35];
+    Kc[12] = e_g[36]; den[12] = e_g[15]*e_g[20];
+    Kc[13] = e_g[2]*e_g[35]; den[13] = e_g[37];
+    Kc[14] = e_g[38]; den[14] = e_g[15]*e_g[18];
+    Kc[15] = e_g[2]*e_g[35]; den[15] = e_g[38];
+    Kc[16] = e_g[2]*e_g[5]; den[16] = e_g[4];
+    Kc[17] = e_g[2]*e_g[2]; den[17] = e_g[6];
+    Kc[18] = e_g[2]*e_g[4]; den[18] = e_g[7];
+    Kc[19] = e_g[5]*e_g[5]; den[19] = e_g[3];
+    Kc[20] = e_g[4]*e_g[5]; den[20] = e_g[8];
+    Kc[21] = e_g[12]; den[21] = e_g[2]*e_g[10];
+    Kc[22] = e_g[13]; den[22] = e_g[2]*e_g[12];
+    Kc[23] = e_g[17]; den[23] = e_g[16];
+    Kc[24] = e_g[19]; den[24] = e_g[2]*e_g[13];
+    Kc[25] = e_g[18]; den[25] = e_g[2]*e_g[24];
+    Kc[26] = e_g[18]; den[26] = e_g[6]*e_g[23];
+    Kc[27] = e_g[30]; den[27] = e_g[2]*e_g[13];
+    Kc[28] = e_g[19]; den[28] = e_g[30];
+    Kc[29] = e_g[2]*e_g[3]; den[29] = e_g[4]*e_g[5];
+    Kc[30] = e_g[5]*e_g[6]; den[30] = e_g[2]*e_g[4];
+    Kc[31] = e_g[4]*e_g[6]; den[31] = e_g[2]*e_g[7];
+    Kc[32] = e_g[5]*e_g[7]; den[32] = e_g[4]*e_g[4];
+    Kc[33] = e_g[3]*e_g[6]; den[33] = e_g[4]*e_g[4];
+    Kc[34] = e_g[2]*e_g[8]; den[34] = e_g[4]*e_g[4];
+    Kc[35] = e_g[2]*e_g[8]; den[35] = e_g[3]*e_g[6];
+    Kc[36] = e_g[2]*e_g[8]; den[36] = e_g[5]*e_g[7];
+    Kc[37] = e_g[5]*e_g[8]; den[37] = e_g[3]*e_g[4];
+    Kc[38] = e_g[4]*e_g[8]; den[38] = e_g[3]*e_g[7];
+    Kc[39] = e_g[8]*e_g[8]; den[39] = e_g[3]*e_g[9];
+    Kc[40] = e_g[2]*e_g[9]; den[40] = e_g[6]*e_g[8];
+    Kc[41] = e_g[2]*e_g[9]; den[41] = e_g[4]*e_g[7];
+    Kc[42] = e_g[4]*e_g[9]; den[42] = e_g[7]*e_g[8];
+    Kc[43] = e_g[5]*e_g[9]; den[43] = e_g[4]*e_g[8];
+    Kc[44] = e_g[4]*e_g[10]; den[44] = e_g[2]*e_g[11];
+    Kc[45] = e_g[8]*e_g[10]; den[45] = e_g[4]*e_g[11];
+    Kc[46] = e_g[2]*e_g[12]; den[46] = e_g[6]*e_g[10];
+    Kc[47] = e_g[5]*e_g[12]; den[47] = e_g[4]*e_g[10];
+    Kc[48] = e_g[5]*e_g[12]; den[48] = e_g[2]*e_g[11];
+    Kc[49] = e_g[4]*e_g[12]; den[49] = e_g[7]*e_g[10];
+    Kc[50] = e_g[3]*e_g[12]; den[50] = e_g[8]*e_g[10];
+    Kc[51] = e_g[2]*e_g[13]; den[51] = e_g[6]*e_g[12];
+    Kc[52] = e_g[5]*e_g[13]; den[52] = e_g[4]*e_g[12];
+    Kc[53] = e_g[4]*e_g[13]; den[53] = e_g[7]*e_g[12];
+    Kc[54] = e_g[2]*e_g[14]; den[54] = e_g[6]*e_g[15];
+    Kc[55] = e_g[4]*e_g[14]; den[55] = e_g[7]*e_g[15];
+    Kc[56] = e_g[5]*e_g[14]; den[56] = e_g[4]*e_g[15];
+    Kc[57] = e_g[3]*e_g[14]; den[57] = e_g[8]*e_g[15];
+    Kc[58] = e_g[8]*e_g[14]; den[58] = e_g[9]*e_g[15];
+    Kc[59] = e_g[2]*e_g[15]; den[59] = e_g[6]*e_g[16];
+    Kc[60] = e_g[2]*e_g[15]; den[60] = e_g[6]*e_g[17];
+    Kc[61] = e_g[4]*e_g[15]; den[61] = e_g[7]*e_g[17];
+    Kc[62] = e_g[5]*e_g[15]; den[62] = e_g[2]*e_g[13];
+    Kc[63] = e_g[15]*e_g[16]; den[63] = e_g[2]*e_g[18];
+    Kc[64] = e_g[8]*e_g[15]; den[64] = e_g[4]*e_g[19];
+    Kc[65] = e_g[3]*e_g[15]; den[65] = e_g[4]*e_g[13];
+    Kc[66] = e_g[3]*e_g[15]; den[66] = e_g[5]*e_g[19];
+    Kc[67] = e_g[15]*e_g[15]; den[67] = e_g[6]*e_g[18];
+    Kc[68] = e_g[15]*e_g[15]; den[68] = e_g[2]*e_g[20];
+    Kc[69] = e_g[4]*e_g[17]; den[69] = e_g[2]*e_g[13];
+    Kc[70] = e_g[3]*e_g[17]; den[70] = e_g[2]*e_g[4]*e_g[10];
+    Kc[71] = e_g[11]*e_g[17]; den[71] = e_g[10]*e_g[13];
+    Kc[72] = e_g[2]*e_g[16]; den[72] = e_g[6]*e_g[22];
+    Kc[73] = e_g[4]*e_g[16]; den[73] = e_g[2]*e_g[13];
+    Kc[74] = e_g[4]*e_g[16]; den[74] = e_g[7]*e_g[22];
+    Kc[75] = e_g[5]*e_g[16]; den[75] = e_g[2]*e_g[2]*e_g[10];
+    Kc[76] = e_g[5]*e_g[16]; den[76] = e_g[6]*e_g[10];
+    Kc[77] = e_g[3]*e_g[16]; den[77] = e_g[6]*e_g[11];
+    Kc[78] = e_g[3]*e_g[16]; den[78] = e_g[2]*e_g[4]*e_g[10];
+    Kc[79] = e_g[16]*e_g[16]; den[79] = e_g[2]*e_g[2]*e_g[23];
+    Kc[80] = e_g[5]*e_g[22]; den[80] = e_g[2]*e_g[10];
+    Kc[81] = e_g[3]*e_g[22]; den[81] = e_g[5]*e_g[12];
+    Kc[82] = e_g[7]*e_g[22]; den[82] = e_g[2]*e_g[13];
+    Kc[83] = e_g[11]*e_g[22]; den[83] = e_g[10]*e_g[12];
+    Kc[84] = e_g[2]*e_g[19]; den[84] = e_g[6]*e_g[13];
+    Kc[85] = e_g[2]*e_g[19]; den[85] = e_g[7]*e_g[17];
+    Kc[86] = e_g[4]*e_g[19]; den[86] = e_g[7]*e_g[13];
+    Kc[87] = e_g[5]*e_g[19]; den[87] = e_g[4]*e_g[13];
+    Kc[88] = e_g[3]*e_g[19]; den[88] = e_g[8]*e_g[13];
+    Kc[89] = e_g[2]*e_g[21]; den[89] = e_g[6]*e_g[20];
+    Kc[90] = e_g[5]*e_g[21]; den[90] = e_g[4]*e_g[20];
+    Kc[91] = e_g[4]*e_g[21]; den[91] = e_g[7]*e_g[20];
+    Kc[92] = e_g[15]*e_g[21]; den[92] = e_g[14]*e_g[20];
+    Kc[93] = e_g[2]*e_g[20]; den[93] = e_g[6]*e_g[18];
+    Kc[94] = e_g[5]*e_g[20]; den[94] = e_g[4]*e_g[18];
+    Kc[95] = e_g[5]*e_g[20]; den[95] = e_g[13]*e_g[15];
+    Kc[96] = e_g[3]*e_g[20]; den[96] = e_g[8]*e_g[18];
+    Kc[97] = e_g[2]*e_g[18]; den[97] = e_g[6]*e_g[24];
+    Kc[98] = e_g[4]*e_g[18]; den[98] = e_g[7]*e_g[24];
+    Kc[99] = e_g[5]*e_g[18]; den[99] = e_g[12]*e_g[15];
+    Kc[100] = e_g[5]*e_g[18]; den[100] = e_g[2]*e_g[25];
+    Kc[101] = e_g[18]*e_g[18]; den[101] = e_g[20]*e_g[24];
+    Kc[102] = e_g[3]*e_g[18]; den[102] = e_g[8]*e_g[24];
+    Kc[103] = e_g[8]*e_g[18]; den[103] = e_g[4]*e_g[26];
+    Kc[104] = e_g[8]*e_g[26]; den[104] = e_g[9]*e_g[10]*e_g[15];
+    Kc[105] = e_g[2]*e_g[24]; den[105] = e_g[6]*e_g[23];
+    Kc[106] = e_g[3]*e_g[24]; den[106] = e_g[12]*e_g[13];
+    Kc[107] = e_g[3]*e_g[24]; den[107] = e_g[5]*e_g[25];
+    Kc[108] = e_g[3]*e_g[24]; den[108] = e_g[8]*e_g[23];
+    Kc[109] = e_g[25]; den[109] = e_g[2]*e_g[27];
+    Kc[110] = e_g[5]*e_g[23]; den[110] = e_g[2]*e_g[28];
+    Kc[111] = e_g[5]*e_g[23]; den[111] = e_g[10]*e_g[16];
+    Kc[112] = e_g[3]*e_g[23]; den[112] = e_g[10]*e_g[13];
+    Kc[113] = e_g[4]*e_g[23]; den[113] = e_g[2]*e_g[27];
+    Kc[114] = e_g[4]*e_g[23]; den[114] = e_g[7]*e_g[29];
+    Kc[115] = e_g[2]*e_g[27]; den[115] = e_g[10]*e_g[15];
+    Kc[116] = e_g[5]*e_g[27]; den[116] = e_g[11]*e_g[16];
+    Kc[117] = e_g[5]*e_g[27]; den[117] = e_g[4]*e_g[28];
+    Kc[118] = e_g[15]*e_g[27]; den[118] = e_g[10]*e_g[20];
+    Kc[119] = e_g[2]*e_g[28]; den[119] = e_g[10]*e_g[17];
+    Kc[120] = e_g[4]*e_g[28]; den[120] = e_g[2]*e_g[10]*e_g[12];
+    Kc[121] = e_g[5]*e_g[28]; den[121] = e_g[2]*e_g[10]*e_g[10];
+    Kc[122] = e_g[3]*e_g[28]; den[122] = e_g[4]*e_g[10]*e_g[10];
+    Kc[123] = e_g[3]*e_g[28]; den[123] = e_g[2]*e_g[10]*e_g[11];
+    Kc[124] = e_g[4]*e_g[29]; den[124] = e_g[2]*e_g[28];
+    Kc[125] = e_g[5]*e_g[29]; den[125] = e_g[10]*e_g[22];
+    Kc[126] = e_g[3]*e_g[29]; den[126] = e_g[5]*e_g[28];
+    Kc[127] = e_g[3]*e_g[29]; den[127] = e_g[11]*e_g[22];
+    Kc[128] = e_g[3]*e_g[29]; den[128] = e_g[10]*e_g[12];
+    Kc[129] = e_g[2]*e_g[30]; den[129] = e_g[6]*e_g[13];
+    Kc[130] = e_g[2]*e_g[30]; den[130] = e_g[4]*e_g[15];
+    Kc[131] = e_g[4]*e_g[30]; den[131] = e_g[7]*e_g[13];
+    Kc[132] = e_g[3]*e_g[30]; den[132] = e_g[8]*e_g[13];
+    Kc[133] = e_g[4]*e_g[27]; den[133] = e_g[10]*e_g[30];
+    Kc[134] = e_g[4]*e_g[31]; den[134] = e_g[7]*e_g[30];
+    Kc[135] = e_g[4]*e_g[31]; den[135] = e_g[7]*e_g[19];
+    Kc[136] = e_g[2]*e_g[31]; den[136] = e_g[6]*e_g[30];
+    Kc[137] = e_g[2]*e_g[31]; den[137] = e_g[6]*e_g[19];
+    Kc[138] = e_g[5]*e_g[31]; den[138] = e_g[4]*e_g[30];
+    Kc[139] = e_g[8]*e_g[31]; den[139] = e_g[9]*e_g[30];
+    Kc[140] = e_g[3]*e_g[31]; den[140] = e_g[8]*e_g[30];
+    Kc[141] = e_g[5]*e_g[32]; den[141] = e_g[10]*e_g[18];
+    Kc[142] = e_g[15]*e_g[23]; den[142] = e_g[2]*e_g[32];
+    Kc[143] = e_g[5]*e_g[32]; den[143] = e_g[15]*e_g[28];
+    Kc[144] = e_g[8]*e_g[33]; den[144] = e_g[3]*e_g[32];
+    Kc[145] = e_g[4]*e_g[32]; den[145] = e_g[7]*e_g[33];
+    Kc[146] = e_g[3]*e_g[33]; den[146] = e_g[12]*e_g[27];
+    Kc[147] = e_g[2]*e_g[34]; den[147] = e_g[6]*e_g[32];
+    Kc[148] = e_g[3]*e_g[34]; den[148] = e_g[8]*e_g[32];
+    Kc[149] = e_g[15]*e_g[34]; den[149] = e_g[14]*e_g[32];
+    Kc[150] = e_g[4]*e_g[34]; den[150] = e_g[7]*e_g[32];
+    Kc[151] = e_g[12]*e_g[33]; den[151] = e_g[10]*e_g[32];
+    Kc[152] = e_g[8]*e_g[33]; den[152] = e_g[4]*e_g[10]*e_g[24];
+    Kc[153] = e_g[3]*e_g[32]; den[153] = e_g[10]*e_g[12]*e_g[15];
+    Kc[154] = e_g[5]*e_g[35]; den[154] = e_g[12]*e_g[20];
+    Kc[155] = e_g[4]*e_g[35]; den[155] = e_g[7]*e_g[34];
+    Kc[156] = e_g[5]*e_g[35]; den[156] = e_g[2]*e_g[15]*e_g[27];
+    Kc[157] = e_g[2]*e_g[35]; den[157] = e_g[6]*e_g[34];
+    Kc[158] = e_g[8]*e_g[34]; den[158] = e_g[3]*e_g[35];
+    Kc[159] = e_g[8]*e_g[34]; den[159] = e_g[4]*e_g[13]*e_g[24];
+    Kc[160] = e_g[2]*e_g[35]; den[160] = e_g[15]*e_g[18];
+    Kc[161] = e_g[15]*e_g[24]; den[161] = e_g[2]*e_g[34];
+    Kc[162] = e_g[3]*e_g[36]; den[162] = e_g[8]*e_g[37];
+    Kc[163] = e_g[3]*e_g[36]; den[163] = e_g[8]*e_g[38];
+    Kc[164] = e_g[2]*e_g[36]; den[164] = e_g[6]*e_g[37];
+    Kc[165] = e_g[2]*e_g[36]; den[165] = e_g[6]*e_g[38];
+    Kc[166] = e_g[5]*e_g[36]; den[166] = e_g[4]*e_g[37];
+    Kc[167] = e_g[5]*e_g[36]; den[167] = e_g[4]*e_g[38];
+    Kc[168] = e_g[4]*e_g[36]; den[168] = e_g[7]*e_g[38];
+    Kc[169] = e_g[4]*e_g[36]; den[169] = e_g[7]*e_g[37];
+    Kc[170] = e_g[8]*e_g[36]; den[170] = e_g[9]*e_g[37];
+    Kc[171] = e_g[8]*e_g[36]; den[171] = e_g[9]*e_g[38];
+    Kc[172] = e_g[36]*e_g[37]; den[172] = e_g[36]*e_g[38];
+    Kc[173] = e_g[3]*e_g[37]; den[173] = e_g[8]*e_g[35];
+    Kc[174] = e_g[3]*e_g[38]; den[174] = e_g[8]*e_g[35];
+    int inrange = 1;
+    for (int i=0; i<175; ++i) {
+        inrange &= Kc[i] >= DBL_MIN && Kc[i] <= DBL_MAX && den[i] >= DBL_MIN && den[i] <= DBL_MAX;
+    }
+
+    if (inrange) {
+        for (int i=0; i<175; ++i) {
+            Kc[i] /= den[i];
+        }
+    }
+    else {
+        Kc[0] = exp(g_RT[2] + g_RT[3] - g_RT[8]);
+        Kc[1] = exp(2*g_RT[4] - g_RT[9]);
+        Kc[2] = exp(g_RT[2] - g_RT[14] + g_RT[15]);
+        Kc[3] = exp(2*g_RT[15] - g_RT[21]);
+        Kc[4] = exp(-g_RT[2] - g_RT[20] + g_RT[21]);
+        Kc[5] = exp(-g_RT[2] - g_RT[18] + g_RT[20]);
+        Kc[6] = exp(-g_RT[2] - g_RT[23] + g_RT[24]);
+        Kc[7] = exp(g_RT[2] - g_RT[32] + g_RT[33]);
+        Kc[8] = exp(g_RT[2] + g_RT[32] - g_RT[34]);
+        Kc[9] = exp(g_RT[15] + g_RT[23] - g_RT[34]);
+        Kc[10] = exp(g_RT[2] + g_RT[34] - g_RT[35]);
+        Kc[11] = exp(g_RT[15] + g_RT[24] - g_RT[35]);
+        Kc[12] = exp(-g_RT[15] - g_RT[20] + g_RT[36]);
+        Kc[13] = exp(g_RT[2] + g_RT[35] - g_RT[37]);
+        Kc[14] = exp(-g_RT[15] - g_RT[18] + g_RT[38]);
+        Kc[15] = exp(g_RT[2] + g_RT[35] - g_RT[38]);
+        Kc[16] = exp(g_RT[2] - g_RT[4] + g_RT[5]);
+        Kc[17] = exp(2*g_RT[2] - g_RT[6]);
+        Kc[18] = exp(g_RT[2] + g_RT[4] - g_RT[7]);
+        Kc[19] = exp(-g_RT[3] + 2*g_RT[5]);
+        Kc[20] = exp(g_RT[4] + g_RT[5] - g_RT[8]);
+        Kc[21] = exp(-g_RT[2] - g_RT[10] + g_RT[12]);
+        Kc[22] = exp(-g_RT[2] - g_RT[12] + g_RT[13]);
+        Kc[23] = exp(-g_RT[16] + g_RT[17]);
+        Kc[24] = exp(-g_RT[2] - g_RT[13] + g_RT[19]);
+        Kc[25] = exp(-g_RT[2] + g_RT[18] - g_RT[24]);
+        Kc[26] = exp(-g_RT[6] + g_RT[18] - g_RT[23]);
+        Kc[27] = exp(-g_RT[2] - g_RT[13] + g_RT[30]);
+        Kc[28] = exp(g_RT[19] - g_RT[30]);
+        Kc[29] = exp(g_RT[2] + g_RT[3] - g_RT[4] - g_RT[5]);
+        Kc[30] = exp(-g_RT[2] - g_RT[4] + g_RT[5] + g_RT[6]);
+        Kc[31] = exp(-g_RT[2] + g_RT[4] + g_RT[6] - g_RT[7]);
+        Kc[32] = exp(-2*g_RT[4] + g_RT[5] + g_RT[7]);
+        Kc[33] = exp(g_RT[3] - 2*g_RT[4] + g_RT[6]);
+        Kc[34] = exp(g_RT[2] - 2*g_RT[4] + g_RT[8]);
+        Kc[35] = exp(g_RT[2] - g_RT[3] - g_RT[6] + g_RT[8]);
+        Kc[36] = exp(g_RT[2] - g_RT[5] - g_RT[7] + g_RT[8]);
+        Kc[37] = exp(-g_RT[3] - g_RT[4] + g_RT[5] + g_RT[8]);
+        Kc[38] = exp(-g_RT[3] + g_RT[4] - g_RT[7] + g_RT[8]);
+        Kc[39] = exp(-g_RT[3] + 2*g_RT[8] - g_RT[9]);
+        Kc[40] = exp(g_RT[2] - g_RT[6] - g_RT[8] + g_RT[9]);
+        Kc[41] = exp(g_RT[2] - g_RT[4] - g_RT[7] + g_RT[9]);
+        Kc[42] = exp(g_RT[4] - g_RT[7] - g_RT[8] + g_RT[9]);
+        Kc[43] = exp(-g_RT[4] + g_RT[5] - g_RT[8] + g_RT[9]);
+        Kc[44] = exp(-g_RT[2] + g_RT[4] + g_RT[10] - g_RT[11]);
+        Kc[45] = exp(-g_RT[4] + g_RT[8] + g_RT[10] - g_RT[11]);
+        Kc[46] = exp(g_RT[2] - g_RT[6] - g_RT[10] + g_RT[12]);
+        Kc[47] = exp(-g_RT[4] + g_RT[5] - g_RT[10] + g_RT[12]);
+        Kc[48] = exp(-g_RT[2] + g_RT[5] - g_RT[11] + g_RT[12]);
+        Kc[49] = exp(g_RT[4] - g_RT[7] - g_RT[10] + g_RT[12]);
+        Kc[50] = exp(g_RT[3] - g_RT[8] - g_RT[10] + g_RT[12]);
+        Kc[51] = exp(g_RT[2] - g_RT[6] - g_RT[12] + g_RT[13]);
+        Kc[52] = exp(-g_RT[4] + g_RT[5] - g_RT[12] + g_RT[13]);
+        Kc[53] = exp(g_RT[4] - g_RT[7] - g_RT[12] + g_RT[13]);
+        Kc[54] = exp(g_RT[2] - g_RT[6] + g_RT[14] - g_RT[15]);
+        Kc[55] = exp(g_RT[4] - g_RT[7] + g_RT[14] - g_RT[15]);
+        Kc[56] = exp(-g_RT[4] + g_RT[5] + g_RT[14] - g_RT[15]);
+        Kc[57] = exp(g_RT[3] - g_RT[8] + g_RT[14] - g_RT[15]);
+        Kc[58] = exp(g_RT[8] - g_RT[9] + g_RT[14] - g_RT[15]);
+        Kc[59] = exp(g_RT[2] - g_RT[6] + g_RT[15] - g_RT[16]);
+        Kc[60] = exp(g_RT[2] - g_RT[6] + g_RT[15] - g_RT[17]);
+        Kc[61] = exp(g_RT[4] - g_RT[7] + g_RT[15] - g_RT[17]);
+        Kc[62] = exp(-g_RT[2] + g_RT[5] - g_RT[13] + g_RT[15]);
+        Kc[63] = exp(-g_RT[2] + g_RT[15] + g_RT[16] - g_RT[18]);
+        Kc[64] = exp(-g_RT[4] + g_RT[8] + g_RT[15] - g_RT[19]);
+        Kc[65] = exp(g_RT[3] - g_RT[4] - g_RT[13] + g_RT[15]);
+        Kc[66] = exp(g_RT[3] - g_RT[5] + g_RT[15] - g_RT[19]);
+        Kc[67] = exp(-g_RT[6] + 2*g_RT[15] - g_RT[18]);
+        Kc[68] = exp(-g_RT[2] + 2*g_RT[15] - g_RT[20]);
+        Kc[69] = exp(-g_RT[2] + g_RT[4] - g_RT[13] + g_RT[17]);
+        Kc[70] = exp(-g_RT[2] + g_RT[3] - g_RT[4] - g_RT[10] + g_RT[17]);
+        Kc[71] = exp(-g_RT[10] + g_RT[11] - g_RT[13] + g_RT[17]);
+        Kc[72] = exp(g_RT[2] - g_RT[6] + g_RT[16] - g_RT[22]);
+        Kc[73] = exp(-g_RT[2] + g_RT[4] - g_RT[13] + g_RT[16]);
+        Kc[74] = exp(g_RT[4] - g_RT[7] + g_RT[16] - g_RT[22]);
+        Kc[75] = exp(-2*g_RT[2] + g_RT[5] - g_RT[10] + g_RT[16]);
+        Kc[76] = exp(g_RT[5] - g_RT[6] - g_RT[10] + g_RT[16]);
+        Kc[77] = exp(g_RT[3] - g_RT[6] - g_RT[11] + g_RT[16]);
+        Kc[78] = exp(-g_RT[2] + g_RT[3] - g_RT[4] - g_RT[10] + g_RT[16]);
+        Kc[79] = exp(-2*g_RT[2] + 2*g_RT[16] - g_RT[23]);
+        Kc[80] = exp(-g_RT[2] + g_RT[5] - g_RT[10] + g_RT[22]);
+        Kc[81] = exp(g_RT[3] - g_RT[5] - g_RT[12] + g_RT[22]);
+        Kc[82] = exp(-g_RT[2] + g_RT[7] - g_RT[13] + g_RT[22]);
+        Kc[83] = exp(-g_RT[10] + g_RT[11] - g_RT[12] + g_RT[22]);
+        Kc[84] = exp(g_RT[2] - g_RT[6] - g_RT[13] + g_RT[19]);
+        Kc[85] = exp(g_RT[2] - g_RT[7] - g_RT[17] + g_RT[19]);
+        Kc[86] = exp(g_RT[4] - g_RT[7] - g_RT[13] + g_RT[19]);
+        Kc[87] = exp(-g_RT[4] + g_RT[5] - g_RT[13] + g_RT[19]);
+        Kc[88] = exp(g_RT[3] - g_RT[8] - g_RT[13] + g_RT[19]);
+        Kc[89] = exp(g_RT[2] - g_RT[6] - g_RT[20] + g_RT[21]);
+        Kc[90] = exp(-g_RT[4] + g_RT[5] - g_RT[20] + g_RT[21]);
+        Kc[91] = exp(g_RT[4] - g_RT[7] - g_RT[20] + g_RT[21]);
+        Kc[92] = exp(-g_RT[14] + g_RT[15] - g_RT[20] + g_RT[21]);
+        Kc[93] = exp(g_RT[2] - g_RT[6] - g_RT[18] + g_RT[20]);
+        Kc[94] = exp(-g_RT[4] + g_RT[5] - g_RT[18] + g_RT[20]);
+        Kc[95] = exp(g_RT[5] - g_RT[13] - g_RT[15] + g_RT[20]);
+        Kc[96] = exp(g_RT[3] - g_RT[8] - g_RT[18] + g_RT[20]);
+        Kc[97] = exp(g_RT[2] - g_RT[6] + g_RT[18] - g_RT[24]);
+        Kc[98] = exp(g_RT[4] - g_RT[7] + g_RT[18] - g_RT[24]);
+        Kc[99] = exp(g_RT[5] - g_RT[12] - g_RT[15] + g_RT[18]);
+        Kc[100] = exp(-g_RT[2] + g_RT[5] + g_RT[18] - g_RT[25]);
+        Kc[101] = exp(2*g_RT[18] - g_RT[20] - g_RT[24]);
+        Kc[102] = exp(g_RT[3] - g_RT[8] + g_RT[18] - g_RT[24]);
+        Kc[103] = exp(-g_RT[4] + g_RT[8] + g_RT[18] - g_RT[26]);
+        Kc[104] = exp(g_RT[8] - g_RT[9] - g_RT[10] - g_RT[15] + g_RT[26]);
+        Kc[105] = exp(g_RT[2] - g_RT[6] - g_RT[23] + g_RT[24]);
+        Kc[106] = exp(g_RT[3] - g_RT[12] - g_RT[13] + g_RT[24]);
+        Kc[107] = exp(g_RT[3] - g_RT[5] + g_RT[24] - g_RT[25]);
+        Kc[108] = exp(g_RT[3] - g_RT[8] - g_RT[23] + g_RT[24]);
+        Kc[109] = exp(-g_RT[2] + g_RT[25] - g_RT[27]);
+        Kc[110] = exp(-g_RT[2] + g_RT[5] + g_RT[23] - g_RT[28]);
+        Kc[111] = exp(g_RT[5] - g_RT[10] - g_RT[16] + g_RT[23]);
+        Kc[112] = exp(g_RT[3] - g_RT[10] - g_RT[13] + g_RT[23]);
+        Kc[113] = exp(-g_RT[2] + g_RT[4] + g_RT[23] - g_RT[27]);
+        Kc[114] = exp(g_RT[4] - g_RT[7] + g_RT[23] - g_RT[29]);
+        Kc[115] = exp(g_RT[2] - g_RT[10] - g_RT[15] + g_RT[27]);
+        Kc[116] = exp(g_RT[5] - g_RT[11] - g_RT[16] + g_RT[27]);
+        Kc[117] = exp(-g_RT[4] + g_RT[5] + g_RT[27] - g_RT[28]);
+        Kc[118] = exp(-g_RT[10] + g_RT[15] - g_RT[20] + g_RT[27]);
+        Kc[119] = exp(g_RT[2] - g_RT[10] - g_RT[17] + g_RT[28]);
+        Kc[120] = exp(-g_RT[2] + g_RT[4] - g_RT[10] - g_RT[12] + g_RT[28]);
+        Kc[121] = exp(-g_RT[2] + g_RT[5] - 2*g_RT[10] + g_RT[28]);
+        Kc[122] = exp(g_RT[3] - g_RT[4] - 2*g_RT[10] + g_RT[28]);
+        Kc[123] = exp(-g_RT[2] + g_RT[3] - g_RT[10] - g_RT[11] + g_RT[28]);
+        Kc[124] = exp(-g_RT[2] + g_RT[4] - g_RT[28] + g_RT[29]);
+        Kc[125] = exp(g_RT[5] - g_RT[10] - g_RT[22] + g_RT[29]);
+        Kc[126] = exp(g_RT[3] - g_RT[5] - g_RT[28] + g_RT[29]);
+        Kc[127] = exp(g_RT[3] - g_RT[11] - g_RT[22] + g_RT[29]);
+        Kc[128] = exp(g_RT[3] - g_RT[10] - g_RT[12] + g_RT[29]);
+        Kc[129] = exp(g_RT[2] - g_RT[6] - g_RT[13] + g_RT[30]);
+        Kc[130] = exp(g_RT[2] - g_RT[4] - g_RT[15] + g_RT[30]);
+        Kc[131] = exp(g_RT[4] - g_RT[7] - g_RT[13] + g_RT[30]);
+        Kc[132] = exp(g_RT[3] - g_RT[8] - g_RT[13] + g_RT[30]);
+        Kc[133] = exp(g_RT[4] - g_RT[10] + g_RT[27] - g_RT[30]);
+        Kc[134] = exp(g_RT[4] - g_RT[7] - g_RT[30] + g_RT[31]);
+        Kc[135] = exp(g_RT[4] - g_RT[7] - g_RT[19] + g_RT[31]);
+        Kc[136] = exp(g_RT[2] - g_RT[6] - g_RT[30] + g_RT[31]);
+        Kc[137] = exp(g_RT[2] - g_RT[6] - g_RT[19] + g_RT[31]);
+        Kc[138] = exp(-g_RT[4] + g_RT[5] - g_RT[30] + g_RT[31]);
+        Kc[139] = exp(g_RT[8] - g_RT[9] - g_RT[30] + g_RT[31]);
+        Kc[140] = exp(g_RT[3] - g_RT[8] - g_RT[30] + g_RT[31]);
+        Kc[141] = exp(g_RT[5] - g_RT[10] - g_RT[18] + g_RT[32]);
+        Kc[142] = exp(-g_RT[2] + g_RT[15] + g_RT[23] - g_RT[32]);
+        Kc[143] = exp(g_RT[5] - g_RT[15] - g_RT[28] + g_RT[32]);
+        Kc[144] = exp(-g_RT[3] + g_RT[8] - g_RT[32] + g_RT[33]);
+        Kc[145] = exp(g_RT[4] - g_RT[7] + g_RT[32] - g_RT[33]);
+        Kc[146] = exp(g_RT[3] - g_RT[12] - g_RT[27] + g_RT[33]);
+        Kc[147] = exp(g_RT[2] - g_RT[6] - g_RT[32] + g_RT[34]);
+        Kc[148] = exp(g_RT[3] - g_RT[8] - g_RT[32] + g_RT[34]);
+        Kc[149] = exp(-g_RT[14] + g_RT[15] - g_RT[32] + g_RT[34]);
+        Kc[150] = exp(g_RT[4] - g_RT[7] - g_RT[32] + g_RT[34]);
+        Kc[151] = exp(-g_RT[10] + g_RT[12] - g_RT[32] + g_RT[33]);
+        Kc[152] = exp(-g_RT[4] + g_RT[8] - g_RT[10] - g_RT[24] + g_RT[33]);
+        Kc[153] = exp(g_RT[3] - g_RT[10] - g_RT[12] - g_RT[15] + g_RT[32]);
+        Kc[154] = exp(g_RT[5] - g_RT[12] - g_RT[20] + g_RT[35]);
+        Kc[155] = exp(g_RT[4] - g_RT[7] - g_RT[34] + g_RT[35]);
+        Kc[156] = exp(-g_RT[2] + g_RT[5] - g_RT[15] - g_RT[27] + g_RT[35]);
+        Kc[157] = exp(g_RT[2] - g_RT[6] - g_RT[34] + g_RT[35]);
+        Kc[158] = exp(-g_RT[3] + g_RT[8] + g_RT[34] - g_RT[35]);
+        Kc[159] = exp(-g_RT[4] + g_RT[8] - g_RT[13] - g_RT[24] + g_RT[34]);
+        Kc[160] = exp(g_RT[2] - g_RT[15] - g_RT[18] + g_RT[35]);
+        Kc[161] = exp(-g_RT[2] + g_RT[15] + g_RT[24] - g_RT[34]);
+        Kc[162] = exp(g_RT[3] - g_RT[8] + g_RT[36] - g_RT[37]);
+        Kc[163] = exp(g_RT[3] - g_RT[8] + g_RT[36] - g_RT[38]);
+        Kc[164] = exp(g_RT[2] - g_RT[6] + g_RT[36] - g_RT[37]);
+        Kc[165] = exp(g_RT[2] - g_RT[6] + g_RT[36] - g_RT[38]);
+        Kc[166] = exp(-g_RT[4] + g_RT[5] + g_RT[36] - g_RT[37]);
+        Kc[167] = exp(-g_RT[4] + g_RT[5] + g_RT[36] - g_RT[38]);
+        Kc[168] = exp(g_RT[4] - g_RT[7] + g_RT[36] - g_RT[38]);
+        Kc[169] = exp(g_RT[4] - g_RT[7] + g_RT[36] - g_RT[37]);
+        Kc[170] = exp(g_RT[8] - g_RT[9] + g_RT[36] - g_RT[37]);
+        Kc[171] = exp(g_RT[8] - g_RT[9] + g_RT[36] - g_RT[38]);
+        Kc[172] = exp(g_RT[36] - g_RT[36] + g_RT[37] - g_RT[38]);
+        Kc[173] = exp(g_RT[3] - g_RT[8] - g_RT[35] + g_RT[37]);
+        Kc[174] = exp(g_RT[3] - g_RT[8] - g_RT[35] + g_RT[38]);
+
+        /*reactions with the net stoichiometry of an earlier one */
+
+        Kc[0] *= refCinv;
+        Kc[1] *= refCinv;
+        Kc[2] *= refCinv;
+        Kc[3] *= refCinv;
+        Kc[4] *= refC;
+        Kc[5] *= refC;
+        Kc[6] *= refC;
+        Kc[7] *= refCinv;
+        Kc[8] *= refCinv;
+        Kc[9] *= refCinv;
+        Kc[10] *= refCinv;
+        Kc[11] *= refCinv;
+        Kc[12] *= refC;
+        Kc[13] *= refCinv;
+        Kc[14] *= refC;
+        Kc[15] *= refCinv;
+        Kc[16] *= refCinv;
+        Kc[17] *= refCinv;
+        Kc[18] *= refCinv;
+        Kc[19] *= refCinv;
+        Kc[20] *= refCinv;
+        Kc[21] *= refC;
+        Kc[22] *= refC;
+        Kc[24] *= refC;
+        Kc[25] *= refC;
+        Kc[26] *= refC;
+        Kc[27] *= refC;
+        Kc[70] *= refC;
+        Kc[75] *= refC;
+        Kc[78] *= refC;
+        Kc[79] *= refC;
+        Kc[104] *= refC;
+        Kc[109] *= refC;
+        Kc[120] *= refC;
+        Kc[121] *= refC;
+        Kc[122] *= refC;
+        Kc[123] *= refC;
+        Kc[152] *= refC;
+        Kc[153] *= refC;
+        Kc[156] *= refC;
+        Kc[159] *= refC;
+    }
 
     return;
 }
@@ -11496,6 +12007,12 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         mixture += sc[i];
     }
 
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[1][0] - 1)*sc[1] + (TB[1][1] - 1)*sc[6] + (TB[1][2] - 1)*sc[7] + (TB[1][3] - 1)*sc[10] + (TB[1][4] - 1)*sc[11] + (TB[1][5] - 1)*sc[14] + (TB[1][6] - 1)*sc[21];
+    double alpha_eff1 = mixture + (TB[16][0] - 1)*sc[6] + (TB[16][1] - 1)*sc[7] + (TB[16][2] - 1)*sc[10] + (TB[16][3] - 1)*sc[11];
+    double alpha_eff2 = mixture + (TB[17][0] - 1)*sc[6] + (TB[17][1] - 1)*sc[7] + (TB[17][2] - 1)*sc[10] + (TB[17][3] - 1)*sc[11];
+    double alpha_eff3 = mixture + (TB[23][0] - 1)*sc[6] + (TB[23][1] - 1)*sc[7] + (TB[23][2] - 1)*sc[10] + (TB[23][3] - 1)*sc[11];
+
     double Corr[175];
     for (int i = 0; i < 175; ++i) {
         Corr[i] = 1.0;
@@ -11505,7 +12022,7 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
     {
         double alpha[16];
         alpha[0] = mixture + (TB[0][0] - 1)*sc[1] + (TB[0][1] - 1)*sc[3] + (TB[0][2] - 1)*sc[7] + (TB[0][3] - 1)*sc[10] + (TB[0][4] - 1)*sc[11] + (TB[0][5] - 1)*sc[21];
-        alpha[1] = mixture + (TB[1][0] - 1)*sc[1] + (TB[1][1] - 1)*sc[6] + (TB[1][2] - 1)*sc[7] + (TB[1][3] - 1)*sc[10] + (TB[1][4] - 1)*sc[11] + (TB[1][5] - 1)*sc[14] + (TB[1][6] - 1)*sc[21];
+        alpha[1] = alpha_eff0;
         alpha[2] = mixture;
         alpha[3] = alpha[2];
         alpha[4] = alpha[2];
@@ -11514,12 +12031,12 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         alpha[7] = alpha[2];
         alpha[8] = alpha[2];
         alpha[9] = alpha[2];
-        alpha[10] = mixture + (TB[10][0] - 1)*sc[1] + (TB[10][1] - 1)*sc[6] + (TB[10][2] - 1)*sc[7] + (TB[10][3] - 1)*sc[10] + (TB[10][4] - 1)*sc[11] + (TB[10][5] - 1)*sc[14] + (TB[10][6] - 1)*sc[21];
-        alpha[11] = mixture + (TB[11][0] - 1)*sc[1] + (TB[11][1] - 1)*sc[6] + (TB[11][2] - 1)*sc[7] + (TB[11][3] - 1)*sc[10] + (TB[11][4] - 1)*sc[11] + (TB[11][5] - 1)*sc[14] + (TB[11][6] - 1)*sc[21];
+        alpha[10] = (memcmp(TB[10], TB[1], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[10][0] - 1)*sc[1] + (TB[10][1] - 1)*sc[6] + (TB[10][2] - 1)*sc[7] + (TB[10][3] - 1)*sc[10] + (TB[10][4] - 1)*sc[11] + (TB[10][5] - 1)*sc[14] + (TB[10][6] - 1)*sc[21]);
+        alpha[11] = (memcmp(TB[11], TB[1], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[11][0] - 1)*sc[1] + (TB[11][1] - 1)*sc[6] + (TB[11][2] - 1)*sc[7] + (TB[11][3] - 1)*sc[10] + (TB[11][4] - 1)*sc[11] + (TB[11][5] - 1)*sc[14] + (TB[11][6] - 1)*sc[21]);
         alpha[12] = alpha[2];
-        alpha[13] = mixture + (TB[13][0] - 1)*sc[1] + (TB[13][1] - 1)*sc[6] + (TB[13][2] - 1)*sc[7] + (TB[13][3] - 1)*sc[10] + (TB[13][4] - 1)*sc[11] + (TB[13][5] - 1)*sc[14] + (TB[13][6] - 1)*sc[21];
+        alpha[13] = (memcmp(TB[13], TB[1], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[13][0] - 1)*sc[1] + (TB[13][1] - 1)*sc[6] + (TB[13][2] - 1)*sc[7] + (TB[13][3] - 1)*sc[10] + (TB[13][4] - 1)*sc[11] + (TB[13][5] - 1)*sc[14] + (TB[13][6] - 1)*sc[21]);
         alpha[14] = alpha[2];
-        alpha[15] = mixture + (TB[15][0] - 1)*sc[1] + (TB[15][1] - 1)*sc[6] + (TB[15][2] - 1)*sc[7] + (TB[15][3] - 1)*sc[10] + (TB[15][4] - 1)*sc[11] + (TB[15][5] - 1)*sc[14] + (TB[15][6] - 1)*sc[21];
+        alpha[15] = (memcmp(TB[15], TB[1], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[15][0] - 1)*sc[1] + (TB[15][1] - 1)*sc[6] + (TB[15][2] - 1)*sc[7] + (TB[15][3] - 1)*sc[10] + (TB[15][4] - 1)*sc[11] + (TB[15][5] - 1)*sc[14] + (TB[15][6] - 1)*sc[21]);
 #ifdef __INTEL_COMPILER
          #pragma simd
 #endif
@@ -11544,29 +12061,29 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
     /* simple three-body correction */
     {
         double alpha;
-        alpha = mixture + (TB[16][0] - 1)*sc[6] + (TB[16][1] - 1)*sc[7] + (TB[16][2] - 1)*sc[10] + (TB[16][3] - 1)*sc[11];
+        alpha = alpha_eff1;
         Corr[16] = alpha;
-        alpha = mixture + (TB[17][0] - 1)*sc[6] + (TB[17][1] - 1)*sc[7] + (TB[17][2] - 1)*sc[10] + (TB[17][3] - 1)*sc[11];
+        alpha = alpha_eff2;
         Corr[17] = alpha;
-        alpha = mixture + (TB[18][0] - 1)*sc[6] + (TB[18][1] - 1)*sc[7] + (TB[18][2] - 1)*sc[10] + (TB[18][3] - 1)*sc[11];
+        alpha = (memcmp(TB[18], TB[16], 4*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[18][0] - 1)*sc[6] + (TB[18][1] - 1)*sc[7] + (TB[18][2] - 1)*sc[10] + (TB[18][3] - 1)*sc[11]);
         Corr[18] = alpha;
-        alpha = mixture + (TB[19][0] - 1)*sc[6] + (TB[19][1] - 1)*sc[7] + (TB[19][2] - 1)*sc[10] + (TB[19][3] - 1)*sc[11];
+        alpha = (memcmp(TB[19], TB[16], 4*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[19][0] - 1)*sc[6] + (TB[19][1] - 1)*sc[7] + (TB[19][2] - 1)*sc[10] + (TB[19][3] - 1)*sc[11]);
         Corr[19] = alpha;
         alpha = mixture;
         Corr[20] = alpha;
         alpha = mixture + (TB[21][0] - 1)*sc[6] + (TB[21][1] - 1)*sc[7] + (TB[21][2] - 1)*sc[10] + (TB[21][3] - 1)*sc[11];
         Corr[21] = alpha;
-        alpha = mixture + (TB[22][0] - 1)*sc[6] + (TB[22][1] - 1)*sc[7] + (TB[22][2] - 1)*sc[10] + (TB[22][3] - 1)*sc[11];
+        alpha = (memcmp(TB[22], TB[17], 4*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[22][0] - 1)*sc[6] + (TB[22][1] - 1)*sc[7] + (TB[22][2] - 1)*sc[10] + (TB[22][3] - 1)*sc[11]);
         Corr[22] = alpha;
-        alpha = mixture + (TB[23][0] - 1)*sc[6] + (TB[23][1] - 1)*sc[7] + (TB[23][2] - 1)*sc[10] + (TB[23][3] - 1)*sc[11];
+        alpha = alpha_eff3;
         Corr[23] = alpha;
         alpha = mixture;
         Corr[24] = alpha;
         Corr[25] = alpha;
         Corr[26] = alpha;
-        alpha = mixture + (TB[27][0] - 1)*sc[6] + (TB[27][1] - 1)*sc[7] + (TB[27][2] - 1)*sc[10] + (TB[27][3] - 1)*sc[11];
+        alpha = (memcmp(TB[27], TB[23], 4*sizeof(double)) == 0 ? alpha_eff3 : mixture + (TB[27][0] - 1)*sc[6] + (TB[27][1] - 1)*sc[7] + (TB[27][2] - 1)*sc[10] + (TB[27][3] - 1)*sc[11]);
         Corr[27] = alpha;
-        alpha = mixture + (TB[28][0] - 1)*sc[6] + (TB[28][1] - 1)*sc[7] + (TB[28][2] - 1)*sc[10] + (TB[28][3] - 1)*sc[11];
+        alpha = (memcmp(TB[28], TB[16], 4*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[28][0] - 1)*sc[6] + (TB[28][1] - 1)*sc[7] + (TB[28][2] - 1)*sc[10] + (TB[28][3] - 1)*sc[11]);
         Corr[28] = alpha;
     }
 
@@ -14803,17 +15320,24 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         mixture += sc[k];
     }
 
-    /*compute the Gibbs free energy */
-    double g_RT[39];
-    gibbs(g_RT, tc);
-
     /*compute the species enthalpy */
     double h_RT[39];
     speciesEnthalpy(h_RT, tc);
 
+    /*compute the rate and equilibrium constants */
+    double k_f_s[175], Kc_s[175];
+    comp_k_f(tc, invT, k_f_s);
+    comp_Kc(tc, invT, Kc_s);
+
+    /*at constant volume, the part of dwdot/d[X] common to all species */
+    double Jmix[39];
+    for (int k=0; k<39; k++) {
+        Jmix[k] = 0.0;
+    }
+
     double phi_f, k_f, k_r, phi_r, Kc, q, q_nocor, Corr, alpha;
     double dlnkfdT, dlnk0dT, dlnKcdT, dkrdT, dqdT;
-    double dqdci, dcdc_fac, dqdc[39];
+    double dqdci, dcdc_fac;
     double Pr, fPr, F, k_0, logPr;
     double logFcent, troe_c, troe_n, troePr_den, troePr, troe;
     double Fcent1, Fcent2, Fcent3, Fcent;
@@ -14821,6 +15345,15 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     double dlogPrdT, dlogfPrdT, dlogFdT, dlogFcentdT, dlogFdlogPr, dlnCorrdT;
     const double ln10 = log(10.0);
     const double log10e = 1.0/log(10.0);
+    double x_0, x_0_s[1], e_0_s[1];
+    double logFcent_s[1], dlogFcentdT_s[1];
+
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[1][0] - 1)*sc[1] + (TB[1][1] - 1)*sc[6] + (TB[1][2] - 1)*sc[7] + (TB[1][3] - 1)*sc[10] + (TB[1][4] - 1)*sc[11] + (TB[1][5] - 1)*sc[14] + (TB[1][6] - 1)*sc[21];
+    double alpha_eff1 = mixture + (TB[16][0] - 1)*sc[6] + (TB[16][1] - 1)*sc[7] + (TB[16][2] - 1)*sc[10] + (TB[16][3] - 1)*sc[11];
+    double alpha_eff2 = mixture + (TB[17][0] - 1)*sc[6] + (TB[17][1] - 1)*sc[7] + (TB[17][2] - 1)*sc[10] + (TB[17][3] - 1)*sc[11];
+    double alpha_eff3 = mixture + (TB[23][0] - 1)*sc[6] + (TB[23][1] - 1)*sc[7] + (TB[23][2] - 1)*sc[10] + (TB[23][3] - 1)*sc[11];
+
     /*reaction 1: H + O2 (+M) <=> HO2 (+M) */
     /*a pressure-fall-off reaction */
     /* also 3-body */
@@ -14828,8 +15361,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[0][0] - 1)*sc[1] + (TB[0][1] - 1)*sc[3] + (TB[0][2] - 1)*sc[7] + (TB[0][3] - 1)*sc[10] + (TB[0][4] - 1)*sc[11] + (TB[0][5] - 1)*sc[21];
     /* forward */
     phi_f = sc[2]*sc[3];
-    k_f = prefactor_units[0] * fwd_A[0]
-                * exp(fwd_beta[0] * tc[0] - activation_units[0] * fwd_Ea[0] * invT);
+    k_f = k_f_s[0];
     dlnkfdT = fwd_beta[0] * invT + activation_units[0] * fwd_Ea[0] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[0] * exp(low_beta[0] * tc[0] - activation_units[0] * low_Ea[0] * invT);
@@ -14845,16 +15377,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[0] == 4 ? exp(-troe_Tss[0] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
+      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
+      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
-      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
-      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -14862,7 +15394,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[8];
-    Kc = refCinv * exp(g_RT[2] + g_RT[3] - g_RT[8]);
+    Kc = Kc_s[0];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[3]) + (h_RT[8]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -14880,94 +15412,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[0][0] - 1)*dcdc_fac;
-        J[42] -= dqdci;               /* dwdot[H]/d[AR] */
-        J[43] -= dqdci;               /* dwdot[O2]/d[AR] */
-        J[48] += dqdci;               /* dwdot[HO2]/d[AR] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[3];
-        J[82] -= dqdci;               /* dwdot[H]/d[H] */
-        J[83] -= dqdci;               /* dwdot[O2]/d[H] */
-        J[88] += dqdci;               /* dwdot[HO2]/d[H] */
-        /* d()/d[O2] */
-        dqdci = (TB[0][1] - 1)*dcdc_fac + k_f*sc[2];
-        J[122] -= dqdci;              /* dwdot[H]/d[O2] */
-        J[123] -= dqdci;              /* dwdot[O2]/d[O2] */
-        J[128] += dqdci;              /* dwdot[HO2]/d[O2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[0][2] - 1)*dcdc_fac;
-        J[282] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[283] -= dqdci;              /* dwdot[O2]/d[H2O] */
-        J[288] += dqdci;              /* dwdot[HO2]/d[H2O] */
-        /* d()/d[HO2] */
-        dqdci =  - k_r;
-        J[322] -= dqdci;              /* dwdot[H]/d[HO2] */
-        J[323] -= dqdci;              /* dwdot[O2]/d[HO2] */
-        J[328] += dqdci;              /* dwdot[HO2]/d[HO2] */
-        /* d()/d[CO] */
-        dqdci = (TB[0][3] - 1)*dcdc_fac;
-        J[402] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[403] -= dqdci;              /* dwdot[O2]/d[CO] */
-        J[408] += dqdci;              /* dwdot[HO2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[0][4] - 1)*dcdc_fac;
-        J[442] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[443] -= dqdci;              /* dwdot[O2]/d[CO2] */
-        J[448] += dqdci;              /* dwdot[HO2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[0][5] - 1)*dcdc_fac;
-        J[842] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[843] -= dqdci;              /* dwdot[O2]/d[C2H6] */
-        J[848] += dqdci;              /* dwdot[HO2]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[0][0]*dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*sc[3];
-        dqdc[3] = TB[0][1]*dcdc_fac + k_f*sc[2];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[0][2]*dcdc_fac;
-        dqdc[8] = dcdc_fac - k_r;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = TB[0][3]*dcdc_fac;
-        dqdc[11] = TB[0][4]*dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[0][5]*dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+2] -= dqdc[k];
-            J[40*k+3] -= dqdc[k];
-            J[40*k+8] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] -= dcdc_fac;
+    Jmix[3] -= dcdc_fac;
+    Jmix[8] += dcdc_fac;
+    /* d()/d[AR] */
+    dqdci = (TB[0][0] - 1)*dcdc_fac;
+    J[42] -= dqdci;               /* dwdot[H]/d[AR] */
+    J[43] -= dqdci;               /* dwdot[O2]/d[AR] */
+    J[48] += dqdci;               /* dwdot[HO2]/d[AR] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[3];
+    J[82] -= dqdci;               /* dwdot[H]/d[H] */
+    J[83] -= dqdci;               /* dwdot[O2]/d[H] */
+    J[88] += dqdci;               /* dwdot[HO2]/d[H] */
+    /* d()/d[O2] */
+    dqdci = (TB[0][1] - 1)*dcdc_fac + k_f*sc[2];
+    J[122] -= dqdci;              /* dwdot[H]/d[O2] */
+    J[123] -= dqdci;              /* dwdot[O2]/d[O2] */
+    J[128] += dqdci;              /* dwdot[HO2]/d[O2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[0][2] - 1)*dcdc_fac;
+    J[282] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[283] -= dqdci;              /* dwdot[O2]/d[H2O] */
+    J[288] += dqdci;              /* dwdot[HO2]/d[H2O] */
+    /* d()/d[HO2] */
+    dqdci =  - k_r;
+    J[322] -= dqdci;              /* dwdot[H]/d[HO2] */
+    J[323] -= dqdci;              /* dwdot[O2]/d[HO2] */
+    J[328] += dqdci;              /* dwdot[HO2]/d[HO2] */
+    /* d()/d[CO] */
+    dqdci = (TB[0][3] - 1)*dcdc_fac;
+    J[402] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[403] -= dqdci;              /* dwdot[O2]/d[CO] */
+    J[408] += dqdci;              /* dwdot[HO2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[0][4] - 1)*dcdc_fac;
+    J[442] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[443] -= dqdci;              /* dwdot[O2]/d[CO2] */
+    J[448] += dqdci;              /* dwdot[HO2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[0][5] - 1)*dcdc_fac;
+    J[842] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[843] -= dqdci;              /* dwdot[O2]/d[C2H6] */
+    J[848] += dqdci;              /* dwdot[HO2]/d[C2H6] */
     J[1562] -= dqdT; /* dwdot[H]/dT */
     J[1563] -= dqdT; /* dwdot[O2]/dT */
     J[1568] += dqdT; /* dwdot[HO2]/dT */
@@ -14976,11 +15464,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[1][0] - 1)*sc[1] + (TB[1][1] - 1)*sc[6] + (TB[1][2] - 1)*sc[7] + (TB[1][3] - 1)*sc[10] + (TB[1][4] - 1)*sc[11] + (TB[1][5] - 1)*sc[14] + (TB[1][6] - 1)*sc[21];
+    alpha = alpha_eff0;
     /* forward */
     phi_f = sc[4]*sc[4];
-    k_f = prefactor_units[1] * fwd_A[1]
-                * exp(fwd_beta[1] * tc[0] - activation_units[1] * fwd_Ea[1] * invT);
+    k_f = k_f_s[1];
     dlnkfdT = fwd_beta[1] * invT + activation_units[1] * fwd_Ea[1] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[1] * exp(low_beta[1] * tc[0] - activation_units[1] * low_Ea[1] * invT);
@@ -14996,16 +15483,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[1] == 4 ? exp(-troe_Tss[1] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
+      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
+      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
-      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
-      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -15013,7 +15500,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[9];
-    Kc = refCinv * exp(2*g_RT[4] - g_RT[9]);
+    Kc = Kc_s[1];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[4]) + (h_RT[9]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15030,89 +15517,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[1][0] - 1)*dcdc_fac;
-        J[44] += -2 * dqdci;          /* dwdot[OH]/d[AR] */
-        J[49] += dqdci;               /* dwdot[H2O2]/d[AR] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*2*sc[4];
-        J[164] += -2 * dqdci;         /* dwdot[OH]/d[OH] */
-        J[169] += dqdci;              /* dwdot[H2O2]/d[OH] */
-        /* d()/d[H2] */
-        dqdci = (TB[1][1] - 1)*dcdc_fac;
-        J[244] += -2 * dqdci;         /* dwdot[OH]/d[H2] */
-        J[249] += dqdci;              /* dwdot[H2O2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[1][2] - 1)*dcdc_fac;
-        J[284] += -2 * dqdci;         /* dwdot[OH]/d[H2O] */
-        J[289] += dqdci;              /* dwdot[H2O2]/d[H2O] */
-        /* d()/d[H2O2] */
-        dqdci =  - k_r;
-        J[364] += -2 * dqdci;         /* dwdot[OH]/d[H2O2] */
-        J[369] += dqdci;              /* dwdot[H2O2]/d[H2O2] */
-        /* d()/d[CO] */
-        dqdci = (TB[1][3] - 1)*dcdc_fac;
-        J[404] += -2 * dqdci;         /* dwdot[OH]/d[CO] */
-        J[409] += dqdci;              /* dwdot[H2O2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[1][4] - 1)*dcdc_fac;
-        J[444] += -2 * dqdci;         /* dwdot[OH]/d[CO2] */
-        J[449] += dqdci;              /* dwdot[H2O2]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[1][5] - 1)*dcdc_fac;
-        J[564] += -2 * dqdci;         /* dwdot[OH]/d[CH4] */
-        J[569] += dqdci;              /* dwdot[H2O2]/d[CH4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[1][6] - 1)*dcdc_fac;
-        J[844] += -2 * dqdci;         /* dwdot[OH]/d[C2H6] */
-        J[849] += dqdci;              /* dwdot[H2O2]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[1][0]*dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac + k_f*2*sc[4];
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = TB[1][1]*dcdc_fac;
-        dqdc[7] = TB[1][2]*dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac - k_r;
-        dqdc[10] = TB[1][3]*dcdc_fac;
-        dqdc[11] = TB[1][4]*dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = TB[1][5]*dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[1][6]*dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+4] += -2 * dqdc[k];
-            J[40*k+9] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[4] += -2 * dcdc_fac;
+    Jmix[9] += dcdc_fac;
+    /* d()/d[AR] */
+    dqdci = (TB[1][0] - 1)*dcdc_fac;
+    J[44] += -2 * dqdci;          /* dwdot[OH]/d[AR] */
+    J[49] += dqdci;               /* dwdot[H2O2]/d[AR] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*2*sc[4];
+    J[164] += -2 * dqdci;         /* dwdot[OH]/d[OH] */
+    J[169] += dqdci;              /* dwdot[H2O2]/d[OH] */
+    /* d()/d[H2] */
+    dqdci = (TB[1][1] - 1)*dcdc_fac;
+    J[244] += -2 * dqdci;         /* dwdot[OH]/d[H2] */
+    J[249] += dqdci;              /* dwdot[H2O2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[1][2] - 1)*dcdc_fac;
+    J[284] += -2 * dqdci;         /* dwdot[OH]/d[H2O] */
+    J[289] += dqdci;              /* dwdot[H2O2]/d[H2O] */
+    /* d()/d[H2O2] */
+    dqdci =  - k_r;
+    J[364] += -2 * dqdci;         /* dwdot[OH]/d[H2O2] */
+    J[369] += dqdci;              /* dwdot[H2O2]/d[H2O2] */
+    /* d()/d[CO] */
+    dqdci = (TB[1][3] - 1)*dcdc_fac;
+    J[404] += -2 * dqdci;         /* dwdot[OH]/d[CO] */
+    J[409] += dqdci;              /* dwdot[H2O2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[1][4] - 1)*dcdc_fac;
+    J[444] += -2 * dqdci;         /* dwdot[OH]/d[CO2] */
+    J[449] += dqdci;              /* dwdot[H2O2]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[1][5] - 1)*dcdc_fac;
+    J[564] += -2 * dqdci;         /* dwdot[OH]/d[CH4] */
+    J[569] += dqdci;              /* dwdot[H2O2]/d[CH4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[1][6] - 1)*dcdc_fac;
+    J[844] += -2 * dqdci;         /* dwdot[OH]/d[C2H6] */
+    J[849] += dqdci;              /* dwdot[H2O2]/d[C2H6] */
     J[1564] += -2 * dqdT; /* dwdot[OH]/dT */
     J[1569] += dqdT; /* dwdot[H2O2]/dT */
 
@@ -15123,8 +15566,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[2]*sc[15];
-    k_f = prefactor_units[2] * fwd_A[2]
-                * exp(fwd_beta[2] * tc[0] - activation_units[2] * fwd_Ea[2] * invT);
+    k_f = k_f_s[2];
     dlnkfdT = fwd_beta[2] * invT + activation_units[2] * fwd_Ea[2] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[2] * exp(low_beta[2] * tc[0] - activation_units[2] * low_Ea[2] * invT);
@@ -15140,16 +15582,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[2] == 4 ? exp(-troe_Tss[2] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[2]) > 1.e-100 ? -Fcent1/troe_Tsss[2] : 0.)
+      + (fabs(troe_Ts[2]) > 1.e-100 ? -Fcent2/troe_Ts[2] : 0.)
+      + (troe_len[2] == 4 ? Fcent3*troe_Tss[2]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[2]) > 1.e-100 ? -Fcent1/troe_Tsss[2] : 0.)
-      + (fabs(troe_Ts[2]) > 1.e-100 ? -Fcent2/troe_Ts[2] : 0.)
-      + (troe_len[2] == 4 ? Fcent3*troe_Tss[2]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -15157,7 +15599,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[14];
-    Kc = refCinv * exp(g_RT[2] - g_RT[14] + g_RT[15]);
+    Kc = Kc_s[2];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[15]) + (h_RT[14]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15175,69 +15617,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[15];
-        J[82] -= dqdci;               /* dwdot[H]/d[H] */
-        J[94] += dqdci;               /* dwdot[CH4]/d[H] */
-        J[95] -= dqdci;               /* dwdot[CH3]/d[H] */
-        /* d()/d[CH4] */
-        dqdci =  - k_r;
-        J[562] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[574] += dqdci;              /* dwdot[CH4]/d[CH4] */
-        J[575] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[2];
-        J[602] -= dqdci;              /* dwdot[H]/d[CH3] */
-        J[614] += dqdci;              /* dwdot[CH4]/d[CH3] */
-        J[615] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*sc[15];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac - k_r;
-        dqdc[15] = dcdc_fac + k_f*sc[2];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+2] -= dqdc[k];
-            J[40*k+14] += dqdc[k];
-            J[40*k+15] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] -= dcdc_fac;
+    Jmix[14] += dcdc_fac;
+    Jmix[15] -= dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[15];
+    J[82] -= dqdci;               /* dwdot[H]/d[H] */
+    J[94] += dqdci;               /* dwdot[CH4]/d[H] */
+    J[95] -= dqdci;               /* dwdot[CH3]/d[H] */
+    /* d()/d[CH4] */
+    dqdci =  - k_r;
+    J[562] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[574] += dqdci;              /* dwdot[CH4]/d[CH4] */
+    J[575] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[2];
+    J[602] -= dqdci;              /* dwdot[H]/d[CH3] */
+    J[614] += dqdci;              /* dwdot[CH4]/d[CH3] */
+    J[615] -= dqdci;              /* dwdot[CH3]/d[CH3] */
     J[1562] -= dqdT; /* dwdot[H]/dT */
     J[1574] += dqdT; /* dwdot[CH4]/dT */
     J[1575] -= dqdT; /* dwdot[CH3]/dT */
@@ -15249,8 +15647,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[15]*sc[15];
-    k_f = prefactor_units[3] * fwd_A[3]
-                * exp(fwd_beta[3] * tc[0] - activation_units[3] * fwd_Ea[3] * invT);
+    k_f = k_f_s[3];
     dlnkfdT = fwd_beta[3] * invT + activation_units[3] * fwd_Ea[3] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[3] * exp(low_beta[3] * tc[0] - activation_units[3] * low_Ea[3] * invT);
@@ -15266,16 +15663,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[3] == 4 ? exp(-troe_Tss[3] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[3]) > 1.e-100 ? -Fcent1/troe_Tsss[3] : 0.)
+      + (fabs(troe_Ts[3]) > 1.e-100 ? -Fcent2/troe_Ts[3] : 0.)
+      + (troe_len[3] == 4 ? Fcent3*troe_Tss[3]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[3]) > 1.e-100 ? -Fcent1/troe_Tsss[3] : 0.)
-      + (fabs(troe_Ts[3]) > 1.e-100 ? -Fcent2/troe_Ts[3] : 0.)
-      + (troe_len[3] == 4 ? Fcent3*troe_Tss[3]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -15283,7 +15680,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[21];
-    Kc = refCinv * exp(2*g_RT[15] - g_RT[21]);
+    Kc = Kc_s[3];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[15]) + (h_RT[21]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15300,61 +15697,17 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[CH3] */
-        dqdci =  + k_f*2*sc[15];
-        J[615] += -2 * dqdci;         /* dwdot[CH3]/d[CH3] */
-        J[621] += dqdci;              /* dwdot[C2H6]/d[CH3] */
-        /* d()/d[C2H6] */
-        dqdci =  - k_r;
-        J[855] += -2 * dqdci;         /* dwdot[CH3]/d[C2H6] */
-        J[861] += dqdci;              /* dwdot[C2H6]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac + k_f*2*sc[15];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac - k_r;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+15] += -2 * dqdc[k];
-            J[40*k+21] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[15] += -2 * dcdc_fac;
+    Jmix[21] += dcdc_fac;
+    /* d()/d[CH3] */
+    dqdci =  + k_f*2*sc[15];
+    J[615] += -2 * dqdci;         /* dwdot[CH3]/d[CH3] */
+    J[621] += dqdci;              /* dwdot[C2H6]/d[CH3] */
+    /* d()/d[C2H6] */
+    dqdci =  - k_r;
+    J[855] += -2 * dqdci;         /* dwdot[CH3]/d[C2H6] */
+    J[861] += dqdci;              /* dwdot[C2H6]/d[C2H6] */
     J[1575] += -2 * dqdT; /* dwdot[CH3]/dT */
     J[1581] += dqdT; /* dwdot[C2H6]/dT */
 
@@ -15365,8 +15718,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[21];
-    k_f = prefactor_units[4] * fwd_A[4]
-                * exp(fwd_beta[4] * tc[0] - activation_units[4] * fwd_Ea[4] * invT);
+    k_f = k_f_s[4];
     dlnkfdT = fwd_beta[4] * invT + activation_units[4] * fwd_Ea[4] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[4] * exp(low_beta[4] * tc[0] - activation_units[4] * low_Ea[4] * invT);
@@ -15382,16 +15734,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[4] == 4 ? exp(-troe_Tss[4] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[4]) > 1.e-100 ? -Fcent1/troe_Tsss[4] : 0.)
+      + (fabs(troe_Ts[4]) > 1.e-100 ? -Fcent2/troe_Ts[4] : 0.)
+      + (troe_len[4] == 4 ? Fcent3*troe_Tss[4]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[4]) > 1.e-100 ? -Fcent1/troe_Tsss[4] : 0.)
-      + (fabs(troe_Ts[4]) > 1.e-100 ? -Fcent2/troe_Ts[4] : 0.)
-      + (troe_len[4] == 4 ? Fcent3*troe_Tss[4]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -15399,7 +15751,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[2]*sc[20];
-    Kc = refC * exp(-g_RT[2] - g_RT[20] + g_RT[21]);
+    Kc = Kc_s[4];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[21]) + (h_RT[2] + h_RT[20]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15417,69 +15769,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[20];
-        J[82] += dqdci;               /* dwdot[H]/d[H] */
-        J[100] += dqdci;              /* dwdot[C2H5]/d[H] */
-        J[101] -= dqdci;              /* dwdot[C2H6]/d[H] */
-        /* d()/d[C2H5] */
-        dqdci =  - k_r*sc[2];
-        J[802] += dqdci;              /* dwdot[H]/d[C2H5] */
-        J[820] += dqdci;              /* dwdot[C2H5]/d[C2H5] */
-        J[821] -= dqdci;              /* dwdot[C2H6]/d[C2H5] */
-        /* d()/d[C2H6] */
-        dqdci =  + k_f;
-        J[842] += dqdci;              /* dwdot[H]/d[C2H6] */
-        J[860] += dqdci;              /* dwdot[C2H5]/d[C2H6] */
-        J[861] -= dqdci;              /* dwdot[C2H6]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac - k_r*sc[20];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac - k_r*sc[2];
-        dqdc[21] = dcdc_fac + k_f;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+2] += dqdc[k];
-            J[40*k+20] += dqdc[k];
-            J[40*k+21] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] += dcdc_fac;
+    Jmix[20] += dcdc_fac;
+    Jmix[21] -= dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[20];
+    J[82] += dqdci;               /* dwdot[H]/d[H] */
+    J[100] += dqdci;              /* dwdot[C2H5]/d[H] */
+    J[101] -= dqdci;              /* dwdot[C2H6]/d[H] */
+    /* d()/d[C2H5] */
+    dqdci =  - k_r*sc[2];
+    J[802] += dqdci;              /* dwdot[H]/d[C2H5] */
+    J[820] += dqdci;              /* dwdot[C2H5]/d[C2H5] */
+    J[821] -= dqdci;              /* dwdot[C2H6]/d[C2H5] */
+    /* d()/d[C2H6] */
+    dqdci =  + k_f;
+    J[842] += dqdci;              /* dwdot[H]/d[C2H6] */
+    J[860] += dqdci;              /* dwdot[C2H5]/d[C2H6] */
+    J[861] -= dqdci;              /* dwdot[C2H6]/d[C2H6] */
     J[1562] += dqdT; /* dwdot[H]/dT */
     J[1580] += dqdT; /* dwdot[C2H5]/dT */
     J[1581] -= dqdT; /* dwdot[C2H6]/dT */
@@ -15491,8 +15799,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[20];
-    k_f = prefactor_units[5] * fwd_A[5]
-                * exp(fwd_beta[5] * tc[0] - activation_units[5] * fwd_Ea[5] * invT);
+    k_f = k_f_s[5];
     dlnkfdT = fwd_beta[5] * invT + activation_units[5] * fwd_Ea[5] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[5] * exp(low_beta[5] * tc[0] - activation_units[5] * low_Ea[5] * invT);
@@ -15508,16 +15815,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[5] == 4 ? exp(-troe_Tss[5] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[5]) > 1.e-100 ? -Fcent1/troe_Tsss[5] : 0.)
+      + (fabs(troe_Ts[5]) > 1.e-100 ? -Fcent2/troe_Ts[5] : 0.)
+      + (troe_len[5] == 4 ? Fcent3*troe_Tss[5]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[5]) > 1.e-100 ? -Fcent1/troe_Tsss[5] : 0.)
-      + (fabs(troe_Ts[5]) > 1.e-100 ? -Fcent2/troe_Ts[5] : 0.)
-      + (troe_len[5] == 4 ? Fcent3*troe_Tss[5]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -15525,7 +15832,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[2]*sc[18];
-    Kc = refC * exp(-g_RT[2] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[5];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[20]) + (h_RT[2] + h_RT[18]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15543,69 +15850,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[18];
-        J[82] += dqdci;               /* dwdot[H]/d[H] */
-        J[98] += dqdci;               /* dwdot[C2H4]/d[H] */
-        J[100] -= dqdci;              /* dwdot[C2H5]/d[H] */
-        /* d()/d[C2H4] */
-        dqdci =  - k_r*sc[2];
-        J[722] += dqdci;              /* dwdot[H]/d[C2H4] */
-        J[738] += dqdci;              /* dwdot[C2H4]/d[C2H4] */
-        J[740] -= dqdci;              /* dwdot[C2H5]/d[C2H4] */
-        /* d()/d[C2H5] */
-        dqdci =  + k_f;
-        J[802] += dqdci;              /* dwdot[H]/d[C2H5] */
-        J[818] += dqdci;              /* dwdot[C2H4]/d[C2H5] */
-        J[820] -= dqdci;              /* dwdot[C2H5]/d[C2H5] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac - k_r*sc[18];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac - k_r*sc[2];
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac + k_f;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+2] += dqdc[k];
-            J[40*k+18] += dqdc[k];
-            J[40*k+20] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] += dcdc_fac;
+    Jmix[18] += dcdc_fac;
+    Jmix[20] -= dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[18];
+    J[82] += dqdci;               /* dwdot[H]/d[H] */
+    J[98] += dqdci;               /* dwdot[C2H4]/d[H] */
+    J[100] -= dqdci;              /* dwdot[C2H5]/d[H] */
+    /* d()/d[C2H4] */
+    dqdci =  - k_r*sc[2];
+    J[722] += dqdci;              /* dwdot[H]/d[C2H4] */
+    J[738] += dqdci;              /* dwdot[C2H4]/d[C2H4] */
+    J[740] -= dqdci;              /* dwdot[C2H5]/d[C2H4] */
+    /* d()/d[C2H5] */
+    dqdci =  + k_f;
+    J[802] += dqdci;              /* dwdot[H]/d[C2H5] */
+    J[818] += dqdci;              /* dwdot[C2H4]/d[C2H5] */
+    J[820] -= dqdci;              /* dwdot[C2H5]/d[C2H5] */
     J[1562] += dqdT; /* dwdot[H]/dT */
     J[1578] += dqdT; /* dwdot[C2H4]/dT */
     J[1580] -= dqdT; /* dwdot[C2H5]/dT */
@@ -15617,8 +15880,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[24];
-    k_f = prefactor_units[6] * fwd_A[6]
-                * exp(fwd_beta[6] * tc[0] - activation_units[6] * fwd_Ea[6] * invT);
+    k_f = k_f_s[6];
     dlnkfdT = fwd_beta[6] * invT + activation_units[6] * fwd_Ea[6] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[6] * exp(low_beta[6] * tc[0] - activation_units[6] * low_Ea[6] * invT);
@@ -15634,16 +15896,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[6] == 4 ? exp(-troe_Tss[6] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[6]) > 1.e-100 ? -Fcent1/troe_Tsss[6] : 0.)
+      + (fabs(troe_Ts[6]) > 1.e-100 ? -Fcent2/troe_Ts[6] : 0.)
+      + (troe_len[6] == 4 ? Fcent3*troe_Tss[6]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[6]) > 1.e-100 ? -Fcent1/troe_Tsss[6] : 0.)
-      + (fabs(troe_Ts[6]) > 1.e-100 ? -Fcent2/troe_Ts[6] : 0.)
-      + (troe_len[6] == 4 ? Fcent3*troe_Tss[6]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -15651,7 +15913,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[2]*sc[23];
-    Kc = refC * exp(-g_RT[2] - g_RT[23] + g_RT[24]);
+    Kc = Kc_s[6];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[24]) + (h_RT[2] + h_RT[23]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15669,69 +15931,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[23];
-        J[82] += dqdci;               /* dwdot[H]/d[H] */
-        J[103] += dqdci;              /* dwdot[C2H2]/d[H] */
-        J[104] -= dqdci;              /* dwdot[C2H3]/d[H] */
-        /* d()/d[C2H2] */
-        dqdci =  - k_r*sc[2];
-        J[922] += dqdci;              /* dwdot[H]/d[C2H2] */
-        J[943] += dqdci;              /* dwdot[C2H2]/d[C2H2] */
-        J[944] -= dqdci;              /* dwdot[C2H3]/d[C2H2] */
-        /* d()/d[C2H3] */
-        dqdci =  + k_f;
-        J[962] += dqdci;              /* dwdot[H]/d[C2H3] */
-        J[983] += dqdci;              /* dwdot[C2H2]/d[C2H3] */
-        J[984] -= dqdci;              /* dwdot[C2H3]/d[C2H3] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac - k_r*sc[23];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac - k_r*sc[2];
-        dqdc[24] = dcdc_fac + k_f;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+2] += dqdc[k];
-            J[40*k+23] += dqdc[k];
-            J[40*k+24] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] += dcdc_fac;
+    Jmix[23] += dcdc_fac;
+    Jmix[24] -= dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[23];
+    J[82] += dqdci;               /* dwdot[H]/d[H] */
+    J[103] += dqdci;              /* dwdot[C2H2]/d[H] */
+    J[104] -= dqdci;              /* dwdot[C2H3]/d[H] */
+    /* d()/d[C2H2] */
+    dqdci =  - k_r*sc[2];
+    J[922] += dqdci;              /* dwdot[H]/d[C2H2] */
+    J[943] += dqdci;              /* dwdot[C2H2]/d[C2H2] */
+    J[944] -= dqdci;              /* dwdot[C2H3]/d[C2H2] */
+    /* d()/d[C2H3] */
+    dqdci =  + k_f;
+    J[962] += dqdci;              /* dwdot[H]/d[C2H3] */
+    J[983] += dqdci;              /* dwdot[C2H2]/d[C2H3] */
+    J[984] -= dqdci;              /* dwdot[C2H3]/d[C2H3] */
     J[1562] += dqdT; /* dwdot[H]/dT */
     J[1583] += dqdT; /* dwdot[C2H2]/dT */
     J[1584] -= dqdT; /* dwdot[C2H3]/dT */
@@ -15743,11 +15961,13 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[2]*sc[33];
-    k_f = prefactor_units[7] * fwd_A[7]
-                * exp(fwd_beta[7] * tc[0] - activation_units[7] * fwd_Ea[7] * invT);
+    k_f = k_f_s[7];
     dlnkfdT = fwd_beta[7] * invT + activation_units[7] * fwd_Ea[7] * invT2;
     /* pressure-fall-off */
-    k_0 = low_A[7] * exp(low_beta[7] * tc[0] - activation_units[7] * low_Ea[7] * invT);
+    x_0 = low_beta[7] * tc[0] - activation_units[7] * low_Ea[7] * invT;
+    x_0_s[0] = x_0;
+    e_0_s[0] = exp(x_0);
+    k_0 = low_A[7] * e_0_s[0];
     Pr = phase_units[7] * alpha / k_f * k_0;
     fPr = Pr / (1.0+Pr);
     dlnk0dT = low_beta[7] * invT + activation_units[7] * low_Ea[7] * invT2;
@@ -15760,16 +15980,18 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[7] == 4 ? exp(-troe_Tss[7] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[7]) > 1.e-100 ? -Fcent1/troe_Tsss[7] : 0.)
+      + (fabs(troe_Ts[7]) > 1.e-100 ? -Fcent2/troe_Ts[7] : 0.)
+      + (troe_len[7] == 4 ? Fcent3*troe_Tss[7]*invT2 : 0.) );
+    logFcent_s[0] = logFcent;
+    dlogFcentdT_s[0] = dlogFcentdT;
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[7]) > 1.e-100 ? -Fcent1/troe_Tsss[7] : 0.)
-      + (fabs(troe_Ts[7]) > 1.e-100 ? -Fcent2/troe_Ts[7] : 0.)
-      + (troe_len[7] == 4 ? Fcent3*troe_Tss[7]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -15777,7 +15999,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[32];
-    Kc = refCinv * exp(g_RT[2] - g_RT[32] + g_RT[33]);
+    Kc = Kc_s[7];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[33]) + (h_RT[32]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15795,69 +16017,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[33];
-        J[82] -= dqdci;               /* dwdot[H]/d[H] */
-        J[112] += dqdci;              /* dwdot[C3H4]/d[H] */
-        J[113] -= dqdci;              /* dwdot[C3H3]/d[H] */
-        /* d()/d[C3H4] */
-        dqdci =  - k_r;
-        J[1282] -= dqdci;             /* dwdot[H]/d[C3H4] */
-        J[1312] += dqdci;             /* dwdot[C3H4]/d[C3H4] */
-        J[1313] -= dqdci;             /* dwdot[C3H3]/d[C3H4] */
-        /* d()/d[C3H3] */
-        dqdci =  + k_f*sc[2];
-        J[1322] -= dqdci;             /* dwdot[H]/d[C3H3] */
-        J[1352] += dqdci;             /* dwdot[C3H4]/d[C3H3] */
-        J[1353] -= dqdci;             /* dwdot[C3H3]/d[C3H3] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*sc[33];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac - k_r;
-        dqdc[33] = dcdc_fac + k_f*sc[2];
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+2] -= dqdc[k];
-            J[40*k+32] += dqdc[k];
-            J[40*k+33] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] -= dcdc_fac;
+    Jmix[32] += dcdc_fac;
+    Jmix[33] -= dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[33];
+    J[82] -= dqdci;               /* dwdot[H]/d[H] */
+    J[112] += dqdci;              /* dwdot[C3H4]/d[H] */
+    J[113] -= dqdci;              /* dwdot[C3H3]/d[H] */
+    /* d()/d[C3H4] */
+    dqdci =  - k_r;
+    J[1282] -= dqdci;             /* dwdot[H]/d[C3H4] */
+    J[1312] += dqdci;             /* dwdot[C3H4]/d[C3H4] */
+    J[1313] -= dqdci;             /* dwdot[C3H3]/d[C3H4] */
+    /* d()/d[C3H3] */
+    dqdci =  + k_f*sc[2];
+    J[1322] -= dqdci;             /* dwdot[H]/d[C3H3] */
+    J[1352] += dqdci;             /* dwdot[C3H4]/d[C3H3] */
+    J[1353] -= dqdci;             /* dwdot[C3H3]/d[C3H3] */
     J[1562] -= dqdT; /* dwdot[H]/dT */
     J[1592] += dqdT; /* dwdot[C3H4]/dT */
     J[1593] -= dqdT; /* dwdot[C3H3]/dT */
@@ -15869,8 +16047,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[2]*sc[32];
-    k_f = prefactor_units[8] * fwd_A[8]
-                * exp(fwd_beta[8] * tc[0] - activation_units[8] * fwd_Ea[8] * invT);
+    k_f = k_f_s[8];
     dlnkfdT = fwd_beta[8] * invT + activation_units[8] * fwd_Ea[8] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[8] * exp(low_beta[8] * tc[0] - activation_units[8] * low_Ea[8] * invT);
@@ -15886,16 +16063,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[8] == 4 ? exp(-troe_Tss[8] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[8]) > 1.e-100 ? -Fcent1/troe_Tsss[8] : 0.)
+      + (fabs(troe_Ts[8]) > 1.e-100 ? -Fcent2/troe_Ts[8] : 0.)
+      + (troe_len[8] == 4 ? Fcent3*troe_Tss[8]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[8]) > 1.e-100 ? -Fcent1/troe_Tsss[8] : 0.)
-      + (fabs(troe_Ts[8]) > 1.e-100 ? -Fcent2/troe_Ts[8] : 0.)
-      + (troe_len[8] == 4 ? Fcent3*troe_Tss[8]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -15903,7 +16080,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[34];
-    Kc = refCinv * exp(g_RT[2] + g_RT[32] - g_RT[34]);
+    Kc = Kc_s[8];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[32]) + (h_RT[34]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -15921,69 +16098,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[32];
-        J[82] -= dqdci;               /* dwdot[H]/d[H] */
-        J[112] -= dqdci;              /* dwdot[C3H4]/d[H] */
-        J[114] += dqdci;              /* dwdot[C3H5]/d[H] */
-        /* d()/d[C3H4] */
-        dqdci =  + k_f*sc[2];
-        J[1282] -= dqdci;             /* dwdot[H]/d[C3H4] */
-        J[1312] -= dqdci;             /* dwdot[C3H4]/d[C3H4] */
-        J[1314] += dqdci;             /* dwdot[C3H5]/d[C3H4] */
-        /* d()/d[C3H5] */
-        dqdci =  - k_r;
-        J[1362] -= dqdci;             /* dwdot[H]/d[C3H5] */
-        J[1392] -= dqdci;             /* dwdot[C3H4]/d[C3H5] */
-        J[1394] += dqdci;             /* dwdot[C3H5]/d[C3H5] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*sc[32];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac + k_f*sc[2];
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac - k_r;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+2] -= dqdc[k];
-            J[40*k+32] -= dqdc[k];
-            J[40*k+34] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] -= dcdc_fac;
+    Jmix[32] -= dcdc_fac;
+    Jmix[34] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[32];
+    J[82] -= dqdci;               /* dwdot[H]/d[H] */
+    J[112] -= dqdci;              /* dwdot[C3H4]/d[H] */
+    J[114] += dqdci;              /* dwdot[C3H5]/d[H] */
+    /* d()/d[C3H4] */
+    dqdci =  + k_f*sc[2];
+    J[1282] -= dqdci;             /* dwdot[H]/d[C3H4] */
+    J[1312] -= dqdci;             /* dwdot[C3H4]/d[C3H4] */
+    J[1314] += dqdci;             /* dwdot[C3H5]/d[C3H4] */
+    /* d()/d[C3H5] */
+    dqdci =  - k_r;
+    J[1362] -= dqdci;             /* dwdot[H]/d[C3H5] */
+    J[1392] -= dqdci;             /* dwdot[C3H4]/d[C3H5] */
+    J[1394] += dqdci;             /* dwdot[C3H5]/d[C3H5] */
     J[1562] -= dqdT; /* dwdot[H]/dT */
     J[1592] -= dqdT; /* dwdot[C3H4]/dT */
     J[1594] += dqdT; /* dwdot[C3H5]/dT */
@@ -15995,11 +16128,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[15]*sc[23];
-    k_f = prefactor_units[9] * fwd_A[9]
-                * exp(fwd_beta[9] * tc[0] - activation_units[9] * fwd_Ea[9] * invT);
+    k_f = k_f_s[9];
     dlnkfdT = fwd_beta[9] * invT + activation_units[9] * fwd_Ea[9] * invT2;
     /* pressure-fall-off */
-    k_0 = low_A[9] * exp(low_beta[9] * tc[0] - activation_units[9] * low_Ea[9] * invT);
+    x_0 = low_beta[9] * tc[0] - activation_units[9] * low_Ea[9] * invT;
+    k_0 = low_A[9] * (x_0 == x_0_s[0] ? e_0_s[0] : exp(x_0));
     Pr = phase_units[9] * alpha / k_f * k_0;
     fPr = Pr / (1.0+Pr);
     dlnk0dT = low_beta[9] * invT + activation_units[9] * low_Ea[9] * invT2;
@@ -16007,21 +16140,28 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogfPrdT = dlogPrdT / (1.0+Pr);
     /* Troe form */
     logPr = log10(Pr);
-    Fcent1 = (fabs(troe_Tsss[9]) > 1.e-100 ? (1.-troe_a[9])*exp(-T/troe_Tsss[9]) : 0.);
-    Fcent2 = (fabs(troe_Ts[9]) > 1.e-100 ? troe_a[9] * exp(-T/troe_Ts[9]) : 0.);
-    Fcent3 = (troe_len[9] == 4 ? exp(-troe_Tss[9] * invT) : 0.);
-    Fcent = Fcent1 + Fcent2 + Fcent3;
-    logFcent = log10(Fcent);
+    if (troe_a[9] == troe_a[7] && troe_Tsss[9] == troe_Tsss[7] && troe_Ts[9] == troe_Ts[7]
+        && troe_Tss[9] == troe_Tss[7] && troe_len[9] == troe_len[7]) {
+        logFcent = logFcent_s[0];
+        dlogFcentdT = dlogFcentdT_s[0];
+    }
+    else {
+        Fcent1 = (fabs(troe_Tsss[9]) > 1.e-100 ? (1.-troe_a[9])*exp(-T/troe_Tsss[9]) : 0.);
+        Fcent2 = (fabs(troe_Ts[9]) > 1.e-100 ? troe_a[9] * exp(-T/troe_Ts[9]) : 0.);
+        Fcent3 = (troe_len[9] == 4 ? exp(-troe_Tss[9] * invT) : 0.);
+        Fcent = Fcent1 + Fcent2 + Fcent3;
+        logFcent = log10(Fcent);
+        dlogFcentdT = log10e/Fcent*( 
+            (fabs(troe_Tsss[9]) > 1.e-100 ? -Fcent1/troe_Tsss[9] : 0.)
+          + (fabs(troe_Ts[9]) > 1.e-100 ? -Fcent2/troe_Ts[9] : 0.)
+          + (troe_len[9] == 4 ? Fcent3*troe_Tss[9]*invT2 : 0.) );
+    }
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[9]) > 1.e-100 ? -Fcent1/troe_Tsss[9] : 0.)
-      + (fabs(troe_Ts[9]) > 1.e-100 ? -Fcent2/troe_Ts[9] : 0.)
-      + (troe_len[9] == 4 ? Fcent3*troe_Tss[9]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -16029,7 +16169,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[34];
-    Kc = refCinv * exp(g_RT[15] + g_RT[23] - g_RT[34]);
+    Kc = Kc_s[9];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[15] + h_RT[23]) + (h_RT[34]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -16047,69 +16187,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[23];
-        J[615] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[623] -= dqdci;              /* dwdot[C2H2]/d[CH3] */
-        J[634] += dqdci;              /* dwdot[C3H5]/d[CH3] */
-        /* d()/d[C2H2] */
-        dqdci =  + k_f*sc[15];
-        J[935] -= dqdci;              /* dwdot[CH3]/d[C2H2] */
-        J[943] -= dqdci;              /* dwdot[C2H2]/d[C2H2] */
-        J[954] += dqdci;              /* dwdot[C3H5]/d[C2H2] */
-        /* d()/d[C3H5] */
-        dqdci =  - k_r;
-        J[1375] -= dqdci;             /* dwdot[CH3]/d[C3H5] */
-        J[1383] -= dqdci;             /* dwdot[C2H2]/d[C3H5] */
-        J[1394] += dqdci;             /* dwdot[C3H5]/d[C3H5] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac + k_f*sc[23];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac + k_f*sc[15];
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac - k_r;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+15] -= dqdc[k];
-            J[40*k+23] -= dqdc[k];
-            J[40*k+34] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[15] -= dcdc_fac;
+    Jmix[23] -= dcdc_fac;
+    Jmix[34] += dcdc_fac;
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[23];
+    J[615] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[623] -= dqdci;              /* dwdot[C2H2]/d[CH3] */
+    J[634] += dqdci;              /* dwdot[C3H5]/d[CH3] */
+    /* d()/d[C2H2] */
+    dqdci =  + k_f*sc[15];
+    J[935] -= dqdci;              /* dwdot[CH3]/d[C2H2] */
+    J[943] -= dqdci;              /* dwdot[C2H2]/d[C2H2] */
+    J[954] += dqdci;              /* dwdot[C3H5]/d[C2H2] */
+    /* d()/d[C3H5] */
+    dqdci =  - k_r;
+    J[1375] -= dqdci;             /* dwdot[CH3]/d[C3H5] */
+    J[1383] -= dqdci;             /* dwdot[C2H2]/d[C3H5] */
+    J[1394] += dqdci;             /* dwdot[C3H5]/d[C3H5] */
     J[1575] -= dqdT; /* dwdot[CH3]/dT */
     J[1583] -= dqdT; /* dwdot[C2H2]/dT */
     J[1594] += dqdT; /* dwdot[C3H5]/dT */
@@ -16118,11 +16214,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[10][0] - 1)*sc[1] + (TB[10][1] - 1)*sc[6] + (TB[10][2] - 1)*sc[7] + (TB[10][3] - 1)*sc[10] + (TB[10][4] - 1)*sc[11] + (TB[10][5] - 1)*sc[14] + (TB[10][6] - 1)*sc[21];
+    alpha = (memcmp(TB[10], TB[1], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[10][0] - 1)*sc[1] + (TB[10][1] - 1)*sc[6] + (TB[10][2] - 1)*sc[7] + (TB[10][3] - 1)*sc[10] + (TB[10][4] - 1)*sc[11] + (TB[10][5] - 1)*sc[14] + (TB[10][6] - 1)*sc[21]);
     /* forward */
     phi_f = sc[2]*sc[34];
-    k_f = prefactor_units[10] * fwd_A[10]
-                * exp(fwd_beta[10] * tc[0] - activation_units[10] * fwd_Ea[10] * invT);
+    k_f = k_f_s[10];
     dlnkfdT = fwd_beta[10] * invT + activation_units[10] * fwd_Ea[10] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[10] * exp(low_beta[10] * tc[0] - activation_units[10] * low_Ea[10] * invT);
@@ -16138,16 +16233,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[10] == 4 ? exp(-troe_Tss[10] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[10]) > 1.e-100 ? -Fcent1/troe_Tsss[10] : 0.)
+      + (fabs(troe_Ts[10]) > 1.e-100 ? -Fcent2/troe_Ts[10] : 0.)
+      + (troe_len[10] == 4 ? Fcent3*troe_Tss[10]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[10]) > 1.e-100 ? -Fcent1/troe_Tsss[10] : 0.)
-      + (fabs(troe_Ts[10]) > 1.e-100 ? -Fcent2/troe_Ts[10] : 0.)
-      + (troe_len[10] == 4 ? Fcent3*troe_Tss[10]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -16155,7 +16250,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[35];
-    Kc = refCinv * exp(g_RT[2] + g_RT[34] - g_RT[35]);
+    Kc = Kc_s[10];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[34]) + (h_RT[35]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -16173,104 +16268,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[10][0] - 1)*dcdc_fac;
-        J[42] -= dqdci;               /* dwdot[H]/d[AR] */
-        J[74] -= dqdci;               /* dwdot[C3H5]/d[AR] */
-        J[75] += dqdci;               /* dwdot[C3H6]/d[AR] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[34];
-        J[82] -= dqdci;               /* dwdot[H]/d[H] */
-        J[114] -= dqdci;              /* dwdot[C3H5]/d[H] */
-        J[115] += dqdci;              /* dwdot[C3H6]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[10][1] - 1)*dcdc_fac;
-        J[242] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[274] -= dqdci;              /* dwdot[C3H5]/d[H2] */
-        J[275] += dqdci;              /* dwdot[C3H6]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[10][2] - 1)*dcdc_fac;
-        J[282] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[314] -= dqdci;              /* dwdot[C3H5]/d[H2O] */
-        J[315] += dqdci;              /* dwdot[C3H6]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[10][3] - 1)*dcdc_fac;
-        J[402] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[434] -= dqdci;              /* dwdot[C3H5]/d[CO] */
-        J[435] += dqdci;              /* dwdot[C3H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[10][4] - 1)*dcdc_fac;
-        J[442] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[474] -= dqdci;              /* dwdot[C3H5]/d[CO2] */
-        J[475] += dqdci;              /* dwdot[C3H6]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[10][5] - 1)*dcdc_fac;
-        J[562] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[594] -= dqdci;              /* dwdot[C3H5]/d[CH4] */
-        J[595] += dqdci;              /* dwdot[C3H6]/d[CH4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[10][6] - 1)*dcdc_fac;
-        J[842] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[874] -= dqdci;              /* dwdot[C3H5]/d[C2H6] */
-        J[875] += dqdci;              /* dwdot[C3H6]/d[C2H6] */
-        /* d()/d[C3H5] */
-        dqdci =  + k_f*sc[2];
-        J[1362] -= dqdci;             /* dwdot[H]/d[C3H5] */
-        J[1394] -= dqdci;             /* dwdot[C3H5]/d[C3H5] */
-        J[1395] += dqdci;             /* dwdot[C3H6]/d[C3H5] */
-        /* d()/d[C3H6] */
-        dqdci =  - k_r;
-        J[1402] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[1434] -= dqdci;             /* dwdot[C3H5]/d[C3H6] */
-        J[1435] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[10][0]*dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*sc[34];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = TB[10][1]*dcdc_fac;
-        dqdc[7] = TB[10][2]*dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = TB[10][3]*dcdc_fac;
-        dqdc[11] = TB[10][4]*dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = TB[10][5]*dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[10][6]*dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac + k_f*sc[2];
-        dqdc[35] = dcdc_fac - k_r;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+2] -= dqdc[k];
-            J[40*k+34] -= dqdc[k];
-            J[40*k+35] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] -= dcdc_fac;
+    Jmix[34] -= dcdc_fac;
+    Jmix[35] += dcdc_fac;
+    /* d()/d[AR] */
+    dqdci = (TB[10][0] - 1)*dcdc_fac;
+    J[42] -= dqdci;               /* dwdot[H]/d[AR] */
+    J[74] -= dqdci;               /* dwdot[C3H5]/d[AR] */
+    J[75] += dqdci;               /* dwdot[C3H6]/d[AR] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[34];
+    J[82] -= dqdci;               /* dwdot[H]/d[H] */
+    J[114] -= dqdci;              /* dwdot[C3H5]/d[H] */
+    J[115] += dqdci;              /* dwdot[C3H6]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[10][1] - 1)*dcdc_fac;
+    J[242] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[274] -= dqdci;              /* dwdot[C3H5]/d[H2] */
+    J[275] += dqdci;              /* dwdot[C3H6]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[10][2] - 1)*dcdc_fac;
+    J[282] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[314] -= dqdci;              /* dwdot[C3H5]/d[H2O] */
+    J[315] += dqdci;              /* dwdot[C3H6]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[10][3] - 1)*dcdc_fac;
+    J[402] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[434] -= dqdci;              /* dwdot[C3H5]/d[CO] */
+    J[435] += dqdci;              /* dwdot[C3H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[10][4] - 1)*dcdc_fac;
+    J[442] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[474] -= dqdci;              /* dwdot[C3H5]/d[CO2] */
+    J[475] += dqdci;              /* dwdot[C3H6]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[10][5] - 1)*dcdc_fac;
+    J[562] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[594] -= dqdci;              /* dwdot[C3H5]/d[CH4] */
+    J[595] += dqdci;              /* dwdot[C3H6]/d[CH4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[10][6] - 1)*dcdc_fac;
+    J[842] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[874] -= dqdci;              /* dwdot[C3H5]/d[C2H6] */
+    J[875] += dqdci;              /* dwdot[C3H6]/d[C2H6] */
+    /* d()/d[C3H5] */
+    dqdci =  + k_f*sc[2];
+    J[1362] -= dqdci;             /* dwdot[H]/d[C3H5] */
+    J[1394] -= dqdci;             /* dwdot[C3H5]/d[C3H5] */
+    J[1395] += dqdci;             /* dwdot[C3H6]/d[C3H5] */
+    /* d()/d[C3H6] */
+    dqdci =  - k_r;
+    J[1402] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[1434] -= dqdci;             /* dwdot[C3H5]/d[C3H6] */
+    J[1435] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
     J[1562] -= dqdT; /* dwdot[H]/dT */
     J[1594] -= dqdT; /* dwdot[C3H5]/dT */
     J[1595] += dqdT; /* dwdot[C3H6]/dT */
@@ -16279,11 +16330,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[11][0] - 1)*sc[1] + (TB[11][1] - 1)*sc[6] + (TB[11][2] - 1)*sc[7] + (TB[11][3] - 1)*sc[10] + (TB[11][4] - 1)*sc[11] + (TB[11][5] - 1)*sc[14] + (TB[11][6] - 1)*sc[21];
+    alpha = (memcmp(TB[11], TB[1], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[11][0] - 1)*sc[1] + (TB[11][1] - 1)*sc[6] + (TB[11][2] - 1)*sc[7] + (TB[11][3] - 1)*sc[10] + (TB[11][4] - 1)*sc[11] + (TB[11][5] - 1)*sc[14] + (TB[11][6] - 1)*sc[21]);
     /* forward */
     phi_f = sc[15]*sc[24];
-    k_f = prefactor_units[11] * fwd_A[11]
-                * exp(fwd_beta[11] * tc[0] - activation_units[11] * fwd_Ea[11] * invT);
+    k_f = k_f_s[11];
     dlnkfdT = fwd_beta[11] * invT + activation_units[11] * fwd_Ea[11] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[11] * exp(low_beta[11] * tc[0] - activation_units[11] * low_Ea[11] * invT);
@@ -16299,16 +16349,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[11] == 4 ? exp(-troe_Tss[11] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[11]) > 1.e-100 ? -Fcent1/troe_Tsss[11] : 0.)
+      + (fabs(troe_Ts[11]) > 1.e-100 ? -Fcent2/troe_Ts[11] : 0.)
+      + (troe_len[11] == 4 ? Fcent3*troe_Tss[11]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[11]) > 1.e-100 ? -Fcent1/troe_Tsss[11] : 0.)
-      + (fabs(troe_Ts[11]) > 1.e-100 ? -Fcent2/troe_Ts[11] : 0.)
-      + (troe_len[11] == 4 ? Fcent3*troe_Tss[11]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -16316,7 +16366,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[35];
-    Kc = refCinv * exp(g_RT[15] + g_RT[24] - g_RT[35]);
+    Kc = Kc_s[11];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[15] + h_RT[24]) + (h_RT[35]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -16334,104 +16384,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[11][0] - 1)*dcdc_fac;
-        J[55] -= dqdci;               /* dwdot[CH3]/d[AR] */
-        J[64] -= dqdci;               /* dwdot[C2H3]/d[AR] */
-        J[75] += dqdci;               /* dwdot[C3H6]/d[AR] */
-        /* d()/d[H2] */
-        dqdci = (TB[11][1] - 1)*dcdc_fac;
-        J[255] -= dqdci;              /* dwdot[CH3]/d[H2] */
-        J[264] -= dqdci;              /* dwdot[C2H3]/d[H2] */
-        J[275] += dqdci;              /* dwdot[C3H6]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[11][2] - 1)*dcdc_fac;
-        J[295] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[304] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
-        J[315] += dqdci;              /* dwdot[C3H6]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[11][3] - 1)*dcdc_fac;
-        J[415] -= dqdci;              /* dwdot[CH3]/d[CO] */
-        J[424] -= dqdci;              /* dwdot[C2H3]/d[CO] */
-        J[435] += dqdci;              /* dwdot[C3H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[11][4] - 1)*dcdc_fac;
-        J[455] -= dqdci;              /* dwdot[CH3]/d[CO2] */
-        J[464] -= dqdci;              /* dwdot[C2H3]/d[CO2] */
-        J[475] += dqdci;              /* dwdot[C3H6]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[11][5] - 1)*dcdc_fac;
-        J[575] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[584] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
-        J[595] += dqdci;              /* dwdot[C3H6]/d[CH4] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[24];
-        J[615] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[624] -= dqdci;              /* dwdot[C2H3]/d[CH3] */
-        J[635] += dqdci;              /* dwdot[C3H6]/d[CH3] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[11][6] - 1)*dcdc_fac;
-        J[855] -= dqdci;              /* dwdot[CH3]/d[C2H6] */
-        J[864] -= dqdci;              /* dwdot[C2H3]/d[C2H6] */
-        J[875] += dqdci;              /* dwdot[C3H6]/d[C2H6] */
-        /* d()/d[C2H3] */
-        dqdci =  + k_f*sc[15];
-        J[975] -= dqdci;              /* dwdot[CH3]/d[C2H3] */
-        J[984] -= dqdci;              /* dwdot[C2H3]/d[C2H3] */
-        J[995] += dqdci;              /* dwdot[C3H6]/d[C2H3] */
-        /* d()/d[C3H6] */
-        dqdci =  - k_r;
-        J[1415] -= dqdci;             /* dwdot[CH3]/d[C3H6] */
-        J[1424] -= dqdci;             /* dwdot[C2H3]/d[C3H6] */
-        J[1435] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[11][0]*dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = TB[11][1]*dcdc_fac;
-        dqdc[7] = TB[11][2]*dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = TB[11][3]*dcdc_fac;
-        dqdc[11] = TB[11][4]*dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = TB[11][5]*dcdc_fac;
-        dqdc[15] = dcdc_fac + k_f*sc[24];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[11][6]*dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac + k_f*sc[15];
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac - k_r;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+15] -= dqdc[k];
-            J[40*k+24] -= dqdc[k];
-            J[40*k+35] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[15] -= dcdc_fac;
+    Jmix[24] -= dcdc_fac;
+    Jmix[35] += dcdc_fac;
+    /* d()/d[AR] */
+    dqdci = (TB[11][0] - 1)*dcdc_fac;
+    J[55] -= dqdci;               /* dwdot[CH3]/d[AR] */
+    J[64] -= dqdci;               /* dwdot[C2H3]/d[AR] */
+    J[75] += dqdci;               /* dwdot[C3H6]/d[AR] */
+    /* d()/d[H2] */
+    dqdci = (TB[11][1] - 1)*dcdc_fac;
+    J[255] -= dqdci;              /* dwdot[CH3]/d[H2] */
+    J[264] -= dqdci;              /* dwdot[C2H3]/d[H2] */
+    J[275] += dqdci;              /* dwdot[C3H6]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[11][2] - 1)*dcdc_fac;
+    J[295] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[304] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
+    J[315] += dqdci;              /* dwdot[C3H6]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[11][3] - 1)*dcdc_fac;
+    J[415] -= dqdci;              /* dwdot[CH3]/d[CO] */
+    J[424] -= dqdci;              /* dwdot[C2H3]/d[CO] */
+    J[435] += dqdci;              /* dwdot[C3H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[11][4] - 1)*dcdc_fac;
+    J[455] -= dqdci;              /* dwdot[CH3]/d[CO2] */
+    J[464] -= dqdci;              /* dwdot[C2H3]/d[CO2] */
+    J[475] += dqdci;              /* dwdot[C3H6]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[11][5] - 1)*dcdc_fac;
+    J[575] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[584] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
+    J[595] += dqdci;              /* dwdot[C3H6]/d[CH4] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[24];
+    J[615] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[624] -= dqdci;              /* dwdot[C2H3]/d[CH3] */
+    J[635] += dqdci;              /* dwdot[C3H6]/d[CH3] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[11][6] - 1)*dcdc_fac;
+    J[855] -= dqdci;              /* dwdot[CH3]/d[C2H6] */
+    J[864] -= dqdci;              /* dwdot[C2H3]/d[C2H6] */
+    J[875] += dqdci;              /* dwdot[C3H6]/d[C2H6] */
+    /* d()/d[C2H3] */
+    dqdci =  + k_f*sc[15];
+    J[975] -= dqdci;              /* dwdot[CH3]/d[C2H3] */
+    J[984] -= dqdci;              /* dwdot[C2H3]/d[C2H3] */
+    J[995] += dqdci;              /* dwdot[C3H6]/d[C2H3] */
+    /* d()/d[C3H6] */
+    dqdci =  - k_r;
+    J[1415] -= dqdci;             /* dwdot[CH3]/d[C3H6] */
+    J[1424] -= dqdci;             /* dwdot[C2H3]/d[C3H6] */
+    J[1435] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
     J[1575] -= dqdT; /* dwdot[CH3]/dT */
     J[1584] -= dqdT; /* dwdot[C2H3]/dT */
     J[1595] += dqdT; /* dwdot[C3H6]/dT */
@@ -16443,8 +16449,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[36];
-    k_f = prefactor_units[12] * fwd_A[12]
-                * exp(fwd_beta[12] * tc[0] - activation_units[12] * fwd_Ea[12] * invT);
+    k_f = k_f_s[12];
     dlnkfdT = fwd_beta[12] * invT + activation_units[12] * fwd_Ea[12] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[12] * exp(low_beta[12] * tc[0] - activation_units[12] * low_Ea[12] * invT);
@@ -16460,16 +16465,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[12] == 4 ? exp(-troe_Tss[12] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[12]) > 1.e-100 ? -Fcent1/troe_Tsss[12] : 0.)
+      + (fabs(troe_Ts[12]) > 1.e-100 ? -Fcent2/troe_Ts[12] : 0.)
+      + (troe_len[12] == 4 ? Fcent3*troe_Tss[12]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[12]) > 1.e-100 ? -Fcent1/troe_Tsss[12] : 0.)
-      + (fabs(troe_Ts[12]) > 1.e-100 ? -Fcent2/troe_Ts[12] : 0.)
-      + (troe_len[12] == 4 ? Fcent3*troe_Tss[12]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -16477,7 +16482,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[15]*sc[20];
-    Kc = refC * exp(-g_RT[15] - g_RT[20] + g_RT[36]);
+    Kc = Kc_s[12];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[36]) + (h_RT[15] + h_RT[20]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -16495,69 +16500,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[CH3] */
-        dqdci =  - k_r*sc[20];
-        J[615] += dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[620] += dqdci;              /* dwdot[C2H5]/d[CH3] */
-        J[636] -= dqdci;              /* dwdot[C3H8]/d[CH3] */
-        /* d()/d[C2H5] */
-        dqdci =  - k_r*sc[15];
-        J[815] += dqdci;              /* dwdot[CH3]/d[C2H5] */
-        J[820] += dqdci;              /* dwdot[C2H5]/d[C2H5] */
-        J[836] -= dqdci;              /* dwdot[C3H8]/d[C2H5] */
-        /* d()/d[C3H8] */
-        dqdci =  + k_f;
-        J[1455] += dqdci;             /* dwdot[CH3]/d[C3H8] */
-        J[1460] += dqdci;             /* dwdot[C2H5]/d[C3H8] */
-        J[1476] -= dqdci;             /* dwdot[C3H8]/d[C3H8] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac - k_r*sc[20];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac - k_r*sc[15];
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac + k_f;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+15] += dqdc[k];
-            J[40*k+20] += dqdc[k];
-            J[40*k+36] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[15] += dcdc_fac;
+    Jmix[20] += dcdc_fac;
+    Jmix[36] -= dcdc_fac;
+    /* d()/d[CH3] */
+    dqdci =  - k_r*sc[20];
+    J[615] += dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[620] += dqdci;              /* dwdot[C2H5]/d[CH3] */
+    J[636] -= dqdci;              /* dwdot[C3H8]/d[CH3] */
+    /* d()/d[C2H5] */
+    dqdci =  - k_r*sc[15];
+    J[815] += dqdci;              /* dwdot[CH3]/d[C2H5] */
+    J[820] += dqdci;              /* dwdot[C2H5]/d[C2H5] */
+    J[836] -= dqdci;              /* dwdot[C3H8]/d[C2H5] */
+    /* d()/d[C3H8] */
+    dqdci =  + k_f;
+    J[1455] += dqdci;             /* dwdot[CH3]/d[C3H8] */
+    J[1460] += dqdci;             /* dwdot[C2H5]/d[C3H8] */
+    J[1476] -= dqdci;             /* dwdot[C3H8]/d[C3H8] */
     J[1575] += dqdT; /* dwdot[CH3]/dT */
     J[1580] += dqdT; /* dwdot[C2H5]/dT */
     J[1596] -= dqdT; /* dwdot[C3H8]/dT */
@@ -16566,11 +16527,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[13][0] - 1)*sc[1] + (TB[13][1] - 1)*sc[6] + (TB[13][2] - 1)*sc[7] + (TB[13][3] - 1)*sc[10] + (TB[13][4] - 1)*sc[11] + (TB[13][5] - 1)*sc[14] + (TB[13][6] - 1)*sc[21];
+    alpha = (memcmp(TB[13], TB[1], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[13][0] - 1)*sc[1] + (TB[13][1] - 1)*sc[6] + (TB[13][2] - 1)*sc[7] + (TB[13][3] - 1)*sc[10] + (TB[13][4] - 1)*sc[11] + (TB[13][5] - 1)*sc[14] + (TB[13][6] - 1)*sc[21]);
     /* forward */
     phi_f = sc[2]*sc[35];
-    k_f = prefactor_units[13] * fwd_A[13]
-                * exp(fwd_beta[13] * tc[0] - activation_units[13] * fwd_Ea[13] * invT);
+    k_f = k_f_s[13];
     dlnkfdT = fwd_beta[13] * invT + activation_units[13] * fwd_Ea[13] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[13] * exp(low_beta[13] * tc[0] - activation_units[13] * low_Ea[13] * invT);
@@ -16586,16 +16546,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[13] == 4 ? exp(-troe_Tss[13] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[13]) > 1.e-100 ? -Fcent1/troe_Tsss[13] : 0.)
+      + (fabs(troe_Ts[13]) > 1.e-100 ? -Fcent2/troe_Ts[13] : 0.)
+      + (troe_len[13] == 4 ? Fcent3*troe_Tss[13]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[13]) > 1.e-100 ? -Fcent1/troe_Tsss[13] : 0.)
-      + (fabs(troe_Ts[13]) > 1.e-100 ? -Fcent2/troe_Ts[13] : 0.)
-      + (troe_len[13] == 4 ? Fcent3*troe_Tss[13]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -16603,7 +16563,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[37];
-    Kc = refCinv * exp(g_RT[2] + g_RT[35] - g_RT[37]);
+    Kc = Kc_s[13];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[35]) + (h_RT[37]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -16621,104 +16581,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[13][0] - 1)*dcdc_fac;
-        J[42] -= dqdci;               /* dwdot[H]/d[AR] */
-        J[75] -= dqdci;               /* dwdot[C3H6]/d[AR] */
-        J[77] += dqdci;               /* dwdot[I-C3H7]/d[AR] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[35];
-        J[82] -= dqdci;               /* dwdot[H]/d[H] */
-        J[115] -= dqdci;              /* dwdot[C3H6]/d[H] */
-        J[117] += dqdci;              /* dwdot[I-C3H7]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[13][1] - 1)*dcdc_fac;
-        J[242] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[275] -= dqdci;              /* dwdot[C3H6]/d[H2] */
-        J[277] += dqdci;              /* dwdot[I-C3H7]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[13][2] - 1)*dcdc_fac;
-        J[282] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[315] -= dqdci;              /* dwdot[C3H6]/d[H2O] */
-        J[317] += dqdci;              /* dwdot[I-C3H7]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[13][3] - 1)*dcdc_fac;
-        J[402] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[435] -= dqdci;              /* dwdot[C3H6]/d[CO] */
-        J[437] += dqdci;              /* dwdot[I-C3H7]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[13][4] - 1)*dcdc_fac;
-        J[442] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[475] -= dqdci;              /* dwdot[C3H6]/d[CO2] */
-        J[477] += dqdci;              /* dwdot[I-C3H7]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[13][5] - 1)*dcdc_fac;
-        J[562] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[595] -= dqdci;              /* dwdot[C3H6]/d[CH4] */
-        J[597] += dqdci;              /* dwdot[I-C3H7]/d[CH4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[13][6] - 1)*dcdc_fac;
-        J[842] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[875] -= dqdci;              /* dwdot[C3H6]/d[C2H6] */
-        J[877] += dqdci;              /* dwdot[I-C3H7]/d[C2H6] */
-        /* d()/d[C3H6] */
-        dqdci =  + k_f*sc[2];
-        J[1402] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[1435] -= dqdci;             /* dwdot[C3H6]/d[C3H6] */
-        J[1437] += dqdci;             /* dwdot[I-C3H7]/d[C3H6] */
-        /* d()/d[I-C3H7] */
-        dqdci =  - k_r;
-        J[1482] -= dqdci;             /* dwdot[H]/d[I-C3H7] */
-        J[1515] -= dqdci;             /* dwdot[C3H6]/d[I-C3H7] */
-        J[1517] += dqdci;             /* dwdot[I-C3H7]/d[I-C3H7] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[13][0]*dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*sc[35];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = TB[13][1]*dcdc_fac;
-        dqdc[7] = TB[13][2]*dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = TB[13][3]*dcdc_fac;
-        dqdc[11] = TB[13][4]*dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = TB[13][5]*dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[13][6]*dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac + k_f*sc[2];
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac - k_r;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+2] -= dqdc[k];
-            J[40*k+35] -= dqdc[k];
-            J[40*k+37] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] -= dcdc_fac;
+    Jmix[35] -= dcdc_fac;
+    Jmix[37] += dcdc_fac;
+    /* d()/d[AR] */
+    dqdci = (TB[13][0] - 1)*dcdc_fac;
+    J[42] -= dqdci;               /* dwdot[H]/d[AR] */
+    J[75] -= dqdci;               /* dwdot[C3H6]/d[AR] */
+    J[77] += dqdci;               /* dwdot[I-C3H7]/d[AR] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[35];
+    J[82] -= dqdci;               /* dwdot[H]/d[H] */
+    J[115] -= dqdci;              /* dwdot[C3H6]/d[H] */
+    J[117] += dqdci;              /* dwdot[I-C3H7]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[13][1] - 1)*dcdc_fac;
+    J[242] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[275] -= dqdci;              /* dwdot[C3H6]/d[H2] */
+    J[277] += dqdci;              /* dwdot[I-C3H7]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[13][2] - 1)*dcdc_fac;
+    J[282] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[315] -= dqdci;              /* dwdot[C3H6]/d[H2O] */
+    J[317] += dqdci;              /* dwdot[I-C3H7]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[13][3] - 1)*dcdc_fac;
+    J[402] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[435] -= dqdci;              /* dwdot[C3H6]/d[CO] */
+    J[437] += dqdci;              /* dwdot[I-C3H7]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[13][4] - 1)*dcdc_fac;
+    J[442] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[475] -= dqdci;              /* dwdot[C3H6]/d[CO2] */
+    J[477] += dqdci;              /* dwdot[I-C3H7]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[13][5] - 1)*dcdc_fac;
+    J[562] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[595] -= dqdci;              /* dwdot[C3H6]/d[CH4] */
+    J[597] += dqdci;              /* dwdot[I-C3H7]/d[CH4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[13][6] - 1)*dcdc_fac;
+    J[842] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[875] -= dqdci;              /* dwdot[C3H6]/d[C2H6] */
+    J[877] += dqdci;              /* dwdot[I-C3H7]/d[C2H6] */
+    /* d()/d[C3H6] */
+    dqdci =  + k_f*sc[2];
+    J[1402] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[1435] -= dqdci;             /* dwdot[C3H6]/d[C3H6] */
+    J[1437] += dqdci;             /* dwdot[I-C3H7]/d[C3H6] */
+    /* d()/d[I-C3H7] */
+    dqdci =  - k_r;
+    J[1482] -= dqdci;             /* dwdot[H]/d[I-C3H7] */
+    J[1515] -= dqdci;             /* dwdot[C3H6]/d[I-C3H7] */
+    J[1517] += dqdci;             /* dwdot[I-C3H7]/d[I-C3H7] */
     J[1562] -= dqdT; /* dwdot[H]/dT */
     J[1595] -= dqdT; /* dwdot[C3H6]/dT */
     J[1597] += dqdT; /* dwdot[I-C3H7]/dT */
@@ -16730,8 +16646,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[38];
-    k_f = prefactor_units[14] * fwd_A[14]
-                * exp(fwd_beta[14] * tc[0] - activation_units[14] * fwd_Ea[14] * invT);
+    k_f = k_f_s[14];
     dlnkfdT = fwd_beta[14] * invT + activation_units[14] * fwd_Ea[14] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[14] * exp(low_beta[14] * tc[0] - activation_units[14] * low_Ea[14] * invT);
@@ -16747,16 +16662,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[14] == 4 ? exp(-troe_Tss[14] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[14]) > 1.e-100 ? -Fcent1/troe_Tsss[14] : 0.)
+      + (fabs(troe_Ts[14]) > 1.e-100 ? -Fcent2/troe_Ts[14] : 0.)
+      + (troe_len[14] == 4 ? Fcent3*troe_Tss[14]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[14]) > 1.e-100 ? -Fcent1/troe_Tsss[14] : 0.)
-      + (fabs(troe_Ts[14]) > 1.e-100 ? -Fcent2/troe_Ts[14] : 0.)
-      + (troe_len[14] == 4 ? Fcent3*troe_Tss[14]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -16764,7 +16679,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[15]*sc[18];
-    Kc = refC * exp(-g_RT[15] - g_RT[18] + g_RT[38]);
+    Kc = Kc_s[14];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[38]) + (h_RT[15] + h_RT[18]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -16782,69 +16697,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[CH3] */
-        dqdci =  - k_r*sc[18];
-        J[615] += dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[618] += dqdci;              /* dwdot[C2H4]/d[CH3] */
-        J[638] -= dqdci;              /* dwdot[N-C3H7]/d[CH3] */
-        /* d()/d[C2H4] */
-        dqdci =  - k_r*sc[15];
-        J[735] += dqdci;              /* dwdot[CH3]/d[C2H4] */
-        J[738] += dqdci;              /* dwdot[C2H4]/d[C2H4] */
-        J[758] -= dqdci;              /* dwdot[N-C3H7]/d[C2H4] */
-        /* d()/d[N-C3H7] */
-        dqdci =  + k_f;
-        J[1535] += dqdci;             /* dwdot[CH3]/d[N-C3H7] */
-        J[1538] += dqdci;             /* dwdot[C2H4]/d[N-C3H7] */
-        J[1558] -= dqdci;             /* dwdot[N-C3H7]/d[N-C3H7] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac - k_r*sc[18];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac - k_r*sc[15];
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac + k_f;
-        for (int k=0; k<39; k++) {
-            J[40*k+15] += dqdc[k];
-            J[40*k+18] += dqdc[k];
-            J[40*k+38] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[15] += dcdc_fac;
+    Jmix[18] += dcdc_fac;
+    Jmix[38] -= dcdc_fac;
+    /* d()/d[CH3] */
+    dqdci =  - k_r*sc[18];
+    J[615] += dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[618] += dqdci;              /* dwdot[C2H4]/d[CH3] */
+    J[638] -= dqdci;              /* dwdot[N-C3H7]/d[CH3] */
+    /* d()/d[C2H4] */
+    dqdci =  - k_r*sc[15];
+    J[735] += dqdci;              /* dwdot[CH3]/d[C2H4] */
+    J[738] += dqdci;              /* dwdot[C2H4]/d[C2H4] */
+    J[758] -= dqdci;              /* dwdot[N-C3H7]/d[C2H4] */
+    /* d()/d[N-C3H7] */
+    dqdci =  + k_f;
+    J[1535] += dqdci;             /* dwdot[CH3]/d[N-C3H7] */
+    J[1538] += dqdci;             /* dwdot[C2H4]/d[N-C3H7] */
+    J[1558] -= dqdci;             /* dwdot[N-C3H7]/d[N-C3H7] */
     J[1575] += dqdT; /* dwdot[CH3]/dT */
     J[1578] += dqdT; /* dwdot[C2H4]/dT */
     J[1598] -= dqdT; /* dwdot[N-C3H7]/dT */
@@ -16853,11 +16724,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[15][0] - 1)*sc[1] + (TB[15][1] - 1)*sc[6] + (TB[15][2] - 1)*sc[7] + (TB[15][3] - 1)*sc[10] + (TB[15][4] - 1)*sc[11] + (TB[15][5] - 1)*sc[14] + (TB[15][6] - 1)*sc[21];
+    alpha = (memcmp(TB[15], TB[1], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[15][0] - 1)*sc[1] + (TB[15][1] - 1)*sc[6] + (TB[15][2] - 1)*sc[7] + (TB[15][3] - 1)*sc[10] + (TB[15][4] - 1)*sc[11] + (TB[15][5] - 1)*sc[14] + (TB[15][6] - 1)*sc[21]);
     /* forward */
     phi_f = sc[2]*sc[35];
-    k_f = prefactor_units[15] * fwd_A[15]
-                * exp(fwd_beta[15] * tc[0] - activation_units[15] * fwd_Ea[15] * invT);
+    k_f = k_f_s[15];
     dlnkfdT = fwd_beta[15] * invT + activation_units[15] * fwd_Ea[15] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[15] * exp(low_beta[15] * tc[0] - activation_units[15] * low_Ea[15] * invT);
@@ -16873,16 +16743,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[15] == 4 ? exp(-troe_Tss[15] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[15]) > 1.e-100 ? -Fcent1/troe_Tsss[15] : 0.)
+      + (fabs(troe_Ts[15]) > 1.e-100 ? -Fcent2/troe_Ts[15] : 0.)
+      + (troe_len[15] == 4 ? Fcent3*troe_Tss[15]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[15]) > 1.e-100 ? -Fcent1/troe_Tsss[15] : 0.)
-      + (fabs(troe_Ts[15]) > 1.e-100 ? -Fcent2/troe_Ts[15] : 0.)
-      + (troe_len[15] == 4 ? Fcent3*troe_Tss[15]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -16890,7 +16760,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[38];
-    Kc = refCinv * exp(g_RT[2] + g_RT[35] - g_RT[38]);
+    Kc = Kc_s[15];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[35]) + (h_RT[38]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -16908,104 +16778,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[15][0] - 1)*dcdc_fac;
-        J[42] -= dqdci;               /* dwdot[H]/d[AR] */
-        J[75] -= dqdci;               /* dwdot[C3H6]/d[AR] */
-        J[78] += dqdci;               /* dwdot[N-C3H7]/d[AR] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[35];
-        J[82] -= dqdci;               /* dwdot[H]/d[H] */
-        J[115] -= dqdci;              /* dwdot[C3H6]/d[H] */
-        J[118] += dqdci;              /* dwdot[N-C3H7]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[15][1] - 1)*dcdc_fac;
-        J[242] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[275] -= dqdci;              /* dwdot[C3H6]/d[H2] */
-        J[278] += dqdci;              /* dwdot[N-C3H7]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[15][2] - 1)*dcdc_fac;
-        J[282] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[315] -= dqdci;              /* dwdot[C3H6]/d[H2O] */
-        J[318] += dqdci;              /* dwdot[N-C3H7]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[15][3] - 1)*dcdc_fac;
-        J[402] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[435] -= dqdci;              /* dwdot[C3H6]/d[CO] */
-        J[438] += dqdci;              /* dwdot[N-C3H7]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[15][4] - 1)*dcdc_fac;
-        J[442] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[475] -= dqdci;              /* dwdot[C3H6]/d[CO2] */
-        J[478] += dqdci;              /* dwdot[N-C3H7]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[15][5] - 1)*dcdc_fac;
-        J[562] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[595] -= dqdci;              /* dwdot[C3H6]/d[CH4] */
-        J[598] += dqdci;              /* dwdot[N-C3H7]/d[CH4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[15][6] - 1)*dcdc_fac;
-        J[842] -= dqdci;              /* dwdot[H]/d[C2H6] */
-        J[875] -= dqdci;              /* dwdot[C3H6]/d[C2H6] */
-        J[878] += dqdci;              /* dwdot[N-C3H7]/d[C2H6] */
-        /* d()/d[C3H6] */
-        dqdci =  + k_f*sc[2];
-        J[1402] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[1435] -= dqdci;             /* dwdot[C3H6]/d[C3H6] */
-        J[1438] += dqdci;             /* dwdot[N-C3H7]/d[C3H6] */
-        /* d()/d[N-C3H7] */
-        dqdci =  - k_r;
-        J[1522] -= dqdci;             /* dwdot[H]/d[N-C3H7] */
-        J[1555] -= dqdci;             /* dwdot[C3H6]/d[N-C3H7] */
-        J[1558] += dqdci;             /* dwdot[N-C3H7]/d[N-C3H7] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[15][0]*dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*sc[35];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = TB[15][1]*dcdc_fac;
-        dqdc[7] = TB[15][2]*dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = TB[15][3]*dcdc_fac;
-        dqdc[11] = TB[15][4]*dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = TB[15][5]*dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = TB[15][6]*dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac + k_f*sc[2];
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac - k_r;
-        for (int k=0; k<39; k++) {
-            J[40*k+2] -= dqdc[k];
-            J[40*k+35] -= dqdc[k];
-            J[40*k+38] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] -= dcdc_fac;
+    Jmix[35] -= dcdc_fac;
+    Jmix[38] += dcdc_fac;
+    /* d()/d[AR] */
+    dqdci = (TB[15][0] - 1)*dcdc_fac;
+    J[42] -= dqdci;               /* dwdot[H]/d[AR] */
+    J[75] -= dqdci;               /* dwdot[C3H6]/d[AR] */
+    J[78] += dqdci;               /* dwdot[N-C3H7]/d[AR] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[35];
+    J[82] -= dqdci;               /* dwdot[H]/d[H] */
+    J[115] -= dqdci;              /* dwdot[C3H6]/d[H] */
+    J[118] += dqdci;              /* dwdot[N-C3H7]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[15][1] - 1)*dcdc_fac;
+    J[242] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[275] -= dqdci;              /* dwdot[C3H6]/d[H2] */
+    J[278] += dqdci;              /* dwdot[N-C3H7]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[15][2] - 1)*dcdc_fac;
+    J[282] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[315] -= dqdci;              /* dwdot[C3H6]/d[H2O] */
+    J[318] += dqdci;              /* dwdot[N-C3H7]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[15][3] - 1)*dcdc_fac;
+    J[402] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[435] -= dqdci;              /* dwdot[C3H6]/d[CO] */
+    J[438] += dqdci;              /* dwdot[N-C3H7]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[15][4] - 1)*dcdc_fac;
+    J[442] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[475] -= dqdci;              /* dwdot[C3H6]/d[CO2] */
+    J[478] += dqdci;              /* dwdot[N-C3H7]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[15][5] - 1)*dcdc_fac;
+    J[562] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[595] -= dqdci;              /* dwdot[C3H6]/d[CH4] */
+    J[598] += dqdci;              /* dwdot[N-C3H7]/d[CH4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[15][6] - 1)*dcdc_fac;
+    J[842] -= dqdci;              /* dwdot[H]/d[C2H6] */
+    J[875] -= dqdci;              /* dwdot[C3H6]/d[C2H6] */
+    J[878] += dqdci;              /* dwdot[N-C3H7]/d[C2H6] */
+    /* d()/d[C3H6] */
+    dqdci =  + k_f*sc[2];
+    J[1402] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[1435] -= dqdci;             /* dwdot[C3H6]/d[C3H6] */
+    J[1438] += dqdci;             /* dwdot[N-C3H7]/d[C3H6] */
+    /* d()/d[N-C3H7] */
+    dqdci =  - k_r;
+    J[1522] -= dqdci;             /* dwdot[H]/d[N-C3H7] */
+    J[1555] -= dqdci;             /* dwdot[C3H6]/d[N-C3H7] */
+    J[1558] += dqdci;             /* dwdot[N-C3H7]/d[N-C3H7] */
     J[1562] -= dqdT; /* dwdot[H]/dT */
     J[1595] -= dqdT; /* dwdot[C3H6]/dT */
     J[1598] += dqdT; /* dwdot[N-C3H7]/dT */
@@ -17013,15 +16839,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 17: H + O + M <=> OH + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[16][0] - 1)*sc[6] + (TB[16][1] - 1)*sc[7] + (TB[16][2] - 1)*sc[10] + (TB[16][3] - 1)*sc[11];
+    alpha = alpha_eff1;
     /* forward */
     phi_f = sc[2]*sc[5];
-    k_f = prefactor_units[16] * fwd_A[16]
-                * exp(fwd_beta[16] * tc[0] - activation_units[16] * fwd_Ea[16] * invT);
+    k_f = k_f_s[16];
     dlnkfdT = fwd_beta[16] * invT + activation_units[16] * fwd_Ea[16] * invT2;
     /* reverse */
     phi_r = sc[4];
-    Kc = refCinv * exp(g_RT[2] - g_RT[4] + g_RT[5]);
+    Kc = Kc_s[16];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[5]) + (h_RT[4]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -17036,89 +16861,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[5];
-        J[82] -= dqdci;               /* dwdot[H]/d[H] */
-        J[84] += dqdci;               /* dwdot[OH]/d[H] */
-        J[85] -= dqdci;               /* dwdot[O]/d[H] */
-        /* d()/d[OH] */
-        dqdci =  - k_r;
-        J[162] -= dqdci;              /* dwdot[H]/d[OH] */
-        J[164] += dqdci;              /* dwdot[OH]/d[OH] */
-        J[165] -= dqdci;              /* dwdot[O]/d[OH] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[2];
-        J[202] -= dqdci;              /* dwdot[H]/d[O] */
-        J[204] += dqdci;              /* dwdot[OH]/d[O] */
-        J[205] -= dqdci;              /* dwdot[O]/d[O] */
-        /* d()/d[H2] */
-        dqdci = (TB[16][0] - 1)*q_nocor;
-        J[242] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[244] += dqdci;              /* dwdot[OH]/d[H2] */
-        J[245] -= dqdci;              /* dwdot[O]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[16][1] - 1)*q_nocor;
-        J[282] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[284] += dqdci;              /* dwdot[OH]/d[H2O] */
-        J[285] -= dqdci;              /* dwdot[O]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[16][2] - 1)*q_nocor;
-        J[402] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[404] += dqdci;              /* dwdot[OH]/d[CO] */
-        J[405] -= dqdci;              /* dwdot[O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[16][3] - 1)*q_nocor;
-        J[442] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[444] += dqdci;              /* dwdot[OH]/d[CO2] */
-        J[445] -= dqdci;              /* dwdot[O]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*sc[5];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac - k_r;
-        dqdc[5] = dcdc_fac + k_f*sc[2];
-        dqdc[6] = TB[16][0];
-        dqdc[7] = TB[16][1];
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = TB[16][2];
-        dqdc[11] = TB[16][3];
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+2] -= dqdc[k];
-            J[40*k+4] += dqdc[k];
-            J[40*k+5] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] -= q_nocor;
+    Jmix[4] += q_nocor;
+    Jmix[5] -= q_nocor;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[5];
+    J[82] -= dqdci;               /* dwdot[H]/d[H] */
+    J[84] += dqdci;               /* dwdot[OH]/d[H] */
+    J[85] -= dqdci;               /* dwdot[O]/d[H] */
+    /* d()/d[OH] */
+    dqdci =  - k_r;
+    J[162] -= dqdci;              /* dwdot[H]/d[OH] */
+    J[164] += dqdci;              /* dwdot[OH]/d[OH] */
+    J[165] -= dqdci;              /* dwdot[O]/d[OH] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[2];
+    J[202] -= dqdci;              /* dwdot[H]/d[O] */
+    J[204] += dqdci;              /* dwdot[OH]/d[O] */
+    J[205] -= dqdci;              /* dwdot[O]/d[O] */
+    /* d()/d[H2] */
+    dqdci = (TB[16][0] - 1)*q_nocor;
+    J[242] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[244] += dqdci;              /* dwdot[OH]/d[H2] */
+    J[245] -= dqdci;              /* dwdot[O]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[16][1] - 1)*q_nocor;
+    J[282] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[284] += dqdci;              /* dwdot[OH]/d[H2O] */
+    J[285] -= dqdci;              /* dwdot[O]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[16][2] - 1)*q_nocor;
+    J[402] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[404] += dqdci;              /* dwdot[OH]/d[CO] */
+    J[405] -= dqdci;              /* dwdot[O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[16][3] - 1)*q_nocor;
+    J[442] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[444] += dqdci;              /* dwdot[OH]/d[CO2] */
+    J[445] -= dqdci;              /* dwdot[O]/d[CO2] */
     J[1562] -= dqdT; /* dwdot[H]/dT */
     J[1564] += dqdT; /* dwdot[OH]/dT */
     J[1565] -= dqdT; /* dwdot[O]/dT */
@@ -17126,15 +16907,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 18: 2 H + M <=> H2 + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[17][0] - 1)*sc[6] + (TB[17][1] - 1)*sc[7] + (TB[17][2] - 1)*sc[10] + (TB[17][3] - 1)*sc[11];
+    alpha = alpha_eff2;
     /* forward */
     phi_f = sc[2]*sc[2];
-    k_f = prefactor_units[17] * fwd_A[17]
-                * exp(fwd_beta[17] * tc[0] - activation_units[17] * fwd_Ea[17] * invT);
+    k_f = k_f_s[17];
     dlnkfdT = fwd_beta[17] * invT + activation_units[17] * fwd_Ea[17] * invT2;
     /* reverse */
     phi_r = sc[6];
-    Kc = refCinv * exp(2*g_RT[2] - g_RT[6]);
+    Kc = Kc_s[17];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[2]) + (h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -17148,88 +16928,43 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*2*sc[2];
-        J[82] += -2 * dqdci;          /* dwdot[H]/d[H] */
-        J[86] += dqdci;               /* dwdot[H2]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[17][0] - 1)*q_nocor - k_r;
-        J[242] += -2 * dqdci;         /* dwdot[H]/d[H2] */
-        J[246] += dqdci;              /* dwdot[H2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[17][1] - 1)*q_nocor;
-        J[282] += -2 * dqdci;         /* dwdot[H]/d[H2O] */
-        J[286] += dqdci;              /* dwdot[H2]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[17][2] - 1)*q_nocor;
-        J[402] += -2 * dqdci;         /* dwdot[H]/d[CO] */
-        J[406] += dqdci;              /* dwdot[H2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[17][3] - 1)*q_nocor;
-        J[442] += -2 * dqdci;         /* dwdot[H]/d[CO2] */
-        J[446] += dqdci;              /* dwdot[H2]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*2*sc[2];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = TB[17][0] - k_r;
-        dqdc[7] = TB[17][1];
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = TB[17][2];
-        dqdc[11] = TB[17][3];
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+2] += -2 * dqdc[k];
-            J[40*k+6] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] += -2 * q_nocor;
+    Jmix[6] += q_nocor;
+    /* d()/d[H] */
+    dqdci =  + k_f*2*sc[2];
+    J[82] += -2 * dqdci;          /* dwdot[H]/d[H] */
+    J[86] += dqdci;               /* dwdot[H2]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[17][0] - 1)*q_nocor - k_r;
+    J[242] += -2 * dqdci;         /* dwdot[H]/d[H2] */
+    J[246] += dqdci;              /* dwdot[H2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[17][1] - 1)*q_nocor;
+    J[282] += -2 * dqdci;         /* dwdot[H]/d[H2O] */
+    J[286] += dqdci;              /* dwdot[H2]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[17][2] - 1)*q_nocor;
+    J[402] += -2 * dqdci;         /* dwdot[H]/d[CO] */
+    J[406] += dqdci;              /* dwdot[H2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[17][3] - 1)*q_nocor;
+    J[442] += -2 * dqdci;         /* dwdot[H]/d[CO2] */
+    J[446] += dqdci;              /* dwdot[H2]/d[CO2] */
     J[1562] += -2 * dqdT; /* dwdot[H]/dT */
     J[1566] += dqdT; /* dwdot[H2]/dT */
 
     /*reaction 19: H + OH + M <=> H2O + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[18][0] - 1)*sc[6] + (TB[18][1] - 1)*sc[7] + (TB[18][2] - 1)*sc[10] + (TB[18][3] - 1)*sc[11];
+    alpha = (memcmp(TB[18], TB[16], 4*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[18][0] - 1)*sc[6] + (TB[18][1] - 1)*sc[7] + (TB[18][2] - 1)*sc[10] + (TB[18][3] - 1)*sc[11]);
     /* forward */
     phi_f = sc[2]*sc[4];
-    k_f = prefactor_units[18] * fwd_A[18]
-                * exp(fwd_beta[18] * tc[0] - activation_units[18] * fwd_Ea[18] * invT);
+    k_f = k_f_s[18];
     dlnkfdT = fwd_beta[18] * invT + activation_units[18] * fwd_Ea[18] * invT2;
     /* reverse */
     phi_r = sc[7];
-    Kc = refCinv * exp(g_RT[2] + g_RT[4] - g_RT[7]);
+    Kc = Kc_s[18];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[4]) + (h_RT[7]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -17244,84 +16979,40 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[4];
-        J[82] -= dqdci;               /* dwdot[H]/d[H] */
-        J[84] -= dqdci;               /* dwdot[OH]/d[H] */
-        J[87] += dqdci;               /* dwdot[H2O]/d[H] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*sc[2];
-        J[162] -= dqdci;              /* dwdot[H]/d[OH] */
-        J[164] -= dqdci;              /* dwdot[OH]/d[OH] */
-        J[167] += dqdci;              /* dwdot[H2O]/d[OH] */
-        /* d()/d[H2] */
-        dqdci = (TB[18][0] - 1)*q_nocor;
-        J[242] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[244] -= dqdci;              /* dwdot[OH]/d[H2] */
-        J[247] += dqdci;              /* dwdot[H2O]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[18][1] - 1)*q_nocor - k_r;
-        J[282] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[284] -= dqdci;              /* dwdot[OH]/d[H2O] */
-        J[287] += dqdci;              /* dwdot[H2O]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[18][2] - 1)*q_nocor;
-        J[402] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[404] -= dqdci;              /* dwdot[OH]/d[CO] */
-        J[407] += dqdci;              /* dwdot[H2O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[18][3] - 1)*q_nocor;
-        J[442] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[444] -= dqdci;              /* dwdot[OH]/d[CO2] */
-        J[447] += dqdci;              /* dwdot[H2O]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*sc[4];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac + k_f*sc[2];
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = TB[18][0];
-        dqdc[7] = TB[18][1] - k_r;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = TB[18][2];
-        dqdc[11] = TB[18][3];
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+2] -= dqdc[k];
-            J[40*k+4] -= dqdc[k];
-            J[40*k+7] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] -= q_nocor;
+    Jmix[4] -= q_nocor;
+    Jmix[7] += q_nocor;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[4];
+    J[82] -= dqdci;               /* dwdot[H]/d[H] */
+    J[84] -= dqdci;               /* dwdot[OH]/d[H] */
+    J[87] += dqdci;               /* dwdot[H2O]/d[H] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*sc[2];
+    J[162] -= dqdci;              /* dwdot[H]/d[OH] */
+    J[164] -= dqdci;              /* dwdot[OH]/d[OH] */
+    J[167] += dqdci;              /* dwdot[H2O]/d[OH] */
+    /* d()/d[H2] */
+    dqdci = (TB[18][0] - 1)*q_nocor;
+    J[242] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[244] -= dqdci;              /* dwdot[OH]/d[H2] */
+    J[247] += dqdci;              /* dwdot[H2O]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[18][1] - 1)*q_nocor - k_r;
+    J[282] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[284] -= dqdci;              /* dwdot[OH]/d[H2O] */
+    J[287] += dqdci;              /* dwdot[H2O]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[18][2] - 1)*q_nocor;
+    J[402] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[404] -= dqdci;              /* dwdot[OH]/d[CO] */
+    J[407] += dqdci;              /* dwdot[H2O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[18][3] - 1)*q_nocor;
+    J[442] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[444] -= dqdci;              /* dwdot[OH]/d[CO2] */
+    J[447] += dqdci;              /* dwdot[H2O]/d[CO2] */
     J[1562] -= dqdT; /* dwdot[H]/dT */
     J[1564] -= dqdT; /* dwdot[OH]/dT */
     J[1567] += dqdT; /* dwdot[H2O]/dT */
@@ -17329,15 +17020,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 20: 2 O + M <=> O2 + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[19][0] - 1)*sc[6] + (TB[19][1] - 1)*sc[7] + (TB[19][2] - 1)*sc[10] + (TB[19][3] - 1)*sc[11];
+    alpha = (memcmp(TB[19], TB[16], 4*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[19][0] - 1)*sc[6] + (TB[19][1] - 1)*sc[7] + (TB[19][2] - 1)*sc[10] + (TB[19][3] - 1)*sc[11]);
     /* forward */
     phi_f = sc[5]*sc[5];
-    k_f = prefactor_units[19] * fwd_A[19]
-                * exp(fwd_beta[19] * tc[0] - activation_units[19] * fwd_Ea[19] * invT);
+    k_f = k_f_s[19];
     dlnkfdT = fwd_beta[19] * invT + activation_units[19] * fwd_Ea[19] * invT2;
     /* reverse */
     phi_r = sc[3];
-    Kc = refCinv * exp(-g_RT[3] + 2*g_RT[5]);
+    Kc = Kc_s[19];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[5]) + (h_RT[3]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -17351,77 +17041,33 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[O2] */
-        dqdci =  - k_r;
-        J[123] += dqdci;              /* dwdot[O2]/d[O2] */
-        J[125] += -2 * dqdci;         /* dwdot[O]/d[O2] */
-        /* d()/d[O] */
-        dqdci =  + k_f*2*sc[5];
-        J[203] += dqdci;              /* dwdot[O2]/d[O] */
-        J[205] += -2 * dqdci;         /* dwdot[O]/d[O] */
-        /* d()/d[H2] */
-        dqdci = (TB[19][0] - 1)*q_nocor;
-        J[243] += dqdci;              /* dwdot[O2]/d[H2] */
-        J[245] += -2 * dqdci;         /* dwdot[O]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[19][1] - 1)*q_nocor;
-        J[283] += dqdci;              /* dwdot[O2]/d[H2O] */
-        J[285] += -2 * dqdci;         /* dwdot[O]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[19][2] - 1)*q_nocor;
-        J[403] += dqdci;              /* dwdot[O2]/d[CO] */
-        J[405] += -2 * dqdci;         /* dwdot[O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[19][3] - 1)*q_nocor;
-        J[443] += dqdci;              /* dwdot[O2]/d[CO2] */
-        J[445] += -2 * dqdci;         /* dwdot[O]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac - k_r;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac + k_f*2*sc[5];
-        dqdc[6] = TB[19][0];
-        dqdc[7] = TB[19][1];
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = TB[19][2];
-        dqdc[11] = TB[19][3];
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+3] += dqdc[k];
-            J[40*k+5] += -2 * dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] += q_nocor;
+    Jmix[5] += -2 * q_nocor;
+    /* d()/d[O2] */
+    dqdci =  - k_r;
+    J[123] += dqdci;              /* dwdot[O2]/d[O2] */
+    J[125] += -2 * dqdci;         /* dwdot[O]/d[O2] */
+    /* d()/d[O] */
+    dqdci =  + k_f*2*sc[5];
+    J[203] += dqdci;              /* dwdot[O2]/d[O] */
+    J[205] += -2 * dqdci;         /* dwdot[O]/d[O] */
+    /* d()/d[H2] */
+    dqdci = (TB[19][0] - 1)*q_nocor;
+    J[243] += dqdci;              /* dwdot[O2]/d[H2] */
+    J[245] += -2 * dqdci;         /* dwdot[O]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[19][1] - 1)*q_nocor;
+    J[283] += dqdci;              /* dwdot[O2]/d[H2O] */
+    J[285] += -2 * dqdci;         /* dwdot[O]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[19][2] - 1)*q_nocor;
+    J[403] += dqdci;              /* dwdot[O2]/d[CO] */
+    J[405] += -2 * dqdci;         /* dwdot[O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[19][3] - 1)*q_nocor;
+    J[443] += dqdci;              /* dwdot[O2]/d[CO2] */
+    J[445] += -2 * dqdci;         /* dwdot[O]/d[CO2] */
     J[1563] += dqdT; /* dwdot[O2]/dT */
     J[1565] += -2 * dqdT; /* dwdot[O]/dT */
 
@@ -17431,12 +17077,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[4]*sc[5];
-    k_f = prefactor_units[20] * fwd_A[20]
-                * exp(fwd_beta[20] * tc[0] - activation_units[20] * fwd_Ea[20] * invT);
+    k_f = k_f_s[20];
     dlnkfdT = fwd_beta[20] * invT + activation_units[20] * fwd_Ea[20] * invT2;
     /* reverse */
     phi_r = sc[8];
-    Kc = refCinv * exp(g_RT[4] + g_RT[5] - g_RT[8]);
+    Kc = Kc_s[20];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[5]) + (h_RT[8]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -17451,69 +17096,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[OH] */
-        dqdci =  + k_f*sc[5];
-        J[164] -= dqdci;              /* dwdot[OH]/d[OH] */
-        J[165] -= dqdci;              /* dwdot[O]/d[OH] */
-        J[168] += dqdci;              /* dwdot[HO2]/d[OH] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[4];
-        J[204] -= dqdci;              /* dwdot[OH]/d[O] */
-        J[205] -= dqdci;              /* dwdot[O]/d[O] */
-        J[208] += dqdci;              /* dwdot[HO2]/d[O] */
-        /* d()/d[HO2] */
-        dqdci =  - k_r;
-        J[324] -= dqdci;              /* dwdot[OH]/d[HO2] */
-        J[325] -= dqdci;              /* dwdot[O]/d[HO2] */
-        J[328] += dqdci;              /* dwdot[HO2]/d[HO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac + k_f*sc[5];
-        dqdc[5] = dcdc_fac + k_f*sc[4];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac - k_r;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+4] -= dqdc[k];
-            J[40*k+5] -= dqdc[k];
-            J[40*k+8] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[4] -= q_nocor;
+    Jmix[5] -= q_nocor;
+    Jmix[8] += q_nocor;
+    /* d()/d[OH] */
+    dqdci =  + k_f*sc[5];
+    J[164] -= dqdci;              /* dwdot[OH]/d[OH] */
+    J[165] -= dqdci;              /* dwdot[O]/d[OH] */
+    J[168] += dqdci;              /* dwdot[HO2]/d[OH] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[4];
+    J[204] -= dqdci;              /* dwdot[OH]/d[O] */
+    J[205] -= dqdci;              /* dwdot[O]/d[O] */
+    J[208] += dqdci;              /* dwdot[HO2]/d[O] */
+    /* d()/d[HO2] */
+    dqdci =  - k_r;
+    J[324] -= dqdci;              /* dwdot[OH]/d[HO2] */
+    J[325] -= dqdci;              /* dwdot[O]/d[HO2] */
+    J[328] += dqdci;              /* dwdot[HO2]/d[HO2] */
     J[1564] -= dqdT; /* dwdot[OH]/dT */
     J[1565] -= dqdT; /* dwdot[O]/dT */
     J[1568] += dqdT; /* dwdot[HO2]/dT */
@@ -17524,12 +17125,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[21][0] - 1)*sc[6] + (TB[21][1] - 1)*sc[7] + (TB[21][2] - 1)*sc[10] + (TB[21][3] - 1)*sc[11];
     /* forward */
     phi_f = sc[12];
-    k_f = prefactor_units[21] * fwd_A[21]
-                * exp(fwd_beta[21] * tc[0] - activation_units[21] * fwd_Ea[21] * invT);
+    k_f = k_f_s[21];
     dlnkfdT = fwd_beta[21] * invT + activation_units[21] * fwd_Ea[21] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[10];
-    Kc = refC * exp(-g_RT[2] - g_RT[10] + g_RT[12]);
+    Kc = Kc_s[21];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12]) + (h_RT[2] + h_RT[10]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -17544,84 +17144,40 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[10];
-        J[82] += dqdci;               /* dwdot[H]/d[H] */
-        J[90] += dqdci;               /* dwdot[CO]/d[H] */
-        J[92] -= dqdci;               /* dwdot[HCO]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[21][0] - 1)*q_nocor;
-        J[242] += dqdci;              /* dwdot[H]/d[H2] */
-        J[250] += dqdci;              /* dwdot[CO]/d[H2] */
-        J[252] -= dqdci;              /* dwdot[HCO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[21][1] - 1)*q_nocor;
-        J[282] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[290] += dqdci;              /* dwdot[CO]/d[H2O] */
-        J[292] -= dqdci;              /* dwdot[HCO]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[21][2] - 1)*q_nocor - k_r*sc[2];
-        J[402] += dqdci;              /* dwdot[H]/d[CO] */
-        J[410] += dqdci;              /* dwdot[CO]/d[CO] */
-        J[412] -= dqdci;              /* dwdot[HCO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[21][3] - 1)*q_nocor;
-        J[442] += dqdci;              /* dwdot[H]/d[CO2] */
-        J[450] += dqdci;              /* dwdot[CO]/d[CO2] */
-        J[452] -= dqdci;              /* dwdot[HCO]/d[CO2] */
-        /* d()/d[HCO] */
-        dqdci =  + k_f;
-        J[482] += dqdci;              /* dwdot[H]/d[HCO] */
-        J[490] += dqdci;              /* dwdot[CO]/d[HCO] */
-        J[492] -= dqdci;              /* dwdot[HCO]/d[HCO] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac - k_r*sc[10];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = TB[21][0];
-        dqdc[7] = TB[21][1];
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = TB[21][2] - k_r*sc[2];
-        dqdc[11] = TB[21][3];
-        dqdc[12] = dcdc_fac + k_f;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+2] += dqdc[k];
-            J[40*k+10] += dqdc[k];
-            J[40*k+12] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] += q_nocor;
+    Jmix[10] += q_nocor;
+    Jmix[12] -= q_nocor;
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[10];
+    J[82] += dqdci;               /* dwdot[H]/d[H] */
+    J[90] += dqdci;               /* dwdot[CO]/d[H] */
+    J[92] -= dqdci;               /* dwdot[HCO]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[21][0] - 1)*q_nocor;
+    J[242] += dqdci;              /* dwdot[H]/d[H2] */
+    J[250] += dqdci;              /* dwdot[CO]/d[H2] */
+    J[252] -= dqdci;              /* dwdot[HCO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[21][1] - 1)*q_nocor;
+    J[282] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[290] += dqdci;              /* dwdot[CO]/d[H2O] */
+    J[292] -= dqdci;              /* dwdot[HCO]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[21][2] - 1)*q_nocor - k_r*sc[2];
+    J[402] += dqdci;              /* dwdot[H]/d[CO] */
+    J[410] += dqdci;              /* dwdot[CO]/d[CO] */
+    J[412] -= dqdci;              /* dwdot[HCO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[21][3] - 1)*q_nocor;
+    J[442] += dqdci;              /* dwdot[H]/d[CO2] */
+    J[450] += dqdci;              /* dwdot[CO]/d[CO2] */
+    J[452] -= dqdci;              /* dwdot[HCO]/d[CO2] */
+    /* d()/d[HCO] */
+    dqdci =  + k_f;
+    J[482] += dqdci;              /* dwdot[H]/d[HCO] */
+    J[490] += dqdci;              /* dwdot[CO]/d[HCO] */
+    J[492] -= dqdci;              /* dwdot[HCO]/d[HCO] */
     J[1562] += dqdT; /* dwdot[H]/dT */
     J[1570] += dqdT; /* dwdot[CO]/dT */
     J[1572] -= dqdT; /* dwdot[HCO]/dT */
@@ -17629,15 +17185,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 23: CH2O + M <=> HCO + H + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[22][0] - 1)*sc[6] + (TB[22][1] - 1)*sc[7] + (TB[22][2] - 1)*sc[10] + (TB[22][3] - 1)*sc[11];
+    alpha = (memcmp(TB[22], TB[17], 4*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[22][0] - 1)*sc[6] + (TB[22][1] - 1)*sc[7] + (TB[22][2] - 1)*sc[10] + (TB[22][3] - 1)*sc[11]);
     /* forward */
     phi_f = sc[13];
-    k_f = prefactor_units[22] * fwd_A[22]
-                * exp(fwd_beta[22] * tc[0] - activation_units[22] * fwd_Ea[22] * invT);
+    k_f = k_f_s[22];
     dlnkfdT = fwd_beta[22] * invT + activation_units[22] * fwd_Ea[22] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[12];
-    Kc = refC * exp(-g_RT[2] - g_RT[12] + g_RT[13]);
+    Kc = Kc_s[22];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13]) + (h_RT[2] + h_RT[12]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -17652,89 +17207,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[12];
-        J[82] += dqdci;               /* dwdot[H]/d[H] */
-        J[92] += dqdci;               /* dwdot[HCO]/d[H] */
-        J[93] -= dqdci;               /* dwdot[CH2O]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[22][0] - 1)*q_nocor;
-        J[242] += dqdci;              /* dwdot[H]/d[H2] */
-        J[252] += dqdci;              /* dwdot[HCO]/d[H2] */
-        J[253] -= dqdci;              /* dwdot[CH2O]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[22][1] - 1)*q_nocor;
-        J[282] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[292] += dqdci;              /* dwdot[HCO]/d[H2O] */
-        J[293] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[22][2] - 1)*q_nocor;
-        J[402] += dqdci;              /* dwdot[H]/d[CO] */
-        J[412] += dqdci;              /* dwdot[HCO]/d[CO] */
-        J[413] -= dqdci;              /* dwdot[CH2O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[22][3] - 1)*q_nocor;
-        J[442] += dqdci;              /* dwdot[H]/d[CO2] */
-        J[452] += dqdci;              /* dwdot[HCO]/d[CO2] */
-        J[453] -= dqdci;              /* dwdot[CH2O]/d[CO2] */
-        /* d()/d[HCO] */
-        dqdci =  - k_r*sc[2];
-        J[482] += dqdci;              /* dwdot[H]/d[HCO] */
-        J[492] += dqdci;              /* dwdot[HCO]/d[HCO] */
-        J[493] -= dqdci;              /* dwdot[CH2O]/d[HCO] */
-        /* d()/d[CH2O] */
-        dqdci =  + k_f;
-        J[522] += dqdci;              /* dwdot[H]/d[CH2O] */
-        J[532] += dqdci;              /* dwdot[HCO]/d[CH2O] */
-        J[533] -= dqdci;              /* dwdot[CH2O]/d[CH2O] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac - k_r*sc[12];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = TB[22][0];
-        dqdc[7] = TB[22][1];
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = TB[22][2];
-        dqdc[11] = TB[22][3];
-        dqdc[12] = dcdc_fac - k_r*sc[2];
-        dqdc[13] = dcdc_fac + k_f;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+2] += dqdc[k];
-            J[40*k+12] += dqdc[k];
-            J[40*k+13] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] += q_nocor;
+    Jmix[12] += q_nocor;
+    Jmix[13] -= q_nocor;
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[12];
+    J[82] += dqdci;               /* dwdot[H]/d[H] */
+    J[92] += dqdci;               /* dwdot[HCO]/d[H] */
+    J[93] -= dqdci;               /* dwdot[CH2O]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[22][0] - 1)*q_nocor;
+    J[242] += dqdci;              /* dwdot[H]/d[H2] */
+    J[252] += dqdci;              /* dwdot[HCO]/d[H2] */
+    J[253] -= dqdci;              /* dwdot[CH2O]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[22][1] - 1)*q_nocor;
+    J[282] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[292] += dqdci;              /* dwdot[HCO]/d[H2O] */
+    J[293] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[22][2] - 1)*q_nocor;
+    J[402] += dqdci;              /* dwdot[H]/d[CO] */
+    J[412] += dqdci;              /* dwdot[HCO]/d[CO] */
+    J[413] -= dqdci;              /* dwdot[CH2O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[22][3] - 1)*q_nocor;
+    J[442] += dqdci;              /* dwdot[H]/d[CO2] */
+    J[452] += dqdci;              /* dwdot[HCO]/d[CO2] */
+    J[453] -= dqdci;              /* dwdot[CH2O]/d[CO2] */
+    /* d()/d[HCO] */
+    dqdci =  - k_r*sc[2];
+    J[482] += dqdci;              /* dwdot[H]/d[HCO] */
+    J[492] += dqdci;              /* dwdot[HCO]/d[HCO] */
+    J[493] -= dqdci;              /* dwdot[CH2O]/d[HCO] */
+    /* d()/d[CH2O] */
+    dqdci =  + k_f;
+    J[522] += dqdci;              /* dwdot[H]/d[CH2O] */
+    J[532] += dqdci;              /* dwdot[HCO]/d[CH2O] */
+    J[533] -= dqdci;              /* dwdot[CH2O]/d[CH2O] */
     J[1562] += dqdT; /* dwdot[H]/dT */
     J[1572] += dqdT; /* dwdot[HCO]/dT */
     J[1573] -= dqdT; /* dwdot[CH2O]/dT */
@@ -17742,15 +17253,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 24: S-CH2 + M <=> T-CH2 + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[23][0] - 1)*sc[6] + (TB[23][1] - 1)*sc[7] + (TB[23][2] - 1)*sc[10] + (TB[23][3] - 1)*sc[11];
+    alpha = alpha_eff3;
     /* forward */
     phi_f = sc[17];
-    k_f = prefactor_units[23] * fwd_A[23]
-                * exp(fwd_beta[23] * tc[0] - activation_units[23] * fwd_Ea[23] * invT);
+    k_f = k_f_s[23];
     dlnkfdT = fwd_beta[23] * invT + activation_units[23] * fwd_Ea[23] * invT2;
     /* reverse */
     phi_r = sc[16];
-    Kc = exp(-g_RT[16] + g_RT[17]);
+    Kc = Kc_s[23];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[17]) + (h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -17764,77 +17274,33 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[23][0] - 1)*q_nocor;
-        J[256] += dqdci;              /* dwdot[T-CH2]/d[H2] */
-        J[257] -= dqdci;              /* dwdot[S-CH2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[23][1] - 1)*q_nocor;
-        J[296] += dqdci;              /* dwdot[T-CH2]/d[H2O] */
-        J[297] -= dqdci;              /* dwdot[S-CH2]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[23][2] - 1)*q_nocor;
-        J[416] += dqdci;              /* dwdot[T-CH2]/d[CO] */
-        J[417] -= dqdci;              /* dwdot[S-CH2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[23][3] - 1)*q_nocor;
-        J[456] += dqdci;              /* dwdot[T-CH2]/d[CO2] */
-        J[457] -= dqdci;              /* dwdot[S-CH2]/d[CO2] */
-        /* d()/d[T-CH2] */
-        dqdci =  - k_r;
-        J[656] += dqdci;              /* dwdot[T-CH2]/d[T-CH2] */
-        J[657] -= dqdci;              /* dwdot[S-CH2]/d[T-CH2] */
-        /* d()/d[S-CH2] */
-        dqdci =  + k_f;
-        J[696] += dqdci;              /* dwdot[T-CH2]/d[S-CH2] */
-        J[697] -= dqdci;              /* dwdot[S-CH2]/d[S-CH2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = TB[23][0];
-        dqdc[7] = TB[23][1];
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = TB[23][2];
-        dqdc[11] = TB[23][3];
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac - k_r;
-        dqdc[17] = dcdc_fac + k_f;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+16] += dqdc[k];
-            J[40*k+17] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[16] += q_nocor;
+    Jmix[17] -= q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[23][0] - 1)*q_nocor;
+    J[256] += dqdci;              /* dwdot[T-CH2]/d[H2] */
+    J[257] -= dqdci;              /* dwdot[S-CH2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[23][1] - 1)*q_nocor;
+    J[296] += dqdci;              /* dwdot[T-CH2]/d[H2O] */
+    J[297] -= dqdci;              /* dwdot[S-CH2]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[23][2] - 1)*q_nocor;
+    J[416] += dqdci;              /* dwdot[T-CH2]/d[CO] */
+    J[417] -= dqdci;              /* dwdot[S-CH2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[23][3] - 1)*q_nocor;
+    J[456] += dqdci;              /* dwdot[T-CH2]/d[CO2] */
+    J[457] -= dqdci;              /* dwdot[S-CH2]/d[CO2] */
+    /* d()/d[T-CH2] */
+    dqdci =  - k_r;
+    J[656] += dqdci;              /* dwdot[T-CH2]/d[T-CH2] */
+    J[657] -= dqdci;              /* dwdot[S-CH2]/d[T-CH2] */
+    /* d()/d[S-CH2] */
+    dqdci =  + k_f;
+    J[696] += dqdci;              /* dwdot[T-CH2]/d[S-CH2] */
+    J[697] -= dqdci;              /* dwdot[S-CH2]/d[S-CH2] */
     J[1576] += dqdT; /* dwdot[T-CH2]/dT */
     J[1577] -= dqdT; /* dwdot[S-CH2]/dT */
 
@@ -17844,12 +17310,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[19];
-    k_f = prefactor_units[24] * fwd_A[24]
-                * exp(fwd_beta[24] * tc[0] - activation_units[24] * fwd_Ea[24] * invT);
+    k_f = k_f_s[24];
     dlnkfdT = fwd_beta[24] * invT + activation_units[24] * fwd_Ea[24] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[13];
-    Kc = refC * exp(-g_RT[2] - g_RT[13] + g_RT[19]);
+    Kc = Kc_s[24];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[19]) + (h_RT[2] + h_RT[13]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -17864,69 +17329,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[13];
-        J[82] += dqdci;               /* dwdot[H]/d[H] */
-        J[93] += dqdci;               /* dwdot[CH2O]/d[H] */
-        J[99] -= dqdci;               /* dwdot[CH3O]/d[H] */
-        /* d()/d[CH2O] */
-        dqdci =  - k_r*sc[2];
-        J[522] += dqdci;              /* dwdot[H]/d[CH2O] */
-        J[533] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
-        J[539] -= dqdci;              /* dwdot[CH3O]/d[CH2O] */
-        /* d()/d[CH3O] */
-        dqdci =  + k_f;
-        J[762] += dqdci;              /* dwdot[H]/d[CH3O] */
-        J[773] += dqdci;              /* dwdot[CH2O]/d[CH3O] */
-        J[779] -= dqdci;              /* dwdot[CH3O]/d[CH3O] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac - k_r*sc[13];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac - k_r*sc[2];
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac + k_f;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+2] += dqdc[k];
-            J[40*k+13] += dqdc[k];
-            J[40*k+19] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] += q_nocor;
+    Jmix[13] += q_nocor;
+    Jmix[19] -= q_nocor;
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[13];
+    J[82] += dqdci;               /* dwdot[H]/d[H] */
+    J[93] += dqdci;               /* dwdot[CH2O]/d[H] */
+    J[99] -= dqdci;               /* dwdot[CH3O]/d[H] */
+    /* d()/d[CH2O] */
+    dqdci =  - k_r*sc[2];
+    J[522] += dqdci;              /* dwdot[H]/d[CH2O] */
+    J[533] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
+    J[539] -= dqdci;              /* dwdot[CH3O]/d[CH2O] */
+    /* d()/d[CH3O] */
+    dqdci =  + k_f;
+    J[762] += dqdci;              /* dwdot[H]/d[CH3O] */
+    J[773] += dqdci;              /* dwdot[CH2O]/d[CH3O] */
+    J[779] -= dqdci;              /* dwdot[CH3O]/d[CH3O] */
     J[1562] += dqdT; /* dwdot[H]/dT */
     J[1573] += dqdT; /* dwdot[CH2O]/dT */
     J[1579] -= dqdT; /* dwdot[CH3O]/dT */
@@ -17937,12 +17358,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[18];
-    k_f = prefactor_units[25] * fwd_A[25]
-                * exp(fwd_beta[25] * tc[0] - activation_units[25] * fwd_Ea[25] * invT);
+    k_f = k_f_s[25];
     dlnkfdT = fwd_beta[25] * invT + activation_units[25] * fwd_Ea[25] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[24];
-    Kc = refC * exp(-g_RT[2] + g_RT[18] - g_RT[24]);
+    Kc = Kc_s[25];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[18]) + (h_RT[2] + h_RT[24]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -17957,69 +17377,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[24];
-        J[82] += dqdci;               /* dwdot[H]/d[H] */
-        J[98] -= dqdci;               /* dwdot[C2H4]/d[H] */
-        J[104] += dqdci;              /* dwdot[C2H3]/d[H] */
-        /* d()/d[C2H4] */
-        dqdci =  + k_f;
-        J[722] += dqdci;              /* dwdot[H]/d[C2H4] */
-        J[738] -= dqdci;              /* dwdot[C2H4]/d[C2H4] */
-        J[744] += dqdci;              /* dwdot[C2H3]/d[C2H4] */
-        /* d()/d[C2H3] */
-        dqdci =  - k_r*sc[2];
-        J[962] += dqdci;              /* dwdot[H]/d[C2H3] */
-        J[978] -= dqdci;              /* dwdot[C2H4]/d[C2H3] */
-        J[984] += dqdci;              /* dwdot[C2H3]/d[C2H3] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac - k_r*sc[24];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac + k_f;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac - k_r*sc[2];
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+2] += dqdc[k];
-            J[40*k+18] -= dqdc[k];
-            J[40*k+24] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] += q_nocor;
+    Jmix[18] -= q_nocor;
+    Jmix[24] += q_nocor;
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[24];
+    J[82] += dqdci;               /* dwdot[H]/d[H] */
+    J[98] -= dqdci;               /* dwdot[C2H4]/d[H] */
+    J[104] += dqdci;              /* dwdot[C2H3]/d[H] */
+    /* d()/d[C2H4] */
+    dqdci =  + k_f;
+    J[722] += dqdci;              /* dwdot[H]/d[C2H4] */
+    J[738] -= dqdci;              /* dwdot[C2H4]/d[C2H4] */
+    J[744] += dqdci;              /* dwdot[C2H3]/d[C2H4] */
+    /* d()/d[C2H3] */
+    dqdci =  - k_r*sc[2];
+    J[962] += dqdci;              /* dwdot[H]/d[C2H3] */
+    J[978] -= dqdci;              /* dwdot[C2H4]/d[C2H3] */
+    J[984] += dqdci;              /* dwdot[C2H3]/d[C2H3] */
     J[1562] += dqdT; /* dwdot[H]/dT */
     J[1578] -= dqdT; /* dwdot[C2H4]/dT */
     J[1584] += dqdT; /* dwdot[C2H3]/dT */
@@ -18030,12 +17406,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[18];
-    k_f = prefactor_units[26] * fwd_A[26]
-                * exp(fwd_beta[26] * tc[0] - activation_units[26] * fwd_Ea[26] * invT);
+    k_f = k_f_s[26];
     dlnkfdT = fwd_beta[26] * invT + activation_units[26] * fwd_Ea[26] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[23];
-    Kc = refC * exp(-g_RT[6] + g_RT[18] - g_RT[23]);
+    Kc = Kc_s[26];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[18]) + (h_RT[6] + h_RT[23]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18050,69 +17425,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci =  - k_r*sc[23];
-        J[246] += dqdci;              /* dwdot[H2]/d[H2] */
-        J[258] -= dqdci;              /* dwdot[C2H4]/d[H2] */
-        J[263] += dqdci;              /* dwdot[C2H2]/d[H2] */
-        /* d()/d[C2H4] */
-        dqdci =  + k_f;
-        J[726] += dqdci;              /* dwdot[H2]/d[C2H4] */
-        J[738] -= dqdci;              /* dwdot[C2H4]/d[C2H4] */
-        J[743] += dqdci;              /* dwdot[C2H2]/d[C2H4] */
-        /* d()/d[C2H2] */
-        dqdci =  - k_r*sc[6];
-        J[926] += dqdci;              /* dwdot[H2]/d[C2H2] */
-        J[938] -= dqdci;              /* dwdot[C2H4]/d[C2H2] */
-        J[943] += dqdci;              /* dwdot[C2H2]/d[C2H2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac - k_r*sc[23];
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac + k_f;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac - k_r*sc[6];
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+6] += dqdc[k];
-            J[40*k+18] -= dqdc[k];
-            J[40*k+23] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[6] += q_nocor;
+    Jmix[18] -= q_nocor;
+    Jmix[23] += q_nocor;
+    /* d()/d[H2] */
+    dqdci =  - k_r*sc[23];
+    J[246] += dqdci;              /* dwdot[H2]/d[H2] */
+    J[258] -= dqdci;              /* dwdot[C2H4]/d[H2] */
+    J[263] += dqdci;              /* dwdot[C2H2]/d[H2] */
+    /* d()/d[C2H4] */
+    dqdci =  + k_f;
+    J[726] += dqdci;              /* dwdot[H2]/d[C2H4] */
+    J[738] -= dqdci;              /* dwdot[C2H4]/d[C2H4] */
+    J[743] += dqdci;              /* dwdot[C2H2]/d[C2H4] */
+    /* d()/d[C2H2] */
+    dqdci =  - k_r*sc[6];
+    J[926] += dqdci;              /* dwdot[H2]/d[C2H2] */
+    J[938] -= dqdci;              /* dwdot[C2H4]/d[C2H2] */
+    J[943] += dqdci;              /* dwdot[C2H2]/d[C2H2] */
     J[1566] += dqdT; /* dwdot[H2]/dT */
     J[1578] -= dqdT; /* dwdot[C2H4]/dT */
     J[1583] += dqdT; /* dwdot[C2H2]/dT */
@@ -18120,15 +17451,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 28: CH2OH + M <=> CH2O + H + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[27][0] - 1)*sc[6] + (TB[27][1] - 1)*sc[7] + (TB[27][2] - 1)*sc[10] + (TB[27][3] - 1)*sc[11];
+    alpha = (memcmp(TB[27], TB[23], 4*sizeof(double)) == 0 ? alpha_eff3 : mixture + (TB[27][0] - 1)*sc[6] + (TB[27][1] - 1)*sc[7] + (TB[27][2] - 1)*sc[10] + (TB[27][3] - 1)*sc[11]);
     /* forward */
     phi_f = sc[30];
-    k_f = prefactor_units[27] * fwd_A[27]
-                * exp(fwd_beta[27] * tc[0] - activation_units[27] * fwd_Ea[27] * invT);
+    k_f = k_f_s[27];
     dlnkfdT = fwd_beta[27] * invT + activation_units[27] * fwd_Ea[27] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[13];
-    Kc = refC * exp(-g_RT[2] - g_RT[13] + g_RT[30]);
+    Kc = Kc_s[27];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[30]) + (h_RT[2] + h_RT[13]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18143,89 +17473,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[13];
-        J[82] += dqdci;               /* dwdot[H]/d[H] */
-        J[93] += dqdci;               /* dwdot[CH2O]/d[H] */
-        J[110] -= dqdci;              /* dwdot[CH2OH]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[27][0] - 1)*q_nocor;
-        J[242] += dqdci;              /* dwdot[H]/d[H2] */
-        J[253] += dqdci;              /* dwdot[CH2O]/d[H2] */
-        J[270] -= dqdci;              /* dwdot[CH2OH]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[27][1] - 1)*q_nocor;
-        J[282] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[293] += dqdci;              /* dwdot[CH2O]/d[H2O] */
-        J[310] -= dqdci;              /* dwdot[CH2OH]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[27][2] - 1)*q_nocor;
-        J[402] += dqdci;              /* dwdot[H]/d[CO] */
-        J[413] += dqdci;              /* dwdot[CH2O]/d[CO] */
-        J[430] -= dqdci;              /* dwdot[CH2OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[27][3] - 1)*q_nocor;
-        J[442] += dqdci;              /* dwdot[H]/d[CO2] */
-        J[453] += dqdci;              /* dwdot[CH2O]/d[CO2] */
-        J[470] -= dqdci;              /* dwdot[CH2OH]/d[CO2] */
-        /* d()/d[CH2O] */
-        dqdci =  - k_r*sc[2];
-        J[522] += dqdci;              /* dwdot[H]/d[CH2O] */
-        J[533] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
-        J[550] -= dqdci;              /* dwdot[CH2OH]/d[CH2O] */
-        /* d()/d[CH2OH] */
-        dqdci =  + k_f;
-        J[1202] += dqdci;             /* dwdot[H]/d[CH2OH] */
-        J[1213] += dqdci;             /* dwdot[CH2O]/d[CH2OH] */
-        J[1230] -= dqdci;             /* dwdot[CH2OH]/d[CH2OH] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac - k_r*sc[13];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = TB[27][0];
-        dqdc[7] = TB[27][1];
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = TB[27][2];
-        dqdc[11] = TB[27][3];
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac - k_r*sc[2];
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac + k_f;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+2] += dqdc[k];
-            J[40*k+13] += dqdc[k];
-            J[40*k+30] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] += q_nocor;
+    Jmix[13] += q_nocor;
+    Jmix[30] -= q_nocor;
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[13];
+    J[82] += dqdci;               /* dwdot[H]/d[H] */
+    J[93] += dqdci;               /* dwdot[CH2O]/d[H] */
+    J[110] -= dqdci;              /* dwdot[CH2OH]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[27][0] - 1)*q_nocor;
+    J[242] += dqdci;              /* dwdot[H]/d[H2] */
+    J[253] += dqdci;              /* dwdot[CH2O]/d[H2] */
+    J[270] -= dqdci;              /* dwdot[CH2OH]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[27][1] - 1)*q_nocor;
+    J[282] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[293] += dqdci;              /* dwdot[CH2O]/d[H2O] */
+    J[310] -= dqdci;              /* dwdot[CH2OH]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[27][2] - 1)*q_nocor;
+    J[402] += dqdci;              /* dwdot[H]/d[CO] */
+    J[413] += dqdci;              /* dwdot[CH2O]/d[CO] */
+    J[430] -= dqdci;              /* dwdot[CH2OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[27][3] - 1)*q_nocor;
+    J[442] += dqdci;              /* dwdot[H]/d[CO2] */
+    J[453] += dqdci;              /* dwdot[CH2O]/d[CO2] */
+    J[470] -= dqdci;              /* dwdot[CH2OH]/d[CO2] */
+    /* d()/d[CH2O] */
+    dqdci =  - k_r*sc[2];
+    J[522] += dqdci;              /* dwdot[H]/d[CH2O] */
+    J[533] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
+    J[550] -= dqdci;              /* dwdot[CH2OH]/d[CH2O] */
+    /* d()/d[CH2OH] */
+    dqdci =  + k_f;
+    J[1202] += dqdci;             /* dwdot[H]/d[CH2OH] */
+    J[1213] += dqdci;             /* dwdot[CH2O]/d[CH2OH] */
+    J[1230] -= dqdci;             /* dwdot[CH2OH]/d[CH2OH] */
     J[1562] += dqdT; /* dwdot[H]/dT */
     J[1573] += dqdT; /* dwdot[CH2O]/dT */
     J[1590] -= dqdT; /* dwdot[CH2OH]/dT */
@@ -18233,15 +17519,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 29: CH3O + M <=> CH2OH + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[28][0] - 1)*sc[6] + (TB[28][1] - 1)*sc[7] + (TB[28][2] - 1)*sc[10] + (TB[28][3] - 1)*sc[11];
+    alpha = (memcmp(TB[28], TB[16], 4*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[28][0] - 1)*sc[6] + (TB[28][1] - 1)*sc[7] + (TB[28][2] - 1)*sc[10] + (TB[28][3] - 1)*sc[11]);
     /* forward */
     phi_f = sc[19];
-    k_f = prefactor_units[28] * fwd_A[28]
-                * exp(fwd_beta[28] * tc[0] - activation_units[28] * fwd_Ea[28] * invT);
+    k_f = k_f_s[28];
     dlnkfdT = fwd_beta[28] * invT + activation_units[28] * fwd_Ea[28] * invT2;
     /* reverse */
     phi_r = sc[30];
-    Kc = exp(g_RT[19] - g_RT[30]);
+    Kc = Kc_s[28];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[19]) + (h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18255,77 +17540,33 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[28][0] - 1)*q_nocor;
-        J[259] -= dqdci;              /* dwdot[CH3O]/d[H2] */
-        J[270] += dqdci;              /* dwdot[CH2OH]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[28][1] - 1)*q_nocor;
-        J[299] -= dqdci;              /* dwdot[CH3O]/d[H2O] */
-        J[310] += dqdci;              /* dwdot[CH2OH]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[28][2] - 1)*q_nocor;
-        J[419] -= dqdci;              /* dwdot[CH3O]/d[CO] */
-        J[430] += dqdci;              /* dwdot[CH2OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[28][3] - 1)*q_nocor;
-        J[459] -= dqdci;              /* dwdot[CH3O]/d[CO2] */
-        J[470] += dqdci;              /* dwdot[CH2OH]/d[CO2] */
-        /* d()/d[CH3O] */
-        dqdci =  + k_f;
-        J[779] -= dqdci;              /* dwdot[CH3O]/d[CH3O] */
-        J[790] += dqdci;              /* dwdot[CH2OH]/d[CH3O] */
-        /* d()/d[CH2OH] */
-        dqdci =  - k_r;
-        J[1219] -= dqdci;             /* dwdot[CH3O]/d[CH2OH] */
-        J[1230] += dqdci;             /* dwdot[CH2OH]/d[CH2OH] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = TB[28][0];
-        dqdc[7] = TB[28][1];
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = TB[28][2];
-        dqdc[11] = TB[28][3];
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac + k_f;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac - k_r;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        for (int k=0; k<39; k++) {
-            J[40*k+19] -= dqdc[k];
-            J[40*k+30] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[19] -= q_nocor;
+    Jmix[30] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[28][0] - 1)*q_nocor;
+    J[259] -= dqdci;              /* dwdot[CH3O]/d[H2] */
+    J[270] += dqdci;              /* dwdot[CH2OH]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[28][1] - 1)*q_nocor;
+    J[299] -= dqdci;              /* dwdot[CH3O]/d[H2O] */
+    J[310] += dqdci;              /* dwdot[CH2OH]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[28][2] - 1)*q_nocor;
+    J[419] -= dqdci;              /* dwdot[CH3O]/d[CO] */
+    J[430] += dqdci;              /* dwdot[CH2OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[28][3] - 1)*q_nocor;
+    J[459] -= dqdci;              /* dwdot[CH3O]/d[CO2] */
+    J[470] += dqdci;              /* dwdot[CH2OH]/d[CO2] */
+    /* d()/d[CH3O] */
+    dqdci =  + k_f;
+    J[779] -= dqdci;              /* dwdot[CH3O]/d[CH3O] */
+    J[790] += dqdci;              /* dwdot[CH2OH]/d[CH3O] */
+    /* d()/d[CH2OH] */
+    dqdci =  - k_r;
+    J[1219] -= dqdci;             /* dwdot[CH3O]/d[CH2OH] */
+    J[1230] += dqdci;             /* dwdot[CH2OH]/d[CH2OH] */
     J[1579] -= dqdT; /* dwdot[CH3O]/dT */
     J[1590] += dqdT; /* dwdot[CH2OH]/dT */
 
@@ -18333,12 +17574,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[3];
-    k_f = prefactor_units[29] * fwd_A[29]
-                * exp(fwd_beta[29] * tc[0] - activation_units[29] * fwd_Ea[29] * invT);
+    k_f = k_f_s[29];
     dlnkfdT = fwd_beta[29] * invT + activation_units[29] * fwd_Ea[29] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[5];
-    Kc = exp(g_RT[2] + g_RT[3] - g_RT[4] - g_RT[5]);
+    Kc = Kc_s[29];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[3]) + (h_RT[4] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18384,12 +17624,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[6];
-    k_f = prefactor_units[30] * fwd_A[30]
-                * exp(fwd_beta[30] * tc[0] - activation_units[30] * fwd_Ea[30] * invT);
+    k_f = k_f_s[30];
     dlnkfdT = fwd_beta[30] * invT + activation_units[30] * fwd_Ea[30] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[4];
-    Kc = exp(-g_RT[2] - g_RT[4] + g_RT[5] + g_RT[6]);
+    Kc = Kc_s[30];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[6]) + (h_RT[2] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18435,12 +17674,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[6];
-    k_f = prefactor_units[31] * fwd_A[31]
-                * exp(fwd_beta[31] * tc[0] - activation_units[31] * fwd_Ea[31] * invT);
+    k_f = k_f_s[31];
     dlnkfdT = fwd_beta[31] * invT + activation_units[31] * fwd_Ea[31] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[7];
-    Kc = exp(-g_RT[2] + g_RT[4] + g_RT[6] - g_RT[7]);
+    Kc = Kc_s[31];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[6]) + (h_RT[2] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18486,12 +17724,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[7];
-    k_f = prefactor_units[32] * fwd_A[32]
-                * exp(fwd_beta[32] * tc[0] - activation_units[32] * fwd_Ea[32] * invT);
+    k_f = k_f_s[32];
     dlnkfdT = fwd_beta[32] * invT + activation_units[32] * fwd_Ea[32] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[4];
-    Kc = exp(-2*g_RT[4] + g_RT[5] + g_RT[7]);
+    Kc = Kc_s[32];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[7]) + (2*h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18526,12 +17763,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[6];
-    k_f = prefactor_units[33] * fwd_A[33]
-                * exp(fwd_beta[33] * tc[0] - activation_units[33] * fwd_Ea[33] * invT);
+    k_f = k_f_s[33];
     dlnkfdT = fwd_beta[33] * invT + activation_units[33] * fwd_Ea[33] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[4];
-    Kc = exp(g_RT[3] - 2*g_RT[4] + g_RT[6]);
+    Kc = Kc_s[33];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[6]) + (2*h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18566,12 +17802,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[8];
-    k_f = prefactor_units[34] * fwd_A[34]
-                * exp(fwd_beta[34] * tc[0] - activation_units[34] * fwd_Ea[34] * invT);
+    k_f = k_f_s[34];
     dlnkfdT = fwd_beta[34] * invT + activation_units[34] * fwd_Ea[34] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[4];
-    Kc = exp(g_RT[2] - 2*g_RT[4] + g_RT[8]);
+    Kc = Kc_s[34];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[8]) + (2*h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18606,12 +17841,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[8];
-    k_f = prefactor_units[35] * fwd_A[35]
-                * exp(fwd_beta[35] * tc[0] - activation_units[35] * fwd_Ea[35] * invT);
+    k_f = k_f_s[35];
     dlnkfdT = fwd_beta[35] * invT + activation_units[35] * fwd_Ea[35] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[6];
-    Kc = exp(g_RT[2] - g_RT[3] - g_RT[6] + g_RT[8]);
+    Kc = Kc_s[35];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[8]) + (h_RT[3] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18657,12 +17891,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[8];
-    k_f = prefactor_units[36] * fwd_A[36]
-                * exp(fwd_beta[36] * tc[0] - activation_units[36] * fwd_Ea[36] * invT);
+    k_f = k_f_s[36];
     dlnkfdT = fwd_beta[36] * invT + activation_units[36] * fwd_Ea[36] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[7];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[7] + g_RT[8]);
+    Kc = Kc_s[36];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[8]) + (h_RT[5] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18708,12 +17941,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[8];
-    k_f = prefactor_units[37] * fwd_A[37]
-                * exp(fwd_beta[37] * tc[0] - activation_units[37] * fwd_Ea[37] * invT);
+    k_f = k_f_s[37];
     dlnkfdT = fwd_beta[37] * invT + activation_units[37] * fwd_Ea[37] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[4];
-    Kc = exp(-g_RT[3] - g_RT[4] + g_RT[5] + g_RT[8]);
+    Kc = Kc_s[37];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[8]) + (h_RT[3] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18759,12 +17991,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[8];
-    k_f = prefactor_units[38] * fwd_A[38]
-                * exp(fwd_beta[38] * tc[0] - activation_units[38] * fwd_Ea[38] * invT);
+    k_f = k_f_s[38];
     dlnkfdT = fwd_beta[38] * invT + activation_units[38] * fwd_Ea[38] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[7];
-    Kc = exp(-g_RT[3] + g_RT[4] - g_RT[7] + g_RT[8]);
+    Kc = Kc_s[38];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[8]) + (h_RT[3] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18810,12 +18041,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[8];
-    k_f = prefactor_units[39] * fwd_A[39]
-                * exp(fwd_beta[39] * tc[0] - activation_units[39] * fwd_Ea[39] * invT);
+    k_f = k_f_s[39];
     dlnkfdT = fwd_beta[39] * invT + activation_units[39] * fwd_Ea[39] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[9];
-    Kc = exp(-g_RT[3] + 2*g_RT[8] - g_RT[9]);
+    Kc = Kc_s[39];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[8]) + (h_RT[3] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18850,12 +18080,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[9];
-    k_f = prefactor_units[40] * fwd_A[40]
-                * exp(fwd_beta[40] * tc[0] - activation_units[40] * fwd_Ea[40] * invT);
+    k_f = k_f_s[40];
     dlnkfdT = fwd_beta[40] * invT + activation_units[40] * fwd_Ea[40] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[8];
-    Kc = exp(g_RT[2] - g_RT[6] - g_RT[8] + g_RT[9]);
+    Kc = Kc_s[40];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[9]) + (h_RT[6] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18901,12 +18130,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[9];
-    k_f = prefactor_units[41] * fwd_A[41]
-                * exp(fwd_beta[41] * tc[0] - activation_units[41] * fwd_Ea[41] * invT);
+    k_f = k_f_s[41];
     dlnkfdT = fwd_beta[41] * invT + activation_units[41] * fwd_Ea[41] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[7];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[7] + g_RT[9]);
+    Kc = Kc_s[41];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[9]) + (h_RT[4] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18952,12 +18180,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[9];
-    k_f = prefactor_units[42] * fwd_A[42]
-                * exp(fwd_beta[42] * tc[0] - activation_units[42] * fwd_Ea[42] * invT);
+    k_f = k_f_s[42];
     dlnkfdT = fwd_beta[42] * invT + activation_units[42] * fwd_Ea[42] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[8];
-    Kc = exp(g_RT[4] - g_RT[7] - g_RT[8] + g_RT[9]);
+    Kc = Kc_s[42];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[9]) + (h_RT[7] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19003,12 +18230,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[9];
-    k_f = prefactor_units[43] * fwd_A[43]
-                * exp(fwd_beta[43] * tc[0] - activation_units[43] * fwd_Ea[43] * invT);
+    k_f = k_f_s[43];
     dlnkfdT = fwd_beta[43] * invT + activation_units[43] * fwd_Ea[43] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[8];
-    Kc = exp(-g_RT[4] + g_RT[5] - g_RT[8] + g_RT[9]);
+    Kc = Kc_s[43];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[9]) + (h_RT[4] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19054,12 +18280,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[10];
-    k_f = prefactor_units[44] * fwd_A[44]
-                * exp(fwd_beta[44] * tc[0] - activation_units[44] * fwd_Ea[44] * invT);
+    k_f = k_f_s[44];
     dlnkfdT = fwd_beta[44] * invT + activation_units[44] * fwd_Ea[44] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[11];
-    Kc = exp(-g_RT[2] + g_RT[4] + g_RT[10] - g_RT[11]);
+    Kc = Kc_s[44];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[10]) + (h_RT[2] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19105,12 +18330,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[10];
-    k_f = prefactor_units[45] * fwd_A[45]
-                * exp(fwd_beta[45] * tc[0] - activation_units[45] * fwd_Ea[45] * invT);
+    k_f = k_f_s[45];
     dlnkfdT = fwd_beta[45] * invT + activation_units[45] * fwd_Ea[45] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[11];
-    Kc = exp(-g_RT[4] + g_RT[8] + g_RT[10] - g_RT[11]);
+    Kc = Kc_s[45];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[10]) + (h_RT[4] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19156,12 +18380,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[12];
-    k_f = prefactor_units[46] * fwd_A[46]
-                * exp(fwd_beta[46] * tc[0] - activation_units[46] * fwd_Ea[46] * invT);
+    k_f = k_f_s[46];
     dlnkfdT = fwd_beta[46] * invT + activation_units[46] * fwd_Ea[46] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[10];
-    Kc = exp(g_RT[2] - g_RT[6] - g_RT[10] + g_RT[12]);
+    Kc = Kc_s[46];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[12]) + (h_RT[6] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19207,12 +18430,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[12];
-    k_f = prefactor_units[47] * fwd_A[47]
-                * exp(fwd_beta[47] * tc[0] - activation_units[47] * fwd_Ea[47] * invT);
+    k_f = k_f_s[47];
     dlnkfdT = fwd_beta[47] * invT + activation_units[47] * fwd_Ea[47] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[10];
-    Kc = exp(-g_RT[4] + g_RT[5] - g_RT[10] + g_RT[12]);
+    Kc = Kc_s[47];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[12]) + (h_RT[4] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19258,12 +18480,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[12];
-    k_f = prefactor_units[48] * fwd_A[48]
-                * exp(fwd_beta[48] * tc[0] - activation_units[48] * fwd_Ea[48] * invT);
+    k_f = k_f_s[48];
     dlnkfdT = fwd_beta[48] * invT + activation_units[48] * fwd_Ea[48] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[11];
-    Kc = exp(-g_RT[2] + g_RT[5] - g_RT[11] + g_RT[12]);
+    Kc = Kc_s[48];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[12]) + (h_RT[2] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19309,12 +18530,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[12];
-    k_f = prefactor_units[49] * fwd_A[49]
-                * exp(fwd_beta[49] * tc[0] - activation_units[49] * fwd_Ea[49] * invT);
+    k_f = k_f_s[49];
     dlnkfdT = fwd_beta[49] * invT + activation_units[49] * fwd_Ea[49] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[10];
-    Kc = exp(g_RT[4] - g_RT[7] - g_RT[10] + g_RT[12]);
+    Kc = Kc_s[49];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[12]) + (h_RT[7] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19360,12 +18580,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[12];
-    k_f = prefactor_units[50] * fwd_A[50]
-                * exp(fwd_beta[50] * tc[0] - activation_units[50] * fwd_Ea[50] * invT);
+    k_f = k_f_s[50];
     dlnkfdT = fwd_beta[50] * invT + activation_units[50] * fwd_Ea[50] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[10];
-    Kc = exp(g_RT[3] - g_RT[8] - g_RT[10] + g_RT[12]);
+    Kc = Kc_s[50];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[12]) + (h_RT[8] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19411,12 +18630,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[13];
-    k_f = prefactor_units[51] * fwd_A[51]
-                * exp(fwd_beta[51] * tc[0] - activation_units[51] * fwd_Ea[51] * invT);
+    k_f = k_f_s[51];
     dlnkfdT = fwd_beta[51] * invT + activation_units[51] * fwd_Ea[51] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[12];
-    Kc = exp(g_RT[2] - g_RT[6] - g_RT[12] + g_RT[13]);
+    Kc = Kc_s[51];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[13]) + (h_RT[6] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19462,12 +18680,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[13];
-    k_f = prefactor_units[52] * fwd_A[52]
-                * exp(fwd_beta[52] * tc[0] - activation_units[52] * fwd_Ea[52] * invT);
+    k_f = k_f_s[52];
     dlnkfdT = fwd_beta[52] * invT + activation_units[52] * fwd_Ea[52] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[12];
-    Kc = exp(-g_RT[4] + g_RT[5] - g_RT[12] + g_RT[13]);
+    Kc = Kc_s[52];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[13]) + (h_RT[4] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19513,12 +18730,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[13];
-    k_f = prefactor_units[53] * fwd_A[53]
-                * exp(fwd_beta[53] * tc[0] - activation_units[53] * fwd_Ea[53] * invT);
+    k_f = k_f_s[53];
     dlnkfdT = fwd_beta[53] * invT + activation_units[53] * fwd_Ea[53] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[12];
-    Kc = exp(g_RT[4] - g_RT[7] - g_RT[12] + g_RT[13]);
+    Kc = Kc_s[53];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[13]) + (h_RT[7] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19564,12 +18780,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[14];
-    k_f = prefactor_units[54] * fwd_A[54]
-                * exp(fwd_beta[54] * tc[0] - activation_units[54] * fwd_Ea[54] * invT);
+    k_f = k_f_s[54];
     dlnkfdT = fwd_beta[54] * invT + activation_units[54] * fwd_Ea[54] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[15];
-    Kc = exp(g_RT[2] - g_RT[6] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[54];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[14]) + (h_RT[6] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19615,12 +18830,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[14];
-    k_f = prefactor_units[55] * fwd_A[55]
-                * exp(fwd_beta[55] * tc[0] - activation_units[55] * fwd_Ea[55] * invT);
+    k_f = k_f_s[55];
     dlnkfdT = fwd_beta[55] * invT + activation_units[55] * fwd_Ea[55] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[15];
-    Kc = exp(g_RT[4] - g_RT[7] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[55];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[14]) + (h_RT[7] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19666,12 +18880,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[14];
-    k_f = prefactor_units[56] * fwd_A[56]
-                * exp(fwd_beta[56] * tc[0] - activation_units[56] * fwd_Ea[56] * invT);
+    k_f = k_f_s[56];
     dlnkfdT = fwd_beta[56] * invT + activation_units[56] * fwd_Ea[56] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[15];
-    Kc = exp(-g_RT[4] + g_RT[5] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[56];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[14]) + (h_RT[4] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19717,12 +18930,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[14];
-    k_f = prefactor_units[57] * fwd_A[57]
-                * exp(fwd_beta[57] * tc[0] - activation_units[57] * fwd_Ea[57] * invT);
+    k_f = k_f_s[57];
     dlnkfdT = fwd_beta[57] * invT + activation_units[57] * fwd_Ea[57] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[15];
-    Kc = exp(g_RT[3] - g_RT[8] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[57];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[14]) + (h_RT[8] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19768,12 +18980,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[14];
-    k_f = prefactor_units[58] * fwd_A[58]
-                * exp(fwd_beta[58] * tc[0] - activation_units[58] * fwd_Ea[58] * invT);
+    k_f = k_f_s[58];
     dlnkfdT = fwd_beta[58] * invT + activation_units[58] * fwd_Ea[58] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[15];
-    Kc = exp(g_RT[8] - g_RT[9] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[58];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[14]) + (h_RT[9] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19819,12 +19030,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[15];
-    k_f = prefactor_units[59] * fwd_A[59]
-                * exp(fwd_beta[59] * tc[0] - activation_units[59] * fwd_Ea[59] * invT);
+    k_f = k_f_s[59];
     dlnkfdT = fwd_beta[59] * invT + activation_units[59] * fwd_Ea[59] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[16];
-    Kc = exp(g_RT[2] - g_RT[6] + g_RT[15] - g_RT[16]);
+    Kc = Kc_s[59];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[15]) + (h_RT[6] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19870,12 +19080,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[15];
-    k_f = prefactor_units[60] * fwd_A[60]
-                * exp(fwd_beta[60] * tc[0] - activation_units[60] * fwd_Ea[60] * invT);
+    k_f = k_f_s[60];
     dlnkfdT = fwd_beta[60] * invT + activation_units[60] * fwd_Ea[60] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[17];
-    Kc = exp(g_RT[2] - g_RT[6] + g_RT[15] - g_RT[17]);
+    Kc = Kc_s[60];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[15]) + (h_RT[6] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19921,12 +19130,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[15];
-    k_f = prefactor_units[61] * fwd_A[61]
-                * exp(fwd_beta[61] * tc[0] - activation_units[61] * fwd_Ea[61] * invT);
+    k_f = k_f_s[61];
     dlnkfdT = fwd_beta[61] * invT + activation_units[61] * fwd_Ea[61] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[17];
-    Kc = exp(g_RT[4] - g_RT[7] + g_RT[15] - g_RT[17]);
+    Kc = Kc_s[61];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[15]) + (h_RT[7] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19972,12 +19180,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[15];
-    k_f = prefactor_units[62] * fwd_A[62]
-                * exp(fwd_beta[62] * tc[0] - activation_units[62] * fwd_Ea[62] * invT);
+    k_f = k_f_s[62];
     dlnkfdT = fwd_beta[62] * invT + activation_units[62] * fwd_Ea[62] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[13];
-    Kc = exp(-g_RT[2] + g_RT[5] - g_RT[13] + g_RT[15]);
+    Kc = Kc_s[62];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[15]) + (h_RT[2] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20023,12 +19230,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[15]*sc[16];
-    k_f = prefactor_units[63] * fwd_A[63]
-                * exp(fwd_beta[63] * tc[0] - activation_units[63] * fwd_Ea[63] * invT);
+    k_f = k_f_s[63];
     dlnkfdT = fwd_beta[63] * invT + activation_units[63] * fwd_Ea[63] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[18];
-    Kc = exp(-g_RT[2] + g_RT[15] + g_RT[16] - g_RT[18]);
+    Kc = Kc_s[63];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[15] + h_RT[16]) + (h_RT[2] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20074,12 +19280,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[15];
-    k_f = prefactor_units[64] * fwd_A[64]
-                * exp(fwd_beta[64] * tc[0] - activation_units[64] * fwd_Ea[64] * invT);
+    k_f = k_f_s[64];
     dlnkfdT = fwd_beta[64] * invT + activation_units[64] * fwd_Ea[64] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[19];
-    Kc = exp(-g_RT[4] + g_RT[8] + g_RT[15] - g_RT[19]);
+    Kc = Kc_s[64];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[15]) + (h_RT[4] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20125,12 +19330,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[15];
-    k_f = prefactor_units[65] * fwd_A[65]
-                * exp(fwd_beta[65] * tc[0] - activation_units[65] * fwd_Ea[65] * invT);
+    k_f = k_f_s[65];
     dlnkfdT = fwd_beta[65] * invT + activation_units[65] * fwd_Ea[65] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[13];
-    Kc = exp(g_RT[3] - g_RT[4] - g_RT[13] + g_RT[15]);
+    Kc = Kc_s[65];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[15]) + (h_RT[4] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20176,12 +19380,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[15];
-    k_f = prefactor_units[66] * fwd_A[66]
-                * exp(fwd_beta[66] * tc[0] - activation_units[66] * fwd_Ea[66] * invT);
+    k_f = k_f_s[66];
     dlnkfdT = fwd_beta[66] * invT + activation_units[66] * fwd_Ea[66] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[19];
-    Kc = exp(g_RT[3] - g_RT[5] + g_RT[15] - g_RT[19]);
+    Kc = Kc_s[66];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[15]) + (h_RT[5] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20227,12 +19430,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[15]*sc[15];
-    k_f = prefactor_units[67] * fwd_A[67]
-                * exp(fwd_beta[67] * tc[0] - activation_units[67] * fwd_Ea[67] * invT);
+    k_f = k_f_s[67];
     dlnkfdT = fwd_beta[67] * invT + activation_units[67] * fwd_Ea[67] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[18];
-    Kc = exp(-g_RT[6] + 2*g_RT[15] - g_RT[18]);
+    Kc = Kc_s[67];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[15]) + (h_RT[6] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20267,12 +19469,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[15]*sc[15];
-    k_f = prefactor_units[68] * fwd_A[68]
-                * exp(fwd_beta[68] * tc[0] - activation_units[68] * fwd_Ea[68] * invT);
+    k_f = k_f_s[68];
     dlnkfdT = fwd_beta[68] * invT + activation_units[68] * fwd_Ea[68] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[20];
-    Kc = exp(-g_RT[2] + 2*g_RT[15] - g_RT[20]);
+    Kc = Kc_s[68];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[15]) + (h_RT[2] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20307,12 +19508,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[17];
-    k_f = prefactor_units[69] * fwd_A[69]
-                * exp(fwd_beta[69] * tc[0] - activation_units[69] * fwd_Ea[69] * invT);
+    k_f = k_f_s[69];
     dlnkfdT = fwd_beta[69] * invT + activation_units[69] * fwd_Ea[69] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[13];
-    Kc = exp(-g_RT[2] + g_RT[4] - g_RT[13] + g_RT[17]);
+    Kc = Kc_s[69];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[17]) + (h_RT[2] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20358,12 +19558,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[17];
-    k_f = prefactor_units[70] * fwd_A[70]
-                * exp(fwd_beta[70] * tc[0] - activation_units[70] * fwd_Ea[70] * invT);
+    k_f = k_f_s[70];
     dlnkfdT = fwd_beta[70] * invT + activation_units[70] * fwd_Ea[70] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[4]*sc[10];
-    Kc = refC * exp(-g_RT[2] + g_RT[3] - g_RT[4] - g_RT[10] + g_RT[17]);
+    Kc = Kc_s[70];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[17]) + (h_RT[2] + h_RT[4] + h_RT[10]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20422,12 +19621,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[17];
-    k_f = prefactor_units[71] * fwd_A[71]
-                * exp(fwd_beta[71] * tc[0] - activation_units[71] * fwd_Ea[71] * invT);
+    k_f = k_f_s[71];
     dlnkfdT = fwd_beta[71] * invT + activation_units[71] * fwd_Ea[71] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[13];
-    Kc = exp(-g_RT[10] + g_RT[11] - g_RT[13] + g_RT[17]);
+    Kc = Kc_s[71];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[17]) + (h_RT[10] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20473,12 +19671,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[16];
-    k_f = prefactor_units[72] * fwd_A[72]
-                * exp(fwd_beta[72] * tc[0] - activation_units[72] * fwd_Ea[72] * invT);
+    k_f = k_f_s[72];
     dlnkfdT = fwd_beta[72] * invT + activation_units[72] * fwd_Ea[72] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[22];
-    Kc = exp(g_RT[2] - g_RT[6] + g_RT[16] - g_RT[22]);
+    Kc = Kc_s[72];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[16]) + (h_RT[6] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20524,12 +19721,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[16];
-    k_f = prefactor_units[73] * fwd_A[73]
-                * exp(fwd_beta[73] * tc[0] - activation_units[73] * fwd_Ea[73] * invT);
+    k_f = k_f_s[73];
     dlnkfdT = fwd_beta[73] * invT + activation_units[73] * fwd_Ea[73] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[13];
-    Kc = exp(-g_RT[2] + g_RT[4] - g_RT[13] + g_RT[16]);
+    Kc = Kc_s[73];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[16]) + (h_RT[2] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20575,12 +19771,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[16];
-    k_f = prefactor_units[74] * fwd_A[74]
-                * exp(fwd_beta[74] * tc[0] - activation_units[74] * fwd_Ea[74] * invT);
+    k_f = k_f_s[74];
     dlnkfdT = fwd_beta[74] * invT + activation_units[74] * fwd_Ea[74] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[22];
-    Kc = exp(g_RT[4] - g_RT[7] + g_RT[16] - g_RT[22]);
+    Kc = Kc_s[74];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[16]) + (h_RT[7] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20626,12 +19821,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[16];
-    k_f = prefactor_units[75] * fwd_A[75]
-                * exp(fwd_beta[75] * tc[0] - activation_units[75] * fwd_Ea[75] * invT);
+    k_f = k_f_s[75];
     dlnkfdT = fwd_beta[75] * invT + activation_units[75] * fwd_Ea[75] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[2]*sc[10];
-    Kc = refC * exp(-2*g_RT[2] + g_RT[5] - g_RT[10] + g_RT[16]);
+    Kc = Kc_s[75];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[16]) + (2*h_RT[2] + h_RT[10]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20677,12 +19871,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[16];
-    k_f = prefactor_units[76] * fwd_A[76]
-                * exp(fwd_beta[76] * tc[0] - activation_units[76] * fwd_Ea[76] * invT);
+    k_f = k_f_s[76];
     dlnkfdT = fwd_beta[76] * invT + activation_units[76] * fwd_Ea[76] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[10];
-    Kc = exp(g_RT[5] - g_RT[6] - g_RT[10] + g_RT[16]);
+    Kc = Kc_s[76];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[16]) + (h_RT[6] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20728,12 +19921,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[16];
-    k_f = prefactor_units[77] * fwd_A[77]
-                * exp(fwd_beta[77] * tc[0] - activation_units[77] * fwd_Ea[77] * invT);
+    k_f = k_f_s[77];
     dlnkfdT = fwd_beta[77] * invT + activation_units[77] * fwd_Ea[77] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[11];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[11] + g_RT[16]);
+    Kc = Kc_s[77];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[16]) + (h_RT[6] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20779,12 +19971,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[16];
-    k_f = prefactor_units[78] * fwd_A[78]
-                * exp(fwd_beta[78] * tc[0] - activation_units[78] * fwd_Ea[78] * invT);
+    k_f = k_f_s[78];
     dlnkfdT = fwd_beta[78] * invT + activation_units[78] * fwd_Ea[78] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[4]*sc[10];
-    Kc = refC * exp(-g_RT[2] + g_RT[3] - g_RT[4] - g_RT[10] + g_RT[16]);
+    Kc = Kc_s[78];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[16]) + (h_RT[2] + h_RT[4] + h_RT[10]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20843,12 +20034,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[16];
-    k_f = prefactor_units[79] * fwd_A[79]
-                * exp(fwd_beta[79] * tc[0] - activation_units[79] * fwd_Ea[79] * invT);
+    k_f = k_f_s[79];
     dlnkfdT = fwd_beta[79] * invT + activation_units[79] * fwd_Ea[79] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[2]*sc[23];
-    Kc = refC * exp(-2*g_RT[2] + 2*g_RT[16] - g_RT[23]);
+    Kc = Kc_s[79];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[16]) + (2*h_RT[2] + h_RT[23]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20883,12 +20073,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[22];
-    k_f = prefactor_units[80] * fwd_A[80]
-                * exp(fwd_beta[80] * tc[0] - activation_units[80] * fwd_Ea[80] * invT);
+    k_f = k_f_s[80];
     dlnkfdT = fwd_beta[80] * invT + activation_units[80] * fwd_Ea[80] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[10];
-    Kc = exp(-g_RT[2] + g_RT[5] - g_RT[10] + g_RT[22]);
+    Kc = Kc_s[80];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[22]) + (h_RT[2] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20934,12 +20123,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[22];
-    k_f = prefactor_units[81] * fwd_A[81]
-                * exp(fwd_beta[81] * tc[0] - activation_units[81] * fwd_Ea[81] * invT);
+    k_f = k_f_s[81];
     dlnkfdT = fwd_beta[81] * invT + activation_units[81] * fwd_Ea[81] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[12];
-    Kc = exp(g_RT[3] - g_RT[5] - g_RT[12] + g_RT[22]);
+    Kc = Kc_s[81];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[22]) + (h_RT[5] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20985,12 +20173,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[22];
-    k_f = prefactor_units[82] * fwd_A[82]
-                * exp(fwd_beta[82] * tc[0] - activation_units[82] * fwd_Ea[82] * invT);
+    k_f = k_f_s[82];
     dlnkfdT = fwd_beta[82] * invT + activation_units[82] * fwd_Ea[82] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[13];
-    Kc = exp(-g_RT[2] + g_RT[7] - g_RT[13] + g_RT[22]);
+    Kc = Kc_s[82];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[22]) + (h_RT[2] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21036,12 +20223,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[22];
-    k_f = prefactor_units[83] * fwd_A[83]
-                * exp(fwd_beta[83] * tc[0] - activation_units[83] * fwd_Ea[83] * invT);
+    k_f = k_f_s[83];
     dlnkfdT = fwd_beta[83] * invT + activation_units[83] * fwd_Ea[83] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[12];
-    Kc = exp(-g_RT[10] + g_RT[11] - g_RT[12] + g_RT[22]);
+    Kc = Kc_s[83];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[22]) + (h_RT[10] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21087,12 +20273,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[19];
-    k_f = prefactor_units[84] * fwd_A[84]
-                * exp(fwd_beta[84] * tc[0] - activation_units[84] * fwd_Ea[84] * invT);
+    k_f = k_f_s[84];
     dlnkfdT = fwd_beta[84] * invT + activation_units[84] * fwd_Ea[84] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[13];
-    Kc = exp(g_RT[2] - g_RT[6] - g_RT[13] + g_RT[19]);
+    Kc = Kc_s[84];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[19]) + (h_RT[6] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21138,12 +20323,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[19];
-    k_f = prefactor_units[85] * fwd_A[85]
-                * exp(fwd_beta[85] * tc[0] - activation_units[85] * fwd_Ea[85] * invT);
+    k_f = k_f_s[85];
     dlnkfdT = fwd_beta[85] * invT + activation_units[85] * fwd_Ea[85] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[17];
-    Kc = exp(g_RT[2] - g_RT[7] - g_RT[17] + g_RT[19]);
+    Kc = Kc_s[85];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[19]) + (h_RT[7] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21189,12 +20373,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[19];
-    k_f = prefactor_units[86] * fwd_A[86]
-                * exp(fwd_beta[86] * tc[0] - activation_units[86] * fwd_Ea[86] * invT);
+    k_f = k_f_s[86];
     dlnkfdT = fwd_beta[86] * invT + activation_units[86] * fwd_Ea[86] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[13];
-    Kc = exp(g_RT[4] - g_RT[7] - g_RT[13] + g_RT[19]);
+    Kc = Kc_s[86];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[19]) + (h_RT[7] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21240,12 +20423,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[19];
-    k_f = prefactor_units[87] * fwd_A[87]
-                * exp(fwd_beta[87] * tc[0] - activation_units[87] * fwd_Ea[87] * invT);
+    k_f = k_f_s[87];
     dlnkfdT = fwd_beta[87] * invT + activation_units[87] * fwd_Ea[87] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[13];
-    Kc = exp(-g_RT[4] + g_RT[5] - g_RT[13] + g_RT[19]);
+    Kc = Kc_s[87];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[19]) + (h_RT[4] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21291,12 +20473,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[19];
-    k_f = prefactor_units[88] * fwd_A[88]
-                * exp(fwd_beta[88] * tc[0] - activation_units[88] * fwd_Ea[88] * invT);
+    k_f = k_f_s[88];
     dlnkfdT = fwd_beta[88] * invT + activation_units[88] * fwd_Ea[88] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[13];
-    Kc = exp(g_RT[3] - g_RT[8] - g_RT[13] + g_RT[19]);
+    Kc = Kc_s[88];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[19]) + (h_RT[8] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21342,12 +20523,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[21];
-    k_f = prefactor_units[89] * fwd_A[89]
-                * exp(fwd_beta[89] * tc[0] - activation_units[89] * fwd_Ea[89] * invT);
+    k_f = k_f_s[89];
     dlnkfdT = fwd_beta[89] * invT + activation_units[89] * fwd_Ea[89] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[20];
-    Kc = exp(g_RT[2] - g_RT[6] - g_RT[20] + g_RT[21]);
+    Kc = Kc_s[89];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[21]) + (h_RT[6] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21393,12 +20573,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[21];
-    k_f = prefactor_units[90] * fwd_A[90]
-                * exp(fwd_beta[90] * tc[0] - activation_units[90] * fwd_Ea[90] * invT);
+    k_f = k_f_s[90];
     dlnkfdT = fwd_beta[90] * invT + activation_units[90] * fwd_Ea[90] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[20];
-    Kc = exp(-g_RT[4] + g_RT[5] - g_RT[20] + g_RT[21]);
+    Kc = Kc_s[90];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[21]) + (h_RT[4] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21444,12 +20623,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[21];
-    k_f = prefactor_units[91] * fwd_A[91]
-                * exp(fwd_beta[91] * tc[0] - activation_units[91] * fwd_Ea[91] * invT);
+    k_f = k_f_s[91];
     dlnkfdT = fwd_beta[91] * invT + activation_units[91] * fwd_Ea[91] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[20];
-    Kc = exp(g_RT[4] - g_RT[7] - g_RT[20] + g_RT[21]);
+    Kc = Kc_s[91];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[21]) + (h_RT[7] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21495,12 +20673,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[15]*sc[21];
-    k_f = prefactor_units[92] * fwd_A[92]
-                * exp(fwd_beta[92] * tc[0] - activation_units[92] * fwd_Ea[92] * invT);
+    k_f = k_f_s[92];
     dlnkfdT = fwd_beta[92] * invT + activation_units[92] * fwd_Ea[92] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[20];
-    Kc = exp(-g_RT[14] + g_RT[15] - g_RT[20] + g_RT[21]);
+    Kc = Kc_s[92];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[15] + h_RT[21]) + (h_RT[14] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21546,12 +20723,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[20];
-    k_f = prefactor_units[93] * fwd_A[93]
-                * exp(fwd_beta[93] * tc[0] - activation_units[93] * fwd_Ea[93] * invT);
+    k_f = k_f_s[93];
     dlnkfdT = fwd_beta[93] * invT + activation_units[93] * fwd_Ea[93] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[18];
-    Kc = exp(g_RT[2] - g_RT[6] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[93];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[20]) + (h_RT[6] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21597,12 +20773,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[20];
-    k_f = prefactor_units[94] * fwd_A[94]
-                * exp(fwd_beta[94] * tc[0] - activation_units[94] * fwd_Ea[94] * invT);
+    k_f = k_f_s[94];
     dlnkfdT = fwd_beta[94] * invT + activation_units[94] * fwd_Ea[94] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[18];
-    Kc = exp(-g_RT[4] + g_RT[5] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[94];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[20]) + (h_RT[4] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21648,12 +20823,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[20];
-    k_f = prefactor_units[95] * fwd_A[95]
-                * exp(fwd_beta[95] * tc[0] - activation_units[95] * fwd_Ea[95] * invT);
+    k_f = k_f_s[95];
     dlnkfdT = fwd_beta[95] * invT + activation_units[95] * fwd_Ea[95] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[15];
-    Kc = exp(g_RT[5] - g_RT[13] - g_RT[15] + g_RT[20]);
+    Kc = Kc_s[95];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[20]) + (h_RT[13] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21699,12 +20873,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[20];
-    k_f = prefactor_units[96] * fwd_A[96]
-                * exp(fwd_beta[96] * tc[0] - activation_units[96] * fwd_Ea[96] * invT);
+    k_f = k_f_s[96];
     dlnkfdT = fwd_beta[96] * invT + activation_units[96] * fwd_Ea[96] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[18];
-    Kc = exp(g_RT[3] - g_RT[8] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[96];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[20]) + (h_RT[8] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21750,12 +20923,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[18];
-    k_f = prefactor_units[97] * fwd_A[97]
-                * exp(fwd_beta[97] * tc[0] - activation_units[97] * fwd_Ea[97] * invT);
+    k_f = k_f_s[97];
     dlnkfdT = fwd_beta[97] * invT + activation_units[97] * fwd_Ea[97] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[24];
-    Kc = exp(g_RT[2] - g_RT[6] + g_RT[18] - g_RT[24]);
+    Kc = Kc_s[97];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[18]) + (h_RT[6] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21801,12 +20973,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[18];
-    k_f = prefactor_units[98] * fwd_A[98]
-                * exp(fwd_beta[98] * tc[0] - activation_units[98] * fwd_Ea[98] * invT);
+    k_f = k_f_s[98];
     dlnkfdT = fwd_beta[98] * invT + activation_units[98] * fwd_Ea[98] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[24];
-    Kc = exp(g_RT[4] - g_RT[7] + g_RT[18] - g_RT[24]);
+    Kc = Kc_s[98];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[18]) + (h_RT[7] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21852,12 +21023,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[18];
-    k_f = prefactor_units[99] * fwd_A[99]
-                * exp(fwd_beta[99] * tc[0] - activation_units[99] * fwd_Ea[99] * invT);
+    k_f = k_f_s[99];
     dlnkfdT = fwd_beta[99] * invT + activation_units[99] * fwd_Ea[99] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[15];
-    Kc = exp(g_RT[5] - g_RT[12] - g_RT[15] + g_RT[18]);
+    Kc = Kc_s[99];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[18]) + (h_RT[12] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21903,12 +21073,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[18];
-    k_f = prefactor_units[100] * fwd_A[100]
-                * exp(fwd_beta[100] * tc[0] - activation_units[100] * fwd_Ea[100] * invT);
+    k_f = k_f_s[100];
     dlnkfdT = fwd_beta[100] * invT + activation_units[100] * fwd_Ea[100] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[25];
-    Kc = exp(-g_RT[2] + g_RT[5] + g_RT[18] - g_RT[25]);
+    Kc = Kc_s[100];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[18]) + (h_RT[2] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21954,12 +21123,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[18]*sc[18];
-    k_f = prefactor_units[101] * fwd_A[101]
-                * exp(fwd_beta[101] * tc[0] - activation_units[101] * fwd_Ea[101] * invT);
+    k_f = k_f_s[101];
     dlnkfdT = fwd_beta[101] * invT + activation_units[101] * fwd_Ea[101] * invT2;
     /* reverse */
     phi_r = sc[20]*sc[24];
-    Kc = exp(2*g_RT[18] - g_RT[20] - g_RT[24]);
+    Kc = Kc_s[101];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[18]) + (h_RT[20] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21994,12 +21162,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[18];
-    k_f = prefactor_units[102] * fwd_A[102]
-                * exp(fwd_beta[102] * tc[0] - activation_units[102] * fwd_Ea[102] * invT);
+    k_f = k_f_s[102];
     dlnkfdT = fwd_beta[102] * invT + activation_units[102] * fwd_Ea[102] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[24];
-    Kc = exp(g_RT[3] - g_RT[8] + g_RT[18] - g_RT[24]);
+    Kc = Kc_s[102];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[18]) + (h_RT[8] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22045,12 +21212,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[18];
-    k_f = prefactor_units[103] * fwd_A[103]
-                * exp(fwd_beta[103] * tc[0] - activation_units[103] * fwd_Ea[103] * invT);
+    k_f = k_f_s[103];
     dlnkfdT = fwd_beta[103] * invT + activation_units[103] * fwd_Ea[103] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[26];
-    Kc = exp(-g_RT[4] + g_RT[8] + g_RT[18] - g_RT[26]);
+    Kc = Kc_s[103];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[18]) + (h_RT[4] + h_RT[26]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22096,12 +21262,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[26];
-    k_f = prefactor_units[104] * fwd_A[104]
-                * exp(fwd_beta[104] * tc[0] - activation_units[104] * fwd_Ea[104] * invT);
+    k_f = k_f_s[104];
     dlnkfdT = fwd_beta[104] * invT + activation_units[104] * fwd_Ea[104] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[10]*sc[15];
-    Kc = refC * exp(g_RT[8] - g_RT[9] - g_RT[10] - g_RT[15] + g_RT[26]);
+    Kc = Kc_s[104];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[26]) + (h_RT[9] + h_RT[10] + h_RT[15]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22160,12 +21325,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[24];
-    k_f = prefactor_units[105] * fwd_A[105]
-                * exp(fwd_beta[105] * tc[0] - activation_units[105] * fwd_Ea[105] * invT);
+    k_f = k_f_s[105];
     dlnkfdT = fwd_beta[105] * invT + activation_units[105] * fwd_Ea[105] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[23];
-    Kc = exp(g_RT[2] - g_RT[6] - g_RT[23] + g_RT[24]);
+    Kc = Kc_s[105];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[24]) + (h_RT[6] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22211,12 +21375,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[24];
-    k_f = prefactor_units[106] * fwd_A[106]
-                * exp(fwd_beta[106] * tc[0] - activation_units[106] * fwd_Ea[106] * invT);
+    k_f = k_f_s[106];
     dlnkfdT = fwd_beta[106] * invT + activation_units[106] * fwd_Ea[106] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[13];
-    Kc = exp(g_RT[3] - g_RT[12] - g_RT[13] + g_RT[24]);
+    Kc = Kc_s[106];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[24]) + (h_RT[12] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22262,12 +21425,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[24];
-    k_f = prefactor_units[107] * fwd_A[107]
-                * exp(fwd_beta[107] * tc[0] - activation_units[107] * fwd_Ea[107] * invT);
+    k_f = k_f_s[107];
     dlnkfdT = fwd_beta[107] * invT + activation_units[107] * fwd_Ea[107] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[25];
-    Kc = exp(g_RT[3] - g_RT[5] + g_RT[24] - g_RT[25]);
+    Kc = Kc_s[107];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[24]) + (h_RT[5] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22313,12 +21475,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[24];
-    k_f = prefactor_units[108] * fwd_A[108]
-                * exp(fwd_beta[108] * tc[0] - activation_units[108] * fwd_Ea[108] * invT);
+    k_f = k_f_s[108];
     dlnkfdT = fwd_beta[108] * invT + activation_units[108] * fwd_Ea[108] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[23];
-    Kc = exp(g_RT[3] - g_RT[8] - g_RT[23] + g_RT[24]);
+    Kc = Kc_s[108];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[24]) + (h_RT[8] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22364,12 +21525,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[25];
-    k_f = prefactor_units[109] * fwd_A[109]
-                * exp(fwd_beta[109] * tc[0] - activation_units[109] * fwd_Ea[109] * invT);
+    k_f = k_f_s[109];
     dlnkfdT = fwd_beta[109] * invT + activation_units[109] * fwd_Ea[109] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[27];
-    Kc = refC * exp(-g_RT[2] + g_RT[25] - g_RT[27]);
+    Kc = Kc_s[109];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[25]) + (h_RT[2] + h_RT[27]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22404,12 +21564,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[23];
-    k_f = prefactor_units[110] * fwd_A[110]
-                * exp(fwd_beta[110] * tc[0] - activation_units[110] * fwd_Ea[110] * invT);
+    k_f = k_f_s[110];
     dlnkfdT = fwd_beta[110] * invT + activation_units[110] * fwd_Ea[110] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[28];
-    Kc = exp(-g_RT[2] + g_RT[5] + g_RT[23] - g_RT[28]);
+    Kc = Kc_s[110];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[23]) + (h_RT[2] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22455,12 +21614,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[23];
-    k_f = prefactor_units[111] * fwd_A[111]
-                * exp(fwd_beta[111] * tc[0] - activation_units[111] * fwd_Ea[111] * invT);
+    k_f = k_f_s[111];
     dlnkfdT = fwd_beta[111] * invT + activation_units[111] * fwd_Ea[111] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[16];
-    Kc = exp(g_RT[5] - g_RT[10] - g_RT[16] + g_RT[23]);
+    Kc = Kc_s[111];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[23]) + (h_RT[10] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22506,12 +21664,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[23];
-    k_f = prefactor_units[112] * fwd_A[112]
-                * exp(fwd_beta[112] * tc[0] - activation_units[112] * fwd_Ea[112] * invT);
+    k_f = k_f_s[112];
     dlnkfdT = fwd_beta[112] * invT + activation_units[112] * fwd_Ea[112] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[13];
-    Kc = exp(g_RT[3] - g_RT[10] - g_RT[13] + g_RT[23]);
+    Kc = Kc_s[112];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[23]) + (h_RT[10] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22557,12 +21714,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[23];
-    k_f = prefactor_units[113] * fwd_A[113]
-                * exp(fwd_beta[113] * tc[0] - activation_units[113] * fwd_Ea[113] * invT);
+    k_f = k_f_s[113];
     dlnkfdT = fwd_beta[113] * invT + activation_units[113] * fwd_Ea[113] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[27];
-    Kc = exp(-g_RT[2] + g_RT[4] + g_RT[23] - g_RT[27]);
+    Kc = Kc_s[113];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[23]) + (h_RT[2] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22608,12 +21764,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[23];
-    k_f = prefactor_units[114] * fwd_A[114]
-                * exp(fwd_beta[114] * tc[0] - activation_units[114] * fwd_Ea[114] * invT);
+    k_f = k_f_s[114];
     dlnkfdT = fwd_beta[114] * invT + activation_units[114] * fwd_Ea[114] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[29];
-    Kc = exp(g_RT[4] - g_RT[7] + g_RT[23] - g_RT[29]);
+    Kc = Kc_s[114];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[23]) + (h_RT[7] + h_RT[29]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22659,12 +21814,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[27];
-    k_f = prefactor_units[115] * fwd_A[115]
-                * exp(fwd_beta[115] * tc[0] - activation_units[115] * fwd_Ea[115] * invT);
+    k_f = k_f_s[115];
     dlnkfdT = fwd_beta[115] * invT + activation_units[115] * fwd_Ea[115] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[15];
-    Kc = exp(g_RT[2] - g_RT[10] - g_RT[15] + g_RT[27]);
+    Kc = Kc_s[115];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[27]) + (h_RT[10] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22710,12 +21864,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[27];
-    k_f = prefactor_units[116] * fwd_A[116]
-                * exp(fwd_beta[116] * tc[0] - activation_units[116] * fwd_Ea[116] * invT);
+    k_f = k_f_s[116];
     dlnkfdT = fwd_beta[116] * invT + activation_units[116] * fwd_Ea[116] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[16];
-    Kc = exp(g_RT[5] - g_RT[11] - g_RT[16] + g_RT[27]);
+    Kc = Kc_s[116];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[27]) + (h_RT[11] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22761,12 +21914,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[27];
-    k_f = prefactor_units[117] * fwd_A[117]
-                * exp(fwd_beta[117] * tc[0] - activation_units[117] * fwd_Ea[117] * invT);
+    k_f = k_f_s[117];
     dlnkfdT = fwd_beta[117] * invT + activation_units[117] * fwd_Ea[117] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[28];
-    Kc = exp(-g_RT[4] + g_RT[5] + g_RT[27] - g_RT[28]);
+    Kc = Kc_s[117];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[27]) + (h_RT[4] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22812,12 +21964,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[15]*sc[27];
-    k_f = prefactor_units[118] * fwd_A[118]
-                * exp(fwd_beta[118] * tc[0] - activation_units[118] * fwd_Ea[118] * invT);
+    k_f = k_f_s[118];
     dlnkfdT = fwd_beta[118] * invT + activation_units[118] * fwd_Ea[118] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[20];
-    Kc = exp(-g_RT[10] + g_RT[15] - g_RT[20] + g_RT[27]);
+    Kc = Kc_s[118];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[15] + h_RT[27]) + (h_RT[10] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22863,12 +22014,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[28];
-    k_f = prefactor_units[119] * fwd_A[119]
-                * exp(fwd_beta[119] * tc[0] - activation_units[119] * fwd_Ea[119] * invT);
+    k_f = k_f_s[119];
     dlnkfdT = fwd_beta[119] * invT + activation_units[119] * fwd_Ea[119] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[17];
-    Kc = exp(g_RT[2] - g_RT[10] - g_RT[17] + g_RT[28]);
+    Kc = Kc_s[119];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[28]) + (h_RT[10] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22914,12 +22064,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[28];
-    k_f = prefactor_units[120] * fwd_A[120]
-                * exp(fwd_beta[120] * tc[0] - activation_units[120] * fwd_Ea[120] * invT);
+    k_f = k_f_s[120];
     dlnkfdT = fwd_beta[120] * invT + activation_units[120] * fwd_Ea[120] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[10]*sc[12];
-    Kc = refC * exp(-g_RT[2] + g_RT[4] - g_RT[10] - g_RT[12] + g_RT[28]);
+    Kc = Kc_s[120];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[28]) + (h_RT[2] + h_RT[10] + h_RT[12]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22978,12 +22127,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[28];
-    k_f = prefactor_units[121] * fwd_A[121]
-                * exp(fwd_beta[121] * tc[0] - activation_units[121] * fwd_Ea[121] * invT);
+    k_f = k_f_s[121];
     dlnkfdT = fwd_beta[121] * invT + activation_units[121] * fwd_Ea[121] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[10]*sc[10];
-    Kc = refC * exp(-g_RT[2] + g_RT[5] - 2*g_RT[10] + g_RT[28]);
+    Kc = Kc_s[121];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[28]) + (h_RT[2] + 2*h_RT[10]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23029,12 +22177,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[28];
-    k_f = prefactor_units[122] * fwd_A[122]
-                * exp(fwd_beta[122] * tc[0] - activation_units[122] * fwd_Ea[122] * invT);
+    k_f = k_f_s[122];
     dlnkfdT = fwd_beta[122] * invT + activation_units[122] * fwd_Ea[122] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[10]*sc[10];
-    Kc = refC * exp(g_RT[3] - g_RT[4] - 2*g_RT[10] + g_RT[28]);
+    Kc = Kc_s[122];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[28]) + (h_RT[4] + 2*h_RT[10]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23080,12 +22227,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[28];
-    k_f = prefactor_units[123] * fwd_A[123]
-                * exp(fwd_beta[123] * tc[0] - activation_units[123] * fwd_Ea[123] * invT);
+    k_f = k_f_s[123];
     dlnkfdT = fwd_beta[123] * invT + activation_units[123] * fwd_Ea[123] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[10]*sc[11];
-    Kc = refC * exp(-g_RT[2] + g_RT[3] - g_RT[10] - g_RT[11] + g_RT[28]);
+    Kc = Kc_s[123];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[28]) + (h_RT[2] + h_RT[10] + h_RT[11]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23144,12 +22290,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[29];
-    k_f = prefactor_units[124] * fwd_A[124]
-                * exp(fwd_beta[124] * tc[0] - activation_units[124] * fwd_Ea[124] * invT);
+    k_f = k_f_s[124];
     dlnkfdT = fwd_beta[124] * invT + activation_units[124] * fwd_Ea[124] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[28];
-    Kc = exp(-g_RT[2] + g_RT[4] - g_RT[28] + g_RT[29]);
+    Kc = Kc_s[124];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[29]) + (h_RT[2] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23195,12 +22340,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[29];
-    k_f = prefactor_units[125] * fwd_A[125]
-                * exp(fwd_beta[125] * tc[0] - activation_units[125] * fwd_Ea[125] * invT);
+    k_f = k_f_s[125];
     dlnkfdT = fwd_beta[125] * invT + activation_units[125] * fwd_Ea[125] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[22];
-    Kc = exp(g_RT[5] - g_RT[10] - g_RT[22] + g_RT[29]);
+    Kc = Kc_s[125];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[29]) + (h_RT[10] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23246,12 +22390,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[29];
-    k_f = prefactor_units[126] * fwd_A[126]
-                * exp(fwd_beta[126] * tc[0] - activation_units[126] * fwd_Ea[126] * invT);
+    k_f = k_f_s[126];
     dlnkfdT = fwd_beta[126] * invT + activation_units[126] * fwd_Ea[126] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[28];
-    Kc = exp(g_RT[3] - g_RT[5] - g_RT[28] + g_RT[29]);
+    Kc = Kc_s[126];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[29]) + (h_RT[5] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23297,12 +22440,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[29];
-    k_f = prefactor_units[127] * fwd_A[127]
-                * exp(fwd_beta[127] * tc[0] - activation_units[127] * fwd_Ea[127] * invT);
+    k_f = k_f_s[127];
     dlnkfdT = fwd_beta[127] * invT + activation_units[127] * fwd_Ea[127] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[22];
-    Kc = exp(g_RT[3] - g_RT[11] - g_RT[22] + g_RT[29]);
+    Kc = Kc_s[127];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[29]) + (h_RT[11] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23348,12 +22490,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[29];
-    k_f = prefactor_units[128] * fwd_A[128]
-                * exp(fwd_beta[128] * tc[0] - activation_units[128] * fwd_Ea[128] * invT);
+    k_f = k_f_s[128];
     dlnkfdT = fwd_beta[128] * invT + activation_units[128] * fwd_Ea[128] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[12];
-    Kc = exp(g_RT[3] - g_RT[10] - g_RT[12] + g_RT[29]);
+    Kc = Kc_s[128];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[29]) + (h_RT[10] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23399,12 +22540,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[30];
-    k_f = prefactor_units[129] * fwd_A[129]
-                * exp(fwd_beta[129] * tc[0] - activation_units[129] * fwd_Ea[129] * invT);
+    k_f = k_f_s[129];
     dlnkfdT = fwd_beta[129] * invT + activation_units[129] * fwd_Ea[129] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[13];
-    Kc = exp(g_RT[2] - g_RT[6] - g_RT[13] + g_RT[30]);
+    Kc = Kc_s[129];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[30]) + (h_RT[6] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23450,12 +22590,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[30];
-    k_f = prefactor_units[130] * fwd_A[130]
-                * exp(fwd_beta[130] * tc[0] - activation_units[130] * fwd_Ea[130] * invT);
+    k_f = k_f_s[130];
     dlnkfdT = fwd_beta[130] * invT + activation_units[130] * fwd_Ea[130] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[15];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[15] + g_RT[30]);
+    Kc = Kc_s[130];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[30]) + (h_RT[4] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23501,12 +22640,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[30];
-    k_f = prefactor_units[131] * fwd_A[131]
-                * exp(fwd_beta[131] * tc[0] - activation_units[131] * fwd_Ea[131] * invT);
+    k_f = k_f_s[131];
     dlnkfdT = fwd_beta[131] * invT + activation_units[131] * fwd_Ea[131] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[13];
-    Kc = exp(g_RT[4] - g_RT[7] - g_RT[13] + g_RT[30]);
+    Kc = Kc_s[131];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[30]) + (h_RT[7] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23552,12 +22690,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[30];
-    k_f = prefactor_units[132] * fwd_A[132]
-                * exp(fwd_beta[132] * tc[0] - activation_units[132] * fwd_Ea[132] * invT);
+    k_f = k_f_s[132];
     dlnkfdT = fwd_beta[132] * invT + activation_units[132] * fwd_Ea[132] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[13];
-    Kc = exp(g_RT[3] - g_RT[8] - g_RT[13] + g_RT[30]);
+    Kc = Kc_s[132];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[30]) + (h_RT[8] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23603,12 +22740,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[27];
-    k_f = prefactor_units[133] * fwd_A[133]
-                * exp(fwd_beta[133] * tc[0] - activation_units[133] * fwd_Ea[133] * invT);
+    k_f = k_f_s[133];
     dlnkfdT = fwd_beta[133] * invT + activation_units[133] * fwd_Ea[133] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[30];
-    Kc = exp(g_RT[4] - g_RT[10] + g_RT[27] - g_RT[30]);
+    Kc = Kc_s[133];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[27]) + (h_RT[10] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23654,12 +22790,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[31];
-    k_f = prefactor_units[134] * fwd_A[134]
-                * exp(fwd_beta[134] * tc[0] - activation_units[134] * fwd_Ea[134] * invT);
+    k_f = k_f_s[134];
     dlnkfdT = fwd_beta[134] * invT + activation_units[134] * fwd_Ea[134] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[30];
-    Kc = exp(g_RT[4] - g_RT[7] - g_RT[30] + g_RT[31]);
+    Kc = Kc_s[134];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[31]) + (h_RT[7] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23705,12 +22840,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[31];
-    k_f = prefactor_units[135] * fwd_A[135]
-                * exp(fwd_beta[135] * tc[0] - activation_units[135] * fwd_Ea[135] * invT);
+    k_f = k_f_s[135];
     dlnkfdT = fwd_beta[135] * invT + activation_units[135] * fwd_Ea[135] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[19];
-    Kc = exp(g_RT[4] - g_RT[7] - g_RT[19] + g_RT[31]);
+    Kc = Kc_s[135];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[31]) + (h_RT[7] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23756,12 +22890,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[31];
-    k_f = prefactor_units[136] * fwd_A[136]
-                * exp(fwd_beta[136] * tc[0] - activation_units[136] * fwd_Ea[136] * invT);
+    k_f = k_f_s[136];
     dlnkfdT = fwd_beta[136] * invT + activation_units[136] * fwd_Ea[136] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[30];
-    Kc = exp(g_RT[2] - g_RT[6] - g_RT[30] + g_RT[31]);
+    Kc = Kc_s[136];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[31]) + (h_RT[6] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23807,12 +22940,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[31];
-    k_f = prefactor_units[137] * fwd_A[137]
-                * exp(fwd_beta[137] * tc[0] - activation_units[137] * fwd_Ea[137] * invT);
+    k_f = k_f_s[137];
     dlnkfdT = fwd_beta[137] * invT + activation_units[137] * fwd_Ea[137] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[19];
-    Kc = exp(g_RT[2] - g_RT[6] - g_RT[19] + g_RT[31]);
+    Kc = Kc_s[137];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[31]) + (h_RT[6] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23858,12 +22990,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[31];
-    k_f = prefactor_units[138] * fwd_A[138]
-                * exp(fwd_beta[138] * tc[0] - activation_units[138] * fwd_Ea[138] * invT);
+    k_f = k_f_s[138];
     dlnkfdT = fwd_beta[138] * invT + activation_units[138] * fwd_Ea[138] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[30];
-    Kc = exp(-g_RT[4] + g_RT[5] - g_RT[30] + g_RT[31]);
+    Kc = Kc_s[138];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[31]) + (h_RT[4] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23909,12 +23040,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[31];
-    k_f = prefactor_units[139] * fwd_A[139]
-                * exp(fwd_beta[139] * tc[0] - activation_units[139] * fwd_Ea[139] * invT);
+    k_f = k_f_s[139];
     dlnkfdT = fwd_beta[139] * invT + activation_units[139] * fwd_Ea[139] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[30];
-    Kc = exp(g_RT[8] - g_RT[9] - g_RT[30] + g_RT[31]);
+    Kc = Kc_s[139];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[31]) + (h_RT[9] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23960,12 +23090,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[31];
-    k_f = prefactor_units[140] * fwd_A[140]
-                * exp(fwd_beta[140] * tc[0] - activation_units[140] * fwd_Ea[140] * invT);
+    k_f = k_f_s[140];
     dlnkfdT = fwd_beta[140] * invT + activation_units[140] * fwd_Ea[140] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[30];
-    Kc = exp(g_RT[3] - g_RT[8] - g_RT[30] + g_RT[31]);
+    Kc = Kc_s[140];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[31]) + (h_RT[8] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24011,12 +23140,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[32];
-    k_f = prefactor_units[141] * fwd_A[141]
-                * exp(fwd_beta[141] * tc[0] - activation_units[141] * fwd_Ea[141] * invT);
+    k_f = k_f_s[141];
     dlnkfdT = fwd_beta[141] * invT + activation_units[141] * fwd_Ea[141] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[18];
-    Kc = exp(g_RT[5] - g_RT[10] - g_RT[18] + g_RT[32]);
+    Kc = Kc_s[141];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[32]) + (h_RT[10] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24062,12 +23190,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[15]*sc[23];
-    k_f = prefactor_units[142] * fwd_A[142]
-                * exp(fwd_beta[142] * tc[0] - activation_units[142] * fwd_Ea[142] * invT);
+    k_f = k_f_s[142];
     dlnkfdT = fwd_beta[142] * invT + activation_units[142] * fwd_Ea[142] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[32];
-    Kc = exp(-g_RT[2] + g_RT[15] + g_RT[23] - g_RT[32]);
+    Kc = Kc_s[142];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[15] + h_RT[23]) + (h_RT[2] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24113,12 +23240,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[32];
-    k_f = prefactor_units[143] * fwd_A[143]
-                * exp(fwd_beta[143] * tc[0] - activation_units[143] * fwd_Ea[143] * invT);
+    k_f = k_f_s[143];
     dlnkfdT = fwd_beta[143] * invT + activation_units[143] * fwd_Ea[143] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[28];
-    Kc = exp(g_RT[5] - g_RT[15] - g_RT[28] + g_RT[32]);
+    Kc = Kc_s[143];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[32]) + (h_RT[15] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24164,12 +23290,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[33];
-    k_f = prefactor_units[144] * fwd_A[144]
-                * exp(fwd_beta[144] * tc[0] - activation_units[144] * fwd_Ea[144] * invT);
+    k_f = k_f_s[144];
     dlnkfdT = fwd_beta[144] * invT + activation_units[144] * fwd_Ea[144] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[32];
-    Kc = exp(-g_RT[3] + g_RT[8] - g_RT[32] + g_RT[33]);
+    Kc = Kc_s[144];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[33]) + (h_RT[3] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24215,12 +23340,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[32];
-    k_f = prefactor_units[145] * fwd_A[145]
-                * exp(fwd_beta[145] * tc[0] - activation_units[145] * fwd_Ea[145] * invT);
+    k_f = k_f_s[145];
     dlnkfdT = fwd_beta[145] * invT + activation_units[145] * fwd_Ea[145] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[33];
-    Kc = exp(g_RT[4] - g_RT[7] + g_RT[32] - g_RT[33]);
+    Kc = Kc_s[145];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[32]) + (h_RT[7] + h_RT[33]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24266,12 +23390,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[33];
-    k_f = prefactor_units[146] * fwd_A[146]
-                * exp(fwd_beta[146] * tc[0] - activation_units[146] * fwd_Ea[146] * invT);
+    k_f = k_f_s[146];
     dlnkfdT = fwd_beta[146] * invT + activation_units[146] * fwd_Ea[146] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[27];
-    Kc = exp(g_RT[3] - g_RT[12] - g_RT[27] + g_RT[33]);
+    Kc = Kc_s[146];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[33]) + (h_RT[12] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24317,12 +23440,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[34];
-    k_f = prefactor_units[147] * fwd_A[147]
-                * exp(fwd_beta[147] * tc[0] - activation_units[147] * fwd_Ea[147] * invT);
+    k_f = k_f_s[147];
     dlnkfdT = fwd_beta[147] * invT + activation_units[147] * fwd_Ea[147] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[32];
-    Kc = exp(g_RT[2] - g_RT[6] - g_RT[32] + g_RT[34]);
+    Kc = Kc_s[147];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[34]) + (h_RT[6] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24368,12 +23490,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[34];
-    k_f = prefactor_units[148] * fwd_A[148]
-                * exp(fwd_beta[148] * tc[0] - activation_units[148] * fwd_Ea[148] * invT);
+    k_f = k_f_s[148];
     dlnkfdT = fwd_beta[148] * invT + activation_units[148] * fwd_Ea[148] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[32];
-    Kc = exp(g_RT[3] - g_RT[8] - g_RT[32] + g_RT[34]);
+    Kc = Kc_s[148];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[34]) + (h_RT[8] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24419,12 +23540,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[15]*sc[34];
-    k_f = prefactor_units[149] * fwd_A[149]
-                * exp(fwd_beta[149] * tc[0] - activation_units[149] * fwd_Ea[149] * invT);
+    k_f = k_f_s[149];
     dlnkfdT = fwd_beta[149] * invT + activation_units[149] * fwd_Ea[149] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[32];
-    Kc = exp(-g_RT[14] + g_RT[15] - g_RT[32] + g_RT[34]);
+    Kc = Kc_s[149];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[15] + h_RT[34]) + (h_RT[14] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24470,12 +23590,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[34];
-    k_f = prefactor_units[150] * fwd_A[150]
-                * exp(fwd_beta[150] * tc[0] - activation_units[150] * fwd_Ea[150] * invT);
+    k_f = k_f_s[150];
     dlnkfdT = fwd_beta[150] * invT + activation_units[150] * fwd_Ea[150] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[32];
-    Kc = exp(g_RT[4] - g_RT[7] - g_RT[32] + g_RT[34]);
+    Kc = Kc_s[150];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[34]) + (h_RT[7] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24521,12 +23640,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[33];
-    k_f = prefactor_units[151] * fwd_A[151]
-                * exp(fwd_beta[151] * tc[0] - activation_units[151] * fwd_Ea[151] * invT);
+    k_f = k_f_s[151];
     dlnkfdT = fwd_beta[151] * invT + activation_units[151] * fwd_Ea[151] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[32];
-    Kc = exp(-g_RT[10] + g_RT[12] - g_RT[32] + g_RT[33]);
+    Kc = Kc_s[151];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[33]) + (h_RT[10] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24572,12 +23690,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[33];
-    k_f = prefactor_units[152] * fwd_A[152]
-                * exp(fwd_beta[152] * tc[0] - activation_units[152] * fwd_Ea[152] * invT);
+    k_f = k_f_s[152];
     dlnkfdT = fwd_beta[152] * invT + activation_units[152] * fwd_Ea[152] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[10]*sc[24];
-    Kc = refC * exp(-g_RT[4] + g_RT[8] - g_RT[10] - g_RT[24] + g_RT[33]);
+    Kc = Kc_s[152];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[33]) + (h_RT[4] + h_RT[10] + h_RT[24]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24636,12 +23753,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[32];
-    k_f = prefactor_units[153] * fwd_A[153]
-                * exp(fwd_beta[153] * tc[0] - activation_units[153] * fwd_Ea[153] * invT);
+    k_f = k_f_s[153];
     dlnkfdT = fwd_beta[153] * invT + activation_units[153] * fwd_Ea[153] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[12]*sc[15];
-    Kc = refC * exp(g_RT[3] - g_RT[10] - g_RT[12] - g_RT[15] + g_RT[32]);
+    Kc = Kc_s[153];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[32]) + (h_RT[10] + h_RT[12] + h_RT[15]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24700,12 +23816,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[35];
-    k_f = prefactor_units[154] * fwd_A[154]
-                * exp(fwd_beta[154] * tc[0] - activation_units[154] * fwd_Ea[154] * invT);
+    k_f = k_f_s[154];
     dlnkfdT = fwd_beta[154] * invT + activation_units[154] * fwd_Ea[154] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[20];
-    Kc = exp(g_RT[5] - g_RT[12] - g_RT[20] + g_RT[35]);
+    Kc = Kc_s[154];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[35]) + (h_RT[12] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24751,12 +23866,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[35];
-    k_f = prefactor_units[155] * fwd_A[155]
-                * exp(fwd_beta[155] * tc[0] - activation_units[155] * fwd_Ea[155] * invT);
+    k_f = k_f_s[155];
     dlnkfdT = fwd_beta[155] * invT + activation_units[155] * fwd_Ea[155] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[34];
-    Kc = exp(g_RT[4] - g_RT[7] - g_RT[34] + g_RT[35]);
+    Kc = Kc_s[155];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[35]) + (h_RT[7] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24802,12 +23916,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[35];
-    k_f = prefactor_units[156] * fwd_A[156]
-                * exp(fwd_beta[156] * tc[0] - activation_units[156] * fwd_Ea[156] * invT);
+    k_f = k_f_s[156];
     dlnkfdT = fwd_beta[156] * invT + activation_units[156] * fwd_Ea[156] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[15]*sc[27];
-    Kc = refC * exp(-g_RT[2] + g_RT[5] - g_RT[15] - g_RT[27] + g_RT[35]);
+    Kc = Kc_s[156];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[35]) + (h_RT[2] + h_RT[15] + h_RT[27]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24866,12 +23979,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[35];
-    k_f = prefactor_units[157] * fwd_A[157]
-                * exp(fwd_beta[157] * tc[0] - activation_units[157] * fwd_Ea[157] * invT);
+    k_f = k_f_s[157];
     dlnkfdT = fwd_beta[157] * invT + activation_units[157] * fwd_Ea[157] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[34];
-    Kc = exp(g_RT[2] - g_RT[6] - g_RT[34] + g_RT[35]);
+    Kc = Kc_s[157];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[35]) + (h_RT[6] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24917,12 +24029,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[34];
-    k_f = prefactor_units[158] * fwd_A[158]
-                * exp(fwd_beta[158] * tc[0] - activation_units[158] * fwd_Ea[158] * invT);
+    k_f = k_f_s[158];
     dlnkfdT = fwd_beta[158] * invT + activation_units[158] * fwd_Ea[158] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[35];
-    Kc = exp(-g_RT[3] + g_RT[8] + g_RT[34] - g_RT[35]);
+    Kc = Kc_s[158];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[34]) + (h_RT[3] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24968,12 +24079,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[34];
-    k_f = prefactor_units[159] * fwd_A[159]
-                * exp(fwd_beta[159] * tc[0] - activation_units[159] * fwd_Ea[159] * invT);
+    k_f = k_f_s[159];
     dlnkfdT = fwd_beta[159] * invT + activation_units[159] * fwd_Ea[159] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[13]*sc[24];
-    Kc = refC * exp(-g_RT[4] + g_RT[8] - g_RT[13] - g_RT[24] + g_RT[34]);
+    Kc = Kc_s[159];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[34]) + (h_RT[4] + h_RT[13] + h_RT[24]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25032,12 +24142,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[35];
-    k_f = prefactor_units[160] * fwd_A[160]
-                * exp(fwd_beta[160] * tc[0] - activation_units[160] * fwd_Ea[160] * invT);
+    k_f = k_f_s[160];
     dlnkfdT = fwd_beta[160] * invT + activation_units[160] * fwd_Ea[160] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[18];
-    Kc = exp(g_RT[2] - g_RT[15] - g_RT[18] + g_RT[35]);
+    Kc = Kc_s[160];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[35]) + (h_RT[15] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25083,12 +24192,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[15]*sc[24];
-    k_f = prefactor_units[161] * fwd_A[161]
-                * exp(fwd_beta[161] * tc[0] - activation_units[161] * fwd_Ea[161] * invT);
+    k_f = k_f_s[161];
     dlnkfdT = fwd_beta[161] * invT + activation_units[161] * fwd_Ea[161] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[34];
-    Kc = exp(-g_RT[2] + g_RT[15] + g_RT[24] - g_RT[34]);
+    Kc = Kc_s[161];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[15] + h_RT[24]) + (h_RT[2] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25134,12 +24242,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[36];
-    k_f = prefactor_units[162] * fwd_A[162]
-                * exp(fwd_beta[162] * tc[0] - activation_units[162] * fwd_Ea[162] * invT);
+    k_f = k_f_s[162];
     dlnkfdT = fwd_beta[162] * invT + activation_units[162] * fwd_Ea[162] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[37];
-    Kc = exp(g_RT[3] - g_RT[8] + g_RT[36] - g_RT[37]);
+    Kc = Kc_s[162];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[36]) + (h_RT[8] + h_RT[37]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25185,12 +24292,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[36];
-    k_f = prefactor_units[163] * fwd_A[163]
-                * exp(fwd_beta[163] * tc[0] - activation_units[163] * fwd_Ea[163] * invT);
+    k_f = k_f_s[163];
     dlnkfdT = fwd_beta[163] * invT + activation_units[163] * fwd_Ea[163] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[38];
-    Kc = exp(g_RT[3] - g_RT[8] + g_RT[36] - g_RT[38]);
+    Kc = Kc_s[163];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[36]) + (h_RT[8] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25236,12 +24342,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[36];
-    k_f = prefactor_units[164] * fwd_A[164]
-                * exp(fwd_beta[164] * tc[0] - activation_units[164] * fwd_Ea[164] * invT);
+    k_f = k_f_s[164];
     dlnkfdT = fwd_beta[164] * invT + activation_units[164] * fwd_Ea[164] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[37];
-    Kc = exp(g_RT[2] - g_RT[6] + g_RT[36] - g_RT[37]);
+    Kc = Kc_s[164];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[36]) + (h_RT[6] + h_RT[37]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25287,12 +24392,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[36];
-    k_f = prefactor_units[165] * fwd_A[165]
-                * exp(fwd_beta[165] * tc[0] - activation_units[165] * fwd_Ea[165] * invT);
+    k_f = k_f_s[165];
     dlnkfdT = fwd_beta[165] * invT + activation_units[165] * fwd_Ea[165] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[38];
-    Kc = exp(g_RT[2] - g_RT[6] + g_RT[36] - g_RT[38]);
+    Kc = Kc_s[165];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[36]) + (h_RT[6] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25338,12 +24442,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[36];
-    k_f = prefactor_units[166] * fwd_A[166]
-                * exp(fwd_beta[166] * tc[0] - activation_units[166] * fwd_Ea[166] * invT);
+    k_f = k_f_s[166];
     dlnkfdT = fwd_beta[166] * invT + activation_units[166] * fwd_Ea[166] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[37];
-    Kc = exp(-g_RT[4] + g_RT[5] + g_RT[36] - g_RT[37]);
+    Kc = Kc_s[166];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[36]) + (h_RT[4] + h_RT[37]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25389,12 +24492,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[36];
-    k_f = prefactor_units[167] * fwd_A[167]
-                * exp(fwd_beta[167] * tc[0] - activation_units[167] * fwd_Ea[167] * invT);
+    k_f = k_f_s[167];
     dlnkfdT = fwd_beta[167] * invT + activation_units[167] * fwd_Ea[167] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[38];
-    Kc = exp(-g_RT[4] + g_RT[5] + g_RT[36] - g_RT[38]);
+    Kc = Kc_s[167];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[36]) + (h_RT[4] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25440,12 +24542,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[36];
-    k_f = prefactor_units[168] * fwd_A[168]
-                * exp(fwd_beta[168] * tc[0] - activation_units[168] * fwd_Ea[168] * invT);
+    k_f = k_f_s[168];
     dlnkfdT = fwd_beta[168] * invT + activation_units[168] * fwd_Ea[168] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[38];
-    Kc = exp(g_RT[4] - g_RT[7] + g_RT[36] - g_RT[38]);
+    Kc = Kc_s[168];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[36]) + (h_RT[7] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25491,12 +24592,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[36];
-    k_f = prefactor_units[169] * fwd_A[169]
-                * exp(fwd_beta[169] * tc[0] - activation_units[169] * fwd_Ea[169] * invT);
+    k_f = k_f_s[169];
     dlnkfdT = fwd_beta[169] * invT + activation_units[169] * fwd_Ea[169] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[37];
-    Kc = exp(g_RT[4] - g_RT[7] + g_RT[36] - g_RT[37]);
+    Kc = Kc_s[169];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[36]) + (h_RT[7] + h_RT[37]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25542,12 +24642,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[36];
-    k_f = prefactor_units[170] * fwd_A[170]
-                * exp(fwd_beta[170] * tc[0] - activation_units[170] * fwd_Ea[170] * invT);
+    k_f = k_f_s[170];
     dlnkfdT = fwd_beta[170] * invT + activation_units[170] * fwd_Ea[170] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[37];
-    Kc = exp(g_RT[8] - g_RT[9] + g_RT[36] - g_RT[37]);
+    Kc = Kc_s[170];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[36]) + (h_RT[9] + h_RT[37]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25593,12 +24692,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[36];
-    k_f = prefactor_units[171] * fwd_A[171]
-                * exp(fwd_beta[171] * tc[0] - activation_units[171] * fwd_Ea[171] * invT);
+    k_f = k_f_s[171];
     dlnkfdT = fwd_beta[171] * invT + activation_units[171] * fwd_Ea[171] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[38];
-    Kc = exp(g_RT[8] - g_RT[9] + g_RT[36] - g_RT[38]);
+    Kc = Kc_s[171];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[36]) + (h_RT[9] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25644,12 +24742,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[36]*sc[37];
-    k_f = prefactor_units[172] * fwd_A[172]
-                * exp(fwd_beta[172] * tc[0] - activation_units[172] * fwd_Ea[172] * invT);
+    k_f = k_f_s[172];
     dlnkfdT = fwd_beta[172] * invT + activation_units[172] * fwd_Ea[172] * invT2;
     /* reverse */
     phi_r = sc[36]*sc[38];
-    Kc = exp(g_RT[36] - g_RT[36] + g_RT[37] - g_RT[38]);
+    Kc = Kc_s[172];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[36] + h_RT[37]) + (h_RT[36] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25679,12 +24776,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[37];
-    k_f = prefactor_units[173] * fwd_A[173]
-                * exp(fwd_beta[173] * tc[0] - activation_units[173] * fwd_Ea[173] * invT);
+    k_f = k_f_s[173];
     dlnkfdT = fwd_beta[173] * invT + activation_units[173] * fwd_Ea[173] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[35];
-    Kc = exp(g_RT[3] - g_RT[8] - g_RT[35] + g_RT[37]);
+    Kc = Kc_s[173];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[37]) + (h_RT[8] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25730,12 +24826,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[38];
-    k_f = prefactor_units[174] * fwd_A[174]
-                * exp(fwd_beta[174] * tc[0] - activation_units[174] * fwd_Ea[174] * invT);
+    k_f = k_f_s[174];
     dlnkfdT = fwd_beta[174] * invT + activation_units[174] * fwd_Ea[174] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[35];
-    Kc = exp(g_RT[3] - g_RT[8] - g_RT[35] + g_RT[38]);
+    Kc = Kc_s[174];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[38]) + (h_RT[8] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25789,6 +24884,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         dcvpRdT(dcRdT, tc);
         speciesInternalEnergy(e_RT, tc);
         eh_RT = &e_RT[0];
+        for (int k=0; k<39; k++) {
+            for (int m=0; m<39; m++) {
+                J[k*40+m] += Jmix[m];
+            }
+        }
     }
 
     double cmix = 0.0, ehmix = 0.0, dcmixdT=0.0, dehmixdT=0.0;
@@ -31470,6 +30570,55 @@ void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double
     *ierr = 0;
     return;
 }
+/* get temperature given enthalpy in mass units and mass fracs */
+void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int * ierr)
+{
+#ifdef CONVERGENCE
+    const int maxiter = 5000;
+    const double tol  = 1.e-12;
+#else
+    const int maxiter = 200;
+    const double tol  = 1.e-6;
+#endif
+    double hin  = *h;
+    double tmin = 250;/*max lower bound for thermo def */
+    double tmax = 4000;/*min upper bound for thermo def */
+    double h1,hmin,hmax,cp,t1,dt;
+    int i;/* loop counter */
+    CKHBMS(&tmin, y, iwrk, rwrk, &hmin);
+    CKHBMS(&tmax, y, iwrk, rwrk, &hmax);
+    if (hin < hmin) {
+        /*Linear Extrapolation below tmin */
+        CKCPBS(&tmin, y, iwrk, rwrk, &cp);
+        *t = tmin - (hmin-hin)/cp;
+        *ierr = 1;
+        return;
+    }
+    if (hin > hmax) {
+        /*Linear Extrapolation above tmax */
+        CKCPBS(&tmax, y, iwrk, rwrk, &cp);
+        *t = tmax - (hmax-hin)/cp;
+        *ierr = 1;
+        return;
+    }
+    t1 = *t;
+    if (t1 < tmin || t1 > tmax) {
+        t1 = tmin + (tmax-tmin)/(hmax-hmin)*(hin-hmin);
+    }
+    for (i = 0; i < maxiter; ++i) {
+        CKHBMS(&t1,y,iwrk,rwrk,&h1);
+        CKCPBS(&t1,y,iwrk,rwrk,&cp);
+        dt = (hin - h1) / cp;
+        if (dt > 100.) { dt = 100.; }
+        else if (dt < -100.) { dt = -100.; }
+        else if (fabs(dt) < tol) break;
+        else if (t1+dt == t1) break;
+        t1 += dt;
+    }
+    *t = t1;
+    *ierr = 0;
+    return;
+}
 
 /* End of file  */
 
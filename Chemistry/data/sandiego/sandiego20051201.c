@@ -1,5 +1,6 @@
 
 #include <math.h>
+#include <float.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -86,7 +87,14 @@
 #define VCKPY VCKPY
 #define VCKWYR VCKWYR
 #define VCKYTX VCKYTX
+#define VCKCPBS VCKCPBS
+#define VCKCVBS VCKCVBS
+#define VCKHBMS VCKHBMS
+#define VCKUBMS VCKUBMS
+#define VCKRHOY VCKRHOY
+#define VCKMMWY VCKMMWY
 #define GET_T_GIVEN_EY GET_T_GIVEN_EY
+#define GET_T_GIVEN_HY GET_T_GIVEN_HY
 #define GET_REACTION_MAP GET_REACTION_MAP
 #elif defined(BL_FORT_USE_LOWERCASE)
 #define CKINDX ckindx
@@ -170,7 +178,14 @@
 #define VCKPY vckpy
 #define VCKWYR vckwyr
 #define VCKYTX vckytx
+#define VCKCPBS vckcpbs
+#define VCKCVBS vckcvbs
+#define VCKHBMS vckhbms
+#define VCKUBMS vckubms
+#define VCKRHOY vckrhoy
+#define VCKMMWY vckmmwy
 #define GET_T_GIVEN_EY get_t_given_ey
+#define GET_T_GIVEN_HY get_t_given_hy
 #define GET_REACTION_MAP get_reaction_map
 #elif defined(BL_FORT_USE_UNDERSCORE)
 #define CKINDX ckindx_
@@ -254,7 +269,14 @@
 #define VCKPY vckpy_
 #define VCKWYR vckwyr_
 #define VCKYTX vckytx_
+#define VCKCPBS vckcpbs_
+#define VCKCVBS vckcvbs_
+#define VCKHBMS vckhbms_
+#define VCKUBMS vckubms_
+#define VCKRHOY vckrhoy_
+#define VCKMMWY vckmmwy_
 #define GET_T_GIVEN_EY get_t_given_ey_
+#define GET_T_GIVEN_HY get_t_given_hy_
 #define GET_REACTION_MAP get_reaction_map_
 #endif
 
@@ -356,6 +378,7 @@ void DWDOT(double * restrict J, double * restrict sc, double * restrict T, int *
 void aJacobian(double * restrict J, double * restrict sc, double T, int consP);
 void dcvpRdT(double * restrict species, double * restrict tc);
 void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
+void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
 void GET_REACTION_MAP(int * restrict rmap);
 /*vector version */
 void vproductionRate(int npt, double * restrict wdot, double * restrict c, double * restrict T);
@@ -365,6 +388,12 @@ void VCKWYR(int * restrict np, double * restrict rho, double * restrict T,
             double * restrict y, int * restrict iwrk, double * restrict rwrk,
             double * restrict wdot);
 void VCKYTX(int * restrict np, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict x);
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs);
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs);
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms);
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms);
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho);
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm);
 void vcomp_k_f(int npt, double * restrict k_f_s, double * restrict tc, double * restrict invT);
 void vcomp_gibbs(int npt, double * restrict g_RT, double * restrict tc);
 void vcomp_Kc(int npt, double * restrict Kc_s, double * restrict g_RT, double * restrict invT);
@@ -3429,38 +3458,6 @@ void CKINDX(int * iwrk, double * restrict rwrk, int * mm, int * kk, int * ii, in
 }
 
 
-/* strtok_r: re-entrant (threadsafe) version of strtok, helper function for tokenizing strings  */
-char *strtok_r(char *s, const char *delim, char **save_ptr)
-{
-    char *token;
-
-    if (s == NULL)
-        s = *save_ptr;
-
-    /* Scan leading delimiters.  */
-    s += strspn (s, delim);
-    if (*s == '\0')
-    {
-        *save_ptr = s;
-        return NULL;
-    }
-
-    /* Find the end of the token.  */
-    token = s;
-    s = strpbrk (token, delim);
-    if (s == NULL)
-        /* This token finishes the string.  */
-        *save_ptr = __rawmemchr (token, '\0');
-    else
-    {
-        /* Terminate the token and make *SAVE_PTR point past it.  */
-        *s = '\0';
-        *save_ptr = s + 1;
-    }
-    return token;
-}
-
-
 
 /* ckxnum... for parsing strings  */
 void CKXNUM(char * line, int * nexp, int * lout, int * nval, double * restrict rval, int * kerr, int lenline )
@@ -4156,6 +4153,28 @@ void CKRHOY(double * restrict P, double * restrict T, double * restrict y, int *
 }
 
 
+/*Compute rho = P*W(y)/RT */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho)
+{
+    for (int i=0; i<(*np); i++) {
+        rho[i] = 0.0;
+    }
+
+    for (int n=0; n<46; n++) {
+        for (int i=0; i<(*np); i++) {
+            rho[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        rho[i] = P[i] / (8.31451e+07 * T[i] * rho[i]);/*rho = P*W/(R*T) */
+    }
+
+    return;
+}
+
+
 /*Compute rho = P*W(c)/(R*T) */
 void CKRHOC(double * restrict P, double * restrict T, double * restrict c, int * iwrk, double * restrict rwrk, double * restrict rho)
 {
@@ -4254,6 +4273,29 @@ void CKMMWY(double * restrict y, int * iwrk, double * restrict rwrk, double * re
 }
 
 
+/*given y[species]: mass fractions */
+/*returns mean molecular weight (gm/mole) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm)
+{
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 0.0;
+    }
+
+    for (int n=0; n<46; n++) {
+        for (int i=0; i<(*np); i++) {
+            wtm[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 1.0 / wtm[i];
+    }
+
+    return;
+}
+
+
 /*given x[species]: mole fractions */
 /*returns mean molecular weight (gm/mole) */
 void CKMMWX(double * restrict x, int * iwrk, double * restrict rwrk, double * restrict wtm)
@@ -5256,6 +5298,30 @@ void CKCPBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CP (Eq. 34) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs)
+{
+    double tc[5], tmp[46], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cp_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<46; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cpbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean specific heat at CV (Eq. 35) */
 void CKCVBL(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict cvbl)
 {
@@ -5335,6 +5401,30 @@ void CKCVBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CV (Eq. 36) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs)
+{
+    double tc[5], tmp[46], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cv_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<46; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cvbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean enthalpy of the mixture in molar units */
 void CKHBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict hbml)
 {
@@ -5376,6 +5466,30 @@ void CKHBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns mean enthalpy of mixture in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms)
+{
+    double tc[5], tmp[46], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesEnthalpy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<46; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        hbms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mean internal energy in molar units */
 void CKUBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict ubml)
 {
@@ -5457,6 +5571,30 @@ void CKUBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*get mean internal energy in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms)
+{
+    double tc[5], tmp[46], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesInternalEnergy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<46; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        ubms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mixture entropy in molar units */
 void CKSBML(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict sbml)
 {
@@ -13276,12 +13414,257 @@ void productionRate(double * restrict wdot, double * restrict sc, double T)
 
 void comp_k_f(double * restrict tc, double invT, double * restrict k_f)
 {
+    double x[235];
+#ifdef __INTEL_COMPILER
+    #pragma simd
+#endif
+    for (int i=0; i<235; ++i) {
+        x[i] = fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT;
+    };
+
+    /*the exp is skipped when the exponent is zero or that of */
+    /*an earlier reaction with the same default beta and Ea */
+    k_f[0] = exp(x[0]);
+    k_f[1] = exp(x[1]);
+    k_f[2] = exp(x[2]);
+    k_f[3] = exp(x[3]);
+    k_f[4] = (x[4] == 0.0 ? 1.0 : exp(x[4]));
+    k_f[5] = exp(x[5]);
+    k_f[6] = exp(x[6]);
+    k_f[7] = exp(x[7]);
+    k_f[8] = exp(x[8]);
+    k_f[9] = exp(x[9]);
+    k_f[10] = exp(x[10]);
+    k_f[11] = (x[11] == 0.0 ? 1.0 : exp(x[11]));
+    k_f[12] = (x[12] == 0.0 ? 1.0 : exp(x[12]));
+    k_f[13] = (x[13] == 0.0 ? 1.0 : exp(x[13]));
+    k_f[14] = (x[14] == 0.0 ? 1.0 : exp(x[14]));
+    k_f[15] = (x[15] == 0.0 ? 1.0 : exp(x[15]));
+    k_f[16] = exp(x[16]);
+    k_f[17] = exp(x[17]);
+    k_f[18] = exp(x[18]);
+    k_f[19] = exp(x[19]);
+    k_f[20] = exp(x[20]);
+    k_f[21] = exp(x[21]);
+    k_f[22] = exp(x[22]);
+    k_f[23] = exp(x[23]);
+    k_f[24] = (x[24] == x[21] ? k_f[21] : exp(x[24]));
+    k_f[25] = (x[25] == 0.0 ? 1.0 : exp(x[25]));
+    k_f[26] = exp(x[26]);
+    k_f[27] = (x[27] == 0.0 ? 1.0 : exp(x[27]));
+    k_f[28] = exp(x[28]);
+    k_f[29] = exp(x[29]);
+    k_f[30] = exp(x[30]);
+    k_f[31] = exp(x[31]);
+    k_f[32] = exp(x[32]);
+    k_f[33] = exp(x[33]);
+    k_f[34] = exp(x[34]);
+    k_f[35] = exp(x[35]);
+    k_f[36] = exp(x[36]);
+    k_f[37] = exp(x[37]);
+    k_f[38] = exp(x[38]);
+    k_f[39] = exp(x[39]);
+    k_f[40] = exp(x[40]);
+    k_f[41] = exp(x[41]);
+    k_f[42] = exp(x[42]);
+    k_f[43] = (x[43] == 0.0 ? 1.0 : exp(x[43]));
+    k_f[44] = exp(x[44]);
+    k_f[45] = exp(x[45]);
+    k_f[46] = exp(x[46]);
+    k_f[47] = exp(x[47]);
+    k_f[48] = exp(x[48]);
+    k_f[49] = exp(x[49]);
+    k_f[50] = exp(x[50]);
+    k_f[51] = exp(x[51]);
+    k_f[52] = exp(x[52]);
+    k_f[53] = (x[53] == 0.0 ? 1.0 : exp(x[53]));
+    k_f[54] = (x[54] == 0.0 ? 1.0 : exp(x[54]));
+    k_f[55] = (x[55] == 0.0 ? 1.0 : exp(x[55]));
+    k_f[56] = (x[56] == 0.0 ? 1.0 : exp(x[56]));
+    k_f[57] = exp(x[57]);
+    k_f[58] = (x[58] == 0.0 ? 1.0 : exp(x[58]));
+    k_f[59] = exp(x[59]);
+    k_f[60] = exp(x[60]);
+    k_f[61] = exp(x[61]);
+    k_f[62] = exp(x[62]);
+    k_f[63] = exp(x[63]);
+    k_f[64] = exp(x[64]);
+    k_f[65] = exp(x[65]);
+    k_f[66] = exp(x[66]);
+    k_f[67] = exp(x[67]);
+    k_f[68] = exp(x[68]);
+    k_f[69] = exp(x[69]);
+    k_f[70] = exp(x[70]);
+    k_f[71] = exp(x[71]);
+    k_f[72] = (x[72] == 0.0 ? 1.0 : exp(x[72]));
+    k_f[73] = (x[73] == 0.0 ? 1.0 : exp(x[73]));
+    k_f[74] = (x[74] == 0.0 ? 1.0 : exp(x[74]));
+    k_f[75] = exp(x[75]);
+    k_f[76] = exp(x[76]);
+    k_f[77] = exp(x[77]);
+    k_f[78] = exp(x[78]);
+    k_f[79] = (x[79] == 0.0 ? 1.0 : exp(x[79]));
+    k_f[80] = (x[80] == 0.0 ? 1.0 : exp(x[80]));
+    k_f[81] = (x[81] == 0.0 ? 1.0 : exp(x[81]));
+    k_f[82] = exp(x[82]);
+    k_f[83] = (x[83] == 0.0 ? 1.0 : exp(x[83]));
+    k_f[84] = exp(x[84]);
+    k_f[85] = (x[85] == 0.0 ? 1.0 : exp(x[85]));
+    k_f[86] = (x[86] == 0.0 ? 1.0 : exp(x[86]));
+    k_f[87] = exp(x[87]);
+    k_f[88] = (x[88] == x[87] ? k_f[87] : exp(x[88]));
+    k_f[89] = (x[89] == 0.0 ? 1.0 : exp(x[89]));
+    k_f[90] = (x[90] == 0.0 ? 1.0 : exp(x[90]));
+    k_f[91] = exp(x[91]);
+    k_f[92] = exp(x[92]);
+    k_f[93] = exp(x[93]);
+    k_f[94] = (x[94] == 0.0 ? 1.0 : exp(x[94]));
+    k_f[95] = (x[95] == 0.0 ? 1.0 : exp(x[95]));
+    k_f[96] = (x[96] == 0.0 ? 1.0 : exp(x[96]));
+    k_f[97] = (x[97] == 0.0 ? 1.0 : exp(x[97]));
+    k_f[98] = exp(x[98]);
+    k_f[99] = exp(x[99]);
+    k_f[100] = exp(x[100]);
+    k_f[101] = exp(x[101]);
+    k_f[102] = exp(x[102]);
+    k_f[103] = exp(x[103]);
+    k_f[104] = (x[104] == 0.0 ? 1.0 : exp(x[104]));
+    k_f[105] = (x[105] == 0.0 ? 1.0 : exp(x[105]));
+    k_f[106] = (x[106] == 0.0 ? 1.0 : exp(x[106]));
+    k_f[107] = exp(x[107]);
+    k_f[108] = exp(x[108]);
+    k_f[109] = exp(x[109]);
+    k_f[110] = exp(x[110]);
+    k_f[111] = (x[111] == x[110] ? k_f[110] : exp(x[111]));
+    k_f[112] = exp(x[112]);
+    k_f[113] = exp(x[113]);
+    k_f[114] = exp(x[114]);
+    k_f[115] = exp(x[115]);
+    k_f[116] = (x[116] == 0.0 ? 1.0 : exp(x[116]));
+    k_f[117] = exp(x[117]);
+    k_f[118] = exp(x[118]);
+    k_f[119] = exp(x[119]);
+    k_f[120] = exp(x[120]);
+    k_f[121] = exp(x[121]);
+    k_f[122] = exp(x[122]);
+    k_f[123] = exp(x[123]);
+    k_f[124] = exp(x[124]);
+    k_f[125] = exp(x[125]);
+    k_f[126] = exp(x[126]);
+    k_f[127] = exp(x[127]);
+    k_f[128] = (x[128] == 0.0 ? 1.0 : exp(x[128]));
+    k_f[129] = (x[129] == 0.0 ? 1.0 : exp(x[129]));
+    k_f[130] = (x[130] == 0.0 ? 1.0 : exp(x[130]));
+    k_f[131] = (x[131] == 0.0 ? 1.0 : exp(x[131]));
+    k_f[132] = exp(x[132]);
+    k_f[133] = (x[133] == x[132] ? k_f[132] : exp(x[133]));
+    k_f[134] = (x[134] == 0.0 ? 1.0 : exp(x[134]));
+    k_f[135] = (x[135] == 0.0 ? 1.0 : exp(x[135]));
+    k_f[136] = (x[136] == 0.0 ? 1.0 : exp(x[136]));
+    k_f[137] = exp(x[137]);
+    k_f[138] = (x[138] == 0.0 ? 1.0 : exp(x[138]));
+    k_f[139] = (x[139] == 0.0 ? 1.0 : exp(x[139]));
+    k_f[140] = exp(x[140]);
+    k_f[141] = (x[141] == 0.0 ? 1.0 : exp(x[141]));
+    k_f[142] = (x[142] == 0.0 ? 1.0 : exp(x[142]));
+    k_f[143] = (x[143] == 0.0 ? 1.0 : exp(x[143]));
+    k_f[144] = exp(x[144]);
+    k_f[145] = exp(x[145]);
+    k_f[146] = exp(x[146]);
+    k_f[147] = exp(x[147]);
+    k_f[148] = exp(x[148]);
+    k_f[149] = exp(x[149]);
+    k_f[150] = exp(x[150]);
+    k_f[151] = exp(x[151]);
+    k_f[152] = (x[152] == 0.0 ? 1.0 : exp(x[152]));
+    k_f[153] = (x[153] == 0.0 ? 1.0 : exp(x[153]));
+    k_f[154] = (x[154] == 0.0 ? 1.0 : exp(x[154]));
+    k_f[155] = (x[155] == 0.0 ? 1.0 : exp(x[155]));
+    k_f[156] = (x[156] == 0.0 ? 1.0 : exp(x[156]));
+    k_f[157] = (x[157] == x[23] ? k_f[23] : exp(x[157]));
+    k_f[158] = (x[158] == 0.0 ? 1.0 : exp(x[158]));
+    k_f[159] = (x[159] == 0.0 ? 1.0 : exp(x[159]));
+    k_f[160] = exp(x[160]);
+    k_f[161] = exp(x[161]);
+    k_f[162] = exp(x[162]);
+    k_f[163] = (x[163] == x[162] ? k_f[162] : exp(x[163]));
+    k_f[164] = exp(x[164]);
+    k_f[165] = exp(x[165]);
+    k_f[166] = exp(x[166]);
+    k_f[167] = exp(x[167]);
+    k_f[168] = exp(x[168]);
+    k_f[169] = exp(x[169]);
+    k_f[170] = exp(x[170]);
+    k_f[171] = exp(x[171]);
+    k_f[172] = exp(x[172]);
+    k_f[173] = exp(x[173]);
+    k_f[174] = exp(x[174]);
+    k_f[175] = exp(x[175]);
+    k_f[176] = exp(x[176]);
+    k_f[177] = exp(x[177]);
+    k_f[178] = exp(x[178]);
+    k_f[179] = exp(x[179]);
+    k_f[180] = exp(x[180]);
+    k_f[181] = exp(x[181]);
+    k_f[182] = exp(x[182]);
+    k_f[183] = exp(x[183]);
+    k_f[184] = exp(x[184]);
+    k_f[185] = exp(x[185]);
+    k_f[186] = exp(x[186]);
+    k_f[187] = exp(x[187]);
+    k_f[188] = exp(x[188]);
+    k_f[189] = (x[189] == 0.0 ? 1.0 : exp(x[189]));
+    k_f[190] = exp(x[190]);
+    k_f[191] = exp(x[191]);
+    k_f[192] = (x[192] == 0.0 ? 1.0 : exp(x[192]));
+    k_f[193] = (x[193] == 0.0 ? 1.0 : exp(x[193]));
+    k_f[194] = (x[194] == 0.0 ? 1.0 : exp(x[194]));
+    k_f[195] = exp(x[195]);
+    k_f[196] = (x[196] == 0.0 ? 1.0 : exp(x[196]));
+    k_f[197] = (x[197] == 0.0 ? 1.0 : exp(x[197]));
+    k_f[198] = (x[198] == 0.0 ? 1.0 : exp(x[198]));
+    k_f[199] = (x[199] == 0.0 ? 1.0 : exp(x[199]));
+    k_f[200] = (x[200] == 0.0 ? 1.0 : exp(x[200]));
+    k_f[201] = exp(x[201]);
+    k_f[202] = exp(x[202]);
+    k_f[203] = exp(x[203]);
+    k_f[204] = (x[204] == 0.0 ? 1.0 : exp(x[204]));
+    k_f[205] = exp(x[205]);
+    k_f[206] = exp(x[206]);
+    k_f[207] = (x[207] == 0.0 ? 1.0 : exp(x[207]));
+    k_f[208] = exp(x[208]);
+    k_f[209] = exp(x[209]);
+    k_f[210] = (x[210] == 0.0 ? 1.0 : exp(x[210]));
+    k_f[211] = (x[211] == 0.0 ? 1.0 : exp(x[211]));
+    k_f[212] = (x[212] == 0.0 ? 1.0 : exp(x[212]));
+    k_f[213] = exp(x[213]);
+    k_f[214] = exp(x[214]);
+    k_f[215] = exp(x[215]);
+    k_f[216] = exp(x[216]);
+    k_f[217] = exp(x[217]);
+    k_f[218] = (x[218] == 0.0 ? 1.0 : exp(x[218]));
+    k_f[219] = (x[219] == 0.0 ? 1.0 : exp(x[219]));
+    k_f[220] = exp(x[220]);
+    k_f[221] = exp(x[221]);
+    k_f[222] = exp(x[222]);
+    k_f[223] = exp(x[223]);
+    k_f[224] = exp(x[224]);
+    k_f[225] = exp(x[225]);
+    k_f[226] = exp(x[226]);
+    k_f[227] = exp(x[227]);
+    k_f[228] = exp(x[228]);
+    k_f[229] = exp(x[229]);
+    k_f[230] = exp(x[230]);
+    k_f[231] = exp(x[231]);
+    k_f[232] = exp(x[232]);
+    k_f[233] = (x[233] == 0.0 ? 1.0 : exp(x[233]));
+    k_f[234] = (x[234] == 0.0 ? 1.0 : exp(x[234]));
+
 #ifdef __INTEL_COMPILER
     #pragma simd
 #endif
     for (int i=0; i<235; ++i) {
-        k_f[i] = prefactor_units[i] * fwd_A[i]
-                    * exp(fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT);
+        k_f[i] *= prefactor_units[i] * fwd_A[i];
     };
     return;
 }
@@ -13292,308 +13675,556 @@ void comp_Kc(double * restrict tc, double invT, double * restrict Kc)
     double g_RT[46];
     gibbs(g_RT, tc);
 
-    Kc[0] = g_RT[3] + g_RT[4] - g_RT[9];
-    Kc[1] = 2*g_RT[5] - g_RT[10];
-    Kc[2] = g_RT[3] + g_RT[13] - g_RT[14];
-    Kc[3] = g_RT[3] - g_RT[15] + g_RT[16];
-    Kc[4] = 2*g_RT[16] - g_RT[22];
-    Kc[5] = -g_RT[3] - g_RT[21] + g_RT[22];
-    Kc[6] = -g_RT[3] - g_RT[19] + g_RT[21];
-    Kc[7] = -g_RT[3] - g_RT[24] + g_RT[25];
-    Kc[8] = -g_RT[5] - g_RT[16] + g_RT[32];
-    Kc[9] = -g_RT[16] - g_RT[31] + g_RT[33];
-    Kc[10] = -g_RT[8] - g_RT[19] + g_RT[33];
-    Kc[11] = g_RT[3] - g_RT[39] + g_RT[40];
-    Kc[12] = g_RT[3] + g_RT[39] - g_RT[41];
-    Kc[13] = g_RT[16] + g_RT[24] - g_RT[41];
-    Kc[14] = g_RT[3] + g_RT[41] - g_RT[42];
-    Kc[15] = g_RT[16] + g_RT[25] - g_RT[42];
-    Kc[16] = -g_RT[16] - g_RT[21] + g_RT[43];
-    Kc[17] = g_RT[3] + g_RT[42] - g_RT[44];
-    Kc[18] = -g_RT[16] - g_RT[19] + g_RT[45];
-    Kc[19] = g_RT[3] + g_RT[42] - g_RT[45];
-    Kc[20] = -g_RT[11] - g_RT[16] + g_RT[37];
-    Kc[21] = g_RT[3] + g_RT[3] - g_RT[7];
-    Kc[22] = g_RT[3] + g_RT[5] - g_RT[8];
-    Kc[23] = -g_RT[4] + g_RT[6] + g_RT[6];
-    Kc[24] = g_RT[3] - g_RT[5] + g_RT[6];
-    Kc[25] = g_RT[5] + g_RT[6] - g_RT[9];
-    Kc[26] = -g_RT[3] - g_RT[11] + g_RT[13];
-    Kc[27] = -g_RT[17] + g_RT[18];
-    Kc[28] = -g_RT[3] - g_RT[14] + g_RT[20];
-    Kc[29] = -g_RT[3] + g_RT[19] - g_RT[25];
-    Kc[30] = -g_RT[7] + g_RT[19] - g_RT[24];
-    Kc[31] = -g_RT[3] - g_RT[14] + g_RT[31];
-    Kc[32] = g_RT[20] - g_RT[31];
-    Kc[33] = -g_RT[3] - g_RT[34] + g_RT[38];
-    Kc[34] = -g_RT[14] - g_RT[16] + g_RT[38];
-    Kc[35] = -g_RT[3] - g_RT[34] + g_RT[35];
-    Kc[36] = g_RT[3] + g_RT[4] - g_RT[5] - g_RT[6];
-    Kc[37] = -g_RT[3] - g_RT[5] + g_RT[6] + g_RT[7];
-    Kc[38] = -g_RT[3] + g_RT[5] + g_RT[7] - g_RT[8];
-    Kc[39] = -2*g_RT[5] + g_RT[6] + g_RT[8];
-    Kc[40] = g_RT[3] - 2*g_RT[5] + g_RT[9];
-    Kc[41] = g_RT[3] - g_RT[4] - g_RT[7] + g_RT[9];
-    Kc[42] = g_RT[3] - g_RT[6] - g_RT[8] + g_RT[9];
-    Kc[43] = -g_RT[4] - g_RT[5] + g_RT[6] + g_RT[9];
-    Kc[44] = -g_RT[4] + g_RT[5] - g_RT[8] + g_RT[9];
-    Kc[45] = -g_RT[4] + 2*g_RT[9] - g_RT[10];
-    Kc[46] = g_RT[3] - g_RT[7] - g_RT[9] + g_RT[10];
-    Kc[47] = g_RT[3] - g_RT[5] - g_RT[8] + g_RT[10];
-    Kc[48] = g_RT[5] - g_RT[8] - g_RT[9] + g_RT[10];
-    Kc[49] = -g_RT[5] + g_RT[6] - g_RT[9] + g_RT[10];
-    Kc[50] = -g_RT[3] + g_RT[5] + g_RT[11] - g_RT[12];
-    Kc[51] = -g_RT[5] + g_RT[9] + g_RT[11] - g_RT[12];
-    Kc[52] = g_RT[4] - g_RT[6] + g_RT[11] - g_RT[12];
-    Kc[53] = g_RT[3] - g_RT[7] - g_RT[11] + g_RT[13];
-    Kc[54] = -g_RT[5] + g_RT[6] - g_RT[11] + g_RT[13];
-    Kc[55] = -g_RT[3] + g_RT[6] - g_RT[12] + g_RT[13];
-    Kc[56] = g_RT[5] - g_RT[8] - g_RT[11] + g_RT[13];
-    Kc[57] = g_RT[4] - g_RT[9] - g_RT[11] + g_RT[13];
-    Kc[58] = -g_RT[11] + g_RT[13] - g_RT[15] + g_RT[16];
-    Kc[59] = g_RT[3] - g_RT[7] - g_RT[13] + g_RT[14];
-    Kc[60] = -g_RT[5] + g_RT[6] - g_RT[13] + g_RT[14];
-    Kc[61] = g_RT[5] - g_RT[8] - g_RT[13] + g_RT[14];
-    Kc[62] = g_RT[4] - g_RT[9] - g_RT[13] + g_RT[14];
-    Kc[63] = g_RT[9] - g_RT[10] - g_RT[13] + g_RT[14];
-    Kc[64] = g_RT[3] - g_RT[7] + g_RT[15] - g_RT[16];
-    Kc[65] = g_RT[5] - g_RT[8] + g_RT[15] - g_RT[16];
-    Kc[66] = -g_RT[5] + g_RT[6] + g_RT[15] - g_RT[16];
-    Kc[67] = g_RT[4] - g_RT[9] + g_RT[15] - g_RT[16];
-    Kc[68] = g_RT[9] - g_RT[10] + g_RT[15] - g_RT[16];
-    Kc[69] = g_RT[3] - g_RT[7] + g_RT[16] - g_RT[17];
-    Kc[70] = g_RT[3] - g_RT[7] + g_RT[16] - g_RT[18];
-    Kc[71] = g_RT[5] - g_RT[8] + g_RT[16] - g_RT[18];
-    Kc[72] = -g_RT[3] + g_RT[6] - g_RT[14] + g_RT[16];
-    Kc[73] = -g_RT[3] + g_RT[16] + g_RT[17] - g_RT[19];
-    Kc[74] = -g_RT[5] + g_RT[9] + g_RT[16] - g_RT[20];
-    Kc[75] = g_RT[4] - g_RT[5] - g_RT[14] + g_RT[16];
-    Kc[76] = g_RT[4] - g_RT[6] + g_RT[16] - g_RT[20];
-    Kc[77] = -g_RT[7] + g_RT[16] + g_RT[16] - g_RT[19];
-    Kc[78] = -g_RT[3] + g_RT[16] + g_RT[16] - g_RT[21];
-    Kc[79] = -g_RT[3] + g_RT[5] - g_RT[14] + g_RT[18];
-    Kc[80] = -g_RT[3] + g_RT[4] - g_RT[5] - g_RT[11] + g_RT[18];
-    Kc[81] = -g_RT[11] + g_RT[12] - g_RT[14] + g_RT[18];
-    Kc[82] = g_RT[3] - g_RT[7] + g_RT[17] - g_RT[23];
-    Kc[83] = -g_RT[3] + g_RT[5] - g_RT[14] + g_RT[17];
-    Kc[84] = g_RT[5] - g_RT[8] + g_RT[17] - g_RT[23];
-    Kc[85] = -2*g_RT[3] + g_RT[6] - g_RT[11] + g_RT[17];
-    Kc[86] = g_RT[6] - g_RT[7] - g_RT[11] + g_RT[17];
-    Kc[87] = g_RT[4] - g_RT[7] - g_RT[12] + g_RT[17];
-    Kc[88] = -g_RT[3] + g_RT[4] - g_RT[5] - g_RT[11] + g_RT[17];
-    Kc[89] = -2*g_RT[3] + g_RT[17] + g_RT[17] - g_RT[24];
-    Kc[90] = -g_RT[3] + g_RT[6] - g_RT[11] + g_RT[23];
-    Kc[91] = g_RT[4] - g_RT[6] - g_RT[13] + g_RT[23];
-    Kc[92] = -g_RT[3] + g_RT[8] - g_RT[14] + g_RT[23];
-    Kc[93] = -g_RT[11] + g_RT[12] - g_RT[13] + g_RT[23];
-    Kc[94] = g_RT[3] - g_RT[7] - g_RT[14] + g_RT[20];
-    Kc[95] = g_RT[3] - g_RT[8] - g_RT[18] + g_RT[20];
-    Kc[96] = g_RT[5] - g_RT[8] - g_RT[14] + g_RT[20];
-    Kc[97] = -g_RT[5] + g_RT[6] - g_RT[14] + g_RT[20];
-    Kc[98] = g_RT[4] - g_RT[9] - g_RT[14] + g_RT[20];
-    Kc[99] = g_RT[3] - g_RT[7] - g_RT[21] + g_RT[22];
-    Kc[100] = -g_RT[5] + g_RT[6] - g_RT[21] + g_RT[22];
-    Kc[101] = g_RT[5] - g_RT[8] - g_RT[21] + g_RT[22];
-    Kc[102] = -g_RT[15] + g_RT[16] - g_RT[21] + g_RT[22];
-    Kc[103] = g_RT[9] - g_RT[10] - g_RT[21] + g_RT[22];
-    Kc[104] = g_RT[3] - g_RT[7] - g_RT[19] + g_RT[21];
-    Kc[105] = -g_RT[5] + g_RT[6] - g_RT[19] + g_RT[21];
-    Kc[106] = g_RT[6] - g_RT[14] - g_RT[16] + g_RT[21];
-    Kc[107] = g_RT[4] - g_RT[9] - g_RT[19] + g_RT[21];
-    Kc[108] = g_RT[3] - g_RT[7] + g_RT[19] - g_RT[25];
-    Kc[109] = g_RT[5] - g_RT[8] + g_RT[19] - g_RT[25];
-    Kc[110] = g_RT[6] - g_RT[13] - g_RT[16] + g_RT[19];
-    Kc[111] = -g_RT[3] + g_RT[6] + g_RT[19] - g_RT[26];
-    Kc[112] = g_RT[19] + g_RT[19] - g_RT[21] - g_RT[25];
-    Kc[113] = g_RT[4] - g_RT[9] + g_RT[19] - g_RT[25];
-    Kc[114] = -g_RT[5] + g_RT[9] + g_RT[19] - g_RT[27];
-    Kc[115] = g_RT[9] - g_RT[10] - g_RT[11] - g_RT[16] + g_RT[27];
-    Kc[116] = g_RT[3] - g_RT[7] - g_RT[24] + g_RT[25];
-    Kc[117] = g_RT[4] - g_RT[13] - g_RT[14] + g_RT[25];
-    Kc[118] = g_RT[4] - g_RT[6] + g_RT[25] - g_RT[26];
-    Kc[119] = g_RT[4] - g_RT[9] - g_RT[24] + g_RT[25];
-    Kc[120] = -g_RT[3] + g_RT[6] + g_RT[24] - g_RT[29];
-    Kc[121] = g_RT[6] - g_RT[11] - g_RT[17] + g_RT[24];
-    Kc[122] = g_RT[4] - g_RT[11] - g_RT[14] + g_RT[24];
-    Kc[123] = -g_RT[3] + g_RT[5] + g_RT[24] - g_RT[28];
-    Kc[124] = g_RT[5] - g_RT[8] + g_RT[24] - g_RT[30];
-    Kc[125] = g_RT[3] - g_RT[11] - g_RT[16] + g_RT[28];
-    Kc[126] = g_RT[6] - g_RT[12] - g_RT[17] + g_RT[28];
-    Kc[127] = -g_RT[5] + g_RT[6] + g_RT[28] - g_RT[29];
-    Kc[128] = -g_RT[11] + g_RT[16] - g_RT[21] + g_RT[28];
-    Kc[129] = g_RT[3] - g_RT[11] - g_RT[18] + g_RT[29];
-    Kc[130] = -g_RT[3] + g_RT[5] - g_RT[11] - g_RT[13] + g_RT[29];
-    Kc[131] = -g_RT[3] + g_RT[6] - 2*g_RT[11] + g_RT[29];
-    Kc[132] = g_RT[4] - g_RT[5] - 2*g_RT[11] + g_RT[29];
-    Kc[133] = -g_RT[3] + g_RT[4] - g_RT[11] - g_RT[12] + g_RT[29];
-    Kc[134] = -g_RT[3] + g_RT[5] - g_RT[29] + g_RT[30];
-    Kc[135] = g_RT[6] - g_RT[11] - g_RT[23] + g_RT[30];
-    Kc[136] = g_RT[4] - g_RT[6] - g_RT[29] + g_RT[30];
-    Kc[137] = g_RT[4] - g_RT[12] - g_RT[23] + g_RT[30];
-    Kc[138] = g_RT[4] - g_RT[11] - g_RT[13] + g_RT[30];
-    Kc[139] = g_RT[3] - g_RT[7] - g_RT[14] + g_RT[31];
-    Kc[140] = g_RT[3] - g_RT[5] - g_RT[16] + g_RT[31];
-    Kc[141] = g_RT[5] - g_RT[8] - g_RT[14] + g_RT[31];
-    Kc[142] = g_RT[4] - g_RT[9] - g_RT[14] + g_RT[31];
-    Kc[143] = g_RT[5] - g_RT[11] + g_RT[28] - g_RT[31];
-    Kc[144] = g_RT[5] - g_RT[8] - g_RT[31] + g_RT[32];
-    Kc[145] = g_RT[5] - g_RT[8] - g_RT[20] + g_RT[32];
-    Kc[146] = g_RT[3] - g_RT[7] - g_RT[31] + g_RT[32];
-    Kc[147] = g_RT[3] - g_RT[7] - g_RT[20] + g_RT[32];
-    Kc[148] = -g_RT[5] + g_RT[6] - g_RT[31] + g_RT[32];
-    Kc[149] = g_RT[9] - g_RT[10] - g_RT[31] + g_RT[32];
-    Kc[150] = g_RT[4] - g_RT[9] - g_RT[31] + g_RT[32];
-    Kc[151] = -g_RT[3] + g_RT[26] - g_RT[28];
-    Kc[152] = g_RT[3] - g_RT[13] - g_RT[16] + g_RT[26];
-    Kc[153] = g_RT[3] - g_RT[7] + g_RT[26] - g_RT[28];
-    Kc[154] = g_RT[6] - g_RT[13] - g_RT[14] + g_RT[26];
-    Kc[155] = g_RT[5] - g_RT[8] + g_RT[26] - g_RT[28];
-    Kc[156] = g_RT[4] - g_RT[5] - g_RT[11] - g_RT[14] + g_RT[26];
-    Kc[157] = -g_RT[3] - g_RT[11] + g_RT[16] - g_RT[21] + g_RT[26];
-    Kc[158] = -g_RT[5] + g_RT[9] - g_RT[13] - g_RT[14] + g_RT[26];
-    Kc[159] = -g_RT[4] + g_RT[9] + g_RT[26] - g_RT[34];
-    Kc[160] = -g_RT[11] - g_RT[16] + g_RT[26];
-    Kc[161] = -g_RT[13] - g_RT[16] + g_RT[34];
-    Kc[162] = g_RT[5] - g_RT[8] + g_RT[34] - g_RT[37];
-    Kc[163] = g_RT[5] - g_RT[8] - g_RT[26] + g_RT[34];
-    Kc[164] = -g_RT[5] + g_RT[6] + g_RT[34] - g_RT[37];
-    Kc[165] = -g_RT[5] + g_RT[6] - g_RT[26] + g_RT[34];
-    Kc[166] = g_RT[3] - g_RT[7] + g_RT[34] - g_RT[37];
-    Kc[167] = g_RT[3] - g_RT[7] - g_RT[26] + g_RT[34];
-    Kc[168] = -g_RT[15] + g_RT[16] + g_RT[34] - g_RT[37];
-    Kc[169] = -g_RT[15] + g_RT[16] - g_RT[26] + g_RT[34];
-    Kc[170] = g_RT[9] - g_RT[10] + g_RT[34] - g_RT[37];
-    Kc[171] = g_RT[9] - g_RT[10] - g_RT[26] + g_RT[34];
-    Kc[172] = g_RT[4] - g_RT[9] + g_RT[34] - g_RT[37];
-    Kc[173] = g_RT[5] - g_RT[8] + g_RT[33] - g_RT[36];
-    Kc[174] = g_RT[5] - g_RT[8] + g_RT[33] - g_RT[35];
-    Kc[175] = g_RT[5] - g_RT[8] + g_RT[33] - g_RT[38];
-    Kc[176] = g_RT[3] - g_RT[7] + g_RT[33] - g_RT[36];
-    Kc[177] = g_RT[3] - g_RT[7] + g_RT[33] - g_RT[35];
-    Kc[178] = g_RT[3] - g_RT[7] + g_RT[33] - g_RT[38];
-    Kc[179] = -g_RT[5] + g_RT[6] + g_RT[33] - g_RT[36];
-    Kc[180] = -g_RT[5] + g_RT[6] + g_RT[33] - g_RT[35];
-    Kc[181] = -g_RT[5] + g_RT[6] + g_RT[33] - g_RT[38];
-    Kc[182] = -g_RT[15] + g_RT[16] + g_RT[33] - g_RT[36];
-    Kc[183] = -g_RT[15] + g_RT[16] + g_RT[33] - g_RT[35];
-    Kc[184] = -g_RT[15] + g_RT[16] + g_RT[33] - g_RT[38];
-    Kc[185] = g_RT[9] - g_RT[10] + g_RT[33] - g_RT[35];
-    Kc[186] = g_RT[9] - g_RT[10] + g_RT[33] - g_RT[36];
-    Kc[187] = g_RT[9] - g_RT[10] + g_RT[33] - g_RT[38];
-    Kc[188] = g_RT[5] + g_RT[19] - g_RT[36];
-    Kc[189] = -g_RT[5] + g_RT[9] + g_RT[21] - g_RT[38];
-    Kc[190] = g_RT[4] - g_RT[9] - g_RT[34] + g_RT[38];
-    Kc[191] = g_RT[11] - g_RT[12] - g_RT[21] + g_RT[38];
-    Kc[192] = g_RT[3] - g_RT[16] - g_RT[31] + g_RT[38];
-    Kc[193] = g_RT[3] - g_RT[8] - g_RT[19] + g_RT[38];
-    Kc[194] = g_RT[5] - g_RT[8] - g_RT[34] + g_RT[38];
-    Kc[195] = g_RT[4] - g_RT[9] - g_RT[34] + g_RT[35];
-    Kc[196] = -g_RT[5] + g_RT[6] - g_RT[34] + g_RT[35];
-    Kc[197] = g_RT[3] - g_RT[8] - g_RT[19] + g_RT[35];
-    Kc[198] = g_RT[3] - g_RT[16] - g_RT[31] + g_RT[35];
-    Kc[199] = -g_RT[5] - g_RT[5] + g_RT[9] - g_RT[34] + g_RT[35];
-    Kc[200] = g_RT[5] - g_RT[8] - g_RT[34] + g_RT[35];
-    Kc[201] = g_RT[6] - g_RT[11] - g_RT[19] + g_RT[39];
-    Kc[202] = -g_RT[3] + g_RT[16] + g_RT[24] - g_RT[39];
-    Kc[203] = g_RT[6] - g_RT[16] - g_RT[29] + g_RT[39];
-    Kc[204] = -g_RT[4] + g_RT[9] - g_RT[39] + g_RT[40];
-    Kc[205] = g_RT[5] - g_RT[8] + g_RT[39] - g_RT[40];
-    Kc[206] = g_RT[4] - g_RT[13] - g_RT[28] + g_RT[40];
-    Kc[207] = g_RT[3] - g_RT[7] - g_RT[39] + g_RT[41];
-    Kc[208] = g_RT[4] - g_RT[9] - g_RT[39] + g_RT[41];
-    Kc[209] = -g_RT[15] + g_RT[16] - g_RT[39] + g_RT[41];
-    Kc[210] = g_RT[5] - g_RT[8] - g_RT[39] + g_RT[41];
-    Kc[211] = -g_RT[11] + g_RT[13] - g_RT[39] + g_RT[40];
-    Kc[212] = -g_RT[5] + g_RT[9] - g_RT[11] - g_RT[25] + g_RT[40];
-    Kc[213] = g_RT[4] - g_RT[11] - g_RT[13] - g_RT[16] + g_RT[39];
-    Kc[214] = g_RT[6] - g_RT[13] - g_RT[21] + g_RT[42];
-    Kc[215] = g_RT[5] - g_RT[8] - g_RT[41] + g_RT[42];
-    Kc[216] = -g_RT[3] + g_RT[6] - g_RT[16] - g_RT[28] + g_RT[42];
-    Kc[217] = g_RT[3] - g_RT[7] - g_RT[41] + g_RT[42];
-    Kc[218] = -g_RT[4] + g_RT[9] + g_RT[41] - g_RT[42];
-    Kc[219] = -g_RT[5] + g_RT[9] - g_RT[14] - g_RT[25] + g_RT[41];
-    Kc[220] = g_RT[3] - g_RT[16] - g_RT[19] + g_RT[42];
-    Kc[221] = -g_RT[3] + g_RT[16] + g_RT[25] - g_RT[41];
-    Kc[222] = g_RT[4] - g_RT[9] + g_RT[43] - g_RT[44];
-    Kc[223] = g_RT[4] - g_RT[9] + g_RT[43] - g_RT[45];
-    Kc[224] = g_RT[3] - g_RT[7] + g_RT[43] - g_RT[44];
-    Kc[225] = g_RT[3] - g_RT[7] + g_RT[43] - g_RT[45];
-    Kc[226] = -g_RT[5] + g_RT[6] + g_RT[43] - g_RT[44];
-    Kc[227] = -g_RT[5] + g_RT[6] + g_RT[43] - g_RT[45];
-    Kc[228] = g_RT[5] - g_RT[8] + g_RT[43] - g_RT[45];
-    Kc[229] = g_RT[5] - g_RT[8] + g_RT[43] - g_RT[44];
-    Kc[230] = g_RT[9] - g_RT[10] + g_RT[43] - g_RT[44];
-    Kc[231] = g_RT[9] - g_RT[10] + g_RT[43] - g_RT[45];
-    Kc[232] = g_RT[43] - g_RT[43] + g_RT[44] - g_RT[45];
-    Kc[233] = g_RT[4] - g_RT[9] - g_RT[42] + g_RT[44];
-    Kc[234] = g_RT[4] - g_RT[9] - g_RT[42] + g_RT[45];
-
-#ifdef __INTEL_COMPILER
-     #pragma simd
-#endif
-    for (int i=0; i<235; ++i) {
-        Kc[i] = exp(Kc[i]);
-    };
-
     /*reference concentration: P_atm / (RT) in inverse mol/m^3 */
     double refC = 101325 / 8.31451 * invT;
     double refCinv = 1 / refC;
 
-    Kc[0] *= refCinv;
-    Kc[1] *= refCinv;
-    Kc[2] *= refCinv;
-    Kc[3] *= refCinv;
-    Kc[4] *= refCinv;
-    Kc[5] *= refC;
-    Kc[6] *= refC;
-    Kc[7] *= refC;
-    Kc[8] *= refC;
-    Kc[9] *= refC;
-    Kc[10] *= refC;
-    Kc[11] *= refCinv;
-    Kc[12] *= refCinv;
-    Kc[13] *= refCinv;
-    Kc[14] *= refCinv;
-    Kc[15] *= refCinv;
-    Kc[16] *= refC;
-    Kc[17] *= refCinv;
-    Kc[18] *= refC;
-    Kc[19] *= refCinv;
-    Kc[20] *= refC;
-    Kc[21] *= refCinv;
-    Kc[22] *= refCinv;
-    Kc[23] *= refCinv;
-    Kc[24] *= refCinv;
-    Kc[25] *= refCinv;
-    Kc[26] *= refC;
-    Kc[28] *= refC;
-    Kc[29] *= refC;
-    Kc[30] *= refC;
-    Kc[31] *= refC;
-    Kc[33] *= refC;
-    Kc[34] *= refC;
-    Kc[35] *= refC;
-    Kc[80] *= refC;
-    Kc[85] *= refC;
-    Kc[88] *= refC;
-    Kc[89] *= refC;
-    Kc[115] *= refC;
-    Kc[130] *= refC;
-    Kc[131] *= refC;
-    Kc[132] *= refC;
-    Kc[133] *= refC;
-    Kc[151] *= refC;
-    Kc[156] *= refC;
-    Kc[157] *= refC;
-    Kc[158] *= refC;
-    Kc[160] *= refC;
-    Kc[161] *= refC;
-    Kc[188] *= refCinv;
-    Kc[199] *= refC;
-    Kc[212] *= refC;
-    Kc[213] *= refC;
-    Kc[216] *= refC;
-    Kc[219] *= refC;
+    /*Kc as the ratio of the products of the species exp(g_RT)/refC, unless */
+    /*the product over a side of a reaction leaves the normal range */
+    double e_g[46], den[235];
+    for (int k=0; k<46; ++k) {
+        e_g[k] = exp(g_RT[k]) * refCinv;
+    }
+    Kc[0] = e_g[3]*e_g[4]; den[0] = e_g[9];
+    Kc[1] = e_g[5]*e_g[5]; den[1] = e_g[10];
+    Kc[2] = e_g[3]*e_g[13]; den[2] = e_g[14];
+    Kc[3] = e_g[3]*e_g[16]; den[3] = e_g[15];
+    Kc[4] = e_g[16]*e_g[16]; den[4] = e_g[22];
+    Kc[5] = e_g[22]; den[5] = e_g[3]*e_g[21];
+    Kc[6] = e_g[21]; den[6] = e_g[3]*e_g[19];
+    Kc[7] = e_g[25]; den[7] = e_g[3]*e_g[24];
+    Kc[8] = e_g[32]; den[8] = e_g[5]*e_g[16];
+    Kc[9] = e_g[33]; den[9] = e_g[16]*e_g[31];
+    Kc[10] = e_g[33]; den[10] = e_g[8]*e_g[19];
+    Kc[11] = e_g[3]*e_g[40]; den[11] = e_g[39];
+    Kc[12] = e_g[3]*e_g[39]; den[12] = e_g[41];
+    Kc[13] = e_g[16]*e_g[24]; den[13] = e_g[41];
+    Kc[14] = e_g[3]*e_g[41]; den[14] = e_g[42];
+    Kc[15] = e_g[16]*e_g[25]; den[15] = e_g[42];
+    Kc[16] = e_g[43]; den[16] = e_g[16]*e_g[21];
+    Kc[17] = e_g[3]*e_g[42]; den[17] = e_g[44];
+    Kc[18] = e_g[45]; den[18] = e_g[16]*e_g[19];
+    Kc[19] = e_g[3]*e_g[42]; den[19] = e_g[45];
+    Kc[20] = e_g[37]; den[20] = e_g[11]*e_g[16];
+    Kc[21] = e_g[3]*e_g[3]; den[21] = e_g[7];
+    Kc[22] = e_g[3]*e_g[5]; den[22] = e_g[8];
+    Kc[23] = e_g[6]*e_g[6]; den[23] = e_g[4];
+    Kc[24] = e_g[3]*e_g[6]; den[24] = e_g[5];
+    Kc[25] = e_g[5]*e_g[6]; den[25] = e_g[9];
+    Kc[26] = e_g[13]; den[26] = e_g[3]*e_g[11];
+    Kc[27] = e_g[18]; den[27] = e_g[17];
+    Kc[28] = e_g[20]; den[28] = e_g[3]*e_g[14];
+    Kc[29] = e_g[19]; den[29] = e_g[3]*e_g[25];
+    Kc[30] = e_g[19]; den[30] = e_g[7]*e_g[24];
+    Kc[31] = e_g[31]; den[31] = e_g[3]*e_g[14];
+    Kc[32] = e_g[20]; den[32] = e_g[31];
+    Kc[33] = e_g[38]; den[33] = e_g[3]*e_g[34];
+    Kc[34] = e_g[38]; den[34] = e_g[14]*e_g[16];
+    Kc[35] = e_g[35]; den[35] = e_g[3]*e_g[34];
+    Kc[36] = e_g[3]*e_g[4]; den[36] = e_g[5]*e_g[6];
+    Kc[37] = e_g[6]*e_g[7]; den[37] = e_g[3]*e_g[5];
+    Kc[38] = e_g[5]*e_g[7]; den[38] = e_g[3]*e_g[8];
+    Kc[39] = e_g[6]*e_g[8]; den[39] = e_g[5]*e_g[5];
+    Kc[40] = e_g[3]*e_g[9]; den[40] = e_g[5]*e_g[5];
+    Kc[41] = e_g[3]*e_g[9]; den[41] = e_g[4]*e_g[7];
+    Kc[42] = e_g[3]*e_g[9]; den[42] = e_g[6]*e_g[8];
+    Kc[43] = e_g[6]*e_g[9]; den[43] = e_g[4]*e_g[5];
+    Kc[44] = e_g[5]*e_g[9]; den[44] = e_g[4]*e_g[8];
+    Kc[45] = e_g[9]*e_g[9]; den[45] = e_g[4]*e_g[10];
+    Kc[46] = e_g[3]*e_g[10]; den[46] = e_g[7]*e_g[9];
+    Kc[47] = e_g[3]*e_g[10]; den[47] = e_g[5]*e_g[8];
+    Kc[48] = e_g[5]*e_g[10]; den[48] = e_g[8]*e_g[9];
+    Kc[49] = e_g[6]*e_g[10]; den[49] = e_g[5]*e_g[9];
+    Kc[50] = e_g[5]*e_g[11]; den[50] = e_g[3]*e_g[12];
+    Kc[51] = e_g[9]*e_g[11]; den[51] = e_g[5]*e_g[12];
+    Kc[52] = e_g[4]*e_g[11]; den[52] = e_g[6]*e_g[12];
+    Kc[53] = e_g[3]*e_g[13]; den[53] = e_g[7]*e_g[11];
+    Kc[54] = e_g[6]*e_g[13]; den[54] = e_g[5]*e_g[11];
+    Kc[55] = e_g[6]*e_g[13]; den[55] = e_g[3]*e_g[12];
+    Kc[56] = e_g[5]*e_g[13]; den[56] = e_g[8]*e_g[11];
+    Kc[57] = e_g[4]*e_g[13]; den[57] = e_g[9]*e_g[11];
+    Kc[58] = e_g[13]*e_g[16]; den[58] = e_g[11]*e_g[15];
+    Kc[59] = e_g[3]*e_g[14]; den[59] = e_g[7]*e_g[13];
+    Kc[60] = e_g[6]*e_g[14]; den[60] = e_g[5]*e_g[13];
+    Kc[61] = e_g[5]*e_g[14]; den[61] = e_g[8]*e_g[13];
+    Kc[62] = e_g[4]*e_g[14]; den[62] = e_g[9]*e_g[13];
+    Kc[63] = e_g[9]*e_g[14]; den[63] = e_g[10]*e_g[13];
+    Kc[64] = e_g[3]*e_g[15]; den[64] = e_g[7]*e_g[16];
+    Kc[65] = e_g[5]*e_g[15]; den[65] = e_g[8]*e_g[16];
+    Kc[66] = e_g[6]*e_g[15]; den[66] = e_g[5]*e_g[16];
+    Kc[67] = e_g[4]*e_g[15]; den[67] = e_g[9]*e_g[16];
+    Kc[68] = e_g[9]*e_g[15]; den[68] = e_g[10]*e_g[16];
+    Kc[69] = e_g[3]*e_g[16]; den[69] = e_g[7]*e_g[17];
+    Kc[70] = e_g[3]*e_g[16]; den[70] = e_g[7]*e_g[18];
+    Kc[71] = e_g[5]*e_g[16]; den[71] = e_g[8]*e_g[18];
+    Kc[72] = e_g[6]*e_g[16]; den[72] = e_g[3]*e_g[14];
+    Kc[73] = e_g[16]*e_g[17]; den[73] = e_g[3]*e_g[19];
+    Kc[74] = e_g[9]*e_g[16]; den[74] = e_g[5]*e_g[20];
+    Kc[75] = e_g[4]*e_g[16]; den[75] = e_g[5]*e_g[14];
+    Kc[76] = e_g[4]*e_g[16]; den[76] = e_g[6]*e_g[20];
+    Kc[77] = e_g[16]*e_g[16]; den[77] = e_g[7]*e_g[19];
+    Kc[78] = e_g[16]*e_g[16]; den[78] = e_g[3]*e_g[21];
+    Kc[79] = e_g[5]*e_g[18]; den[79] = e_g[3]*e_g[14];
+    Kc[80] = e_g[4]*e_g[18]; den[80] = e_g[3]*e_g[5]*e_g[11];
+    Kc[81] = e_g[12]*e_g[18]; den[81] = e_g[11]*e_g[14];
+    Kc[82] = e_g[3]*e_g[17]; den[82] = e_g[7]*e_g[23];
+    Kc[83] = e_g[5]*e_g[17]; den[83] = e_g[3]*e_g[14];
+    Kc[84] = e_g[5]*e_g[17]; den[84] = e_g[8]*e_g[23];
+    Kc[85] = e_g[6]*e_g[17]; den[85] = e_g[3]*e_g[3]*e_g[11];
+    Kc[86] = e_g[6]*e_g[17]; den[86] = e_g[7]*e_g[11];
+    Kc[87] = e_g[4]*e_g[17]; den[87] = e_g[7]*e_g[12];
+    Kc[88] = e_g[4]*e_g[17]; den[88] = e_g[3]*e_g[5]*e_g[11];
+    Kc[89] = e_g[17]*e_g[17]; den[89] = e_g[3]*e_g[3]*e_g[24];
+    Kc[90] = e_g[6]*e_g[23]; den[90] = e_g[3]*e_g[11];
+    Kc[91] = e_g[4]*e_g[23]; den[91] = e_g[6]*e_g[13];
+    Kc[92] = e_g[8]*e_g[23]; den[92] = e_g[3]*e_g[14];
+    Kc[93] = e_g[12]*e_g[23]; den[93] = e_g[11]*e_g[13];
+    Kc[94] = e_g[3]*e_g[20]; den[94] = e_g[7]*e_g[14];
+    Kc[95] = e_g[3]*e_g[20]; den[95] = e_g[8]*e_g[18];
+    Kc[96] = e_g[5]*e_g[20]; den[96] = e_g[8]*e_g[14];
+    Kc[97] = e_g[6]*e_g[20]; den[97] = e_g[5]*e_g[14];
+    Kc[98] = e_g[4]*e_g[20]; den[98] = e_g[9]*e_g[14];
+    Kc[99] = e_g[3]*e_g[22]; den[99] = e_g[7]*e_g[21];
+    Kc[100] = e_g[6]*e_g[22]; den[100] = e_g[5]*e_g[21];
+    Kc[101] = e_g[5]*e_g[22]; den[101] = e_g[8]*e_g[21];
+    Kc[102] = e_g[16]*e_g[22]; den[102] = e_g[15]*e_g[21];
+    Kc[103] = e_g[9]*e_g[22]; den[103] = e_g[10]*e_g[21];
+    Kc[104] = e_g[3]*e_g[21]; den[104] = e_g[7]*e_g[19];
+    Kc[105] = e_g[6]*e_g[21]; den[105] = e_g[5]*e_g[19];
+    Kc[106] = e_g[6]*e_g[21]; den[106] = e_g[14]*e_g[16];
+    Kc[107] = e_g[4]*e_g[21]; den[107] = e_g[9]*e_g[19];
+    Kc[108] = e_g[3]*e_g[19]; den[108] = e_g[7]*e_g[25];
+    Kc[109] = e_g[5]*e_g[19]; den[109] = e_g[8]*e_g[25];
+    Kc[110] = e_g[6]*e_g[19]; den[110] = e_g[13]*e_g[16];
+    Kc[111] = e_g[6]*e_g[19]; den[111] = e_g[3]*e_g[26];
+    Kc[112] = e_g[19]*e_g[19]; den[112] = e_g[21]*e_g[25];
+    Kc[113] = e_g[4]*e_g[19]; den[113] = e_g[9]*e_g[25];
+    Kc[114] = e_g[9]*e_g[19]; den[114] = e_g[5]*e_g[27];
+    Kc[115] = e_g[9]*e_g[27]; den[115] = e_g[10]*e_g[11]*e_g[16];
+    Kc[116] = e_g[3]*e_g[25]; den[116] = e_g[7]*e_g[24];
+    Kc[117] = e_g[4]*e_g[25]; den[117] = e_g[13]*e_g[14];
+    Kc[118] = e_g[4]*e_g[25]; den[118] = e_g[6]*e_g[26];
+    Kc[119] = e_g[4]*e_g[25]; den[119] = e_g[9]*e_g[24];
+    Kc[120] = e_g[6]*e_g[24]; den[120] = e_g[3]*e_g[29];
+    Kc[121] = e_g[6]*e_g[24]; den[121] = e_g[11]*e_g[17];
+    Kc[122] = e_g[4]*e_g[24]; den[122] = e_g[11]*e_g[14];
+    Kc[123] = e_g[5]*e_g[24]; den[123] = e_g[3]*e_g[28];
+    Kc[124] = e_g[5]*e_g[24]; den[124] = e_g[8]*e_g[30];
+    Kc[125] = e_g[3]*e_g[28]; den[125] = e_g[11]*e_g[16];
+    Kc[126] = e_g[6]*e_g[28]; den[126] = e_g[12]*e_g[17];
+    Kc[127] = e_g[6]*e_g[28]; den[127] = e_g[5]*e_g[29];
+    Kc[128] = e_g[16]*e_g[28]; den[128] = e_g[11]*e_g[21];
+    Kc[129] = e_g[3]*e_g[29]; den[129] = e_g[11]*e_g[18];
+    Kc[130] = e_g[5]*e_g[29]; den[130] = e_g[3]*e_g[11]*e_g[13];
+    Kc[131] = e_g[6]*e_g[29]; den[131] = e_g[3]*e_g[11]*e_g[11];
+    Kc[132] = e_g[4]*e_g[29]; den[132] = e_g[5]*e_g[11]*e_g[11];
+    Kc[133] = e_g[4]*e_g[29]; den[133] = e_g[3]*e_g[11]*e_g[12];
+    Kc[134] = e_g[5]*e_g[30]; den[134] = e_g[3]*e_g[29];
+    Kc[135] = e_g[6]*e_g[30]; den[135] = e_g[11]*e_g[23];
+    Kc[136] = e_g[4]*e_g[30]; den[136] = e_g[6]*e_g[29];
+    Kc[137] = e_g[4]*e_g[30]; den[137] = e_g[12]*e_g[23];
+    Kc[138] = e_g[4]*e_g[30]; den[138] = e_g[11]*e_g[13];
+    Kc[139] = e_g[3]*e_g[31]; den[139] = e_g[7]*e_g[14];
+    Kc[140] = e_g[3]*e_g[31]; den[140] = e_g[5]*e_g[16];
+    Kc[141] = e_g[5]*e_g[31]; den[141] = e_g[8]*e_g[14];
+    Kc[142] = e_g[4]*e_g[31]; den[142] = e_g[9]*e_g[14];
+    Kc[143] = e_g[5]*e_g[28]; den[143] = e_g[11]*e_g[31];
+    Kc[144] = e_g[5]*e_g[32]; den[144] = e_g[8]*e_g[31];
+    Kc[145] = e_g[5]*e_g[32]; den[145] = e_g[8]*e_g[20];
+    Kc[146] = e_g[3]*e_g[32]; den[146] = e_g[7]*e_g[31];
+    Kc[147] = e_g[3]*e_g[32]; den[147] = e_g[7]*e_g[20];
+    Kc[148] = e_g[6]*e_g[32]; den[148] = e_g[5]*e_g[31];
+    Kc[149] = e_g[9]*e_g[32]; den[149] = e_g[10]*e_g[31];
+    Kc[150] = e_g[4]*e_g[32]; den[150] = e_g[9]*e_g[31];
+    Kc[151] = e_g[26]; den[151] = e_g[3]*e_g[28];
+    Kc[152] = e_g[3]*e_g[26]; den[152] = e_g[13]*e_g[16];
+    Kc[153] = e_g[3]*e_g[26]; den[153] = e_g[7]*e_g[28];
+    Kc[154] = e_g[6]*e_g[26]; den[154] = e_g[13]*e_g[14];
+    Kc[155] = e_g[5]*e_g[26]; den[155] = e_g[8]*e_g[28];
+    Kc[156] = e_g[4]*e_g[26]; den[156] = e_g[5]*e_g[11]*e_g[14];
+    Kc[157] = e_g[16]*e_g[26]; den[157] = e_g[3]*e_g[11]*e_g[21];
+    Kc[158] = e_g[9]*e_g[26]; den[158] = e_g[5]*e_g[13]*e_g[14];
+    Kc[159] = e_g[9]*e_g[26]; den[159] = e_g[4]*e_g[34];
+    Kc[160] = e_g[26]; den[160] = e_g[11]*e_g[16];
+    Kc[161] = e_g[34]; den[161] = e_g[13]*e_g[16];
+    Kc[162] = e_g[5]*e_g[34]; den[162] = e_g[8]*e_g[37];
+    Kc[163] = e_g[5]*e_g[34]; den[163] = e_g[8]*e_g[26];
+    Kc[164] = e_g[6]*e_g[34]; den[164] = e_g[5]*e_g[37];
+    Kc[165] = e_g[6]*e_g[34]; den[165] = e_g[5]*e_g[26];
+    Kc[166] = e_g[3]*e_g[34]; den[166] = e_g[7]*e_g[37];
+    Kc[167] = e_g[3]*e_g[34]; den[167] = e_g[7]*e_g[26];
+    Kc[168] = e_g[16]*e_g[34]; den[168] = e_g[15]*e_g[37];
+    Kc[169] = e_g[16]*e_g[34]; den[169] = e_g[15]*e_g[26];
+    Kc[170] = e_g[9]*e_g[34]; den[170] = e_g[10]*e_g[37];
+    Kc[171] = e_g[9]*e_g[34]; den[171] = e_g[10]*e_g[26];
+    Kc[172] = e_g[4]*e_g[34]; den[172] = e_g[9]*e_g[37];
+    Kc[173] = e_g[5]*e_g[33]; den[173] = e_g[8]*e_g[36];
+    Kc[174] = e_g[5]*e_g[33]; den[174] = e_g[8]*e_g[35];
+    Kc[175] = e_g[5]*e_g[33]; den[175] = e_g[8]*e_g[38];
+    Kc[176] = e_g[3]*e_g[33]; den[176] = e_g[7]*e_g[36];
+    Kc[177] = e_g[3]*e_g[33]; den[177] = e_g[7]*e_g[35];
+    Kc[178] = e_g[3]*e_g[33]; den[178] = e_g[7]*e_g[38];
+    Kc[179] = e_g[6]*e_g[33]; den[179] = e_g[5]*e_g[36];
+    Kc[180] = e_g[6]*e_g[33]; den[180] = e_g[5]*e_g[35];
+    Kc[181] = e_g[6]*e_g[33]; den[181] = e_g[5]*e_g[38];
+    Kc[182] = e_g[16]*e_g[33]; den[182] = e_g[15]*e_g[36];
+    Kc[183] = e_g[16]*e_g[33]; den[183] = e_g[15]*e_g[35];
+    Kc[184] = e_g[16]*e_g[33]; den[184] = e_g[15]*e_g[38];
+    Kc[185] = e_g[9]*e_g[33]; den[185] = e_g[10]*e_g[35];
+    Kc[186] = e_g[9]*e_g[33]; den[186] = e_g[10]*e_g[36];
+    Kc[187] = e_g[9]*e_g[33]; den[187] = e_g[10]*e_g[38];
+    Kc[188] = e_g[5]*e_g[19]; den[188] = e_g[36];
+    Kc[189] = e_g[9]*e_g[21]; den[189] = e_g[5]*e_g[38];
+    Kc[190] = e_g[4]*e_g[38]; den[190] = e_g[9]*e_g[34];
+    Kc[191] = e_g[11]*e_g[38]; den[191] = e_g[12]*e_g[21];
+    Kc[192] = e_g[3]*e_g[38]; den[192] = e_g[16]*e_g[31];
+    Kc[193] = e_g[3]*e_g[38]; den[193] = e_g[8]*e_g[19];
+    Kc[194] = e_g[5]*e_g[38]; den[194] = e_g[8]*e_g[34];
+    Kc[195] = e_g[4]*e_g[35]; den[195] = e_g[9]*e_g[34];
+    Kc[196] = e_g[6]*e_g[35]; den[196] = e_g[5]*e_g[34];
+    Kc[197] = e_g[3]*e_g[35]; den[197] = e_g[8]*e_g[19];
+    Kc[198] = e_g[3]*e_g[35]; den[198] = e_g[16]*e_g[31];
+    Kc[199] = e_g[9]*e_g[35]; den[199] = e_g[5]*e_g[5]*e_g[34];
+    Kc[200] = e_g[5]*e_g[35]; den[200] = e_g[8]*e_g[34];
+    Kc[201] = e_g[6]*e_g[39]; den[201] = e_g[11]*e_g[19];
+    Kc[202] = e_g[16]*e_g[24]; den[202] = e_g[3]*e_g[39];
+    Kc[203] = e_g[6]*e_g[39]; den[203] = e_g[16]*e_g[29];
+    Kc[204] = e_g[9]*e_g[40]; den[204] = e_g[4]*e_g[39];
+    Kc[205] = e_g[5]*e_g[39]; den[205] = e_g[8]*e_g[40];
+    Kc[206] = e_g[4]*e_g[40]; den[206] = e_g[13]*e_g[28];
+    Kc[207] = e_g[3]*e_g[41]; den[207] = e_g[7]*e_g[39];
+    Kc[208] = e_g[4]*e_g[41]; den[208] = e_g[9]*e_g[39];
+    Kc[209] = e_g[16]*e_g[41]; den[209] = e_g[15]*e_g[39];
+    Kc[210] = e_g[5]*e_g[41]; den[210] = e_g[8]*e_g[39];
+    Kc[211] = e_g[13]*e_g[40]; den[211] = e_g[11]*e_g[39];
+    Kc[212] = e_g[9]*e_g[40]; den[212] = e_g[5]*e_g[11]*e_g[25];
+    Kc[213] = e_g[4]*e_g[39]; den[213] = e_g[11]*e_g[13]*e_g[16];
+    Kc[214] = e_g[6]*e_g[42]; den[214] = e_g[13]*e_g[21];
+    Kc[215] = e_g[5]*e_g[42]; den[215] = e_g[8]*e_g[41];
+    Kc[216] = e_g[6]*e_g[42]; den[216] = e_g[3]*e_g[16]*e_g[28];
+    Kc[217] = e_g[3]*e_g[42]; den[217] = e_g[7]*e_g[41];
+    Kc[218] = e_g[9]*e_g[41]; den[218] = e_g[4]*e_g[42];
+    Kc[219] = e_g[9]*e_g[41]; den[219] = e_g[5]*e_g[14]*e_g[25];
+    Kc[220] = e_g[3]*e_g[42]; den[220] = e_g[16]*e_g[19];
+    Kc[221] = e_g[16]*e_g[25]; den[221] = e_g[3]*e_g[41];
+    Kc[222] = e_g[4]*e_g[43]; den[222] = e_g[9]*e_g[44];
+    Kc[223] = e_g[4]*e_g[43]; den[223] = e_g[9]*e_g[45];
+    Kc[224] = e_g[3]*e_g[43]; den[224] = e_g[7]*e_g[44];
+    Kc[225] = e_g[3]*e_g[43]; den[225] = e_g[7]*e_g[45];
+    Kc[226] = e_g[6]*e_g[43]; den[226] = e_g[5]*e_g[44];
+    Kc[227] = e_g[6]*e_g[43]; den[227] = e_g[5]*e_g[45];
+    Kc[228] = e_g[5]*e_g[43]; den[228] = e_g[8]*e_g[45];
+    Kc[229] = e_g[5]*e_g[43]; den[229] = e_g[8]*e_g[44];
+    Kc[230] = e_g[9]*e_g[43]; den[230] = e_g[10]*e_g[44];
+    Kc[231] = e_g[9]*e_g[43]; den[231] = e_g[10]*e_g[45];
+    Kc[232] = e_g[43]*e_g[44]; den[232] = e_g[43]*e_g[45];
+    Kc[233] = e_g[4]*e_g[44]; den[233] = e_g[9]*e_g[42];
+    Kc[234] = e_g[4]*e_g[45]; den[234] = e_g[9]*e_g[42];
+    int inrange = 1;
+    for (int i=0; i<235; ++i) {
+        inrange &= Kc[i] >= DBL_MIN && Kc[i] <= DBL_MAX && den[i] >= DBL_MIN && den[i] <= DBL_MAX;
+    }
+
+    if (inrange) {
+        for (int i=0; i<235; ++i) {
+            Kc[i] /= den[i];
+        }
+    }
+    else {
+        Kc[0] = exp(g_RT[3] + g_RT[4] - g_RT[9]);
+        Kc[1] = exp(2*g_RT[5] - g_RT[10]);
+        Kc[2] = exp(g_RT[3] + g_RT[13] - g_RT[14]);
+        Kc[3] = exp(g_RT[3] - g_RT[15] + g_RT[16]);
+        Kc[4] = exp(2*g_RT[16] - g_RT[22]);
+        Kc[5] = exp(-g_RT[3] - g_RT[21] + g_RT[22]);
+        Kc[6] = exp(-g_RT[3] - g_RT[19] + g_RT[21]);
+        Kc[7] = exp(-g_RT[3] - g_RT[24] + g_RT[25]);
+        Kc[8] = exp(-g_RT[5] - g_RT[16] + g_RT[32]);
+        Kc[9] = exp(-g_RT[16] - g_RT[31] + g_RT[33]);
+        Kc[10] = exp(-g_RT[8] - g_RT[19] + g_RT[33]);
+        Kc[11] = exp(g_RT[3] - g_RT[39] + g_RT[40]);
+        Kc[12] = exp(g_RT[3] + g_RT[39] - g_RT[41]);
+        Kc[13] = exp(g_RT[16] + g_RT[24] - g_RT[41]);
+        Kc[14] = exp(g_RT[3] + g_RT[41] - g_RT[42]);
+        Kc[15] = exp(g_RT[16] + g_RT[25] - g_RT[42]);
+        Kc[16] = exp(-g_RT[16] - g_RT[21] + g_RT[43]);
+        Kc[17] = exp(g_RT[3] + g_RT[42] - g_RT[44]);
+        Kc[18] = exp(-g_RT[16] - g_RT[19] + g_RT[45]);
+        Kc[19] = exp(g_RT[3] + g_RT[42] - g_RT[45]);
+        Kc[20] = exp(-g_RT[11] - g_RT[16] + g_RT[37]);
+        Kc[21] = exp(g_RT[3] + g_RT[3] - g_RT[7]);
+        Kc[22] = exp(g_RT[3] + g_RT[5] - g_RT[8]);
+        Kc[23] = exp(-g_RT[4] + g_RT[6] + g_RT[6]);
+        Kc[24] = exp(g_RT[3] - g_RT[5] + g_RT[6]);
+        Kc[25] = exp(g_RT[5] + g_RT[6] - g_RT[9]);
+        Kc[26] = exp(-g_RT[3] - g_RT[11] + g_RT[13]);
+        Kc[27] = exp(-g_RT[17] + g_RT[18]);
+        Kc[28] = exp(-g_RT[3] - g_RT[14] + g_RT[20]);
+        Kc[29] = exp(-g_RT[3] + g_RT[19] - g_RT[25]);
+        Kc[30] = exp(-g_RT[7] + g_RT[19] - g_RT[24]);
+        Kc[31] = exp(-g_RT[3] - g_RT[14] + g_RT[31]);
+        Kc[32] = exp(g_RT[20] - g_RT[31]);
+        Kc[33] = exp(-g_RT[3] - g_RT[34] + g_RT[38]);
+        Kc[34] = exp(-g_RT[14] - g_RT[16] + g_RT[38]);
+        Kc[35] = exp(-g_RT[3] - g_RT[34] + g_RT[35]);
+        Kc[36] = exp(g_RT[3] + g_RT[4] - g_RT[5] - g_RT[6]);
+        Kc[37] = exp(-g_RT[3] - g_RT[5] + g_RT[6] + g_RT[7]);
+        Kc[38] = exp(-g_RT[3] + g_RT[5] + g_RT[7] - g_RT[8]);
+        Kc[39] = exp(-2*g_RT[5] + g_RT[6] + g_RT[8]);
+        Kc[40] = exp(g_RT[3] - 2*g_RT[5] + g_RT[9]);
+        Kc[41] = exp(g_RT[3] - g_RT[4] - g_RT[7] + g_RT[9]);
+        Kc[42] = exp(g_RT[3] - g_RT[6] - g_RT[8] + g_RT[9]);
+        Kc[43] = exp(-g_RT[4] - g_RT[5] + g_RT[6] + g_RT[9]);
+        Kc[44] = exp(-g_RT[4] + g_RT[5] - g_RT[8] + g_RT[9]);
+        Kc[45] = exp(-g_RT[4] + 2*g_RT[9] - g_RT[10]);
+        Kc[46] = exp(g_RT[3] - g_RT[7] - g_RT[9] + g_RT[10]);
+        Kc[47] = exp(g_RT[3] - g_RT[5] - g_RT[8] + g_RT[10]);
+        Kc[48] = exp(g_RT[5] - g_RT[8] - g_RT[9] + g_RT[10]);
+        Kc[49] = exp(-g_RT[5] + g_RT[6] - g_RT[9] + g_RT[10]);
+        Kc[50] = exp(-g_RT[3] + g_RT[5] + g_RT[11] - g_RT[12]);
+        Kc[51] = exp(-g_RT[5] + g_RT[9] + g_RT[11] - g_RT[12]);
+        Kc[52] = exp(g_RT[4] - g_RT[6] + g_RT[11] - g_RT[12]);
+        Kc[53] = exp(g_RT[3] - g_RT[7] - g_RT[11] + g_RT[13]);
+        Kc[54] = exp(-g_RT[5] + g_RT[6] - g_RT[11] + g_RT[13]);
+        Kc[55] = exp(-g_RT[3] + g_RT[6] - g_RT[12] + g_RT[13]);
+        Kc[56] = exp(g_RT[5] - g_RT[8] - g_RT[11] + g_RT[13]);
+        Kc[57] = exp(g_RT[4] - g_RT[9] - g_RT[11] + g_RT[13]);
+        Kc[58] = exp(-g_RT[11] + g_RT[13] - g_RT[15] + g_RT[16]);
+        Kc[59] = exp(g_RT[3] - g_RT[7] - g_RT[13] + g_RT[14]);
+        Kc[60] = exp(-g_RT[5] + g_RT[6] - g_RT[13] + g_RT[14]);
+        Kc[61] = exp(g_RT[5] - g_RT[8] - g_RT[13] + g_RT[14]);
+        Kc[62] = exp(g_RT[4] - g_RT[9] - g_RT[13] + g_RT[14]);
+        Kc[63] = exp(g_RT[9] - g_RT[10] - g_RT[13] + g_RT[14]);
+        Kc[64] = exp(g_RT[3] - g_RT[7] + g_RT[15] - g_RT[16]);
+        Kc[65] = exp(g_RT[5] - g_RT[8] + g_RT[15] - g_RT[16]);
+        Kc[66] = exp(-g_RT[5] + g_RT[6] + g_RT[15] - g_RT[16]);
+        Kc[67] = exp(g_RT[4] - g_RT[9] + g_RT[15] - g_RT[16]);
+        Kc[68] = exp(g_RT[9] - g_RT[10] + g_RT[15] - g_RT[16]);
+        Kc[69] = exp(g_RT[3] - g_RT[7] + g_RT[16] - g_RT[17]);
+        Kc[70] = exp(g_RT[3] - g_RT[7] + g_RT[16] - g_RT[18]);
+        Kc[71] = exp(g_RT[5] - g_RT[8] + g_RT[16] - g_RT[18]);
+        Kc[72] = exp(-g_RT[3] + g_RT[6] - g_RT[14] + g_RT[16]);
+        Kc[73] = exp(-g_RT[3] + g_RT[16] + g_RT[17] - g_RT[19]);
+        Kc[74] = exp(-g_RT[5] + g_RT[9] + g_RT[16] - g_RT[20]);
+        Kc[75] = exp(g_RT[4] - g_RT[5] - g_RT[14] + g_RT[16]);
+        Kc[76] = exp(g_RT[4] - g_RT[6] + g_RT[16] - g_RT[20]);
+        Kc[77] = exp(-g_RT[7] + g_RT[16] + g_RT[16] - g_RT[19]);
+        Kc[78] = exp(-g_RT[3] + g_RT[16] + g_RT[16] - g_RT[21]);
+        Kc[79] = exp(-g_RT[3] + g_RT[5] - g_RT[14] + g_RT[18]);
+        Kc[80] = exp(-g_RT[3] + g_RT[4] - g_RT[5] - g_RT[11] + g_RT[18]);
+        Kc[81] = exp(-g_RT[11] + g_RT[12] - g_RT[14] + g_RT[18]);
+        Kc[82] = exp(g_RT[3] - g_RT[7] + g_RT[17] - g_RT[23]);
+        Kc[83] = exp(-g_RT[3] + g_RT[5] - g_RT[14] + g_RT[17]);
+        Kc[84] = exp(g_RT[5] - g_RT[8] + g_RT[17] - g_RT[23]);
+        Kc[85] = exp(-2*g_RT[3] + g_RT[6] - g_RT[11] + g_RT[17]);
+        Kc[86] = exp(g_RT[6] - g_RT[7] - g_RT[11] + g_RT[17]);
+        Kc[87] = exp(g_RT[4] - g_RT[7] - g_RT[12] + g_RT[17]);
+        Kc[88] = exp(-g_RT[3] + g_RT[4] - g_RT[5] - g_RT[11] + g_RT[17]);
+        Kc[89] = exp(-2*g_RT[3] + g_RT[17] + g_RT[17] - g_RT[24]);
+        Kc[90] = exp(-g_RT[3] + g_RT[6] - g_RT[11] + g_RT[23]);
+        Kc[91] = exp(g_RT[4] - g_RT[6] - g_RT[13] + g_RT[23]);
+        Kc[92] = exp(-g_RT[3] + g_RT[8] - g_RT[14] + g_RT[23]);
+        Kc[93] = exp(-g_RT[11] + g_RT[12] - g_RT[13] + g_RT[23]);
+        Kc[94] = exp(g_RT[3] - g_RT[7] - g_RT[14] + g_RT[20]);
+        Kc[95] = exp(g_RT[3] - g_RT[8] - g_RT[18] + g_RT[20]);
+        Kc[96] = exp(g_RT[5] - g_RT[8] - g_RT[14] + g_RT[20]);
+        Kc[97] = exp(-g_RT[5] + g_RT[6] - g_RT[14] + g_RT[20]);
+        Kc[98] = exp(g_RT[4] - g_RT[9] - g_RT[14] + g_RT[20]);
+        Kc[99] = exp(g_RT[3] - g_RT[7] - g_RT[21] + g_RT[22]);
+        Kc[100] = exp(-g_RT[5] + g_RT[6] - g_RT[21] + g_RT[22]);
+        Kc[101] = exp(g_RT[5] - g_RT[8] - g_RT[21] + g_RT[22]);
+        Kc[102] = exp(-g_RT[15] + g_RT[16] - g_RT[21] + g_RT[22]);
+        Kc[103] = exp(g_RT[9] - g_RT[10] - g_RT[21] + g_RT[22]);
+        Kc[104] = exp(g_RT[3] - g_RT[7] - g_RT[19] + g_RT[21]);
+        Kc[105] = exp(-g_RT[5] + g_RT[6] - g_RT[19] + g_RT[21]);
+        Kc[106] = exp(g_RT[6] - g_RT[14] - g_RT[16] + g_RT[21]);
+        Kc[107] = exp(g_RT[4] - g_RT[9] - g_RT[19] + g_RT[21]);
+        Kc[108] = exp(g_RT[3] - g_RT[7] + g_RT[19] - g_RT[25]);
+        Kc[109] = exp(g_RT[5] - g_RT[8] + g_RT[19] - g_RT[25]);
+        Kc[110] = exp(g_RT[6] - g_RT[13] - g_RT[16] + g_RT[19]);
+        Kc[111] = exp(-g_RT[3] + g_RT[6] + g_RT[19] - g_RT[26]);
+        Kc[112] = exp(g_RT[19] + g_RT[19] - g_RT[21] - g_RT[25]);
+        Kc[113] = exp(g_RT[4] - g_RT[9] + g_RT[19] - g_RT[25]);
+        Kc[114] = exp(-g_RT[5] + g_RT[9] + g_RT[19] - g_RT[27]);
+        Kc[115] = exp(g_RT[9] - g_RT[10] - g_RT[11] - g_RT[16] + g_RT[27]);
+        Kc[116] = exp(g_RT[3] - g_RT[7] - g_RT[24] + g_RT[25]);
+        Kc[117] = exp(g_RT[4] - g_RT[13] - g_RT[14] + g_RT[25]);
+        Kc[118] = exp(g_RT[4] - g_RT[6] + g_RT[25] - g_RT[26]);
+        Kc[119] = exp(g_RT[4] - g_RT[9] - g_RT[24] + g_RT[25]);
+        Kc[120] = exp(-g_RT[3] + g_RT[6] + g_RT[24] - g_RT[29]);
+        Kc[121] = exp(g_RT[6] - g_RT[11] - g_RT[17] + g_RT[24]);
+        Kc[122] = exp(g_RT[4] - g_RT[11] - g_RT[14] + g_RT[24]);
+        Kc[123] = exp(-g_RT[3] + g_RT[5] + g_RT[24] - g_RT[28]);
+        Kc[124] = exp(g_RT[5] - g_RT[8] + g_RT[24] - g_RT[30]);
+        Kc[125] = exp(g_RT[3] - g_RT[11] - g_RT[16] + g_RT[28]);
+        Kc[126] = exp(g_RT[6] - g_RT[12] - g_RT[17] + g_RT[28]);
+        Kc[127] = exp(-g_RT[5] + g_RT[6] + g_RT[28] - g_RT[29]);
+        Kc[128] = exp(-g_RT[11] + g_RT[16] - g_RT[21] + g_RT[28]);
+        Kc[129] = exp(g_RT[3] - g_RT[11] - g_RT[18] + g_RT[29]);
+        Kc[130] = exp(-g_RT[3] + g_RT[5] - g_RT[11] - g_RT[13] + g_RT[29]);
+        Kc[131] = exp(-g_RT[3] + g_RT[6] - 2*g_RT[11] + g_RT[29]);
+        Kc[132] = exp(g_RT[4] - g_RT[5] - 2*g_RT[11] + g_RT[29]);
+        Kc[133] = exp(-g_RT[3] + g_RT[4] - g_RT[11] - g_RT[12] + g_RT[29]);
+        Kc[134] = exp(-g_RT[3] + g_RT[5] - g_RT[29] + g_RT[30]);
+        Kc[135] = exp(g_RT[6] - g_RT[11] - g_RT[23] + g_RT[30]);
+        Kc[136] = exp(g_RT[4] - g_RT[6] - g_RT[29] + g_RT[30]);
+        Kc[137] = exp(g_RT[4] - g_RT[12] - g_RT[23] + g_RT[30]);
+        Kc[138] = exp(g_RT[4] - g_RT[11] - g_RT[13] + g_RT[30]);
+        Kc[139] = exp(g_RT[3] - g_RT[7] - g_RT[14] + g_RT[31]);
+        Kc[140] = exp(g_RT[3] - g_RT[5] - g_RT[16] + g_RT[31]);
+        Kc[141] = exp(g_RT[5] - g_RT[8] - g_RT[14] + g_RT[31]);
+        Kc[142] = exp(g_RT[4] - g_RT[9] - g_RT[14] + g_RT[31]);
+        Kc[143] = exp(g_RT[5] - g_RT[11] + g_RT[28] - g_RT[31]);
+        Kc[144] = exp(g_RT[5] - g_RT[8] - g_RT[31] + g_RT[32]);
+        Kc[145] = exp(g_RT[5] - g_RT[8] - g_RT[20] + g_RT[32]);
+        Kc[146] = exp(g_RT[3] - g_RT[7] - g_RT[31] + g_RT[32]);
+        Kc[147] = exp(g_RT[3] - g_RT[7] - g_RT[20] + g_RT[32]);
+        Kc[148] = exp(-g_RT[5] + g_RT[6] - g_RT[31] + g_RT[32]);
+        Kc[149] = exp(g_RT[9] - g_RT[10] - g_RT[31] + g_RT[32]);
+        Kc[150] = exp(g_RT[4] - g_RT[9] - g_RT[31] + g_RT[32]);
+        Kc[151] = exp(-g_RT[3] + g_RT[26] - g_RT[28]);
+        Kc[152] = exp(g_RT[3] - g_RT[13] - g_RT[16] + g_RT[26]);
+        Kc[153] = exp(g_RT[3] - g_RT[7] + g_RT[26] - g_RT[28]);
+        Kc[154] = exp(g_RT[6] - g_RT[13] - g_RT[14] + g_RT[26]);
+        Kc[155] = exp(g_RT[5] - g_RT[8] + g_RT[26] - g_RT[28]);
+        Kc[156] = exp(g_RT[4] - g_RT[5] - g_RT[11] - g_RT[14] + g_RT[26]);
+        Kc[157] = exp(-g_RT[3] - g_RT[11] + g_RT[16] - g_RT[21] + g_RT[26]);
+        Kc[158] = exp(-g_RT[5] + g_RT[9] - g_RT[13] - g_RT[14] + g_RT[26]);
+        Kc[159] = exp(-g_RT[4] + g_RT[9] + g_RT[26] - g_RT[34]);
+        Kc[160] = exp(-g_RT[11] - g_RT[16] + g_RT[26]);
+        Kc[161] = exp(-g_RT[13] - g_RT[16] + g_RT[34]);
+        Kc[162] = exp(g_RT[5] - g_RT[8] + g_RT[34] - g_RT[37]);
+        Kc[163] = exp(g_RT[5] - g_RT[8] - g_RT[26] + g_RT[34]);
+        Kc[164] = exp(-g_RT[5] + g_RT[6] + g_RT[34] - g_RT[37]);
+        Kc[165] = exp(-g_RT[5] + g_RT[6] - g_RT[26] + g_RT[34]);
+        Kc[166] = exp(g_RT[3] - g_RT[7] + g_RT[34] - g_RT[37]);
+        Kc[167] = exp(g_RT[3] - g_RT[7] - g_RT[26] + g_RT[34]);
+        Kc[168] = exp(-g_RT[15] + g_RT[16] + g_RT[34] - g_RT[37]);
+        Kc[169] = exp(-g_RT[15] + g_RT[16] - g_RT[26] + g_RT[34]);
+        Kc[170] = exp(g_RT[9] - g_RT[10] + g_RT[34] - g_RT[37]);
+        Kc[171] = exp(g_RT[9] - g_RT[10] - g_RT[26] + g_RT[34]);
+        Kc[172] = exp(g_RT[4] - g_RT[9] + g_RT[34] - g_RT[37]);
+        Kc[173] = exp(g_RT[5] - g_RT[8] + g_RT[33] - g_RT[36]);
+        Kc[174] = exp(g_RT[5] - g_RT[8] + g_RT[33] - g_RT[35]);
+        Kc[175] = exp(g_RT[5] - g_RT[8] + g_RT[33] - g_RT[38]);
+        Kc[176] = exp(g_RT[3] - g_RT[7] + g_RT[33] - g_RT[36]);
+        Kc[177] = exp(g_RT[3] - g_RT[7] + g_RT[33] - g_RT[35]);
+        Kc[178] = exp(g_RT[3] - g_RT[7] + g_RT[33] - g_RT[38]);
+        Kc[179] = exp(-g_RT[5] + g_RT[6] + g_RT[33] - g_RT[36]);
+        Kc[180] = exp(-g_RT[5] + g_RT[6] + g_RT[33] - g_RT[35]);
+        Kc[181] = exp(-g_RT[5] + g_RT[6] + g_RT[33] - g_RT[38]);
+        Kc[182] = exp(-g_RT[15] + g_RT[16] + g_RT[33] - g_RT[36]);
+        Kc[183] = exp(-g_RT[15] + g_RT[16] + g_RT[33] - g_RT[35]);
+        Kc[184] = exp(-g_RT[15] + g_RT[16] + g_RT[33] - g_RT[38]);
+        Kc[185] = exp(g_RT[9] - g_RT[10] + g_RT[33] - g_RT[35]);
+        Kc[186] = exp(g_RT[9] - g_RT[10] + g_RT[33] - g_RT[36]);
+        Kc[187] = exp(g_RT[9] - g_RT[10] + g_RT[33] - g_RT[38]);
+        Kc[188] = exp(g_RT[5] + g_RT[19] - g_RT[36]);
+        Kc[189] = exp(-g_RT[5] + g_RT[9] + g_RT[21] - g_RT[38]);
+        Kc[190] = exp(g_RT[4] - g_RT[9] - g_RT[34] + g_RT[38]);
+        Kc[191] = exp(g_RT[11] - g_RT[12] - g_RT[21] + g_RT[38]);
+        Kc[192] = exp(g_RT[3] - g_RT[16] - g_RT[31] + g_RT[38]);
+        Kc[193] = exp(g_RT[3] - g_RT[8] - g_RT[19] + g_RT[38]);
+        Kc[194] = exp(g_RT[5] - g_RT[8] - g_RT[34] + g_RT[38]);
+        Kc[195] = exp(g_RT[4] - g_RT[9] - g_RT[34] + g_RT[35]);
+        Kc[196] = exp(-g_RT[5] + g_RT[6] - g_RT[34] + g_RT[35]);
+        Kc[197] = exp(g_RT[3] - g_RT[8] - g_RT[19] + g_RT[35]);
+        Kc[198] = exp(g_RT[3] - g_RT[16] - g_RT[31] + g_RT[35]);
+        Kc[199] = exp(-g_RT[5] - g_RT[5] + g_RT[9] - g_RT[34] + g_RT[35]);
+        Kc[200] = exp(g_RT[5] - g_RT[8] - g_RT[34] + g_RT[35]);
+        Kc[201] = exp(g_RT[6] - g_RT[11] - g_RT[19] + g_RT[39]);
+        Kc[202] = exp(-g_RT[3] + g_RT[16] + g_RT[24] - g_RT[39]);
+        Kc[203] = exp(g_RT[6] - g_RT[16] - g_RT[29] + g_RT[39]);
+        Kc[204] = exp(-g_RT[4] + g_RT[9] - g_RT[39] + g_RT[40]);
+        Kc[205] = exp(g_RT[5] - g_RT[8] + g_RT[39] - g_RT[40]);
+        Kc[206] = exp(g_RT[4] - g_RT[13] - g_RT[28] + g_RT[40]);
+        Kc[207] = exp(g_RT[3] - g_RT[7] - g_RT[39] + g_RT[41]);
+        Kc[208] = exp(g_RT[4] - g_RT[9] - g_RT[39] + g_RT[41]);
+        Kc[209] = exp(-g_RT[15] + g_RT[16] - g_RT[39] + g_RT[41]);
+        Kc[210] = exp(g_RT[5] - g_RT[8] - g_RT[39] + g_RT[41]);
+        Kc[211] = exp(-g_RT[11] + g_RT[13] - g_RT[39] + g_RT[40]);
+        Kc[212] = exp(-g_RT[5] + g_RT[9] - g_RT[11] - g_RT[25] + g_RT[40]);
+        Kc[213] = exp(g_RT[4] - g_RT[11] - g_RT[13] - g_RT[16] + g_RT[39]);
+        Kc[214] = exp(g_RT[6] - g_RT[13] - g_RT[21] + g_RT[42]);
+        Kc[215] = exp(g_RT[5] - g_RT[8] - g_RT[41] + g_RT[42]);
+        Kc[216] = exp(-g_RT[3] + g_RT[6] - g_RT[16] - g_RT[28] + g_RT[42]);
+        Kc[217] = exp(g_RT[3] - g_RT[7] - g_RT[41] + g_RT[42]);
+        Kc[218] = exp(-g_RT[4] + g_RT[9] + g_RT[41] - g_RT[42]);
+        Kc[219] = exp(-g_RT[5] + g_RT[9] - g_RT[14] - g_RT[25] + g_RT[41]);
+        Kc[220] = exp(g_RT[3] - g_RT[16] - g_RT[19] + g_RT[42]);
+        Kc[221] = exp(-g_RT[3] + g_RT[16] + g_RT[25] - g_RT[41]);
+        Kc[222] = exp(g_RT[4] - g_RT[9] + g_RT[43] - g_RT[44]);
+        Kc[223] = exp(g_RT[4] - g_RT[9] + g_RT[43] - g_RT[45]);
+        Kc[224] = exp(g_RT[3] - g_RT[7] + g_RT[43] - g_RT[44]);
+        Kc[225] = exp(g_RT[3] - g_RT[7] + g_RT[43] - g_RT[45]);
+        Kc[226] = exp(-g_RT[5] + g_RT[6] + g_RT[43] - g_RT[44]);
+        Kc[227] = exp(-g_RT[5] + g_RT[6] + g_RT[43] - g_RT[45]);
+        Kc[228] = exp(g_RT[5] - g_RT[8] + g_RT[43] - g_RT[45]);
+        Kc[229] = exp(g_RT[5] - g_RT[8] + g_RT[43] - g_RT[44]);
+        Kc[230] = exp(g_RT[9] - g_RT[10] + g_RT[43] - g_RT[44]);
+        Kc[231] = exp(g_RT[9] - g_RT[10] + g_RT[43] - g_RT[45]);
+        Kc[232] = exp(g_RT[43] - g_RT[43] + g_RT[44] - g_RT[45]);
+        Kc[233] = exp(g_RT[4] - g_RT[9] - g_RT[42] + g_RT[44]);
+        Kc[234] = exp(g_RT[4] - g_RT[9] - g_RT[42] + g_RT[45]);
+
+        /*reactions with the net stoichiometry of an earlier one */
+
+        Kc[0] *= refCinv;
+        Kc[1] *= refCinv;
+        Kc[2] *= refCinv;
+        Kc[3] *= refCinv;
+        Kc[4] *= refCinv;
+        Kc[5] *= refC;
+        Kc[6] *= refC;
+        Kc[7] *= refC;
+        Kc[8] *= refC;
+        Kc[9] *= refC;
+        Kc[10] *= refC;
+        Kc[11] *= refCinv;
+        Kc[12] *= refCinv;
+        Kc[13] *= refCinv;
+        Kc[14] *= refCinv;
+        Kc[15] *= refCinv;
+        Kc[16] *= refC;
+        Kc[17] *= refCinv;
+        Kc[18] *= refC;
+        Kc[19] *= refCinv;
+        Kc[20] *= refC;
+        Kc[21] *= refCinv;
+        Kc[22] *= refCinv;
+        Kc[23] *= refCinv;
+        Kc[24] *= refCinv;
+        Kc[25] *= refCinv;
+        Kc[26] *= refC;
+        Kc[28] *= refC;
+        Kc[29] *= refC;
+        Kc[30] *= refC;
+        Kc[31] *= refC;
+        Kc[33] *= refC;
+        Kc[34] *= refC;
+        Kc[35] *= refC;
+        Kc[80] *= refC;
+        Kc[85] *= refC;
+        Kc[88] *= refC;
+        Kc[89] *= refC;
+        Kc[115] *= refC;
+        Kc[130] *= refC;
+        Kc[131] *= refC;
+        Kc[132] *= refC;
+        Kc[133] *= refC;
+        Kc[151] *= refC;
+        Kc[156] *= refC;
+        Kc[157] *= refC;
+        Kc[158] *= refC;
+        Kc[160] *= refC;
+        Kc[161] *= refC;
+        Kc[188] *= refCinv;
+        Kc[199] *= refC;
+        Kc[212] *= refC;
+        Kc[213] *= refC;
+        Kc[216] *= refC;
+        Kc[219] *= refC;
+    }
 
     return;
 }
@@ -14549,6 +15180,13 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         mixture += sc[i];
     }
 
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[2][0] - 1)*sc[7] + (TB[2][1] - 1)*sc[8] + (TB[2][2] - 1)*sc[15] + (TB[2][3] - 1)*sc[11] + (TB[2][4] - 1)*sc[12] + (TB[2][5] - 1)*sc[22] + (TB[2][6] - 1)*sc[1];
+    double alpha_eff1 = mixture + (TB[3][0] - 1)*sc[7] + (TB[3][1] - 1)*sc[8] + (TB[3][2] - 1)*sc[15] + (TB[3][3] - 1)*sc[11] + (TB[3][4] - 1)*sc[12] + (TB[3][5] - 1)*sc[1];
+    double alpha_eff2 = mixture + (TB[8][0] - 1)*sc[7] + (TB[8][1] - 1)*sc[8] + (TB[8][2] - 1)*sc[11] + (TB[8][3] - 1)*sc[12] + (TB[8][4] - 1)*sc[15] + (TB[8][5] - 1)*sc[1];
+    double alpha_eff3 = mixture + (TB[14][0] - 1)*sc[1] + (TB[14][1] - 1)*sc[7] + (TB[14][2] - 1)*sc[8] + (TB[14][3] - 1)*sc[11] + (TB[14][4] - 1)*sc[12] + (TB[14][5] - 1)*sc[15] + (TB[14][6] - 1)*sc[22];
+    double alpha_eff4 = mixture + (TB[24][0] - 1)*sc[7] + (TB[24][1] - 1)*sc[8] + (TB[24][2] - 1)*sc[1] + (TB[24][3] - 1)*sc[2] + (TB[24][4] - 1)*sc[11] + (TB[24][5] - 1)*sc[12];
+
     double Corr[235];
     for (int i = 0; i < 235; ++i) {
         Corr[i] = 1.0;
@@ -14559,24 +15197,24 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         double alpha[20];
         alpha[0] = mixture + (TB[0][0] - 1)*sc[1] + (TB[0][1] - 1)*sc[2] + (TB[0][2] - 1)*sc[4] + (TB[0][3] - 1)*sc[8] + (TB[0][4] - 1)*sc[7] + (TB[0][5] - 1)*sc[11] + (TB[0][6] - 1)*sc[12] + (TB[0][7] - 1)*sc[22];
         alpha[1] = mixture + (TB[1][0] - 1)*sc[1] + (TB[1][1] - 1)*sc[2] + (TB[1][2] - 1)*sc[7] + (TB[1][3] - 1)*sc[8] + (TB[1][4] - 1)*sc[11] + (TB[1][5] - 1)*sc[12] + (TB[1][6] - 1)*sc[15] + (TB[1][7] - 1)*sc[22];
-        alpha[2] = mixture + (TB[2][0] - 1)*sc[7] + (TB[2][1] - 1)*sc[8] + (TB[2][2] - 1)*sc[15] + (TB[2][3] - 1)*sc[11] + (TB[2][4] - 1)*sc[12] + (TB[2][5] - 1)*sc[22] + (TB[2][6] - 1)*sc[1];
-        alpha[3] = mixture + (TB[3][0] - 1)*sc[7] + (TB[3][1] - 1)*sc[8] + (TB[3][2] - 1)*sc[15] + (TB[3][3] - 1)*sc[11] + (TB[3][4] - 1)*sc[12] + (TB[3][5] - 1)*sc[1];
-        alpha[4] = mixture + (TB[4][0] - 1)*sc[7] + (TB[4][1] - 1)*sc[8] + (TB[4][2] - 1)*sc[15] + (TB[4][3] - 1)*sc[11] + (TB[4][4] - 1)*sc[12] + (TB[4][5] - 1)*sc[22] + (TB[4][6] - 1)*sc[1];
-        alpha[5] = mixture + (TB[5][0] - 1)*sc[7] + (TB[5][1] - 1)*sc[8] + (TB[5][2] - 1)*sc[15] + (TB[5][3] - 1)*sc[11] + (TB[5][4] - 1)*sc[12] + (TB[5][5] - 1)*sc[22] + (TB[5][6] - 1)*sc[1];
-        alpha[6] = mixture + (TB[6][0] - 1)*sc[7] + (TB[6][1] - 1)*sc[8] + (TB[6][2] - 1)*sc[15] + (TB[6][3] - 1)*sc[11] + (TB[6][4] - 1)*sc[12] + (TB[6][5] - 1)*sc[1];
-        alpha[7] = mixture + (TB[7][0] - 1)*sc[7] + (TB[7][1] - 1)*sc[8] + (TB[7][2] - 1)*sc[15] + (TB[7][3] - 1)*sc[11] + (TB[7][4] - 1)*sc[12] + (TB[7][5] - 1)*sc[1];
-        alpha[8] = mixture + (TB[8][0] - 1)*sc[7] + (TB[8][1] - 1)*sc[8] + (TB[8][2] - 1)*sc[11] + (TB[8][3] - 1)*sc[12] + (TB[8][4] - 1)*sc[15] + (TB[8][5] - 1)*sc[1];
-        alpha[9] = mixture + (TB[9][0] - 1)*sc[7] + (TB[9][1] - 1)*sc[8] + (TB[9][2] - 1)*sc[11] + (TB[9][3] - 1)*sc[12] + (TB[9][4] - 1)*sc[15] + (TB[9][5] - 1)*sc[1];
-        alpha[10] = mixture + (TB[10][0] - 1)*sc[7] + (TB[10][1] - 1)*sc[8] + (TB[10][2] - 1)*sc[11] + (TB[10][3] - 1)*sc[12] + (TB[10][4] - 1)*sc[15] + (TB[10][5] - 1)*sc[1];
+        alpha[2] = alpha_eff0;
+        alpha[3] = alpha_eff1;
+        alpha[4] = (memcmp(TB[4], TB[2], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[4][0] - 1)*sc[7] + (TB[4][1] - 1)*sc[8] + (TB[4][2] - 1)*sc[15] + (TB[4][3] - 1)*sc[11] + (TB[4][4] - 1)*sc[12] + (TB[4][5] - 1)*sc[22] + (TB[4][6] - 1)*sc[1]);
+        alpha[5] = (memcmp(TB[5], TB[2], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[5][0] - 1)*sc[7] + (TB[5][1] - 1)*sc[8] + (TB[5][2] - 1)*sc[15] + (TB[5][3] - 1)*sc[11] + (TB[5][4] - 1)*sc[12] + (TB[5][5] - 1)*sc[22] + (TB[5][6] - 1)*sc[1]);
+        alpha[6] = (memcmp(TB[6], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[6][0] - 1)*sc[7] + (TB[6][1] - 1)*sc[8] + (TB[6][2] - 1)*sc[15] + (TB[6][3] - 1)*sc[11] + (TB[6][4] - 1)*sc[12] + (TB[6][5] - 1)*sc[1]);
+        alpha[7] = (memcmp(TB[7], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[7][0] - 1)*sc[7] + (TB[7][1] - 1)*sc[8] + (TB[7][2] - 1)*sc[15] + (TB[7][3] - 1)*sc[11] + (TB[7][4] - 1)*sc[12] + (TB[7][5] - 1)*sc[1]);
+        alpha[8] = alpha_eff2;
+        alpha[9] = (memcmp(TB[9], TB[8], 6*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[9][0] - 1)*sc[7] + (TB[9][1] - 1)*sc[8] + (TB[9][2] - 1)*sc[11] + (TB[9][3] - 1)*sc[12] + (TB[9][4] - 1)*sc[15] + (TB[9][5] - 1)*sc[1]);
+        alpha[10] = (memcmp(TB[10], TB[8], 6*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[10][0] - 1)*sc[7] + (TB[10][1] - 1)*sc[8] + (TB[10][2] - 1)*sc[11] + (TB[10][3] - 1)*sc[12] + (TB[10][4] - 1)*sc[15] + (TB[10][5] - 1)*sc[1]);
         alpha[11] = mixture;
         alpha[12] = alpha[11];
         alpha[13] = alpha[11];
-        alpha[14] = mixture + (TB[14][0] - 1)*sc[1] + (TB[14][1] - 1)*sc[7] + (TB[14][2] - 1)*sc[8] + (TB[14][3] - 1)*sc[11] + (TB[14][4] - 1)*sc[12] + (TB[14][5] - 1)*sc[15] + (TB[14][6] - 1)*sc[22];
-        alpha[15] = mixture + (TB[15][0] - 1)*sc[1] + (TB[15][1] - 1)*sc[7] + (TB[15][2] - 1)*sc[8] + (TB[15][3] - 1)*sc[11] + (TB[15][4] - 1)*sc[12] + (TB[15][5] - 1)*sc[15] + (TB[15][6] - 1)*sc[22];
+        alpha[14] = alpha_eff3;
+        alpha[15] = (memcmp(TB[15], TB[14], 7*sizeof(double)) == 0 ? alpha_eff3 : mixture + (TB[15][0] - 1)*sc[1] + (TB[15][1] - 1)*sc[7] + (TB[15][2] - 1)*sc[8] + (TB[15][3] - 1)*sc[11] + (TB[15][4] - 1)*sc[12] + (TB[15][5] - 1)*sc[15] + (TB[15][6] - 1)*sc[22]);
         alpha[16] = alpha[11];
-        alpha[17] = mixture + (TB[17][0] - 1)*sc[1] + (TB[17][1] - 1)*sc[7] + (TB[17][2] - 1)*sc[8] + (TB[17][3] - 1)*sc[11] + (TB[17][4] - 1)*sc[12] + (TB[17][5] - 1)*sc[15] + (TB[17][6] - 1)*sc[22];
+        alpha[17] = (memcmp(TB[17], TB[14], 7*sizeof(double)) == 0 ? alpha_eff3 : mixture + (TB[17][0] - 1)*sc[1] + (TB[17][1] - 1)*sc[7] + (TB[17][2] - 1)*sc[8] + (TB[17][3] - 1)*sc[11] + (TB[17][4] - 1)*sc[12] + (TB[17][5] - 1)*sc[15] + (TB[17][6] - 1)*sc[22]);
         alpha[18] = alpha[11];
-        alpha[19] = mixture + (TB[19][0] - 1)*sc[1] + (TB[19][1] - 1)*sc[7] + (TB[19][2] - 1)*sc[8] + (TB[19][3] - 1)*sc[11] + (TB[19][4] - 1)*sc[12] + (TB[19][5] - 1)*sc[15] + (TB[19][6] - 1)*sc[22];
+        alpha[19] = (memcmp(TB[19], TB[14], 7*sizeof(double)) == 0 ? alpha_eff3 : mixture + (TB[19][0] - 1)*sc[1] + (TB[19][1] - 1)*sc[7] + (TB[19][2] - 1)*sc[8] + (TB[19][3] - 1)*sc[11] + (TB[19][4] - 1)*sc[12] + (TB[19][5] - 1)*sc[15] + (TB[19][6] - 1)*sc[22]);
 #ifdef __INTEL_COMPILER
          #pragma simd
 #endif
@@ -14601,7 +15239,7 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
     /* Lindemann */
     {
         double alpha;
-        alpha = mixture + (TB[20][0] - 1)*sc[7] + (TB[20][1] - 1)*sc[8] + (TB[20][2] - 1)*sc[11] + (TB[20][3] - 1)*sc[12] + (TB[20][4] - 1)*sc[15] + (TB[20][5] - 1)*sc[1];
+        alpha = (memcmp(TB[20], TB[8], 6*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[20][0] - 1)*sc[7] + (TB[20][1] - 1)*sc[8] + (TB[20][2] - 1)*sc[11] + (TB[20][3] - 1)*sc[12] + (TB[20][4] - 1)*sc[15] + (TB[20][5] - 1)*sc[1]);
         double redP = alpha / k_f_save[20] * phase_units[20] * low_A[20] * exp(low_beta[20] * tc[0] - activation_units[20] * low_Ea[20] * invT);
         Corr[20] = redP / (1. + redP);
     }
@@ -14615,29 +15253,29 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         Corr[22] = alpha;
         alpha = mixture + (TB[23][0] - 1)*sc[7] + (TB[23][1] - 1)*sc[8] + (TB[23][2] - 1)*sc[11] + (TB[23][3] - 1)*sc[12] + (TB[23][4] - 1)*sc[1] + (TB[23][5] - 1)*sc[2];
         Corr[23] = alpha;
-        alpha = mixture + (TB[24][0] - 1)*sc[7] + (TB[24][1] - 1)*sc[8] + (TB[24][2] - 1)*sc[1] + (TB[24][3] - 1)*sc[2] + (TB[24][4] - 1)*sc[11] + (TB[24][5] - 1)*sc[12];
+        alpha = alpha_eff4;
         Corr[24] = alpha;
-        alpha = mixture + (TB[25][0] - 1)*sc[7] + (TB[25][1] - 1)*sc[8] + (TB[25][2] - 1)*sc[1] + (TB[25][3] - 1)*sc[2] + (TB[25][4] - 1)*sc[11] + (TB[25][5] - 1)*sc[12];
+        alpha = (memcmp(TB[25], TB[24], 6*sizeof(double)) == 0 ? alpha_eff4 : mixture + (TB[25][0] - 1)*sc[7] + (TB[25][1] - 1)*sc[8] + (TB[25][2] - 1)*sc[1] + (TB[25][3] - 1)*sc[2] + (TB[25][4] - 1)*sc[11] + (TB[25][5] - 1)*sc[12]);
         Corr[25] = alpha;
         alpha = mixture + (TB[26][0] - 1)*sc[7] + (TB[26][1] - 1)*sc[8] + (TB[26][2] - 1)*sc[11] + (TB[26][3] - 1)*sc[12];
         Corr[26] = alpha;
         alpha = mixture + (TB[27][0] - 1)*sc[7] + (TB[27][1] - 1)*sc[8] + (TB[27][2] - 1)*sc[11] + (TB[27][3] - 1)*sc[12];
         Corr[27] = alpha;
-        alpha = mixture + (TB[28][0] - 1)*sc[7] + (TB[28][1] - 1)*sc[8] + (TB[28][2] - 1)*sc[15] + (TB[28][3] - 1)*sc[11] + (TB[28][4] - 1)*sc[12] + (TB[28][5] - 1)*sc[1];
+        alpha = (memcmp(TB[28], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[28][0] - 1)*sc[7] + (TB[28][1] - 1)*sc[8] + (TB[28][2] - 1)*sc[15] + (TB[28][3] - 1)*sc[11] + (TB[28][4] - 1)*sc[12] + (TB[28][5] - 1)*sc[1]);
         Corr[28] = alpha;
-        alpha = mixture + (TB[29][0] - 1)*sc[7] + (TB[29][1] - 1)*sc[8] + (TB[29][2] - 1)*sc[15] + (TB[29][3] - 1)*sc[11] + (TB[29][4] - 1)*sc[12] + (TB[29][5] - 1)*sc[1];
+        alpha = (memcmp(TB[29], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[29][0] - 1)*sc[7] + (TB[29][1] - 1)*sc[8] + (TB[29][2] - 1)*sc[15] + (TB[29][3] - 1)*sc[11] + (TB[29][4] - 1)*sc[12] + (TB[29][5] - 1)*sc[1]);
         Corr[29] = alpha;
-        alpha = mixture + (TB[30][0] - 1)*sc[7] + (TB[30][1] - 1)*sc[8] + (TB[30][2] - 1)*sc[15] + (TB[30][3] - 1)*sc[11] + (TB[30][4] - 1)*sc[12] + (TB[30][5] - 1)*sc[1];
+        alpha = (memcmp(TB[30], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[30][0] - 1)*sc[7] + (TB[30][1] - 1)*sc[8] + (TB[30][2] - 1)*sc[15] + (TB[30][3] - 1)*sc[11] + (TB[30][4] - 1)*sc[12] + (TB[30][5] - 1)*sc[1]);
         Corr[30] = alpha;
-        alpha = mixture + (TB[31][0] - 1)*sc[7] + (TB[31][1] - 1)*sc[8] + (TB[31][2] - 1)*sc[11] + (TB[31][3] - 1)*sc[12] + (TB[31][4] - 1)*sc[15] + (TB[31][5] - 1)*sc[1];
+        alpha = (memcmp(TB[31], TB[8], 6*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[31][0] - 1)*sc[7] + (TB[31][1] - 1)*sc[8] + (TB[31][2] - 1)*sc[11] + (TB[31][3] - 1)*sc[12] + (TB[31][4] - 1)*sc[15] + (TB[31][5] - 1)*sc[1]);
         Corr[31] = alpha;
-        alpha = mixture + (TB[32][0] - 1)*sc[7] + (TB[32][1] - 1)*sc[8] + (TB[32][2] - 1)*sc[11] + (TB[32][3] - 1)*sc[12] + (TB[32][4] - 1)*sc[15] + (TB[32][5] - 1)*sc[1];
+        alpha = (memcmp(TB[32], TB[8], 6*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[32][0] - 1)*sc[7] + (TB[32][1] - 1)*sc[8] + (TB[32][2] - 1)*sc[11] + (TB[32][3] - 1)*sc[12] + (TB[32][4] - 1)*sc[15] + (TB[32][5] - 1)*sc[1]);
         Corr[32] = alpha;
-        alpha = mixture + (TB[33][0] - 1)*sc[7] + (TB[33][1] - 1)*sc[8] + (TB[33][2] - 1)*sc[11] + (TB[33][3] - 1)*sc[12] + (TB[33][4] - 1)*sc[15] + (TB[33][5] - 1)*sc[1];
+        alpha = (memcmp(TB[33], TB[8], 6*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[33][0] - 1)*sc[7] + (TB[33][1] - 1)*sc[8] + (TB[33][2] - 1)*sc[11] + (TB[33][3] - 1)*sc[12] + (TB[33][4] - 1)*sc[15] + (TB[33][5] - 1)*sc[1]);
         Corr[33] = alpha;
-        alpha = mixture + (TB[34][0] - 1)*sc[7] + (TB[34][1] - 1)*sc[8] + (TB[34][2] - 1)*sc[11] + (TB[34][3] - 1)*sc[12] + (TB[34][4] - 1)*sc[15] + (TB[34][5] - 1)*sc[1];
+        alpha = (memcmp(TB[34], TB[8], 6*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[34][0] - 1)*sc[7] + (TB[34][1] - 1)*sc[8] + (TB[34][2] - 1)*sc[11] + (TB[34][3] - 1)*sc[12] + (TB[34][4] - 1)*sc[15] + (TB[34][5] - 1)*sc[1]);
         Corr[34] = alpha;
-        alpha = mixture + (TB[35][0] - 1)*sc[7] + (TB[35][1] - 1)*sc[8] + (TB[35][2] - 1)*sc[11] + (TB[35][3] - 1)*sc[12] + (TB[35][4] - 1)*sc[15] + (TB[35][5] - 1)*sc[1];
+        alpha = (memcmp(TB[35], TB[8], 6*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[35][0] - 1)*sc[7] + (TB[35][1] - 1)*sc[8] + (TB[35][2] - 1)*sc[11] + (TB[35][3] - 1)*sc[12] + (TB[35][4] - 1)*sc[15] + (TB[35][5] - 1)*sc[1]);
         Corr[35] = alpha;
     }
 
@@ -18917,17 +19555,24 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         mixture += sc[k];
     }
 
-    /*compute the Gibbs free energy */
-    double g_RT[46];
-    gibbs(g_RT, tc);
-
     /*compute the species enthalpy */
     double h_RT[46];
     speciesEnthalpy(h_RT, tc);
 
+    /*compute the rate and equilibrium constants */
+    double k_f_s[235], Kc_s[235];
+    comp_k_f(tc, invT, k_f_s);
+    comp_Kc(tc, invT, Kc_s);
+
+    /*at constant volume, the part of dwdot/d[X] common to all species */
+    double Jmix[46];
+    for (int k=0; k<46; k++) {
+        Jmix[k] = 0.0;
+    }
+
     double phi_f, k_f, k_r, phi_r, Kc, q, q_nocor, Corr, alpha;
     double dlnkfdT, dlnk0dT, dlnKcdT, dkrdT, dqdT;
-    double dqdci, dcdc_fac, dqdc[46];
+    double dqdci, dcdc_fac;
     double Pr, fPr, F, k_0, logPr;
     double logFcent, troe_c, troe_n, troePr_den, troePr, troe;
     double Fcent1, Fcent2, Fcent3, Fcent;
@@ -18935,6 +19580,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     double dlogPrdT, dlogfPrdT, dlogFdT, dlogFcentdT, dlogFdlogPr, dlnCorrdT;
     const double ln10 = log(10.0);
     const double log10e = 1.0/log(10.0);
+    double x_0, x_0_s[1], e_0_s[1];
+    double logFcent_s[2], dlogFcentdT_s[2];
+
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[2][0] - 1)*sc[7] + (TB[2][1] - 1)*sc[8] + (TB[2][2] - 1)*sc[15] + (TB[2][3] - 1)*sc[11] + (TB[2][4] - 1)*sc[12] + (TB[2][5] - 1)*sc[22] + (TB[2][6] - 1)*sc[1];
+    double alpha_eff1 = mixture + (TB[3][0] - 1)*sc[7] + (TB[3][1] - 1)*sc[8] + (TB[3][2] - 1)*sc[15] + (TB[3][3] - 1)*sc[11] + (TB[3][4] - 1)*sc[12] + (TB[3][5] - 1)*sc[1];
+    double alpha_eff2 = mixture + (TB[8][0] - 1)*sc[7] + (TB[8][1] - 1)*sc[8] + (TB[8][2] - 1)*sc[11] + (TB[8][3] - 1)*sc[12] + (TB[8][4] - 1)*sc[15] + (TB[8][5] - 1)*sc[1];
+    double alpha_eff3 = mixture + (TB[14][0] - 1)*sc[1] + (TB[14][1] - 1)*sc[7] + (TB[14][2] - 1)*sc[8] + (TB[14][3] - 1)*sc[11] + (TB[14][4] - 1)*sc[12] + (TB[14][5] - 1)*sc[15] + (TB[14][6] - 1)*sc[22];
+    double alpha_eff4 = mixture + (TB[24][0] - 1)*sc[7] + (TB[24][1] - 1)*sc[8] + (TB[24][2] - 1)*sc[1] + (TB[24][3] - 1)*sc[2] + (TB[24][4] - 1)*sc[11] + (TB[24][5] - 1)*sc[12];
+
     /*reaction 1: H + O2 (+M) <=> HO2 (+M) */
     /*a pressure-fall-off reaction */
     /* also 3-body */
@@ -18942,8 +19597,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[0][0] - 1)*sc[1] + (TB[0][1] - 1)*sc[2] + (TB[0][2] - 1)*sc[4] + (TB[0][3] - 1)*sc[8] + (TB[0][4] - 1)*sc[7] + (TB[0][5] - 1)*sc[11] + (TB[0][6] - 1)*sc[12] + (TB[0][7] - 1)*sc[22];
     /* forward */
     phi_f = sc[3]*sc[4];
-    k_f = prefactor_units[0] * fwd_A[0]
-                * exp(fwd_beta[0] * tc[0] - activation_units[0] * fwd_Ea[0] * invT);
+    k_f = k_f_s[0];
     dlnkfdT = fwd_beta[0] * invT + activation_units[0] * fwd_Ea[0] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[0] * exp(low_beta[0] * tc[0] - activation_units[0] * low_Ea[0] * invT);
@@ -18959,16 +19613,18 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[0] == 4 ? exp(-troe_Tss[0] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
+      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
+      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
+    logFcent_s[0] = logFcent;
+    dlogFcentdT_s[0] = dlogFcentdT;
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
-      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
-      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -18976,7 +19632,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[9];
-    Kc = refCinv * exp(g_RT[3] + g_RT[4] - g_RT[9]);
+    Kc = Kc_s[0];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[4]) + (h_RT[9]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18994,111 +19650,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[0][0] - 1)*dcdc_fac;
-        J[50] -= dqdci;               /* dwdot[H]/d[AR] */
-        J[51] -= dqdci;               /* dwdot[O2]/d[AR] */
-        J[56] += dqdci;               /* dwdot[HO2]/d[AR] */
-        /* d()/d[HE] */
-        dqdci = (TB[0][1] - 1)*dcdc_fac;
-        J[97] -= dqdci;               /* dwdot[H]/d[HE] */
-        J[98] -= dqdci;               /* dwdot[O2]/d[HE] */
-        J[103] += dqdci;              /* dwdot[HO2]/d[HE] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[4];
-        J[144] -= dqdci;              /* dwdot[H]/d[H] */
-        J[145] -= dqdci;              /* dwdot[O2]/d[H] */
-        J[150] += dqdci;              /* dwdot[HO2]/d[H] */
-        /* d()/d[O2] */
-        dqdci = (TB[0][2] - 1)*dcdc_fac + k_f*sc[3];
-        J[191] -= dqdci;              /* dwdot[H]/d[O2] */
-        J[192] -= dqdci;              /* dwdot[O2]/d[O2] */
-        J[197] += dqdci;              /* dwdot[HO2]/d[O2] */
-        /* d()/d[H2] */
-        dqdci = (TB[0][4] - 1)*dcdc_fac;
-        J[332] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[333] -= dqdci;              /* dwdot[O2]/d[H2] */
-        J[338] += dqdci;              /* dwdot[HO2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[0][3] - 1)*dcdc_fac;
-        J[379] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[380] -= dqdci;              /* dwdot[O2]/d[H2O] */
-        J[385] += dqdci;              /* dwdot[HO2]/d[H2O] */
-        /* d()/d[HO2] */
-        dqdci =  - k_r;
-        J[426] -= dqdci;              /* dwdot[H]/d[HO2] */
-        J[427] -= dqdci;              /* dwdot[O2]/d[HO2] */
-        J[432] += dqdci;              /* dwdot[HO2]/d[HO2] */
-        /* d()/d[CO] */
-        dqdci = (TB[0][5] - 1)*dcdc_fac;
-        J[520] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[521] -= dqdci;              /* dwdot[O2]/d[CO] */
-        J[526] += dqdci;              /* dwdot[HO2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[0][6] - 1)*dcdc_fac;
-        J[567] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[568] -= dqdci;              /* dwdot[O2]/d[CO2] */
-        J[573] += dqdci;              /* dwdot[HO2]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[0][7] - 1)*dcdc_fac;
-        J[1037] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1038] -= dqdci;             /* dwdot[O2]/d[C2H6] */
-        J[1043] += dqdci;             /* dwdot[HO2]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[0][0]*dcdc_fac;
-        dqdc[2] = TB[0][1]*dcdc_fac;
-        dqdc[3] = dcdc_fac + k_f*sc[4];
-        dqdc[4] = TB[0][2]*dcdc_fac + k_f*sc[3];
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[0][4]*dcdc_fac;
-        dqdc[8] = TB[0][3]*dcdc_fac;
-        dqdc[9] = dcdc_fac - k_r;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[0][5]*dcdc_fac;
-        dqdc[12] = TB[0][6]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = TB[0][7]*dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+3] -= dqdc[k];
-            J[47*k+4] -= dqdc[k];
-            J[47*k+9] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] -= dcdc_fac;
+    Jmix[4] -= dcdc_fac;
+    Jmix[9] += dcdc_fac;
+    /* d()/d[AR] */
+    dqdci = (TB[0][0] - 1)*dcdc_fac;
+    J[50] -= dqdci;               /* dwdot[H]/d[AR] */
+    J[51] -= dqdci;               /* dwdot[O2]/d[AR] */
+    J[56] += dqdci;               /* dwdot[HO2]/d[AR] */
+    /* d()/d[HE] */
+    dqdci = (TB[0][1] - 1)*dcdc_fac;
+    J[97] -= dqdci;               /* dwdot[H]/d[HE] */
+    J[98] -= dqdci;               /* dwdot[O2]/d[HE] */
+    J[103] += dqdci;              /* dwdot[HO2]/d[HE] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[4];
+    J[144] -= dqdci;              /* dwdot[H]/d[H] */
+    J[145] -= dqdci;              /* dwdot[O2]/d[H] */
+    J[150] += dqdci;              /* dwdot[HO2]/d[H] */
+    /* d()/d[O2] */
+    dqdci = (TB[0][2] - 1)*dcdc_fac + k_f*sc[3];
+    J[191] -= dqdci;              /* dwdot[H]/d[O2] */
+    J[192] -= dqdci;              /* dwdot[O2]/d[O2] */
+    J[197] += dqdci;              /* dwdot[HO2]/d[O2] */
+    /* d()/d[H2] */
+    dqdci = (TB[0][4] - 1)*dcdc_fac;
+    J[332] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[333] -= dqdci;              /* dwdot[O2]/d[H2] */
+    J[338] += dqdci;              /* dwdot[HO2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[0][3] - 1)*dcdc_fac;
+    J[379] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[380] -= dqdci;              /* dwdot[O2]/d[H2O] */
+    J[385] += dqdci;              /* dwdot[HO2]/d[H2O] */
+    /* d()/d[HO2] */
+    dqdci =  - k_r;
+    J[426] -= dqdci;              /* dwdot[H]/d[HO2] */
+    J[427] -= dqdci;              /* dwdot[O2]/d[HO2] */
+    J[432] += dqdci;              /* dwdot[HO2]/d[HO2] */
+    /* d()/d[CO] */
+    dqdci = (TB[0][5] - 1)*dcdc_fac;
+    J[520] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[521] -= dqdci;              /* dwdot[O2]/d[CO] */
+    J[526] += dqdci;              /* dwdot[HO2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[0][6] - 1)*dcdc_fac;
+    J[567] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[568] -= dqdci;              /* dwdot[O2]/d[CO2] */
+    J[573] += dqdci;              /* dwdot[HO2]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[0][7] - 1)*dcdc_fac;
+    J[1037] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1038] -= dqdci;             /* dwdot[O2]/d[C2H6] */
+    J[1043] += dqdci;             /* dwdot[HO2]/d[C2H6] */
     J[2165] -= dqdT; /* dwdot[H]/dT */
     J[2166] -= dqdT; /* dwdot[O2]/dT */
     J[2171] += dqdT; /* dwdot[HO2]/dT */
@@ -19110,8 +19715,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[1][0] - 1)*sc[1] + (TB[1][1] - 1)*sc[2] + (TB[1][2] - 1)*sc[7] + (TB[1][3] - 1)*sc[8] + (TB[1][4] - 1)*sc[11] + (TB[1][5] - 1)*sc[12] + (TB[1][6] - 1)*sc[15] + (TB[1][7] - 1)*sc[22];
     /* forward */
     phi_f = sc[5]*sc[5];
-    k_f = prefactor_units[1] * fwd_A[1]
-                * exp(fwd_beta[1] * tc[0] - activation_units[1] * fwd_Ea[1] * invT);
+    k_f = k_f_s[1];
     dlnkfdT = fwd_beta[1] * invT + activation_units[1] * fwd_Ea[1] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[1] * exp(low_beta[1] * tc[0] - activation_units[1] * low_Ea[1] * invT);
@@ -19127,16 +19731,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[1] == 4 ? exp(-troe_Tss[1] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
+      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
+      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
-      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
-      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -19144,7 +19748,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[10];
-    Kc = refCinv * exp(2*g_RT[5] - g_RT[10]);
+    Kc = Kc_s[1];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[5]) + (h_RT[10]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19161,100 +19765,49 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[1][0] - 1)*dcdc_fac;
-        J[52] += -2 * dqdci;          /* dwdot[OH]/d[AR] */
-        J[57] += dqdci;               /* dwdot[H2O2]/d[AR] */
-        /* d()/d[HE] */
-        dqdci = (TB[1][1] - 1)*dcdc_fac;
-        J[99] += -2 * dqdci;          /* dwdot[OH]/d[HE] */
-        J[104] += dqdci;              /* dwdot[H2O2]/d[HE] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*2*sc[5];
-        J[240] += -2 * dqdci;         /* dwdot[OH]/d[OH] */
-        J[245] += dqdci;              /* dwdot[H2O2]/d[OH] */
-        /* d()/d[H2] */
-        dqdci = (TB[1][2] - 1)*dcdc_fac;
-        J[334] += -2 * dqdci;         /* dwdot[OH]/d[H2] */
-        J[339] += dqdci;              /* dwdot[H2O2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[1][3] - 1)*dcdc_fac;
-        J[381] += -2 * dqdci;         /* dwdot[OH]/d[H2O] */
-        J[386] += dqdci;              /* dwdot[H2O2]/d[H2O] */
-        /* d()/d[H2O2] */
-        dqdci =  - k_r;
-        J[475] += -2 * dqdci;         /* dwdot[OH]/d[H2O2] */
-        J[480] += dqdci;              /* dwdot[H2O2]/d[H2O2] */
-        /* d()/d[CO] */
-        dqdci = (TB[1][4] - 1)*dcdc_fac;
-        J[522] += -2 * dqdci;         /* dwdot[OH]/d[CO] */
-        J[527] += dqdci;              /* dwdot[H2O2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[1][5] - 1)*dcdc_fac;
-        J[569] += -2 * dqdci;         /* dwdot[OH]/d[CO2] */
-        J[574] += dqdci;              /* dwdot[H2O2]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[1][6] - 1)*dcdc_fac;
-        J[710] += -2 * dqdci;         /* dwdot[OH]/d[CH4] */
-        J[715] += dqdci;              /* dwdot[H2O2]/d[CH4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[1][7] - 1)*dcdc_fac;
-        J[1039] += -2 * dqdci;        /* dwdot[OH]/d[C2H6] */
-        J[1044] += dqdci;             /* dwdot[H2O2]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[1][0]*dcdc_fac;
-        dqdc[2] = TB[1][1]*dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac + k_f*2*sc[5];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[1][2]*dcdc_fac;
-        dqdc[8] = TB[1][3]*dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac - k_r;
-        dqdc[11] = TB[1][4]*dcdc_fac;
-        dqdc[12] = TB[1][5]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[1][6]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = TB[1][7]*dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+5] += -2 * dqdc[k];
-            J[47*k+10] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[5] += -2 * dcdc_fac;
+    Jmix[10] += dcdc_fac;
+    /* d()/d[AR] */
+    dqdci = (TB[1][0] - 1)*dcdc_fac;
+    J[52] += -2 * dqdci;          /* dwdot[OH]/d[AR] */
+    J[57] += dqdci;               /* dwdot[H2O2]/d[AR] */
+    /* d()/d[HE] */
+    dqdci = (TB[1][1] - 1)*dcdc_fac;
+    J[99] += -2 * dqdci;          /* dwdot[OH]/d[HE] */
+    J[104] += dqdci;              /* dwdot[H2O2]/d[HE] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*2*sc[5];
+    J[240] += -2 * dqdci;         /* dwdot[OH]/d[OH] */
+    J[245] += dqdci;              /* dwdot[H2O2]/d[OH] */
+    /* d()/d[H2] */
+    dqdci = (TB[1][2] - 1)*dcdc_fac;
+    J[334] += -2 * dqdci;         /* dwdot[OH]/d[H2] */
+    J[339] += dqdci;              /* dwdot[H2O2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[1][3] - 1)*dcdc_fac;
+    J[381] += -2 * dqdci;         /* dwdot[OH]/d[H2O] */
+    J[386] += dqdci;              /* dwdot[H2O2]/d[H2O] */
+    /* d()/d[H2O2] */
+    dqdci =  - k_r;
+    J[475] += -2 * dqdci;         /* dwdot[OH]/d[H2O2] */
+    J[480] += dqdci;              /* dwdot[H2O2]/d[H2O2] */
+    /* d()/d[CO] */
+    dqdci = (TB[1][4] - 1)*dcdc_fac;
+    J[522] += -2 * dqdci;         /* dwdot[OH]/d[CO] */
+    J[527] += dqdci;              /* dwdot[H2O2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[1][5] - 1)*dcdc_fac;
+    J[569] += -2 * dqdci;         /* dwdot[OH]/d[CO2] */
+    J[574] += dqdci;              /* dwdot[H2O2]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[1][6] - 1)*dcdc_fac;
+    J[710] += -2 * dqdci;         /* dwdot[OH]/d[CH4] */
+    J[715] += dqdci;              /* dwdot[H2O2]/d[CH4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[1][7] - 1)*dcdc_fac;
+    J[1039] += -2 * dqdci;        /* dwdot[OH]/d[C2H6] */
+    J[1044] += dqdci;             /* dwdot[H2O2]/d[C2H6] */
     J[2167] += -2 * dqdT; /* dwdot[OH]/dT */
     J[2172] += dqdT; /* dwdot[H2O2]/dT */
 
@@ -19262,11 +19815,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[2][0] - 1)*sc[7] + (TB[2][1] - 1)*sc[8] + (TB[2][2] - 1)*sc[15] + (TB[2][3] - 1)*sc[11] + (TB[2][4] - 1)*sc[12] + (TB[2][5] - 1)*sc[22] + (TB[2][6] - 1)*sc[1];
+    alpha = alpha_eff0;
     /* forward */
     phi_f = sc[3]*sc[13];
-    k_f = prefactor_units[2] * fwd_A[2]
-                * exp(fwd_beta[2] * tc[0] - activation_units[2] * fwd_Ea[2] * invT);
+    k_f = k_f_s[2];
     dlnkfdT = fwd_beta[2] * invT + activation_units[2] * fwd_Ea[2] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[2] * exp(low_beta[2] * tc[0] - activation_units[2] * low_Ea[2] * invT);
@@ -19282,16 +19834,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[2] == 4 ? exp(-troe_Tss[2] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[2]) > 1.e-100 ? -Fcent1/troe_Tsss[2] : 0.)
+      + (fabs(troe_Ts[2]) > 1.e-100 ? -Fcent2/troe_Ts[2] : 0.)
+      + (troe_len[2] == 4 ? Fcent3*troe_Tss[2]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[2]) > 1.e-100 ? -Fcent1/troe_Tsss[2] : 0.)
-      + (fabs(troe_Ts[2]) > 1.e-100 ? -Fcent2/troe_Ts[2] : 0.)
-      + (troe_len[2] == 4 ? Fcent3*troe_Tss[2]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -19299,7 +19851,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[14];
-    Kc = refCinv * exp(g_RT[3] + g_RT[13] - g_RT[14]);
+    Kc = Kc_s[2];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[13]) + (h_RT[14]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19317,111 +19869,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[2][6] - 1)*dcdc_fac;
-        J[50] -= dqdci;               /* dwdot[H]/d[AR] */
-        J[60] -= dqdci;               /* dwdot[HCO]/d[AR] */
-        J[61] += dqdci;               /* dwdot[CH2O]/d[AR] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[13];
-        J[144] -= dqdci;              /* dwdot[H]/d[H] */
-        J[154] -= dqdci;              /* dwdot[HCO]/d[H] */
-        J[155] += dqdci;              /* dwdot[CH2O]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[2][0] - 1)*dcdc_fac;
-        J[332] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[342] -= dqdci;              /* dwdot[HCO]/d[H2] */
-        J[343] += dqdci;              /* dwdot[CH2O]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[2][1] - 1)*dcdc_fac;
-        J[379] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[389] -= dqdci;              /* dwdot[HCO]/d[H2O] */
-        J[390] += dqdci;              /* dwdot[CH2O]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[2][3] - 1)*dcdc_fac;
-        J[520] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[530] -= dqdci;              /* dwdot[HCO]/d[CO] */
-        J[531] += dqdci;              /* dwdot[CH2O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[2][4] - 1)*dcdc_fac;
-        J[567] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[577] -= dqdci;              /* dwdot[HCO]/d[CO2] */
-        J[578] += dqdci;              /* dwdot[CH2O]/d[CO2] */
-        /* d()/d[HCO] */
-        dqdci =  + k_f*sc[3];
-        J[614] -= dqdci;              /* dwdot[H]/d[HCO] */
-        J[624] -= dqdci;              /* dwdot[HCO]/d[HCO] */
-        J[625] += dqdci;              /* dwdot[CH2O]/d[HCO] */
-        /* d()/d[CH2O] */
-        dqdci =  - k_r;
-        J[661] -= dqdci;              /* dwdot[H]/d[CH2O] */
-        J[671] -= dqdci;              /* dwdot[HCO]/d[CH2O] */
-        J[672] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[2][2] - 1)*dcdc_fac;
-        J[708] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[718] -= dqdci;              /* dwdot[HCO]/d[CH4] */
-        J[719] += dqdci;              /* dwdot[CH2O]/d[CH4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[2][5] - 1)*dcdc_fac;
-        J[1037] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1047] -= dqdci;             /* dwdot[HCO]/d[C2H6] */
-        J[1048] += dqdci;             /* dwdot[CH2O]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[2][6]*dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac + k_f*sc[13];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[2][0]*dcdc_fac;
-        dqdc[8] = TB[2][1]*dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[2][3]*dcdc_fac;
-        dqdc[12] = TB[2][4]*dcdc_fac;
-        dqdc[13] = dcdc_fac + k_f*sc[3];
-        dqdc[14] = dcdc_fac - k_r;
-        dqdc[15] = TB[2][2]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = TB[2][5]*dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+3] -= dqdc[k];
-            J[47*k+13] -= dqdc[k];
-            J[47*k+14] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] -= dcdc_fac;
+    Jmix[13] -= dcdc_fac;
+    Jmix[14] += dcdc_fac;
+    /* d()/d[AR] */
+    dqdci = (TB[2][6] - 1)*dcdc_fac;
+    J[50] -= dqdci;               /* dwdot[H]/d[AR] */
+    J[60] -= dqdci;               /* dwdot[HCO]/d[AR] */
+    J[61] += dqdci;               /* dwdot[CH2O]/d[AR] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[13];
+    J[144] -= dqdci;              /* dwdot[H]/d[H] */
+    J[154] -= dqdci;              /* dwdot[HCO]/d[H] */
+    J[155] += dqdci;              /* dwdot[CH2O]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[2][0] - 1)*dcdc_fac;
+    J[332] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[342] -= dqdci;              /* dwdot[HCO]/d[H2] */
+    J[343] += dqdci;              /* dwdot[CH2O]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[2][1] - 1)*dcdc_fac;
+    J[379] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[389] -= dqdci;              /* dwdot[HCO]/d[H2O] */
+    J[390] += dqdci;              /* dwdot[CH2O]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[2][3] - 1)*dcdc_fac;
+    J[520] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[530] -= dqdci;              /* dwdot[HCO]/d[CO] */
+    J[531] += dqdci;              /* dwdot[CH2O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[2][4] - 1)*dcdc_fac;
+    J[567] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[577] -= dqdci;              /* dwdot[HCO]/d[CO2] */
+    J[578] += dqdci;              /* dwdot[CH2O]/d[CO2] */
+    /* d()/d[HCO] */
+    dqdci =  + k_f*sc[3];
+    J[614] -= dqdci;              /* dwdot[H]/d[HCO] */
+    J[624] -= dqdci;              /* dwdot[HCO]/d[HCO] */
+    J[625] += dqdci;              /* dwdot[CH2O]/d[HCO] */
+    /* d()/d[CH2O] */
+    dqdci =  - k_r;
+    J[661] -= dqdci;              /* dwdot[H]/d[CH2O] */
+    J[671] -= dqdci;              /* dwdot[HCO]/d[CH2O] */
+    J[672] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[2][2] - 1)*dcdc_fac;
+    J[708] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[718] -= dqdci;              /* dwdot[HCO]/d[CH4] */
+    J[719] += dqdci;              /* dwdot[CH2O]/d[CH4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[2][5] - 1)*dcdc_fac;
+    J[1037] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1047] -= dqdci;             /* dwdot[HCO]/d[C2H6] */
+    J[1048] += dqdci;             /* dwdot[CH2O]/d[C2H6] */
     J[2165] -= dqdT; /* dwdot[H]/dT */
     J[2175] -= dqdT; /* dwdot[HCO]/dT */
     J[2176] += dqdT; /* dwdot[CH2O]/dT */
@@ -19430,11 +19931,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[3][0] - 1)*sc[7] + (TB[3][1] - 1)*sc[8] + (TB[3][2] - 1)*sc[15] + (TB[3][3] - 1)*sc[11] + (TB[3][4] - 1)*sc[12] + (TB[3][5] - 1)*sc[1];
+    alpha = alpha_eff1;
     /* forward */
     phi_f = sc[3]*sc[16];
-    k_f = prefactor_units[3] * fwd_A[3]
-                * exp(fwd_beta[3] * tc[0] - activation_units[3] * fwd_Ea[3] * invT);
+    k_f = k_f_s[3];
     dlnkfdT = fwd_beta[3] * invT + activation_units[3] * fwd_Ea[3] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[3] * exp(low_beta[3] * tc[0] - activation_units[3] * low_Ea[3] * invT);
@@ -19450,16 +19950,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[3] == 4 ? exp(-troe_Tss[3] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[3]) > 1.e-100 ? -Fcent1/troe_Tsss[3] : 0.)
+      + (fabs(troe_Ts[3]) > 1.e-100 ? -Fcent2/troe_Ts[3] : 0.)
+      + (troe_len[3] == 4 ? Fcent3*troe_Tss[3]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[3]) > 1.e-100 ? -Fcent1/troe_Tsss[3] : 0.)
-      + (fabs(troe_Ts[3]) > 1.e-100 ? -Fcent2/troe_Ts[3] : 0.)
-      + (troe_len[3] == 4 ? Fcent3*troe_Tss[3]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -19467,7 +19967,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[15];
-    Kc = refCinv * exp(g_RT[3] - g_RT[15] + g_RT[16]);
+    Kc = Kc_s[3];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[16]) + (h_RT[15]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19485,101 +19985,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[3][5] - 1)*dcdc_fac;
-        J[50] -= dqdci;               /* dwdot[H]/d[AR] */
-        J[62] += dqdci;               /* dwdot[CH4]/d[AR] */
-        J[63] -= dqdci;               /* dwdot[CH3]/d[AR] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[16];
-        J[144] -= dqdci;              /* dwdot[H]/d[H] */
-        J[156] += dqdci;              /* dwdot[CH4]/d[H] */
-        J[157] -= dqdci;              /* dwdot[CH3]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[3][0] - 1)*dcdc_fac;
-        J[332] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[344] += dqdci;              /* dwdot[CH4]/d[H2] */
-        J[345] -= dqdci;              /* dwdot[CH3]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[3][1] - 1)*dcdc_fac;
-        J[379] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[391] += dqdci;              /* dwdot[CH4]/d[H2O] */
-        J[392] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[3][3] - 1)*dcdc_fac;
-        J[520] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[532] += dqdci;              /* dwdot[CH4]/d[CO] */
-        J[533] -= dqdci;              /* dwdot[CH3]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[3][4] - 1)*dcdc_fac;
-        J[567] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[579] += dqdci;              /* dwdot[CH4]/d[CO2] */
-        J[580] -= dqdci;              /* dwdot[CH3]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[3][2] - 1)*dcdc_fac - k_r;
-        J[708] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[720] += dqdci;              /* dwdot[CH4]/d[CH4] */
-        J[721] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[3];
-        J[755] -= dqdci;              /* dwdot[H]/d[CH3] */
-        J[767] += dqdci;              /* dwdot[CH4]/d[CH3] */
-        J[768] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[3][5]*dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac + k_f*sc[16];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[3][0]*dcdc_fac;
-        dqdc[8] = TB[3][1]*dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[3][3]*dcdc_fac;
-        dqdc[12] = TB[3][4]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[3][2]*dcdc_fac - k_r;
-        dqdc[16] = dcdc_fac + k_f*sc[3];
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+3] -= dqdc[k];
-            J[47*k+15] += dqdc[k];
-            J[47*k+16] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] -= dcdc_fac;
+    Jmix[15] += dcdc_fac;
+    Jmix[16] -= dcdc_fac;
+    /* d()/d[AR] */
+    dqdci = (TB[3][5] - 1)*dcdc_fac;
+    J[50] -= dqdci;               /* dwdot[H]/d[AR] */
+    J[62] += dqdci;               /* dwdot[CH4]/d[AR] */
+    J[63] -= dqdci;               /* dwdot[CH3]/d[AR] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[16];
+    J[144] -= dqdci;              /* dwdot[H]/d[H] */
+    J[156] += dqdci;              /* dwdot[CH4]/d[H] */
+    J[157] -= dqdci;              /* dwdot[CH3]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[3][0] - 1)*dcdc_fac;
+    J[332] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[344] += dqdci;              /* dwdot[CH4]/d[H2] */
+    J[345] -= dqdci;              /* dwdot[CH3]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[3][1] - 1)*dcdc_fac;
+    J[379] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[391] += dqdci;              /* dwdot[CH4]/d[H2O] */
+    J[392] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[3][3] - 1)*dcdc_fac;
+    J[520] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[532] += dqdci;              /* dwdot[CH4]/d[CO] */
+    J[533] -= dqdci;              /* dwdot[CH3]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[3][4] - 1)*dcdc_fac;
+    J[567] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[579] += dqdci;              /* dwdot[CH4]/d[CO2] */
+    J[580] -= dqdci;              /* dwdot[CH3]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[3][2] - 1)*dcdc_fac - k_r;
+    J[708] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[720] += dqdci;              /* dwdot[CH4]/d[CH4] */
+    J[721] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[3];
+    J[755] -= dqdci;              /* dwdot[H]/d[CH3] */
+    J[767] += dqdci;              /* dwdot[CH4]/d[CH3] */
+    J[768] -= dqdci;              /* dwdot[CH3]/d[CH3] */
     J[2165] -= dqdT; /* dwdot[H]/dT */
     J[2177] += dqdT; /* dwdot[CH4]/dT */
     J[2178] -= dqdT; /* dwdot[CH3]/dT */
@@ -19588,11 +20037,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[4][0] - 1)*sc[7] + (TB[4][1] - 1)*sc[8] + (TB[4][2] - 1)*sc[15] + (TB[4][3] - 1)*sc[11] + (TB[4][4] - 1)*sc[12] + (TB[4][5] - 1)*sc[22] + (TB[4][6] - 1)*sc[1];
+    alpha = (memcmp(TB[4], TB[2], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[4][0] - 1)*sc[7] + (TB[4][1] - 1)*sc[8] + (TB[4][2] - 1)*sc[15] + (TB[4][3] - 1)*sc[11] + (TB[4][4] - 1)*sc[12] + (TB[4][5] - 1)*sc[22] + (TB[4][6] - 1)*sc[1]);
     /* forward */
     phi_f = sc[16]*sc[16];
-    k_f = prefactor_units[4] * fwd_A[4]
-                * exp(fwd_beta[4] * tc[0] - activation_units[4] * fwd_Ea[4] * invT);
+    k_f = k_f_s[4];
     dlnkfdT = fwd_beta[4] * invT + activation_units[4] * fwd_Ea[4] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[4] * exp(low_beta[4] * tc[0] - activation_units[4] * low_Ea[4] * invT);
@@ -19608,16 +20056,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[4] == 4 ? exp(-troe_Tss[4] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[4]) > 1.e-100 ? -Fcent1/troe_Tsss[4] : 0.)
+      + (fabs(troe_Ts[4]) > 1.e-100 ? -Fcent2/troe_Ts[4] : 0.)
+      + (troe_len[4] == 4 ? Fcent3*troe_Tss[4]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[4]) > 1.e-100 ? -Fcent1/troe_Tsss[4] : 0.)
-      + (fabs(troe_Ts[4]) > 1.e-100 ? -Fcent2/troe_Ts[4] : 0.)
-      + (troe_len[4] == 4 ? Fcent3*troe_Tss[4]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -19625,7 +20073,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[22];
-    Kc = refCinv * exp(2*g_RT[16] - g_RT[22]);
+    Kc = Kc_s[4];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[16]) + (h_RT[22]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19642,92 +20090,41 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[4][6] - 1)*dcdc_fac;
-        J[63] += -2 * dqdci;          /* dwdot[CH3]/d[AR] */
-        J[69] += dqdci;               /* dwdot[C2H6]/d[AR] */
-        /* d()/d[H2] */
-        dqdci = (TB[4][0] - 1)*dcdc_fac;
-        J[345] += -2 * dqdci;         /* dwdot[CH3]/d[H2] */
-        J[351] += dqdci;              /* dwdot[C2H6]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[4][1] - 1)*dcdc_fac;
-        J[392] += -2 * dqdci;         /* dwdot[CH3]/d[H2O] */
-        J[398] += dqdci;              /* dwdot[C2H6]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[4][3] - 1)*dcdc_fac;
-        J[533] += -2 * dqdci;         /* dwdot[CH3]/d[CO] */
-        J[539] += dqdci;              /* dwdot[C2H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[4][4] - 1)*dcdc_fac;
-        J[580] += -2 * dqdci;         /* dwdot[CH3]/d[CO2] */
-        J[586] += dqdci;              /* dwdot[C2H6]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[4][2] - 1)*dcdc_fac;
-        J[721] += -2 * dqdci;         /* dwdot[CH3]/d[CH4] */
-        J[727] += dqdci;              /* dwdot[C2H6]/d[CH4] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*2*sc[16];
-        J[768] += -2 * dqdci;         /* dwdot[CH3]/d[CH3] */
-        J[774] += dqdci;              /* dwdot[C2H6]/d[CH3] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[4][5] - 1)*dcdc_fac - k_r;
-        J[1050] += -2 * dqdci;        /* dwdot[CH3]/d[C2H6] */
-        J[1056] += dqdci;             /* dwdot[C2H6]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[4][6]*dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[4][0]*dcdc_fac;
-        dqdc[8] = TB[4][1]*dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[4][3]*dcdc_fac;
-        dqdc[12] = TB[4][4]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[4][2]*dcdc_fac;
-        dqdc[16] = dcdc_fac + k_f*2*sc[16];
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = TB[4][5]*dcdc_fac - k_r;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+16] += -2 * dqdc[k];
-            J[47*k+22] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[16] += -2 * dcdc_fac;
+    Jmix[22] += dcdc_fac;
+    /* d()/d[AR] */
+    dqdci = (TB[4][6] - 1)*dcdc_fac;
+    J[63] += -2 * dqdci;          /* dwdot[CH3]/d[AR] */
+    J[69] += dqdci;               /* dwdot[C2H6]/d[AR] */
+    /* d()/d[H2] */
+    dqdci = (TB[4][0] - 1)*dcdc_fac;
+    J[345] += -2 * dqdci;         /* dwdot[CH3]/d[H2] */
+    J[351] += dqdci;              /* dwdot[C2H6]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[4][1] - 1)*dcdc_fac;
+    J[392] += -2 * dqdci;         /* dwdot[CH3]/d[H2O] */
+    J[398] += dqdci;              /* dwdot[C2H6]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[4][3] - 1)*dcdc_fac;
+    J[533] += -2 * dqdci;         /* dwdot[CH3]/d[CO] */
+    J[539] += dqdci;              /* dwdot[C2H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[4][4] - 1)*dcdc_fac;
+    J[580] += -2 * dqdci;         /* dwdot[CH3]/d[CO2] */
+    J[586] += dqdci;              /* dwdot[C2H6]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[4][2] - 1)*dcdc_fac;
+    J[721] += -2 * dqdci;         /* dwdot[CH3]/d[CH4] */
+    J[727] += dqdci;              /* dwdot[C2H6]/d[CH4] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*2*sc[16];
+    J[768] += -2 * dqdci;         /* dwdot[CH3]/d[CH3] */
+    J[774] += dqdci;              /* dwdot[C2H6]/d[CH3] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[4][5] - 1)*dcdc_fac - k_r;
+    J[1050] += -2 * dqdci;        /* dwdot[CH3]/d[C2H6] */
+    J[1056] += dqdci;             /* dwdot[C2H6]/d[C2H6] */
     J[2178] += -2 * dqdT; /* dwdot[CH3]/dT */
     J[2184] += dqdT; /* dwdot[C2H6]/dT */
 
@@ -19735,11 +20132,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[5][0] - 1)*sc[7] + (TB[5][1] - 1)*sc[8] + (TB[5][2] - 1)*sc[15] + (TB[5][3] - 1)*sc[11] + (TB[5][4] - 1)*sc[12] + (TB[5][5] - 1)*sc[22] + (TB[5][6] - 1)*sc[1];
+    alpha = (memcmp(TB[5], TB[2], 7*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[5][0] - 1)*sc[7] + (TB[5][1] - 1)*sc[8] + (TB[5][2] - 1)*sc[15] + (TB[5][3] - 1)*sc[11] + (TB[5][4] - 1)*sc[12] + (TB[5][5] - 1)*sc[22] + (TB[5][6] - 1)*sc[1]);
     /* forward */
     phi_f = sc[22];
-    k_f = prefactor_units[5] * fwd_A[5]
-                * exp(fwd_beta[5] * tc[0] - activation_units[5] * fwd_Ea[5] * invT);
+    k_f = k_f_s[5];
     dlnkfdT = fwd_beta[5] * invT + activation_units[5] * fwd_Ea[5] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[5] * exp(low_beta[5] * tc[0] - activation_units[5] * low_Ea[5] * invT);
@@ -19755,16 +20151,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[5] == 4 ? exp(-troe_Tss[5] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[5]) > 1.e-100 ? -Fcent1/troe_Tsss[5] : 0.)
+      + (fabs(troe_Ts[5]) > 1.e-100 ? -Fcent2/troe_Ts[5] : 0.)
+      + (troe_len[5] == 4 ? Fcent3*troe_Tss[5]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[5]) > 1.e-100 ? -Fcent1/troe_Tsss[5] : 0.)
-      + (fabs(troe_Ts[5]) > 1.e-100 ? -Fcent2/troe_Ts[5] : 0.)
-      + (troe_len[5] == 4 ? Fcent3*troe_Tss[5]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -19772,7 +20168,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[3]*sc[21];
-    Kc = refC * exp(-g_RT[3] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[5];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[22]) + (h_RT[3] + h_RT[21]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19790,106 +20186,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[5][6] - 1)*dcdc_fac;
-        J[50] += dqdci;               /* dwdot[H]/d[AR] */
-        J[68] += dqdci;               /* dwdot[C2H5]/d[AR] */
-        J[69] -= dqdci;               /* dwdot[C2H6]/d[AR] */
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[21];
-        J[144] += dqdci;              /* dwdot[H]/d[H] */
-        J[162] += dqdci;              /* dwdot[C2H5]/d[H] */
-        J[163] -= dqdci;              /* dwdot[C2H6]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[5][0] - 1)*dcdc_fac;
-        J[332] += dqdci;              /* dwdot[H]/d[H2] */
-        J[350] += dqdci;              /* dwdot[C2H5]/d[H2] */
-        J[351] -= dqdci;              /* dwdot[C2H6]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[5][1] - 1)*dcdc_fac;
-        J[379] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[397] += dqdci;              /* dwdot[C2H5]/d[H2O] */
-        J[398] -= dqdci;              /* dwdot[C2H6]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[5][3] - 1)*dcdc_fac;
-        J[520] += dqdci;              /* dwdot[H]/d[CO] */
-        J[538] += dqdci;              /* dwdot[C2H5]/d[CO] */
-        J[539] -= dqdci;              /* dwdot[C2H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[5][4] - 1)*dcdc_fac;
-        J[567] += dqdci;              /* dwdot[H]/d[CO2] */
-        J[585] += dqdci;              /* dwdot[C2H5]/d[CO2] */
-        J[586] -= dqdci;              /* dwdot[C2H6]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[5][2] - 1)*dcdc_fac;
-        J[708] += dqdci;              /* dwdot[H]/d[CH4] */
-        J[726] += dqdci;              /* dwdot[C2H5]/d[CH4] */
-        J[727] -= dqdci;              /* dwdot[C2H6]/d[CH4] */
-        /* d()/d[C2H5] */
-        dqdci =  - k_r*sc[3];
-        J[990] += dqdci;              /* dwdot[H]/d[C2H5] */
-        J[1008] += dqdci;             /* dwdot[C2H5]/d[C2H5] */
-        J[1009] -= dqdci;             /* dwdot[C2H6]/d[C2H5] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[5][5] - 1)*dcdc_fac + k_f;
-        J[1037] += dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1055] += dqdci;             /* dwdot[C2H5]/d[C2H6] */
-        J[1056] -= dqdci;             /* dwdot[C2H6]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[5][6]*dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac - k_r*sc[21];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[5][0]*dcdc_fac;
-        dqdc[8] = TB[5][1]*dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[5][3]*dcdc_fac;
-        dqdc[12] = TB[5][4]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[5][2]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac - k_r*sc[3];
-        dqdc[22] = TB[5][5]*dcdc_fac + k_f;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+3] += dqdc[k];
-            J[47*k+21] += dqdc[k];
-            J[47*k+22] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] += dcdc_fac;
+    Jmix[21] += dcdc_fac;
+    Jmix[22] -= dcdc_fac;
+    /* d()/d[AR] */
+    dqdci = (TB[5][6] - 1)*dcdc_fac;
+    J[50] += dqdci;               /* dwdot[H]/d[AR] */
+    J[68] += dqdci;               /* dwdot[C2H5]/d[AR] */
+    J[69] -= dqdci;               /* dwdot[C2H6]/d[AR] */
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[21];
+    J[144] += dqdci;              /* dwdot[H]/d[H] */
+    J[162] += dqdci;              /* dwdot[C2H5]/d[H] */
+    J[163] -= dqdci;              /* dwdot[C2H6]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[5][0] - 1)*dcdc_fac;
+    J[332] += dqdci;              /* dwdot[H]/d[H2] */
+    J[350] += dqdci;              /* dwdot[C2H5]/d[H2] */
+    J[351] -= dqdci;              /* dwdot[C2H6]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[5][1] - 1)*dcdc_fac;
+    J[379] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[397] += dqdci;              /* dwdot[C2H5]/d[H2O] */
+    J[398] -= dqdci;              /* dwdot[C2H6]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[5][3] - 1)*dcdc_fac;
+    J[520] += dqdci;              /* dwdot[H]/d[CO] */
+    J[538] += dqdci;              /* dwdot[C2H5]/d[CO] */
+    J[539] -= dqdci;              /* dwdot[C2H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[5][4] - 1)*dcdc_fac;
+    J[567] += dqdci;              /* dwdot[H]/d[CO2] */
+    J[585] += dqdci;              /* dwdot[C2H5]/d[CO2] */
+    J[586] -= dqdci;              /* dwdot[C2H6]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[5][2] - 1)*dcdc_fac;
+    J[708] += dqdci;              /* dwdot[H]/d[CH4] */
+    J[726] += dqdci;              /* dwdot[C2H5]/d[CH4] */
+    J[727] -= dqdci;              /* dwdot[C2H6]/d[CH4] */
+    /* d()/d[C2H5] */
+    dqdci =  - k_r*sc[3];
+    J[990] += dqdci;              /* dwdot[H]/d[C2H5] */
+    J[1008] += dqdci;             /* dwdot[C2H5]/d[C2H5] */
+    J[1009] -= dqdci;             /* dwdot[C2H6]/d[C2H5] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[5][5] - 1)*dcdc_fac + k_f;
+    J[1037] += dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1055] += dqdci;             /* dwdot[C2H5]/d[C2H6] */
+    J[1056] -= dqdci;             /* dwdot[C2H6]/d[C2H6] */
     J[2165] += dqdT; /* dwdot[H]/dT */
     J[2183] += dqdT; /* dwdot[C2H5]/dT */
     J[2184] -= dqdT; /* dwdot[C2H6]/dT */
@@ -19898,11 +20243,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[6][0] - 1)*sc[7] + (TB[6][1] - 1)*sc[8] + (TB[6][2] - 1)*sc[15] + (TB[6][3] - 1)*sc[11] + (TB[6][4] - 1)*sc[12] + (TB[6][5] - 1)*sc[1];
+    alpha = (memcmp(TB[6], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[6][0] - 1)*sc[7] + (TB[6][1] - 1)*sc[8] + (TB[6][2] - 1)*sc[15] + (TB[6][3] - 1)*sc[11] + (TB[6][4] - 1)*sc[12] + (TB[6][5] - 1)*sc[1]);
     /* forward */
     phi_f = sc[21];
-    k_f = prefactor_units[6] * fwd_A[6]
-                * exp(fwd_beta[6] * tc[0] - activation_units[6] * fwd_Ea[6] * invT);
+    k_f = k_f_s[6];
     dlnkfdT = fwd_beta[6] * invT + activation_units[6] * fwd_Ea[6] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[6] * exp(low_beta[6] * tc[0] - activation_units[6] * low_Ea[6] * invT);
@@ -19918,16 +20262,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[6] == 4 ? exp(-troe_Tss[6] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[6]) > 1.e-100 ? -Fcent1/troe_Tsss[6] : 0.)
+      + (fabs(troe_Ts[6]) > 1.e-100 ? -Fcent2/troe_Ts[6] : 0.)
+      + (troe_len[6] == 4 ? Fcent3*troe_Tss[6]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[6]) > 1.e-100 ? -Fcent1/troe_Tsss[6] : 0.)
-      + (fabs(troe_Ts[6]) > 1.e-100 ? -Fcent2/troe_Ts[6] : 0.)
-      + (troe_len[6] == 4 ? Fcent3*troe_Tss[6]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -19935,7 +20279,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[3]*sc[19];
-    Kc = refC * exp(-g_RT[3] - g_RT[19] + g_RT[21]);
+    Kc = Kc_s[6];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[21]) + (h_RT[3] + h_RT[19]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19953,106 +20297,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[6][5] - 1)*dcdc_fac;
-        J[50] += dqdci;               /* dwdot[H]/d[AR] */
-        J[66] += dqdci;               /* dwdot[C2H4]/d[AR] */
-        J[68] -= dqdci;               /* dwdot[C2H5]/d[AR] */
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[19];
-        J[144] += dqdci;              /* dwdot[H]/d[H] */
-        J[160] += dqdci;              /* dwdot[C2H4]/d[H] */
-        J[162] -= dqdci;              /* dwdot[C2H5]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[6][0] - 1)*dcdc_fac;
-        J[332] += dqdci;              /* dwdot[H]/d[H2] */
-        J[348] += dqdci;              /* dwdot[C2H4]/d[H2] */
-        J[350] -= dqdci;              /* dwdot[C2H5]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[6][1] - 1)*dcdc_fac;
-        J[379] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[395] += dqdci;              /* dwdot[C2H4]/d[H2O] */
-        J[397] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[6][3] - 1)*dcdc_fac;
-        J[520] += dqdci;              /* dwdot[H]/d[CO] */
-        J[536] += dqdci;              /* dwdot[C2H4]/d[CO] */
-        J[538] -= dqdci;              /* dwdot[C2H5]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[6][4] - 1)*dcdc_fac;
-        J[567] += dqdci;              /* dwdot[H]/d[CO2] */
-        J[583] += dqdci;              /* dwdot[C2H4]/d[CO2] */
-        J[585] -= dqdci;              /* dwdot[C2H5]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[6][2] - 1)*dcdc_fac;
-        J[708] += dqdci;              /* dwdot[H]/d[CH4] */
-        J[724] += dqdci;              /* dwdot[C2H4]/d[CH4] */
-        J[726] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
-        /* d()/d[C2H4] */
-        dqdci =  - k_r*sc[3];
-        J[896] += dqdci;              /* dwdot[H]/d[C2H4] */
-        J[912] += dqdci;              /* dwdot[C2H4]/d[C2H4] */
-        J[914] -= dqdci;              /* dwdot[C2H5]/d[C2H4] */
-        /* d()/d[C2H5] */
-        dqdci =  + k_f;
-        J[990] += dqdci;              /* dwdot[H]/d[C2H5] */
-        J[1006] += dqdci;             /* dwdot[C2H4]/d[C2H5] */
-        J[1008] -= dqdci;             /* dwdot[C2H5]/d[C2H5] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[6][5]*dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac - k_r*sc[19];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[6][0]*dcdc_fac;
-        dqdc[8] = TB[6][1]*dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[6][3]*dcdc_fac;
-        dqdc[12] = TB[6][4]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[6][2]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac - k_r*sc[3];
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac + k_f;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+3] += dqdc[k];
-            J[47*k+19] += dqdc[k];
-            J[47*k+21] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] += dcdc_fac;
+    Jmix[19] += dcdc_fac;
+    Jmix[21] -= dcdc_fac;
+    /* d()/d[AR] */
+    dqdci = (TB[6][5] - 1)*dcdc_fac;
+    J[50] += dqdci;               /* dwdot[H]/d[AR] */
+    J[66] += dqdci;               /* dwdot[C2H4]/d[AR] */
+    J[68] -= dqdci;               /* dwdot[C2H5]/d[AR] */
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[19];
+    J[144] += dqdci;              /* dwdot[H]/d[H] */
+    J[160] += dqdci;              /* dwdot[C2H4]/d[H] */
+    J[162] -= dqdci;              /* dwdot[C2H5]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[6][0] - 1)*dcdc_fac;
+    J[332] += dqdci;              /* dwdot[H]/d[H2] */
+    J[348] += dqdci;              /* dwdot[C2H4]/d[H2] */
+    J[350] -= dqdci;              /* dwdot[C2H5]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[6][1] - 1)*dcdc_fac;
+    J[379] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[395] += dqdci;              /* dwdot[C2H4]/d[H2O] */
+    J[397] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[6][3] - 1)*dcdc_fac;
+    J[520] += dqdci;              /* dwdot[H]/d[CO] */
+    J[536] += dqdci;              /* dwdot[C2H4]/d[CO] */
+    J[538] -= dqdci;              /* dwdot[C2H5]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[6][4] - 1)*dcdc_fac;
+    J[567] += dqdci;              /* dwdot[H]/d[CO2] */
+    J[583] += dqdci;              /* dwdot[C2H4]/d[CO2] */
+    J[585] -= dqdci;              /* dwdot[C2H5]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[6][2] - 1)*dcdc_fac;
+    J[708] += dqdci;              /* dwdot[H]/d[CH4] */
+    J[724] += dqdci;              /* dwdot[C2H4]/d[CH4] */
+    J[726] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
+    /* d()/d[C2H4] */
+    dqdci =  - k_r*sc[3];
+    J[896] += dqdci;              /* dwdot[H]/d[C2H4] */
+    J[912] += dqdci;              /* dwdot[C2H4]/d[C2H4] */
+    J[914] -= dqdci;              /* dwdot[C2H5]/d[C2H4] */
+    /* d()/d[C2H5] */
+    dqdci =  + k_f;
+    J[990] += dqdci;              /* dwdot[H]/d[C2H5] */
+    J[1006] += dqdci;             /* dwdot[C2H4]/d[C2H5] */
+    J[1008] -= dqdci;             /* dwdot[C2H5]/d[C2H5] */
     J[2165] += dqdT; /* dwdot[H]/dT */
     J[2181] += dqdT; /* dwdot[C2H4]/dT */
     J[2183] -= dqdT; /* dwdot[C2H5]/dT */
@@ -20061,11 +20354,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[7][0] - 1)*sc[7] + (TB[7][1] - 1)*sc[8] + (TB[7][2] - 1)*sc[15] + (TB[7][3] - 1)*sc[11] + (TB[7][4] - 1)*sc[12] + (TB[7][5] - 1)*sc[1];
+    alpha = (memcmp(TB[7], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[7][0] - 1)*sc[7] + (TB[7][1] - 1)*sc[8] + (TB[7][2] - 1)*sc[15] + (TB[7][3] - 1)*sc[11] + (TB[7][4] - 1)*sc[12] + (TB[7][5] - 1)*sc[1]);
     /* forward */
     phi_f = sc[25];
-    k_f = prefactor_units[7] * fwd_A[7]
-                * exp(fwd_beta[7] * tc[0] - activation_units[7] * fwd_Ea[7] * invT);
+    k_f = k_f_s[7];
     dlnkfdT = fwd_beta[7] * invT + activation_units[7] * fwd_Ea[7] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[7] * exp(low_beta[7] * tc[0] - activation_units[7] * low_Ea[7] * invT);
@@ -20081,16 +20373,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[7] == 4 ? exp(-troe_Tss[7] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[7]) > 1.e-100 ? -Fcent1/troe_Tsss[7] : 0.)
+      + (fabs(troe_Ts[7]) > 1.e-100 ? -Fcent2/troe_Ts[7] : 0.)
+      + (troe_len[7] == 4 ? Fcent3*troe_Tss[7]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[7]) > 1.e-100 ? -Fcent1/troe_Tsss[7] : 0.)
-      + (fabs(troe_Ts[7]) > 1.e-100 ? -Fcent2/troe_Ts[7] : 0.)
-      + (troe_len[7] == 4 ? Fcent3*troe_Tss[7]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -20098,7 +20390,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[3]*sc[24];
-    Kc = refC * exp(-g_RT[3] - g_RT[24] + g_RT[25]);
+    Kc = Kc_s[7];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[25]) + (h_RT[3] + h_RT[24]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20116,106 +20408,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[7][5] - 1)*dcdc_fac;
-        J[50] += dqdci;               /* dwdot[H]/d[AR] */
-        J[71] += dqdci;               /* dwdot[C2H2]/d[AR] */
-        J[72] -= dqdci;               /* dwdot[C2H3]/d[AR] */
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[24];
-        J[144] += dqdci;              /* dwdot[H]/d[H] */
-        J[165] += dqdci;              /* dwdot[C2H2]/d[H] */
-        J[166] -= dqdci;              /* dwdot[C2H3]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[7][0] - 1)*dcdc_fac;
-        J[332] += dqdci;              /* dwdot[H]/d[H2] */
-        J[353] += dqdci;              /* dwdot[C2H2]/d[H2] */
-        J[354] -= dqdci;              /* dwdot[C2H3]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[7][1] - 1)*dcdc_fac;
-        J[379] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[400] += dqdci;              /* dwdot[C2H2]/d[H2O] */
-        J[401] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[7][3] - 1)*dcdc_fac;
-        J[520] += dqdci;              /* dwdot[H]/d[CO] */
-        J[541] += dqdci;              /* dwdot[C2H2]/d[CO] */
-        J[542] -= dqdci;              /* dwdot[C2H3]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[7][4] - 1)*dcdc_fac;
-        J[567] += dqdci;              /* dwdot[H]/d[CO2] */
-        J[588] += dqdci;              /* dwdot[C2H2]/d[CO2] */
-        J[589] -= dqdci;              /* dwdot[C2H3]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[7][2] - 1)*dcdc_fac;
-        J[708] += dqdci;              /* dwdot[H]/d[CH4] */
-        J[729] += dqdci;              /* dwdot[C2H2]/d[CH4] */
-        J[730] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
-        /* d()/d[C2H2] */
-        dqdci =  - k_r*sc[3];
-        J[1131] += dqdci;             /* dwdot[H]/d[C2H2] */
-        J[1152] += dqdci;             /* dwdot[C2H2]/d[C2H2] */
-        J[1153] -= dqdci;             /* dwdot[C2H3]/d[C2H2] */
-        /* d()/d[C2H3] */
-        dqdci =  + k_f;
-        J[1178] += dqdci;             /* dwdot[H]/d[C2H3] */
-        J[1199] += dqdci;             /* dwdot[C2H2]/d[C2H3] */
-        J[1200] -= dqdci;             /* dwdot[C2H3]/d[C2H3] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[7][5]*dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac - k_r*sc[24];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[7][0]*dcdc_fac;
-        dqdc[8] = TB[7][1]*dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[7][3]*dcdc_fac;
-        dqdc[12] = TB[7][4]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[7][2]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac - k_r*sc[3];
-        dqdc[25] = dcdc_fac + k_f;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+3] += dqdc[k];
-            J[47*k+24] += dqdc[k];
-            J[47*k+25] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] += dcdc_fac;
+    Jmix[24] += dcdc_fac;
+    Jmix[25] -= dcdc_fac;
+    /* d()/d[AR] */
+    dqdci = (TB[7][5] - 1)*dcdc_fac;
+    J[50] += dqdci;               /* dwdot[H]/d[AR] */
+    J[71] += dqdci;               /* dwdot[C2H2]/d[AR] */
+    J[72] -= dqdci;               /* dwdot[C2H3]/d[AR] */
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[24];
+    J[144] += dqdci;              /* dwdot[H]/d[H] */
+    J[165] += dqdci;              /* dwdot[C2H2]/d[H] */
+    J[166] -= dqdci;              /* dwdot[C2H3]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[7][0] - 1)*dcdc_fac;
+    J[332] += dqdci;              /* dwdot[H]/d[H2] */
+    J[353] += dqdci;              /* dwdot[C2H2]/d[H2] */
+    J[354] -= dqdci;              /* dwdot[C2H3]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[7][1] - 1)*dcdc_fac;
+    J[379] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[400] += dqdci;              /* dwdot[C2H2]/d[H2O] */
+    J[401] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[7][3] - 1)*dcdc_fac;
+    J[520] += dqdci;              /* dwdot[H]/d[CO] */
+    J[541] += dqdci;              /* dwdot[C2H2]/d[CO] */
+    J[542] -= dqdci;              /* dwdot[C2H3]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[7][4] - 1)*dcdc_fac;
+    J[567] += dqdci;              /* dwdot[H]/d[CO2] */
+    J[588] += dqdci;              /* dwdot[C2H2]/d[CO2] */
+    J[589] -= dqdci;              /* dwdot[C2H3]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[7][2] - 1)*dcdc_fac;
+    J[708] += dqdci;              /* dwdot[H]/d[CH4] */
+    J[729] += dqdci;              /* dwdot[C2H2]/d[CH4] */
+    J[730] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
+    /* d()/d[C2H2] */
+    dqdci =  - k_r*sc[3];
+    J[1131] += dqdci;             /* dwdot[H]/d[C2H2] */
+    J[1152] += dqdci;             /* dwdot[C2H2]/d[C2H2] */
+    J[1153] -= dqdci;             /* dwdot[C2H3]/d[C2H2] */
+    /* d()/d[C2H3] */
+    dqdci =  + k_f;
+    J[1178] += dqdci;             /* dwdot[H]/d[C2H3] */
+    J[1199] += dqdci;             /* dwdot[C2H2]/d[C2H3] */
+    J[1200] -= dqdci;             /* dwdot[C2H3]/d[C2H3] */
     J[2165] += dqdT; /* dwdot[H]/dT */
     J[2186] += dqdT; /* dwdot[C2H2]/dT */
     J[2187] -= dqdT; /* dwdot[C2H3]/dT */
@@ -20224,11 +20465,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[8][0] - 1)*sc[7] + (TB[8][1] - 1)*sc[8] + (TB[8][2] - 1)*sc[11] + (TB[8][3] - 1)*sc[12] + (TB[8][4] - 1)*sc[15] + (TB[8][5] - 1)*sc[1];
+    alpha = alpha_eff2;
     /* forward */
     phi_f = sc[32];
-    k_f = prefactor_units[8] * fwd_A[8]
-                * exp(fwd_beta[8] * tc[0] - activation_units[8] * fwd_Ea[8] * invT);
+    k_f = k_f_s[8];
     dlnkfdT = fwd_beta[8] * invT + activation_units[8] * fwd_Ea[8] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[8] * exp(low_beta[8] * tc[0] - activation_units[8] * low_Ea[8] * invT);
@@ -20244,16 +20484,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[8] == 4 ? exp(-troe_Tss[8] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[8]) > 1.e-100 ? -Fcent1/troe_Tsss[8] : 0.)
+      + (fabs(troe_Ts[8]) > 1.e-100 ? -Fcent2/troe_Ts[8] : 0.)
+      + (troe_len[8] == 4 ? Fcent3*troe_Tss[8]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[8]) > 1.e-100 ? -Fcent1/troe_Tsss[8] : 0.)
-      + (fabs(troe_Ts[8]) > 1.e-100 ? -Fcent2/troe_Ts[8] : 0.)
-      + (troe_len[8] == 4 ? Fcent3*troe_Tss[8]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -20261,7 +20501,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[5]*sc[16];
-    Kc = refC * exp(-g_RT[5] - g_RT[16] + g_RT[32]);
+    Kc = Kc_s[8];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[32]) + (h_RT[5] + h_RT[16]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20279,106 +20519,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[8][5] - 1)*dcdc_fac;
-        J[52] += dqdci;               /* dwdot[OH]/d[AR] */
-        J[63] += dqdci;               /* dwdot[CH3]/d[AR] */
-        J[79] -= dqdci;               /* dwdot[CH3OH]/d[AR] */
-        /* d()/d[OH] */
-        dqdci =  - k_r*sc[16];
-        J[240] += dqdci;              /* dwdot[OH]/d[OH] */
-        J[251] += dqdci;              /* dwdot[CH3]/d[OH] */
-        J[267] -= dqdci;              /* dwdot[CH3OH]/d[OH] */
-        /* d()/d[H2] */
-        dqdci = (TB[8][0] - 1)*dcdc_fac;
-        J[334] += dqdci;              /* dwdot[OH]/d[H2] */
-        J[345] += dqdci;              /* dwdot[CH3]/d[H2] */
-        J[361] -= dqdci;              /* dwdot[CH3OH]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[8][1] - 1)*dcdc_fac;
-        J[381] += dqdci;              /* dwdot[OH]/d[H2O] */
-        J[392] += dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[408] -= dqdci;              /* dwdot[CH3OH]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[8][2] - 1)*dcdc_fac;
-        J[522] += dqdci;              /* dwdot[OH]/d[CO] */
-        J[533] += dqdci;              /* dwdot[CH3]/d[CO] */
-        J[549] -= dqdci;              /* dwdot[CH3OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[8][3] - 1)*dcdc_fac;
-        J[569] += dqdci;              /* dwdot[OH]/d[CO2] */
-        J[580] += dqdci;              /* dwdot[CH3]/d[CO2] */
-        J[596] -= dqdci;              /* dwdot[CH3OH]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[8][4] - 1)*dcdc_fac;
-        J[710] += dqdci;              /* dwdot[OH]/d[CH4] */
-        J[721] += dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[737] -= dqdci;              /* dwdot[CH3OH]/d[CH4] */
-        /* d()/d[CH3] */
-        dqdci =  - k_r*sc[5];
-        J[757] += dqdci;              /* dwdot[OH]/d[CH3] */
-        J[768] += dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[784] -= dqdci;              /* dwdot[CH3OH]/d[CH3] */
-        /* d()/d[CH3OH] */
-        dqdci =  + k_f;
-        J[1509] += dqdci;             /* dwdot[OH]/d[CH3OH] */
-        J[1520] += dqdci;             /* dwdot[CH3]/d[CH3OH] */
-        J[1536] -= dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[8][5]*dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac - k_r*sc[16];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[8][0]*dcdc_fac;
-        dqdc[8] = TB[8][1]*dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[8][2]*dcdc_fac;
-        dqdc[12] = TB[8][3]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[8][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac - k_r*sc[5];
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac + k_f;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+5] += dqdc[k];
-            J[47*k+16] += dqdc[k];
-            J[47*k+32] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[5] += dcdc_fac;
+    Jmix[16] += dcdc_fac;
+    Jmix[32] -= dcdc_fac;
+    /* d()/d[AR] */
+    dqdci = (TB[8][5] - 1)*dcdc_fac;
+    J[52] += dqdci;               /* dwdot[OH]/d[AR] */
+    J[63] += dqdci;               /* dwdot[CH3]/d[AR] */
+    J[79] -= dqdci;               /* dwdot[CH3OH]/d[AR] */
+    /* d()/d[OH] */
+    dqdci =  - k_r*sc[16];
+    J[240] += dqdci;              /* dwdot[OH]/d[OH] */
+    J[251] += dqdci;              /* dwdot[CH3]/d[OH] */
+    J[267] -= dqdci;              /* dwdot[CH3OH]/d[OH] */
+    /* d()/d[H2] */
+    dqdci = (TB[8][0] - 1)*dcdc_fac;
+    J[334] += dqdci;              /* dwdot[OH]/d[H2] */
+    J[345] += dqdci;              /* dwdot[CH3]/d[H2] */
+    J[361] -= dqdci;              /* dwdot[CH3OH]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[8][1] - 1)*dcdc_fac;
+    J[381] += dqdci;              /* dwdot[OH]/d[H2O] */
+    J[392] += dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[408] -= dqdci;              /* dwdot[CH3OH]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[8][2] - 1)*dcdc_fac;
+    J[522] += dqdci;              /* dwdot[OH]/d[CO] */
+    J[533] += dqdci;              /* dwdot[CH3]/d[CO] */
+    J[549] -= dqdci;              /* dwdot[CH3OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[8][3] - 1)*dcdc_fac;
+    J[569] += dqdci;              /* dwdot[OH]/d[CO2] */
+    J[580] += dqdci;              /* dwdot[CH3]/d[CO2] */
+    J[596] -= dqdci;              /* dwdot[CH3OH]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[8][4] - 1)*dcdc_fac;
+    J[710] += dqdci;              /* dwdot[OH]/d[CH4] */
+    J[721] += dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[737] -= dqdci;              /* dwdot[CH3OH]/d[CH4] */
+    /* d()/d[CH3] */
+    dqdci =  - k_r*sc[5];
+    J[757] += dqdci;              /* dwdot[OH]/d[CH3] */
+    J[768] += dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[784] -= dqdci;              /* dwdot[CH3OH]/d[CH3] */
+    /* d()/d[CH3OH] */
+    dqdci =  + k_f;
+    J[1509] += dqdci;             /* dwdot[OH]/d[CH3OH] */
+    J[1520] += dqdci;             /* dwdot[CH3]/d[CH3OH] */
+    J[1536] -= dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
     J[2167] += dqdT; /* dwdot[OH]/dT */
     J[2178] += dqdT; /* dwdot[CH3]/dT */
     J[2194] -= dqdT; /* dwdot[CH3OH]/dT */
@@ -20387,11 +20576,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[9][0] - 1)*sc[7] + (TB[9][1] - 1)*sc[8] + (TB[9][2] - 1)*sc[11] + (TB[9][3] - 1)*sc[12] + (TB[9][4] - 1)*sc[15] + (TB[9][5] - 1)*sc[1];
+    alpha = (memcmp(TB[9], TB[8], 6*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[9][0] - 1)*sc[7] + (TB[9][1] - 1)*sc[8] + (TB[9][2] - 1)*sc[11] + (TB[9][3] - 1)*sc[12] + (TB[9][4] - 1)*sc[15] + (TB[9][5] - 1)*sc[1]);
     /* forward */
     phi_f = sc[33];
-    k_f = prefactor_units[9] * fwd_A[9]
-                * exp(fwd_beta[9] * tc[0] - activation_units[9] * fwd_Ea[9] * invT);
+    k_f = k_f_s[9];
     dlnkfdT = fwd_beta[9] * invT + activation_units[9] * fwd_Ea[9] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[9] * exp(low_beta[9] * tc[0] - activation_units[9] * low_Ea[9] * invT);
@@ -20402,21 +20590,28 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogfPrdT = dlogPrdT / (1.0+Pr);
     /* Troe form */
     logPr = log10(Pr);
-    Fcent1 = (fabs(troe_Tsss[9]) > 1.e-100 ? (1.-troe_a[9])*exp(-T/troe_Tsss[9]) : 0.);
-    Fcent2 = (fabs(troe_Ts[9]) > 1.e-100 ? troe_a[9] * exp(-T/troe_Ts[9]) : 0.);
-    Fcent3 = (troe_len[9] == 4 ? exp(-troe_Tss[9] * invT) : 0.);
-    Fcent = Fcent1 + Fcent2 + Fcent3;
-    logFcent = log10(Fcent);
+    if (troe_a[9] == troe_a[0] && troe_Tsss[9] == troe_Tsss[0] && troe_Ts[9] == troe_Ts[0]
+        && troe_Tss[9] == troe_Tss[0] && troe_len[9] == troe_len[0]) {
+        logFcent = logFcent_s[0];
+        dlogFcentdT = dlogFcentdT_s[0];
+    }
+    else {
+        Fcent1 = (fabs(troe_Tsss[9]) > 1.e-100 ? (1.-troe_a[9])*exp(-T/troe_Tsss[9]) : 0.);
+        Fcent2 = (fabs(troe_Ts[9]) > 1.e-100 ? troe_a[9] * exp(-T/troe_Ts[9]) : 0.);
+        Fcent3 = (troe_len[9] == 4 ? exp(-troe_Tss[9] * invT) : 0.);
+        Fcent = Fcent1 + Fcent2 + Fcent3;
+        logFcent = log10(Fcent);
+        dlogFcentdT = log10e/Fcent*( 
+            (fabs(troe_Tsss[9]) > 1.e-100 ? -Fcent1/troe_Tsss[9] : 0.)
+          + (fabs(troe_Ts[9]) > 1.e-100 ? -Fcent2/troe_Ts[9] : 0.)
+          + (troe_len[9] == 4 ? Fcent3*troe_Tss[9]*invT2 : 0.) );
+    }
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[9]) > 1.e-100 ? -Fcent1/troe_Tsss[9] : 0.)
-      + (fabs(troe_Ts[9]) > 1.e-100 ? -Fcent2/troe_Ts[9] : 0.)
-      + (troe_len[9] == 4 ? Fcent3*troe_Tss[9]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -20424,7 +20619,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[16]*sc[31];
-    Kc = refC * exp(-g_RT[16] - g_RT[31] + g_RT[33]);
+    Kc = Kc_s[9];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[33]) + (h_RT[16] + h_RT[31]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20442,106 +20637,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[9][5] - 1)*dcdc_fac;
-        J[63] += dqdci;               /* dwdot[CH3]/d[AR] */
-        J[78] += dqdci;               /* dwdot[CH2OH]/d[AR] */
-        J[80] -= dqdci;               /* dwdot[C2H5OH]/d[AR] */
-        /* d()/d[H2] */
-        dqdci = (TB[9][0] - 1)*dcdc_fac;
-        J[345] += dqdci;              /* dwdot[CH3]/d[H2] */
-        J[360] += dqdci;              /* dwdot[CH2OH]/d[H2] */
-        J[362] -= dqdci;              /* dwdot[C2H5OH]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[9][1] - 1)*dcdc_fac;
-        J[392] += dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[407] += dqdci;              /* dwdot[CH2OH]/d[H2O] */
-        J[409] -= dqdci;              /* dwdot[C2H5OH]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[9][2] - 1)*dcdc_fac;
-        J[533] += dqdci;              /* dwdot[CH3]/d[CO] */
-        J[548] += dqdci;              /* dwdot[CH2OH]/d[CO] */
-        J[550] -= dqdci;              /* dwdot[C2H5OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[9][3] - 1)*dcdc_fac;
-        J[580] += dqdci;              /* dwdot[CH3]/d[CO2] */
-        J[595] += dqdci;              /* dwdot[CH2OH]/d[CO2] */
-        J[597] -= dqdci;              /* dwdot[C2H5OH]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[9][4] - 1)*dcdc_fac;
-        J[721] += dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[736] += dqdci;              /* dwdot[CH2OH]/d[CH4] */
-        J[738] -= dqdci;              /* dwdot[C2H5OH]/d[CH4] */
-        /* d()/d[CH3] */
-        dqdci =  - k_r*sc[31];
-        J[768] += dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[783] += dqdci;              /* dwdot[CH2OH]/d[CH3] */
-        J[785] -= dqdci;              /* dwdot[C2H5OH]/d[CH3] */
-        /* d()/d[CH2OH] */
-        dqdci =  - k_r*sc[16];
-        J[1473] += dqdci;             /* dwdot[CH3]/d[CH2OH] */
-        J[1488] += dqdci;             /* dwdot[CH2OH]/d[CH2OH] */
-        J[1490] -= dqdci;             /* dwdot[C2H5OH]/d[CH2OH] */
-        /* d()/d[C2H5OH] */
-        dqdci =  + k_f;
-        J[1567] += dqdci;             /* dwdot[CH3]/d[C2H5OH] */
-        J[1582] += dqdci;             /* dwdot[CH2OH]/d[C2H5OH] */
-        J[1584] -= dqdci;             /* dwdot[C2H5OH]/d[C2H5OH] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[9][5]*dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[9][0]*dcdc_fac;
-        dqdc[8] = TB[9][1]*dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[9][2]*dcdc_fac;
-        dqdc[12] = TB[9][3]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[9][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac - k_r*sc[31];
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac - k_r*sc[16];
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac + k_f;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+16] += dqdc[k];
-            J[47*k+31] += dqdc[k];
-            J[47*k+33] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[16] += dcdc_fac;
+    Jmix[31] += dcdc_fac;
+    Jmix[33] -= dcdc_fac;
+    /* d()/d[AR] */
+    dqdci = (TB[9][5] - 1)*dcdc_fac;
+    J[63] += dqdci;               /* dwdot[CH3]/d[AR] */
+    J[78] += dqdci;               /* dwdot[CH2OH]/d[AR] */
+    J[80] -= dqdci;               /* dwdot[C2H5OH]/d[AR] */
+    /* d()/d[H2] */
+    dqdci = (TB[9][0] - 1)*dcdc_fac;
+    J[345] += dqdci;              /* dwdot[CH3]/d[H2] */
+    J[360] += dqdci;              /* dwdot[CH2OH]/d[H2] */
+    J[362] -= dqdci;              /* dwdot[C2H5OH]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[9][1] - 1)*dcdc_fac;
+    J[392] += dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[407] += dqdci;              /* dwdot[CH2OH]/d[H2O] */
+    J[409] -= dqdci;              /* dwdot[C2H5OH]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[9][2] - 1)*dcdc_fac;
+    J[533] += dqdci;              /* dwdot[CH3]/d[CO] */
+    J[548] += dqdci;              /* dwdot[CH2OH]/d[CO] */
+    J[550] -= dqdci;              /* dwdot[C2H5OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[9][3] - 1)*dcdc_fac;
+    J[580] += dqdci;              /* dwdot[CH3]/d[CO2] */
+    J[595] += dqdci;              /* dwdot[CH2OH]/d[CO2] */
+    J[597] -= dqdci;              /* dwdot[C2H5OH]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[9][4] - 1)*dcdc_fac;
+    J[721] += dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[736] += dqdci;              /* dwdot[CH2OH]/d[CH4] */
+    J[738] -= dqdci;              /* dwdot[C2H5OH]/d[CH4] */
+    /* d()/d[CH3] */
+    dqdci =  - k_r*sc[31];
+    J[768] += dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[783] += dqdci;              /* dwdot[CH2OH]/d[CH3] */
+    J[785] -= dqdci;              /* dwdot[C2H5OH]/d[CH3] */
+    /* d()/d[CH2OH] */
+    dqdci =  - k_r*sc[16];
+    J[1473] += dqdci;             /* dwdot[CH3]/d[CH2OH] */
+    J[1488] += dqdci;             /* dwdot[CH2OH]/d[CH2OH] */
+    J[1490] -= dqdci;             /* dwdot[C2H5OH]/d[CH2OH] */
+    /* d()/d[C2H5OH] */
+    dqdci =  + k_f;
+    J[1567] += dqdci;             /* dwdot[CH3]/d[C2H5OH] */
+    J[1582] += dqdci;             /* dwdot[CH2OH]/d[C2H5OH] */
+    J[1584] -= dqdci;             /* dwdot[C2H5OH]/d[C2H5OH] */
     J[2178] += dqdT; /* dwdot[CH3]/dT */
     J[2193] += dqdT; /* dwdot[CH2OH]/dT */
     J[2195] -= dqdT; /* dwdot[C2H5OH]/dT */
@@ -20550,11 +20694,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[10][0] - 1)*sc[7] + (TB[10][1] - 1)*sc[8] + (TB[10][2] - 1)*sc[11] + (TB[10][3] - 1)*sc[12] + (TB[10][4] - 1)*sc[15] + (TB[10][5] - 1)*sc[1];
+    alpha = (memcmp(TB[10], TB[8], 6*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[10][0] - 1)*sc[7] + (TB[10][1] - 1)*sc[8] + (TB[10][2] - 1)*sc[11] + (TB[10][3] - 1)*sc[12] + (TB[10][4] - 1)*sc[15] + (TB[10][5] - 1)*sc[1]);
     /* forward */
     phi_f = sc[33];
-    k_f = prefactor_units[10] * fwd_A[10]
-                * exp(fwd_beta[10] * tc[0] - activation_units[10] * fwd_Ea[10] * invT);
+    k_f = k_f_s[10];
     dlnkfdT = fwd_beta[10] * invT + activation_units[10] * fwd_Ea[10] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[10] * exp(low_beta[10] * tc[0] - activation_units[10] * low_Ea[10] * invT);
@@ -20565,21 +20708,28 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogfPrdT = dlogPrdT / (1.0+Pr);
     /* Troe form */
     logPr = log10(Pr);
-    Fcent1 = (fabs(troe_Tsss[10]) > 1.e-100 ? (1.-troe_a[10])*exp(-T/troe_Tsss[10]) : 0.);
-    Fcent2 = (fabs(troe_Ts[10]) > 1.e-100 ? troe_a[10] * exp(-T/troe_Ts[10]) : 0.);
-    Fcent3 = (troe_len[10] == 4 ? exp(-troe_Tss[10] * invT) : 0.);
-    Fcent = Fcent1 + Fcent2 + Fcent3;
-    logFcent = log10(Fcent);
+    if (troe_a[10] == troe_a[0] && troe_Tsss[10] == troe_Tsss[0] && troe_Ts[10] == troe_Ts[0]
+        && troe_Tss[10] == troe_Tss[0] && troe_len[10] == troe_len[0]) {
+        logFcent = logFcent_s[0];
+        dlogFcentdT = dlogFcentdT_s[0];
+    }
+    else {
+        Fcent1 = (fabs(troe_Tsss[10]) > 1.e-100 ? (1.-troe_a[10])*exp(-T/troe_Tsss[10]) : 0.);
+        Fcent2 = (fabs(troe_Ts[10]) > 1.e-100 ? troe_a[10] * exp(-T/troe_Ts[10]) : 0.);
+        Fcent3 = (troe_len[10] == 4 ? exp(-troe_Tss[10] * invT) : 0.);
+        Fcent = Fcent1 + Fcent2 + Fcent3;
+        logFcent = log10(Fcent);
+        dlogFcentdT = log10e/Fcent*( 
+            (fabs(troe_Tsss[10]) > 1.e-100 ? -Fcent1/troe_Tsss[10] : 0.)
+          + (fabs(troe_Ts[10]) > 1.e-100 ? -Fcent2/troe_Ts[10] : 0.)
+          + (troe_len[10] == 4 ? Fcent3*troe_Tss[10]*invT2 : 0.) );
+    }
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[10]) > 1.e-100 ? -Fcent1/troe_Tsss[10] : 0.)
-      + (fabs(troe_Ts[10]) > 1.e-100 ? -Fcent2/troe_Ts[10] : 0.)
-      + (troe_len[10] == 4 ? Fcent3*troe_Tss[10]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -20587,7 +20737,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[8]*sc[19];
-    Kc = refC * exp(-g_RT[8] - g_RT[19] + g_RT[33]);
+    Kc = Kc_s[10];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[33]) + (h_RT[8] + h_RT[19]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20605,101 +20755,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[10][5] - 1)*dcdc_fac;
-        J[55] += dqdci;               /* dwdot[H2O]/d[AR] */
-        J[66] += dqdci;               /* dwdot[C2H4]/d[AR] */
-        J[80] -= dqdci;               /* dwdot[C2H5OH]/d[AR] */
-        /* d()/d[H2] */
-        dqdci = (TB[10][0] - 1)*dcdc_fac;
-        J[337] += dqdci;              /* dwdot[H2O]/d[H2] */
-        J[348] += dqdci;              /* dwdot[C2H4]/d[H2] */
-        J[362] -= dqdci;              /* dwdot[C2H5OH]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[10][1] - 1)*dcdc_fac - k_r*sc[19];
-        J[384] += dqdci;              /* dwdot[H2O]/d[H2O] */
-        J[395] += dqdci;              /* dwdot[C2H4]/d[H2O] */
-        J[409] -= dqdci;              /* dwdot[C2H5OH]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[10][2] - 1)*dcdc_fac;
-        J[525] += dqdci;              /* dwdot[H2O]/d[CO] */
-        J[536] += dqdci;              /* dwdot[C2H4]/d[CO] */
-        J[550] -= dqdci;              /* dwdot[C2H5OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[10][3] - 1)*dcdc_fac;
-        J[572] += dqdci;              /* dwdot[H2O]/d[CO2] */
-        J[583] += dqdci;              /* dwdot[C2H4]/d[CO2] */
-        J[597] -= dqdci;              /* dwdot[C2H5OH]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[10][4] - 1)*dcdc_fac;
-        J[713] += dqdci;              /* dwdot[H2O]/d[CH4] */
-        J[724] += dqdci;              /* dwdot[C2H4]/d[CH4] */
-        J[738] -= dqdci;              /* dwdot[C2H5OH]/d[CH4] */
-        /* d()/d[C2H4] */
-        dqdci =  - k_r*sc[8];
-        J[901] += dqdci;              /* dwdot[H2O]/d[C2H4] */
-        J[912] += dqdci;              /* dwdot[C2H4]/d[C2H4] */
-        J[926] -= dqdci;              /* dwdot[C2H5OH]/d[C2H4] */
-        /* d()/d[C2H5OH] */
-        dqdci =  + k_f;
-        J[1559] += dqdci;             /* dwdot[H2O]/d[C2H5OH] */
-        J[1570] += dqdci;             /* dwdot[C2H4]/d[C2H5OH] */
-        J[1584] -= dqdci;             /* dwdot[C2H5OH]/d[C2H5OH] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[10][5]*dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[10][0]*dcdc_fac;
-        dqdc[8] = TB[10][1]*dcdc_fac - k_r*sc[19];
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[10][2]*dcdc_fac;
-        dqdc[12] = TB[10][3]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[10][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac - k_r*sc[8];
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac + k_f;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+8] += dqdc[k];
-            J[47*k+19] += dqdc[k];
-            J[47*k+33] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[8] += dcdc_fac;
+    Jmix[19] += dcdc_fac;
+    Jmix[33] -= dcdc_fac;
+    /* d()/d[AR] */
+    dqdci = (TB[10][5] - 1)*dcdc_fac;
+    J[55] += dqdci;               /* dwdot[H2O]/d[AR] */
+    J[66] += dqdci;               /* dwdot[C2H4]/d[AR] */
+    J[80] -= dqdci;               /* dwdot[C2H5OH]/d[AR] */
+    /* d()/d[H2] */
+    dqdci = (TB[10][0] - 1)*dcdc_fac;
+    J[337] += dqdci;              /* dwdot[H2O]/d[H2] */
+    J[348] += dqdci;              /* dwdot[C2H4]/d[H2] */
+    J[362] -= dqdci;              /* dwdot[C2H5OH]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[10][1] - 1)*dcdc_fac - k_r*sc[19];
+    J[384] += dqdci;              /* dwdot[H2O]/d[H2O] */
+    J[395] += dqdci;              /* dwdot[C2H4]/d[H2O] */
+    J[409] -= dqdci;              /* dwdot[C2H5OH]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[10][2] - 1)*dcdc_fac;
+    J[525] += dqdci;              /* dwdot[H2O]/d[CO] */
+    J[536] += dqdci;              /* dwdot[C2H4]/d[CO] */
+    J[550] -= dqdci;              /* dwdot[C2H5OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[10][3] - 1)*dcdc_fac;
+    J[572] += dqdci;              /* dwdot[H2O]/d[CO2] */
+    J[583] += dqdci;              /* dwdot[C2H4]/d[CO2] */
+    J[597] -= dqdci;              /* dwdot[C2H5OH]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[10][4] - 1)*dcdc_fac;
+    J[713] += dqdci;              /* dwdot[H2O]/d[CH4] */
+    J[724] += dqdci;              /* dwdot[C2H4]/d[CH4] */
+    J[738] -= dqdci;              /* dwdot[C2H5OH]/d[CH4] */
+    /* d()/d[C2H4] */
+    dqdci =  - k_r*sc[8];
+    J[901] += dqdci;              /* dwdot[H2O]/d[C2H4] */
+    J[912] += dqdci;              /* dwdot[C2H4]/d[C2H4] */
+    J[926] -= dqdci;              /* dwdot[C2H5OH]/d[C2H4] */
+    /* d()/d[C2H5OH] */
+    dqdci =  + k_f;
+    J[1559] += dqdci;             /* dwdot[H2O]/d[C2H5OH] */
+    J[1570] += dqdci;             /* dwdot[C2H4]/d[C2H5OH] */
+    J[1584] -= dqdci;             /* dwdot[C2H5OH]/d[C2H5OH] */
     J[2170] += dqdT; /* dwdot[H2O]/dT */
     J[2181] += dqdT; /* dwdot[C2H4]/dT */
     J[2195] -= dqdT; /* dwdot[C2H5OH]/dT */
@@ -20711,11 +20810,13 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[3]*sc[40];
-    k_f = prefactor_units[11] * fwd_A[11]
-                * exp(fwd_beta[11] * tc[0] - activation_units[11] * fwd_Ea[11] * invT);
+    k_f = k_f_s[11];
     dlnkfdT = fwd_beta[11] * invT + activation_units[11] * fwd_Ea[11] * invT2;
     /* pressure-fall-off */
-    k_0 = low_A[11] * exp(low_beta[11] * tc[0] - activation_units[11] * low_Ea[11] * invT);
+    x_0 = low_beta[11] * tc[0] - activation_units[11] * low_Ea[11] * invT;
+    x_0_s[0] = x_0;
+    e_0_s[0] = exp(x_0);
+    k_0 = low_A[11] * e_0_s[0];
     Pr = phase_units[11] * alpha / k_f * k_0;
     fPr = Pr / (1.0+Pr);
     dlnk0dT = low_beta[11] * invT + activation_units[11] * low_Ea[11] * invT2;
@@ -20728,16 +20829,18 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[11] == 4 ? exp(-troe_Tss[11] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[11]) > 1.e-100 ? -Fcent1/troe_Tsss[11] : 0.)
+      + (fabs(troe_Ts[11]) > 1.e-100 ? -Fcent2/troe_Ts[11] : 0.)
+      + (troe_len[11] == 4 ? Fcent3*troe_Tss[11]*invT2 : 0.) );
+    logFcent_s[1] = logFcent;
+    dlogFcentdT_s[1] = dlogFcentdT;
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[11]) > 1.e-100 ? -Fcent1/troe_Tsss[11] : 0.)
-      + (fabs(troe_Ts[11]) > 1.e-100 ? -Fcent2/troe_Ts[11] : 0.)
-      + (troe_len[11] == 4 ? Fcent3*troe_Tss[11]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -20745,7 +20848,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[39];
-    Kc = refCinv * exp(g_RT[3] - g_RT[39] + g_RT[40]);
+    Kc = Kc_s[11];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[40]) + (h_RT[39]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20763,76 +20866,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[40];
-        J[144] -= dqdci;              /* dwdot[H]/d[H] */
-        J[180] += dqdci;              /* dwdot[C3H4]/d[H] */
-        J[181] -= dqdci;              /* dwdot[C3H3]/d[H] */
-        /* d()/d[C3H4] */
-        dqdci =  - k_r;
-        J[1836] -= dqdci;             /* dwdot[H]/d[C3H4] */
-        J[1872] += dqdci;             /* dwdot[C3H4]/d[C3H4] */
-        J[1873] -= dqdci;             /* dwdot[C3H3]/d[C3H4] */
-        /* d()/d[C3H3] */
-        dqdci =  + k_f*sc[3];
-        J[1883] -= dqdci;             /* dwdot[H]/d[C3H3] */
-        J[1919] += dqdci;             /* dwdot[C3H4]/d[C3H3] */
-        J[1920] -= dqdci;             /* dwdot[C3H3]/d[C3H3] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac + k_f*sc[40];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac - k_r;
-        dqdc[40] = dcdc_fac + k_f*sc[3];
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+3] -= dqdc[k];
-            J[47*k+39] += dqdc[k];
-            J[47*k+40] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] -= dcdc_fac;
+    Jmix[39] += dcdc_fac;
+    Jmix[40] -= dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[40];
+    J[144] -= dqdci;              /* dwdot[H]/d[H] */
+    J[180] += dqdci;              /* dwdot[C3H4]/d[H] */
+    J[181] -= dqdci;              /* dwdot[C3H3]/d[H] */
+    /* d()/d[C3H4] */
+    dqdci =  - k_r;
+    J[1836] -= dqdci;             /* dwdot[H]/d[C3H4] */
+    J[1872] += dqdci;             /* dwdot[C3H4]/d[C3H4] */
+    J[1873] -= dqdci;             /* dwdot[C3H3]/d[C3H4] */
+    /* d()/d[C3H3] */
+    dqdci =  + k_f*sc[3];
+    J[1883] -= dqdci;             /* dwdot[H]/d[C3H3] */
+    J[1919] += dqdci;             /* dwdot[C3H4]/d[C3H3] */
+    J[1920] -= dqdci;             /* dwdot[C3H3]/d[C3H3] */
     J[2165] -= dqdT; /* dwdot[H]/dT */
     J[2201] += dqdT; /* dwdot[C3H4]/dT */
     J[2202] -= dqdT; /* dwdot[C3H3]/dT */
@@ -20844,8 +20896,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[3]*sc[39];
-    k_f = prefactor_units[12] * fwd_A[12]
-                * exp(fwd_beta[12] * tc[0] - activation_units[12] * fwd_Ea[12] * invT);
+    k_f = k_f_s[12];
     dlnkfdT = fwd_beta[12] * invT + activation_units[12] * fwd_Ea[12] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[12] * exp(low_beta[12] * tc[0] - activation_units[12] * low_Ea[12] * invT);
@@ -20861,16 +20912,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[12] == 4 ? exp(-troe_Tss[12] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[12]) > 1.e-100 ? -Fcent1/troe_Tsss[12] : 0.)
+      + (fabs(troe_Ts[12]) > 1.e-100 ? -Fcent2/troe_Ts[12] : 0.)
+      + (troe_len[12] == 4 ? Fcent3*troe_Tss[12]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[12]) > 1.e-100 ? -Fcent1/troe_Tsss[12] : 0.)
-      + (fabs(troe_Ts[12]) > 1.e-100 ? -Fcent2/troe_Ts[12] : 0.)
-      + (troe_len[12] == 4 ? Fcent3*troe_Tss[12]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -20878,7 +20929,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[41];
-    Kc = refCinv * exp(g_RT[3] + g_RT[39] - g_RT[41]);
+    Kc = Kc_s[12];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[39]) + (h_RT[41]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20896,76 +20947,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[39];
-        J[144] -= dqdci;              /* dwdot[H]/d[H] */
-        J[180] -= dqdci;              /* dwdot[C3H4]/d[H] */
-        J[182] += dqdci;              /* dwdot[C3H5]/d[H] */
-        /* d()/d[C3H4] */
-        dqdci =  + k_f*sc[3];
-        J[1836] -= dqdci;             /* dwdot[H]/d[C3H4] */
-        J[1872] -= dqdci;             /* dwdot[C3H4]/d[C3H4] */
-        J[1874] += dqdci;             /* dwdot[C3H5]/d[C3H4] */
-        /* d()/d[C3H5] */
-        dqdci =  - k_r;
-        J[1930] -= dqdci;             /* dwdot[H]/d[C3H5] */
-        J[1966] -= dqdci;             /* dwdot[C3H4]/d[C3H5] */
-        J[1968] += dqdci;             /* dwdot[C3H5]/d[C3H5] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac + k_f*sc[39];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac + k_f*sc[3];
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac - k_r;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+3] -= dqdc[k];
-            J[47*k+39] -= dqdc[k];
-            J[47*k+41] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] -= dcdc_fac;
+    Jmix[39] -= dcdc_fac;
+    Jmix[41] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[39];
+    J[144] -= dqdci;              /* dwdot[H]/d[H] */
+    J[180] -= dqdci;              /* dwdot[C3H4]/d[H] */
+    J[182] += dqdci;              /* dwdot[C3H5]/d[H] */
+    /* d()/d[C3H4] */
+    dqdci =  + k_f*sc[3];
+    J[1836] -= dqdci;             /* dwdot[H]/d[C3H4] */
+    J[1872] -= dqdci;             /* dwdot[C3H4]/d[C3H4] */
+    J[1874] += dqdci;             /* dwdot[C3H5]/d[C3H4] */
+    /* d()/d[C3H5] */
+    dqdci =  - k_r;
+    J[1930] -= dqdci;             /* dwdot[H]/d[C3H5] */
+    J[1966] -= dqdci;             /* dwdot[C3H4]/d[C3H5] */
+    J[1968] += dqdci;             /* dwdot[C3H5]/d[C3H5] */
     J[2165] -= dqdT; /* dwdot[H]/dT */
     J[2201] -= dqdT; /* dwdot[C3H4]/dT */
     J[2203] += dqdT; /* dwdot[C3H5]/dT */
@@ -20977,11 +20977,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[16]*sc[24];
-    k_f = prefactor_units[13] * fwd_A[13]
-                * exp(fwd_beta[13] * tc[0] - activation_units[13] * fwd_Ea[13] * invT);
+    k_f = k_f_s[13];
     dlnkfdT = fwd_beta[13] * invT + activation_units[13] * fwd_Ea[13] * invT2;
     /* pressure-fall-off */
-    k_0 = low_A[13] * exp(low_beta[13] * tc[0] - activation_units[13] * low_Ea[13] * invT);
+    x_0 = low_beta[13] * tc[0] - activation_units[13] * low_Ea[13] * invT;
+    k_0 = low_A[13] * (x_0 == x_0_s[0] ? e_0_s[0] : exp(x_0));
     Pr = phase_units[13] * alpha / k_f * k_0;
     fPr = Pr / (1.0+Pr);
     dlnk0dT = low_beta[13] * invT + activation_units[13] * low_Ea[13] * invT2;
@@ -20989,21 +20989,28 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogfPrdT = dlogPrdT / (1.0+Pr);
     /* Troe form */
     logPr = log10(Pr);
-    Fcent1 = (fabs(troe_Tsss[13]) > 1.e-100 ? (1.-troe_a[13])*exp(-T/troe_Tsss[13]) : 0.);
-    Fcent2 = (fabs(troe_Ts[13]) > 1.e-100 ? troe_a[13] * exp(-T/troe_Ts[13]) : 0.);
-    Fcent3 = (troe_len[13] == 4 ? exp(-troe_Tss[13] * invT) : 0.);
-    Fcent = Fcent1 + Fcent2 + Fcent3;
-    logFcent = log10(Fcent);
+    if (troe_a[13] == troe_a[11] && troe_Tsss[13] == troe_Tsss[11] && troe_Ts[13] == troe_Ts[11]
+        && troe_Tss[13] == troe_Tss[11] && troe_len[13] == troe_len[11]) {
+        logFcent = logFcent_s[1];
+        dlogFcentdT = dlogFcentdT_s[1];
+    }
+    else {
+        Fcent1 = (fabs(troe_Tsss[13]) > 1.e-100 ? (1.-troe_a[13])*exp(-T/troe_Tsss[13]) : 0.);
+        Fcent2 = (fabs(troe_Ts[13]) > 1.e-100 ? troe_a[13] * exp(-T/troe_Ts[13]) : 0.);
+        Fcent3 = (troe_len[13] == 4 ? exp(-troe_Tss[13] * invT) : 0.);
+        Fcent = Fcent1 + Fcent2 + Fcent3;
+        logFcent = log10(Fcent);
+        dlogFcentdT = log10e/Fcent*( 
+            (fabs(troe_Tsss[13]) > 1.e-100 ? -Fcent1/troe_Tsss[13] : 0.)
+          + (fabs(troe_Ts[13]) > 1.e-100 ? -Fcent2/troe_Ts[13] : 0.)
+          + (troe_len[13] == 4 ? Fcent3*troe_Tss[13]*invT2 : 0.) );
+    }
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[13]) > 1.e-100 ? -Fcent1/troe_Tsss[13] : 0.)
-      + (fabs(troe_Ts[13]) > 1.e-100 ? -Fcent2/troe_Ts[13] : 0.)
-      + (troe_len[13] == 4 ? Fcent3*troe_Tss[13]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -21011,7 +21018,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[41];
-    Kc = refCinv * exp(g_RT[16] + g_RT[24] - g_RT[41]);
+    Kc = Kc_s[13];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[24]) + (h_RT[41]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21029,76 +21036,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[24];
-        J[768] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[776] -= dqdci;              /* dwdot[C2H2]/d[CH3] */
-        J[793] += dqdci;              /* dwdot[C3H5]/d[CH3] */
-        /* d()/d[C2H2] */
-        dqdci =  + k_f*sc[16];
-        J[1144] -= dqdci;             /* dwdot[CH3]/d[C2H2] */
-        J[1152] -= dqdci;             /* dwdot[C2H2]/d[C2H2] */
-        J[1169] += dqdci;             /* dwdot[C3H5]/d[C2H2] */
-        /* d()/d[C3H5] */
-        dqdci =  - k_r;
-        J[1943] -= dqdci;             /* dwdot[CH3]/d[C3H5] */
-        J[1951] -= dqdci;             /* dwdot[C2H2]/d[C3H5] */
-        J[1968] += dqdci;             /* dwdot[C3H5]/d[C3H5] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac + k_f*sc[24];
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac + k_f*sc[16];
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac - k_r;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+16] -= dqdc[k];
-            J[47*k+24] -= dqdc[k];
-            J[47*k+41] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[16] -= dcdc_fac;
+    Jmix[24] -= dcdc_fac;
+    Jmix[41] += dcdc_fac;
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[24];
+    J[768] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[776] -= dqdci;              /* dwdot[C2H2]/d[CH3] */
+    J[793] += dqdci;              /* dwdot[C3H5]/d[CH3] */
+    /* d()/d[C2H2] */
+    dqdci =  + k_f*sc[16];
+    J[1144] -= dqdci;             /* dwdot[CH3]/d[C2H2] */
+    J[1152] -= dqdci;             /* dwdot[C2H2]/d[C2H2] */
+    J[1169] += dqdci;             /* dwdot[C3H5]/d[C2H2] */
+    /* d()/d[C3H5] */
+    dqdci =  - k_r;
+    J[1943] -= dqdci;             /* dwdot[CH3]/d[C3H5] */
+    J[1951] -= dqdci;             /* dwdot[C2H2]/d[C3H5] */
+    J[1968] += dqdci;             /* dwdot[C3H5]/d[C3H5] */
     J[2178] -= dqdT; /* dwdot[CH3]/dT */
     J[2186] -= dqdT; /* dwdot[C2H2]/dT */
     J[2203] += dqdT; /* dwdot[C3H5]/dT */
@@ -21107,11 +21063,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[14][0] - 1)*sc[1] + (TB[14][1] - 1)*sc[7] + (TB[14][2] - 1)*sc[8] + (TB[14][3] - 1)*sc[11] + (TB[14][4] - 1)*sc[12] + (TB[14][5] - 1)*sc[15] + (TB[14][6] - 1)*sc[22];
+    alpha = alpha_eff3;
     /* forward */
     phi_f = sc[3]*sc[41];
-    k_f = prefactor_units[14] * fwd_A[14]
-                * exp(fwd_beta[14] * tc[0] - activation_units[14] * fwd_Ea[14] * invT);
+    k_f = k_f_s[14];
     dlnkfdT = fwd_beta[14] * invT + activation_units[14] * fwd_Ea[14] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[14] * exp(low_beta[14] * tc[0] - activation_units[14] * low_Ea[14] * invT);
@@ -21127,16 +21082,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[14] == 4 ? exp(-troe_Tss[14] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[14]) > 1.e-100 ? -Fcent1/troe_Tsss[14] : 0.)
+      + (fabs(troe_Ts[14]) > 1.e-100 ? -Fcent2/troe_Ts[14] : 0.)
+      + (troe_len[14] == 4 ? Fcent3*troe_Tss[14]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[14]) > 1.e-100 ? -Fcent1/troe_Tsss[14] : 0.)
-      + (fabs(troe_Ts[14]) > 1.e-100 ? -Fcent2/troe_Ts[14] : 0.)
-      + (troe_len[14] == 4 ? Fcent3*troe_Tss[14]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -21144,7 +21099,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[42];
-    Kc = refCinv * exp(g_RT[3] + g_RT[41] - g_RT[42]);
+    Kc = Kc_s[14];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[41]) + (h_RT[42]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21162,111 +21117,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[14][0] - 1)*dcdc_fac;
-        J[50] -= dqdci;               /* dwdot[H]/d[AR] */
-        J[88] -= dqdci;               /* dwdot[C3H5]/d[AR] */
-        J[89] += dqdci;               /* dwdot[C3H6]/d[AR] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[41];
-        J[144] -= dqdci;              /* dwdot[H]/d[H] */
-        J[182] -= dqdci;              /* dwdot[C3H5]/d[H] */
-        J[183] += dqdci;              /* dwdot[C3H6]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[14][1] - 1)*dcdc_fac;
-        J[332] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[370] -= dqdci;              /* dwdot[C3H5]/d[H2] */
-        J[371] += dqdci;              /* dwdot[C3H6]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[14][2] - 1)*dcdc_fac;
-        J[379] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[417] -= dqdci;              /* dwdot[C3H5]/d[H2O] */
-        J[418] += dqdci;              /* dwdot[C3H6]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[14][3] - 1)*dcdc_fac;
-        J[520] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[558] -= dqdci;              /* dwdot[C3H5]/d[CO] */
-        J[559] += dqdci;              /* dwdot[C3H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[14][4] - 1)*dcdc_fac;
-        J[567] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[605] -= dqdci;              /* dwdot[C3H5]/d[CO2] */
-        J[606] += dqdci;              /* dwdot[C3H6]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[14][5] - 1)*dcdc_fac;
-        J[708] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[746] -= dqdci;              /* dwdot[C3H5]/d[CH4] */
-        J[747] += dqdci;              /* dwdot[C3H6]/d[CH4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[14][6] - 1)*dcdc_fac;
-        J[1037] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1075] -= dqdci;             /* dwdot[C3H5]/d[C2H6] */
-        J[1076] += dqdci;             /* dwdot[C3H6]/d[C2H6] */
-        /* d()/d[C3H5] */
-        dqdci =  + k_f*sc[3];
-        J[1930] -= dqdci;             /* dwdot[H]/d[C3H5] */
-        J[1968] -= dqdci;             /* dwdot[C3H5]/d[C3H5] */
-        J[1969] += dqdci;             /* dwdot[C3H6]/d[C3H5] */
-        /* d()/d[C3H6] */
-        dqdci =  - k_r;
-        J[1977] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[2015] -= dqdci;             /* dwdot[C3H5]/d[C3H6] */
-        J[2016] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[14][0]*dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac + k_f*sc[41];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[14][1]*dcdc_fac;
-        dqdc[8] = TB[14][2]*dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[14][3]*dcdc_fac;
-        dqdc[12] = TB[14][4]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[14][5]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = TB[14][6]*dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac + k_f*sc[3];
-        dqdc[42] = dcdc_fac - k_r;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+3] -= dqdc[k];
-            J[47*k+41] -= dqdc[k];
-            J[47*k+42] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] -= dcdc_fac;
+    Jmix[41] -= dcdc_fac;
+    Jmix[42] += dcdc_fac;
+    /* d()/d[AR] */
+    dqdci = (TB[14][0] - 1)*dcdc_fac;
+    J[50] -= dqdci;               /* dwdot[H]/d[AR] */
+    J[88] -= dqdci;               /* dwdot[C3H5]/d[AR] */
+    J[89] += dqdci;               /* dwdot[C3H6]/d[AR] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[41];
+    J[144] -= dqdci;              /* dwdot[H]/d[H] */
+    J[182] -= dqdci;              /* dwdot[C3H5]/d[H] */
+    J[183] += dqdci;              /* dwdot[C3H6]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[14][1] - 1)*dcdc_fac;
+    J[332] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[370] -= dqdci;              /* dwdot[C3H5]/d[H2] */
+    J[371] += dqdci;              /* dwdot[C3H6]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[14][2] - 1)*dcdc_fac;
+    J[379] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[417] -= dqdci;              /* dwdot[C3H5]/d[H2O] */
+    J[418] += dqdci;              /* dwdot[C3H6]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[14][3] - 1)*dcdc_fac;
+    J[520] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[558] -= dqdci;              /* dwdot[C3H5]/d[CO] */
+    J[559] += dqdci;              /* dwdot[C3H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[14][4] - 1)*dcdc_fac;
+    J[567] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[605] -= dqdci;              /* dwdot[C3H5]/d[CO2] */
+    J[606] += dqdci;              /* dwdot[C3H6]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[14][5] - 1)*dcdc_fac;
+    J[708] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[746] -= dqdci;              /* dwdot[C3H5]/d[CH4] */
+    J[747] += dqdci;              /* dwdot[C3H6]/d[CH4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[14][6] - 1)*dcdc_fac;
+    J[1037] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1075] -= dqdci;             /* dwdot[C3H5]/d[C2H6] */
+    J[1076] += dqdci;             /* dwdot[C3H6]/d[C2H6] */
+    /* d()/d[C3H5] */
+    dqdci =  + k_f*sc[3];
+    J[1930] -= dqdci;             /* dwdot[H]/d[C3H5] */
+    J[1968] -= dqdci;             /* dwdot[C3H5]/d[C3H5] */
+    J[1969] += dqdci;             /* dwdot[C3H6]/d[C3H5] */
+    /* d()/d[C3H6] */
+    dqdci =  - k_r;
+    J[1977] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[2015] -= dqdci;             /* dwdot[C3H5]/d[C3H6] */
+    J[2016] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
     J[2165] -= dqdT; /* dwdot[H]/dT */
     J[2203] -= dqdT; /* dwdot[C3H5]/dT */
     J[2204] += dqdT; /* dwdot[C3H6]/dT */
@@ -21275,11 +21179,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[15][0] - 1)*sc[1] + (TB[15][1] - 1)*sc[7] + (TB[15][2] - 1)*sc[8] + (TB[15][3] - 1)*sc[11] + (TB[15][4] - 1)*sc[12] + (TB[15][5] - 1)*sc[15] + (TB[15][6] - 1)*sc[22];
+    alpha = (memcmp(TB[15], TB[14], 7*sizeof(double)) == 0 ? alpha_eff3 : mixture + (TB[15][0] - 1)*sc[1] + (TB[15][1] - 1)*sc[7] + (TB[15][2] - 1)*sc[8] + (TB[15][3] - 1)*sc[11] + (TB[15][4] - 1)*sc[12] + (TB[15][5] - 1)*sc[15] + (TB[15][6] - 1)*sc[22]);
     /* forward */
     phi_f = sc[16]*sc[25];
-    k_f = prefactor_units[15] * fwd_A[15]
-                * exp(fwd_beta[15] * tc[0] - activation_units[15] * fwd_Ea[15] * invT);
+    k_f = k_f_s[15];
     dlnkfdT = fwd_beta[15] * invT + activation_units[15] * fwd_Ea[15] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[15] * exp(low_beta[15] * tc[0] - activation_units[15] * low_Ea[15] * invT);
@@ -21295,16 +21198,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[15] == 4 ? exp(-troe_Tss[15] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[15]) > 1.e-100 ? -Fcent1/troe_Tsss[15] : 0.)
+      + (fabs(troe_Ts[15]) > 1.e-100 ? -Fcent2/troe_Ts[15] : 0.)
+      + (troe_len[15] == 4 ? Fcent3*troe_Tss[15]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[15]) > 1.e-100 ? -Fcent1/troe_Tsss[15] : 0.)
-      + (fabs(troe_Ts[15]) > 1.e-100 ? -Fcent2/troe_Ts[15] : 0.)
-      + (troe_len[15] == 4 ? Fcent3*troe_Tss[15]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -21312,7 +21215,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[42];
-    Kc = refCinv * exp(g_RT[16] + g_RT[25] - g_RT[42]);
+    Kc = Kc_s[15];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[25]) + (h_RT[42]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21330,111 +21233,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[15][0] - 1)*dcdc_fac;
-        J[63] -= dqdci;               /* dwdot[CH3]/d[AR] */
-        J[72] -= dqdci;               /* dwdot[C2H3]/d[AR] */
-        J[89] += dqdci;               /* dwdot[C3H6]/d[AR] */
-        /* d()/d[H2] */
-        dqdci = (TB[15][1] - 1)*dcdc_fac;
-        J[345] -= dqdci;              /* dwdot[CH3]/d[H2] */
-        J[354] -= dqdci;              /* dwdot[C2H3]/d[H2] */
-        J[371] += dqdci;              /* dwdot[C3H6]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[15][2] - 1)*dcdc_fac;
-        J[392] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[401] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
-        J[418] += dqdci;              /* dwdot[C3H6]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[15][3] - 1)*dcdc_fac;
-        J[533] -= dqdci;              /* dwdot[CH3]/d[CO] */
-        J[542] -= dqdci;              /* dwdot[C2H3]/d[CO] */
-        J[559] += dqdci;              /* dwdot[C3H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[15][4] - 1)*dcdc_fac;
-        J[580] -= dqdci;              /* dwdot[CH3]/d[CO2] */
-        J[589] -= dqdci;              /* dwdot[C2H3]/d[CO2] */
-        J[606] += dqdci;              /* dwdot[C3H6]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[15][5] - 1)*dcdc_fac;
-        J[721] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[730] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
-        J[747] += dqdci;              /* dwdot[C3H6]/d[CH4] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[25];
-        J[768] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[777] -= dqdci;              /* dwdot[C2H3]/d[CH3] */
-        J[794] += dqdci;              /* dwdot[C3H6]/d[CH3] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[15][6] - 1)*dcdc_fac;
-        J[1050] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
-        J[1059] -= dqdci;             /* dwdot[C2H3]/d[C2H6] */
-        J[1076] += dqdci;             /* dwdot[C3H6]/d[C2H6] */
-        /* d()/d[C2H3] */
-        dqdci =  + k_f*sc[16];
-        J[1191] -= dqdci;             /* dwdot[CH3]/d[C2H3] */
-        J[1200] -= dqdci;             /* dwdot[C2H3]/d[C2H3] */
-        J[1217] += dqdci;             /* dwdot[C3H6]/d[C2H3] */
-        /* d()/d[C3H6] */
-        dqdci =  - k_r;
-        J[1990] -= dqdci;             /* dwdot[CH3]/d[C3H6] */
-        J[1999] -= dqdci;             /* dwdot[C2H3]/d[C3H6] */
-        J[2016] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[15][0]*dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[15][1]*dcdc_fac;
-        dqdc[8] = TB[15][2]*dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[15][3]*dcdc_fac;
-        dqdc[12] = TB[15][4]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[15][5]*dcdc_fac;
-        dqdc[16] = dcdc_fac + k_f*sc[25];
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = TB[15][6]*dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac + k_f*sc[16];
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac - k_r;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+16] -= dqdc[k];
-            J[47*k+25] -= dqdc[k];
-            J[47*k+42] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[16] -= dcdc_fac;
+    Jmix[25] -= dcdc_fac;
+    Jmix[42] += dcdc_fac;
+    /* d()/d[AR] */
+    dqdci = (TB[15][0] - 1)*dcdc_fac;
+    J[63] -= dqdci;               /* dwdot[CH3]/d[AR] */
+    J[72] -= dqdci;               /* dwdot[C2H3]/d[AR] */
+    J[89] += dqdci;               /* dwdot[C3H6]/d[AR] */
+    /* d()/d[H2] */
+    dqdci = (TB[15][1] - 1)*dcdc_fac;
+    J[345] -= dqdci;              /* dwdot[CH3]/d[H2] */
+    J[354] -= dqdci;              /* dwdot[C2H3]/d[H2] */
+    J[371] += dqdci;              /* dwdot[C3H6]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[15][2] - 1)*dcdc_fac;
+    J[392] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[401] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
+    J[418] += dqdci;              /* dwdot[C3H6]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[15][3] - 1)*dcdc_fac;
+    J[533] -= dqdci;              /* dwdot[CH3]/d[CO] */
+    J[542] -= dqdci;              /* dwdot[C2H3]/d[CO] */
+    J[559] += dqdci;              /* dwdot[C3H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[15][4] - 1)*dcdc_fac;
+    J[580] -= dqdci;              /* dwdot[CH3]/d[CO2] */
+    J[589] -= dqdci;              /* dwdot[C2H3]/d[CO2] */
+    J[606] += dqdci;              /* dwdot[C3H6]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[15][5] - 1)*dcdc_fac;
+    J[721] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[730] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
+    J[747] += dqdci;              /* dwdot[C3H6]/d[CH4] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[25];
+    J[768] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[777] -= dqdci;              /* dwdot[C2H3]/d[CH3] */
+    J[794] += dqdci;              /* dwdot[C3H6]/d[CH3] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[15][6] - 1)*dcdc_fac;
+    J[1050] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
+    J[1059] -= dqdci;             /* dwdot[C2H3]/d[C2H6] */
+    J[1076] += dqdci;             /* dwdot[C3H6]/d[C2H6] */
+    /* d()/d[C2H3] */
+    dqdci =  + k_f*sc[16];
+    J[1191] -= dqdci;             /* dwdot[CH3]/d[C2H3] */
+    J[1200] -= dqdci;             /* dwdot[C2H3]/d[C2H3] */
+    J[1217] += dqdci;             /* dwdot[C3H6]/d[C2H3] */
+    /* d()/d[C3H6] */
+    dqdci =  - k_r;
+    J[1990] -= dqdci;             /* dwdot[CH3]/d[C3H6] */
+    J[1999] -= dqdci;             /* dwdot[C2H3]/d[C3H6] */
+    J[2016] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
     J[2178] -= dqdT; /* dwdot[CH3]/dT */
     J[2187] -= dqdT; /* dwdot[C2H3]/dT */
     J[2204] += dqdT; /* dwdot[C3H6]/dT */
@@ -21446,8 +21298,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[43];
-    k_f = prefactor_units[16] * fwd_A[16]
-                * exp(fwd_beta[16] * tc[0] - activation_units[16] * fwd_Ea[16] * invT);
+    k_f = k_f_s[16];
     dlnkfdT = fwd_beta[16] * invT + activation_units[16] * fwd_Ea[16] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[16] * exp(low_beta[16] * tc[0] - activation_units[16] * low_Ea[16] * invT);
@@ -21463,16 +21314,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[16] == 4 ? exp(-troe_Tss[16] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[16]) > 1.e-100 ? -Fcent1/troe_Tsss[16] : 0.)
+      + (fabs(troe_Ts[16]) > 1.e-100 ? -Fcent2/troe_Ts[16] : 0.)
+      + (troe_len[16] == 4 ? Fcent3*troe_Tss[16]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[16]) > 1.e-100 ? -Fcent1/troe_Tsss[16] : 0.)
-      + (fabs(troe_Ts[16]) > 1.e-100 ? -Fcent2/troe_Ts[16] : 0.)
-      + (troe_len[16] == 4 ? Fcent3*troe_Tss[16]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -21480,7 +21331,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[16]*sc[21];
-    Kc = refC * exp(-g_RT[16] - g_RT[21] + g_RT[43]);
+    Kc = Kc_s[16];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[43]) + (h_RT[16] + h_RT[21]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21498,76 +21349,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[CH3] */
-        dqdci =  - k_r*sc[21];
-        J[768] += dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[773] += dqdci;              /* dwdot[C2H5]/d[CH3] */
-        J[795] -= dqdci;              /* dwdot[C3H8]/d[CH3] */
-        /* d()/d[C2H5] */
-        dqdci =  - k_r*sc[16];
-        J[1003] += dqdci;             /* dwdot[CH3]/d[C2H5] */
-        J[1008] += dqdci;             /* dwdot[C2H5]/d[C2H5] */
-        J[1030] -= dqdci;             /* dwdot[C3H8]/d[C2H5] */
-        /* d()/d[C3H8] */
-        dqdci =  + k_f;
-        J[2037] += dqdci;             /* dwdot[CH3]/d[C3H8] */
-        J[2042] += dqdci;             /* dwdot[C2H5]/d[C3H8] */
-        J[2064] -= dqdci;             /* dwdot[C3H8]/d[C3H8] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac - k_r*sc[21];
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac - k_r*sc[16];
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac + k_f;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+16] += dqdc[k];
-            J[47*k+21] += dqdc[k];
-            J[47*k+43] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[16] += dcdc_fac;
+    Jmix[21] += dcdc_fac;
+    Jmix[43] -= dcdc_fac;
+    /* d()/d[CH3] */
+    dqdci =  - k_r*sc[21];
+    J[768] += dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[773] += dqdci;              /* dwdot[C2H5]/d[CH3] */
+    J[795] -= dqdci;              /* dwdot[C3H8]/d[CH3] */
+    /* d()/d[C2H5] */
+    dqdci =  - k_r*sc[16];
+    J[1003] += dqdci;             /* dwdot[CH3]/d[C2H5] */
+    J[1008] += dqdci;             /* dwdot[C2H5]/d[C2H5] */
+    J[1030] -= dqdci;             /* dwdot[C3H8]/d[C2H5] */
+    /* d()/d[C3H8] */
+    dqdci =  + k_f;
+    J[2037] += dqdci;             /* dwdot[CH3]/d[C3H8] */
+    J[2042] += dqdci;             /* dwdot[C2H5]/d[C3H8] */
+    J[2064] -= dqdci;             /* dwdot[C3H8]/d[C3H8] */
     J[2178] += dqdT; /* dwdot[CH3]/dT */
     J[2183] += dqdT; /* dwdot[C2H5]/dT */
     J[2205] -= dqdT; /* dwdot[C3H8]/dT */
@@ -21576,11 +21376,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[17][0] - 1)*sc[1] + (TB[17][1] - 1)*sc[7] + (TB[17][2] - 1)*sc[8] + (TB[17][3] - 1)*sc[11] + (TB[17][4] - 1)*sc[12] + (TB[17][5] - 1)*sc[15] + (TB[17][6] - 1)*sc[22];
+    alpha = (memcmp(TB[17], TB[14], 7*sizeof(double)) == 0 ? alpha_eff3 : mixture + (TB[17][0] - 1)*sc[1] + (TB[17][1] - 1)*sc[7] + (TB[17][2] - 1)*sc[8] + (TB[17][3] - 1)*sc[11] + (TB[17][4] - 1)*sc[12] + (TB[17][5] - 1)*sc[15] + (TB[17][6] - 1)*sc[22]);
     /* forward */
     phi_f = sc[3]*sc[42];
-    k_f = prefactor_units[17] * fwd_A[17]
-                * exp(fwd_beta[17] * tc[0] - activation_units[17] * fwd_Ea[17] * invT);
+    k_f = k_f_s[17];
     dlnkfdT = fwd_beta[17] * invT + activation_units[17] * fwd_Ea[17] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[17] * exp(low_beta[17] * tc[0] - activation_units[17] * low_Ea[17] * invT);
@@ -21596,16 +21395,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[17] == 4 ? exp(-troe_Tss[17] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[17]) > 1.e-100 ? -Fcent1/troe_Tsss[17] : 0.)
+      + (fabs(troe_Ts[17]) > 1.e-100 ? -Fcent2/troe_Ts[17] : 0.)
+      + (troe_len[17] == 4 ? Fcent3*troe_Tss[17]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[17]) > 1.e-100 ? -Fcent1/troe_Tsss[17] : 0.)
-      + (fabs(troe_Ts[17]) > 1.e-100 ? -Fcent2/troe_Ts[17] : 0.)
-      + (troe_len[17] == 4 ? Fcent3*troe_Tss[17]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -21613,7 +21412,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[44];
-    Kc = refCinv * exp(g_RT[3] + g_RT[42] - g_RT[44]);
+    Kc = Kc_s[17];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[42]) + (h_RT[44]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21631,111 +21430,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[17][0] - 1)*dcdc_fac;
-        J[50] -= dqdci;               /* dwdot[H]/d[AR] */
-        J[89] -= dqdci;               /* dwdot[C3H6]/d[AR] */
-        J[91] += dqdci;               /* dwdot[I-C3H7]/d[AR] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[42];
-        J[144] -= dqdci;              /* dwdot[H]/d[H] */
-        J[183] -= dqdci;              /* dwdot[C3H6]/d[H] */
-        J[185] += dqdci;              /* dwdot[I-C3H7]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[17][1] - 1)*dcdc_fac;
-        J[332] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[371] -= dqdci;              /* dwdot[C3H6]/d[H2] */
-        J[373] += dqdci;              /* dwdot[I-C3H7]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[17][2] - 1)*dcdc_fac;
-        J[379] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[418] -= dqdci;              /* dwdot[C3H6]/d[H2O] */
-        J[420] += dqdci;              /* dwdot[I-C3H7]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[17][3] - 1)*dcdc_fac;
-        J[520] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[559] -= dqdci;              /* dwdot[C3H6]/d[CO] */
-        J[561] += dqdci;              /* dwdot[I-C3H7]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[17][4] - 1)*dcdc_fac;
-        J[567] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[606] -= dqdci;              /* dwdot[C3H6]/d[CO2] */
-        J[608] += dqdci;              /* dwdot[I-C3H7]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[17][5] - 1)*dcdc_fac;
-        J[708] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[747] -= dqdci;              /* dwdot[C3H6]/d[CH4] */
-        J[749] += dqdci;              /* dwdot[I-C3H7]/d[CH4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[17][6] - 1)*dcdc_fac;
-        J[1037] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1076] -= dqdci;             /* dwdot[C3H6]/d[C2H6] */
-        J[1078] += dqdci;             /* dwdot[I-C3H7]/d[C2H6] */
-        /* d()/d[C3H6] */
-        dqdci =  + k_f*sc[3];
-        J[1977] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[2016] -= dqdci;             /* dwdot[C3H6]/d[C3H6] */
-        J[2018] += dqdci;             /* dwdot[I-C3H7]/d[C3H6] */
-        /* d()/d[I-C3H7] */
-        dqdci =  - k_r;
-        J[2071] -= dqdci;             /* dwdot[H]/d[I-C3H7] */
-        J[2110] -= dqdci;             /* dwdot[C3H6]/d[I-C3H7] */
-        J[2112] += dqdci;             /* dwdot[I-C3H7]/d[I-C3H7] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[17][0]*dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac + k_f*sc[42];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[17][1]*dcdc_fac;
-        dqdc[8] = TB[17][2]*dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[17][3]*dcdc_fac;
-        dqdc[12] = TB[17][4]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[17][5]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = TB[17][6]*dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac + k_f*sc[3];
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac - k_r;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+3] -= dqdc[k];
-            J[47*k+42] -= dqdc[k];
-            J[47*k+44] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] -= dcdc_fac;
+    Jmix[42] -= dcdc_fac;
+    Jmix[44] += dcdc_fac;
+    /* d()/d[AR] */
+    dqdci = (TB[17][0] - 1)*dcdc_fac;
+    J[50] -= dqdci;               /* dwdot[H]/d[AR] */
+    J[89] -= dqdci;               /* dwdot[C3H6]/d[AR] */
+    J[91] += dqdci;               /* dwdot[I-C3H7]/d[AR] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[42];
+    J[144] -= dqdci;              /* dwdot[H]/d[H] */
+    J[183] -= dqdci;              /* dwdot[C3H6]/d[H] */
+    J[185] += dqdci;              /* dwdot[I-C3H7]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[17][1] - 1)*dcdc_fac;
+    J[332] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[371] -= dqdci;              /* dwdot[C3H6]/d[H2] */
+    J[373] += dqdci;              /* dwdot[I-C3H7]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[17][2] - 1)*dcdc_fac;
+    J[379] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[418] -= dqdci;              /* dwdot[C3H6]/d[H2O] */
+    J[420] += dqdci;              /* dwdot[I-C3H7]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[17][3] - 1)*dcdc_fac;
+    J[520] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[559] -= dqdci;              /* dwdot[C3H6]/d[CO] */
+    J[561] += dqdci;              /* dwdot[I-C3H7]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[17][4] - 1)*dcdc_fac;
+    J[567] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[606] -= dqdci;              /* dwdot[C3H6]/d[CO2] */
+    J[608] += dqdci;              /* dwdot[I-C3H7]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[17][5] - 1)*dcdc_fac;
+    J[708] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[747] -= dqdci;              /* dwdot[C3H6]/d[CH4] */
+    J[749] += dqdci;              /* dwdot[I-C3H7]/d[CH4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[17][6] - 1)*dcdc_fac;
+    J[1037] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1076] -= dqdci;             /* dwdot[C3H6]/d[C2H6] */
+    J[1078] += dqdci;             /* dwdot[I-C3H7]/d[C2H6] */
+    /* d()/d[C3H6] */
+    dqdci =  + k_f*sc[3];
+    J[1977] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[2016] -= dqdci;             /* dwdot[C3H6]/d[C3H6] */
+    J[2018] += dqdci;             /* dwdot[I-C3H7]/d[C3H6] */
+    /* d()/d[I-C3H7] */
+    dqdci =  - k_r;
+    J[2071] -= dqdci;             /* dwdot[H]/d[I-C3H7] */
+    J[2110] -= dqdci;             /* dwdot[C3H6]/d[I-C3H7] */
+    J[2112] += dqdci;             /* dwdot[I-C3H7]/d[I-C3H7] */
     J[2165] -= dqdT; /* dwdot[H]/dT */
     J[2204] -= dqdT; /* dwdot[C3H6]/dT */
     J[2206] += dqdT; /* dwdot[I-C3H7]/dT */
@@ -21747,8 +21495,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture;
     /* forward */
     phi_f = sc[45];
-    k_f = prefactor_units[18] * fwd_A[18]
-                * exp(fwd_beta[18] * tc[0] - activation_units[18] * fwd_Ea[18] * invT);
+    k_f = k_f_s[18];
     dlnkfdT = fwd_beta[18] * invT + activation_units[18] * fwd_Ea[18] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[18] * exp(low_beta[18] * tc[0] - activation_units[18] * low_Ea[18] * invT);
@@ -21764,16 +21511,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[18] == 4 ? exp(-troe_Tss[18] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[18]) > 1.e-100 ? -Fcent1/troe_Tsss[18] : 0.)
+      + (fabs(troe_Ts[18]) > 1.e-100 ? -Fcent2/troe_Ts[18] : 0.)
+      + (troe_len[18] == 4 ? Fcent3*troe_Tss[18]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[18]) > 1.e-100 ? -Fcent1/troe_Tsss[18] : 0.)
-      + (fabs(troe_Ts[18]) > 1.e-100 ? -Fcent2/troe_Ts[18] : 0.)
-      + (troe_len[18] == 4 ? Fcent3*troe_Tss[18]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -21781,7 +21528,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[16]*sc[19];
-    Kc = refC * exp(-g_RT[16] - g_RT[19] + g_RT[45]);
+    Kc = Kc_s[18];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[45]) + (h_RT[16] + h_RT[19]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21799,76 +21546,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[CH3] */
-        dqdci =  - k_r*sc[19];
-        J[768] += dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[771] += dqdci;              /* dwdot[C2H4]/d[CH3] */
-        J[797] -= dqdci;              /* dwdot[N-C3H7]/d[CH3] */
-        /* d()/d[C2H4] */
-        dqdci =  - k_r*sc[16];
-        J[909] += dqdci;              /* dwdot[CH3]/d[C2H4] */
-        J[912] += dqdci;              /* dwdot[C2H4]/d[C2H4] */
-        J[938] -= dqdci;              /* dwdot[N-C3H7]/d[C2H4] */
-        /* d()/d[N-C3H7] */
-        dqdci =  + k_f;
-        J[2131] += dqdci;             /* dwdot[CH3]/d[N-C3H7] */
-        J[2134] += dqdci;             /* dwdot[C2H4]/d[N-C3H7] */
-        J[2160] -= dqdci;             /* dwdot[N-C3H7]/d[N-C3H7] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac - k_r*sc[19];
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac - k_r*sc[16];
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac + k_f;
-        for (int k=0; k<46; k++) {
-            J[47*k+16] += dqdc[k];
-            J[47*k+19] += dqdc[k];
-            J[47*k+45] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[16] += dcdc_fac;
+    Jmix[19] += dcdc_fac;
+    Jmix[45] -= dcdc_fac;
+    /* d()/d[CH3] */
+    dqdci =  - k_r*sc[19];
+    J[768] += dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[771] += dqdci;              /* dwdot[C2H4]/d[CH3] */
+    J[797] -= dqdci;              /* dwdot[N-C3H7]/d[CH3] */
+    /* d()/d[C2H4] */
+    dqdci =  - k_r*sc[16];
+    J[909] += dqdci;              /* dwdot[CH3]/d[C2H4] */
+    J[912] += dqdci;              /* dwdot[C2H4]/d[C2H4] */
+    J[938] -= dqdci;              /* dwdot[N-C3H7]/d[C2H4] */
+    /* d()/d[N-C3H7] */
+    dqdci =  + k_f;
+    J[2131] += dqdci;             /* dwdot[CH3]/d[N-C3H7] */
+    J[2134] += dqdci;             /* dwdot[C2H4]/d[N-C3H7] */
+    J[2160] -= dqdci;             /* dwdot[N-C3H7]/d[N-C3H7] */
     J[2178] += dqdT; /* dwdot[CH3]/dT */
     J[2181] += dqdT; /* dwdot[C2H4]/dT */
     J[2207] -= dqdT; /* dwdot[N-C3H7]/dT */
@@ -21877,11 +21573,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[19][0] - 1)*sc[1] + (TB[19][1] - 1)*sc[7] + (TB[19][2] - 1)*sc[8] + (TB[19][3] - 1)*sc[11] + (TB[19][4] - 1)*sc[12] + (TB[19][5] - 1)*sc[15] + (TB[19][6] - 1)*sc[22];
+    alpha = (memcmp(TB[19], TB[14], 7*sizeof(double)) == 0 ? alpha_eff3 : mixture + (TB[19][0] - 1)*sc[1] + (TB[19][1] - 1)*sc[7] + (TB[19][2] - 1)*sc[8] + (TB[19][3] - 1)*sc[11] + (TB[19][4] - 1)*sc[12] + (TB[19][5] - 1)*sc[15] + (TB[19][6] - 1)*sc[22]);
     /* forward */
     phi_f = sc[3]*sc[42];
-    k_f = prefactor_units[19] * fwd_A[19]
-                * exp(fwd_beta[19] * tc[0] - activation_units[19] * fwd_Ea[19] * invT);
+    k_f = k_f_s[19];
     dlnkfdT = fwd_beta[19] * invT + activation_units[19] * fwd_Ea[19] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[19] * exp(low_beta[19] * tc[0] - activation_units[19] * low_Ea[19] * invT);
@@ -21897,16 +21592,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[19] == 4 ? exp(-troe_Tss[19] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[19]) > 1.e-100 ? -Fcent1/troe_Tsss[19] : 0.)
+      + (fabs(troe_Ts[19]) > 1.e-100 ? -Fcent2/troe_Ts[19] : 0.)
+      + (troe_len[19] == 4 ? Fcent3*troe_Tss[19]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[19]) > 1.e-100 ? -Fcent1/troe_Tsss[19] : 0.)
-      + (fabs(troe_Ts[19]) > 1.e-100 ? -Fcent2/troe_Ts[19] : 0.)
-      + (troe_len[19] == 4 ? Fcent3*troe_Tss[19]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -21914,7 +21609,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[45];
-    Kc = refCinv * exp(g_RT[3] + g_RT[42] - g_RT[45]);
+    Kc = Kc_s[19];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[42]) + (h_RT[45]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21932,111 +21627,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[19][0] - 1)*dcdc_fac;
-        J[50] -= dqdci;               /* dwdot[H]/d[AR] */
-        J[89] -= dqdci;               /* dwdot[C3H6]/d[AR] */
-        J[92] += dqdci;               /* dwdot[N-C3H7]/d[AR] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[42];
-        J[144] -= dqdci;              /* dwdot[H]/d[H] */
-        J[183] -= dqdci;              /* dwdot[C3H6]/d[H] */
-        J[186] += dqdci;              /* dwdot[N-C3H7]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[19][1] - 1)*dcdc_fac;
-        J[332] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[371] -= dqdci;              /* dwdot[C3H6]/d[H2] */
-        J[374] += dqdci;              /* dwdot[N-C3H7]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[19][2] - 1)*dcdc_fac;
-        J[379] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[418] -= dqdci;              /* dwdot[C3H6]/d[H2O] */
-        J[421] += dqdci;              /* dwdot[N-C3H7]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[19][3] - 1)*dcdc_fac;
-        J[520] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[559] -= dqdci;              /* dwdot[C3H6]/d[CO] */
-        J[562] += dqdci;              /* dwdot[N-C3H7]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[19][4] - 1)*dcdc_fac;
-        J[567] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[606] -= dqdci;              /* dwdot[C3H6]/d[CO2] */
-        J[609] += dqdci;              /* dwdot[N-C3H7]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[19][5] - 1)*dcdc_fac;
-        J[708] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[747] -= dqdci;              /* dwdot[C3H6]/d[CH4] */
-        J[750] += dqdci;              /* dwdot[N-C3H7]/d[CH4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[19][6] - 1)*dcdc_fac;
-        J[1037] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1076] -= dqdci;             /* dwdot[C3H6]/d[C2H6] */
-        J[1079] += dqdci;             /* dwdot[N-C3H7]/d[C2H6] */
-        /* d()/d[C3H6] */
-        dqdci =  + k_f*sc[3];
-        J[1977] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[2016] -= dqdci;             /* dwdot[C3H6]/d[C3H6] */
-        J[2019] += dqdci;             /* dwdot[N-C3H7]/d[C3H6] */
-        /* d()/d[N-C3H7] */
-        dqdci =  - k_r;
-        J[2118] -= dqdci;             /* dwdot[H]/d[N-C3H7] */
-        J[2157] -= dqdci;             /* dwdot[C3H6]/d[N-C3H7] */
-        J[2160] += dqdci;             /* dwdot[N-C3H7]/d[N-C3H7] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[19][0]*dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac + k_f*sc[42];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[19][1]*dcdc_fac;
-        dqdc[8] = TB[19][2]*dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[19][3]*dcdc_fac;
-        dqdc[12] = TB[19][4]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[19][5]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = TB[19][6]*dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac + k_f*sc[3];
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac - k_r;
-        for (int k=0; k<46; k++) {
-            J[47*k+3] -= dqdc[k];
-            J[47*k+42] -= dqdc[k];
-            J[47*k+45] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] -= dcdc_fac;
+    Jmix[42] -= dcdc_fac;
+    Jmix[45] += dcdc_fac;
+    /* d()/d[AR] */
+    dqdci = (TB[19][0] - 1)*dcdc_fac;
+    J[50] -= dqdci;               /* dwdot[H]/d[AR] */
+    J[89] -= dqdci;               /* dwdot[C3H6]/d[AR] */
+    J[92] += dqdci;               /* dwdot[N-C3H7]/d[AR] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[42];
+    J[144] -= dqdci;              /* dwdot[H]/d[H] */
+    J[183] -= dqdci;              /* dwdot[C3H6]/d[H] */
+    J[186] += dqdci;              /* dwdot[N-C3H7]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[19][1] - 1)*dcdc_fac;
+    J[332] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[371] -= dqdci;              /* dwdot[C3H6]/d[H2] */
+    J[374] += dqdci;              /* dwdot[N-C3H7]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[19][2] - 1)*dcdc_fac;
+    J[379] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[418] -= dqdci;              /* dwdot[C3H6]/d[H2O] */
+    J[421] += dqdci;              /* dwdot[N-C3H7]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[19][3] - 1)*dcdc_fac;
+    J[520] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[559] -= dqdci;              /* dwdot[C3H6]/d[CO] */
+    J[562] += dqdci;              /* dwdot[N-C3H7]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[19][4] - 1)*dcdc_fac;
+    J[567] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[606] -= dqdci;              /* dwdot[C3H6]/d[CO2] */
+    J[609] += dqdci;              /* dwdot[N-C3H7]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[19][5] - 1)*dcdc_fac;
+    J[708] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[747] -= dqdci;              /* dwdot[C3H6]/d[CH4] */
+    J[750] += dqdci;              /* dwdot[N-C3H7]/d[CH4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[19][6] - 1)*dcdc_fac;
+    J[1037] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1076] -= dqdci;             /* dwdot[C3H6]/d[C2H6] */
+    J[1079] += dqdci;             /* dwdot[N-C3H7]/d[C2H6] */
+    /* d()/d[C3H6] */
+    dqdci =  + k_f*sc[3];
+    J[1977] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[2016] -= dqdci;             /* dwdot[C3H6]/d[C3H6] */
+    J[2019] += dqdci;             /* dwdot[N-C3H7]/d[C3H6] */
+    /* d()/d[N-C3H7] */
+    dqdci =  - k_r;
+    J[2118] -= dqdci;             /* dwdot[H]/d[N-C3H7] */
+    J[2157] -= dqdci;             /* dwdot[C3H6]/d[N-C3H7] */
+    J[2160] += dqdci;             /* dwdot[N-C3H7]/d[N-C3H7] */
     J[2165] -= dqdT; /* dwdot[H]/dT */
     J[2204] -= dqdT; /* dwdot[C3H6]/dT */
     J[2207] += dqdT; /* dwdot[N-C3H7]/dT */
@@ -22045,11 +21689,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[20][0] - 1)*sc[7] + (TB[20][1] - 1)*sc[8] + (TB[20][2] - 1)*sc[11] + (TB[20][3] - 1)*sc[12] + (TB[20][4] - 1)*sc[15] + (TB[20][5] - 1)*sc[1];
+    alpha = (memcmp(TB[20], TB[8], 6*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[20][0] - 1)*sc[7] + (TB[20][1] - 1)*sc[8] + (TB[20][2] - 1)*sc[11] + (TB[20][3] - 1)*sc[12] + (TB[20][4] - 1)*sc[15] + (TB[20][5] - 1)*sc[1]);
     /* forward */
     phi_f = sc[37];
-    k_f = prefactor_units[20] * fwd_A[20]
-                * exp(fwd_beta[20] * tc[0] - activation_units[20] * fwd_Ea[20] * invT);
+    k_f = k_f_s[20];
     dlnkfdT = fwd_beta[20] * invT + activation_units[20] * fwd_Ea[20] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[20] * exp(low_beta[20] * tc[0] - activation_units[20] * low_Ea[20] * invT);
@@ -22064,7 +21707,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = 0.0;
     /* reverse */
     phi_r = sc[11]*sc[16];
-    Kc = refC * exp(-g_RT[11] - g_RT[16] + g_RT[37]);
+    Kc = Kc_s[20];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[37]) + (h_RT[11] + h_RT[16]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22082,101 +21725,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[20][5] - 1)*dcdc_fac;
-        J[58] += dqdci;               /* dwdot[CO]/d[AR] */
-        J[63] += dqdci;               /* dwdot[CH3]/d[AR] */
-        J[84] -= dqdci;               /* dwdot[CH3CO]/d[AR] */
-        /* d()/d[H2] */
-        dqdci = (TB[20][0] - 1)*dcdc_fac;
-        J[340] += dqdci;              /* dwdot[CO]/d[H2] */
-        J[345] += dqdci;              /* dwdot[CH3]/d[H2] */
-        J[366] -= dqdci;              /* dwdot[CH3CO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[20][1] - 1)*dcdc_fac;
-        J[387] += dqdci;              /* dwdot[CO]/d[H2O] */
-        J[392] += dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[413] -= dqdci;              /* dwdot[CH3CO]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[20][2] - 1)*dcdc_fac - k_r*sc[16];
-        J[528] += dqdci;              /* dwdot[CO]/d[CO] */
-        J[533] += dqdci;              /* dwdot[CH3]/d[CO] */
-        J[554] -= dqdci;              /* dwdot[CH3CO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[20][3] - 1)*dcdc_fac;
-        J[575] += dqdci;              /* dwdot[CO]/d[CO2] */
-        J[580] += dqdci;              /* dwdot[CH3]/d[CO2] */
-        J[601] -= dqdci;              /* dwdot[CH3CO]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[20][4] - 1)*dcdc_fac;
-        J[716] += dqdci;              /* dwdot[CO]/d[CH4] */
-        J[721] += dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[742] -= dqdci;              /* dwdot[CH3CO]/d[CH4] */
-        /* d()/d[CH3] */
-        dqdci =  - k_r*sc[11];
-        J[763] += dqdci;              /* dwdot[CO]/d[CH3] */
-        J[768] += dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[789] -= dqdci;              /* dwdot[CH3CO]/d[CH3] */
-        /* d()/d[CH3CO] */
-        dqdci =  + k_f;
-        J[1750] += dqdci;             /* dwdot[CO]/d[CH3CO] */
-        J[1755] += dqdci;             /* dwdot[CH3]/d[CH3CO] */
-        J[1776] -= dqdci;             /* dwdot[CH3CO]/d[CH3CO] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[20][5]*dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[20][0]*dcdc_fac;
-        dqdc[8] = TB[20][1]*dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[20][2]*dcdc_fac - k_r*sc[16];
-        dqdc[12] = TB[20][3]*dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[20][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac - k_r*sc[11];
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac + k_f;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+11] += dqdc[k];
-            J[47*k+16] += dqdc[k];
-            J[47*k+37] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[11] += dcdc_fac;
+    Jmix[16] += dcdc_fac;
+    Jmix[37] -= dcdc_fac;
+    /* d()/d[AR] */
+    dqdci = (TB[20][5] - 1)*dcdc_fac;
+    J[58] += dqdci;               /* dwdot[CO]/d[AR] */
+    J[63] += dqdci;               /* dwdot[CH3]/d[AR] */
+    J[84] -= dqdci;               /* dwdot[CH3CO]/d[AR] */
+    /* d()/d[H2] */
+    dqdci = (TB[20][0] - 1)*dcdc_fac;
+    J[340] += dqdci;              /* dwdot[CO]/d[H2] */
+    J[345] += dqdci;              /* dwdot[CH3]/d[H2] */
+    J[366] -= dqdci;              /* dwdot[CH3CO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[20][1] - 1)*dcdc_fac;
+    J[387] += dqdci;              /* dwdot[CO]/d[H2O] */
+    J[392] += dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[413] -= dqdci;              /* dwdot[CH3CO]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[20][2] - 1)*dcdc_fac - k_r*sc[16];
+    J[528] += dqdci;              /* dwdot[CO]/d[CO] */
+    J[533] += dqdci;              /* dwdot[CH3]/d[CO] */
+    J[554] -= dqdci;              /* dwdot[CH3CO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[20][3] - 1)*dcdc_fac;
+    J[575] += dqdci;              /* dwdot[CO]/d[CO2] */
+    J[580] += dqdci;              /* dwdot[CH3]/d[CO2] */
+    J[601] -= dqdci;              /* dwdot[CH3CO]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[20][4] - 1)*dcdc_fac;
+    J[716] += dqdci;              /* dwdot[CO]/d[CH4] */
+    J[721] += dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[742] -= dqdci;              /* dwdot[CH3CO]/d[CH4] */
+    /* d()/d[CH3] */
+    dqdci =  - k_r*sc[11];
+    J[763] += dqdci;              /* dwdot[CO]/d[CH3] */
+    J[768] += dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[789] -= dqdci;              /* dwdot[CH3CO]/d[CH3] */
+    /* d()/d[CH3CO] */
+    dqdci =  + k_f;
+    J[1750] += dqdci;             /* dwdot[CO]/d[CH3CO] */
+    J[1755] += dqdci;             /* dwdot[CH3]/d[CH3CO] */
+    J[1776] -= dqdci;             /* dwdot[CH3CO]/d[CH3CO] */
     J[2173] += dqdT; /* dwdot[CO]/dT */
     J[2178] += dqdT; /* dwdot[CH3]/dT */
     J[2199] -= dqdT; /* dwdot[CH3CO]/dT */
@@ -22187,12 +21779,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[21][0] - 1)*sc[7] + (TB[21][1] - 1)*sc[8] + (TB[21][2] - 1)*sc[11] + (TB[21][3] - 1)*sc[12] + (TB[21][4] - 1)*sc[1] + (TB[21][5] - 1)*sc[2];
     /* forward */
     phi_f = sc[3]*sc[3];
-    k_f = prefactor_units[21] * fwd_A[21]
-                * exp(fwd_beta[21] * tc[0] - activation_units[21] * fwd_Ea[21] * invT);
+    k_f = k_f_s[21];
     dlnkfdT = fwd_beta[21] * invT + activation_units[21] * fwd_Ea[21] * invT2;
     /* reverse */
     phi_r = sc[7];
-    Kc = refCinv * exp(g_RT[3] + g_RT[3] - g_RT[7]);
+    Kc = Kc_s[21];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[3]) + (h_RT[7]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22206,88 +21797,37 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[21][4] - 1)*q_nocor;
-        J[50] += -2 * dqdci;          /* dwdot[H]/d[AR] */
-        J[54] += dqdci;               /* dwdot[H2]/d[AR] */
-        /* d()/d[HE] */
-        dqdci = (TB[21][5] - 1)*q_nocor;
-        J[97] += -2 * dqdci;          /* dwdot[H]/d[HE] */
-        J[101] += dqdci;              /* dwdot[H2]/d[HE] */
-        /* d()/d[H] */
-        dqdci =  + k_f*2*sc[3];
-        J[144] += -2 * dqdci;         /* dwdot[H]/d[H] */
-        J[148] += dqdci;              /* dwdot[H2]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[21][0] - 1)*q_nocor - k_r;
-        J[332] += -2 * dqdci;         /* dwdot[H]/d[H2] */
-        J[336] += dqdci;              /* dwdot[H2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[21][1] - 1)*q_nocor;
-        J[379] += -2 * dqdci;         /* dwdot[H]/d[H2O] */
-        J[383] += dqdci;              /* dwdot[H2]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[21][2] - 1)*q_nocor;
-        J[520] += -2 * dqdci;         /* dwdot[H]/d[CO] */
-        J[524] += dqdci;              /* dwdot[H2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[21][3] - 1)*q_nocor;
-        J[567] += -2 * dqdci;         /* dwdot[H]/d[CO2] */
-        J[571] += dqdci;              /* dwdot[H2]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[21][4];
-        dqdc[2] = TB[21][5];
-        dqdc[3] = dcdc_fac + k_f*2*sc[3];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[21][0] - k_r;
-        dqdc[8] = TB[21][1];
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[21][2];
-        dqdc[12] = TB[21][3];
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+3] += -2 * dqdc[k];
-            J[47*k+7] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] += -2 * q_nocor;
+    Jmix[7] += q_nocor;
+    /* d()/d[AR] */
+    dqdci = (TB[21][4] - 1)*q_nocor;
+    J[50] += -2 * dqdci;          /* dwdot[H]/d[AR] */
+    J[54] += dqdci;               /* dwdot[H2]/d[AR] */
+    /* d()/d[HE] */
+    dqdci = (TB[21][5] - 1)*q_nocor;
+    J[97] += -2 * dqdci;          /* dwdot[H]/d[HE] */
+    J[101] += dqdci;              /* dwdot[H2]/d[HE] */
+    /* d()/d[H] */
+    dqdci =  + k_f*2*sc[3];
+    J[144] += -2 * dqdci;         /* dwdot[H]/d[H] */
+    J[148] += dqdci;              /* dwdot[H2]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[21][0] - 1)*q_nocor - k_r;
+    J[332] += -2 * dqdci;         /* dwdot[H]/d[H2] */
+    J[336] += dqdci;              /* dwdot[H2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[21][1] - 1)*q_nocor;
+    J[379] += -2 * dqdci;         /* dwdot[H]/d[H2O] */
+    J[383] += dqdci;              /* dwdot[H2]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[21][2] - 1)*q_nocor;
+    J[520] += -2 * dqdci;         /* dwdot[H]/d[CO] */
+    J[524] += dqdci;              /* dwdot[H2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[21][3] - 1)*q_nocor;
+    J[567] += -2 * dqdci;         /* dwdot[H]/d[CO2] */
+    J[571] += dqdci;              /* dwdot[H2]/d[CO2] */
     J[2165] += -2 * dqdT; /* dwdot[H]/dT */
     J[2169] += dqdT; /* dwdot[H2]/dT */
 
@@ -22297,12 +21837,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[22][0] - 1)*sc[7] + (TB[22][1] - 1)*sc[8] + (TB[22][2] - 1)*sc[11] + (TB[22][3] - 1)*sc[12] + (TB[22][4] - 1)*sc[1] + (TB[22][5] - 1)*sc[2];
     /* forward */
     phi_f = sc[3]*sc[5];
-    k_f = prefactor_units[22] * fwd_A[22]
-                * exp(fwd_beta[22] * tc[0] - activation_units[22] * fwd_Ea[22] * invT);
+    k_f = k_f_s[22];
     dlnkfdT = fwd_beta[22] * invT + activation_units[22] * fwd_Ea[22] * invT2;
     /* reverse */
     phi_r = sc[8];
-    Kc = refCinv * exp(g_RT[3] + g_RT[5] - g_RT[8]);
+    Kc = Kc_s[22];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[5]) + (h_RT[8]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22317,101 +21856,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[22][4] - 1)*q_nocor;
-        J[50] -= dqdci;               /* dwdot[H]/d[AR] */
-        J[52] -= dqdci;               /* dwdot[OH]/d[AR] */
-        J[55] += dqdci;               /* dwdot[H2O]/d[AR] */
-        /* d()/d[HE] */
-        dqdci = (TB[22][5] - 1)*q_nocor;
-        J[97] -= dqdci;               /* dwdot[H]/d[HE] */
-        J[99] -= dqdci;               /* dwdot[OH]/d[HE] */
-        J[102] += dqdci;              /* dwdot[H2O]/d[HE] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[5];
-        J[144] -= dqdci;              /* dwdot[H]/d[H] */
-        J[146] -= dqdci;              /* dwdot[OH]/d[H] */
-        J[149] += dqdci;              /* dwdot[H2O]/d[H] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*sc[3];
-        J[238] -= dqdci;              /* dwdot[H]/d[OH] */
-        J[240] -= dqdci;              /* dwdot[OH]/d[OH] */
-        J[243] += dqdci;              /* dwdot[H2O]/d[OH] */
-        /* d()/d[H2] */
-        dqdci = (TB[22][0] - 1)*q_nocor;
-        J[332] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[334] -= dqdci;              /* dwdot[OH]/d[H2] */
-        J[337] += dqdci;              /* dwdot[H2O]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[22][1] - 1)*q_nocor - k_r;
-        J[379] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[381] -= dqdci;              /* dwdot[OH]/d[H2O] */
-        J[384] += dqdci;              /* dwdot[H2O]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[22][2] - 1)*q_nocor;
-        J[520] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[522] -= dqdci;              /* dwdot[OH]/d[CO] */
-        J[525] += dqdci;              /* dwdot[H2O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[22][3] - 1)*q_nocor;
-        J[567] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[569] -= dqdci;              /* dwdot[OH]/d[CO2] */
-        J[572] += dqdci;              /* dwdot[H2O]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[22][4];
-        dqdc[2] = TB[22][5];
-        dqdc[3] = dcdc_fac + k_f*sc[5];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac + k_f*sc[3];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[22][0];
-        dqdc[8] = TB[22][1] - k_r;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[22][2];
-        dqdc[12] = TB[22][3];
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+3] -= dqdc[k];
-            J[47*k+5] -= dqdc[k];
-            J[47*k+8] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] -= q_nocor;
+    Jmix[5] -= q_nocor;
+    Jmix[8] += q_nocor;
+    /* d()/d[AR] */
+    dqdci = (TB[22][4] - 1)*q_nocor;
+    J[50] -= dqdci;               /* dwdot[H]/d[AR] */
+    J[52] -= dqdci;               /* dwdot[OH]/d[AR] */
+    J[55] += dqdci;               /* dwdot[H2O]/d[AR] */
+    /* d()/d[HE] */
+    dqdci = (TB[22][5] - 1)*q_nocor;
+    J[97] -= dqdci;               /* dwdot[H]/d[HE] */
+    J[99] -= dqdci;               /* dwdot[OH]/d[HE] */
+    J[102] += dqdci;              /* dwdot[H2O]/d[HE] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[5];
+    J[144] -= dqdci;              /* dwdot[H]/d[H] */
+    J[146] -= dqdci;              /* dwdot[OH]/d[H] */
+    J[149] += dqdci;              /* dwdot[H2O]/d[H] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*sc[3];
+    J[238] -= dqdci;              /* dwdot[H]/d[OH] */
+    J[240] -= dqdci;              /* dwdot[OH]/d[OH] */
+    J[243] += dqdci;              /* dwdot[H2O]/d[OH] */
+    /* d()/d[H2] */
+    dqdci = (TB[22][0] - 1)*q_nocor;
+    J[332] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[334] -= dqdci;              /* dwdot[OH]/d[H2] */
+    J[337] += dqdci;              /* dwdot[H2O]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[22][1] - 1)*q_nocor - k_r;
+    J[379] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[381] -= dqdci;              /* dwdot[OH]/d[H2O] */
+    J[384] += dqdci;              /* dwdot[H2O]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[22][2] - 1)*q_nocor;
+    J[520] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[522] -= dqdci;              /* dwdot[OH]/d[CO] */
+    J[525] += dqdci;              /* dwdot[H2O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[22][3] - 1)*q_nocor;
+    J[567] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[569] -= dqdci;              /* dwdot[OH]/d[CO2] */
+    J[572] += dqdci;              /* dwdot[H2O]/d[CO2] */
     J[2165] -= dqdT; /* dwdot[H]/dT */
     J[2167] -= dqdT; /* dwdot[OH]/dT */
     J[2170] += dqdT; /* dwdot[H2O]/dT */
@@ -22422,12 +21910,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[23][0] - 1)*sc[7] + (TB[23][1] - 1)*sc[8] + (TB[23][2] - 1)*sc[11] + (TB[23][3] - 1)*sc[12] + (TB[23][4] - 1)*sc[1] + (TB[23][5] - 1)*sc[2];
     /* forward */
     phi_f = sc[6]*sc[6];
-    k_f = prefactor_units[23] * fwd_A[23]
-                * exp(fwd_beta[23] * tc[0] - activation_units[23] * fwd_Ea[23] * invT);
+    k_f = k_f_s[23];
     dlnkfdT = fwd_beta[23] * invT + activation_units[23] * fwd_Ea[23] * invT2;
     /* reverse */
     phi_r = sc[4];
-    Kc = refCinv * exp(-g_RT[4] + g_RT[6] + g_RT[6]);
+    Kc = Kc_s[23];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[6]) + (h_RT[4]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22441,107 +21928,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[23][4] - 1)*q_nocor;
-        J[51] += dqdci;               /* dwdot[O2]/d[AR] */
-        J[53] += -2 * dqdci;          /* dwdot[O]/d[AR] */
-        /* d()/d[HE] */
-        dqdci = (TB[23][5] - 1)*q_nocor;
-        J[98] += dqdci;               /* dwdot[O2]/d[HE] */
-        J[100] += -2 * dqdci;         /* dwdot[O]/d[HE] */
-        /* d()/d[O2] */
-        dqdci =  - k_r;
-        J[192] += dqdci;              /* dwdot[O2]/d[O2] */
-        J[194] += -2 * dqdci;         /* dwdot[O]/d[O2] */
-        /* d()/d[O] */
-        dqdci =  + k_f*2*sc[6];
-        J[286] += dqdci;              /* dwdot[O2]/d[O] */
-        J[288] += -2 * dqdci;         /* dwdot[O]/d[O] */
-        /* d()/d[H2] */
-        dqdci = (TB[23][0] - 1)*q_nocor;
-        J[333] += dqdci;              /* dwdot[O2]/d[H2] */
-        J[335] += -2 * dqdci;         /* dwdot[O]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[23][1] - 1)*q_nocor;
-        J[380] += dqdci;              /* dwdot[O2]/d[H2O] */
-        J[382] += -2 * dqdci;         /* dwdot[O]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[23][2] - 1)*q_nocor;
-        J[521] += dqdci;              /* dwdot[O2]/d[CO] */
-        J[523] += -2 * dqdci;         /* dwdot[O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[23][3] - 1)*q_nocor;
-        J[568] += dqdci;              /* dwdot[O2]/d[CO2] */
-        J[570] += -2 * dqdci;         /* dwdot[O]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[23][4];
-        dqdc[2] = TB[23][5];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac - k_r;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac + k_f*2*sc[6];
-        dqdc[7] = TB[23][0];
-        dqdc[8] = TB[23][1];
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[23][2];
-        dqdc[12] = TB[23][3];
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+4] += dqdc[k];
-            J[47*k+6] += -2 * dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[4] += q_nocor;
+    Jmix[6] += -2 * q_nocor;
+    /* d()/d[AR] */
+    dqdci = (TB[23][4] - 1)*q_nocor;
+    J[51] += dqdci;               /* dwdot[O2]/d[AR] */
+    J[53] += -2 * dqdci;          /* dwdot[O]/d[AR] */
+    /* d()/d[HE] */
+    dqdci = (TB[23][5] - 1)*q_nocor;
+    J[98] += dqdci;               /* dwdot[O2]/d[HE] */
+    J[100] += -2 * dqdci;         /* dwdot[O]/d[HE] */
+    /* d()/d[O2] */
+    dqdci =  - k_r;
+    J[192] += dqdci;              /* dwdot[O2]/d[O2] */
+    J[194] += -2 * dqdci;         /* dwdot[O]/d[O2] */
+    /* d()/d[O] */
+    dqdci =  + k_f*2*sc[6];
+    J[286] += dqdci;              /* dwdot[O2]/d[O] */
+    J[288] += -2 * dqdci;         /* dwdot[O]/d[O] */
+    /* d()/d[H2] */
+    dqdci = (TB[23][0] - 1)*q_nocor;
+    J[333] += dqdci;              /* dwdot[O2]/d[H2] */
+    J[335] += -2 * dqdci;         /* dwdot[O]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[23][1] - 1)*q_nocor;
+    J[380] += dqdci;              /* dwdot[O2]/d[H2O] */
+    J[382] += -2 * dqdci;         /* dwdot[O]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[23][2] - 1)*q_nocor;
+    J[521] += dqdci;              /* dwdot[O2]/d[CO] */
+    J[523] += -2 * dqdci;         /* dwdot[O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[23][3] - 1)*q_nocor;
+    J[568] += dqdci;              /* dwdot[O2]/d[CO2] */
+    J[570] += -2 * dqdci;         /* dwdot[O]/d[CO2] */
     J[2166] += dqdT; /* dwdot[O2]/dT */
     J[2168] += -2 * dqdT; /* dwdot[O]/dT */
 
     /*reaction 25: H + O + M <=> OH + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[24][0] - 1)*sc[7] + (TB[24][1] - 1)*sc[8] + (TB[24][2] - 1)*sc[1] + (TB[24][3] - 1)*sc[2] + (TB[24][4] - 1)*sc[11] + (TB[24][5] - 1)*sc[12];
+    alpha = alpha_eff4;
     /* forward */
     phi_f = sc[3]*sc[6];
-    k_f = prefactor_units[24] * fwd_A[24]
-                * exp(fwd_beta[24] * tc[0] - activation_units[24] * fwd_Ea[24] * invT);
+    k_f = k_f_s[24];
     dlnkfdT = fwd_beta[24] * invT + activation_units[24] * fwd_Ea[24] * invT2;
     /* reverse */
     phi_r = sc[5];
-    Kc = refCinv * exp(g_RT[3] - g_RT[5] + g_RT[6]);
+    Kc = Kc_s[24];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[6]) + (h_RT[5]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22556,106 +21991,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[24][2] - 1)*q_nocor;
-        J[50] -= dqdci;               /* dwdot[H]/d[AR] */
-        J[52] += dqdci;               /* dwdot[OH]/d[AR] */
-        J[53] -= dqdci;               /* dwdot[O]/d[AR] */
-        /* d()/d[HE] */
-        dqdci = (TB[24][3] - 1)*q_nocor;
-        J[97] -= dqdci;               /* dwdot[H]/d[HE] */
-        J[99] += dqdci;               /* dwdot[OH]/d[HE] */
-        J[100] -= dqdci;              /* dwdot[O]/d[HE] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[6];
-        J[144] -= dqdci;              /* dwdot[H]/d[H] */
-        J[146] += dqdci;              /* dwdot[OH]/d[H] */
-        J[147] -= dqdci;              /* dwdot[O]/d[H] */
-        /* d()/d[OH] */
-        dqdci =  - k_r;
-        J[238] -= dqdci;              /* dwdot[H]/d[OH] */
-        J[240] += dqdci;              /* dwdot[OH]/d[OH] */
-        J[241] -= dqdci;              /* dwdot[O]/d[OH] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[3];
-        J[285] -= dqdci;              /* dwdot[H]/d[O] */
-        J[287] += dqdci;              /* dwdot[OH]/d[O] */
-        J[288] -= dqdci;              /* dwdot[O]/d[O] */
-        /* d()/d[H2] */
-        dqdci = (TB[24][0] - 1)*q_nocor;
-        J[332] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[334] += dqdci;              /* dwdot[OH]/d[H2] */
-        J[335] -= dqdci;              /* dwdot[O]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[24][1] - 1)*q_nocor;
-        J[379] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[381] += dqdci;              /* dwdot[OH]/d[H2O] */
-        J[382] -= dqdci;              /* dwdot[O]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[24][4] - 1)*q_nocor;
-        J[520] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[522] += dqdci;              /* dwdot[OH]/d[CO] */
-        J[523] -= dqdci;              /* dwdot[O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[24][5] - 1)*q_nocor;
-        J[567] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[569] += dqdci;              /* dwdot[OH]/d[CO2] */
-        J[570] -= dqdci;              /* dwdot[O]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[24][2];
-        dqdc[2] = TB[24][3];
-        dqdc[3] = dcdc_fac + k_f*sc[6];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac - k_r;
-        dqdc[6] = dcdc_fac + k_f*sc[3];
-        dqdc[7] = TB[24][0];
-        dqdc[8] = TB[24][1];
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[24][4];
-        dqdc[12] = TB[24][5];
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+3] -= dqdc[k];
-            J[47*k+5] += dqdc[k];
-            J[47*k+6] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] -= q_nocor;
+    Jmix[5] += q_nocor;
+    Jmix[6] -= q_nocor;
+    /* d()/d[AR] */
+    dqdci = (TB[24][2] - 1)*q_nocor;
+    J[50] -= dqdci;               /* dwdot[H]/d[AR] */
+    J[52] += dqdci;               /* dwdot[OH]/d[AR] */
+    J[53] -= dqdci;               /* dwdot[O]/d[AR] */
+    /* d()/d[HE] */
+    dqdci = (TB[24][3] - 1)*q_nocor;
+    J[97] -= dqdci;               /* dwdot[H]/d[HE] */
+    J[99] += dqdci;               /* dwdot[OH]/d[HE] */
+    J[100] -= dqdci;              /* dwdot[O]/d[HE] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[6];
+    J[144] -= dqdci;              /* dwdot[H]/d[H] */
+    J[146] += dqdci;              /* dwdot[OH]/d[H] */
+    J[147] -= dqdci;              /* dwdot[O]/d[H] */
+    /* d()/d[OH] */
+    dqdci =  - k_r;
+    J[238] -= dqdci;              /* dwdot[H]/d[OH] */
+    J[240] += dqdci;              /* dwdot[OH]/d[OH] */
+    J[241] -= dqdci;              /* dwdot[O]/d[OH] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[3];
+    J[285] -= dqdci;              /* dwdot[H]/d[O] */
+    J[287] += dqdci;              /* dwdot[OH]/d[O] */
+    J[288] -= dqdci;              /* dwdot[O]/d[O] */
+    /* d()/d[H2] */
+    dqdci = (TB[24][0] - 1)*q_nocor;
+    J[332] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[334] += dqdci;              /* dwdot[OH]/d[H2] */
+    J[335] -= dqdci;              /* dwdot[O]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[24][1] - 1)*q_nocor;
+    J[379] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[381] += dqdci;              /* dwdot[OH]/d[H2O] */
+    J[382] -= dqdci;              /* dwdot[O]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[24][4] - 1)*q_nocor;
+    J[520] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[522] += dqdci;              /* dwdot[OH]/d[CO] */
+    J[523] -= dqdci;              /* dwdot[O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[24][5] - 1)*q_nocor;
+    J[567] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[569] += dqdci;              /* dwdot[OH]/d[CO2] */
+    J[570] -= dqdci;              /* dwdot[O]/d[CO2] */
     J[2165] -= dqdT; /* dwdot[H]/dT */
     J[2167] += dqdT; /* dwdot[OH]/dT */
     J[2168] -= dqdT; /* dwdot[O]/dT */
@@ -22663,15 +22047,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 26: O + OH + M <=> HO2 + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[25][0] - 1)*sc[7] + (TB[25][1] - 1)*sc[8] + (TB[25][2] - 1)*sc[1] + (TB[25][3] - 1)*sc[2] + (TB[25][4] - 1)*sc[11] + (TB[25][5] - 1)*sc[12];
+    alpha = (memcmp(TB[25], TB[24], 6*sizeof(double)) == 0 ? alpha_eff4 : mixture + (TB[25][0] - 1)*sc[7] + (TB[25][1] - 1)*sc[8] + (TB[25][2] - 1)*sc[1] + (TB[25][3] - 1)*sc[2] + (TB[25][4] - 1)*sc[11] + (TB[25][5] - 1)*sc[12]);
     /* forward */
     phi_f = sc[5]*sc[6];
-    k_f = prefactor_units[25] * fwd_A[25]
-                * exp(fwd_beta[25] * tc[0] - activation_units[25] * fwd_Ea[25] * invT);
+    k_f = k_f_s[25];
     dlnkfdT = fwd_beta[25] * invT + activation_units[25] * fwd_Ea[25] * invT2;
     /* reverse */
     phi_r = sc[9];
-    Kc = refCinv * exp(g_RT[5] + g_RT[6] - g_RT[9]);
+    Kc = Kc_s[25];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[6]) + (h_RT[9]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22686,106 +22069,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[25][2] - 1)*q_nocor;
-        J[52] -= dqdci;               /* dwdot[OH]/d[AR] */
-        J[53] -= dqdci;               /* dwdot[O]/d[AR] */
-        J[56] += dqdci;               /* dwdot[HO2]/d[AR] */
-        /* d()/d[HE] */
-        dqdci = (TB[25][3] - 1)*q_nocor;
-        J[99] -= dqdci;               /* dwdot[OH]/d[HE] */
-        J[100] -= dqdci;              /* dwdot[O]/d[HE] */
-        J[103] += dqdci;              /* dwdot[HO2]/d[HE] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*sc[6];
-        J[240] -= dqdci;              /* dwdot[OH]/d[OH] */
-        J[241] -= dqdci;              /* dwdot[O]/d[OH] */
-        J[244] += dqdci;              /* dwdot[HO2]/d[OH] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[5];
-        J[287] -= dqdci;              /* dwdot[OH]/d[O] */
-        J[288] -= dqdci;              /* dwdot[O]/d[O] */
-        J[291] += dqdci;              /* dwdot[HO2]/d[O] */
-        /* d()/d[H2] */
-        dqdci = (TB[25][0] - 1)*q_nocor;
-        J[334] -= dqdci;              /* dwdot[OH]/d[H2] */
-        J[335] -= dqdci;              /* dwdot[O]/d[H2] */
-        J[338] += dqdci;              /* dwdot[HO2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[25][1] - 1)*q_nocor;
-        J[381] -= dqdci;              /* dwdot[OH]/d[H2O] */
-        J[382] -= dqdci;              /* dwdot[O]/d[H2O] */
-        J[385] += dqdci;              /* dwdot[HO2]/d[H2O] */
-        /* d()/d[HO2] */
-        dqdci =  - k_r;
-        J[428] -= dqdci;              /* dwdot[OH]/d[HO2] */
-        J[429] -= dqdci;              /* dwdot[O]/d[HO2] */
-        J[432] += dqdci;              /* dwdot[HO2]/d[HO2] */
-        /* d()/d[CO] */
-        dqdci = (TB[25][4] - 1)*q_nocor;
-        J[522] -= dqdci;              /* dwdot[OH]/d[CO] */
-        J[523] -= dqdci;              /* dwdot[O]/d[CO] */
-        J[526] += dqdci;              /* dwdot[HO2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[25][5] - 1)*q_nocor;
-        J[569] -= dqdci;              /* dwdot[OH]/d[CO2] */
-        J[570] -= dqdci;              /* dwdot[O]/d[CO2] */
-        J[573] += dqdci;              /* dwdot[HO2]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[25][2];
-        dqdc[2] = TB[25][3];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac + k_f*sc[6];
-        dqdc[6] = dcdc_fac + k_f*sc[5];
-        dqdc[7] = TB[25][0];
-        dqdc[8] = TB[25][1];
-        dqdc[9] = dcdc_fac - k_r;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[25][4];
-        dqdc[12] = TB[25][5];
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+5] -= dqdc[k];
-            J[47*k+6] -= dqdc[k];
-            J[47*k+9] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[5] -= q_nocor;
+    Jmix[6] -= q_nocor;
+    Jmix[9] += q_nocor;
+    /* d()/d[AR] */
+    dqdci = (TB[25][2] - 1)*q_nocor;
+    J[52] -= dqdci;               /* dwdot[OH]/d[AR] */
+    J[53] -= dqdci;               /* dwdot[O]/d[AR] */
+    J[56] += dqdci;               /* dwdot[HO2]/d[AR] */
+    /* d()/d[HE] */
+    dqdci = (TB[25][3] - 1)*q_nocor;
+    J[99] -= dqdci;               /* dwdot[OH]/d[HE] */
+    J[100] -= dqdci;              /* dwdot[O]/d[HE] */
+    J[103] += dqdci;              /* dwdot[HO2]/d[HE] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*sc[6];
+    J[240] -= dqdci;              /* dwdot[OH]/d[OH] */
+    J[241] -= dqdci;              /* dwdot[O]/d[OH] */
+    J[244] += dqdci;              /* dwdot[HO2]/d[OH] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[5];
+    J[287] -= dqdci;              /* dwdot[OH]/d[O] */
+    J[288] -= dqdci;              /* dwdot[O]/d[O] */
+    J[291] += dqdci;              /* dwdot[HO2]/d[O] */
+    /* d()/d[H2] */
+    dqdci = (TB[25][0] - 1)*q_nocor;
+    J[334] -= dqdci;              /* dwdot[OH]/d[H2] */
+    J[335] -= dqdci;              /* dwdot[O]/d[H2] */
+    J[338] += dqdci;              /* dwdot[HO2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[25][1] - 1)*q_nocor;
+    J[381] -= dqdci;              /* dwdot[OH]/d[H2O] */
+    J[382] -= dqdci;              /* dwdot[O]/d[H2O] */
+    J[385] += dqdci;              /* dwdot[HO2]/d[H2O] */
+    /* d()/d[HO2] */
+    dqdci =  - k_r;
+    J[428] -= dqdci;              /* dwdot[OH]/d[HO2] */
+    J[429] -= dqdci;              /* dwdot[O]/d[HO2] */
+    J[432] += dqdci;              /* dwdot[HO2]/d[HO2] */
+    /* d()/d[CO] */
+    dqdci = (TB[25][4] - 1)*q_nocor;
+    J[522] -= dqdci;              /* dwdot[OH]/d[CO] */
+    J[523] -= dqdci;              /* dwdot[O]/d[CO] */
+    J[526] += dqdci;              /* dwdot[HO2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[25][5] - 1)*q_nocor;
+    J[569] -= dqdci;              /* dwdot[OH]/d[CO2] */
+    J[570] -= dqdci;              /* dwdot[O]/d[CO2] */
+    J[573] += dqdci;              /* dwdot[HO2]/d[CO2] */
     J[2167] -= dqdT; /* dwdot[OH]/dT */
     J[2168] -= dqdT; /* dwdot[O]/dT */
     J[2171] += dqdT; /* dwdot[HO2]/dT */
@@ -22796,12 +22128,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[26][0] - 1)*sc[7] + (TB[26][1] - 1)*sc[8] + (TB[26][2] - 1)*sc[11] + (TB[26][3] - 1)*sc[12];
     /* forward */
     phi_f = sc[13];
-    k_f = prefactor_units[26] * fwd_A[26]
-                * exp(fwd_beta[26] * tc[0] - activation_units[26] * fwd_Ea[26] * invT);
+    k_f = k_f_s[26];
     dlnkfdT = fwd_beta[26] * invT + activation_units[26] * fwd_Ea[26] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[11];
-    Kc = refC * exp(-g_RT[3] - g_RT[11] + g_RT[13]);
+    Kc = Kc_s[26];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13]) + (h_RT[3] + h_RT[11]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22816,91 +22147,40 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[11];
-        J[144] += dqdci;              /* dwdot[H]/d[H] */
-        J[152] += dqdci;              /* dwdot[CO]/d[H] */
-        J[154] -= dqdci;              /* dwdot[HCO]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[26][0] - 1)*q_nocor;
-        J[332] += dqdci;              /* dwdot[H]/d[H2] */
-        J[340] += dqdci;              /* dwdot[CO]/d[H2] */
-        J[342] -= dqdci;              /* dwdot[HCO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[26][1] - 1)*q_nocor;
-        J[379] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[387] += dqdci;              /* dwdot[CO]/d[H2O] */
-        J[389] -= dqdci;              /* dwdot[HCO]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[26][2] - 1)*q_nocor - k_r*sc[3];
-        J[520] += dqdci;              /* dwdot[H]/d[CO] */
-        J[528] += dqdci;              /* dwdot[CO]/d[CO] */
-        J[530] -= dqdci;              /* dwdot[HCO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[26][3] - 1)*q_nocor;
-        J[567] += dqdci;              /* dwdot[H]/d[CO2] */
-        J[575] += dqdci;              /* dwdot[CO]/d[CO2] */
-        J[577] -= dqdci;              /* dwdot[HCO]/d[CO2] */
-        /* d()/d[HCO] */
-        dqdci =  + k_f;
-        J[614] += dqdci;              /* dwdot[H]/d[HCO] */
-        J[622] += dqdci;              /* dwdot[CO]/d[HCO] */
-        J[624] -= dqdci;              /* dwdot[HCO]/d[HCO] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac - k_r*sc[11];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[26][0];
-        dqdc[8] = TB[26][1];
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[26][2] - k_r*sc[3];
-        dqdc[12] = TB[26][3];
-        dqdc[13] = dcdc_fac + k_f;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+3] += dqdc[k];
-            J[47*k+11] += dqdc[k];
-            J[47*k+13] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] += q_nocor;
+    Jmix[11] += q_nocor;
+    Jmix[13] -= q_nocor;
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[11];
+    J[144] += dqdci;              /* dwdot[H]/d[H] */
+    J[152] += dqdci;              /* dwdot[CO]/d[H] */
+    J[154] -= dqdci;              /* dwdot[HCO]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[26][0] - 1)*q_nocor;
+    J[332] += dqdci;              /* dwdot[H]/d[H2] */
+    J[340] += dqdci;              /* dwdot[CO]/d[H2] */
+    J[342] -= dqdci;              /* dwdot[HCO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[26][1] - 1)*q_nocor;
+    J[379] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[387] += dqdci;              /* dwdot[CO]/d[H2O] */
+    J[389] -= dqdci;              /* dwdot[HCO]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[26][2] - 1)*q_nocor - k_r*sc[3];
+    J[520] += dqdci;              /* dwdot[H]/d[CO] */
+    J[528] += dqdci;              /* dwdot[CO]/d[CO] */
+    J[530] -= dqdci;              /* dwdot[HCO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[26][3] - 1)*q_nocor;
+    J[567] += dqdci;              /* dwdot[H]/d[CO2] */
+    J[575] += dqdci;              /* dwdot[CO]/d[CO2] */
+    J[577] -= dqdci;              /* dwdot[HCO]/d[CO2] */
+    /* d()/d[HCO] */
+    dqdci =  + k_f;
+    J[614] += dqdci;              /* dwdot[H]/d[HCO] */
+    J[622] += dqdci;              /* dwdot[CO]/d[HCO] */
+    J[624] -= dqdci;              /* dwdot[HCO]/d[HCO] */
     J[2165] += dqdT; /* dwdot[H]/dT */
     J[2173] += dqdT; /* dwdot[CO]/dT */
     J[2175] -= dqdT; /* dwdot[HCO]/dT */
@@ -22911,12 +22191,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[27][0] - 1)*sc[7] + (TB[27][1] - 1)*sc[8] + (TB[27][2] - 1)*sc[11] + (TB[27][3] - 1)*sc[12];
     /* forward */
     phi_f = sc[18];
-    k_f = prefactor_units[27] * fwd_A[27]
-                * exp(fwd_beta[27] * tc[0] - activation_units[27] * fwd_Ea[27] * invT);
+    k_f = k_f_s[27];
     dlnkfdT = fwd_beta[27] * invT + activation_units[27] * fwd_Ea[27] * invT2;
     /* reverse */
     phi_r = sc[17];
-    Kc = exp(-g_RT[17] + g_RT[18]);
+    Kc = Kc_s[27];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[18]) + (h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22930,99 +22209,47 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[27][0] - 1)*q_nocor;
-        J[346] += dqdci;              /* dwdot[T-CH2]/d[H2] */
-        J[347] -= dqdci;              /* dwdot[S-CH2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[27][1] - 1)*q_nocor;
-        J[393] += dqdci;              /* dwdot[T-CH2]/d[H2O] */
-        J[394] -= dqdci;              /* dwdot[S-CH2]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[27][2] - 1)*q_nocor;
-        J[534] += dqdci;              /* dwdot[T-CH2]/d[CO] */
-        J[535] -= dqdci;              /* dwdot[S-CH2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[27][3] - 1)*q_nocor;
-        J[581] += dqdci;              /* dwdot[T-CH2]/d[CO2] */
-        J[582] -= dqdci;              /* dwdot[S-CH2]/d[CO2] */
-        /* d()/d[T-CH2] */
-        dqdci =  - k_r;
-        J[816] += dqdci;              /* dwdot[T-CH2]/d[T-CH2] */
-        J[817] -= dqdci;              /* dwdot[S-CH2]/d[T-CH2] */
-        /* d()/d[S-CH2] */
-        dqdci =  + k_f;
-        J[863] += dqdci;              /* dwdot[T-CH2]/d[S-CH2] */
-        J[864] -= dqdci;              /* dwdot[S-CH2]/d[S-CH2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[27][0];
-        dqdc[8] = TB[27][1];
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[27][2];
-        dqdc[12] = TB[27][3];
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac - k_r;
-        dqdc[18] = dcdc_fac + k_f;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+17] += dqdc[k];
-            J[47*k+18] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[17] += q_nocor;
+    Jmix[18] -= q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[27][0] - 1)*q_nocor;
+    J[346] += dqdci;              /* dwdot[T-CH2]/d[H2] */
+    J[347] -= dqdci;              /* dwdot[S-CH2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[27][1] - 1)*q_nocor;
+    J[393] += dqdci;              /* dwdot[T-CH2]/d[H2O] */
+    J[394] -= dqdci;              /* dwdot[S-CH2]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[27][2] - 1)*q_nocor;
+    J[534] += dqdci;              /* dwdot[T-CH2]/d[CO] */
+    J[535] -= dqdci;              /* dwdot[S-CH2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[27][3] - 1)*q_nocor;
+    J[581] += dqdci;              /* dwdot[T-CH2]/d[CO2] */
+    J[582] -= dqdci;              /* dwdot[S-CH2]/d[CO2] */
+    /* d()/d[T-CH2] */
+    dqdci =  - k_r;
+    J[816] += dqdci;              /* dwdot[T-CH2]/d[T-CH2] */
+    J[817] -= dqdci;              /* dwdot[S-CH2]/d[T-CH2] */
+    /* d()/d[S-CH2] */
+    dqdci =  + k_f;
+    J[863] += dqdci;              /* dwdot[T-CH2]/d[S-CH2] */
+    J[864] -= dqdci;              /* dwdot[S-CH2]/d[S-CH2] */
     J[2179] += dqdT; /* dwdot[T-CH2]/dT */
     J[2180] -= dqdT; /* dwdot[S-CH2]/dT */
 
     /*reaction 29: CH3O + M <=> CH2O + H + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[28][0] - 1)*sc[7] + (TB[28][1] - 1)*sc[8] + (TB[28][2] - 1)*sc[15] + (TB[28][3] - 1)*sc[11] + (TB[28][4] - 1)*sc[12] + (TB[28][5] - 1)*sc[1];
+    alpha = (memcmp(TB[28], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[28][0] - 1)*sc[7] + (TB[28][1] - 1)*sc[8] + (TB[28][2] - 1)*sc[15] + (TB[28][3] - 1)*sc[11] + (TB[28][4] - 1)*sc[12] + (TB[28][5] - 1)*sc[1]);
     /* forward */
     phi_f = sc[20];
-    k_f = prefactor_units[28] * fwd_A[28]
-                * exp(fwd_beta[28] * tc[0] - activation_units[28] * fwd_Ea[28] * invT);
+    k_f = k_f_s[28];
     dlnkfdT = fwd_beta[28] * invT + activation_units[28] * fwd_Ea[28] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[14];
-    Kc = refC * exp(-g_RT[3] - g_RT[14] + g_RT[20]);
+    Kc = Kc_s[28];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[20]) + (h_RT[3] + h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23037,106 +22264,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[28][5] - 1)*q_nocor;
-        J[50] += dqdci;               /* dwdot[H]/d[AR] */
-        J[61] += dqdci;               /* dwdot[CH2O]/d[AR] */
-        J[67] -= dqdci;               /* dwdot[CH3O]/d[AR] */
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[14];
-        J[144] += dqdci;              /* dwdot[H]/d[H] */
-        J[155] += dqdci;              /* dwdot[CH2O]/d[H] */
-        J[161] -= dqdci;              /* dwdot[CH3O]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[28][0] - 1)*q_nocor;
-        J[332] += dqdci;              /* dwdot[H]/d[H2] */
-        J[343] += dqdci;              /* dwdot[CH2O]/d[H2] */
-        J[349] -= dqdci;              /* dwdot[CH3O]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[28][1] - 1)*q_nocor;
-        J[379] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[390] += dqdci;              /* dwdot[CH2O]/d[H2O] */
-        J[396] -= dqdci;              /* dwdot[CH3O]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[28][3] - 1)*q_nocor;
-        J[520] += dqdci;              /* dwdot[H]/d[CO] */
-        J[531] += dqdci;              /* dwdot[CH2O]/d[CO] */
-        J[537] -= dqdci;              /* dwdot[CH3O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[28][4] - 1)*q_nocor;
-        J[567] += dqdci;              /* dwdot[H]/d[CO2] */
-        J[578] += dqdci;              /* dwdot[CH2O]/d[CO2] */
-        J[584] -= dqdci;              /* dwdot[CH3O]/d[CO2] */
-        /* d()/d[CH2O] */
-        dqdci =  - k_r*sc[3];
-        J[661] += dqdci;              /* dwdot[H]/d[CH2O] */
-        J[672] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
-        J[678] -= dqdci;              /* dwdot[CH3O]/d[CH2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[28][2] - 1)*q_nocor;
-        J[708] += dqdci;              /* dwdot[H]/d[CH4] */
-        J[719] += dqdci;              /* dwdot[CH2O]/d[CH4] */
-        J[725] -= dqdci;              /* dwdot[CH3O]/d[CH4] */
-        /* d()/d[CH3O] */
-        dqdci =  + k_f;
-        J[943] += dqdci;              /* dwdot[H]/d[CH3O] */
-        J[954] += dqdci;              /* dwdot[CH2O]/d[CH3O] */
-        J[960] -= dqdci;              /* dwdot[CH3O]/d[CH3O] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[28][5];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac - k_r*sc[14];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[28][0];
-        dqdc[8] = TB[28][1];
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[28][3];
-        dqdc[12] = TB[28][4];
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac - k_r*sc[3];
-        dqdc[15] = TB[28][2];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac + k_f;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+3] += dqdc[k];
-            J[47*k+14] += dqdc[k];
-            J[47*k+20] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] += q_nocor;
+    Jmix[14] += q_nocor;
+    Jmix[20] -= q_nocor;
+    /* d()/d[AR] */
+    dqdci = (TB[28][5] - 1)*q_nocor;
+    J[50] += dqdci;               /* dwdot[H]/d[AR] */
+    J[61] += dqdci;               /* dwdot[CH2O]/d[AR] */
+    J[67] -= dqdci;               /* dwdot[CH3O]/d[AR] */
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[14];
+    J[144] += dqdci;              /* dwdot[H]/d[H] */
+    J[155] += dqdci;              /* dwdot[CH2O]/d[H] */
+    J[161] -= dqdci;              /* dwdot[CH3O]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[28][0] - 1)*q_nocor;
+    J[332] += dqdci;              /* dwdot[H]/d[H2] */
+    J[343] += dqdci;              /* dwdot[CH2O]/d[H2] */
+    J[349] -= dqdci;              /* dwdot[CH3O]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[28][1] - 1)*q_nocor;
+    J[379] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[390] += dqdci;              /* dwdot[CH2O]/d[H2O] */
+    J[396] -= dqdci;              /* dwdot[CH3O]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[28][3] - 1)*q_nocor;
+    J[520] += dqdci;              /* dwdot[H]/d[CO] */
+    J[531] += dqdci;              /* dwdot[CH2O]/d[CO] */
+    J[537] -= dqdci;              /* dwdot[CH3O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[28][4] - 1)*q_nocor;
+    J[567] += dqdci;              /* dwdot[H]/d[CO2] */
+    J[578] += dqdci;              /* dwdot[CH2O]/d[CO2] */
+    J[584] -= dqdci;              /* dwdot[CH3O]/d[CO2] */
+    /* d()/d[CH2O] */
+    dqdci =  - k_r*sc[3];
+    J[661] += dqdci;              /* dwdot[H]/d[CH2O] */
+    J[672] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
+    J[678] -= dqdci;              /* dwdot[CH3O]/d[CH2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[28][2] - 1)*q_nocor;
+    J[708] += dqdci;              /* dwdot[H]/d[CH4] */
+    J[719] += dqdci;              /* dwdot[CH2O]/d[CH4] */
+    J[725] -= dqdci;              /* dwdot[CH3O]/d[CH4] */
+    /* d()/d[CH3O] */
+    dqdci =  + k_f;
+    J[943] += dqdci;              /* dwdot[H]/d[CH3O] */
+    J[954] += dqdci;              /* dwdot[CH2O]/d[CH3O] */
+    J[960] -= dqdci;              /* dwdot[CH3O]/d[CH3O] */
     J[2165] += dqdT; /* dwdot[H]/dT */
     J[2176] += dqdT; /* dwdot[CH2O]/dT */
     J[2182] -= dqdT; /* dwdot[CH3O]/dT */
@@ -23144,15 +22320,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 30: C2H4 + M <=> C2H3 + H + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[29][0] - 1)*sc[7] + (TB[29][1] - 1)*sc[8] + (TB[29][2] - 1)*sc[15] + (TB[29][3] - 1)*sc[11] + (TB[29][4] - 1)*sc[12] + (TB[29][5] - 1)*sc[1];
+    alpha = (memcmp(TB[29], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[29][0] - 1)*sc[7] + (TB[29][1] - 1)*sc[8] + (TB[29][2] - 1)*sc[15] + (TB[29][3] - 1)*sc[11] + (TB[29][4] - 1)*sc[12] + (TB[29][5] - 1)*sc[1]);
     /* forward */
     phi_f = sc[19];
-    k_f = prefactor_units[29] * fwd_A[29]
-                * exp(fwd_beta[29] * tc[0] - activation_units[29] * fwd_Ea[29] * invT);
+    k_f = k_f_s[29];
     dlnkfdT = fwd_beta[29] * invT + activation_units[29] * fwd_Ea[29] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[25];
-    Kc = refC * exp(-g_RT[3] + g_RT[19] - g_RT[25]);
+    Kc = Kc_s[29];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[19]) + (h_RT[3] + h_RT[25]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23167,106 +22342,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[29][5] - 1)*q_nocor;
-        J[50] += dqdci;               /* dwdot[H]/d[AR] */
-        J[66] -= dqdci;               /* dwdot[C2H4]/d[AR] */
-        J[72] += dqdci;               /* dwdot[C2H3]/d[AR] */
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[25];
-        J[144] += dqdci;              /* dwdot[H]/d[H] */
-        J[160] -= dqdci;              /* dwdot[C2H4]/d[H] */
-        J[166] += dqdci;              /* dwdot[C2H3]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[29][0] - 1)*q_nocor;
-        J[332] += dqdci;              /* dwdot[H]/d[H2] */
-        J[348] -= dqdci;              /* dwdot[C2H4]/d[H2] */
-        J[354] += dqdci;              /* dwdot[C2H3]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[29][1] - 1)*q_nocor;
-        J[379] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[395] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
-        J[401] += dqdci;              /* dwdot[C2H3]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[29][3] - 1)*q_nocor;
-        J[520] += dqdci;              /* dwdot[H]/d[CO] */
-        J[536] -= dqdci;              /* dwdot[C2H4]/d[CO] */
-        J[542] += dqdci;              /* dwdot[C2H3]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[29][4] - 1)*q_nocor;
-        J[567] += dqdci;              /* dwdot[H]/d[CO2] */
-        J[583] -= dqdci;              /* dwdot[C2H4]/d[CO2] */
-        J[589] += dqdci;              /* dwdot[C2H3]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[29][2] - 1)*q_nocor;
-        J[708] += dqdci;              /* dwdot[H]/d[CH4] */
-        J[724] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
-        J[730] += dqdci;              /* dwdot[C2H3]/d[CH4] */
-        /* d()/d[C2H4] */
-        dqdci =  + k_f;
-        J[896] += dqdci;              /* dwdot[H]/d[C2H4] */
-        J[912] -= dqdci;              /* dwdot[C2H4]/d[C2H4] */
-        J[918] += dqdci;              /* dwdot[C2H3]/d[C2H4] */
-        /* d()/d[C2H3] */
-        dqdci =  - k_r*sc[3];
-        J[1178] += dqdci;             /* dwdot[H]/d[C2H3] */
-        J[1194] -= dqdci;             /* dwdot[C2H4]/d[C2H3] */
-        J[1200] += dqdci;             /* dwdot[C2H3]/d[C2H3] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[29][5];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac - k_r*sc[25];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[29][0];
-        dqdc[8] = TB[29][1];
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[29][3];
-        dqdc[12] = TB[29][4];
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[29][2];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac + k_f;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac - k_r*sc[3];
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+3] += dqdc[k];
-            J[47*k+19] -= dqdc[k];
-            J[47*k+25] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] += q_nocor;
+    Jmix[19] -= q_nocor;
+    Jmix[25] += q_nocor;
+    /* d()/d[AR] */
+    dqdci = (TB[29][5] - 1)*q_nocor;
+    J[50] += dqdci;               /* dwdot[H]/d[AR] */
+    J[66] -= dqdci;               /* dwdot[C2H4]/d[AR] */
+    J[72] += dqdci;               /* dwdot[C2H3]/d[AR] */
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[25];
+    J[144] += dqdci;              /* dwdot[H]/d[H] */
+    J[160] -= dqdci;              /* dwdot[C2H4]/d[H] */
+    J[166] += dqdci;              /* dwdot[C2H3]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[29][0] - 1)*q_nocor;
+    J[332] += dqdci;              /* dwdot[H]/d[H2] */
+    J[348] -= dqdci;              /* dwdot[C2H4]/d[H2] */
+    J[354] += dqdci;              /* dwdot[C2H3]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[29][1] - 1)*q_nocor;
+    J[379] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[395] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
+    J[401] += dqdci;              /* dwdot[C2H3]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[29][3] - 1)*q_nocor;
+    J[520] += dqdci;              /* dwdot[H]/d[CO] */
+    J[536] -= dqdci;              /* dwdot[C2H4]/d[CO] */
+    J[542] += dqdci;              /* dwdot[C2H3]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[29][4] - 1)*q_nocor;
+    J[567] += dqdci;              /* dwdot[H]/d[CO2] */
+    J[583] -= dqdci;              /* dwdot[C2H4]/d[CO2] */
+    J[589] += dqdci;              /* dwdot[C2H3]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[29][2] - 1)*q_nocor;
+    J[708] += dqdci;              /* dwdot[H]/d[CH4] */
+    J[724] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
+    J[730] += dqdci;              /* dwdot[C2H3]/d[CH4] */
+    /* d()/d[C2H4] */
+    dqdci =  + k_f;
+    J[896] += dqdci;              /* dwdot[H]/d[C2H4] */
+    J[912] -= dqdci;              /* dwdot[C2H4]/d[C2H4] */
+    J[918] += dqdci;              /* dwdot[C2H3]/d[C2H4] */
+    /* d()/d[C2H3] */
+    dqdci =  - k_r*sc[3];
+    J[1178] += dqdci;             /* dwdot[H]/d[C2H3] */
+    J[1194] -= dqdci;             /* dwdot[C2H4]/d[C2H3] */
+    J[1200] += dqdci;             /* dwdot[C2H3]/d[C2H3] */
     J[2165] += dqdT; /* dwdot[H]/dT */
     J[2181] -= dqdT; /* dwdot[C2H4]/dT */
     J[2187] += dqdT; /* dwdot[C2H3]/dT */
@@ -23274,15 +22398,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 31: C2H4 + M <=> C2H2 + H2 + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[30][0] - 1)*sc[7] + (TB[30][1] - 1)*sc[8] + (TB[30][2] - 1)*sc[15] + (TB[30][3] - 1)*sc[11] + (TB[30][4] - 1)*sc[12] + (TB[30][5] - 1)*sc[1];
+    alpha = (memcmp(TB[30], TB[3], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[30][0] - 1)*sc[7] + (TB[30][1] - 1)*sc[8] + (TB[30][2] - 1)*sc[15] + (TB[30][3] - 1)*sc[11] + (TB[30][4] - 1)*sc[12] + (TB[30][5] - 1)*sc[1]);
     /* forward */
     phi_f = sc[19];
-    k_f = prefactor_units[30] * fwd_A[30]
-                * exp(fwd_beta[30] * tc[0] - activation_units[30] * fwd_Ea[30] * invT);
+    k_f = k_f_s[30];
     dlnkfdT = fwd_beta[30] * invT + activation_units[30] * fwd_Ea[30] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[24];
-    Kc = refC * exp(-g_RT[7] + g_RT[19] - g_RT[24]);
+    Kc = Kc_s[30];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[19]) + (h_RT[7] + h_RT[24]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23297,101 +22420,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[30][5] - 1)*q_nocor;
-        J[54] += dqdci;               /* dwdot[H2]/d[AR] */
-        J[66] -= dqdci;               /* dwdot[C2H4]/d[AR] */
-        J[71] += dqdci;               /* dwdot[C2H2]/d[AR] */
-        /* d()/d[H2] */
-        dqdci = (TB[30][0] - 1)*q_nocor - k_r*sc[24];
-        J[336] += dqdci;              /* dwdot[H2]/d[H2] */
-        J[348] -= dqdci;              /* dwdot[C2H4]/d[H2] */
-        J[353] += dqdci;              /* dwdot[C2H2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[30][1] - 1)*q_nocor;
-        J[383] += dqdci;              /* dwdot[H2]/d[H2O] */
-        J[395] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
-        J[400] += dqdci;              /* dwdot[C2H2]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[30][3] - 1)*q_nocor;
-        J[524] += dqdci;              /* dwdot[H2]/d[CO] */
-        J[536] -= dqdci;              /* dwdot[C2H4]/d[CO] */
-        J[541] += dqdci;              /* dwdot[C2H2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[30][4] - 1)*q_nocor;
-        J[571] += dqdci;              /* dwdot[H2]/d[CO2] */
-        J[583] -= dqdci;              /* dwdot[C2H4]/d[CO2] */
-        J[588] += dqdci;              /* dwdot[C2H2]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[30][2] - 1)*q_nocor;
-        J[712] += dqdci;              /* dwdot[H2]/d[CH4] */
-        J[724] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
-        J[729] += dqdci;              /* dwdot[C2H2]/d[CH4] */
-        /* d()/d[C2H4] */
-        dqdci =  + k_f;
-        J[900] += dqdci;              /* dwdot[H2]/d[C2H4] */
-        J[912] -= dqdci;              /* dwdot[C2H4]/d[C2H4] */
-        J[917] += dqdci;              /* dwdot[C2H2]/d[C2H4] */
-        /* d()/d[C2H2] */
-        dqdci =  - k_r*sc[7];
-        J[1135] += dqdci;             /* dwdot[H2]/d[C2H2] */
-        J[1147] -= dqdci;             /* dwdot[C2H4]/d[C2H2] */
-        J[1152] += dqdci;             /* dwdot[C2H2]/d[C2H2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[30][5];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[30][0] - k_r*sc[24];
-        dqdc[8] = TB[30][1];
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[30][3];
-        dqdc[12] = TB[30][4];
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[30][2];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac + k_f;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac - k_r*sc[7];
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+7] += dqdc[k];
-            J[47*k+19] -= dqdc[k];
-            J[47*k+24] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[7] += q_nocor;
+    Jmix[19] -= q_nocor;
+    Jmix[24] += q_nocor;
+    /* d()/d[AR] */
+    dqdci = (TB[30][5] - 1)*q_nocor;
+    J[54] += dqdci;               /* dwdot[H2]/d[AR] */
+    J[66] -= dqdci;               /* dwdot[C2H4]/d[AR] */
+    J[71] += dqdci;               /* dwdot[C2H2]/d[AR] */
+    /* d()/d[H2] */
+    dqdci = (TB[30][0] - 1)*q_nocor - k_r*sc[24];
+    J[336] += dqdci;              /* dwdot[H2]/d[H2] */
+    J[348] -= dqdci;              /* dwdot[C2H4]/d[H2] */
+    J[353] += dqdci;              /* dwdot[C2H2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[30][1] - 1)*q_nocor;
+    J[383] += dqdci;              /* dwdot[H2]/d[H2O] */
+    J[395] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
+    J[400] += dqdci;              /* dwdot[C2H2]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[30][3] - 1)*q_nocor;
+    J[524] += dqdci;              /* dwdot[H2]/d[CO] */
+    J[536] -= dqdci;              /* dwdot[C2H4]/d[CO] */
+    J[541] += dqdci;              /* dwdot[C2H2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[30][4] - 1)*q_nocor;
+    J[571] += dqdci;              /* dwdot[H2]/d[CO2] */
+    J[583] -= dqdci;              /* dwdot[C2H4]/d[CO2] */
+    J[588] += dqdci;              /* dwdot[C2H2]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[30][2] - 1)*q_nocor;
+    J[712] += dqdci;              /* dwdot[H2]/d[CH4] */
+    J[724] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
+    J[729] += dqdci;              /* dwdot[C2H2]/d[CH4] */
+    /* d()/d[C2H4] */
+    dqdci =  + k_f;
+    J[900] += dqdci;              /* dwdot[H2]/d[C2H4] */
+    J[912] -= dqdci;              /* dwdot[C2H4]/d[C2H4] */
+    J[917] += dqdci;              /* dwdot[C2H2]/d[C2H4] */
+    /* d()/d[C2H2] */
+    dqdci =  - k_r*sc[7];
+    J[1135] += dqdci;             /* dwdot[H2]/d[C2H2] */
+    J[1147] -= dqdci;             /* dwdot[C2H4]/d[C2H2] */
+    J[1152] += dqdci;             /* dwdot[C2H2]/d[C2H2] */
     J[2169] += dqdT; /* dwdot[H2]/dT */
     J[2181] -= dqdT; /* dwdot[C2H4]/dT */
     J[2186] += dqdT; /* dwdot[C2H2]/dT */
@@ -23399,15 +22471,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 32: CH2OH + M <=> CH2O + H + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[31][0] - 1)*sc[7] + (TB[31][1] - 1)*sc[8] + (TB[31][2] - 1)*sc[11] + (TB[31][3] - 1)*sc[12] + (TB[31][4] - 1)*sc[15] + (TB[31][5] - 1)*sc[1];
+    alpha = (memcmp(TB[31], TB[8], 6*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[31][0] - 1)*sc[7] + (TB[31][1] - 1)*sc[8] + (TB[31][2] - 1)*sc[11] + (TB[31][3] - 1)*sc[12] + (TB[31][4] - 1)*sc[15] + (TB[31][5] - 1)*sc[1]);
     /* forward */
     phi_f = sc[31];
-    k_f = prefactor_units[31] * fwd_A[31]
-                * exp(fwd_beta[31] * tc[0] - activation_units[31] * fwd_Ea[31] * invT);
+    k_f = k_f_s[31];
     dlnkfdT = fwd_beta[31] * invT + activation_units[31] * fwd_Ea[31] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[14];
-    Kc = refC * exp(-g_RT[3] - g_RT[14] + g_RT[31]);
+    Kc = Kc_s[31];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[31]) + (h_RT[3] + h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23422,106 +22493,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[31][5] - 1)*q_nocor;
-        J[50] += dqdci;               /* dwdot[H]/d[AR] */
-        J[61] += dqdci;               /* dwdot[CH2O]/d[AR] */
-        J[78] -= dqdci;               /* dwdot[CH2OH]/d[AR] */
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[14];
-        J[144] += dqdci;              /* dwdot[H]/d[H] */
-        J[155] += dqdci;              /* dwdot[CH2O]/d[H] */
-        J[172] -= dqdci;              /* dwdot[CH2OH]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[31][0] - 1)*q_nocor;
-        J[332] += dqdci;              /* dwdot[H]/d[H2] */
-        J[343] += dqdci;              /* dwdot[CH2O]/d[H2] */
-        J[360] -= dqdci;              /* dwdot[CH2OH]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[31][1] - 1)*q_nocor;
-        J[379] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[390] += dqdci;              /* dwdot[CH2O]/d[H2O] */
-        J[407] -= dqdci;              /* dwdot[CH2OH]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[31][2] - 1)*q_nocor;
-        J[520] += dqdci;              /* dwdot[H]/d[CO] */
-        J[531] += dqdci;              /* dwdot[CH2O]/d[CO] */
-        J[548] -= dqdci;              /* dwdot[CH2OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[31][3] - 1)*q_nocor;
-        J[567] += dqdci;              /* dwdot[H]/d[CO2] */
-        J[578] += dqdci;              /* dwdot[CH2O]/d[CO2] */
-        J[595] -= dqdci;              /* dwdot[CH2OH]/d[CO2] */
-        /* d()/d[CH2O] */
-        dqdci =  - k_r*sc[3];
-        J[661] += dqdci;              /* dwdot[H]/d[CH2O] */
-        J[672] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
-        J[689] -= dqdci;              /* dwdot[CH2OH]/d[CH2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[31][4] - 1)*q_nocor;
-        J[708] += dqdci;              /* dwdot[H]/d[CH4] */
-        J[719] += dqdci;              /* dwdot[CH2O]/d[CH4] */
-        J[736] -= dqdci;              /* dwdot[CH2OH]/d[CH4] */
-        /* d()/d[CH2OH] */
-        dqdci =  + k_f;
-        J[1460] += dqdci;             /* dwdot[H]/d[CH2OH] */
-        J[1471] += dqdci;             /* dwdot[CH2O]/d[CH2OH] */
-        J[1488] -= dqdci;             /* dwdot[CH2OH]/d[CH2OH] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[31][5];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac - k_r*sc[14];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[31][0];
-        dqdc[8] = TB[31][1];
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[31][2];
-        dqdc[12] = TB[31][3];
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac - k_r*sc[3];
-        dqdc[15] = TB[31][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac + k_f;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+3] += dqdc[k];
-            J[47*k+14] += dqdc[k];
-            J[47*k+31] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] += q_nocor;
+    Jmix[14] += q_nocor;
+    Jmix[31] -= q_nocor;
+    /* d()/d[AR] */
+    dqdci = (TB[31][5] - 1)*q_nocor;
+    J[50] += dqdci;               /* dwdot[H]/d[AR] */
+    J[61] += dqdci;               /* dwdot[CH2O]/d[AR] */
+    J[78] -= dqdci;               /* dwdot[CH2OH]/d[AR] */
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[14];
+    J[144] += dqdci;              /* dwdot[H]/d[H] */
+    J[155] += dqdci;              /* dwdot[CH2O]/d[H] */
+    J[172] -= dqdci;              /* dwdot[CH2OH]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[31][0] - 1)*q_nocor;
+    J[332] += dqdci;              /* dwdot[H]/d[H2] */
+    J[343] += dqdci;              /* dwdot[CH2O]/d[H2] */
+    J[360] -= dqdci;              /* dwdot[CH2OH]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[31][1] - 1)*q_nocor;
+    J[379] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[390] += dqdci;              /* dwdot[CH2O]/d[H2O] */
+    J[407] -= dqdci;              /* dwdot[CH2OH]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[31][2] - 1)*q_nocor;
+    J[520] += dqdci;              /* dwdot[H]/d[CO] */
+    J[531] += dqdci;              /* dwdot[CH2O]/d[CO] */
+    J[548] -= dqdci;              /* dwdot[CH2OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[31][3] - 1)*q_nocor;
+    J[567] += dqdci;              /* dwdot[H]/d[CO2] */
+    J[578] += dqdci;              /* dwdot[CH2O]/d[CO2] */
+    J[595] -= dqdci;              /* dwdot[CH2OH]/d[CO2] */
+    /* d()/d[CH2O] */
+    dqdci =  - k_r*sc[3];
+    J[661] += dqdci;              /* dwdot[H]/d[CH2O] */
+    J[672] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
+    J[689] -= dqdci;              /* dwdot[CH2OH]/d[CH2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[31][4] - 1)*q_nocor;
+    J[708] += dqdci;              /* dwdot[H]/d[CH4] */
+    J[719] += dqdci;              /* dwdot[CH2O]/d[CH4] */
+    J[736] -= dqdci;              /* dwdot[CH2OH]/d[CH4] */
+    /* d()/d[CH2OH] */
+    dqdci =  + k_f;
+    J[1460] += dqdci;             /* dwdot[H]/d[CH2OH] */
+    J[1471] += dqdci;             /* dwdot[CH2O]/d[CH2OH] */
+    J[1488] -= dqdci;             /* dwdot[CH2OH]/d[CH2OH] */
     J[2165] += dqdT; /* dwdot[H]/dT */
     J[2176] += dqdT; /* dwdot[CH2O]/dT */
     J[2193] -= dqdT; /* dwdot[CH2OH]/dT */
@@ -23529,15 +22549,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 33: CH3O + M <=> CH2OH + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[32][0] - 1)*sc[7] + (TB[32][1] - 1)*sc[8] + (TB[32][2] - 1)*sc[11] + (TB[32][3] - 1)*sc[12] + (TB[32][4] - 1)*sc[15] + (TB[32][5] - 1)*sc[1];
+    alpha = (memcmp(TB[32], TB[8], 6*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[32][0] - 1)*sc[7] + (TB[32][1] - 1)*sc[8] + (TB[32][2] - 1)*sc[11] + (TB[32][3] - 1)*sc[12] + (TB[32][4] - 1)*sc[15] + (TB[32][5] - 1)*sc[1]);
     /* forward */
     phi_f = sc[20];
-    k_f = prefactor_units[32] * fwd_A[32]
-                * exp(fwd_beta[32] * tc[0] - activation_units[32] * fwd_Ea[32] * invT);
+    k_f = k_f_s[32];
     dlnkfdT = fwd_beta[32] * invT + activation_units[32] * fwd_Ea[32] * invT2;
     /* reverse */
     phi_r = sc[31];
-    Kc = exp(g_RT[20] - g_RT[31]);
+    Kc = Kc_s[32];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[20]) + (h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23551,107 +22570,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[32][5] - 1)*q_nocor;
-        J[67] -= dqdci;               /* dwdot[CH3O]/d[AR] */
-        J[78] += dqdci;               /* dwdot[CH2OH]/d[AR] */
-        /* d()/d[H2] */
-        dqdci = (TB[32][0] - 1)*q_nocor;
-        J[349] -= dqdci;              /* dwdot[CH3O]/d[H2] */
-        J[360] += dqdci;              /* dwdot[CH2OH]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[32][1] - 1)*q_nocor;
-        J[396] -= dqdci;              /* dwdot[CH3O]/d[H2O] */
-        J[407] += dqdci;              /* dwdot[CH2OH]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[32][2] - 1)*q_nocor;
-        J[537] -= dqdci;              /* dwdot[CH3O]/d[CO] */
-        J[548] += dqdci;              /* dwdot[CH2OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[32][3] - 1)*q_nocor;
-        J[584] -= dqdci;              /* dwdot[CH3O]/d[CO2] */
-        J[595] += dqdci;              /* dwdot[CH2OH]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[32][4] - 1)*q_nocor;
-        J[725] -= dqdci;              /* dwdot[CH3O]/d[CH4] */
-        J[736] += dqdci;              /* dwdot[CH2OH]/d[CH4] */
-        /* d()/d[CH3O] */
-        dqdci =  + k_f;
-        J[960] -= dqdci;              /* dwdot[CH3O]/d[CH3O] */
-        J[971] += dqdci;              /* dwdot[CH2OH]/d[CH3O] */
-        /* d()/d[CH2OH] */
-        dqdci =  - k_r;
-        J[1477] -= dqdci;             /* dwdot[CH3O]/d[CH2OH] */
-        J[1488] += dqdci;             /* dwdot[CH2OH]/d[CH2OH] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[32][5];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[32][0];
-        dqdc[8] = TB[32][1];
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[32][2];
-        dqdc[12] = TB[32][3];
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[32][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac + k_f;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac - k_r;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+20] -= dqdc[k];
-            J[47*k+31] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[20] -= q_nocor;
+    Jmix[31] += q_nocor;
+    /* d()/d[AR] */
+    dqdci = (TB[32][5] - 1)*q_nocor;
+    J[67] -= dqdci;               /* dwdot[CH3O]/d[AR] */
+    J[78] += dqdci;               /* dwdot[CH2OH]/d[AR] */
+    /* d()/d[H2] */
+    dqdci = (TB[32][0] - 1)*q_nocor;
+    J[349] -= dqdci;              /* dwdot[CH3O]/d[H2] */
+    J[360] += dqdci;              /* dwdot[CH2OH]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[32][1] - 1)*q_nocor;
+    J[396] -= dqdci;              /* dwdot[CH3O]/d[H2O] */
+    J[407] += dqdci;              /* dwdot[CH2OH]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[32][2] - 1)*q_nocor;
+    J[537] -= dqdci;              /* dwdot[CH3O]/d[CO] */
+    J[548] += dqdci;              /* dwdot[CH2OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[32][3] - 1)*q_nocor;
+    J[584] -= dqdci;              /* dwdot[CH3O]/d[CO2] */
+    J[595] += dqdci;              /* dwdot[CH2OH]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[32][4] - 1)*q_nocor;
+    J[725] -= dqdci;              /* dwdot[CH3O]/d[CH4] */
+    J[736] += dqdci;              /* dwdot[CH2OH]/d[CH4] */
+    /* d()/d[CH3O] */
+    dqdci =  + k_f;
+    J[960] -= dqdci;              /* dwdot[CH3O]/d[CH3O] */
+    J[971] += dqdci;              /* dwdot[CH2OH]/d[CH3O] */
+    /* d()/d[CH2OH] */
+    dqdci =  - k_r;
+    J[1477] -= dqdci;             /* dwdot[CH3O]/d[CH2OH] */
+    J[1488] += dqdci;             /* dwdot[CH2OH]/d[CH2OH] */
     J[2182] -= dqdT; /* dwdot[CH3O]/dT */
     J[2193] += dqdT; /* dwdot[CH2OH]/dT */
 
     /*reaction 34: CH3CH2O + M <=> CH3CHO + H + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[33][0] - 1)*sc[7] + (TB[33][1] - 1)*sc[8] + (TB[33][2] - 1)*sc[11] + (TB[33][3] - 1)*sc[12] + (TB[33][4] - 1)*sc[15] + (TB[33][5] - 1)*sc[1];
+    alpha = (memcmp(TB[33], TB[8], 6*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[33][0] - 1)*sc[7] + (TB[33][1] - 1)*sc[8] + (TB[33][2] - 1)*sc[11] + (TB[33][3] - 1)*sc[12] + (TB[33][4] - 1)*sc[15] + (TB[33][5] - 1)*sc[1]);
     /* forward */
     phi_f = sc[38];
-    k_f = prefactor_units[33] * fwd_A[33]
-                * exp(fwd_beta[33] * tc[0] - activation_units[33] * fwd_Ea[33] * invT);
+    k_f = k_f_s[33];
     dlnkfdT = fwd_beta[33] * invT + activation_units[33] * fwd_Ea[33] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[34];
-    Kc = refC * exp(-g_RT[3] - g_RT[34] + g_RT[38]);
+    Kc = Kc_s[33];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[38]) + (h_RT[3] + h_RT[34]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23666,106 +22633,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[33][5] - 1)*q_nocor;
-        J[50] += dqdci;               /* dwdot[H]/d[AR] */
-        J[81] += dqdci;               /* dwdot[CH3CHO]/d[AR] */
-        J[85] -= dqdci;               /* dwdot[CH3CH2O]/d[AR] */
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[34];
-        J[144] += dqdci;              /* dwdot[H]/d[H] */
-        J[175] += dqdci;              /* dwdot[CH3CHO]/d[H] */
-        J[179] -= dqdci;              /* dwdot[CH3CH2O]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[33][0] - 1)*q_nocor;
-        J[332] += dqdci;              /* dwdot[H]/d[H2] */
-        J[363] += dqdci;              /* dwdot[CH3CHO]/d[H2] */
-        J[367] -= dqdci;              /* dwdot[CH3CH2O]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[33][1] - 1)*q_nocor;
-        J[379] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[410] += dqdci;              /* dwdot[CH3CHO]/d[H2O] */
-        J[414] -= dqdci;              /* dwdot[CH3CH2O]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[33][2] - 1)*q_nocor;
-        J[520] += dqdci;              /* dwdot[H]/d[CO] */
-        J[551] += dqdci;              /* dwdot[CH3CHO]/d[CO] */
-        J[555] -= dqdci;              /* dwdot[CH3CH2O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[33][3] - 1)*q_nocor;
-        J[567] += dqdci;              /* dwdot[H]/d[CO2] */
-        J[598] += dqdci;              /* dwdot[CH3CHO]/d[CO2] */
-        J[602] -= dqdci;              /* dwdot[CH3CH2O]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[33][4] - 1)*q_nocor;
-        J[708] += dqdci;              /* dwdot[H]/d[CH4] */
-        J[739] += dqdci;              /* dwdot[CH3CHO]/d[CH4] */
-        J[743] -= dqdci;              /* dwdot[CH3CH2O]/d[CH4] */
-        /* d()/d[CH3CHO] */
-        dqdci =  - k_r*sc[3];
-        J[1601] += dqdci;             /* dwdot[H]/d[CH3CHO] */
-        J[1632] += dqdci;             /* dwdot[CH3CHO]/d[CH3CHO] */
-        J[1636] -= dqdci;             /* dwdot[CH3CH2O]/d[CH3CHO] */
-        /* d()/d[CH3CH2O] */
-        dqdci =  + k_f;
-        J[1789] += dqdci;             /* dwdot[H]/d[CH3CH2O] */
-        J[1820] += dqdci;             /* dwdot[CH3CHO]/d[CH3CH2O] */
-        J[1824] -= dqdci;             /* dwdot[CH3CH2O]/d[CH3CH2O] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[33][5];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac - k_r*sc[34];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[33][0];
-        dqdc[8] = TB[33][1];
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[33][2];
-        dqdc[12] = TB[33][3];
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[33][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac - k_r*sc[3];
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac + k_f;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+3] += dqdc[k];
-            J[47*k+34] += dqdc[k];
-            J[47*k+38] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] += q_nocor;
+    Jmix[34] += q_nocor;
+    Jmix[38] -= q_nocor;
+    /* d()/d[AR] */
+    dqdci = (TB[33][5] - 1)*q_nocor;
+    J[50] += dqdci;               /* dwdot[H]/d[AR] */
+    J[81] += dqdci;               /* dwdot[CH3CHO]/d[AR] */
+    J[85] -= dqdci;               /* dwdot[CH3CH2O]/d[AR] */
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[34];
+    J[144] += dqdci;              /* dwdot[H]/d[H] */
+    J[175] += dqdci;              /* dwdot[CH3CHO]/d[H] */
+    J[179] -= dqdci;              /* dwdot[CH3CH2O]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[33][0] - 1)*q_nocor;
+    J[332] += dqdci;              /* dwdot[H]/d[H2] */
+    J[363] += dqdci;              /* dwdot[CH3CHO]/d[H2] */
+    J[367] -= dqdci;              /* dwdot[CH3CH2O]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[33][1] - 1)*q_nocor;
+    J[379] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[410] += dqdci;              /* dwdot[CH3CHO]/d[H2O] */
+    J[414] -= dqdci;              /* dwdot[CH3CH2O]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[33][2] - 1)*q_nocor;
+    J[520] += dqdci;              /* dwdot[H]/d[CO] */
+    J[551] += dqdci;              /* dwdot[CH3CHO]/d[CO] */
+    J[555] -= dqdci;              /* dwdot[CH3CH2O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[33][3] - 1)*q_nocor;
+    J[567] += dqdci;              /* dwdot[H]/d[CO2] */
+    J[598] += dqdci;              /* dwdot[CH3CHO]/d[CO2] */
+    J[602] -= dqdci;              /* dwdot[CH3CH2O]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[33][4] - 1)*q_nocor;
+    J[708] += dqdci;              /* dwdot[H]/d[CH4] */
+    J[739] += dqdci;              /* dwdot[CH3CHO]/d[CH4] */
+    J[743] -= dqdci;              /* dwdot[CH3CH2O]/d[CH4] */
+    /* d()/d[CH3CHO] */
+    dqdci =  - k_r*sc[3];
+    J[1601] += dqdci;             /* dwdot[H]/d[CH3CHO] */
+    J[1632] += dqdci;             /* dwdot[CH3CHO]/d[CH3CHO] */
+    J[1636] -= dqdci;             /* dwdot[CH3CH2O]/d[CH3CHO] */
+    /* d()/d[CH3CH2O] */
+    dqdci =  + k_f;
+    J[1789] += dqdci;             /* dwdot[H]/d[CH3CH2O] */
+    J[1820] += dqdci;             /* dwdot[CH3CHO]/d[CH3CH2O] */
+    J[1824] -= dqdci;             /* dwdot[CH3CH2O]/d[CH3CH2O] */
     J[2165] += dqdT; /* dwdot[H]/dT */
     J[2196] += dqdT; /* dwdot[CH3CHO]/dT */
     J[2200] -= dqdT; /* dwdot[CH3CH2O]/dT */
@@ -23773,15 +22689,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 35: CH3CH2O + M <=> CH3 + CH2O + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[34][0] - 1)*sc[7] + (TB[34][1] - 1)*sc[8] + (TB[34][2] - 1)*sc[11] + (TB[34][3] - 1)*sc[12] + (TB[34][4] - 1)*sc[15] + (TB[34][5] - 1)*sc[1];
+    alpha = (memcmp(TB[34], TB[8], 6*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[34][0] - 1)*sc[7] + (TB[34][1] - 1)*sc[8] + (TB[34][2] - 1)*sc[11] + (TB[34][3] - 1)*sc[12] + (TB[34][4] - 1)*sc[15] + (TB[34][5] - 1)*sc[1]);
     /* forward */
     phi_f = sc[38];
-    k_f = prefactor_units[34] * fwd_A[34]
-                * exp(fwd_beta[34] * tc[0] - activation_units[34] * fwd_Ea[34] * invT);
+    k_f = k_f_s[34];
     dlnkfdT = fwd_beta[34] * invT + activation_units[34] * fwd_Ea[34] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[16];
-    Kc = refC * exp(-g_RT[14] - g_RT[16] + g_RT[38]);
+    Kc = Kc_s[34];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[38]) + (h_RT[14] + h_RT[16]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23796,106 +22711,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[34][5] - 1)*q_nocor;
-        J[61] += dqdci;               /* dwdot[CH2O]/d[AR] */
-        J[63] += dqdci;               /* dwdot[CH3]/d[AR] */
-        J[85] -= dqdci;               /* dwdot[CH3CH2O]/d[AR] */
-        /* d()/d[H2] */
-        dqdci = (TB[34][0] - 1)*q_nocor;
-        J[343] += dqdci;              /* dwdot[CH2O]/d[H2] */
-        J[345] += dqdci;              /* dwdot[CH3]/d[H2] */
-        J[367] -= dqdci;              /* dwdot[CH3CH2O]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[34][1] - 1)*q_nocor;
-        J[390] += dqdci;              /* dwdot[CH2O]/d[H2O] */
-        J[392] += dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[414] -= dqdci;              /* dwdot[CH3CH2O]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[34][2] - 1)*q_nocor;
-        J[531] += dqdci;              /* dwdot[CH2O]/d[CO] */
-        J[533] += dqdci;              /* dwdot[CH3]/d[CO] */
-        J[555] -= dqdci;              /* dwdot[CH3CH2O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[34][3] - 1)*q_nocor;
-        J[578] += dqdci;              /* dwdot[CH2O]/d[CO2] */
-        J[580] += dqdci;              /* dwdot[CH3]/d[CO2] */
-        J[602] -= dqdci;              /* dwdot[CH3CH2O]/d[CO2] */
-        /* d()/d[CH2O] */
-        dqdci =  - k_r*sc[16];
-        J[672] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
-        J[674] += dqdci;              /* dwdot[CH3]/d[CH2O] */
-        J[696] -= dqdci;              /* dwdot[CH3CH2O]/d[CH2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[34][4] - 1)*q_nocor;
-        J[719] += dqdci;              /* dwdot[CH2O]/d[CH4] */
-        J[721] += dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[743] -= dqdci;              /* dwdot[CH3CH2O]/d[CH4] */
-        /* d()/d[CH3] */
-        dqdci =  - k_r*sc[14];
-        J[766] += dqdci;              /* dwdot[CH2O]/d[CH3] */
-        J[768] += dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[790] -= dqdci;              /* dwdot[CH3CH2O]/d[CH3] */
-        /* d()/d[CH3CH2O] */
-        dqdci =  + k_f;
-        J[1800] += dqdci;             /* dwdot[CH2O]/d[CH3CH2O] */
-        J[1802] += dqdci;             /* dwdot[CH3]/d[CH3CH2O] */
-        J[1824] -= dqdci;             /* dwdot[CH3CH2O]/d[CH3CH2O] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[34][5];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[34][0];
-        dqdc[8] = TB[34][1];
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[34][2];
-        dqdc[12] = TB[34][3];
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac - k_r*sc[16];
-        dqdc[15] = TB[34][4];
-        dqdc[16] = dcdc_fac - k_r*sc[14];
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac + k_f;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+14] += dqdc[k];
-            J[47*k+16] += dqdc[k];
-            J[47*k+38] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[14] += q_nocor;
+    Jmix[16] += q_nocor;
+    Jmix[38] -= q_nocor;
+    /* d()/d[AR] */
+    dqdci = (TB[34][5] - 1)*q_nocor;
+    J[61] += dqdci;               /* dwdot[CH2O]/d[AR] */
+    J[63] += dqdci;               /* dwdot[CH3]/d[AR] */
+    J[85] -= dqdci;               /* dwdot[CH3CH2O]/d[AR] */
+    /* d()/d[H2] */
+    dqdci = (TB[34][0] - 1)*q_nocor;
+    J[343] += dqdci;              /* dwdot[CH2O]/d[H2] */
+    J[345] += dqdci;              /* dwdot[CH3]/d[H2] */
+    J[367] -= dqdci;              /* dwdot[CH3CH2O]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[34][1] - 1)*q_nocor;
+    J[390] += dqdci;              /* dwdot[CH2O]/d[H2O] */
+    J[392] += dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[414] -= dqdci;              /* dwdot[CH3CH2O]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[34][2] - 1)*q_nocor;
+    J[531] += dqdci;              /* dwdot[CH2O]/d[CO] */
+    J[533] += dqdci;              /* dwdot[CH3]/d[CO] */
+    J[555] -= dqdci;              /* dwdot[CH3CH2O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[34][3] - 1)*q_nocor;
+    J[578] += dqdci;              /* dwdot[CH2O]/d[CO2] */
+    J[580] += dqdci;              /* dwdot[CH3]/d[CO2] */
+    J[602] -= dqdci;              /* dwdot[CH3CH2O]/d[CO2] */
+    /* d()/d[CH2O] */
+    dqdci =  - k_r*sc[16];
+    J[672] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
+    J[674] += dqdci;              /* dwdot[CH3]/d[CH2O] */
+    J[696] -= dqdci;              /* dwdot[CH3CH2O]/d[CH2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[34][4] - 1)*q_nocor;
+    J[719] += dqdci;              /* dwdot[CH2O]/d[CH4] */
+    J[721] += dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[743] -= dqdci;              /* dwdot[CH3CH2O]/d[CH4] */
+    /* d()/d[CH3] */
+    dqdci =  - k_r*sc[14];
+    J[766] += dqdci;              /* dwdot[CH2O]/d[CH3] */
+    J[768] += dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[790] -= dqdci;              /* dwdot[CH3CH2O]/d[CH3] */
+    /* d()/d[CH3CH2O] */
+    dqdci =  + k_f;
+    J[1800] += dqdci;             /* dwdot[CH2O]/d[CH3CH2O] */
+    J[1802] += dqdci;             /* dwdot[CH3]/d[CH3CH2O] */
+    J[1824] -= dqdci;             /* dwdot[CH3CH2O]/d[CH3CH2O] */
     J[2176] += dqdT; /* dwdot[CH2O]/dT */
     J[2178] += dqdT; /* dwdot[CH3]/dT */
     J[2200] -= dqdT; /* dwdot[CH3CH2O]/dT */
@@ -23903,15 +22767,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 36: CH3CHOH + M <=> CH3CHO + H + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[35][0] - 1)*sc[7] + (TB[35][1] - 1)*sc[8] + (TB[35][2] - 1)*sc[11] + (TB[35][3] - 1)*sc[12] + (TB[35][4] - 1)*sc[15] + (TB[35][5] - 1)*sc[1];
+    alpha = (memcmp(TB[35], TB[8], 6*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[35][0] - 1)*sc[7] + (TB[35][1] - 1)*sc[8] + (TB[35][2] - 1)*sc[11] + (TB[35][3] - 1)*sc[12] + (TB[35][4] - 1)*sc[15] + (TB[35][5] - 1)*sc[1]);
     /* forward */
     phi_f = sc[35];
-    k_f = prefactor_units[35] * fwd_A[35]
-                * exp(fwd_beta[35] * tc[0] - activation_units[35] * fwd_Ea[35] * invT);
+    k_f = k_f_s[35];
     dlnkfdT = fwd_beta[35] * invT + activation_units[35] * fwd_Ea[35] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[34];
-    Kc = refC * exp(-g_RT[3] - g_RT[34] + g_RT[35]);
+    Kc = Kc_s[35];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[35]) + (h_RT[3] + h_RT[34]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23926,106 +22789,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[AR] */
-        dqdci = (TB[35][5] - 1)*q_nocor;
-        J[50] += dqdci;               /* dwdot[H]/d[AR] */
-        J[81] += dqdci;               /* dwdot[CH3CHO]/d[AR] */
-        J[82] -= dqdci;               /* dwdot[CH3CHOH]/d[AR] */
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[34];
-        J[144] += dqdci;              /* dwdot[H]/d[H] */
-        J[175] += dqdci;              /* dwdot[CH3CHO]/d[H] */
-        J[176] -= dqdci;              /* dwdot[CH3CHOH]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[35][0] - 1)*q_nocor;
-        J[332] += dqdci;              /* dwdot[H]/d[H2] */
-        J[363] += dqdci;              /* dwdot[CH3CHO]/d[H2] */
-        J[364] -= dqdci;              /* dwdot[CH3CHOH]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[35][1] - 1)*q_nocor;
-        J[379] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[410] += dqdci;              /* dwdot[CH3CHO]/d[H2O] */
-        J[411] -= dqdci;              /* dwdot[CH3CHOH]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[35][2] - 1)*q_nocor;
-        J[520] += dqdci;              /* dwdot[H]/d[CO] */
-        J[551] += dqdci;              /* dwdot[CH3CHO]/d[CO] */
-        J[552] -= dqdci;              /* dwdot[CH3CHOH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[35][3] - 1)*q_nocor;
-        J[567] += dqdci;              /* dwdot[H]/d[CO2] */
-        J[598] += dqdci;              /* dwdot[CH3CHO]/d[CO2] */
-        J[599] -= dqdci;              /* dwdot[CH3CHOH]/d[CO2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[35][4] - 1)*q_nocor;
-        J[708] += dqdci;              /* dwdot[H]/d[CH4] */
-        J[739] += dqdci;              /* dwdot[CH3CHO]/d[CH4] */
-        J[740] -= dqdci;              /* dwdot[CH3CHOH]/d[CH4] */
-        /* d()/d[CH3CHO] */
-        dqdci =  - k_r*sc[3];
-        J[1601] += dqdci;             /* dwdot[H]/d[CH3CHO] */
-        J[1632] += dqdci;             /* dwdot[CH3CHO]/d[CH3CHO] */
-        J[1633] -= dqdci;             /* dwdot[CH3CHOH]/d[CH3CHO] */
-        /* d()/d[CH3CHOH] */
-        dqdci =  + k_f;
-        J[1648] += dqdci;             /* dwdot[H]/d[CH3CHOH] */
-        J[1679] += dqdci;             /* dwdot[CH3CHO]/d[CH3CHOH] */
-        J[1680] -= dqdci;             /* dwdot[CH3CHOH]/d[CH3CHOH] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = TB[35][5];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac - k_r*sc[34];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = TB[35][0];
-        dqdc[8] = TB[35][1];
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = TB[35][2];
-        dqdc[12] = TB[35][3];
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[35][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac - k_r*sc[3];
-        dqdc[35] = dcdc_fac + k_f;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        for (int k=0; k<46; k++) {
-            J[47*k+3] += dqdc[k];
-            J[47*k+34] += dqdc[k];
-            J[47*k+35] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[3] += q_nocor;
+    Jmix[34] += q_nocor;
+    Jmix[35] -= q_nocor;
+    /* d()/d[AR] */
+    dqdci = (TB[35][5] - 1)*q_nocor;
+    J[50] += dqdci;               /* dwdot[H]/d[AR] */
+    J[81] += dqdci;               /* dwdot[CH3CHO]/d[AR] */
+    J[82] -= dqdci;               /* dwdot[CH3CHOH]/d[AR] */
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[34];
+    J[144] += dqdci;              /* dwdot[H]/d[H] */
+    J[175] += dqdci;              /* dwdot[CH3CHO]/d[H] */
+    J[176] -= dqdci;              /* dwdot[CH3CHOH]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[35][0] - 1)*q_nocor;
+    J[332] += dqdci;              /* dwdot[H]/d[H2] */
+    J[363] += dqdci;              /* dwdot[CH3CHO]/d[H2] */
+    J[364] -= dqdci;              /* dwdot[CH3CHOH]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[35][1] - 1)*q_nocor;
+    J[379] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[410] += dqdci;              /* dwdot[CH3CHO]/d[H2O] */
+    J[411] -= dqdci;              /* dwdot[CH3CHOH]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[35][2] - 1)*q_nocor;
+    J[520] += dqdci;              /* dwdot[H]/d[CO] */
+    J[551] += dqdci;              /* dwdot[CH3CHO]/d[CO] */
+    J[552] -= dqdci;              /* dwdot[CH3CHOH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[35][3] - 1)*q_nocor;
+    J[567] += dqdci;              /* dwdot[H]/d[CO2] */
+    J[598] += dqdci;              /* dwdot[CH3CHO]/d[CO2] */
+    J[599] -= dqdci;              /* dwdot[CH3CHOH]/d[CO2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[35][4] - 1)*q_nocor;
+    J[708] += dqdci;              /* dwdot[H]/d[CH4] */
+    J[739] += dqdci;              /* dwdot[CH3CHO]/d[CH4] */
+    J[740] -= dqdci;              /* dwdot[CH3CHOH]/d[CH4] */
+    /* d()/d[CH3CHO] */
+    dqdci =  - k_r*sc[3];
+    J[1601] += dqdci;             /* dwdot[H]/d[CH3CHO] */
+    J[1632] += dqdci;             /* dwdot[CH3CHO]/d[CH3CHO] */
+    J[1633] -= dqdci;             /* dwdot[CH3CHOH]/d[CH3CHO] */
+    /* d()/d[CH3CHOH] */
+    dqdci =  + k_f;
+    J[1648] += dqdci;             /* dwdot[H]/d[CH3CHOH] */
+    J[1679] += dqdci;             /* dwdot[CH3CHO]/d[CH3CHOH] */
+    J[1680] -= dqdci;             /* dwdot[CH3CHOH]/d[CH3CHOH] */
     J[2165] += dqdT; /* dwdot[H]/dT */
     J[2196] += dqdT; /* dwdot[CH3CHO]/dT */
     J[2197] -= dqdT; /* dwdot[CH3CHOH]/dT */
@@ -24034,12 +22846,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[4];
-    k_f = prefactor_units[36] * fwd_A[36]
-                * exp(fwd_beta[36] * tc[0] - activation_units[36] * fwd_Ea[36] * invT);
+    k_f = k_f_s[36];
     dlnkfdT = fwd_beta[36] * invT + activation_units[36] * fwd_Ea[36] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = exp(g_RT[3] + g_RT[4] - g_RT[5] - g_RT[6]);
+    Kc = Kc_s[36];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[4]) + (h_RT[5] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24085,12 +22896,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[7];
-    k_f = prefactor_units[37] * fwd_A[37]
-                * exp(fwd_beta[37] * tc[0] - activation_units[37] * fwd_Ea[37] * invT);
+    k_f = k_f_s[37];
     dlnkfdT = fwd_beta[37] * invT + activation_units[37] * fwd_Ea[37] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[5];
-    Kc = exp(-g_RT[3] - g_RT[5] + g_RT[6] + g_RT[7]);
+    Kc = Kc_s[37];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[7]) + (h_RT[3] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24136,12 +22946,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[7];
-    k_f = prefactor_units[38] * fwd_A[38]
-                * exp(fwd_beta[38] * tc[0] - activation_units[38] * fwd_Ea[38] * invT);
+    k_f = k_f_s[38];
     dlnkfdT = fwd_beta[38] * invT + activation_units[38] * fwd_Ea[38] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[8];
-    Kc = exp(-g_RT[3] + g_RT[5] + g_RT[7] - g_RT[8]);
+    Kc = Kc_s[38];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[7]) + (h_RT[3] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24187,12 +22996,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[8];
-    k_f = prefactor_units[39] * fwd_A[39]
-                * exp(fwd_beta[39] * tc[0] - activation_units[39] * fwd_Ea[39] * invT);
+    k_f = k_f_s[39];
     dlnkfdT = fwd_beta[39] * invT + activation_units[39] * fwd_Ea[39] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[5];
-    Kc = exp(-2*g_RT[5] + g_RT[6] + g_RT[8]);
+    Kc = Kc_s[39];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[8]) + (2*h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24227,12 +23035,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[9];
-    k_f = prefactor_units[40] * fwd_A[40]
-                * exp(fwd_beta[40] * tc[0] - activation_units[40] * fwd_Ea[40] * invT);
+    k_f = k_f_s[40];
     dlnkfdT = fwd_beta[40] * invT + activation_units[40] * fwd_Ea[40] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[5];
-    Kc = exp(g_RT[3] - 2*g_RT[5] + g_RT[9]);
+    Kc = Kc_s[40];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[9]) + (2*h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24267,12 +23074,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[9];
-    k_f = prefactor_units[41] * fwd_A[41]
-                * exp(fwd_beta[41] * tc[0] - activation_units[41] * fwd_Ea[41] * invT);
+    k_f = k_f_s[41];
     dlnkfdT = fwd_beta[41] * invT + activation_units[41] * fwd_Ea[41] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[7];
-    Kc = exp(g_RT[3] - g_RT[4] - g_RT[7] + g_RT[9]);
+    Kc = Kc_s[41];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[9]) + (h_RT[4] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24318,12 +23124,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[9];
-    k_f = prefactor_units[42] * fwd_A[42]
-                * exp(fwd_beta[42] * tc[0] - activation_units[42] * fwd_Ea[42] * invT);
+    k_f = k_f_s[42];
     dlnkfdT = fwd_beta[42] * invT + activation_units[42] * fwd_Ea[42] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[8];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[8] + g_RT[9]);
+    Kc = Kc_s[42];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[9]) + (h_RT[6] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24369,12 +23174,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[9];
-    k_f = prefactor_units[43] * fwd_A[43]
-                * exp(fwd_beta[43] * tc[0] - activation_units[43] * fwd_Ea[43] * invT);
+    k_f = k_f_s[43];
     dlnkfdT = fwd_beta[43] * invT + activation_units[43] * fwd_Ea[43] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[5];
-    Kc = exp(-g_RT[4] - g_RT[5] + g_RT[6] + g_RT[9]);
+    Kc = Kc_s[43];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[9]) + (h_RT[4] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24420,12 +23224,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[9];
-    k_f = prefactor_units[44] * fwd_A[44]
-                * exp(fwd_beta[44] * tc[0] - activation_units[44] * fwd_Ea[44] * invT);
+    k_f = k_f_s[44];
     dlnkfdT = fwd_beta[44] * invT + activation_units[44] * fwd_Ea[44] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[8];
-    Kc = exp(-g_RT[4] + g_RT[5] - g_RT[8] + g_RT[9]);
+    Kc = Kc_s[44];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[9]) + (h_RT[4] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24471,12 +23274,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[9];
-    k_f = prefactor_units[45] * fwd_A[45]
-                * exp(fwd_beta[45] * tc[0] - activation_units[45] * fwd_Ea[45] * invT);
+    k_f = k_f_s[45];
     dlnkfdT = fwd_beta[45] * invT + activation_units[45] * fwd_Ea[45] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[10];
-    Kc = exp(-g_RT[4] + 2*g_RT[9] - g_RT[10]);
+    Kc = Kc_s[45];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[9]) + (h_RT[4] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24511,12 +23313,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[10];
-    k_f = prefactor_units[46] * fwd_A[46]
-                * exp(fwd_beta[46] * tc[0] - activation_units[46] * fwd_Ea[46] * invT);
+    k_f = k_f_s[46];
     dlnkfdT = fwd_beta[46] * invT + activation_units[46] * fwd_Ea[46] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[9];
-    Kc = exp(g_RT[3] - g_RT[7] - g_RT[9] + g_RT[10]);
+    Kc = Kc_s[46];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[10]) + (h_RT[7] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24562,12 +23363,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[10];
-    k_f = prefactor_units[47] * fwd_A[47]
-                * exp(fwd_beta[47] * tc[0] - activation_units[47] * fwd_Ea[47] * invT);
+    k_f = k_f_s[47];
     dlnkfdT = fwd_beta[47] * invT + activation_units[47] * fwd_Ea[47] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[8];
-    Kc = exp(g_RT[3] - g_RT[5] - g_RT[8] + g_RT[10]);
+    Kc = Kc_s[47];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[10]) + (h_RT[5] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24613,12 +23413,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[10];
-    k_f = prefactor_units[48] * fwd_A[48]
-                * exp(fwd_beta[48] * tc[0] - activation_units[48] * fwd_Ea[48] * invT);
+    k_f = k_f_s[48];
     dlnkfdT = fwd_beta[48] * invT + activation_units[48] * fwd_Ea[48] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[9];
-    Kc = exp(g_RT[5] - g_RT[8] - g_RT[9] + g_RT[10]);
+    Kc = Kc_s[48];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[10]) + (h_RT[8] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24664,12 +23463,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[10];
-    k_f = prefactor_units[49] * fwd_A[49]
-                * exp(fwd_beta[49] * tc[0] - activation_units[49] * fwd_Ea[49] * invT);
+    k_f = k_f_s[49];
     dlnkfdT = fwd_beta[49] * invT + activation_units[49] * fwd_Ea[49] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[9];
-    Kc = exp(-g_RT[5] + g_RT[6] - g_RT[9] + g_RT[10]);
+    Kc = Kc_s[49];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[10]) + (h_RT[5] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24715,12 +23513,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[11];
-    k_f = prefactor_units[50] * fwd_A[50]
-                * exp(fwd_beta[50] * tc[0] - activation_units[50] * fwd_Ea[50] * invT);
+    k_f = k_f_s[50];
     dlnkfdT = fwd_beta[50] * invT + activation_units[50] * fwd_Ea[50] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[12];
-    Kc = exp(-g_RT[3] + g_RT[5] + g_RT[11] - g_RT[12]);
+    Kc = Kc_s[50];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[11]) + (h_RT[3] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24766,12 +23563,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[11];
-    k_f = prefactor_units[51] * fwd_A[51]
-                * exp(fwd_beta[51] * tc[0] - activation_units[51] * fwd_Ea[51] * invT);
+    k_f = k_f_s[51];
     dlnkfdT = fwd_beta[51] * invT + activation_units[51] * fwd_Ea[51] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[12];
-    Kc = exp(-g_RT[5] + g_RT[9] + g_RT[11] - g_RT[12]);
+    Kc = Kc_s[51];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[11]) + (h_RT[5] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24817,12 +23613,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[11];
-    k_f = prefactor_units[52] * fwd_A[52]
-                * exp(fwd_beta[52] * tc[0] - activation_units[52] * fwd_Ea[52] * invT);
+    k_f = k_f_s[52];
     dlnkfdT = fwd_beta[52] * invT + activation_units[52] * fwd_Ea[52] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[12];
-    Kc = exp(g_RT[4] - g_RT[6] + g_RT[11] - g_RT[12]);
+    Kc = Kc_s[52];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[11]) + (h_RT[6] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24868,12 +23663,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[13];
-    k_f = prefactor_units[53] * fwd_A[53]
-                * exp(fwd_beta[53] * tc[0] - activation_units[53] * fwd_Ea[53] * invT);
+    k_f = k_f_s[53];
     dlnkfdT = fwd_beta[53] * invT + activation_units[53] * fwd_Ea[53] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[11];
-    Kc = exp(g_RT[3] - g_RT[7] - g_RT[11] + g_RT[13]);
+    Kc = Kc_s[53];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[13]) + (h_RT[7] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24919,12 +23713,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[13];
-    k_f = prefactor_units[54] * fwd_A[54]
-                * exp(fwd_beta[54] * tc[0] - activation_units[54] * fwd_Ea[54] * invT);
+    k_f = k_f_s[54];
     dlnkfdT = fwd_beta[54] * invT + activation_units[54] * fwd_Ea[54] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[11];
-    Kc = exp(-g_RT[5] + g_RT[6] - g_RT[11] + g_RT[13]);
+    Kc = Kc_s[54];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[13]) + (h_RT[5] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24970,12 +23763,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[13];
-    k_f = prefactor_units[55] * fwd_A[55]
-                * exp(fwd_beta[55] * tc[0] - activation_units[55] * fwd_Ea[55] * invT);
+    k_f = k_f_s[55];
     dlnkfdT = fwd_beta[55] * invT + activation_units[55] * fwd_Ea[55] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[12];
-    Kc = exp(-g_RT[3] + g_RT[6] - g_RT[12] + g_RT[13]);
+    Kc = Kc_s[55];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[13]) + (h_RT[3] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25021,12 +23813,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[13];
-    k_f = prefactor_units[56] * fwd_A[56]
-                * exp(fwd_beta[56] * tc[0] - activation_units[56] * fwd_Ea[56] * invT);
+    k_f = k_f_s[56];
     dlnkfdT = fwd_beta[56] * invT + activation_units[56] * fwd_Ea[56] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[11];
-    Kc = exp(g_RT[5] - g_RT[8] - g_RT[11] + g_RT[13]);
+    Kc = Kc_s[56];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[13]) + (h_RT[8] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25072,12 +23863,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[13];
-    k_f = prefactor_units[57] * fwd_A[57]
-                * exp(fwd_beta[57] * tc[0] - activation_units[57] * fwd_Ea[57] * invT);
+    k_f = k_f_s[57];
     dlnkfdT = fwd_beta[57] * invT + activation_units[57] * fwd_Ea[57] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[11];
-    Kc = exp(g_RT[4] - g_RT[9] - g_RT[11] + g_RT[13]);
+    Kc = Kc_s[57];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[13]) + (h_RT[9] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25123,12 +23913,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[16];
-    k_f = prefactor_units[58] * fwd_A[58]
-                * exp(fwd_beta[58] * tc[0] - activation_units[58] * fwd_Ea[58] * invT);
+    k_f = k_f_s[58];
     dlnkfdT = fwd_beta[58] * invT + activation_units[58] * fwd_Ea[58] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[15];
-    Kc = exp(-g_RT[11] + g_RT[13] - g_RT[15] + g_RT[16]);
+    Kc = Kc_s[58];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13] + h_RT[16]) + (h_RT[11] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25174,12 +23963,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[14];
-    k_f = prefactor_units[59] * fwd_A[59]
-                * exp(fwd_beta[59] * tc[0] - activation_units[59] * fwd_Ea[59] * invT);
+    k_f = k_f_s[59];
     dlnkfdT = fwd_beta[59] * invT + activation_units[59] * fwd_Ea[59] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[13];
-    Kc = exp(g_RT[3] - g_RT[7] - g_RT[13] + g_RT[14]);
+    Kc = Kc_s[59];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[14]) + (h_RT[7] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25225,12 +24013,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[14];
-    k_f = prefactor_units[60] * fwd_A[60]
-                * exp(fwd_beta[60] * tc[0] - activation_units[60] * fwd_Ea[60] * invT);
+    k_f = k_f_s[60];
     dlnkfdT = fwd_beta[60] * invT + activation_units[60] * fwd_Ea[60] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[13];
-    Kc = exp(-g_RT[5] + g_RT[6] - g_RT[13] + g_RT[14]);
+    Kc = Kc_s[60];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[14]) + (h_RT[5] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25276,12 +24063,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[14];
-    k_f = prefactor_units[61] * fwd_A[61]
-                * exp(fwd_beta[61] * tc[0] - activation_units[61] * fwd_Ea[61] * invT);
+    k_f = k_f_s[61];
     dlnkfdT = fwd_beta[61] * invT + activation_units[61] * fwd_Ea[61] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[13];
-    Kc = exp(g_RT[5] - g_RT[8] - g_RT[13] + g_RT[14]);
+    Kc = Kc_s[61];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[14]) + (h_RT[8] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25327,12 +24113,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[14];
-    k_f = prefactor_units[62] * fwd_A[62]
-                * exp(fwd_beta[62] * tc[0] - activation_units[62] * fwd_Ea[62] * invT);
+    k_f = k_f_s[62];
     dlnkfdT = fwd_beta[62] * invT + activation_units[62] * fwd_Ea[62] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[13];
-    Kc = exp(g_RT[4] - g_RT[9] - g_RT[13] + g_RT[14]);
+    Kc = Kc_s[62];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[14]) + (h_RT[9] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25378,12 +24163,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[14];
-    k_f = prefactor_units[63] * fwd_A[63]
-                * exp(fwd_beta[63] * tc[0] - activation_units[63] * fwd_Ea[63] * invT);
+    k_f = k_f_s[63];
     dlnkfdT = fwd_beta[63] * invT + activation_units[63] * fwd_Ea[63] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[13];
-    Kc = exp(g_RT[9] - g_RT[10] - g_RT[13] + g_RT[14]);
+    Kc = Kc_s[63];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[14]) + (h_RT[10] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25429,12 +24213,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[15];
-    k_f = prefactor_units[64] * fwd_A[64]
-                * exp(fwd_beta[64] * tc[0] - activation_units[64] * fwd_Ea[64] * invT);
+    k_f = k_f_s[64];
     dlnkfdT = fwd_beta[64] * invT + activation_units[64] * fwd_Ea[64] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[16];
-    Kc = exp(g_RT[3] - g_RT[7] + g_RT[15] - g_RT[16]);
+    Kc = Kc_s[64];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[15]) + (h_RT[7] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25480,12 +24263,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[15];
-    k_f = prefactor_units[65] * fwd_A[65]
-                * exp(fwd_beta[65] * tc[0] - activation_units[65] * fwd_Ea[65] * invT);
+    k_f = k_f_s[65];
     dlnkfdT = fwd_beta[65] * invT + activation_units[65] * fwd_Ea[65] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[16];
-    Kc = exp(g_RT[5] - g_RT[8] + g_RT[15] - g_RT[16]);
+    Kc = Kc_s[65];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[15]) + (h_RT[8] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25531,12 +24313,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[15];
-    k_f = prefactor_units[66] * fwd_A[66]
-                * exp(fwd_beta[66] * tc[0] - activation_units[66] * fwd_Ea[66] * invT);
+    k_f = k_f_s[66];
     dlnkfdT = fwd_beta[66] * invT + activation_units[66] * fwd_Ea[66] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[16];
-    Kc = exp(-g_RT[5] + g_RT[6] + g_RT[15] - g_RT[16]);
+    Kc = Kc_s[66];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[15]) + (h_RT[5] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25582,12 +24363,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[15];
-    k_f = prefactor_units[67] * fwd_A[67]
-                * exp(fwd_beta[67] * tc[0] - activation_units[67] * fwd_Ea[67] * invT);
+    k_f = k_f_s[67];
     dlnkfdT = fwd_beta[67] * invT + activation_units[67] * fwd_Ea[67] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[16];
-    Kc = exp(g_RT[4] - g_RT[9] + g_RT[15] - g_RT[16]);
+    Kc = Kc_s[67];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[15]) + (h_RT[9] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25633,12 +24413,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[15];
-    k_f = prefactor_units[68] * fwd_A[68]
-                * exp(fwd_beta[68] * tc[0] - activation_units[68] * fwd_Ea[68] * invT);
+    k_f = k_f_s[68];
     dlnkfdT = fwd_beta[68] * invT + activation_units[68] * fwd_Ea[68] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[16];
-    Kc = exp(g_RT[9] - g_RT[10] + g_RT[15] - g_RT[16]);
+    Kc = Kc_s[68];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[15]) + (h_RT[10] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25684,12 +24463,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[16];
-    k_f = prefactor_units[69] * fwd_A[69]
-                * exp(fwd_beta[69] * tc[0] - activation_units[69] * fwd_Ea[69] * invT);
+    k_f = k_f_s[69];
     dlnkfdT = fwd_beta[69] * invT + activation_units[69] * fwd_Ea[69] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[17];
-    Kc = exp(g_RT[3] - g_RT[7] + g_RT[16] - g_RT[17]);
+    Kc = Kc_s[69];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[16]) + (h_RT[7] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25735,12 +24513,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[16];
-    k_f = prefactor_units[70] * fwd_A[70]
-                * exp(fwd_beta[70] * tc[0] - activation_units[70] * fwd_Ea[70] * invT);
+    k_f = k_f_s[70];
     dlnkfdT = fwd_beta[70] * invT + activation_units[70] * fwd_Ea[70] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[18];
-    Kc = exp(g_RT[3] - g_RT[7] + g_RT[16] - g_RT[18]);
+    Kc = Kc_s[70];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[16]) + (h_RT[7] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25786,12 +24563,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[16];
-    k_f = prefactor_units[71] * fwd_A[71]
-                * exp(fwd_beta[71] * tc[0] - activation_units[71] * fwd_Ea[71] * invT);
+    k_f = k_f_s[71];
     dlnkfdT = fwd_beta[71] * invT + activation_units[71] * fwd_Ea[71] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[18];
-    Kc = exp(g_RT[5] - g_RT[8] + g_RT[16] - g_RT[18]);
+    Kc = Kc_s[71];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[16]) + (h_RT[8] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25837,12 +24613,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[16];
-    k_f = prefactor_units[72] * fwd_A[72]
-                * exp(fwd_beta[72] * tc[0] - activation_units[72] * fwd_Ea[72] * invT);
+    k_f = k_f_s[72];
     dlnkfdT = fwd_beta[72] * invT + activation_units[72] * fwd_Ea[72] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[14];
-    Kc = exp(-g_RT[3] + g_RT[6] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[72];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[16]) + (h_RT[3] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25888,12 +24663,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[17];
-    k_f = prefactor_units[73] * fwd_A[73]
-                * exp(fwd_beta[73] * tc[0] - activation_units[73] * fwd_Ea[73] * invT);
+    k_f = k_f_s[73];
     dlnkfdT = fwd_beta[73] * invT + activation_units[73] * fwd_Ea[73] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[19];
-    Kc = exp(-g_RT[3] + g_RT[16] + g_RT[17] - g_RT[19]);
+    Kc = Kc_s[73];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[17]) + (h_RT[3] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25939,12 +24713,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[16];
-    k_f = prefactor_units[74] * fwd_A[74]
-                * exp(fwd_beta[74] * tc[0] - activation_units[74] * fwd_Ea[74] * invT);
+    k_f = k_f_s[74];
     dlnkfdT = fwd_beta[74] * invT + activation_units[74] * fwd_Ea[74] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[20];
-    Kc = exp(-g_RT[5] + g_RT[9] + g_RT[16] - g_RT[20]);
+    Kc = Kc_s[74];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[16]) + (h_RT[5] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25990,12 +24763,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[16];
-    k_f = prefactor_units[75] * fwd_A[75]
-                * exp(fwd_beta[75] * tc[0] - activation_units[75] * fwd_Ea[75] * invT);
+    k_f = k_f_s[75];
     dlnkfdT = fwd_beta[75] * invT + activation_units[75] * fwd_Ea[75] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[14];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[75];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[16]) + (h_RT[5] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26041,12 +24813,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[16];
-    k_f = prefactor_units[76] * fwd_A[76]
-                * exp(fwd_beta[76] * tc[0] - activation_units[76] * fwd_Ea[76] * invT);
+    k_f = k_f_s[76];
     dlnkfdT = fwd_beta[76] * invT + activation_units[76] * fwd_Ea[76] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[20];
-    Kc = exp(g_RT[4] - g_RT[6] + g_RT[16] - g_RT[20]);
+    Kc = Kc_s[76];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[16]) + (h_RT[6] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26092,12 +24863,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[16];
-    k_f = prefactor_units[77] * fwd_A[77]
-                * exp(fwd_beta[77] * tc[0] - activation_units[77] * fwd_Ea[77] * invT);
+    k_f = k_f_s[77];
     dlnkfdT = fwd_beta[77] * invT + activation_units[77] * fwd_Ea[77] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[19];
-    Kc = exp(-g_RT[7] + g_RT[16] + g_RT[16] - g_RT[19]);
+    Kc = Kc_s[77];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[16]) + (h_RT[7] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26132,12 +24902,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[16];
-    k_f = prefactor_units[78] * fwd_A[78]
-                * exp(fwd_beta[78] * tc[0] - activation_units[78] * fwd_Ea[78] * invT);
+    k_f = k_f_s[78];
     dlnkfdT = fwd_beta[78] * invT + activation_units[78] * fwd_Ea[78] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[21];
-    Kc = exp(-g_RT[3] + g_RT[16] + g_RT[16] - g_RT[21]);
+    Kc = Kc_s[78];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[16]) + (h_RT[3] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26172,12 +24941,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[18];
-    k_f = prefactor_units[79] * fwd_A[79]
-                * exp(fwd_beta[79] * tc[0] - activation_units[79] * fwd_Ea[79] * invT);
+    k_f = k_f_s[79];
     dlnkfdT = fwd_beta[79] * invT + activation_units[79] * fwd_Ea[79] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[14];
-    Kc = exp(-g_RT[3] + g_RT[5] - g_RT[14] + g_RT[18]);
+    Kc = Kc_s[79];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[18]) + (h_RT[3] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26223,12 +24991,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[18];
-    k_f = prefactor_units[80] * fwd_A[80]
-                * exp(fwd_beta[80] * tc[0] - activation_units[80] * fwd_Ea[80] * invT);
+    k_f = k_f_s[80];
     dlnkfdT = fwd_beta[80] * invT + activation_units[80] * fwd_Ea[80] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[5]*sc[11];
-    Kc = refC * exp(-g_RT[3] + g_RT[4] - g_RT[5] - g_RT[11] + g_RT[18]);
+    Kc = Kc_s[80];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[18]) + (h_RT[3] + h_RT[5] + h_RT[11]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26287,12 +25054,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[18];
-    k_f = prefactor_units[81] * fwd_A[81]
-                * exp(fwd_beta[81] * tc[0] - activation_units[81] * fwd_Ea[81] * invT);
+    k_f = k_f_s[81];
     dlnkfdT = fwd_beta[81] * invT + activation_units[81] * fwd_Ea[81] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[14];
-    Kc = exp(-g_RT[11] + g_RT[12] - g_RT[14] + g_RT[18]);
+    Kc = Kc_s[81];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[18]) + (h_RT[11] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26338,12 +25104,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[17];
-    k_f = prefactor_units[82] * fwd_A[82]
-                * exp(fwd_beta[82] * tc[0] - activation_units[82] * fwd_Ea[82] * invT);
+    k_f = k_f_s[82];
     dlnkfdT = fwd_beta[82] * invT + activation_units[82] * fwd_Ea[82] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[23];
-    Kc = exp(g_RT[3] - g_RT[7] + g_RT[17] - g_RT[23]);
+    Kc = Kc_s[82];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[17]) + (h_RT[7] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26389,12 +25154,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[17];
-    k_f = prefactor_units[83] * fwd_A[83]
-                * exp(fwd_beta[83] * tc[0] - activation_units[83] * fwd_Ea[83] * invT);
+    k_f = k_f_s[83];
     dlnkfdT = fwd_beta[83] * invT + activation_units[83] * fwd_Ea[83] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[14];
-    Kc = exp(-g_RT[3] + g_RT[5] - g_RT[14] + g_RT[17]);
+    Kc = Kc_s[83];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[17]) + (h_RT[3] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26440,12 +25204,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[17];
-    k_f = prefactor_units[84] * fwd_A[84]
-                * exp(fwd_beta[84] * tc[0] - activation_units[84] * fwd_Ea[84] * invT);
+    k_f = k_f_s[84];
     dlnkfdT = fwd_beta[84] * invT + activation_units[84] * fwd_Ea[84] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[23];
-    Kc = exp(g_RT[5] - g_RT[8] + g_RT[17] - g_RT[23]);
+    Kc = Kc_s[84];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[17]) + (h_RT[8] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26491,12 +25254,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[17];
-    k_f = prefactor_units[85] * fwd_A[85]
-                * exp(fwd_beta[85] * tc[0] - activation_units[85] * fwd_Ea[85] * invT);
+    k_f = k_f_s[85];
     dlnkfdT = fwd_beta[85] * invT + activation_units[85] * fwd_Ea[85] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[3]*sc[11];
-    Kc = refC * exp(-2*g_RT[3] + g_RT[6] - g_RT[11] + g_RT[17]);
+    Kc = Kc_s[85];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[17]) + (2*h_RT[3] + h_RT[11]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26542,12 +25304,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[17];
-    k_f = prefactor_units[86] * fwd_A[86]
-                * exp(fwd_beta[86] * tc[0] - activation_units[86] * fwd_Ea[86] * invT);
+    k_f = k_f_s[86];
     dlnkfdT = fwd_beta[86] * invT + activation_units[86] * fwd_Ea[86] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[11];
-    Kc = exp(g_RT[6] - g_RT[7] - g_RT[11] + g_RT[17]);
+    Kc = Kc_s[86];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[17]) + (h_RT[7] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26593,12 +25354,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[17];
-    k_f = prefactor_units[87] * fwd_A[87]
-                * exp(fwd_beta[87] * tc[0] - activation_units[87] * fwd_Ea[87] * invT);
+    k_f = k_f_s[87];
     dlnkfdT = fwd_beta[87] * invT + activation_units[87] * fwd_Ea[87] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[12];
-    Kc = exp(g_RT[4] - g_RT[7] - g_RT[12] + g_RT[17]);
+    Kc = Kc_s[87];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[17]) + (h_RT[7] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26644,12 +25404,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[17];
-    k_f = prefactor_units[88] * fwd_A[88]
-                * exp(fwd_beta[88] * tc[0] - activation_units[88] * fwd_Ea[88] * invT);
+    k_f = k_f_s[88];
     dlnkfdT = fwd_beta[88] * invT + activation_units[88] * fwd_Ea[88] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[5]*sc[11];
-    Kc = refC * exp(-g_RT[3] + g_RT[4] - g_RT[5] - g_RT[11] + g_RT[17]);
+    Kc = Kc_s[88];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[17]) + (h_RT[3] + h_RT[5] + h_RT[11]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26708,12 +25467,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[17]*sc[17];
-    k_f = prefactor_units[89] * fwd_A[89]
-                * exp(fwd_beta[89] * tc[0] - activation_units[89] * fwd_Ea[89] * invT);
+    k_f = k_f_s[89];
     dlnkfdT = fwd_beta[89] * invT + activation_units[89] * fwd_Ea[89] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[3]*sc[24];
-    Kc = refC * exp(-2*g_RT[3] + g_RT[17] + g_RT[17] - g_RT[24]);
+    Kc = Kc_s[89];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[17]) + (2*h_RT[3] + h_RT[24]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26748,12 +25506,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[23];
-    k_f = prefactor_units[90] * fwd_A[90]
-                * exp(fwd_beta[90] * tc[0] - activation_units[90] * fwd_Ea[90] * invT);
+    k_f = k_f_s[90];
     dlnkfdT = fwd_beta[90] * invT + activation_units[90] * fwd_Ea[90] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[11];
-    Kc = exp(-g_RT[3] + g_RT[6] - g_RT[11] + g_RT[23]);
+    Kc = Kc_s[90];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[23]) + (h_RT[3] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26799,12 +25556,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[23];
-    k_f = prefactor_units[91] * fwd_A[91]
-                * exp(fwd_beta[91] * tc[0] - activation_units[91] * fwd_Ea[91] * invT);
+    k_f = k_f_s[91];
     dlnkfdT = fwd_beta[91] * invT + activation_units[91] * fwd_Ea[91] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[13];
-    Kc = exp(g_RT[4] - g_RT[6] - g_RT[13] + g_RT[23]);
+    Kc = Kc_s[91];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[23]) + (h_RT[6] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26850,12 +25606,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[23];
-    k_f = prefactor_units[92] * fwd_A[92]
-                * exp(fwd_beta[92] * tc[0] - activation_units[92] * fwd_Ea[92] * invT);
+    k_f = k_f_s[92];
     dlnkfdT = fwd_beta[92] * invT + activation_units[92] * fwd_Ea[92] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[14];
-    Kc = exp(-g_RT[3] + g_RT[8] - g_RT[14] + g_RT[23]);
+    Kc = Kc_s[92];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[23]) + (h_RT[3] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26901,12 +25656,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[23];
-    k_f = prefactor_units[93] * fwd_A[93]
-                * exp(fwd_beta[93] * tc[0] - activation_units[93] * fwd_Ea[93] * invT);
+    k_f = k_f_s[93];
     dlnkfdT = fwd_beta[93] * invT + activation_units[93] * fwd_Ea[93] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[13];
-    Kc = exp(-g_RT[11] + g_RT[12] - g_RT[13] + g_RT[23]);
+    Kc = Kc_s[93];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[23]) + (h_RT[11] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26952,12 +25706,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[20];
-    k_f = prefactor_units[94] * fwd_A[94]
-                * exp(fwd_beta[94] * tc[0] - activation_units[94] * fwd_Ea[94] * invT);
+    k_f = k_f_s[94];
     dlnkfdT = fwd_beta[94] * invT + activation_units[94] * fwd_Ea[94] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[14];
-    Kc = exp(g_RT[3] - g_RT[7] - g_RT[14] + g_RT[20]);
+    Kc = Kc_s[94];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[20]) + (h_RT[7] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27003,12 +25756,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[20];
-    k_f = prefactor_units[95] * fwd_A[95]
-                * exp(fwd_beta[95] * tc[0] - activation_units[95] * fwd_Ea[95] * invT);
+    k_f = k_f_s[95];
     dlnkfdT = fwd_beta[95] * invT + activation_units[95] * fwd_Ea[95] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[18];
-    Kc = exp(g_RT[3] - g_RT[8] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[95];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[20]) + (h_RT[8] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27054,12 +25806,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[20];
-    k_f = prefactor_units[96] * fwd_A[96]
-                * exp(fwd_beta[96] * tc[0] - activation_units[96] * fwd_Ea[96] * invT);
+    k_f = k_f_s[96];
     dlnkfdT = fwd_beta[96] * invT + activation_units[96] * fwd_Ea[96] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[14];
-    Kc = exp(g_RT[5] - g_RT[8] - g_RT[14] + g_RT[20]);
+    Kc = Kc_s[96];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[20]) + (h_RT[8] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27105,12 +25856,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[20];
-    k_f = prefactor_units[97] * fwd_A[97]
-                * exp(fwd_beta[97] * tc[0] - activation_units[97] * fwd_Ea[97] * invT);
+    k_f = k_f_s[97];
     dlnkfdT = fwd_beta[97] * invT + activation_units[97] * fwd_Ea[97] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[14];
-    Kc = exp(-g_RT[5] + g_RT[6] - g_RT[14] + g_RT[20]);
+    Kc = Kc_s[97];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[20]) + (h_RT[5] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27156,12 +25906,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[20];
-    k_f = prefactor_units[98] * fwd_A[98]
-                * exp(fwd_beta[98] * tc[0] - activation_units[98] * fwd_Ea[98] * invT);
+    k_f = k_f_s[98];
     dlnkfdT = fwd_beta[98] * invT + activation_units[98] * fwd_Ea[98] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[14];
-    Kc = exp(g_RT[4] - g_RT[9] - g_RT[14] + g_RT[20]);
+    Kc = Kc_s[98];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[20]) + (h_RT[9] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27207,12 +25956,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[22];
-    k_f = prefactor_units[99] * fwd_A[99]
-                * exp(fwd_beta[99] * tc[0] - activation_units[99] * fwd_Ea[99] * invT);
+    k_f = k_f_s[99];
     dlnkfdT = fwd_beta[99] * invT + activation_units[99] * fwd_Ea[99] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[21];
-    Kc = exp(g_RT[3] - g_RT[7] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[99];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[22]) + (h_RT[7] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27258,12 +26006,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[22];
-    k_f = prefactor_units[100] * fwd_A[100]
-                * exp(fwd_beta[100] * tc[0] - activation_units[100] * fwd_Ea[100] * invT);
+    k_f = k_f_s[100];
     dlnkfdT = fwd_beta[100] * invT + activation_units[100] * fwd_Ea[100] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[21];
-    Kc = exp(-g_RT[5] + g_RT[6] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[100];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[22]) + (h_RT[5] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27309,12 +26056,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[22];
-    k_f = prefactor_units[101] * fwd_A[101]
-                * exp(fwd_beta[101] * tc[0] - activation_units[101] * fwd_Ea[101] * invT);
+    k_f = k_f_s[101];
     dlnkfdT = fwd_beta[101] * invT + activation_units[101] * fwd_Ea[101] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[21];
-    Kc = exp(g_RT[5] - g_RT[8] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[101];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[22]) + (h_RT[8] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27360,12 +26106,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[22];
-    k_f = prefactor_units[102] * fwd_A[102]
-                * exp(fwd_beta[102] * tc[0] - activation_units[102] * fwd_Ea[102] * invT);
+    k_f = k_f_s[102];
     dlnkfdT = fwd_beta[102] * invT + activation_units[102] * fwd_Ea[102] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[21];
-    Kc = exp(-g_RT[15] + g_RT[16] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[102];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[22]) + (h_RT[15] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27411,12 +26156,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[22];
-    k_f = prefactor_units[103] * fwd_A[103]
-                * exp(fwd_beta[103] * tc[0] - activation_units[103] * fwd_Ea[103] * invT);
+    k_f = k_f_s[103];
     dlnkfdT = fwd_beta[103] * invT + activation_units[103] * fwd_Ea[103] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[21];
-    Kc = exp(g_RT[9] - g_RT[10] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[103];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[22]) + (h_RT[10] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27462,12 +26206,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[21];
-    k_f = prefactor_units[104] * fwd_A[104]
-                * exp(fwd_beta[104] * tc[0] - activation_units[104] * fwd_Ea[104] * invT);
+    k_f = k_f_s[104];
     dlnkfdT = fwd_beta[104] * invT + activation_units[104] * fwd_Ea[104] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[19];
-    Kc = exp(g_RT[3] - g_RT[7] - g_RT[19] + g_RT[21]);
+    Kc = Kc_s[104];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[21]) + (h_RT[7] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27513,12 +26256,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[21];
-    k_f = prefactor_units[105] * fwd_A[105]
-                * exp(fwd_beta[105] * tc[0] - activation_units[105] * fwd_Ea[105] * invT);
+    k_f = k_f_s[105];
     dlnkfdT = fwd_beta[105] * invT + activation_units[105] * fwd_Ea[105] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[19];
-    Kc = exp(-g_RT[5] + g_RT[6] - g_RT[19] + g_RT[21]);
+    Kc = Kc_s[105];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[21]) + (h_RT[5] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27564,12 +26306,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[21];
-    k_f = prefactor_units[106] * fwd_A[106]
-                * exp(fwd_beta[106] * tc[0] - activation_units[106] * fwd_Ea[106] * invT);
+    k_f = k_f_s[106];
     dlnkfdT = fwd_beta[106] * invT + activation_units[106] * fwd_Ea[106] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[16];
-    Kc = exp(g_RT[6] - g_RT[14] - g_RT[16] + g_RT[21]);
+    Kc = Kc_s[106];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[21]) + (h_RT[14] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27615,12 +26356,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[21];
-    k_f = prefactor_units[107] * fwd_A[107]
-                * exp(fwd_beta[107] * tc[0] - activation_units[107] * fwd_Ea[107] * invT);
+    k_f = k_f_s[107];
     dlnkfdT = fwd_beta[107] * invT + activation_units[107] * fwd_Ea[107] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[19];
-    Kc = exp(g_RT[4] - g_RT[9] - g_RT[19] + g_RT[21]);
+    Kc = Kc_s[107];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[21]) + (h_RT[9] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27666,12 +26406,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[19];
-    k_f = prefactor_units[108] * fwd_A[108]
-                * exp(fwd_beta[108] * tc[0] - activation_units[108] * fwd_Ea[108] * invT);
+    k_f = k_f_s[108];
     dlnkfdT = fwd_beta[108] * invT + activation_units[108] * fwd_Ea[108] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[25];
-    Kc = exp(g_RT[3] - g_RT[7] + g_RT[19] - g_RT[25]);
+    Kc = Kc_s[108];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[19]) + (h_RT[7] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27717,12 +26456,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[19];
-    k_f = prefactor_units[109] * fwd_A[109]
-                * exp(fwd_beta[109] * tc[0] - activation_units[109] * fwd_Ea[109] * invT);
+    k_f = k_f_s[109];
     dlnkfdT = fwd_beta[109] * invT + activation_units[109] * fwd_Ea[109] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[25];
-    Kc = exp(g_RT[5] - g_RT[8] + g_RT[19] - g_RT[25]);
+    Kc = Kc_s[109];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[19]) + (h_RT[8] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27768,12 +26506,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[19];
-    k_f = prefactor_units[110] * fwd_A[110]
-                * exp(fwd_beta[110] * tc[0] - activation_units[110] * fwd_Ea[110] * invT);
+    k_f = k_f_s[110];
     dlnkfdT = fwd_beta[110] * invT + activation_units[110] * fwd_Ea[110] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[16];
-    Kc = exp(g_RT[6] - g_RT[13] - g_RT[16] + g_RT[19]);
+    Kc = Kc_s[110];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[19]) + (h_RT[13] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27819,12 +26556,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[19];
-    k_f = prefactor_units[111] * fwd_A[111]
-                * exp(fwd_beta[111] * tc[0] - activation_units[111] * fwd_Ea[111] * invT);
+    k_f = k_f_s[111];
     dlnkfdT = fwd_beta[111] * invT + activation_units[111] * fwd_Ea[111] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[26];
-    Kc = exp(-g_RT[3] + g_RT[6] + g_RT[19] - g_RT[26]);
+    Kc = Kc_s[111];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[19]) + (h_RT[3] + h_RT[26]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27870,12 +26606,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[19]*sc[19];
-    k_f = prefactor_units[112] * fwd_A[112]
-                * exp(fwd_beta[112] * tc[0] - activation_units[112] * fwd_Ea[112] * invT);
+    k_f = k_f_s[112];
     dlnkfdT = fwd_beta[112] * invT + activation_units[112] * fwd_Ea[112] * invT2;
     /* reverse */
     phi_r = sc[21]*sc[25];
-    Kc = exp(g_RT[19] + g_RT[19] - g_RT[21] - g_RT[25]);
+    Kc = Kc_s[112];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[19]) + (h_RT[21] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27910,12 +26645,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[19];
-    k_f = prefactor_units[113] * fwd_A[113]
-                * exp(fwd_beta[113] * tc[0] - activation_units[113] * fwd_Ea[113] * invT);
+    k_f = k_f_s[113];
     dlnkfdT = fwd_beta[113] * invT + activation_units[113] * fwd_Ea[113] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[25];
-    Kc = exp(g_RT[4] - g_RT[9] + g_RT[19] - g_RT[25]);
+    Kc = Kc_s[113];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[19]) + (h_RT[9] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27961,12 +26695,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[19];
-    k_f = prefactor_units[114] * fwd_A[114]
-                * exp(fwd_beta[114] * tc[0] - activation_units[114] * fwd_Ea[114] * invT);
+    k_f = k_f_s[114];
     dlnkfdT = fwd_beta[114] * invT + activation_units[114] * fwd_Ea[114] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[27];
-    Kc = exp(-g_RT[5] + g_RT[9] + g_RT[19] - g_RT[27]);
+    Kc = Kc_s[114];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[19]) + (h_RT[5] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28012,12 +26745,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[27];
-    k_f = prefactor_units[115] * fwd_A[115]
-                * exp(fwd_beta[115] * tc[0] - activation_units[115] * fwd_Ea[115] * invT);
+    k_f = k_f_s[115];
     dlnkfdT = fwd_beta[115] * invT + activation_units[115] * fwd_Ea[115] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[11]*sc[16];
-    Kc = refC * exp(g_RT[9] - g_RT[10] - g_RT[11] - g_RT[16] + g_RT[27]);
+    Kc = Kc_s[115];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[27]) + (h_RT[10] + h_RT[11] + h_RT[16]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28076,12 +26808,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[25];
-    k_f = prefactor_units[116] * fwd_A[116]
-                * exp(fwd_beta[116] * tc[0] - activation_units[116] * fwd_Ea[116] * invT);
+    k_f = k_f_s[116];
     dlnkfdT = fwd_beta[116] * invT + activation_units[116] * fwd_Ea[116] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[24];
-    Kc = exp(g_RT[3] - g_RT[7] - g_RT[24] + g_RT[25]);
+    Kc = Kc_s[116];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[25]) + (h_RT[7] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28127,12 +26858,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[25];
-    k_f = prefactor_units[117] * fwd_A[117]
-                * exp(fwd_beta[117] * tc[0] - activation_units[117] * fwd_Ea[117] * invT);
+    k_f = k_f_s[117];
     dlnkfdT = fwd_beta[117] * invT + activation_units[117] * fwd_Ea[117] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[14];
-    Kc = exp(g_RT[4] - g_RT[13] - g_RT[14] + g_RT[25]);
+    Kc = Kc_s[117];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[25]) + (h_RT[13] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28178,12 +26908,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[25];
-    k_f = prefactor_units[118] * fwd_A[118]
-                * exp(fwd_beta[118] * tc[0] - activation_units[118] * fwd_Ea[118] * invT);
+    k_f = k_f_s[118];
     dlnkfdT = fwd_beta[118] * invT + activation_units[118] * fwd_Ea[118] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[26];
-    Kc = exp(g_RT[4] - g_RT[6] + g_RT[25] - g_RT[26]);
+    Kc = Kc_s[118];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[25]) + (h_RT[6] + h_RT[26]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28229,12 +26958,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[25];
-    k_f = prefactor_units[119] * fwd_A[119]
-                * exp(fwd_beta[119] * tc[0] - activation_units[119] * fwd_Ea[119] * invT);
+    k_f = k_f_s[119];
     dlnkfdT = fwd_beta[119] * invT + activation_units[119] * fwd_Ea[119] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[24];
-    Kc = exp(g_RT[4] - g_RT[9] - g_RT[24] + g_RT[25]);
+    Kc = Kc_s[119];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[25]) + (h_RT[9] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28280,12 +27008,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[24];
-    k_f = prefactor_units[120] * fwd_A[120]
-                * exp(fwd_beta[120] * tc[0] - activation_units[120] * fwd_Ea[120] * invT);
+    k_f = k_f_s[120];
     dlnkfdT = fwd_beta[120] * invT + activation_units[120] * fwd_Ea[120] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[29];
-    Kc = exp(-g_RT[3] + g_RT[6] + g_RT[24] - g_RT[29]);
+    Kc = Kc_s[120];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[24]) + (h_RT[3] + h_RT[29]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28331,12 +27058,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[24];
-    k_f = prefactor_units[121] * fwd_A[121]
-                * exp(fwd_beta[121] * tc[0] - activation_units[121] * fwd_Ea[121] * invT);
+    k_f = k_f_s[121];
     dlnkfdT = fwd_beta[121] * invT + activation_units[121] * fwd_Ea[121] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[17];
-    Kc = exp(g_RT[6] - g_RT[11] - g_RT[17] + g_RT[24]);
+    Kc = Kc_s[121];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[24]) + (h_RT[11] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28382,12 +27108,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[24];
-    k_f = prefactor_units[122] * fwd_A[122]
-                * exp(fwd_beta[122] * tc[0] - activation_units[122] * fwd_Ea[122] * invT);
+    k_f = k_f_s[122];
     dlnkfdT = fwd_beta[122] * invT + activation_units[122] * fwd_Ea[122] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[14];
-    Kc = exp(g_RT[4] - g_RT[11] - g_RT[14] + g_RT[24]);
+    Kc = Kc_s[122];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[24]) + (h_RT[11] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28433,12 +27158,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[24];
-    k_f = prefactor_units[123] * fwd_A[123]
-                * exp(fwd_beta[123] * tc[0] - activation_units[123] * fwd_Ea[123] * invT);
+    k_f = k_f_s[123];
     dlnkfdT = fwd_beta[123] * invT + activation_units[123] * fwd_Ea[123] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[28];
-    Kc = exp(-g_RT[3] + g_RT[5] + g_RT[24] - g_RT[28]);
+    Kc = Kc_s[123];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[24]) + (h_RT[3] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28484,12 +27208,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[24];
-    k_f = prefactor_units[124] * fwd_A[124]
-                * exp(fwd_beta[124] * tc[0] - activation_units[124] * fwd_Ea[124] * invT);
+    k_f = k_f_s[124];
     dlnkfdT = fwd_beta[124] * invT + activation_units[124] * fwd_Ea[124] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[30];
-    Kc = exp(g_RT[5] - g_RT[8] + g_RT[24] - g_RT[30]);
+    Kc = Kc_s[124];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[24]) + (h_RT[8] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28535,12 +27258,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[28];
-    k_f = prefactor_units[125] * fwd_A[125]
-                * exp(fwd_beta[125] * tc[0] - activation_units[125] * fwd_Ea[125] * invT);
+    k_f = k_f_s[125];
     dlnkfdT = fwd_beta[125] * invT + activation_units[125] * fwd_Ea[125] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[16];
-    Kc = exp(g_RT[3] - g_RT[11] - g_RT[16] + g_RT[28]);
+    Kc = Kc_s[125];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[28]) + (h_RT[11] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28586,12 +27308,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[28];
-    k_f = prefactor_units[126] * fwd_A[126]
-                * exp(fwd_beta[126] * tc[0] - activation_units[126] * fwd_Ea[126] * invT);
+    k_f = k_f_s[126];
     dlnkfdT = fwd_beta[126] * invT + activation_units[126] * fwd_Ea[126] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[17];
-    Kc = exp(g_RT[6] - g_RT[12] - g_RT[17] + g_RT[28]);
+    Kc = Kc_s[126];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[28]) + (h_RT[12] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28637,12 +27358,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[28];
-    k_f = prefactor_units[127] * fwd_A[127]
-                * exp(fwd_beta[127] * tc[0] - activation_units[127] * fwd_Ea[127] * invT);
+    k_f = k_f_s[127];
     dlnkfdT = fwd_beta[127] * invT + activation_units[127] * fwd_Ea[127] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[29];
-    Kc = exp(-g_RT[5] + g_RT[6] + g_RT[28] - g_RT[29]);
+    Kc = Kc_s[127];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[28]) + (h_RT[5] + h_RT[29]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28688,12 +27408,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[28];
-    k_f = prefactor_units[128] * fwd_A[128]
-                * exp(fwd_beta[128] * tc[0] - activation_units[128] * fwd_Ea[128] * invT);
+    k_f = k_f_s[128];
     dlnkfdT = fwd_beta[128] * invT + activation_units[128] * fwd_Ea[128] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[21];
-    Kc = exp(-g_RT[11] + g_RT[16] - g_RT[21] + g_RT[28]);
+    Kc = Kc_s[128];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[28]) + (h_RT[11] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28739,12 +27458,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[29];
-    k_f = prefactor_units[129] * fwd_A[129]
-                * exp(fwd_beta[129] * tc[0] - activation_units[129] * fwd_Ea[129] * invT);
+    k_f = k_f_s[129];
     dlnkfdT = fwd_beta[129] * invT + activation_units[129] * fwd_Ea[129] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[18];
-    Kc = exp(g_RT[3] - g_RT[11] - g_RT[18] + g_RT[29]);
+    Kc = Kc_s[129];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[29]) + (h_RT[11] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28790,12 +27508,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[29];
-    k_f = prefactor_units[130] * fwd_A[130]
-                * exp(fwd_beta[130] * tc[0] - activation_units[130] * fwd_Ea[130] * invT);
+    k_f = k_f_s[130];
     dlnkfdT = fwd_beta[130] * invT + activation_units[130] * fwd_Ea[130] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[11]*sc[13];
-    Kc = refC * exp(-g_RT[3] + g_RT[5] - g_RT[11] - g_RT[13] + g_RT[29]);
+    Kc = Kc_s[130];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[29]) + (h_RT[3] + h_RT[11] + h_RT[13]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28854,12 +27571,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[29];
-    k_f = prefactor_units[131] * fwd_A[131]
-                * exp(fwd_beta[131] * tc[0] - activation_units[131] * fwd_Ea[131] * invT);
+    k_f = k_f_s[131];
     dlnkfdT = fwd_beta[131] * invT + activation_units[131] * fwd_Ea[131] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[11]*sc[11];
-    Kc = refC * exp(-g_RT[3] + g_RT[6] - 2*g_RT[11] + g_RT[29]);
+    Kc = Kc_s[131];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[29]) + (h_RT[3] + 2*h_RT[11]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28905,12 +27621,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[29];
-    k_f = prefactor_units[132] * fwd_A[132]
-                * exp(fwd_beta[132] * tc[0] - activation_units[132] * fwd_Ea[132] * invT);
+    k_f = k_f_s[132];
     dlnkfdT = fwd_beta[132] * invT + activation_units[132] * fwd_Ea[132] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[11]*sc[11];
-    Kc = refC * exp(g_RT[4] - g_RT[5] - 2*g_RT[11] + g_RT[29]);
+    Kc = Kc_s[132];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[29]) + (h_RT[5] + 2*h_RT[11]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28956,12 +27671,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[29];
-    k_f = prefactor_units[133] * fwd_A[133]
-                * exp(fwd_beta[133] * tc[0] - activation_units[133] * fwd_Ea[133] * invT);
+    k_f = k_f_s[133];
     dlnkfdT = fwd_beta[133] * invT + activation_units[133] * fwd_Ea[133] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[11]*sc[12];
-    Kc = refC * exp(-g_RT[3] + g_RT[4] - g_RT[11] - g_RT[12] + g_RT[29]);
+    Kc = Kc_s[133];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[29]) + (h_RT[3] + h_RT[11] + h_RT[12]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29020,12 +27734,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[30];
-    k_f = prefactor_units[134] * fwd_A[134]
-                * exp(fwd_beta[134] * tc[0] - activation_units[134] * fwd_Ea[134] * invT);
+    k_f = k_f_s[134];
     dlnkfdT = fwd_beta[134] * invT + activation_units[134] * fwd_Ea[134] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[29];
-    Kc = exp(-g_RT[3] + g_RT[5] - g_RT[29] + g_RT[30]);
+    Kc = Kc_s[134];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[30]) + (h_RT[3] + h_RT[29]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29071,12 +27784,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[30];
-    k_f = prefactor_units[135] * fwd_A[135]
-                * exp(fwd_beta[135] * tc[0] - activation_units[135] * fwd_Ea[135] * invT);
+    k_f = k_f_s[135];
     dlnkfdT = fwd_beta[135] * invT + activation_units[135] * fwd_Ea[135] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[23];
-    Kc = exp(g_RT[6] - g_RT[11] - g_RT[23] + g_RT[30]);
+    Kc = Kc_s[135];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[30]) + (h_RT[11] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29122,12 +27834,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[30];
-    k_f = prefactor_units[136] * fwd_A[136]
-                * exp(fwd_beta[136] * tc[0] - activation_units[136] * fwd_Ea[136] * invT);
+    k_f = k_f_s[136];
     dlnkfdT = fwd_beta[136] * invT + activation_units[136] * fwd_Ea[136] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[29];
-    Kc = exp(g_RT[4] - g_RT[6] - g_RT[29] + g_RT[30]);
+    Kc = Kc_s[136];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[30]) + (h_RT[6] + h_RT[29]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29173,12 +27884,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[30];
-    k_f = prefactor_units[137] * fwd_A[137]
-                * exp(fwd_beta[137] * tc[0] - activation_units[137] * fwd_Ea[137] * invT);
+    k_f = k_f_s[137];
     dlnkfdT = fwd_beta[137] * invT + activation_units[137] * fwd_Ea[137] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[23];
-    Kc = exp(g_RT[4] - g_RT[12] - g_RT[23] + g_RT[30]);
+    Kc = Kc_s[137];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[30]) + (h_RT[12] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29224,12 +27934,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[30];
-    k_f = prefactor_units[138] * fwd_A[138]
-                * exp(fwd_beta[138] * tc[0] - activation_units[138] * fwd_Ea[138] * invT);
+    k_f = k_f_s[138];
     dlnkfdT = fwd_beta[138] * invT + activation_units[138] * fwd_Ea[138] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[13];
-    Kc = exp(g_RT[4] - g_RT[11] - g_RT[13] + g_RT[30]);
+    Kc = Kc_s[138];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[30]) + (h_RT[11] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29275,12 +27984,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[31];
-    k_f = prefactor_units[139] * fwd_A[139]
-                * exp(fwd_beta[139] * tc[0] - activation_units[139] * fwd_Ea[139] * invT);
+    k_f = k_f_s[139];
     dlnkfdT = fwd_beta[139] * invT + activation_units[139] * fwd_Ea[139] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[14];
-    Kc = exp(g_RT[3] - g_RT[7] - g_RT[14] + g_RT[31]);
+    Kc = Kc_s[139];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[31]) + (h_RT[7] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29326,12 +28034,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[31];
-    k_f = prefactor_units[140] * fwd_A[140]
-                * exp(fwd_beta[140] * tc[0] - activation_units[140] * fwd_Ea[140] * invT);
+    k_f = k_f_s[140];
     dlnkfdT = fwd_beta[140] * invT + activation_units[140] * fwd_Ea[140] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[16];
-    Kc = exp(g_RT[3] - g_RT[5] - g_RT[16] + g_RT[31]);
+    Kc = Kc_s[140];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[31]) + (h_RT[5] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29377,12 +28084,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[31];
-    k_f = prefactor_units[141] * fwd_A[141]
-                * exp(fwd_beta[141] * tc[0] - activation_units[141] * fwd_Ea[141] * invT);
+    k_f = k_f_s[141];
     dlnkfdT = fwd_beta[141] * invT + activation_units[141] * fwd_Ea[141] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[14];
-    Kc = exp(g_RT[5] - g_RT[8] - g_RT[14] + g_RT[31]);
+    Kc = Kc_s[141];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[31]) + (h_RT[8] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29428,12 +28134,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[31];
-    k_f = prefactor_units[142] * fwd_A[142]
-                * exp(fwd_beta[142] * tc[0] - activation_units[142] * fwd_Ea[142] * invT);
+    k_f = k_f_s[142];
     dlnkfdT = fwd_beta[142] * invT + activation_units[142] * fwd_Ea[142] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[14];
-    Kc = exp(g_RT[4] - g_RT[9] - g_RT[14] + g_RT[31]);
+    Kc = Kc_s[142];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[31]) + (h_RT[9] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29479,12 +28184,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[28];
-    k_f = prefactor_units[143] * fwd_A[143]
-                * exp(fwd_beta[143] * tc[0] - activation_units[143] * fwd_Ea[143] * invT);
+    k_f = k_f_s[143];
     dlnkfdT = fwd_beta[143] * invT + activation_units[143] * fwd_Ea[143] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[31];
-    Kc = exp(g_RT[5] - g_RT[11] + g_RT[28] - g_RT[31]);
+    Kc = Kc_s[143];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[28]) + (h_RT[11] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29530,12 +28234,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[32];
-    k_f = prefactor_units[144] * fwd_A[144]
-                * exp(fwd_beta[144] * tc[0] - activation_units[144] * fwd_Ea[144] * invT);
+    k_f = k_f_s[144];
     dlnkfdT = fwd_beta[144] * invT + activation_units[144] * fwd_Ea[144] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[31];
-    Kc = exp(g_RT[5] - g_RT[8] - g_RT[31] + g_RT[32]);
+    Kc = Kc_s[144];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[32]) + (h_RT[8] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29581,12 +28284,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[32];
-    k_f = prefactor_units[145] * fwd_A[145]
-                * exp(fwd_beta[145] * tc[0] - activation_units[145] * fwd_Ea[145] * invT);
+    k_f = k_f_s[145];
     dlnkfdT = fwd_beta[145] * invT + activation_units[145] * fwd_Ea[145] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[20];
-    Kc = exp(g_RT[5] - g_RT[8] - g_RT[20] + g_RT[32]);
+    Kc = Kc_s[145];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[32]) + (h_RT[8] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29632,12 +28334,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[32];
-    k_f = prefactor_units[146] * fwd_A[146]
-                * exp(fwd_beta[146] * tc[0] - activation_units[146] * fwd_Ea[146] * invT);
+    k_f = k_f_s[146];
     dlnkfdT = fwd_beta[146] * invT + activation_units[146] * fwd_Ea[146] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[31];
-    Kc = exp(g_RT[3] - g_RT[7] - g_RT[31] + g_RT[32]);
+    Kc = Kc_s[146];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[32]) + (h_RT[7] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29683,12 +28384,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[32];
-    k_f = prefactor_units[147] * fwd_A[147]
-                * exp(fwd_beta[147] * tc[0] - activation_units[147] * fwd_Ea[147] * invT);
+    k_f = k_f_s[147];
     dlnkfdT = fwd_beta[147] * invT + activation_units[147] * fwd_Ea[147] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[20];
-    Kc = exp(g_RT[3] - g_RT[7] - g_RT[20] + g_RT[32]);
+    Kc = Kc_s[147];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[32]) + (h_RT[7] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29734,12 +28434,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[32];
-    k_f = prefactor_units[148] * fwd_A[148]
-                * exp(fwd_beta[148] * tc[0] - activation_units[148] * fwd_Ea[148] * invT);
+    k_f = k_f_s[148];
     dlnkfdT = fwd_beta[148] * invT + activation_units[148] * fwd_Ea[148] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[31];
-    Kc = exp(-g_RT[5] + g_RT[6] - g_RT[31] + g_RT[32]);
+    Kc = Kc_s[148];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[32]) + (h_RT[5] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29785,12 +28484,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[32];
-    k_f = prefactor_units[149] * fwd_A[149]
-                * exp(fwd_beta[149] * tc[0] - activation_units[149] * fwd_Ea[149] * invT);
+    k_f = k_f_s[149];
     dlnkfdT = fwd_beta[149] * invT + activation_units[149] * fwd_Ea[149] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[31];
-    Kc = exp(g_RT[9] - g_RT[10] - g_RT[31] + g_RT[32]);
+    Kc = Kc_s[149];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[32]) + (h_RT[10] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29836,12 +28534,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[32];
-    k_f = prefactor_units[150] * fwd_A[150]
-                * exp(fwd_beta[150] * tc[0] - activation_units[150] * fwd_Ea[150] * invT);
+    k_f = k_f_s[150];
     dlnkfdT = fwd_beta[150] * invT + activation_units[150] * fwd_Ea[150] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[31];
-    Kc = exp(g_RT[4] - g_RT[9] - g_RT[31] + g_RT[32]);
+    Kc = Kc_s[150];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[32]) + (h_RT[9] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29887,12 +28584,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[26];
-    k_f = prefactor_units[151] * fwd_A[151]
-                * exp(fwd_beta[151] * tc[0] - activation_units[151] * fwd_Ea[151] * invT);
+    k_f = k_f_s[151];
     dlnkfdT = fwd_beta[151] * invT + activation_units[151] * fwd_Ea[151] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[28];
-    Kc = refC * exp(-g_RT[3] + g_RT[26] - g_RT[28]);
+    Kc = Kc_s[151];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[26]) + (h_RT[3] + h_RT[28]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29927,12 +28623,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[26];
-    k_f = prefactor_units[152] * fwd_A[152]
-                * exp(fwd_beta[152] * tc[0] - activation_units[152] * fwd_Ea[152] * invT);
+    k_f = k_f_s[152];
     dlnkfdT = fwd_beta[152] * invT + activation_units[152] * fwd_Ea[152] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[16];
-    Kc = exp(g_RT[3] - g_RT[13] - g_RT[16] + g_RT[26]);
+    Kc = Kc_s[152];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[26]) + (h_RT[13] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29978,12 +28673,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[26];
-    k_f = prefactor_units[153] * fwd_A[153]
-                * exp(fwd_beta[153] * tc[0] - activation_units[153] * fwd_Ea[153] * invT);
+    k_f = k_f_s[153];
     dlnkfdT = fwd_beta[153] * invT + activation_units[153] * fwd_Ea[153] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[28];
-    Kc = exp(g_RT[3] - g_RT[7] + g_RT[26] - g_RT[28]);
+    Kc = Kc_s[153];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[26]) + (h_RT[7] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30029,12 +28723,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[26];
-    k_f = prefactor_units[154] * fwd_A[154]
-                * exp(fwd_beta[154] * tc[0] - activation_units[154] * fwd_Ea[154] * invT);
+    k_f = k_f_s[154];
     dlnkfdT = fwd_beta[154] * invT + activation_units[154] * fwd_Ea[154] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[14];
-    Kc = exp(g_RT[6] - g_RT[13] - g_RT[14] + g_RT[26]);
+    Kc = Kc_s[154];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[26]) + (h_RT[13] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30080,12 +28773,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[26];
-    k_f = prefactor_units[155] * fwd_A[155]
-                * exp(fwd_beta[155] * tc[0] - activation_units[155] * fwd_Ea[155] * invT);
+    k_f = k_f_s[155];
     dlnkfdT = fwd_beta[155] * invT + activation_units[155] * fwd_Ea[155] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[28];
-    Kc = exp(g_RT[5] - g_RT[8] + g_RT[26] - g_RT[28]);
+    Kc = Kc_s[155];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[26]) + (h_RT[8] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30131,12 +28823,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[26];
-    k_f = prefactor_units[156] * fwd_A[156]
-                * exp(fwd_beta[156] * tc[0] - activation_units[156] * fwd_Ea[156] * invT);
+    k_f = k_f_s[156];
     dlnkfdT = fwd_beta[156] * invT + activation_units[156] * fwd_Ea[156] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[11]*sc[14];
-    Kc = refC * exp(g_RT[4] - g_RT[5] - g_RT[11] - g_RT[14] + g_RT[26]);
+    Kc = Kc_s[156];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[26]) + (h_RT[5] + h_RT[11] + h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30195,12 +28886,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[26];
-    k_f = prefactor_units[157] * fwd_A[157]
-                * exp(fwd_beta[157] * tc[0] - activation_units[157] * fwd_Ea[157] * invT);
+    k_f = k_f_s[157];
     dlnkfdT = fwd_beta[157] * invT + activation_units[157] * fwd_Ea[157] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[11]*sc[21];
-    Kc = refC * exp(-g_RT[3] - g_RT[11] + g_RT[16] - g_RT[21] + g_RT[26]);
+    Kc = Kc_s[157];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[26]) + (h_RT[3] + h_RT[11] + h_RT[21]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30259,12 +28949,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[26];
-    k_f = prefactor_units[158] * fwd_A[158]
-                * exp(fwd_beta[158] * tc[0] - activation_units[158] * fwd_Ea[158] * invT);
+    k_f = k_f_s[158];
     dlnkfdT = fwd_beta[158] * invT + activation_units[158] * fwd_Ea[158] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[13]*sc[14];
-    Kc = refC * exp(-g_RT[5] + g_RT[9] - g_RT[13] - g_RT[14] + g_RT[26]);
+    Kc = Kc_s[158];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[26]) + (h_RT[5] + h_RT[13] + h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30323,12 +29012,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[26];
-    k_f = prefactor_units[159] * fwd_A[159]
-                * exp(fwd_beta[159] * tc[0] - activation_units[159] * fwd_Ea[159] * invT);
+    k_f = k_f_s[159];
     dlnkfdT = fwd_beta[159] * invT + activation_units[159] * fwd_Ea[159] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[34];
-    Kc = exp(-g_RT[4] + g_RT[9] + g_RT[26] - g_RT[34]);
+    Kc = Kc_s[159];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[26]) + (h_RT[4] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30374,12 +29062,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[26];
-    k_f = prefactor_units[160] * fwd_A[160]
-                * exp(fwd_beta[160] * tc[0] - activation_units[160] * fwd_Ea[160] * invT);
+    k_f = k_f_s[160];
     dlnkfdT = fwd_beta[160] * invT + activation_units[160] * fwd_Ea[160] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[16];
-    Kc = refC * exp(-g_RT[11] - g_RT[16] + g_RT[26]);
+    Kc = Kc_s[160];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[26]) + (h_RT[11] + h_RT[16]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30414,12 +29101,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[34];
-    k_f = prefactor_units[161] * fwd_A[161]
-                * exp(fwd_beta[161] * tc[0] - activation_units[161] * fwd_Ea[161] * invT);
+    k_f = k_f_s[161];
     dlnkfdT = fwd_beta[161] * invT + activation_units[161] * fwd_Ea[161] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[16];
-    Kc = refC * exp(-g_RT[13] - g_RT[16] + g_RT[34]);
+    Kc = Kc_s[161];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[34]) + (h_RT[13] + h_RT[16]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30454,12 +29140,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[34];
-    k_f = prefactor_units[162] * fwd_A[162]
-                * exp(fwd_beta[162] * tc[0] - activation_units[162] * fwd_Ea[162] * invT);
+    k_f = k_f_s[162];
     dlnkfdT = fwd_beta[162] * invT + activation_units[162] * fwd_Ea[162] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[37];
-    Kc = exp(g_RT[5] - g_RT[8] + g_RT[34] - g_RT[37]);
+    Kc = Kc_s[162];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[34]) + (h_RT[8] + h_RT[37]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30505,12 +29190,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[34];
-    k_f = prefactor_units[163] * fwd_A[163]
-                * exp(fwd_beta[163] * tc[0] - activation_units[163] * fwd_Ea[163] * invT);
+    k_f = k_f_s[163];
     dlnkfdT = fwd_beta[163] * invT + activation_units[163] * fwd_Ea[163] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[26];
-    Kc = exp(g_RT[5] - g_RT[8] - g_RT[26] + g_RT[34]);
+    Kc = Kc_s[163];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[34]) + (h_RT[8] + h_RT[26]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30556,12 +29240,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[34];
-    k_f = prefactor_units[164] * fwd_A[164]
-                * exp(fwd_beta[164] * tc[0] - activation_units[164] * fwd_Ea[164] * invT);
+    k_f = k_f_s[164];
     dlnkfdT = fwd_beta[164] * invT + activation_units[164] * fwd_Ea[164] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[37];
-    Kc = exp(-g_RT[5] + g_RT[6] + g_RT[34] - g_RT[37]);
+    Kc = Kc_s[164];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[34]) + (h_RT[5] + h_RT[37]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30607,12 +29290,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[34];
-    k_f = prefactor_units[165] * fwd_A[165]
-                * exp(fwd_beta[165] * tc[0] - activation_units[165] * fwd_Ea[165] * invT);
+    k_f = k_f_s[165];
     dlnkfdT = fwd_beta[165] * invT + activation_units[165] * fwd_Ea[165] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[26];
-    Kc = exp(-g_RT[5] + g_RT[6] - g_RT[26] + g_RT[34]);
+    Kc = Kc_s[165];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[34]) + (h_RT[5] + h_RT[26]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30658,12 +29340,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[34];
-    k_f = prefactor_units[166] * fwd_A[166]
-                * exp(fwd_beta[166] * tc[0] - activation_units[166] * fwd_Ea[166] * invT);
+    k_f = k_f_s[166];
     dlnkfdT = fwd_beta[166] * invT + activation_units[166] * fwd_Ea[166] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[37];
-    Kc = exp(g_RT[3] - g_RT[7] + g_RT[34] - g_RT[37]);
+    Kc = Kc_s[166];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[34]) + (h_RT[7] + h_RT[37]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30709,12 +29390,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[34];
-    k_f = prefactor_units[167] * fwd_A[167]
-                * exp(fwd_beta[167] * tc[0] - activation_units[167] * fwd_Ea[167] * invT);
+    k_f = k_f_s[167];
     dlnkfdT = fwd_beta[167] * invT + activation_units[167] * fwd_Ea[167] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[26];
-    Kc = exp(g_RT[3] - g_RT[7] - g_RT[26] + g_RT[34]);
+    Kc = Kc_s[167];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[34]) + (h_RT[7] + h_RT[26]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30760,12 +29440,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[34];
-    k_f = prefactor_units[168] * fwd_A[168]
-                * exp(fwd_beta[168] * tc[0] - activation_units[168] * fwd_Ea[168] * invT);
+    k_f = k_f_s[168];
     dlnkfdT = fwd_beta[168] * invT + activation_units[168] * fwd_Ea[168] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[37];
-    Kc = exp(-g_RT[15] + g_RT[16] + g_RT[34] - g_RT[37]);
+    Kc = Kc_s[168];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[34]) + (h_RT[15] + h_RT[37]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30811,12 +29490,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[34];
-    k_f = prefactor_units[169] * fwd_A[169]
-                * exp(fwd_beta[169] * tc[0] - activation_units[169] * fwd_Ea[169] * invT);
+    k_f = k_f_s[169];
     dlnkfdT = fwd_beta[169] * invT + activation_units[169] * fwd_Ea[169] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[26];
-    Kc = exp(-g_RT[15] + g_RT[16] - g_RT[26] + g_RT[34]);
+    Kc = Kc_s[169];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[34]) + (h_RT[15] + h_RT[26]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30862,12 +29540,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[34];
-    k_f = prefactor_units[170] * fwd_A[170]
-                * exp(fwd_beta[170] * tc[0] - activation_units[170] * fwd_Ea[170] * invT);
+    k_f = k_f_s[170];
     dlnkfdT = fwd_beta[170] * invT + activation_units[170] * fwd_Ea[170] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[37];
-    Kc = exp(g_RT[9] - g_RT[10] + g_RT[34] - g_RT[37]);
+    Kc = Kc_s[170];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[34]) + (h_RT[10] + h_RT[37]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30913,12 +29590,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[34];
-    k_f = prefactor_units[171] * fwd_A[171]
-                * exp(fwd_beta[171] * tc[0] - activation_units[171] * fwd_Ea[171] * invT);
+    k_f = k_f_s[171];
     dlnkfdT = fwd_beta[171] * invT + activation_units[171] * fwd_Ea[171] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[26];
-    Kc = exp(g_RT[9] - g_RT[10] - g_RT[26] + g_RT[34]);
+    Kc = Kc_s[171];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[34]) + (h_RT[10] + h_RT[26]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -30964,12 +29640,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[34];
-    k_f = prefactor_units[172] * fwd_A[172]
-                * exp(fwd_beta[172] * tc[0] - activation_units[172] * fwd_Ea[172] * invT);
+    k_f = k_f_s[172];
     dlnkfdT = fwd_beta[172] * invT + activation_units[172] * fwd_Ea[172] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[37];
-    Kc = exp(g_RT[4] - g_RT[9] + g_RT[34] - g_RT[37]);
+    Kc = Kc_s[172];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[34]) + (h_RT[9] + h_RT[37]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31015,12 +29690,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[33];
-    k_f = prefactor_units[173] * fwd_A[173]
-                * exp(fwd_beta[173] * tc[0] - activation_units[173] * fwd_Ea[173] * invT);
+    k_f = k_f_s[173];
     dlnkfdT = fwd_beta[173] * invT + activation_units[173] * fwd_Ea[173] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[36];
-    Kc = exp(g_RT[5] - g_RT[8] + g_RT[33] - g_RT[36]);
+    Kc = Kc_s[173];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[33]) + (h_RT[8] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31066,12 +29740,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[33];
-    k_f = prefactor_units[174] * fwd_A[174]
-                * exp(fwd_beta[174] * tc[0] - activation_units[174] * fwd_Ea[174] * invT);
+    k_f = k_f_s[174];
     dlnkfdT = fwd_beta[174] * invT + activation_units[174] * fwd_Ea[174] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[35];
-    Kc = exp(g_RT[5] - g_RT[8] + g_RT[33] - g_RT[35]);
+    Kc = Kc_s[174];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[33]) + (h_RT[8] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31117,12 +29790,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[33];
-    k_f = prefactor_units[175] * fwd_A[175]
-                * exp(fwd_beta[175] * tc[0] - activation_units[175] * fwd_Ea[175] * invT);
+    k_f = k_f_s[175];
     dlnkfdT = fwd_beta[175] * invT + activation_units[175] * fwd_Ea[175] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[38];
-    Kc = exp(g_RT[5] - g_RT[8] + g_RT[33] - g_RT[38]);
+    Kc = Kc_s[175];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[33]) + (h_RT[8] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31168,12 +29840,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[33];
-    k_f = prefactor_units[176] * fwd_A[176]
-                * exp(fwd_beta[176] * tc[0] - activation_units[176] * fwd_Ea[176] * invT);
+    k_f = k_f_s[176];
     dlnkfdT = fwd_beta[176] * invT + activation_units[176] * fwd_Ea[176] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[36];
-    Kc = exp(g_RT[3] - g_RT[7] + g_RT[33] - g_RT[36]);
+    Kc = Kc_s[176];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[33]) + (h_RT[7] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31219,12 +29890,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[33];
-    k_f = prefactor_units[177] * fwd_A[177]
-                * exp(fwd_beta[177] * tc[0] - activation_units[177] * fwd_Ea[177] * invT);
+    k_f = k_f_s[177];
     dlnkfdT = fwd_beta[177] * invT + activation_units[177] * fwd_Ea[177] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[35];
-    Kc = exp(g_RT[3] - g_RT[7] + g_RT[33] - g_RT[35]);
+    Kc = Kc_s[177];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[33]) + (h_RT[7] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31270,12 +29940,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[33];
-    k_f = prefactor_units[178] * fwd_A[178]
-                * exp(fwd_beta[178] * tc[0] - activation_units[178] * fwd_Ea[178] * invT);
+    k_f = k_f_s[178];
     dlnkfdT = fwd_beta[178] * invT + activation_units[178] * fwd_Ea[178] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[38];
-    Kc = exp(g_RT[3] - g_RT[7] + g_RT[33] - g_RT[38]);
+    Kc = Kc_s[178];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[33]) + (h_RT[7] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31321,12 +29990,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[33];
-    k_f = prefactor_units[179] * fwd_A[179]
-                * exp(fwd_beta[179] * tc[0] - activation_units[179] * fwd_Ea[179] * invT);
+    k_f = k_f_s[179];
     dlnkfdT = fwd_beta[179] * invT + activation_units[179] * fwd_Ea[179] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[36];
-    Kc = exp(-g_RT[5] + g_RT[6] + g_RT[33] - g_RT[36]);
+    Kc = Kc_s[179];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[33]) + (h_RT[5] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31372,12 +30040,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[33];
-    k_f = prefactor_units[180] * fwd_A[180]
-                * exp(fwd_beta[180] * tc[0] - activation_units[180] * fwd_Ea[180] * invT);
+    k_f = k_f_s[180];
     dlnkfdT = fwd_beta[180] * invT + activation_units[180] * fwd_Ea[180] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[35];
-    Kc = exp(-g_RT[5] + g_RT[6] + g_RT[33] - g_RT[35]);
+    Kc = Kc_s[180];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[33]) + (h_RT[5] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31423,12 +30090,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[33];
-    k_f = prefactor_units[181] * fwd_A[181]
-                * exp(fwd_beta[181] * tc[0] - activation_units[181] * fwd_Ea[181] * invT);
+    k_f = k_f_s[181];
     dlnkfdT = fwd_beta[181] * invT + activation_units[181] * fwd_Ea[181] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[38];
-    Kc = exp(-g_RT[5] + g_RT[6] + g_RT[33] - g_RT[38]);
+    Kc = Kc_s[181];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[33]) + (h_RT[5] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31474,12 +30140,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[33];
-    k_f = prefactor_units[182] * fwd_A[182]
-                * exp(fwd_beta[182] * tc[0] - activation_units[182] * fwd_Ea[182] * invT);
+    k_f = k_f_s[182];
     dlnkfdT = fwd_beta[182] * invT + activation_units[182] * fwd_Ea[182] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[36];
-    Kc = exp(-g_RT[15] + g_RT[16] + g_RT[33] - g_RT[36]);
+    Kc = Kc_s[182];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[33]) + (h_RT[15] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31525,12 +30190,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[33];
-    k_f = prefactor_units[183] * fwd_A[183]
-                * exp(fwd_beta[183] * tc[0] - activation_units[183] * fwd_Ea[183] * invT);
+    k_f = k_f_s[183];
     dlnkfdT = fwd_beta[183] * invT + activation_units[183] * fwd_Ea[183] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[35];
-    Kc = exp(-g_RT[15] + g_RT[16] + g_RT[33] - g_RT[35]);
+    Kc = Kc_s[183];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[33]) + (h_RT[15] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31576,12 +30240,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[33];
-    k_f = prefactor_units[184] * fwd_A[184]
-                * exp(fwd_beta[184] * tc[0] - activation_units[184] * fwd_Ea[184] * invT);
+    k_f = k_f_s[184];
     dlnkfdT = fwd_beta[184] * invT + activation_units[184] * fwd_Ea[184] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[38];
-    Kc = exp(-g_RT[15] + g_RT[16] + g_RT[33] - g_RT[38]);
+    Kc = Kc_s[184];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[33]) + (h_RT[15] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31627,12 +30290,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[33];
-    k_f = prefactor_units[185] * fwd_A[185]
-                * exp(fwd_beta[185] * tc[0] - activation_units[185] * fwd_Ea[185] * invT);
+    k_f = k_f_s[185];
     dlnkfdT = fwd_beta[185] * invT + activation_units[185] * fwd_Ea[185] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[35];
-    Kc = exp(g_RT[9] - g_RT[10] + g_RT[33] - g_RT[35]);
+    Kc = Kc_s[185];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[33]) + (h_RT[10] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31678,12 +30340,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[33];
-    k_f = prefactor_units[186] * fwd_A[186]
-                * exp(fwd_beta[186] * tc[0] - activation_units[186] * fwd_Ea[186] * invT);
+    k_f = k_f_s[186];
     dlnkfdT = fwd_beta[186] * invT + activation_units[186] * fwd_Ea[186] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[36];
-    Kc = exp(g_RT[9] - g_RT[10] + g_RT[33] - g_RT[36]);
+    Kc = Kc_s[186];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[33]) + (h_RT[10] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31729,12 +30390,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[33];
-    k_f = prefactor_units[187] * fwd_A[187]
-                * exp(fwd_beta[187] * tc[0] - activation_units[187] * fwd_Ea[187] * invT);
+    k_f = k_f_s[187];
     dlnkfdT = fwd_beta[187] * invT + activation_units[187] * fwd_Ea[187] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[38];
-    Kc = exp(g_RT[9] - g_RT[10] + g_RT[33] - g_RT[38]);
+    Kc = Kc_s[187];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[33]) + (h_RT[10] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31780,12 +30440,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[19];
-    k_f = prefactor_units[188] * fwd_A[188]
-                * exp(fwd_beta[188] * tc[0] - activation_units[188] * fwd_Ea[188] * invT);
+    k_f = k_f_s[188];
     dlnkfdT = fwd_beta[188] * invT + activation_units[188] * fwd_Ea[188] * invT2;
     /* reverse */
     phi_r = sc[36];
-    Kc = refCinv * exp(g_RT[5] + g_RT[19] - g_RT[36]);
+    Kc = Kc_s[188];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[19]) + (h_RT[36]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31820,12 +30479,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[21];
-    k_f = prefactor_units[189] * fwd_A[189]
-                * exp(fwd_beta[189] * tc[0] - activation_units[189] * fwd_Ea[189] * invT);
+    k_f = k_f_s[189];
     dlnkfdT = fwd_beta[189] * invT + activation_units[189] * fwd_Ea[189] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[38];
-    Kc = exp(-g_RT[5] + g_RT[9] + g_RT[21] - g_RT[38]);
+    Kc = Kc_s[189];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[21]) + (h_RT[5] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31871,12 +30529,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[38];
-    k_f = prefactor_units[190] * fwd_A[190]
-                * exp(fwd_beta[190] * tc[0] - activation_units[190] * fwd_Ea[190] * invT);
+    k_f = k_f_s[190];
     dlnkfdT = fwd_beta[190] * invT + activation_units[190] * fwd_Ea[190] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[34];
-    Kc = exp(g_RT[4] - g_RT[9] - g_RT[34] + g_RT[38]);
+    Kc = Kc_s[190];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[38]) + (h_RT[9] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31922,12 +30579,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[38];
-    k_f = prefactor_units[191] * fwd_A[191]
-                * exp(fwd_beta[191] * tc[0] - activation_units[191] * fwd_Ea[191] * invT);
+    k_f = k_f_s[191];
     dlnkfdT = fwd_beta[191] * invT + activation_units[191] * fwd_Ea[191] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[21];
-    Kc = exp(g_RT[11] - g_RT[12] - g_RT[21] + g_RT[38]);
+    Kc = Kc_s[191];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[38]) + (h_RT[12] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -31973,12 +30629,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[38];
-    k_f = prefactor_units[192] * fwd_A[192]
-                * exp(fwd_beta[192] * tc[0] - activation_units[192] * fwd_Ea[192] * invT);
+    k_f = k_f_s[192];
     dlnkfdT = fwd_beta[192] * invT + activation_units[192] * fwd_Ea[192] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[31];
-    Kc = exp(g_RT[3] - g_RT[16] - g_RT[31] + g_RT[38]);
+    Kc = Kc_s[192];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[38]) + (h_RT[16] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32024,12 +30679,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[38];
-    k_f = prefactor_units[193] * fwd_A[193]
-                * exp(fwd_beta[193] * tc[0] - activation_units[193] * fwd_Ea[193] * invT);
+    k_f = k_f_s[193];
     dlnkfdT = fwd_beta[193] * invT + activation_units[193] * fwd_Ea[193] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[19];
-    Kc = exp(g_RT[3] - g_RT[8] - g_RT[19] + g_RT[38]);
+    Kc = Kc_s[193];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[38]) + (h_RT[8] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32075,12 +30729,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[38];
-    k_f = prefactor_units[194] * fwd_A[194]
-                * exp(fwd_beta[194] * tc[0] - activation_units[194] * fwd_Ea[194] * invT);
+    k_f = k_f_s[194];
     dlnkfdT = fwd_beta[194] * invT + activation_units[194] * fwd_Ea[194] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[34];
-    Kc = exp(g_RT[5] - g_RT[8] - g_RT[34] + g_RT[38]);
+    Kc = Kc_s[194];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[38]) + (h_RT[8] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32126,12 +30779,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[35];
-    k_f = prefactor_units[195] * fwd_A[195]
-                * exp(fwd_beta[195] * tc[0] - activation_units[195] * fwd_Ea[195] * invT);
+    k_f = k_f_s[195];
     dlnkfdT = fwd_beta[195] * invT + activation_units[195] * fwd_Ea[195] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[34];
-    Kc = exp(g_RT[4] - g_RT[9] - g_RT[34] + g_RT[35]);
+    Kc = Kc_s[195];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[35]) + (h_RT[9] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32177,12 +30829,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[35];
-    k_f = prefactor_units[196] * fwd_A[196]
-                * exp(fwd_beta[196] * tc[0] - activation_units[196] * fwd_Ea[196] * invT);
+    k_f = k_f_s[196];
     dlnkfdT = fwd_beta[196] * invT + activation_units[196] * fwd_Ea[196] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[34];
-    Kc = exp(-g_RT[5] + g_RT[6] - g_RT[34] + g_RT[35]);
+    Kc = Kc_s[196];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[35]) + (h_RT[5] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32228,12 +30879,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[35];
-    k_f = prefactor_units[197] * fwd_A[197]
-                * exp(fwd_beta[197] * tc[0] - activation_units[197] * fwd_Ea[197] * invT);
+    k_f = k_f_s[197];
     dlnkfdT = fwd_beta[197] * invT + activation_units[197] * fwd_Ea[197] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[19];
-    Kc = exp(g_RT[3] - g_RT[8] - g_RT[19] + g_RT[35]);
+    Kc = Kc_s[197];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[35]) + (h_RT[8] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32279,12 +30929,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[35];
-    k_f = prefactor_units[198] * fwd_A[198]
-                * exp(fwd_beta[198] * tc[0] - activation_units[198] * fwd_Ea[198] * invT);
+    k_f = k_f_s[198];
     dlnkfdT = fwd_beta[198] * invT + activation_units[198] * fwd_Ea[198] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[31];
-    Kc = exp(g_RT[3] - g_RT[16] - g_RT[31] + g_RT[35]);
+    Kc = Kc_s[198];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[35]) + (h_RT[16] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32330,12 +30979,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[35];
-    k_f = prefactor_units[199] * fwd_A[199]
-                * exp(fwd_beta[199] * tc[0] - activation_units[199] * fwd_Ea[199] * invT);
+    k_f = k_f_s[199];
     dlnkfdT = fwd_beta[199] * invT + activation_units[199] * fwd_Ea[199] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[5]*sc[34];
-    Kc = refC * exp(-g_RT[5] - g_RT[5] + g_RT[9] - g_RT[34] + g_RT[35]);
+    Kc = Kc_s[199];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[35]) + (2*h_RT[5] + h_RT[34]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32381,12 +31029,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[35];
-    k_f = prefactor_units[200] * fwd_A[200]
-                * exp(fwd_beta[200] * tc[0] - activation_units[200] * fwd_Ea[200] * invT);
+    k_f = k_f_s[200];
     dlnkfdT = fwd_beta[200] * invT + activation_units[200] * fwd_Ea[200] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[34];
-    Kc = exp(g_RT[5] - g_RT[8] - g_RT[34] + g_RT[35]);
+    Kc = Kc_s[200];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[35]) + (h_RT[8] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32432,12 +31079,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[39];
-    k_f = prefactor_units[201] * fwd_A[201]
-                * exp(fwd_beta[201] * tc[0] - activation_units[201] * fwd_Ea[201] * invT);
+    k_f = k_f_s[201];
     dlnkfdT = fwd_beta[201] * invT + activation_units[201] * fwd_Ea[201] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[19];
-    Kc = exp(g_RT[6] - g_RT[11] - g_RT[19] + g_RT[39]);
+    Kc = Kc_s[201];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[39]) + (h_RT[11] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32483,12 +31129,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[24];
-    k_f = prefactor_units[202] * fwd_A[202]
-                * exp(fwd_beta[202] * tc[0] - activation_units[202] * fwd_Ea[202] * invT);
+    k_f = k_f_s[202];
     dlnkfdT = fwd_beta[202] * invT + activation_units[202] * fwd_Ea[202] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[39];
-    Kc = exp(-g_RT[3] + g_RT[16] + g_RT[24] - g_RT[39]);
+    Kc = Kc_s[202];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[24]) + (h_RT[3] + h_RT[39]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32534,12 +31179,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[39];
-    k_f = prefactor_units[203] * fwd_A[203]
-                * exp(fwd_beta[203] * tc[0] - activation_units[203] * fwd_Ea[203] * invT);
+    k_f = k_f_s[203];
     dlnkfdT = fwd_beta[203] * invT + activation_units[203] * fwd_Ea[203] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[29];
-    Kc = exp(g_RT[6] - g_RT[16] - g_RT[29] + g_RT[39]);
+    Kc = Kc_s[203];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[39]) + (h_RT[16] + h_RT[29]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32585,12 +31229,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[40];
-    k_f = prefactor_units[204] * fwd_A[204]
-                * exp(fwd_beta[204] * tc[0] - activation_units[204] * fwd_Ea[204] * invT);
+    k_f = k_f_s[204];
     dlnkfdT = fwd_beta[204] * invT + activation_units[204] * fwd_Ea[204] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[39];
-    Kc = exp(-g_RT[4] + g_RT[9] - g_RT[39] + g_RT[40]);
+    Kc = Kc_s[204];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[40]) + (h_RT[4] + h_RT[39]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32636,12 +31279,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[39];
-    k_f = prefactor_units[205] * fwd_A[205]
-                * exp(fwd_beta[205] * tc[0] - activation_units[205] * fwd_Ea[205] * invT);
+    k_f = k_f_s[205];
     dlnkfdT = fwd_beta[205] * invT + activation_units[205] * fwd_Ea[205] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[40];
-    Kc = exp(g_RT[5] - g_RT[8] + g_RT[39] - g_RT[40]);
+    Kc = Kc_s[205];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[39]) + (h_RT[8] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32687,12 +31329,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[40];
-    k_f = prefactor_units[206] * fwd_A[206]
-                * exp(fwd_beta[206] * tc[0] - activation_units[206] * fwd_Ea[206] * invT);
+    k_f = k_f_s[206];
     dlnkfdT = fwd_beta[206] * invT + activation_units[206] * fwd_Ea[206] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[28];
-    Kc = exp(g_RT[4] - g_RT[13] - g_RT[28] + g_RT[40]);
+    Kc = Kc_s[206];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[40]) + (h_RT[13] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32738,12 +31379,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[41];
-    k_f = prefactor_units[207] * fwd_A[207]
-                * exp(fwd_beta[207] * tc[0] - activation_units[207] * fwd_Ea[207] * invT);
+    k_f = k_f_s[207];
     dlnkfdT = fwd_beta[207] * invT + activation_units[207] * fwd_Ea[207] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[39];
-    Kc = exp(g_RT[3] - g_RT[7] - g_RT[39] + g_RT[41]);
+    Kc = Kc_s[207];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[41]) + (h_RT[7] + h_RT[39]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32789,12 +31429,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[41];
-    k_f = prefactor_units[208] * fwd_A[208]
-                * exp(fwd_beta[208] * tc[0] - activation_units[208] * fwd_Ea[208] * invT);
+    k_f = k_f_s[208];
     dlnkfdT = fwd_beta[208] * invT + activation_units[208] * fwd_Ea[208] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[39];
-    Kc = exp(g_RT[4] - g_RT[9] - g_RT[39] + g_RT[41]);
+    Kc = Kc_s[208];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[41]) + (h_RT[9] + h_RT[39]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32840,12 +31479,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[41];
-    k_f = prefactor_units[209] * fwd_A[209]
-                * exp(fwd_beta[209] * tc[0] - activation_units[209] * fwd_Ea[209] * invT);
+    k_f = k_f_s[209];
     dlnkfdT = fwd_beta[209] * invT + activation_units[209] * fwd_Ea[209] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[39];
-    Kc = exp(-g_RT[15] + g_RT[16] - g_RT[39] + g_RT[41]);
+    Kc = Kc_s[209];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[41]) + (h_RT[15] + h_RT[39]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32891,12 +31529,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[41];
-    k_f = prefactor_units[210] * fwd_A[210]
-                * exp(fwd_beta[210] * tc[0] - activation_units[210] * fwd_Ea[210] * invT);
+    k_f = k_f_s[210];
     dlnkfdT = fwd_beta[210] * invT + activation_units[210] * fwd_Ea[210] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[39];
-    Kc = exp(g_RT[5] - g_RT[8] - g_RT[39] + g_RT[41]);
+    Kc = Kc_s[210];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[41]) + (h_RT[8] + h_RT[39]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32942,12 +31579,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[13]*sc[40];
-    k_f = prefactor_units[211] * fwd_A[211]
-                * exp(fwd_beta[211] * tc[0] - activation_units[211] * fwd_Ea[211] * invT);
+    k_f = k_f_s[211];
     dlnkfdT = fwd_beta[211] * invT + activation_units[211] * fwd_Ea[211] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[39];
-    Kc = exp(-g_RT[11] + g_RT[13] - g_RT[39] + g_RT[40]);
+    Kc = Kc_s[211];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[13] + h_RT[40]) + (h_RT[11] + h_RT[39]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -32993,12 +31629,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[40];
-    k_f = prefactor_units[212] * fwd_A[212]
-                * exp(fwd_beta[212] * tc[0] - activation_units[212] * fwd_Ea[212] * invT);
+    k_f = k_f_s[212];
     dlnkfdT = fwd_beta[212] * invT + activation_units[212] * fwd_Ea[212] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[11]*sc[25];
-    Kc = refC * exp(-g_RT[5] + g_RT[9] - g_RT[11] - g_RT[25] + g_RT[40]);
+    Kc = Kc_s[212];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[40]) + (h_RT[5] + h_RT[11] + h_RT[25]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33057,12 +31692,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[39];
-    k_f = prefactor_units[213] * fwd_A[213]
-                * exp(fwd_beta[213] * tc[0] - activation_units[213] * fwd_Ea[213] * invT);
+    k_f = k_f_s[213];
     dlnkfdT = fwd_beta[213] * invT + activation_units[213] * fwd_Ea[213] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[13]*sc[16];
-    Kc = refC * exp(g_RT[4] - g_RT[11] - g_RT[13] - g_RT[16] + g_RT[39]);
+    Kc = Kc_s[213];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[39]) + (h_RT[11] + h_RT[13] + h_RT[16]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33121,12 +31755,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[42];
-    k_f = prefactor_units[214] * fwd_A[214]
-                * exp(fwd_beta[214] * tc[0] - activation_units[214] * fwd_Ea[214] * invT);
+    k_f = k_f_s[214];
     dlnkfdT = fwd_beta[214] * invT + activation_units[214] * fwd_Ea[214] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[21];
-    Kc = exp(g_RT[6] - g_RT[13] - g_RT[21] + g_RT[42]);
+    Kc = Kc_s[214];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[42]) + (h_RT[13] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33172,12 +31805,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[42];
-    k_f = prefactor_units[215] * fwd_A[215]
-                * exp(fwd_beta[215] * tc[0] - activation_units[215] * fwd_Ea[215] * invT);
+    k_f = k_f_s[215];
     dlnkfdT = fwd_beta[215] * invT + activation_units[215] * fwd_Ea[215] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[41];
-    Kc = exp(g_RT[5] - g_RT[8] - g_RT[41] + g_RT[42]);
+    Kc = Kc_s[215];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[42]) + (h_RT[8] + h_RT[41]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33223,12 +31855,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[42];
-    k_f = prefactor_units[216] * fwd_A[216]
-                * exp(fwd_beta[216] * tc[0] - activation_units[216] * fwd_Ea[216] * invT);
+    k_f = k_f_s[216];
     dlnkfdT = fwd_beta[216] * invT + activation_units[216] * fwd_Ea[216] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[16]*sc[28];
-    Kc = refC * exp(-g_RT[3] + g_RT[6] - g_RT[16] - g_RT[28] + g_RT[42]);
+    Kc = Kc_s[216];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[42]) + (h_RT[3] + h_RT[16] + h_RT[28]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33287,12 +31918,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[42];
-    k_f = prefactor_units[217] * fwd_A[217]
-                * exp(fwd_beta[217] * tc[0] - activation_units[217] * fwd_Ea[217] * invT);
+    k_f = k_f_s[217];
     dlnkfdT = fwd_beta[217] * invT + activation_units[217] * fwd_Ea[217] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[41];
-    Kc = exp(g_RT[3] - g_RT[7] - g_RT[41] + g_RT[42]);
+    Kc = Kc_s[217];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[42]) + (h_RT[7] + h_RT[41]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33338,12 +31968,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[41];
-    k_f = prefactor_units[218] * fwd_A[218]
-                * exp(fwd_beta[218] * tc[0] - activation_units[218] * fwd_Ea[218] * invT);
+    k_f = k_f_s[218];
     dlnkfdT = fwd_beta[218] * invT + activation_units[218] * fwd_Ea[218] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[42];
-    Kc = exp(-g_RT[4] + g_RT[9] + g_RT[41] - g_RT[42]);
+    Kc = Kc_s[218];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[41]) + (h_RT[4] + h_RT[42]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33389,12 +32018,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[41];
-    k_f = prefactor_units[219] * fwd_A[219]
-                * exp(fwd_beta[219] * tc[0] - activation_units[219] * fwd_Ea[219] * invT);
+    k_f = k_f_s[219];
     dlnkfdT = fwd_beta[219] * invT + activation_units[219] * fwd_Ea[219] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[14]*sc[25];
-    Kc = refC * exp(-g_RT[5] + g_RT[9] - g_RT[14] - g_RT[25] + g_RT[41]);
+    Kc = Kc_s[219];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[41]) + (h_RT[5] + h_RT[14] + h_RT[25]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33453,12 +32081,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[42];
-    k_f = prefactor_units[220] * fwd_A[220]
-                * exp(fwd_beta[220] * tc[0] - activation_units[220] * fwd_Ea[220] * invT);
+    k_f = k_f_s[220];
     dlnkfdT = fwd_beta[220] * invT + activation_units[220] * fwd_Ea[220] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[19];
-    Kc = exp(g_RT[3] - g_RT[16] - g_RT[19] + g_RT[42]);
+    Kc = Kc_s[220];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[42]) + (h_RT[16] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33504,12 +32131,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[25];
-    k_f = prefactor_units[221] * fwd_A[221]
-                * exp(fwd_beta[221] * tc[0] - activation_units[221] * fwd_Ea[221] * invT);
+    k_f = k_f_s[221];
     dlnkfdT = fwd_beta[221] * invT + activation_units[221] * fwd_Ea[221] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[41];
-    Kc = exp(-g_RT[3] + g_RT[16] + g_RT[25] - g_RT[41]);
+    Kc = Kc_s[221];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[25]) + (h_RT[3] + h_RT[41]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33555,12 +32181,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[43];
-    k_f = prefactor_units[222] * fwd_A[222]
-                * exp(fwd_beta[222] * tc[0] - activation_units[222] * fwd_Ea[222] * invT);
+    k_f = k_f_s[222];
     dlnkfdT = fwd_beta[222] * invT + activation_units[222] * fwd_Ea[222] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[44];
-    Kc = exp(g_RT[4] - g_RT[9] + g_RT[43] - g_RT[44]);
+    Kc = Kc_s[222];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[43]) + (h_RT[9] + h_RT[44]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33606,12 +32231,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[43];
-    k_f = prefactor_units[223] * fwd_A[223]
-                * exp(fwd_beta[223] * tc[0] - activation_units[223] * fwd_Ea[223] * invT);
+    k_f = k_f_s[223];
     dlnkfdT = fwd_beta[223] * invT + activation_units[223] * fwd_Ea[223] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[45];
-    Kc = exp(g_RT[4] - g_RT[9] + g_RT[43] - g_RT[45]);
+    Kc = Kc_s[223];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[43]) + (h_RT[9] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33657,12 +32281,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[43];
-    k_f = prefactor_units[224] * fwd_A[224]
-                * exp(fwd_beta[224] * tc[0] - activation_units[224] * fwd_Ea[224] * invT);
+    k_f = k_f_s[224];
     dlnkfdT = fwd_beta[224] * invT + activation_units[224] * fwd_Ea[224] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[44];
-    Kc = exp(g_RT[3] - g_RT[7] + g_RT[43] - g_RT[44]);
+    Kc = Kc_s[224];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[43]) + (h_RT[7] + h_RT[44]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33708,12 +32331,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[43];
-    k_f = prefactor_units[225] * fwd_A[225]
-                * exp(fwd_beta[225] * tc[0] - activation_units[225] * fwd_Ea[225] * invT);
+    k_f = k_f_s[225];
     dlnkfdT = fwd_beta[225] * invT + activation_units[225] * fwd_Ea[225] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[45];
-    Kc = exp(g_RT[3] - g_RT[7] + g_RT[43] - g_RT[45]);
+    Kc = Kc_s[225];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[43]) + (h_RT[7] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33759,12 +32381,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[43];
-    k_f = prefactor_units[226] * fwd_A[226]
-                * exp(fwd_beta[226] * tc[0] - activation_units[226] * fwd_Ea[226] * invT);
+    k_f = k_f_s[226];
     dlnkfdT = fwd_beta[226] * invT + activation_units[226] * fwd_Ea[226] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[44];
-    Kc = exp(-g_RT[5] + g_RT[6] + g_RT[43] - g_RT[44]);
+    Kc = Kc_s[226];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[43]) + (h_RT[5] + h_RT[44]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33810,12 +32431,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[43];
-    k_f = prefactor_units[227] * fwd_A[227]
-                * exp(fwd_beta[227] * tc[0] - activation_units[227] * fwd_Ea[227] * invT);
+    k_f = k_f_s[227];
     dlnkfdT = fwd_beta[227] * invT + activation_units[227] * fwd_Ea[227] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[45];
-    Kc = exp(-g_RT[5] + g_RT[6] + g_RT[43] - g_RT[45]);
+    Kc = Kc_s[227];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[43]) + (h_RT[5] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33861,12 +32481,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[43];
-    k_f = prefactor_units[228] * fwd_A[228]
-                * exp(fwd_beta[228] * tc[0] - activation_units[228] * fwd_Ea[228] * invT);
+    k_f = k_f_s[228];
     dlnkfdT = fwd_beta[228] * invT + activation_units[228] * fwd_Ea[228] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[45];
-    Kc = exp(g_RT[5] - g_RT[8] + g_RT[43] - g_RT[45]);
+    Kc = Kc_s[228];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[43]) + (h_RT[8] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33912,12 +32531,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[43];
-    k_f = prefactor_units[229] * fwd_A[229]
-                * exp(fwd_beta[229] * tc[0] - activation_units[229] * fwd_Ea[229] * invT);
+    k_f = k_f_s[229];
     dlnkfdT = fwd_beta[229] * invT + activation_units[229] * fwd_Ea[229] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[44];
-    Kc = exp(g_RT[5] - g_RT[8] + g_RT[43] - g_RT[44]);
+    Kc = Kc_s[229];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[43]) + (h_RT[8] + h_RT[44]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33963,12 +32581,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[43];
-    k_f = prefactor_units[230] * fwd_A[230]
-                * exp(fwd_beta[230] * tc[0] - activation_units[230] * fwd_Ea[230] * invT);
+    k_f = k_f_s[230];
     dlnkfdT = fwd_beta[230] * invT + activation_units[230] * fwd_Ea[230] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[44];
-    Kc = exp(g_RT[9] - g_RT[10] + g_RT[43] - g_RT[44]);
+    Kc = Kc_s[230];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[43]) + (h_RT[10] + h_RT[44]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34014,12 +32631,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[43];
-    k_f = prefactor_units[231] * fwd_A[231]
-                * exp(fwd_beta[231] * tc[0] - activation_units[231] * fwd_Ea[231] * invT);
+    k_f = k_f_s[231];
     dlnkfdT = fwd_beta[231] * invT + activation_units[231] * fwd_Ea[231] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[45];
-    Kc = exp(g_RT[9] - g_RT[10] + g_RT[43] - g_RT[45]);
+    Kc = Kc_s[231];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[43]) + (h_RT[10] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34065,12 +32681,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[43]*sc[44];
-    k_f = prefactor_units[232] * fwd_A[232]
-                * exp(fwd_beta[232] * tc[0] - activation_units[232] * fwd_Ea[232] * invT);
+    k_f = k_f_s[232];
     dlnkfdT = fwd_beta[232] * invT + activation_units[232] * fwd_Ea[232] * invT2;
     /* reverse */
     phi_r = sc[43]*sc[45];
-    Kc = exp(g_RT[43] - g_RT[43] + g_RT[44] - g_RT[45]);
+    Kc = Kc_s[232];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[43] + h_RT[44]) + (h_RT[43] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34100,12 +32715,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[44];
-    k_f = prefactor_units[233] * fwd_A[233]
-                * exp(fwd_beta[233] * tc[0] - activation_units[233] * fwd_Ea[233] * invT);
+    k_f = k_f_s[233];
     dlnkfdT = fwd_beta[233] * invT + activation_units[233] * fwd_Ea[233] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[42];
-    Kc = exp(g_RT[4] - g_RT[9] - g_RT[42] + g_RT[44]);
+    Kc = Kc_s[233];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[44]) + (h_RT[9] + h_RT[42]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34151,12 +32765,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[45];
-    k_f = prefactor_units[234] * fwd_A[234]
-                * exp(fwd_beta[234] * tc[0] - activation_units[234] * fwd_Ea[234] * invT);
+    k_f = k_f_s[234];
     dlnkfdT = fwd_beta[234] * invT + activation_units[234] * fwd_Ea[234] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[42];
-    Kc = exp(g_RT[4] - g_RT[9] - g_RT[42] + g_RT[45]);
+    Kc = Kc_s[234];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[45]) + (h_RT[9] + h_RT[42]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34210,6 +32823,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         dcvpRdT(dcRdT, tc);
         speciesInternalEnergy(e_RT, tc);
         eh_RT = &e_RT[0];
+        for (int k=0; k<46; k++) {
+            for (int m=0; m<46; m++) {
+                J[k*47+m] += Jmix[m];
+            }
+        }
     }
 
     double cmix = 0.0, ehmix = 0.0, dcmixdT=0.0, dehmixdT=0.0;
@@ -41067,6 +39685,55 @@ void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double
     *ierr = 0;
     return;
 }
+/* get temperature given enthalpy in mass units and mass fracs */
+void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int * ierr)
+{
+#ifdef CONVERGENCE
+    const int maxiter = 5000;
+    const double tol  = 1.e-12;
+#else
+    const int maxiter = 200;
+    const double tol  = 1.e-6;
+#endif
+    double hin  = *h;
+    double tmin = 250;/*max lower bound for thermo def */
+    double tmax = 4000;/*min upper bound for thermo def */
+    double h1,hmin,hmax,cp,t1,dt;
+    int i;/* loop counter */
+    CKHBMS(&tmin, y, iwrk, rwrk, &hmin);
+    CKHBMS(&tmax, y, iwrk, rwrk, &hmax);
+    if (hin < hmin) {
+        /*Linear Extrapolation below tmin */
+        CKCPBS(&tmin, y, iwrk, rwrk, &cp);
+        *t = tmin - (hmin-hin)/cp;
+        *ierr = 1;
+        return;
+    }
+    if (hin > hmax) {
+        /*Linear Extrapolation above tmax */
+        CKCPBS(&tmax, y, iwrk, rwrk, &cp);
+        *t = tmax - (hmax-hin)/cp;
+        *ierr = 1;
+        return;
+    }
+    t1 = *t;
+    if (t1 < tmin || t1 > tmax) {
+        t1 = tmin + (tmax-tmin)/(hmax-hmin)*(hin-hmin);
+    }
+    for (i = 0; i < maxiter; ++i) {
+        CKHBMS(&t1,y,iwrk,rwrk,&h1);
+        CKCPBS(&t1,y,iwrk,rwrk,&cp);
+        dt = (hin - h1) / cp;
+        if (dt > 100.) { dt = 100.; }
+        else if (dt < -100.) { dt = -100.; }
+        else if (fabs(dt) < tol) break;
+        else if (t1+dt == t1) break;
+        t1 += dt;
+    }
+    *t = t1;
+    *ierr = 0;
+    return;
+}
 
 /* End of file  */
 #if defined(BL_FORT_USE_UPPERCASE)
@@ -1,5 +1,6 @@
 
 #include <math.h>
+#include <float.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -86,6 +87,12 @@
 #define VCKPY VCKPY
 #define VCKWYR VCKWYR
 #define VCKYTX VCKYTX
+#define VCKCPBS VCKCPBS
+#define VCKCVBS VCKCVBS
+#define VCKHBMS VCKHBMS
+#define VCKUBMS VCKUBMS
+#define VCKRHOY VCKRHOY
+#define VCKMMWY VCKMMWY
 #define GET_T_GIVEN_EY GET_T_GIVEN_EY
 #define GET_T_GIVEN_HY GET_T_GIVEN_HY
 #define GET_REACTION_MAP GET_REACTION_MAP
@@ -171,6 +178,12 @@
 #define VCKPY vckpy
 #define VCKWYR vckwyr
 #define VCKYTX vckytx
+#define VCKCPBS vckcpbs
+#define VCKCVBS vckcvbs
+#define VCKHBMS vckhbms
+#define VCKUBMS vckubms
+#define VCKRHOY vckrhoy
+#define VCKMMWY vckmmwy
 #define GET_T_GIVEN_EY get_t_given_ey
 #define GET_T_GIVEN_HY get_t_given_hy
 #define GET_REACTION_MAP get_reaction_map
@@ -256,6 +269,12 @@
 #define VCKPY vckpy_
 #define VCKWYR vckwyr_
 #define VCKYTX vckytx_
+#define VCKCPBS vckcpbs_
+#define VCKCVBS vckcvbs_
+#define VCKHBMS vckhbms_
+#define VCKUBMS vckubms_
+#define VCKRHOY vckrhoy_
+#define VCKMMWY vckmmwy_
 #define GET_T_GIVEN_EY get_t_given_ey_
 #define GET_T_GIVEN_HY get_t_given_hy_
 #define GET_REACTION_MAP get_reaction_map_
@@ -369,6 +388,12 @@ void VCKWYR(int * restrict np, double * restrict rho, double * restrict T,
             double * restrict y, int * restrict iwrk, double * restrict rwrk,
             double * restrict wdot);
 void VCKYTX(int * restrict np, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict x);
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs);
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs);
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms);
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms);
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho);
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm);
 void vcomp_k_f(int npt, double * restrict k_f_s, double * restrict tc, double * restrict invT);
 void vcomp_gibbs(int npt, double * restrict g_RT, double * restrict tc);
 void vcomp_Kc(int npt, double * restrict Kc_s, double * restrict g_RT, double * restrict invT);
@@ -3060,38 +3085,6 @@ void CKINDX(int * iwrk, double * restrict rwrk, int * mm, int * kk, int * ii, in
 }
 
 
-/* strtok_r: re-entrant (threadsafe) version of strtok, helper function for tokenizing strings  */
-char *strtok_r(char *s, const char *delim, char **save_ptr)
-{
-    char *token;
-
-    if (s == NULL)
-        s = *save_ptr;
-
-    /* Scan leading delimiters.  */
-    s += strspn (s, delim);
-    if (*s == '\0')
-    {
-        *save_ptr = s;
-        return NULL;
-    }
-
-    /* Find the end of the token.  */
-    token = s;
-    s = strpbrk (token, delim);
-    if (s == NULL)
-        /* This token finishes the string.  */
-        *save_ptr = __rawmemchr (token, '\0');
-    else
-    {
-        /* Terminate the token and make *SAVE_PTR point past it.  */
-        *s = '\0';
-        *save_ptr = s + 1;
-    }
-    return token;
-}
-
-
 
 /* ckxnum... for parsing strings  */
 void CKXNUM(char * line, int * nexp, int * lout, int * nval, double * restrict rval, int * kerr, int lenline )
@@ -3635,6 +3628,28 @@ void CKRHOY(double * restrict P, double * restrict T, double * restrict y, int *
 }
 
 
+/*Compute rho = P*W(y)/RT */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho)
+{
+    for (int i=0; i<(*np); i++) {
+        rho[i] = 0.0;
+    }
+
+    for (int n=0; n<34; n++) {
+        for (int i=0; i<(*np); i++) {
+            rho[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        rho[i] = P[i] / (8.31451e+07 * T[i] * rho[i]);/*rho = P*W/(R*T) */
+    }
+
+    return;
+}
+
+
 /*Compute rho = P*W(c)/(R*T) */
 void CKRHOC(double * restrict P, double * restrict T, double * restrict c, int * iwrk, double * restrict rwrk, double * restrict rho)
 {
@@ -3721,6 +3736,29 @@ void CKMMWY(double * restrict y, int * iwrk, double * restrict rwrk, double * re
 }
 
 
+/*given y[species]: mass fractions */
+/*returns mean molecular weight (gm/mole) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm)
+{
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 0.0;
+    }
+
+    for (int n=0; n<34; n++) {
+        for (int i=0; i<(*np); i++) {
+            wtm[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 1.0 / wtm[i];
+    }
+
+    return;
+}
+
+
 /*given x[species]: mole fractions */
 /*returns mean molecular weight (gm/mole) */
 void CKMMWX(double * restrict x, int * iwrk, double * restrict rwrk, double * restrict wtm)
@@ -4591,6 +4629,30 @@ void CKCPBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CP (Eq. 34) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs)
+{
+    double tc[5], tmp[34], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cp_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<34; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cpbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean specific heat at CV (Eq. 35) */
 void CKCVBL(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict cvbl)
 {
@@ -4658,6 +4720,30 @@ void CKCVBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CV (Eq. 36) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs)
+{
+    double tc[5], tmp[34], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cv_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<34; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cvbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean enthalpy of the mixture in molar units */
 void CKHBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict hbml)
 {
@@ -4699,6 +4785,30 @@ void CKHBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns mean enthalpy of mixture in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms)
+{
+    double tc[5], tmp[34], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesEnthalpy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<34; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        hbms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mean internal energy in molar units */
 void CKUBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict ubml)
 {
@@ -4768,6 +4878,30 @@ void CKUBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*get mean internal energy in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms)
+{
+    double tc[5], tmp[34], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesInternalEnergy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<34; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        ubms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mixture entropy in molar units */
 void CKSBML(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict sbml)
 {
@@ -11701,12 +11835,234 @@ void productionRate(double * restrict wdot, double * restrict sc, double T)
 
 void comp_k_f(double * restrict tc, double invT, double * restrict k_f)
 {
+    double x[212];
+#ifdef __INTEL_COMPILER
+    #pragma simd
+#endif
+    for (int i=0; i<212; ++i) {
+        x[i] = fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT;
+    };
+
+    /*the exp is skipped when the exponent is zero or that of */
+    /*an earlier reaction with the same default beta and Ea */
+    k_f[0] = exp(x[0]);
+    k_f[1] = exp(x[1]);
+    k_f[2] = (x[2] == 0.0 ? 1.0 : exp(x[2]));
+    k_f[3] = exp(x[3]);
+    k_f[4] = exp(x[4]);
+    k_f[5] = exp(x[5]);
+    k_f[6] = exp(x[6]);
+    k_f[7] = exp(x[7]);
+    k_f[8] = (x[8] == 0.0 ? 1.0 : exp(x[8]));
+    k_f[9] = exp(x[9]);
+    k_f[10] = (x[10] == 0.0 ? 1.0 : exp(x[10]));
+    k_f[11] = (x[11] == 0.0 ? 1.0 : exp(x[11]));
+    k_f[12] = (x[12] == 0.0 ? 1.0 : exp(x[12]));
+    k_f[13] = exp(x[13]);
+    k_f[14] = exp(x[14]);
+    k_f[15] = (x[15] == 0.0 ? 1.0 : exp(x[15]));
+    k_f[16] = (x[16] == 0.0 ? 1.0 : exp(x[16]));
+    k_f[17] = exp(x[17]);
+    k_f[18] = (x[18] == x[5] ? k_f[5] : exp(x[18]));
+    k_f[19] = exp(x[19]);
+    k_f[20] = (x[20] == x[5] ? k_f[5] : exp(x[20]));
+    k_f[21] = (x[21] == x[5] ? k_f[5] : exp(x[21]));
+    k_f[22] = exp(x[22]);
+    k_f[23] = exp(x[23]);
+    k_f[24] = exp(x[24]);
+    k_f[25] = exp(x[25]);
+    k_f[26] = exp(x[26]);
+    k_f[27] = exp(x[27]);
+    k_f[28] = exp(x[28]);
+    k_f[29] = (x[29] == x[19] ? k_f[19] : exp(x[29]));
+    k_f[30] = exp(x[30]);
+    k_f[31] = exp(x[31]);
+    k_f[32] = exp(x[32]);
+    k_f[33] = (x[33] == 0.0 ? 1.0 : exp(x[33]));
+    k_f[34] = exp(x[34]);
+    k_f[35] = exp(x[35]);
+    k_f[36] = exp(x[36]);
+    k_f[37] = exp(x[37]);
+    k_f[38] = exp(x[38]);
+    k_f[39] = exp(x[39]);
+    k_f[40] = exp(x[40]);
+    k_f[41] = exp(x[41]);
+    k_f[42] = exp(x[42]);
+    k_f[43] = (x[43] == 0.0 ? 1.0 : exp(x[43]));
+    k_f[44] = (x[44] == 0.0 ? 1.0 : exp(x[44]));
+    k_f[45] = (x[45] == 0.0 ? 1.0 : exp(x[45]));
+    k_f[46] = (x[46] == 0.0 ? 1.0 : exp(x[46]));
+    k_f[47] = (x[47] == x[22] ? k_f[22] : exp(x[47]));
+    k_f[48] = exp(x[48]);
+    k_f[49] = (x[49] == 0.0 ? 1.0 : exp(x[49]));
+    k_f[50] = (x[50] == 0.0 ? 1.0 : exp(x[50]));
+    k_f[51] = exp(x[51]);
+    k_f[52] = exp(x[52]);
+    k_f[53] = (x[53] == 0.0 ? 1.0 : exp(x[53]));
+    k_f[54] = exp(x[54]);
+    k_f[55] = (x[55] == 0.0 ? 1.0 : exp(x[55]));
+    k_f[56] = (x[56] == 0.0 ? 1.0 : exp(x[56]));
+    k_f[57] = exp(x[57]);
+    k_f[58] = exp(x[58]);
+    k_f[59] = exp(x[59]);
+    k_f[60] = (x[60] == x[59] ? k_f[59] : exp(x[60]));
+    k_f[61] = (x[61] == 0.0 ? 1.0 : exp(x[61]));
+    k_f[62] = (x[62] == 0.0 ? 1.0 : exp(x[62]));
+    k_f[63] = (x[63] == 0.0 ? 1.0 : exp(x[63]));
+    k_f[64] = exp(x[64]);
+    k_f[65] = (x[65] == 0.0 ? 1.0 : exp(x[65]));
+    k_f[66] = (x[66] == 0.0 ? 1.0 : exp(x[66]));
+    k_f[67] = (x[67] == 0.0 ? 1.0 : exp(x[67]));
+    k_f[68] = (x[68] == 0.0 ? 1.0 : exp(x[68]));
+    k_f[69] = (x[69] == 0.0 ? 1.0 : exp(x[69]));
+    k_f[70] = (x[70] == 0.0 ? 1.0 : exp(x[70]));
+    k_f[71] = (x[71] == 0.0 ? 1.0 : exp(x[71]));
+    k_f[72] = (x[72] == 0.0 ? 1.0 : exp(x[72]));
+    k_f[73] = (x[73] == 0.0 ? 1.0 : exp(x[73]));
+    k_f[74] = (x[74] == 0.0 ? 1.0 : exp(x[74]));
+    k_f[75] = (x[75] == 0.0 ? 1.0 : exp(x[75]));
+    k_f[76] = exp(x[76]);
+    k_f[77] = exp(x[77]);
+    k_f[78] = exp(x[78]);
+    k_f[79] = exp(x[79]);
+    k_f[80] = (x[80] == 0.0 ? 1.0 : exp(x[80]));
+    k_f[81] = exp(x[81]);
+    k_f[82] = (x[82] == 0.0 ? 1.0 : exp(x[82]));
+    k_f[83] = exp(x[83]);
+    k_f[84] = (x[84] == 0.0 ? 1.0 : exp(x[84]));
+    k_f[85] = (x[85] == 0.0 ? 1.0 : exp(x[85]));
+    k_f[86] = exp(x[86]);
+    k_f[87] = (x[87] == 0.0 ? 1.0 : exp(x[87]));
+    k_f[88] = (x[88] == 0.0 ? 1.0 : exp(x[88]));
+    k_f[89] = (x[89] == 0.0 ? 1.0 : exp(x[89]));
+    k_f[90] = (x[90] == 0.0 ? 1.0 : exp(x[90]));
+    k_f[91] = (x[91] == x[59] ? k_f[59] : exp(x[91]));
+    k_f[92] = exp(x[92]);
+    k_f[93] = (x[93] == 0.0 ? 1.0 : exp(x[93]));
+    k_f[94] = (x[94] == 0.0 ? 1.0 : exp(x[94]));
+    k_f[95] = (x[95] == 0.0 ? 1.0 : exp(x[95]));
+    k_f[96] = (x[96] == 0.0 ? 1.0 : exp(x[96]));
+    k_f[97] = (x[97] == 0.0 ? 1.0 : exp(x[97]));
+    k_f[98] = (x[98] == 0.0 ? 1.0 : exp(x[98]));
+    k_f[99] = exp(x[99]);
+    k_f[100] = (x[100] == 0.0 ? 1.0 : exp(x[100]));
+    k_f[101] = (x[101] == 0.0 ? 1.0 : exp(x[101]));
+    k_f[102] = (x[102] == 0.0 ? 1.0 : exp(x[102]));
+    k_f[103] = (x[103] == 0.0 ? 1.0 : exp(x[103]));
+    k_f[104] = exp(x[104]);
+    k_f[105] = exp(x[105]);
+    k_f[106] = (x[106] == x[105] ? k_f[105] : exp(x[106]));
+    k_f[107] = exp(x[107]);
+    k_f[108] = exp(x[108]);
+    k_f[109] = exp(x[109]);
+    k_f[110] = exp(x[110]);
+    k_f[111] = (x[111] == 0.0 ? 1.0 : exp(x[111]));
+    k_f[112] = exp(x[112]);
+    k_f[113] = exp(x[113]);
+    k_f[114] = exp(x[114]);
+    k_f[115] = exp(x[115]);
+    k_f[116] = exp(x[116]);
+    k_f[117] = (x[117] == 0.0 ? 1.0 : exp(x[117]));
+    k_f[118] = (x[118] == 0.0 ? 1.0 : exp(x[118]));
+    k_f[119] = (x[119] == 0.0 ? 1.0 : exp(x[119]));
+    k_f[120] = exp(x[120]);
+    k_f[121] = exp(x[121]);
+    k_f[122] = (x[122] == 0.0 ? 1.0 : exp(x[122]));
+    k_f[123] = (x[123] == 0.0 ? 1.0 : exp(x[123]));
+    k_f[124] = exp(x[124]);
+    k_f[125] = (x[125] == 0.0 ? 1.0 : exp(x[125]));
+    k_f[126] = (x[126] == 0.0 ? 1.0 : exp(x[126]));
+    k_f[127] = (x[127] == 0.0 ? 1.0 : exp(x[127]));
+    k_f[128] = (x[128] == 0.0 ? 1.0 : exp(x[128]));
+    k_f[129] = (x[129] == 0.0 ? 1.0 : exp(x[129]));
+    k_f[130] = exp(x[130]);
+    k_f[131] = exp(x[131]);
+    k_f[132] = exp(x[132]);
+    k_f[133] = exp(x[133]);
+    k_f[134] = exp(x[134]);
+    k_f[135] = exp(x[135]);
+    k_f[136] = exp(x[136]);
+    k_f[137] = (x[137] == x[136] ? k_f[136] : exp(x[137]));
+    k_f[138] = exp(x[138]);
+    k_f[139] = (x[139] == 0.0 ? 1.0 : exp(x[139]));
+    k_f[140] = (x[140] == 0.0 ? 1.0 : exp(x[140]));
+    k_f[141] = exp(x[141]);
+    k_f[142] = (x[142] == 0.0 ? 1.0 : exp(x[142]));
+    k_f[143] = exp(x[143]);
+    k_f[144] = exp(x[144]);
+    k_f[145] = (x[145] == 0.0 ? 1.0 : exp(x[145]));
+    k_f[146] = (x[146] == 0.0 ? 1.0 : exp(x[146]));
+    k_f[147] = (x[147] == 0.0 ? 1.0 : exp(x[147]));
+    k_f[148] = (x[148] == 0.0 ? 1.0 : exp(x[148]));
+    k_f[149] = (x[149] == 0.0 ? 1.0 : exp(x[149]));
+    k_f[150] = (x[150] == 0.0 ? 1.0 : exp(x[150]));
+    k_f[151] = (x[151] == 0.0 ? 1.0 : exp(x[151]));
+    k_f[152] = (x[152] == 0.0 ? 1.0 : exp(x[152]));
+    k_f[153] = exp(x[153]);
+    k_f[154] = exp(x[154]);
+    k_f[155] = exp(x[155]);
+    k_f[156] = exp(x[156]);
+    k_f[157] = exp(x[157]);
+    k_f[158] = (x[158] == 0.0 ? 1.0 : exp(x[158]));
+    k_f[159] = exp(x[159]);
+    k_f[160] = exp(x[160]);
+    k_f[161] = exp(x[161]);
+    k_f[162] = exp(x[162]);
+    k_f[163] = (x[163] == x[153] ? k_f[153] : exp(x[163]));
+    k_f[164] = exp(x[164]);
+    k_f[165] = exp(x[165]);
+    k_f[166] = (x[166] == x[165] ? k_f[165] : exp(x[166]));
+    k_f[167] = exp(x[167]);
+    k_f[168] = (x[168] == 0.0 ? 1.0 : exp(x[168]));
+    k_f[169] = (x[169] == 0.0 ? 1.0 : exp(x[169]));
+    k_f[170] = (x[170] == 0.0 ? 1.0 : exp(x[170]));
+    k_f[171] = exp(x[171]);
+    k_f[172] = (x[172] == 0.0 ? 1.0 : exp(x[172]));
+    k_f[173] = exp(x[173]);
+    k_f[174] = exp(x[174]);
+    k_f[175] = exp(x[175]);
+    k_f[176] = (x[176] == 0.0 ? 1.0 : exp(x[176]));
+    k_f[177] = (x[177] == 0.0 ? 1.0 : exp(x[177]));
+    k_f[178] = (x[178] == 0.0 ? 1.0 : exp(x[178]));
+    k_f[179] = exp(x[179]);
+    k_f[180] = (x[180] == 0.0 ? 1.0 : exp(x[180]));
+    k_f[181] = (x[181] == 0.0 ? 1.0 : exp(x[181]));
+    k_f[182] = (x[182] == 0.0 ? 1.0 : exp(x[182]));
+    k_f[183] = exp(x[183]);
+    k_f[184] = exp(x[184]);
+    k_f[185] = exp(x[185]);
+    k_f[186] = exp(x[186]);
+    k_f[187] = exp(x[187]);
+    k_f[188] = exp(x[188]);
+    k_f[189] = exp(x[189]);
+    k_f[190] = exp(x[190]);
+    k_f[191] = exp(x[191]);
+    k_f[192] = (x[192] == x[77] ? k_f[77] : exp(x[192]));
+    k_f[193] = (x[193] == x[78] ? k_f[78] : exp(x[193]));
+    k_f[194] = (x[194] == 0.0 ? 1.0 : exp(x[194]));
+    k_f[195] = (x[195] == 0.0 ? 1.0 : exp(x[195]));
+    k_f[196] = (x[196] == 0.0 ? 1.0 : exp(x[196]));
+    k_f[197] = (x[197] == 0.0 ? 1.0 : exp(x[197]));
+    k_f[198] = (x[198] == 0.0 ? 1.0 : exp(x[198]));
+    k_f[199] = (x[199] == 0.0 ? 1.0 : exp(x[199]));
+    k_f[200] = (x[200] == 0.0 ? 1.0 : exp(x[200]));
+    k_f[201] = (x[201] == 0.0 ? 1.0 : exp(x[201]));
+    k_f[202] = (x[202] == 0.0 ? 1.0 : exp(x[202]));
+    k_f[203] = (x[203] == 0.0 ? 1.0 : exp(x[203]));
+    k_f[204] = exp(x[204]);
+    k_f[205] = exp(x[205]);
+    k_f[206] = exp(x[206]);
+    k_f[207] = exp(x[207]);
+    k_f[208] = exp(x[208]);
+    k_f[209] = exp(x[209]);
+    k_f[210] = exp(x[210]);
+    k_f[211] = exp(x[211]);
+
 #ifdef __INTEL_COMPILER
     #pragma simd
 #endif
     for (int i=0; i<212; ++i) {
-        k_f[i] = prefactor_units[i] * fwd_A[i]
-                    * exp(fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT);
+        k_f[i] *= prefactor_units[i] * fwd_A[i];
     };
     return;
 }
@@ -11717,283 +12073,508 @@ void comp_Kc(double * restrict tc, double invT, double * restrict Kc)
     double g_RT[34];
     gibbs(g_RT, tc);
 
-    Kc[0] = g_RT[0] - g_RT[3] + g_RT[6];
-    Kc[1] = g_RT[4] - g_RT[12] + g_RT[13];
-    Kc[2] = g_RT[7] + g_RT[13] - g_RT[20];
-    Kc[3] = g_RT[0] + g_RT[11] - g_RT[12];
-    Kc[4] = g_RT[0] + g_RT[8] - g_RT[10];
-    Kc[5] = g_RT[0] + g_RT[16] - g_RT[17];
-    Kc[6] = -g_RT[0] - g_RT[17] + g_RT[18];
-    Kc[7] = g_RT[0] + g_RT[18] - g_RT[19];
-    Kc[8] = g_RT[10] + g_RT[18] - g_RT[28];
-    Kc[9] = g_RT[10] + g_RT[13] - g_RT[21];
-    Kc[10] = g_RT[0] + g_RT[21] - g_RT[22];
-    Kc[11] = g_RT[10] + g_RT[11] - g_RT[22];
-    Kc[12] = g_RT[0] + g_RT[26] - g_RT[28];
-    Kc[13] = g_RT[0] + g_RT[28] - g_RT[29];
-    Kc[14] = g_RT[0] + g_RT[28] - g_RT[30];
-    Kc[15] = g_RT[0] + g_RT[30] - g_RT[31];
-    Kc[16] = g_RT[0] + g_RT[29] - g_RT[31];
-    Kc[17] = g_RT[1] + g_RT[13] - g_RT[14];
-    Kc[18] = 2*g_RT[0] - g_RT[4];
-    Kc[19] = g_RT[0] + g_RT[2] - g_RT[5];
-    Kc[20] = g_RT[0] + g_RT[1] - g_RT[2];
-    Kc[21] = 2*g_RT[1] - g_RT[6];
-    Kc[22] = -g_RT[0] + g_RT[11] - g_RT[13];
-    Kc[23] = g_RT[0] - g_RT[1] - g_RT[2] + g_RT[6];
-    Kc[24] = -g_RT[0] + g_RT[1] - g_RT[2] + g_RT[4];
-    Kc[25] = -g_RT[0] + g_RT[2] + g_RT[4] - g_RT[5];
-    Kc[26] = -g_RT[1] + 2*g_RT[2] - g_RT[5];
-    Kc[27] = 2*g_RT[0] + g_RT[4] - 2*g_RT[4];
-    Kc[28] = 2*g_RT[0] - g_RT[4] + g_RT[5] - g_RT[5];
-    Kc[29] = 2*g_RT[0] - g_RT[4] + g_RT[14] - g_RT[14];
-    Kc[30] = -g_RT[0] - g_RT[3] + g_RT[4] + g_RT[6];
-    Kc[31] = g_RT[0] - g_RT[1] + g_RT[3] - g_RT[5];
-    Kc[32] = g_RT[0] - 2*g_RT[2] + g_RT[3];
-    Kc[33] = g_RT[1] - g_RT[2] + g_RT[3] - g_RT[6];
-    Kc[34] = g_RT[2] + g_RT[3] - g_RT[5] - g_RT[6];
-    Kc[35] = g_RT[2] + g_RT[3] - g_RT[5] - g_RT[6];
-    Kc[36] = g_RT[2] + g_RT[3] - g_RT[5] - g_RT[6];
-    Kc[37] = g_RT[2] + g_RT[3] - g_RT[5] - g_RT[6];
-    Kc[38] = g_RT[2] + g_RT[3] - g_RT[5] - g_RT[6];
-    Kc[39] = -g_RT[0] + g_RT[2] + g_RT[13] - g_RT[14];
-    Kc[40] = -g_RT[0] + g_RT[2] + g_RT[13] - g_RT[14];
-    Kc[41] = -g_RT[1] + g_RT[6] + g_RT[13] - g_RT[14];
-    Kc[42] = -g_RT[2] + g_RT[3] + g_RT[13] - g_RT[14];
-    Kc[43] = g_RT[0] - g_RT[4] + g_RT[11] - g_RT[13];
-    Kc[44] = g_RT[1] - g_RT[2] + g_RT[11] - g_RT[13];
-    Kc[45] = -g_RT[0] + g_RT[1] + g_RT[11] - g_RT[14];
-    Kc[46] = g_RT[2] - g_RT[5] + g_RT[11] - g_RT[13];
-    Kc[47] = -g_RT[0] + g_RT[5] - g_RT[5] + g_RT[11] - g_RT[13];
-    Kc[48] = -g_RT[3] + g_RT[6] + g_RT[11] - g_RT[13];
-    Kc[49] = -g_RT[0] + g_RT[1] + g_RT[7] - g_RT[13];
-    Kc[50] = -g_RT[0] + g_RT[2] + g_RT[7] - g_RT[11];
-    Kc[51] = -g_RT[0] + g_RT[4] + g_RT[7] - g_RT[8];
-    Kc[52] = -g_RT[0] + g_RT[5] + g_RT[7] - g_RT[12];
-    Kc[53] = -g_RT[1] + g_RT[6] + g_RT[7] - g_RT[11];
-    Kc[54] = g_RT[7] - g_RT[11] - g_RT[13] + g_RT[14];
-    Kc[55] = -g_RT[0] + g_RT[1] + g_RT[8] - g_RT[11];
-    Kc[56] = -g_RT[0] + g_RT[2] + g_RT[8] - g_RT[12];
-    Kc[57] = g_RT[2] - g_RT[5] - g_RT[7] + g_RT[8];
-    Kc[58] = -g_RT[0] + g_RT[4] + g_RT[8] - g_RT[10];
-    Kc[59] = -g_RT[2] + g_RT[6] + g_RT[8] - g_RT[11];
-    Kc[60] = -2*g_RT[0] + g_RT[6] + g_RT[8] - g_RT[14];
-    Kc[61] = -g_RT[2] + g_RT[3] + g_RT[8] - g_RT[12];
-    Kc[62] = -g_RT[0] + g_RT[7] + g_RT[8] - g_RT[17];
-    Kc[63] = -g_RT[4] + 2*g_RT[8] - g_RT[17];
-    Kc[64] = -g_RT[8] + g_RT[9] + g_RT[33] - g_RT[33];
-    Kc[65] = g_RT[0] - g_RT[4] - g_RT[7] + g_RT[9];
-    Kc[66] = g_RT[1] - g_RT[4] + g_RT[9] - g_RT[13];
-    Kc[67] = -g_RT[0] + g_RT[1] + g_RT[9] - g_RT[11];
-    Kc[68] = -g_RT[0] + g_RT[2] + g_RT[9] - g_RT[12];
-    Kc[69] = -g_RT[0] + g_RT[4] + g_RT[9] - g_RT[10];
-    Kc[70] = -g_RT[0] - g_RT[2] + g_RT[6] + g_RT[9] - g_RT[13];
-    Kc[71] = -g_RT[5] + g_RT[6] + g_RT[9] - g_RT[13];
-    Kc[72] = g_RT[5] - g_RT[5] - g_RT[8] + g_RT[9];
-    Kc[73] = -g_RT[8] + g_RT[9] + g_RT[13] - g_RT[13];
-    Kc[74] = -g_RT[8] + g_RT[9] + g_RT[14] - g_RT[14];
-    Kc[75] = g_RT[9] - g_RT[12] - g_RT[13] + g_RT[14];
-    Kc[76] = g_RT[0] - g_RT[4] - g_RT[11] + g_RT[12];
-    Kc[77] = g_RT[1] - g_RT[2] - g_RT[11] + g_RT[12];
-    Kc[78] = g_RT[2] - g_RT[5] - g_RT[11] + g_RT[12];
-    Kc[79] = -g_RT[3] + g_RT[6] - g_RT[11] + g_RT[12];
-    Kc[80] = -g_RT[0] + g_RT[1] + g_RT[10] - g_RT[12];
-    Kc[81] = g_RT[2] - g_RT[5] - g_RT[8] + g_RT[10];
-    Kc[82] = g_RT[2] - g_RT[5] - g_RT[9] + g_RT[10];
-    Kc[83] = -g_RT[2] + g_RT[6] + g_RT[10] - g_RT[12];
-    Kc[84] = -g_RT[0] + g_RT[7] + g_RT[10] - g_RT[18];
-    Kc[85] = -g_RT[0] + g_RT[8] + g_RT[10] - g_RT[19];
-    Kc[86] = -g_RT[0] + g_RT[9] + g_RT[10] - g_RT[19];
-    Kc[87] = g_RT[10] - g_RT[13] - g_RT[19] + g_RT[20];
-    Kc[88] = -g_RT[0] + g_RT[10] + g_RT[16] - g_RT[23];
-    Kc[89] = g_RT[1] - g_RT[7] - g_RT[13] + g_RT[16];
-    Kc[90] = -g_RT[0] + g_RT[2] + g_RT[16] - g_RT[20];
-    Kc[91] = g_RT[6] - g_RT[11] - g_RT[13] + g_RT[16];
-    Kc[92] = -g_RT[0] + g_RT[4] + g_RT[16] - g_RT[17];
-    Kc[93] = g_RT[0] - g_RT[7] - g_RT[13] + g_RT[15];
-    Kc[94] = g_RT[1] - 2*g_RT[13] + g_RT[15];
-    Kc[95] = -g_RT[0] + g_RT[2] - 2*g_RT[13] + g_RT[15];
-    Kc[96] = -g_RT[1] + g_RT[6] - 2*g_RT[13] + g_RT[15];
-    Kc[97] = g_RT[0] - g_RT[9] - g_RT[13] + g_RT[20];
-    Kc[98] = -g_RT[0] + g_RT[1] - 2*g_RT[13] + g_RT[20];
-    Kc[99] = -g_RT[2] + g_RT[6] - 2*g_RT[13] + g_RT[20];
-    Kc[100] = g_RT[7] - g_RT[13] - g_RT[17] + g_RT[20];
-    Kc[101] = g_RT[8] - g_RT[13] - g_RT[18] + g_RT[20];
-    Kc[102] = -2*g_RT[13] - g_RT[17] + 2*g_RT[20];
-    Kc[103] = g_RT[2] - g_RT[5] - g_RT[15] + g_RT[20];
-    Kc[104] = g_RT[1] - g_RT[2] - g_RT[16] + g_RT[17];
-    Kc[105] = g_RT[1] - g_RT[8] - g_RT[13] + g_RT[17];
-    Kc[106] = -g_RT[0] + g_RT[1] + g_RT[17] - g_RT[20];
-    Kc[107] = g_RT[2] - g_RT[5] - g_RT[16] + g_RT[17];
-    Kc[108] = g_RT[2] - g_RT[10] - g_RT[13] + g_RT[17];
-    Kc[109] = g_RT[11] - g_RT[13] + g_RT[17] - g_RT[18];
-    Kc[110] = -g_RT[0] + g_RT[8] + g_RT[17] - g_RT[23];
-    Kc[111] = -g_RT[0] + g_RT[9] + g_RT[17] - g_RT[23];
-    Kc[112] = -g_RT[13] + g_RT[17] + g_RT[20] - g_RT[23];
-    Kc[113] = -g_RT[0] + g_RT[10] + g_RT[17] - g_RT[24];
-    Kc[114] = -g_RT[0] + g_RT[10] + g_RT[17] - g_RT[25];
-    Kc[115] = g_RT[10] + g_RT[17] - g_RT[27];
-    Kc[116] = g_RT[10] + g_RT[17] - g_RT[26];
-    Kc[117] = g_RT[0] - g_RT[4] - g_RT[17] + g_RT[18];
-    Kc[118] = g_RT[1] - g_RT[10] - g_RT[13] + g_RT[18];
-    Kc[119] = g_RT[2] - g_RT[5] - g_RT[17] + g_RT[18];
-    Kc[120] = -g_RT[3] + g_RT[6] - g_RT[17] + g_RT[18];
-    Kc[121] = g_RT[6] - g_RT[11] - g_RT[12] + g_RT[18];
-    Kc[122] = g_RT[11] - g_RT[13] + g_RT[18] - g_RT[19];
-    Kc[123] = g_RT[11] + g_RT[18] - g_RT[32];
-    Kc[124] = -g_RT[0] + g_RT[10] + g_RT[18] - g_RT[26];
-    Kc[125] = -g_RT[17] + 2*g_RT[18] - g_RT[19];
-    Kc[126] = g_RT[0] - g_RT[10] - g_RT[11] + g_RT[21];
-    Kc[127] = g_RT[1] - g_RT[10] - g_RT[14] + g_RT[21];
-    Kc[128] = g_RT[2] - g_RT[2] - g_RT[10] - g_RT[13] + g_RT[21];
-    Kc[129] = -g_RT[2] + g_RT[3] - g_RT[10] - g_RT[14] + g_RT[21];
-    Kc[130] = g_RT[0] - g_RT[4] - g_RT[21] + g_RT[22];
-    Kc[131] = g_RT[1] - g_RT[2] - g_RT[21] + g_RT[22];
-    Kc[132] = g_RT[2] - g_RT[5] - g_RT[21] + g_RT[22];
-    Kc[133] = -g_RT[3] + g_RT[6] - g_RT[21] + g_RT[22];
-    Kc[134] = g_RT[0] - g_RT[4] - g_RT[18] + g_RT[19];
-    Kc[135] = g_RT[1] - g_RT[2] - g_RT[18] + g_RT[19];
-    Kc[136] = g_RT[1] - g_RT[10] - g_RT[11] + g_RT[19];
-    Kc[137] = g_RT[1] - g_RT[8] - g_RT[12] + g_RT[19];
-    Kc[138] = g_RT[2] - g_RT[5] - g_RT[18] + g_RT[19];
-    Kc[139] = -g_RT[0] + g_RT[7] + g_RT[19] - g_RT[25];
-    Kc[140] = -g_RT[0] + g_RT[7] + g_RT[19] - g_RT[24];
-    Kc[141] = -g_RT[0] + g_RT[8] + g_RT[19] - g_RT[26];
-    Kc[142] = -g_RT[0] + g_RT[9] + g_RT[19] - g_RT[26];
-    Kc[143] = g_RT[10] + g_RT[19] - g_RT[29];
-    Kc[144] = -g_RT[3] + g_RT[6] - g_RT[18] + g_RT[19];
-    Kc[145] = g_RT[0] + g_RT[23] - g_RT[24];
-    Kc[146] = g_RT[0] + g_RT[23] - g_RT[25];
-    Kc[147] = g_RT[1] - g_RT[12] - g_RT[16] + g_RT[23];
-    Kc[148] = -g_RT[2] + g_RT[3] - g_RT[13] - g_RT[18] + g_RT[23];
-    Kc[149] = g_RT[3] - g_RT[6] + g_RT[23] - g_RT[25];
-    Kc[150] = g_RT[3] - g_RT[6] + g_RT[23] - g_RT[24];
-    Kc[151] = g_RT[11] - g_RT[13] + g_RT[23] - g_RT[25];
-    Kc[152] = g_RT[11] - g_RT[13] + g_RT[23] - g_RT[24];
-    Kc[153] = g_RT[0] - g_RT[4] - g_RT[23] + g_RT[25];
-    Kc[154] = g_RT[0] + g_RT[25] - g_RT[27];
-    Kc[155] = g_RT[0] + g_RT[25] - g_RT[26];
-    Kc[156] = g_RT[1] - g_RT[13] - g_RT[19] + g_RT[25];
-    Kc[157] = g_RT[2] - g_RT[5] - g_RT[23] + g_RT[25];
-    Kc[158] = g_RT[16] - g_RT[17] - g_RT[23] + g_RT[25];
-    Kc[159] = g_RT[24] - g_RT[25];
-    Kc[160] = g_RT[0] - g_RT[0] + g_RT[24] - g_RT[25];
-    Kc[161] = g_RT[0] + g_RT[24] - g_RT[27];
-    Kc[162] = g_RT[0] + g_RT[24] - g_RT[26];
-    Kc[163] = g_RT[0] - g_RT[4] - g_RT[23] + g_RT[24];
-    Kc[164] = g_RT[23] - g_RT[23] + g_RT[24] - g_RT[25];
-    Kc[165] = g_RT[1] - g_RT[10] - g_RT[20] + g_RT[24];
-    Kc[166] = g_RT[1] - g_RT[13] - g_RT[19] + g_RT[24];
-    Kc[167] = g_RT[2] - g_RT[5] - g_RT[23] + g_RT[24];
-    Kc[168] = g_RT[16] - g_RT[17] - g_RT[23] + g_RT[24];
-    Kc[169] = g_RT[0] - g_RT[4] - g_RT[25] + g_RT[26];
-    Kc[170] = -g_RT[0] + g_RT[1] + g_RT[26] - g_RT[32];
-    Kc[171] = -2*g_RT[0] + g_RT[2] + g_RT[26] - g_RT[32];
-    Kc[172] = g_RT[2] - g_RT[5] - g_RT[25] + g_RT[26];
-    Kc[173] = -g_RT[3] + g_RT[6] - g_RT[25] + g_RT[26];
-    Kc[174] = g_RT[6] - g_RT[12] - g_RT[21] + g_RT[26];
-    Kc[175] = -g_RT[2] + g_RT[6] + g_RT[26] - g_RT[32];
-    Kc[176] = g_RT[3] - g_RT[6] + g_RT[26] - g_RT[28];
-    Kc[177] = -g_RT[2] + g_RT[3] - g_RT[12] - g_RT[18] + g_RT[26];
-    Kc[178] = g_RT[11] - g_RT[13] + g_RT[26] - g_RT[28];
-    Kc[179] = g_RT[26] - g_RT[27];
-    Kc[180] = g_RT[0] - g_RT[4] - g_RT[24] + g_RT[27];
-    Kc[181] = g_RT[6] - g_RT[12] - g_RT[21] + g_RT[27];
-    Kc[182] = g_RT[11] - g_RT[13] + g_RT[27] - g_RT[28];
-    Kc[183] = g_RT[0] - g_RT[10] - g_RT[19] + g_RT[28];
-    Kc[184] = g_RT[0] - g_RT[4] - g_RT[26] + g_RT[28];
-    Kc[185] = g_RT[0] - g_RT[4] - g_RT[27] + g_RT[28];
-    Kc[186] = -2*g_RT[0] + g_RT[1] + g_RT[28] - g_RT[32];
-    Kc[187] = g_RT[1] - g_RT[2] - g_RT[26] + g_RT[28];
-    Kc[188] = g_RT[1] - g_RT[2] - g_RT[27] + g_RT[28];
-    Kc[189] = g_RT[2] - g_RT[5] - g_RT[26] + g_RT[28];
-    Kc[190] = g_RT[2] - g_RT[5] - g_RT[27] + g_RT[28];
-    Kc[191] = g_RT[0] - g_RT[11] - g_RT[19] + g_RT[32];
-    Kc[192] = g_RT[1] - g_RT[2] - g_RT[13] - g_RT[18] + g_RT[32];
-    Kc[193] = g_RT[2] - g_RT[5] - g_RT[13] - g_RT[18] + g_RT[32];
-    Kc[194] = g_RT[0] - g_RT[4] - g_RT[28] + g_RT[30];
-    Kc[195] = g_RT[1] - g_RT[10] - g_RT[22] + g_RT[30];
-    Kc[196] = g_RT[2] - g_RT[5] - g_RT[28] + g_RT[30];
-    Kc[197] = -g_RT[3] + g_RT[6] - g_RT[28] + g_RT[30];
-    Kc[198] = -g_RT[2] + g_RT[3] - g_RT[10] - g_RT[22] + g_RT[30];
-    Kc[199] = g_RT[11] - g_RT[13] + g_RT[30] - g_RT[31];
-    Kc[200] = g_RT[0] - g_RT[4] - g_RT[28] + g_RT[29];
-    Kc[201] = g_RT[2] - g_RT[5] - g_RT[28] + g_RT[29];
-    Kc[202] = -g_RT[3] + g_RT[6] - g_RT[28] + g_RT[29];
-    Kc[203] = g_RT[11] - g_RT[13] + g_RT[29] - g_RT[31];
-    Kc[204] = g_RT[0] - g_RT[4] - g_RT[29] + g_RT[31];
-    Kc[205] = g_RT[0] - g_RT[4] - g_RT[30] + g_RT[31];
-    Kc[206] = g_RT[1] - g_RT[2] - g_RT[29] + g_RT[31];
-    Kc[207] = g_RT[1] - g_RT[2] - g_RT[30] + g_RT[31];
-    Kc[208] = g_RT[2] - g_RT[5] - g_RT[29] + g_RT[31];
-    Kc[209] = g_RT[2] - g_RT[5] - g_RT[30] + g_RT[31];
-    Kc[210] = -g_RT[3] + g_RT[6] - g_RT[29] + g_RT[31];
-    Kc[211] = -g_RT[3] + g_RT[6] - g_RT[30] + g_RT[31];
-
-#ifdef __INTEL_COMPILER
-     #pragma simd
-#endif
-    for (int i=0; i<212; ++i) {
-        Kc[i] = exp(Kc[i]);
-    };
-
     /*reference concentration: P_atm / (RT) in inverse mol/m^3 */
     double refC = 101325 / 8.31451 * invT;
     double refCinv = 1 / refC;
 
-    Kc[0] *= refCinv;
-    Kc[1] *= refCinv;
-    Kc[2] *= refCinv;
-    Kc[3] *= refCinv;
-    Kc[4] *= refCinv;
-    Kc[5] *= refCinv;
-    Kc[6] *= refC;
-    Kc[7] *= refCinv;
-    Kc[8] *= refCinv;
-    Kc[9] *= refCinv;
-    Kc[10] *= refCinv;
-    Kc[11] *= refCinv;
-    Kc[12] *= refCinv;
-    Kc[13] *= refCinv;
-    Kc[14] *= refCinv;
-    Kc[15] *= refCinv;
-    Kc[16] *= refCinv;
-    Kc[17] *= refCinv;
-    Kc[18] *= refCinv;
-    Kc[19] *= refCinv;
-    Kc[20] *= refCinv;
-    Kc[21] *= refCinv;
-    Kc[22] *= refC;
-    Kc[27] *= refCinv;
-    Kc[28] *= refCinv;
-    Kc[29] *= refCinv;
-    Kc[47] *= refC;
-    Kc[60] *= refC;
-    Kc[70] *= refC;
-    Kc[95] *= refC;
-    Kc[96] *= refC;
-    Kc[98] *= refC;
-    Kc[99] *= refC;
-    Kc[102] *= refC;
-    Kc[115] *= refCinv;
-    Kc[116] *= refCinv;
-    Kc[123] *= refCinv;
-    Kc[128] *= refC;
-    Kc[129] *= refC;
-    Kc[143] *= refCinv;
-    Kc[145] *= refCinv;
-    Kc[146] *= refCinv;
-    Kc[148] *= refC;
-    Kc[154] *= refCinv;
-    Kc[155] *= refCinv;
-    Kc[161] *= refCinv;
-    Kc[162] *= refCinv;
-    Kc[171] *= refC;
-    Kc[177] *= refC;
-    Kc[186] *= refC;
-    Kc[192] *= refC;
-    Kc[193] *= refC;
-    Kc[198] *= refC;
+    /*Kc as the ratio of the products of the species exp(g_RT)/refC, unless */
+    /*the product over a side of a reaction leaves the normal range */
+    double e_g[34], den[212];
+    for (int k=0; k<34; ++k) {
+        e_g[k] = exp(g_RT[k]) * refCinv;
+    }
+    Kc[0] = e_g[0]*e_g[6]; den[0] = e_g[3];
+    Kc[1] = e_g[4]*e_g[13]; den[1] = e_g[12];
+    Kc[2] = e_g[7]*e_g[13]; den[2] = e_g[20];
+    Kc[3] = e_g[0]*e_g[11]; den[3] = e_g[12];
+    Kc[4] = e_g[0]*e_g[8]; den[4] = e_g[10];
+    Kc[5] = e_g[0]*e_g[16]; den[5] = e_g[17];
+    Kc[6] = e_g[18]; den[6] = e_g[0]*e_g[17];
+    Kc[7] = e_g[0]*e_g[18]; den[7] = e_g[19];
+    Kc[8] = e_g[10]*e_g[18]; den[8] = e_g[28];
+    Kc[9] = e_g[10]*e_g[13]; den[9] = e_g[21];
+    Kc[10] = e_g[0]*e_g[21]; den[10] = e_g[22];
+    Kc[11] = e_g[10]*e_g[11]; den[11] = e_g[22];
+    Kc[12] = e_g[0]*e_g[26]; den[12] = e_g[28];
+    Kc[13] = e_g[0]*e_g[28]; den[13] = e_g[29];
+    Kc[14] = e_g[0]*e_g[28]; den[14] = e_g[30];
+    Kc[15] = e_g[0]*e_g[30]; den[15] = e_g[31];
+    Kc[16] = e_g[0]*e_g[29]; den[16] = e_g[31];
+    Kc[17] = e_g[1]*e_g[13]; den[17] = e_g[14];
+    Kc[18] = e_g[0]*e_g[0]; den[18] = e_g[4];
+    Kc[19] = e_g[0]*e_g[2]; den[19] = e_g[5];
+    Kc[20] = e_g[0]*e_g[1]; den[20] = e_g[2];
+    Kc[21] = e_g[1]*e_g[1]; den[21] = e_g[6];
+    Kc[22] = e_g[11]; den[22] = e_g[0]*e_g[13];
+    Kc[23] = e_g[0]*e_g[6]; den[23] = e_g[1]*e_g[2];
+    Kc[24] = e_g[1]*e_g[4]; den[24] = e_g[0]*e_g[2];
+    Kc[25] = e_g[2]*e_g[4]; den[25] = e_g[0]*e_g[5];
+    Kc[26] = e_g[2]*e_g[2]; den[26] = e_g[1]*e_g[5];
+    Kc[27] = e_g[0]*e_g[0]*e_g[4]; den[27] = e_g[4]*e_g[4];
+    Kc[28] = e_g[0]*e_g[0]*e_g[5]; den[28] = e_g[4]*e_g[5];
+    Kc[29] = e_g[0]*e_g[0]*e_g[14]; den[29] = e_g[4]*e_g[14];
+    Kc[30] = e_g[4]*e_g[6]; den[30] = e_g[0]*e_g[3];
+    Kc[31] = e_g[0]*e_g[3]; den[31] = e_g[1]*e_g[5];
+    Kc[32] = e_g[0]*e_g[3]; den[32] = e_g[2]*e_g[2];
+    Kc[33] = e_g[1]*e_g[3]; den[33] = e_g[2]*e_g[6];
+    Kc[34] = e_g[2]*e_g[3]; den[34] = e_g[5]*e_g[6];
+    Kc[35] = e_g[2]*e_g[3]; den[35] = e_g[5]*e_g[6];
+    Kc[36] = e_g[2]*e_g[3]; den[36] = e_g[5]*e_g[6];
+    Kc[37] = e_g[2]*e_g[3]; den[37] = e_g[5]*e_g[6];
+    Kc[38] = e_g[2]*e_g[3]; den[38] = e_g[5]*e_g[6];
+    Kc[39] = e_g[2]*e_g[13]; den[39] = e_g[0]*e_g[14];
+    Kc[40] = e_g[2]*e_g[13]; den[40] = e_g[0]*e_g[14];
+    Kc[41] = e_g[6]*e_g[13]; den[41] = e_g[1]*e_g[14];
+    Kc[42] = e_g[3]*e_g[13]; den[42] = e_g[2]*e_g[14];
+    Kc[43] = e_g[0]*e_g[11]; den[43] = e_g[4]*e_g[13];
+    Kc[44] = e_g[1]*e_g[11]; den[44] = e_g[2]*e_g[13];
+    Kc[45] = e_g[1]*e_g[11]; den[45] = e_g[0]*e_g[14];
+    Kc[46] = e_g[2]*e_g[11]; den[46] = e_g[5]*e_g[13];
+    Kc[47] = e_g[5]*e_g[11]; den[47] = e_g[0]*e_g[5]*e_g[13];
+    Kc[48] = e_g[6]*e_g[11]; den[48] = e_g[3]*e_g[13];
+    Kc[49] = e_g[1]*e_g[7]; den[49] = e_g[0]*e_g[13];
+    Kc[50] = e_g[2]*e_g[7]; den[50] = e_g[0]*e_g[11];
+    Kc[51] = e_g[4]*e_g[7]; den[51] = e_g[0]*e_g[8];
+    Kc[52] = e_g[5]*e_g[7]; den[52] = e_g[0]*e_g[12];
+    Kc[53] = e_g[6]*e_g[7]; den[53] = e_g[1]*e_g[11];
+    Kc[54] = e_g[7]*e_g[14]; den[54] = e_g[11]*e_g[13];
+    Kc[55] = e_g[1]*e_g[8]; den[55] = e_g[0]*e_g[11];
+    Kc[56] = e_g[2]*e_g[8]; den[56] = e_g[0]*e_g[12];
+    Kc[57] = e_g[2]*e_g[8]; den[57] = e_g[5]*e_g[7];
+    Kc[58] = e_g[4]*e_g[8]; den[58] = e_g[0]*e_g[10];
+    Kc[59] = e_g[6]*e_g[8]; den[59] = e_g[2]*e_g[11];
+    Kc[60] = e_g[6]*e_g[8]; den[60] = e_g[0]*e_g[0]*e_g[14];
+    Kc[61] = e_g[3]*e_g[8]; den[61] = e_g[2]*e_g[12];
+    Kc[62] = e_g[7]*e_g[8]; den[62] = e_g[0]*e_g[17];
+    Kc[63] = e_g[8]*e_g[8]; den[63] = e_g[4]*e_g[17];
+    Kc[64] = e_g[9]*e_g[33]; den[64] = e_g[8]*e_g[33];
+    Kc[65] = e_g[0]*e_g[9]; den[65] = e_g[4]*e_g[7];
+    Kc[66] = e_g[1]*e_g[9]; den[66] = e_g[4]*e_g[13];
+    Kc[67] = e_g[1]*e_g[9]; den[67] = e_g[0]*e_g[11];
+    Kc[68] = e_g[2]*e_g[9]; den[68] = e_g[0]*e_g[12];
+    Kc[69] = e_g[4]*e_g[9]; den[69] = e_g[0]*e_g[10];
+    Kc[70] = e_g[6]*e_g[9]; den[70] = e_g[0]*e_g[2]*e_g[13];
+    Kc[71] = e_g[6]*e_g[9]; den[71] = e_g[5]*e_g[13];
+    Kc[72] = e_g[5]*e_g[9]; den[72] = e_g[5]*e_g[8];
+    Kc[73] = e_g[9]*e_g[13]; den[73] = e_g[8]*e_g[13];
+    Kc[74] = e_g[9]*e_g[14]; den[74] = e_g[8]*e_g[14];
+    Kc[75] = e_g[9]*e_g[14]; den[75] = e_g[12]*e_g[13];
+    Kc[76] = e_g[0]*e_g[12]; den[76] = e_g[4]*e_g[11];
+    Kc[77] = e_g[1]*e_g[12]; den[77] = e_g[2]*e_g[11];
+    Kc[78] = e_g[2]*e_g[12]; den[78] = e_g[5]*e_g[11];
+    Kc[79] = e_g[6]*e_g[12]; den[79] = e_g[3]*e_g[11];
+    Kc[80] = e_g[1]*e_g[10]; den[80] = e_g[0]*e_g[12];
+    Kc[81] = e_g[2]*e_g[10]; den[81] = e_g[5]*e_g[8];
+    Kc[82] = e_g[2]*e_g[10]; den[82] = e_g[5]*e_g[9];
+    Kc[83] = e_g[6]*e_g[10]; den[83] = e_g[2]*e_g[12];
+    Kc[84] = e_g[7]*e_g[10]; den[84] = e_g[0]*e_g[18];
+    Kc[85] = e_g[8]*e_g[10]; den[85] = e_g[0]*e_g[19];
+    Kc[86] = e_g[9]*e_g[10]; den[86] = e_g[0]*e_g[19];
+    Kc[87] = e_g[10]*e_g[20]; den[87] = e_g[13]*e_g[19];
+    Kc[88] = e_g[10]*e_g[16]; den[88] = e_g[0]*e_g[23];
+    Kc[89] = e_g[1]*e_g[16]; den[89] = e_g[7]*e_g[13];
+    Kc[90] = e_g[2]*e_g[16]; den[90] = e_g[0]*e_g[20];
+    Kc[91] = e_g[6]*e_g[16]; den[91] = e_g[11]*e_g[13];
+    Kc[92] = e_g[4]*e_g[16]; den[92] = e_g[0]*e_g[17];
+    Kc[93] = e_g[0]*e_g[15]; den[93] = e_g[7]*e_g[13];
+    Kc[94] = e_g[1]*e_g[15]; den[94] = e_g[13]*e_g[13];
+    Kc[95] = e_g[2]*e_g[15]; den[95] = e_g[0]*e_g[13]*e_g[13];
+    Kc[96] = e_g[6]*e_g[15]; den[96] = e_g[1]*e_g[13]*e_g[13];
+    Kc[97] = e_g[0]*e_g[20]; den[97] = e_g[9]*e_g[13];
+    Kc[98] = e_g[1]*e_g[20]; den[98] = e_g[0]*e_g[13]*e_g[13];
+    Kc[99] = e_g[6]*e_g[20]; den[99] = e_g[2]*e_g[13]*e_g[13];
+    Kc[100] = e_g[7]*e_g[20]; den[100] = e_g[13]*e_g[17];
+    Kc[101] = e_g[8]*e_g[20]; den[101] = e_g[13]*e_g[18];
+    Kc[102] = e_g[20]*e_g[20]; den[102] = e_g[13]*e_g[13]*e_g[17];
+    Kc[103] = e_g[2]*e_g[20]; den[103] = e_g[5]*e_g[15];
+    Kc[104] = e_g[1]*e_g[17]; den[104] = e_g[2]*e_g[16];
+    Kc[105] = e_g[1]*e_g[17]; den[105] = e_g[8]*e_g[13];
+    Kc[106] = e_g[1]*e_g[17]; den[106] = e_g[0]*e_g[20];
+    Kc[107] = e_g[2]*e_g[17]; den[107] = e_g[5]*e_g[16];
+    Kc[108] = e_g[2]*e_g[17]; den[108] = e_g[10]*e_g[13];
+    Kc[109] = e_g[11]*e_g[17]; den[109] = e_g[13]*e_g[18];
+    Kc[110] = e_g[8]*e_g[17]; den[110] = e_g[0]*e_g[23];
+    Kc[111] = e_g[9]*e_g[17]; den[111] = e_g[0]*e_g[23];
+    Kc[112] = e_g[17]*e_g[20]; den[112] = e_g[13]*e_g[23];
+    Kc[113] = e_g[10]*e_g[17]; den[113] = e_g[0]*e_g[24];
+    Kc[114] = e_g[10]*e_g[17]; den[114] = e_g[0]*e_g[25];
+    Kc[115] = e_g[10]*e_g[17]; den[115] = e_g[27];
+    Kc[116] = e_g[10]*e_g[17]; den[116] = e_g[26];
+    Kc[117] = e_g[0]*e_g[18]; den[117] = e_g[4]*e_g[17];
+    Kc[118] = e_g[1]*e_g[18]; den[118] = e_g[10]*e_g[13];
+    Kc[119] = e_g[2]*e_g[18]; den[119] = e_g[5]*e_g[17];
+    Kc[120] = e_g[6]*e_g[18]; den[120] = e_g[3]*e_g[17];
+    Kc[121] = e_g[6]*e_g[18]; den[121] = e_g[11]*e_g[12];
+    Kc[122] = e_g[11]*e_g[18]; den[122] = e_g[13]*e_g[19];
+    Kc[123] = e_g[11]*e_g[18]; den[123] = e_g[32];
+    Kc[124] = e_g[10]*e_g[18]; den[124] = e_g[0]*e_g[26];
+    Kc[125] = e_g[18]*e_g[18]; den[125] = e_g[17]*e_g[19];
+    Kc[126] = e_g[0]*e_g[21]; den[126] = e_g[10]*e_g[11];
+    Kc[127] = e_g[1]*e_g[21]; den[127] = e_g[10]*e_g[14];
+    Kc[128] = e_g[2]*e_g[21]; den[128] = e_g[2]*e_g[10]*e_g[13];
+    Kc[129] = e_g[3]*e_g[21]; den[129] = e_g[2]*e_g[10]*e_g[14];
+    Kc[130] = e_g[0]*e_g[22]; den[130] = e_g[4]*e_g[21];
+    Kc[131] = e_g[1]*e_g[22]; den[131] = e_g[2]*e_g[21];
+    Kc[132] = e_g[2]*e_g[22]; den[132] = e_g[5]*e_g[21];
+    Kc[133] = e_g[6]*e_g[22]; den[133] = e_g[3]*e_g[21];
+    Kc[134] = e_g[0]*e_g[19]; den[134] = e_g[4]*e_g[18];
+    Kc[135] = e_g[1]*e_g[19]; den[135] = e_g[2]*e_g[18];
+    Kc[136] = e_g[1]*e_g[19]; den[136] = e_g[10]*e_g[11];
+    Kc[137] = e_g[1]*e_g[19]; den[137] = e_g[8]*e_g[12];
+    Kc[138] = e_g[2]*e_g[19]; den[138] = e_g[5]*e_g[18];
+    Kc[139] = e_g[7]*e_g[19]; den[139] = e_g[0]*e_g[25];
+    Kc[140] = e_g[7]*e_g[19]; den[140] = e_g[0]*e_g[24];
+    Kc[141] = e_g[8]*e_g[19]; den[141] = e_g[0]*e_g[26];
+    Kc[142] = e_g[9]*e_g[19]; den[142] = e_g[0]*e_g[26];
+    Kc[143] = e_g[10]*e_g[19]; den[143] = e_g[29];
+    Kc[144] = e_g[6]*e_g[19]; den[144] = e_g[3]*e_g[18];
+    Kc[145] = e_g[0]*e_g[23]; den[145] = e_g[24];
+    Kc[146] = e_g[0]*e_g[23]; den[146] = e_g[25];
+    Kc[147] = e_g[1]*e_g[23]; den[147] = e_g[12]*e_g[16];
+    Kc[148] = e_g[3]*e_g[23]; den[148] = e_g[2]*e_g[13]*e_g[18];
+    Kc[149] = e_g[3]*e_g[23]; den[149] = e_g[6]*e_g[25];
+    Kc[150] = e_g[3]*e_g[23]; den[150] = e_g[6]*e_g[24];
+    Kc[151] = e_g[11]*e_g[23]; den[151] = e_g[13]*e_g[25];
+    Kc[152] = e_g[11]*e_g[23]; den[152] = e_g[13]*e_g[24];
+    Kc[153] = e_g[0]*e_g[25]; den[153] = e_g[4]*e_g[23];
+    Kc[154] = e_g[0]*e_g[25]; den[154] = e_g[27];
+    Kc[155] = e_g[0]*e_g[25]; den[155] = e_g[26];
+    Kc[156] = e_g[1]*e_g[25]; den[156] = e_g[13]*e_g[19];
+    Kc[157] = e_g[2]*e_g[25]; den[157] = e_g[5]*e_g[23];
+    Kc[158] = e_g[16]*e_g[25]; den[158] = e_g[17]*e_g[23];
+    Kc[159] = e_g[24]; den[159] = e_g[25];
+    Kc[160] = e_g[0]*e_g[24]; den[160] = e_g[0]*e_g[25];
+    Kc[161] = e_g[0]*e_g[24]; den[161] = e_g[27];
+    Kc[162] = e_g[0]*e_g[24]; den[162] = e_g[26];
+    Kc[163] = e_g[0]*e_g[24]; den[163] = e_g[4]*e_g[23];
+    Kc[164] = e_g[23]*e_g[24]; den[164] = e_g[23]*e_g[25];
+    Kc[165] = e_g[1]*e_g[24]; den[165] = e_g[10]*e_g[20];
+    Kc[166] = e_g[1]*e_g[24]; den[166] = e_g[13]*e_g[19];
+    Kc[167] = e_g[2]*e_g[24]; den[167] = e_g[5]*e_g[23];
+    Kc[168] = e_g[16]*e_g[24]; den[168] = e_g[17]*e_g[23];
+    Kc[169] = e_g[0]*e_g[26]; den[169] = e_g[4]*e_g[25];
+    Kc[170] = e_g[1]*e_g[26]; den[170] = e_g[0]*e_g[32];
+    Kc[171] = e_g[2]*e_g[26]; den[171] = e_g[0]*e_g[0]*e_g[32];
+    Kc[172] = e_g[2]*e_g[26]; den[172] = e_g[5]*e_g[25];
+    Kc[173] = e_g[6]*e_g[26]; den[173] = e_g[3]*e_g[25];
+    Kc[174] = e_g[6]*e_g[26]; den[174] = e_g[12]*e_g[21];
+    Kc[175] = e_g[6]*e_g[26]; den[175] = e_g[2]*e_g[32];
+    Kc[176] = e_g[3]*e_g[26]; den[176] = e_g[6]*e_g[28];
+    Kc[177] = e_g[3]*e_g[26]; den[177] = e_g[2]*e_g[12]*e_g[18];
+    Kc[178] = e_g[11]*e_g[26]; den[178] = e_g[13]*e_g[28];
+    Kc[179] = e_g[26]; den[179] = e_g[27];
+    Kc[180] = e_g[0]*e_g[27]; den[180] = e_g[4]*e_g[24];
+    Kc[181] = e_g[6]*e_g[27]; den[181] = e_g[12]*e_g[21];
+    Kc[182] = e_g[11]*e_g[27]; den[182] = e_g[13]*e_g[28];
+    Kc[183] = e_g[0]*e_g[28]; den[183] = e_g[10]*e_g[19];
+    Kc[184] = e_g[0]*e_g[28]; den[184] = e_g[4]*e_g[26];
+    Kc[185] = e_g[0]*e_g[28]; den[185] = e_g[4]*e_g[27];
+    Kc[186] = e_g[1]*e_g[28]; den[186] = e_g[0]*e_g[0]*e_g[32];
+    Kc[187] = e_g[1]*e_g[28]; den[187] = e_g[2]*e_g[26];
+    Kc[188] = e_g[1]*e_g[28]; den[188] = e_g[2]*e_g[27];
+    Kc[189] = e_g[2]*e_g[28]; den[189] = e_g[5]*e_g[26];
+    Kc[190] = e_g[2]*e_g[28]; den[190] = e_g[5]*e_g[27];
+    Kc[191] = e_g[0]*e_g[32]; den[191] = e_g[11]*e_g[19];
+    Kc[192] = e_g[1]*e_g[32]; den[192] = e_g[2]*e_g[13]*e_g[18];
+    Kc[193] = e_g[2]*e_g[32]; den[193] = e_g[5]*e_g[13]*e_g[18];
+    Kc[194] = e_g[0]*e_g[30]; den[194] = e_g[4]*e_g[28];
+    Kc[195] = e_g[1]*e_g[30]; den[195] = e_g[10]*e_g[22];
+    Kc[196] = e_g[2]*e_g[30]; den[196] = e_g[5]*e_g[28];
+    Kc[197] = e_g[6]*e_g[30]; den[197] = e_g[3]*e_g[28];
+    Kc[198] = e_g[3]*e_g[30]; den[198] = e_g[2]*e_g[10]*e_g[22];
+    Kc[199] = e_g[11]*e_g[30]; den[199] = e_g[13]*e_g[31];
+    Kc[200] = e_g[0]*e_g[29]; den[200] = e_g[4]*e_g[28];
+    Kc[201] = e_g[2]*e_g[29]; den[201] = e_g[5]*e_g[28];
+    Kc[202] = e_g[6]*e_g[29]; den[202] = e_g[3]*e_g[28];
+    Kc[203] = e_g[11]*e_g[29]; den[203] = e_g[13]*e_g[31];
+    Kc[204] = e_g[0]*e_g[31]; den[204] = e_g[4]*e_g[29];
+    Kc[205] = e_g[0]*e_g[31]; den[205] = e_g[4]*e_g[30];
+    Kc[206] = e_g[1]*e_g[31]; den[206] = e_g[2]*e_g[29];
+    Kc[207] = e_g[1]*e_g[31]; den[207] = e_g[2]*e_g[30];
+    Kc[208] = e_g[2]*e_g[31]; den[208] = e_g[5]*e_g[29];
+    Kc[209] = e_g[2]*e_g[31]; den[209] = e_g[5]*e_g[30];
+    Kc[210] = e_g[6]*e_g[31]; den[210] = e_g[3]*e_g[29];
+    Kc[211] = e_g[6]*e_g[31]; den[211] = e_g[3]*e_g[30];
+    int inrange = 1;
+    for (int i=0; i<212; ++i) {
+        inrange &= Kc[i] >= DBL_MIN && Kc[i] <= DBL_MAX && den[i] >= DBL_MIN && den[i] <= DBL_MAX;
+    }
+
+    if (inrange) {
+        for (int i=0; i<212; ++i) {
+            Kc[i] /= den[i];
+        }
+    }
+    else {
+        Kc[0] = exp(g_RT[0] - g_RT[3] + g_RT[6]);
+        Kc[1] = exp(g_RT[4] - g_RT[12] + g_RT[13]);
+        Kc[2] = exp(g_RT[7] + g_RT[13] - g_RT[20]);
+        Kc[3] = exp(g_RT[0] + g_RT[11] - g_RT[12]);
+        Kc[4] = exp(g_RT[0] + g_RT[8] - g_RT[10]);
+        Kc[5] = exp(g_RT[0] + g_RT[16] - g_RT[17]);
+        Kc[6] = exp(-g_RT[0] - g_RT[17] + g_RT[18]);
+        Kc[7] = exp(g_RT[0] + g_RT[18] - g_RT[19]);
+        Kc[8] = exp(g_RT[10] + g_RT[18] - g_RT[28]);
+        Kc[9] = exp(g_RT[10] + g_RT[13] - g_RT[21]);
+        Kc[10] = exp(g_RT[0] + g_RT[21] - g_RT[22]);
+        Kc[11] = exp(g_RT[10] + g_RT[11] - g_RT[22]);
+        Kc[12] = exp(g_RT[0] + g_RT[26] - g_RT[28]);
+        Kc[13] = exp(g_RT[0] + g_RT[28] - g_RT[29]);
+        Kc[14] = exp(g_RT[0] + g_RT[28] - g_RT[30]);
+        Kc[15] = exp(g_RT[0] + g_RT[30] - g_RT[31]);
+        Kc[16] = exp(g_RT[0] + g_RT[29] - g_RT[31]);
+        Kc[17] = exp(g_RT[1] + g_RT[13] - g_RT[14]);
+        Kc[18] = exp(2*g_RT[0] - g_RT[4]);
+        Kc[19] = exp(g_RT[0] + g_RT[2] - g_RT[5]);
+        Kc[20] = exp(g_RT[0] + g_RT[1] - g_RT[2]);
+        Kc[21] = exp(2*g_RT[1] - g_RT[6]);
+        Kc[22] = exp(-g_RT[0] + g_RT[11] - g_RT[13]);
+        Kc[23] = exp(g_RT[0] - g_RT[1] - g_RT[2] + g_RT[6]);
+        Kc[24] = exp(-g_RT[0] + g_RT[1] - g_RT[2] + g_RT[4]);
+        Kc[25] = exp(-g_RT[0] + g_RT[2] + g_RT[4] - g_RT[5]);
+        Kc[26] = exp(-g_RT[1] + 2*g_RT[2] - g_RT[5]);
+        Kc[27] = exp(2*g_RT[0] + g_RT[4] - 2*g_RT[4]);
+        Kc[28] = exp(2*g_RT[0] - g_RT[4] + g_RT[5] - g_RT[5]);
+        Kc[29] = exp(2*g_RT[0] - g_RT[4] + g_RT[14] - g_RT[14]);
+        Kc[30] = exp(-g_RT[0] - g_RT[3] + g_RT[4] + g_RT[6]);
+        Kc[31] = exp(g_RT[0] - g_RT[1] + g_RT[3] - g_RT[5]);
+        Kc[32] = exp(g_RT[0] - 2*g_RT[2] + g_RT[3]);
+        Kc[33] = exp(g_RT[1] - g_RT[2] + g_RT[3] - g_RT[6]);
+        Kc[34] = exp(g_RT[2] + g_RT[3] - g_RT[5] - g_RT[6]);
+        Kc[39] = exp(-g_RT[0] + g_RT[2] + g_RT[13] - g_RT[14]);
+        Kc[41] = exp(-g_RT[1] + g_RT[6] + g_RT[13] - g_RT[14]);
+        Kc[42] = exp(-g_RT[2] + g_RT[3] + g_RT[13] - g_RT[14]);
+        Kc[43] = exp(g_RT[0] - g_RT[4] + g_RT[11] - g_RT[13]);
+        Kc[44] = exp(g_RT[1] - g_RT[2] + g_RT[11] - g_RT[13]);
+        Kc[45] = exp(-g_RT[0] + g_RT[1] + g_RT[11] - g_RT[14]);
+        Kc[46] = exp(g_RT[2] - g_RT[5] + g_RT[11] - g_RT[13]);
+        Kc[47] = exp(-g_RT[0] + g_RT[5] - g_RT[5] + g_RT[11] - g_RT[13]);
+        Kc[48] = exp(-g_RT[3] + g_RT[6] + g_RT[11] - g_RT[13]);
+        Kc[49] = exp(-g_RT[0] + g_RT[1] + g_RT[7] - g_RT[13]);
+        Kc[50] = exp(-g_RT[0] + g_RT[2] + g_RT[7] - g_RT[11]);
+        Kc[51] = exp(-g_RT[0] + g_RT[4] + g_RT[7] - g_RT[8]);
+        Kc[52] = exp(-g_RT[0] + g_RT[5] + g_RT[7] - g_RT[12]);
+        Kc[53] = exp(-g_RT[1] + g_RT[6] + g_RT[7] - g_RT[11]);
+        Kc[54] = exp(g_RT[7] - g_RT[11] - g_RT[13] + g_RT[14]);
+        Kc[55] = exp(-g_RT[0] + g_RT[1] + g_RT[8] - g_RT[11]);
+        Kc[56] = exp(-g_RT[0] + g_RT[2] + g_RT[8] - g_RT[12]);
+        Kc[57] = exp(g_RT[2] - g_RT[5] - g_RT[7] + g_RT[8]);
+        Kc[58] = exp(-g_RT[0] + g_RT[4] + g_RT[8] - g_RT[10]);
+        Kc[59] = exp(-g_RT[2] + g_RT[6] + g_RT[8] - g_RT[11]);
+        Kc[60] = exp(-2*g_RT[0] + g_RT[6] + g_RT[8] - g_RT[14]);
+        Kc[61] = exp(-g_RT[2] + g_RT[3] + g_RT[8] - g_RT[12]);
+        Kc[62] = exp(-g_RT[0] + g_RT[7] + g_RT[8] - g_RT[17]);
+        Kc[63] = exp(-g_RT[4] + 2*g_RT[8] - g_RT[17]);
+        Kc[64] = exp(-g_RT[8] + g_RT[9] + g_RT[33] - g_RT[33]);
+        Kc[65] = exp(g_RT[0] - g_RT[4] - g_RT[7] + g_RT[9]);
+        Kc[66] = exp(g_RT[1] - g_RT[4] + g_RT[9] - g_RT[13]);
+        Kc[67] = exp(-g_RT[0] + g_RT[1] + g_RT[9] - g_RT[11]);
+        Kc[68] = exp(-g_RT[0] + g_RT[2] + g_RT[9] - g_RT[12]);
+        Kc[69] = exp(-g_RT[0] + g_RT[4] + g_RT[9] - g_RT[10]);
+        Kc[70] = exp(-g_RT[0] - g_RT[2] + g_RT[6] + g_RT[9] - g_RT[13]);
+        Kc[71] = exp(-g_RT[5] + g_RT[6] + g_RT[9] - g_RT[13]);
+        Kc[72] = exp(g_RT[5] - g_RT[5] - g_RT[8] + g_RT[9]);
+        Kc[73] = exp(-g_RT[8] + g_RT[9] + g_RT[13] - g_RT[13]);
+        Kc[74] = exp(-g_RT[8] + g_RT[9] + g_RT[14] - g_RT[14]);
+        Kc[75] = exp(g_RT[9] - g_RT[12] - g_RT[13] + g_RT[14]);
+        Kc[76] = exp(g_RT[0] - g_RT[4] - g_RT[11] + g_RT[12]);
+        Kc[77] = exp(g_RT[1] - g_RT[2] - g_RT[11] + g_RT[12]);
+        Kc[78] = exp(g_RT[2] - g_RT[5] - g_RT[11] + g_RT[12]);
+        Kc[79] = exp(-g_RT[3] + g_RT[6] - g_RT[11] + g_RT[12]);
+        Kc[80] = exp(-g_RT[0] + g_RT[1] + g_RT[10] - g_RT[12]);
+        Kc[81] = exp(g_RT[2] - g_RT[5] - g_RT[8] + g_RT[10]);
+        Kc[82] = exp(g_RT[2] - g_RT[5] - g_RT[9] + g_RT[10]);
+        Kc[83] = exp(-g_RT[2] + g_RT[6] + g_RT[10] - g_RT[12]);
+        Kc[84] = exp(-g_RT[0] + g_RT[7] + g_RT[10] - g_RT[18]);
+        Kc[85] = exp(-g_RT[0] + g_RT[8] + g_RT[10] - g_RT[19]);
+        Kc[86] = exp(-g_RT[0] + g_RT[9] + g_RT[10] - g_RT[19]);
+        Kc[87] = exp(g_RT[10] - g_RT[13] - g_RT[19] + g_RT[20]);
+        Kc[88] = exp(-g_RT[0] + g_RT[10] + g_RT[16] - g_RT[23]);
+        Kc[89] = exp(g_RT[1] - g_RT[7] - g_RT[13] + g_RT[16]);
+        Kc[90] = exp(-g_RT[0] + g_RT[2] + g_RT[16] - g_RT[20]);
+        Kc[91] = exp(g_RT[6] - g_RT[11] - g_RT[13] + g_RT[16]);
+        Kc[92] = exp(-g_RT[0] + g_RT[4] + g_RT[16] - g_RT[17]);
+        Kc[93] = exp(g_RT[0] - g_RT[7] - g_RT[13] + g_RT[15]);
+        Kc[94] = exp(g_RT[1] - 2*g_RT[13] + g_RT[15]);
+        Kc[95] = exp(-g_RT[0] + g_RT[2] - 2*g_RT[13] + g_RT[15]);
+        Kc[96] = exp(-g_RT[1] + g_RT[6] - 2*g_RT[13] + g_RT[15]);
+        Kc[97] = exp(g_RT[0] - g_RT[9] - g_RT[13] + g_RT[20]);
+        Kc[98] = exp(-g_RT[0] + g_RT[1] - 2*g_RT[13] + g_RT[20]);
+        Kc[99] = exp(-g_RT[2] + g_RT[6] - 2*g_RT[13] + g_RT[20]);
+        Kc[100] = exp(g_RT[7] - g_RT[13] - g_RT[17] + g_RT[20]);
+        Kc[101] = exp(g_RT[8] - g_RT[13] - g_RT[18] + g_RT[20]);
+        Kc[102] = exp(-2*g_RT[13] - g_RT[17] + 2*g_RT[20]);
+        Kc[103] = exp(g_RT[2] - g_RT[5] - g_RT[15] + g_RT[20]);
+        Kc[104] = exp(g_RT[1] - g_RT[2] - g_RT[16] + g_RT[17]);
+        Kc[105] = exp(g_RT[1] - g_RT[8] - g_RT[13] + g_RT[17]);
+        Kc[106] = exp(-g_RT[0] + g_RT[1] + g_RT[17] - g_RT[20]);
+        Kc[107] = exp(g_RT[2] - g_RT[5] - g_RT[16] + g_RT[17]);
+        Kc[108] = exp(g_RT[2] - g_RT[10] - g_RT[13] + g_RT[17]);
+        Kc[109] = exp(g_RT[11] - g_RT[13] + g_RT[17] - g_RT[18]);
+        Kc[110] = exp(-g_RT[0] + g_RT[8] + g_RT[17] - g_RT[23]);
+        Kc[111] = exp(-g_RT[0] + g_RT[9] + g_RT[17] - g_RT[23]);
+        Kc[112] = exp(-g_RT[13] + g_RT[17] + g_RT[20] - g_RT[23]);
+        Kc[113] = exp(-g_RT[0] + g_RT[10] + g_RT[17] - g_RT[24]);
+        Kc[114] = exp(-g_RT[0] + g_RT[10] + g_RT[17] - g_RT[25]);
+        Kc[115] = exp(g_RT[10] + g_RT[17] - g_RT[27]);
+        Kc[116] = exp(g_RT[10] + g_RT[17] - g_RT[26]);
+        Kc[117] = exp(g_RT[0] - g_RT[4] - g_RT[17] + g_RT[18]);
+        Kc[118] = exp(g_RT[1] - g_RT[10] - g_RT[13] + g_RT[18]);
+        Kc[119] = exp(g_RT[2] - g_RT[5] - g_RT[17] + g_RT[18]);
+        Kc[120] = exp(-g_RT[3] + g_RT[6] - g_RT[17] + g_RT[18]);
+        Kc[121] = exp(g_RT[6] - g_RT[11] - g_RT[12] + g_RT[18]);
+        Kc[122] = exp(g_RT[11] - g_RT[13] + g_RT[18] - g_RT[19]);
+        Kc[123] = exp(g_RT[11] + g_RT[18] - g_RT[32]);
+        Kc[124] = exp(-g_RT[0] + g_RT[10] + g_RT[18] - g_RT[26]);
+        Kc[125] = exp(-g_RT[17] + 2*g_RT[18] - g_RT[19]);
+        Kc[126] = exp(g_RT[0] - g_RT[10] - g_RT[11] + g_RT[21]);
+        Kc[127] = exp(g_RT[1] - g_RT[10] - g_RT[14] + g_RT[21]);
+        Kc[128] = exp(g_RT[2] - g_RT[2] - g_RT[10] - g_RT[13] + g_RT[21]);
+        Kc[129] = exp(-g_RT[2] + g_RT[3] - g_RT[10] - g_RT[14] + g_RT[21]);
+        Kc[130] = exp(g_RT[0] - g_RT[4] - g_RT[21] + g_RT[22]);
+        Kc[131] = exp(g_RT[1] - g_RT[2] - g_RT[21] + g_RT[22]);
+        Kc[132] = exp(g_RT[2] - g_RT[5] - g_RT[21] + g_RT[22]);
+        Kc[133] = exp(-g_RT[3] + g_RT[6] - g_RT[21] + g_RT[22]);
+        Kc[134] = exp(g_RT[0] - g_RT[4] - g_RT[18] + g_RT[19]);
+        Kc[135] = exp(g_RT[1] - g_RT[2] - g_RT[18] + g_RT[19]);
+        Kc[136] = exp(g_RT[1] - g_RT[10] - g_RT[11] + g_RT[19]);
+        Kc[137] = exp(g_RT[1] - g_RT[8] - g_RT[12] + g_RT[19]);
+        Kc[138] = exp(g_RT[2] - g_RT[5] - g_RT[18] + g_RT[19]);
+        Kc[139] = exp(-g_RT[0] + g_RT[7] + g_RT[19] - g_RT[25]);
+        Kc[140] = exp(-g_RT[0] + g_RT[7] + g_RT[19] - g_RT[24]);
+        Kc[141] = exp(-g_RT[0] + g_RT[8] + g_RT[19] - g_RT[26]);
+        Kc[142] = exp(-g_RT[0] + g_RT[9] + g_RT[19] - g_RT[26]);
+        Kc[143] = exp(g_RT[10] + g_RT[19] - g_RT[29]);
+        Kc[144] = exp(-g_RT[3] + g_RT[6] - g_RT[18] + g_RT[19]);
+        Kc[145] = exp(g_RT[0] + g_RT[23] - g_RT[24]);
+        Kc[146] = exp(g_RT[0] + g_RT[23] - g_RT[25]);
+        Kc[147] = exp(g_RT[1] - g_RT[12] - g_RT[16] + g_RT[23]);
+        Kc[148] = exp(-g_RT[2] + g_RT[3] - g_RT[13] - g_RT[18] + g_RT[23]);
+        Kc[149] = exp(g_RT[3] - g_RT[6] + g_RT[23] - g_RT[25]);
+        Kc[150] = exp(g_RT[3] - g_RT[6] + g_RT[23] - g_RT[24]);
+        Kc[151] = exp(g_RT[11] - g_RT[13] + g_RT[23] - g_RT[25]);
+        Kc[152] = exp(g_RT[11] - g_RT[13] + g_RT[23] - g_RT[24]);
+        Kc[153] = exp(g_RT[0] - g_RT[4] - g_RT[23] + g_RT[25]);
+        Kc[154] = exp(g_RT[0] + g_RT[25] - g_RT[27]);
+        Kc[155] = exp(g_RT[0] + g_RT[25] - g_RT[26]);
+        Kc[156] = exp(g_RT[1] - g_RT[13] - g_RT[19] + g_RT[25]);
+        Kc[157] = exp(g_RT[2] - g_RT[5] - g_RT[23] + g_RT[25]);
+        Kc[158] = exp(g_RT[16] - g_RT[17] - g_RT[23] + g_RT[25]);
+        Kc[159] = exp(g_RT[24] - g_RT[25]);
+        Kc[160] = exp(g_RT[0] - g_RT[0] + g_RT[24] - g_RT[25]);
+        Kc[161] = exp(g_RT[0] + g_RT[24] - g_RT[27]);
+        Kc[162] = exp(g_RT[0] + g_RT[24] - g_RT[26]);
+        Kc[163] = exp(g_RT[0] - g_RT[4] - g_RT[23] + g_RT[24]);
+        Kc[164] = exp(g_RT[23] - g_RT[23] + g_RT[24] - g_RT[25]);
+        Kc[165] = exp(g_RT[1] - g_RT[10] - g_RT[20] + g_RT[24]);
+        Kc[166] = exp(g_RT[1] - g_RT[13] - g_RT[19] + g_RT[24]);
+        Kc[167] = exp(g_RT[2] - g_RT[5] - g_RT[23] + g_RT[24]);
+        Kc[168] = exp(g_RT[16] - g_RT[17] - g_RT[23] + g_RT[24]);
+        Kc[169] = exp(g_RT[0] - g_RT[4] - g_RT[25] + g_RT[26]);
+        Kc[170] = exp(-g_RT[0] + g_RT[1] + g_RT[26] - g_RT[32]);
+        Kc[171] = exp(-2*g_RT[0] + g_RT[2] + g_RT[26] - g_RT[32]);
+        Kc[172] = exp(g_RT[2] - g_RT[5] - g_RT[25] + g_RT[26]);
+        Kc[173] = exp(-g_RT[3] + g_RT[6] - g_RT[25] + g_RT[26]);
+        Kc[174] = exp(g_RT[6] - g_RT[12] - g_RT[21] + g_RT[26]);
+        Kc[175] = exp(-g_RT[2] + g_RT[6] + g_RT[26] - g_RT[32]);
+        Kc[176] = exp(g_RT[3] - g_RT[6] + g_RT[26] - g_RT[28]);
+        Kc[177] = exp(-g_RT[2] + g_RT[3] - g_RT[12] - g_RT[18] + g_RT[26]);
+        Kc[178] = exp(g_RT[11] - g_RT[13] + g_RT[26] - g_RT[28]);
+        Kc[179] = exp(g_RT[26] - g_RT[27]);
+        Kc[180] = exp(g_RT[0] - g_RT[4] - g_RT[24] + g_RT[27]);
+        Kc[181] = exp(g_RT[6] - g_RT[12] - g_RT[21] + g_RT[27]);
+        Kc[182] = exp(g_RT[11] - g_RT[13] + g_RT[27] - g_RT[28]);
+        Kc[183] = exp(g_RT[0] - g_RT[10] - g_RT[19] + g_RT[28]);
+        Kc[184] = exp(g_RT[0] - g_RT[4] - g_RT[26] + g_RT[28]);
+        Kc[185] = exp(g_RT[0] - g_RT[4] - g_RT[27] + g_RT[28]);
+        Kc[186] = exp(-2*g_RT[0] + g_RT[1] + g_RT[28] - g_RT[32]);
+        Kc[187] = exp(g_RT[1] - g_RT[2] - g_RT[26] + g_RT[28]);
+        Kc[188] = exp(g_RT[1] - g_RT[2] - g_RT[27] + g_RT[28]);
+        Kc[189] = exp(g_RT[2] - g_RT[5] - g_RT[26] + g_RT[28]);
+        Kc[190] = exp(g_RT[2] - g_RT[5] - g_RT[27] + g_RT[28]);
+        Kc[191] = exp(g_RT[0] - g_RT[11] - g_RT[19] + g_RT[32]);
+        Kc[192] = exp(g_RT[1] - g_RT[2] - g_RT[13] - g_RT[18] + g_RT[32]);
+        Kc[193] = exp(g_RT[2] - g_RT[5] - g_RT[13] - g_RT[18] + g_RT[32]);
+        Kc[194] = exp(g_RT[0] - g_RT[4] - g_RT[28] + g_RT[30]);
+        Kc[195] = exp(g_RT[1] - g_RT[10] - g_RT[22] + g_RT[30]);
+        Kc[196] = exp(g_RT[2] - g_RT[5] - g_RT[28] + g_RT[30]);
+        Kc[197] = exp(-g_RT[3] + g_RT[6] - g_RT[28] + g_RT[30]);
+        Kc[198] = exp(-g_RT[2] + g_RT[3] - g_RT[10] - g_RT[22] + g_RT[30]);
+        Kc[199] = exp(g_RT[11] - g_RT[13] + g_RT[30] - g_RT[31]);
+        Kc[200] = exp(g_RT[0] - g_RT[4] - g_RT[28] + g_RT[29]);
+        Kc[201] = exp(g_RT[2] - g_RT[5] - g_RT[28] + g_RT[29]);
+        Kc[202] = exp(-g_RT[3] + g_RT[6] - g_RT[28] + g_RT[29]);
+        Kc[203] = exp(g_RT[11] - g_RT[13] + g_RT[29] - g_RT[31]);
+        Kc[204] = exp(g_RT[0] - g_RT[4] - g_RT[29] + g_RT[31]);
+        Kc[205] = exp(g_RT[0] - g_RT[4] - g_RT[30] + g_RT[31]);
+        Kc[206] = exp(g_RT[1] - g_RT[2] - g_RT[29] + g_RT[31]);
+        Kc[207] = exp(g_RT[1] - g_RT[2] - g_RT[30] + g_RT[31]);
+        Kc[208] = exp(g_RT[2] - g_RT[5] - g_RT[29] + g_RT[31]);
+        Kc[209] = exp(g_RT[2] - g_RT[5] - g_RT[30] + g_RT[31]);
+        Kc[210] = exp(-g_RT[3] + g_RT[6] - g_RT[29] + g_RT[31]);
+        Kc[211] = exp(-g_RT[3] + g_RT[6] - g_RT[30] + g_RT[31]);
+
+        /*reactions with the net stoichiometry of an earlier one */
+        Kc[35] = Kc[34];
+        Kc[36] = Kc[34];
+        Kc[37] = Kc[34];
+        Kc[38] = Kc[34];
+        Kc[40] = Kc[39];
+
+        Kc[0] *= refCinv;
+        Kc[1] *= refCinv;
+        Kc[2] *= refCinv;
+        Kc[3] *= refCinv;
+        Kc[4] *= refCinv;
+        Kc[5] *= refCinv;
+        Kc[6] *= refC;
+        Kc[7] *= refCinv;
+        Kc[8] *= refCinv;
+        Kc[9] *= refCinv;
+        Kc[10] *= refCinv;
+        Kc[11] *= refCinv;
+        Kc[12] *= refCinv;
+        Kc[13] *= refCinv;
+        Kc[14] *= refCinv;
+        Kc[15] *= refCinv;
+        Kc[16] *= refCinv;
+        Kc[17] *= refCinv;
+        Kc[18] *= refCinv;
+        Kc[19] *= refCinv;
+        Kc[20] *= refCinv;
+        Kc[21] *= refCinv;
+        Kc[22] *= refC;
+        Kc[27] *= refCinv;
+        Kc[28] *= refCinv;
+        Kc[29] *= refCinv;
+        Kc[47] *= refC;
+        Kc[60] *= refC;
+        Kc[70] *= refC;
+        Kc[95] *= refC;
+        Kc[96] *= refC;
+        Kc[98] *= refC;
+        Kc[99] *= refC;
+        Kc[102] *= refC;
+        Kc[115] *= refCinv;
+        Kc[116] *= refCinv;
+        Kc[123] *= refCinv;
+        Kc[128] *= refC;
+        Kc[129] *= refC;
+        Kc[143] *= refCinv;
+        Kc[145] *= refCinv;
+        Kc[146] *= refCinv;
+        Kc[148] *= refC;
+        Kc[154] *= refCinv;
+        Kc[155] *= refCinv;
+        Kc[161] *= refCinv;
+        Kc[162] *= refCinv;
+        Kc[171] *= refC;
+        Kc[177] *= refC;
+        Kc[186] *= refC;
+        Kc[192] *= refC;
+        Kc[193] *= refC;
+        Kc[198] *= refC;
+    }
 
     return;
 }
@@ -12857,6 +13438,11 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         mixture += sc[i];
     }
 
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[1][0] - 1)*sc[4] + (TB[1][1] - 1)*sc[5] + (TB[1][2] - 1)*sc[13] + (TB[1][3] - 1)*sc[14];
+    double alpha_eff1 = mixture + (TB[6][0] - 1)*sc[4] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[13] + (TB[6][3] - 1)*sc[14] + (TB[6][4] - 1)*sc[17] + (TB[6][5] - 1)*sc[19];
+    double alpha_eff2 = mixture + (TB[17][0] - 1)*sc[4] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[13] + (TB[17][3] - 1)*sc[14];
+
     double Corr[212];
     for (int i = 0; i < 212; ++i) {
         Corr[i] = 1.0;
@@ -12866,22 +13452,22 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
     {
         double alpha[17];
         alpha[0] = mixture + (TB[0][0] - 1)*sc[5] + (TB[0][1] - 1)*sc[6] + (TB[0][2] - 1)*sc[13] + (TB[0][3] - 1)*sc[14];
-        alpha[1] = mixture + (TB[1][0] - 1)*sc[4] + (TB[1][1] - 1)*sc[5] + (TB[1][2] - 1)*sc[13] + (TB[1][3] - 1)*sc[14];
-        alpha[2] = mixture + (TB[2][0] - 1)*sc[4] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[13] + (TB[2][3] - 1)*sc[14];
-        alpha[3] = mixture + (TB[3][0] - 1)*sc[4] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[13] + (TB[3][3] - 1)*sc[14];
-        alpha[4] = mixture + (TB[4][0] - 1)*sc[4] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[13] + (TB[4][3] - 1)*sc[14];
-        alpha[5] = mixture + (TB[5][0] - 1)*sc[4] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[13] + (TB[5][3] - 1)*sc[14];
-        alpha[6] = mixture + (TB[6][0] - 1)*sc[4] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[13] + (TB[6][3] - 1)*sc[14] + (TB[6][4] - 1)*sc[17] + (TB[6][5] - 1)*sc[19];
-        alpha[7] = mixture + (TB[7][0] - 1)*sc[4] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[13] + (TB[7][3] - 1)*sc[14] + (TB[7][4] - 1)*sc[17] + (TB[7][5] - 1)*sc[19];
+        alpha[1] = alpha_eff0;
+        alpha[2] = (memcmp(TB[2], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[2][0] - 1)*sc[4] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[13] + (TB[2][3] - 1)*sc[14]);
+        alpha[3] = (memcmp(TB[3], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[3][0] - 1)*sc[4] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[13] + (TB[3][3] - 1)*sc[14]);
+        alpha[4] = (memcmp(TB[4], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[4][0] - 1)*sc[4] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[13] + (TB[4][3] - 1)*sc[14]);
+        alpha[5] = (memcmp(TB[5], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[5][0] - 1)*sc[4] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[13] + (TB[5][3] - 1)*sc[14]);
+        alpha[6] = alpha_eff1;
+        alpha[7] = (memcmp(TB[7], TB[6], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[7][0] - 1)*sc[4] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[13] + (TB[7][3] - 1)*sc[14] + (TB[7][4] - 1)*sc[17] + (TB[7][5] - 1)*sc[19]);
         alpha[8] = mixture + (TB[8][0] - 1)*sc[4] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[13] + (TB[8][3] - 1)*sc[14] + (TB[8][4] - 1)*sc[19];
-        alpha[9] = mixture + (TB[9][0] - 1)*sc[4] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[13] + (TB[9][3] - 1)*sc[14] + (TB[9][4] - 1)*sc[17] + (TB[9][5] - 1)*sc[19];
-        alpha[10] = mixture + (TB[10][0] - 1)*sc[4] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[13] + (TB[10][3] - 1)*sc[14] + (TB[10][4] - 1)*sc[17] + (TB[10][5] - 1)*sc[19];
-        alpha[11] = mixture + (TB[11][0] - 1)*sc[4] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[13] + (TB[11][3] - 1)*sc[14] + (TB[11][4] - 1)*sc[17] + (TB[11][5] - 1)*sc[19];
-        alpha[12] = mixture + (TB[12][0] - 1)*sc[4] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[13] + (TB[12][3] - 1)*sc[14];
-        alpha[13] = mixture + (TB[13][0] - 1)*sc[4] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[13] + (TB[13][3] - 1)*sc[14];
-        alpha[14] = mixture + (TB[14][0] - 1)*sc[4] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[13] + (TB[14][3] - 1)*sc[14];
-        alpha[15] = mixture + (TB[15][0] - 1)*sc[4] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[13] + (TB[15][3] - 1)*sc[14];
-        alpha[16] = mixture + (TB[16][0] - 1)*sc[4] + (TB[16][1] - 1)*sc[5] + (TB[16][2] - 1)*sc[13] + (TB[16][3] - 1)*sc[14];
+        alpha[9] = (memcmp(TB[9], TB[6], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[9][0] - 1)*sc[4] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[13] + (TB[9][3] - 1)*sc[14] + (TB[9][4] - 1)*sc[17] + (TB[9][5] - 1)*sc[19]);
+        alpha[10] = (memcmp(TB[10], TB[6], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[10][0] - 1)*sc[4] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[13] + (TB[10][3] - 1)*sc[14] + (TB[10][4] - 1)*sc[17] + (TB[10][5] - 1)*sc[19]);
+        alpha[11] = (memcmp(TB[11], TB[6], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[11][0] - 1)*sc[4] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[13] + (TB[11][3] - 1)*sc[14] + (TB[11][4] - 1)*sc[17] + (TB[11][5] - 1)*sc[19]);
+        alpha[12] = (memcmp(TB[12], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[12][0] - 1)*sc[4] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[13] + (TB[12][3] - 1)*sc[14]);
+        alpha[13] = (memcmp(TB[13], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[13][0] - 1)*sc[4] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[13] + (TB[13][3] - 1)*sc[14]);
+        alpha[14] = (memcmp(TB[14], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[14][0] - 1)*sc[4] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[13] + (TB[14][3] - 1)*sc[14]);
+        alpha[15] = (memcmp(TB[15], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[15][0] - 1)*sc[4] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[13] + (TB[15][3] - 1)*sc[14]);
+        alpha[16] = (memcmp(TB[16], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[16][0] - 1)*sc[4] + (TB[16][1] - 1)*sc[5] + (TB[16][2] - 1)*sc[13] + (TB[16][3] - 1)*sc[14]);
 #ifdef __INTEL_COMPILER
          #pragma simd
 #endif
@@ -12906,7 +13492,7 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
     /* Lindemann */
     {
         double alpha;
-        alpha = mixture + (TB[17][0] - 1)*sc[4] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[13] + (TB[17][3] - 1)*sc[14];
+        alpha = alpha_eff2;
         double redP = alpha / k_f_save[17] * phase_units[17] * low_A[17] * exp(low_beta[17] * tc[0] - activation_units[17] * low_Ea[17] * invT);
         Corr[17] = redP / (1. + redP);
     }
@@ -12918,7 +13504,7 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         Corr[18] = alpha;
         alpha = mixture + (TB[19][0] - 1)*sc[4] + (TB[19][1] - 1)*sc[5] + (TB[19][2] - 1)*sc[13] + (TB[19][3] - 1)*sc[14];
         Corr[19] = alpha;
-        alpha = mixture + (TB[20][0] - 1)*sc[4] + (TB[20][1] - 1)*sc[5] + (TB[20][2] - 1)*sc[13] + (TB[20][3] - 1)*sc[14];
+        alpha = (memcmp(TB[20], TB[17], 4*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[20][0] - 1)*sc[4] + (TB[20][1] - 1)*sc[5] + (TB[20][2] - 1)*sc[13] + (TB[20][3] - 1)*sc[14]);
         Corr[20] = alpha;
         alpha = mixture + (TB[21][0] - 1)*sc[4] + (TB[21][1] - 1)*sc[5] + (TB[21][2] - 1)*sc[13] + (TB[21][3] - 1)*sc[14];
         Corr[21] = alpha;
@@ -16767,17 +17353,24 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         mixture += sc[k];
     }
 
-    /*compute the Gibbs free energy */
-    double g_RT[34];
-    gibbs(g_RT, tc);
-
     /*compute the species enthalpy */
     double h_RT[34];
     speciesEnthalpy(h_RT, tc);
 
+    /*compute the rate and equilibrium constants */
+    double k_f_s[212], Kc_s[212];
+    comp_k_f(tc, invT, k_f_s);
+    comp_Kc(tc, invT, Kc_s);
+
+    /*at constant volume, the part of dwdot/d[X] common to all species */
+    double Jmix[34];
+    for (int k=0; k<34; k++) {
+        Jmix[k] = 0.0;
+    }
+
     double phi_f, k_f, k_r, phi_r, Kc, q, q_nocor, Corr, alpha;
     double dlnkfdT, dlnk0dT, dlnKcdT, dkrdT, dqdT;
-    double dqdci, dcdc_fac, dqdc[34];
+    double dqdci, dcdc_fac;
     double Pr, fPr, F, k_0, logPr;
     double logFcent, troe_c, troe_n, troePr_den, troePr, troe;
     double Fcent1, Fcent2, Fcent3, Fcent;
@@ -16785,6 +17378,12 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     double dlogPrdT, dlogfPrdT, dlogFdT, dlogFcentdT, dlogFdlogPr, dlnCorrdT;
     const double ln10 = log(10.0);
     const double log10e = 1.0/log(10.0);
+
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[1][0] - 1)*sc[4] + (TB[1][1] - 1)*sc[5] + (TB[1][2] - 1)*sc[13] + (TB[1][3] - 1)*sc[14];
+    double alpha_eff1 = mixture + (TB[6][0] - 1)*sc[4] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[13] + (TB[6][3] - 1)*sc[14] + (TB[6][4] - 1)*sc[17] + (TB[6][5] - 1)*sc[19];
+    double alpha_eff2 = mixture + (TB[17][0] - 1)*sc[4] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[13] + (TB[17][3] - 1)*sc[14];
+
     /*reaction 1: H + O2 (+M) <=> HO2 (+M) */
     /*a pressure-fall-off reaction */
     /* also 3-body */
@@ -16792,8 +17391,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[0][0] - 1)*sc[5] + (TB[0][1] - 1)*sc[6] + (TB[0][2] - 1)*sc[13] + (TB[0][3] - 1)*sc[14];
     /* forward */
     phi_f = sc[0]*sc[6];
-    k_f = prefactor_units[0] * fwd_A[0]
-                * exp(fwd_beta[0] * tc[0] - activation_units[0] * fwd_Ea[0] * invT);
+    k_f = k_f_s[0];
     dlnkfdT = fwd_beta[0] * invT + activation_units[0] * fwd_Ea[0] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[0] * exp(low_beta[0] * tc[0] - activation_units[0] * low_Ea[0] * invT);
@@ -16809,16 +17407,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[0] == 4 ? exp(-troe_Tss[0] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
+      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
+      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
-      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
-      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -16826,7 +17424,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[3];
-    Kc = refCinv * exp(g_RT[0] - g_RT[3] + g_RT[6]);
+    Kc = Kc_s[0];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[6]) + (h_RT[3]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -16844,79 +17442,40 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[6];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[3] += dqdci;                /* dwdot[HO2]/d[H] */
-        J[6] -= dqdci;                /* dwdot[O2]/d[H] */
-        /* d()/d[HO2] */
-        dqdci =  - k_r;
-        J[105] -= dqdci;              /* dwdot[H]/d[HO2] */
-        J[108] += dqdci;              /* dwdot[HO2]/d[HO2] */
-        J[111] -= dqdci;              /* dwdot[O2]/d[HO2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[0][0] - 1)*dcdc_fac;
-        J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[178] += dqdci;              /* dwdot[HO2]/d[H2O] */
-        J[181] -= dqdci;              /* dwdot[O2]/d[H2O] */
-        /* d()/d[O2] */
-        dqdci = (TB[0][1] - 1)*dcdc_fac + k_f*sc[0];
-        J[210] -= dqdci;              /* dwdot[H]/d[O2] */
-        J[213] += dqdci;              /* dwdot[HO2]/d[O2] */
-        J[216] -= dqdci;              /* dwdot[O2]/d[O2] */
-        /* d()/d[CO] */
-        dqdci = (TB[0][2] - 1)*dcdc_fac;
-        J[455] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[458] += dqdci;              /* dwdot[HO2]/d[CO] */
-        J[461] -= dqdci;              /* dwdot[O2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[0][3] - 1)*dcdc_fac;
-        J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[493] += dqdci;              /* dwdot[HO2]/d[CO2] */
-        J[496] -= dqdci;              /* dwdot[O2]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[6];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac - k_r;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[0][0]*dcdc_fac;
-        dqdc[6] = TB[0][1]*dcdc_fac + k_f*sc[0];
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[0][2]*dcdc_fac;
-        dqdc[14] = TB[0][3]*dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        for (int k=0; k<34; k++) {
-            J[35*k+0] -= dqdc[k];
-            J[35*k+3] += dqdc[k];
-            J[35*k+6] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[3] += dcdc_fac;
+    Jmix[6] -= dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[6];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[3] += dqdci;                /* dwdot[HO2]/d[H] */
+    J[6] -= dqdci;                /* dwdot[O2]/d[H] */
+    /* d()/d[HO2] */
+    dqdci =  - k_r;
+    J[105] -= dqdci;              /* dwdot[H]/d[HO2] */
+    J[108] += dqdci;              /* dwdot[HO2]/d[HO2] */
+    J[111] -= dqdci;              /* dwdot[O2]/d[HO2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[0][0] - 1)*dcdc_fac;
+    J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[178] += dqdci;              /* dwdot[HO2]/d[H2O] */
+    J[181] -= dqdci;              /* dwdot[O2]/d[H2O] */
+    /* d()/d[O2] */
+    dqdci = (TB[0][1] - 1)*dcdc_fac + k_f*sc[0];
+    J[210] -= dqdci;              /* dwdot[H]/d[O2] */
+    J[213] += dqdci;              /* dwdot[HO2]/d[O2] */
+    J[216] -= dqdci;              /* dwdot[O2]/d[O2] */
+    /* d()/d[CO] */
+    dqdci = (TB[0][2] - 1)*dcdc_fac;
+    J[455] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[458] += dqdci;              /* dwdot[HO2]/d[CO] */
+    J[461] -= dqdci;              /* dwdot[O2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[0][3] - 1)*dcdc_fac;
+    J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[493] += dqdci;              /* dwdot[HO2]/d[CO2] */
+    J[496] -= dqdci;              /* dwdot[O2]/d[CO2] */
     J[1190] -= dqdT; /* dwdot[H]/dT */
     J[1193] += dqdT; /* dwdot[HO2]/dT */
     J[1196] -= dqdT; /* dwdot[O2]/dT */
@@ -16925,11 +17484,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[1][0] - 1)*sc[4] + (TB[1][1] - 1)*sc[5] + (TB[1][2] - 1)*sc[13] + (TB[1][3] - 1)*sc[14];
+    alpha = alpha_eff0;
     /* forward */
     phi_f = sc[4]*sc[13];
-    k_f = prefactor_units[1] * fwd_A[1]
-                * exp(fwd_beta[1] * tc[0] - activation_units[1] * fwd_Ea[1] * invT);
+    k_f = k_f_s[1];
     dlnkfdT = fwd_beta[1] * invT + activation_units[1] * fwd_Ea[1] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[1] * exp(low_beta[1] * tc[0] - activation_units[1] * low_Ea[1] * invT);
@@ -16945,16 +17503,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[1] == 4 ? exp(-troe_Tss[1] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
+      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
+      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
-      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
-      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -16962,7 +17520,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[12];
-    Kc = refCinv * exp(g_RT[4] - g_RT[12] + g_RT[13]);
+    Kc = Kc_s[1];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[13]) + (h_RT[12]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -16980,74 +17538,35 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[1][0] - 1)*dcdc_fac + k_f*sc[13];
-        J[144] -= dqdci;              /* dwdot[H2]/d[H2] */
-        J[152] += dqdci;              /* dwdot[CH2O]/d[H2] */
-        J[153] -= dqdci;              /* dwdot[CO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[1][1] - 1)*dcdc_fac;
-        J[179] -= dqdci;              /* dwdot[H2]/d[H2O] */
-        J[187] += dqdci;              /* dwdot[CH2O]/d[H2O] */
-        J[188] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        /* d()/d[CH2O] */
-        dqdci =  - k_r;
-        J[424] -= dqdci;              /* dwdot[H2]/d[CH2O] */
-        J[432] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
-        J[433] -= dqdci;              /* dwdot[CO]/d[CH2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[1][2] - 1)*dcdc_fac + k_f*sc[4];
-        J[459] -= dqdci;              /* dwdot[H2]/d[CO] */
-        J[467] += dqdci;              /* dwdot[CH2O]/d[CO] */
-        J[468] -= dqdci;              /* dwdot[CO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[1][3] - 1)*dcdc_fac;
-        J[494] -= dqdci;              /* dwdot[H2]/d[CO2] */
-        J[502] += dqdci;              /* dwdot[CH2O]/d[CO2] */
-        J[503] -= dqdci;              /* dwdot[CO]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[1][0]*dcdc_fac + k_f*sc[13];
-        dqdc[5] = TB[1][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac - k_r;
-        dqdc[13] = TB[1][2]*dcdc_fac + k_f*sc[4];
-        dqdc[14] = TB[1][3]*dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        for (int k=0; k<34; k++) {
-            J[35*k+4] -= dqdc[k];
-            J[35*k+12] += dqdc[k];
-            J[35*k+13] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[4] -= dcdc_fac;
+    Jmix[12] += dcdc_fac;
+    Jmix[13] -= dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[1][0] - 1)*dcdc_fac + k_f*sc[13];
+    J[144] -= dqdci;              /* dwdot[H2]/d[H2] */
+    J[152] += dqdci;              /* dwdot[CH2O]/d[H2] */
+    J[153] -= dqdci;              /* dwdot[CO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[1][1] - 1)*dcdc_fac;
+    J[179] -= dqdci;              /* dwdot[H2]/d[H2O] */
+    J[187] += dqdci;              /* dwdot[CH2O]/d[H2O] */
+    J[188] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    /* d()/d[CH2O] */
+    dqdci =  - k_r;
+    J[424] -= dqdci;              /* dwdot[H2]/d[CH2O] */
+    J[432] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
+    J[433] -= dqdci;              /* dwdot[CO]/d[CH2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[1][2] - 1)*dcdc_fac + k_f*sc[4];
+    J[459] -= dqdci;              /* dwdot[H2]/d[CO] */
+    J[467] += dqdci;              /* dwdot[CH2O]/d[CO] */
+    J[468] -= dqdci;              /* dwdot[CO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[1][3] - 1)*dcdc_fac;
+    J[494] -= dqdci;              /* dwdot[H2]/d[CO2] */
+    J[502] += dqdci;              /* dwdot[CH2O]/d[CO2] */
+    J[503] -= dqdci;              /* dwdot[CO]/d[CO2] */
     J[1194] -= dqdT; /* dwdot[H2]/dT */
     J[1202] += dqdT; /* dwdot[CH2O]/dT */
     J[1203] -= dqdT; /* dwdot[CO]/dT */
@@ -17056,11 +17575,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[2][0] - 1)*sc[4] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[13] + (TB[2][3] - 1)*sc[14];
+    alpha = (memcmp(TB[2], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[2][0] - 1)*sc[4] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[13] + (TB[2][3] - 1)*sc[14]);
     /* forward */
     phi_f = sc[7]*sc[13];
-    k_f = prefactor_units[2] * fwd_A[2]
-                * exp(fwd_beta[2] * tc[0] - activation_units[2] * fwd_Ea[2] * invT);
+    k_f = k_f_s[2];
     dlnkfdT = fwd_beta[2] * invT + activation_units[2] * fwd_Ea[2] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[2] * exp(low_beta[2] * tc[0] - activation_units[2] * low_Ea[2] * invT);
@@ -17076,16 +17594,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[2] == 4 ? exp(-troe_Tss[2] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[2]) > 1.e-100 ? -Fcent1/troe_Tsss[2] : 0.)
+      + (fabs(troe_Ts[2]) > 1.e-100 ? -Fcent2/troe_Ts[2] : 0.)
+      + (troe_len[2] == 4 ? Fcent3*troe_Tss[2]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[2]) > 1.e-100 ? -Fcent1/troe_Tsss[2] : 0.)
-      + (fabs(troe_Ts[2]) > 1.e-100 ? -Fcent2/troe_Ts[2] : 0.)
-      + (troe_len[2] == 4 ? Fcent3*troe_Tss[2]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -17093,7 +17611,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[20];
-    Kc = refCinv * exp(g_RT[7] + g_RT[13] - g_RT[20]);
+    Kc = Kc_s[2];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[13]) + (h_RT[20]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -17111,79 +17629,40 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[2][0] - 1)*dcdc_fac;
-        J[147] -= dqdci;              /* dwdot[CH]/d[H2] */
-        J[153] -= dqdci;              /* dwdot[CO]/d[H2] */
-        J[160] += dqdci;              /* dwdot[HCCO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[2][1] - 1)*dcdc_fac;
-        J[182] -= dqdci;              /* dwdot[CH]/d[H2O] */
-        J[188] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[195] += dqdci;              /* dwdot[HCCO]/d[H2O] */
-        /* d()/d[CH] */
-        dqdci =  + k_f*sc[13];
-        J[252] -= dqdci;              /* dwdot[CH]/d[CH] */
-        J[258] -= dqdci;              /* dwdot[CO]/d[CH] */
-        J[265] += dqdci;              /* dwdot[HCCO]/d[CH] */
-        /* d()/d[CO] */
-        dqdci = (TB[2][2] - 1)*dcdc_fac + k_f*sc[7];
-        J[462] -= dqdci;              /* dwdot[CH]/d[CO] */
-        J[468] -= dqdci;              /* dwdot[CO]/d[CO] */
-        J[475] += dqdci;              /* dwdot[HCCO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[2][3] - 1)*dcdc_fac;
-        J[497] -= dqdci;              /* dwdot[CH]/d[CO2] */
-        J[503] -= dqdci;              /* dwdot[CO]/d[CO2] */
-        J[510] += dqdci;              /* dwdot[HCCO]/d[CO2] */
-        /* d()/d[HCCO] */
-        dqdci =  - k_r;
-        J[707] -= dqdci;              /* dwdot[CH]/d[HCCO] */
-        J[713] -= dqdci;              /* dwdot[CO]/d[HCCO] */
-        J[720] += dqdci;              /* dwdot[HCCO]/d[HCCO] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[2][0]*dcdc_fac;
-        dqdc[5] = TB[2][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac + k_f*sc[13];
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[2][2]*dcdc_fac + k_f*sc[7];
-        dqdc[14] = TB[2][3]*dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac - k_r;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        for (int k=0; k<34; k++) {
-            J[35*k+7] -= dqdc[k];
-            J[35*k+13] -= dqdc[k];
-            J[35*k+20] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[7] -= dcdc_fac;
+    Jmix[13] -= dcdc_fac;
+    Jmix[20] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[2][0] - 1)*dcdc_fac;
+    J[147] -= dqdci;              /* dwdot[CH]/d[H2] */
+    J[153] -= dqdci;              /* dwdot[CO]/d[H2] */
+    J[160] += dqdci;              /* dwdot[HCCO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[2][1] - 1)*dcdc_fac;
+    J[182] -= dqdci;              /* dwdot[CH]/d[H2O] */
+    J[188] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[195] += dqdci;              /* dwdot[HCCO]/d[H2O] */
+    /* d()/d[CH] */
+    dqdci =  + k_f*sc[13];
+    J[252] -= dqdci;              /* dwdot[CH]/d[CH] */
+    J[258] -= dqdci;              /* dwdot[CO]/d[CH] */
+    J[265] += dqdci;              /* dwdot[HCCO]/d[CH] */
+    /* d()/d[CO] */
+    dqdci = (TB[2][2] - 1)*dcdc_fac + k_f*sc[7];
+    J[462] -= dqdci;              /* dwdot[CH]/d[CO] */
+    J[468] -= dqdci;              /* dwdot[CO]/d[CO] */
+    J[475] += dqdci;              /* dwdot[HCCO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[2][3] - 1)*dcdc_fac;
+    J[497] -= dqdci;              /* dwdot[CH]/d[CO2] */
+    J[503] -= dqdci;              /* dwdot[CO]/d[CO2] */
+    J[510] += dqdci;              /* dwdot[HCCO]/d[CO2] */
+    /* d()/d[HCCO] */
+    dqdci =  - k_r;
+    J[707] -= dqdci;              /* dwdot[CH]/d[HCCO] */
+    J[713] -= dqdci;              /* dwdot[CO]/d[HCCO] */
+    J[720] += dqdci;              /* dwdot[HCCO]/d[HCCO] */
     J[1197] -= dqdT; /* dwdot[CH]/dT */
     J[1203] -= dqdT; /* dwdot[CO]/dT */
     J[1210] += dqdT; /* dwdot[HCCO]/dT */
@@ -17192,11 +17671,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[3][0] - 1)*sc[4] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[13] + (TB[3][3] - 1)*sc[14];
+    alpha = (memcmp(TB[3], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[3][0] - 1)*sc[4] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[13] + (TB[3][3] - 1)*sc[14]);
     /* forward */
     phi_f = sc[0]*sc[11];
-    k_f = prefactor_units[3] * fwd_A[3]
-                * exp(fwd_beta[3] * tc[0] - activation_units[3] * fwd_Ea[3] * invT);
+    k_f = k_f_s[3];
     dlnkfdT = fwd_beta[3] * invT + activation_units[3] * fwd_Ea[3] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[3] * exp(low_beta[3] * tc[0] - activation_units[3] * low_Ea[3] * invT);
@@ -17212,16 +17690,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[3] == 4 ? exp(-troe_Tss[3] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[3]) > 1.e-100 ? -Fcent1/troe_Tsss[3] : 0.)
+      + (fabs(troe_Ts[3]) > 1.e-100 ? -Fcent2/troe_Ts[3] : 0.)
+      + (troe_len[3] == 4 ? Fcent3*troe_Tss[3]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[3]) > 1.e-100 ? -Fcent1/troe_Tsss[3] : 0.)
-      + (fabs(troe_Ts[3]) > 1.e-100 ? -Fcent2/troe_Ts[3] : 0.)
-      + (troe_len[3] == 4 ? Fcent3*troe_Tss[3]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -17229,7 +17707,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[12];
-    Kc = refCinv * exp(g_RT[0] + g_RT[11] - g_RT[12]);
+    Kc = Kc_s[3];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[11]) + (h_RT[12]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -17247,97 +17725,57 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[11];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[11] -= dqdci;               /* dwdot[HCO]/d[H] */
-        J[12] += dqdci;               /* dwdot[CH2O]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[3][0] - 1)*dcdc_fac;
-        J[140] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[151] -= dqdci;              /* dwdot[HCO]/d[H2] */
-        J[152] += dqdci;              /* dwdot[CH2O]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[3][1] - 1)*dcdc_fac;
-        J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[186] -= dqdci;              /* dwdot[HCO]/d[H2O] */
-        J[187] += dqdci;              /* dwdot[CH2O]/d[H2O] */
-        /* d()/d[HCO] */
-        dqdci =  + k_f*sc[0];
-        J[385] -= dqdci;              /* dwdot[H]/d[HCO] */
-        J[396] -= dqdci;              /* dwdot[HCO]/d[HCO] */
-        J[397] += dqdci;              /* dwdot[CH2O]/d[HCO] */
-        /* d()/d[CH2O] */
-        dqdci =  - k_r;
-        J[420] -= dqdci;              /* dwdot[H]/d[CH2O] */
-        J[431] -= dqdci;              /* dwdot[HCO]/d[CH2O] */
-        J[432] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[3][2] - 1)*dcdc_fac;
-        J[455] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[466] -= dqdci;              /* dwdot[HCO]/d[CO] */
-        J[467] += dqdci;              /* dwdot[CH2O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[3][3] - 1)*dcdc_fac;
-        J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[501] -= dqdci;              /* dwdot[HCO]/d[CO2] */
-        J[502] += dqdci;              /* dwdot[CH2O]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[11];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[3][0]*dcdc_fac;
-        dqdc[5] = TB[3][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac + k_f*sc[0];
-        dqdc[12] = dcdc_fac - k_r;
-        dqdc[13] = TB[3][2]*dcdc_fac;
-        dqdc[14] = TB[3][3]*dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        for (int k=0; k<34; k++) {
-            J[35*k+0] -= dqdc[k];
-            J[35*k+11] -= dqdc[k];
-            J[35*k+12] += dqdc[k];
-        }
-    }
-    J[1190] -= dqdT; /* dwdot[H]/dT */
-    J[1201] -= dqdT; /* dwdot[HCO]/dT */
-    J[1202] += dqdT; /* dwdot[CH2O]/dT */
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[11] -= dcdc_fac;
+    Jmix[12] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[11];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[11] -= dqdci;               /* dwdot[HCO]/d[H] */
+    J[12] += dqdci;               /* dwdot[CH2O]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[3][0] - 1)*dcdc_fac;
+    J[140] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[151] -= dqdci;              /* dwdot[HCO]/d[H2] */
+    J[152] += dqdci;              /* dwdot[CH2O]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[3][1] - 1)*dcdc_fac;
+    J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[186] -= dqdci;              /* dwdot[HCO]/d[H2O] */
+    J[187] += dqdci;              /* dwdot[CH2O]/d[H2O] */
+    /* d()/d[HCO] */
+    dqdci =  + k_f*sc[0];
+    J[385] -= dqdci;              /* dwdot[H]/d[HCO] */
+    J[396] -= dqdci;              /* dwdot[HCO]/d[HCO] */
+    J[397] += dqdci;              /* dwdot[CH2O]/d[HCO] */
+    /* d()/d[CH2O] */
+    dqdci =  - k_r;
+    J[420] -= dqdci;              /* dwdot[H]/d[CH2O] */
+    J[431] -= dqdci;              /* dwdot[HCO]/d[CH2O] */
+    J[432] += dqdci;              /* dwdot[CH2O]/d[CH2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[3][2] - 1)*dcdc_fac;
+    J[455] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[466] -= dqdci;              /* dwdot[HCO]/d[CO] */
+    J[467] += dqdci;              /* dwdot[CH2O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[3][3] - 1)*dcdc_fac;
+    J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[501] -= dqdci;              /* dwdot[HCO]/d[CO2] */
+    J[502] += dqdci;              /* dwdot[CH2O]/d[CO2] */
+    J[1190] -= dqdT; /* dwdot[H]/dT */
+    J[1201] -= dqdT; /* dwdot[HCO]/dT */
+    J[1202] += dqdT; /* dwdot[CH2O]/dT */
 
     /*reaction 5: CH2 + H (+M) <=> CH3 (+M) */
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[4][0] - 1)*sc[4] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[13] + (TB[4][3] - 1)*sc[14];
+    alpha = (memcmp(TB[4], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[4][0] - 1)*sc[4] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[13] + (TB[4][3] - 1)*sc[14]);
     /* forward */
     phi_f = sc[0]*sc[8];
-    k_f = prefactor_units[4] * fwd_A[4]
-                * exp(fwd_beta[4] * tc[0] - activation_units[4] * fwd_Ea[4] * invT);
+    k_f = k_f_s[4];
     dlnkfdT = fwd_beta[4] * invT + activation_units[4] * fwd_Ea[4] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[4] * exp(low_beta[4] * tc[0] - activation_units[4] * low_Ea[4] * invT);
@@ -17353,16 +17791,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[4] == 4 ? exp(-troe_Tss[4] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[4]) > 1.e-100 ? -Fcent1/troe_Tsss[4] : 0.)
+      + (fabs(troe_Ts[4]) > 1.e-100 ? -Fcent2/troe_Ts[4] : 0.)
+      + (troe_len[4] == 4 ? Fcent3*troe_Tss[4]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[4]) > 1.e-100 ? -Fcent1/troe_Tsss[4] : 0.)
-      + (fabs(troe_Ts[4]) > 1.e-100 ? -Fcent2/troe_Ts[4] : 0.)
-      + (troe_len[4] == 4 ? Fcent3*troe_Tss[4]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -17370,7 +17808,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[10];
-    Kc = refCinv * exp(g_RT[0] + g_RT[8] - g_RT[10]);
+    Kc = Kc_s[4];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[8]) + (h_RT[10]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -17388,84 +17826,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[8];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[8] -= dqdci;                /* dwdot[CH2]/d[H] */
-        J[10] += dqdci;               /* dwdot[CH3]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[4][0] - 1)*dcdc_fac;
-        J[140] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[148] -= dqdci;              /* dwdot[CH2]/d[H2] */
-        J[150] += dqdci;              /* dwdot[CH3]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[4][1] - 1)*dcdc_fac;
-        J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[183] -= dqdci;              /* dwdot[CH2]/d[H2O] */
-        J[185] += dqdci;              /* dwdot[CH3]/d[H2O] */
-        /* d()/d[CH2] */
-        dqdci =  + k_f*sc[0];
-        J[280] -= dqdci;              /* dwdot[H]/d[CH2] */
-        J[288] -= dqdci;              /* dwdot[CH2]/d[CH2] */
-        J[290] += dqdci;              /* dwdot[CH3]/d[CH2] */
-        /* d()/d[CH3] */
-        dqdci =  - k_r;
-        J[350] -= dqdci;              /* dwdot[H]/d[CH3] */
-        J[358] -= dqdci;              /* dwdot[CH2]/d[CH3] */
-        J[360] += dqdci;              /* dwdot[CH3]/d[CH3] */
-        /* d()/d[CO] */
-        dqdci = (TB[4][2] - 1)*dcdc_fac;
-        J[455] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[463] -= dqdci;              /* dwdot[CH2]/d[CO] */
-        J[465] += dqdci;              /* dwdot[CH3]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[4][3] - 1)*dcdc_fac;
-        J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[498] -= dqdci;              /* dwdot[CH2]/d[CO2] */
-        J[500] += dqdci;              /* dwdot[CH3]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[8];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[4][0]*dcdc_fac;
-        dqdc[5] = TB[4][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac + k_f*sc[0];
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac - k_r;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[4][2]*dcdc_fac;
-        dqdc[14] = TB[4][3]*dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        for (int k=0; k<34; k++) {
-            J[35*k+0] -= dqdc[k];
-            J[35*k+8] -= dqdc[k];
-            J[35*k+10] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[8] -= dcdc_fac;
+    Jmix[10] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[8];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[8] -= dqdci;                /* dwdot[CH2]/d[H] */
+    J[10] += dqdci;               /* dwdot[CH3]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[4][0] - 1)*dcdc_fac;
+    J[140] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[148] -= dqdci;              /* dwdot[CH2]/d[H2] */
+    J[150] += dqdci;              /* dwdot[CH3]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[4][1] - 1)*dcdc_fac;
+    J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[183] -= dqdci;              /* dwdot[CH2]/d[H2O] */
+    J[185] += dqdci;              /* dwdot[CH3]/d[H2O] */
+    /* d()/d[CH2] */
+    dqdci =  + k_f*sc[0];
+    J[280] -= dqdci;              /* dwdot[H]/d[CH2] */
+    J[288] -= dqdci;              /* dwdot[CH2]/d[CH2] */
+    J[290] += dqdci;              /* dwdot[CH3]/d[CH2] */
+    /* d()/d[CH3] */
+    dqdci =  - k_r;
+    J[350] -= dqdci;              /* dwdot[H]/d[CH3] */
+    J[358] -= dqdci;              /* dwdot[CH2]/d[CH3] */
+    J[360] += dqdci;              /* dwdot[CH3]/d[CH3] */
+    /* d()/d[CO] */
+    dqdci = (TB[4][2] - 1)*dcdc_fac;
+    J[455] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[463] -= dqdci;              /* dwdot[CH2]/d[CO] */
+    J[465] += dqdci;              /* dwdot[CH3]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[4][3] - 1)*dcdc_fac;
+    J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[498] -= dqdci;              /* dwdot[CH2]/d[CO2] */
+    J[500] += dqdci;              /* dwdot[CH3]/d[CO2] */
     J[1190] -= dqdT; /* dwdot[H]/dT */
     J[1198] -= dqdT; /* dwdot[CH2]/dT */
     J[1200] += dqdT; /* dwdot[CH3]/dT */
@@ -17474,11 +17873,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[5][0] - 1)*sc[4] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[13] + (TB[5][3] - 1)*sc[14];
+    alpha = (memcmp(TB[5], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[5][0] - 1)*sc[4] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[13] + (TB[5][3] - 1)*sc[14]);
     /* forward */
     phi_f = sc[0]*sc[16];
-    k_f = prefactor_units[5] * fwd_A[5]
-                * exp(fwd_beta[5] * tc[0] - activation_units[5] * fwd_Ea[5] * invT);
+    k_f = k_f_s[5];
     dlnkfdT = fwd_beta[5] * invT + activation_units[5] * fwd_Ea[5] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[5] * exp(low_beta[5] * tc[0] - activation_units[5] * low_Ea[5] * invT);
@@ -17494,16 +17892,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[5] == 4 ? exp(-troe_Tss[5] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[5]) > 1.e-100 ? -Fcent1/troe_Tsss[5] : 0.)
+      + (fabs(troe_Ts[5]) > 1.e-100 ? -Fcent2/troe_Ts[5] : 0.)
+      + (troe_len[5] == 4 ? Fcent3*troe_Tss[5]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[5]) > 1.e-100 ? -Fcent1/troe_Tsss[5] : 0.)
-      + (fabs(troe_Ts[5]) > 1.e-100 ? -Fcent2/troe_Ts[5] : 0.)
-      + (troe_len[5] == 4 ? Fcent3*troe_Tss[5]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -17511,7 +17909,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[17];
-    Kc = refCinv * exp(g_RT[0] + g_RT[16] - g_RT[17]);
+    Kc = Kc_s[5];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[16]) + (h_RT[17]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -17529,84 +17927,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[16];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[16] -= dqdci;               /* dwdot[C2H]/d[H] */
-        J[17] += dqdci;               /* dwdot[C2H2]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[5][0] - 1)*dcdc_fac;
-        J[140] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[156] -= dqdci;              /* dwdot[C2H]/d[H2] */
-        J[157] += dqdci;              /* dwdot[C2H2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[5][1] - 1)*dcdc_fac;
-        J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[191] -= dqdci;              /* dwdot[C2H]/d[H2O] */
-        J[192] += dqdci;              /* dwdot[C2H2]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[5][2] - 1)*dcdc_fac;
-        J[455] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[471] -= dqdci;              /* dwdot[C2H]/d[CO] */
-        J[472] += dqdci;              /* dwdot[C2H2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[5][3] - 1)*dcdc_fac;
-        J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[506] -= dqdci;              /* dwdot[C2H]/d[CO2] */
-        J[507] += dqdci;              /* dwdot[C2H2]/d[CO2] */
-        /* d()/d[C2H] */
-        dqdci =  + k_f*sc[0];
-        J[560] -= dqdci;              /* dwdot[H]/d[C2H] */
-        J[576] -= dqdci;              /* dwdot[C2H]/d[C2H] */
-        J[577] += dqdci;              /* dwdot[C2H2]/d[C2H] */
-        /* d()/d[C2H2] */
-        dqdci =  - k_r;
-        J[595] -= dqdci;              /* dwdot[H]/d[C2H2] */
-        J[611] -= dqdci;              /* dwdot[C2H]/d[C2H2] */
-        J[612] += dqdci;              /* dwdot[C2H2]/d[C2H2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[16];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[5][0]*dcdc_fac;
-        dqdc[5] = TB[5][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[5][2]*dcdc_fac;
-        dqdc[14] = TB[5][3]*dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac + k_f*sc[0];
-        dqdc[17] = dcdc_fac - k_r;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        for (int k=0; k<34; k++) {
-            J[35*k+0] -= dqdc[k];
-            J[35*k+16] -= dqdc[k];
-            J[35*k+17] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[16] -= dcdc_fac;
+    Jmix[17] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[16];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[16] -= dqdci;               /* dwdot[C2H]/d[H] */
+    J[17] += dqdci;               /* dwdot[C2H2]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[5][0] - 1)*dcdc_fac;
+    J[140] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[156] -= dqdci;              /* dwdot[C2H]/d[H2] */
+    J[157] += dqdci;              /* dwdot[C2H2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[5][1] - 1)*dcdc_fac;
+    J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[191] -= dqdci;              /* dwdot[C2H]/d[H2O] */
+    J[192] += dqdci;              /* dwdot[C2H2]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[5][2] - 1)*dcdc_fac;
+    J[455] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[471] -= dqdci;              /* dwdot[C2H]/d[CO] */
+    J[472] += dqdci;              /* dwdot[C2H2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[5][3] - 1)*dcdc_fac;
+    J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[506] -= dqdci;              /* dwdot[C2H]/d[CO2] */
+    J[507] += dqdci;              /* dwdot[C2H2]/d[CO2] */
+    /* d()/d[C2H] */
+    dqdci =  + k_f*sc[0];
+    J[560] -= dqdci;              /* dwdot[H]/d[C2H] */
+    J[576] -= dqdci;              /* dwdot[C2H]/d[C2H] */
+    J[577] += dqdci;              /* dwdot[C2H2]/d[C2H] */
+    /* d()/d[C2H2] */
+    dqdci =  - k_r;
+    J[595] -= dqdci;              /* dwdot[H]/d[C2H2] */
+    J[611] -= dqdci;              /* dwdot[C2H]/d[C2H2] */
+    J[612] += dqdci;              /* dwdot[C2H2]/d[C2H2] */
     J[1190] -= dqdT; /* dwdot[H]/dT */
     J[1206] -= dqdT; /* dwdot[C2H]/dT */
     J[1207] += dqdT; /* dwdot[C2H2]/dT */
@@ -17615,11 +17974,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[6][0] - 1)*sc[4] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[13] + (TB[6][3] - 1)*sc[14] + (TB[6][4] - 1)*sc[17] + (TB[6][5] - 1)*sc[19];
+    alpha = alpha_eff1;
     /* forward */
     phi_f = sc[18];
-    k_f = prefactor_units[6] * fwd_A[6]
-                * exp(fwd_beta[6] * tc[0] - activation_units[6] * fwd_Ea[6] * invT);
+    k_f = k_f_s[6];
     dlnkfdT = fwd_beta[6] * invT + activation_units[6] * fwd_Ea[6] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[6] * exp(low_beta[6] * tc[0] - activation_units[6] * low_Ea[6] * invT);
@@ -17635,16 +17993,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[6] == 4 ? exp(-troe_Tss[6] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[6]) > 1.e-100 ? -Fcent1/troe_Tsss[6] : 0.)
+      + (fabs(troe_Ts[6]) > 1.e-100 ? -Fcent2/troe_Ts[6] : 0.)
+      + (troe_len[6] == 4 ? Fcent3*troe_Tss[6]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[6]) > 1.e-100 ? -Fcent1/troe_Tsss[6] : 0.)
-      + (fabs(troe_Ts[6]) > 1.e-100 ? -Fcent2/troe_Ts[6] : 0.)
-      + (troe_len[6] == 4 ? Fcent3*troe_Tss[6]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -17652,7 +18010,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[0]*sc[17];
-    Kc = refC * exp(-g_RT[0] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[6];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[18]) + (h_RT[0] + h_RT[17]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -17670,89 +18028,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[17];
-        J[0] += dqdci;                /* dwdot[H]/d[H] */
-        J[17] += dqdci;               /* dwdot[C2H2]/d[H] */
-        J[18] -= dqdci;               /* dwdot[C2H3]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[6][0] - 1)*dcdc_fac;
-        J[140] += dqdci;              /* dwdot[H]/d[H2] */
-        J[157] += dqdci;              /* dwdot[C2H2]/d[H2] */
-        J[158] -= dqdci;              /* dwdot[C2H3]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[6][1] - 1)*dcdc_fac;
-        J[175] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[192] += dqdci;              /* dwdot[C2H2]/d[H2O] */
-        J[193] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[6][2] - 1)*dcdc_fac;
-        J[455] += dqdci;              /* dwdot[H]/d[CO] */
-        J[472] += dqdci;              /* dwdot[C2H2]/d[CO] */
-        J[473] -= dqdci;              /* dwdot[C2H3]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[6][3] - 1)*dcdc_fac;
-        J[490] += dqdci;              /* dwdot[H]/d[CO2] */
-        J[507] += dqdci;              /* dwdot[C2H2]/d[CO2] */
-        J[508] -= dqdci;              /* dwdot[C2H3]/d[CO2] */
-        /* d()/d[C2H2] */
-        dqdci = (TB[6][4] - 1)*dcdc_fac - k_r*sc[0];
-        J[595] += dqdci;              /* dwdot[H]/d[C2H2] */
-        J[612] += dqdci;              /* dwdot[C2H2]/d[C2H2] */
-        J[613] -= dqdci;              /* dwdot[C2H3]/d[C2H2] */
-        /* d()/d[C2H3] */
-        dqdci =  + k_f;
-        J[630] += dqdci;              /* dwdot[H]/d[C2H3] */
-        J[647] += dqdci;              /* dwdot[C2H2]/d[C2H3] */
-        J[648] -= dqdci;              /* dwdot[C2H3]/d[C2H3] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[6][5] - 1)*dcdc_fac;
-        J[665] += dqdci;              /* dwdot[H]/d[C2H4] */
-        J[682] += dqdci;              /* dwdot[C2H2]/d[C2H4] */
-        J[683] -= dqdci;              /* dwdot[C2H3]/d[C2H4] */
-    }
-    else {
-        dqdc[0] = dcdc_fac - k_r*sc[17];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[6][0]*dcdc_fac;
-        dqdc[5] = TB[6][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[6][2]*dcdc_fac;
-        dqdc[14] = TB[6][3]*dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = TB[6][4]*dcdc_fac - k_r*sc[0];
-        dqdc[18] = dcdc_fac + k_f;
-        dqdc[19] = TB[6][5]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        for (int k=0; k<34; k++) {
-            J[35*k+0] += dqdc[k];
-            J[35*k+17] += dqdc[k];
-            J[35*k+18] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += dcdc_fac;
+    Jmix[17] += dcdc_fac;
+    Jmix[18] -= dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[17];
+    J[0] += dqdci;                /* dwdot[H]/d[H] */
+    J[17] += dqdci;               /* dwdot[C2H2]/d[H] */
+    J[18] -= dqdci;               /* dwdot[C2H3]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[6][0] - 1)*dcdc_fac;
+    J[140] += dqdci;              /* dwdot[H]/d[H2] */
+    J[157] += dqdci;              /* dwdot[C2H2]/d[H2] */
+    J[158] -= dqdci;              /* dwdot[C2H3]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[6][1] - 1)*dcdc_fac;
+    J[175] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[192] += dqdci;              /* dwdot[C2H2]/d[H2O] */
+    J[193] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[6][2] - 1)*dcdc_fac;
+    J[455] += dqdci;              /* dwdot[H]/d[CO] */
+    J[472] += dqdci;              /* dwdot[C2H2]/d[CO] */
+    J[473] -= dqdci;              /* dwdot[C2H3]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[6][3] - 1)*dcdc_fac;
+    J[490] += dqdci;              /* dwdot[H]/d[CO2] */
+    J[507] += dqdci;              /* dwdot[C2H2]/d[CO2] */
+    J[508] -= dqdci;              /* dwdot[C2H3]/d[CO2] */
+    /* d()/d[C2H2] */
+    dqdci = (TB[6][4] - 1)*dcdc_fac - k_r*sc[0];
+    J[595] += dqdci;              /* dwdot[H]/d[C2H2] */
+    J[612] += dqdci;              /* dwdot[C2H2]/d[C2H2] */
+    J[613] -= dqdci;              /* dwdot[C2H3]/d[C2H2] */
+    /* d()/d[C2H3] */
+    dqdci =  + k_f;
+    J[630] += dqdci;              /* dwdot[H]/d[C2H3] */
+    J[647] += dqdci;              /* dwdot[C2H2]/d[C2H3] */
+    J[648] -= dqdci;              /* dwdot[C2H3]/d[C2H3] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[6][5] - 1)*dcdc_fac;
+    J[665] += dqdci;              /* dwdot[H]/d[C2H4] */
+    J[682] += dqdci;              /* dwdot[C2H2]/d[C2H4] */
+    J[683] -= dqdci;              /* dwdot[C2H3]/d[C2H4] */
     J[1190] += dqdT; /* dwdot[H]/dT */
     J[1207] += dqdT; /* dwdot[C2H2]/dT */
     J[1208] -= dqdT; /* dwdot[C2H3]/dT */
@@ -17761,11 +18080,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[7][0] - 1)*sc[4] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[13] + (TB[7][3] - 1)*sc[14] + (TB[7][4] - 1)*sc[17] + (TB[7][5] - 1)*sc[19];
+    alpha = (memcmp(TB[7], TB[6], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[7][0] - 1)*sc[4] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[13] + (TB[7][3] - 1)*sc[14] + (TB[7][4] - 1)*sc[17] + (TB[7][5] - 1)*sc[19]);
     /* forward */
     phi_f = sc[0]*sc[18];
-    k_f = prefactor_units[7] * fwd_A[7]
-                * exp(fwd_beta[7] * tc[0] - activation_units[7] * fwd_Ea[7] * invT);
+    k_f = k_f_s[7];
     dlnkfdT = fwd_beta[7] * invT + activation_units[7] * fwd_Ea[7] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[7] * exp(low_beta[7] * tc[0] - activation_units[7] * low_Ea[7] * invT);
@@ -17781,16 +18099,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[7] == 4 ? exp(-troe_Tss[7] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[7]) > 1.e-100 ? -Fcent1/troe_Tsss[7] : 0.)
+      + (fabs(troe_Ts[7]) > 1.e-100 ? -Fcent2/troe_Ts[7] : 0.)
+      + (troe_len[7] == 4 ? Fcent3*troe_Tss[7]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[7]) > 1.e-100 ? -Fcent1/troe_Tsss[7] : 0.)
-      + (fabs(troe_Ts[7]) > 1.e-100 ? -Fcent2/troe_Ts[7] : 0.)
-      + (troe_len[7] == 4 ? Fcent3*troe_Tss[7]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -17798,7 +18116,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[19];
-    Kc = refCinv * exp(g_RT[0] + g_RT[18] - g_RT[19]);
+    Kc = Kc_s[7];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[18]) + (h_RT[19]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -17816,89 +18134,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[18];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[18] -= dqdci;               /* dwdot[C2H3]/d[H] */
-        J[19] += dqdci;               /* dwdot[C2H4]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[7][0] - 1)*dcdc_fac;
-        J[140] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[158] -= dqdci;              /* dwdot[C2H3]/d[H2] */
-        J[159] += dqdci;              /* dwdot[C2H4]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[7][1] - 1)*dcdc_fac;
-        J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[193] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
-        J[194] += dqdci;              /* dwdot[C2H4]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[7][2] - 1)*dcdc_fac;
-        J[455] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[473] -= dqdci;              /* dwdot[C2H3]/d[CO] */
-        J[474] += dqdci;              /* dwdot[C2H4]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[7][3] - 1)*dcdc_fac;
-        J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[508] -= dqdci;              /* dwdot[C2H3]/d[CO2] */
-        J[509] += dqdci;              /* dwdot[C2H4]/d[CO2] */
-        /* d()/d[C2H2] */
-        dqdci = (TB[7][4] - 1)*dcdc_fac;
-        J[595] -= dqdci;              /* dwdot[H]/d[C2H2] */
-        J[613] -= dqdci;              /* dwdot[C2H3]/d[C2H2] */
-        J[614] += dqdci;              /* dwdot[C2H4]/d[C2H2] */
-        /* d()/d[C2H3] */
-        dqdci =  + k_f*sc[0];
-        J[630] -= dqdci;              /* dwdot[H]/d[C2H3] */
-        J[648] -= dqdci;              /* dwdot[C2H3]/d[C2H3] */
-        J[649] += dqdci;              /* dwdot[C2H4]/d[C2H3] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[7][5] - 1)*dcdc_fac - k_r;
-        J[665] -= dqdci;              /* dwdot[H]/d[C2H4] */
-        J[683] -= dqdci;              /* dwdot[C2H3]/d[C2H4] */
-        J[684] += dqdci;              /* dwdot[C2H4]/d[C2H4] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[18];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[7][0]*dcdc_fac;
-        dqdc[5] = TB[7][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[7][2]*dcdc_fac;
-        dqdc[14] = TB[7][3]*dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = TB[7][4]*dcdc_fac;
-        dqdc[18] = dcdc_fac + k_f*sc[0];
-        dqdc[19] = TB[7][5]*dcdc_fac - k_r;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        for (int k=0; k<34; k++) {
-            J[35*k+0] -= dqdc[k];
-            J[35*k+18] -= dqdc[k];
-            J[35*k+19] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[18] -= dcdc_fac;
+    Jmix[19] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[18];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[18] -= dqdci;               /* dwdot[C2H3]/d[H] */
+    J[19] += dqdci;               /* dwdot[C2H4]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[7][0] - 1)*dcdc_fac;
+    J[140] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[158] -= dqdci;              /* dwdot[C2H3]/d[H2] */
+    J[159] += dqdci;              /* dwdot[C2H4]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[7][1] - 1)*dcdc_fac;
+    J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[193] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
+    J[194] += dqdci;              /* dwdot[C2H4]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[7][2] - 1)*dcdc_fac;
+    J[455] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[473] -= dqdci;              /* dwdot[C2H3]/d[CO] */
+    J[474] += dqdci;              /* dwdot[C2H4]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[7][3] - 1)*dcdc_fac;
+    J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[508] -= dqdci;              /* dwdot[C2H3]/d[CO2] */
+    J[509] += dqdci;              /* dwdot[C2H4]/d[CO2] */
+    /* d()/d[C2H2] */
+    dqdci = (TB[7][4] - 1)*dcdc_fac;
+    J[595] -= dqdci;              /* dwdot[H]/d[C2H2] */
+    J[613] -= dqdci;              /* dwdot[C2H3]/d[C2H2] */
+    J[614] += dqdci;              /* dwdot[C2H4]/d[C2H2] */
+    /* d()/d[C2H3] */
+    dqdci =  + k_f*sc[0];
+    J[630] -= dqdci;              /* dwdot[H]/d[C2H3] */
+    J[648] -= dqdci;              /* dwdot[C2H3]/d[C2H3] */
+    J[649] += dqdci;              /* dwdot[C2H4]/d[C2H3] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[7][5] - 1)*dcdc_fac - k_r;
+    J[665] -= dqdci;              /* dwdot[H]/d[C2H4] */
+    J[683] -= dqdci;              /* dwdot[C2H3]/d[C2H4] */
+    J[684] += dqdci;              /* dwdot[C2H4]/d[C2H4] */
     J[1190] -= dqdT; /* dwdot[H]/dT */
     J[1208] -= dqdT; /* dwdot[C2H3]/dT */
     J[1209] += dqdT; /* dwdot[C2H4]/dT */
@@ -17910,8 +18189,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[8][0] - 1)*sc[4] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[13] + (TB[8][3] - 1)*sc[14] + (TB[8][4] - 1)*sc[19];
     /* forward */
     phi_f = sc[10]*sc[18];
-    k_f = prefactor_units[8] * fwd_A[8]
-                * exp(fwd_beta[8] * tc[0] - activation_units[8] * fwd_Ea[8] * invT);
+    k_f = k_f_s[8];
     dlnkfdT = fwd_beta[8] * invT + activation_units[8] * fwd_Ea[8] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[8] * exp(low_beta[8] * tc[0] - activation_units[8] * low_Ea[8] * invT);
@@ -17927,16 +18205,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[8] == 4 ? exp(-troe_Tss[8] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[8]) > 1.e-100 ? -Fcent1/troe_Tsss[8] : 0.)
+      + (fabs(troe_Ts[8]) > 1.e-100 ? -Fcent2/troe_Ts[8] : 0.)
+      + (troe_len[8] == 4 ? Fcent3*troe_Tss[8]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[8]) > 1.e-100 ? -Fcent1/troe_Tsss[8] : 0.)
-      + (fabs(troe_Ts[8]) > 1.e-100 ? -Fcent2/troe_Ts[8] : 0.)
-      + (troe_len[8] == 4 ? Fcent3*troe_Tss[8]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -17944,7 +18222,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[28];
-    Kc = refCinv * exp(g_RT[10] + g_RT[18] - g_RT[28]);
+    Kc = Kc_s[8];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[18]) + (h_RT[28]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -17962,89 +18240,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[8][0] - 1)*dcdc_fac;
-        J[150] -= dqdci;              /* dwdot[CH3]/d[H2] */
-        J[158] -= dqdci;              /* dwdot[C2H3]/d[H2] */
-        J[168] += dqdci;              /* dwdot[C3H6]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[8][1] - 1)*dcdc_fac;
-        J[185] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[193] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
-        J[203] += dqdci;              /* dwdot[C3H6]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[18];
-        J[360] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[368] -= dqdci;              /* dwdot[C2H3]/d[CH3] */
-        J[378] += dqdci;              /* dwdot[C3H6]/d[CH3] */
-        /* d()/d[CO] */
-        dqdci = (TB[8][2] - 1)*dcdc_fac;
-        J[465] -= dqdci;              /* dwdot[CH3]/d[CO] */
-        J[473] -= dqdci;              /* dwdot[C2H3]/d[CO] */
-        J[483] += dqdci;              /* dwdot[C3H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[8][3] - 1)*dcdc_fac;
-        J[500] -= dqdci;              /* dwdot[CH3]/d[CO2] */
-        J[508] -= dqdci;              /* dwdot[C2H3]/d[CO2] */
-        J[518] += dqdci;              /* dwdot[C3H6]/d[CO2] */
-        /* d()/d[C2H3] */
-        dqdci =  + k_f*sc[10];
-        J[640] -= dqdci;              /* dwdot[CH3]/d[C2H3] */
-        J[648] -= dqdci;              /* dwdot[C2H3]/d[C2H3] */
-        J[658] += dqdci;              /* dwdot[C3H6]/d[C2H3] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[8][4] - 1)*dcdc_fac;
-        J[675] -= dqdci;              /* dwdot[CH3]/d[C2H4] */
-        J[683] -= dqdci;              /* dwdot[C2H3]/d[C2H4] */
-        J[693] += dqdci;              /* dwdot[C3H6]/d[C2H4] */
-        /* d()/d[C3H6] */
-        dqdci =  - k_r;
-        J[990] -= dqdci;              /* dwdot[CH3]/d[C3H6] */
-        J[998] -= dqdci;              /* dwdot[C2H3]/d[C3H6] */
-        J[1008] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[8][0]*dcdc_fac;
-        dqdc[5] = TB[8][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac + k_f*sc[18];
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[8][2]*dcdc_fac;
-        dqdc[14] = TB[8][3]*dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac + k_f*sc[10];
-        dqdc[19] = TB[8][4]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac - k_r;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        for (int k=0; k<34; k++) {
-            J[35*k+10] -= dqdc[k];
-            J[35*k+18] -= dqdc[k];
-            J[35*k+28] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[10] -= dcdc_fac;
+    Jmix[18] -= dcdc_fac;
+    Jmix[28] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[8][0] - 1)*dcdc_fac;
+    J[150] -= dqdci;              /* dwdot[CH3]/d[H2] */
+    J[158] -= dqdci;              /* dwdot[C2H3]/d[H2] */
+    J[168] += dqdci;              /* dwdot[C3H6]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[8][1] - 1)*dcdc_fac;
+    J[185] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[193] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
+    J[203] += dqdci;              /* dwdot[C3H6]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[18];
+    J[360] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[368] -= dqdci;              /* dwdot[C2H3]/d[CH3] */
+    J[378] += dqdci;              /* dwdot[C3H6]/d[CH3] */
+    /* d()/d[CO] */
+    dqdci = (TB[8][2] - 1)*dcdc_fac;
+    J[465] -= dqdci;              /* dwdot[CH3]/d[CO] */
+    J[473] -= dqdci;              /* dwdot[C2H3]/d[CO] */
+    J[483] += dqdci;              /* dwdot[C3H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[8][3] - 1)*dcdc_fac;
+    J[500] -= dqdci;              /* dwdot[CH3]/d[CO2] */
+    J[508] -= dqdci;              /* dwdot[C2H3]/d[CO2] */
+    J[518] += dqdci;              /* dwdot[C3H6]/d[CO2] */
+    /* d()/d[C2H3] */
+    dqdci =  + k_f*sc[10];
+    J[640] -= dqdci;              /* dwdot[CH3]/d[C2H3] */
+    J[648] -= dqdci;              /* dwdot[C2H3]/d[C2H3] */
+    J[658] += dqdci;              /* dwdot[C3H6]/d[C2H3] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[8][4] - 1)*dcdc_fac;
+    J[675] -= dqdci;              /* dwdot[CH3]/d[C2H4] */
+    J[683] -= dqdci;              /* dwdot[C2H3]/d[C2H4] */
+    J[693] += dqdci;              /* dwdot[C3H6]/d[C2H4] */
+    /* d()/d[C3H6] */
+    dqdci =  - k_r;
+    J[990] -= dqdci;              /* dwdot[CH3]/d[C3H6] */
+    J[998] -= dqdci;              /* dwdot[C2H3]/d[C3H6] */
+    J[1008] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
     J[1200] -= dqdT; /* dwdot[CH3]/dT */
     J[1208] -= dqdT; /* dwdot[C2H3]/dT */
     J[1218] += dqdT; /* dwdot[C3H6]/dT */
@@ -18053,11 +18292,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[9][0] - 1)*sc[4] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[13] + (TB[9][3] - 1)*sc[14] + (TB[9][4] - 1)*sc[17] + (TB[9][5] - 1)*sc[19];
+    alpha = (memcmp(TB[9], TB[6], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[9][0] - 1)*sc[4] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[13] + (TB[9][3] - 1)*sc[14] + (TB[9][4] - 1)*sc[17] + (TB[9][5] - 1)*sc[19]);
     /* forward */
     phi_f = sc[10]*sc[13];
-    k_f = prefactor_units[9] * fwd_A[9]
-                * exp(fwd_beta[9] * tc[0] - activation_units[9] * fwd_Ea[9] * invT);
+    k_f = k_f_s[9];
     dlnkfdT = fwd_beta[9] * invT + activation_units[9] * fwd_Ea[9] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[9] * exp(low_beta[9] * tc[0] - activation_units[9] * low_Ea[9] * invT);
@@ -18073,16 +18311,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[9] == 4 ? exp(-troe_Tss[9] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[9]) > 1.e-100 ? -Fcent1/troe_Tsss[9] : 0.)
+      + (fabs(troe_Ts[9]) > 1.e-100 ? -Fcent2/troe_Ts[9] : 0.)
+      + (troe_len[9] == 4 ? Fcent3*troe_Tss[9]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[9]) > 1.e-100 ? -Fcent1/troe_Tsss[9] : 0.)
-      + (fabs(troe_Ts[9]) > 1.e-100 ? -Fcent2/troe_Ts[9] : 0.)
-      + (troe_len[9] == 4 ? Fcent3*troe_Tss[9]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -18090,7 +18328,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[21];
-    Kc = refCinv * exp(g_RT[10] + g_RT[13] - g_RT[21]);
+    Kc = Kc_s[9];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[13]) + (h_RT[21]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18108,89 +18346,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[9][0] - 1)*dcdc_fac;
-        J[150] -= dqdci;              /* dwdot[CH3]/d[H2] */
-        J[153] -= dqdci;              /* dwdot[CO]/d[H2] */
-        J[161] += dqdci;              /* dwdot[CH3CO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[9][1] - 1)*dcdc_fac;
-        J[185] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[188] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[196] += dqdci;              /* dwdot[CH3CO]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[13];
-        J[360] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[363] -= dqdci;              /* dwdot[CO]/d[CH3] */
-        J[371] += dqdci;              /* dwdot[CH3CO]/d[CH3] */
-        /* d()/d[CO] */
-        dqdci = (TB[9][2] - 1)*dcdc_fac + k_f*sc[10];
-        J[465] -= dqdci;              /* dwdot[CH3]/d[CO] */
-        J[468] -= dqdci;              /* dwdot[CO]/d[CO] */
-        J[476] += dqdci;              /* dwdot[CH3CO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[9][3] - 1)*dcdc_fac;
-        J[500] -= dqdci;              /* dwdot[CH3]/d[CO2] */
-        J[503] -= dqdci;              /* dwdot[CO]/d[CO2] */
-        J[511] += dqdci;              /* dwdot[CH3CO]/d[CO2] */
-        /* d()/d[C2H2] */
-        dqdci = (TB[9][4] - 1)*dcdc_fac;
-        J[605] -= dqdci;              /* dwdot[CH3]/d[C2H2] */
-        J[608] -= dqdci;              /* dwdot[CO]/d[C2H2] */
-        J[616] += dqdci;              /* dwdot[CH3CO]/d[C2H2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[9][5] - 1)*dcdc_fac;
-        J[675] -= dqdci;              /* dwdot[CH3]/d[C2H4] */
-        J[678] -= dqdci;              /* dwdot[CO]/d[C2H4] */
-        J[686] += dqdci;              /* dwdot[CH3CO]/d[C2H4] */
-        /* d()/d[CH3CO] */
-        dqdci =  - k_r;
-        J[745] -= dqdci;              /* dwdot[CH3]/d[CH3CO] */
-        J[748] -= dqdci;              /* dwdot[CO]/d[CH3CO] */
-        J[756] += dqdci;              /* dwdot[CH3CO]/d[CH3CO] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[9][0]*dcdc_fac;
-        dqdc[5] = TB[9][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac + k_f*sc[13];
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[9][2]*dcdc_fac + k_f*sc[10];
-        dqdc[14] = TB[9][3]*dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = TB[9][4]*dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = TB[9][5]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac - k_r;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        for (int k=0; k<34; k++) {
-            J[35*k+10] -= dqdc[k];
-            J[35*k+13] -= dqdc[k];
-            J[35*k+21] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[10] -= dcdc_fac;
+    Jmix[13] -= dcdc_fac;
+    Jmix[21] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[9][0] - 1)*dcdc_fac;
+    J[150] -= dqdci;              /* dwdot[CH3]/d[H2] */
+    J[153] -= dqdci;              /* dwdot[CO]/d[H2] */
+    J[161] += dqdci;              /* dwdot[CH3CO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[9][1] - 1)*dcdc_fac;
+    J[185] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[188] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[196] += dqdci;              /* dwdot[CH3CO]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[13];
+    J[360] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[363] -= dqdci;              /* dwdot[CO]/d[CH3] */
+    J[371] += dqdci;              /* dwdot[CH3CO]/d[CH3] */
+    /* d()/d[CO] */
+    dqdci = (TB[9][2] - 1)*dcdc_fac + k_f*sc[10];
+    J[465] -= dqdci;              /* dwdot[CH3]/d[CO] */
+    J[468] -= dqdci;              /* dwdot[CO]/d[CO] */
+    J[476] += dqdci;              /* dwdot[CH3CO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[9][3] - 1)*dcdc_fac;
+    J[500] -= dqdci;              /* dwdot[CH3]/d[CO2] */
+    J[503] -= dqdci;              /* dwdot[CO]/d[CO2] */
+    J[511] += dqdci;              /* dwdot[CH3CO]/d[CO2] */
+    /* d()/d[C2H2] */
+    dqdci = (TB[9][4] - 1)*dcdc_fac;
+    J[605] -= dqdci;              /* dwdot[CH3]/d[C2H2] */
+    J[608] -= dqdci;              /* dwdot[CO]/d[C2H2] */
+    J[616] += dqdci;              /* dwdot[CH3CO]/d[C2H2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[9][5] - 1)*dcdc_fac;
+    J[675] -= dqdci;              /* dwdot[CH3]/d[C2H4] */
+    J[678] -= dqdci;              /* dwdot[CO]/d[C2H4] */
+    J[686] += dqdci;              /* dwdot[CH3CO]/d[C2H4] */
+    /* d()/d[CH3CO] */
+    dqdci =  - k_r;
+    J[745] -= dqdci;              /* dwdot[CH3]/d[CH3CO] */
+    J[748] -= dqdci;              /* dwdot[CO]/d[CH3CO] */
+    J[756] += dqdci;              /* dwdot[CH3CO]/d[CH3CO] */
     J[1200] -= dqdT; /* dwdot[CH3]/dT */
     J[1203] -= dqdT; /* dwdot[CO]/dT */
     J[1211] += dqdT; /* dwdot[CH3CO]/dT */
@@ -18199,11 +18398,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[10][0] - 1)*sc[4] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[13] + (TB[10][3] - 1)*sc[14] + (TB[10][4] - 1)*sc[17] + (TB[10][5] - 1)*sc[19];
+    alpha = (memcmp(TB[10], TB[6], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[10][0] - 1)*sc[4] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[13] + (TB[10][3] - 1)*sc[14] + (TB[10][4] - 1)*sc[17] + (TB[10][5] - 1)*sc[19]);
     /* forward */
     phi_f = sc[0]*sc[21];
-    k_f = prefactor_units[10] * fwd_A[10]
-                * exp(fwd_beta[10] * tc[0] - activation_units[10] * fwd_Ea[10] * invT);
+    k_f = k_f_s[10];
     dlnkfdT = fwd_beta[10] * invT + activation_units[10] * fwd_Ea[10] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[10] * exp(low_beta[10] * tc[0] - activation_units[10] * low_Ea[10] * invT);
@@ -18219,16 +18417,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[10] == 4 ? exp(-troe_Tss[10] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[10]) > 1.e-100 ? -Fcent1/troe_Tsss[10] : 0.)
+      + (fabs(troe_Ts[10]) > 1.e-100 ? -Fcent2/troe_Ts[10] : 0.)
+      + (troe_len[10] == 4 ? Fcent3*troe_Tss[10]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[10]) > 1.e-100 ? -Fcent1/troe_Tsss[10] : 0.)
-      + (fabs(troe_Ts[10]) > 1.e-100 ? -Fcent2/troe_Ts[10] : 0.)
-      + (troe_len[10] == 4 ? Fcent3*troe_Tss[10]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -18236,7 +18434,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[22];
-    Kc = refCinv * exp(g_RT[0] + g_RT[21] - g_RT[22]);
+    Kc = Kc_s[10];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[21]) + (h_RT[22]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18254,94 +18452,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[21];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[21] -= dqdci;               /* dwdot[CH3CO]/d[H] */
-        J[22] += dqdci;               /* dwdot[CH3CHO]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[10][0] - 1)*dcdc_fac;
-        J[140] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[161] -= dqdci;              /* dwdot[CH3CO]/d[H2] */
-        J[162] += dqdci;              /* dwdot[CH3CHO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[10][1] - 1)*dcdc_fac;
-        J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[196] -= dqdci;              /* dwdot[CH3CO]/d[H2O] */
-        J[197] += dqdci;              /* dwdot[CH3CHO]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[10][2] - 1)*dcdc_fac;
-        J[455] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[476] -= dqdci;              /* dwdot[CH3CO]/d[CO] */
-        J[477] += dqdci;              /* dwdot[CH3CHO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[10][3] - 1)*dcdc_fac;
-        J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[511] -= dqdci;              /* dwdot[CH3CO]/d[CO2] */
-        J[512] += dqdci;              /* dwdot[CH3CHO]/d[CO2] */
-        /* d()/d[C2H2] */
-        dqdci = (TB[10][4] - 1)*dcdc_fac;
-        J[595] -= dqdci;              /* dwdot[H]/d[C2H2] */
-        J[616] -= dqdci;              /* dwdot[CH3CO]/d[C2H2] */
-        J[617] += dqdci;              /* dwdot[CH3CHO]/d[C2H2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[10][5] - 1)*dcdc_fac;
-        J[665] -= dqdci;              /* dwdot[H]/d[C2H4] */
-        J[686] -= dqdci;              /* dwdot[CH3CO]/d[C2H4] */
-        J[687] += dqdci;              /* dwdot[CH3CHO]/d[C2H4] */
-        /* d()/d[CH3CO] */
-        dqdci =  + k_f*sc[0];
-        J[735] -= dqdci;              /* dwdot[H]/d[CH3CO] */
-        J[756] -= dqdci;              /* dwdot[CH3CO]/d[CH3CO] */
-        J[757] += dqdci;              /* dwdot[CH3CHO]/d[CH3CO] */
-        /* d()/d[CH3CHO] */
-        dqdci =  - k_r;
-        J[770] -= dqdci;              /* dwdot[H]/d[CH3CHO] */
-        J[791] -= dqdci;              /* dwdot[CH3CO]/d[CH3CHO] */
-        J[792] += dqdci;              /* dwdot[CH3CHO]/d[CH3CHO] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[21];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[10][0]*dcdc_fac;
-        dqdc[5] = TB[10][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[10][2]*dcdc_fac;
-        dqdc[14] = TB[10][3]*dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = TB[10][4]*dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = TB[10][5]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac + k_f*sc[0];
-        dqdc[22] = dcdc_fac - k_r;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        for (int k=0; k<34; k++) {
-            J[35*k+0] -= dqdc[k];
-            J[35*k+21] -= dqdc[k];
-            J[35*k+22] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[21] -= dcdc_fac;
+    Jmix[22] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[21];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[21] -= dqdci;               /* dwdot[CH3CO]/d[H] */
+    J[22] += dqdci;               /* dwdot[CH3CHO]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[10][0] - 1)*dcdc_fac;
+    J[140] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[161] -= dqdci;              /* dwdot[CH3CO]/d[H2] */
+    J[162] += dqdci;              /* dwdot[CH3CHO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[10][1] - 1)*dcdc_fac;
+    J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[196] -= dqdci;              /* dwdot[CH3CO]/d[H2O] */
+    J[197] += dqdci;              /* dwdot[CH3CHO]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[10][2] - 1)*dcdc_fac;
+    J[455] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[476] -= dqdci;              /* dwdot[CH3CO]/d[CO] */
+    J[477] += dqdci;              /* dwdot[CH3CHO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[10][3] - 1)*dcdc_fac;
+    J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[511] -= dqdci;              /* dwdot[CH3CO]/d[CO2] */
+    J[512] += dqdci;              /* dwdot[CH3CHO]/d[CO2] */
+    /* d()/d[C2H2] */
+    dqdci = (TB[10][4] - 1)*dcdc_fac;
+    J[595] -= dqdci;              /* dwdot[H]/d[C2H2] */
+    J[616] -= dqdci;              /* dwdot[CH3CO]/d[C2H2] */
+    J[617] += dqdci;              /* dwdot[CH3CHO]/d[C2H2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[10][5] - 1)*dcdc_fac;
+    J[665] -= dqdci;              /* dwdot[H]/d[C2H4] */
+    J[686] -= dqdci;              /* dwdot[CH3CO]/d[C2H4] */
+    J[687] += dqdci;              /* dwdot[CH3CHO]/d[C2H4] */
+    /* d()/d[CH3CO] */
+    dqdci =  + k_f*sc[0];
+    J[735] -= dqdci;              /* dwdot[H]/d[CH3CO] */
+    J[756] -= dqdci;              /* dwdot[CH3CO]/d[CH3CO] */
+    J[757] += dqdci;              /* dwdot[CH3CHO]/d[CH3CO] */
+    /* d()/d[CH3CHO] */
+    dqdci =  - k_r;
+    J[770] -= dqdci;              /* dwdot[H]/d[CH3CHO] */
+    J[791] -= dqdci;              /* dwdot[CH3CO]/d[CH3CHO] */
+    J[792] += dqdci;              /* dwdot[CH3CHO]/d[CH3CHO] */
     J[1190] -= dqdT; /* dwdot[H]/dT */
     J[1211] -= dqdT; /* dwdot[CH3CO]/dT */
     J[1212] += dqdT; /* dwdot[CH3CHO]/dT */
@@ -18350,11 +18509,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[11][0] - 1)*sc[4] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[13] + (TB[11][3] - 1)*sc[14] + (TB[11][4] - 1)*sc[17] + (TB[11][5] - 1)*sc[19];
+    alpha = (memcmp(TB[11], TB[6], 6*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[11][0] - 1)*sc[4] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[13] + (TB[11][3] - 1)*sc[14] + (TB[11][4] - 1)*sc[17] + (TB[11][5] - 1)*sc[19]);
     /* forward */
     phi_f = sc[10]*sc[11];
-    k_f = prefactor_units[11] * fwd_A[11]
-                * exp(fwd_beta[11] * tc[0] - activation_units[11] * fwd_Ea[11] * invT);
+    k_f = k_f_s[11];
     dlnkfdT = fwd_beta[11] * invT + activation_units[11] * fwd_Ea[11] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[11] * exp(low_beta[11] * tc[0] - activation_units[11] * low_Ea[11] * invT);
@@ -18370,16 +18528,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[11] == 4 ? exp(-troe_Tss[11] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[11]) > 1.e-100 ? -Fcent1/troe_Tsss[11] : 0.)
+      + (fabs(troe_Ts[11]) > 1.e-100 ? -Fcent2/troe_Ts[11] : 0.)
+      + (troe_len[11] == 4 ? Fcent3*troe_Tss[11]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[11]) > 1.e-100 ? -Fcent1/troe_Tsss[11] : 0.)
-      + (fabs(troe_Ts[11]) > 1.e-100 ? -Fcent2/troe_Ts[11] : 0.)
-      + (troe_len[11] == 4 ? Fcent3*troe_Tss[11]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -18387,7 +18545,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[22];
-    Kc = refCinv * exp(g_RT[10] + g_RT[11] - g_RT[22]);
+    Kc = Kc_s[11];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[11]) + (h_RT[22]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18405,94 +18563,55 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[11][0] - 1)*dcdc_fac;
-        J[150] -= dqdci;              /* dwdot[CH3]/d[H2] */
-        J[151] -= dqdci;              /* dwdot[HCO]/d[H2] */
-        J[162] += dqdci;              /* dwdot[CH3CHO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[11][1] - 1)*dcdc_fac;
-        J[185] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[186] -= dqdci;              /* dwdot[HCO]/d[H2O] */
-        J[197] += dqdci;              /* dwdot[CH3CHO]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[11];
-        J[360] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[361] -= dqdci;              /* dwdot[HCO]/d[CH3] */
-        J[372] += dqdci;              /* dwdot[CH3CHO]/d[CH3] */
-        /* d()/d[HCO] */
-        dqdci =  + k_f*sc[10];
-        J[395] -= dqdci;              /* dwdot[CH3]/d[HCO] */
-        J[396] -= dqdci;              /* dwdot[HCO]/d[HCO] */
-        J[407] += dqdci;              /* dwdot[CH3CHO]/d[HCO] */
-        /* d()/d[CO] */
-        dqdci = (TB[11][2] - 1)*dcdc_fac;
-        J[465] -= dqdci;              /* dwdot[CH3]/d[CO] */
-        J[466] -= dqdci;              /* dwdot[HCO]/d[CO] */
-        J[477] += dqdci;              /* dwdot[CH3CHO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[11][3] - 1)*dcdc_fac;
-        J[500] -= dqdci;              /* dwdot[CH3]/d[CO2] */
-        J[501] -= dqdci;              /* dwdot[HCO]/d[CO2] */
-        J[512] += dqdci;              /* dwdot[CH3CHO]/d[CO2] */
-        /* d()/d[C2H2] */
-        dqdci = (TB[11][4] - 1)*dcdc_fac;
-        J[605] -= dqdci;              /* dwdot[CH3]/d[C2H2] */
-        J[606] -= dqdci;              /* dwdot[HCO]/d[C2H2] */
-        J[617] += dqdci;              /* dwdot[CH3CHO]/d[C2H2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[11][5] - 1)*dcdc_fac;
-        J[675] -= dqdci;              /* dwdot[CH3]/d[C2H4] */
-        J[676] -= dqdci;              /* dwdot[HCO]/d[C2H4] */
-        J[687] += dqdci;              /* dwdot[CH3CHO]/d[C2H4] */
-        /* d()/d[CH3CHO] */
-        dqdci =  - k_r;
-        J[780] -= dqdci;              /* dwdot[CH3]/d[CH3CHO] */
-        J[781] -= dqdci;              /* dwdot[HCO]/d[CH3CHO] */
-        J[792] += dqdci;              /* dwdot[CH3CHO]/d[CH3CHO] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[11][0]*dcdc_fac;
-        dqdc[5] = TB[11][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac + k_f*sc[11];
-        dqdc[11] = dcdc_fac + k_f*sc[10];
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[11][2]*dcdc_fac;
-        dqdc[14] = TB[11][3]*dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = TB[11][4]*dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = TB[11][5]*dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac - k_r;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        for (int k=0; k<34; k++) {
-            J[35*k+10] -= dqdc[k];
-            J[35*k+11] -= dqdc[k];
-            J[35*k+22] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[10] -= dcdc_fac;
+    Jmix[11] -= dcdc_fac;
+    Jmix[22] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[11][0] - 1)*dcdc_fac;
+    J[150] -= dqdci;              /* dwdot[CH3]/d[H2] */
+    J[151] -= dqdci;              /* dwdot[HCO]/d[H2] */
+    J[162] += dqdci;              /* dwdot[CH3CHO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[11][1] - 1)*dcdc_fac;
+    J[185] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[186] -= dqdci;              /* dwdot[HCO]/d[H2O] */
+    J[197] += dqdci;              /* dwdot[CH3CHO]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[11];
+    J[360] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[361] -= dqdci;              /* dwdot[HCO]/d[CH3] */
+    J[372] += dqdci;              /* dwdot[CH3CHO]/d[CH3] */
+    /* d()/d[HCO] */
+    dqdci =  + k_f*sc[10];
+    J[395] -= dqdci;              /* dwdot[CH3]/d[HCO] */
+    J[396] -= dqdci;              /* dwdot[HCO]/d[HCO] */
+    J[407] += dqdci;              /* dwdot[CH3CHO]/d[HCO] */
+    /* d()/d[CO] */
+    dqdci = (TB[11][2] - 1)*dcdc_fac;
+    J[465] -= dqdci;              /* dwdot[CH3]/d[CO] */
+    J[466] -= dqdci;              /* dwdot[HCO]/d[CO] */
+    J[477] += dqdci;              /* dwdot[CH3CHO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[11][3] - 1)*dcdc_fac;
+    J[500] -= dqdci;              /* dwdot[CH3]/d[CO2] */
+    J[501] -= dqdci;              /* dwdot[HCO]/d[CO2] */
+    J[512] += dqdci;              /* dwdot[CH3CHO]/d[CO2] */
+    /* d()/d[C2H2] */
+    dqdci = (TB[11][4] - 1)*dcdc_fac;
+    J[605] -= dqdci;              /* dwdot[CH3]/d[C2H2] */
+    J[606] -= dqdci;              /* dwdot[HCO]/d[C2H2] */
+    J[617] += dqdci;              /* dwdot[CH3CHO]/d[C2H2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[11][5] - 1)*dcdc_fac;
+    J[675] -= dqdci;              /* dwdot[CH3]/d[C2H4] */
+    J[676] -= dqdci;              /* dwdot[HCO]/d[C2H4] */
+    J[687] += dqdci;              /* dwdot[CH3CHO]/d[C2H4] */
+    /* d()/d[CH3CHO] */
+    dqdci =  - k_r;
+    J[780] -= dqdci;              /* dwdot[CH3]/d[CH3CHO] */
+    J[781] -= dqdci;              /* dwdot[HCO]/d[CH3CHO] */
+    J[792] += dqdci;              /* dwdot[CH3CHO]/d[CH3CHO] */
     J[1200] -= dqdT; /* dwdot[CH3]/dT */
     J[1201] -= dqdT; /* dwdot[HCO]/dT */
     J[1212] += dqdT; /* dwdot[CH3CHO]/dT */
@@ -18501,11 +18620,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[12][0] - 1)*sc[4] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[13] + (TB[12][3] - 1)*sc[14];
+    alpha = (memcmp(TB[12], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[12][0] - 1)*sc[4] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[13] + (TB[12][3] - 1)*sc[14]);
     /* forward */
     phi_f = sc[0]*sc[26];
-    k_f = prefactor_units[12] * fwd_A[12]
-                * exp(fwd_beta[12] * tc[0] - activation_units[12] * fwd_Ea[12] * invT);
+    k_f = k_f_s[12];
     dlnkfdT = fwd_beta[12] * invT + activation_units[12] * fwd_Ea[12] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[12] * exp(low_beta[12] * tc[0] - activation_units[12] * low_Ea[12] * invT);
@@ -18521,16 +18639,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[12] == 4 ? exp(-troe_Tss[12] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[12]) > 1.e-100 ? -Fcent1/troe_Tsss[12] : 0.)
+      + (fabs(troe_Ts[12]) > 1.e-100 ? -Fcent2/troe_Ts[12] : 0.)
+      + (troe_len[12] == 4 ? Fcent3*troe_Tss[12]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[12]) > 1.e-100 ? -Fcent1/troe_Tsss[12] : 0.)
-      + (fabs(troe_Ts[12]) > 1.e-100 ? -Fcent2/troe_Ts[12] : 0.)
-      + (troe_len[12] == 4 ? Fcent3*troe_Tss[12]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -18538,7 +18656,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[28];
-    Kc = refCinv * exp(g_RT[0] + g_RT[26] - g_RT[28]);
+    Kc = Kc_s[12];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[26]) + (h_RT[28]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18556,84 +18674,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[26];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[26] -= dqdci;               /* dwdot[aC3H5]/d[H] */
-        J[28] += dqdci;               /* dwdot[C3H6]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[12][0] - 1)*dcdc_fac;
-        J[140] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[166] -= dqdci;              /* dwdot[aC3H5]/d[H2] */
-        J[168] += dqdci;              /* dwdot[C3H6]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[12][1] - 1)*dcdc_fac;
-        J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[201] -= dqdci;              /* dwdot[aC3H5]/d[H2O] */
-        J[203] += dqdci;              /* dwdot[C3H6]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[12][2] - 1)*dcdc_fac;
-        J[455] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[481] -= dqdci;              /* dwdot[aC3H5]/d[CO] */
-        J[483] += dqdci;              /* dwdot[C3H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[12][3] - 1)*dcdc_fac;
-        J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[516] -= dqdci;              /* dwdot[aC3H5]/d[CO2] */
-        J[518] += dqdci;              /* dwdot[C3H6]/d[CO2] */
-        /* d()/d[aC3H5] */
-        dqdci =  + k_f*sc[0];
-        J[910] -= dqdci;              /* dwdot[H]/d[aC3H5] */
-        J[936] -= dqdci;              /* dwdot[aC3H5]/d[aC3H5] */
-        J[938] += dqdci;              /* dwdot[C3H6]/d[aC3H5] */
-        /* d()/d[C3H6] */
-        dqdci =  - k_r;
-        J[980] -= dqdci;              /* dwdot[H]/d[C3H6] */
-        J[1006] -= dqdci;             /* dwdot[aC3H5]/d[C3H6] */
-        J[1008] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[26];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[12][0]*dcdc_fac;
-        dqdc[5] = TB[12][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[12][2]*dcdc_fac;
-        dqdc[14] = TB[12][3]*dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac + k_f*sc[0];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac - k_r;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        for (int k=0; k<34; k++) {
-            J[35*k+0] -= dqdc[k];
-            J[35*k+26] -= dqdc[k];
-            J[35*k+28] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[26] -= dcdc_fac;
+    Jmix[28] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[26];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[26] -= dqdci;               /* dwdot[aC3H5]/d[H] */
+    J[28] += dqdci;               /* dwdot[C3H6]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[12][0] - 1)*dcdc_fac;
+    J[140] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[166] -= dqdci;              /* dwdot[aC3H5]/d[H2] */
+    J[168] += dqdci;              /* dwdot[C3H6]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[12][1] - 1)*dcdc_fac;
+    J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[201] -= dqdci;              /* dwdot[aC3H5]/d[H2O] */
+    J[203] += dqdci;              /* dwdot[C3H6]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[12][2] - 1)*dcdc_fac;
+    J[455] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[481] -= dqdci;              /* dwdot[aC3H5]/d[CO] */
+    J[483] += dqdci;              /* dwdot[C3H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[12][3] - 1)*dcdc_fac;
+    J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[516] -= dqdci;              /* dwdot[aC3H5]/d[CO2] */
+    J[518] += dqdci;              /* dwdot[C3H6]/d[CO2] */
+    /* d()/d[aC3H5] */
+    dqdci =  + k_f*sc[0];
+    J[910] -= dqdci;              /* dwdot[H]/d[aC3H5] */
+    J[936] -= dqdci;              /* dwdot[aC3H5]/d[aC3H5] */
+    J[938] += dqdci;              /* dwdot[C3H6]/d[aC3H5] */
+    /* d()/d[C3H6] */
+    dqdci =  - k_r;
+    J[980] -= dqdci;              /* dwdot[H]/d[C3H6] */
+    J[1006] -= dqdci;             /* dwdot[aC3H5]/d[C3H6] */
+    J[1008] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
     J[1190] -= dqdT; /* dwdot[H]/dT */
     J[1216] -= dqdT; /* dwdot[aC3H5]/dT */
     J[1218] += dqdT; /* dwdot[C3H6]/dT */
@@ -18642,11 +18721,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[13][0] - 1)*sc[4] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[13] + (TB[13][3] - 1)*sc[14];
+    alpha = (memcmp(TB[13], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[13][0] - 1)*sc[4] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[13] + (TB[13][3] - 1)*sc[14]);
     /* forward */
     phi_f = sc[0]*sc[28];
-    k_f = prefactor_units[13] * fwd_A[13]
-                * exp(fwd_beta[13] * tc[0] - activation_units[13] * fwd_Ea[13] * invT);
+    k_f = k_f_s[13];
     dlnkfdT = fwd_beta[13] * invT + activation_units[13] * fwd_Ea[13] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[13] * exp(low_beta[13] * tc[0] - activation_units[13] * low_Ea[13] * invT);
@@ -18662,16 +18740,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[13] == 4 ? exp(-troe_Tss[13] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[13]) > 1.e-100 ? -Fcent1/troe_Tsss[13] : 0.)
+      + (fabs(troe_Ts[13]) > 1.e-100 ? -Fcent2/troe_Ts[13] : 0.)
+      + (troe_len[13] == 4 ? Fcent3*troe_Tss[13]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[13]) > 1.e-100 ? -Fcent1/troe_Tsss[13] : 0.)
-      + (fabs(troe_Ts[13]) > 1.e-100 ? -Fcent2/troe_Ts[13] : 0.)
-      + (troe_len[13] == 4 ? Fcent3*troe_Tss[13]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -18679,7 +18757,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[29];
-    Kc = refCinv * exp(g_RT[0] + g_RT[28] - g_RT[29]);
+    Kc = Kc_s[13];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[28]) + (h_RT[29]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18697,84 +18775,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[28];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[28] -= dqdci;               /* dwdot[C3H6]/d[H] */
-        J[29] += dqdci;               /* dwdot[nC3H7]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[13][0] - 1)*dcdc_fac;
-        J[140] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[168] -= dqdci;              /* dwdot[C3H6]/d[H2] */
-        J[169] += dqdci;              /* dwdot[nC3H7]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[13][1] - 1)*dcdc_fac;
-        J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[203] -= dqdci;              /* dwdot[C3H6]/d[H2O] */
-        J[204] += dqdci;              /* dwdot[nC3H7]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[13][2] - 1)*dcdc_fac;
-        J[455] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[483] -= dqdci;              /* dwdot[C3H6]/d[CO] */
-        J[484] += dqdci;              /* dwdot[nC3H7]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[13][3] - 1)*dcdc_fac;
-        J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[518] -= dqdci;              /* dwdot[C3H6]/d[CO2] */
-        J[519] += dqdci;              /* dwdot[nC3H7]/d[CO2] */
-        /* d()/d[C3H6] */
-        dqdci =  + k_f*sc[0];
-        J[980] -= dqdci;              /* dwdot[H]/d[C3H6] */
-        J[1008] -= dqdci;             /* dwdot[C3H6]/d[C3H6] */
-        J[1009] += dqdci;             /* dwdot[nC3H7]/d[C3H6] */
-        /* d()/d[nC3H7] */
-        dqdci =  - k_r;
-        J[1015] -= dqdci;             /* dwdot[H]/d[nC3H7] */
-        J[1043] -= dqdci;             /* dwdot[C3H6]/d[nC3H7] */
-        J[1044] += dqdci;             /* dwdot[nC3H7]/d[nC3H7] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[28];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[13][0]*dcdc_fac;
-        dqdc[5] = TB[13][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[13][2]*dcdc_fac;
-        dqdc[14] = TB[13][3]*dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac + k_f*sc[0];
-        dqdc[29] = dcdc_fac - k_r;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        for (int k=0; k<34; k++) {
-            J[35*k+0] -= dqdc[k];
-            J[35*k+28] -= dqdc[k];
-            J[35*k+29] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[28] -= dcdc_fac;
+    Jmix[29] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[28];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[28] -= dqdci;               /* dwdot[C3H6]/d[H] */
+    J[29] += dqdci;               /* dwdot[nC3H7]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[13][0] - 1)*dcdc_fac;
+    J[140] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[168] -= dqdci;              /* dwdot[C3H6]/d[H2] */
+    J[169] += dqdci;              /* dwdot[nC3H7]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[13][1] - 1)*dcdc_fac;
+    J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[203] -= dqdci;              /* dwdot[C3H6]/d[H2O] */
+    J[204] += dqdci;              /* dwdot[nC3H7]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[13][2] - 1)*dcdc_fac;
+    J[455] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[483] -= dqdci;              /* dwdot[C3H6]/d[CO] */
+    J[484] += dqdci;              /* dwdot[nC3H7]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[13][3] - 1)*dcdc_fac;
+    J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[518] -= dqdci;              /* dwdot[C3H6]/d[CO2] */
+    J[519] += dqdci;              /* dwdot[nC3H7]/d[CO2] */
+    /* d()/d[C3H6] */
+    dqdci =  + k_f*sc[0];
+    J[980] -= dqdci;              /* dwdot[H]/d[C3H6] */
+    J[1008] -= dqdci;             /* dwdot[C3H6]/d[C3H6] */
+    J[1009] += dqdci;             /* dwdot[nC3H7]/d[C3H6] */
+    /* d()/d[nC3H7] */
+    dqdci =  - k_r;
+    J[1015] -= dqdci;             /* dwdot[H]/d[nC3H7] */
+    J[1043] -= dqdci;             /* dwdot[C3H6]/d[nC3H7] */
+    J[1044] += dqdci;             /* dwdot[nC3H7]/d[nC3H7] */
     J[1190] -= dqdT; /* dwdot[H]/dT */
     J[1218] -= dqdT; /* dwdot[C3H6]/dT */
     J[1219] += dqdT; /* dwdot[nC3H7]/dT */
@@ -18783,11 +18822,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[14][0] - 1)*sc[4] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[13] + (TB[14][3] - 1)*sc[14];
+    alpha = (memcmp(TB[14], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[14][0] - 1)*sc[4] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[13] + (TB[14][3] - 1)*sc[14]);
     /* forward */
     phi_f = sc[0]*sc[28];
-    k_f = prefactor_units[14] * fwd_A[14]
-                * exp(fwd_beta[14] * tc[0] - activation_units[14] * fwd_Ea[14] * invT);
+    k_f = k_f_s[14];
     dlnkfdT = fwd_beta[14] * invT + activation_units[14] * fwd_Ea[14] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[14] * exp(low_beta[14] * tc[0] - activation_units[14] * low_Ea[14] * invT);
@@ -18803,16 +18841,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[14] == 4 ? exp(-troe_Tss[14] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[14]) > 1.e-100 ? -Fcent1/troe_Tsss[14] : 0.)
+      + (fabs(troe_Ts[14]) > 1.e-100 ? -Fcent2/troe_Ts[14] : 0.)
+      + (troe_len[14] == 4 ? Fcent3*troe_Tss[14]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[14]) > 1.e-100 ? -Fcent1/troe_Tsss[14] : 0.)
-      + (fabs(troe_Ts[14]) > 1.e-100 ? -Fcent2/troe_Ts[14] : 0.)
-      + (troe_len[14] == 4 ? Fcent3*troe_Tss[14]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -18820,7 +18858,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[30];
-    Kc = refCinv * exp(g_RT[0] + g_RT[28] - g_RT[30]);
+    Kc = Kc_s[14];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[28]) + (h_RT[30]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18838,84 +18876,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[28];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[28] -= dqdci;               /* dwdot[C3H6]/d[H] */
-        J[30] += dqdci;               /* dwdot[iC3H7]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[14][0] - 1)*dcdc_fac;
-        J[140] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[168] -= dqdci;              /* dwdot[C3H6]/d[H2] */
-        J[170] += dqdci;              /* dwdot[iC3H7]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[14][1] - 1)*dcdc_fac;
-        J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[203] -= dqdci;              /* dwdot[C3H6]/d[H2O] */
-        J[205] += dqdci;              /* dwdot[iC3H7]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[14][2] - 1)*dcdc_fac;
-        J[455] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[483] -= dqdci;              /* dwdot[C3H6]/d[CO] */
-        J[485] += dqdci;              /* dwdot[iC3H7]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[14][3] - 1)*dcdc_fac;
-        J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[518] -= dqdci;              /* dwdot[C3H6]/d[CO2] */
-        J[520] += dqdci;              /* dwdot[iC3H7]/d[CO2] */
-        /* d()/d[C3H6] */
-        dqdci =  + k_f*sc[0];
-        J[980] -= dqdci;              /* dwdot[H]/d[C3H6] */
-        J[1008] -= dqdci;             /* dwdot[C3H6]/d[C3H6] */
-        J[1010] += dqdci;             /* dwdot[iC3H7]/d[C3H6] */
-        /* d()/d[iC3H7] */
-        dqdci =  - k_r;
-        J[1050] -= dqdci;             /* dwdot[H]/d[iC3H7] */
-        J[1078] -= dqdci;             /* dwdot[C3H6]/d[iC3H7] */
-        J[1080] += dqdci;             /* dwdot[iC3H7]/d[iC3H7] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[28];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[14][0]*dcdc_fac;
-        dqdc[5] = TB[14][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[14][2]*dcdc_fac;
-        dqdc[14] = TB[14][3]*dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac + k_f*sc[0];
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac - k_r;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        for (int k=0; k<34; k++) {
-            J[35*k+0] -= dqdc[k];
-            J[35*k+28] -= dqdc[k];
-            J[35*k+30] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[28] -= dcdc_fac;
+    Jmix[30] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[28];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[28] -= dqdci;               /* dwdot[C3H6]/d[H] */
+    J[30] += dqdci;               /* dwdot[iC3H7]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[14][0] - 1)*dcdc_fac;
+    J[140] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[168] -= dqdci;              /* dwdot[C3H6]/d[H2] */
+    J[170] += dqdci;              /* dwdot[iC3H7]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[14][1] - 1)*dcdc_fac;
+    J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[203] -= dqdci;              /* dwdot[C3H6]/d[H2O] */
+    J[205] += dqdci;              /* dwdot[iC3H7]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[14][2] - 1)*dcdc_fac;
+    J[455] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[483] -= dqdci;              /* dwdot[C3H6]/d[CO] */
+    J[485] += dqdci;              /* dwdot[iC3H7]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[14][3] - 1)*dcdc_fac;
+    J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[518] -= dqdci;              /* dwdot[C3H6]/d[CO2] */
+    J[520] += dqdci;              /* dwdot[iC3H7]/d[CO2] */
+    /* d()/d[C3H6] */
+    dqdci =  + k_f*sc[0];
+    J[980] -= dqdci;              /* dwdot[H]/d[C3H6] */
+    J[1008] -= dqdci;             /* dwdot[C3H6]/d[C3H6] */
+    J[1010] += dqdci;             /* dwdot[iC3H7]/d[C3H6] */
+    /* d()/d[iC3H7] */
+    dqdci =  - k_r;
+    J[1050] -= dqdci;             /* dwdot[H]/d[iC3H7] */
+    J[1078] -= dqdci;             /* dwdot[C3H6]/d[iC3H7] */
+    J[1080] += dqdci;             /* dwdot[iC3H7]/d[iC3H7] */
     J[1190] -= dqdT; /* dwdot[H]/dT */
     J[1218] -= dqdT; /* dwdot[C3H6]/dT */
     J[1220] += dqdT; /* dwdot[iC3H7]/dT */
@@ -18924,11 +18923,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[15][0] - 1)*sc[4] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[13] + (TB[15][3] - 1)*sc[14];
+    alpha = (memcmp(TB[15], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[15][0] - 1)*sc[4] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[13] + (TB[15][3] - 1)*sc[14]);
     /* forward */
     phi_f = sc[0]*sc[30];
-    k_f = prefactor_units[15] * fwd_A[15]
-                * exp(fwd_beta[15] * tc[0] - activation_units[15] * fwd_Ea[15] * invT);
+    k_f = k_f_s[15];
     dlnkfdT = fwd_beta[15] * invT + activation_units[15] * fwd_Ea[15] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[15] * exp(low_beta[15] * tc[0] - activation_units[15] * low_Ea[15] * invT);
@@ -18944,16 +18942,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[15] == 4 ? exp(-troe_Tss[15] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[15]) > 1.e-100 ? -Fcent1/troe_Tsss[15] : 0.)
+      + (fabs(troe_Ts[15]) > 1.e-100 ? -Fcent2/troe_Ts[15] : 0.)
+      + (troe_len[15] == 4 ? Fcent3*troe_Tss[15]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[15]) > 1.e-100 ? -Fcent1/troe_Tsss[15] : 0.)
-      + (fabs(troe_Ts[15]) > 1.e-100 ? -Fcent2/troe_Ts[15] : 0.)
-      + (troe_len[15] == 4 ? Fcent3*troe_Tss[15]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -18961,7 +18959,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[31];
-    Kc = refCinv * exp(g_RT[0] + g_RT[30] - g_RT[31]);
+    Kc = Kc_s[15];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[30]) + (h_RT[31]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -18979,84 +18977,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[30];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[30] -= dqdci;               /* dwdot[iC3H7]/d[H] */
-        J[31] += dqdci;               /* dwdot[C3H8]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[15][0] - 1)*dcdc_fac;
-        J[140] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[170] -= dqdci;              /* dwdot[iC3H7]/d[H2] */
-        J[171] += dqdci;              /* dwdot[C3H8]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[15][1] - 1)*dcdc_fac;
-        J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[205] -= dqdci;              /* dwdot[iC3H7]/d[H2O] */
-        J[206] += dqdci;              /* dwdot[C3H8]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[15][2] - 1)*dcdc_fac;
-        J[455] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[485] -= dqdci;              /* dwdot[iC3H7]/d[CO] */
-        J[486] += dqdci;              /* dwdot[C3H8]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[15][3] - 1)*dcdc_fac;
-        J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[520] -= dqdci;              /* dwdot[iC3H7]/d[CO2] */
-        J[521] += dqdci;              /* dwdot[C3H8]/d[CO2] */
-        /* d()/d[iC3H7] */
-        dqdci =  + k_f*sc[0];
-        J[1050] -= dqdci;             /* dwdot[H]/d[iC3H7] */
-        J[1080] -= dqdci;             /* dwdot[iC3H7]/d[iC3H7] */
-        J[1081] += dqdci;             /* dwdot[C3H8]/d[iC3H7] */
-        /* d()/d[C3H8] */
-        dqdci =  - k_r;
-        J[1085] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[1115] -= dqdci;             /* dwdot[iC3H7]/d[C3H8] */
-        J[1116] += dqdci;             /* dwdot[C3H8]/d[C3H8] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[30];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[15][0]*dcdc_fac;
-        dqdc[5] = TB[15][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[15][2]*dcdc_fac;
-        dqdc[14] = TB[15][3]*dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac + k_f*sc[0];
-        dqdc[31] = dcdc_fac - k_r;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        for (int k=0; k<34; k++) {
-            J[35*k+0] -= dqdc[k];
-            J[35*k+30] -= dqdc[k];
-            J[35*k+31] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[30] -= dcdc_fac;
+    Jmix[31] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[30];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[30] -= dqdci;               /* dwdot[iC3H7]/d[H] */
+    J[31] += dqdci;               /* dwdot[C3H8]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[15][0] - 1)*dcdc_fac;
+    J[140] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[170] -= dqdci;              /* dwdot[iC3H7]/d[H2] */
+    J[171] += dqdci;              /* dwdot[C3H8]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[15][1] - 1)*dcdc_fac;
+    J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[205] -= dqdci;              /* dwdot[iC3H7]/d[H2O] */
+    J[206] += dqdci;              /* dwdot[C3H8]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[15][2] - 1)*dcdc_fac;
+    J[455] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[485] -= dqdci;              /* dwdot[iC3H7]/d[CO] */
+    J[486] += dqdci;              /* dwdot[C3H8]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[15][3] - 1)*dcdc_fac;
+    J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[520] -= dqdci;              /* dwdot[iC3H7]/d[CO2] */
+    J[521] += dqdci;              /* dwdot[C3H8]/d[CO2] */
+    /* d()/d[iC3H7] */
+    dqdci =  + k_f*sc[0];
+    J[1050] -= dqdci;             /* dwdot[H]/d[iC3H7] */
+    J[1080] -= dqdci;             /* dwdot[iC3H7]/d[iC3H7] */
+    J[1081] += dqdci;             /* dwdot[C3H8]/d[iC3H7] */
+    /* d()/d[C3H8] */
+    dqdci =  - k_r;
+    J[1085] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[1115] -= dqdci;             /* dwdot[iC3H7]/d[C3H8] */
+    J[1116] += dqdci;             /* dwdot[C3H8]/d[C3H8] */
     J[1190] -= dqdT; /* dwdot[H]/dT */
     J[1220] -= dqdT; /* dwdot[iC3H7]/dT */
     J[1221] += dqdT; /* dwdot[C3H8]/dT */
@@ -19065,11 +19024,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[16][0] - 1)*sc[4] + (TB[16][1] - 1)*sc[5] + (TB[16][2] - 1)*sc[13] + (TB[16][3] - 1)*sc[14];
+    alpha = (memcmp(TB[16], TB[1], 4*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[16][0] - 1)*sc[4] + (TB[16][1] - 1)*sc[5] + (TB[16][2] - 1)*sc[13] + (TB[16][3] - 1)*sc[14]);
     /* forward */
     phi_f = sc[0]*sc[29];
-    k_f = prefactor_units[16] * fwd_A[16]
-                * exp(fwd_beta[16] * tc[0] - activation_units[16] * fwd_Ea[16] * invT);
+    k_f = k_f_s[16];
     dlnkfdT = fwd_beta[16] * invT + activation_units[16] * fwd_Ea[16] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[16] * exp(low_beta[16] * tc[0] - activation_units[16] * low_Ea[16] * invT);
@@ -19085,16 +19043,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[16] == 4 ? exp(-troe_Tss[16] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[16]) > 1.e-100 ? -Fcent1/troe_Tsss[16] : 0.)
+      + (fabs(troe_Ts[16]) > 1.e-100 ? -Fcent2/troe_Ts[16] : 0.)
+      + (troe_len[16] == 4 ? Fcent3*troe_Tss[16]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[16]) > 1.e-100 ? -Fcent1/troe_Tsss[16] : 0.)
-      + (fabs(troe_Ts[16]) > 1.e-100 ? -Fcent2/troe_Ts[16] : 0.)
-      + (troe_len[16] == 4 ? Fcent3*troe_Tss[16]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -19102,7 +19060,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[31];
-    Kc = refCinv * exp(g_RT[0] + g_RT[29] - g_RT[31]);
+    Kc = Kc_s[16];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[29]) + (h_RT[31]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19120,84 +19078,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[29];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[29] -= dqdci;               /* dwdot[nC3H7]/d[H] */
-        J[31] += dqdci;               /* dwdot[C3H8]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[16][0] - 1)*dcdc_fac;
-        J[140] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[169] -= dqdci;              /* dwdot[nC3H7]/d[H2] */
-        J[171] += dqdci;              /* dwdot[C3H8]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[16][1] - 1)*dcdc_fac;
-        J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[204] -= dqdci;              /* dwdot[nC3H7]/d[H2O] */
-        J[206] += dqdci;              /* dwdot[C3H8]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[16][2] - 1)*dcdc_fac;
-        J[455] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[484] -= dqdci;              /* dwdot[nC3H7]/d[CO] */
-        J[486] += dqdci;              /* dwdot[C3H8]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[16][3] - 1)*dcdc_fac;
-        J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[519] -= dqdci;              /* dwdot[nC3H7]/d[CO2] */
-        J[521] += dqdci;              /* dwdot[C3H8]/d[CO2] */
-        /* d()/d[nC3H7] */
-        dqdci =  + k_f*sc[0];
-        J[1015] -= dqdci;             /* dwdot[H]/d[nC3H7] */
-        J[1044] -= dqdci;             /* dwdot[nC3H7]/d[nC3H7] */
-        J[1046] += dqdci;             /* dwdot[C3H8]/d[nC3H7] */
-        /* d()/d[C3H8] */
-        dqdci =  - k_r;
-        J[1085] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[1114] -= dqdci;             /* dwdot[nC3H7]/d[C3H8] */
-        J[1116] += dqdci;             /* dwdot[C3H8]/d[C3H8] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[29];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[16][0]*dcdc_fac;
-        dqdc[5] = TB[16][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[16][2]*dcdc_fac;
-        dqdc[14] = TB[16][3]*dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac + k_f*sc[0];
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac - k_r;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        for (int k=0; k<34; k++) {
-            J[35*k+0] -= dqdc[k];
-            J[35*k+29] -= dqdc[k];
-            J[35*k+31] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[29] -= dcdc_fac;
+    Jmix[31] += dcdc_fac;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[29];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[29] -= dqdci;               /* dwdot[nC3H7]/d[H] */
+    J[31] += dqdci;               /* dwdot[C3H8]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[16][0] - 1)*dcdc_fac;
+    J[140] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[169] -= dqdci;              /* dwdot[nC3H7]/d[H2] */
+    J[171] += dqdci;              /* dwdot[C3H8]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[16][1] - 1)*dcdc_fac;
+    J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[204] -= dqdci;              /* dwdot[nC3H7]/d[H2O] */
+    J[206] += dqdci;              /* dwdot[C3H8]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[16][2] - 1)*dcdc_fac;
+    J[455] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[484] -= dqdci;              /* dwdot[nC3H7]/d[CO] */
+    J[486] += dqdci;              /* dwdot[C3H8]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[16][3] - 1)*dcdc_fac;
+    J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[519] -= dqdci;              /* dwdot[nC3H7]/d[CO2] */
+    J[521] += dqdci;              /* dwdot[C3H8]/d[CO2] */
+    /* d()/d[nC3H7] */
+    dqdci =  + k_f*sc[0];
+    J[1015] -= dqdci;             /* dwdot[H]/d[nC3H7] */
+    J[1044] -= dqdci;             /* dwdot[nC3H7]/d[nC3H7] */
+    J[1046] += dqdci;             /* dwdot[C3H8]/d[nC3H7] */
+    /* d()/d[C3H8] */
+    dqdci =  - k_r;
+    J[1085] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[1114] -= dqdci;             /* dwdot[nC3H7]/d[C3H8] */
+    J[1116] += dqdci;             /* dwdot[C3H8]/d[C3H8] */
     J[1190] -= dqdT; /* dwdot[H]/dT */
     J[1219] -= dqdT; /* dwdot[nC3H7]/dT */
     J[1221] += dqdT; /* dwdot[C3H8]/dT */
@@ -19206,11 +19125,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[17][0] - 1)*sc[4] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[13] + (TB[17][3] - 1)*sc[14];
+    alpha = alpha_eff2;
     /* forward */
     phi_f = sc[1]*sc[13];
-    k_f = prefactor_units[17] * fwd_A[17]
-                * exp(fwd_beta[17] * tc[0] - activation_units[17] * fwd_Ea[17] * invT);
+    k_f = k_f_s[17];
     dlnkfdT = fwd_beta[17] * invT + activation_units[17] * fwd_Ea[17] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[17] * exp(low_beta[17] * tc[0] - activation_units[17] * low_Ea[17] * invT);
@@ -19225,7 +19143,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = 0.0;
     /* reverse */
     phi_r = sc[14];
-    Kc = refCinv * exp(g_RT[1] + g_RT[13] - g_RT[14]);
+    Kc = Kc_s[17];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[13]) + (h_RT[14]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19243,74 +19161,35 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[13];
-        J[36] -= dqdci;               /* dwdot[O]/d[O] */
-        J[48] -= dqdci;               /* dwdot[CO]/d[O] */
-        J[49] += dqdci;               /* dwdot[CO2]/d[O] */
-        /* d()/d[H2] */
-        dqdci = (TB[17][0] - 1)*dcdc_fac;
-        J[141] -= dqdci;              /* dwdot[O]/d[H2] */
-        J[153] -= dqdci;              /* dwdot[CO]/d[H2] */
-        J[154] += dqdci;              /* dwdot[CO2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[17][1] - 1)*dcdc_fac;
-        J[176] -= dqdci;              /* dwdot[O]/d[H2O] */
-        J[188] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[189] += dqdci;              /* dwdot[CO2]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[17][2] - 1)*dcdc_fac + k_f*sc[1];
-        J[456] -= dqdci;              /* dwdot[O]/d[CO] */
-        J[468] -= dqdci;              /* dwdot[CO]/d[CO] */
-        J[469] += dqdci;              /* dwdot[CO2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[17][3] - 1)*dcdc_fac - k_r;
-        J[491] -= dqdci;              /* dwdot[O]/d[CO2] */
-        J[503] -= dqdci;              /* dwdot[CO]/d[CO2] */
-        J[504] += dqdci;              /* dwdot[CO2]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[13];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[17][0]*dcdc_fac;
-        dqdc[5] = TB[17][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[17][2]*dcdc_fac + k_f*sc[1];
-        dqdc[14] = TB[17][3]*dcdc_fac - k_r;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        for (int k=0; k<34; k++) {
-            J[35*k+1] -= dqdc[k];
-            J[35*k+13] -= dqdc[k];
-            J[35*k+14] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[13] -= dcdc_fac;
+    Jmix[14] += dcdc_fac;
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[13];
+    J[36] -= dqdci;               /* dwdot[O]/d[O] */
+    J[48] -= dqdci;               /* dwdot[CO]/d[O] */
+    J[49] += dqdci;               /* dwdot[CO2]/d[O] */
+    /* d()/d[H2] */
+    dqdci = (TB[17][0] - 1)*dcdc_fac;
+    J[141] -= dqdci;              /* dwdot[O]/d[H2] */
+    J[153] -= dqdci;              /* dwdot[CO]/d[H2] */
+    J[154] += dqdci;              /* dwdot[CO2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[17][1] - 1)*dcdc_fac;
+    J[176] -= dqdci;              /* dwdot[O]/d[H2O] */
+    J[188] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[189] += dqdci;              /* dwdot[CO2]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[17][2] - 1)*dcdc_fac + k_f*sc[1];
+    J[456] -= dqdci;              /* dwdot[O]/d[CO] */
+    J[468] -= dqdci;              /* dwdot[CO]/d[CO] */
+    J[469] += dqdci;              /* dwdot[CO2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[17][3] - 1)*dcdc_fac - k_r;
+    J[491] -= dqdci;              /* dwdot[O]/d[CO2] */
+    J[503] -= dqdci;              /* dwdot[CO]/d[CO2] */
+    J[504] += dqdci;              /* dwdot[CO2]/d[CO2] */
     J[1191] -= dqdT; /* dwdot[O]/dT */
     J[1203] -= dqdT; /* dwdot[CO]/dT */
     J[1204] += dqdT; /* dwdot[CO2]/dT */
@@ -19321,12 +19200,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[18][0] - 1)*sc[4] + (TB[18][1] - 1)*sc[5] + (TB[18][2] - 1)*sc[14];
     /* forward */
     phi_f = sc[0]*sc[0];
-    k_f = prefactor_units[18] * fwd_A[18]
-                * exp(fwd_beta[18] * tc[0] - activation_units[18] * fwd_Ea[18] * invT);
+    k_f = k_f_s[18];
     dlnkfdT = fwd_beta[18] * invT + activation_units[18] * fwd_Ea[18] * invT2;
     /* reverse */
     phi_r = sc[4];
-    Kc = refCinv * exp(2*g_RT[0] - g_RT[4]);
+    Kc = Kc_s[18];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[0]) + (h_RT[4]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19340,64 +19218,25 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*2*sc[0];
-        J[0] += -2 * dqdci;           /* dwdot[H]/d[H] */
-        J[4] += dqdci;                /* dwdot[H2]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[18][0] - 1)*q_nocor - k_r;
-        J[140] += -2 * dqdci;         /* dwdot[H]/d[H2] */
-        J[144] += dqdci;              /* dwdot[H2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[18][1] - 1)*q_nocor;
-        J[175] += -2 * dqdci;         /* dwdot[H]/d[H2O] */
-        J[179] += dqdci;              /* dwdot[H2]/d[H2O] */
-        /* d()/d[CO2] */
-        dqdci = (TB[18][2] - 1)*q_nocor;
-        J[490] += -2 * dqdci;         /* dwdot[H]/d[CO2] */
-        J[494] += dqdci;              /* dwdot[H2]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*2*sc[0];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[18][0] - k_r;
-        dqdc[5] = TB[18][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = TB[18][2];
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        for (int k=0; k<34; k++) {
-            J[35*k+0] += -2 * dqdc[k];
-            J[35*k+4] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += -2 * q_nocor;
+    Jmix[4] += q_nocor;
+    /* d()/d[H] */
+    dqdci =  + k_f*2*sc[0];
+    J[0] += -2 * dqdci;           /* dwdot[H]/d[H] */
+    J[4] += dqdci;                /* dwdot[H2]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[18][0] - 1)*q_nocor - k_r;
+    J[140] += -2 * dqdci;         /* dwdot[H]/d[H2] */
+    J[144] += dqdci;              /* dwdot[H2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[18][1] - 1)*q_nocor;
+    J[175] += -2 * dqdci;         /* dwdot[H]/d[H2O] */
+    J[179] += dqdci;              /* dwdot[H2]/d[H2O] */
+    /* d()/d[CO2] */
+    dqdci = (TB[18][2] - 1)*q_nocor;
+    J[490] += -2 * dqdci;         /* dwdot[H]/d[CO2] */
+    J[494] += dqdci;              /* dwdot[H2]/d[CO2] */
     J[1190] += -2 * dqdT; /* dwdot[H]/dT */
     J[1194] += dqdT; /* dwdot[H2]/dT */
 
@@ -19407,12 +19246,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[19][0] - 1)*sc[4] + (TB[19][1] - 1)*sc[5] + (TB[19][2] - 1)*sc[13] + (TB[19][3] - 1)*sc[14];
     /* forward */
     phi_f = sc[0]*sc[2];
-    k_f = prefactor_units[19] * fwd_A[19]
-                * exp(fwd_beta[19] * tc[0] - activation_units[19] * fwd_Ea[19] * invT);
+    k_f = k_f_s[19];
     dlnkfdT = fwd_beta[19] * invT + activation_units[19] * fwd_Ea[19] * invT2;
     /* reverse */
     phi_r = sc[5];
-    Kc = refCinv * exp(g_RT[0] + g_RT[2] - g_RT[5]);
+    Kc = Kc_s[19];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[2]) + (h_RT[5]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19427,79 +19265,40 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[2];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[2] -= dqdci;                /* dwdot[OH]/d[H] */
-        J[5] += dqdci;                /* dwdot[H2O]/d[H] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*sc[0];
-        J[70] -= dqdci;               /* dwdot[H]/d[OH] */
-        J[72] -= dqdci;               /* dwdot[OH]/d[OH] */
-        J[75] += dqdci;               /* dwdot[H2O]/d[OH] */
-        /* d()/d[H2] */
-        dqdci = (TB[19][0] - 1)*q_nocor;
-        J[140] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[142] -= dqdci;              /* dwdot[OH]/d[H2] */
-        J[145] += dqdci;              /* dwdot[H2O]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[19][1] - 1)*q_nocor - k_r;
-        J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[177] -= dqdci;              /* dwdot[OH]/d[H2O] */
-        J[180] += dqdci;              /* dwdot[H2O]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[19][2] - 1)*q_nocor;
-        J[455] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[457] -= dqdci;              /* dwdot[OH]/d[CO] */
-        J[460] += dqdci;              /* dwdot[H2O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[19][3] - 1)*q_nocor;
-        J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[492] -= dqdci;              /* dwdot[OH]/d[CO2] */
-        J[495] += dqdci;              /* dwdot[H2O]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[2];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*sc[0];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[19][0];
-        dqdc[5] = TB[19][1] - k_r;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[19][2];
-        dqdc[14] = TB[19][3];
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        for (int k=0; k<34; k++) {
-            J[35*k+0] -= dqdc[k];
-            J[35*k+2] -= dqdc[k];
-            J[35*k+5] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= q_nocor;
+    Jmix[2] -= q_nocor;
+    Jmix[5] += q_nocor;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[2];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[2] -= dqdci;                /* dwdot[OH]/d[H] */
+    J[5] += dqdci;                /* dwdot[H2O]/d[H] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*sc[0];
+    J[70] -= dqdci;               /* dwdot[H]/d[OH] */
+    J[72] -= dqdci;               /* dwdot[OH]/d[OH] */
+    J[75] += dqdci;               /* dwdot[H2O]/d[OH] */
+    /* d()/d[H2] */
+    dqdci = (TB[19][0] - 1)*q_nocor;
+    J[140] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[142] -= dqdci;              /* dwdot[OH]/d[H2] */
+    J[145] += dqdci;              /* dwdot[H2O]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[19][1] - 1)*q_nocor - k_r;
+    J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[177] -= dqdci;              /* dwdot[OH]/d[H2O] */
+    J[180] += dqdci;              /* dwdot[H2O]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[19][2] - 1)*q_nocor;
+    J[455] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[457] -= dqdci;              /* dwdot[OH]/d[CO] */
+    J[460] += dqdci;              /* dwdot[H2O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[19][3] - 1)*q_nocor;
+    J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[492] -= dqdci;              /* dwdot[OH]/d[CO2] */
+    J[495] += dqdci;              /* dwdot[H2O]/d[CO2] */
     J[1190] -= dqdT; /* dwdot[H]/dT */
     J[1192] -= dqdT; /* dwdot[OH]/dT */
     J[1195] += dqdT; /* dwdot[H2O]/dT */
@@ -19507,15 +19306,14 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*reaction 21: O + H + M <=> OH + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[20][0] - 1)*sc[4] + (TB[20][1] - 1)*sc[5] + (TB[20][2] - 1)*sc[13] + (TB[20][3] - 1)*sc[14];
+    alpha = (memcmp(TB[20], TB[17], 4*sizeof(double)) == 0 ? alpha_eff2 : mixture + (TB[20][0] - 1)*sc[4] + (TB[20][1] - 1)*sc[5] + (TB[20][2] - 1)*sc[13] + (TB[20][3] - 1)*sc[14]);
     /* forward */
     phi_f = sc[0]*sc[1];
-    k_f = prefactor_units[20] * fwd_A[20]
-                * exp(fwd_beta[20] * tc[0] - activation_units[20] * fwd_Ea[20] * invT);
+    k_f = k_f_s[20];
     dlnkfdT = fwd_beta[20] * invT + activation_units[20] * fwd_Ea[20] * invT2;
     /* reverse */
     phi_r = sc[2];
-    Kc = refCinv * exp(g_RT[0] + g_RT[1] - g_RT[2]);
+    Kc = Kc_s[20];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[1]) + (h_RT[2]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19530,84 +19328,45 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[1];
-        J[0] -= dqdci;                /* dwdot[H]/d[H] */
-        J[1] -= dqdci;                /* dwdot[O]/d[H] */
-        J[2] += dqdci;                /* dwdot[OH]/d[H] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[0];
-        J[35] -= dqdci;               /* dwdot[H]/d[O] */
-        J[36] -= dqdci;               /* dwdot[O]/d[O] */
-        J[37] += dqdci;               /* dwdot[OH]/d[O] */
-        /* d()/d[OH] */
-        dqdci =  - k_r;
-        J[70] -= dqdci;               /* dwdot[H]/d[OH] */
-        J[71] -= dqdci;               /* dwdot[O]/d[OH] */
-        J[72] += dqdci;               /* dwdot[OH]/d[OH] */
-        /* d()/d[H2] */
-        dqdci = (TB[20][0] - 1)*q_nocor;
-        J[140] -= dqdci;              /* dwdot[H]/d[H2] */
-        J[141] -= dqdci;              /* dwdot[O]/d[H2] */
-        J[142] += dqdci;              /* dwdot[OH]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[20][1] - 1)*q_nocor;
-        J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[176] -= dqdci;              /* dwdot[O]/d[H2O] */
-        J[177] += dqdci;              /* dwdot[OH]/d[H2O] */
-        /* d()/d[CO] */
-        dqdci = (TB[20][2] - 1)*q_nocor;
-        J[455] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[456] -= dqdci;              /* dwdot[O]/d[CO] */
-        J[457] += dqdci;              /* dwdot[OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[20][3] - 1)*q_nocor;
-        J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
-        J[491] -= dqdci;              /* dwdot[O]/d[CO2] */
-        J[492] += dqdci;              /* dwdot[OH]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac + k_f*sc[1];
-        dqdc[1] = dcdc_fac + k_f*sc[0];
-        dqdc[2] = dcdc_fac - k_r;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[20][0];
-        dqdc[5] = TB[20][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[20][2];
-        dqdc[14] = TB[20][3];
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        for (int k=0; k<34; k++) {
-            J[35*k+0] -= dqdc[k];
-            J[35*k+1] -= dqdc[k];
-            J[35*k+2] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= q_nocor;
+    Jmix[1] -= q_nocor;
+    Jmix[2] += q_nocor;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[1];
+    J[0] -= dqdci;                /* dwdot[H]/d[H] */
+    J[1] -= dqdci;                /* dwdot[O]/d[H] */
+    J[2] += dqdci;                /* dwdot[OH]/d[H] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[0];
+    J[35] -= dqdci;               /* dwdot[H]/d[O] */
+    J[36] -= dqdci;               /* dwdot[O]/d[O] */
+    J[37] += dqdci;               /* dwdot[OH]/d[O] */
+    /* d()/d[OH] */
+    dqdci =  - k_r;
+    J[70] -= dqdci;               /* dwdot[H]/d[OH] */
+    J[71] -= dqdci;               /* dwdot[O]/d[OH] */
+    J[72] += dqdci;               /* dwdot[OH]/d[OH] */
+    /* d()/d[H2] */
+    dqdci = (TB[20][0] - 1)*q_nocor;
+    J[140] -= dqdci;              /* dwdot[H]/d[H2] */
+    J[141] -= dqdci;              /* dwdot[O]/d[H2] */
+    J[142] += dqdci;              /* dwdot[OH]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[20][1] - 1)*q_nocor;
+    J[175] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[176] -= dqdci;              /* dwdot[O]/d[H2O] */
+    J[177] += dqdci;              /* dwdot[OH]/d[H2O] */
+    /* d()/d[CO] */
+    dqdci = (TB[20][2] - 1)*q_nocor;
+    J[455] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[456] -= dqdci;              /* dwdot[O]/d[CO] */
+    J[457] += dqdci;              /* dwdot[OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[20][3] - 1)*q_nocor;
+    J[490] -= dqdci;              /* dwdot[H]/d[CO2] */
+    J[491] -= dqdci;              /* dwdot[O]/d[CO2] */
+    J[492] += dqdci;              /* dwdot[OH]/d[CO2] */
     J[1190] -= dqdT; /* dwdot[H]/dT */
     J[1191] -= dqdT; /* dwdot[O]/dT */
     J[1192] += dqdT; /* dwdot[OH]/dT */
@@ -19618,12 +19377,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[21][0] - 1)*sc[4] + (TB[21][1] - 1)*sc[5] + (TB[21][2] - 1)*sc[13] + (TB[21][3] - 1)*sc[14];
     /* forward */
     phi_f = sc[1]*sc[1];
-    k_f = prefactor_units[21] * fwd_A[21]
-                * exp(fwd_beta[21] * tc[0] - activation_units[21] * fwd_Ea[21] * invT);
+    k_f = k_f_s[21];
     dlnkfdT = fwd_beta[21] * invT + activation_units[21] * fwd_Ea[21] * invT2;
     /* reverse */
     phi_r = sc[6];
-    Kc = refCinv * exp(2*g_RT[1] - g_RT[6]);
+    Kc = Kc_s[21];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[1]) + (h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19637,72 +19395,33 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[O] */
-        dqdci =  + k_f*2*sc[1];
-        J[36] += -2 * dqdci;          /* dwdot[O]/d[O] */
-        J[41] += dqdci;               /* dwdot[O2]/d[O] */
-        /* d()/d[H2] */
-        dqdci = (TB[21][0] - 1)*q_nocor;
-        J[141] += -2 * dqdci;         /* dwdot[O]/d[H2] */
-        J[146] += dqdci;              /* dwdot[O2]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[21][1] - 1)*q_nocor;
-        J[176] += -2 * dqdci;         /* dwdot[O]/d[H2O] */
-        J[181] += dqdci;              /* dwdot[O2]/d[H2O] */
-        /* d()/d[O2] */
-        dqdci =  - k_r;
-        J[211] += -2 * dqdci;         /* dwdot[O]/d[O2] */
-        J[216] += dqdci;              /* dwdot[O2]/d[O2] */
-        /* d()/d[CO] */
-        dqdci = (TB[21][2] - 1)*q_nocor;
-        J[456] += -2 * dqdci;         /* dwdot[O]/d[CO] */
-        J[461] += dqdci;              /* dwdot[O2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[21][3] - 1)*q_nocor;
-        J[491] += -2 * dqdci;         /* dwdot[O]/d[CO2] */
-        J[496] += dqdci;              /* dwdot[O2]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*2*sc[1];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[21][0];
-        dqdc[5] = TB[21][1];
-        dqdc[6] = dcdc_fac - k_r;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[21][2];
-        dqdc[14] = TB[21][3];
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        for (int k=0; k<34; k++) {
-            J[35*k+1] += -2 * dqdc[k];
-            J[35*k+6] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] += -2 * q_nocor;
+    Jmix[6] += q_nocor;
+    /* d()/d[O] */
+    dqdci =  + k_f*2*sc[1];
+    J[36] += -2 * dqdci;          /* dwdot[O]/d[O] */
+    J[41] += dqdci;               /* dwdot[O2]/d[O] */
+    /* d()/d[H2] */
+    dqdci = (TB[21][0] - 1)*q_nocor;
+    J[141] += -2 * dqdci;         /* dwdot[O]/d[H2] */
+    J[146] += dqdci;              /* dwdot[O2]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[21][1] - 1)*q_nocor;
+    J[176] += -2 * dqdci;         /* dwdot[O]/d[H2O] */
+    J[181] += dqdci;              /* dwdot[O2]/d[H2O] */
+    /* d()/d[O2] */
+    dqdci =  - k_r;
+    J[211] += -2 * dqdci;         /* dwdot[O]/d[O2] */
+    J[216] += dqdci;              /* dwdot[O2]/d[O2] */
+    /* d()/d[CO] */
+    dqdci = (TB[21][2] - 1)*q_nocor;
+    J[456] += -2 * dqdci;         /* dwdot[O]/d[CO] */
+    J[461] += dqdci;              /* dwdot[O2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[21][3] - 1)*q_nocor;
+    J[491] += -2 * dqdci;         /* dwdot[O]/d[CO2] */
+    J[496] += dqdci;              /* dwdot[O2]/d[CO2] */
     J[1191] += -2 * dqdT; /* dwdot[O]/dT */
     J[1196] += dqdT; /* dwdot[O2]/dT */
 
@@ -19712,12 +19431,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[22][0] - 1)*sc[4] + (TB[22][1] - 1)*sc[5] + (TB[22][2] - 1)*sc[13] + (TB[22][3] - 1)*sc[14];
     /* forward */
     phi_f = sc[11];
-    k_f = prefactor_units[22] * fwd_A[22]
-                * exp(fwd_beta[22] * tc[0] - activation_units[22] * fwd_Ea[22] * invT);
+    k_f = k_f_s[22];
     dlnkfdT = fwd_beta[22] * invT + activation_units[22] * fwd_Ea[22] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[13];
-    Kc = refC * exp(-g_RT[0] + g_RT[11] - g_RT[13]);
+    Kc = Kc_s[22];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11]) + (h_RT[0] + h_RT[13]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19732,79 +19450,40 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[13];
-        J[0] += dqdci;                /* dwdot[H]/d[H] */
-        J[11] -= dqdci;               /* dwdot[HCO]/d[H] */
-        J[13] += dqdci;               /* dwdot[CO]/d[H] */
-        /* d()/d[H2] */
-        dqdci = (TB[22][0] - 1)*q_nocor;
-        J[140] += dqdci;              /* dwdot[H]/d[H2] */
-        J[151] -= dqdci;              /* dwdot[HCO]/d[H2] */
-        J[153] += dqdci;              /* dwdot[CO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[22][1] - 1)*q_nocor;
-        J[175] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[186] -= dqdci;              /* dwdot[HCO]/d[H2O] */
-        J[188] += dqdci;              /* dwdot[CO]/d[H2O] */
-        /* d()/d[HCO] */
-        dqdci =  + k_f;
-        J[385] += dqdci;              /* dwdot[H]/d[HCO] */
-        J[396] -= dqdci;              /* dwdot[HCO]/d[HCO] */
-        J[398] += dqdci;              /* dwdot[CO]/d[HCO] */
-        /* d()/d[CO] */
-        dqdci = (TB[22][2] - 1)*q_nocor - k_r*sc[0];
-        J[455] += dqdci;              /* dwdot[H]/d[CO] */
-        J[466] -= dqdci;              /* dwdot[HCO]/d[CO] */
-        J[468] += dqdci;              /* dwdot[CO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[22][3] - 1)*q_nocor;
-        J[490] += dqdci;              /* dwdot[H]/d[CO2] */
-        J[501] -= dqdci;              /* dwdot[HCO]/d[CO2] */
-        J[503] += dqdci;              /* dwdot[CO]/d[CO2] */
-    }
-    else {
-        dqdc[0] = dcdc_fac - k_r*sc[13];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = TB[22][0];
-        dqdc[5] = TB[22][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac + k_f;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[22][2] - k_r*sc[0];
-        dqdc[14] = TB[22][3];
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        for (int k=0; k<34; k++) {
-            J[35*k+0] += dqdc[k];
-            J[35*k+11] -= dqdc[k];
-            J[35*k+13] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += q_nocor;
+    Jmix[11] -= q_nocor;
+    Jmix[13] += q_nocor;
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[13];
+    J[0] += dqdci;                /* dwdot[H]/d[H] */
+    J[11] -= dqdci;               /* dwdot[HCO]/d[H] */
+    J[13] += dqdci;               /* dwdot[CO]/d[H] */
+    /* d()/d[H2] */
+    dqdci = (TB[22][0] - 1)*q_nocor;
+    J[140] += dqdci;              /* dwdot[H]/d[H2] */
+    J[151] -= dqdci;              /* dwdot[HCO]/d[H2] */
+    J[153] += dqdci;              /* dwdot[CO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[22][1] - 1)*q_nocor;
+    J[175] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[186] -= dqdci;              /* dwdot[HCO]/d[H2O] */
+    J[188] += dqdci;              /* dwdot[CO]/d[H2O] */
+    /* d()/d[HCO] */
+    dqdci =  + k_f;
+    J[385] += dqdci;              /* dwdot[H]/d[HCO] */
+    J[396] -= dqdci;              /* dwdot[HCO]/d[HCO] */
+    J[398] += dqdci;              /* dwdot[CO]/d[HCO] */
+    /* d()/d[CO] */
+    dqdci = (TB[22][2] - 1)*q_nocor - k_r*sc[0];
+    J[455] += dqdci;              /* dwdot[H]/d[CO] */
+    J[466] -= dqdci;              /* dwdot[HCO]/d[CO] */
+    J[468] += dqdci;              /* dwdot[CO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[22][3] - 1)*q_nocor;
+    J[490] += dqdci;              /* dwdot[H]/d[CO2] */
+    J[501] -= dqdci;              /* dwdot[HCO]/d[CO2] */
+    J[503] += dqdci;              /* dwdot[CO]/d[CO2] */
     J[1190] += dqdT; /* dwdot[H]/dT */
     J[1201] -= dqdT; /* dwdot[HCO]/dT */
     J[1203] += dqdT; /* dwdot[CO]/dT */
@@ -19813,12 +19492,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[6];
-    k_f = prefactor_units[23] * fwd_A[23]
-                * exp(fwd_beta[23] * tc[0] - activation_units[23] * fwd_Ea[23] * invT);
+    k_f = k_f_s[23];
     dlnkfdT = fwd_beta[23] * invT + activation_units[23] * fwd_Ea[23] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[2];
-    Kc = exp(g_RT[0] - g_RT[1] - g_RT[2] + g_RT[6]);
+    Kc = Kc_s[23];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[6]) + (h_RT[1] + h_RT[2]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19864,12 +19542,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[4];
-    k_f = prefactor_units[24] * fwd_A[24]
-                * exp(fwd_beta[24] * tc[0] - activation_units[24] * fwd_Ea[24] * invT);
+    k_f = k_f_s[24];
     dlnkfdT = fwd_beta[24] * invT + activation_units[24] * fwd_Ea[24] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[2];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[2] + g_RT[4]);
+    Kc = Kc_s[24];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[4]) + (h_RT[0] + h_RT[2]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19915,12 +19592,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[4];
-    k_f = prefactor_units[25] * fwd_A[25]
-                * exp(fwd_beta[25] * tc[0] - activation_units[25] * fwd_Ea[25] * invT);
+    k_f = k_f_s[25];
     dlnkfdT = fwd_beta[25] * invT + activation_units[25] * fwd_Ea[25] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[5];
-    Kc = exp(-g_RT[0] + g_RT[2] + g_RT[4] - g_RT[5]);
+    Kc = Kc_s[25];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[4]) + (h_RT[0] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -19966,12 +19642,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[2];
-    k_f = prefactor_units[26] * fwd_A[26]
-                * exp(fwd_beta[26] * tc[0] - activation_units[26] * fwd_Ea[26] * invT);
+    k_f = k_f_s[26];
     dlnkfdT = fwd_beta[26] * invT + activation_units[26] * fwd_Ea[26] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[5];
-    Kc = exp(-g_RT[1] + 2*g_RT[2] - g_RT[5]);
+    Kc = Kc_s[26];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[2]) + (h_RT[1] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20006,12 +19681,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[0]*sc[4];
-    k_f = prefactor_units[27] * fwd_A[27]
-                * exp(fwd_beta[27] * tc[0] - activation_units[27] * fwd_Ea[27] * invT);
+    k_f = k_f_s[27];
     dlnkfdT = fwd_beta[27] * invT + activation_units[27] * fwd_Ea[27] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[4];
-    Kc = refCinv * exp(2*g_RT[0] + g_RT[4] - 2*g_RT[4]);
+    Kc = Kc_s[27];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[0] + h_RT[4]) + (2*h_RT[4]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20037,12 +19711,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[0]*sc[5];
-    k_f = prefactor_units[28] * fwd_A[28]
-                * exp(fwd_beta[28] * tc[0] - activation_units[28] * fwd_Ea[28] * invT);
+    k_f = k_f_s[28];
     dlnkfdT = fwd_beta[28] * invT + activation_units[28] * fwd_Ea[28] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[5];
-    Kc = refCinv * exp(2*g_RT[0] - g_RT[4] + g_RT[5] - g_RT[5]);
+    Kc = Kc_s[28];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[0] + h_RT[5]) + (h_RT[4] + h_RT[5]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20072,12 +19745,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[0]*sc[14];
-    k_f = prefactor_units[29] * fwd_A[29]
-                * exp(fwd_beta[29] * tc[0] - activation_units[29] * fwd_Ea[29] * invT);
+    k_f = k_f_s[29];
     dlnkfdT = fwd_beta[29] * invT + activation_units[29] * fwd_Ea[29] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[14];
-    Kc = refCinv * exp(2*g_RT[0] - g_RT[4] + g_RT[14] - g_RT[14]);
+    Kc = Kc_s[29];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[0] + h_RT[14]) + (h_RT[4] + h_RT[14]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20107,12 +19779,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[6];
-    k_f = prefactor_units[30] * fwd_A[30]
-                * exp(fwd_beta[30] * tc[0] - activation_units[30] * fwd_Ea[30] * invT);
+    k_f = k_f_s[30];
     dlnkfdT = fwd_beta[30] * invT + activation_units[30] * fwd_Ea[30] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[3];
-    Kc = exp(-g_RT[0] - g_RT[3] + g_RT[4] + g_RT[6]);
+    Kc = Kc_s[30];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[6]) + (h_RT[0] + h_RT[3]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20158,12 +19829,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[3];
-    k_f = prefactor_units[31] * fwd_A[31]
-                * exp(fwd_beta[31] * tc[0] - activation_units[31] * fwd_Ea[31] * invT);
+    k_f = k_f_s[31];
     dlnkfdT = fwd_beta[31] * invT + activation_units[31] * fwd_Ea[31] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[5];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[3] - g_RT[5]);
+    Kc = Kc_s[31];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[3]) + (h_RT[1] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20209,12 +19879,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[3];
-    k_f = prefactor_units[32] * fwd_A[32]
-                * exp(fwd_beta[32] * tc[0] - activation_units[32] * fwd_Ea[32] * invT);
+    k_f = k_f_s[32];
     dlnkfdT = fwd_beta[32] * invT + activation_units[32] * fwd_Ea[32] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[2];
-    Kc = exp(g_RT[0] - 2*g_RT[2] + g_RT[3]);
+    Kc = Kc_s[32];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[3]) + (2*h_RT[2]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20249,12 +19918,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3];
-    k_f = prefactor_units[33] * fwd_A[33]
-                * exp(fwd_beta[33] * tc[0] - activation_units[33] * fwd_Ea[33] * invT);
+    k_f = k_f_s[33];
     dlnkfdT = fwd_beta[33] * invT + activation_units[33] * fwd_Ea[33] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[6];
-    Kc = exp(g_RT[1] - g_RT[2] + g_RT[3] - g_RT[6]);
+    Kc = Kc_s[33];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3]) + (h_RT[2] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20300,12 +19968,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[3];
-    k_f = prefactor_units[34] * fwd_A[34]
-                * exp(fwd_beta[34] * tc[0] - activation_units[34] * fwd_Ea[34] * invT);
+    k_f = k_f_s[34];
     dlnkfdT = fwd_beta[34] * invT + activation_units[34] * fwd_Ea[34] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = exp(g_RT[2] + g_RT[3] - g_RT[5] - g_RT[6]);
+    Kc = Kc_s[34];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[3]) + (h_RT[5] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20351,12 +20018,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[3];
-    k_f = prefactor_units[35] * fwd_A[35]
-                * exp(fwd_beta[35] * tc[0] - activation_units[35] * fwd_Ea[35] * invT);
+    k_f = k_f_s[35];
     dlnkfdT = fwd_beta[35] * invT + activation_units[35] * fwd_Ea[35] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = exp(g_RT[2] + g_RT[3] - g_RT[5] - g_RT[6]);
+    Kc = Kc_s[35];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[3]) + (h_RT[5] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20402,12 +20068,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[3];
-    k_f = prefactor_units[36] * fwd_A[36]
-                * exp(fwd_beta[36] * tc[0] - activation_units[36] * fwd_Ea[36] * invT);
+    k_f = k_f_s[36];
     dlnkfdT = fwd_beta[36] * invT + activation_units[36] * fwd_Ea[36] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = exp(g_RT[2] + g_RT[3] - g_RT[5] - g_RT[6]);
+    Kc = Kc_s[36];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[3]) + (h_RT[5] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20453,12 +20118,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[3];
-    k_f = prefactor_units[37] * fwd_A[37]
-                * exp(fwd_beta[37] * tc[0] - activation_units[37] * fwd_Ea[37] * invT);
+    k_f = k_f_s[37];
     dlnkfdT = fwd_beta[37] * invT + activation_units[37] * fwd_Ea[37] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = exp(g_RT[2] + g_RT[3] - g_RT[5] - g_RT[6]);
+    Kc = Kc_s[37];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[3]) + (h_RT[5] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20504,12 +20168,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[3];
-    k_f = prefactor_units[38] * fwd_A[38]
-                * exp(fwd_beta[38] * tc[0] - activation_units[38] * fwd_Ea[38] * invT);
+    k_f = k_f_s[38];
     dlnkfdT = fwd_beta[38] * invT + activation_units[38] * fwd_Ea[38] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = exp(g_RT[2] + g_RT[3] - g_RT[5] - g_RT[6]);
+    Kc = Kc_s[38];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[3]) + (h_RT[5] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20555,12 +20218,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[13];
-    k_f = prefactor_units[39] * fwd_A[39]
-                * exp(fwd_beta[39] * tc[0] - activation_units[39] * fwd_Ea[39] * invT);
+    k_f = k_f_s[39];
     dlnkfdT = fwd_beta[39] * invT + activation_units[39] * fwd_Ea[39] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[14];
-    Kc = exp(-g_RT[0] + g_RT[2] + g_RT[13] - g_RT[14]);
+    Kc = Kc_s[39];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[13]) + (h_RT[0] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20606,12 +20268,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[13];
-    k_f = prefactor_units[40] * fwd_A[40]
-                * exp(fwd_beta[40] * tc[0] - activation_units[40] * fwd_Ea[40] * invT);
+    k_f = k_f_s[40];
     dlnkfdT = fwd_beta[40] * invT + activation_units[40] * fwd_Ea[40] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[14];
-    Kc = exp(-g_RT[0] + g_RT[2] + g_RT[13] - g_RT[14]);
+    Kc = Kc_s[40];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[13]) + (h_RT[0] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20657,12 +20318,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[13];
-    k_f = prefactor_units[41] * fwd_A[41]
-                * exp(fwd_beta[41] * tc[0] - activation_units[41] * fwd_Ea[41] * invT);
+    k_f = k_f_s[41];
     dlnkfdT = fwd_beta[41] * invT + activation_units[41] * fwd_Ea[41] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14];
-    Kc = exp(-g_RT[1] + g_RT[6] + g_RT[13] - g_RT[14]);
+    Kc = Kc_s[41];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[13]) + (h_RT[1] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20708,12 +20368,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[13];
-    k_f = prefactor_units[42] * fwd_A[42]
-                * exp(fwd_beta[42] * tc[0] - activation_units[42] * fwd_Ea[42] * invT);
+    k_f = k_f_s[42];
     dlnkfdT = fwd_beta[42] * invT + activation_units[42] * fwd_Ea[42] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[14];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[13] - g_RT[14]);
+    Kc = Kc_s[42];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[13]) + (h_RT[2] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20759,12 +20418,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[11];
-    k_f = prefactor_units[43] * fwd_A[43]
-                * exp(fwd_beta[43] * tc[0] - activation_units[43] * fwd_Ea[43] * invT);
+    k_f = k_f_s[43];
     dlnkfdT = fwd_beta[43] * invT + activation_units[43] * fwd_Ea[43] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[13];
-    Kc = exp(g_RT[0] - g_RT[4] + g_RT[11] - g_RT[13]);
+    Kc = Kc_s[43];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[11]) + (h_RT[4] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20810,12 +20468,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[11];
-    k_f = prefactor_units[44] * fwd_A[44]
-                * exp(fwd_beta[44] * tc[0] - activation_units[44] * fwd_Ea[44] * invT);
+    k_f = k_f_s[44];
     dlnkfdT = fwd_beta[44] * invT + activation_units[44] * fwd_Ea[44] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[13];
-    Kc = exp(g_RT[1] - g_RT[2] + g_RT[11] - g_RT[13]);
+    Kc = Kc_s[44];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[11]) + (h_RT[2] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20861,12 +20518,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[11];
-    k_f = prefactor_units[45] * fwd_A[45]
-                * exp(fwd_beta[45] * tc[0] - activation_units[45] * fwd_Ea[45] * invT);
+    k_f = k_f_s[45];
     dlnkfdT = fwd_beta[45] * invT + activation_units[45] * fwd_Ea[45] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[14];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[11] - g_RT[14]);
+    Kc = Kc_s[45];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[11]) + (h_RT[0] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20912,12 +20568,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[11];
-    k_f = prefactor_units[46] * fwd_A[46]
-                * exp(fwd_beta[46] * tc[0] - activation_units[46] * fwd_Ea[46] * invT);
+    k_f = k_f_s[46];
     dlnkfdT = fwd_beta[46] * invT + activation_units[46] * fwd_Ea[46] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[13];
-    Kc = exp(g_RT[2] - g_RT[5] + g_RT[11] - g_RT[13]);
+    Kc = Kc_s[46];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[11]) + (h_RT[5] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -20963,12 +20618,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[11];
-    k_f = prefactor_units[47] * fwd_A[47]
-                * exp(fwd_beta[47] * tc[0] - activation_units[47] * fwd_Ea[47] * invT);
+    k_f = k_f_s[47];
     dlnkfdT = fwd_beta[47] * invT + activation_units[47] * fwd_Ea[47] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[5]*sc[13];
-    Kc = refC * exp(-g_RT[0] + g_RT[5] - g_RT[5] + g_RT[11] - g_RT[13]);
+    Kc = Kc_s[47];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[11]) + (h_RT[0] + h_RT[5] + h_RT[13]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21008,12 +20662,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[11];
-    k_f = prefactor_units[48] * fwd_A[48]
-                * exp(fwd_beta[48] * tc[0] - activation_units[48] * fwd_Ea[48] * invT);
+    k_f = k_f_s[48];
     dlnkfdT = fwd_beta[48] * invT + activation_units[48] * fwd_Ea[48] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[13];
-    Kc = exp(-g_RT[3] + g_RT[6] + g_RT[11] - g_RT[13]);
+    Kc = Kc_s[48];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[11]) + (h_RT[3] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21059,12 +20712,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[7];
-    k_f = prefactor_units[49] * fwd_A[49]
-                * exp(fwd_beta[49] * tc[0] - activation_units[49] * fwd_Ea[49] * invT);
+    k_f = k_f_s[49];
     dlnkfdT = fwd_beta[49] * invT + activation_units[49] * fwd_Ea[49] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[13];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[7] - g_RT[13]);
+    Kc = Kc_s[49];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[7]) + (h_RT[0] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21110,12 +20762,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[7];
-    k_f = prefactor_units[50] * fwd_A[50]
-                * exp(fwd_beta[50] * tc[0] - activation_units[50] * fwd_Ea[50] * invT);
+    k_f = k_f_s[50];
     dlnkfdT = fwd_beta[50] * invT + activation_units[50] * fwd_Ea[50] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[11];
-    Kc = exp(-g_RT[0] + g_RT[2] + g_RT[7] - g_RT[11]);
+    Kc = Kc_s[50];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[7]) + (h_RT[0] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21161,12 +20812,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[7];
-    k_f = prefactor_units[51] * fwd_A[51]
-                * exp(fwd_beta[51] * tc[0] - activation_units[51] * fwd_Ea[51] * invT);
+    k_f = k_f_s[51];
     dlnkfdT = fwd_beta[51] * invT + activation_units[51] * fwd_Ea[51] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[8];
-    Kc = exp(-g_RT[0] + g_RT[4] + g_RT[7] - g_RT[8]);
+    Kc = Kc_s[51];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[7]) + (h_RT[0] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21212,12 +20862,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[7];
-    k_f = prefactor_units[52] * fwd_A[52]
-                * exp(fwd_beta[52] * tc[0] - activation_units[52] * fwd_Ea[52] * invT);
+    k_f = k_f_s[52];
     dlnkfdT = fwd_beta[52] * invT + activation_units[52] * fwd_Ea[52] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[12];
-    Kc = exp(-g_RT[0] + g_RT[5] + g_RT[7] - g_RT[12]);
+    Kc = Kc_s[52];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[7]) + (h_RT[0] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21263,12 +20912,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[7];
-    k_f = prefactor_units[53] * fwd_A[53]
-                * exp(fwd_beta[53] * tc[0] - activation_units[53] * fwd_Ea[53] * invT);
+    k_f = k_f_s[53];
     dlnkfdT = fwd_beta[53] * invT + activation_units[53] * fwd_Ea[53] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[11];
-    Kc = exp(-g_RT[1] + g_RT[6] + g_RT[7] - g_RT[11]);
+    Kc = Kc_s[53];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[7]) + (h_RT[1] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21314,12 +20962,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[14];
-    k_f = prefactor_units[54] * fwd_A[54]
-                * exp(fwd_beta[54] * tc[0] - activation_units[54] * fwd_Ea[54] * invT);
+    k_f = k_f_s[54];
     dlnkfdT = fwd_beta[54] * invT + activation_units[54] * fwd_Ea[54] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[13];
-    Kc = exp(g_RT[7] - g_RT[11] - g_RT[13] + g_RT[14]);
+    Kc = Kc_s[54];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[14]) + (h_RT[11] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21365,12 +21012,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[8];
-    k_f = prefactor_units[55] * fwd_A[55]
-                * exp(fwd_beta[55] * tc[0] - activation_units[55] * fwd_Ea[55] * invT);
+    k_f = k_f_s[55];
     dlnkfdT = fwd_beta[55] * invT + activation_units[55] * fwd_Ea[55] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[11];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[8] - g_RT[11]);
+    Kc = Kc_s[55];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[8]) + (h_RT[0] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21416,12 +21062,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[8];
-    k_f = prefactor_units[56] * fwd_A[56]
-                * exp(fwd_beta[56] * tc[0] - activation_units[56] * fwd_Ea[56] * invT);
+    k_f = k_f_s[56];
     dlnkfdT = fwd_beta[56] * invT + activation_units[56] * fwd_Ea[56] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[12];
-    Kc = exp(-g_RT[0] + g_RT[2] + g_RT[8] - g_RT[12]);
+    Kc = Kc_s[56];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[8]) + (h_RT[0] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21467,12 +21112,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[8];
-    k_f = prefactor_units[57] * fwd_A[57]
-                * exp(fwd_beta[57] * tc[0] - activation_units[57] * fwd_Ea[57] * invT);
+    k_f = k_f_s[57];
     dlnkfdT = fwd_beta[57] * invT + activation_units[57] * fwd_Ea[57] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[7];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[7] + g_RT[8]);
+    Kc = Kc_s[57];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[8]) + (h_RT[5] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21518,12 +21162,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[8];
-    k_f = prefactor_units[58] * fwd_A[58]
-                * exp(fwd_beta[58] * tc[0] - activation_units[58] * fwd_Ea[58] * invT);
+    k_f = k_f_s[58];
     dlnkfdT = fwd_beta[58] * invT + activation_units[58] * fwd_Ea[58] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[10];
-    Kc = exp(-g_RT[0] + g_RT[4] + g_RT[8] - g_RT[10]);
+    Kc = Kc_s[58];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[8]) + (h_RT[0] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21569,12 +21212,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[8];
-    k_f = prefactor_units[59] * fwd_A[59]
-                * exp(fwd_beta[59] * tc[0] - activation_units[59] * fwd_Ea[59] * invT);
+    k_f = k_f_s[59];
     dlnkfdT = fwd_beta[59] * invT + activation_units[59] * fwd_Ea[59] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[11];
-    Kc = exp(-g_RT[2] + g_RT[6] + g_RT[8] - g_RT[11]);
+    Kc = Kc_s[59];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[8]) + (h_RT[2] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21620,12 +21262,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[8];
-    k_f = prefactor_units[60] * fwd_A[60]
-                * exp(fwd_beta[60] * tc[0] - activation_units[60] * fwd_Ea[60] * invT);
+    k_f = k_f_s[60];
     dlnkfdT = fwd_beta[60] * invT + activation_units[60] * fwd_Ea[60] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[0]*sc[14];
-    Kc = refC * exp(-2*g_RT[0] + g_RT[6] + g_RT[8] - g_RT[14]);
+    Kc = Kc_s[60];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[8]) + (2*h_RT[0] + h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21671,12 +21312,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[8];
-    k_f = prefactor_units[61] * fwd_A[61]
-                * exp(fwd_beta[61] * tc[0] - activation_units[61] * fwd_Ea[61] * invT);
+    k_f = k_f_s[61];
     dlnkfdT = fwd_beta[61] * invT + activation_units[61] * fwd_Ea[61] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[12];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[8] - g_RT[12]);
+    Kc = Kc_s[61];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[8]) + (h_RT[2] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21722,12 +21362,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[8];
-    k_f = prefactor_units[62] * fwd_A[62]
-                * exp(fwd_beta[62] * tc[0] - activation_units[62] * fwd_Ea[62] * invT);
+    k_f = k_f_s[62];
     dlnkfdT = fwd_beta[62] * invT + activation_units[62] * fwd_Ea[62] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[17];
-    Kc = exp(-g_RT[0] + g_RT[7] + g_RT[8] - g_RT[17]);
+    Kc = Kc_s[62];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[8]) + (h_RT[0] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21773,12 +21412,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[8];
-    k_f = prefactor_units[63] * fwd_A[63]
-                * exp(fwd_beta[63] * tc[0] - activation_units[63] * fwd_Ea[63] * invT);
+    k_f = k_f_s[63];
     dlnkfdT = fwd_beta[63] * invT + activation_units[63] * fwd_Ea[63] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[17];
-    Kc = exp(-g_RT[4] + 2*g_RT[8] - g_RT[17]);
+    Kc = Kc_s[63];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[8]) + (h_RT[4] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21813,12 +21451,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[33];
-    k_f = prefactor_units[64] * fwd_A[64]
-                * exp(fwd_beta[64] * tc[0] - activation_units[64] * fwd_Ea[64] * invT);
+    k_f = k_f_s[64];
     dlnkfdT = fwd_beta[64] * invT + activation_units[64] * fwd_Ea[64] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[33];
-    Kc = exp(-g_RT[8] + g_RT[9] + g_RT[33] - g_RT[33]);
+    Kc = Kc_s[64];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[33]) + (h_RT[8] + h_RT[33]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21848,12 +21485,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[9];
-    k_f = prefactor_units[65] * fwd_A[65]
-                * exp(fwd_beta[65] * tc[0] - activation_units[65] * fwd_Ea[65] * invT);
+    k_f = k_f_s[65];
     dlnkfdT = fwd_beta[65] * invT + activation_units[65] * fwd_Ea[65] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[7];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[7] + g_RT[9]);
+    Kc = Kc_s[65];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[9]) + (h_RT[4] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21899,12 +21535,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[9];
-    k_f = prefactor_units[66] * fwd_A[66]
-                * exp(fwd_beta[66] * tc[0] - activation_units[66] * fwd_Ea[66] * invT);
+    k_f = k_f_s[66];
     dlnkfdT = fwd_beta[66] * invT + activation_units[66] * fwd_Ea[66] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[13];
-    Kc = exp(g_RT[1] - g_RT[4] + g_RT[9] - g_RT[13]);
+    Kc = Kc_s[66];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[9]) + (h_RT[4] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -21950,12 +21585,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[9];
-    k_f = prefactor_units[67] * fwd_A[67]
-                * exp(fwd_beta[67] * tc[0] - activation_units[67] * fwd_Ea[67] * invT);
+    k_f = k_f_s[67];
     dlnkfdT = fwd_beta[67] * invT + activation_units[67] * fwd_Ea[67] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[11];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[9] - g_RT[11]);
+    Kc = Kc_s[67];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[9]) + (h_RT[0] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22001,12 +21635,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[9];
-    k_f = prefactor_units[68] * fwd_A[68]
-                * exp(fwd_beta[68] * tc[0] - activation_units[68] * fwd_Ea[68] * invT);
+    k_f = k_f_s[68];
     dlnkfdT = fwd_beta[68] * invT + activation_units[68] * fwd_Ea[68] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[12];
-    Kc = exp(-g_RT[0] + g_RT[2] + g_RT[9] - g_RT[12]);
+    Kc = Kc_s[68];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[9]) + (h_RT[0] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22052,12 +21685,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[9];
-    k_f = prefactor_units[69] * fwd_A[69]
-                * exp(fwd_beta[69] * tc[0] - activation_units[69] * fwd_Ea[69] * invT);
+    k_f = k_f_s[69];
     dlnkfdT = fwd_beta[69] * invT + activation_units[69] * fwd_Ea[69] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[10];
-    Kc = exp(-g_RT[0] + g_RT[4] + g_RT[9] - g_RT[10]);
+    Kc = Kc_s[69];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[9]) + (h_RT[0] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22103,12 +21735,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[9];
-    k_f = prefactor_units[70] * fwd_A[70]
-                * exp(fwd_beta[70] * tc[0] - activation_units[70] * fwd_Ea[70] * invT);
+    k_f = k_f_s[70];
     dlnkfdT = fwd_beta[70] * invT + activation_units[70] * fwd_Ea[70] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[2]*sc[13];
-    Kc = refC * exp(-g_RT[0] - g_RT[2] + g_RT[6] + g_RT[9] - g_RT[13]);
+    Kc = Kc_s[70];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[9]) + (h_RT[0] + h_RT[2] + h_RT[13]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22167,12 +21798,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[9];
-    k_f = prefactor_units[71] * fwd_A[71]
-                * exp(fwd_beta[71] * tc[0] - activation_units[71] * fwd_Ea[71] * invT);
+    k_f = k_f_s[71];
     dlnkfdT = fwd_beta[71] * invT + activation_units[71] * fwd_Ea[71] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[13];
-    Kc = exp(-g_RT[5] + g_RT[6] + g_RT[9] - g_RT[13]);
+    Kc = Kc_s[71];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[9]) + (h_RT[5] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22218,12 +21848,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[9];
-    k_f = prefactor_units[72] * fwd_A[72]
-                * exp(fwd_beta[72] * tc[0] - activation_units[72] * fwd_Ea[72] * invT);
+    k_f = k_f_s[72];
     dlnkfdT = fwd_beta[72] * invT + activation_units[72] * fwd_Ea[72] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[8];
-    Kc = exp(g_RT[5] - g_RT[5] - g_RT[8] + g_RT[9]);
+    Kc = Kc_s[72];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[9]) + (h_RT[5] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22253,12 +21882,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[13];
-    k_f = prefactor_units[73] * fwd_A[73]
-                * exp(fwd_beta[73] * tc[0] - activation_units[73] * fwd_Ea[73] * invT);
+    k_f = k_f_s[73];
     dlnkfdT = fwd_beta[73] * invT + activation_units[73] * fwd_Ea[73] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[13];
-    Kc = exp(-g_RT[8] + g_RT[9] + g_RT[13] - g_RT[13]);
+    Kc = Kc_s[73];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[13]) + (h_RT[8] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22288,12 +21916,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[14];
-    k_f = prefactor_units[74] * fwd_A[74]
-                * exp(fwd_beta[74] * tc[0] - activation_units[74] * fwd_Ea[74] * invT);
+    k_f = k_f_s[74];
     dlnkfdT = fwd_beta[74] * invT + activation_units[74] * fwd_Ea[74] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[14];
-    Kc = exp(-g_RT[8] + g_RT[9] + g_RT[14] - g_RT[14]);
+    Kc = Kc_s[74];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[14]) + (h_RT[8] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22323,12 +21950,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[14];
-    k_f = prefactor_units[75] * fwd_A[75]
-                * exp(fwd_beta[75] * tc[0] - activation_units[75] * fwd_Ea[75] * invT);
+    k_f = k_f_s[75];
     dlnkfdT = fwd_beta[75] * invT + activation_units[75] * fwd_Ea[75] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[13];
-    Kc = exp(g_RT[9] - g_RT[12] - g_RT[13] + g_RT[14]);
+    Kc = Kc_s[75];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[14]) + (h_RT[12] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22374,12 +22000,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[12];
-    k_f = prefactor_units[76] * fwd_A[76]
-                * exp(fwd_beta[76] * tc[0] - activation_units[76] * fwd_Ea[76] * invT);
+    k_f = k_f_s[76];
     dlnkfdT = fwd_beta[76] * invT + activation_units[76] * fwd_Ea[76] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[11];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[11] + g_RT[12]);
+    Kc = Kc_s[76];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[12]) + (h_RT[4] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22425,12 +22050,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[12];
-    k_f = prefactor_units[77] * fwd_A[77]
-                * exp(fwd_beta[77] * tc[0] - activation_units[77] * fwd_Ea[77] * invT);
+    k_f = k_f_s[77];
     dlnkfdT = fwd_beta[77] * invT + activation_units[77] * fwd_Ea[77] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[11];
-    Kc = exp(g_RT[1] - g_RT[2] - g_RT[11] + g_RT[12]);
+    Kc = Kc_s[77];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[12]) + (h_RT[2] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22476,12 +22100,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[12];
-    k_f = prefactor_units[78] * fwd_A[78]
-                * exp(fwd_beta[78] * tc[0] - activation_units[78] * fwd_Ea[78] * invT);
+    k_f = k_f_s[78];
     dlnkfdT = fwd_beta[78] * invT + activation_units[78] * fwd_Ea[78] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[11];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[11] + g_RT[12]);
+    Kc = Kc_s[78];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[12]) + (h_RT[5] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22527,12 +22150,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[12];
-    k_f = prefactor_units[79] * fwd_A[79]
-                * exp(fwd_beta[79] * tc[0] - activation_units[79] * fwd_Ea[79] * invT);
+    k_f = k_f_s[79];
     dlnkfdT = fwd_beta[79] * invT + activation_units[79] * fwd_Ea[79] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[11];
-    Kc = exp(-g_RT[3] + g_RT[6] - g_RT[11] + g_RT[12]);
+    Kc = Kc_s[79];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[12]) + (h_RT[3] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22578,12 +22200,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[10];
-    k_f = prefactor_units[80] * fwd_A[80]
-                * exp(fwd_beta[80] * tc[0] - activation_units[80] * fwd_Ea[80] * invT);
+    k_f = k_f_s[80];
     dlnkfdT = fwd_beta[80] * invT + activation_units[80] * fwd_Ea[80] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[12];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[10] - g_RT[12]);
+    Kc = Kc_s[80];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[10]) + (h_RT[0] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22629,12 +22250,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[10];
-    k_f = prefactor_units[81] * fwd_A[81]
-                * exp(fwd_beta[81] * tc[0] - activation_units[81] * fwd_Ea[81] * invT);
+    k_f = k_f_s[81];
     dlnkfdT = fwd_beta[81] * invT + activation_units[81] * fwd_Ea[81] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[8];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[8] + g_RT[10]);
+    Kc = Kc_s[81];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[10]) + (h_RT[5] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22680,12 +22300,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[10];
-    k_f = prefactor_units[82] * fwd_A[82]
-                * exp(fwd_beta[82] * tc[0] - activation_units[82] * fwd_Ea[82] * invT);
+    k_f = k_f_s[82];
     dlnkfdT = fwd_beta[82] * invT + activation_units[82] * fwd_Ea[82] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[9];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[9] + g_RT[10]);
+    Kc = Kc_s[82];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[10]) + (h_RT[5] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22731,12 +22350,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[10];
-    k_f = prefactor_units[83] * fwd_A[83]
-                * exp(fwd_beta[83] * tc[0] - activation_units[83] * fwd_Ea[83] * invT);
+    k_f = k_f_s[83];
     dlnkfdT = fwd_beta[83] * invT + activation_units[83] * fwd_Ea[83] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[12];
-    Kc = exp(-g_RT[2] + g_RT[6] + g_RT[10] - g_RT[12]);
+    Kc = Kc_s[83];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[10]) + (h_RT[2] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22782,12 +22400,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[10];
-    k_f = prefactor_units[84] * fwd_A[84]
-                * exp(fwd_beta[84] * tc[0] - activation_units[84] * fwd_Ea[84] * invT);
+    k_f = k_f_s[84];
     dlnkfdT = fwd_beta[84] * invT + activation_units[84] * fwd_Ea[84] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[18];
-    Kc = exp(-g_RT[0] + g_RT[7] + g_RT[10] - g_RT[18]);
+    Kc = Kc_s[84];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[10]) + (h_RT[0] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22833,12 +22450,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[10];
-    k_f = prefactor_units[85] * fwd_A[85]
-                * exp(fwd_beta[85] * tc[0] - activation_units[85] * fwd_Ea[85] * invT);
+    k_f = k_f_s[85];
     dlnkfdT = fwd_beta[85] * invT + activation_units[85] * fwd_Ea[85] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[19];
-    Kc = exp(-g_RT[0] + g_RT[8] + g_RT[10] - g_RT[19]);
+    Kc = Kc_s[85];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[10]) + (h_RT[0] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22884,12 +22500,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[10];
-    k_f = prefactor_units[86] * fwd_A[86]
-                * exp(fwd_beta[86] * tc[0] - activation_units[86] * fwd_Ea[86] * invT);
+    k_f = k_f_s[86];
     dlnkfdT = fwd_beta[86] * invT + activation_units[86] * fwd_Ea[86] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[19];
-    Kc = exp(-g_RT[0] + g_RT[9] + g_RT[10] - g_RT[19]);
+    Kc = Kc_s[86];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[10]) + (h_RT[0] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22935,12 +22550,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[20];
-    k_f = prefactor_units[87] * fwd_A[87]
-                * exp(fwd_beta[87] * tc[0] - activation_units[87] * fwd_Ea[87] * invT);
+    k_f = k_f_s[87];
     dlnkfdT = fwd_beta[87] * invT + activation_units[87] * fwd_Ea[87] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[19];
-    Kc = exp(g_RT[10] - g_RT[13] - g_RT[19] + g_RT[20]);
+    Kc = Kc_s[87];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[20]) + (h_RT[13] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -22986,12 +22600,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[16];
-    k_f = prefactor_units[88] * fwd_A[88]
-                * exp(fwd_beta[88] * tc[0] - activation_units[88] * fwd_Ea[88] * invT);
+    k_f = k_f_s[88];
     dlnkfdT = fwd_beta[88] * invT + activation_units[88] * fwd_Ea[88] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[23];
-    Kc = exp(-g_RT[0] + g_RT[10] + g_RT[16] - g_RT[23]);
+    Kc = Kc_s[88];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[16]) + (h_RT[0] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23037,12 +22650,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[16];
-    k_f = prefactor_units[89] * fwd_A[89]
-                * exp(fwd_beta[89] * tc[0] - activation_units[89] * fwd_Ea[89] * invT);
+    k_f = k_f_s[89];
     dlnkfdT = fwd_beta[89] * invT + activation_units[89] * fwd_Ea[89] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[13];
-    Kc = exp(g_RT[1] - g_RT[7] - g_RT[13] + g_RT[16]);
+    Kc = Kc_s[89];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[16]) + (h_RT[7] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23088,12 +22700,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[16];
-    k_f = prefactor_units[90] * fwd_A[90]
-                * exp(fwd_beta[90] * tc[0] - activation_units[90] * fwd_Ea[90] * invT);
+    k_f = k_f_s[90];
     dlnkfdT = fwd_beta[90] * invT + activation_units[90] * fwd_Ea[90] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[20];
-    Kc = exp(-g_RT[0] + g_RT[2] + g_RT[16] - g_RT[20]);
+    Kc = Kc_s[90];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[16]) + (h_RT[0] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23139,12 +22750,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[16];
-    k_f = prefactor_units[91] * fwd_A[91]
-                * exp(fwd_beta[91] * tc[0] - activation_units[91] * fwd_Ea[91] * invT);
+    k_f = k_f_s[91];
     dlnkfdT = fwd_beta[91] * invT + activation_units[91] * fwd_Ea[91] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[13];
-    Kc = exp(g_RT[6] - g_RT[11] - g_RT[13] + g_RT[16]);
+    Kc = Kc_s[91];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[16]) + (h_RT[11] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23190,12 +22800,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[16];
-    k_f = prefactor_units[92] * fwd_A[92]
-                * exp(fwd_beta[92] * tc[0] - activation_units[92] * fwd_Ea[92] * invT);
+    k_f = k_f_s[92];
     dlnkfdT = fwd_beta[92] * invT + activation_units[92] * fwd_Ea[92] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[17];
-    Kc = exp(-g_RT[0] + g_RT[4] + g_RT[16] - g_RT[17]);
+    Kc = Kc_s[92];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[16]) + (h_RT[0] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23241,12 +22850,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[15];
-    k_f = prefactor_units[93] * fwd_A[93]
-                * exp(fwd_beta[93] * tc[0] - activation_units[93] * fwd_Ea[93] * invT);
+    k_f = k_f_s[93];
     dlnkfdT = fwd_beta[93] * invT + activation_units[93] * fwd_Ea[93] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[13];
-    Kc = exp(g_RT[0] - g_RT[7] - g_RT[13] + g_RT[15]);
+    Kc = Kc_s[93];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[15]) + (h_RT[7] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23292,12 +22900,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[15];
-    k_f = prefactor_units[94] * fwd_A[94]
-                * exp(fwd_beta[94] * tc[0] - activation_units[94] * fwd_Ea[94] * invT);
+    k_f = k_f_s[94];
     dlnkfdT = fwd_beta[94] * invT + activation_units[94] * fwd_Ea[94] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[13];
-    Kc = exp(g_RT[1] - 2*g_RT[13] + g_RT[15]);
+    Kc = Kc_s[94];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[15]) + (2*h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23332,12 +22939,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[15];
-    k_f = prefactor_units[95] * fwd_A[95]
-                * exp(fwd_beta[95] * tc[0] - activation_units[95] * fwd_Ea[95] * invT);
+    k_f = k_f_s[95];
     dlnkfdT = fwd_beta[95] * invT + activation_units[95] * fwd_Ea[95] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[13]*sc[13];
-    Kc = refC * exp(-g_RT[0] + g_RT[2] - 2*g_RT[13] + g_RT[15]);
+    Kc = Kc_s[95];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[15]) + (h_RT[0] + 2*h_RT[13]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23383,12 +22989,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[15];
-    k_f = prefactor_units[96] * fwd_A[96]
-                * exp(fwd_beta[96] * tc[0] - activation_units[96] * fwd_Ea[96] * invT);
+    k_f = k_f_s[96];
     dlnkfdT = fwd_beta[96] * invT + activation_units[96] * fwd_Ea[96] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[13]*sc[13];
-    Kc = refC * exp(-g_RT[1] + g_RT[6] - 2*g_RT[13] + g_RT[15]);
+    Kc = Kc_s[96];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[15]) + (h_RT[1] + 2*h_RT[13]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23434,12 +23039,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[20];
-    k_f = prefactor_units[97] * fwd_A[97]
-                * exp(fwd_beta[97] * tc[0] - activation_units[97] * fwd_Ea[97] * invT);
+    k_f = k_f_s[97];
     dlnkfdT = fwd_beta[97] * invT + activation_units[97] * fwd_Ea[97] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[13];
-    Kc = exp(g_RT[0] - g_RT[9] - g_RT[13] + g_RT[20]);
+    Kc = Kc_s[97];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[20]) + (h_RT[9] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23485,12 +23089,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[20];
-    k_f = prefactor_units[98] * fwd_A[98]
-                * exp(fwd_beta[98] * tc[0] - activation_units[98] * fwd_Ea[98] * invT);
+    k_f = k_f_s[98];
     dlnkfdT = fwd_beta[98] * invT + activation_units[98] * fwd_Ea[98] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[13]*sc[13];
-    Kc = refC * exp(-g_RT[0] + g_RT[1] - 2*g_RT[13] + g_RT[20]);
+    Kc = Kc_s[98];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[20]) + (h_RT[0] + 2*h_RT[13]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23536,12 +23139,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[20];
-    k_f = prefactor_units[99] * fwd_A[99]
-                * exp(fwd_beta[99] * tc[0] - activation_units[99] * fwd_Ea[99] * invT);
+    k_f = k_f_s[99];
     dlnkfdT = fwd_beta[99] * invT + activation_units[99] * fwd_Ea[99] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[13]*sc[13];
-    Kc = refC * exp(-g_RT[2] + g_RT[6] - 2*g_RT[13] + g_RT[20]);
+    Kc = Kc_s[99];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[20]) + (h_RT[2] + 2*h_RT[13]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23587,12 +23189,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[20];
-    k_f = prefactor_units[100] * fwd_A[100]
-                * exp(fwd_beta[100] * tc[0] - activation_units[100] * fwd_Ea[100] * invT);
+    k_f = k_f_s[100];
     dlnkfdT = fwd_beta[100] * invT + activation_units[100] * fwd_Ea[100] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[17];
-    Kc = exp(g_RT[7] - g_RT[13] - g_RT[17] + g_RT[20]);
+    Kc = Kc_s[100];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[20]) + (h_RT[13] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23638,12 +23239,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[20];
-    k_f = prefactor_units[101] * fwd_A[101]
-                * exp(fwd_beta[101] * tc[0] - activation_units[101] * fwd_Ea[101] * invT);
+    k_f = k_f_s[101];
     dlnkfdT = fwd_beta[101] * invT + activation_units[101] * fwd_Ea[101] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[18];
-    Kc = exp(g_RT[8] - g_RT[13] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[101];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[20]) + (h_RT[13] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23689,12 +23289,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[20]*sc[20];
-    k_f = prefactor_units[102] * fwd_A[102]
-                * exp(fwd_beta[102] * tc[0] - activation_units[102] * fwd_Ea[102] * invT);
+    k_f = k_f_s[102];
     dlnkfdT = fwd_beta[102] * invT + activation_units[102] * fwd_Ea[102] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[13]*sc[17];
-    Kc = refC * exp(-2*g_RT[13] - g_RT[17] + 2*g_RT[20]);
+    Kc = Kc_s[102];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[20]) + (2*h_RT[13] + h_RT[17]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23729,12 +23328,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[20];
-    k_f = prefactor_units[103] * fwd_A[103]
-                * exp(fwd_beta[103] * tc[0] - activation_units[103] * fwd_Ea[103] * invT);
+    k_f = k_f_s[103];
     dlnkfdT = fwd_beta[103] * invT + activation_units[103] * fwd_Ea[103] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[15];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[15] + g_RT[20]);
+    Kc = Kc_s[103];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[20]) + (h_RT[5] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23780,12 +23378,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[17];
-    k_f = prefactor_units[104] * fwd_A[104]
-                * exp(fwd_beta[104] * tc[0] - activation_units[104] * fwd_Ea[104] * invT);
+    k_f = k_f_s[104];
     dlnkfdT = fwd_beta[104] * invT + activation_units[104] * fwd_Ea[104] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[16];
-    Kc = exp(g_RT[1] - g_RT[2] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[104];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[17]) + (h_RT[2] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23831,12 +23428,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[17];
-    k_f = prefactor_units[105] * fwd_A[105]
-                * exp(fwd_beta[105] * tc[0] - activation_units[105] * fwd_Ea[105] * invT);
+    k_f = k_f_s[105];
     dlnkfdT = fwd_beta[105] * invT + activation_units[105] * fwd_Ea[105] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[13];
-    Kc = exp(g_RT[1] - g_RT[8] - g_RT[13] + g_RT[17]);
+    Kc = Kc_s[105];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[17]) + (h_RT[8] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23882,12 +23478,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[17];
-    k_f = prefactor_units[106] * fwd_A[106]
-                * exp(fwd_beta[106] * tc[0] - activation_units[106] * fwd_Ea[106] * invT);
+    k_f = k_f_s[106];
     dlnkfdT = fwd_beta[106] * invT + activation_units[106] * fwd_Ea[106] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[20];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[17] - g_RT[20]);
+    Kc = Kc_s[106];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[17]) + (h_RT[0] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23933,12 +23528,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[17];
-    k_f = prefactor_units[107] * fwd_A[107]
-                * exp(fwd_beta[107] * tc[0] - activation_units[107] * fwd_Ea[107] * invT);
+    k_f = k_f_s[107];
     dlnkfdT = fwd_beta[107] * invT + activation_units[107] * fwd_Ea[107] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[16];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[107];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[17]) + (h_RT[5] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -23984,12 +23578,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[17];
-    k_f = prefactor_units[108] * fwd_A[108]
-                * exp(fwd_beta[108] * tc[0] - activation_units[108] * fwd_Ea[108] * invT);
+    k_f = k_f_s[108];
     dlnkfdT = fwd_beta[108] * invT + activation_units[108] * fwd_Ea[108] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[13];
-    Kc = exp(g_RT[2] - g_RT[10] - g_RT[13] + g_RT[17]);
+    Kc = Kc_s[108];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[17]) + (h_RT[10] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24035,12 +23628,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[17];
-    k_f = prefactor_units[109] * fwd_A[109]
-                * exp(fwd_beta[109] * tc[0] - activation_units[109] * fwd_Ea[109] * invT);
+    k_f = k_f_s[109];
     dlnkfdT = fwd_beta[109] * invT + activation_units[109] * fwd_Ea[109] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[18];
-    Kc = exp(g_RT[11] - g_RT[13] + g_RT[17] - g_RT[18]);
+    Kc = Kc_s[109];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[17]) + (h_RT[13] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24086,12 +23678,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[17];
-    k_f = prefactor_units[110] * fwd_A[110]
-                * exp(fwd_beta[110] * tc[0] - activation_units[110] * fwd_Ea[110] * invT);
+    k_f = k_f_s[110];
     dlnkfdT = fwd_beta[110] * invT + activation_units[110] * fwd_Ea[110] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[23];
-    Kc = exp(-g_RT[0] + g_RT[8] + g_RT[17] - g_RT[23]);
+    Kc = Kc_s[110];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[17]) + (h_RT[0] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24137,12 +23728,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[17];
-    k_f = prefactor_units[111] * fwd_A[111]
-                * exp(fwd_beta[111] * tc[0] - activation_units[111] * fwd_Ea[111] * invT);
+    k_f = k_f_s[111];
     dlnkfdT = fwd_beta[111] * invT + activation_units[111] * fwd_Ea[111] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[23];
-    Kc = exp(-g_RT[0] + g_RT[9] + g_RT[17] - g_RT[23]);
+    Kc = Kc_s[111];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[17]) + (h_RT[0] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24188,12 +23778,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[17]*sc[20];
-    k_f = prefactor_units[112] * fwd_A[112]
-                * exp(fwd_beta[112] * tc[0] - activation_units[112] * fwd_Ea[112] * invT);
+    k_f = k_f_s[112];
     dlnkfdT = fwd_beta[112] * invT + activation_units[112] * fwd_Ea[112] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[23];
-    Kc = exp(-g_RT[13] + g_RT[17] + g_RT[20] - g_RT[23]);
+    Kc = Kc_s[112];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[17] + h_RT[20]) + (h_RT[13] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24239,12 +23828,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[17];
-    k_f = prefactor_units[113] * fwd_A[113]
-                * exp(fwd_beta[113] * tc[0] - activation_units[113] * fwd_Ea[113] * invT);
+    k_f = k_f_s[113];
     dlnkfdT = fwd_beta[113] * invT + activation_units[113] * fwd_Ea[113] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[24];
-    Kc = exp(-g_RT[0] + g_RT[10] + g_RT[17] - g_RT[24]);
+    Kc = Kc_s[113];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[17]) + (h_RT[0] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24290,12 +23878,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[17];
-    k_f = prefactor_units[114] * fwd_A[114]
-                * exp(fwd_beta[114] * tc[0] - activation_units[114] * fwd_Ea[114] * invT);
+    k_f = k_f_s[114];
     dlnkfdT = fwd_beta[114] * invT + activation_units[114] * fwd_Ea[114] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[25];
-    Kc = exp(-g_RT[0] + g_RT[10] + g_RT[17] - g_RT[25]);
+    Kc = Kc_s[114];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[17]) + (h_RT[0] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24341,12 +23928,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[17];
-    k_f = prefactor_units[115] * fwd_A[115]
-                * exp(fwd_beta[115] * tc[0] - activation_units[115] * fwd_Ea[115] * invT);
+    k_f = k_f_s[115];
     dlnkfdT = fwd_beta[115] * invT + activation_units[115] * fwd_Ea[115] * invT2;
     /* reverse */
     phi_r = sc[27];
-    Kc = refCinv * exp(g_RT[10] + g_RT[17] - g_RT[27]);
+    Kc = Kc_s[115];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[17]) + (h_RT[27]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24381,12 +23967,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[17];
-    k_f = prefactor_units[116] * fwd_A[116]
-                * exp(fwd_beta[116] * tc[0] - activation_units[116] * fwd_Ea[116] * invT);
+    k_f = k_f_s[116];
     dlnkfdT = fwd_beta[116] * invT + activation_units[116] * fwd_Ea[116] * invT2;
     /* reverse */
     phi_r = sc[26];
-    Kc = refCinv * exp(g_RT[10] + g_RT[17] - g_RT[26]);
+    Kc = Kc_s[116];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[17]) + (h_RT[26]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24421,12 +24006,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[18];
-    k_f = prefactor_units[117] * fwd_A[117]
-                * exp(fwd_beta[117] * tc[0] - activation_units[117] * fwd_Ea[117] * invT);
+    k_f = k_f_s[117];
     dlnkfdT = fwd_beta[117] * invT + activation_units[117] * fwd_Ea[117] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[17];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[117];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[18]) + (h_RT[4] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24472,12 +24056,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[18];
-    k_f = prefactor_units[118] * fwd_A[118]
-                * exp(fwd_beta[118] * tc[0] - activation_units[118] * fwd_Ea[118] * invT);
+    k_f = k_f_s[118];
     dlnkfdT = fwd_beta[118] * invT + activation_units[118] * fwd_Ea[118] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[13];
-    Kc = exp(g_RT[1] - g_RT[10] - g_RT[13] + g_RT[18]);
+    Kc = Kc_s[118];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[18]) + (h_RT[10] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24523,12 +24106,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[18];
-    k_f = prefactor_units[119] * fwd_A[119]
-                * exp(fwd_beta[119] * tc[0] - activation_units[119] * fwd_Ea[119] * invT);
+    k_f = k_f_s[119];
     dlnkfdT = fwd_beta[119] * invT + activation_units[119] * fwd_Ea[119] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[17];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[119];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[18]) + (h_RT[5] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24574,12 +24156,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[18];
-    k_f = prefactor_units[120] * fwd_A[120]
-                * exp(fwd_beta[120] * tc[0] - activation_units[120] * fwd_Ea[120] * invT);
+    k_f = k_f_s[120];
     dlnkfdT = fwd_beta[120] * invT + activation_units[120] * fwd_Ea[120] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[17];
-    Kc = exp(-g_RT[3] + g_RT[6] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[120];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[18]) + (h_RT[3] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24625,12 +24206,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[18];
-    k_f = prefactor_units[121] * fwd_A[121]
-                * exp(fwd_beta[121] * tc[0] - activation_units[121] * fwd_Ea[121] * invT);
+    k_f = k_f_s[121];
     dlnkfdT = fwd_beta[121] * invT + activation_units[121] * fwd_Ea[121] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[12];
-    Kc = exp(g_RT[6] - g_RT[11] - g_RT[12] + g_RT[18]);
+    Kc = Kc_s[121];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[18]) + (h_RT[11] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24676,12 +24256,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[18];
-    k_f = prefactor_units[122] * fwd_A[122]
-                * exp(fwd_beta[122] * tc[0] - activation_units[122] * fwd_Ea[122] * invT);
+    k_f = k_f_s[122];
     dlnkfdT = fwd_beta[122] * invT + activation_units[122] * fwd_Ea[122] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[19];
-    Kc = exp(g_RT[11] - g_RT[13] + g_RT[18] - g_RT[19]);
+    Kc = Kc_s[122];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[18]) + (h_RT[13] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24727,12 +24306,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[18];
-    k_f = prefactor_units[123] * fwd_A[123]
-                * exp(fwd_beta[123] * tc[0] - activation_units[123] * fwd_Ea[123] * invT);
+    k_f = k_f_s[123];
     dlnkfdT = fwd_beta[123] * invT + activation_units[123] * fwd_Ea[123] * invT2;
     /* reverse */
     phi_r = sc[32];
-    Kc = refCinv * exp(g_RT[11] + g_RT[18] - g_RT[32]);
+    Kc = Kc_s[123];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[18]) + (h_RT[32]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24767,12 +24345,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[18];
-    k_f = prefactor_units[124] * fwd_A[124]
-                * exp(fwd_beta[124] * tc[0] - activation_units[124] * fwd_Ea[124] * invT);
+    k_f = k_f_s[124];
     dlnkfdT = fwd_beta[124] * invT + activation_units[124] * fwd_Ea[124] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[26];
-    Kc = exp(-g_RT[0] + g_RT[10] + g_RT[18] - g_RT[26]);
+    Kc = Kc_s[124];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[18]) + (h_RT[0] + h_RT[26]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24818,12 +24395,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[18]*sc[18];
-    k_f = prefactor_units[125] * fwd_A[125]
-                * exp(fwd_beta[125] * tc[0] - activation_units[125] * fwd_Ea[125] * invT);
+    k_f = k_f_s[125];
     dlnkfdT = fwd_beta[125] * invT + activation_units[125] * fwd_Ea[125] * invT2;
     /* reverse */
     phi_r = sc[17]*sc[19];
-    Kc = exp(-g_RT[17] + 2*g_RT[18] - g_RT[19]);
+    Kc = Kc_s[125];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[18]) + (h_RT[17] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24858,12 +24434,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[21];
-    k_f = prefactor_units[126] * fwd_A[126]
-                * exp(fwd_beta[126] * tc[0] - activation_units[126] * fwd_Ea[126] * invT);
+    k_f = k_f_s[126];
     dlnkfdT = fwd_beta[126] * invT + activation_units[126] * fwd_Ea[126] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[11];
-    Kc = exp(g_RT[0] - g_RT[10] - g_RT[11] + g_RT[21]);
+    Kc = Kc_s[126];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[21]) + (h_RT[10] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24909,12 +24484,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[21];
-    k_f = prefactor_units[127] * fwd_A[127]
-                * exp(fwd_beta[127] * tc[0] - activation_units[127] * fwd_Ea[127] * invT);
+    k_f = k_f_s[127];
     dlnkfdT = fwd_beta[127] * invT + activation_units[127] * fwd_Ea[127] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[14];
-    Kc = exp(g_RT[1] - g_RT[10] - g_RT[14] + g_RT[21]);
+    Kc = Kc_s[127];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[21]) + (h_RT[10] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -24960,12 +24534,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[21];
-    k_f = prefactor_units[128] * fwd_A[128]
-                * exp(fwd_beta[128] * tc[0] - activation_units[128] * fwd_Ea[128] * invT);
+    k_f = k_f_s[128];
     dlnkfdT = fwd_beta[128] * invT + activation_units[128] * fwd_Ea[128] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[10]*sc[13];
-    Kc = refC * exp(g_RT[2] - g_RT[2] - g_RT[10] - g_RT[13] + g_RT[21]);
+    Kc = Kc_s[128];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[21]) + (h_RT[2] + h_RT[10] + h_RT[13]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25005,12 +24578,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[21];
-    k_f = prefactor_units[129] * fwd_A[129]
-                * exp(fwd_beta[129] * tc[0] - activation_units[129] * fwd_Ea[129] * invT);
+    k_f = k_f_s[129];
     dlnkfdT = fwd_beta[129] * invT + activation_units[129] * fwd_Ea[129] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[10]*sc[14];
-    Kc = refC * exp(-g_RT[2] + g_RT[3] - g_RT[10] - g_RT[14] + g_RT[21]);
+    Kc = Kc_s[129];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[21]) + (h_RT[2] + h_RT[10] + h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25069,12 +24641,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[22];
-    k_f = prefactor_units[130] * fwd_A[130]
-                * exp(fwd_beta[130] * tc[0] - activation_units[130] * fwd_Ea[130] * invT);
+    k_f = k_f_s[130];
     dlnkfdT = fwd_beta[130] * invT + activation_units[130] * fwd_Ea[130] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[21];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[130];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[22]) + (h_RT[4] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25120,12 +24691,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[22];
-    k_f = prefactor_units[131] * fwd_A[131]
-                * exp(fwd_beta[131] * tc[0] - activation_units[131] * fwd_Ea[131] * invT);
+    k_f = k_f_s[131];
     dlnkfdT = fwd_beta[131] * invT + activation_units[131] * fwd_Ea[131] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[21];
-    Kc = exp(g_RT[1] - g_RT[2] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[131];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[22]) + (h_RT[2] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25171,12 +24741,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[22];
-    k_f = prefactor_units[132] * fwd_A[132]
-                * exp(fwd_beta[132] * tc[0] - activation_units[132] * fwd_Ea[132] * invT);
+    k_f = k_f_s[132];
     dlnkfdT = fwd_beta[132] * invT + activation_units[132] * fwd_Ea[132] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[21];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[132];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[22]) + (h_RT[5] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25222,12 +24791,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[22];
-    k_f = prefactor_units[133] * fwd_A[133]
-                * exp(fwd_beta[133] * tc[0] - activation_units[133] * fwd_Ea[133] * invT);
+    k_f = k_f_s[133];
     dlnkfdT = fwd_beta[133] * invT + activation_units[133] * fwd_Ea[133] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[21];
-    Kc = exp(-g_RT[3] + g_RT[6] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[133];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[22]) + (h_RT[3] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25273,12 +24841,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[19];
-    k_f = prefactor_units[134] * fwd_A[134]
-                * exp(fwd_beta[134] * tc[0] - activation_units[134] * fwd_Ea[134] * invT);
+    k_f = k_f_s[134];
     dlnkfdT = fwd_beta[134] * invT + activation_units[134] * fwd_Ea[134] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[18];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[18] + g_RT[19]);
+    Kc = Kc_s[134];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[19]) + (h_RT[4] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25324,12 +24891,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[135] * fwd_A[135]
-                * exp(fwd_beta[135] * tc[0] - activation_units[135] * fwd_Ea[135] * invT);
+    k_f = k_f_s[135];
     dlnkfdT = fwd_beta[135] * invT + activation_units[135] * fwd_Ea[135] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[18];
-    Kc = exp(g_RT[1] - g_RT[2] - g_RT[18] + g_RT[19]);
+    Kc = Kc_s[135];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[2] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25375,12 +24941,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[136] * fwd_A[136]
-                * exp(fwd_beta[136] * tc[0] - activation_units[136] * fwd_Ea[136] * invT);
+    k_f = k_f_s[136];
     dlnkfdT = fwd_beta[136] * invT + activation_units[136] * fwd_Ea[136] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[11];
-    Kc = exp(g_RT[1] - g_RT[10] - g_RT[11] + g_RT[19]);
+    Kc = Kc_s[136];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[10] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25426,12 +24991,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[137] * fwd_A[137]
-                * exp(fwd_beta[137] * tc[0] - activation_units[137] * fwd_Ea[137] * invT);
+    k_f = k_f_s[137];
     dlnkfdT = fwd_beta[137] * invT + activation_units[137] * fwd_Ea[137] * invT2;
     /* reverse */
     phi_r = sc[8]*sc[12];
-    Kc = exp(g_RT[1] - g_RT[8] - g_RT[12] + g_RT[19]);
+    Kc = Kc_s[137];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[8] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25477,12 +25041,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[19];
-    k_f = prefactor_units[138] * fwd_A[138]
-                * exp(fwd_beta[138] * tc[0] - activation_units[138] * fwd_Ea[138] * invT);
+    k_f = k_f_s[138];
     dlnkfdT = fwd_beta[138] * invT + activation_units[138] * fwd_Ea[138] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[18];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[18] + g_RT[19]);
+    Kc = Kc_s[138];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[19]) + (h_RT[5] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25528,12 +25091,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[19];
-    k_f = prefactor_units[139] * fwd_A[139]
-                * exp(fwd_beta[139] * tc[0] - activation_units[139] * fwd_Ea[139] * invT);
+    k_f = k_f_s[139];
     dlnkfdT = fwd_beta[139] * invT + activation_units[139] * fwd_Ea[139] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[25];
-    Kc = exp(-g_RT[0] + g_RT[7] + g_RT[19] - g_RT[25]);
+    Kc = Kc_s[139];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[19]) + (h_RT[0] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25579,12 +25141,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[19];
-    k_f = prefactor_units[140] * fwd_A[140]
-                * exp(fwd_beta[140] * tc[0] - activation_units[140] * fwd_Ea[140] * invT);
+    k_f = k_f_s[140];
     dlnkfdT = fwd_beta[140] * invT + activation_units[140] * fwd_Ea[140] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[24];
-    Kc = exp(-g_RT[0] + g_RT[7] + g_RT[19] - g_RT[24]);
+    Kc = Kc_s[140];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[19]) + (h_RT[0] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25630,12 +25191,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[19];
-    k_f = prefactor_units[141] * fwd_A[141]
-                * exp(fwd_beta[141] * tc[0] - activation_units[141] * fwd_Ea[141] * invT);
+    k_f = k_f_s[141];
     dlnkfdT = fwd_beta[141] * invT + activation_units[141] * fwd_Ea[141] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[26];
-    Kc = exp(-g_RT[0] + g_RT[8] + g_RT[19] - g_RT[26]);
+    Kc = Kc_s[141];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[19]) + (h_RT[0] + h_RT[26]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25681,12 +25241,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[19];
-    k_f = prefactor_units[142] * fwd_A[142]
-                * exp(fwd_beta[142] * tc[0] - activation_units[142] * fwd_Ea[142] * invT);
+    k_f = k_f_s[142];
     dlnkfdT = fwd_beta[142] * invT + activation_units[142] * fwd_Ea[142] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[26];
-    Kc = exp(-g_RT[0] + g_RT[9] + g_RT[19] - g_RT[26]);
+    Kc = Kc_s[142];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[19]) + (h_RT[0] + h_RT[26]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25732,12 +25291,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[19];
-    k_f = prefactor_units[143] * fwd_A[143]
-                * exp(fwd_beta[143] * tc[0] - activation_units[143] * fwd_Ea[143] * invT);
+    k_f = k_f_s[143];
     dlnkfdT = fwd_beta[143] * invT + activation_units[143] * fwd_Ea[143] * invT2;
     /* reverse */
     phi_r = sc[29];
-    Kc = refCinv * exp(g_RT[10] + g_RT[19] - g_RT[29]);
+    Kc = Kc_s[143];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[19]) + (h_RT[29]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25772,12 +25330,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[19];
-    k_f = prefactor_units[144] * fwd_A[144]
-                * exp(fwd_beta[144] * tc[0] - activation_units[144] * fwd_Ea[144] * invT);
+    k_f = k_f_s[144];
     dlnkfdT = fwd_beta[144] * invT + activation_units[144] * fwd_Ea[144] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[18];
-    Kc = exp(-g_RT[3] + g_RT[6] - g_RT[18] + g_RT[19]);
+    Kc = Kc_s[144];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[19]) + (h_RT[3] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25823,12 +25380,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[23];
-    k_f = prefactor_units[145] * fwd_A[145]
-                * exp(fwd_beta[145] * tc[0] - activation_units[145] * fwd_Ea[145] * invT);
+    k_f = k_f_s[145];
     dlnkfdT = fwd_beta[145] * invT + activation_units[145] * fwd_Ea[145] * invT2;
     /* reverse */
     phi_r = sc[24];
-    Kc = refCinv * exp(g_RT[0] + g_RT[23] - g_RT[24]);
+    Kc = Kc_s[145];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[23]) + (h_RT[24]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25863,12 +25419,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[23];
-    k_f = prefactor_units[146] * fwd_A[146]
-                * exp(fwd_beta[146] * tc[0] - activation_units[146] * fwd_Ea[146] * invT);
+    k_f = k_f_s[146];
     dlnkfdT = fwd_beta[146] * invT + activation_units[146] * fwd_Ea[146] * invT2;
     /* reverse */
     phi_r = sc[25];
-    Kc = refCinv * exp(g_RT[0] + g_RT[23] - g_RT[25]);
+    Kc = Kc_s[146];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[23]) + (h_RT[25]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25903,12 +25458,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[23];
-    k_f = prefactor_units[147] * fwd_A[147]
-                * exp(fwd_beta[147] * tc[0] - activation_units[147] * fwd_Ea[147] * invT);
+    k_f = k_f_s[147];
     dlnkfdT = fwd_beta[147] * invT + activation_units[147] * fwd_Ea[147] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[16];
-    Kc = exp(g_RT[1] - g_RT[12] - g_RT[16] + g_RT[23]);
+    Kc = Kc_s[147];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[23]) + (h_RT[12] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -25954,12 +25508,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[23];
-    k_f = prefactor_units[148] * fwd_A[148]
-                * exp(fwd_beta[148] * tc[0] - activation_units[148] * fwd_Ea[148] * invT);
+    k_f = k_f_s[148];
     dlnkfdT = fwd_beta[148] * invT + activation_units[148] * fwd_Ea[148] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[13]*sc[18];
-    Kc = refC * exp(-g_RT[2] + g_RT[3] - g_RT[13] - g_RT[18] + g_RT[23]);
+    Kc = Kc_s[148];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[23]) + (h_RT[2] + h_RT[13] + h_RT[18]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26018,12 +25571,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[23];
-    k_f = prefactor_units[149] * fwd_A[149]
-                * exp(fwd_beta[149] * tc[0] - activation_units[149] * fwd_Ea[149] * invT);
+    k_f = k_f_s[149];
     dlnkfdT = fwd_beta[149] * invT + activation_units[149] * fwd_Ea[149] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[25];
-    Kc = exp(g_RT[3] - g_RT[6] + g_RT[23] - g_RT[25]);
+    Kc = Kc_s[149];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[23]) + (h_RT[6] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26069,12 +25621,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[23];
-    k_f = prefactor_units[150] * fwd_A[150]
-                * exp(fwd_beta[150] * tc[0] - activation_units[150] * fwd_Ea[150] * invT);
+    k_f = k_f_s[150];
     dlnkfdT = fwd_beta[150] * invT + activation_units[150] * fwd_Ea[150] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[24];
-    Kc = exp(g_RT[3] - g_RT[6] + g_RT[23] - g_RT[24]);
+    Kc = Kc_s[150];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[23]) + (h_RT[6] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26120,12 +25671,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[23];
-    k_f = prefactor_units[151] * fwd_A[151]
-                * exp(fwd_beta[151] * tc[0] - activation_units[151] * fwd_Ea[151] * invT);
+    k_f = k_f_s[151];
     dlnkfdT = fwd_beta[151] * invT + activation_units[151] * fwd_Ea[151] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[25];
-    Kc = exp(g_RT[11] - g_RT[13] + g_RT[23] - g_RT[25]);
+    Kc = Kc_s[151];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[23]) + (h_RT[13] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26171,12 +25721,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[23];
-    k_f = prefactor_units[152] * fwd_A[152]
-                * exp(fwd_beta[152] * tc[0] - activation_units[152] * fwd_Ea[152] * invT);
+    k_f = k_f_s[152];
     dlnkfdT = fwd_beta[152] * invT + activation_units[152] * fwd_Ea[152] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[24];
-    Kc = exp(g_RT[11] - g_RT[13] + g_RT[23] - g_RT[24]);
+    Kc = Kc_s[152];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[23]) + (h_RT[13] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26222,12 +25771,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[25];
-    k_f = prefactor_units[153] * fwd_A[153]
-                * exp(fwd_beta[153] * tc[0] - activation_units[153] * fwd_Ea[153] * invT);
+    k_f = k_f_s[153];
     dlnkfdT = fwd_beta[153] * invT + activation_units[153] * fwd_Ea[153] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[23];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[23] + g_RT[25]);
+    Kc = Kc_s[153];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[25]) + (h_RT[4] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26273,12 +25821,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[25];
-    k_f = prefactor_units[154] * fwd_A[154]
-                * exp(fwd_beta[154] * tc[0] - activation_units[154] * fwd_Ea[154] * invT);
+    k_f = k_f_s[154];
     dlnkfdT = fwd_beta[154] * invT + activation_units[154] * fwd_Ea[154] * invT2;
     /* reverse */
     phi_r = sc[27];
-    Kc = refCinv * exp(g_RT[0] + g_RT[25] - g_RT[27]);
+    Kc = Kc_s[154];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[25]) + (h_RT[27]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26313,12 +25860,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[25];
-    k_f = prefactor_units[155] * fwd_A[155]
-                * exp(fwd_beta[155] * tc[0] - activation_units[155] * fwd_Ea[155] * invT);
+    k_f = k_f_s[155];
     dlnkfdT = fwd_beta[155] * invT + activation_units[155] * fwd_Ea[155] * invT2;
     /* reverse */
     phi_r = sc[26];
-    Kc = refCinv * exp(g_RT[0] + g_RT[25] - g_RT[26]);
+    Kc = Kc_s[155];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[25]) + (h_RT[26]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26353,12 +25899,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[25];
-    k_f = prefactor_units[156] * fwd_A[156]
-                * exp(fwd_beta[156] * tc[0] - activation_units[156] * fwd_Ea[156] * invT);
+    k_f = k_f_s[156];
     dlnkfdT = fwd_beta[156] * invT + activation_units[156] * fwd_Ea[156] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[19];
-    Kc = exp(g_RT[1] - g_RT[13] - g_RT[19] + g_RT[25]);
+    Kc = Kc_s[156];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[25]) + (h_RT[13] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26404,12 +25949,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[25];
-    k_f = prefactor_units[157] * fwd_A[157]
-                * exp(fwd_beta[157] * tc[0] - activation_units[157] * fwd_Ea[157] * invT);
+    k_f = k_f_s[157];
     dlnkfdT = fwd_beta[157] * invT + activation_units[157] * fwd_Ea[157] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[23];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[23] + g_RT[25]);
+    Kc = Kc_s[157];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[25]) + (h_RT[5] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26455,12 +25999,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[25];
-    k_f = prefactor_units[158] * fwd_A[158]
-                * exp(fwd_beta[158] * tc[0] - activation_units[158] * fwd_Ea[158] * invT);
+    k_f = k_f_s[158];
     dlnkfdT = fwd_beta[158] * invT + activation_units[158] * fwd_Ea[158] * invT2;
     /* reverse */
     phi_r = sc[17]*sc[23];
-    Kc = exp(g_RT[16] - g_RT[17] - g_RT[23] + g_RT[25]);
+    Kc = Kc_s[158];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[25]) + (h_RT[17] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26506,12 +26049,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[24];
-    k_f = prefactor_units[159] * fwd_A[159]
-                * exp(fwd_beta[159] * tc[0] - activation_units[159] * fwd_Ea[159] * invT);
+    k_f = k_f_s[159];
     dlnkfdT = fwd_beta[159] * invT + activation_units[159] * fwd_Ea[159] * invT2;
     /* reverse */
     phi_r = sc[25];
-    Kc = exp(g_RT[24] - g_RT[25]);
+    Kc = Kc_s[159];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[24]) + (h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26537,12 +26079,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[24];
-    k_f = prefactor_units[160] * fwd_A[160]
-                * exp(fwd_beta[160] * tc[0] - activation_units[160] * fwd_Ea[160] * invT);
+    k_f = k_f_s[160];
     dlnkfdT = fwd_beta[160] * invT + activation_units[160] * fwd_Ea[160] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[25];
-    Kc = exp(g_RT[0] - g_RT[0] + g_RT[24] - g_RT[25]);
+    Kc = Kc_s[160];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[24]) + (h_RT[0] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26572,12 +26113,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[24];
-    k_f = prefactor_units[161] * fwd_A[161]
-                * exp(fwd_beta[161] * tc[0] - activation_units[161] * fwd_Ea[161] * invT);
+    k_f = k_f_s[161];
     dlnkfdT = fwd_beta[161] * invT + activation_units[161] * fwd_Ea[161] * invT2;
     /* reverse */
     phi_r = sc[27];
-    Kc = refCinv * exp(g_RT[0] + g_RT[24] - g_RT[27]);
+    Kc = Kc_s[161];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[24]) + (h_RT[27]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26612,12 +26152,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[24];
-    k_f = prefactor_units[162] * fwd_A[162]
-                * exp(fwd_beta[162] * tc[0] - activation_units[162] * fwd_Ea[162] * invT);
+    k_f = k_f_s[162];
     dlnkfdT = fwd_beta[162] * invT + activation_units[162] * fwd_Ea[162] * invT2;
     /* reverse */
     phi_r = sc[26];
-    Kc = refCinv * exp(g_RT[0] + g_RT[24] - g_RT[26]);
+    Kc = Kc_s[162];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[24]) + (h_RT[26]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26652,12 +26191,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[24];
-    k_f = prefactor_units[163] * fwd_A[163]
-                * exp(fwd_beta[163] * tc[0] - activation_units[163] * fwd_Ea[163] * invT);
+    k_f = k_f_s[163];
     dlnkfdT = fwd_beta[163] * invT + activation_units[163] * fwd_Ea[163] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[23];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[23] + g_RT[24]);
+    Kc = Kc_s[163];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[24]) + (h_RT[4] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26703,12 +26241,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[23]*sc[24];
-    k_f = prefactor_units[164] * fwd_A[164]
-                * exp(fwd_beta[164] * tc[0] - activation_units[164] * fwd_Ea[164] * invT);
+    k_f = k_f_s[164];
     dlnkfdT = fwd_beta[164] * invT + activation_units[164] * fwd_Ea[164] * invT2;
     /* reverse */
     phi_r = sc[23]*sc[25];
-    Kc = exp(g_RT[23] - g_RT[23] + g_RT[24] - g_RT[25]);
+    Kc = Kc_s[164];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[23] + h_RT[24]) + (h_RT[23] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26738,12 +26275,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[24];
-    k_f = prefactor_units[165] * fwd_A[165]
-                * exp(fwd_beta[165] * tc[0] - activation_units[165] * fwd_Ea[165] * invT);
+    k_f = k_f_s[165];
     dlnkfdT = fwd_beta[165] * invT + activation_units[165] * fwd_Ea[165] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[20];
-    Kc = exp(g_RT[1] - g_RT[10] - g_RT[20] + g_RT[24]);
+    Kc = Kc_s[165];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[24]) + (h_RT[10] + h_RT[20]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26789,12 +26325,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[24];
-    k_f = prefactor_units[166] * fwd_A[166]
-                * exp(fwd_beta[166] * tc[0] - activation_units[166] * fwd_Ea[166] * invT);
+    k_f = k_f_s[166];
     dlnkfdT = fwd_beta[166] * invT + activation_units[166] * fwd_Ea[166] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[19];
-    Kc = exp(g_RT[1] - g_RT[13] - g_RT[19] + g_RT[24]);
+    Kc = Kc_s[166];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[24]) + (h_RT[13] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26840,12 +26375,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[24];
-    k_f = prefactor_units[167] * fwd_A[167]
-                * exp(fwd_beta[167] * tc[0] - activation_units[167] * fwd_Ea[167] * invT);
+    k_f = k_f_s[167];
     dlnkfdT = fwd_beta[167] * invT + activation_units[167] * fwd_Ea[167] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[23];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[23] + g_RT[24]);
+    Kc = Kc_s[167];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[24]) + (h_RT[5] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26891,12 +26425,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[24];
-    k_f = prefactor_units[168] * fwd_A[168]
-                * exp(fwd_beta[168] * tc[0] - activation_units[168] * fwd_Ea[168] * invT);
+    k_f = k_f_s[168];
     dlnkfdT = fwd_beta[168] * invT + activation_units[168] * fwd_Ea[168] * invT2;
     /* reverse */
     phi_r = sc[17]*sc[23];
-    Kc = exp(g_RT[16] - g_RT[17] - g_RT[23] + g_RT[24]);
+    Kc = Kc_s[168];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[24]) + (h_RT[17] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26942,12 +26475,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[26];
-    k_f = prefactor_units[169] * fwd_A[169]
-                * exp(fwd_beta[169] * tc[0] - activation_units[169] * fwd_Ea[169] * invT);
+    k_f = k_f_s[169];
     dlnkfdT = fwd_beta[169] * invT + activation_units[169] * fwd_Ea[169] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[25];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[25] + g_RT[26]);
+    Kc = Kc_s[169];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[26]) + (h_RT[4] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -26993,12 +26525,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[26];
-    k_f = prefactor_units[170] * fwd_A[170]
-                * exp(fwd_beta[170] * tc[0] - activation_units[170] * fwd_Ea[170] * invT);
+    k_f = k_f_s[170];
     dlnkfdT = fwd_beta[170] * invT + activation_units[170] * fwd_Ea[170] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[32];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[26] - g_RT[32]);
+    Kc = Kc_s[170];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[26]) + (h_RT[0] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27044,12 +26575,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[26];
-    k_f = prefactor_units[171] * fwd_A[171]
-                * exp(fwd_beta[171] * tc[0] - activation_units[171] * fwd_Ea[171] * invT);
+    k_f = k_f_s[171];
     dlnkfdT = fwd_beta[171] * invT + activation_units[171] * fwd_Ea[171] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[0]*sc[32];
-    Kc = refC * exp(-2*g_RT[0] + g_RT[2] + g_RT[26] - g_RT[32]);
+    Kc = Kc_s[171];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[26]) + (2*h_RT[0] + h_RT[32]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27095,12 +26625,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[26];
-    k_f = prefactor_units[172] * fwd_A[172]
-                * exp(fwd_beta[172] * tc[0] - activation_units[172] * fwd_Ea[172] * invT);
+    k_f = k_f_s[172];
     dlnkfdT = fwd_beta[172] * invT + activation_units[172] * fwd_Ea[172] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[25];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[25] + g_RT[26]);
+    Kc = Kc_s[172];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[26]) + (h_RT[5] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27146,12 +26675,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[26];
-    k_f = prefactor_units[173] * fwd_A[173]
-                * exp(fwd_beta[173] * tc[0] - activation_units[173] * fwd_Ea[173] * invT);
+    k_f = k_f_s[173];
     dlnkfdT = fwd_beta[173] * invT + activation_units[173] * fwd_Ea[173] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[25];
-    Kc = exp(-g_RT[3] + g_RT[6] - g_RT[25] + g_RT[26]);
+    Kc = Kc_s[173];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[26]) + (h_RT[3] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27197,12 +26725,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[26];
-    k_f = prefactor_units[174] * fwd_A[174]
-                * exp(fwd_beta[174] * tc[0] - activation_units[174] * fwd_Ea[174] * invT);
+    k_f = k_f_s[174];
     dlnkfdT = fwd_beta[174] * invT + activation_units[174] * fwd_Ea[174] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[21];
-    Kc = exp(g_RT[6] - g_RT[12] - g_RT[21] + g_RT[26]);
+    Kc = Kc_s[174];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[26]) + (h_RT[12] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27248,12 +26775,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[26];
-    k_f = prefactor_units[175] * fwd_A[175]
-                * exp(fwd_beta[175] * tc[0] - activation_units[175] * fwd_Ea[175] * invT);
+    k_f = k_f_s[175];
     dlnkfdT = fwd_beta[175] * invT + activation_units[175] * fwd_Ea[175] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[32];
-    Kc = exp(-g_RT[2] + g_RT[6] + g_RT[26] - g_RT[32]);
+    Kc = Kc_s[175];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[26]) + (h_RT[2] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27299,12 +26825,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[26];
-    k_f = prefactor_units[176] * fwd_A[176]
-                * exp(fwd_beta[176] * tc[0] - activation_units[176] * fwd_Ea[176] * invT);
+    k_f = k_f_s[176];
     dlnkfdT = fwd_beta[176] * invT + activation_units[176] * fwd_Ea[176] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[28];
-    Kc = exp(g_RT[3] - g_RT[6] + g_RT[26] - g_RT[28]);
+    Kc = Kc_s[176];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[26]) + (h_RT[6] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27350,12 +26875,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[26];
-    k_f = prefactor_units[177] * fwd_A[177]
-                * exp(fwd_beta[177] * tc[0] - activation_units[177] * fwd_Ea[177] * invT);
+    k_f = k_f_s[177];
     dlnkfdT = fwd_beta[177] * invT + activation_units[177] * fwd_Ea[177] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[12]*sc[18];
-    Kc = refC * exp(-g_RT[2] + g_RT[3] - g_RT[12] - g_RT[18] + g_RT[26]);
+    Kc = Kc_s[177];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[26]) + (h_RT[2] + h_RT[12] + h_RT[18]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27414,12 +26938,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[26];
-    k_f = prefactor_units[178] * fwd_A[178]
-                * exp(fwd_beta[178] * tc[0] - activation_units[178] * fwd_Ea[178] * invT);
+    k_f = k_f_s[178];
     dlnkfdT = fwd_beta[178] * invT + activation_units[178] * fwd_Ea[178] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[28];
-    Kc = exp(g_RT[11] - g_RT[13] + g_RT[26] - g_RT[28]);
+    Kc = Kc_s[178];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[26]) + (h_RT[13] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27465,12 +26988,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[26];
-    k_f = prefactor_units[179] * fwd_A[179]
-                * exp(fwd_beta[179] * tc[0] - activation_units[179] * fwd_Ea[179] * invT);
+    k_f = k_f_s[179];
     dlnkfdT = fwd_beta[179] * invT + activation_units[179] * fwd_Ea[179] * invT2;
     /* reverse */
     phi_r = sc[27];
-    Kc = exp(g_RT[26] - g_RT[27]);
+    Kc = Kc_s[179];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[26]) + (h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27496,12 +27018,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[27];
-    k_f = prefactor_units[180] * fwd_A[180]
-                * exp(fwd_beta[180] * tc[0] - activation_units[180] * fwd_Ea[180] * invT);
+    k_f = k_f_s[180];
     dlnkfdT = fwd_beta[180] * invT + activation_units[180] * fwd_Ea[180] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[24];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[24] + g_RT[27]);
+    Kc = Kc_s[180];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[27]) + (h_RT[4] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27547,12 +27068,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[27];
-    k_f = prefactor_units[181] * fwd_A[181]
-                * exp(fwd_beta[181] * tc[0] - activation_units[181] * fwd_Ea[181] * invT);
+    k_f = k_f_s[181];
     dlnkfdT = fwd_beta[181] * invT + activation_units[181] * fwd_Ea[181] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[21];
-    Kc = exp(g_RT[6] - g_RT[12] - g_RT[21] + g_RT[27]);
+    Kc = Kc_s[181];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[27]) + (h_RT[12] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27598,12 +27118,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[27];
-    k_f = prefactor_units[182] * fwd_A[182]
-                * exp(fwd_beta[182] * tc[0] - activation_units[182] * fwd_Ea[182] * invT);
+    k_f = k_f_s[182];
     dlnkfdT = fwd_beta[182] * invT + activation_units[182] * fwd_Ea[182] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[28];
-    Kc = exp(g_RT[11] - g_RT[13] + g_RT[27] - g_RT[28]);
+    Kc = Kc_s[182];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[27]) + (h_RT[13] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27649,12 +27168,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[28];
-    k_f = prefactor_units[183] * fwd_A[183]
-                * exp(fwd_beta[183] * tc[0] - activation_units[183] * fwd_Ea[183] * invT);
+    k_f = k_f_s[183];
     dlnkfdT = fwd_beta[183] * invT + activation_units[183] * fwd_Ea[183] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[19];
-    Kc = exp(g_RT[0] - g_RT[10] - g_RT[19] + g_RT[28]);
+    Kc = Kc_s[183];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[28]) + (h_RT[10] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27700,12 +27218,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[28];
-    k_f = prefactor_units[184] * fwd_A[184]
-                * exp(fwd_beta[184] * tc[0] - activation_units[184] * fwd_Ea[184] * invT);
+    k_f = k_f_s[184];
     dlnkfdT = fwd_beta[184] * invT + activation_units[184] * fwd_Ea[184] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[26];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[26] + g_RT[28]);
+    Kc = Kc_s[184];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[28]) + (h_RT[4] + h_RT[26]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27751,12 +27268,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[28];
-    k_f = prefactor_units[185] * fwd_A[185]
-                * exp(fwd_beta[185] * tc[0] - activation_units[185] * fwd_Ea[185] * invT);
+    k_f = k_f_s[185];
     dlnkfdT = fwd_beta[185] * invT + activation_units[185] * fwd_Ea[185] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[27];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[27] + g_RT[28]);
+    Kc = Kc_s[185];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[28]) + (h_RT[4] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27802,12 +27318,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[28];
-    k_f = prefactor_units[186] * fwd_A[186]
-                * exp(fwd_beta[186] * tc[0] - activation_units[186] * fwd_Ea[186] * invT);
+    k_f = k_f_s[186];
     dlnkfdT = fwd_beta[186] * invT + activation_units[186] * fwd_Ea[186] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[0]*sc[32];
-    Kc = refC * exp(-2*g_RT[0] + g_RT[1] + g_RT[28] - g_RT[32]);
+    Kc = Kc_s[186];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[28]) + (2*h_RT[0] + h_RT[32]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27853,12 +27368,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[28];
-    k_f = prefactor_units[187] * fwd_A[187]
-                * exp(fwd_beta[187] * tc[0] - activation_units[187] * fwd_Ea[187] * invT);
+    k_f = k_f_s[187];
     dlnkfdT = fwd_beta[187] * invT + activation_units[187] * fwd_Ea[187] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[26];
-    Kc = exp(g_RT[1] - g_RT[2] - g_RT[26] + g_RT[28]);
+    Kc = Kc_s[187];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[28]) + (h_RT[2] + h_RT[26]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27904,12 +27418,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[28];
-    k_f = prefactor_units[188] * fwd_A[188]
-                * exp(fwd_beta[188] * tc[0] - activation_units[188] * fwd_Ea[188] * invT);
+    k_f = k_f_s[188];
     dlnkfdT = fwd_beta[188] * invT + activation_units[188] * fwd_Ea[188] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[27];
-    Kc = exp(g_RT[1] - g_RT[2] - g_RT[27] + g_RT[28]);
+    Kc = Kc_s[188];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[28]) + (h_RT[2] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -27955,12 +27468,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[28];
-    k_f = prefactor_units[189] * fwd_A[189]
-                * exp(fwd_beta[189] * tc[0] - activation_units[189] * fwd_Ea[189] * invT);
+    k_f = k_f_s[189];
     dlnkfdT = fwd_beta[189] * invT + activation_units[189] * fwd_Ea[189] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[26];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[26] + g_RT[28]);
+    Kc = Kc_s[189];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[28]) + (h_RT[5] + h_RT[26]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28006,12 +27518,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[28];
-    k_f = prefactor_units[190] * fwd_A[190]
-                * exp(fwd_beta[190] * tc[0] - activation_units[190] * fwd_Ea[190] * invT);
+    k_f = k_f_s[190];
     dlnkfdT = fwd_beta[190] * invT + activation_units[190] * fwd_Ea[190] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[27];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[27] + g_RT[28]);
+    Kc = Kc_s[190];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[28]) + (h_RT[5] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28057,12 +27568,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[32];
-    k_f = prefactor_units[191] * fwd_A[191]
-                * exp(fwd_beta[191] * tc[0] - activation_units[191] * fwd_Ea[191] * invT);
+    k_f = k_f_s[191];
     dlnkfdT = fwd_beta[191] * invT + activation_units[191] * fwd_Ea[191] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[19];
-    Kc = exp(g_RT[0] - g_RT[11] - g_RT[19] + g_RT[32]);
+    Kc = Kc_s[191];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[32]) + (h_RT[11] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28108,12 +27618,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[32];
-    k_f = prefactor_units[192] * fwd_A[192]
-                * exp(fwd_beta[192] * tc[0] - activation_units[192] * fwd_Ea[192] * invT);
+    k_f = k_f_s[192];
     dlnkfdT = fwd_beta[192] * invT + activation_units[192] * fwd_Ea[192] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[13]*sc[18];
-    Kc = refC * exp(g_RT[1] - g_RT[2] - g_RT[13] - g_RT[18] + g_RT[32]);
+    Kc = Kc_s[192];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[32]) + (h_RT[2] + h_RT[13] + h_RT[18]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28172,12 +27681,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[32];
-    k_f = prefactor_units[193] * fwd_A[193]
-                * exp(fwd_beta[193] * tc[0] - activation_units[193] * fwd_Ea[193] * invT);
+    k_f = k_f_s[193];
     dlnkfdT = fwd_beta[193] * invT + activation_units[193] * fwd_Ea[193] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[13]*sc[18];
-    Kc = refC * exp(g_RT[2] - g_RT[5] - g_RT[13] - g_RT[18] + g_RT[32]);
+    Kc = Kc_s[193];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[32]) + (h_RT[5] + h_RT[13] + h_RT[18]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28236,12 +27744,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[30];
-    k_f = prefactor_units[194] * fwd_A[194]
-                * exp(fwd_beta[194] * tc[0] - activation_units[194] * fwd_Ea[194] * invT);
+    k_f = k_f_s[194];
     dlnkfdT = fwd_beta[194] * invT + activation_units[194] * fwd_Ea[194] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[28];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[28] + g_RT[30]);
+    Kc = Kc_s[194];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[30]) + (h_RT[4] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28287,12 +27794,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[30];
-    k_f = prefactor_units[195] * fwd_A[195]
-                * exp(fwd_beta[195] * tc[0] - activation_units[195] * fwd_Ea[195] * invT);
+    k_f = k_f_s[195];
     dlnkfdT = fwd_beta[195] * invT + activation_units[195] * fwd_Ea[195] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[22];
-    Kc = exp(g_RT[1] - g_RT[10] - g_RT[22] + g_RT[30]);
+    Kc = Kc_s[195];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[30]) + (h_RT[10] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28338,12 +27844,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[30];
-    k_f = prefactor_units[196] * fwd_A[196]
-                * exp(fwd_beta[196] * tc[0] - activation_units[196] * fwd_Ea[196] * invT);
+    k_f = k_f_s[196];
     dlnkfdT = fwd_beta[196] * invT + activation_units[196] * fwd_Ea[196] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[28];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[28] + g_RT[30]);
+    Kc = Kc_s[196];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[30]) + (h_RT[5] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28389,12 +27894,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[30];
-    k_f = prefactor_units[197] * fwd_A[197]
-                * exp(fwd_beta[197] * tc[0] - activation_units[197] * fwd_Ea[197] * invT);
+    k_f = k_f_s[197];
     dlnkfdT = fwd_beta[197] * invT + activation_units[197] * fwd_Ea[197] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[28];
-    Kc = exp(-g_RT[3] + g_RT[6] - g_RT[28] + g_RT[30]);
+    Kc = Kc_s[197];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[30]) + (h_RT[3] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28440,12 +27944,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[30];
-    k_f = prefactor_units[198] * fwd_A[198]
-                * exp(fwd_beta[198] * tc[0] - activation_units[198] * fwd_Ea[198] * invT);
+    k_f = k_f_s[198];
     dlnkfdT = fwd_beta[198] * invT + activation_units[198] * fwd_Ea[198] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[10]*sc[22];
-    Kc = refC * exp(-g_RT[2] + g_RT[3] - g_RT[10] - g_RT[22] + g_RT[30]);
+    Kc = Kc_s[198];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[30]) + (h_RT[2] + h_RT[10] + h_RT[22]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28504,12 +28007,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[30];
-    k_f = prefactor_units[199] * fwd_A[199]
-                * exp(fwd_beta[199] * tc[0] - activation_units[199] * fwd_Ea[199] * invT);
+    k_f = k_f_s[199];
     dlnkfdT = fwd_beta[199] * invT + activation_units[199] * fwd_Ea[199] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[31];
-    Kc = exp(g_RT[11] - g_RT[13] + g_RT[30] - g_RT[31]);
+    Kc = Kc_s[199];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[30]) + (h_RT[13] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28555,12 +28057,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[29];
-    k_f = prefactor_units[200] * fwd_A[200]
-                * exp(fwd_beta[200] * tc[0] - activation_units[200] * fwd_Ea[200] * invT);
+    k_f = k_f_s[200];
     dlnkfdT = fwd_beta[200] * invT + activation_units[200] * fwd_Ea[200] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[28];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[28] + g_RT[29]);
+    Kc = Kc_s[200];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[29]) + (h_RT[4] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28606,12 +28107,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[29];
-    k_f = prefactor_units[201] * fwd_A[201]
-                * exp(fwd_beta[201] * tc[0] - activation_units[201] * fwd_Ea[201] * invT);
+    k_f = k_f_s[201];
     dlnkfdT = fwd_beta[201] * invT + activation_units[201] * fwd_Ea[201] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[28];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[28] + g_RT[29]);
+    Kc = Kc_s[201];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[29]) + (h_RT[5] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28657,12 +28157,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[29];
-    k_f = prefactor_units[202] * fwd_A[202]
-                * exp(fwd_beta[202] * tc[0] - activation_units[202] * fwd_Ea[202] * invT);
+    k_f = k_f_s[202];
     dlnkfdT = fwd_beta[202] * invT + activation_units[202] * fwd_Ea[202] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[28];
-    Kc = exp(-g_RT[3] + g_RT[6] - g_RT[28] + g_RT[29]);
+    Kc = Kc_s[202];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[29]) + (h_RT[3] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28708,12 +28207,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[29];
-    k_f = prefactor_units[203] * fwd_A[203]
-                * exp(fwd_beta[203] * tc[0] - activation_units[203] * fwd_Ea[203] * invT);
+    k_f = k_f_s[203];
     dlnkfdT = fwd_beta[203] * invT + activation_units[203] * fwd_Ea[203] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[31];
-    Kc = exp(g_RT[11] - g_RT[13] + g_RT[29] - g_RT[31]);
+    Kc = Kc_s[203];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[29]) + (h_RT[13] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28759,12 +28257,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[31];
-    k_f = prefactor_units[204] * fwd_A[204]
-                * exp(fwd_beta[204] * tc[0] - activation_units[204] * fwd_Ea[204] * invT);
+    k_f = k_f_s[204];
     dlnkfdT = fwd_beta[204] * invT + activation_units[204] * fwd_Ea[204] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[29];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[29] + g_RT[31]);
+    Kc = Kc_s[204];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[31]) + (h_RT[4] + h_RT[29]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28810,12 +28307,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[31];
-    k_f = prefactor_units[205] * fwd_A[205]
-                * exp(fwd_beta[205] * tc[0] - activation_units[205] * fwd_Ea[205] * invT);
+    k_f = k_f_s[205];
     dlnkfdT = fwd_beta[205] * invT + activation_units[205] * fwd_Ea[205] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[30];
-    Kc = exp(g_RT[0] - g_RT[4] - g_RT[30] + g_RT[31]);
+    Kc = Kc_s[205];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[31]) + (h_RT[4] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28861,12 +28357,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[31];
-    k_f = prefactor_units[206] * fwd_A[206]
-                * exp(fwd_beta[206] * tc[0] - activation_units[206] * fwd_Ea[206] * invT);
+    k_f = k_f_s[206];
     dlnkfdT = fwd_beta[206] * invT + activation_units[206] * fwd_Ea[206] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[29];
-    Kc = exp(g_RT[1] - g_RT[2] - g_RT[29] + g_RT[31]);
+    Kc = Kc_s[206];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[31]) + (h_RT[2] + h_RT[29]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28912,12 +28407,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[31];
-    k_f = prefactor_units[207] * fwd_A[207]
-                * exp(fwd_beta[207] * tc[0] - activation_units[207] * fwd_Ea[207] * invT);
+    k_f = k_f_s[207];
     dlnkfdT = fwd_beta[207] * invT + activation_units[207] * fwd_Ea[207] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[30];
-    Kc = exp(g_RT[1] - g_RT[2] - g_RT[30] + g_RT[31]);
+    Kc = Kc_s[207];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[31]) + (h_RT[2] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -28963,12 +28457,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[31];
-    k_f = prefactor_units[208] * fwd_A[208]
-                * exp(fwd_beta[208] * tc[0] - activation_units[208] * fwd_Ea[208] * invT);
+    k_f = k_f_s[208];
     dlnkfdT = fwd_beta[208] * invT + activation_units[208] * fwd_Ea[208] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[29];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[29] + g_RT[31]);
+    Kc = Kc_s[208];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[31]) + (h_RT[5] + h_RT[29]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29014,12 +28507,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[31];
-    k_f = prefactor_units[209] * fwd_A[209]
-                * exp(fwd_beta[209] * tc[0] - activation_units[209] * fwd_Ea[209] * invT);
+    k_f = k_f_s[209];
     dlnkfdT = fwd_beta[209] * invT + activation_units[209] * fwd_Ea[209] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[30];
-    Kc = exp(g_RT[2] - g_RT[5] - g_RT[30] + g_RT[31]);
+    Kc = Kc_s[209];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[31]) + (h_RT[5] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29065,12 +28557,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[31];
-    k_f = prefactor_units[210] * fwd_A[210]
-                * exp(fwd_beta[210] * tc[0] - activation_units[210] * fwd_Ea[210] * invT);
+    k_f = k_f_s[210];
     dlnkfdT = fwd_beta[210] * invT + activation_units[210] * fwd_Ea[210] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[29];
-    Kc = exp(-g_RT[3] + g_RT[6] - g_RT[29] + g_RT[31]);
+    Kc = Kc_s[210];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[31]) + (h_RT[3] + h_RT[29]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29116,12 +28607,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[31];
-    k_f = prefactor_units[211] * fwd_A[211]
-                * exp(fwd_beta[211] * tc[0] - activation_units[211] * fwd_Ea[211] * invT);
+    k_f = k_f_s[211];
     dlnkfdT = fwd_beta[211] * invT + activation_units[211] * fwd_Ea[211] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[30];
-    Kc = exp(-g_RT[3] + g_RT[6] - g_RT[30] + g_RT[31]);
+    Kc = Kc_s[211];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[31]) + (h_RT[3] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -29175,6 +28665,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         dcvpRdT(dcRdT, tc);
         speciesInternalEnergy(e_RT, tc);
         eh_RT = &e_RT[0];
+        for (int k=0; k<34; k++) {
+            for (int m=0; m<34; m++) {
+                J[k*35+m] += Jmix[m];
+            }
+        }
     }
 
     double cmix = 0.0, ehmix = 0.0, dcmixdT=0.0, dehmixdT=0.0;
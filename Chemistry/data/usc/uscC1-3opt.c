@@ -1,5 +1,6 @@
 
 #include <math.h>
+#include <float.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -86,7 +87,14 @@
 #define VCKPY VCKPY
 #define VCKWYR VCKWYR
 #define VCKYTX VCKYTX
+#define VCKCPBS VCKCPBS
+#define VCKCVBS VCKCVBS
+#define VCKHBMS VCKHBMS
+#define VCKUBMS VCKUBMS
+#define VCKRHOY VCKRHOY
+#define VCKMMWY VCKMMWY
 #define GET_T_GIVEN_EY GET_T_GIVEN_EY
+#define GET_T_GIVEN_HY GET_T_GIVEN_HY
 #define GET_REACTION_MAP GET_REACTION_MAP
 #elif defined(BL_FORT_USE_LOWERCASE)
 #define CKINDX ckindx
@@ -170,7 +178,14 @@
 #define VCKPY vckpy
 #define VCKWYR vckwyr
 #define VCKYTX vckytx
+#define VCKCPBS vckcpbs
+#define VCKCVBS vckcvbs
+#define VCKHBMS vckhbms
+#define VCKUBMS vckubms
+#define VCKRHOY vckrhoy
+#define VCKMMWY vckmmwy
 #define GET_T_GIVEN_EY get_t_given_ey
+#define GET_T_GIVEN_HY get_t_given_hy
 #define GET_REACTION_MAP get_reaction_map
 #elif defined(BL_FORT_USE_UNDERSCORE)
 #define CKINDX ckindx_
@@ -254,7 +269,14 @@
 #define VCKPY vckpy_
 #define VCKWYR vckwyr_
 #define VCKYTX vckytx_
+#define VCKCPBS vckcpbs_
+#define VCKCVBS vckcvbs_
+#define VCKHBMS vckhbms_
+#define VCKUBMS vckubms_
+#define VCKRHOY vckrhoy_
+#define VCKMMWY vckmmwy_
 #define GET_T_GIVEN_EY get_t_given_ey_
+#define GET_T_GIVEN_HY get_t_given_hy_
 #define GET_REACTION_MAP get_reaction_map_
 #endif
 
@@ -356,6 +378,7 @@ void DWDOT(double * restrict J, double * restrict sc, double * restrict T, int *
 void aJacobian(double * restrict J, double * restrict sc, double T, int consP);
 void dcvpRdT(double * restrict species, double * restrict tc);
 void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
+void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int *ierr);
 void GET_REACTION_MAP(int * restrict rmap);
 /*vector version */
 void vproductionRate(int npt, double * restrict wdot, double * restrict c, double * restrict T);
@@ -365,6 +388,12 @@ void VCKWYR(int * restrict np, double * restrict rho, double * restrict T,
             double * restrict y, int * restrict iwrk, double * restrict rwrk,
             double * restrict wdot);
 void VCKYTX(int * restrict np, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict x);
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs);
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs);
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms);
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms);
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho);
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm);
 void vcomp_k_f(int npt, double * restrict k_f_s, double * restrict tc, double * restrict invT);
 void vcomp_gibbs(int npt, double * restrict g_RT, double * restrict tc);
 void vcomp_Kc(int npt, double * restrict Kc_s, double * restrict g_RT, double * restrict invT);
@@ -6161,38 +6190,6 @@ void CKINDX(int * iwrk, double * restrict rwrk, int * mm, int * kk, int * ii, in
 }
 
 
-/* strtok_r: re-entrant (threadsafe) version of strtok, helper function for tokenizing strings  */
-char *strtok_r(char *s, const char *delim, char **save_ptr)
-{
-    char *token;
-
-    if (s == NULL)
-        s = *save_ptr;
-
-    /* Scan leading delimiters.  */
-    s += strspn (s, delim);
-    if (*s == '\0')
-    {
-        *save_ptr = s;
-        return NULL;
-    }
-
-    /* Find the end of the token.  */
-    token = s;
-    s = strpbrk (token, delim);
-    if (s == NULL)
-        /* This token finishes the string.  */
-        *save_ptr = __rawmemchr (token, '\0');
-    else
-    {
-        /* Terminate the token and make *SAVE_PTR point past it.  */
-        *s = '\0';
-        *save_ptr = s + 1;
-    }
-    return token;
-}
-
-
 
 /* ckxnum... for parsing strings  */
 void CKXNUM(char * line, int * nexp, int * lout, int * nval, double * restrict rval, int * kerr, int lenline )
@@ -7158,6 +7155,28 @@ void CKRHOY(double * restrict P, double * restrict T, double * restrict y, int *
 }
 
 
+/*Compute rho = P*W(y)/RT */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKRHOY(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho)
+{
+    for (int i=0; i<(*np); i++) {
+        rho[i] = 0.0;
+    }
+
+    for (int n=0; n<70; n++) {
+        for (int i=0; i<(*np); i++) {
+            rho[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        rho[i] = P[i] / (8.31451e+07 * T[i] * rho[i]);/*rho = P*W/(R*T) */
+    }
+
+    return;
+}
+
+
 /*Compute rho = P*W(c)/(R*T) */
 void CKRHOC(double * restrict P, double * restrict T, double * restrict c, int * iwrk, double * restrict rwrk, double * restrict rho)
 {
@@ -7280,6 +7299,29 @@ void CKMMWY(double * restrict y, int * iwrk, double * restrict rwrk, double * re
 }
 
 
+/*given y[species]: mass fractions */
+/*returns mean molecular weight (gm/mole) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKMMWY(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm)
+{
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 0.0;
+    }
+
+    for (int n=0; n<70; n++) {
+        for (int i=0; i<(*np); i++) {
+            wtm[i] += y[n*(*ldy)+i] * imw[n];
+        }
+    }
+
+    for (int i=0; i<(*np); i++) {
+        wtm[i] = 1.0 / wtm[i];
+    }
+
+    return;
+}
+
+
 /*given x[species]: mole fractions */
 /*returns mean molecular weight (gm/mole) */
 void CKMMWX(double * restrict x, int * iwrk, double * restrict rwrk, double * restrict wtm)
@@ -8546,6 +8588,30 @@ void CKCPBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CP (Eq. 34) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCPBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs)
+{
+    double tc[5], tmp[70], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cp_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<70; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cpbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean specific heat at CV (Eq. 35) */
 void CKCVBL(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict cvbl)
 {
@@ -8649,6 +8715,30 @@ void CKCVBS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns the mean specific heat at CV (Eq. 36) */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKCVBS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs)
+{
+    double tc[5], tmp[70], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        cv_R(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<70; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        cvbs[i] = result * 8.31451e+07;
+    }
+}
+
+
 /*Returns the mean enthalpy of the mixture in molar units */
 void CKHBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict hbml)
 {
@@ -8690,6 +8780,30 @@ void CKHBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*Returns mean enthalpy of mixture in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKHBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms)
+{
+    double tc[5], tmp[70], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesEnthalpy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<70; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        hbms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mean internal energy in molar units */
 void CKUBML(double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict ubml)
 {
@@ -8795,6 +8909,30 @@ void CKUBMS(double * restrict T, double * restrict y, int * iwrk, double * restr
 }
 
 
+/*get mean internal energy in mass units */
+/*y[n*(*ldy)+i]: species n of point i */
+void VCKUBMS(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms)
+{
+    double tc[5], tmp[70], result;
+
+    for (int i=0; i<(*np); i++) {
+        tc[0] = 0.0;
+        tc[1] = T[i];
+        tc[2] = T[i]*T[i];
+        tc[3] = T[i]*T[i]*T[i];
+        tc[4] = T[i]*T[i]*T[i]*T[i];
+
+        speciesInternalEnergy(tmp, tc);
+
+        result = 0.0;
+        for (int n=0; n<70; n++) {
+            result += tmp[n]*y[n*(*ldy)+i]*imw[n];
+        }
+        ubms[i] = result * 8.31451e+07 * T[i];
+    }
+}
+
+
 /*get mixture entropy in molar units */
 void CKSBML(double * restrict P, double * restrict T, double * restrict x, int * iwrk, double * restrict rwrk, double * restrict sbml)
 {
@@ -23194,12 +23332,485 @@ void productionRate(double * restrict wdot, double * restrict sc, double T)
 
 void comp_k_f(double * restrict tc, double invT, double * restrict k_f)
 {
+    double x[463];
 #ifdef __INTEL_COMPILER
     #pragma simd
 #endif
     for (int i=0; i<463; ++i) {
-        k_f[i] = prefactor_units[i] * fwd_A[i]
-                    * exp(fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT);
+        x[i] = fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT;
+    };
+
+    /*the exp is skipped when the exponent is zero or that of */
+    /*an earlier reaction with the same default beta and Ea */
+    k_f[0] = (x[0] == 0.0 ? 1.0 : exp(x[0]));
+    k_f[1] = exp(x[1]);
+    k_f[2] = exp(x[2]);
+    k_f[3] = exp(x[3]);
+    k_f[4] = exp(x[4]);
+    k_f[5] = exp(x[5]);
+    k_f[6] = exp(x[6]);
+    k_f[7] = exp(x[7]);
+    k_f[8] = exp(x[8]);
+    k_f[9] = exp(x[9]);
+    k_f[10] = exp(x[10]);
+    k_f[11] = exp(x[11]);
+    k_f[12] = exp(x[12]);
+    k_f[13] = exp(x[13]);
+    k_f[14] = exp(x[14]);
+    k_f[15] = (x[15] == 0.0 ? 1.0 : exp(x[15]));
+    k_f[16] = exp(x[16]);
+    k_f[17] = exp(x[17]);
+    k_f[18] = exp(x[18]);
+    k_f[19] = exp(x[19]);
+    k_f[20] = exp(x[20]);
+    k_f[21] = exp(x[21]);
+    k_f[22] = (x[22] == 0.0 ? 1.0 : exp(x[22]));
+    k_f[23] = (x[23] == 0.0 ? 1.0 : exp(x[23]));
+    k_f[24] = exp(x[24]);
+    k_f[25] = exp(x[25]);
+    k_f[26] = (x[26] == 0.0 ? 1.0 : exp(x[26]));
+    k_f[27] = (x[27] == 0.0 ? 1.0 : exp(x[27]));
+    k_f[28] = exp(x[28]);
+    k_f[29] = (x[29] == 0.0 ? 1.0 : exp(x[29]));
+    k_f[30] = (x[30] == 0.0 ? 1.0 : exp(x[30]));
+    k_f[31] = (x[31] == 0.0 ? 1.0 : exp(x[31]));
+    k_f[32] = (x[32] == 0.0 ? 1.0 : exp(x[32]));
+    k_f[33] = exp(x[33]);
+    k_f[34] = (x[34] == 0.0 ? 1.0 : exp(x[34]));
+    k_f[35] = (x[35] == 0.0 ? 1.0 : exp(x[35]));
+    k_f[36] = exp(x[36]);
+    k_f[37] = (x[37] == x[7] ? k_f[7] : exp(x[37]));
+    k_f[38] = (x[38] == x[7] ? k_f[7] : exp(x[38]));
+    k_f[39] = exp(x[39]);
+    k_f[40] = (x[40] == x[7] ? k_f[7] : exp(x[40]));
+    k_f[41] = exp(x[41]);
+    k_f[42] = exp(x[42]);
+    k_f[43] = exp(x[43]);
+    k_f[44] = (x[44] == 0.0 ? 1.0 : exp(x[44]));
+    k_f[45] = exp(x[45]);
+    k_f[46] = (x[46] == 0.0 ? 1.0 : exp(x[46]));
+    k_f[47] = (x[47] == 0.0 ? 1.0 : exp(x[47]));
+    k_f[48] = (x[48] == 0.0 ? 1.0 : exp(x[48]));
+    k_f[49] = (x[49] == 0.0 ? 1.0 : exp(x[49]));
+    k_f[50] = (x[50] == 0.0 ? 1.0 : exp(x[50]));
+    k_f[51] = exp(x[51]);
+    k_f[52] = (x[52] == 0.0 ? 1.0 : exp(x[52]));
+    k_f[53] = (x[53] == 0.0 ? 1.0 : exp(x[53]));
+    k_f[54] = exp(x[54]);
+    k_f[55] = (x[55] == 0.0 ? 1.0 : exp(x[55]));
+    k_f[56] = (x[56] == 0.0 ? 1.0 : exp(x[56]));
+    k_f[57] = exp(x[57]);
+    k_f[58] = exp(x[58]);
+    k_f[59] = (x[59] == 0.0 ? 1.0 : exp(x[59]));
+    k_f[60] = exp(x[60]);
+    k_f[61] = exp(x[61]);
+    k_f[62] = (x[62] == x[60] ? k_f[60] : exp(x[62]));
+    k_f[63] = (x[63] == 0.0 ? 1.0 : exp(x[63]));
+    k_f[64] = exp(x[64]);
+    k_f[65] = (x[65] == 0.0 ? 1.0 : exp(x[65]));
+    k_f[66] = exp(x[66]);
+    k_f[67] = (x[67] == 0.0 ? 1.0 : exp(x[67]));
+    k_f[68] = exp(x[68]);
+    k_f[69] = exp(x[69]);
+    k_f[70] = exp(x[70]);
+    k_f[71] = exp(x[71]);
+    k_f[72] = exp(x[72]);
+    k_f[73] = exp(x[73]);
+    k_f[74] = (x[74] == x[72] ? k_f[72] : exp(x[74]));
+    k_f[75] = exp(x[75]);
+    k_f[76] = exp(x[76]);
+    k_f[77] = exp(x[77]);
+    k_f[78] = exp(x[78]);
+    k_f[79] = (x[79] == x[41] ? k_f[41] : exp(x[79]));
+    k_f[80] = exp(x[80]);
+    k_f[81] = exp(x[81]);
+    k_f[82] = exp(x[82]);
+    k_f[83] = exp(x[83]);
+    k_f[84] = exp(x[84]);
+    k_f[85] = (x[85] == 0.0 ? 1.0 : exp(x[85]));
+    k_f[86] = (x[86] == 0.0 ? 1.0 : exp(x[86]));
+    k_f[87] = exp(x[87]);
+    k_f[88] = (x[88] == 0.0 ? 1.0 : exp(x[88]));
+    k_f[89] = exp(x[89]);
+    k_f[90] = (x[90] == 0.0 ? 1.0 : exp(x[90]));
+    k_f[91] = exp(x[91]);
+    k_f[92] = exp(x[92]);
+    k_f[93] = exp(x[93]);
+    k_f[94] = (x[94] == 0.0 ? 1.0 : exp(x[94]));
+    k_f[95] = exp(x[95]);
+    k_f[96] = exp(x[96]);
+    k_f[97] = exp(x[97]);
+    k_f[98] = (x[98] == x[97] ? k_f[97] : exp(x[98]));
+    k_f[99] = (x[99] == 0.0 ? 1.0 : exp(x[99]));
+    k_f[100] = exp(x[100]);
+    k_f[101] = (x[101] == 0.0 ? 1.0 : exp(x[101]));
+    k_f[102] = exp(x[102]);
+    k_f[103] = (x[103] == 0.0 ? 1.0 : exp(x[103]));
+    k_f[104] = (x[104] == x[68] ? k_f[68] : exp(x[104]));
+    k_f[105] = exp(x[105]);
+    k_f[106] = (x[106] == 0.0 ? 1.0 : exp(x[106]));
+    k_f[107] = exp(x[107]);
+    k_f[108] = exp(x[108]);
+    k_f[109] = exp(x[109]);
+    k_f[110] = exp(x[110]);
+    k_f[111] = exp(x[111]);
+    k_f[112] = (x[112] == 0.0 ? 1.0 : exp(x[112]));
+    k_f[113] = (x[113] == 0.0 ? 1.0 : exp(x[113]));
+    k_f[114] = (x[114] == 0.0 ? 1.0 : exp(x[114]));
+    k_f[115] = exp(x[115]);
+    k_f[116] = (x[116] == 0.0 ? 1.0 : exp(x[116]));
+    k_f[117] = exp(x[117]);
+    k_f[118] = exp(x[118]);
+    k_f[119] = exp(x[119]);
+    k_f[120] = exp(x[120]);
+    k_f[121] = (x[121] == 0.0 ? 1.0 : exp(x[121]));
+    k_f[122] = exp(x[122]);
+    k_f[123] = (x[123] == 0.0 ? 1.0 : exp(x[123]));
+    k_f[124] = (x[124] == 0.0 ? 1.0 : exp(x[124]));
+    k_f[125] = exp(x[125]);
+    k_f[126] = exp(x[126]);
+    k_f[127] = (x[127] == 0.0 ? 1.0 : exp(x[127]));
+    k_f[128] = exp(x[128]);
+    k_f[129] = exp(x[129]);
+    k_f[130] = exp(x[130]);
+    k_f[131] = exp(x[131]);
+    k_f[132] = (x[132] == 0.0 ? 1.0 : exp(x[132]));
+    k_f[133] = exp(x[133]);
+    k_f[134] = exp(x[134]);
+    k_f[135] = exp(x[135]);
+    k_f[136] = exp(x[136]);
+    k_f[137] = exp(x[137]);
+    k_f[138] = (x[138] == 0.0 ? 1.0 : exp(x[138]));
+    k_f[139] = (x[139] == 0.0 ? 1.0 : exp(x[139]));
+    k_f[140] = (x[140] == 0.0 ? 1.0 : exp(x[140]));
+    k_f[141] = exp(x[141]);
+    k_f[142] = exp(x[142]);
+    k_f[143] = exp(x[143]);
+    k_f[144] = (x[144] == 0.0 ? 1.0 : exp(x[144]));
+    k_f[145] = (x[145] == 0.0 ? 1.0 : exp(x[145]));
+    k_f[146] = (x[146] == 0.0 ? 1.0 : exp(x[146]));
+    k_f[147] = exp(x[147]);
+    k_f[148] = exp(x[148]);
+    k_f[149] = (x[149] == 0.0 ? 1.0 : exp(x[149]));
+    k_f[150] = (x[150] == 0.0 ? 1.0 : exp(x[150]));
+    k_f[151] = (x[151] == 0.0 ? 1.0 : exp(x[151]));
+    k_f[152] = exp(x[152]);
+    k_f[153] = exp(x[153]);
+    k_f[154] = (x[154] == 0.0 ? 1.0 : exp(x[154]));
+    k_f[155] = exp(x[155]);
+    k_f[156] = exp(x[156]);
+    k_f[157] = exp(x[157]);
+    k_f[158] = (x[158] == 0.0 ? 1.0 : exp(x[158]));
+    k_f[159] = exp(x[159]);
+    k_f[160] = (x[160] == 0.0 ? 1.0 : exp(x[160]));
+    k_f[161] = exp(x[161]);
+    k_f[162] = (x[162] == x[161] ? k_f[161] : exp(x[162]));
+    k_f[163] = (x[163] == 0.0 ? 1.0 : exp(x[163]));
+    k_f[164] = (x[164] == 0.0 ? 1.0 : exp(x[164]));
+    k_f[165] = (x[165] == 0.0 ? 1.0 : exp(x[165]));
+    k_f[166] = (x[166] == 0.0 ? 1.0 : exp(x[166]));
+    k_f[167] = exp(x[167]);
+    k_f[168] = (x[168] == x[167] ? k_f[167] : exp(x[168]));
+    k_f[169] = (x[169] == 0.0 ? 1.0 : exp(x[169]));
+    k_f[170] = (x[170] == 0.0 ? 1.0 : exp(x[170]));
+    k_f[171] = (x[171] == 0.0 ? 1.0 : exp(x[171]));
+    k_f[172] = exp(x[172]);
+    k_f[173] = exp(x[173]);
+    k_f[174] = exp(x[174]);
+    k_f[175] = exp(x[175]);
+    k_f[176] = exp(x[176]);
+    k_f[177] = (x[177] == 0.0 ? 1.0 : exp(x[177]));
+    k_f[178] = exp(x[178]);
+    k_f[179] = exp(x[179]);
+    k_f[180] = (x[180] == x[179] ? k_f[179] : exp(x[180]));
+    k_f[181] = exp(x[181]);
+    k_f[182] = exp(x[182]);
+    k_f[183] = (x[183] == x[42] ? k_f[42] : exp(x[183]));
+    k_f[184] = exp(x[184]);
+    k_f[185] = exp(x[185]);
+    k_f[186] = exp(x[186]);
+    k_f[187] = (x[187] == x[148] ? k_f[148] : exp(x[187]));
+    k_f[188] = exp(x[188]);
+    k_f[189] = exp(x[189]);
+    k_f[190] = exp(x[190]);
+    k_f[191] = exp(x[191]);
+    k_f[192] = (x[192] == 0.0 ? 1.0 : exp(x[192]));
+    k_f[193] = (x[193] == 0.0 ? 1.0 : exp(x[193]));
+    k_f[194] = (x[194] == x[64] ? k_f[64] : exp(x[194]));
+    k_f[195] = (x[195] == 0.0 ? 1.0 : exp(x[195]));
+    k_f[196] = exp(x[196]);
+    k_f[197] = exp(x[197]);
+    k_f[198] = (x[198] == x[155] ? k_f[155] : exp(x[198]));
+    k_f[199] = (x[199] == x[155] ? k_f[155] : exp(x[199]));
+    k_f[200] = exp(x[200]);
+    k_f[201] = exp(x[201]);
+    k_f[202] = exp(x[202]);
+    k_f[203] = exp(x[203]);
+    k_f[204] = exp(x[204]);
+    k_f[205] = (x[205] == x[204] ? k_f[204] : exp(x[205]));
+    k_f[206] = exp(x[206]);
+    k_f[207] = exp(x[207]);
+    k_f[208] = (x[208] == x[207] ? k_f[207] : exp(x[208]));
+    k_f[209] = exp(x[209]);
+    k_f[210] = exp(x[210]);
+    k_f[211] = exp(x[211]);
+    k_f[212] = (x[212] == 0.0 ? 1.0 : exp(x[212]));
+    k_f[213] = (x[213] == 0.0 ? 1.0 : exp(x[213]));
+    k_f[214] = (x[214] == 0.0 ? 1.0 : exp(x[214]));
+    k_f[215] = (x[215] == 0.0 ? 1.0 : exp(x[215]));
+    k_f[216] = (x[216] == 0.0 ? 1.0 : exp(x[216]));
+    k_f[217] = (x[217] == 0.0 ? 1.0 : exp(x[217]));
+    k_f[218] = (x[218] == 0.0 ? 1.0 : exp(x[218]));
+    k_f[219] = (x[219] == 0.0 ? 1.0 : exp(x[219]));
+    k_f[220] = (x[220] == 0.0 ? 1.0 : exp(x[220]));
+    k_f[221] = exp(x[221]);
+    k_f[222] = (x[222] == 0.0 ? 1.0 : exp(x[222]));
+    k_f[223] = exp(x[223]);
+    k_f[224] = (x[224] == 0.0 ? 1.0 : exp(x[224]));
+    k_f[225] = (x[225] == 0.0 ? 1.0 : exp(x[225]));
+    k_f[226] = exp(x[226]);
+    k_f[227] = (x[227] == 0.0 ? 1.0 : exp(x[227]));
+    k_f[228] = (x[228] == 0.0 ? 1.0 : exp(x[228]));
+    k_f[229] = (x[229] == 0.0 ? 1.0 : exp(x[229]));
+    k_f[230] = (x[230] == x[226] ? k_f[226] : exp(x[230]));
+    k_f[231] = (x[231] == 0.0 ? 1.0 : exp(x[231]));
+    k_f[232] = (x[232] == 0.0 ? 1.0 : exp(x[232]));
+    k_f[233] = exp(x[233]);
+    k_f[234] = (x[234] == 0.0 ? 1.0 : exp(x[234]));
+    k_f[235] = (x[235] == 0.0 ? 1.0 : exp(x[235]));
+    k_f[236] = (x[236] == 0.0 ? 1.0 : exp(x[236]));
+    k_f[237] = (x[237] == 0.0 ? 1.0 : exp(x[237]));
+    k_f[238] = (x[238] == 0.0 ? 1.0 : exp(x[238]));
+    k_f[239] = exp(x[239]);
+    k_f[240] = exp(x[240]);
+    k_f[241] = exp(x[241]);
+    k_f[242] = exp(x[242]);
+    k_f[243] = exp(x[243]);
+    k_f[244] = exp(x[244]);
+    k_f[245] = (x[245] == 0.0 ? 1.0 : exp(x[245]));
+    k_f[246] = exp(x[246]);
+    k_f[247] = exp(x[247]);
+    k_f[248] = exp(x[248]);
+    k_f[249] = exp(x[249]);
+    k_f[250] = exp(x[250]);
+    k_f[251] = exp(x[251]);
+    k_f[252] = (x[252] == x[239] ? k_f[239] : exp(x[252]));
+    k_f[253] = exp(x[253]);
+    k_f[254] = (x[254] == x[253] ? k_f[253] : exp(x[254]));
+    k_f[255] = exp(x[255]);
+    k_f[256] = (x[256] == 0.0 ? 1.0 : exp(x[256]));
+    k_f[257] = (x[257] == x[244] ? k_f[244] : exp(x[257]));
+    k_f[258] = exp(x[258]);
+    k_f[259] = exp(x[259]);
+    k_f[260] = exp(x[260]);
+    k_f[261] = exp(x[261]);
+    k_f[262] = exp(x[262]);
+    k_f[263] = exp(x[263]);
+    k_f[264] = exp(x[264]);
+    k_f[265] = exp(x[265]);
+    k_f[266] = exp(x[266]);
+    k_f[267] = exp(x[267]);
+    k_f[268] = exp(x[268]);
+    k_f[269] = exp(x[269]);
+    k_f[270] = exp(x[270]);
+    k_f[271] = (x[271] == 0.0 ? 1.0 : exp(x[271]));
+    k_f[272] = (x[272] == 0.0 ? 1.0 : exp(x[272]));
+    k_f[273] = (x[273] == 0.0 ? 1.0 : exp(x[273]));
+    k_f[274] = (x[274] == 0.0 ? 1.0 : exp(x[274]));
+    k_f[275] = (x[275] == 0.0 ? 1.0 : exp(x[275]));
+    k_f[276] = (x[276] == 0.0 ? 1.0 : exp(x[276]));
+    k_f[277] = (x[277] == 0.0 ? 1.0 : exp(x[277]));
+    k_f[278] = exp(x[278]);
+    k_f[279] = (x[279] == 0.0 ? 1.0 : exp(x[279]));
+    k_f[280] = (x[280] == 0.0 ? 1.0 : exp(x[280]));
+    k_f[281] = (x[281] == 0.0 ? 1.0 : exp(x[281]));
+    k_f[282] = (x[282] == 0.0 ? 1.0 : exp(x[282]));
+    k_f[283] = (x[283] == 0.0 ? 1.0 : exp(x[283]));
+    k_f[284] = (x[284] == 0.0 ? 1.0 : exp(x[284]));
+    k_f[285] = exp(x[285]);
+    k_f[286] = exp(x[286]);
+    k_f[287] = exp(x[287]);
+    k_f[288] = exp(x[288]);
+    k_f[289] = exp(x[289]);
+    k_f[290] = exp(x[290]);
+    k_f[291] = exp(x[291]);
+    k_f[292] = exp(x[292]);
+    k_f[293] = exp(x[293]);
+    k_f[294] = exp(x[294]);
+    k_f[295] = (x[295] == x[267] ? k_f[267] : exp(x[295]));
+    k_f[296] = exp(x[296]);
+    k_f[297] = exp(x[297]);
+    k_f[298] = (x[298] == 0.0 ? 1.0 : exp(x[298]));
+    k_f[299] = (x[299] == 0.0 ? 1.0 : exp(x[299]));
+    k_f[300] = exp(x[300]);
+    k_f[301] = (x[301] == 0.0 ? 1.0 : exp(x[301]));
+    k_f[302] = (x[302] == x[10] ? k_f[10] : exp(x[302]));
+    k_f[303] = (x[303] == x[54] ? k_f[54] : exp(x[303]));
+    k_f[304] = exp(x[304]);
+    k_f[305] = (x[305] == x[122] ? k_f[122] : exp(x[305]));
+    k_f[306] = (x[306] == 0.0 ? 1.0 : exp(x[306]));
+    k_f[307] = exp(x[307]);
+    k_f[308] = exp(x[308]);
+    k_f[309] = exp(x[309]);
+    k_f[310] = (x[310] == 0.0 ? 1.0 : exp(x[310]));
+    k_f[311] = (x[311] == 0.0 ? 1.0 : exp(x[311]));
+    k_f[312] = (x[312] == 0.0 ? 1.0 : exp(x[312]));
+    k_f[313] = exp(x[313]);
+    k_f[314] = (x[314] == 0.0 ? 1.0 : exp(x[314]));
+    k_f[315] = exp(x[315]);
+    k_f[316] = (x[316] == 0.0 ? 1.0 : exp(x[316]));
+    k_f[317] = (x[317] == 0.0 ? 1.0 : exp(x[317]));
+    k_f[318] = (x[318] == 0.0 ? 1.0 : exp(x[318]));
+    k_f[319] = (x[319] == 0.0 ? 1.0 : exp(x[319]));
+    k_f[320] = (x[320] == 0.0 ? 1.0 : exp(x[320]));
+    k_f[321] = (x[321] == 0.0 ? 1.0 : exp(x[321]));
+    k_f[322] = (x[322] == 0.0 ? 1.0 : exp(x[322]));
+    k_f[323] = exp(x[323]);
+    k_f[324] = exp(x[324]);
+    k_f[325] = exp(x[325]);
+    k_f[326] = exp(x[326]);
+    k_f[327] = exp(x[327]);
+    k_f[328] = (x[328] == x[244] ? k_f[244] : exp(x[328]));
+    k_f[329] = exp(x[329]);
+    k_f[330] = (x[330] == 0.0 ? 1.0 : exp(x[330]));
+    k_f[331] = exp(x[331]);
+    k_f[332] = exp(x[332]);
+    k_f[333] = exp(x[333]);
+    k_f[334] = exp(x[334]);
+    k_f[335] = exp(x[335]);
+    k_f[336] = (x[336] == 0.0 ? 1.0 : exp(x[336]));
+    k_f[337] = exp(x[337]);
+    k_f[338] = exp(x[338]);
+    k_f[339] = exp(x[339]);
+    k_f[340] = exp(x[340]);
+    k_f[341] = (x[341] == 0.0 ? 1.0 : exp(x[341]));
+    k_f[342] = (x[342] == 0.0 ? 1.0 : exp(x[342]));
+    k_f[343] = (x[343] == 0.0 ? 1.0 : exp(x[343]));
+    k_f[344] = (x[344] == 0.0 ? 1.0 : exp(x[344]));
+    k_f[345] = (x[345] == 0.0 ? 1.0 : exp(x[345]));
+    k_f[346] = (x[346] == 0.0 ? 1.0 : exp(x[346]));
+    k_f[347] = (x[347] == 0.0 ? 1.0 : exp(x[347]));
+    k_f[348] = (x[348] == x[135] ? k_f[135] : exp(x[348]));
+    k_f[349] = exp(x[349]);
+    k_f[350] = (x[350] == x[349] ? k_f[349] : exp(x[350]));
+    k_f[351] = exp(x[351]);
+    k_f[352] = exp(x[352]);
+    k_f[353] = exp(x[353]);
+    k_f[354] = exp(x[354]);
+    k_f[355] = (x[355] == x[223] ? k_f[223] : exp(x[355]));
+    k_f[356] = (x[356] == x[243] ? k_f[243] : exp(x[356]));
+    k_f[357] = exp(x[357]);
+    k_f[358] = exp(x[358]);
+    k_f[359] = exp(x[359]);
+    k_f[360] = exp(x[360]);
+    k_f[361] = exp(x[361]);
+    k_f[362] = exp(x[362]);
+    k_f[363] = (x[363] == 0.0 ? 1.0 : exp(x[363]));
+    k_f[364] = (x[364] == 0.0 ? 1.0 : exp(x[364]));
+    k_f[365] = (x[365] == 0.0 ? 1.0 : exp(x[365]));
+    k_f[366] = (x[366] == 0.0 ? 1.0 : exp(x[366]));
+    k_f[367] = exp(x[367]);
+    k_f[368] = exp(x[368]);
+    k_f[369] = exp(x[369]);
+    k_f[370] = (x[370] == x[100] ? k_f[100] : exp(x[370]));
+    k_f[371] = exp(x[371]);
+    k_f[372] = exp(x[372]);
+    k_f[373] = exp(x[373]);
+    k_f[374] = exp(x[374]);
+    k_f[375] = exp(x[375]);
+    k_f[376] = exp(x[376]);
+    k_f[377] = exp(x[377]);
+    k_f[378] = (x[378] == 0.0 ? 1.0 : exp(x[378]));
+    k_f[379] = (x[379] == 0.0 ? 1.0 : exp(x[379]));
+    k_f[380] = (x[380] == 0.0 ? 1.0 : exp(x[380]));
+    k_f[381] = (x[381] == 0.0 ? 1.0 : exp(x[381]));
+    k_f[382] = exp(x[382]);
+    k_f[383] = (x[383] == x[367] ? k_f[367] : exp(x[383]));
+    k_f[384] = (x[384] == 0.0 ? 1.0 : exp(x[384]));
+    k_f[385] = (x[385] == 0.0 ? 1.0 : exp(x[385]));
+    k_f[386] = (x[386] == x[100] ? k_f[100] : exp(x[386]));
+    k_f[387] = (x[387] == x[371] ? k_f[371] : exp(x[387]));
+    k_f[388] = (x[388] == x[135] ? k_f[135] : exp(x[388]));
+    k_f[389] = exp(x[389]);
+    k_f[390] = (x[390] == x[372] ? k_f[372] : exp(x[390]));
+    k_f[391] = (x[391] == x[373] ? k_f[373] : exp(x[391]));
+    k_f[392] = exp(x[392]);
+    k_f[393] = (x[393] == x[287] ? k_f[287] : exp(x[393]));
+    k_f[394] = (x[394] == x[135] ? k_f[135] : exp(x[394]));
+    k_f[395] = (x[395] == x[135] ? k_f[135] : exp(x[395]));
+    k_f[396] = (x[396] == x[289] ? k_f[289] : exp(x[396]));
+    k_f[397] = (x[397] == x[291] ? k_f[291] : exp(x[397]));
+    k_f[398] = (x[398] == x[293] ? k_f[293] : exp(x[398]));
+    k_f[399] = exp(x[399]);
+    k_f[400] = (x[400] == 0.0 ? 1.0 : exp(x[400]));
+    k_f[401] = (x[401] == x[331] ? k_f[331] : exp(x[401]));
+    k_f[402] = (x[402] == 0.0 ? 1.0 : exp(x[402]));
+    k_f[403] = (x[403] == 0.0 ? 1.0 : exp(x[403]));
+    k_f[404] = exp(x[404]);
+    k_f[405] = exp(x[405]);
+    k_f[406] = exp(x[406]);
+    k_f[407] = (x[407] == 0.0 ? 1.0 : exp(x[407]));
+    k_f[408] = exp(x[408]);
+    k_f[409] = (x[409] == x[352] ? k_f[352] : exp(x[409]));
+    k_f[410] = (x[410] == x[360] ? k_f[360] : exp(x[410]));
+    k_f[411] = (x[411] == x[362] ? k_f[362] : exp(x[411]));
+    k_f[412] = (x[412] == 0.0 ? 1.0 : exp(x[412]));
+    k_f[413] = (x[413] == 0.0 ? 1.0 : exp(x[413]));
+    k_f[414] = (x[414] == 0.0 ? 1.0 : exp(x[414]));
+    k_f[415] = exp(x[415]);
+    k_f[416] = exp(x[416]);
+    k_f[417] = (x[417] == x[371] ? k_f[371] : exp(x[417]));
+    k_f[418] = (x[418] == x[373] ? k_f[373] : exp(x[418]));
+    k_f[419] = exp(x[419]);
+    k_f[420] = exp(x[420]);
+    k_f[421] = exp(x[421]);
+    k_f[422] = exp(x[422]);
+    k_f[423] = exp(x[423]);
+    k_f[424] = exp(x[424]);
+    k_f[425] = exp(x[425]);
+    k_f[426] = (x[426] == 0.0 ? 1.0 : exp(x[426]));
+    k_f[427] = (x[427] == 0.0 ? 1.0 : exp(x[427]));
+    k_f[428] = exp(x[428]);
+    k_f[429] = exp(x[429]);
+    k_f[430] = (x[430] == 0.0 ? 1.0 : exp(x[430]));
+    k_f[431] = (x[431] == 0.0 ? 1.0 : exp(x[431]));
+    k_f[432] = (x[432] == 0.0 ? 1.0 : exp(x[432]));
+    k_f[433] = (x[433] == 0.0 ? 1.0 : exp(x[433]));
+    k_f[434] = exp(x[434]);
+    k_f[435] = exp(x[435]);
+    k_f[436] = (x[436] == x[122] ? k_f[122] : exp(x[436]));
+    k_f[437] = (x[437] == x[425] ? k_f[425] : exp(x[437]));
+    k_f[438] = (x[438] == 0.0 ? 1.0 : exp(x[438]));
+    k_f[439] = (x[439] == 0.0 ? 1.0 : exp(x[439]));
+    k_f[440] = exp(x[440]);
+    k_f[441] = (x[441] == 0.0 ? 1.0 : exp(x[441]));
+    k_f[442] = (x[442] == 0.0 ? 1.0 : exp(x[442]));
+    k_f[443] = exp(x[443]);
+    k_f[444] = (x[444] == 0.0 ? 1.0 : exp(x[444]));
+    k_f[445] = (x[445] == x[286] ? k_f[286] : exp(x[445]));
+    k_f[446] = (x[446] == x[286] ? k_f[286] : exp(x[446]));
+    k_f[447] = (x[447] == x[258] ? k_f[258] : exp(x[447]));
+    k_f[448] = exp(x[448]);
+    k_f[449] = exp(x[449]);
+    k_f[450] = exp(x[450]);
+    k_f[451] = (x[451] == x[262] ? k_f[262] : exp(x[451]));
+    k_f[452] = (x[452] == x[264] ? k_f[264] : exp(x[452]));
+    k_f[453] = exp(x[453]);
+    k_f[454] = (x[454] == x[268] ? k_f[268] : exp(x[454]));
+    k_f[455] = exp(x[455]);
+    k_f[456] = exp(x[456]);
+    k_f[457] = (x[457] == 0.0 ? 1.0 : exp(x[457]));
+    k_f[458] = (x[458] == 0.0 ? 1.0 : exp(x[458]));
+    k_f[459] = (x[459] == 0.0 ? 1.0 : exp(x[459]));
+    k_f[460] = (x[460] == 0.0 ? 1.0 : exp(x[460]));
+    k_f[461] = (x[461] == 0.0 ? 1.0 : exp(x[461]));
+    k_f[462] = exp(x[462]);
+
+#ifdef __INTEL_COMPILER
+    #pragma simd
+#endif
+    for (int i=0; i<463; ++i) {
+        k_f[i] *= prefactor_units[i] * fwd_A[i];
     };
     return;
 }
@@ -23210,606 +23821,1082 @@ void comp_Kc(double * restrict tc, double invT, double * restrict Kc)
     double g_RT[70];
     gibbs(g_RT, tc);
 
-    Kc[0] = g_RT[1] + g_RT[10] - g_RT[12];
-    Kc[1] = g_RT[1] + g_RT[12] - g_RT[13];
-    Kc[2] = g_RT[1] + g_RT[16] - g_RT[17];
-    Kc[3] = g_RT[1] + g_RT[17] - g_RT[18];
-    Kc[4] = g_RT[1] + g_RT[17] - g_RT[19];
-    Kc[5] = g_RT[1] + g_RT[18] - g_RT[20];
-    Kc[6] = g_RT[1] + g_RT[19] - g_RT[20];
-    Kc[7] = g_RT[1] + g_RT[21] - g_RT[22];
-    Kc[8] = g_RT[1] + g_RT[22] - g_RT[23];
-    Kc[9] = g_RT[1] + g_RT[23] - g_RT[24];
-    Kc[10] = g_RT[1] + g_RT[24] - g_RT[25];
-    Kc[11] = g_RT[1] + g_RT[25] - g_RT[26];
-    Kc[12] = g_RT[0] + g_RT[14] - g_RT[17];
-    Kc[13] = 2*g_RT[4] - g_RT[7];
-    Kc[14] = g_RT[4] + g_RT[12] - g_RT[20];
-    Kc[15] = g_RT[9] + g_RT[14] - g_RT[27];
-    Kc[16] = g_RT[10] + g_RT[14] - g_RT[28];
-    Kc[17] = g_RT[5] + g_RT[11] - g_RT[20];
-    Kc[18] = 2*g_RT[12] - g_RT[26];
-    Kc[19] = -g_RT[0] - g_RT[22] + g_RT[24];
-    Kc[20] = g_RT[0] + g_RT[9] - g_RT[12];
-    Kc[21] = g_RT[1] + g_RT[28] - g_RT[32];
-    Kc[22] = g_RT[1] - g_RT[62] + g_RT[63];
-    Kc[23] = g_RT[1] - g_RT[62] + g_RT[64];
-    Kc[24] = g_RT[1] - g_RT[63] + g_RT[65];
-    Kc[25] = g_RT[1] - g_RT[64] + g_RT[65];
-    Kc[26] = g_RT[1] - g_RT[65] + g_RT[66];
-    Kc[27] = g_RT[12] + g_RT[23] - g_RT[65];
-    Kc[28] = g_RT[12] + g_RT[25] - g_RT[62];
-    Kc[29] = g_RT[12] + g_RT[34] - g_RT[46];
-    Kc[30] = g_RT[1] - g_RT[53] + g_RT[54];
-    Kc[31] = g_RT[1] + g_RT[55] - g_RT[56];
-    Kc[32] = g_RT[1] - g_RT[57] + g_RT[58];
-    Kc[33] = g_RT[12] - g_RT[47] + g_RT[66];
-    Kc[34] = g_RT[1] - g_RT[47] + g_RT[48];
-    Kc[35] = g_RT[23] + g_RT[25] - g_RT[47];
-    Kc[36] = g_RT[2] + g_RT[14] - g_RT[15];
-    Kc[37] = 2*g_RT[2] - g_RT[3];
-    Kc[38] = g_RT[1] + g_RT[2] - g_RT[4];
-    Kc[39] = g_RT[1] + g_RT[3] - g_RT[6];
-    Kc[40] = -g_RT[0] + 2*g_RT[1];
-    Kc[41] = g_RT[1] + g_RT[4] - g_RT[5];
-    Kc[42] = -g_RT[1] - g_RT[14] + g_RT[16];
-    Kc[43] = g_RT[0] - g_RT[1] + g_RT[2] - g_RT[4];
-    Kc[44] = g_RT[2] - g_RT[3] - g_RT[4] + g_RT[6];
-    Kc[45] = g_RT[2] - g_RT[4] - g_RT[6] + g_RT[7];
-    Kc[46] = -g_RT[1] + g_RT[2] + g_RT[9] - g_RT[14];
-    Kc[47] = -g_RT[1] + g_RT[2] + g_RT[10] - g_RT[16];
-    Kc[48] = -g_RT[0] + g_RT[2] + g_RT[11] - g_RT[14];
-    Kc[49] = -g_RT[1] + g_RT[2] + g_RT[11] - g_RT[16];
-    Kc[50] = -g_RT[1] + g_RT[2] + g_RT[12] - g_RT[17];
-    Kc[51] = g_RT[2] - g_RT[4] - g_RT[12] + g_RT[13];
-    Kc[52] = g_RT[2] - g_RT[4] - g_RT[14] + g_RT[16];
-    Kc[53] = -g_RT[1] + g_RT[2] - g_RT[15] + g_RT[16];
-    Kc[54] = g_RT[2] - g_RT[4] - g_RT[16] + g_RT[17];
-    Kc[55] = g_RT[2] - g_RT[4] - g_RT[17] + g_RT[18];
-    Kc[56] = g_RT[2] - g_RT[4] - g_RT[17] + g_RT[19];
-    Kc[57] = g_RT[2] - g_RT[4] - g_RT[18] + g_RT[20];
-    Kc[58] = g_RT[2] - g_RT[4] - g_RT[19] + g_RT[20];
-    Kc[59] = g_RT[2] - g_RT[9] - g_RT[14] + g_RT[21];
-    Kc[60] = -g_RT[1] + g_RT[2] + g_RT[22] - g_RT[27];
-    Kc[61] = g_RT[2] - g_RT[4] - g_RT[21] + g_RT[22];
-    Kc[62] = g_RT[2] - g_RT[10] - g_RT[14] + g_RT[22];
-    Kc[63] = -g_RT[1] + g_RT[2] + g_RT[23] - g_RT[28];
-    Kc[64] = g_RT[2] - g_RT[12] - g_RT[16] + g_RT[24];
-    Kc[65] = g_RT[2] - g_RT[12] - g_RT[17] + g_RT[25];
-    Kc[66] = g_RT[2] - g_RT[4] - g_RT[25] + g_RT[26];
-    Kc[67] = -g_RT[1] + g_RT[2] - 2*g_RT[14] + g_RT[27];
-    Kc[68] = g_RT[2] - g_RT[4] - g_RT[27] + g_RT[28];
-    Kc[69] = g_RT[2] - g_RT[10] - g_RT[15] + g_RT[28];
-    Kc[70] = -g_RT[2] + g_RT[3] + g_RT[14] - g_RT[15];
-    Kc[71] = g_RT[3] - g_RT[6] - g_RT[16] + g_RT[17];
-    Kc[72] = g_RT[1] + 2*g_RT[3] - g_RT[3] - g_RT[6];
-    Kc[73] = g_RT[1] + g_RT[3] + g_RT[5] - g_RT[5] - g_RT[6];
-    Kc[74] = g_RT[1] + g_RT[3] - g_RT[6] + g_RT[31] - g_RT[31];
-    Kc[75] = g_RT[1] + g_RT[3] - g_RT[6] + g_RT[30] - g_RT[30];
-    Kc[76] = g_RT[1] - g_RT[2] + g_RT[3] - g_RT[4];
-    Kc[77] = g_RT[0] - 2*g_RT[0] + 2*g_RT[1];
-    Kc[78] = -g_RT[0] + 2*g_RT[1] + g_RT[5] - g_RT[5];
-    Kc[79] = -g_RT[0] + 2*g_RT[1] + g_RT[15] - g_RT[15];
-    Kc[80] = g_RT[1] - g_RT[2] - g_RT[5] + g_RT[6];
-    Kc[81] = -g_RT[0] + g_RT[1] - g_RT[3] + g_RT[6];
-    Kc[82] = g_RT[1] - 2*g_RT[4] + g_RT[6];
-    Kc[83] = -g_RT[0] + g_RT[1] - g_RT[6] + g_RT[7];
-    Kc[84] = g_RT[1] - g_RT[4] - g_RT[5] + g_RT[7];
-    Kc[85] = -g_RT[0] + g_RT[1] - g_RT[8] + g_RT[9];
-    Kc[86] = -g_RT[0] + g_RT[1] - g_RT[9] + g_RT[11];
-    Kc[87] = -g_RT[0] + g_RT[1] - g_RT[12] + g_RT[13];
-    Kc[88] = -g_RT[0] + g_RT[1] - g_RT[14] + g_RT[16];
-    Kc[89] = -g_RT[0] + g_RT[1] - g_RT[16] + g_RT[17];
-    Kc[90] = -g_RT[0] + g_RT[1] - g_RT[17] + g_RT[18];
-    Kc[91] = g_RT[1] - g_RT[4] - g_RT[12] + g_RT[18];
-    Kc[92] = g_RT[1] - g_RT[5] - g_RT[11] + g_RT[18];
-    Kc[93] = g_RT[1] - g_RT[1] - g_RT[18] + g_RT[19];
-    Kc[94] = -g_RT[0] + g_RT[1] - g_RT[17] + g_RT[19];
-    Kc[95] = g_RT[1] - g_RT[4] - g_RT[12] + g_RT[19];
-    Kc[96] = g_RT[1] - g_RT[5] - g_RT[11] + g_RT[19];
-    Kc[97] = -g_RT[0] + g_RT[1] - g_RT[18] + g_RT[20];
-    Kc[98] = -g_RT[0] + g_RT[1] - g_RT[19] + g_RT[20];
-    Kc[99] = -g_RT[0] + g_RT[1] - g_RT[22] + g_RT[23];
-    Kc[100] = -g_RT[0] + g_RT[1] - g_RT[23] + g_RT[24];
-    Kc[101] = -g_RT[0] + g_RT[1] - g_RT[24] + g_RT[25];
-    Kc[102] = -g_RT[0] + g_RT[1] - g_RT[25] + g_RT[26];
-    Kc[103] = g_RT[1] - g_RT[11] - g_RT[14] + g_RT[27];
-    Kc[104] = -g_RT[0] + g_RT[1] - g_RT[27] + g_RT[28];
-    Kc[105] = g_RT[1] - g_RT[12] - g_RT[14] + g_RT[28];
-    Kc[106] = g_RT[1] - g_RT[1] - g_RT[28] + g_RT[29];
-    Kc[107] = g_RT[0] - g_RT[1] + g_RT[4] - g_RT[5];
-    Kc[108] = -g_RT[2] + 2*g_RT[4] - g_RT[5];
-    Kc[109] = -g_RT[3] + g_RT[4] - g_RT[5] + g_RT[6];
-    Kc[110] = g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7];
-    Kc[111] = g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7];
-    Kc[112] = -g_RT[1] + g_RT[4] + g_RT[8] - g_RT[14];
-    Kc[113] = -g_RT[1] + g_RT[4] + g_RT[9] - g_RT[16];
-    Kc[114] = -g_RT[1] + g_RT[4] + g_RT[10] - g_RT[17];
-    Kc[115] = g_RT[4] - g_RT[5] - g_RT[9] + g_RT[10];
-    Kc[116] = -g_RT[1] + g_RT[4] + g_RT[11] - g_RT[17];
-    Kc[117] = g_RT[4] - g_RT[5] - g_RT[10] + g_RT[12];
-    Kc[118] = g_RT[4] - g_RT[5] - g_RT[11] + g_RT[12];
-    Kc[119] = g_RT[4] - g_RT[5] - g_RT[12] + g_RT[13];
-    Kc[120] = -g_RT[1] + g_RT[4] + g_RT[14] - g_RT[15];
-    Kc[121] = g_RT[4] - g_RT[5] - g_RT[14] + g_RT[16];
-    Kc[122] = g_RT[4] - g_RT[5] - g_RT[16] + g_RT[17];
-    Kc[123] = g_RT[4] - g_RT[5] - g_RT[17] + g_RT[18];
-    Kc[124] = g_RT[4] - g_RT[5] - g_RT[17] + g_RT[19];
-    Kc[125] = g_RT[4] - g_RT[5] - g_RT[18] + g_RT[20];
-    Kc[126] = g_RT[4] - g_RT[5] - g_RT[19] + g_RT[20];
-    Kc[127] = -g_RT[1] + g_RT[4] + g_RT[21] - g_RT[27];
-    Kc[128] = -g_RT[1] + g_RT[4] + g_RT[22] - g_RT[28];
-    Kc[129] = -g_RT[1] + g_RT[4] + g_RT[22] - g_RT[29];
-    Kc[130] = g_RT[4] - g_RT[5] - g_RT[21] + g_RT[22];
-    Kc[131] = g_RT[4] - g_RT[12] - g_RT[14] + g_RT[22];
-    Kc[132] = g_RT[4] - g_RT[5] - g_RT[22] + g_RT[23];
-    Kc[133] = g_RT[4] - g_RT[5] - g_RT[23] + g_RT[24];
-    Kc[134] = g_RT[4] - g_RT[5] - g_RT[25] + g_RT[26];
-    Kc[135] = g_RT[4] - g_RT[5] - g_RT[27] + g_RT[28];
-    Kc[136] = -g_RT[3] + 2*g_RT[6] - g_RT[7];
-    Kc[137] = -g_RT[3] + 2*g_RT[6] - g_RT[7];
-    Kc[138] = -g_RT[4] + g_RT[6] + g_RT[10] - g_RT[17];
-    Kc[139] = -g_RT[3] + g_RT[6] + g_RT[12] - g_RT[13];
-    Kc[140] = -g_RT[4] + g_RT[6] + g_RT[12] - g_RT[19];
-    Kc[141] = -g_RT[4] + g_RT[6] + g_RT[14] - g_RT[15];
-    Kc[142] = g_RT[6] - g_RT[7] - g_RT[16] + g_RT[17];
-    Kc[143] = -g_RT[2] + g_RT[3] + g_RT[8] - g_RT[14];
-    Kc[144] = -g_RT[1] + g_RT[8] + g_RT[10] - g_RT[21];
-    Kc[145] = -g_RT[1] + g_RT[8] + g_RT[12] - g_RT[22];
-    Kc[146] = -g_RT[2] + g_RT[3] + g_RT[9] - g_RT[16];
-    Kc[147] = g_RT[0] - g_RT[1] + g_RT[9] - g_RT[10];
-    Kc[148] = -g_RT[1] + g_RT[5] + g_RT[9] - g_RT[17];
-    Kc[149] = -g_RT[1] + g_RT[9] + g_RT[10] - g_RT[22];
-    Kc[150] = -g_RT[1] + g_RT[9] + g_RT[12] - g_RT[23];
-    Kc[151] = -g_RT[1] + g_RT[9] + g_RT[13] - g_RT[24];
-    Kc[152] = g_RT[9] - g_RT[14] + g_RT[15] - g_RT[16];
-    Kc[153] = -g_RT[1] + g_RT[9] + g_RT[17] - g_RT[28];
-    Kc[154] = g_RT[9] - g_RT[14] - g_RT[22] + g_RT[27];
-    Kc[155] = -g_RT[1] + g_RT[3] - g_RT[4] + g_RT[10] - g_RT[14];
-    Kc[156] = g_RT[0] - g_RT[1] + g_RT[10] - g_RT[12];
-    Kc[157] = -g_RT[0] + 2*g_RT[10] - g_RT[22];
-    Kc[158] = -g_RT[1] + g_RT[10] + g_RT[12] - g_RT[24];
-    Kc[159] = g_RT[10] - 2*g_RT[12] + g_RT[13];
-    Kc[160] = g_RT[10] - g_RT[14] - g_RT[23] + g_RT[27];
-    Kc[161] = -g_RT[10] + g_RT[11] + g_RT[31] - g_RT[31];
-    Kc[162] = -g_RT[10] + g_RT[11] + g_RT[30] - g_RT[30];
-    Kc[163] = -g_RT[1] + g_RT[3] - g_RT[4] + g_RT[11] - g_RT[14];
-    Kc[164] = g_RT[3] - g_RT[5] + g_RT[11] - g_RT[14];
-    Kc[165] = g_RT[0] - g_RT[1] + g_RT[11] - g_RT[12];
-    Kc[166] = g_RT[5] - g_RT[5] - g_RT[10] + g_RT[11];
-    Kc[167] = -g_RT[1] + g_RT[11] + g_RT[12] - g_RT[24];
-    Kc[168] = g_RT[11] - 2*g_RT[12] + g_RT[13];
-    Kc[169] = -g_RT[10] + g_RT[11] + g_RT[14] - g_RT[14];
-    Kc[170] = -g_RT[10] + g_RT[11] + g_RT[15] - g_RT[15];
-    Kc[171] = g_RT[11] - g_RT[14] + g_RT[15] - g_RT[17];
-    Kc[172] = g_RT[11] - g_RT[12] - g_RT[25] + g_RT[26];
-    Kc[173] = -g_RT[2] + g_RT[3] + g_RT[12] - g_RT[19];
-    Kc[174] = g_RT[3] - g_RT[4] + g_RT[12] - g_RT[17];
-    Kc[175] = -g_RT[6] + g_RT[7] + g_RT[12] - g_RT[13];
-    Kc[176] = -g_RT[1] + 2*g_RT[12] - g_RT[25];
-    Kc[177] = g_RT[12] - g_RT[13] - g_RT[14] + g_RT[16];
-    Kc[178] = g_RT[12] - g_RT[13] - g_RT[16] + g_RT[17];
-    Kc[179] = g_RT[12] - g_RT[13] - g_RT[18] + g_RT[20];
-    Kc[180] = g_RT[12] - g_RT[13] - g_RT[19] + g_RT[20];
-    Kc[181] = g_RT[12] - g_RT[13] - g_RT[23] + g_RT[24];
-    Kc[182] = g_RT[12] - g_RT[13] - g_RT[25] + g_RT[26];
-    Kc[183] = -g_RT[1] + g_RT[5] - g_RT[5] - g_RT[14] + g_RT[16];
-    Kc[184] = g_RT[3] - g_RT[6] - g_RT[14] + g_RT[16];
-    Kc[185] = g_RT[3] - g_RT[6] - g_RT[17] + g_RT[18];
-    Kc[186] = g_RT[3] - g_RT[6] - g_RT[17] + g_RT[19];
-    Kc[187] = g_RT[3] - g_RT[14] - g_RT[16] + g_RT[21];
-    Kc[188] = g_RT[0] - g_RT[1] + g_RT[21] - g_RT[22];
-    Kc[189] = g_RT[3] - g_RT[16] - g_RT[17] + g_RT[23];
-    Kc[190] = g_RT[3] - g_RT[6] - g_RT[24] + g_RT[25];
-    Kc[191] = g_RT[3] - g_RT[4] - 2*g_RT[14] + g_RT[27];
-    Kc[192] = -2*g_RT[14] - g_RT[22] + 2*g_RT[27];
-    Kc[193] = -g_RT[0] - g_RT[1] + g_RT[2] + g_RT[12] - g_RT[14];
-    Kc[194] = -g_RT[1] + g_RT[2] + g_RT[24] - g_RT[32];
-    Kc[195] = -g_RT[1] + g_RT[2] + g_RT[25] - g_RT[68];
-    Kc[196] = -g_RT[3] + g_RT[4] - g_RT[5] + g_RT[6];
-    Kc[197] = -g_RT[0] + g_RT[4] + g_RT[12] - g_RT[17];
-    Kc[198] = -2*g_RT[1] + g_RT[3] + g_RT[10] - g_RT[15];
-    Kc[199] = -g_RT[2] + g_RT[3] + g_RT[10] - g_RT[17];
-    Kc[200] = -2*g_RT[1] + g_RT[10] + g_RT[10] - g_RT[22];
-    Kc[201] = -g_RT[0] + g_RT[5] + g_RT[11] - g_RT[17];
-    Kc[202] = -g_RT[2] + g_RT[3] + g_RT[23] - g_RT[32];
-    Kc[203] = g_RT[3] - g_RT[6] - g_RT[22] + g_RT[23];
-    Kc[204] = g_RT[2] - g_RT[4] - g_RT[32] + g_RT[68];
-    Kc[205] = g_RT[2] - g_RT[4] - g_RT[12] - g_RT[14] + g_RT[68];
-    Kc[206] = g_RT[3] - g_RT[6] - g_RT[12] - g_RT[14] + g_RT[68];
-    Kc[207] = -g_RT[0] + g_RT[1] - g_RT[32] + g_RT[68];
-    Kc[208] = -g_RT[0] + g_RT[1] - g_RT[12] - g_RT[14] + g_RT[68];
-    Kc[209] = g_RT[4] - g_RT[5] - g_RT[12] - g_RT[14] + g_RT[68];
-    Kc[210] = g_RT[6] - g_RT[7] - g_RT[12] - g_RT[14] + g_RT[68];
-    Kc[211] = g_RT[12] - g_RT[12] - g_RT[13] - g_RT[14] + g_RT[68];
-    Kc[212] = -g_RT[1] + g_RT[2] - g_RT[10] - g_RT[15] + g_RT[32];
-    Kc[213] = g_RT[3] - g_RT[4] - g_RT[14] - g_RT[17] + g_RT[32];
-    Kc[214] = g_RT[3] - g_RT[4] - 2*g_RT[16] + g_RT[32];
-    Kc[215] = g_RT[1] - g_RT[12] - g_RT[16] + g_RT[32];
-    Kc[216] = -g_RT[0] + g_RT[1] - g_RT[28] + g_RT[32];
-    Kc[217] = g_RT[4] - g_RT[5] - g_RT[28] + g_RT[32];
-    Kc[218] = g_RT[4] - g_RT[16] - g_RT[18] + g_RT[32];
-    Kc[219] = -g_RT[1] + g_RT[12] + g_RT[21] - g_RT[34];
-    Kc[220] = -g_RT[1] + g_RT[9] + g_RT[22] - g_RT[33];
-    Kc[221] = -g_RT[1] + g_RT[10] + g_RT[22] - g_RT[34];
-    Kc[222] = -g_RT[1] + g_RT[11] + g_RT[22] - g_RT[34];
-    Kc[223] = -g_RT[14] + g_RT[22] + g_RT[27] - g_RT[34];
-    Kc[224] = g_RT[2] - g_RT[14] - g_RT[22] + g_RT[33];
-    Kc[225] = g_RT[4] - g_RT[16] - g_RT[22] + g_RT[33];
-    Kc[226] = -g_RT[1] + g_RT[3] - g_RT[14] - g_RT[27] + g_RT[33];
-    Kc[227] = g_RT[1] + g_RT[33] - g_RT[34];
-    Kc[228] = g_RT[1] + g_RT[34] - g_RT[35];
-    Kc[229] = g_RT[1] + g_RT[34] - g_RT[36];
-    Kc[230] = -g_RT[0] + g_RT[1] - g_RT[33] + g_RT[34];
-    Kc[231] = g_RT[2] - g_RT[17] - g_RT[21] + g_RT[34];
-    Kc[232] = g_RT[4] - g_RT[5] - g_RT[33] + g_RT[34];
-    Kc[233] = g_RT[3] - g_RT[16] - g_RT[28] + g_RT[34];
-    Kc[234] = -g_RT[4] + g_RT[6] - g_RT[14] - g_RT[23] + g_RT[34];
-    Kc[235] = -g_RT[3] + g_RT[6] + g_RT[34] - g_RT[36];
-    Kc[236] = -g_RT[3] + g_RT[6] + g_RT[34] - g_RT[35];
-    Kc[237] = -g_RT[14] + g_RT[16] + g_RT[34] - g_RT[36];
-    Kc[238] = -g_RT[14] + g_RT[16] + g_RT[34] - g_RT[35];
-    Kc[239] = -g_RT[0] + g_RT[1] - g_RT[34] + g_RT[36];
-    Kc[240] = g_RT[1] + g_RT[36] - g_RT[67];
-    Kc[241] = g_RT[1] + g_RT[36] - g_RT[66];
-    Kc[242] = g_RT[2] - g_RT[14] - g_RT[24] + g_RT[36];
-    Kc[243] = g_RT[4] - g_RT[5] - g_RT[34] + g_RT[36];
-    Kc[244] = g_RT[12] - g_RT[13] - g_RT[34] + g_RT[36];
-    Kc[245] = g_RT[21] - g_RT[22] - g_RT[34] + g_RT[36];
-    Kc[246] = g_RT[35] - g_RT[37];
-    Kc[247] = g_RT[35] - g_RT[36];
-    Kc[248] = -g_RT[36] + g_RT[37];
-    Kc[249] = g_RT[1] - g_RT[1] + g_RT[35] - g_RT[36];
-    Kc[250] = g_RT[1] + g_RT[35] - g_RT[67];
-    Kc[251] = g_RT[1] + g_RT[35] - g_RT[66];
-    Kc[252] = -g_RT[0] + g_RT[1] - g_RT[34] + g_RT[35];
-    Kc[253] = g_RT[2] - g_RT[12] - g_RT[27] + g_RT[35];
-    Kc[254] = g_RT[2] - g_RT[14] - g_RT[24] + g_RT[35];
-    Kc[255] = g_RT[4] - g_RT[5] - g_RT[34] + g_RT[35];
-    Kc[256] = g_RT[21] - g_RT[22] - g_RT[34] + g_RT[35];
-    Kc[257] = g_RT[12] - g_RT[13] - g_RT[34] + g_RT[35];
-    Kc[258] = -g_RT[0] + g_RT[1] + g_RT[62] - g_RT[63];
-    Kc[259] = -g_RT[0] + g_RT[1] + g_RT[62] - g_RT[64];
-    Kc[260] = g_RT[2] - g_RT[4] + g_RT[62] - g_RT[63];
-    Kc[261] = g_RT[2] - g_RT[4] + g_RT[62] - g_RT[64];
-    Kc[262] = g_RT[4] - g_RT[5] + g_RT[62] - g_RT[63];
-    Kc[263] = g_RT[4] - g_RT[5] + g_RT[62] - g_RT[64];
-    Kc[264] = g_RT[3] - g_RT[6] + g_RT[62] - g_RT[63];
-    Kc[265] = g_RT[3] - g_RT[6] + g_RT[62] - g_RT[64];
-    Kc[266] = g_RT[6] - g_RT[7] + g_RT[62] - g_RT[63];
-    Kc[267] = g_RT[6] - g_RT[7] + g_RT[62] - g_RT[64];
-    Kc[268] = g_RT[12] - g_RT[13] + g_RT[62] - g_RT[63];
-    Kc[269] = g_RT[12] - g_RT[13] + g_RT[62] - g_RT[64];
-    Kc[270] = g_RT[1] - g_RT[12] - g_RT[25] + g_RT[63];
-    Kc[271] = -g_RT[0] + g_RT[1] + g_RT[63] - g_RT[65];
-    Kc[272] = g_RT[2] - g_RT[17] - g_RT[25] + g_RT[63];
-    Kc[273] = g_RT[4] - g_RT[5] + g_RT[63] - g_RT[65];
-    Kc[274] = g_RT[3] - g_RT[6] + g_RT[63] - g_RT[65];
-    Kc[275] = -g_RT[4] + g_RT[6] - g_RT[17] - g_RT[25] + g_RT[63];
-    Kc[276] = -g_RT[14] + g_RT[16] - g_RT[62] + g_RT[63];
-    Kc[277] = g_RT[12] - g_RT[13] + g_RT[63] - g_RT[65];
-    Kc[278] = g_RT[1] - g_RT[12] - g_RT[25] + g_RT[64];
-    Kc[279] = -g_RT[0] + g_RT[1] + g_RT[64] - g_RT[65];
-    Kc[280] = g_RT[2] - g_RT[12] + g_RT[64] - g_RT[68];
-    Kc[281] = g_RT[4] - g_RT[5] + g_RT[64] - g_RT[65];
-    Kc[282] = g_RT[3] - g_RT[6] + g_RT[64] - g_RT[65];
-    Kc[283] = -g_RT[4] + g_RT[6] - g_RT[12] + g_RT[64] - g_RT[68];
-    Kc[284] = -g_RT[14] + g_RT[16] - g_RT[62] + g_RT[64];
-    Kc[285] = g_RT[12] - g_RT[13] + g_RT[64] - g_RT[65];
-    Kc[286] = g_RT[1] - g_RT[12] - g_RT[24] + g_RT[65];
-    Kc[287] = -g_RT[0] + g_RT[1] + g_RT[65] - g_RT[66];
-    Kc[288] = -g_RT[0] + g_RT[1] + g_RT[65] - g_RT[67];
-    Kc[289] = -g_RT[1] + g_RT[2] - g_RT[12] - g_RT[28] + g_RT[65];
-    Kc[290] = g_RT[2] - g_RT[16] - g_RT[25] + g_RT[65];
-    Kc[291] = g_RT[2] - g_RT[4] + g_RT[65] - g_RT[66];
-    Kc[292] = g_RT[2] - g_RT[4] + g_RT[65] - g_RT[67];
-    Kc[293] = g_RT[4] - g_RT[5] + g_RT[65] - g_RT[66];
-    Kc[294] = g_RT[4] - g_RT[5] + g_RT[65] - g_RT[67];
-    Kc[295] = g_RT[6] - g_RT[7] + g_RT[65] - g_RT[66];
-    Kc[296] = g_RT[12] - g_RT[13] + g_RT[65] - g_RT[66];
-    Kc[297] = g_RT[12] - g_RT[13] + g_RT[65] - g_RT[67];
-    Kc[298] = -g_RT[0] + g_RT[1] - g_RT[36] + g_RT[66];
-    Kc[299] = -g_RT[1] + g_RT[2] + g_RT[66] - g_RT[69];
-    Kc[300] = -g_RT[1] - g_RT[1] + g_RT[4] + g_RT[66] - g_RT[69];
-    Kc[301] = g_RT[16] + g_RT[23] - g_RT[69];
-    Kc[302] = g_RT[1] - g_RT[16] - g_RT[24] + g_RT[69];
-    Kc[303] = g_RT[2] - g_RT[4] - g_RT[14] - g_RT[23] + g_RT[69];
-    Kc[304] = g_RT[2] - g_RT[17] - g_RT[28] + g_RT[69];
-    Kc[305] = g_RT[4] - g_RT[5] - g_RT[14] - g_RT[23] + g_RT[69];
-    Kc[306] = g_RT[4] - g_RT[5] - g_RT[36] + g_RT[66];
-    Kc[307] = g_RT[3] - g_RT[6] - g_RT[36] + g_RT[66];
-    Kc[308] = g_RT[3] - g_RT[12] - g_RT[14] - g_RT[17] + g_RT[66];
-    Kc[309] = g_RT[3] - g_RT[4] + g_RT[66] - g_RT[69];
-    Kc[310] = -g_RT[3] + g_RT[6] - g_RT[65] + g_RT[66];
-    Kc[311] = -g_RT[4] + g_RT[6] - g_RT[17] - g_RT[23] + g_RT[66];
-    Kc[312] = -g_RT[14] + g_RT[16] - g_RT[65] + g_RT[66];
-    Kc[313] = g_RT[12] - g_RT[13] - g_RT[36] + g_RT[66];
-    Kc[314] = -g_RT[36] - g_RT[65] + g_RT[66] + g_RT[66];
-    Kc[315] = g_RT[66] - g_RT[67];
-    Kc[316] = -g_RT[0] + g_RT[1] - g_RT[35] + g_RT[67];
-    Kc[317] = g_RT[2] - g_RT[12] - g_RT[28] + g_RT[67];
-    Kc[318] = -g_RT[1] + g_RT[4] - g_RT[12] - g_RT[28] + g_RT[67];
-    Kc[319] = g_RT[3] - g_RT[12] - g_RT[14] - g_RT[17] + g_RT[67];
-    Kc[320] = -g_RT[4] + g_RT[6] - g_RT[12] - g_RT[28] + g_RT[67];
-    Kc[321] = -g_RT[14] + g_RT[16] - g_RT[65] + g_RT[67];
-    Kc[322] = g_RT[12] - g_RT[13] - g_RT[35] + g_RT[67];
-    Kc[323] = -g_RT[1] + g_RT[12] + g_RT[22] - g_RT[35];
-    Kc[324] = -g_RT[1] + g_RT[12] + g_RT[22] - g_RT[36];
-    Kc[325] = g_RT[12] + g_RT[22] - g_RT[67];
-    Kc[326] = g_RT[12] + g_RT[22] - g_RT[66];
-    Kc[327] = -g_RT[1] + g_RT[12] + g_RT[23] - g_RT[66];
-    Kc[328] = g_RT[12] + g_RT[24] - g_RT[63];
-    Kc[329] = -g_RT[12] + g_RT[23] + g_RT[25] - g_RT[66];
-    Kc[330] = -g_RT[1] + g_RT[21] + g_RT[22] - g_RT[38];
-    Kc[331] = g_RT[21] + g_RT[22] - g_RT[40];
-    Kc[332] = g_RT[21] + g_RT[22] - g_RT[41];
-    Kc[333] = -g_RT[1] + g_RT[22] + g_RT[23] - g_RT[42];
-    Kc[334] = g_RT[22] + g_RT[23] - g_RT[43];
-    Kc[335] = g_RT[22] + g_RT[23] - g_RT[44];
-    Kc[336] = -g_RT[1] + g_RT[21] + g_RT[24] - g_RT[42];
-    Kc[337] = -g_RT[1] + g_RT[23] + g_RT[24] - g_RT[45];
-    Kc[338] = g_RT[23] + g_RT[23] - g_RT[45];
-    Kc[339] = -g_RT[1] + g_RT[23] + g_RT[23] - g_RT[44];
-    Kc[340] = -g_RT[1] + g_RT[23] + g_RT[23] - g_RT[43];
-    Kc[341] = -g_RT[1] + g_RT[9] + g_RT[33] - g_RT[38];
-    Kc[342] = -g_RT[1] + g_RT[10] + g_RT[33] - g_RT[40];
-    Kc[343] = -g_RT[1] + g_RT[12] + g_RT[33] - g_RT[42];
-    Kc[344] = -g_RT[14] + g_RT[27] + g_RT[33] - g_RT[40];
-    Kc[345] = -g_RT[14] + g_RT[27] + g_RT[34] - g_RT[42];
-    Kc[346] = -g_RT[1] + g_RT[9] + g_RT[34] - g_RT[41];
-    Kc[347] = -g_RT[1] + g_RT[10] + g_RT[34] - g_RT[42];
-    Kc[348] = g_RT[1] - g_RT[12] - g_RT[34] + g_RT[44];
-    Kc[349] = -g_RT[34] + g_RT[35] - g_RT[53] + g_RT[54];
-    Kc[350] = -g_RT[34] + g_RT[36] - g_RT[53] + g_RT[54];
-    Kc[351] = g_RT[1] + g_RT[38] - g_RT[40];
-    Kc[352] = g_RT[1] + g_RT[38] - g_RT[41];
-    Kc[353] = g_RT[2] - g_RT[14] - g_RT[33] + g_RT[38];
-    Kc[354] = -g_RT[1] + g_RT[4] + g_RT[38] - g_RT[39];
-    Kc[355] = g_RT[1] - g_RT[22] - g_RT[27] + g_RT[39];
-    Kc[356] = g_RT[4] - g_RT[27] - g_RT[28] + g_RT[39];
-    Kc[357] = g_RT[40] - g_RT[41];
-    Kc[358] = g_RT[1] - g_RT[1] + g_RT[40] - g_RT[41];
-    Kc[359] = g_RT[1] - g_RT[22] - g_RT[22] + g_RT[40];
-    Kc[360] = g_RT[1] - g_RT[22] - g_RT[22] + g_RT[41];
-    Kc[361] = g_RT[1] + g_RT[40] - g_RT[42];
-    Kc[362] = g_RT[1] + g_RT[41] - g_RT[42];
-    Kc[363] = -g_RT[0] + g_RT[1] - g_RT[38] + g_RT[40];
-    Kc[364] = -g_RT[0] + g_RT[1] - g_RT[38] + g_RT[41];
-    Kc[365] = g_RT[4] - g_RT[5] - g_RT[38] + g_RT[40];
-    Kc[366] = g_RT[4] - g_RT[5] - g_RT[38] + g_RT[41];
-    Kc[367] = g_RT[3] - g_RT[27] - g_RT[28] + g_RT[41];
-    Kc[368] = g_RT[1] + g_RT[42] - g_RT[43];
-    Kc[369] = g_RT[1] + g_RT[42] - g_RT[44];
-    Kc[370] = -g_RT[0] + g_RT[1] - g_RT[40] + g_RT[42];
-    Kc[371] = -g_RT[0] + g_RT[1] - g_RT[41] + g_RT[42];
-    Kc[372] = g_RT[4] - g_RT[5] - g_RT[40] + g_RT[42];
-    Kc[373] = g_RT[4] - g_RT[5] - g_RT[41] + g_RT[42];
-    Kc[374] = g_RT[43] - g_RT[44];
-    Kc[375] = g_RT[1] - g_RT[1] + g_RT[43] - g_RT[44];
-    Kc[376] = -g_RT[1] - g_RT[44] + g_RT[45];
-    Kc[377] = -g_RT[1] - g_RT[43] + g_RT[45];
-    Kc[378] = -g_RT[0] + g_RT[1] - g_RT[42] + g_RT[43];
-    Kc[379] = -g_RT[0] + g_RT[1] - g_RT[42] + g_RT[44];
-    Kc[380] = g_RT[4] - g_RT[5] - g_RT[42] + g_RT[43];
-    Kc[381] = g_RT[4] - g_RT[5] - g_RT[42] + g_RT[44];
-    Kc[382] = g_RT[3] - g_RT[14] - g_RT[16] - g_RT[24] + g_RT[43];
-    Kc[383] = g_RT[3] - g_RT[28] - g_RT[32] + g_RT[44];
-    Kc[384] = -g_RT[14] + g_RT[16] + g_RT[43] - g_RT[45];
-    Kc[385] = -g_RT[14] + g_RT[16] + g_RT[44] - g_RT[45];
-    Kc[386] = -g_RT[0] + g_RT[1] - g_RT[43] + g_RT[45];
-    Kc[387] = -g_RT[0] + g_RT[1] - g_RT[44] + g_RT[45];
-    Kc[388] = g_RT[1] - g_RT[12] - g_RT[35] + g_RT[45];
-    Kc[389] = g_RT[2] - g_RT[16] + g_RT[45] - g_RT[66];
-    Kc[390] = g_RT[4] - g_RT[5] - g_RT[43] + g_RT[45];
-    Kc[391] = g_RT[4] - g_RT[5] - g_RT[44] + g_RT[45];
-    Kc[392] = g_RT[1] - g_RT[1] - g_RT[45] + g_RT[46];
-    Kc[393] = -g_RT[0] + g_RT[1] - g_RT[44] + g_RT[46];
-    Kc[394] = g_RT[1] - g_RT[12] - g_RT[36] + g_RT[46];
-    Kc[395] = g_RT[1] - g_RT[12] - g_RT[35] + g_RT[46];
-    Kc[396] = g_RT[2] - g_RT[24] - g_RT[28] + g_RT[46];
-    Kc[397] = g_RT[2] - g_RT[4] - g_RT[44] + g_RT[46];
-    Kc[398] = g_RT[4] - g_RT[5] - g_RT[44] + g_RT[46];
-    Kc[399] = -g_RT[45] + g_RT[46];
-    Kc[400] = -g_RT[1] + g_RT[21] + g_RT[38] - g_RT[49];
-    Kc[401] = g_RT[21] + g_RT[38] - g_RT[50];
-    Kc[402] = -g_RT[1] + g_RT[34] + g_RT[34] - g_RT[54];
-    Kc[403] = g_RT[34] + g_RT[34] - g_RT[53];
-    Kc[404] = -g_RT[1] + g_RT[22] + g_RT[40] - g_RT[51];
-    Kc[405] = g_RT[22] + g_RT[40] - g_RT[54];
-    Kc[406] = -g_RT[1] + g_RT[22] + g_RT[40] - g_RT[52];
-    Kc[407] = -g_RT[1] + g_RT[21] + g_RT[42] - g_RT[51];
-    Kc[408] = -g_RT[1] + g_RT[22] + g_RT[43] - g_RT[53];
-    Kc[409] = g_RT[1] + g_RT[49] - g_RT[50];
-    Kc[410] = g_RT[1] - g_RT[22] - g_RT[38] + g_RT[50];
-    Kc[411] = g_RT[1] + g_RT[50] - g_RT[51];
-    Kc[412] = -g_RT[0] + g_RT[1] - g_RT[49] + g_RT[50];
-    Kc[413] = g_RT[4] - g_RT[5] - g_RT[49] + g_RT[50];
-    Kc[414] = g_RT[3] - g_RT[14] - g_RT[27] - g_RT[33] + g_RT[50];
-    Kc[415] = g_RT[1] + g_RT[51] - g_RT[54];
-    Kc[416] = g_RT[1] - g_RT[1] + g_RT[51] - g_RT[52];
-    Kc[417] = -g_RT[0] + g_RT[1] - g_RT[50] + g_RT[51];
-    Kc[418] = g_RT[4] - g_RT[5] - g_RT[50] + g_RT[51];
-    Kc[419] = g_RT[1] + g_RT[52] - g_RT[54];
-    Kc[420] = -g_RT[0] + g_RT[1] + g_RT[53] - g_RT[54];
-    Kc[421] = g_RT[4] - g_RT[5] + g_RT[53] - g_RT[54];
-    Kc[422] = -g_RT[1] + g_RT[2] + g_RT[53] - g_RT[55];
-    Kc[423] = -g_RT[1] + g_RT[4] + g_RT[53] - g_RT[56];
-    Kc[424] = -g_RT[2] + g_RT[3] + g_RT[54] - g_RT[55];
-    Kc[425] = -g_RT[14] + g_RT[55] - g_RT[58];
-    Kc[426] = g_RT[1] - g_RT[14] + g_RT[55] - g_RT[57];
-    Kc[427] = g_RT[2] - g_RT[14] - g_RT[16] - 2*g_RT[22] + g_RT[55];
-    Kc[428] = -g_RT[0] + g_RT[1] - g_RT[55] + g_RT[56];
-    Kc[429] = g_RT[2] - g_RT[4] - g_RT[55] + g_RT[56];
-    Kc[430] = g_RT[4] - g_RT[5] - g_RT[55] + g_RT[56];
-    Kc[431] = g_RT[2] - g_RT[14] - g_RT[43] + g_RT[58];
-    Kc[432] = -g_RT[1] + g_RT[4] + g_RT[58] - g_RT[60];
-    Kc[433] = -g_RT[4] + g_RT[6] + g_RT[58] - g_RT[59];
-    Kc[434] = -g_RT[0] + g_RT[1] + g_RT[57] - g_RT[58];
-    Kc[435] = g_RT[2] - g_RT[4] + g_RT[57] - g_RT[58];
-    Kc[436] = g_RT[4] - g_RT[5] + g_RT[57] - g_RT[58];
-    Kc[437] = -g_RT[14] - g_RT[43] + g_RT[59];
-    Kc[438] = g_RT[1] - g_RT[17] - 2*g_RT[22] + g_RT[59];
-    Kc[439] = g_RT[2] - g_RT[15] - g_RT[43] + g_RT[59];
-    Kc[440] = -g_RT[1] + g_RT[60] - g_RT[61];
-    Kc[441] = g_RT[1] - g_RT[17] - 2*g_RT[22] + g_RT[60];
-    Kc[442] = g_RT[2] - g_RT[15] - g_RT[43] + g_RT[60];
-    Kc[443] = -g_RT[14] - g_RT[22] - g_RT[22] + g_RT[61];
-    Kc[444] = g_RT[2] - g_RT[15] - 2*g_RT[22] + g_RT[61];
-    Kc[445] = g_RT[1] - g_RT[24] - g_RT[25] + g_RT[47];
-    Kc[446] = g_RT[1] - g_RT[12] + g_RT[47] - g_RT[65];
-    Kc[447] = -g_RT[0] + g_RT[1] + g_RT[47] - g_RT[48];
-    Kc[448] = g_RT[2] - g_RT[16] + g_RT[47] - g_RT[63];
-    Kc[449] = g_RT[2] - g_RT[4] + g_RT[47] - g_RT[48];
-    Kc[450] = g_RT[2] - g_RT[4] + g_RT[47] - g_RT[48];
-    Kc[451] = g_RT[4] - g_RT[5] + g_RT[47] - g_RT[48];
-    Kc[452] = g_RT[3] - g_RT[6] + g_RT[47] - g_RT[48];
-    Kc[453] = g_RT[6] - g_RT[7] + g_RT[47] - g_RT[48];
-    Kc[454] = g_RT[12] - g_RT[13] + g_RT[47] - g_RT[48];
-    Kc[455] = -g_RT[1] - g_RT[45] + g_RT[48];
-    Kc[456] = g_RT[1] - g_RT[12] + g_RT[48] - g_RT[66];
-    Kc[457] = -g_RT[0] + g_RT[1] - g_RT[45] + g_RT[48];
-    Kc[458] = g_RT[3] - g_RT[6] - g_RT[45] + g_RT[48];
-    Kc[459] = -g_RT[4] + g_RT[6] - g_RT[17] + g_RT[48] - g_RT[66];
-    Kc[460] = -g_RT[14] + g_RT[16] - g_RT[47] + g_RT[48];
-    Kc[461] = g_RT[12] - g_RT[13] - g_RT[45] + g_RT[48];
-    Kc[462] = g_RT[23] + g_RT[24] - g_RT[48];
-
-#ifdef __INTEL_COMPILER
-     #pragma simd
-#endif
-    for (int i=0; i<463; ++i) {
-        Kc[i] = exp(Kc[i]);
-    };
-
     /*reference concentration: P_atm / (RT) in inverse mol/m^3 */
     double refC = 101325 / 8.31451 * invT;
     double refCinv = 1 / refC;
 
-    Kc[0] *= refCinv;
-    Kc[1] *= refCinv;
-    Kc[2] *= refCinv;
-    Kc[3] *= refCinv;
-    Kc[4] *= refCinv;
-    Kc[5] *= refCinv;
-    Kc[6] *= refCinv;
-    Kc[7] *= refCinv;
-    Kc[8] *= refCinv;
-    Kc[9] *= refCinv;
-    Kc[10] *= refCinv;
-    Kc[11] *= refCinv;
-    Kc[12] *= refCinv;
-    Kc[13] *= refCinv;
-    Kc[14] *= refCinv;
-    Kc[15] *= refCinv;
-    Kc[16] *= refCinv;
-    Kc[17] *= refCinv;
-    Kc[18] *= refCinv;
-    Kc[19] *= refC;
-    Kc[20] *= refCinv;
-    Kc[21] *= refCinv;
-    Kc[22] *= refCinv;
-    Kc[23] *= refCinv;
-    Kc[24] *= refCinv;
-    Kc[25] *= refCinv;
-    Kc[26] *= refCinv;
-    Kc[27] *= refCinv;
-    Kc[28] *= refCinv;
-    Kc[29] *= refCinv;
-    Kc[30] *= refCinv;
-    Kc[31] *= refCinv;
-    Kc[32] *= refCinv;
-    Kc[33] *= refCinv;
-    Kc[34] *= refCinv;
-    Kc[35] *= refCinv;
-    Kc[36] *= refCinv;
-    Kc[37] *= refCinv;
-    Kc[38] *= refCinv;
-    Kc[39] *= refCinv;
-    Kc[40] *= refCinv;
-    Kc[41] *= refCinv;
-    Kc[42] *= refC;
-    Kc[67] *= refC;
-    Kc[72] *= refCinv;
-    Kc[73] *= refCinv;
-    Kc[74] *= refCinv;
-    Kc[75] *= refCinv;
-    Kc[77] *= refCinv;
-    Kc[78] *= refCinv;
-    Kc[79] *= refCinv;
-    Kc[155] *= refC;
-    Kc[163] *= refC;
-    Kc[183] *= refC;
-    Kc[191] *= refC;
-    Kc[192] *= refC;
-    Kc[193] *= refC;
-    Kc[198] *= refC;
-    Kc[200] *= refC;
-    Kc[205] *= refC;
-    Kc[206] *= refC;
-    Kc[208] *= refC;
-    Kc[209] *= refC;
-    Kc[210] *= refC;
-    Kc[211] *= refC;
-    Kc[212] *= refC;
-    Kc[213] *= refC;
-    Kc[214] *= refC;
-    Kc[226] *= refC;
-    Kc[227] *= refCinv;
-    Kc[228] *= refCinv;
-    Kc[229] *= refCinv;
-    Kc[234] *= refC;
-    Kc[240] *= refCinv;
-    Kc[241] *= refCinv;
-    Kc[250] *= refCinv;
-    Kc[251] *= refCinv;
-    Kc[275] *= refC;
-    Kc[283] *= refC;
-    Kc[289] *= refC;
-    Kc[300] *= refC;
-    Kc[301] *= refCinv;
-    Kc[303] *= refC;
-    Kc[305] *= refC;
-    Kc[308] *= refC;
-    Kc[311] *= refC;
-    Kc[318] *= refC;
-    Kc[319] *= refC;
-    Kc[320] *= refC;
-    Kc[325] *= refCinv;
-    Kc[326] *= refCinv;
-    Kc[328] *= refCinv;
-    Kc[331] *= refCinv;
-    Kc[332] *= refCinv;
-    Kc[334] *= refCinv;
-    Kc[335] *= refCinv;
-    Kc[338] *= refCinv;
-    Kc[351] *= refCinv;
-    Kc[352] *= refCinv;
-    Kc[361] *= refCinv;
-    Kc[362] *= refCinv;
-    Kc[368] *= refCinv;
-    Kc[369] *= refCinv;
-    Kc[376] *= refC;
-    Kc[377] *= refC;
-    Kc[382] *= refC;
-    Kc[401] *= refCinv;
-    Kc[403] *= refCinv;
-    Kc[405] *= refCinv;
-    Kc[409] *= refCinv;
-    Kc[411] *= refCinv;
-    Kc[414] *= refC;
-    Kc[415] *= refCinv;
-    Kc[419] *= refCinv;
-    Kc[425] *= refC;
-    Kc[427] *= refC*refC;
-    Kc[437] *= refC;
-    Kc[438] *= refC;
-    Kc[440] *= refC;
-    Kc[441] *= refC;
-    Kc[443] *= refC*refC;
-    Kc[444] *= refC;
-    Kc[455] *= refC;
-    Kc[459] *= refC;
-    Kc[462] *= refCinv;
+    /*Kc as the ratio of the products of the species exp(g_RT)/refC, unless */
+    /*the product over a side of a reaction leaves the normal range */
+    double e_g[70], den[463];
+    for (int k=0; k<70; ++k) {
+        e_g[k] = exp(g_RT[k]) * refCinv;
+    }
+    Kc[0] = e_g[1]*e_g[10]; den[0] = e_g[12];
+    Kc[1] = e_g[1]*e_g[12]; den[1] = e_g[13];
+    Kc[2] = e_g[1]*e_g[16]; den[2] = e_g[17];
+    Kc[3] = e_g[1]*e_g[17]; den[3] = e_g[18];
+    Kc[4] = e_g[1]*e_g[17]; den[4] = e_g[19];
+    Kc[5] = e_g[1]*e_g[18]; den[5] = e_g[20];
+    Kc[6] = e_g[1]*e_g[19]; den[6] = e_g[20];
+    Kc[7] = e_g[1]*e_g[21]; den[7] = e_g[22];
+    Kc[8] = e_g[1]*e_g[22]; den[8] = e_g[23];
+    Kc[9] = e_g[1]*e_g[23]; den[9] = e_g[24];
+    Kc[10] = e_g[1]*e_g[24]; den[10] = e_g[25];
+    Kc[11] = e_g[1]*e_g[25]; den[11] = e_g[26];
+    Kc[12] = e_g[0]*e_g[14]; den[12] = e_g[17];
+    Kc[13] = e_g[4]*e_g[4]; den[13] = e_g[7];
+    Kc[14] = e_g[4]*e_g[12]; den[14] = e_g[20];
+    Kc[15] = e_g[9]*e_g[14]; den[15] = e_g[27];
+    Kc[16] = e_g[10]*e_g[14]; den[16] = e_g[28];
+    Kc[17] = e_g[5]*e_g[11]; den[17] = e_g[20];
+    Kc[18] = e_g[12]*e_g[12]; den[18] = e_g[26];
+    Kc[19] = e_g[24]; den[19] = e_g[0]*e_g[22];
+    Kc[20] = e_g[0]*e_g[9]; den[20] = e_g[12];
+    Kc[21] = e_g[1]*e_g[28]; den[21] = e_g[32];
+    Kc[22] = e_g[1]*e_g[63]; den[22] = e_g[62];
+    Kc[23] = e_g[1]*e_g[64]; den[23] = e_g[62];
+    Kc[24] = e_g[1]*e_g[65]; den[24] = e_g[63];
+    Kc[25] = e_g[1]*e_g[65]; den[25] = e_g[64];
+    Kc[26] = e_g[1]*e_g[66]; den[26] = e_g[65];
+    Kc[27] = e_g[12]*e_g[23]; den[27] = e_g[65];
+    Kc[28] = e_g[12]*e_g[25]; den[28] = e_g[62];
+    Kc[29] = e_g[12]*e_g[34]; den[29] = e_g[46];
+    Kc[30] = e_g[1]*e_g[54]; den[30] = e_g[53];
+    Kc[31] = e_g[1]*e_g[55]; den[31] = e_g[56];
+    Kc[32] = e_g[1]*e_g[58]; den[32] = e_g[57];
+    Kc[33] = e_g[12]*e_g[66]; den[33] = e_g[47];
+    Kc[34] = e_g[1]*e_g[48]; den[34] = e_g[47];
+    Kc[35] = e_g[23]*e_g[25]; den[35] = e_g[47];
+    Kc[36] = e_g[2]*e_g[14]; den[36] = e_g[15];
+    Kc[37] = e_g[2]*e_g[2]; den[37] = e_g[3];
+    Kc[38] = e_g[1]*e_g[2]; den[38] = e_g[4];
+    Kc[39] = e_g[1]*e_g[3]; den[39] = e_g[6];
+    Kc[40] = e_g[1]*e_g[1]; den[40] = e_g[0];
+    Kc[41] = e_g[1]*e_g[4]; den[41] = e_g[5];
+    Kc[42] = e_g[16]; den[42] = e_g[1]*e_g[14];
+    Kc[43] = e_g[0]*e_g[2]; den[43] = e_g[1]*e_g[4];
+    Kc[44] = e_g[2]*e_g[6]; den[44] = e_g[3]*e_g[4];
+    Kc[45] = e_g[2]*e_g[7]; den[45] = e_g[4]*e_g[6];
+    Kc[46] = e_g[2]*e_g[9]; den[46] = e_g[1]*e_g[14];
+    Kc[47] = e_g[2]*e_g[10]; den[47] = e_g[1]*e_g[16];
+    Kc[48] = e_g[2]*e_g[11]; den[48] = e_g[0]*e_g[14];
+    Kc[49] = e_g[2]*e_g[11]; den[49] = e_g[1]*e_g[16];
+    Kc[50] = e_g[2]*e_g[12]; den[50] = e_g[1]*e_g[17];
+    Kc[51] = e_g[2]*e_g[13]; den[51] = e_g[4]*e_g[12];
+    Kc[52] = e_g[2]*e_g[16]; den[52] = e_g[4]*e_g[14];
+    Kc[53] = e_g[2]*e_g[16]; den[53] = e_g[1]*e_g[15];
+    Kc[54] = e_g[2]*e_g[17]; den[54] = e_g[4]*e_g[16];
+    Kc[55] = e_g[2]*e_g[18]; den[55] = e_g[4]*e_g[17];
+    Kc[56] = e_g[2]*e_g[19]; den[56] = e_g[4]*e_g[17];
+    Kc[57] = e_g[2]*e_g[20]; den[57] = e_g[4]*e_g[18];
+    Kc[58] = e_g[2]*e_g[20]; den[58] = e_g[4]*e_g[19];
+    Kc[59] = e_g[2]*e_g[21]; den[59] = e_g[9]*e_g[14];
+    Kc[60] = e_g[2]*e_g[22]; den[60] = e_g[1]*e_g[27];
+    Kc[61] = e_g[2]*e_g[22]; den[61] = e_g[4]*e_g[21];
+    Kc[62] = e_g[2]*e_g[22]; den[62] = e_g[10]*e_g[14];
+    Kc[63] = e_g[2]*e_g[23]; den[63] = e_g[1]*e_g[28];
+    Kc[64] = e_g[2]*e_g[24]; den[64] = e_g[12]*e_g[16];
+    Kc[65] = e_g[2]*e_g[25]; den[65] = e_g[12]*e_g[17];
+    Kc[66] = e_g[2]*e_g[26]; den[66] = e_g[4]*e_g[25];
+    Kc[67] = e_g[2]*e_g[27]; den[67] = e_g[1]*e_g[14]*e_g[14];
+    Kc[68] = e_g[2]*e_g[28]; den[68] = e_g[4]*e_g[27];
+    Kc[69] = e_g[2]*e_g[28]; den[69] = e_g[10]*e_g[15];
+    Kc[70] = e_g[3]*e_g[14]; den[70] = e_g[2]*e_g[15];
+    Kc[71] = e_g[3]*e_g[17]; den[71] = e_g[6]*e_g[16];
+    Kc[72] = e_g[1]*e_g[3]*e_g[3]; den[72] = e_g[3]*e_g[6];
+    Kc[73] = e_g[1]*e_g[3]*e_g[5]; den[73] = e_g[5]*e_g[6];
+    Kc[74] = e_g[1]*e_g[3]*e_g[31]; den[74] = e_g[6]*e_g[31];
+    Kc[75] = e_g[1]*e_g[3]*e_g[30]; den[75] = e_g[6]*e_g[30];
+    Kc[76] = e_g[1]*e_g[3]; den[76] = e_g[2]*e_g[4];
+    Kc[77] = e_g[0]*e_g[1]*e_g[1]; den[77] = e_g[0]*e_g[0];
+    Kc[78] = e_g[1]*e_g[1]*e_g[5]; den[78] = e_g[0]*e_g[5];
+    Kc[79] = e_g[1]*e_g[1]*e_g[15]; den[79] = e_g[0]*e_g[15];
+    Kc[80] = e_g[1]*e_g[6]; den[80] = e_g[2]*e_g[5];
+    Kc[81] = e_g[1]*e_g[6]; den[81] = e_g[0]*e_g[3];
+    Kc[82] = e_g[1]*e_g[6]; den[82] = e_g[4]*e_g[4];
+    Kc[83] = e_g[1]*e_g[7]; den[83] = e_g[0]*e_g[6];
+    Kc[84] = e_g[1]*e_g[7]; den[84] = e_g[4]*e_g[5];
+    Kc[85] = e_g[1]*e_g[9]; den[85] = e_g[0]*e_g[8];
+    Kc[86] = e_g[1]*e_g[11]; den[86] = e_g[0]*e_g[9];
+    Kc[87] = e_g[1]*e_g[13]; den[87] = e_g[0]*e_g[12];
+    Kc[88] = e_g[1]*e_g[16]; den[88] = e_g[0]*e_g[14];
+    Kc[89] = e_g[1]*e_g[17]; den[89] = e_g[0]*e_g[16];
+    Kc[90] = e_g[1]*e_g[18]; den[90] = e_g[0]*e_g[17];
+    Kc[91] = e_g[1]*e_g[18]; den[91] = e_g[4]*e_g[12];
+    Kc[92] = e_g[1]*e_g[18]; den[92] = e_g[5]*e_g[11];
+    Kc[93] = e_g[1]*e_g[19]; den[93] = e_g[1]*e_g[18];
+    Kc[94] = e_g[1]*e_g[19]; den[94] = e_g[0]*e_g[17];
+    Kc[95] = e_g[1]*e_g[19]; den[95] = e_g[4]*e_g[12];
+    Kc[96] = e_g[1]*e_g[19]; den[96] = e_g[5]*e_g[11];
+    Kc[97] = e_g[1]*e_g[20]; den[97] = e_g[0]*e_g[18];
+    Kc[98] = e_g[1]*e_g[20]; den[98] = e_g[0]*e_g[19];
+    Kc[99] = e_g[1]*e_g[23]; den[99] = e_g[0]*e_g[22];
+    Kc[100] = e_g[1]*e_g[24]; den[100] = e_g[0]*e_g[23];
+    Kc[101] = e_g[1]*e_g[25]; den[101] = e_g[0]*e_g[24];
+    Kc[102] = e_g[1]*e_g[26]; den[102] = e_g[0]*e_g[25];
+    Kc[103] = e_g[1]*e_g[27]; den[103] = e_g[11]*e_g[14];
+    Kc[104] = e_g[1]*e_g[28]; den[104] = e_g[0]*e_g[27];
+    Kc[105] = e_g[1]*e_g[28]; den[105] = e_g[12]*e_g[14];
+    Kc[106] = e_g[1]*e_g[29]; den[106] = e_g[1]*e_g[28];
+    Kc[107] = e_g[0]*e_g[4]; den[107] = e_g[1]*e_g[5];
+    Kc[108] = e_g[4]*e_g[4]; den[108] = e_g[2]*e_g[5];
+    Kc[109] = e_g[4]*e_g[6]; den[109] = e_g[3]*e_g[5];
+    Kc[110] = e_g[4]*e_g[7]; den[110] = e_g[5]*e_g[6];
+    Kc[111] = e_g[4]*e_g[7]; den[111] = e_g[5]*e_g[6];
+    Kc[112] = e_g[4]*e_g[8]; den[112] = e_g[1]*e_g[14];
+    Kc[113] = e_g[4]*e_g[9]; den[113] = e_g[1]*e_g[16];
+    Kc[114] = e_g[4]*e_g[10]; den[114] = e_g[1]*e_g[17];
+    Kc[115] = e_g[4]*e_g[10]; den[115] = e_g[5]*e_g[9];
+    Kc[116] = e_g[4]*e_g[11]; den[116] = e_g[1]*e_g[17];
+    Kc[117] = e_g[4]*e_g[12]; den[117] = e_g[5]*e_g[10];
+    Kc[118] = e_g[4]*e_g[12]; den[118] = e_g[5]*e_g[11];
+    Kc[119] = e_g[4]*e_g[13]; den[119] = e_g[5]*e_g[12];
+    Kc[120] = e_g[4]*e_g[14]; den[120] = e_g[1]*e_g[15];
+    Kc[121] = e_g[4]*e_g[16]; den[121] = e_g[5]*e_g[14];
+    Kc[122] = e_g[4]*e_g[17]; den[122] = e_g[5]*e_g[16];
+    Kc[123] = e_g[4]*e_g[18]; den[123] = e_g[5]*e_g[17];
+    Kc[124] = e_g[4]*e_g[19]; den[124] = e_g[5]*e_g[17];
+    Kc[125] = e_g[4]*e_g[20]; den[125] = e_g[5]*e_g[18];
+    Kc[126] = e_g[4]*e_g[20]; den[126] = e_g[5]*e_g[19];
+    Kc[127] = e_g[4]*e_g[21]; den[127] = e_g[1]*e_g[27];
+    Kc[128] = e_g[4]*e_g[22]; den[128] = e_g[1]*e_g[28];
+    Kc[129] = e_g[4]*e_g[22]; den[129] = e_g[1]*e_g[29];
+    Kc[130] = e_g[4]*e_g[22]; den[130] = e_g[5]*e_g[21];
+    Kc[131] = e_g[4]*e_g[22]; den[131] = e_g[12]*e_g[14];
+    Kc[132] = e_g[4]*e_g[23]; den[132] = e_g[5]*e_g[22];
+    Kc[133] = e_g[4]*e_g[24]; den[133] = e_g[5]*e_g[23];
+    Kc[134] = e_g[4]*e_g[26]; den[134] = e_g[5]*e_g[25];
+    Kc[135] = e_g[4]*e_g[28]; den[135] = e_g[5]*e_g[27];
+    Kc[136] = e_g[6]*e_g[6]; den[136] = e_g[3]*e_g[7];
+    Kc[137] = e_g[6]*e_g[6]; den[137] = e_g[3]*e_g[7];
+    Kc[138] = e_g[6]*e_g[10]; den[138] = e_g[4]*e_g[17];
+    Kc[139] = e_g[6]*e_g[12]; den[139] = e_g[3]*e_g[13];
+    Kc[140] = e_g[6]*e_g[12]; den[140] = e_g[4]*e_g[19];
+    Kc[141] = e_g[6]*e_g[14]; den[141] = e_g[4]*e_g[15];
+    Kc[142] = e_g[6]*e_g[17]; den[142] = e_g[7]*e_g[16];
+    Kc[143] = e_g[3]*e_g[8]; den[143] = e_g[2]*e_g[14];
+    Kc[144] = e_g[8]*e_g[10]; den[144] = e_g[1]*e_g[21];
+    Kc[145] = e_g[8]*e_g[12]; den[145] = e_g[1]*e_g[22];
+    Kc[146] = e_g[3]*e_g[9]; den[146] = e_g[2]*e_g[16];
+    Kc[147] = e_g[0]*e_g[9]; den[147] = e_g[1]*e_g[10];
+    Kc[148] = e_g[5]*e_g[9]; den[148] = e_g[1]*e_g[17];
+    Kc[149] = e_g[9]*e_g[10]; den[149] = e_g[1]*e_g[22];
+    Kc[150] = e_g[9]*e_g[12]; den[150] = e_g[1]*e_g[23];
+    Kc[151] = e_g[9]*e_g[13]; den[151] = e_g[1]*e_g[24];
+    Kc[152] = e_g[9]*e_g[15]; den[152] = e_g[14]*e_g[16];
+    Kc[153] = e_g[9]*e_g[17]; den[153] = e_g[1]*e_g[28];
+    Kc[154] = e_g[9]*e_g[27]; den[154] = e_g[14]*e_g[22];
+    Kc[155] = e_g[3]*e_g[10]; den[155] = e_g[1]*e_g[4]*e_g[14];
+    Kc[156] = e_g[0]*e_g[10]; den[156] = e_g[1]*e_g[12];
+    Kc[157] = e_g[10]*e_g[10]; den[157] = e_g[0]*e_g[22];
+    Kc[158] = e_g[10]*e_g[12]; den[158] = e_g[1]*e_g[24];
+    Kc[159] = e_g[10]*e_g[13]; den[159] = e_g[12]*e_g[12];
+    Kc[160] = e_g[10]*e_g[27]; den[160] = e_g[14]*e_g[23];
+    Kc[161] = e_g[11]*e_g[31]; den[161] = e_g[10]*e_g[31];
+    Kc[162] = e_g[11]*e_g[30]; den[162] = e_g[10]*e_g[30];
+    Kc[163] = e_g[3]*e_g[11]; den[163] = e_g[1]*e_g[4]*e_g[14];
+    Kc[164] = e_g[3]*e_g[11]; den[164] = e_g[5]*e_g[14];
+    Kc[165] = e_g[0]*e_g[11]; den[165] = e_g[1]*e_g[12];
+    Kc[166] = e_g[5]*e_g[11]; den[166] = e_g[5]*e_g[10];
+    Kc[167] = e_g[11]*e_g[12]; den[167] = e_g[1]*e_g[24];
+    Kc[168] = e_g[11]*e_g[13]; den[168] = e_g[12]*e_g[12];
+    Kc[169] = e_g[11]*e_g[14]; den[169] = e_g[10]*e_g[14];
+    Kc[170] = e_g[11]*e_g[15]; den[170] = e_g[10]*e_g[15];
+    Kc[171] = e_g[11]*e_g[15]; den[171] = e_g[14]*e_g[17];
+    Kc[172] = e_g[11]*e_g[26]; den[172] = e_g[12]*e_g[25];
+    Kc[173] = e_g[3]*e_g[12]; den[173] = e_g[2]*e_g[19];
+    Kc[174] = e_g[3]*e_g[12]; den[174] = e_g[4]*e_g[17];
+    Kc[175] = e_g[7]*e_g[12]; den[175] = e_g[6]*e_g[13];
+    Kc[176] = e_g[12]*e_g[12]; den[176] = e_g[1]*e_g[25];
+    Kc[177] = e_g[12]*e_g[16]; den[177] = e_g[13]*e_g[14];
+    Kc[178] = e_g[12]*e_g[17]; den[178] = e_g[13]*e_g[16];
+    Kc[179] = e_g[12]*e_g[20]; den[179] = e_g[13]*e_g[18];
+    Kc[180] = e_g[12]*e_g[20]; den[180] = e_g[13]*e_g[19];
+    Kc[181] = e_g[12]*e_g[24]; den[181] = e_g[13]*e_g[23];
+    Kc[182] = e_g[12]*e_g[26]; den[182] = e_g[13]*e_g[25];
+    Kc[183] = e_g[5]*e_g[16]; den[183] = e_g[1]*e_g[5]*e_g[14];
+    Kc[184] = e_g[3]*e_g[16]; den[184] = e_g[6]*e_g[14];
+    Kc[185] = e_g[3]*e_g[18]; den[185] = e_g[6]*e_g[17];
+    Kc[186] = e_g[3]*e_g[19]; den[186] = e_g[6]*e_g[17];
+    Kc[187] = e_g[3]*e_g[21]; den[187] = e_g[14]*e_g[16];
+    Kc[188] = e_g[0]*e_g[21]; den[188] = e_g[1]*e_g[22];
+    Kc[189] = e_g[3]*e_g[23]; den[189] = e_g[16]*e_g[17];
+    Kc[190] = e_g[3]*e_g[25]; den[190] = e_g[6]*e_g[24];
+    Kc[191] = e_g[3]*e_g[27]; den[191] = e_g[4]*e_g[14]*e_g[14];
+    Kc[192] = e_g[27]*e_g[27]; den[192] = e_g[14]*e_g[14]*e_g[22];
+    Kc[193] = e_g[2]*e_g[12]; den[193] = e_g[0]*e_g[1]*e_g[14];
+    Kc[194] = e_g[2]*e_g[24]; den[194] = e_g[1]*e_g[32];
+    Kc[195] = e_g[2]*e_g[25]; den[195] = e_g[1]*e_g[68];
+    Kc[196] = e_g[4]*e_g[6]; den[196] = e_g[3]*e_g[5];
+    Kc[197] = e_g[4]*e_g[12]; den[197] = e_g[0]*e_g[17];
+    Kc[198] = e_g[3]*e_g[10]; den[198] = e_g[1]*e_g[1]*e_g[15];
+    Kc[199] = e_g[3]*e_g[10]; den[199] = e_g[2]*e_g[17];
+    Kc[200] = e_g[10]*e_g[10]; den[200] = e_g[1]*e_g[1]*e_g[22];
+    Kc[201] = e_g[5]*e_g[11]; den[201] = e_g[0]*e_g[17];
+    Kc[202] = e_g[3]*e_g[23]; den[202] = e_g[2]*e_g[32];
+    Kc[203] = e_g[3]*e_g[23]; den[203] = e_g[6]*e_g[22];
+    Kc[204] = e_g[2]*e_g[68]; den[204] = e_g[4]*e_g[32];
+    Kc[205] = e_g[2]*e_g[68]; den[205] = e_g[4]*e_g[12]*e_g[14];
+    Kc[206] = e_g[3]*e_g[68]; den[206] = e_g[6]*e_g[12]*e_g[14];
+    Kc[207] = e_g[1]*e_g[68]; den[207] = e_g[0]*e_g[32];
+    Kc[208] = e_g[1]*e_g[68]; den[208] = e_g[0]*e_g[12]*e_g[14];
+    Kc[209] = e_g[4]*e_g[68]; den[209] = e_g[5]*e_g[12]*e_g[14];
+    Kc[210] = e_g[6]*e_g[68]; den[210] = e_g[7]*e_g[12]*e_g[14];
+    Kc[211] = e_g[12]*e_g[68]; den[211] = e_g[12]*e_g[13]*e_g[14];
+    Kc[212] = e_g[2]*e_g[32]; den[212] = e_g[1]*e_g[10]*e_g[15];
+    Kc[213] = e_g[3]*e_g[32]; den[213] = e_g[4]*e_g[14]*e_g[17];
+    Kc[214] = e_g[3]*e_g[32]; den[214] = e_g[4]*e_g[16]*e_g[16];
+    Kc[215] = e_g[1]*e_g[32]; den[215] = e_g[12]*e_g[16];
+    Kc[216] = e_g[1]*e_g[32]; den[216] = e_g[0]*e_g[28];
+    Kc[217] = e_g[4]*e_g[32]; den[217] = e_g[5]*e_g[28];
+    Kc[218] = e_g[4]*e_g[32]; den[218] = e_g[16]*e_g[18];
+    Kc[219] = e_g[12]*e_g[21]; den[219] = e_g[1]*e_g[34];
+    Kc[220] = e_g[9]*e_g[22]; den[220] = e_g[1]*e_g[33];
+    Kc[221] = e_g[10]*e_g[22]; den[221] = e_g[1]*e_g[34];
+    Kc[222] = e_g[11]*e_g[22]; den[222] = e_g[1]*e_g[34];
+    Kc[223] = e_g[22]*e_g[27]; den[223] = e_g[14]*e_g[34];
+    Kc[224] = e_g[2]*e_g[33]; den[224] = e_g[14]*e_g[22];
+    Kc[225] = e_g[4]*e_g[33]; den[225] = e_g[16]*e_g[22];
+    Kc[226] = e_g[3]*e_g[33]; den[226] = e_g[1]*e_g[14]*e_g[27];
+    Kc[227] = e_g[1]*e_g[33]; den[227] = e_g[34];
+    Kc[228] = e_g[1]*e_g[34]; den[228] = e_g[35];
+    Kc[229] = e_g[1]*e_g[34]; den[229] = e_g[36];
+    Kc[230] = e_g[1]*e_g[34]; den[230] = e_g[0]*e_g[33];
+    Kc[231] = e_g[2]*e_g[34]; den[231] = e_g[17]*e_g[21];
+    Kc[232] = e_g[4]*e_g[34]; den[232] = e_g[5]*e_g[33];
+    Kc[233] = e_g[3]*e_g[34]; den[233] = e_g[16]*e_g[28];
+    Kc[234] = e_g[6]*e_g[34]; den[234] = e_g[4]*e_g[14]*e_g[23];
+    Kc[235] = e_g[6]*e_g[34]; den[235] = e_g[3]*e_g[36];
+    Kc[236] = e_g[6]*e_g[34]; den[236] = e_g[3]*e_g[35];
+    Kc[237] = e_g[16]*e_g[34]; den[237] = e_g[14]*e_g[36];
+    Kc[238] = e_g[16]*e_g[34]; den[238] = e_g[14]*e_g[35];
+    Kc[239] = e_g[1]*e_g[36]; den[239] = e_g[0]*e_g[34];
+    Kc[240] = e_g[1]*e_g[36]; den[240] = e_g[67];
+    Kc[241] = e_g[1]*e_g[36]; den[241] = e_g[66];
+    Kc[242] = e_g[2]*e_g[36]; den[242] = e_g[14]*e_g[24];
+    Kc[243] = e_g[4]*e_g[36]; den[243] = e_g[5]*e_g[34];
+    Kc[244] = e_g[12]*e_g[36]; den[244] = e_g[13]*e_g[34];
+    Kc[245] = e_g[21]*e_g[36]; den[245] = e_g[22]*e_g[34];
+    Kc[246] = e_g[35]; den[246] = e_g[37];
+    Kc[247] = e_g[35]; den[247] = e_g[36];
+    Kc[248] = e_g[37]; den[248] = e_g[36];
+    Kc[249] = e_g[1]*e_g[35]; den[249] = e_g[1]*e_g[36];
+    Kc[250] = e_g[1]*e_g[35]; den[250] = e_g[67];
+    Kc[251] = e_g[1]*e_g[35]; den[251] = e_g[66];
+    Kc[252] = e_g[1]*e_g[35]; den[252] = e_g[0]*e_g[34];
+    Kc[253] = e_g[2]*e_g[35]; den[253] = e_g[12]*e_g[27];
+    Kc[254] = e_g[2]*e_g[35]; den[254] = e_g[14]*e_g[24];
+    Kc[255] = e_g[4]*e_g[35]; den[255] = e_g[5]*e_g[34];
+    Kc[256] = e_g[21]*e_g[35]; den[256] = e_g[22]*e_g[34];
+    Kc[257] = e_g[12]*e_g[35]; den[257] = e_g[13]*e_g[34];
+    Kc[258] = e_g[1]*e_g[62]; den[258] = e_g[0]*e_g[63];
+    Kc[259] = e_g[1]*e_g[62]; den[259] = e_g[0]*e_g[64];
+    Kc[260] = e_g[2]*e_g[62]; den[260] = e_g[4]*e_g[63];
+    Kc[261] = e_g[2]*e_g[62]; den[261] = e_g[4]*e_g[64];
+    Kc[262] = e_g[4]*e_g[62]; den[262] = e_g[5]*e_g[63];
+    Kc[263] = e_g[4]*e_g[62]; den[263] = e_g[5]*e_g[64];
+    Kc[264] = e_g[3]*e_g[62]; den[264] = e_g[6]*e_g[63];
+    Kc[265] = e_g[3]*e_g[62]; den[265] = e_g[6]*e_g[64];
+    Kc[266] = e_g[6]*e_g[62]; den[266] = e_g[7]*e_g[63];
+    Kc[267] = e_g[6]*e_g[62]; den[267] = e_g[7]*e_g[64];
+    Kc[268] = e_g[12]*e_g[62]; den[268] = e_g[13]*e_g[63];
+    Kc[269] = e_g[12]*e_g[62]; den[269] = e_g[13]*e_g[64];
+    Kc[270] = e_g[1]*e_g[63]; den[270] = e_g[12]*e_g[25];
+    Kc[271] = e_g[1]*e_g[63]; den[271] = e_g[0]*e_g[65];
+    Kc[272] = e_g[2]*e_g[63]; den[272] = e_g[17]*e_g[25];
+    Kc[273] = e_g[4]*e_g[63]; den[273] = e_g[5]*e_g[65];
+    Kc[274] = e_g[3]*e_g[63]; den[274] = e_g[6]*e_g[65];
+    Kc[275] = e_g[6]*e_g[63]; den[275] = e_g[4]*e_g[17]*e_g[25];
+    Kc[276] = e_g[16]*e_g[63]; den[276] = e_g[14]*e_g[62];
+    Kc[277] = e_g[12]*e_g[63]; den[277] = e_g[13]*e_g[65];
+    Kc[278] = e_g[1]*e_g[64]; den[278] = e_g[12]*e_g[25];
+    Kc[279] = e_g[1]*e_g[64]; den[279] = e_g[0]*e_g[65];
+    Kc[280] = e_g[2]*e_g[64]; den[280] = e_g[12]*e_g[68];
+    Kc[281] = e_g[4]*e_g[64]; den[281] = e_g[5]*e_g[65];
+    Kc[282] = e_g[3]*e_g[64]; den[282] = e_g[6]*e_g[65];
+    Kc[283] = e_g[6]*e_g[64]; den[283] = e_g[4]*e_g[12]*e_g[68];
+    Kc[284] = e_g[16]*e_g[64]; den[284] = e_g[14]*e_g[62];
+    Kc[285] = e_g[12]*e_g[64]; den[285] = e_g[13]*e_g[65];
+    Kc[286] = e_g[1]*e_g[65]; den[286] = e_g[12]*e_g[24];
+    Kc[287] = e_g[1]*e_g[65]; den[287] = e_g[0]*e_g[66];
+    Kc[288] = e_g[1]*e_g[65]; den[288] = e_g[0]*e_g[67];
+    Kc[289] = e_g[2]*e_g[65]; den[289] = e_g[1]*e_g[12]*e_g[28];
+    Kc[290] = e_g[2]*e_g[65]; den[290] = e_g[16]*e_g[25];
+    Kc[291] = e_g[2]*e_g[65]; den[291] = e_g[4]*e_g[66];
+    Kc[292] = e_g[2]*e_g[65]; den[292] = e_g[4]*e_g[67];
+    Kc[293] = e_g[4]*e_g[65]; den[293] = e_g[5]*e_g[66];
+    Kc[294] = e_g[4]*e_g[65]; den[294] = e_g[5]*e_g[67];
+    Kc[295] = e_g[6]*e_g[65]; den[295] = e_g[7]*e_g[66];
+    Kc[296] = e_g[12]*e_g[65]; den[296] = e_g[13]*e_g[66];
+    Kc[297] = e_g[12]*e_g[65]; den[297] = e_g[13]*e_g[67];
+    Kc[298] = e_g[1]*e_g[66]; den[298] = e_g[0]*e_g[36];
+    Kc[299] = e_g[2]*e_g[66]; den[299] = e_g[1]*e_g[69];
+    Kc[300] = e_g[4]*e_g[66]; den[300] = e_g[1]*e_g[1]*e_g[69];
+    Kc[301] = e_g[16]*e_g[23]; den[301] = e_g[69];
+    Kc[302] = e_g[1]*e_g[69]; den[302] = e_g[16]*e_g[24];
+    Kc[303] = e_g[2]*e_g[69]; den[303] = e_g[4]*e_g[14]*e_g[23];
+    Kc[304] = e_g[2]*e_g[69]; den[304] = e_g[17]*e_g[28];
+    Kc[305] = e_g[4]*e_g[69]; den[305] = e_g[5]*e_g[14]*e_g[23];
+    Kc[306] = e_g[4]*e_g[66]; den[306] = e_g[5]*e_g[36];
+    Kc[307] = e_g[3]*e_g[66]; den[307] = e_g[6]*e_g[36];
+    Kc[308] = e_g[3]*e_g[66]; den[308] = e_g[12]*e_g[14]*e_g[17];
+    Kc[309] = e_g[3]*e_g[66]; den[309] = e_g[4]*e_g[69];
+    Kc[310] = e_g[6]*e_g[66]; den[310] = e_g[3]*e_g[65];
+    Kc[311] = e_g[6]*e_g[66]; den[311] = e_g[4]*e_g[17]*e_g[23];
+    Kc[312] = e_g[16]*e_g[66]; den[312] = e_g[14]*e_g[65];
+    Kc[313] = e_g[12]*e_g[66]; den[313] = e_g[13]*e_g[36];
+    Kc[314] = e_g[66]*e_g[66]; den[314] = e_g[36]*e_g[65];
+    Kc[315] = e_g[66]; den[315] = e_g[67];
+    Kc[316] = e_g[1]*e_g[67]; den[316] = e_g[0]*e_g[35];
+    Kc[317] = e_g[2]*e_g[67]; den[317] = e_g[12]*e_g[28];
+    Kc[318] = e_g[4]*e_g[67]; den[318] = e_g[1]*e_g[12]*e_g[28];
+    Kc[319] = e_g[3]*e_g[67]; den[319] = e_g[12]*e_g[14]*e_g[17];
+    Kc[320] = e_g[6]*e_g[67]; den[320] = e_g[4]*e_g[12]*e_g[28];
+    Kc[321] = e_g[16]*e_g[67]; den[321] = e_g[14]*e_g[65];
+    Kc[322] = e_g[12]*e_g[67]; den[322] = e_g[13]*e_g[35];
+    Kc[323] = e_g[12]*e_g[22]; den[323] = e_g[1]*e_g[35];
+    Kc[324] = e_g[12]*e_g[22]; den[324] = e_g[1]*e_g[36];
+    Kc[325] = e_g[12]*e_g[22]; den[325] = e_g[67];
+    Kc[326] = e_g[12]*e_g[22]; den[326] = e_g[66];
+    Kc[327] = e_g[12]*e_g[23]; den[327] = e_g[1]*e_g[66];
+    Kc[328] = e_g[12]*e_g[24]; den[328] = e_g[63];
+    Kc[329] = e_g[23]*e_g[25]; den[329] = e_g[12]*e_g[66];
+    Kc[330] = e_g[21]*e_g[22]; den[330] = e_g[1]*e_g[38];
+    Kc[331] = e_g[21]*e_g[22]; den[331] = e_g[40];
+    Kc[332] = e_g[21]*e_g[22]; den[332] = e_g[41];
+    Kc[333] = e_g[22]*e_g[23]; den[333] = e_g[1]*e_g[42];
+    Kc[334] = e_g[22]*e_g[23]; den[334] = e_g[43];
+    Kc[335] = e_g[22]*e_g[23]; den[335] = e_g[44];
+    Kc[336] = e_g[21]*e_g[24]; den[336] = e_g[1]*e_g[42];
+    Kc[337] = e_g[23]*e_g[24]; den[337] = e_g[1]*e_g[45];
+    Kc[338] = e_g[23]*e_g[23]; den[338] = e_g[45];
+    Kc[339] = e_g[23]*e_g[23]; den[339] = e_g[1]*e_g[44];
+    Kc[340] = e_g[23]*e_g[23]; den[340] = e_g[1]*e_g[43];
+    Kc[341] = e_g[9]*e_g[33]; den[341] = e_g[1]*e_g[38];
+    Kc[342] = e_g[10]*e_g[33]; den[342] = e_g[1]*e_g[40];
+    Kc[343] = e_g[12]*e_g[33]; den[343] = e_g[1]*e_g[42];
+    Kc[344] = e_g[27]*e_g[33]; den[344] = e_g[14]*e_g[40];
+    Kc[345] = e_g[27]*e_g[34]; den[345] = e_g[14]*e_g[42];
+    Kc[346] = e_g[9]*e_g[34]; den[346] = e_g[1]*e_g[41];
+    Kc[347] = e_g[10]*e_g[34]; den[347] = e_g[1]*e_g[42];
+    Kc[348] = e_g[1]*e_g[44]; den[348] = e_g[12]*e_g[34];
+    Kc[349] = e_g[35]*e_g[54]; den[349] = e_g[34]*e_g[53];
+    Kc[350] = e_g[36]*e_g[54]; den[350] = e_g[34]*e_g[53];
+    Kc[351] = e_g[1]*e_g[38]; den[351] = e_g[40];
+    Kc[352] = e_g[1]*e_g[38]; den[352] = e_g[41];
+    Kc[353] = e_g[2]*e_g[38]; den[353] = e_g[14]*e_g[33];
+    Kc[354] = e_g[4]*e_g[38]; den[354] = e_g[1]*e_g[39];
+    Kc[355] = e_g[1]*e_g[39]; den[355] = e_g[22]*e_g[27];
+    Kc[356] = e_g[4]*e_g[39]; den[356] = e_g[27]*e_g[28];
+    Kc[357] = e_g[40]; den[357] = e_g[41];
+    Kc[358] = e_g[1]*e_g[40]; den[358] = e_g[1]*e_g[41];
+    Kc[359] = e_g[1]*e_g[40]; den[359] = e_g[22]*e_g[22];
+    Kc[360] = e_g[1]*e_g[41]; den[360] = e_g[22]*e_g[22];
+    Kc[361] = e_g[1]*e_g[40]; den[361] = e_g[42];
+    Kc[362] = e_g[1]*e_g[41]; den[362] = e_g[42];
+    Kc[363] = e_g[1]*e_g[40]; den[363] = e_g[0]*e_g[38];
+    Kc[364] = e_g[1]*e_g[41]; den[364] = e_g[0]*e_g[38];
+    Kc[365] = e_g[4]*e_g[40]; den[365] = e_g[5]*e_g[38];
+    Kc[366] = e_g[4]*e_g[41]; den[366] = e_g[5]*e_g[38];
+    Kc[367] = e_g[3]*e_g[41]; den[367] = e_g[27]*e_g[28];
+    Kc[368] = e_g[1]*e_g[42]; den[368] = e_g[43];
+    Kc[369] = e_g[1]*e_g[42]; den[369] = e_g[44];
+    Kc[370] = e_g[1]*e_g[42]; den[370] = e_g[0]*e_g[40];
+    Kc[371] = e_g[1]*e_g[42]; den[371] = e_g[0]*e_g[41];
+    Kc[372] = e_g[4]*e_g[42]; den[372] = e_g[5]*e_g[40];
+    Kc[373] = e_g[4]*e_g[42]; den[373] = e_g[5]*e_g[41];
+    Kc[374] = e_g[43]; den[374] = e_g[44];
+    Kc[375] = e_g[1]*e_g[43]; den[375] = e_g[1]*e_g[44];
+    Kc[376] = e_g[45]; den[376] = e_g[1]*e_g[44];
+    Kc[377] = e_g[45]; den[377] = e_g[1]*e_g[43];
+    Kc[378] = e_g[1]*e_g[43]; den[378] = e_g[0]*e_g[42];
+    Kc[379] = e_g[1]*e_g[44]; den[379] = e_g[0]*e_g[42];
+    Kc[380] = e_g[4]*e_g[43]; den[380] = e_g[5]*e_g[42];
+    Kc[381] = e_g[4]*e_g[44]; den[381] = e_g[5]*e_g[42];
+    Kc[382] = e_g[3]*e_g[43]; den[382] = e_g[14]*e_g[16]*e_g[24];
+    Kc[383] = e_g[3]*e_g[44]; den[383] = e_g[28]*e_g[32];
+    Kc[384] = e_g[16]*e_g[43]; den[384] = e_g[14]*e_g[45];
+    Kc[385] = e_g[16]*e_g[44]; den[385] = e_g[14]*e_g[45];
+    Kc[386] = e_g[1]*e_g[45]; den[386] = e_g[0]*e_g[43];
+    Kc[387] = e_g[1]*e_g[45]; den[387] = e_g[0]*e_g[44];
+    Kc[388] = e_g[1]*e_g[45]; den[388] = e_g[12]*e_g[35];
+    Kc[389] = e_g[2]*e_g[45]; den[389] = e_g[16]*e_g[66];
+    Kc[390] = e_g[4]*e_g[45]; den[390] = e_g[5]*e_g[43];
+    Kc[391] = e_g[4]*e_g[45]; den[391] = e_g[5]*e_g[44];
+    Kc[392] = e_g[1]*e_g[46]; den[392] = e_g[1]*e_g[45];
+    Kc[393] = e_g[1]*e_g[46]; den[393] = e_g[0]*e_g[44];
+    Kc[394] = e_g[1]*e_g[46]; den[394] = e_g[12]*e_g[36];
+    Kc[395] = e_g[1]*e_g[46]; den[395] = e_g[12]*e_g[35];
+    Kc[396] = e_g[2]*e_g[46]; den[396] = e_g[24]*e_g[28];
+    Kc[397] = e_g[2]*e_g[46]; den[397] = e_g[4]*e_g[44];
+    Kc[398] = e_g[4]*e_g[46]; den[398] = e_g[5]*e_g[44];
+    Kc[399] = e_g[46]; den[399] = e_g[45];
+    Kc[400] = e_g[21]*e_g[38]; den[400] = e_g[1]*e_g[49];
+    Kc[401] = e_g[21]*e_g[38]; den[401] = e_g[50];
+    Kc[402] = e_g[34]*e_g[34]; den[402] = e_g[1]*e_g[54];
+    Kc[403] = e_g[34]*e_g[34]; den[403] = e_g[53];
+    Kc[404] = e_g[22]*e_g[40]; den[404] = e_g[1]*e_g[51];
+    Kc[405] = e_g[22]*e_g[40]; den[405] = e_g[54];
+    Kc[406] = e_g[22]*e_g[40]; den[406] = e_g[1]*e_g[52];
+    Kc[407] = e_g[21]*e_g[42]; den[407] = e_g[1]*e_g[51];
+    Kc[408] = e_g[22]*e_g[43]; den[408] = e_g[1]*e_g[53];
+    Kc[409] = e_g[1]*e_g[49]; den[409] = e_g[50];
+    Kc[410] = e_g[1]*e_g[50]; den[410] = e_g[22]*e_g[38];
+    Kc[411] = e_g[1]*e_g[50]; den[411] = e_g[51];
+    Kc[412] = e_g[1]*e_g[50]; den[412] = e_g[0]*e_g[49];
+    Kc[413] = e_g[4]*e_g[50]; den[413] = e_g[5]*e_g[49];
+    Kc[414] = e_g[3]*e_g[50]; den[414] = e_g[14]*e_g[27]*e_g[33];
+    Kc[415] = e_g[1]*e_g[51]; den[415] = e_g[54];
+    Kc[416] = e_g[1]*e_g[51]; den[416] = e_g[1]*e_g[52];
+    Kc[417] = e_g[1]*e_g[51]; den[417] = e_g[0]*e_g[50];
+    Kc[418] = e_g[4]*e_g[51]; den[418] = e_g[5]*e_g[50];
+    Kc[419] = e_g[1]*e_g[52]; den[419] = e_g[54];
+    Kc[420] = e_g[1]*e_g[53]; den[420] = e_g[0]*e_g[54];
+    Kc[421] = e_g[4]*e_g[53]; den[421] = e_g[5]*e_g[54];
+    Kc[422] = e_g[2]*e_g[53]; den[422] = e_g[1]*e_g[55];
+    Kc[423] = e_g[4]*e_g[53]; den[423] = e_g[1]*e_g[56];
+    Kc[424] = e_g[3]*e_g[54]; den[424] = e_g[2]*e_g[55];
+    Kc[425] = e_g[55]; den[425] = e_g[14]*e_g[58];
+    Kc[426] = e_g[1]*e_g[55]; den[426] = e_g[14]*e_g[57];
+    Kc[427] = e_g[2]*e_g[55]; den[427] = e_g[14]*e_g[16]*e_g[22]*e_g[22];
+    Kc[428] = e_g[1]*e_g[56]; den[428] = e_g[0]*e_g[55];
+    Kc[429] = e_g[2]*e_g[56]; den[429] = e_g[4]*e_g[55];
+    Kc[430] = e_g[4]*e_g[56]; den[430] = e_g[5]*e_g[55];
+    Kc[431] = e_g[2]*e_g[58]; den[431] = e_g[14]*e_g[43];
+    Kc[432] = e_g[4]*e_g[58]; den[432] = e_g[1]*e_g[60];
+    Kc[433] = e_g[6]*e_g[58]; den[433] = e_g[4]*e_g[59];
+    Kc[434] = e_g[1]*e_g[57]; den[434] = e_g[0]*e_g[58];
+    Kc[435] = e_g[2]*e_g[57]; den[435] = e_g[4]*e_g[58];
+    Kc[436] = e_g[4]*e_g[57]; den[436] = e_g[5]*e_g[58];
+    Kc[437] = e_g[59]; den[437] = e_g[14]*e_g[43];
+    Kc[438] = e_g[1]*e_g[59]; den[438] = e_g[17]*e_g[22]*e_g[22];
+    Kc[439] = e_g[2]*e_g[59]; den[439] = e_g[15]*e_g[43];
+    Kc[440] = e_g[60]; den[440] = e_g[1]*e_g[61];
+    Kc[441] = e_g[1]*e_g[60]; den[441] = e_g[17]*e_g[22]*e_g[22];
+    Kc[442] = e_g[2]*e_g[60]; den[442] = e_g[15]*e_g[43];
+    Kc[443] = e_g[61]; den[443] = e_g[14]*e_g[22]*e_g[22];
+    Kc[444] = e_g[2]*e_g[61]; den[444] = e_g[15]*e_g[22]*e_g[22];
+    Kc[445] = e_g[1]*e_g[47]; den[445] = e_g[24]*e_g[25];
+    Kc[446] = e_g[1]*e_g[47]; den[446] = e_g[12]*e_g[65];
+    Kc[447] = e_g[1]*e_g[47]; den[447] = e_g[0]*e_g[48];
+    Kc[448] = e_g[2]*e_g[47]; den[448] = e_g[16]*e_g[63];
+    Kc[449] = e_g[2]*e_g[47]; den[449] = e_g[4]*e_g[48];
+    Kc[450] = e_g[2]*e_g[47]; den[450] = e_g[4]*e_g[48];
+    Kc[451] = e_g[4]*e_g[47]; den[451] = e_g[5]*e_g[48];
+    Kc[452] = e_g[3]*e_g[47]; den[452] = e_g[6]*e_g[48];
+    Kc[453] = e_g[6]*e_g[47]; den[453] = e_g[7]*e_g[48];
+    Kc[454] = e_g[12]*e_g[47]; den[454] = e_g[13]*e_g[48];
+    Kc[455] = e_g[48]; den[455] = e_g[1]*e_g[45];
+    Kc[456] = e_g[1]*e_g[48]; den[456] = e_g[12]*e_g[66];
+    Kc[457] = e_g[1]*e_g[48]; den[457] = e_g[0]*e_g[45];
+    Kc[458] = e_g[3]*e_g[48]; den[458] = e_g[6]*e_g[45];
+    Kc[459] = e_g[6]*e_g[48]; den[459] = e_g[4]*e_g[17]*e_g[66];
+    Kc[460] = e_g[16]*e_g[48]; den[460] = e_g[14]*e_g[47];
+    Kc[461] = e_g[12]*e_g[48]; den[461] = e_g[13]*e_g[45];
+    Kc[462] = e_g[23]*e_g[24]; den[462] = e_g[48];
+    int inrange = 1;
+    for (int i=0; i<463; ++i) {
+        inrange &= Kc[i] >= DBL_MIN && Kc[i] <= DBL_MAX && den[i] >= DBL_MIN && den[i] <= DBL_MAX;
+    }
+
+    if (inrange) {
+        for (int i=0; i<463; ++i) {
+            Kc[i] /= den[i];
+        }
+    }
+    else {
+        Kc[0] = exp(g_RT[1] + g_RT[10] - g_RT[12]);
+        Kc[1] = exp(g_RT[1] + g_RT[12] - g_RT[13]);
+        Kc[2] = exp(g_RT[1] + g_RT[16] - g_RT[17]);
+        Kc[3] = exp(g_RT[1] + g_RT[17] - g_RT[18]);
+        Kc[4] = exp(g_RT[1] + g_RT[17] - g_RT[19]);
+        Kc[5] = exp(g_RT[1] + g_RT[18] - g_RT[20]);
+        Kc[6] = exp(g_RT[1] + g_RT[19] - g_RT[20]);
+        Kc[7] = exp(g_RT[1] + g_RT[21] - g_RT[22]);
+        Kc[8] = exp(g_RT[1] + g_RT[22] - g_RT[23]);
+        Kc[9] = exp(g_RT[1] + g_RT[23] - g_RT[24]);
+        Kc[10] = exp(g_RT[1] + g_RT[24] - g_RT[25]);
+        Kc[11] = exp(g_RT[1] + g_RT[25] - g_RT[26]);
+        Kc[12] = exp(g_RT[0] + g_RT[14] - g_RT[17]);
+        Kc[13] = exp(2*g_RT[4] - g_RT[7]);
+        Kc[14] = exp(g_RT[4] + g_RT[12] - g_RT[20]);
+        Kc[15] = exp(g_RT[9] + g_RT[14] - g_RT[27]);
+        Kc[16] = exp(g_RT[10] + g_RT[14] - g_RT[28]);
+        Kc[17] = exp(g_RT[5] + g_RT[11] - g_RT[20]);
+        Kc[18] = exp(2*g_RT[12] - g_RT[26]);
+        Kc[19] = exp(-g_RT[0] - g_RT[22] + g_RT[24]);
+        Kc[20] = exp(g_RT[0] + g_RT[9] - g_RT[12]);
+        Kc[21] = exp(g_RT[1] + g_RT[28] - g_RT[32]);
+        Kc[22] = exp(g_RT[1] - g_RT[62] + g_RT[63]);
+        Kc[23] = exp(g_RT[1] - g_RT[62] + g_RT[64]);
+        Kc[24] = exp(g_RT[1] - g_RT[63] + g_RT[65]);
+        Kc[25] = exp(g_RT[1] - g_RT[64] + g_RT[65]);
+        Kc[26] = exp(g_RT[1] - g_RT[65] + g_RT[66]);
+        Kc[27] = exp(g_RT[12] + g_RT[23] - g_RT[65]);
+        Kc[28] = exp(g_RT[12] + g_RT[25] - g_RT[62]);
+        Kc[29] = exp(g_RT[12] + g_RT[34] - g_RT[46]);
+        Kc[30] = exp(g_RT[1] - g_RT[53] + g_RT[54]);
+        Kc[31] = exp(g_RT[1] + g_RT[55] - g_RT[56]);
+        Kc[32] = exp(g_RT[1] - g_RT[57] + g_RT[58]);
+        Kc[33] = exp(g_RT[12] - g_RT[47] + g_RT[66]);
+        Kc[34] = exp(g_RT[1] - g_RT[47] + g_RT[48]);
+        Kc[35] = exp(g_RT[23] + g_RT[25] - g_RT[47]);
+        Kc[36] = exp(g_RT[2] + g_RT[14] - g_RT[15]);
+        Kc[37] = exp(2*g_RT[2] - g_RT[3]);
+        Kc[38] = exp(g_RT[1] + g_RT[2] - g_RT[4]);
+        Kc[39] = exp(g_RT[1] + g_RT[3] - g_RT[6]);
+        Kc[40] = exp(-g_RT[0] + 2*g_RT[1]);
+        Kc[41] = exp(g_RT[1] + g_RT[4] - g_RT[5]);
+        Kc[42] = exp(-g_RT[1] - g_RT[14] + g_RT[16]);
+        Kc[43] = exp(g_RT[0] - g_RT[1] + g_RT[2] - g_RT[4]);
+        Kc[44] = exp(g_RT[2] - g_RT[3] - g_RT[4] + g_RT[6]);
+        Kc[45] = exp(g_RT[2] - g_RT[4] - g_RT[6] + g_RT[7]);
+        Kc[46] = exp(-g_RT[1] + g_RT[2] + g_RT[9] - g_RT[14]);
+        Kc[47] = exp(-g_RT[1] + g_RT[2] + g_RT[10] - g_RT[16]);
+        Kc[48] = exp(-g_RT[0] + g_RT[2] + g_RT[11] - g_RT[14]);
+        Kc[49] = exp(-g_RT[1] + g_RT[2] + g_RT[11] - g_RT[16]);
+        Kc[50] = exp(-g_RT[1] + g_RT[2] + g_RT[12] - g_RT[17]);
+        Kc[51] = exp(g_RT[2] - g_RT[4] - g_RT[12] + g_RT[13]);
+        Kc[52] = exp(g_RT[2] - g_RT[4] - g_RT[14] + g_RT[16]);
+        Kc[53] = exp(-g_RT[1] + g_RT[2] - g_RT[15] + g_RT[16]);
+        Kc[54] = exp(g_RT[2] - g_RT[4] - g_RT[16] + g_RT[17]);
+        Kc[55] = exp(g_RT[2] - g_RT[4] - g_RT[17] + g_RT[18]);
+        Kc[56] = exp(g_RT[2] - g_RT[4] - g_RT[17] + g_RT[19]);
+        Kc[57] = exp(g_RT[2] - g_RT[4] - g_RT[18] + g_RT[20]);
+        Kc[58] = exp(g_RT[2] - g_RT[4] - g_RT[19] + g_RT[20]);
+        Kc[59] = exp(g_RT[2] - g_RT[9] - g_RT[14] + g_RT[21]);
+        Kc[60] = exp(-g_RT[1] + g_RT[2] + g_RT[22] - g_RT[27]);
+        Kc[61] = exp(g_RT[2] - g_RT[4] - g_RT[21] + g_RT[22]);
+        Kc[62] = exp(g_RT[2] - g_RT[10] - g_RT[14] + g_RT[22]);
+        Kc[63] = exp(-g_RT[1] + g_RT[2] + g_RT[23] - g_RT[28]);
+        Kc[64] = exp(g_RT[2] - g_RT[12] - g_RT[16] + g_RT[24]);
+        Kc[65] = exp(g_RT[2] - g_RT[12] - g_RT[17] + g_RT[25]);
+        Kc[66] = exp(g_RT[2] - g_RT[4] - g_RT[25] + g_RT[26]);
+        Kc[67] = exp(-g_RT[1] + g_RT[2] - 2*g_RT[14] + g_RT[27]);
+        Kc[68] = exp(g_RT[2] - g_RT[4] - g_RT[27] + g_RT[28]);
+        Kc[69] = exp(g_RT[2] - g_RT[10] - g_RT[15] + g_RT[28]);
+        Kc[70] = exp(-g_RT[2] + g_RT[3] + g_RT[14] - g_RT[15]);
+        Kc[71] = exp(g_RT[3] - g_RT[6] - g_RT[16] + g_RT[17]);
+        Kc[72] = exp(g_RT[1] + 2*g_RT[3] - g_RT[3] - g_RT[6]);
+        Kc[73] = exp(g_RT[1] + g_RT[3] + g_RT[5] - g_RT[5] - g_RT[6]);
+        Kc[74] = exp(g_RT[1] + g_RT[3] - g_RT[6] + g_RT[31] - g_RT[31]);
+        Kc[75] = exp(g_RT[1] + g_RT[3] - g_RT[6] + g_RT[30] - g_RT[30]);
+        Kc[76] = exp(g_RT[1] - g_RT[2] + g_RT[3] - g_RT[4]);
+        Kc[77] = exp(g_RT[0] - 2*g_RT[0] + 2*g_RT[1]);
+        Kc[78] = exp(-g_RT[0] + 2*g_RT[1] + g_RT[5] - g_RT[5]);
+        Kc[79] = exp(-g_RT[0] + 2*g_RT[1] + g_RT[15] - g_RT[15]);
+        Kc[80] = exp(g_RT[1] - g_RT[2] - g_RT[5] + g_RT[6]);
+        Kc[81] = exp(-g_RT[0] + g_RT[1] - g_RT[3] + g_RT[6]);
+        Kc[82] = exp(g_RT[1] - 2*g_RT[4] + g_RT[6]);
+        Kc[83] = exp(-g_RT[0] + g_RT[1] - g_RT[6] + g_RT[7]);
+        Kc[84] = exp(g_RT[1] - g_RT[4] - g_RT[5] + g_RT[7]);
+        Kc[85] = exp(-g_RT[0] + g_RT[1] - g_RT[8] + g_RT[9]);
+        Kc[86] = exp(-g_RT[0] + g_RT[1] - g_RT[9] + g_RT[11]);
+        Kc[87] = exp(-g_RT[0] + g_RT[1] - g_RT[12] + g_RT[13]);
+        Kc[88] = exp(-g_RT[0] + g_RT[1] - g_RT[14] + g_RT[16]);
+        Kc[89] = exp(-g_RT[0] + g_RT[1] - g_RT[16] + g_RT[17]);
+        Kc[90] = exp(-g_RT[0] + g_RT[1] - g_RT[17] + g_RT[18]);
+        Kc[91] = exp(g_RT[1] - g_RT[4] - g_RT[12] + g_RT[18]);
+        Kc[92] = exp(g_RT[1] - g_RT[5] - g_RT[11] + g_RT[18]);
+        Kc[93] = exp(g_RT[1] - g_RT[1] - g_RT[18] + g_RT[19]);
+        Kc[94] = exp(-g_RT[0] + g_RT[1] - g_RT[17] + g_RT[19]);
+        Kc[95] = exp(g_RT[1] - g_RT[4] - g_RT[12] + g_RT[19]);
+        Kc[96] = exp(g_RT[1] - g_RT[5] - g_RT[11] + g_RT[19]);
+        Kc[97] = exp(-g_RT[0] + g_RT[1] - g_RT[18] + g_RT[20]);
+        Kc[98] = exp(-g_RT[0] + g_RT[1] - g_RT[19] + g_RT[20]);
+        Kc[99] = exp(-g_RT[0] + g_RT[1] - g_RT[22] + g_RT[23]);
+        Kc[100] = exp(-g_RT[0] + g_RT[1] - g_RT[23] + g_RT[24]);
+        Kc[101] = exp(-g_RT[0] + g_RT[1] - g_RT[24] + g_RT[25]);
+        Kc[102] = exp(-g_RT[0] + g_RT[1] - g_RT[25] + g_RT[26]);
+        Kc[103] = exp(g_RT[1] - g_RT[11] - g_RT[14] + g_RT[27]);
+        Kc[104] = exp(-g_RT[0] + g_RT[1] - g_RT[27] + g_RT[28]);
+        Kc[105] = exp(g_RT[1] - g_RT[12] - g_RT[14] + g_RT[28]);
+        Kc[106] = exp(g_RT[1] - g_RT[1] - g_RT[28] + g_RT[29]);
+        Kc[107] = exp(g_RT[0] - g_RT[1] + g_RT[4] - g_RT[5]);
+        Kc[108] = exp(-g_RT[2] + 2*g_RT[4] - g_RT[5]);
+        Kc[109] = exp(-g_RT[3] + g_RT[4] - g_RT[5] + g_RT[6]);
+        Kc[110] = exp(g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7]);
+        Kc[112] = exp(-g_RT[1] + g_RT[4] + g_RT[8] - g_RT[14]);
+        Kc[113] = exp(-g_RT[1] + g_RT[4] + g_RT[9] - g_RT[16]);
+        Kc[114] = exp(-g_RT[1] + g_RT[4] + g_RT[10] - g_RT[17]);
+        Kc[115] = exp(g_RT[4] - g_RT[5] - g_RT[9] + g_RT[10]);
+        Kc[116] = exp(-g_RT[1] + g_RT[4] + g_RT[11] - g_RT[17]);
+        Kc[117] = exp(g_RT[4] - g_RT[5] - g_RT[10] + g_RT[12]);
+        Kc[118] = exp(g_RT[4] - g_RT[5] - g_RT[11] + g_RT[12]);
+        Kc[119] = exp(g_RT[4] - g_RT[5] - g_RT[12] + g_RT[13]);
+        Kc[120] = exp(-g_RT[1] + g_RT[4] + g_RT[14] - g_RT[15]);
+        Kc[121] = exp(g_RT[4] - g_RT[5] - g_RT[14] + g_RT[16]);
+        Kc[122] = exp(g_RT[4] - g_RT[5] - g_RT[16] + g_RT[17]);
+        Kc[123] = exp(g_RT[4] - g_RT[5] - g_RT[17] + g_RT[18]);
+        Kc[124] = exp(g_RT[4] - g_RT[5] - g_RT[17] + g_RT[19]);
+        Kc[125] = exp(g_RT[4] - g_RT[5] - g_RT[18] + g_RT[20]);
+        Kc[126] = exp(g_RT[4] - g_RT[5] - g_RT[19] + g_RT[20]);
+        Kc[127] = exp(-g_RT[1] + g_RT[4] + g_RT[21] - g_RT[27]);
+        Kc[128] = exp(-g_RT[1] + g_RT[4] + g_RT[22] - g_RT[28]);
+        Kc[129] = exp(-g_RT[1] + g_RT[4] + g_RT[22] - g_RT[29]);
+        Kc[130] = exp(g_RT[4] - g_RT[5] - g_RT[21] + g_RT[22]);
+        Kc[131] = exp(g_RT[4] - g_RT[12] - g_RT[14] + g_RT[22]);
+        Kc[132] = exp(g_RT[4] - g_RT[5] - g_RT[22] + g_RT[23]);
+        Kc[133] = exp(g_RT[4] - g_RT[5] - g_RT[23] + g_RT[24]);
+        Kc[134] = exp(g_RT[4] - g_RT[5] - g_RT[25] + g_RT[26]);
+        Kc[135] = exp(g_RT[4] - g_RT[5] - g_RT[27] + g_RT[28]);
+        Kc[136] = exp(-g_RT[3] + 2*g_RT[6] - g_RT[7]);
+        Kc[138] = exp(-g_RT[4] + g_RT[6] + g_RT[10] - g_RT[17]);
+        Kc[139] = exp(-g_RT[3] + g_RT[6] + g_RT[12] - g_RT[13]);
+        Kc[140] = exp(-g_RT[4] + g_RT[6] + g_RT[12] - g_RT[19]);
+        Kc[141] = exp(-g_RT[4] + g_RT[6] + g_RT[14] - g_RT[15]);
+        Kc[142] = exp(g_RT[6] - g_RT[7] - g_RT[16] + g_RT[17]);
+        Kc[143] = exp(-g_RT[2] + g_RT[3] + g_RT[8] - g_RT[14]);
+        Kc[144] = exp(-g_RT[1] + g_RT[8] + g_RT[10] - g_RT[21]);
+        Kc[145] = exp(-g_RT[1] + g_RT[8] + g_RT[12] - g_RT[22]);
+        Kc[146] = exp(-g_RT[2] + g_RT[3] + g_RT[9] - g_RT[16]);
+        Kc[147] = exp(g_RT[0] - g_RT[1] + g_RT[9] - g_RT[10]);
+        Kc[148] = exp(-g_RT[1] + g_RT[5] + g_RT[9] - g_RT[17]);
+        Kc[149] = exp(-g_RT[1] + g_RT[9] + g_RT[10] - g_RT[22]);
+        Kc[150] = exp(-g_RT[1] + g_RT[9] + g_RT[12] - g_RT[23]);
+        Kc[151] = exp(-g_RT[1] + g_RT[9] + g_RT[13] - g_RT[24]);
+        Kc[152] = exp(g_RT[9] - g_RT[14] + g_RT[15] - g_RT[16]);
+        Kc[153] = exp(-g_RT[1] + g_RT[9] + g_RT[17] - g_RT[28]);
+        Kc[154] = exp(g_RT[9] - g_RT[14] - g_RT[22] + g_RT[27]);
+        Kc[155] = exp(-g_RT[1] + g_RT[3] - g_RT[4] + g_RT[10] - g_RT[14]);
+        Kc[156] = exp(g_RT[0] - g_RT[1] + g_RT[10] - g_RT[12]);
+        Kc[157] = exp(-g_RT[0] + 2*g_RT[10] - g_RT[22]);
+        Kc[158] = exp(-g_RT[1] + g_RT[10] + g_RT[12] - g_RT[24]);
+        Kc[159] = exp(g_RT[10] - 2*g_RT[12] + g_RT[13]);
+        Kc[160] = exp(g_RT[10] - g_RT[14] - g_RT[23] + g_RT[27]);
+        Kc[161] = exp(-g_RT[10] + g_RT[11] + g_RT[31] - g_RT[31]);
+        Kc[162] = exp(-g_RT[10] + g_RT[11] + g_RT[30] - g_RT[30]);
+        Kc[163] = exp(-g_RT[1] + g_RT[3] - g_RT[4] + g_RT[11] - g_RT[14]);
+        Kc[164] = exp(g_RT[3] - g_RT[5] + g_RT[11] - g_RT[14]);
+        Kc[165] = exp(g_RT[0] - g_RT[1] + g_RT[11] - g_RT[12]);
+        Kc[166] = exp(g_RT[5] - g_RT[5] - g_RT[10] + g_RT[11]);
+        Kc[167] = exp(-g_RT[1] + g_RT[11] + g_RT[12] - g_RT[24]);
+        Kc[168] = exp(g_RT[11] - 2*g_RT[12] + g_RT[13]);
+        Kc[169] = exp(-g_RT[10] + g_RT[11] + g_RT[14] - g_RT[14]);
+        Kc[170] = exp(-g_RT[10] + g_RT[11] + g_RT[15] - g_RT[15]);
+        Kc[171] = exp(g_RT[11] - g_RT[14] + g_RT[15] - g_RT[17]);
+        Kc[172] = exp(g_RT[11] - g_RT[12] - g_RT[25] + g_RT[26]);
+        Kc[173] = exp(-g_RT[2] + g_RT[3] + g_RT[12] - g_RT[19]);
+        Kc[174] = exp(g_RT[3] - g_RT[4] + g_RT[12] - g_RT[17]);
+        Kc[175] = exp(-g_RT[6] + g_RT[7] + g_RT[12] - g_RT[13]);
+        Kc[176] = exp(-g_RT[1] + 2*g_RT[12] - g_RT[25]);
+        Kc[177] = exp(g_RT[12] - g_RT[13] - g_RT[14] + g_RT[16]);
+        Kc[178] = exp(g_RT[12] - g_RT[13] - g_RT[16] + g_RT[17]);
+        Kc[179] = exp(g_RT[12] - g_RT[13] - g_RT[18] + g_RT[20]);
+        Kc[180] = exp(g_RT[12] - g_RT[13] - g_RT[19] + g_RT[20]);
+        Kc[181] = exp(g_RT[12] - g_RT[13] - g_RT[23] + g_RT[24]);
+        Kc[182] = exp(g_RT[12] - g_RT[13] - g_RT[25] + g_RT[26]);
+        Kc[183] = exp(-g_RT[1] + g_RT[5] - g_RT[5] - g_RT[14] + g_RT[16]);
+        Kc[184] = exp(g_RT[3] - g_RT[6] - g_RT[14] + g_RT[16]);
+        Kc[185] = exp(g_RT[3] - g_RT[6] - g_RT[17] + g_RT[18]);
+        Kc[186] = exp(g_RT[3] - g_RT[6] - g_RT[17] + g_RT[19]);
+        Kc[187] = exp(g_RT[3] - g_RT[14] - g_RT[16] + g_RT[21]);
+        Kc[188] = exp(g_RT[0] - g_RT[1] + g_RT[21] - g_RT[22]);
+        Kc[189] = exp(g_RT[3] - g_RT[16] - g_RT[17] + g_RT[23]);
+        Kc[190] = exp(g_RT[3] - g_RT[6] - g_RT[24] + g_RT[25]);
+        Kc[191] = exp(g_RT[3] - g_RT[4] - 2*g_RT[14] + g_RT[27]);
+        Kc[192] = exp(-2*g_RT[14] - g_RT[22] + 2*g_RT[27]);
+        Kc[193] = exp(-g_RT[0] - g_RT[1] + g_RT[2] + g_RT[12] - g_RT[14]);
+        Kc[194] = exp(-g_RT[1] + g_RT[2] + g_RT[24] - g_RT[32]);
+        Kc[195] = exp(-g_RT[1] + g_RT[2] + g_RT[25] - g_RT[68]);
+        Kc[197] = exp(-g_RT[0] + g_RT[4] + g_RT[12] - g_RT[17]);
+        Kc[198] = exp(-2*g_RT[1] + g_RT[3] + g_RT[10] - g_RT[15]);
+        Kc[199] = exp(-g_RT[2] + g_RT[3] + g_RT[10] - g_RT[17]);
+        Kc[200] = exp(-2*g_RT[1] + g_RT[10] + g_RT[10] - g_RT[22]);
+        Kc[201] = exp(-g_RT[0] + g_RT[5] + g_RT[11] - g_RT[17]);
+        Kc[202] = exp(-g_RT[2] + g_RT[3] + g_RT[23] - g_RT[32]);
+        Kc[203] = exp(g_RT[3] - g_RT[6] - g_RT[22] + g_RT[23]);
+        Kc[204] = exp(g_RT[2] - g_RT[4] - g_RT[32] + g_RT[68]);
+        Kc[205] = exp(g_RT[2] - g_RT[4] - g_RT[12] - g_RT[14] + g_RT[68]);
+        Kc[206] = exp(g_RT[3] - g_RT[6] - g_RT[12] - g_RT[14] + g_RT[68]);
+        Kc[207] = exp(-g_RT[0] + g_RT[1] - g_RT[32] + g_RT[68]);
+        Kc[208] = exp(-g_RT[0] + g_RT[1] - g_RT[12] - g_RT[14] + g_RT[68]);
+        Kc[209] = exp(g_RT[4] - g_RT[5] - g_RT[12] - g_RT[14] + g_RT[68]);
+        Kc[210] = exp(g_RT[6] - g_RT[7] - g_RT[12] - g_RT[14] + g_RT[68]);
+        Kc[211] = exp(g_RT[12] - g_RT[12] - g_RT[13] - g_RT[14] + g_RT[68]);
+        Kc[212] = exp(-g_RT[1] + g_RT[2] - g_RT[10] - g_RT[15] + g_RT[32]);
+        Kc[213] = exp(g_RT[3] - g_RT[4] - g_RT[14] - g_RT[17] + g_RT[32]);
+        Kc[214] = exp(g_RT[3] - g_RT[4] - 2*g_RT[16] + g_RT[32]);
+        Kc[215] = exp(g_RT[1] - g_RT[12] - g_RT[16] + g_RT[32]);
+        Kc[216] = exp(-g_RT[0] + g_RT[1] - g_RT[28] + g_RT[32]);
+        Kc[217] = exp(g_RT[4] - g_RT[5] - g_RT[28] + g_RT[32]);
+        Kc[218] = exp(g_RT[4] - g_RT[16] - g_RT[18] + g_RT[32]);
+        Kc[219] = exp(-g_RT[1] + g_RT[12] + g_RT[21] - g_RT[34]);
+        Kc[220] = exp(-g_RT[1] + g_RT[9] + g_RT[22] - g_RT[33]);
+        Kc[221] = exp(-g_RT[1] + g_RT[10] + g_RT[22] - g_RT[34]);
+        Kc[222] = exp(-g_RT[1] + g_RT[11] + g_RT[22] - g_RT[34]);
+        Kc[223] = exp(-g_RT[14] + g_RT[22] + g_RT[27] - g_RT[34]);
+        Kc[224] = exp(g_RT[2] - g_RT[14] - g_RT[22] + g_RT[33]);
+        Kc[225] = exp(g_RT[4] - g_RT[16] - g_RT[22] + g_RT[33]);
+        Kc[226] = exp(-g_RT[1] + g_RT[3] - g_RT[14] - g_RT[27] + g_RT[33]);
+        Kc[227] = exp(g_RT[1] + g_RT[33] - g_RT[34]);
+        Kc[228] = exp(g_RT[1] + g_RT[34] - g_RT[35]);
+        Kc[229] = exp(g_RT[1] + g_RT[34] - g_RT[36]);
+        Kc[230] = exp(-g_RT[0] + g_RT[1] - g_RT[33] + g_RT[34]);
+        Kc[231] = exp(g_RT[2] - g_RT[17] - g_RT[21] + g_RT[34]);
+        Kc[232] = exp(g_RT[4] - g_RT[5] - g_RT[33] + g_RT[34]);
+        Kc[233] = exp(g_RT[3] - g_RT[16] - g_RT[28] + g_RT[34]);
+        Kc[234] = exp(-g_RT[4] + g_RT[6] - g_RT[14] - g_RT[23] + g_RT[34]);
+        Kc[235] = exp(-g_RT[3] + g_RT[6] + g_RT[34] - g_RT[36]);
+        Kc[236] = exp(-g_RT[3] + g_RT[6] + g_RT[34] - g_RT[35]);
+        Kc[237] = exp(-g_RT[14] + g_RT[16] + g_RT[34] - g_RT[36]);
+        Kc[238] = exp(-g_RT[14] + g_RT[16] + g_RT[34] - g_RT[35]);
+        Kc[239] = exp(-g_RT[0] + g_RT[1] - g_RT[34] + g_RT[36]);
+        Kc[240] = exp(g_RT[1] + g_RT[36] - g_RT[67]);
+        Kc[241] = exp(g_RT[1] + g_RT[36] - g_RT[66]);
+        Kc[242] = exp(g_RT[2] - g_RT[14] - g_RT[24] + g_RT[36]);
+        Kc[243] = exp(g_RT[4] - g_RT[5] - g_RT[34] + g_RT[36]);
+        Kc[244] = exp(g_RT[12] - g_RT[13] - g_RT[34] + g_RT[36]);
+        Kc[245] = exp(g_RT[21] - g_RT[22] - g_RT[34] + g_RT[36]);
+        Kc[246] = exp(g_RT[35] - g_RT[37]);
+        Kc[247] = exp(g_RT[35] - g_RT[36]);
+        Kc[248] = exp(-g_RT[36] + g_RT[37]);
+        Kc[249] = exp(g_RT[1] - g_RT[1] + g_RT[35] - g_RT[36]);
+        Kc[250] = exp(g_RT[1] + g_RT[35] - g_RT[67]);
+        Kc[251] = exp(g_RT[1] + g_RT[35] - g_RT[66]);
+        Kc[252] = exp(-g_RT[0] + g_RT[1] - g_RT[34] + g_RT[35]);
+        Kc[253] = exp(g_RT[2] - g_RT[12] - g_RT[27] + g_RT[35]);
+        Kc[254] = exp(g_RT[2] - g_RT[14] - g_RT[24] + g_RT[35]);
+        Kc[255] = exp(g_RT[4] - g_RT[5] - g_RT[34] + g_RT[35]);
+        Kc[256] = exp(g_RT[21] - g_RT[22] - g_RT[34] + g_RT[35]);
+        Kc[257] = exp(g_RT[12] - g_RT[13] - g_RT[34] + g_RT[35]);
+        Kc[258] = exp(-g_RT[0] + g_RT[1] + g_RT[62] - g_RT[63]);
+        Kc[259] = exp(-g_RT[0] + g_RT[1] + g_RT[62] - g_RT[64]);
+        Kc[260] = exp(g_RT[2] - g_RT[4] + g_RT[62] - g_RT[63]);
+        Kc[261] = exp(g_RT[2] - g_RT[4] + g_RT[62] - g_RT[64]);
+        Kc[262] = exp(g_RT[4] - g_RT[5] + g_RT[62] - g_RT[63]);
+        Kc[263] = exp(g_RT[4] - g_RT[5] + g_RT[62] - g_RT[64]);
+        Kc[264] = exp(g_RT[3] - g_RT[6] + g_RT[62] - g_RT[63]);
+        Kc[265] = exp(g_RT[3] - g_RT[6] + g_RT[62] - g_RT[64]);
+        Kc[266] = exp(g_RT[6] - g_RT[7] + g_RT[62] - g_RT[63]);
+        Kc[267] = exp(g_RT[6] - g_RT[7] + g_RT[62] - g_RT[64]);
+        Kc[268] = exp(g_RT[12] - g_RT[13] + g_RT[62] - g_RT[63]);
+        Kc[269] = exp(g_RT[12] - g_RT[13] + g_RT[62] - g_RT[64]);
+        Kc[270] = exp(g_RT[1] - g_RT[12] - g_RT[25] + g_RT[63]);
+        Kc[271] = exp(-g_RT[0] + g_RT[1] + g_RT[63] - g_RT[65]);
+        Kc[272] = exp(g_RT[2] - g_RT[17] - g_RT[25] + g_RT[63]);
+        Kc[273] = exp(g_RT[4] - g_RT[5] + g_RT[63] - g_RT[65]);
+        Kc[274] = exp(g_RT[3] - g_RT[6] + g_RT[63] - g_RT[65]);
+        Kc[275] = exp(-g_RT[4] + g_RT[6] - g_RT[17] - g_RT[25] + g_RT[63]);
+        Kc[276] = exp(-g_RT[14] + g_RT[16] - g_RT[62] + g_RT[63]);
+        Kc[277] = exp(g_RT[12] - g_RT[13] + g_RT[63] - g_RT[65]);
+        Kc[278] = exp(g_RT[1] - g_RT[12] - g_RT[25] + g_RT[64]);
+        Kc[279] = exp(-g_RT[0] + g_RT[1] + g_RT[64] - g_RT[65]);
+        Kc[280] = exp(g_RT[2] - g_RT[12] + g_RT[64] - g_RT[68]);
+        Kc[281] = exp(g_RT[4] - g_RT[5] + g_RT[64] - g_RT[65]);
+        Kc[282] = exp(g_RT[3] - g_RT[6] + g_RT[64] - g_RT[65]);
+        Kc[283] = exp(-g_RT[4] + g_RT[6] - g_RT[12] + g_RT[64] - g_RT[68]);
+        Kc[284] = exp(-g_RT[14] + g_RT[16] - g_RT[62] + g_RT[64]);
+        Kc[285] = exp(g_RT[12] - g_RT[13] + g_RT[64] - g_RT[65]);
+        Kc[286] = exp(g_RT[1] - g_RT[12] - g_RT[24] + g_RT[65]);
+        Kc[287] = exp(-g_RT[0] + g_RT[1] + g_RT[65] - g_RT[66]);
+        Kc[288] = exp(-g_RT[0] + g_RT[1] + g_RT[65] - g_RT[67]);
+        Kc[289] = exp(-g_RT[1] + g_RT[2] - g_RT[12] - g_RT[28] + g_RT[65]);
+        Kc[290] = exp(g_RT[2] - g_RT[16] - g_RT[25] + g_RT[65]);
+        Kc[291] = exp(g_RT[2] - g_RT[4] + g_RT[65] - g_RT[66]);
+        Kc[292] = exp(g_RT[2] - g_RT[4] + g_RT[65] - g_RT[67]);
+        Kc[293] = exp(g_RT[4] - g_RT[5] + g_RT[65] - g_RT[66]);
+        Kc[294] = exp(g_RT[4] - g_RT[5] + g_RT[65] - g_RT[67]);
+        Kc[295] = exp(g_RT[6] - g_RT[7] + g_RT[65] - g_RT[66]);
+        Kc[296] = exp(g_RT[12] - g_RT[13] + g_RT[65] - g_RT[66]);
+        Kc[297] = exp(g_RT[12] - g_RT[13] + g_RT[65] - g_RT[67]);
+        Kc[298] = exp(-g_RT[0] + g_RT[1] - g_RT[36] + g_RT[66]);
+        Kc[299] = exp(-g_RT[1] + g_RT[2] + g_RT[66] - g_RT[69]);
+        Kc[300] = exp(-g_RT[1] - g_RT[1] + g_RT[4] + g_RT[66] - g_RT[69]);
+        Kc[301] = exp(g_RT[16] + g_RT[23] - g_RT[69]);
+        Kc[302] = exp(g_RT[1] - g_RT[16] - g_RT[24] + g_RT[69]);
+        Kc[303] = exp(g_RT[2] - g_RT[4] - g_RT[14] - g_RT[23] + g_RT[69]);
+        Kc[304] = exp(g_RT[2] - g_RT[17] - g_RT[28] + g_RT[69]);
+        Kc[305] = exp(g_RT[4] - g_RT[5] - g_RT[14] - g_RT[23] + g_RT[69]);
+        Kc[306] = exp(g_RT[4] - g_RT[5] - g_RT[36] + g_RT[66]);
+        Kc[307] = exp(g_RT[3] - g_RT[6] - g_RT[36] + g_RT[66]);
+        Kc[308] = exp(g_RT[3] - g_RT[12] - g_RT[14] - g_RT[17] + g_RT[66]);
+        Kc[309] = exp(g_RT[3] - g_RT[4] + g_RT[66] - g_RT[69]);
+        Kc[310] = exp(-g_RT[3] + g_RT[6] - g_RT[65] + g_RT[66]);
+        Kc[311] = exp(-g_RT[4] + g_RT[6] - g_RT[17] - g_RT[23] + g_RT[66]);
+        Kc[312] = exp(-g_RT[14] + g_RT[16] - g_RT[65] + g_RT[66]);
+        Kc[313] = exp(g_RT[12] - g_RT[13] - g_RT[36] + g_RT[66]);
+        Kc[314] = exp(-g_RT[36] - g_RT[65] + g_RT[66] + g_RT[66]);
+        Kc[315] = exp(g_RT[66] - g_RT[67]);
+        Kc[316] = exp(-g_RT[0] + g_RT[1] - g_RT[35] + g_RT[67]);
+        Kc[317] = exp(g_RT[2] - g_RT[12] - g_RT[28] + g_RT[67]);
+        Kc[318] = exp(-g_RT[1] + g_RT[4] - g_RT[12] - g_RT[28] + g_RT[67]);
+        Kc[319] = exp(g_RT[3] - g_RT[12] - g_RT[14] - g_RT[17] + g_RT[67]);
+        Kc[320] = exp(-g_RT[4] + g_RT[6] - g_RT[12] - g_RT[28] + g_RT[67]);
+        Kc[321] = exp(-g_RT[14] + g_RT[16] - g_RT[65] + g_RT[67]);
+        Kc[322] = exp(g_RT[12] - g_RT[13] - g_RT[35] + g_RT[67]);
+        Kc[323] = exp(-g_RT[1] + g_RT[12] + g_RT[22] - g_RT[35]);
+        Kc[324] = exp(-g_RT[1] + g_RT[12] + g_RT[22] - g_RT[36]);
+        Kc[325] = exp(g_RT[12] + g_RT[22] - g_RT[67]);
+        Kc[326] = exp(g_RT[12] + g_RT[22] - g_RT[66]);
+        Kc[327] = exp(-g_RT[1] + g_RT[12] + g_RT[23] - g_RT[66]);
+        Kc[328] = exp(g_RT[12] + g_RT[24] - g_RT[63]);
+        Kc[329] = exp(-g_RT[12] + g_RT[23] + g_RT[25] - g_RT[66]);
+        Kc[330] = exp(-g_RT[1] + g_RT[21] + g_RT[22] - g_RT[38]);
+        Kc[331] = exp(g_RT[21] + g_RT[22] - g_RT[40]);
+        Kc[332] = exp(g_RT[21] + g_RT[22] - g_RT[41]);
+        Kc[333] = exp(-g_RT[1] + g_RT[22] + g_RT[23] - g_RT[42]);
+        Kc[334] = exp(g_RT[22] + g_RT[23] - g_RT[43]);
+        Kc[335] = exp(g_RT[22] + g_RT[23] - g_RT[44]);
+        Kc[336] = exp(-g_RT[1] + g_RT[21] + g_RT[24] - g_RT[42]);
+        Kc[337] = exp(-g_RT[1] + g_RT[23] + g_RT[24] - g_RT[45]);
+        Kc[338] = exp(g_RT[23] + g_RT[23] - g_RT[45]);
+        Kc[339] = exp(-g_RT[1] + g_RT[23] + g_RT[23] - g_RT[44]);
+        Kc[340] = exp(-g_RT[1] + g_RT[23] + g_RT[23] - g_RT[43]);
+        Kc[341] = exp(-g_RT[1] + g_RT[9] + g_RT[33] - g_RT[38]);
+        Kc[342] = exp(-g_RT[1] + g_RT[10] + g_RT[33] - g_RT[40]);
+        Kc[343] = exp(-g_RT[1] + g_RT[12] + g_RT[33] - g_RT[42]);
+        Kc[344] = exp(-g_RT[14] + g_RT[27] + g_RT[33] - g_RT[40]);
+        Kc[345] = exp(-g_RT[14] + g_RT[27] + g_RT[34] - g_RT[42]);
+        Kc[346] = exp(-g_RT[1] + g_RT[9] + g_RT[34] - g_RT[41]);
+        Kc[347] = exp(-g_RT[1] + g_RT[10] + g_RT[34] - g_RT[42]);
+        Kc[348] = exp(g_RT[1] - g_RT[12] - g_RT[34] + g_RT[44]);
+        Kc[349] = exp(-g_RT[34] + g_RT[35] - g_RT[53] + g_RT[54]);
+        Kc[350] = exp(-g_RT[34] + g_RT[36] - g_RT[53] + g_RT[54]);
+        Kc[351] = exp(g_RT[1] + g_RT[38] - g_RT[40]);
+        Kc[352] = exp(g_RT[1] + g_RT[38] - g_RT[41]);
+        Kc[353] = exp(g_RT[2] - g_RT[14] - g_RT[33] + g_RT[38]);
+        Kc[354] = exp(-g_RT[1] + g_RT[4] + g_RT[38] - g_RT[39]);
+        Kc[355] = exp(g_RT[1] - g_RT[22] - g_RT[27] + g_RT[39]);
+        Kc[356] = exp(g_RT[4] - g_RT[27] - g_RT[28] + g_RT[39]);
+        Kc[357] = exp(g_RT[40] - g_RT[41]);
+        Kc[358] = exp(g_RT[1] - g_RT[1] + g_RT[40] - g_RT[41]);
+        Kc[359] = exp(g_RT[1] - g_RT[22] - g_RT[22] + g_RT[40]);
+        Kc[360] = exp(g_RT[1] - g_RT[22] - g_RT[22] + g_RT[41]);
+        Kc[361] = exp(g_RT[1] + g_RT[40] - g_RT[42]);
+        Kc[362] = exp(g_RT[1] + g_RT[41] - g_RT[42]);
+        Kc[363] = exp(-g_RT[0] + g_RT[1] - g_RT[38] + g_RT[40]);
+        Kc[364] = exp(-g_RT[0] + g_RT[1] - g_RT[38] + g_RT[41]);
+        Kc[365] = exp(g_RT[4] - g_RT[5] - g_RT[38] + g_RT[40]);
+        Kc[366] = exp(g_RT[4] - g_RT[5] - g_RT[38] + g_RT[41]);
+        Kc[367] = exp(g_RT[3] - g_RT[27] - g_RT[28] + g_RT[41]);
+        Kc[368] = exp(g_RT[1] + g_RT[42] - g_RT[43]);
+        Kc[369] = exp(g_RT[1] + g_RT[42] - g_RT[44]);
+        Kc[370] = exp(-g_RT[0] + g_RT[1] - g_RT[40] + g_RT[42]);
+        Kc[371] = exp(-g_RT[0] + g_RT[1] - g_RT[41] + g_RT[42]);
+        Kc[372] = exp(g_RT[4] - g_RT[5] - g_RT[40] + g_RT[42]);
+        Kc[373] = exp(g_RT[4] - g_RT[5] - g_RT[41] + g_RT[42]);
+        Kc[374] = exp(g_RT[43] - g_RT[44]);
+        Kc[375] = exp(g_RT[1] - g_RT[1] + g_RT[43] - g_RT[44]);
+        Kc[376] = exp(-g_RT[1] - g_RT[44] + g_RT[45]);
+        Kc[377] = exp(-g_RT[1] - g_RT[43] + g_RT[45]);
+        Kc[378] = exp(-g_RT[0] + g_RT[1] - g_RT[42] + g_RT[43]);
+        Kc[379] = exp(-g_RT[0] + g_RT[1] - g_RT[42] + g_RT[44]);
+        Kc[380] = exp(g_RT[4] - g_RT[5] - g_RT[42] + g_RT[43]);
+        Kc[381] = exp(g_RT[4] - g_RT[5] - g_RT[42] + g_RT[44]);
+        Kc[382] = exp(g_RT[3] - g_RT[14] - g_RT[16] - g_RT[24] + g_RT[43]);
+        Kc[383] = exp(g_RT[3] - g_RT[28] - g_RT[32] + g_RT[44]);
+        Kc[384] = exp(-g_RT[14] + g_RT[16] + g_RT[43] - g_RT[45]);
+        Kc[385] = exp(-g_RT[14] + g_RT[16] + g_RT[44] - g_RT[45]);
+        Kc[386] = exp(-g_RT[0] + g_RT[1] - g_RT[43] + g_RT[45]);
+        Kc[387] = exp(-g_RT[0] + g_RT[1] - g_RT[44] + g_RT[45]);
+        Kc[388] = exp(g_RT[1] - g_RT[12] - g_RT[35] + g_RT[45]);
+        Kc[389] = exp(g_RT[2] - g_RT[16] + g_RT[45] - g_RT[66]);
+        Kc[390] = exp(g_RT[4] - g_RT[5] - g_RT[43] + g_RT[45]);
+        Kc[391] = exp(g_RT[4] - g_RT[5] - g_RT[44] + g_RT[45]);
+        Kc[392] = exp(g_RT[1] - g_RT[1] - g_RT[45] + g_RT[46]);
+        Kc[393] = exp(-g_RT[0] + g_RT[1] - g_RT[44] + g_RT[46]);
+        Kc[394] = exp(g_RT[1] - g_RT[12] - g_RT[36] + g_RT[46]);
+        Kc[395] = exp(g_RT[1] - g_RT[12] - g_RT[35] + g_RT[46]);
+        Kc[396] = exp(g_RT[2] - g_RT[24] - g_RT[28] + g_RT[46]);
+        Kc[397] = exp(g_RT[2] - g_RT[4] - g_RT[44] + g_RT[46]);
+        Kc[398] = exp(g_RT[4] - g_RT[5] - g_RT[44] + g_RT[46]);
+        Kc[399] = exp(-g_RT[45] + g_RT[46]);
+        Kc[400] = exp(-g_RT[1] + g_RT[21] + g_RT[38] - g_RT[49]);
+        Kc[401] = exp(g_RT[21] + g_RT[38] - g_RT[50]);
+        Kc[402] = exp(-g_RT[1] + g_RT[34] + g_RT[34] - g_RT[54]);
+        Kc[403] = exp(g_RT[34] + g_RT[34] - g_RT[53]);
+        Kc[404] = exp(-g_RT[1] + g_RT[22] + g_RT[40] - g_RT[51]);
+        Kc[405] = exp(g_RT[22] + g_RT[40] - g_RT[54]);
+        Kc[406] = exp(-g_RT[1] + g_RT[22] + g_RT[40] - g_RT[52]);
+        Kc[407] = exp(-g_RT[1] + g_RT[21] + g_RT[42] - g_RT[51]);
+        Kc[408] = exp(-g_RT[1] + g_RT[22] + g_RT[43] - g_RT[53]);
+        Kc[409] = exp(g_RT[1] + g_RT[49] - g_RT[50]);
+        Kc[410] = exp(g_RT[1] - g_RT[22] - g_RT[38] + g_RT[50]);
+        Kc[411] = exp(g_RT[1] + g_RT[50] - g_RT[51]);
+        Kc[412] = exp(-g_RT[0] + g_RT[1] - g_RT[49] + g_RT[50]);
+        Kc[413] = exp(g_RT[4] - g_RT[5] - g_RT[49] + g_RT[50]);
+        Kc[414] = exp(g_RT[3] - g_RT[14] - g_RT[27] - g_RT[33] + g_RT[50]);
+        Kc[415] = exp(g_RT[1] + g_RT[51] - g_RT[54]);
+        Kc[416] = exp(g_RT[1] - g_RT[1] + g_RT[51] - g_RT[52]);
+        Kc[417] = exp(-g_RT[0] + g_RT[1] - g_RT[50] + g_RT[51]);
+        Kc[418] = exp(g_RT[4] - g_RT[5] - g_RT[50] + g_RT[51]);
+        Kc[419] = exp(g_RT[1] + g_RT[52] - g_RT[54]);
+        Kc[420] = exp(-g_RT[0] + g_RT[1] + g_RT[53] - g_RT[54]);
+        Kc[421] = exp(g_RT[4] - g_RT[5] + g_RT[53] - g_RT[54]);
+        Kc[422] = exp(-g_RT[1] + g_RT[2] + g_RT[53] - g_RT[55]);
+        Kc[423] = exp(-g_RT[1] + g_RT[4] + g_RT[53] - g_RT[56]);
+        Kc[424] = exp(-g_RT[2] + g_RT[3] + g_RT[54] - g_RT[55]);
+        Kc[425] = exp(-g_RT[14] + g_RT[55] - g_RT[58]);
+        Kc[426] = exp(g_RT[1] - g_RT[14] + g_RT[55] - g_RT[57]);
+        Kc[427] = exp(g_RT[2] - g_RT[14] - g_RT[16] - 2*g_RT[22] + g_RT[55]);
+        Kc[428] = exp(-g_RT[0] + g_RT[1] - g_RT[55] + g_RT[56]);
+        Kc[429] = exp(g_RT[2] - g_RT[4] - g_RT[55] + g_RT[56]);
+        Kc[430] = exp(g_RT[4] - g_RT[5] - g_RT[55] + g_RT[56]);
+        Kc[431] = exp(g_RT[2] - g_RT[14] - g_RT[43] + g_RT[58]);
+        Kc[432] = exp(-g_RT[1] + g_RT[4] + g_RT[58] - g_RT[60]);
+        Kc[433] = exp(-g_RT[4] + g_RT[6] + g_RT[58] - g_RT[59]);
+        Kc[434] = exp(-g_RT[0] + g_RT[1] + g_RT[57] - g_RT[58]);
+        Kc[435] = exp(g_RT[2] - g_RT[4] + g_RT[57] - g_RT[58]);
+        Kc[436] = exp(g_RT[4] - g_RT[5] + g_RT[57] - g_RT[58]);
+        Kc[437] = exp(-g_RT[14] - g_RT[43] + g_RT[59]);
+        Kc[438] = exp(g_RT[1] - g_RT[17] - 2*g_RT[22] + g_RT[59]);
+        Kc[439] = exp(g_RT[2] - g_RT[15] - g_RT[43] + g_RT[59]);
+        Kc[440] = exp(-g_RT[1] + g_RT[60] - g_RT[61]);
+        Kc[441] = exp(g_RT[1] - g_RT[17] - 2*g_RT[22] + g_RT[60]);
+        Kc[442] = exp(g_RT[2] - g_RT[15] - g_RT[43] + g_RT[60]);
+        Kc[443] = exp(-g_RT[14] - g_RT[22] - g_RT[22] + g_RT[61]);
+        Kc[444] = exp(g_RT[2] - g_RT[15] - 2*g_RT[22] + g_RT[61]);
+        Kc[445] = exp(g_RT[1] - g_RT[24] - g_RT[25] + g_RT[47]);
+        Kc[446] = exp(g_RT[1] - g_RT[12] + g_RT[47] - g_RT[65]);
+        Kc[447] = exp(-g_RT[0] + g_RT[1] + g_RT[47] - g_RT[48]);
+        Kc[448] = exp(g_RT[2] - g_RT[16] + g_RT[47] - g_RT[63]);
+        Kc[449] = exp(g_RT[2] - g_RT[4] + g_RT[47] - g_RT[48]);
+        Kc[451] = exp(g_RT[4] - g_RT[5] + g_RT[47] - g_RT[48]);
+        Kc[452] = exp(g_RT[3] - g_RT[6] + g_RT[47] - g_RT[48]);
+        Kc[453] = exp(g_RT[6] - g_RT[7] + g_RT[47] - g_RT[48]);
+        Kc[454] = exp(g_RT[12] - g_RT[13] + g_RT[47] - g_RT[48]);
+        Kc[455] = exp(-g_RT[1] - g_RT[45] + g_RT[48]);
+        Kc[456] = exp(g_RT[1] - g_RT[12] + g_RT[48] - g_RT[66]);
+        Kc[457] = exp(-g_RT[0] + g_RT[1] - g_RT[45] + g_RT[48]);
+        Kc[458] = exp(g_RT[3] - g_RT[6] - g_RT[45] + g_RT[48]);
+        Kc[459] = exp(-g_RT[4] + g_RT[6] - g_RT[17] + g_RT[48] - g_RT[66]);
+        Kc[460] = exp(-g_RT[14] + g_RT[16] - g_RT[47] + g_RT[48]);
+        Kc[461] = exp(g_RT[12] - g_RT[13] - g_RT[45] + g_RT[48]);
+        Kc[462] = exp(g_RT[23] + g_RT[24] - g_RT[48]);
+
+        /*reactions with the net stoichiometry of an earlier one */
+        Kc[111] = Kc[110];
+        Kc[137] = Kc[136];
+        Kc[196] = Kc[109];
+        Kc[450] = Kc[449];
+
+        Kc[0] *= refCinv;
+        Kc[1] *= refCinv;
+        Kc[2] *= refCinv;
+        Kc[3] *= refCinv;
+        Kc[4] *= refCinv;
+        Kc[5] *= refCinv;
+        Kc[6] *= refCinv;
+        Kc[7] *= refCinv;
+        Kc[8] *= refCinv;
+        Kc[9] *= refCinv;
+        Kc[10] *= refCinv;
+        Kc[11] *= refCinv;
+        Kc[12] *= refCinv;
+        Kc[13] *= refCinv;
+        Kc[14] *= refCinv;
+        Kc[15] *= refCinv;
+        Kc[16] *= refCinv;
+        Kc[17] *= refCinv;
+        Kc[18] *= refCinv;
+        Kc[19] *= refC;
+        Kc[20] *= refCinv;
+        Kc[21] *= refCinv;
+        Kc[22] *= refCinv;
+        Kc[23] *= refCinv;
+        Kc[24] *= refCinv;
+        Kc[25] *= refCinv;
+        Kc[26] *= refCinv;
+        Kc[27] *= refCinv;
+        Kc[28] *= refCinv;
+        Kc[29] *= refCinv;
+        Kc[30] *= refCinv;
+        Kc[31] *= refCinv;
+        Kc[32] *= refCinv;
+        Kc[33] *= refCinv;
+        Kc[34] *= refCinv;
+        Kc[35] *= refCinv;
+        Kc[36] *= refCinv;
+        Kc[37] *= refCinv;
+        Kc[38] *= refCinv;
+        Kc[39] *= refCinv;
+        Kc[40] *= refCinv;
+        Kc[41] *= refCinv;
+        Kc[42] *= refC;
+        Kc[67] *= refC;
+        Kc[72] *= refCinv;
+        Kc[73] *= refCinv;
+        Kc[74] *= refCinv;
+        Kc[75] *= refCinv;
+        Kc[77] *= refCinv;
+        Kc[78] *= refCinv;
+        Kc[79] *= refCinv;
+        Kc[155] *= refC;
+        Kc[163] *= refC;
+        Kc[183] *= refC;
+        Kc[191] *= refC;
+        Kc[192] *= refC;
+        Kc[193] *= refC;
+        Kc[198] *= refC;
+        Kc[200] *= refC;
+        Kc[205] *= refC;
+        Kc[206] *= refC;
+        Kc[208] *= refC;
+        Kc[209] *= refC;
+        Kc[210] *= refC;
+        Kc[211] *= refC;
+        Kc[212] *= refC;
+        Kc[213] *= refC;
+        Kc[214] *= refC;
+        Kc[226] *= refC;
+        Kc[227] *= refCinv;
+        Kc[228] *= refCinv;
+        Kc[229] *= refCinv;
+        Kc[234] *= refC;
+        Kc[240] *= refCinv;
+        Kc[241] *= refCinv;
+        Kc[250] *= refCinv;
+        Kc[251] *= refCinv;
+        Kc[275] *= refC;
+        Kc[283] *= refC;
+        Kc[289] *= refC;
+        Kc[300] *= refC;
+        Kc[301] *= refCinv;
+        Kc[303] *= refC;
+        Kc[305] *= refC;
+        Kc[308] *= refC;
+        Kc[311] *= refC;
+        Kc[318] *= refC;
+        Kc[319] *= refC;
+        Kc[320] *= refC;
+        Kc[325] *= refCinv;
+        Kc[326] *= refCinv;
+        Kc[328] *= refCinv;
+        Kc[331] *= refCinv;
+        Kc[332] *= refCinv;
+        Kc[334] *= refCinv;
+        Kc[335] *= refCinv;
+        Kc[338] *= refCinv;
+        Kc[351] *= refCinv;
+        Kc[352] *= refCinv;
+        Kc[361] *= refCinv;
+        Kc[362] *= refCinv;
+        Kc[368] *= refCinv;
+        Kc[369] *= refCinv;
+        Kc[376] *= refC;
+        Kc[377] *= refC;
+        Kc[382] *= refC;
+        Kc[401] *= refCinv;
+        Kc[403] *= refCinv;
+        Kc[405] *= refCinv;
+        Kc[409] *= refCinv;
+        Kc[411] *= refCinv;
+        Kc[414] *= refC;
+        Kc[415] *= refCinv;
+        Kc[419] *= refCinv;
+        Kc[425] *= refC;
+        Kc[427] *= refC*refC;
+        Kc[437] *= refC;
+        Kc[438] *= refC;
+        Kc[440] *= refC;
+        Kc[441] *= refC;
+        Kc[443] *= refC*refC;
+        Kc[444] *= refC;
+        Kc[455] *= refC;
+        Kc[459] *= refC;
+        Kc[462] *= refCinv;
+    }
 
     return;
 }
@@ -25677,6 +26764,10 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         mixture += sc[i];
     }
 
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[0][0] - 1)*sc[0] + (TB[0][1] - 1)*sc[5] + (TB[0][2] - 1)*sc[13] + (TB[0][3] - 1)*sc[14] + (TB[0][4] - 1)*sc[15] + (TB[0][5] - 1)*sc[26] + (TB[0][6] - 1)*sc[30] + (TB[0][7] - 1)*sc[24] + (TB[0][8] - 1)*sc[35] + (TB[0][9] - 1)*sc[65] + (TB[0][10] - 1)*sc[62];
+    double alpha_eff1 = mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[13] + (TB[3][3] - 1)*sc[14] + (TB[3][4] - 1)*sc[15] + (TB[3][5] - 1)*sc[26] + (TB[3][6] - 1)*sc[24] + (TB[3][7] - 1)*sc[35] + (TB[3][8] - 1)*sc[65] + (TB[3][9] - 1)*sc[62];
+
     double Corr[463];
     for (int i = 0; i < 463; ++i) {
         Corr[i] = 1.0;
@@ -25685,42 +26776,42 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
     /* troe */
     {
         double alpha[36];
-        alpha[0] = mixture + (TB[0][0] - 1)*sc[0] + (TB[0][1] - 1)*sc[5] + (TB[0][2] - 1)*sc[13] + (TB[0][3] - 1)*sc[14] + (TB[0][4] - 1)*sc[15] + (TB[0][5] - 1)*sc[26] + (TB[0][6] - 1)*sc[30] + (TB[0][7] - 1)*sc[24] + (TB[0][8] - 1)*sc[35] + (TB[0][9] - 1)*sc[65] + (TB[0][10] - 1)*sc[62];
+        alpha[0] = alpha_eff0;
         alpha[1] = mixture + (TB[1][0] - 1)*sc[0] + (TB[1][1] - 1)*sc[5] + (TB[1][2] - 1)*sc[13] + (TB[1][3] - 1)*sc[14] + (TB[1][4] - 1)*sc[15] + (TB[1][5] - 1)*sc[26] + (TB[1][6] - 1)*sc[30] + (TB[1][7] - 1)*sc[24] + (TB[1][8] - 1)*sc[35] + (TB[1][9] - 1)*sc[65] + (TB[1][10] - 1)*sc[62];
-        alpha[2] = mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[13] + (TB[2][3] - 1)*sc[14] + (TB[2][4] - 1)*sc[15] + (TB[2][5] - 1)*sc[26] + (TB[2][6] - 1)*sc[30] + (TB[2][7] - 1)*sc[24] + (TB[2][8] - 1)*sc[35] + (TB[2][9] - 1)*sc[65] + (TB[2][10] - 1)*sc[62];
-        alpha[3] = mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[13] + (TB[3][3] - 1)*sc[14] + (TB[3][4] - 1)*sc[15] + (TB[3][5] - 1)*sc[26] + (TB[3][6] - 1)*sc[24] + (TB[3][7] - 1)*sc[35] + (TB[3][8] - 1)*sc[65] + (TB[3][9] - 1)*sc[62];
-        alpha[4] = mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[13] + (TB[4][3] - 1)*sc[14] + (TB[4][4] - 1)*sc[15] + (TB[4][5] - 1)*sc[26] + (TB[4][6] - 1)*sc[24] + (TB[4][7] - 1)*sc[35] + (TB[4][8] - 1)*sc[65] + (TB[4][9] - 1)*sc[62];
-        alpha[5] = mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[13] + (TB[5][3] - 1)*sc[14] + (TB[5][4] - 1)*sc[15] + (TB[5][5] - 1)*sc[26] + (TB[5][6] - 1)*sc[24] + (TB[5][7] - 1)*sc[35] + (TB[5][8] - 1)*sc[65] + (TB[5][9] - 1)*sc[62];
-        alpha[6] = mixture + (TB[6][0] - 1)*sc[0] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[13] + (TB[6][3] - 1)*sc[14] + (TB[6][4] - 1)*sc[15] + (TB[6][5] - 1)*sc[26] + (TB[6][6] - 1)*sc[24] + (TB[6][7] - 1)*sc[35] + (TB[6][8] - 1)*sc[65] + (TB[6][9] - 1)*sc[62];
-        alpha[7] = mixture + (TB[7][0] - 1)*sc[0] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[13] + (TB[7][3] - 1)*sc[14] + (TB[7][4] - 1)*sc[15] + (TB[7][5] - 1)*sc[26] + (TB[7][6] - 1)*sc[30] + (TB[7][7] - 1)*sc[24] + (TB[7][8] - 1)*sc[35] + (TB[7][9] - 1)*sc[65] + (TB[7][10] - 1)*sc[62];
-        alpha[8] = mixture + (TB[8][0] - 1)*sc[0] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[13] + (TB[8][3] - 1)*sc[14] + (TB[8][4] - 1)*sc[15] + (TB[8][5] - 1)*sc[26] + (TB[8][6] - 1)*sc[30] + (TB[8][7] - 1)*sc[24] + (TB[8][8] - 1)*sc[35] + (TB[8][9] - 1)*sc[65] + (TB[8][10] - 1)*sc[62];
-        alpha[9] = mixture + (TB[9][0] - 1)*sc[0] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[13] + (TB[9][3] - 1)*sc[14] + (TB[9][4] - 1)*sc[15] + (TB[9][5] - 1)*sc[26] + (TB[9][6] - 1)*sc[30] + (TB[9][7] - 1)*sc[24] + (TB[9][8] - 1)*sc[35] + (TB[9][9] - 1)*sc[65] + (TB[9][10] - 1)*sc[62];
-        alpha[10] = mixture + (TB[10][0] - 1)*sc[0] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[13] + (TB[10][3] - 1)*sc[14] + (TB[10][4] - 1)*sc[15] + (TB[10][5] - 1)*sc[26] + (TB[10][6] - 1)*sc[30] + (TB[10][7] - 1)*sc[24] + (TB[10][8] - 1)*sc[35] + (TB[10][9] - 1)*sc[65] + (TB[10][10] - 1)*sc[62];
-        alpha[11] = mixture + (TB[11][0] - 1)*sc[0] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[13] + (TB[11][3] - 1)*sc[14] + (TB[11][4] - 1)*sc[15] + (TB[11][5] - 1)*sc[26] + (TB[11][6] - 1)*sc[30] + (TB[11][7] - 1)*sc[24] + (TB[11][8] - 1)*sc[35] + (TB[11][9] - 1)*sc[65] + (TB[11][10] - 1)*sc[62];
-        alpha[12] = mixture + (TB[12][0] - 1)*sc[0] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[13] + (TB[12][3] - 1)*sc[14] + (TB[12][4] - 1)*sc[15] + (TB[12][5] - 1)*sc[26] + (TB[12][6] - 1)*sc[30] + (TB[12][7] - 1)*sc[24] + (TB[12][8] - 1)*sc[35] + (TB[12][9] - 1)*sc[65] + (TB[12][10] - 1)*sc[62];
-        alpha[13] = mixture + (TB[13][0] - 1)*sc[0] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[13] + (TB[13][3] - 1)*sc[14] + (TB[13][4] - 1)*sc[15] + (TB[13][5] - 1)*sc[26] + (TB[13][6] - 1)*sc[30] + (TB[13][7] - 1)*sc[24] + (TB[13][8] - 1)*sc[35] + (TB[13][9] - 1)*sc[65] + (TB[13][10] - 1)*sc[62];
-        alpha[14] = mixture + (TB[14][0] - 1)*sc[0] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[13] + (TB[14][3] - 1)*sc[14] + (TB[14][4] - 1)*sc[15] + (TB[14][5] - 1)*sc[26] + (TB[14][6] - 1)*sc[24] + (TB[14][7] - 1)*sc[35] + (TB[14][8] - 1)*sc[65] + (TB[14][9] - 1)*sc[62];
-        alpha[15] = mixture + (TB[15][0] - 1)*sc[0] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[13] + (TB[15][3] - 1)*sc[14] + (TB[15][4] - 1)*sc[15] + (TB[15][5] - 1)*sc[26] + (TB[15][6] - 1)*sc[30] + (TB[15][7] - 1)*sc[24] + (TB[15][8] - 1)*sc[35] + (TB[15][9] - 1)*sc[65] + (TB[15][10] - 1)*sc[62];
-        alpha[16] = mixture + (TB[16][0] - 1)*sc[0] + (TB[16][1] - 1)*sc[5] + (TB[16][2] - 1)*sc[13] + (TB[16][3] - 1)*sc[14] + (TB[16][4] - 1)*sc[15] + (TB[16][5] - 1)*sc[26] + (TB[16][6] - 1)*sc[30] + (TB[16][7] - 1)*sc[24] + (TB[16][8] - 1)*sc[35] + (TB[16][9] - 1)*sc[65] + (TB[16][10] - 1)*sc[62];
-        alpha[17] = mixture + (TB[17][0] - 1)*sc[0] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[13] + (TB[17][3] - 1)*sc[14] + (TB[17][4] - 1)*sc[15] + (TB[17][5] - 1)*sc[26] + (TB[17][6] - 1)*sc[24] + (TB[17][7] - 1)*sc[35] + (TB[17][8] - 1)*sc[65] + (TB[17][9] - 1)*sc[62];
-        alpha[18] = mixture + (TB[18][0] - 1)*sc[0] + (TB[18][1] - 1)*sc[5] + (TB[18][2] - 1)*sc[13] + (TB[18][3] - 1)*sc[14] + (TB[18][4] - 1)*sc[15] + (TB[18][5] - 1)*sc[26] + (TB[18][6] - 1)*sc[30] + (TB[18][7] - 1)*sc[24] + (TB[18][8] - 1)*sc[35] + (TB[18][9] - 1)*sc[65] + (TB[18][10] - 1)*sc[62];
-        alpha[19] = mixture + (TB[19][0] - 1)*sc[0] + (TB[19][1] - 1)*sc[5] + (TB[19][2] - 1)*sc[13] + (TB[19][3] - 1)*sc[14] + (TB[19][4] - 1)*sc[15] + (TB[19][5] - 1)*sc[26] + (TB[19][6] - 1)*sc[30] + (TB[19][7] - 1)*sc[24] + (TB[19][8] - 1)*sc[35] + (TB[19][9] - 1)*sc[65] + (TB[19][10] - 1)*sc[62];
-        alpha[20] = mixture + (TB[20][0] - 1)*sc[0] + (TB[20][1] - 1)*sc[5] + (TB[20][2] - 1)*sc[13] + (TB[20][3] - 1)*sc[14] + (TB[20][4] - 1)*sc[15] + (TB[20][5] - 1)*sc[26] + (TB[20][6] - 1)*sc[30] + (TB[20][7] - 1)*sc[24] + (TB[20][8] - 1)*sc[35] + (TB[20][9] - 1)*sc[65] + (TB[20][10] - 1)*sc[62];
-        alpha[21] = mixture + (TB[21][0] - 1)*sc[0] + (TB[21][1] - 1)*sc[5] + (TB[21][2] - 1)*sc[13] + (TB[21][3] - 1)*sc[14] + (TB[21][4] - 1)*sc[15] + (TB[21][5] - 1)*sc[26] + (TB[21][6] - 1)*sc[30] + (TB[21][7] - 1)*sc[24] + (TB[21][8] - 1)*sc[35] + (TB[21][9] - 1)*sc[65] + (TB[21][10] - 1)*sc[62];
-        alpha[22] = mixture + (TB[22][0] - 1)*sc[0] + (TB[22][1] - 1)*sc[5] + (TB[22][2] - 1)*sc[13] + (TB[22][3] - 1)*sc[14] + (TB[22][4] - 1)*sc[15] + (TB[22][5] - 1)*sc[26] + (TB[22][6] - 1)*sc[30] + (TB[22][7] - 1)*sc[24] + (TB[22][8] - 1)*sc[35] + (TB[22][9] - 1)*sc[65] + (TB[22][10] - 1)*sc[62];
-        alpha[23] = mixture + (TB[23][0] - 1)*sc[0] + (TB[23][1] - 1)*sc[5] + (TB[23][2] - 1)*sc[13] + (TB[23][3] - 1)*sc[14] + (TB[23][4] - 1)*sc[15] + (TB[23][5] - 1)*sc[26] + (TB[23][6] - 1)*sc[30] + (TB[23][7] - 1)*sc[24] + (TB[23][8] - 1)*sc[35] + (TB[23][9] - 1)*sc[65] + (TB[23][10] - 1)*sc[62];
-        alpha[24] = mixture + (TB[24][0] - 1)*sc[0] + (TB[24][1] - 1)*sc[5] + (TB[24][2] - 1)*sc[13] + (TB[24][3] - 1)*sc[14] + (TB[24][4] - 1)*sc[15] + (TB[24][5] - 1)*sc[26] + (TB[24][6] - 1)*sc[30] + (TB[24][7] - 1)*sc[24] + (TB[24][8] - 1)*sc[35] + (TB[24][9] - 1)*sc[65] + (TB[24][10] - 1)*sc[62];
-        alpha[25] = mixture + (TB[25][0] - 1)*sc[0] + (TB[25][1] - 1)*sc[5] + (TB[25][2] - 1)*sc[13] + (TB[25][3] - 1)*sc[14] + (TB[25][4] - 1)*sc[15] + (TB[25][5] - 1)*sc[26] + (TB[25][6] - 1)*sc[30] + (TB[25][7] - 1)*sc[24] + (TB[25][8] - 1)*sc[35] + (TB[25][9] - 1)*sc[65] + (TB[25][10] - 1)*sc[62];
-        alpha[26] = mixture + (TB[26][0] - 1)*sc[0] + (TB[26][1] - 1)*sc[5] + (TB[26][2] - 1)*sc[13] + (TB[26][3] - 1)*sc[14] + (TB[26][4] - 1)*sc[15] + (TB[26][5] - 1)*sc[26] + (TB[26][6] - 1)*sc[30] + (TB[26][7] - 1)*sc[24] + (TB[26][8] - 1)*sc[35] + (TB[26][9] - 1)*sc[65] + (TB[26][10] - 1)*sc[62];
-        alpha[27] = mixture + (TB[27][0] - 1)*sc[0] + (TB[27][1] - 1)*sc[5] + (TB[27][2] - 1)*sc[13] + (TB[27][3] - 1)*sc[14] + (TB[27][4] - 1)*sc[15] + (TB[27][5] - 1)*sc[26] + (TB[27][6] - 1)*sc[30] + (TB[27][7] - 1)*sc[24] + (TB[27][8] - 1)*sc[35] + (TB[27][9] - 1)*sc[65] + (TB[27][10] - 1)*sc[62];
-        alpha[28] = mixture + (TB[28][0] - 1)*sc[0] + (TB[28][1] - 1)*sc[5] + (TB[28][2] - 1)*sc[13] + (TB[28][3] - 1)*sc[14] + (TB[28][4] - 1)*sc[15] + (TB[28][5] - 1)*sc[26] + (TB[28][6] - 1)*sc[30] + (TB[28][7] - 1)*sc[24] + (TB[28][8] - 1)*sc[35] + (TB[28][9] - 1)*sc[65] + (TB[28][10] - 1)*sc[62];
-        alpha[29] = mixture + (TB[29][0] - 1)*sc[0] + (TB[29][1] - 1)*sc[5] + (TB[29][2] - 1)*sc[13] + (TB[29][3] - 1)*sc[14] + (TB[29][4] - 1)*sc[15] + (TB[29][5] - 1)*sc[26] + (TB[29][6] - 1)*sc[30] + (TB[29][7] - 1)*sc[24] + (TB[29][8] - 1)*sc[35] + (TB[29][9] - 1)*sc[65] + (TB[29][10] - 1)*sc[62];
-        alpha[30] = mixture + (TB[30][0] - 1)*sc[0] + (TB[30][1] - 1)*sc[5] + (TB[30][2] - 1)*sc[13] + (TB[30][3] - 1)*sc[14] + (TB[30][4] - 1)*sc[15] + (TB[30][5] - 1)*sc[26] + (TB[30][6] - 1)*sc[24] + (TB[30][7] - 1)*sc[35] + (TB[30][8] - 1)*sc[65] + (TB[30][9] - 1)*sc[62];
-        alpha[31] = mixture + (TB[31][0] - 1)*sc[0] + (TB[31][1] - 1)*sc[5] + (TB[31][2] - 1)*sc[13] + (TB[31][3] - 1)*sc[14] + (TB[31][4] - 1)*sc[15] + (TB[31][5] - 1)*sc[26] + (TB[31][6] - 1)*sc[24] + (TB[31][7] - 1)*sc[35] + (TB[31][8] - 1)*sc[65] + (TB[31][9] - 1)*sc[62];
-        alpha[32] = mixture + (TB[32][0] - 1)*sc[0] + (TB[32][1] - 1)*sc[5] + (TB[32][2] - 1)*sc[13] + (TB[32][3] - 1)*sc[14] + (TB[32][4] - 1)*sc[15] + (TB[32][5] - 1)*sc[26] + (TB[32][6] - 1)*sc[24] + (TB[32][7] - 1)*sc[35] + (TB[32][8] - 1)*sc[65] + (TB[32][9] - 1)*sc[62];
-        alpha[33] = mixture + (TB[33][0] - 1)*sc[0] + (TB[33][1] - 1)*sc[5] + (TB[33][2] - 1)*sc[13] + (TB[33][3] - 1)*sc[14] + (TB[33][4] - 1)*sc[15] + (TB[33][5] - 1)*sc[26] + (TB[33][6] - 1)*sc[30] + (TB[33][7] - 1)*sc[24] + (TB[33][8] - 1)*sc[35] + (TB[33][9] - 1)*sc[65] + (TB[33][10] - 1)*sc[62];
+        alpha[2] = (memcmp(TB[2], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[13] + (TB[2][3] - 1)*sc[14] + (TB[2][4] - 1)*sc[15] + (TB[2][5] - 1)*sc[26] + (TB[2][6] - 1)*sc[30] + (TB[2][7] - 1)*sc[24] + (TB[2][8] - 1)*sc[35] + (TB[2][9] - 1)*sc[65] + (TB[2][10] - 1)*sc[62]);
+        alpha[3] = alpha_eff1;
+        alpha[4] = (memcmp(TB[4], TB[3], 10*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[13] + (TB[4][3] - 1)*sc[14] + (TB[4][4] - 1)*sc[15] + (TB[4][5] - 1)*sc[26] + (TB[4][6] - 1)*sc[24] + (TB[4][7] - 1)*sc[35] + (TB[4][8] - 1)*sc[65] + (TB[4][9] - 1)*sc[62]);
+        alpha[5] = (memcmp(TB[5], TB[3], 10*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[13] + (TB[5][3] - 1)*sc[14] + (TB[5][4] - 1)*sc[15] + (TB[5][5] - 1)*sc[26] + (TB[5][6] - 1)*sc[24] + (TB[5][7] - 1)*sc[35] + (TB[5][8] - 1)*sc[65] + (TB[5][9] - 1)*sc[62]);
+        alpha[6] = (memcmp(TB[6], TB[3], 10*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[6][0] - 1)*sc[0] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[13] + (TB[6][3] - 1)*sc[14] + (TB[6][4] - 1)*sc[15] + (TB[6][5] - 1)*sc[26] + (TB[6][6] - 1)*sc[24] + (TB[6][7] - 1)*sc[35] + (TB[6][8] - 1)*sc[65] + (TB[6][9] - 1)*sc[62]);
+        alpha[7] = (memcmp(TB[7], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[7][0] - 1)*sc[0] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[13] + (TB[7][3] - 1)*sc[14] + (TB[7][4] - 1)*sc[15] + (TB[7][5] - 1)*sc[26] + (TB[7][6] - 1)*sc[30] + (TB[7][7] - 1)*sc[24] + (TB[7][8] - 1)*sc[35] + (TB[7][9] - 1)*sc[65] + (TB[7][10] - 1)*sc[62]);
+        alpha[8] = (memcmp(TB[8], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[8][0] - 1)*sc[0] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[13] + (TB[8][3] - 1)*sc[14] + (TB[8][4] - 1)*sc[15] + (TB[8][5] - 1)*sc[26] + (TB[8][6] - 1)*sc[30] + (TB[8][7] - 1)*sc[24] + (TB[8][8] - 1)*sc[35] + (TB[8][9] - 1)*sc[65] + (TB[8][10] - 1)*sc[62]);
+        alpha[9] = (memcmp(TB[9], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[9][0] - 1)*sc[0] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[13] + (TB[9][3] - 1)*sc[14] + (TB[9][4] - 1)*sc[15] + (TB[9][5] - 1)*sc[26] + (TB[9][6] - 1)*sc[30] + (TB[9][7] - 1)*sc[24] + (TB[9][8] - 1)*sc[35] + (TB[9][9] - 1)*sc[65] + (TB[9][10] - 1)*sc[62]);
+        alpha[10] = (memcmp(TB[10], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[10][0] - 1)*sc[0] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[13] + (TB[10][3] - 1)*sc[14] + (TB[10][4] - 1)*sc[15] + (TB[10][5] - 1)*sc[26] + (TB[10][6] - 1)*sc[30] + (TB[10][7] - 1)*sc[24] + (TB[10][8] - 1)*sc[35] + (TB[10][9] - 1)*sc[65] + (TB[10][10] - 1)*sc[62]);
+        alpha[11] = (memcmp(TB[11], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[11][0] - 1)*sc[0] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[13] + (TB[11][3] - 1)*sc[14] + (TB[11][4] - 1)*sc[15] + (TB[11][5] - 1)*sc[26] + (TB[11][6] - 1)*sc[30] + (TB[11][7] - 1)*sc[24] + (TB[11][8] - 1)*sc[35] + (TB[11][9] - 1)*sc[65] + (TB[11][10] - 1)*sc[62]);
+        alpha[12] = (memcmp(TB[12], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[12][0] - 1)*sc[0] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[13] + (TB[12][3] - 1)*sc[14] + (TB[12][4] - 1)*sc[15] + (TB[12][5] - 1)*sc[26] + (TB[12][6] - 1)*sc[30] + (TB[12][7] - 1)*sc[24] + (TB[12][8] - 1)*sc[35] + (TB[12][9] - 1)*sc[65] + (TB[12][10] - 1)*sc[62]);
+        alpha[13] = (memcmp(TB[13], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[13][0] - 1)*sc[0] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[13] + (TB[13][3] - 1)*sc[14] + (TB[13][4] - 1)*sc[15] + (TB[13][5] - 1)*sc[26] + (TB[13][6] - 1)*sc[30] + (TB[13][7] - 1)*sc[24] + (TB[13][8] - 1)*sc[35] + (TB[13][9] - 1)*sc[65] + (TB[13][10] - 1)*sc[62]);
+        alpha[14] = (memcmp(TB[14], TB[3], 10*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[14][0] - 1)*sc[0] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[13] + (TB[14][3] - 1)*sc[14] + (TB[14][4] - 1)*sc[15] + (TB[14][5] - 1)*sc[26] + (TB[14][6] - 1)*sc[24] + (TB[14][7] - 1)*sc[35] + (TB[14][8] - 1)*sc[65] + (TB[14][9] - 1)*sc[62]);
+        alpha[15] = (memcmp(TB[15], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[15][0] - 1)*sc[0] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[13] + (TB[15][3] - 1)*sc[14] + (TB[15][4] - 1)*sc[15] + (TB[15][5] - 1)*sc[26] + (TB[15][6] - 1)*sc[30] + (TB[15][7] - 1)*sc[24] + (TB[15][8] - 1)*sc[35] + (TB[15][9] - 1)*sc[65] + (TB[15][10] - 1)*sc[62]);
+        alpha[16] = (memcmp(TB[16], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[16][0] - 1)*sc[0] + (TB[16][1] - 1)*sc[5] + (TB[16][2] - 1)*sc[13] + (TB[16][3] - 1)*sc[14] + (TB[16][4] - 1)*sc[15] + (TB[16][5] - 1)*sc[26] + (TB[16][6] - 1)*sc[30] + (TB[16][7] - 1)*sc[24] + (TB[16][8] - 1)*sc[35] + (TB[16][9] - 1)*sc[65] + (TB[16][10] - 1)*sc[62]);
+        alpha[17] = (memcmp(TB[17], TB[3], 10*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[17][0] - 1)*sc[0] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[13] + (TB[17][3] - 1)*sc[14] + (TB[17][4] - 1)*sc[15] + (TB[17][5] - 1)*sc[26] + (TB[17][6] - 1)*sc[24] + (TB[17][7] - 1)*sc[35] + (TB[17][8] - 1)*sc[65] + (TB[17][9] - 1)*sc[62]);
+        alpha[18] = (memcmp(TB[18], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[18][0] - 1)*sc[0] + (TB[18][1] - 1)*sc[5] + (TB[18][2] - 1)*sc[13] + (TB[18][3] - 1)*sc[14] + (TB[18][4] - 1)*sc[15] + (TB[18][5] - 1)*sc[26] + (TB[18][6] - 1)*sc[30] + (TB[18][7] - 1)*sc[24] + (TB[18][8] - 1)*sc[35] + (TB[18][9] - 1)*sc[65] + (TB[18][10] - 1)*sc[62]);
+        alpha[19] = (memcmp(TB[19], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[19][0] - 1)*sc[0] + (TB[19][1] - 1)*sc[5] + (TB[19][2] - 1)*sc[13] + (TB[19][3] - 1)*sc[14] + (TB[19][4] - 1)*sc[15] + (TB[19][5] - 1)*sc[26] + (TB[19][6] - 1)*sc[30] + (TB[19][7] - 1)*sc[24] + (TB[19][8] - 1)*sc[35] + (TB[19][9] - 1)*sc[65] + (TB[19][10] - 1)*sc[62]);
+        alpha[20] = (memcmp(TB[20], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[20][0] - 1)*sc[0] + (TB[20][1] - 1)*sc[5] + (TB[20][2] - 1)*sc[13] + (TB[20][3] - 1)*sc[14] + (TB[20][4] - 1)*sc[15] + (TB[20][5] - 1)*sc[26] + (TB[20][6] - 1)*sc[30] + (TB[20][7] - 1)*sc[24] + (TB[20][8] - 1)*sc[35] + (TB[20][9] - 1)*sc[65] + (TB[20][10] - 1)*sc[62]);
+        alpha[21] = (memcmp(TB[21], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[21][0] - 1)*sc[0] + (TB[21][1] - 1)*sc[5] + (TB[21][2] - 1)*sc[13] + (TB[21][3] - 1)*sc[14] + (TB[21][4] - 1)*sc[15] + (TB[21][5] - 1)*sc[26] + (TB[21][6] - 1)*sc[30] + (TB[21][7] - 1)*sc[24] + (TB[21][8] - 1)*sc[35] + (TB[21][9] - 1)*sc[65] + (TB[21][10] - 1)*sc[62]);
+        alpha[22] = (memcmp(TB[22], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[22][0] - 1)*sc[0] + (TB[22][1] - 1)*sc[5] + (TB[22][2] - 1)*sc[13] + (TB[22][3] - 1)*sc[14] + (TB[22][4] - 1)*sc[15] + (TB[22][5] - 1)*sc[26] + (TB[22][6] - 1)*sc[30] + (TB[22][7] - 1)*sc[24] + (TB[22][8] - 1)*sc[35] + (TB[22][9] - 1)*sc[65] + (TB[22][10] - 1)*sc[62]);
+        alpha[23] = (memcmp(TB[23], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[23][0] - 1)*sc[0] + (TB[23][1] - 1)*sc[5] + (TB[23][2] - 1)*sc[13] + (TB[23][3] - 1)*sc[14] + (TB[23][4] - 1)*sc[15] + (TB[23][5] - 1)*sc[26] + (TB[23][6] - 1)*sc[30] + (TB[23][7] - 1)*sc[24] + (TB[23][8] - 1)*sc[35] + (TB[23][9] - 1)*sc[65] + (TB[23][10] - 1)*sc[62]);
+        alpha[24] = (memcmp(TB[24], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[24][0] - 1)*sc[0] + (TB[24][1] - 1)*sc[5] + (TB[24][2] - 1)*sc[13] + (TB[24][3] - 1)*sc[14] + (TB[24][4] - 1)*sc[15] + (TB[24][5] - 1)*sc[26] + (TB[24][6] - 1)*sc[30] + (TB[24][7] - 1)*sc[24] + (TB[24][8] - 1)*sc[35] + (TB[24][9] - 1)*sc[65] + (TB[24][10] - 1)*sc[62]);
+        alpha[25] = (memcmp(TB[25], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[25][0] - 1)*sc[0] + (TB[25][1] - 1)*sc[5] + (TB[25][2] - 1)*sc[13] + (TB[25][3] - 1)*sc[14] + (TB[25][4] - 1)*sc[15] + (TB[25][5] - 1)*sc[26] + (TB[25][6] - 1)*sc[30] + (TB[25][7] - 1)*sc[24] + (TB[25][8] - 1)*sc[35] + (TB[25][9] - 1)*sc[65] + (TB[25][10] - 1)*sc[62]);
+        alpha[26] = (memcmp(TB[26], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[26][0] - 1)*sc[0] + (TB[26][1] - 1)*sc[5] + (TB[26][2] - 1)*sc[13] + (TB[26][3] - 1)*sc[14] + (TB[26][4] - 1)*sc[15] + (TB[26][5] - 1)*sc[26] + (TB[26][6] - 1)*sc[30] + (TB[26][7] - 1)*sc[24] + (TB[26][8] - 1)*sc[35] + (TB[26][9] - 1)*sc[65] + (TB[26][10] - 1)*sc[62]);
+        alpha[27] = (memcmp(TB[27], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[27][0] - 1)*sc[0] + (TB[27][1] - 1)*sc[5] + (TB[27][2] - 1)*sc[13] + (TB[27][3] - 1)*sc[14] + (TB[27][4] - 1)*sc[15] + (TB[27][5] - 1)*sc[26] + (TB[27][6] - 1)*sc[30] + (TB[27][7] - 1)*sc[24] + (TB[27][8] - 1)*sc[35] + (TB[27][9] - 1)*sc[65] + (TB[27][10] - 1)*sc[62]);
+        alpha[28] = (memcmp(TB[28], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[28][0] - 1)*sc[0] + (TB[28][1] - 1)*sc[5] + (TB[28][2] - 1)*sc[13] + (TB[28][3] - 1)*sc[14] + (TB[28][4] - 1)*sc[15] + (TB[28][5] - 1)*sc[26] + (TB[28][6] - 1)*sc[30] + (TB[28][7] - 1)*sc[24] + (TB[28][8] - 1)*sc[35] + (TB[28][9] - 1)*sc[65] + (TB[28][10] - 1)*sc[62]);
+        alpha[29] = (memcmp(TB[29], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[29][0] - 1)*sc[0] + (TB[29][1] - 1)*sc[5] + (TB[29][2] - 1)*sc[13] + (TB[29][3] - 1)*sc[14] + (TB[29][4] - 1)*sc[15] + (TB[29][5] - 1)*sc[26] + (TB[29][6] - 1)*sc[30] + (TB[29][7] - 1)*sc[24] + (TB[29][8] - 1)*sc[35] + (TB[29][9] - 1)*sc[65] + (TB[29][10] - 1)*sc[62]);
+        alpha[30] = (memcmp(TB[30], TB[3], 10*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[30][0] - 1)*sc[0] + (TB[30][1] - 1)*sc[5] + (TB[30][2] - 1)*sc[13] + (TB[30][3] - 1)*sc[14] + (TB[30][4] - 1)*sc[15] + (TB[30][5] - 1)*sc[26] + (TB[30][6] - 1)*sc[24] + (TB[30][7] - 1)*sc[35] + (TB[30][8] - 1)*sc[65] + (TB[30][9] - 1)*sc[62]);
+        alpha[31] = (memcmp(TB[31], TB[3], 10*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[31][0] - 1)*sc[0] + (TB[31][1] - 1)*sc[5] + (TB[31][2] - 1)*sc[13] + (TB[31][3] - 1)*sc[14] + (TB[31][4] - 1)*sc[15] + (TB[31][5] - 1)*sc[26] + (TB[31][6] - 1)*sc[24] + (TB[31][7] - 1)*sc[35] + (TB[31][8] - 1)*sc[65] + (TB[31][9] - 1)*sc[62]);
+        alpha[32] = (memcmp(TB[32], TB[3], 10*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[32][0] - 1)*sc[0] + (TB[32][1] - 1)*sc[5] + (TB[32][2] - 1)*sc[13] + (TB[32][3] - 1)*sc[14] + (TB[32][4] - 1)*sc[15] + (TB[32][5] - 1)*sc[26] + (TB[32][6] - 1)*sc[24] + (TB[32][7] - 1)*sc[35] + (TB[32][8] - 1)*sc[65] + (TB[32][9] - 1)*sc[62]);
+        alpha[33] = (memcmp(TB[33], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[33][0] - 1)*sc[0] + (TB[33][1] - 1)*sc[5] + (TB[33][2] - 1)*sc[13] + (TB[33][3] - 1)*sc[14] + (TB[33][4] - 1)*sc[15] + (TB[33][5] - 1)*sc[26] + (TB[33][6] - 1)*sc[30] + (TB[33][7] - 1)*sc[24] + (TB[33][8] - 1)*sc[35] + (TB[33][9] - 1)*sc[65] + (TB[33][10] - 1)*sc[62]);
         alpha[34] = mixture + (TB[34][0] - 1)*sc[0] + (TB[34][1] - 1)*sc[5] + (TB[34][2] - 1)*sc[13] + (TB[34][3] - 1)*sc[14] + (TB[34][4] - 1)*sc[15] + (TB[34][5] - 1)*sc[26] + (TB[34][6] - 1)*sc[30];
-        alpha[35] = mixture + (TB[35][0] - 1)*sc[0] + (TB[35][1] - 1)*sc[5] + (TB[35][2] - 1)*sc[13] + (TB[35][3] - 1)*sc[14] + (TB[35][4] - 1)*sc[15] + (TB[35][5] - 1)*sc[26] + (TB[35][6] - 1)*sc[30] + (TB[35][7] - 1)*sc[24] + (TB[35][8] - 1)*sc[35] + (TB[35][9] - 1)*sc[65] + (TB[35][10] - 1)*sc[62];
+        alpha[35] = (memcmp(TB[35], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[35][0] - 1)*sc[0] + (TB[35][1] - 1)*sc[5] + (TB[35][2] - 1)*sc[13] + (TB[35][3] - 1)*sc[14] + (TB[35][4] - 1)*sc[15] + (TB[35][5] - 1)*sc[26] + (TB[35][6] - 1)*sc[30] + (TB[35][7] - 1)*sc[24] + (TB[35][8] - 1)*sc[35] + (TB[35][9] - 1)*sc[65] + (TB[35][10] - 1)*sc[62]);
 #ifdef __INTEL_COMPILER
          #pragma simd
 #endif
@@ -25755,7 +26846,7 @@ void comp_qfqr(double * restrict qf, double * restrict qr, double * restrict sc,
         double alpha;
         alpha = mixture + (TB[37][0] - 1)*sc[0] + (TB[37][1] - 1)*sc[5] + (TB[37][2] - 1)*sc[13] + (TB[37][3] - 1)*sc[14] + (TB[37][4] - 1)*sc[15] + (TB[37][5] - 1)*sc[26] + (TB[37][6] - 1)*sc[30] + (TB[37][7] - 1)*sc[24] + (TB[37][8] - 1)*sc[35] + (TB[37][9] - 1)*sc[65] + (TB[37][10] - 1)*sc[62];
         Corr[37] = alpha;
-        alpha = mixture + (TB[38][0] - 1)*sc[0] + (TB[38][1] - 1)*sc[5] + (TB[38][2] - 1)*sc[13] + (TB[38][3] - 1)*sc[14] + (TB[38][4] - 1)*sc[15] + (TB[38][5] - 1)*sc[26] + (TB[38][6] - 1)*sc[30] + (TB[38][7] - 1)*sc[24] + (TB[38][8] - 1)*sc[35] + (TB[38][9] - 1)*sc[65] + (TB[38][10] - 1)*sc[62];
+        alpha = (memcmp(TB[38], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[38][0] - 1)*sc[0] + (TB[38][1] - 1)*sc[5] + (TB[38][2] - 1)*sc[13] + (TB[38][3] - 1)*sc[14] + (TB[38][4] - 1)*sc[15] + (TB[38][5] - 1)*sc[26] + (TB[38][6] - 1)*sc[30] + (TB[38][7] - 1)*sc[24] + (TB[38][8] - 1)*sc[35] + (TB[38][9] - 1)*sc[65] + (TB[38][10] - 1)*sc[62]);
         Corr[38] = alpha;
         alpha = mixture + (TB[39][0] - 1)*sc[3] + (TB[39][1] - 1)*sc[5] + (TB[39][2] - 1)*sc[14] + (TB[39][3] - 1)*sc[15] + (TB[39][4] - 1)*sc[26] + (TB[39][5] - 1)*sc[31] + (TB[39][6] - 1)*sc[30] + (TB[39][7] - 1)*sc[24] + (TB[39][8] - 1)*sc[35] + (TB[39][9] - 1)*sc[65] + (TB[39][10] - 1)*sc[62];
         Corr[39] = alpha;
@@ -33909,17 +35000,24 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         mixture += sc[k];
     }
 
-    /*compute the Gibbs free energy */
-    double g_RT[70];
-    gibbs(g_RT, tc);
-
     /*compute the species enthalpy */
     double h_RT[70];
     speciesEnthalpy(h_RT, tc);
 
+    /*compute the rate and equilibrium constants */
+    double k_f_s[463], Kc_s[463];
+    comp_k_f(tc, invT, k_f_s);
+    comp_Kc(tc, invT, Kc_s);
+
+    /*at constant volume, the part of dwdot/d[X] common to all species */
+    double Jmix[70];
+    for (int k=0; k<70; k++) {
+        Jmix[k] = 0.0;
+    }
+
     double phi_f, k_f, k_r, phi_r, Kc, q, q_nocor, Corr, alpha;
     double dlnkfdT, dlnk0dT, dlnKcdT, dkrdT, dqdT;
-    double dqdci, dcdc_fac, dqdc[70];
+    double dqdci, dcdc_fac;
     double Pr, fPr, F, k_0, logPr;
     double logFcent, troe_c, troe_n, troePr_den, troePr, troe;
     double Fcent1, Fcent2, Fcent3, Fcent;
@@ -33927,15 +35025,21 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     double dlogPrdT, dlogfPrdT, dlogFdT, dlogFcentdT, dlogFdlogPr, dlnCorrdT;
     const double ln10 = log(10.0);
     const double log10e = 1.0/log(10.0);
+    double x_0, x_0_s[1], e_0_s[1];
+    double logFcent_s[1], dlogFcentdT_s[1];
+
+    /*third-body efficiencies shared by several reactions */
+    double alpha_eff0 = mixture + (TB[0][0] - 1)*sc[0] + (TB[0][1] - 1)*sc[5] + (TB[0][2] - 1)*sc[13] + (TB[0][3] - 1)*sc[14] + (TB[0][4] - 1)*sc[15] + (TB[0][5] - 1)*sc[26] + (TB[0][6] - 1)*sc[30] + (TB[0][7] - 1)*sc[24] + (TB[0][8] - 1)*sc[35] + (TB[0][9] - 1)*sc[65] + (TB[0][10] - 1)*sc[62];
+    double alpha_eff1 = mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[13] + (TB[3][3] - 1)*sc[14] + (TB[3][4] - 1)*sc[15] + (TB[3][5] - 1)*sc[26] + (TB[3][6] - 1)*sc[24] + (TB[3][7] - 1)*sc[35] + (TB[3][8] - 1)*sc[65] + (TB[3][9] - 1)*sc[62];
+
     /*reaction 1: H + CH2 (+M) <=> CH3 (+M) */
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[0][0] - 1)*sc[0] + (TB[0][1] - 1)*sc[5] + (TB[0][2] - 1)*sc[13] + (TB[0][3] - 1)*sc[14] + (TB[0][4] - 1)*sc[15] + (TB[0][5] - 1)*sc[26] + (TB[0][6] - 1)*sc[30] + (TB[0][7] - 1)*sc[24] + (TB[0][8] - 1)*sc[35] + (TB[0][9] - 1)*sc[65] + (TB[0][10] - 1)*sc[62];
+    alpha = alpha_eff0;
     /* forward */
     phi_f = sc[1]*sc[10];
-    k_f = prefactor_units[0] * fwd_A[0]
-                * exp(fwd_beta[0] * tc[0] - activation_units[0] * fwd_Ea[0] * invT);
+    k_f = k_f_s[0];
     dlnkfdT = fwd_beta[0] * invT + activation_units[0] * fwd_Ea[0] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[0] * exp(low_beta[0] * tc[0] - activation_units[0] * low_Ea[0] * invT);
@@ -33951,16 +35055,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[0] == 4 ? exp(-troe_Tss[0] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
+      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
+      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[0]) > 1.e-100 ? -Fcent1/troe_Tsss[0] : 0.)
-      + (fabs(troe_Ts[0]) > 1.e-100 ? -Fcent2/troe_Ts[0] : 0.)
-      + (troe_len[0] == 4 ? Fcent3*troe_Tss[0]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -33968,7 +35072,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[12];
-    Kc = refCinv * exp(g_RT[1] + g_RT[10] - g_RT[12]);
+    Kc = Kc_s[0];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[10]) + (h_RT[12]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -33986,155 +35090,80 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[0][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[10] -= dqdci;               /* dwdot[CH2]/d[H2] */
-        J[12] += dqdci;               /* dwdot[CH3]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[10];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[81] -= dqdci;               /* dwdot[CH2]/d[H] */
-        J[83] += dqdci;               /* dwdot[CH3]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[0][1] - 1)*dcdc_fac;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[365] -= dqdci;              /* dwdot[CH2]/d[H2O] */
-        J[367] += dqdci;              /* dwdot[CH3]/d[H2O] */
-        /* d()/d[CH2] */
-        dqdci =  + k_f*sc[1];
-        J[711] -= dqdci;              /* dwdot[H]/d[CH2] */
-        J[720] -= dqdci;              /* dwdot[CH2]/d[CH2] */
-        J[722] += dqdci;              /* dwdot[CH3]/d[CH2] */
-        /* d()/d[CH3] */
-        dqdci =  - k_r;
-        J[853] -= dqdci;              /* dwdot[H]/d[CH3] */
-        J[862] -= dqdci;              /* dwdot[CH2]/d[CH3] */
-        J[864] += dqdci;              /* dwdot[CH3]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[0][2] - 1)*dcdc_fac;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[933] -= dqdci;              /* dwdot[CH2]/d[CH4] */
-        J[935] += dqdci;              /* dwdot[CH3]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[0][3] - 1)*dcdc_fac;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[1004] -= dqdci;             /* dwdot[CH2]/d[CO] */
-        J[1006] += dqdci;             /* dwdot[CH3]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[0][4] - 1)*dcdc_fac;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1075] -= dqdci;             /* dwdot[CH2]/d[CO2] */
-        J[1077] += dqdci;             /* dwdot[CH3]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[0][7] - 1)*dcdc_fac;
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1714] -= dqdci;             /* dwdot[CH2]/d[C2H4] */
-        J[1716] += dqdci;             /* dwdot[CH3]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[0][5] - 1)*dcdc_fac;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1856] -= dqdci;             /* dwdot[CH2]/d[C2H6] */
-        J[1858] += dqdci;             /* dwdot[CH3]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[0][6] - 1)*dcdc_fac;
-        J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2140] -= dqdci;             /* dwdot[CH2]/d[AR] */
-        J[2142] += dqdci;             /* dwdot[CH3]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[0][8] - 1)*dcdc_fac;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2495] -= dqdci;             /* dwdot[CH2]/d[pC3H4] */
-        J[2497] += dqdci;             /* dwdot[CH3]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[0][10] - 1)*dcdc_fac;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4412] -= dqdci;             /* dwdot[CH2]/d[C3H8] */
-        J[4414] += dqdci;             /* dwdot[CH3]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[0][9] - 1)*dcdc_fac;
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4625] -= dqdci;             /* dwdot[CH2]/d[C3H6] */
-        J[4627] += dqdci;             /* dwdot[CH3]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[0][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[10];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[0][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac + k_f*sc[1];
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac - k_r;
-        dqdc[13] = TB[0][2]*dcdc_fac;
-        dqdc[14] = TB[0][3]*dcdc_fac;
-        dqdc[15] = TB[0][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[0][7]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[0][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[0][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[0][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[0][10]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[0][9]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+10] -= dqdc[k];
-            J[71*k+12] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[10] -= dcdc_fac;
+    Jmix[12] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[0][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[10] -= dqdci;               /* dwdot[CH2]/d[H2] */
+    J[12] += dqdci;               /* dwdot[CH3]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[10];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[81] -= dqdci;               /* dwdot[CH2]/d[H] */
+    J[83] += dqdci;               /* dwdot[CH3]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[0][1] - 1)*dcdc_fac;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[365] -= dqdci;              /* dwdot[CH2]/d[H2O] */
+    J[367] += dqdci;              /* dwdot[CH3]/d[H2O] */
+    /* d()/d[CH2] */
+    dqdci =  + k_f*sc[1];
+    J[711] -= dqdci;              /* dwdot[H]/d[CH2] */
+    J[720] -= dqdci;              /* dwdot[CH2]/d[CH2] */
+    J[722] += dqdci;              /* dwdot[CH3]/d[CH2] */
+    /* d()/d[CH3] */
+    dqdci =  - k_r;
+    J[853] -= dqdci;              /* dwdot[H]/d[CH3] */
+    J[862] -= dqdci;              /* dwdot[CH2]/d[CH3] */
+    J[864] += dqdci;              /* dwdot[CH3]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[0][2] - 1)*dcdc_fac;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[933] -= dqdci;              /* dwdot[CH2]/d[CH4] */
+    J[935] += dqdci;              /* dwdot[CH3]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[0][3] - 1)*dcdc_fac;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[1004] -= dqdci;             /* dwdot[CH2]/d[CO] */
+    J[1006] += dqdci;             /* dwdot[CH3]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[0][4] - 1)*dcdc_fac;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1075] -= dqdci;             /* dwdot[CH2]/d[CO2] */
+    J[1077] += dqdci;             /* dwdot[CH3]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[0][7] - 1)*dcdc_fac;
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1714] -= dqdci;             /* dwdot[CH2]/d[C2H4] */
+    J[1716] += dqdci;             /* dwdot[CH3]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[0][5] - 1)*dcdc_fac;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1856] -= dqdci;             /* dwdot[CH2]/d[C2H6] */
+    J[1858] += dqdci;             /* dwdot[CH3]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[0][6] - 1)*dcdc_fac;
+    J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2140] -= dqdci;             /* dwdot[CH2]/d[AR] */
+    J[2142] += dqdci;             /* dwdot[CH3]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[0][8] - 1)*dcdc_fac;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2495] -= dqdci;             /* dwdot[CH2]/d[pC3H4] */
+    J[2497] += dqdci;             /* dwdot[CH3]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[0][10] - 1)*dcdc_fac;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4412] -= dqdci;             /* dwdot[CH2]/d[C3H8] */
+    J[4414] += dqdci;             /* dwdot[CH3]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[0][9] - 1)*dcdc_fac;
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4625] -= dqdci;             /* dwdot[CH2]/d[C3H6] */
+    J[4627] += dqdci;             /* dwdot[CH3]/d[C3H6] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[4980] -= dqdT; /* dwdot[CH2]/dT */
     J[4982] += dqdT; /* dwdot[CH3]/dT */
@@ -34146,8 +35175,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[1][0] - 1)*sc[0] + (TB[1][1] - 1)*sc[5] + (TB[1][2] - 1)*sc[13] + (TB[1][3] - 1)*sc[14] + (TB[1][4] - 1)*sc[15] + (TB[1][5] - 1)*sc[26] + (TB[1][6] - 1)*sc[30] + (TB[1][7] - 1)*sc[24] + (TB[1][8] - 1)*sc[35] + (TB[1][9] - 1)*sc[65] + (TB[1][10] - 1)*sc[62];
     /* forward */
     phi_f = sc[1]*sc[12];
-    k_f = prefactor_units[1] * fwd_A[1]
-                * exp(fwd_beta[1] * tc[0] - activation_units[1] * fwd_Ea[1] * invT);
+    k_f = k_f_s[1];
     dlnkfdT = fwd_beta[1] * invT + activation_units[1] * fwd_Ea[1] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[1] * exp(low_beta[1] * tc[0] - activation_units[1] * low_Ea[1] * invT);
@@ -34163,16 +35191,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[1] == 4 ? exp(-troe_Tss[1] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
+      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
+      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[1]) > 1.e-100 ? -Fcent1/troe_Tsss[1] : 0.)
-      + (fabs(troe_Ts[1]) > 1.e-100 ? -Fcent2/troe_Ts[1] : 0.)
-      + (troe_len[1] == 4 ? Fcent3*troe_Tss[1]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -34180,7 +35208,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[13];
-    Kc = refCinv * exp(g_RT[1] + g_RT[12] - g_RT[13]);
+    Kc = Kc_s[1];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[12]) + (h_RT[13]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34198,150 +35226,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[1][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
-        J[13] += dqdci;               /* dwdot[CH4]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[12];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[83] -= dqdci;               /* dwdot[CH3]/d[H] */
-        J[84] += dqdci;               /* dwdot[CH4]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[1][1] - 1)*dcdc_fac;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[367] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[368] += dqdci;              /* dwdot[CH4]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[1];
-        J[853] -= dqdci;              /* dwdot[H]/d[CH3] */
-        J[864] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[865] += dqdci;              /* dwdot[CH4]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[1][2] - 1)*dcdc_fac - k_r;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[935] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[936] += dqdci;              /* dwdot[CH4]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[1][3] - 1)*dcdc_fac;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[1006] -= dqdci;             /* dwdot[CH3]/d[CO] */
-        J[1007] += dqdci;             /* dwdot[CH4]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[1][4] - 1)*dcdc_fac;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1077] -= dqdci;             /* dwdot[CH3]/d[CO2] */
-        J[1078] += dqdci;             /* dwdot[CH4]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[1][7] - 1)*dcdc_fac;
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1716] -= dqdci;             /* dwdot[CH3]/d[C2H4] */
-        J[1717] += dqdci;             /* dwdot[CH4]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[1][5] - 1)*dcdc_fac;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1858] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
-        J[1859] += dqdci;             /* dwdot[CH4]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[1][6] - 1)*dcdc_fac;
-        J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2142] -= dqdci;             /* dwdot[CH3]/d[AR] */
-        J[2143] += dqdci;             /* dwdot[CH4]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[1][8] - 1)*dcdc_fac;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2497] -= dqdci;             /* dwdot[CH3]/d[pC3H4] */
-        J[2498] += dqdci;             /* dwdot[CH4]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[1][10] - 1)*dcdc_fac;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4414] -= dqdci;             /* dwdot[CH3]/d[C3H8] */
-        J[4415] += dqdci;             /* dwdot[CH4]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[1][9] - 1)*dcdc_fac;
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4627] -= dqdci;             /* dwdot[CH3]/d[C3H6] */
-        J[4628] += dqdci;             /* dwdot[CH4]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[1][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[12];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[1][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*sc[1];
-        dqdc[13] = TB[1][2]*dcdc_fac - k_r;
-        dqdc[14] = TB[1][3]*dcdc_fac;
-        dqdc[15] = TB[1][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[1][7]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[1][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[1][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[1][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[1][10]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[1][9]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+12] -= dqdc[k];
-            J[71*k+13] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[12] -= dcdc_fac;
+    Jmix[13] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[1][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
+    J[13] += dqdci;               /* dwdot[CH4]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[12];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[83] -= dqdci;               /* dwdot[CH3]/d[H] */
+    J[84] += dqdci;               /* dwdot[CH4]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[1][1] - 1)*dcdc_fac;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[367] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[368] += dqdci;              /* dwdot[CH4]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[1];
+    J[853] -= dqdci;              /* dwdot[H]/d[CH3] */
+    J[864] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[865] += dqdci;              /* dwdot[CH4]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[1][2] - 1)*dcdc_fac - k_r;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[935] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[936] += dqdci;              /* dwdot[CH4]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[1][3] - 1)*dcdc_fac;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[1006] -= dqdci;             /* dwdot[CH3]/d[CO] */
+    J[1007] += dqdci;             /* dwdot[CH4]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[1][4] - 1)*dcdc_fac;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1077] -= dqdci;             /* dwdot[CH3]/d[CO2] */
+    J[1078] += dqdci;             /* dwdot[CH4]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[1][7] - 1)*dcdc_fac;
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1716] -= dqdci;             /* dwdot[CH3]/d[C2H4] */
+    J[1717] += dqdci;             /* dwdot[CH4]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[1][5] - 1)*dcdc_fac;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1858] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
+    J[1859] += dqdci;             /* dwdot[CH4]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[1][6] - 1)*dcdc_fac;
+    J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2142] -= dqdci;             /* dwdot[CH3]/d[AR] */
+    J[2143] += dqdci;             /* dwdot[CH4]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[1][8] - 1)*dcdc_fac;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2497] -= dqdci;             /* dwdot[CH3]/d[pC3H4] */
+    J[2498] += dqdci;             /* dwdot[CH4]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[1][10] - 1)*dcdc_fac;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4414] -= dqdci;             /* dwdot[CH3]/d[C3H8] */
+    J[4415] += dqdci;             /* dwdot[CH4]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[1][9] - 1)*dcdc_fac;
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4627] -= dqdci;             /* dwdot[CH3]/d[C3H6] */
+    J[4628] += dqdci;             /* dwdot[CH4]/d[C3H6] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[4982] -= dqdT; /* dwdot[CH3]/dT */
     J[4983] += dqdT; /* dwdot[CH4]/dT */
@@ -34350,11 +35303,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[13] + (TB[2][3] - 1)*sc[14] + (TB[2][4] - 1)*sc[15] + (TB[2][5] - 1)*sc[26] + (TB[2][6] - 1)*sc[30] + (TB[2][7] - 1)*sc[24] + (TB[2][8] - 1)*sc[35] + (TB[2][9] - 1)*sc[65] + (TB[2][10] - 1)*sc[62];
+    alpha = (memcmp(TB[2], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[2][0] - 1)*sc[0] + (TB[2][1] - 1)*sc[5] + (TB[2][2] - 1)*sc[13] + (TB[2][3] - 1)*sc[14] + (TB[2][4] - 1)*sc[15] + (TB[2][5] - 1)*sc[26] + (TB[2][6] - 1)*sc[30] + (TB[2][7] - 1)*sc[24] + (TB[2][8] - 1)*sc[35] + (TB[2][9] - 1)*sc[65] + (TB[2][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[1]*sc[16];
-    k_f = prefactor_units[2] * fwd_A[2]
-                * exp(fwd_beta[2] * tc[0] - activation_units[2] * fwd_Ea[2] * invT);
+    k_f = k_f_s[2];
     dlnkfdT = fwd_beta[2] * invT + activation_units[2] * fwd_Ea[2] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[2] * exp(low_beta[2] * tc[0] - activation_units[2] * low_Ea[2] * invT);
@@ -34370,16 +35322,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[2] == 4 ? exp(-troe_Tss[2] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[2]) > 1.e-100 ? -Fcent1/troe_Tsss[2] : 0.)
+      + (fabs(troe_Ts[2]) > 1.e-100 ? -Fcent2/troe_Ts[2] : 0.)
+      + (troe_len[2] == 4 ? Fcent3*troe_Tss[2]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[2]) > 1.e-100 ? -Fcent1/troe_Tsss[2] : 0.)
-      + (fabs(troe_Ts[2]) > 1.e-100 ? -Fcent2/troe_Ts[2] : 0.)
-      + (troe_len[2] == 4 ? Fcent3*troe_Tss[2]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -34387,7 +35339,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[17];
-    Kc = refCinv * exp(g_RT[1] + g_RT[16] - g_RT[17]);
+    Kc = Kc_s[2];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[16]) + (h_RT[17]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34405,155 +35357,80 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[2][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[16] -= dqdci;               /* dwdot[HCO]/d[H2] */
-        J[17] += dqdci;               /* dwdot[CH2O]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[16];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[87] -= dqdci;               /* dwdot[HCO]/d[H] */
-        J[88] += dqdci;               /* dwdot[CH2O]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[2][1] - 1)*dcdc_fac;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[371] -= dqdci;              /* dwdot[HCO]/d[H2O] */
-        J[372] += dqdci;              /* dwdot[CH2O]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[2][2] - 1)*dcdc_fac;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[939] -= dqdci;              /* dwdot[HCO]/d[CH4] */
-        J[940] += dqdci;              /* dwdot[CH2O]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[2][3] - 1)*dcdc_fac;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[1010] -= dqdci;             /* dwdot[HCO]/d[CO] */
-        J[1011] += dqdci;             /* dwdot[CH2O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[2][4] - 1)*dcdc_fac;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1081] -= dqdci;             /* dwdot[HCO]/d[CO2] */
-        J[1082] += dqdci;             /* dwdot[CH2O]/d[CO2] */
-        /* d()/d[HCO] */
-        dqdci =  + k_f*sc[1];
-        J[1137] -= dqdci;             /* dwdot[H]/d[HCO] */
-        J[1152] -= dqdci;             /* dwdot[HCO]/d[HCO] */
-        J[1153] += dqdci;             /* dwdot[CH2O]/d[HCO] */
-        /* d()/d[CH2O] */
-        dqdci =  - k_r;
-        J[1208] -= dqdci;             /* dwdot[H]/d[CH2O] */
-        J[1223] -= dqdci;             /* dwdot[HCO]/d[CH2O] */
-        J[1224] += dqdci;             /* dwdot[CH2O]/d[CH2O] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[2][7] - 1)*dcdc_fac;
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1720] -= dqdci;             /* dwdot[HCO]/d[C2H4] */
-        J[1721] += dqdci;             /* dwdot[CH2O]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[2][5] - 1)*dcdc_fac;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1862] -= dqdci;             /* dwdot[HCO]/d[C2H6] */
-        J[1863] += dqdci;             /* dwdot[CH2O]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[2][6] - 1)*dcdc_fac;
-        J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2146] -= dqdci;             /* dwdot[HCO]/d[AR] */
-        J[2147] += dqdci;             /* dwdot[CH2O]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[2][8] - 1)*dcdc_fac;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2501] -= dqdci;             /* dwdot[HCO]/d[pC3H4] */
-        J[2502] += dqdci;             /* dwdot[CH2O]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[2][10] - 1)*dcdc_fac;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4418] -= dqdci;             /* dwdot[HCO]/d[C3H8] */
-        J[4419] += dqdci;             /* dwdot[CH2O]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[2][9] - 1)*dcdc_fac;
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4631] -= dqdci;             /* dwdot[HCO]/d[C3H6] */
-        J[4632] += dqdci;             /* dwdot[CH2O]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[2][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[16];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[2][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[2][2]*dcdc_fac;
-        dqdc[14] = TB[2][3]*dcdc_fac;
-        dqdc[15] = TB[2][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac + k_f*sc[1];
-        dqdc[17] = dcdc_fac - k_r;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[2][7]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[2][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[2][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[2][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[2][10]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[2][9]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+16] -= dqdc[k];
-            J[71*k+17] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[16] -= dcdc_fac;
+    Jmix[17] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[2][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[16] -= dqdci;               /* dwdot[HCO]/d[H2] */
+    J[17] += dqdci;               /* dwdot[CH2O]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[16];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[87] -= dqdci;               /* dwdot[HCO]/d[H] */
+    J[88] += dqdci;               /* dwdot[CH2O]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[2][1] - 1)*dcdc_fac;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[371] -= dqdci;              /* dwdot[HCO]/d[H2O] */
+    J[372] += dqdci;              /* dwdot[CH2O]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[2][2] - 1)*dcdc_fac;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[939] -= dqdci;              /* dwdot[HCO]/d[CH4] */
+    J[940] += dqdci;              /* dwdot[CH2O]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[2][3] - 1)*dcdc_fac;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[1010] -= dqdci;             /* dwdot[HCO]/d[CO] */
+    J[1011] += dqdci;             /* dwdot[CH2O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[2][4] - 1)*dcdc_fac;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1081] -= dqdci;             /* dwdot[HCO]/d[CO2] */
+    J[1082] += dqdci;             /* dwdot[CH2O]/d[CO2] */
+    /* d()/d[HCO] */
+    dqdci =  + k_f*sc[1];
+    J[1137] -= dqdci;             /* dwdot[H]/d[HCO] */
+    J[1152] -= dqdci;             /* dwdot[HCO]/d[HCO] */
+    J[1153] += dqdci;             /* dwdot[CH2O]/d[HCO] */
+    /* d()/d[CH2O] */
+    dqdci =  - k_r;
+    J[1208] -= dqdci;             /* dwdot[H]/d[CH2O] */
+    J[1223] -= dqdci;             /* dwdot[HCO]/d[CH2O] */
+    J[1224] += dqdci;             /* dwdot[CH2O]/d[CH2O] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[2][7] - 1)*dcdc_fac;
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1720] -= dqdci;             /* dwdot[HCO]/d[C2H4] */
+    J[1721] += dqdci;             /* dwdot[CH2O]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[2][5] - 1)*dcdc_fac;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1862] -= dqdci;             /* dwdot[HCO]/d[C2H6] */
+    J[1863] += dqdci;             /* dwdot[CH2O]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[2][6] - 1)*dcdc_fac;
+    J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2146] -= dqdci;             /* dwdot[HCO]/d[AR] */
+    J[2147] += dqdci;             /* dwdot[CH2O]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[2][8] - 1)*dcdc_fac;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2501] -= dqdci;             /* dwdot[HCO]/d[pC3H4] */
+    J[2502] += dqdci;             /* dwdot[CH2O]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[2][10] - 1)*dcdc_fac;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4418] -= dqdci;             /* dwdot[HCO]/d[C3H8] */
+    J[4419] += dqdci;             /* dwdot[CH2O]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[2][9] - 1)*dcdc_fac;
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4631] -= dqdci;             /* dwdot[HCO]/d[C3H6] */
+    J[4632] += dqdci;             /* dwdot[CH2O]/d[C3H6] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[4986] -= dqdT; /* dwdot[HCO]/dT */
     J[4987] += dqdT; /* dwdot[CH2O]/dT */
@@ -34562,11 +35439,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[3][0] - 1)*sc[0] + (TB[3][1] - 1)*sc[5] + (TB[3][2] - 1)*sc[13] + (TB[3][3] - 1)*sc[14] + (TB[3][4] - 1)*sc[15] + (TB[3][5] - 1)*sc[26] + (TB[3][6] - 1)*sc[24] + (TB[3][7] - 1)*sc[35] + (TB[3][8] - 1)*sc[65] + (TB[3][9] - 1)*sc[62];
+    alpha = alpha_eff1;
     /* forward */
     phi_f = sc[1]*sc[17];
-    k_f = prefactor_units[3] * fwd_A[3]
-                * exp(fwd_beta[3] * tc[0] - activation_units[3] * fwd_Ea[3] * invT);
+    k_f = k_f_s[3];
     dlnkfdT = fwd_beta[3] * invT + activation_units[3] * fwd_Ea[3] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[3] * exp(low_beta[3] * tc[0] - activation_units[3] * low_Ea[3] * invT);
@@ -34582,16 +35458,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[3] == 4 ? exp(-troe_Tss[3] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[3]) > 1.e-100 ? -Fcent1/troe_Tsss[3] : 0.)
+      + (fabs(troe_Ts[3]) > 1.e-100 ? -Fcent2/troe_Ts[3] : 0.)
+      + (troe_len[3] == 4 ? Fcent3*troe_Tss[3]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[3]) > 1.e-100 ? -Fcent1/troe_Tsss[3] : 0.)
-      + (fabs(troe_Ts[3]) > 1.e-100 ? -Fcent2/troe_Ts[3] : 0.)
-      + (troe_len[3] == 4 ? Fcent3*troe_Tss[3]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -34599,7 +35475,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[18];
-    Kc = refCinv * exp(g_RT[1] + g_RT[17] - g_RT[18]);
+    Kc = Kc_s[3];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[17]) + (h_RT[18]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34617,150 +35493,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[3][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[17] -= dqdci;               /* dwdot[CH2O]/d[H2] */
-        J[18] += dqdci;               /* dwdot[CH2OH]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[17];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[88] -= dqdci;               /* dwdot[CH2O]/d[H] */
-        J[89] += dqdci;               /* dwdot[CH2OH]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[3][1] - 1)*dcdc_fac;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[372] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
-        J[373] += dqdci;              /* dwdot[CH2OH]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[3][2] - 1)*dcdc_fac;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[940] -= dqdci;              /* dwdot[CH2O]/d[CH4] */
-        J[941] += dqdci;              /* dwdot[CH2OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[3][3] - 1)*dcdc_fac;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[1011] -= dqdci;             /* dwdot[CH2O]/d[CO] */
-        J[1012] += dqdci;             /* dwdot[CH2OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[3][4] - 1)*dcdc_fac;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1082] -= dqdci;             /* dwdot[CH2O]/d[CO2] */
-        J[1083] += dqdci;             /* dwdot[CH2OH]/d[CO2] */
-        /* d()/d[CH2O] */
-        dqdci =  + k_f*sc[1];
-        J[1208] -= dqdci;             /* dwdot[H]/d[CH2O] */
-        J[1224] -= dqdci;             /* dwdot[CH2O]/d[CH2O] */
-        J[1225] += dqdci;             /* dwdot[CH2OH]/d[CH2O] */
-        /* d()/d[CH2OH] */
-        dqdci =  - k_r;
-        J[1279] -= dqdci;             /* dwdot[H]/d[CH2OH] */
-        J[1295] -= dqdci;             /* dwdot[CH2O]/d[CH2OH] */
-        J[1296] += dqdci;             /* dwdot[CH2OH]/d[CH2OH] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[3][6] - 1)*dcdc_fac;
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1721] -= dqdci;             /* dwdot[CH2O]/d[C2H4] */
-        J[1722] += dqdci;             /* dwdot[CH2OH]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[3][5] - 1)*dcdc_fac;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1863] -= dqdci;             /* dwdot[CH2O]/d[C2H6] */
-        J[1864] += dqdci;             /* dwdot[CH2OH]/d[C2H6] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[3][7] - 1)*dcdc_fac;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2502] -= dqdci;             /* dwdot[CH2O]/d[pC3H4] */
-        J[2503] += dqdci;             /* dwdot[CH2OH]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[3][9] - 1)*dcdc_fac;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4419] -= dqdci;             /* dwdot[CH2O]/d[C3H8] */
-        J[4420] += dqdci;             /* dwdot[CH2OH]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[3][8] - 1)*dcdc_fac;
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4632] -= dqdci;             /* dwdot[CH2O]/d[C3H6] */
-        J[4633] += dqdci;             /* dwdot[CH2OH]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[3][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[17];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[3][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[3][2]*dcdc_fac;
-        dqdc[14] = TB[3][3]*dcdc_fac;
-        dqdc[15] = TB[3][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac + k_f*sc[1];
-        dqdc[18] = dcdc_fac - k_r;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[3][6]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[3][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[3][7]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[3][9]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[3][8]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+17] -= dqdc[k];
-            J[71*k+18] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[17] -= dcdc_fac;
+    Jmix[18] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[3][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[17] -= dqdci;               /* dwdot[CH2O]/d[H2] */
+    J[18] += dqdci;               /* dwdot[CH2OH]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[17];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[88] -= dqdci;               /* dwdot[CH2O]/d[H] */
+    J[89] += dqdci;               /* dwdot[CH2OH]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[3][1] - 1)*dcdc_fac;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[372] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
+    J[373] += dqdci;              /* dwdot[CH2OH]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[3][2] - 1)*dcdc_fac;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[940] -= dqdci;              /* dwdot[CH2O]/d[CH4] */
+    J[941] += dqdci;              /* dwdot[CH2OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[3][3] - 1)*dcdc_fac;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[1011] -= dqdci;             /* dwdot[CH2O]/d[CO] */
+    J[1012] += dqdci;             /* dwdot[CH2OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[3][4] - 1)*dcdc_fac;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1082] -= dqdci;             /* dwdot[CH2O]/d[CO2] */
+    J[1083] += dqdci;             /* dwdot[CH2OH]/d[CO2] */
+    /* d()/d[CH2O] */
+    dqdci =  + k_f*sc[1];
+    J[1208] -= dqdci;             /* dwdot[H]/d[CH2O] */
+    J[1224] -= dqdci;             /* dwdot[CH2O]/d[CH2O] */
+    J[1225] += dqdci;             /* dwdot[CH2OH]/d[CH2O] */
+    /* d()/d[CH2OH] */
+    dqdci =  - k_r;
+    J[1279] -= dqdci;             /* dwdot[H]/d[CH2OH] */
+    J[1295] -= dqdci;             /* dwdot[CH2O]/d[CH2OH] */
+    J[1296] += dqdci;             /* dwdot[CH2OH]/d[CH2OH] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[3][6] - 1)*dcdc_fac;
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1721] -= dqdci;             /* dwdot[CH2O]/d[C2H4] */
+    J[1722] += dqdci;             /* dwdot[CH2OH]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[3][5] - 1)*dcdc_fac;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1863] -= dqdci;             /* dwdot[CH2O]/d[C2H6] */
+    J[1864] += dqdci;             /* dwdot[CH2OH]/d[C2H6] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[3][7] - 1)*dcdc_fac;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2502] -= dqdci;             /* dwdot[CH2O]/d[pC3H4] */
+    J[2503] += dqdci;             /* dwdot[CH2OH]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[3][9] - 1)*dcdc_fac;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4419] -= dqdci;             /* dwdot[CH2O]/d[C3H8] */
+    J[4420] += dqdci;             /* dwdot[CH2OH]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[3][8] - 1)*dcdc_fac;
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4632] -= dqdci;             /* dwdot[CH2O]/d[C3H6] */
+    J[4633] += dqdci;             /* dwdot[CH2OH]/d[C3H6] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[4987] -= dqdT; /* dwdot[CH2O]/dT */
     J[4988] += dqdT; /* dwdot[CH2OH]/dT */
@@ -34769,11 +35570,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[13] + (TB[4][3] - 1)*sc[14] + (TB[4][4] - 1)*sc[15] + (TB[4][5] - 1)*sc[26] + (TB[4][6] - 1)*sc[24] + (TB[4][7] - 1)*sc[35] + (TB[4][8] - 1)*sc[65] + (TB[4][9] - 1)*sc[62];
+    alpha = (memcmp(TB[4], TB[3], 10*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[4][0] - 1)*sc[0] + (TB[4][1] - 1)*sc[5] + (TB[4][2] - 1)*sc[13] + (TB[4][3] - 1)*sc[14] + (TB[4][4] - 1)*sc[15] + (TB[4][5] - 1)*sc[26] + (TB[4][6] - 1)*sc[24] + (TB[4][7] - 1)*sc[35] + (TB[4][8] - 1)*sc[65] + (TB[4][9] - 1)*sc[62]);
     /* forward */
     phi_f = sc[1]*sc[17];
-    k_f = prefactor_units[4] * fwd_A[4]
-                * exp(fwd_beta[4] * tc[0] - activation_units[4] * fwd_Ea[4] * invT);
+    k_f = k_f_s[4];
     dlnkfdT = fwd_beta[4] * invT + activation_units[4] * fwd_Ea[4] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[4] * exp(low_beta[4] * tc[0] - activation_units[4] * low_Ea[4] * invT);
@@ -34789,16 +35589,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[4] == 4 ? exp(-troe_Tss[4] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[4]) > 1.e-100 ? -Fcent1/troe_Tsss[4] : 0.)
+      + (fabs(troe_Ts[4]) > 1.e-100 ? -Fcent2/troe_Ts[4] : 0.)
+      + (troe_len[4] == 4 ? Fcent3*troe_Tss[4]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[4]) > 1.e-100 ? -Fcent1/troe_Tsss[4] : 0.)
-      + (fabs(troe_Ts[4]) > 1.e-100 ? -Fcent2/troe_Ts[4] : 0.)
-      + (troe_len[4] == 4 ? Fcent3*troe_Tss[4]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -34806,7 +35606,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[19];
-    Kc = refCinv * exp(g_RT[1] + g_RT[17] - g_RT[19]);
+    Kc = Kc_s[4];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[17]) + (h_RT[19]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -34824,150 +35624,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[4][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[17] -= dqdci;               /* dwdot[CH2O]/d[H2] */
-        J[19] += dqdci;               /* dwdot[CH3O]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[17];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[88] -= dqdci;               /* dwdot[CH2O]/d[H] */
-        J[90] += dqdci;               /* dwdot[CH3O]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[4][1] - 1)*dcdc_fac;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[372] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
-        J[374] += dqdci;              /* dwdot[CH3O]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[4][2] - 1)*dcdc_fac;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[940] -= dqdci;              /* dwdot[CH2O]/d[CH4] */
-        J[942] += dqdci;              /* dwdot[CH3O]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[4][3] - 1)*dcdc_fac;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[1011] -= dqdci;             /* dwdot[CH2O]/d[CO] */
-        J[1013] += dqdci;             /* dwdot[CH3O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[4][4] - 1)*dcdc_fac;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1082] -= dqdci;             /* dwdot[CH2O]/d[CO2] */
-        J[1084] += dqdci;             /* dwdot[CH3O]/d[CO2] */
-        /* d()/d[CH2O] */
-        dqdci =  + k_f*sc[1];
-        J[1208] -= dqdci;             /* dwdot[H]/d[CH2O] */
-        J[1224] -= dqdci;             /* dwdot[CH2O]/d[CH2O] */
-        J[1226] += dqdci;             /* dwdot[CH3O]/d[CH2O] */
-        /* d()/d[CH3O] */
-        dqdci =  - k_r;
-        J[1350] -= dqdci;             /* dwdot[H]/d[CH3O] */
-        J[1366] -= dqdci;             /* dwdot[CH2O]/d[CH3O] */
-        J[1368] += dqdci;             /* dwdot[CH3O]/d[CH3O] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[4][6] - 1)*dcdc_fac;
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1721] -= dqdci;             /* dwdot[CH2O]/d[C2H4] */
-        J[1723] += dqdci;             /* dwdot[CH3O]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[4][5] - 1)*dcdc_fac;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1863] -= dqdci;             /* dwdot[CH2O]/d[C2H6] */
-        J[1865] += dqdci;             /* dwdot[CH3O]/d[C2H6] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[4][7] - 1)*dcdc_fac;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2502] -= dqdci;             /* dwdot[CH2O]/d[pC3H4] */
-        J[2504] += dqdci;             /* dwdot[CH3O]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[4][9] - 1)*dcdc_fac;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4419] -= dqdci;             /* dwdot[CH2O]/d[C3H8] */
-        J[4421] += dqdci;             /* dwdot[CH3O]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[4][8] - 1)*dcdc_fac;
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4632] -= dqdci;             /* dwdot[CH2O]/d[C3H6] */
-        J[4634] += dqdci;             /* dwdot[CH3O]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[4][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[17];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[4][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[4][2]*dcdc_fac;
-        dqdc[14] = TB[4][3]*dcdc_fac;
-        dqdc[15] = TB[4][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac + k_f*sc[1];
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac - k_r;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[4][6]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[4][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[4][7]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[4][9]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[4][8]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+17] -= dqdc[k];
-            J[71*k+19] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[17] -= dcdc_fac;
+    Jmix[19] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[4][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[17] -= dqdci;               /* dwdot[CH2O]/d[H2] */
+    J[19] += dqdci;               /* dwdot[CH3O]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[17];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[88] -= dqdci;               /* dwdot[CH2O]/d[H] */
+    J[90] += dqdci;               /* dwdot[CH3O]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[4][1] - 1)*dcdc_fac;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[372] -= dqdci;              /* dwdot[CH2O]/d[H2O] */
+    J[374] += dqdci;              /* dwdot[CH3O]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[4][2] - 1)*dcdc_fac;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[940] -= dqdci;              /* dwdot[CH2O]/d[CH4] */
+    J[942] += dqdci;              /* dwdot[CH3O]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[4][3] - 1)*dcdc_fac;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[1011] -= dqdci;             /* dwdot[CH2O]/d[CO] */
+    J[1013] += dqdci;             /* dwdot[CH3O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[4][4] - 1)*dcdc_fac;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1082] -= dqdci;             /* dwdot[CH2O]/d[CO2] */
+    J[1084] += dqdci;             /* dwdot[CH3O]/d[CO2] */
+    /* d()/d[CH2O] */
+    dqdci =  + k_f*sc[1];
+    J[1208] -= dqdci;             /* dwdot[H]/d[CH2O] */
+    J[1224] -= dqdci;             /* dwdot[CH2O]/d[CH2O] */
+    J[1226] += dqdci;             /* dwdot[CH3O]/d[CH2O] */
+    /* d()/d[CH3O] */
+    dqdci =  - k_r;
+    J[1350] -= dqdci;             /* dwdot[H]/d[CH3O] */
+    J[1366] -= dqdci;             /* dwdot[CH2O]/d[CH3O] */
+    J[1368] += dqdci;             /* dwdot[CH3O]/d[CH3O] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[4][6] - 1)*dcdc_fac;
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1721] -= dqdci;             /* dwdot[CH2O]/d[C2H4] */
+    J[1723] += dqdci;             /* dwdot[CH3O]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[4][5] - 1)*dcdc_fac;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1863] -= dqdci;             /* dwdot[CH2O]/d[C2H6] */
+    J[1865] += dqdci;             /* dwdot[CH3O]/d[C2H6] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[4][7] - 1)*dcdc_fac;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2502] -= dqdci;             /* dwdot[CH2O]/d[pC3H4] */
+    J[2504] += dqdci;             /* dwdot[CH3O]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[4][9] - 1)*dcdc_fac;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4419] -= dqdci;             /* dwdot[CH2O]/d[C3H8] */
+    J[4421] += dqdci;             /* dwdot[CH3O]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[4][8] - 1)*dcdc_fac;
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4632] -= dqdci;             /* dwdot[CH2O]/d[C3H6] */
+    J[4634] += dqdci;             /* dwdot[CH3O]/d[C3H6] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[4987] -= dqdT; /* dwdot[CH2O]/dT */
     J[4989] += dqdT; /* dwdot[CH3O]/dT */
@@ -34976,11 +35701,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[13] + (TB[5][3] - 1)*sc[14] + (TB[5][4] - 1)*sc[15] + (TB[5][5] - 1)*sc[26] + (TB[5][6] - 1)*sc[24] + (TB[5][7] - 1)*sc[35] + (TB[5][8] - 1)*sc[65] + (TB[5][9] - 1)*sc[62];
+    alpha = (memcmp(TB[5], TB[3], 10*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[5][0] - 1)*sc[0] + (TB[5][1] - 1)*sc[5] + (TB[5][2] - 1)*sc[13] + (TB[5][3] - 1)*sc[14] + (TB[5][4] - 1)*sc[15] + (TB[5][5] - 1)*sc[26] + (TB[5][6] - 1)*sc[24] + (TB[5][7] - 1)*sc[35] + (TB[5][8] - 1)*sc[65] + (TB[5][9] - 1)*sc[62]);
     /* forward */
     phi_f = sc[1]*sc[18];
-    k_f = prefactor_units[5] * fwd_A[5]
-                * exp(fwd_beta[5] * tc[0] - activation_units[5] * fwd_Ea[5] * invT);
+    k_f = k_f_s[5];
     dlnkfdT = fwd_beta[5] * invT + activation_units[5] * fwd_Ea[5] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[5] * exp(low_beta[5] * tc[0] - activation_units[5] * low_Ea[5] * invT);
@@ -34996,16 +35720,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[5] == 4 ? exp(-troe_Tss[5] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[5]) > 1.e-100 ? -Fcent1/troe_Tsss[5] : 0.)
+      + (fabs(troe_Ts[5]) > 1.e-100 ? -Fcent2/troe_Ts[5] : 0.)
+      + (troe_len[5] == 4 ? Fcent3*troe_Tss[5]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[5]) > 1.e-100 ? -Fcent1/troe_Tsss[5] : 0.)
-      + (fabs(troe_Ts[5]) > 1.e-100 ? -Fcent2/troe_Ts[5] : 0.)
-      + (troe_len[5] == 4 ? Fcent3*troe_Tss[5]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -35013,7 +35737,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[20];
-    Kc = refCinv * exp(g_RT[1] + g_RT[18] - g_RT[20]);
+    Kc = Kc_s[5];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[18]) + (h_RT[20]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35031,150 +35755,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[5][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[18] -= dqdci;               /* dwdot[CH2OH]/d[H2] */
-        J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[18];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[89] -= dqdci;               /* dwdot[CH2OH]/d[H] */
-        J[91] += dqdci;               /* dwdot[CH3OH]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[5][1] - 1)*dcdc_fac;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[373] -= dqdci;              /* dwdot[CH2OH]/d[H2O] */
-        J[375] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[5][2] - 1)*dcdc_fac;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[941] -= dqdci;              /* dwdot[CH2OH]/d[CH4] */
-        J[943] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[5][3] - 1)*dcdc_fac;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[1012] -= dqdci;             /* dwdot[CH2OH]/d[CO] */
-        J[1014] += dqdci;             /* dwdot[CH3OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[5][4] - 1)*dcdc_fac;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1083] -= dqdci;             /* dwdot[CH2OH]/d[CO2] */
-        J[1085] += dqdci;             /* dwdot[CH3OH]/d[CO2] */
-        /* d()/d[CH2OH] */
-        dqdci =  + k_f*sc[1];
-        J[1279] -= dqdci;             /* dwdot[H]/d[CH2OH] */
-        J[1296] -= dqdci;             /* dwdot[CH2OH]/d[CH2OH] */
-        J[1298] += dqdci;             /* dwdot[CH3OH]/d[CH2OH] */
-        /* d()/d[CH3OH] */
-        dqdci =  - k_r;
-        J[1421] -= dqdci;             /* dwdot[H]/d[CH3OH] */
-        J[1438] -= dqdci;             /* dwdot[CH2OH]/d[CH3OH] */
-        J[1440] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[5][6] - 1)*dcdc_fac;
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1722] -= dqdci;             /* dwdot[CH2OH]/d[C2H4] */
-        J[1724] += dqdci;             /* dwdot[CH3OH]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[5][5] - 1)*dcdc_fac;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1864] -= dqdci;             /* dwdot[CH2OH]/d[C2H6] */
-        J[1866] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[5][7] - 1)*dcdc_fac;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2503] -= dqdci;             /* dwdot[CH2OH]/d[pC3H4] */
-        J[2505] += dqdci;             /* dwdot[CH3OH]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[5][9] - 1)*dcdc_fac;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4420] -= dqdci;             /* dwdot[CH2OH]/d[C3H8] */
-        J[4422] += dqdci;             /* dwdot[CH3OH]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[5][8] - 1)*dcdc_fac;
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4633] -= dqdci;             /* dwdot[CH2OH]/d[C3H6] */
-        J[4635] += dqdci;             /* dwdot[CH3OH]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[5][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[18];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[5][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[5][2]*dcdc_fac;
-        dqdc[14] = TB[5][3]*dcdc_fac;
-        dqdc[15] = TB[5][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac + k_f*sc[1];
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac - k_r;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[5][6]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[5][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[5][7]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[5][9]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[5][8]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+18] -= dqdc[k];
-            J[71*k+20] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[18] -= dcdc_fac;
+    Jmix[20] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[5][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[18] -= dqdci;               /* dwdot[CH2OH]/d[H2] */
+    J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[18];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[89] -= dqdci;               /* dwdot[CH2OH]/d[H] */
+    J[91] += dqdci;               /* dwdot[CH3OH]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[5][1] - 1)*dcdc_fac;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[373] -= dqdci;              /* dwdot[CH2OH]/d[H2O] */
+    J[375] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[5][2] - 1)*dcdc_fac;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[941] -= dqdci;              /* dwdot[CH2OH]/d[CH4] */
+    J[943] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[5][3] - 1)*dcdc_fac;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[1012] -= dqdci;             /* dwdot[CH2OH]/d[CO] */
+    J[1014] += dqdci;             /* dwdot[CH3OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[5][4] - 1)*dcdc_fac;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1083] -= dqdci;             /* dwdot[CH2OH]/d[CO2] */
+    J[1085] += dqdci;             /* dwdot[CH3OH]/d[CO2] */
+    /* d()/d[CH2OH] */
+    dqdci =  + k_f*sc[1];
+    J[1279] -= dqdci;             /* dwdot[H]/d[CH2OH] */
+    J[1296] -= dqdci;             /* dwdot[CH2OH]/d[CH2OH] */
+    J[1298] += dqdci;             /* dwdot[CH3OH]/d[CH2OH] */
+    /* d()/d[CH3OH] */
+    dqdci =  - k_r;
+    J[1421] -= dqdci;             /* dwdot[H]/d[CH3OH] */
+    J[1438] -= dqdci;             /* dwdot[CH2OH]/d[CH3OH] */
+    J[1440] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[5][6] - 1)*dcdc_fac;
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1722] -= dqdci;             /* dwdot[CH2OH]/d[C2H4] */
+    J[1724] += dqdci;             /* dwdot[CH3OH]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[5][5] - 1)*dcdc_fac;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1864] -= dqdci;             /* dwdot[CH2OH]/d[C2H6] */
+    J[1866] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[5][7] - 1)*dcdc_fac;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2503] -= dqdci;             /* dwdot[CH2OH]/d[pC3H4] */
+    J[2505] += dqdci;             /* dwdot[CH3OH]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[5][9] - 1)*dcdc_fac;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4420] -= dqdci;             /* dwdot[CH2OH]/d[C3H8] */
+    J[4422] += dqdci;             /* dwdot[CH3OH]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[5][8] - 1)*dcdc_fac;
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4633] -= dqdci;             /* dwdot[CH2OH]/d[C3H6] */
+    J[4635] += dqdci;             /* dwdot[CH3OH]/d[C3H6] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[4988] -= dqdT; /* dwdot[CH2OH]/dT */
     J[4990] += dqdT; /* dwdot[CH3OH]/dT */
@@ -35183,11 +35832,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[6][0] - 1)*sc[0] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[13] + (TB[6][3] - 1)*sc[14] + (TB[6][4] - 1)*sc[15] + (TB[6][5] - 1)*sc[26] + (TB[6][6] - 1)*sc[24] + (TB[6][7] - 1)*sc[35] + (TB[6][8] - 1)*sc[65] + (TB[6][9] - 1)*sc[62];
+    alpha = (memcmp(TB[6], TB[3], 10*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[6][0] - 1)*sc[0] + (TB[6][1] - 1)*sc[5] + (TB[6][2] - 1)*sc[13] + (TB[6][3] - 1)*sc[14] + (TB[6][4] - 1)*sc[15] + (TB[6][5] - 1)*sc[26] + (TB[6][6] - 1)*sc[24] + (TB[6][7] - 1)*sc[35] + (TB[6][8] - 1)*sc[65] + (TB[6][9] - 1)*sc[62]);
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[6] * fwd_A[6]
-                * exp(fwd_beta[6] * tc[0] - activation_units[6] * fwd_Ea[6] * invT);
+    k_f = k_f_s[6];
     dlnkfdT = fwd_beta[6] * invT + activation_units[6] * fwd_Ea[6] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[6] * exp(low_beta[6] * tc[0] - activation_units[6] * low_Ea[6] * invT);
@@ -35203,16 +35851,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[6] == 4 ? exp(-troe_Tss[6] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[6]) > 1.e-100 ? -Fcent1/troe_Tsss[6] : 0.)
+      + (fabs(troe_Ts[6]) > 1.e-100 ? -Fcent2/troe_Ts[6] : 0.)
+      + (troe_len[6] == 4 ? Fcent3*troe_Tss[6]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[6]) > 1.e-100 ? -Fcent1/troe_Tsss[6] : 0.)
-      + (fabs(troe_Ts[6]) > 1.e-100 ? -Fcent2/troe_Ts[6] : 0.)
-      + (troe_len[6] == 4 ? Fcent3*troe_Tss[6]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -35220,7 +35868,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[20];
-    Kc = refCinv * exp(g_RT[1] + g_RT[19] - g_RT[20]);
+    Kc = Kc_s[6];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[20]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35238,150 +35886,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[6][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[19] -= dqdci;               /* dwdot[CH3O]/d[H2] */
-        J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[19];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[90] -= dqdci;               /* dwdot[CH3O]/d[H] */
-        J[91] += dqdci;               /* dwdot[CH3OH]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[6][1] - 1)*dcdc_fac;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[374] -= dqdci;              /* dwdot[CH3O]/d[H2O] */
-        J[375] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[6][2] - 1)*dcdc_fac;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[942] -= dqdci;              /* dwdot[CH3O]/d[CH4] */
-        J[943] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[6][3] - 1)*dcdc_fac;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[1013] -= dqdci;             /* dwdot[CH3O]/d[CO] */
-        J[1014] += dqdci;             /* dwdot[CH3OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[6][4] - 1)*dcdc_fac;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1084] -= dqdci;             /* dwdot[CH3O]/d[CO2] */
-        J[1085] += dqdci;             /* dwdot[CH3OH]/d[CO2] */
-        /* d()/d[CH3O] */
-        dqdci =  + k_f*sc[1];
-        J[1350] -= dqdci;             /* dwdot[H]/d[CH3O] */
-        J[1368] -= dqdci;             /* dwdot[CH3O]/d[CH3O] */
-        J[1369] += dqdci;             /* dwdot[CH3OH]/d[CH3O] */
-        /* d()/d[CH3OH] */
-        dqdci =  - k_r;
-        J[1421] -= dqdci;             /* dwdot[H]/d[CH3OH] */
-        J[1439] -= dqdci;             /* dwdot[CH3O]/d[CH3OH] */
-        J[1440] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[6][6] - 1)*dcdc_fac;
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1723] -= dqdci;             /* dwdot[CH3O]/d[C2H4] */
-        J[1724] += dqdci;             /* dwdot[CH3OH]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[6][5] - 1)*dcdc_fac;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1865] -= dqdci;             /* dwdot[CH3O]/d[C2H6] */
-        J[1866] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[6][7] - 1)*dcdc_fac;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2504] -= dqdci;             /* dwdot[CH3O]/d[pC3H4] */
-        J[2505] += dqdci;             /* dwdot[CH3OH]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[6][9] - 1)*dcdc_fac;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4421] -= dqdci;             /* dwdot[CH3O]/d[C3H8] */
-        J[4422] += dqdci;             /* dwdot[CH3OH]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[6][8] - 1)*dcdc_fac;
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4634] -= dqdci;             /* dwdot[CH3O]/d[C3H6] */
-        J[4635] += dqdci;             /* dwdot[CH3OH]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[6][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[19];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[6][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[6][2]*dcdc_fac;
-        dqdc[14] = TB[6][3]*dcdc_fac;
-        dqdc[15] = TB[6][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac + k_f*sc[1];
-        dqdc[20] = dcdc_fac - k_r;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[6][6]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[6][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[6][7]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[6][9]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[6][8]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+19] -= dqdc[k];
-            J[71*k+20] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[19] -= dcdc_fac;
+    Jmix[20] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[6][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[19] -= dqdci;               /* dwdot[CH3O]/d[H2] */
+    J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[19];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[90] -= dqdci;               /* dwdot[CH3O]/d[H] */
+    J[91] += dqdci;               /* dwdot[CH3OH]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[6][1] - 1)*dcdc_fac;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[374] -= dqdci;              /* dwdot[CH3O]/d[H2O] */
+    J[375] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[6][2] - 1)*dcdc_fac;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[942] -= dqdci;              /* dwdot[CH3O]/d[CH4] */
+    J[943] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[6][3] - 1)*dcdc_fac;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[1013] -= dqdci;             /* dwdot[CH3O]/d[CO] */
+    J[1014] += dqdci;             /* dwdot[CH3OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[6][4] - 1)*dcdc_fac;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1084] -= dqdci;             /* dwdot[CH3O]/d[CO2] */
+    J[1085] += dqdci;             /* dwdot[CH3OH]/d[CO2] */
+    /* d()/d[CH3O] */
+    dqdci =  + k_f*sc[1];
+    J[1350] -= dqdci;             /* dwdot[H]/d[CH3O] */
+    J[1368] -= dqdci;             /* dwdot[CH3O]/d[CH3O] */
+    J[1369] += dqdci;             /* dwdot[CH3OH]/d[CH3O] */
+    /* d()/d[CH3OH] */
+    dqdci =  - k_r;
+    J[1421] -= dqdci;             /* dwdot[H]/d[CH3OH] */
+    J[1439] -= dqdci;             /* dwdot[CH3O]/d[CH3OH] */
+    J[1440] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[6][6] - 1)*dcdc_fac;
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1723] -= dqdci;             /* dwdot[CH3O]/d[C2H4] */
+    J[1724] += dqdci;             /* dwdot[CH3OH]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[6][5] - 1)*dcdc_fac;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1865] -= dqdci;             /* dwdot[CH3O]/d[C2H6] */
+    J[1866] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[6][7] - 1)*dcdc_fac;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2504] -= dqdci;             /* dwdot[CH3O]/d[pC3H4] */
+    J[2505] += dqdci;             /* dwdot[CH3OH]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[6][9] - 1)*dcdc_fac;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4421] -= dqdci;             /* dwdot[CH3O]/d[C3H8] */
+    J[4422] += dqdci;             /* dwdot[CH3OH]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[6][8] - 1)*dcdc_fac;
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4634] -= dqdci;             /* dwdot[CH3O]/d[C3H6] */
+    J[4635] += dqdci;             /* dwdot[CH3OH]/d[C3H6] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[4989] -= dqdT; /* dwdot[CH3O]/dT */
     J[4990] += dqdT; /* dwdot[CH3OH]/dT */
@@ -35390,11 +35963,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[7][0] - 1)*sc[0] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[13] + (TB[7][3] - 1)*sc[14] + (TB[7][4] - 1)*sc[15] + (TB[7][5] - 1)*sc[26] + (TB[7][6] - 1)*sc[30] + (TB[7][7] - 1)*sc[24] + (TB[7][8] - 1)*sc[35] + (TB[7][9] - 1)*sc[65] + (TB[7][10] - 1)*sc[62];
+    alpha = (memcmp(TB[7], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[7][0] - 1)*sc[0] + (TB[7][1] - 1)*sc[5] + (TB[7][2] - 1)*sc[13] + (TB[7][3] - 1)*sc[14] + (TB[7][4] - 1)*sc[15] + (TB[7][5] - 1)*sc[26] + (TB[7][6] - 1)*sc[30] + (TB[7][7] - 1)*sc[24] + (TB[7][8] - 1)*sc[35] + (TB[7][9] - 1)*sc[65] + (TB[7][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[1]*sc[21];
-    k_f = prefactor_units[7] * fwd_A[7]
-                * exp(fwd_beta[7] * tc[0] - activation_units[7] * fwd_Ea[7] * invT);
+    k_f = k_f_s[7];
     dlnkfdT = fwd_beta[7] * invT + activation_units[7] * fwd_Ea[7] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[7] * exp(low_beta[7] * tc[0] - activation_units[7] * low_Ea[7] * invT);
@@ -35410,16 +35982,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[7] == 4 ? exp(-troe_Tss[7] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[7]) > 1.e-100 ? -Fcent1/troe_Tsss[7] : 0.)
+      + (fabs(troe_Ts[7]) > 1.e-100 ? -Fcent2/troe_Ts[7] : 0.)
+      + (troe_len[7] == 4 ? Fcent3*troe_Tss[7]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[7]) > 1.e-100 ? -Fcent1/troe_Tsss[7] : 0.)
-      + (fabs(troe_Ts[7]) > 1.e-100 ? -Fcent2/troe_Ts[7] : 0.)
-      + (troe_len[7] == 4 ? Fcent3*troe_Tss[7]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -35427,7 +35999,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[22];
-    Kc = refCinv * exp(g_RT[1] + g_RT[21] - g_RT[22]);
+    Kc = Kc_s[7];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[21]) + (h_RT[22]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35445,155 +36017,80 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[7][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[21] -= dqdci;               /* dwdot[C2H]/d[H2] */
-        J[22] += dqdci;               /* dwdot[C2H2]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[21];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[92] -= dqdci;               /* dwdot[C2H]/d[H] */
-        J[93] += dqdci;               /* dwdot[C2H2]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[7][1] - 1)*dcdc_fac;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[376] -= dqdci;              /* dwdot[C2H]/d[H2O] */
-        J[377] += dqdci;              /* dwdot[C2H2]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[7][2] - 1)*dcdc_fac;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[944] -= dqdci;              /* dwdot[C2H]/d[CH4] */
-        J[945] += dqdci;              /* dwdot[C2H2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[7][3] - 1)*dcdc_fac;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[1015] -= dqdci;             /* dwdot[C2H]/d[CO] */
-        J[1016] += dqdci;             /* dwdot[C2H2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[7][4] - 1)*dcdc_fac;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1086] -= dqdci;             /* dwdot[C2H]/d[CO2] */
-        J[1087] += dqdci;             /* dwdot[C2H2]/d[CO2] */
-        /* d()/d[C2H] */
-        dqdci =  + k_f*sc[1];
-        J[1492] -= dqdci;             /* dwdot[H]/d[C2H] */
-        J[1512] -= dqdci;             /* dwdot[C2H]/d[C2H] */
-        J[1513] += dqdci;             /* dwdot[C2H2]/d[C2H] */
-        /* d()/d[C2H2] */
-        dqdci =  - k_r;
-        J[1563] -= dqdci;             /* dwdot[H]/d[C2H2] */
-        J[1583] -= dqdci;             /* dwdot[C2H]/d[C2H2] */
-        J[1584] += dqdci;             /* dwdot[C2H2]/d[C2H2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[7][7] - 1)*dcdc_fac;
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1725] -= dqdci;             /* dwdot[C2H]/d[C2H4] */
-        J[1726] += dqdci;             /* dwdot[C2H2]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[7][5] - 1)*dcdc_fac;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1867] -= dqdci;             /* dwdot[C2H]/d[C2H6] */
-        J[1868] += dqdci;             /* dwdot[C2H2]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[7][6] - 1)*dcdc_fac;
-        J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2151] -= dqdci;             /* dwdot[C2H]/d[AR] */
-        J[2152] += dqdci;             /* dwdot[C2H2]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[7][8] - 1)*dcdc_fac;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2506] -= dqdci;             /* dwdot[C2H]/d[pC3H4] */
-        J[2507] += dqdci;             /* dwdot[C2H2]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[7][10] - 1)*dcdc_fac;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4423] -= dqdci;             /* dwdot[C2H]/d[C3H8] */
-        J[4424] += dqdci;             /* dwdot[C2H2]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[7][9] - 1)*dcdc_fac;
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4636] -= dqdci;             /* dwdot[C2H]/d[C3H6] */
-        J[4637] += dqdci;             /* dwdot[C2H2]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[7][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[21];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[7][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[7][2]*dcdc_fac;
-        dqdc[14] = TB[7][3]*dcdc_fac;
-        dqdc[15] = TB[7][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac + k_f*sc[1];
-        dqdc[22] = dcdc_fac - k_r;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[7][7]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[7][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[7][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[7][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[7][10]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[7][9]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+21] -= dqdc[k];
-            J[71*k+22] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[21] -= dcdc_fac;
+    Jmix[22] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[7][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[21] -= dqdci;               /* dwdot[C2H]/d[H2] */
+    J[22] += dqdci;               /* dwdot[C2H2]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[21];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[92] -= dqdci;               /* dwdot[C2H]/d[H] */
+    J[93] += dqdci;               /* dwdot[C2H2]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[7][1] - 1)*dcdc_fac;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[376] -= dqdci;              /* dwdot[C2H]/d[H2O] */
+    J[377] += dqdci;              /* dwdot[C2H2]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[7][2] - 1)*dcdc_fac;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[944] -= dqdci;              /* dwdot[C2H]/d[CH4] */
+    J[945] += dqdci;              /* dwdot[C2H2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[7][3] - 1)*dcdc_fac;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[1015] -= dqdci;             /* dwdot[C2H]/d[CO] */
+    J[1016] += dqdci;             /* dwdot[C2H2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[7][4] - 1)*dcdc_fac;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1086] -= dqdci;             /* dwdot[C2H]/d[CO2] */
+    J[1087] += dqdci;             /* dwdot[C2H2]/d[CO2] */
+    /* d()/d[C2H] */
+    dqdci =  + k_f*sc[1];
+    J[1492] -= dqdci;             /* dwdot[H]/d[C2H] */
+    J[1512] -= dqdci;             /* dwdot[C2H]/d[C2H] */
+    J[1513] += dqdci;             /* dwdot[C2H2]/d[C2H] */
+    /* d()/d[C2H2] */
+    dqdci =  - k_r;
+    J[1563] -= dqdci;             /* dwdot[H]/d[C2H2] */
+    J[1583] -= dqdci;             /* dwdot[C2H]/d[C2H2] */
+    J[1584] += dqdci;             /* dwdot[C2H2]/d[C2H2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[7][7] - 1)*dcdc_fac;
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1725] -= dqdci;             /* dwdot[C2H]/d[C2H4] */
+    J[1726] += dqdci;             /* dwdot[C2H2]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[7][5] - 1)*dcdc_fac;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1867] -= dqdci;             /* dwdot[C2H]/d[C2H6] */
+    J[1868] += dqdci;             /* dwdot[C2H2]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[7][6] - 1)*dcdc_fac;
+    J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2151] -= dqdci;             /* dwdot[C2H]/d[AR] */
+    J[2152] += dqdci;             /* dwdot[C2H2]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[7][8] - 1)*dcdc_fac;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2506] -= dqdci;             /* dwdot[C2H]/d[pC3H4] */
+    J[2507] += dqdci;             /* dwdot[C2H2]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[7][10] - 1)*dcdc_fac;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4423] -= dqdci;             /* dwdot[C2H]/d[C3H8] */
+    J[4424] += dqdci;             /* dwdot[C2H2]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[7][9] - 1)*dcdc_fac;
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4636] -= dqdci;             /* dwdot[C2H]/d[C3H6] */
+    J[4637] += dqdci;             /* dwdot[C2H2]/d[C3H6] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[4991] -= dqdT; /* dwdot[C2H]/dT */
     J[4992] += dqdT; /* dwdot[C2H2]/dT */
@@ -35602,11 +36099,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[8][0] - 1)*sc[0] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[13] + (TB[8][3] - 1)*sc[14] + (TB[8][4] - 1)*sc[15] + (TB[8][5] - 1)*sc[26] + (TB[8][6] - 1)*sc[30] + (TB[8][7] - 1)*sc[24] + (TB[8][8] - 1)*sc[35] + (TB[8][9] - 1)*sc[65] + (TB[8][10] - 1)*sc[62];
+    alpha = (memcmp(TB[8], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[8][0] - 1)*sc[0] + (TB[8][1] - 1)*sc[5] + (TB[8][2] - 1)*sc[13] + (TB[8][3] - 1)*sc[14] + (TB[8][4] - 1)*sc[15] + (TB[8][5] - 1)*sc[26] + (TB[8][6] - 1)*sc[30] + (TB[8][7] - 1)*sc[24] + (TB[8][8] - 1)*sc[35] + (TB[8][9] - 1)*sc[65] + (TB[8][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[1]*sc[22];
-    k_f = prefactor_units[8] * fwd_A[8]
-                * exp(fwd_beta[8] * tc[0] - activation_units[8] * fwd_Ea[8] * invT);
+    k_f = k_f_s[8];
     dlnkfdT = fwd_beta[8] * invT + activation_units[8] * fwd_Ea[8] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[8] * exp(low_beta[8] * tc[0] - activation_units[8] * low_Ea[8] * invT);
@@ -35622,16 +36118,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[8] == 4 ? exp(-troe_Tss[8] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[8]) > 1.e-100 ? -Fcent1/troe_Tsss[8] : 0.)
+      + (fabs(troe_Ts[8]) > 1.e-100 ? -Fcent2/troe_Ts[8] : 0.)
+      + (troe_len[8] == 4 ? Fcent3*troe_Tss[8]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[8]) > 1.e-100 ? -Fcent1/troe_Tsss[8] : 0.)
-      + (fabs(troe_Ts[8]) > 1.e-100 ? -Fcent2/troe_Ts[8] : 0.)
-      + (troe_len[8] == 4 ? Fcent3*troe_Tss[8]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -35639,7 +36135,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[23];
-    Kc = refCinv * exp(g_RT[1] + g_RT[22] - g_RT[23]);
+    Kc = Kc_s[8];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[22]) + (h_RT[23]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35657,155 +36153,80 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[8][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[22] -= dqdci;               /* dwdot[C2H2]/d[H2] */
-        J[23] += dqdci;               /* dwdot[C2H3]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[22];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[93] -= dqdci;               /* dwdot[C2H2]/d[H] */
-        J[94] += dqdci;               /* dwdot[C2H3]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[8][1] - 1)*dcdc_fac;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[377] -= dqdci;              /* dwdot[C2H2]/d[H2O] */
-        J[378] += dqdci;              /* dwdot[C2H3]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[8][2] - 1)*dcdc_fac;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[945] -= dqdci;              /* dwdot[C2H2]/d[CH4] */
-        J[946] += dqdci;              /* dwdot[C2H3]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[8][3] - 1)*dcdc_fac;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[1016] -= dqdci;             /* dwdot[C2H2]/d[CO] */
-        J[1017] += dqdci;             /* dwdot[C2H3]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[8][4] - 1)*dcdc_fac;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1087] -= dqdci;             /* dwdot[C2H2]/d[CO2] */
-        J[1088] += dqdci;             /* dwdot[C2H3]/d[CO2] */
-        /* d()/d[C2H2] */
-        dqdci =  + k_f*sc[1];
-        J[1563] -= dqdci;             /* dwdot[H]/d[C2H2] */
-        J[1584] -= dqdci;             /* dwdot[C2H2]/d[C2H2] */
-        J[1585] += dqdci;             /* dwdot[C2H3]/d[C2H2] */
-        /* d()/d[C2H3] */
-        dqdci =  - k_r;
-        J[1634] -= dqdci;             /* dwdot[H]/d[C2H3] */
-        J[1655] -= dqdci;             /* dwdot[C2H2]/d[C2H3] */
-        J[1656] += dqdci;             /* dwdot[C2H3]/d[C2H3] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[8][7] - 1)*dcdc_fac;
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1726] -= dqdci;             /* dwdot[C2H2]/d[C2H4] */
-        J[1727] += dqdci;             /* dwdot[C2H3]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[8][5] - 1)*dcdc_fac;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1868] -= dqdci;             /* dwdot[C2H2]/d[C2H6] */
-        J[1869] += dqdci;             /* dwdot[C2H3]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[8][6] - 1)*dcdc_fac;
-        J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2152] -= dqdci;             /* dwdot[C2H2]/d[AR] */
-        J[2153] += dqdci;             /* dwdot[C2H3]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[8][8] - 1)*dcdc_fac;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2507] -= dqdci;             /* dwdot[C2H2]/d[pC3H4] */
-        J[2508] += dqdci;             /* dwdot[C2H3]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[8][10] - 1)*dcdc_fac;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4424] -= dqdci;             /* dwdot[C2H2]/d[C3H8] */
-        J[4425] += dqdci;             /* dwdot[C2H3]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[8][9] - 1)*dcdc_fac;
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4637] -= dqdci;             /* dwdot[C2H2]/d[C3H6] */
-        J[4638] += dqdci;             /* dwdot[C2H3]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[8][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[22];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[8][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[8][2]*dcdc_fac;
-        dqdc[14] = TB[8][3]*dcdc_fac;
-        dqdc[15] = TB[8][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac + k_f*sc[1];
-        dqdc[23] = dcdc_fac - k_r;
-        dqdc[24] = TB[8][7]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[8][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[8][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[8][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[8][10]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[8][9]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+22] -= dqdc[k];
-            J[71*k+23] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[22] -= dcdc_fac;
+    Jmix[23] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[8][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[22] -= dqdci;               /* dwdot[C2H2]/d[H2] */
+    J[23] += dqdci;               /* dwdot[C2H3]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[22];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[93] -= dqdci;               /* dwdot[C2H2]/d[H] */
+    J[94] += dqdci;               /* dwdot[C2H3]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[8][1] - 1)*dcdc_fac;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[377] -= dqdci;              /* dwdot[C2H2]/d[H2O] */
+    J[378] += dqdci;              /* dwdot[C2H3]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[8][2] - 1)*dcdc_fac;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[945] -= dqdci;              /* dwdot[C2H2]/d[CH4] */
+    J[946] += dqdci;              /* dwdot[C2H3]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[8][3] - 1)*dcdc_fac;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[1016] -= dqdci;             /* dwdot[C2H2]/d[CO] */
+    J[1017] += dqdci;             /* dwdot[C2H3]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[8][4] - 1)*dcdc_fac;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1087] -= dqdci;             /* dwdot[C2H2]/d[CO2] */
+    J[1088] += dqdci;             /* dwdot[C2H3]/d[CO2] */
+    /* d()/d[C2H2] */
+    dqdci =  + k_f*sc[1];
+    J[1563] -= dqdci;             /* dwdot[H]/d[C2H2] */
+    J[1584] -= dqdci;             /* dwdot[C2H2]/d[C2H2] */
+    J[1585] += dqdci;             /* dwdot[C2H3]/d[C2H2] */
+    /* d()/d[C2H3] */
+    dqdci =  - k_r;
+    J[1634] -= dqdci;             /* dwdot[H]/d[C2H3] */
+    J[1655] -= dqdci;             /* dwdot[C2H2]/d[C2H3] */
+    J[1656] += dqdci;             /* dwdot[C2H3]/d[C2H3] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[8][7] - 1)*dcdc_fac;
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1726] -= dqdci;             /* dwdot[C2H2]/d[C2H4] */
+    J[1727] += dqdci;             /* dwdot[C2H3]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[8][5] - 1)*dcdc_fac;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1868] -= dqdci;             /* dwdot[C2H2]/d[C2H6] */
+    J[1869] += dqdci;             /* dwdot[C2H3]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[8][6] - 1)*dcdc_fac;
+    J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2152] -= dqdci;             /* dwdot[C2H2]/d[AR] */
+    J[2153] += dqdci;             /* dwdot[C2H3]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[8][8] - 1)*dcdc_fac;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2507] -= dqdci;             /* dwdot[C2H2]/d[pC3H4] */
+    J[2508] += dqdci;             /* dwdot[C2H3]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[8][10] - 1)*dcdc_fac;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4424] -= dqdci;             /* dwdot[C2H2]/d[C3H8] */
+    J[4425] += dqdci;             /* dwdot[C2H3]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[8][9] - 1)*dcdc_fac;
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4637] -= dqdci;             /* dwdot[C2H2]/d[C3H6] */
+    J[4638] += dqdci;             /* dwdot[C2H3]/d[C3H6] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[4992] -= dqdT; /* dwdot[C2H2]/dT */
     J[4993] += dqdT; /* dwdot[C2H3]/dT */
@@ -35814,11 +36235,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[9][0] - 1)*sc[0] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[13] + (TB[9][3] - 1)*sc[14] + (TB[9][4] - 1)*sc[15] + (TB[9][5] - 1)*sc[26] + (TB[9][6] - 1)*sc[30] + (TB[9][7] - 1)*sc[24] + (TB[9][8] - 1)*sc[35] + (TB[9][9] - 1)*sc[65] + (TB[9][10] - 1)*sc[62];
+    alpha = (memcmp(TB[9], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[9][0] - 1)*sc[0] + (TB[9][1] - 1)*sc[5] + (TB[9][2] - 1)*sc[13] + (TB[9][3] - 1)*sc[14] + (TB[9][4] - 1)*sc[15] + (TB[9][5] - 1)*sc[26] + (TB[9][6] - 1)*sc[30] + (TB[9][7] - 1)*sc[24] + (TB[9][8] - 1)*sc[35] + (TB[9][9] - 1)*sc[65] + (TB[9][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[1]*sc[23];
-    k_f = prefactor_units[9] * fwd_A[9]
-                * exp(fwd_beta[9] * tc[0] - activation_units[9] * fwd_Ea[9] * invT);
+    k_f = k_f_s[9];
     dlnkfdT = fwd_beta[9] * invT + activation_units[9] * fwd_Ea[9] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[9] * exp(low_beta[9] * tc[0] - activation_units[9] * low_Ea[9] * invT);
@@ -35834,16 +36254,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[9] == 4 ? exp(-troe_Tss[9] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[9]) > 1.e-100 ? -Fcent1/troe_Tsss[9] : 0.)
+      + (fabs(troe_Ts[9]) > 1.e-100 ? -Fcent2/troe_Ts[9] : 0.)
+      + (troe_len[9] == 4 ? Fcent3*troe_Tss[9]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[9]) > 1.e-100 ? -Fcent1/troe_Tsss[9] : 0.)
-      + (fabs(troe_Ts[9]) > 1.e-100 ? -Fcent2/troe_Ts[9] : 0.)
-      + (troe_len[9] == 4 ? Fcent3*troe_Tss[9]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -35851,7 +36271,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[24];
-    Kc = refCinv * exp(g_RT[1] + g_RT[23] - g_RT[24]);
+    Kc = Kc_s[9];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[23]) + (h_RT[24]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -35869,150 +36289,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[9][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[23] -= dqdci;               /* dwdot[C2H3]/d[H2] */
-        J[24] += dqdci;               /* dwdot[C2H4]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[23];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[94] -= dqdci;               /* dwdot[C2H3]/d[H] */
-        J[95] += dqdci;               /* dwdot[C2H4]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[9][1] - 1)*dcdc_fac;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[378] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
-        J[379] += dqdci;              /* dwdot[C2H4]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[9][2] - 1)*dcdc_fac;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[946] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
-        J[947] += dqdci;              /* dwdot[C2H4]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[9][3] - 1)*dcdc_fac;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[1017] -= dqdci;             /* dwdot[C2H3]/d[CO] */
-        J[1018] += dqdci;             /* dwdot[C2H4]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[9][4] - 1)*dcdc_fac;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1088] -= dqdci;             /* dwdot[C2H3]/d[CO2] */
-        J[1089] += dqdci;             /* dwdot[C2H4]/d[CO2] */
-        /* d()/d[C2H3] */
-        dqdci =  + k_f*sc[1];
-        J[1634] -= dqdci;             /* dwdot[H]/d[C2H3] */
-        J[1656] -= dqdci;             /* dwdot[C2H3]/d[C2H3] */
-        J[1657] += dqdci;             /* dwdot[C2H4]/d[C2H3] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[9][7] - 1)*dcdc_fac - k_r;
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1727] -= dqdci;             /* dwdot[C2H3]/d[C2H4] */
-        J[1728] += dqdci;             /* dwdot[C2H4]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[9][5] - 1)*dcdc_fac;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1869] -= dqdci;             /* dwdot[C2H3]/d[C2H6] */
-        J[1870] += dqdci;             /* dwdot[C2H4]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[9][6] - 1)*dcdc_fac;
-        J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2153] -= dqdci;             /* dwdot[C2H3]/d[AR] */
-        J[2154] += dqdci;             /* dwdot[C2H4]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[9][8] - 1)*dcdc_fac;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2508] -= dqdci;             /* dwdot[C2H3]/d[pC3H4] */
-        J[2509] += dqdci;             /* dwdot[C2H4]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[9][10] - 1)*dcdc_fac;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4425] -= dqdci;             /* dwdot[C2H3]/d[C3H8] */
-        J[4426] += dqdci;             /* dwdot[C2H4]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[9][9] - 1)*dcdc_fac;
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4638] -= dqdci;             /* dwdot[C2H3]/d[C3H6] */
-        J[4639] += dqdci;             /* dwdot[C2H4]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[9][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[23];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[9][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[9][2]*dcdc_fac;
-        dqdc[14] = TB[9][3]*dcdc_fac;
-        dqdc[15] = TB[9][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac + k_f*sc[1];
-        dqdc[24] = TB[9][7]*dcdc_fac - k_r;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[9][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[9][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[9][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[9][10]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[9][9]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+23] -= dqdc[k];
-            J[71*k+24] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[23] -= dcdc_fac;
+    Jmix[24] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[9][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[23] -= dqdci;               /* dwdot[C2H3]/d[H2] */
+    J[24] += dqdci;               /* dwdot[C2H4]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[23];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[94] -= dqdci;               /* dwdot[C2H3]/d[H] */
+    J[95] += dqdci;               /* dwdot[C2H4]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[9][1] - 1)*dcdc_fac;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[378] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
+    J[379] += dqdci;              /* dwdot[C2H4]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[9][2] - 1)*dcdc_fac;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[946] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
+    J[947] += dqdci;              /* dwdot[C2H4]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[9][3] - 1)*dcdc_fac;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[1017] -= dqdci;             /* dwdot[C2H3]/d[CO] */
+    J[1018] += dqdci;             /* dwdot[C2H4]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[9][4] - 1)*dcdc_fac;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1088] -= dqdci;             /* dwdot[C2H3]/d[CO2] */
+    J[1089] += dqdci;             /* dwdot[C2H4]/d[CO2] */
+    /* d()/d[C2H3] */
+    dqdci =  + k_f*sc[1];
+    J[1634] -= dqdci;             /* dwdot[H]/d[C2H3] */
+    J[1656] -= dqdci;             /* dwdot[C2H3]/d[C2H3] */
+    J[1657] += dqdci;             /* dwdot[C2H4]/d[C2H3] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[9][7] - 1)*dcdc_fac - k_r;
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1727] -= dqdci;             /* dwdot[C2H3]/d[C2H4] */
+    J[1728] += dqdci;             /* dwdot[C2H4]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[9][5] - 1)*dcdc_fac;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1869] -= dqdci;             /* dwdot[C2H3]/d[C2H6] */
+    J[1870] += dqdci;             /* dwdot[C2H4]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[9][6] - 1)*dcdc_fac;
+    J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2153] -= dqdci;             /* dwdot[C2H3]/d[AR] */
+    J[2154] += dqdci;             /* dwdot[C2H4]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[9][8] - 1)*dcdc_fac;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2508] -= dqdci;             /* dwdot[C2H3]/d[pC3H4] */
+    J[2509] += dqdci;             /* dwdot[C2H4]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[9][10] - 1)*dcdc_fac;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4425] -= dqdci;             /* dwdot[C2H3]/d[C3H8] */
+    J[4426] += dqdci;             /* dwdot[C2H4]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[9][9] - 1)*dcdc_fac;
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4638] -= dqdci;             /* dwdot[C2H3]/d[C3H6] */
+    J[4639] += dqdci;             /* dwdot[C2H4]/d[C3H6] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[4993] -= dqdT; /* dwdot[C2H3]/dT */
     J[4994] += dqdT; /* dwdot[C2H4]/dT */
@@ -36021,11 +36366,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[10][0] - 1)*sc[0] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[13] + (TB[10][3] - 1)*sc[14] + (TB[10][4] - 1)*sc[15] + (TB[10][5] - 1)*sc[26] + (TB[10][6] - 1)*sc[30] + (TB[10][7] - 1)*sc[24] + (TB[10][8] - 1)*sc[35] + (TB[10][9] - 1)*sc[65] + (TB[10][10] - 1)*sc[62];
+    alpha = (memcmp(TB[10], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[10][0] - 1)*sc[0] + (TB[10][1] - 1)*sc[5] + (TB[10][2] - 1)*sc[13] + (TB[10][3] - 1)*sc[14] + (TB[10][4] - 1)*sc[15] + (TB[10][5] - 1)*sc[26] + (TB[10][6] - 1)*sc[30] + (TB[10][7] - 1)*sc[24] + (TB[10][8] - 1)*sc[35] + (TB[10][9] - 1)*sc[65] + (TB[10][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[1]*sc[24];
-    k_f = prefactor_units[10] * fwd_A[10]
-                * exp(fwd_beta[10] * tc[0] - activation_units[10] * fwd_Ea[10] * invT);
+    k_f = k_f_s[10];
     dlnkfdT = fwd_beta[10] * invT + activation_units[10] * fwd_Ea[10] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[10] * exp(low_beta[10] * tc[0] - activation_units[10] * low_Ea[10] * invT);
@@ -36041,16 +36385,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[10] == 4 ? exp(-troe_Tss[10] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[10]) > 1.e-100 ? -Fcent1/troe_Tsss[10] : 0.)
+      + (fabs(troe_Ts[10]) > 1.e-100 ? -Fcent2/troe_Ts[10] : 0.)
+      + (troe_len[10] == 4 ? Fcent3*troe_Tss[10]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[10]) > 1.e-100 ? -Fcent1/troe_Tsss[10] : 0.)
-      + (fabs(troe_Ts[10]) > 1.e-100 ? -Fcent2/troe_Ts[10] : 0.)
-      + (troe_len[10] == 4 ? Fcent3*troe_Tss[10]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -36058,7 +36402,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[25];
-    Kc = refCinv * exp(g_RT[1] + g_RT[24] - g_RT[25]);
+    Kc = Kc_s[10];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[24]) + (h_RT[25]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36076,150 +36420,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[10][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[24] -= dqdci;               /* dwdot[C2H4]/d[H2] */
-        J[25] += dqdci;               /* dwdot[C2H5]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[24];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[95] -= dqdci;               /* dwdot[C2H4]/d[H] */
-        J[96] += dqdci;               /* dwdot[C2H5]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[10][1] - 1)*dcdc_fac;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[379] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
-        J[380] += dqdci;              /* dwdot[C2H5]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[10][2] - 1)*dcdc_fac;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[947] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
-        J[948] += dqdci;              /* dwdot[C2H5]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[10][3] - 1)*dcdc_fac;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[1018] -= dqdci;             /* dwdot[C2H4]/d[CO] */
-        J[1019] += dqdci;             /* dwdot[C2H5]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[10][4] - 1)*dcdc_fac;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1089] -= dqdci;             /* dwdot[C2H4]/d[CO2] */
-        J[1090] += dqdci;             /* dwdot[C2H5]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[10][7] - 1)*dcdc_fac + k_f*sc[1];
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1728] -= dqdci;             /* dwdot[C2H4]/d[C2H4] */
-        J[1729] += dqdci;             /* dwdot[C2H5]/d[C2H4] */
-        /* d()/d[C2H5] */
-        dqdci =  - k_r;
-        J[1776] -= dqdci;             /* dwdot[H]/d[C2H5] */
-        J[1799] -= dqdci;             /* dwdot[C2H4]/d[C2H5] */
-        J[1800] += dqdci;             /* dwdot[C2H5]/d[C2H5] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[10][5] - 1)*dcdc_fac;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1870] -= dqdci;             /* dwdot[C2H4]/d[C2H6] */
-        J[1871] += dqdci;             /* dwdot[C2H5]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[10][6] - 1)*dcdc_fac;
-        J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2154] -= dqdci;             /* dwdot[C2H4]/d[AR] */
-        J[2155] += dqdci;             /* dwdot[C2H5]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[10][8] - 1)*dcdc_fac;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2509] -= dqdci;             /* dwdot[C2H4]/d[pC3H4] */
-        J[2510] += dqdci;             /* dwdot[C2H5]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[10][10] - 1)*dcdc_fac;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4426] -= dqdci;             /* dwdot[C2H4]/d[C3H8] */
-        J[4427] += dqdci;             /* dwdot[C2H5]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[10][9] - 1)*dcdc_fac;
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4639] -= dqdci;             /* dwdot[C2H4]/d[C3H6] */
-        J[4640] += dqdci;             /* dwdot[C2H5]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[10][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[24];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[10][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[10][2]*dcdc_fac;
-        dqdc[14] = TB[10][3]*dcdc_fac;
-        dqdc[15] = TB[10][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[10][7]*dcdc_fac + k_f*sc[1];
-        dqdc[25] = dcdc_fac - k_r;
-        dqdc[26] = TB[10][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[10][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[10][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[10][10]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[10][9]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+24] -= dqdc[k];
-            J[71*k+25] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[24] -= dcdc_fac;
+    Jmix[25] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[10][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[24] -= dqdci;               /* dwdot[C2H4]/d[H2] */
+    J[25] += dqdci;               /* dwdot[C2H5]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[24];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[95] -= dqdci;               /* dwdot[C2H4]/d[H] */
+    J[96] += dqdci;               /* dwdot[C2H5]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[10][1] - 1)*dcdc_fac;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[379] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
+    J[380] += dqdci;              /* dwdot[C2H5]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[10][2] - 1)*dcdc_fac;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[947] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
+    J[948] += dqdci;              /* dwdot[C2H5]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[10][3] - 1)*dcdc_fac;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[1018] -= dqdci;             /* dwdot[C2H4]/d[CO] */
+    J[1019] += dqdci;             /* dwdot[C2H5]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[10][4] - 1)*dcdc_fac;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1089] -= dqdci;             /* dwdot[C2H4]/d[CO2] */
+    J[1090] += dqdci;             /* dwdot[C2H5]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[10][7] - 1)*dcdc_fac + k_f*sc[1];
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1728] -= dqdci;             /* dwdot[C2H4]/d[C2H4] */
+    J[1729] += dqdci;             /* dwdot[C2H5]/d[C2H4] */
+    /* d()/d[C2H5] */
+    dqdci =  - k_r;
+    J[1776] -= dqdci;             /* dwdot[H]/d[C2H5] */
+    J[1799] -= dqdci;             /* dwdot[C2H4]/d[C2H5] */
+    J[1800] += dqdci;             /* dwdot[C2H5]/d[C2H5] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[10][5] - 1)*dcdc_fac;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1870] -= dqdci;             /* dwdot[C2H4]/d[C2H6] */
+    J[1871] += dqdci;             /* dwdot[C2H5]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[10][6] - 1)*dcdc_fac;
+    J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2154] -= dqdci;             /* dwdot[C2H4]/d[AR] */
+    J[2155] += dqdci;             /* dwdot[C2H5]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[10][8] - 1)*dcdc_fac;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2509] -= dqdci;             /* dwdot[C2H4]/d[pC3H4] */
+    J[2510] += dqdci;             /* dwdot[C2H5]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[10][10] - 1)*dcdc_fac;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4426] -= dqdci;             /* dwdot[C2H4]/d[C3H8] */
+    J[4427] += dqdci;             /* dwdot[C2H5]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[10][9] - 1)*dcdc_fac;
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4639] -= dqdci;             /* dwdot[C2H4]/d[C3H6] */
+    J[4640] += dqdci;             /* dwdot[C2H5]/d[C3H6] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[4994] -= dqdT; /* dwdot[C2H4]/dT */
     J[4995] += dqdT; /* dwdot[C2H5]/dT */
@@ -36228,11 +36497,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[11][0] - 1)*sc[0] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[13] + (TB[11][3] - 1)*sc[14] + (TB[11][4] - 1)*sc[15] + (TB[11][5] - 1)*sc[26] + (TB[11][6] - 1)*sc[30] + (TB[11][7] - 1)*sc[24] + (TB[11][8] - 1)*sc[35] + (TB[11][9] - 1)*sc[65] + (TB[11][10] - 1)*sc[62];
+    alpha = (memcmp(TB[11], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[11][0] - 1)*sc[0] + (TB[11][1] - 1)*sc[5] + (TB[11][2] - 1)*sc[13] + (TB[11][3] - 1)*sc[14] + (TB[11][4] - 1)*sc[15] + (TB[11][5] - 1)*sc[26] + (TB[11][6] - 1)*sc[30] + (TB[11][7] - 1)*sc[24] + (TB[11][8] - 1)*sc[35] + (TB[11][9] - 1)*sc[65] + (TB[11][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[1]*sc[25];
-    k_f = prefactor_units[11] * fwd_A[11]
-                * exp(fwd_beta[11] * tc[0] - activation_units[11] * fwd_Ea[11] * invT);
+    k_f = k_f_s[11];
     dlnkfdT = fwd_beta[11] * invT + activation_units[11] * fwd_Ea[11] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[11] * exp(low_beta[11] * tc[0] - activation_units[11] * low_Ea[11] * invT);
@@ -36248,16 +36516,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[11] == 4 ? exp(-troe_Tss[11] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[11]) > 1.e-100 ? -Fcent1/troe_Tsss[11] : 0.)
+      + (fabs(troe_Ts[11]) > 1.e-100 ? -Fcent2/troe_Ts[11] : 0.)
+      + (troe_len[11] == 4 ? Fcent3*troe_Tss[11]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[11]) > 1.e-100 ? -Fcent1/troe_Tsss[11] : 0.)
-      + (fabs(troe_Ts[11]) > 1.e-100 ? -Fcent2/troe_Ts[11] : 0.)
-      + (troe_len[11] == 4 ? Fcent3*troe_Tss[11]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -36265,7 +36533,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[26];
-    Kc = refCinv * exp(g_RT[1] + g_RT[25] - g_RT[26]);
+    Kc = Kc_s[11];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[25]) + (h_RT[26]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36283,150 +36551,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[11][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[25] -= dqdci;               /* dwdot[C2H5]/d[H2] */
-        J[26] += dqdci;               /* dwdot[C2H6]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[25];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[96] -= dqdci;               /* dwdot[C2H5]/d[H] */
-        J[97] += dqdci;               /* dwdot[C2H6]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[11][1] - 1)*dcdc_fac;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[380] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
-        J[381] += dqdci;              /* dwdot[C2H6]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[11][2] - 1)*dcdc_fac;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[948] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
-        J[949] += dqdci;              /* dwdot[C2H6]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[11][3] - 1)*dcdc_fac;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[1019] -= dqdci;             /* dwdot[C2H5]/d[CO] */
-        J[1020] += dqdci;             /* dwdot[C2H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[11][4] - 1)*dcdc_fac;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1090] -= dqdci;             /* dwdot[C2H5]/d[CO2] */
-        J[1091] += dqdci;             /* dwdot[C2H6]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[11][7] - 1)*dcdc_fac;
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1729] -= dqdci;             /* dwdot[C2H5]/d[C2H4] */
-        J[1730] += dqdci;             /* dwdot[C2H6]/d[C2H4] */
-        /* d()/d[C2H5] */
-        dqdci =  + k_f*sc[1];
-        J[1776] -= dqdci;             /* dwdot[H]/d[C2H5] */
-        J[1800] -= dqdci;             /* dwdot[C2H5]/d[C2H5] */
-        J[1801] += dqdci;             /* dwdot[C2H6]/d[C2H5] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[11][5] - 1)*dcdc_fac - k_r;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1871] -= dqdci;             /* dwdot[C2H5]/d[C2H6] */
-        J[1872] += dqdci;             /* dwdot[C2H6]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[11][6] - 1)*dcdc_fac;
-        J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2155] -= dqdci;             /* dwdot[C2H5]/d[AR] */
-        J[2156] += dqdci;             /* dwdot[C2H6]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[11][8] - 1)*dcdc_fac;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2510] -= dqdci;             /* dwdot[C2H5]/d[pC3H4] */
-        J[2511] += dqdci;             /* dwdot[C2H6]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[11][10] - 1)*dcdc_fac;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4427] -= dqdci;             /* dwdot[C2H5]/d[C3H8] */
-        J[4428] += dqdci;             /* dwdot[C2H6]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[11][9] - 1)*dcdc_fac;
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4640] -= dqdci;             /* dwdot[C2H5]/d[C3H6] */
-        J[4641] += dqdci;             /* dwdot[C2H6]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[11][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[25];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[11][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[11][2]*dcdc_fac;
-        dqdc[14] = TB[11][3]*dcdc_fac;
-        dqdc[15] = TB[11][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[11][7]*dcdc_fac;
-        dqdc[25] = dcdc_fac + k_f*sc[1];
-        dqdc[26] = TB[11][5]*dcdc_fac - k_r;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[11][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[11][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[11][10]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[11][9]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+25] -= dqdc[k];
-            J[71*k+26] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[25] -= dcdc_fac;
+    Jmix[26] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[11][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[25] -= dqdci;               /* dwdot[C2H5]/d[H2] */
+    J[26] += dqdci;               /* dwdot[C2H6]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[25];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[96] -= dqdci;               /* dwdot[C2H5]/d[H] */
+    J[97] += dqdci;               /* dwdot[C2H6]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[11][1] - 1)*dcdc_fac;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[380] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
+    J[381] += dqdci;              /* dwdot[C2H6]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[11][2] - 1)*dcdc_fac;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[948] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
+    J[949] += dqdci;              /* dwdot[C2H6]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[11][3] - 1)*dcdc_fac;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[1019] -= dqdci;             /* dwdot[C2H5]/d[CO] */
+    J[1020] += dqdci;             /* dwdot[C2H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[11][4] - 1)*dcdc_fac;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1090] -= dqdci;             /* dwdot[C2H5]/d[CO2] */
+    J[1091] += dqdci;             /* dwdot[C2H6]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[11][7] - 1)*dcdc_fac;
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1729] -= dqdci;             /* dwdot[C2H5]/d[C2H4] */
+    J[1730] += dqdci;             /* dwdot[C2H6]/d[C2H4] */
+    /* d()/d[C2H5] */
+    dqdci =  + k_f*sc[1];
+    J[1776] -= dqdci;             /* dwdot[H]/d[C2H5] */
+    J[1800] -= dqdci;             /* dwdot[C2H5]/d[C2H5] */
+    J[1801] += dqdci;             /* dwdot[C2H6]/d[C2H5] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[11][5] - 1)*dcdc_fac - k_r;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1871] -= dqdci;             /* dwdot[C2H5]/d[C2H6] */
+    J[1872] += dqdci;             /* dwdot[C2H6]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[11][6] - 1)*dcdc_fac;
+    J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2155] -= dqdci;             /* dwdot[C2H5]/d[AR] */
+    J[2156] += dqdci;             /* dwdot[C2H6]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[11][8] - 1)*dcdc_fac;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2510] -= dqdci;             /* dwdot[C2H5]/d[pC3H4] */
+    J[2511] += dqdci;             /* dwdot[C2H6]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[11][10] - 1)*dcdc_fac;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4427] -= dqdci;             /* dwdot[C2H5]/d[C3H8] */
+    J[4428] += dqdci;             /* dwdot[C2H6]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[11][9] - 1)*dcdc_fac;
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4640] -= dqdci;             /* dwdot[C2H5]/d[C3H6] */
+    J[4641] += dqdci;             /* dwdot[C2H6]/d[C3H6] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[4995] -= dqdT; /* dwdot[C2H5]/dT */
     J[4996] += dqdT; /* dwdot[C2H6]/dT */
@@ -36435,11 +36628,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[12][0] - 1)*sc[0] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[13] + (TB[12][3] - 1)*sc[14] + (TB[12][4] - 1)*sc[15] + (TB[12][5] - 1)*sc[26] + (TB[12][6] - 1)*sc[30] + (TB[12][7] - 1)*sc[24] + (TB[12][8] - 1)*sc[35] + (TB[12][9] - 1)*sc[65] + (TB[12][10] - 1)*sc[62];
+    alpha = (memcmp(TB[12], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[12][0] - 1)*sc[0] + (TB[12][1] - 1)*sc[5] + (TB[12][2] - 1)*sc[13] + (TB[12][3] - 1)*sc[14] + (TB[12][4] - 1)*sc[15] + (TB[12][5] - 1)*sc[26] + (TB[12][6] - 1)*sc[30] + (TB[12][7] - 1)*sc[24] + (TB[12][8] - 1)*sc[35] + (TB[12][9] - 1)*sc[65] + (TB[12][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[0]*sc[14];
-    k_f = prefactor_units[12] * fwd_A[12]
-                * exp(fwd_beta[12] * tc[0] - activation_units[12] * fwd_Ea[12] * invT);
+    k_f = k_f_s[12];
     dlnkfdT = fwd_beta[12] * invT + activation_units[12] * fwd_Ea[12] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[12] * exp(low_beta[12] * tc[0] - activation_units[12] * low_Ea[12] * invT);
@@ -36455,16 +36647,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[12] == 4 ? exp(-troe_Tss[12] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[12]) > 1.e-100 ? -Fcent1/troe_Tsss[12] : 0.)
+      + (fabs(troe_Ts[12]) > 1.e-100 ? -Fcent2/troe_Ts[12] : 0.)
+      + (troe_len[12] == 4 ? Fcent3*troe_Tss[12]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[12]) > 1.e-100 ? -Fcent1/troe_Tsss[12] : 0.)
-      + (fabs(troe_Ts[12]) > 1.e-100 ? -Fcent2/troe_Ts[12] : 0.)
-      + (troe_len[12] == 4 ? Fcent3*troe_Tss[12]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -36472,7 +36664,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[17];
-    Kc = refCinv * exp(g_RT[0] + g_RT[14] - g_RT[17]);
+    Kc = Kc_s[12];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[14]) + (h_RT[17]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36490,145 +36682,70 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[12][0] - 1)*dcdc_fac + k_f*sc[14];
-        J[0] -= dqdci;                /* dwdot[H2]/d[H2] */
-        J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
-        J[17] += dqdci;               /* dwdot[CH2O]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[12][1] - 1)*dcdc_fac;
-        J[355] -= dqdci;              /* dwdot[H2]/d[H2O] */
-        J[369] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[372] += dqdci;              /* dwdot[CH2O]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[12][2] - 1)*dcdc_fac;
-        J[923] -= dqdci;              /* dwdot[H2]/d[CH4] */
-        J[937] -= dqdci;              /* dwdot[CO]/d[CH4] */
-        J[940] += dqdci;              /* dwdot[CH2O]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[12][3] - 1)*dcdc_fac + k_f*sc[0];
-        J[994] -= dqdci;              /* dwdot[H2]/d[CO] */
-        J[1008] -= dqdci;             /* dwdot[CO]/d[CO] */
-        J[1011] += dqdci;             /* dwdot[CH2O]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[12][4] - 1)*dcdc_fac;
-        J[1065] -= dqdci;             /* dwdot[H2]/d[CO2] */
-        J[1079] -= dqdci;             /* dwdot[CO]/d[CO2] */
-        J[1082] += dqdci;             /* dwdot[CH2O]/d[CO2] */
-        /* d()/d[CH2O] */
-        dqdci =  - k_r;
-        J[1207] -= dqdci;             /* dwdot[H2]/d[CH2O] */
-        J[1221] -= dqdci;             /* dwdot[CO]/d[CH2O] */
-        J[1224] += dqdci;             /* dwdot[CH2O]/d[CH2O] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[12][7] - 1)*dcdc_fac;
-        J[1704] -= dqdci;             /* dwdot[H2]/d[C2H4] */
-        J[1718] -= dqdci;             /* dwdot[CO]/d[C2H4] */
-        J[1721] += dqdci;             /* dwdot[CH2O]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[12][5] - 1)*dcdc_fac;
-        J[1846] -= dqdci;             /* dwdot[H2]/d[C2H6] */
-        J[1860] -= dqdci;             /* dwdot[CO]/d[C2H6] */
-        J[1863] += dqdci;             /* dwdot[CH2O]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[12][6] - 1)*dcdc_fac;
-        J[2130] -= dqdci;             /* dwdot[H2]/d[AR] */
-        J[2144] -= dqdci;             /* dwdot[CO]/d[AR] */
-        J[2147] += dqdci;             /* dwdot[CH2O]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[12][8] - 1)*dcdc_fac;
-        J[2485] -= dqdci;             /* dwdot[H2]/d[pC3H4] */
-        J[2499] -= dqdci;             /* dwdot[CO]/d[pC3H4] */
-        J[2502] += dqdci;             /* dwdot[CH2O]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[12][10] - 1)*dcdc_fac;
-        J[4402] -= dqdci;             /* dwdot[H2]/d[C3H8] */
-        J[4416] -= dqdci;             /* dwdot[CO]/d[C3H8] */
-        J[4419] += dqdci;             /* dwdot[CH2O]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[12][9] - 1)*dcdc_fac;
-        J[4615] -= dqdci;             /* dwdot[H2]/d[C3H6] */
-        J[4629] -= dqdci;             /* dwdot[CO]/d[C3H6] */
-        J[4632] += dqdci;             /* dwdot[CH2O]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[12][0]*dcdc_fac + k_f*sc[14];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[12][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[12][2]*dcdc_fac;
-        dqdc[14] = TB[12][3]*dcdc_fac + k_f*sc[0];
-        dqdc[15] = TB[12][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac - k_r;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[12][7]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[12][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[12][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[12][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[12][10]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[12][9]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+0] -= dqdc[k];
-            J[71*k+14] -= dqdc[k];
-            J[71*k+17] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[14] -= dcdc_fac;
+    Jmix[17] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[12][0] - 1)*dcdc_fac + k_f*sc[14];
+    J[0] -= dqdci;                /* dwdot[H2]/d[H2] */
+    J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
+    J[17] += dqdci;               /* dwdot[CH2O]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[12][1] - 1)*dcdc_fac;
+    J[355] -= dqdci;              /* dwdot[H2]/d[H2O] */
+    J[369] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[372] += dqdci;              /* dwdot[CH2O]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[12][2] - 1)*dcdc_fac;
+    J[923] -= dqdci;              /* dwdot[H2]/d[CH4] */
+    J[937] -= dqdci;              /* dwdot[CO]/d[CH4] */
+    J[940] += dqdci;              /* dwdot[CH2O]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[12][3] - 1)*dcdc_fac + k_f*sc[0];
+    J[994] -= dqdci;              /* dwdot[H2]/d[CO] */
+    J[1008] -= dqdci;             /* dwdot[CO]/d[CO] */
+    J[1011] += dqdci;             /* dwdot[CH2O]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[12][4] - 1)*dcdc_fac;
+    J[1065] -= dqdci;             /* dwdot[H2]/d[CO2] */
+    J[1079] -= dqdci;             /* dwdot[CO]/d[CO2] */
+    J[1082] += dqdci;             /* dwdot[CH2O]/d[CO2] */
+    /* d()/d[CH2O] */
+    dqdci =  - k_r;
+    J[1207] -= dqdci;             /* dwdot[H2]/d[CH2O] */
+    J[1221] -= dqdci;             /* dwdot[CO]/d[CH2O] */
+    J[1224] += dqdci;             /* dwdot[CH2O]/d[CH2O] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[12][7] - 1)*dcdc_fac;
+    J[1704] -= dqdci;             /* dwdot[H2]/d[C2H4] */
+    J[1718] -= dqdci;             /* dwdot[CO]/d[C2H4] */
+    J[1721] += dqdci;             /* dwdot[CH2O]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[12][5] - 1)*dcdc_fac;
+    J[1846] -= dqdci;             /* dwdot[H2]/d[C2H6] */
+    J[1860] -= dqdci;             /* dwdot[CO]/d[C2H6] */
+    J[1863] += dqdci;             /* dwdot[CH2O]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[12][6] - 1)*dcdc_fac;
+    J[2130] -= dqdci;             /* dwdot[H2]/d[AR] */
+    J[2144] -= dqdci;             /* dwdot[CO]/d[AR] */
+    J[2147] += dqdci;             /* dwdot[CH2O]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[12][8] - 1)*dcdc_fac;
+    J[2485] -= dqdci;             /* dwdot[H2]/d[pC3H4] */
+    J[2499] -= dqdci;             /* dwdot[CO]/d[pC3H4] */
+    J[2502] += dqdci;             /* dwdot[CH2O]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[12][10] - 1)*dcdc_fac;
+    J[4402] -= dqdci;             /* dwdot[H2]/d[C3H8] */
+    J[4416] -= dqdci;             /* dwdot[CO]/d[C3H8] */
+    J[4419] += dqdci;             /* dwdot[CH2O]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[12][9] - 1)*dcdc_fac;
+    J[4615] -= dqdci;             /* dwdot[H2]/d[C3H6] */
+    J[4629] -= dqdci;             /* dwdot[CO]/d[C3H6] */
+    J[4632] += dqdci;             /* dwdot[CH2O]/d[C3H6] */
     J[4970] -= dqdT; /* dwdot[H2]/dT */
     J[4984] -= dqdT; /* dwdot[CO]/dT */
     J[4987] += dqdT; /* dwdot[CH2O]/dT */
@@ -36637,11 +36754,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[13][0] - 1)*sc[0] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[13] + (TB[13][3] - 1)*sc[14] + (TB[13][4] - 1)*sc[15] + (TB[13][5] - 1)*sc[26] + (TB[13][6] - 1)*sc[30] + (TB[13][7] - 1)*sc[24] + (TB[13][8] - 1)*sc[35] + (TB[13][9] - 1)*sc[65] + (TB[13][10] - 1)*sc[62];
+    alpha = (memcmp(TB[13], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[13][0] - 1)*sc[0] + (TB[13][1] - 1)*sc[5] + (TB[13][2] - 1)*sc[13] + (TB[13][3] - 1)*sc[14] + (TB[13][4] - 1)*sc[15] + (TB[13][5] - 1)*sc[26] + (TB[13][6] - 1)*sc[30] + (TB[13][7] - 1)*sc[24] + (TB[13][8] - 1)*sc[35] + (TB[13][9] - 1)*sc[65] + (TB[13][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[4]*sc[4];
-    k_f = prefactor_units[13] * fwd_A[13]
-                * exp(fwd_beta[13] * tc[0] - activation_units[13] * fwd_Ea[13] * invT);
+    k_f = k_f_s[13];
     dlnkfdT = fwd_beta[13] * invT + activation_units[13] * fwd_Ea[13] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[13] * exp(low_beta[13] * tc[0] - activation_units[13] * low_Ea[13] * invT);
@@ -36657,16 +36773,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[13] == 4 ? exp(-troe_Tss[13] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[13]) > 1.e-100 ? -Fcent1/troe_Tsss[13] : 0.)
+      + (fabs(troe_Ts[13]) > 1.e-100 ? -Fcent2/troe_Ts[13] : 0.)
+      + (troe_len[13] == 4 ? Fcent3*troe_Tss[13]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[13]) > 1.e-100 ? -Fcent1/troe_Tsss[13] : 0.)
-      + (fabs(troe_Ts[13]) > 1.e-100 ? -Fcent2/troe_Ts[13] : 0.)
-      + (troe_len[13] == 4 ? Fcent3*troe_Tss[13]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -36674,7 +36790,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[7];
-    Kc = refCinv * exp(2*g_RT[4] - g_RT[7]);
+    Kc = Kc_s[13];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[4]) + (h_RT[7]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36691,136 +36807,61 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[13][0] - 1)*dcdc_fac;
-        J[4] += -2 * dqdci;           /* dwdot[OH]/d[H2] */
-        J[7] += dqdci;                /* dwdot[H2O2]/d[H2] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*2*sc[4];
-        J[288] += -2 * dqdci;         /* dwdot[OH]/d[OH] */
-        J[291] += dqdci;              /* dwdot[H2O2]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[13][1] - 1)*dcdc_fac;
-        J[359] += -2 * dqdci;         /* dwdot[OH]/d[H2O] */
-        J[362] += dqdci;              /* dwdot[H2O2]/d[H2O] */
-        /* d()/d[H2O2] */
-        dqdci =  - k_r;
-        J[501] += -2 * dqdci;         /* dwdot[OH]/d[H2O2] */
-        J[504] += dqdci;              /* dwdot[H2O2]/d[H2O2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[13][2] - 1)*dcdc_fac;
-        J[927] += -2 * dqdci;         /* dwdot[OH]/d[CH4] */
-        J[930] += dqdci;              /* dwdot[H2O2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[13][3] - 1)*dcdc_fac;
-        J[998] += -2 * dqdci;         /* dwdot[OH]/d[CO] */
-        J[1001] += dqdci;             /* dwdot[H2O2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[13][4] - 1)*dcdc_fac;
-        J[1069] += -2 * dqdci;        /* dwdot[OH]/d[CO2] */
-        J[1072] += dqdci;             /* dwdot[H2O2]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[13][7] - 1)*dcdc_fac;
-        J[1708] += -2 * dqdci;        /* dwdot[OH]/d[C2H4] */
-        J[1711] += dqdci;             /* dwdot[H2O2]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[13][5] - 1)*dcdc_fac;
-        J[1850] += -2 * dqdci;        /* dwdot[OH]/d[C2H6] */
-        J[1853] += dqdci;             /* dwdot[H2O2]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[13][6] - 1)*dcdc_fac;
-        J[2134] += -2 * dqdci;        /* dwdot[OH]/d[AR] */
-        J[2137] += dqdci;             /* dwdot[H2O2]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[13][8] - 1)*dcdc_fac;
-        J[2489] += -2 * dqdci;        /* dwdot[OH]/d[pC3H4] */
-        J[2492] += dqdci;             /* dwdot[H2O2]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[13][10] - 1)*dcdc_fac;
-        J[4406] += -2 * dqdci;        /* dwdot[OH]/d[C3H8] */
-        J[4409] += dqdci;             /* dwdot[H2O2]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[13][9] - 1)*dcdc_fac;
-        J[4619] += -2 * dqdci;        /* dwdot[OH]/d[C3H6] */
-        J[4622] += dqdci;             /* dwdot[H2O2]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[13][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac + k_f*2*sc[4];
-        dqdc[5] = TB[13][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac - k_r;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[13][2]*dcdc_fac;
-        dqdc[14] = TB[13][3]*dcdc_fac;
-        dqdc[15] = TB[13][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[13][7]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[13][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[13][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[13][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[13][10]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[13][9]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+4] += -2 * dqdc[k];
-            J[71*k+7] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[4] += -2 * dcdc_fac;
+    Jmix[7] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[13][0] - 1)*dcdc_fac;
+    J[4] += -2 * dqdci;           /* dwdot[OH]/d[H2] */
+    J[7] += dqdci;                /* dwdot[H2O2]/d[H2] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*2*sc[4];
+    J[288] += -2 * dqdci;         /* dwdot[OH]/d[OH] */
+    J[291] += dqdci;              /* dwdot[H2O2]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[13][1] - 1)*dcdc_fac;
+    J[359] += -2 * dqdci;         /* dwdot[OH]/d[H2O] */
+    J[362] += dqdci;              /* dwdot[H2O2]/d[H2O] */
+    /* d()/d[H2O2] */
+    dqdci =  - k_r;
+    J[501] += -2 * dqdci;         /* dwdot[OH]/d[H2O2] */
+    J[504] += dqdci;              /* dwdot[H2O2]/d[H2O2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[13][2] - 1)*dcdc_fac;
+    J[927] += -2 * dqdci;         /* dwdot[OH]/d[CH4] */
+    J[930] += dqdci;              /* dwdot[H2O2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[13][3] - 1)*dcdc_fac;
+    J[998] += -2 * dqdci;         /* dwdot[OH]/d[CO] */
+    J[1001] += dqdci;             /* dwdot[H2O2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[13][4] - 1)*dcdc_fac;
+    J[1069] += -2 * dqdci;        /* dwdot[OH]/d[CO2] */
+    J[1072] += dqdci;             /* dwdot[H2O2]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[13][7] - 1)*dcdc_fac;
+    J[1708] += -2 * dqdci;        /* dwdot[OH]/d[C2H4] */
+    J[1711] += dqdci;             /* dwdot[H2O2]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[13][5] - 1)*dcdc_fac;
+    J[1850] += -2 * dqdci;        /* dwdot[OH]/d[C2H6] */
+    J[1853] += dqdci;             /* dwdot[H2O2]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[13][6] - 1)*dcdc_fac;
+    J[2134] += -2 * dqdci;        /* dwdot[OH]/d[AR] */
+    J[2137] += dqdci;             /* dwdot[H2O2]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[13][8] - 1)*dcdc_fac;
+    J[2489] += -2 * dqdci;        /* dwdot[OH]/d[pC3H4] */
+    J[2492] += dqdci;             /* dwdot[H2O2]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[13][10] - 1)*dcdc_fac;
+    J[4406] += -2 * dqdci;        /* dwdot[OH]/d[C3H8] */
+    J[4409] += dqdci;             /* dwdot[H2O2]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[13][9] - 1)*dcdc_fac;
+    J[4619] += -2 * dqdci;        /* dwdot[OH]/d[C3H6] */
+    J[4622] += dqdci;             /* dwdot[H2O2]/d[C3H6] */
     J[4974] += -2 * dqdT; /* dwdot[OH]/dT */
     J[4977] += dqdT; /* dwdot[H2O2]/dT */
 
@@ -36828,11 +36869,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[14][0] - 1)*sc[0] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[13] + (TB[14][3] - 1)*sc[14] + (TB[14][4] - 1)*sc[15] + (TB[14][5] - 1)*sc[26] + (TB[14][6] - 1)*sc[24] + (TB[14][7] - 1)*sc[35] + (TB[14][8] - 1)*sc[65] + (TB[14][9] - 1)*sc[62];
+    alpha = (memcmp(TB[14], TB[3], 10*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[14][0] - 1)*sc[0] + (TB[14][1] - 1)*sc[5] + (TB[14][2] - 1)*sc[13] + (TB[14][3] - 1)*sc[14] + (TB[14][4] - 1)*sc[15] + (TB[14][5] - 1)*sc[26] + (TB[14][6] - 1)*sc[24] + (TB[14][7] - 1)*sc[35] + (TB[14][8] - 1)*sc[65] + (TB[14][9] - 1)*sc[62]);
     /* forward */
     phi_f = sc[4]*sc[12];
-    k_f = prefactor_units[14] * fwd_A[14]
-                * exp(fwd_beta[14] * tc[0] - activation_units[14] * fwd_Ea[14] * invT);
+    k_f = k_f_s[14];
     dlnkfdT = fwd_beta[14] * invT + activation_units[14] * fwd_Ea[14] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[14] * exp(low_beta[14] * tc[0] - activation_units[14] * low_Ea[14] * invT);
@@ -36848,16 +36888,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[14] == 4 ? exp(-troe_Tss[14] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[14]) > 1.e-100 ? -Fcent1/troe_Tsss[14] : 0.)
+      + (fabs(troe_Ts[14]) > 1.e-100 ? -Fcent2/troe_Ts[14] : 0.)
+      + (troe_len[14] == 4 ? Fcent3*troe_Tss[14]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[14]) > 1.e-100 ? -Fcent1/troe_Tsss[14] : 0.)
-      + (fabs(troe_Ts[14]) > 1.e-100 ? -Fcent2/troe_Ts[14] : 0.)
-      + (troe_len[14] == 4 ? Fcent3*troe_Tss[14]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -36865,7 +36905,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[20];
-    Kc = refCinv * exp(g_RT[4] + g_RT[12] - g_RT[20]);
+    Kc = Kc_s[14];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[12]) + (h_RT[20]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -36883,150 +36923,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[14][0] - 1)*dcdc_fac;
-        J[4] -= dqdci;                /* dwdot[OH]/d[H2] */
-        J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
-        J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*sc[12];
-        J[288] -= dqdci;              /* dwdot[OH]/d[OH] */
-        J[296] -= dqdci;              /* dwdot[CH3]/d[OH] */
-        J[304] += dqdci;              /* dwdot[CH3OH]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[14][1] - 1)*dcdc_fac;
-        J[359] -= dqdci;              /* dwdot[OH]/d[H2O] */
-        J[367] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[375] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[4];
-        J[856] -= dqdci;              /* dwdot[OH]/d[CH3] */
-        J[864] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[872] += dqdci;              /* dwdot[CH3OH]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[14][2] - 1)*dcdc_fac;
-        J[927] -= dqdci;              /* dwdot[OH]/d[CH4] */
-        J[935] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[943] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[14][3] - 1)*dcdc_fac;
-        J[998] -= dqdci;              /* dwdot[OH]/d[CO] */
-        J[1006] -= dqdci;             /* dwdot[CH3]/d[CO] */
-        J[1014] += dqdci;             /* dwdot[CH3OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[14][4] - 1)*dcdc_fac;
-        J[1069] -= dqdci;             /* dwdot[OH]/d[CO2] */
-        J[1077] -= dqdci;             /* dwdot[CH3]/d[CO2] */
-        J[1085] += dqdci;             /* dwdot[CH3OH]/d[CO2] */
-        /* d()/d[CH3OH] */
-        dqdci =  - k_r;
-        J[1424] -= dqdci;             /* dwdot[OH]/d[CH3OH] */
-        J[1432] -= dqdci;             /* dwdot[CH3]/d[CH3OH] */
-        J[1440] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[14][6] - 1)*dcdc_fac;
-        J[1708] -= dqdci;             /* dwdot[OH]/d[C2H4] */
-        J[1716] -= dqdci;             /* dwdot[CH3]/d[C2H4] */
-        J[1724] += dqdci;             /* dwdot[CH3OH]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[14][5] - 1)*dcdc_fac;
-        J[1850] -= dqdci;             /* dwdot[OH]/d[C2H6] */
-        J[1858] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
-        J[1866] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[14][7] - 1)*dcdc_fac;
-        J[2489] -= dqdci;             /* dwdot[OH]/d[pC3H4] */
-        J[2497] -= dqdci;             /* dwdot[CH3]/d[pC3H4] */
-        J[2505] += dqdci;             /* dwdot[CH3OH]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[14][9] - 1)*dcdc_fac;
-        J[4406] -= dqdci;             /* dwdot[OH]/d[C3H8] */
-        J[4414] -= dqdci;             /* dwdot[CH3]/d[C3H8] */
-        J[4422] += dqdci;             /* dwdot[CH3OH]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[14][8] - 1)*dcdc_fac;
-        J[4619] -= dqdci;             /* dwdot[OH]/d[C3H6] */
-        J[4627] -= dqdci;             /* dwdot[CH3]/d[C3H6] */
-        J[4635] += dqdci;             /* dwdot[CH3OH]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[14][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac + k_f*sc[12];
-        dqdc[5] = TB[14][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*sc[4];
-        dqdc[13] = TB[14][2]*dcdc_fac;
-        dqdc[14] = TB[14][3]*dcdc_fac;
-        dqdc[15] = TB[14][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac - k_r;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[14][6]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[14][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[14][7]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[14][9]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[14][8]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+4] -= dqdc[k];
-            J[71*k+12] -= dqdc[k];
-            J[71*k+20] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[4] -= dcdc_fac;
+    Jmix[12] -= dcdc_fac;
+    Jmix[20] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[14][0] - 1)*dcdc_fac;
+    J[4] -= dqdci;                /* dwdot[OH]/d[H2] */
+    J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
+    J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*sc[12];
+    J[288] -= dqdci;              /* dwdot[OH]/d[OH] */
+    J[296] -= dqdci;              /* dwdot[CH3]/d[OH] */
+    J[304] += dqdci;              /* dwdot[CH3OH]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[14][1] - 1)*dcdc_fac;
+    J[359] -= dqdci;              /* dwdot[OH]/d[H2O] */
+    J[367] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[375] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[4];
+    J[856] -= dqdci;              /* dwdot[OH]/d[CH3] */
+    J[864] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[872] += dqdci;              /* dwdot[CH3OH]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[14][2] - 1)*dcdc_fac;
+    J[927] -= dqdci;              /* dwdot[OH]/d[CH4] */
+    J[935] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[943] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[14][3] - 1)*dcdc_fac;
+    J[998] -= dqdci;              /* dwdot[OH]/d[CO] */
+    J[1006] -= dqdci;             /* dwdot[CH3]/d[CO] */
+    J[1014] += dqdci;             /* dwdot[CH3OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[14][4] - 1)*dcdc_fac;
+    J[1069] -= dqdci;             /* dwdot[OH]/d[CO2] */
+    J[1077] -= dqdci;             /* dwdot[CH3]/d[CO2] */
+    J[1085] += dqdci;             /* dwdot[CH3OH]/d[CO2] */
+    /* d()/d[CH3OH] */
+    dqdci =  - k_r;
+    J[1424] -= dqdci;             /* dwdot[OH]/d[CH3OH] */
+    J[1432] -= dqdci;             /* dwdot[CH3]/d[CH3OH] */
+    J[1440] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[14][6] - 1)*dcdc_fac;
+    J[1708] -= dqdci;             /* dwdot[OH]/d[C2H4] */
+    J[1716] -= dqdci;             /* dwdot[CH3]/d[C2H4] */
+    J[1724] += dqdci;             /* dwdot[CH3OH]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[14][5] - 1)*dcdc_fac;
+    J[1850] -= dqdci;             /* dwdot[OH]/d[C2H6] */
+    J[1858] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
+    J[1866] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[14][7] - 1)*dcdc_fac;
+    J[2489] -= dqdci;             /* dwdot[OH]/d[pC3H4] */
+    J[2497] -= dqdci;             /* dwdot[CH3]/d[pC3H4] */
+    J[2505] += dqdci;             /* dwdot[CH3OH]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[14][9] - 1)*dcdc_fac;
+    J[4406] -= dqdci;             /* dwdot[OH]/d[C3H8] */
+    J[4414] -= dqdci;             /* dwdot[CH3]/d[C3H8] */
+    J[4422] += dqdci;             /* dwdot[CH3OH]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[14][8] - 1)*dcdc_fac;
+    J[4619] -= dqdci;             /* dwdot[OH]/d[C3H6] */
+    J[4627] -= dqdci;             /* dwdot[CH3]/d[C3H6] */
+    J[4635] += dqdci;             /* dwdot[CH3OH]/d[C3H6] */
     J[4974] -= dqdT; /* dwdot[OH]/dT */
     J[4982] -= dqdT; /* dwdot[CH3]/dT */
     J[4990] += dqdT; /* dwdot[CH3OH]/dT */
@@ -37035,11 +37000,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[15][0] - 1)*sc[0] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[13] + (TB[15][3] - 1)*sc[14] + (TB[15][4] - 1)*sc[15] + (TB[15][5] - 1)*sc[26] + (TB[15][6] - 1)*sc[30] + (TB[15][7] - 1)*sc[24] + (TB[15][8] - 1)*sc[35] + (TB[15][9] - 1)*sc[65] + (TB[15][10] - 1)*sc[62];
+    alpha = (memcmp(TB[15], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[15][0] - 1)*sc[0] + (TB[15][1] - 1)*sc[5] + (TB[15][2] - 1)*sc[13] + (TB[15][3] - 1)*sc[14] + (TB[15][4] - 1)*sc[15] + (TB[15][5] - 1)*sc[26] + (TB[15][6] - 1)*sc[30] + (TB[15][7] - 1)*sc[24] + (TB[15][8] - 1)*sc[35] + (TB[15][9] - 1)*sc[65] + (TB[15][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[9]*sc[14];
-    k_f = prefactor_units[15] * fwd_A[15]
-                * exp(fwd_beta[15] * tc[0] - activation_units[15] * fwd_Ea[15] * invT);
+    k_f = k_f_s[15];
     dlnkfdT = fwd_beta[15] * invT + activation_units[15] * fwd_Ea[15] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[15] * exp(low_beta[15] * tc[0] - activation_units[15] * low_Ea[15] * invT);
@@ -37055,16 +37019,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[15] == 4 ? exp(-troe_Tss[15] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[15]) > 1.e-100 ? -Fcent1/troe_Tsss[15] : 0.)
+      + (fabs(troe_Ts[15]) > 1.e-100 ? -Fcent2/troe_Ts[15] : 0.)
+      + (troe_len[15] == 4 ? Fcent3*troe_Tss[15]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[15]) > 1.e-100 ? -Fcent1/troe_Tsss[15] : 0.)
-      + (fabs(troe_Ts[15]) > 1.e-100 ? -Fcent2/troe_Ts[15] : 0.)
-      + (troe_len[15] == 4 ? Fcent3*troe_Tss[15]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -37072,7 +37036,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[27];
-    Kc = refCinv * exp(g_RT[9] + g_RT[14] - g_RT[27]);
+    Kc = Kc_s[15];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[14]) + (h_RT[27]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37090,150 +37054,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[15][0] - 1)*dcdc_fac;
-        J[9] -= dqdci;                /* dwdot[CH]/d[H2] */
-        J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
-        J[27] += dqdci;               /* dwdot[HCCO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[15][1] - 1)*dcdc_fac;
-        J[364] -= dqdci;              /* dwdot[CH]/d[H2O] */
-        J[369] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[382] += dqdci;              /* dwdot[HCCO]/d[H2O] */
-        /* d()/d[CH] */
-        dqdci =  + k_f*sc[14];
-        J[648] -= dqdci;              /* dwdot[CH]/d[CH] */
-        J[653] -= dqdci;              /* dwdot[CO]/d[CH] */
-        J[666] += dqdci;              /* dwdot[HCCO]/d[CH] */
-        /* d()/d[CH4] */
-        dqdci = (TB[15][2] - 1)*dcdc_fac;
-        J[932] -= dqdci;              /* dwdot[CH]/d[CH4] */
-        J[937] -= dqdci;              /* dwdot[CO]/d[CH4] */
-        J[950] += dqdci;              /* dwdot[HCCO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[15][3] - 1)*dcdc_fac + k_f*sc[9];
-        J[1003] -= dqdci;             /* dwdot[CH]/d[CO] */
-        J[1008] -= dqdci;             /* dwdot[CO]/d[CO] */
-        J[1021] += dqdci;             /* dwdot[HCCO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[15][4] - 1)*dcdc_fac;
-        J[1074] -= dqdci;             /* dwdot[CH]/d[CO2] */
-        J[1079] -= dqdci;             /* dwdot[CO]/d[CO2] */
-        J[1092] += dqdci;             /* dwdot[HCCO]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[15][7] - 1)*dcdc_fac;
-        J[1713] -= dqdci;             /* dwdot[CH]/d[C2H4] */
-        J[1718] -= dqdci;             /* dwdot[CO]/d[C2H4] */
-        J[1731] += dqdci;             /* dwdot[HCCO]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[15][5] - 1)*dcdc_fac;
-        J[1855] -= dqdci;             /* dwdot[CH]/d[C2H6] */
-        J[1860] -= dqdci;             /* dwdot[CO]/d[C2H6] */
-        J[1873] += dqdci;             /* dwdot[HCCO]/d[C2H6] */
-        /* d()/d[HCCO] */
-        dqdci =  - k_r;
-        J[1926] -= dqdci;             /* dwdot[CH]/d[HCCO] */
-        J[1931] -= dqdci;             /* dwdot[CO]/d[HCCO] */
-        J[1944] += dqdci;             /* dwdot[HCCO]/d[HCCO] */
-        /* d()/d[AR] */
-        dqdci = (TB[15][6] - 1)*dcdc_fac;
-        J[2139] -= dqdci;             /* dwdot[CH]/d[AR] */
-        J[2144] -= dqdci;             /* dwdot[CO]/d[AR] */
-        J[2157] += dqdci;             /* dwdot[HCCO]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[15][8] - 1)*dcdc_fac;
-        J[2494] -= dqdci;             /* dwdot[CH]/d[pC3H4] */
-        J[2499] -= dqdci;             /* dwdot[CO]/d[pC3H4] */
-        J[2512] += dqdci;             /* dwdot[HCCO]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[15][10] - 1)*dcdc_fac;
-        J[4411] -= dqdci;             /* dwdot[CH]/d[C3H8] */
-        J[4416] -= dqdci;             /* dwdot[CO]/d[C3H8] */
-        J[4429] += dqdci;             /* dwdot[HCCO]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[15][9] - 1)*dcdc_fac;
-        J[4624] -= dqdci;             /* dwdot[CH]/d[C3H6] */
-        J[4629] -= dqdci;             /* dwdot[CO]/d[C3H6] */
-        J[4642] += dqdci;             /* dwdot[HCCO]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[15][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[15][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac + k_f*sc[14];
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[15][2]*dcdc_fac;
-        dqdc[14] = TB[15][3]*dcdc_fac + k_f*sc[9];
-        dqdc[15] = TB[15][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[15][7]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[15][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac - k_r;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[15][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[15][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[15][10]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[15][9]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+9] -= dqdc[k];
-            J[71*k+14] -= dqdc[k];
-            J[71*k+27] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[9] -= dcdc_fac;
+    Jmix[14] -= dcdc_fac;
+    Jmix[27] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[15][0] - 1)*dcdc_fac;
+    J[9] -= dqdci;                /* dwdot[CH]/d[H2] */
+    J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
+    J[27] += dqdci;               /* dwdot[HCCO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[15][1] - 1)*dcdc_fac;
+    J[364] -= dqdci;              /* dwdot[CH]/d[H2O] */
+    J[369] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[382] += dqdci;              /* dwdot[HCCO]/d[H2O] */
+    /* d()/d[CH] */
+    dqdci =  + k_f*sc[14];
+    J[648] -= dqdci;              /* dwdot[CH]/d[CH] */
+    J[653] -= dqdci;              /* dwdot[CO]/d[CH] */
+    J[666] += dqdci;              /* dwdot[HCCO]/d[CH] */
+    /* d()/d[CH4] */
+    dqdci = (TB[15][2] - 1)*dcdc_fac;
+    J[932] -= dqdci;              /* dwdot[CH]/d[CH4] */
+    J[937] -= dqdci;              /* dwdot[CO]/d[CH4] */
+    J[950] += dqdci;              /* dwdot[HCCO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[15][3] - 1)*dcdc_fac + k_f*sc[9];
+    J[1003] -= dqdci;             /* dwdot[CH]/d[CO] */
+    J[1008] -= dqdci;             /* dwdot[CO]/d[CO] */
+    J[1021] += dqdci;             /* dwdot[HCCO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[15][4] - 1)*dcdc_fac;
+    J[1074] -= dqdci;             /* dwdot[CH]/d[CO2] */
+    J[1079] -= dqdci;             /* dwdot[CO]/d[CO2] */
+    J[1092] += dqdci;             /* dwdot[HCCO]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[15][7] - 1)*dcdc_fac;
+    J[1713] -= dqdci;             /* dwdot[CH]/d[C2H4] */
+    J[1718] -= dqdci;             /* dwdot[CO]/d[C2H4] */
+    J[1731] += dqdci;             /* dwdot[HCCO]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[15][5] - 1)*dcdc_fac;
+    J[1855] -= dqdci;             /* dwdot[CH]/d[C2H6] */
+    J[1860] -= dqdci;             /* dwdot[CO]/d[C2H6] */
+    J[1873] += dqdci;             /* dwdot[HCCO]/d[C2H6] */
+    /* d()/d[HCCO] */
+    dqdci =  - k_r;
+    J[1926] -= dqdci;             /* dwdot[CH]/d[HCCO] */
+    J[1931] -= dqdci;             /* dwdot[CO]/d[HCCO] */
+    J[1944] += dqdci;             /* dwdot[HCCO]/d[HCCO] */
+    /* d()/d[AR] */
+    dqdci = (TB[15][6] - 1)*dcdc_fac;
+    J[2139] -= dqdci;             /* dwdot[CH]/d[AR] */
+    J[2144] -= dqdci;             /* dwdot[CO]/d[AR] */
+    J[2157] += dqdci;             /* dwdot[HCCO]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[15][8] - 1)*dcdc_fac;
+    J[2494] -= dqdci;             /* dwdot[CH]/d[pC3H4] */
+    J[2499] -= dqdci;             /* dwdot[CO]/d[pC3H4] */
+    J[2512] += dqdci;             /* dwdot[HCCO]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[15][10] - 1)*dcdc_fac;
+    J[4411] -= dqdci;             /* dwdot[CH]/d[C3H8] */
+    J[4416] -= dqdci;             /* dwdot[CO]/d[C3H8] */
+    J[4429] += dqdci;             /* dwdot[HCCO]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[15][9] - 1)*dcdc_fac;
+    J[4624] -= dqdci;             /* dwdot[CH]/d[C3H6] */
+    J[4629] -= dqdci;             /* dwdot[CO]/d[C3H6] */
+    J[4642] += dqdci;             /* dwdot[HCCO]/d[C3H6] */
     J[4979] -= dqdT; /* dwdot[CH]/dT */
     J[4984] -= dqdT; /* dwdot[CO]/dT */
     J[4997] += dqdT; /* dwdot[HCCO]/dT */
@@ -37242,11 +37131,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[16][0] - 1)*sc[0] + (TB[16][1] - 1)*sc[5] + (TB[16][2] - 1)*sc[13] + (TB[16][3] - 1)*sc[14] + (TB[16][4] - 1)*sc[15] + (TB[16][5] - 1)*sc[26] + (TB[16][6] - 1)*sc[30] + (TB[16][7] - 1)*sc[24] + (TB[16][8] - 1)*sc[35] + (TB[16][9] - 1)*sc[65] + (TB[16][10] - 1)*sc[62];
+    alpha = (memcmp(TB[16], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[16][0] - 1)*sc[0] + (TB[16][1] - 1)*sc[5] + (TB[16][2] - 1)*sc[13] + (TB[16][3] - 1)*sc[14] + (TB[16][4] - 1)*sc[15] + (TB[16][5] - 1)*sc[26] + (TB[16][6] - 1)*sc[30] + (TB[16][7] - 1)*sc[24] + (TB[16][8] - 1)*sc[35] + (TB[16][9] - 1)*sc[65] + (TB[16][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[10]*sc[14];
-    k_f = prefactor_units[16] * fwd_A[16]
-                * exp(fwd_beta[16] * tc[0] - activation_units[16] * fwd_Ea[16] * invT);
+    k_f = k_f_s[16];
     dlnkfdT = fwd_beta[16] * invT + activation_units[16] * fwd_Ea[16] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[16] * exp(low_beta[16] * tc[0] - activation_units[16] * low_Ea[16] * invT);
@@ -37262,16 +37150,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[16] == 4 ? exp(-troe_Tss[16] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[16]) > 1.e-100 ? -Fcent1/troe_Tsss[16] : 0.)
+      + (fabs(troe_Ts[16]) > 1.e-100 ? -Fcent2/troe_Ts[16] : 0.)
+      + (troe_len[16] == 4 ? Fcent3*troe_Tss[16]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[16]) > 1.e-100 ? -Fcent1/troe_Tsss[16] : 0.)
-      + (fabs(troe_Ts[16]) > 1.e-100 ? -Fcent2/troe_Ts[16] : 0.)
-      + (troe_len[16] == 4 ? Fcent3*troe_Tss[16]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -37279,7 +37167,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[28];
-    Kc = refCinv * exp(g_RT[10] + g_RT[14] - g_RT[28]);
+    Kc = Kc_s[16];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[14]) + (h_RT[28]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37297,150 +37185,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[16][0] - 1)*dcdc_fac;
-        J[10] -= dqdci;               /* dwdot[CH2]/d[H2] */
-        J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
-        J[28] += dqdci;               /* dwdot[CH2CO]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[16][1] - 1)*dcdc_fac;
-        J[365] -= dqdci;              /* dwdot[CH2]/d[H2O] */
-        J[369] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[383] += dqdci;              /* dwdot[CH2CO]/d[H2O] */
-        /* d()/d[CH2] */
-        dqdci =  + k_f*sc[14];
-        J[720] -= dqdci;              /* dwdot[CH2]/d[CH2] */
-        J[724] -= dqdci;              /* dwdot[CO]/d[CH2] */
-        J[738] += dqdci;              /* dwdot[CH2CO]/d[CH2] */
-        /* d()/d[CH4] */
-        dqdci = (TB[16][2] - 1)*dcdc_fac;
-        J[933] -= dqdci;              /* dwdot[CH2]/d[CH4] */
-        J[937] -= dqdci;              /* dwdot[CO]/d[CH4] */
-        J[951] += dqdci;              /* dwdot[CH2CO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[16][3] - 1)*dcdc_fac + k_f*sc[10];
-        J[1004] -= dqdci;             /* dwdot[CH2]/d[CO] */
-        J[1008] -= dqdci;             /* dwdot[CO]/d[CO] */
-        J[1022] += dqdci;             /* dwdot[CH2CO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[16][4] - 1)*dcdc_fac;
-        J[1075] -= dqdci;             /* dwdot[CH2]/d[CO2] */
-        J[1079] -= dqdci;             /* dwdot[CO]/d[CO2] */
-        J[1093] += dqdci;             /* dwdot[CH2CO]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[16][7] - 1)*dcdc_fac;
-        J[1714] -= dqdci;             /* dwdot[CH2]/d[C2H4] */
-        J[1718] -= dqdci;             /* dwdot[CO]/d[C2H4] */
-        J[1732] += dqdci;             /* dwdot[CH2CO]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[16][5] - 1)*dcdc_fac;
-        J[1856] -= dqdci;             /* dwdot[CH2]/d[C2H6] */
-        J[1860] -= dqdci;             /* dwdot[CO]/d[C2H6] */
-        J[1874] += dqdci;             /* dwdot[CH2CO]/d[C2H6] */
-        /* d()/d[CH2CO] */
-        dqdci =  - k_r;
-        J[1998] -= dqdci;             /* dwdot[CH2]/d[CH2CO] */
-        J[2002] -= dqdci;             /* dwdot[CO]/d[CH2CO] */
-        J[2016] += dqdci;             /* dwdot[CH2CO]/d[CH2CO] */
-        /* d()/d[AR] */
-        dqdci = (TB[16][6] - 1)*dcdc_fac;
-        J[2140] -= dqdci;             /* dwdot[CH2]/d[AR] */
-        J[2144] -= dqdci;             /* dwdot[CO]/d[AR] */
-        J[2158] += dqdci;             /* dwdot[CH2CO]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[16][8] - 1)*dcdc_fac;
-        J[2495] -= dqdci;             /* dwdot[CH2]/d[pC3H4] */
-        J[2499] -= dqdci;             /* dwdot[CO]/d[pC3H4] */
-        J[2513] += dqdci;             /* dwdot[CH2CO]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[16][10] - 1)*dcdc_fac;
-        J[4412] -= dqdci;             /* dwdot[CH2]/d[C3H8] */
-        J[4416] -= dqdci;             /* dwdot[CO]/d[C3H8] */
-        J[4430] += dqdci;             /* dwdot[CH2CO]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[16][9] - 1)*dcdc_fac;
-        J[4625] -= dqdci;             /* dwdot[CH2]/d[C3H6] */
-        J[4629] -= dqdci;             /* dwdot[CO]/d[C3H6] */
-        J[4643] += dqdci;             /* dwdot[CH2CO]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[16][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[16][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac + k_f*sc[14];
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[16][2]*dcdc_fac;
-        dqdc[14] = TB[16][3]*dcdc_fac + k_f*sc[10];
-        dqdc[15] = TB[16][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[16][7]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[16][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac - k_r;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[16][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[16][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[16][10]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[16][9]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+10] -= dqdc[k];
-            J[71*k+14] -= dqdc[k];
-            J[71*k+28] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[10] -= dcdc_fac;
+    Jmix[14] -= dcdc_fac;
+    Jmix[28] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[16][0] - 1)*dcdc_fac;
+    J[10] -= dqdci;               /* dwdot[CH2]/d[H2] */
+    J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
+    J[28] += dqdci;               /* dwdot[CH2CO]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[16][1] - 1)*dcdc_fac;
+    J[365] -= dqdci;              /* dwdot[CH2]/d[H2O] */
+    J[369] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[383] += dqdci;              /* dwdot[CH2CO]/d[H2O] */
+    /* d()/d[CH2] */
+    dqdci =  + k_f*sc[14];
+    J[720] -= dqdci;              /* dwdot[CH2]/d[CH2] */
+    J[724] -= dqdci;              /* dwdot[CO]/d[CH2] */
+    J[738] += dqdci;              /* dwdot[CH2CO]/d[CH2] */
+    /* d()/d[CH4] */
+    dqdci = (TB[16][2] - 1)*dcdc_fac;
+    J[933] -= dqdci;              /* dwdot[CH2]/d[CH4] */
+    J[937] -= dqdci;              /* dwdot[CO]/d[CH4] */
+    J[951] += dqdci;              /* dwdot[CH2CO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[16][3] - 1)*dcdc_fac + k_f*sc[10];
+    J[1004] -= dqdci;             /* dwdot[CH2]/d[CO] */
+    J[1008] -= dqdci;             /* dwdot[CO]/d[CO] */
+    J[1022] += dqdci;             /* dwdot[CH2CO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[16][4] - 1)*dcdc_fac;
+    J[1075] -= dqdci;             /* dwdot[CH2]/d[CO2] */
+    J[1079] -= dqdci;             /* dwdot[CO]/d[CO2] */
+    J[1093] += dqdci;             /* dwdot[CH2CO]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[16][7] - 1)*dcdc_fac;
+    J[1714] -= dqdci;             /* dwdot[CH2]/d[C2H4] */
+    J[1718] -= dqdci;             /* dwdot[CO]/d[C2H4] */
+    J[1732] += dqdci;             /* dwdot[CH2CO]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[16][5] - 1)*dcdc_fac;
+    J[1856] -= dqdci;             /* dwdot[CH2]/d[C2H6] */
+    J[1860] -= dqdci;             /* dwdot[CO]/d[C2H6] */
+    J[1874] += dqdci;             /* dwdot[CH2CO]/d[C2H6] */
+    /* d()/d[CH2CO] */
+    dqdci =  - k_r;
+    J[1998] -= dqdci;             /* dwdot[CH2]/d[CH2CO] */
+    J[2002] -= dqdci;             /* dwdot[CO]/d[CH2CO] */
+    J[2016] += dqdci;             /* dwdot[CH2CO]/d[CH2CO] */
+    /* d()/d[AR] */
+    dqdci = (TB[16][6] - 1)*dcdc_fac;
+    J[2140] -= dqdci;             /* dwdot[CH2]/d[AR] */
+    J[2144] -= dqdci;             /* dwdot[CO]/d[AR] */
+    J[2158] += dqdci;             /* dwdot[CH2CO]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[16][8] - 1)*dcdc_fac;
+    J[2495] -= dqdci;             /* dwdot[CH2]/d[pC3H4] */
+    J[2499] -= dqdci;             /* dwdot[CO]/d[pC3H4] */
+    J[2513] += dqdci;             /* dwdot[CH2CO]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[16][10] - 1)*dcdc_fac;
+    J[4412] -= dqdci;             /* dwdot[CH2]/d[C3H8] */
+    J[4416] -= dqdci;             /* dwdot[CO]/d[C3H8] */
+    J[4430] += dqdci;             /* dwdot[CH2CO]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[16][9] - 1)*dcdc_fac;
+    J[4625] -= dqdci;             /* dwdot[CH2]/d[C3H6] */
+    J[4629] -= dqdci;             /* dwdot[CO]/d[C3H6] */
+    J[4643] += dqdci;             /* dwdot[CH2CO]/d[C3H6] */
     J[4980] -= dqdT; /* dwdot[CH2]/dT */
     J[4984] -= dqdT; /* dwdot[CO]/dT */
     J[4998] += dqdT; /* dwdot[CH2CO]/dT */
@@ -37449,11 +37262,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[17][0] - 1)*sc[0] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[13] + (TB[17][3] - 1)*sc[14] + (TB[17][4] - 1)*sc[15] + (TB[17][5] - 1)*sc[26] + (TB[17][6] - 1)*sc[24] + (TB[17][7] - 1)*sc[35] + (TB[17][8] - 1)*sc[65] + (TB[17][9] - 1)*sc[62];
+    alpha = (memcmp(TB[17], TB[3], 10*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[17][0] - 1)*sc[0] + (TB[17][1] - 1)*sc[5] + (TB[17][2] - 1)*sc[13] + (TB[17][3] - 1)*sc[14] + (TB[17][4] - 1)*sc[15] + (TB[17][5] - 1)*sc[26] + (TB[17][6] - 1)*sc[24] + (TB[17][7] - 1)*sc[35] + (TB[17][8] - 1)*sc[65] + (TB[17][9] - 1)*sc[62]);
     /* forward */
     phi_f = sc[5]*sc[11];
-    k_f = prefactor_units[17] * fwd_A[17]
-                * exp(fwd_beta[17] * tc[0] - activation_units[17] * fwd_Ea[17] * invT);
+    k_f = k_f_s[17];
     dlnkfdT = fwd_beta[17] * invT + activation_units[17] * fwd_Ea[17] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[17] * exp(low_beta[17] * tc[0] - activation_units[17] * low_Ea[17] * invT);
@@ -37469,16 +37281,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[17] == 4 ? exp(-troe_Tss[17] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[17]) > 1.e-100 ? -Fcent1/troe_Tsss[17] : 0.)
+      + (fabs(troe_Ts[17]) > 1.e-100 ? -Fcent2/troe_Ts[17] : 0.)
+      + (troe_len[17] == 4 ? Fcent3*troe_Tss[17]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[17]) > 1.e-100 ? -Fcent1/troe_Tsss[17] : 0.)
-      + (fabs(troe_Ts[17]) > 1.e-100 ? -Fcent2/troe_Ts[17] : 0.)
-      + (troe_len[17] == 4 ? Fcent3*troe_Tss[17]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -37486,7 +37298,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[20];
-    Kc = refCinv * exp(g_RT[5] + g_RT[11] - g_RT[20]);
+    Kc = Kc_s[17];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[11]) + (h_RT[20]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37504,145 +37316,70 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[17][0] - 1)*dcdc_fac;
-        J[5] -= dqdci;                /* dwdot[H2O]/d[H2] */
-        J[11] -= dqdci;               /* dwdot[CH2*]/d[H2] */
-        J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[17][1] - 1)*dcdc_fac + k_f*sc[11];
-        J[360] -= dqdci;              /* dwdot[H2O]/d[H2O] */
-        J[366] -= dqdci;              /* dwdot[CH2*]/d[H2O] */
-        J[375] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
-        /* d()/d[CH2*] */
-        dqdci =  + k_f*sc[5];
-        J[786] -= dqdci;              /* dwdot[H2O]/d[CH2*] */
-        J[792] -= dqdci;              /* dwdot[CH2*]/d[CH2*] */
-        J[801] += dqdci;              /* dwdot[CH3OH]/d[CH2*] */
-        /* d()/d[CH4] */
-        dqdci = (TB[17][2] - 1)*dcdc_fac;
-        J[928] -= dqdci;              /* dwdot[H2O]/d[CH4] */
-        J[934] -= dqdci;              /* dwdot[CH2*]/d[CH4] */
-        J[943] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[17][3] - 1)*dcdc_fac;
-        J[999] -= dqdci;              /* dwdot[H2O]/d[CO] */
-        J[1005] -= dqdci;             /* dwdot[CH2*]/d[CO] */
-        J[1014] += dqdci;             /* dwdot[CH3OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[17][4] - 1)*dcdc_fac;
-        J[1070] -= dqdci;             /* dwdot[H2O]/d[CO2] */
-        J[1076] -= dqdci;             /* dwdot[CH2*]/d[CO2] */
-        J[1085] += dqdci;             /* dwdot[CH3OH]/d[CO2] */
-        /* d()/d[CH3OH] */
-        dqdci =  - k_r;
-        J[1425] -= dqdci;             /* dwdot[H2O]/d[CH3OH] */
-        J[1431] -= dqdci;             /* dwdot[CH2*]/d[CH3OH] */
-        J[1440] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[17][6] - 1)*dcdc_fac;
-        J[1709] -= dqdci;             /* dwdot[H2O]/d[C2H4] */
-        J[1715] -= dqdci;             /* dwdot[CH2*]/d[C2H4] */
-        J[1724] += dqdci;             /* dwdot[CH3OH]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[17][5] - 1)*dcdc_fac;
-        J[1851] -= dqdci;             /* dwdot[H2O]/d[C2H6] */
-        J[1857] -= dqdci;             /* dwdot[CH2*]/d[C2H6] */
-        J[1866] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[17][7] - 1)*dcdc_fac;
-        J[2490] -= dqdci;             /* dwdot[H2O]/d[pC3H4] */
-        J[2496] -= dqdci;             /* dwdot[CH2*]/d[pC3H4] */
-        J[2505] += dqdci;             /* dwdot[CH3OH]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[17][9] - 1)*dcdc_fac;
-        J[4407] -= dqdci;             /* dwdot[H2O]/d[C3H8] */
-        J[4413] -= dqdci;             /* dwdot[CH2*]/d[C3H8] */
-        J[4422] += dqdci;             /* dwdot[CH3OH]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[17][8] - 1)*dcdc_fac;
-        J[4620] -= dqdci;             /* dwdot[H2O]/d[C3H6] */
-        J[4626] -= dqdci;             /* dwdot[CH2*]/d[C3H6] */
-        J[4635] += dqdci;             /* dwdot[CH3OH]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[17][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[17][1]*dcdc_fac + k_f*sc[11];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac + k_f*sc[5];
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[17][2]*dcdc_fac;
-        dqdc[14] = TB[17][3]*dcdc_fac;
-        dqdc[15] = TB[17][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac - k_r;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[17][6]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[17][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[17][7]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[17][9]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[17][8]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+5] -= dqdc[k];
-            J[71*k+11] -= dqdc[k];
-            J[71*k+20] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[5] -= dcdc_fac;
+    Jmix[11] -= dcdc_fac;
+    Jmix[20] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[17][0] - 1)*dcdc_fac;
+    J[5] -= dqdci;                /* dwdot[H2O]/d[H2] */
+    J[11] -= dqdci;               /* dwdot[CH2*]/d[H2] */
+    J[20] += dqdci;               /* dwdot[CH3OH]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[17][1] - 1)*dcdc_fac + k_f*sc[11];
+    J[360] -= dqdci;              /* dwdot[H2O]/d[H2O] */
+    J[366] -= dqdci;              /* dwdot[CH2*]/d[H2O] */
+    J[375] += dqdci;              /* dwdot[CH3OH]/d[H2O] */
+    /* d()/d[CH2*] */
+    dqdci =  + k_f*sc[5];
+    J[786] -= dqdci;              /* dwdot[H2O]/d[CH2*] */
+    J[792] -= dqdci;              /* dwdot[CH2*]/d[CH2*] */
+    J[801] += dqdci;              /* dwdot[CH3OH]/d[CH2*] */
+    /* d()/d[CH4] */
+    dqdci = (TB[17][2] - 1)*dcdc_fac;
+    J[928] -= dqdci;              /* dwdot[H2O]/d[CH4] */
+    J[934] -= dqdci;              /* dwdot[CH2*]/d[CH4] */
+    J[943] += dqdci;              /* dwdot[CH3OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[17][3] - 1)*dcdc_fac;
+    J[999] -= dqdci;              /* dwdot[H2O]/d[CO] */
+    J[1005] -= dqdci;             /* dwdot[CH2*]/d[CO] */
+    J[1014] += dqdci;             /* dwdot[CH3OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[17][4] - 1)*dcdc_fac;
+    J[1070] -= dqdci;             /* dwdot[H2O]/d[CO2] */
+    J[1076] -= dqdci;             /* dwdot[CH2*]/d[CO2] */
+    J[1085] += dqdci;             /* dwdot[CH3OH]/d[CO2] */
+    /* d()/d[CH3OH] */
+    dqdci =  - k_r;
+    J[1425] -= dqdci;             /* dwdot[H2O]/d[CH3OH] */
+    J[1431] -= dqdci;             /* dwdot[CH2*]/d[CH3OH] */
+    J[1440] += dqdci;             /* dwdot[CH3OH]/d[CH3OH] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[17][6] - 1)*dcdc_fac;
+    J[1709] -= dqdci;             /* dwdot[H2O]/d[C2H4] */
+    J[1715] -= dqdci;             /* dwdot[CH2*]/d[C2H4] */
+    J[1724] += dqdci;             /* dwdot[CH3OH]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[17][5] - 1)*dcdc_fac;
+    J[1851] -= dqdci;             /* dwdot[H2O]/d[C2H6] */
+    J[1857] -= dqdci;             /* dwdot[CH2*]/d[C2H6] */
+    J[1866] += dqdci;             /* dwdot[CH3OH]/d[C2H6] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[17][7] - 1)*dcdc_fac;
+    J[2490] -= dqdci;             /* dwdot[H2O]/d[pC3H4] */
+    J[2496] -= dqdci;             /* dwdot[CH2*]/d[pC3H4] */
+    J[2505] += dqdci;             /* dwdot[CH3OH]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[17][9] - 1)*dcdc_fac;
+    J[4407] -= dqdci;             /* dwdot[H2O]/d[C3H8] */
+    J[4413] -= dqdci;             /* dwdot[CH2*]/d[C3H8] */
+    J[4422] += dqdci;             /* dwdot[CH3OH]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[17][8] - 1)*dcdc_fac;
+    J[4620] -= dqdci;             /* dwdot[H2O]/d[C3H6] */
+    J[4626] -= dqdci;             /* dwdot[CH2*]/d[C3H6] */
+    J[4635] += dqdci;             /* dwdot[CH3OH]/d[C3H6] */
     J[4975] -= dqdT; /* dwdot[H2O]/dT */
     J[4981] -= dqdT; /* dwdot[CH2*]/dT */
     J[4990] += dqdT; /* dwdot[CH3OH]/dT */
@@ -37651,11 +37388,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[18][0] - 1)*sc[0] + (TB[18][1] - 1)*sc[5] + (TB[18][2] - 1)*sc[13] + (TB[18][3] - 1)*sc[14] + (TB[18][4] - 1)*sc[15] + (TB[18][5] - 1)*sc[26] + (TB[18][6] - 1)*sc[30] + (TB[18][7] - 1)*sc[24] + (TB[18][8] - 1)*sc[35] + (TB[18][9] - 1)*sc[65] + (TB[18][10] - 1)*sc[62];
+    alpha = (memcmp(TB[18], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[18][0] - 1)*sc[0] + (TB[18][1] - 1)*sc[5] + (TB[18][2] - 1)*sc[13] + (TB[18][3] - 1)*sc[14] + (TB[18][4] - 1)*sc[15] + (TB[18][5] - 1)*sc[26] + (TB[18][6] - 1)*sc[30] + (TB[18][7] - 1)*sc[24] + (TB[18][8] - 1)*sc[35] + (TB[18][9] - 1)*sc[65] + (TB[18][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[12]*sc[12];
-    k_f = prefactor_units[18] * fwd_A[18]
-                * exp(fwd_beta[18] * tc[0] - activation_units[18] * fwd_Ea[18] * invT);
+    k_f = k_f_s[18];
     dlnkfdT = fwd_beta[18] * invT + activation_units[18] * fwd_Ea[18] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[18] * exp(low_beta[18] * tc[0] - activation_units[18] * low_Ea[18] * invT);
@@ -37671,16 +37407,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[18] == 4 ? exp(-troe_Tss[18] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[18]) > 1.e-100 ? -Fcent1/troe_Tsss[18] : 0.)
+      + (fabs(troe_Ts[18]) > 1.e-100 ? -Fcent2/troe_Ts[18] : 0.)
+      + (troe_len[18] == 4 ? Fcent3*troe_Tss[18]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[18]) > 1.e-100 ? -Fcent1/troe_Tsss[18] : 0.)
-      + (fabs(troe_Ts[18]) > 1.e-100 ? -Fcent2/troe_Ts[18] : 0.)
-      + (troe_len[18] == 4 ? Fcent3*troe_Tss[18]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -37688,7 +37424,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[26];
-    Kc = refCinv * exp(2*g_RT[12] - g_RT[26]);
+    Kc = Kc_s[18];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[12]) + (h_RT[26]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37705,132 +37441,57 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[18][0] - 1)*dcdc_fac;
-        J[12] += -2 * dqdci;          /* dwdot[CH3]/d[H2] */
-        J[26] += dqdci;               /* dwdot[C2H6]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[18][1] - 1)*dcdc_fac;
-        J[367] += -2 * dqdci;         /* dwdot[CH3]/d[H2O] */
-        J[381] += dqdci;              /* dwdot[C2H6]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*2*sc[12];
-        J[864] += -2 * dqdci;         /* dwdot[CH3]/d[CH3] */
-        J[878] += dqdci;              /* dwdot[C2H6]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[18][2] - 1)*dcdc_fac;
-        J[935] += -2 * dqdci;         /* dwdot[CH3]/d[CH4] */
-        J[949] += dqdci;              /* dwdot[C2H6]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[18][3] - 1)*dcdc_fac;
-        J[1006] += -2 * dqdci;        /* dwdot[CH3]/d[CO] */
-        J[1020] += dqdci;             /* dwdot[C2H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[18][4] - 1)*dcdc_fac;
-        J[1077] += -2 * dqdci;        /* dwdot[CH3]/d[CO2] */
-        J[1091] += dqdci;             /* dwdot[C2H6]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[18][7] - 1)*dcdc_fac;
-        J[1716] += -2 * dqdci;        /* dwdot[CH3]/d[C2H4] */
-        J[1730] += dqdci;             /* dwdot[C2H6]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[18][5] - 1)*dcdc_fac - k_r;
-        J[1858] += -2 * dqdci;        /* dwdot[CH3]/d[C2H6] */
-        J[1872] += dqdci;             /* dwdot[C2H6]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[18][6] - 1)*dcdc_fac;
-        J[2142] += -2 * dqdci;        /* dwdot[CH3]/d[AR] */
-        J[2156] += dqdci;             /* dwdot[C2H6]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[18][8] - 1)*dcdc_fac;
-        J[2497] += -2 * dqdci;        /* dwdot[CH3]/d[pC3H4] */
-        J[2511] += dqdci;             /* dwdot[C2H6]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[18][10] - 1)*dcdc_fac;
-        J[4414] += -2 * dqdci;        /* dwdot[CH3]/d[C3H8] */
-        J[4428] += dqdci;             /* dwdot[C2H6]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[18][9] - 1)*dcdc_fac;
-        J[4627] += -2 * dqdci;        /* dwdot[CH3]/d[C3H6] */
-        J[4641] += dqdci;             /* dwdot[C2H6]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[18][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[18][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*2*sc[12];
-        dqdc[13] = TB[18][2]*dcdc_fac;
-        dqdc[14] = TB[18][3]*dcdc_fac;
-        dqdc[15] = TB[18][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[18][7]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[18][5]*dcdc_fac - k_r;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[18][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[18][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[18][10]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[18][9]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+12] += -2 * dqdc[k];
-            J[71*k+26] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[12] += -2 * dcdc_fac;
+    Jmix[26] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[18][0] - 1)*dcdc_fac;
+    J[12] += -2 * dqdci;          /* dwdot[CH3]/d[H2] */
+    J[26] += dqdci;               /* dwdot[C2H6]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[18][1] - 1)*dcdc_fac;
+    J[367] += -2 * dqdci;         /* dwdot[CH3]/d[H2O] */
+    J[381] += dqdci;              /* dwdot[C2H6]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*2*sc[12];
+    J[864] += -2 * dqdci;         /* dwdot[CH3]/d[CH3] */
+    J[878] += dqdci;              /* dwdot[C2H6]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[18][2] - 1)*dcdc_fac;
+    J[935] += -2 * dqdci;         /* dwdot[CH3]/d[CH4] */
+    J[949] += dqdci;              /* dwdot[C2H6]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[18][3] - 1)*dcdc_fac;
+    J[1006] += -2 * dqdci;        /* dwdot[CH3]/d[CO] */
+    J[1020] += dqdci;             /* dwdot[C2H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[18][4] - 1)*dcdc_fac;
+    J[1077] += -2 * dqdci;        /* dwdot[CH3]/d[CO2] */
+    J[1091] += dqdci;             /* dwdot[C2H6]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[18][7] - 1)*dcdc_fac;
+    J[1716] += -2 * dqdci;        /* dwdot[CH3]/d[C2H4] */
+    J[1730] += dqdci;             /* dwdot[C2H6]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[18][5] - 1)*dcdc_fac - k_r;
+    J[1858] += -2 * dqdci;        /* dwdot[CH3]/d[C2H6] */
+    J[1872] += dqdci;             /* dwdot[C2H6]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[18][6] - 1)*dcdc_fac;
+    J[2142] += -2 * dqdci;        /* dwdot[CH3]/d[AR] */
+    J[2156] += dqdci;             /* dwdot[C2H6]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[18][8] - 1)*dcdc_fac;
+    J[2497] += -2 * dqdci;        /* dwdot[CH3]/d[pC3H4] */
+    J[2511] += dqdci;             /* dwdot[C2H6]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[18][10] - 1)*dcdc_fac;
+    J[4414] += -2 * dqdci;        /* dwdot[CH3]/d[C3H8] */
+    J[4428] += dqdci;             /* dwdot[C2H6]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[18][9] - 1)*dcdc_fac;
+    J[4627] += -2 * dqdci;        /* dwdot[CH3]/d[C3H6] */
+    J[4641] += dqdci;             /* dwdot[C2H6]/d[C3H6] */
     J[4982] += -2 * dqdT; /* dwdot[CH3]/dT */
     J[4996] += dqdT; /* dwdot[C2H6]/dT */
 
@@ -37838,11 +37499,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[19][0] - 1)*sc[0] + (TB[19][1] - 1)*sc[5] + (TB[19][2] - 1)*sc[13] + (TB[19][3] - 1)*sc[14] + (TB[19][4] - 1)*sc[15] + (TB[19][5] - 1)*sc[26] + (TB[19][6] - 1)*sc[30] + (TB[19][7] - 1)*sc[24] + (TB[19][8] - 1)*sc[35] + (TB[19][9] - 1)*sc[65] + (TB[19][10] - 1)*sc[62];
+    alpha = (memcmp(TB[19], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[19][0] - 1)*sc[0] + (TB[19][1] - 1)*sc[5] + (TB[19][2] - 1)*sc[13] + (TB[19][3] - 1)*sc[14] + (TB[19][4] - 1)*sc[15] + (TB[19][5] - 1)*sc[26] + (TB[19][6] - 1)*sc[30] + (TB[19][7] - 1)*sc[24] + (TB[19][8] - 1)*sc[35] + (TB[19][9] - 1)*sc[65] + (TB[19][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[24];
-    k_f = prefactor_units[19] * fwd_A[19]
-                * exp(fwd_beta[19] * tc[0] - activation_units[19] * fwd_Ea[19] * invT);
+    k_f = k_f_s[19];
     dlnkfdT = fwd_beta[19] * invT + activation_units[19] * fwd_Ea[19] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[19] * exp(low_beta[19] * tc[0] - activation_units[19] * low_Ea[19] * invT);
@@ -37858,16 +37518,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[19] == 4 ? exp(-troe_Tss[19] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[19]) > 1.e-100 ? -Fcent1/troe_Tsss[19] : 0.)
+      + (fabs(troe_Ts[19]) > 1.e-100 ? -Fcent2/troe_Ts[19] : 0.)
+      + (troe_len[19] == 4 ? Fcent3*troe_Tss[19]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[19]) > 1.e-100 ? -Fcent1/troe_Tsss[19] : 0.)
-      + (fabs(troe_Ts[19]) > 1.e-100 ? -Fcent2/troe_Ts[19] : 0.)
-      + (troe_len[19] == 4 ? Fcent3*troe_Tss[19]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -37875,7 +37535,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[0]*sc[22];
-    Kc = refC * exp(-g_RT[0] - g_RT[22] + g_RT[24]);
+    Kc = Kc_s[19];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[24]) + (h_RT[0] + h_RT[22]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -37893,145 +37553,70 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[19][0] - 1)*dcdc_fac - k_r*sc[22];
-        J[0] += dqdci;                /* dwdot[H2]/d[H2] */
-        J[22] += dqdci;               /* dwdot[C2H2]/d[H2] */
-        J[24] -= dqdci;               /* dwdot[C2H4]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[19][1] - 1)*dcdc_fac;
-        J[355] += dqdci;              /* dwdot[H2]/d[H2O] */
-        J[377] += dqdci;              /* dwdot[C2H2]/d[H2O] */
-        J[379] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[19][2] - 1)*dcdc_fac;
-        J[923] += dqdci;              /* dwdot[H2]/d[CH4] */
-        J[945] += dqdci;              /* dwdot[C2H2]/d[CH4] */
-        J[947] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[19][3] - 1)*dcdc_fac;
-        J[994] += dqdci;              /* dwdot[H2]/d[CO] */
-        J[1016] += dqdci;             /* dwdot[C2H2]/d[CO] */
-        J[1018] -= dqdci;             /* dwdot[C2H4]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[19][4] - 1)*dcdc_fac;
-        J[1065] += dqdci;             /* dwdot[H2]/d[CO2] */
-        J[1087] += dqdci;             /* dwdot[C2H2]/d[CO2] */
-        J[1089] -= dqdci;             /* dwdot[C2H4]/d[CO2] */
-        /* d()/d[C2H2] */
-        dqdci =  - k_r*sc[0];
-        J[1562] += dqdci;             /* dwdot[H2]/d[C2H2] */
-        J[1584] += dqdci;             /* dwdot[C2H2]/d[C2H2] */
-        J[1586] -= dqdci;             /* dwdot[C2H4]/d[C2H2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[19][7] - 1)*dcdc_fac + k_f;
-        J[1704] += dqdci;             /* dwdot[H2]/d[C2H4] */
-        J[1726] += dqdci;             /* dwdot[C2H2]/d[C2H4] */
-        J[1728] -= dqdci;             /* dwdot[C2H4]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[19][5] - 1)*dcdc_fac;
-        J[1846] += dqdci;             /* dwdot[H2]/d[C2H6] */
-        J[1868] += dqdci;             /* dwdot[C2H2]/d[C2H6] */
-        J[1870] -= dqdci;             /* dwdot[C2H4]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[19][6] - 1)*dcdc_fac;
-        J[2130] += dqdci;             /* dwdot[H2]/d[AR] */
-        J[2152] += dqdci;             /* dwdot[C2H2]/d[AR] */
-        J[2154] -= dqdci;             /* dwdot[C2H4]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[19][8] - 1)*dcdc_fac;
-        J[2485] += dqdci;             /* dwdot[H2]/d[pC3H4] */
-        J[2507] += dqdci;             /* dwdot[C2H2]/d[pC3H4] */
-        J[2509] -= dqdci;             /* dwdot[C2H4]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[19][10] - 1)*dcdc_fac;
-        J[4402] += dqdci;             /* dwdot[H2]/d[C3H8] */
-        J[4424] += dqdci;             /* dwdot[C2H2]/d[C3H8] */
-        J[4426] -= dqdci;             /* dwdot[C2H4]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[19][9] - 1)*dcdc_fac;
-        J[4615] += dqdci;             /* dwdot[H2]/d[C3H6] */
-        J[4637] += dqdci;             /* dwdot[C2H2]/d[C3H6] */
-        J[4639] -= dqdci;             /* dwdot[C2H4]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[19][0]*dcdc_fac - k_r*sc[22];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[19][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[19][2]*dcdc_fac;
-        dqdc[14] = TB[19][3]*dcdc_fac;
-        dqdc[15] = TB[19][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac - k_r*sc[0];
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[19][7]*dcdc_fac + k_f;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[19][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[19][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[19][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[19][10]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[19][9]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+0] += dqdc[k];
-            J[71*k+22] += dqdc[k];
-            J[71*k+24] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += dcdc_fac;
+    Jmix[22] += dcdc_fac;
+    Jmix[24] -= dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[19][0] - 1)*dcdc_fac - k_r*sc[22];
+    J[0] += dqdci;                /* dwdot[H2]/d[H2] */
+    J[22] += dqdci;               /* dwdot[C2H2]/d[H2] */
+    J[24] -= dqdci;               /* dwdot[C2H4]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[19][1] - 1)*dcdc_fac;
+    J[355] += dqdci;              /* dwdot[H2]/d[H2O] */
+    J[377] += dqdci;              /* dwdot[C2H2]/d[H2O] */
+    J[379] -= dqdci;              /* dwdot[C2H4]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[19][2] - 1)*dcdc_fac;
+    J[923] += dqdci;              /* dwdot[H2]/d[CH4] */
+    J[945] += dqdci;              /* dwdot[C2H2]/d[CH4] */
+    J[947] -= dqdci;              /* dwdot[C2H4]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[19][3] - 1)*dcdc_fac;
+    J[994] += dqdci;              /* dwdot[H2]/d[CO] */
+    J[1016] += dqdci;             /* dwdot[C2H2]/d[CO] */
+    J[1018] -= dqdci;             /* dwdot[C2H4]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[19][4] - 1)*dcdc_fac;
+    J[1065] += dqdci;             /* dwdot[H2]/d[CO2] */
+    J[1087] += dqdci;             /* dwdot[C2H2]/d[CO2] */
+    J[1089] -= dqdci;             /* dwdot[C2H4]/d[CO2] */
+    /* d()/d[C2H2] */
+    dqdci =  - k_r*sc[0];
+    J[1562] += dqdci;             /* dwdot[H2]/d[C2H2] */
+    J[1584] += dqdci;             /* dwdot[C2H2]/d[C2H2] */
+    J[1586] -= dqdci;             /* dwdot[C2H4]/d[C2H2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[19][7] - 1)*dcdc_fac + k_f;
+    J[1704] += dqdci;             /* dwdot[H2]/d[C2H4] */
+    J[1726] += dqdci;             /* dwdot[C2H2]/d[C2H4] */
+    J[1728] -= dqdci;             /* dwdot[C2H4]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[19][5] - 1)*dcdc_fac;
+    J[1846] += dqdci;             /* dwdot[H2]/d[C2H6] */
+    J[1868] += dqdci;             /* dwdot[C2H2]/d[C2H6] */
+    J[1870] -= dqdci;             /* dwdot[C2H4]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[19][6] - 1)*dcdc_fac;
+    J[2130] += dqdci;             /* dwdot[H2]/d[AR] */
+    J[2152] += dqdci;             /* dwdot[C2H2]/d[AR] */
+    J[2154] -= dqdci;             /* dwdot[C2H4]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[19][8] - 1)*dcdc_fac;
+    J[2485] += dqdci;             /* dwdot[H2]/d[pC3H4] */
+    J[2507] += dqdci;             /* dwdot[C2H2]/d[pC3H4] */
+    J[2509] -= dqdci;             /* dwdot[C2H4]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[19][10] - 1)*dcdc_fac;
+    J[4402] += dqdci;             /* dwdot[H2]/d[C3H8] */
+    J[4424] += dqdci;             /* dwdot[C2H2]/d[C3H8] */
+    J[4426] -= dqdci;             /* dwdot[C2H4]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[19][9] - 1)*dcdc_fac;
+    J[4615] += dqdci;             /* dwdot[H2]/d[C3H6] */
+    J[4637] += dqdci;             /* dwdot[C2H2]/d[C3H6] */
+    J[4639] -= dqdci;             /* dwdot[C2H4]/d[C3H6] */
     J[4970] += dqdT; /* dwdot[H2]/dT */
     J[4992] += dqdT; /* dwdot[C2H2]/dT */
     J[4994] -= dqdT; /* dwdot[C2H4]/dT */
@@ -38040,11 +37625,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[20][0] - 1)*sc[0] + (TB[20][1] - 1)*sc[5] + (TB[20][2] - 1)*sc[13] + (TB[20][3] - 1)*sc[14] + (TB[20][4] - 1)*sc[15] + (TB[20][5] - 1)*sc[26] + (TB[20][6] - 1)*sc[30] + (TB[20][7] - 1)*sc[24] + (TB[20][8] - 1)*sc[35] + (TB[20][9] - 1)*sc[65] + (TB[20][10] - 1)*sc[62];
+    alpha = (memcmp(TB[20], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[20][0] - 1)*sc[0] + (TB[20][1] - 1)*sc[5] + (TB[20][2] - 1)*sc[13] + (TB[20][3] - 1)*sc[14] + (TB[20][4] - 1)*sc[15] + (TB[20][5] - 1)*sc[26] + (TB[20][6] - 1)*sc[30] + (TB[20][7] - 1)*sc[24] + (TB[20][8] - 1)*sc[35] + (TB[20][9] - 1)*sc[65] + (TB[20][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[0]*sc[9];
-    k_f = prefactor_units[20] * fwd_A[20]
-                * exp(fwd_beta[20] * tc[0] - activation_units[20] * fwd_Ea[20] * invT);
+    k_f = k_f_s[20];
     dlnkfdT = fwd_beta[20] * invT + activation_units[20] * fwd_Ea[20] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[20] * exp(low_beta[20] * tc[0] - activation_units[20] * low_Ea[20] * invT);
@@ -38060,16 +37644,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[20] == 4 ? exp(-troe_Tss[20] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[20]) > 1.e-100 ? -Fcent1/troe_Tsss[20] : 0.)
+      + (fabs(troe_Ts[20]) > 1.e-100 ? -Fcent2/troe_Ts[20] : 0.)
+      + (troe_len[20] == 4 ? Fcent3*troe_Tss[20]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[20]) > 1.e-100 ? -Fcent1/troe_Tsss[20] : 0.)
-      + (fabs(troe_Ts[20]) > 1.e-100 ? -Fcent2/troe_Ts[20] : 0.)
-      + (troe_len[20] == 4 ? Fcent3*troe_Tss[20]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -38077,7 +37661,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[12];
-    Kc = refCinv * exp(g_RT[0] + g_RT[9] - g_RT[12]);
+    Kc = Kc_s[20];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[9]) + (h_RT[12]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38095,150 +37679,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[20][0] - 1)*dcdc_fac + k_f*sc[9];
-        J[0] -= dqdci;                /* dwdot[H2]/d[H2] */
-        J[9] -= dqdci;                /* dwdot[CH]/d[H2] */
-        J[12] += dqdci;               /* dwdot[CH3]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[20][1] - 1)*dcdc_fac;
-        J[355] -= dqdci;              /* dwdot[H2]/d[H2O] */
-        J[364] -= dqdci;              /* dwdot[CH]/d[H2O] */
-        J[367] += dqdci;              /* dwdot[CH3]/d[H2O] */
-        /* d()/d[CH] */
-        dqdci =  + k_f*sc[0];
-        J[639] -= dqdci;              /* dwdot[H2]/d[CH] */
-        J[648] -= dqdci;              /* dwdot[CH]/d[CH] */
-        J[651] += dqdci;              /* dwdot[CH3]/d[CH] */
-        /* d()/d[CH3] */
-        dqdci =  - k_r;
-        J[852] -= dqdci;              /* dwdot[H2]/d[CH3] */
-        J[861] -= dqdci;              /* dwdot[CH]/d[CH3] */
-        J[864] += dqdci;              /* dwdot[CH3]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[20][2] - 1)*dcdc_fac;
-        J[923] -= dqdci;              /* dwdot[H2]/d[CH4] */
-        J[932] -= dqdci;              /* dwdot[CH]/d[CH4] */
-        J[935] += dqdci;              /* dwdot[CH3]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[20][3] - 1)*dcdc_fac;
-        J[994] -= dqdci;              /* dwdot[H2]/d[CO] */
-        J[1003] -= dqdci;             /* dwdot[CH]/d[CO] */
-        J[1006] += dqdci;             /* dwdot[CH3]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[20][4] - 1)*dcdc_fac;
-        J[1065] -= dqdci;             /* dwdot[H2]/d[CO2] */
-        J[1074] -= dqdci;             /* dwdot[CH]/d[CO2] */
-        J[1077] += dqdci;             /* dwdot[CH3]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[20][7] - 1)*dcdc_fac;
-        J[1704] -= dqdci;             /* dwdot[H2]/d[C2H4] */
-        J[1713] -= dqdci;             /* dwdot[CH]/d[C2H4] */
-        J[1716] += dqdci;             /* dwdot[CH3]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[20][5] - 1)*dcdc_fac;
-        J[1846] -= dqdci;             /* dwdot[H2]/d[C2H6] */
-        J[1855] -= dqdci;             /* dwdot[CH]/d[C2H6] */
-        J[1858] += dqdci;             /* dwdot[CH3]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[20][6] - 1)*dcdc_fac;
-        J[2130] -= dqdci;             /* dwdot[H2]/d[AR] */
-        J[2139] -= dqdci;             /* dwdot[CH]/d[AR] */
-        J[2142] += dqdci;             /* dwdot[CH3]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[20][8] - 1)*dcdc_fac;
-        J[2485] -= dqdci;             /* dwdot[H2]/d[pC3H4] */
-        J[2494] -= dqdci;             /* dwdot[CH]/d[pC3H4] */
-        J[2497] += dqdci;             /* dwdot[CH3]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[20][10] - 1)*dcdc_fac;
-        J[4402] -= dqdci;             /* dwdot[H2]/d[C3H8] */
-        J[4411] -= dqdci;             /* dwdot[CH]/d[C3H8] */
-        J[4414] += dqdci;             /* dwdot[CH3]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[20][9] - 1)*dcdc_fac;
-        J[4615] -= dqdci;             /* dwdot[H2]/d[C3H6] */
-        J[4624] -= dqdci;             /* dwdot[CH]/d[C3H6] */
-        J[4627] += dqdci;             /* dwdot[CH3]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[20][0]*dcdc_fac + k_f*sc[9];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[20][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac + k_f*sc[0];
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac - k_r;
-        dqdc[13] = TB[20][2]*dcdc_fac;
-        dqdc[14] = TB[20][3]*dcdc_fac;
-        dqdc[15] = TB[20][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[20][7]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[20][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[20][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[20][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[20][10]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[20][9]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+0] -= dqdc[k];
-            J[71*k+9] -= dqdc[k];
-            J[71*k+12] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] -= dcdc_fac;
+    Jmix[9] -= dcdc_fac;
+    Jmix[12] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[20][0] - 1)*dcdc_fac + k_f*sc[9];
+    J[0] -= dqdci;                /* dwdot[H2]/d[H2] */
+    J[9] -= dqdci;                /* dwdot[CH]/d[H2] */
+    J[12] += dqdci;               /* dwdot[CH3]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[20][1] - 1)*dcdc_fac;
+    J[355] -= dqdci;              /* dwdot[H2]/d[H2O] */
+    J[364] -= dqdci;              /* dwdot[CH]/d[H2O] */
+    J[367] += dqdci;              /* dwdot[CH3]/d[H2O] */
+    /* d()/d[CH] */
+    dqdci =  + k_f*sc[0];
+    J[639] -= dqdci;              /* dwdot[H2]/d[CH] */
+    J[648] -= dqdci;              /* dwdot[CH]/d[CH] */
+    J[651] += dqdci;              /* dwdot[CH3]/d[CH] */
+    /* d()/d[CH3] */
+    dqdci =  - k_r;
+    J[852] -= dqdci;              /* dwdot[H2]/d[CH3] */
+    J[861] -= dqdci;              /* dwdot[CH]/d[CH3] */
+    J[864] += dqdci;              /* dwdot[CH3]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[20][2] - 1)*dcdc_fac;
+    J[923] -= dqdci;              /* dwdot[H2]/d[CH4] */
+    J[932] -= dqdci;              /* dwdot[CH]/d[CH4] */
+    J[935] += dqdci;              /* dwdot[CH3]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[20][3] - 1)*dcdc_fac;
+    J[994] -= dqdci;              /* dwdot[H2]/d[CO] */
+    J[1003] -= dqdci;             /* dwdot[CH]/d[CO] */
+    J[1006] += dqdci;             /* dwdot[CH3]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[20][4] - 1)*dcdc_fac;
+    J[1065] -= dqdci;             /* dwdot[H2]/d[CO2] */
+    J[1074] -= dqdci;             /* dwdot[CH]/d[CO2] */
+    J[1077] += dqdci;             /* dwdot[CH3]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[20][7] - 1)*dcdc_fac;
+    J[1704] -= dqdci;             /* dwdot[H2]/d[C2H4] */
+    J[1713] -= dqdci;             /* dwdot[CH]/d[C2H4] */
+    J[1716] += dqdci;             /* dwdot[CH3]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[20][5] - 1)*dcdc_fac;
+    J[1846] -= dqdci;             /* dwdot[H2]/d[C2H6] */
+    J[1855] -= dqdci;             /* dwdot[CH]/d[C2H6] */
+    J[1858] += dqdci;             /* dwdot[CH3]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[20][6] - 1)*dcdc_fac;
+    J[2130] -= dqdci;             /* dwdot[H2]/d[AR] */
+    J[2139] -= dqdci;             /* dwdot[CH]/d[AR] */
+    J[2142] += dqdci;             /* dwdot[CH3]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[20][8] - 1)*dcdc_fac;
+    J[2485] -= dqdci;             /* dwdot[H2]/d[pC3H4] */
+    J[2494] -= dqdci;             /* dwdot[CH]/d[pC3H4] */
+    J[2497] += dqdci;             /* dwdot[CH3]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[20][10] - 1)*dcdc_fac;
+    J[4402] -= dqdci;             /* dwdot[H2]/d[C3H8] */
+    J[4411] -= dqdci;             /* dwdot[CH]/d[C3H8] */
+    J[4414] += dqdci;             /* dwdot[CH3]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[20][9] - 1)*dcdc_fac;
+    J[4615] -= dqdci;             /* dwdot[H2]/d[C3H6] */
+    J[4624] -= dqdci;             /* dwdot[CH]/d[C3H6] */
+    J[4627] += dqdci;             /* dwdot[CH3]/d[C3H6] */
     J[4970] -= dqdT; /* dwdot[H2]/dT */
     J[4979] -= dqdT; /* dwdot[CH]/dT */
     J[4982] += dqdT; /* dwdot[CH3]/dT */
@@ -38247,11 +37756,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[21][0] - 1)*sc[0] + (TB[21][1] - 1)*sc[5] + (TB[21][2] - 1)*sc[13] + (TB[21][3] - 1)*sc[14] + (TB[21][4] - 1)*sc[15] + (TB[21][5] - 1)*sc[26] + (TB[21][6] - 1)*sc[30] + (TB[21][7] - 1)*sc[24] + (TB[21][8] - 1)*sc[35] + (TB[21][9] - 1)*sc[65] + (TB[21][10] - 1)*sc[62];
+    alpha = (memcmp(TB[21], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[21][0] - 1)*sc[0] + (TB[21][1] - 1)*sc[5] + (TB[21][2] - 1)*sc[13] + (TB[21][3] - 1)*sc[14] + (TB[21][4] - 1)*sc[15] + (TB[21][5] - 1)*sc[26] + (TB[21][6] - 1)*sc[30] + (TB[21][7] - 1)*sc[24] + (TB[21][8] - 1)*sc[35] + (TB[21][9] - 1)*sc[65] + (TB[21][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[1]*sc[28];
-    k_f = prefactor_units[21] * fwd_A[21]
-                * exp(fwd_beta[21] * tc[0] - activation_units[21] * fwd_Ea[21] * invT);
+    k_f = k_f_s[21];
     dlnkfdT = fwd_beta[21] * invT + activation_units[21] * fwd_Ea[21] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[21] * exp(low_beta[21] * tc[0] - activation_units[21] * low_Ea[21] * invT);
@@ -38267,16 +37775,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[21] == 4 ? exp(-troe_Tss[21] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[21]) > 1.e-100 ? -Fcent1/troe_Tsss[21] : 0.)
+      + (fabs(troe_Ts[21]) > 1.e-100 ? -Fcent2/troe_Ts[21] : 0.)
+      + (troe_len[21] == 4 ? Fcent3*troe_Tss[21]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[21]) > 1.e-100 ? -Fcent1/troe_Tsss[21] : 0.)
-      + (fabs(troe_Ts[21]) > 1.e-100 ? -Fcent2/troe_Ts[21] : 0.)
-      + (troe_len[21] == 4 ? Fcent3*troe_Tss[21]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -38284,7 +37792,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[32];
-    Kc = refCinv * exp(g_RT[1] + g_RT[28] - g_RT[32]);
+    Kc = Kc_s[21];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[28]) + (h_RT[32]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38302,155 +37810,80 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[21][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[28] -= dqdci;               /* dwdot[CH2CO]/d[H2] */
-        J[32] += dqdci;               /* dwdot[CH2CHO]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[28];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[99] -= dqdci;               /* dwdot[CH2CO]/d[H] */
-        J[103] += dqdci;              /* dwdot[CH2CHO]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[21][1] - 1)*dcdc_fac;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[383] -= dqdci;              /* dwdot[CH2CO]/d[H2O] */
-        J[387] += dqdci;              /* dwdot[CH2CHO]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[21][2] - 1)*dcdc_fac;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[951] -= dqdci;              /* dwdot[CH2CO]/d[CH4] */
-        J[955] += dqdci;              /* dwdot[CH2CHO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[21][3] - 1)*dcdc_fac;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[1022] -= dqdci;             /* dwdot[CH2CO]/d[CO] */
-        J[1026] += dqdci;             /* dwdot[CH2CHO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[21][4] - 1)*dcdc_fac;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1093] -= dqdci;             /* dwdot[CH2CO]/d[CO2] */
-        J[1097] += dqdci;             /* dwdot[CH2CHO]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[21][7] - 1)*dcdc_fac;
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1732] -= dqdci;             /* dwdot[CH2CO]/d[C2H4] */
-        J[1736] += dqdci;             /* dwdot[CH2CHO]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[21][5] - 1)*dcdc_fac;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1874] -= dqdci;             /* dwdot[CH2CO]/d[C2H6] */
-        J[1878] += dqdci;             /* dwdot[CH2CHO]/d[C2H6] */
-        /* d()/d[CH2CO] */
-        dqdci =  + k_f*sc[1];
-        J[1989] -= dqdci;             /* dwdot[H]/d[CH2CO] */
-        J[2016] -= dqdci;             /* dwdot[CH2CO]/d[CH2CO] */
-        J[2020] += dqdci;             /* dwdot[CH2CHO]/d[CH2CO] */
-        /* d()/d[AR] */
-        dqdci = (TB[21][6] - 1)*dcdc_fac;
-        J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2158] -= dqdci;             /* dwdot[CH2CO]/d[AR] */
-        J[2162] += dqdci;             /* dwdot[CH2CHO]/d[AR] */
-        /* d()/d[CH2CHO] */
-        dqdci =  - k_r;
-        J[2273] -= dqdci;             /* dwdot[H]/d[CH2CHO] */
-        J[2300] -= dqdci;             /* dwdot[CH2CO]/d[CH2CHO] */
-        J[2304] += dqdci;             /* dwdot[CH2CHO]/d[CH2CHO] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[21][8] - 1)*dcdc_fac;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2513] -= dqdci;             /* dwdot[CH2CO]/d[pC3H4] */
-        J[2517] += dqdci;             /* dwdot[CH2CHO]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[21][10] - 1)*dcdc_fac;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4430] -= dqdci;             /* dwdot[CH2CO]/d[C3H8] */
-        J[4434] += dqdci;             /* dwdot[CH2CHO]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[21][9] - 1)*dcdc_fac;
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4643] -= dqdci;             /* dwdot[CH2CO]/d[C3H6] */
-        J[4647] += dqdci;             /* dwdot[CH2CHO]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[21][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[28];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[21][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[21][2]*dcdc_fac;
-        dqdc[14] = TB[21][3]*dcdc_fac;
-        dqdc[15] = TB[21][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[21][7]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[21][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac + k_f*sc[1];
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[21][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac - k_r;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[21][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[21][10]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[21][9]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+28] -= dqdc[k];
-            J[71*k+32] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[28] -= dcdc_fac;
+    Jmix[32] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[21][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[28] -= dqdci;               /* dwdot[CH2CO]/d[H2] */
+    J[32] += dqdci;               /* dwdot[CH2CHO]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[28];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[99] -= dqdci;               /* dwdot[CH2CO]/d[H] */
+    J[103] += dqdci;              /* dwdot[CH2CHO]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[21][1] - 1)*dcdc_fac;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[383] -= dqdci;              /* dwdot[CH2CO]/d[H2O] */
+    J[387] += dqdci;              /* dwdot[CH2CHO]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[21][2] - 1)*dcdc_fac;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[951] -= dqdci;              /* dwdot[CH2CO]/d[CH4] */
+    J[955] += dqdci;              /* dwdot[CH2CHO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[21][3] - 1)*dcdc_fac;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[1022] -= dqdci;             /* dwdot[CH2CO]/d[CO] */
+    J[1026] += dqdci;             /* dwdot[CH2CHO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[21][4] - 1)*dcdc_fac;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1093] -= dqdci;             /* dwdot[CH2CO]/d[CO2] */
+    J[1097] += dqdci;             /* dwdot[CH2CHO]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[21][7] - 1)*dcdc_fac;
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1732] -= dqdci;             /* dwdot[CH2CO]/d[C2H4] */
+    J[1736] += dqdci;             /* dwdot[CH2CHO]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[21][5] - 1)*dcdc_fac;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1874] -= dqdci;             /* dwdot[CH2CO]/d[C2H6] */
+    J[1878] += dqdci;             /* dwdot[CH2CHO]/d[C2H6] */
+    /* d()/d[CH2CO] */
+    dqdci =  + k_f*sc[1];
+    J[1989] -= dqdci;             /* dwdot[H]/d[CH2CO] */
+    J[2016] -= dqdci;             /* dwdot[CH2CO]/d[CH2CO] */
+    J[2020] += dqdci;             /* dwdot[CH2CHO]/d[CH2CO] */
+    /* d()/d[AR] */
+    dqdci = (TB[21][6] - 1)*dcdc_fac;
+    J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2158] -= dqdci;             /* dwdot[CH2CO]/d[AR] */
+    J[2162] += dqdci;             /* dwdot[CH2CHO]/d[AR] */
+    /* d()/d[CH2CHO] */
+    dqdci =  - k_r;
+    J[2273] -= dqdci;             /* dwdot[H]/d[CH2CHO] */
+    J[2300] -= dqdci;             /* dwdot[CH2CO]/d[CH2CHO] */
+    J[2304] += dqdci;             /* dwdot[CH2CHO]/d[CH2CHO] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[21][8] - 1)*dcdc_fac;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2513] -= dqdci;             /* dwdot[CH2CO]/d[pC3H4] */
+    J[2517] += dqdci;             /* dwdot[CH2CHO]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[21][10] - 1)*dcdc_fac;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4430] -= dqdci;             /* dwdot[CH2CO]/d[C3H8] */
+    J[4434] += dqdci;             /* dwdot[CH2CHO]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[21][9] - 1)*dcdc_fac;
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4643] -= dqdci;             /* dwdot[CH2CO]/d[C3H6] */
+    J[4647] += dqdci;             /* dwdot[CH2CHO]/d[C3H6] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[4998] -= dqdT; /* dwdot[CH2CO]/dT */
     J[5002] += dqdT; /* dwdot[CH2CHO]/dT */
@@ -38459,14 +37892,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[22][0] - 1)*sc[0] + (TB[22][1] - 1)*sc[5] + (TB[22][2] - 1)*sc[13] + (TB[22][3] - 1)*sc[14] + (TB[22][4] - 1)*sc[15] + (TB[22][5] - 1)*sc[26] + (TB[22][6] - 1)*sc[30] + (TB[22][7] - 1)*sc[24] + (TB[22][8] - 1)*sc[35] + (TB[22][9] - 1)*sc[65] + (TB[22][10] - 1)*sc[62];
+    alpha = (memcmp(TB[22], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[22][0] - 1)*sc[0] + (TB[22][1] - 1)*sc[5] + (TB[22][2] - 1)*sc[13] + (TB[22][3] - 1)*sc[14] + (TB[22][4] - 1)*sc[15] + (TB[22][5] - 1)*sc[26] + (TB[22][6] - 1)*sc[30] + (TB[22][7] - 1)*sc[24] + (TB[22][8] - 1)*sc[35] + (TB[22][9] - 1)*sc[65] + (TB[22][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[1]*sc[63];
-    k_f = prefactor_units[22] * fwd_A[22]
-                * exp(fwd_beta[22] * tc[0] - activation_units[22] * fwd_Ea[22] * invT);
+    k_f = k_f_s[22];
     dlnkfdT = fwd_beta[22] * invT + activation_units[22] * fwd_Ea[22] * invT2;
     /* pressure-fall-off */
-    k_0 = low_A[22] * exp(low_beta[22] * tc[0] - activation_units[22] * low_Ea[22] * invT);
+    x_0 = low_beta[22] * tc[0] - activation_units[22] * low_Ea[22] * invT;
+    x_0_s[0] = x_0;
+    e_0_s[0] = exp(x_0);
+    k_0 = low_A[22] * e_0_s[0];
     Pr = phase_units[22] * alpha / k_f * k_0;
     fPr = Pr / (1.0+Pr);
     dlnk0dT = low_beta[22] * invT + activation_units[22] * low_Ea[22] * invT2;
@@ -38479,16 +37914,18 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[22] == 4 ? exp(-troe_Tss[22] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[22]) > 1.e-100 ? -Fcent1/troe_Tsss[22] : 0.)
+      + (fabs(troe_Ts[22]) > 1.e-100 ? -Fcent2/troe_Ts[22] : 0.)
+      + (troe_len[22] == 4 ? Fcent3*troe_Tss[22]*invT2 : 0.) );
+    logFcent_s[0] = logFcent;
+    dlogFcentdT_s[0] = dlogFcentdT;
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[22]) > 1.e-100 ? -Fcent1/troe_Tsss[22] : 0.)
-      + (fabs(troe_Ts[22]) > 1.e-100 ? -Fcent2/troe_Ts[22] : 0.)
-      + (troe_len[22] == 4 ? Fcent3*troe_Tss[22]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -38496,7 +37933,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[62];
-    Kc = refCinv * exp(g_RT[1] - g_RT[62] + g_RT[63]);
+    Kc = Kc_s[22];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[63]) + (h_RT[62]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38514,150 +37951,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[22][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[62] += dqdci;               /* dwdot[C3H8]/d[H2] */
-        J[63] -= dqdci;               /* dwdot[nC3H7]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[63];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[133] += dqdci;              /* dwdot[C3H8]/d[H] */
-        J[134] -= dqdci;              /* dwdot[nC3H7]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[22][1] - 1)*dcdc_fac;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[417] += dqdci;              /* dwdot[C3H8]/d[H2O] */
-        J[418] -= dqdci;              /* dwdot[nC3H7]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[22][2] - 1)*dcdc_fac;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[985] += dqdci;              /* dwdot[C3H8]/d[CH4] */
-        J[986] -= dqdci;              /* dwdot[nC3H7]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[22][3] - 1)*dcdc_fac;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[1056] += dqdci;             /* dwdot[C3H8]/d[CO] */
-        J[1057] -= dqdci;             /* dwdot[nC3H7]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[22][4] - 1)*dcdc_fac;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1127] += dqdci;             /* dwdot[C3H8]/d[CO2] */
-        J[1128] -= dqdci;             /* dwdot[nC3H7]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[22][7] - 1)*dcdc_fac;
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1766] += dqdci;             /* dwdot[C3H8]/d[C2H4] */
-        J[1767] -= dqdci;             /* dwdot[nC3H7]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[22][5] - 1)*dcdc_fac;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1908] += dqdci;             /* dwdot[C3H8]/d[C2H6] */
-        J[1909] -= dqdci;             /* dwdot[nC3H7]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[22][6] - 1)*dcdc_fac;
-        J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2192] += dqdci;             /* dwdot[C3H8]/d[AR] */
-        J[2193] -= dqdci;             /* dwdot[nC3H7]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[22][8] - 1)*dcdc_fac;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2547] += dqdci;             /* dwdot[C3H8]/d[pC3H4] */
-        J[2548] -= dqdci;             /* dwdot[nC3H7]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[22][10] - 1)*dcdc_fac - k_r;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4464] += dqdci;             /* dwdot[C3H8]/d[C3H8] */
-        J[4465] -= dqdci;             /* dwdot[nC3H7]/d[C3H8] */
-        /* d()/d[nC3H7] */
-        dqdci =  + k_f*sc[1];
-        J[4474] -= dqdci;             /* dwdot[H]/d[nC3H7] */
-        J[4535] += dqdci;             /* dwdot[C3H8]/d[nC3H7] */
-        J[4536] -= dqdci;             /* dwdot[nC3H7]/d[nC3H7] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[22][9] - 1)*dcdc_fac;
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4677] += dqdci;             /* dwdot[C3H8]/d[C3H6] */
-        J[4678] -= dqdci;             /* dwdot[nC3H7]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[22][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[63];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[22][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[22][2]*dcdc_fac;
-        dqdc[14] = TB[22][3]*dcdc_fac;
-        dqdc[15] = TB[22][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[22][7]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[22][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[22][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[22][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[22][10]*dcdc_fac - k_r;
-        dqdc[63] = dcdc_fac + k_f*sc[1];
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[22][9]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+62] += dqdc[k];
-            J[71*k+63] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[62] += dcdc_fac;
+    Jmix[63] -= dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[22][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[62] += dqdci;               /* dwdot[C3H8]/d[H2] */
+    J[63] -= dqdci;               /* dwdot[nC3H7]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[63];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[133] += dqdci;              /* dwdot[C3H8]/d[H] */
+    J[134] -= dqdci;              /* dwdot[nC3H7]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[22][1] - 1)*dcdc_fac;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[417] += dqdci;              /* dwdot[C3H8]/d[H2O] */
+    J[418] -= dqdci;              /* dwdot[nC3H7]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[22][2] - 1)*dcdc_fac;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[985] += dqdci;              /* dwdot[C3H8]/d[CH4] */
+    J[986] -= dqdci;              /* dwdot[nC3H7]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[22][3] - 1)*dcdc_fac;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[1056] += dqdci;             /* dwdot[C3H8]/d[CO] */
+    J[1057] -= dqdci;             /* dwdot[nC3H7]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[22][4] - 1)*dcdc_fac;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1127] += dqdci;             /* dwdot[C3H8]/d[CO2] */
+    J[1128] -= dqdci;             /* dwdot[nC3H7]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[22][7] - 1)*dcdc_fac;
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1766] += dqdci;             /* dwdot[C3H8]/d[C2H4] */
+    J[1767] -= dqdci;             /* dwdot[nC3H7]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[22][5] - 1)*dcdc_fac;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1908] += dqdci;             /* dwdot[C3H8]/d[C2H6] */
+    J[1909] -= dqdci;             /* dwdot[nC3H7]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[22][6] - 1)*dcdc_fac;
+    J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2192] += dqdci;             /* dwdot[C3H8]/d[AR] */
+    J[2193] -= dqdci;             /* dwdot[nC3H7]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[22][8] - 1)*dcdc_fac;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2547] += dqdci;             /* dwdot[C3H8]/d[pC3H4] */
+    J[2548] -= dqdci;             /* dwdot[nC3H7]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[22][10] - 1)*dcdc_fac - k_r;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4464] += dqdci;             /* dwdot[C3H8]/d[C3H8] */
+    J[4465] -= dqdci;             /* dwdot[nC3H7]/d[C3H8] */
+    /* d()/d[nC3H7] */
+    dqdci =  + k_f*sc[1];
+    J[4474] -= dqdci;             /* dwdot[H]/d[nC3H7] */
+    J[4535] += dqdci;             /* dwdot[C3H8]/d[nC3H7] */
+    J[4536] -= dqdci;             /* dwdot[nC3H7]/d[nC3H7] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[22][9] - 1)*dcdc_fac;
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4677] += dqdci;             /* dwdot[C3H8]/d[C3H6] */
+    J[4678] -= dqdci;             /* dwdot[nC3H7]/d[C3H6] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[5032] += dqdT; /* dwdot[C3H8]/dT */
     J[5033] -= dqdT; /* dwdot[nC3H7]/dT */
@@ -38666,11 +38028,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[23][0] - 1)*sc[0] + (TB[23][1] - 1)*sc[5] + (TB[23][2] - 1)*sc[13] + (TB[23][3] - 1)*sc[14] + (TB[23][4] - 1)*sc[15] + (TB[23][5] - 1)*sc[26] + (TB[23][6] - 1)*sc[30] + (TB[23][7] - 1)*sc[24] + (TB[23][8] - 1)*sc[35] + (TB[23][9] - 1)*sc[65] + (TB[23][10] - 1)*sc[62];
+    alpha = (memcmp(TB[23], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[23][0] - 1)*sc[0] + (TB[23][1] - 1)*sc[5] + (TB[23][2] - 1)*sc[13] + (TB[23][3] - 1)*sc[14] + (TB[23][4] - 1)*sc[15] + (TB[23][5] - 1)*sc[26] + (TB[23][6] - 1)*sc[30] + (TB[23][7] - 1)*sc[24] + (TB[23][8] - 1)*sc[35] + (TB[23][9] - 1)*sc[65] + (TB[23][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[1]*sc[64];
-    k_f = prefactor_units[23] * fwd_A[23]
-                * exp(fwd_beta[23] * tc[0] - activation_units[23] * fwd_Ea[23] * invT);
+    k_f = k_f_s[23];
     dlnkfdT = fwd_beta[23] * invT + activation_units[23] * fwd_Ea[23] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[23] * exp(low_beta[23] * tc[0] - activation_units[23] * low_Ea[23] * invT);
@@ -38686,16 +38047,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[23] == 4 ? exp(-troe_Tss[23] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[23]) > 1.e-100 ? -Fcent1/troe_Tsss[23] : 0.)
+      + (fabs(troe_Ts[23]) > 1.e-100 ? -Fcent2/troe_Ts[23] : 0.)
+      + (troe_len[23] == 4 ? Fcent3*troe_Tss[23]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[23]) > 1.e-100 ? -Fcent1/troe_Tsss[23] : 0.)
-      + (fabs(troe_Ts[23]) > 1.e-100 ? -Fcent2/troe_Ts[23] : 0.)
-      + (troe_len[23] == 4 ? Fcent3*troe_Tss[23]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -38703,7 +38064,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[62];
-    Kc = refCinv * exp(g_RT[1] - g_RT[62] + g_RT[64]);
+    Kc = Kc_s[23];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[64]) + (h_RT[62]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38721,150 +38082,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[23][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[62] += dqdci;               /* dwdot[C3H8]/d[H2] */
-        J[64] -= dqdci;               /* dwdot[iC3H7]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[64];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[133] += dqdci;              /* dwdot[C3H8]/d[H] */
-        J[135] -= dqdci;              /* dwdot[iC3H7]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[23][1] - 1)*dcdc_fac;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[417] += dqdci;              /* dwdot[C3H8]/d[H2O] */
-        J[419] -= dqdci;              /* dwdot[iC3H7]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[23][2] - 1)*dcdc_fac;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[985] += dqdci;              /* dwdot[C3H8]/d[CH4] */
-        J[987] -= dqdci;              /* dwdot[iC3H7]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[23][3] - 1)*dcdc_fac;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[1056] += dqdci;             /* dwdot[C3H8]/d[CO] */
-        J[1058] -= dqdci;             /* dwdot[iC3H7]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[23][4] - 1)*dcdc_fac;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1127] += dqdci;             /* dwdot[C3H8]/d[CO2] */
-        J[1129] -= dqdci;             /* dwdot[iC3H7]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[23][7] - 1)*dcdc_fac;
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1766] += dqdci;             /* dwdot[C3H8]/d[C2H4] */
-        J[1768] -= dqdci;             /* dwdot[iC3H7]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[23][5] - 1)*dcdc_fac;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1908] += dqdci;             /* dwdot[C3H8]/d[C2H6] */
-        J[1910] -= dqdci;             /* dwdot[iC3H7]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[23][6] - 1)*dcdc_fac;
-        J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2192] += dqdci;             /* dwdot[C3H8]/d[AR] */
-        J[2194] -= dqdci;             /* dwdot[iC3H7]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[23][8] - 1)*dcdc_fac;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2547] += dqdci;             /* dwdot[C3H8]/d[pC3H4] */
-        J[2549] -= dqdci;             /* dwdot[iC3H7]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[23][10] - 1)*dcdc_fac - k_r;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4464] += dqdci;             /* dwdot[C3H8]/d[C3H8] */
-        J[4466] -= dqdci;             /* dwdot[iC3H7]/d[C3H8] */
-        /* d()/d[iC3H7] */
-        dqdci =  + k_f*sc[1];
-        J[4545] -= dqdci;             /* dwdot[H]/d[iC3H7] */
-        J[4606] += dqdci;             /* dwdot[C3H8]/d[iC3H7] */
-        J[4608] -= dqdci;             /* dwdot[iC3H7]/d[iC3H7] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[23][9] - 1)*dcdc_fac;
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4677] += dqdci;             /* dwdot[C3H8]/d[C3H6] */
-        J[4679] -= dqdci;             /* dwdot[iC3H7]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[23][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[64];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[23][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[23][2]*dcdc_fac;
-        dqdc[14] = TB[23][3]*dcdc_fac;
-        dqdc[15] = TB[23][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[23][7]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[23][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[23][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[23][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[23][10]*dcdc_fac - k_r;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac + k_f*sc[1];
-        dqdc[65] = TB[23][9]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+62] += dqdc[k];
-            J[71*k+64] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[62] += dcdc_fac;
+    Jmix[64] -= dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[23][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[62] += dqdci;               /* dwdot[C3H8]/d[H2] */
+    J[64] -= dqdci;               /* dwdot[iC3H7]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[64];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[133] += dqdci;              /* dwdot[C3H8]/d[H] */
+    J[135] -= dqdci;              /* dwdot[iC3H7]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[23][1] - 1)*dcdc_fac;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[417] += dqdci;              /* dwdot[C3H8]/d[H2O] */
+    J[419] -= dqdci;              /* dwdot[iC3H7]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[23][2] - 1)*dcdc_fac;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[985] += dqdci;              /* dwdot[C3H8]/d[CH4] */
+    J[987] -= dqdci;              /* dwdot[iC3H7]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[23][3] - 1)*dcdc_fac;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[1056] += dqdci;             /* dwdot[C3H8]/d[CO] */
+    J[1058] -= dqdci;             /* dwdot[iC3H7]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[23][4] - 1)*dcdc_fac;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1127] += dqdci;             /* dwdot[C3H8]/d[CO2] */
+    J[1129] -= dqdci;             /* dwdot[iC3H7]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[23][7] - 1)*dcdc_fac;
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1766] += dqdci;             /* dwdot[C3H8]/d[C2H4] */
+    J[1768] -= dqdci;             /* dwdot[iC3H7]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[23][5] - 1)*dcdc_fac;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1908] += dqdci;             /* dwdot[C3H8]/d[C2H6] */
+    J[1910] -= dqdci;             /* dwdot[iC3H7]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[23][6] - 1)*dcdc_fac;
+    J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2192] += dqdci;             /* dwdot[C3H8]/d[AR] */
+    J[2194] -= dqdci;             /* dwdot[iC3H7]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[23][8] - 1)*dcdc_fac;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2547] += dqdci;             /* dwdot[C3H8]/d[pC3H4] */
+    J[2549] -= dqdci;             /* dwdot[iC3H7]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[23][10] - 1)*dcdc_fac - k_r;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4464] += dqdci;             /* dwdot[C3H8]/d[C3H8] */
+    J[4466] -= dqdci;             /* dwdot[iC3H7]/d[C3H8] */
+    /* d()/d[iC3H7] */
+    dqdci =  + k_f*sc[1];
+    J[4545] -= dqdci;             /* dwdot[H]/d[iC3H7] */
+    J[4606] += dqdci;             /* dwdot[C3H8]/d[iC3H7] */
+    J[4608] -= dqdci;             /* dwdot[iC3H7]/d[iC3H7] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[23][9] - 1)*dcdc_fac;
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4677] += dqdci;             /* dwdot[C3H8]/d[C3H6] */
+    J[4679] -= dqdci;             /* dwdot[iC3H7]/d[C3H6] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[5032] += dqdT; /* dwdot[C3H8]/dT */
     J[5034] -= dqdT; /* dwdot[iC3H7]/dT */
@@ -38873,11 +38159,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[24][0] - 1)*sc[0] + (TB[24][1] - 1)*sc[5] + (TB[24][2] - 1)*sc[13] + (TB[24][3] - 1)*sc[14] + (TB[24][4] - 1)*sc[15] + (TB[24][5] - 1)*sc[26] + (TB[24][6] - 1)*sc[30] + (TB[24][7] - 1)*sc[24] + (TB[24][8] - 1)*sc[35] + (TB[24][9] - 1)*sc[65] + (TB[24][10] - 1)*sc[62];
+    alpha = (memcmp(TB[24], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[24][0] - 1)*sc[0] + (TB[24][1] - 1)*sc[5] + (TB[24][2] - 1)*sc[13] + (TB[24][3] - 1)*sc[14] + (TB[24][4] - 1)*sc[15] + (TB[24][5] - 1)*sc[26] + (TB[24][6] - 1)*sc[30] + (TB[24][7] - 1)*sc[24] + (TB[24][8] - 1)*sc[35] + (TB[24][9] - 1)*sc[65] + (TB[24][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[1]*sc[65];
-    k_f = prefactor_units[24] * fwd_A[24]
-                * exp(fwd_beta[24] * tc[0] - activation_units[24] * fwd_Ea[24] * invT);
+    k_f = k_f_s[24];
     dlnkfdT = fwd_beta[24] * invT + activation_units[24] * fwd_Ea[24] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[24] * exp(low_beta[24] * tc[0] - activation_units[24] * low_Ea[24] * invT);
@@ -38893,16 +38178,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[24] == 4 ? exp(-troe_Tss[24] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[24]) > 1.e-100 ? -Fcent1/troe_Tsss[24] : 0.)
+      + (fabs(troe_Ts[24]) > 1.e-100 ? -Fcent2/troe_Ts[24] : 0.)
+      + (troe_len[24] == 4 ? Fcent3*troe_Tss[24]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[24]) > 1.e-100 ? -Fcent1/troe_Tsss[24] : 0.)
-      + (fabs(troe_Ts[24]) > 1.e-100 ? -Fcent2/troe_Ts[24] : 0.)
-      + (troe_len[24] == 4 ? Fcent3*troe_Tss[24]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -38910,7 +38195,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[63];
-    Kc = refCinv * exp(g_RT[1] - g_RT[63] + g_RT[65]);
+    Kc = Kc_s[24];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[65]) + (h_RT[63]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -38928,150 +38213,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[24][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[63] += dqdci;               /* dwdot[nC3H7]/d[H2] */
-        J[65] -= dqdci;               /* dwdot[C3H6]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[65];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[134] += dqdci;              /* dwdot[nC3H7]/d[H] */
-        J[136] -= dqdci;              /* dwdot[C3H6]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[24][1] - 1)*dcdc_fac;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[418] += dqdci;              /* dwdot[nC3H7]/d[H2O] */
-        J[420] -= dqdci;              /* dwdot[C3H6]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[24][2] - 1)*dcdc_fac;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[986] += dqdci;              /* dwdot[nC3H7]/d[CH4] */
-        J[988] -= dqdci;              /* dwdot[C3H6]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[24][3] - 1)*dcdc_fac;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[1057] += dqdci;             /* dwdot[nC3H7]/d[CO] */
-        J[1059] -= dqdci;             /* dwdot[C3H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[24][4] - 1)*dcdc_fac;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1128] += dqdci;             /* dwdot[nC3H7]/d[CO2] */
-        J[1130] -= dqdci;             /* dwdot[C3H6]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[24][7] - 1)*dcdc_fac;
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1767] += dqdci;             /* dwdot[nC3H7]/d[C2H4] */
-        J[1769] -= dqdci;             /* dwdot[C3H6]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[24][5] - 1)*dcdc_fac;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1909] += dqdci;             /* dwdot[nC3H7]/d[C2H6] */
-        J[1911] -= dqdci;             /* dwdot[C3H6]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[24][6] - 1)*dcdc_fac;
-        J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2193] += dqdci;             /* dwdot[nC3H7]/d[AR] */
-        J[2195] -= dqdci;             /* dwdot[C3H6]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[24][8] - 1)*dcdc_fac;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2548] += dqdci;             /* dwdot[nC3H7]/d[pC3H4] */
-        J[2550] -= dqdci;             /* dwdot[C3H6]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[24][10] - 1)*dcdc_fac;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4465] += dqdci;             /* dwdot[nC3H7]/d[C3H8] */
-        J[4467] -= dqdci;             /* dwdot[C3H6]/d[C3H8] */
-        /* d()/d[nC3H7] */
-        dqdci =  - k_r;
-        J[4474] -= dqdci;             /* dwdot[H]/d[nC3H7] */
-        J[4536] += dqdci;             /* dwdot[nC3H7]/d[nC3H7] */
-        J[4538] -= dqdci;             /* dwdot[C3H6]/d[nC3H7] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[24][9] - 1)*dcdc_fac + k_f*sc[1];
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4678] += dqdci;             /* dwdot[nC3H7]/d[C3H6] */
-        J[4680] -= dqdci;             /* dwdot[C3H6]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[24][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[65];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[24][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[24][2]*dcdc_fac;
-        dqdc[14] = TB[24][3]*dcdc_fac;
-        dqdc[15] = TB[24][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[24][7]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[24][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[24][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[24][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[24][10]*dcdc_fac;
-        dqdc[63] = dcdc_fac - k_r;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[24][9]*dcdc_fac + k_f*sc[1];
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+63] += dqdc[k];
-            J[71*k+65] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[63] += dcdc_fac;
+    Jmix[65] -= dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[24][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[63] += dqdci;               /* dwdot[nC3H7]/d[H2] */
+    J[65] -= dqdci;               /* dwdot[C3H6]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[65];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[134] += dqdci;              /* dwdot[nC3H7]/d[H] */
+    J[136] -= dqdci;              /* dwdot[C3H6]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[24][1] - 1)*dcdc_fac;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[418] += dqdci;              /* dwdot[nC3H7]/d[H2O] */
+    J[420] -= dqdci;              /* dwdot[C3H6]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[24][2] - 1)*dcdc_fac;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[986] += dqdci;              /* dwdot[nC3H7]/d[CH4] */
+    J[988] -= dqdci;              /* dwdot[C3H6]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[24][3] - 1)*dcdc_fac;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[1057] += dqdci;             /* dwdot[nC3H7]/d[CO] */
+    J[1059] -= dqdci;             /* dwdot[C3H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[24][4] - 1)*dcdc_fac;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1128] += dqdci;             /* dwdot[nC3H7]/d[CO2] */
+    J[1130] -= dqdci;             /* dwdot[C3H6]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[24][7] - 1)*dcdc_fac;
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1767] += dqdci;             /* dwdot[nC3H7]/d[C2H4] */
+    J[1769] -= dqdci;             /* dwdot[C3H6]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[24][5] - 1)*dcdc_fac;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1909] += dqdci;             /* dwdot[nC3H7]/d[C2H6] */
+    J[1911] -= dqdci;             /* dwdot[C3H6]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[24][6] - 1)*dcdc_fac;
+    J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2193] += dqdci;             /* dwdot[nC3H7]/d[AR] */
+    J[2195] -= dqdci;             /* dwdot[C3H6]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[24][8] - 1)*dcdc_fac;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2548] += dqdci;             /* dwdot[nC3H7]/d[pC3H4] */
+    J[2550] -= dqdci;             /* dwdot[C3H6]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[24][10] - 1)*dcdc_fac;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4465] += dqdci;             /* dwdot[nC3H7]/d[C3H8] */
+    J[4467] -= dqdci;             /* dwdot[C3H6]/d[C3H8] */
+    /* d()/d[nC3H7] */
+    dqdci =  - k_r;
+    J[4474] -= dqdci;             /* dwdot[H]/d[nC3H7] */
+    J[4536] += dqdci;             /* dwdot[nC3H7]/d[nC3H7] */
+    J[4538] -= dqdci;             /* dwdot[C3H6]/d[nC3H7] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[24][9] - 1)*dcdc_fac + k_f*sc[1];
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4678] += dqdci;             /* dwdot[nC3H7]/d[C3H6] */
+    J[4680] -= dqdci;             /* dwdot[C3H6]/d[C3H6] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[5033] += dqdT; /* dwdot[nC3H7]/dT */
     J[5035] -= dqdT; /* dwdot[C3H6]/dT */
@@ -39080,11 +38290,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[25][0] - 1)*sc[0] + (TB[25][1] - 1)*sc[5] + (TB[25][2] - 1)*sc[13] + (TB[25][3] - 1)*sc[14] + (TB[25][4] - 1)*sc[15] + (TB[25][5] - 1)*sc[26] + (TB[25][6] - 1)*sc[30] + (TB[25][7] - 1)*sc[24] + (TB[25][8] - 1)*sc[35] + (TB[25][9] - 1)*sc[65] + (TB[25][10] - 1)*sc[62];
+    alpha = (memcmp(TB[25], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[25][0] - 1)*sc[0] + (TB[25][1] - 1)*sc[5] + (TB[25][2] - 1)*sc[13] + (TB[25][3] - 1)*sc[14] + (TB[25][4] - 1)*sc[15] + (TB[25][5] - 1)*sc[26] + (TB[25][6] - 1)*sc[30] + (TB[25][7] - 1)*sc[24] + (TB[25][8] - 1)*sc[35] + (TB[25][9] - 1)*sc[65] + (TB[25][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[1]*sc[65];
-    k_f = prefactor_units[25] * fwd_A[25]
-                * exp(fwd_beta[25] * tc[0] - activation_units[25] * fwd_Ea[25] * invT);
+    k_f = k_f_s[25];
     dlnkfdT = fwd_beta[25] * invT + activation_units[25] * fwd_Ea[25] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[25] * exp(low_beta[25] * tc[0] - activation_units[25] * low_Ea[25] * invT);
@@ -39100,16 +38309,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[25] == 4 ? exp(-troe_Tss[25] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[25]) > 1.e-100 ? -Fcent1/troe_Tsss[25] : 0.)
+      + (fabs(troe_Ts[25]) > 1.e-100 ? -Fcent2/troe_Ts[25] : 0.)
+      + (troe_len[25] == 4 ? Fcent3*troe_Tss[25]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[25]) > 1.e-100 ? -Fcent1/troe_Tsss[25] : 0.)
-      + (fabs(troe_Ts[25]) > 1.e-100 ? -Fcent2/troe_Ts[25] : 0.)
-      + (troe_len[25] == 4 ? Fcent3*troe_Tss[25]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -39117,7 +38326,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[64];
-    Kc = refCinv * exp(g_RT[1] - g_RT[64] + g_RT[65]);
+    Kc = Kc_s[25];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[65]) + (h_RT[64]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39135,150 +38344,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[25][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[64] += dqdci;               /* dwdot[iC3H7]/d[H2] */
-        J[65] -= dqdci;               /* dwdot[C3H6]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[65];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[135] += dqdci;              /* dwdot[iC3H7]/d[H] */
-        J[136] -= dqdci;              /* dwdot[C3H6]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[25][1] - 1)*dcdc_fac;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[419] += dqdci;              /* dwdot[iC3H7]/d[H2O] */
-        J[420] -= dqdci;              /* dwdot[C3H6]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[25][2] - 1)*dcdc_fac;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[987] += dqdci;              /* dwdot[iC3H7]/d[CH4] */
-        J[988] -= dqdci;              /* dwdot[C3H6]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[25][3] - 1)*dcdc_fac;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[1058] += dqdci;             /* dwdot[iC3H7]/d[CO] */
-        J[1059] -= dqdci;             /* dwdot[C3H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[25][4] - 1)*dcdc_fac;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1129] += dqdci;             /* dwdot[iC3H7]/d[CO2] */
-        J[1130] -= dqdci;             /* dwdot[C3H6]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[25][7] - 1)*dcdc_fac;
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1768] += dqdci;             /* dwdot[iC3H7]/d[C2H4] */
-        J[1769] -= dqdci;             /* dwdot[C3H6]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[25][5] - 1)*dcdc_fac;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1910] += dqdci;             /* dwdot[iC3H7]/d[C2H6] */
-        J[1911] -= dqdci;             /* dwdot[C3H6]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[25][6] - 1)*dcdc_fac;
-        J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2194] += dqdci;             /* dwdot[iC3H7]/d[AR] */
-        J[2195] -= dqdci;             /* dwdot[C3H6]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[25][8] - 1)*dcdc_fac;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2549] += dqdci;             /* dwdot[iC3H7]/d[pC3H4] */
-        J[2550] -= dqdci;             /* dwdot[C3H6]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[25][10] - 1)*dcdc_fac;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4466] += dqdci;             /* dwdot[iC3H7]/d[C3H8] */
-        J[4467] -= dqdci;             /* dwdot[C3H6]/d[C3H8] */
-        /* d()/d[iC3H7] */
-        dqdci =  - k_r;
-        J[4545] -= dqdci;             /* dwdot[H]/d[iC3H7] */
-        J[4608] += dqdci;             /* dwdot[iC3H7]/d[iC3H7] */
-        J[4609] -= dqdci;             /* dwdot[C3H6]/d[iC3H7] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[25][9] - 1)*dcdc_fac + k_f*sc[1];
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4679] += dqdci;             /* dwdot[iC3H7]/d[C3H6] */
-        J[4680] -= dqdci;             /* dwdot[C3H6]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[25][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[65];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[25][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[25][2]*dcdc_fac;
-        dqdc[14] = TB[25][3]*dcdc_fac;
-        dqdc[15] = TB[25][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[25][7]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[25][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[25][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[25][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[25][10]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac - k_r;
-        dqdc[65] = TB[25][9]*dcdc_fac + k_f*sc[1];
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+64] += dqdc[k];
-            J[71*k+65] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[64] += dcdc_fac;
+    Jmix[65] -= dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[25][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[64] += dqdci;               /* dwdot[iC3H7]/d[H2] */
+    J[65] -= dqdci;               /* dwdot[C3H6]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[65];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[135] += dqdci;              /* dwdot[iC3H7]/d[H] */
+    J[136] -= dqdci;              /* dwdot[C3H6]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[25][1] - 1)*dcdc_fac;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[419] += dqdci;              /* dwdot[iC3H7]/d[H2O] */
+    J[420] -= dqdci;              /* dwdot[C3H6]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[25][2] - 1)*dcdc_fac;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[987] += dqdci;              /* dwdot[iC3H7]/d[CH4] */
+    J[988] -= dqdci;              /* dwdot[C3H6]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[25][3] - 1)*dcdc_fac;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[1058] += dqdci;             /* dwdot[iC3H7]/d[CO] */
+    J[1059] -= dqdci;             /* dwdot[C3H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[25][4] - 1)*dcdc_fac;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1129] += dqdci;             /* dwdot[iC3H7]/d[CO2] */
+    J[1130] -= dqdci;             /* dwdot[C3H6]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[25][7] - 1)*dcdc_fac;
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1768] += dqdci;             /* dwdot[iC3H7]/d[C2H4] */
+    J[1769] -= dqdci;             /* dwdot[C3H6]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[25][5] - 1)*dcdc_fac;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1910] += dqdci;             /* dwdot[iC3H7]/d[C2H6] */
+    J[1911] -= dqdci;             /* dwdot[C3H6]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[25][6] - 1)*dcdc_fac;
+    J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2194] += dqdci;             /* dwdot[iC3H7]/d[AR] */
+    J[2195] -= dqdci;             /* dwdot[C3H6]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[25][8] - 1)*dcdc_fac;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2549] += dqdci;             /* dwdot[iC3H7]/d[pC3H4] */
+    J[2550] -= dqdci;             /* dwdot[C3H6]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[25][10] - 1)*dcdc_fac;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4466] += dqdci;             /* dwdot[iC3H7]/d[C3H8] */
+    J[4467] -= dqdci;             /* dwdot[C3H6]/d[C3H8] */
+    /* d()/d[iC3H7] */
+    dqdci =  - k_r;
+    J[4545] -= dqdci;             /* dwdot[H]/d[iC3H7] */
+    J[4608] += dqdci;             /* dwdot[iC3H7]/d[iC3H7] */
+    J[4609] -= dqdci;             /* dwdot[C3H6]/d[iC3H7] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[25][9] - 1)*dcdc_fac + k_f*sc[1];
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4679] += dqdci;             /* dwdot[iC3H7]/d[C3H6] */
+    J[4680] -= dqdci;             /* dwdot[C3H6]/d[C3H6] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[5034] += dqdT; /* dwdot[iC3H7]/dT */
     J[5035] -= dqdT; /* dwdot[C3H6]/dT */
@@ -39287,11 +38421,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[26][0] - 1)*sc[0] + (TB[26][1] - 1)*sc[5] + (TB[26][2] - 1)*sc[13] + (TB[26][3] - 1)*sc[14] + (TB[26][4] - 1)*sc[15] + (TB[26][5] - 1)*sc[26] + (TB[26][6] - 1)*sc[30] + (TB[26][7] - 1)*sc[24] + (TB[26][8] - 1)*sc[35] + (TB[26][9] - 1)*sc[65] + (TB[26][10] - 1)*sc[62];
+    alpha = (memcmp(TB[26], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[26][0] - 1)*sc[0] + (TB[26][1] - 1)*sc[5] + (TB[26][2] - 1)*sc[13] + (TB[26][3] - 1)*sc[14] + (TB[26][4] - 1)*sc[15] + (TB[26][5] - 1)*sc[26] + (TB[26][6] - 1)*sc[30] + (TB[26][7] - 1)*sc[24] + (TB[26][8] - 1)*sc[35] + (TB[26][9] - 1)*sc[65] + (TB[26][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[1]*sc[66];
-    k_f = prefactor_units[26] * fwd_A[26]
-                * exp(fwd_beta[26] * tc[0] - activation_units[26] * fwd_Ea[26] * invT);
+    k_f = k_f_s[26];
     dlnkfdT = fwd_beta[26] * invT + activation_units[26] * fwd_Ea[26] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[26] * exp(low_beta[26] * tc[0] - activation_units[26] * low_Ea[26] * invT);
@@ -39307,16 +38440,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[26] == 4 ? exp(-troe_Tss[26] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[26]) > 1.e-100 ? -Fcent1/troe_Tsss[26] : 0.)
+      + (fabs(troe_Ts[26]) > 1.e-100 ? -Fcent2/troe_Ts[26] : 0.)
+      + (troe_len[26] == 4 ? Fcent3*troe_Tss[26]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[26]) > 1.e-100 ? -Fcent1/troe_Tsss[26] : 0.)
-      + (fabs(troe_Ts[26]) > 1.e-100 ? -Fcent2/troe_Ts[26] : 0.)
-      + (troe_len[26] == 4 ? Fcent3*troe_Tss[26]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -39324,7 +38457,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[65];
-    Kc = refCinv * exp(g_RT[1] - g_RT[65] + g_RT[66]);
+    Kc = Kc_s[26];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[66]) + (h_RT[65]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39342,150 +38475,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[26][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[65] += dqdci;               /* dwdot[C3H6]/d[H2] */
-        J[66] -= dqdci;               /* dwdot[aC3H5]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[66];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[136] += dqdci;              /* dwdot[C3H6]/d[H] */
-        J[137] -= dqdci;              /* dwdot[aC3H5]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[26][1] - 1)*dcdc_fac;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[420] += dqdci;              /* dwdot[C3H6]/d[H2O] */
-        J[421] -= dqdci;              /* dwdot[aC3H5]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[26][2] - 1)*dcdc_fac;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[988] += dqdci;              /* dwdot[C3H6]/d[CH4] */
-        J[989] -= dqdci;              /* dwdot[aC3H5]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[26][3] - 1)*dcdc_fac;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[1059] += dqdci;             /* dwdot[C3H6]/d[CO] */
-        J[1060] -= dqdci;             /* dwdot[aC3H5]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[26][4] - 1)*dcdc_fac;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1130] += dqdci;             /* dwdot[C3H6]/d[CO2] */
-        J[1131] -= dqdci;             /* dwdot[aC3H5]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[26][7] - 1)*dcdc_fac;
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1769] += dqdci;             /* dwdot[C3H6]/d[C2H4] */
-        J[1770] -= dqdci;             /* dwdot[aC3H5]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[26][5] - 1)*dcdc_fac;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1911] += dqdci;             /* dwdot[C3H6]/d[C2H6] */
-        J[1912] -= dqdci;             /* dwdot[aC3H5]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[26][6] - 1)*dcdc_fac;
-        J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2195] += dqdci;             /* dwdot[C3H6]/d[AR] */
-        J[2196] -= dqdci;             /* dwdot[aC3H5]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[26][8] - 1)*dcdc_fac;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2550] += dqdci;             /* dwdot[C3H6]/d[pC3H4] */
-        J[2551] -= dqdci;             /* dwdot[aC3H5]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[26][10] - 1)*dcdc_fac;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4467] += dqdci;             /* dwdot[C3H6]/d[C3H8] */
-        J[4468] -= dqdci;             /* dwdot[aC3H5]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[26][9] - 1)*dcdc_fac - k_r;
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4680] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
-        J[4681] -= dqdci;             /* dwdot[aC3H5]/d[C3H6] */
-        /* d()/d[aC3H5] */
-        dqdci =  + k_f*sc[1];
-        J[4687] -= dqdci;             /* dwdot[H]/d[aC3H5] */
-        J[4751] += dqdci;             /* dwdot[C3H6]/d[aC3H5] */
-        J[4752] -= dqdci;             /* dwdot[aC3H5]/d[aC3H5] */
-    }
-    else {
-        dqdc[0] = TB[26][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[66];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[26][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[26][2]*dcdc_fac;
-        dqdc[14] = TB[26][3]*dcdc_fac;
-        dqdc[15] = TB[26][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[26][7]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[26][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[26][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[26][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[26][10]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[26][9]*dcdc_fac - k_r;
-        dqdc[66] = dcdc_fac + k_f*sc[1];
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+65] += dqdc[k];
-            J[71*k+66] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[65] += dcdc_fac;
+    Jmix[66] -= dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[26][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[65] += dqdci;               /* dwdot[C3H6]/d[H2] */
+    J[66] -= dqdci;               /* dwdot[aC3H5]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[66];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[136] += dqdci;              /* dwdot[C3H6]/d[H] */
+    J[137] -= dqdci;              /* dwdot[aC3H5]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[26][1] - 1)*dcdc_fac;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[420] += dqdci;              /* dwdot[C3H6]/d[H2O] */
+    J[421] -= dqdci;              /* dwdot[aC3H5]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[26][2] - 1)*dcdc_fac;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[988] += dqdci;              /* dwdot[C3H6]/d[CH4] */
+    J[989] -= dqdci;              /* dwdot[aC3H5]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[26][3] - 1)*dcdc_fac;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[1059] += dqdci;             /* dwdot[C3H6]/d[CO] */
+    J[1060] -= dqdci;             /* dwdot[aC3H5]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[26][4] - 1)*dcdc_fac;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1130] += dqdci;             /* dwdot[C3H6]/d[CO2] */
+    J[1131] -= dqdci;             /* dwdot[aC3H5]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[26][7] - 1)*dcdc_fac;
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1769] += dqdci;             /* dwdot[C3H6]/d[C2H4] */
+    J[1770] -= dqdci;             /* dwdot[aC3H5]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[26][5] - 1)*dcdc_fac;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1911] += dqdci;             /* dwdot[C3H6]/d[C2H6] */
+    J[1912] -= dqdci;             /* dwdot[aC3H5]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[26][6] - 1)*dcdc_fac;
+    J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2195] += dqdci;             /* dwdot[C3H6]/d[AR] */
+    J[2196] -= dqdci;             /* dwdot[aC3H5]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[26][8] - 1)*dcdc_fac;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2550] += dqdci;             /* dwdot[C3H6]/d[pC3H4] */
+    J[2551] -= dqdci;             /* dwdot[aC3H5]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[26][10] - 1)*dcdc_fac;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4467] += dqdci;             /* dwdot[C3H6]/d[C3H8] */
+    J[4468] -= dqdci;             /* dwdot[aC3H5]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[26][9] - 1)*dcdc_fac - k_r;
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4680] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
+    J[4681] -= dqdci;             /* dwdot[aC3H5]/d[C3H6] */
+    /* d()/d[aC3H5] */
+    dqdci =  + k_f*sc[1];
+    J[4687] -= dqdci;             /* dwdot[H]/d[aC3H5] */
+    J[4751] += dqdci;             /* dwdot[C3H6]/d[aC3H5] */
+    J[4752] -= dqdci;             /* dwdot[aC3H5]/d[aC3H5] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[5035] += dqdT; /* dwdot[C3H6]/dT */
     J[5036] -= dqdT; /* dwdot[aC3H5]/dT */
@@ -39494,11 +38552,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[27][0] - 1)*sc[0] + (TB[27][1] - 1)*sc[5] + (TB[27][2] - 1)*sc[13] + (TB[27][3] - 1)*sc[14] + (TB[27][4] - 1)*sc[15] + (TB[27][5] - 1)*sc[26] + (TB[27][6] - 1)*sc[30] + (TB[27][7] - 1)*sc[24] + (TB[27][8] - 1)*sc[35] + (TB[27][9] - 1)*sc[65] + (TB[27][10] - 1)*sc[62];
+    alpha = (memcmp(TB[27], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[27][0] - 1)*sc[0] + (TB[27][1] - 1)*sc[5] + (TB[27][2] - 1)*sc[13] + (TB[27][3] - 1)*sc[14] + (TB[27][4] - 1)*sc[15] + (TB[27][5] - 1)*sc[26] + (TB[27][6] - 1)*sc[30] + (TB[27][7] - 1)*sc[24] + (TB[27][8] - 1)*sc[35] + (TB[27][9] - 1)*sc[65] + (TB[27][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[12]*sc[23];
-    k_f = prefactor_units[27] * fwd_A[27]
-                * exp(fwd_beta[27] * tc[0] - activation_units[27] * fwd_Ea[27] * invT);
+    k_f = k_f_s[27];
     dlnkfdT = fwd_beta[27] * invT + activation_units[27] * fwd_Ea[27] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[27] * exp(low_beta[27] * tc[0] - activation_units[27] * low_Ea[27] * invT);
@@ -39514,16 +38571,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[27] == 4 ? exp(-troe_Tss[27] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[27]) > 1.e-100 ? -Fcent1/troe_Tsss[27] : 0.)
+      + (fabs(troe_Ts[27]) > 1.e-100 ? -Fcent2/troe_Ts[27] : 0.)
+      + (troe_len[27] == 4 ? Fcent3*troe_Tss[27]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[27]) > 1.e-100 ? -Fcent1/troe_Tsss[27] : 0.)
-      + (fabs(troe_Ts[27]) > 1.e-100 ? -Fcent2/troe_Ts[27] : 0.)
-      + (troe_len[27] == 4 ? Fcent3*troe_Tss[27]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -39531,7 +38588,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[65];
-    Kc = refCinv * exp(g_RT[12] + g_RT[23] - g_RT[65]);
+    Kc = Kc_s[27];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[23]) + (h_RT[65]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39549,150 +38606,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[27][0] - 1)*dcdc_fac;
-        J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
-        J[23] -= dqdci;               /* dwdot[C2H3]/d[H2] */
-        J[65] += dqdci;               /* dwdot[C3H6]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[27][1] - 1)*dcdc_fac;
-        J[367] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[378] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
-        J[420] += dqdci;              /* dwdot[C3H6]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[23];
-        J[864] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[875] -= dqdci;              /* dwdot[C2H3]/d[CH3] */
-        J[917] += dqdci;              /* dwdot[C3H6]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[27][2] - 1)*dcdc_fac;
-        J[935] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[946] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
-        J[988] += dqdci;              /* dwdot[C3H6]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[27][3] - 1)*dcdc_fac;
-        J[1006] -= dqdci;             /* dwdot[CH3]/d[CO] */
-        J[1017] -= dqdci;             /* dwdot[C2H3]/d[CO] */
-        J[1059] += dqdci;             /* dwdot[C3H6]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[27][4] - 1)*dcdc_fac;
-        J[1077] -= dqdci;             /* dwdot[CH3]/d[CO2] */
-        J[1088] -= dqdci;             /* dwdot[C2H3]/d[CO2] */
-        J[1130] += dqdci;             /* dwdot[C3H6]/d[CO2] */
-        /* d()/d[C2H3] */
-        dqdci =  + k_f*sc[12];
-        J[1645] -= dqdci;             /* dwdot[CH3]/d[C2H3] */
-        J[1656] -= dqdci;             /* dwdot[C2H3]/d[C2H3] */
-        J[1698] += dqdci;             /* dwdot[C3H6]/d[C2H3] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[27][7] - 1)*dcdc_fac;
-        J[1716] -= dqdci;             /* dwdot[CH3]/d[C2H4] */
-        J[1727] -= dqdci;             /* dwdot[C2H3]/d[C2H4] */
-        J[1769] += dqdci;             /* dwdot[C3H6]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[27][5] - 1)*dcdc_fac;
-        J[1858] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
-        J[1869] -= dqdci;             /* dwdot[C2H3]/d[C2H6] */
-        J[1911] += dqdci;             /* dwdot[C3H6]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[27][6] - 1)*dcdc_fac;
-        J[2142] -= dqdci;             /* dwdot[CH3]/d[AR] */
-        J[2153] -= dqdci;             /* dwdot[C2H3]/d[AR] */
-        J[2195] += dqdci;             /* dwdot[C3H6]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[27][8] - 1)*dcdc_fac;
-        J[2497] -= dqdci;             /* dwdot[CH3]/d[pC3H4] */
-        J[2508] -= dqdci;             /* dwdot[C2H3]/d[pC3H4] */
-        J[2550] += dqdci;             /* dwdot[C3H6]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[27][10] - 1)*dcdc_fac;
-        J[4414] -= dqdci;             /* dwdot[CH3]/d[C3H8] */
-        J[4425] -= dqdci;             /* dwdot[C2H3]/d[C3H8] */
-        J[4467] += dqdci;             /* dwdot[C3H6]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[27][9] - 1)*dcdc_fac - k_r;
-        J[4627] -= dqdci;             /* dwdot[CH3]/d[C3H6] */
-        J[4638] -= dqdci;             /* dwdot[C2H3]/d[C3H6] */
-        J[4680] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[27][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[27][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*sc[23];
-        dqdc[13] = TB[27][2]*dcdc_fac;
-        dqdc[14] = TB[27][3]*dcdc_fac;
-        dqdc[15] = TB[27][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac + k_f*sc[12];
-        dqdc[24] = TB[27][7]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[27][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[27][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[27][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[27][10]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[27][9]*dcdc_fac - k_r;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+12] -= dqdc[k];
-            J[71*k+23] -= dqdc[k];
-            J[71*k+65] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[12] -= dcdc_fac;
+    Jmix[23] -= dcdc_fac;
+    Jmix[65] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[27][0] - 1)*dcdc_fac;
+    J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
+    J[23] -= dqdci;               /* dwdot[C2H3]/d[H2] */
+    J[65] += dqdci;               /* dwdot[C3H6]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[27][1] - 1)*dcdc_fac;
+    J[367] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[378] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
+    J[420] += dqdci;              /* dwdot[C3H6]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[23];
+    J[864] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[875] -= dqdci;              /* dwdot[C2H3]/d[CH3] */
+    J[917] += dqdci;              /* dwdot[C3H6]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[27][2] - 1)*dcdc_fac;
+    J[935] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[946] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
+    J[988] += dqdci;              /* dwdot[C3H6]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[27][3] - 1)*dcdc_fac;
+    J[1006] -= dqdci;             /* dwdot[CH3]/d[CO] */
+    J[1017] -= dqdci;             /* dwdot[C2H3]/d[CO] */
+    J[1059] += dqdci;             /* dwdot[C3H6]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[27][4] - 1)*dcdc_fac;
+    J[1077] -= dqdci;             /* dwdot[CH3]/d[CO2] */
+    J[1088] -= dqdci;             /* dwdot[C2H3]/d[CO2] */
+    J[1130] += dqdci;             /* dwdot[C3H6]/d[CO2] */
+    /* d()/d[C2H3] */
+    dqdci =  + k_f*sc[12];
+    J[1645] -= dqdci;             /* dwdot[CH3]/d[C2H3] */
+    J[1656] -= dqdci;             /* dwdot[C2H3]/d[C2H3] */
+    J[1698] += dqdci;             /* dwdot[C3H6]/d[C2H3] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[27][7] - 1)*dcdc_fac;
+    J[1716] -= dqdci;             /* dwdot[CH3]/d[C2H4] */
+    J[1727] -= dqdci;             /* dwdot[C2H3]/d[C2H4] */
+    J[1769] += dqdci;             /* dwdot[C3H6]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[27][5] - 1)*dcdc_fac;
+    J[1858] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
+    J[1869] -= dqdci;             /* dwdot[C2H3]/d[C2H6] */
+    J[1911] += dqdci;             /* dwdot[C3H6]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[27][6] - 1)*dcdc_fac;
+    J[2142] -= dqdci;             /* dwdot[CH3]/d[AR] */
+    J[2153] -= dqdci;             /* dwdot[C2H3]/d[AR] */
+    J[2195] += dqdci;             /* dwdot[C3H6]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[27][8] - 1)*dcdc_fac;
+    J[2497] -= dqdci;             /* dwdot[CH3]/d[pC3H4] */
+    J[2508] -= dqdci;             /* dwdot[C2H3]/d[pC3H4] */
+    J[2550] += dqdci;             /* dwdot[C3H6]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[27][10] - 1)*dcdc_fac;
+    J[4414] -= dqdci;             /* dwdot[CH3]/d[C3H8] */
+    J[4425] -= dqdci;             /* dwdot[C2H3]/d[C3H8] */
+    J[4467] += dqdci;             /* dwdot[C3H6]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[27][9] - 1)*dcdc_fac - k_r;
+    J[4627] -= dqdci;             /* dwdot[CH3]/d[C3H6] */
+    J[4638] -= dqdci;             /* dwdot[C2H3]/d[C3H6] */
+    J[4680] += dqdci;             /* dwdot[C3H6]/d[C3H6] */
     J[4982] -= dqdT; /* dwdot[CH3]/dT */
     J[4993] -= dqdT; /* dwdot[C2H3]/dT */
     J[5035] += dqdT; /* dwdot[C3H6]/dT */
@@ -39701,11 +38683,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[28][0] - 1)*sc[0] + (TB[28][1] - 1)*sc[5] + (TB[28][2] - 1)*sc[13] + (TB[28][3] - 1)*sc[14] + (TB[28][4] - 1)*sc[15] + (TB[28][5] - 1)*sc[26] + (TB[28][6] - 1)*sc[30] + (TB[28][7] - 1)*sc[24] + (TB[28][8] - 1)*sc[35] + (TB[28][9] - 1)*sc[65] + (TB[28][10] - 1)*sc[62];
+    alpha = (memcmp(TB[28], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[28][0] - 1)*sc[0] + (TB[28][1] - 1)*sc[5] + (TB[28][2] - 1)*sc[13] + (TB[28][3] - 1)*sc[14] + (TB[28][4] - 1)*sc[15] + (TB[28][5] - 1)*sc[26] + (TB[28][6] - 1)*sc[30] + (TB[28][7] - 1)*sc[24] + (TB[28][8] - 1)*sc[35] + (TB[28][9] - 1)*sc[65] + (TB[28][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[12]*sc[25];
-    k_f = prefactor_units[28] * fwd_A[28]
-                * exp(fwd_beta[28] * tc[0] - activation_units[28] * fwd_Ea[28] * invT);
+    k_f = k_f_s[28];
     dlnkfdT = fwd_beta[28] * invT + activation_units[28] * fwd_Ea[28] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[28] * exp(low_beta[28] * tc[0] - activation_units[28] * low_Ea[28] * invT);
@@ -39721,16 +38702,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[28] == 4 ? exp(-troe_Tss[28] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[28]) > 1.e-100 ? -Fcent1/troe_Tsss[28] : 0.)
+      + (fabs(troe_Ts[28]) > 1.e-100 ? -Fcent2/troe_Ts[28] : 0.)
+      + (troe_len[28] == 4 ? Fcent3*troe_Tss[28]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[28]) > 1.e-100 ? -Fcent1/troe_Tsss[28] : 0.)
-      + (fabs(troe_Ts[28]) > 1.e-100 ? -Fcent2/troe_Ts[28] : 0.)
-      + (troe_len[28] == 4 ? Fcent3*troe_Tss[28]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -39738,7 +38719,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[62];
-    Kc = refCinv * exp(g_RT[12] + g_RT[25] - g_RT[62]);
+    Kc = Kc_s[28];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[25]) + (h_RT[62]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39756,150 +38737,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[28][0] - 1)*dcdc_fac;
-        J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
-        J[25] -= dqdci;               /* dwdot[C2H5]/d[H2] */
-        J[62] += dqdci;               /* dwdot[C3H8]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[28][1] - 1)*dcdc_fac;
-        J[367] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[380] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
-        J[417] += dqdci;              /* dwdot[C3H8]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[25];
-        J[864] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[877] -= dqdci;              /* dwdot[C2H5]/d[CH3] */
-        J[914] += dqdci;              /* dwdot[C3H8]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[28][2] - 1)*dcdc_fac;
-        J[935] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[948] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
-        J[985] += dqdci;              /* dwdot[C3H8]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[28][3] - 1)*dcdc_fac;
-        J[1006] -= dqdci;             /* dwdot[CH3]/d[CO] */
-        J[1019] -= dqdci;             /* dwdot[C2H5]/d[CO] */
-        J[1056] += dqdci;             /* dwdot[C3H8]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[28][4] - 1)*dcdc_fac;
-        J[1077] -= dqdci;             /* dwdot[CH3]/d[CO2] */
-        J[1090] -= dqdci;             /* dwdot[C2H5]/d[CO2] */
-        J[1127] += dqdci;             /* dwdot[C3H8]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[28][7] - 1)*dcdc_fac;
-        J[1716] -= dqdci;             /* dwdot[CH3]/d[C2H4] */
-        J[1729] -= dqdci;             /* dwdot[C2H5]/d[C2H4] */
-        J[1766] += dqdci;             /* dwdot[C3H8]/d[C2H4] */
-        /* d()/d[C2H5] */
-        dqdci =  + k_f*sc[12];
-        J[1787] -= dqdci;             /* dwdot[CH3]/d[C2H5] */
-        J[1800] -= dqdci;             /* dwdot[C2H5]/d[C2H5] */
-        J[1837] += dqdci;             /* dwdot[C3H8]/d[C2H5] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[28][5] - 1)*dcdc_fac;
-        J[1858] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
-        J[1871] -= dqdci;             /* dwdot[C2H5]/d[C2H6] */
-        J[1908] += dqdci;             /* dwdot[C3H8]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[28][6] - 1)*dcdc_fac;
-        J[2142] -= dqdci;             /* dwdot[CH3]/d[AR] */
-        J[2155] -= dqdci;             /* dwdot[C2H5]/d[AR] */
-        J[2192] += dqdci;             /* dwdot[C3H8]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[28][8] - 1)*dcdc_fac;
-        J[2497] -= dqdci;             /* dwdot[CH3]/d[pC3H4] */
-        J[2510] -= dqdci;             /* dwdot[C2H5]/d[pC3H4] */
-        J[2547] += dqdci;             /* dwdot[C3H8]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[28][10] - 1)*dcdc_fac - k_r;
-        J[4414] -= dqdci;             /* dwdot[CH3]/d[C3H8] */
-        J[4427] -= dqdci;             /* dwdot[C2H5]/d[C3H8] */
-        J[4464] += dqdci;             /* dwdot[C3H8]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[28][9] - 1)*dcdc_fac;
-        J[4627] -= dqdci;             /* dwdot[CH3]/d[C3H6] */
-        J[4640] -= dqdci;             /* dwdot[C2H5]/d[C3H6] */
-        J[4677] += dqdci;             /* dwdot[C3H8]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[28][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[28][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*sc[25];
-        dqdc[13] = TB[28][2]*dcdc_fac;
-        dqdc[14] = TB[28][3]*dcdc_fac;
-        dqdc[15] = TB[28][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[28][7]*dcdc_fac;
-        dqdc[25] = dcdc_fac + k_f*sc[12];
-        dqdc[26] = TB[28][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[28][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[28][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[28][10]*dcdc_fac - k_r;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[28][9]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+12] -= dqdc[k];
-            J[71*k+25] -= dqdc[k];
-            J[71*k+62] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[12] -= dcdc_fac;
+    Jmix[25] -= dcdc_fac;
+    Jmix[62] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[28][0] - 1)*dcdc_fac;
+    J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
+    J[25] -= dqdci;               /* dwdot[C2H5]/d[H2] */
+    J[62] += dqdci;               /* dwdot[C3H8]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[28][1] - 1)*dcdc_fac;
+    J[367] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[380] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
+    J[417] += dqdci;              /* dwdot[C3H8]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[25];
+    J[864] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[877] -= dqdci;              /* dwdot[C2H5]/d[CH3] */
+    J[914] += dqdci;              /* dwdot[C3H8]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[28][2] - 1)*dcdc_fac;
+    J[935] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[948] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
+    J[985] += dqdci;              /* dwdot[C3H8]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[28][3] - 1)*dcdc_fac;
+    J[1006] -= dqdci;             /* dwdot[CH3]/d[CO] */
+    J[1019] -= dqdci;             /* dwdot[C2H5]/d[CO] */
+    J[1056] += dqdci;             /* dwdot[C3H8]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[28][4] - 1)*dcdc_fac;
+    J[1077] -= dqdci;             /* dwdot[CH3]/d[CO2] */
+    J[1090] -= dqdci;             /* dwdot[C2H5]/d[CO2] */
+    J[1127] += dqdci;             /* dwdot[C3H8]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[28][7] - 1)*dcdc_fac;
+    J[1716] -= dqdci;             /* dwdot[CH3]/d[C2H4] */
+    J[1729] -= dqdci;             /* dwdot[C2H5]/d[C2H4] */
+    J[1766] += dqdci;             /* dwdot[C3H8]/d[C2H4] */
+    /* d()/d[C2H5] */
+    dqdci =  + k_f*sc[12];
+    J[1787] -= dqdci;             /* dwdot[CH3]/d[C2H5] */
+    J[1800] -= dqdci;             /* dwdot[C2H5]/d[C2H5] */
+    J[1837] += dqdci;             /* dwdot[C3H8]/d[C2H5] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[28][5] - 1)*dcdc_fac;
+    J[1858] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
+    J[1871] -= dqdci;             /* dwdot[C2H5]/d[C2H6] */
+    J[1908] += dqdci;             /* dwdot[C3H8]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[28][6] - 1)*dcdc_fac;
+    J[2142] -= dqdci;             /* dwdot[CH3]/d[AR] */
+    J[2155] -= dqdci;             /* dwdot[C2H5]/d[AR] */
+    J[2192] += dqdci;             /* dwdot[C3H8]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[28][8] - 1)*dcdc_fac;
+    J[2497] -= dqdci;             /* dwdot[CH3]/d[pC3H4] */
+    J[2510] -= dqdci;             /* dwdot[C2H5]/d[pC3H4] */
+    J[2547] += dqdci;             /* dwdot[C3H8]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[28][10] - 1)*dcdc_fac - k_r;
+    J[4414] -= dqdci;             /* dwdot[CH3]/d[C3H8] */
+    J[4427] -= dqdci;             /* dwdot[C2H5]/d[C3H8] */
+    J[4464] += dqdci;             /* dwdot[C3H8]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[28][9] - 1)*dcdc_fac;
+    J[4627] -= dqdci;             /* dwdot[CH3]/d[C3H6] */
+    J[4640] -= dqdci;             /* dwdot[C2H5]/d[C3H6] */
+    J[4677] += dqdci;             /* dwdot[C3H8]/d[C3H6] */
     J[4982] -= dqdT; /* dwdot[CH3]/dT */
     J[4995] -= dqdT; /* dwdot[C2H5]/dT */
     J[5032] += dqdT; /* dwdot[C3H8]/dT */
@@ -39908,11 +38814,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[29][0] - 1)*sc[0] + (TB[29][1] - 1)*sc[5] + (TB[29][2] - 1)*sc[13] + (TB[29][3] - 1)*sc[14] + (TB[29][4] - 1)*sc[15] + (TB[29][5] - 1)*sc[26] + (TB[29][6] - 1)*sc[30] + (TB[29][7] - 1)*sc[24] + (TB[29][8] - 1)*sc[35] + (TB[29][9] - 1)*sc[65] + (TB[29][10] - 1)*sc[62];
+    alpha = (memcmp(TB[29], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[29][0] - 1)*sc[0] + (TB[29][1] - 1)*sc[5] + (TB[29][2] - 1)*sc[13] + (TB[29][3] - 1)*sc[14] + (TB[29][4] - 1)*sc[15] + (TB[29][5] - 1)*sc[26] + (TB[29][6] - 1)*sc[30] + (TB[29][7] - 1)*sc[24] + (TB[29][8] - 1)*sc[35] + (TB[29][9] - 1)*sc[65] + (TB[29][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[12]*sc[34];
-    k_f = prefactor_units[29] * fwd_A[29]
-                * exp(fwd_beta[29] * tc[0] - activation_units[29] * fwd_Ea[29] * invT);
+    k_f = k_f_s[29];
     dlnkfdT = fwd_beta[29] * invT + activation_units[29] * fwd_Ea[29] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[29] * exp(low_beta[29] * tc[0] - activation_units[29] * low_Ea[29] * invT);
@@ -39928,16 +38833,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[29] == 4 ? exp(-troe_Tss[29] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[29]) > 1.e-100 ? -Fcent1/troe_Tsss[29] : 0.)
+      + (fabs(troe_Ts[29]) > 1.e-100 ? -Fcent2/troe_Ts[29] : 0.)
+      + (troe_len[29] == 4 ? Fcent3*troe_Tss[29]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[29]) > 1.e-100 ? -Fcent1/troe_Tsss[29] : 0.)
-      + (fabs(troe_Ts[29]) > 1.e-100 ? -Fcent2/troe_Ts[29] : 0.)
-      + (troe_len[29] == 4 ? Fcent3*troe_Tss[29]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -39945,7 +38850,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[46];
-    Kc = refCinv * exp(g_RT[12] + g_RT[34] - g_RT[46]);
+    Kc = Kc_s[29];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[34]) + (h_RT[46]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -39963,155 +38868,80 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[29][0] - 1)*dcdc_fac;
-        J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
-        J[34] -= dqdci;               /* dwdot[C3H3]/d[H2] */
-        J[46] += dqdci;               /* dwdot[C4H612]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[29][1] - 1)*dcdc_fac;
-        J[367] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[389] -= dqdci;              /* dwdot[C3H3]/d[H2O] */
-        J[401] += dqdci;              /* dwdot[C4H612]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[34];
-        J[864] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[886] -= dqdci;              /* dwdot[C3H3]/d[CH3] */
-        J[898] += dqdci;              /* dwdot[C4H612]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[29][2] - 1)*dcdc_fac;
-        J[935] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[957] -= dqdci;              /* dwdot[C3H3]/d[CH4] */
-        J[969] += dqdci;              /* dwdot[C4H612]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[29][3] - 1)*dcdc_fac;
-        J[1006] -= dqdci;             /* dwdot[CH3]/d[CO] */
-        J[1028] -= dqdci;             /* dwdot[C3H3]/d[CO] */
-        J[1040] += dqdci;             /* dwdot[C4H612]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[29][4] - 1)*dcdc_fac;
-        J[1077] -= dqdci;             /* dwdot[CH3]/d[CO2] */
-        J[1099] -= dqdci;             /* dwdot[C3H3]/d[CO2] */
-        J[1111] += dqdci;             /* dwdot[C4H612]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[29][7] - 1)*dcdc_fac;
-        J[1716] -= dqdci;             /* dwdot[CH3]/d[C2H4] */
-        J[1738] -= dqdci;             /* dwdot[C3H3]/d[C2H4] */
-        J[1750] += dqdci;             /* dwdot[C4H612]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[29][5] - 1)*dcdc_fac;
-        J[1858] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
-        J[1880] -= dqdci;             /* dwdot[C3H3]/d[C2H6] */
-        J[1892] += dqdci;             /* dwdot[C4H612]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[29][6] - 1)*dcdc_fac;
-        J[2142] -= dqdci;             /* dwdot[CH3]/d[AR] */
-        J[2164] -= dqdci;             /* dwdot[C3H3]/d[AR] */
-        J[2176] += dqdci;             /* dwdot[C4H612]/d[AR] */
-        /* d()/d[C3H3] */
-        dqdci =  + k_f*sc[12];
-        J[2426] -= dqdci;             /* dwdot[CH3]/d[C3H3] */
-        J[2448] -= dqdci;             /* dwdot[C3H3]/d[C3H3] */
-        J[2460] += dqdci;             /* dwdot[C4H612]/d[C3H3] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[29][8] - 1)*dcdc_fac;
-        J[2497] -= dqdci;             /* dwdot[CH3]/d[pC3H4] */
-        J[2519] -= dqdci;             /* dwdot[C3H3]/d[pC3H4] */
-        J[2531] += dqdci;             /* dwdot[C4H612]/d[pC3H4] */
-        /* d()/d[C4H612] */
-        dqdci =  - k_r;
-        J[3278] -= dqdci;             /* dwdot[CH3]/d[C4H612] */
-        J[3300] -= dqdci;             /* dwdot[C3H3]/d[C4H612] */
-        J[3312] += dqdci;             /* dwdot[C4H612]/d[C4H612] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[29][10] - 1)*dcdc_fac;
-        J[4414] -= dqdci;             /* dwdot[CH3]/d[C3H8] */
-        J[4436] -= dqdci;             /* dwdot[C3H3]/d[C3H8] */
-        J[4448] += dqdci;             /* dwdot[C4H612]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[29][9] - 1)*dcdc_fac;
-        J[4627] -= dqdci;             /* dwdot[CH3]/d[C3H6] */
-        J[4649] -= dqdci;             /* dwdot[C3H3]/d[C3H6] */
-        J[4661] += dqdci;             /* dwdot[C4H612]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[29][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[29][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*sc[34];
-        dqdc[13] = TB[29][2]*dcdc_fac;
-        dqdc[14] = TB[29][3]*dcdc_fac;
-        dqdc[15] = TB[29][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[29][7]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[29][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[29][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac + k_f*sc[12];
-        dqdc[35] = TB[29][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac - k_r;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[29][10]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[29][9]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+12] -= dqdc[k];
-            J[71*k+34] -= dqdc[k];
-            J[71*k+46] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[12] -= dcdc_fac;
+    Jmix[34] -= dcdc_fac;
+    Jmix[46] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[29][0] - 1)*dcdc_fac;
+    J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
+    J[34] -= dqdci;               /* dwdot[C3H3]/d[H2] */
+    J[46] += dqdci;               /* dwdot[C4H612]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[29][1] - 1)*dcdc_fac;
+    J[367] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[389] -= dqdci;              /* dwdot[C3H3]/d[H2O] */
+    J[401] += dqdci;              /* dwdot[C4H612]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[34];
+    J[864] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[886] -= dqdci;              /* dwdot[C3H3]/d[CH3] */
+    J[898] += dqdci;              /* dwdot[C4H612]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[29][2] - 1)*dcdc_fac;
+    J[935] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[957] -= dqdci;              /* dwdot[C3H3]/d[CH4] */
+    J[969] += dqdci;              /* dwdot[C4H612]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[29][3] - 1)*dcdc_fac;
+    J[1006] -= dqdci;             /* dwdot[CH3]/d[CO] */
+    J[1028] -= dqdci;             /* dwdot[C3H3]/d[CO] */
+    J[1040] += dqdci;             /* dwdot[C4H612]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[29][4] - 1)*dcdc_fac;
+    J[1077] -= dqdci;             /* dwdot[CH3]/d[CO2] */
+    J[1099] -= dqdci;             /* dwdot[C3H3]/d[CO2] */
+    J[1111] += dqdci;             /* dwdot[C4H612]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[29][7] - 1)*dcdc_fac;
+    J[1716] -= dqdci;             /* dwdot[CH3]/d[C2H4] */
+    J[1738] -= dqdci;             /* dwdot[C3H3]/d[C2H4] */
+    J[1750] += dqdci;             /* dwdot[C4H612]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[29][5] - 1)*dcdc_fac;
+    J[1858] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
+    J[1880] -= dqdci;             /* dwdot[C3H3]/d[C2H6] */
+    J[1892] += dqdci;             /* dwdot[C4H612]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[29][6] - 1)*dcdc_fac;
+    J[2142] -= dqdci;             /* dwdot[CH3]/d[AR] */
+    J[2164] -= dqdci;             /* dwdot[C3H3]/d[AR] */
+    J[2176] += dqdci;             /* dwdot[C4H612]/d[AR] */
+    /* d()/d[C3H3] */
+    dqdci =  + k_f*sc[12];
+    J[2426] -= dqdci;             /* dwdot[CH3]/d[C3H3] */
+    J[2448] -= dqdci;             /* dwdot[C3H3]/d[C3H3] */
+    J[2460] += dqdci;             /* dwdot[C4H612]/d[C3H3] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[29][8] - 1)*dcdc_fac;
+    J[2497] -= dqdci;             /* dwdot[CH3]/d[pC3H4] */
+    J[2519] -= dqdci;             /* dwdot[C3H3]/d[pC3H4] */
+    J[2531] += dqdci;             /* dwdot[C4H612]/d[pC3H4] */
+    /* d()/d[C4H612] */
+    dqdci =  - k_r;
+    J[3278] -= dqdci;             /* dwdot[CH3]/d[C4H612] */
+    J[3300] -= dqdci;             /* dwdot[C3H3]/d[C4H612] */
+    J[3312] += dqdci;             /* dwdot[C4H612]/d[C4H612] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[29][10] - 1)*dcdc_fac;
+    J[4414] -= dqdci;             /* dwdot[CH3]/d[C3H8] */
+    J[4436] -= dqdci;             /* dwdot[C3H3]/d[C3H8] */
+    J[4448] += dqdci;             /* dwdot[C4H612]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[29][9] - 1)*dcdc_fac;
+    J[4627] -= dqdci;             /* dwdot[CH3]/d[C3H6] */
+    J[4649] -= dqdci;             /* dwdot[C3H3]/d[C3H6] */
+    J[4661] += dqdci;             /* dwdot[C4H612]/d[C3H6] */
     J[4982] -= dqdT; /* dwdot[CH3]/dT */
     J[5004] -= dqdT; /* dwdot[C3H3]/dT */
     J[5016] += dqdT; /* dwdot[C4H612]/dT */
@@ -40120,11 +38950,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[30][0] - 1)*sc[0] + (TB[30][1] - 1)*sc[5] + (TB[30][2] - 1)*sc[13] + (TB[30][3] - 1)*sc[14] + (TB[30][4] - 1)*sc[15] + (TB[30][5] - 1)*sc[26] + (TB[30][6] - 1)*sc[24] + (TB[30][7] - 1)*sc[35] + (TB[30][8] - 1)*sc[65] + (TB[30][9] - 1)*sc[62];
+    alpha = (memcmp(TB[30], TB[3], 10*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[30][0] - 1)*sc[0] + (TB[30][1] - 1)*sc[5] + (TB[30][2] - 1)*sc[13] + (TB[30][3] - 1)*sc[14] + (TB[30][4] - 1)*sc[15] + (TB[30][5] - 1)*sc[26] + (TB[30][6] - 1)*sc[24] + (TB[30][7] - 1)*sc[35] + (TB[30][8] - 1)*sc[65] + (TB[30][9] - 1)*sc[62]);
     /* forward */
     phi_f = sc[1]*sc[54];
-    k_f = prefactor_units[30] * fwd_A[30]
-                * exp(fwd_beta[30] * tc[0] - activation_units[30] * fwd_Ea[30] * invT);
+    k_f = k_f_s[30];
     dlnkfdT = fwd_beta[30] * invT + activation_units[30] * fwd_Ea[30] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[30] * exp(low_beta[30] * tc[0] - activation_units[30] * low_Ea[30] * invT);
@@ -40140,16 +38969,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[30] == 4 ? exp(-troe_Tss[30] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[30]) > 1.e-100 ? -Fcent1/troe_Tsss[30] : 0.)
+      + (fabs(troe_Ts[30]) > 1.e-100 ? -Fcent2/troe_Ts[30] : 0.)
+      + (troe_len[30] == 4 ? Fcent3*troe_Tss[30]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[30]) > 1.e-100 ? -Fcent1/troe_Tsss[30] : 0.)
-      + (fabs(troe_Ts[30]) > 1.e-100 ? -Fcent2/troe_Ts[30] : 0.)
-      + (troe_len[30] == 4 ? Fcent3*troe_Tss[30]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -40157,7 +38986,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[53];
-    Kc = refCinv * exp(g_RT[1] - g_RT[53] + g_RT[54]);
+    Kc = Kc_s[30];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[54]) + (h_RT[53]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40175,150 +39004,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[30][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[53] += dqdci;               /* dwdot[A1]/d[H2] */
-        J[54] -= dqdci;               /* dwdot[A1-]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[54];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[124] += dqdci;              /* dwdot[A1]/d[H] */
-        J[125] -= dqdci;              /* dwdot[A1-]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[30][1] - 1)*dcdc_fac;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[408] += dqdci;              /* dwdot[A1]/d[H2O] */
-        J[409] -= dqdci;              /* dwdot[A1-]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[30][2] - 1)*dcdc_fac;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[976] += dqdci;              /* dwdot[A1]/d[CH4] */
-        J[977] -= dqdci;              /* dwdot[A1-]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[30][3] - 1)*dcdc_fac;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[1047] += dqdci;             /* dwdot[A1]/d[CO] */
-        J[1048] -= dqdci;             /* dwdot[A1-]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[30][4] - 1)*dcdc_fac;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1118] += dqdci;             /* dwdot[A1]/d[CO2] */
-        J[1119] -= dqdci;             /* dwdot[A1-]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[30][6] - 1)*dcdc_fac;
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1757] += dqdci;             /* dwdot[A1]/d[C2H4] */
-        J[1758] -= dqdci;             /* dwdot[A1-]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[30][5] - 1)*dcdc_fac;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1899] += dqdci;             /* dwdot[A1]/d[C2H6] */
-        J[1900] -= dqdci;             /* dwdot[A1-]/d[C2H6] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[30][7] - 1)*dcdc_fac;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2538] += dqdci;             /* dwdot[A1]/d[pC3H4] */
-        J[2539] -= dqdci;             /* dwdot[A1-]/d[pC3H4] */
-        /* d()/d[A1] */
-        dqdci =  - k_r;
-        J[3764] -= dqdci;             /* dwdot[H]/d[A1] */
-        J[3816] += dqdci;             /* dwdot[A1]/d[A1] */
-        J[3817] -= dqdci;             /* dwdot[A1-]/d[A1] */
-        /* d()/d[A1-] */
-        dqdci =  + k_f*sc[1];
-        J[3835] -= dqdci;             /* dwdot[H]/d[A1-] */
-        J[3887] += dqdci;             /* dwdot[A1]/d[A1-] */
-        J[3888] -= dqdci;             /* dwdot[A1-]/d[A1-] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[30][9] - 1)*dcdc_fac;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4455] += dqdci;             /* dwdot[A1]/d[C3H8] */
-        J[4456] -= dqdci;             /* dwdot[A1-]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[30][8] - 1)*dcdc_fac;
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4668] += dqdci;             /* dwdot[A1]/d[C3H6] */
-        J[4669] -= dqdci;             /* dwdot[A1-]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[30][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[54];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[30][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[30][2]*dcdc_fac;
-        dqdc[14] = TB[30][3]*dcdc_fac;
-        dqdc[15] = TB[30][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[30][6]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[30][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[30][7]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac - k_r;
-        dqdc[54] = dcdc_fac + k_f*sc[1];
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[30][9]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[30][8]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+53] += dqdc[k];
-            J[71*k+54] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[53] += dcdc_fac;
+    Jmix[54] -= dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[30][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[53] += dqdci;               /* dwdot[A1]/d[H2] */
+    J[54] -= dqdci;               /* dwdot[A1-]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[54];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[124] += dqdci;              /* dwdot[A1]/d[H] */
+    J[125] -= dqdci;              /* dwdot[A1-]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[30][1] - 1)*dcdc_fac;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[408] += dqdci;              /* dwdot[A1]/d[H2O] */
+    J[409] -= dqdci;              /* dwdot[A1-]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[30][2] - 1)*dcdc_fac;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[976] += dqdci;              /* dwdot[A1]/d[CH4] */
+    J[977] -= dqdci;              /* dwdot[A1-]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[30][3] - 1)*dcdc_fac;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[1047] += dqdci;             /* dwdot[A1]/d[CO] */
+    J[1048] -= dqdci;             /* dwdot[A1-]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[30][4] - 1)*dcdc_fac;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1118] += dqdci;             /* dwdot[A1]/d[CO2] */
+    J[1119] -= dqdci;             /* dwdot[A1-]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[30][6] - 1)*dcdc_fac;
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1757] += dqdci;             /* dwdot[A1]/d[C2H4] */
+    J[1758] -= dqdci;             /* dwdot[A1-]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[30][5] - 1)*dcdc_fac;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1899] += dqdci;             /* dwdot[A1]/d[C2H6] */
+    J[1900] -= dqdci;             /* dwdot[A1-]/d[C2H6] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[30][7] - 1)*dcdc_fac;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2538] += dqdci;             /* dwdot[A1]/d[pC3H4] */
+    J[2539] -= dqdci;             /* dwdot[A1-]/d[pC3H4] */
+    /* d()/d[A1] */
+    dqdci =  - k_r;
+    J[3764] -= dqdci;             /* dwdot[H]/d[A1] */
+    J[3816] += dqdci;             /* dwdot[A1]/d[A1] */
+    J[3817] -= dqdci;             /* dwdot[A1-]/d[A1] */
+    /* d()/d[A1-] */
+    dqdci =  + k_f*sc[1];
+    J[3835] -= dqdci;             /* dwdot[H]/d[A1-] */
+    J[3887] += dqdci;             /* dwdot[A1]/d[A1-] */
+    J[3888] -= dqdci;             /* dwdot[A1-]/d[A1-] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[30][9] - 1)*dcdc_fac;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4455] += dqdci;             /* dwdot[A1]/d[C3H8] */
+    J[4456] -= dqdci;             /* dwdot[A1-]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[30][8] - 1)*dcdc_fac;
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4668] += dqdci;             /* dwdot[A1]/d[C3H6] */
+    J[4669] -= dqdci;             /* dwdot[A1-]/d[C3H6] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[5023] += dqdT; /* dwdot[A1]/dT */
     J[5024] -= dqdT; /* dwdot[A1-]/dT */
@@ -40327,11 +39081,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[31][0] - 1)*sc[0] + (TB[31][1] - 1)*sc[5] + (TB[31][2] - 1)*sc[13] + (TB[31][3] - 1)*sc[14] + (TB[31][4] - 1)*sc[15] + (TB[31][5] - 1)*sc[26] + (TB[31][6] - 1)*sc[24] + (TB[31][7] - 1)*sc[35] + (TB[31][8] - 1)*sc[65] + (TB[31][9] - 1)*sc[62];
+    alpha = (memcmp(TB[31], TB[3], 10*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[31][0] - 1)*sc[0] + (TB[31][1] - 1)*sc[5] + (TB[31][2] - 1)*sc[13] + (TB[31][3] - 1)*sc[14] + (TB[31][4] - 1)*sc[15] + (TB[31][5] - 1)*sc[26] + (TB[31][6] - 1)*sc[24] + (TB[31][7] - 1)*sc[35] + (TB[31][8] - 1)*sc[65] + (TB[31][9] - 1)*sc[62]);
     /* forward */
     phi_f = sc[1]*sc[55];
-    k_f = prefactor_units[31] * fwd_A[31]
-                * exp(fwd_beta[31] * tc[0] - activation_units[31] * fwd_Ea[31] * invT);
+    k_f = k_f_s[31];
     dlnkfdT = fwd_beta[31] * invT + activation_units[31] * fwd_Ea[31] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[31] * exp(low_beta[31] * tc[0] - activation_units[31] * low_Ea[31] * invT);
@@ -40347,16 +39100,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[31] == 4 ? exp(-troe_Tss[31] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[31]) > 1.e-100 ? -Fcent1/troe_Tsss[31] : 0.)
+      + (fabs(troe_Ts[31]) > 1.e-100 ? -Fcent2/troe_Ts[31] : 0.)
+      + (troe_len[31] == 4 ? Fcent3*troe_Tss[31]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[31]) > 1.e-100 ? -Fcent1/troe_Tsss[31] : 0.)
-      + (fabs(troe_Ts[31]) > 1.e-100 ? -Fcent2/troe_Ts[31] : 0.)
-      + (troe_len[31] == 4 ? Fcent3*troe_Tss[31]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -40364,7 +39117,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[56];
-    Kc = refCinv * exp(g_RT[1] + g_RT[55] - g_RT[56]);
+    Kc = Kc_s[31];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[55]) + (h_RT[56]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40382,150 +39135,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[31][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[55] -= dqdci;               /* dwdot[C6H5O]/d[H2] */
-        J[56] += dqdci;               /* dwdot[C6H5OH]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[55];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[126] -= dqdci;              /* dwdot[C6H5O]/d[H] */
-        J[127] += dqdci;              /* dwdot[C6H5OH]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[31][1] - 1)*dcdc_fac;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[410] -= dqdci;              /* dwdot[C6H5O]/d[H2O] */
-        J[411] += dqdci;              /* dwdot[C6H5OH]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[31][2] - 1)*dcdc_fac;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[978] -= dqdci;              /* dwdot[C6H5O]/d[CH4] */
-        J[979] += dqdci;              /* dwdot[C6H5OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[31][3] - 1)*dcdc_fac;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[1049] -= dqdci;             /* dwdot[C6H5O]/d[CO] */
-        J[1050] += dqdci;             /* dwdot[C6H5OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[31][4] - 1)*dcdc_fac;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1120] -= dqdci;             /* dwdot[C6H5O]/d[CO2] */
-        J[1121] += dqdci;             /* dwdot[C6H5OH]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[31][6] - 1)*dcdc_fac;
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1759] -= dqdci;             /* dwdot[C6H5O]/d[C2H4] */
-        J[1760] += dqdci;             /* dwdot[C6H5OH]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[31][5] - 1)*dcdc_fac;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1901] -= dqdci;             /* dwdot[C6H5O]/d[C2H6] */
-        J[1902] += dqdci;             /* dwdot[C6H5OH]/d[C2H6] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[31][7] - 1)*dcdc_fac;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2540] -= dqdci;             /* dwdot[C6H5O]/d[pC3H4] */
-        J[2541] += dqdci;             /* dwdot[C6H5OH]/d[pC3H4] */
-        /* d()/d[C6H5O] */
-        dqdci =  + k_f*sc[1];
-        J[3906] -= dqdci;             /* dwdot[H]/d[C6H5O] */
-        J[3960] -= dqdci;             /* dwdot[C6H5O]/d[C6H5O] */
-        J[3961] += dqdci;             /* dwdot[C6H5OH]/d[C6H5O] */
-        /* d()/d[C6H5OH] */
-        dqdci =  - k_r;
-        J[3977] -= dqdci;             /* dwdot[H]/d[C6H5OH] */
-        J[4031] -= dqdci;             /* dwdot[C6H5O]/d[C6H5OH] */
-        J[4032] += dqdci;             /* dwdot[C6H5OH]/d[C6H5OH] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[31][9] - 1)*dcdc_fac;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4457] -= dqdci;             /* dwdot[C6H5O]/d[C3H8] */
-        J[4458] += dqdci;             /* dwdot[C6H5OH]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[31][8] - 1)*dcdc_fac;
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4670] -= dqdci;             /* dwdot[C6H5O]/d[C3H6] */
-        J[4671] += dqdci;             /* dwdot[C6H5OH]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[31][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[55];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[31][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[31][2]*dcdc_fac;
-        dqdc[14] = TB[31][3]*dcdc_fac;
-        dqdc[15] = TB[31][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[31][6]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[31][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[31][7]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac + k_f*sc[1];
-        dqdc[56] = dcdc_fac - k_r;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[31][9]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[31][8]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+55] -= dqdc[k];
-            J[71*k+56] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[55] -= dcdc_fac;
+    Jmix[56] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[31][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[55] -= dqdci;               /* dwdot[C6H5O]/d[H2] */
+    J[56] += dqdci;               /* dwdot[C6H5OH]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[55];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[126] -= dqdci;              /* dwdot[C6H5O]/d[H] */
+    J[127] += dqdci;              /* dwdot[C6H5OH]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[31][1] - 1)*dcdc_fac;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[410] -= dqdci;              /* dwdot[C6H5O]/d[H2O] */
+    J[411] += dqdci;              /* dwdot[C6H5OH]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[31][2] - 1)*dcdc_fac;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[978] -= dqdci;              /* dwdot[C6H5O]/d[CH4] */
+    J[979] += dqdci;              /* dwdot[C6H5OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[31][3] - 1)*dcdc_fac;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[1049] -= dqdci;             /* dwdot[C6H5O]/d[CO] */
+    J[1050] += dqdci;             /* dwdot[C6H5OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[31][4] - 1)*dcdc_fac;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1120] -= dqdci;             /* dwdot[C6H5O]/d[CO2] */
+    J[1121] += dqdci;             /* dwdot[C6H5OH]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[31][6] - 1)*dcdc_fac;
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1759] -= dqdci;             /* dwdot[C6H5O]/d[C2H4] */
+    J[1760] += dqdci;             /* dwdot[C6H5OH]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[31][5] - 1)*dcdc_fac;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1901] -= dqdci;             /* dwdot[C6H5O]/d[C2H6] */
+    J[1902] += dqdci;             /* dwdot[C6H5OH]/d[C2H6] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[31][7] - 1)*dcdc_fac;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2540] -= dqdci;             /* dwdot[C6H5O]/d[pC3H4] */
+    J[2541] += dqdci;             /* dwdot[C6H5OH]/d[pC3H4] */
+    /* d()/d[C6H5O] */
+    dqdci =  + k_f*sc[1];
+    J[3906] -= dqdci;             /* dwdot[H]/d[C6H5O] */
+    J[3960] -= dqdci;             /* dwdot[C6H5O]/d[C6H5O] */
+    J[3961] += dqdci;             /* dwdot[C6H5OH]/d[C6H5O] */
+    /* d()/d[C6H5OH] */
+    dqdci =  - k_r;
+    J[3977] -= dqdci;             /* dwdot[H]/d[C6H5OH] */
+    J[4031] -= dqdci;             /* dwdot[C6H5O]/d[C6H5OH] */
+    J[4032] += dqdci;             /* dwdot[C6H5OH]/d[C6H5OH] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[31][9] - 1)*dcdc_fac;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4457] -= dqdci;             /* dwdot[C6H5O]/d[C3H8] */
+    J[4458] += dqdci;             /* dwdot[C6H5OH]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[31][8] - 1)*dcdc_fac;
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4670] -= dqdci;             /* dwdot[C6H5O]/d[C3H6] */
+    J[4671] += dqdci;             /* dwdot[C6H5OH]/d[C3H6] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[5025] -= dqdT; /* dwdot[C6H5O]/dT */
     J[5026] += dqdT; /* dwdot[C6H5OH]/dT */
@@ -40534,11 +39212,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[32][0] - 1)*sc[0] + (TB[32][1] - 1)*sc[5] + (TB[32][2] - 1)*sc[13] + (TB[32][3] - 1)*sc[14] + (TB[32][4] - 1)*sc[15] + (TB[32][5] - 1)*sc[26] + (TB[32][6] - 1)*sc[24] + (TB[32][7] - 1)*sc[35] + (TB[32][8] - 1)*sc[65] + (TB[32][9] - 1)*sc[62];
+    alpha = (memcmp(TB[32], TB[3], 10*sizeof(double)) == 0 ? alpha_eff1 : mixture + (TB[32][0] - 1)*sc[0] + (TB[32][1] - 1)*sc[5] + (TB[32][2] - 1)*sc[13] + (TB[32][3] - 1)*sc[14] + (TB[32][4] - 1)*sc[15] + (TB[32][5] - 1)*sc[26] + (TB[32][6] - 1)*sc[24] + (TB[32][7] - 1)*sc[35] + (TB[32][8] - 1)*sc[65] + (TB[32][9] - 1)*sc[62]);
     /* forward */
     phi_f = sc[1]*sc[58];
-    k_f = prefactor_units[32] * fwd_A[32]
-                * exp(fwd_beta[32] * tc[0] - activation_units[32] * fwd_Ea[32] * invT);
+    k_f = k_f_s[32];
     dlnkfdT = fwd_beta[32] * invT + activation_units[32] * fwd_Ea[32] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[32] * exp(low_beta[32] * tc[0] - activation_units[32] * low_Ea[32] * invT);
@@ -40554,16 +39231,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[32] == 4 ? exp(-troe_Tss[32] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[32]) > 1.e-100 ? -Fcent1/troe_Tsss[32] : 0.)
+      + (fabs(troe_Ts[32]) > 1.e-100 ? -Fcent2/troe_Ts[32] : 0.)
+      + (troe_len[32] == 4 ? Fcent3*troe_Tss[32]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[32]) > 1.e-100 ? -Fcent1/troe_Tsss[32] : 0.)
-      + (fabs(troe_Ts[32]) > 1.e-100 ? -Fcent2/troe_Ts[32] : 0.)
-      + (troe_len[32] == 4 ? Fcent3*troe_Tss[32]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -40571,7 +39248,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[57];
-    Kc = refCinv * exp(g_RT[1] - g_RT[57] + g_RT[58]);
+    Kc = Kc_s[32];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[58]) + (h_RT[57]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40589,150 +39266,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[32][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[57] += dqdci;               /* dwdot[C5H6]/d[H2] */
-        J[58] -= dqdci;               /* dwdot[C5H5]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[58];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[128] += dqdci;              /* dwdot[C5H6]/d[H] */
-        J[129] -= dqdci;              /* dwdot[C5H5]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[32][1] - 1)*dcdc_fac;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[412] += dqdci;              /* dwdot[C5H6]/d[H2O] */
-        J[413] -= dqdci;              /* dwdot[C5H5]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[32][2] - 1)*dcdc_fac;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[980] += dqdci;              /* dwdot[C5H6]/d[CH4] */
-        J[981] -= dqdci;              /* dwdot[C5H5]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[32][3] - 1)*dcdc_fac;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[1051] += dqdci;             /* dwdot[C5H6]/d[CO] */
-        J[1052] -= dqdci;             /* dwdot[C5H5]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[32][4] - 1)*dcdc_fac;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1122] += dqdci;             /* dwdot[C5H6]/d[CO2] */
-        J[1123] -= dqdci;             /* dwdot[C5H5]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[32][6] - 1)*dcdc_fac;
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1761] += dqdci;             /* dwdot[C5H6]/d[C2H4] */
-        J[1762] -= dqdci;             /* dwdot[C5H5]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[32][5] - 1)*dcdc_fac;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1903] += dqdci;             /* dwdot[C5H6]/d[C2H6] */
-        J[1904] -= dqdci;             /* dwdot[C5H5]/d[C2H6] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[32][7] - 1)*dcdc_fac;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2542] += dqdci;             /* dwdot[C5H6]/d[pC3H4] */
-        J[2543] -= dqdci;             /* dwdot[C5H5]/d[pC3H4] */
-        /* d()/d[C5H6] */
-        dqdci =  - k_r;
-        J[4048] -= dqdci;             /* dwdot[H]/d[C5H6] */
-        J[4104] += dqdci;             /* dwdot[C5H6]/d[C5H6] */
-        J[4105] -= dqdci;             /* dwdot[C5H5]/d[C5H6] */
-        /* d()/d[C5H5] */
-        dqdci =  + k_f*sc[1];
-        J[4119] -= dqdci;             /* dwdot[H]/d[C5H5] */
-        J[4175] += dqdci;             /* dwdot[C5H6]/d[C5H5] */
-        J[4176] -= dqdci;             /* dwdot[C5H5]/d[C5H5] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[32][9] - 1)*dcdc_fac;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4459] += dqdci;             /* dwdot[C5H6]/d[C3H8] */
-        J[4460] -= dqdci;             /* dwdot[C5H5]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[32][8] - 1)*dcdc_fac;
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4672] += dqdci;             /* dwdot[C5H6]/d[C3H6] */
-        J[4673] -= dqdci;             /* dwdot[C5H5]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[32][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[58];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[32][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[32][2]*dcdc_fac;
-        dqdc[14] = TB[32][3]*dcdc_fac;
-        dqdc[15] = TB[32][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[32][6]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[32][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[32][7]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac - k_r;
-        dqdc[58] = dcdc_fac + k_f*sc[1];
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[32][9]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[32][8]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+57] += dqdc[k];
-            J[71*k+58] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[57] += dcdc_fac;
+    Jmix[58] -= dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[32][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[57] += dqdci;               /* dwdot[C5H6]/d[H2] */
+    J[58] -= dqdci;               /* dwdot[C5H5]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[58];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[128] += dqdci;              /* dwdot[C5H6]/d[H] */
+    J[129] -= dqdci;              /* dwdot[C5H5]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[32][1] - 1)*dcdc_fac;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[412] += dqdci;              /* dwdot[C5H6]/d[H2O] */
+    J[413] -= dqdci;              /* dwdot[C5H5]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[32][2] - 1)*dcdc_fac;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[980] += dqdci;              /* dwdot[C5H6]/d[CH4] */
+    J[981] -= dqdci;              /* dwdot[C5H5]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[32][3] - 1)*dcdc_fac;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[1051] += dqdci;             /* dwdot[C5H6]/d[CO] */
+    J[1052] -= dqdci;             /* dwdot[C5H5]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[32][4] - 1)*dcdc_fac;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1122] += dqdci;             /* dwdot[C5H6]/d[CO2] */
+    J[1123] -= dqdci;             /* dwdot[C5H5]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[32][6] - 1)*dcdc_fac;
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1761] += dqdci;             /* dwdot[C5H6]/d[C2H4] */
+    J[1762] -= dqdci;             /* dwdot[C5H5]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[32][5] - 1)*dcdc_fac;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1903] += dqdci;             /* dwdot[C5H6]/d[C2H6] */
+    J[1904] -= dqdci;             /* dwdot[C5H5]/d[C2H6] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[32][7] - 1)*dcdc_fac;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2542] += dqdci;             /* dwdot[C5H6]/d[pC3H4] */
+    J[2543] -= dqdci;             /* dwdot[C5H5]/d[pC3H4] */
+    /* d()/d[C5H6] */
+    dqdci =  - k_r;
+    J[4048] -= dqdci;             /* dwdot[H]/d[C5H6] */
+    J[4104] += dqdci;             /* dwdot[C5H6]/d[C5H6] */
+    J[4105] -= dqdci;             /* dwdot[C5H5]/d[C5H6] */
+    /* d()/d[C5H5] */
+    dqdci =  + k_f*sc[1];
+    J[4119] -= dqdci;             /* dwdot[H]/d[C5H5] */
+    J[4175] += dqdci;             /* dwdot[C5H6]/d[C5H5] */
+    J[4176] -= dqdci;             /* dwdot[C5H5]/d[C5H5] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[32][9] - 1)*dcdc_fac;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4459] += dqdci;             /* dwdot[C5H6]/d[C3H8] */
+    J[4460] -= dqdci;             /* dwdot[C5H5]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[32][8] - 1)*dcdc_fac;
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4672] += dqdci;             /* dwdot[C5H6]/d[C3H6] */
+    J[4673] -= dqdci;             /* dwdot[C5H5]/d[C3H6] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[5027] += dqdT; /* dwdot[C5H6]/dT */
     J[5028] -= dqdT; /* dwdot[C5H5]/dT */
@@ -40741,11 +39343,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[33][0] - 1)*sc[0] + (TB[33][1] - 1)*sc[5] + (TB[33][2] - 1)*sc[13] + (TB[33][3] - 1)*sc[14] + (TB[33][4] - 1)*sc[15] + (TB[33][5] - 1)*sc[26] + (TB[33][6] - 1)*sc[30] + (TB[33][7] - 1)*sc[24] + (TB[33][8] - 1)*sc[35] + (TB[33][9] - 1)*sc[65] + (TB[33][10] - 1)*sc[62];
+    alpha = (memcmp(TB[33], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[33][0] - 1)*sc[0] + (TB[33][1] - 1)*sc[5] + (TB[33][2] - 1)*sc[13] + (TB[33][3] - 1)*sc[14] + (TB[33][4] - 1)*sc[15] + (TB[33][5] - 1)*sc[26] + (TB[33][6] - 1)*sc[30] + (TB[33][7] - 1)*sc[24] + (TB[33][8] - 1)*sc[35] + (TB[33][9] - 1)*sc[65] + (TB[33][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[12]*sc[66];
-    k_f = prefactor_units[33] * fwd_A[33]
-                * exp(fwd_beta[33] * tc[0] - activation_units[33] * fwd_Ea[33] * invT);
+    k_f = k_f_s[33];
     dlnkfdT = fwd_beta[33] * invT + activation_units[33] * fwd_Ea[33] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[33] * exp(low_beta[33] * tc[0] - activation_units[33] * low_Ea[33] * invT);
@@ -40761,16 +39362,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[33] == 4 ? exp(-troe_Tss[33] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[33]) > 1.e-100 ? -Fcent1/troe_Tsss[33] : 0.)
+      + (fabs(troe_Ts[33]) > 1.e-100 ? -Fcent2/troe_Ts[33] : 0.)
+      + (troe_len[33] == 4 ? Fcent3*troe_Tss[33]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[33]) > 1.e-100 ? -Fcent1/troe_Tsss[33] : 0.)
-      + (fabs(troe_Ts[33]) > 1.e-100 ? -Fcent2/troe_Ts[33] : 0.)
-      + (troe_len[33] == 4 ? Fcent3*troe_Tss[33]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -40778,7 +39379,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[47];
-    Kc = refCinv * exp(g_RT[12] - g_RT[47] + g_RT[66]);
+    Kc = Kc_s[33];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[66]) + (h_RT[47]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -40796,155 +39397,80 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[33][0] - 1)*dcdc_fac;
-        J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
-        J[47] += dqdci;               /* dwdot[C4H81]/d[H2] */
-        J[66] -= dqdci;               /* dwdot[aC3H5]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[33][1] - 1)*dcdc_fac;
-        J[367] -= dqdci;              /* dwdot[CH3]/d[H2O] */
-        J[402] += dqdci;              /* dwdot[C4H81]/d[H2O] */
-        J[421] -= dqdci;              /* dwdot[aC3H5]/d[H2O] */
-        /* d()/d[CH3] */
-        dqdci =  + k_f*sc[66];
-        J[864] -= dqdci;              /* dwdot[CH3]/d[CH3] */
-        J[899] += dqdci;              /* dwdot[C4H81]/d[CH3] */
-        J[918] -= dqdci;              /* dwdot[aC3H5]/d[CH3] */
-        /* d()/d[CH4] */
-        dqdci = (TB[33][2] - 1)*dcdc_fac;
-        J[935] -= dqdci;              /* dwdot[CH3]/d[CH4] */
-        J[970] += dqdci;              /* dwdot[C4H81]/d[CH4] */
-        J[989] -= dqdci;              /* dwdot[aC3H5]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[33][3] - 1)*dcdc_fac;
-        J[1006] -= dqdci;             /* dwdot[CH3]/d[CO] */
-        J[1041] += dqdci;             /* dwdot[C4H81]/d[CO] */
-        J[1060] -= dqdci;             /* dwdot[aC3H5]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[33][4] - 1)*dcdc_fac;
-        J[1077] -= dqdci;             /* dwdot[CH3]/d[CO2] */
-        J[1112] += dqdci;             /* dwdot[C4H81]/d[CO2] */
-        J[1131] -= dqdci;             /* dwdot[aC3H5]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[33][7] - 1)*dcdc_fac;
-        J[1716] -= dqdci;             /* dwdot[CH3]/d[C2H4] */
-        J[1751] += dqdci;             /* dwdot[C4H81]/d[C2H4] */
-        J[1770] -= dqdci;             /* dwdot[aC3H5]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[33][5] - 1)*dcdc_fac;
-        J[1858] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
-        J[1893] += dqdci;             /* dwdot[C4H81]/d[C2H6] */
-        J[1912] -= dqdci;             /* dwdot[aC3H5]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[33][6] - 1)*dcdc_fac;
-        J[2142] -= dqdci;             /* dwdot[CH3]/d[AR] */
-        J[2177] += dqdci;             /* dwdot[C4H81]/d[AR] */
-        J[2196] -= dqdci;             /* dwdot[aC3H5]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[33][8] - 1)*dcdc_fac;
-        J[2497] -= dqdci;             /* dwdot[CH3]/d[pC3H4] */
-        J[2532] += dqdci;             /* dwdot[C4H81]/d[pC3H4] */
-        J[2551] -= dqdci;             /* dwdot[aC3H5]/d[pC3H4] */
-        /* d()/d[C4H81] */
-        dqdci =  - k_r;
-        J[3349] -= dqdci;             /* dwdot[CH3]/d[C4H81] */
-        J[3384] += dqdci;             /* dwdot[C4H81]/d[C4H81] */
-        J[3403] -= dqdci;             /* dwdot[aC3H5]/d[C4H81] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[33][10] - 1)*dcdc_fac;
-        J[4414] -= dqdci;             /* dwdot[CH3]/d[C3H8] */
-        J[4449] += dqdci;             /* dwdot[C4H81]/d[C3H8] */
-        J[4468] -= dqdci;             /* dwdot[aC3H5]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[33][9] - 1)*dcdc_fac;
-        J[4627] -= dqdci;             /* dwdot[CH3]/d[C3H6] */
-        J[4662] += dqdci;             /* dwdot[C4H81]/d[C3H6] */
-        J[4681] -= dqdci;             /* dwdot[aC3H5]/d[C3H6] */
-        /* d()/d[aC3H5] */
-        dqdci =  + k_f*sc[12];
-        J[4698] -= dqdci;             /* dwdot[CH3]/d[aC3H5] */
-        J[4733] += dqdci;             /* dwdot[C4H81]/d[aC3H5] */
-        J[4752] -= dqdci;             /* dwdot[aC3H5]/d[aC3H5] */
-    }
-    else {
-        dqdc[0] = TB[33][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[33][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac + k_f*sc[66];
-        dqdc[13] = TB[33][2]*dcdc_fac;
-        dqdc[14] = TB[33][3]*dcdc_fac;
-        dqdc[15] = TB[33][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[33][7]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[33][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[33][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[33][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac - k_r;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[33][10]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[33][9]*dcdc_fac;
-        dqdc[66] = dcdc_fac + k_f*sc[12];
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+12] -= dqdc[k];
-            J[71*k+47] += dqdc[k];
-            J[71*k+66] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[12] -= dcdc_fac;
+    Jmix[47] += dcdc_fac;
+    Jmix[66] -= dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[33][0] - 1)*dcdc_fac;
+    J[12] -= dqdci;               /* dwdot[CH3]/d[H2] */
+    J[47] += dqdci;               /* dwdot[C4H81]/d[H2] */
+    J[66] -= dqdci;               /* dwdot[aC3H5]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[33][1] - 1)*dcdc_fac;
+    J[367] -= dqdci;              /* dwdot[CH3]/d[H2O] */
+    J[402] += dqdci;              /* dwdot[C4H81]/d[H2O] */
+    J[421] -= dqdci;              /* dwdot[aC3H5]/d[H2O] */
+    /* d()/d[CH3] */
+    dqdci =  + k_f*sc[66];
+    J[864] -= dqdci;              /* dwdot[CH3]/d[CH3] */
+    J[899] += dqdci;              /* dwdot[C4H81]/d[CH3] */
+    J[918] -= dqdci;              /* dwdot[aC3H5]/d[CH3] */
+    /* d()/d[CH4] */
+    dqdci = (TB[33][2] - 1)*dcdc_fac;
+    J[935] -= dqdci;              /* dwdot[CH3]/d[CH4] */
+    J[970] += dqdci;              /* dwdot[C4H81]/d[CH4] */
+    J[989] -= dqdci;              /* dwdot[aC3H5]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[33][3] - 1)*dcdc_fac;
+    J[1006] -= dqdci;             /* dwdot[CH3]/d[CO] */
+    J[1041] += dqdci;             /* dwdot[C4H81]/d[CO] */
+    J[1060] -= dqdci;             /* dwdot[aC3H5]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[33][4] - 1)*dcdc_fac;
+    J[1077] -= dqdci;             /* dwdot[CH3]/d[CO2] */
+    J[1112] += dqdci;             /* dwdot[C4H81]/d[CO2] */
+    J[1131] -= dqdci;             /* dwdot[aC3H5]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[33][7] - 1)*dcdc_fac;
+    J[1716] -= dqdci;             /* dwdot[CH3]/d[C2H4] */
+    J[1751] += dqdci;             /* dwdot[C4H81]/d[C2H4] */
+    J[1770] -= dqdci;             /* dwdot[aC3H5]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[33][5] - 1)*dcdc_fac;
+    J[1858] -= dqdci;             /* dwdot[CH3]/d[C2H6] */
+    J[1893] += dqdci;             /* dwdot[C4H81]/d[C2H6] */
+    J[1912] -= dqdci;             /* dwdot[aC3H5]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[33][6] - 1)*dcdc_fac;
+    J[2142] -= dqdci;             /* dwdot[CH3]/d[AR] */
+    J[2177] += dqdci;             /* dwdot[C4H81]/d[AR] */
+    J[2196] -= dqdci;             /* dwdot[aC3H5]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[33][8] - 1)*dcdc_fac;
+    J[2497] -= dqdci;             /* dwdot[CH3]/d[pC3H4] */
+    J[2532] += dqdci;             /* dwdot[C4H81]/d[pC3H4] */
+    J[2551] -= dqdci;             /* dwdot[aC3H5]/d[pC3H4] */
+    /* d()/d[C4H81] */
+    dqdci =  - k_r;
+    J[3349] -= dqdci;             /* dwdot[CH3]/d[C4H81] */
+    J[3384] += dqdci;             /* dwdot[C4H81]/d[C4H81] */
+    J[3403] -= dqdci;             /* dwdot[aC3H5]/d[C4H81] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[33][10] - 1)*dcdc_fac;
+    J[4414] -= dqdci;             /* dwdot[CH3]/d[C3H8] */
+    J[4449] += dqdci;             /* dwdot[C4H81]/d[C3H8] */
+    J[4468] -= dqdci;             /* dwdot[aC3H5]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[33][9] - 1)*dcdc_fac;
+    J[4627] -= dqdci;             /* dwdot[CH3]/d[C3H6] */
+    J[4662] += dqdci;             /* dwdot[C4H81]/d[C3H6] */
+    J[4681] -= dqdci;             /* dwdot[aC3H5]/d[C3H6] */
+    /* d()/d[aC3H5] */
+    dqdci =  + k_f*sc[12];
+    J[4698] -= dqdci;             /* dwdot[CH3]/d[aC3H5] */
+    J[4733] += dqdci;             /* dwdot[C4H81]/d[aC3H5] */
+    J[4752] -= dqdci;             /* dwdot[aC3H5]/d[aC3H5] */
     J[4982] -= dqdT; /* dwdot[CH3]/dT */
     J[5017] += dqdT; /* dwdot[C4H81]/dT */
     J[5036] -= dqdT; /* dwdot[aC3H5]/dT */
@@ -40956,11 +39482,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[34][0] - 1)*sc[0] + (TB[34][1] - 1)*sc[5] + (TB[34][2] - 1)*sc[13] + (TB[34][3] - 1)*sc[14] + (TB[34][4] - 1)*sc[15] + (TB[34][5] - 1)*sc[26] + (TB[34][6] - 1)*sc[30];
     /* forward */
     phi_f = sc[1]*sc[48];
-    k_f = prefactor_units[34] * fwd_A[34]
-                * exp(fwd_beta[34] * tc[0] - activation_units[34] * fwd_Ea[34] * invT);
+    k_f = k_f_s[34];
     dlnkfdT = fwd_beta[34] * invT + activation_units[34] * fwd_Ea[34] * invT2;
     /* pressure-fall-off */
-    k_0 = low_A[34] * exp(low_beta[34] * tc[0] - activation_units[34] * low_Ea[34] * invT);
+    x_0 = low_beta[34] * tc[0] - activation_units[34] * low_Ea[34] * invT;
+    k_0 = low_A[34] * (x_0 == x_0_s[0] ? e_0_s[0] : exp(x_0));
     Pr = phase_units[34] * alpha / k_f * k_0;
     fPr = Pr / (1.0+Pr);
     dlnk0dT = low_beta[34] * invT + activation_units[34] * low_Ea[34] * invT2;
@@ -40968,21 +39494,28 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogfPrdT = dlogPrdT / (1.0+Pr);
     /* Troe form */
     logPr = log10(Pr);
-    Fcent1 = (fabs(troe_Tsss[34]) > 1.e-100 ? (1.-troe_a[34])*exp(-T/troe_Tsss[34]) : 0.);
-    Fcent2 = (fabs(troe_Ts[34]) > 1.e-100 ? troe_a[34] * exp(-T/troe_Ts[34]) : 0.);
-    Fcent3 = (troe_len[34] == 4 ? exp(-troe_Tss[34] * invT) : 0.);
-    Fcent = Fcent1 + Fcent2 + Fcent3;
-    logFcent = log10(Fcent);
+    if (troe_a[34] == troe_a[22] && troe_Tsss[34] == troe_Tsss[22] && troe_Ts[34] == troe_Ts[22]
+        && troe_Tss[34] == troe_Tss[22] && troe_len[34] == troe_len[22]) {
+        logFcent = logFcent_s[0];
+        dlogFcentdT = dlogFcentdT_s[0];
+    }
+    else {
+        Fcent1 = (fabs(troe_Tsss[34]) > 1.e-100 ? (1.-troe_a[34])*exp(-T/troe_Tsss[34]) : 0.);
+        Fcent2 = (fabs(troe_Ts[34]) > 1.e-100 ? troe_a[34] * exp(-T/troe_Ts[34]) : 0.);
+        Fcent3 = (troe_len[34] == 4 ? exp(-troe_Tss[34] * invT) : 0.);
+        Fcent = Fcent1 + Fcent2 + Fcent3;
+        logFcent = log10(Fcent);
+        dlogFcentdT = log10e/Fcent*( 
+            (fabs(troe_Tsss[34]) > 1.e-100 ? -Fcent1/troe_Tsss[34] : 0.)
+          + (fabs(troe_Ts[34]) > 1.e-100 ? -Fcent2/troe_Ts[34] : 0.)
+          + (troe_len[34] == 4 ? Fcent3*troe_Tss[34]*invT2 : 0.) );
+    }
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[34]) > 1.e-100 ? -Fcent1/troe_Tsss[34] : 0.)
-      + (fabs(troe_Ts[34]) > 1.e-100 ? -Fcent2/troe_Ts[34] : 0.)
-      + (troe_len[34] == 4 ? Fcent3*troe_Tss[34]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -40990,7 +39523,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[47];
-    Kc = refCinv * exp(g_RT[1] - g_RT[47] + g_RT[48]);
+    Kc = Kc_s[34];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[48]) + (h_RT[47]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41008,135 +39541,60 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[34][0] - 1)*dcdc_fac;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[47] += dqdci;               /* dwdot[C4H81]/d[H2] */
-        J[48] -= dqdci;               /* dwdot[C4H7]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[48];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[118] += dqdci;              /* dwdot[C4H81]/d[H] */
-        J[119] -= dqdci;              /* dwdot[C4H7]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[34][1] - 1)*dcdc_fac;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[402] += dqdci;              /* dwdot[C4H81]/d[H2O] */
-        J[403] -= dqdci;              /* dwdot[C4H7]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[34][2] - 1)*dcdc_fac;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[970] += dqdci;              /* dwdot[C4H81]/d[CH4] */
-        J[971] -= dqdci;              /* dwdot[C4H7]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[34][3] - 1)*dcdc_fac;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[1041] += dqdci;             /* dwdot[C4H81]/d[CO] */
-        J[1042] -= dqdci;             /* dwdot[C4H7]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[34][4] - 1)*dcdc_fac;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1112] += dqdci;             /* dwdot[C4H81]/d[CO2] */
-        J[1113] -= dqdci;             /* dwdot[C4H7]/d[CO2] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[34][5] - 1)*dcdc_fac;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1893] += dqdci;             /* dwdot[C4H81]/d[C2H6] */
-        J[1894] -= dqdci;             /* dwdot[C4H7]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[34][6] - 1)*dcdc_fac;
-        J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2177] += dqdci;             /* dwdot[C4H81]/d[AR] */
-        J[2178] -= dqdci;             /* dwdot[C4H7]/d[AR] */
-        /* d()/d[C4H81] */
-        dqdci =  - k_r;
-        J[3338] -= dqdci;             /* dwdot[H]/d[C4H81] */
-        J[3384] += dqdci;             /* dwdot[C4H81]/d[C4H81] */
-        J[3385] -= dqdci;             /* dwdot[C4H7]/d[C4H81] */
-        /* d()/d[C4H7] */
-        dqdci =  + k_f*sc[1];
-        J[3409] -= dqdci;             /* dwdot[H]/d[C4H7] */
-        J[3455] += dqdci;             /* dwdot[C4H81]/d[C4H7] */
-        J[3456] -= dqdci;             /* dwdot[C4H7]/d[C4H7] */
-    }
-    else {
-        dqdc[0] = TB[34][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[48];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[34][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[34][2]*dcdc_fac;
-        dqdc[14] = TB[34][3]*dcdc_fac;
-        dqdc[15] = TB[34][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[34][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[34][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac - k_r;
-        dqdc[48] = dcdc_fac + k_f*sc[1];
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+47] += dqdc[k];
-            J[71*k+48] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= dcdc_fac;
+    Jmix[47] += dcdc_fac;
+    Jmix[48] -= dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[34][0] - 1)*dcdc_fac;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[47] += dqdci;               /* dwdot[C4H81]/d[H2] */
+    J[48] -= dqdci;               /* dwdot[C4H7]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[48];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[118] += dqdci;              /* dwdot[C4H81]/d[H] */
+    J[119] -= dqdci;              /* dwdot[C4H7]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[34][1] - 1)*dcdc_fac;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[402] += dqdci;              /* dwdot[C4H81]/d[H2O] */
+    J[403] -= dqdci;              /* dwdot[C4H7]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[34][2] - 1)*dcdc_fac;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[970] += dqdci;              /* dwdot[C4H81]/d[CH4] */
+    J[971] -= dqdci;              /* dwdot[C4H7]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[34][3] - 1)*dcdc_fac;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[1041] += dqdci;             /* dwdot[C4H81]/d[CO] */
+    J[1042] -= dqdci;             /* dwdot[C4H7]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[34][4] - 1)*dcdc_fac;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1112] += dqdci;             /* dwdot[C4H81]/d[CO2] */
+    J[1113] -= dqdci;             /* dwdot[C4H7]/d[CO2] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[34][5] - 1)*dcdc_fac;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1893] += dqdci;             /* dwdot[C4H81]/d[C2H6] */
+    J[1894] -= dqdci;             /* dwdot[C4H7]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[34][6] - 1)*dcdc_fac;
+    J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2177] += dqdci;             /* dwdot[C4H81]/d[AR] */
+    J[2178] -= dqdci;             /* dwdot[C4H7]/d[AR] */
+    /* d()/d[C4H81] */
+    dqdci =  - k_r;
+    J[3338] -= dqdci;             /* dwdot[H]/d[C4H81] */
+    J[3384] += dqdci;             /* dwdot[C4H81]/d[C4H81] */
+    J[3385] -= dqdci;             /* dwdot[C4H7]/d[C4H81] */
+    /* d()/d[C4H7] */
+    dqdci =  + k_f*sc[1];
+    J[3409] -= dqdci;             /* dwdot[H]/d[C4H7] */
+    J[3455] += dqdci;             /* dwdot[C4H81]/d[C4H7] */
+    J[3456] -= dqdci;             /* dwdot[C4H7]/d[C4H7] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[5017] += dqdT; /* dwdot[C4H81]/dT */
     J[5018] -= dqdT; /* dwdot[C4H7]/dT */
@@ -41145,11 +39603,10 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a pressure-fall-off reaction */
     /* also 3-body */
     /* 3-body correction factor */
-    alpha = mixture + (TB[35][0] - 1)*sc[0] + (TB[35][1] - 1)*sc[5] + (TB[35][2] - 1)*sc[13] + (TB[35][3] - 1)*sc[14] + (TB[35][4] - 1)*sc[15] + (TB[35][5] - 1)*sc[26] + (TB[35][6] - 1)*sc[30] + (TB[35][7] - 1)*sc[24] + (TB[35][8] - 1)*sc[35] + (TB[35][9] - 1)*sc[65] + (TB[35][10] - 1)*sc[62];
+    alpha = (memcmp(TB[35], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[35][0] - 1)*sc[0] + (TB[35][1] - 1)*sc[5] + (TB[35][2] - 1)*sc[13] + (TB[35][3] - 1)*sc[14] + (TB[35][4] - 1)*sc[15] + (TB[35][5] - 1)*sc[26] + (TB[35][6] - 1)*sc[30] + (TB[35][7] - 1)*sc[24] + (TB[35][8] - 1)*sc[35] + (TB[35][9] - 1)*sc[65] + (TB[35][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[23]*sc[25];
-    k_f = prefactor_units[35] * fwd_A[35]
-                * exp(fwd_beta[35] * tc[0] - activation_units[35] * fwd_Ea[35] * invT);
+    k_f = k_f_s[35];
     dlnkfdT = fwd_beta[35] * invT + activation_units[35] * fwd_Ea[35] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[35] * exp(low_beta[35] * tc[0] - activation_units[35] * low_Ea[35] * invT);
@@ -41165,16 +39622,16 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     Fcent3 = (troe_len[35] == 4 ? exp(-troe_Tss[35] * invT) : 0.);
     Fcent = Fcent1 + Fcent2 + Fcent3;
     logFcent = log10(Fcent);
+    dlogFcentdT = log10e/Fcent*( 
+        (fabs(troe_Tsss[35]) > 1.e-100 ? -Fcent1/troe_Tsss[35] : 0.)
+      + (fabs(troe_Ts[35]) > 1.e-100 ? -Fcent2/troe_Ts[35] : 0.)
+      + (troe_len[35] == 4 ? Fcent3*troe_Tss[35]*invT2 : 0.) );
     troe_c = -.4 - .67 * logFcent;
     troe_n = .75 - 1.27 * logFcent;
     troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
     troePr = (troe_c + logPr) * troePr_den;
     troe = 1.0 / (1.0 + troePr*troePr);
     F = pow(10.0, logFcent * troe);
-    dlogFcentdT = log10e/Fcent*( 
-        (fabs(troe_Tsss[35]) > 1.e-100 ? -Fcent1/troe_Tsss[35] : 0.)
-      + (fabs(troe_Ts[35]) > 1.e-100 ? -Fcent2/troe_Ts[35] : 0.)
-      + (troe_len[35] == 4 ? Fcent3*troe_Tss[35]*invT2 : 0.) );
     dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
     dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
     dlogFdn = dlogFdcn_fac * troePr;
@@ -41182,7 +39639,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
     /* reverse */
     phi_r = sc[47];
-    Kc = refCinv * exp(g_RT[23] + g_RT[25] - g_RT[47]);
+    Kc = Kc_s[35];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[23] + h_RT[25]) + (h_RT[47]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41200,155 +39657,80 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[35][0] - 1)*dcdc_fac;
-        J[23] -= dqdci;               /* dwdot[C2H3]/d[H2] */
-        J[25] -= dqdci;               /* dwdot[C2H5]/d[H2] */
-        J[47] += dqdci;               /* dwdot[C4H81]/d[H2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[35][1] - 1)*dcdc_fac;
-        J[378] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
-        J[380] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
-        J[402] += dqdci;              /* dwdot[C4H81]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[35][2] - 1)*dcdc_fac;
-        J[946] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
-        J[948] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
-        J[970] += dqdci;              /* dwdot[C4H81]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[35][3] - 1)*dcdc_fac;
-        J[1017] -= dqdci;             /* dwdot[C2H3]/d[CO] */
-        J[1019] -= dqdci;             /* dwdot[C2H5]/d[CO] */
-        J[1041] += dqdci;             /* dwdot[C4H81]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[35][4] - 1)*dcdc_fac;
-        J[1088] -= dqdci;             /* dwdot[C2H3]/d[CO2] */
-        J[1090] -= dqdci;             /* dwdot[C2H5]/d[CO2] */
-        J[1112] += dqdci;             /* dwdot[C4H81]/d[CO2] */
-        /* d()/d[C2H3] */
-        dqdci =  + k_f*sc[25];
-        J[1656] -= dqdci;             /* dwdot[C2H3]/d[C2H3] */
-        J[1658] -= dqdci;             /* dwdot[C2H5]/d[C2H3] */
-        J[1680] += dqdci;             /* dwdot[C4H81]/d[C2H3] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[35][7] - 1)*dcdc_fac;
-        J[1727] -= dqdci;             /* dwdot[C2H3]/d[C2H4] */
-        J[1729] -= dqdci;             /* dwdot[C2H5]/d[C2H4] */
-        J[1751] += dqdci;             /* dwdot[C4H81]/d[C2H4] */
-        /* d()/d[C2H5] */
-        dqdci =  + k_f*sc[23];
-        J[1798] -= dqdci;             /* dwdot[C2H3]/d[C2H5] */
-        J[1800] -= dqdci;             /* dwdot[C2H5]/d[C2H5] */
-        J[1822] += dqdci;             /* dwdot[C4H81]/d[C2H5] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[35][5] - 1)*dcdc_fac;
-        J[1869] -= dqdci;             /* dwdot[C2H3]/d[C2H6] */
-        J[1871] -= dqdci;             /* dwdot[C2H5]/d[C2H6] */
-        J[1893] += dqdci;             /* dwdot[C4H81]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[35][6] - 1)*dcdc_fac;
-        J[2153] -= dqdci;             /* dwdot[C2H3]/d[AR] */
-        J[2155] -= dqdci;             /* dwdot[C2H5]/d[AR] */
-        J[2177] += dqdci;             /* dwdot[C4H81]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[35][8] - 1)*dcdc_fac;
-        J[2508] -= dqdci;             /* dwdot[C2H3]/d[pC3H4] */
-        J[2510] -= dqdci;             /* dwdot[C2H5]/d[pC3H4] */
-        J[2532] += dqdci;             /* dwdot[C4H81]/d[pC3H4] */
-        /* d()/d[C4H81] */
-        dqdci =  - k_r;
-        J[3360] -= dqdci;             /* dwdot[C2H3]/d[C4H81] */
-        J[3362] -= dqdci;             /* dwdot[C2H5]/d[C4H81] */
-        J[3384] += dqdci;             /* dwdot[C4H81]/d[C4H81] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[35][10] - 1)*dcdc_fac;
-        J[4425] -= dqdci;             /* dwdot[C2H3]/d[C3H8] */
-        J[4427] -= dqdci;             /* dwdot[C2H5]/d[C3H8] */
-        J[4449] += dqdci;             /* dwdot[C4H81]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[35][9] - 1)*dcdc_fac;
-        J[4638] -= dqdci;             /* dwdot[C2H3]/d[C3H6] */
-        J[4640] -= dqdci;             /* dwdot[C2H5]/d[C3H6] */
-        J[4662] += dqdci;             /* dwdot[C4H81]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[35][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[35][1]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[35][2]*dcdc_fac;
-        dqdc[14] = TB[35][3]*dcdc_fac;
-        dqdc[15] = TB[35][4]*dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac + k_f*sc[25];
-        dqdc[24] = TB[35][7]*dcdc_fac;
-        dqdc[25] = dcdc_fac + k_f*sc[23];
-        dqdc[26] = TB[35][5]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[35][6]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[35][8]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac - k_r;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[35][10]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[35][9]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+23] -= dqdc[k];
-            J[71*k+25] -= dqdc[k];
-            J[71*k+47] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[23] -= dcdc_fac;
+    Jmix[25] -= dcdc_fac;
+    Jmix[47] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[35][0] - 1)*dcdc_fac;
+    J[23] -= dqdci;               /* dwdot[C2H3]/d[H2] */
+    J[25] -= dqdci;               /* dwdot[C2H5]/d[H2] */
+    J[47] += dqdci;               /* dwdot[C4H81]/d[H2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[35][1] - 1)*dcdc_fac;
+    J[378] -= dqdci;              /* dwdot[C2H3]/d[H2O] */
+    J[380] -= dqdci;              /* dwdot[C2H5]/d[H2O] */
+    J[402] += dqdci;              /* dwdot[C4H81]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[35][2] - 1)*dcdc_fac;
+    J[946] -= dqdci;              /* dwdot[C2H3]/d[CH4] */
+    J[948] -= dqdci;              /* dwdot[C2H5]/d[CH4] */
+    J[970] += dqdci;              /* dwdot[C4H81]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[35][3] - 1)*dcdc_fac;
+    J[1017] -= dqdci;             /* dwdot[C2H3]/d[CO] */
+    J[1019] -= dqdci;             /* dwdot[C2H5]/d[CO] */
+    J[1041] += dqdci;             /* dwdot[C4H81]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[35][4] - 1)*dcdc_fac;
+    J[1088] -= dqdci;             /* dwdot[C2H3]/d[CO2] */
+    J[1090] -= dqdci;             /* dwdot[C2H5]/d[CO2] */
+    J[1112] += dqdci;             /* dwdot[C4H81]/d[CO2] */
+    /* d()/d[C2H3] */
+    dqdci =  + k_f*sc[25];
+    J[1656] -= dqdci;             /* dwdot[C2H3]/d[C2H3] */
+    J[1658] -= dqdci;             /* dwdot[C2H5]/d[C2H3] */
+    J[1680] += dqdci;             /* dwdot[C4H81]/d[C2H3] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[35][7] - 1)*dcdc_fac;
+    J[1727] -= dqdci;             /* dwdot[C2H3]/d[C2H4] */
+    J[1729] -= dqdci;             /* dwdot[C2H5]/d[C2H4] */
+    J[1751] += dqdci;             /* dwdot[C4H81]/d[C2H4] */
+    /* d()/d[C2H5] */
+    dqdci =  + k_f*sc[23];
+    J[1798] -= dqdci;             /* dwdot[C2H3]/d[C2H5] */
+    J[1800] -= dqdci;             /* dwdot[C2H5]/d[C2H5] */
+    J[1822] += dqdci;             /* dwdot[C4H81]/d[C2H5] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[35][5] - 1)*dcdc_fac;
+    J[1869] -= dqdci;             /* dwdot[C2H3]/d[C2H6] */
+    J[1871] -= dqdci;             /* dwdot[C2H5]/d[C2H6] */
+    J[1893] += dqdci;             /* dwdot[C4H81]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[35][6] - 1)*dcdc_fac;
+    J[2153] -= dqdci;             /* dwdot[C2H3]/d[AR] */
+    J[2155] -= dqdci;             /* dwdot[C2H5]/d[AR] */
+    J[2177] += dqdci;             /* dwdot[C4H81]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[35][8] - 1)*dcdc_fac;
+    J[2508] -= dqdci;             /* dwdot[C2H3]/d[pC3H4] */
+    J[2510] -= dqdci;             /* dwdot[C2H5]/d[pC3H4] */
+    J[2532] += dqdci;             /* dwdot[C4H81]/d[pC3H4] */
+    /* d()/d[C4H81] */
+    dqdci =  - k_r;
+    J[3360] -= dqdci;             /* dwdot[C2H3]/d[C4H81] */
+    J[3362] -= dqdci;             /* dwdot[C2H5]/d[C4H81] */
+    J[3384] += dqdci;             /* dwdot[C4H81]/d[C4H81] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[35][10] - 1)*dcdc_fac;
+    J[4425] -= dqdci;             /* dwdot[C2H3]/d[C3H8] */
+    J[4427] -= dqdci;             /* dwdot[C2H5]/d[C3H8] */
+    J[4449] += dqdci;             /* dwdot[C4H81]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[35][9] - 1)*dcdc_fac;
+    J[4638] -= dqdci;             /* dwdot[C2H3]/d[C3H6] */
+    J[4640] -= dqdci;             /* dwdot[C2H5]/d[C3H6] */
+    J[4662] += dqdci;             /* dwdot[C4H81]/d[C3H6] */
     J[4993] -= dqdT; /* dwdot[C2H3]/dT */
     J[4995] -= dqdT; /* dwdot[C2H5]/dT */
     J[5017] += dqdT; /* dwdot[C4H81]/dT */
@@ -41360,8 +39742,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[36][0] - 1)*sc[0] + (TB[36][1] - 1)*sc[3] + (TB[36][2] - 1)*sc[5] + (TB[36][3] - 1)*sc[13] + (TB[36][4] - 1)*sc[14] + (TB[36][5] - 1)*sc[15] + (TB[36][6] - 1)*sc[26] + (TB[36][7] - 1)*sc[30] + (TB[36][8] - 1)*sc[24] + (TB[36][9] - 1)*sc[35] + (TB[36][10] - 1)*sc[65] + (TB[36][11] - 1)*sc[62];
     /* forward */
     phi_f = sc[2]*sc[14];
-    k_f = prefactor_units[36] * fwd_A[36]
-                * exp(fwd_beta[36] * tc[0] - activation_units[36] * fwd_Ea[36] * invT);
+    k_f = k_f_s[36];
     dlnkfdT = fwd_beta[36] * invT + activation_units[36] * fwd_Ea[36] * invT2;
     /* pressure-fall-off */
     k_0 = low_A[36] * exp(low_beta[36] * tc[0] - activation_units[36] * low_Ea[36] * invT);
@@ -41376,7 +39757,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     dlogFdT = 0.0;
     /* reverse */
     phi_r = sc[15];
-    Kc = refCinv * exp(g_RT[2] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[36];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[14]) + (h_RT[15]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41394,150 +39775,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     k_f *= Corr;
     k_r *= Corr;
     dcdc_fac = q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[36][0] - 1)*dcdc_fac;
-        J[2] -= dqdci;                /* dwdot[O]/d[H2] */
-        J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
-        J[15] += dqdci;               /* dwdot[CO2]/d[H2] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[14];
-        J[144] -= dqdci;              /* dwdot[O]/d[O] */
-        J[156] -= dqdci;              /* dwdot[CO]/d[O] */
-        J[157] += dqdci;              /* dwdot[CO2]/d[O] */
-        /* d()/d[O2] */
-        dqdci = (TB[36][1] - 1)*dcdc_fac;
-        J[215] -= dqdci;              /* dwdot[O]/d[O2] */
-        J[227] -= dqdci;              /* dwdot[CO]/d[O2] */
-        J[228] += dqdci;              /* dwdot[CO2]/d[O2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[36][2] - 1)*dcdc_fac;
-        J[357] -= dqdci;              /* dwdot[O]/d[H2O] */
-        J[369] -= dqdci;              /* dwdot[CO]/d[H2O] */
-        J[370] += dqdci;              /* dwdot[CO2]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[36][3] - 1)*dcdc_fac;
-        J[925] -= dqdci;              /* dwdot[O]/d[CH4] */
-        J[937] -= dqdci;              /* dwdot[CO]/d[CH4] */
-        J[938] += dqdci;              /* dwdot[CO2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[36][4] - 1)*dcdc_fac + k_f*sc[2];
-        J[996] -= dqdci;              /* dwdot[O]/d[CO] */
-        J[1008] -= dqdci;             /* dwdot[CO]/d[CO] */
-        J[1009] += dqdci;             /* dwdot[CO2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[36][5] - 1)*dcdc_fac - k_r;
-        J[1067] -= dqdci;             /* dwdot[O]/d[CO2] */
-        J[1079] -= dqdci;             /* dwdot[CO]/d[CO2] */
-        J[1080] += dqdci;             /* dwdot[CO2]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[36][8] - 1)*dcdc_fac;
-        J[1706] -= dqdci;             /* dwdot[O]/d[C2H4] */
-        J[1718] -= dqdci;             /* dwdot[CO]/d[C2H4] */
-        J[1719] += dqdci;             /* dwdot[CO2]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[36][6] - 1)*dcdc_fac;
-        J[1848] -= dqdci;             /* dwdot[O]/d[C2H6] */
-        J[1860] -= dqdci;             /* dwdot[CO]/d[C2H6] */
-        J[1861] += dqdci;             /* dwdot[CO2]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[36][7] - 1)*dcdc_fac;
-        J[2132] -= dqdci;             /* dwdot[O]/d[AR] */
-        J[2144] -= dqdci;             /* dwdot[CO]/d[AR] */
-        J[2145] += dqdci;             /* dwdot[CO2]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[36][9] - 1)*dcdc_fac;
-        J[2487] -= dqdci;             /* dwdot[O]/d[pC3H4] */
-        J[2499] -= dqdci;             /* dwdot[CO]/d[pC3H4] */
-        J[2500] += dqdci;             /* dwdot[CO2]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[36][11] - 1)*dcdc_fac;
-        J[4404] -= dqdci;             /* dwdot[O]/d[C3H8] */
-        J[4416] -= dqdci;             /* dwdot[CO]/d[C3H8] */
-        J[4417] += dqdci;             /* dwdot[CO2]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[36][10] - 1)*dcdc_fac;
-        J[4617] -= dqdci;             /* dwdot[O]/d[C3H6] */
-        J[4629] -= dqdci;             /* dwdot[CO]/d[C3H6] */
-        J[4630] += dqdci;             /* dwdot[CO2]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[36][0]*dcdc_fac;
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*sc[14];
-        dqdc[3] = TB[36][1]*dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[36][2]*dcdc_fac;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[36][3]*dcdc_fac;
-        dqdc[14] = TB[36][4]*dcdc_fac + k_f*sc[2];
-        dqdc[15] = TB[36][5]*dcdc_fac - k_r;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[36][8]*dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[36][6]*dcdc_fac;
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[36][7]*dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[36][9]*dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[36][11]*dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[36][10]*dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+2] -= dqdc[k];
-            J[71*k+14] -= dqdc[k];
-            J[71*k+15] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] -= dcdc_fac;
+    Jmix[14] -= dcdc_fac;
+    Jmix[15] += dcdc_fac;
+    /* d()/d[H2] */
+    dqdci = (TB[36][0] - 1)*dcdc_fac;
+    J[2] -= dqdci;                /* dwdot[O]/d[H2] */
+    J[14] -= dqdci;               /* dwdot[CO]/d[H2] */
+    J[15] += dqdci;               /* dwdot[CO2]/d[H2] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[14];
+    J[144] -= dqdci;              /* dwdot[O]/d[O] */
+    J[156] -= dqdci;              /* dwdot[CO]/d[O] */
+    J[157] += dqdci;              /* dwdot[CO2]/d[O] */
+    /* d()/d[O2] */
+    dqdci = (TB[36][1] - 1)*dcdc_fac;
+    J[215] -= dqdci;              /* dwdot[O]/d[O2] */
+    J[227] -= dqdci;              /* dwdot[CO]/d[O2] */
+    J[228] += dqdci;              /* dwdot[CO2]/d[O2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[36][2] - 1)*dcdc_fac;
+    J[357] -= dqdci;              /* dwdot[O]/d[H2O] */
+    J[369] -= dqdci;              /* dwdot[CO]/d[H2O] */
+    J[370] += dqdci;              /* dwdot[CO2]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[36][3] - 1)*dcdc_fac;
+    J[925] -= dqdci;              /* dwdot[O]/d[CH4] */
+    J[937] -= dqdci;              /* dwdot[CO]/d[CH4] */
+    J[938] += dqdci;              /* dwdot[CO2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[36][4] - 1)*dcdc_fac + k_f*sc[2];
+    J[996] -= dqdci;              /* dwdot[O]/d[CO] */
+    J[1008] -= dqdci;             /* dwdot[CO]/d[CO] */
+    J[1009] += dqdci;             /* dwdot[CO2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[36][5] - 1)*dcdc_fac - k_r;
+    J[1067] -= dqdci;             /* dwdot[O]/d[CO2] */
+    J[1079] -= dqdci;             /* dwdot[CO]/d[CO2] */
+    J[1080] += dqdci;             /* dwdot[CO2]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[36][8] - 1)*dcdc_fac;
+    J[1706] -= dqdci;             /* dwdot[O]/d[C2H4] */
+    J[1718] -= dqdci;             /* dwdot[CO]/d[C2H4] */
+    J[1719] += dqdci;             /* dwdot[CO2]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[36][6] - 1)*dcdc_fac;
+    J[1848] -= dqdci;             /* dwdot[O]/d[C2H6] */
+    J[1860] -= dqdci;             /* dwdot[CO]/d[C2H6] */
+    J[1861] += dqdci;             /* dwdot[CO2]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[36][7] - 1)*dcdc_fac;
+    J[2132] -= dqdci;             /* dwdot[O]/d[AR] */
+    J[2144] -= dqdci;             /* dwdot[CO]/d[AR] */
+    J[2145] += dqdci;             /* dwdot[CO2]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[36][9] - 1)*dcdc_fac;
+    J[2487] -= dqdci;             /* dwdot[O]/d[pC3H4] */
+    J[2499] -= dqdci;             /* dwdot[CO]/d[pC3H4] */
+    J[2500] += dqdci;             /* dwdot[CO2]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[36][11] - 1)*dcdc_fac;
+    J[4404] -= dqdci;             /* dwdot[O]/d[C3H8] */
+    J[4416] -= dqdci;             /* dwdot[CO]/d[C3H8] */
+    J[4417] += dqdci;             /* dwdot[CO2]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[36][10] - 1)*dcdc_fac;
+    J[4617] -= dqdci;             /* dwdot[O]/d[C3H6] */
+    J[4629] -= dqdci;             /* dwdot[CO]/d[C3H6] */
+    J[4630] += dqdci;             /* dwdot[CO2]/d[C3H6] */
     J[4972] -= dqdT; /* dwdot[O]/dT */
     J[4984] -= dqdT; /* dwdot[CO]/dT */
     J[4985] += dqdT; /* dwdot[CO2]/dT */
@@ -41548,12 +39854,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[37][0] - 1)*sc[0] + (TB[37][1] - 1)*sc[5] + (TB[37][2] - 1)*sc[13] + (TB[37][3] - 1)*sc[14] + (TB[37][4] - 1)*sc[15] + (TB[37][5] - 1)*sc[26] + (TB[37][6] - 1)*sc[30] + (TB[37][7] - 1)*sc[24] + (TB[37][8] - 1)*sc[35] + (TB[37][9] - 1)*sc[65] + (TB[37][10] - 1)*sc[62];
     /* forward */
     phi_f = sc[2]*sc[2];
-    k_f = prefactor_units[37] * fwd_A[37]
-                * exp(fwd_beta[37] * tc[0] - activation_units[37] * fwd_Ea[37] * invT);
+    k_f = k_f_s[37];
     dlnkfdT = fwd_beta[37] * invT + activation_units[37] * fwd_Ea[37] * invT2;
     /* reverse */
     phi_r = sc[3];
-    Kc = refCinv * exp(2*g_RT[2] - g_RT[3]);
+    Kc = Kc_s[37];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[2]) + (h_RT[3]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41567,151 +39872,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[37][0] - 1)*q_nocor;
-        J[2] += -2 * dqdci;           /* dwdot[O]/d[H2] */
-        J[3] += dqdci;                /* dwdot[O2]/d[H2] */
-        /* d()/d[O] */
-        dqdci =  + k_f*2*sc[2];
-        J[144] += -2 * dqdci;         /* dwdot[O]/d[O] */
-        J[145] += dqdci;              /* dwdot[O2]/d[O] */
-        /* d()/d[O2] */
-        dqdci =  - k_r;
-        J[215] += -2 * dqdci;         /* dwdot[O]/d[O2] */
-        J[216] += dqdci;              /* dwdot[O2]/d[O2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[37][1] - 1)*q_nocor;
-        J[357] += -2 * dqdci;         /* dwdot[O]/d[H2O] */
-        J[358] += dqdci;              /* dwdot[O2]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[37][2] - 1)*q_nocor;
-        J[925] += -2 * dqdci;         /* dwdot[O]/d[CH4] */
-        J[926] += dqdci;              /* dwdot[O2]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[37][3] - 1)*q_nocor;
-        J[996] += -2 * dqdci;         /* dwdot[O]/d[CO] */
-        J[997] += dqdci;              /* dwdot[O2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[37][4] - 1)*q_nocor;
-        J[1067] += -2 * dqdci;        /* dwdot[O]/d[CO2] */
-        J[1068] += dqdci;             /* dwdot[O2]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[37][7] - 1)*q_nocor;
-        J[1706] += -2 * dqdci;        /* dwdot[O]/d[C2H4] */
-        J[1707] += dqdci;             /* dwdot[O2]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[37][5] - 1)*q_nocor;
-        J[1848] += -2 * dqdci;        /* dwdot[O]/d[C2H6] */
-        J[1849] += dqdci;             /* dwdot[O2]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[37][6] - 1)*q_nocor;
-        J[2132] += -2 * dqdci;        /* dwdot[O]/d[AR] */
-        J[2133] += dqdci;             /* dwdot[O2]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[37][8] - 1)*q_nocor;
-        J[2487] += -2 * dqdci;        /* dwdot[O]/d[pC3H4] */
-        J[2488] += dqdci;             /* dwdot[O2]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[37][10] - 1)*q_nocor;
-        J[4404] += -2 * dqdci;        /* dwdot[O]/d[C3H8] */
-        J[4405] += dqdci;             /* dwdot[O2]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[37][9] - 1)*q_nocor;
-        J[4617] += -2 * dqdci;        /* dwdot[O]/d[C3H6] */
-        J[4618] += dqdci;             /* dwdot[O2]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[37][0];
-        dqdc[1] = dcdc_fac;
-        dqdc[2] = dcdc_fac + k_f*2*sc[2];
-        dqdc[3] = dcdc_fac - k_r;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[37][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[37][2];
-        dqdc[14] = TB[37][3];
-        dqdc[15] = TB[37][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[37][7];
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[37][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[37][6];
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[37][8];
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[37][10];
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[37][9];
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+2] += -2 * dqdc[k];
-            J[71*k+3] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[2] += -2 * q_nocor;
+    Jmix[3] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[37][0] - 1)*q_nocor;
+    J[2] += -2 * dqdci;           /* dwdot[O]/d[H2] */
+    J[3] += dqdci;                /* dwdot[O2]/d[H2] */
+    /* d()/d[O] */
+    dqdci =  + k_f*2*sc[2];
+    J[144] += -2 * dqdci;         /* dwdot[O]/d[O] */
+    J[145] += dqdci;              /* dwdot[O2]/d[O] */
+    /* d()/d[O2] */
+    dqdci =  - k_r;
+    J[215] += -2 * dqdci;         /* dwdot[O]/d[O2] */
+    J[216] += dqdci;              /* dwdot[O2]/d[O2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[37][1] - 1)*q_nocor;
+    J[357] += -2 * dqdci;         /* dwdot[O]/d[H2O] */
+    J[358] += dqdci;              /* dwdot[O2]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[37][2] - 1)*q_nocor;
+    J[925] += -2 * dqdci;         /* dwdot[O]/d[CH4] */
+    J[926] += dqdci;              /* dwdot[O2]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[37][3] - 1)*q_nocor;
+    J[996] += -2 * dqdci;         /* dwdot[O]/d[CO] */
+    J[997] += dqdci;              /* dwdot[O2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[37][4] - 1)*q_nocor;
+    J[1067] += -2 * dqdci;        /* dwdot[O]/d[CO2] */
+    J[1068] += dqdci;             /* dwdot[O2]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[37][7] - 1)*q_nocor;
+    J[1706] += -2 * dqdci;        /* dwdot[O]/d[C2H4] */
+    J[1707] += dqdci;             /* dwdot[O2]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[37][5] - 1)*q_nocor;
+    J[1848] += -2 * dqdci;        /* dwdot[O]/d[C2H6] */
+    J[1849] += dqdci;             /* dwdot[O2]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[37][6] - 1)*q_nocor;
+    J[2132] += -2 * dqdci;        /* dwdot[O]/d[AR] */
+    J[2133] += dqdci;             /* dwdot[O2]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[37][8] - 1)*q_nocor;
+    J[2487] += -2 * dqdci;        /* dwdot[O]/d[pC3H4] */
+    J[2488] += dqdci;             /* dwdot[O2]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[37][10] - 1)*q_nocor;
+    J[4404] += -2 * dqdci;        /* dwdot[O]/d[C3H8] */
+    J[4405] += dqdci;             /* dwdot[O2]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[37][9] - 1)*q_nocor;
+    J[4617] += -2 * dqdci;        /* dwdot[O]/d[C3H6] */
+    J[4618] += dqdci;             /* dwdot[O2]/d[C3H6] */
     J[4972] += -2 * dqdT; /* dwdot[O]/dT */
     J[4973] += dqdT; /* dwdot[O2]/dT */
 
     /*reaction 39: O + H + M <=> OH + M */
     /*a third-body and non-pressure-fall-off reaction */
     /* 3-body correction factor */
-    alpha = mixture + (TB[38][0] - 1)*sc[0] + (TB[38][1] - 1)*sc[5] + (TB[38][2] - 1)*sc[13] + (TB[38][3] - 1)*sc[14] + (TB[38][4] - 1)*sc[15] + (TB[38][5] - 1)*sc[26] + (TB[38][6] - 1)*sc[30] + (TB[38][7] - 1)*sc[24] + (TB[38][8] - 1)*sc[35] + (TB[38][9] - 1)*sc[65] + (TB[38][10] - 1)*sc[62];
+    alpha = (memcmp(TB[38], TB[0], 11*sizeof(double)) == 0 ? alpha_eff0 : mixture + (TB[38][0] - 1)*sc[0] + (TB[38][1] - 1)*sc[5] + (TB[38][2] - 1)*sc[13] + (TB[38][3] - 1)*sc[14] + (TB[38][4] - 1)*sc[15] + (TB[38][5] - 1)*sc[26] + (TB[38][6] - 1)*sc[30] + (TB[38][7] - 1)*sc[24] + (TB[38][8] - 1)*sc[35] + (TB[38][9] - 1)*sc[65] + (TB[38][10] - 1)*sc[62]);
     /* forward */
     phi_f = sc[1]*sc[2];
-    k_f = prefactor_units[38] * fwd_A[38]
-                * exp(fwd_beta[38] * tc[0] - activation_units[38] * fwd_Ea[38] * invT);
+    k_f = k_f_s[38];
     dlnkfdT = fwd_beta[38] * invT + activation_units[38] * fwd_Ea[38] * invT2;
     /* reverse */
     phi_r = sc[4];
-    Kc = refCinv * exp(g_RT[1] + g_RT[2] - g_RT[4]);
+    Kc = Kc_s[38];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[2]) + (h_RT[4]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41726,155 +39955,80 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[38][0] - 1)*q_nocor;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[2] -= dqdci;                /* dwdot[O]/d[H2] */
-        J[4] += dqdci;                /* dwdot[OH]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[2];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[73] -= dqdci;               /* dwdot[O]/d[H] */
-        J[75] += dqdci;               /* dwdot[OH]/d[H] */
-        /* d()/d[O] */
-        dqdci =  + k_f*sc[1];
-        J[143] -= dqdci;              /* dwdot[H]/d[O] */
-        J[144] -= dqdci;              /* dwdot[O]/d[O] */
-        J[146] += dqdci;              /* dwdot[OH]/d[O] */
-        /* d()/d[OH] */
-        dqdci =  - k_r;
-        J[285] -= dqdci;              /* dwdot[H]/d[OH] */
-        J[286] -= dqdci;              /* dwdot[O]/d[OH] */
-        J[288] += dqdci;              /* dwdot[OH]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[38][1] - 1)*q_nocor;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[357] -= dqdci;              /* dwdot[O]/d[H2O] */
-        J[359] += dqdci;              /* dwdot[OH]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[38][2] - 1)*q_nocor;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[925] -= dqdci;              /* dwdot[O]/d[CH4] */
-        J[927] += dqdci;              /* dwdot[OH]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[38][3] - 1)*q_nocor;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[996] -= dqdci;              /* dwdot[O]/d[CO] */
-        J[998] += dqdci;              /* dwdot[OH]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[38][4] - 1)*q_nocor;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1067] -= dqdci;             /* dwdot[O]/d[CO2] */
-        J[1069] += dqdci;             /* dwdot[OH]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[38][7] - 1)*q_nocor;
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1706] -= dqdci;             /* dwdot[O]/d[C2H4] */
-        J[1708] += dqdci;             /* dwdot[OH]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[38][5] - 1)*q_nocor;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1848] -= dqdci;             /* dwdot[O]/d[C2H6] */
-        J[1850] += dqdci;             /* dwdot[OH]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[38][6] - 1)*q_nocor;
-        J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2132] -= dqdci;             /* dwdot[O]/d[AR] */
-        J[2134] += dqdci;             /* dwdot[OH]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[38][8] - 1)*q_nocor;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2487] -= dqdci;             /* dwdot[O]/d[pC3H4] */
-        J[2489] += dqdci;             /* dwdot[OH]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[38][10] - 1)*q_nocor;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4404] -= dqdci;             /* dwdot[O]/d[C3H8] */
-        J[4406] += dqdci;             /* dwdot[OH]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[38][9] - 1)*q_nocor;
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4617] -= dqdci;             /* dwdot[O]/d[C3H6] */
-        J[4619] += dqdci;             /* dwdot[OH]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[38][0];
-        dqdc[1] = dcdc_fac + k_f*sc[2];
-        dqdc[2] = dcdc_fac + k_f*sc[1];
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac - k_r;
-        dqdc[5] = TB[38][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[38][2];
-        dqdc[14] = TB[38][3];
-        dqdc[15] = TB[38][4];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[38][7];
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[38][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[38][6];
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[38][8];
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[38][10];
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[38][9];
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+2] -= dqdc[k];
-            J[71*k+4] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= q_nocor;
+    Jmix[2] -= q_nocor;
+    Jmix[4] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[38][0] - 1)*q_nocor;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[2] -= dqdci;                /* dwdot[O]/d[H2] */
+    J[4] += dqdci;                /* dwdot[OH]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[2];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[73] -= dqdci;               /* dwdot[O]/d[H] */
+    J[75] += dqdci;               /* dwdot[OH]/d[H] */
+    /* d()/d[O] */
+    dqdci =  + k_f*sc[1];
+    J[143] -= dqdci;              /* dwdot[H]/d[O] */
+    J[144] -= dqdci;              /* dwdot[O]/d[O] */
+    J[146] += dqdci;              /* dwdot[OH]/d[O] */
+    /* d()/d[OH] */
+    dqdci =  - k_r;
+    J[285] -= dqdci;              /* dwdot[H]/d[OH] */
+    J[286] -= dqdci;              /* dwdot[O]/d[OH] */
+    J[288] += dqdci;              /* dwdot[OH]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[38][1] - 1)*q_nocor;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[357] -= dqdci;              /* dwdot[O]/d[H2O] */
+    J[359] += dqdci;              /* dwdot[OH]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[38][2] - 1)*q_nocor;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[925] -= dqdci;              /* dwdot[O]/d[CH4] */
+    J[927] += dqdci;              /* dwdot[OH]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[38][3] - 1)*q_nocor;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[996] -= dqdci;              /* dwdot[O]/d[CO] */
+    J[998] += dqdci;              /* dwdot[OH]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[38][4] - 1)*q_nocor;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1067] -= dqdci;             /* dwdot[O]/d[CO2] */
+    J[1069] += dqdci;             /* dwdot[OH]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[38][7] - 1)*q_nocor;
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1706] -= dqdci;             /* dwdot[O]/d[C2H4] */
+    J[1708] += dqdci;             /* dwdot[OH]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[38][5] - 1)*q_nocor;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1848] -= dqdci;             /* dwdot[O]/d[C2H6] */
+    J[1850] += dqdci;             /* dwdot[OH]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[38][6] - 1)*q_nocor;
+    J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2132] -= dqdci;             /* dwdot[O]/d[AR] */
+    J[2134] += dqdci;             /* dwdot[OH]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[38][8] - 1)*q_nocor;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2487] -= dqdci;             /* dwdot[O]/d[pC3H4] */
+    J[2489] += dqdci;             /* dwdot[OH]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[38][10] - 1)*q_nocor;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4404] -= dqdci;             /* dwdot[O]/d[C3H8] */
+    J[4406] += dqdci;             /* dwdot[OH]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[38][9] - 1)*q_nocor;
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4617] -= dqdci;             /* dwdot[O]/d[C3H6] */
+    J[4619] += dqdci;             /* dwdot[OH]/d[C3H6] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[4972] -= dqdT; /* dwdot[O]/dT */
     J[4974] += dqdT; /* dwdot[OH]/dT */
@@ -41885,12 +40039,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[39][0] - 1)*sc[3] + (TB[39][1] - 1)*sc[5] + (TB[39][2] - 1)*sc[14] + (TB[39][3] - 1)*sc[15] + (TB[39][4] - 1)*sc[26] + (TB[39][5] - 1)*sc[31] + (TB[39][6] - 1)*sc[30] + (TB[39][7] - 1)*sc[24] + (TB[39][8] - 1)*sc[35] + (TB[39][9] - 1)*sc[65] + (TB[39][10] - 1)*sc[62];
     /* forward */
     phi_f = sc[1]*sc[3];
-    k_f = prefactor_units[39] * fwd_A[39]
-                * exp(fwd_beta[39] * tc[0] - activation_units[39] * fwd_Ea[39] * invT);
+    k_f = k_f_s[39];
     dlnkfdT = fwd_beta[39] * invT + activation_units[39] * fwd_Ea[39] * invT2;
     /* reverse */
     phi_r = sc[6];
-    Kc = refCinv * exp(g_RT[1] + g_RT[3] - g_RT[6]);
+    Kc = Kc_s[39];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3]) + (h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -41905,150 +40058,75 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[3];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[74] -= dqdci;               /* dwdot[O2]/d[H] */
-        J[77] += dqdci;               /* dwdot[HO2]/d[H] */
-        /* d()/d[O2] */
-        dqdci = (TB[39][0] - 1)*q_nocor + k_f*sc[1];
-        J[214] -= dqdci;              /* dwdot[H]/d[O2] */
-        J[216] -= dqdci;              /* dwdot[O2]/d[O2] */
-        J[219] += dqdci;              /* dwdot[HO2]/d[O2] */
-        /* d()/d[H2O] */
-        dqdci = (TB[39][1] - 1)*q_nocor;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[358] -= dqdci;              /* dwdot[O2]/d[H2O] */
-        J[361] += dqdci;              /* dwdot[HO2]/d[H2O] */
-        /* d()/d[HO2] */
-        dqdci =  - k_r;
-        J[427] -= dqdci;              /* dwdot[H]/d[HO2] */
-        J[429] -= dqdci;              /* dwdot[O2]/d[HO2] */
-        J[432] += dqdci;              /* dwdot[HO2]/d[HO2] */
-        /* d()/d[CO] */
-        dqdci = (TB[39][2] - 1)*q_nocor;
-        J[995] -= dqdci;              /* dwdot[H]/d[CO] */
-        J[997] -= dqdci;              /* dwdot[O2]/d[CO] */
-        J[1000] += dqdci;             /* dwdot[HO2]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[39][3] - 1)*q_nocor;
-        J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
-        J[1068] -= dqdci;             /* dwdot[O2]/d[CO2] */
-        J[1071] += dqdci;             /* dwdot[HO2]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[39][7] - 1)*q_nocor;
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1707] -= dqdci;             /* dwdot[O2]/d[C2H4] */
-        J[1710] += dqdci;             /* dwdot[HO2]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[39][4] - 1)*q_nocor;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1849] -= dqdci;             /* dwdot[O2]/d[C2H6] */
-        J[1852] += dqdci;             /* dwdot[HO2]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[39][6] - 1)*q_nocor;
-        J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2133] -= dqdci;             /* dwdot[O2]/d[AR] */
-        J[2136] += dqdci;             /* dwdot[HO2]/d[AR] */
-        /* d()/d[N2] */
-        dqdci = (TB[39][5] - 1)*q_nocor;
-        J[2202] -= dqdci;             /* dwdot[H]/d[N2] */
-        J[2204] -= dqdci;             /* dwdot[O2]/d[N2] */
-        J[2207] += dqdci;             /* dwdot[HO2]/d[N2] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[39][8] - 1)*q_nocor;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2488] -= dqdci;             /* dwdot[O2]/d[pC3H4] */
-        J[2491] += dqdci;             /* dwdot[HO2]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[39][10] - 1)*q_nocor;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4405] -= dqdci;             /* dwdot[O2]/d[C3H8] */
-        J[4408] += dqdci;             /* dwdot[HO2]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[39][9] - 1)*q_nocor;
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4618] -= dqdci;             /* dwdot[O2]/d[C3H6] */
-        J[4621] += dqdci;             /* dwdot[HO2]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = dcdc_fac;
-        dqdc[1] = dcdc_fac + k_f*sc[3];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = TB[39][0] + k_f*sc[1];
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[39][1];
-        dqdc[6] = dcdc_fac - k_r;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = dcdc_fac;
-        dqdc[14] = TB[39][2];
-        dqdc[15] = TB[39][3];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[39][7];
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[39][4];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[39][6];
-        dqdc[31] = TB[39][5];
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[39][8];
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[39][10];
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[39][9];
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+3] -= dqdc[k];
-            J[71*k+6] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= q_nocor;
+    Jmix[3] -= q_nocor;
+    Jmix[6] += q_nocor;
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[3];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[74] -= dqdci;               /* dwdot[O2]/d[H] */
+    J[77] += dqdci;               /* dwdot[HO2]/d[H] */
+    /* d()/d[O2] */
+    dqdci = (TB[39][0] - 1)*q_nocor + k_f*sc[1];
+    J[214] -= dqdci;              /* dwdot[H]/d[O2] */
+    J[216] -= dqdci;              /* dwdot[O2]/d[O2] */
+    J[219] += dqdci;              /* dwdot[HO2]/d[O2] */
+    /* d()/d[H2O] */
+    dqdci = (TB[39][1] - 1)*q_nocor;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[358] -= dqdci;              /* dwdot[O2]/d[H2O] */
+    J[361] += dqdci;              /* dwdot[HO2]/d[H2O] */
+    /* d()/d[HO2] */
+    dqdci =  - k_r;
+    J[427] -= dqdci;              /* dwdot[H]/d[HO2] */
+    J[429] -= dqdci;              /* dwdot[O2]/d[HO2] */
+    J[432] += dqdci;              /* dwdot[HO2]/d[HO2] */
+    /* d()/d[CO] */
+    dqdci = (TB[39][2] - 1)*q_nocor;
+    J[995] -= dqdci;              /* dwdot[H]/d[CO] */
+    J[997] -= dqdci;              /* dwdot[O2]/d[CO] */
+    J[1000] += dqdci;             /* dwdot[HO2]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[39][3] - 1)*q_nocor;
+    J[1066] -= dqdci;             /* dwdot[H]/d[CO2] */
+    J[1068] -= dqdci;             /* dwdot[O2]/d[CO2] */
+    J[1071] += dqdci;             /* dwdot[HO2]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[39][7] - 1)*q_nocor;
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1707] -= dqdci;             /* dwdot[O2]/d[C2H4] */
+    J[1710] += dqdci;             /* dwdot[HO2]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[39][4] - 1)*q_nocor;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1849] -= dqdci;             /* dwdot[O2]/d[C2H6] */
+    J[1852] += dqdci;             /* dwdot[HO2]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[39][6] - 1)*q_nocor;
+    J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2133] -= dqdci;             /* dwdot[O2]/d[AR] */
+    J[2136] += dqdci;             /* dwdot[HO2]/d[AR] */
+    /* d()/d[N2] */
+    dqdci = (TB[39][5] - 1)*q_nocor;
+    J[2202] -= dqdci;             /* dwdot[H]/d[N2] */
+    J[2204] -= dqdci;             /* dwdot[O2]/d[N2] */
+    J[2207] += dqdci;             /* dwdot[HO2]/d[N2] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[39][8] - 1)*q_nocor;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2488] -= dqdci;             /* dwdot[O2]/d[pC3H4] */
+    J[2491] += dqdci;             /* dwdot[HO2]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[39][10] - 1)*q_nocor;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4405] -= dqdci;             /* dwdot[O2]/d[C3H8] */
+    J[4408] += dqdci;             /* dwdot[HO2]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[39][9] - 1)*q_nocor;
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4618] -= dqdci;             /* dwdot[O2]/d[C3H6] */
+    J[4621] += dqdci;             /* dwdot[HO2]/d[C3H6] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[4973] -= dqdT; /* dwdot[O2]/dT */
     J[4976] += dqdT; /* dwdot[HO2]/dT */
@@ -42059,12 +40137,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[40][0] - 1)*sc[0] + (TB[40][1] - 1)*sc[5] + (TB[40][2] - 1)*sc[13] + (TB[40][3] - 1)*sc[15] + (TB[40][4] - 1)*sc[26] + (TB[40][5] - 1)*sc[30] + (TB[40][6] - 1)*sc[24] + (TB[40][7] - 1)*sc[35] + (TB[40][8] - 1)*sc[65] + (TB[40][9] - 1)*sc[62];
     /* forward */
     phi_f = sc[1]*sc[1];
-    k_f = prefactor_units[40] * fwd_A[40]
-                * exp(fwd_beta[40] * tc[0] - activation_units[40] * fwd_Ea[40] * invT);
+    k_f = k_f_s[40];
     dlnkfdT = fwd_beta[40] * invT + activation_units[40] * fwd_Ea[40] * invT2;
     /* reverse */
     phi_r = sc[0];
-    Kc = refCinv * exp(-g_RT[0] + 2*g_RT[1]);
+    Kc = Kc_s[40];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[1]) + (h_RT[0]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42078,128 +40155,53 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[40][0] - 1)*q_nocor - k_r;
-        J[0] += dqdci;                /* dwdot[H2]/d[H2] */
-        J[1] += -2 * dqdci;           /* dwdot[H]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*2*sc[1];
-        J[71] += dqdci;               /* dwdot[H2]/d[H] */
-        J[72] += -2 * dqdci;          /* dwdot[H]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[40][1] - 1)*q_nocor;
-        J[355] += dqdci;              /* dwdot[H2]/d[H2O] */
-        J[356] += -2 * dqdci;         /* dwdot[H]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[40][2] - 1)*q_nocor;
-        J[923] += dqdci;              /* dwdot[H2]/d[CH4] */
-        J[924] += -2 * dqdci;         /* dwdot[H]/d[CH4] */
-        /* d()/d[CO2] */
-        dqdci = (TB[40][3] - 1)*q_nocor;
-        J[1065] += dqdci;             /* dwdot[H2]/d[CO2] */
-        J[1066] += -2 * dqdci;        /* dwdot[H]/d[CO2] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[40][6] - 1)*q_nocor;
-        J[1704] += dqdci;             /* dwdot[H2]/d[C2H4] */
-        J[1705] += -2 * dqdci;        /* dwdot[H]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[40][4] - 1)*q_nocor;
-        J[1846] += dqdci;             /* dwdot[H2]/d[C2H6] */
-        J[1847] += -2 * dqdci;        /* dwdot[H]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[40][5] - 1)*q_nocor;
-        J[2130] += dqdci;             /* dwdot[H2]/d[AR] */
-        J[2131] += -2 * dqdci;        /* dwdot[H]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[40][7] - 1)*q_nocor;
-        J[2485] += dqdci;             /* dwdot[H2]/d[pC3H4] */
-        J[2486] += -2 * dqdci;        /* dwdot[H]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[40][9] - 1)*q_nocor;
-        J[4402] += dqdci;             /* dwdot[H2]/d[C3H8] */
-        J[4403] += -2 * dqdci;        /* dwdot[H]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[40][8] - 1)*q_nocor;
-        J[4615] += dqdci;             /* dwdot[H2]/d[C3H6] */
-        J[4616] += -2 * dqdci;        /* dwdot[H]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[40][0] - k_r;
-        dqdc[1] = dcdc_fac + k_f*2*sc[1];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[40][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[40][2];
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = TB[40][3];
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[40][6];
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[40][4];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[40][5];
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[40][7];
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[40][9];
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[40][8];
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+0] += dqdc[k];
-            J[71*k+1] += -2 * dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[0] += q_nocor;
+    Jmix[1] += -2 * q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[40][0] - 1)*q_nocor - k_r;
+    J[0] += dqdci;                /* dwdot[H2]/d[H2] */
+    J[1] += -2 * dqdci;           /* dwdot[H]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*2*sc[1];
+    J[71] += dqdci;               /* dwdot[H2]/d[H] */
+    J[72] += -2 * dqdci;          /* dwdot[H]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[40][1] - 1)*q_nocor;
+    J[355] += dqdci;              /* dwdot[H2]/d[H2O] */
+    J[356] += -2 * dqdci;         /* dwdot[H]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[40][2] - 1)*q_nocor;
+    J[923] += dqdci;              /* dwdot[H2]/d[CH4] */
+    J[924] += -2 * dqdci;         /* dwdot[H]/d[CH4] */
+    /* d()/d[CO2] */
+    dqdci = (TB[40][3] - 1)*q_nocor;
+    J[1065] += dqdci;             /* dwdot[H2]/d[CO2] */
+    J[1066] += -2 * dqdci;        /* dwdot[H]/d[CO2] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[40][6] - 1)*q_nocor;
+    J[1704] += dqdci;             /* dwdot[H2]/d[C2H4] */
+    J[1705] += -2 * dqdci;        /* dwdot[H]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[40][4] - 1)*q_nocor;
+    J[1846] += dqdci;             /* dwdot[H2]/d[C2H6] */
+    J[1847] += -2 * dqdci;        /* dwdot[H]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[40][5] - 1)*q_nocor;
+    J[2130] += dqdci;             /* dwdot[H2]/d[AR] */
+    J[2131] += -2 * dqdci;        /* dwdot[H]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[40][7] - 1)*q_nocor;
+    J[2485] += dqdci;             /* dwdot[H2]/d[pC3H4] */
+    J[2486] += -2 * dqdci;        /* dwdot[H]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[40][9] - 1)*q_nocor;
+    J[4402] += dqdci;             /* dwdot[H2]/d[C3H8] */
+    J[4403] += -2 * dqdci;        /* dwdot[H]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[40][8] - 1)*q_nocor;
+    J[4615] += dqdci;             /* dwdot[H2]/d[C3H6] */
+    J[4616] += -2 * dqdci;        /* dwdot[H]/d[C3H6] */
     J[4970] += dqdT; /* dwdot[H2]/dT */
     J[4971] += -2 * dqdT; /* dwdot[H]/dT */
 
@@ -42209,12 +40211,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[41][0] - 1)*sc[0] + (TB[41][1] - 1)*sc[5] + (TB[41][2] - 1)*sc[13] + (TB[41][3] - 1)*sc[26] + (TB[41][4] - 1)*sc[30] + (TB[41][5] - 1)*sc[24] + (TB[41][6] - 1)*sc[35] + (TB[41][7] - 1)*sc[65] + (TB[41][8] - 1)*sc[62];
     /* forward */
     phi_f = sc[1]*sc[4];
-    k_f = prefactor_units[41] * fwd_A[41]
-                * exp(fwd_beta[41] * tc[0] - activation_units[41] * fwd_Ea[41] * invT);
+    k_f = k_f_s[41];
     dlnkfdT = fwd_beta[41] * invT + activation_units[41] * fwd_Ea[41] * invT2;
     /* reverse */
     phi_r = sc[5];
-    Kc = refCinv * exp(g_RT[1] + g_RT[4] - g_RT[5]);
+    Kc = Kc_s[41];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[4]) + (h_RT[5]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42229,140 +40230,65 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[41][0] - 1)*q_nocor;
-        J[1] -= dqdci;                /* dwdot[H]/d[H2] */
-        J[4] -= dqdci;                /* dwdot[OH]/d[H2] */
-        J[5] += dqdci;                /* dwdot[H2O]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  + k_f*sc[4];
-        J[72] -= dqdci;               /* dwdot[H]/d[H] */
-        J[75] -= dqdci;               /* dwdot[OH]/d[H] */
-        J[76] += dqdci;               /* dwdot[H2O]/d[H] */
-        /* d()/d[OH] */
-        dqdci =  + k_f*sc[1];
-        J[285] -= dqdci;              /* dwdot[H]/d[OH] */
-        J[288] -= dqdci;              /* dwdot[OH]/d[OH] */
-        J[289] += dqdci;              /* dwdot[H2O]/d[OH] */
-        /* d()/d[H2O] */
-        dqdci = (TB[41][1] - 1)*q_nocor - k_r;
-        J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
-        J[359] -= dqdci;              /* dwdot[OH]/d[H2O] */
-        J[360] += dqdci;              /* dwdot[H2O]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[41][2] - 1)*q_nocor;
-        J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
-        J[927] -= dqdci;              /* dwdot[OH]/d[CH4] */
-        J[928] += dqdci;              /* dwdot[H2O]/d[CH4] */
-        /* d()/d[C2H4] */
-        dqdci = (TB[41][5] - 1)*q_nocor;
-        J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
-        J[1708] -= dqdci;             /* dwdot[OH]/d[C2H4] */
-        J[1709] += dqdci;             /* dwdot[H2O]/d[C2H4] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[41][3] - 1)*q_nocor;
-        J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1850] -= dqdci;             /* dwdot[OH]/d[C2H6] */
-        J[1851] += dqdci;             /* dwdot[H2O]/d[C2H6] */
-        /* d()/d[AR] */
-        dqdci = (TB[41][4] - 1)*q_nocor;
-        J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
-        J[2134] -= dqdci;             /* dwdot[OH]/d[AR] */
-        J[2135] += dqdci;             /* dwdot[H2O]/d[AR] */
-        /* d()/d[pC3H4] */
-        dqdci = (TB[41][6] - 1)*q_nocor;
-        J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
-        J[2489] -= dqdci;             /* dwdot[OH]/d[pC3H4] */
-        J[2490] += dqdci;             /* dwdot[H2O]/d[pC3H4] */
-        /* d()/d[C3H8] */
-        dqdci = (TB[41][8] - 1)*q_nocor;
-        J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
-        J[4406] -= dqdci;             /* dwdot[OH]/d[C3H8] */
-        J[4407] += dqdci;             /* dwdot[H2O]/d[C3H8] */
-        /* d()/d[C3H6] */
-        dqdci = (TB[41][7] - 1)*q_nocor;
-        J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
-        J[4619] -= dqdci;             /* dwdot[OH]/d[C3H6] */
-        J[4620] += dqdci;             /* dwdot[H2O]/d[C3H6] */
-    }
-    else {
-        dqdc[0] = TB[41][0];
-        dqdc[1] = dcdc_fac + k_f*sc[4];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac + k_f*sc[1];
-        dqdc[5] = TB[41][1] - k_r;
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[41][2];
-        dqdc[14] = dcdc_fac;
-        dqdc[15] = dcdc_fac;
-        dqdc[16] = dcdc_fac;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = TB[41][5];
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[41][3];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = TB[41][4];
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = TB[41][6];
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = TB[41][8];
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = TB[41][7];
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] -= dqdc[k];
-            J[71*k+4] -= dqdc[k];
-            J[71*k+5] += dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] -= q_nocor;
+    Jmix[4] -= q_nocor;
+    Jmix[5] += q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[41][0] - 1)*q_nocor;
+    J[1] -= dqdci;                /* dwdot[H]/d[H2] */
+    J[4] -= dqdci;                /* dwdot[OH]/d[H2] */
+    J[5] += dqdci;                /* dwdot[H2O]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  + k_f*sc[4];
+    J[72] -= dqdci;               /* dwdot[H]/d[H] */
+    J[75] -= dqdci;               /* dwdot[OH]/d[H] */
+    J[76] += dqdci;               /* dwdot[H2O]/d[H] */
+    /* d()/d[OH] */
+    dqdci =  + k_f*sc[1];
+    J[285] -= dqdci;              /* dwdot[H]/d[OH] */
+    J[288] -= dqdci;              /* dwdot[OH]/d[OH] */
+    J[289] += dqdci;              /* dwdot[H2O]/d[OH] */
+    /* d()/d[H2O] */
+    dqdci = (TB[41][1] - 1)*q_nocor - k_r;
+    J[356] -= dqdci;              /* dwdot[H]/d[H2O] */
+    J[359] -= dqdci;              /* dwdot[OH]/d[H2O] */
+    J[360] += dqdci;              /* dwdot[H2O]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[41][2] - 1)*q_nocor;
+    J[924] -= dqdci;              /* dwdot[H]/d[CH4] */
+    J[927] -= dqdci;              /* dwdot[OH]/d[CH4] */
+    J[928] += dqdci;              /* dwdot[H2O]/d[CH4] */
+    /* d()/d[C2H4] */
+    dqdci = (TB[41][5] - 1)*q_nocor;
+    J[1705] -= dqdci;             /* dwdot[H]/d[C2H4] */
+    J[1708] -= dqdci;             /* dwdot[OH]/d[C2H4] */
+    J[1709] += dqdci;             /* dwdot[H2O]/d[C2H4] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[41][3] - 1)*q_nocor;
+    J[1847] -= dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1850] -= dqdci;             /* dwdot[OH]/d[C2H6] */
+    J[1851] += dqdci;             /* dwdot[H2O]/d[C2H6] */
+    /* d()/d[AR] */
+    dqdci = (TB[41][4] - 1)*q_nocor;
+    J[2131] -= dqdci;             /* dwdot[H]/d[AR] */
+    J[2134] -= dqdci;             /* dwdot[OH]/d[AR] */
+    J[2135] += dqdci;             /* dwdot[H2O]/d[AR] */
+    /* d()/d[pC3H4] */
+    dqdci = (TB[41][6] - 1)*q_nocor;
+    J[2486] -= dqdci;             /* dwdot[H]/d[pC3H4] */
+    J[2489] -= dqdci;             /* dwdot[OH]/d[pC3H4] */
+    J[2490] += dqdci;             /* dwdot[H2O]/d[pC3H4] */
+    /* d()/d[C3H8] */
+    dqdci = (TB[41][8] - 1)*q_nocor;
+    J[4403] -= dqdci;             /* dwdot[H]/d[C3H8] */
+    J[4406] -= dqdci;             /* dwdot[OH]/d[C3H8] */
+    J[4407] += dqdci;             /* dwdot[H2O]/d[C3H8] */
+    /* d()/d[C3H6] */
+    dqdci = (TB[41][7] - 1)*q_nocor;
+    J[4616] -= dqdci;             /* dwdot[H]/d[C3H6] */
+    J[4619] -= dqdci;             /* dwdot[OH]/d[C3H6] */
+    J[4620] += dqdci;             /* dwdot[H2O]/d[C3H6] */
     J[4971] -= dqdT; /* dwdot[H]/dT */
     J[4974] -= dqdT; /* dwdot[OH]/dT */
     J[4975] += dqdT; /* dwdot[H2O]/dT */
@@ -42373,12 +40299,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     alpha = mixture + (TB[42][0] - 1)*sc[0] + (TB[42][1] - 1)*sc[5] + (TB[42][2] - 1)*sc[13] + (TB[42][3] - 1)*sc[14] + (TB[42][4] - 1)*sc[15] + (TB[42][5] - 1)*sc[26];
     /* forward */
     phi_f = sc[16];
-    k_f = prefactor_units[42] * fwd_A[42]
-                * exp(fwd_beta[42] * tc[0] - activation_units[42] * fwd_Ea[42] * invT);
+    k_f = k_f_s[42];
     dlnkfdT = fwd_beta[42] * invT + activation_units[42] * fwd_Ea[42] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14];
-    Kc = refC * exp(-g_RT[1] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[42];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16]) + (h_RT[1] + h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42393,125 +40318,50 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /* for convenience */
     k_f *= alpha;
     k_r *= alpha;
-    if (consP) {
-        /* d()/d[H2] */
-        dqdci = (TB[42][0] - 1)*q_nocor;
-        J[1] += dqdci;                /* dwdot[H]/d[H2] */
-        J[14] += dqdci;               /* dwdot[CO]/d[H2] */
-        J[16] -= dqdci;               /* dwdot[HCO]/d[H2] */
-        /* d()/d[H] */
-        dqdci =  - k_r*sc[14];
-        J[72] += dqdci;               /* dwdot[H]/d[H] */
-        J[85] += dqdci;               /* dwdot[CO]/d[H] */
-        J[87] -= dqdci;               /* dwdot[HCO]/d[H] */
-        /* d()/d[H2O] */
-        dqdci = (TB[42][1] - 1)*q_nocor;
-        J[356] += dqdci;              /* dwdot[H]/d[H2O] */
-        J[369] += dqdci;              /* dwdot[CO]/d[H2O] */
-        J[371] -= dqdci;              /* dwdot[HCO]/d[H2O] */
-        /* d()/d[CH4] */
-        dqdci = (TB[42][2] - 1)*q_nocor;
-        J[924] += dqdci;              /* dwdot[H]/d[CH4] */
-        J[937] += dqdci;              /* dwdot[CO]/d[CH4] */
-        J[939] -= dqdci;              /* dwdot[HCO]/d[CH4] */
-        /* d()/d[CO] */
-        dqdci = (TB[42][3] - 1)*q_nocor - k_r*sc[1];
-        J[995] += dqdci;              /* dwdot[H]/d[CO] */
-        J[1008] += dqdci;             /* dwdot[CO]/d[CO] */
-        J[1010] -= dqdci;             /* dwdot[HCO]/d[CO] */
-        /* d()/d[CO2] */
-        dqdci = (TB[42][4] - 1)*q_nocor;
-        J[1066] += dqdci;             /* dwdot[H]/d[CO2] */
-        J[1079] += dqdci;             /* dwdot[CO]/d[CO2] */
-        J[1081] -= dqdci;             /* dwdot[HCO]/d[CO2] */
-        /* d()/d[HCO] */
-        dqdci =  + k_f;
-        J[1137] += dqdci;             /* dwdot[H]/d[HCO] */
-        J[1150] += dqdci;             /* dwdot[CO]/d[HCO] */
-        J[1152] -= dqdci;             /* dwdot[HCO]/d[HCO] */
-        /* d()/d[C2H6] */
-        dqdci = (TB[42][5] - 1)*q_nocor;
-        J[1847] += dqdci;             /* dwdot[H]/d[C2H6] */
-        J[1860] += dqdci;             /* dwdot[CO]/d[C2H6] */
-        J[1862] -= dqdci;             /* dwdot[HCO]/d[C2H6] */
-    }
-    else {
-        dqdc[0] = TB[42][0];
-        dqdc[1] = dcdc_fac - k_r*sc[14];
-        dqdc[2] = dcdc_fac;
-        dqdc[3] = dcdc_fac;
-        dqdc[4] = dcdc_fac;
-        dqdc[5] = TB[42][1];
-        dqdc[6] = dcdc_fac;
-        dqdc[7] = dcdc_fac;
-        dqdc[8] = dcdc_fac;
-        dqdc[9] = dcdc_fac;
-        dqdc[10] = dcdc_fac;
-        dqdc[11] = dcdc_fac;
-        dqdc[12] = dcdc_fac;
-        dqdc[13] = TB[42][2];
-        dqdc[14] = TB[42][3] - k_r*sc[1];
-        dqdc[15] = TB[42][4];
-        dqdc[16] = dcdc_fac + k_f;
-        dqdc[17] = dcdc_fac;
-        dqdc[18] = dcdc_fac;
-        dqdc[19] = dcdc_fac;
-        dqdc[20] = dcdc_fac;
-        dqdc[21] = dcdc_fac;
-        dqdc[22] = dcdc_fac;
-        dqdc[23] = dcdc_fac;
-        dqdc[24] = dcdc_fac;
-        dqdc[25] = dcdc_fac;
-        dqdc[26] = TB[42][5];
-        dqdc[27] = dcdc_fac;
-        dqdc[28] = dcdc_fac;
-        dqdc[29] = dcdc_fac;
-        dqdc[30] = dcdc_fac;
-        dqdc[31] = dcdc_fac;
-        dqdc[32] = dcdc_fac;
-        dqdc[33] = dcdc_fac;
-        dqdc[34] = dcdc_fac;
-        dqdc[35] = dcdc_fac;
-        dqdc[36] = dcdc_fac;
-        dqdc[37] = dcdc_fac;
-        dqdc[38] = dcdc_fac;
-        dqdc[39] = dcdc_fac;
-        dqdc[40] = dcdc_fac;
-        dqdc[41] = dcdc_fac;
-        dqdc[42] = dcdc_fac;
-        dqdc[43] = dcdc_fac;
-        dqdc[44] = dcdc_fac;
-        dqdc[45] = dcdc_fac;
-        dqdc[46] = dcdc_fac;
-        dqdc[47] = dcdc_fac;
-        dqdc[48] = dcdc_fac;
-        dqdc[49] = dcdc_fac;
-        dqdc[50] = dcdc_fac;
-        dqdc[51] = dcdc_fac;
-        dqdc[52] = dcdc_fac;
-        dqdc[53] = dcdc_fac;
-        dqdc[54] = dcdc_fac;
-        dqdc[55] = dcdc_fac;
-        dqdc[56] = dcdc_fac;
-        dqdc[57] = dcdc_fac;
-        dqdc[58] = dcdc_fac;
-        dqdc[59] = dcdc_fac;
-        dqdc[60] = dcdc_fac;
-        dqdc[61] = dcdc_fac;
-        dqdc[62] = dcdc_fac;
-        dqdc[63] = dcdc_fac;
-        dqdc[64] = dcdc_fac;
-        dqdc[65] = dcdc_fac;
-        dqdc[66] = dcdc_fac;
-        dqdc[67] = dcdc_fac;
-        dqdc[68] = dcdc_fac;
-        dqdc[69] = dcdc_fac;
-        for (int k=0; k<70; k++) {
-            J[71*k+1] += dqdc[k];
-            J[71*k+14] += dqdc[k];
-            J[71*k+16] -= dqdc[k];
-        }
-    }
+    /* d()/d[X] at constant volume, same for all species */
+    Jmix[1] += q_nocor;
+    Jmix[14] += q_nocor;
+    Jmix[16] -= q_nocor;
+    /* d()/d[H2] */
+    dqdci = (TB[42][0] - 1)*q_nocor;
+    J[1] += dqdci;                /* dwdot[H]/d[H2] */
+    J[14] += dqdci;               /* dwdot[CO]/d[H2] */
+    J[16] -= dqdci;               /* dwdot[HCO]/d[H2] */
+    /* d()/d[H] */
+    dqdci =  - k_r*sc[14];
+    J[72] += dqdci;               /* dwdot[H]/d[H] */
+    J[85] += dqdci;               /* dwdot[CO]/d[H] */
+    J[87] -= dqdci;               /* dwdot[HCO]/d[H] */
+    /* d()/d[H2O] */
+    dqdci = (TB[42][1] - 1)*q_nocor;
+    J[356] += dqdci;              /* dwdot[H]/d[H2O] */
+    J[369] += dqdci;              /* dwdot[CO]/d[H2O] */
+    J[371] -= dqdci;              /* dwdot[HCO]/d[H2O] */
+    /* d()/d[CH4] */
+    dqdci = (TB[42][2] - 1)*q_nocor;
+    J[924] += dqdci;              /* dwdot[H]/d[CH4] */
+    J[937] += dqdci;              /* dwdot[CO]/d[CH4] */
+    J[939] -= dqdci;              /* dwdot[HCO]/d[CH4] */
+    /* d()/d[CO] */
+    dqdci = (TB[42][3] - 1)*q_nocor - k_r*sc[1];
+    J[995] += dqdci;              /* dwdot[H]/d[CO] */
+    J[1008] += dqdci;             /* dwdot[CO]/d[CO] */
+    J[1010] -= dqdci;             /* dwdot[HCO]/d[CO] */
+    /* d()/d[CO2] */
+    dqdci = (TB[42][4] - 1)*q_nocor;
+    J[1066] += dqdci;             /* dwdot[H]/d[CO2] */
+    J[1079] += dqdci;             /* dwdot[CO]/d[CO2] */
+    J[1081] -= dqdci;             /* dwdot[HCO]/d[CO2] */
+    /* d()/d[HCO] */
+    dqdci =  + k_f;
+    J[1137] += dqdci;             /* dwdot[H]/d[HCO] */
+    J[1150] += dqdci;             /* dwdot[CO]/d[HCO] */
+    J[1152] -= dqdci;             /* dwdot[HCO]/d[HCO] */
+    /* d()/d[C2H6] */
+    dqdci = (TB[42][5] - 1)*q_nocor;
+    J[1847] += dqdci;             /* dwdot[H]/d[C2H6] */
+    J[1860] += dqdci;             /* dwdot[CO]/d[C2H6] */
+    J[1862] -= dqdci;             /* dwdot[HCO]/d[C2H6] */
     J[4971] += dqdT; /* dwdot[H]/dT */
     J[4984] += dqdT; /* dwdot[CO]/dT */
     J[4986] -= dqdT; /* dwdot[HCO]/dT */
@@ -42520,12 +40370,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[2];
-    k_f = prefactor_units[43] * fwd_A[43]
-                * exp(fwd_beta[43] * tc[0] - activation_units[43] * fwd_Ea[43] * invT);
+    k_f = k_f_s[43];
     dlnkfdT = fwd_beta[43] * invT + activation_units[43] * fwd_Ea[43] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[4];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[2] - g_RT[4]);
+    Kc = Kc_s[43];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[2]) + (h_RT[1] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42571,12 +40420,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[6];
-    k_f = prefactor_units[44] * fwd_A[44]
-                * exp(fwd_beta[44] * tc[0] - activation_units[44] * fwd_Ea[44] * invT);
+    k_f = k_f_s[44];
     dlnkfdT = fwd_beta[44] * invT + activation_units[44] * fwd_Ea[44] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[4];
-    Kc = exp(g_RT[2] - g_RT[3] - g_RT[4] + g_RT[6]);
+    Kc = Kc_s[44];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[6]) + (h_RT[3] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42622,12 +40470,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[7];
-    k_f = prefactor_units[45] * fwd_A[45]
-                * exp(fwd_beta[45] * tc[0] - activation_units[45] * fwd_Ea[45] * invT);
+    k_f = k_f_s[45];
     dlnkfdT = fwd_beta[45] * invT + activation_units[45] * fwd_Ea[45] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[6];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[45];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[7]) + (h_RT[4] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42673,12 +40520,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[9];
-    k_f = prefactor_units[46] * fwd_A[46]
-                * exp(fwd_beta[46] * tc[0] - activation_units[46] * fwd_Ea[46] * invT);
+    k_f = k_f_s[46];
     dlnkfdT = fwd_beta[46] * invT + activation_units[46] * fwd_Ea[46] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[9] - g_RT[14]);
+    Kc = Kc_s[46];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[9]) + (h_RT[1] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42724,12 +40570,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[10];
-    k_f = prefactor_units[47] * fwd_A[47]
-                * exp(fwd_beta[47] * tc[0] - activation_units[47] * fwd_Ea[47] * invT);
+    k_f = k_f_s[47];
     dlnkfdT = fwd_beta[47] * invT + activation_units[47] * fwd_Ea[47] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[16];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[10] - g_RT[16]);
+    Kc = Kc_s[47];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[10]) + (h_RT[1] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42775,12 +40620,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[11];
-    k_f = prefactor_units[48] * fwd_A[48]
-                * exp(fwd_beta[48] * tc[0] - activation_units[48] * fwd_Ea[48] * invT);
+    k_f = k_f_s[48];
     dlnkfdT = fwd_beta[48] * invT + activation_units[48] * fwd_Ea[48] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[14];
-    Kc = exp(-g_RT[0] + g_RT[2] + g_RT[11] - g_RT[14]);
+    Kc = Kc_s[48];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[11]) + (h_RT[0] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42826,12 +40670,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[11];
-    k_f = prefactor_units[49] * fwd_A[49]
-                * exp(fwd_beta[49] * tc[0] - activation_units[49] * fwd_Ea[49] * invT);
+    k_f = k_f_s[49];
     dlnkfdT = fwd_beta[49] * invT + activation_units[49] * fwd_Ea[49] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[16];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[11] - g_RT[16]);
+    Kc = Kc_s[49];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[11]) + (h_RT[1] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42877,12 +40720,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[12];
-    k_f = prefactor_units[50] * fwd_A[50]
-                * exp(fwd_beta[50] * tc[0] - activation_units[50] * fwd_Ea[50] * invT);
+    k_f = k_f_s[50];
     dlnkfdT = fwd_beta[50] * invT + activation_units[50] * fwd_Ea[50] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[17];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[12] - g_RT[17]);
+    Kc = Kc_s[50];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[12]) + (h_RT[1] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42928,12 +40770,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[13];
-    k_f = prefactor_units[51] * fwd_A[51]
-                * exp(fwd_beta[51] * tc[0] - activation_units[51] * fwd_Ea[51] * invT);
+    k_f = k_f_s[51];
     dlnkfdT = fwd_beta[51] * invT + activation_units[51] * fwd_Ea[51] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[12];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[12] + g_RT[13]);
+    Kc = Kc_s[51];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[13]) + (h_RT[4] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -42979,12 +40820,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[16];
-    k_f = prefactor_units[52] * fwd_A[52]
-                * exp(fwd_beta[52] * tc[0] - activation_units[52] * fwd_Ea[52] * invT);
+    k_f = k_f_s[52];
     dlnkfdT = fwd_beta[52] * invT + activation_units[52] * fwd_Ea[52] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[14];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[52];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[16]) + (h_RT[4] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43030,12 +40870,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[16];
-    k_f = prefactor_units[53] * fwd_A[53]
-                * exp(fwd_beta[53] * tc[0] - activation_units[53] * fwd_Ea[53] * invT);
+    k_f = k_f_s[53];
     dlnkfdT = fwd_beta[53] * invT + activation_units[53] * fwd_Ea[53] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[15];
-    Kc = exp(-g_RT[1] + g_RT[2] - g_RT[15] + g_RT[16]);
+    Kc = Kc_s[53];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[16]) + (h_RT[1] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43081,12 +40920,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[17];
-    k_f = prefactor_units[54] * fwd_A[54]
-                * exp(fwd_beta[54] * tc[0] - activation_units[54] * fwd_Ea[54] * invT);
+    k_f = k_f_s[54];
     dlnkfdT = fwd_beta[54] * invT + activation_units[54] * fwd_Ea[54] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[16];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[54];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[17]) + (h_RT[4] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43132,12 +40970,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[18];
-    k_f = prefactor_units[55] * fwd_A[55]
-                * exp(fwd_beta[55] * tc[0] - activation_units[55] * fwd_Ea[55] * invT);
+    k_f = k_f_s[55];
     dlnkfdT = fwd_beta[55] * invT + activation_units[55] * fwd_Ea[55] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[17];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[55];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[18]) + (h_RT[4] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43183,12 +41020,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[19];
-    k_f = prefactor_units[56] * fwd_A[56]
-                * exp(fwd_beta[56] * tc[0] - activation_units[56] * fwd_Ea[56] * invT);
+    k_f = k_f_s[56];
     dlnkfdT = fwd_beta[56] * invT + activation_units[56] * fwd_Ea[56] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[17];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[17] + g_RT[19]);
+    Kc = Kc_s[56];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[19]) + (h_RT[4] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43234,12 +41070,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[20];
-    k_f = prefactor_units[57] * fwd_A[57]
-                * exp(fwd_beta[57] * tc[0] - activation_units[57] * fwd_Ea[57] * invT);
+    k_f = k_f_s[57];
     dlnkfdT = fwd_beta[57] * invT + activation_units[57] * fwd_Ea[57] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[18];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[57];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[20]) + (h_RT[4] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43285,12 +41120,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[20];
-    k_f = prefactor_units[58] * fwd_A[58]
-                * exp(fwd_beta[58] * tc[0] - activation_units[58] * fwd_Ea[58] * invT);
+    k_f = k_f_s[58];
     dlnkfdT = fwd_beta[58] * invT + activation_units[58] * fwd_Ea[58] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[19];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[19] + g_RT[20]);
+    Kc = Kc_s[58];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[20]) + (h_RT[4] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43336,12 +41170,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[21];
-    k_f = prefactor_units[59] * fwd_A[59]
-                * exp(fwd_beta[59] * tc[0] - activation_units[59] * fwd_Ea[59] * invT);
+    k_f = k_f_s[59];
     dlnkfdT = fwd_beta[59] * invT + activation_units[59] * fwd_Ea[59] * invT2;
     /* reverse */
     phi_r = sc[9]*sc[14];
-    Kc = exp(g_RT[2] - g_RT[9] - g_RT[14] + g_RT[21]);
+    Kc = Kc_s[59];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[21]) + (h_RT[9] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43387,12 +41220,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[22];
-    k_f = prefactor_units[60] * fwd_A[60]
-                * exp(fwd_beta[60] * tc[0] - activation_units[60] * fwd_Ea[60] * invT);
+    k_f = k_f_s[60];
     dlnkfdT = fwd_beta[60] * invT + activation_units[60] * fwd_Ea[60] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[27];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[22] - g_RT[27]);
+    Kc = Kc_s[60];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[22]) + (h_RT[1] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43438,12 +41270,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[22];
-    k_f = prefactor_units[61] * fwd_A[61]
-                * exp(fwd_beta[61] * tc[0] - activation_units[61] * fwd_Ea[61] * invT);
+    k_f = k_f_s[61];
     dlnkfdT = fwd_beta[61] * invT + activation_units[61] * fwd_Ea[61] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[21];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[61];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[22]) + (h_RT[4] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43489,12 +41320,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[22];
-    k_f = prefactor_units[62] * fwd_A[62]
-                * exp(fwd_beta[62] * tc[0] - activation_units[62] * fwd_Ea[62] * invT);
+    k_f = k_f_s[62];
     dlnkfdT = fwd_beta[62] * invT + activation_units[62] * fwd_Ea[62] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[14];
-    Kc = exp(g_RT[2] - g_RT[10] - g_RT[14] + g_RT[22]);
+    Kc = Kc_s[62];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[22]) + (h_RT[10] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43540,12 +41370,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[23];
-    k_f = prefactor_units[63] * fwd_A[63]
-                * exp(fwd_beta[63] * tc[0] - activation_units[63] * fwd_Ea[63] * invT);
+    k_f = k_f_s[63];
     dlnkfdT = fwd_beta[63] * invT + activation_units[63] * fwd_Ea[63] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[28];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[23] - g_RT[28]);
+    Kc = Kc_s[63];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[23]) + (h_RT[1] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43591,12 +41420,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[24];
-    k_f = prefactor_units[64] * fwd_A[64]
-                * exp(fwd_beta[64] * tc[0] - activation_units[64] * fwd_Ea[64] * invT);
+    k_f = k_f_s[64];
     dlnkfdT = fwd_beta[64] * invT + activation_units[64] * fwd_Ea[64] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[16];
-    Kc = exp(g_RT[2] - g_RT[12] - g_RT[16] + g_RT[24]);
+    Kc = Kc_s[64];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[24]) + (h_RT[12] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43642,12 +41470,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[25];
-    k_f = prefactor_units[65] * fwd_A[65]
-                * exp(fwd_beta[65] * tc[0] - activation_units[65] * fwd_Ea[65] * invT);
+    k_f = k_f_s[65];
     dlnkfdT = fwd_beta[65] * invT + activation_units[65] * fwd_Ea[65] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[17];
-    Kc = exp(g_RT[2] - g_RT[12] - g_RT[17] + g_RT[25]);
+    Kc = Kc_s[65];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[25]) + (h_RT[12] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43693,12 +41520,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[26];
-    k_f = prefactor_units[66] * fwd_A[66]
-                * exp(fwd_beta[66] * tc[0] - activation_units[66] * fwd_Ea[66] * invT);
+    k_f = k_f_s[66];
     dlnkfdT = fwd_beta[66] * invT + activation_units[66] * fwd_Ea[66] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[25];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[25] + g_RT[26]);
+    Kc = Kc_s[66];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[26]) + (h_RT[4] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43744,12 +41570,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[27];
-    k_f = prefactor_units[67] * fwd_A[67]
-                * exp(fwd_beta[67] * tc[0] - activation_units[67] * fwd_Ea[67] * invT);
+    k_f = k_f_s[67];
     dlnkfdT = fwd_beta[67] * invT + activation_units[67] * fwd_Ea[67] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14]*sc[14];
-    Kc = refC * exp(-g_RT[1] + g_RT[2] - 2*g_RT[14] + g_RT[27]);
+    Kc = Kc_s[67];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[27]) + (h_RT[1] + 2*h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43795,12 +41620,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[28];
-    k_f = prefactor_units[68] * fwd_A[68]
-                * exp(fwd_beta[68] * tc[0] - activation_units[68] * fwd_Ea[68] * invT);
+    k_f = k_f_s[68];
     dlnkfdT = fwd_beta[68] * invT + activation_units[68] * fwd_Ea[68] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[27];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[27] + g_RT[28]);
+    Kc = Kc_s[68];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[28]) + (h_RT[4] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43846,12 +41670,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[28];
-    k_f = prefactor_units[69] * fwd_A[69]
-                * exp(fwd_beta[69] * tc[0] - activation_units[69] * fwd_Ea[69] * invT);
+    k_f = k_f_s[69];
     dlnkfdT = fwd_beta[69] * invT + activation_units[69] * fwd_Ea[69] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[15];
-    Kc = exp(g_RT[2] - g_RT[10] - g_RT[15] + g_RT[28]);
+    Kc = Kc_s[69];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[28]) + (h_RT[10] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43897,12 +41720,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[14];
-    k_f = prefactor_units[70] * fwd_A[70]
-                * exp(fwd_beta[70] * tc[0] - activation_units[70] * fwd_Ea[70] * invT);
+    k_f = k_f_s[70];
     dlnkfdT = fwd_beta[70] * invT + activation_units[70] * fwd_Ea[70] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[15];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[70];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[14]) + (h_RT[2] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43948,12 +41770,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[17];
-    k_f = prefactor_units[71] * fwd_A[71]
-                * exp(fwd_beta[71] * tc[0] - activation_units[71] * fwd_Ea[71] * invT);
+    k_f = k_f_s[71];
     dlnkfdT = fwd_beta[71] * invT + activation_units[71] * fwd_Ea[71] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[16];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[71];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[17]) + (h_RT[6] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -43999,12 +41820,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3]*sc[3];
-    k_f = prefactor_units[72] * fwd_A[72]
-                * exp(fwd_beta[72] * tc[0] - activation_units[72] * fwd_Ea[72] * invT);
+    k_f = k_f_s[72];
     dlnkfdT = fwd_beta[72] * invT + activation_units[72] * fwd_Ea[72] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[6];
-    Kc = refCinv * exp(g_RT[1] + 2*g_RT[3] - g_RT[3] - g_RT[6]);
+    Kc = Kc_s[72];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + 2*h_RT[3]) + (h_RT[3] + h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44039,12 +41859,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3]*sc[5];
-    k_f = prefactor_units[73] * fwd_A[73]
-                * exp(fwd_beta[73] * tc[0] - activation_units[73] * fwd_Ea[73] * invT);
+    k_f = k_f_s[73];
     dlnkfdT = fwd_beta[73] * invT + activation_units[73] * fwd_Ea[73] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = refCinv * exp(g_RT[1] + g_RT[3] + g_RT[5] - g_RT[5] - g_RT[6]);
+    Kc = Kc_s[73];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3] + h_RT[5]) + (h_RT[5] + h_RT[6]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44084,12 +41903,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3]*sc[31];
-    k_f = prefactor_units[74] * fwd_A[74]
-                * exp(fwd_beta[74] * tc[0] - activation_units[74] * fwd_Ea[74] * invT);
+    k_f = k_f_s[74];
     dlnkfdT = fwd_beta[74] * invT + activation_units[74] * fwd_Ea[74] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[31];
-    Kc = refCinv * exp(g_RT[1] + g_RT[3] - g_RT[6] + g_RT[31] - g_RT[31]);
+    Kc = Kc_s[74];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3] + h_RT[31]) + (h_RT[6] + h_RT[31]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44129,12 +41947,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3]*sc[30];
-    k_f = prefactor_units[75] * fwd_A[75]
-                * exp(fwd_beta[75] * tc[0] - activation_units[75] * fwd_Ea[75] * invT);
+    k_f = k_f_s[75];
     dlnkfdT = fwd_beta[75] * invT + activation_units[75] * fwd_Ea[75] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[30];
-    Kc = refCinv * exp(g_RT[1] + g_RT[3] - g_RT[6] + g_RT[30] - g_RT[30]);
+    Kc = Kc_s[75];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3] + h_RT[30]) + (h_RT[6] + h_RT[30]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44174,12 +41991,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[3];
-    k_f = prefactor_units[76] * fwd_A[76]
-                * exp(fwd_beta[76] * tc[0] - activation_units[76] * fwd_Ea[76] * invT);
+    k_f = k_f_s[76];
     dlnkfdT = fwd_beta[76] * invT + activation_units[76] * fwd_Ea[76] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[4];
-    Kc = exp(g_RT[1] - g_RT[2] + g_RT[3] - g_RT[4]);
+    Kc = Kc_s[76];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[3]) + (h_RT[2] + h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44225,12 +42041,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[1]*sc[1];
-    k_f = prefactor_units[77] * fwd_A[77]
-                * exp(fwd_beta[77] * tc[0] - activation_units[77] * fwd_Ea[77] * invT);
+    k_f = k_f_s[77];
     dlnkfdT = fwd_beta[77] * invT + activation_units[77] * fwd_Ea[77] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[0];
-    Kc = refCinv * exp(g_RT[0] - 2*g_RT[0] + 2*g_RT[1]);
+    Kc = Kc_s[77];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + 2*h_RT[1]) + (2*h_RT[0]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44256,12 +42071,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[1]*sc[5];
-    k_f = prefactor_units[78] * fwd_A[78]
-                * exp(fwd_beta[78] * tc[0] - activation_units[78] * fwd_Ea[78] * invT);
+    k_f = k_f_s[78];
     dlnkfdT = fwd_beta[78] * invT + activation_units[78] * fwd_Ea[78] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[5];
-    Kc = refCinv * exp(-g_RT[0] + 2*g_RT[1] + g_RT[5] - g_RT[5]);
+    Kc = Kc_s[78];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[1] + h_RT[5]) + (h_RT[0] + h_RT[5]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44291,12 +42105,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[1]*sc[15];
-    k_f = prefactor_units[79] * fwd_A[79]
-                * exp(fwd_beta[79] * tc[0] - activation_units[79] * fwd_Ea[79] * invT);
+    k_f = k_f_s[79];
     dlnkfdT = fwd_beta[79] * invT + activation_units[79] * fwd_Ea[79] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[15];
-    Kc = refCinv * exp(-g_RT[0] + 2*g_RT[1] + g_RT[15] - g_RT[15]);
+    Kc = Kc_s[79];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[1] + h_RT[15]) + (h_RT[0] + h_RT[15]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44326,12 +42139,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[6];
-    k_f = prefactor_units[80] * fwd_A[80]
-                * exp(fwd_beta[80] * tc[0] - activation_units[80] * fwd_Ea[80] * invT);
+    k_f = k_f_s[80];
     dlnkfdT = fwd_beta[80] * invT + activation_units[80] * fwd_Ea[80] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[5];
-    Kc = exp(g_RT[1] - g_RT[2] - g_RT[5] + g_RT[6]);
+    Kc = Kc_s[80];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[6]) + (h_RT[2] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44377,12 +42189,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[6];
-    k_f = prefactor_units[81] * fwd_A[81]
-                * exp(fwd_beta[81] * tc[0] - activation_units[81] * fwd_Ea[81] * invT);
+    k_f = k_f_s[81];
     dlnkfdT = fwd_beta[81] * invT + activation_units[81] * fwd_Ea[81] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[3];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[3] + g_RT[6]);
+    Kc = Kc_s[81];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[6]) + (h_RT[0] + h_RT[3]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44428,12 +42239,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[6];
-    k_f = prefactor_units[82] * fwd_A[82]
-                * exp(fwd_beta[82] * tc[0] - activation_units[82] * fwd_Ea[82] * invT);
+    k_f = k_f_s[82];
     dlnkfdT = fwd_beta[82] * invT + activation_units[82] * fwd_Ea[82] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[4];
-    Kc = exp(g_RT[1] - 2*g_RT[4] + g_RT[6]);
+    Kc = Kc_s[82];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[6]) + (2*h_RT[4]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44468,12 +42278,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[7];
-    k_f = prefactor_units[83] * fwd_A[83]
-                * exp(fwd_beta[83] * tc[0] - activation_units[83] * fwd_Ea[83] * invT);
+    k_f = k_f_s[83];
     dlnkfdT = fwd_beta[83] * invT + activation_units[83] * fwd_Ea[83] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[6];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[83];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[7]) + (h_RT[0] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44519,12 +42328,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[7];
-    k_f = prefactor_units[84] * fwd_A[84]
-                * exp(fwd_beta[84] * tc[0] - activation_units[84] * fwd_Ea[84] * invT);
+    k_f = k_f_s[84];
     dlnkfdT = fwd_beta[84] * invT + activation_units[84] * fwd_Ea[84] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[5];
-    Kc = exp(g_RT[1] - g_RT[4] - g_RT[5] + g_RT[7]);
+    Kc = Kc_s[84];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[7]) + (h_RT[4] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44570,12 +42378,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[9];
-    k_f = prefactor_units[85] * fwd_A[85]
-                * exp(fwd_beta[85] * tc[0] - activation_units[85] * fwd_Ea[85] * invT);
+    k_f = k_f_s[85];
     dlnkfdT = fwd_beta[85] * invT + activation_units[85] * fwd_Ea[85] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[8];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[8] + g_RT[9]);
+    Kc = Kc_s[85];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[9]) + (h_RT[0] + h_RT[8]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44621,12 +42428,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[11];
-    k_f = prefactor_units[86] * fwd_A[86]
-                * exp(fwd_beta[86] * tc[0] - activation_units[86] * fwd_Ea[86] * invT);
+    k_f = k_f_s[86];
     dlnkfdT = fwd_beta[86] * invT + activation_units[86] * fwd_Ea[86] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[9];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[9] + g_RT[11]);
+    Kc = Kc_s[86];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[11]) + (h_RT[0] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44672,12 +42478,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[13];
-    k_f = prefactor_units[87] * fwd_A[87]
-                * exp(fwd_beta[87] * tc[0] - activation_units[87] * fwd_Ea[87] * invT);
+    k_f = k_f_s[87];
     dlnkfdT = fwd_beta[87] * invT + activation_units[87] * fwd_Ea[87] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[12];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[12] + g_RT[13]);
+    Kc = Kc_s[87];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[13]) + (h_RT[0] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44723,12 +42528,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[16];
-    k_f = prefactor_units[88] * fwd_A[88]
-                * exp(fwd_beta[88] * tc[0] - activation_units[88] * fwd_Ea[88] * invT);
+    k_f = k_f_s[88];
     dlnkfdT = fwd_beta[88] * invT + activation_units[88] * fwd_Ea[88] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[14];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[88];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[16]) + (h_RT[0] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44774,12 +42578,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[17];
-    k_f = prefactor_units[89] * fwd_A[89]
-                * exp(fwd_beta[89] * tc[0] - activation_units[89] * fwd_Ea[89] * invT);
+    k_f = k_f_s[89];
     dlnkfdT = fwd_beta[89] * invT + activation_units[89] * fwd_Ea[89] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[16];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[89];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[17]) + (h_RT[0] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44825,12 +42628,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[18];
-    k_f = prefactor_units[90] * fwd_A[90]
-                * exp(fwd_beta[90] * tc[0] - activation_units[90] * fwd_Ea[90] * invT);
+    k_f = k_f_s[90];
     dlnkfdT = fwd_beta[90] * invT + activation_units[90] * fwd_Ea[90] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[17];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[90];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[18]) + (h_RT[0] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44876,12 +42678,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[18];
-    k_f = prefactor_units[91] * fwd_A[91]
-                * exp(fwd_beta[91] * tc[0] - activation_units[91] * fwd_Ea[91] * invT);
+    k_f = k_f_s[91];
     dlnkfdT = fwd_beta[91] * invT + activation_units[91] * fwd_Ea[91] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[12];
-    Kc = exp(g_RT[1] - g_RT[4] - g_RT[12] + g_RT[18]);
+    Kc = Kc_s[91];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[18]) + (h_RT[4] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44927,12 +42728,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[18];
-    k_f = prefactor_units[92] * fwd_A[92]
-                * exp(fwd_beta[92] * tc[0] - activation_units[92] * fwd_Ea[92] * invT);
+    k_f = k_f_s[92];
     dlnkfdT = fwd_beta[92] * invT + activation_units[92] * fwd_Ea[92] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[11];
-    Kc = exp(g_RT[1] - g_RT[5] - g_RT[11] + g_RT[18]);
+    Kc = Kc_s[92];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[18]) + (h_RT[5] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -44978,12 +42778,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[93] * fwd_A[93]
-                * exp(fwd_beta[93] * tc[0] - activation_units[93] * fwd_Ea[93] * invT);
+    k_f = k_f_s[93];
     dlnkfdT = fwd_beta[93] * invT + activation_units[93] * fwd_Ea[93] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[18];
-    Kc = exp(g_RT[1] - g_RT[1] - g_RT[18] + g_RT[19]);
+    Kc = Kc_s[93];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[1] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45013,12 +42812,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[94] * fwd_A[94]
-                * exp(fwd_beta[94] * tc[0] - activation_units[94] * fwd_Ea[94] * invT);
+    k_f = k_f_s[94];
     dlnkfdT = fwd_beta[94] * invT + activation_units[94] * fwd_Ea[94] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[17];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[17] + g_RT[19]);
+    Kc = Kc_s[94];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[0] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45064,12 +42862,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[95] * fwd_A[95]
-                * exp(fwd_beta[95] * tc[0] - activation_units[95] * fwd_Ea[95] * invT);
+    k_f = k_f_s[95];
     dlnkfdT = fwd_beta[95] * invT + activation_units[95] * fwd_Ea[95] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[12];
-    Kc = exp(g_RT[1] - g_RT[4] - g_RT[12] + g_RT[19]);
+    Kc = Kc_s[95];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[4] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45115,12 +42912,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[19];
-    k_f = prefactor_units[96] * fwd_A[96]
-                * exp(fwd_beta[96] * tc[0] - activation_units[96] * fwd_Ea[96] * invT);
+    k_f = k_f_s[96];
     dlnkfdT = fwd_beta[96] * invT + activation_units[96] * fwd_Ea[96] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[11];
-    Kc = exp(g_RT[1] - g_RT[5] - g_RT[11] + g_RT[19]);
+    Kc = Kc_s[96];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[19]) + (h_RT[5] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45166,12 +42962,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[20];
-    k_f = prefactor_units[97] * fwd_A[97]
-                * exp(fwd_beta[97] * tc[0] - activation_units[97] * fwd_Ea[97] * invT);
+    k_f = k_f_s[97];
     dlnkfdT = fwd_beta[97] * invT + activation_units[97] * fwd_Ea[97] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[18];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[97];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[20]) + (h_RT[0] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45217,12 +43012,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[20];
-    k_f = prefactor_units[98] * fwd_A[98]
-                * exp(fwd_beta[98] * tc[0] - activation_units[98] * fwd_Ea[98] * invT);
+    k_f = k_f_s[98];
     dlnkfdT = fwd_beta[98] * invT + activation_units[98] * fwd_Ea[98] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[19];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[19] + g_RT[20]);
+    Kc = Kc_s[98];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[20]) + (h_RT[0] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45268,12 +43062,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[23];
-    k_f = prefactor_units[99] * fwd_A[99]
-                * exp(fwd_beta[99] * tc[0] - activation_units[99] * fwd_Ea[99] * invT);
+    k_f = k_f_s[99];
     dlnkfdT = fwd_beta[99] * invT + activation_units[99] * fwd_Ea[99] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[22];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[22] + g_RT[23]);
+    Kc = Kc_s[99];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[23]) + (h_RT[0] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45319,12 +43112,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[24];
-    k_f = prefactor_units[100] * fwd_A[100]
-                * exp(fwd_beta[100] * tc[0] - activation_units[100] * fwd_Ea[100] * invT);
+    k_f = k_f_s[100];
     dlnkfdT = fwd_beta[100] * invT + activation_units[100] * fwd_Ea[100] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[23];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[23] + g_RT[24]);
+    Kc = Kc_s[100];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[24]) + (h_RT[0] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45370,12 +43162,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[25];
-    k_f = prefactor_units[101] * fwd_A[101]
-                * exp(fwd_beta[101] * tc[0] - activation_units[101] * fwd_Ea[101] * invT);
+    k_f = k_f_s[101];
     dlnkfdT = fwd_beta[101] * invT + activation_units[101] * fwd_Ea[101] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[24];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[24] + g_RT[25]);
+    Kc = Kc_s[101];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[25]) + (h_RT[0] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45421,12 +43212,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[26];
-    k_f = prefactor_units[102] * fwd_A[102]
-                * exp(fwd_beta[102] * tc[0] - activation_units[102] * fwd_Ea[102] * invT);
+    k_f = k_f_s[102];
     dlnkfdT = fwd_beta[102] * invT + activation_units[102] * fwd_Ea[102] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[25];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[25] + g_RT[26]);
+    Kc = Kc_s[102];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[26]) + (h_RT[0] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45472,12 +43262,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[27];
-    k_f = prefactor_units[103] * fwd_A[103]
-                * exp(fwd_beta[103] * tc[0] - activation_units[103] * fwd_Ea[103] * invT);
+    k_f = k_f_s[103];
     dlnkfdT = fwd_beta[103] * invT + activation_units[103] * fwd_Ea[103] * invT2;
     /* reverse */
     phi_r = sc[11]*sc[14];
-    Kc = exp(g_RT[1] - g_RT[11] - g_RT[14] + g_RT[27]);
+    Kc = Kc_s[103];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[27]) + (h_RT[11] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45523,12 +43312,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[28];
-    k_f = prefactor_units[104] * fwd_A[104]
-                * exp(fwd_beta[104] * tc[0] - activation_units[104] * fwd_Ea[104] * invT);
+    k_f = k_f_s[104];
     dlnkfdT = fwd_beta[104] * invT + activation_units[104] * fwd_Ea[104] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[27];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[27] + g_RT[28]);
+    Kc = Kc_s[104];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[28]) + (h_RT[0] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45574,12 +43362,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[28];
-    k_f = prefactor_units[105] * fwd_A[105]
-                * exp(fwd_beta[105] * tc[0] - activation_units[105] * fwd_Ea[105] * invT);
+    k_f = k_f_s[105];
     dlnkfdT = fwd_beta[105] * invT + activation_units[105] * fwd_Ea[105] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[14];
-    Kc = exp(g_RT[1] - g_RT[12] - g_RT[14] + g_RT[28]);
+    Kc = Kc_s[105];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[28]) + (h_RT[12] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45625,12 +43412,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[29];
-    k_f = prefactor_units[106] * fwd_A[106]
-                * exp(fwd_beta[106] * tc[0] - activation_units[106] * fwd_Ea[106] * invT);
+    k_f = k_f_s[106];
     dlnkfdT = fwd_beta[106] * invT + activation_units[106] * fwd_Ea[106] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[28];
-    Kc = exp(g_RT[1] - g_RT[1] - g_RT[28] + g_RT[29]);
+    Kc = Kc_s[106];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[29]) + (h_RT[1] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45660,12 +43446,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[4];
-    k_f = prefactor_units[107] * fwd_A[107]
-                * exp(fwd_beta[107] * tc[0] - activation_units[107] * fwd_Ea[107] * invT);
+    k_f = k_f_s[107];
     dlnkfdT = fwd_beta[107] * invT + activation_units[107] * fwd_Ea[107] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[5];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[4] - g_RT[5]);
+    Kc = Kc_s[107];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[4]) + (h_RT[1] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45711,12 +43496,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[4];
-    k_f = prefactor_units[108] * fwd_A[108]
-                * exp(fwd_beta[108] * tc[0] - activation_units[108] * fwd_Ea[108] * invT);
+    k_f = k_f_s[108];
     dlnkfdT = fwd_beta[108] * invT + activation_units[108] * fwd_Ea[108] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[5];
-    Kc = exp(-g_RT[2] + 2*g_RT[4] - g_RT[5]);
+    Kc = Kc_s[108];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[4]) + (h_RT[2] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45751,12 +43535,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[6];
-    k_f = prefactor_units[109] * fwd_A[109]
-                * exp(fwd_beta[109] * tc[0] - activation_units[109] * fwd_Ea[109] * invT);
+    k_f = k_f_s[109];
     dlnkfdT = fwd_beta[109] * invT + activation_units[109] * fwd_Ea[109] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[5];
-    Kc = exp(-g_RT[3] + g_RT[4] - g_RT[5] + g_RT[6]);
+    Kc = Kc_s[109];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[6]) + (h_RT[3] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45802,12 +43585,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[7];
-    k_f = prefactor_units[110] * fwd_A[110]
-                * exp(fwd_beta[110] * tc[0] - activation_units[110] * fwd_Ea[110] * invT);
+    k_f = k_f_s[110];
     dlnkfdT = fwd_beta[110] * invT + activation_units[110] * fwd_Ea[110] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[110];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[7]) + (h_RT[5] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45853,12 +43635,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[7];
-    k_f = prefactor_units[111] * fwd_A[111]
-                * exp(fwd_beta[111] * tc[0] - activation_units[111] * fwd_Ea[111] * invT);
+    k_f = k_f_s[111];
     dlnkfdT = fwd_beta[111] * invT + activation_units[111] * fwd_Ea[111] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[6];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[6] + g_RT[7]);
+    Kc = Kc_s[111];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[7]) + (h_RT[5] + h_RT[6]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45904,12 +43685,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[8];
-    k_f = prefactor_units[112] * fwd_A[112]
-                * exp(fwd_beta[112] * tc[0] - activation_units[112] * fwd_Ea[112] * invT);
+    k_f = k_f_s[112];
     dlnkfdT = fwd_beta[112] * invT + activation_units[112] * fwd_Ea[112] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[8] - g_RT[14]);
+    Kc = Kc_s[112];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[8]) + (h_RT[1] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -45955,12 +43735,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[9];
-    k_f = prefactor_units[113] * fwd_A[113]
-                * exp(fwd_beta[113] * tc[0] - activation_units[113] * fwd_Ea[113] * invT);
+    k_f = k_f_s[113];
     dlnkfdT = fwd_beta[113] * invT + activation_units[113] * fwd_Ea[113] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[16];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[9] - g_RT[16]);
+    Kc = Kc_s[113];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[9]) + (h_RT[1] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46006,12 +43785,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[10];
-    k_f = prefactor_units[114] * fwd_A[114]
-                * exp(fwd_beta[114] * tc[0] - activation_units[114] * fwd_Ea[114] * invT);
+    k_f = k_f_s[114];
     dlnkfdT = fwd_beta[114] * invT + activation_units[114] * fwd_Ea[114] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[17];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[10] - g_RT[17]);
+    Kc = Kc_s[114];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[10]) + (h_RT[1] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46057,12 +43835,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[10];
-    k_f = prefactor_units[115] * fwd_A[115]
-                * exp(fwd_beta[115] * tc[0] - activation_units[115] * fwd_Ea[115] * invT);
+    k_f = k_f_s[115];
     dlnkfdT = fwd_beta[115] * invT + activation_units[115] * fwd_Ea[115] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[9];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[9] + g_RT[10]);
+    Kc = Kc_s[115];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[10]) + (h_RT[5] + h_RT[9]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46108,12 +43885,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[11];
-    k_f = prefactor_units[116] * fwd_A[116]
-                * exp(fwd_beta[116] * tc[0] - activation_units[116] * fwd_Ea[116] * invT);
+    k_f = k_f_s[116];
     dlnkfdT = fwd_beta[116] * invT + activation_units[116] * fwd_Ea[116] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[17];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[11] - g_RT[17]);
+    Kc = Kc_s[116];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[11]) + (h_RT[1] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46159,12 +43935,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[12];
-    k_f = prefactor_units[117] * fwd_A[117]
-                * exp(fwd_beta[117] * tc[0] - activation_units[117] * fwd_Ea[117] * invT);
+    k_f = k_f_s[117];
     dlnkfdT = fwd_beta[117] * invT + activation_units[117] * fwd_Ea[117] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[10];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[10] + g_RT[12]);
+    Kc = Kc_s[117];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[12]) + (h_RT[5] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46210,12 +43985,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[12];
-    k_f = prefactor_units[118] * fwd_A[118]
-                * exp(fwd_beta[118] * tc[0] - activation_units[118] * fwd_Ea[118] * invT);
+    k_f = k_f_s[118];
     dlnkfdT = fwd_beta[118] * invT + activation_units[118] * fwd_Ea[118] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[11];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[11] + g_RT[12]);
+    Kc = Kc_s[118];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[12]) + (h_RT[5] + h_RT[11]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46261,12 +44035,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[13];
-    k_f = prefactor_units[119] * fwd_A[119]
-                * exp(fwd_beta[119] * tc[0] - activation_units[119] * fwd_Ea[119] * invT);
+    k_f = k_f_s[119];
     dlnkfdT = fwd_beta[119] * invT + activation_units[119] * fwd_Ea[119] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[12];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[12] + g_RT[13]);
+    Kc = Kc_s[119];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[13]) + (h_RT[5] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46312,12 +44085,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[14];
-    k_f = prefactor_units[120] * fwd_A[120]
-                * exp(fwd_beta[120] * tc[0] - activation_units[120] * fwd_Ea[120] * invT);
+    k_f = k_f_s[120];
     dlnkfdT = fwd_beta[120] * invT + activation_units[120] * fwd_Ea[120] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[15];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[120];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[14]) + (h_RT[1] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46363,12 +44135,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[16];
-    k_f = prefactor_units[121] * fwd_A[121]
-                * exp(fwd_beta[121] * tc[0] - activation_units[121] * fwd_Ea[121] * invT);
+    k_f = k_f_s[121];
     dlnkfdT = fwd_beta[121] * invT + activation_units[121] * fwd_Ea[121] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[14];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[121];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[16]) + (h_RT[5] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46414,12 +44185,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[17];
-    k_f = prefactor_units[122] * fwd_A[122]
-                * exp(fwd_beta[122] * tc[0] - activation_units[122] * fwd_Ea[122] * invT);
+    k_f = k_f_s[122];
     dlnkfdT = fwd_beta[122] * invT + activation_units[122] * fwd_Ea[122] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[16];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[122];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[17]) + (h_RT[5] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46465,12 +44235,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[18];
-    k_f = prefactor_units[123] * fwd_A[123]
-                * exp(fwd_beta[123] * tc[0] - activation_units[123] * fwd_Ea[123] * invT);
+    k_f = k_f_s[123];
     dlnkfdT = fwd_beta[123] * invT + activation_units[123] * fwd_Ea[123] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[17];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[123];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[18]) + (h_RT[5] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46516,12 +44285,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[19];
-    k_f = prefactor_units[124] * fwd_A[124]
-                * exp(fwd_beta[124] * tc[0] - activation_units[124] * fwd_Ea[124] * invT);
+    k_f = k_f_s[124];
     dlnkfdT = fwd_beta[124] * invT + activation_units[124] * fwd_Ea[124] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[17];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[17] + g_RT[19]);
+    Kc = Kc_s[124];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[19]) + (h_RT[5] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46567,12 +44335,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[20];
-    k_f = prefactor_units[125] * fwd_A[125]
-                * exp(fwd_beta[125] * tc[0] - activation_units[125] * fwd_Ea[125] * invT);
+    k_f = k_f_s[125];
     dlnkfdT = fwd_beta[125] * invT + activation_units[125] * fwd_Ea[125] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[18];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[125];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[20]) + (h_RT[5] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46618,12 +44385,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[20];
-    k_f = prefactor_units[126] * fwd_A[126]
-                * exp(fwd_beta[126] * tc[0] - activation_units[126] * fwd_Ea[126] * invT);
+    k_f = k_f_s[126];
     dlnkfdT = fwd_beta[126] * invT + activation_units[126] * fwd_Ea[126] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[19];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[19] + g_RT[20]);
+    Kc = Kc_s[126];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[20]) + (h_RT[5] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46669,12 +44435,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[21];
-    k_f = prefactor_units[127] * fwd_A[127]
-                * exp(fwd_beta[127] * tc[0] - activation_units[127] * fwd_Ea[127] * invT);
+    k_f = k_f_s[127];
     dlnkfdT = fwd_beta[127] * invT + activation_units[127] * fwd_Ea[127] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[27];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[21] - g_RT[27]);
+    Kc = Kc_s[127];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[21]) + (h_RT[1] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46720,12 +44485,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[22];
-    k_f = prefactor_units[128] * fwd_A[128]
-                * exp(fwd_beta[128] * tc[0] - activation_units[128] * fwd_Ea[128] * invT);
+    k_f = k_f_s[128];
     dlnkfdT = fwd_beta[128] * invT + activation_units[128] * fwd_Ea[128] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[28];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[22] - g_RT[28]);
+    Kc = Kc_s[128];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[22]) + (h_RT[1] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46771,12 +44535,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[22];
-    k_f = prefactor_units[129] * fwd_A[129]
-                * exp(fwd_beta[129] * tc[0] - activation_units[129] * fwd_Ea[129] * invT);
+    k_f = k_f_s[129];
     dlnkfdT = fwd_beta[129] * invT + activation_units[129] * fwd_Ea[129] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[29];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[22] - g_RT[29]);
+    Kc = Kc_s[129];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[22]) + (h_RT[1] + h_RT[29]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46822,12 +44585,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[22];
-    k_f = prefactor_units[130] * fwd_A[130]
-                * exp(fwd_beta[130] * tc[0] - activation_units[130] * fwd_Ea[130] * invT);
+    k_f = k_f_s[130];
     dlnkfdT = fwd_beta[130] * invT + activation_units[130] * fwd_Ea[130] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[21];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[21] + g_RT[22]);
+    Kc = Kc_s[130];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[22]) + (h_RT[5] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46873,12 +44635,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[22];
-    k_f = prefactor_units[131] * fwd_A[131]
-                * exp(fwd_beta[131] * tc[0] - activation_units[131] * fwd_Ea[131] * invT);
+    k_f = k_f_s[131];
     dlnkfdT = fwd_beta[131] * invT + activation_units[131] * fwd_Ea[131] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[14];
-    Kc = exp(g_RT[4] - g_RT[12] - g_RT[14] + g_RT[22]);
+    Kc = Kc_s[131];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[22]) + (h_RT[12] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46924,12 +44685,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[23];
-    k_f = prefactor_units[132] * fwd_A[132]
-                * exp(fwd_beta[132] * tc[0] - activation_units[132] * fwd_Ea[132] * invT);
+    k_f = k_f_s[132];
     dlnkfdT = fwd_beta[132] * invT + activation_units[132] * fwd_Ea[132] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[22];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[22] + g_RT[23]);
+    Kc = Kc_s[132];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[23]) + (h_RT[5] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -46975,12 +44735,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[24];
-    k_f = prefactor_units[133] * fwd_A[133]
-                * exp(fwd_beta[133] * tc[0] - activation_units[133] * fwd_Ea[133] * invT);
+    k_f = k_f_s[133];
     dlnkfdT = fwd_beta[133] * invT + activation_units[133] * fwd_Ea[133] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[23];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[23] + g_RT[24]);
+    Kc = Kc_s[133];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[24]) + (h_RT[5] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47026,12 +44785,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[26];
-    k_f = prefactor_units[134] * fwd_A[134]
-                * exp(fwd_beta[134] * tc[0] - activation_units[134] * fwd_Ea[134] * invT);
+    k_f = k_f_s[134];
     dlnkfdT = fwd_beta[134] * invT + activation_units[134] * fwd_Ea[134] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[25];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[25] + g_RT[26]);
+    Kc = Kc_s[134];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[26]) + (h_RT[5] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47077,12 +44835,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[28];
-    k_f = prefactor_units[135] * fwd_A[135]
-                * exp(fwd_beta[135] * tc[0] - activation_units[135] * fwd_Ea[135] * invT);
+    k_f = k_f_s[135];
     dlnkfdT = fwd_beta[135] * invT + activation_units[135] * fwd_Ea[135] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[27];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[27] + g_RT[28]);
+    Kc = Kc_s[135];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[28]) + (h_RT[5] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47128,12 +44885,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[6];
-    k_f = prefactor_units[136] * fwd_A[136]
-                * exp(fwd_beta[136] * tc[0] - activation_units[136] * fwd_Ea[136] * invT);
+    k_f = k_f_s[136];
     dlnkfdT = fwd_beta[136] * invT + activation_units[136] * fwd_Ea[136] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[7];
-    Kc = exp(-g_RT[3] + 2*g_RT[6] - g_RT[7]);
+    Kc = Kc_s[136];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[6]) + (h_RT[3] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47168,12 +44924,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[6];
-    k_f = prefactor_units[137] * fwd_A[137]
-                * exp(fwd_beta[137] * tc[0] - activation_units[137] * fwd_Ea[137] * invT);
+    k_f = k_f_s[137];
     dlnkfdT = fwd_beta[137] * invT + activation_units[137] * fwd_Ea[137] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[7];
-    Kc = exp(-g_RT[3] + 2*g_RT[6] - g_RT[7]);
+    Kc = Kc_s[137];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[6]) + (h_RT[3] + h_RT[7]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47208,12 +44963,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[10];
-    k_f = prefactor_units[138] * fwd_A[138]
-                * exp(fwd_beta[138] * tc[0] - activation_units[138] * fwd_Ea[138] * invT);
+    k_f = k_f_s[138];
     dlnkfdT = fwd_beta[138] * invT + activation_units[138] * fwd_Ea[138] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[17];
-    Kc = exp(-g_RT[4] + g_RT[6] + g_RT[10] - g_RT[17]);
+    Kc = Kc_s[138];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[10]) + (h_RT[4] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47259,12 +45013,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[12];
-    k_f = prefactor_units[139] * fwd_A[139]
-                * exp(fwd_beta[139] * tc[0] - activation_units[139] * fwd_Ea[139] * invT);
+    k_f = k_f_s[139];
     dlnkfdT = fwd_beta[139] * invT + activation_units[139] * fwd_Ea[139] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[13];
-    Kc = exp(-g_RT[3] + g_RT[6] + g_RT[12] - g_RT[13]);
+    Kc = Kc_s[139];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[12]) + (h_RT[3] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47310,12 +45063,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[12];
-    k_f = prefactor_units[140] * fwd_A[140]
-                * exp(fwd_beta[140] * tc[0] - activation_units[140] * fwd_Ea[140] * invT);
+    k_f = k_f_s[140];
     dlnkfdT = fwd_beta[140] * invT + activation_units[140] * fwd_Ea[140] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[19];
-    Kc = exp(-g_RT[4] + g_RT[6] + g_RT[12] - g_RT[19]);
+    Kc = Kc_s[140];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[12]) + (h_RT[4] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47361,12 +45113,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[14];
-    k_f = prefactor_units[141] * fwd_A[141]
-                * exp(fwd_beta[141] * tc[0] - activation_units[141] * fwd_Ea[141] * invT);
+    k_f = k_f_s[141];
     dlnkfdT = fwd_beta[141] * invT + activation_units[141] * fwd_Ea[141] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[15];
-    Kc = exp(-g_RT[4] + g_RT[6] + g_RT[14] - g_RT[15]);
+    Kc = Kc_s[141];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[14]) + (h_RT[4] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47412,12 +45163,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[17];
-    k_f = prefactor_units[142] * fwd_A[142]
-                * exp(fwd_beta[142] * tc[0] - activation_units[142] * fwd_Ea[142] * invT);
+    k_f = k_f_s[142];
     dlnkfdT = fwd_beta[142] * invT + activation_units[142] * fwd_Ea[142] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[16];
-    Kc = exp(g_RT[6] - g_RT[7] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[142];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[17]) + (h_RT[7] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47463,12 +45213,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[8];
-    k_f = prefactor_units[143] * fwd_A[143]
-                * exp(fwd_beta[143] * tc[0] - activation_units[143] * fwd_Ea[143] * invT);
+    k_f = k_f_s[143];
     dlnkfdT = fwd_beta[143] * invT + activation_units[143] * fwd_Ea[143] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[14];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[8] - g_RT[14]);
+    Kc = Kc_s[143];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[8]) + (h_RT[2] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47514,12 +45263,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[10];
-    k_f = prefactor_units[144] * fwd_A[144]
-                * exp(fwd_beta[144] * tc[0] - activation_units[144] * fwd_Ea[144] * invT);
+    k_f = k_f_s[144];
     dlnkfdT = fwd_beta[144] * invT + activation_units[144] * fwd_Ea[144] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[21];
-    Kc = exp(-g_RT[1] + g_RT[8] + g_RT[10] - g_RT[21]);
+    Kc = Kc_s[144];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[10]) + (h_RT[1] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47565,12 +45313,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[8]*sc[12];
-    k_f = prefactor_units[145] * fwd_A[145]
-                * exp(fwd_beta[145] * tc[0] - activation_units[145] * fwd_Ea[145] * invT);
+    k_f = k_f_s[145];
     dlnkfdT = fwd_beta[145] * invT + activation_units[145] * fwd_Ea[145] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[22];
-    Kc = exp(-g_RT[1] + g_RT[8] + g_RT[12] - g_RT[22]);
+    Kc = Kc_s[145];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[8] + h_RT[12]) + (h_RT[1] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47616,12 +45363,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[9];
-    k_f = prefactor_units[146] * fwd_A[146]
-                * exp(fwd_beta[146] * tc[0] - activation_units[146] * fwd_Ea[146] * invT);
+    k_f = k_f_s[146];
     dlnkfdT = fwd_beta[146] * invT + activation_units[146] * fwd_Ea[146] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[16];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[9] - g_RT[16]);
+    Kc = Kc_s[146];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[9]) + (h_RT[2] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47667,12 +45413,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[9];
-    k_f = prefactor_units[147] * fwd_A[147]
-                * exp(fwd_beta[147] * tc[0] - activation_units[147] * fwd_Ea[147] * invT);
+    k_f = k_f_s[147];
     dlnkfdT = fwd_beta[147] * invT + activation_units[147] * fwd_Ea[147] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[10];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[9] - g_RT[10]);
+    Kc = Kc_s[147];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[9]) + (h_RT[1] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47718,12 +45463,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[9];
-    k_f = prefactor_units[148] * fwd_A[148]
-                * exp(fwd_beta[148] * tc[0] - activation_units[148] * fwd_Ea[148] * invT);
+    k_f = k_f_s[148];
     dlnkfdT = fwd_beta[148] * invT + activation_units[148] * fwd_Ea[148] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[17];
-    Kc = exp(-g_RT[1] + g_RT[5] + g_RT[9] - g_RT[17]);
+    Kc = Kc_s[148];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[9]) + (h_RT[1] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47769,12 +45513,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[10];
-    k_f = prefactor_units[149] * fwd_A[149]
-                * exp(fwd_beta[149] * tc[0] - activation_units[149] * fwd_Ea[149] * invT);
+    k_f = k_f_s[149];
     dlnkfdT = fwd_beta[149] * invT + activation_units[149] * fwd_Ea[149] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[22];
-    Kc = exp(-g_RT[1] + g_RT[9] + g_RT[10] - g_RT[22]);
+    Kc = Kc_s[149];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[10]) + (h_RT[1] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47820,12 +45563,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[12];
-    k_f = prefactor_units[150] * fwd_A[150]
-                * exp(fwd_beta[150] * tc[0] - activation_units[150] * fwd_Ea[150] * invT);
+    k_f = k_f_s[150];
     dlnkfdT = fwd_beta[150] * invT + activation_units[150] * fwd_Ea[150] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[23];
-    Kc = exp(-g_RT[1] + g_RT[9] + g_RT[12] - g_RT[23]);
+    Kc = Kc_s[150];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[12]) + (h_RT[1] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47871,12 +45613,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[13];
-    k_f = prefactor_units[151] * fwd_A[151]
-                * exp(fwd_beta[151] * tc[0] - activation_units[151] * fwd_Ea[151] * invT);
+    k_f = k_f_s[151];
     dlnkfdT = fwd_beta[151] * invT + activation_units[151] * fwd_Ea[151] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[24];
-    Kc = exp(-g_RT[1] + g_RT[9] + g_RT[13] - g_RT[24]);
+    Kc = Kc_s[151];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[13]) + (h_RT[1] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47922,12 +45663,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[15];
-    k_f = prefactor_units[152] * fwd_A[152]
-                * exp(fwd_beta[152] * tc[0] - activation_units[152] * fwd_Ea[152] * invT);
+    k_f = k_f_s[152];
     dlnkfdT = fwd_beta[152] * invT + activation_units[152] * fwd_Ea[152] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[16];
-    Kc = exp(g_RT[9] - g_RT[14] + g_RT[15] - g_RT[16]);
+    Kc = Kc_s[152];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[15]) + (h_RT[14] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -47973,12 +45713,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[17];
-    k_f = prefactor_units[153] * fwd_A[153]
-                * exp(fwd_beta[153] * tc[0] - activation_units[153] * fwd_Ea[153] * invT);
+    k_f = k_f_s[153];
     dlnkfdT = fwd_beta[153] * invT + activation_units[153] * fwd_Ea[153] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[28];
-    Kc = exp(-g_RT[1] + g_RT[9] + g_RT[17] - g_RT[28]);
+    Kc = Kc_s[153];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[17]) + (h_RT[1] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48024,12 +45763,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[27];
-    k_f = prefactor_units[154] * fwd_A[154]
-                * exp(fwd_beta[154] * tc[0] - activation_units[154] * fwd_Ea[154] * invT);
+    k_f = k_f_s[154];
     dlnkfdT = fwd_beta[154] * invT + activation_units[154] * fwd_Ea[154] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[22];
-    Kc = exp(g_RT[9] - g_RT[14] - g_RT[22] + g_RT[27]);
+    Kc = Kc_s[154];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[27]) + (h_RT[14] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48075,8 +45813,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[10];
-    k_f = prefactor_units[155] * fwd_A[155]
-                * exp(fwd_beta[155] * tc[0] - activation_units[155] * fwd_Ea[155] * invT);
+    k_f = k_f_s[155];
     dlnkfdT = fwd_beta[155] * invT + activation_units[155] * fwd_Ea[155] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -48112,12 +45849,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[10];
-    k_f = prefactor_units[156] * fwd_A[156]
-                * exp(fwd_beta[156] * tc[0] - activation_units[156] * fwd_Ea[156] * invT);
+    k_f = k_f_s[156];
     dlnkfdT = fwd_beta[156] * invT + activation_units[156] * fwd_Ea[156] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[12];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[10] - g_RT[12]);
+    Kc = Kc_s[156];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[10]) + (h_RT[1] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48163,12 +45899,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[10];
-    k_f = prefactor_units[157] * fwd_A[157]
-                * exp(fwd_beta[157] * tc[0] - activation_units[157] * fwd_Ea[157] * invT);
+    k_f = k_f_s[157];
     dlnkfdT = fwd_beta[157] * invT + activation_units[157] * fwd_Ea[157] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[22];
-    Kc = exp(-g_RT[0] + 2*g_RT[10] - g_RT[22]);
+    Kc = Kc_s[157];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[10]) + (h_RT[0] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48203,12 +45938,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[12];
-    k_f = prefactor_units[158] * fwd_A[158]
-                * exp(fwd_beta[158] * tc[0] - activation_units[158] * fwd_Ea[158] * invT);
+    k_f = k_f_s[158];
     dlnkfdT = fwd_beta[158] * invT + activation_units[158] * fwd_Ea[158] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[24];
-    Kc = exp(-g_RT[1] + g_RT[10] + g_RT[12] - g_RT[24]);
+    Kc = Kc_s[158];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[12]) + (h_RT[1] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48254,12 +45988,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[13];
-    k_f = prefactor_units[159] * fwd_A[159]
-                * exp(fwd_beta[159] * tc[0] - activation_units[159] * fwd_Ea[159] * invT);
+    k_f = k_f_s[159];
     dlnkfdT = fwd_beta[159] * invT + activation_units[159] * fwd_Ea[159] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[12];
-    Kc = exp(g_RT[10] - 2*g_RT[12] + g_RT[13]);
+    Kc = Kc_s[159];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[13]) + (2*h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48294,12 +46027,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[27];
-    k_f = prefactor_units[160] * fwd_A[160]
-                * exp(fwd_beta[160] * tc[0] - activation_units[160] * fwd_Ea[160] * invT);
+    k_f = k_f_s[160];
     dlnkfdT = fwd_beta[160] * invT + activation_units[160] * fwd_Ea[160] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[23];
-    Kc = exp(g_RT[10] - g_RT[14] - g_RT[23] + g_RT[27]);
+    Kc = Kc_s[160];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[27]) + (h_RT[14] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48345,12 +46077,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[31];
-    k_f = prefactor_units[161] * fwd_A[161]
-                * exp(fwd_beta[161] * tc[0] - activation_units[161] * fwd_Ea[161] * invT);
+    k_f = k_f_s[161];
     dlnkfdT = fwd_beta[161] * invT + activation_units[161] * fwd_Ea[161] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[31];
-    Kc = exp(-g_RT[10] + g_RT[11] + g_RT[31] - g_RT[31]);
+    Kc = Kc_s[161];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[31]) + (h_RT[10] + h_RT[31]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48380,12 +46111,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[30];
-    k_f = prefactor_units[162] * fwd_A[162]
-                * exp(fwd_beta[162] * tc[0] - activation_units[162] * fwd_Ea[162] * invT);
+    k_f = k_f_s[162];
     dlnkfdT = fwd_beta[162] * invT + activation_units[162] * fwd_Ea[162] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[30];
-    Kc = exp(-g_RT[10] + g_RT[11] + g_RT[30] - g_RT[30]);
+    Kc = Kc_s[162];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[30]) + (h_RT[10] + h_RT[30]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48415,12 +46145,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[11];
-    k_f = prefactor_units[163] * fwd_A[163]
-                * exp(fwd_beta[163] * tc[0] - activation_units[163] * fwd_Ea[163] * invT);
+    k_f = k_f_s[163];
     dlnkfdT = fwd_beta[163] * invT + activation_units[163] * fwd_Ea[163] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[4]*sc[14];
-    Kc = refC * exp(-g_RT[1] + g_RT[3] - g_RT[4] + g_RT[11] - g_RT[14]);
+    Kc = Kc_s[163];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[11]) + (h_RT[1] + h_RT[4] + h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48479,12 +46208,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[11];
-    k_f = prefactor_units[164] * fwd_A[164]
-                * exp(fwd_beta[164] * tc[0] - activation_units[164] * fwd_Ea[164] * invT);
+    k_f = k_f_s[164];
     dlnkfdT = fwd_beta[164] * invT + activation_units[164] * fwd_Ea[164] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[14];
-    Kc = exp(g_RT[3] - g_RT[5] + g_RT[11] - g_RT[14]);
+    Kc = Kc_s[164];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[11]) + (h_RT[5] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48530,12 +46258,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[11];
-    k_f = prefactor_units[165] * fwd_A[165]
-                * exp(fwd_beta[165] * tc[0] - activation_units[165] * fwd_Ea[165] * invT);
+    k_f = k_f_s[165];
     dlnkfdT = fwd_beta[165] * invT + activation_units[165] * fwd_Ea[165] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[12];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[11] - g_RT[12]);
+    Kc = Kc_s[165];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[11]) + (h_RT[1] + h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48581,12 +46308,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[11];
-    k_f = prefactor_units[166] * fwd_A[166]
-                * exp(fwd_beta[166] * tc[0] - activation_units[166] * fwd_Ea[166] * invT);
+    k_f = k_f_s[166];
     dlnkfdT = fwd_beta[166] * invT + activation_units[166] * fwd_Ea[166] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[10];
-    Kc = exp(g_RT[5] - g_RT[5] - g_RT[10] + g_RT[11]);
+    Kc = Kc_s[166];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[11]) + (h_RT[5] + h_RT[10]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48616,12 +46342,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[12];
-    k_f = prefactor_units[167] * fwd_A[167]
-                * exp(fwd_beta[167] * tc[0] - activation_units[167] * fwd_Ea[167] * invT);
+    k_f = k_f_s[167];
     dlnkfdT = fwd_beta[167] * invT + activation_units[167] * fwd_Ea[167] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[24];
-    Kc = exp(-g_RT[1] + g_RT[11] + g_RT[12] - g_RT[24]);
+    Kc = Kc_s[167];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[12]) + (h_RT[1] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48667,12 +46392,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[13];
-    k_f = prefactor_units[168] * fwd_A[168]
-                * exp(fwd_beta[168] * tc[0] - activation_units[168] * fwd_Ea[168] * invT);
+    k_f = k_f_s[168];
     dlnkfdT = fwd_beta[168] * invT + activation_units[168] * fwd_Ea[168] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[12];
-    Kc = exp(g_RT[11] - 2*g_RT[12] + g_RT[13]);
+    Kc = Kc_s[168];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[13]) + (2*h_RT[12]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48707,12 +46431,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[14];
-    k_f = prefactor_units[169] * fwd_A[169]
-                * exp(fwd_beta[169] * tc[0] - activation_units[169] * fwd_Ea[169] * invT);
+    k_f = k_f_s[169];
     dlnkfdT = fwd_beta[169] * invT + activation_units[169] * fwd_Ea[169] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[14];
-    Kc = exp(-g_RT[10] + g_RT[11] + g_RT[14] - g_RT[14]);
+    Kc = Kc_s[169];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[14]) + (h_RT[10] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48742,12 +46465,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[15];
-    k_f = prefactor_units[170] * fwd_A[170]
-                * exp(fwd_beta[170] * tc[0] - activation_units[170] * fwd_Ea[170] * invT);
+    k_f = k_f_s[170];
     dlnkfdT = fwd_beta[170] * invT + activation_units[170] * fwd_Ea[170] * invT2;
     /* reverse */
     phi_r = sc[10]*sc[15];
-    Kc = exp(-g_RT[10] + g_RT[11] + g_RT[15] - g_RT[15]);
+    Kc = Kc_s[170];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[15]) + (h_RT[10] + h_RT[15]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48777,12 +46499,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[15];
-    k_f = prefactor_units[171] * fwd_A[171]
-                * exp(fwd_beta[171] * tc[0] - activation_units[171] * fwd_Ea[171] * invT);
+    k_f = k_f_s[171];
     dlnkfdT = fwd_beta[171] * invT + activation_units[171] * fwd_Ea[171] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[17];
-    Kc = exp(g_RT[11] - g_RT[14] + g_RT[15] - g_RT[17]);
+    Kc = Kc_s[171];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[15]) + (h_RT[14] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48828,12 +46549,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[26];
-    k_f = prefactor_units[172] * fwd_A[172]
-                * exp(fwd_beta[172] * tc[0] - activation_units[172] * fwd_Ea[172] * invT);
+    k_f = k_f_s[172];
     dlnkfdT = fwd_beta[172] * invT + activation_units[172] * fwd_Ea[172] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[25];
-    Kc = exp(g_RT[11] - g_RT[12] - g_RT[25] + g_RT[26]);
+    Kc = Kc_s[172];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[26]) + (h_RT[12] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48879,12 +46599,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[12];
-    k_f = prefactor_units[173] * fwd_A[173]
-                * exp(fwd_beta[173] * tc[0] - activation_units[173] * fwd_Ea[173] * invT);
+    k_f = k_f_s[173];
     dlnkfdT = fwd_beta[173] * invT + activation_units[173] * fwd_Ea[173] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[19];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[12] - g_RT[19]);
+    Kc = Kc_s[173];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[12]) + (h_RT[2] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48930,12 +46649,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[12];
-    k_f = prefactor_units[174] * fwd_A[174]
-                * exp(fwd_beta[174] * tc[0] - activation_units[174] * fwd_Ea[174] * invT);
+    k_f = k_f_s[174];
     dlnkfdT = fwd_beta[174] * invT + activation_units[174] * fwd_Ea[174] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[17];
-    Kc = exp(g_RT[3] - g_RT[4] + g_RT[12] - g_RT[17]);
+    Kc = Kc_s[174];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[12]) + (h_RT[4] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -48981,12 +46699,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[7]*sc[12];
-    k_f = prefactor_units[175] * fwd_A[175]
-                * exp(fwd_beta[175] * tc[0] - activation_units[175] * fwd_Ea[175] * invT);
+    k_f = k_f_s[175];
     dlnkfdT = fwd_beta[175] * invT + activation_units[175] * fwd_Ea[175] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[13];
-    Kc = exp(-g_RT[6] + g_RT[7] + g_RT[12] - g_RT[13]);
+    Kc = Kc_s[175];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[7] + h_RT[12]) + (h_RT[6] + h_RT[13]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49032,12 +46749,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[12];
-    k_f = prefactor_units[176] * fwd_A[176]
-                * exp(fwd_beta[176] * tc[0] - activation_units[176] * fwd_Ea[176] * invT);
+    k_f = k_f_s[176];
     dlnkfdT = fwd_beta[176] * invT + activation_units[176] * fwd_Ea[176] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[25];
-    Kc = exp(-g_RT[1] + 2*g_RT[12] - g_RT[25]);
+    Kc = Kc_s[176];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[12]) + (h_RT[1] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49072,12 +46788,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[16];
-    k_f = prefactor_units[177] * fwd_A[177]
-                * exp(fwd_beta[177] * tc[0] - activation_units[177] * fwd_Ea[177] * invT);
+    k_f = k_f_s[177];
     dlnkfdT = fwd_beta[177] * invT + activation_units[177] * fwd_Ea[177] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[14];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[177];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[16]) + (h_RT[13] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49123,12 +46838,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[17];
-    k_f = prefactor_units[178] * fwd_A[178]
-                * exp(fwd_beta[178] * tc[0] - activation_units[178] * fwd_Ea[178] * invT);
+    k_f = k_f_s[178];
     dlnkfdT = fwd_beta[178] * invT + activation_units[178] * fwd_Ea[178] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[16];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[16] + g_RT[17]);
+    Kc = Kc_s[178];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[17]) + (h_RT[13] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49174,12 +46888,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[20];
-    k_f = prefactor_units[179] * fwd_A[179]
-                * exp(fwd_beta[179] * tc[0] - activation_units[179] * fwd_Ea[179] * invT);
+    k_f = k_f_s[179];
     dlnkfdT = fwd_beta[179] * invT + activation_units[179] * fwd_Ea[179] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[18];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[18] + g_RT[20]);
+    Kc = Kc_s[179];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[20]) + (h_RT[13] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49225,12 +46938,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[20];
-    k_f = prefactor_units[180] * fwd_A[180]
-                * exp(fwd_beta[180] * tc[0] - activation_units[180] * fwd_Ea[180] * invT);
+    k_f = k_f_s[180];
     dlnkfdT = fwd_beta[180] * invT + activation_units[180] * fwd_Ea[180] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[19];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[19] + g_RT[20]);
+    Kc = Kc_s[180];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[20]) + (h_RT[13] + h_RT[19]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49276,12 +46988,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[24];
-    k_f = prefactor_units[181] * fwd_A[181]
-                * exp(fwd_beta[181] * tc[0] - activation_units[181] * fwd_Ea[181] * invT);
+    k_f = k_f_s[181];
     dlnkfdT = fwd_beta[181] * invT + activation_units[181] * fwd_Ea[181] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[23];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[23] + g_RT[24]);
+    Kc = Kc_s[181];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[24]) + (h_RT[13] + h_RT[23]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49327,12 +47038,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[26];
-    k_f = prefactor_units[182] * fwd_A[182]
-                * exp(fwd_beta[182] * tc[0] - activation_units[182] * fwd_Ea[182] * invT);
+    k_f = k_f_s[182];
     dlnkfdT = fwd_beta[182] * invT + activation_units[182] * fwd_Ea[182] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[25];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[25] + g_RT[26]);
+    Kc = Kc_s[182];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[26]) + (h_RT[13] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49378,12 +47088,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[16];
-    k_f = prefactor_units[183] * fwd_A[183]
-                * exp(fwd_beta[183] * tc[0] - activation_units[183] * fwd_Ea[183] * invT);
+    k_f = k_f_s[183];
     dlnkfdT = fwd_beta[183] * invT + activation_units[183] * fwd_Ea[183] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[5]*sc[14];
-    Kc = refC * exp(-g_RT[1] + g_RT[5] - g_RT[5] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[183];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[5] + h_RT[16]) + (h_RT[1] + h_RT[5] + h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49423,12 +47132,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[16];
-    k_f = prefactor_units[184] * fwd_A[184]
-                * exp(fwd_beta[184] * tc[0] - activation_units[184] * fwd_Ea[184] * invT);
+    k_f = k_f_s[184];
     dlnkfdT = fwd_beta[184] * invT + activation_units[184] * fwd_Ea[184] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[14];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[14] + g_RT[16]);
+    Kc = Kc_s[184];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[16]) + (h_RT[6] + h_RT[14]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49474,12 +47182,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[18];
-    k_f = prefactor_units[185] * fwd_A[185]
-                * exp(fwd_beta[185] * tc[0] - activation_units[185] * fwd_Ea[185] * invT);
+    k_f = k_f_s[185];
     dlnkfdT = fwd_beta[185] * invT + activation_units[185] * fwd_Ea[185] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[17];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[17] + g_RT[18]);
+    Kc = Kc_s[185];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[18]) + (h_RT[6] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49525,12 +47232,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[19];
-    k_f = prefactor_units[186] * fwd_A[186]
-                * exp(fwd_beta[186] * tc[0] - activation_units[186] * fwd_Ea[186] * invT);
+    k_f = k_f_s[186];
     dlnkfdT = fwd_beta[186] * invT + activation_units[186] * fwd_Ea[186] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[17];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[17] + g_RT[19]);
+    Kc = Kc_s[186];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[19]) + (h_RT[6] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49576,12 +47282,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[21];
-    k_f = prefactor_units[187] * fwd_A[187]
-                * exp(fwd_beta[187] * tc[0] - activation_units[187] * fwd_Ea[187] * invT);
+    k_f = k_f_s[187];
     dlnkfdT = fwd_beta[187] * invT + activation_units[187] * fwd_Ea[187] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[16];
-    Kc = exp(g_RT[3] - g_RT[14] - g_RT[16] + g_RT[21]);
+    Kc = Kc_s[187];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[21]) + (h_RT[14] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49627,12 +47332,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[0]*sc[21];
-    k_f = prefactor_units[188] * fwd_A[188]
-                * exp(fwd_beta[188] * tc[0] - activation_units[188] * fwd_Ea[188] * invT);
+    k_f = k_f_s[188];
     dlnkfdT = fwd_beta[188] * invT + activation_units[188] * fwd_Ea[188] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[22];
-    Kc = exp(g_RT[0] - g_RT[1] + g_RT[21] - g_RT[22]);
+    Kc = Kc_s[188];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[0] + h_RT[21]) + (h_RT[1] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49678,12 +47382,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[23];
-    k_f = prefactor_units[189] * fwd_A[189]
-                * exp(fwd_beta[189] * tc[0] - activation_units[189] * fwd_Ea[189] * invT);
+    k_f = k_f_s[189];
     dlnkfdT = fwd_beta[189] * invT + activation_units[189] * fwd_Ea[189] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[17];
-    Kc = exp(g_RT[3] - g_RT[16] - g_RT[17] + g_RT[23]);
+    Kc = Kc_s[189];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[23]) + (h_RT[16] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49729,12 +47432,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[25];
-    k_f = prefactor_units[190] * fwd_A[190]
-                * exp(fwd_beta[190] * tc[0] - activation_units[190] * fwd_Ea[190] * invT);
+    k_f = k_f_s[190];
     dlnkfdT = fwd_beta[190] * invT + activation_units[190] * fwd_Ea[190] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[24];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[24] + g_RT[25]);
+    Kc = Kc_s[190];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[25]) + (h_RT[6] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49780,12 +47482,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[27];
-    k_f = prefactor_units[191] * fwd_A[191]
-                * exp(fwd_beta[191] * tc[0] - activation_units[191] * fwd_Ea[191] * invT);
+    k_f = k_f_s[191];
     dlnkfdT = fwd_beta[191] * invT + activation_units[191] * fwd_Ea[191] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[14]*sc[14];
-    Kc = refC * exp(g_RT[3] - g_RT[4] - 2*g_RT[14] + g_RT[27]);
+    Kc = Kc_s[191];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[27]) + (h_RT[4] + 2*h_RT[14]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49831,12 +47532,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[27]*sc[27];
-    k_f = prefactor_units[192] * fwd_A[192]
-                * exp(fwd_beta[192] * tc[0] - activation_units[192] * fwd_Ea[192] * invT);
+    k_f = k_f_s[192];
     dlnkfdT = fwd_beta[192] * invT + activation_units[192] * fwd_Ea[192] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[14]*sc[22];
-    Kc = refC * exp(-2*g_RT[14] - g_RT[22] + 2*g_RT[27]);
+    Kc = Kc_s[192];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[27]) + (2*h_RT[14] + h_RT[22]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49871,8 +47571,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[12];
-    k_f = prefactor_units[193] * fwd_A[193]
-                * exp(fwd_beta[193] * tc[0] - activation_units[193] * fwd_Ea[193] * invT);
+    k_f = k_f_s[193];
     dlnkfdT = fwd_beta[193] * invT + activation_units[193] * fwd_Ea[193] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -49908,12 +47607,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[24];
-    k_f = prefactor_units[194] * fwd_A[194]
-                * exp(fwd_beta[194] * tc[0] - activation_units[194] * fwd_Ea[194] * invT);
+    k_f = k_f_s[194];
     dlnkfdT = fwd_beta[194] * invT + activation_units[194] * fwd_Ea[194] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[32];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[24] - g_RT[32]);
+    Kc = Kc_s[194];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[24]) + (h_RT[1] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -49959,12 +47657,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[25];
-    k_f = prefactor_units[195] * fwd_A[195]
-                * exp(fwd_beta[195] * tc[0] - activation_units[195] * fwd_Ea[195] * invT);
+    k_f = k_f_s[195];
     dlnkfdT = fwd_beta[195] * invT + activation_units[195] * fwd_Ea[195] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[68];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[25] - g_RT[68]);
+    Kc = Kc_s[195];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[25]) + (h_RT[1] + h_RT[68]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50010,12 +47707,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[6];
-    k_f = prefactor_units[196] * fwd_A[196]
-                * exp(fwd_beta[196] * tc[0] - activation_units[196] * fwd_Ea[196] * invT);
+    k_f = k_f_s[196];
     dlnkfdT = fwd_beta[196] * invT + activation_units[196] * fwd_Ea[196] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[5];
-    Kc = exp(-g_RT[3] + g_RT[4] - g_RT[5] + g_RT[6]);
+    Kc = Kc_s[196];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[6]) + (h_RT[3] + h_RT[5]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50061,8 +47757,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[12];
-    k_f = prefactor_units[197] * fwd_A[197]
-                * exp(fwd_beta[197] * tc[0] - activation_units[197] * fwd_Ea[197] * invT);
+    k_f = k_f_s[197];
     dlnkfdT = fwd_beta[197] * invT + activation_units[197] * fwd_Ea[197] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -50094,8 +47789,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[10];
-    k_f = prefactor_units[198] * fwd_A[198]
-                * exp(fwd_beta[198] * tc[0] - activation_units[198] * fwd_Ea[198] * invT);
+    k_f = k_f_s[198];
     dlnkfdT = fwd_beta[198] * invT + activation_units[198] * fwd_Ea[198] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -50127,12 +47821,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[10];
-    k_f = prefactor_units[199] * fwd_A[199]
-                * exp(fwd_beta[199] * tc[0] - activation_units[199] * fwd_Ea[199] * invT);
+    k_f = k_f_s[199];
     dlnkfdT = fwd_beta[199] * invT + activation_units[199] * fwd_Ea[199] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[17];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[10] - g_RT[17]);
+    Kc = Kc_s[199];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[10]) + (h_RT[2] + h_RT[17]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50178,8 +47871,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[10];
-    k_f = prefactor_units[200] * fwd_A[200]
-                * exp(fwd_beta[200] * tc[0] - activation_units[200] * fwd_Ea[200] * invT);
+    k_f = k_f_s[200];
     dlnkfdT = fwd_beta[200] * invT + activation_units[200] * fwd_Ea[200] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -50202,8 +47894,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[5]*sc[11];
-    k_f = prefactor_units[201] * fwd_A[201]
-                * exp(fwd_beta[201] * tc[0] - activation_units[201] * fwd_Ea[201] * invT);
+    k_f = k_f_s[201];
     dlnkfdT = fwd_beta[201] * invT + activation_units[201] * fwd_Ea[201] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -50235,12 +47926,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[23];
-    k_f = prefactor_units[202] * fwd_A[202]
-                * exp(fwd_beta[202] * tc[0] - activation_units[202] * fwd_Ea[202] * invT);
+    k_f = k_f_s[202];
     dlnkfdT = fwd_beta[202] * invT + activation_units[202] * fwd_Ea[202] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[32];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[23] - g_RT[32]);
+    Kc = Kc_s[202];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[23]) + (h_RT[2] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50286,12 +47976,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[23];
-    k_f = prefactor_units[203] * fwd_A[203]
-                * exp(fwd_beta[203] * tc[0] - activation_units[203] * fwd_Ea[203] * invT);
+    k_f = k_f_s[203];
     dlnkfdT = fwd_beta[203] * invT + activation_units[203] * fwd_Ea[203] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[22];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[22] + g_RT[23]);
+    Kc = Kc_s[203];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[23]) + (h_RT[6] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50337,12 +48026,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[68];
-    k_f = prefactor_units[204] * fwd_A[204]
-                * exp(fwd_beta[204] * tc[0] - activation_units[204] * fwd_Ea[204] * invT);
+    k_f = k_f_s[204];
     dlnkfdT = fwd_beta[204] * invT + activation_units[204] * fwd_Ea[204] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[32];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[32] + g_RT[68]);
+    Kc = Kc_s[204];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[68]) + (h_RT[4] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50388,8 +48076,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[68];
-    k_f = prefactor_units[205] * fwd_A[205]
-                * exp(fwd_beta[205] * tc[0] - activation_units[205] * fwd_Ea[205] * invT);
+    k_f = k_f_s[205];
     dlnkfdT = fwd_beta[205] * invT + activation_units[205] * fwd_Ea[205] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -50425,8 +48112,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[68];
-    k_f = prefactor_units[206] * fwd_A[206]
-                * exp(fwd_beta[206] * tc[0] - activation_units[206] * fwd_Ea[206] * invT);
+    k_f = k_f_s[206];
     dlnkfdT = fwd_beta[206] * invT + activation_units[206] * fwd_Ea[206] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -50462,12 +48148,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[68];
-    k_f = prefactor_units[207] * fwd_A[207]
-                * exp(fwd_beta[207] * tc[0] - activation_units[207] * fwd_Ea[207] * invT);
+    k_f = k_f_s[207];
     dlnkfdT = fwd_beta[207] * invT + activation_units[207] * fwd_Ea[207] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[32];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[32] + g_RT[68]);
+    Kc = Kc_s[207];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[68]) + (h_RT[0] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50513,8 +48198,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[68];
-    k_f = prefactor_units[208] * fwd_A[208]
-                * exp(fwd_beta[208] * tc[0] - activation_units[208] * fwd_Ea[208] * invT);
+    k_f = k_f_s[208];
     dlnkfdT = fwd_beta[208] * invT + activation_units[208] * fwd_Ea[208] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -50550,8 +48234,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[68];
-    k_f = prefactor_units[209] * fwd_A[209]
-                * exp(fwd_beta[209] * tc[0] - activation_units[209] * fwd_Ea[209] * invT);
+    k_f = k_f_s[209];
     dlnkfdT = fwd_beta[209] * invT + activation_units[209] * fwd_Ea[209] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -50587,8 +48270,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[68];
-    k_f = prefactor_units[210] * fwd_A[210]
-                * exp(fwd_beta[210] * tc[0] - activation_units[210] * fwd_Ea[210] * invT);
+    k_f = k_f_s[210];
     dlnkfdT = fwd_beta[210] * invT + activation_units[210] * fwd_Ea[210] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -50624,8 +48306,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[68];
-    k_f = prefactor_units[211] * fwd_A[211]
-                * exp(fwd_beta[211] * tc[0] - activation_units[211] * fwd_Ea[211] * invT);
+    k_f = k_f_s[211];
     dlnkfdT = fwd_beta[211] * invT + activation_units[211] * fwd_Ea[211] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -50653,8 +48334,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[32];
-    k_f = prefactor_units[212] * fwd_A[212]
-                * exp(fwd_beta[212] * tc[0] - activation_units[212] * fwd_Ea[212] * invT);
+    k_f = k_f_s[212];
     dlnkfdT = fwd_beta[212] * invT + activation_units[212] * fwd_Ea[212] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -50690,8 +48370,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[32];
-    k_f = prefactor_units[213] * fwd_A[213]
-                * exp(fwd_beta[213] * tc[0] - activation_units[213] * fwd_Ea[213] * invT);
+    k_f = k_f_s[213];
     dlnkfdT = fwd_beta[213] * invT + activation_units[213] * fwd_Ea[213] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -50727,8 +48406,7 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[32];
-    k_f = prefactor_units[214] * fwd_A[214]
-                * exp(fwd_beta[214] * tc[0] - activation_units[214] * fwd_Ea[214] * invT);
+    k_f = k_f_s[214];
     dlnkfdT = fwd_beta[214] * invT + activation_units[214] * fwd_Ea[214] * invT2;
     /* rate of progress */
     q = k_f*phi_f;
@@ -50760,12 +48438,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[32];
-    k_f = prefactor_units[215] * fwd_A[215]
-                * exp(fwd_beta[215] * tc[0] - activation_units[215] * fwd_Ea[215] * invT);
+    k_f = k_f_s[215];
     dlnkfdT = fwd_beta[215] * invT + activation_units[215] * fwd_Ea[215] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[16];
-    Kc = exp(g_RT[1] - g_RT[12] - g_RT[16] + g_RT[32]);
+    Kc = Kc_s[215];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[32]) + (h_RT[12] + h_RT[16]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50811,12 +48488,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[32];
-    k_f = prefactor_units[216] * fwd_A[216]
-                * exp(fwd_beta[216] * tc[0] - activation_units[216] * fwd_Ea[216] * invT);
+    k_f = k_f_s[216];
     dlnkfdT = fwd_beta[216] * invT + activation_units[216] * fwd_Ea[216] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[28];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[28] + g_RT[32]);
+    Kc = Kc_s[216];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[32]) + (h_RT[0] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50862,12 +48538,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[32];
-    k_f = prefactor_units[217] * fwd_A[217]
-                * exp(fwd_beta[217] * tc[0] - activation_units[217] * fwd_Ea[217] * invT);
+    k_f = k_f_s[217];
     dlnkfdT = fwd_beta[217] * invT + activation_units[217] * fwd_Ea[217] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[28];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[28] + g_RT[32]);
+    Kc = Kc_s[217];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[32]) + (h_RT[5] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50913,12 +48588,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[32];
-    k_f = prefactor_units[218] * fwd_A[218]
-                * exp(fwd_beta[218] * tc[0] - activation_units[218] * fwd_Ea[218] * invT);
+    k_f = k_f_s[218];
     dlnkfdT = fwd_beta[218] * invT + activation_units[218] * fwd_Ea[218] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[18];
-    Kc = exp(g_RT[4] - g_RT[16] - g_RT[18] + g_RT[32]);
+    Kc = Kc_s[218];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[32]) + (h_RT[16] + h_RT[18]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -50964,12 +48638,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[21];
-    k_f = prefactor_units[219] * fwd_A[219]
-                * exp(fwd_beta[219] * tc[0] - activation_units[219] * fwd_Ea[219] * invT);
+    k_f = k_f_s[219];
     dlnkfdT = fwd_beta[219] * invT + activation_units[219] * fwd_Ea[219] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[34];
-    Kc = exp(-g_RT[1] + g_RT[12] + g_RT[21] - g_RT[34]);
+    Kc = Kc_s[219];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[21]) + (h_RT[1] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51015,12 +48688,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[22];
-    k_f = prefactor_units[220] * fwd_A[220]
-                * exp(fwd_beta[220] * tc[0] - activation_units[220] * fwd_Ea[220] * invT);
+    k_f = k_f_s[220];
     dlnkfdT = fwd_beta[220] * invT + activation_units[220] * fwd_Ea[220] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[33];
-    Kc = exp(-g_RT[1] + g_RT[9] + g_RT[22] - g_RT[33]);
+    Kc = Kc_s[220];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[22]) + (h_RT[1] + h_RT[33]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51066,12 +48738,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[22];
-    k_f = prefactor_units[221] * fwd_A[221]
-                * exp(fwd_beta[221] * tc[0] - activation_units[221] * fwd_Ea[221] * invT);
+    k_f = k_f_s[221];
     dlnkfdT = fwd_beta[221] * invT + activation_units[221] * fwd_Ea[221] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[34];
-    Kc = exp(-g_RT[1] + g_RT[10] + g_RT[22] - g_RT[34]);
+    Kc = Kc_s[221];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[22]) + (h_RT[1] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51117,12 +48788,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[11]*sc[22];
-    k_f = prefactor_units[222] * fwd_A[222]
-                * exp(fwd_beta[222] * tc[0] - activation_units[222] * fwd_Ea[222] * invT);
+    k_f = k_f_s[222];
     dlnkfdT = fwd_beta[222] * invT + activation_units[222] * fwd_Ea[222] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[34];
-    Kc = exp(-g_RT[1] + g_RT[11] + g_RT[22] - g_RT[34]);
+    Kc = Kc_s[222];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[11] + h_RT[22]) + (h_RT[1] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51168,12 +48838,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[22]*sc[27];
-    k_f = prefactor_units[223] * fwd_A[223]
-                * exp(fwd_beta[223] * tc[0] - activation_units[223] * fwd_Ea[223] * invT);
+    k_f = k_f_s[223];
     dlnkfdT = fwd_beta[223] * invT + activation_units[223] * fwd_Ea[223] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[34];
-    Kc = exp(-g_RT[14] + g_RT[22] + g_RT[27] - g_RT[34]);
+    Kc = Kc_s[223];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[22] + h_RT[27]) + (h_RT[14] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51219,12 +48888,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[33];
-    k_f = prefactor_units[224] * fwd_A[224]
-                * exp(fwd_beta[224] * tc[0] - activation_units[224] * fwd_Ea[224] * invT);
+    k_f = k_f_s[224];
     dlnkfdT = fwd_beta[224] * invT + activation_units[224] * fwd_Ea[224] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[22];
-    Kc = exp(g_RT[2] - g_RT[14] - g_RT[22] + g_RT[33]);
+    Kc = Kc_s[224];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[33]) + (h_RT[14] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51270,12 +48938,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[33];
-    k_f = prefactor_units[225] * fwd_A[225]
-                * exp(fwd_beta[225] * tc[0] - activation_units[225] * fwd_Ea[225] * invT);
+    k_f = k_f_s[225];
     dlnkfdT = fwd_beta[225] * invT + activation_units[225] * fwd_Ea[225] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[22];
-    Kc = exp(g_RT[4] - g_RT[16] - g_RT[22] + g_RT[33]);
+    Kc = Kc_s[225];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[33]) + (h_RT[16] + h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51321,12 +48988,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[33];
-    k_f = prefactor_units[226] * fwd_A[226]
-                * exp(fwd_beta[226] * tc[0] - activation_units[226] * fwd_Ea[226] * invT);
+    k_f = k_f_s[226];
     dlnkfdT = fwd_beta[226] * invT + activation_units[226] * fwd_Ea[226] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[14]*sc[27];
-    Kc = refC * exp(-g_RT[1] + g_RT[3] - g_RT[14] - g_RT[27] + g_RT[33]);
+    Kc = Kc_s[226];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[33]) + (h_RT[1] + h_RT[14] + h_RT[27]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51385,12 +49051,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[33];
-    k_f = prefactor_units[227] * fwd_A[227]
-                * exp(fwd_beta[227] * tc[0] - activation_units[227] * fwd_Ea[227] * invT);
+    k_f = k_f_s[227];
     dlnkfdT = fwd_beta[227] * invT + activation_units[227] * fwd_Ea[227] * invT2;
     /* reverse */
     phi_r = sc[34];
-    Kc = refCinv * exp(g_RT[1] + g_RT[33] - g_RT[34]);
+    Kc = Kc_s[227];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[33]) + (h_RT[34]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51425,12 +49090,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[34];
-    k_f = prefactor_units[228] * fwd_A[228]
-                * exp(fwd_beta[228] * tc[0] - activation_units[228] * fwd_Ea[228] * invT);
+    k_f = k_f_s[228];
     dlnkfdT = fwd_beta[228] * invT + activation_units[228] * fwd_Ea[228] * invT2;
     /* reverse */
     phi_r = sc[35];
-    Kc = refCinv * exp(g_RT[1] + g_RT[34] - g_RT[35]);
+    Kc = Kc_s[228];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[34]) + (h_RT[35]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51465,12 +49129,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[34];
-    k_f = prefactor_units[229] * fwd_A[229]
-                * exp(fwd_beta[229] * tc[0] - activation_units[229] * fwd_Ea[229] * invT);
+    k_f = k_f_s[229];
     dlnkfdT = fwd_beta[229] * invT + activation_units[229] * fwd_Ea[229] * invT2;
     /* reverse */
     phi_r = sc[36];
-    Kc = refCinv * exp(g_RT[1] + g_RT[34] - g_RT[36]);
+    Kc = Kc_s[229];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[34]) + (h_RT[36]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51505,12 +49168,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[34];
-    k_f = prefactor_units[230] * fwd_A[230]
-                * exp(fwd_beta[230] * tc[0] - activation_units[230] * fwd_Ea[230] * invT);
+    k_f = k_f_s[230];
     dlnkfdT = fwd_beta[230] * invT + activation_units[230] * fwd_Ea[230] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[33];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[33] + g_RT[34]);
+    Kc = Kc_s[230];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[34]) + (h_RT[0] + h_RT[33]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51556,12 +49218,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[34];
-    k_f = prefactor_units[231] * fwd_A[231]
-                * exp(fwd_beta[231] * tc[0] - activation_units[231] * fwd_Ea[231] * invT);
+    k_f = k_f_s[231];
     dlnkfdT = fwd_beta[231] * invT + activation_units[231] * fwd_Ea[231] * invT2;
     /* reverse */
     phi_r = sc[17]*sc[21];
-    Kc = exp(g_RT[2] - g_RT[17] - g_RT[21] + g_RT[34]);
+    Kc = Kc_s[231];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[34]) + (h_RT[17] + h_RT[21]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51607,12 +49268,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[34];
-    k_f = prefactor_units[232] * fwd_A[232]
-                * exp(fwd_beta[232] * tc[0] - activation_units[232] * fwd_Ea[232] * invT);
+    k_f = k_f_s[232];
     dlnkfdT = fwd_beta[232] * invT + activation_units[232] * fwd_Ea[232] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[33];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[33] + g_RT[34]);
+    Kc = Kc_s[232];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[34]) + (h_RT[5] + h_RT[33]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51658,12 +49318,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[34];
-    k_f = prefactor_units[233] * fwd_A[233]
-                * exp(fwd_beta[233] * tc[0] - activation_units[233] * fwd_Ea[233] * invT);
+    k_f = k_f_s[233];
     dlnkfdT = fwd_beta[233] * invT + activation_units[233] * fwd_Ea[233] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[28];
-    Kc = exp(g_RT[3] - g_RT[16] - g_RT[28] + g_RT[34]);
+    Kc = Kc_s[233];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[34]) + (h_RT[16] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51709,12 +49368,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[34];
-    k_f = prefactor_units[234] * fwd_A[234]
-                * exp(fwd_beta[234] * tc[0] - activation_units[234] * fwd_Ea[234] * invT);
+    k_f = k_f_s[234];
     dlnkfdT = fwd_beta[234] * invT + activation_units[234] * fwd_Ea[234] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[14]*sc[23];
-    Kc = refC * exp(-g_RT[4] + g_RT[6] - g_RT[14] - g_RT[23] + g_RT[34]);
+    Kc = Kc_s[234];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[34]) + (h_RT[4] + h_RT[14] + h_RT[23]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51773,12 +49431,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[34];
-    k_f = prefactor_units[235] * fwd_A[235]
-                * exp(fwd_beta[235] * tc[0] - activation_units[235] * fwd_Ea[235] * invT);
+    k_f = k_f_s[235];
     dlnkfdT = fwd_beta[235] * invT + activation_units[235] * fwd_Ea[235] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[36];
-    Kc = exp(-g_RT[3] + g_RT[6] + g_RT[34] - g_RT[36]);
+    Kc = Kc_s[235];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[34]) + (h_RT[3] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51824,12 +49481,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[34];
-    k_f = prefactor_units[236] * fwd_A[236]
-                * exp(fwd_beta[236] * tc[0] - activation_units[236] * fwd_Ea[236] * invT);
+    k_f = k_f_s[236];
     dlnkfdT = fwd_beta[236] * invT + activation_units[236] * fwd_Ea[236] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[35];
-    Kc = exp(-g_RT[3] + g_RT[6] + g_RT[34] - g_RT[35]);
+    Kc = Kc_s[236];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[34]) + (h_RT[3] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51875,12 +49531,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[34];
-    k_f = prefactor_units[237] * fwd_A[237]
-                * exp(fwd_beta[237] * tc[0] - activation_units[237] * fwd_Ea[237] * invT);
+    k_f = k_f_s[237];
     dlnkfdT = fwd_beta[237] * invT + activation_units[237] * fwd_Ea[237] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[36];
-    Kc = exp(-g_RT[14] + g_RT[16] + g_RT[34] - g_RT[36]);
+    Kc = Kc_s[237];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[34]) + (h_RT[14] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51926,12 +49581,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[34];
-    k_f = prefactor_units[238] * fwd_A[238]
-                * exp(fwd_beta[238] * tc[0] - activation_units[238] * fwd_Ea[238] * invT);
+    k_f = k_f_s[238];
     dlnkfdT = fwd_beta[238] * invT + activation_units[238] * fwd_Ea[238] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[35];
-    Kc = exp(-g_RT[14] + g_RT[16] + g_RT[34] - g_RT[35]);
+    Kc = Kc_s[238];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[34]) + (h_RT[14] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -51977,12 +49631,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[36];
-    k_f = prefactor_units[239] * fwd_A[239]
-                * exp(fwd_beta[239] * tc[0] - activation_units[239] * fwd_Ea[239] * invT);
+    k_f = k_f_s[239];
     dlnkfdT = fwd_beta[239] * invT + activation_units[239] * fwd_Ea[239] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[34];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[34] + g_RT[36]);
+    Kc = Kc_s[239];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[36]) + (h_RT[0] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52028,12 +49681,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[36];
-    k_f = prefactor_units[240] * fwd_A[240]
-                * exp(fwd_beta[240] * tc[0] - activation_units[240] * fwd_Ea[240] * invT);
+    k_f = k_f_s[240];
     dlnkfdT = fwd_beta[240] * invT + activation_units[240] * fwd_Ea[240] * invT2;
     /* reverse */
     phi_r = sc[67];
-    Kc = refCinv * exp(g_RT[1] + g_RT[36] - g_RT[67]);
+    Kc = Kc_s[240];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[36]) + (h_RT[67]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52068,12 +49720,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[36];
-    k_f = prefactor_units[241] * fwd_A[241]
-                * exp(fwd_beta[241] * tc[0] - activation_units[241] * fwd_Ea[241] * invT);
+    k_f = k_f_s[241];
     dlnkfdT = fwd_beta[241] * invT + activation_units[241] * fwd_Ea[241] * invT2;
     /* reverse */
     phi_r = sc[66];
-    Kc = refCinv * exp(g_RT[1] + g_RT[36] - g_RT[66]);
+    Kc = Kc_s[241];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[36]) + (h_RT[66]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52108,12 +49759,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[36];
-    k_f = prefactor_units[242] * fwd_A[242]
-                * exp(fwd_beta[242] * tc[0] - activation_units[242] * fwd_Ea[242] * invT);
+    k_f = k_f_s[242];
     dlnkfdT = fwd_beta[242] * invT + activation_units[242] * fwd_Ea[242] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[24];
-    Kc = exp(g_RT[2] - g_RT[14] - g_RT[24] + g_RT[36]);
+    Kc = Kc_s[242];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[36]) + (h_RT[14] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52159,12 +49809,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[36];
-    k_f = prefactor_units[243] * fwd_A[243]
-                * exp(fwd_beta[243] * tc[0] - activation_units[243] * fwd_Ea[243] * invT);
+    k_f = k_f_s[243];
     dlnkfdT = fwd_beta[243] * invT + activation_units[243] * fwd_Ea[243] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[34];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[34] + g_RT[36]);
+    Kc = Kc_s[243];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[36]) + (h_RT[5] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52210,12 +49859,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[36];
-    k_f = prefactor_units[244] * fwd_A[244]
-                * exp(fwd_beta[244] * tc[0] - activation_units[244] * fwd_Ea[244] * invT);
+    k_f = k_f_s[244];
     dlnkfdT = fwd_beta[244] * invT + activation_units[244] * fwd_Ea[244] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[34];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[34] + g_RT[36]);
+    Kc = Kc_s[244];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[36]) + (h_RT[13] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52261,12 +49909,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[21]*sc[36];
-    k_f = prefactor_units[245] * fwd_A[245]
-                * exp(fwd_beta[245] * tc[0] - activation_units[245] * fwd_Ea[245] * invT);
+    k_f = k_f_s[245];
     dlnkfdT = fwd_beta[245] * invT + activation_units[245] * fwd_Ea[245] * invT2;
     /* reverse */
     phi_r = sc[22]*sc[34];
-    Kc = exp(g_RT[21] - g_RT[22] - g_RT[34] + g_RT[36]);
+    Kc = Kc_s[245];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[21] + h_RT[36]) + (h_RT[22] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52312,12 +49959,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[35];
-    k_f = prefactor_units[246] * fwd_A[246]
-                * exp(fwd_beta[246] * tc[0] - activation_units[246] * fwd_Ea[246] * invT);
+    k_f = k_f_s[246];
     dlnkfdT = fwd_beta[246] * invT + activation_units[246] * fwd_Ea[246] * invT2;
     /* reverse */
     phi_r = sc[37];
-    Kc = exp(g_RT[35] - g_RT[37]);
+    Kc = Kc_s[246];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[35]) + (h_RT[37]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52343,12 +49989,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[35];
-    k_f = prefactor_units[247] * fwd_A[247]
-                * exp(fwd_beta[247] * tc[0] - activation_units[247] * fwd_Ea[247] * invT);
+    k_f = k_f_s[247];
     dlnkfdT = fwd_beta[247] * invT + activation_units[247] * fwd_Ea[247] * invT2;
     /* reverse */
     phi_r = sc[36];
-    Kc = exp(g_RT[35] - g_RT[36]);
+    Kc = Kc_s[247];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[35]) + (h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52374,12 +50019,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[37];
-    k_f = prefactor_units[248] * fwd_A[248]
-                * exp(fwd_beta[248] * tc[0] - activation_units[248] * fwd_Ea[248] * invT);
+    k_f = k_f_s[248];
     dlnkfdT = fwd_beta[248] * invT + activation_units[248] * fwd_Ea[248] * invT2;
     /* reverse */
     phi_r = sc[36];
-    Kc = exp(-g_RT[36] + g_RT[37]);
+    Kc = Kc_s[248];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[37]) + (h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52405,12 +50049,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[35];
-    k_f = prefactor_units[249] * fwd_A[249]
-                * exp(fwd_beta[249] * tc[0] - activation_units[249] * fwd_Ea[249] * invT);
+    k_f = k_f_s[249];
     dlnkfdT = fwd_beta[249] * invT + activation_units[249] * fwd_Ea[249] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[36];
-    Kc = exp(g_RT[1] - g_RT[1] + g_RT[35] - g_RT[36]);
+    Kc = Kc_s[249];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[35]) + (h_RT[1] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52440,12 +50083,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[35];
-    k_f = prefactor_units[250] * fwd_A[250]
-                * exp(fwd_beta[250] * tc[0] - activation_units[250] * fwd_Ea[250] * invT);
+    k_f = k_f_s[250];
     dlnkfdT = fwd_beta[250] * invT + activation_units[250] * fwd_Ea[250] * invT2;
     /* reverse */
     phi_r = sc[67];
-    Kc = refCinv * exp(g_RT[1] + g_RT[35] - g_RT[67]);
+    Kc = Kc_s[250];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[35]) + (h_RT[67]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52480,12 +50122,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[35];
-    k_f = prefactor_units[251] * fwd_A[251]
-                * exp(fwd_beta[251] * tc[0] - activation_units[251] * fwd_Ea[251] * invT);
+    k_f = k_f_s[251];
     dlnkfdT = fwd_beta[251] * invT + activation_units[251] * fwd_Ea[251] * invT2;
     /* reverse */
     phi_r = sc[66];
-    Kc = refCinv * exp(g_RT[1] + g_RT[35] - g_RT[66]);
+    Kc = Kc_s[251];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[35]) + (h_RT[66]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52520,12 +50161,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[35];
-    k_f = prefactor_units[252] * fwd_A[252]
-                * exp(fwd_beta[252] * tc[0] - activation_units[252] * fwd_Ea[252] * invT);
+    k_f = k_f_s[252];
     dlnkfdT = fwd_beta[252] * invT + activation_units[252] * fwd_Ea[252] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[34];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[34] + g_RT[35]);
+    Kc = Kc_s[252];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[35]) + (h_RT[0] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52571,12 +50211,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[35];
-    k_f = prefactor_units[253] * fwd_A[253]
-                * exp(fwd_beta[253] * tc[0] - activation_units[253] * fwd_Ea[253] * invT);
+    k_f = k_f_s[253];
     dlnkfdT = fwd_beta[253] * invT + activation_units[253] * fwd_Ea[253] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[27];
-    Kc = exp(g_RT[2] - g_RT[12] - g_RT[27] + g_RT[35]);
+    Kc = Kc_s[253];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[35]) + (h_RT[12] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52622,12 +50261,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[35];
-    k_f = prefactor_units[254] * fwd_A[254]
-                * exp(fwd_beta[254] * tc[0] - activation_units[254] * fwd_Ea[254] * invT);
+    k_f = k_f_s[254];
     dlnkfdT = fwd_beta[254] * invT + activation_units[254] * fwd_Ea[254] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[24];
-    Kc = exp(g_RT[2] - g_RT[14] - g_RT[24] + g_RT[35]);
+    Kc = Kc_s[254];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[35]) + (h_RT[14] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52673,12 +50311,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[35];
-    k_f = prefactor_units[255] * fwd_A[255]
-                * exp(fwd_beta[255] * tc[0] - activation_units[255] * fwd_Ea[255] * invT);
+    k_f = k_f_s[255];
     dlnkfdT = fwd_beta[255] * invT + activation_units[255] * fwd_Ea[255] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[34];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[34] + g_RT[35]);
+    Kc = Kc_s[255];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[35]) + (h_RT[5] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52724,12 +50361,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[21]*sc[35];
-    k_f = prefactor_units[256] * fwd_A[256]
-                * exp(fwd_beta[256] * tc[0] - activation_units[256] * fwd_Ea[256] * invT);
+    k_f = k_f_s[256];
     dlnkfdT = fwd_beta[256] * invT + activation_units[256] * fwd_Ea[256] * invT2;
     /* reverse */
     phi_r = sc[22]*sc[34];
-    Kc = exp(g_RT[21] - g_RT[22] - g_RT[34] + g_RT[35]);
+    Kc = Kc_s[256];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[21] + h_RT[35]) + (h_RT[22] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52775,12 +50411,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[35];
-    k_f = prefactor_units[257] * fwd_A[257]
-                * exp(fwd_beta[257] * tc[0] - activation_units[257] * fwd_Ea[257] * invT);
+    k_f = k_f_s[257];
     dlnkfdT = fwd_beta[257] * invT + activation_units[257] * fwd_Ea[257] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[34];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[34] + g_RT[35]);
+    Kc = Kc_s[257];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[35]) + (h_RT[13] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52826,12 +50461,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[62];
-    k_f = prefactor_units[258] * fwd_A[258]
-                * exp(fwd_beta[258] * tc[0] - activation_units[258] * fwd_Ea[258] * invT);
+    k_f = k_f_s[258];
     dlnkfdT = fwd_beta[258] * invT + activation_units[258] * fwd_Ea[258] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[63];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[62] - g_RT[63]);
+    Kc = Kc_s[258];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[62]) + (h_RT[0] + h_RT[63]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52877,12 +50511,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[62];
-    k_f = prefactor_units[259] * fwd_A[259]
-                * exp(fwd_beta[259] * tc[0] - activation_units[259] * fwd_Ea[259] * invT);
+    k_f = k_f_s[259];
     dlnkfdT = fwd_beta[259] * invT + activation_units[259] * fwd_Ea[259] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[64];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[62] - g_RT[64]);
+    Kc = Kc_s[259];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[62]) + (h_RT[0] + h_RT[64]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52928,12 +50561,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[62];
-    k_f = prefactor_units[260] * fwd_A[260]
-                * exp(fwd_beta[260] * tc[0] - activation_units[260] * fwd_Ea[260] * invT);
+    k_f = k_f_s[260];
     dlnkfdT = fwd_beta[260] * invT + activation_units[260] * fwd_Ea[260] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[63];
-    Kc = exp(g_RT[2] - g_RT[4] + g_RT[62] - g_RT[63]);
+    Kc = Kc_s[260];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[62]) + (h_RT[4] + h_RT[63]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -52979,12 +50611,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[62];
-    k_f = prefactor_units[261] * fwd_A[261]
-                * exp(fwd_beta[261] * tc[0] - activation_units[261] * fwd_Ea[261] * invT);
+    k_f = k_f_s[261];
     dlnkfdT = fwd_beta[261] * invT + activation_units[261] * fwd_Ea[261] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[64];
-    Kc = exp(g_RT[2] - g_RT[4] + g_RT[62] - g_RT[64]);
+    Kc = Kc_s[261];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[62]) + (h_RT[4] + h_RT[64]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53030,12 +50661,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[62];
-    k_f = prefactor_units[262] * fwd_A[262]
-                * exp(fwd_beta[262] * tc[0] - activation_units[262] * fwd_Ea[262] * invT);
+    k_f = k_f_s[262];
     dlnkfdT = fwd_beta[262] * invT + activation_units[262] * fwd_Ea[262] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[63];
-    Kc = exp(g_RT[4] - g_RT[5] + g_RT[62] - g_RT[63]);
+    Kc = Kc_s[262];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[62]) + (h_RT[5] + h_RT[63]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53081,12 +50711,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[62];
-    k_f = prefactor_units[263] * fwd_A[263]
-                * exp(fwd_beta[263] * tc[0] - activation_units[263] * fwd_Ea[263] * invT);
+    k_f = k_f_s[263];
     dlnkfdT = fwd_beta[263] * invT + activation_units[263] * fwd_Ea[263] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[64];
-    Kc = exp(g_RT[4] - g_RT[5] + g_RT[62] - g_RT[64]);
+    Kc = Kc_s[263];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[62]) + (h_RT[5] + h_RT[64]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53132,12 +50761,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[62];
-    k_f = prefactor_units[264] * fwd_A[264]
-                * exp(fwd_beta[264] * tc[0] - activation_units[264] * fwd_Ea[264] * invT);
+    k_f = k_f_s[264];
     dlnkfdT = fwd_beta[264] * invT + activation_units[264] * fwd_Ea[264] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[63];
-    Kc = exp(g_RT[3] - g_RT[6] + g_RT[62] - g_RT[63]);
+    Kc = Kc_s[264];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[62]) + (h_RT[6] + h_RT[63]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53183,12 +50811,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[62];
-    k_f = prefactor_units[265] * fwd_A[265]
-                * exp(fwd_beta[265] * tc[0] - activation_units[265] * fwd_Ea[265] * invT);
+    k_f = k_f_s[265];
     dlnkfdT = fwd_beta[265] * invT + activation_units[265] * fwd_Ea[265] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[64];
-    Kc = exp(g_RT[3] - g_RT[6] + g_RT[62] - g_RT[64]);
+    Kc = Kc_s[265];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[62]) + (h_RT[6] + h_RT[64]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53234,12 +50861,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[62];
-    k_f = prefactor_units[266] * fwd_A[266]
-                * exp(fwd_beta[266] * tc[0] - activation_units[266] * fwd_Ea[266] * invT);
+    k_f = k_f_s[266];
     dlnkfdT = fwd_beta[266] * invT + activation_units[266] * fwd_Ea[266] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[63];
-    Kc = exp(g_RT[6] - g_RT[7] + g_RT[62] - g_RT[63]);
+    Kc = Kc_s[266];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[62]) + (h_RT[7] + h_RT[63]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53285,12 +50911,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[62];
-    k_f = prefactor_units[267] * fwd_A[267]
-                * exp(fwd_beta[267] * tc[0] - activation_units[267] * fwd_Ea[267] * invT);
+    k_f = k_f_s[267];
     dlnkfdT = fwd_beta[267] * invT + activation_units[267] * fwd_Ea[267] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[64];
-    Kc = exp(g_RT[6] - g_RT[7] + g_RT[62] - g_RT[64]);
+    Kc = Kc_s[267];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[62]) + (h_RT[7] + h_RT[64]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53336,12 +50961,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[62];
-    k_f = prefactor_units[268] * fwd_A[268]
-                * exp(fwd_beta[268] * tc[0] - activation_units[268] * fwd_Ea[268] * invT);
+    k_f = k_f_s[268];
     dlnkfdT = fwd_beta[268] * invT + activation_units[268] * fwd_Ea[268] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[63];
-    Kc = exp(g_RT[12] - g_RT[13] + g_RT[62] - g_RT[63]);
+    Kc = Kc_s[268];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[62]) + (h_RT[13] + h_RT[63]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53387,12 +51011,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[62];
-    k_f = prefactor_units[269] * fwd_A[269]
-                * exp(fwd_beta[269] * tc[0] - activation_units[269] * fwd_Ea[269] * invT);
+    k_f = k_f_s[269];
     dlnkfdT = fwd_beta[269] * invT + activation_units[269] * fwd_Ea[269] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[64];
-    Kc = exp(g_RT[12] - g_RT[13] + g_RT[62] - g_RT[64]);
+    Kc = Kc_s[269];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[62]) + (h_RT[13] + h_RT[64]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53438,12 +51061,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[63];
-    k_f = prefactor_units[270] * fwd_A[270]
-                * exp(fwd_beta[270] * tc[0] - activation_units[270] * fwd_Ea[270] * invT);
+    k_f = k_f_s[270];
     dlnkfdT = fwd_beta[270] * invT + activation_units[270] * fwd_Ea[270] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[25];
-    Kc = exp(g_RT[1] - g_RT[12] - g_RT[25] + g_RT[63]);
+    Kc = Kc_s[270];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[63]) + (h_RT[12] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53489,12 +51111,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[63];
-    k_f = prefactor_units[271] * fwd_A[271]
-                * exp(fwd_beta[271] * tc[0] - activation_units[271] * fwd_Ea[271] * invT);
+    k_f = k_f_s[271];
     dlnkfdT = fwd_beta[271] * invT + activation_units[271] * fwd_Ea[271] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[65];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[63] - g_RT[65]);
+    Kc = Kc_s[271];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[63]) + (h_RT[0] + h_RT[65]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53540,12 +51161,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[63];
-    k_f = prefactor_units[272] * fwd_A[272]
-                * exp(fwd_beta[272] * tc[0] - activation_units[272] * fwd_Ea[272] * invT);
+    k_f = k_f_s[272];
     dlnkfdT = fwd_beta[272] * invT + activation_units[272] * fwd_Ea[272] * invT2;
     /* reverse */
     phi_r = sc[17]*sc[25];
-    Kc = exp(g_RT[2] - g_RT[17] - g_RT[25] + g_RT[63]);
+    Kc = Kc_s[272];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[63]) + (h_RT[17] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53591,12 +51211,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[63];
-    k_f = prefactor_units[273] * fwd_A[273]
-                * exp(fwd_beta[273] * tc[0] - activation_units[273] * fwd_Ea[273] * invT);
+    k_f = k_f_s[273];
     dlnkfdT = fwd_beta[273] * invT + activation_units[273] * fwd_Ea[273] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[65];
-    Kc = exp(g_RT[4] - g_RT[5] + g_RT[63] - g_RT[65]);
+    Kc = Kc_s[273];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[63]) + (h_RT[5] + h_RT[65]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53642,12 +51261,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[63];
-    k_f = prefactor_units[274] * fwd_A[274]
-                * exp(fwd_beta[274] * tc[0] - activation_units[274] * fwd_Ea[274] * invT);
+    k_f = k_f_s[274];
     dlnkfdT = fwd_beta[274] * invT + activation_units[274] * fwd_Ea[274] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[65];
-    Kc = exp(g_RT[3] - g_RT[6] + g_RT[63] - g_RT[65]);
+    Kc = Kc_s[274];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[63]) + (h_RT[6] + h_RT[65]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53693,12 +51311,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[63];
-    k_f = prefactor_units[275] * fwd_A[275]
-                * exp(fwd_beta[275] * tc[0] - activation_units[275] * fwd_Ea[275] * invT);
+    k_f = k_f_s[275];
     dlnkfdT = fwd_beta[275] * invT + activation_units[275] * fwd_Ea[275] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[17]*sc[25];
-    Kc = refC * exp(-g_RT[4] + g_RT[6] - g_RT[17] - g_RT[25] + g_RT[63]);
+    Kc = Kc_s[275];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[63]) + (h_RT[4] + h_RT[17] + h_RT[25]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53757,12 +51374,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[63];
-    k_f = prefactor_units[276] * fwd_A[276]
-                * exp(fwd_beta[276] * tc[0] - activation_units[276] * fwd_Ea[276] * invT);
+    k_f = k_f_s[276];
     dlnkfdT = fwd_beta[276] * invT + activation_units[276] * fwd_Ea[276] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[62];
-    Kc = exp(-g_RT[14] + g_RT[16] - g_RT[62] + g_RT[63]);
+    Kc = Kc_s[276];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[63]) + (h_RT[14] + h_RT[62]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53808,12 +51424,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[63];
-    k_f = prefactor_units[277] * fwd_A[277]
-                * exp(fwd_beta[277] * tc[0] - activation_units[277] * fwd_Ea[277] * invT);
+    k_f = k_f_s[277];
     dlnkfdT = fwd_beta[277] * invT + activation_units[277] * fwd_Ea[277] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[65];
-    Kc = exp(g_RT[12] - g_RT[13] + g_RT[63] - g_RT[65]);
+    Kc = Kc_s[277];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[63]) + (h_RT[13] + h_RT[65]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53859,12 +51474,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[64];
-    k_f = prefactor_units[278] * fwd_A[278]
-                * exp(fwd_beta[278] * tc[0] - activation_units[278] * fwd_Ea[278] * invT);
+    k_f = k_f_s[278];
     dlnkfdT = fwd_beta[278] * invT + activation_units[278] * fwd_Ea[278] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[25];
-    Kc = exp(g_RT[1] - g_RT[12] - g_RT[25] + g_RT[64]);
+    Kc = Kc_s[278];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[64]) + (h_RT[12] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53910,12 +51524,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[64];
-    k_f = prefactor_units[279] * fwd_A[279]
-                * exp(fwd_beta[279] * tc[0] - activation_units[279] * fwd_Ea[279] * invT);
+    k_f = k_f_s[279];
     dlnkfdT = fwd_beta[279] * invT + activation_units[279] * fwd_Ea[279] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[65];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[64] - g_RT[65]);
+    Kc = Kc_s[279];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[64]) + (h_RT[0] + h_RT[65]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -53961,12 +51574,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[64];
-    k_f = prefactor_units[280] * fwd_A[280]
-                * exp(fwd_beta[280] * tc[0] - activation_units[280] * fwd_Ea[280] * invT);
+    k_f = k_f_s[280];
     dlnkfdT = fwd_beta[280] * invT + activation_units[280] * fwd_Ea[280] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[68];
-    Kc = exp(g_RT[2] - g_RT[12] + g_RT[64] - g_RT[68]);
+    Kc = Kc_s[280];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[64]) + (h_RT[12] + h_RT[68]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54012,12 +51624,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[64];
-    k_f = prefactor_units[281] * fwd_A[281]
-                * exp(fwd_beta[281] * tc[0] - activation_units[281] * fwd_Ea[281] * invT);
+    k_f = k_f_s[281];
     dlnkfdT = fwd_beta[281] * invT + activation_units[281] * fwd_Ea[281] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[65];
-    Kc = exp(g_RT[4] - g_RT[5] + g_RT[64] - g_RT[65]);
+    Kc = Kc_s[281];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[64]) + (h_RT[5] + h_RT[65]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54063,12 +51674,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[64];
-    k_f = prefactor_units[282] * fwd_A[282]
-                * exp(fwd_beta[282] * tc[0] - activation_units[282] * fwd_Ea[282] * invT);
+    k_f = k_f_s[282];
     dlnkfdT = fwd_beta[282] * invT + activation_units[282] * fwd_Ea[282] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[65];
-    Kc = exp(g_RT[3] - g_RT[6] + g_RT[64] - g_RT[65]);
+    Kc = Kc_s[282];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[64]) + (h_RT[6] + h_RT[65]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54114,12 +51724,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[64];
-    k_f = prefactor_units[283] * fwd_A[283]
-                * exp(fwd_beta[283] * tc[0] - activation_units[283] * fwd_Ea[283] * invT);
+    k_f = k_f_s[283];
     dlnkfdT = fwd_beta[283] * invT + activation_units[283] * fwd_Ea[283] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[12]*sc[68];
-    Kc = refC * exp(-g_RT[4] + g_RT[6] - g_RT[12] + g_RT[64] - g_RT[68]);
+    Kc = Kc_s[283];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[64]) + (h_RT[4] + h_RT[12] + h_RT[68]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54178,12 +51787,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[64];
-    k_f = prefactor_units[284] * fwd_A[284]
-                * exp(fwd_beta[284] * tc[0] - activation_units[284] * fwd_Ea[284] * invT);
+    k_f = k_f_s[284];
     dlnkfdT = fwd_beta[284] * invT + activation_units[284] * fwd_Ea[284] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[62];
-    Kc = exp(-g_RT[14] + g_RT[16] - g_RT[62] + g_RT[64]);
+    Kc = Kc_s[284];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[64]) + (h_RT[14] + h_RT[62]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54229,12 +51837,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[64];
-    k_f = prefactor_units[285] * fwd_A[285]
-                * exp(fwd_beta[285] * tc[0] - activation_units[285] * fwd_Ea[285] * invT);
+    k_f = k_f_s[285];
     dlnkfdT = fwd_beta[285] * invT + activation_units[285] * fwd_Ea[285] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[65];
-    Kc = exp(g_RT[12] - g_RT[13] + g_RT[64] - g_RT[65]);
+    Kc = Kc_s[285];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[64]) + (h_RT[13] + h_RT[65]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54280,12 +51887,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[65];
-    k_f = prefactor_units[286] * fwd_A[286]
-                * exp(fwd_beta[286] * tc[0] - activation_units[286] * fwd_Ea[286] * invT);
+    k_f = k_f_s[286];
     dlnkfdT = fwd_beta[286] * invT + activation_units[286] * fwd_Ea[286] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[24];
-    Kc = exp(g_RT[1] - g_RT[12] - g_RT[24] + g_RT[65]);
+    Kc = Kc_s[286];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[65]) + (h_RT[12] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54331,12 +51937,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[65];
-    k_f = prefactor_units[287] * fwd_A[287]
-                * exp(fwd_beta[287] * tc[0] - activation_units[287] * fwd_Ea[287] * invT);
+    k_f = k_f_s[287];
     dlnkfdT = fwd_beta[287] * invT + activation_units[287] * fwd_Ea[287] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[66];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[65] - g_RT[66]);
+    Kc = Kc_s[287];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[65]) + (h_RT[0] + h_RT[66]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54382,12 +51987,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[65];
-    k_f = prefactor_units[288] * fwd_A[288]
-                * exp(fwd_beta[288] * tc[0] - activation_units[288] * fwd_Ea[288] * invT);
+    k_f = k_f_s[288];
     dlnkfdT = fwd_beta[288] * invT + activation_units[288] * fwd_Ea[288] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[67];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[65] - g_RT[67]);
+    Kc = Kc_s[288];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[65]) + (h_RT[0] + h_RT[67]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54433,12 +52037,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[65];
-    k_f = prefactor_units[289] * fwd_A[289]
-                * exp(fwd_beta[289] * tc[0] - activation_units[289] * fwd_Ea[289] * invT);
+    k_f = k_f_s[289];
     dlnkfdT = fwd_beta[289] * invT + activation_units[289] * fwd_Ea[289] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[12]*sc[28];
-    Kc = refC * exp(-g_RT[1] + g_RT[2] - g_RT[12] - g_RT[28] + g_RT[65]);
+    Kc = Kc_s[289];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[65]) + (h_RT[1] + h_RT[12] + h_RT[28]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54497,12 +52100,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[65];
-    k_f = prefactor_units[290] * fwd_A[290]
-                * exp(fwd_beta[290] * tc[0] - activation_units[290] * fwd_Ea[290] * invT);
+    k_f = k_f_s[290];
     dlnkfdT = fwd_beta[290] * invT + activation_units[290] * fwd_Ea[290] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[25];
-    Kc = exp(g_RT[2] - g_RT[16] - g_RT[25] + g_RT[65]);
+    Kc = Kc_s[290];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[65]) + (h_RT[16] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54548,12 +52150,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[65];
-    k_f = prefactor_units[291] * fwd_A[291]
-                * exp(fwd_beta[291] * tc[0] - activation_units[291] * fwd_Ea[291] * invT);
+    k_f = k_f_s[291];
     dlnkfdT = fwd_beta[291] * invT + activation_units[291] * fwd_Ea[291] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[66];
-    Kc = exp(g_RT[2] - g_RT[4] + g_RT[65] - g_RT[66]);
+    Kc = Kc_s[291];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[65]) + (h_RT[4] + h_RT[66]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54599,12 +52200,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[65];
-    k_f = prefactor_units[292] * fwd_A[292]
-                * exp(fwd_beta[292] * tc[0] - activation_units[292] * fwd_Ea[292] * invT);
+    k_f = k_f_s[292];
     dlnkfdT = fwd_beta[292] * invT + activation_units[292] * fwd_Ea[292] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[67];
-    Kc = exp(g_RT[2] - g_RT[4] + g_RT[65] - g_RT[67]);
+    Kc = Kc_s[292];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[65]) + (h_RT[4] + h_RT[67]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54650,12 +52250,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[65];
-    k_f = prefactor_units[293] * fwd_A[293]
-                * exp(fwd_beta[293] * tc[0] - activation_units[293] * fwd_Ea[293] * invT);
+    k_f = k_f_s[293];
     dlnkfdT = fwd_beta[293] * invT + activation_units[293] * fwd_Ea[293] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[66];
-    Kc = exp(g_RT[4] - g_RT[5] + g_RT[65] - g_RT[66]);
+    Kc = Kc_s[293];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[65]) + (h_RT[5] + h_RT[66]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54701,12 +52300,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[65];
-    k_f = prefactor_units[294] * fwd_A[294]
-                * exp(fwd_beta[294] * tc[0] - activation_units[294] * fwd_Ea[294] * invT);
+    k_f = k_f_s[294];
     dlnkfdT = fwd_beta[294] * invT + activation_units[294] * fwd_Ea[294] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[67];
-    Kc = exp(g_RT[4] - g_RT[5] + g_RT[65] - g_RT[67]);
+    Kc = Kc_s[294];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[65]) + (h_RT[5] + h_RT[67]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54752,12 +52350,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[65];
-    k_f = prefactor_units[295] * fwd_A[295]
-                * exp(fwd_beta[295] * tc[0] - activation_units[295] * fwd_Ea[295] * invT);
+    k_f = k_f_s[295];
     dlnkfdT = fwd_beta[295] * invT + activation_units[295] * fwd_Ea[295] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[66];
-    Kc = exp(g_RT[6] - g_RT[7] + g_RT[65] - g_RT[66]);
+    Kc = Kc_s[295];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[65]) + (h_RT[7] + h_RT[66]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54803,12 +52400,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[65];
-    k_f = prefactor_units[296] * fwd_A[296]
-                * exp(fwd_beta[296] * tc[0] - activation_units[296] * fwd_Ea[296] * invT);
+    k_f = k_f_s[296];
     dlnkfdT = fwd_beta[296] * invT + activation_units[296] * fwd_Ea[296] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[66];
-    Kc = exp(g_RT[12] - g_RT[13] + g_RT[65] - g_RT[66]);
+    Kc = Kc_s[296];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[65]) + (h_RT[13] + h_RT[66]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54854,12 +52450,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[65];
-    k_f = prefactor_units[297] * fwd_A[297]
-                * exp(fwd_beta[297] * tc[0] - activation_units[297] * fwd_Ea[297] * invT);
+    k_f = k_f_s[297];
     dlnkfdT = fwd_beta[297] * invT + activation_units[297] * fwd_Ea[297] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[67];
-    Kc = exp(g_RT[12] - g_RT[13] + g_RT[65] - g_RT[67]);
+    Kc = Kc_s[297];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[65]) + (h_RT[13] + h_RT[67]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54905,12 +52500,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[66];
-    k_f = prefactor_units[298] * fwd_A[298]
-                * exp(fwd_beta[298] * tc[0] - activation_units[298] * fwd_Ea[298] * invT);
+    k_f = k_f_s[298];
     dlnkfdT = fwd_beta[298] * invT + activation_units[298] * fwd_Ea[298] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[36];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[36] + g_RT[66]);
+    Kc = Kc_s[298];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[66]) + (h_RT[0] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -54956,12 +52550,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[66];
-    k_f = prefactor_units[299] * fwd_A[299]
-                * exp(fwd_beta[299] * tc[0] - activation_units[299] * fwd_Ea[299] * invT);
+    k_f = k_f_s[299];
     dlnkfdT = fwd_beta[299] * invT + activation_units[299] * fwd_Ea[299] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[69];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[66] - g_RT[69]);
+    Kc = Kc_s[299];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[66]) + (h_RT[1] + h_RT[69]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55007,12 +52600,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[66];
-    k_f = prefactor_units[300] * fwd_A[300]
-                * exp(fwd_beta[300] * tc[0] - activation_units[300] * fwd_Ea[300] * invT);
+    k_f = k_f_s[300];
     dlnkfdT = fwd_beta[300] * invT + activation_units[300] * fwd_Ea[300] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[1]*sc[69];
-    Kc = refC * exp(-g_RT[1] - g_RT[1] + g_RT[4] + g_RT[66] - g_RT[69]);
+    Kc = Kc_s[300];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[66]) + (2*h_RT[1] + h_RT[69]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55058,12 +52650,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[23];
-    k_f = prefactor_units[301] * fwd_A[301]
-                * exp(fwd_beta[301] * tc[0] - activation_units[301] * fwd_Ea[301] * invT);
+    k_f = k_f_s[301];
     dlnkfdT = fwd_beta[301] * invT + activation_units[301] * fwd_Ea[301] * invT2;
     /* reverse */
     phi_r = sc[69];
-    Kc = refCinv * exp(g_RT[16] + g_RT[23] - g_RT[69]);
+    Kc = Kc_s[301];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[23]) + (h_RT[69]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55098,12 +52689,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[69];
-    k_f = prefactor_units[302] * fwd_A[302]
-                * exp(fwd_beta[302] * tc[0] - activation_units[302] * fwd_Ea[302] * invT);
+    k_f = k_f_s[302];
     dlnkfdT = fwd_beta[302] * invT + activation_units[302] * fwd_Ea[302] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[24];
-    Kc = exp(g_RT[1] - g_RT[16] - g_RT[24] + g_RT[69]);
+    Kc = Kc_s[302];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[69]) + (h_RT[16] + h_RT[24]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55149,12 +52739,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[69];
-    k_f = prefactor_units[303] * fwd_A[303]
-                * exp(fwd_beta[303] * tc[0] - activation_units[303] * fwd_Ea[303] * invT);
+    k_f = k_f_s[303];
     dlnkfdT = fwd_beta[303] * invT + activation_units[303] * fwd_Ea[303] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[14]*sc[23];
-    Kc = refC * exp(g_RT[2] - g_RT[4] - g_RT[14] - g_RT[23] + g_RT[69]);
+    Kc = Kc_s[303];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[69]) + (h_RT[4] + h_RT[14] + h_RT[23]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55213,12 +52802,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[69];
-    k_f = prefactor_units[304] * fwd_A[304]
-                * exp(fwd_beta[304] * tc[0] - activation_units[304] * fwd_Ea[304] * invT);
+    k_f = k_f_s[304];
     dlnkfdT = fwd_beta[304] * invT + activation_units[304] * fwd_Ea[304] * invT2;
     /* reverse */
     phi_r = sc[17]*sc[28];
-    Kc = exp(g_RT[2] - g_RT[17] - g_RT[28] + g_RT[69]);
+    Kc = Kc_s[304];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[69]) + (h_RT[17] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55264,12 +52852,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[69];
-    k_f = prefactor_units[305] * fwd_A[305]
-                * exp(fwd_beta[305] * tc[0] - activation_units[305] * fwd_Ea[305] * invT);
+    k_f = k_f_s[305];
     dlnkfdT = fwd_beta[305] * invT + activation_units[305] * fwd_Ea[305] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[14]*sc[23];
-    Kc = refC * exp(g_RT[4] - g_RT[5] - g_RT[14] - g_RT[23] + g_RT[69]);
+    Kc = Kc_s[305];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[69]) + (h_RT[5] + h_RT[14] + h_RT[23]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55328,12 +52915,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[66];
-    k_f = prefactor_units[306] * fwd_A[306]
-                * exp(fwd_beta[306] * tc[0] - activation_units[306] * fwd_Ea[306] * invT);
+    k_f = k_f_s[306];
     dlnkfdT = fwd_beta[306] * invT + activation_units[306] * fwd_Ea[306] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[36];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[36] + g_RT[66]);
+    Kc = Kc_s[306];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[66]) + (h_RT[5] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55379,12 +52965,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[66];
-    k_f = prefactor_units[307] * fwd_A[307]
-                * exp(fwd_beta[307] * tc[0] - activation_units[307] * fwd_Ea[307] * invT);
+    k_f = k_f_s[307];
     dlnkfdT = fwd_beta[307] * invT + activation_units[307] * fwd_Ea[307] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[36];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[36] + g_RT[66]);
+    Kc = Kc_s[307];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[66]) + (h_RT[6] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55430,12 +53015,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[66];
-    k_f = prefactor_units[308] * fwd_A[308]
-                * exp(fwd_beta[308] * tc[0] - activation_units[308] * fwd_Ea[308] * invT);
+    k_f = k_f_s[308];
     dlnkfdT = fwd_beta[308] * invT + activation_units[308] * fwd_Ea[308] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[14]*sc[17];
-    Kc = refC * exp(g_RT[3] - g_RT[12] - g_RT[14] - g_RT[17] + g_RT[66]);
+    Kc = Kc_s[308];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[66]) + (h_RT[12] + h_RT[14] + h_RT[17]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55494,12 +53078,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[66];
-    k_f = prefactor_units[309] * fwd_A[309]
-                * exp(fwd_beta[309] * tc[0] - activation_units[309] * fwd_Ea[309] * invT);
+    k_f = k_f_s[309];
     dlnkfdT = fwd_beta[309] * invT + activation_units[309] * fwd_Ea[309] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[69];
-    Kc = exp(g_RT[3] - g_RT[4] + g_RT[66] - g_RT[69]);
+    Kc = Kc_s[309];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[66]) + (h_RT[4] + h_RT[69]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55545,12 +53128,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[66];
-    k_f = prefactor_units[310] * fwd_A[310]
-                * exp(fwd_beta[310] * tc[0] - activation_units[310] * fwd_Ea[310] * invT);
+    k_f = k_f_s[310];
     dlnkfdT = fwd_beta[310] * invT + activation_units[310] * fwd_Ea[310] * invT2;
     /* reverse */
     phi_r = sc[3]*sc[65];
-    Kc = exp(-g_RT[3] + g_RT[6] - g_RT[65] + g_RT[66]);
+    Kc = Kc_s[310];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[66]) + (h_RT[3] + h_RT[65]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55596,12 +53178,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[66];
-    k_f = prefactor_units[311] * fwd_A[311]
-                * exp(fwd_beta[311] * tc[0] - activation_units[311] * fwd_Ea[311] * invT);
+    k_f = k_f_s[311];
     dlnkfdT = fwd_beta[311] * invT + activation_units[311] * fwd_Ea[311] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[17]*sc[23];
-    Kc = refC * exp(-g_RT[4] + g_RT[6] - g_RT[17] - g_RT[23] + g_RT[66]);
+    Kc = Kc_s[311];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[66]) + (h_RT[4] + h_RT[17] + h_RT[23]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55660,12 +53241,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[66];
-    k_f = prefactor_units[312] * fwd_A[312]
-                * exp(fwd_beta[312] * tc[0] - activation_units[312] * fwd_Ea[312] * invT);
+    k_f = k_f_s[312];
     dlnkfdT = fwd_beta[312] * invT + activation_units[312] * fwd_Ea[312] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[65];
-    Kc = exp(-g_RT[14] + g_RT[16] - g_RT[65] + g_RT[66]);
+    Kc = Kc_s[312];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[66]) + (h_RT[14] + h_RT[65]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55711,12 +53291,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[66];
-    k_f = prefactor_units[313] * fwd_A[313]
-                * exp(fwd_beta[313] * tc[0] - activation_units[313] * fwd_Ea[313] * invT);
+    k_f = k_f_s[313];
     dlnkfdT = fwd_beta[313] * invT + activation_units[313] * fwd_Ea[313] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[36];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[36] + g_RT[66]);
+    Kc = Kc_s[313];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[66]) + (h_RT[13] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55762,12 +53341,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[66]*sc[66];
-    k_f = prefactor_units[314] * fwd_A[314]
-                * exp(fwd_beta[314] * tc[0] - activation_units[314] * fwd_Ea[314] * invT);
+    k_f = k_f_s[314];
     dlnkfdT = fwd_beta[314] * invT + activation_units[314] * fwd_Ea[314] * invT2;
     /* reverse */
     phi_r = sc[36]*sc[65];
-    Kc = exp(-g_RT[36] - g_RT[65] + g_RT[66] + g_RT[66]);
+    Kc = Kc_s[314];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[66]) + (h_RT[36] + h_RT[65]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55802,12 +53380,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[66];
-    k_f = prefactor_units[315] * fwd_A[315]
-                * exp(fwd_beta[315] * tc[0] - activation_units[315] * fwd_Ea[315] * invT);
+    k_f = k_f_s[315];
     dlnkfdT = fwd_beta[315] * invT + activation_units[315] * fwd_Ea[315] * invT2;
     /* reverse */
     phi_r = sc[67];
-    Kc = exp(g_RT[66] - g_RT[67]);
+    Kc = Kc_s[315];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[66]) + (h_RT[67]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55833,12 +53410,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[67];
-    k_f = prefactor_units[316] * fwd_A[316]
-                * exp(fwd_beta[316] * tc[0] - activation_units[316] * fwd_Ea[316] * invT);
+    k_f = k_f_s[316];
     dlnkfdT = fwd_beta[316] * invT + activation_units[316] * fwd_Ea[316] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[35];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[35] + g_RT[67]);
+    Kc = Kc_s[316];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[67]) + (h_RT[0] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55884,12 +53460,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[67];
-    k_f = prefactor_units[317] * fwd_A[317]
-                * exp(fwd_beta[317] * tc[0] - activation_units[317] * fwd_Ea[317] * invT);
+    k_f = k_f_s[317];
     dlnkfdT = fwd_beta[317] * invT + activation_units[317] * fwd_Ea[317] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[28];
-    Kc = exp(g_RT[2] - g_RT[12] - g_RT[28] + g_RT[67]);
+    Kc = Kc_s[317];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[67]) + (h_RT[12] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55935,12 +53510,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[67];
-    k_f = prefactor_units[318] * fwd_A[318]
-                * exp(fwd_beta[318] * tc[0] - activation_units[318] * fwd_Ea[318] * invT);
+    k_f = k_f_s[318];
     dlnkfdT = fwd_beta[318] * invT + activation_units[318] * fwd_Ea[318] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[12]*sc[28];
-    Kc = refC * exp(-g_RT[1] + g_RT[4] - g_RT[12] - g_RT[28] + g_RT[67]);
+    Kc = Kc_s[318];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[67]) + (h_RT[1] + h_RT[12] + h_RT[28]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -55999,12 +53573,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[67];
-    k_f = prefactor_units[319] * fwd_A[319]
-                * exp(fwd_beta[319] * tc[0] - activation_units[319] * fwd_Ea[319] * invT);
+    k_f = k_f_s[319];
     dlnkfdT = fwd_beta[319] * invT + activation_units[319] * fwd_Ea[319] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[14]*sc[17];
-    Kc = refC * exp(g_RT[3] - g_RT[12] - g_RT[14] - g_RT[17] + g_RT[67]);
+    Kc = Kc_s[319];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[67]) + (h_RT[12] + h_RT[14] + h_RT[17]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56063,12 +53636,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[67];
-    k_f = prefactor_units[320] * fwd_A[320]
-                * exp(fwd_beta[320] * tc[0] - activation_units[320] * fwd_Ea[320] * invT);
+    k_f = k_f_s[320];
     dlnkfdT = fwd_beta[320] * invT + activation_units[320] * fwd_Ea[320] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[12]*sc[28];
-    Kc = refC * exp(-g_RT[4] + g_RT[6] - g_RT[12] - g_RT[28] + g_RT[67]);
+    Kc = Kc_s[320];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[67]) + (h_RT[4] + h_RT[12] + h_RT[28]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56127,12 +53699,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[67];
-    k_f = prefactor_units[321] * fwd_A[321]
-                * exp(fwd_beta[321] * tc[0] - activation_units[321] * fwd_Ea[321] * invT);
+    k_f = k_f_s[321];
     dlnkfdT = fwd_beta[321] * invT + activation_units[321] * fwd_Ea[321] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[65];
-    Kc = exp(-g_RT[14] + g_RT[16] - g_RT[65] + g_RT[67]);
+    Kc = Kc_s[321];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[67]) + (h_RT[14] + h_RT[65]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56178,12 +53749,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[67];
-    k_f = prefactor_units[322] * fwd_A[322]
-                * exp(fwd_beta[322] * tc[0] - activation_units[322] * fwd_Ea[322] * invT);
+    k_f = k_f_s[322];
     dlnkfdT = fwd_beta[322] * invT + activation_units[322] * fwd_Ea[322] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[35];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[35] + g_RT[67]);
+    Kc = Kc_s[322];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[67]) + (h_RT[13] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56229,12 +53799,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[22];
-    k_f = prefactor_units[323] * fwd_A[323]
-                * exp(fwd_beta[323] * tc[0] - activation_units[323] * fwd_Ea[323] * invT);
+    k_f = k_f_s[323];
     dlnkfdT = fwd_beta[323] * invT + activation_units[323] * fwd_Ea[323] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[35];
-    Kc = exp(-g_RT[1] + g_RT[12] + g_RT[22] - g_RT[35]);
+    Kc = Kc_s[323];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[22]) + (h_RT[1] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56280,12 +53849,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[22];
-    k_f = prefactor_units[324] * fwd_A[324]
-                * exp(fwd_beta[324] * tc[0] - activation_units[324] * fwd_Ea[324] * invT);
+    k_f = k_f_s[324];
     dlnkfdT = fwd_beta[324] * invT + activation_units[324] * fwd_Ea[324] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[36];
-    Kc = exp(-g_RT[1] + g_RT[12] + g_RT[22] - g_RT[36]);
+    Kc = Kc_s[324];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[22]) + (h_RT[1] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56331,12 +53899,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[22];
-    k_f = prefactor_units[325] * fwd_A[325]
-                * exp(fwd_beta[325] * tc[0] - activation_units[325] * fwd_Ea[325] * invT);
+    k_f = k_f_s[325];
     dlnkfdT = fwd_beta[325] * invT + activation_units[325] * fwd_Ea[325] * invT2;
     /* reverse */
     phi_r = sc[67];
-    Kc = refCinv * exp(g_RT[12] + g_RT[22] - g_RT[67]);
+    Kc = Kc_s[325];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[22]) + (h_RT[67]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56371,12 +53938,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[22];
-    k_f = prefactor_units[326] * fwd_A[326]
-                * exp(fwd_beta[326] * tc[0] - activation_units[326] * fwd_Ea[326] * invT);
+    k_f = k_f_s[326];
     dlnkfdT = fwd_beta[326] * invT + activation_units[326] * fwd_Ea[326] * invT2;
     /* reverse */
     phi_r = sc[66];
-    Kc = refCinv * exp(g_RT[12] + g_RT[22] - g_RT[66]);
+    Kc = Kc_s[326];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[22]) + (h_RT[66]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56411,12 +53977,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[23];
-    k_f = prefactor_units[327] * fwd_A[327]
-                * exp(fwd_beta[327] * tc[0] - activation_units[327] * fwd_Ea[327] * invT);
+    k_f = k_f_s[327];
     dlnkfdT = fwd_beta[327] * invT + activation_units[327] * fwd_Ea[327] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[66];
-    Kc = exp(-g_RT[1] + g_RT[12] + g_RT[23] - g_RT[66]);
+    Kc = Kc_s[327];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[23]) + (h_RT[1] + h_RT[66]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56462,12 +54027,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[24];
-    k_f = prefactor_units[328] * fwd_A[328]
-                * exp(fwd_beta[328] * tc[0] - activation_units[328] * fwd_Ea[328] * invT);
+    k_f = k_f_s[328];
     dlnkfdT = fwd_beta[328] * invT + activation_units[328] * fwd_Ea[328] * invT2;
     /* reverse */
     phi_r = sc[63];
-    Kc = refCinv * exp(g_RT[12] + g_RT[24] - g_RT[63]);
+    Kc = Kc_s[328];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[24]) + (h_RT[63]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56502,12 +54066,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[23]*sc[25];
-    k_f = prefactor_units[329] * fwd_A[329]
-                * exp(fwd_beta[329] * tc[0] - activation_units[329] * fwd_Ea[329] * invT);
+    k_f = k_f_s[329];
     dlnkfdT = fwd_beta[329] * invT + activation_units[329] * fwd_Ea[329] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[66];
-    Kc = exp(-g_RT[12] + g_RT[23] + g_RT[25] - g_RT[66]);
+    Kc = Kc_s[329];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[23] + h_RT[25]) + (h_RT[12] + h_RT[66]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56553,12 +54116,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[21]*sc[22];
-    k_f = prefactor_units[330] * fwd_A[330]
-                * exp(fwd_beta[330] * tc[0] - activation_units[330] * fwd_Ea[330] * invT);
+    k_f = k_f_s[330];
     dlnkfdT = fwd_beta[330] * invT + activation_units[330] * fwd_Ea[330] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[38];
-    Kc = exp(-g_RT[1] + g_RT[21] + g_RT[22] - g_RT[38]);
+    Kc = Kc_s[330];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[21] + h_RT[22]) + (h_RT[1] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56604,12 +54166,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[21]*sc[22];
-    k_f = prefactor_units[331] * fwd_A[331]
-                * exp(fwd_beta[331] * tc[0] - activation_units[331] * fwd_Ea[331] * invT);
+    k_f = k_f_s[331];
     dlnkfdT = fwd_beta[331] * invT + activation_units[331] * fwd_Ea[331] * invT2;
     /* reverse */
     phi_r = sc[40];
-    Kc = refCinv * exp(g_RT[21] + g_RT[22] - g_RT[40]);
+    Kc = Kc_s[331];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[21] + h_RT[22]) + (h_RT[40]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56644,12 +54205,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[21]*sc[22];
-    k_f = prefactor_units[332] * fwd_A[332]
-                * exp(fwd_beta[332] * tc[0] - activation_units[332] * fwd_Ea[332] * invT);
+    k_f = k_f_s[332];
     dlnkfdT = fwd_beta[332] * invT + activation_units[332] * fwd_Ea[332] * invT2;
     /* reverse */
     phi_r = sc[41];
-    Kc = refCinv * exp(g_RT[21] + g_RT[22] - g_RT[41]);
+    Kc = Kc_s[332];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[21] + h_RT[22]) + (h_RT[41]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56684,12 +54244,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[22]*sc[23];
-    k_f = prefactor_units[333] * fwd_A[333]
-                * exp(fwd_beta[333] * tc[0] - activation_units[333] * fwd_Ea[333] * invT);
+    k_f = k_f_s[333];
     dlnkfdT = fwd_beta[333] * invT + activation_units[333] * fwd_Ea[333] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[42];
-    Kc = exp(-g_RT[1] + g_RT[22] + g_RT[23] - g_RT[42]);
+    Kc = Kc_s[333];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[22] + h_RT[23]) + (h_RT[1] + h_RT[42]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56735,12 +54294,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[22]*sc[23];
-    k_f = prefactor_units[334] * fwd_A[334]
-                * exp(fwd_beta[334] * tc[0] - activation_units[334] * fwd_Ea[334] * invT);
+    k_f = k_f_s[334];
     dlnkfdT = fwd_beta[334] * invT + activation_units[334] * fwd_Ea[334] * invT2;
     /* reverse */
     phi_r = sc[43];
-    Kc = refCinv * exp(g_RT[22] + g_RT[23] - g_RT[43]);
+    Kc = Kc_s[334];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[22] + h_RT[23]) + (h_RT[43]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56775,12 +54333,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[22]*sc[23];
-    k_f = prefactor_units[335] * fwd_A[335]
-                * exp(fwd_beta[335] * tc[0] - activation_units[335] * fwd_Ea[335] * invT);
+    k_f = k_f_s[335];
     dlnkfdT = fwd_beta[335] * invT + activation_units[335] * fwd_Ea[335] * invT2;
     /* reverse */
     phi_r = sc[44];
-    Kc = refCinv * exp(g_RT[22] + g_RT[23] - g_RT[44]);
+    Kc = Kc_s[335];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[22] + h_RT[23]) + (h_RT[44]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56815,12 +54372,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[21]*sc[24];
-    k_f = prefactor_units[336] * fwd_A[336]
-                * exp(fwd_beta[336] * tc[0] - activation_units[336] * fwd_Ea[336] * invT);
+    k_f = k_f_s[336];
     dlnkfdT = fwd_beta[336] * invT + activation_units[336] * fwd_Ea[336] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[42];
-    Kc = exp(-g_RT[1] + g_RT[21] + g_RT[24] - g_RT[42]);
+    Kc = Kc_s[336];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[21] + h_RT[24]) + (h_RT[1] + h_RT[42]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56866,12 +54422,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[23]*sc[24];
-    k_f = prefactor_units[337] * fwd_A[337]
-                * exp(fwd_beta[337] * tc[0] - activation_units[337] * fwd_Ea[337] * invT);
+    k_f = k_f_s[337];
     dlnkfdT = fwd_beta[337] * invT + activation_units[337] * fwd_Ea[337] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[45];
-    Kc = exp(-g_RT[1] + g_RT[23] + g_RT[24] - g_RT[45]);
+    Kc = Kc_s[337];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[23] + h_RT[24]) + (h_RT[1] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56917,12 +54472,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[23]*sc[23];
-    k_f = prefactor_units[338] * fwd_A[338]
-                * exp(fwd_beta[338] * tc[0] - activation_units[338] * fwd_Ea[338] * invT);
+    k_f = k_f_s[338];
     dlnkfdT = fwd_beta[338] * invT + activation_units[338] * fwd_Ea[338] * invT2;
     /* reverse */
     phi_r = sc[45];
-    Kc = refCinv * exp(g_RT[23] + g_RT[23] - g_RT[45]);
+    Kc = Kc_s[338];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[23]) + (h_RT[45]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56948,12 +54502,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[23]*sc[23];
-    k_f = prefactor_units[339] * fwd_A[339]
-                * exp(fwd_beta[339] * tc[0] - activation_units[339] * fwd_Ea[339] * invT);
+    k_f = k_f_s[339];
     dlnkfdT = fwd_beta[339] * invT + activation_units[339] * fwd_Ea[339] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[44];
-    Kc = exp(-g_RT[1] + g_RT[23] + g_RT[23] - g_RT[44]);
+    Kc = Kc_s[339];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[23]) + (h_RT[1] + h_RT[44]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -56988,12 +54541,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[23]*sc[23];
-    k_f = prefactor_units[340] * fwd_A[340]
-                * exp(fwd_beta[340] * tc[0] - activation_units[340] * fwd_Ea[340] * invT);
+    k_f = k_f_s[340];
     dlnkfdT = fwd_beta[340] * invT + activation_units[340] * fwd_Ea[340] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[43];
-    Kc = exp(-g_RT[1] + g_RT[23] + g_RT[23] - g_RT[43]);
+    Kc = Kc_s[340];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[23]) + (h_RT[1] + h_RT[43]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57028,12 +54580,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[33];
-    k_f = prefactor_units[341] * fwd_A[341]
-                * exp(fwd_beta[341] * tc[0] - activation_units[341] * fwd_Ea[341] * invT);
+    k_f = k_f_s[341];
     dlnkfdT = fwd_beta[341] * invT + activation_units[341] * fwd_Ea[341] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[38];
-    Kc = exp(-g_RT[1] + g_RT[9] + g_RT[33] - g_RT[38]);
+    Kc = Kc_s[341];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[33]) + (h_RT[1] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57079,12 +54630,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[33];
-    k_f = prefactor_units[342] * fwd_A[342]
-                * exp(fwd_beta[342] * tc[0] - activation_units[342] * fwd_Ea[342] * invT);
+    k_f = k_f_s[342];
     dlnkfdT = fwd_beta[342] * invT + activation_units[342] * fwd_Ea[342] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[40];
-    Kc = exp(-g_RT[1] + g_RT[10] + g_RT[33] - g_RT[40]);
+    Kc = Kc_s[342];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[33]) + (h_RT[1] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57130,12 +54680,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[33];
-    k_f = prefactor_units[343] * fwd_A[343]
-                * exp(fwd_beta[343] * tc[0] - activation_units[343] * fwd_Ea[343] * invT);
+    k_f = k_f_s[343];
     dlnkfdT = fwd_beta[343] * invT + activation_units[343] * fwd_Ea[343] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[42];
-    Kc = exp(-g_RT[1] + g_RT[12] + g_RT[33] - g_RT[42]);
+    Kc = Kc_s[343];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[33]) + (h_RT[1] + h_RT[42]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57181,12 +54730,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[27]*sc[33];
-    k_f = prefactor_units[344] * fwd_A[344]
-                * exp(fwd_beta[344] * tc[0] - activation_units[344] * fwd_Ea[344] * invT);
+    k_f = k_f_s[344];
     dlnkfdT = fwd_beta[344] * invT + activation_units[344] * fwd_Ea[344] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[40];
-    Kc = exp(-g_RT[14] + g_RT[27] + g_RT[33] - g_RT[40]);
+    Kc = Kc_s[344];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[27] + h_RT[33]) + (h_RT[14] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57232,12 +54780,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[27]*sc[34];
-    k_f = prefactor_units[345] * fwd_A[345]
-                * exp(fwd_beta[345] * tc[0] - activation_units[345] * fwd_Ea[345] * invT);
+    k_f = k_f_s[345];
     dlnkfdT = fwd_beta[345] * invT + activation_units[345] * fwd_Ea[345] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[42];
-    Kc = exp(-g_RT[14] + g_RT[27] + g_RT[34] - g_RT[42]);
+    Kc = Kc_s[345];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[27] + h_RT[34]) + (h_RT[14] + h_RT[42]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57283,12 +54830,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[9]*sc[34];
-    k_f = prefactor_units[346] * fwd_A[346]
-                * exp(fwd_beta[346] * tc[0] - activation_units[346] * fwd_Ea[346] * invT);
+    k_f = k_f_s[346];
     dlnkfdT = fwd_beta[346] * invT + activation_units[346] * fwd_Ea[346] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[41];
-    Kc = exp(-g_RT[1] + g_RT[9] + g_RT[34] - g_RT[41]);
+    Kc = Kc_s[346];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[9] + h_RT[34]) + (h_RT[1] + h_RT[41]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57334,12 +54880,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[10]*sc[34];
-    k_f = prefactor_units[347] * fwd_A[347]
-                * exp(fwd_beta[347] * tc[0] - activation_units[347] * fwd_Ea[347] * invT);
+    k_f = k_f_s[347];
     dlnkfdT = fwd_beta[347] * invT + activation_units[347] * fwd_Ea[347] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[42];
-    Kc = exp(-g_RT[1] + g_RT[10] + g_RT[34] - g_RT[42]);
+    Kc = Kc_s[347];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[10] + h_RT[34]) + (h_RT[1] + h_RT[42]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57385,12 +54930,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[44];
-    k_f = prefactor_units[348] * fwd_A[348]
-                * exp(fwd_beta[348] * tc[0] - activation_units[348] * fwd_Ea[348] * invT);
+    k_f = k_f_s[348];
     dlnkfdT = fwd_beta[348] * invT + activation_units[348] * fwd_Ea[348] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[34];
-    Kc = exp(g_RT[1] - g_RT[12] - g_RT[34] + g_RT[44]);
+    Kc = Kc_s[348];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[44]) + (h_RT[12] + h_RT[34]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57436,12 +54980,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[35]*sc[54];
-    k_f = prefactor_units[349] * fwd_A[349]
-                * exp(fwd_beta[349] * tc[0] - activation_units[349] * fwd_Ea[349] * invT);
+    k_f = k_f_s[349];
     dlnkfdT = fwd_beta[349] * invT + activation_units[349] * fwd_Ea[349] * invT2;
     /* reverse */
     phi_r = sc[34]*sc[53];
-    Kc = exp(-g_RT[34] + g_RT[35] - g_RT[53] + g_RT[54]);
+    Kc = Kc_s[349];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[35] + h_RT[54]) + (h_RT[34] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57487,12 +55030,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[36]*sc[54];
-    k_f = prefactor_units[350] * fwd_A[350]
-                * exp(fwd_beta[350] * tc[0] - activation_units[350] * fwd_Ea[350] * invT);
+    k_f = k_f_s[350];
     dlnkfdT = fwd_beta[350] * invT + activation_units[350] * fwd_Ea[350] * invT2;
     /* reverse */
     phi_r = sc[34]*sc[53];
-    Kc = exp(-g_RT[34] + g_RT[36] - g_RT[53] + g_RT[54]);
+    Kc = Kc_s[350];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[36] + h_RT[54]) + (h_RT[34] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57538,12 +55080,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[38];
-    k_f = prefactor_units[351] * fwd_A[351]
-                * exp(fwd_beta[351] * tc[0] - activation_units[351] * fwd_Ea[351] * invT);
+    k_f = k_f_s[351];
     dlnkfdT = fwd_beta[351] * invT + activation_units[351] * fwd_Ea[351] * invT2;
     /* reverse */
     phi_r = sc[40];
-    Kc = refCinv * exp(g_RT[1] + g_RT[38] - g_RT[40]);
+    Kc = Kc_s[351];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[38]) + (h_RT[40]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57578,12 +55119,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[38];
-    k_f = prefactor_units[352] * fwd_A[352]
-                * exp(fwd_beta[352] * tc[0] - activation_units[352] * fwd_Ea[352] * invT);
+    k_f = k_f_s[352];
     dlnkfdT = fwd_beta[352] * invT + activation_units[352] * fwd_Ea[352] * invT2;
     /* reverse */
     phi_r = sc[41];
-    Kc = refCinv * exp(g_RT[1] + g_RT[38] - g_RT[41]);
+    Kc = Kc_s[352];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[38]) + (h_RT[41]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57618,12 +55158,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[38];
-    k_f = prefactor_units[353] * fwd_A[353]
-                * exp(fwd_beta[353] * tc[0] - activation_units[353] * fwd_Ea[353] * invT);
+    k_f = k_f_s[353];
     dlnkfdT = fwd_beta[353] * invT + activation_units[353] * fwd_Ea[353] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[33];
-    Kc = exp(g_RT[2] - g_RT[14] - g_RT[33] + g_RT[38]);
+    Kc = Kc_s[353];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[38]) + (h_RT[14] + h_RT[33]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57669,12 +55208,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[38];
-    k_f = prefactor_units[354] * fwd_A[354]
-                * exp(fwd_beta[354] * tc[0] - activation_units[354] * fwd_Ea[354] * invT);
+    k_f = k_f_s[354];
     dlnkfdT = fwd_beta[354] * invT + activation_units[354] * fwd_Ea[354] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[39];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[38] - g_RT[39]);
+    Kc = Kc_s[354];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[38]) + (h_RT[1] + h_RT[39]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57720,12 +55258,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[39];
-    k_f = prefactor_units[355] * fwd_A[355]
-                * exp(fwd_beta[355] * tc[0] - activation_units[355] * fwd_Ea[355] * invT);
+    k_f = k_f_s[355];
     dlnkfdT = fwd_beta[355] * invT + activation_units[355] * fwd_Ea[355] * invT2;
     /* reverse */
     phi_r = sc[22]*sc[27];
-    Kc = exp(g_RT[1] - g_RT[22] - g_RT[27] + g_RT[39]);
+    Kc = Kc_s[355];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[39]) + (h_RT[22] + h_RT[27]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57771,12 +55308,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[39];
-    k_f = prefactor_units[356] * fwd_A[356]
-                * exp(fwd_beta[356] * tc[0] - activation_units[356] * fwd_Ea[356] * invT);
+    k_f = k_f_s[356];
     dlnkfdT = fwd_beta[356] * invT + activation_units[356] * fwd_Ea[356] * invT2;
     /* reverse */
     phi_r = sc[27]*sc[28];
-    Kc = exp(g_RT[4] - g_RT[27] - g_RT[28] + g_RT[39]);
+    Kc = Kc_s[356];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[39]) + (h_RT[27] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57822,12 +55358,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[40];
-    k_f = prefactor_units[357] * fwd_A[357]
-                * exp(fwd_beta[357] * tc[0] - activation_units[357] * fwd_Ea[357] * invT);
+    k_f = k_f_s[357];
     dlnkfdT = fwd_beta[357] * invT + activation_units[357] * fwd_Ea[357] * invT2;
     /* reverse */
     phi_r = sc[41];
-    Kc = exp(g_RT[40] - g_RT[41]);
+    Kc = Kc_s[357];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[40]) + (h_RT[41]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57853,12 +55388,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[40];
-    k_f = prefactor_units[358] * fwd_A[358]
-                * exp(fwd_beta[358] * tc[0] - activation_units[358] * fwd_Ea[358] * invT);
+    k_f = k_f_s[358];
     dlnkfdT = fwd_beta[358] * invT + activation_units[358] * fwd_Ea[358] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[41];
-    Kc = exp(g_RT[1] - g_RT[1] + g_RT[40] - g_RT[41]);
+    Kc = Kc_s[358];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[40]) + (h_RT[1] + h_RT[41]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57888,12 +55422,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[40];
-    k_f = prefactor_units[359] * fwd_A[359]
-                * exp(fwd_beta[359] * tc[0] - activation_units[359] * fwd_Ea[359] * invT);
+    k_f = k_f_s[359];
     dlnkfdT = fwd_beta[359] * invT + activation_units[359] * fwd_Ea[359] * invT2;
     /* reverse */
     phi_r = sc[22]*sc[22];
-    Kc = exp(g_RT[1] - g_RT[22] - g_RT[22] + g_RT[40]);
+    Kc = Kc_s[359];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[40]) + (2*h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57928,12 +55461,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[41];
-    k_f = prefactor_units[360] * fwd_A[360]
-                * exp(fwd_beta[360] * tc[0] - activation_units[360] * fwd_Ea[360] * invT);
+    k_f = k_f_s[360];
     dlnkfdT = fwd_beta[360] * invT + activation_units[360] * fwd_Ea[360] * invT2;
     /* reverse */
     phi_r = sc[22]*sc[22];
-    Kc = exp(g_RT[1] - g_RT[22] - g_RT[22] + g_RT[41]);
+    Kc = Kc_s[360];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[41]) + (2*h_RT[22]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -57968,12 +55500,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[40];
-    k_f = prefactor_units[361] * fwd_A[361]
-                * exp(fwd_beta[361] * tc[0] - activation_units[361] * fwd_Ea[361] * invT);
+    k_f = k_f_s[361];
     dlnkfdT = fwd_beta[361] * invT + activation_units[361] * fwd_Ea[361] * invT2;
     /* reverse */
     phi_r = sc[42];
-    Kc = refCinv * exp(g_RT[1] + g_RT[40] - g_RT[42]);
+    Kc = Kc_s[361];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[40]) + (h_RT[42]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58008,12 +55539,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[41];
-    k_f = prefactor_units[362] * fwd_A[362]
-                * exp(fwd_beta[362] * tc[0] - activation_units[362] * fwd_Ea[362] * invT);
+    k_f = k_f_s[362];
     dlnkfdT = fwd_beta[362] * invT + activation_units[362] * fwd_Ea[362] * invT2;
     /* reverse */
     phi_r = sc[42];
-    Kc = refCinv * exp(g_RT[1] + g_RT[41] - g_RT[42]);
+    Kc = Kc_s[362];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[41]) + (h_RT[42]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58048,12 +55578,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[40];
-    k_f = prefactor_units[363] * fwd_A[363]
-                * exp(fwd_beta[363] * tc[0] - activation_units[363] * fwd_Ea[363] * invT);
+    k_f = k_f_s[363];
     dlnkfdT = fwd_beta[363] * invT + activation_units[363] * fwd_Ea[363] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[38];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[38] + g_RT[40]);
+    Kc = Kc_s[363];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[40]) + (h_RT[0] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58099,12 +55628,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[41];
-    k_f = prefactor_units[364] * fwd_A[364]
-                * exp(fwd_beta[364] * tc[0] - activation_units[364] * fwd_Ea[364] * invT);
+    k_f = k_f_s[364];
     dlnkfdT = fwd_beta[364] * invT + activation_units[364] * fwd_Ea[364] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[38];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[38] + g_RT[41]);
+    Kc = Kc_s[364];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[41]) + (h_RT[0] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58150,12 +55678,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[40];
-    k_f = prefactor_units[365] * fwd_A[365]
-                * exp(fwd_beta[365] * tc[0] - activation_units[365] * fwd_Ea[365] * invT);
+    k_f = k_f_s[365];
     dlnkfdT = fwd_beta[365] * invT + activation_units[365] * fwd_Ea[365] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[38];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[38] + g_RT[40]);
+    Kc = Kc_s[365];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[40]) + (h_RT[5] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58201,12 +55728,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[41];
-    k_f = prefactor_units[366] * fwd_A[366]
-                * exp(fwd_beta[366] * tc[0] - activation_units[366] * fwd_Ea[366] * invT);
+    k_f = k_f_s[366];
     dlnkfdT = fwd_beta[366] * invT + activation_units[366] * fwd_Ea[366] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[38];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[38] + g_RT[41]);
+    Kc = Kc_s[366];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[41]) + (h_RT[5] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58252,12 +55778,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[41];
-    k_f = prefactor_units[367] * fwd_A[367]
-                * exp(fwd_beta[367] * tc[0] - activation_units[367] * fwd_Ea[367] * invT);
+    k_f = k_f_s[367];
     dlnkfdT = fwd_beta[367] * invT + activation_units[367] * fwd_Ea[367] * invT2;
     /* reverse */
     phi_r = sc[27]*sc[28];
-    Kc = exp(g_RT[3] - g_RT[27] - g_RT[28] + g_RT[41]);
+    Kc = Kc_s[367];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[41]) + (h_RT[27] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58303,12 +55828,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[42];
-    k_f = prefactor_units[368] * fwd_A[368]
-                * exp(fwd_beta[368] * tc[0] - activation_units[368] * fwd_Ea[368] * invT);
+    k_f = k_f_s[368];
     dlnkfdT = fwd_beta[368] * invT + activation_units[368] * fwd_Ea[368] * invT2;
     /* reverse */
     phi_r = sc[43];
-    Kc = refCinv * exp(g_RT[1] + g_RT[42] - g_RT[43]);
+    Kc = Kc_s[368];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[42]) + (h_RT[43]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58343,12 +55867,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[42];
-    k_f = prefactor_units[369] * fwd_A[369]
-                * exp(fwd_beta[369] * tc[0] - activation_units[369] * fwd_Ea[369] * invT);
+    k_f = k_f_s[369];
     dlnkfdT = fwd_beta[369] * invT + activation_units[369] * fwd_Ea[369] * invT2;
     /* reverse */
     phi_r = sc[44];
-    Kc = refCinv * exp(g_RT[1] + g_RT[42] - g_RT[44]);
+    Kc = Kc_s[369];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[42]) + (h_RT[44]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58383,12 +55906,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[42];
-    k_f = prefactor_units[370] * fwd_A[370]
-                * exp(fwd_beta[370] * tc[0] - activation_units[370] * fwd_Ea[370] * invT);
+    k_f = k_f_s[370];
     dlnkfdT = fwd_beta[370] * invT + activation_units[370] * fwd_Ea[370] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[40];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[40] + g_RT[42]);
+    Kc = Kc_s[370];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[42]) + (h_RT[0] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58434,12 +55956,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[42];
-    k_f = prefactor_units[371] * fwd_A[371]
-                * exp(fwd_beta[371] * tc[0] - activation_units[371] * fwd_Ea[371] * invT);
+    k_f = k_f_s[371];
     dlnkfdT = fwd_beta[371] * invT + activation_units[371] * fwd_Ea[371] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[41];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[41] + g_RT[42]);
+    Kc = Kc_s[371];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[42]) + (h_RT[0] + h_RT[41]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58485,12 +56006,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[42];
-    k_f = prefactor_units[372] * fwd_A[372]
-                * exp(fwd_beta[372] * tc[0] - activation_units[372] * fwd_Ea[372] * invT);
+    k_f = k_f_s[372];
     dlnkfdT = fwd_beta[372] * invT + activation_units[372] * fwd_Ea[372] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[40];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[40] + g_RT[42]);
+    Kc = Kc_s[372];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[42]) + (h_RT[5] + h_RT[40]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58536,12 +56056,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[42];
-    k_f = prefactor_units[373] * fwd_A[373]
-                * exp(fwd_beta[373] * tc[0] - activation_units[373] * fwd_Ea[373] * invT);
+    k_f = k_f_s[373];
     dlnkfdT = fwd_beta[373] * invT + activation_units[373] * fwd_Ea[373] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[41];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[41] + g_RT[42]);
+    Kc = Kc_s[373];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[42]) + (h_RT[5] + h_RT[41]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58587,12 +56106,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[43];
-    k_f = prefactor_units[374] * fwd_A[374]
-                * exp(fwd_beta[374] * tc[0] - activation_units[374] * fwd_Ea[374] * invT);
+    k_f = k_f_s[374];
     dlnkfdT = fwd_beta[374] * invT + activation_units[374] * fwd_Ea[374] * invT2;
     /* reverse */
     phi_r = sc[44];
-    Kc = exp(g_RT[43] - g_RT[44]);
+    Kc = Kc_s[374];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[43]) + (h_RT[44]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58618,12 +56136,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[43];
-    k_f = prefactor_units[375] * fwd_A[375]
-                * exp(fwd_beta[375] * tc[0] - activation_units[375] * fwd_Ea[375] * invT);
+    k_f = k_f_s[375];
     dlnkfdT = fwd_beta[375] * invT + activation_units[375] * fwd_Ea[375] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[44];
-    Kc = exp(g_RT[1] - g_RT[1] + g_RT[43] - g_RT[44]);
+    Kc = Kc_s[375];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[43]) + (h_RT[1] + h_RT[44]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58653,12 +56170,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[45];
-    k_f = prefactor_units[376] * fwd_A[376]
-                * exp(fwd_beta[376] * tc[0] - activation_units[376] * fwd_Ea[376] * invT);
+    k_f = k_f_s[376];
     dlnkfdT = fwd_beta[376] * invT + activation_units[376] * fwd_Ea[376] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[44];
-    Kc = refC * exp(-g_RT[1] - g_RT[44] + g_RT[45]);
+    Kc = Kc_s[376];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[45]) + (h_RT[1] + h_RT[44]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58693,12 +56209,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[45];
-    k_f = prefactor_units[377] * fwd_A[377]
-                * exp(fwd_beta[377] * tc[0] - activation_units[377] * fwd_Ea[377] * invT);
+    k_f = k_f_s[377];
     dlnkfdT = fwd_beta[377] * invT + activation_units[377] * fwd_Ea[377] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[43];
-    Kc = refC * exp(-g_RT[1] - g_RT[43] + g_RT[45]);
+    Kc = Kc_s[377];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[45]) + (h_RT[1] + h_RT[43]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58733,12 +56248,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[43];
-    k_f = prefactor_units[378] * fwd_A[378]
-                * exp(fwd_beta[378] * tc[0] - activation_units[378] * fwd_Ea[378] * invT);
+    k_f = k_f_s[378];
     dlnkfdT = fwd_beta[378] * invT + activation_units[378] * fwd_Ea[378] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[42];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[42] + g_RT[43]);
+    Kc = Kc_s[378];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[43]) + (h_RT[0] + h_RT[42]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58784,12 +56298,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[44];
-    k_f = prefactor_units[379] * fwd_A[379]
-                * exp(fwd_beta[379] * tc[0] - activation_units[379] * fwd_Ea[379] * invT);
+    k_f = k_f_s[379];
     dlnkfdT = fwd_beta[379] * invT + activation_units[379] * fwd_Ea[379] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[42];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[42] + g_RT[44]);
+    Kc = Kc_s[379];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[44]) + (h_RT[0] + h_RT[42]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58835,12 +56348,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[43];
-    k_f = prefactor_units[380] * fwd_A[380]
-                * exp(fwd_beta[380] * tc[0] - activation_units[380] * fwd_Ea[380] * invT);
+    k_f = k_f_s[380];
     dlnkfdT = fwd_beta[380] * invT + activation_units[380] * fwd_Ea[380] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[42];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[42] + g_RT[43]);
+    Kc = Kc_s[380];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[43]) + (h_RT[5] + h_RT[42]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58886,12 +56398,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[44];
-    k_f = prefactor_units[381] * fwd_A[381]
-                * exp(fwd_beta[381] * tc[0] - activation_units[381] * fwd_Ea[381] * invT);
+    k_f = k_f_s[381];
     dlnkfdT = fwd_beta[381] * invT + activation_units[381] * fwd_Ea[381] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[42];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[42] + g_RT[44]);
+    Kc = Kc_s[381];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[44]) + (h_RT[5] + h_RT[42]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -58937,12 +56448,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[43];
-    k_f = prefactor_units[382] * fwd_A[382]
-                * exp(fwd_beta[382] * tc[0] - activation_units[382] * fwd_Ea[382] * invT);
+    k_f = k_f_s[382];
     dlnkfdT = fwd_beta[382] * invT + activation_units[382] * fwd_Ea[382] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[16]*sc[24];
-    Kc = refC * exp(g_RT[3] - g_RT[14] - g_RT[16] - g_RT[24] + g_RT[43]);
+    Kc = Kc_s[382];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[43]) + (h_RT[14] + h_RT[16] + h_RT[24]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59001,12 +56511,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[44];
-    k_f = prefactor_units[383] * fwd_A[383]
-                * exp(fwd_beta[383] * tc[0] - activation_units[383] * fwd_Ea[383] * invT);
+    k_f = k_f_s[383];
     dlnkfdT = fwd_beta[383] * invT + activation_units[383] * fwd_Ea[383] * invT2;
     /* reverse */
     phi_r = sc[28]*sc[32];
-    Kc = exp(g_RT[3] - g_RT[28] - g_RT[32] + g_RT[44]);
+    Kc = Kc_s[383];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[44]) + (h_RT[28] + h_RT[32]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59052,12 +56561,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[43];
-    k_f = prefactor_units[384] * fwd_A[384]
-                * exp(fwd_beta[384] * tc[0] - activation_units[384] * fwd_Ea[384] * invT);
+    k_f = k_f_s[384];
     dlnkfdT = fwd_beta[384] * invT + activation_units[384] * fwd_Ea[384] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[45];
-    Kc = exp(-g_RT[14] + g_RT[16] + g_RT[43] - g_RT[45]);
+    Kc = Kc_s[384];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[43]) + (h_RT[14] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59103,12 +56611,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[44];
-    k_f = prefactor_units[385] * fwd_A[385]
-                * exp(fwd_beta[385] * tc[0] - activation_units[385] * fwd_Ea[385] * invT);
+    k_f = k_f_s[385];
     dlnkfdT = fwd_beta[385] * invT + activation_units[385] * fwd_Ea[385] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[45];
-    Kc = exp(-g_RT[14] + g_RT[16] + g_RT[44] - g_RT[45]);
+    Kc = Kc_s[385];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[44]) + (h_RT[14] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59154,12 +56661,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[45];
-    k_f = prefactor_units[386] * fwd_A[386]
-                * exp(fwd_beta[386] * tc[0] - activation_units[386] * fwd_Ea[386] * invT);
+    k_f = k_f_s[386];
     dlnkfdT = fwd_beta[386] * invT + activation_units[386] * fwd_Ea[386] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[43];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[43] + g_RT[45]);
+    Kc = Kc_s[386];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[45]) + (h_RT[0] + h_RT[43]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59205,12 +56711,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[45];
-    k_f = prefactor_units[387] * fwd_A[387]
-                * exp(fwd_beta[387] * tc[0] - activation_units[387] * fwd_Ea[387] * invT);
+    k_f = k_f_s[387];
     dlnkfdT = fwd_beta[387] * invT + activation_units[387] * fwd_Ea[387] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[44];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[44] + g_RT[45]);
+    Kc = Kc_s[387];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[45]) + (h_RT[0] + h_RT[44]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59256,12 +56761,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[45];
-    k_f = prefactor_units[388] * fwd_A[388]
-                * exp(fwd_beta[388] * tc[0] - activation_units[388] * fwd_Ea[388] * invT);
+    k_f = k_f_s[388];
     dlnkfdT = fwd_beta[388] * invT + activation_units[388] * fwd_Ea[388] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[35];
-    Kc = exp(g_RT[1] - g_RT[12] - g_RT[35] + g_RT[45]);
+    Kc = Kc_s[388];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[45]) + (h_RT[12] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59307,12 +56811,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[45];
-    k_f = prefactor_units[389] * fwd_A[389]
-                * exp(fwd_beta[389] * tc[0] - activation_units[389] * fwd_Ea[389] * invT);
+    k_f = k_f_s[389];
     dlnkfdT = fwd_beta[389] * invT + activation_units[389] * fwd_Ea[389] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[66];
-    Kc = exp(g_RT[2] - g_RT[16] + g_RT[45] - g_RT[66]);
+    Kc = Kc_s[389];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[45]) + (h_RT[16] + h_RT[66]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59358,12 +56861,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[45];
-    k_f = prefactor_units[390] * fwd_A[390]
-                * exp(fwd_beta[390] * tc[0] - activation_units[390] * fwd_Ea[390] * invT);
+    k_f = k_f_s[390];
     dlnkfdT = fwd_beta[390] * invT + activation_units[390] * fwd_Ea[390] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[43];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[43] + g_RT[45]);
+    Kc = Kc_s[390];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[45]) + (h_RT[5] + h_RT[43]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59409,12 +56911,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[45];
-    k_f = prefactor_units[391] * fwd_A[391]
-                * exp(fwd_beta[391] * tc[0] - activation_units[391] * fwd_Ea[391] * invT);
+    k_f = k_f_s[391];
     dlnkfdT = fwd_beta[391] * invT + activation_units[391] * fwd_Ea[391] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[44];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[44] + g_RT[45]);
+    Kc = Kc_s[391];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[45]) + (h_RT[5] + h_RT[44]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59460,12 +56961,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[46];
-    k_f = prefactor_units[392] * fwd_A[392]
-                * exp(fwd_beta[392] * tc[0] - activation_units[392] * fwd_Ea[392] * invT);
+    k_f = k_f_s[392];
     dlnkfdT = fwd_beta[392] * invT + activation_units[392] * fwd_Ea[392] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[45];
-    Kc = exp(g_RT[1] - g_RT[1] - g_RT[45] + g_RT[46]);
+    Kc = Kc_s[392];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[46]) + (h_RT[1] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59495,12 +56995,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[46];
-    k_f = prefactor_units[393] * fwd_A[393]
-                * exp(fwd_beta[393] * tc[0] - activation_units[393] * fwd_Ea[393] * invT);
+    k_f = k_f_s[393];
     dlnkfdT = fwd_beta[393] * invT + activation_units[393] * fwd_Ea[393] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[44];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[44] + g_RT[46]);
+    Kc = Kc_s[393];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[46]) + (h_RT[0] + h_RT[44]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59546,12 +57045,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[46];
-    k_f = prefactor_units[394] * fwd_A[394]
-                * exp(fwd_beta[394] * tc[0] - activation_units[394] * fwd_Ea[394] * invT);
+    k_f = k_f_s[394];
     dlnkfdT = fwd_beta[394] * invT + activation_units[394] * fwd_Ea[394] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[36];
-    Kc = exp(g_RT[1] - g_RT[12] - g_RT[36] + g_RT[46]);
+    Kc = Kc_s[394];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[46]) + (h_RT[12] + h_RT[36]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59597,12 +57095,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[46];
-    k_f = prefactor_units[395] * fwd_A[395]
-                * exp(fwd_beta[395] * tc[0] - activation_units[395] * fwd_Ea[395] * invT);
+    k_f = k_f_s[395];
     dlnkfdT = fwd_beta[395] * invT + activation_units[395] * fwd_Ea[395] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[35];
-    Kc = exp(g_RT[1] - g_RT[12] - g_RT[35] + g_RT[46]);
+    Kc = Kc_s[395];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[46]) + (h_RT[12] + h_RT[35]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59648,12 +57145,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[46];
-    k_f = prefactor_units[396] * fwd_A[396]
-                * exp(fwd_beta[396] * tc[0] - activation_units[396] * fwd_Ea[396] * invT);
+    k_f = k_f_s[396];
     dlnkfdT = fwd_beta[396] * invT + activation_units[396] * fwd_Ea[396] * invT2;
     /* reverse */
     phi_r = sc[24]*sc[28];
-    Kc = exp(g_RT[2] - g_RT[24] - g_RT[28] + g_RT[46]);
+    Kc = Kc_s[396];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[46]) + (h_RT[24] + h_RT[28]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59699,12 +57195,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[46];
-    k_f = prefactor_units[397] * fwd_A[397]
-                * exp(fwd_beta[397] * tc[0] - activation_units[397] * fwd_Ea[397] * invT);
+    k_f = k_f_s[397];
     dlnkfdT = fwd_beta[397] * invT + activation_units[397] * fwd_Ea[397] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[44];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[44] + g_RT[46]);
+    Kc = Kc_s[397];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[46]) + (h_RT[4] + h_RT[44]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59750,12 +57245,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[46];
-    k_f = prefactor_units[398] * fwd_A[398]
-                * exp(fwd_beta[398] * tc[0] - activation_units[398] * fwd_Ea[398] * invT);
+    k_f = k_f_s[398];
     dlnkfdT = fwd_beta[398] * invT + activation_units[398] * fwd_Ea[398] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[44];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[44] + g_RT[46]);
+    Kc = Kc_s[398];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[46]) + (h_RT[5] + h_RT[44]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59801,12 +57295,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[46];
-    k_f = prefactor_units[399] * fwd_A[399]
-                * exp(fwd_beta[399] * tc[0] - activation_units[399] * fwd_Ea[399] * invT);
+    k_f = k_f_s[399];
     dlnkfdT = fwd_beta[399] * invT + activation_units[399] * fwd_Ea[399] * invT2;
     /* reverse */
     phi_r = sc[45];
-    Kc = exp(-g_RT[45] + g_RT[46]);
+    Kc = Kc_s[399];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[46]) + (h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59832,12 +57325,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[21]*sc[38];
-    k_f = prefactor_units[400] * fwd_A[400]
-                * exp(fwd_beta[400] * tc[0] - activation_units[400] * fwd_Ea[400] * invT);
+    k_f = k_f_s[400];
     dlnkfdT = fwd_beta[400] * invT + activation_units[400] * fwd_Ea[400] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[49];
-    Kc = exp(-g_RT[1] + g_RT[21] + g_RT[38] - g_RT[49]);
+    Kc = Kc_s[400];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[21] + h_RT[38]) + (h_RT[1] + h_RT[49]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59883,12 +57375,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[21]*sc[38];
-    k_f = prefactor_units[401] * fwd_A[401]
-                * exp(fwd_beta[401] * tc[0] - activation_units[401] * fwd_Ea[401] * invT);
+    k_f = k_f_s[401];
     dlnkfdT = fwd_beta[401] * invT + activation_units[401] * fwd_Ea[401] * invT2;
     /* reverse */
     phi_r = sc[50];
-    Kc = refCinv * exp(g_RT[21] + g_RT[38] - g_RT[50]);
+    Kc = Kc_s[401];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[21] + h_RT[38]) + (h_RT[50]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59923,12 +57414,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[34]*sc[34];
-    k_f = prefactor_units[402] * fwd_A[402]
-                * exp(fwd_beta[402] * tc[0] - activation_units[402] * fwd_Ea[402] * invT);
+    k_f = k_f_s[402];
     dlnkfdT = fwd_beta[402] * invT + activation_units[402] * fwd_Ea[402] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[54];
-    Kc = exp(-g_RT[1] + g_RT[34] + g_RT[34] - g_RT[54]);
+    Kc = Kc_s[402];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[34]) + (h_RT[1] + h_RT[54]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59963,12 +57453,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[34]*sc[34];
-    k_f = prefactor_units[403] * fwd_A[403]
-                * exp(fwd_beta[403] * tc[0] - activation_units[403] * fwd_Ea[403] * invT);
+    k_f = k_f_s[403];
     dlnkfdT = fwd_beta[403] * invT + activation_units[403] * fwd_Ea[403] * invT2;
     /* reverse */
     phi_r = sc[53];
-    Kc = refCinv * exp(g_RT[34] + g_RT[34] - g_RT[53]);
+    Kc = Kc_s[403];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(2*h_RT[34]) + (h_RT[53]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -59994,12 +57483,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[22]*sc[40];
-    k_f = prefactor_units[404] * fwd_A[404]
-                * exp(fwd_beta[404] * tc[0] - activation_units[404] * fwd_Ea[404] * invT);
+    k_f = k_f_s[404];
     dlnkfdT = fwd_beta[404] * invT + activation_units[404] * fwd_Ea[404] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[51];
-    Kc = exp(-g_RT[1] + g_RT[22] + g_RT[40] - g_RT[51]);
+    Kc = Kc_s[404];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[22] + h_RT[40]) + (h_RT[1] + h_RT[51]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60045,12 +57533,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[22]*sc[40];
-    k_f = prefactor_units[405] * fwd_A[405]
-                * exp(fwd_beta[405] * tc[0] - activation_units[405] * fwd_Ea[405] * invT);
+    k_f = k_f_s[405];
     dlnkfdT = fwd_beta[405] * invT + activation_units[405] * fwd_Ea[405] * invT2;
     /* reverse */
     phi_r = sc[54];
-    Kc = refCinv * exp(g_RT[22] + g_RT[40] - g_RT[54]);
+    Kc = Kc_s[405];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[22] + h_RT[40]) + (h_RT[54]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60085,12 +57572,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[22]*sc[40];
-    k_f = prefactor_units[406] * fwd_A[406]
-                * exp(fwd_beta[406] * tc[0] - activation_units[406] * fwd_Ea[406] * invT);
+    k_f = k_f_s[406];
     dlnkfdT = fwd_beta[406] * invT + activation_units[406] * fwd_Ea[406] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[52];
-    Kc = exp(-g_RT[1] + g_RT[22] + g_RT[40] - g_RT[52]);
+    Kc = Kc_s[406];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[22] + h_RT[40]) + (h_RT[1] + h_RT[52]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60136,12 +57622,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[21]*sc[42];
-    k_f = prefactor_units[407] * fwd_A[407]
-                * exp(fwd_beta[407] * tc[0] - activation_units[407] * fwd_Ea[407] * invT);
+    k_f = k_f_s[407];
     dlnkfdT = fwd_beta[407] * invT + activation_units[407] * fwd_Ea[407] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[51];
-    Kc = exp(-g_RT[1] + g_RT[21] + g_RT[42] - g_RT[51]);
+    Kc = Kc_s[407];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[21] + h_RT[42]) + (h_RT[1] + h_RT[51]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60187,12 +57672,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[22]*sc[43];
-    k_f = prefactor_units[408] * fwd_A[408]
-                * exp(fwd_beta[408] * tc[0] - activation_units[408] * fwd_Ea[408] * invT);
+    k_f = k_f_s[408];
     dlnkfdT = fwd_beta[408] * invT + activation_units[408] * fwd_Ea[408] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[53];
-    Kc = exp(-g_RT[1] + g_RT[22] + g_RT[43] - g_RT[53]);
+    Kc = Kc_s[408];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[22] + h_RT[43]) + (h_RT[1] + h_RT[53]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60238,12 +57722,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[49];
-    k_f = prefactor_units[409] * fwd_A[409]
-                * exp(fwd_beta[409] * tc[0] - activation_units[409] * fwd_Ea[409] * invT);
+    k_f = k_f_s[409];
     dlnkfdT = fwd_beta[409] * invT + activation_units[409] * fwd_Ea[409] * invT2;
     /* reverse */
     phi_r = sc[50];
-    Kc = refCinv * exp(g_RT[1] + g_RT[49] - g_RT[50]);
+    Kc = Kc_s[409];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[49]) + (h_RT[50]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60278,12 +57761,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[50];
-    k_f = prefactor_units[410] * fwd_A[410]
-                * exp(fwd_beta[410] * tc[0] - activation_units[410] * fwd_Ea[410] * invT);
+    k_f = k_f_s[410];
     dlnkfdT = fwd_beta[410] * invT + activation_units[410] * fwd_Ea[410] * invT2;
     /* reverse */
     phi_r = sc[22]*sc[38];
-    Kc = exp(g_RT[1] - g_RT[22] - g_RT[38] + g_RT[50]);
+    Kc = Kc_s[410];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[50]) + (h_RT[22] + h_RT[38]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60329,12 +57811,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[50];
-    k_f = prefactor_units[411] * fwd_A[411]
-                * exp(fwd_beta[411] * tc[0] - activation_units[411] * fwd_Ea[411] * invT);
+    k_f = k_f_s[411];
     dlnkfdT = fwd_beta[411] * invT + activation_units[411] * fwd_Ea[411] * invT2;
     /* reverse */
     phi_r = sc[51];
-    Kc = refCinv * exp(g_RT[1] + g_RT[50] - g_RT[51]);
+    Kc = Kc_s[411];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[50]) + (h_RT[51]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60369,12 +57850,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[50];
-    k_f = prefactor_units[412] * fwd_A[412]
-                * exp(fwd_beta[412] * tc[0] - activation_units[412] * fwd_Ea[412] * invT);
+    k_f = k_f_s[412];
     dlnkfdT = fwd_beta[412] * invT + activation_units[412] * fwd_Ea[412] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[49];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[49] + g_RT[50]);
+    Kc = Kc_s[412];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[50]) + (h_RT[0] + h_RT[49]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60420,12 +57900,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[50];
-    k_f = prefactor_units[413] * fwd_A[413]
-                * exp(fwd_beta[413] * tc[0] - activation_units[413] * fwd_Ea[413] * invT);
+    k_f = k_f_s[413];
     dlnkfdT = fwd_beta[413] * invT + activation_units[413] * fwd_Ea[413] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[49];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[49] + g_RT[50]);
+    Kc = Kc_s[413];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[50]) + (h_RT[5] + h_RT[49]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60471,12 +57950,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[50];
-    k_f = prefactor_units[414] * fwd_A[414]
-                * exp(fwd_beta[414] * tc[0] - activation_units[414] * fwd_Ea[414] * invT);
+    k_f = k_f_s[414];
     dlnkfdT = fwd_beta[414] * invT + activation_units[414] * fwd_Ea[414] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[27]*sc[33];
-    Kc = refC * exp(g_RT[3] - g_RT[14] - g_RT[27] - g_RT[33] + g_RT[50]);
+    Kc = Kc_s[414];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[50]) + (h_RT[14] + h_RT[27] + h_RT[33]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60535,12 +58013,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[51];
-    k_f = prefactor_units[415] * fwd_A[415]
-                * exp(fwd_beta[415] * tc[0] - activation_units[415] * fwd_Ea[415] * invT);
+    k_f = k_f_s[415];
     dlnkfdT = fwd_beta[415] * invT + activation_units[415] * fwd_Ea[415] * invT2;
     /* reverse */
     phi_r = sc[54];
-    Kc = refCinv * exp(g_RT[1] + g_RT[51] - g_RT[54]);
+    Kc = Kc_s[415];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[51]) + (h_RT[54]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60575,12 +58052,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[51];
-    k_f = prefactor_units[416] * fwd_A[416]
-                * exp(fwd_beta[416] * tc[0] - activation_units[416] * fwd_Ea[416] * invT);
+    k_f = k_f_s[416];
     dlnkfdT = fwd_beta[416] * invT + activation_units[416] * fwd_Ea[416] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[52];
-    Kc = exp(g_RT[1] - g_RT[1] + g_RT[51] - g_RT[52]);
+    Kc = Kc_s[416];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[51]) + (h_RT[1] + h_RT[52]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60610,12 +58086,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[51];
-    k_f = prefactor_units[417] * fwd_A[417]
-                * exp(fwd_beta[417] * tc[0] - activation_units[417] * fwd_Ea[417] * invT);
+    k_f = k_f_s[417];
     dlnkfdT = fwd_beta[417] * invT + activation_units[417] * fwd_Ea[417] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[50];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[50] + g_RT[51]);
+    Kc = Kc_s[417];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[51]) + (h_RT[0] + h_RT[50]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60661,12 +58136,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[51];
-    k_f = prefactor_units[418] * fwd_A[418]
-                * exp(fwd_beta[418] * tc[0] - activation_units[418] * fwd_Ea[418] * invT);
+    k_f = k_f_s[418];
     dlnkfdT = fwd_beta[418] * invT + activation_units[418] * fwd_Ea[418] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[50];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[50] + g_RT[51]);
+    Kc = Kc_s[418];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[51]) + (h_RT[5] + h_RT[50]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60712,12 +58186,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[52];
-    k_f = prefactor_units[419] * fwd_A[419]
-                * exp(fwd_beta[419] * tc[0] - activation_units[419] * fwd_Ea[419] * invT);
+    k_f = k_f_s[419];
     dlnkfdT = fwd_beta[419] * invT + activation_units[419] * fwd_Ea[419] * invT2;
     /* reverse */
     phi_r = sc[54];
-    Kc = refCinv * exp(g_RT[1] + g_RT[52] - g_RT[54]);
+    Kc = Kc_s[419];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[52]) + (h_RT[54]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60752,12 +58225,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[53];
-    k_f = prefactor_units[420] * fwd_A[420]
-                * exp(fwd_beta[420] * tc[0] - activation_units[420] * fwd_Ea[420] * invT);
+    k_f = k_f_s[420];
     dlnkfdT = fwd_beta[420] * invT + activation_units[420] * fwd_Ea[420] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[54];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[53] - g_RT[54]);
+    Kc = Kc_s[420];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[53]) + (h_RT[0] + h_RT[54]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60803,12 +58275,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[53];
-    k_f = prefactor_units[421] * fwd_A[421]
-                * exp(fwd_beta[421] * tc[0] - activation_units[421] * fwd_Ea[421] * invT);
+    k_f = k_f_s[421];
     dlnkfdT = fwd_beta[421] * invT + activation_units[421] * fwd_Ea[421] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[54];
-    Kc = exp(g_RT[4] - g_RT[5] + g_RT[53] - g_RT[54]);
+    Kc = Kc_s[421];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[53]) + (h_RT[5] + h_RT[54]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60854,12 +58325,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[53];
-    k_f = prefactor_units[422] * fwd_A[422]
-                * exp(fwd_beta[422] * tc[0] - activation_units[422] * fwd_Ea[422] * invT);
+    k_f = k_f_s[422];
     dlnkfdT = fwd_beta[422] * invT + activation_units[422] * fwd_Ea[422] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[55];
-    Kc = exp(-g_RT[1] + g_RT[2] + g_RT[53] - g_RT[55]);
+    Kc = Kc_s[422];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[53]) + (h_RT[1] + h_RT[55]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60905,12 +58375,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[53];
-    k_f = prefactor_units[423] * fwd_A[423]
-                * exp(fwd_beta[423] * tc[0] - activation_units[423] * fwd_Ea[423] * invT);
+    k_f = k_f_s[423];
     dlnkfdT = fwd_beta[423] * invT + activation_units[423] * fwd_Ea[423] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[56];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[53] - g_RT[56]);
+    Kc = Kc_s[423];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[53]) + (h_RT[1] + h_RT[56]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -60956,12 +58425,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[54];
-    k_f = prefactor_units[424] * fwd_A[424]
-                * exp(fwd_beta[424] * tc[0] - activation_units[424] * fwd_Ea[424] * invT);
+    k_f = k_f_s[424];
     dlnkfdT = fwd_beta[424] * invT + activation_units[424] * fwd_Ea[424] * invT2;
     /* reverse */
     phi_r = sc[2]*sc[55];
-    Kc = exp(-g_RT[2] + g_RT[3] + g_RT[54] - g_RT[55]);
+    Kc = Kc_s[424];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[54]) + (h_RT[2] + h_RT[55]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61007,12 +58475,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[55];
-    k_f = prefactor_units[425] * fwd_A[425]
-                * exp(fwd_beta[425] * tc[0] - activation_units[425] * fwd_Ea[425] * invT);
+    k_f = k_f_s[425];
     dlnkfdT = fwd_beta[425] * invT + activation_units[425] * fwd_Ea[425] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[58];
-    Kc = refC * exp(-g_RT[14] + g_RT[55] - g_RT[58]);
+    Kc = Kc_s[425];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[55]) + (h_RT[14] + h_RT[58]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61047,12 +58514,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[55];
-    k_f = prefactor_units[426] * fwd_A[426]
-                * exp(fwd_beta[426] * tc[0] - activation_units[426] * fwd_Ea[426] * invT);
+    k_f = k_f_s[426];
     dlnkfdT = fwd_beta[426] * invT + activation_units[426] * fwd_Ea[426] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[57];
-    Kc = exp(g_RT[1] - g_RT[14] + g_RT[55] - g_RT[57]);
+    Kc = Kc_s[426];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[55]) + (h_RT[14] + h_RT[57]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61098,12 +58564,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[55];
-    k_f = prefactor_units[427] * fwd_A[427]
-                * exp(fwd_beta[427] * tc[0] - activation_units[427] * fwd_Ea[427] * invT);
+    k_f = k_f_s[427];
     dlnkfdT = fwd_beta[427] * invT + activation_units[427] * fwd_Ea[427] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[16]*sc[22]*sc[22];
-    Kc = refC*refC * exp(g_RT[2] - g_RT[14] - g_RT[16] - 2*g_RT[22] + g_RT[55]);
+    Kc = Kc_s[427];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[55]) + (h_RT[14] + h_RT[16] + 2*h_RT[22]) - 2);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61162,12 +58627,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[56];
-    k_f = prefactor_units[428] * fwd_A[428]
-                * exp(fwd_beta[428] * tc[0] - activation_units[428] * fwd_Ea[428] * invT);
+    k_f = k_f_s[428];
     dlnkfdT = fwd_beta[428] * invT + activation_units[428] * fwd_Ea[428] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[55];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[55] + g_RT[56]);
+    Kc = Kc_s[428];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[56]) + (h_RT[0] + h_RT[55]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61213,12 +58677,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[56];
-    k_f = prefactor_units[429] * fwd_A[429]
-                * exp(fwd_beta[429] * tc[0] - activation_units[429] * fwd_Ea[429] * invT);
+    k_f = k_f_s[429];
     dlnkfdT = fwd_beta[429] * invT + activation_units[429] * fwd_Ea[429] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[55];
-    Kc = exp(g_RT[2] - g_RT[4] - g_RT[55] + g_RT[56]);
+    Kc = Kc_s[429];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[56]) + (h_RT[4] + h_RT[55]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61264,12 +58727,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[56];
-    k_f = prefactor_units[430] * fwd_A[430]
-                * exp(fwd_beta[430] * tc[0] - activation_units[430] * fwd_Ea[430] * invT);
+    k_f = k_f_s[430];
     dlnkfdT = fwd_beta[430] * invT + activation_units[430] * fwd_Ea[430] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[55];
-    Kc = exp(g_RT[4] - g_RT[5] - g_RT[55] + g_RT[56]);
+    Kc = Kc_s[430];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[56]) + (h_RT[5] + h_RT[55]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61315,12 +58777,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[58];
-    k_f = prefactor_units[431] * fwd_A[431]
-                * exp(fwd_beta[431] * tc[0] - activation_units[431] * fwd_Ea[431] * invT);
+    k_f = k_f_s[431];
     dlnkfdT = fwd_beta[431] * invT + activation_units[431] * fwd_Ea[431] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[43];
-    Kc = exp(g_RT[2] - g_RT[14] - g_RT[43] + g_RT[58]);
+    Kc = Kc_s[431];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[58]) + (h_RT[14] + h_RT[43]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61366,12 +58827,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[58];
-    k_f = prefactor_units[432] * fwd_A[432]
-                * exp(fwd_beta[432] * tc[0] - activation_units[432] * fwd_Ea[432] * invT);
+    k_f = k_f_s[432];
     dlnkfdT = fwd_beta[432] * invT + activation_units[432] * fwd_Ea[432] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[60];
-    Kc = exp(-g_RT[1] + g_RT[4] + g_RT[58] - g_RT[60]);
+    Kc = Kc_s[432];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[58]) + (h_RT[1] + h_RT[60]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61417,12 +58877,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[58];
-    k_f = prefactor_units[433] * fwd_A[433]
-                * exp(fwd_beta[433] * tc[0] - activation_units[433] * fwd_Ea[433] * invT);
+    k_f = k_f_s[433];
     dlnkfdT = fwd_beta[433] * invT + activation_units[433] * fwd_Ea[433] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[59];
-    Kc = exp(-g_RT[4] + g_RT[6] + g_RT[58] - g_RT[59]);
+    Kc = Kc_s[433];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[58]) + (h_RT[4] + h_RT[59]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61468,12 +58927,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[57];
-    k_f = prefactor_units[434] * fwd_A[434]
-                * exp(fwd_beta[434] * tc[0] - activation_units[434] * fwd_Ea[434] * invT);
+    k_f = k_f_s[434];
     dlnkfdT = fwd_beta[434] * invT + activation_units[434] * fwd_Ea[434] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[58];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[57] - g_RT[58]);
+    Kc = Kc_s[434];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[57]) + (h_RT[0] + h_RT[58]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61519,12 +58977,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[57];
-    k_f = prefactor_units[435] * fwd_A[435]
-                * exp(fwd_beta[435] * tc[0] - activation_units[435] * fwd_Ea[435] * invT);
+    k_f = k_f_s[435];
     dlnkfdT = fwd_beta[435] * invT + activation_units[435] * fwd_Ea[435] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[58];
-    Kc = exp(g_RT[2] - g_RT[4] + g_RT[57] - g_RT[58]);
+    Kc = Kc_s[435];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[57]) + (h_RT[4] + h_RT[58]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61570,12 +59027,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[57];
-    k_f = prefactor_units[436] * fwd_A[436]
-                * exp(fwd_beta[436] * tc[0] - activation_units[436] * fwd_Ea[436] * invT);
+    k_f = k_f_s[436];
     dlnkfdT = fwd_beta[436] * invT + activation_units[436] * fwd_Ea[436] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[58];
-    Kc = exp(g_RT[4] - g_RT[5] + g_RT[57] - g_RT[58]);
+    Kc = Kc_s[436];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[57]) + (h_RT[5] + h_RT[58]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61621,12 +59077,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[59];
-    k_f = prefactor_units[437] * fwd_A[437]
-                * exp(fwd_beta[437] * tc[0] - activation_units[437] * fwd_Ea[437] * invT);
+    k_f = k_f_s[437];
     dlnkfdT = fwd_beta[437] * invT + activation_units[437] * fwd_Ea[437] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[43];
-    Kc = refC * exp(-g_RT[14] - g_RT[43] + g_RT[59]);
+    Kc = Kc_s[437];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[59]) + (h_RT[14] + h_RT[43]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61661,12 +59116,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[59];
-    k_f = prefactor_units[438] * fwd_A[438]
-                * exp(fwd_beta[438] * tc[0] - activation_units[438] * fwd_Ea[438] * invT);
+    k_f = k_f_s[438];
     dlnkfdT = fwd_beta[438] * invT + activation_units[438] * fwd_Ea[438] * invT2;
     /* reverse */
     phi_r = sc[17]*sc[22]*sc[22];
-    Kc = refC * exp(g_RT[1] - g_RT[17] - 2*g_RT[22] + g_RT[59]);
+    Kc = Kc_s[438];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[59]) + (h_RT[17] + 2*h_RT[22]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61712,12 +59166,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[59];
-    k_f = prefactor_units[439] * fwd_A[439]
-                * exp(fwd_beta[439] * tc[0] - activation_units[439] * fwd_Ea[439] * invT);
+    k_f = k_f_s[439];
     dlnkfdT = fwd_beta[439] * invT + activation_units[439] * fwd_Ea[439] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[43];
-    Kc = exp(g_RT[2] - g_RT[15] - g_RT[43] + g_RT[59]);
+    Kc = Kc_s[439];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[59]) + (h_RT[15] + h_RT[43]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61763,12 +59216,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[60];
-    k_f = prefactor_units[440] * fwd_A[440]
-                * exp(fwd_beta[440] * tc[0] - activation_units[440] * fwd_Ea[440] * invT);
+    k_f = k_f_s[440];
     dlnkfdT = fwd_beta[440] * invT + activation_units[440] * fwd_Ea[440] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[61];
-    Kc = refC * exp(-g_RT[1] + g_RT[60] - g_RT[61]);
+    Kc = Kc_s[440];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[60]) + (h_RT[1] + h_RT[61]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61803,12 +59255,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[60];
-    k_f = prefactor_units[441] * fwd_A[441]
-                * exp(fwd_beta[441] * tc[0] - activation_units[441] * fwd_Ea[441] * invT);
+    k_f = k_f_s[441];
     dlnkfdT = fwd_beta[441] * invT + activation_units[441] * fwd_Ea[441] * invT2;
     /* reverse */
     phi_r = sc[17]*sc[22]*sc[22];
-    Kc = refC * exp(g_RT[1] - g_RT[17] - 2*g_RT[22] + g_RT[60]);
+    Kc = Kc_s[441];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[60]) + (h_RT[17] + 2*h_RT[22]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61854,12 +59305,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[60];
-    k_f = prefactor_units[442] * fwd_A[442]
-                * exp(fwd_beta[442] * tc[0] - activation_units[442] * fwd_Ea[442] * invT);
+    k_f = k_f_s[442];
     dlnkfdT = fwd_beta[442] * invT + activation_units[442] * fwd_Ea[442] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[43];
-    Kc = exp(g_RT[2] - g_RT[15] - g_RT[43] + g_RT[60]);
+    Kc = Kc_s[442];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[60]) + (h_RT[15] + h_RT[43]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61905,12 +59355,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[61];
-    k_f = prefactor_units[443] * fwd_A[443]
-                * exp(fwd_beta[443] * tc[0] - activation_units[443] * fwd_Ea[443] * invT);
+    k_f = k_f_s[443];
     dlnkfdT = fwd_beta[443] * invT + activation_units[443] * fwd_Ea[443] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[22]*sc[22];
-    Kc = refC*refC * exp(-g_RT[14] - g_RT[22] - g_RT[22] + g_RT[61]);
+    Kc = Kc_s[443];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[61]) + (h_RT[14] + 2*h_RT[22]) - 2);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61945,12 +59394,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[61];
-    k_f = prefactor_units[444] * fwd_A[444]
-                * exp(fwd_beta[444] * tc[0] - activation_units[444] * fwd_Ea[444] * invT);
+    k_f = k_f_s[444];
     dlnkfdT = fwd_beta[444] * invT + activation_units[444] * fwd_Ea[444] * invT2;
     /* reverse */
     phi_r = sc[15]*sc[22]*sc[22];
-    Kc = refC * exp(g_RT[2] - g_RT[15] - 2*g_RT[22] + g_RT[61]);
+    Kc = Kc_s[444];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[61]) + (h_RT[15] + 2*h_RT[22]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -61996,12 +59444,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[47];
-    k_f = prefactor_units[445] * fwd_A[445]
-                * exp(fwd_beta[445] * tc[0] - activation_units[445] * fwd_Ea[445] * invT);
+    k_f = k_f_s[445];
     dlnkfdT = fwd_beta[445] * invT + activation_units[445] * fwd_Ea[445] * invT2;
     /* reverse */
     phi_r = sc[24]*sc[25];
-    Kc = exp(g_RT[1] - g_RT[24] - g_RT[25] + g_RT[47]);
+    Kc = Kc_s[445];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[47]) + (h_RT[24] + h_RT[25]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62047,12 +59494,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[47];
-    k_f = prefactor_units[446] * fwd_A[446]
-                * exp(fwd_beta[446] * tc[0] - activation_units[446] * fwd_Ea[446] * invT);
+    k_f = k_f_s[446];
     dlnkfdT = fwd_beta[446] * invT + activation_units[446] * fwd_Ea[446] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[65];
-    Kc = exp(g_RT[1] - g_RT[12] + g_RT[47] - g_RT[65]);
+    Kc = Kc_s[446];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[47]) + (h_RT[12] + h_RT[65]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62098,12 +59544,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[47];
-    k_f = prefactor_units[447] * fwd_A[447]
-                * exp(fwd_beta[447] * tc[0] - activation_units[447] * fwd_Ea[447] * invT);
+    k_f = k_f_s[447];
     dlnkfdT = fwd_beta[447] * invT + activation_units[447] * fwd_Ea[447] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[48];
-    Kc = exp(-g_RT[0] + g_RT[1] + g_RT[47] - g_RT[48]);
+    Kc = Kc_s[447];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[47]) + (h_RT[0] + h_RT[48]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62149,12 +59594,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[47];
-    k_f = prefactor_units[448] * fwd_A[448]
-                * exp(fwd_beta[448] * tc[0] - activation_units[448] * fwd_Ea[448] * invT);
+    k_f = k_f_s[448];
     dlnkfdT = fwd_beta[448] * invT + activation_units[448] * fwd_Ea[448] * invT2;
     /* reverse */
     phi_r = sc[16]*sc[63];
-    Kc = exp(g_RT[2] - g_RT[16] + g_RT[47] - g_RT[63]);
+    Kc = Kc_s[448];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[47]) + (h_RT[16] + h_RT[63]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62200,12 +59644,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[47];
-    k_f = prefactor_units[449] * fwd_A[449]
-                * exp(fwd_beta[449] * tc[0] - activation_units[449] * fwd_Ea[449] * invT);
+    k_f = k_f_s[449];
     dlnkfdT = fwd_beta[449] * invT + activation_units[449] * fwd_Ea[449] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[48];
-    Kc = exp(g_RT[2] - g_RT[4] + g_RT[47] - g_RT[48]);
+    Kc = Kc_s[449];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[47]) + (h_RT[4] + h_RT[48]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62251,12 +59694,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[2]*sc[47];
-    k_f = prefactor_units[450] * fwd_A[450]
-                * exp(fwd_beta[450] * tc[0] - activation_units[450] * fwd_Ea[450] * invT);
+    k_f = k_f_s[450];
     dlnkfdT = fwd_beta[450] * invT + activation_units[450] * fwd_Ea[450] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[48];
-    Kc = exp(g_RT[2] - g_RT[4] + g_RT[47] - g_RT[48]);
+    Kc = Kc_s[450];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[2] + h_RT[47]) + (h_RT[4] + h_RT[48]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62302,12 +59744,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[4]*sc[47];
-    k_f = prefactor_units[451] * fwd_A[451]
-                * exp(fwd_beta[451] * tc[0] - activation_units[451] * fwd_Ea[451] * invT);
+    k_f = k_f_s[451];
     dlnkfdT = fwd_beta[451] * invT + activation_units[451] * fwd_Ea[451] * invT2;
     /* reverse */
     phi_r = sc[5]*sc[48];
-    Kc = exp(g_RT[4] - g_RT[5] + g_RT[47] - g_RT[48]);
+    Kc = Kc_s[451];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[4] + h_RT[47]) + (h_RT[5] + h_RT[48]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62353,12 +59794,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[47];
-    k_f = prefactor_units[452] * fwd_A[452]
-                * exp(fwd_beta[452] * tc[0] - activation_units[452] * fwd_Ea[452] * invT);
+    k_f = k_f_s[452];
     dlnkfdT = fwd_beta[452] * invT + activation_units[452] * fwd_Ea[452] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[48];
-    Kc = exp(g_RT[3] - g_RT[6] + g_RT[47] - g_RT[48]);
+    Kc = Kc_s[452];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[47]) + (h_RT[6] + h_RT[48]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62404,12 +59844,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[47];
-    k_f = prefactor_units[453] * fwd_A[453]
-                * exp(fwd_beta[453] * tc[0] - activation_units[453] * fwd_Ea[453] * invT);
+    k_f = k_f_s[453];
     dlnkfdT = fwd_beta[453] * invT + activation_units[453] * fwd_Ea[453] * invT2;
     /* reverse */
     phi_r = sc[7]*sc[48];
-    Kc = exp(g_RT[6] - g_RT[7] + g_RT[47] - g_RT[48]);
+    Kc = Kc_s[453];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[47]) + (h_RT[7] + h_RT[48]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62455,12 +59894,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[47];
-    k_f = prefactor_units[454] * fwd_A[454]
-                * exp(fwd_beta[454] * tc[0] - activation_units[454] * fwd_Ea[454] * invT);
+    k_f = k_f_s[454];
     dlnkfdT = fwd_beta[454] * invT + activation_units[454] * fwd_Ea[454] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[48];
-    Kc = exp(g_RT[12] - g_RT[13] + g_RT[47] - g_RT[48]);
+    Kc = Kc_s[454];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[47]) + (h_RT[13] + h_RT[48]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62506,12 +59944,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[48];
-    k_f = prefactor_units[455] * fwd_A[455]
-                * exp(fwd_beta[455] * tc[0] - activation_units[455] * fwd_Ea[455] * invT);
+    k_f = k_f_s[455];
     dlnkfdT = fwd_beta[455] * invT + activation_units[455] * fwd_Ea[455] * invT2;
     /* reverse */
     phi_r = sc[1]*sc[45];
-    Kc = refC * exp(-g_RT[1] - g_RT[45] + g_RT[48]);
+    Kc = Kc_s[455];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[48]) + (h_RT[1] + h_RT[45]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62546,12 +59983,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[48];
-    k_f = prefactor_units[456] * fwd_A[456]
-                * exp(fwd_beta[456] * tc[0] - activation_units[456] * fwd_Ea[456] * invT);
+    k_f = k_f_s[456];
     dlnkfdT = fwd_beta[456] * invT + activation_units[456] * fwd_Ea[456] * invT2;
     /* reverse */
     phi_r = sc[12]*sc[66];
-    Kc = exp(g_RT[1] - g_RT[12] + g_RT[48] - g_RT[66]);
+    Kc = Kc_s[456];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[48]) + (h_RT[12] + h_RT[66]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62597,12 +60033,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[1]*sc[48];
-    k_f = prefactor_units[457] * fwd_A[457]
-                * exp(fwd_beta[457] * tc[0] - activation_units[457] * fwd_Ea[457] * invT);
+    k_f = k_f_s[457];
     dlnkfdT = fwd_beta[457] * invT + activation_units[457] * fwd_Ea[457] * invT2;
     /* reverse */
     phi_r = sc[0]*sc[45];
-    Kc = exp(-g_RT[0] + g_RT[1] - g_RT[45] + g_RT[48]);
+    Kc = Kc_s[457];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[1] + h_RT[48]) + (h_RT[0] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62648,12 +60083,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[3]*sc[48];
-    k_f = prefactor_units[458] * fwd_A[458]
-                * exp(fwd_beta[458] * tc[0] - activation_units[458] * fwd_Ea[458] * invT);
+    k_f = k_f_s[458];
     dlnkfdT = fwd_beta[458] * invT + activation_units[458] * fwd_Ea[458] * invT2;
     /* reverse */
     phi_r = sc[6]*sc[45];
-    Kc = exp(g_RT[3] - g_RT[6] - g_RT[45] + g_RT[48]);
+    Kc = Kc_s[458];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[3] + h_RT[48]) + (h_RT[6] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62699,12 +60133,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[6]*sc[48];
-    k_f = prefactor_units[459] * fwd_A[459]
-                * exp(fwd_beta[459] * tc[0] - activation_units[459] * fwd_Ea[459] * invT);
+    k_f = k_f_s[459];
     dlnkfdT = fwd_beta[459] * invT + activation_units[459] * fwd_Ea[459] * invT2;
     /* reverse */
     phi_r = sc[4]*sc[17]*sc[66];
-    Kc = refC * exp(-g_RT[4] + g_RT[6] - g_RT[17] + g_RT[48] - g_RT[66]);
+    Kc = Kc_s[459];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[6] + h_RT[48]) + (h_RT[4] + h_RT[17] + h_RT[66]) - 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62763,12 +60196,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[16]*sc[48];
-    k_f = prefactor_units[460] * fwd_A[460]
-                * exp(fwd_beta[460] * tc[0] - activation_units[460] * fwd_Ea[460] * invT);
+    k_f = k_f_s[460];
     dlnkfdT = fwd_beta[460] * invT + activation_units[460] * fwd_Ea[460] * invT2;
     /* reverse */
     phi_r = sc[14]*sc[47];
-    Kc = exp(-g_RT[14] + g_RT[16] - g_RT[47] + g_RT[48]);
+    Kc = Kc_s[460];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[16] + h_RT[48]) + (h_RT[14] + h_RT[47]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62814,12 +60246,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[12]*sc[48];
-    k_f = prefactor_units[461] * fwd_A[461]
-                * exp(fwd_beta[461] * tc[0] - activation_units[461] * fwd_Ea[461] * invT);
+    k_f = k_f_s[461];
     dlnkfdT = fwd_beta[461] * invT + activation_units[461] * fwd_Ea[461] * invT2;
     /* reverse */
     phi_r = sc[13]*sc[45];
-    Kc = exp(g_RT[12] - g_RT[13] - g_RT[45] + g_RT[48]);
+    Kc = Kc_s[461];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[12] + h_RT[48]) + (h_RT[13] + h_RT[45]));
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62865,12 +60296,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
     /*a non-third-body and non-pressure-fall-off reaction */
     /* forward */
     phi_f = sc[23]*sc[24];
-    k_f = prefactor_units[462] * fwd_A[462]
-                * exp(fwd_beta[462] * tc[0] - activation_units[462] * fwd_Ea[462] * invT);
+    k_f = k_f_s[462];
     dlnkfdT = fwd_beta[462] * invT + activation_units[462] * fwd_Ea[462] * invT2;
     /* reverse */
     phi_r = sc[48];
-    Kc = refCinv * exp(g_RT[23] + g_RT[24] - g_RT[48]);
+    Kc = Kc_s[462];
     k_r = k_f / Kc;
     dlnKcdT = invT * (-(h_RT[23] + h_RT[24]) + (h_RT[48]) + 1);
     dkrdT = (dlnkfdT - dlnKcdT)*k_r;
@@ -62913,6 +60343,11 @@ void aJacobian(double * restrict J, double * restrict sc, double T, int consP)
         dcvpRdT(dcRdT, tc);
         speciesInternalEnergy(e_RT, tc);
         eh_RT = &e_RT[0];
+        for (int k=0; k<70; k++) {
+            for (int m=0; m<70; m++) {
+                J[k*71+m] += Jmix[m];
+            }
+        }
     }
 
     double cmix = 0.0, ehmix = 0.0, dcmixdT=0.0, dehmixdT=0.0;
@@ -73333,6 +70768,55 @@ void GET_T_GIVEN_EY(double * restrict e, double * restrict y, int * iwrk, double
     *ierr = 0;
     return;
 }
+/* get temperature given enthalpy in mass units and mass fracs */
+void GET_T_GIVEN_HY(double * restrict h, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict t, int * ierr)
+{
+#ifdef CONVERGENCE
+    const int maxiter = 5000;
+    const double tol  = 1.e-12;
+#else
+    const int maxiter = 200;
+    const double tol  = 1.e-6;
+#endif
+    double hin  = *h;
+    double tmin = 250;/*max lower bound for thermo def */
+    double tmax = 4000;/*min upper bound for thermo def */
+    double h1,hmin,hmax,cp,t1,dt;
+    int i;/* loop counter */
+    CKHBMS(&tmin, y, iwrk, rwrk, &hmin);
+    CKHBMS(&tmax, y, iwrk, rwrk, &hmax);
+    if (hin < hmin) {
+        /*Linear Extrapolation below tmin */
+        CKCPBS(&tmin, y, iwrk, rwrk, &cp);
+        *t = tmin - (hmin-hin)/cp;
+        *ierr = 1;
+        return;
+    }
+    if (hin > hmax) {
+        /*Linear Extrapolation above tmax */
+        CKCPBS(&tmax, y, iwrk, rwrk, &cp);
+        *t = tmax - (hmax-hin)/cp;
+        *ierr = 1;
+        return;
+    }
+    t1 = *t;
+    if (t1 < tmin || t1 > tmax) {
+        t1 = tmin + (tmax-tmin)/(hmax-hmin)*(hin-hmin);
+    }
+    for (i = 0; i < maxiter; ++i) {
+        CKHBMS(&t1,y,iwrk,rwrk,&h1);
+        CKCPBS(&t1,y,iwrk,rwrk,&cp);
+        dt = (hin - h1) / cp;
+        if (dt > 100.) { dt = 100.; }
+        else if (dt < -100.) { dt = -100.; }
+        else if (fabs(dt) < tol) break;
+        else if (t1+dt == t1) break;
+        t1 += dt;
+    }
+    *t = t1;
+    *ierr = 0;
+    return;
+}
 
 /* End of file  */
 
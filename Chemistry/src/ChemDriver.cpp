@@ -356,6 +356,24 @@ ChemDriver::set_max_vode_subcycles(int maxcyc)
     FORT_SETVODESUBCYC(&maxcyc);
 }
 
+void
+ChemDriver::set_vode_tols(Real rtol, Real atol, int itol)
+{
+    FORT_SETVODETOLS(&rtol,&atol,&itol);
+}
+
+Real
+ChemDriver::numVodeJacobians() const
+{
+    return FORT_GETVODENJE();
+}
+
+void
+ChemDriver::resetVodeJacobianCount()
+{
+    FORT_RESETVODENJE();
+}
+
 void
 ChemDriver::set_species_Yscales(const std::string& scalesFile)
 {
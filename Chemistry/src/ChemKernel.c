@@ -0,0 +1,599 @@
+#include <math.h>
+#include <string.h>
+
+#include <ChemKernel.H>
+
+/* species thermodynamics of the generated mechanism */
+void gibbs(double * restrict species, double * restrict tc);
+void speciesEnthalpy(double * restrict species, double * restrict tc);
+void speciesInternalEnergy(double * restrict species, double * restrict tc);
+void cp_R(double * restrict species, double * restrict tc);
+void cv_R(double * restrict species, double * restrict tc);
+void dcvpRdT(double * restrict species, double * restrict tc);
+
+static double
+third_body(const ckt_mech *m, int r, const double * restrict sc, double mixture)
+{
+    if (m->nTB[r] > 0) {
+        double alpha = mixture;
+        for (int j = 0; j < m->nTB[r]; ++j) {
+            alpha += (m->TB[r][j] - 1) * sc[m->TBid[r][j]];
+        }
+        return alpha;
+    }
+    if (m->tb_species[r] >= 0) {
+        return sc[m->tb_species[r]];
+    }
+    return mixture;
+}
+
+/* phase space factor of a reactant or product list */
+static double
+phase_space(const int *spec, const int *nu, int lo, int hi, const double * restrict sc)
+{
+    double phi = 1.0;
+    for (int j = lo; j < hi; ++j) {
+        for (int n = 0; n < nu[j]; ++n) {
+            phi *= sc[spec[j]];
+        }
+    }
+    return phi;
+}
+
+/* its derivative with respect to the concentration of species s */
+static double
+dphase_space(const int *spec, const int *nu, int lo, int hi, const double * restrict sc, int s)
+{
+    double dphi = 1.0;
+    for (int j = lo; j < hi; ++j) {
+        if (spec[j] == s) {
+            dphi *= nu[j];
+            for (int n = 1; n < nu[j]; ++n) {
+                dphi *= sc[spec[j]];
+            }
+        }
+        else {
+            for (int n = 0; n < nu[j]; ++n) {
+                dphi *= sc[spec[j]];
+            }
+        }
+    }
+    return dphi;
+}
+
+/* adds the d(wdot)/d[X_k] of reaction r for d(q)/d[X_k] = dqdc, or the
+   d(wdot)/dT for k = nspec */
+static inline void
+add_dqdc(const ckt_mech *m, double * restrict J, int ld, int r, int k, double dqdc)
+{
+    for (int i = m->rea_ptr[r]; i < m->rea_ptr[r+1]; ++i) {
+        J[k*ld+m->rea_spec[i]] -= m->rea_nu[i] * dqdc;
+    }
+    for (int i = m->pro_ptr[r]; i < m->pro_ptr[r+1]; ++i) {
+        J[k*ld+m->pro_spec[i]] += m->pro_nu[i] * dqdc;
+    }
+}
+
+static double
+Kc_exponent(const ckt_mech *m, int r, const double *g_RT, int *dim)
+{
+    double arg = 0.0;
+    *dim = 0;
+    for (int j = m->rea_ptr[r]; j < m->rea_ptr[r+1]; ++j) {
+        arg += m->rea_nu[j] * g_RT[m->rea_spec[j]];
+        *dim -= m->rea_nu[j];
+    }
+    for (int j = m->pro_ptr[r]; j < m->pro_ptr[r+1]; ++j) {
+        arg -= m->pro_nu[j] * g_RT[m->pro_spec[j]];
+        *dim += m->pro_nu[j];
+    }
+    return arg;
+}
+
+static double
+refC_power(double refC, int dim)
+{
+    double f = 1.0;
+    for (int n = 0; n < dim; ++n) {
+        f *= refC;
+    }
+    for (int n = 0; n < -dim; ++n) {
+        f /= refC;
+    }
+    return f;
+}
+
+static void
+rate_constants(const ckt_mech *m, const double * restrict tc, double invT, const double * restrict g_RT,
+               double * restrict k_f, double * restrict Kc)
+{
+    const int nreac = m->nreac;
+
+#ifdef __INTEL_COMPILER
+    #pragma simd
+#endif
+    for (int r = 0; r < nreac; ++r) {
+        k_f[r] = m->prefactor_units[r] * m->fwd_A[r]
+            * exp(m->fwd_beta[r] * tc[0] - m->activation_units[r] * m->fwd_Ea[r] * invT);
+    }
+
+    double refC = m->patm_R * invT;
+    double conv[nreac];
+    for (int r = 0; r < nreac; ++r) {
+        int dim;
+        Kc[r] = Kc_exponent(m, r, g_RT, &dim);
+        conv[r] = refC_power(refC, dim);
+    }
+
+#ifdef __INTEL_COMPILER
+    #pragma simd
+#endif
+    for (int r = 0; r < nreac; ++r) {
+        Kc[r] = exp(Kc[r]) * conv[r];
+    }
+}
+
+/* fall-off correction of reaction r for the given third body concentration */
+static double
+falloff(const ckt_mech *m, int r, double alpha, double k_f, const double * restrict tc, double invT)
+{
+    double T = tc[1];
+    double redP = alpha / k_f * m->phase_units[r] * m->low_A[r]
+        * exp(m->low_beta[r] * tc[0] - m->activation_units[r] * m->low_Ea[r] * invT);
+    double F = redP / (1.0 + redP);
+
+    if (m->kind[r] == CKT_TROE) {
+        double logPred = log10(redP);
+        double logFcent = log10(
+            (fabs(m->troe_Tsss[r]) > 1.e-100 ? (1.-m->troe_a[r])*exp(-T/m->troe_Tsss[r]) : 0.)
+            + (fabs(m->troe_Ts[r]) > 1.e-100 ? m->troe_a[r] * exp(-T/m->troe_Ts[r]) : 0.)
+            + (m->troe_len[r] == 4 ? exp(-m->troe_Tss[r] * invT) : 0.) );
+        double troe_c = -.4 - .67 * logFcent;
+        double troe_n = .75 - 1.27 * logFcent;
+        double troe = (troe_c + logPred) / (troe_n - .14*(troe_c + logPred));
+        return F * pow(10., logFcent / (1.0 + troe*troe));
+    }
+    else if (m->kind[r] == CKT_SRI) {
+        double logPred = log10(redP);
+        double X = 1.0 / (1.0 + logPred*logPred);
+        double F_sri = exp(X * log(m->sri_a[r] * exp(-m->sri_b[r]*invT)
+                                   + (m->sri_c[r] > 1.e-100 ? exp(-T/m->sri_c[r]) : 0.0)))
+            * (m->sri_len[r] > 3 ? m->sri_d[r]*exp(m->sri_e[r]*tc[0]) : 1.0);
+        return F * F_sri;
+    }
+    return F;
+}
+
+void
+ckt_progress_rate_fr(const ckt_mech *m, double * restrict q_f, double * restrict q_r,
+                     const double * restrict sc, double T)
+{
+    const int nspec = m->nspec, nreac = m->nreac;
+
+    double tc[] = { log(T), T, T*T, T*T*T, T*T*T*T };
+    double invT = 1.0 / tc[1];
+
+    double g_RT[nspec], k_f[nreac], Kc[nreac];
+    gibbs(g_RT, tc);
+    rate_constants(m, tc, invT, g_RT, k_f, Kc);
+
+    double mixture = 0.0;
+    for (int k = 0; k < nspec; ++k) {
+        mixture += sc[k];
+    }
+
+    for (int r = 0; r < nreac; ++r) {
+        double Corr = 1.0;
+        if (m->kind[r] != CKT_SIMPLE) {
+            Corr = third_body(m, r, sc, mixture);
+            if (m->kind[r] != CKT_THIRDBODY) {
+                Corr = falloff(m, r, Corr, k_f[r], tc, invT);
+            }
+        }
+        q_f[r] = Corr * k_f[r] * phase_space(m->rea_spec, m->rea_nu, m->rea_ptr[r], m->rea_ptr[r+1], sc);
+        if (m->reversible[r]) {
+            q_r[r] = Corr * k_f[r] / Kc[r]
+                * phase_space(m->pro_spec, m->pro_nu, m->pro_ptr[r], m->pro_ptr[r+1], sc);
+        }
+        else {
+            q_r[r] = 0.0;
+        }
+    }
+}
+
+void
+ckt_production_rate(const ckt_mech *m, double * restrict wdot, const double * restrict sc, double T)
+{
+    const int nspec = m->nspec, nreac = m->nreac;
+
+    double q_f[nreac], q_r[nreac];
+    ckt_progress_rate_fr(m, q_f, q_r, sc, T);
+
+    for (int k = 0; k < nspec; ++k) {
+        wdot[k] = 0.0;
+    }
+
+    for (int r = 0; r < nreac; ++r) {
+        double qdot = q_f[r] - q_r[r];
+        for (int j = m->rea_ptr[r]; j < m->rea_ptr[r+1]; ++j) {
+            wdot[m->rea_spec[j]] -= m->rea_nu[j] * qdot;
+        }
+        for (int j = m->pro_ptr[r]; j < m->pro_ptr[r+1]; ++j) {
+            wdot[m->pro_spec[j]] += m->pro_nu[j] * qdot;
+        }
+    }
+}
+
+/* npt points at once: sc[k*npt+i], T[i] and wdot[k*npt+i] */
+void
+ckt_vproduction_rate(const ckt_mech *m, int npt, double * restrict wdot,
+                     const double * restrict sc, const double * restrict T)
+{
+    const int nspec = m->nspec, nreac = m->nreac;
+
+    double logT[npt], invT[npt], mixture[npt], g_RT[nspec*npt];
+    double k_f[npt], qf[npt], qr[npt], Corr[npt];
+
+    for (int i = 0; i < npt; ++i) {
+        double tc[] = { log(T[i]), T[i], T[i]*T[i], T[i]*T[i]*T[i], T[i]*T[i]*T[i]*T[i] };
+        double g[nspec];
+        gibbs(g, tc);
+        for (int k = 0; k < nspec; ++k) {
+            g_RT[k*npt+i] = g[k];
+        }
+        logT[i] = tc[0];
+        invT[i] = 1.0 / T[i];
+        mixture[i] = 0.0;
+    }
+
+    for (int k = 0; k < nspec; ++k) {
+#ifdef __INTEL_COMPILER
+        #pragma simd
+#endif
+        for (int i = 0; i < npt; ++i) {
+            mixture[i] += sc[k*npt+i];
+            wdot[k*npt+i] = 0.0;
+        }
+    }
+
+    for (int r = 0; r < nreac; ++r) {
+
+        const double A = m->prefactor_units[r] * m->fwd_A[r];
+        const double beta = m->fwd_beta[r];
+        const double Ea = m->activation_units[r] * m->fwd_Ea[r];
+#ifdef __INTEL_COMPILER
+        #pragma simd
+#endif
+        for (int i = 0; i < npt; ++i) {
+            k_f[i] = A * exp(beta * logT[i] - Ea * invT[i]);
+            qf[i] = k_f[i];
+            qr[i] = 0.0;
+            Corr[i] = 1.0;
+        }
+
+        for (int j = m->rea_ptr[r]; j < m->rea_ptr[r+1]; ++j) {
+            const double * restrict c = sc + m->rea_spec[j]*npt;
+            for (int n = 0; n < m->rea_nu[j]; ++n) {
+#ifdef __INTEL_COMPILER
+                #pragma simd
+#endif
+                for (int i = 0; i < npt; ++i) {
+                    qf[i] *= c[i];
+                }
+            }
+        }
+
+        if (m->reversible[r]) {
+            int dim = 0;
+#ifdef __INTEL_COMPILER
+            #pragma simd
+#endif
+            for (int i = 0; i < npt; ++i) {
+                qr[i] = 0.0;
+            }
+            for (int j = m->rea_ptr[r]; j < m->rea_ptr[r+1]; ++j) {
+                const double * restrict g = g_RT + m->rea_spec[j]*npt;
+                const double nu = m->rea_nu[j];
+                for (int i = 0; i < npt; ++i) {
+                    qr[i] -= nu * g[i];
+                }
+                dim -= m->rea_nu[j];
+            }
+            for (int j = m->pro_ptr[r]; j < m->pro_ptr[r+1]; ++j) {
+                const double * restrict g = g_RT + m->pro_spec[j]*npt;
+                const double nu = m->pro_nu[j];
+                for (int i = 0; i < npt; ++i) {
+                    qr[i] += nu * g[i];
+                }
+                dim += m->pro_nu[j];
+            }
+            /* qr holds -ln(Kc) so far */
+#ifdef __INTEL_COMPILER
+            #pragma simd
+#endif
+            for (int i = 0; i < npt; ++i) {
+                qr[i] = k_f[i] * exp(qr[i]) / refC_power(m->patm_R * invT[i], dim);
+            }
+            for (int j = m->pro_ptr[r]; j < m->pro_ptr[r+1]; ++j) {
+                const double * restrict c = sc + m->pro_spec[j]*npt;
+                for (int n = 0; n < m->pro_nu[j]; ++n) {
+                    for (int i = 0; i < npt; ++i) {
+                        qr[i] *= c[i];
+                    }
+                }
+            }
+        }
+
+        if (m->kind[r] != CKT_SIMPLE) {
+            /* third_body on the strided concentrations, same summation order */
+            if (m->nTB[r] > 0) {
+                for (int i = 0; i < npt; ++i) {
+                    Corr[i] = mixture[i];
+                }
+                for (int j = 0; j < m->nTB[r]; ++j) {
+                    const double * restrict c = sc + m->TBid[r][j]*npt;
+                    const double eff = m->TB[r][j] - 1;
+#ifdef __INTEL_COMPILER
+                    #pragma simd
+#endif
+                    for (int i = 0; i < npt; ++i) {
+                        Corr[i] += eff * c[i];
+                    }
+                }
+            }
+            else if (m->tb_species[r] >= 0) {
+                const double * restrict c = sc + m->tb_species[r]*npt;
+                for (int i = 0; i < npt; ++i) {
+                    Corr[i] = c[i];
+                }
+            }
+            else {
+                for (int i = 0; i < npt; ++i) {
+                    Corr[i] = mixture[i];
+                }
+            }
+            if (m->kind[r] != CKT_THIRDBODY) {
+                for (int i = 0; i < npt; ++i) {
+                    double tc[] = { logT[i], T[i] };
+                    Corr[i] = falloff(m, r, Corr[i], k_f[i], tc, invT[i]);
+                }
+            }
+        }
+
+        for (int j = m->rea_ptr[r]; j < m->rea_ptr[r+1]; ++j) {
+            double * restrict w = wdot + m->rea_spec[j]*npt;
+            const double nu = m->rea_nu[j];
+#ifdef __INTEL_COMPILER
+            #pragma simd
+#endif
+            for (int i = 0; i < npt; ++i) {
+                w[i] -= nu * Corr[i] * (qf[i] - qr[i]);
+            }
+        }
+        for (int j = m->pro_ptr[r]; j < m->pro_ptr[r+1]; ++j) {
+            double * restrict w = wdot + m->pro_spec[j]*npt;
+            const double nu = m->pro_nu[j];
+#ifdef __INTEL_COMPILER
+            #pragma simd
+#endif
+            for (int i = 0; i < npt; ++i) {
+                w[i] += nu * Corr[i] * (qf[i] - qr[i]);
+            }
+        }
+    }
+}
+
+void
+ckt_rate_constants(const ckt_mech *m, double T, double * restrict k_f, double * restrict Kc)
+{
+    double tc[] = { log(T), T, T*T, T*T*T, T*T*T*T };
+    double g_RT[m->nspec];
+    gibbs(g_RT, tc);
+    rate_constants(m, tc, 1.0 / T, g_RT, k_f, Kc);
+}
+
+/*
+  The analytic Jacobian of aJacobian: J[k*(nspec+1)+m] is d(wdot[m])/d(sc[k]),
+  the last row the derivatives with respect to T and the last column those
+  of dT/dt, at constant pressure if consP and at constant volume otherwise.
+*/
+void
+ckt_jacobian(const ckt_mech *m, double * restrict J, const double * restrict sc, double T, int consP)
+{
+    const int nspec = m->nspec, nreac = m->nreac, ld = nspec+1;
+    const double ln10 = log(10.0);
+    const double log10e = 1.0/log(10.0);
+
+    memset(J, 0, ld*ld*sizeof(double));
+
+    double tc[] = { log(T), T, T*T, T*T*T, T*T*T*T };
+    double invT = 1.0 / tc[1];
+    double invT2 = invT * invT;
+
+    double mixture = 0.0;
+    for (int k = 0; k < nspec; ++k) {
+        mixture += sc[k];
+    }
+
+    double g_RT[nspec], h_RT[nspec], wdot[nspec];
+    double k_f_s[nreac], Kc_s[nreac];
+    gibbs(g_RT, tc);
+    speciesEnthalpy(h_RT, tc);
+    rate_constants(m, tc, invT, g_RT, k_f_s, Kc_s);
+
+    for (int k = 0; k < nspec; ++k) {
+        wdot[k] = 0.0;
+    }
+
+    for (int r = 0; r < nreac; ++r) {
+        const int kind = m->kind[r];
+        const int rlo = m->rea_ptr[r], rhi = m->rea_ptr[r+1];
+        const int plo = m->pro_ptr[r], phi = m->pro_ptr[r+1];
+
+        double alpha = 1.0, Corr = 1.0, Pr = 0.0, dlogFdlogPr = 0.0, dlnCorrdT = 0.0;
+
+        double phi_f = phase_space(m->rea_spec, m->rea_nu, rlo, rhi, sc);
+        double k_f = k_f_s[r];
+        double dlnkfdT = m->fwd_beta[r] * invT + m->activation_units[r] * m->fwd_Ea[r] * invT2;
+
+        if (kind != CKT_SIMPLE) {
+            alpha = third_body(m, r, sc, mixture);
+            Corr = alpha;
+        }
+
+        if (kind == CKT_LINDEMANN || kind == CKT_TROE || kind == CKT_SRI) {
+            double k_0 = m->low_A[r] * exp(m->low_beta[r] * tc[0] - m->activation_units[r] * m->low_Ea[r] * invT);
+            Pr = m->phase_units[r] * alpha / k_f * k_0;
+            double fPr = Pr / (1.0+Pr);
+            double dlnk0dT = m->low_beta[r] * invT + m->activation_units[r] * m->low_Ea[r] * invT2;
+            double dlogPrdT = log10e*(dlnk0dT - dlnkfdT);
+            double dlogfPrdT = dlogPrdT / (1.0+Pr);
+            double F = 1.0, dlogFdT = 0.0;
+
+            if (kind == CKT_TROE) {
+                double logPr = log10(Pr);
+                double Fcent1 = (fabs(m->troe_Tsss[r]) > 1.e-100 ? (1.-m->troe_a[r])*exp(-T/m->troe_Tsss[r]) : 0.);
+                double Fcent2 = (fabs(m->troe_Ts[r]) > 1.e-100 ? m->troe_a[r] * exp(-T/m->troe_Ts[r]) : 0.);
+                double Fcent3 = (m->troe_len[r] == 4 ? exp(-m->troe_Tss[r] * invT) : 0.);
+                double Fcent = Fcent1 + Fcent2 + Fcent3;
+                double logFcent = log10(Fcent);
+                double troe_c = -.4 - .67 * logFcent;
+                double troe_n = .75 - 1.27 * logFcent;
+                double troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));
+                double troePr = (troe_c + logPr) * troePr_den;
+                double troe = 1.0 / (1.0 + troePr*troePr);
+                F = pow(10.0, logFcent * troe);
+                double dlogFcentdT = log10e/Fcent*(
+                    (fabs(m->troe_Tsss[r]) > 1.e-100 ? -Fcent1/m->troe_Tsss[r] : 0.)
+                  + (fabs(m->troe_Ts[r]) > 1.e-100 ? -Fcent2/m->troe_Ts[r] : 0.)
+                  + (m->troe_len[r] == 4 ? Fcent3*m->troe_Tss[r]*invT2 : 0.) );
+                double dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;
+                double dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;
+                double dlogFdn = dlogFdcn_fac * troePr;
+                dlogFdlogPr = dlogFdc;
+                dlogFdT = dlogFcentdT*(troe - 0.67*dlogFdc - 1.27*dlogFdn) + dlogFdlogPr * dlogPrdT;
+            }
+            else if (kind == CKT_SRI) {
+                double logPr = log10(Pr);
+                double X = 1.0 / (1.0 + logPr*logPr);
+                double S1 = m->sri_a[r] * exp(-m->sri_b[r]*invT);
+                double S2 = (m->sri_c[r] > 1.e-100 ? exp(-T/m->sri_c[r]) : 0.0);
+                double S = S1 + S2;
+                double dSdT = S1*m->sri_b[r]*invT2 - (m->sri_c[r] > 1.e-100 ? S2/m->sri_c[r] : 0.0);
+                double lnF = X * log(S);
+                double dlnFdT = X * dSdT / S;
+                if (m->sri_len[r] > 3) {
+                    lnF += log(m->sri_d[r]) + m->sri_e[r]*tc[0];
+                    dlnFdT += m->sri_e[r]*invT;
+                }
+                F = exp(lnF);
+                dlogFdlogPr = -2.0 * log10e * log(S) * logPr * X*X;
+                dlogFdT = log10e*dlnFdT + dlogFdlogPr * dlogPrdT;
+            }
+
+            Corr = fPr * F;
+            dlnCorrdT = ln10*(dlogfPrdT + dlogFdT);
+        }
+
+        double phi_r = 0.0, k_r = 0.0, dkrdT = 0.0;
+        if (m->reversible[r]) {
+            phi_r = phase_space(m->pro_spec, m->pro_nu, plo, phi, sc);
+            k_r = k_f / Kc_s[r];
+            double dlnKcdT = 0.0;
+            int sumNuk = 0;
+            for (int j = rlo; j < rhi; ++j) {
+                dlnKcdT -= m->rea_nu[j] * h_RT[m->rea_spec[j]];
+                sumNuk -= m->rea_nu[j];
+            }
+            for (int j = plo; j < phi; ++j) {
+                dlnKcdT += m->pro_nu[j] * h_RT[m->pro_spec[j]];
+                sumNuk += m->pro_nu[j];
+            }
+            dlnKcdT = invT * (dlnKcdT - sumNuk);
+            dkrdT = (dlnkfdT - dlnKcdT)*k_r;
+        }
+
+        double q_nocor = k_f*phi_f - k_r*phi_r;
+        double q = Corr * q_nocor;
+        double dqdT = Corr * (dlnkfdT*k_f*phi_f - dkrdT*phi_r) + dlnCorrdT*q;
+
+        for (int j = rlo; j < rhi; ++j) {
+            wdot[m->rea_spec[j]] -= m->rea_nu[j] * q;
+        }
+        for (int j = plo; j < phi; ++j) {
+            wdot[m->pro_spec[j]] += m->pro_nu[j] * q;
+        }
+
+        k_f *= Corr;
+        k_r *= Corr;
+
+        if (kind != CKT_SIMPLE) {
+            /* d(alpha)/d[X_k] times the sensitivity of q to alpha */
+            double fac = (kind == CKT_THIRDBODY) ? q_nocor : q/alpha*(1.0/(Pr+1.0) + dlogFdlogPr);
+            if (m->nTB[r] > 0 || m->tb_species[r] < 0) {
+                if (!consP) {
+                    for (int k = 0; k < nspec; ++k) {
+                        add_dqdc(m, J, ld, r, k, fac);
+                    }
+                }
+                for (int j = 0; j < m->nTB[r]; ++j) {
+                    add_dqdc(m, J, ld, r, m->TBid[r][j], (m->TB[r][j] - 1) * fac);
+                }
+            }
+            else {
+                add_dqdc(m, J, ld, r, m->tb_species[r], fac);
+            }
+        }
+
+        for (int j = rlo; j < rhi; ++j) {
+            int s = m->rea_spec[j];
+            add_dqdc(m, J, ld, r, s, k_f * dphase_space(m->rea_spec, m->rea_nu, rlo, rhi, sc, s));
+        }
+        if (m->reversible[r]) {
+            for (int j = plo; j < phi; ++j) {
+                int s = m->pro_spec[j];
+                add_dqdc(m, J, ld, r, s, -k_r * dphase_space(m->pro_spec, m->pro_nu, plo, phi, sc, s));
+            }
+        }
+
+        add_dqdc(m, J, ld, r, nspec, dqdT);
+    }
+
+    /* the temperature equation */
+    double c_R[nspec], dcRdT[nspec], e_RT[nspec];
+    double * eh_RT;
+    if (consP) {
+        cp_R(c_R, tc);
+        dcvpRdT(dcRdT, tc);
+        eh_RT = &h_RT[0];
+    }
+    else {
+        cv_R(c_R, tc);
+        dcvpRdT(dcRdT, tc);
+        speciesInternalEnergy(e_RT, tc);
+        eh_RT = &e_RT[0];
+    }
+
+    double cmix = 0.0, ehmix = 0.0, dcmixdT=0.0, dehmixdT=0.0;
+    for (int k = 0; k < nspec; ++k) {
+        cmix += c_R[k]*sc[k];
+        dcmixdT += dcRdT[k]*sc[k];
+        ehmix += eh_RT[k]*wdot[k];
+        dehmixdT += invT*(c_R[k]-eh_RT[k])*wdot[k] + eh_RT[k]*J[nspec*ld+k];
+    }
+
+    double cmixinv = 1.0/cmix;
+    double tmp1 = ehmix*cmixinv;
+    double tmp3 = cmixinv*T;
+    double tmp2 = tmp1*tmp3;
+    /* dTdot/d[X] */
+    for (int k = 0; k < nspec; ++k) {
+        double dehmixdc = 0.0;
+        for (int n = 0; n < nspec; ++n) {
+            dehmixdc += eh_RT[n]*J[k*ld+n];
+        }
+        J[k*ld+nspec] = tmp2*c_R[k] - tmp3*dehmixdc;
+    }
+    /* dTdot/dT */
+    J[nspec*ld+nspec] = -tmp1 + tmp2*dcmixdT - tmp3*dehmixdT;
+}
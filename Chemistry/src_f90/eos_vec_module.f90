@@ -0,0 +1,149 @@
+module eos_vec_module
+
+  ! Batched equation of state for the multi-species ideal gas of the
+  ! chemistry mechanism.  Every routine works on np points at once, with
+  ! species stored as Y(np,nspecies), so that the Newton update and the
+  ! p, gamma and c evaluations are unit-stride loops over points.  Only
+  ! the CK thermo calls (ckubms, ckcvbs) remain per point.
+  !
+  ! T is the initial guess on input and the result on output.  Passing
+  ! the stored temperature of the state usually gives convergence in one
+  ! or two iterations.  A guess outside [eos_vec_Tmin, eos_vec_Tmax] is
+  ! replaced by linear interpolation in e, as in get_T_given_eY.
+  !
+  ! ierr(i) is 0 on success.  It is 1 if e is outside the range of the
+  ! fits; T is then extrapolated linearly from the nearest bound.  As in
+  ! get_T_given_eY, Newton stops once the update is below Ttol or no
+  ! longer changes T, and reaching maxiter is not an error.
+
+  use chemistry_module, only : nspecies, Ru, inv_mwt
+
+  implicit none
+
+  double precision, parameter, public :: eos_vec_Tmin = 250.d0
+  double precision, parameter, public :: eos_vec_Tmax = 4000.d0
+
+  integer, parameter :: maxiter = 200
+  double precision, parameter :: Ttol = 1.d-6, dTmax = 100.d0
+
+  private
+
+  public :: eos_vec_get_T, eos_vec_given_ReY, eos_vec_get_p
+
+contains
+
+  subroutine eos_vec_get_T(np, e, Y, T, cv, ierr)
+    integer, intent(in) :: np
+    double precision, intent(in) :: e(np), Y(np,nspecies)
+    double precision, intent(inout) :: T(np)
+    double precision, intent(out) :: cv(np)
+    integer, intent(out) :: ierr(np)
+
+    logical :: active(np)
+    integer :: i, iter, iwrk
+    double precision :: rwrk, dT, Tb, eb, emin, emax, e1(np), Yp(nspecies)
+
+    ! Guesses outside the fit range (or NaN) start from the interpolant
+    do i = 1, np
+       if (.not.(T(i) >= eos_vec_Tmin .and. T(i) <= eos_vec_Tmax)) then
+          Yp = Y(i,:)
+          call ckubms(eos_vec_Tmin, Yp, iwrk, rwrk, emin)
+          call ckubms(eos_vec_Tmax, Yp, iwrk, rwrk, emax)
+          T(i) = eos_vec_Tmin + (eos_vec_Tmax-eos_vec_Tmin)/(emax-emin)*(e(i)-emin)
+          T(i) = min(max(T(i), eos_vec_Tmin), eos_vec_Tmax)
+       end if
+    end do
+
+    ierr = 0
+    active = .true.
+
+    do iter = 1, maxiter
+
+       do i = 1, np
+          if (active(i)) then
+             Yp = Y(i,:)
+             call ckubms(T(i), Yp, iwrk, rwrk, e1(i))
+             call ckcvbs(T(i), Yp, iwrk, rwrk, cv(i))
+          end if
+       end do
+
+       do i = 1, np
+          if (active(i)) then
+             dT = (e(i)-e1(i))/cv(i)
+             if (abs(dT) < Ttol .or. T(i)+dT == T(i)) then
+                active(i) = .false.
+             else
+                T(i) = T(i) + max(-dTmax, min(dTmax, dT))
+             end if
+          end if
+       end do
+
+       if (.not. any(active)) exit
+
+    end do
+
+    ! Outside the fits: linear extrapolation from the nearest bound
+    do i = 1, np
+       if (T(i) < eos_vec_Tmin .or. T(i) > eos_vec_Tmax) then
+          Tb = merge(eos_vec_Tmin, eos_vec_Tmax, T(i) < eos_vec_Tmin)
+          Yp = Y(i,:)
+          call ckubms(Tb, Yp, iwrk, rwrk, eb)
+          call ckcvbs(Tb, Yp, iwrk, rwrk, cv(i))
+          T(i) = Tb - (eb-e(i))/cv(i)
+          ierr(i) = 1
+       end if
+    end do
+
+  end subroutine eos_vec_get_T
+
+
+  subroutine eos_vec_get_p(np, rho, T, Y, p)
+    integer, intent(in) :: np
+    double precision, intent(in) :: rho(np), T(np), Y(np,nspecies)
+    double precision, intent(out) :: p(np)
+
+    integer :: i, n
+    double precision :: Wbinv(np)
+
+    Wbinv = 0.d0
+    do n = 1, nspecies
+       do i = 1, np
+          Wbinv(i) = Wbinv(i) + Y(i,n)*inv_mwt(n)
+       end do
+    end do
+
+    do i = 1, np
+       p(i) = rho(i)*Ru*T(i)*Wbinv(i)
+    end do
+
+  end subroutine eos_vec_get_p
+
+
+  subroutine eos_vec_given_ReY(np, rho, e, Y, T, p, c, gamc, ierr)
+    integer, intent(in) :: np
+    double precision, intent(in) :: rho(np), e(np), Y(np,nspecies)
+    double precision, intent(inout) :: T(np)
+    double precision, intent(out) :: p(np), c(np), gamc(np)
+    integer, intent(out) :: ierr(np)
+
+    integer :: i, n
+    double precision :: cv(np), Wbinv(np)
+
+    call eos_vec_get_T(np, e, Y, T, cv, ierr)
+
+    Wbinv = 0.d0
+    do n = 1, nspecies
+       do i = 1, np
+          Wbinv(i) = Wbinv(i) + Y(i,n)*inv_mwt(n)
+       end do
+    end do
+
+    do i = 1, np
+       p(i) = rho(i)*Ru*T(i)*Wbinv(i)
+       gamc(i) = (cv(i) + Ru*Wbinv(i)) / cv(i)
+       c(i) = sqrt(gamc(i)*p(i)/rho(i))
+    end do
+
+  end subroutine eos_vec_given_ReY
+
+end module eos_vec_module
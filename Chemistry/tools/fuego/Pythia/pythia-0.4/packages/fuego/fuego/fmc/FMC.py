@@ -44,10 +44,20 @@ class FMC(Application):
     
         print "... done (%g sec)" % timer.stop()
 
+        if self.inventory.qss:
+            self._setQSS(mechanism, self.inventory.qss)
+
+        if self.inventory.report:
+            self._report(mechanism, output)
+
+        if self.inventory.split > 0:
+            self._saveUnits(mechanism, save, output)
+            return
+
         timer.reset()
         timer.start()
         print "Converting into '%s' format" % output,
-        lines = fuego.serialization.save(mechanism, output)
+        lines = fuego.serialization.save(mechanism, output, self.inventory.kernel)
         print "... done (%g sec)" % timer.stop()
 
         print "saving in '%s'" % save,
@@ -67,6 +77,60 @@ class FMC(Application):
         return
 
 
+    def _saveUnits(self, mechanism, save, output):
+        import fuego
+        import pyre.monitors
+
+        # '-name=chem.c' gives chem.h, chem_params.c, chem_ckapi.c, ...
+        import os
+        basename = os.path.splitext(save)[0]
+
+        timer = pyre.monitors.timer("fuego")
+        timer.start()
+        print "Converting into '%s' format, split into units" % output,
+        files = fuego.serialization.saveUnits(
+            mechanism, basename, self.inventory.split, output, self.inventory.kernel)
+        print "... done (%g sec)" % timer.stop()
+
+        for name, lines in files:
+            print "saving in '%s'" % name
+            outputFile = self._openOutput(name)
+            for line in lines:
+                outputFile.write(line)
+                outputFile.write('\n')
+            outputFile.close()
+
+        return
+
+
+    def _report(self, mechanism, output):
+        import fuego
+        for line in fuego.serialization.report(mechanism, output, self.inventory.kernel):
+            print line
+        return
+
+
+    def _setQSS(self, mechanism, qss):
+        # '-qss=CH2,HCO' or '-qss=file' with one species per line
+        import os
+        if os.path.isfile(qss):
+            symbols = file(qss).read().split()
+        else:
+            symbols = [s.strip() for s in qss.split(",") if s.strip()]
+
+        from fuego.serialization.mechanisms.MechanismExceptions import InvalidQSS
+        try:
+            mechanism.setQSS(symbols)
+        except InvalidQSS, error:
+            import sys
+            print
+            print "fmc: %s" % error
+            sys.exit(1)
+
+        print "QSS species: %s" % " ".join(symbols)
+        return
+
+
     def _openOutput(self, name):
         if name == "stdout":
             import sys
@@ -85,6 +149,14 @@ class FMC(Application):
             pyre.properties.str("thermo", default=""),
             pyre.properties.str("input", default=""),
             pyre.properties.str("output", default="c"),
+            # reactions per Jacobian unit; 0 writes a single file
+            pyre.properties.int("split", default=0),
+            # "tables" emits reaction tables for Chemistry/src/ChemKernel.c
+            pyre.properties.str("kernel", default="unrolled"),
+            # species eliminated in quasi-steady state: "A,B,..." or a file
+            pyre.properties.str("qss", default=""),
+            # print the exp/log/pow calls and flops of the rate code
+            pyre.properties.bool("report", default=False),
             ]
 
 
@@ -11,7 +11,7 @@
 #  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 # 
 
-from pickle import save, pickler, picklers
+from pickle import save, saveUnits, report, pickler, picklers
 from unpickle import load, loadThermoDatabase, unpickler, unpicklers
 
 
@@ -47,6 +47,15 @@ class CPickler(CMill):
         self.species = []
         self.nSpecies = 0
         self.reactionIndex = []
+        # (unit name, first line) of each translation unit in split mode
+        self.units = None
+        self.unitPrefix = ""
+        self.headerExtra = []
+        self.jacobianChunk = 0
+        # "unrolled" rate code, or "tables" for the ChemKernel engine
+        self.kernel = "unrolled"
+        # reuse exp calls between reactions; off only to measure the gain
+        self.shareExp = True
         return
 
 
@@ -73,59 +82,96 @@ class CPickler(CMill):
         return
 
 
-    def _statics(self,mechanism):
-        self._write()
-        self._write(self.line(' Inverse molecular weights'))
-        self._write('static const double imw[%d] = {' % (self.nSpecies))
-        self._indent()
-        for i in range(0,self.nSpecies):
-            species = self.species[i]
-            text = '1.0 / %f' % (species.weight)
-            if (i<self.nSpecies-1):
-               text += ',  '
-            else:
-               text += '};  '
-            self._write(text + self.line('%s' % species.symbol))
-        self._outdent()
-        self._write()
+    def _allSpecies(self, mechanism):
+        # the transported species followed by the QSS ones, in id order
+        return mechanism.species() + mechanism.qss()
 
+
+    # the reaction parameter arrays; each also has a copy with suffix _DEF
+    _parameterNames = [
+        'fwd_A', 'fwd_beta', 'fwd_Ea', 'low_A', 'low_beta', 'low_Ea',
+        'rev_A', 'rev_beta', 'rev_Ea', 'troe_a', 'troe_Ts', 'troe_Tss', 'troe_Tsss',
+        'sri_a', 'sri_b', 'sri_c', 'sri_d', 'sri_e',
+        'activation_units', 'prefactor_units', 'phase_units',
+        'is_PD', 'troe_len', 'sri_len', 'nTB', 'TBid', 'TB']
+
+
+    def _parameterArrays(self, nReactions, storage):
         self._write()
-        nReactions = len(mechanism.reaction())
-        self._write()
-        self._write('static double fwd_A[%d], fwd_beta[%d], fwd_Ea[%d];' 
+        self._write(storage + 'double fwd_A[%d], fwd_beta[%d], fwd_Ea[%d];' 
                     % (nReactions,nReactions,nReactions))
-        self._write('static double low_A[%d], low_beta[%d], low_Ea[%d];' 
+        self._write(storage + 'double low_A[%d], low_beta[%d], low_Ea[%d];' 
                     % (nReactions,nReactions,nReactions))
-        self._write('static double rev_A[%d], rev_beta[%d], rev_Ea[%d];' 
+        self._write(storage + 'double rev_A[%d], rev_beta[%d], rev_Ea[%d];' 
                     % (nReactions,nReactions,nReactions))
-        self._write('static double troe_a[%d],troe_Ts[%d], troe_Tss[%d], troe_Tsss[%d];' 
+        self._write(storage + 'double troe_a[%d],troe_Ts[%d], troe_Tss[%d], troe_Tsss[%d];' 
                     % (nReactions,nReactions,nReactions,nReactions))
-        self._write('static double sri_a[%d], sri_b[%d], sri_c[%d], sri_d[%d], sri_e[%d];'
+        self._write(storage + 'double sri_a[%d], sri_b[%d], sri_c[%d], sri_d[%d], sri_e[%d];'
                     % (nReactions,nReactions,nReactions,nReactions,nReactions))
-        self._write('static double activation_units[%d], prefactor_units[%d], phase_units[%d];'
+        self._write(storage + 'double activation_units[%d], prefactor_units[%d], phase_units[%d];'
                     % (nReactions,nReactions,nReactions))
-        self._write('static int is_PD[%d], troe_len[%d], sri_len[%d], nTB[%d], *TBid[%d];' 
+        self._write(storage + 'int is_PD[%d], troe_len[%d], sri_len[%d], nTB[%d], *TBid[%d];' 
                     % (nReactions,nReactions,nReactions,nReactions,nReactions))
-        self._write('static double *TB[%d];' 
+        self._write(storage + 'double *TB[%d];' 
                     % (nReactions))
 
         self._write()
-        self._write('static double fwd_A_DEF[%d], fwd_beta_DEF[%d], fwd_Ea_DEF[%d];' 
+        self._write(storage + 'double fwd_A_DEF[%d], fwd_beta_DEF[%d], fwd_Ea_DEF[%d];' 
                     % (nReactions,nReactions,nReactions))
-        self._write('static double low_A_DEF[%d], low_beta_DEF[%d], low_Ea_DEF[%d];' 
+        self._write(storage + 'double low_A_DEF[%d], low_beta_DEF[%d], low_Ea_DEF[%d];' 
                     % (nReactions,nReactions,nReactions))
-        self._write('static double rev_A_DEF[%d], rev_beta_DEF[%d], rev_Ea_DEF[%d];' 
+        self._write(storage + 'double rev_A_DEF[%d], rev_beta_DEF[%d], rev_Ea_DEF[%d];' 
                     % (nReactions,nReactions,nReactions))
-        self._write('static double troe_a_DEF[%d],troe_Ts_DEF[%d], troe_Tss_DEF[%d], troe_Tsss_DEF[%d];' 
+        self._write(storage + 'double troe_a_DEF[%d],troe_Ts_DEF[%d], troe_Tss_DEF[%d], troe_Tsss_DEF[%d];' 
                     % (nReactions,nReactions,nReactions,nReactions))
-        self._write('static double sri_a_DEF[%d], sri_b_DEF[%d], sri_c_DEF[%d], sri_d_DEF[%d], sri_e_DEF[%d];'
+        self._write(storage + 'double sri_a_DEF[%d], sri_b_DEF[%d], sri_c_DEF[%d], sri_d_DEF[%d], sri_e_DEF[%d];'
                     % (nReactions,nReactions,nReactions,nReactions,nReactions))
-        self._write('static double activation_units_DEF[%d], prefactor_units_DEF[%d], phase_units_DEF[%d];'
+        self._write(storage + 'double activation_units_DEF[%d], prefactor_units_DEF[%d], phase_units_DEF[%d];'
                     % (nReactions,nReactions,nReactions))
-        self._write('static int is_PD_DEF[%d], troe_len_DEF[%d], sri_len_DEF[%d], nTB_DEF[%d], *TBid_DEF[%d];' 
+        self._write(storage + 'int is_PD_DEF[%d], troe_len_DEF[%d], sri_len_DEF[%d], nTB_DEF[%d], *TBid_DEF[%d];' 
                     % (nReactions,nReactions,nReactions,nReactions,nReactions))
-        self._write('static double *TB_DEF[%d];' 
+        self._write(storage + 'double *TB_DEF[%d];' 
                     % (nReactions))
+        return
+
+
+    def _inverseWeights(self):
+        self._write()
+        self._write(self.line(' Inverse molecular weights'))
+        self._write('static const double imw[%d] = {' % (self.nSpecies))
+        self._indent()
+        for i in range(0,self.nSpecies):
+            species = self.species[i]
+            text = '1.0 / %f' % (species.weight)
+            if (i<self.nSpecies-1):
+               text += ',  '
+            else:
+               text += '};  '
+            self._write(text + self.line('%s' % species.symbol))
+        self._outdent()
+        self._write()
+        return
+
+
+    def _statics(self,mechanism):
+        if self.units is None:
+            self._inverseWeights()
+
+        self._write()
+        nReactions = len(mechanism.reaction())
+        if self.units is None:
+            self._parameterArrays(nReactions, 'static ')
+        else:
+            # shared by the units and defined once in the parameter unit;
+            # the mechanism prefix keeps the global names apart from others
+            self._write()
+            for name in self._parameterNames:
+                for suffix in ['', '_DEF']:
+                    self._write('#define %s%s %s%s%s'
+                                % (name, suffix, self.unitPrefix, name, suffix))
+            self._parameterArrays(nReactions, 'extern ')
+            self._unit('params')
+            self._parameterArrays(nReactions, '')
 
         # build reverse reaction map
         rmap = {}
@@ -332,6 +378,10 @@ class CPickler(CMill):
         #self._main(mechanism)
 
         # chemkin wrappers
+        self._unit('ckapi')
+        if self.units is not None:
+            # only the wrappers use the inverse weights
+            self._inverseWeights()
         self._ckindx(mechanism)
         self._ckxnum(mechanism)
         self._cksnum(mechanism)
@@ -345,10 +395,12 @@ class CPickler(CMill):
         self._ckpc(mechanism)
         self._ckrhox(mechanism)
         self._ckrhoy(mechanism)
+        self._vckrhoy(mechanism)
         self._ckrhoc(mechanism)
         self._ckwt(mechanism)
         self._ckawt(mechanism)
         self._ckmmwy(mechanism)
+        self._vckmmwy(mechanism)
         self._ckmmwx(mechanism)
         self._ckmmwc(mechanism)
         self._ckytx(mechanism)
@@ -384,13 +436,17 @@ class CPickler(CMill):
 
         self._ckcpbl(mechanism)
         self._ckcpbs(mechanism)
+        self._vckcpbs(mechanism)
         self._ckcvbl(mechanism)
         self._ckcvbs(mechanism)
+        self._vckcvbs(mechanism)
         
         self._ckhbml(mechanism)
         self._ckhbms(mechanism)
+        self._vckhbms(mechanism)
         self._ckubml(mechanism)
         self._ckubms(mechanism)
+        self._vckubms(mechanism)
         self._cksbml(mechanism)
         self._cksbms(mechanism)
         self._ckgbml(mechanism)
@@ -424,14 +480,26 @@ class CPickler(CMill):
         self._ckeqxr(mechanism)
         
         # Fuego Functions
-        self._productionRate(mechanism)
-        self._vproductionRate(mechanism)
-        self._DproductionRate(mechanism)
-        self._ajac(mechanism)
+        self._unit('rates')
+        if self.kernel == "tables":
+            self._kernelTables(mechanism)
+            self._DproductionRate(mechanism)
+        else:
+            self._productionRate(mechanism)
+            if mechanism.qss():
+                self._qssSolve(mechanism)
+            self._vproductionRate(mechanism)
+            self._DproductionRate(mechanism)
+            self._unit('jacobian')
+            self._ajac(mechanism)
+        self._unit('thermo')
         self._dthermodT(mechanism)
-        self._progressRate(mechanism)
-        self._progressRateFR(mechanism)
+        if self.kernel != "tables":
+            self._unit('rates')
+            self._progressRate(mechanism)
+            self._progressRateFR(mechanism)
         self._equilibriumConstants(mechanism)
+        self._unit('thermo')
         self._thermo(mechanism)
         self._molecularWeight(mechanism)
         self._atomicWeight(mechanism)
@@ -446,10 +514,105 @@ class CPickler(CMill):
         return
 
 
+    def _unit(self, name):
+        # start (or resume) translation unit 'name'; a no-op unless splitting
+        if self.units is not None:
+            self.units.append((name, len(self._rep)))
+        return
+
+
+    def report(self, mechanism):
+        """Count the operations of the generated productionRate and aJacobian
+
+        Returns the lines of a report of the exp/log/pow calls and flops per
+        call at a new temperature, as counted in the code written with and
+        without the sharing of exp calls and sums between reactions.
+        """
+        if self.kernel == "tables":
+            return ['no operation counts for the table-driven kernel']
+
+        # rendering reorders the reactions, so each pass gets a copy
+        import copy
+        counts = []
+        saved = self._rep
+        try:
+            for share in [False, True]:
+                self._rep = []
+                self.shareExp = share
+                lines = self.pickle(copy.deepcopy(mechanism))
+                counts.append((self._operationCounts(lines), self._operationCounts(lines, False)))
+        finally:
+            self._rep = saved
+            self.shareExp = True
+
+        report = ['operations per call at a new temperature, without -> with sharing:']
+        for label, name, consV in [('productionRate', 'productionRate', 0),
+                                   ('aJacobian', 'aJacobian', 0),
+                                   ('aJacobian consV', 'aJacobian', 1)]:
+            before, after = counts[0][consV][name], counts[1][consV][name]
+            report.append('  %-15s exp/log/pow %6d -> %6d (%3.0f%% fewer)   flops %8d -> %8d'
+                          % (label, before[0], after[0], 100.0*(before[0]-after[0])/max(before[0], 1),
+                             before[1], after[1]))
+        return report
+
+
+    def pickleUnits(self, mechanism, basename, jacobianChunk=50):
+        """Render the mechanism as a header and several translation units
+
+        Returns a list of (filename, lines): '<basename>.h' with the
+        declarations shared by all units, followed by '<basename>_<unit>.c'
+        for the parameter database, the chemkin wrappers, the rates, the
+        thermodynamics and the Jacobian.  The Jacobian of a mechanism with
+        more than jacobianChunk reactions is split further into one unit
+        per jacobianChunk reactions, so that the largest units of big
+        mechanisms can be compiled in parallel.  The external symbols are
+        those of the single file produced by pickle(), plus the reaction
+        parameter arrays shared by the units, which carry the prefix
+        '<basename>_' so that several split mechanisms may be linked together.
+        """
+        import os
+        import re
+
+        self.units = [('header', 0)]
+        self.unitPrefix = re.sub(r'\W', '_', os.path.basename(basename)) + '_'
+        self.headerExtra = []
+        self.jacobianChunk = jacobianChunk
+        try:
+            lines = self.pickle(mechanism)
+            units = self.units
+        finally:
+            self.units = None
+            self.unitPrefix = ""
+            self.jacobianChunk = 0
+
+        names = []
+        bodies = {}
+        bounds = units + [(None, len(lines))]
+        for (name, start), (_, end) in zip(bounds[:-1], bounds[1:]):
+            if name not in bodies:
+                names.append(name)
+                bodies[name] = []
+            bodies[name] += lines[start:end]
+
+        guard = '%s_H' % os.path.basename(basename).upper().replace('.', '_')
+        header = ['#ifndef %s' % guard, '#define %s' % guard]
+        header += bodies['header'] + self.headerExtra
+        header += ['', '#endif']
+
+        include = '#include "%s.h"' % os.path.basename(basename)
+
+        files = [(basename + '.h', header)]
+        for name in names[1:]:
+            files.append(('%s_%s.c' % (basename, name), [include] + bodies[name]))
+
+        return files
+
+
     def _includes(self):
         self._rep += [
             '',
             '#include <math.h>',
+            '#include <float.h>',
             '#include <stdio.h>',
             '#include <string.h>',
             '#include <stdlib.h>'
@@ -542,6 +705,12 @@ class CPickler(CMill):
             '#define VCKPY VCKPY',
             '#define VCKWYR VCKWYR',
             '#define VCKYTX VCKYTX',
+            '#define VCKCPBS VCKCPBS',
+            '#define VCKCVBS VCKCVBS',
+            '#define VCKHBMS VCKHBMS',
+            '#define VCKUBMS VCKUBMS',
+            '#define VCKRHOY VCKRHOY',
+            '#define VCKMMWY VCKMMWY',
             '#define GET_T_GIVEN_EY GET_T_GIVEN_EY',
             '#define GET_T_GIVEN_HY GET_T_GIVEN_HY',
             '#define GET_REACTION_MAP GET_REACTION_MAP',
@@ -627,6 +796,12 @@ class CPickler(CMill):
             '#define VCKPY vckpy',
             '#define VCKWYR vckwyr',
             '#define VCKYTX vckytx',
+            '#define VCKCPBS vckcpbs',
+            '#define VCKCVBS vckcvbs',
+            '#define VCKHBMS vckhbms',
+            '#define VCKUBMS vckubms',
+            '#define VCKRHOY vckrhoy',
+            '#define VCKMMWY vckmmwy',
             '#define GET_T_GIVEN_EY get_t_given_ey',
             '#define GET_T_GIVEN_HY get_t_given_hy',
             '#define GET_REACTION_MAP get_reaction_map',
@@ -712,6 +887,12 @@ class CPickler(CMill):
             '#define VCKPY vckpy_',
             '#define VCKWYR vckwyr_',
             '#define VCKYTX vckytx_',
+            '#define VCKCPBS vckcpbs_',
+            '#define VCKCVBS vckcvbs_',
+            '#define VCKHBMS vckhbms_',
+            '#define VCKUBMS vckubms_',
+            '#define VCKRHOY vckrhoy_',
+            '#define VCKMMWY vckmmwy_',
             '#define GET_T_GIVEN_EY get_t_given_ey_',
             '#define GET_T_GIVEN_HY get_t_given_hy_',
             '#define GET_REACTION_MAP get_reaction_map_',
@@ -835,6 +1016,12 @@ class CPickler(CMill):
             '            double * restrict y, int * restrict iwrk, double * restrict rwrk,',
             '            double * restrict wdot);',
             'void VCKYTX'+sym+'(int * restrict np, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict x);',
+            'void VCKCPBS'+sym+'(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cpbs);',
+            'void VCKCVBS'+sym+'(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict cvbs);',
+            'void VCKHBMS'+sym+'(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict hbms);',
+            'void VCKUBMS'+sym+'(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict ubms);',
+            'void VCKRHOY'+sym+'(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho);',
+            'void VCKMMWY'+sym+'(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm);',
             'void vcomp_k_f(int npt, double * restrict k_f_s, double * restrict tc, double * restrict invT);',
             'void vcomp_gibbs(int npt, double * restrict g_RT, double * restrict tc);',
             'void vcomp_Kc(int npt, double * restrict Kc_s, double * restrict g_RT, double * restrict invT);',
@@ -853,6 +1040,16 @@ class CPickler(CMill):
                     '                double * restrict k_f_s, double * restrict Kc_s,',
                     '                double * restrict tc, double * restrict invT, double * restrict T);',
                     ]                
+        if mechanism.qss():
+            self._rep += [
+                self.line('quasi-steady-state species'),
+                'void gibbs_qss(double * restrict species, double * restrict tc);',
+                'void speciesEnthalpy_qss(double * restrict species, double * restrict tc);',
+                'void comp_qss(double * restrict q_f, double * restrict q_r, double * restrict sc, double * restrict tc, double invT);',
+                'void qssConcentrations(double * restrict sc, double T);',
+                'void qss_lu(int n, double * restrict A, int * restrict piv);',
+                'void qss_lusolve(int n, double * restrict A, int * restrict piv, double * restrict b);',
+                ]
         return
 
 
@@ -1071,6 +1268,18 @@ class CPickler(CMill):
         self._speciesInternalEnergy(speciesInfo)
         self._speciesEnthalpy(speciesInfo)
         self._speciesEntropy(speciesInfo)
+
+        qss = mechanism.qss()
+        if qss:
+            qssInfo = self._analyzeThermodynamics(mechanism, qss)
+            self._write()
+            self._write()
+            self._write(self.line('g/(RT) of the QSS species, species[%d] on' % qss[0].id))
+            self._generateThermoRoutine("gibbs_qss", self._gibbsNASA, qssInfo, 1)
+            self._write()
+            self._write()
+            self._write(self.line('h/(RT) of the QSS species, species[%d] on' % qss[0].id))
+            self._generateThermoRoutine("speciesEnthalpy_qss", self._enthalpyNASA, qssInfo, 1)
         return
 
 
@@ -2142,6 +2351,157 @@ class CPickler(CMill):
 
         return
     
+    def _vckmixthermo(self, name, comment, thermoFunc, outName, scaleRT):
+        species = self.species
+        nSpec = len(species)
+
+        self._write()
+        self._write()
+        self._write(self.line(comment))
+        self._write(self.line('y[n*(*ldy)+i]: species n of point i'))
+        self._write('void %s' % name +sym+'(int * restrict np, int * restrict ldy, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict %s)' % outName)
+        self._write('{')
+        self._indent()
+
+        self._write('double tc[5], tmp[%d], result;' % nSpec)
+
+        self._write()
+
+        self._write('for (int i=0; i<(*np); i++) {')
+        self._indent()
+        self._write('tc[0] = 0.0;')
+        self._write('tc[1] = T[i];')
+        self._write('tc[2] = T[i]*T[i];')
+        self._write('tc[3] = T[i]*T[i]*T[i];')
+        self._write('tc[4] = T[i]*T[i]*T[i]*T[i];')
+
+        self._write()
+
+        self._write('%s(tmp, tc);' % thermoFunc)
+
+        self._write()
+
+        self._write('result = 0.0;')
+        self._write('for (int n=0; n<%d; n++) {' % (nSpec))
+        self._indent()
+        self._write('result += tmp[n]*y[n*(*ldy)+i]*imw[n];')
+        self._outdent()
+        self._write('}')
+        if scaleRT:
+            self._write('%s[i] = result * %g * T[i];' % (outName, R*kelvin*mole/erg))
+        else:
+            self._write('%s[i] = result * %g;' % (outName, R*kelvin*mole/erg))
+        self._outdent()
+        self._write('}')
+
+        self._outdent()
+        self._write('}')
+
+        return
+
+    def _vckcpbs(self, mechanism):
+        self._vckmixthermo('VCKCPBS', 'Returns the mean specific heat at CP (Eq. 34)',
+                           'cp_R', 'cpbs', 0)
+        return
+
+    def _vckcvbs(self, mechanism):
+        self._vckmixthermo('VCKCVBS', 'Returns the mean specific heat at CV (Eq. 36)',
+                           'cv_R', 'cvbs', 0)
+        return
+
+    def _vckhbms(self, mechanism):
+        self._vckmixthermo('VCKHBMS', 'Returns mean enthalpy of mixture in mass units',
+                           'speciesEnthalpy', 'hbms', 1)
+        return
+
+    def _vckubms(self, mechanism):
+        self._vckmixthermo('VCKUBMS', 'get mean internal energy in mass units',
+                           'speciesInternalEnergy', 'ubms', 1)
+        return
+
+    def _vckmmwy(self, mechanism):
+        species = self.species
+        nSpec = len(species)
+
+        self._write()
+        self._write()
+        self._write(self.line('given y[species]: mass fractions'))
+        self._write(self.line('returns mean molecular weight (gm/mole)'))
+        self._write(self.line('y[n*(*ldy)+i]: species n of point i'))
+        self._write('void VCKMMWY'+sym+'(int * restrict np, int * restrict ldy, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict wtm)')
+        self._write('{')
+        self._indent()
+
+        self._write('for (int i=0; i<(*np); i++) {')
+        self._indent()
+        self._write('wtm[i] = 0.0;')
+        self._outdent()
+        self._write('}')
+        self._write('')
+        self._write('for (int n=0; n<%d; n++) {' % (nSpec))
+        self._indent()
+        self._write('for (int i=0; i<(*np); i++) {')
+        self._indent()
+        self._write('wtm[i] += y[n*(*ldy)+i] * imw[n];')
+        self._outdent()
+        self._write('}')
+        self._outdent()
+        self._write('}')
+        self._write('')
+        self._write('for (int i=0; i<(*np); i++) {')
+        self._indent()
+        self._write('wtm[i] = 1.0 / wtm[i];')
+        self._outdent()
+        self._write('}')
+
+        self._write()
+        self._write('return;')
+        self._outdent()
+        self._write('}')
+
+        return
+
+    def _vckrhoy(self, mechanism):
+        species = self.species
+        nSpec = len(species)
+
+        self._write()
+        self._write()
+        self._write(self.line('Compute rho = P*W(y)/RT'))
+        self._write(self.line('y[n*(*ldy)+i]: species n of point i'))
+        self._write('void VCKRHOY'+sym+'(int * restrict np, int * restrict ldy, double * restrict P, double * restrict T, double * restrict y, int * iwrk, double * restrict rwrk, double * restrict rho)')
+        self._write('{')
+        self._indent()
+
+        self._write('for (int i=0; i<(*np); i++) {')
+        self._indent()
+        self._write('rho[i] = 0.0;')
+        self._outdent()
+        self._write('}')
+        self._write('')
+        self._write('for (int n=0; n<%d; n++) {' % (nSpec))
+        self._indent()
+        self._write('for (int i=0; i<(*np); i++) {')
+        self._indent()
+        self._write('rho[i] += y[n*(*ldy)+i] * imw[n];')
+        self._outdent()
+        self._write('}')
+        self._outdent()
+        self._write('}')
+        self._write('')
+        self._write('for (int i=0; i<(*np); i++) {')
+        self._indent()
+        self._write('rho[i] = P[i] / (%g * T[i] * rho[i]);' % (R * mole * kelvin / erg) + self.line('rho = P*W/(R*T)'))
+        self._outdent()
+        self._write('}')
+
+        self._write()
+        self._write('return;')
+        self._outdent()
+        self._write('}')
+
+        return
+
     def _ckcpbl(self, mechanism):
         self._write()
         self._write()
@@ -3139,14 +3499,16 @@ class CPickler(CMill):
             self._write(self.line('reaction %d: %s' % (reaction.id, reaction.equation())))
 
             for symbol, coefficient in reaction.reactants:
-                self._write(
-                    "nuki[ %d * kd + %d ] += -%d ;"
-                    % (mechanism.species(symbol).id, reaction.id-1, coefficient))
+                if mechanism.species(symbol).id < nSpecies:
+                    self._write(
+                        "nuki[ %d * kd + %d ] += -%d ;"
+                        % (mechanism.species(symbol).id, reaction.id-1, coefficient))
 
             for symbol, coefficient in reaction.products:
-                self._write(
-                    "nuki[ %d * kd + %d ] += +%d ;"
-                    % (mechanism.species(symbol).id, reaction.id-1, coefficient))
+                if mechanism.species(symbol).id < nSpecies:
+                    self._write(
+                        "nuki[ %d * kd + %d ] += +%d ;"
+                        % (mechanism.species(symbol).id, reaction.id-1, coefficient))
        
         # done
         self._outdent()
@@ -4050,12 +4412,14 @@ class CPickler(CMill):
             'double tc[] = { log(tT), tT, tT*tT, tT*tT*tT, tT*tT*tT*tT }; '
             + self.line('temperature cache'))
         self._write(
-            'double gort[%d]; ' % nSpecies + self.line(' temporary storage'))
+            'double gort[%d]; ' % len(self._allSpecies(mechanism)) + self.line(' temporary storage'))
 
         # compute the gibbs free energy
         self._write()
         self._write(self.line('compute the Gibbs free energy'))
         self._write('gibbs(gort, tc);')
+        if mechanism.qss():
+            self._write('gibbs_qss(gort, tc);')
 
         # compute the equilibrium constants
         self._write()
@@ -4654,81 +5018,506 @@ class CPickler(CMill):
 
         return 
 
-    def _productionRate(self, mechanism):
+    def _tableArray(self, ctype, name, values):
+        self._write('static const %s %s[%d] = {' % (ctype, name, len(values)))
+        self._indent()
+        for i in range(0, len(values), 20):
+            text = ', '.join(str(v) for v in values[i:i+20])
+            if i+20 < len(values):
+                text += ','
+            self._write(text)
+        self._outdent()
+        self._write('};')
+        return
+
+
+    def _kernelTables(self, mechanism):
 
         nSpecies = len(mechanism.species())
         nReactions = len(mechanism.reaction())
 
-        itroe      = self.reactionIndex[0:2]
-        isri       = self.reactionIndex[1:3]
-        ilindemann = self.reactionIndex[2:4]
-        i3body     = self.reactionIndex[3:5] 
-        isimple    = self.reactionIndex[4:6]
-        ispecial   = self.reactionIndex[5:7]
-
-        if len(self.reactionIndex) != 7:
-            print '\n\nCheck this!!!\n'
+        if mechanism.qss():
+            print 'kernel=tables: QSS species are not supported'
             sys.exit(1)
-        
-        ntroe      = itroe[1]      - itroe[0]
-        nsri       = isri[1]       - isri[0]
-        nlindemann = ilindemann[1] - ilindemann[0]
-        n3body     = i3body[1]     - i3body[0]
-        nsimple    = isimple[1]    - isimple[0]
-        nspecial   = ispecial[1]   - ispecial[0]
 
-        # OMP stuff
-        self._write()
-        self._write('static double T_save = -1;')
-        self._write('#ifdef _OPENMP')
-        self._write('#pragma omp threadprivate(T_save)')
-        self._write('#endif')
-        self._write()
-        self._write('static double k_f_save[%d];' % nReactions)
-        self._write('#ifdef _OPENMP')
-        self._write('#pragma omp threadprivate(k_f_save)')
-        self._write('#endif')
-        self._write()
-        self._write('static double Kc_save[%d];' % nReactions)
-        self._write('#ifdef _OPENMP')
-        self._write('#pragma omp threadprivate(Kc_save)')
-        self._write('#endif')
-        self._write()
+        kinds = ['CKT_TROE', 'CKT_SRI', 'CKT_LINDEMANN', 'CKT_THIRDBODY', 'CKT_SIMPLE']
+
+        kind = []
+        reversible = []
+        tb_species = []
+        rea_ptr, rea_spec, rea_nu = [0], [], []
+        pro_ptr, pro_spec, pro_nu = [0], [], []
+
+        for reaction in mechanism.reaction():
+            i = reaction.id - 1
+            group = [j for j in range(6) if self.reactionIndex[j] <= i < self.reactionIndex[j+1]][0]
+            if group == 5 or reaction.lt:
+                print 'kernel=tables: reaction %d (%s) is not supported' % (reaction.orig_id, reaction.equation())
+                sys.exit(1)
+            if reaction.low and not reaction.thirdBody:
+                print 'kernel=tables: pressure dependent non-3-body reaction %d' % reaction.orig_id
+                sys.exit(1)
+            kind.append(kinds[group])
+            reversible.append(int(bool(reaction.reversible)))
+
+            species = -1
+            if reaction.thirdBody and not reaction.efficiencies:
+                symbol, coefficient = reaction.thirdBody
+                if symbol != "<mixture>":
+                    species = mechanism.species(symbol).id
+            tb_species.append(species)
+
+            for side, ptr, spec, nu in [(reaction.reactants, rea_ptr, rea_spec, rea_nu),
+                                        (reaction.products, pro_ptr, pro_spec, pro_nu)]:
+                coefs = defaultdict(int)
+                for symbol, coefficient in side:
+                    coefs[mechanism.species(symbol).id] += coefficient
+                for k in sorted(coefs):
+                    spec.append(k)
+                    nu.append(coefs[k])
+                ptr.append(len(spec))
+
+        self._write()
+        self._write('#include <ChemKernel.H>')
+        self._write()
+        self._write(self.line('reaction tables of the ChemKernel rate and Jacobian engine'))
+        self._tableArray('int', 'kind', kind)
+        self._tableArray('int', 'reversible', reversible)
+        self._tableArray('int', 'tb_species', tb_species)
+        self._tableArray('int', 'rea_ptr', rea_ptr)
+        self._tableArray('int', 'rea_spec', rea_spec)
+        self._tableArray('int', 'rea_nu', rea_nu)
+        self._tableArray('int', 'pro_ptr', pro_ptr)
+        self._tableArray('int', 'pro_spec', pro_spec)
+        self._tableArray('int', 'pro_nu', pro_nu)
+
+        self._write()
+        self._write('static const ckt_mech mech = {')
+        self._indent()
+        self._write('%d, %d,' % (nSpecies, nReactions))
+        self._write('kind, reversible, tb_species,')
+        self._write('rea_ptr, rea_spec, rea_nu,')
+        self._write('pro_ptr, pro_spec, pro_nu,')
+        self._write('%g / %g,' % (atm.value, R.value))
+        self._write('fwd_A, fwd_beta, fwd_Ea,')
+        self._write('low_A, low_beta, low_Ea,')
+        self._write('troe_a, troe_Ts, troe_Tss, troe_Tsss,')
+        self._write('sri_a, sri_b, sri_c, sri_d, sri_e,')
+        self._write('activation_units, prefactor_units, phase_units,')
+        self._write('troe_len, sri_len, nTB, TBid,')
+        self._write('TB')
+        self._outdent()
+        self._write('};')
 
-        # main function
         self._write()
         self._write(self.line('compute the production rate for each species'))
         self._write('void productionRate(double * restrict wdot, double * restrict sc, double T)')
         self._write('{')
-        self._indent()
+        self._write('    ckt_production_rate(&mech, wdot, sc, T);')
+        self._write('}')
 
-        self._write('double tc[] = { log(T), T, T*T, T*T*T, T*T*T*T }; /*temperature cache */')
-        self._write('double invT = 1.0 / tc[1];')
-        
         self._write()
-        self._write('if (T != T_save)')
+        self._write(self.line('compute the production rate for each species'))
+        self._write('void vproductionRate(int npt, double * restrict wdot, double * restrict sc, double * restrict T)')
+        self._write('{')
+        self._write('    ckt_vproduction_rate(&mech, npt, wdot, sc, T);')
+        self._write('}')
+
+        self._write()
+        self._write(self.line('compute the progress rate for each reaction'))
+        self._write('void progressRate(double * restrict qdot, double * restrict sc, double T)')
         self._write('{')
         self._indent()
-        self._write('T_save = T;')
-        self._write('comp_k_f(tc,invT,k_f_save);');
-        self._write('comp_Kc(tc,invT,Kc_save);');
+        self._write('double q_f[%d], q_r[%d];' % (nReactions, nReactions))
+        self._write('ckt_progress_rate_fr(&mech, q_f, q_r, sc, T);')
+        self._write('for (int i = 0; i < %d; ++i) {' % nReactions)
+        self._write('    qdot[i] = q_f[i] - q_r[i];')
+        self._write('}')
         self._outdent()
-        self._write("}")
+        self._write('}')
 
         self._write()
-        self._write('double qdot, q_f[%d], q_r[%d];' % (nReactions,nReactions))
-        self._write('comp_qfqr(q_f, q_r, sc, tc, invT);');
+        self._write(self.line('compute the progress rate for each reaction'))
+        self._write('void progressRateFR(double * restrict q_f, double * restrict q_r, double * restrict sc, double T)')
+        self._write('{')
+        self._write('    ckt_progress_rate_fr(&mech, q_f, q_r, sc, T);')
+        self._write('}')
 
         self._write()
-        self._write('for (int i = 0; i < %d; ++i) {' % nSpecies)
-        self._indent()
-        self._write('wdot[i] = 0.0;')
-        self._outdent()
+        self._write(self.line('compute the reaction Jacobian'))
+        self._write('void aJacobian(double * restrict J, double * restrict sc, double T, int consP)')
+        self._write('{')
+        self._write('    ckt_jacobian(&mech, J, sc, T, consP);')
         self._write('}')
 
-        for i in range(nReactions):
-            self._write()
-            self._write("qdot = q_f[%d]-q_r[%d];" % (i,i))
+        return
+
+
+    def _qfqrCall(self, mechanism):
+        # q_f, q_r of the transported concentrations sc
+        qss = mechanism.qss()
+        if not qss:
+            self._write('comp_qfqr(q_f, q_r, sc, tc, invT);')
+            return
+
+        nSpecies = len(mechanism.species())
+        self._write('double sc_qss[%d];' % (nSpecies + len(qss)))
+        self._write('for (int i = 0; i < %d; ++i) {' % nSpecies)
+        self._indent()
+        self._write('sc_qss[i] = sc[i];')
+        self._outdent()
+        self._write('}')
+        self._write('comp_qss(q_f, q_r, sc_qss, tc, invT);')
+        return
+
+
+    def _qssSystem(self, mechanism):
+        # For QSS species i the balance sum_r nu_ir (q_f[r] X_f(r) - q_r[r] X_r(r)) = 0,
+        # with X_f(r), X_r(r) the QSS concentration on either side of r (or 1), reads
+        #   D_i X_i = S_i + sum_j C_ij X_j
+        # Returns, per QSS id, (D terms, S terms, {j: C_ij terms}) and the QSS
+        # species on the reactant and product side of each reaction.
+        nSpecies = len(mechanism.species())
+        qss = mechanism.qss()
+
+        def term(nu, q):
+            if nu == 1:
+                return '+' + q
+            if nu == -1:
+                return '-' + q
+            return '%+d*%s' % (nu, q)
+
+        side_f = {}
+        side_r = {}
+        system = dict([(x.id, ([], [], {})) for x in qss])
+        for reaction in mechanism.reaction():
+            r = reaction.id - 1
+            nu = defaultdict(int)
+            for symbol, coefficient in reaction.reactants:
+                k = mechanism.species(symbol).id
+                nu[k] -= coefficient
+                if k >= nSpecies:
+                    side_f[r] = k
+            for symbol, coefficient in reaction.products:
+                k = mechanism.species(symbol).id
+                nu[k] += coefficient
+                if k >= nSpecies:
+                    side_r[r] = k
+            for i in sorted(nu):
+                if i < nSpecies or nu[i] == 0:
+                    continue
+                D, S, C = system[i]
+                terms = [(nu[i], 'q_f[%d]' % r, side_f.get(r))]
+                if reaction.reversible:
+                    terms.append((-nu[i], 'q_r[%d]' % r, side_r.get(r)))
+                for n, q, j in terms:
+                    if j is None:
+                        S.append(term(n, q))
+                    elif j == i:
+                        D.append(term(-n, q))
+                    else:
+                        C.setdefault(j, []).append(term(n, q))
+
+        for x in qss:
+            if not system[x.id][0]:
+                print 'QSS species %s is never consumed' % x.symbol
+                sys.exit(1)
+
+        return system, side_f, side_r
+
+
+    def _qssGroups(self, mechanism, system):
+        # strongly connected components of "i needs X_j", those needed first
+        index = {}
+        low = {}
+        stack = []
+        groups = []
+
+        def visit(i):
+            index[i] = low[i] = len(index)
+            stack.append(i)
+            for j in sorted(system[i][2]):
+                if j not in index:
+                    visit(j)
+                    low[i] = min(low[i], low[j])
+                elif j in stack:
+                    low[i] = min(low[i], index[j])
+            if low[i] == index[i]:
+                group = []
+                while True:
+                    j = stack.pop()
+                    group.append(j)
+                    if j == i:
+                        break
+                groups.append(sorted(group))
+
+        for x in mechanism.qss():
+            if x.id not in index:
+                visit(x.id)
+
+        return groups
+
+
+    def _qssSolve(self, mechanism):
+
+        nSpecies = len(mechanism.species())
+        nReactions = len(mechanism.reaction())
+        qss = mechanism.qss()
+        nAll = nSpecies + len(qss)
+        symbols = dict([(x.id, x.symbol) for x in qss])
+
+        system, side_f, side_r = self._qssSystem(mechanism)
+        groups = self._qssGroups(mechanism, system)
+
+        def join(terms):
+            if not terms:
+                return '0.0'
+            return ' '.join(terms).lstrip('+')
+
+        self._write()
+        self._write(self.line('LU factorization with partial pivoting of the n x n matrix A'))
+        self._write('void qss_lu(int n, double * restrict A, int * restrict piv)')
+        self._write('{')
+        self._indent()
+        self._write('for (int k = 0; k < n; ++k) {')
+        self._indent()
+        self._write('int p = k;')
+        self._write('for (int i = k+1; i < n; ++i) {')
+        self._write('    if (fabs(A[i*n+k]) > fabs(A[p*n+k])) p = i;')
+        self._write('}')
+        self._write('piv[k] = p;')
+        self._write('for (int j = 0; j < n && p != k; ++j) {')
+        self._write('    double t = A[k*n+j]; A[k*n+j] = A[p*n+j]; A[p*n+j] = t;')
+        self._write('}')
+        self._write('for (int i = k+1; i < n; ++i) {')
+        self._indent()
+        self._write('A[i*n+k] /= A[k*n+k];')
+        self._write('for (int j = k+1; j < n; ++j) {')
+        self._write('    A[i*n+j] -= A[i*n+k] * A[k*n+j];')
+        self._write('}')
+        self._outdent()
+        self._write('}')
+        self._outdent()
+        self._write('}')
+        self._outdent()
+        self._write('}')
+
+        self._write()
+        self._write(self.line('solve A x = b with the factors of qss_lu; x overwrites b'))
+        self._write('void qss_lusolve(int n, double * restrict A, int * restrict piv, double * restrict b)')
+        self._write('{')
+        self._indent()
+        self._write('for (int k = 0; k < n; ++k) {')
+        self._write('    double t = b[k]; b[k] = b[piv[k]]; b[piv[k]] = t;')
+        self._write('}')
+        self._write('for (int i = 1; i < n; ++i) {')
+        self._write('    for (int j = 0; j < i; ++j) b[i] -= A[i*n+j] * b[j];')
+        self._write('}')
+        self._write('for (int i = n-1; i >= 0; --i) {')
+        self._write('    for (int j = i+1; j < n; ++j) b[i] -= A[i*n+j] * b[j];')
+        self._write('    b[i] /= A[i*n+i];')
+        self._write('}')
+        self._outdent()
+        self._write('}')
+
+        self._write()
+        self._write(self.line('QSS species: %s' % ' '.join([x.symbol for x in qss])))
+        self._write(self.line('sc[%d..%d] from the transported sc[0..%d], then the progress rates'
+                              % (nSpecies, nAll-1, nSpecies-1)))
+        self._write('void comp_qss(double * restrict q_f, double * restrict q_r, double * restrict sc, double * restrict tc, double invT)')
+        self._write('{')
+        self._indent()
+        self._write(self.line('rates per unit QSS concentration'))
+        self._write('for (int i = %d; i < %d; ++i) {' % (nSpecies, nAll))
+        self._indent()
+        self._write('sc[i] = 1.0;')
+        self._outdent()
+        self._write('}')
+        self._write('comp_qfqr(q_f, q_r, sc, tc, invT);')
+
+        for group in groups:
+            self._write()
+            if len(group) == 1:
+                i = group[0]
+                D, S, C = system[i]
+                self._write(self.line(symbols[i]))
+                rhs = S + ['+(%s)*sc[%d]' % (join(C[j]), j) for j in sorted(C)]
+                self._write('{')
+                self._indent()
+                self._write('double den = %s;' % join(D))
+                self._write('sc[%d] = (den != 0.0) ? (%s) / den : 0.0;' % (i, join(rhs)))
+                self._outdent()
+                self._write('}')
+                continue
+
+            n = len(group)
+            self._write(self.line('coupled: %s' % ' '.join([symbols[i] for i in group])))
+            self._write('{')
+            self._indent()
+            self._write('double A[%d], b[%d];' % (n*n, n))
+            self._write('int piv[%d];' % n)
+            for a, i in enumerate(group):
+                D, S, C = system[i]
+                for b, j in enumerate(group):
+                    if a == b:
+                        self._write('A[%d] = %s;' % (a*n+b, join(D)))
+                    elif j in C:
+                        self._write('A[%d] = -(%s);' % (a*n+b, join(C[j])))
+                    else:
+                        self._write('A[%d] = 0.0;' % (a*n+b))
+                rhs = S + ['+(%s)*sc[%d]' % (join(C[j]), j) for j in sorted(C) if j not in group]
+                self._write('b[%d] = %s;' % (a, join(rhs)))
+            self._write('qss_lu(%d, A, piv);' % n)
+            self._write('qss_lusolve(%d, A, piv, b);' % n)
+            for a, i in enumerate(group):
+                self._write('sc[%d] = b[%d];' % (i, a))
+            self._outdent()
+            self._write('}')
+
+        self._write()
+        self._write(self.line('the QSS concentrations in the progress rates'))
+        for reaction in mechanism.reaction():
+            r = reaction.id - 1
+            if r in side_f:
+                self._write('q_f[%d] *= sc[%d];' % (r, side_f[r]))
+            if r in side_r and reaction.reversible:
+                self._write('q_r[%d] *= sc[%d];' % (r, side_r[r]))
+
+        self._outdent()
+        self._write('}')
+
+        self._write()
+        self._write(self.line('fill in the QSS concentrations sc[%d..%d]' % (nSpecies, nAll-1)))
+        self._write('void qssConcentrations(double * restrict sc, double T)')
+        self._write('{')
+        self._indent()
+        self._write('double tc[] = { log(T), T, T*T, T*T*T, T*T*T*T }; /*temperature cache */')
+        self._write('double invT = 1.0 / tc[1];')
+        self._write()
+        self._write('if (T != T_save)')
+        self._write('{')
+        self._indent()
+        self._write('T_save = T;')
+        self._write('comp_k_f(tc,invT,k_f_save);')
+        self._write('comp_Kc(tc,invT,Kc_save);')
+        self._outdent()
+        self._write("}")
+        self._write()
+        self._write('double q_f[%d], q_r[%d];' % (nReactions, nReactions))
+        self._write('comp_qss(q_f, q_r, sc, tc, invT);')
+        self._outdent()
+        self._write('}')
+
+        return
+
+
+    def _vproductionRateQSS(self, mechanism):
+
+        nSpecies = len(mechanism.species())
+
+        self._write()
+        self._write()
+        self._write(self.line('compute the production rate for each species, one point at a time'))
+        self._write('void vproductionRate(int npt, double * restrict wdot, double * restrict sc, double * restrict T)')
+        self._write('{')
+        self._indent()
+        self._write('double c[%d], w[%d];' % (nSpecies, nSpecies))
+        self._write('for (int i=0; i<npt; i++) {')
+        self._indent()
+        self._write('for (int k=0; k<%d; k++) {' % nSpecies)
+        self._indent()
+        self._write('c[k] = sc[k*npt+i];')
+        self._outdent()
+        self._write('}')
+        self._write('productionRate(w, c, T[i]);')
+        self._write('for (int k=0; k<%d; k++) {' % nSpecies)
+        self._indent()
+        self._write('wdot[k*npt+i] = w[k];')
+        self._outdent()
+        self._write('}')
+        self._outdent()
+        self._write('}')
+        self._outdent()
+        self._write('}')
+
+        return
+
+
+    def _productionRate(self, mechanism):
+
+        nSpecies = len(mechanism.species())
+        nReactions = len(mechanism.reaction())
+
+        itroe      = self.reactionIndex[0:2]
+        isri       = self.reactionIndex[1:3]
+        ilindemann = self.reactionIndex[2:4]
+        i3body     = self.reactionIndex[3:5] 
+        isimple    = self.reactionIndex[4:6]
+        ispecial   = self.reactionIndex[5:7]
+
+        if len(self.reactionIndex) != 7:
+            print '\n\nCheck this!!!\n'
+            sys.exit(1)
+        
+        ntroe      = itroe[1]      - itroe[0]
+        nsri       = isri[1]       - isri[0]
+        nlindemann = ilindemann[1] - ilindemann[0]
+        n3body     = i3body[1]     - i3body[0]
+        nsimple    = isimple[1]    - isimple[0]
+        nspecial   = ispecial[1]   - ispecial[0]
+
+        # OMP stuff
+        self._write()
+        self._write('static double T_save = -1;')
+        self._write('#ifdef _OPENMP')
+        self._write('#pragma omp threadprivate(T_save)')
+        self._write('#endif')
+        self._write()
+        self._write('static double k_f_save[%d];' % nReactions)
+        self._write('#ifdef _OPENMP')
+        self._write('#pragma omp threadprivate(k_f_save)')
+        self._write('#endif')
+        self._write()
+        self._write('static double Kc_save[%d];' % nReactions)
+        self._write('#ifdef _OPENMP')
+        self._write('#pragma omp threadprivate(Kc_save)')
+        self._write('#endif')
+        self._write()
+
+        # main function
+        self._write()
+        self._write(self.line('compute the production rate for each species'))
+        self._write('void productionRate(double * restrict wdot, double * restrict sc, double T)')
+        self._write('{')
+        self._indent()
+
+        self._write('double tc[] = { log(T), T, T*T, T*T*T, T*T*T*T }; /*temperature cache */')
+        self._write('double invT = 1.0 / tc[1];')
+        
+        self._write()
+        self._write('if (T != T_save)')
+        self._write('{')
+        self._indent()
+        self._write('T_save = T;')
+        self._write('comp_k_f(tc,invT,k_f_save);');
+        self._write('comp_Kc(tc,invT,Kc_save);');
+        self._outdent()
+        self._write("}")
+
+        self._write()
+        self._write('double qdot, q_f[%d], q_r[%d];' % (nReactions,nReactions))
+        self._qfqrCall(mechanism)
+
+        self._write()
+        self._write('for (int i = 0; i < %d; ++i) {' % nSpecies)
+        self._indent()
+        self._write('wdot[i] = 0.0;')
+        self._outdent()
+        self._write('}')
+
+        for i in range(nReactions):
+            self._write()
+            self._write("qdot = q_f[%d]-q_r[%d];" % (i,i))
             reaction = mechanism.reaction(id=i)
             agents = list(set(reaction.reactants + reaction.products))
             agents = sorted(agents, key=lambda x: mechanism.species(x[0]).id)
@@ -4737,6 +5526,8 @@ class CPickler(CMill):
             # agents is a set that contains unique (symbol, coefficient)
             for a in agents:
                 symbol, coefficient = a
+                if mechanism.species(symbol).id >= nSpecies:
+                    continue
                 for b in reaction.reactants:
                     if b == a:
                         if coefficient == 1:
@@ -4762,19 +5553,60 @@ class CPickler(CMill):
         self._write('void comp_k_f(double * restrict tc, double invT, double * restrict k_f)')
         self._write('{')
         self._indent()
-        self._outdent()
-        self._write('#ifdef __INTEL_COMPILER')
-        self._indent()
-        self._write('#pragma simd')
-        self._outdent()
-        self._write('#endif')
-        self._indent()
-        self._write('for (int i=0; i<%d; ++i) {' % (nReactions))
-        self._indent()
-        self._write("k_f[i] = prefactor_units[i] * fwd_A[i]")
-        self._write("            * exp(fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT);")
-        self._outdent()
-        self._write("};")
+        kfGroups = self._arrheniusGroups(mechanism)
+        if not kfGroups:
+            self._outdent()
+            self._write('#ifdef __INTEL_COMPILER')
+            self._indent()
+            self._write('#pragma simd')
+            self._outdent()
+            self._write('#endif')
+            self._indent()
+            self._write('for (int i=0; i<%d; ++i) {' % (nReactions))
+            self._indent()
+            self._write("k_f[i] = prefactor_units[i] * fwd_A[i]")
+            self._write("            * exp(fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT);")
+            self._outdent()
+            self._write("};")
+        else:
+            self._write('double x[%d];' % (nReactions))
+            self._outdent()
+            self._write('#ifdef __INTEL_COMPILER')
+            self._indent()
+            self._write('#pragma simd')
+            self._outdent()
+            self._write('#endif')
+            self._indent()
+            self._write('for (int i=0; i<%d; ++i) {' % (nReactions))
+            self._indent()
+            self._write("x[i] = fwd_beta[i] * tc[0] - activation_units[i] * fwd_Ea[i] * invT;")
+            self._outdent()
+            self._write("};")
+            self._write()
+            self._write(self.line('the exp is skipped when the exponent is zero or that of'))
+            self._write(self.line('an earlier reaction with the same default beta and Ea'))
+            for i in range(nReactions):
+                group = kfGroups.get(i)
+                if group is None:
+                    self._write("k_f[%d] = exp(x[%d]);" % (i,i))
+                elif group == 'zero':
+                    self._write("k_f[%d] = (x[%d] == 0.0 ? 1.0 : exp(x[%d]));" % (i,i,i))
+                else:
+                    self._write("k_f[%d] = (x[%d] == x[%d] ? k_f[%d] : exp(x[%d]));"
+                                % (i,i,group,group,i))
+            self._write()
+            self._outdent()
+            self._write('#ifdef __INTEL_COMPILER')
+            self._indent()
+            self._write('#pragma simd')
+            self._outdent()
+            self._write('#endif')
+            self._indent()
+            self._write('for (int i=0; i<%d; ++i) {' % (nReactions))
+            self._indent()
+            self._write("k_f[i] *= prefactor_units[i] * fwd_A[i];")
+            self._outdent()
+            self._write("};")
         self._write('return;')
         self._outdent()
         self._write('}')
@@ -4786,43 +5618,101 @@ class CPickler(CMill):
         self._indent()
 
         self._write(self.line('compute the Gibbs free energy'))
-        self._write('double g_RT[%d];' % (nSpecies))
+        self._write('double g_RT[%d];' % len(self._allSpecies(mechanism)))
         self._write('gibbs(g_RT, tc);')
+        if mechanism.qss():
+            self._write('gibbs_qss(g_RT, tc);')
 
         self._write()
 
-        for reaction in mechanism.reaction():
-            KcExpArg = self._sortedKcExpArg(mechanism, reaction)
-            self._write("Kc[%d] = %s;" % (reaction.id-1,KcExpArg))
+        kcGroups = self._equilibriumGroups(mechanism)
+        if not self.shareExp:
+            for reaction in mechanism.reaction():
+                KcExpArg = self._sortedKcExpArg(mechanism, reaction)
+                self._write("Kc[%d] = %s;" % (reaction.id-1,KcExpArg))
 
-        self._write()
+            self._write()
         
-        self._outdent()
-        self._write('#ifdef __INTEL_COMPILER')
-        self._indent()
-        self._write(' #pragma simd')
-        self._outdent()
-        self._write('#endif')
-        self._indent()
-        self._write('for (int i=0; i<%d; ++i) {' % (nReactions))
-        self._indent()
-        self._write("Kc[i] = exp(Kc[i]);")
-        self._outdent()
-        self._write("};")
+            self._outdent()
+            self._write('#ifdef __INTEL_COMPILER')
+            self._indent()
+            self._write(' #pragma simd')
+            self._outdent()
+            self._write('#endif')
+            self._indent()
+            self._write('for (int i=0; i<%d; ++i) {' % (nReactions))
+            self._indent()
+            self._write("Kc[i] = exp(Kc[i]);")
+            self._outdent()
+            self._write("};")
 
-        self._write()
+            self._write()
 
-        self._write(self.line('reference concentration: P_atm / (RT) in inverse mol/m^3'))
-        self._write('double refC = %g / %g * invT;' % (atm.value, R.value))
-        self._write('double refCinv = 1 / refC;')
+            self._write(self.line('reference concentration: P_atm / (RT) in inverse mol/m^3'))
+            self._write('double refC = %g / %g * invT;' % (atm.value, R.value))
+            self._write('double refCinv = 1 / refC;')
 
-        self._write()
+            self._write()
+
+            for reaction in mechanism.reaction():
+                KcConv = self._KcConv(mechanism, reaction)
+                if KcConv:
+                    self._write("Kc[%d] *= %s;" % (reaction.id-1,KcConv))        
+        else:
+            nAll = len(self._allSpecies(mechanism))
+            self._write(self.line('reference concentration: P_atm / (RT) in inverse mol/m^3'))
+            self._write('double refC = %g / %g * invT;' % (atm.value, R.value))
+            self._write('double refCinv = 1 / refC;')
+
+            self._write()
+
+            self._write(self.line('Kc as the ratio of the products of the species exp(g_RT)/refC, unless'))
+            self._write(self.line('the product over a side of a reaction leaves the normal range'))
+            self._write('double e_g[%d], den[%d];' % (nAll, nReactions))
+            self._write('for (int k=0; k<%d; ++k) {' % (nAll))
+            self._indent()
+            self._write('e_g[k] = exp(g_RT[k]) * refCinv;')
+            self._outdent()
+            self._write('}')
+            for reaction in mechanism.reaction():
+                self._write("Kc[%d] = %s; den[%d] = %s;"
+                            % (reaction.id-1, self._sortedPhaseSpace(mechanism, reaction.reactants, "e_g"),
+                               reaction.id-1, self._sortedPhaseSpace(mechanism, reaction.products, "e_g")))
+            self._write('int inrange = 1;')
+            self._write('for (int i=0; i<%d; ++i) {' % (nReactions))
+            self._indent()
+            self._write('inrange &= Kc[i] >= DBL_MIN && Kc[i] <= DBL_MAX && den[i] >= DBL_MIN && den[i] <= DBL_MAX;')
+            self._outdent()
+            self._write('}')
+            self._write()
+            self._write('if (inrange) {')
+            self._indent()
+            self._write('for (int i=0; i<%d; ++i) {' % (nReactions))
+            self._indent()
+            self._write('Kc[i] /= den[i];')
+            self._outdent()
+            self._write('}')
+            self._outdent()
+            self._write('}')
+            self._write('else {')
+            self._indent()
+            for reaction in mechanism.reaction():
+                if reaction.id-1 not in kcGroups:
+                    KcExpArg = self._sortedKcExpArg(mechanism, reaction)
+                    self._write("Kc[%d] = exp(%s);" % (reaction.id-1,KcExpArg))
+            self._write()
+            self._write(self.line('reactions with the net stoichiometry of an earlier one'))
+            for reaction in mechanism.reaction():
+                if reaction.id-1 in kcGroups:
+                    self._write("Kc[%d] = Kc[%d];" % (reaction.id-1,kcGroups[reaction.id-1]))
+            self._write()
+            for reaction in mechanism.reaction():
+                KcConv = self._KcConv(mechanism, reaction)
+                if KcConv:
+                    self._write("Kc[%d] *= %s;" % (reaction.id-1,KcConv))
+            self._outdent()
+            self._write('}')
 
-        for reaction in mechanism.reaction():
-            KcConv = self._KcConv(mechanism, reaction)
-            if KcConv:
-                self._write("Kc[%d] *= %s;" % (reaction.id-1,KcConv))        
-        
         self._write()
 
         self._write('return;')
@@ -4862,6 +5752,9 @@ class CPickler(CMill):
         self._outdent()
         self._write('}')
 
+        tbGroups = self._enhancementGroups(mechanism, [mechanism.reaction(id=i) for i in range(nclassd)])
+        self._sharedEnhancements(mechanism, tbGroups)
+
         self._write()
         self._write("double Corr[%d];" % nclassd)
         self._write('for (int i = 0; i < %d; ++i) {' % nclassd)
@@ -4881,7 +5774,7 @@ class CPickler(CMill):
                 ii = i - itroe[0]
                 reaction = mechanism.reaction(id=i)
                 if reaction.thirdBody:
-                    alpha = self._enhancement(mechanism, reaction)
+                    alpha = self._sharedEnhancement(mechanism, reaction, tbGroups)
                     if alpha in alpha_d:
                         self._write("alpha[%d] = %s;" %(ii,alpha_d[alpha]))
                     else:
@@ -4934,7 +5827,7 @@ class CPickler(CMill):
                 ii = i - isri[0]
                 reaction = mechanism.reaction(id=i)
                 if reaction.thirdBody:
-                    alpha = self._enhancement(mechanism, reaction)
+                    alpha = self._sharedEnhancement(mechanism, reaction, tbGroups)
                     if alpha in alpha_d:
                         self._write("alpha[%d] = %s;" %(ii,alpha_d[alpha]))
                     else:
@@ -4984,7 +5877,7 @@ class CPickler(CMill):
                 ii = i - ilindemann[0]
                 reaction = mechanism.reaction(id=i)
                 if reaction.thirdBody:
-                    alpha = self._enhancement(mechanism, reaction)
+                    alpha = self._sharedEnhancement(mechanism, reaction, tbGroups)
                     if nlindemann > 1:
                         self._write("alpha[%d] = %s;" %(ii,alpha))
                     else:
@@ -5025,7 +5918,7 @@ class CPickler(CMill):
             for i in range(i3body[0],i3body[1]):
                 reaction = mechanism.reaction(id=i)
                 if reaction.thirdBody:
-                    alpha = self._enhancement(mechanism, reaction)
+                    alpha = self._sharedEnhancement(mechanism, reaction, tbGroups)
                     if alpha != alpha_save:
                         alpha_save = alpha
                         self._write("alpha = %s;" % alpha)
@@ -5148,14 +6041,30 @@ class CPickler(CMill):
 
         nSpecies = len(mechanism.species())
         nReactions = len(mechanism.reaction())
+        qss = mechanism.qss()
+        nAll = nSpecies + len(qss)
 
         self._write()
         self._write(self.line('compute the reaction Jacobian'))
-        self._write('void aJacobian(double * restrict J, double * restrict sc, double T, int consP)')
+        if qss:
+            self._write('void aJacobian(double * restrict J_out, double * restrict sc_in, double T, int consP)')
+        else:
+            self._write('void aJacobian(double * restrict J, double * restrict sc, double T, int consP)')
         self._write('{')
         self._indent()
 
-        self._write('for (int i=0; i<%d; i++) {' % (nSpecies+1)**2)
+        if qss:
+            self._write(self.line('Jacobian with respect to all species, QSS ones included'))
+            self._write('double J[%d], sc[%d];' % ((nAll+1)**2, nAll))
+            self._write('for (int k=0; k<%d; k++) {' % (nSpecies))
+            self._indent()
+            self._write('sc[k] = sc_in[k];')
+            self._outdent()
+            self._write('}')
+            self._write('qssConcentrations(sc, T);')
+            self._write()
+
+        self._write('for (int i=0; i<%d; i++) {' % (nAll+1)**2)
         self._indent()
         self._write('J[i] = 0.0;')
         self._outdent()
@@ -5163,8 +6072,8 @@ class CPickler(CMill):
         
         self._write()
 
-        self._write('double wdot[%d];' % (nSpecies))
-        self._write('for (int k=0; k<%d; k++) {' % (nSpecies))
+        self._write('double wdot[%d];' % (nAll))
+        self._write('for (int k=0; k<%d; k++) {' % (nAll))
         self._indent()
         self._write('wdot[k] = 0.0;')
         self._outdent()
@@ -5194,48 +6103,54 @@ class CPickler(CMill):
 
         self._write()
 
-        self._write(self.line('compute the Gibbs free energy'))
-        self._write('double g_RT[%d];' % (nSpecies))
-        self._write('gibbs(g_RT, tc);')
+        if not self.shareExp:
+            self._write(self.line('compute the Gibbs free energy'))
+            self._write('double g_RT[%d];' % (nAll))
+            self._write('gibbs(g_RT, tc);')
+            if qss:
+                self._write('gibbs_qss(g_RT, tc);')
 
-        self._write()
+            self._write()
 
         self._write(self.line('compute the species enthalpy'))
-        self._write('double h_RT[%d];' % (nSpecies))
+        self._write('double h_RT[%d];' % (nAll))
         self._write('speciesEnthalpy(h_RT, tc);')
+        if qss:
+            self._write('speciesEnthalpy_qss(h_RT, tc);')
 
         self._write()
 
-        self._write('double phi_f, k_f, k_r, phi_r, Kc, q, q_nocor, Corr, alpha;') 
-        self._write('double dlnkfdT, dlnk0dT, dlnKcdT, dkrdT, dqdT;')
-        self._write('double dqdci, dcdc_fac, dqdc[%d];' % (nSpecies))
-        self._write('double Pr, fPr, F, k_0, logPr;') 
-        self._write('double logFcent, troe_c, troe_n, troePr_den, troePr, troe;')
-        self._write('double Fcent1, Fcent2, Fcent3, Fcent;')
-        self._write('double dlogFdc, dlogFdn, dlogFdcn_fac;')
-        self._write('double dlogPrdT, dlogfPrdT, dlogFdT, dlogFcentdT, dlogFdlogPr, dlnCorrdT;')
-        self._write('const double ln10 = log(10.0);')
-        self._write('const double log10e = 1.0/log(10.0);')
+        if self.shareExp:
+            self._write(self.line('compute the rate and equilibrium constants'))
+            self._write('double k_f_s[%d], Kc_s[%d];' % (nReactions, nReactions))
+            self._write('comp_k_f(tc, invT, k_f_s);')
+            self._write('comp_Kc(tc, invT, Kc_s);')
 
-        for i, reaction in zip(range(nReactions), mechanism.reaction()):
+            self._write()
 
-            lt = reaction.lt
-            if lt:
-                print "Landau-Teller reactions are not supported"
-                sys.exit(1)
+            self._write(self.line('at constant volume, the part of dwdot/d[X] common to all species'))
+            self._write('double Jmix[%d];' % (nAll))
+            self._write('for (int k=0; k<%d; k++) {' % (nAll))
+            self._indent()
+            self._write('Jmix[k] = 0.0;')
+            self._outdent()
+            self._write('}')
 
-            self._write(self.line('reaction %d: %s' % (i+1, reaction.equation())))
-            if reaction.low:  # case 1
-                self._write(self.line('a pressure-fall-off reaction'))
-                self._ajac_reaction(mechanism, reaction, 1)
-            elif reaction.thirdBody:  # case 2
-                self._write(self.line('a third-body and non-pressure-fall-off reaction'))
-                self._ajac_reaction(mechanism, reaction, 2)
-            else:  # case 3
-                self._write(self.line('a non-third-body and non-pressure-fall-off reaction'))
-                self._ajac_reaction(mechanism, reaction, 3)
             self._write()
 
+        chunk = self.jacobianChunk
+        if chunk > 0 and nReactions > chunk:
+            chunks = [(lo, min(lo+chunk, nReactions)) for lo in range(0, nReactions, chunk)]
+        else:
+            chunks = []
+
+        if chunks:
+            for lo, hi in chunks:
+                self._write('aJacobian_%d_%d(J, Jmix, wdot, sc, T, consP, tc, invT, invT2, refC, refCinv, mixture, h_RT, k_f_s, Kc_s);' % (lo+1, hi))
+            self._write()
+        else:
+            self._ajac_reactions(mechanism, 0, nReactions)
+
         self._write('double c_R[%d], dcRdT[%d], e_RT[%d];' % (nSpecies, nSpecies, nSpecies))
         self._write('double * eh_RT;')
         self._write('if (consP) {')
@@ -5254,20 +6169,36 @@ class CPickler(CMill):
         self._write('dcvpRdT(dcRdT, tc);')
         self._write('speciesInternalEnergy(e_RT, tc);');
         self._write('eh_RT = &e_RT[0];');
+        if self.shareExp:
+            self._write('for (int k=0; k<%d; k++) {' % (nSpecies))
+            self._indent()
+            self._write('for (int m=0; m<%d; m++) {' % (nAll))
+            self._indent()
+            self._write('J[k*%d+m] += Jmix[m];' % (nAll+1))
+            self._outdent()
+            self._write('}')
+            self._outdent()
+            self._write('}')
 
         self._outdent()
         self._write('}')
 
         self._write()
 
+        if qss:
+            self._ajac_qss(mechanism)
+            Jn = 'J_out'
+        else:
+            Jn = 'J'
+
         self._write('double cmix = 0.0, ehmix = 0.0, dcmixdT=0.0, dehmixdT=0.0;')
         self._write('for (int k = 0; k < %d; ++k) {' % nSpecies)
         self._indent()
         self._write('cmix += c_R[k]*sc[k];')
         self._write('dcmixdT += dcRdT[k]*sc[k];')
         self._write('ehmix += eh_RT[k]*wdot[k];')
-        self._write('dehmixdT += invT*(c_R[k]-eh_RT[k])*wdot[k] + eh_RT[k]*J[%d+k];' % \
-                        (nSpecies*(nSpecies+1)))
+        self._write('dehmixdT += invT*(c_R[k]-eh_RT[k])*wdot[k] + eh_RT[k]*%s[%d+k];' % \
+                        (Jn, nSpecies*(nSpecies+1)))
         self._outdent()
         self._write('}')
 
@@ -5284,23 +6215,145 @@ class CPickler(CMill):
         self._write('dehmixdc = 0.0;')
         self._write('for (int m = 0; m < %d; ++m) {' % nSpecies)
         self._indent()
-        self._write('dehmixdc += eh_RT[m]*J[k*%s+m];' % (nSpecies+1))
+        self._write('dehmixdc += eh_RT[m]*%s[k*%s+m];' % (Jn, nSpecies+1))
         self._outdent()
         self._write('}')        
-        self._write('J[k*%d+%d] = tmp2*c_R[k] - tmp3*dehmixdc;' % (nSpecies+1,nSpecies))
+        self._write('%s[k*%d+%d] = tmp2*c_R[k] - tmp3*dehmixdc;' % (Jn, nSpecies+1,nSpecies))
         self._outdent()
         self._write('}')
 
         self._write('/* dTdot/dT */')
-        self._write('J[%d] = -tmp1 + tmp2*dcmixdT - tmp3*dehmixdT;' % \
-                        (nSpecies*(nSpecies+1)+nSpecies))
+        self._write('%s[%d] = -tmp1 + tmp2*dcmixdT - tmp3*dehmixdT;' % \
+                        (Jn, nSpecies*(nSpecies+1)+nSpecies))
+
+        self._outdent()
+        self._write('}')
+
+        # the reactions lo+1..hi, each chunk in a unit of its own
+        for lo, hi in chunks:
+            name = 'aJacobian_%d_%d' % (lo+1, hi)
+            args = ('double * restrict J, double * restrict Jmix, double * restrict wdot, double * restrict sc, '
+                    'double T, int consP, double * restrict tc, double invT, double invT2, '
+                    'double refC, double refCinv, double mixture, double * restrict h_RT, '
+                    'double * restrict k_f_s, double * restrict Kc_s')
+            self.headerExtra.append('void %s(%s);' % (name, args))
+
+            self._unit('jacobian_%d_%d' % (lo+1, hi))
+            self._write()
+            self._write(self.line('reactions %d to %d of the reaction Jacobian' % (lo+1, hi)))
+            self._write('void %s(%s)' % (name, args))
+            self._write('{')
+            self._indent()
+            self._ajac_reactions(mechanism, lo, hi)
+            self._outdent()
+            self._write('}')
+
+        return
+
+
+    def _ajac_qss(self, mechanism):
+
+        nSpecies = len(mechanism.species())
+        nQSS = len(mechanism.qss())
+        nAll = nSpecies + nQSS
 
+        self._write(self.line('eliminate the QSS species: d[X_q] = -(dwdot_q/d[X_q])^-1 dwdot_q'))
+        self._write('double A[%d], dX[%d];' % (nQSS*nQSS, nQSS))
+        self._write('int piv[%d];' % (nQSS))
+        self._write('for (int i=0; i<%d; i++) {' % (nQSS))
+        self._indent()
+        self._write('for (int j=0; j<%d; j++) {' % (nQSS))
+        self._indent()
+        self._write('A[i*%d+j] = J[(%d+j)*%d+%d+i];' % (nQSS, nSpecies, nAll+1, nSpecies))
+        self._outdent()
+        self._write('}')
+        self._outdent()
+        self._write('}')
+        self._write('qss_lu(%d, A, piv);' % (nQSS))
+        self._write(self.line('row k of J_out: the species k, then T'))
+        self._write('for (int k=0; k<=%d; k++) {' % (nSpecies))
+        self._indent()
+        self._write('int kf = (k < %d) ? k : %d;' % (nSpecies, nAll))
+        self._write('for (int i=0; i<%d; i++) {' % (nQSS))
+        self._indent()
+        self._write('dX[i] = -J[kf*%d+%d+i];' % (nAll+1, nSpecies))
+        self._outdent()
+        self._write('}')
+        self._write('qss_lusolve(%d, A, piv, dX);' % (nQSS))
+        self._write('for (int m=0; m<%d; m++) {' % (nSpecies))
+        self._indent()
+        self._write('double dw = J[kf*%d+m];' % (nAll+1))
+        self._write('for (int j=0; j<%d; j++) {' % (nQSS))
+        self._indent()
+        self._write('dw += J[(%d+j)*%d+m]*dX[j];' % (nSpecies, nAll+1))
+        self._outdent()
+        self._write('}')
+        self._write('J_out[k*%d+m] = dw;' % (nSpecies+1))
+        self._outdent()
+        self._write('}')
         self._outdent()
         self._write('}')
+        self._write()
+
         return
 
 
-    def _ajac_reaction(self, mechanism, reaction, rcase):
+    def _ajac_reactions(self, mechanism, lo, hi):
+
+        nSpecies = len(self._allSpecies(mechanism))
+        reactions = mechanism.reaction()[lo:hi]
+        shared = {
+            'alpha': self._enhancementGroups(mechanism, reactions),
+            'low': self._falloffGroups(reactions, 'low'),
+            'troe': self._falloffGroups(reactions, 'troe'),
+            }
+
+        self._write('double phi_f, k_f, k_r, phi_r, Kc, q, q_nocor, Corr, alpha;') 
+        self._write('double dlnkfdT, dlnk0dT, dlnKcdT, dkrdT, dqdT;')
+        if self.shareExp:
+            self._write('double dqdci, dcdc_fac;')
+        else:
+            self._write('double dqdci, dcdc_fac, dqdc[%d];' % (nSpecies))
+        self._write('double Pr, fPr, F, k_0, logPr;') 
+        self._write('double logFcent, troe_c, troe_n, troePr_den, troePr, troe;')
+        self._write('double Fcent1, Fcent2, Fcent3, Fcent;')
+        self._write('double dlogFdc, dlogFdn, dlogFdcn_fac;')
+        self._write('double dlogPrdT, dlogfPrdT, dlogFdT, dlogFcentdT, dlogFdlogPr, dlnCorrdT;')
+        self._write('const double ln10 = log(10.0);')
+        self._write('const double log10e = 1.0/log(10.0);')
+        nlow = len(set(shared['low'].values()))
+        if nlow:
+            self._write('double x_0, x_0_s[%d], e_0_s[%d];' % (nlow, nlow))
+        ntroe = len(set(shared['troe'].values()))
+        if ntroe:
+            self._write('double logFcent_s[%d], dlogFcentdT_s[%d];' % (ntroe, ntroe))
+        self._sharedEnhancements(mechanism, shared['alpha'])
+        self._write()
+
+        for i in range(lo, hi):
+            reaction = mechanism.reaction()[i]
+
+            lt = reaction.lt
+            if lt:
+                print "Landau-Teller reactions are not supported"
+                sys.exit(1)
+
+            self._write(self.line('reaction %d: %s' % (i+1, reaction.equation())))
+            if reaction.low:  # case 1
+                self._write(self.line('a pressure-fall-off reaction'))
+                self._ajac_reaction(mechanism, reaction, 1, shared)
+            elif reaction.thirdBody:  # case 2
+                self._write(self.line('a third-body and non-pressure-fall-off reaction'))
+                self._ajac_reaction(mechanism, reaction, 2, shared)
+            else:  # case 3
+                self._write(self.line('a non-third-body and non-pressure-fall-off reaction'))
+                self._ajac_reaction(mechanism, reaction, 3, shared)
+            self._write()
+
+        return
+
+
+    def _ajac_reaction(self, mechanism, reaction, rcase, shared):
 
         if rcase == 1: # pressure-dependent reaction
             isPD = True
@@ -5322,7 +6375,8 @@ class CPickler(CMill):
             print '_ajac_reaction: wrong case ', rcase
             exit(1)
 
-        nSpecies = len(mechanism.species())
+        allSpecies = self._allSpecies(mechanism)
+        nSpecies = len(allSpecies)
         rea_dict = {}
         pro_dict = {}
         all_dict = {}
@@ -5376,22 +6430,37 @@ class CPickler(CMill):
 
         if has_alpha:
             self._write("/* 3-body correction factor */")
-            self._write("alpha = %s;" % self._enhancement(mechanism, reaction))
+            self._write("alpha = %s;" % self._sharedEnhancement(mechanism, reaction, shared['alpha']))
 
         # forward
         self._write('/* forward */')
         self._write("phi_f = %s;" % self._sortedPhaseSpace(mechanism, sorted_reactants))
         #
-        self._write("k_f = prefactor_units[%d] * fwd_A[%d]" % (reaction.id-1,reaction.id-1))
-        self._write("            * exp(fwd_beta[%d] * tc[0] - activation_units[%d] * fwd_Ea[%d] * invT);"
-                    %(reaction.id-1,reaction.id-1,reaction.id-1))
+        if self.shareExp:
+            self._write("k_f = k_f_s[%d];" % (reaction.id-1))
+        else:
+            self._write("k_f = prefactor_units[%d] * fwd_A[%d]" % (reaction.id-1,reaction.id-1))
+            self._write("            * exp(fwd_beta[%d] * tc[0] - activation_units[%d] * fwd_Ea[%d] * invT);"
+                        %(reaction.id-1,reaction.id-1,reaction.id-1))
         self._write("dlnkfdT = fwd_beta[%d] * invT + activation_units[%d] * fwd_Ea[%d] * invT2;"
                     %(reaction.id-1,reaction.id-1,reaction.id-1))
 
         if isPD:
             self._write('/* pressure-fall-off */')
-            self._write("k_0 = low_A[%d] * exp(low_beta[%d] * tc[0] - activation_units[%d] * low_Ea[%d] * invT);"
-                        %(reaction.id-1,reaction.id-1,reaction.id-1,reaction.id-1))
+            r = reaction.id-1
+            if r in shared['low']:
+                # the exp of another reaction with the same exponent at run time
+                g, leader = shared['low'][r]
+                self._write("x_0 = low_beta[%d] * tc[0] - activation_units[%d] * low_Ea[%d] * invT;" % (r,r,r))
+                if leader == r:
+                    self._write("x_0_s[%d] = x_0;" % g)
+                    self._write("e_0_s[%d] = exp(x_0);" % g)
+                    self._write("k_0 = low_A[%d] * e_0_s[%d];" % (r,g))
+                else:
+                    self._write("k_0 = low_A[%d] * (x_0 == x_0_s[%d] ? e_0_s[%d] : exp(x_0));" % (r,g,g))
+            else:
+                self._write("k_0 = low_A[%d] * exp(low_beta[%d] * tc[0] - activation_units[%d] * low_Ea[%d] * invT);"
+                            %(reaction.id-1,reaction.id-1,reaction.id-1,reaction.id-1))
             self._write('Pr = phase_units[%d] * alpha / k_f * k_0;' % (reaction.id-1))
             self._write('fPr = Pr / (1.0+Pr);')
             self._write("dlnk0dT = low_beta[%d] * invT + activation_units[%d] * low_Ea[%d] * invT2;"
@@ -5405,7 +6474,22 @@ class CPickler(CMill):
             elif reaction.troe:
                 self._write('/* Troe form */')
                 troe = reaction.troe
+                r = reaction.id-1
                 self._write("logPr = log10(Pr);")
+                g, leader = shared['troe'].get(r, (None, r))
+                if leader != r:
+                    # Fcent of another reaction with the same parameters at run time
+                    self._write('if (troe_a[%d] == troe_a[%d] && troe_Tsss[%d] == troe_Tsss[%d] && troe_Ts[%d] == troe_Ts[%d]'
+                                % (r,leader,r,leader,r,leader))
+                    self._write('    && troe_Tss[%d] == troe_Tss[%d] && troe_len[%d] == troe_len[%d]) {'
+                                % (r,leader,r,leader))
+                    self._indent()
+                    self._write('logFcent = logFcent_s[%d];' % g)
+                    self._write('dlogFcentdT = dlogFcentdT_s[%d];' % g)
+                    self._outdent()
+                    self._write('}')
+                    self._write('else {')
+                    self._indent()
                 self._write('Fcent1 = (fabs(troe_Tsss[%d]) > 1.e-100 ? (1.-troe_a[%d])*exp(-T/troe_Tsss[%d]) : 0.);'
                             %(reaction.id-1,reaction.id-1,reaction.id-1))
                 self._write('Fcent2 = (fabs(troe_Ts[%d]) > 1.e-100 ? troe_a[%d] * exp(-T/troe_Ts[%d]) : 0.);'
@@ -5414,13 +6498,6 @@ class CPickler(CMill):
                             %(reaction.id-1,reaction.id-1))
                 self._write('Fcent = Fcent1 + Fcent2 + Fcent3;')
                 self._write("logFcent = log10(Fcent);")
-                self._write("troe_c = -.4 - .67 * logFcent;")
-                self._write("troe_n = .75 - 1.27 * logFcent;")
-                self._write("troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));")
-                self._write("troePr = (troe_c + logPr) * troePr_den;")
-                self._write("troe = 1.0 / (1.0 + troePr*troePr);")
-                self._write("F = pow(10.0, logFcent * troe);")
-
                 self._write("dlogFcentdT = log10e/Fcent*( ")
                 self._write("    (fabs(troe_Tsss[%d]) > 1.e-100 ? -Fcent1/troe_Tsss[%d] : 0.)"
                             %(reaction.id-1,reaction.id-1))
@@ -5428,6 +6505,19 @@ class CPickler(CMill):
                             %(reaction.id-1,reaction.id-1))
                 self._write("  + (troe_len[%d] == 4 ? Fcent3*troe_Tss[%d]*invT2 : 0.) );"
                             %(reaction.id-1,reaction.id-1))
+                if leader != r:
+                    self._outdent()
+                    self._write('}')
+                elif g is not None:
+                    self._write('logFcent_s[%d] = logFcent;' % g)
+                    self._write('dlogFcentdT_s[%d] = dlogFcentdT;' % g)
+                self._write("troe_c = -.4 - .67 * logFcent;")
+                self._write("troe_n = .75 - 1.27 * logFcent;")
+                self._write("troePr_den = 1.0 / (troe_n - .14*(troe_c + logPr));")
+                self._write("troePr = (troe_c + logPr) * troePr_den;")
+                self._write("troe = 1.0 / (1.0 + troePr*troePr);")
+                self._write("F = pow(10.0, logFcent * troe);")
+
 
                 self._write("dlogFdcn_fac = 2.0 * logFcent * troe*troe * troePr * troePr_den;")
                 self._write('dlogFdc = -troe_n * dlogFdcn_fac * troePr_den;')
@@ -5461,7 +6551,10 @@ class CPickler(CMill):
         else:
             self._write('/* reverse */')
             self._write("phi_r = %s;" % self._sortedPhaseSpace(mechanism, sorted_products))
-            self._write('Kc = %s;' % self._sortedKc(mechanism, reaction))
+            if self.shareExp:
+                self._write('Kc = Kc_s[%d];' % (reaction.id-1))
+            else:
+                self._write('Kc = %s;' % self._sortedKc(mechanism, reaction))
             self._write('k_r = k_f / Kc;')
 
             dlnKcdT_s = 'invT * ('
@@ -5557,7 +6650,58 @@ class CPickler(CMill):
                     dqdc_s += ' - k_r%s' % dps_s
             return dqdc_s
 
-        if has_alpha or isPD:
+        if (has_alpha or isPD) and self.shareExp:
+
+            # at constant volume, a mixture third body adds dcdc_fac (or
+            # q_nocor) to dq/d[X] of every species; it goes to Jmix, added
+            # to all the columns once for all the reactions
+            if reaction.thirdBody[0] == "<mixture>":
+                if isPD:
+                    fac = 'dcdc_fac'
+                else:
+                    fac = 'q_nocor'
+                self._write('/* d()/d[X] at constant volume, same for all species */')
+                for m in sorted(all_dict.keys()):
+                    if all_dict[m][1] != 0:
+                        s1 = 'Jmix[%d] += %.17g * %s;' % (m, all_dict[m][1], fac)
+                        s1 = s1.replace('+= 1 *', '+=').replace('+= -1 *', '-=')
+                        self._write(s1)
+
+            for k in range(nSpecies):
+                dqdc_s = self._Denhancement(mechanism,reaction,k,True)
+                if dqdc_s != "0":
+                    if isPD:
+                        if dqdc_s == "1":
+                            dqdc_s ='dcdc_fac'
+                        else:
+                            dqdc_s +='*dcdc_fac'
+                    elif has_alpha:
+                        if dqdc_s == "1":
+                            dqdc_s ='q_nocor'
+                        else:
+                            dqdc_s +='*q_nocor'
+
+                dqdc_s = dqdc_simple(dqdc_s,k)
+                if dqdc_s:
+                    symb_k = allSpecies[k].symbol
+                    self._write('/* d()/d[%s] */' % symb_k)
+                    self._write('dqdci = %s;' % (dqdc_s))
+                    #
+                    for m in sorted(all_dict.keys()):
+                        if all_dict[m][1] != 0:
+                            s1 = 'J[%d] += %.17g * dqdci;' % (k*(nSpecies+1)+m, all_dict[m][1])
+                            s1 = s1.replace('+= 1 *', '+=').replace('+= -1 *', '-=')
+                            s2 = '/* dwdot[%s]/d[%s] */' % (all_dict[m][0], symb_k)
+                            self._write(s1.ljust(30) + s2)
+
+            for m in sorted(all_dict.keys()):
+                if all_dict[m][1] != 0:
+                    s1 = 'J[%d] += %.17g * dqdT; /* dwdot[%s]/dT */' % \
+                        (nSpecies*(nSpecies+1)+m, all_dict[m][1], all_dict[m][0])
+                    s1 = s1.replace('+= 1 *', '+=').replace('+= -1 *', '-=')
+                    self._write(s1)
+
+        elif has_alpha or isPD:
 
             self._write('if (consP) {')
             self._indent()
@@ -5578,7 +6722,7 @@ class CPickler(CMill):
 
                 dqdc_s = dqdc_simple(dqdc_s,k)
                 if dqdc_s:
-                    symb_k = self.species[k].symbol
+                    symb_k = allSpecies[k].symbol
                     self._write('/* d()/d[%s] */' % symb_k)
                     self._write('dqdci = %s;' % (dqdc_s))
                     #
@@ -5597,18 +6741,21 @@ class CPickler(CMill):
             for k in range(nSpecies):
                 dqdc_s = self._Denhancement(mechanism,reaction,k,False)
                 if dqdc_s != '0':
-                    if dqdc_s == '1':
-                        dqdc_s ='dcdc_fac'
-                    elif isPD:
-                        dqdc_s +='*dcdc_fac'
-                elif has_alpha:
-                    if dqdc_s == '1':
-                        dqdc_s ='q_nocor'
-                    else:
-                        dqdc_s +='*q_nocor'
+                    if isPD:
+                        if dqdc_s == '1':
+                            dqdc_s ='dcdc_fac'
+                        else:
+                            dqdc_s +='*dcdc_fac'
+                    elif has_alpha:
+                        if dqdc_s == '1':
+                            dqdc_s ='q_nocor'
+                        else:
+                            dqdc_s +='*q_nocor'
                 dqdc_s = dqdc_simple(dqdc_s,k)
                 if dqdc_s:
                     self._write('dqdc[%d] = %s;' % (k,dqdc_s))
+                else:
+                    self._write('dqdc[%d] = 0.0;' % (k))
 
             self._write('for (int k=0; k<%d; k++) {' % nSpecies)
             self._indent()
@@ -5657,6 +6804,10 @@ class CPickler(CMill):
 
     def _vproductionRate(self, mechanism):
 
+        if mechanism.qss():
+            self._vproductionRateQSS(mechanism)
+            return
+
         nSpecies = len(mechanism.species())
         nReactions = len(mechanism.reaction())
 
@@ -5964,7 +7115,7 @@ class CPickler(CMill):
 
         self._write()
         self._write('double q_f[%d], q_r[%d];' % (nReactions,nReactions))
-        self._write('comp_qfqr(q_f, q_r, sc, tc, invT);');
+        self._qfqrCall(mechanism)
 
         self._write()
         self._write('for (int i = 0; i < %d; ++i) {' % nReactions)
@@ -6300,7 +7451,7 @@ class CPickler(CMill):
         self._write("}")
 
         self._write()
-        self._write('comp_qfqr(q_f, q_r, sc, tc, invT);');
+        self._qfqrCall(mechanism)
 
         self._write()
         self._write('return;')
@@ -6554,12 +7705,12 @@ class CPickler(CMill):
 
         return "*".join(phi)
 
-    def _sortedPhaseSpace(self, mechanism, reagents):
+    def _sortedPhaseSpace(self, mechanism, reagents, array="sc"):
 
         phi = []
 
         for symbol, coefficient in sorted(reagents,key=lambda x:mechanism.species(x[0]).id):
-            conc = "sc[%d]" % mechanism.species(symbol).id
+            conc = "%s[%d]" % (array, mechanism.species(symbol).id)
             phi += [conc] * coefficient
 
         return "*".join(phi)
@@ -6628,6 +7779,91 @@ class CPickler(CMill):
 
         return " + ".join(alpha).replace('+ -','- ')
 
+    def _enhancementGroups(self, mechanism, reactions):
+        # reaction index -> (name of the enhancement, index of the reaction
+        # it is computed for) for the reactions whose default third-body
+        # efficiencies are those of another of the reactions
+        groups = {}
+        if not self.shareExp:
+            return groups
+        members = {}
+        keys = []
+        for reaction in reactions:
+            if not reaction.thirdBody or not reaction.efficiencies:
+                continue
+            key = (reaction.thirdBody[0], tuple(reaction.efficiencies))
+            if key not in members:
+                members[key] = []
+                keys.append(key)
+            members[key].append(reaction.id-1)
+        shared = 0
+        for key in keys:
+            if len(members[key]) > 1:
+                for i in members[key]:
+                    groups[i] = ('alpha_eff%d' % shared, members[key][0])
+                shared += 1
+        return groups
+
+
+    def _falloffGroups(self, reactions, kind):
+        # reaction index -> (index of the shared values, index of the
+        # reaction they are computed for) for the fall-off reactions with
+        # the default low-pressure beta and Ea (kind 'low') or the default
+        # Troe parameters (kind 'troe') of another of the reactions
+        groups = {}
+        if not self.shareExp:
+            return groups
+        members = {}
+        keys = []
+        for reaction in reactions:
+            if not reaction.low:
+                continue
+            if kind == 'low':
+                key = (reaction.low[1], reaction.low[2], reaction.units["activation"])
+            elif reaction.troe:
+                key = tuple(reaction.troe)
+            else:
+                continue
+            if key not in members:
+                members[key] = []
+                keys.append(key)
+            members[key].append(reaction.id-1)
+        shared = 0
+        for key in keys:
+            if len(members[key]) > 1:
+                for i in members[key]:
+                    groups[i] = (shared, members[key][0])
+                shared += 1
+        return groups
+
+
+    def _sharedEnhancements(self, mechanism, groups):
+        # the enhancements shared through groups, see _sharedEnhancement
+        leaders = [(name, i) for i, (name, leader) in groups.items() if leader == i]
+        if not leaders:
+            return
+        self._write()
+        self._write(self.line('third-body efficiencies shared by several reactions'))
+        for name, i in sorted(leaders):
+            reaction = mechanism.reaction(id=i)
+            self._write('double %s = %s;' % (name, self._enhancement(mechanism, reaction)))
+        return
+
+
+    def _sharedEnhancement(self, mechanism, reaction, groups):
+        # the efficiencies can be changed at run time, so the shared sum
+        # is used only while they still equal those it was computed with
+        alpha = self._enhancement(mechanism, reaction)
+        i = reaction.id-1
+        if i not in groups:
+            return alpha
+        name, leader = groups[i]
+        if leader == i:
+            return name
+        return '(memcmp(TB[%d], TB[%d], %d*sizeof(double)) == 0 ? %s : %s)' \
+            % (i, leader, len(reaction.efficiencies), name, alpha)
+
+
     def _Denhancement(self, mechanism, reaction, kid, consP):
         thirdBody = reaction.thirdBody
         if not thirdBody:
@@ -6635,6 +7871,10 @@ class CPickler(CMill):
             pyre.debug.Firewall.hit("_enhancement called for a reaction without a third body")
             return
 
+        # QSS species are neither in the mixture nor in the efficiencies
+        if kid >= len(mechanism.species()):
+            return "0"
+
         species, coefficient = thirdBody
         efficiencies = reaction.efficiencies
 
@@ -6835,13 +8075,16 @@ class CPickler(CMill):
         return
 
 
-    def _analyzeThermodynamics(self, mechanism):
+    def _analyzeThermodynamics(self, mechanism, speciesList=None):
         lowT = 0.0
         highT = 1000000.0
 
         midpoints = {}
 
-        for species in mechanism.species():
+        if speciesList is None:
+            speciesList = mechanism.species()
+
+        for species in speciesList:
 
             models = species.thermo
             if len(models) > 2:
@@ -6914,6 +8157,186 @@ class CPickler(CMill):
 
         return K_c
 
+    def _arrheniusGroups(self, mechanism):
+        # reaction index -> 'zero' for a temperature-independent rate, or
+        # the index of the first reaction with the same default beta and Ea.
+        # The rate parameters can be changed at run time, so the generated
+        # code still compares the exponents before reusing an exp.
+        groups = {}
+        leaders = {}
+        if not self.shareExp:
+            return groups
+        for reaction in mechanism.reaction():
+            A, beta, E = reaction.arrhenius
+            i = reaction.id-1
+            if beta == 0 and E == 0:
+                groups[i] = 'zero'
+                continue
+            key = (beta, E, reaction.units["activation"])
+            if key in leaders:
+                groups[i] = leaders[key]
+            else:
+                leaders[key] = i
+        return groups
+
+
+    def _equilibriumGroups(self, mechanism):
+        # reaction index -> index of the first reaction with the same
+        # exponent of Kc, i.e. the same net stoichiometry
+        groups = {}
+        leaders = {}
+        if not self.shareExp:
+            return groups
+        for reaction in mechanism.reaction():
+            key = self._sortedKcExpArg(mechanism, reaction)
+            if key in leaders:
+                groups[reaction.id-1] = leaders[key]
+            else:
+                leaders[key] = reaction.id-1
+        return groups
+
+
+    def _operationCounts(self, lines, consP=True):
+        # exp/log/pow calls and flops (+ - * / and their assignments) of
+        # each function in the generated code, following the calls into
+        # the other generated functions.  Loops count their trip count
+        # when it is a constant, if/else and ?: their first branch only:
+        # the new temperature in productionRate, the reuse of an earlier
+        # exp or sum, and consP in aJacobian, unless consP is False.
+        import re
+
+        text = re.sub(r'(?s)/\*.*?\*/', ' ', '\n'.join(lines))
+        text = re.sub(r'(?m)^\s*#.*$', ' ', text)
+
+        bodies = {}
+        for match in re.finditer(r'(?m)^(?:static\s+)?(?:void|double|int)\s+(\w+)\s*\([^;{]*\)\s*\{', text):
+            start = match.end()
+            bodies[match.group(1)] = text[start:self._closing(text, start-1, '{', '}')]
+
+        counts = {}
+
+        def block(body):
+            total = [0, 0]
+            pos = 0
+            while pos < len(body):
+                cost, pos = statement(body, pos)
+                total[0] += cost[0]
+                total[1] += cost[1]
+            return total
+
+        def statement(body, pos):
+            # cost and end of the statement at pos
+            while pos < len(body) and body[pos] in ' \t\n;':
+                pos += 1
+            if pos >= len(body):
+                return [0, 0], pos
+            if body[pos] == '{':
+                end = self._closing(body, pos, '{', '}')
+                return block(body[pos+1:end]), end+1
+            keyword = re.match(r'(for|if|while)\s*\(', body[pos:])
+            if keyword:
+                open = pos + keyword.end() - 1
+                close = self._closing(body, open, '(', ')')
+                head = body[open+1:close]
+                cost, pos = statement(body, close+1)
+                if keyword.group(1) == 'for':
+                    trip = re.match(r'\s*(?:int\s+)?\w+\s*=\s*(\d+)\s*;\s*\w+\s*<\s*(\d+)\s*;', head)
+                    if trip:
+                        n = int(trip.group(2)) - int(trip.group(1))
+                        cost = [n*cost[0], n*cost[1]]
+                else:
+                    extra = expression(head)
+                    cost = [cost[0]+extra[0], cost[1]+extra[1]]
+                    other = re.match(r'\s*else\b', body[pos:])
+                    if keyword.group(1) == 'if' and other:
+                        branch, pos = statement(body, pos + other.end())
+                        if head.strip() == 'consP' and not consP:
+                            cost = [branch[0]+extra[0], branch[1]+extra[1]]
+                return cost, pos
+            end = pos
+            depth = 0
+            while end < len(body) and (depth or body[end] != ';'):
+                if body[end] in '({':
+                    depth += 1
+                elif body[end] in ')}':
+                    depth -= 1
+                end += 1
+            return expression(body[pos:end]), end+1
+
+        def expression(expr):
+            # the first branch of each ?:, innermost first
+            while '?' in expr:
+                q = expr.rindex('?')
+                start = q
+                depth = 0
+                while start > 0 and not (depth == 0 and expr[start-1] in '(,=' and expr[start] != '='
+                                               and expr[start-2:start] not in ['==', '!=', '<=', '>=']):
+                    start -= 1
+                    if expr[start] == ')':
+                        depth += 1
+                    elif expr[start] == '(':
+                        depth -= 1
+                colon = q
+                depth = 0
+                while depth or expr[colon] != ':':
+                    if expr[colon] == '(':
+                        depth += 1
+                    elif expr[colon] == ')':
+                        depth -= 1
+                    colon += 1
+                end = colon
+                depth = 0
+                while end < len(expr) and (depth or expr[end] not in '),'):
+                    if expr[end] == '(':
+                        depth += 1
+                    elif expr[end] == ')':
+                        depth -= 1
+                    end += 1
+                expr = expr[:start] + ' ' + expr[start:q] + ' , ' + expr[q+1:colon] + ' ' + expr[end:]
+
+            cost = [0, 0]
+            for name in re.findall(r'\b(\w+)\s*\(', expr):
+                if name in ['exp', 'log', 'log10', 'pow']:
+                    cost[0] += 1
+                elif name in bodies:
+                    sub = function(name)
+                    cost[0] += sub[0]
+                    cost[1] += sub[1]
+
+            # indices and literals are not flops; neither are unary signs
+            while '[' in expr:
+                expr = re.sub(r'\[[^\[\]]*\]', '', expr)
+            expr = re.sub(r'\b\d*\.?\d+(?:[eE][-+]?\d+)?\.?', '0', expr)
+            expr = expr.replace('++', ' ').replace('--', ' ')
+            cost[1] += len(re.findall(r'[-+*/]=', expr))
+            expr = re.sub(r'[-+*/]=', '=', expr)
+            cost[1] += len(re.findall(r'[\w)]\s*[-+*/]', expr))
+            return cost
+
+        def function(name):
+            if name not in counts:
+                counts[name] = [0, 0]
+                counts[name] = block(bodies[name])
+            return counts[name]
+
+        for name in bodies.keys():
+            function(name)
+        return counts
+
+
+    def _closing(self, text, open, left, right):
+        # index of the bracket closing the one at text[open]
+        depth = 0
+        for i in range(open, len(text)):
+            if text[i] == left:
+                depth += 1
+            elif text[i] == right:
+                depth -= 1
+                if depth == 0:
+                    return i
+        return len(text)
+
+
     def _KcConv(self, mechanism, reaction):
         dim = 0
         for symbol, coefficient in reaction.reactants:
@@ -6933,7 +8356,7 @@ class CPickler(CMill):
 
     def _sortedKcExpArg(self, mechanism, reaction):
 
-        nSpecies = len(mechanism.species())
+        nSpecies = len(self._allSpecies(mechanism))
 
         terms = []
         for i in range(nSpecies):
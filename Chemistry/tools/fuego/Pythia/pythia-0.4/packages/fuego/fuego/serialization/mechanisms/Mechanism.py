@@ -18,6 +18,7 @@ class Mechanism(object):
 
 
     from MechanismExceptions import DuplicateElement, DuplicateSpecies, DuplicateThermalProperties
+    from MechanismExceptions import InvalidQSS
 
 
     # housekeeping
@@ -72,6 +73,55 @@ class Mechanism(object):
         return self._species.find(symbol)
 
 
+    # quasi-steady-state species
+
+    def qss(self):
+        return self._qss
+
+
+    def setQSS(self, symbols):
+        """Put the given species in quasi-steady state
+
+        They are removed from species(), which keeps the transported species
+        renumbered from 0, and get the ids that follow; species(symbol) still
+        finds them.  Every reaction may have at most one QSS species, with
+        coefficient one, on each side, so that the QSS concentrations solve a
+        linear system.  QSS species are dropped from the third-body
+        efficiencies, and the mixture concentration is that of the
+        transported species.
+        """
+        qss = []
+        for symbol in symbols:
+            species = self._species.find(symbol)
+            if not species:
+                raise self.InvalidQSS(symbol, "not in the mechanism")
+            if species not in qss:
+                qss.append(species)
+
+        names = [species.symbol for species in qss]
+        for reaction in self._reactions.find():
+            for side in [reaction.reactants, reaction.products]:
+                n = sum([coefficient for symbol, coefficient in side if symbol in names])
+                if n > 1:
+                    raise self.InvalidQSS(
+                        [symbol for symbol, coefficient in side if symbol in names][0],
+                        "reaction %d (%s) is not linear in the QSS species"
+                        % (reaction.id, reaction.equation()))
+            if reaction.thirdBody and reaction.thirdBody[0] in names:
+                raise self.InvalidQSS(
+                    reaction.thirdBody[0], "third body of reaction %d" % reaction.id)
+            reaction.efficiencies = [
+                eff for eff in reaction.efficiencies if eff[0] not in names]
+
+        species = self._species.find()
+        species[:] = [x for x in species if x not in qss]
+        for id, x in enumerate(species + qss):
+            x.id = id
+
+        self._qss = qss
+        return
+
+
     # thermal properties are recorded directly in the species
 
 
@@ -213,6 +263,8 @@ class Mechanism(object):
         self._info = journal.debug("fuego.serialization")
 
         self._sorted = False
+
+        self._qss = []
         
         return
 
@@ -38,6 +38,21 @@ class DuplicateSpecies(Exception):
         return "duplicate species '%s'" % self._symbol
 
 
+# quasi-steady-state species
+
+class InvalidQSS(Exception):
+
+
+    def __init__(self, symbol, reason):
+        self._symbol = symbol
+        self._reason = reason
+        return
+
+
+    def __str__(self):
+        return "species '%s' cannot be in quasi-steady state: %s" % (self._symbol, self._reason)
+
+
 # thermo
 
 class DuplicateThermalProperties(Exception):
@@ -11,7 +11,7 @@
 #  ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 # 
 
-def save(mechanism, format="chemkin"):
+def save(mechanism, format="chemkin", kernel=None):
 
     import journal
     journal.debug("fuego").log("pickling mechanism, format='%s')" % format)
@@ -23,10 +23,56 @@ def save(mechanism, format="chemkin"):
         
     pickler = factory.pickler()
     pickler.initialize()
+    if kernel:
+        pickler.kernel = kernel
 
     return pickler.pickle(mechanism)
 
 
+def saveUnits(mechanism, basename, jacobianChunk, format="c", kernel=None):
+
+    import journal
+    journal.debug("fuego").log("pickling mechanism in units, format='%s')" % format)
+
+    factory = registrar().retrieve(format)
+    if not factory:
+        journal.error("fuego").log("unknown mechanism file format '%s'" % format)
+        return []
+
+    pickler = factory.pickler()
+    if not hasattr(pickler, "pickleUnits"):
+        journal.error("fuego").log("format '%s' cannot be split into units" % format)
+        return []
+
+    pickler.initialize()
+    if kernel:
+        pickler.kernel = kernel
+
+    return pickler.pickleUnits(mechanism, basename, jacobianChunk)
+
+
+def report(mechanism, format="c", kernel=None):
+
+    import journal
+    journal.debug("fuego").log("counting operations, format='%s')" % format)
+
+    factory = registrar().retrieve(format)
+    if not factory:
+        journal.error("fuego").log("unknown mechanism file format '%s'" % format)
+        return []
+
+    pickler = factory.pickler()
+    if not hasattr(pickler, "report"):
+        journal.error("fuego").log("format '%s' has no operation report" % format)
+        return []
+
+    pickler.initialize()
+    if kernel:
+        pickler.kernel = kernel
+
+    return pickler.report(mechanism)
+
+
 # factory methods for the serializers
 
 def pickler(format="chemkin"):
@@ -70,3 +70,22 @@ ifeq (${CHEMISTRY_MODEL}, ALZETA)
   CHEM_MECHFILE = alzeta.c
   VPATH_LOCATIONS += ${CHEMISTRY_DIR}/data/Alzeta
 endif
+
+# CHEMISTRY_KERNEL=TABLES uses <mechanism>_tables.c, written next to the
+# mechanism by fmc.py -kernel=tables, with the table-driven ChemKernel engine;
+# only LIDRY has one checked in (see Chemistry/tools/fuego/README)
+ifeq (${CHEMISTRY_KERNEL}, TABLES)
+  CHEM_MECHFILE := $(CHEM_MECHFILE:.c=_tables.c)
+  cEXE_sources += ChemKernel.c
+  cEXE_headers += ChemKernel.H
+endif
+
+# CHEMISTRY_SPLIT=TRUE uses the units written next to the mechanism by
+# fmc.py -split=N: <mechanism>.h, <mechanism>_{params,ckapi,rates,thermo}.c
+# and every <mechanism>_jacobian*.c found on the VPATH
+ifeq (${CHEMISTRY_SPLIT}, TRUE)
+  CHEM_MECHBASE := $(CHEM_MECHFILE:.c=)
+  CHEM_MECHFILE := $(foreach u, params ckapi rates thermo, $(CHEM_MECHBASE)_$(u).c)
+  CHEM_MECHFILE += $(sort $(notdir $(foreach d, $(VPATH_LOCATIONS), $(wildcard $(d)/$(CHEM_MECHBASE)_jacobian*.c))))
+  cEXE_headers += $(CHEM_MECHBASE).h
+endif
@@ -14,6 +14,7 @@
 #include <cfloat>
 #include <fstream>
 #include <vector>
+#include <map>
 #include <unistd.h>
 #include <ctime>
 
@@ -117,6 +118,10 @@ namespace
     bool                  ShowMF_Verbose;
     bool                  ShowMF_Check_Nans;
     bool                  do_not_use_funccount;
+    bool                  scalar_adv_tiling;
+    bool                  scalar_adv_tiling_check;
+    IntVect               scalar_adv_tile_size;
+    Real                  funccount_tag_threshold;
     bool                  do_active_control;
     bool                  do_active_control_temp;
     Real                  temp_control;
@@ -192,6 +197,10 @@ HeatTransfer::Initialize ()
     ShowMF_Verbose         = true;
     ShowMF_Check_Nans      = true;
     do_not_use_funccount   = false;
+    scalar_adv_tiling      = false;
+    scalar_adv_tiling_check = false;
+    scalar_adv_tile_size   = IntVect(D_DECL(1024000,8,8));
+    funccount_tag_threshold = -1;
     do_active_control      = false;
     do_active_control_temp = false;
     temp_control           = -1;
@@ -288,6 +297,32 @@ HeatTransfer::Initialize ()
     pp.query("num_divu_iters",num_divu_iters);
 
     pp.query("do_not_use_funccount",do_not_use_funccount);
+    //
+    // Tiled, threaded edge-state prediction in compute_edge_states and flux
+    // divergence in scalar_advection.  When off the original whole-grid
+    // loops are used; they are the reference path for regression comparisons.
+    //
+    pp.query("scalar_adv_tiling",scalar_adv_tiling);
+    //
+    // Run both the tiled and the whole-grid paths of compute_edge_states and
+    // scalar_advection and abort unless they agree exactly.
+    //
+    pp.query("scalar_adv_tiling_check",scalar_adv_tiling_check);
+    //
+    // Tag cells for refinement whose last chemistry integration took at
+    // least this many RHS evaluations (<= 0 disables).
+    //
+    pp.query("funccount_tag_threshold",funccount_tag_threshold);
+    if (pp.contains("scalar_adv_tile_size"))
+    {
+        Array<int> tsz(BL_SPACEDIM);
+        pp.getarr("scalar_adv_tile_size",tsz,0,BL_SPACEDIM);
+        for (int d = 0; d < BL_SPACEDIM; ++d)
+        {
+            BL_ASSERT(tsz[d] > 0);
+            scalar_adv_tile_size[d] = tsz[d];
+        }
+    }
 
     pp.query("schmidt",schmidt);
     pp.query("prandtl",prandtl);
@@ -423,6 +458,68 @@ FabMinMax (FArrayBox& fab,
                    &fmin, &fmax, &nComp);
 }
 
+//
+// Max |a - b| over the valid regions, reduced over all processors.
+//
+static
+Real
+MaxAbsDiff (const MultiFab& a,
+            int             aComp,
+            const MultiFab& b,
+            int             bComp,
+            int             nComp)
+{
+    BL_ASSERT(a.boxArray() == b.boxArray());
+
+    Real      diff = 0;
+    FArrayBox tmp;
+
+    for (MFIter mfi(a); mfi.isValid(); ++mfi)
+    {
+        const Box& box = mfi.validbox();
+
+        tmp.resize(box,nComp);
+        tmp.copy(a[mfi],box,aComp,box,0,nComp);
+        tmp.minus(b[mfi],box,bComp,0,nComp);
+
+        diff = std::max(diff,tmp.norm(box,0,0,nComp));
+    }
+
+    ParallelDescriptor::ReduceRealMax(diff);
+
+    return diff;
+}
+
+static
+void
+TilingCheck (const std::string& where,
+             const std::string& what,
+             int                level,
+             Real               diff)
+{
+    if (ParallelDescriptor::IOProcessor())
+        std::cout << "HeatTransfer::" << where << "(): lev: " << level << ", "
+                  << what << " tiled vs untiled max |diff|: " << diff << '\n';
+
+    if (diff != 0)
+        BoxLib::Abort("HeatTransfer: ht.scalar_adv_tiling changes the answer");
+}
+
+//
+// Physical BCs for a tile: interior wherever the tile does not touch the
+// domain boundary, as getBCArray does for a grid.
+//
+static
+Array<int>
+TileBCArray (const Box&   box,
+             const Box&   domain,
+             const BCRec& bc_dom)
+{
+    BCRec bcr;
+    BoxLib::setBC(box,domain,bc_dom,bcr);
+    return Array<int>(bcr.vect(),2*BL_SPACEDIM);
+}
+
 static
 std::ostream&
 levWrite(std::ostream& os, int level, std::string& message)
@@ -1460,6 +1557,35 @@ HeatTransfer::initDataOtherTypes ()
     setThermoPress(cur_time);
 }
 
+void
+HeatTransfer::errorEst (TagBoxArray& tags,
+                        int          clearval,
+                        int          tagval,
+                        Real         time,
+                        int          n_error_buf,
+                        int          ngrow)
+{
+    NavierStokesBase::errorEst(tags,clearval,tagval,time,n_error_buf,ngrow);
+
+    if (funccount_tag_threshold > 0)
+    {
+        const MultiFab& FC = get_new_data(FuncCount_Type);
+
+        for (MFIter mfi(FC); mfi.isValid(); ++mfi)
+        {
+            const FArrayBox& fc  = FC[mfi];
+            TagBox&          tag = tags[mfi.index()];
+            const Box&       box = mfi.validbox();
+
+            for (IntVect iv = box.smallEnd(); iv <= box.bigEnd(); box.next(iv))
+            {
+                if (fc(iv,0) >= funccount_tag_threshold)
+                    tag(iv) = tagval;
+            }
+        }
+    }
+}
+
 void
 HeatTransfer::init (AmrLevel& old)
 {
@@ -4076,7 +4202,10 @@ HeatTransfer::advance (Real time,
         MultiFab mac_rhs(grids,1,0);
         create_mac_rhs(mac_rhs,0,time,dt);
         showMF("mac",mac_rhs,"mac_rhs",level);
+        const Real mac_strt_time = ParallelDescriptor::second();
         mac_project(time,dt,S_old,&mac_rhs,havedivu,umac_n_grow,true);
+        if (verbose)
+            reportProjTime("mac_project",mac_strt_time);
     }
 
     if (do_mom_diff == 0)
@@ -4707,6 +4836,92 @@ HeatTransfer::getFuncCountDM (const BoxArray& bxba, int ngrow)
     return res;
 }
 
+HeatTransfer::ChemWorkspace&
+HeatTransfer::getChemWorkspace (const MultiFab& mf,
+                                int             ngrow)
+{
+    ChemWorkspace& ws = chem_ws[ngrow > 0 ? 1 : 0];
+
+    if (ws.state.ok() && ws.src_ba == mf.boxArray() && ws.state.nComp() == mf.nComp())
+        return ws;
+
+    ws.state.clear();
+    ws.fcnCnt.clear();
+    ws.diag.clear();
+    //
+    // Let's chop the grids up a bit.
+    // We want to try and level out the chemistry work.
+    //
+    const int NProcs = ParallelDescriptor::NProcs();
+    BoxArray  ba     = mf.boxArray();
+    bool      done   = (ba.size() >= 3*NProcs);
+
+    for (int cnt = 1; !done; cnt *= 2)
+    {
+        const int ChunkSize = parent->maxGridSize(level)/cnt;
+
+        if (ChunkSize < 16)
+            //
+            // Don't let grids get too small. 
+            //
+            break;
+
+        IntVect chunk(D_DECL(ChunkSize,ChunkSize,ChunkSize));
+
+        for (int j = BL_SPACEDIM-1; j >=0  && ba.size() < 3*NProcs; j--)
+        {
+            chunk[j] /= 2;
+            ba.maxSize(chunk);
+            if (ba.size() >= 3*NProcs) done = true;
+        }
+    }
+
+    DistributionMapping dm = getFuncCountDM(ba,ngrow);
+
+    ws.src_ba = mf.boxArray();
+    ws.state.define(ba, mf.nComp(), 0, dm, Fab_allocate);
+    ws.fcnCnt.define(ba, 1, 0, dm, Fab_allocate);
+
+    if (plot_reactions && BoxLib::intersect(ba,auxDiag["REACTIONS"]->boxArray()).size() != 0)
+        ws.diag.define(ba, auxDiag["REACTIONS"]->nComp(), 0, dm, Fab_allocate);
+
+    if (verbose && ParallelDescriptor::IOProcessor())
+        std::cout << "*** strang_chem: FABs in tmp MF: " << ws.state.size() << '\n';
+
+    return ws;
+}
+
+void
+HeatTransfer::strang_chem_fab (FArrayBox& fb,
+                               FArrayBox& fc,
+                               const Box& box,
+                               Real       dt,
+                               Real       Patm,
+                               FArrayBox* chemDiag)
+{
+    const int rho_comp = Density;
+    const int ycomp    = first_spec;
+    const int Tcomp    = Temp;
+
+    for (int comp = 0; comp < nspecies; ++comp)
+        fb.divide(fb,box,rho_comp,ycomp+comp,1);
+
+    bool ok = getChemSolve().solveTransient(fb,fb,fb,fb,fc,box,ycomp,Tcomp,0.5*dt,Patm,chemDiag);
+
+    if (!ok) {
+        BoxLib::Abort("ChemDriver::solveTransient failed");
+    }
+
+#ifdef DO_JBB_HACK_POST
+    getChemSolve().getHmixGivenTY(fb,fb,fb,box,Temp,first_spec,RhoH);
+    getChemSolve().getRhoGivenPTY(fb,Patm,fb,fb,box,Temp,first_spec,Density);
+    fb.mult(fb,box,Density,RhoH,1);
+#endif
+
+    for (int comp = 0; comp < nspecies; ++comp)
+        fb.mult(fb,box,rho_comp,ycomp+comp,1);
+}
+
 void
 HeatTransfer::strang_chem (MultiFab&  mf,
                            Real       dt,
@@ -4742,7 +4957,6 @@ HeatTransfer::strang_chem (MultiFab&  mf,
     const int rho_comp  = Density; // mf and State_Type completely aligned here
     const int dCompYdot = 0;       // first component of Ydot corres. to first_spec
     const int ycomp     = first_spec - Density + rho_comp;
-    const int Tcomp     = Temp - Density + rho_comp;
 
     MultiFab junk, *ydot_tmp = 0;
 
@@ -4769,23 +4983,23 @@ HeatTransfer::strang_chem (MultiFab&  mf,
         Real p_amb;
         FORT_GETPAMB(&p_amb);
         const Real Patm = p_amb / P1atm_MKS;
-
+        //
+        // ydot is the change in Y, not rho*Y: with DO_JBB_HACK_POST the
+        // chemistry step recomputes rho.  Start from Y before the step.
+        //
+        if (ydot_tmp) 
         {
-            FArrayBox tmp;
+            ydot_tmp->copy(mf,ycomp,dCompYdot,nspecies);
+
             for (MFIter Smfi(mf); Smfi.isValid(); ++Smfi)
             {
-                tmp.resize(Smfi.validbox(),1);
-                tmp.copy(mf[Smfi],rho_comp,0,1);
-                tmp.invert(1);
+                const Box& box = Smfi.validbox();
 
                 for (int comp = 0; comp < nspecies; ++comp)
-                    mf[Smfi].mult(tmp,0,ycomp+comp,1);
+                    (*ydot_tmp)[Smfi].divide(mf[Smfi], box, rho_comp, dCompYdot+comp, 1);
             }
         }
 
-        if (ydot_tmp) 
-            ydot_tmp->copy(mf,ycomp,dCompYdot,nspecies);
-
         FArrayBox* chemDiag = 0;
 
         if (do_not_use_funccount)
@@ -4796,125 +5010,63 @@ HeatTransfer::strang_chem (MultiFab&  mf,
 
             for (MFIter Smfi(mf); Smfi.isValid(); ++Smfi)
             {
-                FArrayBox& fb = mf[Smfi];
-                const Box& bx = Smfi.validbox();
-		FArrayBox& fc = tmp[Smfi];
-
                 if (plot_reactions &&
                     BoxLib::intersect(mf.boxArray(),auxDiag["REACTIONS"]->boxArray()).size() != 0)
                 {
                     chemDiag = &( (*auxDiag["REACTIONS"])[Smfi] );
                 }
 
-                bool ok = getChemSolve().solveTransient(fb,fb,fb,fb,fc,bx,ycomp,Tcomp,0.5*dt,Patm,chemDiag);
-
-		if (!ok) {
-		  BoxLib::Abort("ChemDriver::solveTransient failed");
-		}
-
+                strang_chem_fab(mf[Smfi],tmp[Smfi],Smfi.validbox(),dt,Patm,chemDiag);
             }
             //
-            // When ngrow>0 this does NOT properly update FuncCount_Type since parallel
-            // copy()s do not touch ghost cells.  We'll ignore this since we're not using
-            // the FuncCount_Type anyway.
+            // Keep FuncCount_Type current (including its ghost cells when
+            // ngrow>0) so it can be plotted and used for tagging.
             //
-	    get_new_data(FuncCount_Type).copy(tmp);
+	    MultiFab& FC = get_new_data(FuncCount_Type);
+	    FC.copy(tmp,0,0,1,0,std::min(ngrow,FC.nGrow()));
         }
         else
         {
-            //
-            // Let's chop the grids up a bit.
-            // We want to try and level out the chemistry work.
-            //
-            const int NProcs = ParallelDescriptor::NProcs();
-            BoxArray  ba     = mf.boxArray();
-            bool      done   = (ba.size() >= 3*NProcs);
-
-            for (int cnt = 1; !done; cnt *= 2)
-            {
-                const int ChunkSize = parent->maxGridSize(level)/cnt;
-
-                if (ChunkSize < 16)
-                    //
-                    // Don't let grids get too small. 
-                    //
-                    break;
-
-                IntVect chunk(D_DECL(ChunkSize,ChunkSize,ChunkSize));
+            ChemWorkspace& ws      = getChemWorkspace(mf,ngrow);
+            const bool     do_diag = ws.diag.ok();
 
-                for (int j = BL_SPACEDIM-1; j >=0  && ba.size() < 3*NProcs; j--)
-                {
-                    chunk[j] /= 2;
-                    ba.maxSize(chunk);
-                    if (ba.size() >= 3*NProcs) done = true;
-                }
-            }
-
-            DistributionMapping dm = getFuncCountDM(ba,ngrow);
-
-            MultiFab tmp, fcnCntTemp;
-
-            tmp.define(ba, mf.nComp(), 0, dm, Fab_allocate);
-            fcnCntTemp.define(ba, 1, 0, dm, Fab_allocate);
-
-            MultiFab diagTemp;
-            const bool do_diag = plot_reactions && BoxLib::intersect(ba,auxDiag["REACTIONS"]->boxArray()).size() != 0;
             if (do_diag)
-            {
-                diagTemp.define(ba, auxDiag["REACTIONS"]->nComp(), 0, dm, Fab_allocate);
-                diagTemp.copy(*auxDiag["REACTIONS"]); // Parallel copy
-            }
-
-            if (verbose && ParallelDescriptor::IOProcessor())
-                std::cout << "*** strang_chem: FABs in tmp MF: " << tmp.size() << '\n';
+                ws.diag.copy(*auxDiag["REACTIONS"]); // Parallel copy
 
-            tmp.copy(mf); // Parallel copy.
+            ws.state.copy(mf); // Parallel copy.
 
-            for (MFIter Smfi(tmp); Smfi.isValid(); ++Smfi)
+            for (MFIter Smfi(ws.state); Smfi.isValid(); ++Smfi)
             {
-                FArrayBox& fb = tmp[Smfi];
-                const Box& bx = Smfi.validbox();
-                FArrayBox& fc = fcnCntTemp[Smfi];
-                chemDiag = (do_diag ? &(diagTemp[Smfi]) : 0);
-
-                bool ok = getChemSolve().solveTransient(fb,fb,fb,fb,fc,bx,ycomp,Tcomp,0.5*dt,Patm,chemDiag);
-
-		if (!ok) {
-		  BoxLib::Abort("ChemDriver::solveTransient failed");
-		}
+                chemDiag = (do_diag ? &(ws.diag[Smfi]) : 0);
 
+                strang_chem_fab(ws.state[Smfi],ws.fcnCnt[Smfi],Smfi.validbox(),dt,Patm,chemDiag);
             }
 
-            mf.copy(tmp); // Parallel copy.
+            mf.copy(ws.state); // Parallel copy.
 
             if (do_diag)
             {
-                auxDiag["REACTIONS"]->copy(diagTemp); // Parallel copy
+                auxDiag["REACTIONS"]->copy(ws.diag); // Parallel copy
             }
 
 	    MultiFab& FC = get_new_data(FuncCount_Type);
-	    FC.copy(fcnCntTemp,0,0,1,0,std::min(ngrow,FC.nGrow()));
+	    FC.copy(ws.fcnCnt,0,0,1,0,std::min(ngrow,FC.nGrow()));
         }
 
         if (ydot_tmp)
         {
+            FArrayBox Ynew;
             for (MFIter Smfi(mf); Smfi.isValid(); ++Smfi)
             {
-                (*ydot_tmp)[Smfi].minus(mf[Smfi], Smfi.validbox(), ycomp, 0, nspecies);
-                (*ydot_tmp)[Smfi].mult(1/(0.5*dt), Smfi.validbox(), 0, nspecies);
-            }
-        }
+                const Box& box = Smfi.validbox();
 
-        for (MFIter Smfi(mf); Smfi.isValid(); ++Smfi) {
-#ifdef DO_JBB_HACK_POST
-            const Box& box = Smfi.validbox();
-            getChemSolve().getHmixGivenTY(mf[Smfi],mf[Smfi],mf[Smfi],box,Temp,first_spec,RhoH);
-            const Real Patm = p_amb / P1atm_MKS;
-            getChemSolve().getRhoGivenPTY(mf[Smfi],Patm,mf[Smfi],mf[Smfi],box,Temp,first_spec,Density);
-            mf[Smfi].mult(mf[Smfi],box,Density,RhoH,1);
-#endif
-            for (int comp = 0; comp < nspecies; ++comp) {
-                mf[Smfi].mult(mf[Smfi],Smfi.validbox(),rho_comp,ycomp+comp,1);
+                Ynew.resize(box,nspecies);
+                Ynew.copy(mf[Smfi],box,ycomp,box,0,nspecies);
+                for (int comp = 0; comp < nspecies; ++comp)
+                    Ynew.divide(mf[Smfi], box, rho_comp, comp, 1);
+
+                (*ydot_tmp)[Smfi].minus(Ynew, box, 0, dCompYdot, nspecies);
+                (*ydot_tmp)[Smfi].mult(1/(0.5*dt), box, dCompYdot, nspecies);
             }
         }
 
@@ -4941,6 +5093,46 @@ HeatTransfer::strang_chem (MultiFab&  mf,
 
         if (ParallelDescriptor::IOProcessor())
             std::cout << "HeatTransfer::strang_chem time: " << run_time << '\n';
+
+        if (ngrow == 0 && !hack_nochem)
+            reportChemCost();
+    }
+}
+
+void
+HeatTransfer::reportChemCost ()
+{
+    const MultiFab& FC = get_new_data(FuncCount_Type);
+
+    Real my_cost = 0, max_box_cost = 0;
+
+    for (MFIter mfi(FC); mfi.isValid(); ++mfi)
+    {
+        const Real box_cost = FC[mfi].sum(mfi.validbox(),0);
+
+        my_cost     += box_cost;
+        max_box_cost = std::max(max_box_cost,box_cost);
+    }
+
+    const int IOProc = ParallelDescriptor::IOProcessorNumber();
+
+    Real tot_cost = my_cost, max_rank_cost = my_cost;
+
+    ParallelDescriptor::ReduceRealSum(tot_cost,IOProc);
+    ParallelDescriptor::ReduceRealMax(max_rank_cost,IOProc);
+    ParallelDescriptor::ReduceRealMax(max_box_cost,IOProc);
+
+    if (ParallelDescriptor::IOProcessor())
+    {
+        const Real avg_rank_cost = tot_cost / ParallelDescriptor::NProcs();
+
+        std::cout << "HeatTransfer::strang_chem FuncCount: lev: " << level
+                  << ", total: "    << tot_cost
+                  << ", max/box: "  << max_box_cost
+                  << ", max/rank: " << max_rank_cost
+                  << ", max/avg rank: "
+                  << (avg_rank_cost > 0 ? max_rank_cost/avg_rank_cost : 1)
+                  << '\n';
     }
 }
 
@@ -4961,7 +5153,6 @@ HeatTransfer::compute_edge_states (Real              dt,
     //
     // Get simulation parameters.
     //
-    const Real* dx             = geom.CellSize();
     const Real  prev_time      = state[State_Type].prevTime();
     const Real  prev_pres_time = state[Press_Type].prevTime();
     //
@@ -5063,6 +5254,55 @@ HeatTransfer::compute_edge_states (Real              dt,
             }
         }
     }
+
+    if (scalar_adv_tiling_check)
+    {
+        //
+        // Regression mode: the tiled edge states must match the grid by
+        // grid ones bit for bit.
+        //
+        edge_states_grids(dt,do_predict,compute_comp,visc_terms,divu_fp,Gp);
+
+        MultiFab ref[BL_SPACEDIM];
+        for (int d=0; d<BL_SPACEDIM; ++d)
+        {
+            const int ncomp = EdgeState[d]->nComp();
+            ref[d].define(EdgeState[d]->boxArray(),ncomp,0,Fab_allocate);
+            MultiFab::Copy(ref[d],*EdgeState[d],0,0,ncomp,0);
+        }
+
+        edge_states_tiles(dt,do_predict,compute_comp,visc_terms,divu_fp,Gp);
+
+        Real diff = 0;
+        for (int d=0; d<BL_SPACEDIM; ++d)
+            diff = std::max(diff,MaxAbsDiff(ref[d],0,*EdgeState[d],0,ref[d].nComp()));
+
+        TilingCheck("compute_edge_states","EdgeState",level,diff);
+    }
+    else if (scalar_adv_tiling)
+    {
+        edge_states_tiles(dt,do_predict,compute_comp,visc_terms,divu_fp,Gp);
+    }
+    else
+    {
+        edge_states_grids(dt,do_predict,compute_comp,visc_terms,divu_fp,Gp);
+    }
+}
+
+void
+HeatTransfer::edge_states_grids (Real                    dt,
+                                 const std::vector<int>& do_predict,
+                                 const std::vector<int>& compute_comp,
+                                 PArray<MultiFab>&       visc_terms,
+                                 MultiFab&               divu_fp,
+                                 MultiFab&               Gp)
+{
+    const Real* dx        = geom.CellSize();
+    const Real  prev_time = state[State_Type].prevTime();
+    const int   nState    = desc_lst[State_Type].nComp();
+    const int   nGrowF    = 1;
+
+    const int use_forces_in_trans = godunov->useForcesInTrans();
     //
     // Loop on grids, and compute edge fluxes
     //
@@ -5378,78 +5618,410 @@ HeatTransfer::compute_edge_states (Real              dt,
     }
 }
 
+
 void
-HeatTransfer::momentum_advection (Real dt, bool do_adv_reflux)
+HeatTransfer::edge_states_tiles (Real                    dt,
+                                 const std::vector<int>& do_predict,
+                                 const std::vector<int>& compute_comp,
+                                 PArray<MultiFab>&       visc_terms,
+                                 MultiFab&               divu_fp,
+                                 MultiFab&               Gp)
 {
-    if (verbose && ParallelDescriptor::IOProcessor())
-        std::cout << "... advect momentum\n";
+    //
+    // The predictions of edge_states_grids, but Godunov works on tiles with
+    // per-thread scratch sized to the tile, and every component of a tile is
+    // done while its state and umac are in cache.  All stencils are local
+    // and each tile writes only the faces it owns, so the result does not
+    // depend on the tiling.
+    //
+    const Real* dx        = geom.CellSize();
+    const Real  prev_time = state[State_Type].prevTime();
+    const int   nState    = desc_lst[State_Type].nComp();
+    const int   nGrowF    = 1;
+    const int   velpred   = 0; // Already have edge velocities for transverse derivative
+    const Box&  domain    = geom.Domain();
 
-    const int finest_level = parent->finestLevel();
+    const int  use_forces_in_trans = godunov->useForcesInTrans();
+    const bool do_vel_forces       = use_forces_in_trans || (do_mom_diff == 1);
 
-    FArrayBox edge[BL_SPACEDIM];
+    if (compute_comp[Density] && !do_set_rho_to_species_sum)
+        BoxLib::Error("No code yet for rho != sum(rho.Y)");
     //
-    // Compute the advective forcing for momentum.
+    // The components edge_states_grids predicts "the old-fashioned way".
     //
-    const int use_conserv_diff = true;
+    std::vector<int> predict_rest(nState,false);
 
-    MultiFab fluxes[BL_SPACEDIM];
-
-    if (do_reflux && level < parent->finestLevel())
+    for (int sigma=0; sigma<nState; ++sigma)
     {
-        for (int d=0; d<BL_SPACEDIM; ++d)
-            fluxes[d].define((*EdgeState[d]).boxArray(), BL_SPACEDIM, 0, Fab_allocate);
+        const bool done = (sigma < BL_SPACEDIM && do_mom_diff == 1)                         ||
+                          (sigma >= first_spec && sigma <= last_spec && compute_comp[first_spec]) ||
+                          (sigma == Density || sigma == Temp || sigma == RhoH);
+
+        predict_rest[sigma] = do_predict[sigma] && compute_comp[sigma] && !done;
     }
 
-    for (MFIter AofS_mfi(*aofs); AofS_mfi.isValid(); ++AofS_mfi)
+    FillPatchIterator S_fpi(*this,divu_fp,Godunov::hypgrow(),prev_time,State_Type,0,nState);
+    MultiFab& Smf = S_fpi.get_mf();
+    //
+    // getForce works on whole grids, so the forcing is gathered grid by grid
+    // before the threaded region, with the calls edge_states_grids makes.
+    //
+    MultiFab force(grids,nState,nGrowF);
+    MultiFab velforce;
+    if (do_vel_forces)
+        velforce.define(grids,BL_SPACEDIM,nGrowF,Fab_allocate);
     {
-        const int i = AofS_mfi.index();
-
-        for (int d=0; d<BL_SPACEDIM; ++d)
-            edge[d].resize(BoxLib::surroundingNodes(grids[i],d),1);
+        FArrayBox Rho, tforces;
 
-        for (int comp = 0 ; comp < BL_SPACEDIM ; comp++ )
+        for (MFIter mfi(Smf); mfi.isValid(); ++mfi)
         {
-            // 
-            // If here, edge states at n+1/2 have already been computed, get a copy
-            // 
-            for (int d=0; d<BL_SPACEDIM; ++d)
-                edge[d].copy((*EdgeState[d])[AofS_mfi],edge[d].box(),comp,edge[d].box(),0,1);
- 
-            godunov->ComputeAofs(grids[i],
-                                 area[0][AofS_mfi],u_mac[0][AofS_mfi],edge[0],
-                                 area[1][AofS_mfi],u_mac[1][AofS_mfi],edge[1],
-#if BL_SPACEDIM==3
-                                 area[2][AofS_mfi],u_mac[2][AofS_mfi],edge[2],
+            const int i = mfi.index();
+
+            Rho.resize(Smf[mfi].box(),1);
+            Rho.copy(Smf[mfi],Density,0,1);
+
+            if (do_vel_forces)
+            {
+                NavierStokesBase::getForce(tforces,i,nGrowF,Xvel,BL_SPACEDIM,
+#ifdef GENGETFORCE
+                                           prev_time,
 #endif
-                                 volume[AofS_mfi],(*aofs)[AofS_mfi],comp,
-                                 use_conserv_diff);
-            if (do_adv_reflux)
+                                           Rho);
+                velforce[mfi].copy(tforces,0,0,BL_SPACEDIM);
+            }
+            if (compute_comp[first_spec])
             {
-                if (level < parent->finestLevel())
-                {
-                    for (int d=0; d<BL_SPACEDIM; ++d)
-                        fluxes[d][AofS_mfi].copy(edge[d],0,comp,1);
-                }
-
-                if (level > 0)
+                NavierStokesBase::getForce(tforces,i,nGrowF,first_spec,nspecies,
+#ifdef GENGETFORCE
+                                           prev_time,
+#endif
+                                           Rho);
+                force[mfi].copy(tforces,0,first_spec,nspecies);
+            }
+            for (int sigma=0; sigma<nState; ++sigma)
+            {
+                if ((sigma == Temp && compute_comp[Temp]) || predict_rest[sigma])
                 {
-                    for (int d=0; d<BL_SPACEDIM; ++d)
-                        advflux_reg->FineAdd(edge[d],d,i,0,comp,1,dt);
+                    NavierStokesBase::getForce(tforces,i,nGrowF,sigma,1,
+#ifdef GENGETFORCE
+                                               prev_time,
+#endif
+                                               Rho);
+                    force[mfi].copy(tforces,0,sigma,1);
                 }
             }
         }
     }
+#ifdef _OPENMP
+    const int nthreads = omp_get_max_threads();
+#else
+    const int nthreads = 1;
+#endif
+    //
+    // Godunov keeps per-instance work arrays, so each thread gets its own.
+    //
+    PArray<Godunov> tgodunov(nthreads,PArrayManage);
 
-    D_TERM(edge[0].clear();, edge[1].clear();, edge[2].clear(););
-
-    if (do_adv_reflux && level < finest_level)
+    for (int t = 0; t < nthreads; ++t)
+        tgodunov.set(t,new Godunov());
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
     {
-        for (int d=0; d<BL_SPACEDIM; ++d)
+#ifdef _OPENMP
+        Godunov& tgod = tgodunov[omp_get_thread_num()];
+#else
+        Godunov& tgod = tgodunov[0];
+#endif
+        FArrayBox edge[BL_SPACEDIM],Rho,U,state,tforces,tvelforces,vel,h,spec;
+
+        for (MFIter mfi(Smf,scalar_adv_tile_size); mfi.isValid(); ++mfi)
         {
-            getAdvFluxReg(level+1).CrseInit(fluxes[d],d,0,0,BL_SPACEDIM,-dt);
-        }
-    }
-}
+            const Box&       bx  = mfi.tilebox();
+            const Box        gbx = BoxLib::grow(bx,Godunov::hypgrow());
+            const Box        fbx = BoxLib::grow(bx,nGrowF);
+            const FArrayBox& S   = Smf[mfi];
+
+            Box ebx[BL_SPACEDIM];
+            for (int d=0; d<BL_SPACEDIM; ++d)
+                ebx[d] = mfi.nodaltilebox(d);
+
+            Rho.resize(gbx,1);
+            U.resize(gbx,BL_SPACEDIM);
+
+            Rho.copy(S,Density,0,1);
+            U.copy(S,Xvel,0,BL_SPACEDIM);
+
+            if (do_vel_forces)
+            {
+                tvelforces.resize(fbx,BL_SPACEDIM);
+                tvelforces.copy(velforce[mfi],0,0,BL_SPACEDIM);
+                tgod.Sum_tf_gp_visc(tvelforces,visc_terms[Xvel][mfi],Gp[mfi],Rho);
+            }
+
+            Array<int> u_bc[BL_SPACEDIM];
+            for (int d=0; d<BL_SPACEDIM; ++d)
+                u_bc[d] = TileBCArray(bx,domain,desc_lst[State_Type].getBC(d));
+
+            tgod.Setup(bx, dx, dt, 0,
+                       edge[0], u_bc[0].dataPtr(),
+                       edge[1], u_bc[1].dataPtr(),
+#if (BL_SPACEDIM == 3)
+                       edge[2], u_bc[2].dataPtr(),
+#endif
+                       U, Rho, tvelforces);
+
+            if (do_mom_diff == 1)
+            {
+                vel.resize(gbx,BL_SPACEDIM);
+                vel.copy(S,0,0,BL_SPACEDIM);
+
+                for (int comp = 0 ; comp < BL_SPACEDIM ; comp++ )
+                {
+                    if (predict_mom_together == 1)
+                    {
+                        vel.mult(Rho,gbx,gbx,0,comp,1);
+                        tvelforces.mult(Rho,tvelforces.box(),tvelforces.box(),0,comp,1);
+                    }
+                    Array<int> bc = TileBCArray(bx,domain,desc_lst[State_Type].getBC(comp));
+
+                    int iconserv_dummy = 0;
+                    FArrayBox divu_dummy;
+
+                    tgod.edge_states(bx, dx, dt, velpred,
+                                     u_mac[0][mfi], edge[0],
+                                     u_mac[1][mfi], edge[1],
+#if (BL_SPACEDIM == 3)
+                                     u_mac[2][mfi], edge[2],
+#endif
+                                     U,vel,tvelforces,divu_dummy,
+                                     comp,comp,bc.dataPtr(),
+                                     iconserv_dummy,PRE_MAC);
+
+                    for (int d=0; d<BL_SPACEDIM; ++d)
+                        (*EdgeState[d])[mfi].copy(edge[d],ebx[d],0,ebx[d],comp,1);
+                }
+            }
+            //
+            // Species, with the FPU scheme edge_states_grids uses.
+            //
+            if (compute_comp[first_spec])
+            {
+                spec.resize(gbx,nspecies);
+                spec.copy(S,first_spec,0,nspecies);
+
+                tforces.resize(fbx,nspecies);
+                tforces.copy(force[mfi],first_spec,0,nspecies);
+
+                FArrayBox junkDivu(fbx,1);
+                junkDivu.setVal(0.);
+
+                for (int comp = 0 ; comp < nspecies ; comp++)
+                {
+                    int state_ind = first_spec + comp;
+                    int use_conserv_diff = 
+                          (advectionType[state_ind] == Conservative) ? true : false;
+                    Array<int> bc = TileBCArray(bx,domain,desc_lst[State_Type].getBC(state_ind));
+
+                    tgod.Sum_tf_divu_visc(spec, tforces, comp, 1,
+                                          visc_terms[first_spec][mfi], comp,
+                                          junkDivu, Rho, use_conserv_diff);
+
+                    tgod.edge_states(bx, dx, dt, velpred,
+                                     u_mac[0][mfi], edge[0],
+                                     u_mac[1][mfi], edge[1],
+#if (BL_SPACEDIM==3)
+                                     u_mac[2][mfi], edge[2],
+#endif
+                                     U,spec,tforces,divu_fp[mfi],
+                                     comp,state_ind,bc.dataPtr(), 
+                                     use_conserv_diff,FPU);
+
+                    for (int d=0; d<BL_SPACEDIM; ++d)
+                        (*EdgeState[d])[mfi].copy(edge[d],ebx[d],0,ebx[d],state_ind,1);
+                }
+            }
+
+            if (compute_comp[Density])
+            {
+                for (int d=0; d<BL_SPACEDIM; ++d)
+                {
+                    (*EdgeState[d])[mfi].setVal(0.0,ebx[d],Density,1);
+                    for (int sigma=first_spec; sigma<=last_spec; ++sigma)
+                        (*EdgeState[d])[mfi].plus((*EdgeState[d])[mfi],ebx[d],sigma,Density,1);
+                }
+
+                if (do_mom_diff == 1 && predict_mom_together == 0)
+                    for (int icomp = 0; icomp < BL_SPACEDIM; icomp++)
+                        for (int d=0; d<BL_SPACEDIM; ++d)
+                            (*EdgeState[d])[mfi].mult((*EdgeState[d])[mfi],ebx[d],ebx[d],
+                                                      Density,icomp,1);
+            }
+            //
+            // Temp, with the FPU scheme edge_states_grids uses.
+            //
+            if (compute_comp[Temp])
+            {
+                const int comp = 0;
+                const int state_ind = Temp;
+                int use_conserv_diff = (advectionType[state_ind] == Conservative) ? true : false;
+
+                state.resize(gbx,1);
+                state.copy(S,state_ind,0,1);
+
+                tforces.resize(fbx,1);
+                tforces.copy(force[mfi],state_ind,0,1);
+
+                Array<int> bc = TileBCArray(bx,domain,desc_lst[State_Type].getBC(state_ind));
+
+                FArrayBox junkDivu(fbx,1);
+                junkDivu.setVal(0);
+                tgod.Sum_tf_divu_visc(state, tforces,  comp, 1,
+                                      visc_terms[state_ind][mfi], 0,
+                                      junkDivu, Rho, use_conserv_diff);
+
+                tgod.edge_states(bx, dx, dt, velpred,
+                                 u_mac[0][mfi], edge[0],
+                                 u_mac[1][mfi], edge[1],
+#if (BL_SPACEDIM==3)
+                                 u_mac[2][mfi], edge[2],
+#endif
+                                 U, state, tforces, divu_fp[mfi],
+                                 comp, state_ind, bc.dataPtr(), 
+                                 use_conserv_diff, FPU);
+
+                for (int d=0; d<BL_SPACEDIM; ++d)
+                    (*EdgeState[d])[mfi].copy(edge[d],ebx[d],0,ebx[d],state_ind,1);
+            }
+
+            if (compute_comp[RhoH])
+            {
+                //
+                // Set rhoh on edges = sum(rho.Y.H)
+                //
+                for (int d=0; d<BL_SPACEDIM; ++d)
+                {
+                    h.resize(ebx[d],nspecies);
+                    getChemSolve().getHGivenT(h,(*EdgeState[d])[mfi],ebx[d],Temp,0);
+                    h.mult((*EdgeState[d])[mfi],ebx[d],first_spec,0,nspecies);
+
+                    (*EdgeState[d])[mfi].setVal(0.0,ebx[d],RhoH,1);
+                    for (int comp=0; comp<nspecies; ++comp)
+                        (*EdgeState[d])[mfi].plus(h,ebx[d],comp,RhoH,1);
+                }
+            }
+            //
+            // Now do the rest as normal
+            //
+            for (int state_ind=0; state_ind<nState; ++state_ind)
+            {
+                if (predict_rest[state_ind])
+                {
+                    int use_conserv_diff =
+                        (advectionType[state_ind] == Conservative) ? true : false;
+                    const int comp = 0;
+
+                    state.resize(gbx,1);
+                    state.copy(S,state_ind,0,1);
+
+                    tforces.resize(fbx,1);
+                    tforces.copy(force[mfi],state_ind,0,1);
+
+                    tgod.Sum_tf_divu_visc(state, tforces, comp, 1,
+                                          visc_terms[state_ind][mfi], 0,
+                                          divu_fp[mfi], Rho,
+                                          use_conserv_diff);
+                    Array<int> bc = TileBCArray(bx,domain,desc_lst[State_Type].getBC(state_ind));
+                    int iconserv_dummy = 0;
+                    tgod.edge_states(bx, dx, dt, velpred,
+                                     u_mac[0][mfi], edge[0],
+                                     u_mac[1][mfi], edge[1],
+#if (BL_SPACEDIM==3)
+                                     u_mac[2][mfi], edge[2],
+#endif
+                                     U,state,tforces,divu_fp[mfi],
+                                     comp,state_ind,bc.dataPtr(),
+                                     iconserv_dummy,PRE_MAC);
+
+                    for (int d=0; d<BL_SPACEDIM; ++d)
+                        (*EdgeState[d])[mfi].copy(edge[d],ebx[d],0,ebx[d],state_ind,1);
+                }
+            }
+        }
+    }
+}
+void
+HeatTransfer::momentum_advection (Real dt, bool do_adv_reflux)
+{
+    if (verbose && ParallelDescriptor::IOProcessor())
+        std::cout << "... advect momentum\n";
+
+    const int finest_level = parent->finestLevel();
+
+    FArrayBox edge[BL_SPACEDIM];
+    //
+    // Compute the advective forcing for momentum.
+    //
+    const int use_conserv_diff = true;
+
+    MultiFab fluxes[BL_SPACEDIM];
+
+    if (do_reflux && level < parent->finestLevel())
+    {
+        for (int d=0; d<BL_SPACEDIM; ++d)
+            fluxes[d].define((*EdgeState[d]).boxArray(), BL_SPACEDIM, 0, Fab_allocate);
+    }
+
+    for (MFIter AofS_mfi(*aofs); AofS_mfi.isValid(); ++AofS_mfi)
+    {
+        const int i = AofS_mfi.index();
+
+        for (int d=0; d<BL_SPACEDIM; ++d)
+            edge[d].resize(BoxLib::surroundingNodes(grids[i],d),1);
+
+        for (int comp = 0 ; comp < BL_SPACEDIM ; comp++ )
+        {
+            // 
+            // If here, edge states at n+1/2 have already been computed, get a copy
+            // 
+            for (int d=0; d<BL_SPACEDIM; ++d)
+                edge[d].copy((*EdgeState[d])[AofS_mfi],edge[d].box(),comp,edge[d].box(),0,1);
+ 
+            godunov->ComputeAofs(grids[i],
+                                 area[0][AofS_mfi],u_mac[0][AofS_mfi],edge[0],
+                                 area[1][AofS_mfi],u_mac[1][AofS_mfi],edge[1],
+#if BL_SPACEDIM==3
+                                 area[2][AofS_mfi],u_mac[2][AofS_mfi],edge[2],
+#endif
+                                 volume[AofS_mfi],(*aofs)[AofS_mfi],comp,
+                                 use_conserv_diff);
+            if (do_adv_reflux)
+            {
+                if (level < parent->finestLevel())
+                {
+                    for (int d=0; d<BL_SPACEDIM; ++d)
+                        fluxes[d][AofS_mfi].copy(edge[d],0,comp,1);
+                }
+
+                if (level > 0)
+                {
+                    for (int d=0; d<BL_SPACEDIM; ++d)
+                        advflux_reg->FineAdd(edge[d],d,i,0,comp,1,dt);
+                }
+            }
+        }
+    }
+
+    D_TERM(edge[0].clear();, edge[1].clear();, edge[2].clear(););
+
+    if (do_adv_reflux && level < finest_level)
+    {
+        for (int d=0; d<BL_SPACEDIM; ++d)
+        {
+            getAdvFluxReg(level+1).CrseInit(fluxes[d],d,0,0,BL_SPACEDIM,-dt);
+        }
+    }
+}
 
 void
 HeatTransfer::scalar_advection (Real dt,
@@ -5681,18 +6253,107 @@ HeatTransfer::scalar_advection (Real dt,
         }
     }
 
-    FArrayBox edge[BL_SPACEDIM];
-
-    const int nscalar = lscalar - fscalar + 1;
+    const int  nscalar     = lscalar - fscalar + 1;
+    const bool need_fluxes = do_adv_reflux && (level > 0 || level < parent->finestLevel());
 
     MultiFab fluxes[BL_SPACEDIM];
 
-    if (do_adv_reflux && level < parent->finestLevel())
+    if (need_fluxes)
     {
         for (int d=0; d<BL_SPACEDIM; ++d)
             fluxes[d].define((*EdgeState[d]).boxArray(), nscalar, 0, Fab_allocate);
     }
 
+    if (scalar_adv_tiling_check)
+    {
+        //
+        // Regression mode: the tiled aofs and reflux fluxes must match the
+        // grid by grid ones bit for bit.
+        //
+        scalar_aofs_grids(fscalar,lscalar,do_special_rhoh,do_adv_reflux,need_fluxes,fluxNULN,fluxes);
+
+        MultiFab aofs_ref(grids,nscalar,0);
+        MultiFab::Copy(aofs_ref,*aofs,fscalar,0,nscalar,0);
+
+        MultiFab fluxes_ref[BL_SPACEDIM];
+        if (need_fluxes)
+        {
+            for (int d=0; d<BL_SPACEDIM; ++d)
+            {
+                fluxes_ref[d].define(fluxes[d].boxArray(),nscalar,0,Fab_allocate);
+                MultiFab::Copy(fluxes_ref[d],fluxes[d],0,0,nscalar,0);
+            }
+        }
+
+        scalar_aofs_tiles(fscalar,lscalar,do_special_rhoh,do_adv_reflux,need_fluxes,fluxNULN,fluxes);
+
+        TilingCheck("scalar_advection","aofs",level,MaxAbsDiff(aofs_ref,0,*aofs,fscalar,nscalar));
+
+        if (need_fluxes)
+        {
+            Real diff = 0;
+            for (int d=0; d<BL_SPACEDIM; ++d)
+                diff = std::max(diff,MaxAbsDiff(fluxes_ref[d],0,fluxes[d],0,nscalar));
+
+            TilingCheck("scalar_advection","reflux fluxes",level,diff);
+        }
+    }
+    else if (scalar_adv_tiling)
+    {
+        scalar_aofs_tiles(fscalar,lscalar,do_special_rhoh,do_adv_reflux,need_fluxes,fluxNULN,fluxes);
+    }
+    else
+    {
+        scalar_aofs_grids(fscalar,lscalar,do_special_rhoh,do_adv_reflux,need_fluxes,fluxNULN,fluxes);
+    }
+
+    if (need_fluxes)
+    {
+        if (level > 0)
+        {
+            for (MFIter mfi(*aofs); mfi.isValid(); ++mfi)
+            {
+                for (int d=0; d<BL_SPACEDIM; ++d)
+                    advflux_reg->FineAdd(fluxes[d][mfi],d,mfi.index(),0,fscalar,nscalar,dt);
+            }
+        }
+        if (level < parent->finestLevel())
+        {
+            for (int d=0; d<BL_SPACEDIM; ++d)
+            {
+                getAdvFluxReg(level+1).CrseInit(fluxes[d],d,0,fscalar,nscalar,-dt);
+            }
+        }
+    }
+
+    if (verbose)
+    {
+        const int IOProc   = ParallelDescriptor::IOProcessorNumber();
+        Real      run_time = ParallelDescriptor::second() - strt_time;
+
+        ParallelDescriptor::ReduceRealMax(run_time,IOProc);
+
+        if (ParallelDescriptor::IOProcessor())
+            std::cout << "HeatTransfer::scalar_advection(): time: " << run_time << '\n';
+    }
+}
+
+void
+HeatTransfer::scalar_aofs_grids (int        fscalar,
+                                 int        lscalar,
+                                 bool       do_special_rhoh,
+                                 bool       do_adv_reflux,
+                                 bool       need_fluxes,
+                                 MultiFab** fluxNULN,
+                                 MultiFab*  fluxes)
+{
+    //
+    // Advective flux divergences of fscalar..lscalar into aofs, one grid at
+    // a time.  If need_fluxes, the reflux fluxes go into fluxes; the caller
+    // updates the flux registers.
+    //
+    FArrayBox edge[BL_SPACEDIM];
+
     for (MFIter AofS_mfi(*aofs); AofS_mfi.isValid(); ++AofS_mfi)
     {
         const int i = AofS_mfi.index();
@@ -5765,43 +6426,126 @@ HeatTransfer::scalar_advection (Real dt,
 
 	    // rhoY component of edge contains area-weighted
 	    // (U^ADV*rho*Y_m)^{n+1/2}
-            if (do_adv_reflux)
+            if (need_fluxes)
             {
-                if (level < parent->finestLevel())
-                {
-                    const int fcomp = sigma - fscalar;
+                const int fcomp = sigma - fscalar;
 
-                    for (int d=0; d<BL_SPACEDIM; ++d)
-                        fluxes[d][AofS_mfi].copy(edge[d],0,fcomp,1);
-                }
-                if (level > 0)
-                {
-                    for (int d=0; d<BL_SPACEDIM; ++d)
-                        advflux_reg->FineAdd(edge[d],d,i,0,sigma,1,dt);
-                }
+                for (int d=0; d<BL_SPACEDIM; ++d)
+                    fluxes[d][AofS_mfi].copy(edge[d],0,fcomp,1);
             }
         }
     }
+}
 
-    D_TERM(edge[0].clear();, edge[1].clear();, edge[2].clear(););
+void
+HeatTransfer::scalar_aofs_tiles (int        fscalar,
+                                 int        lscalar,
+                                 bool       do_special_rhoh,
+                                 bool       do_adv_reflux,
+                                 bool       need_fluxes,
+                                 MultiFab** fluxNULN,
+                                 MultiFab*  fluxes)
+{
+    //
+    // Same operations as scalar_aofs_grids, but over tiles and with all
+    // scalars handled per tile while its umac/area/volume are in cache.
+    // Every flux and divergence here is cell/face local, so the result
+    // does not depend on the tiling.
+    //
+#ifdef _OPENMP
+    const int nthreads = omp_get_max_threads();
+#else
+    const int nthreads = 1;
+#endif
+    //
+    // Godunov keeps per-instance work arrays, so each thread gets its own.
+    //
+    PArray<Godunov> tgodunov(nthreads,PArrayManage);
 
-    if (do_adv_reflux && level < parent->finestLevel())
+    for (int t = 0; t < nthreads; ++t)
+        tgodunov.set(t,new Godunov());
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
     {
-        for (int d=0; d<BL_SPACEDIM; ++d)
+#ifdef _OPENMP
+        Godunov& tgod = tgodunov[omp_get_thread_num()];
+#else
+        Godunov& tgod = tgodunov[0];
+#endif
+        FArrayBox tedge[BL_SPACEDIM];
+
+        for (MFIter AofS_mfi(*aofs,scalar_adv_tile_size); AofS_mfi.isValid(); ++AofS_mfi)
         {
-            getAdvFluxReg(level+1).CrseInit(fluxes[d],d,0,fscalar,nscalar,-dt);
-        }
-    }
+            const Box& bx = AofS_mfi.tilebox();
 
-    if (verbose)
-    {
-        const int IOProc   = ParallelDescriptor::IOProcessorNumber();
-        Real      run_time = ParallelDescriptor::second() - strt_time;
+            for (int d=0; d<BL_SPACEDIM; ++d)
+                tedge[d].resize(BoxLib::surroundingNodes(bx,d),1);
 
-        ParallelDescriptor::ReduceRealMax(run_time,IOProc);
+            for (int sigma=fscalar; sigma<=lscalar; ++sigma)
+            {
+                for (int d=0; d<BL_SPACEDIM; ++d)
+                    tedge[d].copy((*EdgeState[d])[AofS_mfi],tedge[d].box(),sigma,tedge[d].box(),0,1);
 
-        if (ParallelDescriptor::IOProcessor())
-            std::cout << "HeatTransfer::scalar_advection(): time: " << run_time << '\n';
+                int use_conserv_diff = (advectionType[sigma] == Conservative) ? true : false;
+
+                tgod.ComputeAofs(bx,
+                                 area[0][AofS_mfi],u_mac[0][AofS_mfi],tedge[0],
+                                 area[1][AofS_mfi],u_mac[1][AofS_mfi],tedge[1],
+#if BL_SPACEDIM==3
+                                 area[2][AofS_mfi],u_mac[2][AofS_mfi],tedge[2],
+#endif
+                                 volume[AofS_mfi],(*aofs)[AofS_mfi],sigma,
+                                 use_conserv_diff);
+
+                if (sigma==RhoH && do_special_rhoh)
+                {
+                    if (do_adv_reflux)
+                        for (int d=0; d<BL_SPACEDIM; ++d)
+                            tedge[d].plus((*fluxNULN[d])[AofS_mfi],tedge[d].box(),0,0,1);
+
+                    FArrayBox& staten = (*aofs)[AofS_mfi];
+                    const FArrayBox& stateo = staten;
+                    const FArrayBox& vol = volume[AofS_mfi];
+                    const Real mult = 1.0;
+                    const int nComp = 1;
+
+                    FORT_INCRWEXTFLXDIV(bx.loVect(), bx.hiVect(),
+                                        (*fluxNULN[0])[AofS_mfi].dataPtr(),
+                                        ARLIM((*fluxNULN[0])[AofS_mfi].loVect()),
+                                        ARLIM((*fluxNULN[0])[AofS_mfi].hiVect()),
+                                        (*fluxNULN[1])[AofS_mfi].dataPtr(),
+                                        ARLIM((*fluxNULN[1])[AofS_mfi].loVect()),
+                                        ARLIM((*fluxNULN[1])[AofS_mfi].hiVect()),
+#if BL_SPACEDIM == 3
+                                        (*fluxNULN[2])[AofS_mfi].dataPtr(),
+                                        ARLIM((*fluxNULN[2])[AofS_mfi].loVect()),
+                                        ARLIM((*fluxNULN[2])[AofS_mfi].hiVect()),
+#endif
+                                        stateo.dataPtr(RhoH),
+                                        ARLIM(stateo.loVect()), ARLIM(stateo.hiVect()),
+                                        staten.dataPtr(RhoH),
+                                        ARLIM(staten.loVect()), ARLIM(staten.hiVect()),
+                                        vol.dataPtr(),
+                                        ARLIM(vol.loVect()), ARLIM(vol.hiVect()),
+                                        &nComp, &mult);
+                }
+
+                if (need_fluxes)
+                {
+                    //
+                    // Faces shared by neighboring tiles are written once.
+                    //
+                    const int fcomp = sigma - fscalar;
+
+                    for (int d=0; d<BL_SPACEDIM; ++d)
+                    {
+                        const Box& ebx = AofS_mfi.nodaltilebox(d);
+                        fluxes[d][AofS_mfi].copy(tedge[d],ebx,0,ebx,fcomp,1);
+                    }
+                }
+            }
+        }
     }
 }
 
@@ -5999,7 +6743,10 @@ HeatTransfer::mac_sync ()
     //
     // Compute the corrective pressure used to compute U^{ADV,corr} in mac_sync_compute
     //
+    const Real sync_strt_time = ParallelDescriptor::second();
     mac_projector->mac_sync_solve(level,dt,Rh,fine_ratio);
+    if (verbose)
+        reportProjTime("mac_sync_solve",sync_strt_time);
 
     if (do_reflux)
     {
@@ -7044,162 +7791,92 @@ HeatTransfer::calc_divu (Real      time,
                          Real      dt,
                          MultiFab& divu)
 {
+    BL_PROFILE("HT::calc_divu()");
     //
-    // Get Mwmix, cpmix and pressure
-    //
-    const int nGrow = 0;
-
-    int sCompR, sCompT, sCompY, sCompCp, sCompMw;
-    sCompR=sCompT=sCompY=sCompCp=sCompMw=0;	
-
-    MultiFab rho(grids,1,nGrow), temp(grids,1,nGrow);
-
-    const MultiFab& Rho_time = get_rho(time);
-
-    for (FillPatchIterator Temp_fpi(*this,temp,nGrow,time,State_Type,Temp,1);
-         Temp_fpi.isValid();
-         ++Temp_fpi)
-    {
-        rho[Temp_fpi].copy(Rho_time[Temp_fpi],0,sCompR,1);
-        temp[Temp_fpi].copy(Temp_fpi(),0,sCompT,1);
-    }
-    //
-    // Note that state contains rho*species, so divide species by rho.
+    // divu = 1/T DT/dt + W_mix * sum (1/W)DY/Dt
     //
-    showMF("divu",rho,"divu_rho",level);
-    showMF("divu",temp,"divu_temp",level);
-
-    MultiFab species(grids,nspecies,nGrow);
-
-    FArrayBox tmp;
-
-    for (FillPatchIterator Spec_fpi(*this,species,nGrow,time,State_Type,first_spec,nspecies);
-         Spec_fpi.isValid();
-         ++Spec_fpi)
-    {
-        const int i = Spec_fpi.index();
-
-        species[Spec_fpi].copy(Spec_fpi(),0,sCompY,nspecies);
-
-        tmp.resize(grids[i],1);
-        tmp.copy(rho[Spec_fpi],sCompR,0,1);
-        tmp.invert(1);
-
-        for (int ispecies = 0; ispecies < nspecies; ispecies++)
-            species[Spec_fpi].mult(tmp,0,ispecies,1);
-    }
-
-    showMF("divu",species,"divu_species",level);
-
-    MultiFab mwmix(grids,1,nGrow), cp(grids,1,nGrow);
-
-    for (MFIter Rho_mfi(rho); Rho_mfi.isValid(); ++Rho_mfi)
-    {
-        const int  iGrid = Rho_mfi.index();
-        const Box& box   = Rho_mfi.validbox();
-
-        BL_ASSERT(box == grids[iGrid]);
-
-        getChemSolve().getMwmixGivenY(mwmix[Rho_mfi],species[Rho_mfi],
-                                      box,sCompY,sCompMw);
-        getChemSolve().getCpmixGivenTY(cp[Rho_mfi],temp[Rho_mfi],species[Rho_mfi],
-                                       box,sCompT,sCompY,sCompCp);
-    }
-
-    showMF("divu",cp,"divu_cp",level);
-    showMF("divu",mwmix,"divu_mwmix",level);
-
-    species.clear();
+    // The visc terms need the diffusion operators and are built first.
+    // Everything else (Y, W_mix, c_p, h_l and the Ydot increment) is
+    // formed cell by cell in one pass by FORT_CALCDIVU, rather than
+    // stored in intermediate MultiFabs and combined in separate sweeps.
     //
-    // divu = 1/T DT/dt + W_mix * sum (1/W)DY/Dt
+    const int nGrow = 0;
     //
     // Compute rho*DT/Dt as
     //
     //   1/c_p (div lambda grad T + sum_l rho D grad h_l dot grad Y_l)
     //
-    {
-        MultiFab visc_terms(grids,1,1);
-        getViscTerms(visc_terms,Temp,1,time);
-        MultiFab::Copy(divu,visc_terms,0,0,1,nGrow);
-    }
-    for (MFIter Divu_mfi(divu); Divu_mfi.isValid(); ++Divu_mfi)
-    {
-        const int iGrid = Divu_mfi.index();
-        divu[Divu_mfi].divide(rho[Divu_mfi],grids[iGrid],sCompR,0,1);
-        divu[Divu_mfi].divide(temp[Divu_mfi],grids[iGrid],sCompT,0,1);
-    }
-    showMF("divu",divu,"divu_VT_T_over_rhoT",level);
-
-    MultiFab delta_divu(grids,1,nGrow), spec_visc_terms(grids,nspecies,0);
-
-    delta_divu.setVal(0.0);
+    MultiFab visc_terms_T(grids,1,1), visc_terms_Y(grids,nspecies,0);
 
-    const Array<Real>& mwt = getChemSolve().speciesMolecWt();
+    getViscTerms(visc_terms_T,Temp,1,time);
+    getViscTerms(visc_terms_Y,first_spec,nspecies,time);
 
-    getViscTerms(spec_visc_terms,first_spec,nspecies,time);
-
-    for (MFIter mfi(spec_visc_terms); mfi.isValid(); ++mfi)
-    {
-        const int iGrid = mfi.index();
-
-        for (int comp = 0; comp < nspecies; ++comp)
-        {
-            spec_visc_terms[mfi].mult(1.0/mwt[comp],comp,1);
-            delta_divu[mfi].plus(spec_visc_terms[mfi],grids[iGrid],comp,0,1);
-        }
-    }
-    showMF("divu",delta_divu,"divu_sum_VT_Y_over_Wi",level);
+    showMF("divu",visc_terms_T,"divu_VT_T",level);
+    showMF("divu",visc_terms_Y,"divu_VT_Y",level);
+    //
+    // Species through Temp in one fill; state contains rho*species.
+    //
+    const int nCompS = Temp - first_spec + 1;
+    const int sCompT = Temp - first_spec;
 
-    spec_visc_terms.clear();
+    MultiFab S(grids,nCompS,nGrow);
 
-    for (MFIter Divu_mfi(divu); Divu_mfi.isValid(); ++Divu_mfi)
+    for (FillPatchIterator S_fpi(*this,S,nGrow,time,State_Type,first_spec,nCompS);
+         S_fpi.isValid();
+         ++S_fpi)
     {
-        const Box& box   = Divu_mfi.validbox();
-        delta_divu[Divu_mfi].divide(rho[Divu_mfi],box,sCompR,0,1);
-        delta_divu[Divu_mfi].mult(mwmix[Divu_mfi],box,0,0,1);
-        divu[Divu_mfi].plus(delta_divu[Divu_mfi],box,0,0,1);
+        S[S_fpi].copy(S_fpi(),0,0,nCompS);
     }
-    showMF("divu",divu,"divu_1",level);
 
-    rho.clear();
+    const MultiFab& Rho_time = get_rho(time);
+    //
+    // Increment divu by
+    //    sum_l (h_l/(c_p*T) - mw_mix/mw_l)*delta Y_l/dt 
+    // (i.e., Y_l"dot").  FORT_CALCDIVU takes this as a production rate,
+    // rYdot = -rho*Ydot, zero when there is no dt.
+    //
+    MultiFab rYdot(grids,nspecies,nGrow);
 
     if (dt > 0.0)
     {
-        //
-        // Increment divu by
-        //    sum_l (h_l/(c_p*T) - mw_mix/mw_l)*delta Y_l/dt 
-        // (i.e., Y_l"dot")
-        //
-        FArrayBox h;
-
-        const int sCompH = 0;
-
-        for (FillPatchIterator Ydot_fpi(*this,delta_divu,0,time,Ydot_Type,0,nspecies);
+        for (FillPatchIterator Ydot_fpi(*this,rYdot,nGrow,time,Ydot_Type,0,nspecies);
              Ydot_fpi.isValid();
              ++Ydot_fpi)
         {
-            const int i = Ydot_fpi.index();
+            FArrayBox& ry = rYdot[Ydot_fpi];
 
-            h.resize(BoxLib::grow(grids[i],nGrow),nspecies);
+            ry.copy(Ydot_fpi(),0,0,nspecies);
+            for (int n = 0; n < nspecies; n++)
+                ry.mult(Rho_time[Ydot_fpi],0,n,1);
+            ry.negate();
+        }
+    }
+    else
+    {
+        rYdot.setVal(0);
+    }
+    //
+    // The T visc term from getViscTerms has already been divided by c_p.
+    //
+    const int vtT_over_cp = 1;
 
-            getChemSolve().getHGivenT(h,temp[Ydot_fpi],grids[i],sCompT,sCompH);
+    for (MFIter mfi(divu); mfi.isValid(); ++mfi)
+    {
+        const Box&       box  = mfi.validbox();
+        FArrayBox&       du   = divu[mfi];
+        const FArrayBox& st   = S[mfi];
+        const FArrayBox& vtT  = visc_terms_T[mfi];
+        const FArrayBox& vtY  = visc_terms_Y[mfi];
+        const FArrayBox& ry   = rYdot[mfi];
 
-            for (int istate = first_spec; istate <= last_spec; istate++)
-            {
-                const int ispec = istate-first_spec;
-
-                delta_divu[Ydot_fpi].copy(h,ispec,0,1);
-                delta_divu[Ydot_fpi].divide(cp[Ydot_fpi]);
-                delta_divu[Ydot_fpi].divide(temp[Ydot_fpi]);
-                delta_divu[Ydot_fpi].mult(Ydot_fpi(),ispec,0,1);
-                divu[Ydot_fpi].plus(delta_divu[Ydot_fpi]);
-
-                delta_divu[Ydot_fpi].copy(mwmix[Ydot_fpi],0,0,1);
-                delta_divu[Ydot_fpi].divide(mwt[ispec]);
-                delta_divu[Ydot_fpi].mult(Ydot_fpi(),ispec,0,1);
-                divu[Ydot_fpi].minus(delta_divu[Ydot_fpi]);
-            }
-        }
+        FORT_CALCDIVU(box.loVect(), box.hiVect(),
+                      du.dataPtr(),          ARLIM(du.loVect()),   ARLIM(du.hiVect()),
+                      ry.dataPtr(),          ARLIM(ry.loVect()),   ARLIM(ry.hiVect()),
+                      vtY.dataPtr(),         ARLIM(vtY.loVect()),  ARLIM(vtY.hiVect()),
+                      vtT.dataPtr(),         ARLIM(vtT.loVect()),  ARLIM(vtT.hiVect()),
+                      st.dataPtr(0),         ARLIM(st.loVect()),   ARLIM(st.hiVect()),
+                      st.dataPtr(sCompT),    ARLIM(st.loVect()),   ARLIM(st.hiVect()),
+                      &vtT_over_cp);
     }
 
     showMF("divu",divu,"divu_2",level);
@@ -7230,24 +7907,12 @@ HeatTransfer::calc_dpdt (Real      time,
     const int pComp = (have_rhort ? RhoRT : Trac);
     const int nGrow = 1;
     
-    int sCompR, sCompT, sCompY, sCompCp, sCompMw;
-    sCompR=sCompT=sCompY=sCompCp=sCompMw=0;
-    
-    MultiFab temp(grids,1,nGrow);
     MultiFab rhoRT(grids,1,nGrow);
     
     const MultiFab& rho = get_rho(time);
 
     BL_ASSERT(rho.boxArray()  == S_old.boxArray());
-    BL_ASSERT(temp.boxArray() == S_old.boxArray());
     BL_ASSERT(dpdt.boxArray() == S_old.boxArray());
-    
-    for (FillPatchIterator Temp_fpi(*this,temp,nGrow,time,State_Type,Temp,1);
-         Temp_fpi.isValid();
-         ++Temp_fpi)
-    {
-        temp[Temp_fpi].copy(Temp_fpi(),0,sCompT,1);
-    }
 
     for (FillPatchIterator rhoRT_fpi(*this,rhoRT,nGrow,time,State_Type,pComp,1);
          rhoRT_fpi.isValid();
@@ -7256,72 +7921,33 @@ HeatTransfer::calc_dpdt (Real      time,
         rhoRT[rhoRT_fpi].copy(rhoRT_fpi(),0,0,1);
     }
     //
-    // Note that state contains rho*species, so divide species by rho.
-    //
-    MultiFab species(grids,nspecies,nGrow);
-
-    FArrayBox tmp;
-
-    for (FillPatchIterator Spec_fpi(*this,species,nGrow,time,State_Type,first_spec,nspecies);
-         Spec_fpi.isValid();
-         ++Spec_fpi)
-    {
-        const int  i  = Spec_fpi.index();
-        const Box& bx = BoxLib::grow(grids[i],nGrow);
-
-        species[Spec_fpi].copy(Spec_fpi(),0,sCompY,nspecies);
-
-        tmp.resize(bx,1);
-        tmp.copy(rho[Spec_fpi],sCompR,0,1);
-        tmp.invert(1);
-
-        for (int ispecies = 0; ispecies < nspecies; ispecies++)
-            species[Spec_fpi].mult(tmp,0,ispecies,1);
-    }
-
-    tmp.clear();
-    
-    MultiFab mwmix(grids,1,nGrow), cp(grids,1,nGrow);
-    
-    for (MFIter Rho_mfi(rho); Rho_mfi.isValid(); ++Rho_mfi)
-    {
-        const int  idx = Rho_mfi.index();
-        const Box& box = BoxLib::grow(Rho_mfi.validbox(),nGrow);
-        
-        BL_ASSERT(Rho_mfi.validbox() == grids[idx]);
-        
-        getChemSolve().getMwmixGivenY(mwmix[Rho_mfi],species[Rho_mfi],box,sCompY,sCompMw);
-        getChemSolve().getCpmixGivenTY(cp[Rho_mfi],temp[Rho_mfi],species[Rho_mfi],box,sCompT,sCompY,sCompCp);
-    }
-
-    temp.clear();
-    species.clear();
-    //
     // Now do pressure relaxation.
     //
     const Real* dx = geom.CellSize();
     //
-    //  Get gamma = c_p/(c_p-R)
+    // Get 1/gamma = c_v/c_p in a single pass over species through Temp
+    // (FORT_CALCGAMMAPINV with unit pressure).
     //
-    MultiFab gamma(grids,1,nGrow);
+    const int  nCompS = Temp - first_spec + 1;
+    const int  sCompT = Temp - first_spec;
+    const Real p_unit = 1;
 
-    FArrayBox rmix;
+    MultiFab gammaInv(grids,1,nGrow);
 
-    for (MFIter mfi(gamma); mfi.isValid(); ++mfi)
+    for (FillPatchIterator S_fpi(*this,gammaInv,nGrow,time,State_Type,first_spec,nCompS);
+         S_fpi.isValid();
+         ++S_fpi)
     {
-        const int idx = mfi.index();
-        gamma[mfi].copy(cp[mfi]);
-        rmix.resize(BoxLib::grow(grids[idx],nGrow),1);
-        rmix.setVal(rgas);
-        rmix.divide(mwmix[mfi]);
-        gamma[mfi].minus(rmix);
-        gamma[mfi].divide(cp[mfi]);
-        gamma[mfi].invert(1.0);
-    }
+        const Box&       box = BoxLib::grow(S_fpi.validbox(),nGrow);
+        const FArrayBox& st  = S_fpi();
+        FArrayBox&       g   = gammaInv[S_fpi];
 
-    rmix.clear();
-    cp.clear();
-    mwmix.clear();
+        FORT_CALCGAMMAPINV(box.loVect(), box.hiVect(),
+                           g.dataPtr(),        ARLIM(g.loVect()),  ARLIM(g.hiVect()),
+                           st.dataPtr(0),      ARLIM(st.loVect()), ARLIM(st.hiVect()),
+                           st.dataPtr(sCompT), ARLIM(st.loVect()), ARLIM(st.hiVect()),
+                           &p_unit);
+    }
 
     FArrayBox ugradp, p_denom;
     
@@ -7369,7 +7995,7 @@ HeatTransfer::calc_dpdt (Real      time,
         //
         // Make sure to divide by gamma *after* subtracting ugradp.
         //
-        dpdt[mfi].divide(gamma[mfi]);
+        dpdt[mfi].mult(gammaInv[mfi]);
 
         if (dpdt_option == 0)
         {
@@ -7729,8 +8355,8 @@ HeatTransfer::setPlotVariables ()
 
     ParmParse pp("ht");
 
-    bool plot_ydot,plot_rhoY,plot_massFrac,plot_moleFrac,plot_conc;
-    plot_ydot=plot_rhoY=plot_massFrac=plot_moleFrac=plot_conc = false;
+    bool plot_ydot,plot_rhoY,plot_massFrac,plot_moleFrac,plot_conc,plot_funccount;
+    plot_ydot=plot_rhoY=plot_massFrac=plot_moleFrac=plot_conc=plot_funccount = false;
 
     if (pp.query("plot_massfrac",plot_massFrac))
     {
@@ -7788,6 +8414,14 @@ HeatTransfer::setPlotVariables ()
         }
     }
   
+    if (pp.query("plot_funccount",plot_funccount))
+    {
+        if (plot_funccount)
+            parent->addStatePlotVar("FuncCount");
+        else
+            parent->deleteStatePlotVar("FuncCount");
+    }
+
     if (pp.query("plot_rhoY",plot_rhoY))
     {
         if (plot_rhoY)
@@ -1,3 +1,4 @@
+#include <map>
 
 #include <HeatTransfer.H>
 
@@ -38,6 +39,38 @@ HeatTransfer::timestamp_add_extras (int lev,
 
 #endif /*PARTICLES*/
 
+namespace
+{
+    //
+    // Running per-level call counts and wall time of the projection solves
+    // reported by reportProjTime, keyed by solve name.
+    //
+    std::map<std::string, std::map<int,int> >  proj_calls;
+    std::map<std::string, std::map<int,Real> > proj_time;
+}
+
+void
+HeatTransfer::reportProjTime (const std::string& name,
+                              Real               strt_time)
+{
+    const int IOProc   = ParallelDescriptor::IOProcessorNumber();
+    Real      run_time = ParallelDescriptor::second() - strt_time;
+
+    ParallelDescriptor::ReduceRealMax(run_time,IOProc);
+
+    int&  ncalls = proj_calls[name][level];
+    Real& ttot   = proj_time[name][level];
+
+    ncalls++;
+    ttot += run_time;
+
+    if (ParallelDescriptor::IOProcessor())
+        std::cout << "HeatTransfer::" << name << "(): lev: " << level
+                  << ", time: " << run_time
+                  << ", calls: " << ncalls
+                  << ", total time: " << ttot << '\n';
+}
+
 void
 HeatTransfer::compute_rhohmix (Real      time,
                                MultiFab& rhohmix)
@@ -13,6 +13,7 @@
 #include <cfloat>
 #include <fstream>
 #include <vector>
+#include <map>
 
 #include <Geometry.H>
 #include <Extrapolater.H>
@@ -103,6 +104,7 @@ namespace
     Real                  temp_control;
     Real                  crse_dt;
     int                   chem_box_chop_threshold;
+    int                   chem_batch_size;
 }
 
 Real HeatTransfer::p_amb_old;
@@ -210,6 +212,7 @@ HeatTransfer::Initialize ()
     temp_control            = -1;
     crse_dt                 = -1;
     chem_box_chop_threshold = -1;
+    chem_batch_size         = 0;
 
     HeatTransfer::p_amb_old                 = -1.0;
     HeatTransfer::p_amb_new                 = -1.0;
@@ -947,6 +950,11 @@ HeatTransfer::init_once ()
         chem_box_chop_threshold = 4;
 #endif
     }
+    //
+    // If > 0, advance_chemistry() integrates cells as a flat, cost-sorted
+    // work list in batches of this many cells rather than box by box.
+    //
+    pp.query("chem_batch_size",chem_batch_size);
     
     if (!ydot_good)
         BoxLib::Error("HeatTransfer::init_once(): need RhoYdot_Type if do_chemistry");
@@ -4375,7 +4383,10 @@ HeatTransfer::advance (Real time,
       // MAC-project... and overwrite U^{ADV,*}
       showMF("sdc",Forcing,"sdc_Forcing_for_mac",level,sdc_iter,parent->levelSteps(level));
       BL_PROFILE_VAR_START(HTMAC);
+      const Real mac_strt_time = ParallelDescriptor::second();
       mac_project(time,dt,S_old,&mac_divu,1,nGrowAdvForcing,updateFluxReg);
+      if (verbose)
+        reportProjTime("mac_project",mac_strt_time);
 
       if (closed_chamber == 1 && level == 0)
       {
@@ -4882,6 +4893,160 @@ HeatTransfer::getFuncCountDM (const BoxArray& bxba, int ngrow)
     return res;
 }
 
+namespace
+{
+    //
+    // A cell queued for batched chemistry: the index of its FAB in the
+    // local sweep, its location, and its function count from last step.
+    //
+    struct ChemCell
+    {
+        int     idx;
+        IntVect iv;
+        Real    cost;
+    };
+
+    struct ChemCellCostGT
+    {
+        bool operator() (const ChemCell& lhs, const ChemCell& rhs) const
+        {
+            return lhs.cost > rhs.cost;
+        }
+    };
+}
+
+//
+// Integrate chemistry on the cells in "regions" as one flat work list.
+// Cells are gathered across all local FABs of STemp, sorted heaviest
+// first by their previous function count, and packed into 1D batches of
+// batch_size cells.  Batches are dealt to threads dynamically (heaviest
+// first), so threads that finish cheap ambient cells pick up the
+// remaining flame cells instead of idling.  Results, function counts and
+// diagnostics are scattered back when all batches are done.
+//
+static
+void
+batched_chemistry (const ChemDriver&            chem,
+                   MultiFab&                    STemp,
+                   MultiFab&                    fcnCnt,
+                   const MultiFab&              FTemp,
+                   MultiFab*                    diag,
+                   const std::vector<BoxArray>& regions,
+                   Real                         dt,
+                   bool                         use_stiff_solver,
+                   int                          batch_size,
+                   bool                         verbose)
+{
+    BL_PROFILE("HT:::batched_chemistry()");
+
+    BL_ASSERT(batch_size > 0);
+
+    const int nspec = chem.numSpecies();
+    const int nS    = STemp.nComp();
+    const int nF    = FTemp.nComp();
+    const int nD    = (diag ? diag->nComp() : 0);
+
+    std::vector<FArrayBox*>       Sfab, Cfab, Dfab;
+    std::vector<const FArrayBox*> Ffab;
+    std::vector<ChemCell>         cells;
+
+    int idx = 0;
+    for (MFIter mfi(STemp); mfi.isValid(); ++mfi, ++idx)
+    {
+        Sfab.push_back(&STemp[mfi]);
+        Cfab.push_back(&fcnCnt[mfi]);
+        Ffab.push_back(&FTemp[mfi]);
+        Dfab.push_back(diag ? &(*diag)[mfi] : 0);
+
+        const BoxArray& ba = regions[idx];
+
+        for (int i = 0; i < ba.size(); ++i)
+        {
+            const Box& bx = ba[i];
+
+            for (IntVect iv = bx.smallEnd(); iv <= bx.bigEnd(); bx.next(iv))
+            {
+                ChemCell c;
+                c.idx  = idx;
+                c.iv   = iv;
+                c.cost = fcnCnt[mfi](iv,0);
+                cells.push_back(c);
+            }
+        }
+    }
+
+    const int ncells = cells.size();
+    const int nbatch = (ncells + batch_size - 1) / batch_size;
+    //
+    // Reduce before the early return: ranks without cells still take part.
+    //
+    if (verbose)
+    {
+        const int IOProc = ParallelDescriptor::IOProcessorNumber();
+
+        int ncmx = ncells, nbmx = nbatch;
+
+        ParallelDescriptor::ReduceIntMax(ncmx,IOProc);
+        ParallelDescriptor::ReduceIntMax(nbmx,IOProc);
+
+        if (ParallelDescriptor::IOProcessor())
+            std::cout << "*** advance_chemistry: max cells/batches per proc: "
+                      << ncmx << " / " << nbmx << '\n';
+    }
+
+    if (ncells == 0) return;
+    //
+    // stable_sort keeps the packing (and hence the answer) deterministic.
+    //
+    std::stable_sort(cells.begin(), cells.end(), ChemCellCostGT());
+
+    const Box pbox(IntVect::TheZeroVector(), IntVect(D_DECL(ncells-1,0,0)));
+
+    FArrayBox Spk(pbox,nS), Fpk(pbox,nF), Cpk(pbox,1), Dpk;
+
+    if (diag) Dpk.resize(pbox,nD);
+
+    for (int n = 0; n < ncells; ++n)
+    {
+        const ChemCell& c = cells[n];
+        const IntVect   pv(D_DECL(n,0,0));
+
+        for (int m = 0; m < nS; ++m)
+            Spk(pv,m) = (*Sfab[c.idx])(c.iv,m);
+        for (int m = 0; m < nF; ++m)
+            Fpk(pv,m) = (*Ffab[c.idx])(c.iv,m);
+        for (int m = 0; m < nD; ++m)
+            Dpk(pv,m) = (*Dfab[c.idx])(c.iv,m);
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic,1)
+#endif
+    for (int b = 0; b < nbatch; ++b)
+    {
+        const int s_spec = 0, s_rhoh = nspec, s_temp = nspec+2;
+        const int lo     = b*batch_size;
+        const int hi     = std::min(ncells, lo+batch_size) - 1;
+        const Box bx(IntVect(D_DECL(lo,0,0)), IntVect(D_DECL(hi,0,0)));
+
+        chem.solveTransient_sdc(Spk,Spk,Spk,Spk,Spk,Spk,Fpk,Cpk,bx,
+                                s_spec,s_rhoh,s_temp,dt,(diag ? &Dpk : 0),
+                                use_stiff_solver);
+    }
+
+    for (int n = 0; n < ncells; ++n)
+    {
+        const ChemCell& c = cells[n];
+        const IntVect   pv(D_DECL(n,0,0));
+
+        for (int m = 0; m < nS; ++m)
+            (*Sfab[c.idx])(c.iv,m) = Spk(pv,m);
+        for (int m = 0; m < nD; ++m)
+            (*Dfab[c.idx])(c.iv,m) = Dpk(pv,m);
+        (*Cfab[c.idx])(c.iv,0) = Cpk(pv,0);
+    }
+}
+
 void
 HeatTransfer::advance_chemistry (MultiFab&       mf_old,
                                  MultiFab&       mf_new,
@@ -4977,28 +5142,51 @@ HeatTransfer::advance_chemistry (MultiFab&       mf_old,
         STemp.copy(mf_old,first_spec,0,nspecies+3); // Parallel copy.
         FTemp.copy(Force);                          // Parallel copy.
 
-        for (MFIter Smfi(STemp); Smfi.isValid(); ++Smfi)
+        if (chem_batch_size > 0)
         {
-            const FArrayBox& rYo      = STemp[Smfi];
-            const FArrayBox& rHo      = STemp[Smfi];
-            const FArrayBox& To       = STemp[Smfi];
-            FArrayBox&       rYn      = STemp[Smfi];
-            FArrayBox&       rHn      = STemp[Smfi];
-            FArrayBox&       Tn       = STemp[Smfi];
-            const Box&       bx       = Smfi.validbox();
-            FArrayBox&       fc       = fcnCntTemp[Smfi];
-            const FArrayBox& frc      = FTemp[Smfi];
-            FArrayBox*       chemDiag = (do_diag ? &(diagTemp[Smfi]) : 0);
-
-            BoxArray ba = do_avg_down_chem ? BoxLib::complementIn(bx,cf_grids) : BoxArray(bx);
-
-            for (int i = 0; i < ba.size(); ++i)
+            //
+            // Seed with last step's function counts; they order the work list.
+            //
+            const MultiFab& FC = get_new_data(FuncCount_Type);
+            fcnCntTemp.setVal(1);
+            fcnCntTemp.copy(FC,0,0,1,std::min(ngrow,FC.nGrow()),0);
+
+            std::vector<BoxArray> regions;
+
+            for (MFIter Smfi(STemp); Smfi.isValid(); ++Smfi)
             {
-                const int s_spec = 0, s_rhoh = nspecies, s_temp = nspecies+2;
+                const Box& bx = Smfi.validbox();
+                regions.push_back(do_avg_down_chem ? BoxLib::complementIn(bx,cf_grids) : BoxArray(bx));
+            }
 
-                bool ok = getChemSolve().solveTransient_sdc(rYn,rHn,Tn,rYo,rHo,To,frc,fc,ba[i],
-							    s_spec,s_rhoh,s_temp,dt,chemDiag,
-							    use_stiff_solver);
+            batched_chemistry(getChemSolve(),STemp,fcnCntTemp,FTemp,(do_diag ? &diagTemp : 0),
+                              regions,dt,use_stiff_solver,chem_batch_size,verbose);
+        }
+        else
+        {
+            for (MFIter Smfi(STemp); Smfi.isValid(); ++Smfi)
+            {
+                const FArrayBox& rYo      = STemp[Smfi];
+                const FArrayBox& rHo      = STemp[Smfi];
+                const FArrayBox& To       = STemp[Smfi];
+                FArrayBox&       rYn      = STemp[Smfi];
+                FArrayBox&       rHn      = STemp[Smfi];
+                FArrayBox&       Tn       = STemp[Smfi];
+                const Box&       bx       = Smfi.validbox();
+                FArrayBox&       fc       = fcnCntTemp[Smfi];
+                const FArrayBox& frc      = FTemp[Smfi];
+                FArrayBox*       chemDiag = (do_diag ? &(diagTemp[Smfi]) : 0);
+
+                BoxArray ba = do_avg_down_chem ? BoxLib::complementIn(bx,cf_grids) : BoxArray(bx);
+
+                for (int i = 0; i < ba.size(); ++i)
+                {
+                    const int s_spec = 0, s_rhoh = nspecies, s_temp = nspecies+2;
+
+                    bool ok = getChemSolve().solveTransient_sdc(rYn,rHn,Tn,rYo,rHo,To,frc,fc,ba[i],
+                                                                s_spec,s_rhoh,s_temp,dt,chemDiag,
+                                                                use_stiff_solver);
+                }
             }
         }
 
@@ -5355,8 +5543,11 @@ HeatTransfer::mac_sync ()
       Real offset = 0.0;
 
       BL_PROFILE_VAR("HT::mac_sync::ucorr", HTUCORR);
+      const Real sync_strt_time = ParallelDescriptor::second();
       mac_projector->mac_sync_solve(level,dt,rho_half,fine_ratio,
 				    &chi_sync,subtract_avg,offset);
+      if (verbose)
+        reportProjTime("mac_sync_solve",sync_strt_time);
       BL_PROFILE_VAR_STOP(HTUCORR);
 
       if (!do_reflux) return;
@@ -6861,6 +7052,8 @@ HeatTransfer::calc_divu (Real      time,
         }
     }
 
+    const int vtT_over_cp = 0;
+
     for (MFIter mfi(S); mfi.isValid(); ++mfi)
     {
         const Box& box = mfi.validbox();            
@@ -6876,7 +7069,8 @@ HeatTransfer::calc_divu (Real      time,
                       vtY.dataPtr(vtCompY),     ARLIM(vtY.loVect()),   ARLIM(vtY.hiVect()),
                       vtT.dataPtr(vtCompT),     ARLIM(vtT.loVect()),   ARLIM(vtT.hiVect()),
                       rhoY.dataPtr(first_spec), ARLIM(rhoY.loVect()),  ARLIM(rhoY.hiVect()),
-                      T.dataPtr(Temp),          ARLIM(T.loVect()),     ARLIM(T.hiVect()));
+                      T.dataPtr(Temp),          ARLIM(T.loVect()),     ARLIM(T.hiVect()),
+                      &vtT_over_cp);
     }
 }
 
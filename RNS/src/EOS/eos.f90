@@ -135,6 +135,37 @@ contains
   end subroutine eos_get_p
 
 
+  ! Batched eos_get_T/eos_get_p on np points with Y(np,nspecies).  T is
+  ! the initial guess on input.  ierr(i) is nonzero where eos_get_T
+  ! would have failed; the caller reports those points.
+  subroutine eos_get_T_vec(np, T, e, Y, ierr)
+    use eos_vec_module, only : eos_vec_get_T
+    integer, intent(in) :: np
+    double precision, intent(inout) :: T(np)
+    double precision, intent(in) :: e(np), Y(np,nspecies)
+    integer, intent(out) :: ierr(np)
+    integer :: i
+    double precision :: cv(np)
+    call eos_vec_get_T(np, e, Y, T, cv, ierr)
+    do i = 1, np
+       T(i) = max(T(i), smallt)
+    end do
+  end subroutine eos_get_T_vec
+
+
+  subroutine eos_get_p_vec(np, p, rho, T, Y)
+    use eos_vec_module, only : eos_vec_get_p
+    integer, intent(in) :: np
+    double precision, intent(out) :: p(np)
+    double precision, intent(in) :: rho(np), T(np), Y(np,nspecies)
+    integer :: i
+    call eos_vec_get_p(np, rho, T, Y, p)
+    do i = 1, np
+       p(i) = max(p(i), smallp)
+    end do
+  end subroutine eos_get_p_vec
+
+
   subroutine eos_get_e(e, T, Y, pt_index)
     double precision, intent(  out) :: e
     double precision, intent(in   ) :: T, Y(nspecies)
@@ -1,28 +1,33 @@
 module variables_module
 
   use meth_params_module
-  use eos_module, only : eos_get_T
+  use eos_module, only : eos_get_T_vec, eos_get_p_vec
 
   implicit none
 
 contains
   
+  ! The EOS is evaluated a row of cells at a time, with the stored
+  ! temperature as the initial guess for the Newton iteration.
   subroutine ctoprim(lo, hi, Q, Qlo, Qhi, QVAR)
     integer, intent(in) :: lo(3), hi(3), Qlo(3), Qhi(3), QVAR
     double precision, intent(inout) :: Q(Qlo(1):Qhi(1),Qlo(2):Qhi(2),Qlo(3):Qhi(3),QVAR)
 
-    integer :: i,j,k,n,iwrk,pt_index(3),ierr
-    double precision :: rwrk, rhoInv, ek, ei, Yt(NSPEC), Xt(NSPEC), ht(NSPEC)
+    integer :: i,j,k,n,iwrk,np
+    double precision :: rwrk, rhoInv, ek, Yt(NSPEC), Xt(NSPEC), ht(NSPEC)
+    integer :: ierr(lo(1):hi(1))
+    double precision :: rowrho(lo(1):hi(1)), rowe(lo(1):hi(1))
+    double precision :: rowT(lo(1):hi(1)), rowp(lo(1):hi(1))
+    double precision :: rowY(lo(1):hi(1),nspec)
+
+    np = hi(1)-lo(1)+1
 
     do       k = lo(3),hi(3)
        do    j = lo(2),hi(2)
           do i = lo(1),hi(1)
 
-             pt_index(1) = i
-             pt_index(2) = j
-             pt_index(3) = k
-
-             rhoInv = 1.d0/Q(i,j,k,QRHO)
+             rowrho(i) = Q(i,j,k,QRHO)
+             rhoInv = 1.d0/rowrho(i)
 
              Q(i,j,k,QU) = Q(i,j,k,QU) * rhoInv
              ek = 0.5d0*Q(i,j,k,QU)**2
@@ -35,38 +40,58 @@ contains
                 ek = ek + 0.5d0*Q(i,j,k,QW)**2
              end if
 
-             ei = Q(i,j,k,UEDEN)*rhoInv - ek
+             rowe(i) = Q(i,j,k,UEDEN)*rhoInv - ek
+             rowT(i) = Q(i,j,k,QTEMP)
 
              do n=1,nspec
                 Yt(n) = max(Q(i,j,k,QFY+n-1), 0.d0)
              end do
              Yt = Yt / sum(Yt)
              Q(i,j,k,QFY:QFY+nspec-1) = Yt
+          end do
+
+          do n=1,nspec
+             do i = lo(1),hi(1)
+                rowY(i,n) = Q(i,j,k,QFY+n-1)
+             end do
+          end do
 
-             call eos_get_T(Q(i,j,k,QTEMP), ei, Yt, pt_index, ierr)
+          call eos_get_T_vec(np, rowT, rowe, rowY, ierr)
 
-             if (ierr .ne. 0) then
+          do i = lo(1),hi(1)
+             if (ierr(i) .ne. 0) then
+                print *, 'EOS: get_T failed, T, e, Y = ', rowT(i), rowe(i), rowY(i,:)
                 print *, 'ctoprim failed at ', i,j,k,Q(i,j,k,1:QFY+nspec-1)
                 call bl_error("ctoprim failed")
              end if
+             Q(i,j,k,QTEMP) = rowT(i)
+          end do
 
-             call ckpy(Q(i,j,k,QRHO), Q(i,j,k,QTEMP), Yt, iwrk, rwrk, Q(i,j,k,qpres))
+          call eos_get_p_vec(np, rowp, rowrho, rowT, rowY)
 
-             if (QVAR .ge. QFX) then
+          do i = lo(1),hi(1)
+             Q(i,j,k,qpres) = rowp(i)
+          end do
+
+          if (QVAR .ge. QFX) then
+             do i = lo(1),hi(1)
+                Yt = rowY(i,:)
                 call ckytx(Yt, iwrk, rwrk, Xt)
                 do n=1,nspec
                    Q(i,j,k,QFX+n-1) = Xt(n)
                 end do
-             end if
+             end do
+          end if
 
-             if (QVAR .ge. QFH) then
+          if (QVAR .ge. QFH) then
+             do i = lo(1),hi(1)
                 call ckhms(Q(i,j,k,QTEMP), iwrk, rwrk, ht)
                 do n=1,nspec
                    Q(i,j,k,QFH+n-1) = ht(n)
                 end do
-             end if
+             end do
+          end if
 
-          end do
        end do
     end do
   end subroutine ctoprim
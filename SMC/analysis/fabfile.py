@@ -389,6 +389,7 @@ scaling.nx         = 64
 scaling.processors = [ 1, 8, 64, 512 ]
 scaling.grid_size  = [ 64, 32, 16, 8 ]
 scaling.stencils   = [ "narrow", "wide" ]
+scaling.halo_stages = [ 1, 0 ]
 
 @task
 def flameball_scaling():
@@ -405,7 +406,30 @@ def flameball_scaling():
                      width=nprocs)
           job.update_params(
               fixed_dt=scaling.dt, stop_time=scaling.stop_time, nx=scaling.nx,
-              max_grid_size=max_grid_size, stencil=stencil)
+              max_grid_size=max_grid_size, stencil=stencil,
+              method="mrsdc", rk_halo_stages=1)
+          jobs.add(job)
+
+  jobs.submit_all()
+
+@task
+def flameball_scaling_halo():
+  """Strong scaling tests for the FlameBall example using RK, with and
+  without the deep-halo mode (rk_halo_stages = 1 and 0)."""
+
+  setenv('Combustion/SMC/bin/FlameBall', find_exe=True)
+
+  jobs = JobQueue(queue='regular', walltime="01:00:00", depth=1)
+
+  for halo in scaling.halo_stages:
+      for nprocs, max_grid_size in zip(scaling.processors, scaling.grid_size):
+          name = 'p%d_rk_halo%d' % (nprocs, halo)
+          job  = Job(name=name, param_file='inputs-strongscaling', rwd='scaling/'+name,
+                     width=nprocs)
+          job.update_params(
+              fixed_dt=scaling.dt, stop_time=scaling.stop_time, nx=scaling.nx,
+              max_grid_size=max_grid_size, stencil="narrow",
+              method="rk", rk_halo_stages=halo)
           jobs.add(job)
 
   jobs.submit_all()
@@ -466,6 +490,52 @@ def flameball_scaling_plot():
 
 
 
+###############################################################################
+# flameball thread-box tuning
+
+tune = Container()
+
+tune.t_tune     = 600.0
+tune.nx         = 64
+tune.processors = [ 1, 8 ]
+tune.grid_size  = [ 64, 32 ]
+tune.stencils   = [ "narrow", "wide" ]
+
+@task
+def flameball_tune():
+  """Tune the thread-box parameters for the FlameBall example (t_tune)."""
+
+  setenv('Combustion/SMC/bin/FlameBall', find_exe=True)
+
+  jobs = JobQueue(queue='regular', walltime="00:30:00", depth=1)
+
+  for stencil in tune.stencils:
+      for nprocs, max_grid_size in zip(tune.processors, tune.grid_size):
+          name = 'p%d_%s' % (nprocs, stencil)
+          job  = Job(name=name, param_file='inputs-tune', rwd='tune/'+name,
+                     width=nprocs)
+          job.update_params(
+              fixed_dt=scaling.dt, stop_time=scaling.stop_time, nx=tune.nx,
+              max_grid_size=max_grid_size, stencil=stencil, t_tune=tune.t_tune)
+          jobs.add(job)
+
+  jobs.submit_all()
+
+@task
+def flameball_tune_report():
+  """Print the best thread-box parameters found by flameball_tune."""
+
+  setenv('Combustion/SMC/bin/FlameBall')
+
+  for stencil in tune.stencils:
+      for nprocs in tune.processors:
+          name = 'p%d_%s' % (nprocs, stencil)
+          with cd(env.rwd):
+              print green(name)
+              run("cat tune/%s/smc_tune.inputs" % name)
+              run("sed -n '/^kernels/,$p' tune/%s/smc_tune.report" % name)
+
+
 ###############################################################################
 # build, rsync, setenv etc
 
@@ -25,14 +25,30 @@ module advance_module
   public single_sdc_feval, sdc_post_step_cb
   public multi_sdc_feval_slow, multi_sdc_feval_fast
   public sdc_get_q0
+  public dUdt_tune
+  public rk_halo_setup
+  public dUdt_rank_report
 
   logical, save, private :: trans_called, Mach_computed
   integer, save, private :: istep_first = -1
   integer, save, private :: istep_this
   double precision, save, private :: dt
 
+  ! RK stages per ghost cell exchange in the deep-halo mode
+  integer, save, private :: rk_halo_k = 1
+
+  ! Stiffness-adaptive MRSDC (sdc_adaptive): for each local box, the step
+  ! in which its reaction term was last computed, and whether it is stiff
+  integer, allocatable, save, private :: r_step(:)
+  logical, allocatable, save, private :: r_stiff(:)
+
   integer, public :: count_ad = 0, count_r = 0
 
+  ! wall clock time spent in the pieces of dUdt, accumulated on each rank
+  integer, parameter, public :: wt_ctoprim=1, wt_gettrans=2, wt_hypdiffterm=3, &
+       wt_chemterm=4, wt_nscbc=5, nwt_dUdt=5
+  double precision, public, save :: dUdt_wtime(nwt_dUdt) = 0.d0
+
   interface
      function get_dt_m(mrex, comp, m) result(r) bind(c)
        import sdc_mrex, c_int, c_double
@@ -53,6 +69,8 @@ contains
     integer,           intent(in   ) :: istep
     type(sdc_ctx),     intent(inout) :: sdc
 
+    double precision :: frac
+
     if (istep_first < 0) then
        istep_first = istep
     end if
@@ -87,6 +105,13 @@ contains
 
     dtio = dt
 
+    if (trans_tol > 0.d0 .and. trans_int .le. 0 .and. verbose .ge. 1) then
+       frac = trans_lag_stats()
+       if (frac .ge. 0.d0 .and. parallel_IOProcessor()) then
+          print *, "gettrans: fraction of blocks refreshed per evaluation", frac
+       end if
+    end if
+
   end subroutine advance
 
   !
@@ -102,27 +127,31 @@ contains
     double precision,  intent(in   ) :: dx(3)
 
     type(bl_prof_timer), save :: bpt_rkstep1, bpt_rkstep2, bpt_rkstep3
+    integer :: g
 
     call tb_multifab_setval(Unew, 0.d0, .true.)
 
     call build(bpt_rkstep1, "rkstep1")
-    call dUdt(U, Uprime, time, -1.d0, dx, courno=courno)
-    call update_rk(Zero,Unew, One,U, dt, Uprime)
-    call reset_density(Unew)
+    call rk_halo_stage(1, 3, g, U)
+    call dUdt(U, Uprime, time, -1.d0, dx, courno=courno, ng_halo=g)
+    call update_rk(Zero,Unew, One,U, dt, Uprime, g)
+    call reset_density(Unew, g)
     call impose_hard_bc(Unew, time+OneThird*dt, dx)
     call destroy(bpt_rkstep1)
 
     call build(bpt_rkstep2, "rkstep2")
-    call dUdt(Unew, Uprime, time+OneThird*dt, OneThird*dt, dx)
-    call update_rk(OneQuarter, Unew, ThreeQuarters, U, OneQuarter*dt, Uprime)
-    call reset_density(Unew)
+    call rk_halo_stage(2, 3, g, Unew)
+    call dUdt(Unew, Uprime, time+OneThird*dt, OneThird*dt, dx, ng_halo=g)
+    call update_rk(OneQuarter, Unew, ThreeQuarters, U, OneQuarter*dt, Uprime, g)
+    call reset_density(Unew, g)
     call impose_hard_bc(Unew, time+TwoThirds*dt, dx)
     call destroy(bpt_rkstep2)
 
     call build(bpt_rkstep3, "rkstep3")
-    call dUdt(Unew, Uprime, time+TwoThirds*dt, TwoThirds*dt, dx)
-    call update_rk(OneThird, U, TwoThirds, Unew, TwoThirds*dt, Uprime)
-    call reset_density(U)
+    call rk_halo_stage(3, 3, g, Unew)
+    call dUdt(Unew, Uprime, time+TwoThirds*dt, TwoThirds*dt, dx, ng_halo=g)
+    call update_rk(OneThird, U, TwoThirds, Unew, TwoThirds*dt, Uprime, g)
+    call reset_density(U, g)
     call impose_hard_bc(U, time+dt, dx)
     call destroy(bpt_rkstep3)
 
@@ -169,32 +198,33 @@ contains
 
     type(bl_prof_timer), save :: bpt_rkstep(6)
     double precision :: t
-    integer :: j
+    integer :: j, g
 
     ! init carry-over
     call copy(Unew, U)
 
     do j = 1, 6
        call build(bpt_rkstep(j), bpt_names(j))
+       call rk_halo_stage(j, 6, g, U, Unew)
        if (j == 1) then
           ! -rk64_time(j) is a hack.
           ! for the first step, dt is not set yet
-          call dUdt(U, Uprime, time, -rk64_time(j), dx, courno=courno)
+          call dUdt(U, Uprime, time, -rk64_time(j), dx, courno=courno, ng_halo=g)
        else
-          call dUdt(U, Uprime, t, rk64_time(j)*dt, dx)
+          call dUdt(U, Uprime, t, rk64_time(j)*dt, dx, ng_halo=g)
        end if
 
        t = time + rk64_time(j) * dt
 
        ! update solution
-       call update_rk(0.0d0, U, 1.0d0, Unew, rk64_alpha(j)*dt, Uprime)
-       call reset_density(U)
+       call update_rk(0.0d0, U, 1.0d0, Unew, rk64_alpha(j)*dt, Uprime, g)
+       call reset_density(U, g)
        call impose_hard_bc(U, t, dx)
 
        ! update carry-over
        if (j < 6) then
-          call update_rk(0.0d0, Unew, 1.0d0, U, rk64_beta(j)*dt, Uprime)
-          call reset_density(Unew)
+          call update_rk(0.0d0, Unew, 1.0d0, U, rk64_beta(j)*dt, Uprime, g)
+          call reset_density(Unew, g)
           call impose_hard_bc(Unew, t, dx)
        end if
 
@@ -206,6 +236,48 @@ contains
 
   end subroutine advance_rk64
 
+  !
+  ! Deep-halo mode of the RK integrators (rk_halo_stages).  The stages
+  ! are done in groups of rk_halo_k, with one ghost cell exchange per
+  ! group that is wide enough for all of its stages.  Stage j of
+  ! nstages then computes U on the boxes grown by ng_halo cells, the
+  ! region still needed by the stages left in its group.  U1 is the
+  ! state passed to dUdt; U2, if present, is only read on the grown
+  ! boxes.  ng_halo is -1 if the mode is off, and dUdt does the exchange.
+  !
+  subroutine rk_halo_stage(j, nstages, ng_halo, U1, U2)
+    integer,        intent(in   ) :: j, nstages
+    integer,        intent(  out) :: ng_halo
+    type(multifab), intent(inout) :: U1
+    type(multifab), intent(inout), optional :: U2
+
+    integer :: js, nj
+    type(mf_fb_data) :: fb1, fb2
+
+    type(bl_prof_timer), save :: bpt_rkhalo
+
+    if (state_ng .eq. stencil_ng) then
+       ng_halo = -1
+       return
+    end if
+
+    js = mod(j-1, rk_halo_k)                  ! stages done in this group
+    nj = min(rk_halo_k, nstages-(j-1-js))     ! stages in this group
+    ng_halo = (nj-js-1) * stencil_ng
+
+    if (js .eq. 0) then
+       call build(bpt_rkhalo, "rkhalo")   !! vvvvvvvvvvvvvvvvvvvvvvv timer
+       call multifab_fill_boundary_nowait(U1, fb1, ng=ng_halo+stencil_ng)
+       if (present(U2) .and. ng_halo .gt. 0) then
+          call multifab_fill_boundary_nowait(U2, fb2, ng=ng_halo)
+          call multifab_fill_boundary_finish(U2, fb2)
+       end if
+       call multifab_fill_boundary_finish(U1, fb1)
+       call destroy(bpt_rkhalo)           !! ^^^^^^^^^^^^^^^^^^^^^^^ timer
+    end if
+
+  end subroutine rk_halo_stage
+
   !
   ! Advance U using single-rate SDC time-stepping
   !
@@ -360,7 +432,7 @@ contains
   end subroutine sdc_post_step_cb
 
   subroutine multi_sdc_feval_slow(Fptr, Uptr, t, state, ctxptr) bind(c)
-    use probin_module, only : sdc_multirate_explicit
+    use probin_module, only : sdc_multirate_explicit, sdc_adaptive
 
     type(c_ptr),     intent(in), value :: Fptr, Uptr, ctxptr
     type(sdc_state), intent(in)        :: state
@@ -380,12 +452,12 @@ contains
        Uprime_chem => sdc_get_chemterm(ctx, state%node)
        call dUdt(U, Uprime, t, dt_m, ctx%dx, include_r=.false., Uprime_c=Uprime_chem)
     else
-       call dUdt(U, Uprime, t, dt_m, ctx%dx, include_ad=.false.)
+       call dUdt(U, Uprime, t, dt_m, ctx%dx, include_ad=.false., lag_r=sdc_adaptive)
     end if
   end subroutine multi_sdc_feval_slow
 
   subroutine multi_sdc_feval_fast(Fptr, Uptr, t, state, ctxptr) bind(c)
-    use probin_module, only : sdc_multirate_explicit
+    use probin_module, only : sdc_multirate_explicit, sdc_adaptive
     type(c_ptr),     intent(in), value :: Fptr, Uptr, ctxptr
     type(sdc_state), intent(in)        :: state
     real(c_double),  intent(in), value :: t
@@ -401,7 +473,7 @@ contains
     dt_m = dt * get_dt_m(ctx%mrex, 1, state%node)
 
     if (sdc_multirate_explicit) then
-       call dUdt(U, Uprime, t, dt_m, ctx%dx, include_ad=.false.)
+       call dUdt(U, Uprime, t, dt_m, ctx%dx, include_ad=.false., lag_r=sdc_adaptive)
     else
        Uprime_chem => sdc_get_chemterm(ctx, state%node)
        call dUdt(U, Uprime, t, dt_m, ctx%dx, include_r=.false., Uprime_c=Uprime_chem)
@@ -416,7 +488,7 @@ contains
 
     use time_module, only : time
     use smcdata_module, only : Q
-    use probin_module, only : cfl_int, fixed_dt
+    use probin_module, only : cfl_int, fixed_dt, sdc_adaptive, verbose
 
     type(multifab),   intent(inout) :: U
     double precision, intent(inout) :: courno
@@ -427,7 +499,7 @@ contains
     logical :: update_courno
     double precision :: courno_proc
 
-    integer :: k
+    integer :: k, nstiff
     double precision :: res0, res1
     type(layout) :: la
     type(multifab), target :: R
@@ -513,6 +585,13 @@ contains
     if (sdc%tol_residual > 0.d0) then
        call destroy(R)
     end if
+
+    if (sdc_adaptive .and. verbose .ge. 1 .and. allocated(r_stiff)) then
+       call parallel_reduce(nstiff, count(r_stiff), MPI_SUM)
+       if (parallel_IOProcessor()) then
+          print *, "SDC: reaction term at every node in", nstiff, "of", nboxes(U), "boxes"
+       end if
+    end if
   end subroutine advance_multi_sdc
 
 
@@ -601,18 +680,21 @@ contains
 
   !
   ! Compute U1 = a U1 + b U2 + c Uprime.
+  ! (also in the first ng_halo ghost cells, if passed)
   !
-  subroutine update_rk(a,U1,b,U2,c,Uprime)
+  subroutine update_rk(a,U1,b,U2,c,Uprime,ng_halo)
 
     type(multifab),   intent(in   ) :: U2, Uprime
     type(multifab),   intent(inout) :: U1
     double precision, intent(in   ) :: a, b, c
+    integer,          intent(in   ), optional :: ng_halo
 
-    integer :: lo(3), hi(3), i, j, k, m, n, nc, dm
+    integer :: lo(3), hi(3), i, j, k, m, n, nc, dm, ngh
     double precision, pointer, dimension(:,:,:,:) :: u1p, u2p, upp
 
     dm = U1%dim
     nc = ncomp(U1)
+    ngh = 0; if (present(ng_halo)) ngh = max(ng_halo, 0)
 
     !$omp parallel private(i,j,k,m,n,lo,hi,u1p,u2p,upp)
     lo = 1
@@ -625,8 +707,8 @@ contains
        u2p => dataptr(U2,    n)
        upp => dataptr(Uprime,n)
 
-       lo(1:dm) = tb_get_valid_lo(n)
-       hi(1:dm) = tb_get_valid_hi(n)
+       lo(1:dm) = tb_get_halo_lo(n, ngh)
+       hi(1:dm) = tb_get_halo_hi(n, ngh)
 
        do m = 1, nc
           do k = lo(3),hi(3)
@@ -648,33 +730,45 @@ contains
   !
   ! The Courant number (courno) is also computed if passed.
   !
-  subroutine dUdt (U, Uprime, t, dt_m, dx, courno, include_ad, include_r, Uprime_c)
+  ! If ng_halo >= 0 is passed (deep-halo mode), the caller has already
+  ! filled the ghost cells of U out to ng_halo+stencil_ng, and dU/dt is
+  ! computed on the boxes grown by ng_halo.
+  !
+  ! If lag_r is true (sdc_adaptive), boxes that are not stiff reuse the
+  ! reaction term of their first evaluation in this step.
+  !
+  subroutine dUdt (U, Uprime, t, dt_m, dx, courno, include_ad, include_r, Uprime_c, ng_halo, &
+       lag_r)
 
     use derivative_stencil_module, only : stencil, narrow, s3d
-    use smcdata_module, only : Q, mu, xi, lam, Ddiag, Fdif, Upchem, qx, qy, qz
+    use smcdata_module, only : Q, mu, xi, lam, Ddiag, Fdif, Upchem, qx, qy, qz, Qtrans
     use probin_module, only : overlap_comm_comp, overlap_comm_gettrans, cfl_int, fixed_dt, &
-         trans_int, mach_int
+         trans_int, mach_int, sdc_adaptive_tol, trans_tol
 
     type(multifab),   intent(inout) :: U, Uprime
     double precision, intent(in   ) :: t, dt_m, dx(3)
     double precision, intent(inout), optional :: courno
     logical,          intent(in   ), optional :: include_ad, include_r
     type(multifab),   intent(in   ), optional :: Uprime_c
+    integer,          intent(in   ), optional :: ng_halo
+    logical,          intent(in   ), optional :: lag_r
 
     integer ::    lo(U%dim),    hi(U%dim)
     integer ::   dlo(U%dim),   dhi(U%dim)
     integer ::   blo(U%dim),   bhi(U%dim)
-    integer :: dm, n, ng, iblock
+    integer :: dm, n, ng, itask, ngh
     integer :: ng_ctoprim, ng_gettrans
 
     logical :: update_trans, update_mach
 
     logical :: update_courno
-    double precision :: courno_proc, dt_m_safe
+    double precision :: courno_proc, dt_m_safe, wt
 
     type(mf_fb_data) :: U_fb_data, qx_fb_data, qy_fb_data, qz_fb_data
 
-    logical :: inc_ad, inc_r, rYt_only
+    logical :: inc_ad, inc_r, rYt_only, halo, do_fb, lag
+    logical :: skip_r(nfabs(U))
+    integer :: rlo(3), rhi(3)
 
     integer :: qlo(4), qhi(4), uplo(4), uphi(4), ulo(4), uhi(4), flo(4), fhi(4), &
          upclo(4), upchi(4), qxlo(4), qxhi(4), qylo(4), qyhi(4), qzlo(4), qzhi(4)
@@ -690,6 +784,25 @@ contains
     inc_ad = .true.; if (present(include_ad)) inc_ad = include_ad
     inc_r  = .true.; if (present(include_r))  inc_r  = include_r
 
+    ngh = -1; if (present(ng_halo)) ngh = ng_halo
+    halo = ngh .ge. 0
+    ngh = max(ngh, 0)
+    do_fb = inc_ad .and. .not.halo
+
+    lag = .false.; if (present(lag_r)) lag = lag_r .and. inc_r
+    skip_r = .false.
+    if (lag) then
+       if (allocated(r_step)) then
+          if (size(r_step) .ne. nfabs(U)) deallocate(r_step, r_stiff)
+       end if
+       if (.not. allocated(r_step)) then
+          allocate(r_step(nfabs(U)), r_stiff(nfabs(U)))
+          r_step  = -1
+          r_stiff = .true.
+       end if
+       skip_r = (.not. r_stiff) .and. (r_step .eq. istep_this)
+    end if
+
     update_courno = .false.
     if (present(courno) .and. fixed_dt.le.0.d0) then
        if (mod(istep_this,cfl_int).eq.1 .or. cfl_int.le.1) then
@@ -721,7 +834,7 @@ contains
        end if
     end if
 
-    if (inc_ad) then
+    if (do_fb) then
        call multifab_fill_boundary_nowait(U, U_fb_data)
 
        if (overlap_comm_comp) then
@@ -731,13 +844,15 @@ contains
        end if
     end if
 
-    call tb_multifab_setval(Uprime, ZERO)
+    call tb_multifab_setval(Uprime, ZERO, all=(ngh.gt.0))
 
-    if (inc_ad .and. overlap_comm_comp) then
+    if (do_fb .and. overlap_comm_comp) then
        call multifab_fill_boundary_test(U, U_fb_data)
     end if
 
-    if (.not. inc_ad) then
+    if (halo) then
+       ng_ctoprim = ngh + stencil_ng
+    else if (.not. inc_ad) then
        ng_ctoprim = 0
     else if (U_fb_data%rcvd) then
        ng_ctoprim = ng
@@ -752,11 +867,13 @@ contains
     ! Calculate primitive variables based on U
     !
     call build(bpt_ctoprim, "ctoprim")   !! vvvvvvvvvvvvvvvvvvvvvvv timer
+    wt = parallel_wtime()
     rYt_only = .not. (inc_ad .or. update_courno)
     call ctoprim(U, Q, ng_ctoprim, rYT_only=rYt_only)
+    dUdt_wtime(wt_ctoprim) = dUdt_wtime(wt_ctoprim) + (parallel_wtime() - wt)
     call destroy(bpt_ctoprim)            !! ^^^^^^^^^^^^^^^^^^^^^^^ timer
 
-    if (inc_ad .and. overlap_comm_comp) then
+    if (do_fb .and. overlap_comm_comp) then
        call multifab_fill_boundary_test(U, U_fb_data)
     end if
 
@@ -776,7 +893,7 @@ contains
        dt_m_safe = dt_m
     end if
 
-    if (inc_ad .and. overlap_comm_comp) then
+    if (do_fb .and. overlap_comm_comp) then
        call multifab_fill_boundary_test(U, U_fb_data)
     end if
 
@@ -788,10 +905,12 @@ contains
        ! chemistry
        !
        call build(bpt_chemterm, "chemterm")   !! vvvvvvvvvvvvvvvvvvvvvvv timer
-       !$omp parallel private(n,qp,upp,upcp,qlo,qhi,uplo,uphi,lo,hi,upclo,upchi)
-       do n=1,nfabs(Q)
+       wt = parallel_wtime()
+       call tb_sched_begin()
+       !$omp parallel private(n,itask,qp,upp,upcp,qlo,qhi,uplo,uphi,lo,hi,upclo,upchi,rlo,rhi)
+       do while (tb_sched_next(itask))
 
-          if (.not.tb_worktodo(n)) cycle
+          n = tb_get_task_box(itask)
 
           qp   => dataptr(Q,n)
           upp  => dataptr(Uprime,n)
@@ -804,10 +923,18 @@ contains
           upclo = lbound(upcp)
           upchi = ubound(upcp)
 
-          lo = tb_get_valid_lo(n)
-          hi = tb_get_valid_hi(n)
-
-          if (dm .eq. 1) then
+          lo = tb_get_task_halo_lo(itask, ngh)
+          hi = tb_get_task_halo_hi(itask, ngh)
+
+          if (skip_r(n)) then
+             ! Upchem still holds the last reaction term of this box
+             rlo = 1
+             rhi = 1
+             rlo(1:dm) = lo
+             rhi(1:dm) = hi
+             upp(rlo(1):rhi(1),rlo(2):rhi(2),rlo(3):rhi(3),iry1:iry1+nspecies-1) = &
+                  upcp(rlo(1):rhi(1),rlo(2):rhi(2),rlo(3):rhi(3),iry1:iry1+nspecies-1)
+          else if (dm .eq. 1) then
              call chemterm_1d(lo,hi,qp,qlo(1:1),qhi(1:1),upp,uplo(1:1),uphi(1:1), &
                   upcp,upclo(1:1),upchi(1:1), dt_m_safe)
           else if (dm .eq. 2) then
@@ -819,6 +946,15 @@ contains
           end if
        end do
        !$omp end parallel
+
+       if (lag) then
+          do n=1,nfabs(U)
+             if (skip_r(n)) cycle
+             r_step(n)  = istep_this
+             r_stiff(n) = dt * reaction_activity(Q, Upchem, n) .gt. sdc_adaptive_tol
+          end do
+       end if
+       dUdt_wtime(wt_chemterm) = dUdt_wtime(wt_chemterm) + (parallel_wtime() - wt)
        call destroy(bpt_chemterm)                !! ^^^^^^^^^^^^^^^^^^^^^^^ timer
     end if
 
@@ -827,7 +963,7 @@ contains
     !
     if (inc_ad) then
 
-       if (overlap_comm_comp) then
+       if (do_fb .and. overlap_comm_comp) then
           if (overlap_comm_gettrans) then
              call multifab_fill_boundary_test(U, U_fb_data)
           else
@@ -835,7 +971,9 @@ contains
           end if
        end if
 
-       if (U_fb_data%rcvd) then
+       if (halo) then
+          ng_gettrans = ng_ctoprim
+       else if (U_fb_data%rcvd) then
           ng_gettrans = ng
        else
           ng_gettrans = 0
@@ -844,12 +982,14 @@ contains
        ! Fill ghost cells here for get_transport_properties
        if (ng_gettrans .eq. ng .and. ng_ctoprim .eq. 0) then
           call build(bpt_ctoprim, "ctoprim")    !! vvvvvvvvvvvvvvvvvvvvvvv timer
+          wt = parallel_wtime()
           call ctoprim(U, Q, ghostcells_only=.true.)
+          dUdt_wtime(wt_ctoprim) = dUdt_wtime(wt_ctoprim) + (parallel_wtime() - wt)
           call destroy(bpt_ctoprim)             !! ^^^^^^^^^^^^^^^^^^^^^^^ timer
           ng_ctoprim = ng
        end if
 
-       if (overlap_comm_comp) then
+       if (do_fb .and. overlap_comm_comp) then
           call multifab_fill_boundary_test(U, U_fb_data)
        end if
 
@@ -858,23 +998,34 @@ contains
        !
        if (update_trans) then
           call build(bpt_gettrans, "gettrans")   !! vvvvvvvvvvvvvvvvvvvvvvv timer
-          call get_transport_properties(Q, mu, xi, lam, Ddiag, ng_gettrans)
+          wt = parallel_wtime()
+          if (trans_tol > 0.d0 .and. trans_int .le. 0) then
+             call get_transport_properties_lagged(Q, Qtrans, mu, xi, lam, Ddiag, &
+                  trans_tol, ng_gettrans)
+          else
+             call get_transport_properties(Q, mu, xi, lam, Ddiag, ng_gettrans)
+          end if
           trans_called = .true.
+          dUdt_wtime(wt_gettrans) = dUdt_wtime(wt_gettrans) + (parallel_wtime() - wt)
           call destroy(bpt_gettrans)               !! ^^^^^^^^^^^^^^^^^^^^^^^ timer
        end if
 
-       if (overlap_comm_comp) then
+       if (do_fb .and. overlap_comm_comp) then
           call multifab_fill_boundary_waitrecv(U, U_fb_data)
 
           if (ng_ctoprim .eq. 0) then
              call build(bpt_ctoprim, "ctoprim")    !! vvvvvvvvvvvvvvvvvvvvvvv timer
+             wt = parallel_wtime()
              call ctoprim(U, Q, ghostcells_only=.true.)
+             dUdt_wtime(wt_ctoprim) = dUdt_wtime(wt_ctoprim) + (parallel_wtime() - wt)
              call destroy(bpt_ctoprim)             !! ^^^^^^^^^^^^^^^^^^^^^^^ timer
           end if
 
           if (ng_gettrans .eq. 0 .and. update_trans) then
              call build(bpt_gettrans, "gettrans")   !! vvvvvvvvvvvvvvvvvvvvvvv timer
+             wt = parallel_wtime()
              call get_transport_properties(Q, mu, xi, lam, Ddiag, ghostcells_only=.true.)
+             dUdt_wtime(wt_gettrans) = dUdt_wtime(wt_gettrans) + (parallel_wtime() - wt)
              call destroy(bpt_gettrans)                !! ^^^^^^^^^^^^^^^^^^^^^^^ timer
           end if
 
@@ -885,13 +1036,15 @@ contains
        ! Hyperbolic and Transport terms
        !
        call build(bpt_hypdiffterm, "hypdiffterm")   !! vvvvvvvvvvvvvvvvvvvvvvv timer
+       wt = parallel_wtime()
        if (stencil .eq. narrow) then
 
-          !$omp parallel private(n,iblock,lo,hi,up,ulo,uhi,upp,uplo,uphi,qp,qlo,qhi) &
+          call tb_sched_begin()
+          !$omp parallel private(n,itask,lo,hi,up,ulo,uhi,upp,uplo,uphi,qp,qlo,qhi) &
           !$omp private(fp,flo,fhi,mup,xip,lamp,Ddp,dlo,dhi,blo,bhi)
-          do n=1,nfabs(Q)
+          do while (tb_sched_next(itask))
 
-             if (.not.tb_worktodo(n)) cycle
+             n = tb_get_task_box(itask)
 
              up => dataptr(U,n)
              upp=> dataptr(Uprime,n)
@@ -914,41 +1067,40 @@ contains
              call get_data_lo_hi(n,dlo,dhi)
              call get_boxbc(n,blo,bhi)
 
-             do iblock = 1, tb_get_nblocks(n)
-                lo = tb_get_block_lo(iblock,n)
-                hi = tb_get_block_hi(iblock,n)
-
-                if (dm .eq. 1) then
-                   call hypterm_1d(lo,hi,dx,up,ulo(1:1),uhi(1:1),qp,qlo(1:1),qhi(1:1),&
-                        upp,uplo(1:1),uphi(1:1),dlo,dhi,blo,bhi)
-
-                   call narrow_diffterm_1d(lo,hi,dx,qp,qlo(1:1),qhi(1:1),upp,uplo(1:1),uphi(1:1), &
-                        fp,flo(1:1),fhi(1:1),mup,xip,lamp,Ddp,dlo,dhi,blo,bhi)
-                else if (dm .eq. 2) then
-                   call hypterm_2d(lo,hi,dx,up,ulo(1:2),uhi(1:2),qp,qlo(1:2),qhi(1:2),&
-                        upp,uplo(1:2),uphi(1:2),dlo,dhi,blo,bhi)
-
-                   call narrow_diffterm_2d(lo,hi,dx,qp,qlo(1:2),qhi(1:2),upp,uplo(1:2),uphi(1:2), &
-                        fp,flo(1:2),fhi(1:2),mup,xip,lamp,Ddp,dlo,dhi,blo,bhi)
-                else
-                   call hypterm_3d(lo,hi,dx,up,ulo(1:3),uhi(1:3),qp,qlo(1:3),qhi(1:3),&
-                        upp,uplo(1:3),uphi(1:3),dlo,dhi,blo,bhi)
-
-                   call narrow_diffterm_3d(lo,hi,dx,qp,qlo(1:3),qhi(1:3),upp,uplo(1:3),uphi(1:3), &
-                        fp,flo(1:3),fhi(1:3),mup,xip,lamp,Ddp,dlo,dhi,blo,bhi)
-                end if
-             end do
+             lo = tb_get_task_halo_lo(itask, ngh)
+             hi = tb_get_task_halo_hi(itask, ngh)
+
+             if (dm .eq. 1) then
+                call hypterm_1d(lo,hi,dx,up,ulo(1:1),uhi(1:1),qp,qlo(1:1),qhi(1:1),&
+                     upp,uplo(1:1),uphi(1:1),dlo,dhi,blo,bhi)
+
+                call narrow_diffterm_1d(lo,hi,dx,qp,qlo(1:1),qhi(1:1),upp,uplo(1:1),uphi(1:1), &
+                     fp,flo(1:1),fhi(1:1),mup,xip,lamp,Ddp,dlo,dhi,blo,bhi)
+             else if (dm .eq. 2) then
+                call hypterm_2d(lo,hi,dx,up,ulo(1:2),uhi(1:2),qp,qlo(1:2),qhi(1:2),&
+                     upp,uplo(1:2),uphi(1:2),dlo,dhi,blo,bhi)
+
+                call narrow_diffterm_2d(lo,hi,dx,qp,qlo(1:2),qhi(1:2),upp,uplo(1:2),uphi(1:2), &
+                     fp,flo(1:2),fhi(1:2),mup,xip,lamp,Ddp,dlo,dhi,blo,bhi)
+             else
+                call hypterm_3d(lo,hi,dx,up,ulo(1:3),uhi(1:3),qp,qlo(1:3),qhi(1:3),&
+                     upp,uplo(1:3),uphi(1:3),dlo,dhi,blo,bhi)
+
+                call narrow_diffterm_3d(lo,hi,dx,qp,qlo(1:3),qhi(1:3),upp,uplo(1:3),uphi(1:3), &
+                     fp,flo(1:3),fhi(1:3),mup,xip,lamp,Ddp,dlo,dhi,blo,bhi)
+             end if
 
           end do
           !$omp end parallel
 
        else if (stencil .eq. s3d) then
 
-          !$omp parallel private(n,iblock,lo,hi,qp,qlo,qhi) &
+          call tb_sched_begin()
+          !$omp parallel private(n,itask,lo,hi,qp,qlo,qhi) &
           !$omp private(qxp,qxlo,qxhi,qyp,qylo,qyhi,qzp,qzlo,qzhi) &
           !$omp private(fp,flo,fhi,mup,xip,dlo,dhi,blo,bhi)
-          do n=1,nfabs(Q)
-             if (.not.tb_worktodo(n)) cycle
+          do while (tb_sched_next(itask))
+             n = tb_get_task_box(itask)
 
              qp => dataptr(Q,n)
              qxp => dataptr(qx, n)
@@ -979,23 +1131,21 @@ contains
              call get_data_lo_hi(n,dlo,dhi)
              call get_boxbc(n,blo,bhi)
 
-             do iblock = 1, tb_get_nblocks(n)
-                lo = tb_get_block_lo(iblock,n)
-                hi = tb_get_block_hi(iblock,n)
-
-                if (dm .eq. 1) then
-                   call bl_error("1D not supported for wide (i.e., S3D) stencil")
-                else if (dm .eq. 2) then
-                   call bl_error("2D not supported for wide (i.e., S3D) stencil")
-                else
-                   call s3d_diffterm_1_3d(lo,hi,dx,qp,qlo(1:3),qhi(1:3),  &
-                        fp,flo(1:3),fhi(1:3),    &
-                        qxp,qxlo(1:3),qxhi(1:3), &
-                        qyp,qylo(1:3),qyhi(1:3), &
-                        qzp,qzlo(1:3),qzhi(1:3), &
-                        mup,xip,dlo,dhi,blo,bhi)
-                end if
-             end do
+             lo = tb_get_task_lo(itask)
+             hi = tb_get_task_hi(itask)
+
+             if (dm .eq. 1) then
+                call bl_error("1D not supported for wide (i.e., S3D) stencil")
+             else if (dm .eq. 2) then
+                call bl_error("2D not supported for wide (i.e., S3D) stencil")
+             else
+                call s3d_diffterm_1_3d(lo,hi,dx,qp,qlo(1:3),qhi(1:3),  &
+                     fp,flo(1:3),fhi(1:3),    &
+                     qxp,qxlo(1:3),qxhi(1:3), &
+                     qyp,qylo(1:3),qyhi(1:3), &
+                     qzp,qzlo(1:3),qzhi(1:3), &
+                     mup,xip,dlo,dhi,blo,bhi)
+             end if
           end do
           !$omp end parallel
 
@@ -1024,10 +1174,11 @@ contains
              end if
           end if
 
-          !$omp parallel private(n,iblock,lo,hi,up,ulo,uhi,upp,uplo,uphi,qp,qlo,qhi) &
+          call tb_sched_begin()
+          !$omp parallel private(n,itask,lo,hi,up,ulo,uhi,upp,uplo,uphi,qp,qlo,qhi) &
           !$omp private(dlo,dhi,blo,bhi)
-          do n=1,nfabs(Q)
-             if (.not.tb_worktodo(n)) cycle
+          do while (tb_sched_next(itask))
+             n = tb_get_task_box(itask)
 
              up => dataptr(U,n)
              upp=> dataptr(Uprime,n)
@@ -1043,21 +1194,19 @@ contains
              call get_data_lo_hi(n,dlo,dhi)
              call get_boxbc(n,blo,bhi)
 
-             do iblock = 1, tb_get_nblocks(n)
-                lo = tb_get_block_lo(iblock,n)
-                hi = tb_get_block_hi(iblock,n)
-
-                if (dm .eq. 1) then
-                   call hypterm_1d(lo,hi,dx,up,ulo(1:1),uhi(1:1),qp,qlo(1:1),qhi(1:1),&
-                        upp,uplo(1:1),uphi(1:1),dlo,dhi,blo,bhi)
-                else if (dm .eq. 2) then
-                   call hypterm_2d(lo,hi,dx,up,ulo(1:2),uhi(1:2),qp,qlo(1:2),qhi(1:2),&
-                        upp,uplo(1:2),uphi(1:2),dlo,dhi,blo,bhi)
-                else
-                   call hypterm_3d(lo,hi,dx,up,ulo(1:3),uhi(1:3),qp,qlo(1:3),qhi(1:3),&
-                        upp,uplo(1:3),uphi(1:3),dlo,dhi,blo,bhi)
-                end if
-             end do
+             lo = tb_get_task_lo(itask)
+             hi = tb_get_task_hi(itask)
+
+             if (dm .eq. 1) then
+                call hypterm_1d(lo,hi,dx,up,ulo(1:1),uhi(1:1),qp,qlo(1:1),qhi(1:1),&
+                     upp,uplo(1:1),uphi(1:1),dlo,dhi,blo,bhi)
+             else if (dm .eq. 2) then
+                call hypterm_2d(lo,hi,dx,up,ulo(1:2),uhi(1:2),qp,qlo(1:2),qhi(1:2),&
+                     upp,uplo(1:2),uphi(1:2),dlo,dhi,blo,bhi)
+             else
+                call hypterm_3d(lo,hi,dx,up,ulo(1:3),uhi(1:3),qp,qlo(1:3),qhi(1:3),&
+                     upp,uplo(1:3),uphi(1:3),dlo,dhi,blo,bhi)
+             end if
           end do
           !$omp end parallel
 
@@ -1071,11 +1220,12 @@ contains
              end if
           end if
 
-          !$omp parallel private(n,iblock,lo,hi,upp,uplo,uphi,qp,qlo,qhi) &
+          call tb_sched_begin()
+          !$omp parallel private(n,itask,lo,hi,upp,uplo,uphi,qp,qlo,qhi) &
           !$omp private(qxp,qxlo,qxhi,qyp,qylo,qyhi,qzp,qzlo,qzhi) &
           !$omp private(fp,flo,fhi,mup,xip,lamp,Ddp,dlo,dhi,blo,bhi)
-          do n=1,nfabs(Q)
-             if (.not.tb_worktodo(n)) cycle
+          do while (tb_sched_next(itask))
+             n = tb_get_task_box(itask)
 
              qp  => dataptr(Q , n)
              qxp => dataptr(qx, n)
@@ -1111,42 +1261,43 @@ contains
              call get_data_lo_hi(n,dlo,dhi)
              call get_boxbc(n,blo,bhi)
 
-             do iblock = 1, tb_get_nblocks(n)
-                lo = tb_get_block_lo(iblock,n)
-                hi = tb_get_block_hi(iblock,n)
-
-                if (dm .eq. 1) then
-                   call bl_error("1D not supported for wide (i.e., S3D) stencil")
-                else if (dm .eq. 2) then
-                   call bl_error("2D not supported for wide (i.e., S3D) stencil")
-                else
-                   call s3d_diffterm_2_3d(lo,hi,dx,qp,qlo(1:3),qhi(1:3),  &
-                        upp,uplo(1:3),uphi(1:3), fp,flo(1:3),fhi(1:3),    &
-                        qxp,qxlo(1:3),qxhi(1:3), &
-                        qyp,qylo(1:3),qyhi(1:3), &
-                        qzp,qzlo(1:3),qzhi(1:3), &
-                        mup,xip,lamp, Ddp, &
-                        dlo,dhi,blo,bhi)
-                end if
-             end do
+             lo = tb_get_task_lo(itask)
+             hi = tb_get_task_hi(itask)
+
+             if (dm .eq. 1) then
+                call bl_error("1D not supported for wide (i.e., S3D) stencil")
+             else if (dm .eq. 2) then
+                call bl_error("2D not supported for wide (i.e., S3D) stencil")
+             else
+                call s3d_diffterm_2_3d(lo,hi,dx,qp,qlo(1:3),qhi(1:3),  &
+                     upp,uplo(1:3),uphi(1:3), fp,flo(1:3),fhi(1:3),    &
+                     qxp,qxlo(1:3),qxhi(1:3), &
+                     qyp,qylo(1:3),qyhi(1:3), &
+                     qzp,qzlo(1:3),qzhi(1:3), &
+                     mup,xip,lamp, Ddp, &
+                     dlo,dhi,blo,bhi)
+             end if
           end do
           !$omp end parallel
 
        else
           call bl_error("dUdt: unknown stencil type")
        end if
+       dUdt_wtime(wt_hypdiffterm) = dUdt_wtime(wt_hypdiffterm) + (parallel_wtime() - wt)
        call destroy(bpt_hypdiffterm)                !! ^^^^^^^^^^^^^^^^^^^^^^^ timer
 
        !
        ! NSCBC boundary
        !
        call build(bpt_nscbc, "nscbc")   !! vvvvvvvvvvvvvvvvvvvvvvv timer
+       wt = parallel_wtime()
        if (present(Uprime_c)) then
           call nscbc(Q, U, Fdif, Uprime_c, Uprime, t, dx, update_mach)
        else
           call nscbc(Q, U, Fdif, Upchem  , Uprime, t, dx, update_mach)
        end if
        if (update_mach) mach_computed = .true.
+       dUdt_wtime(wt_nscbc) = dUdt_wtime(wt_nscbc) + (parallel_wtime() - wt)
        call destroy(bpt_nscbc)          !! ^^^^^^^^^^^^^^^^^^^^^^^ timer
 
     end if
@@ -1154,6 +1305,241 @@ contains
   end subroutine dUdt
 
 
+  !
+  ! Evaluate dU/dt once outside of a time step, for smc_tune.
+  ! Transport properties and Mach numbers are always recomputed, and the
+  ! feval counters are left alone.
+  !
+  subroutine dUdt_tune(U, Uprime, dx, include_ad, include_r)
+    type(multifab),   intent(inout) :: U, Uprime
+    double precision, intent(in   ) :: dx(3)
+    logical,          intent(in   ) :: include_ad, include_r
+
+    integer :: cad, cr
+
+    cad = count_ad
+    cr  = count_r
+
+    istep_this = istep_first
+    trans_called = .false.
+    Mach_computed = .false.
+    dt = 1.d-10
+
+    if (state_ng .eq. stencil_ng) then
+       call dUdt(U, Uprime, 0.d0, dt, dx, include_ad=include_ad, include_r=include_r)
+    else
+       ! deep-halo mode: exchange only what one stage needs
+       call multifab_fill_boundary(U, ng=stencil_ng)
+       call dUdt(U, Uprime, 0.d0, dt, dx, include_ad=include_ad, include_r=include_r, &
+            ng_halo=0)
+    end if
+
+    count_ad = cad
+    count_r  = cr
+  end subroutine dUdt_tune
+
+
+  !
+  ! Choose rk_halo_k, the number of RK stages per ghost cell exchange in
+  ! the deep-halo mode.  With rk_halo_stages = 0, the exchange of
+  ! k*stencil_ng ghost cells (t_x(k)) and one evaluation of dU/dt (t_c)
+  ! are timed, and k minimizes the modeled time per stage
+  !
+  !   ( t_x(k) + t_c * sum_{s=1..k} V((k-s)*stencil_ng) / V(0) ) / k,
+  !
+  ! where V(g) is the number of cells in the local boxes grown by g.
+  ! Small boxes and a slow network favor large k.
+  !
+  subroutine rk_halo_setup(U, dx)
+    use probin_module, only : rk_halo_stages, rk_order, verbose
+    use smcdata_module, only : Uprime
+
+    type(multifab),   intent(inout) :: U
+    double precision, intent(in   ) :: dx(3)
+
+    integer, parameter :: nrep = 3
+    integer :: nstages, kmax, k, s, n, irep
+    double precision :: t0, wt, tc, vloc, v0, cost, best
+    double precision, allocatable :: tx(:), vr(:)
+
+    rk_halo_k = 1
+    if (state_ng .eq. stencil_ng) return
+
+    if (rk_order == 3) then
+       nstages = 3
+    else
+       nstages = 6
+    end if
+
+    kmax = min(state_ng/stencil_ng, nstages)
+
+    if (rk_halo_stages .gt. 1) then
+       rk_halo_k = kmax
+    else
+       allocate(tx(kmax), vr(0:kmax-1))
+
+       ! V(g)/V(0), the largest over all ranks
+       do s = 0, kmax-1
+          vloc = 0.d0
+          do n = 1, nfabs(U)
+             vloc = vloc + product(dble(box_extent(get_box(U,n)) + 2*s*stencil_ng))
+          end do
+          if (s .eq. 0) v0 = vloc
+          ! a rank without boxes does not constrain the maximum
+          if (v0 .gt. 0.d0) then
+             vloc = vloc/v0
+          else
+             vloc = 0.d0
+          end if
+          call parallel_reduce(vr(s), vloc, MPI_MAX)
+       end do
+
+       do k = 1, kmax
+          call multifab_fill_boundary(U, ng=k*stencil_ng)
+          call parallel_barrier()
+          t0 = parallel_wtime()
+          do irep = 1, nrep
+             call multifab_fill_boundary(U, ng=k*stencil_ng)
+          end do
+          wt = (parallel_wtime() - t0) / nrep
+          call parallel_reduce(tx(k), wt, MPI_MAX)
+       end do
+
+       call dUdt_tune(U, Uprime, dx, .true., .true.)
+       call parallel_barrier()
+       t0 = parallel_wtime()
+       do irep = 1, nrep
+          call dUdt_tune(U, Uprime, dx, .true., .true.)
+       end do
+       wt = (parallel_wtime() - t0) / nrep
+       call parallel_reduce(tc, wt, MPI_MAX)
+       tc = max(tc - tx(1), 0.d0)
+
+       best = huge(1.d0)
+       do k = 1, kmax
+          cost = tx(k)
+          do s = 1, k
+             cost = cost + tc * vr(k-s)
+          end do
+          cost = cost / k
+          if (verbose .ge. 1 .and. parallel_IOProcessor()) then
+             write(*,'(A,I2,A,ES10.3,A,ES10.3)') ' rk_halo: k =', k, &
+                  '  exchange time', tx(k), '  modeled time per stage', cost
+          end if
+          if (cost .lt. best*0.99d0) then
+             best = cost
+             rk_halo_k = k
+          end if
+       end do
+
+       deallocate(tx, vr)
+    end if
+
+    if (parallel_IOProcessor()) then
+       print *, 'Deep-halo RK: ', rk_halo_k, 'stages per ghost cell exchange'
+    end if
+
+  end subroutine rk_halo_setup
+
+
+  !
+  ! Print the wall clock time each rank has spent in the pieces of dUdt
+  ! since dUdt_wtime was last reset, with the number of cells the rank
+  ! owns on inflow and outflow faces.  With verbose < 2 only the
+  ! spread over the ranks is printed.
+  !
+  subroutine dUdt_rank_report(U)
+    use probin_module, only : verbose
+
+    type(multifab), intent(in) :: U
+
+    integer, parameter :: nt = nwt_dUdt+1
+    character(len=11), parameter :: names(nt) = [ &
+         "ctoprim    ", "gettrans   ", "hypdiffterm", "chemterm   ", "nscbc      ", &
+         "dUdt       " ]
+    integer :: np, me, n, i, ip, imax
+    double precision, allocatable :: tloc(:), tall(:)
+    integer, allocatable :: nloc(:), nall(:)
+    type(box) :: pd
+
+    np = parallel_nprocs()
+    me = parallel_myproc()
+
+    ! rank ip's entries are at ip*nt+1:(ip+1)*nt and 2*ip+1:2*ip+2
+    allocate(tloc(nt*np), tall(nt*np), nloc(2*np), nall(2*np))
+    tloc = 0.d0
+    nloc = 0
+
+    tloc(me*nt+1:me*nt+nwt_dUdt) = dUdt_wtime
+    tloc(me*nt+nt) = sum(dUdt_wtime)
+
+    pd = get_pd(get_layout(U))
+    do n=1,nfabs(U)
+       nloc(2*me+1) = nloc(2*me+1) + volume(get_box(U,n))
+       nloc(2*me+2) = nloc(2*me+2) + nscbc_face_cells(get_box(U,n), pd)
+    end do
+
+    call parallel_reduce(tall, tloc, MPI_SUM)
+    call parallel_reduce(nall, nloc, MPI_SUM)
+
+    if (parallel_IOProcessor()) then
+       print *, ' '
+       print *, 'dUdt wall clock time per rank (seconds):'
+       write(*,'(A11,3A12,A8)') 'piece', 'min', 'avg', 'max', 'rank'
+       do i = 1, nt
+          imax = maxloc(tall(i::nt),1)
+          write(*,'(A11,3ES12.4,I8)') names(i), minval(tall(i::nt)), sum(tall(i::nt))/np, &
+               tall((imax-1)*nt+i), imax-1
+       end do
+       if (verbose .ge. 2) then
+          write(*,'(A6,2A12,*(A12))') 'rank', 'cells', 'nscbc cells', names
+          do ip = 0, np-1
+             write(*,'(I6,2I12,*(ES12.4))') ip, nall(2*ip+1:2*ip+2), tall(ip*nt+1:ip*nt+nt)
+          end do
+       end if
+       print *, ' '
+    end if
+
+    deallocate(tloc, tall, nloc, nall)
+
+  end subroutine dUdt_rank_report
+
+
+  !
+  ! max_k |dY_k/dt| due to reactions in box n, from the reaction term in
+  ! Upchem; used by the stiffness test of sdc_adaptive
+  !
+  function reaction_activity(Q, Upchem, n) result(r)
+    type(multifab), intent(in) :: Q, Upchem
+    integer,        intent(in) :: n
+    double precision :: r
+
+    integer :: i, j, k, m, lo(3), hi(3)
+    double precision, pointer, dimension(:,:,:,:) :: qp, upcp
+
+    qp   => dataptr(Q,n)
+    upcp => dataptr(Upchem,n)
+
+    lo = 1
+    hi = 1
+    lo(1:Q%dim) = lwb(get_box(Q,n))
+    hi(1:Q%dim) = upb(get_box(Q,n))
+
+    r = 0.d0
+    !$omp parallel do private(i,j,k,m) reduction(max:r) collapse(2)
+    do m = 1, nspecies
+       do k = lo(3),hi(3)
+          do j = lo(2),hi(2)
+             do i = lo(1),hi(1)
+                r = max(r, abs(upcp(i,j,k,iry1+m-1)) / qp(i,j,k,qrho))
+             end do
+          end do
+       end do
+    end do
+    !$omp end parallel do
+  end function reaction_activity
+
+
   subroutine compute_courno(Q, dx, courno)
     type(multifab), intent(in) :: Q
     double precision, intent(in) :: dx(3)
@@ -7,6 +7,10 @@ module derivative_stencil_module
   integer, parameter :: narrow=1, wide=2, S3D=2
   integer, save :: stencil, stencil_ng
 
+  ! ghost cells of the state: stencil_ng, or a multiple of it for the
+  ! deep-halo mode of the RK integrators (rk_halo_stages)
+  integer, save :: state_ng
+
   ! for 8th-order first derivatives
   double precision,dimension(4),parameter :: D8 = (/ 0.8d0, -0.2d0, 4.d0/105.d0, -1.d0/280.d0 /)
 
@@ -66,7 +70,8 @@ contains
   subroutine stencil_init
 
     use bl_error_module
-    use probin_module, only : stencil_type
+    use probin_module, only : stencil_type, method, SMC_ADVANCE_RK, &
+         rk_halo_stages, rk_halo_max, dm_in, pmask
 
     integer :: i, j
 
@@ -80,6 +85,19 @@ contains
 
     stencil_ng = 4
 
+    state_ng = stencil_ng
+    if (method == SMC_ADVANCE_RK .and. rk_halo_stages .ne. 1) then
+       if (stencil .ne. narrow .or. .not.all(pmask(1:dm_in))) then
+          if (rk_halo_stages .gt. 1) then
+             call bl_error("rk_halo_stages > 1 requires narrow stencil and periodic boundaries")
+          end if
+       else if (rk_halo_stages .gt. 1) then
+          state_ng = rk_halo_stages * stencil_ng
+       else if (rk_halo_max .gt. 1) then
+          state_ng = rk_halo_max * stencil_ng
+       end if
+    end if
+
     ! 8th-order
     M8(1,1) = 5.d0/336.d0 + M8_48
     M8(2,1) = -11.d0/560.d0 - 2.d0*M8_48
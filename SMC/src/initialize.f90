@@ -20,8 +20,9 @@ contains
     use checkpoint_module, only : checkpoint_read
     use probin_module, only: n_cellx, n_celly, n_cellz, prob_lo, prob_hi, &
          bcx_lo, bcy_lo, bcz_lo, bcx_hi, bcy_hi, bcz_hi, &
-         dm_in, max_grid_size, change_max_grid_size, pmask, t_trylayout, overlap_testing
-    use derivative_stencil_module, only : stencil_ng
+         dm_in, max_grid_size, change_max_grid_size, pmask, t_trylayout, overlap_testing, &
+         nscbc_weight
+    use derivative_stencil_module, only : state_ng
 
     character(len=*), intent(in) :: dirname
     type(layout),intent(inout) :: la
@@ -91,7 +92,7 @@ contains
     dx(2) = (prob_hi(2)-prob_lo(2)) / n_celly
     dx(3) = (prob_hi(3)-prob_lo(3)) / n_cellz
 
-    ng = stencil_ng
+    ng = state_ng
 
     bachk = get_boxarray(chkdata(1))
 
@@ -109,6 +110,10 @@ contains
 
     call layout_build_ba(la,ba,boxarray_bbox(ba),pmask=pmask(1:dm))
 
+    if (parallel_nprocs() > 1 .and. nscbc_weight > 0.d0) then
+       call build_nscbc_weighted_layout(la,ba,boxarray_bbox(ba),pmask(1:dm))
+    end if
+
     call build_threadbox(la,ng)
 
     call multifab_build(U,la,ncons,ng)
@@ -203,8 +208,8 @@ contains
     use time_module, only : time
 
     use probin_module, only: n_cellx, n_celly, n_cellz, prob_lo, prob_hi, dm_in, &
-         max_grid_size, pmask, t_trylayout, overlap_testing
-    use derivative_stencil_module, only : stencil_ng
+         max_grid_size, pmask, t_trylayout, overlap_testing, nscbc_weight
+    use derivative_stencil_module, only : state_ng
 
     type(layout),intent(inout) :: la
     real(dp_t), intent(out) :: dt,courno
@@ -230,7 +235,7 @@ contains
     dx(2) = (prob_hi(2)-prob_lo(2)) / n_celly
     dx(3) = (prob_hi(3)-prob_lo(3)) / n_cellz
 
-    ng = stencil_ng
+    ng = state_ng
 
     bx = make_box(lo(1:dm),hi(1:dm))
     
@@ -238,6 +243,10 @@ contains
     call boxarray_maxsize(ba,max_grid_size)
     call layout_build_ba(la,ba,boxarray_bbox(ba),pmask=pmask(1:dm))
 
+    if (parallel_nprocs() > 1 .and. nscbc_weight > 0.d0) then
+       call build_nscbc_weighted_layout(la,ba,boxarray_bbox(ba),pmask(1:dm))
+    end if
+
     call build_threadbox(la,ng)
 
     call multifab_build(U,la,ncons,ng)
@@ -265,6 +274,55 @@ contains
   end subroutine initialize_from_scratch
 
 
+  !
+  ! Rebuild la with boxes distributed by the knapsack algorithm, where a
+  ! box weighs its cell count plus nscbc_weight times its number of cells
+  ! on inflow and outflow faces.
+  !
+  subroutine build_nscbc_weighted_layout(la, ba, pd, pmask)
+    use probin_module, only : verbose, nscbc_weight, t_trylayout
+    use knapsack_module, only : knapsack_i
+    type(layout), intent(inout) :: la
+    type(boxarray), intent(in) :: ba
+    type(box), intent(in) :: pd
+    logical, intent(in) :: pmask(:)
+
+    integer :: i, nb, nfc, nbnscbc
+    integer, allocatable :: wgt(:), prc(:)
+    type(box) :: bx
+
+    ! build_better_layout shuffles the boxes over the ranks without the
+    ! weights and would undo this layout
+    if (t_trylayout > 0.d0) then
+       call bl_error("nscbc_weight > 0 and t_trylayout > 0 are mutually exclusive")
+    end if
+
+    nb = nboxes(ba)
+    allocate(wgt(nb), prc(nb))
+
+    nbnscbc = 0
+    do i=1,nb
+       bx = get_box(ba,i)
+       nfc = nscbc_face_cells(bx, pd)
+       wgt(i) = volume(bx) + nint(nscbc_weight*nfc)
+       if (nfc > 0) nbnscbc = nbnscbc + 1
+    end do
+
+    call knapsack_i(prc, wgt, parallel_nprocs(), verbose=(verbose > 1))
+
+    call destroy(la)
+    call layout_build_ba(la, ba, pd, pmask=pmask, &
+         mapping = LA_EXPLICIT, explicit_mapping = prc)
+
+    if (verbose > 0 .and. parallel_IOProcessor()) then
+       print *, 'NSCBC-weighted layout:', nbnscbc, 'of', nb, 'boxes on inflow/outflow faces'
+    end if
+
+    deallocate(wgt, prc)
+
+  end subroutine build_nscbc_weighted_layout
+
+
   subroutine build_better_layout(U, la, ba, pd, pmask, nc, ng, ttry)
     use probin_module, only : verbose, overlap_comm_comp, overlap_in_trial
     use advance_module, only : overlapped_part
@@ -34,7 +34,8 @@ module nscbc_module
   private
 
   public :: nscbc, nscbc_init, nscbc_build_registers, nscbc_init_inlet_reg_from_scratch, &
-       nscbc_close, impose_hard_bc, qin_xlo, qin_xhi, qin_ylo, qin_yhi, qin_zlo, qin_zhi
+       nscbc_close, impose_hard_bc, qin_xlo, qin_xhi, qin_ylo, qin_yhi, qin_zlo, qin_zhi, &
+       nscbc_face_cells
 
 contains
 
@@ -178,6 +179,40 @@ contains
   end subroutine nscbc_init_inlet_reg_from_scratch
 
 
+  !
+  ! Number of cells of box bx on the inflow and outflow faces of the
+  ! problem domain pd, i.e., the cells nscbc works on.  Cells on edges
+  ! and corners are counted once per face.
+  !
+  function nscbc_face_cells(bx, pd) result(nfc)
+    type(box), intent(in) :: bx, pd
+    integer :: nfc
+
+    integer :: idim, nd, area, bclo(3), bchi(3)
+    integer :: lo(bx%dim), hi(bx%dim), plo(bx%dim), phi(bx%dim)
+
+    bclo = (/ bcx_lo, bcy_lo, bcz_lo /)
+    bchi = (/ bcx_hi, bcy_hi, bcz_hi /)
+
+    nd = bx%dim
+    lo = lwb(bx)
+    hi = upb(bx)
+    plo = lwb(pd)
+    phi = upb(pd)
+
+    nfc = 0
+    do idim=1,nd
+       area = volume(bx) / (hi(idim)-lo(idim)+1)
+       if (lo(idim).eq.plo(idim) .and. (bclo(idim).eq.INLET .or. bclo(idim).eq.OUTLET)) then
+          nfc = nfc + area
+       end if
+       if (hi(idim).eq.phi(idim) .and. (bchi(idim).eq.INLET .or. bchi(idim).eq.OUTLET)) then
+          nfc = nfc + area
+       end if
+    end do
+  end function nscbc_face_cells
+
+
   subroutine nscbc_close()
     if (aux_xlo%nc .gt. 0) then
        call physbndry_reg_destroy(aux_xlo)
@@ -18,6 +18,7 @@ subroutine smc()
   use smc_bc_module
   use smcdata_module
   use smc_threadbox_module
+  use smc_tune_module
   use time_module
   use tranlib_module
   use variables_module
@@ -186,6 +187,15 @@ subroutine smc()
      end if
   end if
 
+  if (t_tune > 0.d0) then
+     call smc_tune(la, U, dx)
+  end if
+
+  if (method == SMC_ADVANCE_RK) then
+     call rk_halo_setup(U, dx)
+  end if
+
+  dUdt_wtime = 0.d0
   wt1 = parallel_wtime()
 
 
@@ -447,6 +457,10 @@ subroutine smc()
 
   wt2 = parallel_wtime()
 
+  if (verbose .ge. 1) then
+     call dUdt_rank_report(U)
+  end if
+
 
   !
   ! shutdown
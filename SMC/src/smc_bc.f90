@@ -24,7 +24,7 @@ contains
     type(layout), intent(in) :: la
     type(multifab), intent(in) :: U
 
-    integer :: ndm, nlbx, i, j, bclo(3), bchi(3)
+    integer :: ndm, nlbx, i, j, bclo(3), bchi(3), ngu
     integer ::  lo(la%lap%dim),  hi(la%lap%dim)
     integer :: plo(la%lap%dim), phi(la%lap%dim)
     type(box) :: pd, bx
@@ -60,6 +60,7 @@ contains
     end do
 
     nlbx = nfabs(U)
+    ngu = nghost(U)
 
     allocate(boxbclo(ndm,nlbx))
     allocate(boxbchi(ndm,nlbx))
@@ -90,13 +91,13 @@ contains
           end if
 
           if (boxbclo(i,j) .eq. PERIODIC .or. boxbclo(i,j) .eq. INTERIOR) then
-             datalo(i,j) = lo(i) - stencil_ng
+             datalo(i,j) = lo(i) - ngu
           else
              datalo(i,j) = lo(i)
           end if
 
           if (boxbchi(i,j) .eq. PERIODIC .or. boxbchi(i,j) .eq. INTERIOR) then
-             datahi(i,j) = hi(i) + stencil_ng
+             datahi(i,j) = hi(i) + ngu
           else
              datahi(i,j) = hi(i)
            end if
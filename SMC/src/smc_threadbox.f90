@@ -26,12 +26,31 @@ module smc_threadbox_module
 
   !$omp threadprivate(worktodo,tb_lo,tb_hi,tb_glo,tb_ghi,allblocks)
 
+  !
+  ! Block scheduler.  All blocks of all local boxes form one task list.
+  ! The tasks of thread i are q_first(i):q_last(i), in the same order as
+  ! the static loops over boxes and blocks.  Owners take tasks from the
+  ! front (q_head); with tb_dynamic, idle threads steal from the back
+  ! (q_tail) of other queues.  task_claim makes sure each task is done
+  ! by exactly one thread when the two ends meet.  Ownership never
+  ! changes, so a block goes back to the same thread in every stage.
+  !
+  integer, save :: ntasks = 0
+  integer, allocatable, save :: task_box(:), task_lo(:,:), task_hi(:,:), task_claim(:)
+  integer, allocatable, save :: q_first(:), q_last(:), q_head(:), q_tail(:)
+
+  ! valid boxes of the local boxes, shared by all threads
+  integer, allocatable, save :: bx_lo(:,:), bx_hi(:,:)
+
   private
 
   public ::build_threadbox, destroy_threadbox,  &
        tb_get_valid_lo, tb_get_valid_hi, tb_get_grown_lo, tb_get_grown_hi, &
        tb_get_block_lo, tb_get_block_hi, tb_get_nblocks, &
-       tb_multifab_setval, tb_worktodo
+       tb_multifab_setval, tb_worktodo, &
+       tb_sched_begin, tb_sched_next, tb_get_task_box, tb_get_task_lo, tb_get_task_hi, &
+       tb_get_halo_lo, tb_get_halo_hi, tb_get_task_halo_lo, tb_get_task_halo_hi, &
+       tb_get_max_task_width, tb_config_ok
 
 contains
 
@@ -55,6 +74,17 @@ contains
     if (allocated(tb_ghi)) deallocate(tb_ghi)
     if (allocated(worktodo)) deallocate(worktodo)
     !$omp end parallel
+    if (allocated(task_box)) deallocate(task_box)
+    if (allocated(task_lo)) deallocate(task_lo)
+    if (allocated(task_hi)) deallocate(task_hi)
+    if (allocated(task_claim)) deallocate(task_claim)
+    if (allocated(q_first)) deallocate(q_first)
+    if (allocated(q_last)) deallocate(q_last)
+    if (allocated(q_head)) deallocate(q_head)
+    if (allocated(q_tail)) deallocate(q_tail)
+    if (allocated(bx_lo)) deallocate(bx_lo)
+    if (allocated(bx_hi)) deallocate(bx_hi)
+    ntasks = 0
   end subroutine destroy_threadbox
 
   subroutine build_threadbox(la, ng_in)
@@ -64,6 +94,9 @@ contains
     type(layout), intent(in) :: la
     integer, intent(in) :: ng_in
 
+    integer :: ibox
+    type(box) :: bx
+
     call destroy_threadbox()
 
     if (nboxes(la) < parallel_nprocs()) then
@@ -95,6 +128,14 @@ contains
        call bl_error("smc_threadbox_module: invalid tb_split_dim")
     end if
 
+    allocate(bx_lo(ndim,nb))
+    allocate(bx_hi(ndim,nb))
+    do ibox=1,nb
+       bx = get_box(la, global_index(la, ibox))
+       bx_lo(:,ibox) = box_lwb(bx)
+       bx_hi(:,ibox) = box_upb(bx)
+    end do
+
     !$omp parallel
 
     allocate(tb_lo (ndim,nb))
@@ -123,6 +164,8 @@ contains
 
     call init_allblocks(tb_blocksize_x,tb_blocksize_y,tb_blocksize_z)
 
+    call init_tasks()
+
     !$omp end parallel
 
   end subroutine build_threadbox
@@ -570,6 +613,256 @@ contains
   end function tb_get_block_hi
 
 
+  ! Gather the blocks of every thread into the shared task list.  The
+  ! owner of a task is the thread whose threadbox contains it, i.e., the
+  ! thread that first touched its data in tb_multifab_setval.
+  subroutine init_tasks()
+    implicit none
+    integer :: tid, ibox, ibk, it, i
+
+    tid = omp_get_thread_num()
+
+    !$omp single
+    allocate(q_first(0:numthreads-1))
+    allocate(q_last (0:numthreads-1))
+    allocate(q_head (0:numthreads-1))
+    allocate(q_tail (0:numthreads-1))
+    !$omp end single
+
+    it = 0
+    do ibox=1,nb
+       it = it + allblocks(ibox)%nblocks
+    end do
+    q_last(tid) = it
+    !$omp barrier
+
+    !$omp single
+    ntasks = 0
+    do i=0,numthreads-1
+       q_first(i) = ntasks + 1
+       ntasks = ntasks + q_last(i)
+       q_last(i) = ntasks
+    end do
+    allocate(task_box(ntasks))
+    allocate(task_lo(ndim,ntasks))
+    allocate(task_hi(ndim,ntasks))
+    allocate(task_claim(ntasks))
+    !$omp end single
+
+    it = q_first(tid)
+    do ibox=1,nb
+       do ibk=1,allblocks(ibox)%nblocks
+          task_box(it) = ibox
+          task_lo(:,it) = allblocks(ibox)%lo(:,ibk)
+          task_hi(:,it) = allblocks(ibox)%hi(:,ibk)
+          it = it + 1
+       end do
+    end do
+
+  end subroutine init_tasks
+
+
+  ! Reset the queues.  Call outside OMP PARALLEL before each loop
+  ! driven by tb_sched_next.
+  subroutine tb_sched_begin()
+    implicit none
+    q_head = q_first
+    q_tail = q_last
+    task_claim = 0
+  end subroutine tb_sched_begin
+
+
+  ! Call inside OMP PARALLEL: do while (tb_sched_next(itask)) ...
+  ! Returns .false. when there is nothing left for this thread.
+  function tb_sched_next(itask) result(r)
+    use probin_module, only : tb_dynamic
+    implicit none
+    integer, intent(out) :: itask
+    logical :: r
+
+    integer :: tid, i, d, v
+
+    tid = omp_get_thread_num()
+    r = .true.
+
+    !$omp atomic capture
+    i = q_head(tid)
+    q_head(tid) = q_head(tid) + 1
+    !$omp end atomic
+
+    if (i .le. q_last(tid)) then
+       if (claim_task(i)) then
+          itask = i
+          return
+       end if
+    end if
+
+    if (tb_dynamic) then
+       ! Try neighboring threads first; with compact thread binding
+       ! they are likely on the same socket.
+       do d = 1, numthreads-1
+          if (mod(d,2) .eq. 1) then
+             v = modulo(tid + (d+1)/2, numthreads)
+          else
+             v = modulo(tid - d/2, numthreads)
+          end if
+
+          !$omp atomic capture
+          i = q_tail(v)
+          q_tail(v) = q_tail(v) - 1
+          !$omp end atomic
+
+          if (i .ge. q_first(v)) then
+             if (claim_task(i)) then
+                itask = i
+                return
+             end if
+          end if
+       end do
+    end if
+
+    itask = 0
+    r = .false.
+
+  end function tb_sched_next
+
+  function claim_task(i) result(r)
+    implicit none
+    integer, intent(in) :: i
+    logical :: r
+    integer :: c
+    !$omp atomic capture
+    c = task_claim(i)
+    task_claim(i) = task_claim(i) + 1
+    !$omp end atomic
+    r = c .eq. 0
+  end function claim_task
+
+  function tb_get_task_box(itask) result(ilocal)
+    implicit none
+    integer, intent(in) :: itask
+    integer :: ilocal
+    ilocal = task_box(itask)
+  end function tb_get_task_box
+
+  function tb_get_task_lo(itask) result(lo)
+    implicit none
+    integer, intent(in) :: itask
+    integer, dimension(ndim) :: lo
+    lo = task_lo(:,itask)
+  end function tb_get_task_lo
+
+  function tb_get_task_hi(itask) result(hi)
+    implicit none
+    integer, intent(in) :: itask
+    integer, dimension(ndim) :: hi
+    hi = task_hi(:,itask)
+  end function tb_get_task_hi
+
+
+  ! The valid region of a threadbox or task, extended by g ghost cells
+  ! on the sides where it touches the boundary of its box.  Over all
+  ! threads (or tasks) of a box, these regions tile the box grown by g
+  ! without overlap.  g must not exceed the ghost cells of the data.
+  function tb_get_halo_lo(ilocal, g) result (lo)
+    implicit none
+    integer, intent(in) :: ilocal, g
+    integer, dimension(ndim) :: lo
+    lo = tb_lo(:,ilocal)
+    where (lo .eq. bx_lo(:,ilocal)) lo = lo - g
+  end function tb_get_halo_lo
+
+  function tb_get_halo_hi(ilocal, g) result (hi)
+    implicit none
+    integer, intent(in) :: ilocal, g
+    integer, dimension(ndim) :: hi
+    hi = tb_hi(:,ilocal)
+    where (hi .eq. bx_hi(:,ilocal)) hi = hi + g
+  end function tb_get_halo_hi
+
+  function tb_get_task_halo_lo(itask, g) result(lo)
+    implicit none
+    integer, intent(in) :: itask, g
+    integer, dimension(ndim) :: lo
+    lo = task_lo(:,itask)
+    where (lo .eq. bx_lo(:,task_box(itask))) lo = lo - g
+  end function tb_get_task_halo_lo
+
+  function tb_get_task_halo_hi(itask, g) result(hi)
+    implicit none
+    integer, intent(in) :: itask, g
+    integer, dimension(ndim) :: hi
+    hi = task_hi(:,itask)
+    where (hi .eq. bx_hi(:,task_box(itask))) hi = hi + g
+  end function tb_get_task_halo_hi
+
+  ! The largest x-extent of any task of this rank, extended by g as in
+  ! tb_get_task_halo_lo/hi.
+  function tb_get_max_task_width(g) result(w)
+    implicit none
+    integer, intent(in) :: g
+    integer :: w, it, lo(ndim), hi(ndim)
+    w = 0
+    do it=1,ntasks
+       lo = tb_get_task_halo_lo(it, g)
+       hi = tb_get_task_halo_hi(it, g)
+       w = max(w, hi(1)-lo(1)+1)
+    end do
+  end function tb_get_max_task_width
+
+
+  ! Would build_threadbox accept this decomposition of la?  Same checks
+  ! as build_threadbox and check_boxsize, but without bl_error, so that
+  ! smc_tune can skip a bad candidate.  Call outside OMP PARALLEL.
+  function tb_config_ok(la, split_dim, collapse, imore, iless) result(r)
+    implicit none
+    type(layout), intent(in) :: la
+    integer, intent(in) :: split_dim, imore, iless
+    logical, intent(in) :: collapse
+    logical :: r
+
+    integer :: dm, nloc, nthr, ngroup, a, b, c, ilocal, n3d(3)
+    logical :: rlocal
+    type(box) :: bx
+
+    dm = la%lap%dim
+    nloc = nlocal(la)
+    nthr = omp_get_max_threads()
+
+    if (dm .eq. 1) then
+       rlocal = split_dim.eq.1 .and. imore.eq.1 .and. iless.eq.1
+    else
+       rlocal = split_dim.ge.1 .and. split_dim.le.dm .and. imore.ne.iless &
+            .and. imore.ge.1 .and. imore.le.dm .and. iless.ge.1 .and. iless.le.dm
+    end if
+    rlocal = rlocal .and. nloc .gt. 0
+
+    if (rlocal) then
+       ngroup = 1
+       if (collapse) then
+          a = nloc
+          b = nthr
+          do while (b .ne. 0)
+             c = mod(a,b)
+             a = b
+             b = c
+          end do
+          ngroup = a
+       end if
+
+       call init_thread_topology(nthr/ngroup, n3d, split_dim, imore, iless)
+
+       do ilocal = 1, nloc
+          bx = get_box(la, global_index(la, ilocal))
+          if (any(box_extent(bx) < n3d(1:dm))) rlocal = .false.
+       end do
+    end if
+
+    call parallel_reduce(r, rlocal, MPI_LAND)
+
+  end function tb_config_ok
+
+
   subroutine tb_multifab_setval(mf, val, all)
     type(multifab), intent(inout) :: mf
     real(dp_t), intent(in) :: val
@@ -588,7 +881,7 @@ contains
     ngmf = nghost(mf)
 
     if (lall) then
-       if (ngmf .ne. ng .and. ngmf .ne. 0) then
+       if (ngmf .gt. ng) then
           call bl_error("threadbox: do not know how to do setval in this case.")
        end if
     end if
@@ -605,6 +898,18 @@ contains
           p(wlo(1):whi(1),wlo(2):whi(2),wlo(3):whi(3),:) = val
        end do
        !$omp end parallel
+    else if (lall .and. ngmf.gt.0) then
+       !$omp parallel private(ib, wlo, whi, p)
+       wlo = 1
+       whi = 1
+       do ib = 1, nfabs(mf)
+          if (.not.tb_worktodo(ib)) cycle
+          p => dataptr(mf, ib)
+          wlo(1:ndim) = tb_get_halo_lo(ib, ngmf)
+          whi(1:ndim) = tb_get_halo_hi(ib, ngmf)
+          p(wlo(1):whi(1),wlo(2):whi(2),wlo(3):whi(3),:) = val
+       end do
+       !$omp end parallel
     else
        !$omp parallel private(ib, wlo, whi, p)
        wlo = 1
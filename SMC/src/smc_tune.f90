@@ -0,0 +1,424 @@
+module smc_tune_module
+
+  !
+  ! Search the thread-box, block and communication parameters for the
+  ! fastest dU/dt on this machine.  The search starts from the values in
+  ! the inputs file and changes one parameter at a time, keeping any
+  ! change that helps, until a sweep brings no improvement or t_tune
+  ! seconds have been spent.  The winner is used for the rest of the run
+  ! and written to tune_file.inputs; tune_file.report lists every
+  ! candidate and a per-kernel time/traffic table for the winner.
+  !
+  ! Run with max_step = 0 to tune without evolving.
+  !
+
+  use bl_error_module
+  use bl_prof_module
+  use multifab_module
+  use smc_threadbox_module
+  use advance_module, only : dUdt_tune, dUdt_wtime, nwt_dUdt, wt_ctoprim, wt_gettrans, &
+       wt_hypdiffterm, wt_chemterm
+
+  implicit none
+
+  type tune_cfg
+     integer :: split_dim, idim_more, idim_less
+     integer :: blocksize(3)
+     logical :: collapse, dynamic
+     logical :: overlap_comp, overlap_gettrans
+  end type tune_cfg
+
+  ! split_dim, idim_more/less, collapse, blocksize x/y/z, dynamic,
+  ! overlap_comp, overlap_gettrans
+  integer, parameter :: ntune_par = 9
+
+  ! candidate block sizes; <= 0 means no blocking in that direction
+  integer, parameter :: nbksizes = 5
+  integer, parameter :: bksizes_x(nbksizes) = [ -1, 16, 32, 64, 128 ]
+  integer, parameter :: bksizes_yz(nbksizes) = [ -1,  4,  8, 16,  32 ]
+
+  private
+  public :: smc_tune
+
+contains
+
+  subroutine smc_tune(la, U, dx)
+    use probin_module, only : t_tune, tune_nrep, verbose
+    use variables_module, only : ncons
+    use bl_IO_module, only : unit_new
+
+    type(layout),     intent(in   ) :: la
+    type(multifab),   intent(inout) :: U
+    double precision, intent(in   ) :: dx(3)
+
+    integer, parameter :: maxeval = 1000
+
+    type(multifab) :: Uprime
+    type(tune_cfg) :: best, trial
+    type(tune_cfg) :: tried(maxeval)
+    double precision :: ttried(maxeval)
+    double precision :: t1, tbest, tdefault, tlast, timespent
+    integer :: dm, neval, ipar, ival, nval, sweep, rep
+    logical :: bp_state, improved
+
+    bp_state = bl_prof_get_state()
+    call bl_prof_set_state(.false.) ! turn profiler off temporarily
+
+    dm = get_dim(la)
+
+    call multifab_build(Uprime, la, ncons, 0)
+    call tb_multifab_setval(Uprime, 0.d0)
+
+    call parallel_barrier()
+    t1 = parallel_wtime()
+
+    best = cfg_from_probin()
+    neval = 0
+    tbest = eval_cfg(best)
+    tdefault = tbest
+    tlast = tbest
+    call record(best, tbest)
+
+    call parallel_barrier()
+    timespent = parallel_wtime() - t1
+    call parallel_bcast(timespent)
+
+    sweep = 0
+    improved = .true.
+    do while (improved .and. timespent + tlast*(tune_nrep+1) < t_tune .and. neval < maxeval)
+
+       sweep = sweep + 1
+       improved = .false.
+
+       do ipar = 1, ntune_par
+          nval = num_values(ipar)
+          do ival = 1, nval
+
+             if (timespent + tlast*(tune_nrep+1) >= t_tune .or. neval >= maxeval) exit
+
+             trial = best
+             call set_value(trial, ipar, ival)
+             if (same_cfg(trial, best)) cycle
+             if (already_tried(trial)) cycle
+             if (.not. tb_config_ok(la, trial%split_dim, trial%collapse, &
+                  trial%idim_more, trial%idim_less)) cycle
+
+             tlast = eval_cfg(trial)
+             call record(trial, tlast)
+
+             ! 1% margin so that noise does not make us wander
+             if (tlast < 0.99d0*tbest) then
+                tbest = tlast
+                best = trial
+                improved = .true.
+             end if
+
+             call parallel_barrier()
+             timespent = parallel_wtime() - t1
+             call parallel_bcast(timespent)
+          end do
+       end do
+
+    end do
+
+    call apply_cfg(best, la)
+
+    if (verbose > 0 .and. parallel_IOProcessor()) then
+       print *, ''
+       print *, 'Tuned thread-box parameters:', neval, 'candidates in', sweep, 'sweeps'
+       print *, '   dUdt time with the inputs file parameters', tdefault
+       print *, '   dUdt time with the best parameters       ', tbest
+       print *, ''
+    end if
+
+    call write_inputs(best)
+    call write_report()
+
+    call destroy(Uprime)
+
+    call bl_prof_set_state(bp_state)
+
+  contains
+
+    ! time per full dU/dt, max over ranks; the first call is not timed
+    function eval_cfg(c) result(t)
+      type(tune_cfg), intent(in) :: c
+      double precision :: t, t0
+      call apply_cfg(c, la)
+      call dUdt_tune(U, Uprime, dx, .true., .true.)
+      call parallel_barrier()
+      t0 = parallel_wtime()
+      do rep = 1, tune_nrep
+         call dUdt_tune(U, Uprime, dx, .true., .true.)
+      end do
+      call parallel_barrier()
+      t = (parallel_wtime() - t0) / tune_nrep
+      call parallel_bcast(t)
+    end function eval_cfg
+
+    subroutine record(c, t)
+      type(tune_cfg), intent(in) :: c
+      double precision, intent(in) :: t
+      neval = neval + 1
+      tried(neval) = c
+      ttried(neval) = t
+      if (verbose > 1 .and. parallel_IOProcessor()) then
+         write(*,'(A,I4,A,A,ES12.4)') ' tune candidate ', neval, ': ', &
+              trim(cfg_string(c)), t
+      end if
+    end subroutine record
+
+    function already_tried(c) result(r)
+      type(tune_cfg), intent(in) :: c
+      logical :: r
+      integer :: i
+      r = .false.
+      do i = 1, neval
+         if (same_cfg(c, tried(i))) then
+            r = .true.
+            return
+         end if
+      end do
+    end function already_tried
+
+    function num_values(ipar) result(n)
+      integer, intent(in) :: ipar
+      integer :: n
+      select case (ipar)
+      case (1)
+         n = dm
+      case (2)
+         n = dm*(dm-1)
+      case (4,5,6)
+         n = nbksizes
+      case default
+         n = 2
+      end select
+      if (dm .eq. 1 .and. ipar .le. 2) n = 1
+      if (ipar .eq. 5 .and. dm .lt. 2) n = 1
+      if (ipar .eq. 6 .and. dm .lt. 3) n = 1
+    end function num_values
+
+    subroutine set_value(c, ipar, ival)
+      type(tune_cfg), intent(inout) :: c
+      integer, intent(in) :: ipar, ival
+      integer :: i, j, k
+      select case (ipar)
+      case (1)
+         c%split_dim = ival
+      case (2)
+         k = 0
+         do i = 1, dm
+            do j = 1, dm
+               if (i .eq. j) cycle
+               k = k + 1
+               if (k .eq. ival) then
+                  c%idim_more = i
+                  c%idim_less = j
+               end if
+            end do
+         end do
+      case (3)
+         c%collapse = ival .eq. 2
+      case (4)
+         c%blocksize(1) = bksizes_x(ival)
+      case (5)
+         if (dm .ge. 2) c%blocksize(2) = bksizes_yz(ival)
+      case (6)
+         if (dm .ge. 3) c%blocksize(3) = bksizes_yz(ival)
+      case (7)
+         c%dynamic = ival .eq. 2
+      case (8)
+         c%overlap_comp = ival .eq. 2
+      case (9)
+         ! only matters when communication is overlapped
+         if (c%overlap_comp) c%overlap_gettrans = ival .eq. 2
+      end select
+    end subroutine set_value
+
+    subroutine write_report()
+      use probin_module, only : tune_file, tune_nrep
+      use variables_module, only : nprim, ndq
+      use chemistry_module, only : nspecies
+      use derivative_stencil_module, only : stencil, s3d
+      use omp_module
+
+      character(len=11), parameter :: names(nwt_dUdt+3) = [ &
+           "ctoprim    ", "gettrans   ", "hypdiffterm", "chemterm   ", "nscbc      ", &
+           "dUdt AD    ", "dUdt R     ", "dUdt       " ]
+      double precision :: twt(nwt_dUdt+3), tmax(nwt_dUdt+3), bytes(nwt_dUdt+3)
+      double precision :: ncell, t0
+      integer :: i, k, un
+
+      ! pieces in isolation: advection-diffusion only, then reaction only
+      dUdt_wtime = 0.d0
+      call parallel_barrier()
+      t0 = parallel_wtime()
+      do rep = 1, tune_nrep
+         call dUdt_tune(U, Uprime, dx, .true., .false.)
+      end do
+      call parallel_barrier()
+      twt(nwt_dUdt+1) = (parallel_wtime() - t0) / tune_nrep
+      twt(1:nwt_dUdt) = dUdt_wtime / tune_nrep
+
+      dUdt_wtime = 0.d0
+      call parallel_barrier()
+      t0 = parallel_wtime()
+      do rep = 1, tune_nrep
+         call dUdt_tune(U, Uprime, dx, .false., .true.)
+      end do
+      call parallel_barrier()
+      twt(nwt_dUdt+2) = (parallel_wtime() - t0) / tune_nrep
+      twt(wt_chemterm) = dUdt_wtime(wt_chemterm) / tune_nrep
+
+      ! and together
+      call parallel_barrier()
+      t0 = parallel_wtime()
+      do rep = 1, tune_nrep
+         call dUdt_tune(U, Uprime, dx, .true., .true.)
+      end do
+      call parallel_barrier()
+      twt(nwt_dUdt+3) = (parallel_wtime() - t0) / tune_nrep
+
+      do i = 1, nwt_dUdt+3
+         call parallel_reduce(tmax(i), twt(i), MPI_MAX, proc = parallel_IOProcessorNode())
+      end do
+
+      ! Compulsory traffic: every component read or written once per
+      ! valid cell.  Ghost cells and cache misses are not counted, so the
+      ! bandwidths are lower bounds.
+      bytes = 0.d0
+      bytes(wt_ctoprim)     = ncons + nprim
+      bytes(wt_gettrans)    = nprim + 3 + nspecies
+      bytes(wt_hypdiffterm) = 3*ncons + nprim + 3 + nspecies
+      if (stencil .eq. s3d) bytes(wt_hypdiffterm) = bytes(wt_hypdiffterm) + 6*ndq
+      bytes(wt_chemterm)    = nprim + ncons + nspecies
+      bytes(nwt_dUdt+1) = sum(bytes(1:nwt_dUdt)) - bytes(wt_chemterm)
+      bytes(nwt_dUdt+2) = nprim + ncons + nspecies + ncons
+      bytes(nwt_dUdt+3) = sum(bytes(1:nwt_dUdt))
+      bytes = 8.d0 * bytes
+
+      ncell = dble(multifab_volume(U,.false.))
+
+      if (parallel_IOProcessor()) then
+         un = unit_new()
+         open(unit=un, file=trim(tune_file)//".report", form="formatted", &
+              access="sequential", action="write")
+
+         write(un,'(A)') 'SMC thread-box tuning report'
+         write(un,'(A,I8)') 'MPI processes: ', parallel_nprocs()
+         write(un,'(A,I8)') 'threads:       ', omp_get_max_threads()
+         write(un,'(A,I8)') 'boxes:         ', nboxes(la)
+         write(un,'(A,ES12.4)') 'valid cells:   ', ncell
+         write(un,'(A,I8)') 'repetitions:   ', tune_nrep
+         write(un,*)
+         write(un,'(A)') 'candidates (seconds per dUdt, max over ranks):'
+         do k = 1, neval
+            write(un,'(I5,2X,A,ES12.4)') k, cfg_string(tried(k)), ttried(k)
+         end do
+         write(un,*)
+         write(un,'(A)') 'best: '//trim(cfg_string(best))
+         write(un,*)
+         write(un,'(A)') 'kernels with the best parameters:'
+         write(un,'(A)') '  bytes/cell is compulsory traffic (one read or write per component'
+         write(un,'(A)') '  per valid cell), so GB/s is a lower bound; flops are not counted.'
+         write(un,'(A11,3A14)') 'kernel', 'seconds', 'bytes/cell', 'GB/s'
+         do i = 1, nwt_dUdt+3
+            if (bytes(i) > 0.d0 .and. tmax(i) > 0.d0) then
+               write(un,'(A11,ES14.4,F14.1,F14.3)') names(i), tmax(i), bytes(i), &
+                    bytes(i)*ncell/tmax(i)*1.d-9
+            else
+               write(un,'(A11,ES14.4,2A14)') names(i), tmax(i), '-', '-'
+            end if
+         end do
+
+         close(un)
+      end if
+
+    end subroutine write_report
+
+  end subroutine smc_tune
+
+
+  function cfg_from_probin() result(c)
+    use probin_module, only : tb_split_dim, tb_collapse_boxes, tb_idim_more, tb_idim_less, &
+         tb_blocksize_x, tb_blocksize_y, tb_blocksize_z, tb_dynamic, &
+         overlap_comm_comp, overlap_comm_gettrans
+    type(tune_cfg) :: c
+    c%split_dim = tb_split_dim
+    c%collapse = tb_collapse_boxes
+    c%idim_more = tb_idim_more
+    c%idim_less = tb_idim_less
+    c%blocksize = [ tb_blocksize_x, tb_blocksize_y, tb_blocksize_z ]
+    c%dynamic = tb_dynamic
+    c%overlap_comp = overlap_comm_comp
+    c%overlap_gettrans = overlap_comm_gettrans
+  end function cfg_from_probin
+
+
+  subroutine apply_cfg(c, la)
+    use probin_module, only : tb_split_dim, tb_collapse_boxes, tb_idim_more, tb_idim_less, &
+         tb_blocksize_x, tb_blocksize_y, tb_blocksize_z, tb_dynamic, &
+         overlap_comm_comp, overlap_comm_gettrans
+    use derivative_stencil_module, only : state_ng
+    type(tune_cfg), intent(in) :: c
+    type(layout),   intent(in) :: la
+    tb_split_dim = c%split_dim
+    tb_collapse_boxes = c%collapse
+    tb_idim_more = c%idim_more
+    tb_idim_less = c%idim_less
+    tb_blocksize_x = c%blocksize(1)
+    tb_blocksize_y = c%blocksize(2)
+    tb_blocksize_z = c%blocksize(3)
+    tb_dynamic = c%dynamic
+    overlap_comm_comp = c%overlap_comp
+    overlap_comm_gettrans = c%overlap_gettrans
+    call build_threadbox(la, state_ng)
+  end subroutine apply_cfg
+
+
+  function same_cfg(a, b) result(r)
+    type(tune_cfg), intent(in) :: a, b
+    logical :: r
+    r = a%split_dim .eq. b%split_dim .and. &
+         a%idim_more .eq. b%idim_more .and. a%idim_less .eq. b%idim_less .and. &
+         all(a%blocksize .eq. b%blocksize) .and. &
+         (a%collapse .eqv. b%collapse) .and. (a%dynamic .eqv. b%dynamic) .and. &
+         (a%overlap_comp .eqv. b%overlap_comp) .and. &
+         (a%overlap_gettrans .eqv. b%overlap_gettrans)
+  end function same_cfg
+
+
+  function cfg_string(c) result(s)
+    type(tune_cfg), intent(in) :: c
+    character(len=96) :: s
+    write(s,'(3I2,3I5,4L2)') c%split_dim, c%idim_more, c%idim_less, c%blocksize, &
+         c%collapse, c%dynamic, c%overlap_comp, c%overlap_gettrans
+  end function cfg_string
+
+
+  ! namelist lines that can be pasted into the &PROBIN of an inputs file
+  subroutine write_inputs(c)
+    use probin_module, only : tune_file
+    use bl_IO_module, only : unit_new
+    type(tune_cfg), intent(in) :: c
+    integer :: un
+    if (parallel_IOProcessor()) then
+       un = unit_new()
+       open(unit=un, file=trim(tune_file)//".inputs", form="formatted", &
+            access="sequential", action="write")
+       write(un,'(A,I0)') ' tb_split_dim   = ', c%split_dim
+       write(un,'(A,L1)') ' tb_collapse_boxes = ', c%collapse
+       write(un,'(A,I0)') ' tb_idim_more   = ', c%idim_more
+       write(un,'(A,I0)') ' tb_idim_less   = ', c%idim_less
+       write(un,'(A,I0)') ' tb_blocksize_x = ', c%blocksize(1)
+       write(un,'(A,I0)') ' tb_blocksize_y = ', c%blocksize(2)
+       write(un,'(A,I0)') ' tb_blocksize_z = ', c%blocksize(3)
+       write(un,'(A,L1)') ' tb_dynamic     = ', c%dynamic
+       write(un,'(A,L1)') ' overlap_comm_comp     = ', c%overlap_comp
+       write(un,'(A,L1)') ' overlap_comm_gettrans = ', c%overlap_gettrans
+       close(un)
+    end if
+  end subroutine write_inputs
+
+end module smc_tune_module
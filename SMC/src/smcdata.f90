@@ -2,7 +2,7 @@ module smcdata_module
 
   use multifab_module
   use sdcquad_module
-  use derivative_stencil_module, only : stencil, narrow, s3d, stencil_ng
+  use derivative_stencil_module, only : stencil, narrow, s3d, stencil_ng, state_ng
 
   implicit none
 
@@ -12,10 +12,11 @@ module smcdata_module
   type(multifab),save :: lam ! partial thermal conductivity
   type(multifab),save :: Ddiag ! diagonal components of rho * Y_k * D
   type(multifab),save :: qx, qy, qz  ! for S3D to store first-derivatives
+  type(multifab),save :: Qtrans ! T and Y at the last transport evaluation (trans_tol)
 
   private
 
-  public :: Uprime, Unew, Q, Fdif, Upchem, mu, xi, lam, Ddiag, qx, qy, qz
+  public :: Uprime, Unew, Q, Fdif, Upchem, mu, xi, lam, Ddiag, qx, qy, qz, Qtrans
   public :: build_smcdata, destroy_smcdata
 
 contains
@@ -23,7 +24,6 @@ contains
   subroutine build_smcdata(la,sdc)
     use variables_module, only : ncons, nprim, ndq
     use chemistry_module, only : nspecies
-    use derivative_stencil_module, only : stencil_ng
     use probin_module
     use smc_threadbox_module, only : tb_multifab_setval
 
@@ -31,28 +31,37 @@ contains
 
     type(layout),  intent(in) :: la
     type(sdc_ctx), intent(inout) :: sdc
-    integer :: err
+    integer :: err, ngp
+
+    ! In the deep-halo mode, dU/dt is also needed in ghost cells, up to
+    ! stencil_ng less than the state.
+    ngp = state_ng - stencil_ng
 
     if (method == SMC_ADVANCE_RK) then
-       call multifab_build(Uprime, la, ncons, 0)
-       call multifab_build(Unew,   la, ncons, stencil_ng)
+       call multifab_build(Uprime, la, ncons, ngp)
+       call multifab_build(Unew,   la, ncons, state_ng)
     else if (method == SMC_ADVANCE_SDC) then
        call sdc_imex_allocate(sdc%imex, err)
     else if (method == SMC_ADVANCE_MRSDC) then
        call sdc_mrex_allocate(sdc%mrex, err)
     end if
 
-    call multifab_build(Q, la, nprim, stencil_ng)
+    call multifab_build(Q, la, nprim, state_ng)
     call tb_multifab_setval(Q, 0.d0, .true.)
 
-    call multifab_build(Fdif, la, ncons, 0)
-    call multifab_build(Upchem, la, ncons, 0)
-    call tb_multifab_setval(Upchem, 0.d0)
+    call multifab_build(Fdif, la, ncons, ngp)
+    call multifab_build(Upchem, la, ncons, ngp)
+    call tb_multifab_setval(Upchem, 0.d0, .true.)
+
+    call multifab_build(mu , la, 1, state_ng)
+    call multifab_build(xi , la, 1, state_ng)
+    call multifab_build(lam, la, 1, state_ng)
+    call multifab_build(Ddiag, la, nspecies, state_ng)
 
-    call multifab_build(mu , la, 1, stencil_ng)
-    call multifab_build(xi , la, 1, stencil_ng)
-    call multifab_build(lam, la, 1, stencil_ng)
-    call multifab_build(Ddiag, la, nspecies, stencil_ng)
+    if (trans_tol > 0.d0) then
+       call multifab_build(Qtrans, la, nspecies+1, state_ng)
+       call tb_multifab_setval(Qtrans, -1.d0, .true.)
+    end if
 
     if (stencil .eq. s3d) then
        call multifab_build(qx, la, ndq, stencil_ng)
@@ -87,6 +96,10 @@ contains
     call destroy(lam)
     call destroy(Ddiag)
 
+    if (trans_tol > 0.d0) then
+       call destroy(Qtrans)
+    end if
+
     if (stencil .eq. s3d) then
        call destroy(qx)
        call destroy(qy)
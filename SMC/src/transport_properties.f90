@@ -11,7 +11,11 @@ module transport_properties
 
   private
 
-  public get_transport_properties
+  public get_transport_properties, get_transport_properties_lagged, trans_lag_stats
+
+  ! thread-box blocks checked and refreshed by get_transport_properties_lagged
+  ! since the last call to trans_lag_stats
+  integer, save :: nblk_checked = 0, nblk_refreshed = 0
 
 contains
 
@@ -86,6 +90,256 @@ contains
   end subroutine get_transport_properties
 
 
+  !
+  ! Like get_transport_properties, but per thread-box block, and the block
+  ! is only recomputed if T or Y has changed by more than tol since its
+  ! last evaluation (relative change in T, absolute change in Y).  Qref
+  ! holds T and Y of the last evaluation of every cell; T < 0 forces a
+  ! refresh.
+  !
+  subroutine get_transport_properties_lagged(Q, Qref, mu, xi, lam, Ddiag, tol, ng)
+
+    use probin_module, only : use_tranlib
+    use smc_bc_module, only : get_data_lo_hi
+    use smc_threadbox_module, only : tb_sched_begin, tb_sched_next, tb_get_task_box, &
+         tb_get_task_halo_lo, tb_get_task_halo_hi, tb_get_max_task_width
+
+    type(multifab),   intent(in   ) :: Q
+    type(multifab),   intent(inout) :: Qref, mu, xi, lam, Ddiag
+    double precision, intent(in   ) :: tol
+    integer, intent(in), optional :: ng
+
+    integer :: ngwork, ngq, idim, n, itask, dm, nchk, nref, npmax
+    integer :: dlo(Q%dim), dhi(Q%dim), wlo(Q%dim), whi(Q%dim)
+    integer :: blo(3), bhi(3)
+    double precision, pointer, dimension(:,:,:,:) :: qp, rp, mup, xip, lamp, dp
+
+    dm = Q%dim
+    ngq = nghost(Q)
+
+    if (dm .eq. 1) call bl_error("get_transport_properties_lagged: 1D not supported")
+
+    ngwork = ngq
+    if (present(ng)) then
+       ngwork = min(ngwork, ng)
+    end if
+
+    nchk = 0
+    nref = 0
+
+    ! One EGZ vector width for all blocks, so that egzini does not
+    ! reallocate its work arrays from one block to the next
+    npmax = tb_get_max_task_width(ngq)
+
+    call tb_sched_begin()
+    !$omp parallel private(n,itask,idim,dlo,dhi,wlo,whi,blo,bhi) &
+    !$omp private(qp,rp,mup,xip,lamp,dp) reduction(+:nchk,nref)
+
+    if (.not. use_tranlib .and. npmax .gt. 0) call egzini(npmax)
+
+    do while (tb_sched_next(itask))
+
+       n = tb_get_task_box(itask)
+
+       qp => dataptr(Q,n)
+       rp => dataptr(Qref,n)
+       mup => dataptr(mu,n)
+       xip => dataptr(xi,n)
+       lamp => dataptr(lam,n)
+       dp => dataptr(Ddiag,n)
+
+       call get_data_lo_hi(n,dlo,dhi)
+
+       wlo = tb_get_task_halo_lo(itask, ngwork)
+       whi = tb_get_task_halo_hi(itask, ngwork)
+       do idim=1,dm
+          wlo(idim) = max(wlo(idim), dlo(idim))
+          whi(idim) = min(whi(idim), dhi(idim))
+       end do
+
+       blo = 1
+       bhi = 1
+       blo(1:dm) = wlo
+       bhi(1:dm) = whi
+
+       nchk = nchk + 1
+       if (.not. trans_stale(blo,bhi,qp,rp,tol)) cycle
+       nref = nref + 1
+
+       call trans_prop_block(blo,bhi,qp,mup,xip,lamp,dp,npmax)
+
+       rp(blo(1):bhi(1),blo(2):bhi(2),blo(3):bhi(3),1) = &
+            qp(blo(1):bhi(1),blo(2):bhi(2),blo(3):bhi(3),qtemp)
+       rp(blo(1):bhi(1),blo(2):bhi(2),blo(3):bhi(3),2:nspecies+1) = &
+            qp(blo(1):bhi(1),blo(2):bhi(2),blo(3):bhi(3),qy1:qy1+nspecies-1)
+
+    end do
+    !$omp end parallel
+
+    nblk_checked = nblk_checked + nchk
+    nblk_refreshed = nblk_refreshed + nref
+
+  end subroutine get_transport_properties_lagged
+
+
+  !
+  ! Transport properties of the cells lo:hi of one block, called by a
+  ! single thread inside a parallel region.  The EGZ routines work on np
+  ! cells at a time (egzini(np) must have been called by this thread);
+  ! shorter rows are padded with copies of their last cell.
+  !
+  subroutine trans_prop_block(lo,hi,q,mu,xi,lam,Ddiag,np)
+    use probin_module, only : use_tranlib, use_bulk_viscosity
+    integer, intent(in) :: lo(3), hi(3), np
+    double precision, pointer, intent(in) :: q(:,:,:,:), mu(:,:,:,:), xi(:,:,:,:), &
+         lam(:,:,:,:), Ddiag(:,:,:,:)
+
+    integer :: i, j, k, n, m, iwrk
+    double precision :: rwrk, Wbar, Cp(nspecies), Xt(nspecies), Dt(nspecies)
+    double precision, allocatable :: TZ(:), EZ(:), KZ(:), L1Z(:), L2Z(:), &
+         DZ(:,:), XZ(:,:), CPZ(:,:)
+
+    if (use_tranlib) then
+
+       do k=lo(3),hi(3)
+          do j=lo(2),hi(2)
+             do i=lo(1),hi(1)
+
+                do n=1,nspecies
+                   Xt(n) = q(i,j,k,qx1+n-1)
+                end do
+
+                call mcavis(q(i,j,k,qtemp),Xt,mcwork,mu(i,j,k,1))
+
+                xi(i,j,k,1) = 0.d0
+
+                call mcacon(q(i,j,k,qtemp),Xt,mcwork,lam(i,j,k,1))
+
+                call mcadif(q(i,j,k,qpres),q(i,j,k,qtemp),Xt,mcwork,Dt)
+
+                call ckmmwx(Xt, iwrk, rwrk, Wbar)
+                rwrk = q(i,j,k,qrho) / Wbar
+                do n=1,nspecies
+                   Ddiag(i,j,k,n) = rwrk * Dt(n) * molecular_weight(n)
+                end do
+
+             end do
+          end do
+       end do
+
+       return
+    end if
+
+    m = hi(1) - lo(1) + 1
+
+    allocate(TZ(np))
+    allocate(EZ(np))
+    allocate(KZ(np))
+    allocate(L1Z(np))
+    allocate(L2Z(np))
+    allocate(DZ(np,nspecies))
+    allocate(XZ(np,nspecies))
+    allocate(CPZ(np,nspecies))
+
+    do k=lo(3),hi(3)
+       do j=lo(2),hi(2)
+
+          TZ(1:m) = q(lo(1):hi(1),j,k,qtemp)
+          TZ(m+1:np) = TZ(m)
+          do n=1,nspecies
+             XZ(1:m,n) = q(lo(1):hi(1),j,k,qx1+n-1)
+             XZ(m+1:np,n) = XZ(m,n)
+          end do
+
+          if (use_bulk_viscosity) then
+             do i=1,np
+                call ckcpms(TZ(i), iwrk, rwrk, Cp)
+                CPZ(i,:) = Cp
+             end do
+          else
+             CPZ = 0.d0
+          end if
+
+          call egzpar(TZ, XZ, CPZ)
+
+          call egze3(TZ, EZ)
+
+          if (use_bulk_viscosity) then
+             call egzk3(TZ, KZ)
+          else
+             KZ = 0.d0
+          end if
+
+          call egzl1( 1.d0, XZ, L1Z)
+          call egzl1(-1.d0, XZ, L2Z)
+
+          mu (lo(1):hi(1),j,k,1) = EZ(1:m)
+          xi (lo(1):hi(1),j,k,1) = KZ(1:m)
+          lam(lo(1):hi(1),j,k,1) = 0.5d0*(L1Z(1:m)+L2Z(1:m))
+
+          call EGZVR1(TZ, DZ)
+          do n=1,nspecies
+             Ddiag(lo(1):hi(1),j,k,n) = DZ(1:m,n)
+          end do
+
+       end do
+    end do
+
+    deallocate(TZ, EZ, KZ, L1Z, L2Z, DZ, XZ, CPZ)
+
+  end subroutine trans_prop_block
+
+
+  function trans_stale(lo,hi,q,r,tol) result(stale)
+    integer, intent(in) :: lo(3), hi(3)
+    double precision, intent(in) :: tol
+    double precision, pointer, intent(in) :: q(:,:,:,:), r(:,:,:,:)
+    logical :: stale
+
+    integer :: i, j, k, n
+
+    stale = .true.
+    do k=lo(3),hi(3)
+       do j=lo(2),hi(2)
+          do i=lo(1),hi(1)
+             if (abs(q(i,j,k,qtemp)-r(i,j,k,1)) .gt. tol*r(i,j,k,1)) return
+          end do
+       end do
+    end do
+    do n=1,nspecies
+       do k=lo(3),hi(3)
+          do j=lo(2),hi(2)
+             do i=lo(1),hi(1)
+                if (abs(q(i,j,k,qy1+n-1)-r(i,j,k,n+1)) .gt. tol) return
+             end do
+          end do
+       end do
+    end do
+    stale = .false.
+  end function trans_stale
+
+
+  !
+  ! Fraction of blocks refreshed by get_transport_properties_lagged, over
+  ! all ranks, since the last call.  Returns -1 if nothing was checked.
+  !
+  function trans_lag_stats() result(frac)
+    double precision :: frac
+    integer :: nchk, nref
+
+    call parallel_reduce(nchk, nblk_checked, MPI_SUM)
+    call parallel_reduce(nref, nblk_refreshed, MPI_SUM)
+    nblk_checked = 0
+    nblk_refreshed = 0
+
+    if (nchk .gt. 0) then
+       frac = dble(nref) / dble(nchk)
+    else
+       frac = -1.d0
+    end if
+  end function trans_lag_stats
+
+
   subroutine get_trans_prop_1d(lo,hi,ng,q,mu,xi,lam,Ddiag,wlo,whi,gco)
     use probin_module, only : use_bulk_viscosity
     logical, intent(in) :: gco  ! ghost cells only
@@ -381,22 +381,25 @@ contains
 
   !
   ! Enforce nonnegative species and compute total density
+  ! (also in the first ng_halo ghost cells, if passed)
   !
-  subroutine reset_density(U)
+  subroutine reset_density(U, ng_halo)
     type(multifab), intent(inout) :: U
+    integer, intent(in), optional :: ng_halo
     
-    integer :: dm, ng
+    integer :: dm, ng, ngh
     integer :: n, lo(U%dim), hi(U%dim)
     double precision, pointer, dimension(:,:,:,:) :: up
 
     dm = U%dim
-    ng = nghost(U)
+    ngh = 0; if (present(ng_halo)) ngh = max(ng_halo, 0)
+    ng = nghost(U) - ngh
     
     do n=1,nfabs(U)
        up => dataptr(U, n)
        
-       lo = lwb(get_box(U,n))
-       hi = upb(get_box(U,n))
+       lo = lwb(get_box(U,n)) - ngh
+       hi = upb(get_box(U,n)) + ngh
 
        if (dm .eq. 1) then
           call reset_rho_1d(lo,hi,ng,up)